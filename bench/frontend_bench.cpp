@@ -0,0 +1,272 @@
+#include "lexer.hpp"
+#include "parser.hpp"
+#include "statement.hpp"
+#include "utils.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Microbenchmarks of the front end: splitting a script into statements,
+// lexing, recognizing tokens and parsing each kind of statement, over
+// corpora of generated statements like those of our scripts. Each prints
+// one JSON line with the time and heap allocations per operation.
+
+//-----------------------------------------------------------------------------
+// Allocation counting: every operator new of the process goes through here
+//-----------------------------------------------------------------------------
+
+static std::atomic<size_t> allocations{0};
+static std::atomic<size_t> allocated_bytes{0};
+
+static void *allocate(size_t size, size_t extra = 0) {
+  allocations.fetch_add(1, std::memory_order_relaxed);
+  allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+  if (void *memory = std::malloc(size + extra == 0 ? 1 : size + extra)) {
+    return memory;
+  }
+  throw std::bad_alloc();
+}
+
+// Over-aligned blocks are cut out of a larger one, with the start of that
+// stored just before them, since aligned_alloc is missing on Windows
+static void *allocate(size_t size, std::align_val_t alignment) {
+  size_t align = static_cast<size_t>(alignment);
+  char *base = static_cast<char *>(allocate(size, align + sizeof(void *)));
+  uintptr_t start = reinterpret_cast<uintptr_t>(base + sizeof(void *));
+  uintptr_t aligned = (start + align - 1) & ~static_cast<uintptr_t>(align - 1);
+  reinterpret_cast<void **>(aligned)[-1] = base;
+  return reinterpret_cast<void *>(aligned);
+}
+
+static void deallocate(void *memory, std::align_val_t) {
+  if (memory) {
+    std::free(static_cast<void **>(memory)[-1]);
+  }
+}
+
+void *operator new(size_t size) { return allocate(size); }
+void *operator new[](size_t size) { return allocate(size); }
+void *operator new(size_t size, std::align_val_t alignment) {
+  return allocate(size, alignment);
+}
+void *operator new[](size_t size, std::align_val_t alignment) {
+  return allocate(size, alignment);
+}
+
+void operator delete(void *memory) noexcept { std::free(memory); }
+void operator delete[](void *memory) noexcept { operator delete(memory); }
+void operator delete(void *memory, size_t) noexcept {
+  operator delete(memory);
+}
+void operator delete[](void *memory, size_t) noexcept {
+  operator delete(memory);
+}
+void operator delete(void *memory, std::align_val_t alignment) noexcept {
+  deallocate(memory, alignment);
+}
+void operator delete[](void *memory, std::align_val_t alignment) noexcept {
+  deallocate(memory, alignment);
+}
+void operator delete(void *memory, size_t,
+                     std::align_val_t alignment) noexcept {
+  deallocate(memory, alignment);
+}
+void operator delete[](void *memory, size_t,
+                       std::align_val_t alignment) noexcept {
+  deallocate(memory, alignment);
+}
+
+//-----------------------------------------------------------------------------
+// Corpora
+//-----------------------------------------------------------------------------
+
+class CorpusGenerator {
+public:
+  explicit CorpusGenerator(uint64_t seed) : random(seed) {}
+
+  std::string insert() {
+    return "INSERT INTO students VALUES (" + number(100000) + ", '" +
+           name() + "', " + decimal() + ", '" + major() + "');";
+  }
+
+  // WHERE conditions nested two and three levels deep
+  std::string select() {
+    return "SELECT id, name, gpa FROM students WHERE (gpa > " + decimal() +
+           " AND major = '" + major() + "') OR (id < " + number(100000) +
+           " AND (gpa < " + decimal() + " OR name = '" + name() + "'));";
+  }
+
+  std::string update() {
+    return "UPDATE students SET gpa = (gpa + " + decimal() + ") * " +
+           decimal() + " - " + decimal() + ", credits = credits + " +
+           number(10) + " WHERE id = " + number(100000) + ";";
+  }
+
+  std::string join() {
+    return "SELECT students.name, enrollments.grade, courses.title FROM "
+           "students INNER JOIN enrollments ON students.id = "
+           "enrollments.student_id INNER JOIN courses ON "
+           "enrollments.course_id = courses.id WHERE enrollments.grade > " +
+           number(100) + ";";
+  }
+
+private:
+  std::mt19937_64 random;
+
+  std::string number(int bound) {
+    return std::to_string(static_cast<int>(random() % bound));
+  }
+  std::string decimal() {
+    return number(5) + "." + std::to_string(10 + random() % 90);
+  }
+  std::string name() {
+    static const char *names[] = {"Alice Smith", "Bob Jones", "Carol White",
+                                  "Dan Brown", "Eve Black"};
+    return std::string(names[random() % 5]) + " " + number(1000);
+  }
+  std::string major() {
+    static const char *majors[] = {"CS", "Math", "Physics", "History"};
+    return majors[random() % 4];
+  }
+};
+
+//-----------------------------------------------------------------------------
+// Measurement
+//-----------------------------------------------------------------------------
+
+// Keeps results observable so the work is not optimized away
+static volatile size_t sink = 0;
+
+// Time `pass`, which performs `operations` operations, over `repeat`
+// passes. The fastest pass is reported, with the allocations of the last.
+template <typename Pass>
+void measure(const std::string &benchmark, size_t operations, int repeat,
+             Pass pass) {
+  double best = 0;
+  size_t pass_allocations = 0;
+  size_t pass_bytes = 0;
+  for (int i = 0; i < repeat; i++) {
+    size_t allocations_before = allocations;
+    size_t bytes_before = allocated_bytes;
+    auto start = std::chrono::steady_clock::now();
+    pass();
+    auto end = std::chrono::steady_clock::now();
+    pass_allocations = allocations - allocations_before;
+    pass_bytes = allocated_bytes - bytes_before;
+    double ns = std::chrono::duration<double, std::nano>(end - start).count();
+    best = i == 0 ? ns : std::min(best, ns);
+  }
+  std::cout << "{\"benchmark\":\"" << benchmark
+            << "\",\"operations\":" << operations
+            << ",\"ns_per_operation\":" << best / operations
+            << ",\"allocations_per_operation\":"
+            << static_cast<double>(pass_allocations) / operations
+            << ",\"bytes_per_operation\":"
+            << static_cast<double>(pass_bytes) / operations << "}"
+            << std::endl;
+}
+
+int main(int argc, char *argv[]) {
+  size_t statements = 10000;
+  int repeat = 5;
+  uint64_t seed = 1;
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    if (arg.rfind("--statements=", 0) == 0) {
+      statements = std::max(1, std::atoi(arg.c_str() + 13));
+    } else if (arg.rfind("--repeat=", 0) == 0) {
+      repeat = std::max(1, std::atoi(arg.c_str() + 9));
+    } else if (arg.rfind("--seed=", 0) == 0) {
+      seed = std::strtoull(arg.c_str() + 7, nullptr, 10);
+    } else {
+      std::cerr << "Usage: minidb_frontend_bench [--statements=N] "
+                   "[--repeat=N] [--seed=N]\n";
+      return EXIT_FAILURE;
+    }
+  }
+
+  CorpusGenerator generator(seed);
+  struct Corpus {
+    std::string name;
+    std::vector<Statement> statements;
+  };
+  std::vector<Corpus> corpora = {
+      {"insert", {}}, {"select", {}}, {"update", {}}, {"join", {}}};
+  std::string script; // All of them, interleaved, one per line
+  for (size_t i = 0; i < statements; i++) {
+    std::string texts[] = {generator.insert(), generator.select(),
+                           generator.update(), generator.join()};
+    for (size_t c = 0; c < corpora.size(); c++) {
+      corpora[c].statements.emplace_back(texts[c], 1);
+      script += texts[c] + "\n";
+    }
+  }
+
+  try {
+    measure("split_statements", corpora.size() * statements, repeat, [&] {
+      std::istringstream in(script);
+      sink = sink + splitStatements(in).size();
+    });
+
+    // The words the lexer hands to recognizeToken, from every corpus
+    std::vector<std::string> words;
+    for (const auto &corpus : corpora) {
+      for (size_t i = 0; i < std::min<size_t>(statements, 1000); i++) {
+        std::istringstream in(corpus.statements[i].content);
+        std::string word;
+        while (in >> word) {
+          word.erase(std::remove_if(word.begin(), word.end(),
+                                    [](char c) {
+                                      return c == ',' || c == ';' ||
+                                             c == '(' || c == ')' ||
+                                             c == '\'';
+                                    }),
+                     word.end());
+          if (!word.empty()) {
+            words.push_back(word);
+          }
+        }
+      }
+    }
+    measure("recognize_token", words.size(), repeat, [&] {
+      for (const auto &word : words) {
+        sink = sink + static_cast<size_t>(recognizeToken(word));
+      }
+    });
+
+    // One arena, emptied before each statement as a session does
+    Arena arena;
+    for (const auto &corpus : corpora) {
+      measure("lexer_" + corpus.name, corpus.statements.size(), repeat, [&] {
+        for (const auto &statement : corpus.statements) {
+          arena.reset();
+          Lexer lexer(statement.content, arena, statement.start_line);
+          sink = sink + static_cast<size_t>(lexer.getNextToken().type);
+        }
+      });
+    }
+    // Parsing includes lexing, as the parser lexes its input first
+    for (const auto &corpus : corpora) {
+      measure("parse_" + corpus.name, corpus.statements.size(), repeat, [&] {
+        for (const auto &statement : corpus.statements) {
+          arena.reset();
+          auto parsed =
+              Parser(statement.content, arena, statement.start_line).parse();
+          sink = sink + static_cast<size_t>(parsed->type);
+        }
+      });
+    }
+  } catch (const std::exception &e) {
+    std::cerr << e.what() << "\n";
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
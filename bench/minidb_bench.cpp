@@ -0,0 +1,264 @@
+#include "minidb.hpp"
+#include "utils.hpp"
+#include "workload.hpp"
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <filesystem>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+// Every workload, in the order they run at each scale
+const std::vector<std::string> WORKLOADS = {
+    "insert", "point_lookup", "range_scan", "update",
+    "join2",  "join3",        "delete"};
+
+struct BenchOptions {
+  std::vector<size_t> scales = {1000, 10000, 100000};
+  std::vector<std::string> workloads = WORKLOADS;
+  size_t queries = 1000;     // Per point lookup, range, update and delete
+  size_t join_queries = 10;  // Per join workload
+  size_t batch = 1000;       // INSERT statements per operation
+  uint64_t seed = 1;
+  std::string data_dir;      // A temporary directory if empty
+  bool script = false;       // Print the SQL instead of running it
+};
+
+// Times operations, each one execute() of the connection
+class Recorder {
+public:
+  Recorder(const std::string &workload, size_t rows, size_t statements)
+      : workload(workload), rows(rows), statements(statements) {}
+
+  void run(Connection &connection, const std::string &sql) {
+    auto start = std::chrono::steady_clock::now();
+    connection.execute(sql);
+    auto end = std::chrono::steady_clock::now();
+    latencies.push_back(
+        std::chrono::duration<double, std::micro>(end - start).count());
+  }
+
+  // One JSON object per line
+  void report(std::ostream &out) {
+    std::sort(latencies.begin(), latencies.end());
+    double total = 0;
+    for (double latency : latencies) {
+      total += latency;
+    }
+    double seconds = total / 1e6;
+    size_t operations = latencies.size();
+    out << "{\"workload\":\"" << workload << "\",\"rows\":" << rows
+        << ",\"operations\":" << operations
+        << ",\"statements_per_operation\":" << statements
+        << ",\"seconds\":" << seconds << ",\"operations_per_second\":"
+        << (seconds > 0 ? operations / seconds : 0)
+        << ",\"statements_per_second\":"
+        << (seconds > 0 ? operations * statements / seconds : 0)
+        << ",\"latency_us\":{\"mean\":"
+        << (operations > 0 ? total / operations : 0)
+        << ",\"p50\":" << percentile(0.50) << ",\"p90\":" << percentile(0.90)
+        << ",\"p99\":" << percentile(0.99) << ",\"max\":" << percentile(1.0)
+        << "}}" << std::endl;
+  }
+
+private:
+  std::string workload;
+  size_t rows;
+  size_t statements;
+  std::vector<double> latencies;
+
+  // Nearest-rank, of the sorted latencies
+  double percentile(double fraction) const {
+    if (latencies.empty()) {
+      return 0;
+    }
+    auto rank = static_cast<size_t>(fraction * latencies.size() + 0.999999);
+    return latencies[std::clamp<size_t>(rank, 1, latencies.size()) - 1];
+  }
+};
+
+bool selected(const BenchOptions &options, const std::string &workload) {
+  return std::count(options.workloads.begin(), options.workloads.end(),
+                    workload) > 0;
+}
+
+// The statements of one operation of each workload other than the load.
+// The i-th of `count` is asked for.
+std::function<std::string(size_t, size_t)>
+operation(WorkloadGenerator &generator, const std::string &workload) {
+  if (workload == "point_lookup") {
+    return [&](size_t, size_t) { return generator.pointLookup(); };
+  } else if (workload == "range_scan") {
+    return [&](size_t, size_t) { return generator.rangeScan(); };
+  } else if (workload == "update") {
+    return [&](size_t, size_t) { return generator.update(); };
+  } else if (workload == "join2") {
+    return [&](size_t, size_t) { return generator.join2(); };
+  } else if (workload == "join3") {
+    return [&](size_t, size_t) { return generator.join3(); };
+  }
+  return [&](size_t i, size_t count) {
+    return generator.deleteRow(i, count);
+  };
+}
+
+// Load the tables of one scale, timing the load of items as "insert", then
+// run the other workloads against them
+void runScale(const BenchOptions &options, size_t rows,
+              const std::string &data_dir) {
+  WorkloadGenerator generator(rows, options.seed);
+  std::unique_ptr<Connection> connection;
+  auto execute = [&](const std::string &sql) {
+    if (options.script) {
+      std::cout << sql;
+    } else {
+      connection->execute(sql);
+    }
+  };
+  if (!options.script) {
+    connection = Connection::open(data_dir);
+  }
+  execute(generator.schema());
+
+  Recorder load("insert", rows, options.batch);
+  for (size_t begin = 0; begin < rows; begin += options.batch) {
+    std::string sql = generator.insertItems(
+        begin, std::min(rows, begin + options.batch));
+    if (options.script) {
+      execute(sql);
+    } else {
+      load.run(*connection, sql);
+    }
+  }
+  if (!options.script && selected(options, "insert")) {
+    load.report(std::cout);
+  }
+  for (size_t begin = 0; begin < rows; begin += options.batch) {
+    size_t end = std::min(rows, begin + options.batch);
+    execute(generator.insertOrders(begin, end));
+    execute(generator.insertNotes(begin, end));
+  }
+
+  for (const auto &workload : WORKLOADS) {
+    if (workload == "insert" || !selected(options, workload)) {
+      continue;
+    }
+    size_t count = workload.rfind("join", 0) == 0 ? options.join_queries
+                                                   : options.queries;
+    if (workload == "delete") {
+      // Each deletes a row of its own
+      count = std::min(count, rows);
+    }
+    auto next = operation(generator, workload);
+    Recorder recorder(workload, rows, 1);
+    for (size_t i = 0; i < count; i++) {
+      std::string sql = next(i, count);
+      if (options.script) {
+        execute(sql);
+      } else {
+        recorder.run(*connection, sql);
+      }
+    }
+    if (!options.script) {
+      recorder.report(std::cout);
+    }
+  }
+}
+
+// A comma separated list
+template <typename T>
+std::vector<T> splitList(const std::string &text,
+                         T (*parse)(const std::string &)) {
+  std::vector<T> items;
+  std::istringstream in(text);
+  std::string item;
+  while (std::getline(in, item, ',')) {
+    items.push_back(parse(item));
+  }
+  return items;
+}
+
+size_t parseCount(const std::string &text) {
+  size_t digits = 0;
+  while (digits < text.size() && std::isdigit(text[digits])) {
+    digits++;
+  }
+  if (digits == 0 || digits != text.size() || digits > 12) {
+    throw ArgumentError("Invalid number: " + text);
+  }
+  return std::stoull(text);
+}
+
+std::string parseWorkload(const std::string &text) {
+  if (!std::count(WORKLOADS.begin(), WORKLOADS.end(), text)) {
+    throw ArgumentError("Unknown workload: " + text);
+  }
+  return text;
+}
+
+int main(int argc, char *argv[]) {
+  try {
+    BenchOptions options;
+    for (int i = 1; i < argc; i++) {
+      std::string arg = argv[i];
+      if (arg.rfind("--rows=", 0) == 0) {
+        options.scales = splitList(arg.substr(7), parseCount);
+      } else if (arg.rfind("--workloads=", 0) == 0) {
+        options.workloads = splitList(arg.substr(12), parseWorkload);
+      } else if (arg.rfind("--queries=", 0) == 0) {
+        options.queries = parseCount(arg.substr(10));
+      } else if (arg.rfind("--join-queries=", 0) == 0) {
+        options.join_queries = parseCount(arg.substr(15));
+      } else if (arg.rfind("--batch=", 0) == 0) {
+        options.batch = std::max<size_t>(1, parseCount(arg.substr(8)));
+      } else if (arg.rfind("--seed=", 0) == 0) {
+        options.seed = parseCount(arg.substr(7));
+      } else if (arg.rfind("--data-dir=", 0) == 0) {
+        options.data_dir = arg.substr(11);
+      } else if (arg == "--script") {
+        options.script = true;
+      } else {
+        throw ArgumentError("Unknown argument: " + arg);
+      }
+    }
+
+    for (size_t rows : options.scales) {
+      // A fresh directory per scale, removed afterwards unless given
+      std::string data_dir = options.data_dir;
+      bool temporary = data_dir.empty() && !options.script;
+      if (temporary) {
+        // A new directory under a random name, so that benchmarks run at
+        // once keep apart
+        std::random_device random;
+        do {
+          data_dir = (fs::temp_directory_path() /
+                      ("minidb_bench_" + std::to_string(random()) + "_" +
+                       std::to_string(rows)))
+                         .string();
+        } while (!fs::create_directory(data_dir));
+      }
+      runScale(options, rows, data_dir);
+      if (temporary) {
+        fs::remove_all(data_dir);
+      }
+    }
+  } catch (const ArgumentError &e) {
+    std::cerr << "ArgumentError: " << e.what() << "\n"
+              << "Usage: minidb_bench [--rows=N,...] [--workloads=NAME,...] "
+                 "[--queries=N] [--join-queries=N] [--batch=N] [--seed=N] "
+                 "[--data-dir=DIR] [--script]\n"
+              << "Workloads: insert, point_lookup, range_scan, update, "
+                 "join2, join3, delete\n";
+    return EXIT_FAILURE;
+  } catch (const std::exception &e) {
+    std::cerr << errorMessage(e) << "\n";
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
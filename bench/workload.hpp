@@ -0,0 +1,136 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+
+// Synthetic workloads for minidb_bench, as SQL. At a scale of n rows the
+// database bench_<n> has three tables of n rows each:
+//
+//   items  (id INTEGER, grp INTEGER, price FLOAT, name TEXT)
+//   orders (id INTEGER, item_id INTEGER, qty INTEGER)
+//   notes  (id INTEGER, order_id INTEGER, tag TEXT)
+//
+// Ids run from 0 to n - 1 in insertion order; the references between the
+// tables, quantities and tags are uniformly random. The same seed gives
+// the same statements with any compiler: each random draw is a statement
+// of its own, as the operands of one expression may be evaluated in any
+// order.
+class WorkloadGenerator {
+public:
+  // Distinct quantities and tags, which set the selectivity of the joins
+  static constexpr int QUANTITIES = 100;
+  static constexpr int TAGS = 100;
+  // Rows a range scan or ranged update covers
+  static constexpr size_t RANGE_ROWS = 100;
+
+  WorkloadGenerator(size_t rows, uint64_t seed) : rows(rows), random(seed) {}
+
+  std::string databaseName() const {
+    return "bench_" + std::to_string(rows);
+  }
+
+  std::string schema() const {
+    return "CREATE DATABASE " + databaseName() + ";\n" + use() +
+           "CREATE TABLE items (id INTEGER, grp INTEGER, price FLOAT, "
+           "name TEXT);\n"
+           "CREATE TABLE orders (id INTEGER, item_id INTEGER, qty INTEGER);\n"
+           "CREATE TABLE notes (id INTEGER, order_id INTEGER, tag TEXT);\n";
+  }
+
+  std::string use() const { return "USE DATABASE " + databaseName() + ";\n"; }
+
+  // INSERT statements for the rows of ids [begin, end) of each table
+  std::string insertItems(size_t begin, size_t end) {
+    std::string sql;
+    for (size_t id = begin; id < end; id++) {
+      sql += "INSERT INTO items VALUES (" + std::to_string(id) + ", " +
+             std::to_string(id % 1000) + ", " + price() + ", 'item" +
+             std::to_string(id) + "');\n";
+    }
+    return sql;
+  }
+
+  std::string insertOrders(size_t begin, size_t end) {
+    std::string sql;
+    for (size_t id = begin; id < end; id++) {
+      size_t item_id = anyId();
+      int qty = quantity();
+      sql += "INSERT INTO orders VALUES (" + std::to_string(id) + ", " +
+             std::to_string(item_id) + ", " + std::to_string(qty) + ");\n";
+    }
+    return sql;
+  }
+
+  std::string insertNotes(size_t begin, size_t end) {
+    std::string sql;
+    for (size_t id = begin; id < end; id++) {
+      size_t order_id = anyId();
+      sql += "INSERT INTO notes VALUES (" + std::to_string(id) + ", " +
+             std::to_string(order_id) + ", '" + tag() + "');\n";
+    }
+    return sql;
+  }
+
+  std::string pointLookup() {
+    return "SELECT * FROM items WHERE id = " + std::to_string(anyId()) +
+           ";\n";
+  }
+
+  std::string rangeScan() {
+    size_t low = rangeStart();
+    return "SELECT id, price FROM items WHERE id > " +
+           std::to_string(static_cast<long long>(low) - 1) + " AND id < " +
+           std::to_string(low + RANGE_ROWS) + ";\n";
+  }
+
+  std::string update() {
+    size_t low = rangeStart();
+    return "UPDATE items SET price = price * 1.01 + 0.5, grp = (grp + 1) * "
+           "2 WHERE id > " +
+           std::to_string(static_cast<long long>(low) - 1) + " AND id < " +
+           std::to_string(low + RANGE_ROWS) + ";\n";
+  }
+
+  // The i-th of `count` deletes, each of a different row; `count` is at
+  // most the number of rows
+  std::string deleteRow(size_t i, size_t count) {
+    size_t step = std::max<size_t>(1, rows / std::max<size_t>(1, count));
+    size_t id = (i * step + random() % step) % std::max<size_t>(1, rows);
+    return "DELETE FROM items WHERE id = " + std::to_string(id) + ";\n";
+  }
+
+  // Joins keeping about one row in QUANTITIES or TAGS
+  std::string join2() {
+    return "SELECT items.id, orders.qty FROM items INNER JOIN orders ON "
+           "items.id = orders.item_id WHERE orders.qty < 1;\n";
+  }
+
+  std::string join3() {
+    return "SELECT items.name, orders.qty, notes.tag FROM items INNER JOIN "
+           "orders ON items.id = orders.item_id INNER JOIN notes ON "
+           "orders.id = notes.order_id WHERE notes.tag = '" +
+           tag() + "';\n";
+  }
+
+private:
+  size_t rows;
+  std::mt19937_64 random;
+
+  size_t anyId() { return rows == 0 ? 0 : random() % rows; }
+
+  size_t rangeStart() {
+    return rows <= RANGE_ROWS ? 0 : random() % (rows - RANGE_ROWS);
+  }
+
+  std::string price() {
+    uint64_t whole = random() % 100000 / 100;
+    uint64_t cents = 10 + random() % 90;
+    return std::to_string(whole) + "." + std::to_string(cents);
+  }
+
+  int quantity() { return static_cast<int>(random() % QUANTITIES); }
+
+  std::string tag() { return "t" + std::to_string(random() % TAGS); }
+};
@@ -0,0 +1,86 @@
+#pragma once
+#include "utils.hpp"
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string_view>
+#include <vector>
+
+// Hashes shared by Bloom filters and their probes. Equal values must hash
+// equally, so -0.0 is hashed as 0.0.
+inline uint64_t mixHash(uint64_t x) {
+  x ^= x >> 30;
+  x *= 0xbf58476d1ce4e5b9ULL;
+  x ^= x >> 27;
+  x *= 0x94d049bb133111ebULL;
+  return x ^ (x >> 31);
+}
+
+inline uint64_t hashValue(int value) {
+  return mixHash(static_cast<uint64_t>(static_cast<int64_t>(value)));
+}
+
+inline uint64_t hashValue(double value) {
+  if (value == 0) {
+    value = 0;
+  }
+  uint64_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  return mixHash(bits);
+}
+
+inline uint64_t hashValue(std::string_view value) {
+  return mixHash(std::hash<std::string_view>{}(value));
+}
+
+inline uint64_t hashValue(const Value &value) {
+  switch (value.getKind()) {
+  case Value::Kind::INTEGER:
+    return hashValue(value.asInt());
+  case Value::Kind::FLOAT:
+    return hashValue(value.asFloat());
+  default:
+    return hashValue(value.asText());
+  }
+}
+
+// A blocked Bloom filter: each key sets three bits within a single 64-bit
+// word, so adding or probing touches one cache line. At eight bits per key
+// about one probe in twenty for an absent key comes back positive.
+class BloomFilter {
+public:
+  static constexpr size_t BITS_PER_KEY = 8;
+
+  BloomFilter() = default;
+
+  explicit BloomFilter(size_t expected_keys) {
+    size_t words = 1;
+    while (words * 64 < expected_keys * BITS_PER_KEY) {
+      words *= 2;
+    }
+    bits.assign(words, 0);
+  }
+
+  // A default constructed filter holds nothing and is never consulted
+  bool isEmpty() const { return bits.empty(); }
+
+  void add(uint64_t hash) { bits[word(hash)] |= mask(hash); }
+
+  bool mayContain(uint64_t hash) const {
+    uint64_t m = mask(hash);
+    return (bits[word(hash)] & m) == m;
+  }
+
+  size_t memoryBytes() const { return bits.capacity() * sizeof(uint64_t); }
+
+private:
+  std::vector<uint64_t> bits;
+
+  size_t word(uint64_t hash) const { return hash & (bits.size() - 1); }
+
+  // Three bit positions from the high bits, which word() does not use
+  static uint64_t mask(uint64_t hash) {
+    return uint64_t(1) << (hash >> 58) | uint64_t(1) << ((hash >> 52) & 63) |
+           uint64_t(1) << ((hash >> 46) & 63);
+  }
+};
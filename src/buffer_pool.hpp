@@ -0,0 +1,225 @@
+#pragma once
+#include "page_io.hpp"
+#include "utils.hpp"
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Keeps the resident pages of all tables within a memory budget. A page is
+// whatever its owner makes resident as a unit (one block of one column);
+// the pool only tracks its size, pin count and reference bit, and asks the
+// owner to evict it when the budget is exceeded. Victims are chosen with
+// the CLOCK algorithm, skipping pinned pages.
+//
+// Memory statements reserve for their intermediate state counts against
+// the same budget, so pages are evicted to make room for it.
+//
+// Owners write dirty pages to the pool's spill file before evicting them,
+// and read evicted pages back from the spill file or from the file they
+// were loaded from, both kept open by the pool. They discard spilled
+// copies they replace or drop, so the spill file reuses their space. Sequential passes over
+// evicted pages ask for them ahead of time with prefetch().
+//
+// Tables used by several sessions at once share the pool. Its operations
+// hold a recursive latch, which owners also take around checking and
+// changing their pages (see latch()); evictPage() runs under it. Reading a
+// page back is done without the latch: the owner admits the page as
+// loading, reads it, then publishes it, and others wanting the page wait
+// for that in waitLoaded().
+class BufferPool {
+public:
+  static constexpr size_t NO_FRAME = SIZE_MAX;
+  static constexpr size_t UNLIMITED = SIZE_MAX;
+  static constexpr size_t DEFAULT_WORK_MEMORY = 64 << 20;
+
+  // Implemented by whatever owns pages
+  class Owner {
+  public:
+    // Bytes held by a resident page
+    virtual size_t pageBytes(size_t page) const = 0;
+    // Write the page out if dirty and free it; it must not be used again
+    // until made resident through admit()
+    virtual void evictPage(size_t page) = 0;
+
+  protected:
+    ~Owner() = default;
+  };
+
+  explicit BufferPool(size_t budget = UNLIMITED) : budget(budget) {}
+
+  BufferPool(const BufferPool &) = delete;
+  BufferPool &operator=(const BufferPool &) = delete;
+
+  size_t getBudget() const { return budget; }
+  void setBudget(size_t new_budget) {
+    std::lock_guard<std::recursive_mutex> guard(mutex);
+    budget = new_budget;
+  }
+  // Resident pages plus memory reserved by statements
+  size_t memoryBytes() const {
+    std::lock_guard<std::recursive_mutex> guard(mutex);
+    return used;
+  }
+
+  // Held by owners while they look up or change which of their pages are
+  // resident, so no page is evicted in between
+  std::recursive_mutex &latch() const { return mutex; }
+
+  // Memory a join may hold outside the pool before it spills to temporary
+  // files
+  size_t getWorkMemory() const { return work_memory; }
+  void setWorkMemory(size_t bytes) { work_memory = bytes; }
+
+  const std::string &getTempDirectory() const {
+    return io.getTempDirectory();
+  }
+  void setTempDirectory(const std::string &dir) { io.setTempDirectory(dir); }
+
+  // Whether page I/O may go through io_uring (see PageIO)
+  void setIoUring(bool enabled) { io.setIoUring(enabled); }
+
+  // Start tracking a page its owner just made resident, or with `loading`
+  // is about to read back. The page is pinned once; its size is measured
+  // when unpinned.
+  size_t admit(Owner *owner, size_t page, bool loading = false) {
+    std::lock_guard<std::recursive_mutex> guard(mutex);
+    size_t frame;
+    if (!free_frames.empty()) {
+      frame = free_frames.back();
+      free_frames.pop_back();
+    } else {
+      frame = frames.size();
+      frames.emplace_back();
+    }
+    frames[frame] = {owner, page, 0, 1, true, loading};
+    return frame;
+  }
+
+  bool isLoading(size_t frame) const {
+    std::lock_guard<std::recursive_mutex> guard(mutex);
+    return frames[frame].loading;
+  }
+
+  // Wait for a page being loaded to be published or released. `lock` must
+  // hold the latch, and only once.
+  void waitLoaded(std::unique_lock<std::recursive_mutex> &lock) {
+    loaded.wait(lock);
+  }
+
+  // The loading page is now resident
+  void publish(size_t frame) {
+    std::lock_guard<std::recursive_mutex> guard(mutex);
+    frames[frame].loading = false;
+    loaded.notify_all();
+  }
+
+  void pin(size_t frame) {
+    std::lock_guard<std::recursive_mutex> guard(mutex);
+    frames[frame].pins++;
+    frames[frame].referenced = true;
+  }
+
+  // The page may be evicted from here on, possibly right away
+  void unpin(size_t frame) {
+    std::lock_guard<std::recursive_mutex> guard(mutex);
+    Frame &f = frames[frame];
+    f.pins--;
+    size_t bytes = f.owner->pageBytes(f.page);
+    used = used - f.bytes + bytes;
+    f.bytes = bytes;
+    if (used > std::max(budget, working_set)) {
+      evict();
+    }
+  }
+
+  // Stop tracking a page its owner dropped
+  void release(size_t frame) {
+    std::lock_guard<std::recursive_mutex> guard(mutex);
+    used -= frames[frame].bytes;
+    if (frames[frame].loading) {
+      loaded.notify_all();
+    }
+    frames[frame] = Frame();
+    free_frames.push_back(frame);
+  }
+
+  // Claim memory outside the pool, evicting unpinned pages to make room.
+  // False if the budget cannot cover it.
+  bool reserve(size_t bytes) {
+    std::lock_guard<std::recursive_mutex> guard(mutex);
+    used += bytes;
+    if (used > budget) {
+      // Twice around, so recently used pages go too
+      evict(2);
+    }
+    if (used > budget) {
+      used -= bytes;
+      return false;
+    }
+    return true;
+  }
+
+  void unreserve(size_t bytes) {
+    std::lock_guard<std::recursive_mutex> guard(mutex);
+    used -= bytes;
+  }
+
+  int openFile(const std::string &path) { return io.openFile(path); }
+  PageLocation spill(std::string data) { return io.spill(std::move(data)); }
+  void discard(const PageLocation &location) { io.discard(location); }
+  uint64_t spillBytes() { return io.spillBytes(); }
+  void prefetch(const PageLocation &location) { io.prefetch(location); }
+  std::string read(const PageLocation &location) { return io.read(location); }
+
+private:
+  struct Frame {
+    Owner *owner = nullptr; // Null while the frame is free
+    size_t page = 0;
+    size_t bytes = 0;
+    size_t pins = 0;
+    bool referenced = false; // Cleared as the clock hand passes
+    bool loading = false;    // Read back by its owner, not published yet
+  };
+
+  mutable std::recursive_mutex mutex;
+  std::condition_variable_any loaded; // A loading page was published
+  size_t budget;
+  size_t work_memory = DEFAULT_WORK_MEMORY;
+  size_t used = 0;
+  std::vector<Frame> frames;
+  std::vector<size_t> free_frames;
+  size_t hand = 0;
+  size_t working_set = 0; // Bytes left after the last eviction fell short
+
+  PageIO io;
+
+  // Advance the clock hand until the budget is met, at most `rotations`
+  // times around. Pages used since the hand last passed are spared on the
+  // first round, so a working set larger than the budget goes over it
+  // instead of thrashing.
+  void evict(size_t rotations = 1) {
+    for (size_t step = 0; used > budget && step < rotations * frames.size();
+         step++) {
+      if (hand >= frames.size()) {
+        hand = 0;
+      }
+      size_t frame = hand++;
+      Frame &f = frames[frame];
+      if (!f.owner || f.pins > 0) {
+        continue;
+      }
+      if (f.referenced) {
+        f.referenced = false;
+        continue;
+      }
+      f.owner->evictPage(f.page);
+      release(frame);
+    }
+    // Whatever is left is in use; go around again once more is
+    working_set = used > budget ? used : 0;
+  }
+};
@@ -0,0 +1,866 @@
+#pragma once
+#include "bloom.hpp"
+#include "buffer_pool.hpp"
+#include "compression.hpp"
+#include "utils.hpp"
+#include <cmath>
+#include <cstdint>
+#include <istream>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// Summary of the values of one column within a block, used to skip blocks
+// that cannot match a condition. Updates only widen the bounds, so they may
+// be loose until the next compact().
+struct ZoneMap {
+  size_t count = 0;     // Rows in the block
+  Value min;            // Only meaningful while count > 0 and bounded;
+  Value max;            // INTEGER and FLOAT
+  std::string min_text; // TEXT bounds, owned since the block's own bytes
+  std::string max_text; // may be evicted
+  bool bounded = true;  // Cleared by values without an ordering (NaN)
+};
+
+// Storage for the values of one table column. Rows are grouped into blocks
+// of BLOCK_SIZE rows, each with a zone map and, unless the column is
+// dictionary-encoded, a Bloom filter of its values. INTEGER and FLOAT
+// blocks are compressed with the cheapest encoding from compression.hpp
+// once they are full, and again at load and checkpoint time if modified
+// since.
+//
+// TEXT columns start out dictionary-encoded: each row holds a 32-bit code
+// into a per-column dictionary of distinct strings, so low-cardinality text
+// costs four bytes per row and compares as an integer. Once a column turns
+// out to have too many distinct values it falls back to storing the strings
+// directly, each block in an arena of its own. The TEXT values the column
+// hands out refer to the dictionary or block bytes.
+//
+// Each block is a page of the buffer pool. Zone maps, Bloom filters and the
+// dictionary stay resident; the values of a block may be evicted whenever
+// it is not pinned, so callers pin a block around reading its rows. Any
+// number of threads may read a column at once, pinning blocks as they go;
+// changing it needs the column to itself.
+class Column : public BufferPool::Owner {
+public:
+  static constexpr uint32_t NO_CODE = UINT32_MAX;
+  static constexpr size_t BLOCK_SIZE = 2048;
+  // Blocks read ahead of a pass over them in order
+  static constexpr size_t READ_AHEAD = 8;
+
+  Column(TokenType type, BufferPool &pool) : type(type), pool(&pool) {}
+  ~Column() { dropBlocksFrom(0); }
+
+  // Blocks are registered with the pool by address
+  Column(const Column &) = delete;
+  Column &operator=(const Column &) = delete;
+
+  TokenType getType() const { return type; }
+  size_t size() const { return count; }
+
+  bool isNumeric() const {
+    return type == TokenType::INTEGER || type == TokenType::FLOAT;
+  }
+
+  // Make block b resident, reading it back if it was evicted, and keep it
+  // so until the matching unpin(). Paging changes no logical state, so
+  // const columns may do it. The block is read back without the pool
+  // latch, so other pages stay usable meanwhile; readers of the same block
+  // wait for the one reading it, so it is read back only once.
+  void pin(size_t b) const {
+    std::unique_lock<std::recursive_mutex> lock(pool->latch());
+    ColumnBlock &page = blocks[b];
+    while (page.frame != BufferPool::NO_FRAME &&
+           pool->isLoading(page.frame)) {
+      pool->waitLoaded(lock);
+    }
+    if (page.frame != BufferPool::NO_FRAME) {
+      pool->pin(page.frame);
+      return;
+    }
+    size_t frame = pool->admit(const_cast<Column *>(this), b, true);
+    page.frame = frame;
+    PageLocation location = page.location;
+    lock.unlock();
+    try {
+      std::istringstream in(pool->read(location));
+      readBlockValues(page, in, blockRows(b));
+    } catch (...) {
+      lock.lock();
+      clearValues(page);
+      pool->release(frame);
+      throw;
+    }
+    pool->publish(frame);
+  }
+
+  void unpin(size_t b) const { pool->unpin(blocks[b].frame); }
+
+  // Start reading block b back in the background if it was evicted
+  void prefetch(size_t b) const {
+    std::lock_guard<std::recursive_mutex> guard(pool->latch());
+    if (b < blocks.size() && blocks[b].frame == BufferPool::NO_FRAME) {
+      pool->prefetch(blocks[b].location);
+    }
+  }
+
+  // pin() for passes over the blocks in order, reading ahead of them
+  void pinInOrder(size_t b) const {
+    if (b == 0) {
+      for (size_t ahead = 1; ahead < READ_AHEAD; ahead++) {
+        prefetch(ahead);
+      }
+    }
+    prefetch(b + READ_AHEAD);
+    pin(b);
+  }
+
+  size_t pageBytes(size_t b) const override {
+    const ColumnBlock &page = blocks[b];
+    return page.numbers.memoryBytes() +
+           page.codes.capacity() * sizeof(uint32_t) +
+           page.strings.capacity() * sizeof(std::string_view) +
+           page.bytes.memoryBytes();
+  }
+
+  void evictPage(size_t b) override {
+    ColumnBlock &page = blocks[b];
+    if (page.dirty) {
+      std::ostringstream out;
+      writeBlockValues(out, page);
+      pool->discard(page.location);
+      page.location = pool->spill(out.str());
+      page.dirty = false;
+    }
+    clearValues(page);
+  }
+
+  // The row accessors below need the row's block to be pinned
+
+  // Block holding rows [b * BLOCK_SIZE, (b + 1) * BLOCK_SIZE), INTEGER and
+  // FLOAT columns only
+  const NumericBlock &block(size_t b) const { return blocks[b].numbers; }
+
+  const ZoneMap &zone(size_t b) const { return zones[b]; }
+
+  // False only if no row of block b can hold a value with this hash
+  bool blockMayContain(size_t b, uint64_t hash) const {
+    return b >= filters.size() || filters[b].mayContain(hash);
+  }
+
+  uint64_t hashRow(size_t row) const {
+    switch (type) {
+    case TokenType::INTEGER:
+      return hashValue(getInt(row));
+    case TokenType::FLOAT:
+      return hashValue(getFloat(row));
+    default:
+      return hashValue(getText(row));
+    }
+  }
+
+  bool isDictionaryEncoded() const {
+    return type == TokenType::TEXT && dictionary_encoded;
+  }
+
+  // The value must already match the column type. TEXT is copied into the
+  // column, so the value's own bytes need not outlive the call.
+  void append(const Value &value) {
+    if (count % BLOCK_SIZE == 0) {
+      std::lock_guard<std::recursive_mutex> guard(pool->latch());
+      blocks.emplace_back(type == TokenType::FLOAT);
+      blocks.back().frame = pool->admit(this, blocks.size() - 1);
+      zones.emplace_back();
+    } else {
+      pin(blocks.size() - 1);
+    }
+    size_t b = blocks.size() - 1;
+    ColumnBlock &page = blocks[b];
+    Value stored = value;
+    switch (type) {
+    case TokenType::INTEGER:
+      page.numbers.appendInt(value.asInt());
+      break;
+    case TokenType::FLOAT:
+      page.numbers.appendDouble(value.asFloat());
+      break;
+    default:
+      if (dictionary_encoded) {
+        page.codes.push_back(encode(value.asText()));
+        stored = Value(dictionary[page.codes.back()]);
+      } else {
+        page.strings.push_back(page.bytes.store(value.asText()));
+        stored = Value(page.strings.back());
+      }
+      break;
+    }
+    page.dirty = true;
+    widenZone(zones[b], stored);
+    zones[b].count++;
+    count++;
+    if (!isDictionaryEncoded()) {
+      if (filters.size() < zones.size()) {
+        filters.emplace_back(BLOCK_SIZE);
+      }
+      filters[b].add(hashValue(value));
+    }
+    // Compress the block once it is full
+    if (isNumeric() && page.numbers.size() == BLOCK_SIZE) {
+      page.numbers.compress();
+    }
+    unpin(b);
+  }
+
+  // The bytes of a replaced string stay in the block's arena until
+  // compact() or eviction
+  void set(size_t row, const Value &value) {
+    size_t b = row / BLOCK_SIZE, i = row % BLOCK_SIZE;
+    pin(b);
+    ColumnBlock &page = blocks[b];
+    Value stored = value;
+    switch (type) {
+    case TokenType::INTEGER:
+      page.numbers.setInt(i, value.asInt());
+      break;
+    case TokenType::FLOAT:
+      page.numbers.setDouble(i, value.asFloat());
+      break;
+    default:
+      if (dictionary_encoded) {
+        page.codes[i] = encode(value.asText());
+        stored = Value(dictionary[page.codes[i]]);
+      } else {
+        page.strings[i] = page.bytes.store(value.asText());
+        stored = Value(page.strings[i]);
+      }
+      break;
+    }
+    page.dirty = true;
+    widenZone(zones[b], stored);
+    if (!isDictionaryEncoded()) {
+      filters[b].add(hashValue(value));
+    }
+    unpin(b);
+  }
+
+  // Switch a dictionary that grew too large to plain strings, block by
+  // block. Run after appending or setting values, at a point where no
+  // reader relies on the column's encoding. The strings still refer to
+  // the dictionary bytes in the heap, which are kept until the next
+  // compact().
+  void maybeDropDictionary() {
+    if (!isDictionaryEncoded() ||
+        (dictionary.size() <= MAX_DICTIONARY_SIZE &&
+         (count < MIN_ROWS_FOR_RATIO || dictionary.size() * 2 <= count))) {
+      return;
+    }
+    filters.assign(blocks.size(), BloomFilter(BLOCK_SIZE));
+    for (size_t b = 0; b < blocks.size(); b++) {
+      pinInOrder(b);
+      ColumnBlock &page = blocks[b];
+      page.strings.reserve(page.codes.size());
+      for (uint32_t code : page.codes) {
+        page.strings.push_back(dictionary[code]);
+        filters[b].add(hashValue(page.strings.back()));
+      }
+      page.codes = std::vector<uint32_t>();
+      page.dirty = true;
+      unpin(b);
+    }
+    dictionary_index.clear();
+    dictionary.clear();
+    dictionary_encoded = false;
+  }
+
+  int getInt(size_t row) const {
+    return blocks[row / BLOCK_SIZE].numbers.getInt(row % BLOCK_SIZE);
+  }
+  double getFloat(size_t row) const {
+    return blocks[row / BLOCK_SIZE].numbers.getDouble(row % BLOCK_SIZE);
+  }
+  std::string_view getText(size_t row) const {
+    const ColumnBlock &page = blocks[row / BLOCK_SIZE];
+    return dictionary_encoded ? dictionary[page.codes[row % BLOCK_SIZE]]
+                              : page.strings[row % BLOCK_SIZE];
+  }
+
+  Value get(size_t row) const {
+    Value value;
+    load(row, value);
+    return value;
+  }
+
+  // Load a value into an existing slot; TEXT refers to the column's bytes
+  void load(size_t row, Value &slot) const {
+    switch (type) {
+    case TokenType::INTEGER:
+      slot = getInt(row);
+      break;
+    case TokenType::FLOAT:
+      slot = getFloat(row);
+      break;
+    default:
+      slot = Value(getText(row));
+      break;
+    }
+  }
+
+  // Dictionary access, only valid while isDictionaryEncoded()
+  uint32_t getCode(size_t row) const {
+    return blocks[row / BLOCK_SIZE].codes[row % BLOCK_SIZE];
+  }
+  size_t dictionarySize() const { return dictionary.size(); }
+  std::string_view dictionaryValue(uint32_t code) const {
+    return dictionary[code];
+  }
+  uint32_t lookupCode(std::string_view text) const {
+    auto it = dictionary_index.find(text);
+    return it == dictionary_index.end() ? NO_CODE : it->second;
+  }
+
+  // Keep only the rows whose flag is set, preserving their order. Rows only
+  // move towards the front, so the blocks are refilled in place: block t
+  // is replaced once it has collected its rows, by which point every row it
+  // held before has been read.
+  void retain(const std::vector<bool> &keep) {
+    ColumnBlock target(type == TokenType::FLOAT);
+    size_t kept = 0, filled = 0;
+    for (size_t b = 0; b < blocks.size(); b++) {
+      pinInOrder(b);
+      for (size_t i = 0, rows = blockRows(b); i < rows; i++) {
+        if (!keep[b * BLOCK_SIZE + i]) {
+          continue;
+        }
+        copyRow(blocks[b], i, target);
+        if (++kept % BLOCK_SIZE == 0) {
+          replaceBlock(filled++, target);
+        }
+      }
+      unpin(b);
+    }
+    if (kept % BLOCK_SIZE != 0) {
+      replaceBlock(filled++, target);
+    }
+    dropBlocksFrom(filled);
+    count = kept;
+    rebuildZones();
+  }
+
+  // Compress numeric blocks that are PLAIN because they were modified or
+  // are not yet full, tighten the zone maps, and rebuild TEXT storage so
+  // the dictionary only holds strings still in use and the choice between
+  // dictionary and plain strings fits the current data
+  void compact() {
+    if (isNumeric()) {
+      for (size_t b = 0; b < blocks.size(); b++) {
+        pinInOrder(b);
+        blocks[b].numbers.compress();
+        unpin(b);
+      }
+      rebuildZones();
+      return;
+    }
+
+    // Collect the strings still in use, in order of first use
+    Arena used_heap;
+    std::vector<std::string_view> used;
+    std::unordered_map<std::string_view, uint32_t> used_index;
+    bool use_dictionary = true;
+    for (size_t b = 0; b < blocks.size() && use_dictionary; b++) {
+      pinInOrder(b);
+      for (size_t row = b * BLOCK_SIZE, end = row + blockRows(b); row < end;
+           row++) {
+        std::string_view text = getText(row);
+        if (used_index.count(text)) {
+          continue;
+        }
+        if (used.size() == MAX_DICTIONARY_SIZE) {
+          use_dictionary = false;
+          break;
+        }
+        used.push_back(used_heap.store(text));
+        used_index.emplace(used.back(), static_cast<uint32_t>(used.size() - 1));
+      }
+      unpin(b);
+    }
+    use_dictionary = use_dictionary && (count < MIN_ROWS_FOR_RATIO ||
+                                        used.size() * 2 <= count);
+
+    // Rewrite each block in the chosen form. Blocks whose contents do not
+    // change stay clean.
+    for (size_t b = 0; b < blocks.size(); b++) {
+      pinInOrder(b);
+      ColumnBlock &page = blocks[b];
+      size_t begin = b * BLOCK_SIZE, rows = blockRows(b);
+      if (use_dictionary) {
+        std::vector<uint32_t> codes(rows);
+        for (size_t i = 0; i < rows; i++) {
+          codes[i] = used_index.find(getText(begin + i))->second;
+        }
+        if (codes != page.codes) {
+          page.codes = std::move(codes);
+          page.strings = std::vector<std::string_view>();
+          page.bytes.clear();
+          page.dirty = true;
+        }
+      } else {
+        std::vector<std::string_view> strings;
+        strings.reserve(rows);
+        Arena bytes(PAGE_CHUNK_SIZE);
+        for (size_t i = 0; i < rows; i++) {
+          strings.push_back(bytes.store(getText(begin + i)));
+        }
+        page.dirty = page.dirty || !page.codes.empty();
+        page.codes = std::vector<uint32_t>();
+        page.strings = std::move(strings);
+        page.bytes = std::move(bytes);
+      }
+      unpin(b);
+    }
+
+    dictionary_encoded = use_dictionary;
+    if (use_dictionary) {
+      dictionary = std::move(used);
+      dictionary_index = std::move(used_index);
+      heap = std::move(used_heap);
+    } else {
+      dictionary.clear();
+      dictionary_index.clear();
+      heap.clear();
+    }
+    rebuildZones();
+  }
+
+  // Write one block of rows in the .db text format (see Table::serialize),
+  // starting with its zone map as ZONE <min> <max>. Blocks are written in
+  // order, so the ones after it are read ahead. Dictionary codes are
+  // written through an INTEGER block, so they get the same compression as
+  // any other integers.
+  void writeBlock(std::ostream &out, size_t b) const {
+    const ZoneMap &block_zone = zones[b];
+    if (block_zone.bounded) {
+      out << "ZONE ";
+      if (isNumeric()) {
+        writeNumber(out, block_zone.min);
+        out << ' ';
+        writeNumber(out, block_zone.max);
+      } else {
+        out << '"' << block_zone.min_text << "\" \"" << block_zone.max_text
+            << '"';
+      }
+      out << ' ';
+    }
+    pinInOrder(b);
+    writeBlockValues(out, blocks[b]);
+    unpin(b);
+  }
+
+  // A block read ahead of appending it, defined with the blocks below
+  struct LoadedBlock;
+
+  // Read a block written by writeBlock, for addBlock() to append. A TEXT
+  // column stays dictionary-encoded only if a dictionary was read first.
+  // If the line can be read again from `location`, the block starts out
+  // clean and is evicted without being written. Reading only consults the
+  // dictionary, so any number of threads may read blocks of the column at
+  // once.
+  LoadedBlock readBlock(std::istream &in, size_t rows,
+                        PageLocation location = {}) const {
+    LoadedBlock block(type == TokenType::FLOAT);
+    block.zone.count = rows;
+    bool has_zone = (in >> std::ws).peek() == 'Z';
+    if (has_zone) {
+      std::string tag;
+      in >> tag;
+      if (isNumeric()) {
+        block.zone.min = readNumber(in);
+        block.zone.max = readNumber(in);
+      } else {
+        block.zone.min_text = readQuoted(in);
+        block.zone.max_text = readQuoted(in);
+      }
+    }
+    if (location.file != PageLocation::NO_FILE) {
+      // Point past the zone map, at the values themselves
+      auto values_at = static_cast<uint64_t>(in.tellg());
+      block.page.location = {location.file, location.offset + values_at,
+                             location.length - values_at};
+      block.page.dirty = false;
+    }
+    readBlockValues(block.page, in, rows);
+    if (!has_zone) {
+      block.zone = pageZone(block.page, rows);
+    }
+    if (!isDictionaryEncoded()) {
+      block.filter = pageFilter(block.page, rows);
+    }
+    return block;
+  }
+
+  // Append the rows of a block from readBlock(), in the order written
+  void addBlock(LoadedBlock block) {
+    if (count % BLOCK_SIZE != 0) {
+      throw TableError("Only the last block may be partial");
+    }
+    size_t rows = block.zone.count;
+    std::unique_lock<std::recursive_mutex> guard(pool->latch());
+    size_t b = blocks.size();
+    blocks.push_back(std::move(block.page));
+    blocks[b].frame = pool->admit(this, b);
+    guard.unlock();
+    count += rows;
+    zones.push_back(std::move(block.zone));
+    if (!isDictionaryEncoded()) {
+      filters.resize(b + 1);
+      filters[b] = std::move(block.filter);
+    }
+    unpin(b);
+  }
+
+  // Dictionary line of a TEXT column: DICTIONARY <size> "value"... when
+  // dictionary-encoded, PLAIN otherwise
+  void writeDictionary(std::ostream &out) const {
+    if (!dictionary_encoded) {
+      out << "PLAIN";
+      return;
+    }
+    out << "DICTIONARY " << dictionary.size();
+    for (const auto &value : dictionary) {
+      out << " \"" << value << '"';
+    }
+  }
+
+  void readDictionary(std::istream &in) {
+    std::string tag;
+    in >> tag;
+    clear();
+    if (tag == "PLAIN") {
+      dictionary_encoded = false;
+      return;
+    }
+    size_t entries = 0;
+    if (tag != "DICTIONARY" || !(in >> entries)) {
+      throw TableError("Invalid dictionary");
+    }
+    for (size_t i = 0; i < entries; i++) {
+      encode(readQuoted(in));
+    }
+  }
+
+  void clear() {
+    dropBlocksFrom(0);
+    count = 0;
+    zones.clear();
+    filters.clear();
+    dictionary.clear();
+    dictionary_index.clear();
+    dictionary_encoded = true;
+    heap.clear();
+  }
+
+private:
+  // A dictionary is kept while it stays small in absolute terms and
+  // relative to the number of rows
+  static constexpr size_t MAX_DICTIONARY_SIZE = 1 << 16;
+  static constexpr size_t MIN_ROWS_FOR_RATIO = 1024;
+
+  // Block arenas only hold up to BLOCK_SIZE strings
+  static constexpr size_t PAGE_CHUNK_SIZE = 16 * 1024;
+
+  // The values of one block: the unit paged in and out by the buffer pool
+  struct ColumnBlock {
+    explicit ColumnBlock(bool is_float) : numbers(is_float) {}
+
+    NumericBlock numbers;                  // INTEGER and FLOAT
+    std::vector<uint32_t> codes;           // Dictionary-encoded TEXT
+    std::vector<std::string_view> strings; // Plain TEXT
+    Arena bytes{PAGE_CHUNK_SIZE};          // Bytes of `strings`
+    size_t frame = BufferPool::NO_FRAME;   // NO_FRAME while evicted
+    PageLocation location;                 // Last copy written out
+    bool dirty = true;                     // Changed since that copy
+  };
+
+public:
+  struct LoadedBlock {
+    explicit LoadedBlock(bool is_float) : page(is_float) {}
+
+    ColumnBlock page;
+    ZoneMap zone;
+    BloomFilter filter; // Unless dictionary-encoded
+  };
+
+private:
+
+  TokenType type;
+  BufferPool *pool;
+  size_t count = 0;
+
+  // Every block but the last holds BLOCK_SIZE rows
+  mutable std::vector<ColumnBlock> blocks;
+
+  std::vector<ZoneMap> zones; // One per block, for every column type
+
+  // One per block unless dictionary-encoded, where comparing codes is cheap
+  // enough and a string missing from the dictionary already rules out every
+  // block. Filters are rebuilt, not written, on checkpoint and load.
+  std::vector<BloomFilter> filters;
+
+  // TEXT dictionary, with the bytes of its strings in the heap
+  bool dictionary_encoded = true;
+  Arena heap;
+  std::vector<std::string_view> dictionary;
+  std::unordered_map<std::string_view, uint32_t> dictionary_index;
+
+  size_t blockRows(size_t b) const {
+    return std::min(BLOCK_SIZE, count - b * BLOCK_SIZE);
+  }
+
+  // Values only, in the form writeBlock uses after the zone map. The tag
+  // of a TEXT block follows its contents rather than the column's mode, as
+  // blocks are written out while compact() switches modes.
+  void writeBlockValues(std::ostream &out, const ColumnBlock &page) const {
+    if (isNumeric()) {
+      page.numbers.write(out);
+      return;
+    }
+    if (!page.codes.empty()) {
+      NumericBlock packed_codes(false);
+      for (uint32_t code : page.codes) {
+        packed_codes.appendInt(static_cast<int>(code));
+      }
+      packed_codes.compress();
+      out << "CODES ";
+      packed_codes.write(out);
+    } else {
+      out << "STRINGS";
+      for (const auto &value : page.strings) {
+        out << " \"" << value << '"';
+      }
+    }
+  }
+
+  void readBlockValues(ColumnBlock &page, std::istream &in,
+                       size_t rows) const {
+    if (isNumeric()) {
+      page.numbers = NumericBlock::read(in, rows, type == TokenType::FLOAT);
+      return;
+    }
+    std::string tag;
+    in >> tag;
+    if (tag == "CODES" && dictionary_encoded) {
+      NumericBlock packed_codes = NumericBlock::read(in, rows, false);
+      page.codes.reserve(rows);
+      for (size_t i = 0; i < rows; i++) {
+        int code = packed_codes.getInt(i);
+        if (code < 0 || static_cast<size_t>(code) >= dictionary.size()) {
+          throw TableError("Invalid dictionary code");
+        }
+        page.codes.push_back(static_cast<uint32_t>(code));
+      }
+    } else if (tag == "STRINGS") {
+      page.strings.reserve(rows);
+      for (size_t i = 0; i < rows; i++) {
+        page.strings.push_back(page.bytes.store(readQuoted(in)));
+      }
+    } else {
+      throw TableError("Invalid TEXT block");
+    }
+  }
+
+  // Free the values of an evicted block
+  void clearValues(ColumnBlock &page) const {
+    page.numbers = NumericBlock(type == TokenType::FLOAT);
+    page.codes = std::vector<uint32_t>();
+    page.strings = std::vector<std::string_view>();
+    page.bytes.clear();
+    page.frame = BufferPool::NO_FRAME;
+  }
+
+  // Append row i of `source` to `target`
+  void copyRow(const ColumnBlock &source, size_t i, ColumnBlock &target) {
+    switch (type) {
+    case TokenType::INTEGER:
+      target.numbers.appendInt(source.numbers.getInt(i));
+      break;
+    case TokenType::FLOAT:
+      target.numbers.appendDouble(source.numbers.getDouble(i));
+      break;
+    default:
+      if (dictionary_encoded) {
+        target.codes.push_back(source.codes[i]);
+      } else {
+        target.strings.push_back(target.bytes.store(source.strings[i]));
+      }
+      break;
+    }
+  }
+
+  // Give block t the values collected in `target`, leaving it empty
+  void replaceBlock(size_t t, ColumnBlock &target) {
+    ColumnBlock &page = blocks[t];
+    {
+      std::lock_guard<std::recursive_mutex> guard(pool->latch());
+      if (page.frame == BufferPool::NO_FRAME) {
+        page.frame = pool->admit(this, t);
+      } else {
+        pool->pin(page.frame);
+      }
+    }
+    if (target.numbers.size() == BLOCK_SIZE) {
+      target.numbers.compress();
+    }
+    page.numbers = std::move(target.numbers);
+    page.codes = std::move(target.codes);
+    page.strings = std::move(target.strings);
+    page.bytes = std::move(target.bytes);
+    page.dirty = true;
+    target = ColumnBlock(type == TokenType::FLOAT);
+    pool->unpin(page.frame);
+  }
+
+  void dropBlocksFrom(size_t b) {
+    std::lock_guard<std::recursive_mutex> guard(pool->latch());
+    while (blocks.size() > b) {
+      if (blocks.back().frame != BufferPool::NO_FRAME) {
+        pool->release(blocks.back().frame);
+      }
+      pool->discard(blocks.back().location);
+      blocks.pop_back();
+    }
+  }
+
+  static void widenZone(ZoneMap &zone, const Value &value) {
+    if (!zone.bounded) {
+      return;
+    }
+    if (value.isText()) {
+      std::string_view text = value.asText();
+      if (zone.count == 0) {
+        zone.min_text = zone.max_text = text;
+      } else if (text < zone.min_text) {
+        zone.min_text = text;
+      } else if (zone.max_text < text) {
+        zone.max_text = text;
+      }
+    } else if (value.isFloat() && std::isnan(value.asFloat())) {
+      zone.bounded = false;
+    } else if (zone.count == 0) {
+      zone.min = zone.max = value;
+    } else if (value < zone.min) {
+      zone.min = value;
+    } else if (zone.max < value) {
+      zone.max = value;
+    }
+  }
+
+  // These need block b to be pinned
+  void rebuildZone(size_t b) { zones[b] = pageZone(blocks[b], blockRows(b)); }
+
+  void rebuildFilter(size_t b) {
+    if (isDictionaryEncoded()) {
+      return;
+    }
+    filters.resize(std::max(filters.size(), b + 1));
+    filters[b] = pageFilter(blocks[b], blockRows(b));
+  }
+
+  // Row i of a block, as load() gives it
+  Value pageValue(const ColumnBlock &page, size_t i) const {
+    switch (type) {
+    case TokenType::INTEGER:
+      return page.numbers.getInt(i);
+    case TokenType::FLOAT:
+      return page.numbers.getDouble(i);
+    default:
+      return Value(dictionary_encoded ? dictionary[page.codes[i]]
+                                      : page.strings[i]);
+    }
+  }
+
+  ZoneMap pageZone(const ColumnBlock &page, size_t rows) const {
+    ZoneMap block_zone;
+    for (size_t i = 0; i < rows; i++) {
+      widenZone(block_zone, pageValue(page, i));
+      block_zone.count++;
+    }
+    return block_zone;
+  }
+
+  BloomFilter pageFilter(const ColumnBlock &page, size_t rows) const {
+    BloomFilter filter(BLOCK_SIZE);
+    for (size_t i = 0; i < rows; i++) {
+      switch (type) {
+      case TokenType::INTEGER:
+        filter.add(hashValue(page.numbers.getInt(i)));
+        break;
+      case TokenType::FLOAT:
+        filter.add(hashValue(page.numbers.getDouble(i)));
+        break;
+      default:
+        filter.add(hashValue(std::string_view(
+            dictionary_encoded ? dictionary[page.codes[i]] : page.strings[i])));
+      }
+    }
+    return filter;
+  }
+
+  void rebuildZones() {
+    zones.assign(blocks.size(), ZoneMap());
+    filters.clear();
+    for (size_t b = 0; b < blocks.size(); b++) {
+      pinInOrder(b);
+      rebuildZone(b);
+      rebuildFilter(b);
+      unpin(b);
+    }
+  }
+
+  void writeNumber(std::ostream &out, const Value &value) const {
+    if (type == TokenType::INTEGER) {
+      out << value.asInt();
+    } else {
+      out << NumericBlock::formatDouble(value.asFloat());
+    }
+  }
+
+  Value readNumber(std::istream &in) const {
+    if (type == TokenType::INTEGER) {
+      int value = 0;
+      in >> value;
+      return value;
+    }
+    double value = 0;
+    in >> value;
+    return value;
+  }
+
+  static std::string readQuoted(std::istream &in) {
+    char c;
+    if (!(in >> c) || c != '"') {
+      throw TableError("Expected quoted string");
+    }
+    std::string result;
+    while (in.get(c) && c != '"') {
+      result += c;
+    }
+    if (c != '"' || !in) {
+      throw TableError("Unterminated quoted string");
+    }
+    return result;
+  }
+
+  uint32_t encode(std::string_view text) {
+    auto it = dictionary_index.find(text);
+    if (it != dictionary_index.end()) {
+      return it->second;
+    }
+    uint32_t code = static_cast<uint32_t>(dictionary.size());
+    dictionary.push_back(heap.store(text));
+    dictionary_index.emplace(dictionary.back(), code);
+    return code;
+  }
+};
@@ -0,0 +1,227 @@
+#pragma once
+#include "file_io.hpp"
+#include "utils.hpp"
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Flush a file, or the entries of a directory, to disk. Windows keeps
+// directory entries durable by itself and cannot open a directory as a
+// file, so there only files are flushed.
+inline void syncPath(const std::string &path) {
+#ifdef _WIN32
+  if (std::filesystem::is_directory(path)) {
+    return;
+  }
+  int fd = openForWriting(path);
+#else
+  int fd = openForReading(path);
+#endif
+  if (fd < 0) {
+    throw FileError("Failed to open " + path);
+  }
+  bool synced = syncFile(fd);
+  closeFile(fd);
+  if (!synced) {
+    throw FileError("Failed to sync " + path);
+  }
+}
+
+// The statements that changed a database since its file was last written,
+// so that they survive a crash: loading the database replays them. The
+// statements committed together form a group, replayed as a whole or not
+// at all. Groups are buffered, and written out when one has to be durable
+// with a single fsync covering it and every group before it, so a
+// transaction costs one however many statements it has. A group that
+// fails to be written or synced is cut off again, so it is neither
+// written later nor replayed.
+//
+// A log belongs to one generation of the database file, named in its
+// first line. Writing the file starts the next generation and drops the
+// log; should the process die in between, the log left behind no longer
+// matches the file and is ignored.
+class CommitLog {
+public:
+  // Groups buffered beyond this are written out, though not synced
+  static constexpr size_t MAX_BUFFERED = 1 << 20;
+
+  CommitLog(const std::string &path, uint64_t generation)
+      : path(path), generation(generation) {}
+  ~CommitLog() {
+    if (fd >= 0) {
+      closeFile(fd);
+    }
+  }
+
+  CommitLog(const CommitLog &) = delete;
+  CommitLog &operator=(const CommitLog &) = delete;
+
+  // Add a statement to a group being put together
+  static void addRecord(std::string &group, std::string_view statement) {
+    group += "STATEMENT " + std::to_string(statement.size()) + "\n";
+    group += statement;
+    group += '\n';
+  }
+
+  // Append a group; with `sync` it is on disk when this returns. If that
+  // fails the group is not logged, while the groups before it stay.
+  void commit(const std::string &group, bool sync) {
+    std::lock_guard<std::mutex> guard(lock);
+    if (broken) {
+      throw FileError("Failed to cut a failed commit off " + path);
+    }
+    size_t group_start = buffer.size();
+    buffer += group;
+    buffer += "COMMIT\n";
+    if (!sync && buffer.size() < MAX_BUFFERED) {
+      return;
+    }
+    size_t group_size = buffer.size() - group_start;
+    try {
+      flush();
+    } catch (const FileError &) {
+      buffer.resize(group_start);
+      throw;
+    }
+    if (!sync) {
+      return;
+    }
+    try {
+      if (!syncFile(fd)) {
+        throw FileError("Failed to sync " + path);
+      }
+      if (unsynced_entry) {
+        syncPath(std::filesystem::path(path).parent_path().string());
+        unsynced_entry = false;
+      }
+    } catch (const FileError &) {
+      // The groups before are kept as if written without a sync
+      cutOff(size - group_size);
+      throw;
+    }
+  }
+
+  // Bytes logged so far, written or not
+  uint64_t getSize() const {
+    std::lock_guard<std::mutex> guard(lock);
+    return size + buffer.size();
+  }
+
+  // Whether anything was logged since the database file was written
+  bool exists() const {
+    std::lock_guard<std::mutex> guard(lock);
+    return !buffer.empty() || fd >= 0 || std::filesystem::exists(path);
+  }
+
+  // Drop the log, once the database file of the `next` generation is on
+  // disk
+  void reset(uint64_t next) {
+    std::lock_guard<std::mutex> guard(lock);
+    if (fd >= 0) {
+      closeFile(fd);
+      fd = -1;
+    }
+    buffer.clear();
+    size = 0;
+    broken = false;
+    std::filesystem::remove(path);
+    generation = next;
+  }
+
+  // The statements of the complete groups in the log at `path`, in order.
+  // A group cut short is cut off the file, and a log of another generation
+  // is removed, leaving nothing to replay.
+  static std::vector<std::string> recover(const std::string &path,
+                                          uint64_t generation) {
+    std::vector<std::string> statements;
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+      return statements;
+    }
+    std::string line, word;
+    uint64_t logged = 0;
+    std::getline(in, line);
+    std::istringstream(line) >> word >> logged;
+    if (in.eof() || word != "LOG" || logged != generation) {
+      in.close();
+      std::filesystem::remove(path);
+      return statements;
+    }
+    std::streamoff valid = in.tellg();
+    std::vector<std::string> group;
+    while (std::getline(in, line) && !in.eof()) {
+      if (line == "COMMIT") {
+        statements.insert(statements.end(), group.begin(), group.end());
+        group.clear();
+        valid = in.tellg();
+        continue;
+      }
+      size_t size = 0;
+      std::istringstream(line) >> word >> size;
+      if (word != "STATEMENT") {
+        break;
+      }
+      std::string text(size, '\0');
+      if (!in.read(text.data(), size) || in.get() != '\n') {
+        break;
+      }
+      group.push_back(std::move(text));
+    }
+    in.close();
+    std::filesystem::resize_file(path, valid);
+    return statements;
+  }
+
+private:
+  std::string path;
+  uint64_t generation;
+  mutable std::mutex lock;
+  int fd = -1;        // Opened on the first write
+  uint64_t size = 0;  // Of the file, once opened
+  std::string buffer; // Groups not written yet
+  bool unsynced_entry = false; // The file is new to its directory
+  bool broken = false; // Holds a failed group that could not be cut off
+
+  // Write out the buffered groups, starting the file with its generation.
+  // On failure nothing is written and the groups stay buffered.
+  void flush() {
+    if (fd < 0) {
+      fd = openForWriting(path);
+      int64_t end = fd < 0 ? -1 : fileSize(fd);
+      if (end < 0) {
+        if (fd >= 0) {
+          closeFile(fd);
+          fd = -1;
+        }
+        throw FileError("Failed to open " + path);
+      }
+      size = static_cast<uint64_t>(end);
+    }
+    uint64_t start = size;
+    std::string header;
+    if (size == 0) {
+      header = "LOG " + std::to_string(generation) + "\n";
+      unsynced_entry = true;
+    }
+    if (!writeAt(fd, start, header.data(), header.size()) ||
+        !writeAt(fd, start + header.size(), buffer.data(), buffer.size())) {
+      cutOff(start);
+      throw FileError("Failed to write " + path);
+    }
+    size = start + header.size() + buffer.size();
+    buffer.clear();
+  }
+
+  // Cut the file back to `end`
+  void cutOff(uint64_t end) {
+    if (!truncateFile(fd, end)) {
+      broken = true;
+    }
+    size = end;
+  }
+};
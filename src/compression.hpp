@@ -0,0 +1,553 @@
+#pragma once
+#include "utils.hpp"
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// Lightweight encodings for a block of numeric column values
+enum class BlockEncoding {
+  PLAIN,    // One 64-bit lane per value
+  CONSTANT, // Every value is `base`
+  RLE,      // Runs of equal values
+  FOR,      // Frame of reference: base + bit-packed offset
+  DELTA     // Linear frame of reference: base + step * i + bit-packed offset
+};
+
+// A block of INTEGER or FLOAT values stored as 64-bit lanes. INTEGER lanes
+// are the values themselves. FLOAT lanes are the raw bits of the doubles,
+// or, in a compressed block whose values all round-trip exactly, the values
+// times 10^scale, so decimal data such as prices packs like integers.
+//
+// Blocks are filled as PLAIN and compressed when sealed or checkpointed.
+// Writing to a compressed block turns it back into PLAIN.
+class NumericBlock {
+public:
+  explicit NumericBlock(bool is_float)
+      : is_float(is_float), scale(is_float ? -1 : 0) {}
+
+  size_t size() const { return count; }
+  BlockEncoding getEncoding() const { return encoding; }
+  bool isCompressed() const { return encoding != BlockEncoding::PLAIN; }
+
+  int getInt(size_t i) const { return static_cast<int>(lane(i)); }
+  double getDouble(size_t i) const { return toDouble(lane(i)); }
+
+  void appendInt(int value) { appendLane(value); }
+  void appendDouble(double value) { appendLane(rawBits(value)); }
+
+  void setInt(size_t i, int value) {
+    decompress();
+    plain[i] = value;
+  }
+
+  void setDouble(size_t i, double value) {
+    decompress();
+    plain[i] = rawBits(value);
+  }
+
+  // Pick the smallest encoding for the current values
+  void compress() {
+    if (isCompressed() || count == 0) {
+      return;
+    }
+    std::vector<int64_t> lanes = plain;
+    if (is_float) {
+      scale = decimalScale(lanes);
+    }
+    encode(lanes);
+  }
+
+  // Turn the block back into raw PLAIN lanes
+  void decompress() {
+    if (!isCompressed()) {
+      return;
+    }
+    std::vector<int64_t> lanes(count);
+    for (size_t i = 0; i < count; i++) {
+      lanes[i] = is_float ? rawBits(getDouble(i)) : lane(i);
+    }
+    resetEncoding();
+    plain = std::move(lanes);
+  }
+
+  // Evaluate `value OP literal` for every row of an INTEGER block, working
+  // on the encoded data: once per run for CONSTANT and RLE blocks, and on
+  // the packed offsets of FOR blocks without adding the base back.
+  void compareInt(TokenType op, int literal, uint8_t *matches) const {
+    int64_t target = literal;
+    if (compareRuns(op, matches,
+                    [&](int64_t value) { return order(value, target); })) {
+      return;
+    }
+    if (encoding == BlockEncoding::FOR) {
+      int64_t offset = target - base;
+      for (size_t i = 0; i < count; i++) {
+        matches[i] =
+            compareOrdered(static_cast<int64_t>(unpack(i)), offset, op);
+      }
+      return;
+    }
+    for (size_t i = 0; i < count; i++) {
+      matches[i] = compareOrdered(lane(i), target, op);
+    }
+  }
+
+  // Same for FLOAT blocks. Values are decoded to doubles before comparing,
+  // so the result is exactly that of comparing the stored values.
+  void compareDouble(TokenType op, double literal, uint8_t *matches) const {
+    if (compareRuns(op, matches, [&](int64_t value) {
+          return order(toDouble(value), literal);
+        })) {
+      return;
+    }
+    for (size_t i = 0; i < count; i++) {
+      matches[i] = compareOrdered(getDouble(i), literal, op);
+    }
+  }
+
+  // Bytes used by the values of this block
+  size_t memoryBytes() const {
+    return plain.capacity() * sizeof(int64_t) +
+           packed.capacity() * sizeof(uint64_t) +
+           run_values.capacity() * sizeof(int64_t) +
+           run_ends.capacity() * sizeof(uint32_t);
+  }
+
+  // Text form used in .db files: an encoding name and its parameters, with
+  // packed offsets as hex. FLOAT blocks are either DEC <scale> followed by an
+  // integer encoding, or PLAIN doubles in their shortest exact form. Scale
+  // -1 is of CONST or RLE lanes holding the doubles' raw bits.
+  void write(std::ostream &out) const {
+    if (is_float && !isCompressed()) {
+      out << "PLAIN";
+      for (size_t i = 0; i < count; i++) {
+        out << ' ' << formatDouble(getDouble(i));
+      }
+      return;
+    }
+    if (is_float) {
+      out << "DEC " << scale << ' ';
+    }
+    switch (encoding) {
+    case BlockEncoding::PLAIN:
+      out << "PLAIN";
+      for (int64_t value : plain) {
+        out << ' ' << value;
+      }
+      break;
+    case BlockEncoding::CONSTANT:
+      out << "CONST " << base;
+      break;
+    case BlockEncoding::RLE:
+      out << "RLE " << run_values.size();
+      for (size_t r = 0; r < run_values.size(); r++) {
+        out << ' ' << run_values[r] << ' ' << run_ends[r] - runStart(r);
+      }
+      break;
+    case BlockEncoding::FOR:
+      out << "FOR " << base << ' ' << width << ' ' << packedHex();
+      break;
+    case BlockEncoding::DELTA:
+      out << "DELTA " << base << ' ' << step << ' ' << width << ' '
+          << packedHex();
+      break;
+    }
+  }
+
+  static NumericBlock read(std::istream &in, size_t count, bool is_float) {
+    NumericBlock block(is_float);
+    block.count = count;
+    std::string tag;
+    in >> tag;
+    if (is_float) {
+      if (tag == "PLAIN") {
+        block.plain.resize(count);
+        for (auto &value : block.plain) {
+          double number;
+          in >> number;
+          value = rawBits(number);
+        }
+        block.checkStream(in);
+        return block;
+      }
+      // Raw bits, scale -1, only come compressed as runs (see encode())
+      if (tag != "DEC" || !(in >> block.scale >> tag) || block.scale < -1 ||
+          block.scale > MAX_SCALE || tag == "PLAIN" ||
+          (block.scale < 0 && tag != "CONST" && tag != "RLE")) {
+        throw TableError("Invalid FLOAT block");
+      }
+    }
+
+    if (tag == "PLAIN") {
+      block.plain.resize(count);
+      for (auto &value : block.plain) {
+        in >> value;
+      }
+    } else if (tag == "CONST") {
+      block.encoding = BlockEncoding::CONSTANT;
+      in >> block.base;
+    } else if (tag == "RLE") {
+      block.encoding = BlockEncoding::RLE;
+      size_t runs = 0;
+      in >> runs;
+      uint32_t end = 0;
+      for (size_t r = 0; r < runs && in; r++) {
+        int64_t value;
+        uint32_t length;
+        in >> value >> length;
+        end += length;
+        block.run_values.push_back(value);
+        block.run_ends.push_back(end);
+      }
+      if (end != count) {
+        throw TableError("Invalid RLE block");
+      }
+    } else if (tag == "FOR" || tag == "DELTA") {
+      block.encoding =
+          tag == "FOR" ? BlockEncoding::FOR : BlockEncoding::DELTA;
+      in >> block.base;
+      if (block.encoding == BlockEncoding::DELTA) {
+        in >> block.step;
+      }
+      std::string hex;
+      in >> block.width >> hex;
+      if (block.width > 64) {
+        throw TableError("Invalid packed block");
+      }
+      block.readHex(hex);
+    } else {
+      throw TableError("Unknown block encoding: " + tag);
+    }
+    block.checkStream(in);
+    return block;
+  }
+
+  // Shortest text that reads back as exactly the same double
+  static std::string formatDouble(double value) {
+    char text[64];
+#if defined(__cpp_lib_to_chars)
+    auto result = std::to_chars(text, text + sizeof(text), value);
+    return std::string(text, result.ptr);
+#else
+    int n = std::snprintf(text, sizeof(text), "%.17g", value);
+    return std::string(text, static_cast<size_t>(n));
+#endif
+  }
+
+private:
+  static constexpr int MAX_SCALE = 6;
+  static constexpr double POW10[MAX_SCALE + 1] = {1,   10,  100, 1000,
+                                                  1e4, 1e5, 1e6};
+  // Keeps decimal lanes, and step * i for DELTA, far from int64 overflow
+  static constexpr double MAX_DECIMAL_LANE = 1e15;
+
+  bool is_float;
+  int scale; // FLOAT only: decimal scale of compressed lanes, -1 for raw bits
+  BlockEncoding encoding = BlockEncoding::PLAIN;
+  size_t count = 0;
+
+  std::vector<int64_t> plain; // PLAIN
+  int64_t base = 0;           // CONSTANT, FOR, DELTA
+  int64_t step = 0;           // DELTA
+  unsigned width = 0;         // FOR, DELTA: bits per packed offset
+  std::vector<uint64_t> packed;
+  std::vector<int64_t> run_values; // RLE
+  std::vector<uint32_t> run_ends;  // RLE: end row (exclusive) of each run
+
+  static int64_t rawBits(double value) {
+    int64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+  }
+
+  static int order(int64_t a, int64_t b) { return (a > b) - (a < b); }
+  static int order(double a, double b) { return (a > b) - (a < b); }
+
+  double toDouble(int64_t value) const {
+    if (scale < 0) {
+      double result;
+      std::memcpy(&result, &value, sizeof(result));
+      return result;
+    }
+    return static_cast<double>(value) / POW10[scale];
+  }
+
+  int64_t lane(size_t i) const {
+    switch (encoding) {
+    case BlockEncoding::PLAIN:
+      return plain[i];
+    case BlockEncoding::CONSTANT:
+      return base;
+    case BlockEncoding::RLE:
+      return run_values[std::upper_bound(run_ends.begin(), run_ends.end(),
+                                         static_cast<uint32_t>(i)) -
+                        run_ends.begin()];
+    case BlockEncoding::FOR:
+      return base + static_cast<int64_t>(unpack(i));
+    default:
+      return base + step * static_cast<int64_t>(i) +
+             static_cast<int64_t>(unpack(i));
+    }
+  }
+
+  uint32_t runStart(size_t run) const {
+    return run > 0 ? run_ends[run - 1] : 0;
+  }
+
+  void appendLane(int64_t value) {
+    decompress();
+    plain.push_back(value);
+    count++;
+  }
+
+  void resetEncoding() {
+    encoding = BlockEncoding::PLAIN;
+    scale = is_float ? -1 : 0;
+    plain.clear();
+    packed.clear();
+    run_values.clear();
+    run_ends.clear();
+    base = step = 0;
+    width = 0;
+  }
+
+  void checkStream(const std::istream &in) const {
+    if (!in) {
+      throw TableError("Truncated block data");
+    }
+  }
+
+  // Rewrite raw double lanes as exact decimals with the smallest scale that
+  // round-trips every value bit for bit. Returns -1 if there is none.
+  static int decimalScale(std::vector<int64_t> &lanes) {
+    std::vector<int64_t> scaled(lanes.size());
+    for (int s = 0; s <= MAX_SCALE; s++) {
+      bool exact = true;
+      for (size_t i = 0; i < lanes.size() && exact; i++) {
+        double value;
+        std::memcpy(&value, &lanes[i], sizeof(value));
+        double product = value * POW10[s];
+        if (!(std::fabs(product) < MAX_DECIMAL_LANE)) {
+          return -1; // Too large, infinite or NaN; more scale won't help
+        }
+        scaled[i] = std::llround(product);
+        double back = static_cast<double>(scaled[i]) / POW10[s];
+        exact = rawBits(back) == lanes[i];
+      }
+      if (exact) {
+        lanes = std::move(scaled);
+        return s;
+      }
+    }
+    return -1;
+  }
+
+  static unsigned bitsFor(uint64_t range) {
+    unsigned bits = 0;
+    while (bits < 64 && (range >> bits) != 0) {
+      bits++;
+    }
+    return bits;
+  }
+
+  static size_t packedBytes(size_t n, unsigned bits) {
+    return (n * bits + 63) / 64 * sizeof(uint64_t);
+  }
+
+  // Choose the smallest encoding for the lanes. Raw double bits (scale -1)
+  // only compress through runs; their integer differences mean nothing.
+  void encode(const std::vector<int64_t> &lanes) {
+    int lane_scale = scale;
+    size_t n = lanes.size();
+    size_t runs = 1;
+    int64_t lo = lanes[0], hi = lanes[0];
+    for (size_t i = 1; i < n; i++) {
+      runs += lanes[i] != lanes[i - 1];
+      lo = std::min(lo, lanes[i]);
+      hi = std::max(hi, lanes[i]);
+    }
+
+    size_t best = n * sizeof(int64_t);
+    BlockEncoding choice = BlockEncoding::PLAIN;
+    size_t rle_bytes = runs * (sizeof(int64_t) + sizeof(uint32_t));
+    if (runs == 1) {
+      best = 0;
+      choice = BlockEncoding::CONSTANT;
+    } else if (rle_bytes < best) {
+      best = rle_bytes;
+      choice = BlockEncoding::RLE;
+    }
+
+    unsigned for_width = 0, delta_width = 0;
+    int64_t delta_step = 0, delta_base = 0;
+    if ((!is_float || lane_scale >= 0) && runs > 1) {
+      for_width =
+          bitsFor(static_cast<uint64_t>(hi) - static_cast<uint64_t>(lo));
+      if (packedBytes(n, for_width) < best) {
+        best = packedBytes(n, for_width);
+        choice = BlockEncoding::FOR;
+      }
+
+      // Fit a line through the first and last value and pack how far each
+      // value lies above it; steadily growing values such as ids or
+      // timestamps then need only a few bits
+      delta_step = (lanes[n - 1] - lanes[0]) / static_cast<int64_t>(n - 1);
+      int64_t residual_hi = lanes[0];
+      delta_base = lanes[0];
+      for (size_t i = 1; i < n; i++) {
+        int64_t residual = lanes[i] - delta_step * static_cast<int64_t>(i);
+        delta_base = std::min(delta_base, residual);
+        residual_hi = std::max(residual_hi, residual);
+      }
+      delta_width = bitsFor(static_cast<uint64_t>(residual_hi) -
+                            static_cast<uint64_t>(delta_base));
+      if (delta_step != 0 && packedBytes(n, delta_width) < best) {
+        best = packedBytes(n, delta_width);
+        choice = BlockEncoding::DELTA;
+      }
+    }
+
+    if (choice == BlockEncoding::PLAIN) {
+      scale = is_float ? -1 : 0; // Keep the raw lanes already in `plain`
+      return;
+    }
+    resetEncoding();
+    scale = lane_scale;
+    encoding = choice;
+    switch (choice) {
+    case BlockEncoding::CONSTANT:
+      base = lo;
+      break;
+    case BlockEncoding::RLE:
+      for (size_t i = 0; i < n; i++) {
+        if (i == 0 || lanes[i] != lanes[i - 1]) {
+          run_values.push_back(lanes[i]);
+          run_ends.push_back(0);
+        }
+        run_ends.back() = static_cast<uint32_t>(i + 1);
+      }
+      break;
+    case BlockEncoding::FOR:
+      base = lo;
+      pack(n, for_width, [&](size_t i) { return lanes[i] - base; });
+      break;
+    default:
+      base = delta_base;
+      step = delta_step;
+      pack(n, delta_width, [&](size_t i) {
+        return lanes[i] - step * static_cast<int64_t>(i) - base;
+      });
+      break;
+    }
+  }
+
+  template <typename Offset>
+  void pack(size_t n, unsigned bits, Offset offset) {
+    width = bits;
+    packed.assign((n * bits + 63) / 64, 0);
+    if (bits == 0) {
+      return;
+    }
+    for (size_t i = 0; i < n; i++) {
+      uint64_t value = static_cast<uint64_t>(offset(i));
+      size_t bit = i * bits;
+      size_t word = bit / 64, shift = bit % 64;
+      packed[word] |= value << shift;
+      if (shift + bits > 64) {
+        packed[word + 1] |= value >> (64 - shift);
+      }
+    }
+  }
+
+  uint64_t unpack(size_t i) const {
+    if (width == 0) {
+      return 0;
+    }
+    size_t bit = i * width;
+    size_t word = bit / 64, shift = bit % 64;
+    uint64_t value = packed[word] >> shift;
+    if (shift + width > 64) {
+      value |= packed[word + 1] << (64 - shift);
+    }
+    return width == 64 ? value : value & ((uint64_t(1) << width) - 1);
+  }
+
+  // Fill `matches` once per run for CONSTANT and RLE blocks. `order` gives
+  // the three-way comparison of a lane with the literal.
+  template <typename Order>
+  bool compareRuns(TokenType op, uint8_t *matches, Order order) const {
+    auto test = [op](int result) {
+      switch (op) {
+      case TokenType::EQUALS:
+        return result == 0;
+      case TokenType::INEQUALS:
+        return result != 0;
+      case TokenType::LESS_THAN:
+        return result < 0;
+      case TokenType::GREATER_THAN:
+        return result > 0;
+      default:
+        throw TableError("Invalid condition type");
+      }
+    };
+
+    switch (encoding) {
+    case BlockEncoding::CONSTANT:
+      std::fill(matches, matches + count, test(order(base)));
+      return true;
+    case BlockEncoding::RLE:
+      for (size_t r = 0; r < run_values.size(); r++) {
+        std::fill(matches + runStart(r), matches + run_ends[r],
+                  test(order(run_values[r])));
+      }
+      return true;
+    default:
+      return false;
+    }
+  }
+
+  std::string packedHex() const {
+    static const char digits[] = "0123456789abcdef";
+    size_t bytes = (count * width + 7) / 8;
+    if (bytes == 0) {
+      return "-";
+    }
+    std::string hex;
+    hex.reserve(bytes * 2);
+    for (size_t i = 0; i < bytes; i++) {
+      uint8_t byte = static_cast<uint8_t>(packed[i / 8] >> (8 * (i % 8)));
+      hex += digits[byte >> 4];
+      hex += digits[byte & 15];
+    }
+    return hex;
+  }
+
+  void readHex(const std::string &hex) {
+    packed.assign((count * width + 63) / 64, 0);
+    size_t bytes = (count * width + 7) / 8;
+    if (bytes == 0 ? hex != "-" : hex.size() != bytes * 2) {
+      throw TableError("Invalid packed block");
+    }
+    auto nibble = [](char c) -> uint64_t {
+      if (std::isdigit(static_cast<unsigned char>(c))) {
+        return c - '0';
+      }
+      if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+      }
+      throw TableError("Invalid packed block");
+    };
+    for (size_t i = 0; i < bytes; i++) {
+      uint64_t byte = nibble(hex[2 * i]) << 4 | nibble(hex[2 * i + 1]);
+      packed[i / 8] |= byte << (8 * (i % 8));
+    }
+  }
+};
@@ -1,126 +1,243 @@
 #pragma once
+#include "commit_log.hpp"
+#include "output.hpp"
+#include "profile.hpp"
+#include "query_memory.hpp"
 #include "statement.hpp"
 #include "table.hpp"
 #include "utils.hpp"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <filesystem>
 #include <fstream>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
 class Database {
 public:
-  explicit Database(const std::string &name,
-                    const std::string &data_dir = "data")
-      : name(name), data_dir(data_dir) {}
-
-  ~Database() {
-    namespace fs = std::filesystem;
-    if (!fs::exists(data_dir)) {
-      fs::create_directory(data_dir);
+  // The statements a session runs between BEGIN and COMMIT or ROLLBACK.
+  // The tables it changes are its own until it ends: other statements
+  // changing them wait for it, and those reading them only see its
+  // changes once it commits. The table list stays as it is meanwhile, so
+  // CREATE and DROP TABLE wait for it too. Ending it without commit()
+  // rolls it back.
+  class Transaction {
+  public:
+    Transaction(Database &database, uint64_t id)
+        : database(database), id(id), catalog(database.catalog_lock) {}
+    ~Transaction() {
+      if (catalog) {
+        try {
+          rollback();
+        } catch (const std::exception &) {
+          // Nothing to report it to; the tables are released regardless
+          release();
+        }
+      }
     }
-    fs::path db_path = fs::path(data_dir) / (name + ".db");
-    serialize(db_path.string());
-  }
 
-  void executeStatement(SQLStatement *stmt) {
-    switch (stmt->type) {
-    case SQLStatementType::CREATE_TABLE: {
-      auto create_stmt = static_cast<CreateTableStatement *>(stmt);
-      if (tables.find(create_stmt->table_name) != tables.end()) {
-        throw DatabaseError("Table already exists", create_stmt->line_number);
+    Transaction(const Transaction &) = delete;
+    Transaction &operator=(const Transaction &) = delete;
+
+    Database &getDatabase() const { return database; }
+
+    // Log the changes, waiting for the disk once unless `sync` is false,
+    // then show them to other statements
+    void commit(bool sync = true) {
+      if (!records.empty()) {
+        database.log.commit(records, sync);
       }
-      tables[create_stmt->table_name] = std::make_unique<Table>(
-          create_stmt->table_name, create_stmt->columns);
-      break;
+      Table::commitTransaction(tables);
+      release();
+      database.checkpointIfDue();
     }
-    case SQLStatementType::DROP_TABLE: {
-      auto drop_stmt = static_cast<DropTableStatement *>(stmt);
-      if (tables.find(drop_stmt->table_name) == tables.end()) {
-        throw DatabaseError("Table does not exist", drop_stmt->line_number);
+
+    void rollback() {
+      for (Table *table : tables) {
+        table->rollbackTransaction();
       }
-      tables.erase(drop_stmt->table_name);
-      break;
+      release();
     }
-    case SQLStatementType::INSERT: {
-      auto insert_stmt = static_cast<InsertStatement *>(stmt);
-      if (tables.find(insert_stmt->table_name) == tables.end()) {
-        throw DatabaseError("Table does not exist", insert_stmt->line_number);
+
+    // Wait for something other than a table, such as the statements before
+    // it in a script (see Session), with `wake` to wake the wait. Another
+    // statement waiting for one of its tables meanwhile could be what it
+    // waits for, so it gives way instead: from then on givingWay() holds,
+    // and it is to be rolled back.
+    void startWaiting(std::function<void()> wake) {
+      std::lock_guard<std::mutex> guard(database.owner_lock);
+      for (Table *table : tables) {
+        if (database.wanted.count(table)) {
+          giving_way = true;
+          return;
+        }
       }
-      tables[insert_stmt->table_name]->insert(insert_stmt->values);
-      break;
+      waking = std::move(wake);
     }
-    case SQLStatementType::SELECT: {
-      auto select_stmt = static_cast<SelectStatement *>(stmt);
-      if (tables.find(select_stmt->table_name) == tables.end()) {
-        throw DatabaseError("Table does not exist", select_stmt->line_number);
-      }
-      tables[select_stmt->table_name]->select(*select_stmt);
-      break;
+
+    bool givingWay() const { return giving_way; }
+
+  private:
+    friend class Database;
+
+    Database &database;
+    uint64_t id;
+    std::shared_lock<std::shared_mutex> catalog;
+    std::vector<Table *> tables; // Changed so far, held until it ends
+    std::vector<std::shared_lock<std::shared_mutex>> table_locks;
+    std::vector<std::unique_lock<std::mutex>> writers;
+    std::string records;          // Its statements, for the commit log
+    // Guarded by the database's owner_lock
+    Table *waiting_for = nullptr;
+    std::function<void()> waking; // Set by startWaiting()
+    std::atomic<bool> giving_way{false}; // Also read without the lock
+
+    bool holds(const Table &table) const {
+      return std::find(tables.begin(), tables.end(), &table) != tables.end();
     }
-    case SQLStatementType::UPDATE: {
-      auto update_stmt = static_cast<UpdateStatement *>(stmt);
-      if (tables.find(update_stmt->table_name) == tables.end()) {
-        throw DatabaseError("Table does not exist", update_stmt->line_number);
+
+    // Take `table` to change it until the transaction ends (see
+    // Database::want)
+    void hold(Table &table, int line) {
+      if (holds(table)) {
+        return;
       }
-      tables[update_stmt->table_name]->update(*update_stmt);
-      break;
-    }
-    case SQLStatementType::DELETE: {
-      auto delete_stmt = static_cast<DeleteStatement *>(stmt);
-      if (tables.find(delete_stmt->table_name) == tables.end()) {
-        throw DatabaseError("Table does not exist", delete_stmt->line_number);
+      {
+        std::lock_guard<std::mutex> guard(database.owner_lock);
+        database.want(table, this, line);
+        waiting_for = &table;
       }
-      tables[delete_stmt->table_name]->deleteRows(*delete_stmt);
-      break;
+      table_locks.emplace_back(table.getLock());
+      writers.emplace_back(table.getWriteLock());
+      table.beginTransaction(id);
+      tables.push_back(&table);
+      std::lock_guard<std::mutex> guard(database.owner_lock);
+      waiting_for = nullptr;
+      database.unwant(table);
+      database.owners[&table] = this;
     }
-    case SQLStatementType::INNER_JOIN: {
-      auto inner_join_stmt = static_cast<InnerJoinStatement *>(stmt);
 
-      // Check if all tables exist
-      for (const auto &table_name : inner_join_stmt->tables) {
-        if (tables.find(table_name) == tables.end()) {
-          throw DatabaseError("Table does not exist: " + table_name,
-                              inner_join_stmt->line_number);
+    void release() {
+      for (Table *table : tables) {
+        database.compactIfDue(*table);
+      }
+      {
+        std::lock_guard<std::mutex> guard(database.owner_lock);
+        for (Table *table : tables) {
+          database.owners.erase(table);
         }
+        waking = nullptr;
       }
+      tables.clear();
+      writers.clear();
+      table_locks.clear();
+      catalog.unlock();
+    }
+  };
 
-      // Get all tables except the first one
-      std::vector<std::unique_ptr<Table>> other_tables;
-      for (size_t i = 1; i < inner_join_stmt->tables.size(); ++i) {
-        other_tables.push_back(std::move(tables[inner_join_stmt->tables[i]]));
-      }
+  // Table data is paged through `pool`, which must outlive the database.
+  // `generation` counts the times its file was written.
+  Database(const std::string &name, BufferPool &pool,
+           const std::string &data_dir = "data", uint64_t generation = 0)
+      : name(name), data_dir(data_dir), pool(pool), generation(generation),
+        log(logPath(data_dir, name), generation) {}
 
-      // Perform the join operation
-      tables[inner_join_stmt->tables[0]]->innerJoin(*inner_join_stmt,
-                                                    other_tables);
+  // A database that failed to load is left as it is on disk, its log
+  // included, rather than written back with what little was read
+  ~Database() {
+    {
+      std::lock_guard<std::mutex> guard(compaction_lock);
+      stopping = true;
+    }
+    compaction_due.notify_one();
+    if (compactor.joinable()) {
+      compactor.join();
+    }
+    if (loaded) {
+      checkpoint();
+    }
+  }
 
-      // Restore the moved tables
-      for (size_t i = 1; i < inner_join_stmt->tables.size(); ++i) {
-        tables[inner_join_stmt->tables[i]] = std::move(other_tables[i - 1]);
-      }
+  std::unique_ptr<Transaction> beginTransaction() {
+    return std::make_unique<Transaction>(*this, ++transactions);
+  }
 
-      break;
+  // Intermediate state the statement holds is accounted to `memory`.
+  //
+  // Sessions may run statements on the same database at once. CREATE and
+  // DROP TABLE wait for the table list to themselves; other statements
+  // share it until they finish. Statements reading a table run alongside
+  // those changing it, reading from a snapshot (see Table::Snapshot), while
+  // statements changing the same table take turns. VACUUM moves rows, so
+  // it waits for the table to itself.
+  //
+  // Statements of a transaction keep what they hold until it ends (see
+  // Transaction); those changing the table list or moving rows cannot be
+  // part of one. The changes of statements outside a transaction are
+  // logged without waiting for the disk, so they are durable once a later
+  // transaction commits or the database is written.
+  //
+  // EXPLAIN writes the operators the statement would run as. EXPLAIN
+  // ANALYZE runs it, throwing its results away, and writes what each of
+  // them did instead.
+  //
+  // A statement outside a transaction may write the file afterwards if the
+  // log has grown large (see checkpointIfDue). Deleted rows are dropped
+  // from storage after the statement or transaction that deleted them, once
+  // there are enough (see compactIfDue).
+  void executeStatement(SQLStatement *stmt, OutputWriter &out,
+                        QueryMemory &memory,
+                        Transaction *transaction = nullptr) {
+    bool changes_catalog = stmt->type == SQLStatementType::CREATE_TABLE ||
+                           stmt->type == SQLStatementType::DROP_TABLE;
+    if (transaction &&
+        (changes_catalog || stmt->type == SQLStatementType::VACUUM)) {
+      throw DatabaseError("Statement not allowed in a transaction",
+                          stmt->line_number);
     }
-    default:
-      throw DatabaseError("Unknown statement type", 0);
+    std::unique_lock<std::shared_mutex> catalog_writer(catalog_lock,
+                                                       std::defer_lock);
+    std::shared_lock<std::shared_mutex> catalog_reader(catalog_lock,
+                                                       std::defer_lock);
+    if (changes_catalog) {
+      catalog_writer.lock();
+    } else if (!transaction) {
+      catalog_reader.lock();
+    }
+    run(stmt, out, memory, transaction);
+    if (!transaction) {
+      catalog_writer = {};
+      catalog_reader = {};
+      checkpointIfDue();
     }
   }
 
   std::string getName() const { return name; }
 
-  // Serialize database to a file
-  void serialize(const std::string &filepath) const {
-    std::ofstream out(filepath);
-    if (!out) {
+  // Serialize database to a file. The new file is written next to the old
+  // one and renamed over it, since clean blocks may still be read back from
+  // the old one while writing. It is written in large batches in the
+  // background as the tables are formatted. With `sync` it is on disk on
+  // return.
+  void serialize(const std::string &filepath, bool sync = false) const {
+    std::string temp_path = filepath + ".tmp";
+    BatchedFileBuffer buffer(temp_path);
+    std::ostream out(&buffer);
+    if (!buffer.isOpen()) {
       throw DatabaseError("Failed to open file for serialization", 0);
     }
 
-    // Write database name
-    out << "DATABASE " << name << "\n";
+    // Write database name and generation
+    out << "DATABASE " << name << " " << generation << "\n";
 
     // Write number of tables
     out << "TABLES " << tables.size() << "\n\n";
@@ -130,26 +247,43 @@ public:
       table->serialize(out);
       out << "\n"; // Add a blank line between tables
     }
+    if (!buffer.close() || !out) {
+      throw DatabaseError("Failed to write database file", 0);
+    }
+    if (sync) {
+      syncPath(temp_path);
+    }
+    std::filesystem::rename(temp_path, filepath);
+    if (sync) {
+      syncPath(std::filesystem::path(filepath).parent_path().string());
+    }
   }
 
   // Deserialize database from a file
-  static std::unique_ptr<Database> deserialize(const std::string &filepath) {
-    std::ifstream in(filepath);
+  static std::unique_ptr<Database> deserialize(const std::string &filepath,
+                                               BufferPool &pool) {
+    std::ifstream in(filepath, std::ios::binary);
     if (!in) {
       throw DatabaseError("Failed to open file for deserialization", 0);
     }
+    int file = pool.openFile(filepath);
 
     std::string line, word;
 
-    // Read database name
+    // Read database name, and generation if the file has one
     std::getline(in, line);
     std::istringstream iss(line);
     iss >> word; // Skip "DATABASE"
     std::string db_name;
-    iss >> db_name;
+    uint64_t generation = 0;
+    iss >> db_name >> generation;
 
     // Create database instance
-    auto db = std::make_unique<Database>(db_name);
+    std::string data_dir =
+        std::filesystem::path(filepath).parent_path().string();
+    auto db = std::make_unique<Database>(db_name, pool, data_dir, generation);
+    db->loaded = false;
+    db->file_size = std::filesystem::file_size(filepath);
 
     // Read number of tables
     std::getline(in, line);
@@ -164,18 +298,393 @@ public:
 
     // Read each table
     for (size_t i = 0; i < num_tables; ++i) {
-      auto table = Table::deserialize(in);
+      auto table = Table::deserialize(in, pool, file);
       db->tables[table->getName()] = std::move(table);
 
       // Skip the blank line between tables
       std::getline(in, line);
     }
 
+    db->replay();
+    db->loaded = true;
+    return db;
+  }
+
+  // A database created after its data directory was last written, from
+  // its log alone
+  static std::unique_ptr<Database> recover(const std::string &name,
+                                           BufferPool &pool,
+                                           const std::string &data_dir) {
+    auto db = std::make_unique<Database>(name, pool, data_dir);
+    db->loaded = false;
+    db->replay();
+    db->loaded = true;
     return db;
   }
 
+  static std::string logPath(const std::string &data_dir,
+                             const std::string &name) {
+    return (std::filesystem::path(data_dir) / (name + ".log")).string();
+  }
+
 private:
+  // Holds a table for a statement changing it: for the statement alone,
+  // or in a transaction until that ends
+  class WriteAccess {
+  public:
+    WriteAccess(Database &database, Table &table, Transaction *transaction,
+                int line) {
+      if (transaction) {
+        transaction->hold(table, line);
+        return;
+      }
+      {
+        std::lock_guard<std::mutex> guard(database.owner_lock);
+        database.want(table, nullptr, line);
+      }
+      table_lock = std::shared_lock<std::shared_mutex>(table.getLock());
+      writer = std::unique_lock<std::mutex>(table.getWriteLock());
+      std::lock_guard<std::mutex> guard(database.owner_lock);
+      database.unwant(table);
+    }
+
+  private:
+    std::shared_lock<std::shared_mutex> table_lock;
+    std::unique_lock<std::mutex> writer;
+  };
+
+  // The log is dropped by writing the file once it is this large, or as
+  // large as the file if that is larger, so that a checkpoint costs about
+  // as much as the logging leading up to it
+  static constexpr uint64_t CHECKPOINT_LOG_SIZE = 16 << 20;
+
   std::string name;
   std::string data_dir;
+  BufferPool &pool;
+  uint64_t generation;
+  std::atomic<uint64_t> file_size{0}; // When last written or read
+  CommitLog log;
+  bool replaying = false; // Changes are not logged again
+  bool loaded = true;     // False until its file and log are read
+  std::shared_mutex catalog_lock; // Guards `tables` itself
   std::unordered_map<std::string, std::unique_ptr<Table>> tables;
+  std::atomic<uint64_t> transactions{0};   // Ids handed out so far
+  std::mutex owner_lock;                   // Guards `owners`
+  std::unordered_map<const Table *, Transaction *> owners;
+  // Also guarded by owner_lock: statements waiting for each table
+  std::unordered_map<const Table *, size_t> wanted;
+  std::mutex compaction_lock; // Guards the three below
+  std::condition_variable compaction_due;
+  std::vector<std::string> to_compact; // Names of tables to vacuum
+  bool stopping = false;
+  std::thread compactor; // Started with the first table to vacuum
+
+  // Count a statement, of `waiter` or outside a transaction, as waiting
+  // for `table`. Waiting for a transaction that waits for `waiter`,
+  // however indirectly, would wait forever, so that fails instead. One
+  // waiting for something other than a table gives way (see
+  // Transaction::startWaiting). Needs owner_lock.
+  void want(const Table &table, const Transaction *waiter, int line) {
+    for (const Table *next = &table; next;) {
+      auto it = owners.find(next);
+      if (it == owners.end()) {
+        break;
+      }
+      Transaction *owner = it->second;
+      if (owner == waiter) {
+        throw DatabaseError("Deadlock waiting for table " + table.getName(),
+                            line);
+      }
+      if (owner->waking && !owner->giving_way) {
+        owner->giving_way = true;
+        owner->waking();
+      }
+      next = owner->waiting_for;
+    }
+    wanted[&table]++;
+  }
+
+  // The statement got the table. Needs owner_lock.
+  void unwant(const Table &table) {
+    if (--wanted[&table] == 0) {
+      wanted.erase(&table);
+    }
+  }
+
+  // Shares a table for a statement reading it, unless its transaction
+  // already holds it
+  static std::shared_lock<std::shared_mutex>
+  readAccess(Table &table, const Transaction *transaction) {
+    if (transaction && transaction->holds(table)) {
+      return {};
+    }
+    return std::shared_lock<std::shared_mutex>(table.getLock());
+  }
+
+  // Log a statement that changed the database while it still holds what it
+  // changed, so the log has the changes to each table in the order they
+  // were made. A transaction collects them until it commits.
+  void logChange(const SQLStatement &stmt, Transaction *transaction) {
+    if (replaying) {
+      return;
+    }
+    if (transaction) {
+      CommitLog::addRecord(transaction->records, stmt.text);
+      return;
+    }
+    std::string group;
+    CommitLog::addRecord(group, stmt.text);
+    log.commit(group, false);
+  }
+
+  // Write the file, then drop the log of the changes it now holds. Until
+  // the file is on disk the log is still needed, so if there is one the
+  // file is synced first.
+  void checkpoint() {
+    namespace fs = std::filesystem;
+    if (!fs::exists(data_dir)) {
+      fs::create_directory(data_dir);
+    }
+    fs::path db_path = fs::path(data_dir) / (name + ".db");
+    generation++;
+    serialize(db_path.string(), log.exists());
+    log.reset(generation);
+    file_size = fs::file_size(db_path);
+  }
+
+  // Checkpoint once the log is large enough, if nothing else is using the
+  // database. Otherwise it is left to a later statement, rather than
+  // waiting for open transactions to end.
+  void checkpointIfDue() {
+    if (replaying ||
+        log.getSize() < std::max<uint64_t>(CHECKPOINT_LOG_SIZE, file_size)) {
+      return;
+    }
+    std::unique_lock<std::shared_mutex> idle(catalog_lock, std::try_to_lock);
+    if (idle.owns_lock()) {
+      checkpoint();
+    }
+  }
+
+  // Have the compactor vacuum `table` if enough of its rows are dead. The
+  // caller is still changing it, so it does not wait: the compactor takes
+  // the table to itself, as VACUUM does, once statements let go of it.
+  void compactIfDue(const Table &table) {
+    if (!table.vacuumDue()) {
+      return;
+    }
+    std::lock_guard<std::mutex> guard(compaction_lock);
+    if (std::find(to_compact.begin(), to_compact.end(), table.getName()) !=
+        to_compact.end()) {
+      return;
+    }
+    to_compact.push_back(table.getName());
+    if (!compactor.joinable()) {
+      compactor = std::thread([this] { compact(); });
+    }
+    compaction_due.notify_one();
+  }
+
+  // The compactor: vacuum the tables queued by compactIfDue until the
+  // database closes. A table may have been dropped, or vacuumed, since.
+  void compact() {
+    std::unique_lock<std::mutex> guard(compaction_lock);
+    while (true) {
+      compaction_due.wait(guard,
+                          [this] { return stopping || !to_compact.empty(); });
+      if (stopping) {
+        return;
+      }
+      std::string table_name = std::move(to_compact.back());
+      to_compact.pop_back();
+      guard.unlock();
+      {
+        std::shared_lock<std::shared_mutex> catalog(catalog_lock);
+        auto it = tables.find(table_name);
+        if (it != tables.end()) {
+          std::unique_lock<std::shared_mutex> table_lock(
+              it->second->getLock());
+          if (it->second->vacuumDue()) {
+            it->second->vacuum();
+          }
+        }
+      }
+      guard.lock();
+    }
+  }
+
+  // Apply the changes logged since the file was last written. Results,
+  // such as those of an EXPLAIN ANALYZE, are thrown away. Only an UPDATE
+  // that failed part way fails again, where it did before.
+  void replay() {
+    NullOutputWriter out;
+    replaying = true;
+    for (const std::string &text :
+         CommitLog::recover(logPath(data_dir, name), generation)) {
+      Arena arena;
+      std::unique_ptr<SQLStatement> stmt = Parser(text, arena).parse();
+      QueryMemory memory(pool, BufferPool::UNLIMITED, stmt->line_number);
+      try {
+        executeStatement(stmt.get(), out, memory);
+      } catch (const SQLError &) {
+        // Stopped where it stopped the first time
+      }
+    }
+    replaying = false;
+  }
+
+  // Run a statement with the locks executeStatement takes for it. With a
+  // profile the statement is planned into it, and only run if it is being
+  // analyzed; one only planned reads its table even if it would change it.
+  void run(SQLStatement *stmt, OutputWriter &out, QueryMemory &memory,
+           Transaction *transaction, QueryProfile *profile = nullptr) {
+    uint64_t reader = transaction ? transaction->id : Table::NO_TRANSACTION;
+    bool planning = profile && !profile->analyzing();
+
+    switch (stmt->type) {
+    case SQLStatementType::CREATE_TABLE: {
+      auto create_stmt = static_cast<CreateTableStatement *>(stmt);
+      if (tables.find(create_stmt->table_name) != tables.end()) {
+        throw DatabaseError("Table already exists", create_stmt->line_number);
+      }
+      tables[create_stmt->table_name] = std::make_unique<Table>(
+          create_stmt->table_name, create_stmt->columns, pool);
+      logChange(*stmt, transaction);
+      break;
+    }
+    case SQLStatementType::DROP_TABLE: {
+      auto drop_stmt = static_cast<DropTableStatement *>(stmt);
+      if (tables.find(drop_stmt->table_name) == tables.end()) {
+        throw DatabaseError("Table does not exist", drop_stmt->line_number);
+      }
+      tables.erase(drop_stmt->table_name);
+      logChange(*stmt, transaction);
+      break;
+    }
+    case SQLStatementType::INSERT: {
+      auto insert_stmt = static_cast<InsertStatement *>(stmt);
+      Table &table = findTable(insert_stmt->table_name, stmt->line_number);
+      if (planning) {
+        std::shared_lock<std::shared_mutex> table_lock =
+            readAccess(table, transaction);
+        table.insert(insert_stmt->values, profile);
+        break;
+      }
+      WriteAccess access(*this, table, transaction, stmt->line_number);
+      table.insert(insert_stmt->values, profile);
+      logChange(*stmt, transaction);
+      break;
+    }
+    case SQLStatementType::SELECT: {
+      auto select_stmt = static_cast<SelectStatement *>(stmt);
+      Table &table = findTable(select_stmt->table_name, stmt->line_number);
+      std::shared_lock<std::shared_mutex> table_lock =
+          readAccess(table, transaction);
+      table.select(*select_stmt, out, reader, profile);
+      break;
+    }
+    case SQLStatementType::UPDATE: {
+      auto update_stmt = static_cast<UpdateStatement *>(stmt);
+      Table &table = findTable(update_stmt->table_name, stmt->line_number);
+      if (planning) {
+        std::shared_lock<std::shared_mutex> table_lock =
+            readAccess(table, transaction);
+        table.update(*update_stmt, profile);
+        break;
+      }
+      WriteAccess access(*this, table, transaction, stmt->line_number);
+      try {
+        table.update(*update_stmt, profile);
+      } catch (const SQLError &) {
+        // The rows before the one it failed on stay updated, and replaying
+        // it updates them again
+        logChange(*stmt, transaction);
+        throw;
+      }
+      logChange(*stmt, transaction);
+      if (!transaction) {
+        compactIfDue(table);
+      }
+      break;
+    }
+    case SQLStatementType::DELETE: {
+      auto delete_stmt = static_cast<DeleteStatement *>(stmt);
+      Table &table = findTable(delete_stmt->table_name, stmt->line_number);
+      if (planning) {
+        std::shared_lock<std::shared_mutex> table_lock =
+            readAccess(table, transaction);
+        table.deleteRows(*delete_stmt, profile);
+        break;
+      }
+      WriteAccess access(*this, table, transaction, stmt->line_number);
+      table.deleteRows(*delete_stmt, profile);
+      logChange(*stmt, transaction);
+      if (!transaction) {
+        compactIfDue(table);
+      }
+      break;
+    }
+    case SQLStatementType::VACUUM: {
+      auto vacuum_stmt = static_cast<VacuumStatement *>(stmt);
+      Table &table = findTable(vacuum_stmt->table_name, stmt->line_number);
+      std::unique_lock<std::shared_mutex> table_lock(table.getLock());
+      table.vacuum();
+      break;
+    }
+    case SQLStatementType::INNER_JOIN: {
+      auto inner_join_stmt = static_cast<InnerJoinStatement *>(stmt);
+
+      // Check if all tables exist
+      for (const auto &table_name : inner_join_stmt->tables) {
+        if (tables.find(table_name) == tables.end()) {
+          throw DatabaseError("Table does not exist: " + table_name,
+                              inner_join_stmt->line_number);
+        }
+      }
+
+      // Get all tables except the first one
+      std::vector<Table *> other_tables;
+      for (size_t i = 1; i < inner_join_stmt->tables.size(); ++i) {
+        other_tables.push_back(
+            tables.find(inner_join_stmt->tables[i])->second.get());
+      }
+      Table &first = *tables.find(inner_join_stmt->tables[0])->second;
+
+      // Share each table once, in address order so that joins locking the
+      // same tables cannot wait on each other
+      std::vector<Table *> locked = other_tables;
+      locked.push_back(&first);
+      std::sort(locked.begin(), locked.end());
+      locked.erase(std::unique(locked.begin(), locked.end()), locked.end());
+      std::vector<std::shared_lock<std::shared_mutex>> table_locks;
+      for (Table *table : locked) {
+        table_locks.push_back(readAccess(*table, transaction));
+      }
+
+      // Perform the join operation
+      first.innerJoin(*inner_join_stmt, other_tables, out, memory, reader,
+                      profile);
+      break;
+    }
+    case SQLStatementType::EXPLAIN: {
+      auto explain_stmt = static_cast<ExplainStatement *>(stmt);
+      QueryProfile explained(explain_stmt->analyze);
+      NullOutputWriter results;
+      run(explain_stmt->statement.get(), results, memory, transaction,
+          &explained);
+      explained.write(out);
+      break;
+    }
+    default:
+      throw DatabaseError("Unknown statement type", 0);
+    }
+  }
+
+  Table &findTable(const std::string &table_name, int line) {
+    auto it = tables.find(table_name);
+    if (it == tables.end()) {
+      throw DatabaseError("Table does not exist", line);
+    }
+    return *it->second;
+  }
 };
\ No newline at end of file
@@ -0,0 +1,337 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#include <mutex>
+#include <sys/stat.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#include <cerrno>
+#include <cstring>
+#include <linux/io_uring.h>
+#include <memory>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+// Leaked from <linux/fs.h>, and a member name elsewhere
+#undef BLOCK_SIZE
+#undef BLOCK_SIZE_BITS
+#define MINIDB_IO_URING 1
+#endif
+
+//-----------------------------------------------------------------------------
+// File access by descriptor
+//-----------------------------------------------------------------------------
+
+// Reads and writes at an offset, on the C runtime's file descriptors.
+// POSIX has pread and pwrite for this, which many threads may call at
+// once. The Windows runtime only has seek-then-read, so there the two
+// calls are kept together under one lock, and I/O on different files
+// waits for each other.
+
+#ifdef _WIN32
+inline std::mutex &fileSeekMutex() {
+  static std::mutex mutex;
+  return mutex;
+}
+#endif
+
+// A descriptor for reading `path`, or -1
+inline int openForReading(const std::string &path) {
+#ifdef _WIN32
+  return ::_open(path.c_str(), _O_RDONLY | _O_BINARY);
+#else
+  return ::open(path.c_str(), O_RDONLY);
+#endif
+}
+
+// A descriptor for writing `path`, created if missing and not truncated,
+// or -1
+inline int openForWriting(const std::string &path) {
+#ifdef _WIN32
+  return ::_open(path.c_str(), _O_WRONLY | _O_CREAT | _O_BINARY,
+                 _S_IREAD | _S_IWRITE);
+#else
+  return ::open(path.c_str(), O_WRONLY | O_CREAT, 0644);
+#endif
+}
+
+inline void closeFile(int fd) {
+#ifdef _WIN32
+  ::_close(fd);
+#else
+  ::close(fd);
+#endif
+}
+
+inline int fileDescriptor(std::FILE *file) {
+#ifdef _WIN32
+  return ::_fileno(file);
+#else
+  return ::fileno(file);
+#endif
+}
+
+// False on an error or a short file
+inline bool readAt(int fd, uint64_t offset, char *data, size_t size) {
+#ifdef _WIN32
+  std::lock_guard<std::mutex> guard(fileSeekMutex());
+  if (::_lseeki64(fd, static_cast<__int64>(offset), SEEK_SET) < 0) {
+    return false;
+  }
+#endif
+  size_t done = 0;
+  while (done < size) {
+#ifdef _WIN32
+    int n = ::_read(fd, data + done,
+                    static_cast<unsigned>(std::min<size_t>(size - done,
+                                                           1u << 30)));
+#else
+    ssize_t n = ::pread(fd, data + done, size - done,
+                        static_cast<off_t>(offset + done));
+#endif
+    if (n <= 0) {
+      return false;
+    }
+    done += static_cast<size_t>(n);
+  }
+  return true;
+}
+
+inline bool writeAt(int fd, uint64_t offset, const char *data, size_t size) {
+#ifdef _WIN32
+  std::lock_guard<std::mutex> guard(fileSeekMutex());
+  if (::_lseeki64(fd, static_cast<__int64>(offset), SEEK_SET) < 0) {
+    return false;
+  }
+#endif
+  size_t done = 0;
+  while (done < size) {
+#ifdef _WIN32
+    int n = ::_write(fd, data + done,
+                     static_cast<unsigned>(std::min<size_t>(size - done,
+                                                            1u << 30)));
+#else
+    ssize_t n = ::pwrite(fd, data + done, size - done,
+                         static_cast<off_t>(offset + done));
+#endif
+    if (n <= 0) {
+      return false;
+    }
+    done += static_cast<size_t>(n);
+  }
+  return true;
+}
+
+// The size of the file, or -1
+inline int64_t fileSize(int fd) {
+#ifdef _WIN32
+  std::lock_guard<std::mutex> guard(fileSeekMutex());
+  return ::_lseeki64(fd, 0, SEEK_END);
+#else
+  return ::lseek(fd, 0, SEEK_END);
+#endif
+}
+
+// Cut the file to `size` bytes
+inline bool truncateFile(int fd, uint64_t size) {
+#ifdef _WIN32
+  return ::_chsize_s(fd, static_cast<__int64>(size)) == 0;
+#else
+  return ::ftruncate(fd, static_cast<off_t>(size)) == 0;
+#endif
+}
+
+// Wait for what was written to the file to be on disk
+inline bool syncFile(int fd) {
+#ifdef _WIN32
+  return ::_commit(fd) == 0;
+#else
+  return ::fsync(fd) == 0;
+#endif
+}
+
+#ifdef MINIDB_IO_URING
+//-----------------------------------------------------------------------------
+// Asynchronous file access on Linux
+//-----------------------------------------------------------------------------
+
+// An io_uring: reads and writes at an offset handed to the kernel in
+// batches, any number of them under way on one thread. It is driven
+// through the system calls directly, so liburing is not needed. Only one
+// thread may use a ring at a time.
+class IoRing {
+public:
+  // A ring with room for `entries` requests, or null where io_uring is
+  // missing, older than reads and writes at an offset (5.6), or blocked,
+  // as seccomp filters and kernel.io_uring_disabled do. A no-op request is
+  // run through it first, since a filter may only block io_uring_enter.
+  static std::unique_ptr<IoRing> create(unsigned entries) {
+    io_uring_params params;
+    std::memset(&params, 0, sizeof(params));
+    int fd = static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+    if (fd < 0) {
+      return nullptr;
+    }
+    std::unique_ptr<IoRing> ring(new IoRing(fd));
+    if (!(params.features & IORING_FEAT_RW_CUR_POS) || !ring->map(params)) {
+      return nullptr;
+    }
+    ring->prepareRequest(IORING_OP_NOP, -1, 0, nullptr, 0, 0);
+    uint64_t tag;
+    int result;
+    if (ring->enter(true) != 0 || !ring->complete(tag, result) ||
+        result != 0) {
+      return nullptr;
+    }
+    return ring;
+  }
+
+  ~IoRing() {
+    if (sqes != MAP_FAILED) {
+      ::munmap(sqes, sqes_size);
+    }
+    if (cq_ring != MAP_FAILED && cq_ring != sq_ring) {
+      ::munmap(cq_ring, cq_ring_size);
+    }
+    if (sq_ring != MAP_FAILED) {
+      ::munmap(sq_ring, sq_ring_size);
+    }
+    ::close(fd);
+  }
+
+  IoRing(const IoRing &) = delete;
+  IoRing &operator=(const IoRing &) = delete;
+
+  // Requests that may be prepared or under way at once
+  unsigned capacity() const { return entries; }
+
+  // Queue a read or write of `size` bytes at `offset`, to be told apart
+  // by `tag` once complete. It goes to the kernel with the next enter().
+  void prepare(bool write, int file, uint64_t offset, char *data,
+               uint32_t size, uint64_t tag) {
+    prepareRequest(write ? IORING_OP_WRITE : IORING_OP_READ, file, offset,
+                   data, size, tag);
+  }
+
+  // Hand the requests prepared to the kernel, then, with `wait`, wait
+  // for one to complete unless one already has. 0, or the errno: EINTR,
+  // EAGAIN and EBUSY are worth trying again; other errors leave the
+  // requests not taken by the kernel unrun.
+  int enter(bool wait) {
+    if (::syscall(__NR_io_uring_enter, fd, unsubmitted(), wait ? 1 : 0,
+                  wait ? IORING_ENTER_GETEVENTS : 0, nullptr, 0) < 0) {
+      return errno;
+    }
+    return 0;
+  }
+
+  // Take back the request prepared last, unless the kernel took it
+  bool retract(uint64_t &tag) {
+    if (unsubmitted() == 0) {
+      return false;
+    }
+    unsigned tail = *sq_tail - 1;
+    tag = sqes[tail & *sq_mask].user_data;
+    __atomic_store_n(sq_tail, tail, __ATOMIC_RELEASE);
+    return true;
+  }
+
+  // Take a completed request's tag and result: the bytes transferred,
+  // which may be fewer than asked for, or a negated errno. False if none
+  // has completed.
+  bool complete(uint64_t &tag, int &result) {
+    unsigned head = *cq_head;
+    if (head == __atomic_load_n(cq_tail, __ATOMIC_ACQUIRE)) {
+      return false;
+    }
+    const io_uring_cqe &cqe = cqes[head & *cq_mask];
+    tag = cqe.user_data;
+    result = cqe.res;
+    __atomic_store_n(cq_head, head + 1, __ATOMIC_RELEASE);
+    return true;
+  }
+
+private:
+  int fd;
+  unsigned entries = 0;
+  void *sq_ring = MAP_FAILED;
+  void *cq_ring = MAP_FAILED;
+  io_uring_sqe *sqes = static_cast<io_uring_sqe *>(MAP_FAILED);
+  size_t sq_ring_size = 0, cq_ring_size = 0, sqes_size = 0;
+  // Within the rings, shared with the kernel
+  unsigned *sq_head, *sq_tail, *sq_mask, *sq_array;
+  unsigned *cq_head, *cq_tail, *cq_mask;
+  io_uring_cqe *cqes;
+
+  explicit IoRing(int fd) : fd(fd) {}
+
+  unsigned unsubmitted() const {
+    return *sq_tail - __atomic_load_n(sq_head, __ATOMIC_ACQUIRE);
+  }
+
+  // Map the rings and the requests the kernel set up. Both rings may
+  // share one mapping.
+  bool map(const io_uring_params &params) {
+    entries = params.sq_entries;
+    sq_ring_size = params.sq_off.array + entries * sizeof(unsigned);
+    cq_ring_size =
+        params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    bool single = params.features & IORING_FEAT_SINGLE_MMAP;
+    if (single) {
+      sq_ring_size = cq_ring_size = std::max(sq_ring_size, cq_ring_size);
+    }
+    sq_ring = ::mmap(nullptr, sq_ring_size, PROT_READ | PROT_WRITE,
+                     MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+    if (sq_ring == MAP_FAILED) {
+      return false;
+    }
+    cq_ring = single ? sq_ring
+                     : ::mmap(nullptr, cq_ring_size, PROT_READ | PROT_WRITE,
+                              MAP_SHARED | MAP_POPULATE, fd,
+                              IORING_OFF_CQ_RING);
+    sqes_size = entries * sizeof(io_uring_sqe);
+    void *mapped = ::mmap(nullptr, sqes_size, PROT_READ | PROT_WRITE,
+                          MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+    sqes = static_cast<io_uring_sqe *>(mapped);
+    if (cq_ring == MAP_FAILED || mapped == MAP_FAILED) {
+      return false;
+    }
+    char *sq = static_cast<char *>(sq_ring);
+    char *cq = static_cast<char *>(cq_ring);
+    sq_head = reinterpret_cast<unsigned *>(sq + params.sq_off.head);
+    sq_tail = reinterpret_cast<unsigned *>(sq + params.sq_off.tail);
+    sq_mask = reinterpret_cast<unsigned *>(sq + params.sq_off.ring_mask);
+    sq_array = reinterpret_cast<unsigned *>(sq + params.sq_off.array);
+    cq_head = reinterpret_cast<unsigned *>(cq + params.cq_off.head);
+    cq_tail = reinterpret_cast<unsigned *>(cq + params.cq_off.tail);
+    cq_mask = reinterpret_cast<unsigned *>(cq + params.cq_off.ring_mask);
+    cqes = reinterpret_cast<io_uring_cqe *>(cq + params.cq_off.cqes);
+    // Each slot of the queue names the request of the same index
+    for (unsigned i = 0; i < entries; i++) {
+      sq_array[i] = i;
+    }
+    return true;
+  }
+
+  void prepareRequest(uint8_t opcode, int file, uint64_t offset, char *data,
+                      uint32_t size, uint64_t tag) {
+    unsigned tail = *sq_tail;
+    io_uring_sqe &sqe = sqes[tail & *sq_mask];
+    std::memset(&sqe, 0, sizeof(sqe));
+    sqe.opcode = opcode;
+    sqe.fd = file;
+    sqe.off = offset;
+    sqe.addr = reinterpret_cast<uintptr_t>(data);
+    sqe.len = size;
+    sqe.user_data = tag;
+    __atomic_store_n(sq_tail, tail + 1, __ATOMIC_RELEASE);
+  }
+};
+#endif
@@ -1,13 +1,16 @@
 #pragma once
 #include "utils.hpp"
 #include <algorithm>
-#include <deque>
 #include <string>
+#include <string_view>
+#include <vector>
 
+// Splits a statement into tokens up front. Token text is copied into the
+// arena, which must outlive the tokens.
 class Lexer {
 public:
-  explicit Lexer(const std::string &input, int start_line = 1)
-      : input(input), current_token(Token(TokenType::EOF_TOKEN)),
+  Lexer(const std::string &input, Arena &arena, int start_line = 1)
+      : arena(arena), current_token(Token(TokenType::EOF_TOKEN)),
         current_line(start_line) {
     std::string current_string;
     bool parsing_str_literal = false;
@@ -16,10 +19,11 @@ public:
       char c = input[i];
       auto createToken = [&]() {
         if (!current_string.empty()) {
-          tokens.push_back(
-              Token(recognizeToken(current_string).type,
-                    (parsing_nagetive_number ? "-" : "") + current_string,
-                    current_line));
+          TokenType type = recognizeToken(current_string);
+          if (parsing_nagetive_number) {
+            current_string.insert(current_string.begin(), '-');
+          }
+          tokens.push_back(Token(type, text(current_string), current_line));
         }
         current_string.clear();
         parsing_nagetive_number = false;
@@ -33,8 +37,8 @@ public:
 
       if (c == '\'') {
         if (parsing_str_literal) {
-          tokens.push_back(
-              Token(TokenType::STRING_LITERAL, current_string, current_line));
+          tokens.push_back(Token(TokenType::STRING_LITERAL,
+                                 text(current_string), current_line));
           current_string.clear();
           parsing_str_literal = false;
         } else
@@ -46,8 +50,9 @@ public:
                    !std::all_of(current_string.begin(), current_string.end(),
                                 ::isdigit)))) {
         createToken();
-        tokens.push_back(Token(recognizeToken(std::string(1, c)).type,
-                               std::string(1, c), current_line));
+        tokens.push_back(Token(recognizeToken(std::string(1, c)),
+                               text(std::string_view(&input[i], 1)),
+                               current_line));
       } else if (!parsing_str_literal && c == '!' && i + 1 < input.length() &&
                  input[i + 1] == '=') {
         createToken();
@@ -58,8 +63,9 @@ public:
           parsing_nagetive_number = true;
         } else {
           createToken();
-          tokens.push_back(Token(recognizeToken(std::string(1, c)).type,
-                                 std::string(1, c), current_line));
+          tokens.push_back(Token(recognizeToken(std::string(1, c)),
+                                 text(std::string_view(&input[i], 1)),
+                                 current_line));
         }
       } else if (std::isspace(c) && !parsing_str_literal) {
         createToken();
@@ -69,8 +75,8 @@ public:
     }
 
     if (!current_string.empty()) {
-      tokens.push_back(Token(recognizeToken(current_string).type,
-                             current_string, current_line));
+      tokens.push_back(Token(recognizeToken(current_string),
+                             text(current_string), current_line));
     }
 
 #ifdef DEBUG
@@ -87,8 +93,8 @@ public:
   }
 
   bool exist(TokenType type) {
-    for (const auto &token : tokens) {
-      if (token.type == type) {
+    for (size_t i = next; i < tokens.size(); i++) {
+      if (tokens[i].type == type) {
         return true;
       }
     }
@@ -96,17 +102,19 @@ public:
   }
 
 private:
-  std::string input;
-  std::deque<Token> tokens;
+  Arena &arena;
+  std::vector<Token> tokens;
+  size_t next = 0; // Index of the token after current_token
   Token current_token;
   int current_line;
 
+  std::string_view text(std::string_view value) { return arena.store(value); }
+
   void advance() {
-    if (tokens.empty()) {
+    if (next == tokens.size()) {
       current_token = Token(TokenType::EOF_TOKEN);
       return;
     }
-    current_token = tokens.front();
-    tokens.pop_front();
+    current_token = tokens[next++];
   }
 };
\ No newline at end of file
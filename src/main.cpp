@@ -1,93 +1,144 @@
-#include "database.hpp"
-#include "parser.hpp"
-#include "statement.hpp"
+#include "buffer_pool.hpp"
+#include "minidb.hpp"
+#include "output.hpp"
+#include "server.hpp"
+#include "session.hpp"
 #include "utils.hpp"
-#include <filesystem>
+#include <cctype>
 #include <fstream>
 #include <iostream>
 
-OutputWriter file_writer;
-namespace fs = std::filesystem;
-
-void loadDatabases(
-    std::unordered_map<std::string, std::unique_ptr<Database>> &databases,
-    const std::string &data_dir) {
-  if (!fs::exists(data_dir)) {
-    fs::create_directory(data_dir);
-    return;
+// A byte count with an optional K, M or G suffix
+size_t parseMemorySize(const std::string &text) {
+  size_t digits = 0;
+  while (digits < text.size() && std::isdigit(text[digits])) {
+    digits++;
   }
-
-  for (const auto &entry : fs::directory_iterator(data_dir)) {
-    if (entry.path().extension() == ".db") {
-      auto db = Database::deserialize(entry.path().string());
-      databases[db->getName()] = std::move(db);
-    }
+  std::string suffix = text.substr(digits);
+  int shift = suffix.empty()  ? 0
+              : suffix == "K" ? 10
+              : suffix == "M" ? 20
+              : suffix == "G" ? 30
+                              : -1;
+  if (digits == 0 || digits > 12 || shift < 0) {
+    throw ArgumentError("Invalid memory size: " + text);
   }
+  return std::stoull(text.substr(0, digits)) << shift;
 }
 
 int main(int argc, char *argv[]) {
-  std::unordered_map<std::string, std::unique_ptr<Database>> databases;
-  Database *current_database = nullptr;
+  // Declared first so the output is flushed before the databases are
+  // written back
+  std::unique_ptr<Connection> connection;
   const std::string data_dir = "data";
+  std::unique_ptr<OutputWriter> file_writer;
 
   try {
-    if (argc != 3) {
+    // Split options from the remaining arguments: the input and output
+    // files, or the socket for --serve, or all three for --client
+    enum class Mode { RUN, SERVE, CLIENT } mode = Mode::RUN;
+    OutputFormat format = OutputFormat::TEXT;
+    ConnectionOptions connection_options;
+    SessionOptions &options = connection_options.session;
+    std::vector<std::string> args;
+    for (int i = 1; i < argc; i++) {
+      std::string arg = argv[i];
+      if (arg == "--format=text") {
+        format = OutputFormat::TEXT;
+      } else if (arg == "--format=binary") {
+        format = OutputFormat::BINARY;
+      } else if (arg.rfind("--memory-limit=", 0) == 0) {
+        connection_options.memory_limit = parseMemorySize(arg.substr(15));
+      } else if (arg.rfind("--work-memory=", 0) == 0) {
+        connection_options.work_memory = parseMemorySize(arg.substr(14));
+      } else if (arg.rfind("--temp-dir=", 0) == 0) {
+        connection_options.temp_dir = arg.substr(11);
+      } else if (arg.rfind("--query-memory=", 0) == 0) {
+        options.query_memory_limit = parseMemorySize(arg.substr(15));
+      } else if (arg.rfind("--statement-threads=", 0) == 0) {
+        std::string count = arg.substr(20);
+        if (count.empty() || count.size() > 4 ||
+            count.find_first_not_of("0123456789") != std::string::npos) {
+          throw ArgumentError("Invalid thread count: " + count);
+        }
+        options.statement_threads = static_cast<unsigned>(std::stoul(count));
+      } else if (arg == "--stats") {
+        options.print_stats = true;
+      } else if (arg == "--no-io-uring") {
+        connection_options.io_uring = false;
+      } else if (arg == "--serve") {
+        mode = Mode::SERVE;
+      } else if (arg == "--client") {
+        mode = Mode::CLIENT;
+      } else if (arg.rfind("--", 0) == 0) {
+        throw ArgumentError("Unknown option: " + arg);
+      } else {
+        args.push_back(arg);
+      }
+    }
+
+#ifndef __linux__
+    if (mode != Mode::RUN) {
+      throw ArgumentError("--serve and --client are only available on Linux");
+    }
+#else
+    if (mode == Mode::SERVE) {
+      if (args.size() != 1) {
+        throw ArgumentError("Argument number error");
+      }
+      connection = std::make_unique<Connection>(data_dir, connection_options);
+      Server server(args[0], connection->getDatabases(),
+                    connection->getPool(), data_dir, options);
+      connection->load();
+      server.run();
+      return EXIT_SUCCESS;
+    }
+#endif
+
+    size_t files = mode == Mode::CLIENT ? 1 : 0;
+    if (args.size() != files + 2) {
       throw ArgumentError("Argument number error");
-    } else if (std::string(argv[1]).find(".sql") == std::string::npos) {
+    } else if (args[files].find(".sql") == std::string::npos) {
       throw ArgumentError("Input file must be a SQL file");
     }
+#ifdef __linux__
+    if (mode == Mode::CLIENT) {
+      return runClient(args[0], format, options.print_stats, args[1],
+                       args[2]);
+    }
+#endif
+
+    // A spare core or two parse statements ahead of the one running.
+    // Statements on different tables only run at once when asked for with
+    // --statement-threads (see SessionOptions).
+    options.parse_threads = std::min(hardwareThreads() - 1, 2u);
 
     // Load existing databases
-    loadDatabases(databases, data_dir);
+    connection = Connection::open(data_dir, connection_options);
 
-    // Read input SQL file and split into statements
-    std::ifstream input_file(argv[1]);
+    // Read input SQL file
+    std::ifstream input_file(args[0]);
     if (!input_file.is_open()) {
       throw FileError("Failed to open input file");
     }
-    const std::vector<Statement> &&statements = splitStatements(input_file);
 
     // Open output file for writing
-    file_writer.open(argv[2]);
+    file_writer = OutputWriter::create(format);
+    file_writer->open(args[1]);
 
     // Parse statements and execute
-    for (const auto &statement : statements) {
-      std::unique_ptr<SQLStatement> parsed_statement =
-          Parser(statement.content, statement.start_line).parse();
-      // Skip empty statements or statements with only semicolon
-      if (!parsed_statement) {
-        continue;
-      }
-      if (parsed_statement->type == SQLStatementType::CREATE_DATABASE) {
-        if (databases.find(parsed_statement->getDatabaseName()) !=
-            databases.end()) {
-          throw DatabaseError("Database already exists",
-                              parsed_statement->line_number);
-        }
-        databases[parsed_statement->getDatabaseName()] =
-            std::make_unique<Database>(parsed_statement->getDatabaseName(),
-                                       data_dir);
-      } else if (parsed_statement->type == SQLStatementType::USE_DATABASE) {
-        if (databases.find(parsed_statement->getDatabaseName()) ==
-            databases.end()) {
-          throw DatabaseError("Database does not exist",
-                              parsed_statement->line_number);
-        }
-        current_database = databases[parsed_statement->getDatabaseName()].get();
-      } else {
-        if (!current_database) {
-          throw DatabaseError("No database selected",
-                              parsed_statement->line_number);
-        }
-        current_database->executeStatement(parsed_statement.get());
-      }
-#ifdef DEBUG
-      std::cerr << "Successfully parsed statement\n";
-#endif
-    }
+    connection->run(input_file, *file_writer);
   } catch (const ArgumentError &e) {
     std::cerr << "ArgumentError: " << e.what() << "\n"
-              << "Usage: minidb <input_file.sql> <output_file.csv>\n";
+              << "Usage: minidb [--format=text|binary] "
+                 "[--memory-limit=SIZE[K|M|G]] "
+                 "[--work-memory=SIZE[K|M|G]] [--temp-dir=DIR] "
+                 "[--no-io-uring] "
+                 "[--query-memory=SIZE[K|M|G]] [--statement-threads=N] "
+                 "[--stats] <input_file.sql> <output_file.csv>\n"
+              << "       minidb [options] --serve <socket>\n"
+              << "       minidb [--format=text|binary] [--stats] --client "
+                 "<socket> <input_file.sql> <output_file.csv>\n";
     return EXIT_FAILURE;
   } catch (const FileError &e) {
     std::cerr << "File Error: " << e.what() << "\n";
@@ -0,0 +1,182 @@
+#pragma once
+#include "buffer_pool.hpp"
+#include "output.hpp"
+#include "session.hpp"
+#include "utils.hpp"
+#include <cstddef>
+#include <iostream>
+#include <istream>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+// Embedding API: the libminidb target. A program opens a data directory
+// once and runs SQL against it in process, reading results through
+// cursors instead of an output file. The command line is built on it.
+//-----------------------------------------------------------------------------
+
+// Walks the rows of one result. It starts before the first row; each
+// next() moves to the following one. Values, text included, stay valid as
+// long as the QueryResults they came from.
+class ResultCursor {
+public:
+  explicit ResultCursor(const ResultBuffer::Result &result)
+      : result(&result) {}
+
+  const std::vector<ColumnDefinition> &columns() const {
+    return result->columns;
+  }
+
+  size_t rowCount() const {
+    return result->columns.empty()
+               ? 0
+               : result->values.size() / result->columns.size();
+  }
+
+  // False once past the last row
+  bool next() {
+    if (position == rowCount()) {
+      return false;
+    }
+    position++;
+    return true;
+  }
+
+  // Index of the column of that name, as in the SELECT list
+  size_t columnIndex(std::string_view name) const {
+    for (size_t i = 0; i < result->columns.size(); i++) {
+      if (result->columns[i].name == name) {
+        return i;
+      }
+    }
+    throw ArgumentError("No column named " + std::string(name));
+  }
+
+  const Value &get(size_t column) const {
+    if (position == 0 || column >= result->columns.size()) {
+      throw ArgumentError(position == 0 ? "No current row"
+                                        : "Column index out of range");
+    }
+    return result->values[(position - 1) * result->columns.size() + column];
+  }
+
+  int getInt(size_t column) const {
+    return get(column, Value::Kind::INTEGER).asInt();
+  }
+  double getFloat(size_t column) const {
+    return get(column, Value::Kind::FLOAT).asFloat();
+  }
+  std::string_view getText(size_t column) const {
+    return get(column, Value::Kind::TEXT).asText();
+  }
+
+private:
+  const ResultBuffer::Result *result;
+  size_t position = 0; // Rows moved to so far
+
+  const Value &get(size_t column, Value::Kind kind) const {
+    const Value &value = get(column);
+    if (value.getKind() != kind) {
+      throw ArgumentError("Column " + result->columns[column].name +
+                          " is of another type");
+    }
+    return value;
+  }
+};
+
+// The results of the statements run by one execute(), one per SELECT or
+// join, in order
+class QueryResults {
+public:
+  QueryResults() : buffer(std::make_unique<ResultBuffer>()) {}
+
+  size_t size() const { return buffer->getResults().size(); }
+  ResultCursor cursor(size_t i) const {
+    return ResultCursor(buffer->getResults().at(i));
+  }
+
+private:
+  friend class Connection;
+  std::unique_ptr<ResultBuffer> buffer; // Stays put when moved
+};
+
+// Settings of a connection. Those left unset keep the defaults of
+// BufferPool.
+struct ConnectionOptions {
+  size_t memory_limit = BufferPool::UNLIMITED;
+  std::optional<size_t> work_memory;
+  std::string temp_dir;
+  bool io_uring = true; // Page I/O through io_uring where Linux allows it
+  SessionOptions session;
+  std::ostream *log = &std::cerr; // Statistics and warnings
+};
+
+// The databases of a data directory, loaded for as long as the connection
+// is open, and one session running statements against them. Statements
+// run as a script does: the first to fail throws its error, leaving the
+// changes of those before it in place. Closing the connection writes the
+// databases back.
+class Connection {
+public:
+  Connection(const std::string &data_dir,
+             const ConnectionOptions &options = {})
+      : data_dir(data_dir),
+        session(databases, pool, data_dir, options.session, *options.log) {
+    pool.setBudget(options.memory_limit);
+    if (options.work_memory) {
+      pool.setWorkMemory(*options.work_memory);
+    }
+    if (!options.temp_dir.empty()) {
+      pool.setTempDirectory(options.temp_dir);
+    }
+    pool.setIoUring(options.io_uring);
+  }
+
+  Connection(const Connection &) = delete;
+  Connection &operator=(const Connection &) = delete;
+
+  // A connection with the databases of `data_dir` loaded
+  static std::unique_ptr<Connection>
+  open(const std::string &data_dir, const ConnectionOptions &options = {}) {
+    auto connection = std::make_unique<Connection>(data_dir, options);
+    connection->load();
+    return connection;
+  }
+
+  // Load the databases, for a connection constructed without
+  void load() { databases.load(data_dir, pool); }
+
+  QueryResults execute(const std::string &sql) {
+    QueryResults results;
+    execute(sql, *results.buffer);
+    return results;
+  }
+
+  // Write the results to `out` as they are produced instead
+  void execute(const std::string &sql, OutputWriter &out) {
+    std::istringstream script(sql);
+    run(script, out);
+  }
+
+  void run(std::istream &script, OutputWriter &out) {
+    session.execute(splitStatements(script), out);
+  }
+
+  void setPrintStats(bool print) { session.setPrintStats(print); }
+
+  // For serving the same databases over a socket
+  DatabaseMap &getDatabases() { return databases; }
+  BufferPool &getPool() { return pool; }
+
+private:
+  // The pool is declared first so it outlives the databases paging
+  // through it
+  BufferPool pool;
+  DatabaseMap databases;
+  std::string data_dir;
+  Session session;
+};
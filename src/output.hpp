@@ -0,0 +1,444 @@
+#pragma once
+#include "utils.hpp"
+#include <charconv>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+// Output handling
+//-----------------------------------------------------------------------------
+
+// Result formats selectable with --format
+enum class OutputFormat { TEXT, BINARY };
+
+// Sink for query results. Subclasses decide the encoding; this base class
+// owns the file and a large reusable buffer that goes to the file in a few
+// big unbuffered writes, so no per-cell stream formatting or allocation
+// happens on the hot path.
+class OutputWriter {
+public:
+  OutputWriter() = default;
+  OutputWriter(const OutputWriter &) = delete;
+  OutputWriter &operator=(const OutputWriter &) = delete;
+
+  virtual ~OutputWriter() {
+    if (file || sink) {
+      try {
+        flush();
+      } catch (const FileError &) {
+        // Nothing sensible left to do while shutting down
+      }
+    }
+    if (file) {
+      std::fclose(file);
+    }
+  }
+
+  void open(const std::string &filename) {
+    file = std::fopen(filename.c_str(), mode());
+    if (!file) {
+      throw FileError("Failed to open output file");
+    }
+    buffer.resize(BUFFER_SIZE);
+    // The buffer below already batches writes; skip stdio's own copy
+    std::setvbuf(file, nullptr, _IONBF, 0);
+  }
+
+  // Hand the output to `output` in chunks as the buffer fills, instead of
+  // writing a file
+  using Sink = std::function<void(const char *, size_t)>;
+  void open(Sink output) {
+    sink = std::move(output);
+    buffer.resize(BUFFER_SIZE);
+  }
+
+  // Start a result set with the given column names and types. Nothing is
+  // written until the first row or the end of the result, so a statement
+  // that fails before producing anything leaves no partial output behind.
+  virtual void beginResult(const std::vector<ColumnDefinition> &columns) = 0;
+
+  // Write one result row
+  virtual void writeRow(const std::vector<Value> &row) = 0;
+
+  // Finish the current result set
+  virtual void endResult() = 0;
+
+  static std::unique_ptr<OutputWriter> create(OutputFormat format);
+
+protected:
+  static constexpr size_t BUFFER_SIZE = 1 << 20;
+
+  std::FILE *file = nullptr;
+  Sink sink;
+  std::vector<char> buffer; // Allocated once there is a file to write
+  size_t used = 0;
+
+  virtual const char *mode() const = 0;
+
+  void flush() {
+    if (used > 0) {
+      emit(buffer.data(), used);
+    }
+    used = 0;
+  }
+
+  void emit(const char *data, size_t n) {
+    if (sink) {
+      sink(data, n);
+    } else if (file && std::fwrite(data, 1, n, file) != n) {
+      throw FileError("Failed to write output file");
+    }
+  }
+
+  // Make room for n more bytes in the buffer
+  void reserve(size_t n) {
+    if (used + n > buffer.size()) {
+      flush();
+    }
+  }
+
+  void append(const char *data, size_t n) {
+    if (n > buffer.size()) {
+      flush();
+      emit(data, n);
+      return;
+    }
+    reserve(n);
+    std::memcpy(buffer.data() + used, data, n);
+    used += n;
+  }
+
+  void append(char c) {
+    reserve(1);
+    buffer[used++] = c;
+  }
+};
+
+// The default format: a header line of column names, one comma separated
+// line per row with quoted strings and two-decimal floats, then "---".
+class TextOutputWriter : public OutputWriter {
+public:
+  void beginResult(const std::vector<ColumnDefinition> &columns) override {
+    pending_header = columns;
+    header_pending = true;
+  }
+
+  void writeRow(const std::vector<Value> &row) override {
+    flushHeader();
+    for (size_t i = 0; i < row.size(); i++) {
+      if (i > 0) {
+        append(',');
+      }
+      write(row[i]);
+    }
+    append('\n');
+  }
+
+  void endResult() override {
+    flushHeader();
+    append("---\n", 4);
+  }
+
+private:
+  std::vector<ColumnDefinition> pending_header;
+  bool header_pending = false;
+
+  const char *mode() const override { return "w"; }
+
+  void flushHeader() {
+    if (!header_pending) {
+      return;
+    }
+    for (size_t i = 0; i < pending_header.size(); i++) {
+      if (i > 0) {
+        append(',');
+      }
+      append(pending_header[i].name.data(), pending_header[i].name.size());
+    }
+    append('\n');
+    header_pending = false;
+  }
+
+  void write(std::string_view data) {
+    append('\'');
+    append(data.data(), data.size());
+    append('\'');
+  }
+
+  void write(int data) {
+    reserve(16);
+    auto result = std::to_chars(buffer.data() + used,
+                                buffer.data() + buffer.size(), data);
+    used = result.ptr - buffer.data();
+  }
+
+  // Doubles are always written with two decimals
+  void write(double data) {
+#if defined(__cpp_lib_to_chars)
+    reserve(512);
+    auto result =
+        std::to_chars(buffer.data() + used, buffer.data() + buffer.size(),
+                      data, std::chars_format::fixed, 2);
+    used = result.ptr - buffer.data();
+#else
+    char text[512];
+    int n = std::snprintf(text, sizeof(text), "%.2f", data);
+    append(text, static_cast<size_t>(n));
+#endif
+  }
+
+  void write(const Value &data) {
+    switch (data.getKind()) {
+    case Value::Kind::INTEGER:
+      write(data.asInt());
+      break;
+    case Value::Kind::FLOAT:
+      write(data.asFloat());
+      break;
+    default:
+      write(data.asText());
+      break;
+    }
+  }
+};
+
+// Length-prefixed columnar batches, for consumers that would otherwise
+// reparse the text format. All integers are little-endian.
+//
+//   file       := "MDBR" u32 version result*
+//   result     := 'R' u32 column_count column* batch* 'E' u64 row_count
+//   column     := u8 type u32 name_length name_bytes
+//   batch      := 'B' u32 row_count column_data*
+//   column_data:= INTEGER: i32[row_count]
+//                 FLOAT:   f64[row_count]
+//                 TEXT:    u32 offsets[row_count + 1] bytes[offsets.back()]
+//
+// Type codes are 1 = INTEGER, 2 = FLOAT, 3 = TEXT.
+class BinaryOutputWriter : public OutputWriter {
+public:
+  static constexpr uint32_t VERSION = 1;
+  static constexpr size_t BATCH_ROWS = 1024;
+
+  void beginResult(const std::vector<ColumnDefinition> &columns) override {
+    if (!wrote_file_header) {
+      append("MDBR", 4);
+      appendInt(VERSION);
+      wrote_file_header = true;
+    }
+    result_columns = columns;
+    header_pending = true;
+    batch.resize(columns.size());
+    for (auto &column : batch) {
+      column.clear();
+    }
+    batch_rows = 0;
+    total_rows = 0;
+  }
+
+  void writeRow(const std::vector<Value> &row) override {
+    for (size_t i = 0; i < row.size(); i++) {
+      addValue(i, row[i]);
+    }
+    finishRow();
+  }
+
+  void endResult() override {
+    flushBatch();
+    flushHeader();
+    append('E');
+    appendInt(static_cast<uint64_t>(total_rows));
+  }
+
+private:
+  // Column buffers of the batch being built; reused between batches
+  struct ColumnBuffer {
+    std::vector<int32_t> ints;
+    std::vector<double> floats;
+    std::vector<uint32_t> offsets;
+    std::string bytes;
+
+    void clear() {
+      ints.clear();
+      floats.clear();
+      offsets.assign(1, 0);
+      bytes.clear();
+    }
+  };
+
+  std::vector<ColumnDefinition> result_columns;
+  std::vector<ColumnBuffer> batch;
+  size_t batch_rows = 0;
+  size_t total_rows = 0;
+  bool header_pending = false;
+  bool wrote_file_header = false;
+
+  const char *mode() const override { return "wb"; }
+
+  template <typename T> void appendInt(T value) {
+    unsigned char bytes[sizeof(T)];
+    for (size_t i = 0; i < sizeof(T); i++) {
+      bytes[i] = static_cast<unsigned char>(value >> (8 * i));
+    }
+    append(reinterpret_cast<const char *>(bytes), sizeof(T));
+  }
+
+  void appendDouble(double value) {
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    appendInt(bits);
+  }
+
+  static uint8_t typeCode(TokenType type) {
+    switch (type) {
+    case TokenType::INTEGER:
+      return 1;
+    case TokenType::FLOAT:
+      return 2;
+    default:
+      return 3;
+    }
+  }
+
+  void addValue(size_t column, const Value &value) {
+    ColumnBuffer &buffer = batch[column];
+    switch (result_columns[column].type) {
+    case TokenType::INTEGER:
+      buffer.ints.push_back(value.asInt());
+      break;
+    case TokenType::FLOAT:
+      buffer.floats.push_back(value.asFloat());
+      break;
+    default:
+      buffer.bytes += value.asText();
+      buffer.offsets.push_back(static_cast<uint32_t>(buffer.bytes.size()));
+      break;
+    }
+  }
+
+  void finishRow() {
+    if (++batch_rows == BATCH_ROWS) {
+      flushBatch();
+    }
+  }
+
+  void flushHeader() {
+    if (!header_pending) {
+      return;
+    }
+    append('R');
+    appendInt(static_cast<uint32_t>(result_columns.size()));
+    for (const auto &column : result_columns) {
+      append(static_cast<char>(typeCode(column.type)));
+      appendInt(static_cast<uint32_t>(column.name.size()));
+      append(column.name.data(), column.name.size());
+    }
+    header_pending = false;
+  }
+
+  void flushBatch() {
+    if (batch_rows == 0) {
+      return;
+    }
+    flushHeader();
+    append('B');
+    appendInt(static_cast<uint32_t>(batch_rows));
+    for (size_t i = 0; i < batch.size(); i++) {
+      ColumnBuffer &buffer = batch[i];
+      switch (result_columns[i].type) {
+      case TokenType::INTEGER:
+        for (int32_t value : buffer.ints) {
+          appendInt(static_cast<uint32_t>(value));
+        }
+        break;
+      case TokenType::FLOAT:
+        for (double value : buffer.floats) {
+          appendDouble(value);
+        }
+        break;
+      default:
+        for (uint32_t offset : buffer.offsets) {
+          appendInt(offset);
+        }
+        append(buffer.bytes.data(), buffer.bytes.size());
+        break;
+      }
+      buffer.clear();
+    }
+    total_rows += batch_rows;
+    batch_rows = 0;
+  }
+};
+
+// Results kept in memory instead, to be written to another writer later.
+// Each long string is copied, as the rows given may point into tables.
+class ResultBuffer : public OutputWriter {
+public:
+  void beginResult(const std::vector<ColumnDefinition> &columns) override {
+    results.push_back({columns, {}, 0, false});
+  }
+
+  void writeRow(const std::vector<Value> &row) override {
+    Result &result = results.back();
+    result.width = row.size();
+    for (const Value &value : row) {
+      result.values.push_back(arena.copy(value));
+    }
+  }
+
+  void endResult() override { results.back().ended = true; }
+
+  // Write the results kept, as they were given
+  void writeTo(OutputWriter &out) const {
+    std::vector<Value> row;
+    for (const Result &result : results) {
+      out.beginResult(result.columns);
+      for (size_t i = 0; i < result.values.size(); i += result.width) {
+        row.assign(result.values.begin() + i,
+                   result.values.begin() + i + result.width);
+        out.writeRow(row);
+      }
+      if (result.ended) {
+        out.endResult();
+      }
+    }
+  }
+
+  struct Result {
+    std::vector<ColumnDefinition> columns;
+    std::vector<Value> values; // Row by row
+    size_t width = 0;          // Values in a row
+    bool ended = false;
+  };
+
+  const std::vector<Result> &getResults() const { return results; }
+
+private:
+  std::vector<Result> results;
+  Arena arena;
+
+  const char *mode() const override { return "w"; }
+};
+
+// Results thrown away, for statements run only to measure them
+class NullOutputWriter : public OutputWriter {
+public:
+  void beginResult(const std::vector<ColumnDefinition> &) override {}
+  void writeRow(const std::vector<Value> &) override {}
+  void endResult() override {}
+
+private:
+  const char *mode() const override { return "w"; }
+};
+
+inline std::unique_ptr<OutputWriter> OutputWriter::create(OutputFormat format) {
+  if (format == OutputFormat::BINARY) {
+    return std::make_unique<BinaryOutputWriter>();
+  }
+  return std::make_unique<TextOutputWriter>();
+}
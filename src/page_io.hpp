@@ -0,0 +1,621 @@
+#pragma once
+#include "file_io.hpp"
+#include "spill.hpp"
+#include "utils.hpp"
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <streambuf>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Where a copy of a page can be read back from
+struct PageLocation {
+  static constexpr int NO_FILE = -1;
+
+  int file = NO_FILE; // PageIO file id; NO_FILE if never written
+  uint64_t offset = 0;
+  uint64_t length = 0;
+};
+
+// File access for the buffer pool. Reads can be issued ahead of time, and
+// spill writes are queued; both run in the background, so a scan over
+// evicted blocks finds the next ones already read and eviction does not
+// wait for the disk. A copy still being written is read back from memory.
+//
+// On Linux the queued reads and writes go to an io_uring (see IoRing),
+// driven by one thread that keeps up to RING_ENTRIES of them under way.
+// Where the kernel lacks io_uring or it is blocked, or if the ring fails
+// later, they run with readAt/writeAt on a few worker threads instead.
+// Either is started on first use.
+//
+// Spilled copies their owner discards leave free extents in the spill
+// file, which later copies reuse, first fit, so a process that keeps
+// changing and evicting the same pages keeps the file near the size of
+// its data rather than of every copy ever written. Free space at the end
+// of the file is cut off.
+class PageIO {
+public:
+  static constexpr size_t THREADS = 4;
+  static constexpr unsigned RING_ENTRIES = 64;
+  // Read-ahead copies nobody asked for are dropped beyond this many
+  static constexpr size_t MAX_UNCLAIMED = 256;
+
+  PageIO() = default;
+
+  ~PageIO() {
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      stopping = true;
+      work_ready.notify_all();
+    }
+#ifdef MINIDB_IO_URING
+    // It may hand its jobs to the workers as it stops
+    if (ring_thread.joinable()) {
+      ring_thread.join();
+    }
+#endif
+    for (auto &worker : workers) {
+      worker.join();
+    }
+    for (size_t i = 0; i < files.size(); i++) {
+      if (static_cast<int>(i) != spill_file) {
+        closeFile(files[i]);
+      }
+    }
+    if (spill_stream) {
+      std::fclose(spill_stream);
+    }
+  }
+
+  PageIO(const PageIO &) = delete;
+  PageIO &operator=(const PageIO &) = delete;
+
+  // Where temporary files go; empty for the system's temporary directory
+  const std::string &getTempDirectory() const { return temp_directory; }
+  void setTempDirectory(const std::string &dir) { temp_directory = dir; }
+
+  // Whether to try io_uring, before the first read or write is queued
+  void setIoUring(bool enabled) { io_uring = enabled; }
+
+  // Register a file copies can be read back from
+  int openFile(const std::string &path) {
+    int fd = openForReading(path);
+    if (fd < 0) {
+      throw FileError("Failed to open " + path);
+    }
+    return addFile(fd);
+  }
+
+  // Queue a copy for the spill file, created on first use. The file only
+  // lives as long as this object.
+  PageLocation spill(std::string data) {
+    if (spill_file == PageLocation::NO_FILE) {
+      spill_stream = createTempFile(temp_directory);
+      spill_file = addFile(fileDescriptor(spill_stream));
+    }
+    std::unique_lock<std::mutex> lock(mutex);
+    PageLocation location{spill_file, allocate(data.size()), data.size()};
+    Pending &pending = in_flight[key(location)];
+    pending.data = std::move(data);
+    pending.state = State::WRITING;
+    queue.push_back({true, location});
+    startWorkers();
+    work_ready.notify_one();
+    return location;
+  }
+
+  // The copy at `location` will not be read again. Its space in the spill
+  // file is freed once no read or write of it is under way.
+  void discard(const PageLocation &location) {
+    if (location.file == PageLocation::NO_FILE ||
+        location.file != spill_file) {
+      return;
+    }
+    std::unique_lock<std::mutex> lock(mutex);
+    auto it = in_flight.find(key(location));
+    if (it != in_flight.end()) {
+      if (it->second.queued) {
+        it->second.discarded = true;
+        return;
+      }
+      in_flight.erase(it);
+    }
+    release(location);
+  }
+
+  // Bytes the spill file takes, free extents within it included
+  uint64_t spillBytes() {
+    std::unique_lock<std::mutex> lock(mutex);
+    return spill_size;
+  }
+
+  // Start reading a copy in the background, unless already under way
+  void prefetch(const PageLocation &location) {
+    std::unique_lock<std::mutex> lock(mutex);
+    auto [it, inserted] = in_flight.try_emplace(key(location));
+    if (!inserted) {
+      return;
+    }
+    queue.push_back({false, location});
+    startWorkers();
+    work_ready.notify_one();
+  }
+
+  std::string read(const PageLocation &location) {
+    int fd;
+    {
+      // Take the copy if it is being written or read ahead. Finished
+      // read-ahead may be dropped meanwhile, so look it up after each wait.
+      std::unique_lock<std::mutex> lock(mutex);
+      if (location.file < 0 ||
+          static_cast<size_t>(location.file) >= files.size()) {
+        throw FileError("Page has no stored copy");
+      }
+      fd = files[location.file];
+      auto it = in_flight.end();
+      io_done.wait(lock, [&] {
+        it = in_flight.find(key(location));
+        return it == in_flight.end() || it->second.state != State::READING;
+      });
+      if (it != in_flight.end()) {
+        if (it->second.state == State::WRITING) {
+          return it->second.data;
+        }
+        bool failed = it->second.state == State::FAILED;
+        std::string data = std::move(it->second.data);
+        in_flight.erase(it);
+        if (failed) {
+          throw FileError("Failed to read page");
+        }
+        return data;
+      }
+    }
+    std::string data(location.length, '\0');
+    if (!readAt(fd, location.offset, data)) {
+      throw FileError("Failed to read page");
+    }
+    return data;
+  }
+
+private:
+  enum class State { READING, READY, WRITING, FAILED };
+
+  struct Pending {
+    std::string data;
+    State state = State::READING;
+    bool queued = true;     // Its job has not finished
+    bool discarded = false; // Free its extent once it has
+  };
+
+  struct Job {
+    bool write;
+    PageLocation location;
+  };
+
+  // Descriptors by file id, looked up and appended to under the mutex
+  std::vector<int> files;
+  std::string temp_directory;
+  bool io_uring = true;
+  std::FILE *spill_stream = nullptr;
+  int spill_file = PageLocation::NO_FILE;
+
+  std::mutex mutex;
+  uint64_t spill_size = 0;
+  std::map<uint64_t, uint64_t> free_extents; // Offset to length
+  std::condition_variable work_ready;
+  std::condition_variable io_done;
+  std::deque<Job> queue;
+  std::map<std::pair<int, uint64_t>, Pending> in_flight;
+  std::deque<std::pair<int, uint64_t>> unclaimed; // Finished read-ahead
+  std::vector<std::thread> workers;
+  bool stopping = false;
+#ifdef MINIDB_IO_URING
+  bool ring_checked = false;
+  std::unique_ptr<IoRing> ring; // Used by ring_thread alone
+  std::thread ring_thread;
+#endif
+
+  static std::pair<int, uint64_t> key(const PageLocation &location) {
+    return {location.file, location.offset};
+  }
+
+  // Room for `size` bytes in the spill file. Needs the mutex.
+  uint64_t allocate(uint64_t size) {
+    for (auto it = free_extents.begin(); it != free_extents.end(); ++it) {
+      auto [offset, length] = *it;
+      if (length < size) {
+        continue;
+      }
+      free_extents.erase(it);
+      if (length > size) {
+        free_extents.emplace(offset + size, length - size);
+      }
+      return offset;
+    }
+    uint64_t offset = spill_size;
+    spill_size += size;
+    return offset;
+  }
+
+  // Free the extent of a spilled copy, merging it with free neighbours.
+  // Needs the mutex.
+  void release(const PageLocation &location) {
+    uint64_t offset = location.offset, length = location.length;
+    auto next = free_extents.lower_bound(offset);
+    if (next != free_extents.end() && offset + length == next->first) {
+      length += next->second;
+      next = free_extents.erase(next);
+    }
+    if (next != free_extents.begin()) {
+      auto previous = std::prev(next);
+      if (previous->first + previous->second == offset) {
+        offset = previous->first;
+        length += previous->second;
+        free_extents.erase(previous);
+      }
+    }
+    if (offset + length == spill_size) {
+      spill_size = offset;
+      truncateFile(files[spill_file], spill_size);
+      return;
+    }
+    free_extents.emplace(offset, length);
+  }
+
+  int addFile(int fd) {
+    std::unique_lock<std::mutex> lock(mutex);
+    files.push_back(fd);
+    return static_cast<int>(files.size() - 1);
+  }
+
+  // Start the ring's thread, or the workers without one. Needs the mutex.
+  void startWorkers() {
+#ifdef MINIDB_IO_URING
+    if (!ring_checked && io_uring) {
+      ring = IoRing::create(RING_ENTRIES);
+      if (ring) {
+        ring_thread = std::thread([this] { driveRing(); });
+      }
+    }
+    ring_checked = true;
+    if (ring) {
+      return;
+    }
+#endif
+    while (workers.size() < THREADS) {
+      workers.emplace_back([this] { work(); });
+    }
+  }
+
+  static bool readAt(int fd, uint64_t offset, std::string &data) {
+    return ::readAt(fd, offset, data.data(), data.size());
+  }
+
+  static bool writeAt(int fd, uint64_t offset, const std::string &data) {
+    return ::writeAt(fd, offset, data.data(), data.size());
+  }
+
+  // Queued writes are finished before the workers stop
+  void work() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+      work_ready.wait(lock, [&] { return stopping || !queue.empty(); });
+      if (queue.empty()) {
+        return;
+      }
+      Job job = queue.front();
+      queue.pop_front();
+      int fd = files[job.location.file];
+      if (job.write) {
+        // Nothing else changes or removes a copy being written
+        const std::string &data =
+            in_flight.find(key(job.location))->second.data;
+        lock.unlock();
+        bool written = writeAt(fd, job.location.offset, data);
+        lock.lock();
+        finishWrite(job.location, written);
+        continue;
+      }
+      std::string data(job.location.length, '\0');
+      lock.unlock();
+      bool read = readAt(fd, job.location.offset, data);
+      lock.lock();
+      finishRead(job.location, std::move(data), read);
+    }
+  }
+
+  // Needs the mutex
+  void finishWrite(const PageLocation &location, bool written) {
+    auto it = in_flight.find(key(location));
+    it->second.queued = false;
+    if (it->second.discarded) {
+      in_flight.erase(it);
+      release(location);
+    } else if (written) {
+      in_flight.erase(it);
+    }
+    // Otherwise keep serving it from memory
+  }
+
+  // Needs the mutex
+  void finishRead(const PageLocation &location, std::string data,
+                  bool read) {
+    auto it = in_flight.find(key(location));
+    it->second.queued = false;
+    if (it->second.discarded) {
+      in_flight.erase(it);
+      release(location);
+      io_done.notify_all();
+      return;
+    }
+    it->second.data = std::move(data);
+    it->second.state = read ? State::READY : State::FAILED;
+    unclaimed.push_back(it->first);
+    dropUnclaimed();
+    io_done.notify_all();
+  }
+
+#ifdef MINIDB_IO_URING
+  // A queued job handed to the ring, tagged with its index
+  struct Request {
+    Job job;
+    std::string data; // Read into
+    uint64_t done = 0; // Bytes transferred so far
+  };
+
+  // The ring's largest single transfer; what is left goes in another
+  static constexpr uint32_t MAX_TRANSFER = 1u << 30;
+
+  // Keep up to the ring's capacity of queued jobs under way, resuming
+  // transfers cut short. Queued writes are finished before it stops.
+  void driveRing() {
+    std::vector<Request> requests(ring->capacity());
+    std::vector<uint64_t> idle;
+    for (uint64_t tag = requests.size(); tag-- > 0;) {
+      idle.push_back(tag);
+    }
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+      while (!queue.empty() && !idle.empty()) {
+        uint64_t tag = idle.back();
+        idle.pop_back();
+        Request &request = requests[tag];
+        request.job = queue.front();
+        queue.pop_front();
+        request.done = 0;
+        if (!request.job.write) {
+          request.data.assign(request.job.location.length, '\0');
+        }
+        issue(request, tag);
+      }
+      if (idle.size() == requests.size()) {
+        if (stopping && queue.empty()) {
+          return;
+        }
+        work_ready.wait(lock, [&] { return stopping || !queue.empty(); });
+        continue;
+      }
+      lock.unlock();
+      int error = ring->enter(true);
+      lock.lock();
+      if (error != 0 && error != EINTR && error != EAGAIN && error != EBUSY) {
+        abandonRing(lock, requests, idle);
+        return;
+      }
+      uint64_t tag;
+      int result;
+      while (ring->complete(tag, result)) {
+        Request &request = requests[tag];
+        uint64_t length = request.job.location.length;
+        if (result == -EINTR || result == -EAGAIN ||
+            (result > 0 && (request.done += result) < length)) {
+          issue(request, tag);
+          continue;
+        }
+        idle.push_back(tag);
+        bool ok = result >= 0 && request.done == length;
+        if (request.job.write) {
+          finishWrite(request.job.location, ok);
+        } else {
+          finishRead(request.job.location, std::move(request.data), ok);
+        }
+      }
+    }
+  }
+
+  // Prepare what is left of the request. Needs the mutex.
+  void issue(Request &request, uint64_t tag) {
+    const PageLocation &location = request.job.location;
+    char *data = request.job.write
+                     ? in_flight.find(key(location))->second.data.data()
+                     : request.data.data();
+    uint64_t left = location.length - request.done;
+    ring->prepare(request.job.write, files[location.file],
+                  location.offset + request.done, data + request.done,
+                  static_cast<uint32_t>(std::min<uint64_t>(left, MAX_TRANSFER)),
+                  tag);
+  }
+
+  // The ring failed: queue the jobs it did not take again, wait for those
+  // it did, then leave the queue to the workers. A job cut short is queued
+  // again whole.
+  void abandonRing(std::unique_lock<std::mutex> &lock,
+                   std::vector<Request> &requests,
+                   std::vector<uint64_t> &idle) {
+    uint64_t tag;
+    while (ring->retract(tag)) {
+      queue.push_front(requests[tag].job);
+      idle.push_back(tag);
+    }
+    int result;
+    while (idle.size() < requests.size()) {
+      if (!ring->complete(tag, result)) {
+        lock.unlock();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        lock.lock();
+        continue;
+      }
+      idle.push_back(tag);
+      Request &request = requests[tag];
+      if (result > 0) {
+        request.done += result;
+      }
+      bool ok = result >= 0 && request.done == request.job.location.length;
+      if (!ok && (result > 0 || result == -EINTR || result == -EAGAIN)) {
+        queue.push_front(request.job);
+      } else if (request.job.write) {
+        finishWrite(request.job.location, ok);
+      } else {
+        finishRead(request.job.location, std::move(request.data), ok);
+      }
+    }
+    ring.reset();
+    startWorkers();
+    work_ready.notify_all();
+  }
+#endif
+
+  // Forget the oldest finished read-ahead once there is too much of it
+  void dropUnclaimed() {
+    while (unclaimed.size() > MAX_UNCLAIMED) {
+      auto it = in_flight.find(unclaimed.front());
+      unclaimed.pop_front();
+      if (it != in_flight.end() && it->second.state != State::WRITING &&
+          it->second.state != State::READING) {
+        in_flight.erase(it);
+      }
+    }
+  }
+};
+
+// Stream buffer for writing a new file in batches of BATCH_SIZE bytes,
+// each written on a thread of its own while the next one is filled, so a
+// checkpoint formats blocks while the ones before go to disk
+class BatchedFileBuffer : public std::streambuf {
+public:
+  static constexpr size_t BATCH_SIZE = 1 << 20;
+
+  explicit BatchedFileBuffer(const std::string &path)
+      : file(std::fopen(path.c_str(), "w")) {
+    if (file) {
+      std::setvbuf(file, nullptr, _IONBF, 0);
+      filling.resize(BATCH_SIZE);
+      setp(filling.data(), filling.data() + filling.size());
+    }
+  }
+
+  ~BatchedFileBuffer() override { close(); }
+
+  BatchedFileBuffer(const BatchedFileBuffer &) = delete;
+  BatchedFileBuffer &operator=(const BatchedFileBuffer &) = delete;
+
+  bool isOpen() const { return file != nullptr; }
+
+  // Write what is left and close the file. False if anything failed.
+  bool close() {
+    if (!file) {
+      return false;
+    }
+    submit();
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      done.wait(lock, [&] { return !busy; });
+      stopping = true;
+      work_ready.notify_one();
+    }
+    if (writer.joinable()) {
+      writer.join();
+    }
+    if (std::fclose(file) != 0) {
+      failed = true;
+    }
+    file = nullptr;
+    return !failed;
+  }
+
+protected:
+  int_type overflow(int_type c) override {
+    if (!file || !submit()) {
+      return traits_type::eof();
+    }
+    if (!traits_type::eq_int_type(c, traits_type::eof())) {
+      *pptr() = traits_type::to_char_type(c);
+      pbump(1);
+    }
+    return traits_type::not_eof(c);
+  }
+
+  int sync() override {
+    if (!file || !submit()) {
+      return -1;
+    }
+    std::unique_lock<std::mutex> lock(mutex);
+    done.wait(lock, [&] { return !busy; });
+    return failed ? -1 : 0;
+  }
+
+private:
+  std::FILE *file;
+  std::vector<char> filling; // Being formatted into
+  std::vector<char> writing; // Being written by `writer`
+  size_t writing_size = 0;
+  std::thread writer; // Started with the first full batch
+
+  std::mutex mutex;
+  std::condition_variable work_ready;
+  std::condition_variable done;
+  bool busy = false; // `writing` holds a batch not yet written
+  bool failed = false;
+  bool stopping = false;
+
+  // Hand the batch filled so far to the writer, once it has written the
+  // one before. False after a failed write.
+  bool submit() {
+    size_t size = static_cast<size_t>(pptr() - pbase());
+    std::unique_lock<std::mutex> lock(mutex);
+    done.wait(lock, [&] { return !busy; });
+    if (failed) {
+      return false;
+    }
+    if (size == 0) {
+      return true;
+    }
+    filling.swap(writing);
+    writing_size = size;
+    busy = true;
+    if (!writer.joinable()) {
+      writer = std::thread([this] { write(); });
+    }
+    work_ready.notify_one();
+    filling.resize(BATCH_SIZE);
+    setp(filling.data(), filling.data() + filling.size());
+    return true;
+  }
+
+  void write() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+      work_ready.wait(lock, [&] { return busy || stopping; });
+      if (!busy) {
+        return;
+      }
+      lock.unlock();
+      bool written =
+          std::fwrite(writing.data(), 1, writing_size, file) == writing_size;
+      lock.lock();
+      failed = failed || !written;
+      busy = false;
+      done.notify_all();
+    }
+  }
+};
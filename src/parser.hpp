@@ -2,15 +2,36 @@
 #include "lexer.hpp"
 #include "statement.hpp"
 #include "utils.hpp"
+#include <cstring>
 #include <memory>
+#include <stdexcept>
+#include <string_view>
 #include <vector>
 
+// Tokens and syntax tree nodes go to the arena, which the returned
+// statement refers to and which must outlive it.
 class Parser {
 public:
-  explicit Parser(const std::string &input, int start_line = 1)
-      : lexer(input, start_line), current_token(lexer.getNextToken()) {}
+  Parser(const std::string &input, Arena &arena, int start_line = 1)
+      : arena(arena), input(input), lexer(input, arena, start_line),
+        current_token(lexer.getNextToken()) {}
 
   std::unique_ptr<SQLStatement> parse() {
+    std::unique_ptr<SQLStatement> statement = parseStatement();
+    if (statement) {
+      statement->arena = &arena;
+      statement->text = input;
+    }
+    return statement;
+  }
+
+private:
+  Arena &arena;
+  std::string_view input;
+  Lexer lexer;
+  Token current_token;
+
+  std::unique_ptr<SQLStatement> parseStatement() {
     TokenType first_token = current_token.type;
     int first_token_line = current_token.line_number;
     advance();
@@ -53,6 +74,21 @@ public:
     case TokenType::DELETE:
       return parseDelete();
 
+    case TokenType::VACUUM:
+      return parseVacuum();
+
+    case TokenType::BEGIN:
+      return parseTransaction(SQLStatementType::BEGIN, first_token_line);
+
+    case TokenType::COMMIT:
+      return parseTransaction(SQLStatementType::COMMIT, first_token_line);
+
+    case TokenType::ROLLBACK:
+      return parseTransaction(SQLStatementType::ROLLBACK, first_token_line);
+
+    case TokenType::EXPLAIN:
+      return parseExplain(first_token_line);
+
     default:
       throwError("Unexpected token at start of statement", first_token_line);
     }
@@ -62,11 +98,7 @@ public:
     return nullptr;
   }
 
-private:
-  Lexer lexer;
-  Token current_token;
-
-  void throwError(const std::string& message, int line_number = -1) {
+  [[noreturn]] void throwError(const std::string& message, int line_number = -1) {
     throw ParseError(message, line_number == -1 ? current_token.line_number : line_number);
   }
 
@@ -84,41 +116,51 @@ private:
 
   bool exist(TokenType type) { return lexer.exist(type); }
 
-  std::unique_ptr<WhereCondition> parseWhereCondition() {
+  // "table.column", kept in the arena
+  std::string_view qualify(std::string_view table, std::string_view column) {
+    char *text =
+        static_cast<char *>(arena.allocate(table.size() + 1 + column.size(), 1));
+    std::memcpy(text, table.data(), table.size());
+    text[table.size()] = '.';
+    std::memcpy(text + table.size() + 1, column.data(), column.size());
+    return {text, table.size() + 1 + column.size()};
+  }
+
+  WhereCondition *parseWhereCondition() {
     return parseOrCondition();  // Start with lowest precedence (OR)
   }
 
-  std::unique_ptr<WhereCondition> parseOrCondition() {
+  WhereCondition *parseOrCondition() {
     auto left = parseAndCondition();
     
     while (match(TokenType::OR)) {
         advance();  // Consume OR token
-        auto node = std::make_unique<WhereCondition>(WhereCondition::NodeType::OPERATOR);
+        auto node = arena.create<WhereCondition>(WhereCondition::NodeType::OPERATOR);
         node->logic_operator = TokenType::OR;
-        node->left = std::move(left);
+        node->left = left;
         node->right = parseAndCondition();
-        left = std::move(node);
+        left = node;
     }
     
     return left;
   }
 
-  std::unique_ptr<WhereCondition> parseAndCondition() {
+  WhereCondition *parseAndCondition() {
     auto left = parseAtomicCondition();
     
     while (match(TokenType::AND)) {
         advance();  // Consume AND token
-        auto node = std::make_unique<WhereCondition>(WhereCondition::NodeType::OPERATOR);
+        auto node = arena.create<WhereCondition>(WhereCondition::NodeType::OPERATOR);
         node->logic_operator = TokenType::AND;
-        node->left = std::move(left);
+        node->left = left;
         node->right = parseAtomicCondition();
-        left = std::move(node);
+        left = node;
     }
     
     return left;
   }
 
-  std::unique_ptr<WhereCondition> parseAtomicCondition() {
+  WhereCondition *parseAtomicCondition() {
     if (match(TokenType::LEFT_PAREN)) {
         advance();  // Consume left parenthesis
         auto condition = parseOrCondition();  // Recursively parse nested expression
@@ -129,10 +171,10 @@ private:
     }
     
     // Parse a leaf condition (column comparison)
-    auto node = std::make_unique<WhereCondition>(WhereCondition::NodeType::LEAF);
+    auto node = arena.create<WhereCondition>(WhereCondition::NodeType::LEAF);
     
     // Parse column name (with optional table prefix)
-    std::string first_part = current_token.value;
+    std::string_view first_part = current_token.value;
     if (!consume(TokenType::IDENTIFIER)) {
         throwError("Expected column name or table name");
     }
@@ -140,11 +182,11 @@ private:
     // Check for table.column format
     if (match(TokenType::DOT)) {
         consume(TokenType::DOT);
-        std::string second_part = current_token.value;
+        std::string_view second_part = current_token.value;
         if (!consume(TokenType::IDENTIFIER)) {
             throwError("Expected column name after dot");
         }
-        node->column_name = first_part + "." + second_part;
+        node->column_name = qualify(first_part, second_part);
     } else {
         node->column_name = first_part;
     }
@@ -162,11 +204,11 @@ private:
         // Check for table.column format
         if (match(TokenType::DOT)) {
             consume(TokenType::DOT);
-            std::string second_part = current_token.value;
+            std::string_view second_part = current_token.value;
             if (!consume(TokenType::IDENTIFIER)) {
                 throwError("Expected column name after dot");
             }
-            node->value = Token(TokenType::IDENTIFIER, first_part + "." + second_part);
+            node->value = Token(TokenType::IDENTIFIER, qualify(first_part, second_part));
         } else {
             node->value = Token(TokenType::IDENTIFIER, first_part);
         }
@@ -209,7 +251,7 @@ private:
       throwError("Expected LEFT_PAREN after CREATE TABLE");
     }
     do {
-      std::string column_name = current_token.value;
+      std::string column_name(current_token.value);
       if (!consume(TokenType::IDENTIFIER)) {
         throwError("Expected column name after LEFT_PAREN");
       }
@@ -241,6 +283,39 @@ private:
     return statement;
   }
 
+  std::unique_ptr<VacuumStatement> parseVacuum() {
+    auto statement = std::make_unique<VacuumStatement>();
+    statement->line_number = current_token.line_number;
+    statement->table_name = current_token.value;
+    if (!consume(TokenType::IDENTIFIER)) {
+      throwError("Expected table name after VACUUM");
+    }
+
+    return statement;
+  }
+
+  std::unique_ptr<TransactionStatement> parseTransaction(SQLStatementType type,
+                                                         int line) {
+    auto statement = std::make_unique<TransactionStatement>(type);
+    statement->line_number = line;
+    return statement;
+  }
+
+  std::unique_ptr<ExplainStatement> parseExplain(int line) {
+    auto statement = std::make_unique<ExplainStatement>();
+    statement->line_number = line;
+    statement->analyze = consume(TokenType::ANALYZE);
+    if (!match(TokenType::SELECT) && !match(TokenType::INSERT) &&
+        !match(TokenType::UPDATE) && !match(TokenType::DELETE)) {
+      throwError("Expected SELECT, INSERT, UPDATE or DELETE after EXPLAIN");
+    }
+    statement->statement = parseStatement();
+    // A change it makes is logged, and replayed, as the EXPLAIN ANALYZE
+    statement->statement->arena = &arena;
+    statement->statement->text = input;
+    return statement;
+  }
+
   std::unique_ptr<InsertStatement> parseInsert() {
     auto statement = std::make_unique<InsertStatement>();
     statement->line_number = current_token.line_number;
@@ -266,7 +341,7 @@ private:
             "Expected STRING_LITERAL, INTEGER_LITERAL, or FLOAT_LITERAL "
             "after LEFT_PAREN, got " +
                 TOKEN_STR.find(current_token.type)->second + ": " +
-                current_token.value);
+                std::string(current_token.value));
       }
     } while (consume(TokenType::COMMA));
     if (!consume(TokenType::RIGHT_PAREN)) {
@@ -282,7 +357,7 @@ private:
     consume(TokenType::ASTERISK);
     if (!match(TokenType::FROM)) {
       do {
-        statement->columns.push_back(current_token.value);
+        statement->columns.emplace_back(current_token.value);
         if (!consume(TokenType::IDENTIFIER)) {
           throwError("Expected column name after SELECT");
         }
@@ -298,10 +373,27 @@ private:
     if (consume(TokenType::WHERE)) {
       statement->where_condition = parseWhereCondition();
     }
+    if (consume(TokenType::LIMIT)) {
+      statement->limit = parseLimit();
+    }
 
     return statement;
   }
 
+  // Parse the row count following LIMIT
+  int parseLimit() {
+    Token token = current_token;
+    if (!consume(TokenType::INTEGER_LITERAL) || token.value[0] == '-') {
+      throwError("Expected non-negative integer after LIMIT");
+    }
+    try {
+      return std::stoi(std::string(token.value));
+    } catch (const std::out_of_range &) {
+      throwError("Expected non-negative integer after LIMIT",
+                 token.line_number);
+    }
+  }
+
   std::unique_ptr<UpdateStatement> parseUpdate() {
     auto statement = std::make_unique<UpdateStatement>();
     statement->line_number = current_token.line_number;
@@ -361,18 +453,18 @@ private:
 
     // Parse selected columns
     do {
-      std::string table_name = current_token.value;
+      std::string_view table_name = current_token.value;
       if (!consume(TokenType::IDENTIFIER)) {
         throwError("Expected table name after SELECT");
       }
       if (!consume(TokenType::DOT)) {
         throwError("Expected DOT after table name");
       }
-      std::string column_name = current_token.value;
+      std::string_view column_name = current_token.value;
       if (!consume(TokenType::IDENTIFIER)) {
         throwError("Expected column name after DOT");
       }
-      statement->selected_columns.push_back(table_name + "." + column_name);
+      statement->selected_columns.emplace_back(qualify(table_name, column_name));
     } while (consume(TokenType::COMMA));
 
     // Parse FROM clause
@@ -381,7 +473,7 @@ private:
     }
 
     // Parse first table
-    statement->tables.push_back(current_token.value);
+    statement->tables.emplace_back(current_token.value);
     if (!consume(TokenType::IDENTIFIER)) {
       throwError("Expected table name after FROM");
     }
@@ -393,7 +485,7 @@ private:
       }
 
       // Get the next table name
-      statement->tables.push_back(current_token.value);
+      statement->tables.emplace_back(current_token.value);
       if (!consume(TokenType::IDENTIFIER)) {
         throwError("Expected table name after JOIN");
       }
@@ -404,14 +496,14 @@ private:
       }
 
       // Parse join condition
-      std::string table_name_a = current_token.value;
+      std::string_view table_name_a = current_token.value;
       if (!consume(TokenType::IDENTIFIER)) {
         throwError("Expected table name");
       }
       if (!consume(TokenType::DOT)) {
         throwError("Expected DOT after table name");
       }
-      std::string column_name_a = current_token.value;
+      std::string_view column_name_a = current_token.value;
       if (!consume(TokenType::IDENTIFIER)) {
         throwError("Expected column name after DOT");
       }
@@ -425,22 +517,22 @@ private:
       statement->join_operators.push_back(operator_type);
 
       // Parse second part of condition
-      std::string table_name_b = current_token.value;
+      std::string_view table_name_b = current_token.value;
       if (!consume(TokenType::IDENTIFIER)) {
         throwError("Expected table name");
       }
       if (!consume(TokenType::DOT)) {
         throwError("Expected DOT after table name");
       }
-      std::string column_name_b = current_token.value;
+      std::string_view column_name_b = current_token.value;
       if (!consume(TokenType::IDENTIFIER)) {
         throwError("Expected column name after DOT");
       }
 
       // Add join condition
       statement->join_conditions.emplace_back(
-          table_name_a + "." + column_name_a,
-          table_name_b + "." + column_name_b);
+          qualify(table_name_a, column_name_a),
+          qualify(table_name_b, column_name_b));
     }
 
     // Parse optional WHERE clause
@@ -448,15 +540,20 @@ private:
       statement->where_condition = parseWhereCondition();
     }
 
+    // Parse optional LIMIT clause
+    if (consume(TokenType::LIMIT)) {
+      statement->limit = parseLimit();
+    }
+
     return statement;
   }
 
   // Parse arithmetic expressions using recursive descent
-  std::unique_ptr<ExpressionNode> parseExpression() {
+  ExpressionNode *parseExpression() {
     return parseAdditive();
   }
 
-  std::unique_ptr<ExpressionNode> parseAdditive() {
+  ExpressionNode *parseAdditive() {
     auto left = parseMultiplicative();
     
     while (match(TokenType::PLUS) || match(TokenType::MINUS)) {
@@ -464,16 +561,16 @@ private:
       advance();
       auto right = parseMultiplicative();
       
-      auto node = std::make_unique<ExpressionNode>(ExprNodeType::OPERATOR, op);
-      node->children.push_back(std::move(left));
-      node->children.push_back(std::move(right));
-      left = std::move(node);
+      auto node = arena.create<ExpressionNode>(ExprNodeType::OPERATOR, op);
+      node->addChild(left);
+      node->addChild(right);
+      left = node;
     }
     
     return left;
   }
 
-  std::unique_ptr<ExpressionNode> parseMultiplicative() {
+  ExpressionNode *parseMultiplicative() {
     auto left = parsePrimary();
     
     while (match(TokenType::ASTERISK)) {
@@ -481,24 +578,24 @@ private:
       advance();
       auto right = parsePrimary();
       
-      auto node = std::make_unique<ExpressionNode>(ExprNodeType::OPERATOR, op);
-      node->children.push_back(std::move(left));
-      node->children.push_back(std::move(right));
-      left = std::move(node);
+      auto node = arena.create<ExpressionNode>(ExprNodeType::OPERATOR, op);
+      node->addChild(left);
+      node->addChild(right);
+      left = node;
     }
     
     return left;
   }
 
-  std::unique_ptr<ExpressionNode> parsePrimary() {
+  ExpressionNode *parsePrimary() {
     if (match(TokenType::LEFT_PAREN)) {
       advance();
       auto expr = parseExpression();
       if (!consume(TokenType::RIGHT_PAREN)) {
         throwError("Expected closing parenthesis");
       }
-      auto node = std::make_unique<ExpressionNode>(ExprNodeType::PARENTHESIS, Token());
-      node->children.push_back(std::move(expr));
+      auto node = arena.create<ExpressionNode>(ExprNodeType::PARENTHESIS, Token());
+      node->addChild(expr);
       return node;
     }
     
@@ -506,7 +603,7 @@ private:
     if (consume(TokenType::IDENTIFIER) || 
         consume(TokenType::INTEGER_LITERAL) || 
         consume(TokenType::FLOAT_LITERAL)) {
-      return std::make_unique<ExpressionNode>(ExprNodeType::VALUE, token);
+      return arena.create<ExpressionNode>(ExprNodeType::VALUE, token);
     }
     
     throwError("Expected expression");
@@ -0,0 +1,151 @@
+#pragma once
+#include "parser.hpp"
+#include "statement.hpp"
+#include "utils.hpp"
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Parses the statements of a script ahead of running them, on threads of
+// its own, so that running them does not wait on the parser. Parsing does
+// not look at any database, so it can go on while earlier statements run.
+// Statements come out in order. An error parsing one is thrown once it is
+// reached, after the statements before it have run, as if each statement
+// were parsed just before running it.
+//
+// Without threads each statement is parsed when it is asked for. The
+// statements taken are given back in the same order with release(), up to
+// `held` of them being kept at once.
+class StatementPipeline {
+public:
+  // Statements parsed ahead of the one running, at most
+  static constexpr size_t DEPTH = 16;
+
+  StatementPipeline(const std::vector<Statement> &statements,
+                    unsigned threads, size_t held = 1)
+      : statements(statements), slots(threads == 0 ? held : DEPTH) {
+    threads = std::min<size_t>(threads, statements.size());
+    for (unsigned i = 0; i < threads; i++) {
+      workers.emplace_back([this] { parseAhead(); });
+    }
+  }
+
+  ~StatementPipeline() {
+    {
+      std::lock_guard<std::mutex> guard(lock);
+      stopping = true;
+    }
+    space.notify_all();
+    for (auto &worker : workers) {
+      worker.join();
+    }
+  }
+
+  StatementPipeline(const StatementPipeline &) = delete;
+  StatementPipeline &operator=(const StatementPipeline &) = delete;
+
+  // False once every statement was taken. `statement` is left null for an
+  // empty statement, and is valid until it is released.
+  bool next(SQLStatement *&statement) {
+    if (taken == statements.size()) {
+      return false;
+    }
+    Slot &slot = slots[taken % slots.size()];
+    if (workers.empty()) {
+      parse(taken, slot);
+    } else {
+      std::unique_lock<std::mutex> guard(lock);
+      if (!slot.parsed) {
+        waiting = true;
+        ready.wait(guard, [&] { return slot.parsed; });
+        waiting = false;
+      }
+      slot.parsed = false;
+    }
+    taken++;
+    if (slot.error) {
+      std::rethrow_exception(slot.error);
+    }
+    statement = slot.statement.get();
+    return true;
+  }
+
+  // Done with the oldest statement taken, and with its arena
+  void release() {
+    slots[released % slots.size()].statement.reset();
+    if (workers.empty()) {
+      released++;
+      return;
+    }
+    std::lock_guard<std::mutex> guard(lock);
+    released++;
+    if (workers_waiting > 0) {
+      space.notify_all();
+    }
+  }
+
+private:
+  // Where a statement is parsed to. Each has an arena of its own, reused
+  // for the statements after it in turn.
+  struct Slot {
+    Arena arena;
+    std::unique_ptr<SQLStatement> statement;
+    std::exception_ptr error;
+    bool parsed = false; // Waiting to be taken
+  };
+
+  const std::vector<Statement> &statements;
+  std::vector<Slot> slots;
+  std::vector<std::thread> workers;
+  size_t taken = 0; // Statements handed out by next()
+  size_t released = 0; // Given back, changed under the lock with workers
+
+  // Guards what follows, and the parsed flags
+  std::mutex lock;
+  std::condition_variable ready; // A statement was parsed
+  std::condition_variable space; // A slot was released, or stopping
+  size_t claimed = 0;            // Statements a worker started parsing
+  bool stopping = false;
+  // Who waits on the conditions, so as not to notify nobody
+  bool waiting = false;
+  size_t workers_waiting = 0;
+
+  void parse(size_t i, Slot &slot) {
+    slot.arena.reset();
+    slot.error = nullptr;
+    try {
+      slot.statement = Parser(statements[i].content, slot.arena,
+                              statements[i].start_line)
+                           .parse();
+    } catch (...) {
+      slot.error = std::current_exception();
+    }
+  }
+
+  void parseAhead() {
+    std::unique_lock<std::mutex> guard(lock);
+    while (true) {
+      workers_waiting++;
+      space.wait(guard, [&] {
+        return stopping || claimed == statements.size() ||
+               claimed < released + slots.size();
+      });
+      workers_waiting--;
+      if (stopping || claimed == statements.size()) {
+        return;
+      }
+      size_t i = claimed++;
+      Slot &slot = slots[i % slots.size()];
+      guard.unlock();
+      parse(i, slot);
+      guard.lock();
+      slot.parsed = true;
+      if (waiting) {
+        ready.notify_one();
+      }
+    }
+  }
+};
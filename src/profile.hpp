@@ -0,0 +1,160 @@
+#pragma once
+#include "output.hpp"
+#include "utils.hpp"
+#include <chrono>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// The operators a statement runs as, listed by EXPLAIN, and what each of
+// them did, measured by EXPLAIN ANALYZE. Operators are listed from the one
+// producing the statement's result down to the scans feeding it, each
+// indented under the operator it feeds.
+//
+// Time is charged to one operator at a time, the one working on the row
+// at hand, so an operator's time leaves out that of the operators feeding
+// it. Rows are handed from one operator to the next one by one, and each
+// hand-off reads the clock; the timings include the cost of that.
+class QueryProfile {
+public:
+  static constexpr size_t NO_OPERATOR = SIZE_MAX;
+
+  struct Operator {
+    std::string name;
+    std::string detail; // What it reads and how
+    int depth = 0;      // Operators it is under
+    uint64_t rows_in = 0;
+    uint64_t rows_out = 0;
+    uint64_t bytes = 0; // Allocated for its own state
+    std::chrono::steady_clock::duration time{};
+  };
+
+  explicit QueryProfile(bool analyze) : analyze(analyze) {}
+
+  // Whether the statement runs, rather than only being planned
+  bool analyzing() const { return analyze; }
+
+  size_t add(std::string name, std::string detail, int depth) {
+    operators.push_back({std::move(name), std::move(detail), depth});
+    return operators.size() - 1;
+  }
+
+  Operator &at(size_t op) { return operators[op]; }
+
+  // Charge the time from now on to `op`, returning the operator charged
+  // until now
+  size_t enter(size_t op) {
+    auto now = std::chrono::steady_clock::now();
+    if (current != NO_OPERATOR) {
+      operators[current].time += now - since;
+    }
+    since = now;
+    size_t previous = current;
+    current = op;
+    return previous;
+  }
+
+  // One row per operator. Selectivity is the fraction of the rows in that
+  // came out.
+  void write(OutputWriter &out) const {
+    std::vector<ColumnDefinition> columns = {
+        {"operator", TokenType::TEXT}, {"detail", TokenType::TEXT}};
+    if (analyze) {
+      columns.insert(columns.end(), {{"rows_in", TokenType::INTEGER},
+                                     {"rows_out", TokenType::INTEGER},
+                                     {"selectivity", TokenType::FLOAT},
+                                     {"time_ms", TokenType::FLOAT},
+                                     {"bytes", TokenType::INTEGER}});
+    }
+    out.beginResult(columns);
+    std::vector<Value> row;
+    for (const Operator &op : operators) {
+      std::string name = std::string(2 * op.depth, ' ') + op.name;
+      row = {Value(std::string_view(name)), Value(std::string_view(op.detail))};
+      if (analyze) {
+        row.push_back(count(op.rows_in));
+        row.push_back(count(op.rows_out));
+        row.push_back(op.rows_in == 0 ? 0.0
+                                      : static_cast<double>(op.rows_out) /
+                                            op.rows_in);
+        row.push_back(
+            std::chrono::duration<double, std::milli>(op.time).count());
+        row.push_back(count(op.bytes));
+      }
+      out.writeRow(row);
+    }
+    out.endResult();
+  }
+
+private:
+  bool analyze;
+  std::vector<Operator> operators;
+  size_t current = NO_OPERATOR;
+  std::chrono::steady_clock::time_point since;
+
+  static Value count(uint64_t n) {
+    return static_cast<int>(std::min<uint64_t>(n, INT_MAX));
+  }
+};
+
+// Charges the time spent in its scope to one operator of a profile, if
+// there is one, and the time after it to the operator charged before
+class OperatorTimer {
+public:
+  OperatorTimer(QueryProfile *profile, size_t op) : profile(profile) {
+    if (profile) {
+      outer = profile->enter(op);
+    }
+  }
+  ~OperatorTimer() {
+    if (profile) {
+      profile->enter(outer);
+    }
+  }
+
+  OperatorTimer(const OperatorTimer &) = delete;
+  OperatorTimer &operator=(const OperatorTimer &) = delete;
+
+  // The operator charged before, which the rows go to
+  size_t previous() const { return outer; }
+
+private:
+  QueryProfile *profile;
+  size_t outer = QueryProfile::NO_OPERATOR;
+};
+
+inline const char *comparisonText(TokenType op) {
+  switch (op) {
+  case TokenType::EQUALS:
+    return "=";
+  case TokenType::INEQUALS:
+    return "!=";
+  case TokenType::GREATER_THAN:
+    return ">";
+  default:
+    return "<";
+  }
+}
+
+// A WHERE condition as written, for EXPLAIN
+inline std::string conditionText(const WhereCondition *condition) {
+  if (condition->type == WhereCondition::NodeType::OPERATOR) {
+    auto side = [&](const WhereCondition *child) {
+      std::string text = conditionText(child);
+      bool nested = child->type == WhereCondition::NodeType::OPERATOR &&
+                    child->logic_operator != condition->logic_operator;
+      return nested ? "(" + text + ")" : text;
+    };
+    return side(condition->left) +
+           (condition->logic_operator == TokenType::AND ? " AND " : " OR ") +
+           side(condition->right);
+  }
+  std::string value(condition->value.value);
+  if (condition->value.type == TokenType::STRING_LITERAL) {
+    value = "'" + value + "'";
+  }
+  return std::string(condition->column_name) + " " +
+         comparisonText(condition->condition_type) + " " + value;
+}
@@ -0,0 +1,53 @@
+#pragma once
+#include "buffer_pool.hpp"
+#include "utils.hpp"
+#include <algorithm>
+
+// Memory held by one statement's intermediate state, such as join hash
+// tables and the buffers of partitioned joins. It is checked against the
+// statement's own limit and, through the buffer pool, against the global
+// memory limit it shares with table data. Everything still held is given
+// back when the statement ends.
+class QueryMemory {
+public:
+  QueryMemory(BufferPool &pool, size_t limit = BufferPool::UNLIMITED,
+              int line = 0)
+      : pool(pool), limit(limit), line(line) {}
+  ~QueryMemory() { pool.unreserve(used); }
+
+  QueryMemory(const QueryMemory &) = delete;
+  QueryMemory &operator=(const QueryMemory &) = delete;
+
+  // False if either limit would be exceeded, for callers that can spill
+  bool tryReserve(size_t bytes) {
+    if (bytes > limit - used || !pool.reserve(bytes)) {
+      return false;
+    }
+    used += bytes;
+    peak = std::max(peak, used);
+    return true;
+  }
+
+  void reserve(size_t bytes) {
+    if (!tryReserve(bytes)) {
+      throw TableError("Statement exceeds the memory limit", line);
+    }
+  }
+
+  void release(size_t bytes) {
+    used -= bytes;
+    pool.unreserve(bytes);
+  }
+
+  // What the statement's own limit still allows
+  size_t availableBytes() const { return limit - used; }
+
+  size_t peakBytes() const { return peak; }
+
+private:
+  BufferPool &pool;
+  size_t limit;
+  int line;
+  size_t used = 0;
+  size_t peak = 0;
+};
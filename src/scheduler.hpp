@@ -0,0 +1,321 @@
+#pragma once
+#include "output.hpp"
+#include "statement.hpp"
+#include "utils.hpp"
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// The tables of the current database a statement reads and changes. One
+// that changes anything else, such as the session, the databases or the
+// table list, or that moves rows, is a barrier instead: nothing may run
+// alongside it.
+struct StatementAccess {
+  bool barrier = false;
+  std::vector<std::string> reads;
+  std::vector<std::string> writes;
+
+  bool changes() const { return barrier || !writes.empty(); }
+
+  // Whether the two have to run one after the other
+  bool conflicts(const StatementAccess &other) const {
+    if (barrier || other.barrier) {
+      return true;
+    }
+    auto touches = [](const StatementAccess &access,
+                      const std::string &table) {
+      return std::count(access.reads.begin(), access.reads.end(), table) ||
+             std::count(access.writes.begin(), access.writes.end(), table);
+    };
+    for (const auto &table : writes) {
+      if (touches(other, table)) {
+        return true;
+      }
+    }
+    for (const auto &table : other.writes) {
+      if (touches(*this, table)) {
+        return true;
+      }
+    }
+    return false;
+  }
+};
+
+inline StatementAccess analyzeAccess(const SQLStatement &stmt) {
+  StatementAccess access;
+  switch (stmt.type) {
+  case SQLStatementType::INSERT:
+    access.writes.push_back(
+        static_cast<const InsertStatement &>(stmt).table_name);
+    break;
+  case SQLStatementType::UPDATE:
+    access.writes.push_back(
+        static_cast<const UpdateStatement &>(stmt).table_name);
+    break;
+  case SQLStatementType::DELETE:
+    access.writes.push_back(
+        static_cast<const DeleteStatement &>(stmt).table_name);
+    break;
+  case SQLStatementType::SELECT:
+    access.reads.push_back(
+        static_cast<const SelectStatement &>(stmt).table_name);
+    break;
+  case SQLStatementType::INNER_JOIN:
+    access.reads = static_cast<const InnerJoinStatement &>(stmt).tables;
+    break;
+  case SQLStatementType::EXPLAIN: {
+    // That of the statement explained, which only reads unless it runs
+    const auto &explain = static_cast<const ExplainStatement &>(stmt);
+    access = analyzeAccess(*explain.statement);
+    if (!explain.analyze) {
+      access.reads.insert(access.reads.end(), access.writes.begin(),
+                          access.writes.end());
+      access.writes.clear();
+    }
+    break;
+  }
+  default:
+    access.barrier = true;
+    break;
+  }
+  return access;
+}
+
+// Runs the statements of a script on several threads, with the results of
+// running them one by one. A statement starts once those before it that
+// it conflicts with are done, so statements on different tables run at
+// once. A failing statement has to leave those after it unrun: reads
+// have no effect to undo, while a change started ahead of earlier ones
+// is given a Turn to wait for them, and keeps its effects to itself
+// until they succeed. With nothing left to overlap it with, a change runs
+// on the submitting thread in its turn, sparing the hand-off to a worker
+// and back.
+//
+// The first statement not done writes its results straight to the output;
+// those after it keep theirs until it is their turn, so results come out
+// in script order. The error thrown is that of the first statement to
+// fail, once the statements before it are done.
+class StatementScheduler {
+  struct Job;
+
+public:
+  // The place in the script of a change started ahead of its turn
+  class Turn {
+  public:
+    // Wait until the statements before it are done, and return whether
+    // they all succeeded. Also returns, with false, once `give_up` holds
+    // after a wake().
+    bool await(const std::function<bool()> &give_up = nullptr) const {
+      std::unique_lock<std::mutex> guard(scheduler.lock);
+      while (true) {
+        if (scheduler.failed || scheduler.stopping ||
+            (give_up && give_up())) {
+          return false;
+        }
+        bool done = true;
+        for (const auto &job : scheduler.jobs) {
+          if (job.get() == &self) {
+            break;
+          }
+          if (job->done && job->error) {
+            return false;
+          }
+          done = done && job->done;
+        }
+        if (done) {
+          return true;
+        }
+        scheduler.job_done.wait(guard);
+      }
+    }
+
+    // Have await() check `give_up` again
+    void wake() const {
+      std::lock_guard<std::mutex> guard(scheduler.lock);
+      scheduler.job_done.notify_all();
+    }
+
+  private:
+    friend class StatementScheduler;
+
+    Turn(StatementScheduler &scheduler, const StatementScheduler::Job &self)
+        : scheduler(scheduler), self(self) {}
+
+    StatementScheduler &scheduler;
+    const StatementScheduler::Job &self;
+  };
+
+  // Runs the statement on a worker, writing its results to the writer
+  // given, and returns its peak memory. A change is given its Turn if it
+  // may run ahead of it, and none otherwise.
+  using Work = std::function<size_t(OutputWriter &, const Turn *)>;
+  // Called in order on the submitting thread once the statement succeeded,
+  // with its peak memory
+  using Finish = std::function<void(size_t)>;
+
+  StatementScheduler(unsigned threads, size_t window, OutputWriter &out)
+      : window(window), out(out) {
+    for (unsigned i = 0; i < threads; i++) {
+      workers.emplace_back([this] { runJobs(); });
+    }
+  }
+
+  // Statements not started yet are dropped
+  ~StatementScheduler() {
+    {
+      std::lock_guard<std::mutex> guard(lock);
+      stopping = true;
+    }
+    work_ready.notify_all();
+    job_done.notify_all();
+    for (auto &worker : workers) {
+      worker.join();
+    }
+  }
+
+  StatementScheduler(const StatementScheduler &) = delete;
+  StatementScheduler &operator=(const StatementScheduler &) = delete;
+
+  // Start a statement once it may, with no more than `window` of them
+  // unfinished. Without work, it only finishes in its turn.
+  void submit(StatementAccess access, Work work, Finish finish) {
+    auto job = std::make_unique<Job>();
+    job->access = std::move(access);
+    job->work = std::move(work);
+    job->finish = std::move(finish);
+    std::unique_lock<std::mutex> guard(lock);
+    while (true) {
+      finishDone(guard);
+      if (jobs.size() < window && mayStart(job->access)) {
+        break;
+      }
+      waitForJob(guard);
+    }
+    if (job->access.changes() && job->work && jobs.empty()) {
+      guard.unlock();
+      size_t peak_bytes = job->work(out, nullptr);
+      if (job->finish) {
+        job->finish(peak_bytes);
+      }
+      return;
+    }
+    job->direct = jobs.empty();
+    job->done = !job->work;
+    Job *started = jobs.emplace_back(std::move(job)).get();
+    if (!started->done) {
+      runnable.push_back(started);
+      work_ready.notify_one();
+    }
+  }
+
+  // Wait for every statement submitted
+  void drain() {
+    std::unique_lock<std::mutex> guard(lock);
+    while (true) {
+      finishDone(guard);
+      if (jobs.empty()) {
+        return;
+      }
+      waitForJob(guard);
+    }
+  }
+
+private:
+  struct Job {
+    StatementAccess access;
+    Work work;
+    Finish finish;
+    bool direct = false; // Writing to the output itself
+    ResultBuffer results;
+    bool done = false;
+    std::exception_ptr error;
+    size_t peak_bytes = 0;
+  };
+
+  size_t window;
+  OutputWriter &out;
+  std::vector<std::thread> workers;
+
+  // Guards what follows
+  std::mutex lock;
+  std::condition_variable work_ready; // A job to run, or stopping
+  std::condition_variable job_done;
+  std::deque<std::unique_ptr<Job>> jobs; // Not finished, in script order
+  std::deque<Job *> runnable;            // Not started
+  bool stopping = false;
+  bool failed = false; // A statement's error was thrown
+
+  bool mayStart(const StatementAccess &access) const {
+    for (const auto &job : jobs) {
+      if (!job->done && job->access.conflicts(access)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Finish the jobs done at the front, throwing the error of a failed one
+  void finishDone(std::unique_lock<std::mutex> &guard) {
+    while (!jobs.empty() && jobs.front()->done) {
+      std::unique_ptr<Job> job = std::move(jobs.front());
+      jobs.pop_front();
+      if (job->error) {
+        failed = true;
+        job_done.notify_all();
+        std::rethrow_exception(job->error);
+      }
+      guard.unlock();
+      if (!job->direct) {
+        job->results.writeTo(out);
+      }
+      if (job->finish) {
+        job->finish(job->peak_bytes);
+      }
+      guard.lock();
+    }
+  }
+
+  // Run a job not started yet, rather than wait idle for the workers
+  void waitForJob(std::unique_lock<std::mutex> &guard) {
+    if (runnable.empty()) {
+      job_done.wait(guard);
+    } else {
+      runFirst(guard);
+    }
+  }
+
+  void runFirst(std::unique_lock<std::mutex> &guard) {
+    Job *job = runnable.front();
+    runnable.pop_front();
+    guard.unlock();
+    Turn turn(*this, *job);
+    try {
+      job->peak_bytes = job->work(
+          job->direct ? out : static_cast<OutputWriter &>(job->results),
+          job->access.changes() ? &turn : nullptr);
+    } catch (...) {
+      job->error = std::current_exception();
+    }
+    guard.lock();
+    job->done = true;
+    job_done.notify_all();
+  }
+
+  void runJobs() {
+    std::unique_lock<std::mutex> guard(lock);
+    while (true) {
+      work_ready.wait(guard, [&] { return stopping || !runnable.empty(); });
+      if (stopping) {
+        return;
+      }
+      runFirst(guard);
+    }
+  }
+};
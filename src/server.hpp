@@ -0,0 +1,587 @@
+#pragma once
+// The server is built on epoll, signalfd and eventfd, so it is only
+// available on Linux; elsewhere --serve and --client are rejected
+#ifdef __linux__
+#include "output.hpp"
+#include "session.hpp"
+#include "utils.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <csignal>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/signalfd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <thread>
+#include <unistd.h>
+#include <unordered_map>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+// Server mode
+//-----------------------------------------------------------------------------
+
+// Messages between the server and its clients are a 64-bit length followed
+// by that many bytes, in host byte order since both ends share a machine.
+// A request holds the output format, a flags byte and the script, and may
+// be at most MAX_REQUEST_SIZE bytes. The server answers it with any number
+// of OUTPUT messages, each a chunk of the output sent as soon as it is
+// written, then a DONE message holding the exit status followed by
+// whatever the command line would have printed to standard error.
+enum RequestFlag : uint8_t { PRINT_STATS = 1 };
+enum ReplyKind : uint8_t { OUTPUT, DONE };
+
+constexpr uint64_t MAX_REQUEST_SIZE = uint64_t{64} << 20;
+
+inline void appendUint64(std::string &out, uint64_t value) {
+  out.append(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+inline uint64_t readUint64(const char *data) {
+  uint64_t value;
+  std::memcpy(&value, data, sizeof(value));
+  return value;
+}
+
+inline sockaddr_un socketAddress(const std::string &path) {
+  sockaddr_un address{};
+  address.sun_family = AF_UNIX;
+  if (path.size() >= sizeof(address.sun_path)) {
+    throw ArgumentError("Socket path too long: " + path);
+  }
+  std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+  return address;
+}
+
+// Keeps the databases loaded and runs scripts sent by clients over a Unix
+// domain socket, each client in a session of its own. One thread serves
+// all clients from an epoll loop, reading requests and writing replies
+// without blocking as the sockets allow. Complete requests are run by a
+// pool of worker threads, one request per client at a time, so that
+// clients run concurrently while each client's scripts run in order; the
+// locks in Database keep their statements apart. Output goes out as it is
+// written, and a worker waits while too much of it is still unsent, so a
+// large result is never held whole in memory. SIGINT or SIGTERM stops
+// the loop once the requests under way have finished, after which the
+// databases are saved as usual.
+class Server {
+public:
+  // Signals are blocked here, before any other thread starts, so that
+  // they reach the loop instead of killing the process unsaved
+  Server(const std::string &socket_path, DatabaseMap &databases,
+         BufferPool &pool, const std::string &data_dir,
+         const SessionOptions &options)
+      : socket_path(socket_path), databases(databases), pool(pool),
+        data_dir(data_dir), options(options) {
+    sigset_t signals;
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGINT);
+    sigaddset(&signals, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+    signal_fd = ::signalfd(-1, &signals, SFD_NONBLOCK | SFD_CLOEXEC);
+    wake_fd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    epoll_fd = ::epoll_create1(EPOLL_CLOEXEC);
+    if (signal_fd < 0 || wake_fd < 0 || epoll_fd < 0) {
+      throw FileError("Failed to set up the server");
+    }
+    listen_fd = listenOn(socket_path);
+    watch(signal_fd, EPOLLIN);
+    watch(wake_fd, EPOLLIN);
+    watch(listen_fd, EPOLLIN);
+  }
+
+  ~Server() {
+    stopWorkers();
+    connections.clear();
+    for (int fd : {listen_fd, signal_fd, wake_fd, epoll_fd}) {
+      if (fd >= 0) {
+        ::close(fd);
+      }
+    }
+    if (listen_fd >= 0) {
+      ::unlink(socket_path.c_str());
+    }
+  }
+
+  Server(const Server &) = delete;
+  Server &operator=(const Server &) = delete;
+
+  // Serve until SIGINT or SIGTERM
+  void run() {
+    unsigned threads =
+        std::max(MIN_WORKERS, std::thread::hardware_concurrency());
+    for (unsigned i = 0; i < threads; i++) {
+      workers.emplace_back([this] { work(); });
+    }
+    std::vector<epoll_event> events(64);
+    while (true) {
+      int n = ::epoll_wait(epoll_fd, events.data(),
+                           static_cast<int>(events.size()), -1);
+      if (n < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        throw FileError("Failed to wait for clients");
+      }
+      for (int i = 0; i < n; i++) {
+        int fd = events[i].data.fd;
+        if (fd == signal_fd) {
+          stopWorkers();
+          return;
+        }
+        if (fd == listen_fd) {
+          acceptClients();
+          continue;
+        }
+        if (fd == wake_fd) {
+          finishRequests();
+          continue;
+        }
+        auto it = connections.find(fd);
+        if (it == connections.end()) {
+          continue;
+        }
+        Connection &connection = *it->second;
+        bool open = true;
+        if (events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR)) {
+          open = receive(connection) && dispatch(connection);
+        }
+        if (open) {
+          open = send(connection);
+        }
+        if (!open) {
+          close(connection);
+        }
+      }
+    }
+  }
+
+private:
+  static constexpr size_t READ_SIZE = 64 * 1024;
+  // Output a worker may get ahead of the client by
+  static constexpr size_t MAX_STREAMED = 4 << 20;
+  // Requests also wait on locks and I/O, so even a single core gets a few
+  // workers and a long script does not hold up every other client
+  static constexpr unsigned MIN_WORKERS = 4;
+
+  struct Connection {
+    Connection(int fd, Server &server)
+        : fd(fd), session(server.databases, server.pool, server.data_dir,
+                          server.options, log) {}
+    ~Connection() { ::close(fd); }
+
+    int fd;
+    // Used by the worker running a request, and by nothing else meanwhile
+    std::ostringstream log; // Standard error of the current request
+    Session session;
+    std::string request;
+
+    // Guarded by the server's mutex
+    std::string streamed;   // Reply messages not yet taken by the loop
+    bool abandoned = false; // Closed, so replies are dropped
+
+    // Used by the loop thread only
+    std::string input;  // Received, not yet run requests
+    std::string output; // Reply messages being sent
+    size_t sent = 0;
+    bool writable_watched = false;
+    bool running = false; // A worker has its request
+    bool closed = false;  // Gone, dropped once its request finishes
+  };
+
+  std::string socket_path;
+  DatabaseMap &databases;
+  BufferPool &pool;
+  std::string data_dir;
+  SessionOptions options;
+  int signal_fd = -1;
+  int wake_fd = -1; // Signalled by workers as requests finish
+  int epoll_fd = -1;
+  int listen_fd = -1;
+  std::unordered_map<int, std::unique_ptr<Connection>> connections;
+
+  std::mutex mutex;
+  std::condition_variable work_ready;
+  std::condition_variable drained; // Streamed output was taken
+  std::deque<Connection *> queued;
+  std::vector<Connection *> streaming; // Have streamed output for the loop
+  std::vector<Connection *> finished;
+  std::vector<std::thread> workers;
+  bool stopping = false;
+
+  // A socket file left behind by a server that is gone is replaced; one a
+  // server still answers on is not
+  static int listenOn(const std::string &path) {
+    sockaddr_un address = socketAddress(path);
+    auto *target = reinterpret_cast<sockaddr *>(&address);
+    int fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+      throw FileError("Failed to create socket");
+    }
+    bool bound = ::bind(fd, target, sizeof(address)) == 0;
+    if (!bound && errno == EADDRINUSE) {
+      int probe = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+      bool live = ::connect(probe, target, sizeof(address)) == 0;
+      ::close(probe);
+      if (!live) {
+        ::unlink(path.c_str());
+        bound = ::bind(fd, target, sizeof(address)) == 0;
+      }
+    }
+    if (!bound || ::listen(fd, SOMAXCONN) < 0) {
+      ::close(fd);
+      throw FileError("Failed to listen on " + path);
+    }
+    return fd;
+  }
+
+  void watch(int fd, uint32_t events, int op = EPOLL_CTL_ADD) {
+    epoll_event event{};
+    event.events = events;
+    event.data.fd = fd;
+    if (::epoll_ctl(epoll_fd, op, fd, &event) < 0) {
+      throw FileError("Failed to watch socket");
+    }
+  }
+
+  void acceptClients() {
+    while (true) {
+      int fd = ::accept4(listen_fd, nullptr, nullptr,
+                         SOCK_NONBLOCK | SOCK_CLOEXEC);
+      if (fd < 0) {
+        return;
+      }
+      connections[fd] = std::make_unique<Connection>(fd, *this);
+      watch(fd, EPOLLIN);
+    }
+  }
+
+  // A connection whose request is still running keeps its descriptor, so
+  // the number is not reused, until the request finishes
+  void close(Connection &connection) {
+    if (connection.running) {
+      ::epoll_ctl(epoll_fd, EPOLL_CTL_DEL, connection.fd, nullptr);
+      connection.closed = true;
+      std::lock_guard<std::mutex> guard(mutex);
+      connection.abandoned = true;
+      drained.notify_all();
+      return;
+    }
+    connections.erase(connection.fd);
+  }
+
+  // Read what has arrived. False once the client has gone, or has sent
+  // more than a request of the largest size, counting any queued behind
+  // the one running.
+  bool receive(Connection &connection) {
+    char chunk[READ_SIZE];
+    while (true) {
+      ssize_t n = ::recv(connection.fd, chunk, sizeof(chunk), 0);
+      if (n > 0) {
+        connection.input.append(chunk, static_cast<size_t>(n));
+        if (connection.input.size() > sizeof(uint64_t) + MAX_REQUEST_SIZE) {
+          return false;
+        }
+        continue;
+      }
+      if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+        return true;
+      }
+      if (n < 0 && errno == EINTR) {
+        continue;
+      }
+      return false;
+    }
+  }
+
+  // Hand the next complete request to the workers, unless one is running
+  // already. False if the request is malformed or too large.
+  bool dispatch(Connection &connection) {
+    if (connection.input.size() < sizeof(uint64_t)) {
+      return true;
+    }
+    uint64_t length = readUint64(connection.input.data());
+    if (length < 2 || length > MAX_REQUEST_SIZE) {
+      return false;
+    }
+    if (connection.running ||
+        connection.input.size() - sizeof(uint64_t) < length) {
+      return true;
+    }
+    connection.request = connection.input.substr(sizeof(uint64_t), length);
+    connection.input.erase(0, sizeof(uint64_t) + length);
+    connection.running = true;
+    std::lock_guard<std::mutex> guard(mutex);
+    queued.push_back(&connection);
+    work_ready.notify_one();
+    return true;
+  }
+
+  // Send the output streamed by the workers, and start the next requests
+  // of clients whose requests have finished. A connection's output is all
+  // streamed before its request is listed as finished.
+  void finishRequests() {
+    uint64_t count;
+    while (::read(wake_fd, &count, sizeof(count)) > 0) {
+    }
+    std::vector<Connection *> ready;
+    std::vector<Connection *> done;
+    {
+      std::lock_guard<std::mutex> guard(mutex);
+      ready.swap(streaming);
+      done.swap(finished);
+    }
+    for (Connection *connection : ready) {
+      if (!connection->closed && !send(*connection)) {
+        close(*connection);
+      }
+    }
+    for (Connection *connection : done) {
+      connection->running = false;
+      if (connection->closed) {
+        connections.erase(connection->fd);
+        continue;
+      }
+      if (!dispatch(*connection)) {
+        close(*connection);
+      }
+    }
+  }
+
+  // Queue a reply message for the loop to send, on a worker thread. Waits
+  // while the client is too far behind.
+  void stream(Connection &connection, ReplyKind kind, const char *data,
+              size_t size) {
+    std::unique_lock<std::mutex> lock(mutex);
+    drained.wait(lock, [&] {
+      return connection.streamed.size() < MAX_STREAMED ||
+             connection.abandoned || stopping;
+    });
+    if (connection.abandoned || stopping) {
+      return;
+    }
+    if (connection.streamed.empty()) {
+      streaming.push_back(&connection);
+      uint64_t one = 1;
+      ::write(wake_fd, &one, sizeof(one));
+    }
+    appendUint64(connection.streamed, 1 + size);
+    connection.streamed += static_cast<char>(kind);
+    connection.streamed.append(data, size);
+  }
+
+  void work() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+      work_ready.wait(lock, [&] { return stopping || !queued.empty(); });
+      if (queued.empty()) {
+        return;
+      }
+      Connection *connection = queued.front();
+      queued.pop_front();
+      lock.unlock();
+      handle(*connection);
+      lock.lock();
+      finished.push_back(connection);
+      uint64_t one = 1;
+      ::write(wake_fd, &one, sizeof(one));
+    }
+  }
+
+  // Let the workers finish the requests queued so far, then stop them
+  void stopWorkers() {
+    {
+      std::lock_guard<std::mutex> guard(mutex);
+      stopping = true;
+      work_ready.notify_all();
+    }
+    for (auto &worker : workers) {
+      worker.join();
+    }
+    workers.clear();
+  }
+
+  // Run a request on a worker thread
+  void handle(Connection &connection) {
+    const std::string &request = connection.request;
+    OutputFormat format = request[0] == static_cast<char>(OutputFormat::BINARY)
+                              ? OutputFormat::BINARY
+                              : OutputFormat::TEXT;
+    connection.session.setPrintStats(request[1] & PRINT_STATS);
+    connection.log.str("");
+
+    int status = EXIT_SUCCESS;
+    {
+      std::unique_ptr<OutputWriter> writer = OutputWriter::create(format);
+      writer->open([&](const char *data, size_t size) {
+        stream(connection, OUTPUT, data, size);
+      });
+      try {
+        std::istringstream script(request.substr(2));
+        connection.session.execute(splitStatements(script), *writer);
+      } catch (const std::exception &e) {
+        connection.log << errorMessage(e) << "\n";
+        status = EXIT_FAILURE;
+      }
+    }
+    connection.request.clear();
+
+    std::string done(1, static_cast<char>(status));
+    done += connection.log.str();
+    stream(connection, DONE, done.data(), done.size());
+  }
+
+  // Once the messages taken before are sent, take those streamed since
+  void refill(Connection &connection) {
+    if (connection.sent < connection.output.size()) {
+      return;
+    }
+    connection.output.clear();
+    connection.sent = 0;
+    std::lock_guard<std::mutex> guard(mutex);
+    if (!connection.streamed.empty()) {
+      connection.output.swap(connection.streamed);
+      drained.notify_all();
+    }
+  }
+
+  // Send as much of the pending replies as the socket takes, watching for
+  // room to send the rest. False once the client has gone.
+  bool send(Connection &connection) {
+    refill(connection);
+    while (connection.sent < connection.output.size()) {
+      ssize_t n =
+          ::send(connection.fd, connection.output.data() + connection.sent,
+                 connection.output.size() - connection.sent, MSG_NOSIGNAL);
+      if (n >= 0) {
+        connection.sent += static_cast<size_t>(n);
+        refill(connection);
+        continue;
+      }
+      if (errno == EINTR) {
+        continue;
+      }
+      if (errno != EAGAIN && errno != EWOULDBLOCK) {
+        return false;
+      }
+      break;
+    }
+    bool pending = connection.sent < connection.output.size();
+    if (pending != connection.writable_watched) {
+      watch(connection.fd, pending ? EPOLLIN | EPOLLOUT : EPOLLIN,
+            EPOLL_CTL_MOD);
+      connection.writable_watched = pending;
+    }
+    return true;
+  }
+};
+
+// Send one request to the server at `socket_path`, handing each message of
+// the reply to `receive` as it arrives until `receive` returns false
+inline void
+sendRequest(const std::string &socket_path, const std::string &request,
+            const std::function<bool(std::string_view)> &receive) {
+  sockaddr_un address = socketAddress(socket_path);
+  int fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  if (fd < 0 || ::connect(fd, reinterpret_cast<sockaddr *>(&address),
+                          sizeof(address)) < 0) {
+    if (fd >= 0) {
+      ::close(fd);
+    }
+    throw FileError("Failed to connect to " + socket_path);
+  }
+  auto transfer = [&](char *data, size_t size, bool sending) {
+    for (size_t done = 0; done < size;) {
+      ssize_t n = sending ? ::send(fd, data + done, size - done, MSG_NOSIGNAL)
+                          : ::recv(fd, data + done, size - done, 0);
+      if (n < 0 && errno == EINTR) {
+        continue;
+      }
+      if (n <= 0) {
+        throw FileError("Lost the connection to " + socket_path);
+      }
+      done += static_cast<size_t>(n);
+    }
+  };
+  try {
+    std::string message;
+    appendUint64(message, request.size());
+    message += request;
+    transfer(message.data(), message.size(), true);
+    std::string reply;
+    do {
+      char header[sizeof(uint64_t)];
+      transfer(header, sizeof(header), false);
+      reply.resize(readUint64(header));
+      transfer(reply.data(), reply.size(), false);
+    } while (receive(reply));
+    ::close(fd);
+  } catch (...) {
+    ::close(fd);
+    throw;
+  }
+}
+
+// Run a script on a server, with the same output file, messages and exit
+// status as running it directly. The script is split here first so that
+// it fails the same way before anything is sent.
+inline int runClient(const std::string &socket_path, OutputFormat format,
+                     bool print_stats, const std::string &input_path,
+                     const std::string &output_path) {
+  std::ifstream input_file(input_path, std::ios::binary);
+  if (!input_file.is_open()) {
+    throw FileError("Failed to open input file");
+  }
+  std::string script((std::istreambuf_iterator<char>(input_file)),
+                     std::istreambuf_iterator<char>());
+  std::istringstream statements(script);
+  splitStatements(statements);
+
+  std::unique_ptr<std::FILE, int (*)(std::FILE *)> output(
+      std::fopen(output_path.c_str(),
+                 format == OutputFormat::BINARY ? "wb" : "w"),
+      std::fclose);
+  if (!output) {
+    throw FileError("Failed to open output file");
+  }
+
+  std::string request(1, static_cast<char>(format));
+  request += static_cast<char>(print_stats ? PRINT_STATS : 0);
+  request += script;
+  if (request.size() > MAX_REQUEST_SIZE) {
+    throw FileError("Input file too large for the server");
+  }
+
+  int status = EXIT_FAILURE;
+  sendRequest(socket_path, request, [&](std::string_view reply) {
+    if (reply.size() >= 1 && reply[0] == OUTPUT) {
+      if (std::fwrite(reply.data() + 1, 1, reply.size() - 1, output.get()) !=
+          reply.size() - 1) {
+        throw FileError("Failed to write output file");
+      }
+      return true;
+    }
+    if (reply.size() < 2 || reply[0] != DONE) {
+      throw FileError("Malformed reply from server");
+    }
+    status = reply[1];
+    std::cerr << reply.substr(2);
+    return false;
+  });
+  return status;
+}
+#endif
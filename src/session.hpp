@@ -0,0 +1,317 @@
+#pragma once
+#include "buffer_pool.hpp"
+#include "database.hpp"
+#include "output.hpp"
+#include "pipeline.hpp"
+#include "query_memory.hpp"
+#include "scheduler.hpp"
+#include "statement.hpp"
+#include "utils.hpp"
+#include <exception>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Loaded databases by name, shared by every session. Databases are only
+// ever added, so a session can keep using one once found.
+class DatabaseMap {
+public:
+  Database *find(const std::string &name) const {
+    std::shared_lock<std::shared_mutex> guard(lock);
+    auto it = databases.find(name);
+    return it == databases.end() ? nullptr : it->second.get();
+  }
+
+  // False if there already is a database of that name
+  bool add(std::unique_ptr<Database> database) {
+    std::unique_lock<std::shared_mutex> guard(lock);
+    std::string name = database->getName();
+    return databases.emplace(name, std::move(database)).second;
+  }
+
+  // Null if there already is a database of that name. Checked under the
+  // same lock, since a database dropped unused would still be saved over
+  // the existing one's file.
+  Database *create(const std::string &name, BufferPool &pool,
+                   const std::string &data_dir) {
+    std::unique_lock<std::shared_mutex> guard(lock);
+    if (databases.count(name)) {
+      return nullptr;
+    }
+    auto database = std::make_unique<Database>(name, pool, data_dir);
+    return databases.emplace(name, std::move(database)).first->second.get();
+  }
+
+  // Load the databases in `data_dir`, creating it if missing. Each file
+  // loads on a thread of its own, up to one per core. A log without a
+  // database file is of a database created since the last time they were
+  // written.
+  void load(const std::string &data_dir, BufferPool &pool) {
+    namespace fs = std::filesystem;
+    if (!fs::exists(data_dir)) {
+      fs::create_directory(data_dir);
+      return;
+    }
+    std::vector<fs::path> files;
+    for (const auto &entry : fs::directory_iterator(data_dir)) {
+      fs::path path = entry.path();
+      if (path.extension() == ".db" ||
+          (path.extension() == ".log" &&
+           !fs::exists(fs::path(path).replace_extension(".db")))) {
+        files.push_back(path);
+      }
+    }
+    parallelFor(files.size(), [&](size_t i) {
+      const fs::path &path = files[i];
+      if (path.extension() == ".db") {
+        add(Database::deserialize(path.string(), pool));
+      } else {
+        add(Database::recover(path.stem().string(), pool, data_dir));
+      }
+    });
+  }
+
+private:
+  mutable std::shared_mutex lock;
+  std::unordered_map<std::string, std::unique_ptr<Database>> databases;
+};
+
+// Settings that apply to every statement a session runs
+struct SessionOptions {
+  size_t query_memory_limit = BufferPool::UNLIMITED;
+  bool print_stats = false; // Peak memory of each statement, to the log,
+                            // with the size of the spill file
+  unsigned parse_threads = 0; // Parsing statements ahead of the one running
+  // Running statements on different tables of the current database at
+  // once (see StatementScheduler). Off with 0, as statements then share the
+  // memory limit with those alongside them, and a change run ahead of its
+  // turn pays for a transaction of its own.
+  unsigned statement_threads = 0;
+};
+
+// Runs statements against the loaded databases, remembering the database
+// chosen with USE DATABASE from one call to the next. The command line runs
+// its script in one session; the server runs one per client.
+class Session {
+public:
+  Session(DatabaseMap &databases, BufferPool &pool,
+          const std::string &data_dir, const SessionOptions &options,
+          std::ostream &log)
+      : databases(databases), pool(pool), data_dir(data_dir),
+        options(options), log(log) {}
+
+  void setPrintStats(bool print) { options.print_stats = print; }
+
+  // Stops at the first failing statement by throwing its error. A
+  // transaction still open then, or at the end, is rolled back.
+  void execute(const std::vector<Statement> &statements, OutputWriter &out) {
+    try {
+      run(statements, out);
+    } catch (...) {
+      transaction.reset();
+      throw;
+    }
+    if (transaction) {
+      transaction.reset();
+      log << "Transaction begun at line " << transaction_line
+          << " rolled back: no COMMIT before the end of the script\n";
+    }
+  }
+
+private:
+  DatabaseMap &databases;
+  BufferPool &pool;
+  std::string data_dir;
+  SessionOptions options;
+  std::ostream &log;
+  Database *current_database = nullptr;
+  std::unique_ptr<Database::Transaction> transaction;
+  int transaction_line = 0; // Of its BEGIN
+
+  // Statements the scheduler runs or keeps the results of, at most
+  static constexpr size_t WINDOW = StatementPipeline::DEPTH - 1;
+
+  void run(const std::vector<Statement> &statements, OutputWriter &out) {
+    // Each statement's tokens, trees and scratch memory come from an arena
+    // of the pipeline, emptied once it has run
+    size_t held = options.statement_threads == 0 ? 1 : WINDOW + 1;
+    StatementPipeline pipeline(statements, options.parse_threads, held);
+    SQLStatement *parsed_statement;
+    if (options.statement_threads == 0) {
+      while (pipeline.next(parsed_statement)) {
+        // Skip empty statements or statements with only semicolon
+        if (parsed_statement) {
+          runStatement(parsed_statement, out);
+        }
+        pipeline.release();
+      }
+      return;
+    }
+
+    // Statements on the tables of the current database go to the
+    // scheduler. The others, and all of a transaction's, run here once
+    // those before them are done: they change the session or the table
+    // list, or a transaction keeps what it changes until it ends.
+    StatementScheduler scheduler(options.statement_threads, WINDOW, out);
+    while (true) {
+      try {
+        if (!pipeline.next(parsed_statement)) {
+          break;
+        }
+      } catch (...) {
+        // Unless a statement before it fails first
+        scheduler.drain();
+        throw;
+      }
+      if (!parsed_statement) {
+        scheduler.submit({}, nullptr, [&](size_t) { pipeline.release(); });
+        continue;
+      }
+      StatementAccess access = analyzeAccess(*parsed_statement);
+      if (access.barrier || transaction || !current_database) {
+        scheduler.drain();
+        runStatement(parsed_statement, out);
+        pipeline.release();
+        continue;
+      }
+      Database *database = current_database;
+      SQLStatement *statement = parsed_statement;
+      scheduler.submit(
+          std::move(access),
+          [this, database, statement](
+              OutputWriter &results, const StatementScheduler::Turn *turn) {
+            QueryMemory memory(pool, options.query_memory_limit,
+                               statement->line_number);
+            if (turn) {
+              runAhead(*database, statement, results, memory, *turn);
+            } else {
+              database->executeStatement(statement, results, memory);
+            }
+            return memory.peakBytes();
+          },
+          [this, statement, &pipeline](size_t peak_bytes) {
+            logStatement(statement->line_number, peak_bytes);
+            pipeline.release();
+          });
+    }
+    scheduler.drain();
+  }
+
+  void runStatement(SQLStatement *parsed_statement, OutputWriter &out) {
+    QueryMemory memory(pool, options.query_memory_limit,
+                       parsed_statement->line_number);
+    if (parsed_statement->type == SQLStatementType::CREATE_DATABASE) {
+      if (!databases.create(parsed_statement->getDatabaseName(), pool,
+                            data_dir)) {
+        throw DatabaseError("Database already exists",
+                            parsed_statement->line_number);
+      }
+    } else if (parsed_statement->type == SQLStatementType::USE_DATABASE) {
+      Database *database =
+          databases.find(parsed_statement->getDatabaseName());
+      if (!database) {
+        throw DatabaseError("Database does not exist",
+                            parsed_statement->line_number);
+      }
+      if (transaction && database != current_database) {
+        throw DatabaseError("Cannot switch database in a transaction",
+                            parsed_statement->line_number);
+      }
+      current_database = database;
+    } else if (!current_database) {
+      throw DatabaseError("No database selected",
+                          parsed_statement->line_number);
+    } else if (parsed_statement->type == SQLStatementType::BEGIN) {
+      if (transaction) {
+        throw DatabaseError("Transaction already in progress",
+                            parsed_statement->line_number);
+      }
+      transaction = current_database->beginTransaction();
+      transaction_line = parsed_statement->line_number;
+    } else if (parsed_statement->type == SQLStatementType::COMMIT ||
+               parsed_statement->type == SQLStatementType::ROLLBACK) {
+      if (!transaction) {
+        throw DatabaseError("No transaction in progress",
+                            parsed_statement->line_number);
+      }
+      if (parsed_statement->type == SQLStatementType::COMMIT) {
+        transaction->commit();
+      } else {
+        transaction->rollback();
+      }
+      transaction.reset();
+    } else {
+      current_database->executeStatement(parsed_statement, out,
+                                         memory, transaction.get());
+    }
+    logStatement(parsed_statement->line_number, memory.peakBytes());
+  }
+
+  // Run a change before the statements ahead of it in the script are done.
+  // One of those may yet fail, leaving it unrun, so it runs in a
+  // transaction of its own, committed once they succeed and rolled back
+  // otherwise; its results are kept until then. It fails as it would have
+  // in its turn, keeping the changes made up to the failure. Waiting for
+  // its turn, it gives way to a transaction wanting its table, which the
+  // statements before it might be waiting for, and runs again in its turn.
+  void runAhead(Database &database, SQLStatement *statement,
+                OutputWriter &out, QueryMemory &memory,
+                const StatementScheduler::Turn &turn) {
+    std::unique_ptr<Database::Transaction> ahead =
+        database.beginTransaction();
+    ResultBuffer results;
+    std::exception_ptr error;
+    try {
+      database.executeStatement(statement, results, memory, ahead.get());
+    } catch (const SQLError &) {
+      error = std::current_exception();
+    }
+    ahead->startWaiting([&turn] { turn.wake(); });
+    bool in_turn = turn.await([&ahead] { return ahead->givingWay(); });
+    if (ahead->givingWay()) {
+      ahead.reset();
+      if (turn.await()) {
+        database.executeStatement(statement, out, memory);
+      }
+      return;
+    }
+    if (!in_turn) {
+      return;
+    }
+    ahead->commit(false);
+    results.writeTo(out);
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+
+  void logStatement(int line, size_t peak_bytes) {
+    if (options.print_stats) {
+      log << "Statement at line " << line << ": peak memory " << peak_bytes
+          << " bytes";
+      if (uint64_t spilled = pool.spillBytes()) {
+        log << ", spill file " << spilled << " bytes";
+      }
+      log << "\n";
+    }
+#ifdef DEBUG
+    log << "Successfully parsed statement\n";
+#endif
+  }
+};
+
+// The message the command line prints for an error a script runs into
+inline std::string errorMessage(const std::exception &e) {
+  if (dynamic_cast<const FileError *>(&e)) {
+    return std::string("File Error: ") + e.what();
+  }
+  if (dynamic_cast<const SQLError *>(&e)) {
+    return e.what();
+  }
+  return std::string("Unexpected Error: ") + e.what();
+}
@@ -0,0 +1,101 @@
+#pragma once
+#include "file_io.hpp"
+#include "utils.hpp"
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <random>
+#include <string>
+#ifdef _WIN32
+#include <share.h>
+#include <sys/stat.h>
+#endif
+
+// Create an anonymous temporary file in `dir`, or the system's temporary
+// directory if empty. It goes away once closed, even if the process dies:
+// POSIX unlinks it right away, and Windows deletes it on close.
+inline std::FILE *createTempFile(const std::string &dir) {
+  std::filesystem::path directory =
+      dir.empty() ? std::filesystem::temp_directory_path()
+                  : std::filesystem::path(dir);
+  std::random_device random;
+  for (int attempt = 0; attempt < 100; attempt++) {
+    std::string path =
+        (directory / ("minidb-" + std::to_string(random()))).string();
+#ifdef _WIN32
+    int fd = -1;
+    ::_sopen_s(&fd, path.c_str(),
+               _O_CREAT | _O_EXCL | _O_RDWR | _O_BINARY | _O_TEMPORARY,
+               _SH_DENYNO, _S_IREAD | _S_IWRITE);
+#else
+    int fd = ::open(path.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+#endif
+    if (fd < 0) {
+      if (errno == EEXIST) {
+        continue;
+      }
+      throw FileError("Failed to create temporary file in " +
+                      directory.string());
+    }
+#ifdef _WIN32
+    std::FILE *file = ::_fdopen(fd, "w+b");
+#else
+    ::unlink(path.c_str());
+    std::FILE *file = ::fdopen(fd, "w+b");
+#endif
+    if (!file) {
+      closeFile(fd);
+      throw FileError("Failed to open temporary file");
+    }
+    return file;
+  }
+  throw FileError("Failed to create temporary file in " + directory.string());
+}
+
+// Records written once and then read back in order, for operator state
+// that does not fit in memory
+class SpillFile {
+public:
+  explicit SpillFile(const std::string &dir) : file(createTempFile(dir)) {}
+  ~SpillFile() {
+    if (file) {
+      std::fclose(file);
+    }
+  }
+
+  SpillFile(const SpillFile &) = delete;
+  SpillFile &operator=(const SpillFile &) = delete;
+  SpillFile(SpillFile &&other) noexcept : file(other.file) {
+    other.file = nullptr;
+  }
+  SpillFile &operator=(SpillFile &&) = delete;
+
+  void write(const void *data, size_t size) {
+    if (std::fwrite(data, 1, size, file) != size) {
+      throw FileError("Failed to write temporary file");
+    }
+  }
+
+  // Switch from writing to reading from the start
+  void rewind() {
+    if (std::fflush(file) != 0 || std::fseek(file, 0, SEEK_SET) != 0) {
+      throw FileError("Failed to rewind temporary file");
+    }
+  }
+
+  // False at the end of the file
+  bool read(void *data, size_t size) {
+    size_t n = std::fread(data, 1, size, file);
+    if (n == size) {
+      return true;
+    }
+    if (n == 0 && std::feof(file)) {
+      return false;
+    }
+    throw FileError("Failed to read temporary file");
+  }
+
+private:
+  std::FILE *file;
+};
@@ -3,11 +3,18 @@
 #include "utils.hpp"
 #include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 
 struct SQLStatement {
   SQLStatementType type;
   int line_number;
+  // Holds the tokens and condition and expression trees, and scratch memory
+  // while the statement runs; set by the parser
+  Arena *arena = nullptr;
+  // The statement as written, for the commit log; set by the parser and
+  // only valid as long as its input
+  std::string_view text;
 
   SQLStatement() : line_number(0) {}
   virtual ~SQLStatement() = default;
@@ -39,6 +46,18 @@ struct DropTableStatement : SQLStatement {
   std::string table_name;
 };
 
+struct VacuumStatement : SQLStatement {
+  VacuumStatement() { type = SQLStatementType::VACUUM; }
+  std::string table_name;
+};
+
+// BEGIN, COMMIT or ROLLBACK, told apart by type
+struct TransactionStatement : SQLStatement {
+  explicit TransactionStatement(SQLStatementType statement_type) {
+    type = statement_type;
+  }
+};
+
 struct InsertStatement : SQLStatement {
   InsertStatement() { type = SQLStatementType::INSERT; }
   std::string table_name;
@@ -49,7 +68,8 @@ struct SelectStatement : SQLStatement {
   SelectStatement() { type = SQLStatementType::SELECT; }
   std::vector<std::string> columns;
   std::string table_name;
-  std::unique_ptr<WhereCondition> where_condition;
+  WhereCondition *where_condition = nullptr;
+  int limit = -1; // Maximum number of rows to return, -1 for no LIMIT
 };
 
 struct InnerJoinStatement : SQLStatement {
@@ -58,18 +78,27 @@ struct InnerJoinStatement : SQLStatement {
   std::vector<std::string> tables;  // List of tables to join
   std::vector<std::pair<std::string, std::string>> join_conditions;  // Format: <tableName.columnName, tableName.columnName>
   std::vector<TokenType> join_operators;  // Operators for join conditions (=, <, >, !=)
-  std::unique_ptr<WhereCondition> where_condition;
+  WhereCondition *where_condition = nullptr;
+  int limit = -1; // Maximum number of rows to return, -1 for no LIMIT
 };
 
 struct UpdateStatement : SQLStatement {
   UpdateStatement() { type = SQLStatementType::UPDATE; }
   std::string table_name;
   std::vector<SetCondition> set_conditions;
-  std::unique_ptr<WhereCondition> where_condition;
+  WhereCondition *where_condition = nullptr;
 };
 
 struct DeleteStatement : SQLStatement {
   DeleteStatement() { type = SQLStatementType::DELETE; }
   std::string table_name;
-  std::unique_ptr<WhereCondition> where_condition;
+  WhereCondition *where_condition = nullptr;
+};
+
+// EXPLAIN [ANALYZE] of a statement reading or changing a table. The
+// statement explained shares the arena and text of the EXPLAIN.
+struct ExplainStatement : SQLStatement {
+  ExplainStatement() { type = SQLStatementType::EXPLAIN; }
+  bool analyze = false; // Run it and measure each operator
+  std::unique_ptr<SQLStatement> statement;
 };
\ No newline at end of file
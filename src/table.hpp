@@ -1,20 +1,70 @@
 #pragma once
+#include "column.hpp"
+#include "output.hpp"
 #include "parser.hpp"
+#include "profile.hpp"
+#include "query_memory.hpp"
+#include "spill.hpp"
 #include "statement.hpp"
 #include "utils.hpp"
 #include <algorithm>
+#include <deque>
+#include <exception>
 #include <fstream>
-#include <list>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
+// Guards a table's storage while statements read and change it at once.
+// Readers hold it shared a block at a time and writers exclusively while
+// they apply their changes, so neither waits for the other's statement to
+// finish. A writer waiting for it holds back readers arriving after it,
+// which could otherwise keep it waiting as long as they overlap.
+class StorageLatch {
+public:
+  void lock() {
+    std::lock_guard<std::mutex> turn(queue);
+    latch.lock();
+  }
+  void unlock() { latch.unlock(); }
+
+  void lock_shared() {
+    { std::lock_guard<std::mutex> turn(queue); }
+    latch.lock_shared();
+  }
+  void unlock_shared() { latch.unlock_shared(); }
+
+private:
+  std::mutex queue; // Held by a writer while it waits
+  std::shared_mutex latch;
+};
+
 class Table {
 public:
-  Table(const std::string &name, const std::vector<ColumnDefinition> &columns)
-      : name(name), columns(columns) {
+  // What a statement reading the table sees: the rows committed when it
+  // began, as they were then. Writers change rows in place, but keep what
+  // snapshots still in use would see: a deleted row stays visible to them,
+  // and an updated row leaves a copy of its old values behind (see
+  // RowVersion) until the last of them is done.
+  struct Snapshot {
+    uint64_t version = 0; // Of the last change it sees
+    size_t rows = 0;      // Row count at that point
+  };
+
+  Table(const std::string &name, const std::vector<ColumnDefinition> &columns,
+        BufferPool &pool)
+      : name(name), pool(pool), columns(columns) {
     rebuildColumnIndex();
+    for (const auto &column : columns) {
+      column_data.emplace_back(column.type, pool);
+    }
   }
 
   void rebuildColumnIndex() {
@@ -25,8 +75,88 @@ public:
   }
 
   std::string getName() const { return name; }
+  size_t rowCount() const { return row_count - dead_rows; }
+
+  // Held shared by statements reading or changing the table, and
+  // exclusively by VACUUM, which moves rows (see Database::executeStatement)
+  std::shared_mutex &getLock() const { return lock; }
+
+  // Held by the statement changing the table, as one may at a time, or by
+  // the transaction changing it until that ends
+  std::mutex &getWriteLock() { return write_lock; }
+
+  static constexpr uint64_t NO_TRANSACTION = 0;
+
+  // From now on the changes statements make are pending until the
+  // transaction ends: snapshots see them only when taken for the
+  // transaction itself. The caller holds the write lock until it ends.
+  void beginTransaction(uint64_t id) {
+    std::lock_guard<StorageLatch> latch(storage_latch);
+    transaction = id;
+    transaction_rows = row_count;
+  }
+
+  // Make the pending changes to `tables` visible to snapshots taken from
+  // now on, to all of them at one moment, as a ReadView takes its
+  // snapshots
+  static void commitTransaction(std::vector<Table *> tables) {
+    std::sort(tables.begin(), tables.end());
+    std::vector<std::unique_lock<StorageLatch>> latches;
+    for (Table *table : tables) {
+      latches.emplace_back(table->storage_latch);
+    }
+    for (Table *table : tables) {
+      table->transaction = NO_TRANSACTION;
+      table->commit();
+    }
+  }
+
+  // Undo the pending changes. Their row versions say what each changed
+  // row held before: rows the transaction deleted are brought back,
+  // updated rows take their values back from the copies made of them, and
+  // rows it inserted are deleted.
+  void rollbackTransaction() {
+    std::lock_guard<StorageLatch> latch(storage_latch);
+    uint64_t pending = version + 1;
+    std::vector<size_t> changed;
+    for (const auto &[row, entry] : versions) {
+      if (row < transaction_rows &&
+          (entry.begin == pending || entry.end == pending)) {
+        changed.push_back(row);
+      }
+    }
+    std::vector<Value> values(columns.size());
+    for (size_t row : changed) {
+      RowVersion &entry = versions[row];
+      if (entry.end == pending) {
+        entry.end = NO_VERSION;
+        markLive(row);
+      }
+      if (entry.begin == pending) {
+        size_t copy = entry.previous;
+        BlockPin pin(*this, copy / Column::BLOCK_SIZE);
+        loadRow(copy, values.data());
+        for (size_t i = 0; i < values.size(); i++) {
+          column_data[i].set(row, values[i]);
+        }
+        auto it = versions.find(copy);
+        entry = {it->second.begin, NO_VERSION, it->second.previous};
+        versions.erase(it);
+      }
+      if (entry.begin == 0 && entry.previous == NO_ROW) {
+        versions.erase(row);
+      }
+    }
+    for (size_t row = transaction_rows; row < row_count; row++) {
+      if (!deleted[row]) {
+        markDeleted(row);
+      }
+    }
+    transaction = NO_TRANSACTION;
+    commit();
+  }
 
-  void insert(const std::vector<Value> &row) {
+  void insert(const std::vector<Value> &row, QueryProfile *profile = nullptr) {
     // Validate number of values matches number of columns
     if (row.size() != columns.size()) {
       throw TableError("Number of values does not match number of columns");
@@ -35,80 +165,150 @@ public:
     // Validate that each value matches its column's type
     for (size_t i = 0; i < row.size(); i++) {
       const auto &value = row[i];
-      bool ok = (std::holds_alternative<int>(value) &&
-                 columns[i].type == TokenType::INTEGER) ||
-                (std::holds_alternative<double>(value) &&
-                 columns[i].type == TokenType::FLOAT) ||
-                (std::holds_alternative<std::string>(value) &&
-                 columns[i].type == TokenType::TEXT);
-      if (!ok) {
-        std::cerr << "Value: ";
-        std::visit([](const auto &v) { std::cerr << v; }, value);
-        std::cerr << " Type: " << TOKEN_STR.find(columns[i].type)->second
+      if (!matchesType(value, columns[i].type)) {
+        std::cerr << "Value: " << value << " Type: " << TOKEN_STR.find(columns[i].type)->second
                   << ' ';
         throw TableError("Value does not match column type");
       }
     }
 
-    // Store the row values in the table data
-    rows.push_back(row);
+    size_t append = QueryProfile::NO_OPERATOR;
+    if (profile) {
+      append = profile->add("Insert", name + ": 1 row", 0);
+      if (!profile->analyzing()) {
+        return;
+      }
+    }
+    OperatorTimer timer(profile, append);
+
+    // Store the row values in the column data. Snapshots already in use
+    // only see the rows before it.
+    std::lock_guard<StorageLatch> latch(storage_latch);
+    for (size_t i = 0; i < row.size(); i++) {
+      column_data[i].append(row[i]);
+    }
+    deleted.push_back(false);
+    row_count++;
+    finishChange();
+    if (profile) {
+      profile->at(append).rows_in = 1;
+      profile->at(append).rows_out = 1;
+    }
   }
 
-  void select(const SelectStatement &stmt) {
-    // Find rows matching where condition
-    std::vector<Value> column_names;
+  // Run for `transaction`, the statement also sees the changes pending in
+  // it. With a profile the statement is planned into it, and only run if
+  // it is being analyzed.
+  void select(const SelectStatement &stmt, OutputWriter &out,
+              uint64_t transaction = NO_TRANSACTION,
+              QueryProfile *profile = nullptr) {
+    // Resolve the projection once instead of per matching row
+    std::vector<ColumnDefinition> result_columns;
+    std::vector<size_t> projection;
     if (stmt.columns.empty()) {
-      for (const auto &column : columns) {
-        column_names.push_back(Value(column.name));
+      result_columns = columns;
+      for (size_t i = 0; i < columns.size(); i++) {
+        projection.push_back(i);
       }
     } else {
       for (const std::string &column_name : stmt.columns) {
-        column_names.push_back(Value(column_name));
+        auto it = column_index.find(column_name);
+        if (it == column_index.end()) {
+          throw TableError("Column not found");
+        }
+        result_columns.push_back(columns[it->second]);
+        projection.push_back(it->second);
       }
     }
-    std::vector<std::vector<Value>> results({column_names});
-    for (const auto &row : rows) {
-      bool matches = true;
-      if (stmt.where_condition) {
-        matches = evaluateWhereCondition(stmt.where_condition.get(), row);
+
+    // Stream matching rows straight into the writer, stopping at LIMIT
+    ReadView view({this}, transaction);
+    std::unique_ptr<CompiledCondition> where;
+    size_t project = QueryProfile::NO_OPERATOR;
+    ScanOperators scan;
+    {
+      std::shared_lock<StorageLatch> latch(storage_latch);
+      where = compileWhereCondition(stmt.where_condition);
+      if (profile) {
+        project = profile->add(
+            "Project", projectionText(stmt.columns, stmt.limit), 0);
+        scan = planScan(*profile, stmt.where_condition, where.get(),
+                        &view.snapshot(0), 1);
       }
-      if (matches) {
-        if (stmt.columns.empty()) {
-          // Select all columns
-          results.push_back(row);
-        } else {
-          // Select specific columns
-          std::vector<Value> selected;
-          for (const auto &colName : stmt.columns) {
-            auto it = std::find_if(columns.begin(), columns.end(),
-                                   [&colName](const ColumnDefinition &col) {
-                                     return col.name == colName;
-                                   });
-            if (it != columns.end()) {
-              size_t index = std::distance(columns.begin(), it);
-              selected.push_back(row[index]);
-            } else {
-              throw TableError("Column not found");
+    }
+    if (profile && !profile->analyzing()) {
+      return;
+    }
+    OperatorTimer timer(profile, project);
+    std::vector<Value> selected(projection.size());
+    out.beginResult(result_columns);
+    int emitted = 0;
+    if (stmt.limit != 0) {
+      scanMatches(
+          where.get(), *stmt.arena,
+          [&](size_t row) {
+            for (size_t i = 0; i < projection.size(); i++) {
+              column_data[projection[i]].load(row, selected[i]);
             }
-          }
-          if (!selected.empty())
-            results.push_back(selected);
-        }
-      }
+            out.writeRow(selected);
+            return ++emitted != stmt.limit;
+          },
+          &view.snapshot(0), scan);
+    }
+    out.endResult();
+    if (profile) {
+      profile->at(project).rows_out = emitted;
     }
-
-    file_writer.write(results);
   }
 
-  void update(const UpdateStatement &stmt) {
-    // Find rows matching where condition and update them
-    for (auto &row : rows) {
-      bool matches = true;
-      if (stmt.where_condition) {
-        matches = evaluateWhereCondition(stmt.where_condition.get(), row);
+  void update(const UpdateStatement &stmt, QueryProfile *profile = nullptr) {
+    std::unique_ptr<CompiledCondition> where;
+    size_t apply = QueryProfile::NO_OPERATOR;
+    ScanOperators scan;
+    {
+      // A statement only being explained is not the table's writer
+      std::shared_lock<StorageLatch> latch(storage_latch);
+      where = compileWhereCondition(stmt.where_condition);
+      if (profile) {
+        std::vector<std::string> targets;
+        for (const auto &set_condition : stmt.set_conditions) {
+          targets.push_back(set_condition.target_column);
+        }
+        apply = profile->add(
+            "Update", name + " SET " + projectionText(targets, -1), 0);
+        scan = planScan(*profile, stmt.where_condition, where.get(),
+                        nullptr, 1);
       }
+    }
+    if (profile && !profile->analyzing()) {
+      return;
+    }
+    OperatorTimer timer(profile, apply);
+
+    // Find the matching rows first; each row's condition only depends on
+    // that row, so this is the same as checking while updating
+    std::vector<size_t> matches;
+    scanMatches(
+        where.get(), *stmt.arena,
+        [&](size_t row) {
+          matches.push_back(row);
+          return true;
+        },
+        nullptr, scan);
+
+    // Work out the new values before writing any, so readers only wait
+    // for the writes. An error ends the statement with the values before
+    // it written, as if they had been written as they were worked out.
+    std::vector<ValueChange> changes;
+    std::exception_ptr error;
+    Value *values = stmt.arena->allocateArray<Value>(columns.size());
+    size_t updated = 0; // Rows all of whose new values were worked out
+    try {
+      BlockPin pin(*this);
+      for (size_t row : matches) {
+        pin.moveTo(row / Column::BLOCK_SIZE);
+        loadRow(row, values);
 
-      if (matches) {
         // Update matching rows with new values
         for (const auto &set_condition : stmt.set_conditions) {
           // Find column index
@@ -119,308 +319,266 @@ public:
           }
           size_t index = it->second;
 
-          // Evaluate the expression and update the value
-          Value new_value =
-              evaluateExpression(set_condition.expression.get(), row);
+          // Evaluate the expression; its text may live in a block that is
+          // evicted before it is written
+          Value new_value = stmt.arena->copy(
+              evaluateExpression(set_condition.expression, values));
 
           // Validate that the new value matches the column type
-          const auto &column_type = columns[index].type;
-          bool type_ok = (std::holds_alternative<int>(new_value) &&
-                          column_type == TokenType::INTEGER) ||
-                         (std::holds_alternative<double>(new_value) &&
-                          column_type == TokenType::FLOAT) ||
-                         (std::holds_alternative<std::string>(new_value) &&
-                          column_type == TokenType::TEXT);
-
-          if (!type_ok) {
+          if (!matchesType(new_value, columns[index].type)) {
             throw TableError("Value type does not match column type");
           }
 
-          // Update the value
-          row[index] = new_value;
+          changes.push_back({row, index, new_value});
+          values[index] = new_value;
         }
+        updated++;
+      }
+    } catch (...) {
+      error = std::current_exception();
+    }
+
+    std::lock_guard<StorageLatch> latch(storage_latch);
+    for (size_t i = 0; i < changes.size(); i++) {
+      const ValueChange &change = changes[i];
+      if (needsCopy(change.row)) {
+        preserveRow(change.row);
       }
+      column_data[change.column].set(change.row, change.value);
+    }
+    finishChange();
+    if (profile) {
+      QueryProfile::Operator &op = profile->at(apply);
+      op.rows_out = updated;
+      op.bytes = matches.capacity() * sizeof(size_t) +
+                 changes.capacity() * sizeof(ValueChange) +
+                 columns.size() * sizeof(Value);
+    }
+    if (error) {
+      std::rethrow_exception(error);
     }
   }
 
-  void deleteRows(const DeleteStatement &stmt) {
-    // If there's no where condition, delete all rows
+  void deleteRows(const DeleteStatement &stmt,
+                  QueryProfile *profile = nullptr) {
+    // If there's no where condition, delete all rows, keeping them only if
+    // a snapshot in use still sees them or a rollback may bring them back
+    size_t remove = QueryProfile::NO_OPERATOR;
     if (!stmt.where_condition) {
-      rows.clear();
+      if (profile) {
+        remove = profile->add("Delete", name + ": every row", 0);
+        if (!profile->analyzing()) {
+          return;
+        }
+      }
+      OperatorTimer timer(profile, remove);
+      std::lock_guard<StorageLatch> latch(storage_latch);
+      if (profile) {
+        profile->at(remove).rows_in = row_count - dead_rows;
+        profile->at(remove).rows_out = row_count - dead_rows;
+      }
+      if (!keepsVersions()) {
+        for (auto &column : column_data) {
+          column.clear();
+        }
+        row_count = 0;
+        deleted.clear();
+        block_dead_rows.clear();
+        dead_rows = 0;
+      } else {
+        for (size_t row = 0; row < row_count; row++) {
+          if (!deleted[row]) {
+            markDeleted(row);
+          }
+        }
+      }
+      finishChange();
       return;
     }
 
-    // Iterate through rows and remove those that match the where condition
-    auto it = rows.begin();
-    while (it != rows.end()) {
-      bool should_delete = true;
-
-      // Check first condition
-      should_delete = evaluateWhereCondition(stmt.where_condition.get(), *it);
-
-      // Remove the row if it matches the condition(s)
-      if (should_delete) {
-        it = rows.erase(it);
-      } else {
-        ++it;
+    // Only mark the matching rows; storage is compacted once enough of it
+    // is dead
+    std::unique_ptr<CompiledCondition> where;
+    ScanOperators scan;
+    {
+      // A statement only being explained is not the table's writer
+      std::shared_lock<StorageLatch> latch(storage_latch);
+      where = compileWhereCondition(stmt.where_condition);
+      if (profile) {
+        remove = profile->add("Delete", name, 0);
+        scan = planScan(*profile, stmt.where_condition, where.get(),
+                        nullptr, 1);
       }
     }
+    if (profile && !profile->analyzing()) {
+      return;
+    }
+    OperatorTimer timer(profile, remove);
+    std::vector<size_t> matches;
+    scanMatches(
+        where.get(), *stmt.arena,
+        [&](size_t row) {
+          matches.push_back(row);
+          return true;
+        },
+        nullptr, scan);
+    std::lock_guard<StorageLatch> latch(storage_latch);
+    for (size_t row : matches) {
+      markDeleted(row);
+    }
+    finishChange();
+    if (profile) {
+      profile->at(remove).rows_out = matches.size();
+      profile->at(remove).bytes = matches.capacity() * sizeof(size_t);
+    }
   }
 
-  void innerJoin(const InnerJoinStatement &stmt,
-                 std::vector<std::unique_ptr<Table>> &other_tables) {
-    // Map to store table name to index mapping
-    std::unordered_map<std::string, size_t> table_indices;
-    table_indices[name] = 0; // Current table is at index 0
-    for (size_t i = 0; i < other_tables.size(); ++i) {
-      table_indices[other_tables[i]->getName()] = i + 1;
+  // Whether enough rows are dead to drop them. The caller either changes
+  // the table or has it to itself.
+  bool vacuumDue() const { return dead_rows > row_count * MAX_DEAD_FRACTION; }
+
+  // Drop deleted rows from storage (VACUUM, and on every checkpoint). Rows
+  // move, so no snapshot may be in use.
+  void vacuum() {
+    if (dead_rows == 0) {
+      return;
+    }
+    deleted.flip();
+    for (auto &column : column_data) {
+      column.retain(deleted);
     }
+    row_count -= dead_rows;
+    deleted.assign(row_count, false);
+    block_dead_rows.clear();
+    dead_rows = 0;
+  }
 
-    // Vector to store all tables (current table + other tables)
+  void innerJoin(const InnerJoinStatement &stmt,
+                 const std::vector<Table *> &other_tables,
+                 OutputWriter &out, QueryMemory &memory,
+                 uint64_t transaction = NO_TRANSACTION,
+                 QueryProfile *profile = nullptr) {
+    // Vector to store all tables (current table + other tables), in join
+    // order
     std::vector<Table *> all_tables;
     all_tables.push_back(this);
-    for (const auto &table : other_tables) {
-      all_tables.push_back(table.get());
-    }
-
-    // Function to get table and column index from a qualified name
-    // (table.column)
-    auto getTableColumnIndex =
-        [&](const std::string &qualified_name) -> std::pair<Table *, size_t> {
-      size_t dot_pos = qualified_name.find('.');
-      if (dot_pos == std::string::npos) {
+    all_tables.insert(all_tables.end(), other_tables.begin(),
+                      other_tables.end());
+
+    // Every table is read from a snapshot taken at the same moment
+    ReadView view(all_tables, transaction);
+    std::vector<std::shared_lock<StorageLatch>> latches = view.latchShared();
+
+    // Resolve a qualified name (table.column) to its table position and
+    // column
+    auto resolveColumn =
+        [&](const std::string &qualified_name) -> ColumnRef {
+      if (qualified_name.find('.') == std::string::npos) {
         throw TableError("Column name must be qualified with table name: " +
                          qualified_name);
       }
+      return resolveColumnRef(qualified_name, all_tables);
+    };
 
-      std::string table_name = qualified_name.substr(0, dot_pos);
-      std::string column_name = qualified_name.substr(dot_pos + 1);
-
-      auto table_idx_it = table_indices.find(table_name);
-      if (table_idx_it == table_indices.end()) {
-        throw TableError("Table not found: " + table_name);
-      }
-
-      Table *table = all_tables[table_idx_it->second];
-
-      auto col_idx_it = table->column_index.find(column_name);
-      if (col_idx_it == table->column_index.end()) {
-        throw TableError("Column not found: " + column_name + " in table " +
-                         table_name);
+    // Condition i joins table i + 1 against the tables already joined
+    std::vector<std::unique_ptr<CompiledCondition>> steps;
+    for (size_t i = 0; i < stmt.join_conditions.size(); ++i) {
+      ColumnRef a = resolveColumn(stmt.join_conditions[i].first);
+      ColumnRef b = resolveColumn(stmt.join_conditions[i].second);
+      if (a.table > i + 1 || b.table > i + 1) {
+        throw TableError("Join condition references a table joined later");
       }
+      steps.push_back(compileComparison(a, b, stmt.join_operators[i]));
+    }
 
-      return {table, col_idx_it->second};
-    };
-
-    // Initialize results with column names
-    std::vector<std::vector<Value>> results;
-    std::vector<Value> header;
+    std::vector<ColumnDefinition> header;
+    std::vector<ColumnRef> projection;
     for (const auto &col : stmt.selected_columns) {
-      header.push_back(Value(col));
+      ColumnRef ref = resolveColumn(col);
+      header.push_back({col, ref.column->getType()});
+      projection.push_back(ref);
     }
-    results.push_back(header);
-
-    // Helper function to get column value from a row
-    auto getColumnValue = [](const std::vector<Value> &row,
-                             size_t col_idx) -> const Value & {
-      if (col_idx >= row.size()) {
-        throw TableError("Column index out of range: " +
-                         std::to_string(col_idx));
-      }
-      return row[col_idx];
-    };
-
-    // Helper function to check join condition
-    auto checkJoinCondition = [](const Value &val1, const Value &val2,
-                                 TokenType op) -> bool {
-      switch (op) {
-      case TokenType::EQUALS:
-        return val1 == val2;
-      case TokenType::GREATER_THAN:
-        return val1 > val2;
-      case TokenType::LESS_THAN:
-        return val1 < val2;
-      case TokenType::INEQUALS:
-        return val1 != val2;
-      default:
-        throw TableError("Unsupported operator in join condition");
-      }
-    };
 
-    // Start with rows from the first table
-    std::vector<std::vector<Value>> current_results;
-    for (const auto &row : rows) {
-      current_results.push_back(row);
+    // WHERE may also name columns of the first table without qualification
+    std::unique_ptr<CompiledCondition> where;
+    if (stmt.where_condition) {
+      where = compileJoinCondition(stmt.where_condition, all_tables);
     }
 
-    // For each join condition
-    for (size_t i = 0; i < stmt.join_conditions.size(); ++i) {
-      const auto &condition = stmt.join_conditions[i];
-      TokenType op = stmt.join_operators[i];
-
-      auto [table_a, col_idx_a] = getTableColumnIndex(condition.first);
-      auto [table_b, col_idx_b] = getTableColumnIndex(condition.second);
-
-      std::vector<std::vector<Value>> new_results;
-
-      // For each row in current results
-      for (const auto &current_row : current_results) {
-        // For each row in the table we're joining with
-        for (const auto &row_b : table_b->rows) {
-          // Get the actual values for comparison
-          Value val_a;
-          if (table_a == this) {
-            // Value is in the current row
-            val_a = current_row[col_idx_a];
-          } else if (table_a == table_b) {
-            // Value is in row_b
-            val_a = row_b[col_idx_a];
-          } else {
-            // Value must be from a previously joined table
-            size_t offset = 0;
-            for (const auto &table : all_tables) {
-              if (table == table_a) {
-                val_a = current_row[offset + col_idx_a];
-                break;
-              }
-              offset += table->columns.size();
-            }
-          }
-
-          Value val_b;
-          if (table_b == this) {
-            // Value is in the current row
-            val_b = current_row[col_idx_b];
-          } else {
-            // Value is in row_b
-            val_b = row_b[col_idx_b];
-          }
-
-          if (checkJoinCondition(val_a, val_b, op)) {
-            // Combine the rows
-            std::vector<Value> combined_row = current_row;
-            combined_row.insert(combined_row.end(), row_b.begin(), row_b.end());
-            new_results.push_back(combined_row);
-          }
-        }
+    // An equality step between the table it joins and an earlier one is
+    // joined by hash
+    std::vector<JoinHash> hashes(steps.size());
+    for (size_t i = 0; i < steps.size(); i++) {
+      const CompiledCondition &step = *steps[i];
+      if (step.kind != CompiledCondition::Kind::COMPARE ||
+          step.op != TokenType::EQUALS) {
+        continue;
       }
-
-      current_results = std::move(new_results);
-    }
-
-    // Apply WHERE condition if present
-    if (stmt.where_condition) {
-      std::vector<std::vector<Value>> filtered_results;
-      for (const auto &row : current_results) {
-        if (evaluateWhereCondition(stmt.where_condition.get(), row,
-                                   all_tables)) {
-          filtered_results.push_back(row);
-        }
+      if (step.left.table == i + 1 && step.right.table < i + 1) {
+        hashes[i].build = step.left.column;
+        hashes[i].probe = step.right;
+      } else if (step.right.table == i + 1 && step.left.table < i + 1) {
+        hashes[i].build = step.right.column;
+        hashes[i].probe = step.left;
       }
-      current_results = std::move(filtered_results);
     }
 
-    // Select only the requested columns
-    for (const auto &row : current_results) {
-      std::vector<Value> selected_row;
-      for (const auto &col : stmt.selected_columns) {
-        auto [table, col_idx] = getTableColumnIndex(col);
-
-        // Calculate offset for the table
-        size_t offset = 0;
-        for (const auto &t : all_tables) {
-          if (t == table) {
-            break;
-          }
-          offset += t->columns.size();
-        }
-
-        // Get the value from the correct position
-        size_t actual_idx = offset + col_idx;
-        if (actual_idx >= row.size()) {
-          throw TableError("Column index out of range: " +
-                           std::to_string(actual_idx));
-        }
-        selected_row.push_back(row[actual_idx]);
+    JoinOperators ops;
+    ops.levels.assign(all_tables.size() + 1, QueryProfile::NO_OPERATOR);
+    ops.builds.assign(all_tables.size(), QueryProfile::NO_OPERATOR);
+    if (profile) {
+      planJoin(*profile, stmt, all_tables, view, hashes, ops);
+      if (!profile->analyzing()) {
+        return;
       }
-      results.push_back(selected_row);
+      profile->at(ops.levels[0]).rows_in = view.snapshot(0).rows;
     }
-
-    file_writer.write(results);
-  }
-
-  // Evaluate a WHERE condition tree recursively with support for table joins
-  bool evaluateWhereCondition(
-      const WhereCondition *condition, const std::vector<Value> &row,
-      const std::vector<Table *> &all_tables = std::vector<Table *>()) {
-    if (!condition)
-      return true;
-
-    if (condition->type == WhereCondition::NodeType::LEAF) {
-      // Handle join case
-      if (!all_tables.empty()) {
-        Value val_a, val_b;
-
-        // Get first value (always a column reference in joins)
-        auto [table_a, col_idx_a] =
-            getTableColumnIndex(condition->column_name, all_tables);
-        size_t offset_a = 0;
-        for (const auto &table : all_tables) {
-          if (table == table_a)
-            break;
-          offset_a += table->columns.size();
-        }
-        val_a = row[offset_a + col_idx_a];
-
-        // Get second value (can be column reference or literal)
-        if (condition->value.type == TokenType::IDENTIFIER) {
-          auto [table_b, col_idx_b] =
-              getTableColumnIndex(condition->value.value, all_tables);
-          size_t offset_b = 0;
-          for (const auto &table : all_tables) {
-            if (table == table_b)
-              break;
-            offset_b += table->columns.size();
-          }
-          val_b = row[offset_b + col_idx_b];
-        } else {
-          val_b = convertTokenToValue(condition->value);
-        }
-
-        return checkJoinCondition(val_a, val_b, condition->condition_type);
+    OperatorTimer timer(profile, ops.project);
+
+    // Join depth-first so each combined row is produced, filtered and
+    // written before the next one is built; nothing is materialized unless
+    // a level has to be joined in partitions
+    latches.clear();
+    JoinContext ctx{stmt,
+                    all_tables,
+                    view,
+                    steps,
+                    hashes,
+                    where.get(),
+                    projection,
+                    out,
+                    memory,
+                    std::vector<size_t>(all_tables.size()),
+                    std::vector<size_t>(all_tables.size()),
+                    std::vector<Value>(projection.size()),
+                    0,
+                    profile,
+                    ops};
+    out.beginResult(header);
+    bool more = joinLevel(ctx, 0);
+    // Levels joined in partitions only collected their earlier rows so far
+    for (size_t level = 1; more && level < all_tables.size(); level++) {
+      if (hashes[level - 1].mode == JoinHash::Mode::PARTITIONED) {
+        OperatorTimer level_timer(profile, ops.levels[level]);
+        more = finishPartitionedLevel(ctx, level);
       }
-
-      // Handle normal case
-      return compareValues(condition->column_name, condition->condition_type,
-                           convertTokenToValue(condition->value), row);
     }
-
-    // Recursively evaluate left and right subtrees
-    bool left_result =
-        evaluateWhereCondition(condition->left.get(), row, all_tables);
-    bool right_result =
-        evaluateWhereCondition(condition->right.get(), row, all_tables);
-
-    // Combine results based on the logical operator
-    if (condition->logic_operator == TokenType::AND) {
-      return left_result && right_result;
-    } else if (condition->logic_operator == TokenType::OR) {
-      return left_result || right_result;
+    out.endResult();
+    if (profile) {
+      profile->at(ops.project).rows_out = ctx.emitted;
     }
-
-    throw TableError("Invalid logic operator");
   }
 
   // Evaluate an expression node recursively
-  Value evaluateExpression(const ExpressionNode *node,
-                           const std::vector<Value> &row) {
+  Value evaluateExpression(const ExpressionNode *node, const Value *row) {
     switch (node->type) {
     case ExprNodeType::VALUE: {
       if (node->token.type == TokenType::IDENTIFIER) {
         // Get value from column
         auto it = column_index.find(node->token.value);
         if (it == column_index.end()) {
-          throw TableError("Column not found: " + node->token.value);
+          throw TableError("Column not found: " +
+                           std::string(node->token.value));
         }
         return row[it->second];
       } else {
@@ -430,59 +588,38 @@ public:
     }
 
     case ExprNodeType::OPERATOR: {
-      if (node->children.size() != 2) {
+      if (node->child_count != 2) {
         throw TableError("Invalid operator node");
       }
 
-      Value left = evaluateExpression(node->children[0].get(), row);
-      Value right = evaluateExpression(node->children[1].get(), row);
+      Value left = evaluateExpression(node->children[0], row);
+      Value right = evaluateExpression(node->children[1], row);
 
       switch (node->token.type) {
       case TokenType::PLUS:
-        if (std::holds_alternative<int>(left) &&
-            std::holds_alternative<int>(right)) {
-          return std::get<int>(left) + std::get<int>(right);
-        }
-        if (std::holds_alternative<double>(left) ||
-            std::holds_alternative<double>(right)) {
-          double l = std::holds_alternative<int>(left) ? std::get<int>(left)
-                                                       : std::get<double>(left);
-          double r = std::holds_alternative<int>(right)
-                         ? std::get<int>(right)
-                         : std::get<double>(right);
-          return l + r;
+        if (left.isInt() && right.isInt()) {
+          return left.asInt() + right.asInt();
+        }
+        if (left.isNumeric() && right.isNumeric()) {
+          return left.toDouble() + right.toDouble();
         }
         throw TableError("Invalid types for addition");
 
       case TokenType::MINUS:
-        if (std::holds_alternative<int>(left) &&
-            std::holds_alternative<int>(right)) {
-          return std::get<int>(left) - std::get<int>(right);
-        }
-        if (std::holds_alternative<double>(left) ||
-            std::holds_alternative<double>(right)) {
-          double l = std::holds_alternative<int>(left) ? std::get<int>(left)
-                                                       : std::get<double>(left);
-          double r = std::holds_alternative<int>(right)
-                         ? std::get<int>(right)
-                         : std::get<double>(right);
-          return l - r;
+        if (left.isInt() && right.isInt()) {
+          return left.asInt() - right.asInt();
+        }
+        if (left.isNumeric() && right.isNumeric()) {
+          return left.toDouble() - right.toDouble();
         }
         throw TableError("Invalid types for subtraction");
 
       case TokenType::ASTERISK:
-        if (std::holds_alternative<int>(left) &&
-            std::holds_alternative<int>(right)) {
-          return std::get<int>(left) * std::get<int>(right);
-        }
-        if (std::holds_alternative<double>(left) ||
-            std::holds_alternative<double>(right)) {
-          double l = std::holds_alternative<int>(left) ? std::get<int>(left)
-                                                       : std::get<double>(left);
-          double r = std::holds_alternative<int>(right)
-                         ? std::get<int>(right)
-                         : std::get<double>(right);
-          return l * r;
+        if (left.isInt() && right.isInt()) {
+          return left.asInt() * right.asInt();
+        }
+        if (left.isNumeric() && right.isNumeric()) {
+          return left.toDouble() * right.toDouble();
         }
         throw TableError("Invalid types for multiplication");
 
@@ -492,10 +629,10 @@ public:
     }
 
     case ExprNodeType::PARENTHESIS: {
-      if (node->children.size() != 1) {
+      if (node->child_count != 1) {
         throw TableError("Invalid parenthesis node");
       }
-      return evaluateExpression(node->children[0].get(), row);
+      return evaluateExpression(node->children[0], row);
     }
 
     default:
@@ -537,20 +674,20 @@ public:
   // Helper function to get table and column index from a qualified name
   // (table.column)
   std::pair<Table *, size_t> getTableColumnIndex(
-      const std::string &qualified_name,
+      std::string_view qualified_name,
       const std::vector<Table *> &all_tables = std::vector<Table *>()) {
     size_t dot_pos = qualified_name.find('.');
-    if (dot_pos == std::string::npos) {
+    if (dot_pos == std::string_view::npos) {
       // If no dot, look in current table
       auto it = column_index.find(qualified_name);
       if (it == column_index.end()) {
-        throw TableError("Column not found: " + qualified_name);
+        throw TableError("Column not found: " + std::string(qualified_name));
       }
       return {this, it->second};
     }
 
-    std::string table_name = qualified_name.substr(0, dot_pos);
-    std::string column_name = qualified_name.substr(dot_pos + 1);
+    std::string table_name(qualified_name.substr(0, dot_pos));
+    std::string_view column_name = qualified_name.substr(dot_pos + 1);
 
     // Find the table
     Table *target_table = nullptr;
@@ -574,8 +711,8 @@ public:
     // Find the column
     auto it = target_table->column_index.find(column_name);
     if (it == target_table->column_index.end()) {
-      throw TableError("Column not found: " + column_name + " in table " +
-                       table_name);
+      throw TableError("Column not found: " + std::string(column_name) +
+                       " in table " + table_name);
     }
 
     return {target_table, it->second};
@@ -597,7 +734,10 @@ public:
     }
   }
 
-  void serialize(std::ofstream &out) const {
+  // Write the table as a checkpoint. Rows are stored column by column in
+  // blocks of Column::BLOCK_SIZE rows, each column of a block on one line in
+  // its compressed form; TEXT columns list their dictionary first.
+  void serialize(std::ostream &out) {
     // Write table name
     out << "TABLE " << quoteString(name) << "\n";
 
@@ -608,26 +748,32 @@ public:
           << "\n";
     }
 
-    // Write rows
-    out << "ROWS " << rows.size() << "\n";
-    for (const auto &row : rows) {
-      for (size_t i = 0; i < row.size(); ++i) {
-        if (i > 0)
-          out << " ";
-        const auto &value = row[i];
-        if (std::holds_alternative<int>(value)) {
-          out << "INT " << std::get<int>(value);
-        } else if (std::holds_alternative<double>(value)) {
-          out << "FLOAT " << std::get<double>(value);
-        } else if (std::holds_alternative<std::string>(value)) {
-          out << "TEXT " << quoteString(std::get<std::string>(value));
-        }
+    // Drop deleted rows and compress whatever changed since the last
+    // checkpoint, then write dictionaries and blocks
+    vacuum();
+    for (auto &column : column_data) {
+      column.compact();
+    }
+    out << "BLOCKS " << row_count << "\n";
+    for (const auto &column : column_data) {
+      if (column.getType() == TokenType::TEXT) {
+        column.writeDictionary(out);
+        out << "\n";
+      }
+    }
+    for (size_t begin = 0; begin < row_count; begin += Column::BLOCK_SIZE) {
+      out << "BLOCK " << std::min(Column::BLOCK_SIZE, row_count - begin)
+          << "\n";
+      for (const auto &column : column_data) {
+        column.writeBlock(out, begin / Column::BLOCK_SIZE);
+        out << "\n";
       }
-      out << "\n";
     }
   }
-
-  static std::unique_ptr<Table> deserialize(std::ifstream &in) {
+  // Blocks read here may be evicted and read back from `file`, the pool's
+  // id for the file `in` reads
+  static std::unique_ptr<Table> deserialize(std::ifstream &in,
+                                            BufferPool &pool, int file) {
     std::string line, word;
 
     // Read table name
@@ -675,16 +821,22 @@ public:
     }
 
     // Create table
-    auto table = std::make_unique<Table>(table_name, columns);
+    auto table = std::make_unique<Table>(table_name, columns, pool);
 
-    // Read rows
     std::getline(in, line);
     iss.clear();
     iss.str(line);
-    iss >> word; // Skip "ROWS"
+    iss >> word;
+    if (word == "BLOCKS") {
+      table->readBlocks(in, iss, file);
+      return table;
+    }
+
+    // Files written before block storage list one row per line
     size_t num_rows;
     iss >> num_rows;
 
+    std::vector<std::string> text_values(num_columns);
     for (size_t i = 0; i < num_rows; ++i) {
       std::getline(in, line);
       iss.clear();
@@ -706,82 +858,1378 @@ public:
           iss >> value;
           row.push_back(value);
         } else if (type == "TEXT") {
-          std::string value = readQuotedString(iss);
-          row.push_back(value);
+          // insert() copies the string, so the row may refer to it
+          text_values[j] = readQuotedString(iss);
+          row.push_back(Value(text_values[j]));
         } else {
           throw TableError("Invalid value type: " + type);
         }
       }
 
-      table->rows.push_back(std::move(row));
+      table->insert(row);
+    }
+    for (auto &column : table->column_data) {
+      column.compact();
     }
 
     return table;
   }
 
 private:
+  // Blocks of a table parsed at once while loading
+  static constexpr size_t LOAD_BATCH = 64;
+
+  // Read the dictionaries and blocks following a "BLOCKS <rows>" line.
+  // Blocks are taken a batch at a time: their lines are read in order,
+  // parsed on several threads, then added to the columns in order.
+  void readBlocks(std::ifstream &in, std::istringstream &iss, int file) {
+    std::string line, word;
+    size_t num_rows;
+    if (!(iss >> num_rows)) {
+      throw TableError("Invalid row count");
+    }
+    for (auto &column : column_data) {
+      if (column.getType() == TokenType::TEXT) {
+        std::getline(in, line);
+        iss.clear();
+        iss.str(line);
+        column.readDictionary(iss);
+      }
+    }
+    size_t num_columns = column_data.size();
+    std::vector<size_t> block_rows;
+    std::vector<std::string> lines; // Block by block, column by column
+    std::vector<uint64_t> offsets;
+    std::vector<std::optional<Column::LoadedBlock>> loaded;
+    for (size_t begin = 0; begin < num_rows;) {
+      block_rows.clear();
+      lines.clear();
+      offsets.clear();
+      for (; begin < num_rows && block_rows.size() < LOAD_BATCH;
+           begin += Column::BLOCK_SIZE) {
+        std::getline(in, line);
+        iss.clear();
+        iss.str(line);
+        size_t rows = 0;
+        iss >> word >> rows;
+        if (word != "BLOCK" || rows != std::min(Column::BLOCK_SIZE,
+                                                num_rows - begin)) {
+          throw TableError("Invalid block header");
+        }
+        block_rows.push_back(rows);
+        for (size_t i = 0; i < num_columns; i++) {
+          offsets.push_back(static_cast<uint64_t>(in.tellg()));
+          std::getline(in, lines.emplace_back());
+        }
+      }
+      loaded.clear();
+      loaded.resize(lines.size());
+      parallelFor(lines.size(), [&](size_t i) {
+        std::istringstream block_in(lines[i]);
+        loaded[i] = column_data[i % num_columns].readBlock(
+            block_in, block_rows[i / num_columns],
+            {file, offsets[i], lines[i].size()});
+      });
+      for (size_t i = 0; i < loaded.size(); i++) {
+        column_data[i % num_columns].addBlock(std::move(*loaded[i]));
+      }
+    }
+    row_count = num_rows;
+    deleted.assign(row_count, false);
+  }
+
+  // Keeps one block of every column of a table resident while it points
+  // at it, so the block's rows can be read
+  class BlockPin {
+  public:
+    static constexpr size_t NONE = SIZE_MAX;
+
+    explicit BlockPin(const Table &table, size_t block = NONE)
+        : table(table) {
+      moveTo(block);
+    }
+    ~BlockPin() { moveTo(NONE); }
+
+    BlockPin(const BlockPin &) = delete;
+    BlockPin &operator=(const BlockPin &) = delete;
+
+    void moveTo(size_t next) {
+      if (next == block) {
+        return;
+      }
+      if (block != NONE) {
+        for (const auto &column : table.column_data) {
+          column.unpin(block);
+        }
+      }
+      block = NONE;
+      if (next != NONE) {
+        for (const auto &column : table.column_data) {
+          column.pin(next);
+        }
+        block = next;
+      }
+    }
+
+  private:
+    const Table &table;
+    size_t block = NONE;
+  };
+
+  // Snapshots of the tables a statement reads, by position in its table
+  // list, taken at one moment across all of them and given back when the
+  // statement ends. A statement of a transaction sees its pending changes.
+  class ReadView {
+  public:
+    explicit ReadView(const std::vector<Table *> &tables,
+                      uint64_t transaction = NO_TRANSACTION)
+        : tables(tables), distinct(tables) {
+      std::sort(distinct.begin(), distinct.end());
+      distinct.erase(std::unique(distinct.begin(), distinct.end()),
+                     distinct.end());
+      std::vector<std::unique_lock<StorageLatch>> latches;
+      for (Table *table : distinct) {
+        latches.emplace_back(table->storage_latch);
+      }
+      for (Table *table : tables) {
+        snapshots.push_back(table->openSnapshot(transaction));
+      }
+    }
+    ~ReadView() {
+      for (size_t i = 0; i < tables.size(); i++) {
+        tables[i]->closeSnapshot(snapshots[i]);
+      }
+    }
+
+    ReadView(const ReadView &) = delete;
+    ReadView &operator=(const ReadView &) = delete;
+
+    const Snapshot &snapshot(size_t position) const {
+      return snapshots[position];
+    }
+
+    // Share the storage latch of every table, in address order so that
+    // statements latching the same tables cannot wait on each other
+    std::vector<std::shared_lock<StorageLatch>> latchShared() const {
+      std::vector<std::shared_lock<StorageLatch>> latches;
+      for (Table *table : distinct) {
+        latches.emplace_back(table->storage_latch);
+      }
+      return latches;
+    }
+
+  private:
+    std::vector<Table *> tables;
+    std::vector<Table *> distinct;
+    std::vector<Snapshot> snapshots;
+  };
+
+  // A column of one of the tables taking part in a statement
+  struct ColumnRef {
+    size_t table; // Position in the statement's table list
+    const Column *column;
+  };
+
+  // A WHERE or ON condition with column references and literals resolved
+  // up front, so evaluating it per row needs no name lookups or Value
+  // conversions. Equality on dictionary-encoded TEXT compares codes.
+  struct CompiledCondition {
+    enum class Kind { COMPARE, AND, OR, CONSTANT, ERROR };
+    enum class Mode { INT, FLOAT, TEXT, CODE }; // How COMPARE reads operands
+
+    Kind kind = Kind::COMPARE;
+    Mode mode = Mode::INT;
+    TokenType op = TokenType::EQUALS;
+    ColumnRef left{0, nullptr};
+    ColumnRef right{0, nullptr}; // No column: compare against the literal
+
+    int literal_int = 0;
+    double literal_float = 0;
+    std::string literal_text; // Also set in CODE mode, for zone maps
+    uint32_t literal_code = Column::NO_CODE;
+    uint64_t literal_hash = 0; // For the column's Bloom filters
+    std::vector<uint32_t> code_map; // Left dictionary codes as right codes
+
+    bool constant = false;    // Result of a CONSTANT node
+    std::exception_ptr error; // Thrown when an ERROR node is evaluated
+
+    std::unique_ptr<CompiledCondition> lhs;
+    std::unique_ptr<CompiledCondition> rhs;
+  };
+
+  // Operators of a scan under EXPLAIN: the scan, and the filter applying
+  // its condition if it has one
+  struct ScanOperators {
+    QueryProfile *profile = nullptr;
+    size_t scan = QueryProfile::NO_OPERATOR;
+    size_t filter = QueryProfile::NO_OPERATOR;
+  };
+
+  // Operators of a join under EXPLAIN
+  struct JoinOperators {
+    size_t project = QueryProfile::NO_OPERATOR;
+    size_t filter = QueryProfile::NO_OPERATOR;
+    // Those joining rows at each level: the scan of the first table, the
+    // join adding each later one, then the filter, or the projection
+    // without one
+    std::vector<size_t> levels;
+    std::vector<size_t> builds; // Hash builds, by level
+  };
+
+  // A row of the table a join step adds, with the hash of its joined value
+  struct HashEntry {
+    uint64_t hash;
+    size_t row;
+
+    bool operator<(const HashEntry &other) const {
+      return hash != other.hash ? hash < other.hash : row < other.row;
+    }
+  };
+
+  // Hash join state for an equality step between the table it adds and an
+  // earlier one, built when the level is first reached. Normally an index
+  // of the joined column, sorted by hash, hands each earlier row its
+  // candidate partners in row order. An index that would not fit in work
+  // memory, or within the statement's memory limits, is split into
+  // partitions in temporary files instead: the earlier rows reaching the
+  // level are written out too, each partition is joined on its own, and
+  // the results are merged back into arrival order (see
+  // finishPartitionedLevel). A Bloom filter keeps earlier rows without a
+  // partner out of the files.
+  struct JoinHash {
+    enum class Mode { UNBUILT, INDEX, PARTITIONED };
+
+    const Column *build = nullptr; // No hash join for this step if null
+    ColumnRef probe{0, nullptr};
+    Mode mode = Mode::UNBUILT;
+    std::vector<HashEntry> index; // INDEX
+
+    BloomFilter filter; // PARTITIONED
+    std::vector<SpillFile> build_parts;
+    std::vector<SpillFile> probe_parts;
+    std::vector<size_t> build_counts; // Entries in each build partition
+    uint64_t arrivals = 0; // Earlier rows written so far, in order
+  };
+
+  // State shared by the levels of a depth-first join
+  struct JoinContext {
+    const InnerJoinStatement &stmt;
+    const std::vector<Table *> &all_tables;
+    const ReadView &view;
+    const std::vector<std::unique_ptr<CompiledCondition>> &steps;
+    std::vector<JoinHash> &hashes;
+    const CompiledCondition *where;
+    const std::vector<ColumnRef> &projection;
+    OutputWriter &out;
+    QueryMemory &memory;
+    std::vector<size_t> row_ids;   // Current row of each joined table
+    std::vector<size_t> value_ids; // Where its values are (visibleRow)
+    std::vector<Value> selected;
+    int emitted;
+    QueryProfile *profile;
+    const JoinOperators &ops;
+  };
+
+  // Extend the current combination with every matching row of table
+  // `level`. Returns false once LIMIT is reached so the whole join stops.
+  bool joinLevel(JoinContext &ctx, size_t level) {
+    if (ctx.profile && level > 0) {
+      ctx.profile->at(ctx.ops.levels[level - 1]).rows_out++;
+      ctx.profile->at(ctx.ops.levels[level]).rows_in++;
+    }
+    OperatorTimer timer(ctx.profile, ctx.ops.levels[level]);
+    if (level == ctx.all_tables.size()) {
+      if (ctx.where && !evaluateCondition(*ctx.where, ctx.value_ids.data())) {
+        return true;
+      }
+      OperatorTimer project_timer(ctx.profile, ctx.ops.project);
+      if (ctx.profile && ctx.where) {
+        ctx.profile->at(ctx.ops.filter).rows_out++;
+        ctx.profile->at(ctx.ops.project).rows_in++;
+      }
+      for (size_t i = 0; i < ctx.projection.size(); i++) {
+        const ColumnRef &ref = ctx.projection[i];
+        ref.column->load(ctx.value_ids[ref.table], ctx.selected[i]);
+      }
+      ctx.out.writeRow(ctx.selected);
+      ctx.emitted++;
+      return ctx.stmt.limit < 0 || ctx.emitted < ctx.stmt.limit;
+    }
+
+    if (ctx.stmt.limit >= 0 && ctx.emitted >= ctx.stmt.limit) {
+      return false;
+    }
+
+    if (level > 0 && ctx.hashes[level - 1].build) {
+      return joinByHash(ctx, level);
+    }
+
+    const Table &table = *ctx.all_tables[level];
+    const Snapshot &snapshot = ctx.view.snapshot(level);
+    size_t rows = snapshot.rows;
+    for (size_t begin = 0; begin < rows; begin += Column::BLOCK_SIZE) {
+      // Writers may change the tables between blocks of the first one
+      std::vector<std::shared_lock<StorageLatch>> latches;
+      if (level == 0) {
+        latches = ctx.view.latchShared();
+      }
+      size_t block = begin / Column::BLOCK_SIZE;
+      if (!table.mayHaveVisibleRows(block, &snapshot)) {
+        continue;
+      }
+      if (block == 0) {
+        for (size_t ahead = 1; ahead < Column::READ_AHEAD; ahead++) {
+          table.prefetchBlock(ahead);
+        }
+      }
+      table.prefetchBlock(block + Column::READ_AHEAD);
+      BlockPin pin(table, block);
+      BlockPin copy_pin(table);
+      size_t end = std::min(rows, begin + Column::BLOCK_SIZE);
+      for (size_t row = begin; row < end; row++) {
+        size_t visible = table.visibleRow(row, snapshot);
+        if (visible == NO_ROW) {
+          continue;
+        }
+        if (visible != row) {
+          copy_pin.moveTo(visible / Column::BLOCK_SIZE);
+        }
+        ctx.row_ids[level] = row;
+        ctx.value_ids[level] = visible;
+        if (level > 0 &&
+            !evaluateCondition(*ctx.steps[level - 1], ctx.value_ids.data())) {
+          continue;
+        }
+        if (!joinLevel(ctx, level + 1)) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  bool joinByHash(JoinContext &ctx, size_t level) {
+    JoinHash &join_hash = ctx.hashes[level - 1];
+    const Table &table = *ctx.all_tables[level];
+    const Snapshot &snapshot = ctx.view.snapshot(level);
+    if (join_hash.mode == JoinHash::Mode::UNBUILT) {
+      OperatorTimer timer(ctx.profile, ctx.ops.builds[level]);
+      buildJoinHash(join_hash, table, snapshot, ctx.memory);
+      if (ctx.profile) {
+        describeJoinHash(ctx.profile->at(ctx.ops.builds[level]), join_hash,
+                         table, snapshot);
+      }
+    }
+    uint64_t hash = join_hash.probe.column->hashRow(
+        ctx.value_ids[join_hash.probe.table]);
+
+    if (join_hash.mode == JoinHash::Mode::PARTITIONED) {
+      // Set the earlier rows aside for finishPartitionedLevel
+      if (join_hash.filter.mayContain(hash)) {
+        SpillFile &part =
+            join_hash.probe_parts[hash % join_hash.probe_parts.size()];
+        uint64_t arrival = join_hash.arrivals++;
+        part.write(&arrival, sizeof(arrival));
+        part.write(&hash, sizeof(hash));
+        part.write(ctx.row_ids.data(), level * sizeof(size_t));
+      }
+      return true;
+    }
+
+    BlockPin pin(table);
+    auto it = std::lower_bound(join_hash.index.begin(), join_hash.index.end(),
+                               HashEntry{hash, 0});
+    for (; it != join_hash.index.end() && it->hash == hash; ++it) {
+      ctx.row_ids[level] = it->row;
+      ctx.value_ids[level] = table.visibleRow(it->row, snapshot);
+      pin.moveTo(ctx.value_ids[level] / Column::BLOCK_SIZE);
+      if (!evaluateCondition(*ctx.steps[level - 1], ctx.value_ids.data())) {
+        continue;
+      }
+      if (!joinLevel(ctx, level + 1)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Hash the joined column of every row of `table` the snapshot sees, into
+  // the index if it fits in memory and into partition files otherwise
+  void buildJoinHash(JoinHash &join_hash, const Table &table,
+                     const Snapshot &snapshot, QueryMemory &memory) {
+    size_t count = table.visibleRowBound(snapshot);
+    size_t bytes = count * sizeof(HashEntry);
+    size_t parts = 0;
+    if (bytes <= pool.getWorkMemory() && memory.tryReserve(bytes)) {
+      join_hash.mode = JoinHash::Mode::INDEX;
+      join_hash.index.reserve(count);
+    } else {
+      join_hash.mode = JoinHash::Mode::PARTITIONED;
+      join_hash.filter = BloomFilter(count);
+      memory.reserve(join_hash.filter.memoryBytes());
+      // Aim at half of what one partition may hold, leaving room for
+      // partitions that come out larger than the rest
+      size_t room = std::min(pool.getWorkMemory(), memory.availableBytes());
+      parts = std::min(MAX_JOIN_PARTITIONS,
+                       bytes / std::max<size_t>(room / 2, 1) + 1);
+      join_hash.build_counts.assign(parts, 0);
+      for (size_t p = 0; p < parts; p++) {
+        join_hash.build_parts.emplace_back(pool.getTempDirectory());
+        join_hash.probe_parts.emplace_back(pool.getTempDirectory());
+      }
+    }
+    const Column &column = *join_hash.build;
+    for (size_t begin = 0; begin < snapshot.rows;
+         begin += Column::BLOCK_SIZE) {
+      size_t block = begin / Column::BLOCK_SIZE;
+      if (!table.mayHaveVisibleRows(block, &snapshot)) {
+        continue;
+      }
+      column.pinInOrder(block);
+      size_t end = std::min(snapshot.rows, begin + Column::BLOCK_SIZE);
+      for (size_t row = begin; row < end; row++) {
+        size_t visible = table.visibleRow(row, snapshot);
+        if (visible == NO_ROW) {
+          continue;
+        }
+        HashEntry entry{0, row};
+        if (visible == row) {
+          entry.hash = column.hashRow(row);
+        } else {
+          column.pin(visible / Column::BLOCK_SIZE);
+          entry.hash = column.hashRow(visible);
+          column.unpin(visible / Column::BLOCK_SIZE);
+        }
+        if (parts == 0) {
+          join_hash.index.push_back(entry);
+        } else {
+          join_hash.filter.add(entry.hash);
+          join_hash.build_parts[entry.hash % parts].write(&entry,
+                                                          sizeof(entry));
+          join_hash.build_counts[entry.hash % parts]++;
+        }
+      }
+      column.unpin(block);
+    }
+    std::sort(join_hash.index.begin(), join_hash.index.end());
+  }
+
+  // Join the earlier rows set aside at a partitioned level, one partition
+  // at a time, then continue the join from the matches in the order the
+  // earlier rows arrived in. Returns false once LIMIT is reached. The
+  // files hold row ids, whose values are looked up again after writers
+  // had their turn.
+  bool finishPartitionedLevel(JoinContext &ctx, size_t level) {
+    JoinHash &join_hash = ctx.hashes[level - 1];
+    auto readFully = [](SpillFile &file, void *data, size_t size) {
+      if (!file.read(data, size)) {
+        throw FileError("Truncated temporary file");
+      }
+    };
+    std::deque<BlockPin> pins;
+    for (size_t t = 0; t <= level; t++) {
+      pins.emplace_back(*ctx.all_tables[t]);
+    }
+    auto pinRows = [&](size_t tables) {
+      for (size_t t = 0; t < tables; t++) {
+        ctx.value_ids[t] =
+            ctx.all_tables[t]->visibleRow(ctx.row_ids[t], ctx.view.snapshot(t));
+        pins[t].moveTo(ctx.value_ids[t] / Column::BLOCK_SIZE);
+      }
+    };
+
+    // Each partition's matches, as the arrival number and row ids, come
+    // out in arrival order
+    std::vector<SpillFile> results;
+    const Table &table = *ctx.all_tables[level];
+    for (size_t p = 0; p < join_hash.build_parts.size(); p++) {
+      std::vector<std::shared_lock<StorageLatch>> latches =
+          ctx.view.latchShared();
+      SpillFile &build = join_hash.build_parts[p];
+      SpillFile &probe = join_hash.probe_parts[p];
+      SpillFile &matches = results.emplace_back(pool.getTempDirectory());
+      size_t bytes = join_hash.build_counts[p] * sizeof(HashEntry);
+      ctx.memory.reserve(bytes);
+      if (ctx.profile) {
+        ctx.profile->at(ctx.ops.levels[level]).bytes += bytes;
+      }
+      std::vector<HashEntry> entries;
+      entries.reserve(join_hash.build_counts[p]);
+      build.rewind();
+      HashEntry entry;
+      while (build.read(&entry, sizeof(entry))) {
+        entries.push_back(entry);
+      }
+      std::sort(entries.begin(), entries.end());
+
+      probe.rewind();
+      uint64_t arrival, hash;
+      while (probe.read(&arrival, sizeof(arrival))) {
+        readFully(probe, &hash, sizeof(hash));
+        readFully(probe, ctx.row_ids.data(), level * sizeof(size_t));
+        pinRows(level);
+        auto it = std::lower_bound(entries.begin(), entries.end(),
+                                   HashEntry{hash, 0});
+        for (; it != entries.end() && it->hash == hash; ++it) {
+          ctx.row_ids[level] = it->row;
+          ctx.value_ids[level] =
+              table.visibleRow(it->row, ctx.view.snapshot(level));
+          pins[level].moveTo(ctx.value_ids[level] / Column::BLOCK_SIZE);
+          if (evaluateCondition(*ctx.steps[level - 1],
+                                ctx.value_ids.data())) {
+            matches.write(&arrival, sizeof(arrival));
+            matches.write(ctx.row_ids.data(), (level + 1) * sizeof(size_t));
+          }
+        }
+      }
+      ctx.memory.release(bytes);
+    }
+
+    // Merge the partitions. An earlier row arrives in one partition only,
+    // so ordering by arrival alone keeps its matches in row order.
+    std::vector<std::vector<size_t>> heads(results.size());
+    std::vector<std::pair<uint64_t, size_t>> heap; // Arrival, partition
+    auto later = [](const auto &a, const auto &b) { return a > b; };
+    auto advance = [&](size_t p) {
+      uint64_t arrival;
+      if (results[p].read(&arrival, sizeof(arrival))) {
+        heads[p].resize(level + 1);
+        readFully(results[p], heads[p].data(), (level + 1) * sizeof(size_t));
+        heap.emplace_back(arrival, p);
+        std::push_heap(heap.begin(), heap.end(), later);
+      }
+    };
+    for (size_t p = 0; p < results.size(); p++) {
+      results[p].rewind();
+      advance(p);
+    }
+    std::vector<std::shared_lock<StorageLatch>> latches;
+    for (size_t merged = 0; !heap.empty(); merged++) {
+      // Let writers in now and then, as between blocks of a scan
+      if (merged % Column::BLOCK_SIZE == 0) {
+        latches.clear();
+        latches = ctx.view.latchShared();
+      }
+      std::pop_heap(heap.begin(), heap.end(), later);
+      size_t p = heap.back().second;
+      heap.pop_back();
+      std::copy(heads[p].begin(), heads[p].end(), ctx.row_ids.begin());
+      pinRows(level + 1);
+      if (!joinLevel(ctx, level + 1)) {
+        return false;
+      }
+      advance(p);
+    }
+    return true;
+  }
+
+  // Start reading block b of every column back if it was evicted
+  void prefetchBlock(size_t b) const {
+    for (const auto &column : column_data) {
+      column.prefetch(b);
+    }
+  }
+
+  void loadRow(size_t row, Value *values) const {
+    for (size_t i = 0; i < column_data.size(); i++) {
+      column_data[i].load(row, values[i]);
+    }
+  }
+
+  ColumnRef resolveColumnRef(std::string_view qualified_name,
+                             const std::vector<Table *> &all_tables) {
+    auto [table, col_idx] = getTableColumnIndex(qualified_name, all_tables);
+    size_t position = std::find(all_tables.begin(), all_tables.end(), table) -
+                      all_tables.begin();
+    return {position, &table->column_data[col_idx]};
+  }
+
+  static std::unique_ptr<CompiledCondition>
+  errorCondition(std::exception_ptr error) {
+    auto node = std::make_unique<CompiledCondition>();
+    node->kind = CompiledCondition::Kind::ERROR;
+    node->error = error;
+    return node;
+  }
+
+  static Value sampleValue(TokenType type) {
+    switch (type) {
+    case TokenType::INTEGER:
+      return 0;
+    case TokenType::FLOAT:
+      return 0.0;
+    default:
+      return Value(std::string_view());
+    }
+  }
+
+  // Compare a column against another column. Values of different types
+  // compare by type, as Value does.
+  std::unique_ptr<CompiledCondition>
+  compileComparison(const ColumnRef &left, const ColumnRef &right,
+                    TokenType op) {
+    auto node = std::make_unique<CompiledCondition>();
+    node->op = op;
+    node->left = left;
+    node->right = right;
+    TokenType left_type = left.column->getType();
+    TokenType right_type = right.column->getType();
+    if (left_type != right_type) {
+      node->kind = CompiledCondition::Kind::CONSTANT;
+      node->constant = checkJoinCondition(sampleValue(left_type),
+                                          sampleValue(right_type), op);
+    } else if (left_type == TokenType::INTEGER) {
+      node->mode = CompiledCondition::Mode::INT;
+    } else if (left_type == TokenType::FLOAT) {
+      node->mode = CompiledCondition::Mode::FLOAT;
+    } else if (left.column->isDictionaryEncoded() &&
+               right.column->isDictionaryEncoded() &&
+               (op == TokenType::EQUALS || op == TokenType::INEQUALS)) {
+      // Translate the left dictionary into right codes once, so matching
+      // rows compares two integers
+      node->mode = CompiledCondition::Mode::CODE;
+      node->code_map.resize(left.column->dictionarySize());
+      for (uint32_t code = 0; code < node->code_map.size(); code++) {
+        node->code_map[code] =
+            right.column->lookupCode(left.column->dictionaryValue(code));
+      }
+    } else {
+      node->mode = CompiledCondition::Mode::TEXT;
+    }
+    return node;
+  }
+
+  // Compare a column against a literal. In strict mode (single table
+  // WHERE) mismatched types and ordering on TEXT are errors; otherwise they
+  // follow Value ordering like join conditions.
+  std::unique_ptr<CompiledCondition>
+  compileComparison(const ColumnRef &left, const Value &literal, TokenType op,
+                    bool strict) {
+    TokenType type = left.column->getType();
+    Value sample = sampleValue(type);
+    if (sample.getKind() != literal.getKind()) {
+      if (strict) {
+        return errorCondition(
+            std::make_exception_ptr(TableError("Value types do not match")));
+      }
+      auto node = std::make_unique<CompiledCondition>();
+      node->kind = CompiledCondition::Kind::CONSTANT;
+      node->constant = checkJoinCondition(sample, literal, op);
+      return node;
+    }
+
+    auto node = std::make_unique<CompiledCondition>();
+    node->op = op;
+    node->left = left;
+    node->literal_hash = hashValue(literal);
+    bool equality = op == TokenType::EQUALS || op == TokenType::INEQUALS;
+    if (type == TokenType::INTEGER) {
+      node->mode = CompiledCondition::Mode::INT;
+      node->literal_int = literal.asInt();
+    } else if (type == TokenType::FLOAT) {
+      node->mode = CompiledCondition::Mode::FLOAT;
+      node->literal_float = literal.asFloat();
+    } else if (strict && !equality) {
+      return errorCondition(
+          std::make_exception_ptr(TableError("Invalid condition type")));
+    } else if (left.column->isDictionaryEncoded() && equality) {
+      // A string missing from the dictionary gets NO_CODE, which no row has
+      node->mode = CompiledCondition::Mode::CODE;
+      node->literal_code = left.column->lookupCode(literal.asText());
+      node->literal_text = literal.asText();
+    } else {
+      node->mode = CompiledCondition::Mode::TEXT;
+      node->literal_text = literal.asText();
+    }
+    return node;
+  }
+
+  // Combine two compiled subtrees. The first error in left-to-right order
+  // wins, matching the order the conditions would be evaluated in.
+  static std::unique_ptr<CompiledCondition>
+  combineConditions(TokenType logic_operator,
+                    std::unique_ptr<CompiledCondition> lhs,
+                    std::unique_ptr<CompiledCondition> rhs) {
+    if (lhs->kind == CompiledCondition::Kind::ERROR) {
+      return lhs;
+    }
+    if (rhs->kind == CompiledCondition::Kind::ERROR) {
+      return rhs;
+    }
+    if (logic_operator != TokenType::AND && logic_operator != TokenType::OR) {
+      return errorCondition(
+          std::make_exception_ptr(TableError("Invalid logic operator")));
+    }
+    auto node = std::make_unique<CompiledCondition>();
+    node->kind = logic_operator == TokenType::AND
+                     ? CompiledCondition::Kind::AND
+                     : CompiledCondition::Kind::OR;
+    node->lhs = std::move(lhs);
+    node->rhs = std::move(rhs);
+    return node;
+  }
+
+  // Compile a single table WHERE condition. Problems such as unknown
+  // columns only surface when a row is evaluated, as they always have.
+  std::unique_ptr<CompiledCondition>
+  compileWhereCondition(const WhereCondition *condition) {
+    if (!condition) {
+      return nullptr;
+    }
+    if (condition->type == WhereCondition::NodeType::LEAF) {
+      auto it = column_index.find(condition->column_name);
+      if (it == column_index.end()) {
+        return errorCondition(
+            std::make_exception_ptr(TableError("Column not found")));
+      }
+      return compileComparison({0, &column_data[it->second]},
+                               convertTokenToValue(condition->value),
+                               condition->condition_type, true);
+    }
+    return combineConditions(condition->logic_operator,
+                             compileWhereCondition(condition->left),
+                             compileWhereCondition(condition->right));
+  }
+
+  // Compile a WHERE condition over joined tables, where an identifier on
+  // the right hand side names a column rather than a string
+  std::unique_ptr<CompiledCondition>
+  compileJoinCondition(const WhereCondition *condition,
+                       const std::vector<Table *> &all_tables) {
+    if (condition->type == WhereCondition::NodeType::LEAF) {
+      try {
+        ColumnRef left = resolveColumnRef(condition->column_name, all_tables);
+        if (condition->value.type == TokenType::IDENTIFIER) {
+          return compileComparison(
+              left, resolveColumnRef(condition->value.value, all_tables),
+              condition->condition_type);
+        }
+        return compileComparison(left, convertTokenToValue(condition->value),
+                                 condition->condition_type, false);
+      } catch (const TableError &) {
+        return errorCondition(std::current_exception());
+      }
+    }
+    return combineConditions(
+        condition->logic_operator,
+        compileJoinCondition(condition->left, all_tables),
+        compileJoinCondition(condition->right, all_tables));
+  }
+
+  // Add the operators of a scan for `condition`, compiled as `where`, under
+  // an operator at depth - 1. Its detail says how many blocks are left to
+  // read once the zone maps and Bloom filters are consulted. Needs the
+  // storage latch, or to be the table's only writer.
+  ScanOperators planScan(QueryProfile &profile,
+                         const WhereCondition *condition,
+                         const CompiledCondition *where,
+                         const Snapshot *snapshot, int depth) const {
+    ScanOperators ops{&profile};
+    if (condition) {
+      ops.filter = profile.add("Filter", conditionText(condition), depth++);
+    }
+    size_t total = snapshot ? snapshot->rows : row_count;
+    size_t blocks = (total + Column::BLOCK_SIZE - 1) / Column::BLOCK_SIZE;
+    size_t read = 0;
+    for (size_t block = 0; block < blocks; block++) {
+      if (mayHaveVisibleRows(block, snapshot) &&
+          (!where || matchZones(*where, block) != RangeMatch::NONE)) {
+        read++;
+      }
+    }
+    std::string detail = name + ": " + std::to_string(read) + " of " +
+                         std::to_string(blocks) + " blocks";
+    if (where) {
+      detail += " left by zone maps and Bloom filters";
+    }
+    ops.scan = profile.add("Scan", detail, depth);
+    return ops;
+  }
+
+  // Add the operators of a join. The first table is scanned, and each
+  // later one joined by hash or, without an equality to hash on, by
+  // scanning it again for every row reaching it. Whether an index fits in
+  // work memory is only known for sure once it is built.
+  void planJoin(QueryProfile &profile, const InnerJoinStatement &stmt,
+                const std::vector<Table *> &all_tables, const ReadView &view,
+                const std::vector<JoinHash> &hashes,
+                JoinOperators &ops) const {
+    size_t tables = all_tables.size();
+    ops.project = profile.add(
+        "Project", projectionText(stmt.selected_columns, stmt.limit), 0);
+    int depth = 1;
+    if (stmt.where_condition) {
+      ops.filter = profile.add("Filter", conditionText(stmt.where_condition),
+                               depth++);
+    }
+    ops.levels[tables] = stmt.where_condition ? ops.filter : ops.project;
+    for (size_t level = tables - 1; level > 0; level--) {
+      const auto &[a, b] = stmt.join_conditions[level - 1];
+      std::string on = "ON " + a + " " +
+                       comparisonText(stmt.join_operators[level - 1]) + " " +
+                       b;
+      ops.levels[level] =
+          hashes[level - 1].build
+              ? profile.add("Hash Join", on, depth++)
+              : profile.add("Nested Loop",
+                            on + ", scanning " + all_tables[level]->name +
+                                " for each row",
+                            depth++);
+    }
+    ops.levels[0] = profile.add(
+        "Scan", all_tables[0]->name + ": every block", depth);
+    for (size_t level = 1; level < tables; level++) {
+      if (!hashes[level - 1].build) {
+        continue;
+      }
+      const Table &table = *all_tables[level];
+      size_t bytes =
+          table.visibleRowBound(view.snapshot(level)) * sizeof(HashEntry);
+      ops.builds[level] = profile.add(
+          "Hash Build",
+          table.name + (bytes <= pool.getWorkMemory()
+                            ? ": index in memory"
+                            : ": partitions in temporary files"),
+          depth - static_cast<int>(level) + 1);
+    }
+  }
+
+  // What building the hash join state took, under EXPLAIN ANALYZE
+  static void describeJoinHash(QueryProfile::Operator &op,
+                               const JoinHash &join_hash, const Table &table,
+                               const Snapshot &snapshot) {
+    op.rows_in = snapshot.rows;
+    if (join_hash.mode == JoinHash::Mode::INDEX) {
+      op.rows_out = join_hash.index.size();
+      op.bytes = join_hash.index.capacity() * sizeof(HashEntry);
+      op.detail = table.name + ": index in memory";
+      return;
+    }
+    for (size_t count : join_hash.build_counts) {
+      op.rows_out += count;
+    }
+    op.bytes = join_hash.filter.memoryBytes();
+    op.detail = table.name + ": " +
+                std::to_string(join_hash.build_parts.size()) +
+                " partitions in temporary files";
+  }
+
+  // The columns a statement lists, and its LIMIT
+  static std::string projectionText(const std::vector<std::string> &columns,
+                                    int limit) {
+    std::string text;
+    for (const auto &column : columns) {
+      text += (text.empty() ? "" : ", ") + column;
+    }
+    if (text.empty()) {
+      text = "*";
+    }
+    if (limit >= 0) {
+      text += " LIMIT " + std::to_string(limit);
+    }
+    return text;
+  }
+
+  // Call visit(row) for each row matching `where` (every row without one)
+  // until it returns false. The condition is evaluated a block at a time,
+  // skipping blocks whose zone maps already decide it. Match flags live in
+  // the statement's arena.
+  //
+  // With a snapshot, the rows it sees are visited, by where their values
+  // are (see visibleRow), and writers may change the table between
+  // blocks. Without one, the caller is the table's only writer.
+  //
+  // Under EXPLAIN ANALYZE the work is charged to the scan and filter
+  // operators given, and the visits to the operator charged before.
+  template <typename Visit>
+  void scanMatches(const CompiledCondition *where, Arena &arena, Visit visit,
+                   const Snapshot *snapshot = nullptr,
+                   const ScanOperators &trace = {}) const {
+    size_t scratch_blocks = where ? scratchBlocks(*where) : 0;
+    size_t flag_bytes = Column::BLOCK_SIZE * (1 + scratch_blocks);
+    uint8_t *matches = arena.allocateArray<uint8_t>(flag_bytes);
+    uint8_t *scratch = matches + Column::BLOCK_SIZE;
+    size_t total = snapshot ? snapshot->rows : row_count;
+    QueryProfile *profile = trace.profile;
+    OperatorTimer timer(profile, trace.scan);
+    if (profile) {
+      profile->at(trace.scan).rows_in += total;
+      profile->at(trace.scan).bytes += flag_bytes;
+    }
+    auto pass = [&](size_t row) {
+      if (!profile) {
+        return visit(row);
+      }
+      if (where) {
+        profile->at(trace.filter).rows_out++;
+      }
+      profile->at(timer.previous()).rows_in++;
+      size_t from = profile->enter(timer.previous());
+      bool more = visit(row);
+      profile->enter(from);
+      return more;
+    };
+    size_t blocks = (total + Column::BLOCK_SIZE - 1) / Column::BLOCK_SIZE;
+    auto mayMatch = [&](size_t block) {
+      return mayHaveVisibleRows(block, snapshot) &&
+             (!where || matchZones(*where, block) != RangeMatch::NONE);
+    };
+    size_t ahead = 0; // Next block to consider for read-ahead
+    for (size_t begin = 0; begin < total; begin += Column::BLOCK_SIZE) {
+      if (profile) {
+        profile->enter(trace.scan);
+      }
+      std::shared_lock<StorageLatch> latch(storage_latch, std::defer_lock);
+      if (snapshot) {
+        latch.lock();
+      }
+      size_t rows = std::min(Column::BLOCK_SIZE, total - begin);
+      size_t block = begin / Column::BLOCK_SIZE;
+      if (!mayHaveVisibleRows(block, snapshot)) {
+        continue;
+      }
+      RangeMatch zone =
+          where ? matchZones(*where, block) : RangeMatch::ALL;
+      if (zone == RangeMatch::NONE) {
+        continue;
+      }
+      // Ask for the next blocks the scan will read before waiting on this one
+      for (ahead = std::max(ahead, block + 1);
+           ahead < blocks && ahead <= block + Column::READ_AHEAD; ahead++) {
+        if (mayMatch(ahead)) {
+          prefetchBlock(ahead);
+        }
+      }
+      BlockPin pin(*this, block);
+      if (profile) {
+        profile->at(trace.scan).rows_out += rows;
+        if (where) {
+          profile->at(trace.filter).rows_in += rows;
+          profile->enter(trace.filter);
+        }
+      }
+      if (zone == RangeMatch::ALL) {
+        std::fill(matches, matches + rows, 1);
+      } else {
+        evaluateBlock(*where, begin, rows, matches, scratch);
+      }
+      if (snapshot && !versions.empty()) {
+        // Rows changed since the snapshot may be read from copies made
+        // before, elsewhere in the table
+        BlockPin copy_pin(*this);
+        for (size_t i = 0; i < rows; i++) {
+          size_t row = begin + i;
+          size_t visible = visibleRow(row, *snapshot);
+          if (visible == row ? !matches[i] : visible == NO_ROW) {
+            continue;
+          }
+          if (visible != row) {
+            copy_pin.moveTo(visible / Column::BLOCK_SIZE);
+            if (where && !evaluateCondition(*where, &visible)) {
+              continue;
+            }
+          }
+          if (!pass(visible)) {
+            return;
+          }
+        }
+        continue;
+      }
+      bool has_dead = block < block_dead_rows.size() &&
+                      block_dead_rows[block] > 0;
+      for (size_t i = 0; i < rows; i++) {
+        if (matches[i] && !(has_dead && deleted[begin + i]) &&
+            !pass(begin + i)) {
+          return;
+        }
+      }
+    }
+  }
+
+  // Decide a single table condition for a whole block from the zone maps of
+  // the columns it compares, where the bounds are enough
+  RangeMatch matchZones(const CompiledCondition &condition,
+                        size_t block) const {
+    switch (condition.kind) {
+    case CompiledCondition::Kind::COMPARE: {
+      const Column &column = *condition.left.column;
+      const ZoneMap &zone = column.zone(block);
+      if (condition.right.column) {
+        return RangeMatch::SOME;
+      }
+      // A value missing from the dictionary or the block's Bloom filter
+      // equals no row of the block
+      if ((condition.op == TokenType::EQUALS ||
+           condition.op == TokenType::INEQUALS) &&
+          ((condition.mode == CompiledCondition::Mode::CODE &&
+            condition.literal_code == Column::NO_CODE) ||
+           !column.blockMayContain(block, condition.literal_hash))) {
+        return condition.op == TokenType::EQUALS ? RangeMatch::NONE
+                                                 : RangeMatch::ALL;
+      }
+      if (!zone.bounded) {
+        return RangeMatch::SOME;
+      }
+      switch (condition.mode) {
+      case CompiledCondition::Mode::INT:
+        return matchRange(zone.min.asInt(), zone.max.asInt(),
+                          condition.literal_int, condition.op);
+      case CompiledCondition::Mode::FLOAT:
+        return matchRange(zone.min.asFloat(), zone.max.asFloat(),
+                          condition.literal_float, condition.op);
+      default:
+        return matchRange(std::string_view(zone.min_text),
+                          std::string_view(zone.max_text),
+                          std::string_view(condition.literal_text),
+                          condition.op);
+      }
+    }
+    case CompiledCondition::Kind::AND:
+    case CompiledCondition::Kind::OR: {
+      // AND is NONE if either side is, OR is ALL if either side is
+      RangeMatch decisive = condition.kind == CompiledCondition::Kind::AND
+                                ? RangeMatch::NONE
+                                : RangeMatch::ALL;
+      RangeMatch lhs = matchZones(*condition.lhs, block);
+      RangeMatch rhs = matchZones(*condition.rhs, block);
+      if (lhs == decisive || rhs == decisive) {
+        return decisive;
+      }
+      return lhs == rhs ? lhs : RangeMatch::SOME;
+    }
+    case CompiledCondition::Kind::CONSTANT:
+      return condition.constant ? RangeMatch::ALL : RangeMatch::NONE;
+    default:
+      return RangeMatch::SOME; // Evaluate, so the error is raised
+    }
+  }
+
+  // Blocks of scratch flags evaluateBlock needs for a condition: one for
+  // the right side of each AND or OR still pending
+  static size_t scratchBlocks(const CompiledCondition &condition) {
+    if (condition.kind != CompiledCondition::Kind::AND &&
+        condition.kind != CompiledCondition::Kind::OR) {
+      return 0;
+    }
+    return std::max(scratchBlocks(*condition.lhs),
+                    1 + scratchBlocks(*condition.rhs));
+  }
+
+  // Evaluate a single table condition for `rows` rows starting at the
+  // block boundary `begin`. Comparing a numeric column with a literal runs
+  // on the compressed block; other comparisons go row by row. `scratch`
+  // holds scratchBlocks(condition) blocks of flags.
+  void evaluateBlock(const CompiledCondition &condition, size_t begin,
+                     size_t rows, uint8_t *matches, uint8_t *scratch) const {
+    switch (condition.kind) {
+    case CompiledCondition::Kind::COMPARE: {
+      const Column &left = *condition.left.column;
+      if (!condition.right.column && left.isNumeric()) {
+        const NumericBlock &block = left.block(begin / Column::BLOCK_SIZE);
+        if (condition.mode == CompiledCondition::Mode::INT) {
+          block.compareInt(condition.op, condition.literal_int, matches);
+        } else {
+          block.compareDouble(condition.op, condition.literal_float, matches);
+        }
+        return;
+      }
+      for (size_t i = 0; i < rows; i++) {
+        size_t row = begin + i;
+        matches[i] = compareValues(condition, &row);
+      }
+      return;
+    }
+    case CompiledCondition::Kind::AND:
+    case CompiledCondition::Kind::OR: {
+      bool is_and = condition.kind == CompiledCondition::Kind::AND;
+      evaluateBlock(*condition.lhs, begin, rows, matches, scratch);
+      // Skip the right side when the left already decides every row
+      if (std::all_of(matches, matches + rows,
+                      [&](uint8_t match) { return match != is_and; })) {
+        return;
+      }
+      uint8_t *other = scratch;
+      evaluateBlock(*condition.rhs, begin, rows, other,
+                    scratch + Column::BLOCK_SIZE);
+      for (size_t i = 0; i < rows; i++) {
+        matches[i] = is_and ? matches[i] && other[i] : matches[i] || other[i];
+      }
+      return;
+    }
+    case CompiledCondition::Kind::CONSTANT:
+      std::fill(matches, matches + rows, condition.constant);
+      return;
+    default:
+      std::rethrow_exception(condition.error);
+    }
+  }
+
+  bool evaluateCondition(const CompiledCondition &condition,
+                         const size_t *row_ids) const {
+    switch (condition.kind) {
+    case CompiledCondition::Kind::COMPARE:
+      return compareValues(condition, row_ids);
+    case CompiledCondition::Kind::AND:
+      return evaluateCondition(*condition.lhs, row_ids) &&
+             evaluateCondition(*condition.rhs, row_ids);
+    case CompiledCondition::Kind::OR:
+      return evaluateCondition(*condition.lhs, row_ids) ||
+             evaluateCondition(*condition.rhs, row_ids);
+    case CompiledCondition::Kind::CONSTANT:
+      return condition.constant;
+    default:
+      std::rethrow_exception(condition.error);
+    }
+  }
+
   std::string name;
+  BufferPool &pool;
+  mutable std::shared_mutex lock;
   std::vector<ColumnDefinition> columns;
-  std::list<std::vector<Value>> rows;
-  std::unordered_map<std::string, size_t> column_index;
-
-  bool compareValues(const std::string &column_name, TokenType condition_type,
-                     const Value &value, const std::vector<Value> &row) {
-    // Find column index
-    auto it = column_index.find(column_name);
-    if (it == column_index.end()) {
-      throw TableError("Column not found");
-    }
-    size_t index = it->second;
-
-    // Compare value with row value
-    const auto &row_value = row[index];
-    if (std::holds_alternative<int>(value) &&
-        std::holds_alternative<int>(row_value)) {
-      int val = std::get<int>(value);
-      int row_val = std::get<int>(row_value);
-      switch (condition_type) {
-      case TokenType::EQUALS:
-        return row_val == val;
-      case TokenType::INEQUALS:
-        return row_val != val;
-      case TokenType::LESS_THAN:
-        return row_val < val;
-      case TokenType::GREATER_THAN:
-        return row_val > val;
-      default:
-        throw TableError("Invalid condition type");
-      }
-    } else if (std::holds_alternative<double>(value) &&
-               std::holds_alternative<double>(row_value)) {
-      double val = std::get<double>(value);
-      double row_val = std::get<double>(row_value);
-      switch (condition_type) {
-      case TokenType::EQUALS:
-        return row_val == val;
-      case TokenType::INEQUALS:
-        return row_val != val;
-      case TokenType::LESS_THAN:
-        return row_val < val;
-      case TokenType::GREATER_THAN:
-        return row_val > val;
-      default:
-        throw TableError("Invalid condition type");
-      }
-    } else if (std::holds_alternative<std::string>(value) &&
-               std::holds_alternative<std::string>(row_value)) {
-      std::string val = std::get<std::string>(value);
-      std::string row_val = std::get<std::string>(row_value);
-      switch (condition_type) {
-      case TokenType::EQUALS:
-        return row_val == val;
-      case TokenType::INEQUALS:
-        return row_val != val;
-      default:
-        throw TableError("Invalid condition type");
+  std::deque<Column> column_data; // Columns never move
+  size_t row_count = 0; // Including deleted rows not yet vacuumed
+  std::unordered_map<std::string_view, size_t> column_index; // Keys view
+                                                              // columns
+
+  // DELETE only marks rows; they are dropped from storage by vacuum() on
+  // VACUUM, at checkpoints, and once this fraction of the rows is dead (see
+  // vacuumDue())
+  static constexpr double MAX_DEAD_FRACTION = 0.25;
+
+  // Bounds the temporary files a partitioned join keeps open
+  static constexpr size_t MAX_JOIN_PARTITIONS = 256;
+  std::vector<bool> deleted;
+  std::vector<size_t> block_dead_rows; // Per block, may be shorter
+  size_t dead_rows = 0;
+
+  static constexpr size_t NO_ROW = SIZE_MAX;
+  static constexpr uint64_t NO_VERSION = UINT64_MAX;
+
+  // How a row changed while snapshots from before the change were in use.
+  // The row holds its values as of `begin`; older snapshots see those of
+  // `previous`, a copy of the values it replaced, appended as a deleted
+  // row with an entry of its own whose `end` is the version that replaced
+  // them. Rows without an entry are as every snapshot in use sees them.
+  struct RowVersion {
+    uint64_t begin = 0;        // Version that wrote the row's values
+    uint64_t end = NO_VERSION; // Version that deleted it
+    size_t previous = NO_ROW;
+  };
+
+  // A value an UPDATE writes
+  struct ValueChange {
+    size_t row;
+    size_t column;
+    Value value;
+  };
+
+  // Changes being applied become visible as version + 1 at commit(). In a
+  // transaction that waits for it to end, so the changes of all its
+  // statements are pending as version + 1 until then.
+  mutable StorageLatch storage_latch;
+  std::mutex write_lock;
+  uint64_t version = 0;
+  std::map<uint64_t, size_t> snapshots; // In use, counted by version
+  std::unordered_map<size_t, RowVersion> versions;
+  uint64_t newest_row_version = 0; // In `versions`
+  uint64_t transaction = NO_TRANSACTION; // With changes pending
+  size_t transaction_rows = 0; // Rows before those it inserted
+
+  // Needs the storage latch exclusively
+  Snapshot openSnapshot(uint64_t reader) {
+    Snapshot snapshot{version, row_count};
+    if (transaction != NO_TRANSACTION) {
+      snapshot = reader == transaction ? Snapshot{version + 1, row_count}
+                                       : Snapshot{version, transaction_rows};
+    }
+    snapshots[snapshot.version]++;
+    return snapshot;
+  }
+
+  void closeSnapshot(const Snapshot &snapshot) {
+    std::lock_guard<StorageLatch> latch(storage_latch);
+    auto it = snapshots.find(snapshot.version);
+    if (--it->second == 0) {
+      snapshots.erase(it);
+    }
+    collectVersions();
+  }
+
+  // Forget row versions once every snapshot in use sees the latest. Their
+  // copies are deleted rows, dropped by vacuum() like any other. Those of
+  // a transaction are kept until it ends, as a rollback needs them.
+  void collectVersions() {
+    if (transaction != NO_TRANSACTION) {
+      return;
+    }
+    if (snapshots.empty() || snapshots.begin()->first >= newest_row_version) {
+      versions.clear();
+    }
+  }
+
+  // Make the changes applied so far visible to snapshots taken from now on.
+  // Switching a column's encoding would change what running readers rely
+  // on, so it waits for a commit without any. Moving rows is left to the
+  // database (see Database::compactIfDue).
+  void commit() {
+    version++;
+    collectVersions();
+    if (!snapshots.empty()) {
+      return;
+    }
+    for (auto &column : column_data) {
+      column.maybeDropDictionary();
+    }
+  }
+
+  // Commit a statement's changes, unless they belong to a transaction
+  void finishChange() {
+    if (transaction == NO_TRANSACTION) {
+      commit();
+    }
+  }
+
+  // Whether changes need to keep what the rows held before
+  bool keepsVersions() const {
+    return !snapshots.empty() || transaction != NO_TRANSACTION;
+  }
+
+  // Whether `row` needs a copy of its values before the pending changes
+  // replace them. A transaction copies a row once, and none of those it
+  // inserted, which nobody else sees.
+  bool needsCopy(size_t row) const {
+    if (!keepsVersions() ||
+        (transaction != NO_TRANSACTION && row >= transaction_rows)) {
+      return false;
+    }
+    auto it = versions.find(row);
+    return it == versions.end() || it->second.begin != version + 1;
+  }
+
+  void markDeleted(size_t row) {
+    deleted[row] = true;
+    size_t block = row / Column::BLOCK_SIZE;
+    if (block >= block_dead_rows.size()) {
+      block_dead_rows.resize(block + 1);
+    }
+    block_dead_rows[block]++;
+    dead_rows++;
+    if (keepsVersions()) {
+      versions[row].end = version + 1;
+      newest_row_version = version + 1;
+    }
+  }
+
+  // Undo markDeleted() for a row whose deletion is rolled back
+  void markLive(size_t row) {
+    deleted[row] = false;
+    block_dead_rows[row / Column::BLOCK_SIZE]--;
+    dead_rows--;
+  }
+
+  // Copy the values `row` has now for the snapshots in use, or for a
+  // rollback, before they are replaced
+  void preserveRow(size_t row) {
+    std::vector<Value> values(columns.size());
+    {
+      BlockPin pin(*this, row / Column::BLOCK_SIZE);
+      loadRow(row, values.data());
+      for (size_t i = 0; i < values.size(); i++) {
+        column_data[i].append(values[i]);
       }
-    } else {
-      throw TableError("Value types do not match");
+    }
+    size_t copy = row_count++;
+    deleted.push_back(false);
+    markDeleted(copy);
+    RowVersion &current = versions[row];
+    versions[copy] = {current.begin, version + 1, current.previous};
+    current.begin = version + 1;
+    current.previous = copy;
+  }
+
+  // The row holding the values the snapshot sees for `row`, NO_ROW if it
+  // sees none. Needs the storage latch.
+  size_t visibleRow(size_t row, const Snapshot &snapshot) const {
+    if (row >= snapshot.rows) {
+      return NO_ROW;
+    }
+    auto it = versions.empty() ? versions.end() : versions.find(row);
+    if (it == versions.end()) {
+      return isDeleted(row) ? NO_ROW : row;
+    }
+    while (it->second.begin > snapshot.version) {
+      row = it->second.previous;
+      it = versions.find(row);
+    }
+    return it->second.end > snapshot.version ? row : NO_ROW;
+  }
+
+  // False only if no row of the block can be visible, with the snapshot
+  // if given
+  bool mayHaveVisibleRows(size_t block, const Snapshot *snapshot) const {
+    return (snapshot && !versions.empty()) || hasLiveRows(block);
+  }
+
+  // At least the number of rows the snapshot sees. Without row versions a
+  // snapshot of every row sees none of the deleted ones. One of fewer rows
+  // may not: rows appended after it, such as the copies a rolled back
+  // transaction leaves, are deleted without versions too.
+  size_t visibleRowBound(const Snapshot &snapshot) const {
+    return versions.empty() && snapshot.rows == row_count
+               ? row_count - dead_rows
+               : snapshot.rows;
+  }
+
+  static bool matchesType(const Value &value, TokenType type) {
+    switch (type) {
+    case TokenType::INTEGER:
+      return value.isInt();
+    case TokenType::FLOAT:
+      return value.isFloat();
+    default:
+      return value.isText();
+    }
+  }
+
+  bool isDeleted(size_t row) const { return dead_rows > 0 && deleted[row]; }
+
+  bool hasLiveRows(size_t block) const {
+    return block >= block_dead_rows.size() ||
+           block_dead_rows[block] <
+               std::min(Column::BLOCK_SIZE,
+                        row_count - block * Column::BLOCK_SIZE);
+  }
+
+  // Evaluate one COMPARE node against the current row of each table
+  static bool compareValues(const CompiledCondition &condition,
+                            const size_t *row_ids) {
+    const Column &left = *condition.left.column;
+    const Column *right = condition.right.column;
+    size_t left_row = row_ids[condition.left.table];
+    size_t right_row = right ? row_ids[condition.right.table] : 0;
+
+    switch (condition.mode) {
+    case CompiledCondition::Mode::INT:
+      return compareOrdered(left.getInt(left_row),
+                            right ? right->getInt(right_row)
+                                  : condition.literal_int,
+                            condition.op);
+    case CompiledCondition::Mode::FLOAT:
+      return compareOrdered(left.getFloat(left_row),
+                            right ? right->getFloat(right_row)
+                                  : condition.literal_float,
+                            condition.op);
+    case CompiledCondition::Mode::CODE: {
+      uint32_t code = left.getCode(left_row);
+      bool equal = right ? condition.code_map[code] == right->getCode(right_row)
+                         : code == condition.literal_code;
+      return condition.op == TokenType::EQUALS ? equal : !equal;
+    }
+    default:
+      return compareOrdered(left.getText(left_row),
+                            right ? right->getText(right_row)
+                                  : std::string_view(condition.literal_text),
+                            condition.op);
     }
   }
 };
\ No newline at end of file
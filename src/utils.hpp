@@ -1,15 +1,25 @@
 #pragma once
 
 // Standard library includes
+#include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
 #include <fstream>
-#include <iomanip>
 #include <iostream>
 #include <memory>
+#include <mutex>
+#include <new>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
 #include <unordered_map>
-#include <variant>
+#include <utility>
 #include <vector>
 
 //-----------------------------------------------------------------------------
@@ -82,8 +92,217 @@ public:
 // SQL types and tokens
 //-----------------------------------------------------------------------------
 
-// Value type for storing SQL data (can be string, int, or double)
-using Value = std::variant<std::string, int, double>;
+// A SQL value in 16 bytes: an INTEGER, a FLOAT or a TEXT string. Strings of
+// up to INLINE_CAPACITY bytes live inside the value; longer ones are only
+// referenced, and their bytes must outlive the value (they belong to a
+// column or to the arena of the statement being run). Copies are therefore
+// plain 16 byte copies.
+//
+// Values of different kinds order TEXT < INTEGER < FLOAT, the order the
+// std::variant<std::string, int, double> used before had.
+class Value {
+public:
+  enum class Kind : uint8_t { TEXT, INTEGER, FLOAT };
+  static constexpr size_t INLINE_CAPACITY = 14;
+
+  Value() : inline_size(0), kind(Kind::TEXT) {}
+  Value(int value) : kind(Kind::INTEGER) {
+    std::memcpy(payload, &value, sizeof(value));
+  }
+  Value(double value) : kind(Kind::FLOAT) {
+    std::memcpy(payload, &value, sizeof(value));
+  }
+  explicit Value(std::string_view text) : kind(Kind::TEXT) {
+    if (text.size() <= INLINE_CAPACITY) {
+      inline_size = static_cast<uint8_t>(text.size());
+      if (inline_size > 0) {
+        std::memcpy(payload, text.data(), inline_size);
+      }
+      return;
+    }
+    const char *data = text.data();
+    uint32_t size = static_cast<uint32_t>(text.size());
+    std::memcpy(payload, &data, sizeof(data));
+    std::memcpy(payload + sizeof(data), &size, sizeof(size));
+    inline_size = LONG_TEXT;
+  }
+
+  Kind getKind() const { return kind; }
+  bool isInt() const { return kind == Kind::INTEGER; }
+  bool isFloat() const { return kind == Kind::FLOAT; }
+  bool isText() const { return kind == Kind::TEXT; }
+  bool isNumeric() const { return kind != Kind::TEXT; }
+
+  // The accessors assume the matching kind
+  int asInt() const {
+    int value;
+    std::memcpy(&value, payload, sizeof(value));
+    return value;
+  }
+  double asFloat() const {
+    double value;
+    std::memcpy(&value, payload, sizeof(value));
+    return value;
+  }
+  std::string_view asText() const {
+    if (inline_size != LONG_TEXT) {
+      return {payload, inline_size};
+    }
+    const char *data;
+    uint32_t size;
+    std::memcpy(&data, payload, sizeof(data));
+    std::memcpy(&size, payload + sizeof(data), sizeof(size));
+    return {data, size};
+  }
+  // INTEGER or FLOAT as a double
+  double toDouble() const { return isInt() ? asInt() : asFloat(); }
+
+  // True if a TEXT value references bytes outside itself
+  bool isLongText() const { return isText() && inline_size == LONG_TEXT; }
+
+  friend bool operator==(const Value &a, const Value &b) {
+    if (a.kind != b.kind) {
+      return false;
+    }
+    switch (a.kind) {
+    case Kind::INTEGER:
+      return a.asInt() == b.asInt();
+    case Kind::FLOAT:
+      return a.asFloat() == b.asFloat();
+    default:
+      return a.asText() == b.asText();
+    }
+  }
+  friend bool operator<(const Value &a, const Value &b) {
+    if (a.kind != b.kind) {
+      return a.kind < b.kind;
+    }
+    switch (a.kind) {
+    case Kind::INTEGER:
+      return a.asInt() < b.asInt();
+    case Kind::FLOAT:
+      return a.asFloat() < b.asFloat();
+    default:
+      return a.asText() < b.asText();
+    }
+  }
+  friend bool operator!=(const Value &a, const Value &b) { return !(a == b); }
+  friend bool operator>(const Value &a, const Value &b) { return b < a; }
+
+  friend std::ostream &operator<<(std::ostream &out, const Value &value) {
+    switch (value.kind) {
+    case Kind::INTEGER:
+      return out << value.asInt();
+    case Kind::FLOAT:
+      return out << value.asFloat();
+    default:
+      return out << value.asText();
+    }
+  }
+
+private:
+  static constexpr uint8_t LONG_TEXT = UINT8_MAX;
+
+  // An int, a double, inline string bytes, or the pointer and 32-bit length
+  // of a longer string
+  alignas(8) char payload[INLINE_CAPACITY];
+  uint8_t inline_size; // Inline TEXT length, LONG_TEXT if referenced
+  Kind kind;
+};
+static_assert(sizeof(Value) == 16, "Value should stay 16 bytes");
+
+// Bump allocator. Memory is handed out from large chunks and only given
+// back all at once, by reset() or when the arena goes away. Nothing is
+// destroyed individually, so create() only takes trivially destructible
+// types. Chunks never move, so pointers and the string views store() hands
+// out stay valid across moves of the arena.
+//
+// Statements use one for their tokens, syntax trees and scratch buffers;
+// columns use one for the bytes of their strings.
+class Arena {
+public:
+  static constexpr size_t DEFAULT_CHUNK_SIZE = 64 * 1024;
+
+  explicit Arena(size_t chunk_size = DEFAULT_CHUNK_SIZE)
+      : chunk_size(chunk_size) {}
+  Arena(const Arena &) = delete;
+  Arena &operator=(const Arena &) = delete;
+  Arena(Arena &&) = default;
+  Arena &operator=(Arena &&) = default;
+
+  void *allocate(size_t size, size_t align = alignof(std::max_align_t)) {
+    if (size > chunk_size / 4) {
+      // Large requests get memory of their own
+      large.push_back(std::make_unique<char[]>(size));
+      large_bytes += size;
+      return large.back().get();
+    }
+    size_t offset = (chunk_used + align - 1) & ~(align - 1);
+    if (chunks.empty() || offset + size > chunk_size) {
+      chunks.push_back(std::make_unique<char[]>(chunk_size));
+      offset = 0;
+    }
+    chunk_used = offset + size;
+    return chunks.back().get() + offset;
+  }
+
+  template <typename T, typename... Args> T *create(Args &&...args) {
+    static_assert(std::is_trivially_destructible_v<T>,
+                  "Arena objects are never destroyed");
+    return new (allocate(sizeof(T), alignof(T)))
+        T(std::forward<Args>(args)...);
+  }
+
+  // n value-initialized objects
+  template <typename T> T *allocateArray(size_t n) {
+    static_assert(std::is_trivially_destructible_v<T>,
+                  "Arena objects are never destroyed");
+    T *array = static_cast<T *>(allocate(sizeof(T) * n, alignof(T)));
+    std::uninitialized_value_construct_n(array, n);
+    return array;
+  }
+
+  std::string_view store(std::string_view text) {
+    if (text.empty()) {
+      return {};
+    }
+    char *data = static_cast<char *>(allocate(text.size(), 1));
+    std::memcpy(data, text.data(), text.size());
+    return {data, text.size()};
+  }
+
+  // The same value, with the bytes of a long string copied into the arena
+  Value copy(const Value &value) {
+    return value.isLongText() ? Value(store(value.asText())) : value;
+  }
+
+  // Release everything allocated so far, keeping one chunk for reuse
+  void reset() {
+    if (chunks.size() > 1) {
+      chunks.erase(chunks.begin() + 1, chunks.end());
+    }
+    chunk_used = 0;
+    large.clear();
+    large_bytes = 0;
+  }
+
+  // Release everything, including the memory kept by reset()
+  void clear() {
+    chunks.clear();
+    reset();
+  }
+
+  size_t memoryBytes() const {
+    return chunks.size() * chunk_size + large_bytes;
+  }
+
+private:
+  size_t chunk_size;
+  std::vector<std::unique_ptr<char[]>> chunks; // The last one is filling
+  size_t chunk_used = 0;
+  std::vector<std::unique_ptr<char[]>> large;
+  size_t large_bytes = 0;
+};
 
 // All possible SQL token types
 enum class TokenType {
@@ -107,6 +326,13 @@ enum class TokenType {
   ON,
   AND,
   OR,
+  LIMIT,
+  VACUUM,
+  BEGIN,
+  COMMIT,
+  ROLLBACK,
+  EXPLAIN,
+  ANALYZE,
 
   // Data types
   INTEGER,
@@ -148,7 +374,11 @@ const std::unordered_map<std::string, TokenType> TOKEN_MAP = {
     {"SET", TokenType::SET},       {"DELETE", TokenType::DELETE},
     {"INNER", TokenType::INNER},   {"JOIN", TokenType::JOIN},
     {"ON", TokenType::ON},         {"AND", TokenType::AND},
-    {"OR", TokenType::OR},         {"INTEGER", TokenType::INTEGER},
+    {"OR", TokenType::OR},         {"LIMIT", TokenType::LIMIT},
+    {"VACUUM", TokenType::VACUUM}, {"BEGIN", TokenType::BEGIN},
+    {"COMMIT", TokenType::COMMIT}, {"ROLLBACK", TokenType::ROLLBACK},
+    {"EXPLAIN", TokenType::EXPLAIN}, {"ANALYZE", TokenType::ANALYZE},
+    {"INTEGER", TokenType::INTEGER},
     {"FLOAT", TokenType::FLOAT},   {"TEXT", TokenType::TEXT},
     {",", TokenType::COMMA},       {";", TokenType::SEMICOLON},
     {"(", TokenType::LEFT_PAREN},  {")", TokenType::RIGHT_PAREN},
@@ -178,6 +408,13 @@ const std::unordered_map<TokenType, std::string> TOKEN_STR = {
     {TokenType::ON, "ON"},
     {TokenType::AND, "AND"},
     {TokenType::OR, "OR"},
+    {TokenType::LIMIT, "LIMIT"},
+    {TokenType::VACUUM, "VACUUM"},
+    {TokenType::BEGIN, "BEGIN"},
+    {TokenType::COMMIT, "COMMIT"},
+    {TokenType::ROLLBACK, "ROLLBACK"},
+    {TokenType::EXPLAIN, "EXPLAIN"},
+    {TokenType::ANALYZE, "ANALYZE"},
     {TokenType::INTEGER, "INTEGER"},
     {TokenType::FLOAT, "FLOAT"},
     {TokenType::TEXT, "TEXT"},
@@ -203,13 +440,15 @@ const std::unordered_map<TokenType, std::string> TOKEN_STR = {
 // SQL statement types and structures
 //-----------------------------------------------------------------------------
 
-// Token structure for lexical analysis
+// Token structure for lexical analysis. The text lives in the arena of the
+// statement it belongs to.
 struct Token {
   TokenType type;
-  std::string value;
+  std::string_view value;
   int line_number;
 
-  Token(TokenType t = TokenType::EOF_TOKEN, std::string v = "", int line = 1)
+  Token(TokenType t = TokenType::EOF_TOKEN, std::string_view v = {},
+        int line = 1)
       : type(t), value(v), line_number(line) {}
 };
 
@@ -223,10 +462,16 @@ enum class SQLStatementType {
   SELECT,
   UPDATE,
   DELETE,
-  INNER_JOIN
+  INNER_JOIN,
+  VACUUM,
+  BEGIN,
+  COMMIT,
+  ROLLBACK,
+  EXPLAIN
 };
 
-// Structure for WHERE conditions in SQL statements
+// Structure for WHERE conditions in SQL statements. Nodes are allocated in
+// the statement's arena.
 struct WhereCondition {
   // Node type for the condition tree
   enum class NodeType {
@@ -237,14 +482,14 @@ struct WhereCondition {
   NodeType type;
 
   // For LEAF nodes
-  std::string column_name;  // Column name for comparison
+  std::string_view column_name; // Column name for comparison
   TokenType condition_type; // Comparison operator (>, <, =, !=)
   Token value;              // Value to compare against
 
   // For OPERATOR nodes
-  TokenType logic_operator;              // AND/OR operator
-  std::unique_ptr<WhereCondition> left;  // Left subtree
-  std::unique_ptr<WhereCondition> right; // Right subtree
+  TokenType logic_operator;        // AND/OR operator
+  WhereCondition *left = nullptr;  // Left subtree
+  WhereCondition *right = nullptr; // Right subtree
 
   // Constructor
   WhereCondition(NodeType t = NodeType::LEAF) : type(t) {}
@@ -257,19 +502,23 @@ enum class ExprNodeType {
   PARENTHESIS // Parenthesized expression
 };
 
-// Expression node for parsing arithmetic expressions
+// Expression node for parsing arithmetic expressions, allocated in the
+// statement's arena
 struct ExpressionNode {
   ExprNodeType type;
   Token token; // For values and operators
-  std::vector<std::unique_ptr<ExpressionNode>> children;
+  ExpressionNode *children[2] = {nullptr, nullptr};
+  size_t child_count = 0;
 
   ExpressionNode(ExprNodeType t, Token tok) : type(t), token(tok) {}
+
+  void addChild(ExpressionNode *child) { children[child_count++] = child; }
 };
 
 // Structure for SET conditions in UPDATE statements
 struct SetCondition {
   std::string target_column;
-  std::unique_ptr<ExpressionNode> expression;
+  ExpressionNode *expression = nullptr;
 };
 
 // Structure for column definitions in CREATE TABLE statements
@@ -286,74 +535,6 @@ struct Statement {
       : content(content), start_line(line) {}
 };
 
-//-----------------------------------------------------------------------------
-// Output handling
-//-----------------------------------------------------------------------------
-
-// Class for handling output to files
-class OutputWriter {
-private:
-  std::ofstream file;
-
-public:
-  explicit OutputWriter() = default;
-
-  void open(const std::string &filename) {
-    file.open(filename);
-    if (!file.is_open()) {
-      throw FileError("Failed to open output file");
-    }
-  }
-
-  void writeColumnNames(const std::vector<Value> &row) {
-    for (const auto &value : row) {
-      file << std::get<std::string>(value);
-      if (&value != &row.back()) {
-        file << ",";
-      }
-    }
-  }
-
-  void write(const std::string &data) { file << "\'" << data << "\'"; }
-  void write(int data) { file << data; }
-  void write(double data) {
-    file << std::fixed << std::setprecision(2) << data;
-  }
-
-  void write(const Value &data) {
-    if (std::holds_alternative<int>(data)) {
-      write(std::get<int>(data));
-    } else if (std::holds_alternative<double>(data)) {
-      write(std::get<double>(data));
-    } else if (std::holds_alternative<std::string>(data)) {
-      write(std::get<std::string>(data));
-    }
-  }
-
-  void write(const std::vector<Value> &row) {
-    for (const auto &value : row) {
-      write(value);
-      if (&value != &row.back()) {
-        file << ",";
-      }
-    }
-  }
-
-  void write(const std::vector<std::vector<Value>> &rows) {
-    for (const auto &row : rows) {
-      if (&row != &rows.front()) {
-        write(row);
-      } else {
-        writeColumnNames(row);
-      }
-      file << "\n";
-    }
-    file << "---\n";
-  }
-};
-
-extern OutputWriter file_writer;
-
 //-----------------------------------------------------------------------------
 // Utility functions
 //-----------------------------------------------------------------------------
@@ -362,20 +543,73 @@ extern OutputWriter file_writer;
 Value convertTokenToValue(const Token &token) {
   switch (token.type) {
   case TokenType::INTEGER_LITERAL:
-    return std::stoi(token.value);
+    return std::stoi(std::string(token.value));
   case TokenType::FLOAT_LITERAL:
-    return std::stod(token.value);
+    return std::stod(std::string(token.value));
   case TokenType::STRING_LITERAL:
   case TokenType::IDENTIFIER: // Allow identifiers to be converted to string
-                              // values
-    return token.value;
+                              // values; long strings refer to the token
+    return Value(token.value);
   default:
     throw ParseError("Invalid token type for value conversion");
   }
 }
 
+// Apply a comparison operator to two values of the same type
+template <typename T>
+inline bool compareOrdered(const T &row_val, const T &val,
+                           TokenType condition_type) {
+  switch (condition_type) {
+  case TokenType::EQUALS:
+    return row_val == val;
+  case TokenType::INEQUALS:
+    return row_val != val;
+  case TokenType::LESS_THAN:
+    return row_val < val;
+  case TokenType::GREATER_THAN:
+    return row_val > val;
+  default:
+    throw TableError("Invalid condition type");
+  }
+}
+
+// How a comparison turns out across a range of values
+enum class RangeMatch { NONE, SOME, ALL };
+
+// Decide `value OP literal` for every value in [lo, hi] at once, if the
+// bounds alone are enough
+template <typename T>
+inline RangeMatch matchRange(const T &lo, const T &hi, const T &literal,
+                             TokenType condition_type) {
+  switch (condition_type) {
+  case TokenType::EQUALS:
+  case TokenType::INEQUALS: {
+    bool inequal = condition_type == TokenType::INEQUALS;
+    if (literal < lo || hi < literal) {
+      return inequal ? RangeMatch::ALL : RangeMatch::NONE;
+    }
+    if (!(lo < hi)) {
+      return inequal ? RangeMatch::NONE : RangeMatch::ALL;
+    }
+    return RangeMatch::SOME;
+  }
+  case TokenType::LESS_THAN:
+    if (hi < literal) {
+      return RangeMatch::ALL;
+    }
+    return lo < literal ? RangeMatch::SOME : RangeMatch::NONE;
+  case TokenType::GREATER_THAN:
+    if (literal < lo) {
+      return RangeMatch::ALL;
+    }
+    return literal < hi ? RangeMatch::SOME : RangeMatch::NONE;
+  default:
+    throw TableError("Invalid condition type");
+  }
+}
+
 // Split input into individual SQL statements
-std::vector<Statement> splitStatements(std::ifstream &input_file) {
+std::vector<Statement> splitStatements(std::istream &input_file) {
   std::vector<Statement> statements;
   std::string current_statement;
   std::string line;
@@ -435,10 +669,11 @@ std::vector<Statement> splitStatements(std::ifstream &input_file) {
 }
 
 // Token recognition
-inline Token recognizeToken(std::string token) {
+inline TokenType recognizeToken(const std::string &token) {
   // Check for keywords first
-  if (TOKEN_MAP.find(token) != TOKEN_MAP.end()) {
-    return Token(TOKEN_MAP.at(token), token);
+  auto keyword = TOKEN_MAP.find(token);
+  if (keyword != TOKEN_MAP.end()) {
+    return keyword->second;
   }
 
   // Check for integer literal
@@ -453,7 +688,7 @@ inline Token recognizeToken(std::string token) {
     }
   }
   if (is_integer) {
-    return Token(TokenType::INTEGER_LITERAL, token);
+    return TokenType::INTEGER_LITERAL;
   }
 
   // Check for float literal
@@ -473,11 +708,11 @@ inline Token recognizeToken(std::string token) {
     }
   }
   if (is_float && has_dot) {
-    return Token(TokenType::FLOAT_LITERAL, token);
+    return TokenType::FLOAT_LITERAL;
   }
 
   // If not a keyword or number, it's an identifier
-  return Token(TokenType::IDENTIFIER, token);
+  return TokenType::IDENTIFIER;
 }
 
 // Stream output operator for TokenType
@@ -489,4 +724,49 @@ inline std::ostream &operator<<(std::ostream &os, const TokenType &type) {
     os << "UNKNOWN";
   }
   return os;
-}
\ No newline at end of file
+}
+
+//-----------------------------------------------------------------------------
+// Parallel work
+//-----------------------------------------------------------------------------
+
+// Threads to spread work over by default: one per core
+inline unsigned hardwareThreads() {
+  return std::max(1u, std::thread::hardware_concurrency());
+}
+
+// Run task(i) for every i below `count`, on up to `threads` threads with
+// the calling one among them, each taking the next i as it finishes one.
+// Once all are done, the first exception a task threw is rethrown; tasks
+// not started by then are skipped.
+template <typename Task>
+void parallelFor(size_t count, Task task,
+                 unsigned threads = hardwareThreads()) {
+  std::atomic<size_t> next{0};
+  std::mutex error_lock;
+  std::exception_ptr error;
+  auto work = [&] {
+    for (size_t i; (i = next++) < count;) {
+      try {
+        task(i);
+      } catch (...) {
+        std::lock_guard<std::mutex> guard(error_lock);
+        if (!error) {
+          error = std::current_exception();
+        }
+        next = count;
+      }
+    }
+  };
+  std::vector<std::thread> workers;
+  for (size_t t = 1; t < std::min<size_t>(threads, count); t++) {
+    workers.emplace_back(work);
+  }
+  work();
+  for (auto &worker : workers) {
+    worker.join();
+  }
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
@@ -0,0 +1,4 @@
+USE DATABASE bench_200;
+SELECT id, grp, price FROM items WHERE id > 30 AND id < 36;
+SELECT id FROM items WHERE id = 114 OR id = 159;
+SELECT id FROM items WHERE id > 198;
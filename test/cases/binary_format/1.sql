@@ -0,0 +1,1144 @@
+CREATE DATABASE shop;
+USE DATABASE shop;
+CREATE TABLE items (id INTEGER, qty INTEGER, price FLOAT, name TEXT);
+CREATE TABLE orders (id INTEGER, item_id INTEGER);
+INSERT INTO items VALUES (0, -11, 0.00, '');
+INSERT INTO items VALUES (1, -4, 1.13, 'item1');
+INSERT INTO items VALUES (2, 3, 2.26, 'item2');
+INSERT INTO items VALUES (3, 10, 3.39, 'item3');
+INSERT INTO items VALUES (4, -6, 4.52, 'item4');
+INSERT INTO items VALUES (5, 1, 5.65, 'item5');
+INSERT INTO items VALUES (6, 8, 6.78, 'item6');
+INSERT INTO items VALUES (7, -8, 7.91, 'item7');
+INSERT INTO items VALUES (8, -1, 8.04, 'item8');
+INSERT INTO items VALUES (9, 6, 9.17, 'item9');
+INSERT INTO items VALUES (10, -10, 10.30, '');
+INSERT INTO items VALUES (11, -3, 11.43, 'item11');
+INSERT INTO items VALUES (12, 4, 12.56, 'item12');
+INSERT INTO items VALUES (13, 11, 13.69, 'item13');
+INSERT INTO items VALUES (14, -5, 14.82, 'item14');
+INSERT INTO items VALUES (15, 2, 15.95, 'item15');
+INSERT INTO items VALUES (16, 9, 16.08, 'item16');
+INSERT INTO items VALUES (17, -7, 17.21, 'item17');
+INSERT INTO items VALUES (18, 0, 18.34, 'item18');
+INSERT INTO items VALUES (19, 7, 19.47, 'item19');
+INSERT INTO items VALUES (20, -9, 20.60, '');
+INSERT INTO items VALUES (21, -2, 21.73, 'item21');
+INSERT INTO items VALUES (22, 5, 22.86, 'item22');
+INSERT INTO items VALUES (23, -11, 23.99, 'item23');
+INSERT INTO items VALUES (24, -4, 24.12, 'item24');
+INSERT INTO items VALUES (25, 3, 25.25, 'item25');
+INSERT INTO items VALUES (26, 10, 26.38, 'item26');
+INSERT INTO items VALUES (27, -6, 27.51, 'item27');
+INSERT INTO items VALUES (28, 1, 28.64, 'item28');
+INSERT INTO items VALUES (29, 8, 29.77, 'item29');
+INSERT INTO items VALUES (30, -8, 30.90, '');
+INSERT INTO items VALUES (31, -1, 31.03, 'item31');
+INSERT INTO items VALUES (32, 6, 32.16, 'item32');
+INSERT INTO items VALUES (33, -10, 33.29, 'item33');
+INSERT INTO items VALUES (34, -3, 34.42, 'item34');
+INSERT INTO items VALUES (35, 4, 35.55, 'item35');
+INSERT INTO items VALUES (36, 11, 36.68, 'item36');
+INSERT INTO items VALUES (37, -5, 37.81, 'item37');
+INSERT INTO items VALUES (38, 2, 38.94, 'item38');
+INSERT INTO items VALUES (39, 9, 39.07, 'item39');
+INSERT INTO items VALUES (40, -7, 40.20, '');
+INSERT INTO items VALUES (41, 0, 41.33, 'item41');
+INSERT INTO items VALUES (42, 7, 42.46, 'item42');
+INSERT INTO items VALUES (43, -9, 43.59, 'item43');
+INSERT INTO items VALUES (44, -2, 44.72, 'item44');
+INSERT INTO items VALUES (45, 5, 45.85, 'item45');
+INSERT INTO items VALUES (46, -11, 46.98, 'item46');
+INSERT INTO items VALUES (47, -4, 47.11, 'item47');
+INSERT INTO items VALUES (48, 3, 48.24, 'item48');
+INSERT INTO items VALUES (49, 10, 49.37, 'item49');
+INSERT INTO items VALUES (50, -6, 0.50, '');
+INSERT INTO items VALUES (51, 1, 1.63, 'item51');
+INSERT INTO items VALUES (52, 8, 2.76, 'item52');
+INSERT INTO items VALUES (53, -8, 3.89, 'item53');
+INSERT INTO items VALUES (54, -1, 4.02, 'item54');
+INSERT INTO items VALUES (55, 6, 5.15, 'item55');
+INSERT INTO items VALUES (56, -10, 6.28, 'item56');
+INSERT INTO items VALUES (57, -3, 7.41, 'item57');
+INSERT INTO items VALUES (58, 4, 8.54, 'item58');
+INSERT INTO items VALUES (59, 11, 9.67, 'item59');
+INSERT INTO items VALUES (60, -5, 10.80, '');
+INSERT INTO items VALUES (61, 2, 11.93, 'item61');
+INSERT INTO items VALUES (62, 9, 12.06, 'item62');
+INSERT INTO items VALUES (63, -7, 13.19, 'item63');
+INSERT INTO items VALUES (64, 0, 14.32, 'item64');
+INSERT INTO items VALUES (65, 7, 15.45, 'item65');
+INSERT INTO items VALUES (66, -9, 16.58, 'item66');
+INSERT INTO items VALUES (67, -2, 17.71, 'item67');
+INSERT INTO items VALUES (68, 5, 18.84, 'item68');
+INSERT INTO items VALUES (69, -11, 19.97, 'item69');
+INSERT INTO items VALUES (70, -4, 20.10, '');
+INSERT INTO items VALUES (71, 3, 21.23, 'item71');
+INSERT INTO items VALUES (72, 10, 22.36, 'item72');
+INSERT INTO items VALUES (73, -6, 23.49, 'item73');
+INSERT INTO items VALUES (74, 1, 24.62, 'item74');
+INSERT INTO items VALUES (75, 8, 25.75, 'item75');
+INSERT INTO items VALUES (76, -8, 26.88, 'item76');
+INSERT INTO items VALUES (77, -1, 27.01, 'item77');
+INSERT INTO items VALUES (78, 6, 28.14, 'item78');
+INSERT INTO items VALUES (79, -10, 29.27, 'item79');
+INSERT INTO items VALUES (80, -3, 30.40, '');
+INSERT INTO items VALUES (81, 4, 31.53, 'item81');
+INSERT INTO items VALUES (82, 11, 32.66, 'item82');
+INSERT INTO items VALUES (83, -5, 33.79, 'item83');
+INSERT INTO items VALUES (84, 2, 34.92, 'item84');
+INSERT INTO items VALUES (85, 9, 35.05, 'item85');
+INSERT INTO items VALUES (86, -7, 36.18, 'item86');
+INSERT INTO items VALUES (87, 0, 37.31, 'item87');
+INSERT INTO items VALUES (88, 7, 38.44, 'item88');
+INSERT INTO items VALUES (89, -9, 39.57, 'item89');
+INSERT INTO items VALUES (90, -2, 40.70, '');
+INSERT INTO items VALUES (91, 5, 41.83, 'item91');
+INSERT INTO items VALUES (92, -11, 42.96, 'item92');
+INSERT INTO items VALUES (93, -4, 43.09, 'item93');
+INSERT INTO items VALUES (94, 3, 44.22, 'item94');
+INSERT INTO items VALUES (95, 10, 45.35, 'item95');
+INSERT INTO items VALUES (96, -6, 46.48, 'item96');
+INSERT INTO items VALUES (97, 1, 47.61, 'item97');
+INSERT INTO items VALUES (98, 8, 48.74, 'item98');
+INSERT INTO items VALUES (99, -8, 49.87, 'item99');
+INSERT INTO items VALUES (100, -1, 0.00, '');
+INSERT INTO items VALUES (101, 6, 1.13, 'item101');
+INSERT INTO items VALUES (102, -10, 2.26, 'item102');
+INSERT INTO items VALUES (103, -3, 3.39, 'item103');
+INSERT INTO items VALUES (104, 4, 4.52, 'item104');
+INSERT INTO items VALUES (105, 11, 5.65, 'item105');
+INSERT INTO items VALUES (106, -5, 6.78, 'item106');
+INSERT INTO items VALUES (107, 2, 7.91, 'item107');
+INSERT INTO items VALUES (108, 9, 8.04, 'item108');
+INSERT INTO items VALUES (109, -7, 9.17, 'item109');
+INSERT INTO items VALUES (110, 0, 10.30, '');
+INSERT INTO items VALUES (111, 7, 11.43, 'item111');
+INSERT INTO items VALUES (112, -9, 12.56, 'item112');
+INSERT INTO items VALUES (113, -2, 13.69, 'item113');
+INSERT INTO items VALUES (114, 5, 14.82, 'item114');
+INSERT INTO items VALUES (115, -11, 15.95, 'item115');
+INSERT INTO items VALUES (116, -4, 16.08, 'item116');
+INSERT INTO items VALUES (117, 3, 17.21, 'item117');
+INSERT INTO items VALUES (118, 10, 18.34, 'item118');
+INSERT INTO items VALUES (119, -6, 19.47, 'item119');
+INSERT INTO items VALUES (120, 1, 20.60, '');
+INSERT INTO items VALUES (121, 8, 21.73, 'item121');
+INSERT INTO items VALUES (122, -8, 22.86, 'item122');
+INSERT INTO items VALUES (123, -1, 23.99, 'item123');
+INSERT INTO items VALUES (124, 6, 24.12, 'item124');
+INSERT INTO items VALUES (125, -10, 25.25, 'item125');
+INSERT INTO items VALUES (126, -3, 26.38, 'item126');
+INSERT INTO items VALUES (127, 4, 27.51, 'item127');
+INSERT INTO items VALUES (128, 11, 28.64, 'item128');
+INSERT INTO items VALUES (129, -5, 29.77, 'item129');
+INSERT INTO items VALUES (130, 2, 30.90, '');
+INSERT INTO items VALUES (131, 9, 31.03, 'item131');
+INSERT INTO items VALUES (132, -7, 32.16, 'item132');
+INSERT INTO items VALUES (133, 0, 33.29, 'item133');
+INSERT INTO items VALUES (134, 7, 34.42, 'item134');
+INSERT INTO items VALUES (135, -9, 35.55, 'item135');
+INSERT INTO items VALUES (136, -2, 36.68, 'item136');
+INSERT INTO items VALUES (137, 5, 37.81, 'item137');
+INSERT INTO items VALUES (138, -11, 38.94, 'item138');
+INSERT INTO items VALUES (139, -4, 39.07, 'item139');
+INSERT INTO items VALUES (140, 3, 40.20, '');
+INSERT INTO items VALUES (141, 10, 41.33, 'item141');
+INSERT INTO items VALUES (142, -6, 42.46, 'item142');
+INSERT INTO items VALUES (143, 1, 43.59, 'item143');
+INSERT INTO items VALUES (144, 8, 44.72, 'item144');
+INSERT INTO items VALUES (145, -8, 45.85, 'item145');
+INSERT INTO items VALUES (146, -1, 46.98, 'item146');
+INSERT INTO items VALUES (147, 6, 47.11, 'item147');
+INSERT INTO items VALUES (148, -10, 48.24, 'item148');
+INSERT INTO items VALUES (149, -3, 49.37, 'item149');
+INSERT INTO items VALUES (150, 4, 0.50, '');
+INSERT INTO items VALUES (151, 11, 1.63, 'item151');
+INSERT INTO items VALUES (152, -5, 2.76, 'item152');
+INSERT INTO items VALUES (153, 2, 3.89, 'item153');
+INSERT INTO items VALUES (154, 9, 4.02, 'item154');
+INSERT INTO items VALUES (155, -7, 5.15, 'item155');
+INSERT INTO items VALUES (156, 0, 6.28, 'item156');
+INSERT INTO items VALUES (157, 7, 7.41, 'item157');
+INSERT INTO items VALUES (158, -9, 8.54, 'item158');
+INSERT INTO items VALUES (159, -2, 9.67, 'item159');
+INSERT INTO items VALUES (160, 5, 10.80, '');
+INSERT INTO items VALUES (161, -11, 11.93, 'item161');
+INSERT INTO items VALUES (162, -4, 12.06, 'item162');
+INSERT INTO items VALUES (163, 3, 13.19, 'item163');
+INSERT INTO items VALUES (164, 10, 14.32, 'item164');
+INSERT INTO items VALUES (165, -6, 15.45, 'item165');
+INSERT INTO items VALUES (166, 1, 16.58, 'item166');
+INSERT INTO items VALUES (167, 8, 17.71, 'item167');
+INSERT INTO items VALUES (168, -8, 18.84, 'item168');
+INSERT INTO items VALUES (169, -1, 19.97, 'item169');
+INSERT INTO items VALUES (170, 6, 20.10, '');
+INSERT INTO items VALUES (171, -10, 21.23, 'item171');
+INSERT INTO items VALUES (172, -3, 22.36, 'item172');
+INSERT INTO items VALUES (173, 4, 23.49, 'item173');
+INSERT INTO items VALUES (174, 11, 24.62, 'item174');
+INSERT INTO items VALUES (175, -5, 25.75, 'item175');
+INSERT INTO items VALUES (176, 2, 26.88, 'item176');
+INSERT INTO items VALUES (177, 9, 27.01, 'item177');
+INSERT INTO items VALUES (178, -7, 28.14, 'item178');
+INSERT INTO items VALUES (179, 0, 29.27, 'item179');
+INSERT INTO items VALUES (180, 7, 30.40, '');
+INSERT INTO items VALUES (181, -9, 31.53, 'item181');
+INSERT INTO items VALUES (182, -2, 32.66, 'item182');
+INSERT INTO items VALUES (183, 5, 33.79, 'item183');
+INSERT INTO items VALUES (184, -11, 34.92, 'item184');
+INSERT INTO items VALUES (185, -4, 35.05, 'item185');
+INSERT INTO items VALUES (186, 3, 36.18, 'item186');
+INSERT INTO items VALUES (187, 10, 37.31, 'item187');
+INSERT INTO items VALUES (188, -6, 38.44, 'item188');
+INSERT INTO items VALUES (189, 1, 39.57, 'item189');
+INSERT INTO items VALUES (190, 8, 40.70, '');
+INSERT INTO items VALUES (191, -8, 41.83, 'item191');
+INSERT INTO items VALUES (192, -1, 42.96, 'item192');
+INSERT INTO items VALUES (193, 6, 43.09, 'item193');
+INSERT INTO items VALUES (194, -10, 44.22, 'item194');
+INSERT INTO items VALUES (195, -3, 45.35, 'item195');
+INSERT INTO items VALUES (196, 4, 46.48, 'item196');
+INSERT INTO items VALUES (197, 11, 47.61, 'item197');
+INSERT INTO items VALUES (198, -5, 48.74, 'item198');
+INSERT INTO items VALUES (199, 2, 49.87, 'item199');
+INSERT INTO items VALUES (200, 9, 0.00, '');
+INSERT INTO items VALUES (201, -7, 1.13, 'item201');
+INSERT INTO items VALUES (202, 0, 2.26, 'item202');
+INSERT INTO items VALUES (203, 7, 3.39, 'item203');
+INSERT INTO items VALUES (204, -9, 4.52, 'item204');
+INSERT INTO items VALUES (205, -2, 5.65, 'item205');
+INSERT INTO items VALUES (206, 5, 6.78, 'item206');
+INSERT INTO items VALUES (207, -11, 7.91, 'item207');
+INSERT INTO items VALUES (208, -4, 8.04, 'item208');
+INSERT INTO items VALUES (209, 3, 9.17, 'item209');
+INSERT INTO items VALUES (210, 10, 10.30, '');
+INSERT INTO items VALUES (211, -6, 11.43, 'item211');
+INSERT INTO items VALUES (212, 1, 12.56, 'item212');
+INSERT INTO items VALUES (213, 8, 13.69, 'item213');
+INSERT INTO items VALUES (214, -8, 14.82, 'item214');
+INSERT INTO items VALUES (215, -1, 15.95, 'item215');
+INSERT INTO items VALUES (216, 6, 16.08, 'item216');
+INSERT INTO items VALUES (217, -10, 17.21, 'item217');
+INSERT INTO items VALUES (218, -3, 18.34, 'item218');
+INSERT INTO items VALUES (219, 4, 19.47, 'item219');
+INSERT INTO items VALUES (220, 11, 20.60, '');
+INSERT INTO items VALUES (221, -5, 21.73, 'item221');
+INSERT INTO items VALUES (222, 2, 22.86, 'item222');
+INSERT INTO items VALUES (223, 9, 23.99, 'item223');
+INSERT INTO items VALUES (224, -7, 24.12, 'item224');
+INSERT INTO items VALUES (225, 0, 25.25, 'item225');
+INSERT INTO items VALUES (226, 7, 26.38, 'item226');
+INSERT INTO items VALUES (227, -9, 27.51, 'item227');
+INSERT INTO items VALUES (228, -2, 28.64, 'item228');
+INSERT INTO items VALUES (229, 5, 29.77, 'item229');
+INSERT INTO items VALUES (230, -11, 30.90, '');
+INSERT INTO items VALUES (231, -4, 31.03, 'item231');
+INSERT INTO items VALUES (232, 3, 32.16, 'item232');
+INSERT INTO items VALUES (233, 10, 33.29, 'item233');
+INSERT INTO items VALUES (234, -6, 34.42, 'item234');
+INSERT INTO items VALUES (235, 1, 35.55, 'item235');
+INSERT INTO items VALUES (236, 8, 36.68, 'item236');
+INSERT INTO items VALUES (237, -8, 37.81, 'item237');
+INSERT INTO items VALUES (238, -1, 38.94, 'item238');
+INSERT INTO items VALUES (239, 6, 39.07, 'item239');
+INSERT INTO items VALUES (240, -10, 40.20, '');
+INSERT INTO items VALUES (241, -3, 41.33, 'item241');
+INSERT INTO items VALUES (242, 4, 42.46, 'item242');
+INSERT INTO items VALUES (243, 11, 43.59, 'item243');
+INSERT INTO items VALUES (244, -5, 44.72, 'item244');
+INSERT INTO items VALUES (245, 2, 45.85, 'item245');
+INSERT INTO items VALUES (246, 9, 46.98, 'item246');
+INSERT INTO items VALUES (247, -7, 47.11, 'item247');
+INSERT INTO items VALUES (248, 0, 48.24, 'item248');
+INSERT INTO items VALUES (249, 7, 49.37, 'item249');
+INSERT INTO items VALUES (250, -9, 0.50, '');
+INSERT INTO items VALUES (251, -2, 1.63, 'item251');
+INSERT INTO items VALUES (252, 5, 2.76, 'item252');
+INSERT INTO items VALUES (253, -11, 3.89, 'item253');
+INSERT INTO items VALUES (254, -4, 4.02, 'item254');
+INSERT INTO items VALUES (255, 3, 5.15, 'item255');
+INSERT INTO items VALUES (256, 10, 6.28, 'item256');
+INSERT INTO items VALUES (257, -6, 7.41, 'item257');
+INSERT INTO items VALUES (258, 1, 8.54, 'item258');
+INSERT INTO items VALUES (259, 8, 9.67, 'item259');
+INSERT INTO items VALUES (260, -8, 10.80, '');
+INSERT INTO items VALUES (261, -1, 11.93, 'item261');
+INSERT INTO items VALUES (262, 6, 12.06, 'item262');
+INSERT INTO items VALUES (263, -10, 13.19, 'item263');
+INSERT INTO items VALUES (264, -3, 14.32, 'item264');
+INSERT INTO items VALUES (265, 4, 15.45, 'item265');
+INSERT INTO items VALUES (266, 11, 16.58, 'item266');
+INSERT INTO items VALUES (267, -5, 17.71, 'item267');
+INSERT INTO items VALUES (268, 2, 18.84, 'item268');
+INSERT INTO items VALUES (269, 9, 19.97, 'item269');
+INSERT INTO items VALUES (270, -7, 20.10, '');
+INSERT INTO items VALUES (271, 0, 21.23, 'item271');
+INSERT INTO items VALUES (272, 7, 22.36, 'item272');
+INSERT INTO items VALUES (273, -9, 23.49, 'item273');
+INSERT INTO items VALUES (274, -2, 24.62, 'item274');
+INSERT INTO items VALUES (275, 5, 25.75, 'item275');
+INSERT INTO items VALUES (276, -11, 26.88, 'item276');
+INSERT INTO items VALUES (277, -4, 27.01, 'item277');
+INSERT INTO items VALUES (278, 3, 28.14, 'item278');
+INSERT INTO items VALUES (279, 10, 29.27, 'item279');
+INSERT INTO items VALUES (280, -6, 30.40, '');
+INSERT INTO items VALUES (281, 1, 31.53, 'item281');
+INSERT INTO items VALUES (282, 8, 32.66, 'item282');
+INSERT INTO items VALUES (283, -8, 33.79, 'item283');
+INSERT INTO items VALUES (284, -1, 34.92, 'item284');
+INSERT INTO items VALUES (285, 6, 35.05, 'item285');
+INSERT INTO items VALUES (286, -10, 36.18, 'item286');
+INSERT INTO items VALUES (287, -3, 37.31, 'item287');
+INSERT INTO items VALUES (288, 4, 38.44, 'item288');
+INSERT INTO items VALUES (289, 11, 39.57, 'item289');
+INSERT INTO items VALUES (290, -5, 40.70, '');
+INSERT INTO items VALUES (291, 2, 41.83, 'item291');
+INSERT INTO items VALUES (292, 9, 42.96, 'item292');
+INSERT INTO items VALUES (293, -7, 43.09, 'item293');
+INSERT INTO items VALUES (294, 0, 44.22, 'item294');
+INSERT INTO items VALUES (295, 7, 45.35, 'item295');
+INSERT INTO items VALUES (296, -9, 46.48, 'item296');
+INSERT INTO items VALUES (297, -2, 47.61, 'item297');
+INSERT INTO items VALUES (298, 5, 48.74, 'item298');
+INSERT INTO items VALUES (299, -11, 49.87, 'item299');
+INSERT INTO items VALUES (300, -4, 0.00, '');
+INSERT INTO items VALUES (301, 3, 1.13, 'item301');
+INSERT INTO items VALUES (302, 10, 2.26, 'item302');
+INSERT INTO items VALUES (303, -6, 3.39, 'item303');
+INSERT INTO items VALUES (304, 1, 4.52, 'item304');
+INSERT INTO items VALUES (305, 8, 5.65, 'item305');
+INSERT INTO items VALUES (306, -8, 6.78, 'item306');
+INSERT INTO items VALUES (307, -1, 7.91, 'item307');
+INSERT INTO items VALUES (308, 6, 8.04, 'item308');
+INSERT INTO items VALUES (309, -10, 9.17, 'item309');
+INSERT INTO items VALUES (310, -3, 10.30, '');
+INSERT INTO items VALUES (311, 4, 11.43, 'item311');
+INSERT INTO items VALUES (312, 11, 12.56, 'item312');
+INSERT INTO items VALUES (313, -5, 13.69, 'item313');
+INSERT INTO items VALUES (314, 2, 14.82, 'item314');
+INSERT INTO items VALUES (315, 9, 15.95, 'item315');
+INSERT INTO items VALUES (316, -7, 16.08, 'item316');
+INSERT INTO items VALUES (317, 0, 17.21, 'item317');
+INSERT INTO items VALUES (318, 7, 18.34, 'item318');
+INSERT INTO items VALUES (319, -9, 19.47, 'item319');
+INSERT INTO items VALUES (320, -2, 20.60, '');
+INSERT INTO items VALUES (321, 5, 21.73, 'item321');
+INSERT INTO items VALUES (322, -11, 22.86, 'item322');
+INSERT INTO items VALUES (323, -4, 23.99, 'item323');
+INSERT INTO items VALUES (324, 3, 24.12, 'item324');
+INSERT INTO items VALUES (325, 10, 25.25, 'item325');
+INSERT INTO items VALUES (326, -6, 26.38, 'item326');
+INSERT INTO items VALUES (327, 1, 27.51, 'item327');
+INSERT INTO items VALUES (328, 8, 28.64, 'item328');
+INSERT INTO items VALUES (329, -8, 29.77, 'item329');
+INSERT INTO items VALUES (330, -1, 30.90, '');
+INSERT INTO items VALUES (331, 6, 31.03, 'item331');
+INSERT INTO items VALUES (332, -10, 32.16, 'item332');
+INSERT INTO items VALUES (333, -3, 33.29, 'item333');
+INSERT INTO items VALUES (334, 4, 34.42, 'item334');
+INSERT INTO items VALUES (335, 11, 35.55, 'item335');
+INSERT INTO items VALUES (336, -5, 36.68, 'item336');
+INSERT INTO items VALUES (337, 2, 37.81, 'item337');
+INSERT INTO items VALUES (338, 9, 38.94, 'item338');
+INSERT INTO items VALUES (339, -7, 39.07, 'item339');
+INSERT INTO items VALUES (340, 0, 40.20, '');
+INSERT INTO items VALUES (341, 7, 41.33, 'item341');
+INSERT INTO items VALUES (342, -9, 42.46, 'item342');
+INSERT INTO items VALUES (343, -2, 43.59, 'item343');
+INSERT INTO items VALUES (344, 5, 44.72, 'item344');
+INSERT INTO items VALUES (345, -11, 45.85, 'item345');
+INSERT INTO items VALUES (346, -4, 46.98, 'item346');
+INSERT INTO items VALUES (347, 3, 47.11, 'item347');
+INSERT INTO items VALUES (348, 10, 48.24, 'item348');
+INSERT INTO items VALUES (349, -6, 49.37, 'item349');
+INSERT INTO items VALUES (350, 1, 0.50, '');
+INSERT INTO items VALUES (351, 8, 1.63, 'item351');
+INSERT INTO items VALUES (352, -8, 2.76, 'item352');
+INSERT INTO items VALUES (353, -1, 3.89, 'item353');
+INSERT INTO items VALUES (354, 6, 4.02, 'item354');
+INSERT INTO items VALUES (355, -10, 5.15, 'item355');
+INSERT INTO items VALUES (356, -3, 6.28, 'item356');
+INSERT INTO items VALUES (357, 4, 7.41, 'item357');
+INSERT INTO items VALUES (358, 11, 8.54, 'item358');
+INSERT INTO items VALUES (359, -5, 9.67, 'item359');
+INSERT INTO items VALUES (360, 2, 10.80, '');
+INSERT INTO items VALUES (361, 9, 11.93, 'item361');
+INSERT INTO items VALUES (362, -7, 12.06, 'item362');
+INSERT INTO items VALUES (363, 0, 13.19, 'item363');
+INSERT INTO items VALUES (364, 7, 14.32, 'item364');
+INSERT INTO items VALUES (365, -9, 15.45, 'item365');
+INSERT INTO items VALUES (366, -2, 16.58, 'item366');
+INSERT INTO items VALUES (367, 5, 17.71, 'item367');
+INSERT INTO items VALUES (368, -11, 18.84, 'item368');
+INSERT INTO items VALUES (369, -4, 19.97, 'item369');
+INSERT INTO items VALUES (370, 3, 20.10, '');
+INSERT INTO items VALUES (371, 10, 21.23, 'item371');
+INSERT INTO items VALUES (372, -6, 22.36, 'item372');
+INSERT INTO items VALUES (373, 1, 23.49, 'item373');
+INSERT INTO items VALUES (374, 8, 24.62, 'item374');
+INSERT INTO items VALUES (375, -8, 25.75, 'item375');
+INSERT INTO items VALUES (376, -1, 26.88, 'item376');
+INSERT INTO items VALUES (377, 6, 27.01, 'item377');
+INSERT INTO items VALUES (378, -10, 28.14, 'item378');
+INSERT INTO items VALUES (379, -3, 29.27, 'item379');
+INSERT INTO items VALUES (380, 4, 30.40, '');
+INSERT INTO items VALUES (381, 11, 31.53, 'item381');
+INSERT INTO items VALUES (382, -5, 32.66, 'item382');
+INSERT INTO items VALUES (383, 2, 33.79, 'item383');
+INSERT INTO items VALUES (384, 9, 34.92, 'item384');
+INSERT INTO items VALUES (385, -7, 35.05, 'item385');
+INSERT INTO items VALUES (386, 0, 36.18, 'item386');
+INSERT INTO items VALUES (387, 7, 37.31, 'item387');
+INSERT INTO items VALUES (388, -9, 38.44, 'item388');
+INSERT INTO items VALUES (389, -2, 39.57, 'item389');
+INSERT INTO items VALUES (390, 5, 40.70, '');
+INSERT INTO items VALUES (391, -11, 41.83, 'item391');
+INSERT INTO items VALUES (392, -4, 42.96, 'item392');
+INSERT INTO items VALUES (393, 3, 43.09, 'item393');
+INSERT INTO items VALUES (394, 10, 44.22, 'item394');
+INSERT INTO items VALUES (395, -6, 45.35, 'item395');
+INSERT INTO items VALUES (396, 1, 46.48, 'item396');
+INSERT INTO items VALUES (397, 8, 47.61, 'item397');
+INSERT INTO items VALUES (398, -8, 48.74, 'item398');
+INSERT INTO items VALUES (399, -1, 49.87, 'item399');
+INSERT INTO items VALUES (400, 6, 0.00, '');
+INSERT INTO items VALUES (401, -10, 1.13, 'item401');
+INSERT INTO items VALUES (402, -3, 2.26, 'item402');
+INSERT INTO items VALUES (403, 4, 3.39, 'item403');
+INSERT INTO items VALUES (404, 11, 4.52, 'item404');
+INSERT INTO items VALUES (405, -5, 5.65, 'item405');
+INSERT INTO items VALUES (406, 2, 6.78, 'item406');
+INSERT INTO items VALUES (407, 9, 7.91, 'item407');
+INSERT INTO items VALUES (408, -7, 8.04, 'item408');
+INSERT INTO items VALUES (409, 0, 9.17, 'item409');
+INSERT INTO items VALUES (410, 7, 10.30, '');
+INSERT INTO items VALUES (411, -9, 11.43, 'item411');
+INSERT INTO items VALUES (412, -2, 12.56, 'item412');
+INSERT INTO items VALUES (413, 5, 13.69, 'item413');
+INSERT INTO items VALUES (414, -11, 14.82, 'item414');
+INSERT INTO items VALUES (415, -4, 15.95, 'item415');
+INSERT INTO items VALUES (416, 3, 16.08, 'item416');
+INSERT INTO items VALUES (417, 10, 17.21, 'item417');
+INSERT INTO items VALUES (418, -6, 18.34, 'item418');
+INSERT INTO items VALUES (419, 1, 19.47, 'item419');
+INSERT INTO items VALUES (420, 8, 20.60, '');
+INSERT INTO items VALUES (421, -8, 21.73, 'item421');
+INSERT INTO items VALUES (422, -1, 22.86, 'item422');
+INSERT INTO items VALUES (423, 6, 23.99, 'item423');
+INSERT INTO items VALUES (424, -10, 24.12, 'item424');
+INSERT INTO items VALUES (425, -3, 25.25, 'item425');
+INSERT INTO items VALUES (426, 4, 26.38, 'item426');
+INSERT INTO items VALUES (427, 11, 27.51, 'item427');
+INSERT INTO items VALUES (428, -5, 28.64, 'item428');
+INSERT INTO items VALUES (429, 2, 29.77, 'item429');
+INSERT INTO items VALUES (430, 9, 30.90, '');
+INSERT INTO items VALUES (431, -7, 31.03, 'item431');
+INSERT INTO items VALUES (432, 0, 32.16, 'item432');
+INSERT INTO items VALUES (433, 7, 33.29, 'item433');
+INSERT INTO items VALUES (434, -9, 34.42, 'item434');
+INSERT INTO items VALUES (435, -2, 35.55, 'item435');
+INSERT INTO items VALUES (436, 5, 36.68, 'item436');
+INSERT INTO items VALUES (437, -11, 37.81, 'item437');
+INSERT INTO items VALUES (438, -4, 38.94, 'item438');
+INSERT INTO items VALUES (439, 3, 39.07, 'item439');
+INSERT INTO items VALUES (440, 10, 40.20, '');
+INSERT INTO items VALUES (441, -6, 41.33, 'item441');
+INSERT INTO items VALUES (442, 1, 42.46, 'item442');
+INSERT INTO items VALUES (443, 8, 43.59, 'item443');
+INSERT INTO items VALUES (444, -8, 44.72, 'item444');
+INSERT INTO items VALUES (445, -1, 45.85, 'item445');
+INSERT INTO items VALUES (446, 6, 46.98, 'item446');
+INSERT INTO items VALUES (447, -10, 47.11, 'item447');
+INSERT INTO items VALUES (448, -3, 48.24, 'item448');
+INSERT INTO items VALUES (449, 4, 49.37, 'item449');
+INSERT INTO items VALUES (450, 11, 0.50, '');
+INSERT INTO items VALUES (451, -5, 1.63, 'item451');
+INSERT INTO items VALUES (452, 2, 2.76, 'item452');
+INSERT INTO items VALUES (453, 9, 3.89, 'item453');
+INSERT INTO items VALUES (454, -7, 4.02, 'item454');
+INSERT INTO items VALUES (455, 0, 5.15, 'item455');
+INSERT INTO items VALUES (456, 7, 6.28, 'item456');
+INSERT INTO items VALUES (457, -9, 7.41, 'item457');
+INSERT INTO items VALUES (458, -2, 8.54, 'item458');
+INSERT INTO items VALUES (459, 5, 9.67, 'item459');
+INSERT INTO items VALUES (460, -11, 10.80, '');
+INSERT INTO items VALUES (461, -4, 11.93, 'item461');
+INSERT INTO items VALUES (462, 3, 12.06, 'item462');
+INSERT INTO items VALUES (463, 10, 13.19, 'item463');
+INSERT INTO items VALUES (464, -6, 14.32, 'item464');
+INSERT INTO items VALUES (465, 1, 15.45, 'item465');
+INSERT INTO items VALUES (466, 8, 16.58, 'item466');
+INSERT INTO items VALUES (467, -8, 17.71, 'item467');
+INSERT INTO items VALUES (468, -1, 18.84, 'item468');
+INSERT INTO items VALUES (469, 6, 19.97, 'item469');
+INSERT INTO items VALUES (470, -10, 20.10, '');
+INSERT INTO items VALUES (471, -3, 21.23, 'item471');
+INSERT INTO items VALUES (472, 4, 22.36, 'item472');
+INSERT INTO items VALUES (473, 11, 23.49, 'item473');
+INSERT INTO items VALUES (474, -5, 24.62, 'item474');
+INSERT INTO items VALUES (475, 2, 25.75, 'item475');
+INSERT INTO items VALUES (476, 9, 26.88, 'item476');
+INSERT INTO items VALUES (477, -7, 27.01, 'item477');
+INSERT INTO items VALUES (478, 0, 28.14, 'item478');
+INSERT INTO items VALUES (479, 7, 29.27, 'item479');
+INSERT INTO items VALUES (480, -9, 30.40, '');
+INSERT INTO items VALUES (481, -2, 31.53, 'item481');
+INSERT INTO items VALUES (482, 5, 32.66, 'item482');
+INSERT INTO items VALUES (483, -11, 33.79, 'item483');
+INSERT INTO items VALUES (484, -4, 34.92, 'item484');
+INSERT INTO items VALUES (485, 3, 35.05, 'item485');
+INSERT INTO items VALUES (486, 10, 36.18, 'item486');
+INSERT INTO items VALUES (487, -6, 37.31, 'item487');
+INSERT INTO items VALUES (488, 1, 38.44, 'item488');
+INSERT INTO items VALUES (489, 8, 39.57, 'item489');
+INSERT INTO items VALUES (490, -8, 40.70, '');
+INSERT INTO items VALUES (491, -1, 41.83, 'item491');
+INSERT INTO items VALUES (492, 6, 42.96, 'item492');
+INSERT INTO items VALUES (493, -10, 43.09, 'item493');
+INSERT INTO items VALUES (494, -3, 44.22, 'item494');
+INSERT INTO items VALUES (495, 4, 45.35, 'item495');
+INSERT INTO items VALUES (496, 11, 46.48, 'item496');
+INSERT INTO items VALUES (497, -5, 47.61, 'item497');
+INSERT INTO items VALUES (498, 2, 48.74, 'item498');
+INSERT INTO items VALUES (499, 9, 49.87, 'item499');
+INSERT INTO items VALUES (500, -7, 0.00, '');
+INSERT INTO items VALUES (501, 0, 1.13, 'item501');
+INSERT INTO items VALUES (502, 7, 2.26, 'item502');
+INSERT INTO items VALUES (503, -9, 3.39, 'item503');
+INSERT INTO items VALUES (504, -2, 4.52, 'item504');
+INSERT INTO items VALUES (505, 5, 5.65, 'item505');
+INSERT INTO items VALUES (506, -11, 6.78, 'item506');
+INSERT INTO items VALUES (507, -4, 7.91, 'item507');
+INSERT INTO items VALUES (508, 3, 8.04, 'item508');
+INSERT INTO items VALUES (509, 10, 9.17, 'item509');
+INSERT INTO items VALUES (510, -6, 10.30, '');
+INSERT INTO items VALUES (511, 1, 11.43, 'item511');
+INSERT INTO items VALUES (512, 8, 12.56, 'item512');
+INSERT INTO items VALUES (513, -8, 13.69, 'item513');
+INSERT INTO items VALUES (514, -1, 14.82, 'item514');
+INSERT INTO items VALUES (515, 6, 15.95, 'item515');
+INSERT INTO items VALUES (516, -10, 16.08, 'item516');
+INSERT INTO items VALUES (517, -3, 17.21, 'item517');
+INSERT INTO items VALUES (518, 4, 18.34, 'item518');
+INSERT INTO items VALUES (519, 11, 19.47, 'item519');
+INSERT INTO items VALUES (520, -5, 20.60, '');
+INSERT INTO items VALUES (521, 2, 21.73, 'item521');
+INSERT INTO items VALUES (522, 9, 22.86, 'item522');
+INSERT INTO items VALUES (523, -7, 23.99, 'item523');
+INSERT INTO items VALUES (524, 0, 24.12, 'item524');
+INSERT INTO items VALUES (525, 7, 25.25, 'item525');
+INSERT INTO items VALUES (526, -9, 26.38, 'item526');
+INSERT INTO items VALUES (527, -2, 27.51, 'item527');
+INSERT INTO items VALUES (528, 5, 28.64, 'item528');
+INSERT INTO items VALUES (529, -11, 29.77, 'item529');
+INSERT INTO items VALUES (530, -4, 30.90, '');
+INSERT INTO items VALUES (531, 3, 31.03, 'item531');
+INSERT INTO items VALUES (532, 10, 32.16, 'item532');
+INSERT INTO items VALUES (533, -6, 33.29, 'item533');
+INSERT INTO items VALUES (534, 1, 34.42, 'item534');
+INSERT INTO items VALUES (535, 8, 35.55, 'item535');
+INSERT INTO items VALUES (536, -8, 36.68, 'item536');
+INSERT INTO items VALUES (537, -1, 37.81, 'item537');
+INSERT INTO items VALUES (538, 6, 38.94, 'item538');
+INSERT INTO items VALUES (539, -10, 39.07, 'item539');
+INSERT INTO items VALUES (540, -3, 40.20, '');
+INSERT INTO items VALUES (541, 4, 41.33, 'item541');
+INSERT INTO items VALUES (542, 11, 42.46, 'item542');
+INSERT INTO items VALUES (543, -5, 43.59, 'item543');
+INSERT INTO items VALUES (544, 2, 44.72, 'item544');
+INSERT INTO items VALUES (545, 9, 45.85, 'item545');
+INSERT INTO items VALUES (546, -7, 46.98, 'item546');
+INSERT INTO items VALUES (547, 0, 47.11, 'item547');
+INSERT INTO items VALUES (548, 7, 48.24, 'item548');
+INSERT INTO items VALUES (549, -9, 49.37, 'item549');
+INSERT INTO items VALUES (550, -2, 0.50, '');
+INSERT INTO items VALUES (551, 5, 1.63, 'item551');
+INSERT INTO items VALUES (552, -11, 2.76, 'item552');
+INSERT INTO items VALUES (553, -4, 3.89, 'item553');
+INSERT INTO items VALUES (554, 3, 4.02, 'item554');
+INSERT INTO items VALUES (555, 10, 5.15, 'item555');
+INSERT INTO items VALUES (556, -6, 6.28, 'item556');
+INSERT INTO items VALUES (557, 1, 7.41, 'item557');
+INSERT INTO items VALUES (558, 8, 8.54, 'item558');
+INSERT INTO items VALUES (559, -8, 9.67, 'item559');
+INSERT INTO items VALUES (560, -1, 10.80, '');
+INSERT INTO items VALUES (561, 6, 11.93, 'item561');
+INSERT INTO items VALUES (562, -10, 12.06, 'item562');
+INSERT INTO items VALUES (563, -3, 13.19, 'item563');
+INSERT INTO items VALUES (564, 4, 14.32, 'item564');
+INSERT INTO items VALUES (565, 11, 15.45, 'item565');
+INSERT INTO items VALUES (566, -5, 16.58, 'item566');
+INSERT INTO items VALUES (567, 2, 17.71, 'item567');
+INSERT INTO items VALUES (568, 9, 18.84, 'item568');
+INSERT INTO items VALUES (569, -7, 19.97, 'item569');
+INSERT INTO items VALUES (570, 0, 20.10, '');
+INSERT INTO items VALUES (571, 7, 21.23, 'item571');
+INSERT INTO items VALUES (572, -9, 22.36, 'item572');
+INSERT INTO items VALUES (573, -2, 23.49, 'item573');
+INSERT INTO items VALUES (574, 5, 24.62, 'item574');
+INSERT INTO items VALUES (575, -11, 25.75, 'item575');
+INSERT INTO items VALUES (576, -4, 26.88, 'item576');
+INSERT INTO items VALUES (577, 3, 27.01, 'item577');
+INSERT INTO items VALUES (578, 10, 28.14, 'item578');
+INSERT INTO items VALUES (579, -6, 29.27, 'item579');
+INSERT INTO items VALUES (580, 1, 30.40, '');
+INSERT INTO items VALUES (581, 8, 31.53, 'item581');
+INSERT INTO items VALUES (582, -8, 32.66, 'item582');
+INSERT INTO items VALUES (583, -1, 33.79, 'item583');
+INSERT INTO items VALUES (584, 6, 34.92, 'item584');
+INSERT INTO items VALUES (585, -10, 35.05, 'item585');
+INSERT INTO items VALUES (586, -3, 36.18, 'item586');
+INSERT INTO items VALUES (587, 4, 37.31, 'item587');
+INSERT INTO items VALUES (588, 11, 38.44, 'item588');
+INSERT INTO items VALUES (589, -5, 39.57, 'item589');
+INSERT INTO items VALUES (590, 2, 40.70, '');
+INSERT INTO items VALUES (591, 9, 41.83, 'item591');
+INSERT INTO items VALUES (592, -7, 42.96, 'item592');
+INSERT INTO items VALUES (593, 0, 43.09, 'item593');
+INSERT INTO items VALUES (594, 7, 44.22, 'item594');
+INSERT INTO items VALUES (595, -9, 45.35, 'item595');
+INSERT INTO items VALUES (596, -2, 46.48, 'item596');
+INSERT INTO items VALUES (597, 5, 47.61, 'item597');
+INSERT INTO items VALUES (598, -11, 48.74, 'item598');
+INSERT INTO items VALUES (599, -4, 49.87, 'item599');
+INSERT INTO items VALUES (600, 3, 0.00, '');
+INSERT INTO items VALUES (601, 10, 1.13, 'item601');
+INSERT INTO items VALUES (602, -6, 2.26, 'item602');
+INSERT INTO items VALUES (603, 1, 3.39, 'item603');
+INSERT INTO items VALUES (604, 8, 4.52, 'item604');
+INSERT INTO items VALUES (605, -8, 5.65, 'item605');
+INSERT INTO items VALUES (606, -1, 6.78, 'item606');
+INSERT INTO items VALUES (607, 6, 7.91, 'item607');
+INSERT INTO items VALUES (608, -10, 8.04, 'item608');
+INSERT INTO items VALUES (609, -3, 9.17, 'item609');
+INSERT INTO items VALUES (610, 4, 10.30, '');
+INSERT INTO items VALUES (611, 11, 11.43, 'item611');
+INSERT INTO items VALUES (612, -5, 12.56, 'item612');
+INSERT INTO items VALUES (613, 2, 13.69, 'item613');
+INSERT INTO items VALUES (614, 9, 14.82, 'item614');
+INSERT INTO items VALUES (615, -7, 15.95, 'item615');
+INSERT INTO items VALUES (616, 0, 16.08, 'item616');
+INSERT INTO items VALUES (617, 7, 17.21, 'item617');
+INSERT INTO items VALUES (618, -9, 18.34, 'item618');
+INSERT INTO items VALUES (619, -2, 19.47, 'item619');
+INSERT INTO items VALUES (620, 5, 20.60, '');
+INSERT INTO items VALUES (621, -11, 21.73, 'item621');
+INSERT INTO items VALUES (622, -4, 22.86, 'item622');
+INSERT INTO items VALUES (623, 3, 23.99, 'item623');
+INSERT INTO items VALUES (624, 10, 24.12, 'item624');
+INSERT INTO items VALUES (625, -6, 25.25, 'item625');
+INSERT INTO items VALUES (626, 1, 26.38, 'item626');
+INSERT INTO items VALUES (627, 8, 27.51, 'item627');
+INSERT INTO items VALUES (628, -8, 28.64, 'item628');
+INSERT INTO items VALUES (629, -1, 29.77, 'item629');
+INSERT INTO items VALUES (630, 6, 30.90, '');
+INSERT INTO items VALUES (631, -10, 31.03, 'item631');
+INSERT INTO items VALUES (632, -3, 32.16, 'item632');
+INSERT INTO items VALUES (633, 4, 33.29, 'item633');
+INSERT INTO items VALUES (634, 11, 34.42, 'item634');
+INSERT INTO items VALUES (635, -5, 35.55, 'item635');
+INSERT INTO items VALUES (636, 2, 36.68, 'item636');
+INSERT INTO items VALUES (637, 9, 37.81, 'item637');
+INSERT INTO items VALUES (638, -7, 38.94, 'item638');
+INSERT INTO items VALUES (639, 0, 39.07, 'item639');
+INSERT INTO items VALUES (640, 7, 40.20, '');
+INSERT INTO items VALUES (641, -9, 41.33, 'item641');
+INSERT INTO items VALUES (642, -2, 42.46, 'item642');
+INSERT INTO items VALUES (643, 5, 43.59, 'item643');
+INSERT INTO items VALUES (644, -11, 44.72, 'item644');
+INSERT INTO items VALUES (645, -4, 45.85, 'item645');
+INSERT INTO items VALUES (646, 3, 46.98, 'item646');
+INSERT INTO items VALUES (647, 10, 47.11, 'item647');
+INSERT INTO items VALUES (648, -6, 48.24, 'item648');
+INSERT INTO items VALUES (649, 1, 49.37, 'item649');
+INSERT INTO items VALUES (650, 8, 0.50, '');
+INSERT INTO items VALUES (651, -8, 1.63, 'item651');
+INSERT INTO items VALUES (652, -1, 2.76, 'item652');
+INSERT INTO items VALUES (653, 6, 3.89, 'item653');
+INSERT INTO items VALUES (654, -10, 4.02, 'item654');
+INSERT INTO items VALUES (655, -3, 5.15, 'item655');
+INSERT INTO items VALUES (656, 4, 6.28, 'item656');
+INSERT INTO items VALUES (657, 11, 7.41, 'item657');
+INSERT INTO items VALUES (658, -5, 8.54, 'item658');
+INSERT INTO items VALUES (659, 2, 9.67, 'item659');
+INSERT INTO items VALUES (660, 9, 10.80, '');
+INSERT INTO items VALUES (661, -7, 11.93, 'item661');
+INSERT INTO items VALUES (662, 0, 12.06, 'item662');
+INSERT INTO items VALUES (663, 7, 13.19, 'item663');
+INSERT INTO items VALUES (664, -9, 14.32, 'item664');
+INSERT INTO items VALUES (665, -2, 15.45, 'item665');
+INSERT INTO items VALUES (666, 5, 16.58, 'item666');
+INSERT INTO items VALUES (667, -11, 17.71, 'item667');
+INSERT INTO items VALUES (668, -4, 18.84, 'item668');
+INSERT INTO items VALUES (669, 3, 19.97, 'item669');
+INSERT INTO items VALUES (670, 10, 20.10, '');
+INSERT INTO items VALUES (671, -6, 21.23, 'item671');
+INSERT INTO items VALUES (672, 1, 22.36, 'item672');
+INSERT INTO items VALUES (673, 8, 23.49, 'item673');
+INSERT INTO items VALUES (674, -8, 24.62, 'item674');
+INSERT INTO items VALUES (675, -1, 25.75, 'item675');
+INSERT INTO items VALUES (676, 6, 26.88, 'item676');
+INSERT INTO items VALUES (677, -10, 27.01, 'item677');
+INSERT INTO items VALUES (678, -3, 28.14, 'item678');
+INSERT INTO items VALUES (679, 4, 29.27, 'item679');
+INSERT INTO items VALUES (680, 11, 30.40, '');
+INSERT INTO items VALUES (681, -5, 31.53, 'item681');
+INSERT INTO items VALUES (682, 2, 32.66, 'item682');
+INSERT INTO items VALUES (683, 9, 33.79, 'item683');
+INSERT INTO items VALUES (684, -7, 34.92, 'item684');
+INSERT INTO items VALUES (685, 0, 35.05, 'item685');
+INSERT INTO items VALUES (686, 7, 36.18, 'item686');
+INSERT INTO items VALUES (687, -9, 37.31, 'item687');
+INSERT INTO items VALUES (688, -2, 38.44, 'item688');
+INSERT INTO items VALUES (689, 5, 39.57, 'item689');
+INSERT INTO items VALUES (690, -11, 40.70, '');
+INSERT INTO items VALUES (691, -4, 41.83, 'item691');
+INSERT INTO items VALUES (692, 3, 42.96, 'item692');
+INSERT INTO items VALUES (693, 10, 43.09, 'item693');
+INSERT INTO items VALUES (694, -6, 44.22, 'item694');
+INSERT INTO items VALUES (695, 1, 45.35, 'item695');
+INSERT INTO items VALUES (696, 8, 46.48, 'item696');
+INSERT INTO items VALUES (697, -8, 47.61, 'item697');
+INSERT INTO items VALUES (698, -1, 48.74, 'item698');
+INSERT INTO items VALUES (699, 6, 49.87, 'item699');
+INSERT INTO items VALUES (700, -10, 0.00, '');
+INSERT INTO items VALUES (701, -3, 1.13, 'item701');
+INSERT INTO items VALUES (702, 4, 2.26, 'item702');
+INSERT INTO items VALUES (703, 11, 3.39, 'item703');
+INSERT INTO items VALUES (704, -5, 4.52, 'item704');
+INSERT INTO items VALUES (705, 2, 5.65, 'item705');
+INSERT INTO items VALUES (706, 9, 6.78, 'item706');
+INSERT INTO items VALUES (707, -7, 7.91, 'item707');
+INSERT INTO items VALUES (708, 0, 8.04, 'item708');
+INSERT INTO items VALUES (709, 7, 9.17, 'item709');
+INSERT INTO items VALUES (710, -9, 10.30, '');
+INSERT INTO items VALUES (711, -2, 11.43, 'item711');
+INSERT INTO items VALUES (712, 5, 12.56, 'item712');
+INSERT INTO items VALUES (713, -11, 13.69, 'item713');
+INSERT INTO items VALUES (714, -4, 14.82, 'item714');
+INSERT INTO items VALUES (715, 3, 15.95, 'item715');
+INSERT INTO items VALUES (716, 10, 16.08, 'item716');
+INSERT INTO items VALUES (717, -6, 17.21, 'item717');
+INSERT INTO items VALUES (718, 1, 18.34, 'item718');
+INSERT INTO items VALUES (719, 8, 19.47, 'item719');
+INSERT INTO items VALUES (720, -8, 20.60, '');
+INSERT INTO items VALUES (721, -1, 21.73, 'item721');
+INSERT INTO items VALUES (722, 6, 22.86, 'item722');
+INSERT INTO items VALUES (723, -10, 23.99, 'item723');
+INSERT INTO items VALUES (724, -3, 24.12, 'item724');
+INSERT INTO items VALUES (725, 4, 25.25, 'item725');
+INSERT INTO items VALUES (726, 11, 26.38, 'item726');
+INSERT INTO items VALUES (727, -5, 27.51, 'item727');
+INSERT INTO items VALUES (728, 2, 28.64, 'item728');
+INSERT INTO items VALUES (729, 9, 29.77, 'item729');
+INSERT INTO items VALUES (730, -7, 30.90, '');
+INSERT INTO items VALUES (731, 0, 31.03, 'item731');
+INSERT INTO items VALUES (732, 7, 32.16, 'item732');
+INSERT INTO items VALUES (733, -9, 33.29, 'item733');
+INSERT INTO items VALUES (734, -2, 34.42, 'item734');
+INSERT INTO items VALUES (735, 5, 35.55, 'item735');
+INSERT INTO items VALUES (736, -11, 36.68, 'item736');
+INSERT INTO items VALUES (737, -4, 37.81, 'item737');
+INSERT INTO items VALUES (738, 3, 38.94, 'item738');
+INSERT INTO items VALUES (739, 10, 39.07, 'item739');
+INSERT INTO items VALUES (740, -6, 40.20, '');
+INSERT INTO items VALUES (741, 1, 41.33, 'item741');
+INSERT INTO items VALUES (742, 8, 42.46, 'item742');
+INSERT INTO items VALUES (743, -8, 43.59, 'item743');
+INSERT INTO items VALUES (744, -1, 44.72, 'item744');
+INSERT INTO items VALUES (745, 6, 45.85, 'item745');
+INSERT INTO items VALUES (746, -10, 46.98, 'item746');
+INSERT INTO items VALUES (747, -3, 47.11, 'item747');
+INSERT INTO items VALUES (748, 4, 48.24, 'item748');
+INSERT INTO items VALUES (749, 11, 49.37, 'item749');
+INSERT INTO items VALUES (750, -5, 0.50, '');
+INSERT INTO items VALUES (751, 2, 1.63, 'item751');
+INSERT INTO items VALUES (752, 9, 2.76, 'item752');
+INSERT INTO items VALUES (753, -7, 3.89, 'item753');
+INSERT INTO items VALUES (754, 0, 4.02, 'item754');
+INSERT INTO items VALUES (755, 7, 5.15, 'item755');
+INSERT INTO items VALUES (756, -9, 6.28, 'item756');
+INSERT INTO items VALUES (757, -2, 7.41, 'item757');
+INSERT INTO items VALUES (758, 5, 8.54, 'item758');
+INSERT INTO items VALUES (759, -11, 9.67, 'item759');
+INSERT INTO items VALUES (760, -4, 10.80, '');
+INSERT INTO items VALUES (761, 3, 11.93, 'item761');
+INSERT INTO items VALUES (762, 10, 12.06, 'item762');
+INSERT INTO items VALUES (763, -6, 13.19, 'item763');
+INSERT INTO items VALUES (764, 1, 14.32, 'item764');
+INSERT INTO items VALUES (765, 8, 15.45, 'item765');
+INSERT INTO items VALUES (766, -8, 16.58, 'item766');
+INSERT INTO items VALUES (767, -1, 17.71, 'item767');
+INSERT INTO items VALUES (768, 6, 18.84, 'item768');
+INSERT INTO items VALUES (769, -10, 19.97, 'item769');
+INSERT INTO items VALUES (770, -3, 20.10, '');
+INSERT INTO items VALUES (771, 4, 21.23, 'item771');
+INSERT INTO items VALUES (772, 11, 22.36, 'item772');
+INSERT INTO items VALUES (773, -5, 23.49, 'item773');
+INSERT INTO items VALUES (774, 2, 24.62, 'item774');
+INSERT INTO items VALUES (775, 9, 25.75, 'item775');
+INSERT INTO items VALUES (776, -7, 26.88, 'item776');
+INSERT INTO items VALUES (777, 0, 27.01, 'item777');
+INSERT INTO items VALUES (778, 7, 28.14, 'item778');
+INSERT INTO items VALUES (779, -9, 29.27, 'item779');
+INSERT INTO items VALUES (780, -2, 30.40, '');
+INSERT INTO items VALUES (781, 5, 31.53, 'item781');
+INSERT INTO items VALUES (782, -11, 32.66, 'item782');
+INSERT INTO items VALUES (783, -4, 33.79, 'item783');
+INSERT INTO items VALUES (784, 3, 34.92, 'item784');
+INSERT INTO items VALUES (785, 10, 35.05, 'item785');
+INSERT INTO items VALUES (786, -6, 36.18, 'item786');
+INSERT INTO items VALUES (787, 1, 37.31, 'item787');
+INSERT INTO items VALUES (788, 8, 38.44, 'item788');
+INSERT INTO items VALUES (789, -8, 39.57, 'item789');
+INSERT INTO items VALUES (790, -1, 40.70, '');
+INSERT INTO items VALUES (791, 6, 41.83, 'item791');
+INSERT INTO items VALUES (792, -10, 42.96, 'item792');
+INSERT INTO items VALUES (793, -3, 43.09, 'item793');
+INSERT INTO items VALUES (794, 4, 44.22, 'item794');
+INSERT INTO items VALUES (795, 11, 45.35, 'item795');
+INSERT INTO items VALUES (796, -5, 46.48, 'item796');
+INSERT INTO items VALUES (797, 2, 47.61, 'item797');
+INSERT INTO items VALUES (798, 9, 48.74, 'item798');
+INSERT INTO items VALUES (799, -7, 49.87, 'item799');
+INSERT INTO items VALUES (800, 0, 0.00, '');
+INSERT INTO items VALUES (801, 7, 1.13, 'item801');
+INSERT INTO items VALUES (802, -9, 2.26, 'item802');
+INSERT INTO items VALUES (803, -2, 3.39, 'item803');
+INSERT INTO items VALUES (804, 5, 4.52, 'item804');
+INSERT INTO items VALUES (805, -11, 5.65, 'item805');
+INSERT INTO items VALUES (806, -4, 6.78, 'item806');
+INSERT INTO items VALUES (807, 3, 7.91, 'item807');
+INSERT INTO items VALUES (808, 10, 8.04, 'item808');
+INSERT INTO items VALUES (809, -6, 9.17, 'item809');
+INSERT INTO items VALUES (810, 1, 10.30, '');
+INSERT INTO items VALUES (811, 8, 11.43, 'item811');
+INSERT INTO items VALUES (812, -8, 12.56, 'item812');
+INSERT INTO items VALUES (813, -1, 13.69, 'item813');
+INSERT INTO items VALUES (814, 6, 14.82, 'item814');
+INSERT INTO items VALUES (815, -10, 15.95, 'item815');
+INSERT INTO items VALUES (816, -3, 16.08, 'item816');
+INSERT INTO items VALUES (817, 4, 17.21, 'item817');
+INSERT INTO items VALUES (818, 11, 18.34, 'item818');
+INSERT INTO items VALUES (819, -5, 19.47, 'item819');
+INSERT INTO items VALUES (820, 2, 20.60, '');
+INSERT INTO items VALUES (821, 9, 21.73, 'item821');
+INSERT INTO items VALUES (822, -7, 22.86, 'item822');
+INSERT INTO items VALUES (823, 0, 23.99, 'item823');
+INSERT INTO items VALUES (824, 7, 24.12, 'item824');
+INSERT INTO items VALUES (825, -9, 25.25, 'item825');
+INSERT INTO items VALUES (826, -2, 26.38, 'item826');
+INSERT INTO items VALUES (827, 5, 27.51, 'item827');
+INSERT INTO items VALUES (828, -11, 28.64, 'item828');
+INSERT INTO items VALUES (829, -4, 29.77, 'item829');
+INSERT INTO items VALUES (830, 3, 30.90, '');
+INSERT INTO items VALUES (831, 10, 31.03, 'item831');
+INSERT INTO items VALUES (832, -6, 32.16, 'item832');
+INSERT INTO items VALUES (833, 1, 33.29, 'item833');
+INSERT INTO items VALUES (834, 8, 34.42, 'item834');
+INSERT INTO items VALUES (835, -8, 35.55, 'item835');
+INSERT INTO items VALUES (836, -1, 36.68, 'item836');
+INSERT INTO items VALUES (837, 6, 37.81, 'item837');
+INSERT INTO items VALUES (838, -10, 38.94, 'item838');
+INSERT INTO items VALUES (839, -3, 39.07, 'item839');
+INSERT INTO items VALUES (840, 4, 40.20, '');
+INSERT INTO items VALUES (841, 11, 41.33, 'item841');
+INSERT INTO items VALUES (842, -5, 42.46, 'item842');
+INSERT INTO items VALUES (843, 2, 43.59, 'item843');
+INSERT INTO items VALUES (844, 9, 44.72, 'item844');
+INSERT INTO items VALUES (845, -7, 45.85, 'item845');
+INSERT INTO items VALUES (846, 0, 46.98, 'item846');
+INSERT INTO items VALUES (847, 7, 47.11, 'item847');
+INSERT INTO items VALUES (848, -9, 48.24, 'item848');
+INSERT INTO items VALUES (849, -2, 49.37, 'item849');
+INSERT INTO items VALUES (850, 5, 0.50, '');
+INSERT INTO items VALUES (851, -11, 1.63, 'item851');
+INSERT INTO items VALUES (852, -4, 2.76, 'item852');
+INSERT INTO items VALUES (853, 3, 3.89, 'item853');
+INSERT INTO items VALUES (854, 10, 4.02, 'item854');
+INSERT INTO items VALUES (855, -6, 5.15, 'item855');
+INSERT INTO items VALUES (856, 1, 6.28, 'item856');
+INSERT INTO items VALUES (857, 8, 7.41, 'item857');
+INSERT INTO items VALUES (858, -8, 8.54, 'item858');
+INSERT INTO items VALUES (859, -1, 9.67, 'item859');
+INSERT INTO items VALUES (860, 6, 10.80, '');
+INSERT INTO items VALUES (861, -10, 11.93, 'item861');
+INSERT INTO items VALUES (862, -3, 12.06, 'item862');
+INSERT INTO items VALUES (863, 4, 13.19, 'item863');
+INSERT INTO items VALUES (864, 11, 14.32, 'item864');
+INSERT INTO items VALUES (865, -5, 15.45, 'item865');
+INSERT INTO items VALUES (866, 2, 16.58, 'item866');
+INSERT INTO items VALUES (867, 9, 17.71, 'item867');
+INSERT INTO items VALUES (868, -7, 18.84, 'item868');
+INSERT INTO items VALUES (869, 0, 19.97, 'item869');
+INSERT INTO items VALUES (870, 7, 20.10, '');
+INSERT INTO items VALUES (871, -9, 21.23, 'item871');
+INSERT INTO items VALUES (872, -2, 22.36, 'item872');
+INSERT INTO items VALUES (873, 5, 23.49, 'item873');
+INSERT INTO items VALUES (874, -11, 24.62, 'item874');
+INSERT INTO items VALUES (875, -4, 25.75, 'item875');
+INSERT INTO items VALUES (876, 3, 26.88, 'item876');
+INSERT INTO items VALUES (877, 10, 27.01, 'item877');
+INSERT INTO items VALUES (878, -6, 28.14, 'item878');
+INSERT INTO items VALUES (879, 1, 29.27, 'item879');
+INSERT INTO items VALUES (880, 8, 30.40, '');
+INSERT INTO items VALUES (881, -8, 31.53, 'item881');
+INSERT INTO items VALUES (882, -1, 32.66, 'item882');
+INSERT INTO items VALUES (883, 6, 33.79, 'item883');
+INSERT INTO items VALUES (884, -10, 34.92, 'item884');
+INSERT INTO items VALUES (885, -3, 35.05, 'item885');
+INSERT INTO items VALUES (886, 4, 36.18, 'item886');
+INSERT INTO items VALUES (887, 11, 37.31, 'item887');
+INSERT INTO items VALUES (888, -5, 38.44, 'item888');
+INSERT INTO items VALUES (889, 2, 39.57, 'item889');
+INSERT INTO items VALUES (890, 9, 40.70, '');
+INSERT INTO items VALUES (891, -7, 41.83, 'item891');
+INSERT INTO items VALUES (892, 0, 42.96, 'item892');
+INSERT INTO items VALUES (893, 7, 43.09, 'item893');
+INSERT INTO items VALUES (894, -9, 44.22, 'item894');
+INSERT INTO items VALUES (895, -2, 45.35, 'item895');
+INSERT INTO items VALUES (896, 5, 46.48, 'item896');
+INSERT INTO items VALUES (897, -11, 47.61, 'item897');
+INSERT INTO items VALUES (898, -4, 48.74, 'item898');
+INSERT INTO items VALUES (899, 3, 49.87, 'item899');
+INSERT INTO items VALUES (900, 10, 0.00, '');
+INSERT INTO items VALUES (901, -6, 1.13, 'item901');
+INSERT INTO items VALUES (902, 1, 2.26, 'item902');
+INSERT INTO items VALUES (903, 8, 3.39, 'item903');
+INSERT INTO items VALUES (904, -8, 4.52, 'item904');
+INSERT INTO items VALUES (905, -1, 5.65, 'item905');
+INSERT INTO items VALUES (906, 6, 6.78, 'item906');
+INSERT INTO items VALUES (907, -10, 7.91, 'item907');
+INSERT INTO items VALUES (908, -3, 8.04, 'item908');
+INSERT INTO items VALUES (909, 4, 9.17, 'item909');
+INSERT INTO items VALUES (910, 11, 10.30, '');
+INSERT INTO items VALUES (911, -5, 11.43, 'item911');
+INSERT INTO items VALUES (912, 2, 12.56, 'item912');
+INSERT INTO items VALUES (913, 9, 13.69, 'item913');
+INSERT INTO items VALUES (914, -7, 14.82, 'item914');
+INSERT INTO items VALUES (915, 0, 15.95, 'item915');
+INSERT INTO items VALUES (916, 7, 16.08, 'item916');
+INSERT INTO items VALUES (917, -9, 17.21, 'item917');
+INSERT INTO items VALUES (918, -2, 18.34, 'item918');
+INSERT INTO items VALUES (919, 5, 19.47, 'item919');
+INSERT INTO items VALUES (920, -11, 20.60, '');
+INSERT INTO items VALUES (921, -4, 21.73, 'item921');
+INSERT INTO items VALUES (922, 3, 22.86, 'item922');
+INSERT INTO items VALUES (923, 10, 23.99, 'item923');
+INSERT INTO items VALUES (924, -6, 24.12, 'item924');
+INSERT INTO items VALUES (925, 1, 25.25, 'item925');
+INSERT INTO items VALUES (926, 8, 26.38, 'item926');
+INSERT INTO items VALUES (927, -8, 27.51, 'item927');
+INSERT INTO items VALUES (928, -1, 28.64, 'item928');
+INSERT INTO items VALUES (929, 6, 29.77, 'item929');
+INSERT INTO items VALUES (930, -10, 30.90, '');
+INSERT INTO items VALUES (931, -3, 31.03, 'item931');
+INSERT INTO items VALUES (932, 4, 32.16, 'item932');
+INSERT INTO items VALUES (933, 11, 33.29, 'item933');
+INSERT INTO items VALUES (934, -5, 34.42, 'item934');
+INSERT INTO items VALUES (935, 2, 35.55, 'item935');
+INSERT INTO items VALUES (936, 9, 36.68, 'item936');
+INSERT INTO items VALUES (937, -7, 37.81, 'item937');
+INSERT INTO items VALUES (938, 0, 38.94, 'item938');
+INSERT INTO items VALUES (939, 7, 39.07, 'item939');
+INSERT INTO items VALUES (940, -9, 40.20, '');
+INSERT INTO items VALUES (941, -2, 41.33, 'item941');
+INSERT INTO items VALUES (942, 5, 42.46, 'item942');
+INSERT INTO items VALUES (943, -11, 43.59, 'item943');
+INSERT INTO items VALUES (944, -4, 44.72, 'item944');
+INSERT INTO items VALUES (945, 3, 45.85, 'item945');
+INSERT INTO items VALUES (946, 10, 46.98, 'item946');
+INSERT INTO items VALUES (947, -6, 47.11, 'item947');
+INSERT INTO items VALUES (948, 1, 48.24, 'item948');
+INSERT INTO items VALUES (949, 8, 49.37, 'item949');
+INSERT INTO items VALUES (950, -8, 0.50, '');
+INSERT INTO items VALUES (951, -1, 1.63, 'item951');
+INSERT INTO items VALUES (952, 6, 2.76, 'item952');
+INSERT INTO items VALUES (953, -10, 3.89, 'item953');
+INSERT INTO items VALUES (954, -3, 4.02, 'item954');
+INSERT INTO items VALUES (955, 4, 5.15, 'item955');
+INSERT INTO items VALUES (956, 11, 6.28, 'item956');
+INSERT INTO items VALUES (957, -5, 7.41, 'item957');
+INSERT INTO items VALUES (958, 2, 8.54, 'item958');
+INSERT INTO items VALUES (959, 9, 9.67, 'item959');
+INSERT INTO items VALUES (960, -7, 10.80, '');
+INSERT INTO items VALUES (961, 0, 11.93, 'item961');
+INSERT INTO items VALUES (962, 7, 12.06, 'item962');
+INSERT INTO items VALUES (963, -9, 13.19, 'item963');
+INSERT INTO items VALUES (964, -2, 14.32, 'item964');
+INSERT INTO items VALUES (965, 5, 15.45, 'item965');
+INSERT INTO items VALUES (966, -11, 16.58, 'item966');
+INSERT INTO items VALUES (967, -4, 17.71, 'item967');
+INSERT INTO items VALUES (968, 3, 18.84, 'item968');
+INSERT INTO items VALUES (969, 10, 19.97, 'item969');
+INSERT INTO items VALUES (970, -6, 20.10, '');
+INSERT INTO items VALUES (971, 1, 21.23, 'item971');
+INSERT INTO items VALUES (972, 8, 22.36, 'item972');
+INSERT INTO items VALUES (973, -8, 23.49, 'item973');
+INSERT INTO items VALUES (974, -1, 24.62, 'item974');
+INSERT INTO items VALUES (975, 6, 25.75, 'item975');
+INSERT INTO items VALUES (976, -10, 26.88, 'item976');
+INSERT INTO items VALUES (977, -3, 27.01, 'item977');
+INSERT INTO items VALUES (978, 4, 28.14, 'item978');
+INSERT INTO items VALUES (979, 11, 29.27, 'item979');
+INSERT INTO items VALUES (980, -5, 30.40, '');
+INSERT INTO items VALUES (981, 2, 31.53, 'item981');
+INSERT INTO items VALUES (982, 9, 32.66, 'item982');
+INSERT INTO items VALUES (983, -7, 33.79, 'item983');
+INSERT INTO items VALUES (984, 0, 34.92, 'item984');
+INSERT INTO items VALUES (985, 7, 35.05, 'item985');
+INSERT INTO items VALUES (986, -9, 36.18, 'item986');
+INSERT INTO items VALUES (987, -2, 37.31, 'item987');
+INSERT INTO items VALUES (988, 5, 38.44, 'item988');
+INSERT INTO items VALUES (989, -11, 39.57, 'item989');
+INSERT INTO items VALUES (990, -4, 40.70, '');
+INSERT INTO items VALUES (991, 3, 41.83, 'item991');
+INSERT INTO items VALUES (992, 10, 42.96, 'item992');
+INSERT INTO items VALUES (993, -6, 43.09, 'item993');
+INSERT INTO items VALUES (994, 1, 44.22, 'item994');
+INSERT INTO items VALUES (995, 8, 45.35, 'item995');
+INSERT INTO items VALUES (996, -8, 46.48, 'item996');
+INSERT INTO items VALUES (997, -1, 47.61, 'item997');
+INSERT INTO items VALUES (998, 6, 48.74, 'item998');
+INSERT INTO items VALUES (999, -10, 49.87, 'item999');
+INSERT INTO items VALUES (1000, -3, 0.00, '');
+INSERT INTO items VALUES (1001, 4, 1.13, 'item1001');
+INSERT INTO items VALUES (1002, 11, 2.26, 'item1002');
+INSERT INTO items VALUES (1003, -5, 3.39, 'item1003');
+INSERT INTO items VALUES (1004, 2, 4.52, 'item1004');
+INSERT INTO items VALUES (1005, 9, 5.65, 'item1005');
+INSERT INTO items VALUES (1006, -7, 6.78, 'item1006');
+INSERT INTO items VALUES (1007, 0, 7.91, 'item1007');
+INSERT INTO items VALUES (1008, 7, 8.04, 'item1008');
+INSERT INTO items VALUES (1009, -9, 9.17, 'item1009');
+INSERT INTO items VALUES (1010, -2, 10.30, '');
+INSERT INTO items VALUES (1011, 5, 11.43, 'item1011');
+INSERT INTO items VALUES (1012, -11, 12.56, 'item1012');
+INSERT INTO items VALUES (1013, -4, 13.69, 'item1013');
+INSERT INTO items VALUES (1014, 3, 14.82, 'item1014');
+INSERT INTO items VALUES (1015, 10, 15.95, 'item1015');
+INSERT INTO items VALUES (1016, -6, 16.08, 'item1016');
+INSERT INTO items VALUES (1017, 1, 17.21, 'item1017');
+INSERT INTO items VALUES (1018, 8, 18.34, 'item1018');
+INSERT INTO items VALUES (1019, -8, 19.47, 'item1019');
+INSERT INTO items VALUES (1020, -1, 20.60, '');
+INSERT INTO items VALUES (1021, 6, 21.73, 'item1021');
+INSERT INTO items VALUES (1022, -10, 22.86, 'item1022');
+INSERT INTO items VALUES (1023, -3, 23.99, 'item1023');
+INSERT INTO items VALUES (1024, 4, 24.12, 'item1024');
+INSERT INTO items VALUES (1025, 11, 25.25, 'item1025');
+INSERT INTO items VALUES (1026, -5, 26.38, 'item1026');
+INSERT INTO items VALUES (1027, 2, 27.51, 'item1027');
+INSERT INTO items VALUES (1028, 9, 28.64, 'item1028');
+INSERT INTO items VALUES (1029, -7, 29.77, 'item1029');
+INSERT INTO items VALUES (1030, 0, 30.90, '');
+INSERT INTO items VALUES (1031, 7, 31.03, 'item1031');
+INSERT INTO items VALUES (1032, -9, 32.16, 'item1032');
+INSERT INTO items VALUES (1033, -2, 33.29, 'item1033');
+INSERT INTO items VALUES (1034, 5, 34.42, 'item1034');
+INSERT INTO items VALUES (1035, -11, 35.55, 'item1035');
+INSERT INTO items VALUES (1036, -4, 36.68, 'item1036');
+INSERT INTO items VALUES (1037, 3, 37.81, 'item1037');
+INSERT INTO items VALUES (1038, 10, 38.94, 'item1038');
+INSERT INTO items VALUES (1039, -6, 39.07, 'item1039');
+INSERT INTO items VALUES (1040, 1, 40.20, '');
+INSERT INTO items VALUES (1041, 8, 41.33, 'item1041');
+INSERT INTO items VALUES (1042, -8, 42.46, 'item1042');
+INSERT INTO items VALUES (1043, -1, 43.59, 'item1043');
+INSERT INTO items VALUES (1044, 6, 44.72, 'item1044');
+INSERT INTO items VALUES (1045, -10, 45.85, 'item1045');
+INSERT INTO items VALUES (1046, -3, 46.98, 'item1046');
+INSERT INTO items VALUES (1047, 4, 47.11, 'item1047');
+INSERT INTO items VALUES (1048, 11, 48.24, 'item1048');
+INSERT INTO items VALUES (1049, -5, 49.37, 'item1049');
+INSERT INTO items VALUES (1050, 2, 0.50, '');
+INSERT INTO items VALUES (1051, 9, 1.63, 'item1051');
+INSERT INTO items VALUES (1052, -7, 2.76, 'item1052');
+INSERT INTO items VALUES (1053, 0, 3.89, 'item1053');
+INSERT INTO items VALUES (1054, 7, 4.02, 'item1054');
+INSERT INTO items VALUES (1055, -9, 5.15, 'item1055');
+INSERT INTO items VALUES (1056, -2, 6.28, 'item1056');
+INSERT INTO items VALUES (1057, 5, 7.41, 'item1057');
+INSERT INTO items VALUES (1058, -11, 8.54, 'item1058');
+INSERT INTO items VALUES (1059, -4, 9.67, 'item1059');
+INSERT INTO items VALUES (1060, 3, 10.80, '');
+INSERT INTO items VALUES (1061, 10, 11.93, 'item1061');
+INSERT INTO items VALUES (1062, -6, 12.06, 'item1062');
+INSERT INTO items VALUES (1063, 1, 13.19, 'item1063');
+INSERT INTO items VALUES (1064, 8, 14.32, 'item1064');
+INSERT INTO items VALUES (1065, -8, 15.45, 'item1065');
+INSERT INTO items VALUES (1066, -1, 16.58, 'item1066');
+INSERT INTO items VALUES (1067, 6, 17.71, 'item1067');
+INSERT INTO items VALUES (1068, -10, 18.84, 'item1068');
+INSERT INTO items VALUES (1069, -3, 19.97, 'item1069');
+INSERT INTO items VALUES (1070, 4, 20.10, '');
+INSERT INTO items VALUES (1071, 11, 21.23, 'item1071');
+INSERT INTO items VALUES (1072, -5, 22.36, 'item1072');
+INSERT INTO items VALUES (1073, 2, 23.49, 'item1073');
+INSERT INTO items VALUES (1074, 9, 24.62, 'item1074');
+INSERT INTO items VALUES (1075, -7, 25.75, 'item1075');
+INSERT INTO items VALUES (1076, 0, 26.88, 'item1076');
+INSERT INTO items VALUES (1077, 7, 27.01, 'item1077');
+INSERT INTO items VALUES (1078, -9, 28.14, 'item1078');
+INSERT INTO items VALUES (1079, -2, 29.27, 'item1079');
+INSERT INTO items VALUES (1080, 5, 30.40, '');
+INSERT INTO items VALUES (1081, -11, 31.53, 'item1081');
+INSERT INTO items VALUES (1082, -4, 32.66, 'item1082');
+INSERT INTO items VALUES (1083, 3, 33.79, 'item1083');
+INSERT INTO items VALUES (1084, 10, 34.92, 'item1084');
+INSERT INTO items VALUES (1085, -6, 35.05, 'item1085');
+INSERT INTO items VALUES (1086, 1, 36.18, 'item1086');
+INSERT INTO items VALUES (1087, 8, 37.31, 'item1087');
+INSERT INTO items VALUES (1088, -8, 38.44, 'item1088');
+INSERT INTO items VALUES (1089, -1, 39.57, 'item1089');
+INSERT INTO items VALUES (1090, 6, 40.70, '');
+INSERT INTO items VALUES (1091, -10, 41.83, 'item1091');
+INSERT INTO items VALUES (1092, -3, 42.96, 'item1092');
+INSERT INTO items VALUES (1093, 4, 43.09, 'item1093');
+INSERT INTO items VALUES (1094, 11, 44.22, 'item1094');
+INSERT INTO items VALUES (1095, -5, 45.35, 'item1095');
+INSERT INTO items VALUES (1096, 2, 46.48, 'item1096');
+INSERT INTO items VALUES (1097, 9, 47.61, 'item1097');
+INSERT INTO items VALUES (1098, -7, 48.74, 'item1098');
+INSERT INTO items VALUES (1099, 0, 49.87, 'item1099');
+INSERT INTO orders VALUES (0, 0);
+INSERT INTO orders VALUES (1, 37);
+INSERT INTO orders VALUES (2, 74);
+INSERT INTO orders VALUES (3, 111);
+INSERT INTO orders VALUES (4, 148);
+INSERT INTO orders VALUES (5, 185);
+INSERT INTO orders VALUES (6, 222);
+INSERT INTO orders VALUES (7, 259);
+INSERT INTO orders VALUES (8, 296);
+INSERT INTO orders VALUES (9, 333);
+INSERT INTO orders VALUES (10, 370);
+INSERT INTO orders VALUES (11, 407);
+INSERT INTO orders VALUES (12, 444);
+INSERT INTO orders VALUES (13, 481);
+INSERT INTO orders VALUES (14, 518);
+INSERT INTO orders VALUES (15, 555);
+INSERT INTO orders VALUES (16, 592);
+INSERT INTO orders VALUES (17, 629);
+INSERT INTO orders VALUES (18, 666);
+INSERT INTO orders VALUES (19, 703);
+INSERT INTO orders VALUES (20, 740);
+INSERT INTO orders VALUES (21, 777);
+INSERT INTO orders VALUES (22, 814);
+INSERT INTO orders VALUES (23, 851);
+INSERT INTO orders VALUES (24, 888);
+INSERT INTO orders VALUES (25, 925);
+INSERT INTO orders VALUES (26, 962);
+INSERT INTO orders VALUES (27, 999);
+INSERT INTO orders VALUES (28, 1036);
+INSERT INTO orders VALUES (29, 1073);
+INSERT INTO orders VALUES (30, 10);
+INSERT INTO orders VALUES (31, 47);
+INSERT INTO orders VALUES (32, 84);
+INSERT INTO orders VALUES (33, 121);
+INSERT INTO orders VALUES (34, 158);
+INSERT INTO orders VALUES (35, 195);
+INSERT INTO orders VALUES (36, 232);
+INSERT INTO orders VALUES (37, 269);
+INSERT INTO orders VALUES (38, 306);
+INSERT INTO orders VALUES (39, 343);
@@ -0,0 +1,4 @@
+USE DATABASE shop;
+SELECT id, qty, price, name FROM items WHERE id < 3 OR id = 10;
+SELECT name FROM items WHERE id < 0;
+SELECT orders.id, items.name, items.price FROM orders INNER JOIN items ON orders.item_id = items.id WHERE orders.id < 4;
@@ -0,0 +1,8227 @@
+CREATE DATABASE shop;
+USE DATABASE shop;
+CREATE TABLE sales (id INTEGER, store INTEGER, amount FLOAT);
+CREATE TABLE stores (id INTEGER, city TEXT);
+INSERT INTO sales VALUES (0, 0, 0.0);
+INSERT INTO sales VALUES (1, 148, 6.5);
+INSERT INTO sales VALUES (2, 296, 13.0);
+INSERT INTO sales VALUES (3, 444, 19.5);
+INSERT INTO sales VALUES (4, 592, 26.0);
+INSERT INTO sales VALUES (5, 740, 32.5);
+INSERT INTO sales VALUES (6, 888, 39.0);
+INSERT INTO sales VALUES (7, 1036, 45.5);
+INSERT INTO sales VALUES (8, 1184, 52.0);
+INSERT INTO sales VALUES (9, 1332, 58.5);
+INSERT INTO sales VALUES (10, 1480, 65.0);
+INSERT INTO sales VALUES (11, 1628, 71.5);
+INSERT INTO sales VALUES (12, 1776, 78.0);
+INSERT INTO sales VALUES (13, 1924, 84.5);
+INSERT INTO sales VALUES (14, 2072, 91.0);
+INSERT INTO sales VALUES (15, 2220, 97.5);
+INSERT INTO sales VALUES (16, 2368, 104.0);
+INSERT INTO sales VALUES (17, 2516, 110.5);
+INSERT INTO sales VALUES (18, 2664, 117.0);
+INSERT INTO sales VALUES (19, 2812, 123.5);
+INSERT INTO sales VALUES (20, 2960, 130.0);
+INSERT INTO sales VALUES (21, 3108, 136.5);
+INSERT INTO sales VALUES (22, 3256, 143.0);
+INSERT INTO sales VALUES (23, 3404, 149.5);
+INSERT INTO sales VALUES (24, 3552, 156.0);
+INSERT INTO sales VALUES (25, 3700, 162.5);
+INSERT INTO sales VALUES (26, 3848, 169.0);
+INSERT INTO sales VALUES (27, 3996, 175.5);
+INSERT INTO sales VALUES (28, 4144, 182.0);
+INSERT INTO sales VALUES (29, 4292, 188.5);
+INSERT INTO sales VALUES (30, 4440, 195.0);
+INSERT INTO sales VALUES (31, 4588, 201.5);
+INSERT INTO sales VALUES (32, 4736, 208.0);
+INSERT INTO sales VALUES (33, 4884, 214.5);
+INSERT INTO sales VALUES (34, 5032, 221.0);
+INSERT INTO sales VALUES (35, 5180, 227.5);
+INSERT INTO sales VALUES (36, 5328, 234.0);
+INSERT INTO sales VALUES (37, 5476, 240.5);
+INSERT INTO sales VALUES (38, 5624, 247.0);
+INSERT INTO sales VALUES (39, 5772, 253.5);
+INSERT INTO sales VALUES (40, 5920, 260.0);
+INSERT INTO sales VALUES (41, 6068, 266.5);
+INSERT INTO sales VALUES (42, 6216, 273.0);
+INSERT INTO sales VALUES (43, 6364, 279.5);
+INSERT INTO sales VALUES (44, 6512, 286.0);
+INSERT INTO sales VALUES (45, 6660, 292.5);
+INSERT INTO sales VALUES (46, 6808, 299.0);
+INSERT INTO sales VALUES (47, 6956, 305.5);
+INSERT INTO sales VALUES (48, 7104, 312.0);
+INSERT INTO sales VALUES (49, 7252, 318.5);
+INSERT INTO sales VALUES (50, 7400, 325.0);
+INSERT INTO sales VALUES (51, 7548, 331.5);
+INSERT INTO sales VALUES (52, 7696, 338.0);
+INSERT INTO sales VALUES (53, 7844, 344.5);
+INSERT INTO sales VALUES (54, 7992, 351.0);
+INSERT INTO sales VALUES (55, 8140, 357.5);
+INSERT INTO sales VALUES (56, 96, 364.0);
+INSERT INTO sales VALUES (57, 244, 370.5);
+INSERT INTO sales VALUES (58, 392, 377.0);
+INSERT INTO sales VALUES (59, 540, 383.5);
+INSERT INTO sales VALUES (60, 688, 390.0);
+INSERT INTO sales VALUES (61, 836, 396.5);
+INSERT INTO sales VALUES (62, 984, 403.0);
+INSERT INTO sales VALUES (63, 1132, 409.5);
+INSERT INTO sales VALUES (64, 1280, 416.0);
+INSERT INTO sales VALUES (65, 1428, 422.5);
+INSERT INTO sales VALUES (66, 1576, 429.0);
+INSERT INTO sales VALUES (67, 1724, 435.5);
+INSERT INTO sales VALUES (68, 1872, 442.0);
+INSERT INTO sales VALUES (69, 2020, 448.5);
+INSERT INTO sales VALUES (70, 2168, 455.0);
+INSERT INTO sales VALUES (71, 2316, 461.5);
+INSERT INTO sales VALUES (72, 2464, 468.0);
+INSERT INTO sales VALUES (73, 2612, 474.5);
+INSERT INTO sales VALUES (74, 2760, 481.0);
+INSERT INTO sales VALUES (75, 2908, 487.5);
+INSERT INTO sales VALUES (76, 3056, 494.0);
+INSERT INTO sales VALUES (77, 3204, 500.5);
+INSERT INTO sales VALUES (78, 3352, 507.0);
+INSERT INTO sales VALUES (79, 3500, 513.5);
+INSERT INTO sales VALUES (80, 3648, 520.0);
+INSERT INTO sales VALUES (81, 3796, 526.5);
+INSERT INTO sales VALUES (82, 3944, 533.0);
+INSERT INTO sales VALUES (83, 4092, 539.5);
+INSERT INTO sales VALUES (84, 4240, 546.0);
+INSERT INTO sales VALUES (85, 4388, 552.5);
+INSERT INTO sales VALUES (86, 4536, 559.0);
+INSERT INTO sales VALUES (87, 4684, 565.5);
+INSERT INTO sales VALUES (88, 4832, 572.0);
+INSERT INTO sales VALUES (89, 4980, 578.5);
+INSERT INTO sales VALUES (90, 5128, 585.0);
+INSERT INTO sales VALUES (91, 5276, 591.5);
+INSERT INTO sales VALUES (92, 5424, 598.0);
+INSERT INTO sales VALUES (93, 5572, 604.5);
+INSERT INTO sales VALUES (94, 5720, 611.0);
+INSERT INTO sales VALUES (95, 5868, 617.5);
+INSERT INTO sales VALUES (96, 6016, 624.0);
+INSERT INTO sales VALUES (97, 6164, 630.5);
+INSERT INTO sales VALUES (98, 6312, 637.0);
+INSERT INTO sales VALUES (99, 6460, 643.5);
+INSERT INTO sales VALUES (100, 6608, 650.0);
+INSERT INTO sales VALUES (101, 6756, 656.5);
+INSERT INTO sales VALUES (102, 6904, 663.0);
+INSERT INTO sales VALUES (103, 7052, 669.5);
+INSERT INTO sales VALUES (104, 7200, 676.0);
+INSERT INTO sales VALUES (105, 7348, 682.5);
+INSERT INTO sales VALUES (106, 7496, 689.0);
+INSERT INTO sales VALUES (107, 7644, 695.5);
+INSERT INTO sales VALUES (108, 7792, 702.0);
+INSERT INTO sales VALUES (109, 7940, 708.5);
+INSERT INTO sales VALUES (110, 8088, 715.0);
+INSERT INTO sales VALUES (111, 44, 721.5);
+INSERT INTO sales VALUES (112, 192, 728.0);
+INSERT INTO sales VALUES (113, 340, 734.5);
+INSERT INTO sales VALUES (114, 488, 741.0);
+INSERT INTO sales VALUES (115, 636, 747.5);
+INSERT INTO sales VALUES (116, 784, 754.0);
+INSERT INTO sales VALUES (117, 932, 760.5);
+INSERT INTO sales VALUES (118, 1080, 767.0);
+INSERT INTO sales VALUES (119, 1228, 773.5);
+INSERT INTO sales VALUES (120, 1376, 780.0);
+INSERT INTO sales VALUES (121, 1524, 786.5);
+INSERT INTO sales VALUES (122, 1672, 793.0);
+INSERT INTO sales VALUES (123, 1820, 799.5);
+INSERT INTO sales VALUES (124, 1968, 806.0);
+INSERT INTO sales VALUES (125, 2116, 812.5);
+INSERT INTO sales VALUES (126, 2264, 819.0);
+INSERT INTO sales VALUES (127, 2412, 825.5);
+INSERT INTO sales VALUES (128, 2560, 832.0);
+INSERT INTO sales VALUES (129, 2708, 838.5);
+INSERT INTO sales VALUES (130, 2856, 845.0);
+INSERT INTO sales VALUES (131, 3004, 851.5);
+INSERT INTO sales VALUES (132, 3152, 858.0);
+INSERT INTO sales VALUES (133, 3300, 864.5);
+INSERT INTO sales VALUES (134, 3448, 871.0);
+INSERT INTO sales VALUES (135, 3596, 877.5);
+INSERT INTO sales VALUES (136, 3744, 884.0);
+INSERT INTO sales VALUES (137, 3892, 890.5);
+INSERT INTO sales VALUES (138, 4040, 897.0);
+INSERT INTO sales VALUES (139, 4188, 903.5);
+INSERT INTO sales VALUES (140, 4336, 910.0);
+INSERT INTO sales VALUES (141, 4484, 916.5);
+INSERT INTO sales VALUES (142, 4632, 923.0);
+INSERT INTO sales VALUES (143, 4780, 929.5);
+INSERT INTO sales VALUES (144, 4928, 936.0);
+INSERT INTO sales VALUES (145, 5076, 942.5);
+INSERT INTO sales VALUES (146, 5224, 949.0);
+INSERT INTO sales VALUES (147, 5372, 955.5);
+INSERT INTO sales VALUES (148, 5520, 962.0);
+INSERT INTO sales VALUES (149, 5668, 968.5);
+INSERT INTO sales VALUES (150, 5816, 975.0);
+INSERT INTO sales VALUES (151, 5964, 981.5);
+INSERT INTO sales VALUES (152, 6112, 988.0);
+INSERT INTO sales VALUES (153, 6260, 994.5);
+INSERT INTO sales VALUES (154, 6408, 1001.0);
+INSERT INTO sales VALUES (155, 6556, 1007.5);
+INSERT INTO sales VALUES (156, 6704, 1014.0);
+INSERT INTO sales VALUES (157, 6852, 1020.5);
+INSERT INTO sales VALUES (158, 7000, 3.0);
+INSERT INTO sales VALUES (159, 7148, 9.5);
+INSERT INTO sales VALUES (160, 7296, 16.0);
+INSERT INTO sales VALUES (161, 7444, 22.5);
+INSERT INTO sales VALUES (162, 7592, 29.0);
+INSERT INTO sales VALUES (163, 7740, 35.5);
+INSERT INTO sales VALUES (164, 7888, 42.0);
+INSERT INTO sales VALUES (165, 8036, 48.5);
+INSERT INTO sales VALUES (166, 8184, 55.0);
+INSERT INTO sales VALUES (167, 140, 61.5);
+INSERT INTO sales VALUES (168, 288, 68.0);
+INSERT INTO sales VALUES (169, 436, 74.5);
+INSERT INTO sales VALUES (170, 584, 81.0);
+INSERT INTO sales VALUES (171, 732, 87.5);
+INSERT INTO sales VALUES (172, 880, 94.0);
+INSERT INTO sales VALUES (173, 1028, 100.5);
+INSERT INTO sales VALUES (174, 1176, 107.0);
+INSERT INTO sales VALUES (175, 1324, 113.5);
+INSERT INTO sales VALUES (176, 1472, 120.0);
+INSERT INTO sales VALUES (177, 1620, 126.5);
+INSERT INTO sales VALUES (178, 1768, 133.0);
+INSERT INTO sales VALUES (179, 1916, 139.5);
+INSERT INTO sales VALUES (180, 2064, 146.0);
+INSERT INTO sales VALUES (181, 2212, 152.5);
+INSERT INTO sales VALUES (182, 2360, 159.0);
+INSERT INTO sales VALUES (183, 2508, 165.5);
+INSERT INTO sales VALUES (184, 2656, 172.0);
+INSERT INTO sales VALUES (185, 2804, 178.5);
+INSERT INTO sales VALUES (186, 2952, 185.0);
+INSERT INTO sales VALUES (187, 3100, 191.5);
+INSERT INTO sales VALUES (188, 3248, 198.0);
+INSERT INTO sales VALUES (189, 3396, 204.5);
+INSERT INTO sales VALUES (190, 3544, 211.0);
+INSERT INTO sales VALUES (191, 3692, 217.5);
+INSERT INTO sales VALUES (192, 3840, 224.0);
+INSERT INTO sales VALUES (193, 3988, 230.5);
+INSERT INTO sales VALUES (194, 4136, 237.0);
+INSERT INTO sales VALUES (195, 4284, 243.5);
+INSERT INTO sales VALUES (196, 4432, 250.0);
+INSERT INTO sales VALUES (197, 4580, 256.5);
+INSERT INTO sales VALUES (198, 4728, 263.0);
+INSERT INTO sales VALUES (199, 4876, 269.5);
+INSERT INTO sales VALUES (200, 5024, 276.0);
+INSERT INTO sales VALUES (201, 5172, 282.5);
+INSERT INTO sales VALUES (202, 5320, 289.0);
+INSERT INTO sales VALUES (203, 5468, 295.5);
+INSERT INTO sales VALUES (204, 5616, 302.0);
+INSERT INTO sales VALUES (205, 5764, 308.5);
+INSERT INTO sales VALUES (206, 5912, 315.0);
+INSERT INTO sales VALUES (207, 6060, 321.5);
+INSERT INTO sales VALUES (208, 6208, 328.0);
+INSERT INTO sales VALUES (209, 6356, 334.5);
+INSERT INTO sales VALUES (210, 6504, 341.0);
+INSERT INTO sales VALUES (211, 6652, 347.5);
+INSERT INTO sales VALUES (212, 6800, 354.0);
+INSERT INTO sales VALUES (213, 6948, 360.5);
+INSERT INTO sales VALUES (214, 7096, 367.0);
+INSERT INTO sales VALUES (215, 7244, 373.5);
+INSERT INTO sales VALUES (216, 7392, 380.0);
+INSERT INTO sales VALUES (217, 7540, 386.5);
+INSERT INTO sales VALUES (218, 7688, 393.0);
+INSERT INTO sales VALUES (219, 7836, 399.5);
+INSERT INTO sales VALUES (220, 7984, 406.0);
+INSERT INTO sales VALUES (221, 8132, 412.5);
+INSERT INTO sales VALUES (222, 88, 419.0);
+INSERT INTO sales VALUES (223, 236, 425.5);
+INSERT INTO sales VALUES (224, 384, 432.0);
+INSERT INTO sales VALUES (225, 532, 438.5);
+INSERT INTO sales VALUES (226, 680, 445.0);
+INSERT INTO sales VALUES (227, 828, 451.5);
+INSERT INTO sales VALUES (228, 976, 458.0);
+INSERT INTO sales VALUES (229, 1124, 464.5);
+INSERT INTO sales VALUES (230, 1272, 471.0);
+INSERT INTO sales VALUES (231, 1420, 477.5);
+INSERT INTO sales VALUES (232, 1568, 484.0);
+INSERT INTO sales VALUES (233, 1716, 490.5);
+INSERT INTO sales VALUES (234, 1864, 497.0);
+INSERT INTO sales VALUES (235, 2012, 503.5);
+INSERT INTO sales VALUES (236, 2160, 510.0);
+INSERT INTO sales VALUES (237, 2308, 516.5);
+INSERT INTO sales VALUES (238, 2456, 523.0);
+INSERT INTO sales VALUES (239, 2604, 529.5);
+INSERT INTO sales VALUES (240, 2752, 536.0);
+INSERT INTO sales VALUES (241, 2900, 542.5);
+INSERT INTO sales VALUES (242, 3048, 549.0);
+INSERT INTO sales VALUES (243, 3196, 555.5);
+INSERT INTO sales VALUES (244, 3344, 562.0);
+INSERT INTO sales VALUES (245, 3492, 568.5);
+INSERT INTO sales VALUES (246, 3640, 575.0);
+INSERT INTO sales VALUES (247, 3788, 581.5);
+INSERT INTO sales VALUES (248, 3936, 588.0);
+INSERT INTO sales VALUES (249, 4084, 594.5);
+INSERT INTO sales VALUES (250, 4232, 601.0);
+INSERT INTO sales VALUES (251, 4380, 607.5);
+INSERT INTO sales VALUES (252, 4528, 614.0);
+INSERT INTO sales VALUES (253, 4676, 620.5);
+INSERT INTO sales VALUES (254, 4824, 627.0);
+INSERT INTO sales VALUES (255, 4972, 633.5);
+INSERT INTO sales VALUES (256, 5120, 640.0);
+INSERT INTO sales VALUES (257, 5268, 646.5);
+INSERT INTO sales VALUES (258, 5416, 653.0);
+INSERT INTO sales VALUES (259, 5564, 659.5);
+INSERT INTO sales VALUES (260, 5712, 666.0);
+INSERT INTO sales VALUES (261, 5860, 672.5);
+INSERT INTO sales VALUES (262, 6008, 679.0);
+INSERT INTO sales VALUES (263, 6156, 685.5);
+INSERT INTO sales VALUES (264, 6304, 692.0);
+INSERT INTO sales VALUES (265, 6452, 698.5);
+INSERT INTO sales VALUES (266, 6600, 705.0);
+INSERT INTO sales VALUES (267, 6748, 711.5);
+INSERT INTO sales VALUES (268, 6896, 718.0);
+INSERT INTO sales VALUES (269, 7044, 724.5);
+INSERT INTO sales VALUES (270, 7192, 731.0);
+INSERT INTO sales VALUES (271, 7340, 737.5);
+INSERT INTO sales VALUES (272, 7488, 744.0);
+INSERT INTO sales VALUES (273, 7636, 750.5);
+INSERT INTO sales VALUES (274, 7784, 757.0);
+INSERT INTO sales VALUES (275, 7932, 763.5);
+INSERT INTO sales VALUES (276, 8080, 770.0);
+INSERT INTO sales VALUES (277, 36, 776.5);
+INSERT INTO sales VALUES (278, 184, 783.0);
+INSERT INTO sales VALUES (279, 332, 789.5);
+INSERT INTO sales VALUES (280, 480, 796.0);
+INSERT INTO sales VALUES (281, 628, 802.5);
+INSERT INTO sales VALUES (282, 776, 809.0);
+INSERT INTO sales VALUES (283, 924, 815.5);
+INSERT INTO sales VALUES (284, 1072, 822.0);
+INSERT INTO sales VALUES (285, 1220, 828.5);
+INSERT INTO sales VALUES (286, 1368, 835.0);
+INSERT INTO sales VALUES (287, 1516, 841.5);
+INSERT INTO sales VALUES (288, 1664, 848.0);
+INSERT INTO sales VALUES (289, 1812, 854.5);
+INSERT INTO sales VALUES (290, 1960, 861.0);
+INSERT INTO sales VALUES (291, 2108, 867.5);
+INSERT INTO sales VALUES (292, 2256, 874.0);
+INSERT INTO sales VALUES (293, 2404, 880.5);
+INSERT INTO sales VALUES (294, 2552, 887.0);
+INSERT INTO sales VALUES (295, 2700, 893.5);
+INSERT INTO sales VALUES (296, 2848, 900.0);
+INSERT INTO sales VALUES (297, 2996, 906.5);
+INSERT INTO sales VALUES (298, 3144, 913.0);
+INSERT INTO sales VALUES (299, 3292, 919.5);
+INSERT INTO sales VALUES (300, 3440, 926.0);
+INSERT INTO sales VALUES (301, 3588, 932.5);
+INSERT INTO sales VALUES (302, 3736, 939.0);
+INSERT INTO sales VALUES (303, 3884, 945.5);
+INSERT INTO sales VALUES (304, 4032, 952.0);
+INSERT INTO sales VALUES (305, 4180, 958.5);
+INSERT INTO sales VALUES (306, 4328, 965.0);
+INSERT INTO sales VALUES (307, 4476, 971.5);
+INSERT INTO sales VALUES (308, 4624, 978.0);
+INSERT INTO sales VALUES (309, 4772, 984.5);
+INSERT INTO sales VALUES (310, 4920, 991.0);
+INSERT INTO sales VALUES (311, 5068, 997.5);
+INSERT INTO sales VALUES (312, 5216, 1004.0);
+INSERT INTO sales VALUES (313, 5364, 1010.5);
+INSERT INTO sales VALUES (314, 5512, 1017.0);
+INSERT INTO sales VALUES (315, 5660, 1023.5);
+INSERT INTO sales VALUES (316, 5808, 6.0);
+INSERT INTO sales VALUES (317, 5956, 12.5);
+INSERT INTO sales VALUES (318, 6104, 19.0);
+INSERT INTO sales VALUES (319, 6252, 25.5);
+INSERT INTO sales VALUES (320, 6400, 32.0);
+INSERT INTO sales VALUES (321, 6548, 38.5);
+INSERT INTO sales VALUES (322, 6696, 45.0);
+INSERT INTO sales VALUES (323, 6844, 51.5);
+INSERT INTO sales VALUES (324, 6992, 58.0);
+INSERT INTO sales VALUES (325, 7140, 64.5);
+INSERT INTO sales VALUES (326, 7288, 71.0);
+INSERT INTO sales VALUES (327, 7436, 77.5);
+INSERT INTO sales VALUES (328, 7584, 84.0);
+INSERT INTO sales VALUES (329, 7732, 90.5);
+INSERT INTO sales VALUES (330, 7880, 97.0);
+INSERT INTO sales VALUES (331, 8028, 103.5);
+INSERT INTO sales VALUES (332, 8176, 110.0);
+INSERT INTO sales VALUES (333, 132, 116.5);
+INSERT INTO sales VALUES (334, 280, 123.0);
+INSERT INTO sales VALUES (335, 428, 129.5);
+INSERT INTO sales VALUES (336, 576, 136.0);
+INSERT INTO sales VALUES (337, 724, 142.5);
+INSERT INTO sales VALUES (338, 872, 149.0);
+INSERT INTO sales VALUES (339, 1020, 155.5);
+INSERT INTO sales VALUES (340, 1168, 162.0);
+INSERT INTO sales VALUES (341, 1316, 168.5);
+INSERT INTO sales VALUES (342, 1464, 175.0);
+INSERT INTO sales VALUES (343, 1612, 181.5);
+INSERT INTO sales VALUES (344, 1760, 188.0);
+INSERT INTO sales VALUES (345, 1908, 194.5);
+INSERT INTO sales VALUES (346, 2056, 201.0);
+INSERT INTO sales VALUES (347, 2204, 207.5);
+INSERT INTO sales VALUES (348, 2352, 214.0);
+INSERT INTO sales VALUES (349, 2500, 220.5);
+INSERT INTO sales VALUES (350, 2648, 227.0);
+INSERT INTO sales VALUES (351, 2796, 233.5);
+INSERT INTO sales VALUES (352, 2944, 240.0);
+INSERT INTO sales VALUES (353, 3092, 246.5);
+INSERT INTO sales VALUES (354, 3240, 253.0);
+INSERT INTO sales VALUES (355, 3388, 259.5);
+INSERT INTO sales VALUES (356, 3536, 266.0);
+INSERT INTO sales VALUES (357, 3684, 272.5);
+INSERT INTO sales VALUES (358, 3832, 279.0);
+INSERT INTO sales VALUES (359, 3980, 285.5);
+INSERT INTO sales VALUES (360, 4128, 292.0);
+INSERT INTO sales VALUES (361, 4276, 298.5);
+INSERT INTO sales VALUES (362, 4424, 305.0);
+INSERT INTO sales VALUES (363, 4572, 311.5);
+INSERT INTO sales VALUES (364, 4720, 318.0);
+INSERT INTO sales VALUES (365, 4868, 324.5);
+INSERT INTO sales VALUES (366, 5016, 331.0);
+INSERT INTO sales VALUES (367, 5164, 337.5);
+INSERT INTO sales VALUES (368, 5312, 344.0);
+INSERT INTO sales VALUES (369, 5460, 350.5);
+INSERT INTO sales VALUES (370, 5608, 357.0);
+INSERT INTO sales VALUES (371, 5756, 363.5);
+INSERT INTO sales VALUES (372, 5904, 370.0);
+INSERT INTO sales VALUES (373, 6052, 376.5);
+INSERT INTO sales VALUES (374, 6200, 383.0);
+INSERT INTO sales VALUES (375, 6348, 389.5);
+INSERT INTO sales VALUES (376, 6496, 396.0);
+INSERT INTO sales VALUES (377, 6644, 402.5);
+INSERT INTO sales VALUES (378, 6792, 409.0);
+INSERT INTO sales VALUES (379, 6940, 415.5);
+INSERT INTO sales VALUES (380, 7088, 422.0);
+INSERT INTO sales VALUES (381, 7236, 428.5);
+INSERT INTO sales VALUES (382, 7384, 435.0);
+INSERT INTO sales VALUES (383, 7532, 441.5);
+INSERT INTO sales VALUES (384, 7680, 448.0);
+INSERT INTO sales VALUES (385, 7828, 454.5);
+INSERT INTO sales VALUES (386, 7976, 461.0);
+INSERT INTO sales VALUES (387, 8124, 467.5);
+INSERT INTO sales VALUES (388, 80, 474.0);
+INSERT INTO sales VALUES (389, 228, 480.5);
+INSERT INTO sales VALUES (390, 376, 487.0);
+INSERT INTO sales VALUES (391, 524, 493.5);
+INSERT INTO sales VALUES (392, 672, 500.0);
+INSERT INTO sales VALUES (393, 820, 506.5);
+INSERT INTO sales VALUES (394, 968, 513.0);
+INSERT INTO sales VALUES (395, 1116, 519.5);
+INSERT INTO sales VALUES (396, 1264, 526.0);
+INSERT INTO sales VALUES (397, 1412, 532.5);
+INSERT INTO sales VALUES (398, 1560, 539.0);
+INSERT INTO sales VALUES (399, 1708, 545.5);
+INSERT INTO sales VALUES (400, 1856, 552.0);
+INSERT INTO sales VALUES (401, 2004, 558.5);
+INSERT INTO sales VALUES (402, 2152, 565.0);
+INSERT INTO sales VALUES (403, 2300, 571.5);
+INSERT INTO sales VALUES (404, 2448, 578.0);
+INSERT INTO sales VALUES (405, 2596, 584.5);
+INSERT INTO sales VALUES (406, 2744, 591.0);
+INSERT INTO sales VALUES (407, 2892, 597.5);
+INSERT INTO sales VALUES (408, 3040, 604.0);
+INSERT INTO sales VALUES (409, 3188, 610.5);
+INSERT INTO sales VALUES (410, 3336, 617.0);
+INSERT INTO sales VALUES (411, 3484, 623.5);
+INSERT INTO sales VALUES (412, 3632, 630.0);
+INSERT INTO sales VALUES (413, 3780, 636.5);
+INSERT INTO sales VALUES (414, 3928, 643.0);
+INSERT INTO sales VALUES (415, 4076, 649.5);
+INSERT INTO sales VALUES (416, 4224, 656.0);
+INSERT INTO sales VALUES (417, 4372, 662.5);
+INSERT INTO sales VALUES (418, 4520, 669.0);
+INSERT INTO sales VALUES (419, 4668, 675.5);
+INSERT INTO sales VALUES (420, 4816, 682.0);
+INSERT INTO sales VALUES (421, 4964, 688.5);
+INSERT INTO sales VALUES (422, 5112, 695.0);
+INSERT INTO sales VALUES (423, 5260, 701.5);
+INSERT INTO sales VALUES (424, 5408, 708.0);
+INSERT INTO sales VALUES (425, 5556, 714.5);
+INSERT INTO sales VALUES (426, 5704, 721.0);
+INSERT INTO sales VALUES (427, 5852, 727.5);
+INSERT INTO sales VALUES (428, 6000, 734.0);
+INSERT INTO sales VALUES (429, 6148, 740.5);
+INSERT INTO sales VALUES (430, 6296, 747.0);
+INSERT INTO sales VALUES (431, 6444, 753.5);
+INSERT INTO sales VALUES (432, 6592, 760.0);
+INSERT INTO sales VALUES (433, 6740, 766.5);
+INSERT INTO sales VALUES (434, 6888, 773.0);
+INSERT INTO sales VALUES (435, 7036, 779.5);
+INSERT INTO sales VALUES (436, 7184, 786.0);
+INSERT INTO sales VALUES (437, 7332, 792.5);
+INSERT INTO sales VALUES (438, 7480, 799.0);
+INSERT INTO sales VALUES (439, 7628, 805.5);
+INSERT INTO sales VALUES (440, 7776, 812.0);
+INSERT INTO sales VALUES (441, 7924, 818.5);
+INSERT INTO sales VALUES (442, 8072, 825.0);
+INSERT INTO sales VALUES (443, 28, 831.5);
+INSERT INTO sales VALUES (444, 176, 838.0);
+INSERT INTO sales VALUES (445, 324, 844.5);
+INSERT INTO sales VALUES (446, 472, 851.0);
+INSERT INTO sales VALUES (447, 620, 857.5);
+INSERT INTO sales VALUES (448, 768, 864.0);
+INSERT INTO sales VALUES (449, 916, 870.5);
+INSERT INTO sales VALUES (450, 1064, 877.0);
+INSERT INTO sales VALUES (451, 1212, 883.5);
+INSERT INTO sales VALUES (452, 1360, 890.0);
+INSERT INTO sales VALUES (453, 1508, 896.5);
+INSERT INTO sales VALUES (454, 1656, 903.0);
+INSERT INTO sales VALUES (455, 1804, 909.5);
+INSERT INTO sales VALUES (456, 1952, 916.0);
+INSERT INTO sales VALUES (457, 2100, 922.5);
+INSERT INTO sales VALUES (458, 2248, 929.0);
+INSERT INTO sales VALUES (459, 2396, 935.5);
+INSERT INTO sales VALUES (460, 2544, 942.0);
+INSERT INTO sales VALUES (461, 2692, 948.5);
+INSERT INTO sales VALUES (462, 2840, 955.0);
+INSERT INTO sales VALUES (463, 2988, 961.5);
+INSERT INTO sales VALUES (464, 3136, 968.0);
+INSERT INTO sales VALUES (465, 3284, 974.5);
+INSERT INTO sales VALUES (466, 3432, 981.0);
+INSERT INTO sales VALUES (467, 3580, 987.5);
+INSERT INTO sales VALUES (468, 3728, 994.0);
+INSERT INTO sales VALUES (469, 3876, 1000.5);
+INSERT INTO sales VALUES (470, 4024, 1007.0);
+INSERT INTO sales VALUES (471, 4172, 1013.5);
+INSERT INTO sales VALUES (472, 4320, 1020.0);
+INSERT INTO sales VALUES (473, 4468, 2.5);
+INSERT INTO sales VALUES (474, 4616, 9.0);
+INSERT INTO sales VALUES (475, 4764, 15.5);
+INSERT INTO sales VALUES (476, 4912, 22.0);
+INSERT INTO sales VALUES (477, 5060, 28.5);
+INSERT INTO sales VALUES (478, 5208, 35.0);
+INSERT INTO sales VALUES (479, 5356, 41.5);
+INSERT INTO sales VALUES (480, 5504, 48.0);
+INSERT INTO sales VALUES (481, 5652, 54.5);
+INSERT INTO sales VALUES (482, 5800, 61.0);
+INSERT INTO sales VALUES (483, 5948, 67.5);
+INSERT INTO sales VALUES (484, 6096, 74.0);
+INSERT INTO sales VALUES (485, 6244, 80.5);
+INSERT INTO sales VALUES (486, 6392, 87.0);
+INSERT INTO sales VALUES (487, 6540, 93.5);
+INSERT INTO sales VALUES (488, 6688, 100.0);
+INSERT INTO sales VALUES (489, 6836, 106.5);
+INSERT INTO sales VALUES (490, 6984, 113.0);
+INSERT INTO sales VALUES (491, 7132, 119.5);
+INSERT INTO sales VALUES (492, 7280, 126.0);
+INSERT INTO sales VALUES (493, 7428, 132.5);
+INSERT INTO sales VALUES (494, 7576, 139.0);
+INSERT INTO sales VALUES (495, 7724, 145.5);
+INSERT INTO sales VALUES (496, 7872, 152.0);
+INSERT INTO sales VALUES (497, 8020, 158.5);
+INSERT INTO sales VALUES (498, 8168, 165.0);
+INSERT INTO sales VALUES (499, 124, 171.5);
+INSERT INTO sales VALUES (500, 272, 178.0);
+INSERT INTO sales VALUES (501, 420, 184.5);
+INSERT INTO sales VALUES (502, 568, 191.0);
+INSERT INTO sales VALUES (503, 716, 197.5);
+INSERT INTO sales VALUES (504, 864, 204.0);
+INSERT INTO sales VALUES (505, 1012, 210.5);
+INSERT INTO sales VALUES (506, 1160, 217.0);
+INSERT INTO sales VALUES (507, 1308, 223.5);
+INSERT INTO sales VALUES (508, 1456, 230.0);
+INSERT INTO sales VALUES (509, 1604, 236.5);
+INSERT INTO sales VALUES (510, 1752, 243.0);
+INSERT INTO sales VALUES (511, 1900, 249.5);
+INSERT INTO sales VALUES (512, 2048, 256.0);
+INSERT INTO sales VALUES (513, 2196, 262.5);
+INSERT INTO sales VALUES (514, 2344, 269.0);
+INSERT INTO sales VALUES (515, 2492, 275.5);
+INSERT INTO sales VALUES (516, 2640, 282.0);
+INSERT INTO sales VALUES (517, 2788, 288.5);
+INSERT INTO sales VALUES (518, 2936, 295.0);
+INSERT INTO sales VALUES (519, 3084, 301.5);
+INSERT INTO sales VALUES (520, 3232, 308.0);
+INSERT INTO sales VALUES (521, 3380, 314.5);
+INSERT INTO sales VALUES (522, 3528, 321.0);
+INSERT INTO sales VALUES (523, 3676, 327.5);
+INSERT INTO sales VALUES (524, 3824, 334.0);
+INSERT INTO sales VALUES (525, 3972, 340.5);
+INSERT INTO sales VALUES (526, 4120, 347.0);
+INSERT INTO sales VALUES (527, 4268, 353.5);
+INSERT INTO sales VALUES (528, 4416, 360.0);
+INSERT INTO sales VALUES (529, 4564, 366.5);
+INSERT INTO sales VALUES (530, 4712, 373.0);
+INSERT INTO sales VALUES (531, 4860, 379.5);
+INSERT INTO sales VALUES (532, 5008, 386.0);
+INSERT INTO sales VALUES (533, 5156, 392.5);
+INSERT INTO sales VALUES (534, 5304, 399.0);
+INSERT INTO sales VALUES (535, 5452, 405.5);
+INSERT INTO sales VALUES (536, 5600, 412.0);
+INSERT INTO sales VALUES (537, 5748, 418.5);
+INSERT INTO sales VALUES (538, 5896, 425.0);
+INSERT INTO sales VALUES (539, 6044, 431.5);
+INSERT INTO sales VALUES (540, 6192, 438.0);
+INSERT INTO sales VALUES (541, 6340, 444.5);
+INSERT INTO sales VALUES (542, 6488, 451.0);
+INSERT INTO sales VALUES (543, 6636, 457.5);
+INSERT INTO sales VALUES (544, 6784, 464.0);
+INSERT INTO sales VALUES (545, 6932, 470.5);
+INSERT INTO sales VALUES (546, 7080, 477.0);
+INSERT INTO sales VALUES (547, 7228, 483.5);
+INSERT INTO sales VALUES (548, 7376, 490.0);
+INSERT INTO sales VALUES (549, 7524, 496.5);
+INSERT INTO sales VALUES (550, 7672, 503.0);
+INSERT INTO sales VALUES (551, 7820, 509.5);
+INSERT INTO sales VALUES (552, 7968, 516.0);
+INSERT INTO sales VALUES (553, 8116, 522.5);
+INSERT INTO sales VALUES (554, 72, 529.0);
+INSERT INTO sales VALUES (555, 220, 535.5);
+INSERT INTO sales VALUES (556, 368, 542.0);
+INSERT INTO sales VALUES (557, 516, 548.5);
+INSERT INTO sales VALUES (558, 664, 555.0);
+INSERT INTO sales VALUES (559, 812, 561.5);
+INSERT INTO sales VALUES (560, 960, 568.0);
+INSERT INTO sales VALUES (561, 1108, 574.5);
+INSERT INTO sales VALUES (562, 1256, 581.0);
+INSERT INTO sales VALUES (563, 1404, 587.5);
+INSERT INTO sales VALUES (564, 1552, 594.0);
+INSERT INTO sales VALUES (565, 1700, 600.5);
+INSERT INTO sales VALUES (566, 1848, 607.0);
+INSERT INTO sales VALUES (567, 1996, 613.5);
+INSERT INTO sales VALUES (568, 2144, 620.0);
+INSERT INTO sales VALUES (569, 2292, 626.5);
+INSERT INTO sales VALUES (570, 2440, 633.0);
+INSERT INTO sales VALUES (571, 2588, 639.5);
+INSERT INTO sales VALUES (572, 2736, 646.0);
+INSERT INTO sales VALUES (573, 2884, 652.5);
+INSERT INTO sales VALUES (574, 3032, 659.0);
+INSERT INTO sales VALUES (575, 3180, 665.5);
+INSERT INTO sales VALUES (576, 3328, 672.0);
+INSERT INTO sales VALUES (577, 3476, 678.5);
+INSERT INTO sales VALUES (578, 3624, 685.0);
+INSERT INTO sales VALUES (579, 3772, 691.5);
+INSERT INTO sales VALUES (580, 3920, 698.0);
+INSERT INTO sales VALUES (581, 4068, 704.5);
+INSERT INTO sales VALUES (582, 4216, 711.0);
+INSERT INTO sales VALUES (583, 4364, 717.5);
+INSERT INTO sales VALUES (584, 4512, 724.0);
+INSERT INTO sales VALUES (585, 4660, 730.5);
+INSERT INTO sales VALUES (586, 4808, 737.0);
+INSERT INTO sales VALUES (587, 4956, 743.5);
+INSERT INTO sales VALUES (588, 5104, 750.0);
+INSERT INTO sales VALUES (589, 5252, 756.5);
+INSERT INTO sales VALUES (590, 5400, 763.0);
+INSERT INTO sales VALUES (591, 5548, 769.5);
+INSERT INTO sales VALUES (592, 5696, 776.0);
+INSERT INTO sales VALUES (593, 5844, 782.5);
+INSERT INTO sales VALUES (594, 5992, 789.0);
+INSERT INTO sales VALUES (595, 6140, 795.5);
+INSERT INTO sales VALUES (596, 6288, 802.0);
+INSERT INTO sales VALUES (597, 6436, 808.5);
+INSERT INTO sales VALUES (598, 6584, 815.0);
+INSERT INTO sales VALUES (599, 6732, 821.5);
+INSERT INTO sales VALUES (600, 6880, 828.0);
+INSERT INTO sales VALUES (601, 7028, 834.5);
+INSERT INTO sales VALUES (602, 7176, 841.0);
+INSERT INTO sales VALUES (603, 7324, 847.5);
+INSERT INTO sales VALUES (604, 7472, 854.0);
+INSERT INTO sales VALUES (605, 7620, 860.5);
+INSERT INTO sales VALUES (606, 7768, 867.0);
+INSERT INTO sales VALUES (607, 7916, 873.5);
+INSERT INTO sales VALUES (608, 8064, 880.0);
+INSERT INTO sales VALUES (609, 20, 886.5);
+INSERT INTO sales VALUES (610, 168, 893.0);
+INSERT INTO sales VALUES (611, 316, 899.5);
+INSERT INTO sales VALUES (612, 464, 906.0);
+INSERT INTO sales VALUES (613, 612, 912.5);
+INSERT INTO sales VALUES (614, 760, 919.0);
+INSERT INTO sales VALUES (615, 908, 925.5);
+INSERT INTO sales VALUES (616, 1056, 932.0);
+INSERT INTO sales VALUES (617, 1204, 938.5);
+INSERT INTO sales VALUES (618, 1352, 945.0);
+INSERT INTO sales VALUES (619, 1500, 951.5);
+INSERT INTO sales VALUES (620, 1648, 958.0);
+INSERT INTO sales VALUES (621, 1796, 964.5);
+INSERT INTO sales VALUES (622, 1944, 971.0);
+INSERT INTO sales VALUES (623, 2092, 977.5);
+INSERT INTO sales VALUES (624, 2240, 984.0);
+INSERT INTO sales VALUES (625, 2388, 990.5);
+INSERT INTO sales VALUES (626, 2536, 997.0);
+INSERT INTO sales VALUES (627, 2684, 1003.5);
+INSERT INTO sales VALUES (628, 2832, 1010.0);
+INSERT INTO sales VALUES (629, 2980, 1016.5);
+INSERT INTO sales VALUES (630, 3128, 1023.0);
+INSERT INTO sales VALUES (631, 3276, 5.5);
+INSERT INTO sales VALUES (632, 3424, 12.0);
+INSERT INTO sales VALUES (633, 3572, 18.5);
+INSERT INTO sales VALUES (634, 3720, 25.0);
+INSERT INTO sales VALUES (635, 3868, 31.5);
+INSERT INTO sales VALUES (636, 4016, 38.0);
+INSERT INTO sales VALUES (637, 4164, 44.5);
+INSERT INTO sales VALUES (638, 4312, 51.0);
+INSERT INTO sales VALUES (639, 4460, 57.5);
+INSERT INTO sales VALUES (640, 4608, 64.0);
+INSERT INTO sales VALUES (641, 4756, 70.5);
+INSERT INTO sales VALUES (642, 4904, 77.0);
+INSERT INTO sales VALUES (643, 5052, 83.5);
+INSERT INTO sales VALUES (644, 5200, 90.0);
+INSERT INTO sales VALUES (645, 5348, 96.5);
+INSERT INTO sales VALUES (646, 5496, 103.0);
+INSERT INTO sales VALUES (647, 5644, 109.5);
+INSERT INTO sales VALUES (648, 5792, 116.0);
+INSERT INTO sales VALUES (649, 5940, 122.5);
+INSERT INTO sales VALUES (650, 6088, 129.0);
+INSERT INTO sales VALUES (651, 6236, 135.5);
+INSERT INTO sales VALUES (652, 6384, 142.0);
+INSERT INTO sales VALUES (653, 6532, 148.5);
+INSERT INTO sales VALUES (654, 6680, 155.0);
+INSERT INTO sales VALUES (655, 6828, 161.5);
+INSERT INTO sales VALUES (656, 6976, 168.0);
+INSERT INTO sales VALUES (657, 7124, 174.5);
+INSERT INTO sales VALUES (658, 7272, 181.0);
+INSERT INTO sales VALUES (659, 7420, 187.5);
+INSERT INTO sales VALUES (660, 7568, 194.0);
+INSERT INTO sales VALUES (661, 7716, 200.5);
+INSERT INTO sales VALUES (662, 7864, 207.0);
+INSERT INTO sales VALUES (663, 8012, 213.5);
+INSERT INTO sales VALUES (664, 8160, 220.0);
+INSERT INTO sales VALUES (665, 116, 226.5);
+INSERT INTO sales VALUES (666, 264, 233.0);
+INSERT INTO sales VALUES (667, 412, 239.5);
+INSERT INTO sales VALUES (668, 560, 246.0);
+INSERT INTO sales VALUES (669, 708, 252.5);
+INSERT INTO sales VALUES (670, 856, 259.0);
+INSERT INTO sales VALUES (671, 1004, 265.5);
+INSERT INTO sales VALUES (672, 1152, 272.0);
+INSERT INTO sales VALUES (673, 1300, 278.5);
+INSERT INTO sales VALUES (674, 1448, 285.0);
+INSERT INTO sales VALUES (675, 1596, 291.5);
+INSERT INTO sales VALUES (676, 1744, 298.0);
+INSERT INTO sales VALUES (677, 1892, 304.5);
+INSERT INTO sales VALUES (678, 2040, 311.0);
+INSERT INTO sales VALUES (679, 2188, 317.5);
+INSERT INTO sales VALUES (680, 2336, 324.0);
+INSERT INTO sales VALUES (681, 2484, 330.5);
+INSERT INTO sales VALUES (682, 2632, 337.0);
+INSERT INTO sales VALUES (683, 2780, 343.5);
+INSERT INTO sales VALUES (684, 2928, 350.0);
+INSERT INTO sales VALUES (685, 3076, 356.5);
+INSERT INTO sales VALUES (686, 3224, 363.0);
+INSERT INTO sales VALUES (687, 3372, 369.5);
+INSERT INTO sales VALUES (688, 3520, 376.0);
+INSERT INTO sales VALUES (689, 3668, 382.5);
+INSERT INTO sales VALUES (690, 3816, 389.0);
+INSERT INTO sales VALUES (691, 3964, 395.5);
+INSERT INTO sales VALUES (692, 4112, 402.0);
+INSERT INTO sales VALUES (693, 4260, 408.5);
+INSERT INTO sales VALUES (694, 4408, 415.0);
+INSERT INTO sales VALUES (695, 4556, 421.5);
+INSERT INTO sales VALUES (696, 4704, 428.0);
+INSERT INTO sales VALUES (697, 4852, 434.5);
+INSERT INTO sales VALUES (698, 5000, 441.0);
+INSERT INTO sales VALUES (699, 5148, 447.5);
+INSERT INTO sales VALUES (700, 5296, 454.0);
+INSERT INTO sales VALUES (701, 5444, 460.5);
+INSERT INTO sales VALUES (702, 5592, 467.0);
+INSERT INTO sales VALUES (703, 5740, 473.5);
+INSERT INTO sales VALUES (704, 5888, 480.0);
+INSERT INTO sales VALUES (705, 6036, 486.5);
+INSERT INTO sales VALUES (706, 6184, 493.0);
+INSERT INTO sales VALUES (707, 6332, 499.5);
+INSERT INTO sales VALUES (708, 6480, 506.0);
+INSERT INTO sales VALUES (709, 6628, 512.5);
+INSERT INTO sales VALUES (710, 6776, 519.0);
+INSERT INTO sales VALUES (711, 6924, 525.5);
+INSERT INTO sales VALUES (712, 7072, 532.0);
+INSERT INTO sales VALUES (713, 7220, 538.5);
+INSERT INTO sales VALUES (714, 7368, 545.0);
+INSERT INTO sales VALUES (715, 7516, 551.5);
+INSERT INTO sales VALUES (716, 7664, 558.0);
+INSERT INTO sales VALUES (717, 7812, 564.5);
+INSERT INTO sales VALUES (718, 7960, 571.0);
+INSERT INTO sales VALUES (719, 8108, 577.5);
+INSERT INTO sales VALUES (720, 64, 584.0);
+INSERT INTO sales VALUES (721, 212, 590.5);
+INSERT INTO sales VALUES (722, 360, 597.0);
+INSERT INTO sales VALUES (723, 508, 603.5);
+INSERT INTO sales VALUES (724, 656, 610.0);
+INSERT INTO sales VALUES (725, 804, 616.5);
+INSERT INTO sales VALUES (726, 952, 623.0);
+INSERT INTO sales VALUES (727, 1100, 629.5);
+INSERT INTO sales VALUES (728, 1248, 636.0);
+INSERT INTO sales VALUES (729, 1396, 642.5);
+INSERT INTO sales VALUES (730, 1544, 649.0);
+INSERT INTO sales VALUES (731, 1692, 655.5);
+INSERT INTO sales VALUES (732, 1840, 662.0);
+INSERT INTO sales VALUES (733, 1988, 668.5);
+INSERT INTO sales VALUES (734, 2136, 675.0);
+INSERT INTO sales VALUES (735, 2284, 681.5);
+INSERT INTO sales VALUES (736, 2432, 688.0);
+INSERT INTO sales VALUES (737, 2580, 694.5);
+INSERT INTO sales VALUES (738, 2728, 701.0);
+INSERT INTO sales VALUES (739, 2876, 707.5);
+INSERT INTO sales VALUES (740, 3024, 714.0);
+INSERT INTO sales VALUES (741, 3172, 720.5);
+INSERT INTO sales VALUES (742, 3320, 727.0);
+INSERT INTO sales VALUES (743, 3468, 733.5);
+INSERT INTO sales VALUES (744, 3616, 740.0);
+INSERT INTO sales VALUES (745, 3764, 746.5);
+INSERT INTO sales VALUES (746, 3912, 753.0);
+INSERT INTO sales VALUES (747, 4060, 759.5);
+INSERT INTO sales VALUES (748, 4208, 766.0);
+INSERT INTO sales VALUES (749, 4356, 772.5);
+INSERT INTO sales VALUES (750, 4504, 779.0);
+INSERT INTO sales VALUES (751, 4652, 785.5);
+INSERT INTO sales VALUES (752, 4800, 792.0);
+INSERT INTO sales VALUES (753, 4948, 798.5);
+INSERT INTO sales VALUES (754, 5096, 805.0);
+INSERT INTO sales VALUES (755, 5244, 811.5);
+INSERT INTO sales VALUES (756, 5392, 818.0);
+INSERT INTO sales VALUES (757, 5540, 824.5);
+INSERT INTO sales VALUES (758, 5688, 831.0);
+INSERT INTO sales VALUES (759, 5836, 837.5);
+INSERT INTO sales VALUES (760, 5984, 844.0);
+INSERT INTO sales VALUES (761, 6132, 850.5);
+INSERT INTO sales VALUES (762, 6280, 857.0);
+INSERT INTO sales VALUES (763, 6428, 863.5);
+INSERT INTO sales VALUES (764, 6576, 870.0);
+INSERT INTO sales VALUES (765, 6724, 876.5);
+INSERT INTO sales VALUES (766, 6872, 883.0);
+INSERT INTO sales VALUES (767, 7020, 889.5);
+INSERT INTO sales VALUES (768, 7168, 896.0);
+INSERT INTO sales VALUES (769, 7316, 902.5);
+INSERT INTO sales VALUES (770, 7464, 909.0);
+INSERT INTO sales VALUES (771, 7612, 915.5);
+INSERT INTO sales VALUES (772, 7760, 922.0);
+INSERT INTO sales VALUES (773, 7908, 928.5);
+INSERT INTO sales VALUES (774, 8056, 935.0);
+INSERT INTO sales VALUES (775, 12, 941.5);
+INSERT INTO sales VALUES (776, 160, 948.0);
+INSERT INTO sales VALUES (777, 308, 954.5);
+INSERT INTO sales VALUES (778, 456, 961.0);
+INSERT INTO sales VALUES (779, 604, 967.5);
+INSERT INTO sales VALUES (780, 752, 974.0);
+INSERT INTO sales VALUES (781, 900, 980.5);
+INSERT INTO sales VALUES (782, 1048, 987.0);
+INSERT INTO sales VALUES (783, 1196, 993.5);
+INSERT INTO sales VALUES (784, 1344, 1000.0);
+INSERT INTO sales VALUES (785, 1492, 1006.5);
+INSERT INTO sales VALUES (786, 1640, 1013.0);
+INSERT INTO sales VALUES (787, 1788, 1019.5);
+INSERT INTO sales VALUES (788, 1936, 2.0);
+INSERT INTO sales VALUES (789, 2084, 8.5);
+INSERT INTO sales VALUES (790, 2232, 15.0);
+INSERT INTO sales VALUES (791, 2380, 21.5);
+INSERT INTO sales VALUES (792, 2528, 28.0);
+INSERT INTO sales VALUES (793, 2676, 34.5);
+INSERT INTO sales VALUES (794, 2824, 41.0);
+INSERT INTO sales VALUES (795, 2972, 47.5);
+INSERT INTO sales VALUES (796, 3120, 54.0);
+INSERT INTO sales VALUES (797, 3268, 60.5);
+INSERT INTO sales VALUES (798, 3416, 67.0);
+INSERT INTO sales VALUES (799, 3564, 73.5);
+INSERT INTO sales VALUES (800, 3712, 80.0);
+INSERT INTO sales VALUES (801, 3860, 86.5);
+INSERT INTO sales VALUES (802, 4008, 93.0);
+INSERT INTO sales VALUES (803, 4156, 99.5);
+INSERT INTO sales VALUES (804, 4304, 106.0);
+INSERT INTO sales VALUES (805, 4452, 112.5);
+INSERT INTO sales VALUES (806, 4600, 119.0);
+INSERT INTO sales VALUES (807, 4748, 125.5);
+INSERT INTO sales VALUES (808, 4896, 132.0);
+INSERT INTO sales VALUES (809, 5044, 138.5);
+INSERT INTO sales VALUES (810, 5192, 145.0);
+INSERT INTO sales VALUES (811, 5340, 151.5);
+INSERT INTO sales VALUES (812, 5488, 158.0);
+INSERT INTO sales VALUES (813, 5636, 164.5);
+INSERT INTO sales VALUES (814, 5784, 171.0);
+INSERT INTO sales VALUES (815, 5932, 177.5);
+INSERT INTO sales VALUES (816, 6080, 184.0);
+INSERT INTO sales VALUES (817, 6228, 190.5);
+INSERT INTO sales VALUES (818, 6376, 197.0);
+INSERT INTO sales VALUES (819, 6524, 203.5);
+INSERT INTO sales VALUES (820, 6672, 210.0);
+INSERT INTO sales VALUES (821, 6820, 216.5);
+INSERT INTO sales VALUES (822, 6968, 223.0);
+INSERT INTO sales VALUES (823, 7116, 229.5);
+INSERT INTO sales VALUES (824, 7264, 236.0);
+INSERT INTO sales VALUES (825, 7412, 242.5);
+INSERT INTO sales VALUES (826, 7560, 249.0);
+INSERT INTO sales VALUES (827, 7708, 255.5);
+INSERT INTO sales VALUES (828, 7856, 262.0);
+INSERT INTO sales VALUES (829, 8004, 268.5);
+INSERT INTO sales VALUES (830, 8152, 275.0);
+INSERT INTO sales VALUES (831, 108, 281.5);
+INSERT INTO sales VALUES (832, 256, 288.0);
+INSERT INTO sales VALUES (833, 404, 294.5);
+INSERT INTO sales VALUES (834, 552, 301.0);
+INSERT INTO sales VALUES (835, 700, 307.5);
+INSERT INTO sales VALUES (836, 848, 314.0);
+INSERT INTO sales VALUES (837, 996, 320.5);
+INSERT INTO sales VALUES (838, 1144, 327.0);
+INSERT INTO sales VALUES (839, 1292, 333.5);
+INSERT INTO sales VALUES (840, 1440, 340.0);
+INSERT INTO sales VALUES (841, 1588, 346.5);
+INSERT INTO sales VALUES (842, 1736, 353.0);
+INSERT INTO sales VALUES (843, 1884, 359.5);
+INSERT INTO sales VALUES (844, 2032, 366.0);
+INSERT INTO sales VALUES (845, 2180, 372.5);
+INSERT INTO sales VALUES (846, 2328, 379.0);
+INSERT INTO sales VALUES (847, 2476, 385.5);
+INSERT INTO sales VALUES (848, 2624, 392.0);
+INSERT INTO sales VALUES (849, 2772, 398.5);
+INSERT INTO sales VALUES (850, 2920, 405.0);
+INSERT INTO sales VALUES (851, 3068, 411.5);
+INSERT INTO sales VALUES (852, 3216, 418.0);
+INSERT INTO sales VALUES (853, 3364, 424.5);
+INSERT INTO sales VALUES (854, 3512, 431.0);
+INSERT INTO sales VALUES (855, 3660, 437.5);
+INSERT INTO sales VALUES (856, 3808, 444.0);
+INSERT INTO sales VALUES (857, 3956, 450.5);
+INSERT INTO sales VALUES (858, 4104, 457.0);
+INSERT INTO sales VALUES (859, 4252, 463.5);
+INSERT INTO sales VALUES (860, 4400, 470.0);
+INSERT INTO sales VALUES (861, 4548, 476.5);
+INSERT INTO sales VALUES (862, 4696, 483.0);
+INSERT INTO sales VALUES (863, 4844, 489.5);
+INSERT INTO sales VALUES (864, 4992, 496.0);
+INSERT INTO sales VALUES (865, 5140, 502.5);
+INSERT INTO sales VALUES (866, 5288, 509.0);
+INSERT INTO sales VALUES (867, 5436, 515.5);
+INSERT INTO sales VALUES (868, 5584, 522.0);
+INSERT INTO sales VALUES (869, 5732, 528.5);
+INSERT INTO sales VALUES (870, 5880, 535.0);
+INSERT INTO sales VALUES (871, 6028, 541.5);
+INSERT INTO sales VALUES (872, 6176, 548.0);
+INSERT INTO sales VALUES (873, 6324, 554.5);
+INSERT INTO sales VALUES (874, 6472, 561.0);
+INSERT INTO sales VALUES (875, 6620, 567.5);
+INSERT INTO sales VALUES (876, 6768, 574.0);
+INSERT INTO sales VALUES (877, 6916, 580.5);
+INSERT INTO sales VALUES (878, 7064, 587.0);
+INSERT INTO sales VALUES (879, 7212, 593.5);
+INSERT INTO sales VALUES (880, 7360, 600.0);
+INSERT INTO sales VALUES (881, 7508, 606.5);
+INSERT INTO sales VALUES (882, 7656, 613.0);
+INSERT INTO sales VALUES (883, 7804, 619.5);
+INSERT INTO sales VALUES (884, 7952, 626.0);
+INSERT INTO sales VALUES (885, 8100, 632.5);
+INSERT INTO sales VALUES (886, 56, 639.0);
+INSERT INTO sales VALUES (887, 204, 645.5);
+INSERT INTO sales VALUES (888, 352, 652.0);
+INSERT INTO sales VALUES (889, 500, 658.5);
+INSERT INTO sales VALUES (890, 648, 665.0);
+INSERT INTO sales VALUES (891, 796, 671.5);
+INSERT INTO sales VALUES (892, 944, 678.0);
+INSERT INTO sales VALUES (893, 1092, 684.5);
+INSERT INTO sales VALUES (894, 1240, 691.0);
+INSERT INTO sales VALUES (895, 1388, 697.5);
+INSERT INTO sales VALUES (896, 1536, 704.0);
+INSERT INTO sales VALUES (897, 1684, 710.5);
+INSERT INTO sales VALUES (898, 1832, 717.0);
+INSERT INTO sales VALUES (899, 1980, 723.5);
+INSERT INTO sales VALUES (900, 2128, 730.0);
+INSERT INTO sales VALUES (901, 2276, 736.5);
+INSERT INTO sales VALUES (902, 2424, 743.0);
+INSERT INTO sales VALUES (903, 2572, 749.5);
+INSERT INTO sales VALUES (904, 2720, 756.0);
+INSERT INTO sales VALUES (905, 2868, 762.5);
+INSERT INTO sales VALUES (906, 3016, 769.0);
+INSERT INTO sales VALUES (907, 3164, 775.5);
+INSERT INTO sales VALUES (908, 3312, 782.0);
+INSERT INTO sales VALUES (909, 3460, 788.5);
+INSERT INTO sales VALUES (910, 3608, 795.0);
+INSERT INTO sales VALUES (911, 3756, 801.5);
+INSERT INTO sales VALUES (912, 3904, 808.0);
+INSERT INTO sales VALUES (913, 4052, 814.5);
+INSERT INTO sales VALUES (914, 4200, 821.0);
+INSERT INTO sales VALUES (915, 4348, 827.5);
+INSERT INTO sales VALUES (916, 4496, 834.0);
+INSERT INTO sales VALUES (917, 4644, 840.5);
+INSERT INTO sales VALUES (918, 4792, 847.0);
+INSERT INTO sales VALUES (919, 4940, 853.5);
+INSERT INTO sales VALUES (920, 5088, 860.0);
+INSERT INTO sales VALUES (921, 5236, 866.5);
+INSERT INTO sales VALUES (922, 5384, 873.0);
+INSERT INTO sales VALUES (923, 5532, 879.5);
+INSERT INTO sales VALUES (924, 5680, 886.0);
+INSERT INTO sales VALUES (925, 5828, 892.5);
+INSERT INTO sales VALUES (926, 5976, 899.0);
+INSERT INTO sales VALUES (927, 6124, 905.5);
+INSERT INTO sales VALUES (928, 6272, 912.0);
+INSERT INTO sales VALUES (929, 6420, 918.5);
+INSERT INTO sales VALUES (930, 6568, 925.0);
+INSERT INTO sales VALUES (931, 6716, 931.5);
+INSERT INTO sales VALUES (932, 6864, 938.0);
+INSERT INTO sales VALUES (933, 7012, 944.5);
+INSERT INTO sales VALUES (934, 7160, 951.0);
+INSERT INTO sales VALUES (935, 7308, 957.5);
+INSERT INTO sales VALUES (936, 7456, 964.0);
+INSERT INTO sales VALUES (937, 7604, 970.5);
+INSERT INTO sales VALUES (938, 7752, 977.0);
+INSERT INTO sales VALUES (939, 7900, 983.5);
+INSERT INTO sales VALUES (940, 8048, 990.0);
+INSERT INTO sales VALUES (941, 4, 996.5);
+INSERT INTO sales VALUES (942, 152, 1003.0);
+INSERT INTO sales VALUES (943, 300, 1009.5);
+INSERT INTO sales VALUES (944, 448, 1016.0);
+INSERT INTO sales VALUES (945, 596, 1022.5);
+INSERT INTO sales VALUES (946, 744, 5.0);
+INSERT INTO sales VALUES (947, 892, 11.5);
+INSERT INTO sales VALUES (948, 1040, 18.0);
+INSERT INTO sales VALUES (949, 1188, 24.5);
+INSERT INTO sales VALUES (950, 1336, 31.0);
+INSERT INTO sales VALUES (951, 1484, 37.5);
+INSERT INTO sales VALUES (952, 1632, 44.0);
+INSERT INTO sales VALUES (953, 1780, 50.5);
+INSERT INTO sales VALUES (954, 1928, 57.0);
+INSERT INTO sales VALUES (955, 2076, 63.5);
+INSERT INTO sales VALUES (956, 2224, 70.0);
+INSERT INTO sales VALUES (957, 2372, 76.5);
+INSERT INTO sales VALUES (958, 2520, 83.0);
+INSERT INTO sales VALUES (959, 2668, 89.5);
+INSERT INTO sales VALUES (960, 2816, 96.0);
+INSERT INTO sales VALUES (961, 2964, 102.5);
+INSERT INTO sales VALUES (962, 3112, 109.0);
+INSERT INTO sales VALUES (963, 3260, 115.5);
+INSERT INTO sales VALUES (964, 3408, 122.0);
+INSERT INTO sales VALUES (965, 3556, 128.5);
+INSERT INTO sales VALUES (966, 3704, 135.0);
+INSERT INTO sales VALUES (967, 3852, 141.5);
+INSERT INTO sales VALUES (968, 4000, 148.0);
+INSERT INTO sales VALUES (969, 4148, 154.5);
+INSERT INTO sales VALUES (970, 4296, 161.0);
+INSERT INTO sales VALUES (971, 4444, 167.5);
+INSERT INTO sales VALUES (972, 4592, 174.0);
+INSERT INTO sales VALUES (973, 4740, 180.5);
+INSERT INTO sales VALUES (974, 4888, 187.0);
+INSERT INTO sales VALUES (975, 5036, 193.5);
+INSERT INTO sales VALUES (976, 5184, 200.0);
+INSERT INTO sales VALUES (977, 5332, 206.5);
+INSERT INTO sales VALUES (978, 5480, 213.0);
+INSERT INTO sales VALUES (979, 5628, 219.5);
+INSERT INTO sales VALUES (980, 5776, 226.0);
+INSERT INTO sales VALUES (981, 5924, 232.5);
+INSERT INTO sales VALUES (982, 6072, 239.0);
+INSERT INTO sales VALUES (983, 6220, 245.5);
+INSERT INTO sales VALUES (984, 6368, 252.0);
+INSERT INTO sales VALUES (985, 6516, 258.5);
+INSERT INTO sales VALUES (986, 6664, 265.0);
+INSERT INTO sales VALUES (987, 6812, 271.5);
+INSERT INTO sales VALUES (988, 6960, 278.0);
+INSERT INTO sales VALUES (989, 7108, 284.5);
+INSERT INTO sales VALUES (990, 7256, 291.0);
+INSERT INTO sales VALUES (991, 7404, 297.5);
+INSERT INTO sales VALUES (992, 7552, 304.0);
+INSERT INTO sales VALUES (993, 7700, 310.5);
+INSERT INTO sales VALUES (994, 7848, 317.0);
+INSERT INTO sales VALUES (995, 7996, 323.5);
+INSERT INTO sales VALUES (996, 8144, 330.0);
+INSERT INTO sales VALUES (997, 100, 336.5);
+INSERT INTO sales VALUES (998, 248, 343.0);
+INSERT INTO sales VALUES (999, 396, 349.5);
+INSERT INTO sales VALUES (1000, 544, 356.0);
+INSERT INTO sales VALUES (1001, 692, 362.5);
+INSERT INTO sales VALUES (1002, 840, 369.0);
+INSERT INTO sales VALUES (1003, 988, 375.5);
+INSERT INTO sales VALUES (1004, 1136, 382.0);
+INSERT INTO sales VALUES (1005, 1284, 388.5);
+INSERT INTO sales VALUES (1006, 1432, 395.0);
+INSERT INTO sales VALUES (1007, 1580, 401.5);
+INSERT INTO sales VALUES (1008, 1728, 408.0);
+INSERT INTO sales VALUES (1009, 1876, 414.5);
+INSERT INTO sales VALUES (1010, 2024, 421.0);
+INSERT INTO sales VALUES (1011, 2172, 427.5);
+INSERT INTO sales VALUES (1012, 2320, 434.0);
+INSERT INTO sales VALUES (1013, 2468, 440.5);
+INSERT INTO sales VALUES (1014, 2616, 447.0);
+INSERT INTO sales VALUES (1015, 2764, 453.5);
+INSERT INTO sales VALUES (1016, 2912, 460.0);
+INSERT INTO sales VALUES (1017, 3060, 466.5);
+INSERT INTO sales VALUES (1018, 3208, 473.0);
+INSERT INTO sales VALUES (1019, 3356, 479.5);
+INSERT INTO sales VALUES (1020, 3504, 486.0);
+INSERT INTO sales VALUES (1021, 3652, 492.5);
+INSERT INTO sales VALUES (1022, 3800, 499.0);
+INSERT INTO sales VALUES (1023, 3948, 505.5);
+INSERT INTO sales VALUES (1024, 4096, 512.0);
+INSERT INTO sales VALUES (1025, 4244, 518.5);
+INSERT INTO sales VALUES (1026, 4392, 525.0);
+INSERT INTO sales VALUES (1027, 4540, 531.5);
+INSERT INTO sales VALUES (1028, 4688, 538.0);
+INSERT INTO sales VALUES (1029, 4836, 544.5);
+INSERT INTO sales VALUES (1030, 4984, 551.0);
+INSERT INTO sales VALUES (1031, 5132, 557.5);
+INSERT INTO sales VALUES (1032, 5280, 564.0);
+INSERT INTO sales VALUES (1033, 5428, 570.5);
+INSERT INTO sales VALUES (1034, 5576, 577.0);
+INSERT INTO sales VALUES (1035, 5724, 583.5);
+INSERT INTO sales VALUES (1036, 5872, 590.0);
+INSERT INTO sales VALUES (1037, 6020, 596.5);
+INSERT INTO sales VALUES (1038, 6168, 603.0);
+INSERT INTO sales VALUES (1039, 6316, 609.5);
+INSERT INTO sales VALUES (1040, 6464, 616.0);
+INSERT INTO sales VALUES (1041, 6612, 622.5);
+INSERT INTO sales VALUES (1042, 6760, 629.0);
+INSERT INTO sales VALUES (1043, 6908, 635.5);
+INSERT INTO sales VALUES (1044, 7056, 642.0);
+INSERT INTO sales VALUES (1045, 7204, 648.5);
+INSERT INTO sales VALUES (1046, 7352, 655.0);
+INSERT INTO sales VALUES (1047, 7500, 661.5);
+INSERT INTO sales VALUES (1048, 7648, 668.0);
+INSERT INTO sales VALUES (1049, 7796, 674.5);
+INSERT INTO sales VALUES (1050, 7944, 681.0);
+INSERT INTO sales VALUES (1051, 8092, 687.5);
+INSERT INTO sales VALUES (1052, 48, 694.0);
+INSERT INTO sales VALUES (1053, 196, 700.5);
+INSERT INTO sales VALUES (1054, 344, 707.0);
+INSERT INTO sales VALUES (1055, 492, 713.5);
+INSERT INTO sales VALUES (1056, 640, 720.0);
+INSERT INTO sales VALUES (1057, 788, 726.5);
+INSERT INTO sales VALUES (1058, 936, 733.0);
+INSERT INTO sales VALUES (1059, 1084, 739.5);
+INSERT INTO sales VALUES (1060, 1232, 746.0);
+INSERT INTO sales VALUES (1061, 1380, 752.5);
+INSERT INTO sales VALUES (1062, 1528, 759.0);
+INSERT INTO sales VALUES (1063, 1676, 765.5);
+INSERT INTO sales VALUES (1064, 1824, 772.0);
+INSERT INTO sales VALUES (1065, 1972, 778.5);
+INSERT INTO sales VALUES (1066, 2120, 785.0);
+INSERT INTO sales VALUES (1067, 2268, 791.5);
+INSERT INTO sales VALUES (1068, 2416, 798.0);
+INSERT INTO sales VALUES (1069, 2564, 804.5);
+INSERT INTO sales VALUES (1070, 2712, 811.0);
+INSERT INTO sales VALUES (1071, 2860, 817.5);
+INSERT INTO sales VALUES (1072, 3008, 824.0);
+INSERT INTO sales VALUES (1073, 3156, 830.5);
+INSERT INTO sales VALUES (1074, 3304, 837.0);
+INSERT INTO sales VALUES (1075, 3452, 843.5);
+INSERT INTO sales VALUES (1076, 3600, 850.0);
+INSERT INTO sales VALUES (1077, 3748, 856.5);
+INSERT INTO sales VALUES (1078, 3896, 863.0);
+INSERT INTO sales VALUES (1079, 4044, 869.5);
+INSERT INTO sales VALUES (1080, 4192, 876.0);
+INSERT INTO sales VALUES (1081, 4340, 882.5);
+INSERT INTO sales VALUES (1082, 4488, 889.0);
+INSERT INTO sales VALUES (1083, 4636, 895.5);
+INSERT INTO sales VALUES (1084, 4784, 902.0);
+INSERT INTO sales VALUES (1085, 4932, 908.5);
+INSERT INTO sales VALUES (1086, 5080, 915.0);
+INSERT INTO sales VALUES (1087, 5228, 921.5);
+INSERT INTO sales VALUES (1088, 5376, 928.0);
+INSERT INTO sales VALUES (1089, 5524, 934.5);
+INSERT INTO sales VALUES (1090, 5672, 941.0);
+INSERT INTO sales VALUES (1091, 5820, 947.5);
+INSERT INTO sales VALUES (1092, 5968, 954.0);
+INSERT INTO sales VALUES (1093, 6116, 960.5);
+INSERT INTO sales VALUES (1094, 6264, 967.0);
+INSERT INTO sales VALUES (1095, 6412, 973.5);
+INSERT INTO sales VALUES (1096, 6560, 980.0);
+INSERT INTO sales VALUES (1097, 6708, 986.5);
+INSERT INTO sales VALUES (1098, 6856, 993.0);
+INSERT INTO sales VALUES (1099, 7004, 999.5);
+INSERT INTO sales VALUES (1100, 7152, 1006.0);
+INSERT INTO sales VALUES (1101, 7300, 1012.5);
+INSERT INTO sales VALUES (1102, 7448, 1019.0);
+INSERT INTO sales VALUES (1103, 7596, 1.5);
+INSERT INTO sales VALUES (1104, 7744, 8.0);
+INSERT INTO sales VALUES (1105, 7892, 14.5);
+INSERT INTO sales VALUES (1106, 8040, 21.0);
+INSERT INTO sales VALUES (1107, 8188, 27.5);
+INSERT INTO sales VALUES (1108, 144, 34.0);
+INSERT INTO sales VALUES (1109, 292, 40.5);
+INSERT INTO sales VALUES (1110, 440, 47.0);
+INSERT INTO sales VALUES (1111, 588, 53.5);
+INSERT INTO sales VALUES (1112, 736, 60.0);
+INSERT INTO sales VALUES (1113, 884, 66.5);
+INSERT INTO sales VALUES (1114, 1032, 73.0);
+INSERT INTO sales VALUES (1115, 1180, 79.5);
+INSERT INTO sales VALUES (1116, 1328, 86.0);
+INSERT INTO sales VALUES (1117, 1476, 92.5);
+INSERT INTO sales VALUES (1118, 1624, 99.0);
+INSERT INTO sales VALUES (1119, 1772, 105.5);
+INSERT INTO sales VALUES (1120, 1920, 112.0);
+INSERT INTO sales VALUES (1121, 2068, 118.5);
+INSERT INTO sales VALUES (1122, 2216, 125.0);
+INSERT INTO sales VALUES (1123, 2364, 131.5);
+INSERT INTO sales VALUES (1124, 2512, 138.0);
+INSERT INTO sales VALUES (1125, 2660, 144.5);
+INSERT INTO sales VALUES (1126, 2808, 151.0);
+INSERT INTO sales VALUES (1127, 2956, 157.5);
+INSERT INTO sales VALUES (1128, 3104, 164.0);
+INSERT INTO sales VALUES (1129, 3252, 170.5);
+INSERT INTO sales VALUES (1130, 3400, 177.0);
+INSERT INTO sales VALUES (1131, 3548, 183.5);
+INSERT INTO sales VALUES (1132, 3696, 190.0);
+INSERT INTO sales VALUES (1133, 3844, 196.5);
+INSERT INTO sales VALUES (1134, 3992, 203.0);
+INSERT INTO sales VALUES (1135, 4140, 209.5);
+INSERT INTO sales VALUES (1136, 4288, 216.0);
+INSERT INTO sales VALUES (1137, 4436, 222.5);
+INSERT INTO sales VALUES (1138, 4584, 229.0);
+INSERT INTO sales VALUES (1139, 4732, 235.5);
+INSERT INTO sales VALUES (1140, 4880, 242.0);
+INSERT INTO sales VALUES (1141, 5028, 248.5);
+INSERT INTO sales VALUES (1142, 5176, 255.0);
+INSERT INTO sales VALUES (1143, 5324, 261.5);
+INSERT INTO sales VALUES (1144, 5472, 268.0);
+INSERT INTO sales VALUES (1145, 5620, 274.5);
+INSERT INTO sales VALUES (1146, 5768, 281.0);
+INSERT INTO sales VALUES (1147, 5916, 287.5);
+INSERT INTO sales VALUES (1148, 6064, 294.0);
+INSERT INTO sales VALUES (1149, 6212, 300.5);
+INSERT INTO sales VALUES (1150, 6360, 307.0);
+INSERT INTO sales VALUES (1151, 6508, 313.5);
+INSERT INTO sales VALUES (1152, 6656, 320.0);
+INSERT INTO sales VALUES (1153, 6804, 326.5);
+INSERT INTO sales VALUES (1154, 6952, 333.0);
+INSERT INTO sales VALUES (1155, 7100, 339.5);
+INSERT INTO sales VALUES (1156, 7248, 346.0);
+INSERT INTO sales VALUES (1157, 7396, 352.5);
+INSERT INTO sales VALUES (1158, 7544, 359.0);
+INSERT INTO sales VALUES (1159, 7692, 365.5);
+INSERT INTO sales VALUES (1160, 7840, 372.0);
+INSERT INTO sales VALUES (1161, 7988, 378.5);
+INSERT INTO sales VALUES (1162, 8136, 385.0);
+INSERT INTO sales VALUES (1163, 92, 391.5);
+INSERT INTO sales VALUES (1164, 240, 398.0);
+INSERT INTO sales VALUES (1165, 388, 404.5);
+INSERT INTO sales VALUES (1166, 536, 411.0);
+INSERT INTO sales VALUES (1167, 684, 417.5);
+INSERT INTO sales VALUES (1168, 832, 424.0);
+INSERT INTO sales VALUES (1169, 980, 430.5);
+INSERT INTO sales VALUES (1170, 1128, 437.0);
+INSERT INTO sales VALUES (1171, 1276, 443.5);
+INSERT INTO sales VALUES (1172, 1424, 450.0);
+INSERT INTO sales VALUES (1173, 1572, 456.5);
+INSERT INTO sales VALUES (1174, 1720, 463.0);
+INSERT INTO sales VALUES (1175, 1868, 469.5);
+INSERT INTO sales VALUES (1176, 2016, 476.0);
+INSERT INTO sales VALUES (1177, 2164, 482.5);
+INSERT INTO sales VALUES (1178, 2312, 489.0);
+INSERT INTO sales VALUES (1179, 2460, 495.5);
+INSERT INTO sales VALUES (1180, 2608, 502.0);
+INSERT INTO sales VALUES (1181, 2756, 508.5);
+INSERT INTO sales VALUES (1182, 2904, 515.0);
+INSERT INTO sales VALUES (1183, 3052, 521.5);
+INSERT INTO sales VALUES (1184, 3200, 528.0);
+INSERT INTO sales VALUES (1185, 3348, 534.5);
+INSERT INTO sales VALUES (1186, 3496, 541.0);
+INSERT INTO sales VALUES (1187, 3644, 547.5);
+INSERT INTO sales VALUES (1188, 3792, 554.0);
+INSERT INTO sales VALUES (1189, 3940, 560.5);
+INSERT INTO sales VALUES (1190, 4088, 567.0);
+INSERT INTO sales VALUES (1191, 4236, 573.5);
+INSERT INTO sales VALUES (1192, 4384, 580.0);
+INSERT INTO sales VALUES (1193, 4532, 586.5);
+INSERT INTO sales VALUES (1194, 4680, 593.0);
+INSERT INTO sales VALUES (1195, 4828, 599.5);
+INSERT INTO sales VALUES (1196, 4976, 606.0);
+INSERT INTO sales VALUES (1197, 5124, 612.5);
+INSERT INTO sales VALUES (1198, 5272, 619.0);
+INSERT INTO sales VALUES (1199, 5420, 625.5);
+INSERT INTO sales VALUES (1200, 5568, 632.0);
+INSERT INTO sales VALUES (1201, 5716, 638.5);
+INSERT INTO sales VALUES (1202, 5864, 645.0);
+INSERT INTO sales VALUES (1203, 6012, 651.5);
+INSERT INTO sales VALUES (1204, 6160, 658.0);
+INSERT INTO sales VALUES (1205, 6308, 664.5);
+INSERT INTO sales VALUES (1206, 6456, 671.0);
+INSERT INTO sales VALUES (1207, 6604, 677.5);
+INSERT INTO sales VALUES (1208, 6752, 684.0);
+INSERT INTO sales VALUES (1209, 6900, 690.5);
+INSERT INTO sales VALUES (1210, 7048, 697.0);
+INSERT INTO sales VALUES (1211, 7196, 703.5);
+INSERT INTO sales VALUES (1212, 7344, 710.0);
+INSERT INTO sales VALUES (1213, 7492, 716.5);
+INSERT INTO sales VALUES (1214, 7640, 723.0);
+INSERT INTO sales VALUES (1215, 7788, 729.5);
+INSERT INTO sales VALUES (1216, 7936, 736.0);
+INSERT INTO sales VALUES (1217, 8084, 742.5);
+INSERT INTO sales VALUES (1218, 40, 749.0);
+INSERT INTO sales VALUES (1219, 188, 755.5);
+INSERT INTO sales VALUES (1220, 336, 762.0);
+INSERT INTO sales VALUES (1221, 484, 768.5);
+INSERT INTO sales VALUES (1222, 632, 775.0);
+INSERT INTO sales VALUES (1223, 780, 781.5);
+INSERT INTO sales VALUES (1224, 928, 788.0);
+INSERT INTO sales VALUES (1225, 1076, 794.5);
+INSERT INTO sales VALUES (1226, 1224, 801.0);
+INSERT INTO sales VALUES (1227, 1372, 807.5);
+INSERT INTO sales VALUES (1228, 1520, 814.0);
+INSERT INTO sales VALUES (1229, 1668, 820.5);
+INSERT INTO sales VALUES (1230, 1816, 827.0);
+INSERT INTO sales VALUES (1231, 1964, 833.5);
+INSERT INTO sales VALUES (1232, 2112, 840.0);
+INSERT INTO sales VALUES (1233, 2260, 846.5);
+INSERT INTO sales VALUES (1234, 2408, 853.0);
+INSERT INTO sales VALUES (1235, 2556, 859.5);
+INSERT INTO sales VALUES (1236, 2704, 866.0);
+INSERT INTO sales VALUES (1237, 2852, 872.5);
+INSERT INTO sales VALUES (1238, 3000, 879.0);
+INSERT INTO sales VALUES (1239, 3148, 885.5);
+INSERT INTO sales VALUES (1240, 3296, 892.0);
+INSERT INTO sales VALUES (1241, 3444, 898.5);
+INSERT INTO sales VALUES (1242, 3592, 905.0);
+INSERT INTO sales VALUES (1243, 3740, 911.5);
+INSERT INTO sales VALUES (1244, 3888, 918.0);
+INSERT INTO sales VALUES (1245, 4036, 924.5);
+INSERT INTO sales VALUES (1246, 4184, 931.0);
+INSERT INTO sales VALUES (1247, 4332, 937.5);
+INSERT INTO sales VALUES (1248, 4480, 944.0);
+INSERT INTO sales VALUES (1249, 4628, 950.5);
+INSERT INTO sales VALUES (1250, 4776, 957.0);
+INSERT INTO sales VALUES (1251, 4924, 963.5);
+INSERT INTO sales VALUES (1252, 5072, 970.0);
+INSERT INTO sales VALUES (1253, 5220, 976.5);
+INSERT INTO sales VALUES (1254, 5368, 983.0);
+INSERT INTO sales VALUES (1255, 5516, 989.5);
+INSERT INTO sales VALUES (1256, 5664, 996.0);
+INSERT INTO sales VALUES (1257, 5812, 1002.5);
+INSERT INTO sales VALUES (1258, 5960, 1009.0);
+INSERT INTO sales VALUES (1259, 6108, 1015.5);
+INSERT INTO sales VALUES (1260, 6256, 1022.0);
+INSERT INTO sales VALUES (1261, 6404, 4.5);
+INSERT INTO sales VALUES (1262, 6552, 11.0);
+INSERT INTO sales VALUES (1263, 6700, 17.5);
+INSERT INTO sales VALUES (1264, 6848, 24.0);
+INSERT INTO sales VALUES (1265, 6996, 30.5);
+INSERT INTO sales VALUES (1266, 7144, 37.0);
+INSERT INTO sales VALUES (1267, 7292, 43.5);
+INSERT INTO sales VALUES (1268, 7440, 50.0);
+INSERT INTO sales VALUES (1269, 7588, 56.5);
+INSERT INTO sales VALUES (1270, 7736, 63.0);
+INSERT INTO sales VALUES (1271, 7884, 69.5);
+INSERT INTO sales VALUES (1272, 8032, 76.0);
+INSERT INTO sales VALUES (1273, 8180, 82.5);
+INSERT INTO sales VALUES (1274, 136, 89.0);
+INSERT INTO sales VALUES (1275, 284, 95.5);
+INSERT INTO sales VALUES (1276, 432, 102.0);
+INSERT INTO sales VALUES (1277, 580, 108.5);
+INSERT INTO sales VALUES (1278, 728, 115.0);
+INSERT INTO sales VALUES (1279, 876, 121.5);
+INSERT INTO sales VALUES (1280, 1024, 128.0);
+INSERT INTO sales VALUES (1281, 1172, 134.5);
+INSERT INTO sales VALUES (1282, 1320, 141.0);
+INSERT INTO sales VALUES (1283, 1468, 147.5);
+INSERT INTO sales VALUES (1284, 1616, 154.0);
+INSERT INTO sales VALUES (1285, 1764, 160.5);
+INSERT INTO sales VALUES (1286, 1912, 167.0);
+INSERT INTO sales VALUES (1287, 2060, 173.5);
+INSERT INTO sales VALUES (1288, 2208, 180.0);
+INSERT INTO sales VALUES (1289, 2356, 186.5);
+INSERT INTO sales VALUES (1290, 2504, 193.0);
+INSERT INTO sales VALUES (1291, 2652, 199.5);
+INSERT INTO sales VALUES (1292, 2800, 206.0);
+INSERT INTO sales VALUES (1293, 2948, 212.5);
+INSERT INTO sales VALUES (1294, 3096, 219.0);
+INSERT INTO sales VALUES (1295, 3244, 225.5);
+INSERT INTO sales VALUES (1296, 3392, 232.0);
+INSERT INTO sales VALUES (1297, 3540, 238.5);
+INSERT INTO sales VALUES (1298, 3688, 245.0);
+INSERT INTO sales VALUES (1299, 3836, 251.5);
+INSERT INTO sales VALUES (1300, 3984, 258.0);
+INSERT INTO sales VALUES (1301, 4132, 264.5);
+INSERT INTO sales VALUES (1302, 4280, 271.0);
+INSERT INTO sales VALUES (1303, 4428, 277.5);
+INSERT INTO sales VALUES (1304, 4576, 284.0);
+INSERT INTO sales VALUES (1305, 4724, 290.5);
+INSERT INTO sales VALUES (1306, 4872, 297.0);
+INSERT INTO sales VALUES (1307, 5020, 303.5);
+INSERT INTO sales VALUES (1308, 5168, 310.0);
+INSERT INTO sales VALUES (1309, 5316, 316.5);
+INSERT INTO sales VALUES (1310, 5464, 323.0);
+INSERT INTO sales VALUES (1311, 5612, 329.5);
+INSERT INTO sales VALUES (1312, 5760, 336.0);
+INSERT INTO sales VALUES (1313, 5908, 342.5);
+INSERT INTO sales VALUES (1314, 6056, 349.0);
+INSERT INTO sales VALUES (1315, 6204, 355.5);
+INSERT INTO sales VALUES (1316, 6352, 362.0);
+INSERT INTO sales VALUES (1317, 6500, 368.5);
+INSERT INTO sales VALUES (1318, 6648, 375.0);
+INSERT INTO sales VALUES (1319, 6796, 381.5);
+INSERT INTO sales VALUES (1320, 6944, 388.0);
+INSERT INTO sales VALUES (1321, 7092, 394.5);
+INSERT INTO sales VALUES (1322, 7240, 401.0);
+INSERT INTO sales VALUES (1323, 7388, 407.5);
+INSERT INTO sales VALUES (1324, 7536, 414.0);
+INSERT INTO sales VALUES (1325, 7684, 420.5);
+INSERT INTO sales VALUES (1326, 7832, 427.0);
+INSERT INTO sales VALUES (1327, 7980, 433.5);
+INSERT INTO sales VALUES (1328, 8128, 440.0);
+INSERT INTO sales VALUES (1329, 84, 446.5);
+INSERT INTO sales VALUES (1330, 232, 453.0);
+INSERT INTO sales VALUES (1331, 380, 459.5);
+INSERT INTO sales VALUES (1332, 528, 466.0);
+INSERT INTO sales VALUES (1333, 676, 472.5);
+INSERT INTO sales VALUES (1334, 824, 479.0);
+INSERT INTO sales VALUES (1335, 972, 485.5);
+INSERT INTO sales VALUES (1336, 1120, 492.0);
+INSERT INTO sales VALUES (1337, 1268, 498.5);
+INSERT INTO sales VALUES (1338, 1416, 505.0);
+INSERT INTO sales VALUES (1339, 1564, 511.5);
+INSERT INTO sales VALUES (1340, 1712, 518.0);
+INSERT INTO sales VALUES (1341, 1860, 524.5);
+INSERT INTO sales VALUES (1342, 2008, 531.0);
+INSERT INTO sales VALUES (1343, 2156, 537.5);
+INSERT INTO sales VALUES (1344, 2304, 544.0);
+INSERT INTO sales VALUES (1345, 2452, 550.5);
+INSERT INTO sales VALUES (1346, 2600, 557.0);
+INSERT INTO sales VALUES (1347, 2748, 563.5);
+INSERT INTO sales VALUES (1348, 2896, 570.0);
+INSERT INTO sales VALUES (1349, 3044, 576.5);
+INSERT INTO sales VALUES (1350, 3192, 583.0);
+INSERT INTO sales VALUES (1351, 3340, 589.5);
+INSERT INTO sales VALUES (1352, 3488, 596.0);
+INSERT INTO sales VALUES (1353, 3636, 602.5);
+INSERT INTO sales VALUES (1354, 3784, 609.0);
+INSERT INTO sales VALUES (1355, 3932, 615.5);
+INSERT INTO sales VALUES (1356, 4080, 622.0);
+INSERT INTO sales VALUES (1357, 4228, 628.5);
+INSERT INTO sales VALUES (1358, 4376, 635.0);
+INSERT INTO sales VALUES (1359, 4524, 641.5);
+INSERT INTO sales VALUES (1360, 4672, 648.0);
+INSERT INTO sales VALUES (1361, 4820, 654.5);
+INSERT INTO sales VALUES (1362, 4968, 661.0);
+INSERT INTO sales VALUES (1363, 5116, 667.5);
+INSERT INTO sales VALUES (1364, 5264, 674.0);
+INSERT INTO sales VALUES (1365, 5412, 680.5);
+INSERT INTO sales VALUES (1366, 5560, 687.0);
+INSERT INTO sales VALUES (1367, 5708, 693.5);
+INSERT INTO sales VALUES (1368, 5856, 700.0);
+INSERT INTO sales VALUES (1369, 6004, 706.5);
+INSERT INTO sales VALUES (1370, 6152, 713.0);
+INSERT INTO sales VALUES (1371, 6300, 719.5);
+INSERT INTO sales VALUES (1372, 6448, 726.0);
+INSERT INTO sales VALUES (1373, 6596, 732.5);
+INSERT INTO sales VALUES (1374, 6744, 739.0);
+INSERT INTO sales VALUES (1375, 6892, 745.5);
+INSERT INTO sales VALUES (1376, 7040, 752.0);
+INSERT INTO sales VALUES (1377, 7188, 758.5);
+INSERT INTO sales VALUES (1378, 7336, 765.0);
+INSERT INTO sales VALUES (1379, 7484, 771.5);
+INSERT INTO sales VALUES (1380, 7632, 778.0);
+INSERT INTO sales VALUES (1381, 7780, 784.5);
+INSERT INTO sales VALUES (1382, 7928, 791.0);
+INSERT INTO sales VALUES (1383, 8076, 797.5);
+INSERT INTO sales VALUES (1384, 32, 804.0);
+INSERT INTO sales VALUES (1385, 180, 810.5);
+INSERT INTO sales VALUES (1386, 328, 817.0);
+INSERT INTO sales VALUES (1387, 476, 823.5);
+INSERT INTO sales VALUES (1388, 624, 830.0);
+INSERT INTO sales VALUES (1389, 772, 836.5);
+INSERT INTO sales VALUES (1390, 920, 843.0);
+INSERT INTO sales VALUES (1391, 1068, 849.5);
+INSERT INTO sales VALUES (1392, 1216, 856.0);
+INSERT INTO sales VALUES (1393, 1364, 862.5);
+INSERT INTO sales VALUES (1394, 1512, 869.0);
+INSERT INTO sales VALUES (1395, 1660, 875.5);
+INSERT INTO sales VALUES (1396, 1808, 882.0);
+INSERT INTO sales VALUES (1397, 1956, 888.5);
+INSERT INTO sales VALUES (1398, 2104, 895.0);
+INSERT INTO sales VALUES (1399, 2252, 901.5);
+INSERT INTO sales VALUES (1400, 2400, 908.0);
+INSERT INTO sales VALUES (1401, 2548, 914.5);
+INSERT INTO sales VALUES (1402, 2696, 921.0);
+INSERT INTO sales VALUES (1403, 2844, 927.5);
+INSERT INTO sales VALUES (1404, 2992, 934.0);
+INSERT INTO sales VALUES (1405, 3140, 940.5);
+INSERT INTO sales VALUES (1406, 3288, 947.0);
+INSERT INTO sales VALUES (1407, 3436, 953.5);
+INSERT INTO sales VALUES (1408, 3584, 960.0);
+INSERT INTO sales VALUES (1409, 3732, 966.5);
+INSERT INTO sales VALUES (1410, 3880, 973.0);
+INSERT INTO sales VALUES (1411, 4028, 979.5);
+INSERT INTO sales VALUES (1412, 4176, 986.0);
+INSERT INTO sales VALUES (1413, 4324, 992.5);
+INSERT INTO sales VALUES (1414, 4472, 999.0);
+INSERT INTO sales VALUES (1415, 4620, 1005.5);
+INSERT INTO sales VALUES (1416, 4768, 1012.0);
+INSERT INTO sales VALUES (1417, 4916, 1018.5);
+INSERT INTO sales VALUES (1418, 5064, 1.0);
+INSERT INTO sales VALUES (1419, 5212, 7.5);
+INSERT INTO sales VALUES (1420, 5360, 14.0);
+INSERT INTO sales VALUES (1421, 5508, 20.5);
+INSERT INTO sales VALUES (1422, 5656, 27.0);
+INSERT INTO sales VALUES (1423, 5804, 33.5);
+INSERT INTO sales VALUES (1424, 5952, 40.0);
+INSERT INTO sales VALUES (1425, 6100, 46.5);
+INSERT INTO sales VALUES (1426, 6248, 53.0);
+INSERT INTO sales VALUES (1427, 6396, 59.5);
+INSERT INTO sales VALUES (1428, 6544, 66.0);
+INSERT INTO sales VALUES (1429, 6692, 72.5);
+INSERT INTO sales VALUES (1430, 6840, 79.0);
+INSERT INTO sales VALUES (1431, 6988, 85.5);
+INSERT INTO sales VALUES (1432, 7136, 92.0);
+INSERT INTO sales VALUES (1433, 7284, 98.5);
+INSERT INTO sales VALUES (1434, 7432, 105.0);
+INSERT INTO sales VALUES (1435, 7580, 111.5);
+INSERT INTO sales VALUES (1436, 7728, 118.0);
+INSERT INTO sales VALUES (1437, 7876, 124.5);
+INSERT INTO sales VALUES (1438, 8024, 131.0);
+INSERT INTO sales VALUES (1439, 8172, 137.5);
+INSERT INTO sales VALUES (1440, 128, 144.0);
+INSERT INTO sales VALUES (1441, 276, 150.5);
+INSERT INTO sales VALUES (1442, 424, 157.0);
+INSERT INTO sales VALUES (1443, 572, 163.5);
+INSERT INTO sales VALUES (1444, 720, 170.0);
+INSERT INTO sales VALUES (1445, 868, 176.5);
+INSERT INTO sales VALUES (1446, 1016, 183.0);
+INSERT INTO sales VALUES (1447, 1164, 189.5);
+INSERT INTO sales VALUES (1448, 1312, 196.0);
+INSERT INTO sales VALUES (1449, 1460, 202.5);
+INSERT INTO sales VALUES (1450, 1608, 209.0);
+INSERT INTO sales VALUES (1451, 1756, 215.5);
+INSERT INTO sales VALUES (1452, 1904, 222.0);
+INSERT INTO sales VALUES (1453, 2052, 228.5);
+INSERT INTO sales VALUES (1454, 2200, 235.0);
+INSERT INTO sales VALUES (1455, 2348, 241.5);
+INSERT INTO sales VALUES (1456, 2496, 248.0);
+INSERT INTO sales VALUES (1457, 2644, 254.5);
+INSERT INTO sales VALUES (1458, 2792, 261.0);
+INSERT INTO sales VALUES (1459, 2940, 267.5);
+INSERT INTO sales VALUES (1460, 3088, 274.0);
+INSERT INTO sales VALUES (1461, 3236, 280.5);
+INSERT INTO sales VALUES (1462, 3384, 287.0);
+INSERT INTO sales VALUES (1463, 3532, 293.5);
+INSERT INTO sales VALUES (1464, 3680, 300.0);
+INSERT INTO sales VALUES (1465, 3828, 306.5);
+INSERT INTO sales VALUES (1466, 3976, 313.0);
+INSERT INTO sales VALUES (1467, 4124, 319.5);
+INSERT INTO sales VALUES (1468, 4272, 326.0);
+INSERT INTO sales VALUES (1469, 4420, 332.5);
+INSERT INTO sales VALUES (1470, 4568, 339.0);
+INSERT INTO sales VALUES (1471, 4716, 345.5);
+INSERT INTO sales VALUES (1472, 4864, 352.0);
+INSERT INTO sales VALUES (1473, 5012, 358.5);
+INSERT INTO sales VALUES (1474, 5160, 365.0);
+INSERT INTO sales VALUES (1475, 5308, 371.5);
+INSERT INTO sales VALUES (1476, 5456, 378.0);
+INSERT INTO sales VALUES (1477, 5604, 384.5);
+INSERT INTO sales VALUES (1478, 5752, 391.0);
+INSERT INTO sales VALUES (1479, 5900, 397.5);
+INSERT INTO sales VALUES (1480, 6048, 404.0);
+INSERT INTO sales VALUES (1481, 6196, 410.5);
+INSERT INTO sales VALUES (1482, 6344, 417.0);
+INSERT INTO sales VALUES (1483, 6492, 423.5);
+INSERT INTO sales VALUES (1484, 6640, 430.0);
+INSERT INTO sales VALUES (1485, 6788, 436.5);
+INSERT INTO sales VALUES (1486, 6936, 443.0);
+INSERT INTO sales VALUES (1487, 7084, 449.5);
+INSERT INTO sales VALUES (1488, 7232, 456.0);
+INSERT INTO sales VALUES (1489, 7380, 462.5);
+INSERT INTO sales VALUES (1490, 7528, 469.0);
+INSERT INTO sales VALUES (1491, 7676, 475.5);
+INSERT INTO sales VALUES (1492, 7824, 482.0);
+INSERT INTO sales VALUES (1493, 7972, 488.5);
+INSERT INTO sales VALUES (1494, 8120, 495.0);
+INSERT INTO sales VALUES (1495, 76, 501.5);
+INSERT INTO sales VALUES (1496, 224, 508.0);
+INSERT INTO sales VALUES (1497, 372, 514.5);
+INSERT INTO sales VALUES (1498, 520, 521.0);
+INSERT INTO sales VALUES (1499, 668, 527.5);
+INSERT INTO sales VALUES (1500, 816, 534.0);
+INSERT INTO sales VALUES (1501, 964, 540.5);
+INSERT INTO sales VALUES (1502, 1112, 547.0);
+INSERT INTO sales VALUES (1503, 1260, 553.5);
+INSERT INTO sales VALUES (1504, 1408, 560.0);
+INSERT INTO sales VALUES (1505, 1556, 566.5);
+INSERT INTO sales VALUES (1506, 1704, 573.0);
+INSERT INTO sales VALUES (1507, 1852, 579.5);
+INSERT INTO sales VALUES (1508, 2000, 586.0);
+INSERT INTO sales VALUES (1509, 2148, 592.5);
+INSERT INTO sales VALUES (1510, 2296, 599.0);
+INSERT INTO sales VALUES (1511, 2444, 605.5);
+INSERT INTO sales VALUES (1512, 2592, 612.0);
+INSERT INTO sales VALUES (1513, 2740, 618.5);
+INSERT INTO sales VALUES (1514, 2888, 625.0);
+INSERT INTO sales VALUES (1515, 3036, 631.5);
+INSERT INTO sales VALUES (1516, 3184, 638.0);
+INSERT INTO sales VALUES (1517, 3332, 644.5);
+INSERT INTO sales VALUES (1518, 3480, 651.0);
+INSERT INTO sales VALUES (1519, 3628, 657.5);
+INSERT INTO sales VALUES (1520, 3776, 664.0);
+INSERT INTO sales VALUES (1521, 3924, 670.5);
+INSERT INTO sales VALUES (1522, 4072, 677.0);
+INSERT INTO sales VALUES (1523, 4220, 683.5);
+INSERT INTO sales VALUES (1524, 4368, 690.0);
+INSERT INTO sales VALUES (1525, 4516, 696.5);
+INSERT INTO sales VALUES (1526, 4664, 703.0);
+INSERT INTO sales VALUES (1527, 4812, 709.5);
+INSERT INTO sales VALUES (1528, 4960, 716.0);
+INSERT INTO sales VALUES (1529, 5108, 722.5);
+INSERT INTO sales VALUES (1530, 5256, 729.0);
+INSERT INTO sales VALUES (1531, 5404, 735.5);
+INSERT INTO sales VALUES (1532, 5552, 742.0);
+INSERT INTO sales VALUES (1533, 5700, 748.5);
+INSERT INTO sales VALUES (1534, 5848, 755.0);
+INSERT INTO sales VALUES (1535, 5996, 761.5);
+INSERT INTO sales VALUES (1536, 6144, 768.0);
+INSERT INTO sales VALUES (1537, 6292, 774.5);
+INSERT INTO sales VALUES (1538, 6440, 781.0);
+INSERT INTO sales VALUES (1539, 6588, 787.5);
+INSERT INTO sales VALUES (1540, 6736, 794.0);
+INSERT INTO sales VALUES (1541, 6884, 800.5);
+INSERT INTO sales VALUES (1542, 7032, 807.0);
+INSERT INTO sales VALUES (1543, 7180, 813.5);
+INSERT INTO sales VALUES (1544, 7328, 820.0);
+INSERT INTO sales VALUES (1545, 7476, 826.5);
+INSERT INTO sales VALUES (1546, 7624, 833.0);
+INSERT INTO sales VALUES (1547, 7772, 839.5);
+INSERT INTO sales VALUES (1548, 7920, 846.0);
+INSERT INTO sales VALUES (1549, 8068, 852.5);
+INSERT INTO sales VALUES (1550, 24, 859.0);
+INSERT INTO sales VALUES (1551, 172, 865.5);
+INSERT INTO sales VALUES (1552, 320, 872.0);
+INSERT INTO sales VALUES (1553, 468, 878.5);
+INSERT INTO sales VALUES (1554, 616, 885.0);
+INSERT INTO sales VALUES (1555, 764, 891.5);
+INSERT INTO sales VALUES (1556, 912, 898.0);
+INSERT INTO sales VALUES (1557, 1060, 904.5);
+INSERT INTO sales VALUES (1558, 1208, 911.0);
+INSERT INTO sales VALUES (1559, 1356, 917.5);
+INSERT INTO sales VALUES (1560, 1504, 924.0);
+INSERT INTO sales VALUES (1561, 1652, 930.5);
+INSERT INTO sales VALUES (1562, 1800, 937.0);
+INSERT INTO sales VALUES (1563, 1948, 943.5);
+INSERT INTO sales VALUES (1564, 2096, 950.0);
+INSERT INTO sales VALUES (1565, 2244, 956.5);
+INSERT INTO sales VALUES (1566, 2392, 963.0);
+INSERT INTO sales VALUES (1567, 2540, 969.5);
+INSERT INTO sales VALUES (1568, 2688, 976.0);
+INSERT INTO sales VALUES (1569, 2836, 982.5);
+INSERT INTO sales VALUES (1570, 2984, 989.0);
+INSERT INTO sales VALUES (1571, 3132, 995.5);
+INSERT INTO sales VALUES (1572, 3280, 1002.0);
+INSERT INTO sales VALUES (1573, 3428, 1008.5);
+INSERT INTO sales VALUES (1574, 3576, 1015.0);
+INSERT INTO sales VALUES (1575, 3724, 1021.5);
+INSERT INTO sales VALUES (1576, 3872, 4.0);
+INSERT INTO sales VALUES (1577, 4020, 10.5);
+INSERT INTO sales VALUES (1578, 4168, 17.0);
+INSERT INTO sales VALUES (1579, 4316, 23.5);
+INSERT INTO sales VALUES (1580, 4464, 30.0);
+INSERT INTO sales VALUES (1581, 4612, 36.5);
+INSERT INTO sales VALUES (1582, 4760, 43.0);
+INSERT INTO sales VALUES (1583, 4908, 49.5);
+INSERT INTO sales VALUES (1584, 5056, 56.0);
+INSERT INTO sales VALUES (1585, 5204, 62.5);
+INSERT INTO sales VALUES (1586, 5352, 69.0);
+INSERT INTO sales VALUES (1587, 5500, 75.5);
+INSERT INTO sales VALUES (1588, 5648, 82.0);
+INSERT INTO sales VALUES (1589, 5796, 88.5);
+INSERT INTO sales VALUES (1590, 5944, 95.0);
+INSERT INTO sales VALUES (1591, 6092, 101.5);
+INSERT INTO sales VALUES (1592, 6240, 108.0);
+INSERT INTO sales VALUES (1593, 6388, 114.5);
+INSERT INTO sales VALUES (1594, 6536, 121.0);
+INSERT INTO sales VALUES (1595, 6684, 127.5);
+INSERT INTO sales VALUES (1596, 6832, 134.0);
+INSERT INTO sales VALUES (1597, 6980, 140.5);
+INSERT INTO sales VALUES (1598, 7128, 147.0);
+INSERT INTO sales VALUES (1599, 7276, 153.5);
+INSERT INTO sales VALUES (1600, 7424, 160.0);
+INSERT INTO sales VALUES (1601, 7572, 166.5);
+INSERT INTO sales VALUES (1602, 7720, 173.0);
+INSERT INTO sales VALUES (1603, 7868, 179.5);
+INSERT INTO sales VALUES (1604, 8016, 186.0);
+INSERT INTO sales VALUES (1605, 8164, 192.5);
+INSERT INTO sales VALUES (1606, 120, 199.0);
+INSERT INTO sales VALUES (1607, 268, 205.5);
+INSERT INTO sales VALUES (1608, 416, 212.0);
+INSERT INTO sales VALUES (1609, 564, 218.5);
+INSERT INTO sales VALUES (1610, 712, 225.0);
+INSERT INTO sales VALUES (1611, 860, 231.5);
+INSERT INTO sales VALUES (1612, 1008, 238.0);
+INSERT INTO sales VALUES (1613, 1156, 244.5);
+INSERT INTO sales VALUES (1614, 1304, 251.0);
+INSERT INTO sales VALUES (1615, 1452, 257.5);
+INSERT INTO sales VALUES (1616, 1600, 264.0);
+INSERT INTO sales VALUES (1617, 1748, 270.5);
+INSERT INTO sales VALUES (1618, 1896, 277.0);
+INSERT INTO sales VALUES (1619, 2044, 283.5);
+INSERT INTO sales VALUES (1620, 2192, 290.0);
+INSERT INTO sales VALUES (1621, 2340, 296.5);
+INSERT INTO sales VALUES (1622, 2488, 303.0);
+INSERT INTO sales VALUES (1623, 2636, 309.5);
+INSERT INTO sales VALUES (1624, 2784, 316.0);
+INSERT INTO sales VALUES (1625, 2932, 322.5);
+INSERT INTO sales VALUES (1626, 3080, 329.0);
+INSERT INTO sales VALUES (1627, 3228, 335.5);
+INSERT INTO sales VALUES (1628, 3376, 342.0);
+INSERT INTO sales VALUES (1629, 3524, 348.5);
+INSERT INTO sales VALUES (1630, 3672, 355.0);
+INSERT INTO sales VALUES (1631, 3820, 361.5);
+INSERT INTO sales VALUES (1632, 3968, 368.0);
+INSERT INTO sales VALUES (1633, 4116, 374.5);
+INSERT INTO sales VALUES (1634, 4264, 381.0);
+INSERT INTO sales VALUES (1635, 4412, 387.5);
+INSERT INTO sales VALUES (1636, 4560, 394.0);
+INSERT INTO sales VALUES (1637, 4708, 400.5);
+INSERT INTO sales VALUES (1638, 4856, 407.0);
+INSERT INTO sales VALUES (1639, 5004, 413.5);
+INSERT INTO sales VALUES (1640, 5152, 420.0);
+INSERT INTO sales VALUES (1641, 5300, 426.5);
+INSERT INTO sales VALUES (1642, 5448, 433.0);
+INSERT INTO sales VALUES (1643, 5596, 439.5);
+INSERT INTO sales VALUES (1644, 5744, 446.0);
+INSERT INTO sales VALUES (1645, 5892, 452.5);
+INSERT INTO sales VALUES (1646, 6040, 459.0);
+INSERT INTO sales VALUES (1647, 6188, 465.5);
+INSERT INTO sales VALUES (1648, 6336, 472.0);
+INSERT INTO sales VALUES (1649, 6484, 478.5);
+INSERT INTO sales VALUES (1650, 6632, 485.0);
+INSERT INTO sales VALUES (1651, 6780, 491.5);
+INSERT INTO sales VALUES (1652, 6928, 498.0);
+INSERT INTO sales VALUES (1653, 7076, 504.5);
+INSERT INTO sales VALUES (1654, 7224, 511.0);
+INSERT INTO sales VALUES (1655, 7372, 517.5);
+INSERT INTO sales VALUES (1656, 7520, 524.0);
+INSERT INTO sales VALUES (1657, 7668, 530.5);
+INSERT INTO sales VALUES (1658, 7816, 537.0);
+INSERT INTO sales VALUES (1659, 7964, 543.5);
+INSERT INTO sales VALUES (1660, 8112, 550.0);
+INSERT INTO sales VALUES (1661, 68, 556.5);
+INSERT INTO sales VALUES (1662, 216, 563.0);
+INSERT INTO sales VALUES (1663, 364, 569.5);
+INSERT INTO sales VALUES (1664, 512, 576.0);
+INSERT INTO sales VALUES (1665, 660, 582.5);
+INSERT INTO sales VALUES (1666, 808, 589.0);
+INSERT INTO sales VALUES (1667, 956, 595.5);
+INSERT INTO sales VALUES (1668, 1104, 602.0);
+INSERT INTO sales VALUES (1669, 1252, 608.5);
+INSERT INTO sales VALUES (1670, 1400, 615.0);
+INSERT INTO sales VALUES (1671, 1548, 621.5);
+INSERT INTO sales VALUES (1672, 1696, 628.0);
+INSERT INTO sales VALUES (1673, 1844, 634.5);
+INSERT INTO sales VALUES (1674, 1992, 641.0);
+INSERT INTO sales VALUES (1675, 2140, 647.5);
+INSERT INTO sales VALUES (1676, 2288, 654.0);
+INSERT INTO sales VALUES (1677, 2436, 660.5);
+INSERT INTO sales VALUES (1678, 2584, 667.0);
+INSERT INTO sales VALUES (1679, 2732, 673.5);
+INSERT INTO sales VALUES (1680, 2880, 680.0);
+INSERT INTO sales VALUES (1681, 3028, 686.5);
+INSERT INTO sales VALUES (1682, 3176, 693.0);
+INSERT INTO sales VALUES (1683, 3324, 699.5);
+INSERT INTO sales VALUES (1684, 3472, 706.0);
+INSERT INTO sales VALUES (1685, 3620, 712.5);
+INSERT INTO sales VALUES (1686, 3768, 719.0);
+INSERT INTO sales VALUES (1687, 3916, 725.5);
+INSERT INTO sales VALUES (1688, 4064, 732.0);
+INSERT INTO sales VALUES (1689, 4212, 738.5);
+INSERT INTO sales VALUES (1690, 4360, 745.0);
+INSERT INTO sales VALUES (1691, 4508, 751.5);
+INSERT INTO sales VALUES (1692, 4656, 758.0);
+INSERT INTO sales VALUES (1693, 4804, 764.5);
+INSERT INTO sales VALUES (1694, 4952, 771.0);
+INSERT INTO sales VALUES (1695, 5100, 777.5);
+INSERT INTO sales VALUES (1696, 5248, 784.0);
+INSERT INTO sales VALUES (1697, 5396, 790.5);
+INSERT INTO sales VALUES (1698, 5544, 797.0);
+INSERT INTO sales VALUES (1699, 5692, 803.5);
+INSERT INTO sales VALUES (1700, 5840, 810.0);
+INSERT INTO sales VALUES (1701, 5988, 816.5);
+INSERT INTO sales VALUES (1702, 6136, 823.0);
+INSERT INTO sales VALUES (1703, 6284, 829.5);
+INSERT INTO sales VALUES (1704, 6432, 836.0);
+INSERT INTO sales VALUES (1705, 6580, 842.5);
+INSERT INTO sales VALUES (1706, 6728, 849.0);
+INSERT INTO sales VALUES (1707, 6876, 855.5);
+INSERT INTO sales VALUES (1708, 7024, 862.0);
+INSERT INTO sales VALUES (1709, 7172, 868.5);
+INSERT INTO sales VALUES (1710, 7320, 875.0);
+INSERT INTO sales VALUES (1711, 7468, 881.5);
+INSERT INTO sales VALUES (1712, 7616, 888.0);
+INSERT INTO sales VALUES (1713, 7764, 894.5);
+INSERT INTO sales VALUES (1714, 7912, 901.0);
+INSERT INTO sales VALUES (1715, 8060, 907.5);
+INSERT INTO sales VALUES (1716, 16, 914.0);
+INSERT INTO sales VALUES (1717, 164, 920.5);
+INSERT INTO sales VALUES (1718, 312, 927.0);
+INSERT INTO sales VALUES (1719, 460, 933.5);
+INSERT INTO sales VALUES (1720, 608, 940.0);
+INSERT INTO sales VALUES (1721, 756, 946.5);
+INSERT INTO sales VALUES (1722, 904, 953.0);
+INSERT INTO sales VALUES (1723, 1052, 959.5);
+INSERT INTO sales VALUES (1724, 1200, 966.0);
+INSERT INTO sales VALUES (1725, 1348, 972.5);
+INSERT INTO sales VALUES (1726, 1496, 979.0);
+INSERT INTO sales VALUES (1727, 1644, 985.5);
+INSERT INTO sales VALUES (1728, 1792, 992.0);
+INSERT INTO sales VALUES (1729, 1940, 998.5);
+INSERT INTO sales VALUES (1730, 2088, 1005.0);
+INSERT INTO sales VALUES (1731, 2236, 1011.5);
+INSERT INTO sales VALUES (1732, 2384, 1018.0);
+INSERT INTO sales VALUES (1733, 2532, 0.5);
+INSERT INTO sales VALUES (1734, 2680, 7.0);
+INSERT INTO sales VALUES (1735, 2828, 13.5);
+INSERT INTO sales VALUES (1736, 2976, 20.0);
+INSERT INTO sales VALUES (1737, 3124, 26.5);
+INSERT INTO sales VALUES (1738, 3272, 33.0);
+INSERT INTO sales VALUES (1739, 3420, 39.5);
+INSERT INTO sales VALUES (1740, 3568, 46.0);
+INSERT INTO sales VALUES (1741, 3716, 52.5);
+INSERT INTO sales VALUES (1742, 3864, 59.0);
+INSERT INTO sales VALUES (1743, 4012, 65.5);
+INSERT INTO sales VALUES (1744, 4160, 72.0);
+INSERT INTO sales VALUES (1745, 4308, 78.5);
+INSERT INTO sales VALUES (1746, 4456, 85.0);
+INSERT INTO sales VALUES (1747, 4604, 91.5);
+INSERT INTO sales VALUES (1748, 4752, 98.0);
+INSERT INTO sales VALUES (1749, 4900, 104.5);
+INSERT INTO sales VALUES (1750, 5048, 111.0);
+INSERT INTO sales VALUES (1751, 5196, 117.5);
+INSERT INTO sales VALUES (1752, 5344, 124.0);
+INSERT INTO sales VALUES (1753, 5492, 130.5);
+INSERT INTO sales VALUES (1754, 5640, 137.0);
+INSERT INTO sales VALUES (1755, 5788, 143.5);
+INSERT INTO sales VALUES (1756, 5936, 150.0);
+INSERT INTO sales VALUES (1757, 6084, 156.5);
+INSERT INTO sales VALUES (1758, 6232, 163.0);
+INSERT INTO sales VALUES (1759, 6380, 169.5);
+INSERT INTO sales VALUES (1760, 6528, 176.0);
+INSERT INTO sales VALUES (1761, 6676, 182.5);
+INSERT INTO sales VALUES (1762, 6824, 189.0);
+INSERT INTO sales VALUES (1763, 6972, 195.5);
+INSERT INTO sales VALUES (1764, 7120, 202.0);
+INSERT INTO sales VALUES (1765, 7268, 208.5);
+INSERT INTO sales VALUES (1766, 7416, 215.0);
+INSERT INTO sales VALUES (1767, 7564, 221.5);
+INSERT INTO sales VALUES (1768, 7712, 228.0);
+INSERT INTO sales VALUES (1769, 7860, 234.5);
+INSERT INTO sales VALUES (1770, 8008, 241.0);
+INSERT INTO sales VALUES (1771, 8156, 247.5);
+INSERT INTO sales VALUES (1772, 112, 254.0);
+INSERT INTO sales VALUES (1773, 260, 260.5);
+INSERT INTO sales VALUES (1774, 408, 267.0);
+INSERT INTO sales VALUES (1775, 556, 273.5);
+INSERT INTO sales VALUES (1776, 704, 280.0);
+INSERT INTO sales VALUES (1777, 852, 286.5);
+INSERT INTO sales VALUES (1778, 1000, 293.0);
+INSERT INTO sales VALUES (1779, 1148, 299.5);
+INSERT INTO sales VALUES (1780, 1296, 306.0);
+INSERT INTO sales VALUES (1781, 1444, 312.5);
+INSERT INTO sales VALUES (1782, 1592, 319.0);
+INSERT INTO sales VALUES (1783, 1740, 325.5);
+INSERT INTO sales VALUES (1784, 1888, 332.0);
+INSERT INTO sales VALUES (1785, 2036, 338.5);
+INSERT INTO sales VALUES (1786, 2184, 345.0);
+INSERT INTO sales VALUES (1787, 2332, 351.5);
+INSERT INTO sales VALUES (1788, 2480, 358.0);
+INSERT INTO sales VALUES (1789, 2628, 364.5);
+INSERT INTO sales VALUES (1790, 2776, 371.0);
+INSERT INTO sales VALUES (1791, 2924, 377.5);
+INSERT INTO sales VALUES (1792, 3072, 384.0);
+INSERT INTO sales VALUES (1793, 3220, 390.5);
+INSERT INTO sales VALUES (1794, 3368, 397.0);
+INSERT INTO sales VALUES (1795, 3516, 403.5);
+INSERT INTO sales VALUES (1796, 3664, 410.0);
+INSERT INTO sales VALUES (1797, 3812, 416.5);
+INSERT INTO sales VALUES (1798, 3960, 423.0);
+INSERT INTO sales VALUES (1799, 4108, 429.5);
+INSERT INTO sales VALUES (1800, 4256, 436.0);
+INSERT INTO sales VALUES (1801, 4404, 442.5);
+INSERT INTO sales VALUES (1802, 4552, 449.0);
+INSERT INTO sales VALUES (1803, 4700, 455.5);
+INSERT INTO sales VALUES (1804, 4848, 462.0);
+INSERT INTO sales VALUES (1805, 4996, 468.5);
+INSERT INTO sales VALUES (1806, 5144, 475.0);
+INSERT INTO sales VALUES (1807, 5292, 481.5);
+INSERT INTO sales VALUES (1808, 5440, 488.0);
+INSERT INTO sales VALUES (1809, 5588, 494.5);
+INSERT INTO sales VALUES (1810, 5736, 501.0);
+INSERT INTO sales VALUES (1811, 5884, 507.5);
+INSERT INTO sales VALUES (1812, 6032, 514.0);
+INSERT INTO sales VALUES (1813, 6180, 520.5);
+INSERT INTO sales VALUES (1814, 6328, 527.0);
+INSERT INTO sales VALUES (1815, 6476, 533.5);
+INSERT INTO sales VALUES (1816, 6624, 540.0);
+INSERT INTO sales VALUES (1817, 6772, 546.5);
+INSERT INTO sales VALUES (1818, 6920, 553.0);
+INSERT INTO sales VALUES (1819, 7068, 559.5);
+INSERT INTO sales VALUES (1820, 7216, 566.0);
+INSERT INTO sales VALUES (1821, 7364, 572.5);
+INSERT INTO sales VALUES (1822, 7512, 579.0);
+INSERT INTO sales VALUES (1823, 7660, 585.5);
+INSERT INTO sales VALUES (1824, 7808, 592.0);
+INSERT INTO sales VALUES (1825, 7956, 598.5);
+INSERT INTO sales VALUES (1826, 8104, 605.0);
+INSERT INTO sales VALUES (1827, 60, 611.5);
+INSERT INTO sales VALUES (1828, 208, 618.0);
+INSERT INTO sales VALUES (1829, 356, 624.5);
+INSERT INTO sales VALUES (1830, 504, 631.0);
+INSERT INTO sales VALUES (1831, 652, 637.5);
+INSERT INTO sales VALUES (1832, 800, 644.0);
+INSERT INTO sales VALUES (1833, 948, 650.5);
+INSERT INTO sales VALUES (1834, 1096, 657.0);
+INSERT INTO sales VALUES (1835, 1244, 663.5);
+INSERT INTO sales VALUES (1836, 1392, 670.0);
+INSERT INTO sales VALUES (1837, 1540, 676.5);
+INSERT INTO sales VALUES (1838, 1688, 683.0);
+INSERT INTO sales VALUES (1839, 1836, 689.5);
+INSERT INTO sales VALUES (1840, 1984, 696.0);
+INSERT INTO sales VALUES (1841, 2132, 702.5);
+INSERT INTO sales VALUES (1842, 2280, 709.0);
+INSERT INTO sales VALUES (1843, 2428, 715.5);
+INSERT INTO sales VALUES (1844, 2576, 722.0);
+INSERT INTO sales VALUES (1845, 2724, 728.5);
+INSERT INTO sales VALUES (1846, 2872, 735.0);
+INSERT INTO sales VALUES (1847, 3020, 741.5);
+INSERT INTO sales VALUES (1848, 3168, 748.0);
+INSERT INTO sales VALUES (1849, 3316, 754.5);
+INSERT INTO sales VALUES (1850, 3464, 761.0);
+INSERT INTO sales VALUES (1851, 3612, 767.5);
+INSERT INTO sales VALUES (1852, 3760, 774.0);
+INSERT INTO sales VALUES (1853, 3908, 780.5);
+INSERT INTO sales VALUES (1854, 4056, 787.0);
+INSERT INTO sales VALUES (1855, 4204, 793.5);
+INSERT INTO sales VALUES (1856, 4352, 800.0);
+INSERT INTO sales VALUES (1857, 4500, 806.5);
+INSERT INTO sales VALUES (1858, 4648, 813.0);
+INSERT INTO sales VALUES (1859, 4796, 819.5);
+INSERT INTO sales VALUES (1860, 4944, 826.0);
+INSERT INTO sales VALUES (1861, 5092, 832.5);
+INSERT INTO sales VALUES (1862, 5240, 839.0);
+INSERT INTO sales VALUES (1863, 5388, 845.5);
+INSERT INTO sales VALUES (1864, 5536, 852.0);
+INSERT INTO sales VALUES (1865, 5684, 858.5);
+INSERT INTO sales VALUES (1866, 5832, 865.0);
+INSERT INTO sales VALUES (1867, 5980, 871.5);
+INSERT INTO sales VALUES (1868, 6128, 878.0);
+INSERT INTO sales VALUES (1869, 6276, 884.5);
+INSERT INTO sales VALUES (1870, 6424, 891.0);
+INSERT INTO sales VALUES (1871, 6572, 897.5);
+INSERT INTO sales VALUES (1872, 6720, 904.0);
+INSERT INTO sales VALUES (1873, 6868, 910.5);
+INSERT INTO sales VALUES (1874, 7016, 917.0);
+INSERT INTO sales VALUES (1875, 7164, 923.5);
+INSERT INTO sales VALUES (1876, 7312, 930.0);
+INSERT INTO sales VALUES (1877, 7460, 936.5);
+INSERT INTO sales VALUES (1878, 7608, 943.0);
+INSERT INTO sales VALUES (1879, 7756, 949.5);
+INSERT INTO sales VALUES (1880, 7904, 956.0);
+INSERT INTO sales VALUES (1881, 8052, 962.5);
+INSERT INTO sales VALUES (1882, 8, 969.0);
+INSERT INTO sales VALUES (1883, 156, 975.5);
+INSERT INTO sales VALUES (1884, 304, 982.0);
+INSERT INTO sales VALUES (1885, 452, 988.5);
+INSERT INTO sales VALUES (1886, 600, 995.0);
+INSERT INTO sales VALUES (1887, 748, 1001.5);
+INSERT INTO sales VALUES (1888, 896, 1008.0);
+INSERT INTO sales VALUES (1889, 1044, 1014.5);
+INSERT INTO sales VALUES (1890, 1192, 1021.0);
+INSERT INTO sales VALUES (1891, 1340, 3.5);
+INSERT INTO sales VALUES (1892, 1488, 10.0);
+INSERT INTO sales VALUES (1893, 1636, 16.5);
+INSERT INTO sales VALUES (1894, 1784, 23.0);
+INSERT INTO sales VALUES (1895, 1932, 29.5);
+INSERT INTO sales VALUES (1896, 2080, 36.0);
+INSERT INTO sales VALUES (1897, 2228, 42.5);
+INSERT INTO sales VALUES (1898, 2376, 49.0);
+INSERT INTO sales VALUES (1899, 2524, 55.5);
+INSERT INTO sales VALUES (1900, 2672, 62.0);
+INSERT INTO sales VALUES (1901, 2820, 68.5);
+INSERT INTO sales VALUES (1902, 2968, 75.0);
+INSERT INTO sales VALUES (1903, 3116, 81.5);
+INSERT INTO sales VALUES (1904, 3264, 88.0);
+INSERT INTO sales VALUES (1905, 3412, 94.5);
+INSERT INTO sales VALUES (1906, 3560, 101.0);
+INSERT INTO sales VALUES (1907, 3708, 107.5);
+INSERT INTO sales VALUES (1908, 3856, 114.0);
+INSERT INTO sales VALUES (1909, 4004, 120.5);
+INSERT INTO sales VALUES (1910, 4152, 127.0);
+INSERT INTO sales VALUES (1911, 4300, 133.5);
+INSERT INTO sales VALUES (1912, 4448, 140.0);
+INSERT INTO sales VALUES (1913, 4596, 146.5);
+INSERT INTO sales VALUES (1914, 4744, 153.0);
+INSERT INTO sales VALUES (1915, 4892, 159.5);
+INSERT INTO sales VALUES (1916, 5040, 166.0);
+INSERT INTO sales VALUES (1917, 5188, 172.5);
+INSERT INTO sales VALUES (1918, 5336, 179.0);
+INSERT INTO sales VALUES (1919, 5484, 185.5);
+INSERT INTO sales VALUES (1920, 5632, 192.0);
+INSERT INTO sales VALUES (1921, 5780, 198.5);
+INSERT INTO sales VALUES (1922, 5928, 205.0);
+INSERT INTO sales VALUES (1923, 6076, 211.5);
+INSERT INTO sales VALUES (1924, 6224, 218.0);
+INSERT INTO sales VALUES (1925, 6372, 224.5);
+INSERT INTO sales VALUES (1926, 6520, 231.0);
+INSERT INTO sales VALUES (1927, 6668, 237.5);
+INSERT INTO sales VALUES (1928, 6816, 244.0);
+INSERT INTO sales VALUES (1929, 6964, 250.5);
+INSERT INTO sales VALUES (1930, 7112, 257.0);
+INSERT INTO sales VALUES (1931, 7260, 263.5);
+INSERT INTO sales VALUES (1932, 7408, 270.0);
+INSERT INTO sales VALUES (1933, 7556, 276.5);
+INSERT INTO sales VALUES (1934, 7704, 283.0);
+INSERT INTO sales VALUES (1935, 7852, 289.5);
+INSERT INTO sales VALUES (1936, 8000, 296.0);
+INSERT INTO sales VALUES (1937, 8148, 302.5);
+INSERT INTO sales VALUES (1938, 104, 309.0);
+INSERT INTO sales VALUES (1939, 252, 315.5);
+INSERT INTO sales VALUES (1940, 400, 322.0);
+INSERT INTO sales VALUES (1941, 548, 328.5);
+INSERT INTO sales VALUES (1942, 696, 335.0);
+INSERT INTO sales VALUES (1943, 844, 341.5);
+INSERT INTO sales VALUES (1944, 992, 348.0);
+INSERT INTO sales VALUES (1945, 1140, 354.5);
+INSERT INTO sales VALUES (1946, 1288, 361.0);
+INSERT INTO sales VALUES (1947, 1436, 367.5);
+INSERT INTO sales VALUES (1948, 1584, 374.0);
+INSERT INTO sales VALUES (1949, 1732, 380.5);
+INSERT INTO sales VALUES (1950, 1880, 387.0);
+INSERT INTO sales VALUES (1951, 2028, 393.5);
+INSERT INTO sales VALUES (1952, 2176, 400.0);
+INSERT INTO sales VALUES (1953, 2324, 406.5);
+INSERT INTO sales VALUES (1954, 2472, 413.0);
+INSERT INTO sales VALUES (1955, 2620, 419.5);
+INSERT INTO sales VALUES (1956, 2768, 426.0);
+INSERT INTO sales VALUES (1957, 2916, 432.5);
+INSERT INTO sales VALUES (1958, 3064, 439.0);
+INSERT INTO sales VALUES (1959, 3212, 445.5);
+INSERT INTO sales VALUES (1960, 3360, 452.0);
+INSERT INTO sales VALUES (1961, 3508, 458.5);
+INSERT INTO sales VALUES (1962, 3656, 465.0);
+INSERT INTO sales VALUES (1963, 3804, 471.5);
+INSERT INTO sales VALUES (1964, 3952, 478.0);
+INSERT INTO sales VALUES (1965, 4100, 484.5);
+INSERT INTO sales VALUES (1966, 4248, 491.0);
+INSERT INTO sales VALUES (1967, 4396, 497.5);
+INSERT INTO sales VALUES (1968, 4544, 504.0);
+INSERT INTO sales VALUES (1969, 4692, 510.5);
+INSERT INTO sales VALUES (1970, 4840, 517.0);
+INSERT INTO sales VALUES (1971, 4988, 523.5);
+INSERT INTO sales VALUES (1972, 5136, 530.0);
+INSERT INTO sales VALUES (1973, 5284, 536.5);
+INSERT INTO sales VALUES (1974, 5432, 543.0);
+INSERT INTO sales VALUES (1975, 5580, 549.5);
+INSERT INTO sales VALUES (1976, 5728, 556.0);
+INSERT INTO sales VALUES (1977, 5876, 562.5);
+INSERT INTO sales VALUES (1978, 6024, 569.0);
+INSERT INTO sales VALUES (1979, 6172, 575.5);
+INSERT INTO sales VALUES (1980, 6320, 582.0);
+INSERT INTO sales VALUES (1981, 6468, 588.5);
+INSERT INTO sales VALUES (1982, 6616, 595.0);
+INSERT INTO sales VALUES (1983, 6764, 601.5);
+INSERT INTO sales VALUES (1984, 6912, 608.0);
+INSERT INTO sales VALUES (1985, 7060, 614.5);
+INSERT INTO sales VALUES (1986, 7208, 621.0);
+INSERT INTO sales VALUES (1987, 7356, 627.5);
+INSERT INTO sales VALUES (1988, 7504, 634.0);
+INSERT INTO sales VALUES (1989, 7652, 640.5);
+INSERT INTO sales VALUES (1990, 7800, 647.0);
+INSERT INTO sales VALUES (1991, 7948, 653.5);
+INSERT INTO sales VALUES (1992, 8096, 660.0);
+INSERT INTO sales VALUES (1993, 52, 666.5);
+INSERT INTO sales VALUES (1994, 200, 673.0);
+INSERT INTO sales VALUES (1995, 348, 679.5);
+INSERT INTO sales VALUES (1996, 496, 686.0);
+INSERT INTO sales VALUES (1997, 644, 692.5);
+INSERT INTO sales VALUES (1998, 792, 699.0);
+INSERT INTO sales VALUES (1999, 940, 705.5);
+INSERT INTO sales VALUES (2000, 1088, 712.0);
+INSERT INTO sales VALUES (2001, 1236, 718.5);
+INSERT INTO sales VALUES (2002, 1384, 725.0);
+INSERT INTO sales VALUES (2003, 1532, 731.5);
+INSERT INTO sales VALUES (2004, 1680, 738.0);
+INSERT INTO sales VALUES (2005, 1828, 744.5);
+INSERT INTO sales VALUES (2006, 1976, 751.0);
+INSERT INTO sales VALUES (2007, 2124, 757.5);
+INSERT INTO sales VALUES (2008, 2272, 764.0);
+INSERT INTO sales VALUES (2009, 2420, 770.5);
+INSERT INTO sales VALUES (2010, 2568, 777.0);
+INSERT INTO sales VALUES (2011, 2716, 783.5);
+INSERT INTO sales VALUES (2012, 2864, 790.0);
+INSERT INTO sales VALUES (2013, 3012, 796.5);
+INSERT INTO sales VALUES (2014, 3160, 803.0);
+INSERT INTO sales VALUES (2015, 3308, 809.5);
+INSERT INTO sales VALUES (2016, 3456, 816.0);
+INSERT INTO sales VALUES (2017, 3604, 822.5);
+INSERT INTO sales VALUES (2018, 3752, 829.0);
+INSERT INTO sales VALUES (2019, 3900, 835.5);
+INSERT INTO sales VALUES (2020, 4048, 842.0);
+INSERT INTO sales VALUES (2021, 4196, 848.5);
+INSERT INTO sales VALUES (2022, 4344, 855.0);
+INSERT INTO sales VALUES (2023, 4492, 861.5);
+INSERT INTO sales VALUES (2024, 4640, 868.0);
+INSERT INTO sales VALUES (2025, 4788, 874.5);
+INSERT INTO sales VALUES (2026, 4936, 881.0);
+INSERT INTO sales VALUES (2027, 5084, 887.5);
+INSERT INTO sales VALUES (2028, 5232, 894.0);
+INSERT INTO sales VALUES (2029, 5380, 900.5);
+INSERT INTO sales VALUES (2030, 5528, 907.0);
+INSERT INTO sales VALUES (2031, 5676, 913.5);
+INSERT INTO sales VALUES (2032, 5824, 920.0);
+INSERT INTO sales VALUES (2033, 5972, 926.5);
+INSERT INTO sales VALUES (2034, 6120, 933.0);
+INSERT INTO sales VALUES (2035, 6268, 939.5);
+INSERT INTO sales VALUES (2036, 6416, 946.0);
+INSERT INTO sales VALUES (2037, 6564, 952.5);
+INSERT INTO sales VALUES (2038, 6712, 959.0);
+INSERT INTO sales VALUES (2039, 6860, 965.5);
+INSERT INTO sales VALUES (2040, 7008, 972.0);
+INSERT INTO sales VALUES (2041, 7156, 978.5);
+INSERT INTO sales VALUES (2042, 7304, 985.0);
+INSERT INTO sales VALUES (2043, 7452, 991.5);
+INSERT INTO sales VALUES (2044, 7600, 998.0);
+INSERT INTO sales VALUES (2045, 7748, 1004.5);
+INSERT INTO sales VALUES (2046, 7896, 1011.0);
+INSERT INTO sales VALUES (2047, 8044, 1017.5);
+INSERT INTO sales VALUES (2048, 1, 0.125);
+INSERT INTO sales VALUES (2049, 149, 6.625);
+INSERT INTO sales VALUES (2050, 297, 13.125);
+INSERT INTO sales VALUES (2051, 445, 19.625);
+INSERT INTO sales VALUES (2052, 593, 26.125);
+INSERT INTO sales VALUES (2053, 741, 32.625);
+INSERT INTO sales VALUES (2054, 889, 39.125);
+INSERT INTO sales VALUES (2055, 1037, 45.625);
+INSERT INTO sales VALUES (2056, 1185, 52.125);
+INSERT INTO sales VALUES (2057, 1333, 58.625);
+INSERT INTO sales VALUES (2058, 1481, 65.125);
+INSERT INTO sales VALUES (2059, 1629, 71.625);
+INSERT INTO sales VALUES (2060, 1777, 78.125);
+INSERT INTO sales VALUES (2061, 1925, 84.625);
+INSERT INTO sales VALUES (2062, 2073, 91.125);
+INSERT INTO sales VALUES (2063, 2221, 97.625);
+INSERT INTO sales VALUES (2064, 2369, 104.125);
+INSERT INTO sales VALUES (2065, 2517, 110.625);
+INSERT INTO sales VALUES (2066, 2665, 117.125);
+INSERT INTO sales VALUES (2067, 2813, 123.625);
+INSERT INTO sales VALUES (2068, 2961, 130.125);
+INSERT INTO sales VALUES (2069, 3109, 136.625);
+INSERT INTO sales VALUES (2070, 3257, 143.125);
+INSERT INTO sales VALUES (2071, 3405, 149.625);
+INSERT INTO sales VALUES (2072, 3553, 156.125);
+INSERT INTO sales VALUES (2073, 3701, 162.625);
+INSERT INTO sales VALUES (2074, 3849, 169.125);
+INSERT INTO sales VALUES (2075, 3997, 175.625);
+INSERT INTO sales VALUES (2076, 4145, 182.125);
+INSERT INTO sales VALUES (2077, 4293, 188.625);
+INSERT INTO sales VALUES (2078, 4441, 195.125);
+INSERT INTO sales VALUES (2079, 4589, 201.625);
+INSERT INTO sales VALUES (2080, 4737, 208.125);
+INSERT INTO sales VALUES (2081, 4885, 214.625);
+INSERT INTO sales VALUES (2082, 5033, 221.125);
+INSERT INTO sales VALUES (2083, 5181, 227.625);
+INSERT INTO sales VALUES (2084, 5329, 234.125);
+INSERT INTO sales VALUES (2085, 5477, 240.625);
+INSERT INTO sales VALUES (2086, 5625, 247.125);
+INSERT INTO sales VALUES (2087, 5773, 253.625);
+INSERT INTO sales VALUES (2088, 5921, 260.125);
+INSERT INTO sales VALUES (2089, 6069, 266.625);
+INSERT INTO sales VALUES (2090, 6217, 273.125);
+INSERT INTO sales VALUES (2091, 6365, 279.625);
+INSERT INTO sales VALUES (2092, 6513, 286.125);
+INSERT INTO sales VALUES (2093, 6661, 292.625);
+INSERT INTO sales VALUES (2094, 6809, 299.125);
+INSERT INTO sales VALUES (2095, 6957, 305.625);
+INSERT INTO sales VALUES (2096, 7105, 312.125);
+INSERT INTO sales VALUES (2097, 7253, 318.625);
+INSERT INTO sales VALUES (2098, 7401, 325.125);
+INSERT INTO sales VALUES (2099, 7549, 331.625);
+INSERT INTO sales VALUES (2100, 7697, 338.125);
+INSERT INTO sales VALUES (2101, 7845, 344.625);
+INSERT INTO sales VALUES (2102, 7993, 351.125);
+INSERT INTO sales VALUES (2103, 8141, 357.625);
+INSERT INTO sales VALUES (2104, 97, 364.125);
+INSERT INTO sales VALUES (2105, 245, 370.625);
+INSERT INTO sales VALUES (2106, 393, 377.125);
+INSERT INTO sales VALUES (2107, 541, 383.625);
+INSERT INTO sales VALUES (2108, 689, 390.125);
+INSERT INTO sales VALUES (2109, 837, 396.625);
+INSERT INTO sales VALUES (2110, 985, 403.125);
+INSERT INTO sales VALUES (2111, 1133, 409.625);
+INSERT INTO sales VALUES (2112, 1281, 416.125);
+INSERT INTO sales VALUES (2113, 1429, 422.625);
+INSERT INTO sales VALUES (2114, 1577, 429.125);
+INSERT INTO sales VALUES (2115, 1725, 435.625);
+INSERT INTO sales VALUES (2116, 1873, 442.125);
+INSERT INTO sales VALUES (2117, 2021, 448.625);
+INSERT INTO sales VALUES (2118, 2169, 455.125);
+INSERT INTO sales VALUES (2119, 2317, 461.625);
+INSERT INTO sales VALUES (2120, 2465, 468.125);
+INSERT INTO sales VALUES (2121, 2613, 474.625);
+INSERT INTO sales VALUES (2122, 2761, 481.125);
+INSERT INTO sales VALUES (2123, 2909, 487.625);
+INSERT INTO sales VALUES (2124, 3057, 494.125);
+INSERT INTO sales VALUES (2125, 3205, 500.625);
+INSERT INTO sales VALUES (2126, 3353, 507.125);
+INSERT INTO sales VALUES (2127, 3501, 513.625);
+INSERT INTO sales VALUES (2128, 3649, 520.125);
+INSERT INTO sales VALUES (2129, 3797, 526.625);
+INSERT INTO sales VALUES (2130, 3945, 533.125);
+INSERT INTO sales VALUES (2131, 4093, 539.625);
+INSERT INTO sales VALUES (2132, 4241, 546.125);
+INSERT INTO sales VALUES (2133, 4389, 552.625);
+INSERT INTO sales VALUES (2134, 4537, 559.125);
+INSERT INTO sales VALUES (2135, 4685, 565.625);
+INSERT INTO sales VALUES (2136, 4833, 572.125);
+INSERT INTO sales VALUES (2137, 4981, 578.625);
+INSERT INTO sales VALUES (2138, 5129, 585.125);
+INSERT INTO sales VALUES (2139, 5277, 591.625);
+INSERT INTO sales VALUES (2140, 5425, 598.125);
+INSERT INTO sales VALUES (2141, 5573, 604.625);
+INSERT INTO sales VALUES (2142, 5721, 611.125);
+INSERT INTO sales VALUES (2143, 5869, 617.625);
+INSERT INTO sales VALUES (2144, 6017, 624.125);
+INSERT INTO sales VALUES (2145, 6165, 630.625);
+INSERT INTO sales VALUES (2146, 6313, 637.125);
+INSERT INTO sales VALUES (2147, 6461, 643.625);
+INSERT INTO sales VALUES (2148, 6609, 650.125);
+INSERT INTO sales VALUES (2149, 6757, 656.625);
+INSERT INTO sales VALUES (2150, 6905, 663.125);
+INSERT INTO sales VALUES (2151, 7053, 669.625);
+INSERT INTO sales VALUES (2152, 7201, 676.125);
+INSERT INTO sales VALUES (2153, 7349, 682.625);
+INSERT INTO sales VALUES (2154, 7497, 689.125);
+INSERT INTO sales VALUES (2155, 7645, 695.625);
+INSERT INTO sales VALUES (2156, 7793, 702.125);
+INSERT INTO sales VALUES (2157, 7941, 708.625);
+INSERT INTO sales VALUES (2158, 8089, 715.125);
+INSERT INTO sales VALUES (2159, 45, 721.625);
+INSERT INTO sales VALUES (2160, 193, 728.125);
+INSERT INTO sales VALUES (2161, 341, 734.625);
+INSERT INTO sales VALUES (2162, 489, 741.125);
+INSERT INTO sales VALUES (2163, 637, 747.625);
+INSERT INTO sales VALUES (2164, 785, 754.125);
+INSERT INTO sales VALUES (2165, 933, 760.625);
+INSERT INTO sales VALUES (2166, 1081, 767.125);
+INSERT INTO sales VALUES (2167, 1229, 773.625);
+INSERT INTO sales VALUES (2168, 1377, 780.125);
+INSERT INTO sales VALUES (2169, 1525, 786.625);
+INSERT INTO sales VALUES (2170, 1673, 793.125);
+INSERT INTO sales VALUES (2171, 1821, 799.625);
+INSERT INTO sales VALUES (2172, 1969, 806.125);
+INSERT INTO sales VALUES (2173, 2117, 812.625);
+INSERT INTO sales VALUES (2174, 2265, 819.125);
+INSERT INTO sales VALUES (2175, 2413, 825.625);
+INSERT INTO sales VALUES (2176, 2561, 832.125);
+INSERT INTO sales VALUES (2177, 2709, 838.625);
+INSERT INTO sales VALUES (2178, 2857, 845.125);
+INSERT INTO sales VALUES (2179, 3005, 851.625);
+INSERT INTO sales VALUES (2180, 3153, 858.125);
+INSERT INTO sales VALUES (2181, 3301, 864.625);
+INSERT INTO sales VALUES (2182, 3449, 871.125);
+INSERT INTO sales VALUES (2183, 3597, 877.625);
+INSERT INTO sales VALUES (2184, 3745, 884.125);
+INSERT INTO sales VALUES (2185, 3893, 890.625);
+INSERT INTO sales VALUES (2186, 4041, 897.125);
+INSERT INTO sales VALUES (2187, 4189, 903.625);
+INSERT INTO sales VALUES (2188, 4337, 910.125);
+INSERT INTO sales VALUES (2189, 4485, 916.625);
+INSERT INTO sales VALUES (2190, 4633, 923.125);
+INSERT INTO sales VALUES (2191, 4781, 929.625);
+INSERT INTO sales VALUES (2192, 4929, 936.125);
+INSERT INTO sales VALUES (2193, 5077, 942.625);
+INSERT INTO sales VALUES (2194, 5225, 949.125);
+INSERT INTO sales VALUES (2195, 5373, 955.625);
+INSERT INTO sales VALUES (2196, 5521, 962.125);
+INSERT INTO sales VALUES (2197, 5669, 968.625);
+INSERT INTO sales VALUES (2198, 5817, 975.125);
+INSERT INTO sales VALUES (2199, 5965, 981.625);
+INSERT INTO sales VALUES (2200, 6113, 988.125);
+INSERT INTO sales VALUES (2201, 6261, 994.625);
+INSERT INTO sales VALUES (2202, 6409, 1001.125);
+INSERT INTO sales VALUES (2203, 6557, 1007.625);
+INSERT INTO sales VALUES (2204, 6705, 1014.125);
+INSERT INTO sales VALUES (2205, 6853, 1020.625);
+INSERT INTO sales VALUES (2206, 7001, 3.125);
+INSERT INTO sales VALUES (2207, 7149, 9.625);
+INSERT INTO sales VALUES (2208, 7297, 16.125);
+INSERT INTO sales VALUES (2209, 7445, 22.625);
+INSERT INTO sales VALUES (2210, 7593, 29.125);
+INSERT INTO sales VALUES (2211, 7741, 35.625);
+INSERT INTO sales VALUES (2212, 7889, 42.125);
+INSERT INTO sales VALUES (2213, 8037, 48.625);
+INSERT INTO sales VALUES (2214, 8185, 55.125);
+INSERT INTO sales VALUES (2215, 141, 61.625);
+INSERT INTO sales VALUES (2216, 289, 68.125);
+INSERT INTO sales VALUES (2217, 437, 74.625);
+INSERT INTO sales VALUES (2218, 585, 81.125);
+INSERT INTO sales VALUES (2219, 733, 87.625);
+INSERT INTO sales VALUES (2220, 881, 94.125);
+INSERT INTO sales VALUES (2221, 1029, 100.625);
+INSERT INTO sales VALUES (2222, 1177, 107.125);
+INSERT INTO sales VALUES (2223, 1325, 113.625);
+INSERT INTO sales VALUES (2224, 1473, 120.125);
+INSERT INTO sales VALUES (2225, 1621, 126.625);
+INSERT INTO sales VALUES (2226, 1769, 133.125);
+INSERT INTO sales VALUES (2227, 1917, 139.625);
+INSERT INTO sales VALUES (2228, 2065, 146.125);
+INSERT INTO sales VALUES (2229, 2213, 152.625);
+INSERT INTO sales VALUES (2230, 2361, 159.125);
+INSERT INTO sales VALUES (2231, 2509, 165.625);
+INSERT INTO sales VALUES (2232, 2657, 172.125);
+INSERT INTO sales VALUES (2233, 2805, 178.625);
+INSERT INTO sales VALUES (2234, 2953, 185.125);
+INSERT INTO sales VALUES (2235, 3101, 191.625);
+INSERT INTO sales VALUES (2236, 3249, 198.125);
+INSERT INTO sales VALUES (2237, 3397, 204.625);
+INSERT INTO sales VALUES (2238, 3545, 211.125);
+INSERT INTO sales VALUES (2239, 3693, 217.625);
+INSERT INTO sales VALUES (2240, 3841, 224.125);
+INSERT INTO sales VALUES (2241, 3989, 230.625);
+INSERT INTO sales VALUES (2242, 4137, 237.125);
+INSERT INTO sales VALUES (2243, 4285, 243.625);
+INSERT INTO sales VALUES (2244, 4433, 250.125);
+INSERT INTO sales VALUES (2245, 4581, 256.625);
+INSERT INTO sales VALUES (2246, 4729, 263.125);
+INSERT INTO sales VALUES (2247, 4877, 269.625);
+INSERT INTO sales VALUES (2248, 5025, 276.125);
+INSERT INTO sales VALUES (2249, 5173, 282.625);
+INSERT INTO sales VALUES (2250, 5321, 289.125);
+INSERT INTO sales VALUES (2251, 5469, 295.625);
+INSERT INTO sales VALUES (2252, 5617, 302.125);
+INSERT INTO sales VALUES (2253, 5765, 308.625);
+INSERT INTO sales VALUES (2254, 5913, 315.125);
+INSERT INTO sales VALUES (2255, 6061, 321.625);
+INSERT INTO sales VALUES (2256, 6209, 328.125);
+INSERT INTO sales VALUES (2257, 6357, 334.625);
+INSERT INTO sales VALUES (2258, 6505, 341.125);
+INSERT INTO sales VALUES (2259, 6653, 347.625);
+INSERT INTO sales VALUES (2260, 6801, 354.125);
+INSERT INTO sales VALUES (2261, 6949, 360.625);
+INSERT INTO sales VALUES (2262, 7097, 367.125);
+INSERT INTO sales VALUES (2263, 7245, 373.625);
+INSERT INTO sales VALUES (2264, 7393, 380.125);
+INSERT INTO sales VALUES (2265, 7541, 386.625);
+INSERT INTO sales VALUES (2266, 7689, 393.125);
+INSERT INTO sales VALUES (2267, 7837, 399.625);
+INSERT INTO sales VALUES (2268, 7985, 406.125);
+INSERT INTO sales VALUES (2269, 8133, 412.625);
+INSERT INTO sales VALUES (2270, 89, 419.125);
+INSERT INTO sales VALUES (2271, 237, 425.625);
+INSERT INTO sales VALUES (2272, 385, 432.125);
+INSERT INTO sales VALUES (2273, 533, 438.625);
+INSERT INTO sales VALUES (2274, 681, 445.125);
+INSERT INTO sales VALUES (2275, 829, 451.625);
+INSERT INTO sales VALUES (2276, 977, 458.125);
+INSERT INTO sales VALUES (2277, 1125, 464.625);
+INSERT INTO sales VALUES (2278, 1273, 471.125);
+INSERT INTO sales VALUES (2279, 1421, 477.625);
+INSERT INTO sales VALUES (2280, 1569, 484.125);
+INSERT INTO sales VALUES (2281, 1717, 490.625);
+INSERT INTO sales VALUES (2282, 1865, 497.125);
+INSERT INTO sales VALUES (2283, 2013, 503.625);
+INSERT INTO sales VALUES (2284, 2161, 510.125);
+INSERT INTO sales VALUES (2285, 2309, 516.625);
+INSERT INTO sales VALUES (2286, 2457, 523.125);
+INSERT INTO sales VALUES (2287, 2605, 529.625);
+INSERT INTO sales VALUES (2288, 2753, 536.125);
+INSERT INTO sales VALUES (2289, 2901, 542.625);
+INSERT INTO sales VALUES (2290, 3049, 549.125);
+INSERT INTO sales VALUES (2291, 3197, 555.625);
+INSERT INTO sales VALUES (2292, 3345, 562.125);
+INSERT INTO sales VALUES (2293, 3493, 568.625);
+INSERT INTO sales VALUES (2294, 3641, 575.125);
+INSERT INTO sales VALUES (2295, 3789, 581.625);
+INSERT INTO sales VALUES (2296, 3937, 588.125);
+INSERT INTO sales VALUES (2297, 4085, 594.625);
+INSERT INTO sales VALUES (2298, 4233, 601.125);
+INSERT INTO sales VALUES (2299, 4381, 607.625);
+INSERT INTO sales VALUES (2300, 4529, 614.125);
+INSERT INTO sales VALUES (2301, 4677, 620.625);
+INSERT INTO sales VALUES (2302, 4825, 627.125);
+INSERT INTO sales VALUES (2303, 4973, 633.625);
+INSERT INTO sales VALUES (2304, 5121, 640.125);
+INSERT INTO sales VALUES (2305, 5269, 646.625);
+INSERT INTO sales VALUES (2306, 5417, 653.125);
+INSERT INTO sales VALUES (2307, 5565, 659.625);
+INSERT INTO sales VALUES (2308, 5713, 666.125);
+INSERT INTO sales VALUES (2309, 5861, 672.625);
+INSERT INTO sales VALUES (2310, 6009, 679.125);
+INSERT INTO sales VALUES (2311, 6157, 685.625);
+INSERT INTO sales VALUES (2312, 6305, 692.125);
+INSERT INTO sales VALUES (2313, 6453, 698.625);
+INSERT INTO sales VALUES (2314, 6601, 705.125);
+INSERT INTO sales VALUES (2315, 6749, 711.625);
+INSERT INTO sales VALUES (2316, 6897, 718.125);
+INSERT INTO sales VALUES (2317, 7045, 724.625);
+INSERT INTO sales VALUES (2318, 7193, 731.125);
+INSERT INTO sales VALUES (2319, 7341, 737.625);
+INSERT INTO sales VALUES (2320, 7489, 744.125);
+INSERT INTO sales VALUES (2321, 7637, 750.625);
+INSERT INTO sales VALUES (2322, 7785, 757.125);
+INSERT INTO sales VALUES (2323, 7933, 763.625);
+INSERT INTO sales VALUES (2324, 8081, 770.125);
+INSERT INTO sales VALUES (2325, 37, 776.625);
+INSERT INTO sales VALUES (2326, 185, 783.125);
+INSERT INTO sales VALUES (2327, 333, 789.625);
+INSERT INTO sales VALUES (2328, 481, 796.125);
+INSERT INTO sales VALUES (2329, 629, 802.625);
+INSERT INTO sales VALUES (2330, 777, 809.125);
+INSERT INTO sales VALUES (2331, 925, 815.625);
+INSERT INTO sales VALUES (2332, 1073, 822.125);
+INSERT INTO sales VALUES (2333, 1221, 828.625);
+INSERT INTO sales VALUES (2334, 1369, 835.125);
+INSERT INTO sales VALUES (2335, 1517, 841.625);
+INSERT INTO sales VALUES (2336, 1665, 848.125);
+INSERT INTO sales VALUES (2337, 1813, 854.625);
+INSERT INTO sales VALUES (2338, 1961, 861.125);
+INSERT INTO sales VALUES (2339, 2109, 867.625);
+INSERT INTO sales VALUES (2340, 2257, 874.125);
+INSERT INTO sales VALUES (2341, 2405, 880.625);
+INSERT INTO sales VALUES (2342, 2553, 887.125);
+INSERT INTO sales VALUES (2343, 2701, 893.625);
+INSERT INTO sales VALUES (2344, 2849, 900.125);
+INSERT INTO sales VALUES (2345, 2997, 906.625);
+INSERT INTO sales VALUES (2346, 3145, 913.125);
+INSERT INTO sales VALUES (2347, 3293, 919.625);
+INSERT INTO sales VALUES (2348, 3441, 926.125);
+INSERT INTO sales VALUES (2349, 3589, 932.625);
+INSERT INTO sales VALUES (2350, 3737, 939.125);
+INSERT INTO sales VALUES (2351, 3885, 945.625);
+INSERT INTO sales VALUES (2352, 4033, 952.125);
+INSERT INTO sales VALUES (2353, 4181, 958.625);
+INSERT INTO sales VALUES (2354, 4329, 965.125);
+INSERT INTO sales VALUES (2355, 4477, 971.625);
+INSERT INTO sales VALUES (2356, 4625, 978.125);
+INSERT INTO sales VALUES (2357, 4773, 984.625);
+INSERT INTO sales VALUES (2358, 4921, 991.125);
+INSERT INTO sales VALUES (2359, 5069, 997.625);
+INSERT INTO sales VALUES (2360, 5217, 1004.125);
+INSERT INTO sales VALUES (2361, 5365, 1010.625);
+INSERT INTO sales VALUES (2362, 5513, 1017.125);
+INSERT INTO sales VALUES (2363, 5661, 1023.625);
+INSERT INTO sales VALUES (2364, 5809, 6.125);
+INSERT INTO sales VALUES (2365, 5957, 12.625);
+INSERT INTO sales VALUES (2366, 6105, 19.125);
+INSERT INTO sales VALUES (2367, 6253, 25.625);
+INSERT INTO sales VALUES (2368, 6401, 32.125);
+INSERT INTO sales VALUES (2369, 6549, 38.625);
+INSERT INTO sales VALUES (2370, 6697, 45.125);
+INSERT INTO sales VALUES (2371, 6845, 51.625);
+INSERT INTO sales VALUES (2372, 6993, 58.125);
+INSERT INTO sales VALUES (2373, 7141, 64.625);
+INSERT INTO sales VALUES (2374, 7289, 71.125);
+INSERT INTO sales VALUES (2375, 7437, 77.625);
+INSERT INTO sales VALUES (2376, 7585, 84.125);
+INSERT INTO sales VALUES (2377, 7733, 90.625);
+INSERT INTO sales VALUES (2378, 7881, 97.125);
+INSERT INTO sales VALUES (2379, 8029, 103.625);
+INSERT INTO sales VALUES (2380, 8177, 110.125);
+INSERT INTO sales VALUES (2381, 133, 116.625);
+INSERT INTO sales VALUES (2382, 281, 123.125);
+INSERT INTO sales VALUES (2383, 429, 129.625);
+INSERT INTO sales VALUES (2384, 577, 136.125);
+INSERT INTO sales VALUES (2385, 725, 142.625);
+INSERT INTO sales VALUES (2386, 873, 149.125);
+INSERT INTO sales VALUES (2387, 1021, 155.625);
+INSERT INTO sales VALUES (2388, 1169, 162.125);
+INSERT INTO sales VALUES (2389, 1317, 168.625);
+INSERT INTO sales VALUES (2390, 1465, 175.125);
+INSERT INTO sales VALUES (2391, 1613, 181.625);
+INSERT INTO sales VALUES (2392, 1761, 188.125);
+INSERT INTO sales VALUES (2393, 1909, 194.625);
+INSERT INTO sales VALUES (2394, 2057, 201.125);
+INSERT INTO sales VALUES (2395, 2205, 207.625);
+INSERT INTO sales VALUES (2396, 2353, 214.125);
+INSERT INTO sales VALUES (2397, 2501, 220.625);
+INSERT INTO sales VALUES (2398, 2649, 227.125);
+INSERT INTO sales VALUES (2399, 2797, 233.625);
+INSERT INTO sales VALUES (2400, 2945, 240.125);
+INSERT INTO sales VALUES (2401, 3093, 246.625);
+INSERT INTO sales VALUES (2402, 3241, 253.125);
+INSERT INTO sales VALUES (2403, 3389, 259.625);
+INSERT INTO sales VALUES (2404, 3537, 266.125);
+INSERT INTO sales VALUES (2405, 3685, 272.625);
+INSERT INTO sales VALUES (2406, 3833, 279.125);
+INSERT INTO sales VALUES (2407, 3981, 285.625);
+INSERT INTO sales VALUES (2408, 4129, 292.125);
+INSERT INTO sales VALUES (2409, 4277, 298.625);
+INSERT INTO sales VALUES (2410, 4425, 305.125);
+INSERT INTO sales VALUES (2411, 4573, 311.625);
+INSERT INTO sales VALUES (2412, 4721, 318.125);
+INSERT INTO sales VALUES (2413, 4869, 324.625);
+INSERT INTO sales VALUES (2414, 5017, 331.125);
+INSERT INTO sales VALUES (2415, 5165, 337.625);
+INSERT INTO sales VALUES (2416, 5313, 344.125);
+INSERT INTO sales VALUES (2417, 5461, 350.625);
+INSERT INTO sales VALUES (2418, 5609, 357.125);
+INSERT INTO sales VALUES (2419, 5757, 363.625);
+INSERT INTO sales VALUES (2420, 5905, 370.125);
+INSERT INTO sales VALUES (2421, 6053, 376.625);
+INSERT INTO sales VALUES (2422, 6201, 383.125);
+INSERT INTO sales VALUES (2423, 6349, 389.625);
+INSERT INTO sales VALUES (2424, 6497, 396.125);
+INSERT INTO sales VALUES (2425, 6645, 402.625);
+INSERT INTO sales VALUES (2426, 6793, 409.125);
+INSERT INTO sales VALUES (2427, 6941, 415.625);
+INSERT INTO sales VALUES (2428, 7089, 422.125);
+INSERT INTO sales VALUES (2429, 7237, 428.625);
+INSERT INTO sales VALUES (2430, 7385, 435.125);
+INSERT INTO sales VALUES (2431, 7533, 441.625);
+INSERT INTO sales VALUES (2432, 7681, 448.125);
+INSERT INTO sales VALUES (2433, 7829, 454.625);
+INSERT INTO sales VALUES (2434, 7977, 461.125);
+INSERT INTO sales VALUES (2435, 8125, 467.625);
+INSERT INTO sales VALUES (2436, 81, 474.125);
+INSERT INTO sales VALUES (2437, 229, 480.625);
+INSERT INTO sales VALUES (2438, 377, 487.125);
+INSERT INTO sales VALUES (2439, 525, 493.625);
+INSERT INTO sales VALUES (2440, 673, 500.125);
+INSERT INTO sales VALUES (2441, 821, 506.625);
+INSERT INTO sales VALUES (2442, 969, 513.125);
+INSERT INTO sales VALUES (2443, 1117, 519.625);
+INSERT INTO sales VALUES (2444, 1265, 526.125);
+INSERT INTO sales VALUES (2445, 1413, 532.625);
+INSERT INTO sales VALUES (2446, 1561, 539.125);
+INSERT INTO sales VALUES (2447, 1709, 545.625);
+INSERT INTO sales VALUES (2448, 1857, 552.125);
+INSERT INTO sales VALUES (2449, 2005, 558.625);
+INSERT INTO sales VALUES (2450, 2153, 565.125);
+INSERT INTO sales VALUES (2451, 2301, 571.625);
+INSERT INTO sales VALUES (2452, 2449, 578.125);
+INSERT INTO sales VALUES (2453, 2597, 584.625);
+INSERT INTO sales VALUES (2454, 2745, 591.125);
+INSERT INTO sales VALUES (2455, 2893, 597.625);
+INSERT INTO sales VALUES (2456, 3041, 604.125);
+INSERT INTO sales VALUES (2457, 3189, 610.625);
+INSERT INTO sales VALUES (2458, 3337, 617.125);
+INSERT INTO sales VALUES (2459, 3485, 623.625);
+INSERT INTO sales VALUES (2460, 3633, 630.125);
+INSERT INTO sales VALUES (2461, 3781, 636.625);
+INSERT INTO sales VALUES (2462, 3929, 643.125);
+INSERT INTO sales VALUES (2463, 4077, 649.625);
+INSERT INTO sales VALUES (2464, 4225, 656.125);
+INSERT INTO sales VALUES (2465, 4373, 662.625);
+INSERT INTO sales VALUES (2466, 4521, 669.125);
+INSERT INTO sales VALUES (2467, 4669, 675.625);
+INSERT INTO sales VALUES (2468, 4817, 682.125);
+INSERT INTO sales VALUES (2469, 4965, 688.625);
+INSERT INTO sales VALUES (2470, 5113, 695.125);
+INSERT INTO sales VALUES (2471, 5261, 701.625);
+INSERT INTO sales VALUES (2472, 5409, 708.125);
+INSERT INTO sales VALUES (2473, 5557, 714.625);
+INSERT INTO sales VALUES (2474, 5705, 721.125);
+INSERT INTO sales VALUES (2475, 5853, 727.625);
+INSERT INTO sales VALUES (2476, 6001, 734.125);
+INSERT INTO sales VALUES (2477, 6149, 740.625);
+INSERT INTO sales VALUES (2478, 6297, 747.125);
+INSERT INTO sales VALUES (2479, 6445, 753.625);
+INSERT INTO sales VALUES (2480, 6593, 760.125);
+INSERT INTO sales VALUES (2481, 6741, 766.625);
+INSERT INTO sales VALUES (2482, 6889, 773.125);
+INSERT INTO sales VALUES (2483, 7037, 779.625);
+INSERT INTO sales VALUES (2484, 7185, 786.125);
+INSERT INTO sales VALUES (2485, 7333, 792.625);
+INSERT INTO sales VALUES (2486, 7481, 799.125);
+INSERT INTO sales VALUES (2487, 7629, 805.625);
+INSERT INTO sales VALUES (2488, 7777, 812.125);
+INSERT INTO sales VALUES (2489, 7925, 818.625);
+INSERT INTO sales VALUES (2490, 8073, 825.125);
+INSERT INTO sales VALUES (2491, 29, 831.625);
+INSERT INTO sales VALUES (2492, 177, 838.125);
+INSERT INTO sales VALUES (2493, 325, 844.625);
+INSERT INTO sales VALUES (2494, 473, 851.125);
+INSERT INTO sales VALUES (2495, 621, 857.625);
+INSERT INTO sales VALUES (2496, 769, 864.125);
+INSERT INTO sales VALUES (2497, 917, 870.625);
+INSERT INTO sales VALUES (2498, 1065, 877.125);
+INSERT INTO sales VALUES (2499, 1213, 883.625);
+INSERT INTO sales VALUES (2500, 1361, 890.125);
+INSERT INTO sales VALUES (2501, 1509, 896.625);
+INSERT INTO sales VALUES (2502, 1657, 903.125);
+INSERT INTO sales VALUES (2503, 1805, 909.625);
+INSERT INTO sales VALUES (2504, 1953, 916.125);
+INSERT INTO sales VALUES (2505, 2101, 922.625);
+INSERT INTO sales VALUES (2506, 2249, 929.125);
+INSERT INTO sales VALUES (2507, 2397, 935.625);
+INSERT INTO sales VALUES (2508, 2545, 942.125);
+INSERT INTO sales VALUES (2509, 2693, 948.625);
+INSERT INTO sales VALUES (2510, 2841, 955.125);
+INSERT INTO sales VALUES (2511, 2989, 961.625);
+INSERT INTO sales VALUES (2512, 3137, 968.125);
+INSERT INTO sales VALUES (2513, 3285, 974.625);
+INSERT INTO sales VALUES (2514, 3433, 981.125);
+INSERT INTO sales VALUES (2515, 3581, 987.625);
+INSERT INTO sales VALUES (2516, 3729, 994.125);
+INSERT INTO sales VALUES (2517, 3877, 1000.625);
+INSERT INTO sales VALUES (2518, 4025, 1007.125);
+INSERT INTO sales VALUES (2519, 4173, 1013.625);
+INSERT INTO sales VALUES (2520, 4321, 1020.125);
+INSERT INTO sales VALUES (2521, 4469, 2.625);
+INSERT INTO sales VALUES (2522, 4617, 9.125);
+INSERT INTO sales VALUES (2523, 4765, 15.625);
+INSERT INTO sales VALUES (2524, 4913, 22.125);
+INSERT INTO sales VALUES (2525, 5061, 28.625);
+INSERT INTO sales VALUES (2526, 5209, 35.125);
+INSERT INTO sales VALUES (2527, 5357, 41.625);
+INSERT INTO sales VALUES (2528, 5505, 48.125);
+INSERT INTO sales VALUES (2529, 5653, 54.625);
+INSERT INTO sales VALUES (2530, 5801, 61.125);
+INSERT INTO sales VALUES (2531, 5949, 67.625);
+INSERT INTO sales VALUES (2532, 6097, 74.125);
+INSERT INTO sales VALUES (2533, 6245, 80.625);
+INSERT INTO sales VALUES (2534, 6393, 87.125);
+INSERT INTO sales VALUES (2535, 6541, 93.625);
+INSERT INTO sales VALUES (2536, 6689, 100.125);
+INSERT INTO sales VALUES (2537, 6837, 106.625);
+INSERT INTO sales VALUES (2538, 6985, 113.125);
+INSERT INTO sales VALUES (2539, 7133, 119.625);
+INSERT INTO sales VALUES (2540, 7281, 126.125);
+INSERT INTO sales VALUES (2541, 7429, 132.625);
+INSERT INTO sales VALUES (2542, 7577, 139.125);
+INSERT INTO sales VALUES (2543, 7725, 145.625);
+INSERT INTO sales VALUES (2544, 7873, 152.125);
+INSERT INTO sales VALUES (2545, 8021, 158.625);
+INSERT INTO sales VALUES (2546, 8169, 165.125);
+INSERT INTO sales VALUES (2547, 125, 171.625);
+INSERT INTO sales VALUES (2548, 273, 178.125);
+INSERT INTO sales VALUES (2549, 421, 184.625);
+INSERT INTO sales VALUES (2550, 569, 191.125);
+INSERT INTO sales VALUES (2551, 717, 197.625);
+INSERT INTO sales VALUES (2552, 865, 204.125);
+INSERT INTO sales VALUES (2553, 1013, 210.625);
+INSERT INTO sales VALUES (2554, 1161, 217.125);
+INSERT INTO sales VALUES (2555, 1309, 223.625);
+INSERT INTO sales VALUES (2556, 1457, 230.125);
+INSERT INTO sales VALUES (2557, 1605, 236.625);
+INSERT INTO sales VALUES (2558, 1753, 243.125);
+INSERT INTO sales VALUES (2559, 1901, 249.625);
+INSERT INTO sales VALUES (2560, 2049, 256.125);
+INSERT INTO sales VALUES (2561, 2197, 262.625);
+INSERT INTO sales VALUES (2562, 2345, 269.125);
+INSERT INTO sales VALUES (2563, 2493, 275.625);
+INSERT INTO sales VALUES (2564, 2641, 282.125);
+INSERT INTO sales VALUES (2565, 2789, 288.625);
+INSERT INTO sales VALUES (2566, 2937, 295.125);
+INSERT INTO sales VALUES (2567, 3085, 301.625);
+INSERT INTO sales VALUES (2568, 3233, 308.125);
+INSERT INTO sales VALUES (2569, 3381, 314.625);
+INSERT INTO sales VALUES (2570, 3529, 321.125);
+INSERT INTO sales VALUES (2571, 3677, 327.625);
+INSERT INTO sales VALUES (2572, 3825, 334.125);
+INSERT INTO sales VALUES (2573, 3973, 340.625);
+INSERT INTO sales VALUES (2574, 4121, 347.125);
+INSERT INTO sales VALUES (2575, 4269, 353.625);
+INSERT INTO sales VALUES (2576, 4417, 360.125);
+INSERT INTO sales VALUES (2577, 4565, 366.625);
+INSERT INTO sales VALUES (2578, 4713, 373.125);
+INSERT INTO sales VALUES (2579, 4861, 379.625);
+INSERT INTO sales VALUES (2580, 5009, 386.125);
+INSERT INTO sales VALUES (2581, 5157, 392.625);
+INSERT INTO sales VALUES (2582, 5305, 399.125);
+INSERT INTO sales VALUES (2583, 5453, 405.625);
+INSERT INTO sales VALUES (2584, 5601, 412.125);
+INSERT INTO sales VALUES (2585, 5749, 418.625);
+INSERT INTO sales VALUES (2586, 5897, 425.125);
+INSERT INTO sales VALUES (2587, 6045, 431.625);
+INSERT INTO sales VALUES (2588, 6193, 438.125);
+INSERT INTO sales VALUES (2589, 6341, 444.625);
+INSERT INTO sales VALUES (2590, 6489, 451.125);
+INSERT INTO sales VALUES (2591, 6637, 457.625);
+INSERT INTO sales VALUES (2592, 6785, 464.125);
+INSERT INTO sales VALUES (2593, 6933, 470.625);
+INSERT INTO sales VALUES (2594, 7081, 477.125);
+INSERT INTO sales VALUES (2595, 7229, 483.625);
+INSERT INTO sales VALUES (2596, 7377, 490.125);
+INSERT INTO sales VALUES (2597, 7525, 496.625);
+INSERT INTO sales VALUES (2598, 7673, 503.125);
+INSERT INTO sales VALUES (2599, 7821, 509.625);
+INSERT INTO sales VALUES (2600, 7969, 516.125);
+INSERT INTO sales VALUES (2601, 8117, 522.625);
+INSERT INTO sales VALUES (2602, 73, 529.125);
+INSERT INTO sales VALUES (2603, 221, 535.625);
+INSERT INTO sales VALUES (2604, 369, 542.125);
+INSERT INTO sales VALUES (2605, 517, 548.625);
+INSERT INTO sales VALUES (2606, 665, 555.125);
+INSERT INTO sales VALUES (2607, 813, 561.625);
+INSERT INTO sales VALUES (2608, 961, 568.125);
+INSERT INTO sales VALUES (2609, 1109, 574.625);
+INSERT INTO sales VALUES (2610, 1257, 581.125);
+INSERT INTO sales VALUES (2611, 1405, 587.625);
+INSERT INTO sales VALUES (2612, 1553, 594.125);
+INSERT INTO sales VALUES (2613, 1701, 600.625);
+INSERT INTO sales VALUES (2614, 1849, 607.125);
+INSERT INTO sales VALUES (2615, 1997, 613.625);
+INSERT INTO sales VALUES (2616, 2145, 620.125);
+INSERT INTO sales VALUES (2617, 2293, 626.625);
+INSERT INTO sales VALUES (2618, 2441, 633.125);
+INSERT INTO sales VALUES (2619, 2589, 639.625);
+INSERT INTO sales VALUES (2620, 2737, 646.125);
+INSERT INTO sales VALUES (2621, 2885, 652.625);
+INSERT INTO sales VALUES (2622, 3033, 659.125);
+INSERT INTO sales VALUES (2623, 3181, 665.625);
+INSERT INTO sales VALUES (2624, 3329, 672.125);
+INSERT INTO sales VALUES (2625, 3477, 678.625);
+INSERT INTO sales VALUES (2626, 3625, 685.125);
+INSERT INTO sales VALUES (2627, 3773, 691.625);
+INSERT INTO sales VALUES (2628, 3921, 698.125);
+INSERT INTO sales VALUES (2629, 4069, 704.625);
+INSERT INTO sales VALUES (2630, 4217, 711.125);
+INSERT INTO sales VALUES (2631, 4365, 717.625);
+INSERT INTO sales VALUES (2632, 4513, 724.125);
+INSERT INTO sales VALUES (2633, 4661, 730.625);
+INSERT INTO sales VALUES (2634, 4809, 737.125);
+INSERT INTO sales VALUES (2635, 4957, 743.625);
+INSERT INTO sales VALUES (2636, 5105, 750.125);
+INSERT INTO sales VALUES (2637, 5253, 756.625);
+INSERT INTO sales VALUES (2638, 5401, 763.125);
+INSERT INTO sales VALUES (2639, 5549, 769.625);
+INSERT INTO sales VALUES (2640, 5697, 776.125);
+INSERT INTO sales VALUES (2641, 5845, 782.625);
+INSERT INTO sales VALUES (2642, 5993, 789.125);
+INSERT INTO sales VALUES (2643, 6141, 795.625);
+INSERT INTO sales VALUES (2644, 6289, 802.125);
+INSERT INTO sales VALUES (2645, 6437, 808.625);
+INSERT INTO sales VALUES (2646, 6585, 815.125);
+INSERT INTO sales VALUES (2647, 6733, 821.625);
+INSERT INTO sales VALUES (2648, 6881, 828.125);
+INSERT INTO sales VALUES (2649, 7029, 834.625);
+INSERT INTO sales VALUES (2650, 7177, 841.125);
+INSERT INTO sales VALUES (2651, 7325, 847.625);
+INSERT INTO sales VALUES (2652, 7473, 854.125);
+INSERT INTO sales VALUES (2653, 7621, 860.625);
+INSERT INTO sales VALUES (2654, 7769, 867.125);
+INSERT INTO sales VALUES (2655, 7917, 873.625);
+INSERT INTO sales VALUES (2656, 8065, 880.125);
+INSERT INTO sales VALUES (2657, 21, 886.625);
+INSERT INTO sales VALUES (2658, 169, 893.125);
+INSERT INTO sales VALUES (2659, 317, 899.625);
+INSERT INTO sales VALUES (2660, 465, 906.125);
+INSERT INTO sales VALUES (2661, 613, 912.625);
+INSERT INTO sales VALUES (2662, 761, 919.125);
+INSERT INTO sales VALUES (2663, 909, 925.625);
+INSERT INTO sales VALUES (2664, 1057, 932.125);
+INSERT INTO sales VALUES (2665, 1205, 938.625);
+INSERT INTO sales VALUES (2666, 1353, 945.125);
+INSERT INTO sales VALUES (2667, 1501, 951.625);
+INSERT INTO sales VALUES (2668, 1649, 958.125);
+INSERT INTO sales VALUES (2669, 1797, 964.625);
+INSERT INTO sales VALUES (2670, 1945, 971.125);
+INSERT INTO sales VALUES (2671, 2093, 977.625);
+INSERT INTO sales VALUES (2672, 2241, 984.125);
+INSERT INTO sales VALUES (2673, 2389, 990.625);
+INSERT INTO sales VALUES (2674, 2537, 997.125);
+INSERT INTO sales VALUES (2675, 2685, 1003.625);
+INSERT INTO sales VALUES (2676, 2833, 1010.125);
+INSERT INTO sales VALUES (2677, 2981, 1016.625);
+INSERT INTO sales VALUES (2678, 3129, 1023.125);
+INSERT INTO sales VALUES (2679, 3277, 5.625);
+INSERT INTO sales VALUES (2680, 3425, 12.125);
+INSERT INTO sales VALUES (2681, 3573, 18.625);
+INSERT INTO sales VALUES (2682, 3721, 25.125);
+INSERT INTO sales VALUES (2683, 3869, 31.625);
+INSERT INTO sales VALUES (2684, 4017, 38.125);
+INSERT INTO sales VALUES (2685, 4165, 44.625);
+INSERT INTO sales VALUES (2686, 4313, 51.125);
+INSERT INTO sales VALUES (2687, 4461, 57.625);
+INSERT INTO sales VALUES (2688, 4609, 64.125);
+INSERT INTO sales VALUES (2689, 4757, 70.625);
+INSERT INTO sales VALUES (2690, 4905, 77.125);
+INSERT INTO sales VALUES (2691, 5053, 83.625);
+INSERT INTO sales VALUES (2692, 5201, 90.125);
+INSERT INTO sales VALUES (2693, 5349, 96.625);
+INSERT INTO sales VALUES (2694, 5497, 103.125);
+INSERT INTO sales VALUES (2695, 5645, 109.625);
+INSERT INTO sales VALUES (2696, 5793, 116.125);
+INSERT INTO sales VALUES (2697, 5941, 122.625);
+INSERT INTO sales VALUES (2698, 6089, 129.125);
+INSERT INTO sales VALUES (2699, 6237, 135.625);
+INSERT INTO sales VALUES (2700, 6385, 142.125);
+INSERT INTO sales VALUES (2701, 6533, 148.625);
+INSERT INTO sales VALUES (2702, 6681, 155.125);
+INSERT INTO sales VALUES (2703, 6829, 161.625);
+INSERT INTO sales VALUES (2704, 6977, 168.125);
+INSERT INTO sales VALUES (2705, 7125, 174.625);
+INSERT INTO sales VALUES (2706, 7273, 181.125);
+INSERT INTO sales VALUES (2707, 7421, 187.625);
+INSERT INTO sales VALUES (2708, 7569, 194.125);
+INSERT INTO sales VALUES (2709, 7717, 200.625);
+INSERT INTO sales VALUES (2710, 7865, 207.125);
+INSERT INTO sales VALUES (2711, 8013, 213.625);
+INSERT INTO sales VALUES (2712, 8161, 220.125);
+INSERT INTO sales VALUES (2713, 117, 226.625);
+INSERT INTO sales VALUES (2714, 265, 233.125);
+INSERT INTO sales VALUES (2715, 413, 239.625);
+INSERT INTO sales VALUES (2716, 561, 246.125);
+INSERT INTO sales VALUES (2717, 709, 252.625);
+INSERT INTO sales VALUES (2718, 857, 259.125);
+INSERT INTO sales VALUES (2719, 1005, 265.625);
+INSERT INTO sales VALUES (2720, 1153, 272.125);
+INSERT INTO sales VALUES (2721, 1301, 278.625);
+INSERT INTO sales VALUES (2722, 1449, 285.125);
+INSERT INTO sales VALUES (2723, 1597, 291.625);
+INSERT INTO sales VALUES (2724, 1745, 298.125);
+INSERT INTO sales VALUES (2725, 1893, 304.625);
+INSERT INTO sales VALUES (2726, 2041, 311.125);
+INSERT INTO sales VALUES (2727, 2189, 317.625);
+INSERT INTO sales VALUES (2728, 2337, 324.125);
+INSERT INTO sales VALUES (2729, 2485, 330.625);
+INSERT INTO sales VALUES (2730, 2633, 337.125);
+INSERT INTO sales VALUES (2731, 2781, 343.625);
+INSERT INTO sales VALUES (2732, 2929, 350.125);
+INSERT INTO sales VALUES (2733, 3077, 356.625);
+INSERT INTO sales VALUES (2734, 3225, 363.125);
+INSERT INTO sales VALUES (2735, 3373, 369.625);
+INSERT INTO sales VALUES (2736, 3521, 376.125);
+INSERT INTO sales VALUES (2737, 3669, 382.625);
+INSERT INTO sales VALUES (2738, 3817, 389.125);
+INSERT INTO sales VALUES (2739, 3965, 395.625);
+INSERT INTO sales VALUES (2740, 4113, 402.125);
+INSERT INTO sales VALUES (2741, 4261, 408.625);
+INSERT INTO sales VALUES (2742, 4409, 415.125);
+INSERT INTO sales VALUES (2743, 4557, 421.625);
+INSERT INTO sales VALUES (2744, 4705, 428.125);
+INSERT INTO sales VALUES (2745, 4853, 434.625);
+INSERT INTO sales VALUES (2746, 5001, 441.125);
+INSERT INTO sales VALUES (2747, 5149, 447.625);
+INSERT INTO sales VALUES (2748, 5297, 454.125);
+INSERT INTO sales VALUES (2749, 5445, 460.625);
+INSERT INTO sales VALUES (2750, 5593, 467.125);
+INSERT INTO sales VALUES (2751, 5741, 473.625);
+INSERT INTO sales VALUES (2752, 5889, 480.125);
+INSERT INTO sales VALUES (2753, 6037, 486.625);
+INSERT INTO sales VALUES (2754, 6185, 493.125);
+INSERT INTO sales VALUES (2755, 6333, 499.625);
+INSERT INTO sales VALUES (2756, 6481, 506.125);
+INSERT INTO sales VALUES (2757, 6629, 512.625);
+INSERT INTO sales VALUES (2758, 6777, 519.125);
+INSERT INTO sales VALUES (2759, 6925, 525.625);
+INSERT INTO sales VALUES (2760, 7073, 532.125);
+INSERT INTO sales VALUES (2761, 7221, 538.625);
+INSERT INTO sales VALUES (2762, 7369, 545.125);
+INSERT INTO sales VALUES (2763, 7517, 551.625);
+INSERT INTO sales VALUES (2764, 7665, 558.125);
+INSERT INTO sales VALUES (2765, 7813, 564.625);
+INSERT INTO sales VALUES (2766, 7961, 571.125);
+INSERT INTO sales VALUES (2767, 8109, 577.625);
+INSERT INTO sales VALUES (2768, 65, 584.125);
+INSERT INTO sales VALUES (2769, 213, 590.625);
+INSERT INTO sales VALUES (2770, 361, 597.125);
+INSERT INTO sales VALUES (2771, 509, 603.625);
+INSERT INTO sales VALUES (2772, 657, 610.125);
+INSERT INTO sales VALUES (2773, 805, 616.625);
+INSERT INTO sales VALUES (2774, 953, 623.125);
+INSERT INTO sales VALUES (2775, 1101, 629.625);
+INSERT INTO sales VALUES (2776, 1249, 636.125);
+INSERT INTO sales VALUES (2777, 1397, 642.625);
+INSERT INTO sales VALUES (2778, 1545, 649.125);
+INSERT INTO sales VALUES (2779, 1693, 655.625);
+INSERT INTO sales VALUES (2780, 1841, 662.125);
+INSERT INTO sales VALUES (2781, 1989, 668.625);
+INSERT INTO sales VALUES (2782, 2137, 675.125);
+INSERT INTO sales VALUES (2783, 2285, 681.625);
+INSERT INTO sales VALUES (2784, 2433, 688.125);
+INSERT INTO sales VALUES (2785, 2581, 694.625);
+INSERT INTO sales VALUES (2786, 2729, 701.125);
+INSERT INTO sales VALUES (2787, 2877, 707.625);
+INSERT INTO sales VALUES (2788, 3025, 714.125);
+INSERT INTO sales VALUES (2789, 3173, 720.625);
+INSERT INTO sales VALUES (2790, 3321, 727.125);
+INSERT INTO sales VALUES (2791, 3469, 733.625);
+INSERT INTO sales VALUES (2792, 3617, 740.125);
+INSERT INTO sales VALUES (2793, 3765, 746.625);
+INSERT INTO sales VALUES (2794, 3913, 753.125);
+INSERT INTO sales VALUES (2795, 4061, 759.625);
+INSERT INTO sales VALUES (2796, 4209, 766.125);
+INSERT INTO sales VALUES (2797, 4357, 772.625);
+INSERT INTO sales VALUES (2798, 4505, 779.125);
+INSERT INTO sales VALUES (2799, 4653, 785.625);
+INSERT INTO sales VALUES (2800, 4801, 792.125);
+INSERT INTO sales VALUES (2801, 4949, 798.625);
+INSERT INTO sales VALUES (2802, 5097, 805.125);
+INSERT INTO sales VALUES (2803, 5245, 811.625);
+INSERT INTO sales VALUES (2804, 5393, 818.125);
+INSERT INTO sales VALUES (2805, 5541, 824.625);
+INSERT INTO sales VALUES (2806, 5689, 831.125);
+INSERT INTO sales VALUES (2807, 5837, 837.625);
+INSERT INTO sales VALUES (2808, 5985, 844.125);
+INSERT INTO sales VALUES (2809, 6133, 850.625);
+INSERT INTO sales VALUES (2810, 6281, 857.125);
+INSERT INTO sales VALUES (2811, 6429, 863.625);
+INSERT INTO sales VALUES (2812, 6577, 870.125);
+INSERT INTO sales VALUES (2813, 6725, 876.625);
+INSERT INTO sales VALUES (2814, 6873, 883.125);
+INSERT INTO sales VALUES (2815, 7021, 889.625);
+INSERT INTO sales VALUES (2816, 7169, 896.125);
+INSERT INTO sales VALUES (2817, 7317, 902.625);
+INSERT INTO sales VALUES (2818, 7465, 909.125);
+INSERT INTO sales VALUES (2819, 7613, 915.625);
+INSERT INTO sales VALUES (2820, 7761, 922.125);
+INSERT INTO sales VALUES (2821, 7909, 928.625);
+INSERT INTO sales VALUES (2822, 8057, 935.125);
+INSERT INTO sales VALUES (2823, 13, 941.625);
+INSERT INTO sales VALUES (2824, 161, 948.125);
+INSERT INTO sales VALUES (2825, 309, 954.625);
+INSERT INTO sales VALUES (2826, 457, 961.125);
+INSERT INTO sales VALUES (2827, 605, 967.625);
+INSERT INTO sales VALUES (2828, 753, 974.125);
+INSERT INTO sales VALUES (2829, 901, 980.625);
+INSERT INTO sales VALUES (2830, 1049, 987.125);
+INSERT INTO sales VALUES (2831, 1197, 993.625);
+INSERT INTO sales VALUES (2832, 1345, 1000.125);
+INSERT INTO sales VALUES (2833, 1493, 1006.625);
+INSERT INTO sales VALUES (2834, 1641, 1013.125);
+INSERT INTO sales VALUES (2835, 1789, 1019.625);
+INSERT INTO sales VALUES (2836, 1937, 2.125);
+INSERT INTO sales VALUES (2837, 2085, 8.625);
+INSERT INTO sales VALUES (2838, 2233, 15.125);
+INSERT INTO sales VALUES (2839, 2381, 21.625);
+INSERT INTO sales VALUES (2840, 2529, 28.125);
+INSERT INTO sales VALUES (2841, 2677, 34.625);
+INSERT INTO sales VALUES (2842, 2825, 41.125);
+INSERT INTO sales VALUES (2843, 2973, 47.625);
+INSERT INTO sales VALUES (2844, 3121, 54.125);
+INSERT INTO sales VALUES (2845, 3269, 60.625);
+INSERT INTO sales VALUES (2846, 3417, 67.125);
+INSERT INTO sales VALUES (2847, 3565, 73.625);
+INSERT INTO sales VALUES (2848, 3713, 80.125);
+INSERT INTO sales VALUES (2849, 3861, 86.625);
+INSERT INTO sales VALUES (2850, 4009, 93.125);
+INSERT INTO sales VALUES (2851, 4157, 99.625);
+INSERT INTO sales VALUES (2852, 4305, 106.125);
+INSERT INTO sales VALUES (2853, 4453, 112.625);
+INSERT INTO sales VALUES (2854, 4601, 119.125);
+INSERT INTO sales VALUES (2855, 4749, 125.625);
+INSERT INTO sales VALUES (2856, 4897, 132.125);
+INSERT INTO sales VALUES (2857, 5045, 138.625);
+INSERT INTO sales VALUES (2858, 5193, 145.125);
+INSERT INTO sales VALUES (2859, 5341, 151.625);
+INSERT INTO sales VALUES (2860, 5489, 158.125);
+INSERT INTO sales VALUES (2861, 5637, 164.625);
+INSERT INTO sales VALUES (2862, 5785, 171.125);
+INSERT INTO sales VALUES (2863, 5933, 177.625);
+INSERT INTO sales VALUES (2864, 6081, 184.125);
+INSERT INTO sales VALUES (2865, 6229, 190.625);
+INSERT INTO sales VALUES (2866, 6377, 197.125);
+INSERT INTO sales VALUES (2867, 6525, 203.625);
+INSERT INTO sales VALUES (2868, 6673, 210.125);
+INSERT INTO sales VALUES (2869, 6821, 216.625);
+INSERT INTO sales VALUES (2870, 6969, 223.125);
+INSERT INTO sales VALUES (2871, 7117, 229.625);
+INSERT INTO sales VALUES (2872, 7265, 236.125);
+INSERT INTO sales VALUES (2873, 7413, 242.625);
+INSERT INTO sales VALUES (2874, 7561, 249.125);
+INSERT INTO sales VALUES (2875, 7709, 255.625);
+INSERT INTO sales VALUES (2876, 7857, 262.125);
+INSERT INTO sales VALUES (2877, 8005, 268.625);
+INSERT INTO sales VALUES (2878, 8153, 275.125);
+INSERT INTO sales VALUES (2879, 109, 281.625);
+INSERT INTO sales VALUES (2880, 257, 288.125);
+INSERT INTO sales VALUES (2881, 405, 294.625);
+INSERT INTO sales VALUES (2882, 553, 301.125);
+INSERT INTO sales VALUES (2883, 701, 307.625);
+INSERT INTO sales VALUES (2884, 849, 314.125);
+INSERT INTO sales VALUES (2885, 997, 320.625);
+INSERT INTO sales VALUES (2886, 1145, 327.125);
+INSERT INTO sales VALUES (2887, 1293, 333.625);
+INSERT INTO sales VALUES (2888, 1441, 340.125);
+INSERT INTO sales VALUES (2889, 1589, 346.625);
+INSERT INTO sales VALUES (2890, 1737, 353.125);
+INSERT INTO sales VALUES (2891, 1885, 359.625);
+INSERT INTO sales VALUES (2892, 2033, 366.125);
+INSERT INTO sales VALUES (2893, 2181, 372.625);
+INSERT INTO sales VALUES (2894, 2329, 379.125);
+INSERT INTO sales VALUES (2895, 2477, 385.625);
+INSERT INTO sales VALUES (2896, 2625, 392.125);
+INSERT INTO sales VALUES (2897, 2773, 398.625);
+INSERT INTO sales VALUES (2898, 2921, 405.125);
+INSERT INTO sales VALUES (2899, 3069, 411.625);
+INSERT INTO sales VALUES (2900, 3217, 418.125);
+INSERT INTO sales VALUES (2901, 3365, 424.625);
+INSERT INTO sales VALUES (2902, 3513, 431.125);
+INSERT INTO sales VALUES (2903, 3661, 437.625);
+INSERT INTO sales VALUES (2904, 3809, 444.125);
+INSERT INTO sales VALUES (2905, 3957, 450.625);
+INSERT INTO sales VALUES (2906, 4105, 457.125);
+INSERT INTO sales VALUES (2907, 4253, 463.625);
+INSERT INTO sales VALUES (2908, 4401, 470.125);
+INSERT INTO sales VALUES (2909, 4549, 476.625);
+INSERT INTO sales VALUES (2910, 4697, 483.125);
+INSERT INTO sales VALUES (2911, 4845, 489.625);
+INSERT INTO sales VALUES (2912, 4993, 496.125);
+INSERT INTO sales VALUES (2913, 5141, 502.625);
+INSERT INTO sales VALUES (2914, 5289, 509.125);
+INSERT INTO sales VALUES (2915, 5437, 515.625);
+INSERT INTO sales VALUES (2916, 5585, 522.125);
+INSERT INTO sales VALUES (2917, 5733, 528.625);
+INSERT INTO sales VALUES (2918, 5881, 535.125);
+INSERT INTO sales VALUES (2919, 6029, 541.625);
+INSERT INTO sales VALUES (2920, 6177, 548.125);
+INSERT INTO sales VALUES (2921, 6325, 554.625);
+INSERT INTO sales VALUES (2922, 6473, 561.125);
+INSERT INTO sales VALUES (2923, 6621, 567.625);
+INSERT INTO sales VALUES (2924, 6769, 574.125);
+INSERT INTO sales VALUES (2925, 6917, 580.625);
+INSERT INTO sales VALUES (2926, 7065, 587.125);
+INSERT INTO sales VALUES (2927, 7213, 593.625);
+INSERT INTO sales VALUES (2928, 7361, 600.125);
+INSERT INTO sales VALUES (2929, 7509, 606.625);
+INSERT INTO sales VALUES (2930, 7657, 613.125);
+INSERT INTO sales VALUES (2931, 7805, 619.625);
+INSERT INTO sales VALUES (2932, 7953, 626.125);
+INSERT INTO sales VALUES (2933, 8101, 632.625);
+INSERT INTO sales VALUES (2934, 57, 639.125);
+INSERT INTO sales VALUES (2935, 205, 645.625);
+INSERT INTO sales VALUES (2936, 353, 652.125);
+INSERT INTO sales VALUES (2937, 501, 658.625);
+INSERT INTO sales VALUES (2938, 649, 665.125);
+INSERT INTO sales VALUES (2939, 797, 671.625);
+INSERT INTO sales VALUES (2940, 945, 678.125);
+INSERT INTO sales VALUES (2941, 1093, 684.625);
+INSERT INTO sales VALUES (2942, 1241, 691.125);
+INSERT INTO sales VALUES (2943, 1389, 697.625);
+INSERT INTO sales VALUES (2944, 1537, 704.125);
+INSERT INTO sales VALUES (2945, 1685, 710.625);
+INSERT INTO sales VALUES (2946, 1833, 717.125);
+INSERT INTO sales VALUES (2947, 1981, 723.625);
+INSERT INTO sales VALUES (2948, 2129, 730.125);
+INSERT INTO sales VALUES (2949, 2277, 736.625);
+INSERT INTO sales VALUES (2950, 2425, 743.125);
+INSERT INTO sales VALUES (2951, 2573, 749.625);
+INSERT INTO sales VALUES (2952, 2721, 756.125);
+INSERT INTO sales VALUES (2953, 2869, 762.625);
+INSERT INTO sales VALUES (2954, 3017, 769.125);
+INSERT INTO sales VALUES (2955, 3165, 775.625);
+INSERT INTO sales VALUES (2956, 3313, 782.125);
+INSERT INTO sales VALUES (2957, 3461, 788.625);
+INSERT INTO sales VALUES (2958, 3609, 795.125);
+INSERT INTO sales VALUES (2959, 3757, 801.625);
+INSERT INTO sales VALUES (2960, 3905, 808.125);
+INSERT INTO sales VALUES (2961, 4053, 814.625);
+INSERT INTO sales VALUES (2962, 4201, 821.125);
+INSERT INTO sales VALUES (2963, 4349, 827.625);
+INSERT INTO sales VALUES (2964, 4497, 834.125);
+INSERT INTO sales VALUES (2965, 4645, 840.625);
+INSERT INTO sales VALUES (2966, 4793, 847.125);
+INSERT INTO sales VALUES (2967, 4941, 853.625);
+INSERT INTO sales VALUES (2968, 5089, 860.125);
+INSERT INTO sales VALUES (2969, 5237, 866.625);
+INSERT INTO sales VALUES (2970, 5385, 873.125);
+INSERT INTO sales VALUES (2971, 5533, 879.625);
+INSERT INTO sales VALUES (2972, 5681, 886.125);
+INSERT INTO sales VALUES (2973, 5829, 892.625);
+INSERT INTO sales VALUES (2974, 5977, 899.125);
+INSERT INTO sales VALUES (2975, 6125, 905.625);
+INSERT INTO sales VALUES (2976, 6273, 912.125);
+INSERT INTO sales VALUES (2977, 6421, 918.625);
+INSERT INTO sales VALUES (2978, 6569, 925.125);
+INSERT INTO sales VALUES (2979, 6717, 931.625);
+INSERT INTO sales VALUES (2980, 6865, 938.125);
+INSERT INTO sales VALUES (2981, 7013, 944.625);
+INSERT INTO sales VALUES (2982, 7161, 951.125);
+INSERT INTO sales VALUES (2983, 7309, 957.625);
+INSERT INTO sales VALUES (2984, 7457, 964.125);
+INSERT INTO sales VALUES (2985, 7605, 970.625);
+INSERT INTO sales VALUES (2986, 7753, 977.125);
+INSERT INTO sales VALUES (2987, 7901, 983.625);
+INSERT INTO sales VALUES (2988, 8049, 990.125);
+INSERT INTO sales VALUES (2989, 5, 996.625);
+INSERT INTO sales VALUES (2990, 153, 1003.125);
+INSERT INTO sales VALUES (2991, 301, 1009.625);
+INSERT INTO sales VALUES (2992, 449, 1016.125);
+INSERT INTO sales VALUES (2993, 597, 1022.625);
+INSERT INTO sales VALUES (2994, 745, 5.125);
+INSERT INTO sales VALUES (2995, 893, 11.625);
+INSERT INTO sales VALUES (2996, 1041, 18.125);
+INSERT INTO sales VALUES (2997, 1189, 24.625);
+INSERT INTO sales VALUES (2998, 1337, 31.125);
+INSERT INTO sales VALUES (2999, 1485, 37.625);
+INSERT INTO sales VALUES (3000, 1633, 44.125);
+INSERT INTO sales VALUES (3001, 1781, 50.625);
+INSERT INTO sales VALUES (3002, 1929, 57.125);
+INSERT INTO sales VALUES (3003, 2077, 63.625);
+INSERT INTO sales VALUES (3004, 2225, 70.125);
+INSERT INTO sales VALUES (3005, 2373, 76.625);
+INSERT INTO sales VALUES (3006, 2521, 83.125);
+INSERT INTO sales VALUES (3007, 2669, 89.625);
+INSERT INTO sales VALUES (3008, 2817, 96.125);
+INSERT INTO sales VALUES (3009, 2965, 102.625);
+INSERT INTO sales VALUES (3010, 3113, 109.125);
+INSERT INTO sales VALUES (3011, 3261, 115.625);
+INSERT INTO sales VALUES (3012, 3409, 122.125);
+INSERT INTO sales VALUES (3013, 3557, 128.625);
+INSERT INTO sales VALUES (3014, 3705, 135.125);
+INSERT INTO sales VALUES (3015, 3853, 141.625);
+INSERT INTO sales VALUES (3016, 4001, 148.125);
+INSERT INTO sales VALUES (3017, 4149, 154.625);
+INSERT INTO sales VALUES (3018, 4297, 161.125);
+INSERT INTO sales VALUES (3019, 4445, 167.625);
+INSERT INTO sales VALUES (3020, 4593, 174.125);
+INSERT INTO sales VALUES (3021, 4741, 180.625);
+INSERT INTO sales VALUES (3022, 4889, 187.125);
+INSERT INTO sales VALUES (3023, 5037, 193.625);
+INSERT INTO sales VALUES (3024, 5185, 200.125);
+INSERT INTO sales VALUES (3025, 5333, 206.625);
+INSERT INTO sales VALUES (3026, 5481, 213.125);
+INSERT INTO sales VALUES (3027, 5629, 219.625);
+INSERT INTO sales VALUES (3028, 5777, 226.125);
+INSERT INTO sales VALUES (3029, 5925, 232.625);
+INSERT INTO sales VALUES (3030, 6073, 239.125);
+INSERT INTO sales VALUES (3031, 6221, 245.625);
+INSERT INTO sales VALUES (3032, 6369, 252.125);
+INSERT INTO sales VALUES (3033, 6517, 258.625);
+INSERT INTO sales VALUES (3034, 6665, 265.125);
+INSERT INTO sales VALUES (3035, 6813, 271.625);
+INSERT INTO sales VALUES (3036, 6961, 278.125);
+INSERT INTO sales VALUES (3037, 7109, 284.625);
+INSERT INTO sales VALUES (3038, 7257, 291.125);
+INSERT INTO sales VALUES (3039, 7405, 297.625);
+INSERT INTO sales VALUES (3040, 7553, 304.125);
+INSERT INTO sales VALUES (3041, 7701, 310.625);
+INSERT INTO sales VALUES (3042, 7849, 317.125);
+INSERT INTO sales VALUES (3043, 7997, 323.625);
+INSERT INTO sales VALUES (3044, 8145, 330.125);
+INSERT INTO sales VALUES (3045, 101, 336.625);
+INSERT INTO sales VALUES (3046, 249, 343.125);
+INSERT INTO sales VALUES (3047, 397, 349.625);
+INSERT INTO sales VALUES (3048, 545, 356.125);
+INSERT INTO sales VALUES (3049, 693, 362.625);
+INSERT INTO sales VALUES (3050, 841, 369.125);
+INSERT INTO sales VALUES (3051, 989, 375.625);
+INSERT INTO sales VALUES (3052, 1137, 382.125);
+INSERT INTO sales VALUES (3053, 1285, 388.625);
+INSERT INTO sales VALUES (3054, 1433, 395.125);
+INSERT INTO sales VALUES (3055, 1581, 401.625);
+INSERT INTO sales VALUES (3056, 1729, 408.125);
+INSERT INTO sales VALUES (3057, 1877, 414.625);
+INSERT INTO sales VALUES (3058, 2025, 421.125);
+INSERT INTO sales VALUES (3059, 2173, 427.625);
+INSERT INTO sales VALUES (3060, 2321, 434.125);
+INSERT INTO sales VALUES (3061, 2469, 440.625);
+INSERT INTO sales VALUES (3062, 2617, 447.125);
+INSERT INTO sales VALUES (3063, 2765, 453.625);
+INSERT INTO sales VALUES (3064, 2913, 460.125);
+INSERT INTO sales VALUES (3065, 3061, 466.625);
+INSERT INTO sales VALUES (3066, 3209, 473.125);
+INSERT INTO sales VALUES (3067, 3357, 479.625);
+INSERT INTO sales VALUES (3068, 3505, 486.125);
+INSERT INTO sales VALUES (3069, 3653, 492.625);
+INSERT INTO sales VALUES (3070, 3801, 499.125);
+INSERT INTO sales VALUES (3071, 3949, 505.625);
+INSERT INTO sales VALUES (3072, 4097, 512.125);
+INSERT INTO sales VALUES (3073, 4245, 518.625);
+INSERT INTO sales VALUES (3074, 4393, 525.125);
+INSERT INTO sales VALUES (3075, 4541, 531.625);
+INSERT INTO sales VALUES (3076, 4689, 538.125);
+INSERT INTO sales VALUES (3077, 4837, 544.625);
+INSERT INTO sales VALUES (3078, 4985, 551.125);
+INSERT INTO sales VALUES (3079, 5133, 557.625);
+INSERT INTO sales VALUES (3080, 5281, 564.125);
+INSERT INTO sales VALUES (3081, 5429, 570.625);
+INSERT INTO sales VALUES (3082, 5577, 577.125);
+INSERT INTO sales VALUES (3083, 5725, 583.625);
+INSERT INTO sales VALUES (3084, 5873, 590.125);
+INSERT INTO sales VALUES (3085, 6021, 596.625);
+INSERT INTO sales VALUES (3086, 6169, 603.125);
+INSERT INTO sales VALUES (3087, 6317, 609.625);
+INSERT INTO sales VALUES (3088, 6465, 616.125);
+INSERT INTO sales VALUES (3089, 6613, 622.625);
+INSERT INTO sales VALUES (3090, 6761, 629.125);
+INSERT INTO sales VALUES (3091, 6909, 635.625);
+INSERT INTO sales VALUES (3092, 7057, 642.125);
+INSERT INTO sales VALUES (3093, 7205, 648.625);
+INSERT INTO sales VALUES (3094, 7353, 655.125);
+INSERT INTO sales VALUES (3095, 7501, 661.625);
+INSERT INTO sales VALUES (3096, 7649, 668.125);
+INSERT INTO sales VALUES (3097, 7797, 674.625);
+INSERT INTO sales VALUES (3098, 7945, 681.125);
+INSERT INTO sales VALUES (3099, 8093, 687.625);
+INSERT INTO sales VALUES (3100, 49, 694.125);
+INSERT INTO sales VALUES (3101, 197, 700.625);
+INSERT INTO sales VALUES (3102, 345, 707.125);
+INSERT INTO sales VALUES (3103, 493, 713.625);
+INSERT INTO sales VALUES (3104, 641, 720.125);
+INSERT INTO sales VALUES (3105, 789, 726.625);
+INSERT INTO sales VALUES (3106, 937, 733.125);
+INSERT INTO sales VALUES (3107, 1085, 739.625);
+INSERT INTO sales VALUES (3108, 1233, 746.125);
+INSERT INTO sales VALUES (3109, 1381, 752.625);
+INSERT INTO sales VALUES (3110, 1529, 759.125);
+INSERT INTO sales VALUES (3111, 1677, 765.625);
+INSERT INTO sales VALUES (3112, 1825, 772.125);
+INSERT INTO sales VALUES (3113, 1973, 778.625);
+INSERT INTO sales VALUES (3114, 2121, 785.125);
+INSERT INTO sales VALUES (3115, 2269, 791.625);
+INSERT INTO sales VALUES (3116, 2417, 798.125);
+INSERT INTO sales VALUES (3117, 2565, 804.625);
+INSERT INTO sales VALUES (3118, 2713, 811.125);
+INSERT INTO sales VALUES (3119, 2861, 817.625);
+INSERT INTO sales VALUES (3120, 3009, 824.125);
+INSERT INTO sales VALUES (3121, 3157, 830.625);
+INSERT INTO sales VALUES (3122, 3305, 837.125);
+INSERT INTO sales VALUES (3123, 3453, 843.625);
+INSERT INTO sales VALUES (3124, 3601, 850.125);
+INSERT INTO sales VALUES (3125, 3749, 856.625);
+INSERT INTO sales VALUES (3126, 3897, 863.125);
+INSERT INTO sales VALUES (3127, 4045, 869.625);
+INSERT INTO sales VALUES (3128, 4193, 876.125);
+INSERT INTO sales VALUES (3129, 4341, 882.625);
+INSERT INTO sales VALUES (3130, 4489, 889.125);
+INSERT INTO sales VALUES (3131, 4637, 895.625);
+INSERT INTO sales VALUES (3132, 4785, 902.125);
+INSERT INTO sales VALUES (3133, 4933, 908.625);
+INSERT INTO sales VALUES (3134, 5081, 915.125);
+INSERT INTO sales VALUES (3135, 5229, 921.625);
+INSERT INTO sales VALUES (3136, 5377, 928.125);
+INSERT INTO sales VALUES (3137, 5525, 934.625);
+INSERT INTO sales VALUES (3138, 5673, 941.125);
+INSERT INTO sales VALUES (3139, 5821, 947.625);
+INSERT INTO sales VALUES (3140, 5969, 954.125);
+INSERT INTO sales VALUES (3141, 6117, 960.625);
+INSERT INTO sales VALUES (3142, 6265, 967.125);
+INSERT INTO sales VALUES (3143, 6413, 973.625);
+INSERT INTO sales VALUES (3144, 6561, 980.125);
+INSERT INTO sales VALUES (3145, 6709, 986.625);
+INSERT INTO sales VALUES (3146, 6857, 993.125);
+INSERT INTO sales VALUES (3147, 7005, 999.625);
+INSERT INTO sales VALUES (3148, 7153, 1006.125);
+INSERT INTO sales VALUES (3149, 7301, 1012.625);
+INSERT INTO sales VALUES (3150, 7449, 1019.125);
+INSERT INTO sales VALUES (3151, 7597, 1.625);
+INSERT INTO sales VALUES (3152, 7745, 8.125);
+INSERT INTO sales VALUES (3153, 7893, 14.625);
+INSERT INTO sales VALUES (3154, 8041, 21.125);
+INSERT INTO sales VALUES (3155, 8189, 27.625);
+INSERT INTO sales VALUES (3156, 145, 34.125);
+INSERT INTO sales VALUES (3157, 293, 40.625);
+INSERT INTO sales VALUES (3158, 441, 47.125);
+INSERT INTO sales VALUES (3159, 589, 53.625);
+INSERT INTO sales VALUES (3160, 737, 60.125);
+INSERT INTO sales VALUES (3161, 885, 66.625);
+INSERT INTO sales VALUES (3162, 1033, 73.125);
+INSERT INTO sales VALUES (3163, 1181, 79.625);
+INSERT INTO sales VALUES (3164, 1329, 86.125);
+INSERT INTO sales VALUES (3165, 1477, 92.625);
+INSERT INTO sales VALUES (3166, 1625, 99.125);
+INSERT INTO sales VALUES (3167, 1773, 105.625);
+INSERT INTO sales VALUES (3168, 1921, 112.125);
+INSERT INTO sales VALUES (3169, 2069, 118.625);
+INSERT INTO sales VALUES (3170, 2217, 125.125);
+INSERT INTO sales VALUES (3171, 2365, 131.625);
+INSERT INTO sales VALUES (3172, 2513, 138.125);
+INSERT INTO sales VALUES (3173, 2661, 144.625);
+INSERT INTO sales VALUES (3174, 2809, 151.125);
+INSERT INTO sales VALUES (3175, 2957, 157.625);
+INSERT INTO sales VALUES (3176, 3105, 164.125);
+INSERT INTO sales VALUES (3177, 3253, 170.625);
+INSERT INTO sales VALUES (3178, 3401, 177.125);
+INSERT INTO sales VALUES (3179, 3549, 183.625);
+INSERT INTO sales VALUES (3180, 3697, 190.125);
+INSERT INTO sales VALUES (3181, 3845, 196.625);
+INSERT INTO sales VALUES (3182, 3993, 203.125);
+INSERT INTO sales VALUES (3183, 4141, 209.625);
+INSERT INTO sales VALUES (3184, 4289, 216.125);
+INSERT INTO sales VALUES (3185, 4437, 222.625);
+INSERT INTO sales VALUES (3186, 4585, 229.125);
+INSERT INTO sales VALUES (3187, 4733, 235.625);
+INSERT INTO sales VALUES (3188, 4881, 242.125);
+INSERT INTO sales VALUES (3189, 5029, 248.625);
+INSERT INTO sales VALUES (3190, 5177, 255.125);
+INSERT INTO sales VALUES (3191, 5325, 261.625);
+INSERT INTO sales VALUES (3192, 5473, 268.125);
+INSERT INTO sales VALUES (3193, 5621, 274.625);
+INSERT INTO sales VALUES (3194, 5769, 281.125);
+INSERT INTO sales VALUES (3195, 5917, 287.625);
+INSERT INTO sales VALUES (3196, 6065, 294.125);
+INSERT INTO sales VALUES (3197, 6213, 300.625);
+INSERT INTO sales VALUES (3198, 6361, 307.125);
+INSERT INTO sales VALUES (3199, 6509, 313.625);
+INSERT INTO sales VALUES (3200, 6657, 320.125);
+INSERT INTO sales VALUES (3201, 6805, 326.625);
+INSERT INTO sales VALUES (3202, 6953, 333.125);
+INSERT INTO sales VALUES (3203, 7101, 339.625);
+INSERT INTO sales VALUES (3204, 7249, 346.125);
+INSERT INTO sales VALUES (3205, 7397, 352.625);
+INSERT INTO sales VALUES (3206, 7545, 359.125);
+INSERT INTO sales VALUES (3207, 7693, 365.625);
+INSERT INTO sales VALUES (3208, 7841, 372.125);
+INSERT INTO sales VALUES (3209, 7989, 378.625);
+INSERT INTO sales VALUES (3210, 8137, 385.125);
+INSERT INTO sales VALUES (3211, 93, 391.625);
+INSERT INTO sales VALUES (3212, 241, 398.125);
+INSERT INTO sales VALUES (3213, 389, 404.625);
+INSERT INTO sales VALUES (3214, 537, 411.125);
+INSERT INTO sales VALUES (3215, 685, 417.625);
+INSERT INTO sales VALUES (3216, 833, 424.125);
+INSERT INTO sales VALUES (3217, 981, 430.625);
+INSERT INTO sales VALUES (3218, 1129, 437.125);
+INSERT INTO sales VALUES (3219, 1277, 443.625);
+INSERT INTO sales VALUES (3220, 1425, 450.125);
+INSERT INTO sales VALUES (3221, 1573, 456.625);
+INSERT INTO sales VALUES (3222, 1721, 463.125);
+INSERT INTO sales VALUES (3223, 1869, 469.625);
+INSERT INTO sales VALUES (3224, 2017, 476.125);
+INSERT INTO sales VALUES (3225, 2165, 482.625);
+INSERT INTO sales VALUES (3226, 2313, 489.125);
+INSERT INTO sales VALUES (3227, 2461, 495.625);
+INSERT INTO sales VALUES (3228, 2609, 502.125);
+INSERT INTO sales VALUES (3229, 2757, 508.625);
+INSERT INTO sales VALUES (3230, 2905, 515.125);
+INSERT INTO sales VALUES (3231, 3053, 521.625);
+INSERT INTO sales VALUES (3232, 3201, 528.125);
+INSERT INTO sales VALUES (3233, 3349, 534.625);
+INSERT INTO sales VALUES (3234, 3497, 541.125);
+INSERT INTO sales VALUES (3235, 3645, 547.625);
+INSERT INTO sales VALUES (3236, 3793, 554.125);
+INSERT INTO sales VALUES (3237, 3941, 560.625);
+INSERT INTO sales VALUES (3238, 4089, 567.125);
+INSERT INTO sales VALUES (3239, 4237, 573.625);
+INSERT INTO sales VALUES (3240, 4385, 580.125);
+INSERT INTO sales VALUES (3241, 4533, 586.625);
+INSERT INTO sales VALUES (3242, 4681, 593.125);
+INSERT INTO sales VALUES (3243, 4829, 599.625);
+INSERT INTO sales VALUES (3244, 4977, 606.125);
+INSERT INTO sales VALUES (3245, 5125, 612.625);
+INSERT INTO sales VALUES (3246, 5273, 619.125);
+INSERT INTO sales VALUES (3247, 5421, 625.625);
+INSERT INTO sales VALUES (3248, 5569, 632.125);
+INSERT INTO sales VALUES (3249, 5717, 638.625);
+INSERT INTO sales VALUES (3250, 5865, 645.125);
+INSERT INTO sales VALUES (3251, 6013, 651.625);
+INSERT INTO sales VALUES (3252, 6161, 658.125);
+INSERT INTO sales VALUES (3253, 6309, 664.625);
+INSERT INTO sales VALUES (3254, 6457, 671.125);
+INSERT INTO sales VALUES (3255, 6605, 677.625);
+INSERT INTO sales VALUES (3256, 6753, 684.125);
+INSERT INTO sales VALUES (3257, 6901, 690.625);
+INSERT INTO sales VALUES (3258, 7049, 697.125);
+INSERT INTO sales VALUES (3259, 7197, 703.625);
+INSERT INTO sales VALUES (3260, 7345, 710.125);
+INSERT INTO sales VALUES (3261, 7493, 716.625);
+INSERT INTO sales VALUES (3262, 7641, 723.125);
+INSERT INTO sales VALUES (3263, 7789, 729.625);
+INSERT INTO sales VALUES (3264, 7937, 736.125);
+INSERT INTO sales VALUES (3265, 8085, 742.625);
+INSERT INTO sales VALUES (3266, 41, 749.125);
+INSERT INTO sales VALUES (3267, 189, 755.625);
+INSERT INTO sales VALUES (3268, 337, 762.125);
+INSERT INTO sales VALUES (3269, 485, 768.625);
+INSERT INTO sales VALUES (3270, 633, 775.125);
+INSERT INTO sales VALUES (3271, 781, 781.625);
+INSERT INTO sales VALUES (3272, 929, 788.125);
+INSERT INTO sales VALUES (3273, 1077, 794.625);
+INSERT INTO sales VALUES (3274, 1225, 801.125);
+INSERT INTO sales VALUES (3275, 1373, 807.625);
+INSERT INTO sales VALUES (3276, 1521, 814.125);
+INSERT INTO sales VALUES (3277, 1669, 820.625);
+INSERT INTO sales VALUES (3278, 1817, 827.125);
+INSERT INTO sales VALUES (3279, 1965, 833.625);
+INSERT INTO sales VALUES (3280, 2113, 840.125);
+INSERT INTO sales VALUES (3281, 2261, 846.625);
+INSERT INTO sales VALUES (3282, 2409, 853.125);
+INSERT INTO sales VALUES (3283, 2557, 859.625);
+INSERT INTO sales VALUES (3284, 2705, 866.125);
+INSERT INTO sales VALUES (3285, 2853, 872.625);
+INSERT INTO sales VALUES (3286, 3001, 879.125);
+INSERT INTO sales VALUES (3287, 3149, 885.625);
+INSERT INTO sales VALUES (3288, 3297, 892.125);
+INSERT INTO sales VALUES (3289, 3445, 898.625);
+INSERT INTO sales VALUES (3290, 3593, 905.125);
+INSERT INTO sales VALUES (3291, 3741, 911.625);
+INSERT INTO sales VALUES (3292, 3889, 918.125);
+INSERT INTO sales VALUES (3293, 4037, 924.625);
+INSERT INTO sales VALUES (3294, 4185, 931.125);
+INSERT INTO sales VALUES (3295, 4333, 937.625);
+INSERT INTO sales VALUES (3296, 4481, 944.125);
+INSERT INTO sales VALUES (3297, 4629, 950.625);
+INSERT INTO sales VALUES (3298, 4777, 957.125);
+INSERT INTO sales VALUES (3299, 4925, 963.625);
+INSERT INTO sales VALUES (3300, 5073, 970.125);
+INSERT INTO sales VALUES (3301, 5221, 976.625);
+INSERT INTO sales VALUES (3302, 5369, 983.125);
+INSERT INTO sales VALUES (3303, 5517, 989.625);
+INSERT INTO sales VALUES (3304, 5665, 996.125);
+INSERT INTO sales VALUES (3305, 5813, 1002.625);
+INSERT INTO sales VALUES (3306, 5961, 1009.125);
+INSERT INTO sales VALUES (3307, 6109, 1015.625);
+INSERT INTO sales VALUES (3308, 6257, 1022.125);
+INSERT INTO sales VALUES (3309, 6405, 4.625);
+INSERT INTO sales VALUES (3310, 6553, 11.125);
+INSERT INTO sales VALUES (3311, 6701, 17.625);
+INSERT INTO sales VALUES (3312, 6849, 24.125);
+INSERT INTO sales VALUES (3313, 6997, 30.625);
+INSERT INTO sales VALUES (3314, 7145, 37.125);
+INSERT INTO sales VALUES (3315, 7293, 43.625);
+INSERT INTO sales VALUES (3316, 7441, 50.125);
+INSERT INTO sales VALUES (3317, 7589, 56.625);
+INSERT INTO sales VALUES (3318, 7737, 63.125);
+INSERT INTO sales VALUES (3319, 7885, 69.625);
+INSERT INTO sales VALUES (3320, 8033, 76.125);
+INSERT INTO sales VALUES (3321, 8181, 82.625);
+INSERT INTO sales VALUES (3322, 137, 89.125);
+INSERT INTO sales VALUES (3323, 285, 95.625);
+INSERT INTO sales VALUES (3324, 433, 102.125);
+INSERT INTO sales VALUES (3325, 581, 108.625);
+INSERT INTO sales VALUES (3326, 729, 115.125);
+INSERT INTO sales VALUES (3327, 877, 121.625);
+INSERT INTO sales VALUES (3328, 1025, 128.125);
+INSERT INTO sales VALUES (3329, 1173, 134.625);
+INSERT INTO sales VALUES (3330, 1321, 141.125);
+INSERT INTO sales VALUES (3331, 1469, 147.625);
+INSERT INTO sales VALUES (3332, 1617, 154.125);
+INSERT INTO sales VALUES (3333, 1765, 160.625);
+INSERT INTO sales VALUES (3334, 1913, 167.125);
+INSERT INTO sales VALUES (3335, 2061, 173.625);
+INSERT INTO sales VALUES (3336, 2209, 180.125);
+INSERT INTO sales VALUES (3337, 2357, 186.625);
+INSERT INTO sales VALUES (3338, 2505, 193.125);
+INSERT INTO sales VALUES (3339, 2653, 199.625);
+INSERT INTO sales VALUES (3340, 2801, 206.125);
+INSERT INTO sales VALUES (3341, 2949, 212.625);
+INSERT INTO sales VALUES (3342, 3097, 219.125);
+INSERT INTO sales VALUES (3343, 3245, 225.625);
+INSERT INTO sales VALUES (3344, 3393, 232.125);
+INSERT INTO sales VALUES (3345, 3541, 238.625);
+INSERT INTO sales VALUES (3346, 3689, 245.125);
+INSERT INTO sales VALUES (3347, 3837, 251.625);
+INSERT INTO sales VALUES (3348, 3985, 258.125);
+INSERT INTO sales VALUES (3349, 4133, 264.625);
+INSERT INTO sales VALUES (3350, 4281, 271.125);
+INSERT INTO sales VALUES (3351, 4429, 277.625);
+INSERT INTO sales VALUES (3352, 4577, 284.125);
+INSERT INTO sales VALUES (3353, 4725, 290.625);
+INSERT INTO sales VALUES (3354, 4873, 297.125);
+INSERT INTO sales VALUES (3355, 5021, 303.625);
+INSERT INTO sales VALUES (3356, 5169, 310.125);
+INSERT INTO sales VALUES (3357, 5317, 316.625);
+INSERT INTO sales VALUES (3358, 5465, 323.125);
+INSERT INTO sales VALUES (3359, 5613, 329.625);
+INSERT INTO sales VALUES (3360, 5761, 336.125);
+INSERT INTO sales VALUES (3361, 5909, 342.625);
+INSERT INTO sales VALUES (3362, 6057, 349.125);
+INSERT INTO sales VALUES (3363, 6205, 355.625);
+INSERT INTO sales VALUES (3364, 6353, 362.125);
+INSERT INTO sales VALUES (3365, 6501, 368.625);
+INSERT INTO sales VALUES (3366, 6649, 375.125);
+INSERT INTO sales VALUES (3367, 6797, 381.625);
+INSERT INTO sales VALUES (3368, 6945, 388.125);
+INSERT INTO sales VALUES (3369, 7093, 394.625);
+INSERT INTO sales VALUES (3370, 7241, 401.125);
+INSERT INTO sales VALUES (3371, 7389, 407.625);
+INSERT INTO sales VALUES (3372, 7537, 414.125);
+INSERT INTO sales VALUES (3373, 7685, 420.625);
+INSERT INTO sales VALUES (3374, 7833, 427.125);
+INSERT INTO sales VALUES (3375, 7981, 433.625);
+INSERT INTO sales VALUES (3376, 8129, 440.125);
+INSERT INTO sales VALUES (3377, 85, 446.625);
+INSERT INTO sales VALUES (3378, 233, 453.125);
+INSERT INTO sales VALUES (3379, 381, 459.625);
+INSERT INTO sales VALUES (3380, 529, 466.125);
+INSERT INTO sales VALUES (3381, 677, 472.625);
+INSERT INTO sales VALUES (3382, 825, 479.125);
+INSERT INTO sales VALUES (3383, 973, 485.625);
+INSERT INTO sales VALUES (3384, 1121, 492.125);
+INSERT INTO sales VALUES (3385, 1269, 498.625);
+INSERT INTO sales VALUES (3386, 1417, 505.125);
+INSERT INTO sales VALUES (3387, 1565, 511.625);
+INSERT INTO sales VALUES (3388, 1713, 518.125);
+INSERT INTO sales VALUES (3389, 1861, 524.625);
+INSERT INTO sales VALUES (3390, 2009, 531.125);
+INSERT INTO sales VALUES (3391, 2157, 537.625);
+INSERT INTO sales VALUES (3392, 2305, 544.125);
+INSERT INTO sales VALUES (3393, 2453, 550.625);
+INSERT INTO sales VALUES (3394, 2601, 557.125);
+INSERT INTO sales VALUES (3395, 2749, 563.625);
+INSERT INTO sales VALUES (3396, 2897, 570.125);
+INSERT INTO sales VALUES (3397, 3045, 576.625);
+INSERT INTO sales VALUES (3398, 3193, 583.125);
+INSERT INTO sales VALUES (3399, 3341, 589.625);
+INSERT INTO sales VALUES (3400, 3489, 596.125);
+INSERT INTO sales VALUES (3401, 3637, 602.625);
+INSERT INTO sales VALUES (3402, 3785, 609.125);
+INSERT INTO sales VALUES (3403, 3933, 615.625);
+INSERT INTO sales VALUES (3404, 4081, 622.125);
+INSERT INTO sales VALUES (3405, 4229, 628.625);
+INSERT INTO sales VALUES (3406, 4377, 635.125);
+INSERT INTO sales VALUES (3407, 4525, 641.625);
+INSERT INTO sales VALUES (3408, 4673, 648.125);
+INSERT INTO sales VALUES (3409, 4821, 654.625);
+INSERT INTO sales VALUES (3410, 4969, 661.125);
+INSERT INTO sales VALUES (3411, 5117, 667.625);
+INSERT INTO sales VALUES (3412, 5265, 674.125);
+INSERT INTO sales VALUES (3413, 5413, 680.625);
+INSERT INTO sales VALUES (3414, 5561, 687.125);
+INSERT INTO sales VALUES (3415, 5709, 693.625);
+INSERT INTO sales VALUES (3416, 5857, 700.125);
+INSERT INTO sales VALUES (3417, 6005, 706.625);
+INSERT INTO sales VALUES (3418, 6153, 713.125);
+INSERT INTO sales VALUES (3419, 6301, 719.625);
+INSERT INTO sales VALUES (3420, 6449, 726.125);
+INSERT INTO sales VALUES (3421, 6597, 732.625);
+INSERT INTO sales VALUES (3422, 6745, 739.125);
+INSERT INTO sales VALUES (3423, 6893, 745.625);
+INSERT INTO sales VALUES (3424, 7041, 752.125);
+INSERT INTO sales VALUES (3425, 7189, 758.625);
+INSERT INTO sales VALUES (3426, 7337, 765.125);
+INSERT INTO sales VALUES (3427, 7485, 771.625);
+INSERT INTO sales VALUES (3428, 7633, 778.125);
+INSERT INTO sales VALUES (3429, 7781, 784.625);
+INSERT INTO sales VALUES (3430, 7929, 791.125);
+INSERT INTO sales VALUES (3431, 8077, 797.625);
+INSERT INTO sales VALUES (3432, 33, 804.125);
+INSERT INTO sales VALUES (3433, 181, 810.625);
+INSERT INTO sales VALUES (3434, 329, 817.125);
+INSERT INTO sales VALUES (3435, 477, 823.625);
+INSERT INTO sales VALUES (3436, 625, 830.125);
+INSERT INTO sales VALUES (3437, 773, 836.625);
+INSERT INTO sales VALUES (3438, 921, 843.125);
+INSERT INTO sales VALUES (3439, 1069, 849.625);
+INSERT INTO sales VALUES (3440, 1217, 856.125);
+INSERT INTO sales VALUES (3441, 1365, 862.625);
+INSERT INTO sales VALUES (3442, 1513, 869.125);
+INSERT INTO sales VALUES (3443, 1661, 875.625);
+INSERT INTO sales VALUES (3444, 1809, 882.125);
+INSERT INTO sales VALUES (3445, 1957, 888.625);
+INSERT INTO sales VALUES (3446, 2105, 895.125);
+INSERT INTO sales VALUES (3447, 2253, 901.625);
+INSERT INTO sales VALUES (3448, 2401, 908.125);
+INSERT INTO sales VALUES (3449, 2549, 914.625);
+INSERT INTO sales VALUES (3450, 2697, 921.125);
+INSERT INTO sales VALUES (3451, 2845, 927.625);
+INSERT INTO sales VALUES (3452, 2993, 934.125);
+INSERT INTO sales VALUES (3453, 3141, 940.625);
+INSERT INTO sales VALUES (3454, 3289, 947.125);
+INSERT INTO sales VALUES (3455, 3437, 953.625);
+INSERT INTO sales VALUES (3456, 3585, 960.125);
+INSERT INTO sales VALUES (3457, 3733, 966.625);
+INSERT INTO sales VALUES (3458, 3881, 973.125);
+INSERT INTO sales VALUES (3459, 4029, 979.625);
+INSERT INTO sales VALUES (3460, 4177, 986.125);
+INSERT INTO sales VALUES (3461, 4325, 992.625);
+INSERT INTO sales VALUES (3462, 4473, 999.125);
+INSERT INTO sales VALUES (3463, 4621, 1005.625);
+INSERT INTO sales VALUES (3464, 4769, 1012.125);
+INSERT INTO sales VALUES (3465, 4917, 1018.625);
+INSERT INTO sales VALUES (3466, 5065, 1.125);
+INSERT INTO sales VALUES (3467, 5213, 7.625);
+INSERT INTO sales VALUES (3468, 5361, 14.125);
+INSERT INTO sales VALUES (3469, 5509, 20.625);
+INSERT INTO sales VALUES (3470, 5657, 27.125);
+INSERT INTO sales VALUES (3471, 5805, 33.625);
+INSERT INTO sales VALUES (3472, 5953, 40.125);
+INSERT INTO sales VALUES (3473, 6101, 46.625);
+INSERT INTO sales VALUES (3474, 6249, 53.125);
+INSERT INTO sales VALUES (3475, 6397, 59.625);
+INSERT INTO sales VALUES (3476, 6545, 66.125);
+INSERT INTO sales VALUES (3477, 6693, 72.625);
+INSERT INTO sales VALUES (3478, 6841, 79.125);
+INSERT INTO sales VALUES (3479, 6989, 85.625);
+INSERT INTO sales VALUES (3480, 7137, 92.125);
+INSERT INTO sales VALUES (3481, 7285, 98.625);
+INSERT INTO sales VALUES (3482, 7433, 105.125);
+INSERT INTO sales VALUES (3483, 7581, 111.625);
+INSERT INTO sales VALUES (3484, 7729, 118.125);
+INSERT INTO sales VALUES (3485, 7877, 124.625);
+INSERT INTO sales VALUES (3486, 8025, 131.125);
+INSERT INTO sales VALUES (3487, 8173, 137.625);
+INSERT INTO sales VALUES (3488, 129, 144.125);
+INSERT INTO sales VALUES (3489, 277, 150.625);
+INSERT INTO sales VALUES (3490, 425, 157.125);
+INSERT INTO sales VALUES (3491, 573, 163.625);
+INSERT INTO sales VALUES (3492, 721, 170.125);
+INSERT INTO sales VALUES (3493, 869, 176.625);
+INSERT INTO sales VALUES (3494, 1017, 183.125);
+INSERT INTO sales VALUES (3495, 1165, 189.625);
+INSERT INTO sales VALUES (3496, 1313, 196.125);
+INSERT INTO sales VALUES (3497, 1461, 202.625);
+INSERT INTO sales VALUES (3498, 1609, 209.125);
+INSERT INTO sales VALUES (3499, 1757, 215.625);
+INSERT INTO sales VALUES (3500, 1905, 222.125);
+INSERT INTO sales VALUES (3501, 2053, 228.625);
+INSERT INTO sales VALUES (3502, 2201, 235.125);
+INSERT INTO sales VALUES (3503, 2349, 241.625);
+INSERT INTO sales VALUES (3504, 2497, 248.125);
+INSERT INTO sales VALUES (3505, 2645, 254.625);
+INSERT INTO sales VALUES (3506, 2793, 261.125);
+INSERT INTO sales VALUES (3507, 2941, 267.625);
+INSERT INTO sales VALUES (3508, 3089, 274.125);
+INSERT INTO sales VALUES (3509, 3237, 280.625);
+INSERT INTO sales VALUES (3510, 3385, 287.125);
+INSERT INTO sales VALUES (3511, 3533, 293.625);
+INSERT INTO sales VALUES (3512, 3681, 300.125);
+INSERT INTO sales VALUES (3513, 3829, 306.625);
+INSERT INTO sales VALUES (3514, 3977, 313.125);
+INSERT INTO sales VALUES (3515, 4125, 319.625);
+INSERT INTO sales VALUES (3516, 4273, 326.125);
+INSERT INTO sales VALUES (3517, 4421, 332.625);
+INSERT INTO sales VALUES (3518, 4569, 339.125);
+INSERT INTO sales VALUES (3519, 4717, 345.625);
+INSERT INTO sales VALUES (3520, 4865, 352.125);
+INSERT INTO sales VALUES (3521, 5013, 358.625);
+INSERT INTO sales VALUES (3522, 5161, 365.125);
+INSERT INTO sales VALUES (3523, 5309, 371.625);
+INSERT INTO sales VALUES (3524, 5457, 378.125);
+INSERT INTO sales VALUES (3525, 5605, 384.625);
+INSERT INTO sales VALUES (3526, 5753, 391.125);
+INSERT INTO sales VALUES (3527, 5901, 397.625);
+INSERT INTO sales VALUES (3528, 6049, 404.125);
+INSERT INTO sales VALUES (3529, 6197, 410.625);
+INSERT INTO sales VALUES (3530, 6345, 417.125);
+INSERT INTO sales VALUES (3531, 6493, 423.625);
+INSERT INTO sales VALUES (3532, 6641, 430.125);
+INSERT INTO sales VALUES (3533, 6789, 436.625);
+INSERT INTO sales VALUES (3534, 6937, 443.125);
+INSERT INTO sales VALUES (3535, 7085, 449.625);
+INSERT INTO sales VALUES (3536, 7233, 456.125);
+INSERT INTO sales VALUES (3537, 7381, 462.625);
+INSERT INTO sales VALUES (3538, 7529, 469.125);
+INSERT INTO sales VALUES (3539, 7677, 475.625);
+INSERT INTO sales VALUES (3540, 7825, 482.125);
+INSERT INTO sales VALUES (3541, 7973, 488.625);
+INSERT INTO sales VALUES (3542, 8121, 495.125);
+INSERT INTO sales VALUES (3543, 77, 501.625);
+INSERT INTO sales VALUES (3544, 225, 508.125);
+INSERT INTO sales VALUES (3545, 373, 514.625);
+INSERT INTO sales VALUES (3546, 521, 521.125);
+INSERT INTO sales VALUES (3547, 669, 527.625);
+INSERT INTO sales VALUES (3548, 817, 534.125);
+INSERT INTO sales VALUES (3549, 965, 540.625);
+INSERT INTO sales VALUES (3550, 1113, 547.125);
+INSERT INTO sales VALUES (3551, 1261, 553.625);
+INSERT INTO sales VALUES (3552, 1409, 560.125);
+INSERT INTO sales VALUES (3553, 1557, 566.625);
+INSERT INTO sales VALUES (3554, 1705, 573.125);
+INSERT INTO sales VALUES (3555, 1853, 579.625);
+INSERT INTO sales VALUES (3556, 2001, 586.125);
+INSERT INTO sales VALUES (3557, 2149, 592.625);
+INSERT INTO sales VALUES (3558, 2297, 599.125);
+INSERT INTO sales VALUES (3559, 2445, 605.625);
+INSERT INTO sales VALUES (3560, 2593, 612.125);
+INSERT INTO sales VALUES (3561, 2741, 618.625);
+INSERT INTO sales VALUES (3562, 2889, 625.125);
+INSERT INTO sales VALUES (3563, 3037, 631.625);
+INSERT INTO sales VALUES (3564, 3185, 638.125);
+INSERT INTO sales VALUES (3565, 3333, 644.625);
+INSERT INTO sales VALUES (3566, 3481, 651.125);
+INSERT INTO sales VALUES (3567, 3629, 657.625);
+INSERT INTO sales VALUES (3568, 3777, 664.125);
+INSERT INTO sales VALUES (3569, 3925, 670.625);
+INSERT INTO sales VALUES (3570, 4073, 677.125);
+INSERT INTO sales VALUES (3571, 4221, 683.625);
+INSERT INTO sales VALUES (3572, 4369, 690.125);
+INSERT INTO sales VALUES (3573, 4517, 696.625);
+INSERT INTO sales VALUES (3574, 4665, 703.125);
+INSERT INTO sales VALUES (3575, 4813, 709.625);
+INSERT INTO sales VALUES (3576, 4961, 716.125);
+INSERT INTO sales VALUES (3577, 5109, 722.625);
+INSERT INTO sales VALUES (3578, 5257, 729.125);
+INSERT INTO sales VALUES (3579, 5405, 735.625);
+INSERT INTO sales VALUES (3580, 5553, 742.125);
+INSERT INTO sales VALUES (3581, 5701, 748.625);
+INSERT INTO sales VALUES (3582, 5849, 755.125);
+INSERT INTO sales VALUES (3583, 5997, 761.625);
+INSERT INTO sales VALUES (3584, 6145, 768.125);
+INSERT INTO sales VALUES (3585, 6293, 774.625);
+INSERT INTO sales VALUES (3586, 6441, 781.125);
+INSERT INTO sales VALUES (3587, 6589, 787.625);
+INSERT INTO sales VALUES (3588, 6737, 794.125);
+INSERT INTO sales VALUES (3589, 6885, 800.625);
+INSERT INTO sales VALUES (3590, 7033, 807.125);
+INSERT INTO sales VALUES (3591, 7181, 813.625);
+INSERT INTO sales VALUES (3592, 7329, 820.125);
+INSERT INTO sales VALUES (3593, 7477, 826.625);
+INSERT INTO sales VALUES (3594, 7625, 833.125);
+INSERT INTO sales VALUES (3595, 7773, 839.625);
+INSERT INTO sales VALUES (3596, 7921, 846.125);
+INSERT INTO sales VALUES (3597, 8069, 852.625);
+INSERT INTO sales VALUES (3598, 25, 859.125);
+INSERT INTO sales VALUES (3599, 173, 865.625);
+INSERT INTO sales VALUES (3600, 321, 872.125);
+INSERT INTO sales VALUES (3601, 469, 878.625);
+INSERT INTO sales VALUES (3602, 617, 885.125);
+INSERT INTO sales VALUES (3603, 765, 891.625);
+INSERT INTO sales VALUES (3604, 913, 898.125);
+INSERT INTO sales VALUES (3605, 1061, 904.625);
+INSERT INTO sales VALUES (3606, 1209, 911.125);
+INSERT INTO sales VALUES (3607, 1357, 917.625);
+INSERT INTO sales VALUES (3608, 1505, 924.125);
+INSERT INTO sales VALUES (3609, 1653, 930.625);
+INSERT INTO sales VALUES (3610, 1801, 937.125);
+INSERT INTO sales VALUES (3611, 1949, 943.625);
+INSERT INTO sales VALUES (3612, 2097, 950.125);
+INSERT INTO sales VALUES (3613, 2245, 956.625);
+INSERT INTO sales VALUES (3614, 2393, 963.125);
+INSERT INTO sales VALUES (3615, 2541, 969.625);
+INSERT INTO sales VALUES (3616, 2689, 976.125);
+INSERT INTO sales VALUES (3617, 2837, 982.625);
+INSERT INTO sales VALUES (3618, 2985, 989.125);
+INSERT INTO sales VALUES (3619, 3133, 995.625);
+INSERT INTO sales VALUES (3620, 3281, 1002.125);
+INSERT INTO sales VALUES (3621, 3429, 1008.625);
+INSERT INTO sales VALUES (3622, 3577, 1015.125);
+INSERT INTO sales VALUES (3623, 3725, 1021.625);
+INSERT INTO sales VALUES (3624, 3873, 4.125);
+INSERT INTO sales VALUES (3625, 4021, 10.625);
+INSERT INTO sales VALUES (3626, 4169, 17.125);
+INSERT INTO sales VALUES (3627, 4317, 23.625);
+INSERT INTO sales VALUES (3628, 4465, 30.125);
+INSERT INTO sales VALUES (3629, 4613, 36.625);
+INSERT INTO sales VALUES (3630, 4761, 43.125);
+INSERT INTO sales VALUES (3631, 4909, 49.625);
+INSERT INTO sales VALUES (3632, 5057, 56.125);
+INSERT INTO sales VALUES (3633, 5205, 62.625);
+INSERT INTO sales VALUES (3634, 5353, 69.125);
+INSERT INTO sales VALUES (3635, 5501, 75.625);
+INSERT INTO sales VALUES (3636, 5649, 82.125);
+INSERT INTO sales VALUES (3637, 5797, 88.625);
+INSERT INTO sales VALUES (3638, 5945, 95.125);
+INSERT INTO sales VALUES (3639, 6093, 101.625);
+INSERT INTO sales VALUES (3640, 6241, 108.125);
+INSERT INTO sales VALUES (3641, 6389, 114.625);
+INSERT INTO sales VALUES (3642, 6537, 121.125);
+INSERT INTO sales VALUES (3643, 6685, 127.625);
+INSERT INTO sales VALUES (3644, 6833, 134.125);
+INSERT INTO sales VALUES (3645, 6981, 140.625);
+INSERT INTO sales VALUES (3646, 7129, 147.125);
+INSERT INTO sales VALUES (3647, 7277, 153.625);
+INSERT INTO sales VALUES (3648, 7425, 160.125);
+INSERT INTO sales VALUES (3649, 7573, 166.625);
+INSERT INTO sales VALUES (3650, 7721, 173.125);
+INSERT INTO sales VALUES (3651, 7869, 179.625);
+INSERT INTO sales VALUES (3652, 8017, 186.125);
+INSERT INTO sales VALUES (3653, 8165, 192.625);
+INSERT INTO sales VALUES (3654, 121, 199.125);
+INSERT INTO sales VALUES (3655, 269, 205.625);
+INSERT INTO sales VALUES (3656, 417, 212.125);
+INSERT INTO sales VALUES (3657, 565, 218.625);
+INSERT INTO sales VALUES (3658, 713, 225.125);
+INSERT INTO sales VALUES (3659, 861, 231.625);
+INSERT INTO sales VALUES (3660, 1009, 238.125);
+INSERT INTO sales VALUES (3661, 1157, 244.625);
+INSERT INTO sales VALUES (3662, 1305, 251.125);
+INSERT INTO sales VALUES (3663, 1453, 257.625);
+INSERT INTO sales VALUES (3664, 1601, 264.125);
+INSERT INTO sales VALUES (3665, 1749, 270.625);
+INSERT INTO sales VALUES (3666, 1897, 277.125);
+INSERT INTO sales VALUES (3667, 2045, 283.625);
+INSERT INTO sales VALUES (3668, 2193, 290.125);
+INSERT INTO sales VALUES (3669, 2341, 296.625);
+INSERT INTO sales VALUES (3670, 2489, 303.125);
+INSERT INTO sales VALUES (3671, 2637, 309.625);
+INSERT INTO sales VALUES (3672, 2785, 316.125);
+INSERT INTO sales VALUES (3673, 2933, 322.625);
+INSERT INTO sales VALUES (3674, 3081, 329.125);
+INSERT INTO sales VALUES (3675, 3229, 335.625);
+INSERT INTO sales VALUES (3676, 3377, 342.125);
+INSERT INTO sales VALUES (3677, 3525, 348.625);
+INSERT INTO sales VALUES (3678, 3673, 355.125);
+INSERT INTO sales VALUES (3679, 3821, 361.625);
+INSERT INTO sales VALUES (3680, 3969, 368.125);
+INSERT INTO sales VALUES (3681, 4117, 374.625);
+INSERT INTO sales VALUES (3682, 4265, 381.125);
+INSERT INTO sales VALUES (3683, 4413, 387.625);
+INSERT INTO sales VALUES (3684, 4561, 394.125);
+INSERT INTO sales VALUES (3685, 4709, 400.625);
+INSERT INTO sales VALUES (3686, 4857, 407.125);
+INSERT INTO sales VALUES (3687, 5005, 413.625);
+INSERT INTO sales VALUES (3688, 5153, 420.125);
+INSERT INTO sales VALUES (3689, 5301, 426.625);
+INSERT INTO sales VALUES (3690, 5449, 433.125);
+INSERT INTO sales VALUES (3691, 5597, 439.625);
+INSERT INTO sales VALUES (3692, 5745, 446.125);
+INSERT INTO sales VALUES (3693, 5893, 452.625);
+INSERT INTO sales VALUES (3694, 6041, 459.125);
+INSERT INTO sales VALUES (3695, 6189, 465.625);
+INSERT INTO sales VALUES (3696, 6337, 472.125);
+INSERT INTO sales VALUES (3697, 6485, 478.625);
+INSERT INTO sales VALUES (3698, 6633, 485.125);
+INSERT INTO sales VALUES (3699, 6781, 491.625);
+INSERT INTO sales VALUES (3700, 6929, 498.125);
+INSERT INTO sales VALUES (3701, 7077, 504.625);
+INSERT INTO sales VALUES (3702, 7225, 511.125);
+INSERT INTO sales VALUES (3703, 7373, 517.625);
+INSERT INTO sales VALUES (3704, 7521, 524.125);
+INSERT INTO sales VALUES (3705, 7669, 530.625);
+INSERT INTO sales VALUES (3706, 7817, 537.125);
+INSERT INTO sales VALUES (3707, 7965, 543.625);
+INSERT INTO sales VALUES (3708, 8113, 550.125);
+INSERT INTO sales VALUES (3709, 69, 556.625);
+INSERT INTO sales VALUES (3710, 217, 563.125);
+INSERT INTO sales VALUES (3711, 365, 569.625);
+INSERT INTO sales VALUES (3712, 513, 576.125);
+INSERT INTO sales VALUES (3713, 661, 582.625);
+INSERT INTO sales VALUES (3714, 809, 589.125);
+INSERT INTO sales VALUES (3715, 957, 595.625);
+INSERT INTO sales VALUES (3716, 1105, 602.125);
+INSERT INTO sales VALUES (3717, 1253, 608.625);
+INSERT INTO sales VALUES (3718, 1401, 615.125);
+INSERT INTO sales VALUES (3719, 1549, 621.625);
+INSERT INTO sales VALUES (3720, 1697, 628.125);
+INSERT INTO sales VALUES (3721, 1845, 634.625);
+INSERT INTO sales VALUES (3722, 1993, 641.125);
+INSERT INTO sales VALUES (3723, 2141, 647.625);
+INSERT INTO sales VALUES (3724, 2289, 654.125);
+INSERT INTO sales VALUES (3725, 2437, 660.625);
+INSERT INTO sales VALUES (3726, 2585, 667.125);
+INSERT INTO sales VALUES (3727, 2733, 673.625);
+INSERT INTO sales VALUES (3728, 2881, 680.125);
+INSERT INTO sales VALUES (3729, 3029, 686.625);
+INSERT INTO sales VALUES (3730, 3177, 693.125);
+INSERT INTO sales VALUES (3731, 3325, 699.625);
+INSERT INTO sales VALUES (3732, 3473, 706.125);
+INSERT INTO sales VALUES (3733, 3621, 712.625);
+INSERT INTO sales VALUES (3734, 3769, 719.125);
+INSERT INTO sales VALUES (3735, 3917, 725.625);
+INSERT INTO sales VALUES (3736, 4065, 732.125);
+INSERT INTO sales VALUES (3737, 4213, 738.625);
+INSERT INTO sales VALUES (3738, 4361, 745.125);
+INSERT INTO sales VALUES (3739, 4509, 751.625);
+INSERT INTO sales VALUES (3740, 4657, 758.125);
+INSERT INTO sales VALUES (3741, 4805, 764.625);
+INSERT INTO sales VALUES (3742, 4953, 771.125);
+INSERT INTO sales VALUES (3743, 5101, 777.625);
+INSERT INTO sales VALUES (3744, 5249, 784.125);
+INSERT INTO sales VALUES (3745, 5397, 790.625);
+INSERT INTO sales VALUES (3746, 5545, 797.125);
+INSERT INTO sales VALUES (3747, 5693, 803.625);
+INSERT INTO sales VALUES (3748, 5841, 810.125);
+INSERT INTO sales VALUES (3749, 5989, 816.625);
+INSERT INTO sales VALUES (3750, 6137, 823.125);
+INSERT INTO sales VALUES (3751, 6285, 829.625);
+INSERT INTO sales VALUES (3752, 6433, 836.125);
+INSERT INTO sales VALUES (3753, 6581, 842.625);
+INSERT INTO sales VALUES (3754, 6729, 849.125);
+INSERT INTO sales VALUES (3755, 6877, 855.625);
+INSERT INTO sales VALUES (3756, 7025, 862.125);
+INSERT INTO sales VALUES (3757, 7173, 868.625);
+INSERT INTO sales VALUES (3758, 7321, 875.125);
+INSERT INTO sales VALUES (3759, 7469, 881.625);
+INSERT INTO sales VALUES (3760, 7617, 888.125);
+INSERT INTO sales VALUES (3761, 7765, 894.625);
+INSERT INTO sales VALUES (3762, 7913, 901.125);
+INSERT INTO sales VALUES (3763, 8061, 907.625);
+INSERT INTO sales VALUES (3764, 17, 914.125);
+INSERT INTO sales VALUES (3765, 165, 920.625);
+INSERT INTO sales VALUES (3766, 313, 927.125);
+INSERT INTO sales VALUES (3767, 461, 933.625);
+INSERT INTO sales VALUES (3768, 609, 940.125);
+INSERT INTO sales VALUES (3769, 757, 946.625);
+INSERT INTO sales VALUES (3770, 905, 953.125);
+INSERT INTO sales VALUES (3771, 1053, 959.625);
+INSERT INTO sales VALUES (3772, 1201, 966.125);
+INSERT INTO sales VALUES (3773, 1349, 972.625);
+INSERT INTO sales VALUES (3774, 1497, 979.125);
+INSERT INTO sales VALUES (3775, 1645, 985.625);
+INSERT INTO sales VALUES (3776, 1793, 992.125);
+INSERT INTO sales VALUES (3777, 1941, 998.625);
+INSERT INTO sales VALUES (3778, 2089, 1005.125);
+INSERT INTO sales VALUES (3779, 2237, 1011.625);
+INSERT INTO sales VALUES (3780, 2385, 1018.125);
+INSERT INTO sales VALUES (3781, 2533, 0.625);
+INSERT INTO sales VALUES (3782, 2681, 7.125);
+INSERT INTO sales VALUES (3783, 2829, 13.625);
+INSERT INTO sales VALUES (3784, 2977, 20.125);
+INSERT INTO sales VALUES (3785, 3125, 26.625);
+INSERT INTO sales VALUES (3786, 3273, 33.125);
+INSERT INTO sales VALUES (3787, 3421, 39.625);
+INSERT INTO sales VALUES (3788, 3569, 46.125);
+INSERT INTO sales VALUES (3789, 3717, 52.625);
+INSERT INTO sales VALUES (3790, 3865, 59.125);
+INSERT INTO sales VALUES (3791, 4013, 65.625);
+INSERT INTO sales VALUES (3792, 4161, 72.125);
+INSERT INTO sales VALUES (3793, 4309, 78.625);
+INSERT INTO sales VALUES (3794, 4457, 85.125);
+INSERT INTO sales VALUES (3795, 4605, 91.625);
+INSERT INTO sales VALUES (3796, 4753, 98.125);
+INSERT INTO sales VALUES (3797, 4901, 104.625);
+INSERT INTO sales VALUES (3798, 5049, 111.125);
+INSERT INTO sales VALUES (3799, 5197, 117.625);
+INSERT INTO sales VALUES (3800, 5345, 124.125);
+INSERT INTO sales VALUES (3801, 5493, 130.625);
+INSERT INTO sales VALUES (3802, 5641, 137.125);
+INSERT INTO sales VALUES (3803, 5789, 143.625);
+INSERT INTO sales VALUES (3804, 5937, 150.125);
+INSERT INTO sales VALUES (3805, 6085, 156.625);
+INSERT INTO sales VALUES (3806, 6233, 163.125);
+INSERT INTO sales VALUES (3807, 6381, 169.625);
+INSERT INTO sales VALUES (3808, 6529, 176.125);
+INSERT INTO sales VALUES (3809, 6677, 182.625);
+INSERT INTO sales VALUES (3810, 6825, 189.125);
+INSERT INTO sales VALUES (3811, 6973, 195.625);
+INSERT INTO sales VALUES (3812, 7121, 202.125);
+INSERT INTO sales VALUES (3813, 7269, 208.625);
+INSERT INTO sales VALUES (3814, 7417, 215.125);
+INSERT INTO sales VALUES (3815, 7565, 221.625);
+INSERT INTO sales VALUES (3816, 7713, 228.125);
+INSERT INTO sales VALUES (3817, 7861, 234.625);
+INSERT INTO sales VALUES (3818, 8009, 241.125);
+INSERT INTO sales VALUES (3819, 8157, 247.625);
+INSERT INTO sales VALUES (3820, 113, 254.125);
+INSERT INTO sales VALUES (3821, 261, 260.625);
+INSERT INTO sales VALUES (3822, 409, 267.125);
+INSERT INTO sales VALUES (3823, 557, 273.625);
+INSERT INTO sales VALUES (3824, 705, 280.125);
+INSERT INTO sales VALUES (3825, 853, 286.625);
+INSERT INTO sales VALUES (3826, 1001, 293.125);
+INSERT INTO sales VALUES (3827, 1149, 299.625);
+INSERT INTO sales VALUES (3828, 1297, 306.125);
+INSERT INTO sales VALUES (3829, 1445, 312.625);
+INSERT INTO sales VALUES (3830, 1593, 319.125);
+INSERT INTO sales VALUES (3831, 1741, 325.625);
+INSERT INTO sales VALUES (3832, 1889, 332.125);
+INSERT INTO sales VALUES (3833, 2037, 338.625);
+INSERT INTO sales VALUES (3834, 2185, 345.125);
+INSERT INTO sales VALUES (3835, 2333, 351.625);
+INSERT INTO sales VALUES (3836, 2481, 358.125);
+INSERT INTO sales VALUES (3837, 2629, 364.625);
+INSERT INTO sales VALUES (3838, 2777, 371.125);
+INSERT INTO sales VALUES (3839, 2925, 377.625);
+INSERT INTO sales VALUES (3840, 3073, 384.125);
+INSERT INTO sales VALUES (3841, 3221, 390.625);
+INSERT INTO sales VALUES (3842, 3369, 397.125);
+INSERT INTO sales VALUES (3843, 3517, 403.625);
+INSERT INTO sales VALUES (3844, 3665, 410.125);
+INSERT INTO sales VALUES (3845, 3813, 416.625);
+INSERT INTO sales VALUES (3846, 3961, 423.125);
+INSERT INTO sales VALUES (3847, 4109, 429.625);
+INSERT INTO sales VALUES (3848, 4257, 436.125);
+INSERT INTO sales VALUES (3849, 4405, 442.625);
+INSERT INTO sales VALUES (3850, 4553, 449.125);
+INSERT INTO sales VALUES (3851, 4701, 455.625);
+INSERT INTO sales VALUES (3852, 4849, 462.125);
+INSERT INTO sales VALUES (3853, 4997, 468.625);
+INSERT INTO sales VALUES (3854, 5145, 475.125);
+INSERT INTO sales VALUES (3855, 5293, 481.625);
+INSERT INTO sales VALUES (3856, 5441, 488.125);
+INSERT INTO sales VALUES (3857, 5589, 494.625);
+INSERT INTO sales VALUES (3858, 5737, 501.125);
+INSERT INTO sales VALUES (3859, 5885, 507.625);
+INSERT INTO sales VALUES (3860, 6033, 514.125);
+INSERT INTO sales VALUES (3861, 6181, 520.625);
+INSERT INTO sales VALUES (3862, 6329, 527.125);
+INSERT INTO sales VALUES (3863, 6477, 533.625);
+INSERT INTO sales VALUES (3864, 6625, 540.125);
+INSERT INTO sales VALUES (3865, 6773, 546.625);
+INSERT INTO sales VALUES (3866, 6921, 553.125);
+INSERT INTO sales VALUES (3867, 7069, 559.625);
+INSERT INTO sales VALUES (3868, 7217, 566.125);
+INSERT INTO sales VALUES (3869, 7365, 572.625);
+INSERT INTO sales VALUES (3870, 7513, 579.125);
+INSERT INTO sales VALUES (3871, 7661, 585.625);
+INSERT INTO sales VALUES (3872, 7809, 592.125);
+INSERT INTO sales VALUES (3873, 7957, 598.625);
+INSERT INTO sales VALUES (3874, 8105, 605.125);
+INSERT INTO sales VALUES (3875, 61, 611.625);
+INSERT INTO sales VALUES (3876, 209, 618.125);
+INSERT INTO sales VALUES (3877, 357, 624.625);
+INSERT INTO sales VALUES (3878, 505, 631.125);
+INSERT INTO sales VALUES (3879, 653, 637.625);
+INSERT INTO sales VALUES (3880, 801, 644.125);
+INSERT INTO sales VALUES (3881, 949, 650.625);
+INSERT INTO sales VALUES (3882, 1097, 657.125);
+INSERT INTO sales VALUES (3883, 1245, 663.625);
+INSERT INTO sales VALUES (3884, 1393, 670.125);
+INSERT INTO sales VALUES (3885, 1541, 676.625);
+INSERT INTO sales VALUES (3886, 1689, 683.125);
+INSERT INTO sales VALUES (3887, 1837, 689.625);
+INSERT INTO sales VALUES (3888, 1985, 696.125);
+INSERT INTO sales VALUES (3889, 2133, 702.625);
+INSERT INTO sales VALUES (3890, 2281, 709.125);
+INSERT INTO sales VALUES (3891, 2429, 715.625);
+INSERT INTO sales VALUES (3892, 2577, 722.125);
+INSERT INTO sales VALUES (3893, 2725, 728.625);
+INSERT INTO sales VALUES (3894, 2873, 735.125);
+INSERT INTO sales VALUES (3895, 3021, 741.625);
+INSERT INTO sales VALUES (3896, 3169, 748.125);
+INSERT INTO sales VALUES (3897, 3317, 754.625);
+INSERT INTO sales VALUES (3898, 3465, 761.125);
+INSERT INTO sales VALUES (3899, 3613, 767.625);
+INSERT INTO sales VALUES (3900, 3761, 774.125);
+INSERT INTO sales VALUES (3901, 3909, 780.625);
+INSERT INTO sales VALUES (3902, 4057, 787.125);
+INSERT INTO sales VALUES (3903, 4205, 793.625);
+INSERT INTO sales VALUES (3904, 4353, 800.125);
+INSERT INTO sales VALUES (3905, 4501, 806.625);
+INSERT INTO sales VALUES (3906, 4649, 813.125);
+INSERT INTO sales VALUES (3907, 4797, 819.625);
+INSERT INTO sales VALUES (3908, 4945, 826.125);
+INSERT INTO sales VALUES (3909, 5093, 832.625);
+INSERT INTO sales VALUES (3910, 5241, 839.125);
+INSERT INTO sales VALUES (3911, 5389, 845.625);
+INSERT INTO sales VALUES (3912, 5537, 852.125);
+INSERT INTO sales VALUES (3913, 5685, 858.625);
+INSERT INTO sales VALUES (3914, 5833, 865.125);
+INSERT INTO sales VALUES (3915, 5981, 871.625);
+INSERT INTO sales VALUES (3916, 6129, 878.125);
+INSERT INTO sales VALUES (3917, 6277, 884.625);
+INSERT INTO sales VALUES (3918, 6425, 891.125);
+INSERT INTO sales VALUES (3919, 6573, 897.625);
+INSERT INTO sales VALUES (3920, 6721, 904.125);
+INSERT INTO sales VALUES (3921, 6869, 910.625);
+INSERT INTO sales VALUES (3922, 7017, 917.125);
+INSERT INTO sales VALUES (3923, 7165, 923.625);
+INSERT INTO sales VALUES (3924, 7313, 930.125);
+INSERT INTO sales VALUES (3925, 7461, 936.625);
+INSERT INTO sales VALUES (3926, 7609, 943.125);
+INSERT INTO sales VALUES (3927, 7757, 949.625);
+INSERT INTO sales VALUES (3928, 7905, 956.125);
+INSERT INTO sales VALUES (3929, 8053, 962.625);
+INSERT INTO sales VALUES (3930, 9, 969.125);
+INSERT INTO sales VALUES (3931, 157, 975.625);
+INSERT INTO sales VALUES (3932, 305, 982.125);
+INSERT INTO sales VALUES (3933, 453, 988.625);
+INSERT INTO sales VALUES (3934, 601, 995.125);
+INSERT INTO sales VALUES (3935, 749, 1001.625);
+INSERT INTO sales VALUES (3936, 897, 1008.125);
+INSERT INTO sales VALUES (3937, 1045, 1014.625);
+INSERT INTO sales VALUES (3938, 1193, 1021.125);
+INSERT INTO sales VALUES (3939, 1341, 3.625);
+INSERT INTO sales VALUES (3940, 1489, 10.125);
+INSERT INTO sales VALUES (3941, 1637, 16.625);
+INSERT INTO sales VALUES (3942, 1785, 23.125);
+INSERT INTO sales VALUES (3943, 1933, 29.625);
+INSERT INTO sales VALUES (3944, 2081, 36.125);
+INSERT INTO sales VALUES (3945, 2229, 42.625);
+INSERT INTO sales VALUES (3946, 2377, 49.125);
+INSERT INTO sales VALUES (3947, 2525, 55.625);
+INSERT INTO sales VALUES (3948, 2673, 62.125);
+INSERT INTO sales VALUES (3949, 2821, 68.625);
+INSERT INTO sales VALUES (3950, 2969, 75.125);
+INSERT INTO sales VALUES (3951, 3117, 81.625);
+INSERT INTO sales VALUES (3952, 3265, 88.125);
+INSERT INTO sales VALUES (3953, 3413, 94.625);
+INSERT INTO sales VALUES (3954, 3561, 101.125);
+INSERT INTO sales VALUES (3955, 3709, 107.625);
+INSERT INTO sales VALUES (3956, 3857, 114.125);
+INSERT INTO sales VALUES (3957, 4005, 120.625);
+INSERT INTO sales VALUES (3958, 4153, 127.125);
+INSERT INTO sales VALUES (3959, 4301, 133.625);
+INSERT INTO sales VALUES (3960, 4449, 140.125);
+INSERT INTO sales VALUES (3961, 4597, 146.625);
+INSERT INTO sales VALUES (3962, 4745, 153.125);
+INSERT INTO sales VALUES (3963, 4893, 159.625);
+INSERT INTO sales VALUES (3964, 5041, 166.125);
+INSERT INTO sales VALUES (3965, 5189, 172.625);
+INSERT INTO sales VALUES (3966, 5337, 179.125);
+INSERT INTO sales VALUES (3967, 5485, 185.625);
+INSERT INTO sales VALUES (3968, 5633, 192.125);
+INSERT INTO sales VALUES (3969, 5781, 198.625);
+INSERT INTO sales VALUES (3970, 5929, 205.125);
+INSERT INTO sales VALUES (3971, 6077, 211.625);
+INSERT INTO sales VALUES (3972, 6225, 218.125);
+INSERT INTO sales VALUES (3973, 6373, 224.625);
+INSERT INTO sales VALUES (3974, 6521, 231.125);
+INSERT INTO sales VALUES (3975, 6669, 237.625);
+INSERT INTO sales VALUES (3976, 6817, 244.125);
+INSERT INTO sales VALUES (3977, 6965, 250.625);
+INSERT INTO sales VALUES (3978, 7113, 257.125);
+INSERT INTO sales VALUES (3979, 7261, 263.625);
+INSERT INTO sales VALUES (3980, 7409, 270.125);
+INSERT INTO sales VALUES (3981, 7557, 276.625);
+INSERT INTO sales VALUES (3982, 7705, 283.125);
+INSERT INTO sales VALUES (3983, 7853, 289.625);
+INSERT INTO sales VALUES (3984, 8001, 296.125);
+INSERT INTO sales VALUES (3985, 8149, 302.625);
+INSERT INTO sales VALUES (3986, 105, 309.125);
+INSERT INTO sales VALUES (3987, 253, 315.625);
+INSERT INTO sales VALUES (3988, 401, 322.125);
+INSERT INTO sales VALUES (3989, 549, 328.625);
+INSERT INTO sales VALUES (3990, 697, 335.125);
+INSERT INTO sales VALUES (3991, 845, 341.625);
+INSERT INTO sales VALUES (3992, 993, 348.125);
+INSERT INTO sales VALUES (3993, 1141, 354.625);
+INSERT INTO sales VALUES (3994, 1289, 361.125);
+INSERT INTO sales VALUES (3995, 1437, 367.625);
+INSERT INTO sales VALUES (3996, 1585, 374.125);
+INSERT INTO sales VALUES (3997, 1733, 380.625);
+INSERT INTO sales VALUES (3998, 1881, 387.125);
+INSERT INTO sales VALUES (3999, 2029, 393.625);
+INSERT INTO sales VALUES (4000, 2177, 400.125);
+INSERT INTO sales VALUES (4001, 2325, 406.625);
+INSERT INTO sales VALUES (4002, 2473, 413.125);
+INSERT INTO sales VALUES (4003, 2621, 419.625);
+INSERT INTO sales VALUES (4004, 2769, 426.125);
+INSERT INTO sales VALUES (4005, 2917, 432.625);
+INSERT INTO sales VALUES (4006, 3065, 439.125);
+INSERT INTO sales VALUES (4007, 3213, 445.625);
+INSERT INTO sales VALUES (4008, 3361, 452.125);
+INSERT INTO sales VALUES (4009, 3509, 458.625);
+INSERT INTO sales VALUES (4010, 3657, 465.125);
+INSERT INTO sales VALUES (4011, 3805, 471.625);
+INSERT INTO sales VALUES (4012, 3953, 478.125);
+INSERT INTO sales VALUES (4013, 4101, 484.625);
+INSERT INTO sales VALUES (4014, 4249, 491.125);
+INSERT INTO sales VALUES (4015, 4397, 497.625);
+INSERT INTO sales VALUES (4016, 4545, 504.125);
+INSERT INTO sales VALUES (4017, 4693, 510.625);
+INSERT INTO sales VALUES (4018, 4841, 517.125);
+INSERT INTO sales VALUES (4019, 4989, 523.625);
+INSERT INTO sales VALUES (4020, 5137, 530.125);
+INSERT INTO sales VALUES (4021, 5285, 536.625);
+INSERT INTO sales VALUES (4022, 5433, 543.125);
+INSERT INTO sales VALUES (4023, 5581, 549.625);
+INSERT INTO sales VALUES (4024, 5729, 556.125);
+INSERT INTO sales VALUES (4025, 5877, 562.625);
+INSERT INTO sales VALUES (4026, 6025, 569.125);
+INSERT INTO sales VALUES (4027, 6173, 575.625);
+INSERT INTO sales VALUES (4028, 6321, 582.125);
+INSERT INTO sales VALUES (4029, 6469, 588.625);
+INSERT INTO sales VALUES (4030, 6617, 595.125);
+INSERT INTO sales VALUES (4031, 6765, 601.625);
+INSERT INTO sales VALUES (4032, 6913, 608.125);
+INSERT INTO sales VALUES (4033, 7061, 614.625);
+INSERT INTO sales VALUES (4034, 7209, 621.125);
+INSERT INTO sales VALUES (4035, 7357, 627.625);
+INSERT INTO sales VALUES (4036, 7505, 634.125);
+INSERT INTO sales VALUES (4037, 7653, 640.625);
+INSERT INTO sales VALUES (4038, 7801, 647.125);
+INSERT INTO sales VALUES (4039, 7949, 653.625);
+INSERT INTO sales VALUES (4040, 8097, 660.125);
+INSERT INTO sales VALUES (4041, 53, 666.625);
+INSERT INTO sales VALUES (4042, 201, 673.125);
+INSERT INTO sales VALUES (4043, 349, 679.625);
+INSERT INTO sales VALUES (4044, 497, 686.125);
+INSERT INTO sales VALUES (4045, 645, 692.625);
+INSERT INTO sales VALUES (4046, 793, 699.125);
+INSERT INTO sales VALUES (4047, 941, 705.625);
+INSERT INTO sales VALUES (4048, 1089, 712.125);
+INSERT INTO sales VALUES (4049, 1237, 718.625);
+INSERT INTO sales VALUES (4050, 1385, 725.125);
+INSERT INTO sales VALUES (4051, 1533, 731.625);
+INSERT INTO sales VALUES (4052, 1681, 738.125);
+INSERT INTO sales VALUES (4053, 1829, 744.625);
+INSERT INTO sales VALUES (4054, 1977, 751.125);
+INSERT INTO sales VALUES (4055, 2125, 757.625);
+INSERT INTO sales VALUES (4056, 2273, 764.125);
+INSERT INTO sales VALUES (4057, 2421, 770.625);
+INSERT INTO sales VALUES (4058, 2569, 777.125);
+INSERT INTO sales VALUES (4059, 2717, 783.625);
+INSERT INTO sales VALUES (4060, 2865, 790.125);
+INSERT INTO sales VALUES (4061, 3013, 796.625);
+INSERT INTO sales VALUES (4062, 3161, 803.125);
+INSERT INTO sales VALUES (4063, 3309, 809.625);
+INSERT INTO sales VALUES (4064, 3457, 816.125);
+INSERT INTO sales VALUES (4065, 3605, 822.625);
+INSERT INTO sales VALUES (4066, 3753, 829.125);
+INSERT INTO sales VALUES (4067, 3901, 835.625);
+INSERT INTO sales VALUES (4068, 4049, 842.125);
+INSERT INTO sales VALUES (4069, 4197, 848.625);
+INSERT INTO sales VALUES (4070, 4345, 855.125);
+INSERT INTO sales VALUES (4071, 4493, 861.625);
+INSERT INTO sales VALUES (4072, 4641, 868.125);
+INSERT INTO sales VALUES (4073, 4789, 874.625);
+INSERT INTO sales VALUES (4074, 4937, 881.125);
+INSERT INTO sales VALUES (4075, 5085, 887.625);
+INSERT INTO sales VALUES (4076, 5233, 894.125);
+INSERT INTO sales VALUES (4077, 5381, 900.625);
+INSERT INTO sales VALUES (4078, 5529, 907.125);
+INSERT INTO sales VALUES (4079, 5677, 913.625);
+INSERT INTO sales VALUES (4080, 5825, 920.125);
+INSERT INTO sales VALUES (4081, 5973, 926.625);
+INSERT INTO sales VALUES (4082, 6121, 933.125);
+INSERT INTO sales VALUES (4083, 6269, 939.625);
+INSERT INTO sales VALUES (4084, 6417, 946.125);
+INSERT INTO sales VALUES (4085, 6565, 952.625);
+INSERT INTO sales VALUES (4086, 6713, 959.125);
+INSERT INTO sales VALUES (4087, 6861, 965.625);
+INSERT INTO sales VALUES (4088, 7009, 972.125);
+INSERT INTO sales VALUES (4089, 7157, 978.625);
+INSERT INTO sales VALUES (4090, 7305, 985.125);
+INSERT INTO sales VALUES (4091, 7453, 991.625);
+INSERT INTO sales VALUES (4092, 7601, 998.125);
+INSERT INTO sales VALUES (4093, 7749, 1004.625);
+INSERT INTO sales VALUES (4094, 7897, 1011.125);
+INSERT INTO sales VALUES (4095, 8045, 1017.625);
+INSERT INTO sales VALUES (4096, 2, 0.25);
+INSERT INTO sales VALUES (4097, 150, 6.75);
+INSERT INTO sales VALUES (4098, 298, 13.25);
+INSERT INTO sales VALUES (4099, 446, 19.75);
+INSERT INTO sales VALUES (4100, 594, 26.25);
+INSERT INTO sales VALUES (4101, 742, 32.75);
+INSERT INTO sales VALUES (4102, 890, 39.25);
+INSERT INTO sales VALUES (4103, 1038, 45.75);
+INSERT INTO sales VALUES (4104, 1186, 52.25);
+INSERT INTO sales VALUES (4105, 1334, 58.75);
+INSERT INTO sales VALUES (4106, 1482, 65.25);
+INSERT INTO sales VALUES (4107, 1630, 71.75);
+INSERT INTO sales VALUES (4108, 1778, 78.25);
+INSERT INTO sales VALUES (4109, 1926, 84.75);
+INSERT INTO sales VALUES (4110, 2074, 91.25);
+INSERT INTO sales VALUES (4111, 2222, 97.75);
+INSERT INTO sales VALUES (4112, 2370, 104.25);
+INSERT INTO sales VALUES (4113, 2518, 110.75);
+INSERT INTO sales VALUES (4114, 2666, 117.25);
+INSERT INTO sales VALUES (4115, 2814, 123.75);
+INSERT INTO sales VALUES (4116, 2962, 130.25);
+INSERT INTO sales VALUES (4117, 3110, 136.75);
+INSERT INTO sales VALUES (4118, 3258, 143.25);
+INSERT INTO sales VALUES (4119, 3406, 149.75);
+INSERT INTO sales VALUES (4120, 3554, 156.25);
+INSERT INTO sales VALUES (4121, 3702, 162.75);
+INSERT INTO sales VALUES (4122, 3850, 169.25);
+INSERT INTO sales VALUES (4123, 3998, 175.75);
+INSERT INTO sales VALUES (4124, 4146, 182.25);
+INSERT INTO sales VALUES (4125, 4294, 188.75);
+INSERT INTO sales VALUES (4126, 4442, 195.25);
+INSERT INTO sales VALUES (4127, 4590, 201.75);
+INSERT INTO sales VALUES (4128, 4738, 208.25);
+INSERT INTO sales VALUES (4129, 4886, 214.75);
+INSERT INTO sales VALUES (4130, 5034, 221.25);
+INSERT INTO sales VALUES (4131, 5182, 227.75);
+INSERT INTO sales VALUES (4132, 5330, 234.25);
+INSERT INTO sales VALUES (4133, 5478, 240.75);
+INSERT INTO sales VALUES (4134, 5626, 247.25);
+INSERT INTO sales VALUES (4135, 5774, 253.75);
+INSERT INTO sales VALUES (4136, 5922, 260.25);
+INSERT INTO sales VALUES (4137, 6070, 266.75);
+INSERT INTO sales VALUES (4138, 6218, 273.25);
+INSERT INTO sales VALUES (4139, 6366, 279.75);
+INSERT INTO sales VALUES (4140, 6514, 286.25);
+INSERT INTO sales VALUES (4141, 6662, 292.75);
+INSERT INTO sales VALUES (4142, 6810, 299.25);
+INSERT INTO sales VALUES (4143, 6958, 305.75);
+INSERT INTO sales VALUES (4144, 7106, 312.25);
+INSERT INTO sales VALUES (4145, 7254, 318.75);
+INSERT INTO sales VALUES (4146, 7402, 325.25);
+INSERT INTO sales VALUES (4147, 7550, 331.75);
+INSERT INTO sales VALUES (4148, 7698, 338.25);
+INSERT INTO sales VALUES (4149, 7846, 344.75);
+INSERT INTO sales VALUES (4150, 7994, 351.25);
+INSERT INTO sales VALUES (4151, 8142, 357.75);
+INSERT INTO sales VALUES (4152, 98, 364.25);
+INSERT INTO sales VALUES (4153, 246, 370.75);
+INSERT INTO sales VALUES (4154, 394, 377.25);
+INSERT INTO sales VALUES (4155, 542, 383.75);
+INSERT INTO sales VALUES (4156, 690, 390.25);
+INSERT INTO sales VALUES (4157, 838, 396.75);
+INSERT INTO sales VALUES (4158, 986, 403.25);
+INSERT INTO sales VALUES (4159, 1134, 409.75);
+INSERT INTO sales VALUES (4160, 1282, 416.25);
+INSERT INTO sales VALUES (4161, 1430, 422.75);
+INSERT INTO sales VALUES (4162, 1578, 429.25);
+INSERT INTO sales VALUES (4163, 1726, 435.75);
+INSERT INTO sales VALUES (4164, 1874, 442.25);
+INSERT INTO sales VALUES (4165, 2022, 448.75);
+INSERT INTO sales VALUES (4166, 2170, 455.25);
+INSERT INTO sales VALUES (4167, 2318, 461.75);
+INSERT INTO sales VALUES (4168, 2466, 468.25);
+INSERT INTO sales VALUES (4169, 2614, 474.75);
+INSERT INTO sales VALUES (4170, 2762, 481.25);
+INSERT INTO sales VALUES (4171, 2910, 487.75);
+INSERT INTO sales VALUES (4172, 3058, 494.25);
+INSERT INTO sales VALUES (4173, 3206, 500.75);
+INSERT INTO sales VALUES (4174, 3354, 507.25);
+INSERT INTO sales VALUES (4175, 3502, 513.75);
+INSERT INTO sales VALUES (4176, 3650, 520.25);
+INSERT INTO sales VALUES (4177, 3798, 526.75);
+INSERT INTO sales VALUES (4178, 3946, 533.25);
+INSERT INTO sales VALUES (4179, 4094, 539.75);
+INSERT INTO sales VALUES (4180, 4242, 546.25);
+INSERT INTO sales VALUES (4181, 4390, 552.75);
+INSERT INTO sales VALUES (4182, 4538, 559.25);
+INSERT INTO sales VALUES (4183, 4686, 565.75);
+INSERT INTO sales VALUES (4184, 4834, 572.25);
+INSERT INTO sales VALUES (4185, 4982, 578.75);
+INSERT INTO sales VALUES (4186, 5130, 585.25);
+INSERT INTO sales VALUES (4187, 5278, 591.75);
+INSERT INTO sales VALUES (4188, 5426, 598.25);
+INSERT INTO sales VALUES (4189, 5574, 604.75);
+INSERT INTO sales VALUES (4190, 5722, 611.25);
+INSERT INTO sales VALUES (4191, 5870, 617.75);
+INSERT INTO sales VALUES (4192, 6018, 624.25);
+INSERT INTO sales VALUES (4193, 6166, 630.75);
+INSERT INTO sales VALUES (4194, 6314, 637.25);
+INSERT INTO sales VALUES (4195, 6462, 643.75);
+INSERT INTO sales VALUES (4196, 6610, 650.25);
+INSERT INTO sales VALUES (4197, 6758, 656.75);
+INSERT INTO sales VALUES (4198, 6906, 663.25);
+INSERT INTO sales VALUES (4199, 7054, 669.75);
+INSERT INTO sales VALUES (4200, 7202, 676.25);
+INSERT INTO sales VALUES (4201, 7350, 682.75);
+INSERT INTO sales VALUES (4202, 7498, 689.25);
+INSERT INTO sales VALUES (4203, 7646, 695.75);
+INSERT INTO sales VALUES (4204, 7794, 702.25);
+INSERT INTO sales VALUES (4205, 7942, 708.75);
+INSERT INTO sales VALUES (4206, 8090, 715.25);
+INSERT INTO sales VALUES (4207, 46, 721.75);
+INSERT INTO sales VALUES (4208, 194, 728.25);
+INSERT INTO sales VALUES (4209, 342, 734.75);
+INSERT INTO sales VALUES (4210, 490, 741.25);
+INSERT INTO sales VALUES (4211, 638, 747.75);
+INSERT INTO sales VALUES (4212, 786, 754.25);
+INSERT INTO sales VALUES (4213, 934, 760.75);
+INSERT INTO sales VALUES (4214, 1082, 767.25);
+INSERT INTO sales VALUES (4215, 1230, 773.75);
+INSERT INTO sales VALUES (4216, 1378, 780.25);
+INSERT INTO sales VALUES (4217, 1526, 786.75);
+INSERT INTO sales VALUES (4218, 1674, 793.25);
+INSERT INTO sales VALUES (4219, 1822, 799.75);
+INSERT INTO sales VALUES (4220, 1970, 806.25);
+INSERT INTO sales VALUES (4221, 2118, 812.75);
+INSERT INTO sales VALUES (4222, 2266, 819.25);
+INSERT INTO sales VALUES (4223, 2414, 825.75);
+INSERT INTO sales VALUES (4224, 2562, 832.25);
+INSERT INTO sales VALUES (4225, 2710, 838.75);
+INSERT INTO sales VALUES (4226, 2858, 845.25);
+INSERT INTO sales VALUES (4227, 3006, 851.75);
+INSERT INTO sales VALUES (4228, 3154, 858.25);
+INSERT INTO sales VALUES (4229, 3302, 864.75);
+INSERT INTO sales VALUES (4230, 3450, 871.25);
+INSERT INTO sales VALUES (4231, 3598, 877.75);
+INSERT INTO sales VALUES (4232, 3746, 884.25);
+INSERT INTO sales VALUES (4233, 3894, 890.75);
+INSERT INTO sales VALUES (4234, 4042, 897.25);
+INSERT INTO sales VALUES (4235, 4190, 903.75);
+INSERT INTO sales VALUES (4236, 4338, 910.25);
+INSERT INTO sales VALUES (4237, 4486, 916.75);
+INSERT INTO sales VALUES (4238, 4634, 923.25);
+INSERT INTO sales VALUES (4239, 4782, 929.75);
+INSERT INTO sales VALUES (4240, 4930, 936.25);
+INSERT INTO sales VALUES (4241, 5078, 942.75);
+INSERT INTO sales VALUES (4242, 5226, 949.25);
+INSERT INTO sales VALUES (4243, 5374, 955.75);
+INSERT INTO sales VALUES (4244, 5522, 962.25);
+INSERT INTO sales VALUES (4245, 5670, 968.75);
+INSERT INTO sales VALUES (4246, 5818, 975.25);
+INSERT INTO sales VALUES (4247, 5966, 981.75);
+INSERT INTO sales VALUES (4248, 6114, 988.25);
+INSERT INTO sales VALUES (4249, 6262, 994.75);
+INSERT INTO sales VALUES (4250, 6410, 1001.25);
+INSERT INTO sales VALUES (4251, 6558, 1007.75);
+INSERT INTO sales VALUES (4252, 6706, 1014.25);
+INSERT INTO sales VALUES (4253, 6854, 1020.75);
+INSERT INTO sales VALUES (4254, 7002, 3.25);
+INSERT INTO sales VALUES (4255, 7150, 9.75);
+INSERT INTO sales VALUES (4256, 7298, 16.25);
+INSERT INTO sales VALUES (4257, 7446, 22.75);
+INSERT INTO sales VALUES (4258, 7594, 29.25);
+INSERT INTO sales VALUES (4259, 7742, 35.75);
+INSERT INTO sales VALUES (4260, 7890, 42.25);
+INSERT INTO sales VALUES (4261, 8038, 48.75);
+INSERT INTO sales VALUES (4262, 8186, 55.25);
+INSERT INTO sales VALUES (4263, 142, 61.75);
+INSERT INTO sales VALUES (4264, 290, 68.25);
+INSERT INTO sales VALUES (4265, 438, 74.75);
+INSERT INTO sales VALUES (4266, 586, 81.25);
+INSERT INTO sales VALUES (4267, 734, 87.75);
+INSERT INTO sales VALUES (4268, 882, 94.25);
+INSERT INTO sales VALUES (4269, 1030, 100.75);
+INSERT INTO sales VALUES (4270, 1178, 107.25);
+INSERT INTO sales VALUES (4271, 1326, 113.75);
+INSERT INTO sales VALUES (4272, 1474, 120.25);
+INSERT INTO sales VALUES (4273, 1622, 126.75);
+INSERT INTO sales VALUES (4274, 1770, 133.25);
+INSERT INTO sales VALUES (4275, 1918, 139.75);
+INSERT INTO sales VALUES (4276, 2066, 146.25);
+INSERT INTO sales VALUES (4277, 2214, 152.75);
+INSERT INTO sales VALUES (4278, 2362, 159.25);
+INSERT INTO sales VALUES (4279, 2510, 165.75);
+INSERT INTO sales VALUES (4280, 2658, 172.25);
+INSERT INTO sales VALUES (4281, 2806, 178.75);
+INSERT INTO sales VALUES (4282, 2954, 185.25);
+INSERT INTO sales VALUES (4283, 3102, 191.75);
+INSERT INTO sales VALUES (4284, 3250, 198.25);
+INSERT INTO sales VALUES (4285, 3398, 204.75);
+INSERT INTO sales VALUES (4286, 3546, 211.25);
+INSERT INTO sales VALUES (4287, 3694, 217.75);
+INSERT INTO sales VALUES (4288, 3842, 224.25);
+INSERT INTO sales VALUES (4289, 3990, 230.75);
+INSERT INTO sales VALUES (4290, 4138, 237.25);
+INSERT INTO sales VALUES (4291, 4286, 243.75);
+INSERT INTO sales VALUES (4292, 4434, 250.25);
+INSERT INTO sales VALUES (4293, 4582, 256.75);
+INSERT INTO sales VALUES (4294, 4730, 263.25);
+INSERT INTO sales VALUES (4295, 4878, 269.75);
+INSERT INTO sales VALUES (4296, 5026, 276.25);
+INSERT INTO sales VALUES (4297, 5174, 282.75);
+INSERT INTO sales VALUES (4298, 5322, 289.25);
+INSERT INTO sales VALUES (4299, 5470, 295.75);
+INSERT INTO sales VALUES (4300, 5618, 302.25);
+INSERT INTO sales VALUES (4301, 5766, 308.75);
+INSERT INTO sales VALUES (4302, 5914, 315.25);
+INSERT INTO sales VALUES (4303, 6062, 321.75);
+INSERT INTO sales VALUES (4304, 6210, 328.25);
+INSERT INTO sales VALUES (4305, 6358, 334.75);
+INSERT INTO sales VALUES (4306, 6506, 341.25);
+INSERT INTO sales VALUES (4307, 6654, 347.75);
+INSERT INTO sales VALUES (4308, 6802, 354.25);
+INSERT INTO sales VALUES (4309, 6950, 360.75);
+INSERT INTO sales VALUES (4310, 7098, 367.25);
+INSERT INTO sales VALUES (4311, 7246, 373.75);
+INSERT INTO sales VALUES (4312, 7394, 380.25);
+INSERT INTO sales VALUES (4313, 7542, 386.75);
+INSERT INTO sales VALUES (4314, 7690, 393.25);
+INSERT INTO sales VALUES (4315, 7838, 399.75);
+INSERT INTO sales VALUES (4316, 7986, 406.25);
+INSERT INTO sales VALUES (4317, 8134, 412.75);
+INSERT INTO sales VALUES (4318, 90, 419.25);
+INSERT INTO sales VALUES (4319, 238, 425.75);
+INSERT INTO sales VALUES (4320, 386, 432.25);
+INSERT INTO sales VALUES (4321, 534, 438.75);
+INSERT INTO sales VALUES (4322, 682, 445.25);
+INSERT INTO sales VALUES (4323, 830, 451.75);
+INSERT INTO sales VALUES (4324, 978, 458.25);
+INSERT INTO sales VALUES (4325, 1126, 464.75);
+INSERT INTO sales VALUES (4326, 1274, 471.25);
+INSERT INTO sales VALUES (4327, 1422, 477.75);
+INSERT INTO sales VALUES (4328, 1570, 484.25);
+INSERT INTO sales VALUES (4329, 1718, 490.75);
+INSERT INTO sales VALUES (4330, 1866, 497.25);
+INSERT INTO sales VALUES (4331, 2014, 503.75);
+INSERT INTO sales VALUES (4332, 2162, 510.25);
+INSERT INTO sales VALUES (4333, 2310, 516.75);
+INSERT INTO sales VALUES (4334, 2458, 523.25);
+INSERT INTO sales VALUES (4335, 2606, 529.75);
+INSERT INTO sales VALUES (4336, 2754, 536.25);
+INSERT INTO sales VALUES (4337, 2902, 542.75);
+INSERT INTO sales VALUES (4338, 3050, 549.25);
+INSERT INTO sales VALUES (4339, 3198, 555.75);
+INSERT INTO sales VALUES (4340, 3346, 562.25);
+INSERT INTO sales VALUES (4341, 3494, 568.75);
+INSERT INTO sales VALUES (4342, 3642, 575.25);
+INSERT INTO sales VALUES (4343, 3790, 581.75);
+INSERT INTO sales VALUES (4344, 3938, 588.25);
+INSERT INTO sales VALUES (4345, 4086, 594.75);
+INSERT INTO sales VALUES (4346, 4234, 601.25);
+INSERT INTO sales VALUES (4347, 4382, 607.75);
+INSERT INTO sales VALUES (4348, 4530, 614.25);
+INSERT INTO sales VALUES (4349, 4678, 620.75);
+INSERT INTO sales VALUES (4350, 4826, 627.25);
+INSERT INTO sales VALUES (4351, 4974, 633.75);
+INSERT INTO sales VALUES (4352, 5122, 640.25);
+INSERT INTO sales VALUES (4353, 5270, 646.75);
+INSERT INTO sales VALUES (4354, 5418, 653.25);
+INSERT INTO sales VALUES (4355, 5566, 659.75);
+INSERT INTO sales VALUES (4356, 5714, 666.25);
+INSERT INTO sales VALUES (4357, 5862, 672.75);
+INSERT INTO sales VALUES (4358, 6010, 679.25);
+INSERT INTO sales VALUES (4359, 6158, 685.75);
+INSERT INTO sales VALUES (4360, 6306, 692.25);
+INSERT INTO sales VALUES (4361, 6454, 698.75);
+INSERT INTO sales VALUES (4362, 6602, 705.25);
+INSERT INTO sales VALUES (4363, 6750, 711.75);
+INSERT INTO sales VALUES (4364, 6898, 718.25);
+INSERT INTO sales VALUES (4365, 7046, 724.75);
+INSERT INTO sales VALUES (4366, 7194, 731.25);
+INSERT INTO sales VALUES (4367, 7342, 737.75);
+INSERT INTO sales VALUES (4368, 7490, 744.25);
+INSERT INTO sales VALUES (4369, 7638, 750.75);
+INSERT INTO sales VALUES (4370, 7786, 757.25);
+INSERT INTO sales VALUES (4371, 7934, 763.75);
+INSERT INTO sales VALUES (4372, 8082, 770.25);
+INSERT INTO sales VALUES (4373, 38, 776.75);
+INSERT INTO sales VALUES (4374, 186, 783.25);
+INSERT INTO sales VALUES (4375, 334, 789.75);
+INSERT INTO sales VALUES (4376, 482, 796.25);
+INSERT INTO sales VALUES (4377, 630, 802.75);
+INSERT INTO sales VALUES (4378, 778, 809.25);
+INSERT INTO sales VALUES (4379, 926, 815.75);
+INSERT INTO sales VALUES (4380, 1074, 822.25);
+INSERT INTO sales VALUES (4381, 1222, 828.75);
+INSERT INTO sales VALUES (4382, 1370, 835.25);
+INSERT INTO sales VALUES (4383, 1518, 841.75);
+INSERT INTO sales VALUES (4384, 1666, 848.25);
+INSERT INTO sales VALUES (4385, 1814, 854.75);
+INSERT INTO sales VALUES (4386, 1962, 861.25);
+INSERT INTO sales VALUES (4387, 2110, 867.75);
+INSERT INTO sales VALUES (4388, 2258, 874.25);
+INSERT INTO sales VALUES (4389, 2406, 880.75);
+INSERT INTO sales VALUES (4390, 2554, 887.25);
+INSERT INTO sales VALUES (4391, 2702, 893.75);
+INSERT INTO sales VALUES (4392, 2850, 900.25);
+INSERT INTO sales VALUES (4393, 2998, 906.75);
+INSERT INTO sales VALUES (4394, 3146, 913.25);
+INSERT INTO sales VALUES (4395, 3294, 919.75);
+INSERT INTO sales VALUES (4396, 3442, 926.25);
+INSERT INTO sales VALUES (4397, 3590, 932.75);
+INSERT INTO sales VALUES (4398, 3738, 939.25);
+INSERT INTO sales VALUES (4399, 3886, 945.75);
+INSERT INTO sales VALUES (4400, 4034, 952.25);
+INSERT INTO sales VALUES (4401, 4182, 958.75);
+INSERT INTO sales VALUES (4402, 4330, 965.25);
+INSERT INTO sales VALUES (4403, 4478, 971.75);
+INSERT INTO sales VALUES (4404, 4626, 978.25);
+INSERT INTO sales VALUES (4405, 4774, 984.75);
+INSERT INTO sales VALUES (4406, 4922, 991.25);
+INSERT INTO sales VALUES (4407, 5070, 997.75);
+INSERT INTO sales VALUES (4408, 5218, 1004.25);
+INSERT INTO sales VALUES (4409, 5366, 1010.75);
+INSERT INTO sales VALUES (4410, 5514, 1017.25);
+INSERT INTO sales VALUES (4411, 5662, 1023.75);
+INSERT INTO sales VALUES (4412, 5810, 6.25);
+INSERT INTO sales VALUES (4413, 5958, 12.75);
+INSERT INTO sales VALUES (4414, 6106, 19.25);
+INSERT INTO sales VALUES (4415, 6254, 25.75);
+INSERT INTO sales VALUES (4416, 6402, 32.25);
+INSERT INTO sales VALUES (4417, 6550, 38.75);
+INSERT INTO sales VALUES (4418, 6698, 45.25);
+INSERT INTO sales VALUES (4419, 6846, 51.75);
+INSERT INTO sales VALUES (4420, 6994, 58.25);
+INSERT INTO sales VALUES (4421, 7142, 64.75);
+INSERT INTO sales VALUES (4422, 7290, 71.25);
+INSERT INTO sales VALUES (4423, 7438, 77.75);
+INSERT INTO sales VALUES (4424, 7586, 84.25);
+INSERT INTO sales VALUES (4425, 7734, 90.75);
+INSERT INTO sales VALUES (4426, 7882, 97.25);
+INSERT INTO sales VALUES (4427, 8030, 103.75);
+INSERT INTO sales VALUES (4428, 8178, 110.25);
+INSERT INTO sales VALUES (4429, 134, 116.75);
+INSERT INTO sales VALUES (4430, 282, 123.25);
+INSERT INTO sales VALUES (4431, 430, 129.75);
+INSERT INTO sales VALUES (4432, 578, 136.25);
+INSERT INTO sales VALUES (4433, 726, 142.75);
+INSERT INTO sales VALUES (4434, 874, 149.25);
+INSERT INTO sales VALUES (4435, 1022, 155.75);
+INSERT INTO sales VALUES (4436, 1170, 162.25);
+INSERT INTO sales VALUES (4437, 1318, 168.75);
+INSERT INTO sales VALUES (4438, 1466, 175.25);
+INSERT INTO sales VALUES (4439, 1614, 181.75);
+INSERT INTO sales VALUES (4440, 1762, 188.25);
+INSERT INTO sales VALUES (4441, 1910, 194.75);
+INSERT INTO sales VALUES (4442, 2058, 201.25);
+INSERT INTO sales VALUES (4443, 2206, 207.75);
+INSERT INTO sales VALUES (4444, 2354, 214.25);
+INSERT INTO sales VALUES (4445, 2502, 220.75);
+INSERT INTO sales VALUES (4446, 2650, 227.25);
+INSERT INTO sales VALUES (4447, 2798, 233.75);
+INSERT INTO sales VALUES (4448, 2946, 240.25);
+INSERT INTO sales VALUES (4449, 3094, 246.75);
+INSERT INTO sales VALUES (4450, 3242, 253.25);
+INSERT INTO sales VALUES (4451, 3390, 259.75);
+INSERT INTO sales VALUES (4452, 3538, 266.25);
+INSERT INTO sales VALUES (4453, 3686, 272.75);
+INSERT INTO sales VALUES (4454, 3834, 279.25);
+INSERT INTO sales VALUES (4455, 3982, 285.75);
+INSERT INTO sales VALUES (4456, 4130, 292.25);
+INSERT INTO sales VALUES (4457, 4278, 298.75);
+INSERT INTO sales VALUES (4458, 4426, 305.25);
+INSERT INTO sales VALUES (4459, 4574, 311.75);
+INSERT INTO sales VALUES (4460, 4722, 318.25);
+INSERT INTO sales VALUES (4461, 4870, 324.75);
+INSERT INTO sales VALUES (4462, 5018, 331.25);
+INSERT INTO sales VALUES (4463, 5166, 337.75);
+INSERT INTO sales VALUES (4464, 5314, 344.25);
+INSERT INTO sales VALUES (4465, 5462, 350.75);
+INSERT INTO sales VALUES (4466, 5610, 357.25);
+INSERT INTO sales VALUES (4467, 5758, 363.75);
+INSERT INTO sales VALUES (4468, 5906, 370.25);
+INSERT INTO sales VALUES (4469, 6054, 376.75);
+INSERT INTO sales VALUES (4470, 6202, 383.25);
+INSERT INTO sales VALUES (4471, 6350, 389.75);
+INSERT INTO sales VALUES (4472, 6498, 396.25);
+INSERT INTO sales VALUES (4473, 6646, 402.75);
+INSERT INTO sales VALUES (4474, 6794, 409.25);
+INSERT INTO sales VALUES (4475, 6942, 415.75);
+INSERT INTO sales VALUES (4476, 7090, 422.25);
+INSERT INTO sales VALUES (4477, 7238, 428.75);
+INSERT INTO sales VALUES (4478, 7386, 435.25);
+INSERT INTO sales VALUES (4479, 7534, 441.75);
+INSERT INTO sales VALUES (4480, 7682, 448.25);
+INSERT INTO sales VALUES (4481, 7830, 454.75);
+INSERT INTO sales VALUES (4482, 7978, 461.25);
+INSERT INTO sales VALUES (4483, 8126, 467.75);
+INSERT INTO sales VALUES (4484, 82, 474.25);
+INSERT INTO sales VALUES (4485, 230, 480.75);
+INSERT INTO sales VALUES (4486, 378, 487.25);
+INSERT INTO sales VALUES (4487, 526, 493.75);
+INSERT INTO sales VALUES (4488, 674, 500.25);
+INSERT INTO sales VALUES (4489, 822, 506.75);
+INSERT INTO sales VALUES (4490, 970, 513.25);
+INSERT INTO sales VALUES (4491, 1118, 519.75);
+INSERT INTO sales VALUES (4492, 1266, 526.25);
+INSERT INTO sales VALUES (4493, 1414, 532.75);
+INSERT INTO sales VALUES (4494, 1562, 539.25);
+INSERT INTO sales VALUES (4495, 1710, 545.75);
+INSERT INTO sales VALUES (4496, 1858, 552.25);
+INSERT INTO sales VALUES (4497, 2006, 558.75);
+INSERT INTO sales VALUES (4498, 2154, 565.25);
+INSERT INTO sales VALUES (4499, 2302, 571.75);
+INSERT INTO sales VALUES (4500, 2450, 578.25);
+INSERT INTO sales VALUES (4501, 2598, 584.75);
+INSERT INTO sales VALUES (4502, 2746, 591.25);
+INSERT INTO sales VALUES (4503, 2894, 597.75);
+INSERT INTO sales VALUES (4504, 3042, 604.25);
+INSERT INTO sales VALUES (4505, 3190, 610.75);
+INSERT INTO sales VALUES (4506, 3338, 617.25);
+INSERT INTO sales VALUES (4507, 3486, 623.75);
+INSERT INTO sales VALUES (4508, 3634, 630.25);
+INSERT INTO sales VALUES (4509, 3782, 636.75);
+INSERT INTO sales VALUES (4510, 3930, 643.25);
+INSERT INTO sales VALUES (4511, 4078, 649.75);
+INSERT INTO sales VALUES (4512, 4226, 656.25);
+INSERT INTO sales VALUES (4513, 4374, 662.75);
+INSERT INTO sales VALUES (4514, 4522, 669.25);
+INSERT INTO sales VALUES (4515, 4670, 675.75);
+INSERT INTO sales VALUES (4516, 4818, 682.25);
+INSERT INTO sales VALUES (4517, 4966, 688.75);
+INSERT INTO sales VALUES (4518, 5114, 695.25);
+INSERT INTO sales VALUES (4519, 5262, 701.75);
+INSERT INTO sales VALUES (4520, 5410, 708.25);
+INSERT INTO sales VALUES (4521, 5558, 714.75);
+INSERT INTO sales VALUES (4522, 5706, 721.25);
+INSERT INTO sales VALUES (4523, 5854, 727.75);
+INSERT INTO sales VALUES (4524, 6002, 734.25);
+INSERT INTO sales VALUES (4525, 6150, 740.75);
+INSERT INTO sales VALUES (4526, 6298, 747.25);
+INSERT INTO sales VALUES (4527, 6446, 753.75);
+INSERT INTO sales VALUES (4528, 6594, 760.25);
+INSERT INTO sales VALUES (4529, 6742, 766.75);
+INSERT INTO sales VALUES (4530, 6890, 773.25);
+INSERT INTO sales VALUES (4531, 7038, 779.75);
+INSERT INTO sales VALUES (4532, 7186, 786.25);
+INSERT INTO sales VALUES (4533, 7334, 792.75);
+INSERT INTO sales VALUES (4534, 7482, 799.25);
+INSERT INTO sales VALUES (4535, 7630, 805.75);
+INSERT INTO sales VALUES (4536, 7778, 812.25);
+INSERT INTO sales VALUES (4537, 7926, 818.75);
+INSERT INTO sales VALUES (4538, 8074, 825.25);
+INSERT INTO sales VALUES (4539, 30, 831.75);
+INSERT INTO sales VALUES (4540, 178, 838.25);
+INSERT INTO sales VALUES (4541, 326, 844.75);
+INSERT INTO sales VALUES (4542, 474, 851.25);
+INSERT INTO sales VALUES (4543, 622, 857.75);
+INSERT INTO sales VALUES (4544, 770, 864.25);
+INSERT INTO sales VALUES (4545, 918, 870.75);
+INSERT INTO sales VALUES (4546, 1066, 877.25);
+INSERT INTO sales VALUES (4547, 1214, 883.75);
+INSERT INTO sales VALUES (4548, 1362, 890.25);
+INSERT INTO sales VALUES (4549, 1510, 896.75);
+INSERT INTO sales VALUES (4550, 1658, 903.25);
+INSERT INTO sales VALUES (4551, 1806, 909.75);
+INSERT INTO sales VALUES (4552, 1954, 916.25);
+INSERT INTO sales VALUES (4553, 2102, 922.75);
+INSERT INTO sales VALUES (4554, 2250, 929.25);
+INSERT INTO sales VALUES (4555, 2398, 935.75);
+INSERT INTO sales VALUES (4556, 2546, 942.25);
+INSERT INTO sales VALUES (4557, 2694, 948.75);
+INSERT INTO sales VALUES (4558, 2842, 955.25);
+INSERT INTO sales VALUES (4559, 2990, 961.75);
+INSERT INTO sales VALUES (4560, 3138, 968.25);
+INSERT INTO sales VALUES (4561, 3286, 974.75);
+INSERT INTO sales VALUES (4562, 3434, 981.25);
+INSERT INTO sales VALUES (4563, 3582, 987.75);
+INSERT INTO sales VALUES (4564, 3730, 994.25);
+INSERT INTO sales VALUES (4565, 3878, 1000.75);
+INSERT INTO sales VALUES (4566, 4026, 1007.25);
+INSERT INTO sales VALUES (4567, 4174, 1013.75);
+INSERT INTO sales VALUES (4568, 4322, 1020.25);
+INSERT INTO sales VALUES (4569, 4470, 2.75);
+INSERT INTO sales VALUES (4570, 4618, 9.25);
+INSERT INTO sales VALUES (4571, 4766, 15.75);
+INSERT INTO sales VALUES (4572, 4914, 22.25);
+INSERT INTO sales VALUES (4573, 5062, 28.75);
+INSERT INTO sales VALUES (4574, 5210, 35.25);
+INSERT INTO sales VALUES (4575, 5358, 41.75);
+INSERT INTO sales VALUES (4576, 5506, 48.25);
+INSERT INTO sales VALUES (4577, 5654, 54.75);
+INSERT INTO sales VALUES (4578, 5802, 61.25);
+INSERT INTO sales VALUES (4579, 5950, 67.75);
+INSERT INTO sales VALUES (4580, 6098, 74.25);
+INSERT INTO sales VALUES (4581, 6246, 80.75);
+INSERT INTO sales VALUES (4582, 6394, 87.25);
+INSERT INTO sales VALUES (4583, 6542, 93.75);
+INSERT INTO sales VALUES (4584, 6690, 100.25);
+INSERT INTO sales VALUES (4585, 6838, 106.75);
+INSERT INTO sales VALUES (4586, 6986, 113.25);
+INSERT INTO sales VALUES (4587, 7134, 119.75);
+INSERT INTO sales VALUES (4588, 7282, 126.25);
+INSERT INTO sales VALUES (4589, 7430, 132.75);
+INSERT INTO sales VALUES (4590, 7578, 139.25);
+INSERT INTO sales VALUES (4591, 7726, 145.75);
+INSERT INTO sales VALUES (4592, 7874, 152.25);
+INSERT INTO sales VALUES (4593, 8022, 158.75);
+INSERT INTO sales VALUES (4594, 8170, 165.25);
+INSERT INTO sales VALUES (4595, 126, 171.75);
+INSERT INTO sales VALUES (4596, 274, 178.25);
+INSERT INTO sales VALUES (4597, 422, 184.75);
+INSERT INTO sales VALUES (4598, 570, 191.25);
+INSERT INTO sales VALUES (4599, 718, 197.75);
+INSERT INTO sales VALUES (4600, 866, 204.25);
+INSERT INTO sales VALUES (4601, 1014, 210.75);
+INSERT INTO sales VALUES (4602, 1162, 217.25);
+INSERT INTO sales VALUES (4603, 1310, 223.75);
+INSERT INTO sales VALUES (4604, 1458, 230.25);
+INSERT INTO sales VALUES (4605, 1606, 236.75);
+INSERT INTO sales VALUES (4606, 1754, 243.25);
+INSERT INTO sales VALUES (4607, 1902, 249.75);
+INSERT INTO sales VALUES (4608, 2050, 256.25);
+INSERT INTO sales VALUES (4609, 2198, 262.75);
+INSERT INTO sales VALUES (4610, 2346, 269.25);
+INSERT INTO sales VALUES (4611, 2494, 275.75);
+INSERT INTO sales VALUES (4612, 2642, 282.25);
+INSERT INTO sales VALUES (4613, 2790, 288.75);
+INSERT INTO sales VALUES (4614, 2938, 295.25);
+INSERT INTO sales VALUES (4615, 3086, 301.75);
+INSERT INTO sales VALUES (4616, 3234, 308.25);
+INSERT INTO sales VALUES (4617, 3382, 314.75);
+INSERT INTO sales VALUES (4618, 3530, 321.25);
+INSERT INTO sales VALUES (4619, 3678, 327.75);
+INSERT INTO sales VALUES (4620, 3826, 334.25);
+INSERT INTO sales VALUES (4621, 3974, 340.75);
+INSERT INTO sales VALUES (4622, 4122, 347.25);
+INSERT INTO sales VALUES (4623, 4270, 353.75);
+INSERT INTO sales VALUES (4624, 4418, 360.25);
+INSERT INTO sales VALUES (4625, 4566, 366.75);
+INSERT INTO sales VALUES (4626, 4714, 373.25);
+INSERT INTO sales VALUES (4627, 4862, 379.75);
+INSERT INTO sales VALUES (4628, 5010, 386.25);
+INSERT INTO sales VALUES (4629, 5158, 392.75);
+INSERT INTO sales VALUES (4630, 5306, 399.25);
+INSERT INTO sales VALUES (4631, 5454, 405.75);
+INSERT INTO sales VALUES (4632, 5602, 412.25);
+INSERT INTO sales VALUES (4633, 5750, 418.75);
+INSERT INTO sales VALUES (4634, 5898, 425.25);
+INSERT INTO sales VALUES (4635, 6046, 431.75);
+INSERT INTO sales VALUES (4636, 6194, 438.25);
+INSERT INTO sales VALUES (4637, 6342, 444.75);
+INSERT INTO sales VALUES (4638, 6490, 451.25);
+INSERT INTO sales VALUES (4639, 6638, 457.75);
+INSERT INTO sales VALUES (4640, 6786, 464.25);
+INSERT INTO sales VALUES (4641, 6934, 470.75);
+INSERT INTO sales VALUES (4642, 7082, 477.25);
+INSERT INTO sales VALUES (4643, 7230, 483.75);
+INSERT INTO sales VALUES (4644, 7378, 490.25);
+INSERT INTO sales VALUES (4645, 7526, 496.75);
+INSERT INTO sales VALUES (4646, 7674, 503.25);
+INSERT INTO sales VALUES (4647, 7822, 509.75);
+INSERT INTO sales VALUES (4648, 7970, 516.25);
+INSERT INTO sales VALUES (4649, 8118, 522.75);
+INSERT INTO sales VALUES (4650, 74, 529.25);
+INSERT INTO sales VALUES (4651, 222, 535.75);
+INSERT INTO sales VALUES (4652, 370, 542.25);
+INSERT INTO sales VALUES (4653, 518, 548.75);
+INSERT INTO sales VALUES (4654, 666, 555.25);
+INSERT INTO sales VALUES (4655, 814, 561.75);
+INSERT INTO sales VALUES (4656, 962, 568.25);
+INSERT INTO sales VALUES (4657, 1110, 574.75);
+INSERT INTO sales VALUES (4658, 1258, 581.25);
+INSERT INTO sales VALUES (4659, 1406, 587.75);
+INSERT INTO sales VALUES (4660, 1554, 594.25);
+INSERT INTO sales VALUES (4661, 1702, 600.75);
+INSERT INTO sales VALUES (4662, 1850, 607.25);
+INSERT INTO sales VALUES (4663, 1998, 613.75);
+INSERT INTO sales VALUES (4664, 2146, 620.25);
+INSERT INTO sales VALUES (4665, 2294, 626.75);
+INSERT INTO sales VALUES (4666, 2442, 633.25);
+INSERT INTO sales VALUES (4667, 2590, 639.75);
+INSERT INTO sales VALUES (4668, 2738, 646.25);
+INSERT INTO sales VALUES (4669, 2886, 652.75);
+INSERT INTO sales VALUES (4670, 3034, 659.25);
+INSERT INTO sales VALUES (4671, 3182, 665.75);
+INSERT INTO sales VALUES (4672, 3330, 672.25);
+INSERT INTO sales VALUES (4673, 3478, 678.75);
+INSERT INTO sales VALUES (4674, 3626, 685.25);
+INSERT INTO sales VALUES (4675, 3774, 691.75);
+INSERT INTO sales VALUES (4676, 3922, 698.25);
+INSERT INTO sales VALUES (4677, 4070, 704.75);
+INSERT INTO sales VALUES (4678, 4218, 711.25);
+INSERT INTO sales VALUES (4679, 4366, 717.75);
+INSERT INTO sales VALUES (4680, 4514, 724.25);
+INSERT INTO sales VALUES (4681, 4662, 730.75);
+INSERT INTO sales VALUES (4682, 4810, 737.25);
+INSERT INTO sales VALUES (4683, 4958, 743.75);
+INSERT INTO sales VALUES (4684, 5106, 750.25);
+INSERT INTO sales VALUES (4685, 5254, 756.75);
+INSERT INTO sales VALUES (4686, 5402, 763.25);
+INSERT INTO sales VALUES (4687, 5550, 769.75);
+INSERT INTO sales VALUES (4688, 5698, 776.25);
+INSERT INTO sales VALUES (4689, 5846, 782.75);
+INSERT INTO sales VALUES (4690, 5994, 789.25);
+INSERT INTO sales VALUES (4691, 6142, 795.75);
+INSERT INTO sales VALUES (4692, 6290, 802.25);
+INSERT INTO sales VALUES (4693, 6438, 808.75);
+INSERT INTO sales VALUES (4694, 6586, 815.25);
+INSERT INTO sales VALUES (4695, 6734, 821.75);
+INSERT INTO sales VALUES (4696, 6882, 828.25);
+INSERT INTO sales VALUES (4697, 7030, 834.75);
+INSERT INTO sales VALUES (4698, 7178, 841.25);
+INSERT INTO sales VALUES (4699, 7326, 847.75);
+INSERT INTO sales VALUES (4700, 7474, 854.25);
+INSERT INTO sales VALUES (4701, 7622, 860.75);
+INSERT INTO sales VALUES (4702, 7770, 867.25);
+INSERT INTO sales VALUES (4703, 7918, 873.75);
+INSERT INTO sales VALUES (4704, 8066, 880.25);
+INSERT INTO sales VALUES (4705, 22, 886.75);
+INSERT INTO sales VALUES (4706, 170, 893.25);
+INSERT INTO sales VALUES (4707, 318, 899.75);
+INSERT INTO sales VALUES (4708, 466, 906.25);
+INSERT INTO sales VALUES (4709, 614, 912.75);
+INSERT INTO sales VALUES (4710, 762, 919.25);
+INSERT INTO sales VALUES (4711, 910, 925.75);
+INSERT INTO sales VALUES (4712, 1058, 932.25);
+INSERT INTO sales VALUES (4713, 1206, 938.75);
+INSERT INTO sales VALUES (4714, 1354, 945.25);
+INSERT INTO sales VALUES (4715, 1502, 951.75);
+INSERT INTO sales VALUES (4716, 1650, 958.25);
+INSERT INTO sales VALUES (4717, 1798, 964.75);
+INSERT INTO sales VALUES (4718, 1946, 971.25);
+INSERT INTO sales VALUES (4719, 2094, 977.75);
+INSERT INTO sales VALUES (4720, 2242, 984.25);
+INSERT INTO sales VALUES (4721, 2390, 990.75);
+INSERT INTO sales VALUES (4722, 2538, 997.25);
+INSERT INTO sales VALUES (4723, 2686, 1003.75);
+INSERT INTO sales VALUES (4724, 2834, 1010.25);
+INSERT INTO sales VALUES (4725, 2982, 1016.75);
+INSERT INTO sales VALUES (4726, 3130, 1023.25);
+INSERT INTO sales VALUES (4727, 3278, 5.75);
+INSERT INTO sales VALUES (4728, 3426, 12.25);
+INSERT INTO sales VALUES (4729, 3574, 18.75);
+INSERT INTO sales VALUES (4730, 3722, 25.25);
+INSERT INTO sales VALUES (4731, 3870, 31.75);
+INSERT INTO sales VALUES (4732, 4018, 38.25);
+INSERT INTO sales VALUES (4733, 4166, 44.75);
+INSERT INTO sales VALUES (4734, 4314, 51.25);
+INSERT INTO sales VALUES (4735, 4462, 57.75);
+INSERT INTO sales VALUES (4736, 4610, 64.25);
+INSERT INTO sales VALUES (4737, 4758, 70.75);
+INSERT INTO sales VALUES (4738, 4906, 77.25);
+INSERT INTO sales VALUES (4739, 5054, 83.75);
+INSERT INTO sales VALUES (4740, 5202, 90.25);
+INSERT INTO sales VALUES (4741, 5350, 96.75);
+INSERT INTO sales VALUES (4742, 5498, 103.25);
+INSERT INTO sales VALUES (4743, 5646, 109.75);
+INSERT INTO sales VALUES (4744, 5794, 116.25);
+INSERT INTO sales VALUES (4745, 5942, 122.75);
+INSERT INTO sales VALUES (4746, 6090, 129.25);
+INSERT INTO sales VALUES (4747, 6238, 135.75);
+INSERT INTO sales VALUES (4748, 6386, 142.25);
+INSERT INTO sales VALUES (4749, 6534, 148.75);
+INSERT INTO sales VALUES (4750, 6682, 155.25);
+INSERT INTO sales VALUES (4751, 6830, 161.75);
+INSERT INTO sales VALUES (4752, 6978, 168.25);
+INSERT INTO sales VALUES (4753, 7126, 174.75);
+INSERT INTO sales VALUES (4754, 7274, 181.25);
+INSERT INTO sales VALUES (4755, 7422, 187.75);
+INSERT INTO sales VALUES (4756, 7570, 194.25);
+INSERT INTO sales VALUES (4757, 7718, 200.75);
+INSERT INTO sales VALUES (4758, 7866, 207.25);
+INSERT INTO sales VALUES (4759, 8014, 213.75);
+INSERT INTO sales VALUES (4760, 8162, 220.25);
+INSERT INTO sales VALUES (4761, 118, 226.75);
+INSERT INTO sales VALUES (4762, 266, 233.25);
+INSERT INTO sales VALUES (4763, 414, 239.75);
+INSERT INTO sales VALUES (4764, 562, 246.25);
+INSERT INTO sales VALUES (4765, 710, 252.75);
+INSERT INTO sales VALUES (4766, 858, 259.25);
+INSERT INTO sales VALUES (4767, 1006, 265.75);
+INSERT INTO sales VALUES (4768, 1154, 272.25);
+INSERT INTO sales VALUES (4769, 1302, 278.75);
+INSERT INTO sales VALUES (4770, 1450, 285.25);
+INSERT INTO sales VALUES (4771, 1598, 291.75);
+INSERT INTO sales VALUES (4772, 1746, 298.25);
+INSERT INTO sales VALUES (4773, 1894, 304.75);
+INSERT INTO sales VALUES (4774, 2042, 311.25);
+INSERT INTO sales VALUES (4775, 2190, 317.75);
+INSERT INTO sales VALUES (4776, 2338, 324.25);
+INSERT INTO sales VALUES (4777, 2486, 330.75);
+INSERT INTO sales VALUES (4778, 2634, 337.25);
+INSERT INTO sales VALUES (4779, 2782, 343.75);
+INSERT INTO sales VALUES (4780, 2930, 350.25);
+INSERT INTO sales VALUES (4781, 3078, 356.75);
+INSERT INTO sales VALUES (4782, 3226, 363.25);
+INSERT INTO sales VALUES (4783, 3374, 369.75);
+INSERT INTO sales VALUES (4784, 3522, 376.25);
+INSERT INTO sales VALUES (4785, 3670, 382.75);
+INSERT INTO sales VALUES (4786, 3818, 389.25);
+INSERT INTO sales VALUES (4787, 3966, 395.75);
+INSERT INTO sales VALUES (4788, 4114, 402.25);
+INSERT INTO sales VALUES (4789, 4262, 408.75);
+INSERT INTO sales VALUES (4790, 4410, 415.25);
+INSERT INTO sales VALUES (4791, 4558, 421.75);
+INSERT INTO sales VALUES (4792, 4706, 428.25);
+INSERT INTO sales VALUES (4793, 4854, 434.75);
+INSERT INTO sales VALUES (4794, 5002, 441.25);
+INSERT INTO sales VALUES (4795, 5150, 447.75);
+INSERT INTO sales VALUES (4796, 5298, 454.25);
+INSERT INTO sales VALUES (4797, 5446, 460.75);
+INSERT INTO sales VALUES (4798, 5594, 467.25);
+INSERT INTO sales VALUES (4799, 5742, 473.75);
+INSERT INTO sales VALUES (4800, 5890, 480.25);
+INSERT INTO sales VALUES (4801, 6038, 486.75);
+INSERT INTO sales VALUES (4802, 6186, 493.25);
+INSERT INTO sales VALUES (4803, 6334, 499.75);
+INSERT INTO sales VALUES (4804, 6482, 506.25);
+INSERT INTO sales VALUES (4805, 6630, 512.75);
+INSERT INTO sales VALUES (4806, 6778, 519.25);
+INSERT INTO sales VALUES (4807, 6926, 525.75);
+INSERT INTO sales VALUES (4808, 7074, 532.25);
+INSERT INTO sales VALUES (4809, 7222, 538.75);
+INSERT INTO sales VALUES (4810, 7370, 545.25);
+INSERT INTO sales VALUES (4811, 7518, 551.75);
+INSERT INTO sales VALUES (4812, 7666, 558.25);
+INSERT INTO sales VALUES (4813, 7814, 564.75);
+INSERT INTO sales VALUES (4814, 7962, 571.25);
+INSERT INTO sales VALUES (4815, 8110, 577.75);
+INSERT INTO sales VALUES (4816, 66, 584.25);
+INSERT INTO sales VALUES (4817, 214, 590.75);
+INSERT INTO sales VALUES (4818, 362, 597.25);
+INSERT INTO sales VALUES (4819, 510, 603.75);
+INSERT INTO sales VALUES (4820, 658, 610.25);
+INSERT INTO sales VALUES (4821, 806, 616.75);
+INSERT INTO sales VALUES (4822, 954, 623.25);
+INSERT INTO sales VALUES (4823, 1102, 629.75);
+INSERT INTO sales VALUES (4824, 1250, 636.25);
+INSERT INTO sales VALUES (4825, 1398, 642.75);
+INSERT INTO sales VALUES (4826, 1546, 649.25);
+INSERT INTO sales VALUES (4827, 1694, 655.75);
+INSERT INTO sales VALUES (4828, 1842, 662.25);
+INSERT INTO sales VALUES (4829, 1990, 668.75);
+INSERT INTO sales VALUES (4830, 2138, 675.25);
+INSERT INTO sales VALUES (4831, 2286, 681.75);
+INSERT INTO sales VALUES (4832, 2434, 688.25);
+INSERT INTO sales VALUES (4833, 2582, 694.75);
+INSERT INTO sales VALUES (4834, 2730, 701.25);
+INSERT INTO sales VALUES (4835, 2878, 707.75);
+INSERT INTO sales VALUES (4836, 3026, 714.25);
+INSERT INTO sales VALUES (4837, 3174, 720.75);
+INSERT INTO sales VALUES (4838, 3322, 727.25);
+INSERT INTO sales VALUES (4839, 3470, 733.75);
+INSERT INTO sales VALUES (4840, 3618, 740.25);
+INSERT INTO sales VALUES (4841, 3766, 746.75);
+INSERT INTO sales VALUES (4842, 3914, 753.25);
+INSERT INTO sales VALUES (4843, 4062, 759.75);
+INSERT INTO sales VALUES (4844, 4210, 766.25);
+INSERT INTO sales VALUES (4845, 4358, 772.75);
+INSERT INTO sales VALUES (4846, 4506, 779.25);
+INSERT INTO sales VALUES (4847, 4654, 785.75);
+INSERT INTO sales VALUES (4848, 4802, 792.25);
+INSERT INTO sales VALUES (4849, 4950, 798.75);
+INSERT INTO sales VALUES (4850, 5098, 805.25);
+INSERT INTO sales VALUES (4851, 5246, 811.75);
+INSERT INTO sales VALUES (4852, 5394, 818.25);
+INSERT INTO sales VALUES (4853, 5542, 824.75);
+INSERT INTO sales VALUES (4854, 5690, 831.25);
+INSERT INTO sales VALUES (4855, 5838, 837.75);
+INSERT INTO sales VALUES (4856, 5986, 844.25);
+INSERT INTO sales VALUES (4857, 6134, 850.75);
+INSERT INTO sales VALUES (4858, 6282, 857.25);
+INSERT INTO sales VALUES (4859, 6430, 863.75);
+INSERT INTO sales VALUES (4860, 6578, 870.25);
+INSERT INTO sales VALUES (4861, 6726, 876.75);
+INSERT INTO sales VALUES (4862, 6874, 883.25);
+INSERT INTO sales VALUES (4863, 7022, 889.75);
+INSERT INTO sales VALUES (4864, 7170, 896.25);
+INSERT INTO sales VALUES (4865, 7318, 902.75);
+INSERT INTO sales VALUES (4866, 7466, 909.25);
+INSERT INTO sales VALUES (4867, 7614, 915.75);
+INSERT INTO sales VALUES (4868, 7762, 922.25);
+INSERT INTO sales VALUES (4869, 7910, 928.75);
+INSERT INTO sales VALUES (4870, 8058, 935.25);
+INSERT INTO sales VALUES (4871, 14, 941.75);
+INSERT INTO sales VALUES (4872, 162, 948.25);
+INSERT INTO sales VALUES (4873, 310, 954.75);
+INSERT INTO sales VALUES (4874, 458, 961.25);
+INSERT INTO sales VALUES (4875, 606, 967.75);
+INSERT INTO sales VALUES (4876, 754, 974.25);
+INSERT INTO sales VALUES (4877, 902, 980.75);
+INSERT INTO sales VALUES (4878, 1050, 987.25);
+INSERT INTO sales VALUES (4879, 1198, 993.75);
+INSERT INTO sales VALUES (4880, 1346, 1000.25);
+INSERT INTO sales VALUES (4881, 1494, 1006.75);
+INSERT INTO sales VALUES (4882, 1642, 1013.25);
+INSERT INTO sales VALUES (4883, 1790, 1019.75);
+INSERT INTO sales VALUES (4884, 1938, 2.25);
+INSERT INTO sales VALUES (4885, 2086, 8.75);
+INSERT INTO sales VALUES (4886, 2234, 15.25);
+INSERT INTO sales VALUES (4887, 2382, 21.75);
+INSERT INTO sales VALUES (4888, 2530, 28.25);
+INSERT INTO sales VALUES (4889, 2678, 34.75);
+INSERT INTO sales VALUES (4890, 2826, 41.25);
+INSERT INTO sales VALUES (4891, 2974, 47.75);
+INSERT INTO sales VALUES (4892, 3122, 54.25);
+INSERT INTO sales VALUES (4893, 3270, 60.75);
+INSERT INTO sales VALUES (4894, 3418, 67.25);
+INSERT INTO sales VALUES (4895, 3566, 73.75);
+INSERT INTO sales VALUES (4896, 3714, 80.25);
+INSERT INTO sales VALUES (4897, 3862, 86.75);
+INSERT INTO sales VALUES (4898, 4010, 93.25);
+INSERT INTO sales VALUES (4899, 4158, 99.75);
+INSERT INTO sales VALUES (4900, 4306, 106.25);
+INSERT INTO sales VALUES (4901, 4454, 112.75);
+INSERT INTO sales VALUES (4902, 4602, 119.25);
+INSERT INTO sales VALUES (4903, 4750, 125.75);
+INSERT INTO sales VALUES (4904, 4898, 132.25);
+INSERT INTO sales VALUES (4905, 5046, 138.75);
+INSERT INTO sales VALUES (4906, 5194, 145.25);
+INSERT INTO sales VALUES (4907, 5342, 151.75);
+INSERT INTO sales VALUES (4908, 5490, 158.25);
+INSERT INTO sales VALUES (4909, 5638, 164.75);
+INSERT INTO sales VALUES (4910, 5786, 171.25);
+INSERT INTO sales VALUES (4911, 5934, 177.75);
+INSERT INTO sales VALUES (4912, 6082, 184.25);
+INSERT INTO sales VALUES (4913, 6230, 190.75);
+INSERT INTO sales VALUES (4914, 6378, 197.25);
+INSERT INTO sales VALUES (4915, 6526, 203.75);
+INSERT INTO sales VALUES (4916, 6674, 210.25);
+INSERT INTO sales VALUES (4917, 6822, 216.75);
+INSERT INTO sales VALUES (4918, 6970, 223.25);
+INSERT INTO sales VALUES (4919, 7118, 229.75);
+INSERT INTO sales VALUES (4920, 7266, 236.25);
+INSERT INTO sales VALUES (4921, 7414, 242.75);
+INSERT INTO sales VALUES (4922, 7562, 249.25);
+INSERT INTO sales VALUES (4923, 7710, 255.75);
+INSERT INTO sales VALUES (4924, 7858, 262.25);
+INSERT INTO sales VALUES (4925, 8006, 268.75);
+INSERT INTO sales VALUES (4926, 8154, 275.25);
+INSERT INTO sales VALUES (4927, 110, 281.75);
+INSERT INTO sales VALUES (4928, 258, 288.25);
+INSERT INTO sales VALUES (4929, 406, 294.75);
+INSERT INTO sales VALUES (4930, 554, 301.25);
+INSERT INTO sales VALUES (4931, 702, 307.75);
+INSERT INTO sales VALUES (4932, 850, 314.25);
+INSERT INTO sales VALUES (4933, 998, 320.75);
+INSERT INTO sales VALUES (4934, 1146, 327.25);
+INSERT INTO sales VALUES (4935, 1294, 333.75);
+INSERT INTO sales VALUES (4936, 1442, 340.25);
+INSERT INTO sales VALUES (4937, 1590, 346.75);
+INSERT INTO sales VALUES (4938, 1738, 353.25);
+INSERT INTO sales VALUES (4939, 1886, 359.75);
+INSERT INTO sales VALUES (4940, 2034, 366.25);
+INSERT INTO sales VALUES (4941, 2182, 372.75);
+INSERT INTO sales VALUES (4942, 2330, 379.25);
+INSERT INTO sales VALUES (4943, 2478, 385.75);
+INSERT INTO sales VALUES (4944, 2626, 392.25);
+INSERT INTO sales VALUES (4945, 2774, 398.75);
+INSERT INTO sales VALUES (4946, 2922, 405.25);
+INSERT INTO sales VALUES (4947, 3070, 411.75);
+INSERT INTO sales VALUES (4948, 3218, 418.25);
+INSERT INTO sales VALUES (4949, 3366, 424.75);
+INSERT INTO sales VALUES (4950, 3514, 431.25);
+INSERT INTO sales VALUES (4951, 3662, 437.75);
+INSERT INTO sales VALUES (4952, 3810, 444.25);
+INSERT INTO sales VALUES (4953, 3958, 450.75);
+INSERT INTO sales VALUES (4954, 4106, 457.25);
+INSERT INTO sales VALUES (4955, 4254, 463.75);
+INSERT INTO sales VALUES (4956, 4402, 470.25);
+INSERT INTO sales VALUES (4957, 4550, 476.75);
+INSERT INTO sales VALUES (4958, 4698, 483.25);
+INSERT INTO sales VALUES (4959, 4846, 489.75);
+INSERT INTO sales VALUES (4960, 4994, 496.25);
+INSERT INTO sales VALUES (4961, 5142, 502.75);
+INSERT INTO sales VALUES (4962, 5290, 509.25);
+INSERT INTO sales VALUES (4963, 5438, 515.75);
+INSERT INTO sales VALUES (4964, 5586, 522.25);
+INSERT INTO sales VALUES (4965, 5734, 528.75);
+INSERT INTO sales VALUES (4966, 5882, 535.25);
+INSERT INTO sales VALUES (4967, 6030, 541.75);
+INSERT INTO sales VALUES (4968, 6178, 548.25);
+INSERT INTO sales VALUES (4969, 6326, 554.75);
+INSERT INTO sales VALUES (4970, 6474, 561.25);
+INSERT INTO sales VALUES (4971, 6622, 567.75);
+INSERT INTO sales VALUES (4972, 6770, 574.25);
+INSERT INTO sales VALUES (4973, 6918, 580.75);
+INSERT INTO sales VALUES (4974, 7066, 587.25);
+INSERT INTO sales VALUES (4975, 7214, 593.75);
+INSERT INTO sales VALUES (4976, 7362, 600.25);
+INSERT INTO sales VALUES (4977, 7510, 606.75);
+INSERT INTO sales VALUES (4978, 7658, 613.25);
+INSERT INTO sales VALUES (4979, 7806, 619.75);
+INSERT INTO sales VALUES (4980, 7954, 626.25);
+INSERT INTO sales VALUES (4981, 8102, 632.75);
+INSERT INTO sales VALUES (4982, 58, 639.25);
+INSERT INTO sales VALUES (4983, 206, 645.75);
+INSERT INTO sales VALUES (4984, 354, 652.25);
+INSERT INTO sales VALUES (4985, 502, 658.75);
+INSERT INTO sales VALUES (4986, 650, 665.25);
+INSERT INTO sales VALUES (4987, 798, 671.75);
+INSERT INTO sales VALUES (4988, 946, 678.25);
+INSERT INTO sales VALUES (4989, 1094, 684.75);
+INSERT INTO sales VALUES (4990, 1242, 691.25);
+INSERT INTO sales VALUES (4991, 1390, 697.75);
+INSERT INTO sales VALUES (4992, 1538, 704.25);
+INSERT INTO sales VALUES (4993, 1686, 710.75);
+INSERT INTO sales VALUES (4994, 1834, 717.25);
+INSERT INTO sales VALUES (4995, 1982, 723.75);
+INSERT INTO sales VALUES (4996, 2130, 730.25);
+INSERT INTO sales VALUES (4997, 2278, 736.75);
+INSERT INTO sales VALUES (4998, 2426, 743.25);
+INSERT INTO sales VALUES (4999, 2574, 749.75);
+INSERT INTO sales VALUES (5000, 2722, 756.25);
+INSERT INTO sales VALUES (5001, 2870, 762.75);
+INSERT INTO sales VALUES (5002, 3018, 769.25);
+INSERT INTO sales VALUES (5003, 3166, 775.75);
+INSERT INTO sales VALUES (5004, 3314, 782.25);
+INSERT INTO sales VALUES (5005, 3462, 788.75);
+INSERT INTO sales VALUES (5006, 3610, 795.25);
+INSERT INTO sales VALUES (5007, 3758, 801.75);
+INSERT INTO sales VALUES (5008, 3906, 808.25);
+INSERT INTO sales VALUES (5009, 4054, 814.75);
+INSERT INTO sales VALUES (5010, 4202, 821.25);
+INSERT INTO sales VALUES (5011, 4350, 827.75);
+INSERT INTO sales VALUES (5012, 4498, 834.25);
+INSERT INTO sales VALUES (5013, 4646, 840.75);
+INSERT INTO sales VALUES (5014, 4794, 847.25);
+INSERT INTO sales VALUES (5015, 4942, 853.75);
+INSERT INTO sales VALUES (5016, 5090, 860.25);
+INSERT INTO sales VALUES (5017, 5238, 866.75);
+INSERT INTO sales VALUES (5018, 5386, 873.25);
+INSERT INTO sales VALUES (5019, 5534, 879.75);
+INSERT INTO sales VALUES (5020, 5682, 886.25);
+INSERT INTO sales VALUES (5021, 5830, 892.75);
+INSERT INTO sales VALUES (5022, 5978, 899.25);
+INSERT INTO sales VALUES (5023, 6126, 905.75);
+INSERT INTO sales VALUES (5024, 6274, 912.25);
+INSERT INTO sales VALUES (5025, 6422, 918.75);
+INSERT INTO sales VALUES (5026, 6570, 925.25);
+INSERT INTO sales VALUES (5027, 6718, 931.75);
+INSERT INTO sales VALUES (5028, 6866, 938.25);
+INSERT INTO sales VALUES (5029, 7014, 944.75);
+INSERT INTO sales VALUES (5030, 7162, 951.25);
+INSERT INTO sales VALUES (5031, 7310, 957.75);
+INSERT INTO sales VALUES (5032, 7458, 964.25);
+INSERT INTO sales VALUES (5033, 7606, 970.75);
+INSERT INTO sales VALUES (5034, 7754, 977.25);
+INSERT INTO sales VALUES (5035, 7902, 983.75);
+INSERT INTO sales VALUES (5036, 8050, 990.25);
+INSERT INTO sales VALUES (5037, 6, 996.75);
+INSERT INTO sales VALUES (5038, 154, 1003.25);
+INSERT INTO sales VALUES (5039, 302, 1009.75);
+INSERT INTO sales VALUES (5040, 450, 1016.25);
+INSERT INTO sales VALUES (5041, 598, 1022.75);
+INSERT INTO sales VALUES (5042, 746, 5.25);
+INSERT INTO sales VALUES (5043, 894, 11.75);
+INSERT INTO sales VALUES (5044, 1042, 18.25);
+INSERT INTO sales VALUES (5045, 1190, 24.75);
+INSERT INTO sales VALUES (5046, 1338, 31.25);
+INSERT INTO sales VALUES (5047, 1486, 37.75);
+INSERT INTO sales VALUES (5048, 1634, 44.25);
+INSERT INTO sales VALUES (5049, 1782, 50.75);
+INSERT INTO sales VALUES (5050, 1930, 57.25);
+INSERT INTO sales VALUES (5051, 2078, 63.75);
+INSERT INTO sales VALUES (5052, 2226, 70.25);
+INSERT INTO sales VALUES (5053, 2374, 76.75);
+INSERT INTO sales VALUES (5054, 2522, 83.25);
+INSERT INTO sales VALUES (5055, 2670, 89.75);
+INSERT INTO sales VALUES (5056, 2818, 96.25);
+INSERT INTO sales VALUES (5057, 2966, 102.75);
+INSERT INTO sales VALUES (5058, 3114, 109.25);
+INSERT INTO sales VALUES (5059, 3262, 115.75);
+INSERT INTO sales VALUES (5060, 3410, 122.25);
+INSERT INTO sales VALUES (5061, 3558, 128.75);
+INSERT INTO sales VALUES (5062, 3706, 135.25);
+INSERT INTO sales VALUES (5063, 3854, 141.75);
+INSERT INTO sales VALUES (5064, 4002, 148.25);
+INSERT INTO sales VALUES (5065, 4150, 154.75);
+INSERT INTO sales VALUES (5066, 4298, 161.25);
+INSERT INTO sales VALUES (5067, 4446, 167.75);
+INSERT INTO sales VALUES (5068, 4594, 174.25);
+INSERT INTO sales VALUES (5069, 4742, 180.75);
+INSERT INTO sales VALUES (5070, 4890, 187.25);
+INSERT INTO sales VALUES (5071, 5038, 193.75);
+INSERT INTO sales VALUES (5072, 5186, 200.25);
+INSERT INTO sales VALUES (5073, 5334, 206.75);
+INSERT INTO sales VALUES (5074, 5482, 213.25);
+INSERT INTO sales VALUES (5075, 5630, 219.75);
+INSERT INTO sales VALUES (5076, 5778, 226.25);
+INSERT INTO sales VALUES (5077, 5926, 232.75);
+INSERT INTO sales VALUES (5078, 6074, 239.25);
+INSERT INTO sales VALUES (5079, 6222, 245.75);
+INSERT INTO sales VALUES (5080, 6370, 252.25);
+INSERT INTO sales VALUES (5081, 6518, 258.75);
+INSERT INTO sales VALUES (5082, 6666, 265.25);
+INSERT INTO sales VALUES (5083, 6814, 271.75);
+INSERT INTO sales VALUES (5084, 6962, 278.25);
+INSERT INTO sales VALUES (5085, 7110, 284.75);
+INSERT INTO sales VALUES (5086, 7258, 291.25);
+INSERT INTO sales VALUES (5087, 7406, 297.75);
+INSERT INTO sales VALUES (5088, 7554, 304.25);
+INSERT INTO sales VALUES (5089, 7702, 310.75);
+INSERT INTO sales VALUES (5090, 7850, 317.25);
+INSERT INTO sales VALUES (5091, 7998, 323.75);
+INSERT INTO sales VALUES (5092, 8146, 330.25);
+INSERT INTO sales VALUES (5093, 102, 336.75);
+INSERT INTO sales VALUES (5094, 250, 343.25);
+INSERT INTO sales VALUES (5095, 398, 349.75);
+INSERT INTO sales VALUES (5096, 546, 356.25);
+INSERT INTO sales VALUES (5097, 694, 362.75);
+INSERT INTO sales VALUES (5098, 842, 369.25);
+INSERT INTO sales VALUES (5099, 990, 375.75);
+INSERT INTO sales VALUES (5100, 1138, 382.25);
+INSERT INTO sales VALUES (5101, 1286, 388.75);
+INSERT INTO sales VALUES (5102, 1434, 395.25);
+INSERT INTO sales VALUES (5103, 1582, 401.75);
+INSERT INTO sales VALUES (5104, 1730, 408.25);
+INSERT INTO sales VALUES (5105, 1878, 414.75);
+INSERT INTO sales VALUES (5106, 2026, 421.25);
+INSERT INTO sales VALUES (5107, 2174, 427.75);
+INSERT INTO sales VALUES (5108, 2322, 434.25);
+INSERT INTO sales VALUES (5109, 2470, 440.75);
+INSERT INTO sales VALUES (5110, 2618, 447.25);
+INSERT INTO sales VALUES (5111, 2766, 453.75);
+INSERT INTO sales VALUES (5112, 2914, 460.25);
+INSERT INTO sales VALUES (5113, 3062, 466.75);
+INSERT INTO sales VALUES (5114, 3210, 473.25);
+INSERT INTO sales VALUES (5115, 3358, 479.75);
+INSERT INTO sales VALUES (5116, 3506, 486.25);
+INSERT INTO sales VALUES (5117, 3654, 492.75);
+INSERT INTO sales VALUES (5118, 3802, 499.25);
+INSERT INTO sales VALUES (5119, 3950, 505.75);
+INSERT INTO sales VALUES (5120, 4098, 512.25);
+INSERT INTO sales VALUES (5121, 4246, 518.75);
+INSERT INTO sales VALUES (5122, 4394, 525.25);
+INSERT INTO sales VALUES (5123, 4542, 531.75);
+INSERT INTO sales VALUES (5124, 4690, 538.25);
+INSERT INTO sales VALUES (5125, 4838, 544.75);
+INSERT INTO sales VALUES (5126, 4986, 551.25);
+INSERT INTO sales VALUES (5127, 5134, 557.75);
+INSERT INTO sales VALUES (5128, 5282, 564.25);
+INSERT INTO sales VALUES (5129, 5430, 570.75);
+INSERT INTO sales VALUES (5130, 5578, 577.25);
+INSERT INTO sales VALUES (5131, 5726, 583.75);
+INSERT INTO sales VALUES (5132, 5874, 590.25);
+INSERT INTO sales VALUES (5133, 6022, 596.75);
+INSERT INTO sales VALUES (5134, 6170, 603.25);
+INSERT INTO sales VALUES (5135, 6318, 609.75);
+INSERT INTO sales VALUES (5136, 6466, 616.25);
+INSERT INTO sales VALUES (5137, 6614, 622.75);
+INSERT INTO sales VALUES (5138, 6762, 629.25);
+INSERT INTO sales VALUES (5139, 6910, 635.75);
+INSERT INTO sales VALUES (5140, 7058, 642.25);
+INSERT INTO sales VALUES (5141, 7206, 648.75);
+INSERT INTO sales VALUES (5142, 7354, 655.25);
+INSERT INTO sales VALUES (5143, 7502, 661.75);
+INSERT INTO sales VALUES (5144, 7650, 668.25);
+INSERT INTO sales VALUES (5145, 7798, 674.75);
+INSERT INTO sales VALUES (5146, 7946, 681.25);
+INSERT INTO sales VALUES (5147, 8094, 687.75);
+INSERT INTO sales VALUES (5148, 50, 694.25);
+INSERT INTO sales VALUES (5149, 198, 700.75);
+INSERT INTO sales VALUES (5150, 346, 707.25);
+INSERT INTO sales VALUES (5151, 494, 713.75);
+INSERT INTO sales VALUES (5152, 642, 720.25);
+INSERT INTO sales VALUES (5153, 790, 726.75);
+INSERT INTO sales VALUES (5154, 938, 733.25);
+INSERT INTO sales VALUES (5155, 1086, 739.75);
+INSERT INTO sales VALUES (5156, 1234, 746.25);
+INSERT INTO sales VALUES (5157, 1382, 752.75);
+INSERT INTO sales VALUES (5158, 1530, 759.25);
+INSERT INTO sales VALUES (5159, 1678, 765.75);
+INSERT INTO sales VALUES (5160, 1826, 772.25);
+INSERT INTO sales VALUES (5161, 1974, 778.75);
+INSERT INTO sales VALUES (5162, 2122, 785.25);
+INSERT INTO sales VALUES (5163, 2270, 791.75);
+INSERT INTO sales VALUES (5164, 2418, 798.25);
+INSERT INTO sales VALUES (5165, 2566, 804.75);
+INSERT INTO sales VALUES (5166, 2714, 811.25);
+INSERT INTO sales VALUES (5167, 2862, 817.75);
+INSERT INTO sales VALUES (5168, 3010, 824.25);
+INSERT INTO sales VALUES (5169, 3158, 830.75);
+INSERT INTO sales VALUES (5170, 3306, 837.25);
+INSERT INTO sales VALUES (5171, 3454, 843.75);
+INSERT INTO sales VALUES (5172, 3602, 850.25);
+INSERT INTO sales VALUES (5173, 3750, 856.75);
+INSERT INTO sales VALUES (5174, 3898, 863.25);
+INSERT INTO sales VALUES (5175, 4046, 869.75);
+INSERT INTO sales VALUES (5176, 4194, 876.25);
+INSERT INTO sales VALUES (5177, 4342, 882.75);
+INSERT INTO sales VALUES (5178, 4490, 889.25);
+INSERT INTO sales VALUES (5179, 4638, 895.75);
+INSERT INTO sales VALUES (5180, 4786, 902.25);
+INSERT INTO sales VALUES (5181, 4934, 908.75);
+INSERT INTO sales VALUES (5182, 5082, 915.25);
+INSERT INTO sales VALUES (5183, 5230, 921.75);
+INSERT INTO sales VALUES (5184, 5378, 928.25);
+INSERT INTO sales VALUES (5185, 5526, 934.75);
+INSERT INTO sales VALUES (5186, 5674, 941.25);
+INSERT INTO sales VALUES (5187, 5822, 947.75);
+INSERT INTO sales VALUES (5188, 5970, 954.25);
+INSERT INTO sales VALUES (5189, 6118, 960.75);
+INSERT INTO sales VALUES (5190, 6266, 967.25);
+INSERT INTO sales VALUES (5191, 6414, 973.75);
+INSERT INTO sales VALUES (5192, 6562, 980.25);
+INSERT INTO sales VALUES (5193, 6710, 986.75);
+INSERT INTO sales VALUES (5194, 6858, 993.25);
+INSERT INTO sales VALUES (5195, 7006, 999.75);
+INSERT INTO sales VALUES (5196, 7154, 1006.25);
+INSERT INTO sales VALUES (5197, 7302, 1012.75);
+INSERT INTO sales VALUES (5198, 7450, 1019.25);
+INSERT INTO sales VALUES (5199, 7598, 1.75);
+INSERT INTO sales VALUES (5200, 7746, 8.25);
+INSERT INTO sales VALUES (5201, 7894, 14.75);
+INSERT INTO sales VALUES (5202, 8042, 21.25);
+INSERT INTO sales VALUES (5203, 8190, 27.75);
+INSERT INTO sales VALUES (5204, 146, 34.25);
+INSERT INTO sales VALUES (5205, 294, 40.75);
+INSERT INTO sales VALUES (5206, 442, 47.25);
+INSERT INTO sales VALUES (5207, 590, 53.75);
+INSERT INTO sales VALUES (5208, 738, 60.25);
+INSERT INTO sales VALUES (5209, 886, 66.75);
+INSERT INTO sales VALUES (5210, 1034, 73.25);
+INSERT INTO sales VALUES (5211, 1182, 79.75);
+INSERT INTO sales VALUES (5212, 1330, 86.25);
+INSERT INTO sales VALUES (5213, 1478, 92.75);
+INSERT INTO sales VALUES (5214, 1626, 99.25);
+INSERT INTO sales VALUES (5215, 1774, 105.75);
+INSERT INTO sales VALUES (5216, 1922, 112.25);
+INSERT INTO sales VALUES (5217, 2070, 118.75);
+INSERT INTO sales VALUES (5218, 2218, 125.25);
+INSERT INTO sales VALUES (5219, 2366, 131.75);
+INSERT INTO sales VALUES (5220, 2514, 138.25);
+INSERT INTO sales VALUES (5221, 2662, 144.75);
+INSERT INTO sales VALUES (5222, 2810, 151.25);
+INSERT INTO sales VALUES (5223, 2958, 157.75);
+INSERT INTO sales VALUES (5224, 3106, 164.25);
+INSERT INTO sales VALUES (5225, 3254, 170.75);
+INSERT INTO sales VALUES (5226, 3402, 177.25);
+INSERT INTO sales VALUES (5227, 3550, 183.75);
+INSERT INTO sales VALUES (5228, 3698, 190.25);
+INSERT INTO sales VALUES (5229, 3846, 196.75);
+INSERT INTO sales VALUES (5230, 3994, 203.25);
+INSERT INTO sales VALUES (5231, 4142, 209.75);
+INSERT INTO sales VALUES (5232, 4290, 216.25);
+INSERT INTO sales VALUES (5233, 4438, 222.75);
+INSERT INTO sales VALUES (5234, 4586, 229.25);
+INSERT INTO sales VALUES (5235, 4734, 235.75);
+INSERT INTO sales VALUES (5236, 4882, 242.25);
+INSERT INTO sales VALUES (5237, 5030, 248.75);
+INSERT INTO sales VALUES (5238, 5178, 255.25);
+INSERT INTO sales VALUES (5239, 5326, 261.75);
+INSERT INTO sales VALUES (5240, 5474, 268.25);
+INSERT INTO sales VALUES (5241, 5622, 274.75);
+INSERT INTO sales VALUES (5242, 5770, 281.25);
+INSERT INTO sales VALUES (5243, 5918, 287.75);
+INSERT INTO sales VALUES (5244, 6066, 294.25);
+INSERT INTO sales VALUES (5245, 6214, 300.75);
+INSERT INTO sales VALUES (5246, 6362, 307.25);
+INSERT INTO sales VALUES (5247, 6510, 313.75);
+INSERT INTO sales VALUES (5248, 6658, 320.25);
+INSERT INTO sales VALUES (5249, 6806, 326.75);
+INSERT INTO sales VALUES (5250, 6954, 333.25);
+INSERT INTO sales VALUES (5251, 7102, 339.75);
+INSERT INTO sales VALUES (5252, 7250, 346.25);
+INSERT INTO sales VALUES (5253, 7398, 352.75);
+INSERT INTO sales VALUES (5254, 7546, 359.25);
+INSERT INTO sales VALUES (5255, 7694, 365.75);
+INSERT INTO sales VALUES (5256, 7842, 372.25);
+INSERT INTO sales VALUES (5257, 7990, 378.75);
+INSERT INTO sales VALUES (5258, 8138, 385.25);
+INSERT INTO sales VALUES (5259, 94, 391.75);
+INSERT INTO sales VALUES (5260, 242, 398.25);
+INSERT INTO sales VALUES (5261, 390, 404.75);
+INSERT INTO sales VALUES (5262, 538, 411.25);
+INSERT INTO sales VALUES (5263, 686, 417.75);
+INSERT INTO sales VALUES (5264, 834, 424.25);
+INSERT INTO sales VALUES (5265, 982, 430.75);
+INSERT INTO sales VALUES (5266, 1130, 437.25);
+INSERT INTO sales VALUES (5267, 1278, 443.75);
+INSERT INTO sales VALUES (5268, 1426, 450.25);
+INSERT INTO sales VALUES (5269, 1574, 456.75);
+INSERT INTO sales VALUES (5270, 1722, 463.25);
+INSERT INTO sales VALUES (5271, 1870, 469.75);
+INSERT INTO sales VALUES (5272, 2018, 476.25);
+INSERT INTO sales VALUES (5273, 2166, 482.75);
+INSERT INTO sales VALUES (5274, 2314, 489.25);
+INSERT INTO sales VALUES (5275, 2462, 495.75);
+INSERT INTO sales VALUES (5276, 2610, 502.25);
+INSERT INTO sales VALUES (5277, 2758, 508.75);
+INSERT INTO sales VALUES (5278, 2906, 515.25);
+INSERT INTO sales VALUES (5279, 3054, 521.75);
+INSERT INTO sales VALUES (5280, 3202, 528.25);
+INSERT INTO sales VALUES (5281, 3350, 534.75);
+INSERT INTO sales VALUES (5282, 3498, 541.25);
+INSERT INTO sales VALUES (5283, 3646, 547.75);
+INSERT INTO sales VALUES (5284, 3794, 554.25);
+INSERT INTO sales VALUES (5285, 3942, 560.75);
+INSERT INTO sales VALUES (5286, 4090, 567.25);
+INSERT INTO sales VALUES (5287, 4238, 573.75);
+INSERT INTO sales VALUES (5288, 4386, 580.25);
+INSERT INTO sales VALUES (5289, 4534, 586.75);
+INSERT INTO sales VALUES (5290, 4682, 593.25);
+INSERT INTO sales VALUES (5291, 4830, 599.75);
+INSERT INTO sales VALUES (5292, 4978, 606.25);
+INSERT INTO sales VALUES (5293, 5126, 612.75);
+INSERT INTO sales VALUES (5294, 5274, 619.25);
+INSERT INTO sales VALUES (5295, 5422, 625.75);
+INSERT INTO sales VALUES (5296, 5570, 632.25);
+INSERT INTO sales VALUES (5297, 5718, 638.75);
+INSERT INTO sales VALUES (5298, 5866, 645.25);
+INSERT INTO sales VALUES (5299, 6014, 651.75);
+INSERT INTO sales VALUES (5300, 6162, 658.25);
+INSERT INTO sales VALUES (5301, 6310, 664.75);
+INSERT INTO sales VALUES (5302, 6458, 671.25);
+INSERT INTO sales VALUES (5303, 6606, 677.75);
+INSERT INTO sales VALUES (5304, 6754, 684.25);
+INSERT INTO sales VALUES (5305, 6902, 690.75);
+INSERT INTO sales VALUES (5306, 7050, 697.25);
+INSERT INTO sales VALUES (5307, 7198, 703.75);
+INSERT INTO sales VALUES (5308, 7346, 710.25);
+INSERT INTO sales VALUES (5309, 7494, 716.75);
+INSERT INTO sales VALUES (5310, 7642, 723.25);
+INSERT INTO sales VALUES (5311, 7790, 729.75);
+INSERT INTO sales VALUES (5312, 7938, 736.25);
+INSERT INTO sales VALUES (5313, 8086, 742.75);
+INSERT INTO sales VALUES (5314, 42, 749.25);
+INSERT INTO sales VALUES (5315, 190, 755.75);
+INSERT INTO sales VALUES (5316, 338, 762.25);
+INSERT INTO sales VALUES (5317, 486, 768.75);
+INSERT INTO sales VALUES (5318, 634, 775.25);
+INSERT INTO sales VALUES (5319, 782, 781.75);
+INSERT INTO sales VALUES (5320, 930, 788.25);
+INSERT INTO sales VALUES (5321, 1078, 794.75);
+INSERT INTO sales VALUES (5322, 1226, 801.25);
+INSERT INTO sales VALUES (5323, 1374, 807.75);
+INSERT INTO sales VALUES (5324, 1522, 814.25);
+INSERT INTO sales VALUES (5325, 1670, 820.75);
+INSERT INTO sales VALUES (5326, 1818, 827.25);
+INSERT INTO sales VALUES (5327, 1966, 833.75);
+INSERT INTO sales VALUES (5328, 2114, 840.25);
+INSERT INTO sales VALUES (5329, 2262, 846.75);
+INSERT INTO sales VALUES (5330, 2410, 853.25);
+INSERT INTO sales VALUES (5331, 2558, 859.75);
+INSERT INTO sales VALUES (5332, 2706, 866.25);
+INSERT INTO sales VALUES (5333, 2854, 872.75);
+INSERT INTO sales VALUES (5334, 3002, 879.25);
+INSERT INTO sales VALUES (5335, 3150, 885.75);
+INSERT INTO sales VALUES (5336, 3298, 892.25);
+INSERT INTO sales VALUES (5337, 3446, 898.75);
+INSERT INTO sales VALUES (5338, 3594, 905.25);
+INSERT INTO sales VALUES (5339, 3742, 911.75);
+INSERT INTO sales VALUES (5340, 3890, 918.25);
+INSERT INTO sales VALUES (5341, 4038, 924.75);
+INSERT INTO sales VALUES (5342, 4186, 931.25);
+INSERT INTO sales VALUES (5343, 4334, 937.75);
+INSERT INTO sales VALUES (5344, 4482, 944.25);
+INSERT INTO sales VALUES (5345, 4630, 950.75);
+INSERT INTO sales VALUES (5346, 4778, 957.25);
+INSERT INTO sales VALUES (5347, 4926, 963.75);
+INSERT INTO sales VALUES (5348, 5074, 970.25);
+INSERT INTO sales VALUES (5349, 5222, 976.75);
+INSERT INTO sales VALUES (5350, 5370, 983.25);
+INSERT INTO sales VALUES (5351, 5518, 989.75);
+INSERT INTO sales VALUES (5352, 5666, 996.25);
+INSERT INTO sales VALUES (5353, 5814, 1002.75);
+INSERT INTO sales VALUES (5354, 5962, 1009.25);
+INSERT INTO sales VALUES (5355, 6110, 1015.75);
+INSERT INTO sales VALUES (5356, 6258, 1022.25);
+INSERT INTO sales VALUES (5357, 6406, 4.75);
+INSERT INTO sales VALUES (5358, 6554, 11.25);
+INSERT INTO sales VALUES (5359, 6702, 17.75);
+INSERT INTO sales VALUES (5360, 6850, 24.25);
+INSERT INTO sales VALUES (5361, 6998, 30.75);
+INSERT INTO sales VALUES (5362, 7146, 37.25);
+INSERT INTO sales VALUES (5363, 7294, 43.75);
+INSERT INTO sales VALUES (5364, 7442, 50.25);
+INSERT INTO sales VALUES (5365, 7590, 56.75);
+INSERT INTO sales VALUES (5366, 7738, 63.25);
+INSERT INTO sales VALUES (5367, 7886, 69.75);
+INSERT INTO sales VALUES (5368, 8034, 76.25);
+INSERT INTO sales VALUES (5369, 8182, 82.75);
+INSERT INTO sales VALUES (5370, 138, 89.25);
+INSERT INTO sales VALUES (5371, 286, 95.75);
+INSERT INTO sales VALUES (5372, 434, 102.25);
+INSERT INTO sales VALUES (5373, 582, 108.75);
+INSERT INTO sales VALUES (5374, 730, 115.25);
+INSERT INTO sales VALUES (5375, 878, 121.75);
+INSERT INTO sales VALUES (5376, 1026, 128.25);
+INSERT INTO sales VALUES (5377, 1174, 134.75);
+INSERT INTO sales VALUES (5378, 1322, 141.25);
+INSERT INTO sales VALUES (5379, 1470, 147.75);
+INSERT INTO sales VALUES (5380, 1618, 154.25);
+INSERT INTO sales VALUES (5381, 1766, 160.75);
+INSERT INTO sales VALUES (5382, 1914, 167.25);
+INSERT INTO sales VALUES (5383, 2062, 173.75);
+INSERT INTO sales VALUES (5384, 2210, 180.25);
+INSERT INTO sales VALUES (5385, 2358, 186.75);
+INSERT INTO sales VALUES (5386, 2506, 193.25);
+INSERT INTO sales VALUES (5387, 2654, 199.75);
+INSERT INTO sales VALUES (5388, 2802, 206.25);
+INSERT INTO sales VALUES (5389, 2950, 212.75);
+INSERT INTO sales VALUES (5390, 3098, 219.25);
+INSERT INTO sales VALUES (5391, 3246, 225.75);
+INSERT INTO sales VALUES (5392, 3394, 232.25);
+INSERT INTO sales VALUES (5393, 3542, 238.75);
+INSERT INTO sales VALUES (5394, 3690, 245.25);
+INSERT INTO sales VALUES (5395, 3838, 251.75);
+INSERT INTO sales VALUES (5396, 3986, 258.25);
+INSERT INTO sales VALUES (5397, 4134, 264.75);
+INSERT INTO sales VALUES (5398, 4282, 271.25);
+INSERT INTO sales VALUES (5399, 4430, 277.75);
+INSERT INTO sales VALUES (5400, 4578, 284.25);
+INSERT INTO sales VALUES (5401, 4726, 290.75);
+INSERT INTO sales VALUES (5402, 4874, 297.25);
+INSERT INTO sales VALUES (5403, 5022, 303.75);
+INSERT INTO sales VALUES (5404, 5170, 310.25);
+INSERT INTO sales VALUES (5405, 5318, 316.75);
+INSERT INTO sales VALUES (5406, 5466, 323.25);
+INSERT INTO sales VALUES (5407, 5614, 329.75);
+INSERT INTO sales VALUES (5408, 5762, 336.25);
+INSERT INTO sales VALUES (5409, 5910, 342.75);
+INSERT INTO sales VALUES (5410, 6058, 349.25);
+INSERT INTO sales VALUES (5411, 6206, 355.75);
+INSERT INTO sales VALUES (5412, 6354, 362.25);
+INSERT INTO sales VALUES (5413, 6502, 368.75);
+INSERT INTO sales VALUES (5414, 6650, 375.25);
+INSERT INTO sales VALUES (5415, 6798, 381.75);
+INSERT INTO sales VALUES (5416, 6946, 388.25);
+INSERT INTO sales VALUES (5417, 7094, 394.75);
+INSERT INTO sales VALUES (5418, 7242, 401.25);
+INSERT INTO sales VALUES (5419, 7390, 407.75);
+INSERT INTO sales VALUES (5420, 7538, 414.25);
+INSERT INTO sales VALUES (5421, 7686, 420.75);
+INSERT INTO sales VALUES (5422, 7834, 427.25);
+INSERT INTO sales VALUES (5423, 7982, 433.75);
+INSERT INTO sales VALUES (5424, 8130, 440.25);
+INSERT INTO sales VALUES (5425, 86, 446.75);
+INSERT INTO sales VALUES (5426, 234, 453.25);
+INSERT INTO sales VALUES (5427, 382, 459.75);
+INSERT INTO sales VALUES (5428, 530, 466.25);
+INSERT INTO sales VALUES (5429, 678, 472.75);
+INSERT INTO sales VALUES (5430, 826, 479.25);
+INSERT INTO sales VALUES (5431, 974, 485.75);
+INSERT INTO sales VALUES (5432, 1122, 492.25);
+INSERT INTO sales VALUES (5433, 1270, 498.75);
+INSERT INTO sales VALUES (5434, 1418, 505.25);
+INSERT INTO sales VALUES (5435, 1566, 511.75);
+INSERT INTO sales VALUES (5436, 1714, 518.25);
+INSERT INTO sales VALUES (5437, 1862, 524.75);
+INSERT INTO sales VALUES (5438, 2010, 531.25);
+INSERT INTO sales VALUES (5439, 2158, 537.75);
+INSERT INTO sales VALUES (5440, 2306, 544.25);
+INSERT INTO sales VALUES (5441, 2454, 550.75);
+INSERT INTO sales VALUES (5442, 2602, 557.25);
+INSERT INTO sales VALUES (5443, 2750, 563.75);
+INSERT INTO sales VALUES (5444, 2898, 570.25);
+INSERT INTO sales VALUES (5445, 3046, 576.75);
+INSERT INTO sales VALUES (5446, 3194, 583.25);
+INSERT INTO sales VALUES (5447, 3342, 589.75);
+INSERT INTO sales VALUES (5448, 3490, 596.25);
+INSERT INTO sales VALUES (5449, 3638, 602.75);
+INSERT INTO sales VALUES (5450, 3786, 609.25);
+INSERT INTO sales VALUES (5451, 3934, 615.75);
+INSERT INTO sales VALUES (5452, 4082, 622.25);
+INSERT INTO sales VALUES (5453, 4230, 628.75);
+INSERT INTO sales VALUES (5454, 4378, 635.25);
+INSERT INTO sales VALUES (5455, 4526, 641.75);
+INSERT INTO sales VALUES (5456, 4674, 648.25);
+INSERT INTO sales VALUES (5457, 4822, 654.75);
+INSERT INTO sales VALUES (5458, 4970, 661.25);
+INSERT INTO sales VALUES (5459, 5118, 667.75);
+INSERT INTO sales VALUES (5460, 5266, 674.25);
+INSERT INTO sales VALUES (5461, 5414, 680.75);
+INSERT INTO sales VALUES (5462, 5562, 687.25);
+INSERT INTO sales VALUES (5463, 5710, 693.75);
+INSERT INTO sales VALUES (5464, 5858, 700.25);
+INSERT INTO sales VALUES (5465, 6006, 706.75);
+INSERT INTO sales VALUES (5466, 6154, 713.25);
+INSERT INTO sales VALUES (5467, 6302, 719.75);
+INSERT INTO sales VALUES (5468, 6450, 726.25);
+INSERT INTO sales VALUES (5469, 6598, 732.75);
+INSERT INTO sales VALUES (5470, 6746, 739.25);
+INSERT INTO sales VALUES (5471, 6894, 745.75);
+INSERT INTO sales VALUES (5472, 7042, 752.25);
+INSERT INTO sales VALUES (5473, 7190, 758.75);
+INSERT INTO sales VALUES (5474, 7338, 765.25);
+INSERT INTO sales VALUES (5475, 7486, 771.75);
+INSERT INTO sales VALUES (5476, 7634, 778.25);
+INSERT INTO sales VALUES (5477, 7782, 784.75);
+INSERT INTO sales VALUES (5478, 7930, 791.25);
+INSERT INTO sales VALUES (5479, 8078, 797.75);
+INSERT INTO sales VALUES (5480, 34, 804.25);
+INSERT INTO sales VALUES (5481, 182, 810.75);
+INSERT INTO sales VALUES (5482, 330, 817.25);
+INSERT INTO sales VALUES (5483, 478, 823.75);
+INSERT INTO sales VALUES (5484, 626, 830.25);
+INSERT INTO sales VALUES (5485, 774, 836.75);
+INSERT INTO sales VALUES (5486, 922, 843.25);
+INSERT INTO sales VALUES (5487, 1070, 849.75);
+INSERT INTO sales VALUES (5488, 1218, 856.25);
+INSERT INTO sales VALUES (5489, 1366, 862.75);
+INSERT INTO sales VALUES (5490, 1514, 869.25);
+INSERT INTO sales VALUES (5491, 1662, 875.75);
+INSERT INTO sales VALUES (5492, 1810, 882.25);
+INSERT INTO sales VALUES (5493, 1958, 888.75);
+INSERT INTO sales VALUES (5494, 2106, 895.25);
+INSERT INTO sales VALUES (5495, 2254, 901.75);
+INSERT INTO sales VALUES (5496, 2402, 908.25);
+INSERT INTO sales VALUES (5497, 2550, 914.75);
+INSERT INTO sales VALUES (5498, 2698, 921.25);
+INSERT INTO sales VALUES (5499, 2846, 927.75);
+INSERT INTO sales VALUES (5500, 2994, 934.25);
+INSERT INTO sales VALUES (5501, 3142, 940.75);
+INSERT INTO sales VALUES (5502, 3290, 947.25);
+INSERT INTO sales VALUES (5503, 3438, 953.75);
+INSERT INTO sales VALUES (5504, 3586, 960.25);
+INSERT INTO sales VALUES (5505, 3734, 966.75);
+INSERT INTO sales VALUES (5506, 3882, 973.25);
+INSERT INTO sales VALUES (5507, 4030, 979.75);
+INSERT INTO sales VALUES (5508, 4178, 986.25);
+INSERT INTO sales VALUES (5509, 4326, 992.75);
+INSERT INTO sales VALUES (5510, 4474, 999.25);
+INSERT INTO sales VALUES (5511, 4622, 1005.75);
+INSERT INTO sales VALUES (5512, 4770, 1012.25);
+INSERT INTO sales VALUES (5513, 4918, 1018.75);
+INSERT INTO sales VALUES (5514, 5066, 1.25);
+INSERT INTO sales VALUES (5515, 5214, 7.75);
+INSERT INTO sales VALUES (5516, 5362, 14.25);
+INSERT INTO sales VALUES (5517, 5510, 20.75);
+INSERT INTO sales VALUES (5518, 5658, 27.25);
+INSERT INTO sales VALUES (5519, 5806, 33.75);
+INSERT INTO sales VALUES (5520, 5954, 40.25);
+INSERT INTO sales VALUES (5521, 6102, 46.75);
+INSERT INTO sales VALUES (5522, 6250, 53.25);
+INSERT INTO sales VALUES (5523, 6398, 59.75);
+INSERT INTO sales VALUES (5524, 6546, 66.25);
+INSERT INTO sales VALUES (5525, 6694, 72.75);
+INSERT INTO sales VALUES (5526, 6842, 79.25);
+INSERT INTO sales VALUES (5527, 6990, 85.75);
+INSERT INTO sales VALUES (5528, 7138, 92.25);
+INSERT INTO sales VALUES (5529, 7286, 98.75);
+INSERT INTO sales VALUES (5530, 7434, 105.25);
+INSERT INTO sales VALUES (5531, 7582, 111.75);
+INSERT INTO sales VALUES (5532, 7730, 118.25);
+INSERT INTO sales VALUES (5533, 7878, 124.75);
+INSERT INTO sales VALUES (5534, 8026, 131.25);
+INSERT INTO sales VALUES (5535, 8174, 137.75);
+INSERT INTO sales VALUES (5536, 130, 144.25);
+INSERT INTO sales VALUES (5537, 278, 150.75);
+INSERT INTO sales VALUES (5538, 426, 157.25);
+INSERT INTO sales VALUES (5539, 574, 163.75);
+INSERT INTO sales VALUES (5540, 722, 170.25);
+INSERT INTO sales VALUES (5541, 870, 176.75);
+INSERT INTO sales VALUES (5542, 1018, 183.25);
+INSERT INTO sales VALUES (5543, 1166, 189.75);
+INSERT INTO sales VALUES (5544, 1314, 196.25);
+INSERT INTO sales VALUES (5545, 1462, 202.75);
+INSERT INTO sales VALUES (5546, 1610, 209.25);
+INSERT INTO sales VALUES (5547, 1758, 215.75);
+INSERT INTO sales VALUES (5548, 1906, 222.25);
+INSERT INTO sales VALUES (5549, 2054, 228.75);
+INSERT INTO sales VALUES (5550, 2202, 235.25);
+INSERT INTO sales VALUES (5551, 2350, 241.75);
+INSERT INTO sales VALUES (5552, 2498, 248.25);
+INSERT INTO sales VALUES (5553, 2646, 254.75);
+INSERT INTO sales VALUES (5554, 2794, 261.25);
+INSERT INTO sales VALUES (5555, 2942, 267.75);
+INSERT INTO sales VALUES (5556, 3090, 274.25);
+INSERT INTO sales VALUES (5557, 3238, 280.75);
+INSERT INTO sales VALUES (5558, 3386, 287.25);
+INSERT INTO sales VALUES (5559, 3534, 293.75);
+INSERT INTO sales VALUES (5560, 3682, 300.25);
+INSERT INTO sales VALUES (5561, 3830, 306.75);
+INSERT INTO sales VALUES (5562, 3978, 313.25);
+INSERT INTO sales VALUES (5563, 4126, 319.75);
+INSERT INTO sales VALUES (5564, 4274, 326.25);
+INSERT INTO sales VALUES (5565, 4422, 332.75);
+INSERT INTO sales VALUES (5566, 4570, 339.25);
+INSERT INTO sales VALUES (5567, 4718, 345.75);
+INSERT INTO sales VALUES (5568, 4866, 352.25);
+INSERT INTO sales VALUES (5569, 5014, 358.75);
+INSERT INTO sales VALUES (5570, 5162, 365.25);
+INSERT INTO sales VALUES (5571, 5310, 371.75);
+INSERT INTO sales VALUES (5572, 5458, 378.25);
+INSERT INTO sales VALUES (5573, 5606, 384.75);
+INSERT INTO sales VALUES (5574, 5754, 391.25);
+INSERT INTO sales VALUES (5575, 5902, 397.75);
+INSERT INTO sales VALUES (5576, 6050, 404.25);
+INSERT INTO sales VALUES (5577, 6198, 410.75);
+INSERT INTO sales VALUES (5578, 6346, 417.25);
+INSERT INTO sales VALUES (5579, 6494, 423.75);
+INSERT INTO sales VALUES (5580, 6642, 430.25);
+INSERT INTO sales VALUES (5581, 6790, 436.75);
+INSERT INTO sales VALUES (5582, 6938, 443.25);
+INSERT INTO sales VALUES (5583, 7086, 449.75);
+INSERT INTO sales VALUES (5584, 7234, 456.25);
+INSERT INTO sales VALUES (5585, 7382, 462.75);
+INSERT INTO sales VALUES (5586, 7530, 469.25);
+INSERT INTO sales VALUES (5587, 7678, 475.75);
+INSERT INTO sales VALUES (5588, 7826, 482.25);
+INSERT INTO sales VALUES (5589, 7974, 488.75);
+INSERT INTO sales VALUES (5590, 8122, 495.25);
+INSERT INTO sales VALUES (5591, 78, 501.75);
+INSERT INTO sales VALUES (5592, 226, 508.25);
+INSERT INTO sales VALUES (5593, 374, 514.75);
+INSERT INTO sales VALUES (5594, 522, 521.25);
+INSERT INTO sales VALUES (5595, 670, 527.75);
+INSERT INTO sales VALUES (5596, 818, 534.25);
+INSERT INTO sales VALUES (5597, 966, 540.75);
+INSERT INTO sales VALUES (5598, 1114, 547.25);
+INSERT INTO sales VALUES (5599, 1262, 553.75);
+INSERT INTO sales VALUES (5600, 1410, 560.25);
+INSERT INTO sales VALUES (5601, 1558, 566.75);
+INSERT INTO sales VALUES (5602, 1706, 573.25);
+INSERT INTO sales VALUES (5603, 1854, 579.75);
+INSERT INTO sales VALUES (5604, 2002, 586.25);
+INSERT INTO sales VALUES (5605, 2150, 592.75);
+INSERT INTO sales VALUES (5606, 2298, 599.25);
+INSERT INTO sales VALUES (5607, 2446, 605.75);
+INSERT INTO sales VALUES (5608, 2594, 612.25);
+INSERT INTO sales VALUES (5609, 2742, 618.75);
+INSERT INTO sales VALUES (5610, 2890, 625.25);
+INSERT INTO sales VALUES (5611, 3038, 631.75);
+INSERT INTO sales VALUES (5612, 3186, 638.25);
+INSERT INTO sales VALUES (5613, 3334, 644.75);
+INSERT INTO sales VALUES (5614, 3482, 651.25);
+INSERT INTO sales VALUES (5615, 3630, 657.75);
+INSERT INTO sales VALUES (5616, 3778, 664.25);
+INSERT INTO sales VALUES (5617, 3926, 670.75);
+INSERT INTO sales VALUES (5618, 4074, 677.25);
+INSERT INTO sales VALUES (5619, 4222, 683.75);
+INSERT INTO sales VALUES (5620, 4370, 690.25);
+INSERT INTO sales VALUES (5621, 4518, 696.75);
+INSERT INTO sales VALUES (5622, 4666, 703.25);
+INSERT INTO sales VALUES (5623, 4814, 709.75);
+INSERT INTO sales VALUES (5624, 4962, 716.25);
+INSERT INTO sales VALUES (5625, 5110, 722.75);
+INSERT INTO sales VALUES (5626, 5258, 729.25);
+INSERT INTO sales VALUES (5627, 5406, 735.75);
+INSERT INTO sales VALUES (5628, 5554, 742.25);
+INSERT INTO sales VALUES (5629, 5702, 748.75);
+INSERT INTO sales VALUES (5630, 5850, 755.25);
+INSERT INTO sales VALUES (5631, 5998, 761.75);
+INSERT INTO sales VALUES (5632, 6146, 768.25);
+INSERT INTO sales VALUES (5633, 6294, 774.75);
+INSERT INTO sales VALUES (5634, 6442, 781.25);
+INSERT INTO sales VALUES (5635, 6590, 787.75);
+INSERT INTO sales VALUES (5636, 6738, 794.25);
+INSERT INTO sales VALUES (5637, 6886, 800.75);
+INSERT INTO sales VALUES (5638, 7034, 807.25);
+INSERT INTO sales VALUES (5639, 7182, 813.75);
+INSERT INTO sales VALUES (5640, 7330, 820.25);
+INSERT INTO sales VALUES (5641, 7478, 826.75);
+INSERT INTO sales VALUES (5642, 7626, 833.25);
+INSERT INTO sales VALUES (5643, 7774, 839.75);
+INSERT INTO sales VALUES (5644, 7922, 846.25);
+INSERT INTO sales VALUES (5645, 8070, 852.75);
+INSERT INTO sales VALUES (5646, 26, 859.25);
+INSERT INTO sales VALUES (5647, 174, 865.75);
+INSERT INTO sales VALUES (5648, 322, 872.25);
+INSERT INTO sales VALUES (5649, 470, 878.75);
+INSERT INTO sales VALUES (5650, 618, 885.25);
+INSERT INTO sales VALUES (5651, 766, 891.75);
+INSERT INTO sales VALUES (5652, 914, 898.25);
+INSERT INTO sales VALUES (5653, 1062, 904.75);
+INSERT INTO sales VALUES (5654, 1210, 911.25);
+INSERT INTO sales VALUES (5655, 1358, 917.75);
+INSERT INTO sales VALUES (5656, 1506, 924.25);
+INSERT INTO sales VALUES (5657, 1654, 930.75);
+INSERT INTO sales VALUES (5658, 1802, 937.25);
+INSERT INTO sales VALUES (5659, 1950, 943.75);
+INSERT INTO sales VALUES (5660, 2098, 950.25);
+INSERT INTO sales VALUES (5661, 2246, 956.75);
+INSERT INTO sales VALUES (5662, 2394, 963.25);
+INSERT INTO sales VALUES (5663, 2542, 969.75);
+INSERT INTO sales VALUES (5664, 2690, 976.25);
+INSERT INTO sales VALUES (5665, 2838, 982.75);
+INSERT INTO sales VALUES (5666, 2986, 989.25);
+INSERT INTO sales VALUES (5667, 3134, 995.75);
+INSERT INTO sales VALUES (5668, 3282, 1002.25);
+INSERT INTO sales VALUES (5669, 3430, 1008.75);
+INSERT INTO sales VALUES (5670, 3578, 1015.25);
+INSERT INTO sales VALUES (5671, 3726, 1021.75);
+INSERT INTO sales VALUES (5672, 3874, 4.25);
+INSERT INTO sales VALUES (5673, 4022, 10.75);
+INSERT INTO sales VALUES (5674, 4170, 17.25);
+INSERT INTO sales VALUES (5675, 4318, 23.75);
+INSERT INTO sales VALUES (5676, 4466, 30.25);
+INSERT INTO sales VALUES (5677, 4614, 36.75);
+INSERT INTO sales VALUES (5678, 4762, 43.25);
+INSERT INTO sales VALUES (5679, 4910, 49.75);
+INSERT INTO sales VALUES (5680, 5058, 56.25);
+INSERT INTO sales VALUES (5681, 5206, 62.75);
+INSERT INTO sales VALUES (5682, 5354, 69.25);
+INSERT INTO sales VALUES (5683, 5502, 75.75);
+INSERT INTO sales VALUES (5684, 5650, 82.25);
+INSERT INTO sales VALUES (5685, 5798, 88.75);
+INSERT INTO sales VALUES (5686, 5946, 95.25);
+INSERT INTO sales VALUES (5687, 6094, 101.75);
+INSERT INTO sales VALUES (5688, 6242, 108.25);
+INSERT INTO sales VALUES (5689, 6390, 114.75);
+INSERT INTO sales VALUES (5690, 6538, 121.25);
+INSERT INTO sales VALUES (5691, 6686, 127.75);
+INSERT INTO sales VALUES (5692, 6834, 134.25);
+INSERT INTO sales VALUES (5693, 6982, 140.75);
+INSERT INTO sales VALUES (5694, 7130, 147.25);
+INSERT INTO sales VALUES (5695, 7278, 153.75);
+INSERT INTO sales VALUES (5696, 7426, 160.25);
+INSERT INTO sales VALUES (5697, 7574, 166.75);
+INSERT INTO sales VALUES (5698, 7722, 173.25);
+INSERT INTO sales VALUES (5699, 7870, 179.75);
+INSERT INTO sales VALUES (5700, 8018, 186.25);
+INSERT INTO sales VALUES (5701, 8166, 192.75);
+INSERT INTO sales VALUES (5702, 122, 199.25);
+INSERT INTO sales VALUES (5703, 270, 205.75);
+INSERT INTO sales VALUES (5704, 418, 212.25);
+INSERT INTO sales VALUES (5705, 566, 218.75);
+INSERT INTO sales VALUES (5706, 714, 225.25);
+INSERT INTO sales VALUES (5707, 862, 231.75);
+INSERT INTO sales VALUES (5708, 1010, 238.25);
+INSERT INTO sales VALUES (5709, 1158, 244.75);
+INSERT INTO sales VALUES (5710, 1306, 251.25);
+INSERT INTO sales VALUES (5711, 1454, 257.75);
+INSERT INTO sales VALUES (5712, 1602, 264.25);
+INSERT INTO sales VALUES (5713, 1750, 270.75);
+INSERT INTO sales VALUES (5714, 1898, 277.25);
+INSERT INTO sales VALUES (5715, 2046, 283.75);
+INSERT INTO sales VALUES (5716, 2194, 290.25);
+INSERT INTO sales VALUES (5717, 2342, 296.75);
+INSERT INTO sales VALUES (5718, 2490, 303.25);
+INSERT INTO sales VALUES (5719, 2638, 309.75);
+INSERT INTO sales VALUES (5720, 2786, 316.25);
+INSERT INTO sales VALUES (5721, 2934, 322.75);
+INSERT INTO sales VALUES (5722, 3082, 329.25);
+INSERT INTO sales VALUES (5723, 3230, 335.75);
+INSERT INTO sales VALUES (5724, 3378, 342.25);
+INSERT INTO sales VALUES (5725, 3526, 348.75);
+INSERT INTO sales VALUES (5726, 3674, 355.25);
+INSERT INTO sales VALUES (5727, 3822, 361.75);
+INSERT INTO sales VALUES (5728, 3970, 368.25);
+INSERT INTO sales VALUES (5729, 4118, 374.75);
+INSERT INTO sales VALUES (5730, 4266, 381.25);
+INSERT INTO sales VALUES (5731, 4414, 387.75);
+INSERT INTO sales VALUES (5732, 4562, 394.25);
+INSERT INTO sales VALUES (5733, 4710, 400.75);
+INSERT INTO sales VALUES (5734, 4858, 407.25);
+INSERT INTO sales VALUES (5735, 5006, 413.75);
+INSERT INTO sales VALUES (5736, 5154, 420.25);
+INSERT INTO sales VALUES (5737, 5302, 426.75);
+INSERT INTO sales VALUES (5738, 5450, 433.25);
+INSERT INTO sales VALUES (5739, 5598, 439.75);
+INSERT INTO sales VALUES (5740, 5746, 446.25);
+INSERT INTO sales VALUES (5741, 5894, 452.75);
+INSERT INTO sales VALUES (5742, 6042, 459.25);
+INSERT INTO sales VALUES (5743, 6190, 465.75);
+INSERT INTO sales VALUES (5744, 6338, 472.25);
+INSERT INTO sales VALUES (5745, 6486, 478.75);
+INSERT INTO sales VALUES (5746, 6634, 485.25);
+INSERT INTO sales VALUES (5747, 6782, 491.75);
+INSERT INTO sales VALUES (5748, 6930, 498.25);
+INSERT INTO sales VALUES (5749, 7078, 504.75);
+INSERT INTO sales VALUES (5750, 7226, 511.25);
+INSERT INTO sales VALUES (5751, 7374, 517.75);
+INSERT INTO sales VALUES (5752, 7522, 524.25);
+INSERT INTO sales VALUES (5753, 7670, 530.75);
+INSERT INTO sales VALUES (5754, 7818, 537.25);
+INSERT INTO sales VALUES (5755, 7966, 543.75);
+INSERT INTO sales VALUES (5756, 8114, 550.25);
+INSERT INTO sales VALUES (5757, 70, 556.75);
+INSERT INTO sales VALUES (5758, 218, 563.25);
+INSERT INTO sales VALUES (5759, 366, 569.75);
+INSERT INTO sales VALUES (5760, 514, 576.25);
+INSERT INTO sales VALUES (5761, 662, 582.75);
+INSERT INTO sales VALUES (5762, 810, 589.25);
+INSERT INTO sales VALUES (5763, 958, 595.75);
+INSERT INTO sales VALUES (5764, 1106, 602.25);
+INSERT INTO sales VALUES (5765, 1254, 608.75);
+INSERT INTO sales VALUES (5766, 1402, 615.25);
+INSERT INTO sales VALUES (5767, 1550, 621.75);
+INSERT INTO sales VALUES (5768, 1698, 628.25);
+INSERT INTO sales VALUES (5769, 1846, 634.75);
+INSERT INTO sales VALUES (5770, 1994, 641.25);
+INSERT INTO sales VALUES (5771, 2142, 647.75);
+INSERT INTO sales VALUES (5772, 2290, 654.25);
+INSERT INTO sales VALUES (5773, 2438, 660.75);
+INSERT INTO sales VALUES (5774, 2586, 667.25);
+INSERT INTO sales VALUES (5775, 2734, 673.75);
+INSERT INTO sales VALUES (5776, 2882, 680.25);
+INSERT INTO sales VALUES (5777, 3030, 686.75);
+INSERT INTO sales VALUES (5778, 3178, 693.25);
+INSERT INTO sales VALUES (5779, 3326, 699.75);
+INSERT INTO sales VALUES (5780, 3474, 706.25);
+INSERT INTO sales VALUES (5781, 3622, 712.75);
+INSERT INTO sales VALUES (5782, 3770, 719.25);
+INSERT INTO sales VALUES (5783, 3918, 725.75);
+INSERT INTO sales VALUES (5784, 4066, 732.25);
+INSERT INTO sales VALUES (5785, 4214, 738.75);
+INSERT INTO sales VALUES (5786, 4362, 745.25);
+INSERT INTO sales VALUES (5787, 4510, 751.75);
+INSERT INTO sales VALUES (5788, 4658, 758.25);
+INSERT INTO sales VALUES (5789, 4806, 764.75);
+INSERT INTO sales VALUES (5790, 4954, 771.25);
+INSERT INTO sales VALUES (5791, 5102, 777.75);
+INSERT INTO sales VALUES (5792, 5250, 784.25);
+INSERT INTO sales VALUES (5793, 5398, 790.75);
+INSERT INTO sales VALUES (5794, 5546, 797.25);
+INSERT INTO sales VALUES (5795, 5694, 803.75);
+INSERT INTO sales VALUES (5796, 5842, 810.25);
+INSERT INTO sales VALUES (5797, 5990, 816.75);
+INSERT INTO sales VALUES (5798, 6138, 823.25);
+INSERT INTO sales VALUES (5799, 6286, 829.75);
+INSERT INTO sales VALUES (5800, 6434, 836.25);
+INSERT INTO sales VALUES (5801, 6582, 842.75);
+INSERT INTO sales VALUES (5802, 6730, 849.25);
+INSERT INTO sales VALUES (5803, 6878, 855.75);
+INSERT INTO sales VALUES (5804, 7026, 862.25);
+INSERT INTO sales VALUES (5805, 7174, 868.75);
+INSERT INTO sales VALUES (5806, 7322, 875.25);
+INSERT INTO sales VALUES (5807, 7470, 881.75);
+INSERT INTO sales VALUES (5808, 7618, 888.25);
+INSERT INTO sales VALUES (5809, 7766, 894.75);
+INSERT INTO sales VALUES (5810, 7914, 901.25);
+INSERT INTO sales VALUES (5811, 8062, 907.75);
+INSERT INTO sales VALUES (5812, 18, 914.25);
+INSERT INTO sales VALUES (5813, 166, 920.75);
+INSERT INTO sales VALUES (5814, 314, 927.25);
+INSERT INTO sales VALUES (5815, 462, 933.75);
+INSERT INTO sales VALUES (5816, 610, 940.25);
+INSERT INTO sales VALUES (5817, 758, 946.75);
+INSERT INTO sales VALUES (5818, 906, 953.25);
+INSERT INTO sales VALUES (5819, 1054, 959.75);
+INSERT INTO sales VALUES (5820, 1202, 966.25);
+INSERT INTO sales VALUES (5821, 1350, 972.75);
+INSERT INTO sales VALUES (5822, 1498, 979.25);
+INSERT INTO sales VALUES (5823, 1646, 985.75);
+INSERT INTO sales VALUES (5824, 1794, 992.25);
+INSERT INTO sales VALUES (5825, 1942, 998.75);
+INSERT INTO sales VALUES (5826, 2090, 1005.25);
+INSERT INTO sales VALUES (5827, 2238, 1011.75);
+INSERT INTO sales VALUES (5828, 2386, 1018.25);
+INSERT INTO sales VALUES (5829, 2534, 0.75);
+INSERT INTO sales VALUES (5830, 2682, 7.25);
+INSERT INTO sales VALUES (5831, 2830, 13.75);
+INSERT INTO sales VALUES (5832, 2978, 20.25);
+INSERT INTO sales VALUES (5833, 3126, 26.75);
+INSERT INTO sales VALUES (5834, 3274, 33.25);
+INSERT INTO sales VALUES (5835, 3422, 39.75);
+INSERT INTO sales VALUES (5836, 3570, 46.25);
+INSERT INTO sales VALUES (5837, 3718, 52.75);
+INSERT INTO sales VALUES (5838, 3866, 59.25);
+INSERT INTO sales VALUES (5839, 4014, 65.75);
+INSERT INTO sales VALUES (5840, 4162, 72.25);
+INSERT INTO sales VALUES (5841, 4310, 78.75);
+INSERT INTO sales VALUES (5842, 4458, 85.25);
+INSERT INTO sales VALUES (5843, 4606, 91.75);
+INSERT INTO sales VALUES (5844, 4754, 98.25);
+INSERT INTO sales VALUES (5845, 4902, 104.75);
+INSERT INTO sales VALUES (5846, 5050, 111.25);
+INSERT INTO sales VALUES (5847, 5198, 117.75);
+INSERT INTO sales VALUES (5848, 5346, 124.25);
+INSERT INTO sales VALUES (5849, 5494, 130.75);
+INSERT INTO sales VALUES (5850, 5642, 137.25);
+INSERT INTO sales VALUES (5851, 5790, 143.75);
+INSERT INTO sales VALUES (5852, 5938, 150.25);
+INSERT INTO sales VALUES (5853, 6086, 156.75);
+INSERT INTO sales VALUES (5854, 6234, 163.25);
+INSERT INTO sales VALUES (5855, 6382, 169.75);
+INSERT INTO sales VALUES (5856, 6530, 176.25);
+INSERT INTO sales VALUES (5857, 6678, 182.75);
+INSERT INTO sales VALUES (5858, 6826, 189.25);
+INSERT INTO sales VALUES (5859, 6974, 195.75);
+INSERT INTO sales VALUES (5860, 7122, 202.25);
+INSERT INTO sales VALUES (5861, 7270, 208.75);
+INSERT INTO sales VALUES (5862, 7418, 215.25);
+INSERT INTO sales VALUES (5863, 7566, 221.75);
+INSERT INTO sales VALUES (5864, 7714, 228.25);
+INSERT INTO sales VALUES (5865, 7862, 234.75);
+INSERT INTO sales VALUES (5866, 8010, 241.25);
+INSERT INTO sales VALUES (5867, 8158, 247.75);
+INSERT INTO sales VALUES (5868, 114, 254.25);
+INSERT INTO sales VALUES (5869, 262, 260.75);
+INSERT INTO sales VALUES (5870, 410, 267.25);
+INSERT INTO sales VALUES (5871, 558, 273.75);
+INSERT INTO sales VALUES (5872, 706, 280.25);
+INSERT INTO sales VALUES (5873, 854, 286.75);
+INSERT INTO sales VALUES (5874, 1002, 293.25);
+INSERT INTO sales VALUES (5875, 1150, 299.75);
+INSERT INTO sales VALUES (5876, 1298, 306.25);
+INSERT INTO sales VALUES (5877, 1446, 312.75);
+INSERT INTO sales VALUES (5878, 1594, 319.25);
+INSERT INTO sales VALUES (5879, 1742, 325.75);
+INSERT INTO sales VALUES (5880, 1890, 332.25);
+INSERT INTO sales VALUES (5881, 2038, 338.75);
+INSERT INTO sales VALUES (5882, 2186, 345.25);
+INSERT INTO sales VALUES (5883, 2334, 351.75);
+INSERT INTO sales VALUES (5884, 2482, 358.25);
+INSERT INTO sales VALUES (5885, 2630, 364.75);
+INSERT INTO sales VALUES (5886, 2778, 371.25);
+INSERT INTO sales VALUES (5887, 2926, 377.75);
+INSERT INTO sales VALUES (5888, 3074, 384.25);
+INSERT INTO sales VALUES (5889, 3222, 390.75);
+INSERT INTO sales VALUES (5890, 3370, 397.25);
+INSERT INTO sales VALUES (5891, 3518, 403.75);
+INSERT INTO sales VALUES (5892, 3666, 410.25);
+INSERT INTO sales VALUES (5893, 3814, 416.75);
+INSERT INTO sales VALUES (5894, 3962, 423.25);
+INSERT INTO sales VALUES (5895, 4110, 429.75);
+INSERT INTO sales VALUES (5896, 4258, 436.25);
+INSERT INTO sales VALUES (5897, 4406, 442.75);
+INSERT INTO sales VALUES (5898, 4554, 449.25);
+INSERT INTO sales VALUES (5899, 4702, 455.75);
+INSERT INTO sales VALUES (5900, 4850, 462.25);
+INSERT INTO sales VALUES (5901, 4998, 468.75);
+INSERT INTO sales VALUES (5902, 5146, 475.25);
+INSERT INTO sales VALUES (5903, 5294, 481.75);
+INSERT INTO sales VALUES (5904, 5442, 488.25);
+INSERT INTO sales VALUES (5905, 5590, 494.75);
+INSERT INTO sales VALUES (5906, 5738, 501.25);
+INSERT INTO sales VALUES (5907, 5886, 507.75);
+INSERT INTO sales VALUES (5908, 6034, 514.25);
+INSERT INTO sales VALUES (5909, 6182, 520.75);
+INSERT INTO sales VALUES (5910, 6330, 527.25);
+INSERT INTO sales VALUES (5911, 6478, 533.75);
+INSERT INTO sales VALUES (5912, 6626, 540.25);
+INSERT INTO sales VALUES (5913, 6774, 546.75);
+INSERT INTO sales VALUES (5914, 6922, 553.25);
+INSERT INTO sales VALUES (5915, 7070, 559.75);
+INSERT INTO sales VALUES (5916, 7218, 566.25);
+INSERT INTO sales VALUES (5917, 7366, 572.75);
+INSERT INTO sales VALUES (5918, 7514, 579.25);
+INSERT INTO sales VALUES (5919, 7662, 585.75);
+INSERT INTO sales VALUES (5920, 7810, 592.25);
+INSERT INTO sales VALUES (5921, 7958, 598.75);
+INSERT INTO sales VALUES (5922, 8106, 605.25);
+INSERT INTO sales VALUES (5923, 62, 611.75);
+INSERT INTO sales VALUES (5924, 210, 618.25);
+INSERT INTO sales VALUES (5925, 358, 624.75);
+INSERT INTO sales VALUES (5926, 506, 631.25);
+INSERT INTO sales VALUES (5927, 654, 637.75);
+INSERT INTO sales VALUES (5928, 802, 644.25);
+INSERT INTO sales VALUES (5929, 950, 650.75);
+INSERT INTO sales VALUES (5930, 1098, 657.25);
+INSERT INTO sales VALUES (5931, 1246, 663.75);
+INSERT INTO sales VALUES (5932, 1394, 670.25);
+INSERT INTO sales VALUES (5933, 1542, 676.75);
+INSERT INTO sales VALUES (5934, 1690, 683.25);
+INSERT INTO sales VALUES (5935, 1838, 689.75);
+INSERT INTO sales VALUES (5936, 1986, 696.25);
+INSERT INTO sales VALUES (5937, 2134, 702.75);
+INSERT INTO sales VALUES (5938, 2282, 709.25);
+INSERT INTO sales VALUES (5939, 2430, 715.75);
+INSERT INTO sales VALUES (5940, 2578, 722.25);
+INSERT INTO sales VALUES (5941, 2726, 728.75);
+INSERT INTO sales VALUES (5942, 2874, 735.25);
+INSERT INTO sales VALUES (5943, 3022, 741.75);
+INSERT INTO sales VALUES (5944, 3170, 748.25);
+INSERT INTO sales VALUES (5945, 3318, 754.75);
+INSERT INTO sales VALUES (5946, 3466, 761.25);
+INSERT INTO sales VALUES (5947, 3614, 767.75);
+INSERT INTO sales VALUES (5948, 3762, 774.25);
+INSERT INTO sales VALUES (5949, 3910, 780.75);
+INSERT INTO sales VALUES (5950, 4058, 787.25);
+INSERT INTO sales VALUES (5951, 4206, 793.75);
+INSERT INTO sales VALUES (5952, 4354, 800.25);
+INSERT INTO sales VALUES (5953, 4502, 806.75);
+INSERT INTO sales VALUES (5954, 4650, 813.25);
+INSERT INTO sales VALUES (5955, 4798, 819.75);
+INSERT INTO sales VALUES (5956, 4946, 826.25);
+INSERT INTO sales VALUES (5957, 5094, 832.75);
+INSERT INTO sales VALUES (5958, 5242, 839.25);
+INSERT INTO sales VALUES (5959, 5390, 845.75);
+INSERT INTO sales VALUES (5960, 5538, 852.25);
+INSERT INTO sales VALUES (5961, 5686, 858.75);
+INSERT INTO sales VALUES (5962, 5834, 865.25);
+INSERT INTO sales VALUES (5963, 5982, 871.75);
+INSERT INTO sales VALUES (5964, 6130, 878.25);
+INSERT INTO sales VALUES (5965, 6278, 884.75);
+INSERT INTO sales VALUES (5966, 6426, 891.25);
+INSERT INTO sales VALUES (5967, 6574, 897.75);
+INSERT INTO sales VALUES (5968, 6722, 904.25);
+INSERT INTO sales VALUES (5969, 6870, 910.75);
+INSERT INTO sales VALUES (5970, 7018, 917.25);
+INSERT INTO sales VALUES (5971, 7166, 923.75);
+INSERT INTO sales VALUES (5972, 7314, 930.25);
+INSERT INTO sales VALUES (5973, 7462, 936.75);
+INSERT INTO sales VALUES (5974, 7610, 943.25);
+INSERT INTO sales VALUES (5975, 7758, 949.75);
+INSERT INTO sales VALUES (5976, 7906, 956.25);
+INSERT INTO sales VALUES (5977, 8054, 962.75);
+INSERT INTO sales VALUES (5978, 10, 969.25);
+INSERT INTO sales VALUES (5979, 158, 975.75);
+INSERT INTO sales VALUES (5980, 306, 982.25);
+INSERT INTO sales VALUES (5981, 454, 988.75);
+INSERT INTO sales VALUES (5982, 602, 995.25);
+INSERT INTO sales VALUES (5983, 750, 1001.75);
+INSERT INTO sales VALUES (5984, 898, 1008.25);
+INSERT INTO sales VALUES (5985, 1046, 1014.75);
+INSERT INTO sales VALUES (5986, 1194, 1021.25);
+INSERT INTO sales VALUES (5987, 1342, 3.75);
+INSERT INTO sales VALUES (5988, 1490, 10.25);
+INSERT INTO sales VALUES (5989, 1638, 16.75);
+INSERT INTO sales VALUES (5990, 1786, 23.25);
+INSERT INTO sales VALUES (5991, 1934, 29.75);
+INSERT INTO sales VALUES (5992, 2082, 36.25);
+INSERT INTO sales VALUES (5993, 2230, 42.75);
+INSERT INTO sales VALUES (5994, 2378, 49.25);
+INSERT INTO sales VALUES (5995, 2526, 55.75);
+INSERT INTO sales VALUES (5996, 2674, 62.25);
+INSERT INTO sales VALUES (5997, 2822, 68.75);
+INSERT INTO sales VALUES (5998, 2970, 75.25);
+INSERT INTO sales VALUES (5999, 3118, 81.75);
+INSERT INTO sales VALUES (6000, 3266, 88.25);
+INSERT INTO sales VALUES (6001, 3414, 94.75);
+INSERT INTO sales VALUES (6002, 3562, 101.25);
+INSERT INTO sales VALUES (6003, 3710, 107.75);
+INSERT INTO sales VALUES (6004, 3858, 114.25);
+INSERT INTO sales VALUES (6005, 4006, 120.75);
+INSERT INTO sales VALUES (6006, 4154, 127.25);
+INSERT INTO sales VALUES (6007, 4302, 133.75);
+INSERT INTO sales VALUES (6008, 4450, 140.25);
+INSERT INTO sales VALUES (6009, 4598, 146.75);
+INSERT INTO sales VALUES (6010, 4746, 153.25);
+INSERT INTO sales VALUES (6011, 4894, 159.75);
+INSERT INTO sales VALUES (6012, 5042, 166.25);
+INSERT INTO sales VALUES (6013, 5190, 172.75);
+INSERT INTO sales VALUES (6014, 5338, 179.25);
+INSERT INTO sales VALUES (6015, 5486, 185.75);
+INSERT INTO sales VALUES (6016, 5634, 192.25);
+INSERT INTO sales VALUES (6017, 5782, 198.75);
+INSERT INTO sales VALUES (6018, 5930, 205.25);
+INSERT INTO sales VALUES (6019, 6078, 211.75);
+INSERT INTO sales VALUES (6020, 6226, 218.25);
+INSERT INTO sales VALUES (6021, 6374, 224.75);
+INSERT INTO sales VALUES (6022, 6522, 231.25);
+INSERT INTO sales VALUES (6023, 6670, 237.75);
+INSERT INTO sales VALUES (6024, 6818, 244.25);
+INSERT INTO sales VALUES (6025, 6966, 250.75);
+INSERT INTO sales VALUES (6026, 7114, 257.25);
+INSERT INTO sales VALUES (6027, 7262, 263.75);
+INSERT INTO sales VALUES (6028, 7410, 270.25);
+INSERT INTO sales VALUES (6029, 7558, 276.75);
+INSERT INTO sales VALUES (6030, 7706, 283.25);
+INSERT INTO sales VALUES (6031, 7854, 289.75);
+INSERT INTO sales VALUES (6032, 8002, 296.25);
+INSERT INTO sales VALUES (6033, 8150, 302.75);
+INSERT INTO sales VALUES (6034, 106, 309.25);
+INSERT INTO sales VALUES (6035, 254, 315.75);
+INSERT INTO sales VALUES (6036, 402, 322.25);
+INSERT INTO sales VALUES (6037, 550, 328.75);
+INSERT INTO sales VALUES (6038, 698, 335.25);
+INSERT INTO sales VALUES (6039, 846, 341.75);
+INSERT INTO sales VALUES (6040, 994, 348.25);
+INSERT INTO sales VALUES (6041, 1142, 354.75);
+INSERT INTO sales VALUES (6042, 1290, 361.25);
+INSERT INTO sales VALUES (6043, 1438, 367.75);
+INSERT INTO sales VALUES (6044, 1586, 374.25);
+INSERT INTO sales VALUES (6045, 1734, 380.75);
+INSERT INTO sales VALUES (6046, 1882, 387.25);
+INSERT INTO sales VALUES (6047, 2030, 393.75);
+INSERT INTO sales VALUES (6048, 2178, 400.25);
+INSERT INTO sales VALUES (6049, 2326, 406.75);
+INSERT INTO sales VALUES (6050, 2474, 413.25);
+INSERT INTO sales VALUES (6051, 2622, 419.75);
+INSERT INTO sales VALUES (6052, 2770, 426.25);
+INSERT INTO sales VALUES (6053, 2918, 432.75);
+INSERT INTO sales VALUES (6054, 3066, 439.25);
+INSERT INTO sales VALUES (6055, 3214, 445.75);
+INSERT INTO sales VALUES (6056, 3362, 452.25);
+INSERT INTO sales VALUES (6057, 3510, 458.75);
+INSERT INTO sales VALUES (6058, 3658, 465.25);
+INSERT INTO sales VALUES (6059, 3806, 471.75);
+INSERT INTO sales VALUES (6060, 3954, 478.25);
+INSERT INTO sales VALUES (6061, 4102, 484.75);
+INSERT INTO sales VALUES (6062, 4250, 491.25);
+INSERT INTO sales VALUES (6063, 4398, 497.75);
+INSERT INTO sales VALUES (6064, 4546, 504.25);
+INSERT INTO sales VALUES (6065, 4694, 510.75);
+INSERT INTO sales VALUES (6066, 4842, 517.25);
+INSERT INTO sales VALUES (6067, 4990, 523.75);
+INSERT INTO sales VALUES (6068, 5138, 530.25);
+INSERT INTO sales VALUES (6069, 5286, 536.75);
+INSERT INTO sales VALUES (6070, 5434, 543.25);
+INSERT INTO sales VALUES (6071, 5582, 549.75);
+INSERT INTO sales VALUES (6072, 5730, 556.25);
+INSERT INTO sales VALUES (6073, 5878, 562.75);
+INSERT INTO sales VALUES (6074, 6026, 569.25);
+INSERT INTO sales VALUES (6075, 6174, 575.75);
+INSERT INTO sales VALUES (6076, 6322, 582.25);
+INSERT INTO sales VALUES (6077, 6470, 588.75);
+INSERT INTO sales VALUES (6078, 6618, 595.25);
+INSERT INTO sales VALUES (6079, 6766, 601.75);
+INSERT INTO sales VALUES (6080, 6914, 608.25);
+INSERT INTO sales VALUES (6081, 7062, 614.75);
+INSERT INTO sales VALUES (6082, 7210, 621.25);
+INSERT INTO sales VALUES (6083, 7358, 627.75);
+INSERT INTO sales VALUES (6084, 7506, 634.25);
+INSERT INTO sales VALUES (6085, 7654, 640.75);
+INSERT INTO sales VALUES (6086, 7802, 647.25);
+INSERT INTO sales VALUES (6087, 7950, 653.75);
+INSERT INTO sales VALUES (6088, 8098, 660.25);
+INSERT INTO sales VALUES (6089, 54, 666.75);
+INSERT INTO sales VALUES (6090, 202, 673.25);
+INSERT INTO sales VALUES (6091, 350, 679.75);
+INSERT INTO sales VALUES (6092, 498, 686.25);
+INSERT INTO sales VALUES (6093, 646, 692.75);
+INSERT INTO sales VALUES (6094, 794, 699.25);
+INSERT INTO sales VALUES (6095, 942, 705.75);
+INSERT INTO sales VALUES (6096, 1090, 712.25);
+INSERT INTO sales VALUES (6097, 1238, 718.75);
+INSERT INTO sales VALUES (6098, 1386, 725.25);
+INSERT INTO sales VALUES (6099, 1534, 731.75);
+INSERT INTO sales VALUES (6100, 1682, 738.25);
+INSERT INTO sales VALUES (6101, 1830, 744.75);
+INSERT INTO sales VALUES (6102, 1978, 751.25);
+INSERT INTO sales VALUES (6103, 2126, 757.75);
+INSERT INTO sales VALUES (6104, 2274, 764.25);
+INSERT INTO sales VALUES (6105, 2422, 770.75);
+INSERT INTO sales VALUES (6106, 2570, 777.25);
+INSERT INTO sales VALUES (6107, 2718, 783.75);
+INSERT INTO sales VALUES (6108, 2866, 790.25);
+INSERT INTO sales VALUES (6109, 3014, 796.75);
+INSERT INTO sales VALUES (6110, 3162, 803.25);
+INSERT INTO sales VALUES (6111, 3310, 809.75);
+INSERT INTO sales VALUES (6112, 3458, 816.25);
+INSERT INTO sales VALUES (6113, 3606, 822.75);
+INSERT INTO sales VALUES (6114, 3754, 829.25);
+INSERT INTO sales VALUES (6115, 3902, 835.75);
+INSERT INTO sales VALUES (6116, 4050, 842.25);
+INSERT INTO sales VALUES (6117, 4198, 848.75);
+INSERT INTO sales VALUES (6118, 4346, 855.25);
+INSERT INTO sales VALUES (6119, 4494, 861.75);
+INSERT INTO sales VALUES (6120, 4642, 868.25);
+INSERT INTO sales VALUES (6121, 4790, 874.75);
+INSERT INTO sales VALUES (6122, 4938, 881.25);
+INSERT INTO sales VALUES (6123, 5086, 887.75);
+INSERT INTO sales VALUES (6124, 5234, 894.25);
+INSERT INTO sales VALUES (6125, 5382, 900.75);
+INSERT INTO sales VALUES (6126, 5530, 907.25);
+INSERT INTO sales VALUES (6127, 5678, 913.75);
+INSERT INTO sales VALUES (6128, 5826, 920.25);
+INSERT INTO sales VALUES (6129, 5974, 926.75);
+INSERT INTO sales VALUES (6130, 6122, 933.25);
+INSERT INTO sales VALUES (6131, 6270, 939.75);
+INSERT INTO sales VALUES (6132, 6418, 946.25);
+INSERT INTO sales VALUES (6133, 6566, 952.75);
+INSERT INTO sales VALUES (6134, 6714, 959.25);
+INSERT INTO sales VALUES (6135, 6862, 965.75);
+INSERT INTO sales VALUES (6136, 7010, 972.25);
+INSERT INTO sales VALUES (6137, 7158, 978.75);
+INSERT INTO sales VALUES (6138, 7306, 985.25);
+INSERT INTO sales VALUES (6139, 7454, 991.75);
+INSERT INTO sales VALUES (6140, 7602, 998.25);
+INSERT INTO sales VALUES (6141, 7750, 1004.75);
+INSERT INTO sales VALUES (6142, 7898, 1011.25);
+INSERT INTO sales VALUES (6143, 8046, 1017.75);
+INSERT INTO sales VALUES (6144, 3, 0.375);
+INSERT INTO sales VALUES (6145, 151, 6.875);
+INSERT INTO sales VALUES (6146, 299, 13.375);
+INSERT INTO sales VALUES (6147, 447, 19.875);
+INSERT INTO sales VALUES (6148, 595, 26.375);
+INSERT INTO sales VALUES (6149, 743, 32.875);
+INSERT INTO sales VALUES (6150, 891, 39.375);
+INSERT INTO sales VALUES (6151, 1039, 45.875);
+INSERT INTO sales VALUES (6152, 1187, 52.375);
+INSERT INTO sales VALUES (6153, 1335, 58.875);
+INSERT INTO sales VALUES (6154, 1483, 65.375);
+INSERT INTO sales VALUES (6155, 1631, 71.875);
+INSERT INTO sales VALUES (6156, 1779, 78.375);
+INSERT INTO sales VALUES (6157, 1927, 84.875);
+INSERT INTO sales VALUES (6158, 2075, 91.375);
+INSERT INTO sales VALUES (6159, 2223, 97.875);
+INSERT INTO sales VALUES (6160, 2371, 104.375);
+INSERT INTO sales VALUES (6161, 2519, 110.875);
+INSERT INTO sales VALUES (6162, 2667, 117.375);
+INSERT INTO sales VALUES (6163, 2815, 123.875);
+INSERT INTO sales VALUES (6164, 2963, 130.375);
+INSERT INTO sales VALUES (6165, 3111, 136.875);
+INSERT INTO sales VALUES (6166, 3259, 143.375);
+INSERT INTO sales VALUES (6167, 3407, 149.875);
+INSERT INTO sales VALUES (6168, 3555, 156.375);
+INSERT INTO sales VALUES (6169, 3703, 162.875);
+INSERT INTO sales VALUES (6170, 3851, 169.375);
+INSERT INTO sales VALUES (6171, 3999, 175.875);
+INSERT INTO sales VALUES (6172, 4147, 182.375);
+INSERT INTO sales VALUES (6173, 4295, 188.875);
+INSERT INTO sales VALUES (6174, 4443, 195.375);
+INSERT INTO sales VALUES (6175, 4591, 201.875);
+INSERT INTO sales VALUES (6176, 4739, 208.375);
+INSERT INTO sales VALUES (6177, 4887, 214.875);
+INSERT INTO sales VALUES (6178, 5035, 221.375);
+INSERT INTO sales VALUES (6179, 5183, 227.875);
+INSERT INTO sales VALUES (6180, 5331, 234.375);
+INSERT INTO sales VALUES (6181, 5479, 240.875);
+INSERT INTO sales VALUES (6182, 5627, 247.375);
+INSERT INTO sales VALUES (6183, 5775, 253.875);
+INSERT INTO sales VALUES (6184, 5923, 260.375);
+INSERT INTO sales VALUES (6185, 6071, 266.875);
+INSERT INTO sales VALUES (6186, 6219, 273.375);
+INSERT INTO sales VALUES (6187, 6367, 279.875);
+INSERT INTO sales VALUES (6188, 6515, 286.375);
+INSERT INTO sales VALUES (6189, 6663, 292.875);
+INSERT INTO sales VALUES (6190, 6811, 299.375);
+INSERT INTO sales VALUES (6191, 6959, 305.875);
+INSERT INTO sales VALUES (6192, 7107, 312.375);
+INSERT INTO sales VALUES (6193, 7255, 318.875);
+INSERT INTO sales VALUES (6194, 7403, 325.375);
+INSERT INTO sales VALUES (6195, 7551, 331.875);
+INSERT INTO sales VALUES (6196, 7699, 338.375);
+INSERT INTO sales VALUES (6197, 7847, 344.875);
+INSERT INTO sales VALUES (6198, 7995, 351.375);
+INSERT INTO sales VALUES (6199, 8143, 357.875);
+INSERT INTO sales VALUES (6200, 99, 364.375);
+INSERT INTO sales VALUES (6201, 247, 370.875);
+INSERT INTO sales VALUES (6202, 395, 377.375);
+INSERT INTO sales VALUES (6203, 543, 383.875);
+INSERT INTO sales VALUES (6204, 691, 390.375);
+INSERT INTO sales VALUES (6205, 839, 396.875);
+INSERT INTO sales VALUES (6206, 987, 403.375);
+INSERT INTO sales VALUES (6207, 1135, 409.875);
+INSERT INTO sales VALUES (6208, 1283, 416.375);
+INSERT INTO sales VALUES (6209, 1431, 422.875);
+INSERT INTO sales VALUES (6210, 1579, 429.375);
+INSERT INTO sales VALUES (6211, 1727, 435.875);
+INSERT INTO sales VALUES (6212, 1875, 442.375);
+INSERT INTO sales VALUES (6213, 2023, 448.875);
+INSERT INTO sales VALUES (6214, 2171, 455.375);
+INSERT INTO sales VALUES (6215, 2319, 461.875);
+INSERT INTO sales VALUES (6216, 2467, 468.375);
+INSERT INTO sales VALUES (6217, 2615, 474.875);
+INSERT INTO sales VALUES (6218, 2763, 481.375);
+INSERT INTO sales VALUES (6219, 2911, 487.875);
+INSERT INTO sales VALUES (6220, 3059, 494.375);
+INSERT INTO sales VALUES (6221, 3207, 500.875);
+INSERT INTO sales VALUES (6222, 3355, 507.375);
+INSERT INTO sales VALUES (6223, 3503, 513.875);
+INSERT INTO sales VALUES (6224, 3651, 520.375);
+INSERT INTO sales VALUES (6225, 3799, 526.875);
+INSERT INTO sales VALUES (6226, 3947, 533.375);
+INSERT INTO sales VALUES (6227, 4095, 539.875);
+INSERT INTO sales VALUES (6228, 4243, 546.375);
+INSERT INTO sales VALUES (6229, 4391, 552.875);
+INSERT INTO sales VALUES (6230, 4539, 559.375);
+INSERT INTO sales VALUES (6231, 4687, 565.875);
+INSERT INTO sales VALUES (6232, 4835, 572.375);
+INSERT INTO sales VALUES (6233, 4983, 578.875);
+INSERT INTO sales VALUES (6234, 5131, 585.375);
+INSERT INTO sales VALUES (6235, 5279, 591.875);
+INSERT INTO sales VALUES (6236, 5427, 598.375);
+INSERT INTO sales VALUES (6237, 5575, 604.875);
+INSERT INTO sales VALUES (6238, 5723, 611.375);
+INSERT INTO sales VALUES (6239, 5871, 617.875);
+INSERT INTO sales VALUES (6240, 6019, 624.375);
+INSERT INTO sales VALUES (6241, 6167, 630.875);
+INSERT INTO sales VALUES (6242, 6315, 637.375);
+INSERT INTO sales VALUES (6243, 6463, 643.875);
+INSERT INTO sales VALUES (6244, 6611, 650.375);
+INSERT INTO sales VALUES (6245, 6759, 656.875);
+INSERT INTO sales VALUES (6246, 6907, 663.375);
+INSERT INTO sales VALUES (6247, 7055, 669.875);
+INSERT INTO sales VALUES (6248, 7203, 676.375);
+INSERT INTO sales VALUES (6249, 7351, 682.875);
+INSERT INTO sales VALUES (6250, 7499, 689.375);
+INSERT INTO sales VALUES (6251, 7647, 695.875);
+INSERT INTO sales VALUES (6252, 7795, 702.375);
+INSERT INTO sales VALUES (6253, 7943, 708.875);
+INSERT INTO sales VALUES (6254, 8091, 715.375);
+INSERT INTO sales VALUES (6255, 47, 721.875);
+INSERT INTO sales VALUES (6256, 195, 728.375);
+INSERT INTO sales VALUES (6257, 343, 734.875);
+INSERT INTO sales VALUES (6258, 491, 741.375);
+INSERT INTO sales VALUES (6259, 639, 747.875);
+INSERT INTO sales VALUES (6260, 787, 754.375);
+INSERT INTO sales VALUES (6261, 935, 760.875);
+INSERT INTO sales VALUES (6262, 1083, 767.375);
+INSERT INTO sales VALUES (6263, 1231, 773.875);
+INSERT INTO sales VALUES (6264, 1379, 780.375);
+INSERT INTO sales VALUES (6265, 1527, 786.875);
+INSERT INTO sales VALUES (6266, 1675, 793.375);
+INSERT INTO sales VALUES (6267, 1823, 799.875);
+INSERT INTO sales VALUES (6268, 1971, 806.375);
+INSERT INTO sales VALUES (6269, 2119, 812.875);
+INSERT INTO sales VALUES (6270, 2267, 819.375);
+INSERT INTO sales VALUES (6271, 2415, 825.875);
+INSERT INTO sales VALUES (6272, 2563, 832.375);
+INSERT INTO sales VALUES (6273, 2711, 838.875);
+INSERT INTO sales VALUES (6274, 2859, 845.375);
+INSERT INTO sales VALUES (6275, 3007, 851.875);
+INSERT INTO sales VALUES (6276, 3155, 858.375);
+INSERT INTO sales VALUES (6277, 3303, 864.875);
+INSERT INTO sales VALUES (6278, 3451, 871.375);
+INSERT INTO sales VALUES (6279, 3599, 877.875);
+INSERT INTO sales VALUES (6280, 3747, 884.375);
+INSERT INTO sales VALUES (6281, 3895, 890.875);
+INSERT INTO sales VALUES (6282, 4043, 897.375);
+INSERT INTO sales VALUES (6283, 4191, 903.875);
+INSERT INTO sales VALUES (6284, 4339, 910.375);
+INSERT INTO sales VALUES (6285, 4487, 916.875);
+INSERT INTO sales VALUES (6286, 4635, 923.375);
+INSERT INTO sales VALUES (6287, 4783, 929.875);
+INSERT INTO sales VALUES (6288, 4931, 936.375);
+INSERT INTO sales VALUES (6289, 5079, 942.875);
+INSERT INTO sales VALUES (6290, 5227, 949.375);
+INSERT INTO sales VALUES (6291, 5375, 955.875);
+INSERT INTO sales VALUES (6292, 5523, 962.375);
+INSERT INTO sales VALUES (6293, 5671, 968.875);
+INSERT INTO sales VALUES (6294, 5819, 975.375);
+INSERT INTO sales VALUES (6295, 5967, 981.875);
+INSERT INTO sales VALUES (6296, 6115, 988.375);
+INSERT INTO sales VALUES (6297, 6263, 994.875);
+INSERT INTO sales VALUES (6298, 6411, 1001.375);
+INSERT INTO sales VALUES (6299, 6559, 1007.875);
+INSERT INTO sales VALUES (6300, 6707, 1014.375);
+INSERT INTO sales VALUES (6301, 6855, 1020.875);
+INSERT INTO sales VALUES (6302, 7003, 3.375);
+INSERT INTO sales VALUES (6303, 7151, 9.875);
+INSERT INTO sales VALUES (6304, 7299, 16.375);
+INSERT INTO sales VALUES (6305, 7447, 22.875);
+INSERT INTO sales VALUES (6306, 7595, 29.375);
+INSERT INTO sales VALUES (6307, 7743, 35.875);
+INSERT INTO sales VALUES (6308, 7891, 42.375);
+INSERT INTO sales VALUES (6309, 8039, 48.875);
+INSERT INTO sales VALUES (6310, 8187, 55.375);
+INSERT INTO sales VALUES (6311, 143, 61.875);
+INSERT INTO sales VALUES (6312, 291, 68.375);
+INSERT INTO sales VALUES (6313, 439, 74.875);
+INSERT INTO sales VALUES (6314, 587, 81.375);
+INSERT INTO sales VALUES (6315, 735, 87.875);
+INSERT INTO sales VALUES (6316, 883, 94.375);
+INSERT INTO sales VALUES (6317, 1031, 100.875);
+INSERT INTO sales VALUES (6318, 1179, 107.375);
+INSERT INTO sales VALUES (6319, 1327, 113.875);
+INSERT INTO sales VALUES (6320, 1475, 120.375);
+INSERT INTO sales VALUES (6321, 1623, 126.875);
+INSERT INTO sales VALUES (6322, 1771, 133.375);
+INSERT INTO sales VALUES (6323, 1919, 139.875);
+INSERT INTO sales VALUES (6324, 2067, 146.375);
+INSERT INTO sales VALUES (6325, 2215, 152.875);
+INSERT INTO sales VALUES (6326, 2363, 159.375);
+INSERT INTO sales VALUES (6327, 2511, 165.875);
+INSERT INTO sales VALUES (6328, 2659, 172.375);
+INSERT INTO sales VALUES (6329, 2807, 178.875);
+INSERT INTO sales VALUES (6330, 2955, 185.375);
+INSERT INTO sales VALUES (6331, 3103, 191.875);
+INSERT INTO sales VALUES (6332, 3251, 198.375);
+INSERT INTO sales VALUES (6333, 3399, 204.875);
+INSERT INTO sales VALUES (6334, 3547, 211.375);
+INSERT INTO sales VALUES (6335, 3695, 217.875);
+INSERT INTO sales VALUES (6336, 3843, 224.375);
+INSERT INTO sales VALUES (6337, 3991, 230.875);
+INSERT INTO sales VALUES (6338, 4139, 237.375);
+INSERT INTO sales VALUES (6339, 4287, 243.875);
+INSERT INTO sales VALUES (6340, 4435, 250.375);
+INSERT INTO sales VALUES (6341, 4583, 256.875);
+INSERT INTO sales VALUES (6342, 4731, 263.375);
+INSERT INTO sales VALUES (6343, 4879, 269.875);
+INSERT INTO sales VALUES (6344, 5027, 276.375);
+INSERT INTO sales VALUES (6345, 5175, 282.875);
+INSERT INTO sales VALUES (6346, 5323, 289.375);
+INSERT INTO sales VALUES (6347, 5471, 295.875);
+INSERT INTO sales VALUES (6348, 5619, 302.375);
+INSERT INTO sales VALUES (6349, 5767, 308.875);
+INSERT INTO sales VALUES (6350, 5915, 315.375);
+INSERT INTO sales VALUES (6351, 6063, 321.875);
+INSERT INTO sales VALUES (6352, 6211, 328.375);
+INSERT INTO sales VALUES (6353, 6359, 334.875);
+INSERT INTO sales VALUES (6354, 6507, 341.375);
+INSERT INTO sales VALUES (6355, 6655, 347.875);
+INSERT INTO sales VALUES (6356, 6803, 354.375);
+INSERT INTO sales VALUES (6357, 6951, 360.875);
+INSERT INTO sales VALUES (6358, 7099, 367.375);
+INSERT INTO sales VALUES (6359, 7247, 373.875);
+INSERT INTO sales VALUES (6360, 7395, 380.375);
+INSERT INTO sales VALUES (6361, 7543, 386.875);
+INSERT INTO sales VALUES (6362, 7691, 393.375);
+INSERT INTO sales VALUES (6363, 7839, 399.875);
+INSERT INTO sales VALUES (6364, 7987, 406.375);
+INSERT INTO sales VALUES (6365, 8135, 412.875);
+INSERT INTO sales VALUES (6366, 91, 419.375);
+INSERT INTO sales VALUES (6367, 239, 425.875);
+INSERT INTO sales VALUES (6368, 387, 432.375);
+INSERT INTO sales VALUES (6369, 535, 438.875);
+INSERT INTO sales VALUES (6370, 683, 445.375);
+INSERT INTO sales VALUES (6371, 831, 451.875);
+INSERT INTO sales VALUES (6372, 979, 458.375);
+INSERT INTO sales VALUES (6373, 1127, 464.875);
+INSERT INTO sales VALUES (6374, 1275, 471.375);
+INSERT INTO sales VALUES (6375, 1423, 477.875);
+INSERT INTO sales VALUES (6376, 1571, 484.375);
+INSERT INTO sales VALUES (6377, 1719, 490.875);
+INSERT INTO sales VALUES (6378, 1867, 497.375);
+INSERT INTO sales VALUES (6379, 2015, 503.875);
+INSERT INTO sales VALUES (6380, 2163, 510.375);
+INSERT INTO sales VALUES (6381, 2311, 516.875);
+INSERT INTO sales VALUES (6382, 2459, 523.375);
+INSERT INTO sales VALUES (6383, 2607, 529.875);
+INSERT INTO sales VALUES (6384, 2755, 536.375);
+INSERT INTO sales VALUES (6385, 2903, 542.875);
+INSERT INTO sales VALUES (6386, 3051, 549.375);
+INSERT INTO sales VALUES (6387, 3199, 555.875);
+INSERT INTO sales VALUES (6388, 3347, 562.375);
+INSERT INTO sales VALUES (6389, 3495, 568.875);
+INSERT INTO sales VALUES (6390, 3643, 575.375);
+INSERT INTO sales VALUES (6391, 3791, 581.875);
+INSERT INTO sales VALUES (6392, 3939, 588.375);
+INSERT INTO sales VALUES (6393, 4087, 594.875);
+INSERT INTO sales VALUES (6394, 4235, 601.375);
+INSERT INTO sales VALUES (6395, 4383, 607.875);
+INSERT INTO sales VALUES (6396, 4531, 614.375);
+INSERT INTO sales VALUES (6397, 4679, 620.875);
+INSERT INTO sales VALUES (6398, 4827, 627.375);
+INSERT INTO sales VALUES (6399, 4975, 633.875);
+INSERT INTO sales VALUES (6400, 5123, 640.375);
+INSERT INTO sales VALUES (6401, 5271, 646.875);
+INSERT INTO sales VALUES (6402, 5419, 653.375);
+INSERT INTO sales VALUES (6403, 5567, 659.875);
+INSERT INTO sales VALUES (6404, 5715, 666.375);
+INSERT INTO sales VALUES (6405, 5863, 672.875);
+INSERT INTO sales VALUES (6406, 6011, 679.375);
+INSERT INTO sales VALUES (6407, 6159, 685.875);
+INSERT INTO sales VALUES (6408, 6307, 692.375);
+INSERT INTO sales VALUES (6409, 6455, 698.875);
+INSERT INTO sales VALUES (6410, 6603, 705.375);
+INSERT INTO sales VALUES (6411, 6751, 711.875);
+INSERT INTO sales VALUES (6412, 6899, 718.375);
+INSERT INTO sales VALUES (6413, 7047, 724.875);
+INSERT INTO sales VALUES (6414, 7195, 731.375);
+INSERT INTO sales VALUES (6415, 7343, 737.875);
+INSERT INTO sales VALUES (6416, 7491, 744.375);
+INSERT INTO sales VALUES (6417, 7639, 750.875);
+INSERT INTO sales VALUES (6418, 7787, 757.375);
+INSERT INTO sales VALUES (6419, 7935, 763.875);
+INSERT INTO sales VALUES (6420, 8083, 770.375);
+INSERT INTO sales VALUES (6421, 39, 776.875);
+INSERT INTO sales VALUES (6422, 187, 783.375);
+INSERT INTO sales VALUES (6423, 335, 789.875);
+INSERT INTO sales VALUES (6424, 483, 796.375);
+INSERT INTO sales VALUES (6425, 631, 802.875);
+INSERT INTO sales VALUES (6426, 779, 809.375);
+INSERT INTO sales VALUES (6427, 927, 815.875);
+INSERT INTO sales VALUES (6428, 1075, 822.375);
+INSERT INTO sales VALUES (6429, 1223, 828.875);
+INSERT INTO sales VALUES (6430, 1371, 835.375);
+INSERT INTO sales VALUES (6431, 1519, 841.875);
+INSERT INTO sales VALUES (6432, 1667, 848.375);
+INSERT INTO sales VALUES (6433, 1815, 854.875);
+INSERT INTO sales VALUES (6434, 1963, 861.375);
+INSERT INTO sales VALUES (6435, 2111, 867.875);
+INSERT INTO sales VALUES (6436, 2259, 874.375);
+INSERT INTO sales VALUES (6437, 2407, 880.875);
+INSERT INTO sales VALUES (6438, 2555, 887.375);
+INSERT INTO sales VALUES (6439, 2703, 893.875);
+INSERT INTO sales VALUES (6440, 2851, 900.375);
+INSERT INTO sales VALUES (6441, 2999, 906.875);
+INSERT INTO sales VALUES (6442, 3147, 913.375);
+INSERT INTO sales VALUES (6443, 3295, 919.875);
+INSERT INTO sales VALUES (6444, 3443, 926.375);
+INSERT INTO sales VALUES (6445, 3591, 932.875);
+INSERT INTO sales VALUES (6446, 3739, 939.375);
+INSERT INTO sales VALUES (6447, 3887, 945.875);
+INSERT INTO sales VALUES (6448, 4035, 952.375);
+INSERT INTO sales VALUES (6449, 4183, 958.875);
+INSERT INTO sales VALUES (6450, 4331, 965.375);
+INSERT INTO sales VALUES (6451, 4479, 971.875);
+INSERT INTO sales VALUES (6452, 4627, 978.375);
+INSERT INTO sales VALUES (6453, 4775, 984.875);
+INSERT INTO sales VALUES (6454, 4923, 991.375);
+INSERT INTO sales VALUES (6455, 5071, 997.875);
+INSERT INTO sales VALUES (6456, 5219, 1004.375);
+INSERT INTO sales VALUES (6457, 5367, 1010.875);
+INSERT INTO sales VALUES (6458, 5515, 1017.375);
+INSERT INTO sales VALUES (6459, 5663, 1023.875);
+INSERT INTO sales VALUES (6460, 5811, 6.375);
+INSERT INTO sales VALUES (6461, 5959, 12.875);
+INSERT INTO sales VALUES (6462, 6107, 19.375);
+INSERT INTO sales VALUES (6463, 6255, 25.875);
+INSERT INTO sales VALUES (6464, 6403, 32.375);
+INSERT INTO sales VALUES (6465, 6551, 38.875);
+INSERT INTO sales VALUES (6466, 6699, 45.375);
+INSERT INTO sales VALUES (6467, 6847, 51.875);
+INSERT INTO sales VALUES (6468, 6995, 58.375);
+INSERT INTO sales VALUES (6469, 7143, 64.875);
+INSERT INTO sales VALUES (6470, 7291, 71.375);
+INSERT INTO sales VALUES (6471, 7439, 77.875);
+INSERT INTO sales VALUES (6472, 7587, 84.375);
+INSERT INTO sales VALUES (6473, 7735, 90.875);
+INSERT INTO sales VALUES (6474, 7883, 97.375);
+INSERT INTO sales VALUES (6475, 8031, 103.875);
+INSERT INTO sales VALUES (6476, 8179, 110.375);
+INSERT INTO sales VALUES (6477, 135, 116.875);
+INSERT INTO sales VALUES (6478, 283, 123.375);
+INSERT INTO sales VALUES (6479, 431, 129.875);
+INSERT INTO sales VALUES (6480, 579, 136.375);
+INSERT INTO sales VALUES (6481, 727, 142.875);
+INSERT INTO sales VALUES (6482, 875, 149.375);
+INSERT INTO sales VALUES (6483, 1023, 155.875);
+INSERT INTO sales VALUES (6484, 1171, 162.375);
+INSERT INTO sales VALUES (6485, 1319, 168.875);
+INSERT INTO sales VALUES (6486, 1467, 175.375);
+INSERT INTO sales VALUES (6487, 1615, 181.875);
+INSERT INTO sales VALUES (6488, 1763, 188.375);
+INSERT INTO sales VALUES (6489, 1911, 194.875);
+INSERT INTO sales VALUES (6490, 2059, 201.375);
+INSERT INTO sales VALUES (6491, 2207, 207.875);
+INSERT INTO sales VALUES (6492, 2355, 214.375);
+INSERT INTO sales VALUES (6493, 2503, 220.875);
+INSERT INTO sales VALUES (6494, 2651, 227.375);
+INSERT INTO sales VALUES (6495, 2799, 233.875);
+INSERT INTO sales VALUES (6496, 2947, 240.375);
+INSERT INTO sales VALUES (6497, 3095, 246.875);
+INSERT INTO sales VALUES (6498, 3243, 253.375);
+INSERT INTO sales VALUES (6499, 3391, 259.875);
+INSERT INTO sales VALUES (6500, 3539, 266.375);
+INSERT INTO sales VALUES (6501, 3687, 272.875);
+INSERT INTO sales VALUES (6502, 3835, 279.375);
+INSERT INTO sales VALUES (6503, 3983, 285.875);
+INSERT INTO sales VALUES (6504, 4131, 292.375);
+INSERT INTO sales VALUES (6505, 4279, 298.875);
+INSERT INTO sales VALUES (6506, 4427, 305.375);
+INSERT INTO sales VALUES (6507, 4575, 311.875);
+INSERT INTO sales VALUES (6508, 4723, 318.375);
+INSERT INTO sales VALUES (6509, 4871, 324.875);
+INSERT INTO sales VALUES (6510, 5019, 331.375);
+INSERT INTO sales VALUES (6511, 5167, 337.875);
+INSERT INTO sales VALUES (6512, 5315, 344.375);
+INSERT INTO sales VALUES (6513, 5463, 350.875);
+INSERT INTO sales VALUES (6514, 5611, 357.375);
+INSERT INTO sales VALUES (6515, 5759, 363.875);
+INSERT INTO sales VALUES (6516, 5907, 370.375);
+INSERT INTO sales VALUES (6517, 6055, 376.875);
+INSERT INTO sales VALUES (6518, 6203, 383.375);
+INSERT INTO sales VALUES (6519, 6351, 389.875);
+INSERT INTO sales VALUES (6520, 6499, 396.375);
+INSERT INTO sales VALUES (6521, 6647, 402.875);
+INSERT INTO sales VALUES (6522, 6795, 409.375);
+INSERT INTO sales VALUES (6523, 6943, 415.875);
+INSERT INTO sales VALUES (6524, 7091, 422.375);
+INSERT INTO sales VALUES (6525, 7239, 428.875);
+INSERT INTO sales VALUES (6526, 7387, 435.375);
+INSERT INTO sales VALUES (6527, 7535, 441.875);
+INSERT INTO sales VALUES (6528, 7683, 448.375);
+INSERT INTO sales VALUES (6529, 7831, 454.875);
+INSERT INTO sales VALUES (6530, 7979, 461.375);
+INSERT INTO sales VALUES (6531, 8127, 467.875);
+INSERT INTO sales VALUES (6532, 83, 474.375);
+INSERT INTO sales VALUES (6533, 231, 480.875);
+INSERT INTO sales VALUES (6534, 379, 487.375);
+INSERT INTO sales VALUES (6535, 527, 493.875);
+INSERT INTO sales VALUES (6536, 675, 500.375);
+INSERT INTO sales VALUES (6537, 823, 506.875);
+INSERT INTO sales VALUES (6538, 971, 513.375);
+INSERT INTO sales VALUES (6539, 1119, 519.875);
+INSERT INTO sales VALUES (6540, 1267, 526.375);
+INSERT INTO sales VALUES (6541, 1415, 532.875);
+INSERT INTO sales VALUES (6542, 1563, 539.375);
+INSERT INTO sales VALUES (6543, 1711, 545.875);
+INSERT INTO sales VALUES (6544, 1859, 552.375);
+INSERT INTO sales VALUES (6545, 2007, 558.875);
+INSERT INTO sales VALUES (6546, 2155, 565.375);
+INSERT INTO sales VALUES (6547, 2303, 571.875);
+INSERT INTO sales VALUES (6548, 2451, 578.375);
+INSERT INTO sales VALUES (6549, 2599, 584.875);
+INSERT INTO sales VALUES (6550, 2747, 591.375);
+INSERT INTO sales VALUES (6551, 2895, 597.875);
+INSERT INTO sales VALUES (6552, 3043, 604.375);
+INSERT INTO sales VALUES (6553, 3191, 610.875);
+INSERT INTO sales VALUES (6554, 3339, 617.375);
+INSERT INTO sales VALUES (6555, 3487, 623.875);
+INSERT INTO sales VALUES (6556, 3635, 630.375);
+INSERT INTO sales VALUES (6557, 3783, 636.875);
+INSERT INTO sales VALUES (6558, 3931, 643.375);
+INSERT INTO sales VALUES (6559, 4079, 649.875);
+INSERT INTO sales VALUES (6560, 4227, 656.375);
+INSERT INTO sales VALUES (6561, 4375, 662.875);
+INSERT INTO sales VALUES (6562, 4523, 669.375);
+INSERT INTO sales VALUES (6563, 4671, 675.875);
+INSERT INTO sales VALUES (6564, 4819, 682.375);
+INSERT INTO sales VALUES (6565, 4967, 688.875);
+INSERT INTO sales VALUES (6566, 5115, 695.375);
+INSERT INTO sales VALUES (6567, 5263, 701.875);
+INSERT INTO sales VALUES (6568, 5411, 708.375);
+INSERT INTO sales VALUES (6569, 5559, 714.875);
+INSERT INTO sales VALUES (6570, 5707, 721.375);
+INSERT INTO sales VALUES (6571, 5855, 727.875);
+INSERT INTO sales VALUES (6572, 6003, 734.375);
+INSERT INTO sales VALUES (6573, 6151, 740.875);
+INSERT INTO sales VALUES (6574, 6299, 747.375);
+INSERT INTO sales VALUES (6575, 6447, 753.875);
+INSERT INTO sales VALUES (6576, 6595, 760.375);
+INSERT INTO sales VALUES (6577, 6743, 766.875);
+INSERT INTO sales VALUES (6578, 6891, 773.375);
+INSERT INTO sales VALUES (6579, 7039, 779.875);
+INSERT INTO sales VALUES (6580, 7187, 786.375);
+INSERT INTO sales VALUES (6581, 7335, 792.875);
+INSERT INTO sales VALUES (6582, 7483, 799.375);
+INSERT INTO sales VALUES (6583, 7631, 805.875);
+INSERT INTO sales VALUES (6584, 7779, 812.375);
+INSERT INTO sales VALUES (6585, 7927, 818.875);
+INSERT INTO sales VALUES (6586, 8075, 825.375);
+INSERT INTO sales VALUES (6587, 31, 831.875);
+INSERT INTO sales VALUES (6588, 179, 838.375);
+INSERT INTO sales VALUES (6589, 327, 844.875);
+INSERT INTO sales VALUES (6590, 475, 851.375);
+INSERT INTO sales VALUES (6591, 623, 857.875);
+INSERT INTO sales VALUES (6592, 771, 864.375);
+INSERT INTO sales VALUES (6593, 919, 870.875);
+INSERT INTO sales VALUES (6594, 1067, 877.375);
+INSERT INTO sales VALUES (6595, 1215, 883.875);
+INSERT INTO sales VALUES (6596, 1363, 890.375);
+INSERT INTO sales VALUES (6597, 1511, 896.875);
+INSERT INTO sales VALUES (6598, 1659, 903.375);
+INSERT INTO sales VALUES (6599, 1807, 909.875);
+INSERT INTO sales VALUES (6600, 1955, 916.375);
+INSERT INTO sales VALUES (6601, 2103, 922.875);
+INSERT INTO sales VALUES (6602, 2251, 929.375);
+INSERT INTO sales VALUES (6603, 2399, 935.875);
+INSERT INTO sales VALUES (6604, 2547, 942.375);
+INSERT INTO sales VALUES (6605, 2695, 948.875);
+INSERT INTO sales VALUES (6606, 2843, 955.375);
+INSERT INTO sales VALUES (6607, 2991, 961.875);
+INSERT INTO sales VALUES (6608, 3139, 968.375);
+INSERT INTO sales VALUES (6609, 3287, 974.875);
+INSERT INTO sales VALUES (6610, 3435, 981.375);
+INSERT INTO sales VALUES (6611, 3583, 987.875);
+INSERT INTO sales VALUES (6612, 3731, 994.375);
+INSERT INTO sales VALUES (6613, 3879, 1000.875);
+INSERT INTO sales VALUES (6614, 4027, 1007.375);
+INSERT INTO sales VALUES (6615, 4175, 1013.875);
+INSERT INTO sales VALUES (6616, 4323, 1020.375);
+INSERT INTO sales VALUES (6617, 4471, 2.875);
+INSERT INTO sales VALUES (6618, 4619, 9.375);
+INSERT INTO sales VALUES (6619, 4767, 15.875);
+INSERT INTO sales VALUES (6620, 4915, 22.375);
+INSERT INTO sales VALUES (6621, 5063, 28.875);
+INSERT INTO sales VALUES (6622, 5211, 35.375);
+INSERT INTO sales VALUES (6623, 5359, 41.875);
+INSERT INTO sales VALUES (6624, 5507, 48.375);
+INSERT INTO sales VALUES (6625, 5655, 54.875);
+INSERT INTO sales VALUES (6626, 5803, 61.375);
+INSERT INTO sales VALUES (6627, 5951, 67.875);
+INSERT INTO sales VALUES (6628, 6099, 74.375);
+INSERT INTO sales VALUES (6629, 6247, 80.875);
+INSERT INTO sales VALUES (6630, 6395, 87.375);
+INSERT INTO sales VALUES (6631, 6543, 93.875);
+INSERT INTO sales VALUES (6632, 6691, 100.375);
+INSERT INTO sales VALUES (6633, 6839, 106.875);
+INSERT INTO sales VALUES (6634, 6987, 113.375);
+INSERT INTO sales VALUES (6635, 7135, 119.875);
+INSERT INTO sales VALUES (6636, 7283, 126.375);
+INSERT INTO sales VALUES (6637, 7431, 132.875);
+INSERT INTO sales VALUES (6638, 7579, 139.375);
+INSERT INTO sales VALUES (6639, 7727, 145.875);
+INSERT INTO sales VALUES (6640, 7875, 152.375);
+INSERT INTO sales VALUES (6641, 8023, 158.875);
+INSERT INTO sales VALUES (6642, 8171, 165.375);
+INSERT INTO sales VALUES (6643, 127, 171.875);
+INSERT INTO sales VALUES (6644, 275, 178.375);
+INSERT INTO sales VALUES (6645, 423, 184.875);
+INSERT INTO sales VALUES (6646, 571, 191.375);
+INSERT INTO sales VALUES (6647, 719, 197.875);
+INSERT INTO sales VALUES (6648, 867, 204.375);
+INSERT INTO sales VALUES (6649, 1015, 210.875);
+INSERT INTO sales VALUES (6650, 1163, 217.375);
+INSERT INTO sales VALUES (6651, 1311, 223.875);
+INSERT INTO sales VALUES (6652, 1459, 230.375);
+INSERT INTO sales VALUES (6653, 1607, 236.875);
+INSERT INTO sales VALUES (6654, 1755, 243.375);
+INSERT INTO sales VALUES (6655, 1903, 249.875);
+INSERT INTO sales VALUES (6656, 2051, 256.375);
+INSERT INTO sales VALUES (6657, 2199, 262.875);
+INSERT INTO sales VALUES (6658, 2347, 269.375);
+INSERT INTO sales VALUES (6659, 2495, 275.875);
+INSERT INTO sales VALUES (6660, 2643, 282.375);
+INSERT INTO sales VALUES (6661, 2791, 288.875);
+INSERT INTO sales VALUES (6662, 2939, 295.375);
+INSERT INTO sales VALUES (6663, 3087, 301.875);
+INSERT INTO sales VALUES (6664, 3235, 308.375);
+INSERT INTO sales VALUES (6665, 3383, 314.875);
+INSERT INTO sales VALUES (6666, 3531, 321.375);
+INSERT INTO sales VALUES (6667, 3679, 327.875);
+INSERT INTO sales VALUES (6668, 3827, 334.375);
+INSERT INTO sales VALUES (6669, 3975, 340.875);
+INSERT INTO sales VALUES (6670, 4123, 347.375);
+INSERT INTO sales VALUES (6671, 4271, 353.875);
+INSERT INTO sales VALUES (6672, 4419, 360.375);
+INSERT INTO sales VALUES (6673, 4567, 366.875);
+INSERT INTO sales VALUES (6674, 4715, 373.375);
+INSERT INTO sales VALUES (6675, 4863, 379.875);
+INSERT INTO sales VALUES (6676, 5011, 386.375);
+INSERT INTO sales VALUES (6677, 5159, 392.875);
+INSERT INTO sales VALUES (6678, 5307, 399.375);
+INSERT INTO sales VALUES (6679, 5455, 405.875);
+INSERT INTO sales VALUES (6680, 5603, 412.375);
+INSERT INTO sales VALUES (6681, 5751, 418.875);
+INSERT INTO sales VALUES (6682, 5899, 425.375);
+INSERT INTO sales VALUES (6683, 6047, 431.875);
+INSERT INTO sales VALUES (6684, 6195, 438.375);
+INSERT INTO sales VALUES (6685, 6343, 444.875);
+INSERT INTO sales VALUES (6686, 6491, 451.375);
+INSERT INTO sales VALUES (6687, 6639, 457.875);
+INSERT INTO sales VALUES (6688, 6787, 464.375);
+INSERT INTO sales VALUES (6689, 6935, 470.875);
+INSERT INTO sales VALUES (6690, 7083, 477.375);
+INSERT INTO sales VALUES (6691, 7231, 483.875);
+INSERT INTO sales VALUES (6692, 7379, 490.375);
+INSERT INTO sales VALUES (6693, 7527, 496.875);
+INSERT INTO sales VALUES (6694, 7675, 503.375);
+INSERT INTO sales VALUES (6695, 7823, 509.875);
+INSERT INTO sales VALUES (6696, 7971, 516.375);
+INSERT INTO sales VALUES (6697, 8119, 522.875);
+INSERT INTO sales VALUES (6698, 75, 529.375);
+INSERT INTO sales VALUES (6699, 223, 535.875);
+INSERT INTO sales VALUES (6700, 371, 542.375);
+INSERT INTO sales VALUES (6701, 519, 548.875);
+INSERT INTO sales VALUES (6702, 667, 555.375);
+INSERT INTO sales VALUES (6703, 815, 561.875);
+INSERT INTO sales VALUES (6704, 963, 568.375);
+INSERT INTO sales VALUES (6705, 1111, 574.875);
+INSERT INTO sales VALUES (6706, 1259, 581.375);
+INSERT INTO sales VALUES (6707, 1407, 587.875);
+INSERT INTO sales VALUES (6708, 1555, 594.375);
+INSERT INTO sales VALUES (6709, 1703, 600.875);
+INSERT INTO sales VALUES (6710, 1851, 607.375);
+INSERT INTO sales VALUES (6711, 1999, 613.875);
+INSERT INTO sales VALUES (6712, 2147, 620.375);
+INSERT INTO sales VALUES (6713, 2295, 626.875);
+INSERT INTO sales VALUES (6714, 2443, 633.375);
+INSERT INTO sales VALUES (6715, 2591, 639.875);
+INSERT INTO sales VALUES (6716, 2739, 646.375);
+INSERT INTO sales VALUES (6717, 2887, 652.875);
+INSERT INTO sales VALUES (6718, 3035, 659.375);
+INSERT INTO sales VALUES (6719, 3183, 665.875);
+INSERT INTO sales VALUES (6720, 3331, 672.375);
+INSERT INTO sales VALUES (6721, 3479, 678.875);
+INSERT INTO sales VALUES (6722, 3627, 685.375);
+INSERT INTO sales VALUES (6723, 3775, 691.875);
+INSERT INTO sales VALUES (6724, 3923, 698.375);
+INSERT INTO sales VALUES (6725, 4071, 704.875);
+INSERT INTO sales VALUES (6726, 4219, 711.375);
+INSERT INTO sales VALUES (6727, 4367, 717.875);
+INSERT INTO sales VALUES (6728, 4515, 724.375);
+INSERT INTO sales VALUES (6729, 4663, 730.875);
+INSERT INTO sales VALUES (6730, 4811, 737.375);
+INSERT INTO sales VALUES (6731, 4959, 743.875);
+INSERT INTO sales VALUES (6732, 5107, 750.375);
+INSERT INTO sales VALUES (6733, 5255, 756.875);
+INSERT INTO sales VALUES (6734, 5403, 763.375);
+INSERT INTO sales VALUES (6735, 5551, 769.875);
+INSERT INTO sales VALUES (6736, 5699, 776.375);
+INSERT INTO sales VALUES (6737, 5847, 782.875);
+INSERT INTO sales VALUES (6738, 5995, 789.375);
+INSERT INTO sales VALUES (6739, 6143, 795.875);
+INSERT INTO sales VALUES (6740, 6291, 802.375);
+INSERT INTO sales VALUES (6741, 6439, 808.875);
+INSERT INTO sales VALUES (6742, 6587, 815.375);
+INSERT INTO sales VALUES (6743, 6735, 821.875);
+INSERT INTO sales VALUES (6744, 6883, 828.375);
+INSERT INTO sales VALUES (6745, 7031, 834.875);
+INSERT INTO sales VALUES (6746, 7179, 841.375);
+INSERT INTO sales VALUES (6747, 7327, 847.875);
+INSERT INTO sales VALUES (6748, 7475, 854.375);
+INSERT INTO sales VALUES (6749, 7623, 860.875);
+INSERT INTO sales VALUES (6750, 7771, 867.375);
+INSERT INTO sales VALUES (6751, 7919, 873.875);
+INSERT INTO sales VALUES (6752, 8067, 880.375);
+INSERT INTO sales VALUES (6753, 23, 886.875);
+INSERT INTO sales VALUES (6754, 171, 893.375);
+INSERT INTO sales VALUES (6755, 319, 899.875);
+INSERT INTO sales VALUES (6756, 467, 906.375);
+INSERT INTO sales VALUES (6757, 615, 912.875);
+INSERT INTO sales VALUES (6758, 763, 919.375);
+INSERT INTO sales VALUES (6759, 911, 925.875);
+INSERT INTO sales VALUES (6760, 1059, 932.375);
+INSERT INTO sales VALUES (6761, 1207, 938.875);
+INSERT INTO sales VALUES (6762, 1355, 945.375);
+INSERT INTO sales VALUES (6763, 1503, 951.875);
+INSERT INTO sales VALUES (6764, 1651, 958.375);
+INSERT INTO sales VALUES (6765, 1799, 964.875);
+INSERT INTO sales VALUES (6766, 1947, 971.375);
+INSERT INTO sales VALUES (6767, 2095, 977.875);
+INSERT INTO sales VALUES (6768, 2243, 984.375);
+INSERT INTO sales VALUES (6769, 2391, 990.875);
+INSERT INTO sales VALUES (6770, 2539, 997.375);
+INSERT INTO sales VALUES (6771, 2687, 1003.875);
+INSERT INTO sales VALUES (6772, 2835, 1010.375);
+INSERT INTO sales VALUES (6773, 2983, 1016.875);
+INSERT INTO sales VALUES (6774, 3131, 1023.375);
+INSERT INTO sales VALUES (6775, 3279, 5.875);
+INSERT INTO sales VALUES (6776, 3427, 12.375);
+INSERT INTO sales VALUES (6777, 3575, 18.875);
+INSERT INTO sales VALUES (6778, 3723, 25.375);
+INSERT INTO sales VALUES (6779, 3871, 31.875);
+INSERT INTO sales VALUES (6780, 4019, 38.375);
+INSERT INTO sales VALUES (6781, 4167, 44.875);
+INSERT INTO sales VALUES (6782, 4315, 51.375);
+INSERT INTO sales VALUES (6783, 4463, 57.875);
+INSERT INTO sales VALUES (6784, 4611, 64.375);
+INSERT INTO sales VALUES (6785, 4759, 70.875);
+INSERT INTO sales VALUES (6786, 4907, 77.375);
+INSERT INTO sales VALUES (6787, 5055, 83.875);
+INSERT INTO sales VALUES (6788, 5203, 90.375);
+INSERT INTO sales VALUES (6789, 5351, 96.875);
+INSERT INTO sales VALUES (6790, 5499, 103.375);
+INSERT INTO sales VALUES (6791, 5647, 109.875);
+INSERT INTO sales VALUES (6792, 5795, 116.375);
+INSERT INTO sales VALUES (6793, 5943, 122.875);
+INSERT INTO sales VALUES (6794, 6091, 129.375);
+INSERT INTO sales VALUES (6795, 6239, 135.875);
+INSERT INTO sales VALUES (6796, 6387, 142.375);
+INSERT INTO sales VALUES (6797, 6535, 148.875);
+INSERT INTO sales VALUES (6798, 6683, 155.375);
+INSERT INTO sales VALUES (6799, 6831, 161.875);
+INSERT INTO sales VALUES (6800, 6979, 168.375);
+INSERT INTO sales VALUES (6801, 7127, 174.875);
+INSERT INTO sales VALUES (6802, 7275, 181.375);
+INSERT INTO sales VALUES (6803, 7423, 187.875);
+INSERT INTO sales VALUES (6804, 7571, 194.375);
+INSERT INTO sales VALUES (6805, 7719, 200.875);
+INSERT INTO sales VALUES (6806, 7867, 207.375);
+INSERT INTO sales VALUES (6807, 8015, 213.875);
+INSERT INTO sales VALUES (6808, 8163, 220.375);
+INSERT INTO sales VALUES (6809, 119, 226.875);
+INSERT INTO sales VALUES (6810, 267, 233.375);
+INSERT INTO sales VALUES (6811, 415, 239.875);
+INSERT INTO sales VALUES (6812, 563, 246.375);
+INSERT INTO sales VALUES (6813, 711, 252.875);
+INSERT INTO sales VALUES (6814, 859, 259.375);
+INSERT INTO sales VALUES (6815, 1007, 265.875);
+INSERT INTO sales VALUES (6816, 1155, 272.375);
+INSERT INTO sales VALUES (6817, 1303, 278.875);
+INSERT INTO sales VALUES (6818, 1451, 285.375);
+INSERT INTO sales VALUES (6819, 1599, 291.875);
+INSERT INTO sales VALUES (6820, 1747, 298.375);
+INSERT INTO sales VALUES (6821, 1895, 304.875);
+INSERT INTO sales VALUES (6822, 2043, 311.375);
+INSERT INTO sales VALUES (6823, 2191, 317.875);
+INSERT INTO sales VALUES (6824, 2339, 324.375);
+INSERT INTO sales VALUES (6825, 2487, 330.875);
+INSERT INTO sales VALUES (6826, 2635, 337.375);
+INSERT INTO sales VALUES (6827, 2783, 343.875);
+INSERT INTO sales VALUES (6828, 2931, 350.375);
+INSERT INTO sales VALUES (6829, 3079, 356.875);
+INSERT INTO sales VALUES (6830, 3227, 363.375);
+INSERT INTO sales VALUES (6831, 3375, 369.875);
+INSERT INTO sales VALUES (6832, 3523, 376.375);
+INSERT INTO sales VALUES (6833, 3671, 382.875);
+INSERT INTO sales VALUES (6834, 3819, 389.375);
+INSERT INTO sales VALUES (6835, 3967, 395.875);
+INSERT INTO sales VALUES (6836, 4115, 402.375);
+INSERT INTO sales VALUES (6837, 4263, 408.875);
+INSERT INTO sales VALUES (6838, 4411, 415.375);
+INSERT INTO sales VALUES (6839, 4559, 421.875);
+INSERT INTO sales VALUES (6840, 4707, 428.375);
+INSERT INTO sales VALUES (6841, 4855, 434.875);
+INSERT INTO sales VALUES (6842, 5003, 441.375);
+INSERT INTO sales VALUES (6843, 5151, 447.875);
+INSERT INTO sales VALUES (6844, 5299, 454.375);
+INSERT INTO sales VALUES (6845, 5447, 460.875);
+INSERT INTO sales VALUES (6846, 5595, 467.375);
+INSERT INTO sales VALUES (6847, 5743, 473.875);
+INSERT INTO sales VALUES (6848, 5891, 480.375);
+INSERT INTO sales VALUES (6849, 6039, 486.875);
+INSERT INTO sales VALUES (6850, 6187, 493.375);
+INSERT INTO sales VALUES (6851, 6335, 499.875);
+INSERT INTO sales VALUES (6852, 6483, 506.375);
+INSERT INTO sales VALUES (6853, 6631, 512.875);
+INSERT INTO sales VALUES (6854, 6779, 519.375);
+INSERT INTO sales VALUES (6855, 6927, 525.875);
+INSERT INTO sales VALUES (6856, 7075, 532.375);
+INSERT INTO sales VALUES (6857, 7223, 538.875);
+INSERT INTO sales VALUES (6858, 7371, 545.375);
+INSERT INTO sales VALUES (6859, 7519, 551.875);
+INSERT INTO sales VALUES (6860, 7667, 558.375);
+INSERT INTO sales VALUES (6861, 7815, 564.875);
+INSERT INTO sales VALUES (6862, 7963, 571.375);
+INSERT INTO sales VALUES (6863, 8111, 577.875);
+INSERT INTO sales VALUES (6864, 67, 584.375);
+INSERT INTO sales VALUES (6865, 215, 590.875);
+INSERT INTO sales VALUES (6866, 363, 597.375);
+INSERT INTO sales VALUES (6867, 511, 603.875);
+INSERT INTO sales VALUES (6868, 659, 610.375);
+INSERT INTO sales VALUES (6869, 807, 616.875);
+INSERT INTO sales VALUES (6870, 955, 623.375);
+INSERT INTO sales VALUES (6871, 1103, 629.875);
+INSERT INTO sales VALUES (6872, 1251, 636.375);
+INSERT INTO sales VALUES (6873, 1399, 642.875);
+INSERT INTO sales VALUES (6874, 1547, 649.375);
+INSERT INTO sales VALUES (6875, 1695, 655.875);
+INSERT INTO sales VALUES (6876, 1843, 662.375);
+INSERT INTO sales VALUES (6877, 1991, 668.875);
+INSERT INTO sales VALUES (6878, 2139, 675.375);
+INSERT INTO sales VALUES (6879, 2287, 681.875);
+INSERT INTO sales VALUES (6880, 2435, 688.375);
+INSERT INTO sales VALUES (6881, 2583, 694.875);
+INSERT INTO sales VALUES (6882, 2731, 701.375);
+INSERT INTO sales VALUES (6883, 2879, 707.875);
+INSERT INTO sales VALUES (6884, 3027, 714.375);
+INSERT INTO sales VALUES (6885, 3175, 720.875);
+INSERT INTO sales VALUES (6886, 3323, 727.375);
+INSERT INTO sales VALUES (6887, 3471, 733.875);
+INSERT INTO sales VALUES (6888, 3619, 740.375);
+INSERT INTO sales VALUES (6889, 3767, 746.875);
+INSERT INTO sales VALUES (6890, 3915, 753.375);
+INSERT INTO sales VALUES (6891, 4063, 759.875);
+INSERT INTO sales VALUES (6892, 4211, 766.375);
+INSERT INTO sales VALUES (6893, 4359, 772.875);
+INSERT INTO sales VALUES (6894, 4507, 779.375);
+INSERT INTO sales VALUES (6895, 4655, 785.875);
+INSERT INTO sales VALUES (6896, 4803, 792.375);
+INSERT INTO sales VALUES (6897, 4951, 798.875);
+INSERT INTO sales VALUES (6898, 5099, 805.375);
+INSERT INTO sales VALUES (6899, 5247, 811.875);
+INSERT INTO sales VALUES (6900, 5395, 818.375);
+INSERT INTO sales VALUES (6901, 5543, 824.875);
+INSERT INTO sales VALUES (6902, 5691, 831.375);
+INSERT INTO sales VALUES (6903, 5839, 837.875);
+INSERT INTO sales VALUES (6904, 5987, 844.375);
+INSERT INTO sales VALUES (6905, 6135, 850.875);
+INSERT INTO sales VALUES (6906, 6283, 857.375);
+INSERT INTO sales VALUES (6907, 6431, 863.875);
+INSERT INTO sales VALUES (6908, 6579, 870.375);
+INSERT INTO sales VALUES (6909, 6727, 876.875);
+INSERT INTO sales VALUES (6910, 6875, 883.375);
+INSERT INTO sales VALUES (6911, 7023, 889.875);
+INSERT INTO sales VALUES (6912, 7171, 896.375);
+INSERT INTO sales VALUES (6913, 7319, 902.875);
+INSERT INTO sales VALUES (6914, 7467, 909.375);
+INSERT INTO sales VALUES (6915, 7615, 915.875);
+INSERT INTO sales VALUES (6916, 7763, 922.375);
+INSERT INTO sales VALUES (6917, 7911, 928.875);
+INSERT INTO sales VALUES (6918, 8059, 935.375);
+INSERT INTO sales VALUES (6919, 15, 941.875);
+INSERT INTO sales VALUES (6920, 163, 948.375);
+INSERT INTO sales VALUES (6921, 311, 954.875);
+INSERT INTO sales VALUES (6922, 459, 961.375);
+INSERT INTO sales VALUES (6923, 607, 967.875);
+INSERT INTO sales VALUES (6924, 755, 974.375);
+INSERT INTO sales VALUES (6925, 903, 980.875);
+INSERT INTO sales VALUES (6926, 1051, 987.375);
+INSERT INTO sales VALUES (6927, 1199, 993.875);
+INSERT INTO sales VALUES (6928, 1347, 1000.375);
+INSERT INTO sales VALUES (6929, 1495, 1006.875);
+INSERT INTO sales VALUES (6930, 1643, 1013.375);
+INSERT INTO sales VALUES (6931, 1791, 1019.875);
+INSERT INTO sales VALUES (6932, 1939, 2.375);
+INSERT INTO sales VALUES (6933, 2087, 8.875);
+INSERT INTO sales VALUES (6934, 2235, 15.375);
+INSERT INTO sales VALUES (6935, 2383, 21.875);
+INSERT INTO sales VALUES (6936, 2531, 28.375);
+INSERT INTO sales VALUES (6937, 2679, 34.875);
+INSERT INTO sales VALUES (6938, 2827, 41.375);
+INSERT INTO sales VALUES (6939, 2975, 47.875);
+INSERT INTO sales VALUES (6940, 3123, 54.375);
+INSERT INTO sales VALUES (6941, 3271, 60.875);
+INSERT INTO sales VALUES (6942, 3419, 67.375);
+INSERT INTO sales VALUES (6943, 3567, 73.875);
+INSERT INTO sales VALUES (6944, 3715, 80.375);
+INSERT INTO sales VALUES (6945, 3863, 86.875);
+INSERT INTO sales VALUES (6946, 4011, 93.375);
+INSERT INTO sales VALUES (6947, 4159, 99.875);
+INSERT INTO sales VALUES (6948, 4307, 106.375);
+INSERT INTO sales VALUES (6949, 4455, 112.875);
+INSERT INTO sales VALUES (6950, 4603, 119.375);
+INSERT INTO sales VALUES (6951, 4751, 125.875);
+INSERT INTO sales VALUES (6952, 4899, 132.375);
+INSERT INTO sales VALUES (6953, 5047, 138.875);
+INSERT INTO sales VALUES (6954, 5195, 145.375);
+INSERT INTO sales VALUES (6955, 5343, 151.875);
+INSERT INTO sales VALUES (6956, 5491, 158.375);
+INSERT INTO sales VALUES (6957, 5639, 164.875);
+INSERT INTO sales VALUES (6958, 5787, 171.375);
+INSERT INTO sales VALUES (6959, 5935, 177.875);
+INSERT INTO sales VALUES (6960, 6083, 184.375);
+INSERT INTO sales VALUES (6961, 6231, 190.875);
+INSERT INTO sales VALUES (6962, 6379, 197.375);
+INSERT INTO sales VALUES (6963, 6527, 203.875);
+INSERT INTO sales VALUES (6964, 6675, 210.375);
+INSERT INTO sales VALUES (6965, 6823, 216.875);
+INSERT INTO sales VALUES (6966, 6971, 223.375);
+INSERT INTO sales VALUES (6967, 7119, 229.875);
+INSERT INTO sales VALUES (6968, 7267, 236.375);
+INSERT INTO sales VALUES (6969, 7415, 242.875);
+INSERT INTO sales VALUES (6970, 7563, 249.375);
+INSERT INTO sales VALUES (6971, 7711, 255.875);
+INSERT INTO sales VALUES (6972, 7859, 262.375);
+INSERT INTO sales VALUES (6973, 8007, 268.875);
+INSERT INTO sales VALUES (6974, 8155, 275.375);
+INSERT INTO sales VALUES (6975, 111, 281.875);
+INSERT INTO sales VALUES (6976, 259, 288.375);
+INSERT INTO sales VALUES (6977, 407, 294.875);
+INSERT INTO sales VALUES (6978, 555, 301.375);
+INSERT INTO sales VALUES (6979, 703, 307.875);
+INSERT INTO sales VALUES (6980, 851, 314.375);
+INSERT INTO sales VALUES (6981, 999, 320.875);
+INSERT INTO sales VALUES (6982, 1147, 327.375);
+INSERT INTO sales VALUES (6983, 1295, 333.875);
+INSERT INTO sales VALUES (6984, 1443, 340.375);
+INSERT INTO sales VALUES (6985, 1591, 346.875);
+INSERT INTO sales VALUES (6986, 1739, 353.375);
+INSERT INTO sales VALUES (6987, 1887, 359.875);
+INSERT INTO sales VALUES (6988, 2035, 366.375);
+INSERT INTO sales VALUES (6989, 2183, 372.875);
+INSERT INTO sales VALUES (6990, 2331, 379.375);
+INSERT INTO sales VALUES (6991, 2479, 385.875);
+INSERT INTO sales VALUES (6992, 2627, 392.375);
+INSERT INTO sales VALUES (6993, 2775, 398.875);
+INSERT INTO sales VALUES (6994, 2923, 405.375);
+INSERT INTO sales VALUES (6995, 3071, 411.875);
+INSERT INTO sales VALUES (6996, 3219, 418.375);
+INSERT INTO sales VALUES (6997, 3367, 424.875);
+INSERT INTO sales VALUES (6998, 3515, 431.375);
+INSERT INTO sales VALUES (6999, 3663, 437.875);
+INSERT INTO sales VALUES (7000, 3811, 444.375);
+INSERT INTO sales VALUES (7001, 3959, 450.875);
+INSERT INTO sales VALUES (7002, 4107, 457.375);
+INSERT INTO sales VALUES (7003, 4255, 463.875);
+INSERT INTO sales VALUES (7004, 4403, 470.375);
+INSERT INTO sales VALUES (7005, 4551, 476.875);
+INSERT INTO sales VALUES (7006, 4699, 483.375);
+INSERT INTO sales VALUES (7007, 4847, 489.875);
+INSERT INTO sales VALUES (7008, 4995, 496.375);
+INSERT INTO sales VALUES (7009, 5143, 502.875);
+INSERT INTO sales VALUES (7010, 5291, 509.375);
+INSERT INTO sales VALUES (7011, 5439, 515.875);
+INSERT INTO sales VALUES (7012, 5587, 522.375);
+INSERT INTO sales VALUES (7013, 5735, 528.875);
+INSERT INTO sales VALUES (7014, 5883, 535.375);
+INSERT INTO sales VALUES (7015, 6031, 541.875);
+INSERT INTO sales VALUES (7016, 6179, 548.375);
+INSERT INTO sales VALUES (7017, 6327, 554.875);
+INSERT INTO sales VALUES (7018, 6475, 561.375);
+INSERT INTO sales VALUES (7019, 6623, 567.875);
+INSERT INTO sales VALUES (7020, 6771, 574.375);
+INSERT INTO sales VALUES (7021, 6919, 580.875);
+INSERT INTO sales VALUES (7022, 7067, 587.375);
+INSERT INTO sales VALUES (7023, 7215, 593.875);
+INSERT INTO sales VALUES (7024, 7363, 600.375);
+INSERT INTO sales VALUES (7025, 7511, 606.875);
+INSERT INTO sales VALUES (7026, 7659, 613.375);
+INSERT INTO sales VALUES (7027, 7807, 619.875);
+INSERT INTO sales VALUES (7028, 7955, 626.375);
+INSERT INTO sales VALUES (7029, 8103, 632.875);
+INSERT INTO sales VALUES (7030, 59, 639.375);
+INSERT INTO sales VALUES (7031, 207, 645.875);
+INSERT INTO sales VALUES (7032, 355, 652.375);
+INSERT INTO sales VALUES (7033, 503, 658.875);
+INSERT INTO sales VALUES (7034, 651, 665.375);
+INSERT INTO sales VALUES (7035, 799, 671.875);
+INSERT INTO sales VALUES (7036, 947, 678.375);
+INSERT INTO sales VALUES (7037, 1095, 684.875);
+INSERT INTO sales VALUES (7038, 1243, 691.375);
+INSERT INTO sales VALUES (7039, 1391, 697.875);
+INSERT INTO sales VALUES (7040, 1539, 704.375);
+INSERT INTO sales VALUES (7041, 1687, 710.875);
+INSERT INTO sales VALUES (7042, 1835, 717.375);
+INSERT INTO sales VALUES (7043, 1983, 723.875);
+INSERT INTO sales VALUES (7044, 2131, 730.375);
+INSERT INTO sales VALUES (7045, 2279, 736.875);
+INSERT INTO sales VALUES (7046, 2427, 743.375);
+INSERT INTO sales VALUES (7047, 2575, 749.875);
+INSERT INTO sales VALUES (7048, 2723, 756.375);
+INSERT INTO sales VALUES (7049, 2871, 762.875);
+INSERT INTO sales VALUES (7050, 3019, 769.375);
+INSERT INTO sales VALUES (7051, 3167, 775.875);
+INSERT INTO sales VALUES (7052, 3315, 782.375);
+INSERT INTO sales VALUES (7053, 3463, 788.875);
+INSERT INTO sales VALUES (7054, 3611, 795.375);
+INSERT INTO sales VALUES (7055, 3759, 801.875);
+INSERT INTO sales VALUES (7056, 3907, 808.375);
+INSERT INTO sales VALUES (7057, 4055, 814.875);
+INSERT INTO sales VALUES (7058, 4203, 821.375);
+INSERT INTO sales VALUES (7059, 4351, 827.875);
+INSERT INTO sales VALUES (7060, 4499, 834.375);
+INSERT INTO sales VALUES (7061, 4647, 840.875);
+INSERT INTO sales VALUES (7062, 4795, 847.375);
+INSERT INTO sales VALUES (7063, 4943, 853.875);
+INSERT INTO sales VALUES (7064, 5091, 860.375);
+INSERT INTO sales VALUES (7065, 5239, 866.875);
+INSERT INTO sales VALUES (7066, 5387, 873.375);
+INSERT INTO sales VALUES (7067, 5535, 879.875);
+INSERT INTO sales VALUES (7068, 5683, 886.375);
+INSERT INTO sales VALUES (7069, 5831, 892.875);
+INSERT INTO sales VALUES (7070, 5979, 899.375);
+INSERT INTO sales VALUES (7071, 6127, 905.875);
+INSERT INTO sales VALUES (7072, 6275, 912.375);
+INSERT INTO sales VALUES (7073, 6423, 918.875);
+INSERT INTO sales VALUES (7074, 6571, 925.375);
+INSERT INTO sales VALUES (7075, 6719, 931.875);
+INSERT INTO sales VALUES (7076, 6867, 938.375);
+INSERT INTO sales VALUES (7077, 7015, 944.875);
+INSERT INTO sales VALUES (7078, 7163, 951.375);
+INSERT INTO sales VALUES (7079, 7311, 957.875);
+INSERT INTO sales VALUES (7080, 7459, 964.375);
+INSERT INTO sales VALUES (7081, 7607, 970.875);
+INSERT INTO sales VALUES (7082, 7755, 977.375);
+INSERT INTO sales VALUES (7083, 7903, 983.875);
+INSERT INTO sales VALUES (7084, 8051, 990.375);
+INSERT INTO sales VALUES (7085, 7, 996.875);
+INSERT INTO sales VALUES (7086, 155, 1003.375);
+INSERT INTO sales VALUES (7087, 303, 1009.875);
+INSERT INTO sales VALUES (7088, 451, 1016.375);
+INSERT INTO sales VALUES (7089, 599, 1022.875);
+INSERT INTO sales VALUES (7090, 747, 5.375);
+INSERT INTO sales VALUES (7091, 895, 11.875);
+INSERT INTO sales VALUES (7092, 1043, 18.375);
+INSERT INTO sales VALUES (7093, 1191, 24.875);
+INSERT INTO sales VALUES (7094, 1339, 31.375);
+INSERT INTO sales VALUES (7095, 1487, 37.875);
+INSERT INTO sales VALUES (7096, 1635, 44.375);
+INSERT INTO sales VALUES (7097, 1783, 50.875);
+INSERT INTO sales VALUES (7098, 1931, 57.375);
+INSERT INTO sales VALUES (7099, 2079, 63.875);
+INSERT INTO sales VALUES (7100, 2227, 70.375);
+INSERT INTO sales VALUES (7101, 2375, 76.875);
+INSERT INTO sales VALUES (7102, 2523, 83.375);
+INSERT INTO sales VALUES (7103, 2671, 89.875);
+INSERT INTO sales VALUES (7104, 2819, 96.375);
+INSERT INTO sales VALUES (7105, 2967, 102.875);
+INSERT INTO sales VALUES (7106, 3115, 109.375);
+INSERT INTO sales VALUES (7107, 3263, 115.875);
+INSERT INTO sales VALUES (7108, 3411, 122.375);
+INSERT INTO sales VALUES (7109, 3559, 128.875);
+INSERT INTO sales VALUES (7110, 3707, 135.375);
+INSERT INTO sales VALUES (7111, 3855, 141.875);
+INSERT INTO sales VALUES (7112, 4003, 148.375);
+INSERT INTO sales VALUES (7113, 4151, 154.875);
+INSERT INTO sales VALUES (7114, 4299, 161.375);
+INSERT INTO sales VALUES (7115, 4447, 167.875);
+INSERT INTO sales VALUES (7116, 4595, 174.375);
+INSERT INTO sales VALUES (7117, 4743, 180.875);
+INSERT INTO sales VALUES (7118, 4891, 187.375);
+INSERT INTO sales VALUES (7119, 5039, 193.875);
+INSERT INTO sales VALUES (7120, 5187, 200.375);
+INSERT INTO sales VALUES (7121, 5335, 206.875);
+INSERT INTO sales VALUES (7122, 5483, 213.375);
+INSERT INTO sales VALUES (7123, 5631, 219.875);
+INSERT INTO sales VALUES (7124, 5779, 226.375);
+INSERT INTO sales VALUES (7125, 5927, 232.875);
+INSERT INTO sales VALUES (7126, 6075, 239.375);
+INSERT INTO sales VALUES (7127, 6223, 245.875);
+INSERT INTO sales VALUES (7128, 6371, 252.375);
+INSERT INTO sales VALUES (7129, 6519, 258.875);
+INSERT INTO sales VALUES (7130, 6667, 265.375);
+INSERT INTO sales VALUES (7131, 6815, 271.875);
+INSERT INTO sales VALUES (7132, 6963, 278.375);
+INSERT INTO sales VALUES (7133, 7111, 284.875);
+INSERT INTO sales VALUES (7134, 7259, 291.375);
+INSERT INTO sales VALUES (7135, 7407, 297.875);
+INSERT INTO sales VALUES (7136, 7555, 304.375);
+INSERT INTO sales VALUES (7137, 7703, 310.875);
+INSERT INTO sales VALUES (7138, 7851, 317.375);
+INSERT INTO sales VALUES (7139, 7999, 323.875);
+INSERT INTO sales VALUES (7140, 8147, 330.375);
+INSERT INTO sales VALUES (7141, 103, 336.875);
+INSERT INTO sales VALUES (7142, 251, 343.375);
+INSERT INTO sales VALUES (7143, 399, 349.875);
+INSERT INTO sales VALUES (7144, 547, 356.375);
+INSERT INTO sales VALUES (7145, 695, 362.875);
+INSERT INTO sales VALUES (7146, 843, 369.375);
+INSERT INTO sales VALUES (7147, 991, 375.875);
+INSERT INTO sales VALUES (7148, 1139, 382.375);
+INSERT INTO sales VALUES (7149, 1287, 388.875);
+INSERT INTO sales VALUES (7150, 1435, 395.375);
+INSERT INTO sales VALUES (7151, 1583, 401.875);
+INSERT INTO sales VALUES (7152, 1731, 408.375);
+INSERT INTO sales VALUES (7153, 1879, 414.875);
+INSERT INTO sales VALUES (7154, 2027, 421.375);
+INSERT INTO sales VALUES (7155, 2175, 427.875);
+INSERT INTO sales VALUES (7156, 2323, 434.375);
+INSERT INTO sales VALUES (7157, 2471, 440.875);
+INSERT INTO sales VALUES (7158, 2619, 447.375);
+INSERT INTO sales VALUES (7159, 2767, 453.875);
+INSERT INTO sales VALUES (7160, 2915, 460.375);
+INSERT INTO sales VALUES (7161, 3063, 466.875);
+INSERT INTO sales VALUES (7162, 3211, 473.375);
+INSERT INTO sales VALUES (7163, 3359, 479.875);
+INSERT INTO sales VALUES (7164, 3507, 486.375);
+INSERT INTO sales VALUES (7165, 3655, 492.875);
+INSERT INTO sales VALUES (7166, 3803, 499.375);
+INSERT INTO sales VALUES (7167, 3951, 505.875);
+INSERT INTO sales VALUES (7168, 4099, 512.375);
+INSERT INTO sales VALUES (7169, 4247, 518.875);
+INSERT INTO sales VALUES (7170, 4395, 525.375);
+INSERT INTO sales VALUES (7171, 4543, 531.875);
+INSERT INTO sales VALUES (7172, 4691, 538.375);
+INSERT INTO sales VALUES (7173, 4839, 544.875);
+INSERT INTO sales VALUES (7174, 4987, 551.375);
+INSERT INTO sales VALUES (7175, 5135, 557.875);
+INSERT INTO sales VALUES (7176, 5283, 564.375);
+INSERT INTO sales VALUES (7177, 5431, 570.875);
+INSERT INTO sales VALUES (7178, 5579, 577.375);
+INSERT INTO sales VALUES (7179, 5727, 583.875);
+INSERT INTO sales VALUES (7180, 5875, 590.375);
+INSERT INTO sales VALUES (7181, 6023, 596.875);
+INSERT INTO sales VALUES (7182, 6171, 603.375);
+INSERT INTO sales VALUES (7183, 6319, 609.875);
+INSERT INTO sales VALUES (7184, 6467, 616.375);
+INSERT INTO sales VALUES (7185, 6615, 622.875);
+INSERT INTO sales VALUES (7186, 6763, 629.375);
+INSERT INTO sales VALUES (7187, 6911, 635.875);
+INSERT INTO sales VALUES (7188, 7059, 642.375);
+INSERT INTO sales VALUES (7189, 7207, 648.875);
+INSERT INTO sales VALUES (7190, 7355, 655.375);
+INSERT INTO sales VALUES (7191, 7503, 661.875);
+INSERT INTO sales VALUES (7192, 7651, 668.375);
+INSERT INTO sales VALUES (7193, 7799, 674.875);
+INSERT INTO sales VALUES (7194, 7947, 681.375);
+INSERT INTO sales VALUES (7195, 8095, 687.875);
+INSERT INTO sales VALUES (7196, 51, 694.375);
+INSERT INTO sales VALUES (7197, 199, 700.875);
+INSERT INTO sales VALUES (7198, 347, 707.375);
+INSERT INTO sales VALUES (7199, 495, 713.875);
+INSERT INTO sales VALUES (7200, 643, 720.375);
+INSERT INTO sales VALUES (7201, 791, 726.875);
+INSERT INTO sales VALUES (7202, 939, 733.375);
+INSERT INTO sales VALUES (7203, 1087, 739.875);
+INSERT INTO sales VALUES (7204, 1235, 746.375);
+INSERT INTO sales VALUES (7205, 1383, 752.875);
+INSERT INTO sales VALUES (7206, 1531, 759.375);
+INSERT INTO sales VALUES (7207, 1679, 765.875);
+INSERT INTO sales VALUES (7208, 1827, 772.375);
+INSERT INTO sales VALUES (7209, 1975, 778.875);
+INSERT INTO sales VALUES (7210, 2123, 785.375);
+INSERT INTO sales VALUES (7211, 2271, 791.875);
+INSERT INTO sales VALUES (7212, 2419, 798.375);
+INSERT INTO sales VALUES (7213, 2567, 804.875);
+INSERT INTO sales VALUES (7214, 2715, 811.375);
+INSERT INTO sales VALUES (7215, 2863, 817.875);
+INSERT INTO sales VALUES (7216, 3011, 824.375);
+INSERT INTO sales VALUES (7217, 3159, 830.875);
+INSERT INTO sales VALUES (7218, 3307, 837.375);
+INSERT INTO sales VALUES (7219, 3455, 843.875);
+INSERT INTO sales VALUES (7220, 3603, 850.375);
+INSERT INTO sales VALUES (7221, 3751, 856.875);
+INSERT INTO sales VALUES (7222, 3899, 863.375);
+INSERT INTO sales VALUES (7223, 4047, 869.875);
+INSERT INTO sales VALUES (7224, 4195, 876.375);
+INSERT INTO sales VALUES (7225, 4343, 882.875);
+INSERT INTO sales VALUES (7226, 4491, 889.375);
+INSERT INTO sales VALUES (7227, 4639, 895.875);
+INSERT INTO sales VALUES (7228, 4787, 902.375);
+INSERT INTO sales VALUES (7229, 4935, 908.875);
+INSERT INTO sales VALUES (7230, 5083, 915.375);
+INSERT INTO sales VALUES (7231, 5231, 921.875);
+INSERT INTO sales VALUES (7232, 5379, 928.375);
+INSERT INTO sales VALUES (7233, 5527, 934.875);
+INSERT INTO sales VALUES (7234, 5675, 941.375);
+INSERT INTO sales VALUES (7235, 5823, 947.875);
+INSERT INTO sales VALUES (7236, 5971, 954.375);
+INSERT INTO sales VALUES (7237, 6119, 960.875);
+INSERT INTO sales VALUES (7238, 6267, 967.375);
+INSERT INTO sales VALUES (7239, 6415, 973.875);
+INSERT INTO sales VALUES (7240, 6563, 980.375);
+INSERT INTO sales VALUES (7241, 6711, 986.875);
+INSERT INTO sales VALUES (7242, 6859, 993.375);
+INSERT INTO sales VALUES (7243, 7007, 999.875);
+INSERT INTO sales VALUES (7244, 7155, 1006.375);
+INSERT INTO sales VALUES (7245, 7303, 1012.875);
+INSERT INTO sales VALUES (7246, 7451, 1019.375);
+INSERT INTO sales VALUES (7247, 7599, 1.875);
+INSERT INTO sales VALUES (7248, 7747, 8.375);
+INSERT INTO sales VALUES (7249, 7895, 14.875);
+INSERT INTO sales VALUES (7250, 8043, 21.375);
+INSERT INTO sales VALUES (7251, 8191, 27.875);
+INSERT INTO sales VALUES (7252, 147, 34.375);
+INSERT INTO sales VALUES (7253, 295, 40.875);
+INSERT INTO sales VALUES (7254, 443, 47.375);
+INSERT INTO sales VALUES (7255, 591, 53.875);
+INSERT INTO sales VALUES (7256, 739, 60.375);
+INSERT INTO sales VALUES (7257, 887, 66.875);
+INSERT INTO sales VALUES (7258, 1035, 73.375);
+INSERT INTO sales VALUES (7259, 1183, 79.875);
+INSERT INTO sales VALUES (7260, 1331, 86.375);
+INSERT INTO sales VALUES (7261, 1479, 92.875);
+INSERT INTO sales VALUES (7262, 1627, 99.375);
+INSERT INTO sales VALUES (7263, 1775, 105.875);
+INSERT INTO sales VALUES (7264, 1923, 112.375);
+INSERT INTO sales VALUES (7265, 2071, 118.875);
+INSERT INTO sales VALUES (7266, 2219, 125.375);
+INSERT INTO sales VALUES (7267, 2367, 131.875);
+INSERT INTO sales VALUES (7268, 2515, 138.375);
+INSERT INTO sales VALUES (7269, 2663, 144.875);
+INSERT INTO sales VALUES (7270, 2811, 151.375);
+INSERT INTO sales VALUES (7271, 2959, 157.875);
+INSERT INTO sales VALUES (7272, 3107, 164.375);
+INSERT INTO sales VALUES (7273, 3255, 170.875);
+INSERT INTO sales VALUES (7274, 3403, 177.375);
+INSERT INTO sales VALUES (7275, 3551, 183.875);
+INSERT INTO sales VALUES (7276, 3699, 190.375);
+INSERT INTO sales VALUES (7277, 3847, 196.875);
+INSERT INTO sales VALUES (7278, 3995, 203.375);
+INSERT INTO sales VALUES (7279, 4143, 209.875);
+INSERT INTO sales VALUES (7280, 4291, 216.375);
+INSERT INTO sales VALUES (7281, 4439, 222.875);
+INSERT INTO sales VALUES (7282, 4587, 229.375);
+INSERT INTO sales VALUES (7283, 4735, 235.875);
+INSERT INTO sales VALUES (7284, 4883, 242.375);
+INSERT INTO sales VALUES (7285, 5031, 248.875);
+INSERT INTO sales VALUES (7286, 5179, 255.375);
+INSERT INTO sales VALUES (7287, 5327, 261.875);
+INSERT INTO sales VALUES (7288, 5475, 268.375);
+INSERT INTO sales VALUES (7289, 5623, 274.875);
+INSERT INTO sales VALUES (7290, 5771, 281.375);
+INSERT INTO sales VALUES (7291, 5919, 287.875);
+INSERT INTO sales VALUES (7292, 6067, 294.375);
+INSERT INTO sales VALUES (7293, 6215, 300.875);
+INSERT INTO sales VALUES (7294, 6363, 307.375);
+INSERT INTO sales VALUES (7295, 6511, 313.875);
+INSERT INTO sales VALUES (7296, 6659, 320.375);
+INSERT INTO sales VALUES (7297, 6807, 326.875);
+INSERT INTO sales VALUES (7298, 6955, 333.375);
+INSERT INTO sales VALUES (7299, 7103, 339.875);
+INSERT INTO sales VALUES (7300, 7251, 346.375);
+INSERT INTO sales VALUES (7301, 7399, 352.875);
+INSERT INTO sales VALUES (7302, 7547, 359.375);
+INSERT INTO sales VALUES (7303, 7695, 365.875);
+INSERT INTO sales VALUES (7304, 7843, 372.375);
+INSERT INTO sales VALUES (7305, 7991, 378.875);
+INSERT INTO sales VALUES (7306, 8139, 385.375);
+INSERT INTO sales VALUES (7307, 95, 391.875);
+INSERT INTO sales VALUES (7308, 243, 398.375);
+INSERT INTO sales VALUES (7309, 391, 404.875);
+INSERT INTO sales VALUES (7310, 539, 411.375);
+INSERT INTO sales VALUES (7311, 687, 417.875);
+INSERT INTO sales VALUES (7312, 835, 424.375);
+INSERT INTO sales VALUES (7313, 983, 430.875);
+INSERT INTO sales VALUES (7314, 1131, 437.375);
+INSERT INTO sales VALUES (7315, 1279, 443.875);
+INSERT INTO sales VALUES (7316, 1427, 450.375);
+INSERT INTO sales VALUES (7317, 1575, 456.875);
+INSERT INTO sales VALUES (7318, 1723, 463.375);
+INSERT INTO sales VALUES (7319, 1871, 469.875);
+INSERT INTO sales VALUES (7320, 2019, 476.375);
+INSERT INTO sales VALUES (7321, 2167, 482.875);
+INSERT INTO sales VALUES (7322, 2315, 489.375);
+INSERT INTO sales VALUES (7323, 2463, 495.875);
+INSERT INTO sales VALUES (7324, 2611, 502.375);
+INSERT INTO sales VALUES (7325, 2759, 508.875);
+INSERT INTO sales VALUES (7326, 2907, 515.375);
+INSERT INTO sales VALUES (7327, 3055, 521.875);
+INSERT INTO sales VALUES (7328, 3203, 528.375);
+INSERT INTO sales VALUES (7329, 3351, 534.875);
+INSERT INTO sales VALUES (7330, 3499, 541.375);
+INSERT INTO sales VALUES (7331, 3647, 547.875);
+INSERT INTO sales VALUES (7332, 3795, 554.375);
+INSERT INTO sales VALUES (7333, 3943, 560.875);
+INSERT INTO sales VALUES (7334, 4091, 567.375);
+INSERT INTO sales VALUES (7335, 4239, 573.875);
+INSERT INTO sales VALUES (7336, 4387, 580.375);
+INSERT INTO sales VALUES (7337, 4535, 586.875);
+INSERT INTO sales VALUES (7338, 4683, 593.375);
+INSERT INTO sales VALUES (7339, 4831, 599.875);
+INSERT INTO sales VALUES (7340, 4979, 606.375);
+INSERT INTO sales VALUES (7341, 5127, 612.875);
+INSERT INTO sales VALUES (7342, 5275, 619.375);
+INSERT INTO sales VALUES (7343, 5423, 625.875);
+INSERT INTO sales VALUES (7344, 5571, 632.375);
+INSERT INTO sales VALUES (7345, 5719, 638.875);
+INSERT INTO sales VALUES (7346, 5867, 645.375);
+INSERT INTO sales VALUES (7347, 6015, 651.875);
+INSERT INTO sales VALUES (7348, 6163, 658.375);
+INSERT INTO sales VALUES (7349, 6311, 664.875);
+INSERT INTO sales VALUES (7350, 6459, 671.375);
+INSERT INTO sales VALUES (7351, 6607, 677.875);
+INSERT INTO sales VALUES (7352, 6755, 684.375);
+INSERT INTO sales VALUES (7353, 6903, 690.875);
+INSERT INTO sales VALUES (7354, 7051, 697.375);
+INSERT INTO sales VALUES (7355, 7199, 703.875);
+INSERT INTO sales VALUES (7356, 7347, 710.375);
+INSERT INTO sales VALUES (7357, 7495, 716.875);
+INSERT INTO sales VALUES (7358, 7643, 723.375);
+INSERT INTO sales VALUES (7359, 7791, 729.875);
+INSERT INTO sales VALUES (7360, 7939, 736.375);
+INSERT INTO sales VALUES (7361, 8087, 742.875);
+INSERT INTO sales VALUES (7362, 43, 749.375);
+INSERT INTO sales VALUES (7363, 191, 755.875);
+INSERT INTO sales VALUES (7364, 339, 762.375);
+INSERT INTO sales VALUES (7365, 487, 768.875);
+INSERT INTO sales VALUES (7366, 635, 775.375);
+INSERT INTO sales VALUES (7367, 783, 781.875);
+INSERT INTO sales VALUES (7368, 931, 788.375);
+INSERT INTO sales VALUES (7369, 1079, 794.875);
+INSERT INTO sales VALUES (7370, 1227, 801.375);
+INSERT INTO sales VALUES (7371, 1375, 807.875);
+INSERT INTO sales VALUES (7372, 1523, 814.375);
+INSERT INTO sales VALUES (7373, 1671, 820.875);
+INSERT INTO sales VALUES (7374, 1819, 827.375);
+INSERT INTO sales VALUES (7375, 1967, 833.875);
+INSERT INTO sales VALUES (7376, 2115, 840.375);
+INSERT INTO sales VALUES (7377, 2263, 846.875);
+INSERT INTO sales VALUES (7378, 2411, 853.375);
+INSERT INTO sales VALUES (7379, 2559, 859.875);
+INSERT INTO sales VALUES (7380, 2707, 866.375);
+INSERT INTO sales VALUES (7381, 2855, 872.875);
+INSERT INTO sales VALUES (7382, 3003, 879.375);
+INSERT INTO sales VALUES (7383, 3151, 885.875);
+INSERT INTO sales VALUES (7384, 3299, 892.375);
+INSERT INTO sales VALUES (7385, 3447, 898.875);
+INSERT INTO sales VALUES (7386, 3595, 905.375);
+INSERT INTO sales VALUES (7387, 3743, 911.875);
+INSERT INTO sales VALUES (7388, 3891, 918.375);
+INSERT INTO sales VALUES (7389, 4039, 924.875);
+INSERT INTO sales VALUES (7390, 4187, 931.375);
+INSERT INTO sales VALUES (7391, 4335, 937.875);
+INSERT INTO sales VALUES (7392, 4483, 944.375);
+INSERT INTO sales VALUES (7393, 4631, 950.875);
+INSERT INTO sales VALUES (7394, 4779, 957.375);
+INSERT INTO sales VALUES (7395, 4927, 963.875);
+INSERT INTO sales VALUES (7396, 5075, 970.375);
+INSERT INTO sales VALUES (7397, 5223, 976.875);
+INSERT INTO sales VALUES (7398, 5371, 983.375);
+INSERT INTO sales VALUES (7399, 5519, 989.875);
+INSERT INTO sales VALUES (7400, 5667, 996.375);
+INSERT INTO sales VALUES (7401, 5815, 1002.875);
+INSERT INTO sales VALUES (7402, 5963, 1009.375);
+INSERT INTO sales VALUES (7403, 6111, 1015.875);
+INSERT INTO sales VALUES (7404, 6259, 1022.375);
+INSERT INTO sales VALUES (7405, 6407, 4.875);
+INSERT INTO sales VALUES (7406, 6555, 11.375);
+INSERT INTO sales VALUES (7407, 6703, 17.875);
+INSERT INTO sales VALUES (7408, 6851, 24.375);
+INSERT INTO sales VALUES (7409, 6999, 30.875);
+INSERT INTO sales VALUES (7410, 7147, 37.375);
+INSERT INTO sales VALUES (7411, 7295, 43.875);
+INSERT INTO sales VALUES (7412, 7443, 50.375);
+INSERT INTO sales VALUES (7413, 7591, 56.875);
+INSERT INTO sales VALUES (7414, 7739, 63.375);
+INSERT INTO sales VALUES (7415, 7887, 69.875);
+INSERT INTO sales VALUES (7416, 8035, 76.375);
+INSERT INTO sales VALUES (7417, 8183, 82.875);
+INSERT INTO sales VALUES (7418, 139, 89.375);
+INSERT INTO sales VALUES (7419, 287, 95.875);
+INSERT INTO sales VALUES (7420, 435, 102.375);
+INSERT INTO sales VALUES (7421, 583, 108.875);
+INSERT INTO sales VALUES (7422, 731, 115.375);
+INSERT INTO sales VALUES (7423, 879, 121.875);
+INSERT INTO sales VALUES (7424, 1027, 128.375);
+INSERT INTO sales VALUES (7425, 1175, 134.875);
+INSERT INTO sales VALUES (7426, 1323, 141.375);
+INSERT INTO sales VALUES (7427, 1471, 147.875);
+INSERT INTO sales VALUES (7428, 1619, 154.375);
+INSERT INTO sales VALUES (7429, 1767, 160.875);
+INSERT INTO sales VALUES (7430, 1915, 167.375);
+INSERT INTO sales VALUES (7431, 2063, 173.875);
+INSERT INTO sales VALUES (7432, 2211, 180.375);
+INSERT INTO sales VALUES (7433, 2359, 186.875);
+INSERT INTO sales VALUES (7434, 2507, 193.375);
+INSERT INTO sales VALUES (7435, 2655, 199.875);
+INSERT INTO sales VALUES (7436, 2803, 206.375);
+INSERT INTO sales VALUES (7437, 2951, 212.875);
+INSERT INTO sales VALUES (7438, 3099, 219.375);
+INSERT INTO sales VALUES (7439, 3247, 225.875);
+INSERT INTO sales VALUES (7440, 3395, 232.375);
+INSERT INTO sales VALUES (7441, 3543, 238.875);
+INSERT INTO sales VALUES (7442, 3691, 245.375);
+INSERT INTO sales VALUES (7443, 3839, 251.875);
+INSERT INTO sales VALUES (7444, 3987, 258.375);
+INSERT INTO sales VALUES (7445, 4135, 264.875);
+INSERT INTO sales VALUES (7446, 4283, 271.375);
+INSERT INTO sales VALUES (7447, 4431, 277.875);
+INSERT INTO sales VALUES (7448, 4579, 284.375);
+INSERT INTO sales VALUES (7449, 4727, 290.875);
+INSERT INTO sales VALUES (7450, 4875, 297.375);
+INSERT INTO sales VALUES (7451, 5023, 303.875);
+INSERT INTO sales VALUES (7452, 5171, 310.375);
+INSERT INTO sales VALUES (7453, 5319, 316.875);
+INSERT INTO sales VALUES (7454, 5467, 323.375);
+INSERT INTO sales VALUES (7455, 5615, 329.875);
+INSERT INTO sales VALUES (7456, 5763, 336.375);
+INSERT INTO sales VALUES (7457, 5911, 342.875);
+INSERT INTO sales VALUES (7458, 6059, 349.375);
+INSERT INTO sales VALUES (7459, 6207, 355.875);
+INSERT INTO sales VALUES (7460, 6355, 362.375);
+INSERT INTO sales VALUES (7461, 6503, 368.875);
+INSERT INTO sales VALUES (7462, 6651, 375.375);
+INSERT INTO sales VALUES (7463, 6799, 381.875);
+INSERT INTO sales VALUES (7464, 6947, 388.375);
+INSERT INTO sales VALUES (7465, 7095, 394.875);
+INSERT INTO sales VALUES (7466, 7243, 401.375);
+INSERT INTO sales VALUES (7467, 7391, 407.875);
+INSERT INTO sales VALUES (7468, 7539, 414.375);
+INSERT INTO sales VALUES (7469, 7687, 420.875);
+INSERT INTO sales VALUES (7470, 7835, 427.375);
+INSERT INTO sales VALUES (7471, 7983, 433.875);
+INSERT INTO sales VALUES (7472, 8131, 440.375);
+INSERT INTO sales VALUES (7473, 87, 446.875);
+INSERT INTO sales VALUES (7474, 235, 453.375);
+INSERT INTO sales VALUES (7475, 383, 459.875);
+INSERT INTO sales VALUES (7476, 531, 466.375);
+INSERT INTO sales VALUES (7477, 679, 472.875);
+INSERT INTO sales VALUES (7478, 827, 479.375);
+INSERT INTO sales VALUES (7479, 975, 485.875);
+INSERT INTO sales VALUES (7480, 1123, 492.375);
+INSERT INTO sales VALUES (7481, 1271, 498.875);
+INSERT INTO sales VALUES (7482, 1419, 505.375);
+INSERT INTO sales VALUES (7483, 1567, 511.875);
+INSERT INTO sales VALUES (7484, 1715, 518.375);
+INSERT INTO sales VALUES (7485, 1863, 524.875);
+INSERT INTO sales VALUES (7486, 2011, 531.375);
+INSERT INTO sales VALUES (7487, 2159, 537.875);
+INSERT INTO sales VALUES (7488, 2307, 544.375);
+INSERT INTO sales VALUES (7489, 2455, 550.875);
+INSERT INTO sales VALUES (7490, 2603, 557.375);
+INSERT INTO sales VALUES (7491, 2751, 563.875);
+INSERT INTO sales VALUES (7492, 2899, 570.375);
+INSERT INTO sales VALUES (7493, 3047, 576.875);
+INSERT INTO sales VALUES (7494, 3195, 583.375);
+INSERT INTO sales VALUES (7495, 3343, 589.875);
+INSERT INTO sales VALUES (7496, 3491, 596.375);
+INSERT INTO sales VALUES (7497, 3639, 602.875);
+INSERT INTO sales VALUES (7498, 3787, 609.375);
+INSERT INTO sales VALUES (7499, 3935, 615.875);
+INSERT INTO sales VALUES (7500, 4083, 622.375);
+INSERT INTO sales VALUES (7501, 4231, 628.875);
+INSERT INTO sales VALUES (7502, 4379, 635.375);
+INSERT INTO sales VALUES (7503, 4527, 641.875);
+INSERT INTO sales VALUES (7504, 4675, 648.375);
+INSERT INTO sales VALUES (7505, 4823, 654.875);
+INSERT INTO sales VALUES (7506, 4971, 661.375);
+INSERT INTO sales VALUES (7507, 5119, 667.875);
+INSERT INTO sales VALUES (7508, 5267, 674.375);
+INSERT INTO sales VALUES (7509, 5415, 680.875);
+INSERT INTO sales VALUES (7510, 5563, 687.375);
+INSERT INTO sales VALUES (7511, 5711, 693.875);
+INSERT INTO sales VALUES (7512, 5859, 700.375);
+INSERT INTO sales VALUES (7513, 6007, 706.875);
+INSERT INTO sales VALUES (7514, 6155, 713.375);
+INSERT INTO sales VALUES (7515, 6303, 719.875);
+INSERT INTO sales VALUES (7516, 6451, 726.375);
+INSERT INTO sales VALUES (7517, 6599, 732.875);
+INSERT INTO sales VALUES (7518, 6747, 739.375);
+INSERT INTO sales VALUES (7519, 6895, 745.875);
+INSERT INTO sales VALUES (7520, 7043, 752.375);
+INSERT INTO sales VALUES (7521, 7191, 758.875);
+INSERT INTO sales VALUES (7522, 7339, 765.375);
+INSERT INTO sales VALUES (7523, 7487, 771.875);
+INSERT INTO sales VALUES (7524, 7635, 778.375);
+INSERT INTO sales VALUES (7525, 7783, 784.875);
+INSERT INTO sales VALUES (7526, 7931, 791.375);
+INSERT INTO sales VALUES (7527, 8079, 797.875);
+INSERT INTO sales VALUES (7528, 35, 804.375);
+INSERT INTO sales VALUES (7529, 183, 810.875);
+INSERT INTO sales VALUES (7530, 331, 817.375);
+INSERT INTO sales VALUES (7531, 479, 823.875);
+INSERT INTO sales VALUES (7532, 627, 830.375);
+INSERT INTO sales VALUES (7533, 775, 836.875);
+INSERT INTO sales VALUES (7534, 923, 843.375);
+INSERT INTO sales VALUES (7535, 1071, 849.875);
+INSERT INTO sales VALUES (7536, 1219, 856.375);
+INSERT INTO sales VALUES (7537, 1367, 862.875);
+INSERT INTO sales VALUES (7538, 1515, 869.375);
+INSERT INTO sales VALUES (7539, 1663, 875.875);
+INSERT INTO sales VALUES (7540, 1811, 882.375);
+INSERT INTO sales VALUES (7541, 1959, 888.875);
+INSERT INTO sales VALUES (7542, 2107, 895.375);
+INSERT INTO sales VALUES (7543, 2255, 901.875);
+INSERT INTO sales VALUES (7544, 2403, 908.375);
+INSERT INTO sales VALUES (7545, 2551, 914.875);
+INSERT INTO sales VALUES (7546, 2699, 921.375);
+INSERT INTO sales VALUES (7547, 2847, 927.875);
+INSERT INTO sales VALUES (7548, 2995, 934.375);
+INSERT INTO sales VALUES (7549, 3143, 940.875);
+INSERT INTO sales VALUES (7550, 3291, 947.375);
+INSERT INTO sales VALUES (7551, 3439, 953.875);
+INSERT INTO sales VALUES (7552, 3587, 960.375);
+INSERT INTO sales VALUES (7553, 3735, 966.875);
+INSERT INTO sales VALUES (7554, 3883, 973.375);
+INSERT INTO sales VALUES (7555, 4031, 979.875);
+INSERT INTO sales VALUES (7556, 4179, 986.375);
+INSERT INTO sales VALUES (7557, 4327, 992.875);
+INSERT INTO sales VALUES (7558, 4475, 999.375);
+INSERT INTO sales VALUES (7559, 4623, 1005.875);
+INSERT INTO sales VALUES (7560, 4771, 1012.375);
+INSERT INTO sales VALUES (7561, 4919, 1018.875);
+INSERT INTO sales VALUES (7562, 5067, 1.375);
+INSERT INTO sales VALUES (7563, 5215, 7.875);
+INSERT INTO sales VALUES (7564, 5363, 14.375);
+INSERT INTO sales VALUES (7565, 5511, 20.875);
+INSERT INTO sales VALUES (7566, 5659, 27.375);
+INSERT INTO sales VALUES (7567, 5807, 33.875);
+INSERT INTO sales VALUES (7568, 5955, 40.375);
+INSERT INTO sales VALUES (7569, 6103, 46.875);
+INSERT INTO sales VALUES (7570, 6251, 53.375);
+INSERT INTO sales VALUES (7571, 6399, 59.875);
+INSERT INTO sales VALUES (7572, 6547, 66.375);
+INSERT INTO sales VALUES (7573, 6695, 72.875);
+INSERT INTO sales VALUES (7574, 6843, 79.375);
+INSERT INTO sales VALUES (7575, 6991, 85.875);
+INSERT INTO sales VALUES (7576, 7139, 92.375);
+INSERT INTO sales VALUES (7577, 7287, 98.875);
+INSERT INTO sales VALUES (7578, 7435, 105.375);
+INSERT INTO sales VALUES (7579, 7583, 111.875);
+INSERT INTO sales VALUES (7580, 7731, 118.375);
+INSERT INTO sales VALUES (7581, 7879, 124.875);
+INSERT INTO sales VALUES (7582, 8027, 131.375);
+INSERT INTO sales VALUES (7583, 8175, 137.875);
+INSERT INTO sales VALUES (7584, 131, 144.375);
+INSERT INTO sales VALUES (7585, 279, 150.875);
+INSERT INTO sales VALUES (7586, 427, 157.375);
+INSERT INTO sales VALUES (7587, 575, 163.875);
+INSERT INTO sales VALUES (7588, 723, 170.375);
+INSERT INTO sales VALUES (7589, 871, 176.875);
+INSERT INTO sales VALUES (7590, 1019, 183.375);
+INSERT INTO sales VALUES (7591, 1167, 189.875);
+INSERT INTO sales VALUES (7592, 1315, 196.375);
+INSERT INTO sales VALUES (7593, 1463, 202.875);
+INSERT INTO sales VALUES (7594, 1611, 209.375);
+INSERT INTO sales VALUES (7595, 1759, 215.875);
+INSERT INTO sales VALUES (7596, 1907, 222.375);
+INSERT INTO sales VALUES (7597, 2055, 228.875);
+INSERT INTO sales VALUES (7598, 2203, 235.375);
+INSERT INTO sales VALUES (7599, 2351, 241.875);
+INSERT INTO sales VALUES (7600, 2499, 248.375);
+INSERT INTO sales VALUES (7601, 2647, 254.875);
+INSERT INTO sales VALUES (7602, 2795, 261.375);
+INSERT INTO sales VALUES (7603, 2943, 267.875);
+INSERT INTO sales VALUES (7604, 3091, 274.375);
+INSERT INTO sales VALUES (7605, 3239, 280.875);
+INSERT INTO sales VALUES (7606, 3387, 287.375);
+INSERT INTO sales VALUES (7607, 3535, 293.875);
+INSERT INTO sales VALUES (7608, 3683, 300.375);
+INSERT INTO sales VALUES (7609, 3831, 306.875);
+INSERT INTO sales VALUES (7610, 3979, 313.375);
+INSERT INTO sales VALUES (7611, 4127, 319.875);
+INSERT INTO sales VALUES (7612, 4275, 326.375);
+INSERT INTO sales VALUES (7613, 4423, 332.875);
+INSERT INTO sales VALUES (7614, 4571, 339.375);
+INSERT INTO sales VALUES (7615, 4719, 345.875);
+INSERT INTO sales VALUES (7616, 4867, 352.375);
+INSERT INTO sales VALUES (7617, 5015, 358.875);
+INSERT INTO sales VALUES (7618, 5163, 365.375);
+INSERT INTO sales VALUES (7619, 5311, 371.875);
+INSERT INTO sales VALUES (7620, 5459, 378.375);
+INSERT INTO sales VALUES (7621, 5607, 384.875);
+INSERT INTO sales VALUES (7622, 5755, 391.375);
+INSERT INTO sales VALUES (7623, 5903, 397.875);
+INSERT INTO sales VALUES (7624, 6051, 404.375);
+INSERT INTO sales VALUES (7625, 6199, 410.875);
+INSERT INTO sales VALUES (7626, 6347, 417.375);
+INSERT INTO sales VALUES (7627, 6495, 423.875);
+INSERT INTO sales VALUES (7628, 6643, 430.375);
+INSERT INTO sales VALUES (7629, 6791, 436.875);
+INSERT INTO sales VALUES (7630, 6939, 443.375);
+INSERT INTO sales VALUES (7631, 7087, 449.875);
+INSERT INTO sales VALUES (7632, 7235, 456.375);
+INSERT INTO sales VALUES (7633, 7383, 462.875);
+INSERT INTO sales VALUES (7634, 7531, 469.375);
+INSERT INTO sales VALUES (7635, 7679, 475.875);
+INSERT INTO sales VALUES (7636, 7827, 482.375);
+INSERT INTO sales VALUES (7637, 7975, 488.875);
+INSERT INTO sales VALUES (7638, 8123, 495.375);
+INSERT INTO sales VALUES (7639, 79, 501.875);
+INSERT INTO sales VALUES (7640, 227, 508.375);
+INSERT INTO sales VALUES (7641, 375, 514.875);
+INSERT INTO sales VALUES (7642, 523, 521.375);
+INSERT INTO sales VALUES (7643, 671, 527.875);
+INSERT INTO sales VALUES (7644, 819, 534.375);
+INSERT INTO sales VALUES (7645, 967, 540.875);
+INSERT INTO sales VALUES (7646, 1115, 547.375);
+INSERT INTO sales VALUES (7647, 1263, 553.875);
+INSERT INTO sales VALUES (7648, 1411, 560.375);
+INSERT INTO sales VALUES (7649, 1559, 566.875);
+INSERT INTO sales VALUES (7650, 1707, 573.375);
+INSERT INTO sales VALUES (7651, 1855, 579.875);
+INSERT INTO sales VALUES (7652, 2003, 586.375);
+INSERT INTO sales VALUES (7653, 2151, 592.875);
+INSERT INTO sales VALUES (7654, 2299, 599.375);
+INSERT INTO sales VALUES (7655, 2447, 605.875);
+INSERT INTO sales VALUES (7656, 2595, 612.375);
+INSERT INTO sales VALUES (7657, 2743, 618.875);
+INSERT INTO sales VALUES (7658, 2891, 625.375);
+INSERT INTO sales VALUES (7659, 3039, 631.875);
+INSERT INTO sales VALUES (7660, 3187, 638.375);
+INSERT INTO sales VALUES (7661, 3335, 644.875);
+INSERT INTO sales VALUES (7662, 3483, 651.375);
+INSERT INTO sales VALUES (7663, 3631, 657.875);
+INSERT INTO sales VALUES (7664, 3779, 664.375);
+INSERT INTO sales VALUES (7665, 3927, 670.875);
+INSERT INTO sales VALUES (7666, 4075, 677.375);
+INSERT INTO sales VALUES (7667, 4223, 683.875);
+INSERT INTO sales VALUES (7668, 4371, 690.375);
+INSERT INTO sales VALUES (7669, 4519, 696.875);
+INSERT INTO sales VALUES (7670, 4667, 703.375);
+INSERT INTO sales VALUES (7671, 4815, 709.875);
+INSERT INTO sales VALUES (7672, 4963, 716.375);
+INSERT INTO sales VALUES (7673, 5111, 722.875);
+INSERT INTO sales VALUES (7674, 5259, 729.375);
+INSERT INTO sales VALUES (7675, 5407, 735.875);
+INSERT INTO sales VALUES (7676, 5555, 742.375);
+INSERT INTO sales VALUES (7677, 5703, 748.875);
+INSERT INTO sales VALUES (7678, 5851, 755.375);
+INSERT INTO sales VALUES (7679, 5999, 761.875);
+INSERT INTO sales VALUES (7680, 6147, 768.375);
+INSERT INTO sales VALUES (7681, 6295, 774.875);
+INSERT INTO sales VALUES (7682, 6443, 781.375);
+INSERT INTO sales VALUES (7683, 6591, 787.875);
+INSERT INTO sales VALUES (7684, 6739, 794.375);
+INSERT INTO sales VALUES (7685, 6887, 800.875);
+INSERT INTO sales VALUES (7686, 7035, 807.375);
+INSERT INTO sales VALUES (7687, 7183, 813.875);
+INSERT INTO sales VALUES (7688, 7331, 820.375);
+INSERT INTO sales VALUES (7689, 7479, 826.875);
+INSERT INTO sales VALUES (7690, 7627, 833.375);
+INSERT INTO sales VALUES (7691, 7775, 839.875);
+INSERT INTO sales VALUES (7692, 7923, 846.375);
+INSERT INTO sales VALUES (7693, 8071, 852.875);
+INSERT INTO sales VALUES (7694, 27, 859.375);
+INSERT INTO sales VALUES (7695, 175, 865.875);
+INSERT INTO sales VALUES (7696, 323, 872.375);
+INSERT INTO sales VALUES (7697, 471, 878.875);
+INSERT INTO sales VALUES (7698, 619, 885.375);
+INSERT INTO sales VALUES (7699, 767, 891.875);
+INSERT INTO sales VALUES (7700, 915, 898.375);
+INSERT INTO sales VALUES (7701, 1063, 904.875);
+INSERT INTO sales VALUES (7702, 1211, 911.375);
+INSERT INTO sales VALUES (7703, 1359, 917.875);
+INSERT INTO sales VALUES (7704, 1507, 924.375);
+INSERT INTO sales VALUES (7705, 1655, 930.875);
+INSERT INTO sales VALUES (7706, 1803, 937.375);
+INSERT INTO sales VALUES (7707, 1951, 943.875);
+INSERT INTO sales VALUES (7708, 2099, 950.375);
+INSERT INTO sales VALUES (7709, 2247, 956.875);
+INSERT INTO sales VALUES (7710, 2395, 963.375);
+INSERT INTO sales VALUES (7711, 2543, 969.875);
+INSERT INTO sales VALUES (7712, 2691, 976.375);
+INSERT INTO sales VALUES (7713, 2839, 982.875);
+INSERT INTO sales VALUES (7714, 2987, 989.375);
+INSERT INTO sales VALUES (7715, 3135, 995.875);
+INSERT INTO sales VALUES (7716, 3283, 1002.375);
+INSERT INTO sales VALUES (7717, 3431, 1008.875);
+INSERT INTO sales VALUES (7718, 3579, 1015.375);
+INSERT INTO sales VALUES (7719, 3727, 1021.875);
+INSERT INTO sales VALUES (7720, 3875, 4.375);
+INSERT INTO sales VALUES (7721, 4023, 10.875);
+INSERT INTO sales VALUES (7722, 4171, 17.375);
+INSERT INTO sales VALUES (7723, 4319, 23.875);
+INSERT INTO sales VALUES (7724, 4467, 30.375);
+INSERT INTO sales VALUES (7725, 4615, 36.875);
+INSERT INTO sales VALUES (7726, 4763, 43.375);
+INSERT INTO sales VALUES (7727, 4911, 49.875);
+INSERT INTO sales VALUES (7728, 5059, 56.375);
+INSERT INTO sales VALUES (7729, 5207, 62.875);
+INSERT INTO sales VALUES (7730, 5355, 69.375);
+INSERT INTO sales VALUES (7731, 5503, 75.875);
+INSERT INTO sales VALUES (7732, 5651, 82.375);
+INSERT INTO sales VALUES (7733, 5799, 88.875);
+INSERT INTO sales VALUES (7734, 5947, 95.375);
+INSERT INTO sales VALUES (7735, 6095, 101.875);
+INSERT INTO sales VALUES (7736, 6243, 108.375);
+INSERT INTO sales VALUES (7737, 6391, 114.875);
+INSERT INTO sales VALUES (7738, 6539, 121.375);
+INSERT INTO sales VALUES (7739, 6687, 127.875);
+INSERT INTO sales VALUES (7740, 6835, 134.375);
+INSERT INTO sales VALUES (7741, 6983, 140.875);
+INSERT INTO sales VALUES (7742, 7131, 147.375);
+INSERT INTO sales VALUES (7743, 7279, 153.875);
+INSERT INTO sales VALUES (7744, 7427, 160.375);
+INSERT INTO sales VALUES (7745, 7575, 166.875);
+INSERT INTO sales VALUES (7746, 7723, 173.375);
+INSERT INTO sales VALUES (7747, 7871, 179.875);
+INSERT INTO sales VALUES (7748, 8019, 186.375);
+INSERT INTO sales VALUES (7749, 8167, 192.875);
+INSERT INTO sales VALUES (7750, 123, 199.375);
+INSERT INTO sales VALUES (7751, 271, 205.875);
+INSERT INTO sales VALUES (7752, 419, 212.375);
+INSERT INTO sales VALUES (7753, 567, 218.875);
+INSERT INTO sales VALUES (7754, 715, 225.375);
+INSERT INTO sales VALUES (7755, 863, 231.875);
+INSERT INTO sales VALUES (7756, 1011, 238.375);
+INSERT INTO sales VALUES (7757, 1159, 244.875);
+INSERT INTO sales VALUES (7758, 1307, 251.375);
+INSERT INTO sales VALUES (7759, 1455, 257.875);
+INSERT INTO sales VALUES (7760, 1603, 264.375);
+INSERT INTO sales VALUES (7761, 1751, 270.875);
+INSERT INTO sales VALUES (7762, 1899, 277.375);
+INSERT INTO sales VALUES (7763, 2047, 283.875);
+INSERT INTO sales VALUES (7764, 2195, 290.375);
+INSERT INTO sales VALUES (7765, 2343, 296.875);
+INSERT INTO sales VALUES (7766, 2491, 303.375);
+INSERT INTO sales VALUES (7767, 2639, 309.875);
+INSERT INTO sales VALUES (7768, 2787, 316.375);
+INSERT INTO sales VALUES (7769, 2935, 322.875);
+INSERT INTO sales VALUES (7770, 3083, 329.375);
+INSERT INTO sales VALUES (7771, 3231, 335.875);
+INSERT INTO sales VALUES (7772, 3379, 342.375);
+INSERT INTO sales VALUES (7773, 3527, 348.875);
+INSERT INTO sales VALUES (7774, 3675, 355.375);
+INSERT INTO sales VALUES (7775, 3823, 361.875);
+INSERT INTO sales VALUES (7776, 3971, 368.375);
+INSERT INTO sales VALUES (7777, 4119, 374.875);
+INSERT INTO sales VALUES (7778, 4267, 381.375);
+INSERT INTO sales VALUES (7779, 4415, 387.875);
+INSERT INTO sales VALUES (7780, 4563, 394.375);
+INSERT INTO sales VALUES (7781, 4711, 400.875);
+INSERT INTO sales VALUES (7782, 4859, 407.375);
+INSERT INTO sales VALUES (7783, 5007, 413.875);
+INSERT INTO sales VALUES (7784, 5155, 420.375);
+INSERT INTO sales VALUES (7785, 5303, 426.875);
+INSERT INTO sales VALUES (7786, 5451, 433.375);
+INSERT INTO sales VALUES (7787, 5599, 439.875);
+INSERT INTO sales VALUES (7788, 5747, 446.375);
+INSERT INTO sales VALUES (7789, 5895, 452.875);
+INSERT INTO sales VALUES (7790, 6043, 459.375);
+INSERT INTO sales VALUES (7791, 6191, 465.875);
+INSERT INTO sales VALUES (7792, 6339, 472.375);
+INSERT INTO sales VALUES (7793, 6487, 478.875);
+INSERT INTO sales VALUES (7794, 6635, 485.375);
+INSERT INTO sales VALUES (7795, 6783, 491.875);
+INSERT INTO sales VALUES (7796, 6931, 498.375);
+INSERT INTO sales VALUES (7797, 7079, 504.875);
+INSERT INTO sales VALUES (7798, 7227, 511.375);
+INSERT INTO sales VALUES (7799, 7375, 517.875);
+INSERT INTO sales VALUES (7800, 7523, 524.375);
+INSERT INTO sales VALUES (7801, 7671, 530.875);
+INSERT INTO sales VALUES (7802, 7819, 537.375);
+INSERT INTO sales VALUES (7803, 7967, 543.875);
+INSERT INTO sales VALUES (7804, 8115, 550.375);
+INSERT INTO sales VALUES (7805, 71, 556.875);
+INSERT INTO sales VALUES (7806, 219, 563.375);
+INSERT INTO sales VALUES (7807, 367, 569.875);
+INSERT INTO sales VALUES (7808, 515, 576.375);
+INSERT INTO sales VALUES (7809, 663, 582.875);
+INSERT INTO sales VALUES (7810, 811, 589.375);
+INSERT INTO sales VALUES (7811, 959, 595.875);
+INSERT INTO sales VALUES (7812, 1107, 602.375);
+INSERT INTO sales VALUES (7813, 1255, 608.875);
+INSERT INTO sales VALUES (7814, 1403, 615.375);
+INSERT INTO sales VALUES (7815, 1551, 621.875);
+INSERT INTO sales VALUES (7816, 1699, 628.375);
+INSERT INTO sales VALUES (7817, 1847, 634.875);
+INSERT INTO sales VALUES (7818, 1995, 641.375);
+INSERT INTO sales VALUES (7819, 2143, 647.875);
+INSERT INTO sales VALUES (7820, 2291, 654.375);
+INSERT INTO sales VALUES (7821, 2439, 660.875);
+INSERT INTO sales VALUES (7822, 2587, 667.375);
+INSERT INTO sales VALUES (7823, 2735, 673.875);
+INSERT INTO sales VALUES (7824, 2883, 680.375);
+INSERT INTO sales VALUES (7825, 3031, 686.875);
+INSERT INTO sales VALUES (7826, 3179, 693.375);
+INSERT INTO sales VALUES (7827, 3327, 699.875);
+INSERT INTO sales VALUES (7828, 3475, 706.375);
+INSERT INTO sales VALUES (7829, 3623, 712.875);
+INSERT INTO sales VALUES (7830, 3771, 719.375);
+INSERT INTO sales VALUES (7831, 3919, 725.875);
+INSERT INTO sales VALUES (7832, 4067, 732.375);
+INSERT INTO sales VALUES (7833, 4215, 738.875);
+INSERT INTO sales VALUES (7834, 4363, 745.375);
+INSERT INTO sales VALUES (7835, 4511, 751.875);
+INSERT INTO sales VALUES (7836, 4659, 758.375);
+INSERT INTO sales VALUES (7837, 4807, 764.875);
+INSERT INTO sales VALUES (7838, 4955, 771.375);
+INSERT INTO sales VALUES (7839, 5103, 777.875);
+INSERT INTO sales VALUES (7840, 5251, 784.375);
+INSERT INTO sales VALUES (7841, 5399, 790.875);
+INSERT INTO sales VALUES (7842, 5547, 797.375);
+INSERT INTO sales VALUES (7843, 5695, 803.875);
+INSERT INTO sales VALUES (7844, 5843, 810.375);
+INSERT INTO sales VALUES (7845, 5991, 816.875);
+INSERT INTO sales VALUES (7846, 6139, 823.375);
+INSERT INTO sales VALUES (7847, 6287, 829.875);
+INSERT INTO sales VALUES (7848, 6435, 836.375);
+INSERT INTO sales VALUES (7849, 6583, 842.875);
+INSERT INTO sales VALUES (7850, 6731, 849.375);
+INSERT INTO sales VALUES (7851, 6879, 855.875);
+INSERT INTO sales VALUES (7852, 7027, 862.375);
+INSERT INTO sales VALUES (7853, 7175, 868.875);
+INSERT INTO sales VALUES (7854, 7323, 875.375);
+INSERT INTO sales VALUES (7855, 7471, 881.875);
+INSERT INTO sales VALUES (7856, 7619, 888.375);
+INSERT INTO sales VALUES (7857, 7767, 894.875);
+INSERT INTO sales VALUES (7858, 7915, 901.375);
+INSERT INTO sales VALUES (7859, 8063, 907.875);
+INSERT INTO sales VALUES (7860, 19, 914.375);
+INSERT INTO sales VALUES (7861, 167, 920.875);
+INSERT INTO sales VALUES (7862, 315, 927.375);
+INSERT INTO sales VALUES (7863, 463, 933.875);
+INSERT INTO sales VALUES (7864, 611, 940.375);
+INSERT INTO sales VALUES (7865, 759, 946.875);
+INSERT INTO sales VALUES (7866, 907, 953.375);
+INSERT INTO sales VALUES (7867, 1055, 959.875);
+INSERT INTO sales VALUES (7868, 1203, 966.375);
+INSERT INTO sales VALUES (7869, 1351, 972.875);
+INSERT INTO sales VALUES (7870, 1499, 979.375);
+INSERT INTO sales VALUES (7871, 1647, 985.875);
+INSERT INTO sales VALUES (7872, 1795, 992.375);
+INSERT INTO sales VALUES (7873, 1943, 998.875);
+INSERT INTO sales VALUES (7874, 2091, 1005.375);
+INSERT INTO sales VALUES (7875, 2239, 1011.875);
+INSERT INTO sales VALUES (7876, 2387, 1018.375);
+INSERT INTO sales VALUES (7877, 2535, 0.875);
+INSERT INTO sales VALUES (7878, 2683, 7.375);
+INSERT INTO sales VALUES (7879, 2831, 13.875);
+INSERT INTO sales VALUES (7880, 2979, 20.375);
+INSERT INTO sales VALUES (7881, 3127, 26.875);
+INSERT INTO sales VALUES (7882, 3275, 33.375);
+INSERT INTO sales VALUES (7883, 3423, 39.875);
+INSERT INTO sales VALUES (7884, 3571, 46.375);
+INSERT INTO sales VALUES (7885, 3719, 52.875);
+INSERT INTO sales VALUES (7886, 3867, 59.375);
+INSERT INTO sales VALUES (7887, 4015, 65.875);
+INSERT INTO sales VALUES (7888, 4163, 72.375);
+INSERT INTO sales VALUES (7889, 4311, 78.875);
+INSERT INTO sales VALUES (7890, 4459, 85.375);
+INSERT INTO sales VALUES (7891, 4607, 91.875);
+INSERT INTO sales VALUES (7892, 4755, 98.375);
+INSERT INTO sales VALUES (7893, 4903, 104.875);
+INSERT INTO sales VALUES (7894, 5051, 111.375);
+INSERT INTO sales VALUES (7895, 5199, 117.875);
+INSERT INTO sales VALUES (7896, 5347, 124.375);
+INSERT INTO sales VALUES (7897, 5495, 130.875);
+INSERT INTO sales VALUES (7898, 5643, 137.375);
+INSERT INTO sales VALUES (7899, 5791, 143.875);
+INSERT INTO sales VALUES (7900, 5939, 150.375);
+INSERT INTO sales VALUES (7901, 6087, 156.875);
+INSERT INTO sales VALUES (7902, 6235, 163.375);
+INSERT INTO sales VALUES (7903, 6383, 169.875);
+INSERT INTO sales VALUES (7904, 6531, 176.375);
+INSERT INTO sales VALUES (7905, 6679, 182.875);
+INSERT INTO sales VALUES (7906, 6827, 189.375);
+INSERT INTO sales VALUES (7907, 6975, 195.875);
+INSERT INTO sales VALUES (7908, 7123, 202.375);
+INSERT INTO sales VALUES (7909, 7271, 208.875);
+INSERT INTO sales VALUES (7910, 7419, 215.375);
+INSERT INTO sales VALUES (7911, 7567, 221.875);
+INSERT INTO sales VALUES (7912, 7715, 228.375);
+INSERT INTO sales VALUES (7913, 7863, 234.875);
+INSERT INTO sales VALUES (7914, 8011, 241.375);
+INSERT INTO sales VALUES (7915, 8159, 247.875);
+INSERT INTO sales VALUES (7916, 115, 254.375);
+INSERT INTO sales VALUES (7917, 263, 260.875);
+INSERT INTO sales VALUES (7918, 411, 267.375);
+INSERT INTO sales VALUES (7919, 559, 273.875);
+INSERT INTO sales VALUES (7920, 707, 280.375);
+INSERT INTO sales VALUES (7921, 855, 286.875);
+INSERT INTO sales VALUES (7922, 1003, 293.375);
+INSERT INTO sales VALUES (7923, 1151, 299.875);
+INSERT INTO sales VALUES (7924, 1299, 306.375);
+INSERT INTO sales VALUES (7925, 1447, 312.875);
+INSERT INTO sales VALUES (7926, 1595, 319.375);
+INSERT INTO sales VALUES (7927, 1743, 325.875);
+INSERT INTO sales VALUES (7928, 1891, 332.375);
+INSERT INTO sales VALUES (7929, 2039, 338.875);
+INSERT INTO sales VALUES (7930, 2187, 345.375);
+INSERT INTO sales VALUES (7931, 2335, 351.875);
+INSERT INTO sales VALUES (7932, 2483, 358.375);
+INSERT INTO sales VALUES (7933, 2631, 364.875);
+INSERT INTO sales VALUES (7934, 2779, 371.375);
+INSERT INTO sales VALUES (7935, 2927, 377.875);
+INSERT INTO sales VALUES (7936, 3075, 384.375);
+INSERT INTO sales VALUES (7937, 3223, 390.875);
+INSERT INTO sales VALUES (7938, 3371, 397.375);
+INSERT INTO sales VALUES (7939, 3519, 403.875);
+INSERT INTO sales VALUES (7940, 3667, 410.375);
+INSERT INTO sales VALUES (7941, 3815, 416.875);
+INSERT INTO sales VALUES (7942, 3963, 423.375);
+INSERT INTO sales VALUES (7943, 4111, 429.875);
+INSERT INTO sales VALUES (7944, 4259, 436.375);
+INSERT INTO sales VALUES (7945, 4407, 442.875);
+INSERT INTO sales VALUES (7946, 4555, 449.375);
+INSERT INTO sales VALUES (7947, 4703, 455.875);
+INSERT INTO sales VALUES (7948, 4851, 462.375);
+INSERT INTO sales VALUES (7949, 4999, 468.875);
+INSERT INTO sales VALUES (7950, 5147, 475.375);
+INSERT INTO sales VALUES (7951, 5295, 481.875);
+INSERT INTO sales VALUES (7952, 5443, 488.375);
+INSERT INTO sales VALUES (7953, 5591, 494.875);
+INSERT INTO sales VALUES (7954, 5739, 501.375);
+INSERT INTO sales VALUES (7955, 5887, 507.875);
+INSERT INTO sales VALUES (7956, 6035, 514.375);
+INSERT INTO sales VALUES (7957, 6183, 520.875);
+INSERT INTO sales VALUES (7958, 6331, 527.375);
+INSERT INTO sales VALUES (7959, 6479, 533.875);
+INSERT INTO sales VALUES (7960, 6627, 540.375);
+INSERT INTO sales VALUES (7961, 6775, 546.875);
+INSERT INTO sales VALUES (7962, 6923, 553.375);
+INSERT INTO sales VALUES (7963, 7071, 559.875);
+INSERT INTO sales VALUES (7964, 7219, 566.375);
+INSERT INTO sales VALUES (7965, 7367, 572.875);
+INSERT INTO sales VALUES (7966, 7515, 579.375);
+INSERT INTO sales VALUES (7967, 7663, 585.875);
+INSERT INTO sales VALUES (7968, 7811, 592.375);
+INSERT INTO sales VALUES (7969, 7959, 598.875);
+INSERT INTO sales VALUES (7970, 8107, 605.375);
+INSERT INTO sales VALUES (7971, 63, 611.875);
+INSERT INTO sales VALUES (7972, 211, 618.375);
+INSERT INTO sales VALUES (7973, 359, 624.875);
+INSERT INTO sales VALUES (7974, 507, 631.375);
+INSERT INTO sales VALUES (7975, 655, 637.875);
+INSERT INTO sales VALUES (7976, 803, 644.375);
+INSERT INTO sales VALUES (7977, 951, 650.875);
+INSERT INTO sales VALUES (7978, 1099, 657.375);
+INSERT INTO sales VALUES (7979, 1247, 663.875);
+INSERT INTO sales VALUES (7980, 1395, 670.375);
+INSERT INTO sales VALUES (7981, 1543, 676.875);
+INSERT INTO sales VALUES (7982, 1691, 683.375);
+INSERT INTO sales VALUES (7983, 1839, 689.875);
+INSERT INTO sales VALUES (7984, 1987, 696.375);
+INSERT INTO sales VALUES (7985, 2135, 702.875);
+INSERT INTO sales VALUES (7986, 2283, 709.375);
+INSERT INTO sales VALUES (7987, 2431, 715.875);
+INSERT INTO sales VALUES (7988, 2579, 722.375);
+INSERT INTO sales VALUES (7989, 2727, 728.875);
+INSERT INTO sales VALUES (7990, 2875, 735.375);
+INSERT INTO sales VALUES (7991, 3023, 741.875);
+INSERT INTO sales VALUES (7992, 3171, 748.375);
+INSERT INTO sales VALUES (7993, 3319, 754.875);
+INSERT INTO sales VALUES (7994, 3467, 761.375);
+INSERT INTO sales VALUES (7995, 3615, 767.875);
+INSERT INTO sales VALUES (7996, 3763, 774.375);
+INSERT INTO sales VALUES (7997, 3911, 780.875);
+INSERT INTO sales VALUES (7998, 4059, 787.375);
+INSERT INTO sales VALUES (7999, 4207, 793.875);
+INSERT INTO sales VALUES (8000, 4355, 800.375);
+INSERT INTO sales VALUES (8001, 4503, 806.875);
+INSERT INTO sales VALUES (8002, 4651, 813.375);
+INSERT INTO sales VALUES (8003, 4799, 819.875);
+INSERT INTO sales VALUES (8004, 4947, 826.375);
+INSERT INTO sales VALUES (8005, 5095, 832.875);
+INSERT INTO sales VALUES (8006, 5243, 839.375);
+INSERT INTO sales VALUES (8007, 5391, 845.875);
+INSERT INTO sales VALUES (8008, 5539, 852.375);
+INSERT INTO sales VALUES (8009, 5687, 858.875);
+INSERT INTO sales VALUES (8010, 5835, 865.375);
+INSERT INTO sales VALUES (8011, 5983, 871.875);
+INSERT INTO sales VALUES (8012, 6131, 878.375);
+INSERT INTO sales VALUES (8013, 6279, 884.875);
+INSERT INTO sales VALUES (8014, 6427, 891.375);
+INSERT INTO sales VALUES (8015, 6575, 897.875);
+INSERT INTO sales VALUES (8016, 6723, 904.375);
+INSERT INTO sales VALUES (8017, 6871, 910.875);
+INSERT INTO sales VALUES (8018, 7019, 917.375);
+INSERT INTO sales VALUES (8019, 7167, 923.875);
+INSERT INTO sales VALUES (8020, 7315, 930.375);
+INSERT INTO sales VALUES (8021, 7463, 936.875);
+INSERT INTO sales VALUES (8022, 7611, 943.375);
+INSERT INTO sales VALUES (8023, 7759, 949.875);
+INSERT INTO sales VALUES (8024, 7907, 956.375);
+INSERT INTO sales VALUES (8025, 8055, 962.875);
+INSERT INTO sales VALUES (8026, 11, 969.375);
+INSERT INTO sales VALUES (8027, 159, 975.875);
+INSERT INTO sales VALUES (8028, 307, 982.375);
+INSERT INTO sales VALUES (8029, 455, 988.875);
+INSERT INTO sales VALUES (8030, 603, 995.375);
+INSERT INTO sales VALUES (8031, 751, 1001.875);
+INSERT INTO sales VALUES (8032, 899, 1008.375);
+INSERT INTO sales VALUES (8033, 1047, 1014.875);
+INSERT INTO sales VALUES (8034, 1195, 1021.375);
+INSERT INTO sales VALUES (8035, 1343, 3.875);
+INSERT INTO sales VALUES (8036, 1491, 10.375);
+INSERT INTO sales VALUES (8037, 1639, 16.875);
+INSERT INTO sales VALUES (8038, 1787, 23.375);
+INSERT INTO sales VALUES (8039, 1935, 29.875);
+INSERT INTO sales VALUES (8040, 2083, 36.375);
+INSERT INTO sales VALUES (8041, 2231, 42.875);
+INSERT INTO sales VALUES (8042, 2379, 49.375);
+INSERT INTO sales VALUES (8043, 2527, 55.875);
+INSERT INTO sales VALUES (8044, 2675, 62.375);
+INSERT INTO sales VALUES (8045, 2823, 68.875);
+INSERT INTO sales VALUES (8046, 2971, 75.375);
+INSERT INTO sales VALUES (8047, 3119, 81.875);
+INSERT INTO sales VALUES (8048, 3267, 88.375);
+INSERT INTO sales VALUES (8049, 3415, 94.875);
+INSERT INTO sales VALUES (8050, 3563, 101.375);
+INSERT INTO sales VALUES (8051, 3711, 107.875);
+INSERT INTO sales VALUES (8052, 3859, 114.375);
+INSERT INTO sales VALUES (8053, 4007, 120.875);
+INSERT INTO sales VALUES (8054, 4155, 127.375);
+INSERT INTO sales VALUES (8055, 4303, 133.875);
+INSERT INTO sales VALUES (8056, 4451, 140.375);
+INSERT INTO sales VALUES (8057, 4599, 146.875);
+INSERT INTO sales VALUES (8058, 4747, 153.375);
+INSERT INTO sales VALUES (8059, 4895, 159.875);
+INSERT INTO sales VALUES (8060, 5043, 166.375);
+INSERT INTO sales VALUES (8061, 5191, 172.875);
+INSERT INTO sales VALUES (8062, 5339, 179.375);
+INSERT INTO sales VALUES (8063, 5487, 185.875);
+INSERT INTO sales VALUES (8064, 5635, 192.375);
+INSERT INTO sales VALUES (8065, 5783, 198.875);
+INSERT INTO sales VALUES (8066, 5931, 205.375);
+INSERT INTO sales VALUES (8067, 6079, 211.875);
+INSERT INTO sales VALUES (8068, 6227, 218.375);
+INSERT INTO sales VALUES (8069, 6375, 224.875);
+INSERT INTO sales VALUES (8070, 6523, 231.375);
+INSERT INTO sales VALUES (8071, 6671, 237.875);
+INSERT INTO sales VALUES (8072, 6819, 244.375);
+INSERT INTO sales VALUES (8073, 6967, 250.875);
+INSERT INTO sales VALUES (8074, 7115, 257.375);
+INSERT INTO sales VALUES (8075, 7263, 263.875);
+INSERT INTO sales VALUES (8076, 7411, 270.375);
+INSERT INTO sales VALUES (8077, 7559, 276.875);
+INSERT INTO sales VALUES (8078, 7707, 283.375);
+INSERT INTO sales VALUES (8079, 7855, 289.875);
+INSERT INTO sales VALUES (8080, 8003, 296.375);
+INSERT INTO sales VALUES (8081, 8151, 302.875);
+INSERT INTO sales VALUES (8082, 107, 309.375);
+INSERT INTO sales VALUES (8083, 255, 315.875);
+INSERT INTO sales VALUES (8084, 403, 322.375);
+INSERT INTO sales VALUES (8085, 551, 328.875);
+INSERT INTO sales VALUES (8086, 699, 335.375);
+INSERT INTO sales VALUES (8087, 847, 341.875);
+INSERT INTO sales VALUES (8088, 995, 348.375);
+INSERT INTO sales VALUES (8089, 1143, 354.875);
+INSERT INTO sales VALUES (8090, 1291, 361.375);
+INSERT INTO sales VALUES (8091, 1439, 367.875);
+INSERT INTO sales VALUES (8092, 1587, 374.375);
+INSERT INTO sales VALUES (8093, 1735, 380.875);
+INSERT INTO sales VALUES (8094, 1883, 387.375);
+INSERT INTO sales VALUES (8095, 2031, 393.875);
+INSERT INTO sales VALUES (8096, 2179, 400.375);
+INSERT INTO sales VALUES (8097, 2327, 406.875);
+INSERT INTO sales VALUES (8098, 2475, 413.375);
+INSERT INTO sales VALUES (8099, 2623, 419.875);
+INSERT INTO sales VALUES (8100, 2771, 426.375);
+INSERT INTO sales VALUES (8101, 2919, 432.875);
+INSERT INTO sales VALUES (8102, 3067, 439.375);
+INSERT INTO sales VALUES (8103, 3215, 445.875);
+INSERT INTO sales VALUES (8104, 3363, 452.375);
+INSERT INTO sales VALUES (8105, 3511, 458.875);
+INSERT INTO sales VALUES (8106, 3659, 465.375);
+INSERT INTO sales VALUES (8107, 3807, 471.875);
+INSERT INTO sales VALUES (8108, 3955, 478.375);
+INSERT INTO sales VALUES (8109, 4103, 484.875);
+INSERT INTO sales VALUES (8110, 4251, 491.375);
+INSERT INTO sales VALUES (8111, 4399, 497.875);
+INSERT INTO sales VALUES (8112, 4547, 504.375);
+INSERT INTO sales VALUES (8113, 4695, 510.875);
+INSERT INTO sales VALUES (8114, 4843, 517.375);
+INSERT INTO sales VALUES (8115, 4991, 523.875);
+INSERT INTO sales VALUES (8116, 5139, 530.375);
+INSERT INTO sales VALUES (8117, 5287, 536.875);
+INSERT INTO sales VALUES (8118, 5435, 543.375);
+INSERT INTO sales VALUES (8119, 5583, 549.875);
+INSERT INTO sales VALUES (8120, 5731, 556.375);
+INSERT INTO sales VALUES (8121, 5879, 562.875);
+INSERT INTO sales VALUES (8122, 6027, 569.375);
+INSERT INTO sales VALUES (8123, 6175, 575.875);
+INSERT INTO sales VALUES (8124, 6323, 582.375);
+INSERT INTO sales VALUES (8125, 6471, 588.875);
+INSERT INTO sales VALUES (8126, 6619, 595.375);
+INSERT INTO sales VALUES (8127, 6767, 601.875);
+INSERT INTO sales VALUES (8128, 6915, 608.375);
+INSERT INTO sales VALUES (8129, 7063, 614.875);
+INSERT INTO sales VALUES (8130, 7211, 621.375);
+INSERT INTO sales VALUES (8131, 7359, 627.875);
+INSERT INTO sales VALUES (8132, 7507, 634.375);
+INSERT INTO sales VALUES (8133, 7655, 640.875);
+INSERT INTO sales VALUES (8134, 7803, 647.375);
+INSERT INTO sales VALUES (8135, 7951, 653.875);
+INSERT INTO sales VALUES (8136, 8099, 660.375);
+INSERT INTO sales VALUES (8137, 55, 666.875);
+INSERT INTO sales VALUES (8138, 203, 673.375);
+INSERT INTO sales VALUES (8139, 351, 679.875);
+INSERT INTO sales VALUES (8140, 499, 686.375);
+INSERT INTO sales VALUES (8141, 647, 692.875);
+INSERT INTO sales VALUES (8142, 795, 699.375);
+INSERT INTO sales VALUES (8143, 943, 705.875);
+INSERT INTO sales VALUES (8144, 1091, 712.375);
+INSERT INTO sales VALUES (8145, 1239, 718.875);
+INSERT INTO sales VALUES (8146, 1387, 725.375);
+INSERT INTO sales VALUES (8147, 1535, 731.875);
+INSERT INTO sales VALUES (8148, 1683, 738.375);
+INSERT INTO sales VALUES (8149, 1831, 744.875);
+INSERT INTO sales VALUES (8150, 1979, 751.375);
+INSERT INTO sales VALUES (8151, 2127, 757.875);
+INSERT INTO sales VALUES (8152, 2275, 764.375);
+INSERT INTO sales VALUES (8153, 2423, 770.875);
+INSERT INTO sales VALUES (8154, 2571, 777.375);
+INSERT INTO sales VALUES (8155, 2719, 783.875);
+INSERT INTO sales VALUES (8156, 2867, 790.375);
+INSERT INTO sales VALUES (8157, 3015, 796.875);
+INSERT INTO sales VALUES (8158, 3163, 803.375);
+INSERT INTO sales VALUES (8159, 3311, 809.875);
+INSERT INTO sales VALUES (8160, 3459, 816.375);
+INSERT INTO sales VALUES (8161, 3607, 822.875);
+INSERT INTO sales VALUES (8162, 3755, 829.375);
+INSERT INTO sales VALUES (8163, 3903, 835.875);
+INSERT INTO sales VALUES (8164, 4051, 842.375);
+INSERT INTO sales VALUES (8165, 4199, 848.875);
+INSERT INTO sales VALUES (8166, 4347, 855.375);
+INSERT INTO sales VALUES (8167, 4495, 861.875);
+INSERT INTO sales VALUES (8168, 4643, 868.375);
+INSERT INTO sales VALUES (8169, 4791, 874.875);
+INSERT INTO sales VALUES (8170, 4939, 881.375);
+INSERT INTO sales VALUES (8171, 5087, 887.875);
+INSERT INTO sales VALUES (8172, 5235, 894.375);
+INSERT INTO sales VALUES (8173, 5383, 900.875);
+INSERT INTO sales VALUES (8174, 5531, 907.375);
+INSERT INTO sales VALUES (8175, 5679, 913.875);
+INSERT INTO sales VALUES (8176, 5827, 920.375);
+INSERT INTO sales VALUES (8177, 5975, 926.875);
+INSERT INTO sales VALUES (8178, 6123, 933.375);
+INSERT INTO sales VALUES (8179, 6271, 939.875);
+INSERT INTO sales VALUES (8180, 6419, 946.375);
+INSERT INTO sales VALUES (8181, 6567, 952.875);
+INSERT INTO sales VALUES (8182, 6715, 959.375);
+INSERT INTO sales VALUES (8183, 6863, 965.875);
+INSERT INTO sales VALUES (8184, 7011, 972.375);
+INSERT INTO sales VALUES (8185, 7159, 978.875);
+INSERT INTO sales VALUES (8186, 7307, 985.375);
+INSERT INTO sales VALUES (8187, 7455, 991.875);
+INSERT INTO sales VALUES (8188, 7603, 998.375);
+INSERT INTO sales VALUES (8189, 7751, 1004.875);
+INSERT INTO sales VALUES (8190, 7899, 1011.375);
+INSERT INTO sales VALUES (8191, 8047, 1017.875);
+INSERT INTO stores VALUES (1, 'city1');
+INSERT INTO stores VALUES (271, 'city271');
+INSERT INTO stores VALUES (541, 'city541');
+INSERT INTO stores VALUES (811, 'city811');
+INSERT INTO stores VALUES (1081, 'city1081');
+INSERT INTO stores VALUES (1351, 'city1351');
+INSERT INTO stores VALUES (1621, 'city1621');
+INSERT INTO stores VALUES (1891, 'city1891');
+INSERT INTO stores VALUES (2161, 'city2161');
+INSERT INTO stores VALUES (2431, 'city2431');
+INSERT INTO stores VALUES (2701, 'city2701');
+INSERT INTO stores VALUES (2971, 'city2971');
+INSERT INTO stores VALUES (3241, 'city3241');
+INSERT INTO stores VALUES (3511, 'city3511');
+INSERT INTO stores VALUES (3781, 'city3781');
+INSERT INTO stores VALUES (4051, 'city4051');
+INSERT INTO stores VALUES (4321, 'city4321');
+INSERT INTO stores VALUES (4591, 'city4591');
+INSERT INTO stores VALUES (4861, 'city4861');
+INSERT INTO stores VALUES (5131, 'city5131');
+INSERT INTO stores VALUES (5401, 'city5401');
+INSERT INTO stores VALUES (5671, 'city5671');
+INSERT INTO stores VALUES (5941, 'city5941');
+INSERT INTO stores VALUES (6211, 'city6211');
+INSERT INTO stores VALUES (6481, 'city6481');
+INSERT INTO stores VALUES (6751, 'city6751');
+INSERT INTO stores VALUES (7021, 'city7021');
+INSERT INTO stores VALUES (7291, 'city7291');
+INSERT INTO stores VALUES (7561, 'city7561');
+INSERT INTO stores VALUES (7831, 'city7831');
+INSERT INTO stores VALUES (8101, 'city8101');
@@ -0,0 +1,21 @@
+USE DATABASE shop;
+EXPLAIN ANALYZE SELECT id, store FROM sales WHERE store = 401;
+SELECT id, store FROM sales WHERE store = 401;
+EXPLAIN ANALYZE SELECT id, store FROM sales WHERE store = 401 OR store = 8190;
+SELECT id, store FROM sales WHERE store = 401 OR store = 8190;
+EXPLAIN ANALYZE SELECT id, store FROM sales WHERE store != 401 AND id < 3;
+SELECT id, store FROM sales WHERE store != 401 AND id < 3;
+EXPLAIN ANALYZE SELECT id, amount FROM sales WHERE amount = 500.625;
+SELECT id, amount FROM sales WHERE amount = 500.625;
+EXPLAIN ANALYZE SELECT id FROM sales WHERE amount = 500.3;
+SELECT id FROM sales WHERE amount = 500.3;
+EXPLAIN ANALYZE SELECT sales.id, stores.city FROM sales INNER JOIN stores ON sales.store = stores.id WHERE sales.id < 4000;
+SELECT sales.id, stores.city FROM sales INNER JOIN stores ON sales.store = stores.id WHERE sales.id < 4000;
+INSERT INTO sales VALUES (8192, 401, 1.0);
+UPDATE sales SET store = 402 WHERE id = 0;
+EXPLAIN ANALYZE SELECT id, store FROM sales WHERE store = 401;
+SELECT id, store FROM sales WHERE store = 401;
+EXPLAIN ANALYZE SELECT id, store FROM sales WHERE store = 402;
+SELECT id, store FROM sales WHERE store = 402;
+EXPLAIN ANALYZE SELECT id, store FROM sales WHERE store = 0;
+SELECT id, store FROM sales WHERE store = 0;
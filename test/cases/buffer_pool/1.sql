@@ -0,0 +1,12296 @@
+CREATE DATABASE shop;
+USE DATABASE shop;
+CREATE TABLE t (id INTEGER, grp INTEGER, price FLOAT, name TEXT);
+CREATE TABLE orders (id INTEGER, item_id INTEGER, qty INTEGER);
+INSERT INTO t VALUES (0, 0, 0.00, 'name0');
+INSERT INTO t VALUES (1, 1, 79.19, 'name1');
+INSERT INTO t VALUES (2, 2, 58.38, 'name2');
+INSERT INTO t VALUES (3, 3, 37.57, 'name3');
+INSERT INTO t VALUES (4, 4, 16.76, 'name4');
+INSERT INTO t VALUES (5, 5, 95.95, 'name5');
+INSERT INTO t VALUES (6, 6, 75.14, 'name6');
+INSERT INTO t VALUES (7, 7, 54.33, 'name7');
+INSERT INTO t VALUES (8, 8, 33.52, 'name8');
+INSERT INTO t VALUES (9, 9, 12.71, 'name9');
+INSERT INTO t VALUES (10, 0, 91.90, 'name10');
+INSERT INTO t VALUES (11, 1, 71.09, 'name11');
+INSERT INTO t VALUES (12, 2, 50.28, 'name12');
+INSERT INTO t VALUES (13, 3, 29.47, 'name13');
+INSERT INTO t VALUES (14, 4, 8.66, 'name14');
+INSERT INTO t VALUES (15, 5, 87.85, 'name15');
+INSERT INTO t VALUES (16, 6, 67.04, 'name16');
+INSERT INTO t VALUES (17, 7, 46.23, 'name17');
+INSERT INTO t VALUES (18, 8, 25.42, 'name18');
+INSERT INTO t VALUES (19, 9, 4.61, 'name19');
+INSERT INTO t VALUES (20, 0, 83.80, 'name20');
+INSERT INTO t VALUES (21, 1, 62.99, 'name21');
+INSERT INTO t VALUES (22, 2, 42.18, 'name22');
+INSERT INTO t VALUES (23, 3, 21.37, 'name23');
+INSERT INTO t VALUES (24, 4, 0.56, 'name24');
+INSERT INTO t VALUES (25, 5, 79.75, 'name25');
+INSERT INTO t VALUES (26, 6, 58.94, 'name26');
+INSERT INTO t VALUES (27, 7, 38.13, 'name27');
+INSERT INTO t VALUES (28, 8, 17.32, 'name28');
+INSERT INTO t VALUES (29, 9, 96.51, 'name29');
+INSERT INTO t VALUES (30, 0, 75.70, 'name30');
+INSERT INTO t VALUES (31, 1, 54.89, 'name31');
+INSERT INTO t VALUES (32, 2, 34.08, 'name32');
+INSERT INTO t VALUES (33, 3, 13.27, 'name33');
+INSERT INTO t VALUES (34, 4, 92.46, 'name34');
+INSERT INTO t VALUES (35, 5, 71.65, 'name35');
+INSERT INTO t VALUES (36, 6, 50.84, 'name36');
+INSERT INTO t VALUES (37, 7, 30.03, 'name37');
+INSERT INTO t VALUES (38, 8, 9.22, 'name38');
+INSERT INTO t VALUES (39, 9, 88.41, 'name39');
+INSERT INTO t VALUES (40, 0, 67.60, 'name40');
+INSERT INTO t VALUES (41, 1, 46.79, 'name41');
+INSERT INTO t VALUES (42, 2, 25.98, 'name42');
+INSERT INTO t VALUES (43, 3, 5.17, 'name43');
+INSERT INTO t VALUES (44, 4, 84.36, 'name44');
+INSERT INTO t VALUES (45, 5, 63.55, 'name45');
+INSERT INTO t VALUES (46, 6, 42.74, 'name46');
+INSERT INTO t VALUES (47, 7, 21.93, 'name47');
+INSERT INTO t VALUES (48, 8, 1.12, 'name48');
+INSERT INTO t VALUES (49, 9, 80.31, 'name49');
+INSERT INTO t VALUES (50, 0, 59.50, 'name50');
+INSERT INTO t VALUES (51, 1, 38.69, 'name51');
+INSERT INTO t VALUES (52, 2, 17.88, 'name52');
+INSERT INTO t VALUES (53, 3, 97.07, 'name53');
+INSERT INTO t VALUES (54, 4, 76.26, 'name54');
+INSERT INTO t VALUES (55, 5, 55.45, 'name55');
+INSERT INTO t VALUES (56, 6, 34.64, 'name56');
+INSERT INTO t VALUES (57, 7, 13.83, 'name57');
+INSERT INTO t VALUES (58, 8, 93.02, 'name58');
+INSERT INTO t VALUES (59, 9, 72.21, 'name59');
+INSERT INTO t VALUES (60, 0, 51.40, 'name60');
+INSERT INTO t VALUES (61, 1, 30.59, 'name61');
+INSERT INTO t VALUES (62, 2, 9.78, 'name62');
+INSERT INTO t VALUES (63, 3, 88.97, 'name63');
+INSERT INTO t VALUES (64, 4, 68.16, 'name64');
+INSERT INTO t VALUES (65, 5, 47.35, 'name65');
+INSERT INTO t VALUES (66, 6, 26.54, 'name66');
+INSERT INTO t VALUES (67, 7, 5.73, 'name67');
+INSERT INTO t VALUES (68, 8, 84.92, 'name68');
+INSERT INTO t VALUES (69, 9, 64.11, 'name69');
+INSERT INTO t VALUES (70, 0, 43.30, 'name70');
+INSERT INTO t VALUES (71, 1, 22.49, 'name71');
+INSERT INTO t VALUES (72, 2, 1.68, 'name72');
+INSERT INTO t VALUES (73, 3, 80.87, 'name73');
+INSERT INTO t VALUES (74, 4, 60.06, 'name74');
+INSERT INTO t VALUES (75, 5, 39.25, 'name75');
+INSERT INTO t VALUES (76, 6, 18.44, 'name76');
+INSERT INTO t VALUES (77, 7, 97.63, 'name77');
+INSERT INTO t VALUES (78, 8, 76.82, 'name78');
+INSERT INTO t VALUES (79, 9, 56.01, 'name79');
+INSERT INTO t VALUES (80, 0, 35.20, 'name80');
+INSERT INTO t VALUES (81, 1, 14.39, 'name81');
+INSERT INTO t VALUES (82, 2, 93.58, 'name82');
+INSERT INTO t VALUES (83, 3, 72.77, 'name83');
+INSERT INTO t VALUES (84, 4, 51.96, 'name84');
+INSERT INTO t VALUES (85, 5, 31.15, 'name85');
+INSERT INTO t VALUES (86, 6, 10.34, 'name86');
+INSERT INTO t VALUES (87, 7, 89.53, 'name87');
+INSERT INTO t VALUES (88, 8, 68.72, 'name88');
+INSERT INTO t VALUES (89, 9, 47.91, 'name89');
+INSERT INTO t VALUES (90, 0, 27.10, 'name90');
+INSERT INTO t VALUES (91, 1, 6.29, 'name91');
+INSERT INTO t VALUES (92, 2, 85.48, 'name92');
+INSERT INTO t VALUES (93, 3, 64.67, 'name93');
+INSERT INTO t VALUES (94, 4, 43.86, 'name94');
+INSERT INTO t VALUES (95, 5, 23.05, 'name95');
+INSERT INTO t VALUES (96, 6, 2.24, 'name96');
+INSERT INTO t VALUES (97, 7, 81.43, 'name97');
+INSERT INTO t VALUES (98, 8, 60.62, 'name98');
+INSERT INTO t VALUES (99, 9, 39.81, 'name99');
+INSERT INTO t VALUES (100, 0, 19.00, 'name100');
+INSERT INTO t VALUES (101, 1, 98.19, 'name101');
+INSERT INTO t VALUES (102, 2, 77.38, 'name102');
+INSERT INTO t VALUES (103, 3, 56.57, 'name103');
+INSERT INTO t VALUES (104, 4, 35.76, 'name104');
+INSERT INTO t VALUES (105, 5, 14.95, 'name105');
+INSERT INTO t VALUES (106, 6, 94.14, 'name106');
+INSERT INTO t VALUES (107, 7, 73.33, 'name107');
+INSERT INTO t VALUES (108, 8, 52.52, 'name108');
+INSERT INTO t VALUES (109, 9, 31.71, 'name109');
+INSERT INTO t VALUES (110, 0, 10.90, 'name110');
+INSERT INTO t VALUES (111, 1, 90.09, 'name111');
+INSERT INTO t VALUES (112, 2, 69.28, 'name112');
+INSERT INTO t VALUES (113, 3, 48.47, 'name113');
+INSERT INTO t VALUES (114, 4, 27.66, 'name114');
+INSERT INTO t VALUES (115, 5, 6.85, 'name115');
+INSERT INTO t VALUES (116, 6, 86.04, 'name116');
+INSERT INTO t VALUES (117, 7, 65.23, 'name117');
+INSERT INTO t VALUES (118, 8, 44.42, 'name118');
+INSERT INTO t VALUES (119, 9, 23.61, 'name119');
+INSERT INTO t VALUES (120, 0, 2.80, 'name120');
+INSERT INTO t VALUES (121, 1, 81.99, 'name121');
+INSERT INTO t VALUES (122, 2, 61.18, 'name122');
+INSERT INTO t VALUES (123, 3, 40.37, 'name123');
+INSERT INTO t VALUES (124, 4, 19.56, 'name124');
+INSERT INTO t VALUES (125, 5, 98.75, 'name125');
+INSERT INTO t VALUES (126, 6, 77.94, 'name126');
+INSERT INTO t VALUES (127, 7, 57.13, 'name127');
+INSERT INTO t VALUES (128, 8, 36.32, 'name128');
+INSERT INTO t VALUES (129, 9, 15.51, 'name129');
+INSERT INTO t VALUES (130, 0, 94.70, 'name130');
+INSERT INTO t VALUES (131, 1, 73.89, 'name131');
+INSERT INTO t VALUES (132, 2, 53.08, 'name132');
+INSERT INTO t VALUES (133, 3, 32.27, 'name133');
+INSERT INTO t VALUES (134, 4, 11.46, 'name134');
+INSERT INTO t VALUES (135, 5, 90.65, 'name135');
+INSERT INTO t VALUES (136, 6, 69.84, 'name136');
+INSERT INTO t VALUES (137, 7, 49.03, 'name137');
+INSERT INTO t VALUES (138, 8, 28.22, 'name138');
+INSERT INTO t VALUES (139, 9, 7.41, 'name139');
+INSERT INTO t VALUES (140, 0, 86.60, 'name140');
+INSERT INTO t VALUES (141, 1, 65.79, 'name141');
+INSERT INTO t VALUES (142, 2, 44.98, 'name142');
+INSERT INTO t VALUES (143, 3, 24.17, 'name143');
+INSERT INTO t VALUES (144, 4, 3.36, 'name144');
+INSERT INTO t VALUES (145, 5, 82.55, 'name145');
+INSERT INTO t VALUES (146, 6, 61.74, 'name146');
+INSERT INTO t VALUES (147, 7, 40.93, 'name147');
+INSERT INTO t VALUES (148, 8, 20.12, 'name148');
+INSERT INTO t VALUES (149, 9, 99.31, 'name149');
+INSERT INTO t VALUES (150, 0, 78.50, 'name150');
+INSERT INTO t VALUES (151, 1, 57.69, 'name151');
+INSERT INTO t VALUES (152, 2, 36.88, 'name152');
+INSERT INTO t VALUES (153, 3, 16.07, 'name153');
+INSERT INTO t VALUES (154, 4, 95.26, 'name154');
+INSERT INTO t VALUES (155, 5, 74.45, 'name155');
+INSERT INTO t VALUES (156, 6, 53.64, 'name156');
+INSERT INTO t VALUES (157, 7, 32.83, 'name157');
+INSERT INTO t VALUES (158, 8, 12.02, 'name158');
+INSERT INTO t VALUES (159, 9, 91.21, 'name159');
+INSERT INTO t VALUES (160, 0, 70.40, 'name160');
+INSERT INTO t VALUES (161, 1, 49.59, 'name161');
+INSERT INTO t VALUES (162, 2, 28.78, 'name162');
+INSERT INTO t VALUES (163, 3, 7.97, 'name163');
+INSERT INTO t VALUES (164, 4, 87.16, 'name164');
+INSERT INTO t VALUES (165, 5, 66.35, 'name165');
+INSERT INTO t VALUES (166, 6, 45.54, 'name166');
+INSERT INTO t VALUES (167, 7, 24.73, 'name167');
+INSERT INTO t VALUES (168, 8, 3.92, 'name168');
+INSERT INTO t VALUES (169, 9, 83.11, 'name169');
+INSERT INTO t VALUES (170, 0, 62.30, 'name170');
+INSERT INTO t VALUES (171, 1, 41.49, 'name171');
+INSERT INTO t VALUES (172, 2, 20.68, 'name172');
+INSERT INTO t VALUES (173, 3, 99.87, 'name173');
+INSERT INTO t VALUES (174, 4, 79.06, 'name174');
+INSERT INTO t VALUES (175, 5, 58.25, 'name175');
+INSERT INTO t VALUES (176, 6, 37.44, 'name176');
+INSERT INTO t VALUES (177, 7, 16.63, 'name177');
+INSERT INTO t VALUES (178, 8, 95.82, 'name178');
+INSERT INTO t VALUES (179, 9, 75.01, 'name179');
+INSERT INTO t VALUES (180, 0, 54.20, 'name180');
+INSERT INTO t VALUES (181, 1, 33.39, 'name181');
+INSERT INTO t VALUES (182, 2, 12.58, 'name182');
+INSERT INTO t VALUES (183, 3, 91.77, 'name183');
+INSERT INTO t VALUES (184, 4, 70.96, 'name184');
+INSERT INTO t VALUES (185, 5, 50.15, 'name185');
+INSERT INTO t VALUES (186, 6, 29.34, 'name186');
+INSERT INTO t VALUES (187, 7, 8.53, 'name187');
+INSERT INTO t VALUES (188, 8, 87.72, 'name188');
+INSERT INTO t VALUES (189, 9, 66.91, 'name189');
+INSERT INTO t VALUES (190, 0, 46.10, 'name190');
+INSERT INTO t VALUES (191, 1, 25.29, 'name191');
+INSERT INTO t VALUES (192, 2, 4.48, 'name192');
+INSERT INTO t VALUES (193, 3, 83.67, 'name193');
+INSERT INTO t VALUES (194, 4, 62.86, 'name194');
+INSERT INTO t VALUES (195, 5, 42.05, 'name195');
+INSERT INTO t VALUES (196, 6, 21.24, 'name196');
+INSERT INTO t VALUES (197, 7, 0.43, 'name197');
+INSERT INTO t VALUES (198, 8, 79.62, 'name198');
+INSERT INTO t VALUES (199, 9, 58.81, 'name199');
+INSERT INTO t VALUES (200, 0, 38.00, 'name200');
+INSERT INTO t VALUES (201, 1, 17.19, 'name201');
+INSERT INTO t VALUES (202, 2, 96.38, 'name202');
+INSERT INTO t VALUES (203, 3, 75.57, 'name203');
+INSERT INTO t VALUES (204, 4, 54.76, 'name204');
+INSERT INTO t VALUES (205, 5, 33.95, 'name205');
+INSERT INTO t VALUES (206, 6, 13.14, 'name206');
+INSERT INTO t VALUES (207, 7, 92.33, 'name207');
+INSERT INTO t VALUES (208, 8, 71.52, 'name208');
+INSERT INTO t VALUES (209, 9, 50.71, 'name209');
+INSERT INTO t VALUES (210, 0, 29.90, 'name210');
+INSERT INTO t VALUES (211, 1, 9.09, 'name211');
+INSERT INTO t VALUES (212, 2, 88.28, 'name212');
+INSERT INTO t VALUES (213, 3, 67.47, 'name213');
+INSERT INTO t VALUES (214, 4, 46.66, 'name214');
+INSERT INTO t VALUES (215, 5, 25.85, 'name215');
+INSERT INTO t VALUES (216, 6, 5.04, 'name216');
+INSERT INTO t VALUES (217, 7, 84.23, 'name217');
+INSERT INTO t VALUES (218, 8, 63.42, 'name218');
+INSERT INTO t VALUES (219, 9, 42.61, 'name219');
+INSERT INTO t VALUES (220, 0, 21.80, 'name220');
+INSERT INTO t VALUES (221, 1, 0.99, 'name221');
+INSERT INTO t VALUES (222, 2, 80.18, 'name222');
+INSERT INTO t VALUES (223, 3, 59.37, 'name223');
+INSERT INTO t VALUES (224, 4, 38.56, 'name224');
+INSERT INTO t VALUES (225, 5, 17.75, 'name225');
+INSERT INTO t VALUES (226, 6, 96.94, 'name226');
+INSERT INTO t VALUES (227, 7, 76.13, 'name227');
+INSERT INTO t VALUES (228, 8, 55.32, 'name228');
+INSERT INTO t VALUES (229, 9, 34.51, 'name229');
+INSERT INTO t VALUES (230, 0, 13.70, 'name230');
+INSERT INTO t VALUES (231, 1, 92.89, 'name231');
+INSERT INTO t VALUES (232, 2, 72.08, 'name232');
+INSERT INTO t VALUES (233, 3, 51.27, 'name233');
+INSERT INTO t VALUES (234, 4, 30.46, 'name234');
+INSERT INTO t VALUES (235, 5, 9.65, 'name235');
+INSERT INTO t VALUES (236, 6, 88.84, 'name236');
+INSERT INTO t VALUES (237, 7, 68.03, 'name237');
+INSERT INTO t VALUES (238, 8, 47.22, 'name238');
+INSERT INTO t VALUES (239, 9, 26.41, 'name239');
+INSERT INTO t VALUES (240, 0, 5.60, 'name240');
+INSERT INTO t VALUES (241, 1, 84.79, 'name241');
+INSERT INTO t VALUES (242, 2, 63.98, 'name242');
+INSERT INTO t VALUES (243, 3, 43.17, 'name243');
+INSERT INTO t VALUES (244, 4, 22.36, 'name244');
+INSERT INTO t VALUES (245, 5, 1.55, 'name245');
+INSERT INTO t VALUES (246, 6, 80.74, 'name246');
+INSERT INTO t VALUES (247, 7, 59.93, 'name247');
+INSERT INTO t VALUES (248, 8, 39.12, 'name248');
+INSERT INTO t VALUES (249, 9, 18.31, 'name249');
+INSERT INTO t VALUES (250, 0, 97.50, 'name250');
+INSERT INTO t VALUES (251, 1, 76.69, 'name251');
+INSERT INTO t VALUES (252, 2, 55.88, 'name252');
+INSERT INTO t VALUES (253, 3, 35.07, 'name253');
+INSERT INTO t VALUES (254, 4, 14.26, 'name254');
+INSERT INTO t VALUES (255, 5, 93.45, 'name255');
+INSERT INTO t VALUES (256, 6, 72.64, 'name256');
+INSERT INTO t VALUES (257, 7, 51.83, 'name257');
+INSERT INTO t VALUES (258, 8, 31.02, 'name258');
+INSERT INTO t VALUES (259, 9, 10.21, 'name259');
+INSERT INTO t VALUES (260, 0, 89.40, 'name260');
+INSERT INTO t VALUES (261, 1, 68.59, 'name261');
+INSERT INTO t VALUES (262, 2, 47.78, 'name262');
+INSERT INTO t VALUES (263, 3, 26.97, 'name263');
+INSERT INTO t VALUES (264, 4, 6.16, 'name264');
+INSERT INTO t VALUES (265, 5, 85.35, 'name265');
+INSERT INTO t VALUES (266, 6, 64.54, 'name266');
+INSERT INTO t VALUES (267, 7, 43.73, 'name267');
+INSERT INTO t VALUES (268, 8, 22.92, 'name268');
+INSERT INTO t VALUES (269, 9, 2.11, 'name269');
+INSERT INTO t VALUES (270, 0, 81.30, 'name270');
+INSERT INTO t VALUES (271, 1, 60.49, 'name271');
+INSERT INTO t VALUES (272, 2, 39.68, 'name272');
+INSERT INTO t VALUES (273, 3, 18.87, 'name273');
+INSERT INTO t VALUES (274, 4, 98.06, 'name274');
+INSERT INTO t VALUES (275, 5, 77.25, 'name275');
+INSERT INTO t VALUES (276, 6, 56.44, 'name276');
+INSERT INTO t VALUES (277, 7, 35.63, 'name277');
+INSERT INTO t VALUES (278, 8, 14.82, 'name278');
+INSERT INTO t VALUES (279, 9, 94.01, 'name279');
+INSERT INTO t VALUES (280, 0, 73.20, 'name280');
+INSERT INTO t VALUES (281, 1, 52.39, 'name281');
+INSERT INTO t VALUES (282, 2, 31.58, 'name282');
+INSERT INTO t VALUES (283, 3, 10.77, 'name283');
+INSERT INTO t VALUES (284, 4, 89.96, 'name284');
+INSERT INTO t VALUES (285, 5, 69.15, 'name285');
+INSERT INTO t VALUES (286, 6, 48.34, 'name286');
+INSERT INTO t VALUES (287, 7, 27.53, 'name287');
+INSERT INTO t VALUES (288, 8, 6.72, 'name288');
+INSERT INTO t VALUES (289, 9, 85.91, 'name289');
+INSERT INTO t VALUES (290, 0, 65.10, 'name290');
+INSERT INTO t VALUES (291, 1, 44.29, 'name291');
+INSERT INTO t VALUES (292, 2, 23.48, 'name292');
+INSERT INTO t VALUES (293, 3, 2.67, 'name293');
+INSERT INTO t VALUES (294, 4, 81.86, 'name294');
+INSERT INTO t VALUES (295, 5, 61.05, 'name295');
+INSERT INTO t VALUES (296, 6, 40.24, 'name296');
+INSERT INTO t VALUES (297, 7, 19.43, 'name297');
+INSERT INTO t VALUES (298, 8, 98.62, 'name298');
+INSERT INTO t VALUES (299, 9, 77.81, 'name299');
+INSERT INTO t VALUES (300, 0, 57.00, 'name300');
+INSERT INTO t VALUES (301, 1, 36.19, 'name301');
+INSERT INTO t VALUES (302, 2, 15.38, 'name302');
+INSERT INTO t VALUES (303, 3, 94.57, 'name303');
+INSERT INTO t VALUES (304, 4, 73.76, 'name304');
+INSERT INTO t VALUES (305, 5, 52.95, 'name305');
+INSERT INTO t VALUES (306, 6, 32.14, 'name306');
+INSERT INTO t VALUES (307, 7, 11.33, 'name307');
+INSERT INTO t VALUES (308, 8, 90.52, 'name308');
+INSERT INTO t VALUES (309, 9, 69.71, 'name309');
+INSERT INTO t VALUES (310, 0, 48.90, 'name310');
+INSERT INTO t VALUES (311, 1, 28.09, 'name311');
+INSERT INTO t VALUES (312, 2, 7.28, 'name312');
+INSERT INTO t VALUES (313, 3, 86.47, 'name313');
+INSERT INTO t VALUES (314, 4, 65.66, 'name314');
+INSERT INTO t VALUES (315, 5, 44.85, 'name315');
+INSERT INTO t VALUES (316, 6, 24.04, 'name316');
+INSERT INTO t VALUES (317, 7, 3.23, 'name317');
+INSERT INTO t VALUES (318, 8, 82.42, 'name318');
+INSERT INTO t VALUES (319, 9, 61.61, 'name319');
+INSERT INTO t VALUES (320, 0, 40.80, 'name320');
+INSERT INTO t VALUES (321, 1, 19.99, 'name321');
+INSERT INTO t VALUES (322, 2, 99.18, 'name322');
+INSERT INTO t VALUES (323, 3, 78.37, 'name323');
+INSERT INTO t VALUES (324, 4, 57.56, 'name324');
+INSERT INTO t VALUES (325, 5, 36.75, 'name325');
+INSERT INTO t VALUES (326, 6, 15.94, 'name326');
+INSERT INTO t VALUES (327, 7, 95.13, 'name327');
+INSERT INTO t VALUES (328, 8, 74.32, 'name328');
+INSERT INTO t VALUES (329, 9, 53.51, 'name329');
+INSERT INTO t VALUES (330, 0, 32.70, 'name330');
+INSERT INTO t VALUES (331, 1, 11.89, 'name331');
+INSERT INTO t VALUES (332, 2, 91.08, 'name332');
+INSERT INTO t VALUES (333, 3, 70.27, 'name333');
+INSERT INTO t VALUES (334, 4, 49.46, 'name334');
+INSERT INTO t VALUES (335, 5, 28.65, 'name335');
+INSERT INTO t VALUES (336, 6, 7.84, 'name336');
+INSERT INTO t VALUES (337, 7, 87.03, 'name337');
+INSERT INTO t VALUES (338, 8, 66.22, 'name338');
+INSERT INTO t VALUES (339, 9, 45.41, 'name339');
+INSERT INTO t VALUES (340, 0, 24.60, 'name340');
+INSERT INTO t VALUES (341, 1, 3.79, 'name341');
+INSERT INTO t VALUES (342, 2, 82.98, 'name342');
+INSERT INTO t VALUES (343, 3, 62.17, 'name343');
+INSERT INTO t VALUES (344, 4, 41.36, 'name344');
+INSERT INTO t VALUES (345, 5, 20.55, 'name345');
+INSERT INTO t VALUES (346, 6, 99.74, 'name346');
+INSERT INTO t VALUES (347, 7, 78.93, 'name347');
+INSERT INTO t VALUES (348, 8, 58.12, 'name348');
+INSERT INTO t VALUES (349, 9, 37.31, 'name349');
+INSERT INTO t VALUES (350, 0, 16.50, 'name350');
+INSERT INTO t VALUES (351, 1, 95.69, 'name351');
+INSERT INTO t VALUES (352, 2, 74.88, 'name352');
+INSERT INTO t VALUES (353, 3, 54.07, 'name353');
+INSERT INTO t VALUES (354, 4, 33.26, 'name354');
+INSERT INTO t VALUES (355, 5, 12.45, 'name355');
+INSERT INTO t VALUES (356, 6, 91.64, 'name356');
+INSERT INTO t VALUES (357, 7, 70.83, 'name357');
+INSERT INTO t VALUES (358, 8, 50.02, 'name358');
+INSERT INTO t VALUES (359, 9, 29.21, 'name359');
+INSERT INTO t VALUES (360, 0, 8.40, 'name360');
+INSERT INTO t VALUES (361, 1, 87.59, 'name361');
+INSERT INTO t VALUES (362, 2, 66.78, 'name362');
+INSERT INTO t VALUES (363, 3, 45.97, 'name363');
+INSERT INTO t VALUES (364, 4, 25.16, 'name364');
+INSERT INTO t VALUES (365, 5, 4.35, 'name365');
+INSERT INTO t VALUES (366, 6, 83.54, 'name366');
+INSERT INTO t VALUES (367, 7, 62.73, 'name367');
+INSERT INTO t VALUES (368, 8, 41.92, 'name368');
+INSERT INTO t VALUES (369, 9, 21.11, 'name369');
+INSERT INTO t VALUES (370, 0, 0.30, 'name370');
+INSERT INTO t VALUES (371, 1, 79.49, 'name371');
+INSERT INTO t VALUES (372, 2, 58.68, 'name372');
+INSERT INTO t VALUES (373, 3, 37.87, 'name373');
+INSERT INTO t VALUES (374, 4, 17.06, 'name374');
+INSERT INTO t VALUES (375, 5, 96.25, 'name375');
+INSERT INTO t VALUES (376, 6, 75.44, 'name376');
+INSERT INTO t VALUES (377, 7, 54.63, 'name377');
+INSERT INTO t VALUES (378, 8, 33.82, 'name378');
+INSERT INTO t VALUES (379, 9, 13.01, 'name379');
+INSERT INTO t VALUES (380, 0, 92.20, 'name380');
+INSERT INTO t VALUES (381, 1, 71.39, 'name381');
+INSERT INTO t VALUES (382, 2, 50.58, 'name382');
+INSERT INTO t VALUES (383, 3, 29.77, 'name383');
+INSERT INTO t VALUES (384, 4, 8.96, 'name384');
+INSERT INTO t VALUES (385, 5, 88.15, 'name385');
+INSERT INTO t VALUES (386, 6, 67.34, 'name386');
+INSERT INTO t VALUES (387, 7, 46.53, 'name387');
+INSERT INTO t VALUES (388, 8, 25.72, 'name388');
+INSERT INTO t VALUES (389, 9, 4.91, 'name389');
+INSERT INTO t VALUES (390, 0, 84.10, 'name390');
+INSERT INTO t VALUES (391, 1, 63.29, 'name391');
+INSERT INTO t VALUES (392, 2, 42.48, 'name392');
+INSERT INTO t VALUES (393, 3, 21.67, 'name393');
+INSERT INTO t VALUES (394, 4, 0.86, 'name394');
+INSERT INTO t VALUES (395, 5, 80.05, 'name395');
+INSERT INTO t VALUES (396, 6, 59.24, 'name396');
+INSERT INTO t VALUES (397, 7, 38.43, 'name397');
+INSERT INTO t VALUES (398, 8, 17.62, 'name398');
+INSERT INTO t VALUES (399, 9, 96.81, 'name399');
+INSERT INTO t VALUES (400, 0, 76.00, 'name400');
+INSERT INTO t VALUES (401, 1, 55.19, 'name401');
+INSERT INTO t VALUES (402, 2, 34.38, 'name402');
+INSERT INTO t VALUES (403, 3, 13.57, 'name403');
+INSERT INTO t VALUES (404, 4, 92.76, 'name404');
+INSERT INTO t VALUES (405, 5, 71.95, 'name405');
+INSERT INTO t VALUES (406, 6, 51.14, 'name406');
+INSERT INTO t VALUES (407, 7, 30.33, 'name407');
+INSERT INTO t VALUES (408, 8, 9.52, 'name408');
+INSERT INTO t VALUES (409, 9, 88.71, 'name409');
+INSERT INTO t VALUES (410, 0, 67.90, 'name410');
+INSERT INTO t VALUES (411, 1, 47.09, 'name411');
+INSERT INTO t VALUES (412, 2, 26.28, 'name412');
+INSERT INTO t VALUES (413, 3, 5.47, 'name413');
+INSERT INTO t VALUES (414, 4, 84.66, 'name414');
+INSERT INTO t VALUES (415, 5, 63.85, 'name415');
+INSERT INTO t VALUES (416, 6, 43.04, 'name416');
+INSERT INTO t VALUES (417, 7, 22.23, 'name417');
+INSERT INTO t VALUES (418, 8, 1.42, 'name418');
+INSERT INTO t VALUES (419, 9, 80.61, 'name419');
+INSERT INTO t VALUES (420, 0, 59.80, 'name420');
+INSERT INTO t VALUES (421, 1, 38.99, 'name421');
+INSERT INTO t VALUES (422, 2, 18.18, 'name422');
+INSERT INTO t VALUES (423, 3, 97.37, 'name423');
+INSERT INTO t VALUES (424, 4, 76.56, 'name424');
+INSERT INTO t VALUES (425, 5, 55.75, 'name425');
+INSERT INTO t VALUES (426, 6, 34.94, 'name426');
+INSERT INTO t VALUES (427, 7, 14.13, 'name427');
+INSERT INTO t VALUES (428, 8, 93.32, 'name428');
+INSERT INTO t VALUES (429, 9, 72.51, 'name429');
+INSERT INTO t VALUES (430, 0, 51.70, 'name430');
+INSERT INTO t VALUES (431, 1, 30.89, 'name431');
+INSERT INTO t VALUES (432, 2, 10.08, 'name432');
+INSERT INTO t VALUES (433, 3, 89.27, 'name433');
+INSERT INTO t VALUES (434, 4, 68.46, 'name434');
+INSERT INTO t VALUES (435, 5, 47.65, 'name435');
+INSERT INTO t VALUES (436, 6, 26.84, 'name436');
+INSERT INTO t VALUES (437, 7, 6.03, 'name437');
+INSERT INTO t VALUES (438, 8, 85.22, 'name438');
+INSERT INTO t VALUES (439, 9, 64.41, 'name439');
+INSERT INTO t VALUES (440, 0, 43.60, 'name440');
+INSERT INTO t VALUES (441, 1, 22.79, 'name441');
+INSERT INTO t VALUES (442, 2, 1.98, 'name442');
+INSERT INTO t VALUES (443, 3, 81.17, 'name443');
+INSERT INTO t VALUES (444, 4, 60.36, 'name444');
+INSERT INTO t VALUES (445, 5, 39.55, 'name445');
+INSERT INTO t VALUES (446, 6, 18.74, 'name446');
+INSERT INTO t VALUES (447, 7, 97.93, 'name447');
+INSERT INTO t VALUES (448, 8, 77.12, 'name448');
+INSERT INTO t VALUES (449, 9, 56.31, 'name449');
+INSERT INTO t VALUES (450, 0, 35.50, 'name450');
+INSERT INTO t VALUES (451, 1, 14.69, 'name451');
+INSERT INTO t VALUES (452, 2, 93.88, 'name452');
+INSERT INTO t VALUES (453, 3, 73.07, 'name453');
+INSERT INTO t VALUES (454, 4, 52.26, 'name454');
+INSERT INTO t VALUES (455, 5, 31.45, 'name455');
+INSERT INTO t VALUES (456, 6, 10.64, 'name456');
+INSERT INTO t VALUES (457, 7, 89.83, 'name457');
+INSERT INTO t VALUES (458, 8, 69.02, 'name458');
+INSERT INTO t VALUES (459, 9, 48.21, 'name459');
+INSERT INTO t VALUES (460, 0, 27.40, 'name460');
+INSERT INTO t VALUES (461, 1, 6.59, 'name461');
+INSERT INTO t VALUES (462, 2, 85.78, 'name462');
+INSERT INTO t VALUES (463, 3, 64.97, 'name463');
+INSERT INTO t VALUES (464, 4, 44.16, 'name464');
+INSERT INTO t VALUES (465, 5, 23.35, 'name465');
+INSERT INTO t VALUES (466, 6, 2.54, 'name466');
+INSERT INTO t VALUES (467, 7, 81.73, 'name467');
+INSERT INTO t VALUES (468, 8, 60.92, 'name468');
+INSERT INTO t VALUES (469, 9, 40.11, 'name469');
+INSERT INTO t VALUES (470, 0, 19.30, 'name470');
+INSERT INTO t VALUES (471, 1, 98.49, 'name471');
+INSERT INTO t VALUES (472, 2, 77.68, 'name472');
+INSERT INTO t VALUES (473, 3, 56.87, 'name473');
+INSERT INTO t VALUES (474, 4, 36.06, 'name474');
+INSERT INTO t VALUES (475, 5, 15.25, 'name475');
+INSERT INTO t VALUES (476, 6, 94.44, 'name476');
+INSERT INTO t VALUES (477, 7, 73.63, 'name477');
+INSERT INTO t VALUES (478, 8, 52.82, 'name478');
+INSERT INTO t VALUES (479, 9, 32.01, 'name479');
+INSERT INTO t VALUES (480, 0, 11.20, 'name480');
+INSERT INTO t VALUES (481, 1, 90.39, 'name481');
+INSERT INTO t VALUES (482, 2, 69.58, 'name482');
+INSERT INTO t VALUES (483, 3, 48.77, 'name483');
+INSERT INTO t VALUES (484, 4, 27.96, 'name484');
+INSERT INTO t VALUES (485, 5, 7.15, 'name485');
+INSERT INTO t VALUES (486, 6, 86.34, 'name486');
+INSERT INTO t VALUES (487, 7, 65.53, 'name487');
+INSERT INTO t VALUES (488, 8, 44.72, 'name488');
+INSERT INTO t VALUES (489, 9, 23.91, 'name489');
+INSERT INTO t VALUES (490, 0, 3.10, 'name490');
+INSERT INTO t VALUES (491, 1, 82.29, 'name491');
+INSERT INTO t VALUES (492, 2, 61.48, 'name492');
+INSERT INTO t VALUES (493, 3, 40.67, 'name493');
+INSERT INTO t VALUES (494, 4, 19.86, 'name494');
+INSERT INTO t VALUES (495, 5, 99.05, 'name495');
+INSERT INTO t VALUES (496, 6, 78.24, 'name496');
+INSERT INTO t VALUES (497, 7, 57.43, 'name497');
+INSERT INTO t VALUES (498, 8, 36.62, 'name498');
+INSERT INTO t VALUES (499, 9, 15.81, 'name499');
+INSERT INTO t VALUES (500, 0, 95.00, 'name500');
+INSERT INTO t VALUES (501, 1, 74.19, 'name501');
+INSERT INTO t VALUES (502, 2, 53.38, 'name502');
+INSERT INTO t VALUES (503, 3, 32.57, 'name503');
+INSERT INTO t VALUES (504, 4, 11.76, 'name504');
+INSERT INTO t VALUES (505, 5, 90.95, 'name505');
+INSERT INTO t VALUES (506, 6, 70.14, 'name506');
+INSERT INTO t VALUES (507, 7, 49.33, 'name507');
+INSERT INTO t VALUES (508, 8, 28.52, 'name508');
+INSERT INTO t VALUES (509, 9, 7.71, 'name509');
+INSERT INTO t VALUES (510, 0, 86.90, 'name510');
+INSERT INTO t VALUES (511, 1, 66.09, 'name511');
+INSERT INTO t VALUES (512, 2, 45.28, 'name512');
+INSERT INTO t VALUES (513, 3, 24.47, 'name513');
+INSERT INTO t VALUES (514, 4, 3.66, 'name514');
+INSERT INTO t VALUES (515, 5, 82.85, 'name515');
+INSERT INTO t VALUES (516, 6, 62.04, 'name516');
+INSERT INTO t VALUES (517, 7, 41.23, 'name517');
+INSERT INTO t VALUES (518, 8, 20.42, 'name518');
+INSERT INTO t VALUES (519, 9, 99.61, 'name519');
+INSERT INTO t VALUES (520, 0, 78.80, 'name520');
+INSERT INTO t VALUES (521, 1, 57.99, 'name521');
+INSERT INTO t VALUES (522, 2, 37.18, 'name522');
+INSERT INTO t VALUES (523, 3, 16.37, 'name523');
+INSERT INTO t VALUES (524, 4, 95.56, 'name524');
+INSERT INTO t VALUES (525, 5, 74.75, 'name525');
+INSERT INTO t VALUES (526, 6, 53.94, 'name526');
+INSERT INTO t VALUES (527, 7, 33.13, 'name527');
+INSERT INTO t VALUES (528, 8, 12.32, 'name528');
+INSERT INTO t VALUES (529, 9, 91.51, 'name529');
+INSERT INTO t VALUES (530, 0, 70.70, 'name530');
+INSERT INTO t VALUES (531, 1, 49.89, 'name531');
+INSERT INTO t VALUES (532, 2, 29.08, 'name532');
+INSERT INTO t VALUES (533, 3, 8.27, 'name533');
+INSERT INTO t VALUES (534, 4, 87.46, 'name534');
+INSERT INTO t VALUES (535, 5, 66.65, 'name535');
+INSERT INTO t VALUES (536, 6, 45.84, 'name536');
+INSERT INTO t VALUES (537, 7, 25.03, 'name537');
+INSERT INTO t VALUES (538, 8, 4.22, 'name538');
+INSERT INTO t VALUES (539, 9, 83.41, 'name539');
+INSERT INTO t VALUES (540, 0, 62.60, 'name540');
+INSERT INTO t VALUES (541, 1, 41.79, 'name541');
+INSERT INTO t VALUES (542, 2, 20.98, 'name542');
+INSERT INTO t VALUES (543, 3, 0.17, 'name543');
+INSERT INTO t VALUES (544, 4, 79.36, 'name544');
+INSERT INTO t VALUES (545, 5, 58.55, 'name545');
+INSERT INTO t VALUES (546, 6, 37.74, 'name546');
+INSERT INTO t VALUES (547, 7, 16.93, 'name547');
+INSERT INTO t VALUES (548, 8, 96.12, 'name548');
+INSERT INTO t VALUES (549, 9, 75.31, 'name549');
+INSERT INTO t VALUES (550, 0, 54.50, 'name550');
+INSERT INTO t VALUES (551, 1, 33.69, 'name551');
+INSERT INTO t VALUES (552, 2, 12.88, 'name552');
+INSERT INTO t VALUES (553, 3, 92.07, 'name553');
+INSERT INTO t VALUES (554, 4, 71.26, 'name554');
+INSERT INTO t VALUES (555, 5, 50.45, 'name555');
+INSERT INTO t VALUES (556, 6, 29.64, 'name556');
+INSERT INTO t VALUES (557, 7, 8.83, 'name557');
+INSERT INTO t VALUES (558, 8, 88.02, 'name558');
+INSERT INTO t VALUES (559, 9, 67.21, 'name559');
+INSERT INTO t VALUES (560, 0, 46.40, 'name560');
+INSERT INTO t VALUES (561, 1, 25.59, 'name561');
+INSERT INTO t VALUES (562, 2, 4.78, 'name562');
+INSERT INTO t VALUES (563, 3, 83.97, 'name563');
+INSERT INTO t VALUES (564, 4, 63.16, 'name564');
+INSERT INTO t VALUES (565, 5, 42.35, 'name565');
+INSERT INTO t VALUES (566, 6, 21.54, 'name566');
+INSERT INTO t VALUES (567, 7, 0.73, 'name567');
+INSERT INTO t VALUES (568, 8, 79.92, 'name568');
+INSERT INTO t VALUES (569, 9, 59.11, 'name569');
+INSERT INTO t VALUES (570, 0, 38.30, 'name570');
+INSERT INTO t VALUES (571, 1, 17.49, 'name571');
+INSERT INTO t VALUES (572, 2, 96.68, 'name572');
+INSERT INTO t VALUES (573, 3, 75.87, 'name573');
+INSERT INTO t VALUES (574, 4, 55.06, 'name574');
+INSERT INTO t VALUES (575, 5, 34.25, 'name575');
+INSERT INTO t VALUES (576, 6, 13.44, 'name576');
+INSERT INTO t VALUES (577, 7, 92.63, 'name577');
+INSERT INTO t VALUES (578, 8, 71.82, 'name578');
+INSERT INTO t VALUES (579, 9, 51.01, 'name579');
+INSERT INTO t VALUES (580, 0, 30.20, 'name580');
+INSERT INTO t VALUES (581, 1, 9.39, 'name581');
+INSERT INTO t VALUES (582, 2, 88.58, 'name582');
+INSERT INTO t VALUES (583, 3, 67.77, 'name583');
+INSERT INTO t VALUES (584, 4, 46.96, 'name584');
+INSERT INTO t VALUES (585, 5, 26.15, 'name585');
+INSERT INTO t VALUES (586, 6, 5.34, 'name586');
+INSERT INTO t VALUES (587, 7, 84.53, 'name587');
+INSERT INTO t VALUES (588, 8, 63.72, 'name588');
+INSERT INTO t VALUES (589, 9, 42.91, 'name589');
+INSERT INTO t VALUES (590, 0, 22.10, 'name590');
+INSERT INTO t VALUES (591, 1, 1.29, 'name591');
+INSERT INTO t VALUES (592, 2, 80.48, 'name592');
+INSERT INTO t VALUES (593, 3, 59.67, 'name593');
+INSERT INTO t VALUES (594, 4, 38.86, 'name594');
+INSERT INTO t VALUES (595, 5, 18.05, 'name595');
+INSERT INTO t VALUES (596, 6, 97.24, 'name596');
+INSERT INTO t VALUES (597, 7, 76.43, 'name597');
+INSERT INTO t VALUES (598, 8, 55.62, 'name598');
+INSERT INTO t VALUES (599, 9, 34.81, 'name599');
+INSERT INTO t VALUES (600, 0, 14.00, 'name600');
+INSERT INTO t VALUES (601, 1, 93.19, 'name601');
+INSERT INTO t VALUES (602, 2, 72.38, 'name602');
+INSERT INTO t VALUES (603, 3, 51.57, 'name603');
+INSERT INTO t VALUES (604, 4, 30.76, 'name604');
+INSERT INTO t VALUES (605, 5, 9.95, 'name605');
+INSERT INTO t VALUES (606, 6, 89.14, 'name606');
+INSERT INTO t VALUES (607, 7, 68.33, 'name607');
+INSERT INTO t VALUES (608, 8, 47.52, 'name608');
+INSERT INTO t VALUES (609, 9, 26.71, 'name609');
+INSERT INTO t VALUES (610, 0, 5.90, 'name610');
+INSERT INTO t VALUES (611, 1, 85.09, 'name611');
+INSERT INTO t VALUES (612, 2, 64.28, 'name612');
+INSERT INTO t VALUES (613, 3, 43.47, 'name613');
+INSERT INTO t VALUES (614, 4, 22.66, 'name614');
+INSERT INTO t VALUES (615, 5, 1.85, 'name615');
+INSERT INTO t VALUES (616, 6, 81.04, 'name616');
+INSERT INTO t VALUES (617, 7, 60.23, 'name617');
+INSERT INTO t VALUES (618, 8, 39.42, 'name618');
+INSERT INTO t VALUES (619, 9, 18.61, 'name619');
+INSERT INTO t VALUES (620, 0, 97.80, 'name620');
+INSERT INTO t VALUES (621, 1, 76.99, 'name621');
+INSERT INTO t VALUES (622, 2, 56.18, 'name622');
+INSERT INTO t VALUES (623, 3, 35.37, 'name623');
+INSERT INTO t VALUES (624, 4, 14.56, 'name624');
+INSERT INTO t VALUES (625, 5, 93.75, 'name625');
+INSERT INTO t VALUES (626, 6, 72.94, 'name626');
+INSERT INTO t VALUES (627, 7, 52.13, 'name627');
+INSERT INTO t VALUES (628, 8, 31.32, 'name628');
+INSERT INTO t VALUES (629, 9, 10.51, 'name629');
+INSERT INTO t VALUES (630, 0, 89.70, 'name630');
+INSERT INTO t VALUES (631, 1, 68.89, 'name631');
+INSERT INTO t VALUES (632, 2, 48.08, 'name632');
+INSERT INTO t VALUES (633, 3, 27.27, 'name633');
+INSERT INTO t VALUES (634, 4, 6.46, 'name634');
+INSERT INTO t VALUES (635, 5, 85.65, 'name635');
+INSERT INTO t VALUES (636, 6, 64.84, 'name636');
+INSERT INTO t VALUES (637, 7, 44.03, 'name637');
+INSERT INTO t VALUES (638, 8, 23.22, 'name638');
+INSERT INTO t VALUES (639, 9, 2.41, 'name639');
+INSERT INTO t VALUES (640, 0, 81.60, 'name640');
+INSERT INTO t VALUES (641, 1, 60.79, 'name641');
+INSERT INTO t VALUES (642, 2, 39.98, 'name642');
+INSERT INTO t VALUES (643, 3, 19.17, 'name643');
+INSERT INTO t VALUES (644, 4, 98.36, 'name644');
+INSERT INTO t VALUES (645, 5, 77.55, 'name645');
+INSERT INTO t VALUES (646, 6, 56.74, 'name646');
+INSERT INTO t VALUES (647, 7, 35.93, 'name647');
+INSERT INTO t VALUES (648, 8, 15.12, 'name648');
+INSERT INTO t VALUES (649, 9, 94.31, 'name649');
+INSERT INTO t VALUES (650, 0, 73.50, 'name650');
+INSERT INTO t VALUES (651, 1, 52.69, 'name651');
+INSERT INTO t VALUES (652, 2, 31.88, 'name652');
+INSERT INTO t VALUES (653, 3, 11.07, 'name653');
+INSERT INTO t VALUES (654, 4, 90.26, 'name654');
+INSERT INTO t VALUES (655, 5, 69.45, 'name655');
+INSERT INTO t VALUES (656, 6, 48.64, 'name656');
+INSERT INTO t VALUES (657, 7, 27.83, 'name657');
+INSERT INTO t VALUES (658, 8, 7.02, 'name658');
+INSERT INTO t VALUES (659, 9, 86.21, 'name659');
+INSERT INTO t VALUES (660, 0, 65.40, 'name660');
+INSERT INTO t VALUES (661, 1, 44.59, 'name661');
+INSERT INTO t VALUES (662, 2, 23.78, 'name662');
+INSERT INTO t VALUES (663, 3, 2.97, 'name663');
+INSERT INTO t VALUES (664, 4, 82.16, 'name664');
+INSERT INTO t VALUES (665, 5, 61.35, 'name665');
+INSERT INTO t VALUES (666, 6, 40.54, 'name666');
+INSERT INTO t VALUES (667, 7, 19.73, 'name667');
+INSERT INTO t VALUES (668, 8, 98.92, 'name668');
+INSERT INTO t VALUES (669, 9, 78.11, 'name669');
+INSERT INTO t VALUES (670, 0, 57.30, 'name670');
+INSERT INTO t VALUES (671, 1, 36.49, 'name671');
+INSERT INTO t VALUES (672, 2, 15.68, 'name672');
+INSERT INTO t VALUES (673, 3, 94.87, 'name673');
+INSERT INTO t VALUES (674, 4, 74.06, 'name674');
+INSERT INTO t VALUES (675, 5, 53.25, 'name675');
+INSERT INTO t VALUES (676, 6, 32.44, 'name676');
+INSERT INTO t VALUES (677, 7, 11.63, 'name677');
+INSERT INTO t VALUES (678, 8, 90.82, 'name678');
+INSERT INTO t VALUES (679, 9, 70.01, 'name679');
+INSERT INTO t VALUES (680, 0, 49.20, 'name680');
+INSERT INTO t VALUES (681, 1, 28.39, 'name681');
+INSERT INTO t VALUES (682, 2, 7.58, 'name682');
+INSERT INTO t VALUES (683, 3, 86.77, 'name683');
+INSERT INTO t VALUES (684, 4, 65.96, 'name684');
+INSERT INTO t VALUES (685, 5, 45.15, 'name685');
+INSERT INTO t VALUES (686, 6, 24.34, 'name686');
+INSERT INTO t VALUES (687, 7, 3.53, 'name687');
+INSERT INTO t VALUES (688, 8, 82.72, 'name688');
+INSERT INTO t VALUES (689, 9, 61.91, 'name689');
+INSERT INTO t VALUES (690, 0, 41.10, 'name690');
+INSERT INTO t VALUES (691, 1, 20.29, 'name691');
+INSERT INTO t VALUES (692, 2, 99.48, 'name692');
+INSERT INTO t VALUES (693, 3, 78.67, 'name693');
+INSERT INTO t VALUES (694, 4, 57.86, 'name694');
+INSERT INTO t VALUES (695, 5, 37.05, 'name695');
+INSERT INTO t VALUES (696, 6, 16.24, 'name696');
+INSERT INTO t VALUES (697, 7, 95.43, 'name697');
+INSERT INTO t VALUES (698, 8, 74.62, 'name698');
+INSERT INTO t VALUES (699, 9, 53.81, 'name699');
+INSERT INTO t VALUES (700, 0, 33.00, 'name700');
+INSERT INTO t VALUES (701, 1, 12.19, 'name701');
+INSERT INTO t VALUES (702, 2, 91.38, 'name702');
+INSERT INTO t VALUES (703, 3, 70.57, 'name703');
+INSERT INTO t VALUES (704, 4, 49.76, 'name704');
+INSERT INTO t VALUES (705, 5, 28.95, 'name705');
+INSERT INTO t VALUES (706, 6, 8.14, 'name706');
+INSERT INTO t VALUES (707, 7, 87.33, 'name707');
+INSERT INTO t VALUES (708, 8, 66.52, 'name708');
+INSERT INTO t VALUES (709, 9, 45.71, 'name709');
+INSERT INTO t VALUES (710, 0, 24.90, 'name710');
+INSERT INTO t VALUES (711, 1, 4.09, 'name711');
+INSERT INTO t VALUES (712, 2, 83.28, 'name712');
+INSERT INTO t VALUES (713, 3, 62.47, 'name713');
+INSERT INTO t VALUES (714, 4, 41.66, 'name714');
+INSERT INTO t VALUES (715, 5, 20.85, 'name715');
+INSERT INTO t VALUES (716, 6, 0.04, 'name716');
+INSERT INTO t VALUES (717, 7, 79.23, 'name717');
+INSERT INTO t VALUES (718, 8, 58.42, 'name718');
+INSERT INTO t VALUES (719, 9, 37.61, 'name719');
+INSERT INTO t VALUES (720, 0, 16.80, 'name720');
+INSERT INTO t VALUES (721, 1, 95.99, 'name721');
+INSERT INTO t VALUES (722, 2, 75.18, 'name722');
+INSERT INTO t VALUES (723, 3, 54.37, 'name723');
+INSERT INTO t VALUES (724, 4, 33.56, 'name724');
+INSERT INTO t VALUES (725, 5, 12.75, 'name725');
+INSERT INTO t VALUES (726, 6, 91.94, 'name726');
+INSERT INTO t VALUES (727, 7, 71.13, 'name727');
+INSERT INTO t VALUES (728, 8, 50.32, 'name728');
+INSERT INTO t VALUES (729, 9, 29.51, 'name729');
+INSERT INTO t VALUES (730, 0, 8.70, 'name730');
+INSERT INTO t VALUES (731, 1, 87.89, 'name731');
+INSERT INTO t VALUES (732, 2, 67.08, 'name732');
+INSERT INTO t VALUES (733, 3, 46.27, 'name733');
+INSERT INTO t VALUES (734, 4, 25.46, 'name734');
+INSERT INTO t VALUES (735, 5, 4.65, 'name735');
+INSERT INTO t VALUES (736, 6, 83.84, 'name736');
+INSERT INTO t VALUES (737, 7, 63.03, 'name737');
+INSERT INTO t VALUES (738, 8, 42.22, 'name738');
+INSERT INTO t VALUES (739, 9, 21.41, 'name739');
+INSERT INTO t VALUES (740, 0, 0.60, 'name740');
+INSERT INTO t VALUES (741, 1, 79.79, 'name741');
+INSERT INTO t VALUES (742, 2, 58.98, 'name742');
+INSERT INTO t VALUES (743, 3, 38.17, 'name743');
+INSERT INTO t VALUES (744, 4, 17.36, 'name744');
+INSERT INTO t VALUES (745, 5, 96.55, 'name745');
+INSERT INTO t VALUES (746, 6, 75.74, 'name746');
+INSERT INTO t VALUES (747, 7, 54.93, 'name747');
+INSERT INTO t VALUES (748, 8, 34.12, 'name748');
+INSERT INTO t VALUES (749, 9, 13.31, 'name749');
+INSERT INTO t VALUES (750, 0, 92.50, 'name750');
+INSERT INTO t VALUES (751, 1, 71.69, 'name751');
+INSERT INTO t VALUES (752, 2, 50.88, 'name752');
+INSERT INTO t VALUES (753, 3, 30.07, 'name753');
+INSERT INTO t VALUES (754, 4, 9.26, 'name754');
+INSERT INTO t VALUES (755, 5, 88.45, 'name755');
+INSERT INTO t VALUES (756, 6, 67.64, 'name756');
+INSERT INTO t VALUES (757, 7, 46.83, 'name757');
+INSERT INTO t VALUES (758, 8, 26.02, 'name758');
+INSERT INTO t VALUES (759, 9, 5.21, 'name759');
+INSERT INTO t VALUES (760, 0, 84.40, 'name760');
+INSERT INTO t VALUES (761, 1, 63.59, 'name761');
+INSERT INTO t VALUES (762, 2, 42.78, 'name762');
+INSERT INTO t VALUES (763, 3, 21.97, 'name763');
+INSERT INTO t VALUES (764, 4, 1.16, 'name764');
+INSERT INTO t VALUES (765, 5, 80.35, 'name765');
+INSERT INTO t VALUES (766, 6, 59.54, 'name766');
+INSERT INTO t VALUES (767, 7, 38.73, 'name767');
+INSERT INTO t VALUES (768, 8, 17.92, 'name768');
+INSERT INTO t VALUES (769, 9, 97.11, 'name769');
+INSERT INTO t VALUES (770, 0, 76.30, 'name770');
+INSERT INTO t VALUES (771, 1, 55.49, 'name771');
+INSERT INTO t VALUES (772, 2, 34.68, 'name772');
+INSERT INTO t VALUES (773, 3, 13.87, 'name773');
+INSERT INTO t VALUES (774, 4, 93.06, 'name774');
+INSERT INTO t VALUES (775, 5, 72.25, 'name775');
+INSERT INTO t VALUES (776, 6, 51.44, 'name776');
+INSERT INTO t VALUES (777, 7, 30.63, 'name777');
+INSERT INTO t VALUES (778, 8, 9.82, 'name778');
+INSERT INTO t VALUES (779, 9, 89.01, 'name779');
+INSERT INTO t VALUES (780, 0, 68.20, 'name780');
+INSERT INTO t VALUES (781, 1, 47.39, 'name781');
+INSERT INTO t VALUES (782, 2, 26.58, 'name782');
+INSERT INTO t VALUES (783, 3, 5.77, 'name783');
+INSERT INTO t VALUES (784, 4, 84.96, 'name784');
+INSERT INTO t VALUES (785, 5, 64.15, 'name785');
+INSERT INTO t VALUES (786, 6, 43.34, 'name786');
+INSERT INTO t VALUES (787, 7, 22.53, 'name787');
+INSERT INTO t VALUES (788, 8, 1.72, 'name788');
+INSERT INTO t VALUES (789, 9, 80.91, 'name789');
+INSERT INTO t VALUES (790, 0, 60.10, 'name790');
+INSERT INTO t VALUES (791, 1, 39.29, 'name791');
+INSERT INTO t VALUES (792, 2, 18.48, 'name792');
+INSERT INTO t VALUES (793, 3, 97.67, 'name793');
+INSERT INTO t VALUES (794, 4, 76.86, 'name794');
+INSERT INTO t VALUES (795, 5, 56.05, 'name795');
+INSERT INTO t VALUES (796, 6, 35.24, 'name796');
+INSERT INTO t VALUES (797, 7, 14.43, 'name797');
+INSERT INTO t VALUES (798, 8, 93.62, 'name798');
+INSERT INTO t VALUES (799, 9, 72.81, 'name799');
+INSERT INTO t VALUES (800, 0, 52.00, 'name800');
+INSERT INTO t VALUES (801, 1, 31.19, 'name801');
+INSERT INTO t VALUES (802, 2, 10.38, 'name802');
+INSERT INTO t VALUES (803, 3, 89.57, 'name803');
+INSERT INTO t VALUES (804, 4, 68.76, 'name804');
+INSERT INTO t VALUES (805, 5, 47.95, 'name805');
+INSERT INTO t VALUES (806, 6, 27.14, 'name806');
+INSERT INTO t VALUES (807, 7, 6.33, 'name807');
+INSERT INTO t VALUES (808, 8, 85.52, 'name808');
+INSERT INTO t VALUES (809, 9, 64.71, 'name809');
+INSERT INTO t VALUES (810, 0, 43.90, 'name810');
+INSERT INTO t VALUES (811, 1, 23.09, 'name811');
+INSERT INTO t VALUES (812, 2, 2.28, 'name812');
+INSERT INTO t VALUES (813, 3, 81.47, 'name813');
+INSERT INTO t VALUES (814, 4, 60.66, 'name814');
+INSERT INTO t VALUES (815, 5, 39.85, 'name815');
+INSERT INTO t VALUES (816, 6, 19.04, 'name816');
+INSERT INTO t VALUES (817, 7, 98.23, 'name817');
+INSERT INTO t VALUES (818, 8, 77.42, 'name818');
+INSERT INTO t VALUES (819, 9, 56.61, 'name819');
+INSERT INTO t VALUES (820, 0, 35.80, 'name820');
+INSERT INTO t VALUES (821, 1, 14.99, 'name821');
+INSERT INTO t VALUES (822, 2, 94.18, 'name822');
+INSERT INTO t VALUES (823, 3, 73.37, 'name823');
+INSERT INTO t VALUES (824, 4, 52.56, 'name824');
+INSERT INTO t VALUES (825, 5, 31.75, 'name825');
+INSERT INTO t VALUES (826, 6, 10.94, 'name826');
+INSERT INTO t VALUES (827, 7, 90.13, 'name827');
+INSERT INTO t VALUES (828, 8, 69.32, 'name828');
+INSERT INTO t VALUES (829, 9, 48.51, 'name829');
+INSERT INTO t VALUES (830, 0, 27.70, 'name830');
+INSERT INTO t VALUES (831, 1, 6.89, 'name831');
+INSERT INTO t VALUES (832, 2, 86.08, 'name832');
+INSERT INTO t VALUES (833, 3, 65.27, 'name833');
+INSERT INTO t VALUES (834, 4, 44.46, 'name834');
+INSERT INTO t VALUES (835, 5, 23.65, 'name835');
+INSERT INTO t VALUES (836, 6, 2.84, 'name836');
+INSERT INTO t VALUES (837, 7, 82.03, 'name837');
+INSERT INTO t VALUES (838, 8, 61.22, 'name838');
+INSERT INTO t VALUES (839, 9, 40.41, 'name839');
+INSERT INTO t VALUES (840, 0, 19.60, 'name840');
+INSERT INTO t VALUES (841, 1, 98.79, 'name841');
+INSERT INTO t VALUES (842, 2, 77.98, 'name842');
+INSERT INTO t VALUES (843, 3, 57.17, 'name843');
+INSERT INTO t VALUES (844, 4, 36.36, 'name844');
+INSERT INTO t VALUES (845, 5, 15.55, 'name845');
+INSERT INTO t VALUES (846, 6, 94.74, 'name846');
+INSERT INTO t VALUES (847, 7, 73.93, 'name847');
+INSERT INTO t VALUES (848, 8, 53.12, 'name848');
+INSERT INTO t VALUES (849, 9, 32.31, 'name849');
+INSERT INTO t VALUES (850, 0, 11.50, 'name850');
+INSERT INTO t VALUES (851, 1, 90.69, 'name851');
+INSERT INTO t VALUES (852, 2, 69.88, 'name852');
+INSERT INTO t VALUES (853, 3, 49.07, 'name853');
+INSERT INTO t VALUES (854, 4, 28.26, 'name854');
+INSERT INTO t VALUES (855, 5, 7.45, 'name855');
+INSERT INTO t VALUES (856, 6, 86.64, 'name856');
+INSERT INTO t VALUES (857, 7, 65.83, 'name857');
+INSERT INTO t VALUES (858, 8, 45.02, 'name858');
+INSERT INTO t VALUES (859, 9, 24.21, 'name859');
+INSERT INTO t VALUES (860, 0, 3.40, 'name860');
+INSERT INTO t VALUES (861, 1, 82.59, 'name861');
+INSERT INTO t VALUES (862, 2, 61.78, 'name862');
+INSERT INTO t VALUES (863, 3, 40.97, 'name863');
+INSERT INTO t VALUES (864, 4, 20.16, 'name864');
+INSERT INTO t VALUES (865, 5, 99.35, 'name865');
+INSERT INTO t VALUES (866, 6, 78.54, 'name866');
+INSERT INTO t VALUES (867, 7, 57.73, 'name867');
+INSERT INTO t VALUES (868, 8, 36.92, 'name868');
+INSERT INTO t VALUES (869, 9, 16.11, 'name869');
+INSERT INTO t VALUES (870, 0, 95.30, 'name870');
+INSERT INTO t VALUES (871, 1, 74.49, 'name871');
+INSERT INTO t VALUES (872, 2, 53.68, 'name872');
+INSERT INTO t VALUES (873, 3, 32.87, 'name873');
+INSERT INTO t VALUES (874, 4, 12.06, 'name874');
+INSERT INTO t VALUES (875, 5, 91.25, 'name875');
+INSERT INTO t VALUES (876, 6, 70.44, 'name876');
+INSERT INTO t VALUES (877, 7, 49.63, 'name877');
+INSERT INTO t VALUES (878, 8, 28.82, 'name878');
+INSERT INTO t VALUES (879, 9, 8.01, 'name879');
+INSERT INTO t VALUES (880, 0, 87.20, 'name880');
+INSERT INTO t VALUES (881, 1, 66.39, 'name881');
+INSERT INTO t VALUES (882, 2, 45.58, 'name882');
+INSERT INTO t VALUES (883, 3, 24.77, 'name883');
+INSERT INTO t VALUES (884, 4, 3.96, 'name884');
+INSERT INTO t VALUES (885, 5, 83.15, 'name885');
+INSERT INTO t VALUES (886, 6, 62.34, 'name886');
+INSERT INTO t VALUES (887, 7, 41.53, 'name887');
+INSERT INTO t VALUES (888, 8, 20.72, 'name888');
+INSERT INTO t VALUES (889, 9, 99.91, 'name889');
+INSERT INTO t VALUES (890, 0, 79.10, 'name890');
+INSERT INTO t VALUES (891, 1, 58.29, 'name891');
+INSERT INTO t VALUES (892, 2, 37.48, 'name892');
+INSERT INTO t VALUES (893, 3, 16.67, 'name893');
+INSERT INTO t VALUES (894, 4, 95.86, 'name894');
+INSERT INTO t VALUES (895, 5, 75.05, 'name895');
+INSERT INTO t VALUES (896, 6, 54.24, 'name896');
+INSERT INTO t VALUES (897, 7, 33.43, 'name897');
+INSERT INTO t VALUES (898, 8, 12.62, 'name898');
+INSERT INTO t VALUES (899, 9, 91.81, 'name899');
+INSERT INTO t VALUES (900, 0, 71.00, 'name900');
+INSERT INTO t VALUES (901, 1, 50.19, 'name901');
+INSERT INTO t VALUES (902, 2, 29.38, 'name902');
+INSERT INTO t VALUES (903, 3, 8.57, 'name903');
+INSERT INTO t VALUES (904, 4, 87.76, 'name904');
+INSERT INTO t VALUES (905, 5, 66.95, 'name905');
+INSERT INTO t VALUES (906, 6, 46.14, 'name906');
+INSERT INTO t VALUES (907, 7, 25.33, 'name907');
+INSERT INTO t VALUES (908, 8, 4.52, 'name908');
+INSERT INTO t VALUES (909, 9, 83.71, 'name909');
+INSERT INTO t VALUES (910, 0, 62.90, 'name910');
+INSERT INTO t VALUES (911, 1, 42.09, 'name911');
+INSERT INTO t VALUES (912, 2, 21.28, 'name912');
+INSERT INTO t VALUES (913, 3, 0.47, 'name913');
+INSERT INTO t VALUES (914, 4, 79.66, 'name914');
+INSERT INTO t VALUES (915, 5, 58.85, 'name915');
+INSERT INTO t VALUES (916, 6, 38.04, 'name916');
+INSERT INTO t VALUES (917, 7, 17.23, 'name917');
+INSERT INTO t VALUES (918, 8, 96.42, 'name918');
+INSERT INTO t VALUES (919, 9, 75.61, 'name919');
+INSERT INTO t VALUES (920, 0, 54.80, 'name920');
+INSERT INTO t VALUES (921, 1, 33.99, 'name921');
+INSERT INTO t VALUES (922, 2, 13.18, 'name922');
+INSERT INTO t VALUES (923, 3, 92.37, 'name923');
+INSERT INTO t VALUES (924, 4, 71.56, 'name924');
+INSERT INTO t VALUES (925, 5, 50.75, 'name925');
+INSERT INTO t VALUES (926, 6, 29.94, 'name926');
+INSERT INTO t VALUES (927, 7, 9.13, 'name927');
+INSERT INTO t VALUES (928, 8, 88.32, 'name928');
+INSERT INTO t VALUES (929, 9, 67.51, 'name929');
+INSERT INTO t VALUES (930, 0, 46.70, 'name930');
+INSERT INTO t VALUES (931, 1, 25.89, 'name931');
+INSERT INTO t VALUES (932, 2, 5.08, 'name932');
+INSERT INTO t VALUES (933, 3, 84.27, 'name933');
+INSERT INTO t VALUES (934, 4, 63.46, 'name934');
+INSERT INTO t VALUES (935, 5, 42.65, 'name935');
+INSERT INTO t VALUES (936, 6, 21.84, 'name936');
+INSERT INTO t VALUES (937, 7, 1.03, 'name937');
+INSERT INTO t VALUES (938, 8, 80.22, 'name938');
+INSERT INTO t VALUES (939, 9, 59.41, 'name939');
+INSERT INTO t VALUES (940, 0, 38.60, 'name940');
+INSERT INTO t VALUES (941, 1, 17.79, 'name941');
+INSERT INTO t VALUES (942, 2, 96.98, 'name942');
+INSERT INTO t VALUES (943, 3, 76.17, 'name943');
+INSERT INTO t VALUES (944, 4, 55.36, 'name944');
+INSERT INTO t VALUES (945, 5, 34.55, 'name945');
+INSERT INTO t VALUES (946, 6, 13.74, 'name946');
+INSERT INTO t VALUES (947, 7, 92.93, 'name947');
+INSERT INTO t VALUES (948, 8, 72.12, 'name948');
+INSERT INTO t VALUES (949, 9, 51.31, 'name949');
+INSERT INTO t VALUES (950, 0, 30.50, 'name950');
+INSERT INTO t VALUES (951, 1, 9.69, 'name951');
+INSERT INTO t VALUES (952, 2, 88.88, 'name952');
+INSERT INTO t VALUES (953, 3, 68.07, 'name953');
+INSERT INTO t VALUES (954, 4, 47.26, 'name954');
+INSERT INTO t VALUES (955, 5, 26.45, 'name955');
+INSERT INTO t VALUES (956, 6, 5.64, 'name956');
+INSERT INTO t VALUES (957, 7, 84.83, 'name957');
+INSERT INTO t VALUES (958, 8, 64.02, 'name958');
+INSERT INTO t VALUES (959, 9, 43.21, 'name959');
+INSERT INTO t VALUES (960, 0, 22.40, 'name960');
+INSERT INTO t VALUES (961, 1, 1.59, 'name961');
+INSERT INTO t VALUES (962, 2, 80.78, 'name962');
+INSERT INTO t VALUES (963, 3, 59.97, 'name963');
+INSERT INTO t VALUES (964, 4, 39.16, 'name964');
+INSERT INTO t VALUES (965, 5, 18.35, 'name965');
+INSERT INTO t VALUES (966, 6, 97.54, 'name966');
+INSERT INTO t VALUES (967, 7, 76.73, 'name967');
+INSERT INTO t VALUES (968, 8, 55.92, 'name968');
+INSERT INTO t VALUES (969, 9, 35.11, 'name969');
+INSERT INTO t VALUES (970, 0, 14.30, 'name970');
+INSERT INTO t VALUES (971, 1, 93.49, 'name971');
+INSERT INTO t VALUES (972, 2, 72.68, 'name972');
+INSERT INTO t VALUES (973, 3, 51.87, 'name973');
+INSERT INTO t VALUES (974, 4, 31.06, 'name974');
+INSERT INTO t VALUES (975, 5, 10.25, 'name975');
+INSERT INTO t VALUES (976, 6, 89.44, 'name976');
+INSERT INTO t VALUES (977, 7, 68.63, 'name977');
+INSERT INTO t VALUES (978, 8, 47.82, 'name978');
+INSERT INTO t VALUES (979, 9, 27.01, 'name979');
+INSERT INTO t VALUES (980, 0, 6.20, 'name980');
+INSERT INTO t VALUES (981, 1, 85.39, 'name981');
+INSERT INTO t VALUES (982, 2, 64.58, 'name982');
+INSERT INTO t VALUES (983, 3, 43.77, 'name983');
+INSERT INTO t VALUES (984, 4, 22.96, 'name984');
+INSERT INTO t VALUES (985, 5, 2.15, 'name985');
+INSERT INTO t VALUES (986, 6, 81.34, 'name986');
+INSERT INTO t VALUES (987, 7, 60.53, 'name987');
+INSERT INTO t VALUES (988, 8, 39.72, 'name988');
+INSERT INTO t VALUES (989, 9, 18.91, 'name989');
+INSERT INTO t VALUES (990, 0, 98.10, 'name990');
+INSERT INTO t VALUES (991, 1, 77.29, 'name991');
+INSERT INTO t VALUES (992, 2, 56.48, 'name992');
+INSERT INTO t VALUES (993, 3, 35.67, 'name993');
+INSERT INTO t VALUES (994, 4, 14.86, 'name994');
+INSERT INTO t VALUES (995, 5, 94.05, 'name995');
+INSERT INTO t VALUES (996, 6, 73.24, 'name996');
+INSERT INTO t VALUES (997, 7, 52.43, 'name997');
+INSERT INTO t VALUES (998, 8, 31.62, 'name998');
+INSERT INTO t VALUES (999, 9, 10.81, 'name999');
+INSERT INTO t VALUES (1000, 0, 90.00, 'name1000');
+INSERT INTO t VALUES (1001, 1, 69.19, 'name1001');
+INSERT INTO t VALUES (1002, 2, 48.38, 'name1002');
+INSERT INTO t VALUES (1003, 3, 27.57, 'name1003');
+INSERT INTO t VALUES (1004, 4, 6.76, 'name1004');
+INSERT INTO t VALUES (1005, 5, 85.95, 'name1005');
+INSERT INTO t VALUES (1006, 6, 65.14, 'name1006');
+INSERT INTO t VALUES (1007, 7, 44.33, 'name1007');
+INSERT INTO t VALUES (1008, 8, 23.52, 'name1008');
+INSERT INTO t VALUES (1009, 9, 2.71, 'name1009');
+INSERT INTO t VALUES (1010, 0, 81.90, 'name1010');
+INSERT INTO t VALUES (1011, 1, 61.09, 'name1011');
+INSERT INTO t VALUES (1012, 2, 40.28, 'name1012');
+INSERT INTO t VALUES (1013, 3, 19.47, 'name1013');
+INSERT INTO t VALUES (1014, 4, 98.66, 'name1014');
+INSERT INTO t VALUES (1015, 5, 77.85, 'name1015');
+INSERT INTO t VALUES (1016, 6, 57.04, 'name1016');
+INSERT INTO t VALUES (1017, 7, 36.23, 'name1017');
+INSERT INTO t VALUES (1018, 8, 15.42, 'name1018');
+INSERT INTO t VALUES (1019, 9, 94.61, 'name1019');
+INSERT INTO t VALUES (1020, 0, 73.80, 'name1020');
+INSERT INTO t VALUES (1021, 1, 52.99, 'name1021');
+INSERT INTO t VALUES (1022, 2, 32.18, 'name1022');
+INSERT INTO t VALUES (1023, 3, 11.37, 'name1023');
+INSERT INTO t VALUES (1024, 4, 90.56, 'name1024');
+INSERT INTO t VALUES (1025, 5, 69.75, 'name1025');
+INSERT INTO t VALUES (1026, 6, 48.94, 'name1026');
+INSERT INTO t VALUES (1027, 7, 28.13, 'name1027');
+INSERT INTO t VALUES (1028, 8, 7.32, 'name1028');
+INSERT INTO t VALUES (1029, 9, 86.51, 'name1029');
+INSERT INTO t VALUES (1030, 0, 65.70, 'name1030');
+INSERT INTO t VALUES (1031, 1, 44.89, 'name1031');
+INSERT INTO t VALUES (1032, 2, 24.08, 'name1032');
+INSERT INTO t VALUES (1033, 3, 3.27, 'name1033');
+INSERT INTO t VALUES (1034, 4, 82.46, 'name1034');
+INSERT INTO t VALUES (1035, 5, 61.65, 'name1035');
+INSERT INTO t VALUES (1036, 6, 40.84, 'name1036');
+INSERT INTO t VALUES (1037, 7, 20.03, 'name1037');
+INSERT INTO t VALUES (1038, 8, 99.22, 'name1038');
+INSERT INTO t VALUES (1039, 9, 78.41, 'name1039');
+INSERT INTO t VALUES (1040, 0, 57.60, 'name1040');
+INSERT INTO t VALUES (1041, 1, 36.79, 'name1041');
+INSERT INTO t VALUES (1042, 2, 15.98, 'name1042');
+INSERT INTO t VALUES (1043, 3, 95.17, 'name1043');
+INSERT INTO t VALUES (1044, 4, 74.36, 'name1044');
+INSERT INTO t VALUES (1045, 5, 53.55, 'name1045');
+INSERT INTO t VALUES (1046, 6, 32.74, 'name1046');
+INSERT INTO t VALUES (1047, 7, 11.93, 'name1047');
+INSERT INTO t VALUES (1048, 8, 91.12, 'name1048');
+INSERT INTO t VALUES (1049, 9, 70.31, 'name1049');
+INSERT INTO t VALUES (1050, 0, 49.50, 'name1050');
+INSERT INTO t VALUES (1051, 1, 28.69, 'name1051');
+INSERT INTO t VALUES (1052, 2, 7.88, 'name1052');
+INSERT INTO t VALUES (1053, 3, 87.07, 'name1053');
+INSERT INTO t VALUES (1054, 4, 66.26, 'name1054');
+INSERT INTO t VALUES (1055, 5, 45.45, 'name1055');
+INSERT INTO t VALUES (1056, 6, 24.64, 'name1056');
+INSERT INTO t VALUES (1057, 7, 3.83, 'name1057');
+INSERT INTO t VALUES (1058, 8, 83.02, 'name1058');
+INSERT INTO t VALUES (1059, 9, 62.21, 'name1059');
+INSERT INTO t VALUES (1060, 0, 41.40, 'name1060');
+INSERT INTO t VALUES (1061, 1, 20.59, 'name1061');
+INSERT INTO t VALUES (1062, 2, 99.78, 'name1062');
+INSERT INTO t VALUES (1063, 3, 78.97, 'name1063');
+INSERT INTO t VALUES (1064, 4, 58.16, 'name1064');
+INSERT INTO t VALUES (1065, 5, 37.35, 'name1065');
+INSERT INTO t VALUES (1066, 6, 16.54, 'name1066');
+INSERT INTO t VALUES (1067, 7, 95.73, 'name1067');
+INSERT INTO t VALUES (1068, 8, 74.92, 'name1068');
+INSERT INTO t VALUES (1069, 9, 54.11, 'name1069');
+INSERT INTO t VALUES (1070, 0, 33.30, 'name1070');
+INSERT INTO t VALUES (1071, 1, 12.49, 'name1071');
+INSERT INTO t VALUES (1072, 2, 91.68, 'name1072');
+INSERT INTO t VALUES (1073, 3, 70.87, 'name1073');
+INSERT INTO t VALUES (1074, 4, 50.06, 'name1074');
+INSERT INTO t VALUES (1075, 5, 29.25, 'name1075');
+INSERT INTO t VALUES (1076, 6, 8.44, 'name1076');
+INSERT INTO t VALUES (1077, 7, 87.63, 'name1077');
+INSERT INTO t VALUES (1078, 8, 66.82, 'name1078');
+INSERT INTO t VALUES (1079, 9, 46.01, 'name1079');
+INSERT INTO t VALUES (1080, 0, 25.20, 'name1080');
+INSERT INTO t VALUES (1081, 1, 4.39, 'name1081');
+INSERT INTO t VALUES (1082, 2, 83.58, 'name1082');
+INSERT INTO t VALUES (1083, 3, 62.77, 'name1083');
+INSERT INTO t VALUES (1084, 4, 41.96, 'name1084');
+INSERT INTO t VALUES (1085, 5, 21.15, 'name1085');
+INSERT INTO t VALUES (1086, 6, 0.34, 'name1086');
+INSERT INTO t VALUES (1087, 7, 79.53, 'name1087');
+INSERT INTO t VALUES (1088, 8, 58.72, 'name1088');
+INSERT INTO t VALUES (1089, 9, 37.91, 'name1089');
+INSERT INTO t VALUES (1090, 0, 17.10, 'name1090');
+INSERT INTO t VALUES (1091, 1, 96.29, 'name1091');
+INSERT INTO t VALUES (1092, 2, 75.48, 'name1092');
+INSERT INTO t VALUES (1093, 3, 54.67, 'name1093');
+INSERT INTO t VALUES (1094, 4, 33.86, 'name1094');
+INSERT INTO t VALUES (1095, 5, 13.05, 'name1095');
+INSERT INTO t VALUES (1096, 6, 92.24, 'name1096');
+INSERT INTO t VALUES (1097, 7, 71.43, 'name1097');
+INSERT INTO t VALUES (1098, 8, 50.62, 'name1098');
+INSERT INTO t VALUES (1099, 9, 29.81, 'name1099');
+INSERT INTO t VALUES (1100, 0, 9.00, 'name1100');
+INSERT INTO t VALUES (1101, 1, 88.19, 'name1101');
+INSERT INTO t VALUES (1102, 2, 67.38, 'name1102');
+INSERT INTO t VALUES (1103, 3, 46.57, 'name1103');
+INSERT INTO t VALUES (1104, 4, 25.76, 'name1104');
+INSERT INTO t VALUES (1105, 5, 4.95, 'name1105');
+INSERT INTO t VALUES (1106, 6, 84.14, 'name1106');
+INSERT INTO t VALUES (1107, 7, 63.33, 'name1107');
+INSERT INTO t VALUES (1108, 8, 42.52, 'name1108');
+INSERT INTO t VALUES (1109, 9, 21.71, 'name1109');
+INSERT INTO t VALUES (1110, 0, 0.90, 'name1110');
+INSERT INTO t VALUES (1111, 1, 80.09, 'name1111');
+INSERT INTO t VALUES (1112, 2, 59.28, 'name1112');
+INSERT INTO t VALUES (1113, 3, 38.47, 'name1113');
+INSERT INTO t VALUES (1114, 4, 17.66, 'name1114');
+INSERT INTO t VALUES (1115, 5, 96.85, 'name1115');
+INSERT INTO t VALUES (1116, 6, 76.04, 'name1116');
+INSERT INTO t VALUES (1117, 7, 55.23, 'name1117');
+INSERT INTO t VALUES (1118, 8, 34.42, 'name1118');
+INSERT INTO t VALUES (1119, 9, 13.61, 'name1119');
+INSERT INTO t VALUES (1120, 0, 92.80, 'name1120');
+INSERT INTO t VALUES (1121, 1, 71.99, 'name1121');
+INSERT INTO t VALUES (1122, 2, 51.18, 'name1122');
+INSERT INTO t VALUES (1123, 3, 30.37, 'name1123');
+INSERT INTO t VALUES (1124, 4, 9.56, 'name1124');
+INSERT INTO t VALUES (1125, 5, 88.75, 'name1125');
+INSERT INTO t VALUES (1126, 6, 67.94, 'name1126');
+INSERT INTO t VALUES (1127, 7, 47.13, 'name1127');
+INSERT INTO t VALUES (1128, 8, 26.32, 'name1128');
+INSERT INTO t VALUES (1129, 9, 5.51, 'name1129');
+INSERT INTO t VALUES (1130, 0, 84.70, 'name1130');
+INSERT INTO t VALUES (1131, 1, 63.89, 'name1131');
+INSERT INTO t VALUES (1132, 2, 43.08, 'name1132');
+INSERT INTO t VALUES (1133, 3, 22.27, 'name1133');
+INSERT INTO t VALUES (1134, 4, 1.46, 'name1134');
+INSERT INTO t VALUES (1135, 5, 80.65, 'name1135');
+INSERT INTO t VALUES (1136, 6, 59.84, 'name1136');
+INSERT INTO t VALUES (1137, 7, 39.03, 'name1137');
+INSERT INTO t VALUES (1138, 8, 18.22, 'name1138');
+INSERT INTO t VALUES (1139, 9, 97.41, 'name1139');
+INSERT INTO t VALUES (1140, 0, 76.60, 'name1140');
+INSERT INTO t VALUES (1141, 1, 55.79, 'name1141');
+INSERT INTO t VALUES (1142, 2, 34.98, 'name1142');
+INSERT INTO t VALUES (1143, 3, 14.17, 'name1143');
+INSERT INTO t VALUES (1144, 4, 93.36, 'name1144');
+INSERT INTO t VALUES (1145, 5, 72.55, 'name1145');
+INSERT INTO t VALUES (1146, 6, 51.74, 'name1146');
+INSERT INTO t VALUES (1147, 7, 30.93, 'name1147');
+INSERT INTO t VALUES (1148, 8, 10.12, 'name1148');
+INSERT INTO t VALUES (1149, 9, 89.31, 'name1149');
+INSERT INTO t VALUES (1150, 0, 68.50, 'name1150');
+INSERT INTO t VALUES (1151, 1, 47.69, 'name1151');
+INSERT INTO t VALUES (1152, 2, 26.88, 'name1152');
+INSERT INTO t VALUES (1153, 3, 6.07, 'name1153');
+INSERT INTO t VALUES (1154, 4, 85.26, 'name1154');
+INSERT INTO t VALUES (1155, 5, 64.45, 'name1155');
+INSERT INTO t VALUES (1156, 6, 43.64, 'name1156');
+INSERT INTO t VALUES (1157, 7, 22.83, 'name1157');
+INSERT INTO t VALUES (1158, 8, 2.02, 'name1158');
+INSERT INTO t VALUES (1159, 9, 81.21, 'name1159');
+INSERT INTO t VALUES (1160, 0, 60.40, 'name1160');
+INSERT INTO t VALUES (1161, 1, 39.59, 'name1161');
+INSERT INTO t VALUES (1162, 2, 18.78, 'name1162');
+INSERT INTO t VALUES (1163, 3, 97.97, 'name1163');
+INSERT INTO t VALUES (1164, 4, 77.16, 'name1164');
+INSERT INTO t VALUES (1165, 5, 56.35, 'name1165');
+INSERT INTO t VALUES (1166, 6, 35.54, 'name1166');
+INSERT INTO t VALUES (1167, 7, 14.73, 'name1167');
+INSERT INTO t VALUES (1168, 8, 93.92, 'name1168');
+INSERT INTO t VALUES (1169, 9, 73.11, 'name1169');
+INSERT INTO t VALUES (1170, 0, 52.30, 'name1170');
+INSERT INTO t VALUES (1171, 1, 31.49, 'name1171');
+INSERT INTO t VALUES (1172, 2, 10.68, 'name1172');
+INSERT INTO t VALUES (1173, 3, 89.87, 'name1173');
+INSERT INTO t VALUES (1174, 4, 69.06, 'name1174');
+INSERT INTO t VALUES (1175, 5, 48.25, 'name1175');
+INSERT INTO t VALUES (1176, 6, 27.44, 'name1176');
+INSERT INTO t VALUES (1177, 7, 6.63, 'name1177');
+INSERT INTO t VALUES (1178, 8, 85.82, 'name1178');
+INSERT INTO t VALUES (1179, 9, 65.01, 'name1179');
+INSERT INTO t VALUES (1180, 0, 44.20, 'name1180');
+INSERT INTO t VALUES (1181, 1, 23.39, 'name1181');
+INSERT INTO t VALUES (1182, 2, 2.58, 'name1182');
+INSERT INTO t VALUES (1183, 3, 81.77, 'name1183');
+INSERT INTO t VALUES (1184, 4, 60.96, 'name1184');
+INSERT INTO t VALUES (1185, 5, 40.15, 'name1185');
+INSERT INTO t VALUES (1186, 6, 19.34, 'name1186');
+INSERT INTO t VALUES (1187, 7, 98.53, 'name1187');
+INSERT INTO t VALUES (1188, 8, 77.72, 'name1188');
+INSERT INTO t VALUES (1189, 9, 56.91, 'name1189');
+INSERT INTO t VALUES (1190, 0, 36.10, 'name1190');
+INSERT INTO t VALUES (1191, 1, 15.29, 'name1191');
+INSERT INTO t VALUES (1192, 2, 94.48, 'name1192');
+INSERT INTO t VALUES (1193, 3, 73.67, 'name1193');
+INSERT INTO t VALUES (1194, 4, 52.86, 'name1194');
+INSERT INTO t VALUES (1195, 5, 32.05, 'name1195');
+INSERT INTO t VALUES (1196, 6, 11.24, 'name1196');
+INSERT INTO t VALUES (1197, 7, 90.43, 'name1197');
+INSERT INTO t VALUES (1198, 8, 69.62, 'name1198');
+INSERT INTO t VALUES (1199, 9, 48.81, 'name1199');
+INSERT INTO t VALUES (1200, 0, 28.00, 'name1200');
+INSERT INTO t VALUES (1201, 1, 7.19, 'name1201');
+INSERT INTO t VALUES (1202, 2, 86.38, 'name1202');
+INSERT INTO t VALUES (1203, 3, 65.57, 'name1203');
+INSERT INTO t VALUES (1204, 4, 44.76, 'name1204');
+INSERT INTO t VALUES (1205, 5, 23.95, 'name1205');
+INSERT INTO t VALUES (1206, 6, 3.14, 'name1206');
+INSERT INTO t VALUES (1207, 7, 82.33, 'name1207');
+INSERT INTO t VALUES (1208, 8, 61.52, 'name1208');
+INSERT INTO t VALUES (1209, 9, 40.71, 'name1209');
+INSERT INTO t VALUES (1210, 0, 19.90, 'name1210');
+INSERT INTO t VALUES (1211, 1, 99.09, 'name1211');
+INSERT INTO t VALUES (1212, 2, 78.28, 'name1212');
+INSERT INTO t VALUES (1213, 3, 57.47, 'name1213');
+INSERT INTO t VALUES (1214, 4, 36.66, 'name1214');
+INSERT INTO t VALUES (1215, 5, 15.85, 'name1215');
+INSERT INTO t VALUES (1216, 6, 95.04, 'name1216');
+INSERT INTO t VALUES (1217, 7, 74.23, 'name1217');
+INSERT INTO t VALUES (1218, 8, 53.42, 'name1218');
+INSERT INTO t VALUES (1219, 9, 32.61, 'name1219');
+INSERT INTO t VALUES (1220, 0, 11.80, 'name1220');
+INSERT INTO t VALUES (1221, 1, 90.99, 'name1221');
+INSERT INTO t VALUES (1222, 2, 70.18, 'name1222');
+INSERT INTO t VALUES (1223, 3, 49.37, 'name1223');
+INSERT INTO t VALUES (1224, 4, 28.56, 'name1224');
+INSERT INTO t VALUES (1225, 5, 7.75, 'name1225');
+INSERT INTO t VALUES (1226, 6, 86.94, 'name1226');
+INSERT INTO t VALUES (1227, 7, 66.13, 'name1227');
+INSERT INTO t VALUES (1228, 8, 45.32, 'name1228');
+INSERT INTO t VALUES (1229, 9, 24.51, 'name1229');
+INSERT INTO t VALUES (1230, 0, 3.70, 'name1230');
+INSERT INTO t VALUES (1231, 1, 82.89, 'name1231');
+INSERT INTO t VALUES (1232, 2, 62.08, 'name1232');
+INSERT INTO t VALUES (1233, 3, 41.27, 'name1233');
+INSERT INTO t VALUES (1234, 4, 20.46, 'name1234');
+INSERT INTO t VALUES (1235, 5, 99.65, 'name1235');
+INSERT INTO t VALUES (1236, 6, 78.84, 'name1236');
+INSERT INTO t VALUES (1237, 7, 58.03, 'name1237');
+INSERT INTO t VALUES (1238, 8, 37.22, 'name1238');
+INSERT INTO t VALUES (1239, 9, 16.41, 'name1239');
+INSERT INTO t VALUES (1240, 0, 95.60, 'name1240');
+INSERT INTO t VALUES (1241, 1, 74.79, 'name1241');
+INSERT INTO t VALUES (1242, 2, 53.98, 'name1242');
+INSERT INTO t VALUES (1243, 3, 33.17, 'name1243');
+INSERT INTO t VALUES (1244, 4, 12.36, 'name1244');
+INSERT INTO t VALUES (1245, 5, 91.55, 'name1245');
+INSERT INTO t VALUES (1246, 6, 70.74, 'name1246');
+INSERT INTO t VALUES (1247, 7, 49.93, 'name1247');
+INSERT INTO t VALUES (1248, 8, 29.12, 'name1248');
+INSERT INTO t VALUES (1249, 9, 8.31, 'name1249');
+INSERT INTO t VALUES (1250, 0, 87.50, 'name1250');
+INSERT INTO t VALUES (1251, 1, 66.69, 'name1251');
+INSERT INTO t VALUES (1252, 2, 45.88, 'name1252');
+INSERT INTO t VALUES (1253, 3, 25.07, 'name1253');
+INSERT INTO t VALUES (1254, 4, 4.26, 'name1254');
+INSERT INTO t VALUES (1255, 5, 83.45, 'name1255');
+INSERT INTO t VALUES (1256, 6, 62.64, 'name1256');
+INSERT INTO t VALUES (1257, 7, 41.83, 'name1257');
+INSERT INTO t VALUES (1258, 8, 21.02, 'name1258');
+INSERT INTO t VALUES (1259, 9, 0.21, 'name1259');
+INSERT INTO t VALUES (1260, 0, 79.40, 'name1260');
+INSERT INTO t VALUES (1261, 1, 58.59, 'name1261');
+INSERT INTO t VALUES (1262, 2, 37.78, 'name1262');
+INSERT INTO t VALUES (1263, 3, 16.97, 'name1263');
+INSERT INTO t VALUES (1264, 4, 96.16, 'name1264');
+INSERT INTO t VALUES (1265, 5, 75.35, 'name1265');
+INSERT INTO t VALUES (1266, 6, 54.54, 'name1266');
+INSERT INTO t VALUES (1267, 7, 33.73, 'name1267');
+INSERT INTO t VALUES (1268, 8, 12.92, 'name1268');
+INSERT INTO t VALUES (1269, 9, 92.11, 'name1269');
+INSERT INTO t VALUES (1270, 0, 71.30, 'name1270');
+INSERT INTO t VALUES (1271, 1, 50.49, 'name1271');
+INSERT INTO t VALUES (1272, 2, 29.68, 'name1272');
+INSERT INTO t VALUES (1273, 3, 8.87, 'name1273');
+INSERT INTO t VALUES (1274, 4, 88.06, 'name1274');
+INSERT INTO t VALUES (1275, 5, 67.25, 'name1275');
+INSERT INTO t VALUES (1276, 6, 46.44, 'name1276');
+INSERT INTO t VALUES (1277, 7, 25.63, 'name1277');
+INSERT INTO t VALUES (1278, 8, 4.82, 'name1278');
+INSERT INTO t VALUES (1279, 9, 84.01, 'name1279');
+INSERT INTO t VALUES (1280, 0, 63.20, 'name1280');
+INSERT INTO t VALUES (1281, 1, 42.39, 'name1281');
+INSERT INTO t VALUES (1282, 2, 21.58, 'name1282');
+INSERT INTO t VALUES (1283, 3, 0.77, 'name1283');
+INSERT INTO t VALUES (1284, 4, 79.96, 'name1284');
+INSERT INTO t VALUES (1285, 5, 59.15, 'name1285');
+INSERT INTO t VALUES (1286, 6, 38.34, 'name1286');
+INSERT INTO t VALUES (1287, 7, 17.53, 'name1287');
+INSERT INTO t VALUES (1288, 8, 96.72, 'name1288');
+INSERT INTO t VALUES (1289, 9, 75.91, 'name1289');
+INSERT INTO t VALUES (1290, 0, 55.10, 'name1290');
+INSERT INTO t VALUES (1291, 1, 34.29, 'name1291');
+INSERT INTO t VALUES (1292, 2, 13.48, 'name1292');
+INSERT INTO t VALUES (1293, 3, 92.67, 'name1293');
+INSERT INTO t VALUES (1294, 4, 71.86, 'name1294');
+INSERT INTO t VALUES (1295, 5, 51.05, 'name1295');
+INSERT INTO t VALUES (1296, 6, 30.24, 'name1296');
+INSERT INTO t VALUES (1297, 7, 9.43, 'name1297');
+INSERT INTO t VALUES (1298, 8, 88.62, 'name1298');
+INSERT INTO t VALUES (1299, 9, 67.81, 'name1299');
+INSERT INTO t VALUES (1300, 0, 47.00, 'name1300');
+INSERT INTO t VALUES (1301, 1, 26.19, 'name1301');
+INSERT INTO t VALUES (1302, 2, 5.38, 'name1302');
+INSERT INTO t VALUES (1303, 3, 84.57, 'name1303');
+INSERT INTO t VALUES (1304, 4, 63.76, 'name1304');
+INSERT INTO t VALUES (1305, 5, 42.95, 'name1305');
+INSERT INTO t VALUES (1306, 6, 22.14, 'name1306');
+INSERT INTO t VALUES (1307, 7, 1.33, 'name1307');
+INSERT INTO t VALUES (1308, 8, 80.52, 'name1308');
+INSERT INTO t VALUES (1309, 9, 59.71, 'name1309');
+INSERT INTO t VALUES (1310, 0, 38.90, 'name1310');
+INSERT INTO t VALUES (1311, 1, 18.09, 'name1311');
+INSERT INTO t VALUES (1312, 2, 97.28, 'name1312');
+INSERT INTO t VALUES (1313, 3, 76.47, 'name1313');
+INSERT INTO t VALUES (1314, 4, 55.66, 'name1314');
+INSERT INTO t VALUES (1315, 5, 34.85, 'name1315');
+INSERT INTO t VALUES (1316, 6, 14.04, 'name1316');
+INSERT INTO t VALUES (1317, 7, 93.23, 'name1317');
+INSERT INTO t VALUES (1318, 8, 72.42, 'name1318');
+INSERT INTO t VALUES (1319, 9, 51.61, 'name1319');
+INSERT INTO t VALUES (1320, 0, 30.80, 'name1320');
+INSERT INTO t VALUES (1321, 1, 9.99, 'name1321');
+INSERT INTO t VALUES (1322, 2, 89.18, 'name1322');
+INSERT INTO t VALUES (1323, 3, 68.37, 'name1323');
+INSERT INTO t VALUES (1324, 4, 47.56, 'name1324');
+INSERT INTO t VALUES (1325, 5, 26.75, 'name1325');
+INSERT INTO t VALUES (1326, 6, 5.94, 'name1326');
+INSERT INTO t VALUES (1327, 7, 85.13, 'name1327');
+INSERT INTO t VALUES (1328, 8, 64.32, 'name1328');
+INSERT INTO t VALUES (1329, 9, 43.51, 'name1329');
+INSERT INTO t VALUES (1330, 0, 22.70, 'name1330');
+INSERT INTO t VALUES (1331, 1, 1.89, 'name1331');
+INSERT INTO t VALUES (1332, 2, 81.08, 'name1332');
+INSERT INTO t VALUES (1333, 3, 60.27, 'name1333');
+INSERT INTO t VALUES (1334, 4, 39.46, 'name1334');
+INSERT INTO t VALUES (1335, 5, 18.65, 'name1335');
+INSERT INTO t VALUES (1336, 6, 97.84, 'name1336');
+INSERT INTO t VALUES (1337, 7, 77.03, 'name1337');
+INSERT INTO t VALUES (1338, 8, 56.22, 'name1338');
+INSERT INTO t VALUES (1339, 9, 35.41, 'name1339');
+INSERT INTO t VALUES (1340, 0, 14.60, 'name1340');
+INSERT INTO t VALUES (1341, 1, 93.79, 'name1341');
+INSERT INTO t VALUES (1342, 2, 72.98, 'name1342');
+INSERT INTO t VALUES (1343, 3, 52.17, 'name1343');
+INSERT INTO t VALUES (1344, 4, 31.36, 'name1344');
+INSERT INTO t VALUES (1345, 5, 10.55, 'name1345');
+INSERT INTO t VALUES (1346, 6, 89.74, 'name1346');
+INSERT INTO t VALUES (1347, 7, 68.93, 'name1347');
+INSERT INTO t VALUES (1348, 8, 48.12, 'name1348');
+INSERT INTO t VALUES (1349, 9, 27.31, 'name1349');
+INSERT INTO t VALUES (1350, 0, 6.50, 'name1350');
+INSERT INTO t VALUES (1351, 1, 85.69, 'name1351');
+INSERT INTO t VALUES (1352, 2, 64.88, 'name1352');
+INSERT INTO t VALUES (1353, 3, 44.07, 'name1353');
+INSERT INTO t VALUES (1354, 4, 23.26, 'name1354');
+INSERT INTO t VALUES (1355, 5, 2.45, 'name1355');
+INSERT INTO t VALUES (1356, 6, 81.64, 'name1356');
+INSERT INTO t VALUES (1357, 7, 60.83, 'name1357');
+INSERT INTO t VALUES (1358, 8, 40.02, 'name1358');
+INSERT INTO t VALUES (1359, 9, 19.21, 'name1359');
+INSERT INTO t VALUES (1360, 0, 98.40, 'name1360');
+INSERT INTO t VALUES (1361, 1, 77.59, 'name1361');
+INSERT INTO t VALUES (1362, 2, 56.78, 'name1362');
+INSERT INTO t VALUES (1363, 3, 35.97, 'name1363');
+INSERT INTO t VALUES (1364, 4, 15.16, 'name1364');
+INSERT INTO t VALUES (1365, 5, 94.35, 'name1365');
+INSERT INTO t VALUES (1366, 6, 73.54, 'name1366');
+INSERT INTO t VALUES (1367, 7, 52.73, 'name1367');
+INSERT INTO t VALUES (1368, 8, 31.92, 'name1368');
+INSERT INTO t VALUES (1369, 9, 11.11, 'name1369');
+INSERT INTO t VALUES (1370, 0, 90.30, 'name1370');
+INSERT INTO t VALUES (1371, 1, 69.49, 'name1371');
+INSERT INTO t VALUES (1372, 2, 48.68, 'name1372');
+INSERT INTO t VALUES (1373, 3, 27.87, 'name1373');
+INSERT INTO t VALUES (1374, 4, 7.06, 'name1374');
+INSERT INTO t VALUES (1375, 5, 86.25, 'name1375');
+INSERT INTO t VALUES (1376, 6, 65.44, 'name1376');
+INSERT INTO t VALUES (1377, 7, 44.63, 'name1377');
+INSERT INTO t VALUES (1378, 8, 23.82, 'name1378');
+INSERT INTO t VALUES (1379, 9, 3.01, 'name1379');
+INSERT INTO t VALUES (1380, 0, 82.20, 'name1380');
+INSERT INTO t VALUES (1381, 1, 61.39, 'name1381');
+INSERT INTO t VALUES (1382, 2, 40.58, 'name1382');
+INSERT INTO t VALUES (1383, 3, 19.77, 'name1383');
+INSERT INTO t VALUES (1384, 4, 98.96, 'name1384');
+INSERT INTO t VALUES (1385, 5, 78.15, 'name1385');
+INSERT INTO t VALUES (1386, 6, 57.34, 'name1386');
+INSERT INTO t VALUES (1387, 7, 36.53, 'name1387');
+INSERT INTO t VALUES (1388, 8, 15.72, 'name1388');
+INSERT INTO t VALUES (1389, 9, 94.91, 'name1389');
+INSERT INTO t VALUES (1390, 0, 74.10, 'name1390');
+INSERT INTO t VALUES (1391, 1, 53.29, 'name1391');
+INSERT INTO t VALUES (1392, 2, 32.48, 'name1392');
+INSERT INTO t VALUES (1393, 3, 11.67, 'name1393');
+INSERT INTO t VALUES (1394, 4, 90.86, 'name1394');
+INSERT INTO t VALUES (1395, 5, 70.05, 'name1395');
+INSERT INTO t VALUES (1396, 6, 49.24, 'name1396');
+INSERT INTO t VALUES (1397, 7, 28.43, 'name1397');
+INSERT INTO t VALUES (1398, 8, 7.62, 'name1398');
+INSERT INTO t VALUES (1399, 9, 86.81, 'name1399');
+INSERT INTO t VALUES (1400, 0, 66.00, 'name1400');
+INSERT INTO t VALUES (1401, 1, 45.19, 'name1401');
+INSERT INTO t VALUES (1402, 2, 24.38, 'name1402');
+INSERT INTO t VALUES (1403, 3, 3.57, 'name1403');
+INSERT INTO t VALUES (1404, 4, 82.76, 'name1404');
+INSERT INTO t VALUES (1405, 5, 61.95, 'name1405');
+INSERT INTO t VALUES (1406, 6, 41.14, 'name1406');
+INSERT INTO t VALUES (1407, 7, 20.33, 'name1407');
+INSERT INTO t VALUES (1408, 8, 99.52, 'name1408');
+INSERT INTO t VALUES (1409, 9, 78.71, 'name1409');
+INSERT INTO t VALUES (1410, 0, 57.90, 'name1410');
+INSERT INTO t VALUES (1411, 1, 37.09, 'name1411');
+INSERT INTO t VALUES (1412, 2, 16.28, 'name1412');
+INSERT INTO t VALUES (1413, 3, 95.47, 'name1413');
+INSERT INTO t VALUES (1414, 4, 74.66, 'name1414');
+INSERT INTO t VALUES (1415, 5, 53.85, 'name1415');
+INSERT INTO t VALUES (1416, 6, 33.04, 'name1416');
+INSERT INTO t VALUES (1417, 7, 12.23, 'name1417');
+INSERT INTO t VALUES (1418, 8, 91.42, 'name1418');
+INSERT INTO t VALUES (1419, 9, 70.61, 'name1419');
+INSERT INTO t VALUES (1420, 0, 49.80, 'name1420');
+INSERT INTO t VALUES (1421, 1, 28.99, 'name1421');
+INSERT INTO t VALUES (1422, 2, 8.18, 'name1422');
+INSERT INTO t VALUES (1423, 3, 87.37, 'name1423');
+INSERT INTO t VALUES (1424, 4, 66.56, 'name1424');
+INSERT INTO t VALUES (1425, 5, 45.75, 'name1425');
+INSERT INTO t VALUES (1426, 6, 24.94, 'name1426');
+INSERT INTO t VALUES (1427, 7, 4.13, 'name1427');
+INSERT INTO t VALUES (1428, 8, 83.32, 'name1428');
+INSERT INTO t VALUES (1429, 9, 62.51, 'name1429');
+INSERT INTO t VALUES (1430, 0, 41.70, 'name1430');
+INSERT INTO t VALUES (1431, 1, 20.89, 'name1431');
+INSERT INTO t VALUES (1432, 2, 0.08, 'name1432');
+INSERT INTO t VALUES (1433, 3, 79.27, 'name1433');
+INSERT INTO t VALUES (1434, 4, 58.46, 'name1434');
+INSERT INTO t VALUES (1435, 5, 37.65, 'name1435');
+INSERT INTO t VALUES (1436, 6, 16.84, 'name1436');
+INSERT INTO t VALUES (1437, 7, 96.03, 'name1437');
+INSERT INTO t VALUES (1438, 8, 75.22, 'name1438');
+INSERT INTO t VALUES (1439, 9, 54.41, 'name1439');
+INSERT INTO t VALUES (1440, 0, 33.60, 'name1440');
+INSERT INTO t VALUES (1441, 1, 12.79, 'name1441');
+INSERT INTO t VALUES (1442, 2, 91.98, 'name1442');
+INSERT INTO t VALUES (1443, 3, 71.17, 'name1443');
+INSERT INTO t VALUES (1444, 4, 50.36, 'name1444');
+INSERT INTO t VALUES (1445, 5, 29.55, 'name1445');
+INSERT INTO t VALUES (1446, 6, 8.74, 'name1446');
+INSERT INTO t VALUES (1447, 7, 87.93, 'name1447');
+INSERT INTO t VALUES (1448, 8, 67.12, 'name1448');
+INSERT INTO t VALUES (1449, 9, 46.31, 'name1449');
+INSERT INTO t VALUES (1450, 0, 25.50, 'name1450');
+INSERT INTO t VALUES (1451, 1, 4.69, 'name1451');
+INSERT INTO t VALUES (1452, 2, 83.88, 'name1452');
+INSERT INTO t VALUES (1453, 3, 63.07, 'name1453');
+INSERT INTO t VALUES (1454, 4, 42.26, 'name1454');
+INSERT INTO t VALUES (1455, 5, 21.45, 'name1455');
+INSERT INTO t VALUES (1456, 6, 0.64, 'name1456');
+INSERT INTO t VALUES (1457, 7, 79.83, 'name1457');
+INSERT INTO t VALUES (1458, 8, 59.02, 'name1458');
+INSERT INTO t VALUES (1459, 9, 38.21, 'name1459');
+INSERT INTO t VALUES (1460, 0, 17.40, 'name1460');
+INSERT INTO t VALUES (1461, 1, 96.59, 'name1461');
+INSERT INTO t VALUES (1462, 2, 75.78, 'name1462');
+INSERT INTO t VALUES (1463, 3, 54.97, 'name1463');
+INSERT INTO t VALUES (1464, 4, 34.16, 'name1464');
+INSERT INTO t VALUES (1465, 5, 13.35, 'name1465');
+INSERT INTO t VALUES (1466, 6, 92.54, 'name1466');
+INSERT INTO t VALUES (1467, 7, 71.73, 'name1467');
+INSERT INTO t VALUES (1468, 8, 50.92, 'name1468');
+INSERT INTO t VALUES (1469, 9, 30.11, 'name1469');
+INSERT INTO t VALUES (1470, 0, 9.30, 'name1470');
+INSERT INTO t VALUES (1471, 1, 88.49, 'name1471');
+INSERT INTO t VALUES (1472, 2, 67.68, 'name1472');
+INSERT INTO t VALUES (1473, 3, 46.87, 'name1473');
+INSERT INTO t VALUES (1474, 4, 26.06, 'name1474');
+INSERT INTO t VALUES (1475, 5, 5.25, 'name1475');
+INSERT INTO t VALUES (1476, 6, 84.44, 'name1476');
+INSERT INTO t VALUES (1477, 7, 63.63, 'name1477');
+INSERT INTO t VALUES (1478, 8, 42.82, 'name1478');
+INSERT INTO t VALUES (1479, 9, 22.01, 'name1479');
+INSERT INTO t VALUES (1480, 0, 1.20, 'name1480');
+INSERT INTO t VALUES (1481, 1, 80.39, 'name1481');
+INSERT INTO t VALUES (1482, 2, 59.58, 'name1482');
+INSERT INTO t VALUES (1483, 3, 38.77, 'name1483');
+INSERT INTO t VALUES (1484, 4, 17.96, 'name1484');
+INSERT INTO t VALUES (1485, 5, 97.15, 'name1485');
+INSERT INTO t VALUES (1486, 6, 76.34, 'name1486');
+INSERT INTO t VALUES (1487, 7, 55.53, 'name1487');
+INSERT INTO t VALUES (1488, 8, 34.72, 'name1488');
+INSERT INTO t VALUES (1489, 9, 13.91, 'name1489');
+INSERT INTO t VALUES (1490, 0, 93.10, 'name1490');
+INSERT INTO t VALUES (1491, 1, 72.29, 'name1491');
+INSERT INTO t VALUES (1492, 2, 51.48, 'name1492');
+INSERT INTO t VALUES (1493, 3, 30.67, 'name1493');
+INSERT INTO t VALUES (1494, 4, 9.86, 'name1494');
+INSERT INTO t VALUES (1495, 5, 89.05, 'name1495');
+INSERT INTO t VALUES (1496, 6, 68.24, 'name1496');
+INSERT INTO t VALUES (1497, 7, 47.43, 'name1497');
+INSERT INTO t VALUES (1498, 8, 26.62, 'name1498');
+INSERT INTO t VALUES (1499, 9, 5.81, 'name1499');
+INSERT INTO t VALUES (1500, 0, 85.00, 'name1500');
+INSERT INTO t VALUES (1501, 1, 64.19, 'name1501');
+INSERT INTO t VALUES (1502, 2, 43.38, 'name1502');
+INSERT INTO t VALUES (1503, 3, 22.57, 'name1503');
+INSERT INTO t VALUES (1504, 4, 1.76, 'name1504');
+INSERT INTO t VALUES (1505, 5, 80.95, 'name1505');
+INSERT INTO t VALUES (1506, 6, 60.14, 'name1506');
+INSERT INTO t VALUES (1507, 7, 39.33, 'name1507');
+INSERT INTO t VALUES (1508, 8, 18.52, 'name1508');
+INSERT INTO t VALUES (1509, 9, 97.71, 'name1509');
+INSERT INTO t VALUES (1510, 0, 76.90, 'name1510');
+INSERT INTO t VALUES (1511, 1, 56.09, 'name1511');
+INSERT INTO t VALUES (1512, 2, 35.28, 'name1512');
+INSERT INTO t VALUES (1513, 3, 14.47, 'name1513');
+INSERT INTO t VALUES (1514, 4, 93.66, 'name1514');
+INSERT INTO t VALUES (1515, 5, 72.85, 'name1515');
+INSERT INTO t VALUES (1516, 6, 52.04, 'name1516');
+INSERT INTO t VALUES (1517, 7, 31.23, 'name1517');
+INSERT INTO t VALUES (1518, 8, 10.42, 'name1518');
+INSERT INTO t VALUES (1519, 9, 89.61, 'name1519');
+INSERT INTO t VALUES (1520, 0, 68.80, 'name1520');
+INSERT INTO t VALUES (1521, 1, 47.99, 'name1521');
+INSERT INTO t VALUES (1522, 2, 27.18, 'name1522');
+INSERT INTO t VALUES (1523, 3, 6.37, 'name1523');
+INSERT INTO t VALUES (1524, 4, 85.56, 'name1524');
+INSERT INTO t VALUES (1525, 5, 64.75, 'name1525');
+INSERT INTO t VALUES (1526, 6, 43.94, 'name1526');
+INSERT INTO t VALUES (1527, 7, 23.13, 'name1527');
+INSERT INTO t VALUES (1528, 8, 2.32, 'name1528');
+INSERT INTO t VALUES (1529, 9, 81.51, 'name1529');
+INSERT INTO t VALUES (1530, 0, 60.70, 'name1530');
+INSERT INTO t VALUES (1531, 1, 39.89, 'name1531');
+INSERT INTO t VALUES (1532, 2, 19.08, 'name1532');
+INSERT INTO t VALUES (1533, 3, 98.27, 'name1533');
+INSERT INTO t VALUES (1534, 4, 77.46, 'name1534');
+INSERT INTO t VALUES (1535, 5, 56.65, 'name1535');
+INSERT INTO t VALUES (1536, 6, 35.84, 'name1536');
+INSERT INTO t VALUES (1537, 7, 15.03, 'name1537');
+INSERT INTO t VALUES (1538, 8, 94.22, 'name1538');
+INSERT INTO t VALUES (1539, 9, 73.41, 'name1539');
+INSERT INTO t VALUES (1540, 0, 52.60, 'name1540');
+INSERT INTO t VALUES (1541, 1, 31.79, 'name1541');
+INSERT INTO t VALUES (1542, 2, 10.98, 'name1542');
+INSERT INTO t VALUES (1543, 3, 90.17, 'name1543');
+INSERT INTO t VALUES (1544, 4, 69.36, 'name1544');
+INSERT INTO t VALUES (1545, 5, 48.55, 'name1545');
+INSERT INTO t VALUES (1546, 6, 27.74, 'name1546');
+INSERT INTO t VALUES (1547, 7, 6.93, 'name1547');
+INSERT INTO t VALUES (1548, 8, 86.12, 'name1548');
+INSERT INTO t VALUES (1549, 9, 65.31, 'name1549');
+INSERT INTO t VALUES (1550, 0, 44.50, 'name1550');
+INSERT INTO t VALUES (1551, 1, 23.69, 'name1551');
+INSERT INTO t VALUES (1552, 2, 2.88, 'name1552');
+INSERT INTO t VALUES (1553, 3, 82.07, 'name1553');
+INSERT INTO t VALUES (1554, 4, 61.26, 'name1554');
+INSERT INTO t VALUES (1555, 5, 40.45, 'name1555');
+INSERT INTO t VALUES (1556, 6, 19.64, 'name1556');
+INSERT INTO t VALUES (1557, 7, 98.83, 'name1557');
+INSERT INTO t VALUES (1558, 8, 78.02, 'name1558');
+INSERT INTO t VALUES (1559, 9, 57.21, 'name1559');
+INSERT INTO t VALUES (1560, 0, 36.40, 'name1560');
+INSERT INTO t VALUES (1561, 1, 15.59, 'name1561');
+INSERT INTO t VALUES (1562, 2, 94.78, 'name1562');
+INSERT INTO t VALUES (1563, 3, 73.97, 'name1563');
+INSERT INTO t VALUES (1564, 4, 53.16, 'name1564');
+INSERT INTO t VALUES (1565, 5, 32.35, 'name1565');
+INSERT INTO t VALUES (1566, 6, 11.54, 'name1566');
+INSERT INTO t VALUES (1567, 7, 90.73, 'name1567');
+INSERT INTO t VALUES (1568, 8, 69.92, 'name1568');
+INSERT INTO t VALUES (1569, 9, 49.11, 'name1569');
+INSERT INTO t VALUES (1570, 0, 28.30, 'name1570');
+INSERT INTO t VALUES (1571, 1, 7.49, 'name1571');
+INSERT INTO t VALUES (1572, 2, 86.68, 'name1572');
+INSERT INTO t VALUES (1573, 3, 65.87, 'name1573');
+INSERT INTO t VALUES (1574, 4, 45.06, 'name1574');
+INSERT INTO t VALUES (1575, 5, 24.25, 'name1575');
+INSERT INTO t VALUES (1576, 6, 3.44, 'name1576');
+INSERT INTO t VALUES (1577, 7, 82.63, 'name1577');
+INSERT INTO t VALUES (1578, 8, 61.82, 'name1578');
+INSERT INTO t VALUES (1579, 9, 41.01, 'name1579');
+INSERT INTO t VALUES (1580, 0, 20.20, 'name1580');
+INSERT INTO t VALUES (1581, 1, 99.39, 'name1581');
+INSERT INTO t VALUES (1582, 2, 78.58, 'name1582');
+INSERT INTO t VALUES (1583, 3, 57.77, 'name1583');
+INSERT INTO t VALUES (1584, 4, 36.96, 'name1584');
+INSERT INTO t VALUES (1585, 5, 16.15, 'name1585');
+INSERT INTO t VALUES (1586, 6, 95.34, 'name1586');
+INSERT INTO t VALUES (1587, 7, 74.53, 'name1587');
+INSERT INTO t VALUES (1588, 8, 53.72, 'name1588');
+INSERT INTO t VALUES (1589, 9, 32.91, 'name1589');
+INSERT INTO t VALUES (1590, 0, 12.10, 'name1590');
+INSERT INTO t VALUES (1591, 1, 91.29, 'name1591');
+INSERT INTO t VALUES (1592, 2, 70.48, 'name1592');
+INSERT INTO t VALUES (1593, 3, 49.67, 'name1593');
+INSERT INTO t VALUES (1594, 4, 28.86, 'name1594');
+INSERT INTO t VALUES (1595, 5, 8.05, 'name1595');
+INSERT INTO t VALUES (1596, 6, 87.24, 'name1596');
+INSERT INTO t VALUES (1597, 7, 66.43, 'name1597');
+INSERT INTO t VALUES (1598, 8, 45.62, 'name1598');
+INSERT INTO t VALUES (1599, 9, 24.81, 'name1599');
+INSERT INTO t VALUES (1600, 0, 4.00, 'name1600');
+INSERT INTO t VALUES (1601, 1, 83.19, 'name1601');
+INSERT INTO t VALUES (1602, 2, 62.38, 'name1602');
+INSERT INTO t VALUES (1603, 3, 41.57, 'name1603');
+INSERT INTO t VALUES (1604, 4, 20.76, 'name1604');
+INSERT INTO t VALUES (1605, 5, 99.95, 'name1605');
+INSERT INTO t VALUES (1606, 6, 79.14, 'name1606');
+INSERT INTO t VALUES (1607, 7, 58.33, 'name1607');
+INSERT INTO t VALUES (1608, 8, 37.52, 'name1608');
+INSERT INTO t VALUES (1609, 9, 16.71, 'name1609');
+INSERT INTO t VALUES (1610, 0, 95.90, 'name1610');
+INSERT INTO t VALUES (1611, 1, 75.09, 'name1611');
+INSERT INTO t VALUES (1612, 2, 54.28, 'name1612');
+INSERT INTO t VALUES (1613, 3, 33.47, 'name1613');
+INSERT INTO t VALUES (1614, 4, 12.66, 'name1614');
+INSERT INTO t VALUES (1615, 5, 91.85, 'name1615');
+INSERT INTO t VALUES (1616, 6, 71.04, 'name1616');
+INSERT INTO t VALUES (1617, 7, 50.23, 'name1617');
+INSERT INTO t VALUES (1618, 8, 29.42, 'name1618');
+INSERT INTO t VALUES (1619, 9, 8.61, 'name1619');
+INSERT INTO t VALUES (1620, 0, 87.80, 'name1620');
+INSERT INTO t VALUES (1621, 1, 66.99, 'name1621');
+INSERT INTO t VALUES (1622, 2, 46.18, 'name1622');
+INSERT INTO t VALUES (1623, 3, 25.37, 'name1623');
+INSERT INTO t VALUES (1624, 4, 4.56, 'name1624');
+INSERT INTO t VALUES (1625, 5, 83.75, 'name1625');
+INSERT INTO t VALUES (1626, 6, 62.94, 'name1626');
+INSERT INTO t VALUES (1627, 7, 42.13, 'name1627');
+INSERT INTO t VALUES (1628, 8, 21.32, 'name1628');
+INSERT INTO t VALUES (1629, 9, 0.51, 'name1629');
+INSERT INTO t VALUES (1630, 0, 79.70, 'name1630');
+INSERT INTO t VALUES (1631, 1, 58.89, 'name1631');
+INSERT INTO t VALUES (1632, 2, 38.08, 'name1632');
+INSERT INTO t VALUES (1633, 3, 17.27, 'name1633');
+INSERT INTO t VALUES (1634, 4, 96.46, 'name1634');
+INSERT INTO t VALUES (1635, 5, 75.65, 'name1635');
+INSERT INTO t VALUES (1636, 6, 54.84, 'name1636');
+INSERT INTO t VALUES (1637, 7, 34.03, 'name1637');
+INSERT INTO t VALUES (1638, 8, 13.22, 'name1638');
+INSERT INTO t VALUES (1639, 9, 92.41, 'name1639');
+INSERT INTO t VALUES (1640, 0, 71.60, 'name1640');
+INSERT INTO t VALUES (1641, 1, 50.79, 'name1641');
+INSERT INTO t VALUES (1642, 2, 29.98, 'name1642');
+INSERT INTO t VALUES (1643, 3, 9.17, 'name1643');
+INSERT INTO t VALUES (1644, 4, 88.36, 'name1644');
+INSERT INTO t VALUES (1645, 5, 67.55, 'name1645');
+INSERT INTO t VALUES (1646, 6, 46.74, 'name1646');
+INSERT INTO t VALUES (1647, 7, 25.93, 'name1647');
+INSERT INTO t VALUES (1648, 8, 5.12, 'name1648');
+INSERT INTO t VALUES (1649, 9, 84.31, 'name1649');
+INSERT INTO t VALUES (1650, 0, 63.50, 'name1650');
+INSERT INTO t VALUES (1651, 1, 42.69, 'name1651');
+INSERT INTO t VALUES (1652, 2, 21.88, 'name1652');
+INSERT INTO t VALUES (1653, 3, 1.07, 'name1653');
+INSERT INTO t VALUES (1654, 4, 80.26, 'name1654');
+INSERT INTO t VALUES (1655, 5, 59.45, 'name1655');
+INSERT INTO t VALUES (1656, 6, 38.64, 'name1656');
+INSERT INTO t VALUES (1657, 7, 17.83, 'name1657');
+INSERT INTO t VALUES (1658, 8, 97.02, 'name1658');
+INSERT INTO t VALUES (1659, 9, 76.21, 'name1659');
+INSERT INTO t VALUES (1660, 0, 55.40, 'name1660');
+INSERT INTO t VALUES (1661, 1, 34.59, 'name1661');
+INSERT INTO t VALUES (1662, 2, 13.78, 'name1662');
+INSERT INTO t VALUES (1663, 3, 92.97, 'name1663');
+INSERT INTO t VALUES (1664, 4, 72.16, 'name1664');
+INSERT INTO t VALUES (1665, 5, 51.35, 'name1665');
+INSERT INTO t VALUES (1666, 6, 30.54, 'name1666');
+INSERT INTO t VALUES (1667, 7, 9.73, 'name1667');
+INSERT INTO t VALUES (1668, 8, 88.92, 'name1668');
+INSERT INTO t VALUES (1669, 9, 68.11, 'name1669');
+INSERT INTO t VALUES (1670, 0, 47.30, 'name1670');
+INSERT INTO t VALUES (1671, 1, 26.49, 'name1671');
+INSERT INTO t VALUES (1672, 2, 5.68, 'name1672');
+INSERT INTO t VALUES (1673, 3, 84.87, 'name1673');
+INSERT INTO t VALUES (1674, 4, 64.06, 'name1674');
+INSERT INTO t VALUES (1675, 5, 43.25, 'name1675');
+INSERT INTO t VALUES (1676, 6, 22.44, 'name1676');
+INSERT INTO t VALUES (1677, 7, 1.63, 'name1677');
+INSERT INTO t VALUES (1678, 8, 80.82, 'name1678');
+INSERT INTO t VALUES (1679, 9, 60.01, 'name1679');
+INSERT INTO t VALUES (1680, 0, 39.20, 'name1680');
+INSERT INTO t VALUES (1681, 1, 18.39, 'name1681');
+INSERT INTO t VALUES (1682, 2, 97.58, 'name1682');
+INSERT INTO t VALUES (1683, 3, 76.77, 'name1683');
+INSERT INTO t VALUES (1684, 4, 55.96, 'name1684');
+INSERT INTO t VALUES (1685, 5, 35.15, 'name1685');
+INSERT INTO t VALUES (1686, 6, 14.34, 'name1686');
+INSERT INTO t VALUES (1687, 7, 93.53, 'name1687');
+INSERT INTO t VALUES (1688, 8, 72.72, 'name1688');
+INSERT INTO t VALUES (1689, 9, 51.91, 'name1689');
+INSERT INTO t VALUES (1690, 0, 31.10, 'name1690');
+INSERT INTO t VALUES (1691, 1, 10.29, 'name1691');
+INSERT INTO t VALUES (1692, 2, 89.48, 'name1692');
+INSERT INTO t VALUES (1693, 3, 68.67, 'name1693');
+INSERT INTO t VALUES (1694, 4, 47.86, 'name1694');
+INSERT INTO t VALUES (1695, 5, 27.05, 'name1695');
+INSERT INTO t VALUES (1696, 6, 6.24, 'name1696');
+INSERT INTO t VALUES (1697, 7, 85.43, 'name1697');
+INSERT INTO t VALUES (1698, 8, 64.62, 'name1698');
+INSERT INTO t VALUES (1699, 9, 43.81, 'name1699');
+INSERT INTO t VALUES (1700, 0, 23.00, 'name1700');
+INSERT INTO t VALUES (1701, 1, 2.19, 'name1701');
+INSERT INTO t VALUES (1702, 2, 81.38, 'name1702');
+INSERT INTO t VALUES (1703, 3, 60.57, 'name1703');
+INSERT INTO t VALUES (1704, 4, 39.76, 'name1704');
+INSERT INTO t VALUES (1705, 5, 18.95, 'name1705');
+INSERT INTO t VALUES (1706, 6, 98.14, 'name1706');
+INSERT INTO t VALUES (1707, 7, 77.33, 'name1707');
+INSERT INTO t VALUES (1708, 8, 56.52, 'name1708');
+INSERT INTO t VALUES (1709, 9, 35.71, 'name1709');
+INSERT INTO t VALUES (1710, 0, 14.90, 'name1710');
+INSERT INTO t VALUES (1711, 1, 94.09, 'name1711');
+INSERT INTO t VALUES (1712, 2, 73.28, 'name1712');
+INSERT INTO t VALUES (1713, 3, 52.47, 'name1713');
+INSERT INTO t VALUES (1714, 4, 31.66, 'name1714');
+INSERT INTO t VALUES (1715, 5, 10.85, 'name1715');
+INSERT INTO t VALUES (1716, 6, 90.04, 'name1716');
+INSERT INTO t VALUES (1717, 7, 69.23, 'name1717');
+INSERT INTO t VALUES (1718, 8, 48.42, 'name1718');
+INSERT INTO t VALUES (1719, 9, 27.61, 'name1719');
+INSERT INTO t VALUES (1720, 0, 6.80, 'name1720');
+INSERT INTO t VALUES (1721, 1, 85.99, 'name1721');
+INSERT INTO t VALUES (1722, 2, 65.18, 'name1722');
+INSERT INTO t VALUES (1723, 3, 44.37, 'name1723');
+INSERT INTO t VALUES (1724, 4, 23.56, 'name1724');
+INSERT INTO t VALUES (1725, 5, 2.75, 'name1725');
+INSERT INTO t VALUES (1726, 6, 81.94, 'name1726');
+INSERT INTO t VALUES (1727, 7, 61.13, 'name1727');
+INSERT INTO t VALUES (1728, 8, 40.32, 'name1728');
+INSERT INTO t VALUES (1729, 9, 19.51, 'name1729');
+INSERT INTO t VALUES (1730, 0, 98.70, 'name1730');
+INSERT INTO t VALUES (1731, 1, 77.89, 'name1731');
+INSERT INTO t VALUES (1732, 2, 57.08, 'name1732');
+INSERT INTO t VALUES (1733, 3, 36.27, 'name1733');
+INSERT INTO t VALUES (1734, 4, 15.46, 'name1734');
+INSERT INTO t VALUES (1735, 5, 94.65, 'name1735');
+INSERT INTO t VALUES (1736, 6, 73.84, 'name1736');
+INSERT INTO t VALUES (1737, 7, 53.03, 'name1737');
+INSERT INTO t VALUES (1738, 8, 32.22, 'name1738');
+INSERT INTO t VALUES (1739, 9, 11.41, 'name1739');
+INSERT INTO t VALUES (1740, 0, 90.60, 'name1740');
+INSERT INTO t VALUES (1741, 1, 69.79, 'name1741');
+INSERT INTO t VALUES (1742, 2, 48.98, 'name1742');
+INSERT INTO t VALUES (1743, 3, 28.17, 'name1743');
+INSERT INTO t VALUES (1744, 4, 7.36, 'name1744');
+INSERT INTO t VALUES (1745, 5, 86.55, 'name1745');
+INSERT INTO t VALUES (1746, 6, 65.74, 'name1746');
+INSERT INTO t VALUES (1747, 7, 44.93, 'name1747');
+INSERT INTO t VALUES (1748, 8, 24.12, 'name1748');
+INSERT INTO t VALUES (1749, 9, 3.31, 'name1749');
+INSERT INTO t VALUES (1750, 0, 82.50, 'name1750');
+INSERT INTO t VALUES (1751, 1, 61.69, 'name1751');
+INSERT INTO t VALUES (1752, 2, 40.88, 'name1752');
+INSERT INTO t VALUES (1753, 3, 20.07, 'name1753');
+INSERT INTO t VALUES (1754, 4, 99.26, 'name1754');
+INSERT INTO t VALUES (1755, 5, 78.45, 'name1755');
+INSERT INTO t VALUES (1756, 6, 57.64, 'name1756');
+INSERT INTO t VALUES (1757, 7, 36.83, 'name1757');
+INSERT INTO t VALUES (1758, 8, 16.02, 'name1758');
+INSERT INTO t VALUES (1759, 9, 95.21, 'name1759');
+INSERT INTO t VALUES (1760, 0, 74.40, 'name1760');
+INSERT INTO t VALUES (1761, 1, 53.59, 'name1761');
+INSERT INTO t VALUES (1762, 2, 32.78, 'name1762');
+INSERT INTO t VALUES (1763, 3, 11.97, 'name1763');
+INSERT INTO t VALUES (1764, 4, 91.16, 'name1764');
+INSERT INTO t VALUES (1765, 5, 70.35, 'name1765');
+INSERT INTO t VALUES (1766, 6, 49.54, 'name1766');
+INSERT INTO t VALUES (1767, 7, 28.73, 'name1767');
+INSERT INTO t VALUES (1768, 8, 7.92, 'name1768');
+INSERT INTO t VALUES (1769, 9, 87.11, 'name1769');
+INSERT INTO t VALUES (1770, 0, 66.30, 'name1770');
+INSERT INTO t VALUES (1771, 1, 45.49, 'name1771');
+INSERT INTO t VALUES (1772, 2, 24.68, 'name1772');
+INSERT INTO t VALUES (1773, 3, 3.87, 'name1773');
+INSERT INTO t VALUES (1774, 4, 83.06, 'name1774');
+INSERT INTO t VALUES (1775, 5, 62.25, 'name1775');
+INSERT INTO t VALUES (1776, 6, 41.44, 'name1776');
+INSERT INTO t VALUES (1777, 7, 20.63, 'name1777');
+INSERT INTO t VALUES (1778, 8, 99.82, 'name1778');
+INSERT INTO t VALUES (1779, 9, 79.01, 'name1779');
+INSERT INTO t VALUES (1780, 0, 58.20, 'name1780');
+INSERT INTO t VALUES (1781, 1, 37.39, 'name1781');
+INSERT INTO t VALUES (1782, 2, 16.58, 'name1782');
+INSERT INTO t VALUES (1783, 3, 95.77, 'name1783');
+INSERT INTO t VALUES (1784, 4, 74.96, 'name1784');
+INSERT INTO t VALUES (1785, 5, 54.15, 'name1785');
+INSERT INTO t VALUES (1786, 6, 33.34, 'name1786');
+INSERT INTO t VALUES (1787, 7, 12.53, 'name1787');
+INSERT INTO t VALUES (1788, 8, 91.72, 'name1788');
+INSERT INTO t VALUES (1789, 9, 70.91, 'name1789');
+INSERT INTO t VALUES (1790, 0, 50.10, 'name1790');
+INSERT INTO t VALUES (1791, 1, 29.29, 'name1791');
+INSERT INTO t VALUES (1792, 2, 8.48, 'name1792');
+INSERT INTO t VALUES (1793, 3, 87.67, 'name1793');
+INSERT INTO t VALUES (1794, 4, 66.86, 'name1794');
+INSERT INTO t VALUES (1795, 5, 46.05, 'name1795');
+INSERT INTO t VALUES (1796, 6, 25.24, 'name1796');
+INSERT INTO t VALUES (1797, 7, 4.43, 'name1797');
+INSERT INTO t VALUES (1798, 8, 83.62, 'name1798');
+INSERT INTO t VALUES (1799, 9, 62.81, 'name1799');
+INSERT INTO t VALUES (1800, 0, 42.00, 'name1800');
+INSERT INTO t VALUES (1801, 1, 21.19, 'name1801');
+INSERT INTO t VALUES (1802, 2, 0.38, 'name1802');
+INSERT INTO t VALUES (1803, 3, 79.57, 'name1803');
+INSERT INTO t VALUES (1804, 4, 58.76, 'name1804');
+INSERT INTO t VALUES (1805, 5, 37.95, 'name1805');
+INSERT INTO t VALUES (1806, 6, 17.14, 'name1806');
+INSERT INTO t VALUES (1807, 7, 96.33, 'name1807');
+INSERT INTO t VALUES (1808, 8, 75.52, 'name1808');
+INSERT INTO t VALUES (1809, 9, 54.71, 'name1809');
+INSERT INTO t VALUES (1810, 0, 33.90, 'name1810');
+INSERT INTO t VALUES (1811, 1, 13.09, 'name1811');
+INSERT INTO t VALUES (1812, 2, 92.28, 'name1812');
+INSERT INTO t VALUES (1813, 3, 71.47, 'name1813');
+INSERT INTO t VALUES (1814, 4, 50.66, 'name1814');
+INSERT INTO t VALUES (1815, 5, 29.85, 'name1815');
+INSERT INTO t VALUES (1816, 6, 9.04, 'name1816');
+INSERT INTO t VALUES (1817, 7, 88.23, 'name1817');
+INSERT INTO t VALUES (1818, 8, 67.42, 'name1818');
+INSERT INTO t VALUES (1819, 9, 46.61, 'name1819');
+INSERT INTO t VALUES (1820, 0, 25.80, 'name1820');
+INSERT INTO t VALUES (1821, 1, 4.99, 'name1821');
+INSERT INTO t VALUES (1822, 2, 84.18, 'name1822');
+INSERT INTO t VALUES (1823, 3, 63.37, 'name1823');
+INSERT INTO t VALUES (1824, 4, 42.56, 'name1824');
+INSERT INTO t VALUES (1825, 5, 21.75, 'name1825');
+INSERT INTO t VALUES (1826, 6, 0.94, 'name1826');
+INSERT INTO t VALUES (1827, 7, 80.13, 'name1827');
+INSERT INTO t VALUES (1828, 8, 59.32, 'name1828');
+INSERT INTO t VALUES (1829, 9, 38.51, 'name1829');
+INSERT INTO t VALUES (1830, 0, 17.70, 'name1830');
+INSERT INTO t VALUES (1831, 1, 96.89, 'name1831');
+INSERT INTO t VALUES (1832, 2, 76.08, 'name1832');
+INSERT INTO t VALUES (1833, 3, 55.27, 'name1833');
+INSERT INTO t VALUES (1834, 4, 34.46, 'name1834');
+INSERT INTO t VALUES (1835, 5, 13.65, 'name1835');
+INSERT INTO t VALUES (1836, 6, 92.84, 'name1836');
+INSERT INTO t VALUES (1837, 7, 72.03, 'name1837');
+INSERT INTO t VALUES (1838, 8, 51.22, 'name1838');
+INSERT INTO t VALUES (1839, 9, 30.41, 'name1839');
+INSERT INTO t VALUES (1840, 0, 9.60, 'name1840');
+INSERT INTO t VALUES (1841, 1, 88.79, 'name1841');
+INSERT INTO t VALUES (1842, 2, 67.98, 'name1842');
+INSERT INTO t VALUES (1843, 3, 47.17, 'name1843');
+INSERT INTO t VALUES (1844, 4, 26.36, 'name1844');
+INSERT INTO t VALUES (1845, 5, 5.55, 'name1845');
+INSERT INTO t VALUES (1846, 6, 84.74, 'name1846');
+INSERT INTO t VALUES (1847, 7, 63.93, 'name1847');
+INSERT INTO t VALUES (1848, 8, 43.12, 'name1848');
+INSERT INTO t VALUES (1849, 9, 22.31, 'name1849');
+INSERT INTO t VALUES (1850, 0, 1.50, 'name1850');
+INSERT INTO t VALUES (1851, 1, 80.69, 'name1851');
+INSERT INTO t VALUES (1852, 2, 59.88, 'name1852');
+INSERT INTO t VALUES (1853, 3, 39.07, 'name1853');
+INSERT INTO t VALUES (1854, 4, 18.26, 'name1854');
+INSERT INTO t VALUES (1855, 5, 97.45, 'name1855');
+INSERT INTO t VALUES (1856, 6, 76.64, 'name1856');
+INSERT INTO t VALUES (1857, 7, 55.83, 'name1857');
+INSERT INTO t VALUES (1858, 8, 35.02, 'name1858');
+INSERT INTO t VALUES (1859, 9, 14.21, 'name1859');
+INSERT INTO t VALUES (1860, 0, 93.40, 'name1860');
+INSERT INTO t VALUES (1861, 1, 72.59, 'name1861');
+INSERT INTO t VALUES (1862, 2, 51.78, 'name1862');
+INSERT INTO t VALUES (1863, 3, 30.97, 'name1863');
+INSERT INTO t VALUES (1864, 4, 10.16, 'name1864');
+INSERT INTO t VALUES (1865, 5, 89.35, 'name1865');
+INSERT INTO t VALUES (1866, 6, 68.54, 'name1866');
+INSERT INTO t VALUES (1867, 7, 47.73, 'name1867');
+INSERT INTO t VALUES (1868, 8, 26.92, 'name1868');
+INSERT INTO t VALUES (1869, 9, 6.11, 'name1869');
+INSERT INTO t VALUES (1870, 0, 85.30, 'name1870');
+INSERT INTO t VALUES (1871, 1, 64.49, 'name1871');
+INSERT INTO t VALUES (1872, 2, 43.68, 'name1872');
+INSERT INTO t VALUES (1873, 3, 22.87, 'name1873');
+INSERT INTO t VALUES (1874, 4, 2.06, 'name1874');
+INSERT INTO t VALUES (1875, 5, 81.25, 'name1875');
+INSERT INTO t VALUES (1876, 6, 60.44, 'name1876');
+INSERT INTO t VALUES (1877, 7, 39.63, 'name1877');
+INSERT INTO t VALUES (1878, 8, 18.82, 'name1878');
+INSERT INTO t VALUES (1879, 9, 98.01, 'name1879');
+INSERT INTO t VALUES (1880, 0, 77.20, 'name1880');
+INSERT INTO t VALUES (1881, 1, 56.39, 'name1881');
+INSERT INTO t VALUES (1882, 2, 35.58, 'name1882');
+INSERT INTO t VALUES (1883, 3, 14.77, 'name1883');
+INSERT INTO t VALUES (1884, 4, 93.96, 'name1884');
+INSERT INTO t VALUES (1885, 5, 73.15, 'name1885');
+INSERT INTO t VALUES (1886, 6, 52.34, 'name1886');
+INSERT INTO t VALUES (1887, 7, 31.53, 'name1887');
+INSERT INTO t VALUES (1888, 8, 10.72, 'name1888');
+INSERT INTO t VALUES (1889, 9, 89.91, 'name1889');
+INSERT INTO t VALUES (1890, 0, 69.10, 'name1890');
+INSERT INTO t VALUES (1891, 1, 48.29, 'name1891');
+INSERT INTO t VALUES (1892, 2, 27.48, 'name1892');
+INSERT INTO t VALUES (1893, 3, 6.67, 'name1893');
+INSERT INTO t VALUES (1894, 4, 85.86, 'name1894');
+INSERT INTO t VALUES (1895, 5, 65.05, 'name1895');
+INSERT INTO t VALUES (1896, 6, 44.24, 'name1896');
+INSERT INTO t VALUES (1897, 7, 23.43, 'name1897');
+INSERT INTO t VALUES (1898, 8, 2.62, 'name1898');
+INSERT INTO t VALUES (1899, 9, 81.81, 'name1899');
+INSERT INTO t VALUES (1900, 0, 61.00, 'name1900');
+INSERT INTO t VALUES (1901, 1, 40.19, 'name1901');
+INSERT INTO t VALUES (1902, 2, 19.38, 'name1902');
+INSERT INTO t VALUES (1903, 3, 98.57, 'name1903');
+INSERT INTO t VALUES (1904, 4, 77.76, 'name1904');
+INSERT INTO t VALUES (1905, 5, 56.95, 'name1905');
+INSERT INTO t VALUES (1906, 6, 36.14, 'name1906');
+INSERT INTO t VALUES (1907, 7, 15.33, 'name1907');
+INSERT INTO t VALUES (1908, 8, 94.52, 'name1908');
+INSERT INTO t VALUES (1909, 9, 73.71, 'name1909');
+INSERT INTO t VALUES (1910, 0, 52.90, 'name1910');
+INSERT INTO t VALUES (1911, 1, 32.09, 'name1911');
+INSERT INTO t VALUES (1912, 2, 11.28, 'name1912');
+INSERT INTO t VALUES (1913, 3, 90.47, 'name1913');
+INSERT INTO t VALUES (1914, 4, 69.66, 'name1914');
+INSERT INTO t VALUES (1915, 5, 48.85, 'name1915');
+INSERT INTO t VALUES (1916, 6, 28.04, 'name1916');
+INSERT INTO t VALUES (1917, 7, 7.23, 'name1917');
+INSERT INTO t VALUES (1918, 8, 86.42, 'name1918');
+INSERT INTO t VALUES (1919, 9, 65.61, 'name1919');
+INSERT INTO t VALUES (1920, 0, 44.80, 'name1920');
+INSERT INTO t VALUES (1921, 1, 23.99, 'name1921');
+INSERT INTO t VALUES (1922, 2, 3.18, 'name1922');
+INSERT INTO t VALUES (1923, 3, 82.37, 'name1923');
+INSERT INTO t VALUES (1924, 4, 61.56, 'name1924');
+INSERT INTO t VALUES (1925, 5, 40.75, 'name1925');
+INSERT INTO t VALUES (1926, 6, 19.94, 'name1926');
+INSERT INTO t VALUES (1927, 7, 99.13, 'name1927');
+INSERT INTO t VALUES (1928, 8, 78.32, 'name1928');
+INSERT INTO t VALUES (1929, 9, 57.51, 'name1929');
+INSERT INTO t VALUES (1930, 0, 36.70, 'name1930');
+INSERT INTO t VALUES (1931, 1, 15.89, 'name1931');
+INSERT INTO t VALUES (1932, 2, 95.08, 'name1932');
+INSERT INTO t VALUES (1933, 3, 74.27, 'name1933');
+INSERT INTO t VALUES (1934, 4, 53.46, 'name1934');
+INSERT INTO t VALUES (1935, 5, 32.65, 'name1935');
+INSERT INTO t VALUES (1936, 6, 11.84, 'name1936');
+INSERT INTO t VALUES (1937, 7, 91.03, 'name1937');
+INSERT INTO t VALUES (1938, 8, 70.22, 'name1938');
+INSERT INTO t VALUES (1939, 9, 49.41, 'name1939');
+INSERT INTO t VALUES (1940, 0, 28.60, 'name1940');
+INSERT INTO t VALUES (1941, 1, 7.79, 'name1941');
+INSERT INTO t VALUES (1942, 2, 86.98, 'name1942');
+INSERT INTO t VALUES (1943, 3, 66.17, 'name1943');
+INSERT INTO t VALUES (1944, 4, 45.36, 'name1944');
+INSERT INTO t VALUES (1945, 5, 24.55, 'name1945');
+INSERT INTO t VALUES (1946, 6, 3.74, 'name1946');
+INSERT INTO t VALUES (1947, 7, 82.93, 'name1947');
+INSERT INTO t VALUES (1948, 8, 62.12, 'name1948');
+INSERT INTO t VALUES (1949, 9, 41.31, 'name1949');
+INSERT INTO t VALUES (1950, 0, 20.50, 'name1950');
+INSERT INTO t VALUES (1951, 1, 99.69, 'name1951');
+INSERT INTO t VALUES (1952, 2, 78.88, 'name1952');
+INSERT INTO t VALUES (1953, 3, 58.07, 'name1953');
+INSERT INTO t VALUES (1954, 4, 37.26, 'name1954');
+INSERT INTO t VALUES (1955, 5, 16.45, 'name1955');
+INSERT INTO t VALUES (1956, 6, 95.64, 'name1956');
+INSERT INTO t VALUES (1957, 7, 74.83, 'name1957');
+INSERT INTO t VALUES (1958, 8, 54.02, 'name1958');
+INSERT INTO t VALUES (1959, 9, 33.21, 'name1959');
+INSERT INTO t VALUES (1960, 0, 12.40, 'name1960');
+INSERT INTO t VALUES (1961, 1, 91.59, 'name1961');
+INSERT INTO t VALUES (1962, 2, 70.78, 'name1962');
+INSERT INTO t VALUES (1963, 3, 49.97, 'name1963');
+INSERT INTO t VALUES (1964, 4, 29.16, 'name1964');
+INSERT INTO t VALUES (1965, 5, 8.35, 'name1965');
+INSERT INTO t VALUES (1966, 6, 87.54, 'name1966');
+INSERT INTO t VALUES (1967, 7, 66.73, 'name1967');
+INSERT INTO t VALUES (1968, 8, 45.92, 'name1968');
+INSERT INTO t VALUES (1969, 9, 25.11, 'name1969');
+INSERT INTO t VALUES (1970, 0, 4.30, 'name1970');
+INSERT INTO t VALUES (1971, 1, 83.49, 'name1971');
+INSERT INTO t VALUES (1972, 2, 62.68, 'name1972');
+INSERT INTO t VALUES (1973, 3, 41.87, 'name1973');
+INSERT INTO t VALUES (1974, 4, 21.06, 'name1974');
+INSERT INTO t VALUES (1975, 5, 0.25, 'name1975');
+INSERT INTO t VALUES (1976, 6, 79.44, 'name1976');
+INSERT INTO t VALUES (1977, 7, 58.63, 'name1977');
+INSERT INTO t VALUES (1978, 8, 37.82, 'name1978');
+INSERT INTO t VALUES (1979, 9, 17.01, 'name1979');
+INSERT INTO t VALUES (1980, 0, 96.20, 'name1980');
+INSERT INTO t VALUES (1981, 1, 75.39, 'name1981');
+INSERT INTO t VALUES (1982, 2, 54.58, 'name1982');
+INSERT INTO t VALUES (1983, 3, 33.77, 'name1983');
+INSERT INTO t VALUES (1984, 4, 12.96, 'name1984');
+INSERT INTO t VALUES (1985, 5, 92.15, 'name1985');
+INSERT INTO t VALUES (1986, 6, 71.34, 'name1986');
+INSERT INTO t VALUES (1987, 7, 50.53, 'name1987');
+INSERT INTO t VALUES (1988, 8, 29.72, 'name1988');
+INSERT INTO t VALUES (1989, 9, 8.91, 'name1989');
+INSERT INTO t VALUES (1990, 0, 88.10, 'name1990');
+INSERT INTO t VALUES (1991, 1, 67.29, 'name1991');
+INSERT INTO t VALUES (1992, 2, 46.48, 'name1992');
+INSERT INTO t VALUES (1993, 3, 25.67, 'name1993');
+INSERT INTO t VALUES (1994, 4, 4.86, 'name1994');
+INSERT INTO t VALUES (1995, 5, 84.05, 'name1995');
+INSERT INTO t VALUES (1996, 6, 63.24, 'name1996');
+INSERT INTO t VALUES (1997, 7, 42.43, 'name1997');
+INSERT INTO t VALUES (1998, 8, 21.62, 'name1998');
+INSERT INTO t VALUES (1999, 9, 0.81, 'name1999');
+INSERT INTO t VALUES (2000, 0, 80.00, 'name2000');
+INSERT INTO t VALUES (2001, 1, 59.19, 'name2001');
+INSERT INTO t VALUES (2002, 2, 38.38, 'name2002');
+INSERT INTO t VALUES (2003, 3, 17.57, 'name2003');
+INSERT INTO t VALUES (2004, 4, 96.76, 'name2004');
+INSERT INTO t VALUES (2005, 5, 75.95, 'name2005');
+INSERT INTO t VALUES (2006, 6, 55.14, 'name2006');
+INSERT INTO t VALUES (2007, 7, 34.33, 'name2007');
+INSERT INTO t VALUES (2008, 8, 13.52, 'name2008');
+INSERT INTO t VALUES (2009, 9, 92.71, 'name2009');
+INSERT INTO t VALUES (2010, 0, 71.90, 'name2010');
+INSERT INTO t VALUES (2011, 1, 51.09, 'name2011');
+INSERT INTO t VALUES (2012, 2, 30.28, 'name2012');
+INSERT INTO t VALUES (2013, 3, 9.47, 'name2013');
+INSERT INTO t VALUES (2014, 4, 88.66, 'name2014');
+INSERT INTO t VALUES (2015, 5, 67.85, 'name2015');
+INSERT INTO t VALUES (2016, 6, 47.04, 'name2016');
+INSERT INTO t VALUES (2017, 7, 26.23, 'name2017');
+INSERT INTO t VALUES (2018, 8, 5.42, 'name2018');
+INSERT INTO t VALUES (2019, 9, 84.61, 'name2019');
+INSERT INTO t VALUES (2020, 0, 63.80, 'name2020');
+INSERT INTO t VALUES (2021, 1, 42.99, 'name2021');
+INSERT INTO t VALUES (2022, 2, 22.18, 'name2022');
+INSERT INTO t VALUES (2023, 3, 1.37, 'name2023');
+INSERT INTO t VALUES (2024, 4, 80.56, 'name2024');
+INSERT INTO t VALUES (2025, 5, 59.75, 'name2025');
+INSERT INTO t VALUES (2026, 6, 38.94, 'name2026');
+INSERT INTO t VALUES (2027, 7, 18.13, 'name2027');
+INSERT INTO t VALUES (2028, 8, 97.32, 'name2028');
+INSERT INTO t VALUES (2029, 9, 76.51, 'name2029');
+INSERT INTO t VALUES (2030, 0, 55.70, 'name2030');
+INSERT INTO t VALUES (2031, 1, 34.89, 'name2031');
+INSERT INTO t VALUES (2032, 2, 14.08, 'name2032');
+INSERT INTO t VALUES (2033, 3, 93.27, 'name2033');
+INSERT INTO t VALUES (2034, 4, 72.46, 'name2034');
+INSERT INTO t VALUES (2035, 5, 51.65, 'name2035');
+INSERT INTO t VALUES (2036, 6, 30.84, 'name2036');
+INSERT INTO t VALUES (2037, 7, 10.03, 'name2037');
+INSERT INTO t VALUES (2038, 8, 89.22, 'name2038');
+INSERT INTO t VALUES (2039, 9, 68.41, 'name2039');
+INSERT INTO t VALUES (2040, 0, 47.60, 'name2040');
+INSERT INTO t VALUES (2041, 1, 26.79, 'name2041');
+INSERT INTO t VALUES (2042, 2, 5.98, 'name2042');
+INSERT INTO t VALUES (2043, 3, 85.17, 'name2043');
+INSERT INTO t VALUES (2044, 4, 64.36, 'name2044');
+INSERT INTO t VALUES (2045, 5, 43.55, 'name2045');
+INSERT INTO t VALUES (2046, 6, 22.74, 'name2046');
+INSERT INTO t VALUES (2047, 7, 1.93, 'name2047');
+INSERT INTO t VALUES (2048, 8, 81.12, 'name2048');
+INSERT INTO t VALUES (2049, 9, 60.31, 'name2049');
+INSERT INTO t VALUES (2050, 0, 39.50, 'name2050');
+INSERT INTO t VALUES (2051, 1, 18.69, 'name2051');
+INSERT INTO t VALUES (2052, 2, 97.88, 'name2052');
+INSERT INTO t VALUES (2053, 3, 77.07, 'name2053');
+INSERT INTO t VALUES (2054, 4, 56.26, 'name2054');
+INSERT INTO t VALUES (2055, 5, 35.45, 'name2055');
+INSERT INTO t VALUES (2056, 6, 14.64, 'name2056');
+INSERT INTO t VALUES (2057, 7, 93.83, 'name2057');
+INSERT INTO t VALUES (2058, 8, 73.02, 'name2058');
+INSERT INTO t VALUES (2059, 9, 52.21, 'name2059');
+INSERT INTO t VALUES (2060, 0, 31.40, 'name2060');
+INSERT INTO t VALUES (2061, 1, 10.59, 'name2061');
+INSERT INTO t VALUES (2062, 2, 89.78, 'name2062');
+INSERT INTO t VALUES (2063, 3, 68.97, 'name2063');
+INSERT INTO t VALUES (2064, 4, 48.16, 'name2064');
+INSERT INTO t VALUES (2065, 5, 27.35, 'name2065');
+INSERT INTO t VALUES (2066, 6, 6.54, 'name2066');
+INSERT INTO t VALUES (2067, 7, 85.73, 'name2067');
+INSERT INTO t VALUES (2068, 8, 64.92, 'name2068');
+INSERT INTO t VALUES (2069, 9, 44.11, 'name2069');
+INSERT INTO t VALUES (2070, 0, 23.30, 'name2070');
+INSERT INTO t VALUES (2071, 1, 2.49, 'name2071');
+INSERT INTO t VALUES (2072, 2, 81.68, 'name2072');
+INSERT INTO t VALUES (2073, 3, 60.87, 'name2073');
+INSERT INTO t VALUES (2074, 4, 40.06, 'name2074');
+INSERT INTO t VALUES (2075, 5, 19.25, 'name2075');
+INSERT INTO t VALUES (2076, 6, 98.44, 'name2076');
+INSERT INTO t VALUES (2077, 7, 77.63, 'name2077');
+INSERT INTO t VALUES (2078, 8, 56.82, 'name2078');
+INSERT INTO t VALUES (2079, 9, 36.01, 'name2079');
+INSERT INTO t VALUES (2080, 0, 15.20, 'name2080');
+INSERT INTO t VALUES (2081, 1, 94.39, 'name2081');
+INSERT INTO t VALUES (2082, 2, 73.58, 'name2082');
+INSERT INTO t VALUES (2083, 3, 52.77, 'name2083');
+INSERT INTO t VALUES (2084, 4, 31.96, 'name2084');
+INSERT INTO t VALUES (2085, 5, 11.15, 'name2085');
+INSERT INTO t VALUES (2086, 6, 90.34, 'name2086');
+INSERT INTO t VALUES (2087, 7, 69.53, 'name2087');
+INSERT INTO t VALUES (2088, 8, 48.72, 'name2088');
+INSERT INTO t VALUES (2089, 9, 27.91, 'name2089');
+INSERT INTO t VALUES (2090, 0, 7.10, 'name2090');
+INSERT INTO t VALUES (2091, 1, 86.29, 'name2091');
+INSERT INTO t VALUES (2092, 2, 65.48, 'name2092');
+INSERT INTO t VALUES (2093, 3, 44.67, 'name2093');
+INSERT INTO t VALUES (2094, 4, 23.86, 'name2094');
+INSERT INTO t VALUES (2095, 5, 3.05, 'name2095');
+INSERT INTO t VALUES (2096, 6, 82.24, 'name2096');
+INSERT INTO t VALUES (2097, 7, 61.43, 'name2097');
+INSERT INTO t VALUES (2098, 8, 40.62, 'name2098');
+INSERT INTO t VALUES (2099, 9, 19.81, 'name2099');
+INSERT INTO t VALUES (2100, 0, 99.00, 'name2100');
+INSERT INTO t VALUES (2101, 1, 78.19, 'name2101');
+INSERT INTO t VALUES (2102, 2, 57.38, 'name2102');
+INSERT INTO t VALUES (2103, 3, 36.57, 'name2103');
+INSERT INTO t VALUES (2104, 4, 15.76, 'name2104');
+INSERT INTO t VALUES (2105, 5, 94.95, 'name2105');
+INSERT INTO t VALUES (2106, 6, 74.14, 'name2106');
+INSERT INTO t VALUES (2107, 7, 53.33, 'name2107');
+INSERT INTO t VALUES (2108, 8, 32.52, 'name2108');
+INSERT INTO t VALUES (2109, 9, 11.71, 'name2109');
+INSERT INTO t VALUES (2110, 0, 90.90, 'name2110');
+INSERT INTO t VALUES (2111, 1, 70.09, 'name2111');
+INSERT INTO t VALUES (2112, 2, 49.28, 'name2112');
+INSERT INTO t VALUES (2113, 3, 28.47, 'name2113');
+INSERT INTO t VALUES (2114, 4, 7.66, 'name2114');
+INSERT INTO t VALUES (2115, 5, 86.85, 'name2115');
+INSERT INTO t VALUES (2116, 6, 66.04, 'name2116');
+INSERT INTO t VALUES (2117, 7, 45.23, 'name2117');
+INSERT INTO t VALUES (2118, 8, 24.42, 'name2118');
+INSERT INTO t VALUES (2119, 9, 3.61, 'name2119');
+INSERT INTO t VALUES (2120, 0, 82.80, 'name2120');
+INSERT INTO t VALUES (2121, 1, 61.99, 'name2121');
+INSERT INTO t VALUES (2122, 2, 41.18, 'name2122');
+INSERT INTO t VALUES (2123, 3, 20.37, 'name2123');
+INSERT INTO t VALUES (2124, 4, 99.56, 'name2124');
+INSERT INTO t VALUES (2125, 5, 78.75, 'name2125');
+INSERT INTO t VALUES (2126, 6, 57.94, 'name2126');
+INSERT INTO t VALUES (2127, 7, 37.13, 'name2127');
+INSERT INTO t VALUES (2128, 8, 16.32, 'name2128');
+INSERT INTO t VALUES (2129, 9, 95.51, 'name2129');
+INSERT INTO t VALUES (2130, 0, 74.70, 'name2130');
+INSERT INTO t VALUES (2131, 1, 53.89, 'name2131');
+INSERT INTO t VALUES (2132, 2, 33.08, 'name2132');
+INSERT INTO t VALUES (2133, 3, 12.27, 'name2133');
+INSERT INTO t VALUES (2134, 4, 91.46, 'name2134');
+INSERT INTO t VALUES (2135, 5, 70.65, 'name2135');
+INSERT INTO t VALUES (2136, 6, 49.84, 'name2136');
+INSERT INTO t VALUES (2137, 7, 29.03, 'name2137');
+INSERT INTO t VALUES (2138, 8, 8.22, 'name2138');
+INSERT INTO t VALUES (2139, 9, 87.41, 'name2139');
+INSERT INTO t VALUES (2140, 0, 66.60, 'name2140');
+INSERT INTO t VALUES (2141, 1, 45.79, 'name2141');
+INSERT INTO t VALUES (2142, 2, 24.98, 'name2142');
+INSERT INTO t VALUES (2143, 3, 4.17, 'name2143');
+INSERT INTO t VALUES (2144, 4, 83.36, 'name2144');
+INSERT INTO t VALUES (2145, 5, 62.55, 'name2145');
+INSERT INTO t VALUES (2146, 6, 41.74, 'name2146');
+INSERT INTO t VALUES (2147, 7, 20.93, 'name2147');
+INSERT INTO t VALUES (2148, 8, 0.12, 'name2148');
+INSERT INTO t VALUES (2149, 9, 79.31, 'name2149');
+INSERT INTO t VALUES (2150, 0, 58.50, 'name2150');
+INSERT INTO t VALUES (2151, 1, 37.69, 'name2151');
+INSERT INTO t VALUES (2152, 2, 16.88, 'name2152');
+INSERT INTO t VALUES (2153, 3, 96.07, 'name2153');
+INSERT INTO t VALUES (2154, 4, 75.26, 'name2154');
+INSERT INTO t VALUES (2155, 5, 54.45, 'name2155');
+INSERT INTO t VALUES (2156, 6, 33.64, 'name2156');
+INSERT INTO t VALUES (2157, 7, 12.83, 'name2157');
+INSERT INTO t VALUES (2158, 8, 92.02, 'name2158');
+INSERT INTO t VALUES (2159, 9, 71.21, 'name2159');
+INSERT INTO t VALUES (2160, 0, 50.40, 'name2160');
+INSERT INTO t VALUES (2161, 1, 29.59, 'name2161');
+INSERT INTO t VALUES (2162, 2, 8.78, 'name2162');
+INSERT INTO t VALUES (2163, 3, 87.97, 'name2163');
+INSERT INTO t VALUES (2164, 4, 67.16, 'name2164');
+INSERT INTO t VALUES (2165, 5, 46.35, 'name2165');
+INSERT INTO t VALUES (2166, 6, 25.54, 'name2166');
+INSERT INTO t VALUES (2167, 7, 4.73, 'name2167');
+INSERT INTO t VALUES (2168, 8, 83.92, 'name2168');
+INSERT INTO t VALUES (2169, 9, 63.11, 'name2169');
+INSERT INTO t VALUES (2170, 0, 42.30, 'name2170');
+INSERT INTO t VALUES (2171, 1, 21.49, 'name2171');
+INSERT INTO t VALUES (2172, 2, 0.68, 'name2172');
+INSERT INTO t VALUES (2173, 3, 79.87, 'name2173');
+INSERT INTO t VALUES (2174, 4, 59.06, 'name2174');
+INSERT INTO t VALUES (2175, 5, 38.25, 'name2175');
+INSERT INTO t VALUES (2176, 6, 17.44, 'name2176');
+INSERT INTO t VALUES (2177, 7, 96.63, 'name2177');
+INSERT INTO t VALUES (2178, 8, 75.82, 'name2178');
+INSERT INTO t VALUES (2179, 9, 55.01, 'name2179');
+INSERT INTO t VALUES (2180, 0, 34.20, 'name2180');
+INSERT INTO t VALUES (2181, 1, 13.39, 'name2181');
+INSERT INTO t VALUES (2182, 2, 92.58, 'name2182');
+INSERT INTO t VALUES (2183, 3, 71.77, 'name2183');
+INSERT INTO t VALUES (2184, 4, 50.96, 'name2184');
+INSERT INTO t VALUES (2185, 5, 30.15, 'name2185');
+INSERT INTO t VALUES (2186, 6, 9.34, 'name2186');
+INSERT INTO t VALUES (2187, 7, 88.53, 'name2187');
+INSERT INTO t VALUES (2188, 8, 67.72, 'name2188');
+INSERT INTO t VALUES (2189, 9, 46.91, 'name2189');
+INSERT INTO t VALUES (2190, 0, 26.10, 'name2190');
+INSERT INTO t VALUES (2191, 1, 5.29, 'name2191');
+INSERT INTO t VALUES (2192, 2, 84.48, 'name2192');
+INSERT INTO t VALUES (2193, 3, 63.67, 'name2193');
+INSERT INTO t VALUES (2194, 4, 42.86, 'name2194');
+INSERT INTO t VALUES (2195, 5, 22.05, 'name2195');
+INSERT INTO t VALUES (2196, 6, 1.24, 'name2196');
+INSERT INTO t VALUES (2197, 7, 80.43, 'name2197');
+INSERT INTO t VALUES (2198, 8, 59.62, 'name2198');
+INSERT INTO t VALUES (2199, 9, 38.81, 'name2199');
+INSERT INTO t VALUES (2200, 0, 18.00, 'name2200');
+INSERT INTO t VALUES (2201, 1, 97.19, 'name2201');
+INSERT INTO t VALUES (2202, 2, 76.38, 'name2202');
+INSERT INTO t VALUES (2203, 3, 55.57, 'name2203');
+INSERT INTO t VALUES (2204, 4, 34.76, 'name2204');
+INSERT INTO t VALUES (2205, 5, 13.95, 'name2205');
+INSERT INTO t VALUES (2206, 6, 93.14, 'name2206');
+INSERT INTO t VALUES (2207, 7, 72.33, 'name2207');
+INSERT INTO t VALUES (2208, 8, 51.52, 'name2208');
+INSERT INTO t VALUES (2209, 9, 30.71, 'name2209');
+INSERT INTO t VALUES (2210, 0, 9.90, 'name2210');
+INSERT INTO t VALUES (2211, 1, 89.09, 'name2211');
+INSERT INTO t VALUES (2212, 2, 68.28, 'name2212');
+INSERT INTO t VALUES (2213, 3, 47.47, 'name2213');
+INSERT INTO t VALUES (2214, 4, 26.66, 'name2214');
+INSERT INTO t VALUES (2215, 5, 5.85, 'name2215');
+INSERT INTO t VALUES (2216, 6, 85.04, 'name2216');
+INSERT INTO t VALUES (2217, 7, 64.23, 'name2217');
+INSERT INTO t VALUES (2218, 8, 43.42, 'name2218');
+INSERT INTO t VALUES (2219, 9, 22.61, 'name2219');
+INSERT INTO t VALUES (2220, 0, 1.80, 'name2220');
+INSERT INTO t VALUES (2221, 1, 80.99, 'name2221');
+INSERT INTO t VALUES (2222, 2, 60.18, 'name2222');
+INSERT INTO t VALUES (2223, 3, 39.37, 'name2223');
+INSERT INTO t VALUES (2224, 4, 18.56, 'name2224');
+INSERT INTO t VALUES (2225, 5, 97.75, 'name2225');
+INSERT INTO t VALUES (2226, 6, 76.94, 'name2226');
+INSERT INTO t VALUES (2227, 7, 56.13, 'name2227');
+INSERT INTO t VALUES (2228, 8, 35.32, 'name2228');
+INSERT INTO t VALUES (2229, 9, 14.51, 'name2229');
+INSERT INTO t VALUES (2230, 0, 93.70, 'name2230');
+INSERT INTO t VALUES (2231, 1, 72.89, 'name2231');
+INSERT INTO t VALUES (2232, 2, 52.08, 'name2232');
+INSERT INTO t VALUES (2233, 3, 31.27, 'name2233');
+INSERT INTO t VALUES (2234, 4, 10.46, 'name2234');
+INSERT INTO t VALUES (2235, 5, 89.65, 'name2235');
+INSERT INTO t VALUES (2236, 6, 68.84, 'name2236');
+INSERT INTO t VALUES (2237, 7, 48.03, 'name2237');
+INSERT INTO t VALUES (2238, 8, 27.22, 'name2238');
+INSERT INTO t VALUES (2239, 9, 6.41, 'name2239');
+INSERT INTO t VALUES (2240, 0, 85.60, 'name2240');
+INSERT INTO t VALUES (2241, 1, 64.79, 'name2241');
+INSERT INTO t VALUES (2242, 2, 43.98, 'name2242');
+INSERT INTO t VALUES (2243, 3, 23.17, 'name2243');
+INSERT INTO t VALUES (2244, 4, 2.36, 'name2244');
+INSERT INTO t VALUES (2245, 5, 81.55, 'name2245');
+INSERT INTO t VALUES (2246, 6, 60.74, 'name2246');
+INSERT INTO t VALUES (2247, 7, 39.93, 'name2247');
+INSERT INTO t VALUES (2248, 8, 19.12, 'name2248');
+INSERT INTO t VALUES (2249, 9, 98.31, 'name2249');
+INSERT INTO t VALUES (2250, 0, 77.50, 'name2250');
+INSERT INTO t VALUES (2251, 1, 56.69, 'name2251');
+INSERT INTO t VALUES (2252, 2, 35.88, 'name2252');
+INSERT INTO t VALUES (2253, 3, 15.07, 'name2253');
+INSERT INTO t VALUES (2254, 4, 94.26, 'name2254');
+INSERT INTO t VALUES (2255, 5, 73.45, 'name2255');
+INSERT INTO t VALUES (2256, 6, 52.64, 'name2256');
+INSERT INTO t VALUES (2257, 7, 31.83, 'name2257');
+INSERT INTO t VALUES (2258, 8, 11.02, 'name2258');
+INSERT INTO t VALUES (2259, 9, 90.21, 'name2259');
+INSERT INTO t VALUES (2260, 0, 69.40, 'name2260');
+INSERT INTO t VALUES (2261, 1, 48.59, 'name2261');
+INSERT INTO t VALUES (2262, 2, 27.78, 'name2262');
+INSERT INTO t VALUES (2263, 3, 6.97, 'name2263');
+INSERT INTO t VALUES (2264, 4, 86.16, 'name2264');
+INSERT INTO t VALUES (2265, 5, 65.35, 'name2265');
+INSERT INTO t VALUES (2266, 6, 44.54, 'name2266');
+INSERT INTO t VALUES (2267, 7, 23.73, 'name2267');
+INSERT INTO t VALUES (2268, 8, 2.92, 'name2268');
+INSERT INTO t VALUES (2269, 9, 82.11, 'name2269');
+INSERT INTO t VALUES (2270, 0, 61.30, 'name2270');
+INSERT INTO t VALUES (2271, 1, 40.49, 'name2271');
+INSERT INTO t VALUES (2272, 2, 19.68, 'name2272');
+INSERT INTO t VALUES (2273, 3, 98.87, 'name2273');
+INSERT INTO t VALUES (2274, 4, 78.06, 'name2274');
+INSERT INTO t VALUES (2275, 5, 57.25, 'name2275');
+INSERT INTO t VALUES (2276, 6, 36.44, 'name2276');
+INSERT INTO t VALUES (2277, 7, 15.63, 'name2277');
+INSERT INTO t VALUES (2278, 8, 94.82, 'name2278');
+INSERT INTO t VALUES (2279, 9, 74.01, 'name2279');
+INSERT INTO t VALUES (2280, 0, 53.20, 'name2280');
+INSERT INTO t VALUES (2281, 1, 32.39, 'name2281');
+INSERT INTO t VALUES (2282, 2, 11.58, 'name2282');
+INSERT INTO t VALUES (2283, 3, 90.77, 'name2283');
+INSERT INTO t VALUES (2284, 4, 69.96, 'name2284');
+INSERT INTO t VALUES (2285, 5, 49.15, 'name2285');
+INSERT INTO t VALUES (2286, 6, 28.34, 'name2286');
+INSERT INTO t VALUES (2287, 7, 7.53, 'name2287');
+INSERT INTO t VALUES (2288, 8, 86.72, 'name2288');
+INSERT INTO t VALUES (2289, 9, 65.91, 'name2289');
+INSERT INTO t VALUES (2290, 0, 45.10, 'name2290');
+INSERT INTO t VALUES (2291, 1, 24.29, 'name2291');
+INSERT INTO t VALUES (2292, 2, 3.48, 'name2292');
+INSERT INTO t VALUES (2293, 3, 82.67, 'name2293');
+INSERT INTO t VALUES (2294, 4, 61.86, 'name2294');
+INSERT INTO t VALUES (2295, 5, 41.05, 'name2295');
+INSERT INTO t VALUES (2296, 6, 20.24, 'name2296');
+INSERT INTO t VALUES (2297, 7, 99.43, 'name2297');
+INSERT INTO t VALUES (2298, 8, 78.62, 'name2298');
+INSERT INTO t VALUES (2299, 9, 57.81, 'name2299');
+INSERT INTO t VALUES (2300, 0, 37.00, 'name2300');
+INSERT INTO t VALUES (2301, 1, 16.19, 'name2301');
+INSERT INTO t VALUES (2302, 2, 95.38, 'name2302');
+INSERT INTO t VALUES (2303, 3, 74.57, 'name2303');
+INSERT INTO t VALUES (2304, 4, 53.76, 'name2304');
+INSERT INTO t VALUES (2305, 5, 32.95, 'name2305');
+INSERT INTO t VALUES (2306, 6, 12.14, 'name2306');
+INSERT INTO t VALUES (2307, 7, 91.33, 'name2307');
+INSERT INTO t VALUES (2308, 8, 70.52, 'name2308');
+INSERT INTO t VALUES (2309, 9, 49.71, 'name2309');
+INSERT INTO t VALUES (2310, 0, 28.90, 'name2310');
+INSERT INTO t VALUES (2311, 1, 8.09, 'name2311');
+INSERT INTO t VALUES (2312, 2, 87.28, 'name2312');
+INSERT INTO t VALUES (2313, 3, 66.47, 'name2313');
+INSERT INTO t VALUES (2314, 4, 45.66, 'name2314');
+INSERT INTO t VALUES (2315, 5, 24.85, 'name2315');
+INSERT INTO t VALUES (2316, 6, 4.04, 'name2316');
+INSERT INTO t VALUES (2317, 7, 83.23, 'name2317');
+INSERT INTO t VALUES (2318, 8, 62.42, 'name2318');
+INSERT INTO t VALUES (2319, 9, 41.61, 'name2319');
+INSERT INTO t VALUES (2320, 0, 20.80, 'name2320');
+INSERT INTO t VALUES (2321, 1, 99.99, 'name2321');
+INSERT INTO t VALUES (2322, 2, 79.18, 'name2322');
+INSERT INTO t VALUES (2323, 3, 58.37, 'name2323');
+INSERT INTO t VALUES (2324, 4, 37.56, 'name2324');
+INSERT INTO t VALUES (2325, 5, 16.75, 'name2325');
+INSERT INTO t VALUES (2326, 6, 95.94, 'name2326');
+INSERT INTO t VALUES (2327, 7, 75.13, 'name2327');
+INSERT INTO t VALUES (2328, 8, 54.32, 'name2328');
+INSERT INTO t VALUES (2329, 9, 33.51, 'name2329');
+INSERT INTO t VALUES (2330, 0, 12.70, 'name2330');
+INSERT INTO t VALUES (2331, 1, 91.89, 'name2331');
+INSERT INTO t VALUES (2332, 2, 71.08, 'name2332');
+INSERT INTO t VALUES (2333, 3, 50.27, 'name2333');
+INSERT INTO t VALUES (2334, 4, 29.46, 'name2334');
+INSERT INTO t VALUES (2335, 5, 8.65, 'name2335');
+INSERT INTO t VALUES (2336, 6, 87.84, 'name2336');
+INSERT INTO t VALUES (2337, 7, 67.03, 'name2337');
+INSERT INTO t VALUES (2338, 8, 46.22, 'name2338');
+INSERT INTO t VALUES (2339, 9, 25.41, 'name2339');
+INSERT INTO t VALUES (2340, 0, 4.60, 'name2340');
+INSERT INTO t VALUES (2341, 1, 83.79, 'name2341');
+INSERT INTO t VALUES (2342, 2, 62.98, 'name2342');
+INSERT INTO t VALUES (2343, 3, 42.17, 'name2343');
+INSERT INTO t VALUES (2344, 4, 21.36, 'name2344');
+INSERT INTO t VALUES (2345, 5, 0.55, 'name2345');
+INSERT INTO t VALUES (2346, 6, 79.74, 'name2346');
+INSERT INTO t VALUES (2347, 7, 58.93, 'name2347');
+INSERT INTO t VALUES (2348, 8, 38.12, 'name2348');
+INSERT INTO t VALUES (2349, 9, 17.31, 'name2349');
+INSERT INTO t VALUES (2350, 0, 96.50, 'name2350');
+INSERT INTO t VALUES (2351, 1, 75.69, 'name2351');
+INSERT INTO t VALUES (2352, 2, 54.88, 'name2352');
+INSERT INTO t VALUES (2353, 3, 34.07, 'name2353');
+INSERT INTO t VALUES (2354, 4, 13.26, 'name2354');
+INSERT INTO t VALUES (2355, 5, 92.45, 'name2355');
+INSERT INTO t VALUES (2356, 6, 71.64, 'name2356');
+INSERT INTO t VALUES (2357, 7, 50.83, 'name2357');
+INSERT INTO t VALUES (2358, 8, 30.02, 'name2358');
+INSERT INTO t VALUES (2359, 9, 9.21, 'name2359');
+INSERT INTO t VALUES (2360, 0, 88.40, 'name2360');
+INSERT INTO t VALUES (2361, 1, 67.59, 'name2361');
+INSERT INTO t VALUES (2362, 2, 46.78, 'name2362');
+INSERT INTO t VALUES (2363, 3, 25.97, 'name2363');
+INSERT INTO t VALUES (2364, 4, 5.16, 'name2364');
+INSERT INTO t VALUES (2365, 5, 84.35, 'name2365');
+INSERT INTO t VALUES (2366, 6, 63.54, 'name2366');
+INSERT INTO t VALUES (2367, 7, 42.73, 'name2367');
+INSERT INTO t VALUES (2368, 8, 21.92, 'name2368');
+INSERT INTO t VALUES (2369, 9, 1.11, 'name2369');
+INSERT INTO t VALUES (2370, 0, 80.30, 'name2370');
+INSERT INTO t VALUES (2371, 1, 59.49, 'name2371');
+INSERT INTO t VALUES (2372, 2, 38.68, 'name2372');
+INSERT INTO t VALUES (2373, 3, 17.87, 'name2373');
+INSERT INTO t VALUES (2374, 4, 97.06, 'name2374');
+INSERT INTO t VALUES (2375, 5, 76.25, 'name2375');
+INSERT INTO t VALUES (2376, 6, 55.44, 'name2376');
+INSERT INTO t VALUES (2377, 7, 34.63, 'name2377');
+INSERT INTO t VALUES (2378, 8, 13.82, 'name2378');
+INSERT INTO t VALUES (2379, 9, 93.01, 'name2379');
+INSERT INTO t VALUES (2380, 0, 72.20, 'name2380');
+INSERT INTO t VALUES (2381, 1, 51.39, 'name2381');
+INSERT INTO t VALUES (2382, 2, 30.58, 'name2382');
+INSERT INTO t VALUES (2383, 3, 9.77, 'name2383');
+INSERT INTO t VALUES (2384, 4, 88.96, 'name2384');
+INSERT INTO t VALUES (2385, 5, 68.15, 'name2385');
+INSERT INTO t VALUES (2386, 6, 47.34, 'name2386');
+INSERT INTO t VALUES (2387, 7, 26.53, 'name2387');
+INSERT INTO t VALUES (2388, 8, 5.72, 'name2388');
+INSERT INTO t VALUES (2389, 9, 84.91, 'name2389');
+INSERT INTO t VALUES (2390, 0, 64.10, 'name2390');
+INSERT INTO t VALUES (2391, 1, 43.29, 'name2391');
+INSERT INTO t VALUES (2392, 2, 22.48, 'name2392');
+INSERT INTO t VALUES (2393, 3, 1.67, 'name2393');
+INSERT INTO t VALUES (2394, 4, 80.86, 'name2394');
+INSERT INTO t VALUES (2395, 5, 60.05, 'name2395');
+INSERT INTO t VALUES (2396, 6, 39.24, 'name2396');
+INSERT INTO t VALUES (2397, 7, 18.43, 'name2397');
+INSERT INTO t VALUES (2398, 8, 97.62, 'name2398');
+INSERT INTO t VALUES (2399, 9, 76.81, 'name2399');
+INSERT INTO t VALUES (2400, 0, 56.00, 'name2400');
+INSERT INTO t VALUES (2401, 1, 35.19, 'name2401');
+INSERT INTO t VALUES (2402, 2, 14.38, 'name2402');
+INSERT INTO t VALUES (2403, 3, 93.57, 'name2403');
+INSERT INTO t VALUES (2404, 4, 72.76, 'name2404');
+INSERT INTO t VALUES (2405, 5, 51.95, 'name2405');
+INSERT INTO t VALUES (2406, 6, 31.14, 'name2406');
+INSERT INTO t VALUES (2407, 7, 10.33, 'name2407');
+INSERT INTO t VALUES (2408, 8, 89.52, 'name2408');
+INSERT INTO t VALUES (2409, 9, 68.71, 'name2409');
+INSERT INTO t VALUES (2410, 0, 47.90, 'name2410');
+INSERT INTO t VALUES (2411, 1, 27.09, 'name2411');
+INSERT INTO t VALUES (2412, 2, 6.28, 'name2412');
+INSERT INTO t VALUES (2413, 3, 85.47, 'name2413');
+INSERT INTO t VALUES (2414, 4, 64.66, 'name2414');
+INSERT INTO t VALUES (2415, 5, 43.85, 'name2415');
+INSERT INTO t VALUES (2416, 6, 23.04, 'name2416');
+INSERT INTO t VALUES (2417, 7, 2.23, 'name2417');
+INSERT INTO t VALUES (2418, 8, 81.42, 'name2418');
+INSERT INTO t VALUES (2419, 9, 60.61, 'name2419');
+INSERT INTO t VALUES (2420, 0, 39.80, 'name2420');
+INSERT INTO t VALUES (2421, 1, 18.99, 'name2421');
+INSERT INTO t VALUES (2422, 2, 98.18, 'name2422');
+INSERT INTO t VALUES (2423, 3, 77.37, 'name2423');
+INSERT INTO t VALUES (2424, 4, 56.56, 'name2424');
+INSERT INTO t VALUES (2425, 5, 35.75, 'name2425');
+INSERT INTO t VALUES (2426, 6, 14.94, 'name2426');
+INSERT INTO t VALUES (2427, 7, 94.13, 'name2427');
+INSERT INTO t VALUES (2428, 8, 73.32, 'name2428');
+INSERT INTO t VALUES (2429, 9, 52.51, 'name2429');
+INSERT INTO t VALUES (2430, 0, 31.70, 'name2430');
+INSERT INTO t VALUES (2431, 1, 10.89, 'name2431');
+INSERT INTO t VALUES (2432, 2, 90.08, 'name2432');
+INSERT INTO t VALUES (2433, 3, 69.27, 'name2433');
+INSERT INTO t VALUES (2434, 4, 48.46, 'name2434');
+INSERT INTO t VALUES (2435, 5, 27.65, 'name2435');
+INSERT INTO t VALUES (2436, 6, 6.84, 'name2436');
+INSERT INTO t VALUES (2437, 7, 86.03, 'name2437');
+INSERT INTO t VALUES (2438, 8, 65.22, 'name2438');
+INSERT INTO t VALUES (2439, 9, 44.41, 'name2439');
+INSERT INTO t VALUES (2440, 0, 23.60, 'name2440');
+INSERT INTO t VALUES (2441, 1, 2.79, 'name2441');
+INSERT INTO t VALUES (2442, 2, 81.98, 'name2442');
+INSERT INTO t VALUES (2443, 3, 61.17, 'name2443');
+INSERT INTO t VALUES (2444, 4, 40.36, 'name2444');
+INSERT INTO t VALUES (2445, 5, 19.55, 'name2445');
+INSERT INTO t VALUES (2446, 6, 98.74, 'name2446');
+INSERT INTO t VALUES (2447, 7, 77.93, 'name2447');
+INSERT INTO t VALUES (2448, 8, 57.12, 'name2448');
+INSERT INTO t VALUES (2449, 9, 36.31, 'name2449');
+INSERT INTO t VALUES (2450, 0, 15.50, 'name2450');
+INSERT INTO t VALUES (2451, 1, 94.69, 'name2451');
+INSERT INTO t VALUES (2452, 2, 73.88, 'name2452');
+INSERT INTO t VALUES (2453, 3, 53.07, 'name2453');
+INSERT INTO t VALUES (2454, 4, 32.26, 'name2454');
+INSERT INTO t VALUES (2455, 5, 11.45, 'name2455');
+INSERT INTO t VALUES (2456, 6, 90.64, 'name2456');
+INSERT INTO t VALUES (2457, 7, 69.83, 'name2457');
+INSERT INTO t VALUES (2458, 8, 49.02, 'name2458');
+INSERT INTO t VALUES (2459, 9, 28.21, 'name2459');
+INSERT INTO t VALUES (2460, 0, 7.40, 'name2460');
+INSERT INTO t VALUES (2461, 1, 86.59, 'name2461');
+INSERT INTO t VALUES (2462, 2, 65.78, 'name2462');
+INSERT INTO t VALUES (2463, 3, 44.97, 'name2463');
+INSERT INTO t VALUES (2464, 4, 24.16, 'name2464');
+INSERT INTO t VALUES (2465, 5, 3.35, 'name2465');
+INSERT INTO t VALUES (2466, 6, 82.54, 'name2466');
+INSERT INTO t VALUES (2467, 7, 61.73, 'name2467');
+INSERT INTO t VALUES (2468, 8, 40.92, 'name2468');
+INSERT INTO t VALUES (2469, 9, 20.11, 'name2469');
+INSERT INTO t VALUES (2470, 0, 99.30, 'name2470');
+INSERT INTO t VALUES (2471, 1, 78.49, 'name2471');
+INSERT INTO t VALUES (2472, 2, 57.68, 'name2472');
+INSERT INTO t VALUES (2473, 3, 36.87, 'name2473');
+INSERT INTO t VALUES (2474, 4, 16.06, 'name2474');
+INSERT INTO t VALUES (2475, 5, 95.25, 'name2475');
+INSERT INTO t VALUES (2476, 6, 74.44, 'name2476');
+INSERT INTO t VALUES (2477, 7, 53.63, 'name2477');
+INSERT INTO t VALUES (2478, 8, 32.82, 'name2478');
+INSERT INTO t VALUES (2479, 9, 12.01, 'name2479');
+INSERT INTO t VALUES (2480, 0, 91.20, 'name2480');
+INSERT INTO t VALUES (2481, 1, 70.39, 'name2481');
+INSERT INTO t VALUES (2482, 2, 49.58, 'name2482');
+INSERT INTO t VALUES (2483, 3, 28.77, 'name2483');
+INSERT INTO t VALUES (2484, 4, 7.96, 'name2484');
+INSERT INTO t VALUES (2485, 5, 87.15, 'name2485');
+INSERT INTO t VALUES (2486, 6, 66.34, 'name2486');
+INSERT INTO t VALUES (2487, 7, 45.53, 'name2487');
+INSERT INTO t VALUES (2488, 8, 24.72, 'name2488');
+INSERT INTO t VALUES (2489, 9, 3.91, 'name2489');
+INSERT INTO t VALUES (2490, 0, 83.10, 'name2490');
+INSERT INTO t VALUES (2491, 1, 62.29, 'name2491');
+INSERT INTO t VALUES (2492, 2, 41.48, 'name2492');
+INSERT INTO t VALUES (2493, 3, 20.67, 'name2493');
+INSERT INTO t VALUES (2494, 4, 99.86, 'name2494');
+INSERT INTO t VALUES (2495, 5, 79.05, 'name2495');
+INSERT INTO t VALUES (2496, 6, 58.24, 'name2496');
+INSERT INTO t VALUES (2497, 7, 37.43, 'name2497');
+INSERT INTO t VALUES (2498, 8, 16.62, 'name2498');
+INSERT INTO t VALUES (2499, 9, 95.81, 'name2499');
+INSERT INTO t VALUES (2500, 0, 75.00, 'name2500');
+INSERT INTO t VALUES (2501, 1, 54.19, 'name2501');
+INSERT INTO t VALUES (2502, 2, 33.38, 'name2502');
+INSERT INTO t VALUES (2503, 3, 12.57, 'name2503');
+INSERT INTO t VALUES (2504, 4, 91.76, 'name2504');
+INSERT INTO t VALUES (2505, 5, 70.95, 'name2505');
+INSERT INTO t VALUES (2506, 6, 50.14, 'name2506');
+INSERT INTO t VALUES (2507, 7, 29.33, 'name2507');
+INSERT INTO t VALUES (2508, 8, 8.52, 'name2508');
+INSERT INTO t VALUES (2509, 9, 87.71, 'name2509');
+INSERT INTO t VALUES (2510, 0, 66.90, 'name2510');
+INSERT INTO t VALUES (2511, 1, 46.09, 'name2511');
+INSERT INTO t VALUES (2512, 2, 25.28, 'name2512');
+INSERT INTO t VALUES (2513, 3, 4.47, 'name2513');
+INSERT INTO t VALUES (2514, 4, 83.66, 'name2514');
+INSERT INTO t VALUES (2515, 5, 62.85, 'name2515');
+INSERT INTO t VALUES (2516, 6, 42.04, 'name2516');
+INSERT INTO t VALUES (2517, 7, 21.23, 'name2517');
+INSERT INTO t VALUES (2518, 8, 0.42, 'name2518');
+INSERT INTO t VALUES (2519, 9, 79.61, 'name2519');
+INSERT INTO t VALUES (2520, 0, 58.80, 'name2520');
+INSERT INTO t VALUES (2521, 1, 37.99, 'name2521');
+INSERT INTO t VALUES (2522, 2, 17.18, 'name2522');
+INSERT INTO t VALUES (2523, 3, 96.37, 'name2523');
+INSERT INTO t VALUES (2524, 4, 75.56, 'name2524');
+INSERT INTO t VALUES (2525, 5, 54.75, 'name2525');
+INSERT INTO t VALUES (2526, 6, 33.94, 'name2526');
+INSERT INTO t VALUES (2527, 7, 13.13, 'name2527');
+INSERT INTO t VALUES (2528, 8, 92.32, 'name2528');
+INSERT INTO t VALUES (2529, 9, 71.51, 'name2529');
+INSERT INTO t VALUES (2530, 0, 50.70, 'name2530');
+INSERT INTO t VALUES (2531, 1, 29.89, 'name2531');
+INSERT INTO t VALUES (2532, 2, 9.08, 'name2532');
+INSERT INTO t VALUES (2533, 3, 88.27, 'name2533');
+INSERT INTO t VALUES (2534, 4, 67.46, 'name2534');
+INSERT INTO t VALUES (2535, 5, 46.65, 'name2535');
+INSERT INTO t VALUES (2536, 6, 25.84, 'name2536');
+INSERT INTO t VALUES (2537, 7, 5.03, 'name2537');
+INSERT INTO t VALUES (2538, 8, 84.22, 'name2538');
+INSERT INTO t VALUES (2539, 9, 63.41, 'name2539');
+INSERT INTO t VALUES (2540, 0, 42.60, 'name2540');
+INSERT INTO t VALUES (2541, 1, 21.79, 'name2541');
+INSERT INTO t VALUES (2542, 2, 0.98, 'name2542');
+INSERT INTO t VALUES (2543, 3, 80.17, 'name2543');
+INSERT INTO t VALUES (2544, 4, 59.36, 'name2544');
+INSERT INTO t VALUES (2545, 5, 38.55, 'name2545');
+INSERT INTO t VALUES (2546, 6, 17.74, 'name2546');
+INSERT INTO t VALUES (2547, 7, 96.93, 'name2547');
+INSERT INTO t VALUES (2548, 8, 76.12, 'name2548');
+INSERT INTO t VALUES (2549, 9, 55.31, 'name2549');
+INSERT INTO t VALUES (2550, 0, 34.50, 'name2550');
+INSERT INTO t VALUES (2551, 1, 13.69, 'name2551');
+INSERT INTO t VALUES (2552, 2, 92.88, 'name2552');
+INSERT INTO t VALUES (2553, 3, 72.07, 'name2553');
+INSERT INTO t VALUES (2554, 4, 51.26, 'name2554');
+INSERT INTO t VALUES (2555, 5, 30.45, 'name2555');
+INSERT INTO t VALUES (2556, 6, 9.64, 'name2556');
+INSERT INTO t VALUES (2557, 7, 88.83, 'name2557');
+INSERT INTO t VALUES (2558, 8, 68.02, 'name2558');
+INSERT INTO t VALUES (2559, 9, 47.21, 'name2559');
+INSERT INTO t VALUES (2560, 0, 26.40, 'name2560');
+INSERT INTO t VALUES (2561, 1, 5.59, 'name2561');
+INSERT INTO t VALUES (2562, 2, 84.78, 'name2562');
+INSERT INTO t VALUES (2563, 3, 63.97, 'name2563');
+INSERT INTO t VALUES (2564, 4, 43.16, 'name2564');
+INSERT INTO t VALUES (2565, 5, 22.35, 'name2565');
+INSERT INTO t VALUES (2566, 6, 1.54, 'name2566');
+INSERT INTO t VALUES (2567, 7, 80.73, 'name2567');
+INSERT INTO t VALUES (2568, 8, 59.92, 'name2568');
+INSERT INTO t VALUES (2569, 9, 39.11, 'name2569');
+INSERT INTO t VALUES (2570, 0, 18.30, 'name2570');
+INSERT INTO t VALUES (2571, 1, 97.49, 'name2571');
+INSERT INTO t VALUES (2572, 2, 76.68, 'name2572');
+INSERT INTO t VALUES (2573, 3, 55.87, 'name2573');
+INSERT INTO t VALUES (2574, 4, 35.06, 'name2574');
+INSERT INTO t VALUES (2575, 5, 14.25, 'name2575');
+INSERT INTO t VALUES (2576, 6, 93.44, 'name2576');
+INSERT INTO t VALUES (2577, 7, 72.63, 'name2577');
+INSERT INTO t VALUES (2578, 8, 51.82, 'name2578');
+INSERT INTO t VALUES (2579, 9, 31.01, 'name2579');
+INSERT INTO t VALUES (2580, 0, 10.20, 'name2580');
+INSERT INTO t VALUES (2581, 1, 89.39, 'name2581');
+INSERT INTO t VALUES (2582, 2, 68.58, 'name2582');
+INSERT INTO t VALUES (2583, 3, 47.77, 'name2583');
+INSERT INTO t VALUES (2584, 4, 26.96, 'name2584');
+INSERT INTO t VALUES (2585, 5, 6.15, 'name2585');
+INSERT INTO t VALUES (2586, 6, 85.34, 'name2586');
+INSERT INTO t VALUES (2587, 7, 64.53, 'name2587');
+INSERT INTO t VALUES (2588, 8, 43.72, 'name2588');
+INSERT INTO t VALUES (2589, 9, 22.91, 'name2589');
+INSERT INTO t VALUES (2590, 0, 2.10, 'name2590');
+INSERT INTO t VALUES (2591, 1, 81.29, 'name2591');
+INSERT INTO t VALUES (2592, 2, 60.48, 'name2592');
+INSERT INTO t VALUES (2593, 3, 39.67, 'name2593');
+INSERT INTO t VALUES (2594, 4, 18.86, 'name2594');
+INSERT INTO t VALUES (2595, 5, 98.05, 'name2595');
+INSERT INTO t VALUES (2596, 6, 77.24, 'name2596');
+INSERT INTO t VALUES (2597, 7, 56.43, 'name2597');
+INSERT INTO t VALUES (2598, 8, 35.62, 'name2598');
+INSERT INTO t VALUES (2599, 9, 14.81, 'name2599');
+INSERT INTO t VALUES (2600, 0, 94.00, 'name2600');
+INSERT INTO t VALUES (2601, 1, 73.19, 'name2601');
+INSERT INTO t VALUES (2602, 2, 52.38, 'name2602');
+INSERT INTO t VALUES (2603, 3, 31.57, 'name2603');
+INSERT INTO t VALUES (2604, 4, 10.76, 'name2604');
+INSERT INTO t VALUES (2605, 5, 89.95, 'name2605');
+INSERT INTO t VALUES (2606, 6, 69.14, 'name2606');
+INSERT INTO t VALUES (2607, 7, 48.33, 'name2607');
+INSERT INTO t VALUES (2608, 8, 27.52, 'name2608');
+INSERT INTO t VALUES (2609, 9, 6.71, 'name2609');
+INSERT INTO t VALUES (2610, 0, 85.90, 'name2610');
+INSERT INTO t VALUES (2611, 1, 65.09, 'name2611');
+INSERT INTO t VALUES (2612, 2, 44.28, 'name2612');
+INSERT INTO t VALUES (2613, 3, 23.47, 'name2613');
+INSERT INTO t VALUES (2614, 4, 2.66, 'name2614');
+INSERT INTO t VALUES (2615, 5, 81.85, 'name2615');
+INSERT INTO t VALUES (2616, 6, 61.04, 'name2616');
+INSERT INTO t VALUES (2617, 7, 40.23, 'name2617');
+INSERT INTO t VALUES (2618, 8, 19.42, 'name2618');
+INSERT INTO t VALUES (2619, 9, 98.61, 'name2619');
+INSERT INTO t VALUES (2620, 0, 77.80, 'name2620');
+INSERT INTO t VALUES (2621, 1, 56.99, 'name2621');
+INSERT INTO t VALUES (2622, 2, 36.18, 'name2622');
+INSERT INTO t VALUES (2623, 3, 15.37, 'name2623');
+INSERT INTO t VALUES (2624, 4, 94.56, 'name2624');
+INSERT INTO t VALUES (2625, 5, 73.75, 'name2625');
+INSERT INTO t VALUES (2626, 6, 52.94, 'name2626');
+INSERT INTO t VALUES (2627, 7, 32.13, 'name2627');
+INSERT INTO t VALUES (2628, 8, 11.32, 'name2628');
+INSERT INTO t VALUES (2629, 9, 90.51, 'name2629');
+INSERT INTO t VALUES (2630, 0, 69.70, 'name2630');
+INSERT INTO t VALUES (2631, 1, 48.89, 'name2631');
+INSERT INTO t VALUES (2632, 2, 28.08, 'name2632');
+INSERT INTO t VALUES (2633, 3, 7.27, 'name2633');
+INSERT INTO t VALUES (2634, 4, 86.46, 'name2634');
+INSERT INTO t VALUES (2635, 5, 65.65, 'name2635');
+INSERT INTO t VALUES (2636, 6, 44.84, 'name2636');
+INSERT INTO t VALUES (2637, 7, 24.03, 'name2637');
+INSERT INTO t VALUES (2638, 8, 3.22, 'name2638');
+INSERT INTO t VALUES (2639, 9, 82.41, 'name2639');
+INSERT INTO t VALUES (2640, 0, 61.60, 'name2640');
+INSERT INTO t VALUES (2641, 1, 40.79, 'name2641');
+INSERT INTO t VALUES (2642, 2, 19.98, 'name2642');
+INSERT INTO t VALUES (2643, 3, 99.17, 'name2643');
+INSERT INTO t VALUES (2644, 4, 78.36, 'name2644');
+INSERT INTO t VALUES (2645, 5, 57.55, 'name2645');
+INSERT INTO t VALUES (2646, 6, 36.74, 'name2646');
+INSERT INTO t VALUES (2647, 7, 15.93, 'name2647');
+INSERT INTO t VALUES (2648, 8, 95.12, 'name2648');
+INSERT INTO t VALUES (2649, 9, 74.31, 'name2649');
+INSERT INTO t VALUES (2650, 0, 53.50, 'name2650');
+INSERT INTO t VALUES (2651, 1, 32.69, 'name2651');
+INSERT INTO t VALUES (2652, 2, 11.88, 'name2652');
+INSERT INTO t VALUES (2653, 3, 91.07, 'name2653');
+INSERT INTO t VALUES (2654, 4, 70.26, 'name2654');
+INSERT INTO t VALUES (2655, 5, 49.45, 'name2655');
+INSERT INTO t VALUES (2656, 6, 28.64, 'name2656');
+INSERT INTO t VALUES (2657, 7, 7.83, 'name2657');
+INSERT INTO t VALUES (2658, 8, 87.02, 'name2658');
+INSERT INTO t VALUES (2659, 9, 66.21, 'name2659');
+INSERT INTO t VALUES (2660, 0, 45.40, 'name2660');
+INSERT INTO t VALUES (2661, 1, 24.59, 'name2661');
+INSERT INTO t VALUES (2662, 2, 3.78, 'name2662');
+INSERT INTO t VALUES (2663, 3, 82.97, 'name2663');
+INSERT INTO t VALUES (2664, 4, 62.16, 'name2664');
+INSERT INTO t VALUES (2665, 5, 41.35, 'name2665');
+INSERT INTO t VALUES (2666, 6, 20.54, 'name2666');
+INSERT INTO t VALUES (2667, 7, 99.73, 'name2667');
+INSERT INTO t VALUES (2668, 8, 78.92, 'name2668');
+INSERT INTO t VALUES (2669, 9, 58.11, 'name2669');
+INSERT INTO t VALUES (2670, 0, 37.30, 'name2670');
+INSERT INTO t VALUES (2671, 1, 16.49, 'name2671');
+INSERT INTO t VALUES (2672, 2, 95.68, 'name2672');
+INSERT INTO t VALUES (2673, 3, 74.87, 'name2673');
+INSERT INTO t VALUES (2674, 4, 54.06, 'name2674');
+INSERT INTO t VALUES (2675, 5, 33.25, 'name2675');
+INSERT INTO t VALUES (2676, 6, 12.44, 'name2676');
+INSERT INTO t VALUES (2677, 7, 91.63, 'name2677');
+INSERT INTO t VALUES (2678, 8, 70.82, 'name2678');
+INSERT INTO t VALUES (2679, 9, 50.01, 'name2679');
+INSERT INTO t VALUES (2680, 0, 29.20, 'name2680');
+INSERT INTO t VALUES (2681, 1, 8.39, 'name2681');
+INSERT INTO t VALUES (2682, 2, 87.58, 'name2682');
+INSERT INTO t VALUES (2683, 3, 66.77, 'name2683');
+INSERT INTO t VALUES (2684, 4, 45.96, 'name2684');
+INSERT INTO t VALUES (2685, 5, 25.15, 'name2685');
+INSERT INTO t VALUES (2686, 6, 4.34, 'name2686');
+INSERT INTO t VALUES (2687, 7, 83.53, 'name2687');
+INSERT INTO t VALUES (2688, 8, 62.72, 'name2688');
+INSERT INTO t VALUES (2689, 9, 41.91, 'name2689');
+INSERT INTO t VALUES (2690, 0, 21.10, 'name2690');
+INSERT INTO t VALUES (2691, 1, 0.29, 'name2691');
+INSERT INTO t VALUES (2692, 2, 79.48, 'name2692');
+INSERT INTO t VALUES (2693, 3, 58.67, 'name2693');
+INSERT INTO t VALUES (2694, 4, 37.86, 'name2694');
+INSERT INTO t VALUES (2695, 5, 17.05, 'name2695');
+INSERT INTO t VALUES (2696, 6, 96.24, 'name2696');
+INSERT INTO t VALUES (2697, 7, 75.43, 'name2697');
+INSERT INTO t VALUES (2698, 8, 54.62, 'name2698');
+INSERT INTO t VALUES (2699, 9, 33.81, 'name2699');
+INSERT INTO t VALUES (2700, 0, 13.00, 'name2700');
+INSERT INTO t VALUES (2701, 1, 92.19, 'name2701');
+INSERT INTO t VALUES (2702, 2, 71.38, 'name2702');
+INSERT INTO t VALUES (2703, 3, 50.57, 'name2703');
+INSERT INTO t VALUES (2704, 4, 29.76, 'name2704');
+INSERT INTO t VALUES (2705, 5, 8.95, 'name2705');
+INSERT INTO t VALUES (2706, 6, 88.14, 'name2706');
+INSERT INTO t VALUES (2707, 7, 67.33, 'name2707');
+INSERT INTO t VALUES (2708, 8, 46.52, 'name2708');
+INSERT INTO t VALUES (2709, 9, 25.71, 'name2709');
+INSERT INTO t VALUES (2710, 0, 4.90, 'name2710');
+INSERT INTO t VALUES (2711, 1, 84.09, 'name2711');
+INSERT INTO t VALUES (2712, 2, 63.28, 'name2712');
+INSERT INTO t VALUES (2713, 3, 42.47, 'name2713');
+INSERT INTO t VALUES (2714, 4, 21.66, 'name2714');
+INSERT INTO t VALUES (2715, 5, 0.85, 'name2715');
+INSERT INTO t VALUES (2716, 6, 80.04, 'name2716');
+INSERT INTO t VALUES (2717, 7, 59.23, 'name2717');
+INSERT INTO t VALUES (2718, 8, 38.42, 'name2718');
+INSERT INTO t VALUES (2719, 9, 17.61, 'name2719');
+INSERT INTO t VALUES (2720, 0, 96.80, 'name2720');
+INSERT INTO t VALUES (2721, 1, 75.99, 'name2721');
+INSERT INTO t VALUES (2722, 2, 55.18, 'name2722');
+INSERT INTO t VALUES (2723, 3, 34.37, 'name2723');
+INSERT INTO t VALUES (2724, 4, 13.56, 'name2724');
+INSERT INTO t VALUES (2725, 5, 92.75, 'name2725');
+INSERT INTO t VALUES (2726, 6, 71.94, 'name2726');
+INSERT INTO t VALUES (2727, 7, 51.13, 'name2727');
+INSERT INTO t VALUES (2728, 8, 30.32, 'name2728');
+INSERT INTO t VALUES (2729, 9, 9.51, 'name2729');
+INSERT INTO t VALUES (2730, 0, 88.70, 'name2730');
+INSERT INTO t VALUES (2731, 1, 67.89, 'name2731');
+INSERT INTO t VALUES (2732, 2, 47.08, 'name2732');
+INSERT INTO t VALUES (2733, 3, 26.27, 'name2733');
+INSERT INTO t VALUES (2734, 4, 5.46, 'name2734');
+INSERT INTO t VALUES (2735, 5, 84.65, 'name2735');
+INSERT INTO t VALUES (2736, 6, 63.84, 'name2736');
+INSERT INTO t VALUES (2737, 7, 43.03, 'name2737');
+INSERT INTO t VALUES (2738, 8, 22.22, 'name2738');
+INSERT INTO t VALUES (2739, 9, 1.41, 'name2739');
+INSERT INTO t VALUES (2740, 0, 80.60, 'name2740');
+INSERT INTO t VALUES (2741, 1, 59.79, 'name2741');
+INSERT INTO t VALUES (2742, 2, 38.98, 'name2742');
+INSERT INTO t VALUES (2743, 3, 18.17, 'name2743');
+INSERT INTO t VALUES (2744, 4, 97.36, 'name2744');
+INSERT INTO t VALUES (2745, 5, 76.55, 'name2745');
+INSERT INTO t VALUES (2746, 6, 55.74, 'name2746');
+INSERT INTO t VALUES (2747, 7, 34.93, 'name2747');
+INSERT INTO t VALUES (2748, 8, 14.12, 'name2748');
+INSERT INTO t VALUES (2749, 9, 93.31, 'name2749');
+INSERT INTO t VALUES (2750, 0, 72.50, 'name2750');
+INSERT INTO t VALUES (2751, 1, 51.69, 'name2751');
+INSERT INTO t VALUES (2752, 2, 30.88, 'name2752');
+INSERT INTO t VALUES (2753, 3, 10.07, 'name2753');
+INSERT INTO t VALUES (2754, 4, 89.26, 'name2754');
+INSERT INTO t VALUES (2755, 5, 68.45, 'name2755');
+INSERT INTO t VALUES (2756, 6, 47.64, 'name2756');
+INSERT INTO t VALUES (2757, 7, 26.83, 'name2757');
+INSERT INTO t VALUES (2758, 8, 6.02, 'name2758');
+INSERT INTO t VALUES (2759, 9, 85.21, 'name2759');
+INSERT INTO t VALUES (2760, 0, 64.40, 'name2760');
+INSERT INTO t VALUES (2761, 1, 43.59, 'name2761');
+INSERT INTO t VALUES (2762, 2, 22.78, 'name2762');
+INSERT INTO t VALUES (2763, 3, 1.97, 'name2763');
+INSERT INTO t VALUES (2764, 4, 81.16, 'name2764');
+INSERT INTO t VALUES (2765, 5, 60.35, 'name2765');
+INSERT INTO t VALUES (2766, 6, 39.54, 'name2766');
+INSERT INTO t VALUES (2767, 7, 18.73, 'name2767');
+INSERT INTO t VALUES (2768, 8, 97.92, 'name2768');
+INSERT INTO t VALUES (2769, 9, 77.11, 'name2769');
+INSERT INTO t VALUES (2770, 0, 56.30, 'name2770');
+INSERT INTO t VALUES (2771, 1, 35.49, 'name2771');
+INSERT INTO t VALUES (2772, 2, 14.68, 'name2772');
+INSERT INTO t VALUES (2773, 3, 93.87, 'name2773');
+INSERT INTO t VALUES (2774, 4, 73.06, 'name2774');
+INSERT INTO t VALUES (2775, 5, 52.25, 'name2775');
+INSERT INTO t VALUES (2776, 6, 31.44, 'name2776');
+INSERT INTO t VALUES (2777, 7, 10.63, 'name2777');
+INSERT INTO t VALUES (2778, 8, 89.82, 'name2778');
+INSERT INTO t VALUES (2779, 9, 69.01, 'name2779');
+INSERT INTO t VALUES (2780, 0, 48.20, 'name2780');
+INSERT INTO t VALUES (2781, 1, 27.39, 'name2781');
+INSERT INTO t VALUES (2782, 2, 6.58, 'name2782');
+INSERT INTO t VALUES (2783, 3, 85.77, 'name2783');
+INSERT INTO t VALUES (2784, 4, 64.96, 'name2784');
+INSERT INTO t VALUES (2785, 5, 44.15, 'name2785');
+INSERT INTO t VALUES (2786, 6, 23.34, 'name2786');
+INSERT INTO t VALUES (2787, 7, 2.53, 'name2787');
+INSERT INTO t VALUES (2788, 8, 81.72, 'name2788');
+INSERT INTO t VALUES (2789, 9, 60.91, 'name2789');
+INSERT INTO t VALUES (2790, 0, 40.10, 'name2790');
+INSERT INTO t VALUES (2791, 1, 19.29, 'name2791');
+INSERT INTO t VALUES (2792, 2, 98.48, 'name2792');
+INSERT INTO t VALUES (2793, 3, 77.67, 'name2793');
+INSERT INTO t VALUES (2794, 4, 56.86, 'name2794');
+INSERT INTO t VALUES (2795, 5, 36.05, 'name2795');
+INSERT INTO t VALUES (2796, 6, 15.24, 'name2796');
+INSERT INTO t VALUES (2797, 7, 94.43, 'name2797');
+INSERT INTO t VALUES (2798, 8, 73.62, 'name2798');
+INSERT INTO t VALUES (2799, 9, 52.81, 'name2799');
+INSERT INTO t VALUES (2800, 0, 32.00, 'name2800');
+INSERT INTO t VALUES (2801, 1, 11.19, 'name2801');
+INSERT INTO t VALUES (2802, 2, 90.38, 'name2802');
+INSERT INTO t VALUES (2803, 3, 69.57, 'name2803');
+INSERT INTO t VALUES (2804, 4, 48.76, 'name2804');
+INSERT INTO t VALUES (2805, 5, 27.95, 'name2805');
+INSERT INTO t VALUES (2806, 6, 7.14, 'name2806');
+INSERT INTO t VALUES (2807, 7, 86.33, 'name2807');
+INSERT INTO t VALUES (2808, 8, 65.52, 'name2808');
+INSERT INTO t VALUES (2809, 9, 44.71, 'name2809');
+INSERT INTO t VALUES (2810, 0, 23.90, 'name2810');
+INSERT INTO t VALUES (2811, 1, 3.09, 'name2811');
+INSERT INTO t VALUES (2812, 2, 82.28, 'name2812');
+INSERT INTO t VALUES (2813, 3, 61.47, 'name2813');
+INSERT INTO t VALUES (2814, 4, 40.66, 'name2814');
+INSERT INTO t VALUES (2815, 5, 19.85, 'name2815');
+INSERT INTO t VALUES (2816, 6, 99.04, 'name2816');
+INSERT INTO t VALUES (2817, 7, 78.23, 'name2817');
+INSERT INTO t VALUES (2818, 8, 57.42, 'name2818');
+INSERT INTO t VALUES (2819, 9, 36.61, 'name2819');
+INSERT INTO t VALUES (2820, 0, 15.80, 'name2820');
+INSERT INTO t VALUES (2821, 1, 94.99, 'name2821');
+INSERT INTO t VALUES (2822, 2, 74.18, 'name2822');
+INSERT INTO t VALUES (2823, 3, 53.37, 'name2823');
+INSERT INTO t VALUES (2824, 4, 32.56, 'name2824');
+INSERT INTO t VALUES (2825, 5, 11.75, 'name2825');
+INSERT INTO t VALUES (2826, 6, 90.94, 'name2826');
+INSERT INTO t VALUES (2827, 7, 70.13, 'name2827');
+INSERT INTO t VALUES (2828, 8, 49.32, 'name2828');
+INSERT INTO t VALUES (2829, 9, 28.51, 'name2829');
+INSERT INTO t VALUES (2830, 0, 7.70, 'name2830');
+INSERT INTO t VALUES (2831, 1, 86.89, 'name2831');
+INSERT INTO t VALUES (2832, 2, 66.08, 'name2832');
+INSERT INTO t VALUES (2833, 3, 45.27, 'name2833');
+INSERT INTO t VALUES (2834, 4, 24.46, 'name2834');
+INSERT INTO t VALUES (2835, 5, 3.65, 'name2835');
+INSERT INTO t VALUES (2836, 6, 82.84, 'name2836');
+INSERT INTO t VALUES (2837, 7, 62.03, 'name2837');
+INSERT INTO t VALUES (2838, 8, 41.22, 'name2838');
+INSERT INTO t VALUES (2839, 9, 20.41, 'name2839');
+INSERT INTO t VALUES (2840, 0, 99.60, 'name2840');
+INSERT INTO t VALUES (2841, 1, 78.79, 'name2841');
+INSERT INTO t VALUES (2842, 2, 57.98, 'name2842');
+INSERT INTO t VALUES (2843, 3, 37.17, 'name2843');
+INSERT INTO t VALUES (2844, 4, 16.36, 'name2844');
+INSERT INTO t VALUES (2845, 5, 95.55, 'name2845');
+INSERT INTO t VALUES (2846, 6, 74.74, 'name2846');
+INSERT INTO t VALUES (2847, 7, 53.93, 'name2847');
+INSERT INTO t VALUES (2848, 8, 33.12, 'name2848');
+INSERT INTO t VALUES (2849, 9, 12.31, 'name2849');
+INSERT INTO t VALUES (2850, 0, 91.50, 'name2850');
+INSERT INTO t VALUES (2851, 1, 70.69, 'name2851');
+INSERT INTO t VALUES (2852, 2, 49.88, 'name2852');
+INSERT INTO t VALUES (2853, 3, 29.07, 'name2853');
+INSERT INTO t VALUES (2854, 4, 8.26, 'name2854');
+INSERT INTO t VALUES (2855, 5, 87.45, 'name2855');
+INSERT INTO t VALUES (2856, 6, 66.64, 'name2856');
+INSERT INTO t VALUES (2857, 7, 45.83, 'name2857');
+INSERT INTO t VALUES (2858, 8, 25.02, 'name2858');
+INSERT INTO t VALUES (2859, 9, 4.21, 'name2859');
+INSERT INTO t VALUES (2860, 0, 83.40, 'name2860');
+INSERT INTO t VALUES (2861, 1, 62.59, 'name2861');
+INSERT INTO t VALUES (2862, 2, 41.78, 'name2862');
+INSERT INTO t VALUES (2863, 3, 20.97, 'name2863');
+INSERT INTO t VALUES (2864, 4, 0.16, 'name2864');
+INSERT INTO t VALUES (2865, 5, 79.35, 'name2865');
+INSERT INTO t VALUES (2866, 6, 58.54, 'name2866');
+INSERT INTO t VALUES (2867, 7, 37.73, 'name2867');
+INSERT INTO t VALUES (2868, 8, 16.92, 'name2868');
+INSERT INTO t VALUES (2869, 9, 96.11, 'name2869');
+INSERT INTO t VALUES (2870, 0, 75.30, 'name2870');
+INSERT INTO t VALUES (2871, 1, 54.49, 'name2871');
+INSERT INTO t VALUES (2872, 2, 33.68, 'name2872');
+INSERT INTO t VALUES (2873, 3, 12.87, 'name2873');
+INSERT INTO t VALUES (2874, 4, 92.06, 'name2874');
+INSERT INTO t VALUES (2875, 5, 71.25, 'name2875');
+INSERT INTO t VALUES (2876, 6, 50.44, 'name2876');
+INSERT INTO t VALUES (2877, 7, 29.63, 'name2877');
+INSERT INTO t VALUES (2878, 8, 8.82, 'name2878');
+INSERT INTO t VALUES (2879, 9, 88.01, 'name2879');
+INSERT INTO t VALUES (2880, 0, 67.20, 'name2880');
+INSERT INTO t VALUES (2881, 1, 46.39, 'name2881');
+INSERT INTO t VALUES (2882, 2, 25.58, 'name2882');
+INSERT INTO t VALUES (2883, 3, 4.77, 'name2883');
+INSERT INTO t VALUES (2884, 4, 83.96, 'name2884');
+INSERT INTO t VALUES (2885, 5, 63.15, 'name2885');
+INSERT INTO t VALUES (2886, 6, 42.34, 'name2886');
+INSERT INTO t VALUES (2887, 7, 21.53, 'name2887');
+INSERT INTO t VALUES (2888, 8, 0.72, 'name2888');
+INSERT INTO t VALUES (2889, 9, 79.91, 'name2889');
+INSERT INTO t VALUES (2890, 0, 59.10, 'name2890');
+INSERT INTO t VALUES (2891, 1, 38.29, 'name2891');
+INSERT INTO t VALUES (2892, 2, 17.48, 'name2892');
+INSERT INTO t VALUES (2893, 3, 96.67, 'name2893');
+INSERT INTO t VALUES (2894, 4, 75.86, 'name2894');
+INSERT INTO t VALUES (2895, 5, 55.05, 'name2895');
+INSERT INTO t VALUES (2896, 6, 34.24, 'name2896');
+INSERT INTO t VALUES (2897, 7, 13.43, 'name2897');
+INSERT INTO t VALUES (2898, 8, 92.62, 'name2898');
+INSERT INTO t VALUES (2899, 9, 71.81, 'name2899');
+INSERT INTO t VALUES (2900, 0, 51.00, 'name2900');
+INSERT INTO t VALUES (2901, 1, 30.19, 'name2901');
+INSERT INTO t VALUES (2902, 2, 9.38, 'name2902');
+INSERT INTO t VALUES (2903, 3, 88.57, 'name2903');
+INSERT INTO t VALUES (2904, 4, 67.76, 'name2904');
+INSERT INTO t VALUES (2905, 5, 46.95, 'name2905');
+INSERT INTO t VALUES (2906, 6, 26.14, 'name2906');
+INSERT INTO t VALUES (2907, 7, 5.33, 'name2907');
+INSERT INTO t VALUES (2908, 8, 84.52, 'name2908');
+INSERT INTO t VALUES (2909, 9, 63.71, 'name2909');
+INSERT INTO t VALUES (2910, 0, 42.90, 'name2910');
+INSERT INTO t VALUES (2911, 1, 22.09, 'name2911');
+INSERT INTO t VALUES (2912, 2, 1.28, 'name2912');
+INSERT INTO t VALUES (2913, 3, 80.47, 'name2913');
+INSERT INTO t VALUES (2914, 4, 59.66, 'name2914');
+INSERT INTO t VALUES (2915, 5, 38.85, 'name2915');
+INSERT INTO t VALUES (2916, 6, 18.04, 'name2916');
+INSERT INTO t VALUES (2917, 7, 97.23, 'name2917');
+INSERT INTO t VALUES (2918, 8, 76.42, 'name2918');
+INSERT INTO t VALUES (2919, 9, 55.61, 'name2919');
+INSERT INTO t VALUES (2920, 0, 34.80, 'name2920');
+INSERT INTO t VALUES (2921, 1, 13.99, 'name2921');
+INSERT INTO t VALUES (2922, 2, 93.18, 'name2922');
+INSERT INTO t VALUES (2923, 3, 72.37, 'name2923');
+INSERT INTO t VALUES (2924, 4, 51.56, 'name2924');
+INSERT INTO t VALUES (2925, 5, 30.75, 'name2925');
+INSERT INTO t VALUES (2926, 6, 9.94, 'name2926');
+INSERT INTO t VALUES (2927, 7, 89.13, 'name2927');
+INSERT INTO t VALUES (2928, 8, 68.32, 'name2928');
+INSERT INTO t VALUES (2929, 9, 47.51, 'name2929');
+INSERT INTO t VALUES (2930, 0, 26.70, 'name2930');
+INSERT INTO t VALUES (2931, 1, 5.89, 'name2931');
+INSERT INTO t VALUES (2932, 2, 85.08, 'name2932');
+INSERT INTO t VALUES (2933, 3, 64.27, 'name2933');
+INSERT INTO t VALUES (2934, 4, 43.46, 'name2934');
+INSERT INTO t VALUES (2935, 5, 22.65, 'name2935');
+INSERT INTO t VALUES (2936, 6, 1.84, 'name2936');
+INSERT INTO t VALUES (2937, 7, 81.03, 'name2937');
+INSERT INTO t VALUES (2938, 8, 60.22, 'name2938');
+INSERT INTO t VALUES (2939, 9, 39.41, 'name2939');
+INSERT INTO t VALUES (2940, 0, 18.60, 'name2940');
+INSERT INTO t VALUES (2941, 1, 97.79, 'name2941');
+INSERT INTO t VALUES (2942, 2, 76.98, 'name2942');
+INSERT INTO t VALUES (2943, 3, 56.17, 'name2943');
+INSERT INTO t VALUES (2944, 4, 35.36, 'name2944');
+INSERT INTO t VALUES (2945, 5, 14.55, 'name2945');
+INSERT INTO t VALUES (2946, 6, 93.74, 'name2946');
+INSERT INTO t VALUES (2947, 7, 72.93, 'name2947');
+INSERT INTO t VALUES (2948, 8, 52.12, 'name2948');
+INSERT INTO t VALUES (2949, 9, 31.31, 'name2949');
+INSERT INTO t VALUES (2950, 0, 10.50, 'name2950');
+INSERT INTO t VALUES (2951, 1, 89.69, 'name2951');
+INSERT INTO t VALUES (2952, 2, 68.88, 'name2952');
+INSERT INTO t VALUES (2953, 3, 48.07, 'name2953');
+INSERT INTO t VALUES (2954, 4, 27.26, 'name2954');
+INSERT INTO t VALUES (2955, 5, 6.45, 'name2955');
+INSERT INTO t VALUES (2956, 6, 85.64, 'name2956');
+INSERT INTO t VALUES (2957, 7, 64.83, 'name2957');
+INSERT INTO t VALUES (2958, 8, 44.02, 'name2958');
+INSERT INTO t VALUES (2959, 9, 23.21, 'name2959');
+INSERT INTO t VALUES (2960, 0, 2.40, 'name2960');
+INSERT INTO t VALUES (2961, 1, 81.59, 'name2961');
+INSERT INTO t VALUES (2962, 2, 60.78, 'name2962');
+INSERT INTO t VALUES (2963, 3, 39.97, 'name2963');
+INSERT INTO t VALUES (2964, 4, 19.16, 'name2964');
+INSERT INTO t VALUES (2965, 5, 98.35, 'name2965');
+INSERT INTO t VALUES (2966, 6, 77.54, 'name2966');
+INSERT INTO t VALUES (2967, 7, 56.73, 'name2967');
+INSERT INTO t VALUES (2968, 8, 35.92, 'name2968');
+INSERT INTO t VALUES (2969, 9, 15.11, 'name2969');
+INSERT INTO t VALUES (2970, 0, 94.30, 'name2970');
+INSERT INTO t VALUES (2971, 1, 73.49, 'name2971');
+INSERT INTO t VALUES (2972, 2, 52.68, 'name2972');
+INSERT INTO t VALUES (2973, 3, 31.87, 'name2973');
+INSERT INTO t VALUES (2974, 4, 11.06, 'name2974');
+INSERT INTO t VALUES (2975, 5, 90.25, 'name2975');
+INSERT INTO t VALUES (2976, 6, 69.44, 'name2976');
+INSERT INTO t VALUES (2977, 7, 48.63, 'name2977');
+INSERT INTO t VALUES (2978, 8, 27.82, 'name2978');
+INSERT INTO t VALUES (2979, 9, 7.01, 'name2979');
+INSERT INTO t VALUES (2980, 0, 86.20, 'name2980');
+INSERT INTO t VALUES (2981, 1, 65.39, 'name2981');
+INSERT INTO t VALUES (2982, 2, 44.58, 'name2982');
+INSERT INTO t VALUES (2983, 3, 23.77, 'name2983');
+INSERT INTO t VALUES (2984, 4, 2.96, 'name2984');
+INSERT INTO t VALUES (2985, 5, 82.15, 'name2985');
+INSERT INTO t VALUES (2986, 6, 61.34, 'name2986');
+INSERT INTO t VALUES (2987, 7, 40.53, 'name2987');
+INSERT INTO t VALUES (2988, 8, 19.72, 'name2988');
+INSERT INTO t VALUES (2989, 9, 98.91, 'name2989');
+INSERT INTO t VALUES (2990, 0, 78.10, 'name2990');
+INSERT INTO t VALUES (2991, 1, 57.29, 'name2991');
+INSERT INTO t VALUES (2992, 2, 36.48, 'name2992');
+INSERT INTO t VALUES (2993, 3, 15.67, 'name2993');
+INSERT INTO t VALUES (2994, 4, 94.86, 'name2994');
+INSERT INTO t VALUES (2995, 5, 74.05, 'name2995');
+INSERT INTO t VALUES (2996, 6, 53.24, 'name2996');
+INSERT INTO t VALUES (2997, 7, 32.43, 'name2997');
+INSERT INTO t VALUES (2998, 8, 11.62, 'name2998');
+INSERT INTO t VALUES (2999, 9, 90.81, 'name2999');
+INSERT INTO t VALUES (3000, 0, 70.00, 'name3000');
+INSERT INTO t VALUES (3001, 1, 49.19, 'name3001');
+INSERT INTO t VALUES (3002, 2, 28.38, 'name3002');
+INSERT INTO t VALUES (3003, 3, 7.57, 'name3003');
+INSERT INTO t VALUES (3004, 4, 86.76, 'name3004');
+INSERT INTO t VALUES (3005, 5, 65.95, 'name3005');
+INSERT INTO t VALUES (3006, 6, 45.14, 'name3006');
+INSERT INTO t VALUES (3007, 7, 24.33, 'name3007');
+INSERT INTO t VALUES (3008, 8, 3.52, 'name3008');
+INSERT INTO t VALUES (3009, 9, 82.71, 'name3009');
+INSERT INTO t VALUES (3010, 0, 61.90, 'name3010');
+INSERT INTO t VALUES (3011, 1, 41.09, 'name3011');
+INSERT INTO t VALUES (3012, 2, 20.28, 'name3012');
+INSERT INTO t VALUES (3013, 3, 99.47, 'name3013');
+INSERT INTO t VALUES (3014, 4, 78.66, 'name3014');
+INSERT INTO t VALUES (3015, 5, 57.85, 'name3015');
+INSERT INTO t VALUES (3016, 6, 37.04, 'name3016');
+INSERT INTO t VALUES (3017, 7, 16.23, 'name3017');
+INSERT INTO t VALUES (3018, 8, 95.42, 'name3018');
+INSERT INTO t VALUES (3019, 9, 74.61, 'name3019');
+INSERT INTO t VALUES (3020, 0, 53.80, 'name3020');
+INSERT INTO t VALUES (3021, 1, 32.99, 'name3021');
+INSERT INTO t VALUES (3022, 2, 12.18, 'name3022');
+INSERT INTO t VALUES (3023, 3, 91.37, 'name3023');
+INSERT INTO t VALUES (3024, 4, 70.56, 'name3024');
+INSERT INTO t VALUES (3025, 5, 49.75, 'name3025');
+INSERT INTO t VALUES (3026, 6, 28.94, 'name3026');
+INSERT INTO t VALUES (3027, 7, 8.13, 'name3027');
+INSERT INTO t VALUES (3028, 8, 87.32, 'name3028');
+INSERT INTO t VALUES (3029, 9, 66.51, 'name3029');
+INSERT INTO t VALUES (3030, 0, 45.70, 'name3030');
+INSERT INTO t VALUES (3031, 1, 24.89, 'name3031');
+INSERT INTO t VALUES (3032, 2, 4.08, 'name3032');
+INSERT INTO t VALUES (3033, 3, 83.27, 'name3033');
+INSERT INTO t VALUES (3034, 4, 62.46, 'name3034');
+INSERT INTO t VALUES (3035, 5, 41.65, 'name3035');
+INSERT INTO t VALUES (3036, 6, 20.84, 'name3036');
+INSERT INTO t VALUES (3037, 7, 0.03, 'name3037');
+INSERT INTO t VALUES (3038, 8, 79.22, 'name3038');
+INSERT INTO t VALUES (3039, 9, 58.41, 'name3039');
+INSERT INTO t VALUES (3040, 0, 37.60, 'name3040');
+INSERT INTO t VALUES (3041, 1, 16.79, 'name3041');
+INSERT INTO t VALUES (3042, 2, 95.98, 'name3042');
+INSERT INTO t VALUES (3043, 3, 75.17, 'name3043');
+INSERT INTO t VALUES (3044, 4, 54.36, 'name3044');
+INSERT INTO t VALUES (3045, 5, 33.55, 'name3045');
+INSERT INTO t VALUES (3046, 6, 12.74, 'name3046');
+INSERT INTO t VALUES (3047, 7, 91.93, 'name3047');
+INSERT INTO t VALUES (3048, 8, 71.12, 'name3048');
+INSERT INTO t VALUES (3049, 9, 50.31, 'name3049');
+INSERT INTO t VALUES (3050, 0, 29.50, 'name3050');
+INSERT INTO t VALUES (3051, 1, 8.69, 'name3051');
+INSERT INTO t VALUES (3052, 2, 87.88, 'name3052');
+INSERT INTO t VALUES (3053, 3, 67.07, 'name3053');
+INSERT INTO t VALUES (3054, 4, 46.26, 'name3054');
+INSERT INTO t VALUES (3055, 5, 25.45, 'name3055');
+INSERT INTO t VALUES (3056, 6, 4.64, 'name3056');
+INSERT INTO t VALUES (3057, 7, 83.83, 'name3057');
+INSERT INTO t VALUES (3058, 8, 63.02, 'name3058');
+INSERT INTO t VALUES (3059, 9, 42.21, 'name3059');
+INSERT INTO t VALUES (3060, 0, 21.40, 'name3060');
+INSERT INTO t VALUES (3061, 1, 0.59, 'name3061');
+INSERT INTO t VALUES (3062, 2, 79.78, 'name3062');
+INSERT INTO t VALUES (3063, 3, 58.97, 'name3063');
+INSERT INTO t VALUES (3064, 4, 38.16, 'name3064');
+INSERT INTO t VALUES (3065, 5, 17.35, 'name3065');
+INSERT INTO t VALUES (3066, 6, 96.54, 'name3066');
+INSERT INTO t VALUES (3067, 7, 75.73, 'name3067');
+INSERT INTO t VALUES (3068, 8, 54.92, 'name3068');
+INSERT INTO t VALUES (3069, 9, 34.11, 'name3069');
+INSERT INTO t VALUES (3070, 0, 13.30, 'name3070');
+INSERT INTO t VALUES (3071, 1, 92.49, 'name3071');
+INSERT INTO t VALUES (3072, 2, 71.68, 'name3072');
+INSERT INTO t VALUES (3073, 3, 50.87, 'name3073');
+INSERT INTO t VALUES (3074, 4, 30.06, 'name3074');
+INSERT INTO t VALUES (3075, 5, 9.25, 'name3075');
+INSERT INTO t VALUES (3076, 6, 88.44, 'name3076');
+INSERT INTO t VALUES (3077, 7, 67.63, 'name3077');
+INSERT INTO t VALUES (3078, 8, 46.82, 'name3078');
+INSERT INTO t VALUES (3079, 9, 26.01, 'name3079');
+INSERT INTO t VALUES (3080, 0, 5.20, 'name3080');
+INSERT INTO t VALUES (3081, 1, 84.39, 'name3081');
+INSERT INTO t VALUES (3082, 2, 63.58, 'name3082');
+INSERT INTO t VALUES (3083, 3, 42.77, 'name3083');
+INSERT INTO t VALUES (3084, 4, 21.96, 'name3084');
+INSERT INTO t VALUES (3085, 5, 1.15, 'name3085');
+INSERT INTO t VALUES (3086, 6, 80.34, 'name3086');
+INSERT INTO t VALUES (3087, 7, 59.53, 'name3087');
+INSERT INTO t VALUES (3088, 8, 38.72, 'name3088');
+INSERT INTO t VALUES (3089, 9, 17.91, 'name3089');
+INSERT INTO t VALUES (3090, 0, 97.10, 'name3090');
+INSERT INTO t VALUES (3091, 1, 76.29, 'name3091');
+INSERT INTO t VALUES (3092, 2, 55.48, 'name3092');
+INSERT INTO t VALUES (3093, 3, 34.67, 'name3093');
+INSERT INTO t VALUES (3094, 4, 13.86, 'name3094');
+INSERT INTO t VALUES (3095, 5, 93.05, 'name3095');
+INSERT INTO t VALUES (3096, 6, 72.24, 'name3096');
+INSERT INTO t VALUES (3097, 7, 51.43, 'name3097');
+INSERT INTO t VALUES (3098, 8, 30.62, 'name3098');
+INSERT INTO t VALUES (3099, 9, 9.81, 'name3099');
+INSERT INTO t VALUES (3100, 0, 89.00, 'name3100');
+INSERT INTO t VALUES (3101, 1, 68.19, 'name3101');
+INSERT INTO t VALUES (3102, 2, 47.38, 'name3102');
+INSERT INTO t VALUES (3103, 3, 26.57, 'name3103');
+INSERT INTO t VALUES (3104, 4, 5.76, 'name3104');
+INSERT INTO t VALUES (3105, 5, 84.95, 'name3105');
+INSERT INTO t VALUES (3106, 6, 64.14, 'name3106');
+INSERT INTO t VALUES (3107, 7, 43.33, 'name3107');
+INSERT INTO t VALUES (3108, 8, 22.52, 'name3108');
+INSERT INTO t VALUES (3109, 9, 1.71, 'name3109');
+INSERT INTO t VALUES (3110, 0, 80.90, 'name3110');
+INSERT INTO t VALUES (3111, 1, 60.09, 'name3111');
+INSERT INTO t VALUES (3112, 2, 39.28, 'name3112');
+INSERT INTO t VALUES (3113, 3, 18.47, 'name3113');
+INSERT INTO t VALUES (3114, 4, 97.66, 'name3114');
+INSERT INTO t VALUES (3115, 5, 76.85, 'name3115');
+INSERT INTO t VALUES (3116, 6, 56.04, 'name3116');
+INSERT INTO t VALUES (3117, 7, 35.23, 'name3117');
+INSERT INTO t VALUES (3118, 8, 14.42, 'name3118');
+INSERT INTO t VALUES (3119, 9, 93.61, 'name3119');
+INSERT INTO t VALUES (3120, 0, 72.80, 'name3120');
+INSERT INTO t VALUES (3121, 1, 51.99, 'name3121');
+INSERT INTO t VALUES (3122, 2, 31.18, 'name3122');
+INSERT INTO t VALUES (3123, 3, 10.37, 'name3123');
+INSERT INTO t VALUES (3124, 4, 89.56, 'name3124');
+INSERT INTO t VALUES (3125, 5, 68.75, 'name3125');
+INSERT INTO t VALUES (3126, 6, 47.94, 'name3126');
+INSERT INTO t VALUES (3127, 7, 27.13, 'name3127');
+INSERT INTO t VALUES (3128, 8, 6.32, 'name3128');
+INSERT INTO t VALUES (3129, 9, 85.51, 'name3129');
+INSERT INTO t VALUES (3130, 0, 64.70, 'name3130');
+INSERT INTO t VALUES (3131, 1, 43.89, 'name3131');
+INSERT INTO t VALUES (3132, 2, 23.08, 'name3132');
+INSERT INTO t VALUES (3133, 3, 2.27, 'name3133');
+INSERT INTO t VALUES (3134, 4, 81.46, 'name3134');
+INSERT INTO t VALUES (3135, 5, 60.65, 'name3135');
+INSERT INTO t VALUES (3136, 6, 39.84, 'name3136');
+INSERT INTO t VALUES (3137, 7, 19.03, 'name3137');
+INSERT INTO t VALUES (3138, 8, 98.22, 'name3138');
+INSERT INTO t VALUES (3139, 9, 77.41, 'name3139');
+INSERT INTO t VALUES (3140, 0, 56.60, 'name3140');
+INSERT INTO t VALUES (3141, 1, 35.79, 'name3141');
+INSERT INTO t VALUES (3142, 2, 14.98, 'name3142');
+INSERT INTO t VALUES (3143, 3, 94.17, 'name3143');
+INSERT INTO t VALUES (3144, 4, 73.36, 'name3144');
+INSERT INTO t VALUES (3145, 5, 52.55, 'name3145');
+INSERT INTO t VALUES (3146, 6, 31.74, 'name3146');
+INSERT INTO t VALUES (3147, 7, 10.93, 'name3147');
+INSERT INTO t VALUES (3148, 8, 90.12, 'name3148');
+INSERT INTO t VALUES (3149, 9, 69.31, 'name3149');
+INSERT INTO t VALUES (3150, 0, 48.50, 'name3150');
+INSERT INTO t VALUES (3151, 1, 27.69, 'name3151');
+INSERT INTO t VALUES (3152, 2, 6.88, 'name3152');
+INSERT INTO t VALUES (3153, 3, 86.07, 'name3153');
+INSERT INTO t VALUES (3154, 4, 65.26, 'name3154');
+INSERT INTO t VALUES (3155, 5, 44.45, 'name3155');
+INSERT INTO t VALUES (3156, 6, 23.64, 'name3156');
+INSERT INTO t VALUES (3157, 7, 2.83, 'name3157');
+INSERT INTO t VALUES (3158, 8, 82.02, 'name3158');
+INSERT INTO t VALUES (3159, 9, 61.21, 'name3159');
+INSERT INTO t VALUES (3160, 0, 40.40, 'name3160');
+INSERT INTO t VALUES (3161, 1, 19.59, 'name3161');
+INSERT INTO t VALUES (3162, 2, 98.78, 'name3162');
+INSERT INTO t VALUES (3163, 3, 77.97, 'name3163');
+INSERT INTO t VALUES (3164, 4, 57.16, 'name3164');
+INSERT INTO t VALUES (3165, 5, 36.35, 'name3165');
+INSERT INTO t VALUES (3166, 6, 15.54, 'name3166');
+INSERT INTO t VALUES (3167, 7, 94.73, 'name3167');
+INSERT INTO t VALUES (3168, 8, 73.92, 'name3168');
+INSERT INTO t VALUES (3169, 9, 53.11, 'name3169');
+INSERT INTO t VALUES (3170, 0, 32.30, 'name3170');
+INSERT INTO t VALUES (3171, 1, 11.49, 'name3171');
+INSERT INTO t VALUES (3172, 2, 90.68, 'name3172');
+INSERT INTO t VALUES (3173, 3, 69.87, 'name3173');
+INSERT INTO t VALUES (3174, 4, 49.06, 'name3174');
+INSERT INTO t VALUES (3175, 5, 28.25, 'name3175');
+INSERT INTO t VALUES (3176, 6, 7.44, 'name3176');
+INSERT INTO t VALUES (3177, 7, 86.63, 'name3177');
+INSERT INTO t VALUES (3178, 8, 65.82, 'name3178');
+INSERT INTO t VALUES (3179, 9, 45.01, 'name3179');
+INSERT INTO t VALUES (3180, 0, 24.20, 'name3180');
+INSERT INTO t VALUES (3181, 1, 3.39, 'name3181');
+INSERT INTO t VALUES (3182, 2, 82.58, 'name3182');
+INSERT INTO t VALUES (3183, 3, 61.77, 'name3183');
+INSERT INTO t VALUES (3184, 4, 40.96, 'name3184');
+INSERT INTO t VALUES (3185, 5, 20.15, 'name3185');
+INSERT INTO t VALUES (3186, 6, 99.34, 'name3186');
+INSERT INTO t VALUES (3187, 7, 78.53, 'name3187');
+INSERT INTO t VALUES (3188, 8, 57.72, 'name3188');
+INSERT INTO t VALUES (3189, 9, 36.91, 'name3189');
+INSERT INTO t VALUES (3190, 0, 16.10, 'name3190');
+INSERT INTO t VALUES (3191, 1, 95.29, 'name3191');
+INSERT INTO t VALUES (3192, 2, 74.48, 'name3192');
+INSERT INTO t VALUES (3193, 3, 53.67, 'name3193');
+INSERT INTO t VALUES (3194, 4, 32.86, 'name3194');
+INSERT INTO t VALUES (3195, 5, 12.05, 'name3195');
+INSERT INTO t VALUES (3196, 6, 91.24, 'name3196');
+INSERT INTO t VALUES (3197, 7, 70.43, 'name3197');
+INSERT INTO t VALUES (3198, 8, 49.62, 'name3198');
+INSERT INTO t VALUES (3199, 9, 28.81, 'name3199');
+INSERT INTO t VALUES (3200, 0, 8.00, 'name3200');
+INSERT INTO t VALUES (3201, 1, 87.19, 'name3201');
+INSERT INTO t VALUES (3202, 2, 66.38, 'name3202');
+INSERT INTO t VALUES (3203, 3, 45.57, 'name3203');
+INSERT INTO t VALUES (3204, 4, 24.76, 'name3204');
+INSERT INTO t VALUES (3205, 5, 3.95, 'name3205');
+INSERT INTO t VALUES (3206, 6, 83.14, 'name3206');
+INSERT INTO t VALUES (3207, 7, 62.33, 'name3207');
+INSERT INTO t VALUES (3208, 8, 41.52, 'name3208');
+INSERT INTO t VALUES (3209, 9, 20.71, 'name3209');
+INSERT INTO t VALUES (3210, 0, 99.90, 'name3210');
+INSERT INTO t VALUES (3211, 1, 79.09, 'name3211');
+INSERT INTO t VALUES (3212, 2, 58.28, 'name3212');
+INSERT INTO t VALUES (3213, 3, 37.47, 'name3213');
+INSERT INTO t VALUES (3214, 4, 16.66, 'name3214');
+INSERT INTO t VALUES (3215, 5, 95.85, 'name3215');
+INSERT INTO t VALUES (3216, 6, 75.04, 'name3216');
+INSERT INTO t VALUES (3217, 7, 54.23, 'name3217');
+INSERT INTO t VALUES (3218, 8, 33.42, 'name3218');
+INSERT INTO t VALUES (3219, 9, 12.61, 'name3219');
+INSERT INTO t VALUES (3220, 0, 91.80, 'name3220');
+INSERT INTO t VALUES (3221, 1, 70.99, 'name3221');
+INSERT INTO t VALUES (3222, 2, 50.18, 'name3222');
+INSERT INTO t VALUES (3223, 3, 29.37, 'name3223');
+INSERT INTO t VALUES (3224, 4, 8.56, 'name3224');
+INSERT INTO t VALUES (3225, 5, 87.75, 'name3225');
+INSERT INTO t VALUES (3226, 6, 66.94, 'name3226');
+INSERT INTO t VALUES (3227, 7, 46.13, 'name3227');
+INSERT INTO t VALUES (3228, 8, 25.32, 'name3228');
+INSERT INTO t VALUES (3229, 9, 4.51, 'name3229');
+INSERT INTO t VALUES (3230, 0, 83.70, 'name3230');
+INSERT INTO t VALUES (3231, 1, 62.89, 'name3231');
+INSERT INTO t VALUES (3232, 2, 42.08, 'name3232');
+INSERT INTO t VALUES (3233, 3, 21.27, 'name3233');
+INSERT INTO t VALUES (3234, 4, 0.46, 'name3234');
+INSERT INTO t VALUES (3235, 5, 79.65, 'name3235');
+INSERT INTO t VALUES (3236, 6, 58.84, 'name3236');
+INSERT INTO t VALUES (3237, 7, 38.03, 'name3237');
+INSERT INTO t VALUES (3238, 8, 17.22, 'name3238');
+INSERT INTO t VALUES (3239, 9, 96.41, 'name3239');
+INSERT INTO t VALUES (3240, 0, 75.60, 'name3240');
+INSERT INTO t VALUES (3241, 1, 54.79, 'name3241');
+INSERT INTO t VALUES (3242, 2, 33.98, 'name3242');
+INSERT INTO t VALUES (3243, 3, 13.17, 'name3243');
+INSERT INTO t VALUES (3244, 4, 92.36, 'name3244');
+INSERT INTO t VALUES (3245, 5, 71.55, 'name3245');
+INSERT INTO t VALUES (3246, 6, 50.74, 'name3246');
+INSERT INTO t VALUES (3247, 7, 29.93, 'name3247');
+INSERT INTO t VALUES (3248, 8, 9.12, 'name3248');
+INSERT INTO t VALUES (3249, 9, 88.31, 'name3249');
+INSERT INTO t VALUES (3250, 0, 67.50, 'name3250');
+INSERT INTO t VALUES (3251, 1, 46.69, 'name3251');
+INSERT INTO t VALUES (3252, 2, 25.88, 'name3252');
+INSERT INTO t VALUES (3253, 3, 5.07, 'name3253');
+INSERT INTO t VALUES (3254, 4, 84.26, 'name3254');
+INSERT INTO t VALUES (3255, 5, 63.45, 'name3255');
+INSERT INTO t VALUES (3256, 6, 42.64, 'name3256');
+INSERT INTO t VALUES (3257, 7, 21.83, 'name3257');
+INSERT INTO t VALUES (3258, 8, 1.02, 'name3258');
+INSERT INTO t VALUES (3259, 9, 80.21, 'name3259');
+INSERT INTO t VALUES (3260, 0, 59.40, 'name3260');
+INSERT INTO t VALUES (3261, 1, 38.59, 'name3261');
+INSERT INTO t VALUES (3262, 2, 17.78, 'name3262');
+INSERT INTO t VALUES (3263, 3, 96.97, 'name3263');
+INSERT INTO t VALUES (3264, 4, 76.16, 'name3264');
+INSERT INTO t VALUES (3265, 5, 55.35, 'name3265');
+INSERT INTO t VALUES (3266, 6, 34.54, 'name3266');
+INSERT INTO t VALUES (3267, 7, 13.73, 'name3267');
+INSERT INTO t VALUES (3268, 8, 92.92, 'name3268');
+INSERT INTO t VALUES (3269, 9, 72.11, 'name3269');
+INSERT INTO t VALUES (3270, 0, 51.30, 'name3270');
+INSERT INTO t VALUES (3271, 1, 30.49, 'name3271');
+INSERT INTO t VALUES (3272, 2, 9.68, 'name3272');
+INSERT INTO t VALUES (3273, 3, 88.87, 'name3273');
+INSERT INTO t VALUES (3274, 4, 68.06, 'name3274');
+INSERT INTO t VALUES (3275, 5, 47.25, 'name3275');
+INSERT INTO t VALUES (3276, 6, 26.44, 'name3276');
+INSERT INTO t VALUES (3277, 7, 5.63, 'name3277');
+INSERT INTO t VALUES (3278, 8, 84.82, 'name3278');
+INSERT INTO t VALUES (3279, 9, 64.01, 'name3279');
+INSERT INTO t VALUES (3280, 0, 43.20, 'name3280');
+INSERT INTO t VALUES (3281, 1, 22.39, 'name3281');
+INSERT INTO t VALUES (3282, 2, 1.58, 'name3282');
+INSERT INTO t VALUES (3283, 3, 80.77, 'name3283');
+INSERT INTO t VALUES (3284, 4, 59.96, 'name3284');
+INSERT INTO t VALUES (3285, 5, 39.15, 'name3285');
+INSERT INTO t VALUES (3286, 6, 18.34, 'name3286');
+INSERT INTO t VALUES (3287, 7, 97.53, 'name3287');
+INSERT INTO t VALUES (3288, 8, 76.72, 'name3288');
+INSERT INTO t VALUES (3289, 9, 55.91, 'name3289');
+INSERT INTO t VALUES (3290, 0, 35.10, 'name3290');
+INSERT INTO t VALUES (3291, 1, 14.29, 'name3291');
+INSERT INTO t VALUES (3292, 2, 93.48, 'name3292');
+INSERT INTO t VALUES (3293, 3, 72.67, 'name3293');
+INSERT INTO t VALUES (3294, 4, 51.86, 'name3294');
+INSERT INTO t VALUES (3295, 5, 31.05, 'name3295');
+INSERT INTO t VALUES (3296, 6, 10.24, 'name3296');
+INSERT INTO t VALUES (3297, 7, 89.43, 'name3297');
+INSERT INTO t VALUES (3298, 8, 68.62, 'name3298');
+INSERT INTO t VALUES (3299, 9, 47.81, 'name3299');
+INSERT INTO t VALUES (3300, 0, 27.00, 'name3300');
+INSERT INTO t VALUES (3301, 1, 6.19, 'name3301');
+INSERT INTO t VALUES (3302, 2, 85.38, 'name3302');
+INSERT INTO t VALUES (3303, 3, 64.57, 'name3303');
+INSERT INTO t VALUES (3304, 4, 43.76, 'name3304');
+INSERT INTO t VALUES (3305, 5, 22.95, 'name3305');
+INSERT INTO t VALUES (3306, 6, 2.14, 'name3306');
+INSERT INTO t VALUES (3307, 7, 81.33, 'name3307');
+INSERT INTO t VALUES (3308, 8, 60.52, 'name3308');
+INSERT INTO t VALUES (3309, 9, 39.71, 'name3309');
+INSERT INTO t VALUES (3310, 0, 18.90, 'name3310');
+INSERT INTO t VALUES (3311, 1, 98.09, 'name3311');
+INSERT INTO t VALUES (3312, 2, 77.28, 'name3312');
+INSERT INTO t VALUES (3313, 3, 56.47, 'name3313');
+INSERT INTO t VALUES (3314, 4, 35.66, 'name3314');
+INSERT INTO t VALUES (3315, 5, 14.85, 'name3315');
+INSERT INTO t VALUES (3316, 6, 94.04, 'name3316');
+INSERT INTO t VALUES (3317, 7, 73.23, 'name3317');
+INSERT INTO t VALUES (3318, 8, 52.42, 'name3318');
+INSERT INTO t VALUES (3319, 9, 31.61, 'name3319');
+INSERT INTO t VALUES (3320, 0, 10.80, 'name3320');
+INSERT INTO t VALUES (3321, 1, 89.99, 'name3321');
+INSERT INTO t VALUES (3322, 2, 69.18, 'name3322');
+INSERT INTO t VALUES (3323, 3, 48.37, 'name3323');
+INSERT INTO t VALUES (3324, 4, 27.56, 'name3324');
+INSERT INTO t VALUES (3325, 5, 6.75, 'name3325');
+INSERT INTO t VALUES (3326, 6, 85.94, 'name3326');
+INSERT INTO t VALUES (3327, 7, 65.13, 'name3327');
+INSERT INTO t VALUES (3328, 8, 44.32, 'name3328');
+INSERT INTO t VALUES (3329, 9, 23.51, 'name3329');
+INSERT INTO t VALUES (3330, 0, 2.70, 'name3330');
+INSERT INTO t VALUES (3331, 1, 81.89, 'name3331');
+INSERT INTO t VALUES (3332, 2, 61.08, 'name3332');
+INSERT INTO t VALUES (3333, 3, 40.27, 'name3333');
+INSERT INTO t VALUES (3334, 4, 19.46, 'name3334');
+INSERT INTO t VALUES (3335, 5, 98.65, 'name3335');
+INSERT INTO t VALUES (3336, 6, 77.84, 'name3336');
+INSERT INTO t VALUES (3337, 7, 57.03, 'name3337');
+INSERT INTO t VALUES (3338, 8, 36.22, 'name3338');
+INSERT INTO t VALUES (3339, 9, 15.41, 'name3339');
+INSERT INTO t VALUES (3340, 0, 94.60, 'name3340');
+INSERT INTO t VALUES (3341, 1, 73.79, 'name3341');
+INSERT INTO t VALUES (3342, 2, 52.98, 'name3342');
+INSERT INTO t VALUES (3343, 3, 32.17, 'name3343');
+INSERT INTO t VALUES (3344, 4, 11.36, 'name3344');
+INSERT INTO t VALUES (3345, 5, 90.55, 'name3345');
+INSERT INTO t VALUES (3346, 6, 69.74, 'name3346');
+INSERT INTO t VALUES (3347, 7, 48.93, 'name3347');
+INSERT INTO t VALUES (3348, 8, 28.12, 'name3348');
+INSERT INTO t VALUES (3349, 9, 7.31, 'name3349');
+INSERT INTO t VALUES (3350, 0, 86.50, 'name3350');
+INSERT INTO t VALUES (3351, 1, 65.69, 'name3351');
+INSERT INTO t VALUES (3352, 2, 44.88, 'name3352');
+INSERT INTO t VALUES (3353, 3, 24.07, 'name3353');
+INSERT INTO t VALUES (3354, 4, 3.26, 'name3354');
+INSERT INTO t VALUES (3355, 5, 82.45, 'name3355');
+INSERT INTO t VALUES (3356, 6, 61.64, 'name3356');
+INSERT INTO t VALUES (3357, 7, 40.83, 'name3357');
+INSERT INTO t VALUES (3358, 8, 20.02, 'name3358');
+INSERT INTO t VALUES (3359, 9, 99.21, 'name3359');
+INSERT INTO t VALUES (3360, 0, 78.40, 'name3360');
+INSERT INTO t VALUES (3361, 1, 57.59, 'name3361');
+INSERT INTO t VALUES (3362, 2, 36.78, 'name3362');
+INSERT INTO t VALUES (3363, 3, 15.97, 'name3363');
+INSERT INTO t VALUES (3364, 4, 95.16, 'name3364');
+INSERT INTO t VALUES (3365, 5, 74.35, 'name3365');
+INSERT INTO t VALUES (3366, 6, 53.54, 'name3366');
+INSERT INTO t VALUES (3367, 7, 32.73, 'name3367');
+INSERT INTO t VALUES (3368, 8, 11.92, 'name3368');
+INSERT INTO t VALUES (3369, 9, 91.11, 'name3369');
+INSERT INTO t VALUES (3370, 0, 70.30, 'name3370');
+INSERT INTO t VALUES (3371, 1, 49.49, 'name3371');
+INSERT INTO t VALUES (3372, 2, 28.68, 'name3372');
+INSERT INTO t VALUES (3373, 3, 7.87, 'name3373');
+INSERT INTO t VALUES (3374, 4, 87.06, 'name3374');
+INSERT INTO t VALUES (3375, 5, 66.25, 'name3375');
+INSERT INTO t VALUES (3376, 6, 45.44, 'name3376');
+INSERT INTO t VALUES (3377, 7, 24.63, 'name3377');
+INSERT INTO t VALUES (3378, 8, 3.82, 'name3378');
+INSERT INTO t VALUES (3379, 9, 83.01, 'name3379');
+INSERT INTO t VALUES (3380, 0, 62.20, 'name3380');
+INSERT INTO t VALUES (3381, 1, 41.39, 'name3381');
+INSERT INTO t VALUES (3382, 2, 20.58, 'name3382');
+INSERT INTO t VALUES (3383, 3, 99.77, 'name3383');
+INSERT INTO t VALUES (3384, 4, 78.96, 'name3384');
+INSERT INTO t VALUES (3385, 5, 58.15, 'name3385');
+INSERT INTO t VALUES (3386, 6, 37.34, 'name3386');
+INSERT INTO t VALUES (3387, 7, 16.53, 'name3387');
+INSERT INTO t VALUES (3388, 8, 95.72, 'name3388');
+INSERT INTO t VALUES (3389, 9, 74.91, 'name3389');
+INSERT INTO t VALUES (3390, 0, 54.10, 'name3390');
+INSERT INTO t VALUES (3391, 1, 33.29, 'name3391');
+INSERT INTO t VALUES (3392, 2, 12.48, 'name3392');
+INSERT INTO t VALUES (3393, 3, 91.67, 'name3393');
+INSERT INTO t VALUES (3394, 4, 70.86, 'name3394');
+INSERT INTO t VALUES (3395, 5, 50.05, 'name3395');
+INSERT INTO t VALUES (3396, 6, 29.24, 'name3396');
+INSERT INTO t VALUES (3397, 7, 8.43, 'name3397');
+INSERT INTO t VALUES (3398, 8, 87.62, 'name3398');
+INSERT INTO t VALUES (3399, 9, 66.81, 'name3399');
+INSERT INTO t VALUES (3400, 0, 46.00, 'name3400');
+INSERT INTO t VALUES (3401, 1, 25.19, 'name3401');
+INSERT INTO t VALUES (3402, 2, 4.38, 'name3402');
+INSERT INTO t VALUES (3403, 3, 83.57, 'name3403');
+INSERT INTO t VALUES (3404, 4, 62.76, 'name3404');
+INSERT INTO t VALUES (3405, 5, 41.95, 'name3405');
+INSERT INTO t VALUES (3406, 6, 21.14, 'name3406');
+INSERT INTO t VALUES (3407, 7, 0.33, 'name3407');
+INSERT INTO t VALUES (3408, 8, 79.52, 'name3408');
+INSERT INTO t VALUES (3409, 9, 58.71, 'name3409');
+INSERT INTO t VALUES (3410, 0, 37.90, 'name3410');
+INSERT INTO t VALUES (3411, 1, 17.09, 'name3411');
+INSERT INTO t VALUES (3412, 2, 96.28, 'name3412');
+INSERT INTO t VALUES (3413, 3, 75.47, 'name3413');
+INSERT INTO t VALUES (3414, 4, 54.66, 'name3414');
+INSERT INTO t VALUES (3415, 5, 33.85, 'name3415');
+INSERT INTO t VALUES (3416, 6, 13.04, 'name3416');
+INSERT INTO t VALUES (3417, 7, 92.23, 'name3417');
+INSERT INTO t VALUES (3418, 8, 71.42, 'name3418');
+INSERT INTO t VALUES (3419, 9, 50.61, 'name3419');
+INSERT INTO t VALUES (3420, 0, 29.80, 'name3420');
+INSERT INTO t VALUES (3421, 1, 8.99, 'name3421');
+INSERT INTO t VALUES (3422, 2, 88.18, 'name3422');
+INSERT INTO t VALUES (3423, 3, 67.37, 'name3423');
+INSERT INTO t VALUES (3424, 4, 46.56, 'name3424');
+INSERT INTO t VALUES (3425, 5, 25.75, 'name3425');
+INSERT INTO t VALUES (3426, 6, 4.94, 'name3426');
+INSERT INTO t VALUES (3427, 7, 84.13, 'name3427');
+INSERT INTO t VALUES (3428, 8, 63.32, 'name3428');
+INSERT INTO t VALUES (3429, 9, 42.51, 'name3429');
+INSERT INTO t VALUES (3430, 0, 21.70, 'name3430');
+INSERT INTO t VALUES (3431, 1, 0.89, 'name3431');
+INSERT INTO t VALUES (3432, 2, 80.08, 'name3432');
+INSERT INTO t VALUES (3433, 3, 59.27, 'name3433');
+INSERT INTO t VALUES (3434, 4, 38.46, 'name3434');
+INSERT INTO t VALUES (3435, 5, 17.65, 'name3435');
+INSERT INTO t VALUES (3436, 6, 96.84, 'name3436');
+INSERT INTO t VALUES (3437, 7, 76.03, 'name3437');
+INSERT INTO t VALUES (3438, 8, 55.22, 'name3438');
+INSERT INTO t VALUES (3439, 9, 34.41, 'name3439');
+INSERT INTO t VALUES (3440, 0, 13.60, 'name3440');
+INSERT INTO t VALUES (3441, 1, 92.79, 'name3441');
+INSERT INTO t VALUES (3442, 2, 71.98, 'name3442');
+INSERT INTO t VALUES (3443, 3, 51.17, 'name3443');
+INSERT INTO t VALUES (3444, 4, 30.36, 'name3444');
+INSERT INTO t VALUES (3445, 5, 9.55, 'name3445');
+INSERT INTO t VALUES (3446, 6, 88.74, 'name3446');
+INSERT INTO t VALUES (3447, 7, 67.93, 'name3447');
+INSERT INTO t VALUES (3448, 8, 47.12, 'name3448');
+INSERT INTO t VALUES (3449, 9, 26.31, 'name3449');
+INSERT INTO t VALUES (3450, 0, 5.50, 'name3450');
+INSERT INTO t VALUES (3451, 1, 84.69, 'name3451');
+INSERT INTO t VALUES (3452, 2, 63.88, 'name3452');
+INSERT INTO t VALUES (3453, 3, 43.07, 'name3453');
+INSERT INTO t VALUES (3454, 4, 22.26, 'name3454');
+INSERT INTO t VALUES (3455, 5, 1.45, 'name3455');
+INSERT INTO t VALUES (3456, 6, 80.64, 'name3456');
+INSERT INTO t VALUES (3457, 7, 59.83, 'name3457');
+INSERT INTO t VALUES (3458, 8, 39.02, 'name3458');
+INSERT INTO t VALUES (3459, 9, 18.21, 'name3459');
+INSERT INTO t VALUES (3460, 0, 97.40, 'name3460');
+INSERT INTO t VALUES (3461, 1, 76.59, 'name3461');
+INSERT INTO t VALUES (3462, 2, 55.78, 'name3462');
+INSERT INTO t VALUES (3463, 3, 34.97, 'name3463');
+INSERT INTO t VALUES (3464, 4, 14.16, 'name3464');
+INSERT INTO t VALUES (3465, 5, 93.35, 'name3465');
+INSERT INTO t VALUES (3466, 6, 72.54, 'name3466');
+INSERT INTO t VALUES (3467, 7, 51.73, 'name3467');
+INSERT INTO t VALUES (3468, 8, 30.92, 'name3468');
+INSERT INTO t VALUES (3469, 9, 10.11, 'name3469');
+INSERT INTO t VALUES (3470, 0, 89.30, 'name3470');
+INSERT INTO t VALUES (3471, 1, 68.49, 'name3471');
+INSERT INTO t VALUES (3472, 2, 47.68, 'name3472');
+INSERT INTO t VALUES (3473, 3, 26.87, 'name3473');
+INSERT INTO t VALUES (3474, 4, 6.06, 'name3474');
+INSERT INTO t VALUES (3475, 5, 85.25, 'name3475');
+INSERT INTO t VALUES (3476, 6, 64.44, 'name3476');
+INSERT INTO t VALUES (3477, 7, 43.63, 'name3477');
+INSERT INTO t VALUES (3478, 8, 22.82, 'name3478');
+INSERT INTO t VALUES (3479, 9, 2.01, 'name3479');
+INSERT INTO t VALUES (3480, 0, 81.20, 'name3480');
+INSERT INTO t VALUES (3481, 1, 60.39, 'name3481');
+INSERT INTO t VALUES (3482, 2, 39.58, 'name3482');
+INSERT INTO t VALUES (3483, 3, 18.77, 'name3483');
+INSERT INTO t VALUES (3484, 4, 97.96, 'name3484');
+INSERT INTO t VALUES (3485, 5, 77.15, 'name3485');
+INSERT INTO t VALUES (3486, 6, 56.34, 'name3486');
+INSERT INTO t VALUES (3487, 7, 35.53, 'name3487');
+INSERT INTO t VALUES (3488, 8, 14.72, 'name3488');
+INSERT INTO t VALUES (3489, 9, 93.91, 'name3489');
+INSERT INTO t VALUES (3490, 0, 73.10, 'name3490');
+INSERT INTO t VALUES (3491, 1, 52.29, 'name3491');
+INSERT INTO t VALUES (3492, 2, 31.48, 'name3492');
+INSERT INTO t VALUES (3493, 3, 10.67, 'name3493');
+INSERT INTO t VALUES (3494, 4, 89.86, 'name3494');
+INSERT INTO t VALUES (3495, 5, 69.05, 'name3495');
+INSERT INTO t VALUES (3496, 6, 48.24, 'name3496');
+INSERT INTO t VALUES (3497, 7, 27.43, 'name3497');
+INSERT INTO t VALUES (3498, 8, 6.62, 'name3498');
+INSERT INTO t VALUES (3499, 9, 85.81, 'name3499');
+INSERT INTO t VALUES (3500, 0, 65.00, 'name3500');
+INSERT INTO t VALUES (3501, 1, 44.19, 'name3501');
+INSERT INTO t VALUES (3502, 2, 23.38, 'name3502');
+INSERT INTO t VALUES (3503, 3, 2.57, 'name3503');
+INSERT INTO t VALUES (3504, 4, 81.76, 'name3504');
+INSERT INTO t VALUES (3505, 5, 60.95, 'name3505');
+INSERT INTO t VALUES (3506, 6, 40.14, 'name3506');
+INSERT INTO t VALUES (3507, 7, 19.33, 'name3507');
+INSERT INTO t VALUES (3508, 8, 98.52, 'name3508');
+INSERT INTO t VALUES (3509, 9, 77.71, 'name3509');
+INSERT INTO t VALUES (3510, 0, 56.90, 'name3510');
+INSERT INTO t VALUES (3511, 1, 36.09, 'name3511');
+INSERT INTO t VALUES (3512, 2, 15.28, 'name3512');
+INSERT INTO t VALUES (3513, 3, 94.47, 'name3513');
+INSERT INTO t VALUES (3514, 4, 73.66, 'name3514');
+INSERT INTO t VALUES (3515, 5, 52.85, 'name3515');
+INSERT INTO t VALUES (3516, 6, 32.04, 'name3516');
+INSERT INTO t VALUES (3517, 7, 11.23, 'name3517');
+INSERT INTO t VALUES (3518, 8, 90.42, 'name3518');
+INSERT INTO t VALUES (3519, 9, 69.61, 'name3519');
+INSERT INTO t VALUES (3520, 0, 48.80, 'name3520');
+INSERT INTO t VALUES (3521, 1, 27.99, 'name3521');
+INSERT INTO t VALUES (3522, 2, 7.18, 'name3522');
+INSERT INTO t VALUES (3523, 3, 86.37, 'name3523');
+INSERT INTO t VALUES (3524, 4, 65.56, 'name3524');
+INSERT INTO t VALUES (3525, 5, 44.75, 'name3525');
+INSERT INTO t VALUES (3526, 6, 23.94, 'name3526');
+INSERT INTO t VALUES (3527, 7, 3.13, 'name3527');
+INSERT INTO t VALUES (3528, 8, 82.32, 'name3528');
+INSERT INTO t VALUES (3529, 9, 61.51, 'name3529');
+INSERT INTO t VALUES (3530, 0, 40.70, 'name3530');
+INSERT INTO t VALUES (3531, 1, 19.89, 'name3531');
+INSERT INTO t VALUES (3532, 2, 99.08, 'name3532');
+INSERT INTO t VALUES (3533, 3, 78.27, 'name3533');
+INSERT INTO t VALUES (3534, 4, 57.46, 'name3534');
+INSERT INTO t VALUES (3535, 5, 36.65, 'name3535');
+INSERT INTO t VALUES (3536, 6, 15.84, 'name3536');
+INSERT INTO t VALUES (3537, 7, 95.03, 'name3537');
+INSERT INTO t VALUES (3538, 8, 74.22, 'name3538');
+INSERT INTO t VALUES (3539, 9, 53.41, 'name3539');
+INSERT INTO t VALUES (3540, 0, 32.60, 'name3540');
+INSERT INTO t VALUES (3541, 1, 11.79, 'name3541');
+INSERT INTO t VALUES (3542, 2, 90.98, 'name3542');
+INSERT INTO t VALUES (3543, 3, 70.17, 'name3543');
+INSERT INTO t VALUES (3544, 4, 49.36, 'name3544');
+INSERT INTO t VALUES (3545, 5, 28.55, 'name3545');
+INSERT INTO t VALUES (3546, 6, 7.74, 'name3546');
+INSERT INTO t VALUES (3547, 7, 86.93, 'name3547');
+INSERT INTO t VALUES (3548, 8, 66.12, 'name3548');
+INSERT INTO t VALUES (3549, 9, 45.31, 'name3549');
+INSERT INTO t VALUES (3550, 0, 24.50, 'name3550');
+INSERT INTO t VALUES (3551, 1, 3.69, 'name3551');
+INSERT INTO t VALUES (3552, 2, 82.88, 'name3552');
+INSERT INTO t VALUES (3553, 3, 62.07, 'name3553');
+INSERT INTO t VALUES (3554, 4, 41.26, 'name3554');
+INSERT INTO t VALUES (3555, 5, 20.45, 'name3555');
+INSERT INTO t VALUES (3556, 6, 99.64, 'name3556');
+INSERT INTO t VALUES (3557, 7, 78.83, 'name3557');
+INSERT INTO t VALUES (3558, 8, 58.02, 'name3558');
+INSERT INTO t VALUES (3559, 9, 37.21, 'name3559');
+INSERT INTO t VALUES (3560, 0, 16.40, 'name3560');
+INSERT INTO t VALUES (3561, 1, 95.59, 'name3561');
+INSERT INTO t VALUES (3562, 2, 74.78, 'name3562');
+INSERT INTO t VALUES (3563, 3, 53.97, 'name3563');
+INSERT INTO t VALUES (3564, 4, 33.16, 'name3564');
+INSERT INTO t VALUES (3565, 5, 12.35, 'name3565');
+INSERT INTO t VALUES (3566, 6, 91.54, 'name3566');
+INSERT INTO t VALUES (3567, 7, 70.73, 'name3567');
+INSERT INTO t VALUES (3568, 8, 49.92, 'name3568');
+INSERT INTO t VALUES (3569, 9, 29.11, 'name3569');
+INSERT INTO t VALUES (3570, 0, 8.30, 'name3570');
+INSERT INTO t VALUES (3571, 1, 87.49, 'name3571');
+INSERT INTO t VALUES (3572, 2, 66.68, 'name3572');
+INSERT INTO t VALUES (3573, 3, 45.87, 'name3573');
+INSERT INTO t VALUES (3574, 4, 25.06, 'name3574');
+INSERT INTO t VALUES (3575, 5, 4.25, 'name3575');
+INSERT INTO t VALUES (3576, 6, 83.44, 'name3576');
+INSERT INTO t VALUES (3577, 7, 62.63, 'name3577');
+INSERT INTO t VALUES (3578, 8, 41.82, 'name3578');
+INSERT INTO t VALUES (3579, 9, 21.01, 'name3579');
+INSERT INTO t VALUES (3580, 0, 0.20, 'name3580');
+INSERT INTO t VALUES (3581, 1, 79.39, 'name3581');
+INSERT INTO t VALUES (3582, 2, 58.58, 'name3582');
+INSERT INTO t VALUES (3583, 3, 37.77, 'name3583');
+INSERT INTO t VALUES (3584, 4, 16.96, 'name3584');
+INSERT INTO t VALUES (3585, 5, 96.15, 'name3585');
+INSERT INTO t VALUES (3586, 6, 75.34, 'name3586');
+INSERT INTO t VALUES (3587, 7, 54.53, 'name3587');
+INSERT INTO t VALUES (3588, 8, 33.72, 'name3588');
+INSERT INTO t VALUES (3589, 9, 12.91, 'name3589');
+INSERT INTO t VALUES (3590, 0, 92.10, 'name3590');
+INSERT INTO t VALUES (3591, 1, 71.29, 'name3591');
+INSERT INTO t VALUES (3592, 2, 50.48, 'name3592');
+INSERT INTO t VALUES (3593, 3, 29.67, 'name3593');
+INSERT INTO t VALUES (3594, 4, 8.86, 'name3594');
+INSERT INTO t VALUES (3595, 5, 88.05, 'name3595');
+INSERT INTO t VALUES (3596, 6, 67.24, 'name3596');
+INSERT INTO t VALUES (3597, 7, 46.43, 'name3597');
+INSERT INTO t VALUES (3598, 8, 25.62, 'name3598');
+INSERT INTO t VALUES (3599, 9, 4.81, 'name3599');
+INSERT INTO t VALUES (3600, 0, 84.00, 'name3600');
+INSERT INTO t VALUES (3601, 1, 63.19, 'name3601');
+INSERT INTO t VALUES (3602, 2, 42.38, 'name3602');
+INSERT INTO t VALUES (3603, 3, 21.57, 'name3603');
+INSERT INTO t VALUES (3604, 4, 0.76, 'name3604');
+INSERT INTO t VALUES (3605, 5, 79.95, 'name3605');
+INSERT INTO t VALUES (3606, 6, 59.14, 'name3606');
+INSERT INTO t VALUES (3607, 7, 38.33, 'name3607');
+INSERT INTO t VALUES (3608, 8, 17.52, 'name3608');
+INSERT INTO t VALUES (3609, 9, 96.71, 'name3609');
+INSERT INTO t VALUES (3610, 0, 75.90, 'name3610');
+INSERT INTO t VALUES (3611, 1, 55.09, 'name3611');
+INSERT INTO t VALUES (3612, 2, 34.28, 'name3612');
+INSERT INTO t VALUES (3613, 3, 13.47, 'name3613');
+INSERT INTO t VALUES (3614, 4, 92.66, 'name3614');
+INSERT INTO t VALUES (3615, 5, 71.85, 'name3615');
+INSERT INTO t VALUES (3616, 6, 51.04, 'name3616');
+INSERT INTO t VALUES (3617, 7, 30.23, 'name3617');
+INSERT INTO t VALUES (3618, 8, 9.42, 'name3618');
+INSERT INTO t VALUES (3619, 9, 88.61, 'name3619');
+INSERT INTO t VALUES (3620, 0, 67.80, 'name3620');
+INSERT INTO t VALUES (3621, 1, 46.99, 'name3621');
+INSERT INTO t VALUES (3622, 2, 26.18, 'name3622');
+INSERT INTO t VALUES (3623, 3, 5.37, 'name3623');
+INSERT INTO t VALUES (3624, 4, 84.56, 'name3624');
+INSERT INTO t VALUES (3625, 5, 63.75, 'name3625');
+INSERT INTO t VALUES (3626, 6, 42.94, 'name3626');
+INSERT INTO t VALUES (3627, 7, 22.13, 'name3627');
+INSERT INTO t VALUES (3628, 8, 1.32, 'name3628');
+INSERT INTO t VALUES (3629, 9, 80.51, 'name3629');
+INSERT INTO t VALUES (3630, 0, 59.70, 'name3630');
+INSERT INTO t VALUES (3631, 1, 38.89, 'name3631');
+INSERT INTO t VALUES (3632, 2, 18.08, 'name3632');
+INSERT INTO t VALUES (3633, 3, 97.27, 'name3633');
+INSERT INTO t VALUES (3634, 4, 76.46, 'name3634');
+INSERT INTO t VALUES (3635, 5, 55.65, 'name3635');
+INSERT INTO t VALUES (3636, 6, 34.84, 'name3636');
+INSERT INTO t VALUES (3637, 7, 14.03, 'name3637');
+INSERT INTO t VALUES (3638, 8, 93.22, 'name3638');
+INSERT INTO t VALUES (3639, 9, 72.41, 'name3639');
+INSERT INTO t VALUES (3640, 0, 51.60, 'name3640');
+INSERT INTO t VALUES (3641, 1, 30.79, 'name3641');
+INSERT INTO t VALUES (3642, 2, 9.98, 'name3642');
+INSERT INTO t VALUES (3643, 3, 89.17, 'name3643');
+INSERT INTO t VALUES (3644, 4, 68.36, 'name3644');
+INSERT INTO t VALUES (3645, 5, 47.55, 'name3645');
+INSERT INTO t VALUES (3646, 6, 26.74, 'name3646');
+INSERT INTO t VALUES (3647, 7, 5.93, 'name3647');
+INSERT INTO t VALUES (3648, 8, 85.12, 'name3648');
+INSERT INTO t VALUES (3649, 9, 64.31, 'name3649');
+INSERT INTO t VALUES (3650, 0, 43.50, 'name3650');
+INSERT INTO t VALUES (3651, 1, 22.69, 'name3651');
+INSERT INTO t VALUES (3652, 2, 1.88, 'name3652');
+INSERT INTO t VALUES (3653, 3, 81.07, 'name3653');
+INSERT INTO t VALUES (3654, 4, 60.26, 'name3654');
+INSERT INTO t VALUES (3655, 5, 39.45, 'name3655');
+INSERT INTO t VALUES (3656, 6, 18.64, 'name3656');
+INSERT INTO t VALUES (3657, 7, 97.83, 'name3657');
+INSERT INTO t VALUES (3658, 8, 77.02, 'name3658');
+INSERT INTO t VALUES (3659, 9, 56.21, 'name3659');
+INSERT INTO t VALUES (3660, 0, 35.40, 'name3660');
+INSERT INTO t VALUES (3661, 1, 14.59, 'name3661');
+INSERT INTO t VALUES (3662, 2, 93.78, 'name3662');
+INSERT INTO t VALUES (3663, 3, 72.97, 'name3663');
+INSERT INTO t VALUES (3664, 4, 52.16, 'name3664');
+INSERT INTO t VALUES (3665, 5, 31.35, 'name3665');
+INSERT INTO t VALUES (3666, 6, 10.54, 'name3666');
+INSERT INTO t VALUES (3667, 7, 89.73, 'name3667');
+INSERT INTO t VALUES (3668, 8, 68.92, 'name3668');
+INSERT INTO t VALUES (3669, 9, 48.11, 'name3669');
+INSERT INTO t VALUES (3670, 0, 27.30, 'name3670');
+INSERT INTO t VALUES (3671, 1, 6.49, 'name3671');
+INSERT INTO t VALUES (3672, 2, 85.68, 'name3672');
+INSERT INTO t VALUES (3673, 3, 64.87, 'name3673');
+INSERT INTO t VALUES (3674, 4, 44.06, 'name3674');
+INSERT INTO t VALUES (3675, 5, 23.25, 'name3675');
+INSERT INTO t VALUES (3676, 6, 2.44, 'name3676');
+INSERT INTO t VALUES (3677, 7, 81.63, 'name3677');
+INSERT INTO t VALUES (3678, 8, 60.82, 'name3678');
+INSERT INTO t VALUES (3679, 9, 40.01, 'name3679');
+INSERT INTO t VALUES (3680, 0, 19.20, 'name3680');
+INSERT INTO t VALUES (3681, 1, 98.39, 'name3681');
+INSERT INTO t VALUES (3682, 2, 77.58, 'name3682');
+INSERT INTO t VALUES (3683, 3, 56.77, 'name3683');
+INSERT INTO t VALUES (3684, 4, 35.96, 'name3684');
+INSERT INTO t VALUES (3685, 5, 15.15, 'name3685');
+INSERT INTO t VALUES (3686, 6, 94.34, 'name3686');
+INSERT INTO t VALUES (3687, 7, 73.53, 'name3687');
+INSERT INTO t VALUES (3688, 8, 52.72, 'name3688');
+INSERT INTO t VALUES (3689, 9, 31.91, 'name3689');
+INSERT INTO t VALUES (3690, 0, 11.10, 'name3690');
+INSERT INTO t VALUES (3691, 1, 90.29, 'name3691');
+INSERT INTO t VALUES (3692, 2, 69.48, 'name3692');
+INSERT INTO t VALUES (3693, 3, 48.67, 'name3693');
+INSERT INTO t VALUES (3694, 4, 27.86, 'name3694');
+INSERT INTO t VALUES (3695, 5, 7.05, 'name3695');
+INSERT INTO t VALUES (3696, 6, 86.24, 'name3696');
+INSERT INTO t VALUES (3697, 7, 65.43, 'name3697');
+INSERT INTO t VALUES (3698, 8, 44.62, 'name3698');
+INSERT INTO t VALUES (3699, 9, 23.81, 'name3699');
+INSERT INTO t VALUES (3700, 0, 3.00, 'name3700');
+INSERT INTO t VALUES (3701, 1, 82.19, 'name3701');
+INSERT INTO t VALUES (3702, 2, 61.38, 'name3702');
+INSERT INTO t VALUES (3703, 3, 40.57, 'name3703');
+INSERT INTO t VALUES (3704, 4, 19.76, 'name3704');
+INSERT INTO t VALUES (3705, 5, 98.95, 'name3705');
+INSERT INTO t VALUES (3706, 6, 78.14, 'name3706');
+INSERT INTO t VALUES (3707, 7, 57.33, 'name3707');
+INSERT INTO t VALUES (3708, 8, 36.52, 'name3708');
+INSERT INTO t VALUES (3709, 9, 15.71, 'name3709');
+INSERT INTO t VALUES (3710, 0, 94.90, 'name3710');
+INSERT INTO t VALUES (3711, 1, 74.09, 'name3711');
+INSERT INTO t VALUES (3712, 2, 53.28, 'name3712');
+INSERT INTO t VALUES (3713, 3, 32.47, 'name3713');
+INSERT INTO t VALUES (3714, 4, 11.66, 'name3714');
+INSERT INTO t VALUES (3715, 5, 90.85, 'name3715');
+INSERT INTO t VALUES (3716, 6, 70.04, 'name3716');
+INSERT INTO t VALUES (3717, 7, 49.23, 'name3717');
+INSERT INTO t VALUES (3718, 8, 28.42, 'name3718');
+INSERT INTO t VALUES (3719, 9, 7.61, 'name3719');
+INSERT INTO t VALUES (3720, 0, 86.80, 'name3720');
+INSERT INTO t VALUES (3721, 1, 65.99, 'name3721');
+INSERT INTO t VALUES (3722, 2, 45.18, 'name3722');
+INSERT INTO t VALUES (3723, 3, 24.37, 'name3723');
+INSERT INTO t VALUES (3724, 4, 3.56, 'name3724');
+INSERT INTO t VALUES (3725, 5, 82.75, 'name3725');
+INSERT INTO t VALUES (3726, 6, 61.94, 'name3726');
+INSERT INTO t VALUES (3727, 7, 41.13, 'name3727');
+INSERT INTO t VALUES (3728, 8, 20.32, 'name3728');
+INSERT INTO t VALUES (3729, 9, 99.51, 'name3729');
+INSERT INTO t VALUES (3730, 0, 78.70, 'name3730');
+INSERT INTO t VALUES (3731, 1, 57.89, 'name3731');
+INSERT INTO t VALUES (3732, 2, 37.08, 'name3732');
+INSERT INTO t VALUES (3733, 3, 16.27, 'name3733');
+INSERT INTO t VALUES (3734, 4, 95.46, 'name3734');
+INSERT INTO t VALUES (3735, 5, 74.65, 'name3735');
+INSERT INTO t VALUES (3736, 6, 53.84, 'name3736');
+INSERT INTO t VALUES (3737, 7, 33.03, 'name3737');
+INSERT INTO t VALUES (3738, 8, 12.22, 'name3738');
+INSERT INTO t VALUES (3739, 9, 91.41, 'name3739');
+INSERT INTO t VALUES (3740, 0, 70.60, 'name3740');
+INSERT INTO t VALUES (3741, 1, 49.79, 'name3741');
+INSERT INTO t VALUES (3742, 2, 28.98, 'name3742');
+INSERT INTO t VALUES (3743, 3, 8.17, 'name3743');
+INSERT INTO t VALUES (3744, 4, 87.36, 'name3744');
+INSERT INTO t VALUES (3745, 5, 66.55, 'name3745');
+INSERT INTO t VALUES (3746, 6, 45.74, 'name3746');
+INSERT INTO t VALUES (3747, 7, 24.93, 'name3747');
+INSERT INTO t VALUES (3748, 8, 4.12, 'name3748');
+INSERT INTO t VALUES (3749, 9, 83.31, 'name3749');
+INSERT INTO t VALUES (3750, 0, 62.50, 'name3750');
+INSERT INTO t VALUES (3751, 1, 41.69, 'name3751');
+INSERT INTO t VALUES (3752, 2, 20.88, 'name3752');
+INSERT INTO t VALUES (3753, 3, 0.07, 'name3753');
+INSERT INTO t VALUES (3754, 4, 79.26, 'name3754');
+INSERT INTO t VALUES (3755, 5, 58.45, 'name3755');
+INSERT INTO t VALUES (3756, 6, 37.64, 'name3756');
+INSERT INTO t VALUES (3757, 7, 16.83, 'name3757');
+INSERT INTO t VALUES (3758, 8, 96.02, 'name3758');
+INSERT INTO t VALUES (3759, 9, 75.21, 'name3759');
+INSERT INTO t VALUES (3760, 0, 54.40, 'name3760');
+INSERT INTO t VALUES (3761, 1, 33.59, 'name3761');
+INSERT INTO t VALUES (3762, 2, 12.78, 'name3762');
+INSERT INTO t VALUES (3763, 3, 91.97, 'name3763');
+INSERT INTO t VALUES (3764, 4, 71.16, 'name3764');
+INSERT INTO t VALUES (3765, 5, 50.35, 'name3765');
+INSERT INTO t VALUES (3766, 6, 29.54, 'name3766');
+INSERT INTO t VALUES (3767, 7, 8.73, 'name3767');
+INSERT INTO t VALUES (3768, 8, 87.92, 'name3768');
+INSERT INTO t VALUES (3769, 9, 67.11, 'name3769');
+INSERT INTO t VALUES (3770, 0, 46.30, 'name3770');
+INSERT INTO t VALUES (3771, 1, 25.49, 'name3771');
+INSERT INTO t VALUES (3772, 2, 4.68, 'name3772');
+INSERT INTO t VALUES (3773, 3, 83.87, 'name3773');
+INSERT INTO t VALUES (3774, 4, 63.06, 'name3774');
+INSERT INTO t VALUES (3775, 5, 42.25, 'name3775');
+INSERT INTO t VALUES (3776, 6, 21.44, 'name3776');
+INSERT INTO t VALUES (3777, 7, 0.63, 'name3777');
+INSERT INTO t VALUES (3778, 8, 79.82, 'name3778');
+INSERT INTO t VALUES (3779, 9, 59.01, 'name3779');
+INSERT INTO t VALUES (3780, 0, 38.20, 'name3780');
+INSERT INTO t VALUES (3781, 1, 17.39, 'name3781');
+INSERT INTO t VALUES (3782, 2, 96.58, 'name3782');
+INSERT INTO t VALUES (3783, 3, 75.77, 'name3783');
+INSERT INTO t VALUES (3784, 4, 54.96, 'name3784');
+INSERT INTO t VALUES (3785, 5, 34.15, 'name3785');
+INSERT INTO t VALUES (3786, 6, 13.34, 'name3786');
+INSERT INTO t VALUES (3787, 7, 92.53, 'name3787');
+INSERT INTO t VALUES (3788, 8, 71.72, 'name3788');
+INSERT INTO t VALUES (3789, 9, 50.91, 'name3789');
+INSERT INTO t VALUES (3790, 0, 30.10, 'name3790');
+INSERT INTO t VALUES (3791, 1, 9.29, 'name3791');
+INSERT INTO t VALUES (3792, 2, 88.48, 'name3792');
+INSERT INTO t VALUES (3793, 3, 67.67, 'name3793');
+INSERT INTO t VALUES (3794, 4, 46.86, 'name3794');
+INSERT INTO t VALUES (3795, 5, 26.05, 'name3795');
+INSERT INTO t VALUES (3796, 6, 5.24, 'name3796');
+INSERT INTO t VALUES (3797, 7, 84.43, 'name3797');
+INSERT INTO t VALUES (3798, 8, 63.62, 'name3798');
+INSERT INTO t VALUES (3799, 9, 42.81, 'name3799');
+INSERT INTO t VALUES (3800, 0, 22.00, 'name3800');
+INSERT INTO t VALUES (3801, 1, 1.19, 'name3801');
+INSERT INTO t VALUES (3802, 2, 80.38, 'name3802');
+INSERT INTO t VALUES (3803, 3, 59.57, 'name3803');
+INSERT INTO t VALUES (3804, 4, 38.76, 'name3804');
+INSERT INTO t VALUES (3805, 5, 17.95, 'name3805');
+INSERT INTO t VALUES (3806, 6, 97.14, 'name3806');
+INSERT INTO t VALUES (3807, 7, 76.33, 'name3807');
+INSERT INTO t VALUES (3808, 8, 55.52, 'name3808');
+INSERT INTO t VALUES (3809, 9, 34.71, 'name3809');
+INSERT INTO t VALUES (3810, 0, 13.90, 'name3810');
+INSERT INTO t VALUES (3811, 1, 93.09, 'name3811');
+INSERT INTO t VALUES (3812, 2, 72.28, 'name3812');
+INSERT INTO t VALUES (3813, 3, 51.47, 'name3813');
+INSERT INTO t VALUES (3814, 4, 30.66, 'name3814');
+INSERT INTO t VALUES (3815, 5, 9.85, 'name3815');
+INSERT INTO t VALUES (3816, 6, 89.04, 'name3816');
+INSERT INTO t VALUES (3817, 7, 68.23, 'name3817');
+INSERT INTO t VALUES (3818, 8, 47.42, 'name3818');
+INSERT INTO t VALUES (3819, 9, 26.61, 'name3819');
+INSERT INTO t VALUES (3820, 0, 5.80, 'name3820');
+INSERT INTO t VALUES (3821, 1, 84.99, 'name3821');
+INSERT INTO t VALUES (3822, 2, 64.18, 'name3822');
+INSERT INTO t VALUES (3823, 3, 43.37, 'name3823');
+INSERT INTO t VALUES (3824, 4, 22.56, 'name3824');
+INSERT INTO t VALUES (3825, 5, 1.75, 'name3825');
+INSERT INTO t VALUES (3826, 6, 80.94, 'name3826');
+INSERT INTO t VALUES (3827, 7, 60.13, 'name3827');
+INSERT INTO t VALUES (3828, 8, 39.32, 'name3828');
+INSERT INTO t VALUES (3829, 9, 18.51, 'name3829');
+INSERT INTO t VALUES (3830, 0, 97.70, 'name3830');
+INSERT INTO t VALUES (3831, 1, 76.89, 'name3831');
+INSERT INTO t VALUES (3832, 2, 56.08, 'name3832');
+INSERT INTO t VALUES (3833, 3, 35.27, 'name3833');
+INSERT INTO t VALUES (3834, 4, 14.46, 'name3834');
+INSERT INTO t VALUES (3835, 5, 93.65, 'name3835');
+INSERT INTO t VALUES (3836, 6, 72.84, 'name3836');
+INSERT INTO t VALUES (3837, 7, 52.03, 'name3837');
+INSERT INTO t VALUES (3838, 8, 31.22, 'name3838');
+INSERT INTO t VALUES (3839, 9, 10.41, 'name3839');
+INSERT INTO t VALUES (3840, 0, 89.60, 'name3840');
+INSERT INTO t VALUES (3841, 1, 68.79, 'name3841');
+INSERT INTO t VALUES (3842, 2, 47.98, 'name3842');
+INSERT INTO t VALUES (3843, 3, 27.17, 'name3843');
+INSERT INTO t VALUES (3844, 4, 6.36, 'name3844');
+INSERT INTO t VALUES (3845, 5, 85.55, 'name3845');
+INSERT INTO t VALUES (3846, 6, 64.74, 'name3846');
+INSERT INTO t VALUES (3847, 7, 43.93, 'name3847');
+INSERT INTO t VALUES (3848, 8, 23.12, 'name3848');
+INSERT INTO t VALUES (3849, 9, 2.31, 'name3849');
+INSERT INTO t VALUES (3850, 0, 81.50, 'name3850');
+INSERT INTO t VALUES (3851, 1, 60.69, 'name3851');
+INSERT INTO t VALUES (3852, 2, 39.88, 'name3852');
+INSERT INTO t VALUES (3853, 3, 19.07, 'name3853');
+INSERT INTO t VALUES (3854, 4, 98.26, 'name3854');
+INSERT INTO t VALUES (3855, 5, 77.45, 'name3855');
+INSERT INTO t VALUES (3856, 6, 56.64, 'name3856');
+INSERT INTO t VALUES (3857, 7, 35.83, 'name3857');
+INSERT INTO t VALUES (3858, 8, 15.02, 'name3858');
+INSERT INTO t VALUES (3859, 9, 94.21, 'name3859');
+INSERT INTO t VALUES (3860, 0, 73.40, 'name3860');
+INSERT INTO t VALUES (3861, 1, 52.59, 'name3861');
+INSERT INTO t VALUES (3862, 2, 31.78, 'name3862');
+INSERT INTO t VALUES (3863, 3, 10.97, 'name3863');
+INSERT INTO t VALUES (3864, 4, 90.16, 'name3864');
+INSERT INTO t VALUES (3865, 5, 69.35, 'name3865');
+INSERT INTO t VALUES (3866, 6, 48.54, 'name3866');
+INSERT INTO t VALUES (3867, 7, 27.73, 'name3867');
+INSERT INTO t VALUES (3868, 8, 6.92, 'name3868');
+INSERT INTO t VALUES (3869, 9, 86.11, 'name3869');
+INSERT INTO t VALUES (3870, 0, 65.30, 'name3870');
+INSERT INTO t VALUES (3871, 1, 44.49, 'name3871');
+INSERT INTO t VALUES (3872, 2, 23.68, 'name3872');
+INSERT INTO t VALUES (3873, 3, 2.87, 'name3873');
+INSERT INTO t VALUES (3874, 4, 82.06, 'name3874');
+INSERT INTO t VALUES (3875, 5, 61.25, 'name3875');
+INSERT INTO t VALUES (3876, 6, 40.44, 'name3876');
+INSERT INTO t VALUES (3877, 7, 19.63, 'name3877');
+INSERT INTO t VALUES (3878, 8, 98.82, 'name3878');
+INSERT INTO t VALUES (3879, 9, 78.01, 'name3879');
+INSERT INTO t VALUES (3880, 0, 57.20, 'name3880');
+INSERT INTO t VALUES (3881, 1, 36.39, 'name3881');
+INSERT INTO t VALUES (3882, 2, 15.58, 'name3882');
+INSERT INTO t VALUES (3883, 3, 94.77, 'name3883');
+INSERT INTO t VALUES (3884, 4, 73.96, 'name3884');
+INSERT INTO t VALUES (3885, 5, 53.15, 'name3885');
+INSERT INTO t VALUES (3886, 6, 32.34, 'name3886');
+INSERT INTO t VALUES (3887, 7, 11.53, 'name3887');
+INSERT INTO t VALUES (3888, 8, 90.72, 'name3888');
+INSERT INTO t VALUES (3889, 9, 69.91, 'name3889');
+INSERT INTO t VALUES (3890, 0, 49.10, 'name3890');
+INSERT INTO t VALUES (3891, 1, 28.29, 'name3891');
+INSERT INTO t VALUES (3892, 2, 7.48, 'name3892');
+INSERT INTO t VALUES (3893, 3, 86.67, 'name3893');
+INSERT INTO t VALUES (3894, 4, 65.86, 'name3894');
+INSERT INTO t VALUES (3895, 5, 45.05, 'name3895');
+INSERT INTO t VALUES (3896, 6, 24.24, 'name3896');
+INSERT INTO t VALUES (3897, 7, 3.43, 'name3897');
+INSERT INTO t VALUES (3898, 8, 82.62, 'name3898');
+INSERT INTO t VALUES (3899, 9, 61.81, 'name3899');
+INSERT INTO t VALUES (3900, 0, 41.00, 'name3900');
+INSERT INTO t VALUES (3901, 1, 20.19, 'name3901');
+INSERT INTO t VALUES (3902, 2, 99.38, 'name3902');
+INSERT INTO t VALUES (3903, 3, 78.57, 'name3903');
+INSERT INTO t VALUES (3904, 4, 57.76, 'name3904');
+INSERT INTO t VALUES (3905, 5, 36.95, 'name3905');
+INSERT INTO t VALUES (3906, 6, 16.14, 'name3906');
+INSERT INTO t VALUES (3907, 7, 95.33, 'name3907');
+INSERT INTO t VALUES (3908, 8, 74.52, 'name3908');
+INSERT INTO t VALUES (3909, 9, 53.71, 'name3909');
+INSERT INTO t VALUES (3910, 0, 32.90, 'name3910');
+INSERT INTO t VALUES (3911, 1, 12.09, 'name3911');
+INSERT INTO t VALUES (3912, 2, 91.28, 'name3912');
+INSERT INTO t VALUES (3913, 3, 70.47, 'name3913');
+INSERT INTO t VALUES (3914, 4, 49.66, 'name3914');
+INSERT INTO t VALUES (3915, 5, 28.85, 'name3915');
+INSERT INTO t VALUES (3916, 6, 8.04, 'name3916');
+INSERT INTO t VALUES (3917, 7, 87.23, 'name3917');
+INSERT INTO t VALUES (3918, 8, 66.42, 'name3918');
+INSERT INTO t VALUES (3919, 9, 45.61, 'name3919');
+INSERT INTO t VALUES (3920, 0, 24.80, 'name3920');
+INSERT INTO t VALUES (3921, 1, 3.99, 'name3921');
+INSERT INTO t VALUES (3922, 2, 83.18, 'name3922');
+INSERT INTO t VALUES (3923, 3, 62.37, 'name3923');
+INSERT INTO t VALUES (3924, 4, 41.56, 'name3924');
+INSERT INTO t VALUES (3925, 5, 20.75, 'name3925');
+INSERT INTO t VALUES (3926, 6, 99.94, 'name3926');
+INSERT INTO t VALUES (3927, 7, 79.13, 'name3927');
+INSERT INTO t VALUES (3928, 8, 58.32, 'name3928');
+INSERT INTO t VALUES (3929, 9, 37.51, 'name3929');
+INSERT INTO t VALUES (3930, 0, 16.70, 'name3930');
+INSERT INTO t VALUES (3931, 1, 95.89, 'name3931');
+INSERT INTO t VALUES (3932, 2, 75.08, 'name3932');
+INSERT INTO t VALUES (3933, 3, 54.27, 'name3933');
+INSERT INTO t VALUES (3934, 4, 33.46, 'name3934');
+INSERT INTO t VALUES (3935, 5, 12.65, 'name3935');
+INSERT INTO t VALUES (3936, 6, 91.84, 'name3936');
+INSERT INTO t VALUES (3937, 7, 71.03, 'name3937');
+INSERT INTO t VALUES (3938, 8, 50.22, 'name3938');
+INSERT INTO t VALUES (3939, 9, 29.41, 'name3939');
+INSERT INTO t VALUES (3940, 0, 8.60, 'name3940');
+INSERT INTO t VALUES (3941, 1, 87.79, 'name3941');
+INSERT INTO t VALUES (3942, 2, 66.98, 'name3942');
+INSERT INTO t VALUES (3943, 3, 46.17, 'name3943');
+INSERT INTO t VALUES (3944, 4, 25.36, 'name3944');
+INSERT INTO t VALUES (3945, 5, 4.55, 'name3945');
+INSERT INTO t VALUES (3946, 6, 83.74, 'name3946');
+INSERT INTO t VALUES (3947, 7, 62.93, 'name3947');
+INSERT INTO t VALUES (3948, 8, 42.12, 'name3948');
+INSERT INTO t VALUES (3949, 9, 21.31, 'name3949');
+INSERT INTO t VALUES (3950, 0, 0.50, 'name3950');
+INSERT INTO t VALUES (3951, 1, 79.69, 'name3951');
+INSERT INTO t VALUES (3952, 2, 58.88, 'name3952');
+INSERT INTO t VALUES (3953, 3, 38.07, 'name3953');
+INSERT INTO t VALUES (3954, 4, 17.26, 'name3954');
+INSERT INTO t VALUES (3955, 5, 96.45, 'name3955');
+INSERT INTO t VALUES (3956, 6, 75.64, 'name3956');
+INSERT INTO t VALUES (3957, 7, 54.83, 'name3957');
+INSERT INTO t VALUES (3958, 8, 34.02, 'name3958');
+INSERT INTO t VALUES (3959, 9, 13.21, 'name3959');
+INSERT INTO t VALUES (3960, 0, 92.40, 'name3960');
+INSERT INTO t VALUES (3961, 1, 71.59, 'name3961');
+INSERT INTO t VALUES (3962, 2, 50.78, 'name3962');
+INSERT INTO t VALUES (3963, 3, 29.97, 'name3963');
+INSERT INTO t VALUES (3964, 4, 9.16, 'name3964');
+INSERT INTO t VALUES (3965, 5, 88.35, 'name3965');
+INSERT INTO t VALUES (3966, 6, 67.54, 'name3966');
+INSERT INTO t VALUES (3967, 7, 46.73, 'name3967');
+INSERT INTO t VALUES (3968, 8, 25.92, 'name3968');
+INSERT INTO t VALUES (3969, 9, 5.11, 'name3969');
+INSERT INTO t VALUES (3970, 0, 84.30, 'name3970');
+INSERT INTO t VALUES (3971, 1, 63.49, 'name3971');
+INSERT INTO t VALUES (3972, 2, 42.68, 'name3972');
+INSERT INTO t VALUES (3973, 3, 21.87, 'name3973');
+INSERT INTO t VALUES (3974, 4, 1.06, 'name3974');
+INSERT INTO t VALUES (3975, 5, 80.25, 'name3975');
+INSERT INTO t VALUES (3976, 6, 59.44, 'name3976');
+INSERT INTO t VALUES (3977, 7, 38.63, 'name3977');
+INSERT INTO t VALUES (3978, 8, 17.82, 'name3978');
+INSERT INTO t VALUES (3979, 9, 97.01, 'name3979');
+INSERT INTO t VALUES (3980, 0, 76.20, 'name3980');
+INSERT INTO t VALUES (3981, 1, 55.39, 'name3981');
+INSERT INTO t VALUES (3982, 2, 34.58, 'name3982');
+INSERT INTO t VALUES (3983, 3, 13.77, 'name3983');
+INSERT INTO t VALUES (3984, 4, 92.96, 'name3984');
+INSERT INTO t VALUES (3985, 5, 72.15, 'name3985');
+INSERT INTO t VALUES (3986, 6, 51.34, 'name3986');
+INSERT INTO t VALUES (3987, 7, 30.53, 'name3987');
+INSERT INTO t VALUES (3988, 8, 9.72, 'name3988');
+INSERT INTO t VALUES (3989, 9, 88.91, 'name3989');
+INSERT INTO t VALUES (3990, 0, 68.10, 'name3990');
+INSERT INTO t VALUES (3991, 1, 47.29, 'name3991');
+INSERT INTO t VALUES (3992, 2, 26.48, 'name3992');
+INSERT INTO t VALUES (3993, 3, 5.67, 'name3993');
+INSERT INTO t VALUES (3994, 4, 84.86, 'name3994');
+INSERT INTO t VALUES (3995, 5, 64.05, 'name3995');
+INSERT INTO t VALUES (3996, 6, 43.24, 'name3996');
+INSERT INTO t VALUES (3997, 7, 22.43, 'name3997');
+INSERT INTO t VALUES (3998, 8, 1.62, 'name3998');
+INSERT INTO t VALUES (3999, 9, 80.81, 'name3999');
+INSERT INTO t VALUES (4000, 0, 60.00, 'name4000');
+INSERT INTO t VALUES (4001, 1, 39.19, 'name4001');
+INSERT INTO t VALUES (4002, 2, 18.38, 'name4002');
+INSERT INTO t VALUES (4003, 3, 97.57, 'name4003');
+INSERT INTO t VALUES (4004, 4, 76.76, 'name4004');
+INSERT INTO t VALUES (4005, 5, 55.95, 'name4005');
+INSERT INTO t VALUES (4006, 6, 35.14, 'name4006');
+INSERT INTO t VALUES (4007, 7, 14.33, 'name4007');
+INSERT INTO t VALUES (4008, 8, 93.52, 'name4008');
+INSERT INTO t VALUES (4009, 9, 72.71, 'name4009');
+INSERT INTO t VALUES (4010, 0, 51.90, 'name4010');
+INSERT INTO t VALUES (4011, 1, 31.09, 'name4011');
+INSERT INTO t VALUES (4012, 2, 10.28, 'name4012');
+INSERT INTO t VALUES (4013, 3, 89.47, 'name4013');
+INSERT INTO t VALUES (4014, 4, 68.66, 'name4014');
+INSERT INTO t VALUES (4015, 5, 47.85, 'name4015');
+INSERT INTO t VALUES (4016, 6, 27.04, 'name4016');
+INSERT INTO t VALUES (4017, 7, 6.23, 'name4017');
+INSERT INTO t VALUES (4018, 8, 85.42, 'name4018');
+INSERT INTO t VALUES (4019, 9, 64.61, 'name4019');
+INSERT INTO t VALUES (4020, 0, 43.80, 'name4020');
+INSERT INTO t VALUES (4021, 1, 22.99, 'name4021');
+INSERT INTO t VALUES (4022, 2, 2.18, 'name4022');
+INSERT INTO t VALUES (4023, 3, 81.37, 'name4023');
+INSERT INTO t VALUES (4024, 4, 60.56, 'name4024');
+INSERT INTO t VALUES (4025, 5, 39.75, 'name4025');
+INSERT INTO t VALUES (4026, 6, 18.94, 'name4026');
+INSERT INTO t VALUES (4027, 7, 98.13, 'name4027');
+INSERT INTO t VALUES (4028, 8, 77.32, 'name4028');
+INSERT INTO t VALUES (4029, 9, 56.51, 'name4029');
+INSERT INTO t VALUES (4030, 0, 35.70, 'name4030');
+INSERT INTO t VALUES (4031, 1, 14.89, 'name4031');
+INSERT INTO t VALUES (4032, 2, 94.08, 'name4032');
+INSERT INTO t VALUES (4033, 3, 73.27, 'name4033');
+INSERT INTO t VALUES (4034, 4, 52.46, 'name4034');
+INSERT INTO t VALUES (4035, 5, 31.65, 'name4035');
+INSERT INTO t VALUES (4036, 6, 10.84, 'name4036');
+INSERT INTO t VALUES (4037, 7, 90.03, 'name4037');
+INSERT INTO t VALUES (4038, 8, 69.22, 'name4038');
+INSERT INTO t VALUES (4039, 9, 48.41, 'name4039');
+INSERT INTO t VALUES (4040, 0, 27.60, 'name4040');
+INSERT INTO t VALUES (4041, 1, 6.79, 'name4041');
+INSERT INTO t VALUES (4042, 2, 85.98, 'name4042');
+INSERT INTO t VALUES (4043, 3, 65.17, 'name4043');
+INSERT INTO t VALUES (4044, 4, 44.36, 'name4044');
+INSERT INTO t VALUES (4045, 5, 23.55, 'name4045');
+INSERT INTO t VALUES (4046, 6, 2.74, 'name4046');
+INSERT INTO t VALUES (4047, 7, 81.93, 'name4047');
+INSERT INTO t VALUES (4048, 8, 61.12, 'name4048');
+INSERT INTO t VALUES (4049, 9, 40.31, 'name4049');
+INSERT INTO t VALUES (4050, 0, 19.50, 'name4050');
+INSERT INTO t VALUES (4051, 1, 98.69, 'name4051');
+INSERT INTO t VALUES (4052, 2, 77.88, 'name4052');
+INSERT INTO t VALUES (4053, 3, 57.07, 'name4053');
+INSERT INTO t VALUES (4054, 4, 36.26, 'name4054');
+INSERT INTO t VALUES (4055, 5, 15.45, 'name4055');
+INSERT INTO t VALUES (4056, 6, 94.64, 'name4056');
+INSERT INTO t VALUES (4057, 7, 73.83, 'name4057');
+INSERT INTO t VALUES (4058, 8, 53.02, 'name4058');
+INSERT INTO t VALUES (4059, 9, 32.21, 'name4059');
+INSERT INTO t VALUES (4060, 0, 11.40, 'name4060');
+INSERT INTO t VALUES (4061, 1, 90.59, 'name4061');
+INSERT INTO t VALUES (4062, 2, 69.78, 'name4062');
+INSERT INTO t VALUES (4063, 3, 48.97, 'name4063');
+INSERT INTO t VALUES (4064, 4, 28.16, 'name4064');
+INSERT INTO t VALUES (4065, 5, 7.35, 'name4065');
+INSERT INTO t VALUES (4066, 6, 86.54, 'name4066');
+INSERT INTO t VALUES (4067, 7, 65.73, 'name4067');
+INSERT INTO t VALUES (4068, 8, 44.92, 'name4068');
+INSERT INTO t VALUES (4069, 9, 24.11, 'name4069');
+INSERT INTO t VALUES (4070, 0, 3.30, 'name4070');
+INSERT INTO t VALUES (4071, 1, 82.49, 'name4071');
+INSERT INTO t VALUES (4072, 2, 61.68, 'name4072');
+INSERT INTO t VALUES (4073, 3, 40.87, 'name4073');
+INSERT INTO t VALUES (4074, 4, 20.06, 'name4074');
+INSERT INTO t VALUES (4075, 5, 99.25, 'name4075');
+INSERT INTO t VALUES (4076, 6, 78.44, 'name4076');
+INSERT INTO t VALUES (4077, 7, 57.63, 'name4077');
+INSERT INTO t VALUES (4078, 8, 36.82, 'name4078');
+INSERT INTO t VALUES (4079, 9, 16.01, 'name4079');
+INSERT INTO t VALUES (4080, 0, 95.20, 'name4080');
+INSERT INTO t VALUES (4081, 1, 74.39, 'name4081');
+INSERT INTO t VALUES (4082, 2, 53.58, 'name4082');
+INSERT INTO t VALUES (4083, 3, 32.77, 'name4083');
+INSERT INTO t VALUES (4084, 4, 11.96, 'name4084');
+INSERT INTO t VALUES (4085, 5, 91.15, 'name4085');
+INSERT INTO t VALUES (4086, 6, 70.34, 'name4086');
+INSERT INTO t VALUES (4087, 7, 49.53, 'name4087');
+INSERT INTO t VALUES (4088, 8, 28.72, 'name4088');
+INSERT INTO t VALUES (4089, 9, 7.91, 'name4089');
+INSERT INTO t VALUES (4090, 0, 87.10, 'name4090');
+INSERT INTO t VALUES (4091, 1, 66.29, 'name4091');
+INSERT INTO t VALUES (4092, 2, 45.48, 'name4092');
+INSERT INTO t VALUES (4093, 3, 24.67, 'name4093');
+INSERT INTO t VALUES (4094, 4, 3.86, 'name4094');
+INSERT INTO t VALUES (4095, 5, 83.05, 'name4095');
+INSERT INTO t VALUES (4096, 6, 62.24, 'name4096');
+INSERT INTO t VALUES (4097, 7, 41.43, 'name4097');
+INSERT INTO t VALUES (4098, 8, 20.62, 'name4098');
+INSERT INTO t VALUES (4099, 9, 99.81, 'name4099');
+INSERT INTO t VALUES (4100, 0, 79.00, 'name4100');
+INSERT INTO t VALUES (4101, 1, 58.19, 'name4101');
+INSERT INTO t VALUES (4102, 2, 37.38, 'name4102');
+INSERT INTO t VALUES (4103, 3, 16.57, 'name4103');
+INSERT INTO t VALUES (4104, 4, 95.76, 'name4104');
+INSERT INTO t VALUES (4105, 5, 74.95, 'name4105');
+INSERT INTO t VALUES (4106, 6, 54.14, 'name4106');
+INSERT INTO t VALUES (4107, 7, 33.33, 'name4107');
+INSERT INTO t VALUES (4108, 8, 12.52, 'name4108');
+INSERT INTO t VALUES (4109, 9, 91.71, 'name4109');
+INSERT INTO t VALUES (4110, 0, 70.90, 'name4110');
+INSERT INTO t VALUES (4111, 1, 50.09, 'name4111');
+INSERT INTO t VALUES (4112, 2, 29.28, 'name4112');
+INSERT INTO t VALUES (4113, 3, 8.47, 'name4113');
+INSERT INTO t VALUES (4114, 4, 87.66, 'name4114');
+INSERT INTO t VALUES (4115, 5, 66.85, 'name4115');
+INSERT INTO t VALUES (4116, 6, 46.04, 'name4116');
+INSERT INTO t VALUES (4117, 7, 25.23, 'name4117');
+INSERT INTO t VALUES (4118, 8, 4.42, 'name4118');
+INSERT INTO t VALUES (4119, 9, 83.61, 'name4119');
+INSERT INTO t VALUES (4120, 0, 62.80, 'name4120');
+INSERT INTO t VALUES (4121, 1, 41.99, 'name4121');
+INSERT INTO t VALUES (4122, 2, 21.18, 'name4122');
+INSERT INTO t VALUES (4123, 3, 0.37, 'name4123');
+INSERT INTO t VALUES (4124, 4, 79.56, 'name4124');
+INSERT INTO t VALUES (4125, 5, 58.75, 'name4125');
+INSERT INTO t VALUES (4126, 6, 37.94, 'name4126');
+INSERT INTO t VALUES (4127, 7, 17.13, 'name4127');
+INSERT INTO t VALUES (4128, 8, 96.32, 'name4128');
+INSERT INTO t VALUES (4129, 9, 75.51, 'name4129');
+INSERT INTO t VALUES (4130, 0, 54.70, 'name4130');
+INSERT INTO t VALUES (4131, 1, 33.89, 'name4131');
+INSERT INTO t VALUES (4132, 2, 13.08, 'name4132');
+INSERT INTO t VALUES (4133, 3, 92.27, 'name4133');
+INSERT INTO t VALUES (4134, 4, 71.46, 'name4134');
+INSERT INTO t VALUES (4135, 5, 50.65, 'name4135');
+INSERT INTO t VALUES (4136, 6, 29.84, 'name4136');
+INSERT INTO t VALUES (4137, 7, 9.03, 'name4137');
+INSERT INTO t VALUES (4138, 8, 88.22, 'name4138');
+INSERT INTO t VALUES (4139, 9, 67.41, 'name4139');
+INSERT INTO t VALUES (4140, 0, 46.60, 'name4140');
+INSERT INTO t VALUES (4141, 1, 25.79, 'name4141');
+INSERT INTO t VALUES (4142, 2, 4.98, 'name4142');
+INSERT INTO t VALUES (4143, 3, 84.17, 'name4143');
+INSERT INTO t VALUES (4144, 4, 63.36, 'name4144');
+INSERT INTO t VALUES (4145, 5, 42.55, 'name4145');
+INSERT INTO t VALUES (4146, 6, 21.74, 'name4146');
+INSERT INTO t VALUES (4147, 7, 0.93, 'name4147');
+INSERT INTO t VALUES (4148, 8, 80.12, 'name4148');
+INSERT INTO t VALUES (4149, 9, 59.31, 'name4149');
+INSERT INTO t VALUES (4150, 0, 38.50, 'name4150');
+INSERT INTO t VALUES (4151, 1, 17.69, 'name4151');
+INSERT INTO t VALUES (4152, 2, 96.88, 'name4152');
+INSERT INTO t VALUES (4153, 3, 76.07, 'name4153');
+INSERT INTO t VALUES (4154, 4, 55.26, 'name4154');
+INSERT INTO t VALUES (4155, 5, 34.45, 'name4155');
+INSERT INTO t VALUES (4156, 6, 13.64, 'name4156');
+INSERT INTO t VALUES (4157, 7, 92.83, 'name4157');
+INSERT INTO t VALUES (4158, 8, 72.02, 'name4158');
+INSERT INTO t VALUES (4159, 9, 51.21, 'name4159');
+INSERT INTO t VALUES (4160, 0, 30.40, 'name4160');
+INSERT INTO t VALUES (4161, 1, 9.59, 'name4161');
+INSERT INTO t VALUES (4162, 2, 88.78, 'name4162');
+INSERT INTO t VALUES (4163, 3, 67.97, 'name4163');
+INSERT INTO t VALUES (4164, 4, 47.16, 'name4164');
+INSERT INTO t VALUES (4165, 5, 26.35, 'name4165');
+INSERT INTO t VALUES (4166, 6, 5.54, 'name4166');
+INSERT INTO t VALUES (4167, 7, 84.73, 'name4167');
+INSERT INTO t VALUES (4168, 8, 63.92, 'name4168');
+INSERT INTO t VALUES (4169, 9, 43.11, 'name4169');
+INSERT INTO t VALUES (4170, 0, 22.30, 'name4170');
+INSERT INTO t VALUES (4171, 1, 1.49, 'name4171');
+INSERT INTO t VALUES (4172, 2, 80.68, 'name4172');
+INSERT INTO t VALUES (4173, 3, 59.87, 'name4173');
+INSERT INTO t VALUES (4174, 4, 39.06, 'name4174');
+INSERT INTO t VALUES (4175, 5, 18.25, 'name4175');
+INSERT INTO t VALUES (4176, 6, 97.44, 'name4176');
+INSERT INTO t VALUES (4177, 7, 76.63, 'name4177');
+INSERT INTO t VALUES (4178, 8, 55.82, 'name4178');
+INSERT INTO t VALUES (4179, 9, 35.01, 'name4179');
+INSERT INTO t VALUES (4180, 0, 14.20, 'name4180');
+INSERT INTO t VALUES (4181, 1, 93.39, 'name4181');
+INSERT INTO t VALUES (4182, 2, 72.58, 'name4182');
+INSERT INTO t VALUES (4183, 3, 51.77, 'name4183');
+INSERT INTO t VALUES (4184, 4, 30.96, 'name4184');
+INSERT INTO t VALUES (4185, 5, 10.15, 'name4185');
+INSERT INTO t VALUES (4186, 6, 89.34, 'name4186');
+INSERT INTO t VALUES (4187, 7, 68.53, 'name4187');
+INSERT INTO t VALUES (4188, 8, 47.72, 'name4188');
+INSERT INTO t VALUES (4189, 9, 26.91, 'name4189');
+INSERT INTO t VALUES (4190, 0, 6.10, 'name4190');
+INSERT INTO t VALUES (4191, 1, 85.29, 'name4191');
+INSERT INTO t VALUES (4192, 2, 64.48, 'name4192');
+INSERT INTO t VALUES (4193, 3, 43.67, 'name4193');
+INSERT INTO t VALUES (4194, 4, 22.86, 'name4194');
+INSERT INTO t VALUES (4195, 5, 2.05, 'name4195');
+INSERT INTO t VALUES (4196, 6, 81.24, 'name4196');
+INSERT INTO t VALUES (4197, 7, 60.43, 'name4197');
+INSERT INTO t VALUES (4198, 8, 39.62, 'name4198');
+INSERT INTO t VALUES (4199, 9, 18.81, 'name4199');
+INSERT INTO t VALUES (4200, 0, 98.00, 'name4200');
+INSERT INTO t VALUES (4201, 1, 77.19, 'name4201');
+INSERT INTO t VALUES (4202, 2, 56.38, 'name4202');
+INSERT INTO t VALUES (4203, 3, 35.57, 'name4203');
+INSERT INTO t VALUES (4204, 4, 14.76, 'name4204');
+INSERT INTO t VALUES (4205, 5, 93.95, 'name4205');
+INSERT INTO t VALUES (4206, 6, 73.14, 'name4206');
+INSERT INTO t VALUES (4207, 7, 52.33, 'name4207');
+INSERT INTO t VALUES (4208, 8, 31.52, 'name4208');
+INSERT INTO t VALUES (4209, 9, 10.71, 'name4209');
+INSERT INTO t VALUES (4210, 0, 89.90, 'name4210');
+INSERT INTO t VALUES (4211, 1, 69.09, 'name4211');
+INSERT INTO t VALUES (4212, 2, 48.28, 'name4212');
+INSERT INTO t VALUES (4213, 3, 27.47, 'name4213');
+INSERT INTO t VALUES (4214, 4, 6.66, 'name4214');
+INSERT INTO t VALUES (4215, 5, 85.85, 'name4215');
+INSERT INTO t VALUES (4216, 6, 65.04, 'name4216');
+INSERT INTO t VALUES (4217, 7, 44.23, 'name4217');
+INSERT INTO t VALUES (4218, 8, 23.42, 'name4218');
+INSERT INTO t VALUES (4219, 9, 2.61, 'name4219');
+INSERT INTO t VALUES (4220, 0, 81.80, 'name4220');
+INSERT INTO t VALUES (4221, 1, 60.99, 'name4221');
+INSERT INTO t VALUES (4222, 2, 40.18, 'name4222');
+INSERT INTO t VALUES (4223, 3, 19.37, 'name4223');
+INSERT INTO t VALUES (4224, 4, 98.56, 'name4224');
+INSERT INTO t VALUES (4225, 5, 77.75, 'name4225');
+INSERT INTO t VALUES (4226, 6, 56.94, 'name4226');
+INSERT INTO t VALUES (4227, 7, 36.13, 'name4227');
+INSERT INTO t VALUES (4228, 8, 15.32, 'name4228');
+INSERT INTO t VALUES (4229, 9, 94.51, 'name4229');
+INSERT INTO t VALUES (4230, 0, 73.70, 'name4230');
+INSERT INTO t VALUES (4231, 1, 52.89, 'name4231');
+INSERT INTO t VALUES (4232, 2, 32.08, 'name4232');
+INSERT INTO t VALUES (4233, 3, 11.27, 'name4233');
+INSERT INTO t VALUES (4234, 4, 90.46, 'name4234');
+INSERT INTO t VALUES (4235, 5, 69.65, 'name4235');
+INSERT INTO t VALUES (4236, 6, 48.84, 'name4236');
+INSERT INTO t VALUES (4237, 7, 28.03, 'name4237');
+INSERT INTO t VALUES (4238, 8, 7.22, 'name4238');
+INSERT INTO t VALUES (4239, 9, 86.41, 'name4239');
+INSERT INTO t VALUES (4240, 0, 65.60, 'name4240');
+INSERT INTO t VALUES (4241, 1, 44.79, 'name4241');
+INSERT INTO t VALUES (4242, 2, 23.98, 'name4242');
+INSERT INTO t VALUES (4243, 3, 3.17, 'name4243');
+INSERT INTO t VALUES (4244, 4, 82.36, 'name4244');
+INSERT INTO t VALUES (4245, 5, 61.55, 'name4245');
+INSERT INTO t VALUES (4246, 6, 40.74, 'name4246');
+INSERT INTO t VALUES (4247, 7, 19.93, 'name4247');
+INSERT INTO t VALUES (4248, 8, 99.12, 'name4248');
+INSERT INTO t VALUES (4249, 9, 78.31, 'name4249');
+INSERT INTO t VALUES (4250, 0, 57.50, 'name4250');
+INSERT INTO t VALUES (4251, 1, 36.69, 'name4251');
+INSERT INTO t VALUES (4252, 2, 15.88, 'name4252');
+INSERT INTO t VALUES (4253, 3, 95.07, 'name4253');
+INSERT INTO t VALUES (4254, 4, 74.26, 'name4254');
+INSERT INTO t VALUES (4255, 5, 53.45, 'name4255');
+INSERT INTO t VALUES (4256, 6, 32.64, 'name4256');
+INSERT INTO t VALUES (4257, 7, 11.83, 'name4257');
+INSERT INTO t VALUES (4258, 8, 91.02, 'name4258');
+INSERT INTO t VALUES (4259, 9, 70.21, 'name4259');
+INSERT INTO t VALUES (4260, 0, 49.40, 'name4260');
+INSERT INTO t VALUES (4261, 1, 28.59, 'name4261');
+INSERT INTO t VALUES (4262, 2, 7.78, 'name4262');
+INSERT INTO t VALUES (4263, 3, 86.97, 'name4263');
+INSERT INTO t VALUES (4264, 4, 66.16, 'name4264');
+INSERT INTO t VALUES (4265, 5, 45.35, 'name4265');
+INSERT INTO t VALUES (4266, 6, 24.54, 'name4266');
+INSERT INTO t VALUES (4267, 7, 3.73, 'name4267');
+INSERT INTO t VALUES (4268, 8, 82.92, 'name4268');
+INSERT INTO t VALUES (4269, 9, 62.11, 'name4269');
+INSERT INTO t VALUES (4270, 0, 41.30, 'name4270');
+INSERT INTO t VALUES (4271, 1, 20.49, 'name4271');
+INSERT INTO t VALUES (4272, 2, 99.68, 'name4272');
+INSERT INTO t VALUES (4273, 3, 78.87, 'name4273');
+INSERT INTO t VALUES (4274, 4, 58.06, 'name4274');
+INSERT INTO t VALUES (4275, 5, 37.25, 'name4275');
+INSERT INTO t VALUES (4276, 6, 16.44, 'name4276');
+INSERT INTO t VALUES (4277, 7, 95.63, 'name4277');
+INSERT INTO t VALUES (4278, 8, 74.82, 'name4278');
+INSERT INTO t VALUES (4279, 9, 54.01, 'name4279');
+INSERT INTO t VALUES (4280, 0, 33.20, 'name4280');
+INSERT INTO t VALUES (4281, 1, 12.39, 'name4281');
+INSERT INTO t VALUES (4282, 2, 91.58, 'name4282');
+INSERT INTO t VALUES (4283, 3, 70.77, 'name4283');
+INSERT INTO t VALUES (4284, 4, 49.96, 'name4284');
+INSERT INTO t VALUES (4285, 5, 29.15, 'name4285');
+INSERT INTO t VALUES (4286, 6, 8.34, 'name4286');
+INSERT INTO t VALUES (4287, 7, 87.53, 'name4287');
+INSERT INTO t VALUES (4288, 8, 66.72, 'name4288');
+INSERT INTO t VALUES (4289, 9, 45.91, 'name4289');
+INSERT INTO t VALUES (4290, 0, 25.10, 'name4290');
+INSERT INTO t VALUES (4291, 1, 4.29, 'name4291');
+INSERT INTO t VALUES (4292, 2, 83.48, 'name4292');
+INSERT INTO t VALUES (4293, 3, 62.67, 'name4293');
+INSERT INTO t VALUES (4294, 4, 41.86, 'name4294');
+INSERT INTO t VALUES (4295, 5, 21.05, 'name4295');
+INSERT INTO t VALUES (4296, 6, 0.24, 'name4296');
+INSERT INTO t VALUES (4297, 7, 79.43, 'name4297');
+INSERT INTO t VALUES (4298, 8, 58.62, 'name4298');
+INSERT INTO t VALUES (4299, 9, 37.81, 'name4299');
+INSERT INTO t VALUES (4300, 0, 17.00, 'name4300');
+INSERT INTO t VALUES (4301, 1, 96.19, 'name4301');
+INSERT INTO t VALUES (4302, 2, 75.38, 'name4302');
+INSERT INTO t VALUES (4303, 3, 54.57, 'name4303');
+INSERT INTO t VALUES (4304, 4, 33.76, 'name4304');
+INSERT INTO t VALUES (4305, 5, 12.95, 'name4305');
+INSERT INTO t VALUES (4306, 6, 92.14, 'name4306');
+INSERT INTO t VALUES (4307, 7, 71.33, 'name4307');
+INSERT INTO t VALUES (4308, 8, 50.52, 'name4308');
+INSERT INTO t VALUES (4309, 9, 29.71, 'name4309');
+INSERT INTO t VALUES (4310, 0, 8.90, 'name4310');
+INSERT INTO t VALUES (4311, 1, 88.09, 'name4311');
+INSERT INTO t VALUES (4312, 2, 67.28, 'name4312');
+INSERT INTO t VALUES (4313, 3, 46.47, 'name4313');
+INSERT INTO t VALUES (4314, 4, 25.66, 'name4314');
+INSERT INTO t VALUES (4315, 5, 4.85, 'name4315');
+INSERT INTO t VALUES (4316, 6, 84.04, 'name4316');
+INSERT INTO t VALUES (4317, 7, 63.23, 'name4317');
+INSERT INTO t VALUES (4318, 8, 42.42, 'name4318');
+INSERT INTO t VALUES (4319, 9, 21.61, 'name4319');
+INSERT INTO t VALUES (4320, 0, 0.80, 'name4320');
+INSERT INTO t VALUES (4321, 1, 79.99, 'name4321');
+INSERT INTO t VALUES (4322, 2, 59.18, 'name4322');
+INSERT INTO t VALUES (4323, 3, 38.37, 'name4323');
+INSERT INTO t VALUES (4324, 4, 17.56, 'name4324');
+INSERT INTO t VALUES (4325, 5, 96.75, 'name4325');
+INSERT INTO t VALUES (4326, 6, 75.94, 'name4326');
+INSERT INTO t VALUES (4327, 7, 55.13, 'name4327');
+INSERT INTO t VALUES (4328, 8, 34.32, 'name4328');
+INSERT INTO t VALUES (4329, 9, 13.51, 'name4329');
+INSERT INTO t VALUES (4330, 0, 92.70, 'name4330');
+INSERT INTO t VALUES (4331, 1, 71.89, 'name4331');
+INSERT INTO t VALUES (4332, 2, 51.08, 'name4332');
+INSERT INTO t VALUES (4333, 3, 30.27, 'name4333');
+INSERT INTO t VALUES (4334, 4, 9.46, 'name4334');
+INSERT INTO t VALUES (4335, 5, 88.65, 'name4335');
+INSERT INTO t VALUES (4336, 6, 67.84, 'name4336');
+INSERT INTO t VALUES (4337, 7, 47.03, 'name4337');
+INSERT INTO t VALUES (4338, 8, 26.22, 'name4338');
+INSERT INTO t VALUES (4339, 9, 5.41, 'name4339');
+INSERT INTO t VALUES (4340, 0, 84.60, 'name4340');
+INSERT INTO t VALUES (4341, 1, 63.79, 'name4341');
+INSERT INTO t VALUES (4342, 2, 42.98, 'name4342');
+INSERT INTO t VALUES (4343, 3, 22.17, 'name4343');
+INSERT INTO t VALUES (4344, 4, 1.36, 'name4344');
+INSERT INTO t VALUES (4345, 5, 80.55, 'name4345');
+INSERT INTO t VALUES (4346, 6, 59.74, 'name4346');
+INSERT INTO t VALUES (4347, 7, 38.93, 'name4347');
+INSERT INTO t VALUES (4348, 8, 18.12, 'name4348');
+INSERT INTO t VALUES (4349, 9, 97.31, 'name4349');
+INSERT INTO t VALUES (4350, 0, 76.50, 'name4350');
+INSERT INTO t VALUES (4351, 1, 55.69, 'name4351');
+INSERT INTO t VALUES (4352, 2, 34.88, 'name4352');
+INSERT INTO t VALUES (4353, 3, 14.07, 'name4353');
+INSERT INTO t VALUES (4354, 4, 93.26, 'name4354');
+INSERT INTO t VALUES (4355, 5, 72.45, 'name4355');
+INSERT INTO t VALUES (4356, 6, 51.64, 'name4356');
+INSERT INTO t VALUES (4357, 7, 30.83, 'name4357');
+INSERT INTO t VALUES (4358, 8, 10.02, 'name4358');
+INSERT INTO t VALUES (4359, 9, 89.21, 'name4359');
+INSERT INTO t VALUES (4360, 0, 68.40, 'name4360');
+INSERT INTO t VALUES (4361, 1, 47.59, 'name4361');
+INSERT INTO t VALUES (4362, 2, 26.78, 'name4362');
+INSERT INTO t VALUES (4363, 3, 5.97, 'name4363');
+INSERT INTO t VALUES (4364, 4, 85.16, 'name4364');
+INSERT INTO t VALUES (4365, 5, 64.35, 'name4365');
+INSERT INTO t VALUES (4366, 6, 43.54, 'name4366');
+INSERT INTO t VALUES (4367, 7, 22.73, 'name4367');
+INSERT INTO t VALUES (4368, 8, 1.92, 'name4368');
+INSERT INTO t VALUES (4369, 9, 81.11, 'name4369');
+INSERT INTO t VALUES (4370, 0, 60.30, 'name4370');
+INSERT INTO t VALUES (4371, 1, 39.49, 'name4371');
+INSERT INTO t VALUES (4372, 2, 18.68, 'name4372');
+INSERT INTO t VALUES (4373, 3, 97.87, 'name4373');
+INSERT INTO t VALUES (4374, 4, 77.06, 'name4374');
+INSERT INTO t VALUES (4375, 5, 56.25, 'name4375');
+INSERT INTO t VALUES (4376, 6, 35.44, 'name4376');
+INSERT INTO t VALUES (4377, 7, 14.63, 'name4377');
+INSERT INTO t VALUES (4378, 8, 93.82, 'name4378');
+INSERT INTO t VALUES (4379, 9, 73.01, 'name4379');
+INSERT INTO t VALUES (4380, 0, 52.20, 'name4380');
+INSERT INTO t VALUES (4381, 1, 31.39, 'name4381');
+INSERT INTO t VALUES (4382, 2, 10.58, 'name4382');
+INSERT INTO t VALUES (4383, 3, 89.77, 'name4383');
+INSERT INTO t VALUES (4384, 4, 68.96, 'name4384');
+INSERT INTO t VALUES (4385, 5, 48.15, 'name4385');
+INSERT INTO t VALUES (4386, 6, 27.34, 'name4386');
+INSERT INTO t VALUES (4387, 7, 6.53, 'name4387');
+INSERT INTO t VALUES (4388, 8, 85.72, 'name4388');
+INSERT INTO t VALUES (4389, 9, 64.91, 'name4389');
+INSERT INTO t VALUES (4390, 0, 44.10, 'name4390');
+INSERT INTO t VALUES (4391, 1, 23.29, 'name4391');
+INSERT INTO t VALUES (4392, 2, 2.48, 'name4392');
+INSERT INTO t VALUES (4393, 3, 81.67, 'name4393');
+INSERT INTO t VALUES (4394, 4, 60.86, 'name4394');
+INSERT INTO t VALUES (4395, 5, 40.05, 'name4395');
+INSERT INTO t VALUES (4396, 6, 19.24, 'name4396');
+INSERT INTO t VALUES (4397, 7, 98.43, 'name4397');
+INSERT INTO t VALUES (4398, 8, 77.62, 'name4398');
+INSERT INTO t VALUES (4399, 9, 56.81, 'name4399');
+INSERT INTO t VALUES (4400, 0, 36.00, 'name4400');
+INSERT INTO t VALUES (4401, 1, 15.19, 'name4401');
+INSERT INTO t VALUES (4402, 2, 94.38, 'name4402');
+INSERT INTO t VALUES (4403, 3, 73.57, 'name4403');
+INSERT INTO t VALUES (4404, 4, 52.76, 'name4404');
+INSERT INTO t VALUES (4405, 5, 31.95, 'name4405');
+INSERT INTO t VALUES (4406, 6, 11.14, 'name4406');
+INSERT INTO t VALUES (4407, 7, 90.33, 'name4407');
+INSERT INTO t VALUES (4408, 8, 69.52, 'name4408');
+INSERT INTO t VALUES (4409, 9, 48.71, 'name4409');
+INSERT INTO t VALUES (4410, 0, 27.90, 'name4410');
+INSERT INTO t VALUES (4411, 1, 7.09, 'name4411');
+INSERT INTO t VALUES (4412, 2, 86.28, 'name4412');
+INSERT INTO t VALUES (4413, 3, 65.47, 'name4413');
+INSERT INTO t VALUES (4414, 4, 44.66, 'name4414');
+INSERT INTO t VALUES (4415, 5, 23.85, 'name4415');
+INSERT INTO t VALUES (4416, 6, 3.04, 'name4416');
+INSERT INTO t VALUES (4417, 7, 82.23, 'name4417');
+INSERT INTO t VALUES (4418, 8, 61.42, 'name4418');
+INSERT INTO t VALUES (4419, 9, 40.61, 'name4419');
+INSERT INTO t VALUES (4420, 0, 19.80, 'name4420');
+INSERT INTO t VALUES (4421, 1, 98.99, 'name4421');
+INSERT INTO t VALUES (4422, 2, 78.18, 'name4422');
+INSERT INTO t VALUES (4423, 3, 57.37, 'name4423');
+INSERT INTO t VALUES (4424, 4, 36.56, 'name4424');
+INSERT INTO t VALUES (4425, 5, 15.75, 'name4425');
+INSERT INTO t VALUES (4426, 6, 94.94, 'name4426');
+INSERT INTO t VALUES (4427, 7, 74.13, 'name4427');
+INSERT INTO t VALUES (4428, 8, 53.32, 'name4428');
+INSERT INTO t VALUES (4429, 9, 32.51, 'name4429');
+INSERT INTO t VALUES (4430, 0, 11.70, 'name4430');
+INSERT INTO t VALUES (4431, 1, 90.89, 'name4431');
+INSERT INTO t VALUES (4432, 2, 70.08, 'name4432');
+INSERT INTO t VALUES (4433, 3, 49.27, 'name4433');
+INSERT INTO t VALUES (4434, 4, 28.46, 'name4434');
+INSERT INTO t VALUES (4435, 5, 7.65, 'name4435');
+INSERT INTO t VALUES (4436, 6, 86.84, 'name4436');
+INSERT INTO t VALUES (4437, 7, 66.03, 'name4437');
+INSERT INTO t VALUES (4438, 8, 45.22, 'name4438');
+INSERT INTO t VALUES (4439, 9, 24.41, 'name4439');
+INSERT INTO t VALUES (4440, 0, 3.60, 'name4440');
+INSERT INTO t VALUES (4441, 1, 82.79, 'name4441');
+INSERT INTO t VALUES (4442, 2, 61.98, 'name4442');
+INSERT INTO t VALUES (4443, 3, 41.17, 'name4443');
+INSERT INTO t VALUES (4444, 4, 20.36, 'name4444');
+INSERT INTO t VALUES (4445, 5, 99.55, 'name4445');
+INSERT INTO t VALUES (4446, 6, 78.74, 'name4446');
+INSERT INTO t VALUES (4447, 7, 57.93, 'name4447');
+INSERT INTO t VALUES (4448, 8, 37.12, 'name4448');
+INSERT INTO t VALUES (4449, 9, 16.31, 'name4449');
+INSERT INTO t VALUES (4450, 0, 95.50, 'name4450');
+INSERT INTO t VALUES (4451, 1, 74.69, 'name4451');
+INSERT INTO t VALUES (4452, 2, 53.88, 'name4452');
+INSERT INTO t VALUES (4453, 3, 33.07, 'name4453');
+INSERT INTO t VALUES (4454, 4, 12.26, 'name4454');
+INSERT INTO t VALUES (4455, 5, 91.45, 'name4455');
+INSERT INTO t VALUES (4456, 6, 70.64, 'name4456');
+INSERT INTO t VALUES (4457, 7, 49.83, 'name4457');
+INSERT INTO t VALUES (4458, 8, 29.02, 'name4458');
+INSERT INTO t VALUES (4459, 9, 8.21, 'name4459');
+INSERT INTO t VALUES (4460, 0, 87.40, 'name4460');
+INSERT INTO t VALUES (4461, 1, 66.59, 'name4461');
+INSERT INTO t VALUES (4462, 2, 45.78, 'name4462');
+INSERT INTO t VALUES (4463, 3, 24.97, 'name4463');
+INSERT INTO t VALUES (4464, 4, 4.16, 'name4464');
+INSERT INTO t VALUES (4465, 5, 83.35, 'name4465');
+INSERT INTO t VALUES (4466, 6, 62.54, 'name4466');
+INSERT INTO t VALUES (4467, 7, 41.73, 'name4467');
+INSERT INTO t VALUES (4468, 8, 20.92, 'name4468');
+INSERT INTO t VALUES (4469, 9, 0.11, 'name4469');
+INSERT INTO t VALUES (4470, 0, 79.30, 'name4470');
+INSERT INTO t VALUES (4471, 1, 58.49, 'name4471');
+INSERT INTO t VALUES (4472, 2, 37.68, 'name4472');
+INSERT INTO t VALUES (4473, 3, 16.87, 'name4473');
+INSERT INTO t VALUES (4474, 4, 96.06, 'name4474');
+INSERT INTO t VALUES (4475, 5, 75.25, 'name4475');
+INSERT INTO t VALUES (4476, 6, 54.44, 'name4476');
+INSERT INTO t VALUES (4477, 7, 33.63, 'name4477');
+INSERT INTO t VALUES (4478, 8, 12.82, 'name4478');
+INSERT INTO t VALUES (4479, 9, 92.01, 'name4479');
+INSERT INTO t VALUES (4480, 0, 71.20, 'name4480');
+INSERT INTO t VALUES (4481, 1, 50.39, 'name4481');
+INSERT INTO t VALUES (4482, 2, 29.58, 'name4482');
+INSERT INTO t VALUES (4483, 3, 8.77, 'name4483');
+INSERT INTO t VALUES (4484, 4, 87.96, 'name4484');
+INSERT INTO t VALUES (4485, 5, 67.15, 'name4485');
+INSERT INTO t VALUES (4486, 6, 46.34, 'name4486');
+INSERT INTO t VALUES (4487, 7, 25.53, 'name4487');
+INSERT INTO t VALUES (4488, 8, 4.72, 'name4488');
+INSERT INTO t VALUES (4489, 9, 83.91, 'name4489');
+INSERT INTO t VALUES (4490, 0, 63.10, 'name4490');
+INSERT INTO t VALUES (4491, 1, 42.29, 'name4491');
+INSERT INTO t VALUES (4492, 2, 21.48, 'name4492');
+INSERT INTO t VALUES (4493, 3, 0.67, 'name4493');
+INSERT INTO t VALUES (4494, 4, 79.86, 'name4494');
+INSERT INTO t VALUES (4495, 5, 59.05, 'name4495');
+INSERT INTO t VALUES (4496, 6, 38.24, 'name4496');
+INSERT INTO t VALUES (4497, 7, 17.43, 'name4497');
+INSERT INTO t VALUES (4498, 8, 96.62, 'name4498');
+INSERT INTO t VALUES (4499, 9, 75.81, 'name4499');
+INSERT INTO t VALUES (4500, 0, 55.00, 'name4500');
+INSERT INTO t VALUES (4501, 1, 34.19, 'name4501');
+INSERT INTO t VALUES (4502, 2, 13.38, 'name4502');
+INSERT INTO t VALUES (4503, 3, 92.57, 'name4503');
+INSERT INTO t VALUES (4504, 4, 71.76, 'name4504');
+INSERT INTO t VALUES (4505, 5, 50.95, 'name4505');
+INSERT INTO t VALUES (4506, 6, 30.14, 'name4506');
+INSERT INTO t VALUES (4507, 7, 9.33, 'name4507');
+INSERT INTO t VALUES (4508, 8, 88.52, 'name4508');
+INSERT INTO t VALUES (4509, 9, 67.71, 'name4509');
+INSERT INTO t VALUES (4510, 0, 46.90, 'name4510');
+INSERT INTO t VALUES (4511, 1, 26.09, 'name4511');
+INSERT INTO t VALUES (4512, 2, 5.28, 'name4512');
+INSERT INTO t VALUES (4513, 3, 84.47, 'name4513');
+INSERT INTO t VALUES (4514, 4, 63.66, 'name4514');
+INSERT INTO t VALUES (4515, 5, 42.85, 'name4515');
+INSERT INTO t VALUES (4516, 6, 22.04, 'name4516');
+INSERT INTO t VALUES (4517, 7, 1.23, 'name4517');
+INSERT INTO t VALUES (4518, 8, 80.42, 'name4518');
+INSERT INTO t VALUES (4519, 9, 59.61, 'name4519');
+INSERT INTO t VALUES (4520, 0, 38.80, 'name4520');
+INSERT INTO t VALUES (4521, 1, 17.99, 'name4521');
+INSERT INTO t VALUES (4522, 2, 97.18, 'name4522');
+INSERT INTO t VALUES (4523, 3, 76.37, 'name4523');
+INSERT INTO t VALUES (4524, 4, 55.56, 'name4524');
+INSERT INTO t VALUES (4525, 5, 34.75, 'name4525');
+INSERT INTO t VALUES (4526, 6, 13.94, 'name4526');
+INSERT INTO t VALUES (4527, 7, 93.13, 'name4527');
+INSERT INTO t VALUES (4528, 8, 72.32, 'name4528');
+INSERT INTO t VALUES (4529, 9, 51.51, 'name4529');
+INSERT INTO t VALUES (4530, 0, 30.70, 'name4530');
+INSERT INTO t VALUES (4531, 1, 9.89, 'name4531');
+INSERT INTO t VALUES (4532, 2, 89.08, 'name4532');
+INSERT INTO t VALUES (4533, 3, 68.27, 'name4533');
+INSERT INTO t VALUES (4534, 4, 47.46, 'name4534');
+INSERT INTO t VALUES (4535, 5, 26.65, 'name4535');
+INSERT INTO t VALUES (4536, 6, 5.84, 'name4536');
+INSERT INTO t VALUES (4537, 7, 85.03, 'name4537');
+INSERT INTO t VALUES (4538, 8, 64.22, 'name4538');
+INSERT INTO t VALUES (4539, 9, 43.41, 'name4539');
+INSERT INTO t VALUES (4540, 0, 22.60, 'name4540');
+INSERT INTO t VALUES (4541, 1, 1.79, 'name4541');
+INSERT INTO t VALUES (4542, 2, 80.98, 'name4542');
+INSERT INTO t VALUES (4543, 3, 60.17, 'name4543');
+INSERT INTO t VALUES (4544, 4, 39.36, 'name4544');
+INSERT INTO t VALUES (4545, 5, 18.55, 'name4545');
+INSERT INTO t VALUES (4546, 6, 97.74, 'name4546');
+INSERT INTO t VALUES (4547, 7, 76.93, 'name4547');
+INSERT INTO t VALUES (4548, 8, 56.12, 'name4548');
+INSERT INTO t VALUES (4549, 9, 35.31, 'name4549');
+INSERT INTO t VALUES (4550, 0, 14.50, 'name4550');
+INSERT INTO t VALUES (4551, 1, 93.69, 'name4551');
+INSERT INTO t VALUES (4552, 2, 72.88, 'name4552');
+INSERT INTO t VALUES (4553, 3, 52.07, 'name4553');
+INSERT INTO t VALUES (4554, 4, 31.26, 'name4554');
+INSERT INTO t VALUES (4555, 5, 10.45, 'name4555');
+INSERT INTO t VALUES (4556, 6, 89.64, 'name4556');
+INSERT INTO t VALUES (4557, 7, 68.83, 'name4557');
+INSERT INTO t VALUES (4558, 8, 48.02, 'name4558');
+INSERT INTO t VALUES (4559, 9, 27.21, 'name4559');
+INSERT INTO t VALUES (4560, 0, 6.40, 'name4560');
+INSERT INTO t VALUES (4561, 1, 85.59, 'name4561');
+INSERT INTO t VALUES (4562, 2, 64.78, 'name4562');
+INSERT INTO t VALUES (4563, 3, 43.97, 'name4563');
+INSERT INTO t VALUES (4564, 4, 23.16, 'name4564');
+INSERT INTO t VALUES (4565, 5, 2.35, 'name4565');
+INSERT INTO t VALUES (4566, 6, 81.54, 'name4566');
+INSERT INTO t VALUES (4567, 7, 60.73, 'name4567');
+INSERT INTO t VALUES (4568, 8, 39.92, 'name4568');
+INSERT INTO t VALUES (4569, 9, 19.11, 'name4569');
+INSERT INTO t VALUES (4570, 0, 98.30, 'name4570');
+INSERT INTO t VALUES (4571, 1, 77.49, 'name4571');
+INSERT INTO t VALUES (4572, 2, 56.68, 'name4572');
+INSERT INTO t VALUES (4573, 3, 35.87, 'name4573');
+INSERT INTO t VALUES (4574, 4, 15.06, 'name4574');
+INSERT INTO t VALUES (4575, 5, 94.25, 'name4575');
+INSERT INTO t VALUES (4576, 6, 73.44, 'name4576');
+INSERT INTO t VALUES (4577, 7, 52.63, 'name4577');
+INSERT INTO t VALUES (4578, 8, 31.82, 'name4578');
+INSERT INTO t VALUES (4579, 9, 11.01, 'name4579');
+INSERT INTO t VALUES (4580, 0, 90.20, 'name4580');
+INSERT INTO t VALUES (4581, 1, 69.39, 'name4581');
+INSERT INTO t VALUES (4582, 2, 48.58, 'name4582');
+INSERT INTO t VALUES (4583, 3, 27.77, 'name4583');
+INSERT INTO t VALUES (4584, 4, 6.96, 'name4584');
+INSERT INTO t VALUES (4585, 5, 86.15, 'name4585');
+INSERT INTO t VALUES (4586, 6, 65.34, 'name4586');
+INSERT INTO t VALUES (4587, 7, 44.53, 'name4587');
+INSERT INTO t VALUES (4588, 8, 23.72, 'name4588');
+INSERT INTO t VALUES (4589, 9, 2.91, 'name4589');
+INSERT INTO t VALUES (4590, 0, 82.10, 'name4590');
+INSERT INTO t VALUES (4591, 1, 61.29, 'name4591');
+INSERT INTO t VALUES (4592, 2, 40.48, 'name4592');
+INSERT INTO t VALUES (4593, 3, 19.67, 'name4593');
+INSERT INTO t VALUES (4594, 4, 98.86, 'name4594');
+INSERT INTO t VALUES (4595, 5, 78.05, 'name4595');
+INSERT INTO t VALUES (4596, 6, 57.24, 'name4596');
+INSERT INTO t VALUES (4597, 7, 36.43, 'name4597');
+INSERT INTO t VALUES (4598, 8, 15.62, 'name4598');
+INSERT INTO t VALUES (4599, 9, 94.81, 'name4599');
+INSERT INTO t VALUES (4600, 0, 74.00, 'name4600');
+INSERT INTO t VALUES (4601, 1, 53.19, 'name4601');
+INSERT INTO t VALUES (4602, 2, 32.38, 'name4602');
+INSERT INTO t VALUES (4603, 3, 11.57, 'name4603');
+INSERT INTO t VALUES (4604, 4, 90.76, 'name4604');
+INSERT INTO t VALUES (4605, 5, 69.95, 'name4605');
+INSERT INTO t VALUES (4606, 6, 49.14, 'name4606');
+INSERT INTO t VALUES (4607, 7, 28.33, 'name4607');
+INSERT INTO t VALUES (4608, 8, 7.52, 'name4608');
+INSERT INTO t VALUES (4609, 9, 86.71, 'name4609');
+INSERT INTO t VALUES (4610, 0, 65.90, 'name4610');
+INSERT INTO t VALUES (4611, 1, 45.09, 'name4611');
+INSERT INTO t VALUES (4612, 2, 24.28, 'name4612');
+INSERT INTO t VALUES (4613, 3, 3.47, 'name4613');
+INSERT INTO t VALUES (4614, 4, 82.66, 'name4614');
+INSERT INTO t VALUES (4615, 5, 61.85, 'name4615');
+INSERT INTO t VALUES (4616, 6, 41.04, 'name4616');
+INSERT INTO t VALUES (4617, 7, 20.23, 'name4617');
+INSERT INTO t VALUES (4618, 8, 99.42, 'name4618');
+INSERT INTO t VALUES (4619, 9, 78.61, 'name4619');
+INSERT INTO t VALUES (4620, 0, 57.80, 'name4620');
+INSERT INTO t VALUES (4621, 1, 36.99, 'name4621');
+INSERT INTO t VALUES (4622, 2, 16.18, 'name4622');
+INSERT INTO t VALUES (4623, 3, 95.37, 'name4623');
+INSERT INTO t VALUES (4624, 4, 74.56, 'name4624');
+INSERT INTO t VALUES (4625, 5, 53.75, 'name4625');
+INSERT INTO t VALUES (4626, 6, 32.94, 'name4626');
+INSERT INTO t VALUES (4627, 7, 12.13, 'name4627');
+INSERT INTO t VALUES (4628, 8, 91.32, 'name4628');
+INSERT INTO t VALUES (4629, 9, 70.51, 'name4629');
+INSERT INTO t VALUES (4630, 0, 49.70, 'name4630');
+INSERT INTO t VALUES (4631, 1, 28.89, 'name4631');
+INSERT INTO t VALUES (4632, 2, 8.08, 'name4632');
+INSERT INTO t VALUES (4633, 3, 87.27, 'name4633');
+INSERT INTO t VALUES (4634, 4, 66.46, 'name4634');
+INSERT INTO t VALUES (4635, 5, 45.65, 'name4635');
+INSERT INTO t VALUES (4636, 6, 24.84, 'name4636');
+INSERT INTO t VALUES (4637, 7, 4.03, 'name4637');
+INSERT INTO t VALUES (4638, 8, 83.22, 'name4638');
+INSERT INTO t VALUES (4639, 9, 62.41, 'name4639');
+INSERT INTO t VALUES (4640, 0, 41.60, 'name4640');
+INSERT INTO t VALUES (4641, 1, 20.79, 'name4641');
+INSERT INTO t VALUES (4642, 2, 99.98, 'name4642');
+INSERT INTO t VALUES (4643, 3, 79.17, 'name4643');
+INSERT INTO t VALUES (4644, 4, 58.36, 'name4644');
+INSERT INTO t VALUES (4645, 5, 37.55, 'name4645');
+INSERT INTO t VALUES (4646, 6, 16.74, 'name4646');
+INSERT INTO t VALUES (4647, 7, 95.93, 'name4647');
+INSERT INTO t VALUES (4648, 8, 75.12, 'name4648');
+INSERT INTO t VALUES (4649, 9, 54.31, 'name4649');
+INSERT INTO t VALUES (4650, 0, 33.50, 'name4650');
+INSERT INTO t VALUES (4651, 1, 12.69, 'name4651');
+INSERT INTO t VALUES (4652, 2, 91.88, 'name4652');
+INSERT INTO t VALUES (4653, 3, 71.07, 'name4653');
+INSERT INTO t VALUES (4654, 4, 50.26, 'name4654');
+INSERT INTO t VALUES (4655, 5, 29.45, 'name4655');
+INSERT INTO t VALUES (4656, 6, 8.64, 'name4656');
+INSERT INTO t VALUES (4657, 7, 87.83, 'name4657');
+INSERT INTO t VALUES (4658, 8, 67.02, 'name4658');
+INSERT INTO t VALUES (4659, 9, 46.21, 'name4659');
+INSERT INTO t VALUES (4660, 0, 25.40, 'name4660');
+INSERT INTO t VALUES (4661, 1, 4.59, 'name4661');
+INSERT INTO t VALUES (4662, 2, 83.78, 'name4662');
+INSERT INTO t VALUES (4663, 3, 62.97, 'name4663');
+INSERT INTO t VALUES (4664, 4, 42.16, 'name4664');
+INSERT INTO t VALUES (4665, 5, 21.35, 'name4665');
+INSERT INTO t VALUES (4666, 6, 0.54, 'name4666');
+INSERT INTO t VALUES (4667, 7, 79.73, 'name4667');
+INSERT INTO t VALUES (4668, 8, 58.92, 'name4668');
+INSERT INTO t VALUES (4669, 9, 38.11, 'name4669');
+INSERT INTO t VALUES (4670, 0, 17.30, 'name4670');
+INSERT INTO t VALUES (4671, 1, 96.49, 'name4671');
+INSERT INTO t VALUES (4672, 2, 75.68, 'name4672');
+INSERT INTO t VALUES (4673, 3, 54.87, 'name4673');
+INSERT INTO t VALUES (4674, 4, 34.06, 'name4674');
+INSERT INTO t VALUES (4675, 5, 13.25, 'name4675');
+INSERT INTO t VALUES (4676, 6, 92.44, 'name4676');
+INSERT INTO t VALUES (4677, 7, 71.63, 'name4677');
+INSERT INTO t VALUES (4678, 8, 50.82, 'name4678');
+INSERT INTO t VALUES (4679, 9, 30.01, 'name4679');
+INSERT INTO t VALUES (4680, 0, 9.20, 'name4680');
+INSERT INTO t VALUES (4681, 1, 88.39, 'name4681');
+INSERT INTO t VALUES (4682, 2, 67.58, 'name4682');
+INSERT INTO t VALUES (4683, 3, 46.77, 'name4683');
+INSERT INTO t VALUES (4684, 4, 25.96, 'name4684');
+INSERT INTO t VALUES (4685, 5, 5.15, 'name4685');
+INSERT INTO t VALUES (4686, 6, 84.34, 'name4686');
+INSERT INTO t VALUES (4687, 7, 63.53, 'name4687');
+INSERT INTO t VALUES (4688, 8, 42.72, 'name4688');
+INSERT INTO t VALUES (4689, 9, 21.91, 'name4689');
+INSERT INTO t VALUES (4690, 0, 1.10, 'name4690');
+INSERT INTO t VALUES (4691, 1, 80.29, 'name4691');
+INSERT INTO t VALUES (4692, 2, 59.48, 'name4692');
+INSERT INTO t VALUES (4693, 3, 38.67, 'name4693');
+INSERT INTO t VALUES (4694, 4, 17.86, 'name4694');
+INSERT INTO t VALUES (4695, 5, 97.05, 'name4695');
+INSERT INTO t VALUES (4696, 6, 76.24, 'name4696');
+INSERT INTO t VALUES (4697, 7, 55.43, 'name4697');
+INSERT INTO t VALUES (4698, 8, 34.62, 'name4698');
+INSERT INTO t VALUES (4699, 9, 13.81, 'name4699');
+INSERT INTO t VALUES (4700, 0, 93.00, 'name4700');
+INSERT INTO t VALUES (4701, 1, 72.19, 'name4701');
+INSERT INTO t VALUES (4702, 2, 51.38, 'name4702');
+INSERT INTO t VALUES (4703, 3, 30.57, 'name4703');
+INSERT INTO t VALUES (4704, 4, 9.76, 'name4704');
+INSERT INTO t VALUES (4705, 5, 88.95, 'name4705');
+INSERT INTO t VALUES (4706, 6, 68.14, 'name4706');
+INSERT INTO t VALUES (4707, 7, 47.33, 'name4707');
+INSERT INTO t VALUES (4708, 8, 26.52, 'name4708');
+INSERT INTO t VALUES (4709, 9, 5.71, 'name4709');
+INSERT INTO t VALUES (4710, 0, 84.90, 'name4710');
+INSERT INTO t VALUES (4711, 1, 64.09, 'name4711');
+INSERT INTO t VALUES (4712, 2, 43.28, 'name4712');
+INSERT INTO t VALUES (4713, 3, 22.47, 'name4713');
+INSERT INTO t VALUES (4714, 4, 1.66, 'name4714');
+INSERT INTO t VALUES (4715, 5, 80.85, 'name4715');
+INSERT INTO t VALUES (4716, 6, 60.04, 'name4716');
+INSERT INTO t VALUES (4717, 7, 39.23, 'name4717');
+INSERT INTO t VALUES (4718, 8, 18.42, 'name4718');
+INSERT INTO t VALUES (4719, 9, 97.61, 'name4719');
+INSERT INTO t VALUES (4720, 0, 76.80, 'name4720');
+INSERT INTO t VALUES (4721, 1, 55.99, 'name4721');
+INSERT INTO t VALUES (4722, 2, 35.18, 'name4722');
+INSERT INTO t VALUES (4723, 3, 14.37, 'name4723');
+INSERT INTO t VALUES (4724, 4, 93.56, 'name4724');
+INSERT INTO t VALUES (4725, 5, 72.75, 'name4725');
+INSERT INTO t VALUES (4726, 6, 51.94, 'name4726');
+INSERT INTO t VALUES (4727, 7, 31.13, 'name4727');
+INSERT INTO t VALUES (4728, 8, 10.32, 'name4728');
+INSERT INTO t VALUES (4729, 9, 89.51, 'name4729');
+INSERT INTO t VALUES (4730, 0, 68.70, 'name4730');
+INSERT INTO t VALUES (4731, 1, 47.89, 'name4731');
+INSERT INTO t VALUES (4732, 2, 27.08, 'name4732');
+INSERT INTO t VALUES (4733, 3, 6.27, 'name4733');
+INSERT INTO t VALUES (4734, 4, 85.46, 'name4734');
+INSERT INTO t VALUES (4735, 5, 64.65, 'name4735');
+INSERT INTO t VALUES (4736, 6, 43.84, 'name4736');
+INSERT INTO t VALUES (4737, 7, 23.03, 'name4737');
+INSERT INTO t VALUES (4738, 8, 2.22, 'name4738');
+INSERT INTO t VALUES (4739, 9, 81.41, 'name4739');
+INSERT INTO t VALUES (4740, 0, 60.60, 'name4740');
+INSERT INTO t VALUES (4741, 1, 39.79, 'name4741');
+INSERT INTO t VALUES (4742, 2, 18.98, 'name4742');
+INSERT INTO t VALUES (4743, 3, 98.17, 'name4743');
+INSERT INTO t VALUES (4744, 4, 77.36, 'name4744');
+INSERT INTO t VALUES (4745, 5, 56.55, 'name4745');
+INSERT INTO t VALUES (4746, 6, 35.74, 'name4746');
+INSERT INTO t VALUES (4747, 7, 14.93, 'name4747');
+INSERT INTO t VALUES (4748, 8, 94.12, 'name4748');
+INSERT INTO t VALUES (4749, 9, 73.31, 'name4749');
+INSERT INTO t VALUES (4750, 0, 52.50, 'name4750');
+INSERT INTO t VALUES (4751, 1, 31.69, 'name4751');
+INSERT INTO t VALUES (4752, 2, 10.88, 'name4752');
+INSERT INTO t VALUES (4753, 3, 90.07, 'name4753');
+INSERT INTO t VALUES (4754, 4, 69.26, 'name4754');
+INSERT INTO t VALUES (4755, 5, 48.45, 'name4755');
+INSERT INTO t VALUES (4756, 6, 27.64, 'name4756');
+INSERT INTO t VALUES (4757, 7, 6.83, 'name4757');
+INSERT INTO t VALUES (4758, 8, 86.02, 'name4758');
+INSERT INTO t VALUES (4759, 9, 65.21, 'name4759');
+INSERT INTO t VALUES (4760, 0, 44.40, 'name4760');
+INSERT INTO t VALUES (4761, 1, 23.59, 'name4761');
+INSERT INTO t VALUES (4762, 2, 2.78, 'name4762');
+INSERT INTO t VALUES (4763, 3, 81.97, 'name4763');
+INSERT INTO t VALUES (4764, 4, 61.16, 'name4764');
+INSERT INTO t VALUES (4765, 5, 40.35, 'name4765');
+INSERT INTO t VALUES (4766, 6, 19.54, 'name4766');
+INSERT INTO t VALUES (4767, 7, 98.73, 'name4767');
+INSERT INTO t VALUES (4768, 8, 77.92, 'name4768');
+INSERT INTO t VALUES (4769, 9, 57.11, 'name4769');
+INSERT INTO t VALUES (4770, 0, 36.30, 'name4770');
+INSERT INTO t VALUES (4771, 1, 15.49, 'name4771');
+INSERT INTO t VALUES (4772, 2, 94.68, 'name4772');
+INSERT INTO t VALUES (4773, 3, 73.87, 'name4773');
+INSERT INTO t VALUES (4774, 4, 53.06, 'name4774');
+INSERT INTO t VALUES (4775, 5, 32.25, 'name4775');
+INSERT INTO t VALUES (4776, 6, 11.44, 'name4776');
+INSERT INTO t VALUES (4777, 7, 90.63, 'name4777');
+INSERT INTO t VALUES (4778, 8, 69.82, 'name4778');
+INSERT INTO t VALUES (4779, 9, 49.01, 'name4779');
+INSERT INTO t VALUES (4780, 0, 28.20, 'name4780');
+INSERT INTO t VALUES (4781, 1, 7.39, 'name4781');
+INSERT INTO t VALUES (4782, 2, 86.58, 'name4782');
+INSERT INTO t VALUES (4783, 3, 65.77, 'name4783');
+INSERT INTO t VALUES (4784, 4, 44.96, 'name4784');
+INSERT INTO t VALUES (4785, 5, 24.15, 'name4785');
+INSERT INTO t VALUES (4786, 6, 3.34, 'name4786');
+INSERT INTO t VALUES (4787, 7, 82.53, 'name4787');
+INSERT INTO t VALUES (4788, 8, 61.72, 'name4788');
+INSERT INTO t VALUES (4789, 9, 40.91, 'name4789');
+INSERT INTO t VALUES (4790, 0, 20.10, 'name4790');
+INSERT INTO t VALUES (4791, 1, 99.29, 'name4791');
+INSERT INTO t VALUES (4792, 2, 78.48, 'name4792');
+INSERT INTO t VALUES (4793, 3, 57.67, 'name4793');
+INSERT INTO t VALUES (4794, 4, 36.86, 'name4794');
+INSERT INTO t VALUES (4795, 5, 16.05, 'name4795');
+INSERT INTO t VALUES (4796, 6, 95.24, 'name4796');
+INSERT INTO t VALUES (4797, 7, 74.43, 'name4797');
+INSERT INTO t VALUES (4798, 8, 53.62, 'name4798');
+INSERT INTO t VALUES (4799, 9, 32.81, 'name4799');
+INSERT INTO t VALUES (4800, 0, 12.00, 'name4800');
+INSERT INTO t VALUES (4801, 1, 91.19, 'name4801');
+INSERT INTO t VALUES (4802, 2, 70.38, 'name4802');
+INSERT INTO t VALUES (4803, 3, 49.57, 'name4803');
+INSERT INTO t VALUES (4804, 4, 28.76, 'name4804');
+INSERT INTO t VALUES (4805, 5, 7.95, 'name4805');
+INSERT INTO t VALUES (4806, 6, 87.14, 'name4806');
+INSERT INTO t VALUES (4807, 7, 66.33, 'name4807');
+INSERT INTO t VALUES (4808, 8, 45.52, 'name4808');
+INSERT INTO t VALUES (4809, 9, 24.71, 'name4809');
+INSERT INTO t VALUES (4810, 0, 3.90, 'name4810');
+INSERT INTO t VALUES (4811, 1, 83.09, 'name4811');
+INSERT INTO t VALUES (4812, 2, 62.28, 'name4812');
+INSERT INTO t VALUES (4813, 3, 41.47, 'name4813');
+INSERT INTO t VALUES (4814, 4, 20.66, 'name4814');
+INSERT INTO t VALUES (4815, 5, 99.85, 'name4815');
+INSERT INTO t VALUES (4816, 6, 79.04, 'name4816');
+INSERT INTO t VALUES (4817, 7, 58.23, 'name4817');
+INSERT INTO t VALUES (4818, 8, 37.42, 'name4818');
+INSERT INTO t VALUES (4819, 9, 16.61, 'name4819');
+INSERT INTO t VALUES (4820, 0, 95.80, 'name4820');
+INSERT INTO t VALUES (4821, 1, 74.99, 'name4821');
+INSERT INTO t VALUES (4822, 2, 54.18, 'name4822');
+INSERT INTO t VALUES (4823, 3, 33.37, 'name4823');
+INSERT INTO t VALUES (4824, 4, 12.56, 'name4824');
+INSERT INTO t VALUES (4825, 5, 91.75, 'name4825');
+INSERT INTO t VALUES (4826, 6, 70.94, 'name4826');
+INSERT INTO t VALUES (4827, 7, 50.13, 'name4827');
+INSERT INTO t VALUES (4828, 8, 29.32, 'name4828');
+INSERT INTO t VALUES (4829, 9, 8.51, 'name4829');
+INSERT INTO t VALUES (4830, 0, 87.70, 'name4830');
+INSERT INTO t VALUES (4831, 1, 66.89, 'name4831');
+INSERT INTO t VALUES (4832, 2, 46.08, 'name4832');
+INSERT INTO t VALUES (4833, 3, 25.27, 'name4833');
+INSERT INTO t VALUES (4834, 4, 4.46, 'name4834');
+INSERT INTO t VALUES (4835, 5, 83.65, 'name4835');
+INSERT INTO t VALUES (4836, 6, 62.84, 'name4836');
+INSERT INTO t VALUES (4837, 7, 42.03, 'name4837');
+INSERT INTO t VALUES (4838, 8, 21.22, 'name4838');
+INSERT INTO t VALUES (4839, 9, 0.41, 'name4839');
+INSERT INTO t VALUES (4840, 0, 79.60, 'name4840');
+INSERT INTO t VALUES (4841, 1, 58.79, 'name4841');
+INSERT INTO t VALUES (4842, 2, 37.98, 'name4842');
+INSERT INTO t VALUES (4843, 3, 17.17, 'name4843');
+INSERT INTO t VALUES (4844, 4, 96.36, 'name4844');
+INSERT INTO t VALUES (4845, 5, 75.55, 'name4845');
+INSERT INTO t VALUES (4846, 6, 54.74, 'name4846');
+INSERT INTO t VALUES (4847, 7, 33.93, 'name4847');
+INSERT INTO t VALUES (4848, 8, 13.12, 'name4848');
+INSERT INTO t VALUES (4849, 9, 92.31, 'name4849');
+INSERT INTO t VALUES (4850, 0, 71.50, 'name4850');
+INSERT INTO t VALUES (4851, 1, 50.69, 'name4851');
+INSERT INTO t VALUES (4852, 2, 29.88, 'name4852');
+INSERT INTO t VALUES (4853, 3, 9.07, 'name4853');
+INSERT INTO t VALUES (4854, 4, 88.26, 'name4854');
+INSERT INTO t VALUES (4855, 5, 67.45, 'name4855');
+INSERT INTO t VALUES (4856, 6, 46.64, 'name4856');
+INSERT INTO t VALUES (4857, 7, 25.83, 'name4857');
+INSERT INTO t VALUES (4858, 8, 5.02, 'name4858');
+INSERT INTO t VALUES (4859, 9, 84.21, 'name4859');
+INSERT INTO t VALUES (4860, 0, 63.40, 'name4860');
+INSERT INTO t VALUES (4861, 1, 42.59, 'name4861');
+INSERT INTO t VALUES (4862, 2, 21.78, 'name4862');
+INSERT INTO t VALUES (4863, 3, 0.97, 'name4863');
+INSERT INTO t VALUES (4864, 4, 80.16, 'name4864');
+INSERT INTO t VALUES (4865, 5, 59.35, 'name4865');
+INSERT INTO t VALUES (4866, 6, 38.54, 'name4866');
+INSERT INTO t VALUES (4867, 7, 17.73, 'name4867');
+INSERT INTO t VALUES (4868, 8, 96.92, 'name4868');
+INSERT INTO t VALUES (4869, 9, 76.11, 'name4869');
+INSERT INTO t VALUES (4870, 0, 55.30, 'name4870');
+INSERT INTO t VALUES (4871, 1, 34.49, 'name4871');
+INSERT INTO t VALUES (4872, 2, 13.68, 'name4872');
+INSERT INTO t VALUES (4873, 3, 92.87, 'name4873');
+INSERT INTO t VALUES (4874, 4, 72.06, 'name4874');
+INSERT INTO t VALUES (4875, 5, 51.25, 'name4875');
+INSERT INTO t VALUES (4876, 6, 30.44, 'name4876');
+INSERT INTO t VALUES (4877, 7, 9.63, 'name4877');
+INSERT INTO t VALUES (4878, 8, 88.82, 'name4878');
+INSERT INTO t VALUES (4879, 9, 68.01, 'name4879');
+INSERT INTO t VALUES (4880, 0, 47.20, 'name4880');
+INSERT INTO t VALUES (4881, 1, 26.39, 'name4881');
+INSERT INTO t VALUES (4882, 2, 5.58, 'name4882');
+INSERT INTO t VALUES (4883, 3, 84.77, 'name4883');
+INSERT INTO t VALUES (4884, 4, 63.96, 'name4884');
+INSERT INTO t VALUES (4885, 5, 43.15, 'name4885');
+INSERT INTO t VALUES (4886, 6, 22.34, 'name4886');
+INSERT INTO t VALUES (4887, 7, 1.53, 'name4887');
+INSERT INTO t VALUES (4888, 8, 80.72, 'name4888');
+INSERT INTO t VALUES (4889, 9, 59.91, 'name4889');
+INSERT INTO t VALUES (4890, 0, 39.10, 'name4890');
+INSERT INTO t VALUES (4891, 1, 18.29, 'name4891');
+INSERT INTO t VALUES (4892, 2, 97.48, 'name4892');
+INSERT INTO t VALUES (4893, 3, 76.67, 'name4893');
+INSERT INTO t VALUES (4894, 4, 55.86, 'name4894');
+INSERT INTO t VALUES (4895, 5, 35.05, 'name4895');
+INSERT INTO t VALUES (4896, 6, 14.24, 'name4896');
+INSERT INTO t VALUES (4897, 7, 93.43, 'name4897');
+INSERT INTO t VALUES (4898, 8, 72.62, 'name4898');
+INSERT INTO t VALUES (4899, 9, 51.81, 'name4899');
+INSERT INTO t VALUES (4900, 0, 31.00, 'name4900');
+INSERT INTO t VALUES (4901, 1, 10.19, 'name4901');
+INSERT INTO t VALUES (4902, 2, 89.38, 'name4902');
+INSERT INTO t VALUES (4903, 3, 68.57, 'name4903');
+INSERT INTO t VALUES (4904, 4, 47.76, 'name4904');
+INSERT INTO t VALUES (4905, 5, 26.95, 'name4905');
+INSERT INTO t VALUES (4906, 6, 6.14, 'name4906');
+INSERT INTO t VALUES (4907, 7, 85.33, 'name4907');
+INSERT INTO t VALUES (4908, 8, 64.52, 'name4908');
+INSERT INTO t VALUES (4909, 9, 43.71, 'name4909');
+INSERT INTO t VALUES (4910, 0, 22.90, 'name4910');
+INSERT INTO t VALUES (4911, 1, 2.09, 'name4911');
+INSERT INTO t VALUES (4912, 2, 81.28, 'name4912');
+INSERT INTO t VALUES (4913, 3, 60.47, 'name4913');
+INSERT INTO t VALUES (4914, 4, 39.66, 'name4914');
+INSERT INTO t VALUES (4915, 5, 18.85, 'name4915');
+INSERT INTO t VALUES (4916, 6, 98.04, 'name4916');
+INSERT INTO t VALUES (4917, 7, 77.23, 'name4917');
+INSERT INTO t VALUES (4918, 8, 56.42, 'name4918');
+INSERT INTO t VALUES (4919, 9, 35.61, 'name4919');
+INSERT INTO t VALUES (4920, 0, 14.80, 'name4920');
+INSERT INTO t VALUES (4921, 1, 93.99, 'name4921');
+INSERT INTO t VALUES (4922, 2, 73.18, 'name4922');
+INSERT INTO t VALUES (4923, 3, 52.37, 'name4923');
+INSERT INTO t VALUES (4924, 4, 31.56, 'name4924');
+INSERT INTO t VALUES (4925, 5, 10.75, 'name4925');
+INSERT INTO t VALUES (4926, 6, 89.94, 'name4926');
+INSERT INTO t VALUES (4927, 7, 69.13, 'name4927');
+INSERT INTO t VALUES (4928, 8, 48.32, 'name4928');
+INSERT INTO t VALUES (4929, 9, 27.51, 'name4929');
+INSERT INTO t VALUES (4930, 0, 6.70, 'name4930');
+INSERT INTO t VALUES (4931, 1, 85.89, 'name4931');
+INSERT INTO t VALUES (4932, 2, 65.08, 'name4932');
+INSERT INTO t VALUES (4933, 3, 44.27, 'name4933');
+INSERT INTO t VALUES (4934, 4, 23.46, 'name4934');
+INSERT INTO t VALUES (4935, 5, 2.65, 'name4935');
+INSERT INTO t VALUES (4936, 6, 81.84, 'name4936');
+INSERT INTO t VALUES (4937, 7, 61.03, 'name4937');
+INSERT INTO t VALUES (4938, 8, 40.22, 'name4938');
+INSERT INTO t VALUES (4939, 9, 19.41, 'name4939');
+INSERT INTO t VALUES (4940, 0, 98.60, 'name4940');
+INSERT INTO t VALUES (4941, 1, 77.79, 'name4941');
+INSERT INTO t VALUES (4942, 2, 56.98, 'name4942');
+INSERT INTO t VALUES (4943, 3, 36.17, 'name4943');
+INSERT INTO t VALUES (4944, 4, 15.36, 'name4944');
+INSERT INTO t VALUES (4945, 5, 94.55, 'name4945');
+INSERT INTO t VALUES (4946, 6, 73.74, 'name4946');
+INSERT INTO t VALUES (4947, 7, 52.93, 'name4947');
+INSERT INTO t VALUES (4948, 8, 32.12, 'name4948');
+INSERT INTO t VALUES (4949, 9, 11.31, 'name4949');
+INSERT INTO t VALUES (4950, 0, 90.50, 'name4950');
+INSERT INTO t VALUES (4951, 1, 69.69, 'name4951');
+INSERT INTO t VALUES (4952, 2, 48.88, 'name4952');
+INSERT INTO t VALUES (4953, 3, 28.07, 'name4953');
+INSERT INTO t VALUES (4954, 4, 7.26, 'name4954');
+INSERT INTO t VALUES (4955, 5, 86.45, 'name4955');
+INSERT INTO t VALUES (4956, 6, 65.64, 'name4956');
+INSERT INTO t VALUES (4957, 7, 44.83, 'name4957');
+INSERT INTO t VALUES (4958, 8, 24.02, 'name4958');
+INSERT INTO t VALUES (4959, 9, 3.21, 'name4959');
+INSERT INTO t VALUES (4960, 0, 82.40, 'name4960');
+INSERT INTO t VALUES (4961, 1, 61.59, 'name4961');
+INSERT INTO t VALUES (4962, 2, 40.78, 'name4962');
+INSERT INTO t VALUES (4963, 3, 19.97, 'name4963');
+INSERT INTO t VALUES (4964, 4, 99.16, 'name4964');
+INSERT INTO t VALUES (4965, 5, 78.35, 'name4965');
+INSERT INTO t VALUES (4966, 6, 57.54, 'name4966');
+INSERT INTO t VALUES (4967, 7, 36.73, 'name4967');
+INSERT INTO t VALUES (4968, 8, 15.92, 'name4968');
+INSERT INTO t VALUES (4969, 9, 95.11, 'name4969');
+INSERT INTO t VALUES (4970, 0, 74.30, 'name4970');
+INSERT INTO t VALUES (4971, 1, 53.49, 'name4971');
+INSERT INTO t VALUES (4972, 2, 32.68, 'name4972');
+INSERT INTO t VALUES (4973, 3, 11.87, 'name4973');
+INSERT INTO t VALUES (4974, 4, 91.06, 'name4974');
+INSERT INTO t VALUES (4975, 5, 70.25, 'name4975');
+INSERT INTO t VALUES (4976, 6, 49.44, 'name4976');
+INSERT INTO t VALUES (4977, 7, 28.63, 'name4977');
+INSERT INTO t VALUES (4978, 8, 7.82, 'name4978');
+INSERT INTO t VALUES (4979, 9, 87.01, 'name4979');
+INSERT INTO t VALUES (4980, 0, 66.20, 'name4980');
+INSERT INTO t VALUES (4981, 1, 45.39, 'name4981');
+INSERT INTO t VALUES (4982, 2, 24.58, 'name4982');
+INSERT INTO t VALUES (4983, 3, 3.77, 'name4983');
+INSERT INTO t VALUES (4984, 4, 82.96, 'name4984');
+INSERT INTO t VALUES (4985, 5, 62.15, 'name4985');
+INSERT INTO t VALUES (4986, 6, 41.34, 'name4986');
+INSERT INTO t VALUES (4987, 7, 20.53, 'name4987');
+INSERT INTO t VALUES (4988, 8, 99.72, 'name4988');
+INSERT INTO t VALUES (4989, 9, 78.91, 'name4989');
+INSERT INTO t VALUES (4990, 0, 58.10, 'name4990');
+INSERT INTO t VALUES (4991, 1, 37.29, 'name4991');
+INSERT INTO t VALUES (4992, 2, 16.48, 'name4992');
+INSERT INTO t VALUES (4993, 3, 95.67, 'name4993');
+INSERT INTO t VALUES (4994, 4, 74.86, 'name4994');
+INSERT INTO t VALUES (4995, 5, 54.05, 'name4995');
+INSERT INTO t VALUES (4996, 6, 33.24, 'name4996');
+INSERT INTO t VALUES (4997, 7, 12.43, 'name4997');
+INSERT INTO t VALUES (4998, 8, 91.62, 'name4998');
+INSERT INTO t VALUES (4999, 9, 70.81, 'name4999');
+INSERT INTO t VALUES (5000, 0, 50.00, 'name5000');
+INSERT INTO t VALUES (5001, 1, 29.19, 'name5001');
+INSERT INTO t VALUES (5002, 2, 8.38, 'name5002');
+INSERT INTO t VALUES (5003, 3, 87.57, 'name5003');
+INSERT INTO t VALUES (5004, 4, 66.76, 'name5004');
+INSERT INTO t VALUES (5005, 5, 45.95, 'name5005');
+INSERT INTO t VALUES (5006, 6, 25.14, 'name5006');
+INSERT INTO t VALUES (5007, 7, 4.33, 'name5007');
+INSERT INTO t VALUES (5008, 8, 83.52, 'name5008');
+INSERT INTO t VALUES (5009, 9, 62.71, 'name5009');
+INSERT INTO t VALUES (5010, 0, 41.90, 'name5010');
+INSERT INTO t VALUES (5011, 1, 21.09, 'name5011');
+INSERT INTO t VALUES (5012, 2, 0.28, 'name5012');
+INSERT INTO t VALUES (5013, 3, 79.47, 'name5013');
+INSERT INTO t VALUES (5014, 4, 58.66, 'name5014');
+INSERT INTO t VALUES (5015, 5, 37.85, 'name5015');
+INSERT INTO t VALUES (5016, 6, 17.04, 'name5016');
+INSERT INTO t VALUES (5017, 7, 96.23, 'name5017');
+INSERT INTO t VALUES (5018, 8, 75.42, 'name5018');
+INSERT INTO t VALUES (5019, 9, 54.61, 'name5019');
+INSERT INTO t VALUES (5020, 0, 33.80, 'name5020');
+INSERT INTO t VALUES (5021, 1, 12.99, 'name5021');
+INSERT INTO t VALUES (5022, 2, 92.18, 'name5022');
+INSERT INTO t VALUES (5023, 3, 71.37, 'name5023');
+INSERT INTO t VALUES (5024, 4, 50.56, 'name5024');
+INSERT INTO t VALUES (5025, 5, 29.75, 'name5025');
+INSERT INTO t VALUES (5026, 6, 8.94, 'name5026');
+INSERT INTO t VALUES (5027, 7, 88.13, 'name5027');
+INSERT INTO t VALUES (5028, 8, 67.32, 'name5028');
+INSERT INTO t VALUES (5029, 9, 46.51, 'name5029');
+INSERT INTO t VALUES (5030, 0, 25.70, 'name5030');
+INSERT INTO t VALUES (5031, 1, 4.89, 'name5031');
+INSERT INTO t VALUES (5032, 2, 84.08, 'name5032');
+INSERT INTO t VALUES (5033, 3, 63.27, 'name5033');
+INSERT INTO t VALUES (5034, 4, 42.46, 'name5034');
+INSERT INTO t VALUES (5035, 5, 21.65, 'name5035');
+INSERT INTO t VALUES (5036, 6, 0.84, 'name5036');
+INSERT INTO t VALUES (5037, 7, 80.03, 'name5037');
+INSERT INTO t VALUES (5038, 8, 59.22, 'name5038');
+INSERT INTO t VALUES (5039, 9, 38.41, 'name5039');
+INSERT INTO t VALUES (5040, 0, 17.60, 'name5040');
+INSERT INTO t VALUES (5041, 1, 96.79, 'name5041');
+INSERT INTO t VALUES (5042, 2, 75.98, 'name5042');
+INSERT INTO t VALUES (5043, 3, 55.17, 'name5043');
+INSERT INTO t VALUES (5044, 4, 34.36, 'name5044');
+INSERT INTO t VALUES (5045, 5, 13.55, 'name5045');
+INSERT INTO t VALUES (5046, 6, 92.74, 'name5046');
+INSERT INTO t VALUES (5047, 7, 71.93, 'name5047');
+INSERT INTO t VALUES (5048, 8, 51.12, 'name5048');
+INSERT INTO t VALUES (5049, 9, 30.31, 'name5049');
+INSERT INTO t VALUES (5050, 0, 9.50, 'name5050');
+INSERT INTO t VALUES (5051, 1, 88.69, 'name5051');
+INSERT INTO t VALUES (5052, 2, 67.88, 'name5052');
+INSERT INTO t VALUES (5053, 3, 47.07, 'name5053');
+INSERT INTO t VALUES (5054, 4, 26.26, 'name5054');
+INSERT INTO t VALUES (5055, 5, 5.45, 'name5055');
+INSERT INTO t VALUES (5056, 6, 84.64, 'name5056');
+INSERT INTO t VALUES (5057, 7, 63.83, 'name5057');
+INSERT INTO t VALUES (5058, 8, 43.02, 'name5058');
+INSERT INTO t VALUES (5059, 9, 22.21, 'name5059');
+INSERT INTO t VALUES (5060, 0, 1.40, 'name5060');
+INSERT INTO t VALUES (5061, 1, 80.59, 'name5061');
+INSERT INTO t VALUES (5062, 2, 59.78, 'name5062');
+INSERT INTO t VALUES (5063, 3, 38.97, 'name5063');
+INSERT INTO t VALUES (5064, 4, 18.16, 'name5064');
+INSERT INTO t VALUES (5065, 5, 97.35, 'name5065');
+INSERT INTO t VALUES (5066, 6, 76.54, 'name5066');
+INSERT INTO t VALUES (5067, 7, 55.73, 'name5067');
+INSERT INTO t VALUES (5068, 8, 34.92, 'name5068');
+INSERT INTO t VALUES (5069, 9, 14.11, 'name5069');
+INSERT INTO t VALUES (5070, 0, 93.30, 'name5070');
+INSERT INTO t VALUES (5071, 1, 72.49, 'name5071');
+INSERT INTO t VALUES (5072, 2, 51.68, 'name5072');
+INSERT INTO t VALUES (5073, 3, 30.87, 'name5073');
+INSERT INTO t VALUES (5074, 4, 10.06, 'name5074');
+INSERT INTO t VALUES (5075, 5, 89.25, 'name5075');
+INSERT INTO t VALUES (5076, 6, 68.44, 'name5076');
+INSERT INTO t VALUES (5077, 7, 47.63, 'name5077');
+INSERT INTO t VALUES (5078, 8, 26.82, 'name5078');
+INSERT INTO t VALUES (5079, 9, 6.01, 'name5079');
+INSERT INTO t VALUES (5080, 0, 85.20, 'name5080');
+INSERT INTO t VALUES (5081, 1, 64.39, 'name5081');
+INSERT INTO t VALUES (5082, 2, 43.58, 'name5082');
+INSERT INTO t VALUES (5083, 3, 22.77, 'name5083');
+INSERT INTO t VALUES (5084, 4, 1.96, 'name5084');
+INSERT INTO t VALUES (5085, 5, 81.15, 'name5085');
+INSERT INTO t VALUES (5086, 6, 60.34, 'name5086');
+INSERT INTO t VALUES (5087, 7, 39.53, 'name5087');
+INSERT INTO t VALUES (5088, 8, 18.72, 'name5088');
+INSERT INTO t VALUES (5089, 9, 97.91, 'name5089');
+INSERT INTO t VALUES (5090, 0, 77.10, 'name5090');
+INSERT INTO t VALUES (5091, 1, 56.29, 'name5091');
+INSERT INTO t VALUES (5092, 2, 35.48, 'name5092');
+INSERT INTO t VALUES (5093, 3, 14.67, 'name5093');
+INSERT INTO t VALUES (5094, 4, 93.86, 'name5094');
+INSERT INTO t VALUES (5095, 5, 73.05, 'name5095');
+INSERT INTO t VALUES (5096, 6, 52.24, 'name5096');
+INSERT INTO t VALUES (5097, 7, 31.43, 'name5097');
+INSERT INTO t VALUES (5098, 8, 10.62, 'name5098');
+INSERT INTO t VALUES (5099, 9, 89.81, 'name5099');
+INSERT INTO t VALUES (5100, 0, 69.00, 'name5100');
+INSERT INTO t VALUES (5101, 1, 48.19, 'name5101');
+INSERT INTO t VALUES (5102, 2, 27.38, 'name5102');
+INSERT INTO t VALUES (5103, 3, 6.57, 'name5103');
+INSERT INTO t VALUES (5104, 4, 85.76, 'name5104');
+INSERT INTO t VALUES (5105, 5, 64.95, 'name5105');
+INSERT INTO t VALUES (5106, 6, 44.14, 'name5106');
+INSERT INTO t VALUES (5107, 7, 23.33, 'name5107');
+INSERT INTO t VALUES (5108, 8, 2.52, 'name5108');
+INSERT INTO t VALUES (5109, 9, 81.71, 'name5109');
+INSERT INTO t VALUES (5110, 0, 60.90, 'name5110');
+INSERT INTO t VALUES (5111, 1, 40.09, 'name5111');
+INSERT INTO t VALUES (5112, 2, 19.28, 'name5112');
+INSERT INTO t VALUES (5113, 3, 98.47, 'name5113');
+INSERT INTO t VALUES (5114, 4, 77.66, 'name5114');
+INSERT INTO t VALUES (5115, 5, 56.85, 'name5115');
+INSERT INTO t VALUES (5116, 6, 36.04, 'name5116');
+INSERT INTO t VALUES (5117, 7, 15.23, 'name5117');
+INSERT INTO t VALUES (5118, 8, 94.42, 'name5118');
+INSERT INTO t VALUES (5119, 9, 73.61, 'name5119');
+INSERT INTO t VALUES (5120, 0, 52.80, 'name5120');
+INSERT INTO t VALUES (5121, 1, 31.99, 'name5121');
+INSERT INTO t VALUES (5122, 2, 11.18, 'name5122');
+INSERT INTO t VALUES (5123, 3, 90.37, 'name5123');
+INSERT INTO t VALUES (5124, 4, 69.56, 'name5124');
+INSERT INTO t VALUES (5125, 5, 48.75, 'name5125');
+INSERT INTO t VALUES (5126, 6, 27.94, 'name5126');
+INSERT INTO t VALUES (5127, 7, 7.13, 'name5127');
+INSERT INTO t VALUES (5128, 8, 86.32, 'name5128');
+INSERT INTO t VALUES (5129, 9, 65.51, 'name5129');
+INSERT INTO t VALUES (5130, 0, 44.70, 'name5130');
+INSERT INTO t VALUES (5131, 1, 23.89, 'name5131');
+INSERT INTO t VALUES (5132, 2, 3.08, 'name5132');
+INSERT INTO t VALUES (5133, 3, 82.27, 'name5133');
+INSERT INTO t VALUES (5134, 4, 61.46, 'name5134');
+INSERT INTO t VALUES (5135, 5, 40.65, 'name5135');
+INSERT INTO t VALUES (5136, 6, 19.84, 'name5136');
+INSERT INTO t VALUES (5137, 7, 99.03, 'name5137');
+INSERT INTO t VALUES (5138, 8, 78.22, 'name5138');
+INSERT INTO t VALUES (5139, 9, 57.41, 'name5139');
+INSERT INTO t VALUES (5140, 0, 36.60, 'name5140');
+INSERT INTO t VALUES (5141, 1, 15.79, 'name5141');
+INSERT INTO t VALUES (5142, 2, 94.98, 'name5142');
+INSERT INTO t VALUES (5143, 3, 74.17, 'name5143');
+INSERT INTO t VALUES (5144, 4, 53.36, 'name5144');
+INSERT INTO t VALUES (5145, 5, 32.55, 'name5145');
+INSERT INTO t VALUES (5146, 6, 11.74, 'name5146');
+INSERT INTO t VALUES (5147, 7, 90.93, 'name5147');
+INSERT INTO t VALUES (5148, 8, 70.12, 'name5148');
+INSERT INTO t VALUES (5149, 9, 49.31, 'name5149');
+INSERT INTO t VALUES (5150, 0, 28.50, 'name5150');
+INSERT INTO t VALUES (5151, 1, 7.69, 'name5151');
+INSERT INTO t VALUES (5152, 2, 86.88, 'name5152');
+INSERT INTO t VALUES (5153, 3, 66.07, 'name5153');
+INSERT INTO t VALUES (5154, 4, 45.26, 'name5154');
+INSERT INTO t VALUES (5155, 5, 24.45, 'name5155');
+INSERT INTO t VALUES (5156, 6, 3.64, 'name5156');
+INSERT INTO t VALUES (5157, 7, 82.83, 'name5157');
+INSERT INTO t VALUES (5158, 8, 62.02, 'name5158');
+INSERT INTO t VALUES (5159, 9, 41.21, 'name5159');
+INSERT INTO t VALUES (5160, 0, 20.40, 'name5160');
+INSERT INTO t VALUES (5161, 1, 99.59, 'name5161');
+INSERT INTO t VALUES (5162, 2, 78.78, 'name5162');
+INSERT INTO t VALUES (5163, 3, 57.97, 'name5163');
+INSERT INTO t VALUES (5164, 4, 37.16, 'name5164');
+INSERT INTO t VALUES (5165, 5, 16.35, 'name5165');
+INSERT INTO t VALUES (5166, 6, 95.54, 'name5166');
+INSERT INTO t VALUES (5167, 7, 74.73, 'name5167');
+INSERT INTO t VALUES (5168, 8, 53.92, 'name5168');
+INSERT INTO t VALUES (5169, 9, 33.11, 'name5169');
+INSERT INTO t VALUES (5170, 0, 12.30, 'name5170');
+INSERT INTO t VALUES (5171, 1, 91.49, 'name5171');
+INSERT INTO t VALUES (5172, 2, 70.68, 'name5172');
+INSERT INTO t VALUES (5173, 3, 49.87, 'name5173');
+INSERT INTO t VALUES (5174, 4, 29.06, 'name5174');
+INSERT INTO t VALUES (5175, 5, 8.25, 'name5175');
+INSERT INTO t VALUES (5176, 6, 87.44, 'name5176');
+INSERT INTO t VALUES (5177, 7, 66.63, 'name5177');
+INSERT INTO t VALUES (5178, 8, 45.82, 'name5178');
+INSERT INTO t VALUES (5179, 9, 25.01, 'name5179');
+INSERT INTO t VALUES (5180, 0, 4.20, 'name5180');
+INSERT INTO t VALUES (5181, 1, 83.39, 'name5181');
+INSERT INTO t VALUES (5182, 2, 62.58, 'name5182');
+INSERT INTO t VALUES (5183, 3, 41.77, 'name5183');
+INSERT INTO t VALUES (5184, 4, 20.96, 'name5184');
+INSERT INTO t VALUES (5185, 5, 0.15, 'name5185');
+INSERT INTO t VALUES (5186, 6, 79.34, 'name5186');
+INSERT INTO t VALUES (5187, 7, 58.53, 'name5187');
+INSERT INTO t VALUES (5188, 8, 37.72, 'name5188');
+INSERT INTO t VALUES (5189, 9, 16.91, 'name5189');
+INSERT INTO t VALUES (5190, 0, 96.10, 'name5190');
+INSERT INTO t VALUES (5191, 1, 75.29, 'name5191');
+INSERT INTO t VALUES (5192, 2, 54.48, 'name5192');
+INSERT INTO t VALUES (5193, 3, 33.67, 'name5193');
+INSERT INTO t VALUES (5194, 4, 12.86, 'name5194');
+INSERT INTO t VALUES (5195, 5, 92.05, 'name5195');
+INSERT INTO t VALUES (5196, 6, 71.24, 'name5196');
+INSERT INTO t VALUES (5197, 7, 50.43, 'name5197');
+INSERT INTO t VALUES (5198, 8, 29.62, 'name5198');
+INSERT INTO t VALUES (5199, 9, 8.81, 'name5199');
+INSERT INTO t VALUES (5200, 0, 88.00, 'name5200');
+INSERT INTO t VALUES (5201, 1, 67.19, 'name5201');
+INSERT INTO t VALUES (5202, 2, 46.38, 'name5202');
+INSERT INTO t VALUES (5203, 3, 25.57, 'name5203');
+INSERT INTO t VALUES (5204, 4, 4.76, 'name5204');
+INSERT INTO t VALUES (5205, 5, 83.95, 'name5205');
+INSERT INTO t VALUES (5206, 6, 63.14, 'name5206');
+INSERT INTO t VALUES (5207, 7, 42.33, 'name5207');
+INSERT INTO t VALUES (5208, 8, 21.52, 'name5208');
+INSERT INTO t VALUES (5209, 9, 0.71, 'name5209');
+INSERT INTO t VALUES (5210, 0, 79.90, 'name5210');
+INSERT INTO t VALUES (5211, 1, 59.09, 'name5211');
+INSERT INTO t VALUES (5212, 2, 38.28, 'name5212');
+INSERT INTO t VALUES (5213, 3, 17.47, 'name5213');
+INSERT INTO t VALUES (5214, 4, 96.66, 'name5214');
+INSERT INTO t VALUES (5215, 5, 75.85, 'name5215');
+INSERT INTO t VALUES (5216, 6, 55.04, 'name5216');
+INSERT INTO t VALUES (5217, 7, 34.23, 'name5217');
+INSERT INTO t VALUES (5218, 8, 13.42, 'name5218');
+INSERT INTO t VALUES (5219, 9, 92.61, 'name5219');
+INSERT INTO t VALUES (5220, 0, 71.80, 'name5220');
+INSERT INTO t VALUES (5221, 1, 50.99, 'name5221');
+INSERT INTO t VALUES (5222, 2, 30.18, 'name5222');
+INSERT INTO t VALUES (5223, 3, 9.37, 'name5223');
+INSERT INTO t VALUES (5224, 4, 88.56, 'name5224');
+INSERT INTO t VALUES (5225, 5, 67.75, 'name5225');
+INSERT INTO t VALUES (5226, 6, 46.94, 'name5226');
+INSERT INTO t VALUES (5227, 7, 26.13, 'name5227');
+INSERT INTO t VALUES (5228, 8, 5.32, 'name5228');
+INSERT INTO t VALUES (5229, 9, 84.51, 'name5229');
+INSERT INTO t VALUES (5230, 0, 63.70, 'name5230');
+INSERT INTO t VALUES (5231, 1, 42.89, 'name5231');
+INSERT INTO t VALUES (5232, 2, 22.08, 'name5232');
+INSERT INTO t VALUES (5233, 3, 1.27, 'name5233');
+INSERT INTO t VALUES (5234, 4, 80.46, 'name5234');
+INSERT INTO t VALUES (5235, 5, 59.65, 'name5235');
+INSERT INTO t VALUES (5236, 6, 38.84, 'name5236');
+INSERT INTO t VALUES (5237, 7, 18.03, 'name5237');
+INSERT INTO t VALUES (5238, 8, 97.22, 'name5238');
+INSERT INTO t VALUES (5239, 9, 76.41, 'name5239');
+INSERT INTO t VALUES (5240, 0, 55.60, 'name5240');
+INSERT INTO t VALUES (5241, 1, 34.79, 'name5241');
+INSERT INTO t VALUES (5242, 2, 13.98, 'name5242');
+INSERT INTO t VALUES (5243, 3, 93.17, 'name5243');
+INSERT INTO t VALUES (5244, 4, 72.36, 'name5244');
+INSERT INTO t VALUES (5245, 5, 51.55, 'name5245');
+INSERT INTO t VALUES (5246, 6, 30.74, 'name5246');
+INSERT INTO t VALUES (5247, 7, 9.93, 'name5247');
+INSERT INTO t VALUES (5248, 8, 89.12, 'name5248');
+INSERT INTO t VALUES (5249, 9, 68.31, 'name5249');
+INSERT INTO t VALUES (5250, 0, 47.50, 'name5250');
+INSERT INTO t VALUES (5251, 1, 26.69, 'name5251');
+INSERT INTO t VALUES (5252, 2, 5.88, 'name5252');
+INSERT INTO t VALUES (5253, 3, 85.07, 'name5253');
+INSERT INTO t VALUES (5254, 4, 64.26, 'name5254');
+INSERT INTO t VALUES (5255, 5, 43.45, 'name5255');
+INSERT INTO t VALUES (5256, 6, 22.64, 'name5256');
+INSERT INTO t VALUES (5257, 7, 1.83, 'name5257');
+INSERT INTO t VALUES (5258, 8, 81.02, 'name5258');
+INSERT INTO t VALUES (5259, 9, 60.21, 'name5259');
+INSERT INTO t VALUES (5260, 0, 39.40, 'name5260');
+INSERT INTO t VALUES (5261, 1, 18.59, 'name5261');
+INSERT INTO t VALUES (5262, 2, 97.78, 'name5262');
+INSERT INTO t VALUES (5263, 3, 76.97, 'name5263');
+INSERT INTO t VALUES (5264, 4, 56.16, 'name5264');
+INSERT INTO t VALUES (5265, 5, 35.35, 'name5265');
+INSERT INTO t VALUES (5266, 6, 14.54, 'name5266');
+INSERT INTO t VALUES (5267, 7, 93.73, 'name5267');
+INSERT INTO t VALUES (5268, 8, 72.92, 'name5268');
+INSERT INTO t VALUES (5269, 9, 52.11, 'name5269');
+INSERT INTO t VALUES (5270, 0, 31.30, 'name5270');
+INSERT INTO t VALUES (5271, 1, 10.49, 'name5271');
+INSERT INTO t VALUES (5272, 2, 89.68, 'name5272');
+INSERT INTO t VALUES (5273, 3, 68.87, 'name5273');
+INSERT INTO t VALUES (5274, 4, 48.06, 'name5274');
+INSERT INTO t VALUES (5275, 5, 27.25, 'name5275');
+INSERT INTO t VALUES (5276, 6, 6.44, 'name5276');
+INSERT INTO t VALUES (5277, 7, 85.63, 'name5277');
+INSERT INTO t VALUES (5278, 8, 64.82, 'name5278');
+INSERT INTO t VALUES (5279, 9, 44.01, 'name5279');
+INSERT INTO t VALUES (5280, 0, 23.20, 'name5280');
+INSERT INTO t VALUES (5281, 1, 2.39, 'name5281');
+INSERT INTO t VALUES (5282, 2, 81.58, 'name5282');
+INSERT INTO t VALUES (5283, 3, 60.77, 'name5283');
+INSERT INTO t VALUES (5284, 4, 39.96, 'name5284');
+INSERT INTO t VALUES (5285, 5, 19.15, 'name5285');
+INSERT INTO t VALUES (5286, 6, 98.34, 'name5286');
+INSERT INTO t VALUES (5287, 7, 77.53, 'name5287');
+INSERT INTO t VALUES (5288, 8, 56.72, 'name5288');
+INSERT INTO t VALUES (5289, 9, 35.91, 'name5289');
+INSERT INTO t VALUES (5290, 0, 15.10, 'name5290');
+INSERT INTO t VALUES (5291, 1, 94.29, 'name5291');
+INSERT INTO t VALUES (5292, 2, 73.48, 'name5292');
+INSERT INTO t VALUES (5293, 3, 52.67, 'name5293');
+INSERT INTO t VALUES (5294, 4, 31.86, 'name5294');
+INSERT INTO t VALUES (5295, 5, 11.05, 'name5295');
+INSERT INTO t VALUES (5296, 6, 90.24, 'name5296');
+INSERT INTO t VALUES (5297, 7, 69.43, 'name5297');
+INSERT INTO t VALUES (5298, 8, 48.62, 'name5298');
+INSERT INTO t VALUES (5299, 9, 27.81, 'name5299');
+INSERT INTO t VALUES (5300, 0, 7.00, 'name5300');
+INSERT INTO t VALUES (5301, 1, 86.19, 'name5301');
+INSERT INTO t VALUES (5302, 2, 65.38, 'name5302');
+INSERT INTO t VALUES (5303, 3, 44.57, 'name5303');
+INSERT INTO t VALUES (5304, 4, 23.76, 'name5304');
+INSERT INTO t VALUES (5305, 5, 2.95, 'name5305');
+INSERT INTO t VALUES (5306, 6, 82.14, 'name5306');
+INSERT INTO t VALUES (5307, 7, 61.33, 'name5307');
+INSERT INTO t VALUES (5308, 8, 40.52, 'name5308');
+INSERT INTO t VALUES (5309, 9, 19.71, 'name5309');
+INSERT INTO t VALUES (5310, 0, 98.90, 'name5310');
+INSERT INTO t VALUES (5311, 1, 78.09, 'name5311');
+INSERT INTO t VALUES (5312, 2, 57.28, 'name5312');
+INSERT INTO t VALUES (5313, 3, 36.47, 'name5313');
+INSERT INTO t VALUES (5314, 4, 15.66, 'name5314');
+INSERT INTO t VALUES (5315, 5, 94.85, 'name5315');
+INSERT INTO t VALUES (5316, 6, 74.04, 'name5316');
+INSERT INTO t VALUES (5317, 7, 53.23, 'name5317');
+INSERT INTO t VALUES (5318, 8, 32.42, 'name5318');
+INSERT INTO t VALUES (5319, 9, 11.61, 'name5319');
+INSERT INTO t VALUES (5320, 0, 90.80, 'name5320');
+INSERT INTO t VALUES (5321, 1, 69.99, 'name5321');
+INSERT INTO t VALUES (5322, 2, 49.18, 'name5322');
+INSERT INTO t VALUES (5323, 3, 28.37, 'name5323');
+INSERT INTO t VALUES (5324, 4, 7.56, 'name5324');
+INSERT INTO t VALUES (5325, 5, 86.75, 'name5325');
+INSERT INTO t VALUES (5326, 6, 65.94, 'name5326');
+INSERT INTO t VALUES (5327, 7, 45.13, 'name5327');
+INSERT INTO t VALUES (5328, 8, 24.32, 'name5328');
+INSERT INTO t VALUES (5329, 9, 3.51, 'name5329');
+INSERT INTO t VALUES (5330, 0, 82.70, 'name5330');
+INSERT INTO t VALUES (5331, 1, 61.89, 'name5331');
+INSERT INTO t VALUES (5332, 2, 41.08, 'name5332');
+INSERT INTO t VALUES (5333, 3, 20.27, 'name5333');
+INSERT INTO t VALUES (5334, 4, 99.46, 'name5334');
+INSERT INTO t VALUES (5335, 5, 78.65, 'name5335');
+INSERT INTO t VALUES (5336, 6, 57.84, 'name5336');
+INSERT INTO t VALUES (5337, 7, 37.03, 'name5337');
+INSERT INTO t VALUES (5338, 8, 16.22, 'name5338');
+INSERT INTO t VALUES (5339, 9, 95.41, 'name5339');
+INSERT INTO t VALUES (5340, 0, 74.60, 'name5340');
+INSERT INTO t VALUES (5341, 1, 53.79, 'name5341');
+INSERT INTO t VALUES (5342, 2, 32.98, 'name5342');
+INSERT INTO t VALUES (5343, 3, 12.17, 'name5343');
+INSERT INTO t VALUES (5344, 4, 91.36, 'name5344');
+INSERT INTO t VALUES (5345, 5, 70.55, 'name5345');
+INSERT INTO t VALUES (5346, 6, 49.74, 'name5346');
+INSERT INTO t VALUES (5347, 7, 28.93, 'name5347');
+INSERT INTO t VALUES (5348, 8, 8.12, 'name5348');
+INSERT INTO t VALUES (5349, 9, 87.31, 'name5349');
+INSERT INTO t VALUES (5350, 0, 66.50, 'name5350');
+INSERT INTO t VALUES (5351, 1, 45.69, 'name5351');
+INSERT INTO t VALUES (5352, 2, 24.88, 'name5352');
+INSERT INTO t VALUES (5353, 3, 4.07, 'name5353');
+INSERT INTO t VALUES (5354, 4, 83.26, 'name5354');
+INSERT INTO t VALUES (5355, 5, 62.45, 'name5355');
+INSERT INTO t VALUES (5356, 6, 41.64, 'name5356');
+INSERT INTO t VALUES (5357, 7, 20.83, 'name5357');
+INSERT INTO t VALUES (5358, 8, 0.02, 'name5358');
+INSERT INTO t VALUES (5359, 9, 79.21, 'name5359');
+INSERT INTO t VALUES (5360, 0, 58.40, 'name5360');
+INSERT INTO t VALUES (5361, 1, 37.59, 'name5361');
+INSERT INTO t VALUES (5362, 2, 16.78, 'name5362');
+INSERT INTO t VALUES (5363, 3, 95.97, 'name5363');
+INSERT INTO t VALUES (5364, 4, 75.16, 'name5364');
+INSERT INTO t VALUES (5365, 5, 54.35, 'name5365');
+INSERT INTO t VALUES (5366, 6, 33.54, 'name5366');
+INSERT INTO t VALUES (5367, 7, 12.73, 'name5367');
+INSERT INTO t VALUES (5368, 8, 91.92, 'name5368');
+INSERT INTO t VALUES (5369, 9, 71.11, 'name5369');
+INSERT INTO t VALUES (5370, 0, 50.30, 'name5370');
+INSERT INTO t VALUES (5371, 1, 29.49, 'name5371');
+INSERT INTO t VALUES (5372, 2, 8.68, 'name5372');
+INSERT INTO t VALUES (5373, 3, 87.87, 'name5373');
+INSERT INTO t VALUES (5374, 4, 67.06, 'name5374');
+INSERT INTO t VALUES (5375, 5, 46.25, 'name5375');
+INSERT INTO t VALUES (5376, 6, 25.44, 'name5376');
+INSERT INTO t VALUES (5377, 7, 4.63, 'name5377');
+INSERT INTO t VALUES (5378, 8, 83.82, 'name5378');
+INSERT INTO t VALUES (5379, 9, 63.01, 'name5379');
+INSERT INTO t VALUES (5380, 0, 42.20, 'name5380');
+INSERT INTO t VALUES (5381, 1, 21.39, 'name5381');
+INSERT INTO t VALUES (5382, 2, 0.58, 'name5382');
+INSERT INTO t VALUES (5383, 3, 79.77, 'name5383');
+INSERT INTO t VALUES (5384, 4, 58.96, 'name5384');
+INSERT INTO t VALUES (5385, 5, 38.15, 'name5385');
+INSERT INTO t VALUES (5386, 6, 17.34, 'name5386');
+INSERT INTO t VALUES (5387, 7, 96.53, 'name5387');
+INSERT INTO t VALUES (5388, 8, 75.72, 'name5388');
+INSERT INTO t VALUES (5389, 9, 54.91, 'name5389');
+INSERT INTO t VALUES (5390, 0, 34.10, 'name5390');
+INSERT INTO t VALUES (5391, 1, 13.29, 'name5391');
+INSERT INTO t VALUES (5392, 2, 92.48, 'name5392');
+INSERT INTO t VALUES (5393, 3, 71.67, 'name5393');
+INSERT INTO t VALUES (5394, 4, 50.86, 'name5394');
+INSERT INTO t VALUES (5395, 5, 30.05, 'name5395');
+INSERT INTO t VALUES (5396, 6, 9.24, 'name5396');
+INSERT INTO t VALUES (5397, 7, 88.43, 'name5397');
+INSERT INTO t VALUES (5398, 8, 67.62, 'name5398');
+INSERT INTO t VALUES (5399, 9, 46.81, 'name5399');
+INSERT INTO t VALUES (5400, 0, 26.00, 'name5400');
+INSERT INTO t VALUES (5401, 1, 5.19, 'name5401');
+INSERT INTO t VALUES (5402, 2, 84.38, 'name5402');
+INSERT INTO t VALUES (5403, 3, 63.57, 'name5403');
+INSERT INTO t VALUES (5404, 4, 42.76, 'name5404');
+INSERT INTO t VALUES (5405, 5, 21.95, 'name5405');
+INSERT INTO t VALUES (5406, 6, 1.14, 'name5406');
+INSERT INTO t VALUES (5407, 7, 80.33, 'name5407');
+INSERT INTO t VALUES (5408, 8, 59.52, 'name5408');
+INSERT INTO t VALUES (5409, 9, 38.71, 'name5409');
+INSERT INTO t VALUES (5410, 0, 17.90, 'name5410');
+INSERT INTO t VALUES (5411, 1, 97.09, 'name5411');
+INSERT INTO t VALUES (5412, 2, 76.28, 'name5412');
+INSERT INTO t VALUES (5413, 3, 55.47, 'name5413');
+INSERT INTO t VALUES (5414, 4, 34.66, 'name5414');
+INSERT INTO t VALUES (5415, 5, 13.85, 'name5415');
+INSERT INTO t VALUES (5416, 6, 93.04, 'name5416');
+INSERT INTO t VALUES (5417, 7, 72.23, 'name5417');
+INSERT INTO t VALUES (5418, 8, 51.42, 'name5418');
+INSERT INTO t VALUES (5419, 9, 30.61, 'name5419');
+INSERT INTO t VALUES (5420, 0, 9.80, 'name5420');
+INSERT INTO t VALUES (5421, 1, 88.99, 'name5421');
+INSERT INTO t VALUES (5422, 2, 68.18, 'name5422');
+INSERT INTO t VALUES (5423, 3, 47.37, 'name5423');
+INSERT INTO t VALUES (5424, 4, 26.56, 'name5424');
+INSERT INTO t VALUES (5425, 5, 5.75, 'name5425');
+INSERT INTO t VALUES (5426, 6, 84.94, 'name5426');
+INSERT INTO t VALUES (5427, 7, 64.13, 'name5427');
+INSERT INTO t VALUES (5428, 8, 43.32, 'name5428');
+INSERT INTO t VALUES (5429, 9, 22.51, 'name5429');
+INSERT INTO t VALUES (5430, 0, 1.70, 'name5430');
+INSERT INTO t VALUES (5431, 1, 80.89, 'name5431');
+INSERT INTO t VALUES (5432, 2, 60.08, 'name5432');
+INSERT INTO t VALUES (5433, 3, 39.27, 'name5433');
+INSERT INTO t VALUES (5434, 4, 18.46, 'name5434');
+INSERT INTO t VALUES (5435, 5, 97.65, 'name5435');
+INSERT INTO t VALUES (5436, 6, 76.84, 'name5436');
+INSERT INTO t VALUES (5437, 7, 56.03, 'name5437');
+INSERT INTO t VALUES (5438, 8, 35.22, 'name5438');
+INSERT INTO t VALUES (5439, 9, 14.41, 'name5439');
+INSERT INTO t VALUES (5440, 0, 93.60, 'name5440');
+INSERT INTO t VALUES (5441, 1, 72.79, 'name5441');
+INSERT INTO t VALUES (5442, 2, 51.98, 'name5442');
+INSERT INTO t VALUES (5443, 3, 31.17, 'name5443');
+INSERT INTO t VALUES (5444, 4, 10.36, 'name5444');
+INSERT INTO t VALUES (5445, 5, 89.55, 'name5445');
+INSERT INTO t VALUES (5446, 6, 68.74, 'name5446');
+INSERT INTO t VALUES (5447, 7, 47.93, 'name5447');
+INSERT INTO t VALUES (5448, 8, 27.12, 'name5448');
+INSERT INTO t VALUES (5449, 9, 6.31, 'name5449');
+INSERT INTO t VALUES (5450, 0, 85.50, 'name5450');
+INSERT INTO t VALUES (5451, 1, 64.69, 'name5451');
+INSERT INTO t VALUES (5452, 2, 43.88, 'name5452');
+INSERT INTO t VALUES (5453, 3, 23.07, 'name5453');
+INSERT INTO t VALUES (5454, 4, 2.26, 'name5454');
+INSERT INTO t VALUES (5455, 5, 81.45, 'name5455');
+INSERT INTO t VALUES (5456, 6, 60.64, 'name5456');
+INSERT INTO t VALUES (5457, 7, 39.83, 'name5457');
+INSERT INTO t VALUES (5458, 8, 19.02, 'name5458');
+INSERT INTO t VALUES (5459, 9, 98.21, 'name5459');
+INSERT INTO t VALUES (5460, 0, 77.40, 'name5460');
+INSERT INTO t VALUES (5461, 1, 56.59, 'name5461');
+INSERT INTO t VALUES (5462, 2, 35.78, 'name5462');
+INSERT INTO t VALUES (5463, 3, 14.97, 'name5463');
+INSERT INTO t VALUES (5464, 4, 94.16, 'name5464');
+INSERT INTO t VALUES (5465, 5, 73.35, 'name5465');
+INSERT INTO t VALUES (5466, 6, 52.54, 'name5466');
+INSERT INTO t VALUES (5467, 7, 31.73, 'name5467');
+INSERT INTO t VALUES (5468, 8, 10.92, 'name5468');
+INSERT INTO t VALUES (5469, 9, 90.11, 'name5469');
+INSERT INTO t VALUES (5470, 0, 69.30, 'name5470');
+INSERT INTO t VALUES (5471, 1, 48.49, 'name5471');
+INSERT INTO t VALUES (5472, 2, 27.68, 'name5472');
+INSERT INTO t VALUES (5473, 3, 6.87, 'name5473');
+INSERT INTO t VALUES (5474, 4, 86.06, 'name5474');
+INSERT INTO t VALUES (5475, 5, 65.25, 'name5475');
+INSERT INTO t VALUES (5476, 6, 44.44, 'name5476');
+INSERT INTO t VALUES (5477, 7, 23.63, 'name5477');
+INSERT INTO t VALUES (5478, 8, 2.82, 'name5478');
+INSERT INTO t VALUES (5479, 9, 82.01, 'name5479');
+INSERT INTO t VALUES (5480, 0, 61.20, 'name5480');
+INSERT INTO t VALUES (5481, 1, 40.39, 'name5481');
+INSERT INTO t VALUES (5482, 2, 19.58, 'name5482');
+INSERT INTO t VALUES (5483, 3, 98.77, 'name5483');
+INSERT INTO t VALUES (5484, 4, 77.96, 'name5484');
+INSERT INTO t VALUES (5485, 5, 57.15, 'name5485');
+INSERT INTO t VALUES (5486, 6, 36.34, 'name5486');
+INSERT INTO t VALUES (5487, 7, 15.53, 'name5487');
+INSERT INTO t VALUES (5488, 8, 94.72, 'name5488');
+INSERT INTO t VALUES (5489, 9, 73.91, 'name5489');
+INSERT INTO t VALUES (5490, 0, 53.10, 'name5490');
+INSERT INTO t VALUES (5491, 1, 32.29, 'name5491');
+INSERT INTO t VALUES (5492, 2, 11.48, 'name5492');
+INSERT INTO t VALUES (5493, 3, 90.67, 'name5493');
+INSERT INTO t VALUES (5494, 4, 69.86, 'name5494');
+INSERT INTO t VALUES (5495, 5, 49.05, 'name5495');
+INSERT INTO t VALUES (5496, 6, 28.24, 'name5496');
+INSERT INTO t VALUES (5497, 7, 7.43, 'name5497');
+INSERT INTO t VALUES (5498, 8, 86.62, 'name5498');
+INSERT INTO t VALUES (5499, 9, 65.81, 'name5499');
+INSERT INTO t VALUES (5500, 0, 45.00, 'name5500');
+INSERT INTO t VALUES (5501, 1, 24.19, 'name5501');
+INSERT INTO t VALUES (5502, 2, 3.38, 'name5502');
+INSERT INTO t VALUES (5503, 3, 82.57, 'name5503');
+INSERT INTO t VALUES (5504, 4, 61.76, 'name5504');
+INSERT INTO t VALUES (5505, 5, 40.95, 'name5505');
+INSERT INTO t VALUES (5506, 6, 20.14, 'name5506');
+INSERT INTO t VALUES (5507, 7, 99.33, 'name5507');
+INSERT INTO t VALUES (5508, 8, 78.52, 'name5508');
+INSERT INTO t VALUES (5509, 9, 57.71, 'name5509');
+INSERT INTO t VALUES (5510, 0, 36.90, 'name5510');
+INSERT INTO t VALUES (5511, 1, 16.09, 'name5511');
+INSERT INTO t VALUES (5512, 2, 95.28, 'name5512');
+INSERT INTO t VALUES (5513, 3, 74.47, 'name5513');
+INSERT INTO t VALUES (5514, 4, 53.66, 'name5514');
+INSERT INTO t VALUES (5515, 5, 32.85, 'name5515');
+INSERT INTO t VALUES (5516, 6, 12.04, 'name5516');
+INSERT INTO t VALUES (5517, 7, 91.23, 'name5517');
+INSERT INTO t VALUES (5518, 8, 70.42, 'name5518');
+INSERT INTO t VALUES (5519, 9, 49.61, 'name5519');
+INSERT INTO t VALUES (5520, 0, 28.80, 'name5520');
+INSERT INTO t VALUES (5521, 1, 7.99, 'name5521');
+INSERT INTO t VALUES (5522, 2, 87.18, 'name5522');
+INSERT INTO t VALUES (5523, 3, 66.37, 'name5523');
+INSERT INTO t VALUES (5524, 4, 45.56, 'name5524');
+INSERT INTO t VALUES (5525, 5, 24.75, 'name5525');
+INSERT INTO t VALUES (5526, 6, 3.94, 'name5526');
+INSERT INTO t VALUES (5527, 7, 83.13, 'name5527');
+INSERT INTO t VALUES (5528, 8, 62.32, 'name5528');
+INSERT INTO t VALUES (5529, 9, 41.51, 'name5529');
+INSERT INTO t VALUES (5530, 0, 20.70, 'name5530');
+INSERT INTO t VALUES (5531, 1, 99.89, 'name5531');
+INSERT INTO t VALUES (5532, 2, 79.08, 'name5532');
+INSERT INTO t VALUES (5533, 3, 58.27, 'name5533');
+INSERT INTO t VALUES (5534, 4, 37.46, 'name5534');
+INSERT INTO t VALUES (5535, 5, 16.65, 'name5535');
+INSERT INTO t VALUES (5536, 6, 95.84, 'name5536');
+INSERT INTO t VALUES (5537, 7, 75.03, 'name5537');
+INSERT INTO t VALUES (5538, 8, 54.22, 'name5538');
+INSERT INTO t VALUES (5539, 9, 33.41, 'name5539');
+INSERT INTO t VALUES (5540, 0, 12.60, 'name5540');
+INSERT INTO t VALUES (5541, 1, 91.79, 'name5541');
+INSERT INTO t VALUES (5542, 2, 70.98, 'name5542');
+INSERT INTO t VALUES (5543, 3, 50.17, 'name5543');
+INSERT INTO t VALUES (5544, 4, 29.36, 'name5544');
+INSERT INTO t VALUES (5545, 5, 8.55, 'name5545');
+INSERT INTO t VALUES (5546, 6, 87.74, 'name5546');
+INSERT INTO t VALUES (5547, 7, 66.93, 'name5547');
+INSERT INTO t VALUES (5548, 8, 46.12, 'name5548');
+INSERT INTO t VALUES (5549, 9, 25.31, 'name5549');
+INSERT INTO t VALUES (5550, 0, 4.50, 'name5550');
+INSERT INTO t VALUES (5551, 1, 83.69, 'name5551');
+INSERT INTO t VALUES (5552, 2, 62.88, 'name5552');
+INSERT INTO t VALUES (5553, 3, 42.07, 'name5553');
+INSERT INTO t VALUES (5554, 4, 21.26, 'name5554');
+INSERT INTO t VALUES (5555, 5, 0.45, 'name5555');
+INSERT INTO t VALUES (5556, 6, 79.64, 'name5556');
+INSERT INTO t VALUES (5557, 7, 58.83, 'name5557');
+INSERT INTO t VALUES (5558, 8, 38.02, 'name5558');
+INSERT INTO t VALUES (5559, 9, 17.21, 'name5559');
+INSERT INTO t VALUES (5560, 0, 96.40, 'name5560');
+INSERT INTO t VALUES (5561, 1, 75.59, 'name5561');
+INSERT INTO t VALUES (5562, 2, 54.78, 'name5562');
+INSERT INTO t VALUES (5563, 3, 33.97, 'name5563');
+INSERT INTO t VALUES (5564, 4, 13.16, 'name5564');
+INSERT INTO t VALUES (5565, 5, 92.35, 'name5565');
+INSERT INTO t VALUES (5566, 6, 71.54, 'name5566');
+INSERT INTO t VALUES (5567, 7, 50.73, 'name5567');
+INSERT INTO t VALUES (5568, 8, 29.92, 'name5568');
+INSERT INTO t VALUES (5569, 9, 9.11, 'name5569');
+INSERT INTO t VALUES (5570, 0, 88.30, 'name5570');
+INSERT INTO t VALUES (5571, 1, 67.49, 'name5571');
+INSERT INTO t VALUES (5572, 2, 46.68, 'name5572');
+INSERT INTO t VALUES (5573, 3, 25.87, 'name5573');
+INSERT INTO t VALUES (5574, 4, 5.06, 'name5574');
+INSERT INTO t VALUES (5575, 5, 84.25, 'name5575');
+INSERT INTO t VALUES (5576, 6, 63.44, 'name5576');
+INSERT INTO t VALUES (5577, 7, 42.63, 'name5577');
+INSERT INTO t VALUES (5578, 8, 21.82, 'name5578');
+INSERT INTO t VALUES (5579, 9, 1.01, 'name5579');
+INSERT INTO t VALUES (5580, 0, 80.20, 'name5580');
+INSERT INTO t VALUES (5581, 1, 59.39, 'name5581');
+INSERT INTO t VALUES (5582, 2, 38.58, 'name5582');
+INSERT INTO t VALUES (5583, 3, 17.77, 'name5583');
+INSERT INTO t VALUES (5584, 4, 96.96, 'name5584');
+INSERT INTO t VALUES (5585, 5, 76.15, 'name5585');
+INSERT INTO t VALUES (5586, 6, 55.34, 'name5586');
+INSERT INTO t VALUES (5587, 7, 34.53, 'name5587');
+INSERT INTO t VALUES (5588, 8, 13.72, 'name5588');
+INSERT INTO t VALUES (5589, 9, 92.91, 'name5589');
+INSERT INTO t VALUES (5590, 0, 72.10, 'name5590');
+INSERT INTO t VALUES (5591, 1, 51.29, 'name5591');
+INSERT INTO t VALUES (5592, 2, 30.48, 'name5592');
+INSERT INTO t VALUES (5593, 3, 9.67, 'name5593');
+INSERT INTO t VALUES (5594, 4, 88.86, 'name5594');
+INSERT INTO t VALUES (5595, 5, 68.05, 'name5595');
+INSERT INTO t VALUES (5596, 6, 47.24, 'name5596');
+INSERT INTO t VALUES (5597, 7, 26.43, 'name5597');
+INSERT INTO t VALUES (5598, 8, 5.62, 'name5598');
+INSERT INTO t VALUES (5599, 9, 84.81, 'name5599');
+INSERT INTO t VALUES (5600, 0, 64.00, 'name5600');
+INSERT INTO t VALUES (5601, 1, 43.19, 'name5601');
+INSERT INTO t VALUES (5602, 2, 22.38, 'name5602');
+INSERT INTO t VALUES (5603, 3, 1.57, 'name5603');
+INSERT INTO t VALUES (5604, 4, 80.76, 'name5604');
+INSERT INTO t VALUES (5605, 5, 59.95, 'name5605');
+INSERT INTO t VALUES (5606, 6, 39.14, 'name5606');
+INSERT INTO t VALUES (5607, 7, 18.33, 'name5607');
+INSERT INTO t VALUES (5608, 8, 97.52, 'name5608');
+INSERT INTO t VALUES (5609, 9, 76.71, 'name5609');
+INSERT INTO t VALUES (5610, 0, 55.90, 'name5610');
+INSERT INTO t VALUES (5611, 1, 35.09, 'name5611');
+INSERT INTO t VALUES (5612, 2, 14.28, 'name5612');
+INSERT INTO t VALUES (5613, 3, 93.47, 'name5613');
+INSERT INTO t VALUES (5614, 4, 72.66, 'name5614');
+INSERT INTO t VALUES (5615, 5, 51.85, 'name5615');
+INSERT INTO t VALUES (5616, 6, 31.04, 'name5616');
+INSERT INTO t VALUES (5617, 7, 10.23, 'name5617');
+INSERT INTO t VALUES (5618, 8, 89.42, 'name5618');
+INSERT INTO t VALUES (5619, 9, 68.61, 'name5619');
+INSERT INTO t VALUES (5620, 0, 47.80, 'name5620');
+INSERT INTO t VALUES (5621, 1, 26.99, 'name5621');
+INSERT INTO t VALUES (5622, 2, 6.18, 'name5622');
+INSERT INTO t VALUES (5623, 3, 85.37, 'name5623');
+INSERT INTO t VALUES (5624, 4, 64.56, 'name5624');
+INSERT INTO t VALUES (5625, 5, 43.75, 'name5625');
+INSERT INTO t VALUES (5626, 6, 22.94, 'name5626');
+INSERT INTO t VALUES (5627, 7, 2.13, 'name5627');
+INSERT INTO t VALUES (5628, 8, 81.32, 'name5628');
+INSERT INTO t VALUES (5629, 9, 60.51, 'name5629');
+INSERT INTO t VALUES (5630, 0, 39.70, 'name5630');
+INSERT INTO t VALUES (5631, 1, 18.89, 'name5631');
+INSERT INTO t VALUES (5632, 2, 98.08, 'name5632');
+INSERT INTO t VALUES (5633, 3, 77.27, 'name5633');
+INSERT INTO t VALUES (5634, 4, 56.46, 'name5634');
+INSERT INTO t VALUES (5635, 5, 35.65, 'name5635');
+INSERT INTO t VALUES (5636, 6, 14.84, 'name5636');
+INSERT INTO t VALUES (5637, 7, 94.03, 'name5637');
+INSERT INTO t VALUES (5638, 8, 73.22, 'name5638');
+INSERT INTO t VALUES (5639, 9, 52.41, 'name5639');
+INSERT INTO t VALUES (5640, 0, 31.60, 'name5640');
+INSERT INTO t VALUES (5641, 1, 10.79, 'name5641');
+INSERT INTO t VALUES (5642, 2, 89.98, 'name5642');
+INSERT INTO t VALUES (5643, 3, 69.17, 'name5643');
+INSERT INTO t VALUES (5644, 4, 48.36, 'name5644');
+INSERT INTO t VALUES (5645, 5, 27.55, 'name5645');
+INSERT INTO t VALUES (5646, 6, 6.74, 'name5646');
+INSERT INTO t VALUES (5647, 7, 85.93, 'name5647');
+INSERT INTO t VALUES (5648, 8, 65.12, 'name5648');
+INSERT INTO t VALUES (5649, 9, 44.31, 'name5649');
+INSERT INTO t VALUES (5650, 0, 23.50, 'name5650');
+INSERT INTO t VALUES (5651, 1, 2.69, 'name5651');
+INSERT INTO t VALUES (5652, 2, 81.88, 'name5652');
+INSERT INTO t VALUES (5653, 3, 61.07, 'name5653');
+INSERT INTO t VALUES (5654, 4, 40.26, 'name5654');
+INSERT INTO t VALUES (5655, 5, 19.45, 'name5655');
+INSERT INTO t VALUES (5656, 6, 98.64, 'name5656');
+INSERT INTO t VALUES (5657, 7, 77.83, 'name5657');
+INSERT INTO t VALUES (5658, 8, 57.02, 'name5658');
+INSERT INTO t VALUES (5659, 9, 36.21, 'name5659');
+INSERT INTO t VALUES (5660, 0, 15.40, 'name5660');
+INSERT INTO t VALUES (5661, 1, 94.59, 'name5661');
+INSERT INTO t VALUES (5662, 2, 73.78, 'name5662');
+INSERT INTO t VALUES (5663, 3, 52.97, 'name5663');
+INSERT INTO t VALUES (5664, 4, 32.16, 'name5664');
+INSERT INTO t VALUES (5665, 5, 11.35, 'name5665');
+INSERT INTO t VALUES (5666, 6, 90.54, 'name5666');
+INSERT INTO t VALUES (5667, 7, 69.73, 'name5667');
+INSERT INTO t VALUES (5668, 8, 48.92, 'name5668');
+INSERT INTO t VALUES (5669, 9, 28.11, 'name5669');
+INSERT INTO t VALUES (5670, 0, 7.30, 'name5670');
+INSERT INTO t VALUES (5671, 1, 86.49, 'name5671');
+INSERT INTO t VALUES (5672, 2, 65.68, 'name5672');
+INSERT INTO t VALUES (5673, 3, 44.87, 'name5673');
+INSERT INTO t VALUES (5674, 4, 24.06, 'name5674');
+INSERT INTO t VALUES (5675, 5, 3.25, 'name5675');
+INSERT INTO t VALUES (5676, 6, 82.44, 'name5676');
+INSERT INTO t VALUES (5677, 7, 61.63, 'name5677');
+INSERT INTO t VALUES (5678, 8, 40.82, 'name5678');
+INSERT INTO t VALUES (5679, 9, 20.01, 'name5679');
+INSERT INTO t VALUES (5680, 0, 99.20, 'name5680');
+INSERT INTO t VALUES (5681, 1, 78.39, 'name5681');
+INSERT INTO t VALUES (5682, 2, 57.58, 'name5682');
+INSERT INTO t VALUES (5683, 3, 36.77, 'name5683');
+INSERT INTO t VALUES (5684, 4, 15.96, 'name5684');
+INSERT INTO t VALUES (5685, 5, 95.15, 'name5685');
+INSERT INTO t VALUES (5686, 6, 74.34, 'name5686');
+INSERT INTO t VALUES (5687, 7, 53.53, 'name5687');
+INSERT INTO t VALUES (5688, 8, 32.72, 'name5688');
+INSERT INTO t VALUES (5689, 9, 11.91, 'name5689');
+INSERT INTO t VALUES (5690, 0, 91.10, 'name5690');
+INSERT INTO t VALUES (5691, 1, 70.29, 'name5691');
+INSERT INTO t VALUES (5692, 2, 49.48, 'name5692');
+INSERT INTO t VALUES (5693, 3, 28.67, 'name5693');
+INSERT INTO t VALUES (5694, 4, 7.86, 'name5694');
+INSERT INTO t VALUES (5695, 5, 87.05, 'name5695');
+INSERT INTO t VALUES (5696, 6, 66.24, 'name5696');
+INSERT INTO t VALUES (5697, 7, 45.43, 'name5697');
+INSERT INTO t VALUES (5698, 8, 24.62, 'name5698');
+INSERT INTO t VALUES (5699, 9, 3.81, 'name5699');
+INSERT INTO t VALUES (5700, 0, 83.00, 'name5700');
+INSERT INTO t VALUES (5701, 1, 62.19, 'name5701');
+INSERT INTO t VALUES (5702, 2, 41.38, 'name5702');
+INSERT INTO t VALUES (5703, 3, 20.57, 'name5703');
+INSERT INTO t VALUES (5704, 4, 99.76, 'name5704');
+INSERT INTO t VALUES (5705, 5, 78.95, 'name5705');
+INSERT INTO t VALUES (5706, 6, 58.14, 'name5706');
+INSERT INTO t VALUES (5707, 7, 37.33, 'name5707');
+INSERT INTO t VALUES (5708, 8, 16.52, 'name5708');
+INSERT INTO t VALUES (5709, 9, 95.71, 'name5709');
+INSERT INTO t VALUES (5710, 0, 74.90, 'name5710');
+INSERT INTO t VALUES (5711, 1, 54.09, 'name5711');
+INSERT INTO t VALUES (5712, 2, 33.28, 'name5712');
+INSERT INTO t VALUES (5713, 3, 12.47, 'name5713');
+INSERT INTO t VALUES (5714, 4, 91.66, 'name5714');
+INSERT INTO t VALUES (5715, 5, 70.85, 'name5715');
+INSERT INTO t VALUES (5716, 6, 50.04, 'name5716');
+INSERT INTO t VALUES (5717, 7, 29.23, 'name5717');
+INSERT INTO t VALUES (5718, 8, 8.42, 'name5718');
+INSERT INTO t VALUES (5719, 9, 87.61, 'name5719');
+INSERT INTO t VALUES (5720, 0, 66.80, 'name5720');
+INSERT INTO t VALUES (5721, 1, 45.99, 'name5721');
+INSERT INTO t VALUES (5722, 2, 25.18, 'name5722');
+INSERT INTO t VALUES (5723, 3, 4.37, 'name5723');
+INSERT INTO t VALUES (5724, 4, 83.56, 'name5724');
+INSERT INTO t VALUES (5725, 5, 62.75, 'name5725');
+INSERT INTO t VALUES (5726, 6, 41.94, 'name5726');
+INSERT INTO t VALUES (5727, 7, 21.13, 'name5727');
+INSERT INTO t VALUES (5728, 8, 0.32, 'name5728');
+INSERT INTO t VALUES (5729, 9, 79.51, 'name5729');
+INSERT INTO t VALUES (5730, 0, 58.70, 'name5730');
+INSERT INTO t VALUES (5731, 1, 37.89, 'name5731');
+INSERT INTO t VALUES (5732, 2, 17.08, 'name5732');
+INSERT INTO t VALUES (5733, 3, 96.27, 'name5733');
+INSERT INTO t VALUES (5734, 4, 75.46, 'name5734');
+INSERT INTO t VALUES (5735, 5, 54.65, 'name5735');
+INSERT INTO t VALUES (5736, 6, 33.84, 'name5736');
+INSERT INTO t VALUES (5737, 7, 13.03, 'name5737');
+INSERT INTO t VALUES (5738, 8, 92.22, 'name5738');
+INSERT INTO t VALUES (5739, 9, 71.41, 'name5739');
+INSERT INTO t VALUES (5740, 0, 50.60, 'name5740');
+INSERT INTO t VALUES (5741, 1, 29.79, 'name5741');
+INSERT INTO t VALUES (5742, 2, 8.98, 'name5742');
+INSERT INTO t VALUES (5743, 3, 88.17, 'name5743');
+INSERT INTO t VALUES (5744, 4, 67.36, 'name5744');
+INSERT INTO t VALUES (5745, 5, 46.55, 'name5745');
+INSERT INTO t VALUES (5746, 6, 25.74, 'name5746');
+INSERT INTO t VALUES (5747, 7, 4.93, 'name5747');
+INSERT INTO t VALUES (5748, 8, 84.12, 'name5748');
+INSERT INTO t VALUES (5749, 9, 63.31, 'name5749');
+INSERT INTO t VALUES (5750, 0, 42.50, 'name5750');
+INSERT INTO t VALUES (5751, 1, 21.69, 'name5751');
+INSERT INTO t VALUES (5752, 2, 0.88, 'name5752');
+INSERT INTO t VALUES (5753, 3, 80.07, 'name5753');
+INSERT INTO t VALUES (5754, 4, 59.26, 'name5754');
+INSERT INTO t VALUES (5755, 5, 38.45, 'name5755');
+INSERT INTO t VALUES (5756, 6, 17.64, 'name5756');
+INSERT INTO t VALUES (5757, 7, 96.83, 'name5757');
+INSERT INTO t VALUES (5758, 8, 76.02, 'name5758');
+INSERT INTO t VALUES (5759, 9, 55.21, 'name5759');
+INSERT INTO t VALUES (5760, 0, 34.40, 'name5760');
+INSERT INTO t VALUES (5761, 1, 13.59, 'name5761');
+INSERT INTO t VALUES (5762, 2, 92.78, 'name5762');
+INSERT INTO t VALUES (5763, 3, 71.97, 'name5763');
+INSERT INTO t VALUES (5764, 4, 51.16, 'name5764');
+INSERT INTO t VALUES (5765, 5, 30.35, 'name5765');
+INSERT INTO t VALUES (5766, 6, 9.54, 'name5766');
+INSERT INTO t VALUES (5767, 7, 88.73, 'name5767');
+INSERT INTO t VALUES (5768, 8, 67.92, 'name5768');
+INSERT INTO t VALUES (5769, 9, 47.11, 'name5769');
+INSERT INTO t VALUES (5770, 0, 26.30, 'name5770');
+INSERT INTO t VALUES (5771, 1, 5.49, 'name5771');
+INSERT INTO t VALUES (5772, 2, 84.68, 'name5772');
+INSERT INTO t VALUES (5773, 3, 63.87, 'name5773');
+INSERT INTO t VALUES (5774, 4, 43.06, 'name5774');
+INSERT INTO t VALUES (5775, 5, 22.25, 'name5775');
+INSERT INTO t VALUES (5776, 6, 1.44, 'name5776');
+INSERT INTO t VALUES (5777, 7, 80.63, 'name5777');
+INSERT INTO t VALUES (5778, 8, 59.82, 'name5778');
+INSERT INTO t VALUES (5779, 9, 39.01, 'name5779');
+INSERT INTO t VALUES (5780, 0, 18.20, 'name5780');
+INSERT INTO t VALUES (5781, 1, 97.39, 'name5781');
+INSERT INTO t VALUES (5782, 2, 76.58, 'name5782');
+INSERT INTO t VALUES (5783, 3, 55.77, 'name5783');
+INSERT INTO t VALUES (5784, 4, 34.96, 'name5784');
+INSERT INTO t VALUES (5785, 5, 14.15, 'name5785');
+INSERT INTO t VALUES (5786, 6, 93.34, 'name5786');
+INSERT INTO t VALUES (5787, 7, 72.53, 'name5787');
+INSERT INTO t VALUES (5788, 8, 51.72, 'name5788');
+INSERT INTO t VALUES (5789, 9, 30.91, 'name5789');
+INSERT INTO t VALUES (5790, 0, 10.10, 'name5790');
+INSERT INTO t VALUES (5791, 1, 89.29, 'name5791');
+INSERT INTO t VALUES (5792, 2, 68.48, 'name5792');
+INSERT INTO t VALUES (5793, 3, 47.67, 'name5793');
+INSERT INTO t VALUES (5794, 4, 26.86, 'name5794');
+INSERT INTO t VALUES (5795, 5, 6.05, 'name5795');
+INSERT INTO t VALUES (5796, 6, 85.24, 'name5796');
+INSERT INTO t VALUES (5797, 7, 64.43, 'name5797');
+INSERT INTO t VALUES (5798, 8, 43.62, 'name5798');
+INSERT INTO t VALUES (5799, 9, 22.81, 'name5799');
+INSERT INTO t VALUES (5800, 0, 2.00, 'name5800');
+INSERT INTO t VALUES (5801, 1, 81.19, 'name5801');
+INSERT INTO t VALUES (5802, 2, 60.38, 'name5802');
+INSERT INTO t VALUES (5803, 3, 39.57, 'name5803');
+INSERT INTO t VALUES (5804, 4, 18.76, 'name5804');
+INSERT INTO t VALUES (5805, 5, 97.95, 'name5805');
+INSERT INTO t VALUES (5806, 6, 77.14, 'name5806');
+INSERT INTO t VALUES (5807, 7, 56.33, 'name5807');
+INSERT INTO t VALUES (5808, 8, 35.52, 'name5808');
+INSERT INTO t VALUES (5809, 9, 14.71, 'name5809');
+INSERT INTO t VALUES (5810, 0, 93.90, 'name5810');
+INSERT INTO t VALUES (5811, 1, 73.09, 'name5811');
+INSERT INTO t VALUES (5812, 2, 52.28, 'name5812');
+INSERT INTO t VALUES (5813, 3, 31.47, 'name5813');
+INSERT INTO t VALUES (5814, 4, 10.66, 'name5814');
+INSERT INTO t VALUES (5815, 5, 89.85, 'name5815');
+INSERT INTO t VALUES (5816, 6, 69.04, 'name5816');
+INSERT INTO t VALUES (5817, 7, 48.23, 'name5817');
+INSERT INTO t VALUES (5818, 8, 27.42, 'name5818');
+INSERT INTO t VALUES (5819, 9, 6.61, 'name5819');
+INSERT INTO t VALUES (5820, 0, 85.80, 'name5820');
+INSERT INTO t VALUES (5821, 1, 64.99, 'name5821');
+INSERT INTO t VALUES (5822, 2, 44.18, 'name5822');
+INSERT INTO t VALUES (5823, 3, 23.37, 'name5823');
+INSERT INTO t VALUES (5824, 4, 2.56, 'name5824');
+INSERT INTO t VALUES (5825, 5, 81.75, 'name5825');
+INSERT INTO t VALUES (5826, 6, 60.94, 'name5826');
+INSERT INTO t VALUES (5827, 7, 40.13, 'name5827');
+INSERT INTO t VALUES (5828, 8, 19.32, 'name5828');
+INSERT INTO t VALUES (5829, 9, 98.51, 'name5829');
+INSERT INTO t VALUES (5830, 0, 77.70, 'name5830');
+INSERT INTO t VALUES (5831, 1, 56.89, 'name5831');
+INSERT INTO t VALUES (5832, 2, 36.08, 'name5832');
+INSERT INTO t VALUES (5833, 3, 15.27, 'name5833');
+INSERT INTO t VALUES (5834, 4, 94.46, 'name5834');
+INSERT INTO t VALUES (5835, 5, 73.65, 'name5835');
+INSERT INTO t VALUES (5836, 6, 52.84, 'name5836');
+INSERT INTO t VALUES (5837, 7, 32.03, 'name5837');
+INSERT INTO t VALUES (5838, 8, 11.22, 'name5838');
+INSERT INTO t VALUES (5839, 9, 90.41, 'name5839');
+INSERT INTO t VALUES (5840, 0, 69.60, 'name5840');
+INSERT INTO t VALUES (5841, 1, 48.79, 'name5841');
+INSERT INTO t VALUES (5842, 2, 27.98, 'name5842');
+INSERT INTO t VALUES (5843, 3, 7.17, 'name5843');
+INSERT INTO t VALUES (5844, 4, 86.36, 'name5844');
+INSERT INTO t VALUES (5845, 5, 65.55, 'name5845');
+INSERT INTO t VALUES (5846, 6, 44.74, 'name5846');
+INSERT INTO t VALUES (5847, 7, 23.93, 'name5847');
+INSERT INTO t VALUES (5848, 8, 3.12, 'name5848');
+INSERT INTO t VALUES (5849, 9, 82.31, 'name5849');
+INSERT INTO t VALUES (5850, 0, 61.50, 'name5850');
+INSERT INTO t VALUES (5851, 1, 40.69, 'name5851');
+INSERT INTO t VALUES (5852, 2, 19.88, 'name5852');
+INSERT INTO t VALUES (5853, 3, 99.07, 'name5853');
+INSERT INTO t VALUES (5854, 4, 78.26, 'name5854');
+INSERT INTO t VALUES (5855, 5, 57.45, 'name5855');
+INSERT INTO t VALUES (5856, 6, 36.64, 'name5856');
+INSERT INTO t VALUES (5857, 7, 15.83, 'name5857');
+INSERT INTO t VALUES (5858, 8, 95.02, 'name5858');
+INSERT INTO t VALUES (5859, 9, 74.21, 'name5859');
+INSERT INTO t VALUES (5860, 0, 53.40, 'name5860');
+INSERT INTO t VALUES (5861, 1, 32.59, 'name5861');
+INSERT INTO t VALUES (5862, 2, 11.78, 'name5862');
+INSERT INTO t VALUES (5863, 3, 90.97, 'name5863');
+INSERT INTO t VALUES (5864, 4, 70.16, 'name5864');
+INSERT INTO t VALUES (5865, 5, 49.35, 'name5865');
+INSERT INTO t VALUES (5866, 6, 28.54, 'name5866');
+INSERT INTO t VALUES (5867, 7, 7.73, 'name5867');
+INSERT INTO t VALUES (5868, 8, 86.92, 'name5868');
+INSERT INTO t VALUES (5869, 9, 66.11, 'name5869');
+INSERT INTO t VALUES (5870, 0, 45.30, 'name5870');
+INSERT INTO t VALUES (5871, 1, 24.49, 'name5871');
+INSERT INTO t VALUES (5872, 2, 3.68, 'name5872');
+INSERT INTO t VALUES (5873, 3, 82.87, 'name5873');
+INSERT INTO t VALUES (5874, 4, 62.06, 'name5874');
+INSERT INTO t VALUES (5875, 5, 41.25, 'name5875');
+INSERT INTO t VALUES (5876, 6, 20.44, 'name5876');
+INSERT INTO t VALUES (5877, 7, 99.63, 'name5877');
+INSERT INTO t VALUES (5878, 8, 78.82, 'name5878');
+INSERT INTO t VALUES (5879, 9, 58.01, 'name5879');
+INSERT INTO t VALUES (5880, 0, 37.20, 'name5880');
+INSERT INTO t VALUES (5881, 1, 16.39, 'name5881');
+INSERT INTO t VALUES (5882, 2, 95.58, 'name5882');
+INSERT INTO t VALUES (5883, 3, 74.77, 'name5883');
+INSERT INTO t VALUES (5884, 4, 53.96, 'name5884');
+INSERT INTO t VALUES (5885, 5, 33.15, 'name5885');
+INSERT INTO t VALUES (5886, 6, 12.34, 'name5886');
+INSERT INTO t VALUES (5887, 7, 91.53, 'name5887');
+INSERT INTO t VALUES (5888, 8, 70.72, 'name5888');
+INSERT INTO t VALUES (5889, 9, 49.91, 'name5889');
+INSERT INTO t VALUES (5890, 0, 29.10, 'name5890');
+INSERT INTO t VALUES (5891, 1, 8.29, 'name5891');
+INSERT INTO t VALUES (5892, 2, 87.48, 'name5892');
+INSERT INTO t VALUES (5893, 3, 66.67, 'name5893');
+INSERT INTO t VALUES (5894, 4, 45.86, 'name5894');
+INSERT INTO t VALUES (5895, 5, 25.05, 'name5895');
+INSERT INTO t VALUES (5896, 6, 4.24, 'name5896');
+INSERT INTO t VALUES (5897, 7, 83.43, 'name5897');
+INSERT INTO t VALUES (5898, 8, 62.62, 'name5898');
+INSERT INTO t VALUES (5899, 9, 41.81, 'name5899');
+INSERT INTO t VALUES (5900, 0, 21.00, 'name5900');
+INSERT INTO t VALUES (5901, 1, 0.19, 'name5901');
+INSERT INTO t VALUES (5902, 2, 79.38, 'name5902');
+INSERT INTO t VALUES (5903, 3, 58.57, 'name5903');
+INSERT INTO t VALUES (5904, 4, 37.76, 'name5904');
+INSERT INTO t VALUES (5905, 5, 16.95, 'name5905');
+INSERT INTO t VALUES (5906, 6, 96.14, 'name5906');
+INSERT INTO t VALUES (5907, 7, 75.33, 'name5907');
+INSERT INTO t VALUES (5908, 8, 54.52, 'name5908');
+INSERT INTO t VALUES (5909, 9, 33.71, 'name5909');
+INSERT INTO t VALUES (5910, 0, 12.90, 'name5910');
+INSERT INTO t VALUES (5911, 1, 92.09, 'name5911');
+INSERT INTO t VALUES (5912, 2, 71.28, 'name5912');
+INSERT INTO t VALUES (5913, 3, 50.47, 'name5913');
+INSERT INTO t VALUES (5914, 4, 29.66, 'name5914');
+INSERT INTO t VALUES (5915, 5, 8.85, 'name5915');
+INSERT INTO t VALUES (5916, 6, 88.04, 'name5916');
+INSERT INTO t VALUES (5917, 7, 67.23, 'name5917');
+INSERT INTO t VALUES (5918, 8, 46.42, 'name5918');
+INSERT INTO t VALUES (5919, 9, 25.61, 'name5919');
+INSERT INTO t VALUES (5920, 0, 4.80, 'name5920');
+INSERT INTO t VALUES (5921, 1, 83.99, 'name5921');
+INSERT INTO t VALUES (5922, 2, 63.18, 'name5922');
+INSERT INTO t VALUES (5923, 3, 42.37, 'name5923');
+INSERT INTO t VALUES (5924, 4, 21.56, 'name5924');
+INSERT INTO t VALUES (5925, 5, 0.75, 'name5925');
+INSERT INTO t VALUES (5926, 6, 79.94, 'name5926');
+INSERT INTO t VALUES (5927, 7, 59.13, 'name5927');
+INSERT INTO t VALUES (5928, 8, 38.32, 'name5928');
+INSERT INTO t VALUES (5929, 9, 17.51, 'name5929');
+INSERT INTO t VALUES (5930, 0, 96.70, 'name5930');
+INSERT INTO t VALUES (5931, 1, 75.89, 'name5931');
+INSERT INTO t VALUES (5932, 2, 55.08, 'name5932');
+INSERT INTO t VALUES (5933, 3, 34.27, 'name5933');
+INSERT INTO t VALUES (5934, 4, 13.46, 'name5934');
+INSERT INTO t VALUES (5935, 5, 92.65, 'name5935');
+INSERT INTO t VALUES (5936, 6, 71.84, 'name5936');
+INSERT INTO t VALUES (5937, 7, 51.03, 'name5937');
+INSERT INTO t VALUES (5938, 8, 30.22, 'name5938');
+INSERT INTO t VALUES (5939, 9, 9.41, 'name5939');
+INSERT INTO t VALUES (5940, 0, 88.60, 'name5940');
+INSERT INTO t VALUES (5941, 1, 67.79, 'name5941');
+INSERT INTO t VALUES (5942, 2, 46.98, 'name5942');
+INSERT INTO t VALUES (5943, 3, 26.17, 'name5943');
+INSERT INTO t VALUES (5944, 4, 5.36, 'name5944');
+INSERT INTO t VALUES (5945, 5, 84.55, 'name5945');
+INSERT INTO t VALUES (5946, 6, 63.74, 'name5946');
+INSERT INTO t VALUES (5947, 7, 42.93, 'name5947');
+INSERT INTO t VALUES (5948, 8, 22.12, 'name5948');
+INSERT INTO t VALUES (5949, 9, 1.31, 'name5949');
+INSERT INTO t VALUES (5950, 0, 80.50, 'name5950');
+INSERT INTO t VALUES (5951, 1, 59.69, 'name5951');
+INSERT INTO t VALUES (5952, 2, 38.88, 'name5952');
+INSERT INTO t VALUES (5953, 3, 18.07, 'name5953');
+INSERT INTO t VALUES (5954, 4, 97.26, 'name5954');
+INSERT INTO t VALUES (5955, 5, 76.45, 'name5955');
+INSERT INTO t VALUES (5956, 6, 55.64, 'name5956');
+INSERT INTO t VALUES (5957, 7, 34.83, 'name5957');
+INSERT INTO t VALUES (5958, 8, 14.02, 'name5958');
+INSERT INTO t VALUES (5959, 9, 93.21, 'name5959');
+INSERT INTO t VALUES (5960, 0, 72.40, 'name5960');
+INSERT INTO t VALUES (5961, 1, 51.59, 'name5961');
+INSERT INTO t VALUES (5962, 2, 30.78, 'name5962');
+INSERT INTO t VALUES (5963, 3, 9.97, 'name5963');
+INSERT INTO t VALUES (5964, 4, 89.16, 'name5964');
+INSERT INTO t VALUES (5965, 5, 68.35, 'name5965');
+INSERT INTO t VALUES (5966, 6, 47.54, 'name5966');
+INSERT INTO t VALUES (5967, 7, 26.73, 'name5967');
+INSERT INTO t VALUES (5968, 8, 5.92, 'name5968');
+INSERT INTO t VALUES (5969, 9, 85.11, 'name5969');
+INSERT INTO t VALUES (5970, 0, 64.30, 'name5970');
+INSERT INTO t VALUES (5971, 1, 43.49, 'name5971');
+INSERT INTO t VALUES (5972, 2, 22.68, 'name5972');
+INSERT INTO t VALUES (5973, 3, 1.87, 'name5973');
+INSERT INTO t VALUES (5974, 4, 81.06, 'name5974');
+INSERT INTO t VALUES (5975, 5, 60.25, 'name5975');
+INSERT INTO t VALUES (5976, 6, 39.44, 'name5976');
+INSERT INTO t VALUES (5977, 7, 18.63, 'name5977');
+INSERT INTO t VALUES (5978, 8, 97.82, 'name5978');
+INSERT INTO t VALUES (5979, 9, 77.01, 'name5979');
+INSERT INTO t VALUES (5980, 0, 56.20, 'name5980');
+INSERT INTO t VALUES (5981, 1, 35.39, 'name5981');
+INSERT INTO t VALUES (5982, 2, 14.58, 'name5982');
+INSERT INTO t VALUES (5983, 3, 93.77, 'name5983');
+INSERT INTO t VALUES (5984, 4, 72.96, 'name5984');
+INSERT INTO t VALUES (5985, 5, 52.15, 'name5985');
+INSERT INTO t VALUES (5986, 6, 31.34, 'name5986');
+INSERT INTO t VALUES (5987, 7, 10.53, 'name5987');
+INSERT INTO t VALUES (5988, 8, 89.72, 'name5988');
+INSERT INTO t VALUES (5989, 9, 68.91, 'name5989');
+INSERT INTO t VALUES (5990, 0, 48.10, 'name5990');
+INSERT INTO t VALUES (5991, 1, 27.29, 'name5991');
+INSERT INTO t VALUES (5992, 2, 6.48, 'name5992');
+INSERT INTO t VALUES (5993, 3, 85.67, 'name5993');
+INSERT INTO t VALUES (5994, 4, 64.86, 'name5994');
+INSERT INTO t VALUES (5995, 5, 44.05, 'name5995');
+INSERT INTO t VALUES (5996, 6, 23.24, 'name5996');
+INSERT INTO t VALUES (5997, 7, 2.43, 'name5997');
+INSERT INTO t VALUES (5998, 8, 81.62, 'name5998');
+INSERT INTO t VALUES (5999, 9, 60.81, 'name5999');
+INSERT INTO t VALUES (6000, 0, 40.00, 'name6000');
+INSERT INTO t VALUES (6001, 1, 19.19, 'name6001');
+INSERT INTO t VALUES (6002, 2, 98.38, 'name6002');
+INSERT INTO t VALUES (6003, 3, 77.57, 'name6003');
+INSERT INTO t VALUES (6004, 4, 56.76, 'name6004');
+INSERT INTO t VALUES (6005, 5, 35.95, 'name6005');
+INSERT INTO t VALUES (6006, 6, 15.14, 'name6006');
+INSERT INTO t VALUES (6007, 7, 94.33, 'name6007');
+INSERT INTO t VALUES (6008, 8, 73.52, 'name6008');
+INSERT INTO t VALUES (6009, 9, 52.71, 'name6009');
+INSERT INTO t VALUES (6010, 0, 31.90, 'name6010');
+INSERT INTO t VALUES (6011, 1, 11.09, 'name6011');
+INSERT INTO t VALUES (6012, 2, 90.28, 'name6012');
+INSERT INTO t VALUES (6013, 3, 69.47, 'name6013');
+INSERT INTO t VALUES (6014, 4, 48.66, 'name6014');
+INSERT INTO t VALUES (6015, 5, 27.85, 'name6015');
+INSERT INTO t VALUES (6016, 6, 7.04, 'name6016');
+INSERT INTO t VALUES (6017, 7, 86.23, 'name6017');
+INSERT INTO t VALUES (6018, 8, 65.42, 'name6018');
+INSERT INTO t VALUES (6019, 9, 44.61, 'name6019');
+INSERT INTO t VALUES (6020, 0, 23.80, 'name6020');
+INSERT INTO t VALUES (6021, 1, 2.99, 'name6021');
+INSERT INTO t VALUES (6022, 2, 82.18, 'name6022');
+INSERT INTO t VALUES (6023, 3, 61.37, 'name6023');
+INSERT INTO t VALUES (6024, 4, 40.56, 'name6024');
+INSERT INTO t VALUES (6025, 5, 19.75, 'name6025');
+INSERT INTO t VALUES (6026, 6, 98.94, 'name6026');
+INSERT INTO t VALUES (6027, 7, 78.13, 'name6027');
+INSERT INTO t VALUES (6028, 8, 57.32, 'name6028');
+INSERT INTO t VALUES (6029, 9, 36.51, 'name6029');
+INSERT INTO t VALUES (6030, 0, 15.70, 'name6030');
+INSERT INTO t VALUES (6031, 1, 94.89, 'name6031');
+INSERT INTO t VALUES (6032, 2, 74.08, 'name6032');
+INSERT INTO t VALUES (6033, 3, 53.27, 'name6033');
+INSERT INTO t VALUES (6034, 4, 32.46, 'name6034');
+INSERT INTO t VALUES (6035, 5, 11.65, 'name6035');
+INSERT INTO t VALUES (6036, 6, 90.84, 'name6036');
+INSERT INTO t VALUES (6037, 7, 70.03, 'name6037');
+INSERT INTO t VALUES (6038, 8, 49.22, 'name6038');
+INSERT INTO t VALUES (6039, 9, 28.41, 'name6039');
+INSERT INTO t VALUES (6040, 0, 7.60, 'name6040');
+INSERT INTO t VALUES (6041, 1, 86.79, 'name6041');
+INSERT INTO t VALUES (6042, 2, 65.98, 'name6042');
+INSERT INTO t VALUES (6043, 3, 45.17, 'name6043');
+INSERT INTO t VALUES (6044, 4, 24.36, 'name6044');
+INSERT INTO t VALUES (6045, 5, 3.55, 'name6045');
+INSERT INTO t VALUES (6046, 6, 82.74, 'name6046');
+INSERT INTO t VALUES (6047, 7, 61.93, 'name6047');
+INSERT INTO t VALUES (6048, 8, 41.12, 'name6048');
+INSERT INTO t VALUES (6049, 9, 20.31, 'name6049');
+INSERT INTO t VALUES (6050, 0, 99.50, 'name6050');
+INSERT INTO t VALUES (6051, 1, 78.69, 'name6051');
+INSERT INTO t VALUES (6052, 2, 57.88, 'name6052');
+INSERT INTO t VALUES (6053, 3, 37.07, 'name6053');
+INSERT INTO t VALUES (6054, 4, 16.26, 'name6054');
+INSERT INTO t VALUES (6055, 5, 95.45, 'name6055');
+INSERT INTO t VALUES (6056, 6, 74.64, 'name6056');
+INSERT INTO t VALUES (6057, 7, 53.83, 'name6057');
+INSERT INTO t VALUES (6058, 8, 33.02, 'name6058');
+INSERT INTO t VALUES (6059, 9, 12.21, 'name6059');
+INSERT INTO t VALUES (6060, 0, 91.40, 'name6060');
+INSERT INTO t VALUES (6061, 1, 70.59, 'name6061');
+INSERT INTO t VALUES (6062, 2, 49.78, 'name6062');
+INSERT INTO t VALUES (6063, 3, 28.97, 'name6063');
+INSERT INTO t VALUES (6064, 4, 8.16, 'name6064');
+INSERT INTO t VALUES (6065, 5, 87.35, 'name6065');
+INSERT INTO t VALUES (6066, 6, 66.54, 'name6066');
+INSERT INTO t VALUES (6067, 7, 45.73, 'name6067');
+INSERT INTO t VALUES (6068, 8, 24.92, 'name6068');
+INSERT INTO t VALUES (6069, 9, 4.11, 'name6069');
+INSERT INTO t VALUES (6070, 0, 83.30, 'name6070');
+INSERT INTO t VALUES (6071, 1, 62.49, 'name6071');
+INSERT INTO t VALUES (6072, 2, 41.68, 'name6072');
+INSERT INTO t VALUES (6073, 3, 20.87, 'name6073');
+INSERT INTO t VALUES (6074, 4, 0.06, 'name6074');
+INSERT INTO t VALUES (6075, 5, 79.25, 'name6075');
+INSERT INTO t VALUES (6076, 6, 58.44, 'name6076');
+INSERT INTO t VALUES (6077, 7, 37.63, 'name6077');
+INSERT INTO t VALUES (6078, 8, 16.82, 'name6078');
+INSERT INTO t VALUES (6079, 9, 96.01, 'name6079');
+INSERT INTO t VALUES (6080, 0, 75.20, 'name6080');
+INSERT INTO t VALUES (6081, 1, 54.39, 'name6081');
+INSERT INTO t VALUES (6082, 2, 33.58, 'name6082');
+INSERT INTO t VALUES (6083, 3, 12.77, 'name6083');
+INSERT INTO t VALUES (6084, 4, 91.96, 'name6084');
+INSERT INTO t VALUES (6085, 5, 71.15, 'name6085');
+INSERT INTO t VALUES (6086, 6, 50.34, 'name6086');
+INSERT INTO t VALUES (6087, 7, 29.53, 'name6087');
+INSERT INTO t VALUES (6088, 8, 8.72, 'name6088');
+INSERT INTO t VALUES (6089, 9, 87.91, 'name6089');
+INSERT INTO t VALUES (6090, 0, 67.10, 'name6090');
+INSERT INTO t VALUES (6091, 1, 46.29, 'name6091');
+INSERT INTO t VALUES (6092, 2, 25.48, 'name6092');
+INSERT INTO t VALUES (6093, 3, 4.67, 'name6093');
+INSERT INTO t VALUES (6094, 4, 83.86, 'name6094');
+INSERT INTO t VALUES (6095, 5, 63.05, 'name6095');
+INSERT INTO t VALUES (6096, 6, 42.24, 'name6096');
+INSERT INTO t VALUES (6097, 7, 21.43, 'name6097');
+INSERT INTO t VALUES (6098, 8, 0.62, 'name6098');
+INSERT INTO t VALUES (6099, 9, 79.81, 'name6099');
+INSERT INTO t VALUES (6100, 0, 59.00, 'name6100');
+INSERT INTO t VALUES (6101, 1, 38.19, 'name6101');
+INSERT INTO t VALUES (6102, 2, 17.38, 'name6102');
+INSERT INTO t VALUES (6103, 3, 96.57, 'name6103');
+INSERT INTO t VALUES (6104, 4, 75.76, 'name6104');
+INSERT INTO t VALUES (6105, 5, 54.95, 'name6105');
+INSERT INTO t VALUES (6106, 6, 34.14, 'name6106');
+INSERT INTO t VALUES (6107, 7, 13.33, 'name6107');
+INSERT INTO t VALUES (6108, 8, 92.52, 'name6108');
+INSERT INTO t VALUES (6109, 9, 71.71, 'name6109');
+INSERT INTO t VALUES (6110, 0, 50.90, 'name6110');
+INSERT INTO t VALUES (6111, 1, 30.09, 'name6111');
+INSERT INTO t VALUES (6112, 2, 9.28, 'name6112');
+INSERT INTO t VALUES (6113, 3, 88.47, 'name6113');
+INSERT INTO t VALUES (6114, 4, 67.66, 'name6114');
+INSERT INTO t VALUES (6115, 5, 46.85, 'name6115');
+INSERT INTO t VALUES (6116, 6, 26.04, 'name6116');
+INSERT INTO t VALUES (6117, 7, 5.23, 'name6117');
+INSERT INTO t VALUES (6118, 8, 84.42, 'name6118');
+INSERT INTO t VALUES (6119, 9, 63.61, 'name6119');
+INSERT INTO t VALUES (6120, 0, 42.80, 'name6120');
+INSERT INTO t VALUES (6121, 1, 21.99, 'name6121');
+INSERT INTO t VALUES (6122, 2, 1.18, 'name6122');
+INSERT INTO t VALUES (6123, 3, 80.37, 'name6123');
+INSERT INTO t VALUES (6124, 4, 59.56, 'name6124');
+INSERT INTO t VALUES (6125, 5, 38.75, 'name6125');
+INSERT INTO t VALUES (6126, 6, 17.94, 'name6126');
+INSERT INTO t VALUES (6127, 7, 97.13, 'name6127');
+INSERT INTO t VALUES (6128, 8, 76.32, 'name6128');
+INSERT INTO t VALUES (6129, 9, 55.51, 'name6129');
+INSERT INTO t VALUES (6130, 0, 34.70, 'name6130');
+INSERT INTO t VALUES (6131, 1, 13.89, 'name6131');
+INSERT INTO t VALUES (6132, 2, 93.08, 'name6132');
+INSERT INTO t VALUES (6133, 3, 72.27, 'name6133');
+INSERT INTO t VALUES (6134, 4, 51.46, 'name6134');
+INSERT INTO t VALUES (6135, 5, 30.65, 'name6135');
+INSERT INTO t VALUES (6136, 6, 9.84, 'name6136');
+INSERT INTO t VALUES (6137, 7, 89.03, 'name6137');
+INSERT INTO t VALUES (6138, 8, 68.22, 'name6138');
+INSERT INTO t VALUES (6139, 9, 47.41, 'name6139');
+INSERT INTO t VALUES (6140, 0, 26.60, 'name6140');
+INSERT INTO t VALUES (6141, 1, 5.79, 'name6141');
+INSERT INTO t VALUES (6142, 2, 84.98, 'name6142');
+INSERT INTO t VALUES (6143, 3, 64.17, 'name6143');
+INSERT INTO t VALUES (6144, 4, 43.36, 'name6144');
+INSERT INTO t VALUES (6145, 5, 22.55, 'name6145');
+INSERT INTO t VALUES (6146, 6, 1.74, 'name6146');
+INSERT INTO t VALUES (6147, 7, 80.93, 'name6147');
+INSERT INTO t VALUES (6148, 8, 60.12, 'name6148');
+INSERT INTO t VALUES (6149, 9, 39.31, 'name6149');
+INSERT INTO t VALUES (6150, 0, 18.50, 'name6150');
+INSERT INTO t VALUES (6151, 1, 97.69, 'name6151');
+INSERT INTO t VALUES (6152, 2, 76.88, 'name6152');
+INSERT INTO t VALUES (6153, 3, 56.07, 'name6153');
+INSERT INTO t VALUES (6154, 4, 35.26, 'name6154');
+INSERT INTO t VALUES (6155, 5, 14.45, 'name6155');
+INSERT INTO t VALUES (6156, 6, 93.64, 'name6156');
+INSERT INTO t VALUES (6157, 7, 72.83, 'name6157');
+INSERT INTO t VALUES (6158, 8, 52.02, 'name6158');
+INSERT INTO t VALUES (6159, 9, 31.21, 'name6159');
+INSERT INTO t VALUES (6160, 0, 10.40, 'name6160');
+INSERT INTO t VALUES (6161, 1, 89.59, 'name6161');
+INSERT INTO t VALUES (6162, 2, 68.78, 'name6162');
+INSERT INTO t VALUES (6163, 3, 47.97, 'name6163');
+INSERT INTO t VALUES (6164, 4, 27.16, 'name6164');
+INSERT INTO t VALUES (6165, 5, 6.35, 'name6165');
+INSERT INTO t VALUES (6166, 6, 85.54, 'name6166');
+INSERT INTO t VALUES (6167, 7, 64.73, 'name6167');
+INSERT INTO t VALUES (6168, 8, 43.92, 'name6168');
+INSERT INTO t VALUES (6169, 9, 23.11, 'name6169');
+INSERT INTO t VALUES (6170, 0, 2.30, 'name6170');
+INSERT INTO t VALUES (6171, 1, 81.49, 'name6171');
+INSERT INTO t VALUES (6172, 2, 60.68, 'name6172');
+INSERT INTO t VALUES (6173, 3, 39.87, 'name6173');
+INSERT INTO t VALUES (6174, 4, 19.06, 'name6174');
+INSERT INTO t VALUES (6175, 5, 98.25, 'name6175');
+INSERT INTO t VALUES (6176, 6, 77.44, 'name6176');
+INSERT INTO t VALUES (6177, 7, 56.63, 'name6177');
+INSERT INTO t VALUES (6178, 8, 35.82, 'name6178');
+INSERT INTO t VALUES (6179, 9, 15.01, 'name6179');
+INSERT INTO t VALUES (6180, 0, 94.20, 'name6180');
+INSERT INTO t VALUES (6181, 1, 73.39, 'name6181');
+INSERT INTO t VALUES (6182, 2, 52.58, 'name6182');
+INSERT INTO t VALUES (6183, 3, 31.77, 'name6183');
+INSERT INTO t VALUES (6184, 4, 10.96, 'name6184');
+INSERT INTO t VALUES (6185, 5, 90.15, 'name6185');
+INSERT INTO t VALUES (6186, 6, 69.34, 'name6186');
+INSERT INTO t VALUES (6187, 7, 48.53, 'name6187');
+INSERT INTO t VALUES (6188, 8, 27.72, 'name6188');
+INSERT INTO t VALUES (6189, 9, 6.91, 'name6189');
+INSERT INTO t VALUES (6190, 0, 86.10, 'name6190');
+INSERT INTO t VALUES (6191, 1, 65.29, 'name6191');
+INSERT INTO t VALUES (6192, 2, 44.48, 'name6192');
+INSERT INTO t VALUES (6193, 3, 23.67, 'name6193');
+INSERT INTO t VALUES (6194, 4, 2.86, 'name6194');
+INSERT INTO t VALUES (6195, 5, 82.05, 'name6195');
+INSERT INTO t VALUES (6196, 6, 61.24, 'name6196');
+INSERT INTO t VALUES (6197, 7, 40.43, 'name6197');
+INSERT INTO t VALUES (6198, 8, 19.62, 'name6198');
+INSERT INTO t VALUES (6199, 9, 98.81, 'name6199');
+INSERT INTO t VALUES (6200, 0, 78.00, 'name6200');
+INSERT INTO t VALUES (6201, 1, 57.19, 'name6201');
+INSERT INTO t VALUES (6202, 2, 36.38, 'name6202');
+INSERT INTO t VALUES (6203, 3, 15.57, 'name6203');
+INSERT INTO t VALUES (6204, 4, 94.76, 'name6204');
+INSERT INTO t VALUES (6205, 5, 73.95, 'name6205');
+INSERT INTO t VALUES (6206, 6, 53.14, 'name6206');
+INSERT INTO t VALUES (6207, 7, 32.33, 'name6207');
+INSERT INTO t VALUES (6208, 8, 11.52, 'name6208');
+INSERT INTO t VALUES (6209, 9, 90.71, 'name6209');
+INSERT INTO t VALUES (6210, 0, 69.90, 'name6210');
+INSERT INTO t VALUES (6211, 1, 49.09, 'name6211');
+INSERT INTO t VALUES (6212, 2, 28.28, 'name6212');
+INSERT INTO t VALUES (6213, 3, 7.47, 'name6213');
+INSERT INTO t VALUES (6214, 4, 86.66, 'name6214');
+INSERT INTO t VALUES (6215, 5, 65.85, 'name6215');
+INSERT INTO t VALUES (6216, 6, 45.04, 'name6216');
+INSERT INTO t VALUES (6217, 7, 24.23, 'name6217');
+INSERT INTO t VALUES (6218, 8, 3.42, 'name6218');
+INSERT INTO t VALUES (6219, 9, 82.61, 'name6219');
+INSERT INTO t VALUES (6220, 0, 61.80, 'name6220');
+INSERT INTO t VALUES (6221, 1, 40.99, 'name6221');
+INSERT INTO t VALUES (6222, 2, 20.18, 'name6222');
+INSERT INTO t VALUES (6223, 3, 99.37, 'name6223');
+INSERT INTO t VALUES (6224, 4, 78.56, 'name6224');
+INSERT INTO t VALUES (6225, 5, 57.75, 'name6225');
+INSERT INTO t VALUES (6226, 6, 36.94, 'name6226');
+INSERT INTO t VALUES (6227, 7, 16.13, 'name6227');
+INSERT INTO t VALUES (6228, 8, 95.32, 'name6228');
+INSERT INTO t VALUES (6229, 9, 74.51, 'name6229');
+INSERT INTO t VALUES (6230, 0, 53.70, 'name6230');
+INSERT INTO t VALUES (6231, 1, 32.89, 'name6231');
+INSERT INTO t VALUES (6232, 2, 12.08, 'name6232');
+INSERT INTO t VALUES (6233, 3, 91.27, 'name6233');
+INSERT INTO t VALUES (6234, 4, 70.46, 'name6234');
+INSERT INTO t VALUES (6235, 5, 49.65, 'name6235');
+INSERT INTO t VALUES (6236, 6, 28.84, 'name6236');
+INSERT INTO t VALUES (6237, 7, 8.03, 'name6237');
+INSERT INTO t VALUES (6238, 8, 87.22, 'name6238');
+INSERT INTO t VALUES (6239, 9, 66.41, 'name6239');
+INSERT INTO t VALUES (6240, 0, 45.60, 'name6240');
+INSERT INTO t VALUES (6241, 1, 24.79, 'name6241');
+INSERT INTO t VALUES (6242, 2, 3.98, 'name6242');
+INSERT INTO t VALUES (6243, 3, 83.17, 'name6243');
+INSERT INTO t VALUES (6244, 4, 62.36, 'name6244');
+INSERT INTO t VALUES (6245, 5, 41.55, 'name6245');
+INSERT INTO t VALUES (6246, 6, 20.74, 'name6246');
+INSERT INTO t VALUES (6247, 7, 99.93, 'name6247');
+INSERT INTO t VALUES (6248, 8, 79.12, 'name6248');
+INSERT INTO t VALUES (6249, 9, 58.31, 'name6249');
+INSERT INTO t VALUES (6250, 0, 37.50, 'name6250');
+INSERT INTO t VALUES (6251, 1, 16.69, 'name6251');
+INSERT INTO t VALUES (6252, 2, 95.88, 'name6252');
+INSERT INTO t VALUES (6253, 3, 75.07, 'name6253');
+INSERT INTO t VALUES (6254, 4, 54.26, 'name6254');
+INSERT INTO t VALUES (6255, 5, 33.45, 'name6255');
+INSERT INTO t VALUES (6256, 6, 12.64, 'name6256');
+INSERT INTO t VALUES (6257, 7, 91.83, 'name6257');
+INSERT INTO t VALUES (6258, 8, 71.02, 'name6258');
+INSERT INTO t VALUES (6259, 9, 50.21, 'name6259');
+INSERT INTO t VALUES (6260, 0, 29.40, 'name6260');
+INSERT INTO t VALUES (6261, 1, 8.59, 'name6261');
+INSERT INTO t VALUES (6262, 2, 87.78, 'name6262');
+INSERT INTO t VALUES (6263, 3, 66.97, 'name6263');
+INSERT INTO t VALUES (6264, 4, 46.16, 'name6264');
+INSERT INTO t VALUES (6265, 5, 25.35, 'name6265');
+INSERT INTO t VALUES (6266, 6, 4.54, 'name6266');
+INSERT INTO t VALUES (6267, 7, 83.73, 'name6267');
+INSERT INTO t VALUES (6268, 8, 62.92, 'name6268');
+INSERT INTO t VALUES (6269, 9, 42.11, 'name6269');
+INSERT INTO t VALUES (6270, 0, 21.30, 'name6270');
+INSERT INTO t VALUES (6271, 1, 0.49, 'name6271');
+INSERT INTO t VALUES (6272, 2, 79.68, 'name6272');
+INSERT INTO t VALUES (6273, 3, 58.87, 'name6273');
+INSERT INTO t VALUES (6274, 4, 38.06, 'name6274');
+INSERT INTO t VALUES (6275, 5, 17.25, 'name6275');
+INSERT INTO t VALUES (6276, 6, 96.44, 'name6276');
+INSERT INTO t VALUES (6277, 7, 75.63, 'name6277');
+INSERT INTO t VALUES (6278, 8, 54.82, 'name6278');
+INSERT INTO t VALUES (6279, 9, 34.01, 'name6279');
+INSERT INTO t VALUES (6280, 0, 13.20, 'name6280');
+INSERT INTO t VALUES (6281, 1, 92.39, 'name6281');
+INSERT INTO t VALUES (6282, 2, 71.58, 'name6282');
+INSERT INTO t VALUES (6283, 3, 50.77, 'name6283');
+INSERT INTO t VALUES (6284, 4, 29.96, 'name6284');
+INSERT INTO t VALUES (6285, 5, 9.15, 'name6285');
+INSERT INTO t VALUES (6286, 6, 88.34, 'name6286');
+INSERT INTO t VALUES (6287, 7, 67.53, 'name6287');
+INSERT INTO t VALUES (6288, 8, 46.72, 'name6288');
+INSERT INTO t VALUES (6289, 9, 25.91, 'name6289');
+INSERT INTO t VALUES (6290, 0, 5.10, 'name6290');
+INSERT INTO t VALUES (6291, 1, 84.29, 'name6291');
+INSERT INTO t VALUES (6292, 2, 63.48, 'name6292');
+INSERT INTO t VALUES (6293, 3, 42.67, 'name6293');
+INSERT INTO t VALUES (6294, 4, 21.86, 'name6294');
+INSERT INTO t VALUES (6295, 5, 1.05, 'name6295');
+INSERT INTO t VALUES (6296, 6, 80.24, 'name6296');
+INSERT INTO t VALUES (6297, 7, 59.43, 'name6297');
+INSERT INTO t VALUES (6298, 8, 38.62, 'name6298');
+INSERT INTO t VALUES (6299, 9, 17.81, 'name6299');
+INSERT INTO t VALUES (6300, 0, 97.00, 'name6300');
+INSERT INTO t VALUES (6301, 1, 76.19, 'name6301');
+INSERT INTO t VALUES (6302, 2, 55.38, 'name6302');
+INSERT INTO t VALUES (6303, 3, 34.57, 'name6303');
+INSERT INTO t VALUES (6304, 4, 13.76, 'name6304');
+INSERT INTO t VALUES (6305, 5, 92.95, 'name6305');
+INSERT INTO t VALUES (6306, 6, 72.14, 'name6306');
+INSERT INTO t VALUES (6307, 7, 51.33, 'name6307');
+INSERT INTO t VALUES (6308, 8, 30.52, 'name6308');
+INSERT INTO t VALUES (6309, 9, 9.71, 'name6309');
+INSERT INTO t VALUES (6310, 0, 88.90, 'name6310');
+INSERT INTO t VALUES (6311, 1, 68.09, 'name6311');
+INSERT INTO t VALUES (6312, 2, 47.28, 'name6312');
+INSERT INTO t VALUES (6313, 3, 26.47, 'name6313');
+INSERT INTO t VALUES (6314, 4, 5.66, 'name6314');
+INSERT INTO t VALUES (6315, 5, 84.85, 'name6315');
+INSERT INTO t VALUES (6316, 6, 64.04, 'name6316');
+INSERT INTO t VALUES (6317, 7, 43.23, 'name6317');
+INSERT INTO t VALUES (6318, 8, 22.42, 'name6318');
+INSERT INTO t VALUES (6319, 9, 1.61, 'name6319');
+INSERT INTO t VALUES (6320, 0, 80.80, 'name6320');
+INSERT INTO t VALUES (6321, 1, 59.99, 'name6321');
+INSERT INTO t VALUES (6322, 2, 39.18, 'name6322');
+INSERT INTO t VALUES (6323, 3, 18.37, 'name6323');
+INSERT INTO t VALUES (6324, 4, 97.56, 'name6324');
+INSERT INTO t VALUES (6325, 5, 76.75, 'name6325');
+INSERT INTO t VALUES (6326, 6, 55.94, 'name6326');
+INSERT INTO t VALUES (6327, 7, 35.13, 'name6327');
+INSERT INTO t VALUES (6328, 8, 14.32, 'name6328');
+INSERT INTO t VALUES (6329, 9, 93.51, 'name6329');
+INSERT INTO t VALUES (6330, 0, 72.70, 'name6330');
+INSERT INTO t VALUES (6331, 1, 51.89, 'name6331');
+INSERT INTO t VALUES (6332, 2, 31.08, 'name6332');
+INSERT INTO t VALUES (6333, 3, 10.27, 'name6333');
+INSERT INTO t VALUES (6334, 4, 89.46, 'name6334');
+INSERT INTO t VALUES (6335, 5, 68.65, 'name6335');
+INSERT INTO t VALUES (6336, 6, 47.84, 'name6336');
+INSERT INTO t VALUES (6337, 7, 27.03, 'name6337');
+INSERT INTO t VALUES (6338, 8, 6.22, 'name6338');
+INSERT INTO t VALUES (6339, 9, 85.41, 'name6339');
+INSERT INTO t VALUES (6340, 0, 64.60, 'name6340');
+INSERT INTO t VALUES (6341, 1, 43.79, 'name6341');
+INSERT INTO t VALUES (6342, 2, 22.98, 'name6342');
+INSERT INTO t VALUES (6343, 3, 2.17, 'name6343');
+INSERT INTO t VALUES (6344, 4, 81.36, 'name6344');
+INSERT INTO t VALUES (6345, 5, 60.55, 'name6345');
+INSERT INTO t VALUES (6346, 6, 39.74, 'name6346');
+INSERT INTO t VALUES (6347, 7, 18.93, 'name6347');
+INSERT INTO t VALUES (6348, 8, 98.12, 'name6348');
+INSERT INTO t VALUES (6349, 9, 77.31, 'name6349');
+INSERT INTO t VALUES (6350, 0, 56.50, 'name6350');
+INSERT INTO t VALUES (6351, 1, 35.69, 'name6351');
+INSERT INTO t VALUES (6352, 2, 14.88, 'name6352');
+INSERT INTO t VALUES (6353, 3, 94.07, 'name6353');
+INSERT INTO t VALUES (6354, 4, 73.26, 'name6354');
+INSERT INTO t VALUES (6355, 5, 52.45, 'name6355');
+INSERT INTO t VALUES (6356, 6, 31.64, 'name6356');
+INSERT INTO t VALUES (6357, 7, 10.83, 'name6357');
+INSERT INTO t VALUES (6358, 8, 90.02, 'name6358');
+INSERT INTO t VALUES (6359, 9, 69.21, 'name6359');
+INSERT INTO t VALUES (6360, 0, 48.40, 'name6360');
+INSERT INTO t VALUES (6361, 1, 27.59, 'name6361');
+INSERT INTO t VALUES (6362, 2, 6.78, 'name6362');
+INSERT INTO t VALUES (6363, 3, 85.97, 'name6363');
+INSERT INTO t VALUES (6364, 4, 65.16, 'name6364');
+INSERT INTO t VALUES (6365, 5, 44.35, 'name6365');
+INSERT INTO t VALUES (6366, 6, 23.54, 'name6366');
+INSERT INTO t VALUES (6367, 7, 2.73, 'name6367');
+INSERT INTO t VALUES (6368, 8, 81.92, 'name6368');
+INSERT INTO t VALUES (6369, 9, 61.11, 'name6369');
+INSERT INTO t VALUES (6370, 0, 40.30, 'name6370');
+INSERT INTO t VALUES (6371, 1, 19.49, 'name6371');
+INSERT INTO t VALUES (6372, 2, 98.68, 'name6372');
+INSERT INTO t VALUES (6373, 3, 77.87, 'name6373');
+INSERT INTO t VALUES (6374, 4, 57.06, 'name6374');
+INSERT INTO t VALUES (6375, 5, 36.25, 'name6375');
+INSERT INTO t VALUES (6376, 6, 15.44, 'name6376');
+INSERT INTO t VALUES (6377, 7, 94.63, 'name6377');
+INSERT INTO t VALUES (6378, 8, 73.82, 'name6378');
+INSERT INTO t VALUES (6379, 9, 53.01, 'name6379');
+INSERT INTO t VALUES (6380, 0, 32.20, 'name6380');
+INSERT INTO t VALUES (6381, 1, 11.39, 'name6381');
+INSERT INTO t VALUES (6382, 2, 90.58, 'name6382');
+INSERT INTO t VALUES (6383, 3, 69.77, 'name6383');
+INSERT INTO t VALUES (6384, 4, 48.96, 'name6384');
+INSERT INTO t VALUES (6385, 5, 28.15, 'name6385');
+INSERT INTO t VALUES (6386, 6, 7.34, 'name6386');
+INSERT INTO t VALUES (6387, 7, 86.53, 'name6387');
+INSERT INTO t VALUES (6388, 8, 65.72, 'name6388');
+INSERT INTO t VALUES (6389, 9, 44.91, 'name6389');
+INSERT INTO t VALUES (6390, 0, 24.10, 'name6390');
+INSERT INTO t VALUES (6391, 1, 3.29, 'name6391');
+INSERT INTO t VALUES (6392, 2, 82.48, 'name6392');
+INSERT INTO t VALUES (6393, 3, 61.67, 'name6393');
+INSERT INTO t VALUES (6394, 4, 40.86, 'name6394');
+INSERT INTO t VALUES (6395, 5, 20.05, 'name6395');
+INSERT INTO t VALUES (6396, 6, 99.24, 'name6396');
+INSERT INTO t VALUES (6397, 7, 78.43, 'name6397');
+INSERT INTO t VALUES (6398, 8, 57.62, 'name6398');
+INSERT INTO t VALUES (6399, 9, 36.81, 'name6399');
+INSERT INTO t VALUES (6400, 0, 16.00, 'name6400');
+INSERT INTO t VALUES (6401, 1, 95.19, 'name6401');
+INSERT INTO t VALUES (6402, 2, 74.38, 'name6402');
+INSERT INTO t VALUES (6403, 3, 53.57, 'name6403');
+INSERT INTO t VALUES (6404, 4, 32.76, 'name6404');
+INSERT INTO t VALUES (6405, 5, 11.95, 'name6405');
+INSERT INTO t VALUES (6406, 6, 91.14, 'name6406');
+INSERT INTO t VALUES (6407, 7, 70.33, 'name6407');
+INSERT INTO t VALUES (6408, 8, 49.52, 'name6408');
+INSERT INTO t VALUES (6409, 9, 28.71, 'name6409');
+INSERT INTO t VALUES (6410, 0, 7.90, 'name6410');
+INSERT INTO t VALUES (6411, 1, 87.09, 'name6411');
+INSERT INTO t VALUES (6412, 2, 66.28, 'name6412');
+INSERT INTO t VALUES (6413, 3, 45.47, 'name6413');
+INSERT INTO t VALUES (6414, 4, 24.66, 'name6414');
+INSERT INTO t VALUES (6415, 5, 3.85, 'name6415');
+INSERT INTO t VALUES (6416, 6, 83.04, 'name6416');
+INSERT INTO t VALUES (6417, 7, 62.23, 'name6417');
+INSERT INTO t VALUES (6418, 8, 41.42, 'name6418');
+INSERT INTO t VALUES (6419, 9, 20.61, 'name6419');
+INSERT INTO t VALUES (6420, 0, 99.80, 'name6420');
+INSERT INTO t VALUES (6421, 1, 78.99, 'name6421');
+INSERT INTO t VALUES (6422, 2, 58.18, 'name6422');
+INSERT INTO t VALUES (6423, 3, 37.37, 'name6423');
+INSERT INTO t VALUES (6424, 4, 16.56, 'name6424');
+INSERT INTO t VALUES (6425, 5, 95.75, 'name6425');
+INSERT INTO t VALUES (6426, 6, 74.94, 'name6426');
+INSERT INTO t VALUES (6427, 7, 54.13, 'name6427');
+INSERT INTO t VALUES (6428, 8, 33.32, 'name6428');
+INSERT INTO t VALUES (6429, 9, 12.51, 'name6429');
+INSERT INTO t VALUES (6430, 0, 91.70, 'name6430');
+INSERT INTO t VALUES (6431, 1, 70.89, 'name6431');
+INSERT INTO t VALUES (6432, 2, 50.08, 'name6432');
+INSERT INTO t VALUES (6433, 3, 29.27, 'name6433');
+INSERT INTO t VALUES (6434, 4, 8.46, 'name6434');
+INSERT INTO t VALUES (6435, 5, 87.65, 'name6435');
+INSERT INTO t VALUES (6436, 6, 66.84, 'name6436');
+INSERT INTO t VALUES (6437, 7, 46.03, 'name6437');
+INSERT INTO t VALUES (6438, 8, 25.22, 'name6438');
+INSERT INTO t VALUES (6439, 9, 4.41, 'name6439');
+INSERT INTO t VALUES (6440, 0, 83.60, 'name6440');
+INSERT INTO t VALUES (6441, 1, 62.79, 'name6441');
+INSERT INTO t VALUES (6442, 2, 41.98, 'name6442');
+INSERT INTO t VALUES (6443, 3, 21.17, 'name6443');
+INSERT INTO t VALUES (6444, 4, 0.36, 'name6444');
+INSERT INTO t VALUES (6445, 5, 79.55, 'name6445');
+INSERT INTO t VALUES (6446, 6, 58.74, 'name6446');
+INSERT INTO t VALUES (6447, 7, 37.93, 'name6447');
+INSERT INTO t VALUES (6448, 8, 17.12, 'name6448');
+INSERT INTO t VALUES (6449, 9, 96.31, 'name6449');
+INSERT INTO t VALUES (6450, 0, 75.50, 'name6450');
+INSERT INTO t VALUES (6451, 1, 54.69, 'name6451');
+INSERT INTO t VALUES (6452, 2, 33.88, 'name6452');
+INSERT INTO t VALUES (6453, 3, 13.07, 'name6453');
+INSERT INTO t VALUES (6454, 4, 92.26, 'name6454');
+INSERT INTO t VALUES (6455, 5, 71.45, 'name6455');
+INSERT INTO t VALUES (6456, 6, 50.64, 'name6456');
+INSERT INTO t VALUES (6457, 7, 29.83, 'name6457');
+INSERT INTO t VALUES (6458, 8, 9.02, 'name6458');
+INSERT INTO t VALUES (6459, 9, 88.21, 'name6459');
+INSERT INTO t VALUES (6460, 0, 67.40, 'name6460');
+INSERT INTO t VALUES (6461, 1, 46.59, 'name6461');
+INSERT INTO t VALUES (6462, 2, 25.78, 'name6462');
+INSERT INTO t VALUES (6463, 3, 4.97, 'name6463');
+INSERT INTO t VALUES (6464, 4, 84.16, 'name6464');
+INSERT INTO t VALUES (6465, 5, 63.35, 'name6465');
+INSERT INTO t VALUES (6466, 6, 42.54, 'name6466');
+INSERT INTO t VALUES (6467, 7, 21.73, 'name6467');
+INSERT INTO t VALUES (6468, 8, 0.92, 'name6468');
+INSERT INTO t VALUES (6469, 9, 80.11, 'name6469');
+INSERT INTO t VALUES (6470, 0, 59.30, 'name6470');
+INSERT INTO t VALUES (6471, 1, 38.49, 'name6471');
+INSERT INTO t VALUES (6472, 2, 17.68, 'name6472');
+INSERT INTO t VALUES (6473, 3, 96.87, 'name6473');
+INSERT INTO t VALUES (6474, 4, 76.06, 'name6474');
+INSERT INTO t VALUES (6475, 5, 55.25, 'name6475');
+INSERT INTO t VALUES (6476, 6, 34.44, 'name6476');
+INSERT INTO t VALUES (6477, 7, 13.63, 'name6477');
+INSERT INTO t VALUES (6478, 8, 92.82, 'name6478');
+INSERT INTO t VALUES (6479, 9, 72.01, 'name6479');
+INSERT INTO t VALUES (6480, 0, 51.20, 'name6480');
+INSERT INTO t VALUES (6481, 1, 30.39, 'name6481');
+INSERT INTO t VALUES (6482, 2, 9.58, 'name6482');
+INSERT INTO t VALUES (6483, 3, 88.77, 'name6483');
+INSERT INTO t VALUES (6484, 4, 67.96, 'name6484');
+INSERT INTO t VALUES (6485, 5, 47.15, 'name6485');
+INSERT INTO t VALUES (6486, 6, 26.34, 'name6486');
+INSERT INTO t VALUES (6487, 7, 5.53, 'name6487');
+INSERT INTO t VALUES (6488, 8, 84.72, 'name6488');
+INSERT INTO t VALUES (6489, 9, 63.91, 'name6489');
+INSERT INTO t VALUES (6490, 0, 43.10, 'name6490');
+INSERT INTO t VALUES (6491, 1, 22.29, 'name6491');
+INSERT INTO t VALUES (6492, 2, 1.48, 'name6492');
+INSERT INTO t VALUES (6493, 3, 80.67, 'name6493');
+INSERT INTO t VALUES (6494, 4, 59.86, 'name6494');
+INSERT INTO t VALUES (6495, 5, 39.05, 'name6495');
+INSERT INTO t VALUES (6496, 6, 18.24, 'name6496');
+INSERT INTO t VALUES (6497, 7, 97.43, 'name6497');
+INSERT INTO t VALUES (6498, 8, 76.62, 'name6498');
+INSERT INTO t VALUES (6499, 9, 55.81, 'name6499');
+INSERT INTO t VALUES (6500, 0, 35.00, 'name6500');
+INSERT INTO t VALUES (6501, 1, 14.19, 'name6501');
+INSERT INTO t VALUES (6502, 2, 93.38, 'name6502');
+INSERT INTO t VALUES (6503, 3, 72.57, 'name6503');
+INSERT INTO t VALUES (6504, 4, 51.76, 'name6504');
+INSERT INTO t VALUES (6505, 5, 30.95, 'name6505');
+INSERT INTO t VALUES (6506, 6, 10.14, 'name6506');
+INSERT INTO t VALUES (6507, 7, 89.33, 'name6507');
+INSERT INTO t VALUES (6508, 8, 68.52, 'name6508');
+INSERT INTO t VALUES (6509, 9, 47.71, 'name6509');
+INSERT INTO t VALUES (6510, 0, 26.90, 'name6510');
+INSERT INTO t VALUES (6511, 1, 6.09, 'name6511');
+INSERT INTO t VALUES (6512, 2, 85.28, 'name6512');
+INSERT INTO t VALUES (6513, 3, 64.47, 'name6513');
+INSERT INTO t VALUES (6514, 4, 43.66, 'name6514');
+INSERT INTO t VALUES (6515, 5, 22.85, 'name6515');
+INSERT INTO t VALUES (6516, 6, 2.04, 'name6516');
+INSERT INTO t VALUES (6517, 7, 81.23, 'name6517');
+INSERT INTO t VALUES (6518, 8, 60.42, 'name6518');
+INSERT INTO t VALUES (6519, 9, 39.61, 'name6519');
+INSERT INTO t VALUES (6520, 0, 18.80, 'name6520');
+INSERT INTO t VALUES (6521, 1, 97.99, 'name6521');
+INSERT INTO t VALUES (6522, 2, 77.18, 'name6522');
+INSERT INTO t VALUES (6523, 3, 56.37, 'name6523');
+INSERT INTO t VALUES (6524, 4, 35.56, 'name6524');
+INSERT INTO t VALUES (6525, 5, 14.75, 'name6525');
+INSERT INTO t VALUES (6526, 6, 93.94, 'name6526');
+INSERT INTO t VALUES (6527, 7, 73.13, 'name6527');
+INSERT INTO t VALUES (6528, 8, 52.32, 'name6528');
+INSERT INTO t VALUES (6529, 9, 31.51, 'name6529');
+INSERT INTO t VALUES (6530, 0, 10.70, 'name6530');
+INSERT INTO t VALUES (6531, 1, 89.89, 'name6531');
+INSERT INTO t VALUES (6532, 2, 69.08, 'name6532');
+INSERT INTO t VALUES (6533, 3, 48.27, 'name6533');
+INSERT INTO t VALUES (6534, 4, 27.46, 'name6534');
+INSERT INTO t VALUES (6535, 5, 6.65, 'name6535');
+INSERT INTO t VALUES (6536, 6, 85.84, 'name6536');
+INSERT INTO t VALUES (6537, 7, 65.03, 'name6537');
+INSERT INTO t VALUES (6538, 8, 44.22, 'name6538');
+INSERT INTO t VALUES (6539, 9, 23.41, 'name6539');
+INSERT INTO t VALUES (6540, 0, 2.60, 'name6540');
+INSERT INTO t VALUES (6541, 1, 81.79, 'name6541');
+INSERT INTO t VALUES (6542, 2, 60.98, 'name6542');
+INSERT INTO t VALUES (6543, 3, 40.17, 'name6543');
+INSERT INTO t VALUES (6544, 4, 19.36, 'name6544');
+INSERT INTO t VALUES (6545, 5, 98.55, 'name6545');
+INSERT INTO t VALUES (6546, 6, 77.74, 'name6546');
+INSERT INTO t VALUES (6547, 7, 56.93, 'name6547');
+INSERT INTO t VALUES (6548, 8, 36.12, 'name6548');
+INSERT INTO t VALUES (6549, 9, 15.31, 'name6549');
+INSERT INTO t VALUES (6550, 0, 94.50, 'name6550');
+INSERT INTO t VALUES (6551, 1, 73.69, 'name6551');
+INSERT INTO t VALUES (6552, 2, 52.88, 'name6552');
+INSERT INTO t VALUES (6553, 3, 32.07, 'name6553');
+INSERT INTO t VALUES (6554, 4, 11.26, 'name6554');
+INSERT INTO t VALUES (6555, 5, 90.45, 'name6555');
+INSERT INTO t VALUES (6556, 6, 69.64, 'name6556');
+INSERT INTO t VALUES (6557, 7, 48.83, 'name6557');
+INSERT INTO t VALUES (6558, 8, 28.02, 'name6558');
+INSERT INTO t VALUES (6559, 9, 7.21, 'name6559');
+INSERT INTO t VALUES (6560, 0, 86.40, 'name6560');
+INSERT INTO t VALUES (6561, 1, 65.59, 'name6561');
+INSERT INTO t VALUES (6562, 2, 44.78, 'name6562');
+INSERT INTO t VALUES (6563, 3, 23.97, 'name6563');
+INSERT INTO t VALUES (6564, 4, 3.16, 'name6564');
+INSERT INTO t VALUES (6565, 5, 82.35, 'name6565');
+INSERT INTO t VALUES (6566, 6, 61.54, 'name6566');
+INSERT INTO t VALUES (6567, 7, 40.73, 'name6567');
+INSERT INTO t VALUES (6568, 8, 19.92, 'name6568');
+INSERT INTO t VALUES (6569, 9, 99.11, 'name6569');
+INSERT INTO t VALUES (6570, 0, 78.30, 'name6570');
+INSERT INTO t VALUES (6571, 1, 57.49, 'name6571');
+INSERT INTO t VALUES (6572, 2, 36.68, 'name6572');
+INSERT INTO t VALUES (6573, 3, 15.87, 'name6573');
+INSERT INTO t VALUES (6574, 4, 95.06, 'name6574');
+INSERT INTO t VALUES (6575, 5, 74.25, 'name6575');
+INSERT INTO t VALUES (6576, 6, 53.44, 'name6576');
+INSERT INTO t VALUES (6577, 7, 32.63, 'name6577');
+INSERT INTO t VALUES (6578, 8, 11.82, 'name6578');
+INSERT INTO t VALUES (6579, 9, 91.01, 'name6579');
+INSERT INTO t VALUES (6580, 0, 70.20, 'name6580');
+INSERT INTO t VALUES (6581, 1, 49.39, 'name6581');
+INSERT INTO t VALUES (6582, 2, 28.58, 'name6582');
+INSERT INTO t VALUES (6583, 3, 7.77, 'name6583');
+INSERT INTO t VALUES (6584, 4, 86.96, 'name6584');
+INSERT INTO t VALUES (6585, 5, 66.15, 'name6585');
+INSERT INTO t VALUES (6586, 6, 45.34, 'name6586');
+INSERT INTO t VALUES (6587, 7, 24.53, 'name6587');
+INSERT INTO t VALUES (6588, 8, 3.72, 'name6588');
+INSERT INTO t VALUES (6589, 9, 82.91, 'name6589');
+INSERT INTO t VALUES (6590, 0, 62.10, 'name6590');
+INSERT INTO t VALUES (6591, 1, 41.29, 'name6591');
+INSERT INTO t VALUES (6592, 2, 20.48, 'name6592');
+INSERT INTO t VALUES (6593, 3, 99.67, 'name6593');
+INSERT INTO t VALUES (6594, 4, 78.86, 'name6594');
+INSERT INTO t VALUES (6595, 5, 58.05, 'name6595');
+INSERT INTO t VALUES (6596, 6, 37.24, 'name6596');
+INSERT INTO t VALUES (6597, 7, 16.43, 'name6597');
+INSERT INTO t VALUES (6598, 8, 95.62, 'name6598');
+INSERT INTO t VALUES (6599, 9, 74.81, 'name6599');
+INSERT INTO t VALUES (6600, 0, 54.00, 'name6600');
+INSERT INTO t VALUES (6601, 1, 33.19, 'name6601');
+INSERT INTO t VALUES (6602, 2, 12.38, 'name6602');
+INSERT INTO t VALUES (6603, 3, 91.57, 'name6603');
+INSERT INTO t VALUES (6604, 4, 70.76, 'name6604');
+INSERT INTO t VALUES (6605, 5, 49.95, 'name6605');
+INSERT INTO t VALUES (6606, 6, 29.14, 'name6606');
+INSERT INTO t VALUES (6607, 7, 8.33, 'name6607');
+INSERT INTO t VALUES (6608, 8, 87.52, 'name6608');
+INSERT INTO t VALUES (6609, 9, 66.71, 'name6609');
+INSERT INTO t VALUES (6610, 0, 45.90, 'name6610');
+INSERT INTO t VALUES (6611, 1, 25.09, 'name6611');
+INSERT INTO t VALUES (6612, 2, 4.28, 'name6612');
+INSERT INTO t VALUES (6613, 3, 83.47, 'name6613');
+INSERT INTO t VALUES (6614, 4, 62.66, 'name6614');
+INSERT INTO t VALUES (6615, 5, 41.85, 'name6615');
+INSERT INTO t VALUES (6616, 6, 21.04, 'name6616');
+INSERT INTO t VALUES (6617, 7, 0.23, 'name6617');
+INSERT INTO t VALUES (6618, 8, 79.42, 'name6618');
+INSERT INTO t VALUES (6619, 9, 58.61, 'name6619');
+INSERT INTO t VALUES (6620, 0, 37.80, 'name6620');
+INSERT INTO t VALUES (6621, 1, 16.99, 'name6621');
+INSERT INTO t VALUES (6622, 2, 96.18, 'name6622');
+INSERT INTO t VALUES (6623, 3, 75.37, 'name6623');
+INSERT INTO t VALUES (6624, 4, 54.56, 'name6624');
+INSERT INTO t VALUES (6625, 5, 33.75, 'name6625');
+INSERT INTO t VALUES (6626, 6, 12.94, 'name6626');
+INSERT INTO t VALUES (6627, 7, 92.13, 'name6627');
+INSERT INTO t VALUES (6628, 8, 71.32, 'name6628');
+INSERT INTO t VALUES (6629, 9, 50.51, 'name6629');
+INSERT INTO t VALUES (6630, 0, 29.70, 'name6630');
+INSERT INTO t VALUES (6631, 1, 8.89, 'name6631');
+INSERT INTO t VALUES (6632, 2, 88.08, 'name6632');
+INSERT INTO t VALUES (6633, 3, 67.27, 'name6633');
+INSERT INTO t VALUES (6634, 4, 46.46, 'name6634');
+INSERT INTO t VALUES (6635, 5, 25.65, 'name6635');
+INSERT INTO t VALUES (6636, 6, 4.84, 'name6636');
+INSERT INTO t VALUES (6637, 7, 84.03, 'name6637');
+INSERT INTO t VALUES (6638, 8, 63.22, 'name6638');
+INSERT INTO t VALUES (6639, 9, 42.41, 'name6639');
+INSERT INTO t VALUES (6640, 0, 21.60, 'name6640');
+INSERT INTO t VALUES (6641, 1, 0.79, 'name6641');
+INSERT INTO t VALUES (6642, 2, 79.98, 'name6642');
+INSERT INTO t VALUES (6643, 3, 59.17, 'name6643');
+INSERT INTO t VALUES (6644, 4, 38.36, 'name6644');
+INSERT INTO t VALUES (6645, 5, 17.55, 'name6645');
+INSERT INTO t VALUES (6646, 6, 96.74, 'name6646');
+INSERT INTO t VALUES (6647, 7, 75.93, 'name6647');
+INSERT INTO t VALUES (6648, 8, 55.12, 'name6648');
+INSERT INTO t VALUES (6649, 9, 34.31, 'name6649');
+INSERT INTO t VALUES (6650, 0, 13.50, 'name6650');
+INSERT INTO t VALUES (6651, 1, 92.69, 'name6651');
+INSERT INTO t VALUES (6652, 2, 71.88, 'name6652');
+INSERT INTO t VALUES (6653, 3, 51.07, 'name6653');
+INSERT INTO t VALUES (6654, 4, 30.26, 'name6654');
+INSERT INTO t VALUES (6655, 5, 9.45, 'name6655');
+INSERT INTO t VALUES (6656, 6, 88.64, 'name6656');
+INSERT INTO t VALUES (6657, 7, 67.83, 'name6657');
+INSERT INTO t VALUES (6658, 8, 47.02, 'name6658');
+INSERT INTO t VALUES (6659, 9, 26.21, 'name6659');
+INSERT INTO t VALUES (6660, 0, 5.40, 'name6660');
+INSERT INTO t VALUES (6661, 1, 84.59, 'name6661');
+INSERT INTO t VALUES (6662, 2, 63.78, 'name6662');
+INSERT INTO t VALUES (6663, 3, 42.97, 'name6663');
+INSERT INTO t VALUES (6664, 4, 22.16, 'name6664');
+INSERT INTO t VALUES (6665, 5, 1.35, 'name6665');
+INSERT INTO t VALUES (6666, 6, 80.54, 'name6666');
+INSERT INTO t VALUES (6667, 7, 59.73, 'name6667');
+INSERT INTO t VALUES (6668, 8, 38.92, 'name6668');
+INSERT INTO t VALUES (6669, 9, 18.11, 'name6669');
+INSERT INTO t VALUES (6670, 0, 97.30, 'name6670');
+INSERT INTO t VALUES (6671, 1, 76.49, 'name6671');
+INSERT INTO t VALUES (6672, 2, 55.68, 'name6672');
+INSERT INTO t VALUES (6673, 3, 34.87, 'name6673');
+INSERT INTO t VALUES (6674, 4, 14.06, 'name6674');
+INSERT INTO t VALUES (6675, 5, 93.25, 'name6675');
+INSERT INTO t VALUES (6676, 6, 72.44, 'name6676');
+INSERT INTO t VALUES (6677, 7, 51.63, 'name6677');
+INSERT INTO t VALUES (6678, 8, 30.82, 'name6678');
+INSERT INTO t VALUES (6679, 9, 10.01, 'name6679');
+INSERT INTO t VALUES (6680, 0, 89.20, 'name6680');
+INSERT INTO t VALUES (6681, 1, 68.39, 'name6681');
+INSERT INTO t VALUES (6682, 2, 47.58, 'name6682');
+INSERT INTO t VALUES (6683, 3, 26.77, 'name6683');
+INSERT INTO t VALUES (6684, 4, 5.96, 'name6684');
+INSERT INTO t VALUES (6685, 5, 85.15, 'name6685');
+INSERT INTO t VALUES (6686, 6, 64.34, 'name6686');
+INSERT INTO t VALUES (6687, 7, 43.53, 'name6687');
+INSERT INTO t VALUES (6688, 8, 22.72, 'name6688');
+INSERT INTO t VALUES (6689, 9, 1.91, 'name6689');
+INSERT INTO t VALUES (6690, 0, 81.10, 'name6690');
+INSERT INTO t VALUES (6691, 1, 60.29, 'name6691');
+INSERT INTO t VALUES (6692, 2, 39.48, 'name6692');
+INSERT INTO t VALUES (6693, 3, 18.67, 'name6693');
+INSERT INTO t VALUES (6694, 4, 97.86, 'name6694');
+INSERT INTO t VALUES (6695, 5, 77.05, 'name6695');
+INSERT INTO t VALUES (6696, 6, 56.24, 'name6696');
+INSERT INTO t VALUES (6697, 7, 35.43, 'name6697');
+INSERT INTO t VALUES (6698, 8, 14.62, 'name6698');
+INSERT INTO t VALUES (6699, 9, 93.81, 'name6699');
+INSERT INTO t VALUES (6700, 0, 73.00, 'name6700');
+INSERT INTO t VALUES (6701, 1, 52.19, 'name6701');
+INSERT INTO t VALUES (6702, 2, 31.38, 'name6702');
+INSERT INTO t VALUES (6703, 3, 10.57, 'name6703');
+INSERT INTO t VALUES (6704, 4, 89.76, 'name6704');
+INSERT INTO t VALUES (6705, 5, 68.95, 'name6705');
+INSERT INTO t VALUES (6706, 6, 48.14, 'name6706');
+INSERT INTO t VALUES (6707, 7, 27.33, 'name6707');
+INSERT INTO t VALUES (6708, 8, 6.52, 'name6708');
+INSERT INTO t VALUES (6709, 9, 85.71, 'name6709');
+INSERT INTO t VALUES (6710, 0, 64.90, 'name6710');
+INSERT INTO t VALUES (6711, 1, 44.09, 'name6711');
+INSERT INTO t VALUES (6712, 2, 23.28, 'name6712');
+INSERT INTO t VALUES (6713, 3, 2.47, 'name6713');
+INSERT INTO t VALUES (6714, 4, 81.66, 'name6714');
+INSERT INTO t VALUES (6715, 5, 60.85, 'name6715');
+INSERT INTO t VALUES (6716, 6, 40.04, 'name6716');
+INSERT INTO t VALUES (6717, 7, 19.23, 'name6717');
+INSERT INTO t VALUES (6718, 8, 98.42, 'name6718');
+INSERT INTO t VALUES (6719, 9, 77.61, 'name6719');
+INSERT INTO t VALUES (6720, 0, 56.80, 'name6720');
+INSERT INTO t VALUES (6721, 1, 35.99, 'name6721');
+INSERT INTO t VALUES (6722, 2, 15.18, 'name6722');
+INSERT INTO t VALUES (6723, 3, 94.37, 'name6723');
+INSERT INTO t VALUES (6724, 4, 73.56, 'name6724');
+INSERT INTO t VALUES (6725, 5, 52.75, 'name6725');
+INSERT INTO t VALUES (6726, 6, 31.94, 'name6726');
+INSERT INTO t VALUES (6727, 7, 11.13, 'name6727');
+INSERT INTO t VALUES (6728, 8, 90.32, 'name6728');
+INSERT INTO t VALUES (6729, 9, 69.51, 'name6729');
+INSERT INTO t VALUES (6730, 0, 48.70, 'name6730');
+INSERT INTO t VALUES (6731, 1, 27.89, 'name6731');
+INSERT INTO t VALUES (6732, 2, 7.08, 'name6732');
+INSERT INTO t VALUES (6733, 3, 86.27, 'name6733');
+INSERT INTO t VALUES (6734, 4, 65.46, 'name6734');
+INSERT INTO t VALUES (6735, 5, 44.65, 'name6735');
+INSERT INTO t VALUES (6736, 6, 23.84, 'name6736');
+INSERT INTO t VALUES (6737, 7, 3.03, 'name6737');
+INSERT INTO t VALUES (6738, 8, 82.22, 'name6738');
+INSERT INTO t VALUES (6739, 9, 61.41, 'name6739');
+INSERT INTO t VALUES (6740, 0, 40.60, 'name6740');
+INSERT INTO t VALUES (6741, 1, 19.79, 'name6741');
+INSERT INTO t VALUES (6742, 2, 98.98, 'name6742');
+INSERT INTO t VALUES (6743, 3, 78.17, 'name6743');
+INSERT INTO t VALUES (6744, 4, 57.36, 'name6744');
+INSERT INTO t VALUES (6745, 5, 36.55, 'name6745');
+INSERT INTO t VALUES (6746, 6, 15.74, 'name6746');
+INSERT INTO t VALUES (6747, 7, 94.93, 'name6747');
+INSERT INTO t VALUES (6748, 8, 74.12, 'name6748');
+INSERT INTO t VALUES (6749, 9, 53.31, 'name6749');
+INSERT INTO t VALUES (6750, 0, 32.50, 'name6750');
+INSERT INTO t VALUES (6751, 1, 11.69, 'name6751');
+INSERT INTO t VALUES (6752, 2, 90.88, 'name6752');
+INSERT INTO t VALUES (6753, 3, 70.07, 'name6753');
+INSERT INTO t VALUES (6754, 4, 49.26, 'name6754');
+INSERT INTO t VALUES (6755, 5, 28.45, 'name6755');
+INSERT INTO t VALUES (6756, 6, 7.64, 'name6756');
+INSERT INTO t VALUES (6757, 7, 86.83, 'name6757');
+INSERT INTO t VALUES (6758, 8, 66.02, 'name6758');
+INSERT INTO t VALUES (6759, 9, 45.21, 'name6759');
+INSERT INTO t VALUES (6760, 0, 24.40, 'name6760');
+INSERT INTO t VALUES (6761, 1, 3.59, 'name6761');
+INSERT INTO t VALUES (6762, 2, 82.78, 'name6762');
+INSERT INTO t VALUES (6763, 3, 61.97, 'name6763');
+INSERT INTO t VALUES (6764, 4, 41.16, 'name6764');
+INSERT INTO t VALUES (6765, 5, 20.35, 'name6765');
+INSERT INTO t VALUES (6766, 6, 99.54, 'name6766');
+INSERT INTO t VALUES (6767, 7, 78.73, 'name6767');
+INSERT INTO t VALUES (6768, 8, 57.92, 'name6768');
+INSERT INTO t VALUES (6769, 9, 37.11, 'name6769');
+INSERT INTO t VALUES (6770, 0, 16.30, 'name6770');
+INSERT INTO t VALUES (6771, 1, 95.49, 'name6771');
+INSERT INTO t VALUES (6772, 2, 74.68, 'name6772');
+INSERT INTO t VALUES (6773, 3, 53.87, 'name6773');
+INSERT INTO t VALUES (6774, 4, 33.06, 'name6774');
+INSERT INTO t VALUES (6775, 5, 12.25, 'name6775');
+INSERT INTO t VALUES (6776, 6, 91.44, 'name6776');
+INSERT INTO t VALUES (6777, 7, 70.63, 'name6777');
+INSERT INTO t VALUES (6778, 8, 49.82, 'name6778');
+INSERT INTO t VALUES (6779, 9, 29.01, 'name6779');
+INSERT INTO t VALUES (6780, 0, 8.20, 'name6780');
+INSERT INTO t VALUES (6781, 1, 87.39, 'name6781');
+INSERT INTO t VALUES (6782, 2, 66.58, 'name6782');
+INSERT INTO t VALUES (6783, 3, 45.77, 'name6783');
+INSERT INTO t VALUES (6784, 4, 24.96, 'name6784');
+INSERT INTO t VALUES (6785, 5, 4.15, 'name6785');
+INSERT INTO t VALUES (6786, 6, 83.34, 'name6786');
+INSERT INTO t VALUES (6787, 7, 62.53, 'name6787');
+INSERT INTO t VALUES (6788, 8, 41.72, 'name6788');
+INSERT INTO t VALUES (6789, 9, 20.91, 'name6789');
+INSERT INTO t VALUES (6790, 0, 0.10, 'name6790');
+INSERT INTO t VALUES (6791, 1, 79.29, 'name6791');
+INSERT INTO t VALUES (6792, 2, 58.48, 'name6792');
+INSERT INTO t VALUES (6793, 3, 37.67, 'name6793');
+INSERT INTO t VALUES (6794, 4, 16.86, 'name6794');
+INSERT INTO t VALUES (6795, 5, 96.05, 'name6795');
+INSERT INTO t VALUES (6796, 6, 75.24, 'name6796');
+INSERT INTO t VALUES (6797, 7, 54.43, 'name6797');
+INSERT INTO t VALUES (6798, 8, 33.62, 'name6798');
+INSERT INTO t VALUES (6799, 9, 12.81, 'name6799');
+INSERT INTO t VALUES (6800, 0, 92.00, 'name6800');
+INSERT INTO t VALUES (6801, 1, 71.19, 'name6801');
+INSERT INTO t VALUES (6802, 2, 50.38, 'name6802');
+INSERT INTO t VALUES (6803, 3, 29.57, 'name6803');
+INSERT INTO t VALUES (6804, 4, 8.76, 'name6804');
+INSERT INTO t VALUES (6805, 5, 87.95, 'name6805');
+INSERT INTO t VALUES (6806, 6, 67.14, 'name6806');
+INSERT INTO t VALUES (6807, 7, 46.33, 'name6807');
+INSERT INTO t VALUES (6808, 8, 25.52, 'name6808');
+INSERT INTO t VALUES (6809, 9, 4.71, 'name6809');
+INSERT INTO t VALUES (6810, 0, 83.90, 'name6810');
+INSERT INTO t VALUES (6811, 1, 63.09, 'name6811');
+INSERT INTO t VALUES (6812, 2, 42.28, 'name6812');
+INSERT INTO t VALUES (6813, 3, 21.47, 'name6813');
+INSERT INTO t VALUES (6814, 4, 0.66, 'name6814');
+INSERT INTO t VALUES (6815, 5, 79.85, 'name6815');
+INSERT INTO t VALUES (6816, 6, 59.04, 'name6816');
+INSERT INTO t VALUES (6817, 7, 38.23, 'name6817');
+INSERT INTO t VALUES (6818, 8, 17.42, 'name6818');
+INSERT INTO t VALUES (6819, 9, 96.61, 'name6819');
+INSERT INTO t VALUES (6820, 0, 75.80, 'name6820');
+INSERT INTO t VALUES (6821, 1, 54.99, 'name6821');
+INSERT INTO t VALUES (6822, 2, 34.18, 'name6822');
+INSERT INTO t VALUES (6823, 3, 13.37, 'name6823');
+INSERT INTO t VALUES (6824, 4, 92.56, 'name6824');
+INSERT INTO t VALUES (6825, 5, 71.75, 'name6825');
+INSERT INTO t VALUES (6826, 6, 50.94, 'name6826');
+INSERT INTO t VALUES (6827, 7, 30.13, 'name6827');
+INSERT INTO t VALUES (6828, 8, 9.32, 'name6828');
+INSERT INTO t VALUES (6829, 9, 88.51, 'name6829');
+INSERT INTO t VALUES (6830, 0, 67.70, 'name6830');
+INSERT INTO t VALUES (6831, 1, 46.89, 'name6831');
+INSERT INTO t VALUES (6832, 2, 26.08, 'name6832');
+INSERT INTO t VALUES (6833, 3, 5.27, 'name6833');
+INSERT INTO t VALUES (6834, 4, 84.46, 'name6834');
+INSERT INTO t VALUES (6835, 5, 63.65, 'name6835');
+INSERT INTO t VALUES (6836, 6, 42.84, 'name6836');
+INSERT INTO t VALUES (6837, 7, 22.03, 'name6837');
+INSERT INTO t VALUES (6838, 8, 1.22, 'name6838');
+INSERT INTO t VALUES (6839, 9, 80.41, 'name6839');
+INSERT INTO t VALUES (6840, 0, 59.60, 'name6840');
+INSERT INTO t VALUES (6841, 1, 38.79, 'name6841');
+INSERT INTO t VALUES (6842, 2, 17.98, 'name6842');
+INSERT INTO t VALUES (6843, 3, 97.17, 'name6843');
+INSERT INTO t VALUES (6844, 4, 76.36, 'name6844');
+INSERT INTO t VALUES (6845, 5, 55.55, 'name6845');
+INSERT INTO t VALUES (6846, 6, 34.74, 'name6846');
+INSERT INTO t VALUES (6847, 7, 13.93, 'name6847');
+INSERT INTO t VALUES (6848, 8, 93.12, 'name6848');
+INSERT INTO t VALUES (6849, 9, 72.31, 'name6849');
+INSERT INTO t VALUES (6850, 0, 51.50, 'name6850');
+INSERT INTO t VALUES (6851, 1, 30.69, 'name6851');
+INSERT INTO t VALUES (6852, 2, 9.88, 'name6852');
+INSERT INTO t VALUES (6853, 3, 89.07, 'name6853');
+INSERT INTO t VALUES (6854, 4, 68.26, 'name6854');
+INSERT INTO t VALUES (6855, 5, 47.45, 'name6855');
+INSERT INTO t VALUES (6856, 6, 26.64, 'name6856');
+INSERT INTO t VALUES (6857, 7, 5.83, 'name6857');
+INSERT INTO t VALUES (6858, 8, 85.02, 'name6858');
+INSERT INTO t VALUES (6859, 9, 64.21, 'name6859');
+INSERT INTO t VALUES (6860, 0, 43.40, 'name6860');
+INSERT INTO t VALUES (6861, 1, 22.59, 'name6861');
+INSERT INTO t VALUES (6862, 2, 1.78, 'name6862');
+INSERT INTO t VALUES (6863, 3, 80.97, 'name6863');
+INSERT INTO t VALUES (6864, 4, 60.16, 'name6864');
+INSERT INTO t VALUES (6865, 5, 39.35, 'name6865');
+INSERT INTO t VALUES (6866, 6, 18.54, 'name6866');
+INSERT INTO t VALUES (6867, 7, 97.73, 'name6867');
+INSERT INTO t VALUES (6868, 8, 76.92, 'name6868');
+INSERT INTO t VALUES (6869, 9, 56.11, 'name6869');
+INSERT INTO t VALUES (6870, 0, 35.30, 'name6870');
+INSERT INTO t VALUES (6871, 1, 14.49, 'name6871');
+INSERT INTO t VALUES (6872, 2, 93.68, 'name6872');
+INSERT INTO t VALUES (6873, 3, 72.87, 'name6873');
+INSERT INTO t VALUES (6874, 4, 52.06, 'name6874');
+INSERT INTO t VALUES (6875, 5, 31.25, 'name6875');
+INSERT INTO t VALUES (6876, 6, 10.44, 'name6876');
+INSERT INTO t VALUES (6877, 7, 89.63, 'name6877');
+INSERT INTO t VALUES (6878, 8, 68.82, 'name6878');
+INSERT INTO t VALUES (6879, 9, 48.01, 'name6879');
+INSERT INTO t VALUES (6880, 0, 27.20, 'name6880');
+INSERT INTO t VALUES (6881, 1, 6.39, 'name6881');
+INSERT INTO t VALUES (6882, 2, 85.58, 'name6882');
+INSERT INTO t VALUES (6883, 3, 64.77, 'name6883');
+INSERT INTO t VALUES (6884, 4, 43.96, 'name6884');
+INSERT INTO t VALUES (6885, 5, 23.15, 'name6885');
+INSERT INTO t VALUES (6886, 6, 2.34, 'name6886');
+INSERT INTO t VALUES (6887, 7, 81.53, 'name6887');
+INSERT INTO t VALUES (6888, 8, 60.72, 'name6888');
+INSERT INTO t VALUES (6889, 9, 39.91, 'name6889');
+INSERT INTO t VALUES (6890, 0, 19.10, 'name6890');
+INSERT INTO t VALUES (6891, 1, 98.29, 'name6891');
+INSERT INTO t VALUES (6892, 2, 77.48, 'name6892');
+INSERT INTO t VALUES (6893, 3, 56.67, 'name6893');
+INSERT INTO t VALUES (6894, 4, 35.86, 'name6894');
+INSERT INTO t VALUES (6895, 5, 15.05, 'name6895');
+INSERT INTO t VALUES (6896, 6, 94.24, 'name6896');
+INSERT INTO t VALUES (6897, 7, 73.43, 'name6897');
+INSERT INTO t VALUES (6898, 8, 52.62, 'name6898');
+INSERT INTO t VALUES (6899, 9, 31.81, 'name6899');
+INSERT INTO t VALUES (6900, 0, 11.00, 'name6900');
+INSERT INTO t VALUES (6901, 1, 90.19, 'name6901');
+INSERT INTO t VALUES (6902, 2, 69.38, 'name6902');
+INSERT INTO t VALUES (6903, 3, 48.57, 'name6903');
+INSERT INTO t VALUES (6904, 4, 27.76, 'name6904');
+INSERT INTO t VALUES (6905, 5, 6.95, 'name6905');
+INSERT INTO t VALUES (6906, 6, 86.14, 'name6906');
+INSERT INTO t VALUES (6907, 7, 65.33, 'name6907');
+INSERT INTO t VALUES (6908, 8, 44.52, 'name6908');
+INSERT INTO t VALUES (6909, 9, 23.71, 'name6909');
+INSERT INTO t VALUES (6910, 0, 2.90, 'name6910');
+INSERT INTO t VALUES (6911, 1, 82.09, 'name6911');
+INSERT INTO t VALUES (6912, 2, 61.28, 'name6912');
+INSERT INTO t VALUES (6913, 3, 40.47, 'name6913');
+INSERT INTO t VALUES (6914, 4, 19.66, 'name6914');
+INSERT INTO t VALUES (6915, 5, 98.85, 'name6915');
+INSERT INTO t VALUES (6916, 6, 78.04, 'name6916');
+INSERT INTO t VALUES (6917, 7, 57.23, 'name6917');
+INSERT INTO t VALUES (6918, 8, 36.42, 'name6918');
+INSERT INTO t VALUES (6919, 9, 15.61, 'name6919');
+INSERT INTO t VALUES (6920, 0, 94.80, 'name6920');
+INSERT INTO t VALUES (6921, 1, 73.99, 'name6921');
+INSERT INTO t VALUES (6922, 2, 53.18, 'name6922');
+INSERT INTO t VALUES (6923, 3, 32.37, 'name6923');
+INSERT INTO t VALUES (6924, 4, 11.56, 'name6924');
+INSERT INTO t VALUES (6925, 5, 90.75, 'name6925');
+INSERT INTO t VALUES (6926, 6, 69.94, 'name6926');
+INSERT INTO t VALUES (6927, 7, 49.13, 'name6927');
+INSERT INTO t VALUES (6928, 8, 28.32, 'name6928');
+INSERT INTO t VALUES (6929, 9, 7.51, 'name6929');
+INSERT INTO t VALUES (6930, 0, 86.70, 'name6930');
+INSERT INTO t VALUES (6931, 1, 65.89, 'name6931');
+INSERT INTO t VALUES (6932, 2, 45.08, 'name6932');
+INSERT INTO t VALUES (6933, 3, 24.27, 'name6933');
+INSERT INTO t VALUES (6934, 4, 3.46, 'name6934');
+INSERT INTO t VALUES (6935, 5, 82.65, 'name6935');
+INSERT INTO t VALUES (6936, 6, 61.84, 'name6936');
+INSERT INTO t VALUES (6937, 7, 41.03, 'name6937');
+INSERT INTO t VALUES (6938, 8, 20.22, 'name6938');
+INSERT INTO t VALUES (6939, 9, 99.41, 'name6939');
+INSERT INTO t VALUES (6940, 0, 78.60, 'name6940');
+INSERT INTO t VALUES (6941, 1, 57.79, 'name6941');
+INSERT INTO t VALUES (6942, 2, 36.98, 'name6942');
+INSERT INTO t VALUES (6943, 3, 16.17, 'name6943');
+INSERT INTO t VALUES (6944, 4, 95.36, 'name6944');
+INSERT INTO t VALUES (6945, 5, 74.55, 'name6945');
+INSERT INTO t VALUES (6946, 6, 53.74, 'name6946');
+INSERT INTO t VALUES (6947, 7, 32.93, 'name6947');
+INSERT INTO t VALUES (6948, 8, 12.12, 'name6948');
+INSERT INTO t VALUES (6949, 9, 91.31, 'name6949');
+INSERT INTO t VALUES (6950, 0, 70.50, 'name6950');
+INSERT INTO t VALUES (6951, 1, 49.69, 'name6951');
+INSERT INTO t VALUES (6952, 2, 28.88, 'name6952');
+INSERT INTO t VALUES (6953, 3, 8.07, 'name6953');
+INSERT INTO t VALUES (6954, 4, 87.26, 'name6954');
+INSERT INTO t VALUES (6955, 5, 66.45, 'name6955');
+INSERT INTO t VALUES (6956, 6, 45.64, 'name6956');
+INSERT INTO t VALUES (6957, 7, 24.83, 'name6957');
+INSERT INTO t VALUES (6958, 8, 4.02, 'name6958');
+INSERT INTO t VALUES (6959, 9, 83.21, 'name6959');
+INSERT INTO t VALUES (6960, 0, 62.40, 'name6960');
+INSERT INTO t VALUES (6961, 1, 41.59, 'name6961');
+INSERT INTO t VALUES (6962, 2, 20.78, 'name6962');
+INSERT INTO t VALUES (6963, 3, 99.97, 'name6963');
+INSERT INTO t VALUES (6964, 4, 79.16, 'name6964');
+INSERT INTO t VALUES (6965, 5, 58.35, 'name6965');
+INSERT INTO t VALUES (6966, 6, 37.54, 'name6966');
+INSERT INTO t VALUES (6967, 7, 16.73, 'name6967');
+INSERT INTO t VALUES (6968, 8, 95.92, 'name6968');
+INSERT INTO t VALUES (6969, 9, 75.11, 'name6969');
+INSERT INTO t VALUES (6970, 0, 54.30, 'name6970');
+INSERT INTO t VALUES (6971, 1, 33.49, 'name6971');
+INSERT INTO t VALUES (6972, 2, 12.68, 'name6972');
+INSERT INTO t VALUES (6973, 3, 91.87, 'name6973');
+INSERT INTO t VALUES (6974, 4, 71.06, 'name6974');
+INSERT INTO t VALUES (6975, 5, 50.25, 'name6975');
+INSERT INTO t VALUES (6976, 6, 29.44, 'name6976');
+INSERT INTO t VALUES (6977, 7, 8.63, 'name6977');
+INSERT INTO t VALUES (6978, 8, 87.82, 'name6978');
+INSERT INTO t VALUES (6979, 9, 67.01, 'name6979');
+INSERT INTO t VALUES (6980, 0, 46.20, 'name6980');
+INSERT INTO t VALUES (6981, 1, 25.39, 'name6981');
+INSERT INTO t VALUES (6982, 2, 4.58, 'name6982');
+INSERT INTO t VALUES (6983, 3, 83.77, 'name6983');
+INSERT INTO t VALUES (6984, 4, 62.96, 'name6984');
+INSERT INTO t VALUES (6985, 5, 42.15, 'name6985');
+INSERT INTO t VALUES (6986, 6, 21.34, 'name6986');
+INSERT INTO t VALUES (6987, 7, 0.53, 'name6987');
+INSERT INTO t VALUES (6988, 8, 79.72, 'name6988');
+INSERT INTO t VALUES (6989, 9, 58.91, 'name6989');
+INSERT INTO t VALUES (6990, 0, 38.10, 'name6990');
+INSERT INTO t VALUES (6991, 1, 17.29, 'name6991');
+INSERT INTO t VALUES (6992, 2, 96.48, 'name6992');
+INSERT INTO t VALUES (6993, 3, 75.67, 'name6993');
+INSERT INTO t VALUES (6994, 4, 54.86, 'name6994');
+INSERT INTO t VALUES (6995, 5, 34.05, 'name6995');
+INSERT INTO t VALUES (6996, 6, 13.24, 'name6996');
+INSERT INTO t VALUES (6997, 7, 92.43, 'name6997');
+INSERT INTO t VALUES (6998, 8, 71.62, 'name6998');
+INSERT INTO t VALUES (6999, 9, 50.81, 'name6999');
+INSERT INTO t VALUES (7000, 0, 30.00, 'name7000');
+INSERT INTO t VALUES (7001, 1, 9.19, 'name7001');
+INSERT INTO t VALUES (7002, 2, 88.38, 'name7002');
+INSERT INTO t VALUES (7003, 3, 67.57, 'name7003');
+INSERT INTO t VALUES (7004, 4, 46.76, 'name7004');
+INSERT INTO t VALUES (7005, 5, 25.95, 'name7005');
+INSERT INTO t VALUES (7006, 6, 5.14, 'name7006');
+INSERT INTO t VALUES (7007, 7, 84.33, 'name7007');
+INSERT INTO t VALUES (7008, 8, 63.52, 'name7008');
+INSERT INTO t VALUES (7009, 9, 42.71, 'name7009');
+INSERT INTO t VALUES (7010, 0, 21.90, 'name7010');
+INSERT INTO t VALUES (7011, 1, 1.09, 'name7011');
+INSERT INTO t VALUES (7012, 2, 80.28, 'name7012');
+INSERT INTO t VALUES (7013, 3, 59.47, 'name7013');
+INSERT INTO t VALUES (7014, 4, 38.66, 'name7014');
+INSERT INTO t VALUES (7015, 5, 17.85, 'name7015');
+INSERT INTO t VALUES (7016, 6, 97.04, 'name7016');
+INSERT INTO t VALUES (7017, 7, 76.23, 'name7017');
+INSERT INTO t VALUES (7018, 8, 55.42, 'name7018');
+INSERT INTO t VALUES (7019, 9, 34.61, 'name7019');
+INSERT INTO t VALUES (7020, 0, 13.80, 'name7020');
+INSERT INTO t VALUES (7021, 1, 92.99, 'name7021');
+INSERT INTO t VALUES (7022, 2, 72.18, 'name7022');
+INSERT INTO t VALUES (7023, 3, 51.37, 'name7023');
+INSERT INTO t VALUES (7024, 4, 30.56, 'name7024');
+INSERT INTO t VALUES (7025, 5, 9.75, 'name7025');
+INSERT INTO t VALUES (7026, 6, 88.94, 'name7026');
+INSERT INTO t VALUES (7027, 7, 68.13, 'name7027');
+INSERT INTO t VALUES (7028, 8, 47.32, 'name7028');
+INSERT INTO t VALUES (7029, 9, 26.51, 'name7029');
+INSERT INTO t VALUES (7030, 0, 5.70, 'name7030');
+INSERT INTO t VALUES (7031, 1, 84.89, 'name7031');
+INSERT INTO t VALUES (7032, 2, 64.08, 'name7032');
+INSERT INTO t VALUES (7033, 3, 43.27, 'name7033');
+INSERT INTO t VALUES (7034, 4, 22.46, 'name7034');
+INSERT INTO t VALUES (7035, 5, 1.65, 'name7035');
+INSERT INTO t VALUES (7036, 6, 80.84, 'name7036');
+INSERT INTO t VALUES (7037, 7, 60.03, 'name7037');
+INSERT INTO t VALUES (7038, 8, 39.22, 'name7038');
+INSERT INTO t VALUES (7039, 9, 18.41, 'name7039');
+INSERT INTO t VALUES (7040, 0, 97.60, 'name7040');
+INSERT INTO t VALUES (7041, 1, 76.79, 'name7041');
+INSERT INTO t VALUES (7042, 2, 55.98, 'name7042');
+INSERT INTO t VALUES (7043, 3, 35.17, 'name7043');
+INSERT INTO t VALUES (7044, 4, 14.36, 'name7044');
+INSERT INTO t VALUES (7045, 5, 93.55, 'name7045');
+INSERT INTO t VALUES (7046, 6, 72.74, 'name7046');
+INSERT INTO t VALUES (7047, 7, 51.93, 'name7047');
+INSERT INTO t VALUES (7048, 8, 31.12, 'name7048');
+INSERT INTO t VALUES (7049, 9, 10.31, 'name7049');
+INSERT INTO t VALUES (7050, 0, 89.50, 'name7050');
+INSERT INTO t VALUES (7051, 1, 68.69, 'name7051');
+INSERT INTO t VALUES (7052, 2, 47.88, 'name7052');
+INSERT INTO t VALUES (7053, 3, 27.07, 'name7053');
+INSERT INTO t VALUES (7054, 4, 6.26, 'name7054');
+INSERT INTO t VALUES (7055, 5, 85.45, 'name7055');
+INSERT INTO t VALUES (7056, 6, 64.64, 'name7056');
+INSERT INTO t VALUES (7057, 7, 43.83, 'name7057');
+INSERT INTO t VALUES (7058, 8, 23.02, 'name7058');
+INSERT INTO t VALUES (7059, 9, 2.21, 'name7059');
+INSERT INTO t VALUES (7060, 0, 81.40, 'name7060');
+INSERT INTO t VALUES (7061, 1, 60.59, 'name7061');
+INSERT INTO t VALUES (7062, 2, 39.78, 'name7062');
+INSERT INTO t VALUES (7063, 3, 18.97, 'name7063');
+INSERT INTO t VALUES (7064, 4, 98.16, 'name7064');
+INSERT INTO t VALUES (7065, 5, 77.35, 'name7065');
+INSERT INTO t VALUES (7066, 6, 56.54, 'name7066');
+INSERT INTO t VALUES (7067, 7, 35.73, 'name7067');
+INSERT INTO t VALUES (7068, 8, 14.92, 'name7068');
+INSERT INTO t VALUES (7069, 9, 94.11, 'name7069');
+INSERT INTO t VALUES (7070, 0, 73.30, 'name7070');
+INSERT INTO t VALUES (7071, 1, 52.49, 'name7071');
+INSERT INTO t VALUES (7072, 2, 31.68, 'name7072');
+INSERT INTO t VALUES (7073, 3, 10.87, 'name7073');
+INSERT INTO t VALUES (7074, 4, 90.06, 'name7074');
+INSERT INTO t VALUES (7075, 5, 69.25, 'name7075');
+INSERT INTO t VALUES (7076, 6, 48.44, 'name7076');
+INSERT INTO t VALUES (7077, 7, 27.63, 'name7077');
+INSERT INTO t VALUES (7078, 8, 6.82, 'name7078');
+INSERT INTO t VALUES (7079, 9, 86.01, 'name7079');
+INSERT INTO t VALUES (7080, 0, 65.20, 'name7080');
+INSERT INTO t VALUES (7081, 1, 44.39, 'name7081');
+INSERT INTO t VALUES (7082, 2, 23.58, 'name7082');
+INSERT INTO t VALUES (7083, 3, 2.77, 'name7083');
+INSERT INTO t VALUES (7084, 4, 81.96, 'name7084');
+INSERT INTO t VALUES (7085, 5, 61.15, 'name7085');
+INSERT INTO t VALUES (7086, 6, 40.34, 'name7086');
+INSERT INTO t VALUES (7087, 7, 19.53, 'name7087');
+INSERT INTO t VALUES (7088, 8, 98.72, 'name7088');
+INSERT INTO t VALUES (7089, 9, 77.91, 'name7089');
+INSERT INTO t VALUES (7090, 0, 57.10, 'name7090');
+INSERT INTO t VALUES (7091, 1, 36.29, 'name7091');
+INSERT INTO t VALUES (7092, 2, 15.48, 'name7092');
+INSERT INTO t VALUES (7093, 3, 94.67, 'name7093');
+INSERT INTO t VALUES (7094, 4, 73.86, 'name7094');
+INSERT INTO t VALUES (7095, 5, 53.05, 'name7095');
+INSERT INTO t VALUES (7096, 6, 32.24, 'name7096');
+INSERT INTO t VALUES (7097, 7, 11.43, 'name7097');
+INSERT INTO t VALUES (7098, 8, 90.62, 'name7098');
+INSERT INTO t VALUES (7099, 9, 69.81, 'name7099');
+INSERT INTO t VALUES (7100, 0, 49.00, 'name7100');
+INSERT INTO t VALUES (7101, 1, 28.19, 'name7101');
+INSERT INTO t VALUES (7102, 2, 7.38, 'name7102');
+INSERT INTO t VALUES (7103, 3, 86.57, 'name7103');
+INSERT INTO t VALUES (7104, 4, 65.76, 'name7104');
+INSERT INTO t VALUES (7105, 5, 44.95, 'name7105');
+INSERT INTO t VALUES (7106, 6, 24.14, 'name7106');
+INSERT INTO t VALUES (7107, 7, 3.33, 'name7107');
+INSERT INTO t VALUES (7108, 8, 82.52, 'name7108');
+INSERT INTO t VALUES (7109, 9, 61.71, 'name7109');
+INSERT INTO t VALUES (7110, 0, 40.90, 'name7110');
+INSERT INTO t VALUES (7111, 1, 20.09, 'name7111');
+INSERT INTO t VALUES (7112, 2, 99.28, 'name7112');
+INSERT INTO t VALUES (7113, 3, 78.47, 'name7113');
+INSERT INTO t VALUES (7114, 4, 57.66, 'name7114');
+INSERT INTO t VALUES (7115, 5, 36.85, 'name7115');
+INSERT INTO t VALUES (7116, 6, 16.04, 'name7116');
+INSERT INTO t VALUES (7117, 7, 95.23, 'name7117');
+INSERT INTO t VALUES (7118, 8, 74.42, 'name7118');
+INSERT INTO t VALUES (7119, 9, 53.61, 'name7119');
+INSERT INTO t VALUES (7120, 0, 32.80, 'name7120');
+INSERT INTO t VALUES (7121, 1, 11.99, 'name7121');
+INSERT INTO t VALUES (7122, 2, 91.18, 'name7122');
+INSERT INTO t VALUES (7123, 3, 70.37, 'name7123');
+INSERT INTO t VALUES (7124, 4, 49.56, 'name7124');
+INSERT INTO t VALUES (7125, 5, 28.75, 'name7125');
+INSERT INTO t VALUES (7126, 6, 7.94, 'name7126');
+INSERT INTO t VALUES (7127, 7, 87.13, 'name7127');
+INSERT INTO t VALUES (7128, 8, 66.32, 'name7128');
+INSERT INTO t VALUES (7129, 9, 45.51, 'name7129');
+INSERT INTO t VALUES (7130, 0, 24.70, 'name7130');
+INSERT INTO t VALUES (7131, 1, 3.89, 'name7131');
+INSERT INTO t VALUES (7132, 2, 83.08, 'name7132');
+INSERT INTO t VALUES (7133, 3, 62.27, 'name7133');
+INSERT INTO t VALUES (7134, 4, 41.46, 'name7134');
+INSERT INTO t VALUES (7135, 5, 20.65, 'name7135');
+INSERT INTO t VALUES (7136, 6, 99.84, 'name7136');
+INSERT INTO t VALUES (7137, 7, 79.03, 'name7137');
+INSERT INTO t VALUES (7138, 8, 58.22, 'name7138');
+INSERT INTO t VALUES (7139, 9, 37.41, 'name7139');
+INSERT INTO t VALUES (7140, 0, 16.60, 'name7140');
+INSERT INTO t VALUES (7141, 1, 95.79, 'name7141');
+INSERT INTO t VALUES (7142, 2, 74.98, 'name7142');
+INSERT INTO t VALUES (7143, 3, 54.17, 'name7143');
+INSERT INTO t VALUES (7144, 4, 33.36, 'name7144');
+INSERT INTO t VALUES (7145, 5, 12.55, 'name7145');
+INSERT INTO t VALUES (7146, 6, 91.74, 'name7146');
+INSERT INTO t VALUES (7147, 7, 70.93, 'name7147');
+INSERT INTO t VALUES (7148, 8, 50.12, 'name7148');
+INSERT INTO t VALUES (7149, 9, 29.31, 'name7149');
+INSERT INTO t VALUES (7150, 0, 8.50, 'name7150');
+INSERT INTO t VALUES (7151, 1, 87.69, 'name7151');
+INSERT INTO t VALUES (7152, 2, 66.88, 'name7152');
+INSERT INTO t VALUES (7153, 3, 46.07, 'name7153');
+INSERT INTO t VALUES (7154, 4, 25.26, 'name7154');
+INSERT INTO t VALUES (7155, 5, 4.45, 'name7155');
+INSERT INTO t VALUES (7156, 6, 83.64, 'name7156');
+INSERT INTO t VALUES (7157, 7, 62.83, 'name7157');
+INSERT INTO t VALUES (7158, 8, 42.02, 'name7158');
+INSERT INTO t VALUES (7159, 9, 21.21, 'name7159');
+INSERT INTO t VALUES (7160, 0, 0.40, 'name7160');
+INSERT INTO t VALUES (7161, 1, 79.59, 'name7161');
+INSERT INTO t VALUES (7162, 2, 58.78, 'name7162');
+INSERT INTO t VALUES (7163, 3, 37.97, 'name7163');
+INSERT INTO t VALUES (7164, 4, 17.16, 'name7164');
+INSERT INTO t VALUES (7165, 5, 96.35, 'name7165');
+INSERT INTO t VALUES (7166, 6, 75.54, 'name7166');
+INSERT INTO t VALUES (7167, 7, 54.73, 'name7167');
+INSERT INTO t VALUES (7168, 8, 33.92, 'name7168');
+INSERT INTO t VALUES (7169, 9, 13.11, 'name7169');
+INSERT INTO t VALUES (7170, 0, 92.30, 'name7170');
+INSERT INTO t VALUES (7171, 1, 71.49, 'name7171');
+INSERT INTO t VALUES (7172, 2, 50.68, 'name7172');
+INSERT INTO t VALUES (7173, 3, 29.87, 'name7173');
+INSERT INTO t VALUES (7174, 4, 9.06, 'name7174');
+INSERT INTO t VALUES (7175, 5, 88.25, 'name7175');
+INSERT INTO t VALUES (7176, 6, 67.44, 'name7176');
+INSERT INTO t VALUES (7177, 7, 46.63, 'name7177');
+INSERT INTO t VALUES (7178, 8, 25.82, 'name7178');
+INSERT INTO t VALUES (7179, 9, 5.01, 'name7179');
+INSERT INTO t VALUES (7180, 0, 84.20, 'name7180');
+INSERT INTO t VALUES (7181, 1, 63.39, 'name7181');
+INSERT INTO t VALUES (7182, 2, 42.58, 'name7182');
+INSERT INTO t VALUES (7183, 3, 21.77, 'name7183');
+INSERT INTO t VALUES (7184, 4, 0.96, 'name7184');
+INSERT INTO t VALUES (7185, 5, 80.15, 'name7185');
+INSERT INTO t VALUES (7186, 6, 59.34, 'name7186');
+INSERT INTO t VALUES (7187, 7, 38.53, 'name7187');
+INSERT INTO t VALUES (7188, 8, 17.72, 'name7188');
+INSERT INTO t VALUES (7189, 9, 96.91, 'name7189');
+INSERT INTO t VALUES (7190, 0, 76.10, 'name7190');
+INSERT INTO t VALUES (7191, 1, 55.29, 'name7191');
+INSERT INTO t VALUES (7192, 2, 34.48, 'name7192');
+INSERT INTO t VALUES (7193, 3, 13.67, 'name7193');
+INSERT INTO t VALUES (7194, 4, 92.86, 'name7194');
+INSERT INTO t VALUES (7195, 5, 72.05, 'name7195');
+INSERT INTO t VALUES (7196, 6, 51.24, 'name7196');
+INSERT INTO t VALUES (7197, 7, 30.43, 'name7197');
+INSERT INTO t VALUES (7198, 8, 9.62, 'name7198');
+INSERT INTO t VALUES (7199, 9, 88.81, 'name7199');
+INSERT INTO t VALUES (7200, 0, 68.00, 'name7200');
+INSERT INTO t VALUES (7201, 1, 47.19, 'name7201');
+INSERT INTO t VALUES (7202, 2, 26.38, 'name7202');
+INSERT INTO t VALUES (7203, 3, 5.57, 'name7203');
+INSERT INTO t VALUES (7204, 4, 84.76, 'name7204');
+INSERT INTO t VALUES (7205, 5, 63.95, 'name7205');
+INSERT INTO t VALUES (7206, 6, 43.14, 'name7206');
+INSERT INTO t VALUES (7207, 7, 22.33, 'name7207');
+INSERT INTO t VALUES (7208, 8, 1.52, 'name7208');
+INSERT INTO t VALUES (7209, 9, 80.71, 'name7209');
+INSERT INTO t VALUES (7210, 0, 59.90, 'name7210');
+INSERT INTO t VALUES (7211, 1, 39.09, 'name7211');
+INSERT INTO t VALUES (7212, 2, 18.28, 'name7212');
+INSERT INTO t VALUES (7213, 3, 97.47, 'name7213');
+INSERT INTO t VALUES (7214, 4, 76.66, 'name7214');
+INSERT INTO t VALUES (7215, 5, 55.85, 'name7215');
+INSERT INTO t VALUES (7216, 6, 35.04, 'name7216');
+INSERT INTO t VALUES (7217, 7, 14.23, 'name7217');
+INSERT INTO t VALUES (7218, 8, 93.42, 'name7218');
+INSERT INTO t VALUES (7219, 9, 72.61, 'name7219');
+INSERT INTO t VALUES (7220, 0, 51.80, 'name7220');
+INSERT INTO t VALUES (7221, 1, 30.99, 'name7221');
+INSERT INTO t VALUES (7222, 2, 10.18, 'name7222');
+INSERT INTO t VALUES (7223, 3, 89.37, 'name7223');
+INSERT INTO t VALUES (7224, 4, 68.56, 'name7224');
+INSERT INTO t VALUES (7225, 5, 47.75, 'name7225');
+INSERT INTO t VALUES (7226, 6, 26.94, 'name7226');
+INSERT INTO t VALUES (7227, 7, 6.13, 'name7227');
+INSERT INTO t VALUES (7228, 8, 85.32, 'name7228');
+INSERT INTO t VALUES (7229, 9, 64.51, 'name7229');
+INSERT INTO t VALUES (7230, 0, 43.70, 'name7230');
+INSERT INTO t VALUES (7231, 1, 22.89, 'name7231');
+INSERT INTO t VALUES (7232, 2, 2.08, 'name7232');
+INSERT INTO t VALUES (7233, 3, 81.27, 'name7233');
+INSERT INTO t VALUES (7234, 4, 60.46, 'name7234');
+INSERT INTO t VALUES (7235, 5, 39.65, 'name7235');
+INSERT INTO t VALUES (7236, 6, 18.84, 'name7236');
+INSERT INTO t VALUES (7237, 7, 98.03, 'name7237');
+INSERT INTO t VALUES (7238, 8, 77.22, 'name7238');
+INSERT INTO t VALUES (7239, 9, 56.41, 'name7239');
+INSERT INTO t VALUES (7240, 0, 35.60, 'name7240');
+INSERT INTO t VALUES (7241, 1, 14.79, 'name7241');
+INSERT INTO t VALUES (7242, 2, 93.98, 'name7242');
+INSERT INTO t VALUES (7243, 3, 73.17, 'name7243');
+INSERT INTO t VALUES (7244, 4, 52.36, 'name7244');
+INSERT INTO t VALUES (7245, 5, 31.55, 'name7245');
+INSERT INTO t VALUES (7246, 6, 10.74, 'name7246');
+INSERT INTO t VALUES (7247, 7, 89.93, 'name7247');
+INSERT INTO t VALUES (7248, 8, 69.12, 'name7248');
+INSERT INTO t VALUES (7249, 9, 48.31, 'name7249');
+INSERT INTO t VALUES (7250, 0, 27.50, 'name7250');
+INSERT INTO t VALUES (7251, 1, 6.69, 'name7251');
+INSERT INTO t VALUES (7252, 2, 85.88, 'name7252');
+INSERT INTO t VALUES (7253, 3, 65.07, 'name7253');
+INSERT INTO t VALUES (7254, 4, 44.26, 'name7254');
+INSERT INTO t VALUES (7255, 5, 23.45, 'name7255');
+INSERT INTO t VALUES (7256, 6, 2.64, 'name7256');
+INSERT INTO t VALUES (7257, 7, 81.83, 'name7257');
+INSERT INTO t VALUES (7258, 8, 61.02, 'name7258');
+INSERT INTO t VALUES (7259, 9, 40.21, 'name7259');
+INSERT INTO t VALUES (7260, 0, 19.40, 'name7260');
+INSERT INTO t VALUES (7261, 1, 98.59, 'name7261');
+INSERT INTO t VALUES (7262, 2, 77.78, 'name7262');
+INSERT INTO t VALUES (7263, 3, 56.97, 'name7263');
+INSERT INTO t VALUES (7264, 4, 36.16, 'name7264');
+INSERT INTO t VALUES (7265, 5, 15.35, 'name7265');
+INSERT INTO t VALUES (7266, 6, 94.54, 'name7266');
+INSERT INTO t VALUES (7267, 7, 73.73, 'name7267');
+INSERT INTO t VALUES (7268, 8, 52.92, 'name7268');
+INSERT INTO t VALUES (7269, 9, 32.11, 'name7269');
+INSERT INTO t VALUES (7270, 0, 11.30, 'name7270');
+INSERT INTO t VALUES (7271, 1, 90.49, 'name7271');
+INSERT INTO t VALUES (7272, 2, 69.68, 'name7272');
+INSERT INTO t VALUES (7273, 3, 48.87, 'name7273');
+INSERT INTO t VALUES (7274, 4, 28.06, 'name7274');
+INSERT INTO t VALUES (7275, 5, 7.25, 'name7275');
+INSERT INTO t VALUES (7276, 6, 86.44, 'name7276');
+INSERT INTO t VALUES (7277, 7, 65.63, 'name7277');
+INSERT INTO t VALUES (7278, 8, 44.82, 'name7278');
+INSERT INTO t VALUES (7279, 9, 24.01, 'name7279');
+INSERT INTO t VALUES (7280, 0, 3.20, 'name7280');
+INSERT INTO t VALUES (7281, 1, 82.39, 'name7281');
+INSERT INTO t VALUES (7282, 2, 61.58, 'name7282');
+INSERT INTO t VALUES (7283, 3, 40.77, 'name7283');
+INSERT INTO t VALUES (7284, 4, 19.96, 'name7284');
+INSERT INTO t VALUES (7285, 5, 99.15, 'name7285');
+INSERT INTO t VALUES (7286, 6, 78.34, 'name7286');
+INSERT INTO t VALUES (7287, 7, 57.53, 'name7287');
+INSERT INTO t VALUES (7288, 8, 36.72, 'name7288');
+INSERT INTO t VALUES (7289, 9, 15.91, 'name7289');
+INSERT INTO t VALUES (7290, 0, 95.10, 'name7290');
+INSERT INTO t VALUES (7291, 1, 74.29, 'name7291');
+INSERT INTO t VALUES (7292, 2, 53.48, 'name7292');
+INSERT INTO t VALUES (7293, 3, 32.67, 'name7293');
+INSERT INTO t VALUES (7294, 4, 11.86, 'name7294');
+INSERT INTO t VALUES (7295, 5, 91.05, 'name7295');
+INSERT INTO t VALUES (7296, 6, 70.24, 'name7296');
+INSERT INTO t VALUES (7297, 7, 49.43, 'name7297');
+INSERT INTO t VALUES (7298, 8, 28.62, 'name7298');
+INSERT INTO t VALUES (7299, 9, 7.81, 'name7299');
+INSERT INTO t VALUES (7300, 0, 87.00, 'name7300');
+INSERT INTO t VALUES (7301, 1, 66.19, 'name7301');
+INSERT INTO t VALUES (7302, 2, 45.38, 'name7302');
+INSERT INTO t VALUES (7303, 3, 24.57, 'name7303');
+INSERT INTO t VALUES (7304, 4, 3.76, 'name7304');
+INSERT INTO t VALUES (7305, 5, 82.95, 'name7305');
+INSERT INTO t VALUES (7306, 6, 62.14, 'name7306');
+INSERT INTO t VALUES (7307, 7, 41.33, 'name7307');
+INSERT INTO t VALUES (7308, 8, 20.52, 'name7308');
+INSERT INTO t VALUES (7309, 9, 99.71, 'name7309');
+INSERT INTO t VALUES (7310, 0, 78.90, 'name7310');
+INSERT INTO t VALUES (7311, 1, 58.09, 'name7311');
+INSERT INTO t VALUES (7312, 2, 37.28, 'name7312');
+INSERT INTO t VALUES (7313, 3, 16.47, 'name7313');
+INSERT INTO t VALUES (7314, 4, 95.66, 'name7314');
+INSERT INTO t VALUES (7315, 5, 74.85, 'name7315');
+INSERT INTO t VALUES (7316, 6, 54.04, 'name7316');
+INSERT INTO t VALUES (7317, 7, 33.23, 'name7317');
+INSERT INTO t VALUES (7318, 8, 12.42, 'name7318');
+INSERT INTO t VALUES (7319, 9, 91.61, 'name7319');
+INSERT INTO t VALUES (7320, 0, 70.80, 'name7320');
+INSERT INTO t VALUES (7321, 1, 49.99, 'name7321');
+INSERT INTO t VALUES (7322, 2, 29.18, 'name7322');
+INSERT INTO t VALUES (7323, 3, 8.37, 'name7323');
+INSERT INTO t VALUES (7324, 4, 87.56, 'name7324');
+INSERT INTO t VALUES (7325, 5, 66.75, 'name7325');
+INSERT INTO t VALUES (7326, 6, 45.94, 'name7326');
+INSERT INTO t VALUES (7327, 7, 25.13, 'name7327');
+INSERT INTO t VALUES (7328, 8, 4.32, 'name7328');
+INSERT INTO t VALUES (7329, 9, 83.51, 'name7329');
+INSERT INTO t VALUES (7330, 0, 62.70, 'name7330');
+INSERT INTO t VALUES (7331, 1, 41.89, 'name7331');
+INSERT INTO t VALUES (7332, 2, 21.08, 'name7332');
+INSERT INTO t VALUES (7333, 3, 0.27, 'name7333');
+INSERT INTO t VALUES (7334, 4, 79.46, 'name7334');
+INSERT INTO t VALUES (7335, 5, 58.65, 'name7335');
+INSERT INTO t VALUES (7336, 6, 37.84, 'name7336');
+INSERT INTO t VALUES (7337, 7, 17.03, 'name7337');
+INSERT INTO t VALUES (7338, 8, 96.22, 'name7338');
+INSERT INTO t VALUES (7339, 9, 75.41, 'name7339');
+INSERT INTO t VALUES (7340, 0, 54.60, 'name7340');
+INSERT INTO t VALUES (7341, 1, 33.79, 'name7341');
+INSERT INTO t VALUES (7342, 2, 12.98, 'name7342');
+INSERT INTO t VALUES (7343, 3, 92.17, 'name7343');
+INSERT INTO t VALUES (7344, 4, 71.36, 'name7344');
+INSERT INTO t VALUES (7345, 5, 50.55, 'name7345');
+INSERT INTO t VALUES (7346, 6, 29.74, 'name7346');
+INSERT INTO t VALUES (7347, 7, 8.93, 'name7347');
+INSERT INTO t VALUES (7348, 8, 88.12, 'name7348');
+INSERT INTO t VALUES (7349, 9, 67.31, 'name7349');
+INSERT INTO t VALUES (7350, 0, 46.50, 'name7350');
+INSERT INTO t VALUES (7351, 1, 25.69, 'name7351');
+INSERT INTO t VALUES (7352, 2, 4.88, 'name7352');
+INSERT INTO t VALUES (7353, 3, 84.07, 'name7353');
+INSERT INTO t VALUES (7354, 4, 63.26, 'name7354');
+INSERT INTO t VALUES (7355, 5, 42.45, 'name7355');
+INSERT INTO t VALUES (7356, 6, 21.64, 'name7356');
+INSERT INTO t VALUES (7357, 7, 0.83, 'name7357');
+INSERT INTO t VALUES (7358, 8, 80.02, 'name7358');
+INSERT INTO t VALUES (7359, 9, 59.21, 'name7359');
+INSERT INTO t VALUES (7360, 0, 38.40, 'name7360');
+INSERT INTO t VALUES (7361, 1, 17.59, 'name7361');
+INSERT INTO t VALUES (7362, 2, 96.78, 'name7362');
+INSERT INTO t VALUES (7363, 3, 75.97, 'name7363');
+INSERT INTO t VALUES (7364, 4, 55.16, 'name7364');
+INSERT INTO t VALUES (7365, 5, 34.35, 'name7365');
+INSERT INTO t VALUES (7366, 6, 13.54, 'name7366');
+INSERT INTO t VALUES (7367, 7, 92.73, 'name7367');
+INSERT INTO t VALUES (7368, 8, 71.92, 'name7368');
+INSERT INTO t VALUES (7369, 9, 51.11, 'name7369');
+INSERT INTO t VALUES (7370, 0, 30.30, 'name7370');
+INSERT INTO t VALUES (7371, 1, 9.49, 'name7371');
+INSERT INTO t VALUES (7372, 2, 88.68, 'name7372');
+INSERT INTO t VALUES (7373, 3, 67.87, 'name7373');
+INSERT INTO t VALUES (7374, 4, 47.06, 'name7374');
+INSERT INTO t VALUES (7375, 5, 26.25, 'name7375');
+INSERT INTO t VALUES (7376, 6, 5.44, 'name7376');
+INSERT INTO t VALUES (7377, 7, 84.63, 'name7377');
+INSERT INTO t VALUES (7378, 8, 63.82, 'name7378');
+INSERT INTO t VALUES (7379, 9, 43.01, 'name7379');
+INSERT INTO t VALUES (7380, 0, 22.20, 'name7380');
+INSERT INTO t VALUES (7381, 1, 1.39, 'name7381');
+INSERT INTO t VALUES (7382, 2, 80.58, 'name7382');
+INSERT INTO t VALUES (7383, 3, 59.77, 'name7383');
+INSERT INTO t VALUES (7384, 4, 38.96, 'name7384');
+INSERT INTO t VALUES (7385, 5, 18.15, 'name7385');
+INSERT INTO t VALUES (7386, 6, 97.34, 'name7386');
+INSERT INTO t VALUES (7387, 7, 76.53, 'name7387');
+INSERT INTO t VALUES (7388, 8, 55.72, 'name7388');
+INSERT INTO t VALUES (7389, 9, 34.91, 'name7389');
+INSERT INTO t VALUES (7390, 0, 14.10, 'name7390');
+INSERT INTO t VALUES (7391, 1, 93.29, 'name7391');
+INSERT INTO t VALUES (7392, 2, 72.48, 'name7392');
+INSERT INTO t VALUES (7393, 3, 51.67, 'name7393');
+INSERT INTO t VALUES (7394, 4, 30.86, 'name7394');
+INSERT INTO t VALUES (7395, 5, 10.05, 'name7395');
+INSERT INTO t VALUES (7396, 6, 89.24, 'name7396');
+INSERT INTO t VALUES (7397, 7, 68.43, 'name7397');
+INSERT INTO t VALUES (7398, 8, 47.62, 'name7398');
+INSERT INTO t VALUES (7399, 9, 26.81, 'name7399');
+INSERT INTO t VALUES (7400, 0, 6.00, 'name7400');
+INSERT INTO t VALUES (7401, 1, 85.19, 'name7401');
+INSERT INTO t VALUES (7402, 2, 64.38, 'name7402');
+INSERT INTO t VALUES (7403, 3, 43.57, 'name7403');
+INSERT INTO t VALUES (7404, 4, 22.76, 'name7404');
+INSERT INTO t VALUES (7405, 5, 1.95, 'name7405');
+INSERT INTO t VALUES (7406, 6, 81.14, 'name7406');
+INSERT INTO t VALUES (7407, 7, 60.33, 'name7407');
+INSERT INTO t VALUES (7408, 8, 39.52, 'name7408');
+INSERT INTO t VALUES (7409, 9, 18.71, 'name7409');
+INSERT INTO t VALUES (7410, 0, 97.90, 'name7410');
+INSERT INTO t VALUES (7411, 1, 77.09, 'name7411');
+INSERT INTO t VALUES (7412, 2, 56.28, 'name7412');
+INSERT INTO t VALUES (7413, 3, 35.47, 'name7413');
+INSERT INTO t VALUES (7414, 4, 14.66, 'name7414');
+INSERT INTO t VALUES (7415, 5, 93.85, 'name7415');
+INSERT INTO t VALUES (7416, 6, 73.04, 'name7416');
+INSERT INTO t VALUES (7417, 7, 52.23, 'name7417');
+INSERT INTO t VALUES (7418, 8, 31.42, 'name7418');
+INSERT INTO t VALUES (7419, 9, 10.61, 'name7419');
+INSERT INTO t VALUES (7420, 0, 89.80, 'name7420');
+INSERT INTO t VALUES (7421, 1, 68.99, 'name7421');
+INSERT INTO t VALUES (7422, 2, 48.18, 'name7422');
+INSERT INTO t VALUES (7423, 3, 27.37, 'name7423');
+INSERT INTO t VALUES (7424, 4, 6.56, 'name7424');
+INSERT INTO t VALUES (7425, 5, 85.75, 'name7425');
+INSERT INTO t VALUES (7426, 6, 64.94, 'name7426');
+INSERT INTO t VALUES (7427, 7, 44.13, 'name7427');
+INSERT INTO t VALUES (7428, 8, 23.32, 'name7428');
+INSERT INTO t VALUES (7429, 9, 2.51, 'name7429');
+INSERT INTO t VALUES (7430, 0, 81.70, 'name7430');
+INSERT INTO t VALUES (7431, 1, 60.89, 'name7431');
+INSERT INTO t VALUES (7432, 2, 40.08, 'name7432');
+INSERT INTO t VALUES (7433, 3, 19.27, 'name7433');
+INSERT INTO t VALUES (7434, 4, 98.46, 'name7434');
+INSERT INTO t VALUES (7435, 5, 77.65, 'name7435');
+INSERT INTO t VALUES (7436, 6, 56.84, 'name7436');
+INSERT INTO t VALUES (7437, 7, 36.03, 'name7437');
+INSERT INTO t VALUES (7438, 8, 15.22, 'name7438');
+INSERT INTO t VALUES (7439, 9, 94.41, 'name7439');
+INSERT INTO t VALUES (7440, 0, 73.60, 'name7440');
+INSERT INTO t VALUES (7441, 1, 52.79, 'name7441');
+INSERT INTO t VALUES (7442, 2, 31.98, 'name7442');
+INSERT INTO t VALUES (7443, 3, 11.17, 'name7443');
+INSERT INTO t VALUES (7444, 4, 90.36, 'name7444');
+INSERT INTO t VALUES (7445, 5, 69.55, 'name7445');
+INSERT INTO t VALUES (7446, 6, 48.74, 'name7446');
+INSERT INTO t VALUES (7447, 7, 27.93, 'name7447');
+INSERT INTO t VALUES (7448, 8, 7.12, 'name7448');
+INSERT INTO t VALUES (7449, 9, 86.31, 'name7449');
+INSERT INTO t VALUES (7450, 0, 65.50, 'name7450');
+INSERT INTO t VALUES (7451, 1, 44.69, 'name7451');
+INSERT INTO t VALUES (7452, 2, 23.88, 'name7452');
+INSERT INTO t VALUES (7453, 3, 3.07, 'name7453');
+INSERT INTO t VALUES (7454, 4, 82.26, 'name7454');
+INSERT INTO t VALUES (7455, 5, 61.45, 'name7455');
+INSERT INTO t VALUES (7456, 6, 40.64, 'name7456');
+INSERT INTO t VALUES (7457, 7, 19.83, 'name7457');
+INSERT INTO t VALUES (7458, 8, 99.02, 'name7458');
+INSERT INTO t VALUES (7459, 9, 78.21, 'name7459');
+INSERT INTO t VALUES (7460, 0, 57.40, 'name7460');
+INSERT INTO t VALUES (7461, 1, 36.59, 'name7461');
+INSERT INTO t VALUES (7462, 2, 15.78, 'name7462');
+INSERT INTO t VALUES (7463, 3, 94.97, 'name7463');
+INSERT INTO t VALUES (7464, 4, 74.16, 'name7464');
+INSERT INTO t VALUES (7465, 5, 53.35, 'name7465');
+INSERT INTO t VALUES (7466, 6, 32.54, 'name7466');
+INSERT INTO t VALUES (7467, 7, 11.73, 'name7467');
+INSERT INTO t VALUES (7468, 8, 90.92, 'name7468');
+INSERT INTO t VALUES (7469, 9, 70.11, 'name7469');
+INSERT INTO t VALUES (7470, 0, 49.30, 'name7470');
+INSERT INTO t VALUES (7471, 1, 28.49, 'name7471');
+INSERT INTO t VALUES (7472, 2, 7.68, 'name7472');
+INSERT INTO t VALUES (7473, 3, 86.87, 'name7473');
+INSERT INTO t VALUES (7474, 4, 66.06, 'name7474');
+INSERT INTO t VALUES (7475, 5, 45.25, 'name7475');
+INSERT INTO t VALUES (7476, 6, 24.44, 'name7476');
+INSERT INTO t VALUES (7477, 7, 3.63, 'name7477');
+INSERT INTO t VALUES (7478, 8, 82.82, 'name7478');
+INSERT INTO t VALUES (7479, 9, 62.01, 'name7479');
+INSERT INTO t VALUES (7480, 0, 41.20, 'name7480');
+INSERT INTO t VALUES (7481, 1, 20.39, 'name7481');
+INSERT INTO t VALUES (7482, 2, 99.58, 'name7482');
+INSERT INTO t VALUES (7483, 3, 78.77, 'name7483');
+INSERT INTO t VALUES (7484, 4, 57.96, 'name7484');
+INSERT INTO t VALUES (7485, 5, 37.15, 'name7485');
+INSERT INTO t VALUES (7486, 6, 16.34, 'name7486');
+INSERT INTO t VALUES (7487, 7, 95.53, 'name7487');
+INSERT INTO t VALUES (7488, 8, 74.72, 'name7488');
+INSERT INTO t VALUES (7489, 9, 53.91, 'name7489');
+INSERT INTO t VALUES (7490, 0, 33.10, 'name7490');
+INSERT INTO t VALUES (7491, 1, 12.29, 'name7491');
+INSERT INTO t VALUES (7492, 2, 91.48, 'name7492');
+INSERT INTO t VALUES (7493, 3, 70.67, 'name7493');
+INSERT INTO t VALUES (7494, 4, 49.86, 'name7494');
+INSERT INTO t VALUES (7495, 5, 29.05, 'name7495');
+INSERT INTO t VALUES (7496, 6, 8.24, 'name7496');
+INSERT INTO t VALUES (7497, 7, 87.43, 'name7497');
+INSERT INTO t VALUES (7498, 8, 66.62, 'name7498');
+INSERT INTO t VALUES (7499, 9, 45.81, 'name7499');
+INSERT INTO t VALUES (7500, 0, 25.00, 'name7500');
+INSERT INTO t VALUES (7501, 1, 4.19, 'name7501');
+INSERT INTO t VALUES (7502, 2, 83.38, 'name7502');
+INSERT INTO t VALUES (7503, 3, 62.57, 'name7503');
+INSERT INTO t VALUES (7504, 4, 41.76, 'name7504');
+INSERT INTO t VALUES (7505, 5, 20.95, 'name7505');
+INSERT INTO t VALUES (7506, 6, 0.14, 'name7506');
+INSERT INTO t VALUES (7507, 7, 79.33, 'name7507');
+INSERT INTO t VALUES (7508, 8, 58.52, 'name7508');
+INSERT INTO t VALUES (7509, 9, 37.71, 'name7509');
+INSERT INTO t VALUES (7510, 0, 16.90, 'name7510');
+INSERT INTO t VALUES (7511, 1, 96.09, 'name7511');
+INSERT INTO t VALUES (7512, 2, 75.28, 'name7512');
+INSERT INTO t VALUES (7513, 3, 54.47, 'name7513');
+INSERT INTO t VALUES (7514, 4, 33.66, 'name7514');
+INSERT INTO t VALUES (7515, 5, 12.85, 'name7515');
+INSERT INTO t VALUES (7516, 6, 92.04, 'name7516');
+INSERT INTO t VALUES (7517, 7, 71.23, 'name7517');
+INSERT INTO t VALUES (7518, 8, 50.42, 'name7518');
+INSERT INTO t VALUES (7519, 9, 29.61, 'name7519');
+INSERT INTO t VALUES (7520, 0, 8.80, 'name7520');
+INSERT INTO t VALUES (7521, 1, 87.99, 'name7521');
+INSERT INTO t VALUES (7522, 2, 67.18, 'name7522');
+INSERT INTO t VALUES (7523, 3, 46.37, 'name7523');
+INSERT INTO t VALUES (7524, 4, 25.56, 'name7524');
+INSERT INTO t VALUES (7525, 5, 4.75, 'name7525');
+INSERT INTO t VALUES (7526, 6, 83.94, 'name7526');
+INSERT INTO t VALUES (7527, 7, 63.13, 'name7527');
+INSERT INTO t VALUES (7528, 8, 42.32, 'name7528');
+INSERT INTO t VALUES (7529, 9, 21.51, 'name7529');
+INSERT INTO t VALUES (7530, 0, 0.70, 'name7530');
+INSERT INTO t VALUES (7531, 1, 79.89, 'name7531');
+INSERT INTO t VALUES (7532, 2, 59.08, 'name7532');
+INSERT INTO t VALUES (7533, 3, 38.27, 'name7533');
+INSERT INTO t VALUES (7534, 4, 17.46, 'name7534');
+INSERT INTO t VALUES (7535, 5, 96.65, 'name7535');
+INSERT INTO t VALUES (7536, 6, 75.84, 'name7536');
+INSERT INTO t VALUES (7537, 7, 55.03, 'name7537');
+INSERT INTO t VALUES (7538, 8, 34.22, 'name7538');
+INSERT INTO t VALUES (7539, 9, 13.41, 'name7539');
+INSERT INTO t VALUES (7540, 0, 92.60, 'name7540');
+INSERT INTO t VALUES (7541, 1, 71.79, 'name7541');
+INSERT INTO t VALUES (7542, 2, 50.98, 'name7542');
+INSERT INTO t VALUES (7543, 3, 30.17, 'name7543');
+INSERT INTO t VALUES (7544, 4, 9.36, 'name7544');
+INSERT INTO t VALUES (7545, 5, 88.55, 'name7545');
+INSERT INTO t VALUES (7546, 6, 67.74, 'name7546');
+INSERT INTO t VALUES (7547, 7, 46.93, 'name7547');
+INSERT INTO t VALUES (7548, 8, 26.12, 'name7548');
+INSERT INTO t VALUES (7549, 9, 5.31, 'name7549');
+INSERT INTO t VALUES (7550, 0, 84.50, 'name7550');
+INSERT INTO t VALUES (7551, 1, 63.69, 'name7551');
+INSERT INTO t VALUES (7552, 2, 42.88, 'name7552');
+INSERT INTO t VALUES (7553, 3, 22.07, 'name7553');
+INSERT INTO t VALUES (7554, 4, 1.26, 'name7554');
+INSERT INTO t VALUES (7555, 5, 80.45, 'name7555');
+INSERT INTO t VALUES (7556, 6, 59.64, 'name7556');
+INSERT INTO t VALUES (7557, 7, 38.83, 'name7557');
+INSERT INTO t VALUES (7558, 8, 18.02, 'name7558');
+INSERT INTO t VALUES (7559, 9, 97.21, 'name7559');
+INSERT INTO t VALUES (7560, 0, 76.40, 'name7560');
+INSERT INTO t VALUES (7561, 1, 55.59, 'name7561');
+INSERT INTO t VALUES (7562, 2, 34.78, 'name7562');
+INSERT INTO t VALUES (7563, 3, 13.97, 'name7563');
+INSERT INTO t VALUES (7564, 4, 93.16, 'name7564');
+INSERT INTO t VALUES (7565, 5, 72.35, 'name7565');
+INSERT INTO t VALUES (7566, 6, 51.54, 'name7566');
+INSERT INTO t VALUES (7567, 7, 30.73, 'name7567');
+INSERT INTO t VALUES (7568, 8, 9.92, 'name7568');
+INSERT INTO t VALUES (7569, 9, 89.11, 'name7569');
+INSERT INTO t VALUES (7570, 0, 68.30, 'name7570');
+INSERT INTO t VALUES (7571, 1, 47.49, 'name7571');
+INSERT INTO t VALUES (7572, 2, 26.68, 'name7572');
+INSERT INTO t VALUES (7573, 3, 5.87, 'name7573');
+INSERT INTO t VALUES (7574, 4, 85.06, 'name7574');
+INSERT INTO t VALUES (7575, 5, 64.25, 'name7575');
+INSERT INTO t VALUES (7576, 6, 43.44, 'name7576');
+INSERT INTO t VALUES (7577, 7, 22.63, 'name7577');
+INSERT INTO t VALUES (7578, 8, 1.82, 'name7578');
+INSERT INTO t VALUES (7579, 9, 81.01, 'name7579');
+INSERT INTO t VALUES (7580, 0, 60.20, 'name7580');
+INSERT INTO t VALUES (7581, 1, 39.39, 'name7581');
+INSERT INTO t VALUES (7582, 2, 18.58, 'name7582');
+INSERT INTO t VALUES (7583, 3, 97.77, 'name7583');
+INSERT INTO t VALUES (7584, 4, 76.96, 'name7584');
+INSERT INTO t VALUES (7585, 5, 56.15, 'name7585');
+INSERT INTO t VALUES (7586, 6, 35.34, 'name7586');
+INSERT INTO t VALUES (7587, 7, 14.53, 'name7587');
+INSERT INTO t VALUES (7588, 8, 93.72, 'name7588');
+INSERT INTO t VALUES (7589, 9, 72.91, 'name7589');
+INSERT INTO t VALUES (7590, 0, 52.10, 'name7590');
+INSERT INTO t VALUES (7591, 1, 31.29, 'name7591');
+INSERT INTO t VALUES (7592, 2, 10.48, 'name7592');
+INSERT INTO t VALUES (7593, 3, 89.67, 'name7593');
+INSERT INTO t VALUES (7594, 4, 68.86, 'name7594');
+INSERT INTO t VALUES (7595, 5, 48.05, 'name7595');
+INSERT INTO t VALUES (7596, 6, 27.24, 'name7596');
+INSERT INTO t VALUES (7597, 7, 6.43, 'name7597');
+INSERT INTO t VALUES (7598, 8, 85.62, 'name7598');
+INSERT INTO t VALUES (7599, 9, 64.81, 'name7599');
+INSERT INTO t VALUES (7600, 0, 44.00, 'name7600');
+INSERT INTO t VALUES (7601, 1, 23.19, 'name7601');
+INSERT INTO t VALUES (7602, 2, 2.38, 'name7602');
+INSERT INTO t VALUES (7603, 3, 81.57, 'name7603');
+INSERT INTO t VALUES (7604, 4, 60.76, 'name7604');
+INSERT INTO t VALUES (7605, 5, 39.95, 'name7605');
+INSERT INTO t VALUES (7606, 6, 19.14, 'name7606');
+INSERT INTO t VALUES (7607, 7, 98.33, 'name7607');
+INSERT INTO t VALUES (7608, 8, 77.52, 'name7608');
+INSERT INTO t VALUES (7609, 9, 56.71, 'name7609');
+INSERT INTO t VALUES (7610, 0, 35.90, 'name7610');
+INSERT INTO t VALUES (7611, 1, 15.09, 'name7611');
+INSERT INTO t VALUES (7612, 2, 94.28, 'name7612');
+INSERT INTO t VALUES (7613, 3, 73.47, 'name7613');
+INSERT INTO t VALUES (7614, 4, 52.66, 'name7614');
+INSERT INTO t VALUES (7615, 5, 31.85, 'name7615');
+INSERT INTO t VALUES (7616, 6, 11.04, 'name7616');
+INSERT INTO t VALUES (7617, 7, 90.23, 'name7617');
+INSERT INTO t VALUES (7618, 8, 69.42, 'name7618');
+INSERT INTO t VALUES (7619, 9, 48.61, 'name7619');
+INSERT INTO t VALUES (7620, 0, 27.80, 'name7620');
+INSERT INTO t VALUES (7621, 1, 6.99, 'name7621');
+INSERT INTO t VALUES (7622, 2, 86.18, 'name7622');
+INSERT INTO t VALUES (7623, 3, 65.37, 'name7623');
+INSERT INTO t VALUES (7624, 4, 44.56, 'name7624');
+INSERT INTO t VALUES (7625, 5, 23.75, 'name7625');
+INSERT INTO t VALUES (7626, 6, 2.94, 'name7626');
+INSERT INTO t VALUES (7627, 7, 82.13, 'name7627');
+INSERT INTO t VALUES (7628, 8, 61.32, 'name7628');
+INSERT INTO t VALUES (7629, 9, 40.51, 'name7629');
+INSERT INTO t VALUES (7630, 0, 19.70, 'name7630');
+INSERT INTO t VALUES (7631, 1, 98.89, 'name7631');
+INSERT INTO t VALUES (7632, 2, 78.08, 'name7632');
+INSERT INTO t VALUES (7633, 3, 57.27, 'name7633');
+INSERT INTO t VALUES (7634, 4, 36.46, 'name7634');
+INSERT INTO t VALUES (7635, 5, 15.65, 'name7635');
+INSERT INTO t VALUES (7636, 6, 94.84, 'name7636');
+INSERT INTO t VALUES (7637, 7, 74.03, 'name7637');
+INSERT INTO t VALUES (7638, 8, 53.22, 'name7638');
+INSERT INTO t VALUES (7639, 9, 32.41, 'name7639');
+INSERT INTO t VALUES (7640, 0, 11.60, 'name7640');
+INSERT INTO t VALUES (7641, 1, 90.79, 'name7641');
+INSERT INTO t VALUES (7642, 2, 69.98, 'name7642');
+INSERT INTO t VALUES (7643, 3, 49.17, 'name7643');
+INSERT INTO t VALUES (7644, 4, 28.36, 'name7644');
+INSERT INTO t VALUES (7645, 5, 7.55, 'name7645');
+INSERT INTO t VALUES (7646, 6, 86.74, 'name7646');
+INSERT INTO t VALUES (7647, 7, 65.93, 'name7647');
+INSERT INTO t VALUES (7648, 8, 45.12, 'name7648');
+INSERT INTO t VALUES (7649, 9, 24.31, 'name7649');
+INSERT INTO t VALUES (7650, 0, 3.50, 'name7650');
+INSERT INTO t VALUES (7651, 1, 82.69, 'name7651');
+INSERT INTO t VALUES (7652, 2, 61.88, 'name7652');
+INSERT INTO t VALUES (7653, 3, 41.07, 'name7653');
+INSERT INTO t VALUES (7654, 4, 20.26, 'name7654');
+INSERT INTO t VALUES (7655, 5, 99.45, 'name7655');
+INSERT INTO t VALUES (7656, 6, 78.64, 'name7656');
+INSERT INTO t VALUES (7657, 7, 57.83, 'name7657');
+INSERT INTO t VALUES (7658, 8, 37.02, 'name7658');
+INSERT INTO t VALUES (7659, 9, 16.21, 'name7659');
+INSERT INTO t VALUES (7660, 0, 95.40, 'name7660');
+INSERT INTO t VALUES (7661, 1, 74.59, 'name7661');
+INSERT INTO t VALUES (7662, 2, 53.78, 'name7662');
+INSERT INTO t VALUES (7663, 3, 32.97, 'name7663');
+INSERT INTO t VALUES (7664, 4, 12.16, 'name7664');
+INSERT INTO t VALUES (7665, 5, 91.35, 'name7665');
+INSERT INTO t VALUES (7666, 6, 70.54, 'name7666');
+INSERT INTO t VALUES (7667, 7, 49.73, 'name7667');
+INSERT INTO t VALUES (7668, 8, 28.92, 'name7668');
+INSERT INTO t VALUES (7669, 9, 8.11, 'name7669');
+INSERT INTO t VALUES (7670, 0, 87.30, 'name7670');
+INSERT INTO t VALUES (7671, 1, 66.49, 'name7671');
+INSERT INTO t VALUES (7672, 2, 45.68, 'name7672');
+INSERT INTO t VALUES (7673, 3, 24.87, 'name7673');
+INSERT INTO t VALUES (7674, 4, 4.06, 'name7674');
+INSERT INTO t VALUES (7675, 5, 83.25, 'name7675');
+INSERT INTO t VALUES (7676, 6, 62.44, 'name7676');
+INSERT INTO t VALUES (7677, 7, 41.63, 'name7677');
+INSERT INTO t VALUES (7678, 8, 20.82, 'name7678');
+INSERT INTO t VALUES (7679, 9, 0.01, 'name7679');
+INSERT INTO t VALUES (7680, 0, 79.20, 'name7680');
+INSERT INTO t VALUES (7681, 1, 58.39, 'name7681');
+INSERT INTO t VALUES (7682, 2, 37.58, 'name7682');
+INSERT INTO t VALUES (7683, 3, 16.77, 'name7683');
+INSERT INTO t VALUES (7684, 4, 95.96, 'name7684');
+INSERT INTO t VALUES (7685, 5, 75.15, 'name7685');
+INSERT INTO t VALUES (7686, 6, 54.34, 'name7686');
+INSERT INTO t VALUES (7687, 7, 33.53, 'name7687');
+INSERT INTO t VALUES (7688, 8, 12.72, 'name7688');
+INSERT INTO t VALUES (7689, 9, 91.91, 'name7689');
+INSERT INTO t VALUES (7690, 0, 71.10, 'name7690');
+INSERT INTO t VALUES (7691, 1, 50.29, 'name7691');
+INSERT INTO t VALUES (7692, 2, 29.48, 'name7692');
+INSERT INTO t VALUES (7693, 3, 8.67, 'name7693');
+INSERT INTO t VALUES (7694, 4, 87.86, 'name7694');
+INSERT INTO t VALUES (7695, 5, 67.05, 'name7695');
+INSERT INTO t VALUES (7696, 6, 46.24, 'name7696');
+INSERT INTO t VALUES (7697, 7, 25.43, 'name7697');
+INSERT INTO t VALUES (7698, 8, 4.62, 'name7698');
+INSERT INTO t VALUES (7699, 9, 83.81, 'name7699');
+INSERT INTO t VALUES (7700, 0, 63.00, 'name7700');
+INSERT INTO t VALUES (7701, 1, 42.19, 'name7701');
+INSERT INTO t VALUES (7702, 2, 21.38, 'name7702');
+INSERT INTO t VALUES (7703, 3, 0.57, 'name7703');
+INSERT INTO t VALUES (7704, 4, 79.76, 'name7704');
+INSERT INTO t VALUES (7705, 5, 58.95, 'name7705');
+INSERT INTO t VALUES (7706, 6, 38.14, 'name7706');
+INSERT INTO t VALUES (7707, 7, 17.33, 'name7707');
+INSERT INTO t VALUES (7708, 8, 96.52, 'name7708');
+INSERT INTO t VALUES (7709, 9, 75.71, 'name7709');
+INSERT INTO t VALUES (7710, 0, 54.90, 'name7710');
+INSERT INTO t VALUES (7711, 1, 34.09, 'name7711');
+INSERT INTO t VALUES (7712, 2, 13.28, 'name7712');
+INSERT INTO t VALUES (7713, 3, 92.47, 'name7713');
+INSERT INTO t VALUES (7714, 4, 71.66, 'name7714');
+INSERT INTO t VALUES (7715, 5, 50.85, 'name7715');
+INSERT INTO t VALUES (7716, 6, 30.04, 'name7716');
+INSERT INTO t VALUES (7717, 7, 9.23, 'name7717');
+INSERT INTO t VALUES (7718, 8, 88.42, 'name7718');
+INSERT INTO t VALUES (7719, 9, 67.61, 'name7719');
+INSERT INTO t VALUES (7720, 0, 46.80, 'name7720');
+INSERT INTO t VALUES (7721, 1, 25.99, 'name7721');
+INSERT INTO t VALUES (7722, 2, 5.18, 'name7722');
+INSERT INTO t VALUES (7723, 3, 84.37, 'name7723');
+INSERT INTO t VALUES (7724, 4, 63.56, 'name7724');
+INSERT INTO t VALUES (7725, 5, 42.75, 'name7725');
+INSERT INTO t VALUES (7726, 6, 21.94, 'name7726');
+INSERT INTO t VALUES (7727, 7, 1.13, 'name7727');
+INSERT INTO t VALUES (7728, 8, 80.32, 'name7728');
+INSERT INTO t VALUES (7729, 9, 59.51, 'name7729');
+INSERT INTO t VALUES (7730, 0, 38.70, 'name7730');
+INSERT INTO t VALUES (7731, 1, 17.89, 'name7731');
+INSERT INTO t VALUES (7732, 2, 97.08, 'name7732');
+INSERT INTO t VALUES (7733, 3, 76.27, 'name7733');
+INSERT INTO t VALUES (7734, 4, 55.46, 'name7734');
+INSERT INTO t VALUES (7735, 5, 34.65, 'name7735');
+INSERT INTO t VALUES (7736, 6, 13.84, 'name7736');
+INSERT INTO t VALUES (7737, 7, 93.03, 'name7737');
+INSERT INTO t VALUES (7738, 8, 72.22, 'name7738');
+INSERT INTO t VALUES (7739, 9, 51.41, 'name7739');
+INSERT INTO t VALUES (7740, 0, 30.60, 'name7740');
+INSERT INTO t VALUES (7741, 1, 9.79, 'name7741');
+INSERT INTO t VALUES (7742, 2, 88.98, 'name7742');
+INSERT INTO t VALUES (7743, 3, 68.17, 'name7743');
+INSERT INTO t VALUES (7744, 4, 47.36, 'name7744');
+INSERT INTO t VALUES (7745, 5, 26.55, 'name7745');
+INSERT INTO t VALUES (7746, 6, 5.74, 'name7746');
+INSERT INTO t VALUES (7747, 7, 84.93, 'name7747');
+INSERT INTO t VALUES (7748, 8, 64.12, 'name7748');
+INSERT INTO t VALUES (7749, 9, 43.31, 'name7749');
+INSERT INTO t VALUES (7750, 0, 22.50, 'name7750');
+INSERT INTO t VALUES (7751, 1, 1.69, 'name7751');
+INSERT INTO t VALUES (7752, 2, 80.88, 'name7752');
+INSERT INTO t VALUES (7753, 3, 60.07, 'name7753');
+INSERT INTO t VALUES (7754, 4, 39.26, 'name7754');
+INSERT INTO t VALUES (7755, 5, 18.45, 'name7755');
+INSERT INTO t VALUES (7756, 6, 97.64, 'name7756');
+INSERT INTO t VALUES (7757, 7, 76.83, 'name7757');
+INSERT INTO t VALUES (7758, 8, 56.02, 'name7758');
+INSERT INTO t VALUES (7759, 9, 35.21, 'name7759');
+INSERT INTO t VALUES (7760, 0, 14.40, 'name7760');
+INSERT INTO t VALUES (7761, 1, 93.59, 'name7761');
+INSERT INTO t VALUES (7762, 2, 72.78, 'name7762');
+INSERT INTO t VALUES (7763, 3, 51.97, 'name7763');
+INSERT INTO t VALUES (7764, 4, 31.16, 'name7764');
+INSERT INTO t VALUES (7765, 5, 10.35, 'name7765');
+INSERT INTO t VALUES (7766, 6, 89.54, 'name7766');
+INSERT INTO t VALUES (7767, 7, 68.73, 'name7767');
+INSERT INTO t VALUES (7768, 8, 47.92, 'name7768');
+INSERT INTO t VALUES (7769, 9, 27.11, 'name7769');
+INSERT INTO t VALUES (7770, 0, 6.30, 'name7770');
+INSERT INTO t VALUES (7771, 1, 85.49, 'name7771');
+INSERT INTO t VALUES (7772, 2, 64.68, 'name7772');
+INSERT INTO t VALUES (7773, 3, 43.87, 'name7773');
+INSERT INTO t VALUES (7774, 4, 23.06, 'name7774');
+INSERT INTO t VALUES (7775, 5, 2.25, 'name7775');
+INSERT INTO t VALUES (7776, 6, 81.44, 'name7776');
+INSERT INTO t VALUES (7777, 7, 60.63, 'name7777');
+INSERT INTO t VALUES (7778, 8, 39.82, 'name7778');
+INSERT INTO t VALUES (7779, 9, 19.01, 'name7779');
+INSERT INTO t VALUES (7780, 0, 98.20, 'name7780');
+INSERT INTO t VALUES (7781, 1, 77.39, 'name7781');
+INSERT INTO t VALUES (7782, 2, 56.58, 'name7782');
+INSERT INTO t VALUES (7783, 3, 35.77, 'name7783');
+INSERT INTO t VALUES (7784, 4, 14.96, 'name7784');
+INSERT INTO t VALUES (7785, 5, 94.15, 'name7785');
+INSERT INTO t VALUES (7786, 6, 73.34, 'name7786');
+INSERT INTO t VALUES (7787, 7, 52.53, 'name7787');
+INSERT INTO t VALUES (7788, 8, 31.72, 'name7788');
+INSERT INTO t VALUES (7789, 9, 10.91, 'name7789');
+INSERT INTO t VALUES (7790, 0, 90.10, 'name7790');
+INSERT INTO t VALUES (7791, 1, 69.29, 'name7791');
+INSERT INTO t VALUES (7792, 2, 48.48, 'name7792');
+INSERT INTO t VALUES (7793, 3, 27.67, 'name7793');
+INSERT INTO t VALUES (7794, 4, 6.86, 'name7794');
+INSERT INTO t VALUES (7795, 5, 86.05, 'name7795');
+INSERT INTO t VALUES (7796, 6, 65.24, 'name7796');
+INSERT INTO t VALUES (7797, 7, 44.43, 'name7797');
+INSERT INTO t VALUES (7798, 8, 23.62, 'name7798');
+INSERT INTO t VALUES (7799, 9, 2.81, 'name7799');
+INSERT INTO t VALUES (7800, 0, 82.00, 'name7800');
+INSERT INTO t VALUES (7801, 1, 61.19, 'name7801');
+INSERT INTO t VALUES (7802, 2, 40.38, 'name7802');
+INSERT INTO t VALUES (7803, 3, 19.57, 'name7803');
+INSERT INTO t VALUES (7804, 4, 98.76, 'name7804');
+INSERT INTO t VALUES (7805, 5, 77.95, 'name7805');
+INSERT INTO t VALUES (7806, 6, 57.14, 'name7806');
+INSERT INTO t VALUES (7807, 7, 36.33, 'name7807');
+INSERT INTO t VALUES (7808, 8, 15.52, 'name7808');
+INSERT INTO t VALUES (7809, 9, 94.71, 'name7809');
+INSERT INTO t VALUES (7810, 0, 73.90, 'name7810');
+INSERT INTO t VALUES (7811, 1, 53.09, 'name7811');
+INSERT INTO t VALUES (7812, 2, 32.28, 'name7812');
+INSERT INTO t VALUES (7813, 3, 11.47, 'name7813');
+INSERT INTO t VALUES (7814, 4, 90.66, 'name7814');
+INSERT INTO t VALUES (7815, 5, 69.85, 'name7815');
+INSERT INTO t VALUES (7816, 6, 49.04, 'name7816');
+INSERT INTO t VALUES (7817, 7, 28.23, 'name7817');
+INSERT INTO t VALUES (7818, 8, 7.42, 'name7818');
+INSERT INTO t VALUES (7819, 9, 86.61, 'name7819');
+INSERT INTO t VALUES (7820, 0, 65.80, 'name7820');
+INSERT INTO t VALUES (7821, 1, 44.99, 'name7821');
+INSERT INTO t VALUES (7822, 2, 24.18, 'name7822');
+INSERT INTO t VALUES (7823, 3, 3.37, 'name7823');
+INSERT INTO t VALUES (7824, 4, 82.56, 'name7824');
+INSERT INTO t VALUES (7825, 5, 61.75, 'name7825');
+INSERT INTO t VALUES (7826, 6, 40.94, 'name7826');
+INSERT INTO t VALUES (7827, 7, 20.13, 'name7827');
+INSERT INTO t VALUES (7828, 8, 99.32, 'name7828');
+INSERT INTO t VALUES (7829, 9, 78.51, 'name7829');
+INSERT INTO t VALUES (7830, 0, 57.70, 'name7830');
+INSERT INTO t VALUES (7831, 1, 36.89, 'name7831');
+INSERT INTO t VALUES (7832, 2, 16.08, 'name7832');
+INSERT INTO t VALUES (7833, 3, 95.27, 'name7833');
+INSERT INTO t VALUES (7834, 4, 74.46, 'name7834');
+INSERT INTO t VALUES (7835, 5, 53.65, 'name7835');
+INSERT INTO t VALUES (7836, 6, 32.84, 'name7836');
+INSERT INTO t VALUES (7837, 7, 12.03, 'name7837');
+INSERT INTO t VALUES (7838, 8, 91.22, 'name7838');
+INSERT INTO t VALUES (7839, 9, 70.41, 'name7839');
+INSERT INTO t VALUES (7840, 0, 49.60, 'name7840');
+INSERT INTO t VALUES (7841, 1, 28.79, 'name7841');
+INSERT INTO t VALUES (7842, 2, 7.98, 'name7842');
+INSERT INTO t VALUES (7843, 3, 87.17, 'name7843');
+INSERT INTO t VALUES (7844, 4, 66.36, 'name7844');
+INSERT INTO t VALUES (7845, 5, 45.55, 'name7845');
+INSERT INTO t VALUES (7846, 6, 24.74, 'name7846');
+INSERT INTO t VALUES (7847, 7, 3.93, 'name7847');
+INSERT INTO t VALUES (7848, 8, 83.12, 'name7848');
+INSERT INTO t VALUES (7849, 9, 62.31, 'name7849');
+INSERT INTO t VALUES (7850, 0, 41.50, 'name7850');
+INSERT INTO t VALUES (7851, 1, 20.69, 'name7851');
+INSERT INTO t VALUES (7852, 2, 99.88, 'name7852');
+INSERT INTO t VALUES (7853, 3, 79.07, 'name7853');
+INSERT INTO t VALUES (7854, 4, 58.26, 'name7854');
+INSERT INTO t VALUES (7855, 5, 37.45, 'name7855');
+INSERT INTO t VALUES (7856, 6, 16.64, 'name7856');
+INSERT INTO t VALUES (7857, 7, 95.83, 'name7857');
+INSERT INTO t VALUES (7858, 8, 75.02, 'name7858');
+INSERT INTO t VALUES (7859, 9, 54.21, 'name7859');
+INSERT INTO t VALUES (7860, 0, 33.40, 'name7860');
+INSERT INTO t VALUES (7861, 1, 12.59, 'name7861');
+INSERT INTO t VALUES (7862, 2, 91.78, 'name7862');
+INSERT INTO t VALUES (7863, 3, 70.97, 'name7863');
+INSERT INTO t VALUES (7864, 4, 50.16, 'name7864');
+INSERT INTO t VALUES (7865, 5, 29.35, 'name7865');
+INSERT INTO t VALUES (7866, 6, 8.54, 'name7866');
+INSERT INTO t VALUES (7867, 7, 87.73, 'name7867');
+INSERT INTO t VALUES (7868, 8, 66.92, 'name7868');
+INSERT INTO t VALUES (7869, 9, 46.11, 'name7869');
+INSERT INTO t VALUES (7870, 0, 25.30, 'name7870');
+INSERT INTO t VALUES (7871, 1, 4.49, 'name7871');
+INSERT INTO t VALUES (7872, 2, 83.68, 'name7872');
+INSERT INTO t VALUES (7873, 3, 62.87, 'name7873');
+INSERT INTO t VALUES (7874, 4, 42.06, 'name7874');
+INSERT INTO t VALUES (7875, 5, 21.25, 'name7875');
+INSERT INTO t VALUES (7876, 6, 0.44, 'name7876');
+INSERT INTO t VALUES (7877, 7, 79.63, 'name7877');
+INSERT INTO t VALUES (7878, 8, 58.82, 'name7878');
+INSERT INTO t VALUES (7879, 9, 38.01, 'name7879');
+INSERT INTO t VALUES (7880, 0, 17.20, 'name7880');
+INSERT INTO t VALUES (7881, 1, 96.39, 'name7881');
+INSERT INTO t VALUES (7882, 2, 75.58, 'name7882');
+INSERT INTO t VALUES (7883, 3, 54.77, 'name7883');
+INSERT INTO t VALUES (7884, 4, 33.96, 'name7884');
+INSERT INTO t VALUES (7885, 5, 13.15, 'name7885');
+INSERT INTO t VALUES (7886, 6, 92.34, 'name7886');
+INSERT INTO t VALUES (7887, 7, 71.53, 'name7887');
+INSERT INTO t VALUES (7888, 8, 50.72, 'name7888');
+INSERT INTO t VALUES (7889, 9, 29.91, 'name7889');
+INSERT INTO t VALUES (7890, 0, 9.10, 'name7890');
+INSERT INTO t VALUES (7891, 1, 88.29, 'name7891');
+INSERT INTO t VALUES (7892, 2, 67.48, 'name7892');
+INSERT INTO t VALUES (7893, 3, 46.67, 'name7893');
+INSERT INTO t VALUES (7894, 4, 25.86, 'name7894');
+INSERT INTO t VALUES (7895, 5, 5.05, 'name7895');
+INSERT INTO t VALUES (7896, 6, 84.24, 'name7896');
+INSERT INTO t VALUES (7897, 7, 63.43, 'name7897');
+INSERT INTO t VALUES (7898, 8, 42.62, 'name7898');
+INSERT INTO t VALUES (7899, 9, 21.81, 'name7899');
+INSERT INTO t VALUES (7900, 0, 1.00, 'name7900');
+INSERT INTO t VALUES (7901, 1, 80.19, 'name7901');
+INSERT INTO t VALUES (7902, 2, 59.38, 'name7902');
+INSERT INTO t VALUES (7903, 3, 38.57, 'name7903');
+INSERT INTO t VALUES (7904, 4, 17.76, 'name7904');
+INSERT INTO t VALUES (7905, 5, 96.95, 'name7905');
+INSERT INTO t VALUES (7906, 6, 76.14, 'name7906');
+INSERT INTO t VALUES (7907, 7, 55.33, 'name7907');
+INSERT INTO t VALUES (7908, 8, 34.52, 'name7908');
+INSERT INTO t VALUES (7909, 9, 13.71, 'name7909');
+INSERT INTO t VALUES (7910, 0, 92.90, 'name7910');
+INSERT INTO t VALUES (7911, 1, 72.09, 'name7911');
+INSERT INTO t VALUES (7912, 2, 51.28, 'name7912');
+INSERT INTO t VALUES (7913, 3, 30.47, 'name7913');
+INSERT INTO t VALUES (7914, 4, 9.66, 'name7914');
+INSERT INTO t VALUES (7915, 5, 88.85, 'name7915');
+INSERT INTO t VALUES (7916, 6, 68.04, 'name7916');
+INSERT INTO t VALUES (7917, 7, 47.23, 'name7917');
+INSERT INTO t VALUES (7918, 8, 26.42, 'name7918');
+INSERT INTO t VALUES (7919, 9, 5.61, 'name7919');
+INSERT INTO t VALUES (7920, 0, 84.80, 'name7920');
+INSERT INTO t VALUES (7921, 1, 63.99, 'name7921');
+INSERT INTO t VALUES (7922, 2, 43.18, 'name7922');
+INSERT INTO t VALUES (7923, 3, 22.37, 'name7923');
+INSERT INTO t VALUES (7924, 4, 1.56, 'name7924');
+INSERT INTO t VALUES (7925, 5, 80.75, 'name7925');
+INSERT INTO t VALUES (7926, 6, 59.94, 'name7926');
+INSERT INTO t VALUES (7927, 7, 39.13, 'name7927');
+INSERT INTO t VALUES (7928, 8, 18.32, 'name7928');
+INSERT INTO t VALUES (7929, 9, 97.51, 'name7929');
+INSERT INTO t VALUES (7930, 0, 76.70, 'name7930');
+INSERT INTO t VALUES (7931, 1, 55.89, 'name7931');
+INSERT INTO t VALUES (7932, 2, 35.08, 'name7932');
+INSERT INTO t VALUES (7933, 3, 14.27, 'name7933');
+INSERT INTO t VALUES (7934, 4, 93.46, 'name7934');
+INSERT INTO t VALUES (7935, 5, 72.65, 'name7935');
+INSERT INTO t VALUES (7936, 6, 51.84, 'name7936');
+INSERT INTO t VALUES (7937, 7, 31.03, 'name7937');
+INSERT INTO t VALUES (7938, 8, 10.22, 'name7938');
+INSERT INTO t VALUES (7939, 9, 89.41, 'name7939');
+INSERT INTO t VALUES (7940, 0, 68.60, 'name7940');
+INSERT INTO t VALUES (7941, 1, 47.79, 'name7941');
+INSERT INTO t VALUES (7942, 2, 26.98, 'name7942');
+INSERT INTO t VALUES (7943, 3, 6.17, 'name7943');
+INSERT INTO t VALUES (7944, 4, 85.36, 'name7944');
+INSERT INTO t VALUES (7945, 5, 64.55, 'name7945');
+INSERT INTO t VALUES (7946, 6, 43.74, 'name7946');
+INSERT INTO t VALUES (7947, 7, 22.93, 'name7947');
+INSERT INTO t VALUES (7948, 8, 2.12, 'name7948');
+INSERT INTO t VALUES (7949, 9, 81.31, 'name7949');
+INSERT INTO t VALUES (7950, 0, 60.50, 'name7950');
+INSERT INTO t VALUES (7951, 1, 39.69, 'name7951');
+INSERT INTO t VALUES (7952, 2, 18.88, 'name7952');
+INSERT INTO t VALUES (7953, 3, 98.07, 'name7953');
+INSERT INTO t VALUES (7954, 4, 77.26, 'name7954');
+INSERT INTO t VALUES (7955, 5, 56.45, 'name7955');
+INSERT INTO t VALUES (7956, 6, 35.64, 'name7956');
+INSERT INTO t VALUES (7957, 7, 14.83, 'name7957');
+INSERT INTO t VALUES (7958, 8, 94.02, 'name7958');
+INSERT INTO t VALUES (7959, 9, 73.21, 'name7959');
+INSERT INTO t VALUES (7960, 0, 52.40, 'name7960');
+INSERT INTO t VALUES (7961, 1, 31.59, 'name7961');
+INSERT INTO t VALUES (7962, 2, 10.78, 'name7962');
+INSERT INTO t VALUES (7963, 3, 89.97, 'name7963');
+INSERT INTO t VALUES (7964, 4, 69.16, 'name7964');
+INSERT INTO t VALUES (7965, 5, 48.35, 'name7965');
+INSERT INTO t VALUES (7966, 6, 27.54, 'name7966');
+INSERT INTO t VALUES (7967, 7, 6.73, 'name7967');
+INSERT INTO t VALUES (7968, 8, 85.92, 'name7968');
+INSERT INTO t VALUES (7969, 9, 65.11, 'name7969');
+INSERT INTO t VALUES (7970, 0, 44.30, 'name7970');
+INSERT INTO t VALUES (7971, 1, 23.49, 'name7971');
+INSERT INTO t VALUES (7972, 2, 2.68, 'name7972');
+INSERT INTO t VALUES (7973, 3, 81.87, 'name7973');
+INSERT INTO t VALUES (7974, 4, 61.06, 'name7974');
+INSERT INTO t VALUES (7975, 5, 40.25, 'name7975');
+INSERT INTO t VALUES (7976, 6, 19.44, 'name7976');
+INSERT INTO t VALUES (7977, 7, 98.63, 'name7977');
+INSERT INTO t VALUES (7978, 8, 77.82, 'name7978');
+INSERT INTO t VALUES (7979, 9, 57.01, 'name7979');
+INSERT INTO t VALUES (7980, 0, 36.20, 'name7980');
+INSERT INTO t VALUES (7981, 1, 15.39, 'name7981');
+INSERT INTO t VALUES (7982, 2, 94.58, 'name7982');
+INSERT INTO t VALUES (7983, 3, 73.77, 'name7983');
+INSERT INTO t VALUES (7984, 4, 52.96, 'name7984');
+INSERT INTO t VALUES (7985, 5, 32.15, 'name7985');
+INSERT INTO t VALUES (7986, 6, 11.34, 'name7986');
+INSERT INTO t VALUES (7987, 7, 90.53, 'name7987');
+INSERT INTO t VALUES (7988, 8, 69.72, 'name7988');
+INSERT INTO t VALUES (7989, 9, 48.91, 'name7989');
+INSERT INTO t VALUES (7990, 0, 28.10, 'name7990');
+INSERT INTO t VALUES (7991, 1, 7.29, 'name7991');
+INSERT INTO t VALUES (7992, 2, 86.48, 'name7992');
+INSERT INTO t VALUES (7993, 3, 65.67, 'name7993');
+INSERT INTO t VALUES (7994, 4, 44.86, 'name7994');
+INSERT INTO t VALUES (7995, 5, 24.05, 'name7995');
+INSERT INTO t VALUES (7996, 6, 3.24, 'name7996');
+INSERT INTO t VALUES (7997, 7, 82.43, 'name7997');
+INSERT INTO t VALUES (7998, 8, 61.62, 'name7998');
+INSERT INTO t VALUES (7999, 9, 40.81, 'name7999');
+INSERT INTO t VALUES (8000, 0, 20.00, 'name8000');
+INSERT INTO t VALUES (8001, 1, 99.19, 'name8001');
+INSERT INTO t VALUES (8002, 2, 78.38, 'name8002');
+INSERT INTO t VALUES (8003, 3, 57.57, 'name8003');
+INSERT INTO t VALUES (8004, 4, 36.76, 'name8004');
+INSERT INTO t VALUES (8005, 5, 15.95, 'name8005');
+INSERT INTO t VALUES (8006, 6, 95.14, 'name8006');
+INSERT INTO t VALUES (8007, 7, 74.33, 'name8007');
+INSERT INTO t VALUES (8008, 8, 53.52, 'name8008');
+INSERT INTO t VALUES (8009, 9, 32.71, 'name8009');
+INSERT INTO t VALUES (8010, 0, 11.90, 'name8010');
+INSERT INTO t VALUES (8011, 1, 91.09, 'name8011');
+INSERT INTO t VALUES (8012, 2, 70.28, 'name8012');
+INSERT INTO t VALUES (8013, 3, 49.47, 'name8013');
+INSERT INTO t VALUES (8014, 4, 28.66, 'name8014');
+INSERT INTO t VALUES (8015, 5, 7.85, 'name8015');
+INSERT INTO t VALUES (8016, 6, 87.04, 'name8016');
+INSERT INTO t VALUES (8017, 7, 66.23, 'name8017');
+INSERT INTO t VALUES (8018, 8, 45.42, 'name8018');
+INSERT INTO t VALUES (8019, 9, 24.61, 'name8019');
+INSERT INTO t VALUES (8020, 0, 3.80, 'name8020');
+INSERT INTO t VALUES (8021, 1, 82.99, 'name8021');
+INSERT INTO t VALUES (8022, 2, 62.18, 'name8022');
+INSERT INTO t VALUES (8023, 3, 41.37, 'name8023');
+INSERT INTO t VALUES (8024, 4, 20.56, 'name8024');
+INSERT INTO t VALUES (8025, 5, 99.75, 'name8025');
+INSERT INTO t VALUES (8026, 6, 78.94, 'name8026');
+INSERT INTO t VALUES (8027, 7, 58.13, 'name8027');
+INSERT INTO t VALUES (8028, 8, 37.32, 'name8028');
+INSERT INTO t VALUES (8029, 9, 16.51, 'name8029');
+INSERT INTO t VALUES (8030, 0, 95.70, 'name8030');
+INSERT INTO t VALUES (8031, 1, 74.89, 'name8031');
+INSERT INTO t VALUES (8032, 2, 54.08, 'name8032');
+INSERT INTO t VALUES (8033, 3, 33.27, 'name8033');
+INSERT INTO t VALUES (8034, 4, 12.46, 'name8034');
+INSERT INTO t VALUES (8035, 5, 91.65, 'name8035');
+INSERT INTO t VALUES (8036, 6, 70.84, 'name8036');
+INSERT INTO t VALUES (8037, 7, 50.03, 'name8037');
+INSERT INTO t VALUES (8038, 8, 29.22, 'name8038');
+INSERT INTO t VALUES (8039, 9, 8.41, 'name8039');
+INSERT INTO t VALUES (8040, 0, 87.60, 'name8040');
+INSERT INTO t VALUES (8041, 1, 66.79, 'name8041');
+INSERT INTO t VALUES (8042, 2, 45.98, 'name8042');
+INSERT INTO t VALUES (8043, 3, 25.17, 'name8043');
+INSERT INTO t VALUES (8044, 4, 4.36, 'name8044');
+INSERT INTO t VALUES (8045, 5, 83.55, 'name8045');
+INSERT INTO t VALUES (8046, 6, 62.74, 'name8046');
+INSERT INTO t VALUES (8047, 7, 41.93, 'name8047');
+INSERT INTO t VALUES (8048, 8, 21.12, 'name8048');
+INSERT INTO t VALUES (8049, 9, 0.31, 'name8049');
+INSERT INTO t VALUES (8050, 0, 79.50, 'name8050');
+INSERT INTO t VALUES (8051, 1, 58.69, 'name8051');
+INSERT INTO t VALUES (8052, 2, 37.88, 'name8052');
+INSERT INTO t VALUES (8053, 3, 17.07, 'name8053');
+INSERT INTO t VALUES (8054, 4, 96.26, 'name8054');
+INSERT INTO t VALUES (8055, 5, 75.45, 'name8055');
+INSERT INTO t VALUES (8056, 6, 54.64, 'name8056');
+INSERT INTO t VALUES (8057, 7, 33.83, 'name8057');
+INSERT INTO t VALUES (8058, 8, 13.02, 'name8058');
+INSERT INTO t VALUES (8059, 9, 92.21, 'name8059');
+INSERT INTO t VALUES (8060, 0, 71.40, 'name8060');
+INSERT INTO t VALUES (8061, 1, 50.59, 'name8061');
+INSERT INTO t VALUES (8062, 2, 29.78, 'name8062');
+INSERT INTO t VALUES (8063, 3, 8.97, 'name8063');
+INSERT INTO t VALUES (8064, 4, 88.16, 'name8064');
+INSERT INTO t VALUES (8065, 5, 67.35, 'name8065');
+INSERT INTO t VALUES (8066, 6, 46.54, 'name8066');
+INSERT INTO t VALUES (8067, 7, 25.73, 'name8067');
+INSERT INTO t VALUES (8068, 8, 4.92, 'name8068');
+INSERT INTO t VALUES (8069, 9, 84.11, 'name8069');
+INSERT INTO t VALUES (8070, 0, 63.30, 'name8070');
+INSERT INTO t VALUES (8071, 1, 42.49, 'name8071');
+INSERT INTO t VALUES (8072, 2, 21.68, 'name8072');
+INSERT INTO t VALUES (8073, 3, 0.87, 'name8073');
+INSERT INTO t VALUES (8074, 4, 80.06, 'name8074');
+INSERT INTO t VALUES (8075, 5, 59.25, 'name8075');
+INSERT INTO t VALUES (8076, 6, 38.44, 'name8076');
+INSERT INTO t VALUES (8077, 7, 17.63, 'name8077');
+INSERT INTO t VALUES (8078, 8, 96.82, 'name8078');
+INSERT INTO t VALUES (8079, 9, 76.01, 'name8079');
+INSERT INTO t VALUES (8080, 0, 55.20, 'name8080');
+INSERT INTO t VALUES (8081, 1, 34.39, 'name8081');
+INSERT INTO t VALUES (8082, 2, 13.58, 'name8082');
+INSERT INTO t VALUES (8083, 3, 92.77, 'name8083');
+INSERT INTO t VALUES (8084, 4, 71.96, 'name8084');
+INSERT INTO t VALUES (8085, 5, 51.15, 'name8085');
+INSERT INTO t VALUES (8086, 6, 30.34, 'name8086');
+INSERT INTO t VALUES (8087, 7, 9.53, 'name8087');
+INSERT INTO t VALUES (8088, 8, 88.72, 'name8088');
+INSERT INTO t VALUES (8089, 9, 67.91, 'name8089');
+INSERT INTO t VALUES (8090, 0, 47.10, 'name8090');
+INSERT INTO t VALUES (8091, 1, 26.29, 'name8091');
+INSERT INTO t VALUES (8092, 2, 5.48, 'name8092');
+INSERT INTO t VALUES (8093, 3, 84.67, 'name8093');
+INSERT INTO t VALUES (8094, 4, 63.86, 'name8094');
+INSERT INTO t VALUES (8095, 5, 43.05, 'name8095');
+INSERT INTO t VALUES (8096, 6, 22.24, 'name8096');
+INSERT INTO t VALUES (8097, 7, 1.43, 'name8097');
+INSERT INTO t VALUES (8098, 8, 80.62, 'name8098');
+INSERT INTO t VALUES (8099, 9, 59.81, 'name8099');
+INSERT INTO t VALUES (8100, 0, 39.00, 'name8100');
+INSERT INTO t VALUES (8101, 1, 18.19, 'name8101');
+INSERT INTO t VALUES (8102, 2, 97.38, 'name8102');
+INSERT INTO t VALUES (8103, 3, 76.57, 'name8103');
+INSERT INTO t VALUES (8104, 4, 55.76, 'name8104');
+INSERT INTO t VALUES (8105, 5, 34.95, 'name8105');
+INSERT INTO t VALUES (8106, 6, 14.14, 'name8106');
+INSERT INTO t VALUES (8107, 7, 93.33, 'name8107');
+INSERT INTO t VALUES (8108, 8, 72.52, 'name8108');
+INSERT INTO t VALUES (8109, 9, 51.71, 'name8109');
+INSERT INTO t VALUES (8110, 0, 30.90, 'name8110');
+INSERT INTO t VALUES (8111, 1, 10.09, 'name8111');
+INSERT INTO t VALUES (8112, 2, 89.28, 'name8112');
+INSERT INTO t VALUES (8113, 3, 68.47, 'name8113');
+INSERT INTO t VALUES (8114, 4, 47.66, 'name8114');
+INSERT INTO t VALUES (8115, 5, 26.85, 'name8115');
+INSERT INTO t VALUES (8116, 6, 6.04, 'name8116');
+INSERT INTO t VALUES (8117, 7, 85.23, 'name8117');
+INSERT INTO t VALUES (8118, 8, 64.42, 'name8118');
+INSERT INTO t VALUES (8119, 9, 43.61, 'name8119');
+INSERT INTO t VALUES (8120, 0, 22.80, 'name8120');
+INSERT INTO t VALUES (8121, 1, 1.99, 'name8121');
+INSERT INTO t VALUES (8122, 2, 81.18, 'name8122');
+INSERT INTO t VALUES (8123, 3, 60.37, 'name8123');
+INSERT INTO t VALUES (8124, 4, 39.56, 'name8124');
+INSERT INTO t VALUES (8125, 5, 18.75, 'name8125');
+INSERT INTO t VALUES (8126, 6, 97.94, 'name8126');
+INSERT INTO t VALUES (8127, 7, 77.13, 'name8127');
+INSERT INTO t VALUES (8128, 8, 56.32, 'name8128');
+INSERT INTO t VALUES (8129, 9, 35.51, 'name8129');
+INSERT INTO t VALUES (8130, 0, 14.70, 'name8130');
+INSERT INTO t VALUES (8131, 1, 93.89, 'name8131');
+INSERT INTO t VALUES (8132, 2, 73.08, 'name8132');
+INSERT INTO t VALUES (8133, 3, 52.27, 'name8133');
+INSERT INTO t VALUES (8134, 4, 31.46, 'name8134');
+INSERT INTO t VALUES (8135, 5, 10.65, 'name8135');
+INSERT INTO t VALUES (8136, 6, 89.84, 'name8136');
+INSERT INTO t VALUES (8137, 7, 69.03, 'name8137');
+INSERT INTO t VALUES (8138, 8, 48.22, 'name8138');
+INSERT INTO t VALUES (8139, 9, 27.41, 'name8139');
+INSERT INTO t VALUES (8140, 0, 6.60, 'name8140');
+INSERT INTO t VALUES (8141, 1, 85.79, 'name8141');
+INSERT INTO t VALUES (8142, 2, 64.98, 'name8142');
+INSERT INTO t VALUES (8143, 3, 44.17, 'name8143');
+INSERT INTO t VALUES (8144, 4, 23.36, 'name8144');
+INSERT INTO t VALUES (8145, 5, 2.55, 'name8145');
+INSERT INTO t VALUES (8146, 6, 81.74, 'name8146');
+INSERT INTO t VALUES (8147, 7, 60.93, 'name8147');
+INSERT INTO t VALUES (8148, 8, 40.12, 'name8148');
+INSERT INTO t VALUES (8149, 9, 19.31, 'name8149');
+INSERT INTO t VALUES (8150, 0, 98.50, 'name8150');
+INSERT INTO t VALUES (8151, 1, 77.69, 'name8151');
+INSERT INTO t VALUES (8152, 2, 56.88, 'name8152');
+INSERT INTO t VALUES (8153, 3, 36.07, 'name8153');
+INSERT INTO t VALUES (8154, 4, 15.26, 'name8154');
+INSERT INTO t VALUES (8155, 5, 94.45, 'name8155');
+INSERT INTO t VALUES (8156, 6, 73.64, 'name8156');
+INSERT INTO t VALUES (8157, 7, 52.83, 'name8157');
+INSERT INTO t VALUES (8158, 8, 32.02, 'name8158');
+INSERT INTO t VALUES (8159, 9, 11.21, 'name8159');
+INSERT INTO t VALUES (8160, 0, 90.40, 'name8160');
+INSERT INTO t VALUES (8161, 1, 69.59, 'name8161');
+INSERT INTO t VALUES (8162, 2, 48.78, 'name8162');
+INSERT INTO t VALUES (8163, 3, 27.97, 'name8163');
+INSERT INTO t VALUES (8164, 4, 7.16, 'name8164');
+INSERT INTO t VALUES (8165, 5, 86.35, 'name8165');
+INSERT INTO t VALUES (8166, 6, 65.54, 'name8166');
+INSERT INTO t VALUES (8167, 7, 44.73, 'name8167');
+INSERT INTO t VALUES (8168, 8, 23.92, 'name8168');
+INSERT INTO t VALUES (8169, 9, 3.11, 'name8169');
+INSERT INTO t VALUES (8170, 0, 82.30, 'name8170');
+INSERT INTO t VALUES (8171, 1, 61.49, 'name8171');
+INSERT INTO t VALUES (8172, 2, 40.68, 'name8172');
+INSERT INTO t VALUES (8173, 3, 19.87, 'name8173');
+INSERT INTO t VALUES (8174, 4, 99.06, 'name8174');
+INSERT INTO t VALUES (8175, 5, 78.25, 'name8175');
+INSERT INTO t VALUES (8176, 6, 57.44, 'name8176');
+INSERT INTO t VALUES (8177, 7, 36.63, 'name8177');
+INSERT INTO t VALUES (8178, 8, 15.82, 'name8178');
+INSERT INTO t VALUES (8179, 9, 95.01, 'name8179');
+INSERT INTO t VALUES (8180, 0, 74.20, 'name8180');
+INSERT INTO t VALUES (8181, 1, 53.39, 'name8181');
+INSERT INTO t VALUES (8182, 2, 32.58, 'name8182');
+INSERT INTO t VALUES (8183, 3, 11.77, 'name8183');
+INSERT INTO t VALUES (8184, 4, 90.96, 'name8184');
+INSERT INTO t VALUES (8185, 5, 70.15, 'name8185');
+INSERT INTO t VALUES (8186, 6, 49.34, 'name8186');
+INSERT INTO t VALUES (8187, 7, 28.53, 'name8187');
+INSERT INTO t VALUES (8188, 8, 7.72, 'name8188');
+INSERT INTO t VALUES (8189, 9, 86.91, 'name8189');
+INSERT INTO t VALUES (8190, 0, 66.10, 'name8190');
+INSERT INTO t VALUES (8191, 1, 45.29, 'name8191');
+INSERT INTO orders VALUES (0, 0, 0);
+INSERT INTO orders VALUES (1, 3, 13);
+INSERT INTO orders VALUES (2, 6, 26);
+INSERT INTO orders VALUES (3, 9, 39);
+INSERT INTO orders VALUES (4, 12, 52);
+INSERT INTO orders VALUES (5, 15, 65);
+INSERT INTO orders VALUES (6, 18, 78);
+INSERT INTO orders VALUES (7, 21, 91);
+INSERT INTO orders VALUES (8, 24, 4);
+INSERT INTO orders VALUES (9, 27, 17);
+INSERT INTO orders VALUES (10, 30, 30);
+INSERT INTO orders VALUES (11, 33, 43);
+INSERT INTO orders VALUES (12, 36, 56);
+INSERT INTO orders VALUES (13, 39, 69);
+INSERT INTO orders VALUES (14, 42, 82);
+INSERT INTO orders VALUES (15, 45, 95);
+INSERT INTO orders VALUES (16, 48, 8);
+INSERT INTO orders VALUES (17, 51, 21);
+INSERT INTO orders VALUES (18, 54, 34);
+INSERT INTO orders VALUES (19, 57, 47);
+INSERT INTO orders VALUES (20, 60, 60);
+INSERT INTO orders VALUES (21, 63, 73);
+INSERT INTO orders VALUES (22, 66, 86);
+INSERT INTO orders VALUES (23, 69, 99);
+INSERT INTO orders VALUES (24, 72, 12);
+INSERT INTO orders VALUES (25, 75, 25);
+INSERT INTO orders VALUES (26, 78, 38);
+INSERT INTO orders VALUES (27, 81, 51);
+INSERT INTO orders VALUES (28, 84, 64);
+INSERT INTO orders VALUES (29, 87, 77);
+INSERT INTO orders VALUES (30, 90, 90);
+INSERT INTO orders VALUES (31, 93, 3);
+INSERT INTO orders VALUES (32, 96, 16);
+INSERT INTO orders VALUES (33, 99, 29);
+INSERT INTO orders VALUES (34, 102, 42);
+INSERT INTO orders VALUES (35, 105, 55);
+INSERT INTO orders VALUES (36, 108, 68);
+INSERT INTO orders VALUES (37, 111, 81);
+INSERT INTO orders VALUES (38, 114, 94);
+INSERT INTO orders VALUES (39, 117, 7);
+INSERT INTO orders VALUES (40, 120, 20);
+INSERT INTO orders VALUES (41, 123, 33);
+INSERT INTO orders VALUES (42, 126, 46);
+INSERT INTO orders VALUES (43, 129, 59);
+INSERT INTO orders VALUES (44, 132, 72);
+INSERT INTO orders VALUES (45, 135, 85);
+INSERT INTO orders VALUES (46, 138, 98);
+INSERT INTO orders VALUES (47, 141, 11);
+INSERT INTO orders VALUES (48, 144, 24);
+INSERT INTO orders VALUES (49, 147, 37);
+INSERT INTO orders VALUES (50, 150, 50);
+INSERT INTO orders VALUES (51, 153, 63);
+INSERT INTO orders VALUES (52, 156, 76);
+INSERT INTO orders VALUES (53, 159, 89);
+INSERT INTO orders VALUES (54, 162, 2);
+INSERT INTO orders VALUES (55, 165, 15);
+INSERT INTO orders VALUES (56, 168, 28);
+INSERT INTO orders VALUES (57, 171, 41);
+INSERT INTO orders VALUES (58, 174, 54);
+INSERT INTO orders VALUES (59, 177, 67);
+INSERT INTO orders VALUES (60, 180, 80);
+INSERT INTO orders VALUES (61, 183, 93);
+INSERT INTO orders VALUES (62, 186, 6);
+INSERT INTO orders VALUES (63, 189, 19);
+INSERT INTO orders VALUES (64, 192, 32);
+INSERT INTO orders VALUES (65, 195, 45);
+INSERT INTO orders VALUES (66, 198, 58);
+INSERT INTO orders VALUES (67, 201, 71);
+INSERT INTO orders VALUES (68, 204, 84);
+INSERT INTO orders VALUES (69, 207, 97);
+INSERT INTO orders VALUES (70, 210, 10);
+INSERT INTO orders VALUES (71, 213, 23);
+INSERT INTO orders VALUES (72, 216, 36);
+INSERT INTO orders VALUES (73, 219, 49);
+INSERT INTO orders VALUES (74, 222, 62);
+INSERT INTO orders VALUES (75, 225, 75);
+INSERT INTO orders VALUES (76, 228, 88);
+INSERT INTO orders VALUES (77, 231, 1);
+INSERT INTO orders VALUES (78, 234, 14);
+INSERT INTO orders VALUES (79, 237, 27);
+INSERT INTO orders VALUES (80, 240, 40);
+INSERT INTO orders VALUES (81, 243, 53);
+INSERT INTO orders VALUES (82, 246, 66);
+INSERT INTO orders VALUES (83, 249, 79);
+INSERT INTO orders VALUES (84, 252, 92);
+INSERT INTO orders VALUES (85, 255, 5);
+INSERT INTO orders VALUES (86, 258, 18);
+INSERT INTO orders VALUES (87, 261, 31);
+INSERT INTO orders VALUES (88, 264, 44);
+INSERT INTO orders VALUES (89, 267, 57);
+INSERT INTO orders VALUES (90, 270, 70);
+INSERT INTO orders VALUES (91, 273, 83);
+INSERT INTO orders VALUES (92, 276, 96);
+INSERT INTO orders VALUES (93, 279, 9);
+INSERT INTO orders VALUES (94, 282, 22);
+INSERT INTO orders VALUES (95, 285, 35);
+INSERT INTO orders VALUES (96, 288, 48);
+INSERT INTO orders VALUES (97, 291, 61);
+INSERT INTO orders VALUES (98, 294, 74);
+INSERT INTO orders VALUES (99, 297, 87);
+INSERT INTO orders VALUES (100, 300, 0);
+INSERT INTO orders VALUES (101, 303, 13);
+INSERT INTO orders VALUES (102, 306, 26);
+INSERT INTO orders VALUES (103, 309, 39);
+INSERT INTO orders VALUES (104, 312, 52);
+INSERT INTO orders VALUES (105, 315, 65);
+INSERT INTO orders VALUES (106, 318, 78);
+INSERT INTO orders VALUES (107, 321, 91);
+INSERT INTO orders VALUES (108, 324, 4);
+INSERT INTO orders VALUES (109, 327, 17);
+INSERT INTO orders VALUES (110, 330, 30);
+INSERT INTO orders VALUES (111, 333, 43);
+INSERT INTO orders VALUES (112, 336, 56);
+INSERT INTO orders VALUES (113, 339, 69);
+INSERT INTO orders VALUES (114, 342, 82);
+INSERT INTO orders VALUES (115, 345, 95);
+INSERT INTO orders VALUES (116, 348, 8);
+INSERT INTO orders VALUES (117, 351, 21);
+INSERT INTO orders VALUES (118, 354, 34);
+INSERT INTO orders VALUES (119, 357, 47);
+INSERT INTO orders VALUES (120, 360, 60);
+INSERT INTO orders VALUES (121, 363, 73);
+INSERT INTO orders VALUES (122, 366, 86);
+INSERT INTO orders VALUES (123, 369, 99);
+INSERT INTO orders VALUES (124, 372, 12);
+INSERT INTO orders VALUES (125, 375, 25);
+INSERT INTO orders VALUES (126, 378, 38);
+INSERT INTO orders VALUES (127, 381, 51);
+INSERT INTO orders VALUES (128, 384, 64);
+INSERT INTO orders VALUES (129, 387, 77);
+INSERT INTO orders VALUES (130, 390, 90);
+INSERT INTO orders VALUES (131, 393, 3);
+INSERT INTO orders VALUES (132, 396, 16);
+INSERT INTO orders VALUES (133, 399, 29);
+INSERT INTO orders VALUES (134, 402, 42);
+INSERT INTO orders VALUES (135, 405, 55);
+INSERT INTO orders VALUES (136, 408, 68);
+INSERT INTO orders VALUES (137, 411, 81);
+INSERT INTO orders VALUES (138, 414, 94);
+INSERT INTO orders VALUES (139, 417, 7);
+INSERT INTO orders VALUES (140, 420, 20);
+INSERT INTO orders VALUES (141, 423, 33);
+INSERT INTO orders VALUES (142, 426, 46);
+INSERT INTO orders VALUES (143, 429, 59);
+INSERT INTO orders VALUES (144, 432, 72);
+INSERT INTO orders VALUES (145, 435, 85);
+INSERT INTO orders VALUES (146, 438, 98);
+INSERT INTO orders VALUES (147, 441, 11);
+INSERT INTO orders VALUES (148, 444, 24);
+INSERT INTO orders VALUES (149, 447, 37);
+INSERT INTO orders VALUES (150, 450, 50);
+INSERT INTO orders VALUES (151, 453, 63);
+INSERT INTO orders VALUES (152, 456, 76);
+INSERT INTO orders VALUES (153, 459, 89);
+INSERT INTO orders VALUES (154, 462, 2);
+INSERT INTO orders VALUES (155, 465, 15);
+INSERT INTO orders VALUES (156, 468, 28);
+INSERT INTO orders VALUES (157, 471, 41);
+INSERT INTO orders VALUES (158, 474, 54);
+INSERT INTO orders VALUES (159, 477, 67);
+INSERT INTO orders VALUES (160, 480, 80);
+INSERT INTO orders VALUES (161, 483, 93);
+INSERT INTO orders VALUES (162, 486, 6);
+INSERT INTO orders VALUES (163, 489, 19);
+INSERT INTO orders VALUES (164, 492, 32);
+INSERT INTO orders VALUES (165, 495, 45);
+INSERT INTO orders VALUES (166, 498, 58);
+INSERT INTO orders VALUES (167, 501, 71);
+INSERT INTO orders VALUES (168, 504, 84);
+INSERT INTO orders VALUES (169, 507, 97);
+INSERT INTO orders VALUES (170, 510, 10);
+INSERT INTO orders VALUES (171, 513, 23);
+INSERT INTO orders VALUES (172, 516, 36);
+INSERT INTO orders VALUES (173, 519, 49);
+INSERT INTO orders VALUES (174, 522, 62);
+INSERT INTO orders VALUES (175, 525, 75);
+INSERT INTO orders VALUES (176, 528, 88);
+INSERT INTO orders VALUES (177, 531, 1);
+INSERT INTO orders VALUES (178, 534, 14);
+INSERT INTO orders VALUES (179, 537, 27);
+INSERT INTO orders VALUES (180, 540, 40);
+INSERT INTO orders VALUES (181, 543, 53);
+INSERT INTO orders VALUES (182, 546, 66);
+INSERT INTO orders VALUES (183, 549, 79);
+INSERT INTO orders VALUES (184, 552, 92);
+INSERT INTO orders VALUES (185, 555, 5);
+INSERT INTO orders VALUES (186, 558, 18);
+INSERT INTO orders VALUES (187, 561, 31);
+INSERT INTO orders VALUES (188, 564, 44);
+INSERT INTO orders VALUES (189, 567, 57);
+INSERT INTO orders VALUES (190, 570, 70);
+INSERT INTO orders VALUES (191, 573, 83);
+INSERT INTO orders VALUES (192, 576, 96);
+INSERT INTO orders VALUES (193, 579, 9);
+INSERT INTO orders VALUES (194, 582, 22);
+INSERT INTO orders VALUES (195, 585, 35);
+INSERT INTO orders VALUES (196, 588, 48);
+INSERT INTO orders VALUES (197, 591, 61);
+INSERT INTO orders VALUES (198, 594, 74);
+INSERT INTO orders VALUES (199, 597, 87);
+INSERT INTO orders VALUES (200, 600, 0);
+INSERT INTO orders VALUES (201, 603, 13);
+INSERT INTO orders VALUES (202, 606, 26);
+INSERT INTO orders VALUES (203, 609, 39);
+INSERT INTO orders VALUES (204, 612, 52);
+INSERT INTO orders VALUES (205, 615, 65);
+INSERT INTO orders VALUES (206, 618, 78);
+INSERT INTO orders VALUES (207, 621, 91);
+INSERT INTO orders VALUES (208, 624, 4);
+INSERT INTO orders VALUES (209, 627, 17);
+INSERT INTO orders VALUES (210, 630, 30);
+INSERT INTO orders VALUES (211, 633, 43);
+INSERT INTO orders VALUES (212, 636, 56);
+INSERT INTO orders VALUES (213, 639, 69);
+INSERT INTO orders VALUES (214, 642, 82);
+INSERT INTO orders VALUES (215, 645, 95);
+INSERT INTO orders VALUES (216, 648, 8);
+INSERT INTO orders VALUES (217, 651, 21);
+INSERT INTO orders VALUES (218, 654, 34);
+INSERT INTO orders VALUES (219, 657, 47);
+INSERT INTO orders VALUES (220, 660, 60);
+INSERT INTO orders VALUES (221, 663, 73);
+INSERT INTO orders VALUES (222, 666, 86);
+INSERT INTO orders VALUES (223, 669, 99);
+INSERT INTO orders VALUES (224, 672, 12);
+INSERT INTO orders VALUES (225, 675, 25);
+INSERT INTO orders VALUES (226, 678, 38);
+INSERT INTO orders VALUES (227, 681, 51);
+INSERT INTO orders VALUES (228, 684, 64);
+INSERT INTO orders VALUES (229, 687, 77);
+INSERT INTO orders VALUES (230, 690, 90);
+INSERT INTO orders VALUES (231, 693, 3);
+INSERT INTO orders VALUES (232, 696, 16);
+INSERT INTO orders VALUES (233, 699, 29);
+INSERT INTO orders VALUES (234, 702, 42);
+INSERT INTO orders VALUES (235, 705, 55);
+INSERT INTO orders VALUES (236, 708, 68);
+INSERT INTO orders VALUES (237, 711, 81);
+INSERT INTO orders VALUES (238, 714, 94);
+INSERT INTO orders VALUES (239, 717, 7);
+INSERT INTO orders VALUES (240, 720, 20);
+INSERT INTO orders VALUES (241, 723, 33);
+INSERT INTO orders VALUES (242, 726, 46);
+INSERT INTO orders VALUES (243, 729, 59);
+INSERT INTO orders VALUES (244, 732, 72);
+INSERT INTO orders VALUES (245, 735, 85);
+INSERT INTO orders VALUES (246, 738, 98);
+INSERT INTO orders VALUES (247, 741, 11);
+INSERT INTO orders VALUES (248, 744, 24);
+INSERT INTO orders VALUES (249, 747, 37);
+INSERT INTO orders VALUES (250, 750, 50);
+INSERT INTO orders VALUES (251, 753, 63);
+INSERT INTO orders VALUES (252, 756, 76);
+INSERT INTO orders VALUES (253, 759, 89);
+INSERT INTO orders VALUES (254, 762, 2);
+INSERT INTO orders VALUES (255, 765, 15);
+INSERT INTO orders VALUES (256, 768, 28);
+INSERT INTO orders VALUES (257, 771, 41);
+INSERT INTO orders VALUES (258, 774, 54);
+INSERT INTO orders VALUES (259, 777, 67);
+INSERT INTO orders VALUES (260, 780, 80);
+INSERT INTO orders VALUES (261, 783, 93);
+INSERT INTO orders VALUES (262, 786, 6);
+INSERT INTO orders VALUES (263, 789, 19);
+INSERT INTO orders VALUES (264, 792, 32);
+INSERT INTO orders VALUES (265, 795, 45);
+INSERT INTO orders VALUES (266, 798, 58);
+INSERT INTO orders VALUES (267, 801, 71);
+INSERT INTO orders VALUES (268, 804, 84);
+INSERT INTO orders VALUES (269, 807, 97);
+INSERT INTO orders VALUES (270, 810, 10);
+INSERT INTO orders VALUES (271, 813, 23);
+INSERT INTO orders VALUES (272, 816, 36);
+INSERT INTO orders VALUES (273, 819, 49);
+INSERT INTO orders VALUES (274, 822, 62);
+INSERT INTO orders VALUES (275, 825, 75);
+INSERT INTO orders VALUES (276, 828, 88);
+INSERT INTO orders VALUES (277, 831, 1);
+INSERT INTO orders VALUES (278, 834, 14);
+INSERT INTO orders VALUES (279, 837, 27);
+INSERT INTO orders VALUES (280, 840, 40);
+INSERT INTO orders VALUES (281, 843, 53);
+INSERT INTO orders VALUES (282, 846, 66);
+INSERT INTO orders VALUES (283, 849, 79);
+INSERT INTO orders VALUES (284, 852, 92);
+INSERT INTO orders VALUES (285, 855, 5);
+INSERT INTO orders VALUES (286, 858, 18);
+INSERT INTO orders VALUES (287, 861, 31);
+INSERT INTO orders VALUES (288, 864, 44);
+INSERT INTO orders VALUES (289, 867, 57);
+INSERT INTO orders VALUES (290, 870, 70);
+INSERT INTO orders VALUES (291, 873, 83);
+INSERT INTO orders VALUES (292, 876, 96);
+INSERT INTO orders VALUES (293, 879, 9);
+INSERT INTO orders VALUES (294, 882, 22);
+INSERT INTO orders VALUES (295, 885, 35);
+INSERT INTO orders VALUES (296, 888, 48);
+INSERT INTO orders VALUES (297, 891, 61);
+INSERT INTO orders VALUES (298, 894, 74);
+INSERT INTO orders VALUES (299, 897, 87);
+INSERT INTO orders VALUES (300, 900, 0);
+INSERT INTO orders VALUES (301, 903, 13);
+INSERT INTO orders VALUES (302, 906, 26);
+INSERT INTO orders VALUES (303, 909, 39);
+INSERT INTO orders VALUES (304, 912, 52);
+INSERT INTO orders VALUES (305, 915, 65);
+INSERT INTO orders VALUES (306, 918, 78);
+INSERT INTO orders VALUES (307, 921, 91);
+INSERT INTO orders VALUES (308, 924, 4);
+INSERT INTO orders VALUES (309, 927, 17);
+INSERT INTO orders VALUES (310, 930, 30);
+INSERT INTO orders VALUES (311, 933, 43);
+INSERT INTO orders VALUES (312, 936, 56);
+INSERT INTO orders VALUES (313, 939, 69);
+INSERT INTO orders VALUES (314, 942, 82);
+INSERT INTO orders VALUES (315, 945, 95);
+INSERT INTO orders VALUES (316, 948, 8);
+INSERT INTO orders VALUES (317, 951, 21);
+INSERT INTO orders VALUES (318, 954, 34);
+INSERT INTO orders VALUES (319, 957, 47);
+INSERT INTO orders VALUES (320, 960, 60);
+INSERT INTO orders VALUES (321, 963, 73);
+INSERT INTO orders VALUES (322, 966, 86);
+INSERT INTO orders VALUES (323, 969, 99);
+INSERT INTO orders VALUES (324, 972, 12);
+INSERT INTO orders VALUES (325, 975, 25);
+INSERT INTO orders VALUES (326, 978, 38);
+INSERT INTO orders VALUES (327, 981, 51);
+INSERT INTO orders VALUES (328, 984, 64);
+INSERT INTO orders VALUES (329, 987, 77);
+INSERT INTO orders VALUES (330, 990, 90);
+INSERT INTO orders VALUES (331, 993, 3);
+INSERT INTO orders VALUES (332, 996, 16);
+INSERT INTO orders VALUES (333, 999, 29);
+INSERT INTO orders VALUES (334, 1002, 42);
+INSERT INTO orders VALUES (335, 1005, 55);
+INSERT INTO orders VALUES (336, 1008, 68);
+INSERT INTO orders VALUES (337, 1011, 81);
+INSERT INTO orders VALUES (338, 1014, 94);
+INSERT INTO orders VALUES (339, 1017, 7);
+INSERT INTO orders VALUES (340, 1020, 20);
+INSERT INTO orders VALUES (341, 1023, 33);
+INSERT INTO orders VALUES (342, 1026, 46);
+INSERT INTO orders VALUES (343, 1029, 59);
+INSERT INTO orders VALUES (344, 1032, 72);
+INSERT INTO orders VALUES (345, 1035, 85);
+INSERT INTO orders VALUES (346, 1038, 98);
+INSERT INTO orders VALUES (347, 1041, 11);
+INSERT INTO orders VALUES (348, 1044, 24);
+INSERT INTO orders VALUES (349, 1047, 37);
+INSERT INTO orders VALUES (350, 1050, 50);
+INSERT INTO orders VALUES (351, 1053, 63);
+INSERT INTO orders VALUES (352, 1056, 76);
+INSERT INTO orders VALUES (353, 1059, 89);
+INSERT INTO orders VALUES (354, 1062, 2);
+INSERT INTO orders VALUES (355, 1065, 15);
+INSERT INTO orders VALUES (356, 1068, 28);
+INSERT INTO orders VALUES (357, 1071, 41);
+INSERT INTO orders VALUES (358, 1074, 54);
+INSERT INTO orders VALUES (359, 1077, 67);
+INSERT INTO orders VALUES (360, 1080, 80);
+INSERT INTO orders VALUES (361, 1083, 93);
+INSERT INTO orders VALUES (362, 1086, 6);
+INSERT INTO orders VALUES (363, 1089, 19);
+INSERT INTO orders VALUES (364, 1092, 32);
+INSERT INTO orders VALUES (365, 1095, 45);
+INSERT INTO orders VALUES (366, 1098, 58);
+INSERT INTO orders VALUES (367, 1101, 71);
+INSERT INTO orders VALUES (368, 1104, 84);
+INSERT INTO orders VALUES (369, 1107, 97);
+INSERT INTO orders VALUES (370, 1110, 10);
+INSERT INTO orders VALUES (371, 1113, 23);
+INSERT INTO orders VALUES (372, 1116, 36);
+INSERT INTO orders VALUES (373, 1119, 49);
+INSERT INTO orders VALUES (374, 1122, 62);
+INSERT INTO orders VALUES (375, 1125, 75);
+INSERT INTO orders VALUES (376, 1128, 88);
+INSERT INTO orders VALUES (377, 1131, 1);
+INSERT INTO orders VALUES (378, 1134, 14);
+INSERT INTO orders VALUES (379, 1137, 27);
+INSERT INTO orders VALUES (380, 1140, 40);
+INSERT INTO orders VALUES (381, 1143, 53);
+INSERT INTO orders VALUES (382, 1146, 66);
+INSERT INTO orders VALUES (383, 1149, 79);
+INSERT INTO orders VALUES (384, 1152, 92);
+INSERT INTO orders VALUES (385, 1155, 5);
+INSERT INTO orders VALUES (386, 1158, 18);
+INSERT INTO orders VALUES (387, 1161, 31);
+INSERT INTO orders VALUES (388, 1164, 44);
+INSERT INTO orders VALUES (389, 1167, 57);
+INSERT INTO orders VALUES (390, 1170, 70);
+INSERT INTO orders VALUES (391, 1173, 83);
+INSERT INTO orders VALUES (392, 1176, 96);
+INSERT INTO orders VALUES (393, 1179, 9);
+INSERT INTO orders VALUES (394, 1182, 22);
+INSERT INTO orders VALUES (395, 1185, 35);
+INSERT INTO orders VALUES (396, 1188, 48);
+INSERT INTO orders VALUES (397, 1191, 61);
+INSERT INTO orders VALUES (398, 1194, 74);
+INSERT INTO orders VALUES (399, 1197, 87);
+INSERT INTO orders VALUES (400, 1200, 0);
+INSERT INTO orders VALUES (401, 1203, 13);
+INSERT INTO orders VALUES (402, 1206, 26);
+INSERT INTO orders VALUES (403, 1209, 39);
+INSERT INTO orders VALUES (404, 1212, 52);
+INSERT INTO orders VALUES (405, 1215, 65);
+INSERT INTO orders VALUES (406, 1218, 78);
+INSERT INTO orders VALUES (407, 1221, 91);
+INSERT INTO orders VALUES (408, 1224, 4);
+INSERT INTO orders VALUES (409, 1227, 17);
+INSERT INTO orders VALUES (410, 1230, 30);
+INSERT INTO orders VALUES (411, 1233, 43);
+INSERT INTO orders VALUES (412, 1236, 56);
+INSERT INTO orders VALUES (413, 1239, 69);
+INSERT INTO orders VALUES (414, 1242, 82);
+INSERT INTO orders VALUES (415, 1245, 95);
+INSERT INTO orders VALUES (416, 1248, 8);
+INSERT INTO orders VALUES (417, 1251, 21);
+INSERT INTO orders VALUES (418, 1254, 34);
+INSERT INTO orders VALUES (419, 1257, 47);
+INSERT INTO orders VALUES (420, 1260, 60);
+INSERT INTO orders VALUES (421, 1263, 73);
+INSERT INTO orders VALUES (422, 1266, 86);
+INSERT INTO orders VALUES (423, 1269, 99);
+INSERT INTO orders VALUES (424, 1272, 12);
+INSERT INTO orders VALUES (425, 1275, 25);
+INSERT INTO orders VALUES (426, 1278, 38);
+INSERT INTO orders VALUES (427, 1281, 51);
+INSERT INTO orders VALUES (428, 1284, 64);
+INSERT INTO orders VALUES (429, 1287, 77);
+INSERT INTO orders VALUES (430, 1290, 90);
+INSERT INTO orders VALUES (431, 1293, 3);
+INSERT INTO orders VALUES (432, 1296, 16);
+INSERT INTO orders VALUES (433, 1299, 29);
+INSERT INTO orders VALUES (434, 1302, 42);
+INSERT INTO orders VALUES (435, 1305, 55);
+INSERT INTO orders VALUES (436, 1308, 68);
+INSERT INTO orders VALUES (437, 1311, 81);
+INSERT INTO orders VALUES (438, 1314, 94);
+INSERT INTO orders VALUES (439, 1317, 7);
+INSERT INTO orders VALUES (440, 1320, 20);
+INSERT INTO orders VALUES (441, 1323, 33);
+INSERT INTO orders VALUES (442, 1326, 46);
+INSERT INTO orders VALUES (443, 1329, 59);
+INSERT INTO orders VALUES (444, 1332, 72);
+INSERT INTO orders VALUES (445, 1335, 85);
+INSERT INTO orders VALUES (446, 1338, 98);
+INSERT INTO orders VALUES (447, 1341, 11);
+INSERT INTO orders VALUES (448, 1344, 24);
+INSERT INTO orders VALUES (449, 1347, 37);
+INSERT INTO orders VALUES (450, 1350, 50);
+INSERT INTO orders VALUES (451, 1353, 63);
+INSERT INTO orders VALUES (452, 1356, 76);
+INSERT INTO orders VALUES (453, 1359, 89);
+INSERT INTO orders VALUES (454, 1362, 2);
+INSERT INTO orders VALUES (455, 1365, 15);
+INSERT INTO orders VALUES (456, 1368, 28);
+INSERT INTO orders VALUES (457, 1371, 41);
+INSERT INTO orders VALUES (458, 1374, 54);
+INSERT INTO orders VALUES (459, 1377, 67);
+INSERT INTO orders VALUES (460, 1380, 80);
+INSERT INTO orders VALUES (461, 1383, 93);
+INSERT INTO orders VALUES (462, 1386, 6);
+INSERT INTO orders VALUES (463, 1389, 19);
+INSERT INTO orders VALUES (464, 1392, 32);
+INSERT INTO orders VALUES (465, 1395, 45);
+INSERT INTO orders VALUES (466, 1398, 58);
+INSERT INTO orders VALUES (467, 1401, 71);
+INSERT INTO orders VALUES (468, 1404, 84);
+INSERT INTO orders VALUES (469, 1407, 97);
+INSERT INTO orders VALUES (470, 1410, 10);
+INSERT INTO orders VALUES (471, 1413, 23);
+INSERT INTO orders VALUES (472, 1416, 36);
+INSERT INTO orders VALUES (473, 1419, 49);
+INSERT INTO orders VALUES (474, 1422, 62);
+INSERT INTO orders VALUES (475, 1425, 75);
+INSERT INTO orders VALUES (476, 1428, 88);
+INSERT INTO orders VALUES (477, 1431, 1);
+INSERT INTO orders VALUES (478, 1434, 14);
+INSERT INTO orders VALUES (479, 1437, 27);
+INSERT INTO orders VALUES (480, 1440, 40);
+INSERT INTO orders VALUES (481, 1443, 53);
+INSERT INTO orders VALUES (482, 1446, 66);
+INSERT INTO orders VALUES (483, 1449, 79);
+INSERT INTO orders VALUES (484, 1452, 92);
+INSERT INTO orders VALUES (485, 1455, 5);
+INSERT INTO orders VALUES (486, 1458, 18);
+INSERT INTO orders VALUES (487, 1461, 31);
+INSERT INTO orders VALUES (488, 1464, 44);
+INSERT INTO orders VALUES (489, 1467, 57);
+INSERT INTO orders VALUES (490, 1470, 70);
+INSERT INTO orders VALUES (491, 1473, 83);
+INSERT INTO orders VALUES (492, 1476, 96);
+INSERT INTO orders VALUES (493, 1479, 9);
+INSERT INTO orders VALUES (494, 1482, 22);
+INSERT INTO orders VALUES (495, 1485, 35);
+INSERT INTO orders VALUES (496, 1488, 48);
+INSERT INTO orders VALUES (497, 1491, 61);
+INSERT INTO orders VALUES (498, 1494, 74);
+INSERT INTO orders VALUES (499, 1497, 87);
+INSERT INTO orders VALUES (500, 1500, 0);
+INSERT INTO orders VALUES (501, 1503, 13);
+INSERT INTO orders VALUES (502, 1506, 26);
+INSERT INTO orders VALUES (503, 1509, 39);
+INSERT INTO orders VALUES (504, 1512, 52);
+INSERT INTO orders VALUES (505, 1515, 65);
+INSERT INTO orders VALUES (506, 1518, 78);
+INSERT INTO orders VALUES (507, 1521, 91);
+INSERT INTO orders VALUES (508, 1524, 4);
+INSERT INTO orders VALUES (509, 1527, 17);
+INSERT INTO orders VALUES (510, 1530, 30);
+INSERT INTO orders VALUES (511, 1533, 43);
+INSERT INTO orders VALUES (512, 1536, 56);
+INSERT INTO orders VALUES (513, 1539, 69);
+INSERT INTO orders VALUES (514, 1542, 82);
+INSERT INTO orders VALUES (515, 1545, 95);
+INSERT INTO orders VALUES (516, 1548, 8);
+INSERT INTO orders VALUES (517, 1551, 21);
+INSERT INTO orders VALUES (518, 1554, 34);
+INSERT INTO orders VALUES (519, 1557, 47);
+INSERT INTO orders VALUES (520, 1560, 60);
+INSERT INTO orders VALUES (521, 1563, 73);
+INSERT INTO orders VALUES (522, 1566, 86);
+INSERT INTO orders VALUES (523, 1569, 99);
+INSERT INTO orders VALUES (524, 1572, 12);
+INSERT INTO orders VALUES (525, 1575, 25);
+INSERT INTO orders VALUES (526, 1578, 38);
+INSERT INTO orders VALUES (527, 1581, 51);
+INSERT INTO orders VALUES (528, 1584, 64);
+INSERT INTO orders VALUES (529, 1587, 77);
+INSERT INTO orders VALUES (530, 1590, 90);
+INSERT INTO orders VALUES (531, 1593, 3);
+INSERT INTO orders VALUES (532, 1596, 16);
+INSERT INTO orders VALUES (533, 1599, 29);
+INSERT INTO orders VALUES (534, 1602, 42);
+INSERT INTO orders VALUES (535, 1605, 55);
+INSERT INTO orders VALUES (536, 1608, 68);
+INSERT INTO orders VALUES (537, 1611, 81);
+INSERT INTO orders VALUES (538, 1614, 94);
+INSERT INTO orders VALUES (539, 1617, 7);
+INSERT INTO orders VALUES (540, 1620, 20);
+INSERT INTO orders VALUES (541, 1623, 33);
+INSERT INTO orders VALUES (542, 1626, 46);
+INSERT INTO orders VALUES (543, 1629, 59);
+INSERT INTO orders VALUES (544, 1632, 72);
+INSERT INTO orders VALUES (545, 1635, 85);
+INSERT INTO orders VALUES (546, 1638, 98);
+INSERT INTO orders VALUES (547, 1641, 11);
+INSERT INTO orders VALUES (548, 1644, 24);
+INSERT INTO orders VALUES (549, 1647, 37);
+INSERT INTO orders VALUES (550, 1650, 50);
+INSERT INTO orders VALUES (551, 1653, 63);
+INSERT INTO orders VALUES (552, 1656, 76);
+INSERT INTO orders VALUES (553, 1659, 89);
+INSERT INTO orders VALUES (554, 1662, 2);
+INSERT INTO orders VALUES (555, 1665, 15);
+INSERT INTO orders VALUES (556, 1668, 28);
+INSERT INTO orders VALUES (557, 1671, 41);
+INSERT INTO orders VALUES (558, 1674, 54);
+INSERT INTO orders VALUES (559, 1677, 67);
+INSERT INTO orders VALUES (560, 1680, 80);
+INSERT INTO orders VALUES (561, 1683, 93);
+INSERT INTO orders VALUES (562, 1686, 6);
+INSERT INTO orders VALUES (563, 1689, 19);
+INSERT INTO orders VALUES (564, 1692, 32);
+INSERT INTO orders VALUES (565, 1695, 45);
+INSERT INTO orders VALUES (566, 1698, 58);
+INSERT INTO orders VALUES (567, 1701, 71);
+INSERT INTO orders VALUES (568, 1704, 84);
+INSERT INTO orders VALUES (569, 1707, 97);
+INSERT INTO orders VALUES (570, 1710, 10);
+INSERT INTO orders VALUES (571, 1713, 23);
+INSERT INTO orders VALUES (572, 1716, 36);
+INSERT INTO orders VALUES (573, 1719, 49);
+INSERT INTO orders VALUES (574, 1722, 62);
+INSERT INTO orders VALUES (575, 1725, 75);
+INSERT INTO orders VALUES (576, 1728, 88);
+INSERT INTO orders VALUES (577, 1731, 1);
+INSERT INTO orders VALUES (578, 1734, 14);
+INSERT INTO orders VALUES (579, 1737, 27);
+INSERT INTO orders VALUES (580, 1740, 40);
+INSERT INTO orders VALUES (581, 1743, 53);
+INSERT INTO orders VALUES (582, 1746, 66);
+INSERT INTO orders VALUES (583, 1749, 79);
+INSERT INTO orders VALUES (584, 1752, 92);
+INSERT INTO orders VALUES (585, 1755, 5);
+INSERT INTO orders VALUES (586, 1758, 18);
+INSERT INTO orders VALUES (587, 1761, 31);
+INSERT INTO orders VALUES (588, 1764, 44);
+INSERT INTO orders VALUES (589, 1767, 57);
+INSERT INTO orders VALUES (590, 1770, 70);
+INSERT INTO orders VALUES (591, 1773, 83);
+INSERT INTO orders VALUES (592, 1776, 96);
+INSERT INTO orders VALUES (593, 1779, 9);
+INSERT INTO orders VALUES (594, 1782, 22);
+INSERT INTO orders VALUES (595, 1785, 35);
+INSERT INTO orders VALUES (596, 1788, 48);
+INSERT INTO orders VALUES (597, 1791, 61);
+INSERT INTO orders VALUES (598, 1794, 74);
+INSERT INTO orders VALUES (599, 1797, 87);
+INSERT INTO orders VALUES (600, 1800, 0);
+INSERT INTO orders VALUES (601, 1803, 13);
+INSERT INTO orders VALUES (602, 1806, 26);
+INSERT INTO orders VALUES (603, 1809, 39);
+INSERT INTO orders VALUES (604, 1812, 52);
+INSERT INTO orders VALUES (605, 1815, 65);
+INSERT INTO orders VALUES (606, 1818, 78);
+INSERT INTO orders VALUES (607, 1821, 91);
+INSERT INTO orders VALUES (608, 1824, 4);
+INSERT INTO orders VALUES (609, 1827, 17);
+INSERT INTO orders VALUES (610, 1830, 30);
+INSERT INTO orders VALUES (611, 1833, 43);
+INSERT INTO orders VALUES (612, 1836, 56);
+INSERT INTO orders VALUES (613, 1839, 69);
+INSERT INTO orders VALUES (614, 1842, 82);
+INSERT INTO orders VALUES (615, 1845, 95);
+INSERT INTO orders VALUES (616, 1848, 8);
+INSERT INTO orders VALUES (617, 1851, 21);
+INSERT INTO orders VALUES (618, 1854, 34);
+INSERT INTO orders VALUES (619, 1857, 47);
+INSERT INTO orders VALUES (620, 1860, 60);
+INSERT INTO orders VALUES (621, 1863, 73);
+INSERT INTO orders VALUES (622, 1866, 86);
+INSERT INTO orders VALUES (623, 1869, 99);
+INSERT INTO orders VALUES (624, 1872, 12);
+INSERT INTO orders VALUES (625, 1875, 25);
+INSERT INTO orders VALUES (626, 1878, 38);
+INSERT INTO orders VALUES (627, 1881, 51);
+INSERT INTO orders VALUES (628, 1884, 64);
+INSERT INTO orders VALUES (629, 1887, 77);
+INSERT INTO orders VALUES (630, 1890, 90);
+INSERT INTO orders VALUES (631, 1893, 3);
+INSERT INTO orders VALUES (632, 1896, 16);
+INSERT INTO orders VALUES (633, 1899, 29);
+INSERT INTO orders VALUES (634, 1902, 42);
+INSERT INTO orders VALUES (635, 1905, 55);
+INSERT INTO orders VALUES (636, 1908, 68);
+INSERT INTO orders VALUES (637, 1911, 81);
+INSERT INTO orders VALUES (638, 1914, 94);
+INSERT INTO orders VALUES (639, 1917, 7);
+INSERT INTO orders VALUES (640, 1920, 20);
+INSERT INTO orders VALUES (641, 1923, 33);
+INSERT INTO orders VALUES (642, 1926, 46);
+INSERT INTO orders VALUES (643, 1929, 59);
+INSERT INTO orders VALUES (644, 1932, 72);
+INSERT INTO orders VALUES (645, 1935, 85);
+INSERT INTO orders VALUES (646, 1938, 98);
+INSERT INTO orders VALUES (647, 1941, 11);
+INSERT INTO orders VALUES (648, 1944, 24);
+INSERT INTO orders VALUES (649, 1947, 37);
+INSERT INTO orders VALUES (650, 1950, 50);
+INSERT INTO orders VALUES (651, 1953, 63);
+INSERT INTO orders VALUES (652, 1956, 76);
+INSERT INTO orders VALUES (653, 1959, 89);
+INSERT INTO orders VALUES (654, 1962, 2);
+INSERT INTO orders VALUES (655, 1965, 15);
+INSERT INTO orders VALUES (656, 1968, 28);
+INSERT INTO orders VALUES (657, 1971, 41);
+INSERT INTO orders VALUES (658, 1974, 54);
+INSERT INTO orders VALUES (659, 1977, 67);
+INSERT INTO orders VALUES (660, 1980, 80);
+INSERT INTO orders VALUES (661, 1983, 93);
+INSERT INTO orders VALUES (662, 1986, 6);
+INSERT INTO orders VALUES (663, 1989, 19);
+INSERT INTO orders VALUES (664, 1992, 32);
+INSERT INTO orders VALUES (665, 1995, 45);
+INSERT INTO orders VALUES (666, 1998, 58);
+INSERT INTO orders VALUES (667, 2001, 71);
+INSERT INTO orders VALUES (668, 2004, 84);
+INSERT INTO orders VALUES (669, 2007, 97);
+INSERT INTO orders VALUES (670, 2010, 10);
+INSERT INTO orders VALUES (671, 2013, 23);
+INSERT INTO orders VALUES (672, 2016, 36);
+INSERT INTO orders VALUES (673, 2019, 49);
+INSERT INTO orders VALUES (674, 2022, 62);
+INSERT INTO orders VALUES (675, 2025, 75);
+INSERT INTO orders VALUES (676, 2028, 88);
+INSERT INTO orders VALUES (677, 2031, 1);
+INSERT INTO orders VALUES (678, 2034, 14);
+INSERT INTO orders VALUES (679, 2037, 27);
+INSERT INTO orders VALUES (680, 2040, 40);
+INSERT INTO orders VALUES (681, 2043, 53);
+INSERT INTO orders VALUES (682, 2046, 66);
+INSERT INTO orders VALUES (683, 2049, 79);
+INSERT INTO orders VALUES (684, 2052, 92);
+INSERT INTO orders VALUES (685, 2055, 5);
+INSERT INTO orders VALUES (686, 2058, 18);
+INSERT INTO orders VALUES (687, 2061, 31);
+INSERT INTO orders VALUES (688, 2064, 44);
+INSERT INTO orders VALUES (689, 2067, 57);
+INSERT INTO orders VALUES (690, 2070, 70);
+INSERT INTO orders VALUES (691, 2073, 83);
+INSERT INTO orders VALUES (692, 2076, 96);
+INSERT INTO orders VALUES (693, 2079, 9);
+INSERT INTO orders VALUES (694, 2082, 22);
+INSERT INTO orders VALUES (695, 2085, 35);
+INSERT INTO orders VALUES (696, 2088, 48);
+INSERT INTO orders VALUES (697, 2091, 61);
+INSERT INTO orders VALUES (698, 2094, 74);
+INSERT INTO orders VALUES (699, 2097, 87);
+INSERT INTO orders VALUES (700, 2100, 0);
+INSERT INTO orders VALUES (701, 2103, 13);
+INSERT INTO orders VALUES (702, 2106, 26);
+INSERT INTO orders VALUES (703, 2109, 39);
+INSERT INTO orders VALUES (704, 2112, 52);
+INSERT INTO orders VALUES (705, 2115, 65);
+INSERT INTO orders VALUES (706, 2118, 78);
+INSERT INTO orders VALUES (707, 2121, 91);
+INSERT INTO orders VALUES (708, 2124, 4);
+INSERT INTO orders VALUES (709, 2127, 17);
+INSERT INTO orders VALUES (710, 2130, 30);
+INSERT INTO orders VALUES (711, 2133, 43);
+INSERT INTO orders VALUES (712, 2136, 56);
+INSERT INTO orders VALUES (713, 2139, 69);
+INSERT INTO orders VALUES (714, 2142, 82);
+INSERT INTO orders VALUES (715, 2145, 95);
+INSERT INTO orders VALUES (716, 2148, 8);
+INSERT INTO orders VALUES (717, 2151, 21);
+INSERT INTO orders VALUES (718, 2154, 34);
+INSERT INTO orders VALUES (719, 2157, 47);
+INSERT INTO orders VALUES (720, 2160, 60);
+INSERT INTO orders VALUES (721, 2163, 73);
+INSERT INTO orders VALUES (722, 2166, 86);
+INSERT INTO orders VALUES (723, 2169, 99);
+INSERT INTO orders VALUES (724, 2172, 12);
+INSERT INTO orders VALUES (725, 2175, 25);
+INSERT INTO orders VALUES (726, 2178, 38);
+INSERT INTO orders VALUES (727, 2181, 51);
+INSERT INTO orders VALUES (728, 2184, 64);
+INSERT INTO orders VALUES (729, 2187, 77);
+INSERT INTO orders VALUES (730, 2190, 90);
+INSERT INTO orders VALUES (731, 2193, 3);
+INSERT INTO orders VALUES (732, 2196, 16);
+INSERT INTO orders VALUES (733, 2199, 29);
+INSERT INTO orders VALUES (734, 2202, 42);
+INSERT INTO orders VALUES (735, 2205, 55);
+INSERT INTO orders VALUES (736, 2208, 68);
+INSERT INTO orders VALUES (737, 2211, 81);
+INSERT INTO orders VALUES (738, 2214, 94);
+INSERT INTO orders VALUES (739, 2217, 7);
+INSERT INTO orders VALUES (740, 2220, 20);
+INSERT INTO orders VALUES (741, 2223, 33);
+INSERT INTO orders VALUES (742, 2226, 46);
+INSERT INTO orders VALUES (743, 2229, 59);
+INSERT INTO orders VALUES (744, 2232, 72);
+INSERT INTO orders VALUES (745, 2235, 85);
+INSERT INTO orders VALUES (746, 2238, 98);
+INSERT INTO orders VALUES (747, 2241, 11);
+INSERT INTO orders VALUES (748, 2244, 24);
+INSERT INTO orders VALUES (749, 2247, 37);
+INSERT INTO orders VALUES (750, 2250, 50);
+INSERT INTO orders VALUES (751, 2253, 63);
+INSERT INTO orders VALUES (752, 2256, 76);
+INSERT INTO orders VALUES (753, 2259, 89);
+INSERT INTO orders VALUES (754, 2262, 2);
+INSERT INTO orders VALUES (755, 2265, 15);
+INSERT INTO orders VALUES (756, 2268, 28);
+INSERT INTO orders VALUES (757, 2271, 41);
+INSERT INTO orders VALUES (758, 2274, 54);
+INSERT INTO orders VALUES (759, 2277, 67);
+INSERT INTO orders VALUES (760, 2280, 80);
+INSERT INTO orders VALUES (761, 2283, 93);
+INSERT INTO orders VALUES (762, 2286, 6);
+INSERT INTO orders VALUES (763, 2289, 19);
+INSERT INTO orders VALUES (764, 2292, 32);
+INSERT INTO orders VALUES (765, 2295, 45);
+INSERT INTO orders VALUES (766, 2298, 58);
+INSERT INTO orders VALUES (767, 2301, 71);
+INSERT INTO orders VALUES (768, 2304, 84);
+INSERT INTO orders VALUES (769, 2307, 97);
+INSERT INTO orders VALUES (770, 2310, 10);
+INSERT INTO orders VALUES (771, 2313, 23);
+INSERT INTO orders VALUES (772, 2316, 36);
+INSERT INTO orders VALUES (773, 2319, 49);
+INSERT INTO orders VALUES (774, 2322, 62);
+INSERT INTO orders VALUES (775, 2325, 75);
+INSERT INTO orders VALUES (776, 2328, 88);
+INSERT INTO orders VALUES (777, 2331, 1);
+INSERT INTO orders VALUES (778, 2334, 14);
+INSERT INTO orders VALUES (779, 2337, 27);
+INSERT INTO orders VALUES (780, 2340, 40);
+INSERT INTO orders VALUES (781, 2343, 53);
+INSERT INTO orders VALUES (782, 2346, 66);
+INSERT INTO orders VALUES (783, 2349, 79);
+INSERT INTO orders VALUES (784, 2352, 92);
+INSERT INTO orders VALUES (785, 2355, 5);
+INSERT INTO orders VALUES (786, 2358, 18);
+INSERT INTO orders VALUES (787, 2361, 31);
+INSERT INTO orders VALUES (788, 2364, 44);
+INSERT INTO orders VALUES (789, 2367, 57);
+INSERT INTO orders VALUES (790, 2370, 70);
+INSERT INTO orders VALUES (791, 2373, 83);
+INSERT INTO orders VALUES (792, 2376, 96);
+INSERT INTO orders VALUES (793, 2379, 9);
+INSERT INTO orders VALUES (794, 2382, 22);
+INSERT INTO orders VALUES (795, 2385, 35);
+INSERT INTO orders VALUES (796, 2388, 48);
+INSERT INTO orders VALUES (797, 2391, 61);
+INSERT INTO orders VALUES (798, 2394, 74);
+INSERT INTO orders VALUES (799, 2397, 87);
+INSERT INTO orders VALUES (800, 2400, 0);
+INSERT INTO orders VALUES (801, 2403, 13);
+INSERT INTO orders VALUES (802, 2406, 26);
+INSERT INTO orders VALUES (803, 2409, 39);
+INSERT INTO orders VALUES (804, 2412, 52);
+INSERT INTO orders VALUES (805, 2415, 65);
+INSERT INTO orders VALUES (806, 2418, 78);
+INSERT INTO orders VALUES (807, 2421, 91);
+INSERT INTO orders VALUES (808, 2424, 4);
+INSERT INTO orders VALUES (809, 2427, 17);
+INSERT INTO orders VALUES (810, 2430, 30);
+INSERT INTO orders VALUES (811, 2433, 43);
+INSERT INTO orders VALUES (812, 2436, 56);
+INSERT INTO orders VALUES (813, 2439, 69);
+INSERT INTO orders VALUES (814, 2442, 82);
+INSERT INTO orders VALUES (815, 2445, 95);
+INSERT INTO orders VALUES (816, 2448, 8);
+INSERT INTO orders VALUES (817, 2451, 21);
+INSERT INTO orders VALUES (818, 2454, 34);
+INSERT INTO orders VALUES (819, 2457, 47);
+INSERT INTO orders VALUES (820, 2460, 60);
+INSERT INTO orders VALUES (821, 2463, 73);
+INSERT INTO orders VALUES (822, 2466, 86);
+INSERT INTO orders VALUES (823, 2469, 99);
+INSERT INTO orders VALUES (824, 2472, 12);
+INSERT INTO orders VALUES (825, 2475, 25);
+INSERT INTO orders VALUES (826, 2478, 38);
+INSERT INTO orders VALUES (827, 2481, 51);
+INSERT INTO orders VALUES (828, 2484, 64);
+INSERT INTO orders VALUES (829, 2487, 77);
+INSERT INTO orders VALUES (830, 2490, 90);
+INSERT INTO orders VALUES (831, 2493, 3);
+INSERT INTO orders VALUES (832, 2496, 16);
+INSERT INTO orders VALUES (833, 2499, 29);
+INSERT INTO orders VALUES (834, 2502, 42);
+INSERT INTO orders VALUES (835, 2505, 55);
+INSERT INTO orders VALUES (836, 2508, 68);
+INSERT INTO orders VALUES (837, 2511, 81);
+INSERT INTO orders VALUES (838, 2514, 94);
+INSERT INTO orders VALUES (839, 2517, 7);
+INSERT INTO orders VALUES (840, 2520, 20);
+INSERT INTO orders VALUES (841, 2523, 33);
+INSERT INTO orders VALUES (842, 2526, 46);
+INSERT INTO orders VALUES (843, 2529, 59);
+INSERT INTO orders VALUES (844, 2532, 72);
+INSERT INTO orders VALUES (845, 2535, 85);
+INSERT INTO orders VALUES (846, 2538, 98);
+INSERT INTO orders VALUES (847, 2541, 11);
+INSERT INTO orders VALUES (848, 2544, 24);
+INSERT INTO orders VALUES (849, 2547, 37);
+INSERT INTO orders VALUES (850, 2550, 50);
+INSERT INTO orders VALUES (851, 2553, 63);
+INSERT INTO orders VALUES (852, 2556, 76);
+INSERT INTO orders VALUES (853, 2559, 89);
+INSERT INTO orders VALUES (854, 2562, 2);
+INSERT INTO orders VALUES (855, 2565, 15);
+INSERT INTO orders VALUES (856, 2568, 28);
+INSERT INTO orders VALUES (857, 2571, 41);
+INSERT INTO orders VALUES (858, 2574, 54);
+INSERT INTO orders VALUES (859, 2577, 67);
+INSERT INTO orders VALUES (860, 2580, 80);
+INSERT INTO orders VALUES (861, 2583, 93);
+INSERT INTO orders VALUES (862, 2586, 6);
+INSERT INTO orders VALUES (863, 2589, 19);
+INSERT INTO orders VALUES (864, 2592, 32);
+INSERT INTO orders VALUES (865, 2595, 45);
+INSERT INTO orders VALUES (866, 2598, 58);
+INSERT INTO orders VALUES (867, 2601, 71);
+INSERT INTO orders VALUES (868, 2604, 84);
+INSERT INTO orders VALUES (869, 2607, 97);
+INSERT INTO orders VALUES (870, 2610, 10);
+INSERT INTO orders VALUES (871, 2613, 23);
+INSERT INTO orders VALUES (872, 2616, 36);
+INSERT INTO orders VALUES (873, 2619, 49);
+INSERT INTO orders VALUES (874, 2622, 62);
+INSERT INTO orders VALUES (875, 2625, 75);
+INSERT INTO orders VALUES (876, 2628, 88);
+INSERT INTO orders VALUES (877, 2631, 1);
+INSERT INTO orders VALUES (878, 2634, 14);
+INSERT INTO orders VALUES (879, 2637, 27);
+INSERT INTO orders VALUES (880, 2640, 40);
+INSERT INTO orders VALUES (881, 2643, 53);
+INSERT INTO orders VALUES (882, 2646, 66);
+INSERT INTO orders VALUES (883, 2649, 79);
+INSERT INTO orders VALUES (884, 2652, 92);
+INSERT INTO orders VALUES (885, 2655, 5);
+INSERT INTO orders VALUES (886, 2658, 18);
+INSERT INTO orders VALUES (887, 2661, 31);
+INSERT INTO orders VALUES (888, 2664, 44);
+INSERT INTO orders VALUES (889, 2667, 57);
+INSERT INTO orders VALUES (890, 2670, 70);
+INSERT INTO orders VALUES (891, 2673, 83);
+INSERT INTO orders VALUES (892, 2676, 96);
+INSERT INTO orders VALUES (893, 2679, 9);
+INSERT INTO orders VALUES (894, 2682, 22);
+INSERT INTO orders VALUES (895, 2685, 35);
+INSERT INTO orders VALUES (896, 2688, 48);
+INSERT INTO orders VALUES (897, 2691, 61);
+INSERT INTO orders VALUES (898, 2694, 74);
+INSERT INTO orders VALUES (899, 2697, 87);
+INSERT INTO orders VALUES (900, 2700, 0);
+INSERT INTO orders VALUES (901, 2703, 13);
+INSERT INTO orders VALUES (902, 2706, 26);
+INSERT INTO orders VALUES (903, 2709, 39);
+INSERT INTO orders VALUES (904, 2712, 52);
+INSERT INTO orders VALUES (905, 2715, 65);
+INSERT INTO orders VALUES (906, 2718, 78);
+INSERT INTO orders VALUES (907, 2721, 91);
+INSERT INTO orders VALUES (908, 2724, 4);
+INSERT INTO orders VALUES (909, 2727, 17);
+INSERT INTO orders VALUES (910, 2730, 30);
+INSERT INTO orders VALUES (911, 2733, 43);
+INSERT INTO orders VALUES (912, 2736, 56);
+INSERT INTO orders VALUES (913, 2739, 69);
+INSERT INTO orders VALUES (914, 2742, 82);
+INSERT INTO orders VALUES (915, 2745, 95);
+INSERT INTO orders VALUES (916, 2748, 8);
+INSERT INTO orders VALUES (917, 2751, 21);
+INSERT INTO orders VALUES (918, 2754, 34);
+INSERT INTO orders VALUES (919, 2757, 47);
+INSERT INTO orders VALUES (920, 2760, 60);
+INSERT INTO orders VALUES (921, 2763, 73);
+INSERT INTO orders VALUES (922, 2766, 86);
+INSERT INTO orders VALUES (923, 2769, 99);
+INSERT INTO orders VALUES (924, 2772, 12);
+INSERT INTO orders VALUES (925, 2775, 25);
+INSERT INTO orders VALUES (926, 2778, 38);
+INSERT INTO orders VALUES (927, 2781, 51);
+INSERT INTO orders VALUES (928, 2784, 64);
+INSERT INTO orders VALUES (929, 2787, 77);
+INSERT INTO orders VALUES (930, 2790, 90);
+INSERT INTO orders VALUES (931, 2793, 3);
+INSERT INTO orders VALUES (932, 2796, 16);
+INSERT INTO orders VALUES (933, 2799, 29);
+INSERT INTO orders VALUES (934, 2802, 42);
+INSERT INTO orders VALUES (935, 2805, 55);
+INSERT INTO orders VALUES (936, 2808, 68);
+INSERT INTO orders VALUES (937, 2811, 81);
+INSERT INTO orders VALUES (938, 2814, 94);
+INSERT INTO orders VALUES (939, 2817, 7);
+INSERT INTO orders VALUES (940, 2820, 20);
+INSERT INTO orders VALUES (941, 2823, 33);
+INSERT INTO orders VALUES (942, 2826, 46);
+INSERT INTO orders VALUES (943, 2829, 59);
+INSERT INTO orders VALUES (944, 2832, 72);
+INSERT INTO orders VALUES (945, 2835, 85);
+INSERT INTO orders VALUES (946, 2838, 98);
+INSERT INTO orders VALUES (947, 2841, 11);
+INSERT INTO orders VALUES (948, 2844, 24);
+INSERT INTO orders VALUES (949, 2847, 37);
+INSERT INTO orders VALUES (950, 2850, 50);
+INSERT INTO orders VALUES (951, 2853, 63);
+INSERT INTO orders VALUES (952, 2856, 76);
+INSERT INTO orders VALUES (953, 2859, 89);
+INSERT INTO orders VALUES (954, 2862, 2);
+INSERT INTO orders VALUES (955, 2865, 15);
+INSERT INTO orders VALUES (956, 2868, 28);
+INSERT INTO orders VALUES (957, 2871, 41);
+INSERT INTO orders VALUES (958, 2874, 54);
+INSERT INTO orders VALUES (959, 2877, 67);
+INSERT INTO orders VALUES (960, 2880, 80);
+INSERT INTO orders VALUES (961, 2883, 93);
+INSERT INTO orders VALUES (962, 2886, 6);
+INSERT INTO orders VALUES (963, 2889, 19);
+INSERT INTO orders VALUES (964, 2892, 32);
+INSERT INTO orders VALUES (965, 2895, 45);
+INSERT INTO orders VALUES (966, 2898, 58);
+INSERT INTO orders VALUES (967, 2901, 71);
+INSERT INTO orders VALUES (968, 2904, 84);
+INSERT INTO orders VALUES (969, 2907, 97);
+INSERT INTO orders VALUES (970, 2910, 10);
+INSERT INTO orders VALUES (971, 2913, 23);
+INSERT INTO orders VALUES (972, 2916, 36);
+INSERT INTO orders VALUES (973, 2919, 49);
+INSERT INTO orders VALUES (974, 2922, 62);
+INSERT INTO orders VALUES (975, 2925, 75);
+INSERT INTO orders VALUES (976, 2928, 88);
+INSERT INTO orders VALUES (977, 2931, 1);
+INSERT INTO orders VALUES (978, 2934, 14);
+INSERT INTO orders VALUES (979, 2937, 27);
+INSERT INTO orders VALUES (980, 2940, 40);
+INSERT INTO orders VALUES (981, 2943, 53);
+INSERT INTO orders VALUES (982, 2946, 66);
+INSERT INTO orders VALUES (983, 2949, 79);
+INSERT INTO orders VALUES (984, 2952, 92);
+INSERT INTO orders VALUES (985, 2955, 5);
+INSERT INTO orders VALUES (986, 2958, 18);
+INSERT INTO orders VALUES (987, 2961, 31);
+INSERT INTO orders VALUES (988, 2964, 44);
+INSERT INTO orders VALUES (989, 2967, 57);
+INSERT INTO orders VALUES (990, 2970, 70);
+INSERT INTO orders VALUES (991, 2973, 83);
+INSERT INTO orders VALUES (992, 2976, 96);
+INSERT INTO orders VALUES (993, 2979, 9);
+INSERT INTO orders VALUES (994, 2982, 22);
+INSERT INTO orders VALUES (995, 2985, 35);
+INSERT INTO orders VALUES (996, 2988, 48);
+INSERT INTO orders VALUES (997, 2991, 61);
+INSERT INTO orders VALUES (998, 2994, 74);
+INSERT INTO orders VALUES (999, 2997, 87);
+INSERT INTO orders VALUES (1000, 3000, 0);
+INSERT INTO orders VALUES (1001, 3003, 13);
+INSERT INTO orders VALUES (1002, 3006, 26);
+INSERT INTO orders VALUES (1003, 3009, 39);
+INSERT INTO orders VALUES (1004, 3012, 52);
+INSERT INTO orders VALUES (1005, 3015, 65);
+INSERT INTO orders VALUES (1006, 3018, 78);
+INSERT INTO orders VALUES (1007, 3021, 91);
+INSERT INTO orders VALUES (1008, 3024, 4);
+INSERT INTO orders VALUES (1009, 3027, 17);
+INSERT INTO orders VALUES (1010, 3030, 30);
+INSERT INTO orders VALUES (1011, 3033, 43);
+INSERT INTO orders VALUES (1012, 3036, 56);
+INSERT INTO orders VALUES (1013, 3039, 69);
+INSERT INTO orders VALUES (1014, 3042, 82);
+INSERT INTO orders VALUES (1015, 3045, 95);
+INSERT INTO orders VALUES (1016, 3048, 8);
+INSERT INTO orders VALUES (1017, 3051, 21);
+INSERT INTO orders VALUES (1018, 3054, 34);
+INSERT INTO orders VALUES (1019, 3057, 47);
+INSERT INTO orders VALUES (1020, 3060, 60);
+INSERT INTO orders VALUES (1021, 3063, 73);
+INSERT INTO orders VALUES (1022, 3066, 86);
+INSERT INTO orders VALUES (1023, 3069, 99);
+INSERT INTO orders VALUES (1024, 3072, 12);
+INSERT INTO orders VALUES (1025, 3075, 25);
+INSERT INTO orders VALUES (1026, 3078, 38);
+INSERT INTO orders VALUES (1027, 3081, 51);
+INSERT INTO orders VALUES (1028, 3084, 64);
+INSERT INTO orders VALUES (1029, 3087, 77);
+INSERT INTO orders VALUES (1030, 3090, 90);
+INSERT INTO orders VALUES (1031, 3093, 3);
+INSERT INTO orders VALUES (1032, 3096, 16);
+INSERT INTO orders VALUES (1033, 3099, 29);
+INSERT INTO orders VALUES (1034, 3102, 42);
+INSERT INTO orders VALUES (1035, 3105, 55);
+INSERT INTO orders VALUES (1036, 3108, 68);
+INSERT INTO orders VALUES (1037, 3111, 81);
+INSERT INTO orders VALUES (1038, 3114, 94);
+INSERT INTO orders VALUES (1039, 3117, 7);
+INSERT INTO orders VALUES (1040, 3120, 20);
+INSERT INTO orders VALUES (1041, 3123, 33);
+INSERT INTO orders VALUES (1042, 3126, 46);
+INSERT INTO orders VALUES (1043, 3129, 59);
+INSERT INTO orders VALUES (1044, 3132, 72);
+INSERT INTO orders VALUES (1045, 3135, 85);
+INSERT INTO orders VALUES (1046, 3138, 98);
+INSERT INTO orders VALUES (1047, 3141, 11);
+INSERT INTO orders VALUES (1048, 3144, 24);
+INSERT INTO orders VALUES (1049, 3147, 37);
+INSERT INTO orders VALUES (1050, 3150, 50);
+INSERT INTO orders VALUES (1051, 3153, 63);
+INSERT INTO orders VALUES (1052, 3156, 76);
+INSERT INTO orders VALUES (1053, 3159, 89);
+INSERT INTO orders VALUES (1054, 3162, 2);
+INSERT INTO orders VALUES (1055, 3165, 15);
+INSERT INTO orders VALUES (1056, 3168, 28);
+INSERT INTO orders VALUES (1057, 3171, 41);
+INSERT INTO orders VALUES (1058, 3174, 54);
+INSERT INTO orders VALUES (1059, 3177, 67);
+INSERT INTO orders VALUES (1060, 3180, 80);
+INSERT INTO orders VALUES (1061, 3183, 93);
+INSERT INTO orders VALUES (1062, 3186, 6);
+INSERT INTO orders VALUES (1063, 3189, 19);
+INSERT INTO orders VALUES (1064, 3192, 32);
+INSERT INTO orders VALUES (1065, 3195, 45);
+INSERT INTO orders VALUES (1066, 3198, 58);
+INSERT INTO orders VALUES (1067, 3201, 71);
+INSERT INTO orders VALUES (1068, 3204, 84);
+INSERT INTO orders VALUES (1069, 3207, 97);
+INSERT INTO orders VALUES (1070, 3210, 10);
+INSERT INTO orders VALUES (1071, 3213, 23);
+INSERT INTO orders VALUES (1072, 3216, 36);
+INSERT INTO orders VALUES (1073, 3219, 49);
+INSERT INTO orders VALUES (1074, 3222, 62);
+INSERT INTO orders VALUES (1075, 3225, 75);
+INSERT INTO orders VALUES (1076, 3228, 88);
+INSERT INTO orders VALUES (1077, 3231, 1);
+INSERT INTO orders VALUES (1078, 3234, 14);
+INSERT INTO orders VALUES (1079, 3237, 27);
+INSERT INTO orders VALUES (1080, 3240, 40);
+INSERT INTO orders VALUES (1081, 3243, 53);
+INSERT INTO orders VALUES (1082, 3246, 66);
+INSERT INTO orders VALUES (1083, 3249, 79);
+INSERT INTO orders VALUES (1084, 3252, 92);
+INSERT INTO orders VALUES (1085, 3255, 5);
+INSERT INTO orders VALUES (1086, 3258, 18);
+INSERT INTO orders VALUES (1087, 3261, 31);
+INSERT INTO orders VALUES (1088, 3264, 44);
+INSERT INTO orders VALUES (1089, 3267, 57);
+INSERT INTO orders VALUES (1090, 3270, 70);
+INSERT INTO orders VALUES (1091, 3273, 83);
+INSERT INTO orders VALUES (1092, 3276, 96);
+INSERT INTO orders VALUES (1093, 3279, 9);
+INSERT INTO orders VALUES (1094, 3282, 22);
+INSERT INTO orders VALUES (1095, 3285, 35);
+INSERT INTO orders VALUES (1096, 3288, 48);
+INSERT INTO orders VALUES (1097, 3291, 61);
+INSERT INTO orders VALUES (1098, 3294, 74);
+INSERT INTO orders VALUES (1099, 3297, 87);
+INSERT INTO orders VALUES (1100, 3300, 0);
+INSERT INTO orders VALUES (1101, 3303, 13);
+INSERT INTO orders VALUES (1102, 3306, 26);
+INSERT INTO orders VALUES (1103, 3309, 39);
+INSERT INTO orders VALUES (1104, 3312, 52);
+INSERT INTO orders VALUES (1105, 3315, 65);
+INSERT INTO orders VALUES (1106, 3318, 78);
+INSERT INTO orders VALUES (1107, 3321, 91);
+INSERT INTO orders VALUES (1108, 3324, 4);
+INSERT INTO orders VALUES (1109, 3327, 17);
+INSERT INTO orders VALUES (1110, 3330, 30);
+INSERT INTO orders VALUES (1111, 3333, 43);
+INSERT INTO orders VALUES (1112, 3336, 56);
+INSERT INTO orders VALUES (1113, 3339, 69);
+INSERT INTO orders VALUES (1114, 3342, 82);
+INSERT INTO orders VALUES (1115, 3345, 95);
+INSERT INTO orders VALUES (1116, 3348, 8);
+INSERT INTO orders VALUES (1117, 3351, 21);
+INSERT INTO orders VALUES (1118, 3354, 34);
+INSERT INTO orders VALUES (1119, 3357, 47);
+INSERT INTO orders VALUES (1120, 3360, 60);
+INSERT INTO orders VALUES (1121, 3363, 73);
+INSERT INTO orders VALUES (1122, 3366, 86);
+INSERT INTO orders VALUES (1123, 3369, 99);
+INSERT INTO orders VALUES (1124, 3372, 12);
+INSERT INTO orders VALUES (1125, 3375, 25);
+INSERT INTO orders VALUES (1126, 3378, 38);
+INSERT INTO orders VALUES (1127, 3381, 51);
+INSERT INTO orders VALUES (1128, 3384, 64);
+INSERT INTO orders VALUES (1129, 3387, 77);
+INSERT INTO orders VALUES (1130, 3390, 90);
+INSERT INTO orders VALUES (1131, 3393, 3);
+INSERT INTO orders VALUES (1132, 3396, 16);
+INSERT INTO orders VALUES (1133, 3399, 29);
+INSERT INTO orders VALUES (1134, 3402, 42);
+INSERT INTO orders VALUES (1135, 3405, 55);
+INSERT INTO orders VALUES (1136, 3408, 68);
+INSERT INTO orders VALUES (1137, 3411, 81);
+INSERT INTO orders VALUES (1138, 3414, 94);
+INSERT INTO orders VALUES (1139, 3417, 7);
+INSERT INTO orders VALUES (1140, 3420, 20);
+INSERT INTO orders VALUES (1141, 3423, 33);
+INSERT INTO orders VALUES (1142, 3426, 46);
+INSERT INTO orders VALUES (1143, 3429, 59);
+INSERT INTO orders VALUES (1144, 3432, 72);
+INSERT INTO orders VALUES (1145, 3435, 85);
+INSERT INTO orders VALUES (1146, 3438, 98);
+INSERT INTO orders VALUES (1147, 3441, 11);
+INSERT INTO orders VALUES (1148, 3444, 24);
+INSERT INTO orders VALUES (1149, 3447, 37);
+INSERT INTO orders VALUES (1150, 3450, 50);
+INSERT INTO orders VALUES (1151, 3453, 63);
+INSERT INTO orders VALUES (1152, 3456, 76);
+INSERT INTO orders VALUES (1153, 3459, 89);
+INSERT INTO orders VALUES (1154, 3462, 2);
+INSERT INTO orders VALUES (1155, 3465, 15);
+INSERT INTO orders VALUES (1156, 3468, 28);
+INSERT INTO orders VALUES (1157, 3471, 41);
+INSERT INTO orders VALUES (1158, 3474, 54);
+INSERT INTO orders VALUES (1159, 3477, 67);
+INSERT INTO orders VALUES (1160, 3480, 80);
+INSERT INTO orders VALUES (1161, 3483, 93);
+INSERT INTO orders VALUES (1162, 3486, 6);
+INSERT INTO orders VALUES (1163, 3489, 19);
+INSERT INTO orders VALUES (1164, 3492, 32);
+INSERT INTO orders VALUES (1165, 3495, 45);
+INSERT INTO orders VALUES (1166, 3498, 58);
+INSERT INTO orders VALUES (1167, 3501, 71);
+INSERT INTO orders VALUES (1168, 3504, 84);
+INSERT INTO orders VALUES (1169, 3507, 97);
+INSERT INTO orders VALUES (1170, 3510, 10);
+INSERT INTO orders VALUES (1171, 3513, 23);
+INSERT INTO orders VALUES (1172, 3516, 36);
+INSERT INTO orders VALUES (1173, 3519, 49);
+INSERT INTO orders VALUES (1174, 3522, 62);
+INSERT INTO orders VALUES (1175, 3525, 75);
+INSERT INTO orders VALUES (1176, 3528, 88);
+INSERT INTO orders VALUES (1177, 3531, 1);
+INSERT INTO orders VALUES (1178, 3534, 14);
+INSERT INTO orders VALUES (1179, 3537, 27);
+INSERT INTO orders VALUES (1180, 3540, 40);
+INSERT INTO orders VALUES (1181, 3543, 53);
+INSERT INTO orders VALUES (1182, 3546, 66);
+INSERT INTO orders VALUES (1183, 3549, 79);
+INSERT INTO orders VALUES (1184, 3552, 92);
+INSERT INTO orders VALUES (1185, 3555, 5);
+INSERT INTO orders VALUES (1186, 3558, 18);
+INSERT INTO orders VALUES (1187, 3561, 31);
+INSERT INTO orders VALUES (1188, 3564, 44);
+INSERT INTO orders VALUES (1189, 3567, 57);
+INSERT INTO orders VALUES (1190, 3570, 70);
+INSERT INTO orders VALUES (1191, 3573, 83);
+INSERT INTO orders VALUES (1192, 3576, 96);
+INSERT INTO orders VALUES (1193, 3579, 9);
+INSERT INTO orders VALUES (1194, 3582, 22);
+INSERT INTO orders VALUES (1195, 3585, 35);
+INSERT INTO orders VALUES (1196, 3588, 48);
+INSERT INTO orders VALUES (1197, 3591, 61);
+INSERT INTO orders VALUES (1198, 3594, 74);
+INSERT INTO orders VALUES (1199, 3597, 87);
+INSERT INTO orders VALUES (1200, 3600, 0);
+INSERT INTO orders VALUES (1201, 3603, 13);
+INSERT INTO orders VALUES (1202, 3606, 26);
+INSERT INTO orders VALUES (1203, 3609, 39);
+INSERT INTO orders VALUES (1204, 3612, 52);
+INSERT INTO orders VALUES (1205, 3615, 65);
+INSERT INTO orders VALUES (1206, 3618, 78);
+INSERT INTO orders VALUES (1207, 3621, 91);
+INSERT INTO orders VALUES (1208, 3624, 4);
+INSERT INTO orders VALUES (1209, 3627, 17);
+INSERT INTO orders VALUES (1210, 3630, 30);
+INSERT INTO orders VALUES (1211, 3633, 43);
+INSERT INTO orders VALUES (1212, 3636, 56);
+INSERT INTO orders VALUES (1213, 3639, 69);
+INSERT INTO orders VALUES (1214, 3642, 82);
+INSERT INTO orders VALUES (1215, 3645, 95);
+INSERT INTO orders VALUES (1216, 3648, 8);
+INSERT INTO orders VALUES (1217, 3651, 21);
+INSERT INTO orders VALUES (1218, 3654, 34);
+INSERT INTO orders VALUES (1219, 3657, 47);
+INSERT INTO orders VALUES (1220, 3660, 60);
+INSERT INTO orders VALUES (1221, 3663, 73);
+INSERT INTO orders VALUES (1222, 3666, 86);
+INSERT INTO orders VALUES (1223, 3669, 99);
+INSERT INTO orders VALUES (1224, 3672, 12);
+INSERT INTO orders VALUES (1225, 3675, 25);
+INSERT INTO orders VALUES (1226, 3678, 38);
+INSERT INTO orders VALUES (1227, 3681, 51);
+INSERT INTO orders VALUES (1228, 3684, 64);
+INSERT INTO orders VALUES (1229, 3687, 77);
+INSERT INTO orders VALUES (1230, 3690, 90);
+INSERT INTO orders VALUES (1231, 3693, 3);
+INSERT INTO orders VALUES (1232, 3696, 16);
+INSERT INTO orders VALUES (1233, 3699, 29);
+INSERT INTO orders VALUES (1234, 3702, 42);
+INSERT INTO orders VALUES (1235, 3705, 55);
+INSERT INTO orders VALUES (1236, 3708, 68);
+INSERT INTO orders VALUES (1237, 3711, 81);
+INSERT INTO orders VALUES (1238, 3714, 94);
+INSERT INTO orders VALUES (1239, 3717, 7);
+INSERT INTO orders VALUES (1240, 3720, 20);
+INSERT INTO orders VALUES (1241, 3723, 33);
+INSERT INTO orders VALUES (1242, 3726, 46);
+INSERT INTO orders VALUES (1243, 3729, 59);
+INSERT INTO orders VALUES (1244, 3732, 72);
+INSERT INTO orders VALUES (1245, 3735, 85);
+INSERT INTO orders VALUES (1246, 3738, 98);
+INSERT INTO orders VALUES (1247, 3741, 11);
+INSERT INTO orders VALUES (1248, 3744, 24);
+INSERT INTO orders VALUES (1249, 3747, 37);
+INSERT INTO orders VALUES (1250, 3750, 50);
+INSERT INTO orders VALUES (1251, 3753, 63);
+INSERT INTO orders VALUES (1252, 3756, 76);
+INSERT INTO orders VALUES (1253, 3759, 89);
+INSERT INTO orders VALUES (1254, 3762, 2);
+INSERT INTO orders VALUES (1255, 3765, 15);
+INSERT INTO orders VALUES (1256, 3768, 28);
+INSERT INTO orders VALUES (1257, 3771, 41);
+INSERT INTO orders VALUES (1258, 3774, 54);
+INSERT INTO orders VALUES (1259, 3777, 67);
+INSERT INTO orders VALUES (1260, 3780, 80);
+INSERT INTO orders VALUES (1261, 3783, 93);
+INSERT INTO orders VALUES (1262, 3786, 6);
+INSERT INTO orders VALUES (1263, 3789, 19);
+INSERT INTO orders VALUES (1264, 3792, 32);
+INSERT INTO orders VALUES (1265, 3795, 45);
+INSERT INTO orders VALUES (1266, 3798, 58);
+INSERT INTO orders VALUES (1267, 3801, 71);
+INSERT INTO orders VALUES (1268, 3804, 84);
+INSERT INTO orders VALUES (1269, 3807, 97);
+INSERT INTO orders VALUES (1270, 3810, 10);
+INSERT INTO orders VALUES (1271, 3813, 23);
+INSERT INTO orders VALUES (1272, 3816, 36);
+INSERT INTO orders VALUES (1273, 3819, 49);
+INSERT INTO orders VALUES (1274, 3822, 62);
+INSERT INTO orders VALUES (1275, 3825, 75);
+INSERT INTO orders VALUES (1276, 3828, 88);
+INSERT INTO orders VALUES (1277, 3831, 1);
+INSERT INTO orders VALUES (1278, 3834, 14);
+INSERT INTO orders VALUES (1279, 3837, 27);
+INSERT INTO orders VALUES (1280, 3840, 40);
+INSERT INTO orders VALUES (1281, 3843, 53);
+INSERT INTO orders VALUES (1282, 3846, 66);
+INSERT INTO orders VALUES (1283, 3849, 79);
+INSERT INTO orders VALUES (1284, 3852, 92);
+INSERT INTO orders VALUES (1285, 3855, 5);
+INSERT INTO orders VALUES (1286, 3858, 18);
+INSERT INTO orders VALUES (1287, 3861, 31);
+INSERT INTO orders VALUES (1288, 3864, 44);
+INSERT INTO orders VALUES (1289, 3867, 57);
+INSERT INTO orders VALUES (1290, 3870, 70);
+INSERT INTO orders VALUES (1291, 3873, 83);
+INSERT INTO orders VALUES (1292, 3876, 96);
+INSERT INTO orders VALUES (1293, 3879, 9);
+INSERT INTO orders VALUES (1294, 3882, 22);
+INSERT INTO orders VALUES (1295, 3885, 35);
+INSERT INTO orders VALUES (1296, 3888, 48);
+INSERT INTO orders VALUES (1297, 3891, 61);
+INSERT INTO orders VALUES (1298, 3894, 74);
+INSERT INTO orders VALUES (1299, 3897, 87);
+INSERT INTO orders VALUES (1300, 3900, 0);
+INSERT INTO orders VALUES (1301, 3903, 13);
+INSERT INTO orders VALUES (1302, 3906, 26);
+INSERT INTO orders VALUES (1303, 3909, 39);
+INSERT INTO orders VALUES (1304, 3912, 52);
+INSERT INTO orders VALUES (1305, 3915, 65);
+INSERT INTO orders VALUES (1306, 3918, 78);
+INSERT INTO orders VALUES (1307, 3921, 91);
+INSERT INTO orders VALUES (1308, 3924, 4);
+INSERT INTO orders VALUES (1309, 3927, 17);
+INSERT INTO orders VALUES (1310, 3930, 30);
+INSERT INTO orders VALUES (1311, 3933, 43);
+INSERT INTO orders VALUES (1312, 3936, 56);
+INSERT INTO orders VALUES (1313, 3939, 69);
+INSERT INTO orders VALUES (1314, 3942, 82);
+INSERT INTO orders VALUES (1315, 3945, 95);
+INSERT INTO orders VALUES (1316, 3948, 8);
+INSERT INTO orders VALUES (1317, 3951, 21);
+INSERT INTO orders VALUES (1318, 3954, 34);
+INSERT INTO orders VALUES (1319, 3957, 47);
+INSERT INTO orders VALUES (1320, 3960, 60);
+INSERT INTO orders VALUES (1321, 3963, 73);
+INSERT INTO orders VALUES (1322, 3966, 86);
+INSERT INTO orders VALUES (1323, 3969, 99);
+INSERT INTO orders VALUES (1324, 3972, 12);
+INSERT INTO orders VALUES (1325, 3975, 25);
+INSERT INTO orders VALUES (1326, 3978, 38);
+INSERT INTO orders VALUES (1327, 3981, 51);
+INSERT INTO orders VALUES (1328, 3984, 64);
+INSERT INTO orders VALUES (1329, 3987, 77);
+INSERT INTO orders VALUES (1330, 3990, 90);
+INSERT INTO orders VALUES (1331, 3993, 3);
+INSERT INTO orders VALUES (1332, 3996, 16);
+INSERT INTO orders VALUES (1333, 3999, 29);
+INSERT INTO orders VALUES (1334, 4002, 42);
+INSERT INTO orders VALUES (1335, 4005, 55);
+INSERT INTO orders VALUES (1336, 4008, 68);
+INSERT INTO orders VALUES (1337, 4011, 81);
+INSERT INTO orders VALUES (1338, 4014, 94);
+INSERT INTO orders VALUES (1339, 4017, 7);
+INSERT INTO orders VALUES (1340, 4020, 20);
+INSERT INTO orders VALUES (1341, 4023, 33);
+INSERT INTO orders VALUES (1342, 4026, 46);
+INSERT INTO orders VALUES (1343, 4029, 59);
+INSERT INTO orders VALUES (1344, 4032, 72);
+INSERT INTO orders VALUES (1345, 4035, 85);
+INSERT INTO orders VALUES (1346, 4038, 98);
+INSERT INTO orders VALUES (1347, 4041, 11);
+INSERT INTO orders VALUES (1348, 4044, 24);
+INSERT INTO orders VALUES (1349, 4047, 37);
+INSERT INTO orders VALUES (1350, 4050, 50);
+INSERT INTO orders VALUES (1351, 4053, 63);
+INSERT INTO orders VALUES (1352, 4056, 76);
+INSERT INTO orders VALUES (1353, 4059, 89);
+INSERT INTO orders VALUES (1354, 4062, 2);
+INSERT INTO orders VALUES (1355, 4065, 15);
+INSERT INTO orders VALUES (1356, 4068, 28);
+INSERT INTO orders VALUES (1357, 4071, 41);
+INSERT INTO orders VALUES (1358, 4074, 54);
+INSERT INTO orders VALUES (1359, 4077, 67);
+INSERT INTO orders VALUES (1360, 4080, 80);
+INSERT INTO orders VALUES (1361, 4083, 93);
+INSERT INTO orders VALUES (1362, 4086, 6);
+INSERT INTO orders VALUES (1363, 4089, 19);
+INSERT INTO orders VALUES (1364, 4092, 32);
+INSERT INTO orders VALUES (1365, 4095, 45);
+INSERT INTO orders VALUES (1366, 4098, 58);
+INSERT INTO orders VALUES (1367, 4101, 71);
+INSERT INTO orders VALUES (1368, 4104, 84);
+INSERT INTO orders VALUES (1369, 4107, 97);
+INSERT INTO orders VALUES (1370, 4110, 10);
+INSERT INTO orders VALUES (1371, 4113, 23);
+INSERT INTO orders VALUES (1372, 4116, 36);
+INSERT INTO orders VALUES (1373, 4119, 49);
+INSERT INTO orders VALUES (1374, 4122, 62);
+INSERT INTO orders VALUES (1375, 4125, 75);
+INSERT INTO orders VALUES (1376, 4128, 88);
+INSERT INTO orders VALUES (1377, 4131, 1);
+INSERT INTO orders VALUES (1378, 4134, 14);
+INSERT INTO orders VALUES (1379, 4137, 27);
+INSERT INTO orders VALUES (1380, 4140, 40);
+INSERT INTO orders VALUES (1381, 4143, 53);
+INSERT INTO orders VALUES (1382, 4146, 66);
+INSERT INTO orders VALUES (1383, 4149, 79);
+INSERT INTO orders VALUES (1384, 4152, 92);
+INSERT INTO orders VALUES (1385, 4155, 5);
+INSERT INTO orders VALUES (1386, 4158, 18);
+INSERT INTO orders VALUES (1387, 4161, 31);
+INSERT INTO orders VALUES (1388, 4164, 44);
+INSERT INTO orders VALUES (1389, 4167, 57);
+INSERT INTO orders VALUES (1390, 4170, 70);
+INSERT INTO orders VALUES (1391, 4173, 83);
+INSERT INTO orders VALUES (1392, 4176, 96);
+INSERT INTO orders VALUES (1393, 4179, 9);
+INSERT INTO orders VALUES (1394, 4182, 22);
+INSERT INTO orders VALUES (1395, 4185, 35);
+INSERT INTO orders VALUES (1396, 4188, 48);
+INSERT INTO orders VALUES (1397, 4191, 61);
+INSERT INTO orders VALUES (1398, 4194, 74);
+INSERT INTO orders VALUES (1399, 4197, 87);
+INSERT INTO orders VALUES (1400, 4200, 0);
+INSERT INTO orders VALUES (1401, 4203, 13);
+INSERT INTO orders VALUES (1402, 4206, 26);
+INSERT INTO orders VALUES (1403, 4209, 39);
+INSERT INTO orders VALUES (1404, 4212, 52);
+INSERT INTO orders VALUES (1405, 4215, 65);
+INSERT INTO orders VALUES (1406, 4218, 78);
+INSERT INTO orders VALUES (1407, 4221, 91);
+INSERT INTO orders VALUES (1408, 4224, 4);
+INSERT INTO orders VALUES (1409, 4227, 17);
+INSERT INTO orders VALUES (1410, 4230, 30);
+INSERT INTO orders VALUES (1411, 4233, 43);
+INSERT INTO orders VALUES (1412, 4236, 56);
+INSERT INTO orders VALUES (1413, 4239, 69);
+INSERT INTO orders VALUES (1414, 4242, 82);
+INSERT INTO orders VALUES (1415, 4245, 95);
+INSERT INTO orders VALUES (1416, 4248, 8);
+INSERT INTO orders VALUES (1417, 4251, 21);
+INSERT INTO orders VALUES (1418, 4254, 34);
+INSERT INTO orders VALUES (1419, 4257, 47);
+INSERT INTO orders VALUES (1420, 4260, 60);
+INSERT INTO orders VALUES (1421, 4263, 73);
+INSERT INTO orders VALUES (1422, 4266, 86);
+INSERT INTO orders VALUES (1423, 4269, 99);
+INSERT INTO orders VALUES (1424, 4272, 12);
+INSERT INTO orders VALUES (1425, 4275, 25);
+INSERT INTO orders VALUES (1426, 4278, 38);
+INSERT INTO orders VALUES (1427, 4281, 51);
+INSERT INTO orders VALUES (1428, 4284, 64);
+INSERT INTO orders VALUES (1429, 4287, 77);
+INSERT INTO orders VALUES (1430, 4290, 90);
+INSERT INTO orders VALUES (1431, 4293, 3);
+INSERT INTO orders VALUES (1432, 4296, 16);
+INSERT INTO orders VALUES (1433, 4299, 29);
+INSERT INTO orders VALUES (1434, 4302, 42);
+INSERT INTO orders VALUES (1435, 4305, 55);
+INSERT INTO orders VALUES (1436, 4308, 68);
+INSERT INTO orders VALUES (1437, 4311, 81);
+INSERT INTO orders VALUES (1438, 4314, 94);
+INSERT INTO orders VALUES (1439, 4317, 7);
+INSERT INTO orders VALUES (1440, 4320, 20);
+INSERT INTO orders VALUES (1441, 4323, 33);
+INSERT INTO orders VALUES (1442, 4326, 46);
+INSERT INTO orders VALUES (1443, 4329, 59);
+INSERT INTO orders VALUES (1444, 4332, 72);
+INSERT INTO orders VALUES (1445, 4335, 85);
+INSERT INTO orders VALUES (1446, 4338, 98);
+INSERT INTO orders VALUES (1447, 4341, 11);
+INSERT INTO orders VALUES (1448, 4344, 24);
+INSERT INTO orders VALUES (1449, 4347, 37);
+INSERT INTO orders VALUES (1450, 4350, 50);
+INSERT INTO orders VALUES (1451, 4353, 63);
+INSERT INTO orders VALUES (1452, 4356, 76);
+INSERT INTO orders VALUES (1453, 4359, 89);
+INSERT INTO orders VALUES (1454, 4362, 2);
+INSERT INTO orders VALUES (1455, 4365, 15);
+INSERT INTO orders VALUES (1456, 4368, 28);
+INSERT INTO orders VALUES (1457, 4371, 41);
+INSERT INTO orders VALUES (1458, 4374, 54);
+INSERT INTO orders VALUES (1459, 4377, 67);
+INSERT INTO orders VALUES (1460, 4380, 80);
+INSERT INTO orders VALUES (1461, 4383, 93);
+INSERT INTO orders VALUES (1462, 4386, 6);
+INSERT INTO orders VALUES (1463, 4389, 19);
+INSERT INTO orders VALUES (1464, 4392, 32);
+INSERT INTO orders VALUES (1465, 4395, 45);
+INSERT INTO orders VALUES (1466, 4398, 58);
+INSERT INTO orders VALUES (1467, 4401, 71);
+INSERT INTO orders VALUES (1468, 4404, 84);
+INSERT INTO orders VALUES (1469, 4407, 97);
+INSERT INTO orders VALUES (1470, 4410, 10);
+INSERT INTO orders VALUES (1471, 4413, 23);
+INSERT INTO orders VALUES (1472, 4416, 36);
+INSERT INTO orders VALUES (1473, 4419, 49);
+INSERT INTO orders VALUES (1474, 4422, 62);
+INSERT INTO orders VALUES (1475, 4425, 75);
+INSERT INTO orders VALUES (1476, 4428, 88);
+INSERT INTO orders VALUES (1477, 4431, 1);
+INSERT INTO orders VALUES (1478, 4434, 14);
+INSERT INTO orders VALUES (1479, 4437, 27);
+INSERT INTO orders VALUES (1480, 4440, 40);
+INSERT INTO orders VALUES (1481, 4443, 53);
+INSERT INTO orders VALUES (1482, 4446, 66);
+INSERT INTO orders VALUES (1483, 4449, 79);
+INSERT INTO orders VALUES (1484, 4452, 92);
+INSERT INTO orders VALUES (1485, 4455, 5);
+INSERT INTO orders VALUES (1486, 4458, 18);
+INSERT INTO orders VALUES (1487, 4461, 31);
+INSERT INTO orders VALUES (1488, 4464, 44);
+INSERT INTO orders VALUES (1489, 4467, 57);
+INSERT INTO orders VALUES (1490, 4470, 70);
+INSERT INTO orders VALUES (1491, 4473, 83);
+INSERT INTO orders VALUES (1492, 4476, 96);
+INSERT INTO orders VALUES (1493, 4479, 9);
+INSERT INTO orders VALUES (1494, 4482, 22);
+INSERT INTO orders VALUES (1495, 4485, 35);
+INSERT INTO orders VALUES (1496, 4488, 48);
+INSERT INTO orders VALUES (1497, 4491, 61);
+INSERT INTO orders VALUES (1498, 4494, 74);
+INSERT INTO orders VALUES (1499, 4497, 87);
+INSERT INTO orders VALUES (1500, 4500, 0);
+INSERT INTO orders VALUES (1501, 4503, 13);
+INSERT INTO orders VALUES (1502, 4506, 26);
+INSERT INTO orders VALUES (1503, 4509, 39);
+INSERT INTO orders VALUES (1504, 4512, 52);
+INSERT INTO orders VALUES (1505, 4515, 65);
+INSERT INTO orders VALUES (1506, 4518, 78);
+INSERT INTO orders VALUES (1507, 4521, 91);
+INSERT INTO orders VALUES (1508, 4524, 4);
+INSERT INTO orders VALUES (1509, 4527, 17);
+INSERT INTO orders VALUES (1510, 4530, 30);
+INSERT INTO orders VALUES (1511, 4533, 43);
+INSERT INTO orders VALUES (1512, 4536, 56);
+INSERT INTO orders VALUES (1513, 4539, 69);
+INSERT INTO orders VALUES (1514, 4542, 82);
+INSERT INTO orders VALUES (1515, 4545, 95);
+INSERT INTO orders VALUES (1516, 4548, 8);
+INSERT INTO orders VALUES (1517, 4551, 21);
+INSERT INTO orders VALUES (1518, 4554, 34);
+INSERT INTO orders VALUES (1519, 4557, 47);
+INSERT INTO orders VALUES (1520, 4560, 60);
+INSERT INTO orders VALUES (1521, 4563, 73);
+INSERT INTO orders VALUES (1522, 4566, 86);
+INSERT INTO orders VALUES (1523, 4569, 99);
+INSERT INTO orders VALUES (1524, 4572, 12);
+INSERT INTO orders VALUES (1525, 4575, 25);
+INSERT INTO orders VALUES (1526, 4578, 38);
+INSERT INTO orders VALUES (1527, 4581, 51);
+INSERT INTO orders VALUES (1528, 4584, 64);
+INSERT INTO orders VALUES (1529, 4587, 77);
+INSERT INTO orders VALUES (1530, 4590, 90);
+INSERT INTO orders VALUES (1531, 4593, 3);
+INSERT INTO orders VALUES (1532, 4596, 16);
+INSERT INTO orders VALUES (1533, 4599, 29);
+INSERT INTO orders VALUES (1534, 4602, 42);
+INSERT INTO orders VALUES (1535, 4605, 55);
+INSERT INTO orders VALUES (1536, 4608, 68);
+INSERT INTO orders VALUES (1537, 4611, 81);
+INSERT INTO orders VALUES (1538, 4614, 94);
+INSERT INTO orders VALUES (1539, 4617, 7);
+INSERT INTO orders VALUES (1540, 4620, 20);
+INSERT INTO orders VALUES (1541, 4623, 33);
+INSERT INTO orders VALUES (1542, 4626, 46);
+INSERT INTO orders VALUES (1543, 4629, 59);
+INSERT INTO orders VALUES (1544, 4632, 72);
+INSERT INTO orders VALUES (1545, 4635, 85);
+INSERT INTO orders VALUES (1546, 4638, 98);
+INSERT INTO orders VALUES (1547, 4641, 11);
+INSERT INTO orders VALUES (1548, 4644, 24);
+INSERT INTO orders VALUES (1549, 4647, 37);
+INSERT INTO orders VALUES (1550, 4650, 50);
+INSERT INTO orders VALUES (1551, 4653, 63);
+INSERT INTO orders VALUES (1552, 4656, 76);
+INSERT INTO orders VALUES (1553, 4659, 89);
+INSERT INTO orders VALUES (1554, 4662, 2);
+INSERT INTO orders VALUES (1555, 4665, 15);
+INSERT INTO orders VALUES (1556, 4668, 28);
+INSERT INTO orders VALUES (1557, 4671, 41);
+INSERT INTO orders VALUES (1558, 4674, 54);
+INSERT INTO orders VALUES (1559, 4677, 67);
+INSERT INTO orders VALUES (1560, 4680, 80);
+INSERT INTO orders VALUES (1561, 4683, 93);
+INSERT INTO orders VALUES (1562, 4686, 6);
+INSERT INTO orders VALUES (1563, 4689, 19);
+INSERT INTO orders VALUES (1564, 4692, 32);
+INSERT INTO orders VALUES (1565, 4695, 45);
+INSERT INTO orders VALUES (1566, 4698, 58);
+INSERT INTO orders VALUES (1567, 4701, 71);
+INSERT INTO orders VALUES (1568, 4704, 84);
+INSERT INTO orders VALUES (1569, 4707, 97);
+INSERT INTO orders VALUES (1570, 4710, 10);
+INSERT INTO orders VALUES (1571, 4713, 23);
+INSERT INTO orders VALUES (1572, 4716, 36);
+INSERT INTO orders VALUES (1573, 4719, 49);
+INSERT INTO orders VALUES (1574, 4722, 62);
+INSERT INTO orders VALUES (1575, 4725, 75);
+INSERT INTO orders VALUES (1576, 4728, 88);
+INSERT INTO orders VALUES (1577, 4731, 1);
+INSERT INTO orders VALUES (1578, 4734, 14);
+INSERT INTO orders VALUES (1579, 4737, 27);
+INSERT INTO orders VALUES (1580, 4740, 40);
+INSERT INTO orders VALUES (1581, 4743, 53);
+INSERT INTO orders VALUES (1582, 4746, 66);
+INSERT INTO orders VALUES (1583, 4749, 79);
+INSERT INTO orders VALUES (1584, 4752, 92);
+INSERT INTO orders VALUES (1585, 4755, 5);
+INSERT INTO orders VALUES (1586, 4758, 18);
+INSERT INTO orders VALUES (1587, 4761, 31);
+INSERT INTO orders VALUES (1588, 4764, 44);
+INSERT INTO orders VALUES (1589, 4767, 57);
+INSERT INTO orders VALUES (1590, 4770, 70);
+INSERT INTO orders VALUES (1591, 4773, 83);
+INSERT INTO orders VALUES (1592, 4776, 96);
+INSERT INTO orders VALUES (1593, 4779, 9);
+INSERT INTO orders VALUES (1594, 4782, 22);
+INSERT INTO orders VALUES (1595, 4785, 35);
+INSERT INTO orders VALUES (1596, 4788, 48);
+INSERT INTO orders VALUES (1597, 4791, 61);
+INSERT INTO orders VALUES (1598, 4794, 74);
+INSERT INTO orders VALUES (1599, 4797, 87);
+INSERT INTO orders VALUES (1600, 4800, 0);
+INSERT INTO orders VALUES (1601, 4803, 13);
+INSERT INTO orders VALUES (1602, 4806, 26);
+INSERT INTO orders VALUES (1603, 4809, 39);
+INSERT INTO orders VALUES (1604, 4812, 52);
+INSERT INTO orders VALUES (1605, 4815, 65);
+INSERT INTO orders VALUES (1606, 4818, 78);
+INSERT INTO orders VALUES (1607, 4821, 91);
+INSERT INTO orders VALUES (1608, 4824, 4);
+INSERT INTO orders VALUES (1609, 4827, 17);
+INSERT INTO orders VALUES (1610, 4830, 30);
+INSERT INTO orders VALUES (1611, 4833, 43);
+INSERT INTO orders VALUES (1612, 4836, 56);
+INSERT INTO orders VALUES (1613, 4839, 69);
+INSERT INTO orders VALUES (1614, 4842, 82);
+INSERT INTO orders VALUES (1615, 4845, 95);
+INSERT INTO orders VALUES (1616, 4848, 8);
+INSERT INTO orders VALUES (1617, 4851, 21);
+INSERT INTO orders VALUES (1618, 4854, 34);
+INSERT INTO orders VALUES (1619, 4857, 47);
+INSERT INTO orders VALUES (1620, 4860, 60);
+INSERT INTO orders VALUES (1621, 4863, 73);
+INSERT INTO orders VALUES (1622, 4866, 86);
+INSERT INTO orders VALUES (1623, 4869, 99);
+INSERT INTO orders VALUES (1624, 4872, 12);
+INSERT INTO orders VALUES (1625, 4875, 25);
+INSERT INTO orders VALUES (1626, 4878, 38);
+INSERT INTO orders VALUES (1627, 4881, 51);
+INSERT INTO orders VALUES (1628, 4884, 64);
+INSERT INTO orders VALUES (1629, 4887, 77);
+INSERT INTO orders VALUES (1630, 4890, 90);
+INSERT INTO orders VALUES (1631, 4893, 3);
+INSERT INTO orders VALUES (1632, 4896, 16);
+INSERT INTO orders VALUES (1633, 4899, 29);
+INSERT INTO orders VALUES (1634, 4902, 42);
+INSERT INTO orders VALUES (1635, 4905, 55);
+INSERT INTO orders VALUES (1636, 4908, 68);
+INSERT INTO orders VALUES (1637, 4911, 81);
+INSERT INTO orders VALUES (1638, 4914, 94);
+INSERT INTO orders VALUES (1639, 4917, 7);
+INSERT INTO orders VALUES (1640, 4920, 20);
+INSERT INTO orders VALUES (1641, 4923, 33);
+INSERT INTO orders VALUES (1642, 4926, 46);
+INSERT INTO orders VALUES (1643, 4929, 59);
+INSERT INTO orders VALUES (1644, 4932, 72);
+INSERT INTO orders VALUES (1645, 4935, 85);
+INSERT INTO orders VALUES (1646, 4938, 98);
+INSERT INTO orders VALUES (1647, 4941, 11);
+INSERT INTO orders VALUES (1648, 4944, 24);
+INSERT INTO orders VALUES (1649, 4947, 37);
+INSERT INTO orders VALUES (1650, 4950, 50);
+INSERT INTO orders VALUES (1651, 4953, 63);
+INSERT INTO orders VALUES (1652, 4956, 76);
+INSERT INTO orders VALUES (1653, 4959, 89);
+INSERT INTO orders VALUES (1654, 4962, 2);
+INSERT INTO orders VALUES (1655, 4965, 15);
+INSERT INTO orders VALUES (1656, 4968, 28);
+INSERT INTO orders VALUES (1657, 4971, 41);
+INSERT INTO orders VALUES (1658, 4974, 54);
+INSERT INTO orders VALUES (1659, 4977, 67);
+INSERT INTO orders VALUES (1660, 4980, 80);
+INSERT INTO orders VALUES (1661, 4983, 93);
+INSERT INTO orders VALUES (1662, 4986, 6);
+INSERT INTO orders VALUES (1663, 4989, 19);
+INSERT INTO orders VALUES (1664, 4992, 32);
+INSERT INTO orders VALUES (1665, 4995, 45);
+INSERT INTO orders VALUES (1666, 4998, 58);
+INSERT INTO orders VALUES (1667, 5001, 71);
+INSERT INTO orders VALUES (1668, 5004, 84);
+INSERT INTO orders VALUES (1669, 5007, 97);
+INSERT INTO orders VALUES (1670, 5010, 10);
+INSERT INTO orders VALUES (1671, 5013, 23);
+INSERT INTO orders VALUES (1672, 5016, 36);
+INSERT INTO orders VALUES (1673, 5019, 49);
+INSERT INTO orders VALUES (1674, 5022, 62);
+INSERT INTO orders VALUES (1675, 5025, 75);
+INSERT INTO orders VALUES (1676, 5028, 88);
+INSERT INTO orders VALUES (1677, 5031, 1);
+INSERT INTO orders VALUES (1678, 5034, 14);
+INSERT INTO orders VALUES (1679, 5037, 27);
+INSERT INTO orders VALUES (1680, 5040, 40);
+INSERT INTO orders VALUES (1681, 5043, 53);
+INSERT INTO orders VALUES (1682, 5046, 66);
+INSERT INTO orders VALUES (1683, 5049, 79);
+INSERT INTO orders VALUES (1684, 5052, 92);
+INSERT INTO orders VALUES (1685, 5055, 5);
+INSERT INTO orders VALUES (1686, 5058, 18);
+INSERT INTO orders VALUES (1687, 5061, 31);
+INSERT INTO orders VALUES (1688, 5064, 44);
+INSERT INTO orders VALUES (1689, 5067, 57);
+INSERT INTO orders VALUES (1690, 5070, 70);
+INSERT INTO orders VALUES (1691, 5073, 83);
+INSERT INTO orders VALUES (1692, 5076, 96);
+INSERT INTO orders VALUES (1693, 5079, 9);
+INSERT INTO orders VALUES (1694, 5082, 22);
+INSERT INTO orders VALUES (1695, 5085, 35);
+INSERT INTO orders VALUES (1696, 5088, 48);
+INSERT INTO orders VALUES (1697, 5091, 61);
+INSERT INTO orders VALUES (1698, 5094, 74);
+INSERT INTO orders VALUES (1699, 5097, 87);
+INSERT INTO orders VALUES (1700, 5100, 0);
+INSERT INTO orders VALUES (1701, 5103, 13);
+INSERT INTO orders VALUES (1702, 5106, 26);
+INSERT INTO orders VALUES (1703, 5109, 39);
+INSERT INTO orders VALUES (1704, 5112, 52);
+INSERT INTO orders VALUES (1705, 5115, 65);
+INSERT INTO orders VALUES (1706, 5118, 78);
+INSERT INTO orders VALUES (1707, 5121, 91);
+INSERT INTO orders VALUES (1708, 5124, 4);
+INSERT INTO orders VALUES (1709, 5127, 17);
+INSERT INTO orders VALUES (1710, 5130, 30);
+INSERT INTO orders VALUES (1711, 5133, 43);
+INSERT INTO orders VALUES (1712, 5136, 56);
+INSERT INTO orders VALUES (1713, 5139, 69);
+INSERT INTO orders VALUES (1714, 5142, 82);
+INSERT INTO orders VALUES (1715, 5145, 95);
+INSERT INTO orders VALUES (1716, 5148, 8);
+INSERT INTO orders VALUES (1717, 5151, 21);
+INSERT INTO orders VALUES (1718, 5154, 34);
+INSERT INTO orders VALUES (1719, 5157, 47);
+INSERT INTO orders VALUES (1720, 5160, 60);
+INSERT INTO orders VALUES (1721, 5163, 73);
+INSERT INTO orders VALUES (1722, 5166, 86);
+INSERT INTO orders VALUES (1723, 5169, 99);
+INSERT INTO orders VALUES (1724, 5172, 12);
+INSERT INTO orders VALUES (1725, 5175, 25);
+INSERT INTO orders VALUES (1726, 5178, 38);
+INSERT INTO orders VALUES (1727, 5181, 51);
+INSERT INTO orders VALUES (1728, 5184, 64);
+INSERT INTO orders VALUES (1729, 5187, 77);
+INSERT INTO orders VALUES (1730, 5190, 90);
+INSERT INTO orders VALUES (1731, 5193, 3);
+INSERT INTO orders VALUES (1732, 5196, 16);
+INSERT INTO orders VALUES (1733, 5199, 29);
+INSERT INTO orders VALUES (1734, 5202, 42);
+INSERT INTO orders VALUES (1735, 5205, 55);
+INSERT INTO orders VALUES (1736, 5208, 68);
+INSERT INTO orders VALUES (1737, 5211, 81);
+INSERT INTO orders VALUES (1738, 5214, 94);
+INSERT INTO orders VALUES (1739, 5217, 7);
+INSERT INTO orders VALUES (1740, 5220, 20);
+INSERT INTO orders VALUES (1741, 5223, 33);
+INSERT INTO orders VALUES (1742, 5226, 46);
+INSERT INTO orders VALUES (1743, 5229, 59);
+INSERT INTO orders VALUES (1744, 5232, 72);
+INSERT INTO orders VALUES (1745, 5235, 85);
+INSERT INTO orders VALUES (1746, 5238, 98);
+INSERT INTO orders VALUES (1747, 5241, 11);
+INSERT INTO orders VALUES (1748, 5244, 24);
+INSERT INTO orders VALUES (1749, 5247, 37);
+INSERT INTO orders VALUES (1750, 5250, 50);
+INSERT INTO orders VALUES (1751, 5253, 63);
+INSERT INTO orders VALUES (1752, 5256, 76);
+INSERT INTO orders VALUES (1753, 5259, 89);
+INSERT INTO orders VALUES (1754, 5262, 2);
+INSERT INTO orders VALUES (1755, 5265, 15);
+INSERT INTO orders VALUES (1756, 5268, 28);
+INSERT INTO orders VALUES (1757, 5271, 41);
+INSERT INTO orders VALUES (1758, 5274, 54);
+INSERT INTO orders VALUES (1759, 5277, 67);
+INSERT INTO orders VALUES (1760, 5280, 80);
+INSERT INTO orders VALUES (1761, 5283, 93);
+INSERT INTO orders VALUES (1762, 5286, 6);
+INSERT INTO orders VALUES (1763, 5289, 19);
+INSERT INTO orders VALUES (1764, 5292, 32);
+INSERT INTO orders VALUES (1765, 5295, 45);
+INSERT INTO orders VALUES (1766, 5298, 58);
+INSERT INTO orders VALUES (1767, 5301, 71);
+INSERT INTO orders VALUES (1768, 5304, 84);
+INSERT INTO orders VALUES (1769, 5307, 97);
+INSERT INTO orders VALUES (1770, 5310, 10);
+INSERT INTO orders VALUES (1771, 5313, 23);
+INSERT INTO orders VALUES (1772, 5316, 36);
+INSERT INTO orders VALUES (1773, 5319, 49);
+INSERT INTO orders VALUES (1774, 5322, 62);
+INSERT INTO orders VALUES (1775, 5325, 75);
+INSERT INTO orders VALUES (1776, 5328, 88);
+INSERT INTO orders VALUES (1777, 5331, 1);
+INSERT INTO orders VALUES (1778, 5334, 14);
+INSERT INTO orders VALUES (1779, 5337, 27);
+INSERT INTO orders VALUES (1780, 5340, 40);
+INSERT INTO orders VALUES (1781, 5343, 53);
+INSERT INTO orders VALUES (1782, 5346, 66);
+INSERT INTO orders VALUES (1783, 5349, 79);
+INSERT INTO orders VALUES (1784, 5352, 92);
+INSERT INTO orders VALUES (1785, 5355, 5);
+INSERT INTO orders VALUES (1786, 5358, 18);
+INSERT INTO orders VALUES (1787, 5361, 31);
+INSERT INTO orders VALUES (1788, 5364, 44);
+INSERT INTO orders VALUES (1789, 5367, 57);
+INSERT INTO orders VALUES (1790, 5370, 70);
+INSERT INTO orders VALUES (1791, 5373, 83);
+INSERT INTO orders VALUES (1792, 5376, 96);
+INSERT INTO orders VALUES (1793, 5379, 9);
+INSERT INTO orders VALUES (1794, 5382, 22);
+INSERT INTO orders VALUES (1795, 5385, 35);
+INSERT INTO orders VALUES (1796, 5388, 48);
+INSERT INTO orders VALUES (1797, 5391, 61);
+INSERT INTO orders VALUES (1798, 5394, 74);
+INSERT INTO orders VALUES (1799, 5397, 87);
+INSERT INTO orders VALUES (1800, 5400, 0);
+INSERT INTO orders VALUES (1801, 5403, 13);
+INSERT INTO orders VALUES (1802, 5406, 26);
+INSERT INTO orders VALUES (1803, 5409, 39);
+INSERT INTO orders VALUES (1804, 5412, 52);
+INSERT INTO orders VALUES (1805, 5415, 65);
+INSERT INTO orders VALUES (1806, 5418, 78);
+INSERT INTO orders VALUES (1807, 5421, 91);
+INSERT INTO orders VALUES (1808, 5424, 4);
+INSERT INTO orders VALUES (1809, 5427, 17);
+INSERT INTO orders VALUES (1810, 5430, 30);
+INSERT INTO orders VALUES (1811, 5433, 43);
+INSERT INTO orders VALUES (1812, 5436, 56);
+INSERT INTO orders VALUES (1813, 5439, 69);
+INSERT INTO orders VALUES (1814, 5442, 82);
+INSERT INTO orders VALUES (1815, 5445, 95);
+INSERT INTO orders VALUES (1816, 5448, 8);
+INSERT INTO orders VALUES (1817, 5451, 21);
+INSERT INTO orders VALUES (1818, 5454, 34);
+INSERT INTO orders VALUES (1819, 5457, 47);
+INSERT INTO orders VALUES (1820, 5460, 60);
+INSERT INTO orders VALUES (1821, 5463, 73);
+INSERT INTO orders VALUES (1822, 5466, 86);
+INSERT INTO orders VALUES (1823, 5469, 99);
+INSERT INTO orders VALUES (1824, 5472, 12);
+INSERT INTO orders VALUES (1825, 5475, 25);
+INSERT INTO orders VALUES (1826, 5478, 38);
+INSERT INTO orders VALUES (1827, 5481, 51);
+INSERT INTO orders VALUES (1828, 5484, 64);
+INSERT INTO orders VALUES (1829, 5487, 77);
+INSERT INTO orders VALUES (1830, 5490, 90);
+INSERT INTO orders VALUES (1831, 5493, 3);
+INSERT INTO orders VALUES (1832, 5496, 16);
+INSERT INTO orders VALUES (1833, 5499, 29);
+INSERT INTO orders VALUES (1834, 5502, 42);
+INSERT INTO orders VALUES (1835, 5505, 55);
+INSERT INTO orders VALUES (1836, 5508, 68);
+INSERT INTO orders VALUES (1837, 5511, 81);
+INSERT INTO orders VALUES (1838, 5514, 94);
+INSERT INTO orders VALUES (1839, 5517, 7);
+INSERT INTO orders VALUES (1840, 5520, 20);
+INSERT INTO orders VALUES (1841, 5523, 33);
+INSERT INTO orders VALUES (1842, 5526, 46);
+INSERT INTO orders VALUES (1843, 5529, 59);
+INSERT INTO orders VALUES (1844, 5532, 72);
+INSERT INTO orders VALUES (1845, 5535, 85);
+INSERT INTO orders VALUES (1846, 5538, 98);
+INSERT INTO orders VALUES (1847, 5541, 11);
+INSERT INTO orders VALUES (1848, 5544, 24);
+INSERT INTO orders VALUES (1849, 5547, 37);
+INSERT INTO orders VALUES (1850, 5550, 50);
+INSERT INTO orders VALUES (1851, 5553, 63);
+INSERT INTO orders VALUES (1852, 5556, 76);
+INSERT INTO orders VALUES (1853, 5559, 89);
+INSERT INTO orders VALUES (1854, 5562, 2);
+INSERT INTO orders VALUES (1855, 5565, 15);
+INSERT INTO orders VALUES (1856, 5568, 28);
+INSERT INTO orders VALUES (1857, 5571, 41);
+INSERT INTO orders VALUES (1858, 5574, 54);
+INSERT INTO orders VALUES (1859, 5577, 67);
+INSERT INTO orders VALUES (1860, 5580, 80);
+INSERT INTO orders VALUES (1861, 5583, 93);
+INSERT INTO orders VALUES (1862, 5586, 6);
+INSERT INTO orders VALUES (1863, 5589, 19);
+INSERT INTO orders VALUES (1864, 5592, 32);
+INSERT INTO orders VALUES (1865, 5595, 45);
+INSERT INTO orders VALUES (1866, 5598, 58);
+INSERT INTO orders VALUES (1867, 5601, 71);
+INSERT INTO orders VALUES (1868, 5604, 84);
+INSERT INTO orders VALUES (1869, 5607, 97);
+INSERT INTO orders VALUES (1870, 5610, 10);
+INSERT INTO orders VALUES (1871, 5613, 23);
+INSERT INTO orders VALUES (1872, 5616, 36);
+INSERT INTO orders VALUES (1873, 5619, 49);
+INSERT INTO orders VALUES (1874, 5622, 62);
+INSERT INTO orders VALUES (1875, 5625, 75);
+INSERT INTO orders VALUES (1876, 5628, 88);
+INSERT INTO orders VALUES (1877, 5631, 1);
+INSERT INTO orders VALUES (1878, 5634, 14);
+INSERT INTO orders VALUES (1879, 5637, 27);
+INSERT INTO orders VALUES (1880, 5640, 40);
+INSERT INTO orders VALUES (1881, 5643, 53);
+INSERT INTO orders VALUES (1882, 5646, 66);
+INSERT INTO orders VALUES (1883, 5649, 79);
+INSERT INTO orders VALUES (1884, 5652, 92);
+INSERT INTO orders VALUES (1885, 5655, 5);
+INSERT INTO orders VALUES (1886, 5658, 18);
+INSERT INTO orders VALUES (1887, 5661, 31);
+INSERT INTO orders VALUES (1888, 5664, 44);
+INSERT INTO orders VALUES (1889, 5667, 57);
+INSERT INTO orders VALUES (1890, 5670, 70);
+INSERT INTO orders VALUES (1891, 5673, 83);
+INSERT INTO orders VALUES (1892, 5676, 96);
+INSERT INTO orders VALUES (1893, 5679, 9);
+INSERT INTO orders VALUES (1894, 5682, 22);
+INSERT INTO orders VALUES (1895, 5685, 35);
+INSERT INTO orders VALUES (1896, 5688, 48);
+INSERT INTO orders VALUES (1897, 5691, 61);
+INSERT INTO orders VALUES (1898, 5694, 74);
+INSERT INTO orders VALUES (1899, 5697, 87);
+INSERT INTO orders VALUES (1900, 5700, 0);
+INSERT INTO orders VALUES (1901, 5703, 13);
+INSERT INTO orders VALUES (1902, 5706, 26);
+INSERT INTO orders VALUES (1903, 5709, 39);
+INSERT INTO orders VALUES (1904, 5712, 52);
+INSERT INTO orders VALUES (1905, 5715, 65);
+INSERT INTO orders VALUES (1906, 5718, 78);
+INSERT INTO orders VALUES (1907, 5721, 91);
+INSERT INTO orders VALUES (1908, 5724, 4);
+INSERT INTO orders VALUES (1909, 5727, 17);
+INSERT INTO orders VALUES (1910, 5730, 30);
+INSERT INTO orders VALUES (1911, 5733, 43);
+INSERT INTO orders VALUES (1912, 5736, 56);
+INSERT INTO orders VALUES (1913, 5739, 69);
+INSERT INTO orders VALUES (1914, 5742, 82);
+INSERT INTO orders VALUES (1915, 5745, 95);
+INSERT INTO orders VALUES (1916, 5748, 8);
+INSERT INTO orders VALUES (1917, 5751, 21);
+INSERT INTO orders VALUES (1918, 5754, 34);
+INSERT INTO orders VALUES (1919, 5757, 47);
+INSERT INTO orders VALUES (1920, 5760, 60);
+INSERT INTO orders VALUES (1921, 5763, 73);
+INSERT INTO orders VALUES (1922, 5766, 86);
+INSERT INTO orders VALUES (1923, 5769, 99);
+INSERT INTO orders VALUES (1924, 5772, 12);
+INSERT INTO orders VALUES (1925, 5775, 25);
+INSERT INTO orders VALUES (1926, 5778, 38);
+INSERT INTO orders VALUES (1927, 5781, 51);
+INSERT INTO orders VALUES (1928, 5784, 64);
+INSERT INTO orders VALUES (1929, 5787, 77);
+INSERT INTO orders VALUES (1930, 5790, 90);
+INSERT INTO orders VALUES (1931, 5793, 3);
+INSERT INTO orders VALUES (1932, 5796, 16);
+INSERT INTO orders VALUES (1933, 5799, 29);
+INSERT INTO orders VALUES (1934, 5802, 42);
+INSERT INTO orders VALUES (1935, 5805, 55);
+INSERT INTO orders VALUES (1936, 5808, 68);
+INSERT INTO orders VALUES (1937, 5811, 81);
+INSERT INTO orders VALUES (1938, 5814, 94);
+INSERT INTO orders VALUES (1939, 5817, 7);
+INSERT INTO orders VALUES (1940, 5820, 20);
+INSERT INTO orders VALUES (1941, 5823, 33);
+INSERT INTO orders VALUES (1942, 5826, 46);
+INSERT INTO orders VALUES (1943, 5829, 59);
+INSERT INTO orders VALUES (1944, 5832, 72);
+INSERT INTO orders VALUES (1945, 5835, 85);
+INSERT INTO orders VALUES (1946, 5838, 98);
+INSERT INTO orders VALUES (1947, 5841, 11);
+INSERT INTO orders VALUES (1948, 5844, 24);
+INSERT INTO orders VALUES (1949, 5847, 37);
+INSERT INTO orders VALUES (1950, 5850, 50);
+INSERT INTO orders VALUES (1951, 5853, 63);
+INSERT INTO orders VALUES (1952, 5856, 76);
+INSERT INTO orders VALUES (1953, 5859, 89);
+INSERT INTO orders VALUES (1954, 5862, 2);
+INSERT INTO orders VALUES (1955, 5865, 15);
+INSERT INTO orders VALUES (1956, 5868, 28);
+INSERT INTO orders VALUES (1957, 5871, 41);
+INSERT INTO orders VALUES (1958, 5874, 54);
+INSERT INTO orders VALUES (1959, 5877, 67);
+INSERT INTO orders VALUES (1960, 5880, 80);
+INSERT INTO orders VALUES (1961, 5883, 93);
+INSERT INTO orders VALUES (1962, 5886, 6);
+INSERT INTO orders VALUES (1963, 5889, 19);
+INSERT INTO orders VALUES (1964, 5892, 32);
+INSERT INTO orders VALUES (1965, 5895, 45);
+INSERT INTO orders VALUES (1966, 5898, 58);
+INSERT INTO orders VALUES (1967, 5901, 71);
+INSERT INTO orders VALUES (1968, 5904, 84);
+INSERT INTO orders VALUES (1969, 5907, 97);
+INSERT INTO orders VALUES (1970, 5910, 10);
+INSERT INTO orders VALUES (1971, 5913, 23);
+INSERT INTO orders VALUES (1972, 5916, 36);
+INSERT INTO orders VALUES (1973, 5919, 49);
+INSERT INTO orders VALUES (1974, 5922, 62);
+INSERT INTO orders VALUES (1975, 5925, 75);
+INSERT INTO orders VALUES (1976, 5928, 88);
+INSERT INTO orders VALUES (1977, 5931, 1);
+INSERT INTO orders VALUES (1978, 5934, 14);
+INSERT INTO orders VALUES (1979, 5937, 27);
+INSERT INTO orders VALUES (1980, 5940, 40);
+INSERT INTO orders VALUES (1981, 5943, 53);
+INSERT INTO orders VALUES (1982, 5946, 66);
+INSERT INTO orders VALUES (1983, 5949, 79);
+INSERT INTO orders VALUES (1984, 5952, 92);
+INSERT INTO orders VALUES (1985, 5955, 5);
+INSERT INTO orders VALUES (1986, 5958, 18);
+INSERT INTO orders VALUES (1987, 5961, 31);
+INSERT INTO orders VALUES (1988, 5964, 44);
+INSERT INTO orders VALUES (1989, 5967, 57);
+INSERT INTO orders VALUES (1990, 5970, 70);
+INSERT INTO orders VALUES (1991, 5973, 83);
+INSERT INTO orders VALUES (1992, 5976, 96);
+INSERT INTO orders VALUES (1993, 5979, 9);
+INSERT INTO orders VALUES (1994, 5982, 22);
+INSERT INTO orders VALUES (1995, 5985, 35);
+INSERT INTO orders VALUES (1996, 5988, 48);
+INSERT INTO orders VALUES (1997, 5991, 61);
+INSERT INTO orders VALUES (1998, 5994, 74);
+INSERT INTO orders VALUES (1999, 5997, 87);
+INSERT INTO orders VALUES (2000, 6000, 0);
+INSERT INTO orders VALUES (2001, 6003, 13);
+INSERT INTO orders VALUES (2002, 6006, 26);
+INSERT INTO orders VALUES (2003, 6009, 39);
+INSERT INTO orders VALUES (2004, 6012, 52);
+INSERT INTO orders VALUES (2005, 6015, 65);
+INSERT INTO orders VALUES (2006, 6018, 78);
+INSERT INTO orders VALUES (2007, 6021, 91);
+INSERT INTO orders VALUES (2008, 6024, 4);
+INSERT INTO orders VALUES (2009, 6027, 17);
+INSERT INTO orders VALUES (2010, 6030, 30);
+INSERT INTO orders VALUES (2011, 6033, 43);
+INSERT INTO orders VALUES (2012, 6036, 56);
+INSERT INTO orders VALUES (2013, 6039, 69);
+INSERT INTO orders VALUES (2014, 6042, 82);
+INSERT INTO orders VALUES (2015, 6045, 95);
+INSERT INTO orders VALUES (2016, 6048, 8);
+INSERT INTO orders VALUES (2017, 6051, 21);
+INSERT INTO orders VALUES (2018, 6054, 34);
+INSERT INTO orders VALUES (2019, 6057, 47);
+INSERT INTO orders VALUES (2020, 6060, 60);
+INSERT INTO orders VALUES (2021, 6063, 73);
+INSERT INTO orders VALUES (2022, 6066, 86);
+INSERT INTO orders VALUES (2023, 6069, 99);
+INSERT INTO orders VALUES (2024, 6072, 12);
+INSERT INTO orders VALUES (2025, 6075, 25);
+INSERT INTO orders VALUES (2026, 6078, 38);
+INSERT INTO orders VALUES (2027, 6081, 51);
+INSERT INTO orders VALUES (2028, 6084, 64);
+INSERT INTO orders VALUES (2029, 6087, 77);
+INSERT INTO orders VALUES (2030, 6090, 90);
+INSERT INTO orders VALUES (2031, 6093, 3);
+INSERT INTO orders VALUES (2032, 6096, 16);
+INSERT INTO orders VALUES (2033, 6099, 29);
+INSERT INTO orders VALUES (2034, 6102, 42);
+INSERT INTO orders VALUES (2035, 6105, 55);
+INSERT INTO orders VALUES (2036, 6108, 68);
+INSERT INTO orders VALUES (2037, 6111, 81);
+INSERT INTO orders VALUES (2038, 6114, 94);
+INSERT INTO orders VALUES (2039, 6117, 7);
+INSERT INTO orders VALUES (2040, 6120, 20);
+INSERT INTO orders VALUES (2041, 6123, 33);
+INSERT INTO orders VALUES (2042, 6126, 46);
+INSERT INTO orders VALUES (2043, 6129, 59);
+INSERT INTO orders VALUES (2044, 6132, 72);
+INSERT INTO orders VALUES (2045, 6135, 85);
+INSERT INTO orders VALUES (2046, 6138, 98);
+INSERT INTO orders VALUES (2047, 6141, 11);
+INSERT INTO orders VALUES (2048, 6144, 24);
+INSERT INTO orders VALUES (2049, 6147, 37);
+INSERT INTO orders VALUES (2050, 6150, 50);
+INSERT INTO orders VALUES (2051, 6153, 63);
+INSERT INTO orders VALUES (2052, 6156, 76);
+INSERT INTO orders VALUES (2053, 6159, 89);
+INSERT INTO orders VALUES (2054, 6162, 2);
+INSERT INTO orders VALUES (2055, 6165, 15);
+INSERT INTO orders VALUES (2056, 6168, 28);
+INSERT INTO orders VALUES (2057, 6171, 41);
+INSERT INTO orders VALUES (2058, 6174, 54);
+INSERT INTO orders VALUES (2059, 6177, 67);
+INSERT INTO orders VALUES (2060, 6180, 80);
+INSERT INTO orders VALUES (2061, 6183, 93);
+INSERT INTO orders VALUES (2062, 6186, 6);
+INSERT INTO orders VALUES (2063, 6189, 19);
+INSERT INTO orders VALUES (2064, 6192, 32);
+INSERT INTO orders VALUES (2065, 6195, 45);
+INSERT INTO orders VALUES (2066, 6198, 58);
+INSERT INTO orders VALUES (2067, 6201, 71);
+INSERT INTO orders VALUES (2068, 6204, 84);
+INSERT INTO orders VALUES (2069, 6207, 97);
+INSERT INTO orders VALUES (2070, 6210, 10);
+INSERT INTO orders VALUES (2071, 6213, 23);
+INSERT INTO orders VALUES (2072, 6216, 36);
+INSERT INTO orders VALUES (2073, 6219, 49);
+INSERT INTO orders VALUES (2074, 6222, 62);
+INSERT INTO orders VALUES (2075, 6225, 75);
+INSERT INTO orders VALUES (2076, 6228, 88);
+INSERT INTO orders VALUES (2077, 6231, 1);
+INSERT INTO orders VALUES (2078, 6234, 14);
+INSERT INTO orders VALUES (2079, 6237, 27);
+INSERT INTO orders VALUES (2080, 6240, 40);
+INSERT INTO orders VALUES (2081, 6243, 53);
+INSERT INTO orders VALUES (2082, 6246, 66);
+INSERT INTO orders VALUES (2083, 6249, 79);
+INSERT INTO orders VALUES (2084, 6252, 92);
+INSERT INTO orders VALUES (2085, 6255, 5);
+INSERT INTO orders VALUES (2086, 6258, 18);
+INSERT INTO orders VALUES (2087, 6261, 31);
+INSERT INTO orders VALUES (2088, 6264, 44);
+INSERT INTO orders VALUES (2089, 6267, 57);
+INSERT INTO orders VALUES (2090, 6270, 70);
+INSERT INTO orders VALUES (2091, 6273, 83);
+INSERT INTO orders VALUES (2092, 6276, 96);
+INSERT INTO orders VALUES (2093, 6279, 9);
+INSERT INTO orders VALUES (2094, 6282, 22);
+INSERT INTO orders VALUES (2095, 6285, 35);
+INSERT INTO orders VALUES (2096, 6288, 48);
+INSERT INTO orders VALUES (2097, 6291, 61);
+INSERT INTO orders VALUES (2098, 6294, 74);
+INSERT INTO orders VALUES (2099, 6297, 87);
+INSERT INTO orders VALUES (2100, 6300, 0);
+INSERT INTO orders VALUES (2101, 6303, 13);
+INSERT INTO orders VALUES (2102, 6306, 26);
+INSERT INTO orders VALUES (2103, 6309, 39);
+INSERT INTO orders VALUES (2104, 6312, 52);
+INSERT INTO orders VALUES (2105, 6315, 65);
+INSERT INTO orders VALUES (2106, 6318, 78);
+INSERT INTO orders VALUES (2107, 6321, 91);
+INSERT INTO orders VALUES (2108, 6324, 4);
+INSERT INTO orders VALUES (2109, 6327, 17);
+INSERT INTO orders VALUES (2110, 6330, 30);
+INSERT INTO orders VALUES (2111, 6333, 43);
+INSERT INTO orders VALUES (2112, 6336, 56);
+INSERT INTO orders VALUES (2113, 6339, 69);
+INSERT INTO orders VALUES (2114, 6342, 82);
+INSERT INTO orders VALUES (2115, 6345, 95);
+INSERT INTO orders VALUES (2116, 6348, 8);
+INSERT INTO orders VALUES (2117, 6351, 21);
+INSERT INTO orders VALUES (2118, 6354, 34);
+INSERT INTO orders VALUES (2119, 6357, 47);
+INSERT INTO orders VALUES (2120, 6360, 60);
+INSERT INTO orders VALUES (2121, 6363, 73);
+INSERT INTO orders VALUES (2122, 6366, 86);
+INSERT INTO orders VALUES (2123, 6369, 99);
+INSERT INTO orders VALUES (2124, 6372, 12);
+INSERT INTO orders VALUES (2125, 6375, 25);
+INSERT INTO orders VALUES (2126, 6378, 38);
+INSERT INTO orders VALUES (2127, 6381, 51);
+INSERT INTO orders VALUES (2128, 6384, 64);
+INSERT INTO orders VALUES (2129, 6387, 77);
+INSERT INTO orders VALUES (2130, 6390, 90);
+INSERT INTO orders VALUES (2131, 6393, 3);
+INSERT INTO orders VALUES (2132, 6396, 16);
+INSERT INTO orders VALUES (2133, 6399, 29);
+INSERT INTO orders VALUES (2134, 6402, 42);
+INSERT INTO orders VALUES (2135, 6405, 55);
+INSERT INTO orders VALUES (2136, 6408, 68);
+INSERT INTO orders VALUES (2137, 6411, 81);
+INSERT INTO orders VALUES (2138, 6414, 94);
+INSERT INTO orders VALUES (2139, 6417, 7);
+INSERT INTO orders VALUES (2140, 6420, 20);
+INSERT INTO orders VALUES (2141, 6423, 33);
+INSERT INTO orders VALUES (2142, 6426, 46);
+INSERT INTO orders VALUES (2143, 6429, 59);
+INSERT INTO orders VALUES (2144, 6432, 72);
+INSERT INTO orders VALUES (2145, 6435, 85);
+INSERT INTO orders VALUES (2146, 6438, 98);
+INSERT INTO orders VALUES (2147, 6441, 11);
+INSERT INTO orders VALUES (2148, 6444, 24);
+INSERT INTO orders VALUES (2149, 6447, 37);
+INSERT INTO orders VALUES (2150, 6450, 50);
+INSERT INTO orders VALUES (2151, 6453, 63);
+INSERT INTO orders VALUES (2152, 6456, 76);
+INSERT INTO orders VALUES (2153, 6459, 89);
+INSERT INTO orders VALUES (2154, 6462, 2);
+INSERT INTO orders VALUES (2155, 6465, 15);
+INSERT INTO orders VALUES (2156, 6468, 28);
+INSERT INTO orders VALUES (2157, 6471, 41);
+INSERT INTO orders VALUES (2158, 6474, 54);
+INSERT INTO orders VALUES (2159, 6477, 67);
+INSERT INTO orders VALUES (2160, 6480, 80);
+INSERT INTO orders VALUES (2161, 6483, 93);
+INSERT INTO orders VALUES (2162, 6486, 6);
+INSERT INTO orders VALUES (2163, 6489, 19);
+INSERT INTO orders VALUES (2164, 6492, 32);
+INSERT INTO orders VALUES (2165, 6495, 45);
+INSERT INTO orders VALUES (2166, 6498, 58);
+INSERT INTO orders VALUES (2167, 6501, 71);
+INSERT INTO orders VALUES (2168, 6504, 84);
+INSERT INTO orders VALUES (2169, 6507, 97);
+INSERT INTO orders VALUES (2170, 6510, 10);
+INSERT INTO orders VALUES (2171, 6513, 23);
+INSERT INTO orders VALUES (2172, 6516, 36);
+INSERT INTO orders VALUES (2173, 6519, 49);
+INSERT INTO orders VALUES (2174, 6522, 62);
+INSERT INTO orders VALUES (2175, 6525, 75);
+INSERT INTO orders VALUES (2176, 6528, 88);
+INSERT INTO orders VALUES (2177, 6531, 1);
+INSERT INTO orders VALUES (2178, 6534, 14);
+INSERT INTO orders VALUES (2179, 6537, 27);
+INSERT INTO orders VALUES (2180, 6540, 40);
+INSERT INTO orders VALUES (2181, 6543, 53);
+INSERT INTO orders VALUES (2182, 6546, 66);
+INSERT INTO orders VALUES (2183, 6549, 79);
+INSERT INTO orders VALUES (2184, 6552, 92);
+INSERT INTO orders VALUES (2185, 6555, 5);
+INSERT INTO orders VALUES (2186, 6558, 18);
+INSERT INTO orders VALUES (2187, 6561, 31);
+INSERT INTO orders VALUES (2188, 6564, 44);
+INSERT INTO orders VALUES (2189, 6567, 57);
+INSERT INTO orders VALUES (2190, 6570, 70);
+INSERT INTO orders VALUES (2191, 6573, 83);
+INSERT INTO orders VALUES (2192, 6576, 96);
+INSERT INTO orders VALUES (2193, 6579, 9);
+INSERT INTO orders VALUES (2194, 6582, 22);
+INSERT INTO orders VALUES (2195, 6585, 35);
+INSERT INTO orders VALUES (2196, 6588, 48);
+INSERT INTO orders VALUES (2197, 6591, 61);
+INSERT INTO orders VALUES (2198, 6594, 74);
+INSERT INTO orders VALUES (2199, 6597, 87);
+INSERT INTO orders VALUES (2200, 6600, 0);
+INSERT INTO orders VALUES (2201, 6603, 13);
+INSERT INTO orders VALUES (2202, 6606, 26);
+INSERT INTO orders VALUES (2203, 6609, 39);
+INSERT INTO orders VALUES (2204, 6612, 52);
+INSERT INTO orders VALUES (2205, 6615, 65);
+INSERT INTO orders VALUES (2206, 6618, 78);
+INSERT INTO orders VALUES (2207, 6621, 91);
+INSERT INTO orders VALUES (2208, 6624, 4);
+INSERT INTO orders VALUES (2209, 6627, 17);
+INSERT INTO orders VALUES (2210, 6630, 30);
+INSERT INTO orders VALUES (2211, 6633, 43);
+INSERT INTO orders VALUES (2212, 6636, 56);
+INSERT INTO orders VALUES (2213, 6639, 69);
+INSERT INTO orders VALUES (2214, 6642, 82);
+INSERT INTO orders VALUES (2215, 6645, 95);
+INSERT INTO orders VALUES (2216, 6648, 8);
+INSERT INTO orders VALUES (2217, 6651, 21);
+INSERT INTO orders VALUES (2218, 6654, 34);
+INSERT INTO orders VALUES (2219, 6657, 47);
+INSERT INTO orders VALUES (2220, 6660, 60);
+INSERT INTO orders VALUES (2221, 6663, 73);
+INSERT INTO orders VALUES (2222, 6666, 86);
+INSERT INTO orders VALUES (2223, 6669, 99);
+INSERT INTO orders VALUES (2224, 6672, 12);
+INSERT INTO orders VALUES (2225, 6675, 25);
+INSERT INTO orders VALUES (2226, 6678, 38);
+INSERT INTO orders VALUES (2227, 6681, 51);
+INSERT INTO orders VALUES (2228, 6684, 64);
+INSERT INTO orders VALUES (2229, 6687, 77);
+INSERT INTO orders VALUES (2230, 6690, 90);
+INSERT INTO orders VALUES (2231, 6693, 3);
+INSERT INTO orders VALUES (2232, 6696, 16);
+INSERT INTO orders VALUES (2233, 6699, 29);
+INSERT INTO orders VALUES (2234, 6702, 42);
+INSERT INTO orders VALUES (2235, 6705, 55);
+INSERT INTO orders VALUES (2236, 6708, 68);
+INSERT INTO orders VALUES (2237, 6711, 81);
+INSERT INTO orders VALUES (2238, 6714, 94);
+INSERT INTO orders VALUES (2239, 6717, 7);
+INSERT INTO orders VALUES (2240, 6720, 20);
+INSERT INTO orders VALUES (2241, 6723, 33);
+INSERT INTO orders VALUES (2242, 6726, 46);
+INSERT INTO orders VALUES (2243, 6729, 59);
+INSERT INTO orders VALUES (2244, 6732, 72);
+INSERT INTO orders VALUES (2245, 6735, 85);
+INSERT INTO orders VALUES (2246, 6738, 98);
+INSERT INTO orders VALUES (2247, 6741, 11);
+INSERT INTO orders VALUES (2248, 6744, 24);
+INSERT INTO orders VALUES (2249, 6747, 37);
+INSERT INTO orders VALUES (2250, 6750, 50);
+INSERT INTO orders VALUES (2251, 6753, 63);
+INSERT INTO orders VALUES (2252, 6756, 76);
+INSERT INTO orders VALUES (2253, 6759, 89);
+INSERT INTO orders VALUES (2254, 6762, 2);
+INSERT INTO orders VALUES (2255, 6765, 15);
+INSERT INTO orders VALUES (2256, 6768, 28);
+INSERT INTO orders VALUES (2257, 6771, 41);
+INSERT INTO orders VALUES (2258, 6774, 54);
+INSERT INTO orders VALUES (2259, 6777, 67);
+INSERT INTO orders VALUES (2260, 6780, 80);
+INSERT INTO orders VALUES (2261, 6783, 93);
+INSERT INTO orders VALUES (2262, 6786, 6);
+INSERT INTO orders VALUES (2263, 6789, 19);
+INSERT INTO orders VALUES (2264, 6792, 32);
+INSERT INTO orders VALUES (2265, 6795, 45);
+INSERT INTO orders VALUES (2266, 6798, 58);
+INSERT INTO orders VALUES (2267, 6801, 71);
+INSERT INTO orders VALUES (2268, 6804, 84);
+INSERT INTO orders VALUES (2269, 6807, 97);
+INSERT INTO orders VALUES (2270, 6810, 10);
+INSERT INTO orders VALUES (2271, 6813, 23);
+INSERT INTO orders VALUES (2272, 6816, 36);
+INSERT INTO orders VALUES (2273, 6819, 49);
+INSERT INTO orders VALUES (2274, 6822, 62);
+INSERT INTO orders VALUES (2275, 6825, 75);
+INSERT INTO orders VALUES (2276, 6828, 88);
+INSERT INTO orders VALUES (2277, 6831, 1);
+INSERT INTO orders VALUES (2278, 6834, 14);
+INSERT INTO orders VALUES (2279, 6837, 27);
+INSERT INTO orders VALUES (2280, 6840, 40);
+INSERT INTO orders VALUES (2281, 6843, 53);
+INSERT INTO orders VALUES (2282, 6846, 66);
+INSERT INTO orders VALUES (2283, 6849, 79);
+INSERT INTO orders VALUES (2284, 6852, 92);
+INSERT INTO orders VALUES (2285, 6855, 5);
+INSERT INTO orders VALUES (2286, 6858, 18);
+INSERT INTO orders VALUES (2287, 6861, 31);
+INSERT INTO orders VALUES (2288, 6864, 44);
+INSERT INTO orders VALUES (2289, 6867, 57);
+INSERT INTO orders VALUES (2290, 6870, 70);
+INSERT INTO orders VALUES (2291, 6873, 83);
+INSERT INTO orders VALUES (2292, 6876, 96);
+INSERT INTO orders VALUES (2293, 6879, 9);
+INSERT INTO orders VALUES (2294, 6882, 22);
+INSERT INTO orders VALUES (2295, 6885, 35);
+INSERT INTO orders VALUES (2296, 6888, 48);
+INSERT INTO orders VALUES (2297, 6891, 61);
+INSERT INTO orders VALUES (2298, 6894, 74);
+INSERT INTO orders VALUES (2299, 6897, 87);
+INSERT INTO orders VALUES (2300, 6900, 0);
+INSERT INTO orders VALUES (2301, 6903, 13);
+INSERT INTO orders VALUES (2302, 6906, 26);
+INSERT INTO orders VALUES (2303, 6909, 39);
+INSERT INTO orders VALUES (2304, 6912, 52);
+INSERT INTO orders VALUES (2305, 6915, 65);
+INSERT INTO orders VALUES (2306, 6918, 78);
+INSERT INTO orders VALUES (2307, 6921, 91);
+INSERT INTO orders VALUES (2308, 6924, 4);
+INSERT INTO orders VALUES (2309, 6927, 17);
+INSERT INTO orders VALUES (2310, 6930, 30);
+INSERT INTO orders VALUES (2311, 6933, 43);
+INSERT INTO orders VALUES (2312, 6936, 56);
+INSERT INTO orders VALUES (2313, 6939, 69);
+INSERT INTO orders VALUES (2314, 6942, 82);
+INSERT INTO orders VALUES (2315, 6945, 95);
+INSERT INTO orders VALUES (2316, 6948, 8);
+INSERT INTO orders VALUES (2317, 6951, 21);
+INSERT INTO orders VALUES (2318, 6954, 34);
+INSERT INTO orders VALUES (2319, 6957, 47);
+INSERT INTO orders VALUES (2320, 6960, 60);
+INSERT INTO orders VALUES (2321, 6963, 73);
+INSERT INTO orders VALUES (2322, 6966, 86);
+INSERT INTO orders VALUES (2323, 6969, 99);
+INSERT INTO orders VALUES (2324, 6972, 12);
+INSERT INTO orders VALUES (2325, 6975, 25);
+INSERT INTO orders VALUES (2326, 6978, 38);
+INSERT INTO orders VALUES (2327, 6981, 51);
+INSERT INTO orders VALUES (2328, 6984, 64);
+INSERT INTO orders VALUES (2329, 6987, 77);
+INSERT INTO orders VALUES (2330, 6990, 90);
+INSERT INTO orders VALUES (2331, 6993, 3);
+INSERT INTO orders VALUES (2332, 6996, 16);
+INSERT INTO orders VALUES (2333, 6999, 29);
+INSERT INTO orders VALUES (2334, 7002, 42);
+INSERT INTO orders VALUES (2335, 7005, 55);
+INSERT INTO orders VALUES (2336, 7008, 68);
+INSERT INTO orders VALUES (2337, 7011, 81);
+INSERT INTO orders VALUES (2338, 7014, 94);
+INSERT INTO orders VALUES (2339, 7017, 7);
+INSERT INTO orders VALUES (2340, 7020, 20);
+INSERT INTO orders VALUES (2341, 7023, 33);
+INSERT INTO orders VALUES (2342, 7026, 46);
+INSERT INTO orders VALUES (2343, 7029, 59);
+INSERT INTO orders VALUES (2344, 7032, 72);
+INSERT INTO orders VALUES (2345, 7035, 85);
+INSERT INTO orders VALUES (2346, 7038, 98);
+INSERT INTO orders VALUES (2347, 7041, 11);
+INSERT INTO orders VALUES (2348, 7044, 24);
+INSERT INTO orders VALUES (2349, 7047, 37);
+INSERT INTO orders VALUES (2350, 7050, 50);
+INSERT INTO orders VALUES (2351, 7053, 63);
+INSERT INTO orders VALUES (2352, 7056, 76);
+INSERT INTO orders VALUES (2353, 7059, 89);
+INSERT INTO orders VALUES (2354, 7062, 2);
+INSERT INTO orders VALUES (2355, 7065, 15);
+INSERT INTO orders VALUES (2356, 7068, 28);
+INSERT INTO orders VALUES (2357, 7071, 41);
+INSERT INTO orders VALUES (2358, 7074, 54);
+INSERT INTO orders VALUES (2359, 7077, 67);
+INSERT INTO orders VALUES (2360, 7080, 80);
+INSERT INTO orders VALUES (2361, 7083, 93);
+INSERT INTO orders VALUES (2362, 7086, 6);
+INSERT INTO orders VALUES (2363, 7089, 19);
+INSERT INTO orders VALUES (2364, 7092, 32);
+INSERT INTO orders VALUES (2365, 7095, 45);
+INSERT INTO orders VALUES (2366, 7098, 58);
+INSERT INTO orders VALUES (2367, 7101, 71);
+INSERT INTO orders VALUES (2368, 7104, 84);
+INSERT INTO orders VALUES (2369, 7107, 97);
+INSERT INTO orders VALUES (2370, 7110, 10);
+INSERT INTO orders VALUES (2371, 7113, 23);
+INSERT INTO orders VALUES (2372, 7116, 36);
+INSERT INTO orders VALUES (2373, 7119, 49);
+INSERT INTO orders VALUES (2374, 7122, 62);
+INSERT INTO orders VALUES (2375, 7125, 75);
+INSERT INTO orders VALUES (2376, 7128, 88);
+INSERT INTO orders VALUES (2377, 7131, 1);
+INSERT INTO orders VALUES (2378, 7134, 14);
+INSERT INTO orders VALUES (2379, 7137, 27);
+INSERT INTO orders VALUES (2380, 7140, 40);
+INSERT INTO orders VALUES (2381, 7143, 53);
+INSERT INTO orders VALUES (2382, 7146, 66);
+INSERT INTO orders VALUES (2383, 7149, 79);
+INSERT INTO orders VALUES (2384, 7152, 92);
+INSERT INTO orders VALUES (2385, 7155, 5);
+INSERT INTO orders VALUES (2386, 7158, 18);
+INSERT INTO orders VALUES (2387, 7161, 31);
+INSERT INTO orders VALUES (2388, 7164, 44);
+INSERT INTO orders VALUES (2389, 7167, 57);
+INSERT INTO orders VALUES (2390, 7170, 70);
+INSERT INTO orders VALUES (2391, 7173, 83);
+INSERT INTO orders VALUES (2392, 7176, 96);
+INSERT INTO orders VALUES (2393, 7179, 9);
+INSERT INTO orders VALUES (2394, 7182, 22);
+INSERT INTO orders VALUES (2395, 7185, 35);
+INSERT INTO orders VALUES (2396, 7188, 48);
+INSERT INTO orders VALUES (2397, 7191, 61);
+INSERT INTO orders VALUES (2398, 7194, 74);
+INSERT INTO orders VALUES (2399, 7197, 87);
+INSERT INTO orders VALUES (2400, 7200, 0);
+INSERT INTO orders VALUES (2401, 7203, 13);
+INSERT INTO orders VALUES (2402, 7206, 26);
+INSERT INTO orders VALUES (2403, 7209, 39);
+INSERT INTO orders VALUES (2404, 7212, 52);
+INSERT INTO orders VALUES (2405, 7215, 65);
+INSERT INTO orders VALUES (2406, 7218, 78);
+INSERT INTO orders VALUES (2407, 7221, 91);
+INSERT INTO orders VALUES (2408, 7224, 4);
+INSERT INTO orders VALUES (2409, 7227, 17);
+INSERT INTO orders VALUES (2410, 7230, 30);
+INSERT INTO orders VALUES (2411, 7233, 43);
+INSERT INTO orders VALUES (2412, 7236, 56);
+INSERT INTO orders VALUES (2413, 7239, 69);
+INSERT INTO orders VALUES (2414, 7242, 82);
+INSERT INTO orders VALUES (2415, 7245, 95);
+INSERT INTO orders VALUES (2416, 7248, 8);
+INSERT INTO orders VALUES (2417, 7251, 21);
+INSERT INTO orders VALUES (2418, 7254, 34);
+INSERT INTO orders VALUES (2419, 7257, 47);
+INSERT INTO orders VALUES (2420, 7260, 60);
+INSERT INTO orders VALUES (2421, 7263, 73);
+INSERT INTO orders VALUES (2422, 7266, 86);
+INSERT INTO orders VALUES (2423, 7269, 99);
+INSERT INTO orders VALUES (2424, 7272, 12);
+INSERT INTO orders VALUES (2425, 7275, 25);
+INSERT INTO orders VALUES (2426, 7278, 38);
+INSERT INTO orders VALUES (2427, 7281, 51);
+INSERT INTO orders VALUES (2428, 7284, 64);
+INSERT INTO orders VALUES (2429, 7287, 77);
+INSERT INTO orders VALUES (2430, 7290, 90);
+INSERT INTO orders VALUES (2431, 7293, 3);
+INSERT INTO orders VALUES (2432, 7296, 16);
+INSERT INTO orders VALUES (2433, 7299, 29);
+INSERT INTO orders VALUES (2434, 7302, 42);
+INSERT INTO orders VALUES (2435, 7305, 55);
+INSERT INTO orders VALUES (2436, 7308, 68);
+INSERT INTO orders VALUES (2437, 7311, 81);
+INSERT INTO orders VALUES (2438, 7314, 94);
+INSERT INTO orders VALUES (2439, 7317, 7);
+INSERT INTO orders VALUES (2440, 7320, 20);
+INSERT INTO orders VALUES (2441, 7323, 33);
+INSERT INTO orders VALUES (2442, 7326, 46);
+INSERT INTO orders VALUES (2443, 7329, 59);
+INSERT INTO orders VALUES (2444, 7332, 72);
+INSERT INTO orders VALUES (2445, 7335, 85);
+INSERT INTO orders VALUES (2446, 7338, 98);
+INSERT INTO orders VALUES (2447, 7341, 11);
+INSERT INTO orders VALUES (2448, 7344, 24);
+INSERT INTO orders VALUES (2449, 7347, 37);
+INSERT INTO orders VALUES (2450, 7350, 50);
+INSERT INTO orders VALUES (2451, 7353, 63);
+INSERT INTO orders VALUES (2452, 7356, 76);
+INSERT INTO orders VALUES (2453, 7359, 89);
+INSERT INTO orders VALUES (2454, 7362, 2);
+INSERT INTO orders VALUES (2455, 7365, 15);
+INSERT INTO orders VALUES (2456, 7368, 28);
+INSERT INTO orders VALUES (2457, 7371, 41);
+INSERT INTO orders VALUES (2458, 7374, 54);
+INSERT INTO orders VALUES (2459, 7377, 67);
+INSERT INTO orders VALUES (2460, 7380, 80);
+INSERT INTO orders VALUES (2461, 7383, 93);
+INSERT INTO orders VALUES (2462, 7386, 6);
+INSERT INTO orders VALUES (2463, 7389, 19);
+INSERT INTO orders VALUES (2464, 7392, 32);
+INSERT INTO orders VALUES (2465, 7395, 45);
+INSERT INTO orders VALUES (2466, 7398, 58);
+INSERT INTO orders VALUES (2467, 7401, 71);
+INSERT INTO orders VALUES (2468, 7404, 84);
+INSERT INTO orders VALUES (2469, 7407, 97);
+INSERT INTO orders VALUES (2470, 7410, 10);
+INSERT INTO orders VALUES (2471, 7413, 23);
+INSERT INTO orders VALUES (2472, 7416, 36);
+INSERT INTO orders VALUES (2473, 7419, 49);
+INSERT INTO orders VALUES (2474, 7422, 62);
+INSERT INTO orders VALUES (2475, 7425, 75);
+INSERT INTO orders VALUES (2476, 7428, 88);
+INSERT INTO orders VALUES (2477, 7431, 1);
+INSERT INTO orders VALUES (2478, 7434, 14);
+INSERT INTO orders VALUES (2479, 7437, 27);
+INSERT INTO orders VALUES (2480, 7440, 40);
+INSERT INTO orders VALUES (2481, 7443, 53);
+INSERT INTO orders VALUES (2482, 7446, 66);
+INSERT INTO orders VALUES (2483, 7449, 79);
+INSERT INTO orders VALUES (2484, 7452, 92);
+INSERT INTO orders VALUES (2485, 7455, 5);
+INSERT INTO orders VALUES (2486, 7458, 18);
+INSERT INTO orders VALUES (2487, 7461, 31);
+INSERT INTO orders VALUES (2488, 7464, 44);
+INSERT INTO orders VALUES (2489, 7467, 57);
+INSERT INTO orders VALUES (2490, 7470, 70);
+INSERT INTO orders VALUES (2491, 7473, 83);
+INSERT INTO orders VALUES (2492, 7476, 96);
+INSERT INTO orders VALUES (2493, 7479, 9);
+INSERT INTO orders VALUES (2494, 7482, 22);
+INSERT INTO orders VALUES (2495, 7485, 35);
+INSERT INTO orders VALUES (2496, 7488, 48);
+INSERT INTO orders VALUES (2497, 7491, 61);
+INSERT INTO orders VALUES (2498, 7494, 74);
+INSERT INTO orders VALUES (2499, 7497, 87);
+INSERT INTO orders VALUES (2500, 7500, 0);
+INSERT INTO orders VALUES (2501, 7503, 13);
+INSERT INTO orders VALUES (2502, 7506, 26);
+INSERT INTO orders VALUES (2503, 7509, 39);
+INSERT INTO orders VALUES (2504, 7512, 52);
+INSERT INTO orders VALUES (2505, 7515, 65);
+INSERT INTO orders VALUES (2506, 7518, 78);
+INSERT INTO orders VALUES (2507, 7521, 91);
+INSERT INTO orders VALUES (2508, 7524, 4);
+INSERT INTO orders VALUES (2509, 7527, 17);
+INSERT INTO orders VALUES (2510, 7530, 30);
+INSERT INTO orders VALUES (2511, 7533, 43);
+INSERT INTO orders VALUES (2512, 7536, 56);
+INSERT INTO orders VALUES (2513, 7539, 69);
+INSERT INTO orders VALUES (2514, 7542, 82);
+INSERT INTO orders VALUES (2515, 7545, 95);
+INSERT INTO orders VALUES (2516, 7548, 8);
+INSERT INTO orders VALUES (2517, 7551, 21);
+INSERT INTO orders VALUES (2518, 7554, 34);
+INSERT INTO orders VALUES (2519, 7557, 47);
+INSERT INTO orders VALUES (2520, 7560, 60);
+INSERT INTO orders VALUES (2521, 7563, 73);
+INSERT INTO orders VALUES (2522, 7566, 86);
+INSERT INTO orders VALUES (2523, 7569, 99);
+INSERT INTO orders VALUES (2524, 7572, 12);
+INSERT INTO orders VALUES (2525, 7575, 25);
+INSERT INTO orders VALUES (2526, 7578, 38);
+INSERT INTO orders VALUES (2527, 7581, 51);
+INSERT INTO orders VALUES (2528, 7584, 64);
+INSERT INTO orders VALUES (2529, 7587, 77);
+INSERT INTO orders VALUES (2530, 7590, 90);
+INSERT INTO orders VALUES (2531, 7593, 3);
+INSERT INTO orders VALUES (2532, 7596, 16);
+INSERT INTO orders VALUES (2533, 7599, 29);
+INSERT INTO orders VALUES (2534, 7602, 42);
+INSERT INTO orders VALUES (2535, 7605, 55);
+INSERT INTO orders VALUES (2536, 7608, 68);
+INSERT INTO orders VALUES (2537, 7611, 81);
+INSERT INTO orders VALUES (2538, 7614, 94);
+INSERT INTO orders VALUES (2539, 7617, 7);
+INSERT INTO orders VALUES (2540, 7620, 20);
+INSERT INTO orders VALUES (2541, 7623, 33);
+INSERT INTO orders VALUES (2542, 7626, 46);
+INSERT INTO orders VALUES (2543, 7629, 59);
+INSERT INTO orders VALUES (2544, 7632, 72);
+INSERT INTO orders VALUES (2545, 7635, 85);
+INSERT INTO orders VALUES (2546, 7638, 98);
+INSERT INTO orders VALUES (2547, 7641, 11);
+INSERT INTO orders VALUES (2548, 7644, 24);
+INSERT INTO orders VALUES (2549, 7647, 37);
+INSERT INTO orders VALUES (2550, 7650, 50);
+INSERT INTO orders VALUES (2551, 7653, 63);
+INSERT INTO orders VALUES (2552, 7656, 76);
+INSERT INTO orders VALUES (2553, 7659, 89);
+INSERT INTO orders VALUES (2554, 7662, 2);
+INSERT INTO orders VALUES (2555, 7665, 15);
+INSERT INTO orders VALUES (2556, 7668, 28);
+INSERT INTO orders VALUES (2557, 7671, 41);
+INSERT INTO orders VALUES (2558, 7674, 54);
+INSERT INTO orders VALUES (2559, 7677, 67);
+INSERT INTO orders VALUES (2560, 7680, 80);
+INSERT INTO orders VALUES (2561, 7683, 93);
+INSERT INTO orders VALUES (2562, 7686, 6);
+INSERT INTO orders VALUES (2563, 7689, 19);
+INSERT INTO orders VALUES (2564, 7692, 32);
+INSERT INTO orders VALUES (2565, 7695, 45);
+INSERT INTO orders VALUES (2566, 7698, 58);
+INSERT INTO orders VALUES (2567, 7701, 71);
+INSERT INTO orders VALUES (2568, 7704, 84);
+INSERT INTO orders VALUES (2569, 7707, 97);
+INSERT INTO orders VALUES (2570, 7710, 10);
+INSERT INTO orders VALUES (2571, 7713, 23);
+INSERT INTO orders VALUES (2572, 7716, 36);
+INSERT INTO orders VALUES (2573, 7719, 49);
+INSERT INTO orders VALUES (2574, 7722, 62);
+INSERT INTO orders VALUES (2575, 7725, 75);
+INSERT INTO orders VALUES (2576, 7728, 88);
+INSERT INTO orders VALUES (2577, 7731, 1);
+INSERT INTO orders VALUES (2578, 7734, 14);
+INSERT INTO orders VALUES (2579, 7737, 27);
+INSERT INTO orders VALUES (2580, 7740, 40);
+INSERT INTO orders VALUES (2581, 7743, 53);
+INSERT INTO orders VALUES (2582, 7746, 66);
+INSERT INTO orders VALUES (2583, 7749, 79);
+INSERT INTO orders VALUES (2584, 7752, 92);
+INSERT INTO orders VALUES (2585, 7755, 5);
+INSERT INTO orders VALUES (2586, 7758, 18);
+INSERT INTO orders VALUES (2587, 7761, 31);
+INSERT INTO orders VALUES (2588, 7764, 44);
+INSERT INTO orders VALUES (2589, 7767, 57);
+INSERT INTO orders VALUES (2590, 7770, 70);
+INSERT INTO orders VALUES (2591, 7773, 83);
+INSERT INTO orders VALUES (2592, 7776, 96);
+INSERT INTO orders VALUES (2593, 7779, 9);
+INSERT INTO orders VALUES (2594, 7782, 22);
+INSERT INTO orders VALUES (2595, 7785, 35);
+INSERT INTO orders VALUES (2596, 7788, 48);
+INSERT INTO orders VALUES (2597, 7791, 61);
+INSERT INTO orders VALUES (2598, 7794, 74);
+INSERT INTO orders VALUES (2599, 7797, 87);
+INSERT INTO orders VALUES (2600, 7800, 0);
+INSERT INTO orders VALUES (2601, 7803, 13);
+INSERT INTO orders VALUES (2602, 7806, 26);
+INSERT INTO orders VALUES (2603, 7809, 39);
+INSERT INTO orders VALUES (2604, 7812, 52);
+INSERT INTO orders VALUES (2605, 7815, 65);
+INSERT INTO orders VALUES (2606, 7818, 78);
+INSERT INTO orders VALUES (2607, 7821, 91);
+INSERT INTO orders VALUES (2608, 7824, 4);
+INSERT INTO orders VALUES (2609, 7827, 17);
+INSERT INTO orders VALUES (2610, 7830, 30);
+INSERT INTO orders VALUES (2611, 7833, 43);
+INSERT INTO orders VALUES (2612, 7836, 56);
+INSERT INTO orders VALUES (2613, 7839, 69);
+INSERT INTO orders VALUES (2614, 7842, 82);
+INSERT INTO orders VALUES (2615, 7845, 95);
+INSERT INTO orders VALUES (2616, 7848, 8);
+INSERT INTO orders VALUES (2617, 7851, 21);
+INSERT INTO orders VALUES (2618, 7854, 34);
+INSERT INTO orders VALUES (2619, 7857, 47);
+INSERT INTO orders VALUES (2620, 7860, 60);
+INSERT INTO orders VALUES (2621, 7863, 73);
+INSERT INTO orders VALUES (2622, 7866, 86);
+INSERT INTO orders VALUES (2623, 7869, 99);
+INSERT INTO orders VALUES (2624, 7872, 12);
+INSERT INTO orders VALUES (2625, 7875, 25);
+INSERT INTO orders VALUES (2626, 7878, 38);
+INSERT INTO orders VALUES (2627, 7881, 51);
+INSERT INTO orders VALUES (2628, 7884, 64);
+INSERT INTO orders VALUES (2629, 7887, 77);
+INSERT INTO orders VALUES (2630, 7890, 90);
+INSERT INTO orders VALUES (2631, 7893, 3);
+INSERT INTO orders VALUES (2632, 7896, 16);
+INSERT INTO orders VALUES (2633, 7899, 29);
+INSERT INTO orders VALUES (2634, 7902, 42);
+INSERT INTO orders VALUES (2635, 7905, 55);
+INSERT INTO orders VALUES (2636, 7908, 68);
+INSERT INTO orders VALUES (2637, 7911, 81);
+INSERT INTO orders VALUES (2638, 7914, 94);
+INSERT INTO orders VALUES (2639, 7917, 7);
+INSERT INTO orders VALUES (2640, 7920, 20);
+INSERT INTO orders VALUES (2641, 7923, 33);
+INSERT INTO orders VALUES (2642, 7926, 46);
+INSERT INTO orders VALUES (2643, 7929, 59);
+INSERT INTO orders VALUES (2644, 7932, 72);
+INSERT INTO orders VALUES (2645, 7935, 85);
+INSERT INTO orders VALUES (2646, 7938, 98);
+INSERT INTO orders VALUES (2647, 7941, 11);
+INSERT INTO orders VALUES (2648, 7944, 24);
+INSERT INTO orders VALUES (2649, 7947, 37);
+INSERT INTO orders VALUES (2650, 7950, 50);
+INSERT INTO orders VALUES (2651, 7953, 63);
+INSERT INTO orders VALUES (2652, 7956, 76);
+INSERT INTO orders VALUES (2653, 7959, 89);
+INSERT INTO orders VALUES (2654, 7962, 2);
+INSERT INTO orders VALUES (2655, 7965, 15);
+INSERT INTO orders VALUES (2656, 7968, 28);
+INSERT INTO orders VALUES (2657, 7971, 41);
+INSERT INTO orders VALUES (2658, 7974, 54);
+INSERT INTO orders VALUES (2659, 7977, 67);
+INSERT INTO orders VALUES (2660, 7980, 80);
+INSERT INTO orders VALUES (2661, 7983, 93);
+INSERT INTO orders VALUES (2662, 7986, 6);
+INSERT INTO orders VALUES (2663, 7989, 19);
+INSERT INTO orders VALUES (2664, 7992, 32);
+INSERT INTO orders VALUES (2665, 7995, 45);
+INSERT INTO orders VALUES (2666, 7998, 58);
+INSERT INTO orders VALUES (2667, 8001, 71);
+INSERT INTO orders VALUES (2668, 8004, 84);
+INSERT INTO orders VALUES (2669, 8007, 97);
+INSERT INTO orders VALUES (2670, 8010, 10);
+INSERT INTO orders VALUES (2671, 8013, 23);
+INSERT INTO orders VALUES (2672, 8016, 36);
+INSERT INTO orders VALUES (2673, 8019, 49);
+INSERT INTO orders VALUES (2674, 8022, 62);
+INSERT INTO orders VALUES (2675, 8025, 75);
+INSERT INTO orders VALUES (2676, 8028, 88);
+INSERT INTO orders VALUES (2677, 8031, 1);
+INSERT INTO orders VALUES (2678, 8034, 14);
+INSERT INTO orders VALUES (2679, 8037, 27);
+INSERT INTO orders VALUES (2680, 8040, 40);
+INSERT INTO orders VALUES (2681, 8043, 53);
+INSERT INTO orders VALUES (2682, 8046, 66);
+INSERT INTO orders VALUES (2683, 8049, 79);
+INSERT INTO orders VALUES (2684, 8052, 92);
+INSERT INTO orders VALUES (2685, 8055, 5);
+INSERT INTO orders VALUES (2686, 8058, 18);
+INSERT INTO orders VALUES (2687, 8061, 31);
+INSERT INTO orders VALUES (2688, 8064, 44);
+INSERT INTO orders VALUES (2689, 8067, 57);
+INSERT INTO orders VALUES (2690, 8070, 70);
+INSERT INTO orders VALUES (2691, 8073, 83);
+INSERT INTO orders VALUES (2692, 8076, 96);
+INSERT INTO orders VALUES (2693, 8079, 9);
+INSERT INTO orders VALUES (2694, 8082, 22);
+INSERT INTO orders VALUES (2695, 8085, 35);
+INSERT INTO orders VALUES (2696, 8088, 48);
+INSERT INTO orders VALUES (2697, 8091, 61);
+INSERT INTO orders VALUES (2698, 8094, 74);
+INSERT INTO orders VALUES (2699, 8097, 87);
+INSERT INTO orders VALUES (2700, 8100, 0);
+INSERT INTO orders VALUES (2701, 8103, 13);
+INSERT INTO orders VALUES (2702, 8106, 26);
+INSERT INTO orders VALUES (2703, 8109, 39);
+INSERT INTO orders VALUES (2704, 8112, 52);
+INSERT INTO orders VALUES (2705, 8115, 65);
+INSERT INTO orders VALUES (2706, 8118, 78);
+INSERT INTO orders VALUES (2707, 8121, 91);
+INSERT INTO orders VALUES (2708, 8124, 4);
+INSERT INTO orders VALUES (2709, 8127, 17);
+INSERT INTO orders VALUES (2710, 8130, 30);
+INSERT INTO orders VALUES (2711, 8133, 43);
+INSERT INTO orders VALUES (2712, 8136, 56);
+INSERT INTO orders VALUES (2713, 8139, 69);
+INSERT INTO orders VALUES (2714, 8142, 82);
+INSERT INTO orders VALUES (2715, 8145, 95);
+INSERT INTO orders VALUES (2716, 8148, 8);
+INSERT INTO orders VALUES (2717, 8151, 21);
+INSERT INTO orders VALUES (2718, 8154, 34);
+INSERT INTO orders VALUES (2719, 8157, 47);
+INSERT INTO orders VALUES (2720, 8160, 60);
+INSERT INTO orders VALUES (2721, 8163, 73);
+INSERT INTO orders VALUES (2722, 8166, 86);
+INSERT INTO orders VALUES (2723, 8169, 99);
+INSERT INTO orders VALUES (2724, 8172, 12);
+INSERT INTO orders VALUES (2725, 8175, 25);
+INSERT INTO orders VALUES (2726, 8178, 38);
+INSERT INTO orders VALUES (2727, 8181, 51);
+INSERT INTO orders VALUES (2728, 8184, 64);
+INSERT INTO orders VALUES (2729, 8187, 77);
+INSERT INTO orders VALUES (2730, 8190, 90);
+INSERT INTO orders VALUES (2731, 1, 3);
+INSERT INTO orders VALUES (2732, 4, 16);
+INSERT INTO orders VALUES (2733, 7, 29);
+INSERT INTO orders VALUES (2734, 10, 42);
+INSERT INTO orders VALUES (2735, 13, 55);
+INSERT INTO orders VALUES (2736, 16, 68);
+INSERT INTO orders VALUES (2737, 19, 81);
+INSERT INTO orders VALUES (2738, 22, 94);
+INSERT INTO orders VALUES (2739, 25, 7);
+INSERT INTO orders VALUES (2740, 28, 20);
+INSERT INTO orders VALUES (2741, 31, 33);
+INSERT INTO orders VALUES (2742, 34, 46);
+INSERT INTO orders VALUES (2743, 37, 59);
+INSERT INTO orders VALUES (2744, 40, 72);
+INSERT INTO orders VALUES (2745, 43, 85);
+INSERT INTO orders VALUES (2746, 46, 98);
+INSERT INTO orders VALUES (2747, 49, 11);
+INSERT INTO orders VALUES (2748, 52, 24);
+INSERT INTO orders VALUES (2749, 55, 37);
+INSERT INTO orders VALUES (2750, 58, 50);
+INSERT INTO orders VALUES (2751, 61, 63);
+INSERT INTO orders VALUES (2752, 64, 76);
+INSERT INTO orders VALUES (2753, 67, 89);
+INSERT INTO orders VALUES (2754, 70, 2);
+INSERT INTO orders VALUES (2755, 73, 15);
+INSERT INTO orders VALUES (2756, 76, 28);
+INSERT INTO orders VALUES (2757, 79, 41);
+INSERT INTO orders VALUES (2758, 82, 54);
+INSERT INTO orders VALUES (2759, 85, 67);
+INSERT INTO orders VALUES (2760, 88, 80);
+INSERT INTO orders VALUES (2761, 91, 93);
+INSERT INTO orders VALUES (2762, 94, 6);
+INSERT INTO orders VALUES (2763, 97, 19);
+INSERT INTO orders VALUES (2764, 100, 32);
+INSERT INTO orders VALUES (2765, 103, 45);
+INSERT INTO orders VALUES (2766, 106, 58);
+INSERT INTO orders VALUES (2767, 109, 71);
+INSERT INTO orders VALUES (2768, 112, 84);
+INSERT INTO orders VALUES (2769, 115, 97);
+INSERT INTO orders VALUES (2770, 118, 10);
+INSERT INTO orders VALUES (2771, 121, 23);
+INSERT INTO orders VALUES (2772, 124, 36);
+INSERT INTO orders VALUES (2773, 127, 49);
+INSERT INTO orders VALUES (2774, 130, 62);
+INSERT INTO orders VALUES (2775, 133, 75);
+INSERT INTO orders VALUES (2776, 136, 88);
+INSERT INTO orders VALUES (2777, 139, 1);
+INSERT INTO orders VALUES (2778, 142, 14);
+INSERT INTO orders VALUES (2779, 145, 27);
+INSERT INTO orders VALUES (2780, 148, 40);
+INSERT INTO orders VALUES (2781, 151, 53);
+INSERT INTO orders VALUES (2782, 154, 66);
+INSERT INTO orders VALUES (2783, 157, 79);
+INSERT INTO orders VALUES (2784, 160, 92);
+INSERT INTO orders VALUES (2785, 163, 5);
+INSERT INTO orders VALUES (2786, 166, 18);
+INSERT INTO orders VALUES (2787, 169, 31);
+INSERT INTO orders VALUES (2788, 172, 44);
+INSERT INTO orders VALUES (2789, 175, 57);
+INSERT INTO orders VALUES (2790, 178, 70);
+INSERT INTO orders VALUES (2791, 181, 83);
+INSERT INTO orders VALUES (2792, 184, 96);
+INSERT INTO orders VALUES (2793, 187, 9);
+INSERT INTO orders VALUES (2794, 190, 22);
+INSERT INTO orders VALUES (2795, 193, 35);
+INSERT INTO orders VALUES (2796, 196, 48);
+INSERT INTO orders VALUES (2797, 199, 61);
+INSERT INTO orders VALUES (2798, 202, 74);
+INSERT INTO orders VALUES (2799, 205, 87);
+INSERT INTO orders VALUES (2800, 208, 0);
+INSERT INTO orders VALUES (2801, 211, 13);
+INSERT INTO orders VALUES (2802, 214, 26);
+INSERT INTO orders VALUES (2803, 217, 39);
+INSERT INTO orders VALUES (2804, 220, 52);
+INSERT INTO orders VALUES (2805, 223, 65);
+INSERT INTO orders VALUES (2806, 226, 78);
+INSERT INTO orders VALUES (2807, 229, 91);
+INSERT INTO orders VALUES (2808, 232, 4);
+INSERT INTO orders VALUES (2809, 235, 17);
+INSERT INTO orders VALUES (2810, 238, 30);
+INSERT INTO orders VALUES (2811, 241, 43);
+INSERT INTO orders VALUES (2812, 244, 56);
+INSERT INTO orders VALUES (2813, 247, 69);
+INSERT INTO orders VALUES (2814, 250, 82);
+INSERT INTO orders VALUES (2815, 253, 95);
+INSERT INTO orders VALUES (2816, 256, 8);
+INSERT INTO orders VALUES (2817, 259, 21);
+INSERT INTO orders VALUES (2818, 262, 34);
+INSERT INTO orders VALUES (2819, 265, 47);
+INSERT INTO orders VALUES (2820, 268, 60);
+INSERT INTO orders VALUES (2821, 271, 73);
+INSERT INTO orders VALUES (2822, 274, 86);
+INSERT INTO orders VALUES (2823, 277, 99);
+INSERT INTO orders VALUES (2824, 280, 12);
+INSERT INTO orders VALUES (2825, 283, 25);
+INSERT INTO orders VALUES (2826, 286, 38);
+INSERT INTO orders VALUES (2827, 289, 51);
+INSERT INTO orders VALUES (2828, 292, 64);
+INSERT INTO orders VALUES (2829, 295, 77);
+INSERT INTO orders VALUES (2830, 298, 90);
+INSERT INTO orders VALUES (2831, 301, 3);
+INSERT INTO orders VALUES (2832, 304, 16);
+INSERT INTO orders VALUES (2833, 307, 29);
+INSERT INTO orders VALUES (2834, 310, 42);
+INSERT INTO orders VALUES (2835, 313, 55);
+INSERT INTO orders VALUES (2836, 316, 68);
+INSERT INTO orders VALUES (2837, 319, 81);
+INSERT INTO orders VALUES (2838, 322, 94);
+INSERT INTO orders VALUES (2839, 325, 7);
+INSERT INTO orders VALUES (2840, 328, 20);
+INSERT INTO orders VALUES (2841, 331, 33);
+INSERT INTO orders VALUES (2842, 334, 46);
+INSERT INTO orders VALUES (2843, 337, 59);
+INSERT INTO orders VALUES (2844, 340, 72);
+INSERT INTO orders VALUES (2845, 343, 85);
+INSERT INTO orders VALUES (2846, 346, 98);
+INSERT INTO orders VALUES (2847, 349, 11);
+INSERT INTO orders VALUES (2848, 352, 24);
+INSERT INTO orders VALUES (2849, 355, 37);
+INSERT INTO orders VALUES (2850, 358, 50);
+INSERT INTO orders VALUES (2851, 361, 63);
+INSERT INTO orders VALUES (2852, 364, 76);
+INSERT INTO orders VALUES (2853, 367, 89);
+INSERT INTO orders VALUES (2854, 370, 2);
+INSERT INTO orders VALUES (2855, 373, 15);
+INSERT INTO orders VALUES (2856, 376, 28);
+INSERT INTO orders VALUES (2857, 379, 41);
+INSERT INTO orders VALUES (2858, 382, 54);
+INSERT INTO orders VALUES (2859, 385, 67);
+INSERT INTO orders VALUES (2860, 388, 80);
+INSERT INTO orders VALUES (2861, 391, 93);
+INSERT INTO orders VALUES (2862, 394, 6);
+INSERT INTO orders VALUES (2863, 397, 19);
+INSERT INTO orders VALUES (2864, 400, 32);
+INSERT INTO orders VALUES (2865, 403, 45);
+INSERT INTO orders VALUES (2866, 406, 58);
+INSERT INTO orders VALUES (2867, 409, 71);
+INSERT INTO orders VALUES (2868, 412, 84);
+INSERT INTO orders VALUES (2869, 415, 97);
+INSERT INTO orders VALUES (2870, 418, 10);
+INSERT INTO orders VALUES (2871, 421, 23);
+INSERT INTO orders VALUES (2872, 424, 36);
+INSERT INTO orders VALUES (2873, 427, 49);
+INSERT INTO orders VALUES (2874, 430, 62);
+INSERT INTO orders VALUES (2875, 433, 75);
+INSERT INTO orders VALUES (2876, 436, 88);
+INSERT INTO orders VALUES (2877, 439, 1);
+INSERT INTO orders VALUES (2878, 442, 14);
+INSERT INTO orders VALUES (2879, 445, 27);
+INSERT INTO orders VALUES (2880, 448, 40);
+INSERT INTO orders VALUES (2881, 451, 53);
+INSERT INTO orders VALUES (2882, 454, 66);
+INSERT INTO orders VALUES (2883, 457, 79);
+INSERT INTO orders VALUES (2884, 460, 92);
+INSERT INTO orders VALUES (2885, 463, 5);
+INSERT INTO orders VALUES (2886, 466, 18);
+INSERT INTO orders VALUES (2887, 469, 31);
+INSERT INTO orders VALUES (2888, 472, 44);
+INSERT INTO orders VALUES (2889, 475, 57);
+INSERT INTO orders VALUES (2890, 478, 70);
+INSERT INTO orders VALUES (2891, 481, 83);
+INSERT INTO orders VALUES (2892, 484, 96);
+INSERT INTO orders VALUES (2893, 487, 9);
+INSERT INTO orders VALUES (2894, 490, 22);
+INSERT INTO orders VALUES (2895, 493, 35);
+INSERT INTO orders VALUES (2896, 496, 48);
+INSERT INTO orders VALUES (2897, 499, 61);
+INSERT INTO orders VALUES (2898, 502, 74);
+INSERT INTO orders VALUES (2899, 505, 87);
+INSERT INTO orders VALUES (2900, 508, 0);
+INSERT INTO orders VALUES (2901, 511, 13);
+INSERT INTO orders VALUES (2902, 514, 26);
+INSERT INTO orders VALUES (2903, 517, 39);
+INSERT INTO orders VALUES (2904, 520, 52);
+INSERT INTO orders VALUES (2905, 523, 65);
+INSERT INTO orders VALUES (2906, 526, 78);
+INSERT INTO orders VALUES (2907, 529, 91);
+INSERT INTO orders VALUES (2908, 532, 4);
+INSERT INTO orders VALUES (2909, 535, 17);
+INSERT INTO orders VALUES (2910, 538, 30);
+INSERT INTO orders VALUES (2911, 541, 43);
+INSERT INTO orders VALUES (2912, 544, 56);
+INSERT INTO orders VALUES (2913, 547, 69);
+INSERT INTO orders VALUES (2914, 550, 82);
+INSERT INTO orders VALUES (2915, 553, 95);
+INSERT INTO orders VALUES (2916, 556, 8);
+INSERT INTO orders VALUES (2917, 559, 21);
+INSERT INTO orders VALUES (2918, 562, 34);
+INSERT INTO orders VALUES (2919, 565, 47);
+INSERT INTO orders VALUES (2920, 568, 60);
+INSERT INTO orders VALUES (2921, 571, 73);
+INSERT INTO orders VALUES (2922, 574, 86);
+INSERT INTO orders VALUES (2923, 577, 99);
+INSERT INTO orders VALUES (2924, 580, 12);
+INSERT INTO orders VALUES (2925, 583, 25);
+INSERT INTO orders VALUES (2926, 586, 38);
+INSERT INTO orders VALUES (2927, 589, 51);
+INSERT INTO orders VALUES (2928, 592, 64);
+INSERT INTO orders VALUES (2929, 595, 77);
+INSERT INTO orders VALUES (2930, 598, 90);
+INSERT INTO orders VALUES (2931, 601, 3);
+INSERT INTO orders VALUES (2932, 604, 16);
+INSERT INTO orders VALUES (2933, 607, 29);
+INSERT INTO orders VALUES (2934, 610, 42);
+INSERT INTO orders VALUES (2935, 613, 55);
+INSERT INTO orders VALUES (2936, 616, 68);
+INSERT INTO orders VALUES (2937, 619, 81);
+INSERT INTO orders VALUES (2938, 622, 94);
+INSERT INTO orders VALUES (2939, 625, 7);
+INSERT INTO orders VALUES (2940, 628, 20);
+INSERT INTO orders VALUES (2941, 631, 33);
+INSERT INTO orders VALUES (2942, 634, 46);
+INSERT INTO orders VALUES (2943, 637, 59);
+INSERT INTO orders VALUES (2944, 640, 72);
+INSERT INTO orders VALUES (2945, 643, 85);
+INSERT INTO orders VALUES (2946, 646, 98);
+INSERT INTO orders VALUES (2947, 649, 11);
+INSERT INTO orders VALUES (2948, 652, 24);
+INSERT INTO orders VALUES (2949, 655, 37);
+INSERT INTO orders VALUES (2950, 658, 50);
+INSERT INTO orders VALUES (2951, 661, 63);
+INSERT INTO orders VALUES (2952, 664, 76);
+INSERT INTO orders VALUES (2953, 667, 89);
+INSERT INTO orders VALUES (2954, 670, 2);
+INSERT INTO orders VALUES (2955, 673, 15);
+INSERT INTO orders VALUES (2956, 676, 28);
+INSERT INTO orders VALUES (2957, 679, 41);
+INSERT INTO orders VALUES (2958, 682, 54);
+INSERT INTO orders VALUES (2959, 685, 67);
+INSERT INTO orders VALUES (2960, 688, 80);
+INSERT INTO orders VALUES (2961, 691, 93);
+INSERT INTO orders VALUES (2962, 694, 6);
+INSERT INTO orders VALUES (2963, 697, 19);
+INSERT INTO orders VALUES (2964, 700, 32);
+INSERT INTO orders VALUES (2965, 703, 45);
+INSERT INTO orders VALUES (2966, 706, 58);
+INSERT INTO orders VALUES (2967, 709, 71);
+INSERT INTO orders VALUES (2968, 712, 84);
+INSERT INTO orders VALUES (2969, 715, 97);
+INSERT INTO orders VALUES (2970, 718, 10);
+INSERT INTO orders VALUES (2971, 721, 23);
+INSERT INTO orders VALUES (2972, 724, 36);
+INSERT INTO orders VALUES (2973, 727, 49);
+INSERT INTO orders VALUES (2974, 730, 62);
+INSERT INTO orders VALUES (2975, 733, 75);
+INSERT INTO orders VALUES (2976, 736, 88);
+INSERT INTO orders VALUES (2977, 739, 1);
+INSERT INTO orders VALUES (2978, 742, 14);
+INSERT INTO orders VALUES (2979, 745, 27);
+INSERT INTO orders VALUES (2980, 748, 40);
+INSERT INTO orders VALUES (2981, 751, 53);
+INSERT INTO orders VALUES (2982, 754, 66);
+INSERT INTO orders VALUES (2983, 757, 79);
+INSERT INTO orders VALUES (2984, 760, 92);
+INSERT INTO orders VALUES (2985, 763, 5);
+INSERT INTO orders VALUES (2986, 766, 18);
+INSERT INTO orders VALUES (2987, 769, 31);
+INSERT INTO orders VALUES (2988, 772, 44);
+INSERT INTO orders VALUES (2989, 775, 57);
+INSERT INTO orders VALUES (2990, 778, 70);
+INSERT INTO orders VALUES (2991, 781, 83);
+INSERT INTO orders VALUES (2992, 784, 96);
+INSERT INTO orders VALUES (2993, 787, 9);
+INSERT INTO orders VALUES (2994, 790, 22);
+INSERT INTO orders VALUES (2995, 793, 35);
+INSERT INTO orders VALUES (2996, 796, 48);
+INSERT INTO orders VALUES (2997, 799, 61);
+INSERT INTO orders VALUES (2998, 802, 74);
+INSERT INTO orders VALUES (2999, 805, 87);
+INSERT INTO orders VALUES (3000, 808, 0);
+INSERT INTO orders VALUES (3001, 811, 13);
+INSERT INTO orders VALUES (3002, 814, 26);
+INSERT INTO orders VALUES (3003, 817, 39);
+INSERT INTO orders VALUES (3004, 820, 52);
+INSERT INTO orders VALUES (3005, 823, 65);
+INSERT INTO orders VALUES (3006, 826, 78);
+INSERT INTO orders VALUES (3007, 829, 91);
+INSERT INTO orders VALUES (3008, 832, 4);
+INSERT INTO orders VALUES (3009, 835, 17);
+INSERT INTO orders VALUES (3010, 838, 30);
+INSERT INTO orders VALUES (3011, 841, 43);
+INSERT INTO orders VALUES (3012, 844, 56);
+INSERT INTO orders VALUES (3013, 847, 69);
+INSERT INTO orders VALUES (3014, 850, 82);
+INSERT INTO orders VALUES (3015, 853, 95);
+INSERT INTO orders VALUES (3016, 856, 8);
+INSERT INTO orders VALUES (3017, 859, 21);
+INSERT INTO orders VALUES (3018, 862, 34);
+INSERT INTO orders VALUES (3019, 865, 47);
+INSERT INTO orders VALUES (3020, 868, 60);
+INSERT INTO orders VALUES (3021, 871, 73);
+INSERT INTO orders VALUES (3022, 874, 86);
+INSERT INTO orders VALUES (3023, 877, 99);
+INSERT INTO orders VALUES (3024, 880, 12);
+INSERT INTO orders VALUES (3025, 883, 25);
+INSERT INTO orders VALUES (3026, 886, 38);
+INSERT INTO orders VALUES (3027, 889, 51);
+INSERT INTO orders VALUES (3028, 892, 64);
+INSERT INTO orders VALUES (3029, 895, 77);
+INSERT INTO orders VALUES (3030, 898, 90);
+INSERT INTO orders VALUES (3031, 901, 3);
+INSERT INTO orders VALUES (3032, 904, 16);
+INSERT INTO orders VALUES (3033, 907, 29);
+INSERT INTO orders VALUES (3034, 910, 42);
+INSERT INTO orders VALUES (3035, 913, 55);
+INSERT INTO orders VALUES (3036, 916, 68);
+INSERT INTO orders VALUES (3037, 919, 81);
+INSERT INTO orders VALUES (3038, 922, 94);
+INSERT INTO orders VALUES (3039, 925, 7);
+INSERT INTO orders VALUES (3040, 928, 20);
+INSERT INTO orders VALUES (3041, 931, 33);
+INSERT INTO orders VALUES (3042, 934, 46);
+INSERT INTO orders VALUES (3043, 937, 59);
+INSERT INTO orders VALUES (3044, 940, 72);
+INSERT INTO orders VALUES (3045, 943, 85);
+INSERT INTO orders VALUES (3046, 946, 98);
+INSERT INTO orders VALUES (3047, 949, 11);
+INSERT INTO orders VALUES (3048, 952, 24);
+INSERT INTO orders VALUES (3049, 955, 37);
+INSERT INTO orders VALUES (3050, 958, 50);
+INSERT INTO orders VALUES (3051, 961, 63);
+INSERT INTO orders VALUES (3052, 964, 76);
+INSERT INTO orders VALUES (3053, 967, 89);
+INSERT INTO orders VALUES (3054, 970, 2);
+INSERT INTO orders VALUES (3055, 973, 15);
+INSERT INTO orders VALUES (3056, 976, 28);
+INSERT INTO orders VALUES (3057, 979, 41);
+INSERT INTO orders VALUES (3058, 982, 54);
+INSERT INTO orders VALUES (3059, 985, 67);
+INSERT INTO orders VALUES (3060, 988, 80);
+INSERT INTO orders VALUES (3061, 991, 93);
+INSERT INTO orders VALUES (3062, 994, 6);
+INSERT INTO orders VALUES (3063, 997, 19);
+INSERT INTO orders VALUES (3064, 1000, 32);
+INSERT INTO orders VALUES (3065, 1003, 45);
+INSERT INTO orders VALUES (3066, 1006, 58);
+INSERT INTO orders VALUES (3067, 1009, 71);
+INSERT INTO orders VALUES (3068, 1012, 84);
+INSERT INTO orders VALUES (3069, 1015, 97);
+INSERT INTO orders VALUES (3070, 1018, 10);
+INSERT INTO orders VALUES (3071, 1021, 23);
+INSERT INTO orders VALUES (3072, 1024, 36);
+INSERT INTO orders VALUES (3073, 1027, 49);
+INSERT INTO orders VALUES (3074, 1030, 62);
+INSERT INTO orders VALUES (3075, 1033, 75);
+INSERT INTO orders VALUES (3076, 1036, 88);
+INSERT INTO orders VALUES (3077, 1039, 1);
+INSERT INTO orders VALUES (3078, 1042, 14);
+INSERT INTO orders VALUES (3079, 1045, 27);
+INSERT INTO orders VALUES (3080, 1048, 40);
+INSERT INTO orders VALUES (3081, 1051, 53);
+INSERT INTO orders VALUES (3082, 1054, 66);
+INSERT INTO orders VALUES (3083, 1057, 79);
+INSERT INTO orders VALUES (3084, 1060, 92);
+INSERT INTO orders VALUES (3085, 1063, 5);
+INSERT INTO orders VALUES (3086, 1066, 18);
+INSERT INTO orders VALUES (3087, 1069, 31);
+INSERT INTO orders VALUES (3088, 1072, 44);
+INSERT INTO orders VALUES (3089, 1075, 57);
+INSERT INTO orders VALUES (3090, 1078, 70);
+INSERT INTO orders VALUES (3091, 1081, 83);
+INSERT INTO orders VALUES (3092, 1084, 96);
+INSERT INTO orders VALUES (3093, 1087, 9);
+INSERT INTO orders VALUES (3094, 1090, 22);
+INSERT INTO orders VALUES (3095, 1093, 35);
+INSERT INTO orders VALUES (3096, 1096, 48);
+INSERT INTO orders VALUES (3097, 1099, 61);
+INSERT INTO orders VALUES (3098, 1102, 74);
+INSERT INTO orders VALUES (3099, 1105, 87);
+INSERT INTO orders VALUES (3100, 1108, 0);
+INSERT INTO orders VALUES (3101, 1111, 13);
+INSERT INTO orders VALUES (3102, 1114, 26);
+INSERT INTO orders VALUES (3103, 1117, 39);
+INSERT INTO orders VALUES (3104, 1120, 52);
+INSERT INTO orders VALUES (3105, 1123, 65);
+INSERT INTO orders VALUES (3106, 1126, 78);
+INSERT INTO orders VALUES (3107, 1129, 91);
+INSERT INTO orders VALUES (3108, 1132, 4);
+INSERT INTO orders VALUES (3109, 1135, 17);
+INSERT INTO orders VALUES (3110, 1138, 30);
+INSERT INTO orders VALUES (3111, 1141, 43);
+INSERT INTO orders VALUES (3112, 1144, 56);
+INSERT INTO orders VALUES (3113, 1147, 69);
+INSERT INTO orders VALUES (3114, 1150, 82);
+INSERT INTO orders VALUES (3115, 1153, 95);
+INSERT INTO orders VALUES (3116, 1156, 8);
+INSERT INTO orders VALUES (3117, 1159, 21);
+INSERT INTO orders VALUES (3118, 1162, 34);
+INSERT INTO orders VALUES (3119, 1165, 47);
+INSERT INTO orders VALUES (3120, 1168, 60);
+INSERT INTO orders VALUES (3121, 1171, 73);
+INSERT INTO orders VALUES (3122, 1174, 86);
+INSERT INTO orders VALUES (3123, 1177, 99);
+INSERT INTO orders VALUES (3124, 1180, 12);
+INSERT INTO orders VALUES (3125, 1183, 25);
+INSERT INTO orders VALUES (3126, 1186, 38);
+INSERT INTO orders VALUES (3127, 1189, 51);
+INSERT INTO orders VALUES (3128, 1192, 64);
+INSERT INTO orders VALUES (3129, 1195, 77);
+INSERT INTO orders VALUES (3130, 1198, 90);
+INSERT INTO orders VALUES (3131, 1201, 3);
+INSERT INTO orders VALUES (3132, 1204, 16);
+INSERT INTO orders VALUES (3133, 1207, 29);
+INSERT INTO orders VALUES (3134, 1210, 42);
+INSERT INTO orders VALUES (3135, 1213, 55);
+INSERT INTO orders VALUES (3136, 1216, 68);
+INSERT INTO orders VALUES (3137, 1219, 81);
+INSERT INTO orders VALUES (3138, 1222, 94);
+INSERT INTO orders VALUES (3139, 1225, 7);
+INSERT INTO orders VALUES (3140, 1228, 20);
+INSERT INTO orders VALUES (3141, 1231, 33);
+INSERT INTO orders VALUES (3142, 1234, 46);
+INSERT INTO orders VALUES (3143, 1237, 59);
+INSERT INTO orders VALUES (3144, 1240, 72);
+INSERT INTO orders VALUES (3145, 1243, 85);
+INSERT INTO orders VALUES (3146, 1246, 98);
+INSERT INTO orders VALUES (3147, 1249, 11);
+INSERT INTO orders VALUES (3148, 1252, 24);
+INSERT INTO orders VALUES (3149, 1255, 37);
+INSERT INTO orders VALUES (3150, 1258, 50);
+INSERT INTO orders VALUES (3151, 1261, 63);
+INSERT INTO orders VALUES (3152, 1264, 76);
+INSERT INTO orders VALUES (3153, 1267, 89);
+INSERT INTO orders VALUES (3154, 1270, 2);
+INSERT INTO orders VALUES (3155, 1273, 15);
+INSERT INTO orders VALUES (3156, 1276, 28);
+INSERT INTO orders VALUES (3157, 1279, 41);
+INSERT INTO orders VALUES (3158, 1282, 54);
+INSERT INTO orders VALUES (3159, 1285, 67);
+INSERT INTO orders VALUES (3160, 1288, 80);
+INSERT INTO orders VALUES (3161, 1291, 93);
+INSERT INTO orders VALUES (3162, 1294, 6);
+INSERT INTO orders VALUES (3163, 1297, 19);
+INSERT INTO orders VALUES (3164, 1300, 32);
+INSERT INTO orders VALUES (3165, 1303, 45);
+INSERT INTO orders VALUES (3166, 1306, 58);
+INSERT INTO orders VALUES (3167, 1309, 71);
+INSERT INTO orders VALUES (3168, 1312, 84);
+INSERT INTO orders VALUES (3169, 1315, 97);
+INSERT INTO orders VALUES (3170, 1318, 10);
+INSERT INTO orders VALUES (3171, 1321, 23);
+INSERT INTO orders VALUES (3172, 1324, 36);
+INSERT INTO orders VALUES (3173, 1327, 49);
+INSERT INTO orders VALUES (3174, 1330, 62);
+INSERT INTO orders VALUES (3175, 1333, 75);
+INSERT INTO orders VALUES (3176, 1336, 88);
+INSERT INTO orders VALUES (3177, 1339, 1);
+INSERT INTO orders VALUES (3178, 1342, 14);
+INSERT INTO orders VALUES (3179, 1345, 27);
+INSERT INTO orders VALUES (3180, 1348, 40);
+INSERT INTO orders VALUES (3181, 1351, 53);
+INSERT INTO orders VALUES (3182, 1354, 66);
+INSERT INTO orders VALUES (3183, 1357, 79);
+INSERT INTO orders VALUES (3184, 1360, 92);
+INSERT INTO orders VALUES (3185, 1363, 5);
+INSERT INTO orders VALUES (3186, 1366, 18);
+INSERT INTO orders VALUES (3187, 1369, 31);
+INSERT INTO orders VALUES (3188, 1372, 44);
+INSERT INTO orders VALUES (3189, 1375, 57);
+INSERT INTO orders VALUES (3190, 1378, 70);
+INSERT INTO orders VALUES (3191, 1381, 83);
+INSERT INTO orders VALUES (3192, 1384, 96);
+INSERT INTO orders VALUES (3193, 1387, 9);
+INSERT INTO orders VALUES (3194, 1390, 22);
+INSERT INTO orders VALUES (3195, 1393, 35);
+INSERT INTO orders VALUES (3196, 1396, 48);
+INSERT INTO orders VALUES (3197, 1399, 61);
+INSERT INTO orders VALUES (3198, 1402, 74);
+INSERT INTO orders VALUES (3199, 1405, 87);
+INSERT INTO orders VALUES (3200, 1408, 0);
+INSERT INTO orders VALUES (3201, 1411, 13);
+INSERT INTO orders VALUES (3202, 1414, 26);
+INSERT INTO orders VALUES (3203, 1417, 39);
+INSERT INTO orders VALUES (3204, 1420, 52);
+INSERT INTO orders VALUES (3205, 1423, 65);
+INSERT INTO orders VALUES (3206, 1426, 78);
+INSERT INTO orders VALUES (3207, 1429, 91);
+INSERT INTO orders VALUES (3208, 1432, 4);
+INSERT INTO orders VALUES (3209, 1435, 17);
+INSERT INTO orders VALUES (3210, 1438, 30);
+INSERT INTO orders VALUES (3211, 1441, 43);
+INSERT INTO orders VALUES (3212, 1444, 56);
+INSERT INTO orders VALUES (3213, 1447, 69);
+INSERT INTO orders VALUES (3214, 1450, 82);
+INSERT INTO orders VALUES (3215, 1453, 95);
+INSERT INTO orders VALUES (3216, 1456, 8);
+INSERT INTO orders VALUES (3217, 1459, 21);
+INSERT INTO orders VALUES (3218, 1462, 34);
+INSERT INTO orders VALUES (3219, 1465, 47);
+INSERT INTO orders VALUES (3220, 1468, 60);
+INSERT INTO orders VALUES (3221, 1471, 73);
+INSERT INTO orders VALUES (3222, 1474, 86);
+INSERT INTO orders VALUES (3223, 1477, 99);
+INSERT INTO orders VALUES (3224, 1480, 12);
+INSERT INTO orders VALUES (3225, 1483, 25);
+INSERT INTO orders VALUES (3226, 1486, 38);
+INSERT INTO orders VALUES (3227, 1489, 51);
+INSERT INTO orders VALUES (3228, 1492, 64);
+INSERT INTO orders VALUES (3229, 1495, 77);
+INSERT INTO orders VALUES (3230, 1498, 90);
+INSERT INTO orders VALUES (3231, 1501, 3);
+INSERT INTO orders VALUES (3232, 1504, 16);
+INSERT INTO orders VALUES (3233, 1507, 29);
+INSERT INTO orders VALUES (3234, 1510, 42);
+INSERT INTO orders VALUES (3235, 1513, 55);
+INSERT INTO orders VALUES (3236, 1516, 68);
+INSERT INTO orders VALUES (3237, 1519, 81);
+INSERT INTO orders VALUES (3238, 1522, 94);
+INSERT INTO orders VALUES (3239, 1525, 7);
+INSERT INTO orders VALUES (3240, 1528, 20);
+INSERT INTO orders VALUES (3241, 1531, 33);
+INSERT INTO orders VALUES (3242, 1534, 46);
+INSERT INTO orders VALUES (3243, 1537, 59);
+INSERT INTO orders VALUES (3244, 1540, 72);
+INSERT INTO orders VALUES (3245, 1543, 85);
+INSERT INTO orders VALUES (3246, 1546, 98);
+INSERT INTO orders VALUES (3247, 1549, 11);
+INSERT INTO orders VALUES (3248, 1552, 24);
+INSERT INTO orders VALUES (3249, 1555, 37);
+INSERT INTO orders VALUES (3250, 1558, 50);
+INSERT INTO orders VALUES (3251, 1561, 63);
+INSERT INTO orders VALUES (3252, 1564, 76);
+INSERT INTO orders VALUES (3253, 1567, 89);
+INSERT INTO orders VALUES (3254, 1570, 2);
+INSERT INTO orders VALUES (3255, 1573, 15);
+INSERT INTO orders VALUES (3256, 1576, 28);
+INSERT INTO orders VALUES (3257, 1579, 41);
+INSERT INTO orders VALUES (3258, 1582, 54);
+INSERT INTO orders VALUES (3259, 1585, 67);
+INSERT INTO orders VALUES (3260, 1588, 80);
+INSERT INTO orders VALUES (3261, 1591, 93);
+INSERT INTO orders VALUES (3262, 1594, 6);
+INSERT INTO orders VALUES (3263, 1597, 19);
+INSERT INTO orders VALUES (3264, 1600, 32);
+INSERT INTO orders VALUES (3265, 1603, 45);
+INSERT INTO orders VALUES (3266, 1606, 58);
+INSERT INTO orders VALUES (3267, 1609, 71);
+INSERT INTO orders VALUES (3268, 1612, 84);
+INSERT INTO orders VALUES (3269, 1615, 97);
+INSERT INTO orders VALUES (3270, 1618, 10);
+INSERT INTO orders VALUES (3271, 1621, 23);
+INSERT INTO orders VALUES (3272, 1624, 36);
+INSERT INTO orders VALUES (3273, 1627, 49);
+INSERT INTO orders VALUES (3274, 1630, 62);
+INSERT INTO orders VALUES (3275, 1633, 75);
+INSERT INTO orders VALUES (3276, 1636, 88);
+INSERT INTO orders VALUES (3277, 1639, 1);
+INSERT INTO orders VALUES (3278, 1642, 14);
+INSERT INTO orders VALUES (3279, 1645, 27);
+INSERT INTO orders VALUES (3280, 1648, 40);
+INSERT INTO orders VALUES (3281, 1651, 53);
+INSERT INTO orders VALUES (3282, 1654, 66);
+INSERT INTO orders VALUES (3283, 1657, 79);
+INSERT INTO orders VALUES (3284, 1660, 92);
+INSERT INTO orders VALUES (3285, 1663, 5);
+INSERT INTO orders VALUES (3286, 1666, 18);
+INSERT INTO orders VALUES (3287, 1669, 31);
+INSERT INTO orders VALUES (3288, 1672, 44);
+INSERT INTO orders VALUES (3289, 1675, 57);
+INSERT INTO orders VALUES (3290, 1678, 70);
+INSERT INTO orders VALUES (3291, 1681, 83);
+INSERT INTO orders VALUES (3292, 1684, 96);
+INSERT INTO orders VALUES (3293, 1687, 9);
+INSERT INTO orders VALUES (3294, 1690, 22);
+INSERT INTO orders VALUES (3295, 1693, 35);
+INSERT INTO orders VALUES (3296, 1696, 48);
+INSERT INTO orders VALUES (3297, 1699, 61);
+INSERT INTO orders VALUES (3298, 1702, 74);
+INSERT INTO orders VALUES (3299, 1705, 87);
+INSERT INTO orders VALUES (3300, 1708, 0);
+INSERT INTO orders VALUES (3301, 1711, 13);
+INSERT INTO orders VALUES (3302, 1714, 26);
+INSERT INTO orders VALUES (3303, 1717, 39);
+INSERT INTO orders VALUES (3304, 1720, 52);
+INSERT INTO orders VALUES (3305, 1723, 65);
+INSERT INTO orders VALUES (3306, 1726, 78);
+INSERT INTO orders VALUES (3307, 1729, 91);
+INSERT INTO orders VALUES (3308, 1732, 4);
+INSERT INTO orders VALUES (3309, 1735, 17);
+INSERT INTO orders VALUES (3310, 1738, 30);
+INSERT INTO orders VALUES (3311, 1741, 43);
+INSERT INTO orders VALUES (3312, 1744, 56);
+INSERT INTO orders VALUES (3313, 1747, 69);
+INSERT INTO orders VALUES (3314, 1750, 82);
+INSERT INTO orders VALUES (3315, 1753, 95);
+INSERT INTO orders VALUES (3316, 1756, 8);
+INSERT INTO orders VALUES (3317, 1759, 21);
+INSERT INTO orders VALUES (3318, 1762, 34);
+INSERT INTO orders VALUES (3319, 1765, 47);
+INSERT INTO orders VALUES (3320, 1768, 60);
+INSERT INTO orders VALUES (3321, 1771, 73);
+INSERT INTO orders VALUES (3322, 1774, 86);
+INSERT INTO orders VALUES (3323, 1777, 99);
+INSERT INTO orders VALUES (3324, 1780, 12);
+INSERT INTO orders VALUES (3325, 1783, 25);
+INSERT INTO orders VALUES (3326, 1786, 38);
+INSERT INTO orders VALUES (3327, 1789, 51);
+INSERT INTO orders VALUES (3328, 1792, 64);
+INSERT INTO orders VALUES (3329, 1795, 77);
+INSERT INTO orders VALUES (3330, 1798, 90);
+INSERT INTO orders VALUES (3331, 1801, 3);
+INSERT INTO orders VALUES (3332, 1804, 16);
+INSERT INTO orders VALUES (3333, 1807, 29);
+INSERT INTO orders VALUES (3334, 1810, 42);
+INSERT INTO orders VALUES (3335, 1813, 55);
+INSERT INTO orders VALUES (3336, 1816, 68);
+INSERT INTO orders VALUES (3337, 1819, 81);
+INSERT INTO orders VALUES (3338, 1822, 94);
+INSERT INTO orders VALUES (3339, 1825, 7);
+INSERT INTO orders VALUES (3340, 1828, 20);
+INSERT INTO orders VALUES (3341, 1831, 33);
+INSERT INTO orders VALUES (3342, 1834, 46);
+INSERT INTO orders VALUES (3343, 1837, 59);
+INSERT INTO orders VALUES (3344, 1840, 72);
+INSERT INTO orders VALUES (3345, 1843, 85);
+INSERT INTO orders VALUES (3346, 1846, 98);
+INSERT INTO orders VALUES (3347, 1849, 11);
+INSERT INTO orders VALUES (3348, 1852, 24);
+INSERT INTO orders VALUES (3349, 1855, 37);
+INSERT INTO orders VALUES (3350, 1858, 50);
+INSERT INTO orders VALUES (3351, 1861, 63);
+INSERT INTO orders VALUES (3352, 1864, 76);
+INSERT INTO orders VALUES (3353, 1867, 89);
+INSERT INTO orders VALUES (3354, 1870, 2);
+INSERT INTO orders VALUES (3355, 1873, 15);
+INSERT INTO orders VALUES (3356, 1876, 28);
+INSERT INTO orders VALUES (3357, 1879, 41);
+INSERT INTO orders VALUES (3358, 1882, 54);
+INSERT INTO orders VALUES (3359, 1885, 67);
+INSERT INTO orders VALUES (3360, 1888, 80);
+INSERT INTO orders VALUES (3361, 1891, 93);
+INSERT INTO orders VALUES (3362, 1894, 6);
+INSERT INTO orders VALUES (3363, 1897, 19);
+INSERT INTO orders VALUES (3364, 1900, 32);
+INSERT INTO orders VALUES (3365, 1903, 45);
+INSERT INTO orders VALUES (3366, 1906, 58);
+INSERT INTO orders VALUES (3367, 1909, 71);
+INSERT INTO orders VALUES (3368, 1912, 84);
+INSERT INTO orders VALUES (3369, 1915, 97);
+INSERT INTO orders VALUES (3370, 1918, 10);
+INSERT INTO orders VALUES (3371, 1921, 23);
+INSERT INTO orders VALUES (3372, 1924, 36);
+INSERT INTO orders VALUES (3373, 1927, 49);
+INSERT INTO orders VALUES (3374, 1930, 62);
+INSERT INTO orders VALUES (3375, 1933, 75);
+INSERT INTO orders VALUES (3376, 1936, 88);
+INSERT INTO orders VALUES (3377, 1939, 1);
+INSERT INTO orders VALUES (3378, 1942, 14);
+INSERT INTO orders VALUES (3379, 1945, 27);
+INSERT INTO orders VALUES (3380, 1948, 40);
+INSERT INTO orders VALUES (3381, 1951, 53);
+INSERT INTO orders VALUES (3382, 1954, 66);
+INSERT INTO orders VALUES (3383, 1957, 79);
+INSERT INTO orders VALUES (3384, 1960, 92);
+INSERT INTO orders VALUES (3385, 1963, 5);
+INSERT INTO orders VALUES (3386, 1966, 18);
+INSERT INTO orders VALUES (3387, 1969, 31);
+INSERT INTO orders VALUES (3388, 1972, 44);
+INSERT INTO orders VALUES (3389, 1975, 57);
+INSERT INTO orders VALUES (3390, 1978, 70);
+INSERT INTO orders VALUES (3391, 1981, 83);
+INSERT INTO orders VALUES (3392, 1984, 96);
+INSERT INTO orders VALUES (3393, 1987, 9);
+INSERT INTO orders VALUES (3394, 1990, 22);
+INSERT INTO orders VALUES (3395, 1993, 35);
+INSERT INTO orders VALUES (3396, 1996, 48);
+INSERT INTO orders VALUES (3397, 1999, 61);
+INSERT INTO orders VALUES (3398, 2002, 74);
+INSERT INTO orders VALUES (3399, 2005, 87);
+INSERT INTO orders VALUES (3400, 2008, 0);
+INSERT INTO orders VALUES (3401, 2011, 13);
+INSERT INTO orders VALUES (3402, 2014, 26);
+INSERT INTO orders VALUES (3403, 2017, 39);
+INSERT INTO orders VALUES (3404, 2020, 52);
+INSERT INTO orders VALUES (3405, 2023, 65);
+INSERT INTO orders VALUES (3406, 2026, 78);
+INSERT INTO orders VALUES (3407, 2029, 91);
+INSERT INTO orders VALUES (3408, 2032, 4);
+INSERT INTO orders VALUES (3409, 2035, 17);
+INSERT INTO orders VALUES (3410, 2038, 30);
+INSERT INTO orders VALUES (3411, 2041, 43);
+INSERT INTO orders VALUES (3412, 2044, 56);
+INSERT INTO orders VALUES (3413, 2047, 69);
+INSERT INTO orders VALUES (3414, 2050, 82);
+INSERT INTO orders VALUES (3415, 2053, 95);
+INSERT INTO orders VALUES (3416, 2056, 8);
+INSERT INTO orders VALUES (3417, 2059, 21);
+INSERT INTO orders VALUES (3418, 2062, 34);
+INSERT INTO orders VALUES (3419, 2065, 47);
+INSERT INTO orders VALUES (3420, 2068, 60);
+INSERT INTO orders VALUES (3421, 2071, 73);
+INSERT INTO orders VALUES (3422, 2074, 86);
+INSERT INTO orders VALUES (3423, 2077, 99);
+INSERT INTO orders VALUES (3424, 2080, 12);
+INSERT INTO orders VALUES (3425, 2083, 25);
+INSERT INTO orders VALUES (3426, 2086, 38);
+INSERT INTO orders VALUES (3427, 2089, 51);
+INSERT INTO orders VALUES (3428, 2092, 64);
+INSERT INTO orders VALUES (3429, 2095, 77);
+INSERT INTO orders VALUES (3430, 2098, 90);
+INSERT INTO orders VALUES (3431, 2101, 3);
+INSERT INTO orders VALUES (3432, 2104, 16);
+INSERT INTO orders VALUES (3433, 2107, 29);
+INSERT INTO orders VALUES (3434, 2110, 42);
+INSERT INTO orders VALUES (3435, 2113, 55);
+INSERT INTO orders VALUES (3436, 2116, 68);
+INSERT INTO orders VALUES (3437, 2119, 81);
+INSERT INTO orders VALUES (3438, 2122, 94);
+INSERT INTO orders VALUES (3439, 2125, 7);
+INSERT INTO orders VALUES (3440, 2128, 20);
+INSERT INTO orders VALUES (3441, 2131, 33);
+INSERT INTO orders VALUES (3442, 2134, 46);
+INSERT INTO orders VALUES (3443, 2137, 59);
+INSERT INTO orders VALUES (3444, 2140, 72);
+INSERT INTO orders VALUES (3445, 2143, 85);
+INSERT INTO orders VALUES (3446, 2146, 98);
+INSERT INTO orders VALUES (3447, 2149, 11);
+INSERT INTO orders VALUES (3448, 2152, 24);
+INSERT INTO orders VALUES (3449, 2155, 37);
+INSERT INTO orders VALUES (3450, 2158, 50);
+INSERT INTO orders VALUES (3451, 2161, 63);
+INSERT INTO orders VALUES (3452, 2164, 76);
+INSERT INTO orders VALUES (3453, 2167, 89);
+INSERT INTO orders VALUES (3454, 2170, 2);
+INSERT INTO orders VALUES (3455, 2173, 15);
+INSERT INTO orders VALUES (3456, 2176, 28);
+INSERT INTO orders VALUES (3457, 2179, 41);
+INSERT INTO orders VALUES (3458, 2182, 54);
+INSERT INTO orders VALUES (3459, 2185, 67);
+INSERT INTO orders VALUES (3460, 2188, 80);
+INSERT INTO orders VALUES (3461, 2191, 93);
+INSERT INTO orders VALUES (3462, 2194, 6);
+INSERT INTO orders VALUES (3463, 2197, 19);
+INSERT INTO orders VALUES (3464, 2200, 32);
+INSERT INTO orders VALUES (3465, 2203, 45);
+INSERT INTO orders VALUES (3466, 2206, 58);
+INSERT INTO orders VALUES (3467, 2209, 71);
+INSERT INTO orders VALUES (3468, 2212, 84);
+INSERT INTO orders VALUES (3469, 2215, 97);
+INSERT INTO orders VALUES (3470, 2218, 10);
+INSERT INTO orders VALUES (3471, 2221, 23);
+INSERT INTO orders VALUES (3472, 2224, 36);
+INSERT INTO orders VALUES (3473, 2227, 49);
+INSERT INTO orders VALUES (3474, 2230, 62);
+INSERT INTO orders VALUES (3475, 2233, 75);
+INSERT INTO orders VALUES (3476, 2236, 88);
+INSERT INTO orders VALUES (3477, 2239, 1);
+INSERT INTO orders VALUES (3478, 2242, 14);
+INSERT INTO orders VALUES (3479, 2245, 27);
+INSERT INTO orders VALUES (3480, 2248, 40);
+INSERT INTO orders VALUES (3481, 2251, 53);
+INSERT INTO orders VALUES (3482, 2254, 66);
+INSERT INTO orders VALUES (3483, 2257, 79);
+INSERT INTO orders VALUES (3484, 2260, 92);
+INSERT INTO orders VALUES (3485, 2263, 5);
+INSERT INTO orders VALUES (3486, 2266, 18);
+INSERT INTO orders VALUES (3487, 2269, 31);
+INSERT INTO orders VALUES (3488, 2272, 44);
+INSERT INTO orders VALUES (3489, 2275, 57);
+INSERT INTO orders VALUES (3490, 2278, 70);
+INSERT INTO orders VALUES (3491, 2281, 83);
+INSERT INTO orders VALUES (3492, 2284, 96);
+INSERT INTO orders VALUES (3493, 2287, 9);
+INSERT INTO orders VALUES (3494, 2290, 22);
+INSERT INTO orders VALUES (3495, 2293, 35);
+INSERT INTO orders VALUES (3496, 2296, 48);
+INSERT INTO orders VALUES (3497, 2299, 61);
+INSERT INTO orders VALUES (3498, 2302, 74);
+INSERT INTO orders VALUES (3499, 2305, 87);
+INSERT INTO orders VALUES (3500, 2308, 0);
+INSERT INTO orders VALUES (3501, 2311, 13);
+INSERT INTO orders VALUES (3502, 2314, 26);
+INSERT INTO orders VALUES (3503, 2317, 39);
+INSERT INTO orders VALUES (3504, 2320, 52);
+INSERT INTO orders VALUES (3505, 2323, 65);
+INSERT INTO orders VALUES (3506, 2326, 78);
+INSERT INTO orders VALUES (3507, 2329, 91);
+INSERT INTO orders VALUES (3508, 2332, 4);
+INSERT INTO orders VALUES (3509, 2335, 17);
+INSERT INTO orders VALUES (3510, 2338, 30);
+INSERT INTO orders VALUES (3511, 2341, 43);
+INSERT INTO orders VALUES (3512, 2344, 56);
+INSERT INTO orders VALUES (3513, 2347, 69);
+INSERT INTO orders VALUES (3514, 2350, 82);
+INSERT INTO orders VALUES (3515, 2353, 95);
+INSERT INTO orders VALUES (3516, 2356, 8);
+INSERT INTO orders VALUES (3517, 2359, 21);
+INSERT INTO orders VALUES (3518, 2362, 34);
+INSERT INTO orders VALUES (3519, 2365, 47);
+INSERT INTO orders VALUES (3520, 2368, 60);
+INSERT INTO orders VALUES (3521, 2371, 73);
+INSERT INTO orders VALUES (3522, 2374, 86);
+INSERT INTO orders VALUES (3523, 2377, 99);
+INSERT INTO orders VALUES (3524, 2380, 12);
+INSERT INTO orders VALUES (3525, 2383, 25);
+INSERT INTO orders VALUES (3526, 2386, 38);
+INSERT INTO orders VALUES (3527, 2389, 51);
+INSERT INTO orders VALUES (3528, 2392, 64);
+INSERT INTO orders VALUES (3529, 2395, 77);
+INSERT INTO orders VALUES (3530, 2398, 90);
+INSERT INTO orders VALUES (3531, 2401, 3);
+INSERT INTO orders VALUES (3532, 2404, 16);
+INSERT INTO orders VALUES (3533, 2407, 29);
+INSERT INTO orders VALUES (3534, 2410, 42);
+INSERT INTO orders VALUES (3535, 2413, 55);
+INSERT INTO orders VALUES (3536, 2416, 68);
+INSERT INTO orders VALUES (3537, 2419, 81);
+INSERT INTO orders VALUES (3538, 2422, 94);
+INSERT INTO orders VALUES (3539, 2425, 7);
+INSERT INTO orders VALUES (3540, 2428, 20);
+INSERT INTO orders VALUES (3541, 2431, 33);
+INSERT INTO orders VALUES (3542, 2434, 46);
+INSERT INTO orders VALUES (3543, 2437, 59);
+INSERT INTO orders VALUES (3544, 2440, 72);
+INSERT INTO orders VALUES (3545, 2443, 85);
+INSERT INTO orders VALUES (3546, 2446, 98);
+INSERT INTO orders VALUES (3547, 2449, 11);
+INSERT INTO orders VALUES (3548, 2452, 24);
+INSERT INTO orders VALUES (3549, 2455, 37);
+INSERT INTO orders VALUES (3550, 2458, 50);
+INSERT INTO orders VALUES (3551, 2461, 63);
+INSERT INTO orders VALUES (3552, 2464, 76);
+INSERT INTO orders VALUES (3553, 2467, 89);
+INSERT INTO orders VALUES (3554, 2470, 2);
+INSERT INTO orders VALUES (3555, 2473, 15);
+INSERT INTO orders VALUES (3556, 2476, 28);
+INSERT INTO orders VALUES (3557, 2479, 41);
+INSERT INTO orders VALUES (3558, 2482, 54);
+INSERT INTO orders VALUES (3559, 2485, 67);
+INSERT INTO orders VALUES (3560, 2488, 80);
+INSERT INTO orders VALUES (3561, 2491, 93);
+INSERT INTO orders VALUES (3562, 2494, 6);
+INSERT INTO orders VALUES (3563, 2497, 19);
+INSERT INTO orders VALUES (3564, 2500, 32);
+INSERT INTO orders VALUES (3565, 2503, 45);
+INSERT INTO orders VALUES (3566, 2506, 58);
+INSERT INTO orders VALUES (3567, 2509, 71);
+INSERT INTO orders VALUES (3568, 2512, 84);
+INSERT INTO orders VALUES (3569, 2515, 97);
+INSERT INTO orders VALUES (3570, 2518, 10);
+INSERT INTO orders VALUES (3571, 2521, 23);
+INSERT INTO orders VALUES (3572, 2524, 36);
+INSERT INTO orders VALUES (3573, 2527, 49);
+INSERT INTO orders VALUES (3574, 2530, 62);
+INSERT INTO orders VALUES (3575, 2533, 75);
+INSERT INTO orders VALUES (3576, 2536, 88);
+INSERT INTO orders VALUES (3577, 2539, 1);
+INSERT INTO orders VALUES (3578, 2542, 14);
+INSERT INTO orders VALUES (3579, 2545, 27);
+INSERT INTO orders VALUES (3580, 2548, 40);
+INSERT INTO orders VALUES (3581, 2551, 53);
+INSERT INTO orders VALUES (3582, 2554, 66);
+INSERT INTO orders VALUES (3583, 2557, 79);
+INSERT INTO orders VALUES (3584, 2560, 92);
+INSERT INTO orders VALUES (3585, 2563, 5);
+INSERT INTO orders VALUES (3586, 2566, 18);
+INSERT INTO orders VALUES (3587, 2569, 31);
+INSERT INTO orders VALUES (3588, 2572, 44);
+INSERT INTO orders VALUES (3589, 2575, 57);
+INSERT INTO orders VALUES (3590, 2578, 70);
+INSERT INTO orders VALUES (3591, 2581, 83);
+INSERT INTO orders VALUES (3592, 2584, 96);
+INSERT INTO orders VALUES (3593, 2587, 9);
+INSERT INTO orders VALUES (3594, 2590, 22);
+INSERT INTO orders VALUES (3595, 2593, 35);
+INSERT INTO orders VALUES (3596, 2596, 48);
+INSERT INTO orders VALUES (3597, 2599, 61);
+INSERT INTO orders VALUES (3598, 2602, 74);
+INSERT INTO orders VALUES (3599, 2605, 87);
+INSERT INTO orders VALUES (3600, 2608, 0);
+INSERT INTO orders VALUES (3601, 2611, 13);
+INSERT INTO orders VALUES (3602, 2614, 26);
+INSERT INTO orders VALUES (3603, 2617, 39);
+INSERT INTO orders VALUES (3604, 2620, 52);
+INSERT INTO orders VALUES (3605, 2623, 65);
+INSERT INTO orders VALUES (3606, 2626, 78);
+INSERT INTO orders VALUES (3607, 2629, 91);
+INSERT INTO orders VALUES (3608, 2632, 4);
+INSERT INTO orders VALUES (3609, 2635, 17);
+INSERT INTO orders VALUES (3610, 2638, 30);
+INSERT INTO orders VALUES (3611, 2641, 43);
+INSERT INTO orders VALUES (3612, 2644, 56);
+INSERT INTO orders VALUES (3613, 2647, 69);
+INSERT INTO orders VALUES (3614, 2650, 82);
+INSERT INTO orders VALUES (3615, 2653, 95);
+INSERT INTO orders VALUES (3616, 2656, 8);
+INSERT INTO orders VALUES (3617, 2659, 21);
+INSERT INTO orders VALUES (3618, 2662, 34);
+INSERT INTO orders VALUES (3619, 2665, 47);
+INSERT INTO orders VALUES (3620, 2668, 60);
+INSERT INTO orders VALUES (3621, 2671, 73);
+INSERT INTO orders VALUES (3622, 2674, 86);
+INSERT INTO orders VALUES (3623, 2677, 99);
+INSERT INTO orders VALUES (3624, 2680, 12);
+INSERT INTO orders VALUES (3625, 2683, 25);
+INSERT INTO orders VALUES (3626, 2686, 38);
+INSERT INTO orders VALUES (3627, 2689, 51);
+INSERT INTO orders VALUES (3628, 2692, 64);
+INSERT INTO orders VALUES (3629, 2695, 77);
+INSERT INTO orders VALUES (3630, 2698, 90);
+INSERT INTO orders VALUES (3631, 2701, 3);
+INSERT INTO orders VALUES (3632, 2704, 16);
+INSERT INTO orders VALUES (3633, 2707, 29);
+INSERT INTO orders VALUES (3634, 2710, 42);
+INSERT INTO orders VALUES (3635, 2713, 55);
+INSERT INTO orders VALUES (3636, 2716, 68);
+INSERT INTO orders VALUES (3637, 2719, 81);
+INSERT INTO orders VALUES (3638, 2722, 94);
+INSERT INTO orders VALUES (3639, 2725, 7);
+INSERT INTO orders VALUES (3640, 2728, 20);
+INSERT INTO orders VALUES (3641, 2731, 33);
+INSERT INTO orders VALUES (3642, 2734, 46);
+INSERT INTO orders VALUES (3643, 2737, 59);
+INSERT INTO orders VALUES (3644, 2740, 72);
+INSERT INTO orders VALUES (3645, 2743, 85);
+INSERT INTO orders VALUES (3646, 2746, 98);
+INSERT INTO orders VALUES (3647, 2749, 11);
+INSERT INTO orders VALUES (3648, 2752, 24);
+INSERT INTO orders VALUES (3649, 2755, 37);
+INSERT INTO orders VALUES (3650, 2758, 50);
+INSERT INTO orders VALUES (3651, 2761, 63);
+INSERT INTO orders VALUES (3652, 2764, 76);
+INSERT INTO orders VALUES (3653, 2767, 89);
+INSERT INTO orders VALUES (3654, 2770, 2);
+INSERT INTO orders VALUES (3655, 2773, 15);
+INSERT INTO orders VALUES (3656, 2776, 28);
+INSERT INTO orders VALUES (3657, 2779, 41);
+INSERT INTO orders VALUES (3658, 2782, 54);
+INSERT INTO orders VALUES (3659, 2785, 67);
+INSERT INTO orders VALUES (3660, 2788, 80);
+INSERT INTO orders VALUES (3661, 2791, 93);
+INSERT INTO orders VALUES (3662, 2794, 6);
+INSERT INTO orders VALUES (3663, 2797, 19);
+INSERT INTO orders VALUES (3664, 2800, 32);
+INSERT INTO orders VALUES (3665, 2803, 45);
+INSERT INTO orders VALUES (3666, 2806, 58);
+INSERT INTO orders VALUES (3667, 2809, 71);
+INSERT INTO orders VALUES (3668, 2812, 84);
+INSERT INTO orders VALUES (3669, 2815, 97);
+INSERT INTO orders VALUES (3670, 2818, 10);
+INSERT INTO orders VALUES (3671, 2821, 23);
+INSERT INTO orders VALUES (3672, 2824, 36);
+INSERT INTO orders VALUES (3673, 2827, 49);
+INSERT INTO orders VALUES (3674, 2830, 62);
+INSERT INTO orders VALUES (3675, 2833, 75);
+INSERT INTO orders VALUES (3676, 2836, 88);
+INSERT INTO orders VALUES (3677, 2839, 1);
+INSERT INTO orders VALUES (3678, 2842, 14);
+INSERT INTO orders VALUES (3679, 2845, 27);
+INSERT INTO orders VALUES (3680, 2848, 40);
+INSERT INTO orders VALUES (3681, 2851, 53);
+INSERT INTO orders VALUES (3682, 2854, 66);
+INSERT INTO orders VALUES (3683, 2857, 79);
+INSERT INTO orders VALUES (3684, 2860, 92);
+INSERT INTO orders VALUES (3685, 2863, 5);
+INSERT INTO orders VALUES (3686, 2866, 18);
+INSERT INTO orders VALUES (3687, 2869, 31);
+INSERT INTO orders VALUES (3688, 2872, 44);
+INSERT INTO orders VALUES (3689, 2875, 57);
+INSERT INTO orders VALUES (3690, 2878, 70);
+INSERT INTO orders VALUES (3691, 2881, 83);
+INSERT INTO orders VALUES (3692, 2884, 96);
+INSERT INTO orders VALUES (3693, 2887, 9);
+INSERT INTO orders VALUES (3694, 2890, 22);
+INSERT INTO orders VALUES (3695, 2893, 35);
+INSERT INTO orders VALUES (3696, 2896, 48);
+INSERT INTO orders VALUES (3697, 2899, 61);
+INSERT INTO orders VALUES (3698, 2902, 74);
+INSERT INTO orders VALUES (3699, 2905, 87);
+INSERT INTO orders VALUES (3700, 2908, 0);
+INSERT INTO orders VALUES (3701, 2911, 13);
+INSERT INTO orders VALUES (3702, 2914, 26);
+INSERT INTO orders VALUES (3703, 2917, 39);
+INSERT INTO orders VALUES (3704, 2920, 52);
+INSERT INTO orders VALUES (3705, 2923, 65);
+INSERT INTO orders VALUES (3706, 2926, 78);
+INSERT INTO orders VALUES (3707, 2929, 91);
+INSERT INTO orders VALUES (3708, 2932, 4);
+INSERT INTO orders VALUES (3709, 2935, 17);
+INSERT INTO orders VALUES (3710, 2938, 30);
+INSERT INTO orders VALUES (3711, 2941, 43);
+INSERT INTO orders VALUES (3712, 2944, 56);
+INSERT INTO orders VALUES (3713, 2947, 69);
+INSERT INTO orders VALUES (3714, 2950, 82);
+INSERT INTO orders VALUES (3715, 2953, 95);
+INSERT INTO orders VALUES (3716, 2956, 8);
+INSERT INTO orders VALUES (3717, 2959, 21);
+INSERT INTO orders VALUES (3718, 2962, 34);
+INSERT INTO orders VALUES (3719, 2965, 47);
+INSERT INTO orders VALUES (3720, 2968, 60);
+INSERT INTO orders VALUES (3721, 2971, 73);
+INSERT INTO orders VALUES (3722, 2974, 86);
+INSERT INTO orders VALUES (3723, 2977, 99);
+INSERT INTO orders VALUES (3724, 2980, 12);
+INSERT INTO orders VALUES (3725, 2983, 25);
+INSERT INTO orders VALUES (3726, 2986, 38);
+INSERT INTO orders VALUES (3727, 2989, 51);
+INSERT INTO orders VALUES (3728, 2992, 64);
+INSERT INTO orders VALUES (3729, 2995, 77);
+INSERT INTO orders VALUES (3730, 2998, 90);
+INSERT INTO orders VALUES (3731, 3001, 3);
+INSERT INTO orders VALUES (3732, 3004, 16);
+INSERT INTO orders VALUES (3733, 3007, 29);
+INSERT INTO orders VALUES (3734, 3010, 42);
+INSERT INTO orders VALUES (3735, 3013, 55);
+INSERT INTO orders VALUES (3736, 3016, 68);
+INSERT INTO orders VALUES (3737, 3019, 81);
+INSERT INTO orders VALUES (3738, 3022, 94);
+INSERT INTO orders VALUES (3739, 3025, 7);
+INSERT INTO orders VALUES (3740, 3028, 20);
+INSERT INTO orders VALUES (3741, 3031, 33);
+INSERT INTO orders VALUES (3742, 3034, 46);
+INSERT INTO orders VALUES (3743, 3037, 59);
+INSERT INTO orders VALUES (3744, 3040, 72);
+INSERT INTO orders VALUES (3745, 3043, 85);
+INSERT INTO orders VALUES (3746, 3046, 98);
+INSERT INTO orders VALUES (3747, 3049, 11);
+INSERT INTO orders VALUES (3748, 3052, 24);
+INSERT INTO orders VALUES (3749, 3055, 37);
+INSERT INTO orders VALUES (3750, 3058, 50);
+INSERT INTO orders VALUES (3751, 3061, 63);
+INSERT INTO orders VALUES (3752, 3064, 76);
+INSERT INTO orders VALUES (3753, 3067, 89);
+INSERT INTO orders VALUES (3754, 3070, 2);
+INSERT INTO orders VALUES (3755, 3073, 15);
+INSERT INTO orders VALUES (3756, 3076, 28);
+INSERT INTO orders VALUES (3757, 3079, 41);
+INSERT INTO orders VALUES (3758, 3082, 54);
+INSERT INTO orders VALUES (3759, 3085, 67);
+INSERT INTO orders VALUES (3760, 3088, 80);
+INSERT INTO orders VALUES (3761, 3091, 93);
+INSERT INTO orders VALUES (3762, 3094, 6);
+INSERT INTO orders VALUES (3763, 3097, 19);
+INSERT INTO orders VALUES (3764, 3100, 32);
+INSERT INTO orders VALUES (3765, 3103, 45);
+INSERT INTO orders VALUES (3766, 3106, 58);
+INSERT INTO orders VALUES (3767, 3109, 71);
+INSERT INTO orders VALUES (3768, 3112, 84);
+INSERT INTO orders VALUES (3769, 3115, 97);
+INSERT INTO orders VALUES (3770, 3118, 10);
+INSERT INTO orders VALUES (3771, 3121, 23);
+INSERT INTO orders VALUES (3772, 3124, 36);
+INSERT INTO orders VALUES (3773, 3127, 49);
+INSERT INTO orders VALUES (3774, 3130, 62);
+INSERT INTO orders VALUES (3775, 3133, 75);
+INSERT INTO orders VALUES (3776, 3136, 88);
+INSERT INTO orders VALUES (3777, 3139, 1);
+INSERT INTO orders VALUES (3778, 3142, 14);
+INSERT INTO orders VALUES (3779, 3145, 27);
+INSERT INTO orders VALUES (3780, 3148, 40);
+INSERT INTO orders VALUES (3781, 3151, 53);
+INSERT INTO orders VALUES (3782, 3154, 66);
+INSERT INTO orders VALUES (3783, 3157, 79);
+INSERT INTO orders VALUES (3784, 3160, 92);
+INSERT INTO orders VALUES (3785, 3163, 5);
+INSERT INTO orders VALUES (3786, 3166, 18);
+INSERT INTO orders VALUES (3787, 3169, 31);
+INSERT INTO orders VALUES (3788, 3172, 44);
+INSERT INTO orders VALUES (3789, 3175, 57);
+INSERT INTO orders VALUES (3790, 3178, 70);
+INSERT INTO orders VALUES (3791, 3181, 83);
+INSERT INTO orders VALUES (3792, 3184, 96);
+INSERT INTO orders VALUES (3793, 3187, 9);
+INSERT INTO orders VALUES (3794, 3190, 22);
+INSERT INTO orders VALUES (3795, 3193, 35);
+INSERT INTO orders VALUES (3796, 3196, 48);
+INSERT INTO orders VALUES (3797, 3199, 61);
+INSERT INTO orders VALUES (3798, 3202, 74);
+INSERT INTO orders VALUES (3799, 3205, 87);
+INSERT INTO orders VALUES (3800, 3208, 0);
+INSERT INTO orders VALUES (3801, 3211, 13);
+INSERT INTO orders VALUES (3802, 3214, 26);
+INSERT INTO orders VALUES (3803, 3217, 39);
+INSERT INTO orders VALUES (3804, 3220, 52);
+INSERT INTO orders VALUES (3805, 3223, 65);
+INSERT INTO orders VALUES (3806, 3226, 78);
+INSERT INTO orders VALUES (3807, 3229, 91);
+INSERT INTO orders VALUES (3808, 3232, 4);
+INSERT INTO orders VALUES (3809, 3235, 17);
+INSERT INTO orders VALUES (3810, 3238, 30);
+INSERT INTO orders VALUES (3811, 3241, 43);
+INSERT INTO orders VALUES (3812, 3244, 56);
+INSERT INTO orders VALUES (3813, 3247, 69);
+INSERT INTO orders VALUES (3814, 3250, 82);
+INSERT INTO orders VALUES (3815, 3253, 95);
+INSERT INTO orders VALUES (3816, 3256, 8);
+INSERT INTO orders VALUES (3817, 3259, 21);
+INSERT INTO orders VALUES (3818, 3262, 34);
+INSERT INTO orders VALUES (3819, 3265, 47);
+INSERT INTO orders VALUES (3820, 3268, 60);
+INSERT INTO orders VALUES (3821, 3271, 73);
+INSERT INTO orders VALUES (3822, 3274, 86);
+INSERT INTO orders VALUES (3823, 3277, 99);
+INSERT INTO orders VALUES (3824, 3280, 12);
+INSERT INTO orders VALUES (3825, 3283, 25);
+INSERT INTO orders VALUES (3826, 3286, 38);
+INSERT INTO orders VALUES (3827, 3289, 51);
+INSERT INTO orders VALUES (3828, 3292, 64);
+INSERT INTO orders VALUES (3829, 3295, 77);
+INSERT INTO orders VALUES (3830, 3298, 90);
+INSERT INTO orders VALUES (3831, 3301, 3);
+INSERT INTO orders VALUES (3832, 3304, 16);
+INSERT INTO orders VALUES (3833, 3307, 29);
+INSERT INTO orders VALUES (3834, 3310, 42);
+INSERT INTO orders VALUES (3835, 3313, 55);
+INSERT INTO orders VALUES (3836, 3316, 68);
+INSERT INTO orders VALUES (3837, 3319, 81);
+INSERT INTO orders VALUES (3838, 3322, 94);
+INSERT INTO orders VALUES (3839, 3325, 7);
+INSERT INTO orders VALUES (3840, 3328, 20);
+INSERT INTO orders VALUES (3841, 3331, 33);
+INSERT INTO orders VALUES (3842, 3334, 46);
+INSERT INTO orders VALUES (3843, 3337, 59);
+INSERT INTO orders VALUES (3844, 3340, 72);
+INSERT INTO orders VALUES (3845, 3343, 85);
+INSERT INTO orders VALUES (3846, 3346, 98);
+INSERT INTO orders VALUES (3847, 3349, 11);
+INSERT INTO orders VALUES (3848, 3352, 24);
+INSERT INTO orders VALUES (3849, 3355, 37);
+INSERT INTO orders VALUES (3850, 3358, 50);
+INSERT INTO orders VALUES (3851, 3361, 63);
+INSERT INTO orders VALUES (3852, 3364, 76);
+INSERT INTO orders VALUES (3853, 3367, 89);
+INSERT INTO orders VALUES (3854, 3370, 2);
+INSERT INTO orders VALUES (3855, 3373, 15);
+INSERT INTO orders VALUES (3856, 3376, 28);
+INSERT INTO orders VALUES (3857, 3379, 41);
+INSERT INTO orders VALUES (3858, 3382, 54);
+INSERT INTO orders VALUES (3859, 3385, 67);
+INSERT INTO orders VALUES (3860, 3388, 80);
+INSERT INTO orders VALUES (3861, 3391, 93);
+INSERT INTO orders VALUES (3862, 3394, 6);
+INSERT INTO orders VALUES (3863, 3397, 19);
+INSERT INTO orders VALUES (3864, 3400, 32);
+INSERT INTO orders VALUES (3865, 3403, 45);
+INSERT INTO orders VALUES (3866, 3406, 58);
+INSERT INTO orders VALUES (3867, 3409, 71);
+INSERT INTO orders VALUES (3868, 3412, 84);
+INSERT INTO orders VALUES (3869, 3415, 97);
+INSERT INTO orders VALUES (3870, 3418, 10);
+INSERT INTO orders VALUES (3871, 3421, 23);
+INSERT INTO orders VALUES (3872, 3424, 36);
+INSERT INTO orders VALUES (3873, 3427, 49);
+INSERT INTO orders VALUES (3874, 3430, 62);
+INSERT INTO orders VALUES (3875, 3433, 75);
+INSERT INTO orders VALUES (3876, 3436, 88);
+INSERT INTO orders VALUES (3877, 3439, 1);
+INSERT INTO orders VALUES (3878, 3442, 14);
+INSERT INTO orders VALUES (3879, 3445, 27);
+INSERT INTO orders VALUES (3880, 3448, 40);
+INSERT INTO orders VALUES (3881, 3451, 53);
+INSERT INTO orders VALUES (3882, 3454, 66);
+INSERT INTO orders VALUES (3883, 3457, 79);
+INSERT INTO orders VALUES (3884, 3460, 92);
+INSERT INTO orders VALUES (3885, 3463, 5);
+INSERT INTO orders VALUES (3886, 3466, 18);
+INSERT INTO orders VALUES (3887, 3469, 31);
+INSERT INTO orders VALUES (3888, 3472, 44);
+INSERT INTO orders VALUES (3889, 3475, 57);
+INSERT INTO orders VALUES (3890, 3478, 70);
+INSERT INTO orders VALUES (3891, 3481, 83);
+INSERT INTO orders VALUES (3892, 3484, 96);
+INSERT INTO orders VALUES (3893, 3487, 9);
+INSERT INTO orders VALUES (3894, 3490, 22);
+INSERT INTO orders VALUES (3895, 3493, 35);
+INSERT INTO orders VALUES (3896, 3496, 48);
+INSERT INTO orders VALUES (3897, 3499, 61);
+INSERT INTO orders VALUES (3898, 3502, 74);
+INSERT INTO orders VALUES (3899, 3505, 87);
+INSERT INTO orders VALUES (3900, 3508, 0);
+INSERT INTO orders VALUES (3901, 3511, 13);
+INSERT INTO orders VALUES (3902, 3514, 26);
+INSERT INTO orders VALUES (3903, 3517, 39);
+INSERT INTO orders VALUES (3904, 3520, 52);
+INSERT INTO orders VALUES (3905, 3523, 65);
+INSERT INTO orders VALUES (3906, 3526, 78);
+INSERT INTO orders VALUES (3907, 3529, 91);
+INSERT INTO orders VALUES (3908, 3532, 4);
+INSERT INTO orders VALUES (3909, 3535, 17);
+INSERT INTO orders VALUES (3910, 3538, 30);
+INSERT INTO orders VALUES (3911, 3541, 43);
+INSERT INTO orders VALUES (3912, 3544, 56);
+INSERT INTO orders VALUES (3913, 3547, 69);
+INSERT INTO orders VALUES (3914, 3550, 82);
+INSERT INTO orders VALUES (3915, 3553, 95);
+INSERT INTO orders VALUES (3916, 3556, 8);
+INSERT INTO orders VALUES (3917, 3559, 21);
+INSERT INTO orders VALUES (3918, 3562, 34);
+INSERT INTO orders VALUES (3919, 3565, 47);
+INSERT INTO orders VALUES (3920, 3568, 60);
+INSERT INTO orders VALUES (3921, 3571, 73);
+INSERT INTO orders VALUES (3922, 3574, 86);
+INSERT INTO orders VALUES (3923, 3577, 99);
+INSERT INTO orders VALUES (3924, 3580, 12);
+INSERT INTO orders VALUES (3925, 3583, 25);
+INSERT INTO orders VALUES (3926, 3586, 38);
+INSERT INTO orders VALUES (3927, 3589, 51);
+INSERT INTO orders VALUES (3928, 3592, 64);
+INSERT INTO orders VALUES (3929, 3595, 77);
+INSERT INTO orders VALUES (3930, 3598, 90);
+INSERT INTO orders VALUES (3931, 3601, 3);
+INSERT INTO orders VALUES (3932, 3604, 16);
+INSERT INTO orders VALUES (3933, 3607, 29);
+INSERT INTO orders VALUES (3934, 3610, 42);
+INSERT INTO orders VALUES (3935, 3613, 55);
+INSERT INTO orders VALUES (3936, 3616, 68);
+INSERT INTO orders VALUES (3937, 3619, 81);
+INSERT INTO orders VALUES (3938, 3622, 94);
+INSERT INTO orders VALUES (3939, 3625, 7);
+INSERT INTO orders VALUES (3940, 3628, 20);
+INSERT INTO orders VALUES (3941, 3631, 33);
+INSERT INTO orders VALUES (3942, 3634, 46);
+INSERT INTO orders VALUES (3943, 3637, 59);
+INSERT INTO orders VALUES (3944, 3640, 72);
+INSERT INTO orders VALUES (3945, 3643, 85);
+INSERT INTO orders VALUES (3946, 3646, 98);
+INSERT INTO orders VALUES (3947, 3649, 11);
+INSERT INTO orders VALUES (3948, 3652, 24);
+INSERT INTO orders VALUES (3949, 3655, 37);
+INSERT INTO orders VALUES (3950, 3658, 50);
+INSERT INTO orders VALUES (3951, 3661, 63);
+INSERT INTO orders VALUES (3952, 3664, 76);
+INSERT INTO orders VALUES (3953, 3667, 89);
+INSERT INTO orders VALUES (3954, 3670, 2);
+INSERT INTO orders VALUES (3955, 3673, 15);
+INSERT INTO orders VALUES (3956, 3676, 28);
+INSERT INTO orders VALUES (3957, 3679, 41);
+INSERT INTO orders VALUES (3958, 3682, 54);
+INSERT INTO orders VALUES (3959, 3685, 67);
+INSERT INTO orders VALUES (3960, 3688, 80);
+INSERT INTO orders VALUES (3961, 3691, 93);
+INSERT INTO orders VALUES (3962, 3694, 6);
+INSERT INTO orders VALUES (3963, 3697, 19);
+INSERT INTO orders VALUES (3964, 3700, 32);
+INSERT INTO orders VALUES (3965, 3703, 45);
+INSERT INTO orders VALUES (3966, 3706, 58);
+INSERT INTO orders VALUES (3967, 3709, 71);
+INSERT INTO orders VALUES (3968, 3712, 84);
+INSERT INTO orders VALUES (3969, 3715, 97);
+INSERT INTO orders VALUES (3970, 3718, 10);
+INSERT INTO orders VALUES (3971, 3721, 23);
+INSERT INTO orders VALUES (3972, 3724, 36);
+INSERT INTO orders VALUES (3973, 3727, 49);
+INSERT INTO orders VALUES (3974, 3730, 62);
+INSERT INTO orders VALUES (3975, 3733, 75);
+INSERT INTO orders VALUES (3976, 3736, 88);
+INSERT INTO orders VALUES (3977, 3739, 1);
+INSERT INTO orders VALUES (3978, 3742, 14);
+INSERT INTO orders VALUES (3979, 3745, 27);
+INSERT INTO orders VALUES (3980, 3748, 40);
+INSERT INTO orders VALUES (3981, 3751, 53);
+INSERT INTO orders VALUES (3982, 3754, 66);
+INSERT INTO orders VALUES (3983, 3757, 79);
+INSERT INTO orders VALUES (3984, 3760, 92);
+INSERT INTO orders VALUES (3985, 3763, 5);
+INSERT INTO orders VALUES (3986, 3766, 18);
+INSERT INTO orders VALUES (3987, 3769, 31);
+INSERT INTO orders VALUES (3988, 3772, 44);
+INSERT INTO orders VALUES (3989, 3775, 57);
+INSERT INTO orders VALUES (3990, 3778, 70);
+INSERT INTO orders VALUES (3991, 3781, 83);
+INSERT INTO orders VALUES (3992, 3784, 96);
+INSERT INTO orders VALUES (3993, 3787, 9);
+INSERT INTO orders VALUES (3994, 3790, 22);
+INSERT INTO orders VALUES (3995, 3793, 35);
+INSERT INTO orders VALUES (3996, 3796, 48);
+INSERT INTO orders VALUES (3997, 3799, 61);
+INSERT INTO orders VALUES (3998, 3802, 74);
+INSERT INTO orders VALUES (3999, 3805, 87);
+INSERT INTO orders VALUES (4000, 3808, 0);
+INSERT INTO orders VALUES (4001, 3811, 13);
+INSERT INTO orders VALUES (4002, 3814, 26);
+INSERT INTO orders VALUES (4003, 3817, 39);
+INSERT INTO orders VALUES (4004, 3820, 52);
+INSERT INTO orders VALUES (4005, 3823, 65);
+INSERT INTO orders VALUES (4006, 3826, 78);
+INSERT INTO orders VALUES (4007, 3829, 91);
+INSERT INTO orders VALUES (4008, 3832, 4);
+INSERT INTO orders VALUES (4009, 3835, 17);
+INSERT INTO orders VALUES (4010, 3838, 30);
+INSERT INTO orders VALUES (4011, 3841, 43);
+INSERT INTO orders VALUES (4012, 3844, 56);
+INSERT INTO orders VALUES (4013, 3847, 69);
+INSERT INTO orders VALUES (4014, 3850, 82);
+INSERT INTO orders VALUES (4015, 3853, 95);
+INSERT INTO orders VALUES (4016, 3856, 8);
+INSERT INTO orders VALUES (4017, 3859, 21);
+INSERT INTO orders VALUES (4018, 3862, 34);
+INSERT INTO orders VALUES (4019, 3865, 47);
+INSERT INTO orders VALUES (4020, 3868, 60);
+INSERT INTO orders VALUES (4021, 3871, 73);
+INSERT INTO orders VALUES (4022, 3874, 86);
+INSERT INTO orders VALUES (4023, 3877, 99);
+INSERT INTO orders VALUES (4024, 3880, 12);
+INSERT INTO orders VALUES (4025, 3883, 25);
+INSERT INTO orders VALUES (4026, 3886, 38);
+INSERT INTO orders VALUES (4027, 3889, 51);
+INSERT INTO orders VALUES (4028, 3892, 64);
+INSERT INTO orders VALUES (4029, 3895, 77);
+INSERT INTO orders VALUES (4030, 3898, 90);
+INSERT INTO orders VALUES (4031, 3901, 3);
+INSERT INTO orders VALUES (4032, 3904, 16);
+INSERT INTO orders VALUES (4033, 3907, 29);
+INSERT INTO orders VALUES (4034, 3910, 42);
+INSERT INTO orders VALUES (4035, 3913, 55);
+INSERT INTO orders VALUES (4036, 3916, 68);
+INSERT INTO orders VALUES (4037, 3919, 81);
+INSERT INTO orders VALUES (4038, 3922, 94);
+INSERT INTO orders VALUES (4039, 3925, 7);
+INSERT INTO orders VALUES (4040, 3928, 20);
+INSERT INTO orders VALUES (4041, 3931, 33);
+INSERT INTO orders VALUES (4042, 3934, 46);
+INSERT INTO orders VALUES (4043, 3937, 59);
+INSERT INTO orders VALUES (4044, 3940, 72);
+INSERT INTO orders VALUES (4045, 3943, 85);
+INSERT INTO orders VALUES (4046, 3946, 98);
+INSERT INTO orders VALUES (4047, 3949, 11);
+INSERT INTO orders VALUES (4048, 3952, 24);
+INSERT INTO orders VALUES (4049, 3955, 37);
+INSERT INTO orders VALUES (4050, 3958, 50);
+INSERT INTO orders VALUES (4051, 3961, 63);
+INSERT INTO orders VALUES (4052, 3964, 76);
+INSERT INTO orders VALUES (4053, 3967, 89);
+INSERT INTO orders VALUES (4054, 3970, 2);
+INSERT INTO orders VALUES (4055, 3973, 15);
+INSERT INTO orders VALUES (4056, 3976, 28);
+INSERT INTO orders VALUES (4057, 3979, 41);
+INSERT INTO orders VALUES (4058, 3982, 54);
+INSERT INTO orders VALUES (4059, 3985, 67);
+INSERT INTO orders VALUES (4060, 3988, 80);
+INSERT INTO orders VALUES (4061, 3991, 93);
+INSERT INTO orders VALUES (4062, 3994, 6);
+INSERT INTO orders VALUES (4063, 3997, 19);
+INSERT INTO orders VALUES (4064, 4000, 32);
+INSERT INTO orders VALUES (4065, 4003, 45);
+INSERT INTO orders VALUES (4066, 4006, 58);
+INSERT INTO orders VALUES (4067, 4009, 71);
+INSERT INTO orders VALUES (4068, 4012, 84);
+INSERT INTO orders VALUES (4069, 4015, 97);
+INSERT INTO orders VALUES (4070, 4018, 10);
+INSERT INTO orders VALUES (4071, 4021, 23);
+INSERT INTO orders VALUES (4072, 4024, 36);
+INSERT INTO orders VALUES (4073, 4027, 49);
+INSERT INTO orders VALUES (4074, 4030, 62);
+INSERT INTO orders VALUES (4075, 4033, 75);
+INSERT INTO orders VALUES (4076, 4036, 88);
+INSERT INTO orders VALUES (4077, 4039, 1);
+INSERT INTO orders VALUES (4078, 4042, 14);
+INSERT INTO orders VALUES (4079, 4045, 27);
+INSERT INTO orders VALUES (4080, 4048, 40);
+INSERT INTO orders VALUES (4081, 4051, 53);
+INSERT INTO orders VALUES (4082, 4054, 66);
+INSERT INTO orders VALUES (4083, 4057, 79);
+INSERT INTO orders VALUES (4084, 4060, 92);
+INSERT INTO orders VALUES (4085, 4063, 5);
+INSERT INTO orders VALUES (4086, 4066, 18);
+INSERT INTO orders VALUES (4087, 4069, 31);
+INSERT INTO orders VALUES (4088, 4072, 44);
+INSERT INTO orders VALUES (4089, 4075, 57);
+INSERT INTO orders VALUES (4090, 4078, 70);
+INSERT INTO orders VALUES (4091, 4081, 83);
+INSERT INTO orders VALUES (4092, 4084, 96);
+INSERT INTO orders VALUES (4093, 4087, 9);
+INSERT INTO orders VALUES (4094, 4090, 22);
+INSERT INTO orders VALUES (4095, 4093, 35);
+SELECT id, grp, price, name FROM t WHERE id < 2 OR id = 4096 OR id > 8189;
+SELECT id, price FROM t WHERE name = 'name5003';
+SELECT id FROM t WHERE price > 129.97;
+SELECT t.id, orders.id, t.price FROM t INNER JOIN orders ON t.id = orders.item_id WHERE orders.qty = 99 AND t.id < 3000;
@@ -0,0 +1,36 @@
+USE DATABASE shop;
+UPDATE t SET price = price + 1.00, grp = grp + 1;
+UPDATE t SET price = price + 1.00, grp = grp + 1;
+UPDATE t SET price = price + 1.00, grp = grp + 1;
+UPDATE t SET price = price + 1.00, grp = grp + 1;
+UPDATE t SET price = price + 1.00, grp = grp + 1;
+UPDATE t SET price = price + 1.00, grp = grp + 1;
+UPDATE t SET price = price + 1.00, grp = grp + 1;
+UPDATE t SET price = price + 1.00, grp = grp + 1;
+UPDATE t SET price = price + 1.00, grp = grp + 1;
+UPDATE t SET price = price + 1.00, grp = grp + 1;
+UPDATE t SET price = price + 1.00, grp = grp + 1;
+UPDATE t SET price = price + 1.00, grp = grp + 1;
+UPDATE t SET price = price + 1.00, grp = grp + 1;
+UPDATE t SET price = price + 1.00, grp = grp + 1;
+UPDATE t SET price = price + 1.00, grp = grp + 1;
+UPDATE t SET price = price + 1.00, grp = grp + 1;
+UPDATE t SET price = price + 1.00, grp = grp + 1;
+UPDATE t SET price = price + 1.00, grp = grp + 1;
+UPDATE t SET price = price + 1.00, grp = grp + 1;
+UPDATE t SET price = price + 1.00, grp = grp + 1;
+UPDATE t SET price = price + 1.00, grp = grp + 1;
+UPDATE t SET price = price + 1.00, grp = grp + 1;
+UPDATE t SET price = price + 1.00, grp = grp + 1;
+UPDATE t SET price = price + 1.00, grp = grp + 1;
+UPDATE t SET price = price + 1.00, grp = grp + 1;
+UPDATE t SET price = price + 1.00, grp = grp + 1;
+UPDATE t SET price = price + 1.00, grp = grp + 1;
+UPDATE t SET price = price + 1.00, grp = grp + 1;
+UPDATE t SET price = price + 1.00, grp = grp + 1;
+UPDATE t SET price = price + 1.00, grp = grp + 1;
+DELETE FROM t WHERE grp = 35;
+SELECT id, grp, price, name FROM t WHERE id < 2 OR id = 4096 OR id > 8189;
+SELECT id, price FROM t WHERE name = 'name5003';
+SELECT id FROM t WHERE price > 129.97;
+SELECT t.id, orders.id, t.price FROM t INNER JOIN orders ON t.id = orders.item_id WHERE orders.qty = 99 AND t.id < 3000;
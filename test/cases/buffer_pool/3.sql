@@ -0,0 +1,5 @@
+USE DATABASE shop;
+SELECT id, grp, price, name FROM t WHERE id < 2 OR id = 4096 OR id > 8189;
+SELECT id, price FROM t WHERE name = 'name5003';
+SELECT id FROM t WHERE price > 129.97;
+SELECT t.id, orders.id, t.price FROM t INNER JOIN orders ON t.id = orders.item_id WHERE orders.qty = 99 AND t.id < 3000;
@@ -0,0 +1,4114 @@
+CREATE DATABASE shop;
+USE DATABASE shop;
+CREATE TABLE t (id INTEGER, grp INTEGER, qty INTEGER, price FLOAT, ratio FLOAT);
+INSERT INTO t VALUES (0, 5, 0, 1.25, 0.1);
+INSERT INTO t VALUES (1, 5, 37, 1.26, 0.1);
+INSERT INTO t VALUES (2, 5, 74, 1.27, 0.1);
+INSERT INTO t VALUES (3, 5, 14, 1.28, 0.1);
+INSERT INTO t VALUES (4, 5, 51, 1.29, 0.1);
+INSERT INTO t VALUES (5, 5, 88, 1.30, 0.1);
+INSERT INTO t VALUES (6, 5, 28, 1.31, 0.1);
+INSERT INTO t VALUES (7, 5, 65, 1.32, 0.1);
+INSERT INTO t VALUES (8, 5, 5, 1.33, 0.1);
+INSERT INTO t VALUES (9, 5, 42, 1.34, 0.1);
+INSERT INTO t VALUES (10, 5, 79, 1.35, 0.1);
+INSERT INTO t VALUES (11, 5, 19, 1.36, 0.1);
+INSERT INTO t VALUES (12, 5, 56, 1.37, 0.1);
+INSERT INTO t VALUES (13, 5, 93, 1.38, 0.1);
+INSERT INTO t VALUES (14, 5, 33, 1.39, 0.1);
+INSERT INTO t VALUES (15, 5, 70, 1.40, 0.1);
+INSERT INTO t VALUES (16, 5, 10, 1.41, 0.1);
+INSERT INTO t VALUES (17, 5, 47, 1.42, 0.1);
+INSERT INTO t VALUES (18, 5, 84, 1.43, 0.1);
+INSERT INTO t VALUES (19, 5, 24, 1.44, 0.1);
+INSERT INTO t VALUES (20, 5, 61, 1.45, 0.1);
+INSERT INTO t VALUES (21, 5, 1, 1.46, 0.1);
+INSERT INTO t VALUES (22, 5, 38, 1.47, 0.1);
+INSERT INTO t VALUES (23, 5, 75, 1.48, 0.1);
+INSERT INTO t VALUES (24, 5, 15, 1.49, 0.1);
+INSERT INTO t VALUES (25, 5, 52, 1.50, 0.1);
+INSERT INTO t VALUES (26, 5, 89, 1.51, 0.1);
+INSERT INTO t VALUES (27, 5, 29, 1.52, 0.1);
+INSERT INTO t VALUES (28, 5, 66, 1.53, 0.1);
+INSERT INTO t VALUES (29, 5, 6, 1.54, 0.1);
+INSERT INTO t VALUES (30, 5, 43, 1.55, 0.1);
+INSERT INTO t VALUES (31, 5, 80, 1.56, 0.1);
+INSERT INTO t VALUES (32, 5, 20, 1.57, 0.1);
+INSERT INTO t VALUES (33, 5, 57, 1.58, 0.1);
+INSERT INTO t VALUES (34, 5, 94, 1.59, 0.1);
+INSERT INTO t VALUES (35, 5, 34, 1.60, 0.1);
+INSERT INTO t VALUES (36, 5, 71, 1.61, 0.1);
+INSERT INTO t VALUES (37, 5, 11, 1.62, 0.1);
+INSERT INTO t VALUES (38, 5, 48, 1.63, 0.1);
+INSERT INTO t VALUES (39, 5, 85, 1.64, 0.1);
+INSERT INTO t VALUES (40, 5, 25, 1.65, 0.1);
+INSERT INTO t VALUES (41, 5, 62, 1.66, 0.1);
+INSERT INTO t VALUES (42, 5, 2, 1.67, 0.1);
+INSERT INTO t VALUES (43, 5, 39, 1.68, 0.1);
+INSERT INTO t VALUES (44, 5, 76, 1.69, 0.1);
+INSERT INTO t VALUES (45, 5, 16, 1.70, 0.1);
+INSERT INTO t VALUES (46, 5, 53, 1.71, 0.1);
+INSERT INTO t VALUES (47, 5, 90, 1.72, 0.1);
+INSERT INTO t VALUES (48, 5, 30, 1.73, 0.1);
+INSERT INTO t VALUES (49, 5, 67, 1.74, 0.1);
+INSERT INTO t VALUES (50, 5, 7, 1.75, 0.1);
+INSERT INTO t VALUES (51, 5, 44, 1.76, 0.1);
+INSERT INTO t VALUES (52, 5, 81, 1.77, 0.1);
+INSERT INTO t VALUES (53, 5, 21, 1.78, 0.1);
+INSERT INTO t VALUES (54, 5, 58, 1.79, 0.1);
+INSERT INTO t VALUES (55, 5, 95, 1.80, 0.1);
+INSERT INTO t VALUES (56, 5, 35, 1.81, 0.1);
+INSERT INTO t VALUES (57, 5, 72, 1.82, 0.1);
+INSERT INTO t VALUES (58, 5, 12, 1.83, 0.1);
+INSERT INTO t VALUES (59, 5, 49, 1.84, 0.1);
+INSERT INTO t VALUES (60, 5, 86, 1.85, 0.1);
+INSERT INTO t VALUES (61, 5, 26, 1.86, 0.1);
+INSERT INTO t VALUES (62, 5, 63, 1.87, 0.1);
+INSERT INTO t VALUES (63, 5, 3, 1.88, 0.1);
+INSERT INTO t VALUES (64, 5, 40, 1.89, 0.1);
+INSERT INTO t VALUES (65, 5, 77, 1.90, 0.1);
+INSERT INTO t VALUES (66, 5, 17, 1.91, 0.1);
+INSERT INTO t VALUES (67, 5, 54, 1.92, 0.1);
+INSERT INTO t VALUES (68, 5, 91, 1.93, 0.1);
+INSERT INTO t VALUES (69, 5, 31, 1.94, 0.1);
+INSERT INTO t VALUES (70, 5, 68, 1.95, 0.1);
+INSERT INTO t VALUES (71, 5, 8, 1.96, 0.1);
+INSERT INTO t VALUES (72, 5, 45, 1.97, 0.1);
+INSERT INTO t VALUES (73, 5, 82, 1.98, 0.1);
+INSERT INTO t VALUES (74, 5, 22, 1.99, 0.1);
+INSERT INTO t VALUES (75, 5, 59, 2.00, 0.1);
+INSERT INTO t VALUES (76, 5, 96, 2.01, 0.1);
+INSERT INTO t VALUES (77, 5, 36, 2.02, 0.1);
+INSERT INTO t VALUES (78, 5, 73, 2.03, 0.1);
+INSERT INTO t VALUES (79, 5, 13, 2.04, 0.1);
+INSERT INTO t VALUES (80, 5, 50, 2.05, 0.1);
+INSERT INTO t VALUES (81, 5, 87, 2.06, 0.1);
+INSERT INTO t VALUES (82, 5, 27, 2.07, 0.1);
+INSERT INTO t VALUES (83, 5, 64, 2.08, 0.1);
+INSERT INTO t VALUES (84, 5, 4, 2.09, 0.1);
+INSERT INTO t VALUES (85, 5, 41, 2.10, 0.1);
+INSERT INTO t VALUES (86, 5, 78, 2.11, 0.1);
+INSERT INTO t VALUES (87, 5, 18, 2.12, 0.1);
+INSERT INTO t VALUES (88, 5, 55, 2.13, 0.1);
+INSERT INTO t VALUES (89, 5, 92, 2.14, 0.1);
+INSERT INTO t VALUES (90, 5, 32, 2.15, 0.1);
+INSERT INTO t VALUES (91, 5, 69, 2.16, 0.1);
+INSERT INTO t VALUES (92, 5, 9, 2.17, 0.1);
+INSERT INTO t VALUES (93, 5, 46, 2.18, 0.1);
+INSERT INTO t VALUES (94, 5, 83, 2.19, 0.1);
+INSERT INTO t VALUES (95, 5, 23, 2.20, 0.1);
+INSERT INTO t VALUES (96, 5, 60, 2.21, 0.1);
+INSERT INTO t VALUES (97, 5, 0, 2.22, 0.1);
+INSERT INTO t VALUES (98, 5, 37, 2.23, 0.1);
+INSERT INTO t VALUES (99, 5, 74, 2.24, 0.1);
+INSERT INTO t VALUES (100, 5, 14, 2.25, 0.1);
+INSERT INTO t VALUES (101, 5, 51, 2.26, 0.1);
+INSERT INTO t VALUES (102, 5, 88, 2.27, 0.1);
+INSERT INTO t VALUES (103, 5, 28, 2.28, 0.1);
+INSERT INTO t VALUES (104, 5, 65, 2.29, 0.1);
+INSERT INTO t VALUES (105, 5, 5, 2.30, 0.1);
+INSERT INTO t VALUES (106, 5, 42, 2.31, 0.1);
+INSERT INTO t VALUES (107, 5, 79, 2.32, 0.1);
+INSERT INTO t VALUES (108, 5, 19, 2.33, 0.1);
+INSERT INTO t VALUES (109, 5, 56, 2.34, 0.1);
+INSERT INTO t VALUES (110, 5, 93, 2.35, 0.1);
+INSERT INTO t VALUES (111, 5, 33, 2.36, 0.1);
+INSERT INTO t VALUES (112, 5, 70, 2.37, 0.1);
+INSERT INTO t VALUES (113, 5, 10, 2.38, 0.1);
+INSERT INTO t VALUES (114, 5, 47, 2.39, 0.1);
+INSERT INTO t VALUES (115, 5, 84, 2.40, 0.1);
+INSERT INTO t VALUES (116, 5, 24, 2.41, 0.1);
+INSERT INTO t VALUES (117, 5, 61, 2.42, 0.1);
+INSERT INTO t VALUES (118, 5, 1, 2.43, 0.1);
+INSERT INTO t VALUES (119, 5, 38, 2.44, 0.1);
+INSERT INTO t VALUES (120, 5, 75, 2.45, 0.1);
+INSERT INTO t VALUES (121, 5, 15, 2.46, 0.1);
+INSERT INTO t VALUES (122, 5, 52, 2.47, 0.1);
+INSERT INTO t VALUES (123, 5, 89, 2.48, 0.1);
+INSERT INTO t VALUES (124, 5, 29, 2.49, 0.1);
+INSERT INTO t VALUES (125, 5, 66, 2.50, 0.1);
+INSERT INTO t VALUES (126, 5, 6, 2.51, 0.1);
+INSERT INTO t VALUES (127, 5, 43, 2.52, 0.1);
+INSERT INTO t VALUES (128, 5, 80, 2.53, 0.1);
+INSERT INTO t VALUES (129, 5, 20, 2.54, 0.1);
+INSERT INTO t VALUES (130, 5, 57, 2.55, 0.1);
+INSERT INTO t VALUES (131, 5, 94, 2.56, 0.1);
+INSERT INTO t VALUES (132, 5, 34, 2.57, 0.1);
+INSERT INTO t VALUES (133, 5, 71, 2.58, 0.1);
+INSERT INTO t VALUES (134, 5, 11, 2.59, 0.1);
+INSERT INTO t VALUES (135, 5, 48, 2.60, 0.1);
+INSERT INTO t VALUES (136, 5, 85, 2.61, 0.1);
+INSERT INTO t VALUES (137, 5, 25, 2.62, 0.1);
+INSERT INTO t VALUES (138, 5, 62, 2.63, 0.1);
+INSERT INTO t VALUES (139, 5, 2, 2.64, 0.1);
+INSERT INTO t VALUES (140, 5, 39, 2.65, 0.1);
+INSERT INTO t VALUES (141, 5, 76, 2.66, 0.1);
+INSERT INTO t VALUES (142, 5, 16, 2.67, 0.1);
+INSERT INTO t VALUES (143, 5, 53, 2.68, 0.1);
+INSERT INTO t VALUES (144, 5, 90, 2.69, 0.1);
+INSERT INTO t VALUES (145, 5, 30, 2.70, 0.1);
+INSERT INTO t VALUES (146, 5, 67, 2.71, 0.1);
+INSERT INTO t VALUES (147, 5, 7, 2.72, 0.1);
+INSERT INTO t VALUES (148, 5, 44, 2.73, 0.1);
+INSERT INTO t VALUES (149, 5, 81, 2.74, 0.1);
+INSERT INTO t VALUES (150, 5, 21, 2.75, 0.1);
+INSERT INTO t VALUES (151, 5, 58, 2.76, 0.1);
+INSERT INTO t VALUES (152, 5, 95, 2.77, 0.1);
+INSERT INTO t VALUES (153, 5, 35, 2.78, 0.1);
+INSERT INTO t VALUES (154, 5, 72, 2.79, 0.1);
+INSERT INTO t VALUES (155, 5, 12, 2.80, 0.1);
+INSERT INTO t VALUES (156, 5, 49, 2.81, 0.1);
+INSERT INTO t VALUES (157, 5, 86, 2.82, 0.1);
+INSERT INTO t VALUES (158, 5, 26, 2.83, 0.1);
+INSERT INTO t VALUES (159, 5, 63, 2.84, 0.1);
+INSERT INTO t VALUES (160, 5, 3, 2.85, 0.1);
+INSERT INTO t VALUES (161, 5, 40, 2.86, 0.1);
+INSERT INTO t VALUES (162, 5, 77, 2.87, 0.1);
+INSERT INTO t VALUES (163, 5, 17, 2.88, 0.1);
+INSERT INTO t VALUES (164, 5, 54, 2.89, 0.1);
+INSERT INTO t VALUES (165, 5, 91, 2.90, 0.1);
+INSERT INTO t VALUES (166, 5, 31, 2.91, 0.1);
+INSERT INTO t VALUES (167, 5, 68, 2.92, 0.1);
+INSERT INTO t VALUES (168, 5, 8, 2.93, 0.1);
+INSERT INTO t VALUES (169, 5, 45, 2.94, 0.1);
+INSERT INTO t VALUES (170, 5, 82, 2.95, 0.1);
+INSERT INTO t VALUES (171, 5, 22, 2.96, 0.1);
+INSERT INTO t VALUES (172, 5, 59, 2.97, 0.1);
+INSERT INTO t VALUES (173, 5, 96, 2.98, 0.1);
+INSERT INTO t VALUES (174, 5, 36, 2.99, 0.1);
+INSERT INTO t VALUES (175, 5, 73, 3.00, 0.1);
+INSERT INTO t VALUES (176, 5, 13, 3.01, 0.1);
+INSERT INTO t VALUES (177, 5, 50, 3.02, 0.1);
+INSERT INTO t VALUES (178, 5, 87, 3.03, 0.1);
+INSERT INTO t VALUES (179, 5, 27, 3.04, 0.1);
+INSERT INTO t VALUES (180, 5, 64, 3.05, 0.1);
+INSERT INTO t VALUES (181, 5, 4, 3.06, 0.1);
+INSERT INTO t VALUES (182, 5, 41, 3.07, 0.1);
+INSERT INTO t VALUES (183, 5, 78, 3.08, 0.1);
+INSERT INTO t VALUES (184, 5, 18, 3.09, 0.1);
+INSERT INTO t VALUES (185, 5, 55, 3.10, 0.1);
+INSERT INTO t VALUES (186, 5, 92, 3.11, 0.1);
+INSERT INTO t VALUES (187, 5, 32, 3.12, 0.1);
+INSERT INTO t VALUES (188, 5, 69, 3.13, 0.1);
+INSERT INTO t VALUES (189, 5, 9, 3.14, 0.1);
+INSERT INTO t VALUES (190, 5, 46, 3.15, 0.1);
+INSERT INTO t VALUES (191, 5, 83, 3.16, 0.1);
+INSERT INTO t VALUES (192, 5, 23, 3.17, 0.1);
+INSERT INTO t VALUES (193, 5, 60, 3.18, 0.1);
+INSERT INTO t VALUES (194, 5, 0, 3.19, 0.1);
+INSERT INTO t VALUES (195, 5, 37, 3.20, 0.1);
+INSERT INTO t VALUES (196, 5, 74, 3.21, 0.1);
+INSERT INTO t VALUES (197, 5, 14, 3.22, 0.1);
+INSERT INTO t VALUES (198, 5, 51, 3.23, 0.1);
+INSERT INTO t VALUES (199, 5, 88, 3.24, 0.1);
+INSERT INTO t VALUES (200, 5, 28, 3.25, 0.1);
+INSERT INTO t VALUES (201, 5, 65, 3.26, 0.1);
+INSERT INTO t VALUES (202, 5, 5, 3.27, 0.1);
+INSERT INTO t VALUES (203, 5, 42, 3.28, 0.1);
+INSERT INTO t VALUES (204, 5, 79, 3.29, 0.1);
+INSERT INTO t VALUES (205, 5, 19, 3.30, 0.1);
+INSERT INTO t VALUES (206, 5, 56, 3.31, 0.1);
+INSERT INTO t VALUES (207, 5, 93, 3.32, 0.1);
+INSERT INTO t VALUES (208, 5, 33, 3.33, 0.1);
+INSERT INTO t VALUES (209, 5, 70, 3.34, 0.1);
+INSERT INTO t VALUES (210, 5, 10, 3.35, 0.1);
+INSERT INTO t VALUES (211, 5, 47, 3.36, 0.1);
+INSERT INTO t VALUES (212, 5, 84, 3.37, 0.1);
+INSERT INTO t VALUES (213, 5, 24, 3.38, 0.1);
+INSERT INTO t VALUES (214, 5, 61, 3.39, 0.1);
+INSERT INTO t VALUES (215, 5, 1, 3.40, 0.1);
+INSERT INTO t VALUES (216, 5, 38, 3.41, 0.1);
+INSERT INTO t VALUES (217, 5, 75, 3.42, 0.1);
+INSERT INTO t VALUES (218, 5, 15, 3.43, 0.1);
+INSERT INTO t VALUES (219, 5, 52, 3.44, 0.1);
+INSERT INTO t VALUES (220, 5, 89, 3.45, 0.1);
+INSERT INTO t VALUES (221, 5, 29, 3.46, 0.1);
+INSERT INTO t VALUES (222, 5, 66, 3.47, 0.1);
+INSERT INTO t VALUES (223, 5, 6, 3.48, 0.1);
+INSERT INTO t VALUES (224, 5, 43, 3.49, 0.1);
+INSERT INTO t VALUES (225, 5, 80, 3.50, 0.1);
+INSERT INTO t VALUES (226, 5, 20, 3.51, 0.1);
+INSERT INTO t VALUES (227, 5, 57, 3.52, 0.1);
+INSERT INTO t VALUES (228, 5, 94, 3.53, 0.1);
+INSERT INTO t VALUES (229, 5, 34, 3.54, 0.1);
+INSERT INTO t VALUES (230, 5, 71, 3.55, 0.1);
+INSERT INTO t VALUES (231, 5, 11, 3.56, 0.1);
+INSERT INTO t VALUES (232, 5, 48, 3.57, 0.1);
+INSERT INTO t VALUES (233, 5, 85, 3.58, 0.1);
+INSERT INTO t VALUES (234, 5, 25, 3.59, 0.1);
+INSERT INTO t VALUES (235, 5, 62, 3.60, 0.1);
+INSERT INTO t VALUES (236, 5, 2, 3.61, 0.1);
+INSERT INTO t VALUES (237, 5, 39, 3.62, 0.1);
+INSERT INTO t VALUES (238, 5, 76, 3.63, 0.1);
+INSERT INTO t VALUES (239, 5, 16, 3.64, 0.1);
+INSERT INTO t VALUES (240, 5, 53, 3.65, 0.1);
+INSERT INTO t VALUES (241, 5, 90, 3.66, 0.1);
+INSERT INTO t VALUES (242, 5, 30, 3.67, 0.1);
+INSERT INTO t VALUES (243, 5, 67, 3.68, 0.1);
+INSERT INTO t VALUES (244, 5, 7, 3.69, 0.1);
+INSERT INTO t VALUES (245, 5, 44, 3.70, 0.1);
+INSERT INTO t VALUES (246, 5, 81, 3.71, 0.1);
+INSERT INTO t VALUES (247, 5, 21, 3.72, 0.1);
+INSERT INTO t VALUES (248, 5, 58, 3.73, 0.1);
+INSERT INTO t VALUES (249, 5, 95, 3.74, 0.1);
+INSERT INTO t VALUES (250, 5, 35, 3.75, 0.1);
+INSERT INTO t VALUES (251, 5, 72, 3.76, 0.1);
+INSERT INTO t VALUES (252, 5, 12, 3.77, 0.1);
+INSERT INTO t VALUES (253, 5, 49, 3.78, 0.1);
+INSERT INTO t VALUES (254, 5, 86, 3.79, 0.1);
+INSERT INTO t VALUES (255, 5, 26, 3.80, 0.1);
+INSERT INTO t VALUES (256, 5, 63, 3.81, 0.1);
+INSERT INTO t VALUES (257, 5, 3, 3.82, 0.1);
+INSERT INTO t VALUES (258, 5, 40, 3.83, 0.1);
+INSERT INTO t VALUES (259, 5, 77, 3.84, 0.1);
+INSERT INTO t VALUES (260, 5, 17, 3.85, 0.1);
+INSERT INTO t VALUES (261, 5, 54, 3.86, 0.1);
+INSERT INTO t VALUES (262, 5, 91, 3.87, 0.1);
+INSERT INTO t VALUES (263, 5, 31, 3.88, 0.1);
+INSERT INTO t VALUES (264, 5, 68, 3.89, 0.1);
+INSERT INTO t VALUES (265, 5, 8, 3.90, 0.1);
+INSERT INTO t VALUES (266, 5, 45, 3.91, 0.1);
+INSERT INTO t VALUES (267, 5, 82, 3.92, 0.1);
+INSERT INTO t VALUES (268, 5, 22, 3.93, 0.1);
+INSERT INTO t VALUES (269, 5, 59, 3.94, 0.1);
+INSERT INTO t VALUES (270, 5, 96, 3.95, 0.1);
+INSERT INTO t VALUES (271, 5, 36, 3.96, 0.1);
+INSERT INTO t VALUES (272, 5, 73, 3.97, 0.1);
+INSERT INTO t VALUES (273, 5, 13, 3.98, 0.1);
+INSERT INTO t VALUES (274, 5, 50, 3.99, 0.1);
+INSERT INTO t VALUES (275, 5, 87, 4.00, 0.1);
+INSERT INTO t VALUES (276, 5, 27, 4.01, 0.1);
+INSERT INTO t VALUES (277, 5, 64, 4.02, 0.1);
+INSERT INTO t VALUES (278, 5, 4, 4.03, 0.1);
+INSERT INTO t VALUES (279, 5, 41, 4.04, 0.1);
+INSERT INTO t VALUES (280, 5, 78, 4.05, 0.1);
+INSERT INTO t VALUES (281, 5, 18, 4.06, 0.1);
+INSERT INTO t VALUES (282, 5, 55, 4.07, 0.1);
+INSERT INTO t VALUES (283, 5, 92, 4.08, 0.1);
+INSERT INTO t VALUES (284, 5, 32, 4.09, 0.1);
+INSERT INTO t VALUES (285, 5, 69, 4.10, 0.1);
+INSERT INTO t VALUES (286, 5, 9, 4.11, 0.1);
+INSERT INTO t VALUES (287, 5, 46, 4.12, 0.1);
+INSERT INTO t VALUES (288, 5, 83, 4.13, 0.1);
+INSERT INTO t VALUES (289, 5, 23, 4.14, 0.1);
+INSERT INTO t VALUES (290, 5, 60, 4.15, 0.1);
+INSERT INTO t VALUES (291, 5, 0, 4.16, 0.1);
+INSERT INTO t VALUES (292, 5, 37, 4.17, 0.1);
+INSERT INTO t VALUES (293, 5, 74, 4.18, 0.1);
+INSERT INTO t VALUES (294, 5, 14, 4.19, 0.1);
+INSERT INTO t VALUES (295, 5, 51, 4.20, 0.1);
+INSERT INTO t VALUES (296, 5, 88, 4.21, 0.1);
+INSERT INTO t VALUES (297, 5, 28, 4.22, 0.1);
+INSERT INTO t VALUES (298, 5, 65, 4.23, 0.1);
+INSERT INTO t VALUES (299, 5, 5, 4.24, 0.1);
+INSERT INTO t VALUES (300, 5, 42, 4.25, 0.1);
+INSERT INTO t VALUES (301, 5, 79, 4.26, 0.1);
+INSERT INTO t VALUES (302, 5, 19, 4.27, 0.1);
+INSERT INTO t VALUES (303, 5, 56, 4.28, 0.1);
+INSERT INTO t VALUES (304, 5, 93, 4.29, 0.1);
+INSERT INTO t VALUES (305, 5, 33, 4.30, 0.1);
+INSERT INTO t VALUES (306, 5, 70, 4.31, 0.1);
+INSERT INTO t VALUES (307, 5, 10, 4.32, 0.1);
+INSERT INTO t VALUES (308, 5, 47, 4.33, 0.1);
+INSERT INTO t VALUES (309, 5, 84, 4.34, 0.1);
+INSERT INTO t VALUES (310, 5, 24, 4.35, 0.1);
+INSERT INTO t VALUES (311, 5, 61, 4.36, 0.1);
+INSERT INTO t VALUES (312, 5, 1, 4.37, 0.1);
+INSERT INTO t VALUES (313, 5, 38, 4.38, 0.1);
+INSERT INTO t VALUES (314, 5, 75, 4.39, 0.1);
+INSERT INTO t VALUES (315, 5, 15, 4.40, 0.1);
+INSERT INTO t VALUES (316, 5, 52, 4.41, 0.1);
+INSERT INTO t VALUES (317, 5, 89, 4.42, 0.1);
+INSERT INTO t VALUES (318, 5, 29, 4.43, 0.1);
+INSERT INTO t VALUES (319, 5, 66, 4.44, 0.1);
+INSERT INTO t VALUES (320, 5, 6, 4.45, 0.1);
+INSERT INTO t VALUES (321, 5, 43, 4.46, 0.1);
+INSERT INTO t VALUES (322, 5, 80, 4.47, 0.1);
+INSERT INTO t VALUES (323, 5, 20, 4.48, 0.1);
+INSERT INTO t VALUES (324, 5, 57, 4.49, 0.1);
+INSERT INTO t VALUES (325, 5, 94, 4.50, 0.1);
+INSERT INTO t VALUES (326, 5, 34, 4.51, 0.1);
+INSERT INTO t VALUES (327, 5, 71, 4.52, 0.1);
+INSERT INTO t VALUES (328, 5, 11, 4.53, 0.1);
+INSERT INTO t VALUES (329, 5, 48, 4.54, 0.1);
+INSERT INTO t VALUES (330, 5, 85, 4.55, 0.1);
+INSERT INTO t VALUES (331, 5, 25, 4.56, 0.1);
+INSERT INTO t VALUES (332, 5, 62, 4.57, 0.1);
+INSERT INTO t VALUES (333, 5, 2, 4.58, 0.1);
+INSERT INTO t VALUES (334, 5, 39, 4.59, 0.1);
+INSERT INTO t VALUES (335, 5, 76, 4.60, 0.1);
+INSERT INTO t VALUES (336, 5, 16, 4.61, 0.1);
+INSERT INTO t VALUES (337, 5, 53, 4.62, 0.1);
+INSERT INTO t VALUES (338, 5, 90, 4.63, 0.1);
+INSERT INTO t VALUES (339, 5, 30, 4.64, 0.1);
+INSERT INTO t VALUES (340, 5, 67, 4.65, 0.1);
+INSERT INTO t VALUES (341, 5, 7, 4.66, 0.1);
+INSERT INTO t VALUES (342, 5, 44, 4.67, 0.1);
+INSERT INTO t VALUES (343, 5, 81, 4.68, 0.1);
+INSERT INTO t VALUES (344, 5, 21, 4.69, 0.1);
+INSERT INTO t VALUES (345, 5, 58, 4.70, 0.1);
+INSERT INTO t VALUES (346, 5, 95, 4.71, 0.1);
+INSERT INTO t VALUES (347, 5, 35, 4.72, 0.1);
+INSERT INTO t VALUES (348, 5, 72, 4.73, 0.1);
+INSERT INTO t VALUES (349, 5, 12, 4.74, 0.1);
+INSERT INTO t VALUES (350, 5, 49, 4.75, 0.1);
+INSERT INTO t VALUES (351, 5, 86, 4.76, 0.1);
+INSERT INTO t VALUES (352, 5, 26, 4.77, 0.1);
+INSERT INTO t VALUES (353, 5, 63, 4.78, 0.1);
+INSERT INTO t VALUES (354, 5, 3, 4.79, 0.1);
+INSERT INTO t VALUES (355, 5, 40, 4.80, 0.1);
+INSERT INTO t VALUES (356, 5, 77, 4.81, 0.1);
+INSERT INTO t VALUES (357, 5, 17, 4.82, 0.1);
+INSERT INTO t VALUES (358, 5, 54, 4.83, 0.1);
+INSERT INTO t VALUES (359, 5, 91, 4.84, 0.1);
+INSERT INTO t VALUES (360, 5, 31, 4.85, 0.1);
+INSERT INTO t VALUES (361, 5, 68, 4.86, 0.1);
+INSERT INTO t VALUES (362, 5, 8, 4.87, 0.1);
+INSERT INTO t VALUES (363, 5, 45, 4.88, 0.1);
+INSERT INTO t VALUES (364, 5, 82, 4.89, 0.1);
+INSERT INTO t VALUES (365, 5, 22, 4.90, 0.1);
+INSERT INTO t VALUES (366, 5, 59, 4.91, 0.1);
+INSERT INTO t VALUES (367, 5, 96, 4.92, 0.1);
+INSERT INTO t VALUES (368, 5, 36, 4.93, 0.1);
+INSERT INTO t VALUES (369, 5, 73, 4.94, 0.1);
+INSERT INTO t VALUES (370, 5, 13, 4.95, 0.1);
+INSERT INTO t VALUES (371, 5, 50, 4.96, 0.1);
+INSERT INTO t VALUES (372, 5, 87, 4.97, 0.1);
+INSERT INTO t VALUES (373, 5, 27, 4.98, 0.1);
+INSERT INTO t VALUES (374, 5, 64, 4.99, 0.1);
+INSERT INTO t VALUES (375, 5, 4, 5.00, 0.1);
+INSERT INTO t VALUES (376, 5, 41, 5.01, 0.1);
+INSERT INTO t VALUES (377, 5, 78, 5.02, 0.1);
+INSERT INTO t VALUES (378, 5, 18, 5.03, 0.1);
+INSERT INTO t VALUES (379, 5, 55, 5.04, 0.1);
+INSERT INTO t VALUES (380, 5, 92, 5.05, 0.1);
+INSERT INTO t VALUES (381, 5, 32, 5.06, 0.1);
+INSERT INTO t VALUES (382, 5, 69, 5.07, 0.1);
+INSERT INTO t VALUES (383, 5, 9, 5.08, 0.1);
+INSERT INTO t VALUES (384, 5, 46, 5.09, 0.1);
+INSERT INTO t VALUES (385, 5, 83, 5.10, 0.1);
+INSERT INTO t VALUES (386, 5, 23, 5.11, 0.1);
+INSERT INTO t VALUES (387, 5, 60, 5.12, 0.1);
+INSERT INTO t VALUES (388, 5, 0, 5.13, 0.1);
+INSERT INTO t VALUES (389, 5, 37, 5.14, 0.1);
+INSERT INTO t VALUES (390, 5, 74, 5.15, 0.1);
+INSERT INTO t VALUES (391, 5, 14, 5.16, 0.1);
+INSERT INTO t VALUES (392, 5, 51, 5.17, 0.1);
+INSERT INTO t VALUES (393, 5, 88, 5.18, 0.1);
+INSERT INTO t VALUES (394, 5, 28, 5.19, 0.1);
+INSERT INTO t VALUES (395, 5, 65, 5.20, 0.1);
+INSERT INTO t VALUES (396, 5, 5, 5.21, 0.1);
+INSERT INTO t VALUES (397, 5, 42, 5.22, 0.1);
+INSERT INTO t VALUES (398, 5, 79, 5.23, 0.1);
+INSERT INTO t VALUES (399, 5, 19, 5.24, 0.1);
+INSERT INTO t VALUES (400, 5, 56, 5.25, 0.1);
+INSERT INTO t VALUES (401, 5, 93, 5.26, 0.1);
+INSERT INTO t VALUES (402, 5, 33, 5.27, 0.1);
+INSERT INTO t VALUES (403, 5, 70, 5.28, 0.1);
+INSERT INTO t VALUES (404, 5, 10, 5.29, 0.1);
+INSERT INTO t VALUES (405, 5, 47, 5.30, 0.1);
+INSERT INTO t VALUES (406, 5, 84, 5.31, 0.1);
+INSERT INTO t VALUES (407, 5, 24, 5.32, 0.1);
+INSERT INTO t VALUES (408, 5, 61, 5.33, 0.1);
+INSERT INTO t VALUES (409, 5, 1, 5.34, 0.1);
+INSERT INTO t VALUES (410, 5, 38, 5.35, 0.1);
+INSERT INTO t VALUES (411, 5, 75, 5.36, 0.1);
+INSERT INTO t VALUES (412, 5, 15, 5.37, 0.1);
+INSERT INTO t VALUES (413, 5, 52, 5.38, 0.1);
+INSERT INTO t VALUES (414, 5, 89, 5.39, 0.1);
+INSERT INTO t VALUES (415, 5, 29, 5.40, 0.1);
+INSERT INTO t VALUES (416, 5, 66, 5.41, 0.1);
+INSERT INTO t VALUES (417, 5, 6, 5.42, 0.1);
+INSERT INTO t VALUES (418, 5, 43, 5.43, 0.1);
+INSERT INTO t VALUES (419, 5, 80, 5.44, 0.1);
+INSERT INTO t VALUES (420, 5, 20, 5.45, 0.1);
+INSERT INTO t VALUES (421, 5, 57, 5.46, 0.1);
+INSERT INTO t VALUES (422, 5, 94, 5.47, 0.1);
+INSERT INTO t VALUES (423, 5, 34, 5.48, 0.1);
+INSERT INTO t VALUES (424, 5, 71, 5.49, 0.1);
+INSERT INTO t VALUES (425, 5, 11, 5.50, 0.1);
+INSERT INTO t VALUES (426, 5, 48, 5.51, 0.1);
+INSERT INTO t VALUES (427, 5, 85, 5.52, 0.1);
+INSERT INTO t VALUES (428, 5, 25, 5.53, 0.1);
+INSERT INTO t VALUES (429, 5, 62, 5.54, 0.1);
+INSERT INTO t VALUES (430, 5, 2, 5.55, 0.1);
+INSERT INTO t VALUES (431, 5, 39, 5.56, 0.1);
+INSERT INTO t VALUES (432, 5, 76, 5.57, 0.1);
+INSERT INTO t VALUES (433, 5, 16, 5.58, 0.1);
+INSERT INTO t VALUES (434, 5, 53, 5.59, 0.1);
+INSERT INTO t VALUES (435, 5, 90, 5.60, 0.1);
+INSERT INTO t VALUES (436, 5, 30, 5.61, 0.1);
+INSERT INTO t VALUES (437, 5, 67, 5.62, 0.1);
+INSERT INTO t VALUES (438, 5, 7, 5.63, 0.1);
+INSERT INTO t VALUES (439, 5, 44, 5.64, 0.1);
+INSERT INTO t VALUES (440, 5, 81, 5.65, 0.1);
+INSERT INTO t VALUES (441, 5, 21, 5.66, 0.1);
+INSERT INTO t VALUES (442, 5, 58, 5.67, 0.1);
+INSERT INTO t VALUES (443, 5, 95, 5.68, 0.1);
+INSERT INTO t VALUES (444, 5, 35, 5.69, 0.1);
+INSERT INTO t VALUES (445, 5, 72, 5.70, 0.1);
+INSERT INTO t VALUES (446, 5, 12, 5.71, 0.1);
+INSERT INTO t VALUES (447, 5, 49, 5.72, 0.1);
+INSERT INTO t VALUES (448, 5, 86, 5.73, 0.1);
+INSERT INTO t VALUES (449, 5, 26, 5.74, 0.1);
+INSERT INTO t VALUES (450, 5, 63, 5.75, 0.1);
+INSERT INTO t VALUES (451, 5, 3, 5.76, 0.1);
+INSERT INTO t VALUES (452, 5, 40, 5.77, 0.1);
+INSERT INTO t VALUES (453, 5, 77, 5.78, 0.1);
+INSERT INTO t VALUES (454, 5, 17, 5.79, 0.1);
+INSERT INTO t VALUES (455, 5, 54, 5.80, 0.1);
+INSERT INTO t VALUES (456, 5, 91, 5.81, 0.1);
+INSERT INTO t VALUES (457, 5, 31, 5.82, 0.1);
+INSERT INTO t VALUES (458, 5, 68, 5.83, 0.1);
+INSERT INTO t VALUES (459, 5, 8, 5.84, 0.1);
+INSERT INTO t VALUES (460, 5, 45, 5.85, 0.1);
+INSERT INTO t VALUES (461, 5, 82, 5.86, 0.1);
+INSERT INTO t VALUES (462, 5, 22, 5.87, 0.1);
+INSERT INTO t VALUES (463, 5, 59, 5.88, 0.1);
+INSERT INTO t VALUES (464, 5, 96, 5.89, 0.1);
+INSERT INTO t VALUES (465, 5, 36, 5.90, 0.1);
+INSERT INTO t VALUES (466, 5, 73, 5.91, 0.1);
+INSERT INTO t VALUES (467, 5, 13, 5.92, 0.1);
+INSERT INTO t VALUES (468, 5, 50, 5.93, 0.1);
+INSERT INTO t VALUES (469, 5, 87, 5.94, 0.1);
+INSERT INTO t VALUES (470, 5, 27, 5.95, 0.1);
+INSERT INTO t VALUES (471, 5, 64, 5.96, 0.1);
+INSERT INTO t VALUES (472, 5, 4, 5.97, 0.1);
+INSERT INTO t VALUES (473, 5, 41, 5.98, 0.1);
+INSERT INTO t VALUES (474, 5, 78, 5.99, 0.1);
+INSERT INTO t VALUES (475, 5, 18, 6.00, 0.1);
+INSERT INTO t VALUES (476, 5, 55, 6.01, 0.1);
+INSERT INTO t VALUES (477, 5, 92, 6.02, 0.1);
+INSERT INTO t VALUES (478, 5, 32, 6.03, 0.1);
+INSERT INTO t VALUES (479, 5, 69, 6.04, 0.1);
+INSERT INTO t VALUES (480, 5, 9, 6.05, 0.1);
+INSERT INTO t VALUES (481, 5, 46, 6.06, 0.1);
+INSERT INTO t VALUES (482, 5, 83, 6.07, 0.1);
+INSERT INTO t VALUES (483, 5, 23, 6.08, 0.1);
+INSERT INTO t VALUES (484, 5, 60, 6.09, 0.1);
+INSERT INTO t VALUES (485, 5, 0, 6.10, 0.1);
+INSERT INTO t VALUES (486, 5, 37, 6.11, 0.1);
+INSERT INTO t VALUES (487, 5, 74, 6.12, 0.1);
+INSERT INTO t VALUES (488, 5, 14, 6.13, 0.1);
+INSERT INTO t VALUES (489, 5, 51, 6.14, 0.1);
+INSERT INTO t VALUES (490, 5, 88, 6.15, 0.1);
+INSERT INTO t VALUES (491, 5, 28, 6.16, 0.1);
+INSERT INTO t VALUES (492, 5, 65, 6.17, 0.1);
+INSERT INTO t VALUES (493, 5, 5, 6.18, 0.1);
+INSERT INTO t VALUES (494, 5, 42, 6.19, 0.1);
+INSERT INTO t VALUES (495, 5, 79, 6.20, 0.1);
+INSERT INTO t VALUES (496, 5, 19, 6.21, 0.1);
+INSERT INTO t VALUES (497, 5, 56, 6.22, 0.1);
+INSERT INTO t VALUES (498, 5, 93, 6.23, 0.1);
+INSERT INTO t VALUES (499, 5, 33, 6.24, 0.1);
+INSERT INTO t VALUES (500, 5, 70, 6.25, 0.1);
+INSERT INTO t VALUES (501, 5, 10, 6.26, 0.1);
+INSERT INTO t VALUES (502, 5, 47, 6.27, 0.1);
+INSERT INTO t VALUES (503, 5, 84, 6.28, 0.1);
+INSERT INTO t VALUES (504, 5, 24, 6.29, 0.1);
+INSERT INTO t VALUES (505, 5, 61, 6.30, 0.1);
+INSERT INTO t VALUES (506, 5, 1, 6.31, 0.1);
+INSERT INTO t VALUES (507, 5, 38, 6.32, 0.1);
+INSERT INTO t VALUES (508, 5, 75, 6.33, 0.1);
+INSERT INTO t VALUES (509, 5, 15, 6.34, 0.1);
+INSERT INTO t VALUES (510, 5, 52, 6.35, 0.1);
+INSERT INTO t VALUES (511, 5, 89, 6.36, 0.1);
+INSERT INTO t VALUES (512, 5, 29, 6.37, 0.1);
+INSERT INTO t VALUES (513, 5, 66, 6.38, 0.1);
+INSERT INTO t VALUES (514, 5, 6, 6.39, 0.1);
+INSERT INTO t VALUES (515, 5, 43, 6.40, 0.1);
+INSERT INTO t VALUES (516, 5, 80, 6.41, 0.1);
+INSERT INTO t VALUES (517, 5, 20, 6.42, 0.1);
+INSERT INTO t VALUES (518, 5, 57, 6.43, 0.1);
+INSERT INTO t VALUES (519, 5, 94, 6.44, 0.1);
+INSERT INTO t VALUES (520, 5, 34, 6.45, 0.1);
+INSERT INTO t VALUES (521, 5, 71, 6.46, 0.1);
+INSERT INTO t VALUES (522, 5, 11, 6.47, 0.1);
+INSERT INTO t VALUES (523, 5, 48, 6.48, 0.1);
+INSERT INTO t VALUES (524, 5, 85, 6.49, 0.1);
+INSERT INTO t VALUES (525, 5, 25, 6.50, 0.1);
+INSERT INTO t VALUES (526, 5, 62, 6.51, 0.1);
+INSERT INTO t VALUES (527, 5, 2, 6.52, 0.1);
+INSERT INTO t VALUES (528, 5, 39, 6.53, 0.1);
+INSERT INTO t VALUES (529, 5, 76, 6.54, 0.1);
+INSERT INTO t VALUES (530, 5, 16, 6.55, 0.1);
+INSERT INTO t VALUES (531, 5, 53, 6.56, 0.1);
+INSERT INTO t VALUES (532, 5, 90, 6.57, 0.1);
+INSERT INTO t VALUES (533, 5, 30, 6.58, 0.1);
+INSERT INTO t VALUES (534, 5, 67, 6.59, 0.1);
+INSERT INTO t VALUES (535, 5, 7, 6.60, 0.1);
+INSERT INTO t VALUES (536, 5, 44, 6.61, 0.1);
+INSERT INTO t VALUES (537, 5, 81, 6.62, 0.1);
+INSERT INTO t VALUES (538, 5, 21, 6.63, 0.1);
+INSERT INTO t VALUES (539, 5, 58, 6.64, 0.1);
+INSERT INTO t VALUES (540, 5, 95, 6.65, 0.1);
+INSERT INTO t VALUES (541, 5, 35, 6.66, 0.1);
+INSERT INTO t VALUES (542, 5, 72, 6.67, 0.1);
+INSERT INTO t VALUES (543, 5, 12, 6.68, 0.1);
+INSERT INTO t VALUES (544, 5, 49, 6.69, 0.1);
+INSERT INTO t VALUES (545, 5, 86, 6.70, 0.1);
+INSERT INTO t VALUES (546, 5, 26, 6.71, 0.1);
+INSERT INTO t VALUES (547, 5, 63, 6.72, 0.1);
+INSERT INTO t VALUES (548, 5, 3, 6.73, 0.1);
+INSERT INTO t VALUES (549, 5, 40, 6.74, 0.1);
+INSERT INTO t VALUES (550, 5, 77, 6.75, 0.1);
+INSERT INTO t VALUES (551, 5, 17, 6.76, 0.1);
+INSERT INTO t VALUES (552, 5, 54, 6.77, 0.1);
+INSERT INTO t VALUES (553, 5, 91, 6.78, 0.1);
+INSERT INTO t VALUES (554, 5, 31, 6.79, 0.1);
+INSERT INTO t VALUES (555, 5, 68, 6.80, 0.1);
+INSERT INTO t VALUES (556, 5, 8, 6.81, 0.1);
+INSERT INTO t VALUES (557, 5, 45, 6.82, 0.1);
+INSERT INTO t VALUES (558, 5, 82, 6.83, 0.1);
+INSERT INTO t VALUES (559, 5, 22, 6.84, 0.1);
+INSERT INTO t VALUES (560, 5, 59, 6.85, 0.1);
+INSERT INTO t VALUES (561, 5, 96, 6.86, 0.1);
+INSERT INTO t VALUES (562, 5, 36, 6.87, 0.1);
+INSERT INTO t VALUES (563, 5, 73, 6.88, 0.1);
+INSERT INTO t VALUES (564, 5, 13, 6.89, 0.1);
+INSERT INTO t VALUES (565, 5, 50, 6.90, 0.1);
+INSERT INTO t VALUES (566, 5, 87, 6.91, 0.1);
+INSERT INTO t VALUES (567, 5, 27, 6.92, 0.1);
+INSERT INTO t VALUES (568, 5, 64, 6.93, 0.1);
+INSERT INTO t VALUES (569, 5, 4, 6.94, 0.1);
+INSERT INTO t VALUES (570, 5, 41, 6.95, 0.1);
+INSERT INTO t VALUES (571, 5, 78, 6.96, 0.1);
+INSERT INTO t VALUES (572, 5, 18, 6.97, 0.1);
+INSERT INTO t VALUES (573, 5, 55, 6.98, 0.1);
+INSERT INTO t VALUES (574, 5, 92, 6.99, 0.1);
+INSERT INTO t VALUES (575, 5, 32, 7.00, 0.1);
+INSERT INTO t VALUES (576, 5, 69, 7.01, 0.1);
+INSERT INTO t VALUES (577, 5, 9, 7.02, 0.1);
+INSERT INTO t VALUES (578, 5, 46, 7.03, 0.1);
+INSERT INTO t VALUES (579, 5, 83, 7.04, 0.1);
+INSERT INTO t VALUES (580, 5, 23, 7.05, 0.1);
+INSERT INTO t VALUES (581, 5, 60, 7.06, 0.1);
+INSERT INTO t VALUES (582, 5, 0, 7.07, 0.1);
+INSERT INTO t VALUES (583, 5, 37, 7.08, 0.1);
+INSERT INTO t VALUES (584, 5, 74, 7.09, 0.1);
+INSERT INTO t VALUES (585, 5, 14, 7.10, 0.1);
+INSERT INTO t VALUES (586, 5, 51, 7.11, 0.1);
+INSERT INTO t VALUES (587, 5, 88, 7.12, 0.1);
+INSERT INTO t VALUES (588, 5, 28, 7.13, 0.1);
+INSERT INTO t VALUES (589, 5, 65, 7.14, 0.1);
+INSERT INTO t VALUES (590, 5, 5, 7.15, 0.1);
+INSERT INTO t VALUES (591, 5, 42, 7.16, 0.1);
+INSERT INTO t VALUES (592, 5, 79, 7.17, 0.1);
+INSERT INTO t VALUES (593, 5, 19, 7.18, 0.1);
+INSERT INTO t VALUES (594, 5, 56, 7.19, 0.1);
+INSERT INTO t VALUES (595, 5, 93, 7.20, 0.1);
+INSERT INTO t VALUES (596, 5, 33, 7.21, 0.1);
+INSERT INTO t VALUES (597, 5, 70, 7.22, 0.1);
+INSERT INTO t VALUES (598, 5, 10, 7.23, 0.1);
+INSERT INTO t VALUES (599, 5, 47, 7.24, 0.1);
+INSERT INTO t VALUES (600, 5, 84, 7.25, 0.1);
+INSERT INTO t VALUES (601, 5, 24, 7.26, 0.1);
+INSERT INTO t VALUES (602, 5, 61, 7.27, 0.1);
+INSERT INTO t VALUES (603, 5, 1, 7.28, 0.1);
+INSERT INTO t VALUES (604, 5, 38, 7.29, 0.1);
+INSERT INTO t VALUES (605, 5, 75, 7.30, 0.1);
+INSERT INTO t VALUES (606, 5, 15, 7.31, 0.1);
+INSERT INTO t VALUES (607, 5, 52, 7.32, 0.1);
+INSERT INTO t VALUES (608, 5, 89, 7.33, 0.1);
+INSERT INTO t VALUES (609, 5, 29, 7.34, 0.1);
+INSERT INTO t VALUES (610, 5, 66, 7.35, 0.1);
+INSERT INTO t VALUES (611, 5, 6, 7.36, 0.1);
+INSERT INTO t VALUES (612, 5, 43, 7.37, 0.1);
+INSERT INTO t VALUES (613, 5, 80, 7.38, 0.1);
+INSERT INTO t VALUES (614, 5, 20, 7.39, 0.1);
+INSERT INTO t VALUES (615, 5, 57, 7.40, 0.1);
+INSERT INTO t VALUES (616, 5, 94, 7.41, 0.1);
+INSERT INTO t VALUES (617, 5, 34, 7.42, 0.1);
+INSERT INTO t VALUES (618, 5, 71, 7.43, 0.1);
+INSERT INTO t VALUES (619, 5, 11, 7.44, 0.1);
+INSERT INTO t VALUES (620, 5, 48, 7.45, 0.1);
+INSERT INTO t VALUES (621, 5, 85, 7.46, 0.1);
+INSERT INTO t VALUES (622, 5, 25, 7.47, 0.1);
+INSERT INTO t VALUES (623, 5, 62, 7.48, 0.1);
+INSERT INTO t VALUES (624, 5, 2, 7.49, 0.1);
+INSERT INTO t VALUES (625, 5, 39, 7.50, 0.1);
+INSERT INTO t VALUES (626, 5, 76, 7.51, 0.1);
+INSERT INTO t VALUES (627, 5, 16, 7.52, 0.1);
+INSERT INTO t VALUES (628, 5, 53, 7.53, 0.1);
+INSERT INTO t VALUES (629, 5, 90, 7.54, 0.1);
+INSERT INTO t VALUES (630, 5, 30, 7.55, 0.1);
+INSERT INTO t VALUES (631, 5, 67, 7.56, 0.1);
+INSERT INTO t VALUES (632, 5, 7, 7.57, 0.1);
+INSERT INTO t VALUES (633, 5, 44, 7.58, 0.1);
+INSERT INTO t VALUES (634, 5, 81, 7.59, 0.1);
+INSERT INTO t VALUES (635, 5, 21, 7.60, 0.1);
+INSERT INTO t VALUES (636, 5, 58, 7.61, 0.1);
+INSERT INTO t VALUES (637, 5, 95, 7.62, 0.1);
+INSERT INTO t VALUES (638, 5, 35, 7.63, 0.1);
+INSERT INTO t VALUES (639, 5, 72, 7.64, 0.1);
+INSERT INTO t VALUES (640, 5, 12, 7.65, 0.1);
+INSERT INTO t VALUES (641, 5, 49, 7.66, 0.1);
+INSERT INTO t VALUES (642, 5, 86, 7.67, 0.1);
+INSERT INTO t VALUES (643, 5, 26, 7.68, 0.1);
+INSERT INTO t VALUES (644, 5, 63, 7.69, 0.1);
+INSERT INTO t VALUES (645, 5, 3, 7.70, 0.1);
+INSERT INTO t VALUES (646, 5, 40, 7.71, 0.1);
+INSERT INTO t VALUES (647, 5, 77, 7.72, 0.1);
+INSERT INTO t VALUES (648, 5, 17, 7.73, 0.1);
+INSERT INTO t VALUES (649, 5, 54, 7.74, 0.1);
+INSERT INTO t VALUES (650, 5, 91, 7.75, 0.1);
+INSERT INTO t VALUES (651, 5, 31, 7.76, 0.1);
+INSERT INTO t VALUES (652, 5, 68, 7.77, 0.1);
+INSERT INTO t VALUES (653, 5, 8, 7.78, 0.1);
+INSERT INTO t VALUES (654, 5, 45, 7.79, 0.1);
+INSERT INTO t VALUES (655, 5, 82, 7.80, 0.1);
+INSERT INTO t VALUES (656, 5, 22, 7.81, 0.1);
+INSERT INTO t VALUES (657, 5, 59, 7.82, 0.1);
+INSERT INTO t VALUES (658, 5, 96, 7.83, 0.1);
+INSERT INTO t VALUES (659, 5, 36, 7.84, 0.1);
+INSERT INTO t VALUES (660, 5, 73, 7.85, 0.1);
+INSERT INTO t VALUES (661, 5, 13, 7.86, 0.1);
+INSERT INTO t VALUES (662, 5, 50, 7.87, 0.1);
+INSERT INTO t VALUES (663, 5, 87, 7.88, 0.1);
+INSERT INTO t VALUES (664, 5, 27, 7.89, 0.1);
+INSERT INTO t VALUES (665, 5, 64, 7.90, 0.1);
+INSERT INTO t VALUES (666, 5, 4, 7.91, 0.1);
+INSERT INTO t VALUES (667, 5, 41, 7.92, 0.1);
+INSERT INTO t VALUES (668, 5, 78, 7.93, 0.1);
+INSERT INTO t VALUES (669, 5, 18, 7.94, 0.1);
+INSERT INTO t VALUES (670, 5, 55, 7.95, 0.1);
+INSERT INTO t VALUES (671, 5, 92, 7.96, 0.1);
+INSERT INTO t VALUES (672, 5, 32, 7.97, 0.1);
+INSERT INTO t VALUES (673, 5, 69, 7.98, 0.1);
+INSERT INTO t VALUES (674, 5, 9, 7.99, 0.1);
+INSERT INTO t VALUES (675, 5, 46, 8.00, 0.1);
+INSERT INTO t VALUES (676, 5, 83, 8.01, 0.1);
+INSERT INTO t VALUES (677, 5, 23, 8.02, 0.1);
+INSERT INTO t VALUES (678, 5, 60, 8.03, 0.1);
+INSERT INTO t VALUES (679, 5, 0, 8.04, 0.1);
+INSERT INTO t VALUES (680, 5, 37, 8.05, 0.1);
+INSERT INTO t VALUES (681, 5, 74, 8.06, 0.1);
+INSERT INTO t VALUES (682, 5, 14, 8.07, 0.1);
+INSERT INTO t VALUES (683, 5, 51, 8.08, 0.1);
+INSERT INTO t VALUES (684, 5, 88, 8.09, 0.1);
+INSERT INTO t VALUES (685, 5, 28, 8.10, 0.1);
+INSERT INTO t VALUES (686, 5, 65, 8.11, 0.1);
+INSERT INTO t VALUES (687, 5, 5, 8.12, 0.1);
+INSERT INTO t VALUES (688, 5, 42, 8.13, 0.1);
+INSERT INTO t VALUES (689, 5, 79, 8.14, 0.1);
+INSERT INTO t VALUES (690, 5, 19, 8.15, 0.1);
+INSERT INTO t VALUES (691, 5, 56, 8.16, 0.1);
+INSERT INTO t VALUES (692, 5, 93, 8.17, 0.1);
+INSERT INTO t VALUES (693, 5, 33, 8.18, 0.1);
+INSERT INTO t VALUES (694, 5, 70, 8.19, 0.1);
+INSERT INTO t VALUES (695, 5, 10, 8.20, 0.1);
+INSERT INTO t VALUES (696, 5, 47, 8.21, 0.1);
+INSERT INTO t VALUES (697, 5, 84, 8.22, 0.1);
+INSERT INTO t VALUES (698, 5, 24, 8.23, 0.1);
+INSERT INTO t VALUES (699, 5, 61, 8.24, 0.1);
+INSERT INTO t VALUES (700, 5, 1, 8.25, 0.1);
+INSERT INTO t VALUES (701, 5, 38, 8.26, 0.1);
+INSERT INTO t VALUES (702, 5, 75, 8.27, 0.1);
+INSERT INTO t VALUES (703, 5, 15, 8.28, 0.1);
+INSERT INTO t VALUES (704, 5, 52, 8.29, 0.1);
+INSERT INTO t VALUES (705, 5, 89, 8.30, 0.1);
+INSERT INTO t VALUES (706, 5, 29, 8.31, 0.1);
+INSERT INTO t VALUES (707, 5, 66, 8.32, 0.1);
+INSERT INTO t VALUES (708, 5, 6, 8.33, 0.1);
+INSERT INTO t VALUES (709, 5, 43, 8.34, 0.1);
+INSERT INTO t VALUES (710, 5, 80, 8.35, 0.1);
+INSERT INTO t VALUES (711, 5, 20, 8.36, 0.1);
+INSERT INTO t VALUES (712, 5, 57, 8.37, 0.1);
+INSERT INTO t VALUES (713, 5, 94, 8.38, 0.1);
+INSERT INTO t VALUES (714, 5, 34, 8.39, 0.1);
+INSERT INTO t VALUES (715, 5, 71, 8.40, 0.1);
+INSERT INTO t VALUES (716, 5, 11, 8.41, 0.1);
+INSERT INTO t VALUES (717, 5, 48, 8.42, 0.1);
+INSERT INTO t VALUES (718, 5, 85, 8.43, 0.1);
+INSERT INTO t VALUES (719, 5, 25, 8.44, 0.1);
+INSERT INTO t VALUES (720, 5, 62, 8.45, 0.1);
+INSERT INTO t VALUES (721, 5, 2, 8.46, 0.1);
+INSERT INTO t VALUES (722, 5, 39, 8.47, 0.1);
+INSERT INTO t VALUES (723, 5, 76, 8.48, 0.1);
+INSERT INTO t VALUES (724, 5, 16, 8.49, 0.1);
+INSERT INTO t VALUES (725, 5, 53, 8.50, 0.1);
+INSERT INTO t VALUES (726, 5, 90, 8.51, 0.1);
+INSERT INTO t VALUES (727, 5, 30, 8.52, 0.1);
+INSERT INTO t VALUES (728, 5, 67, 8.53, 0.1);
+INSERT INTO t VALUES (729, 5, 7, 8.54, 0.1);
+INSERT INTO t VALUES (730, 5, 44, 8.55, 0.1);
+INSERT INTO t VALUES (731, 5, 81, 8.56, 0.1);
+INSERT INTO t VALUES (732, 5, 21, 8.57, 0.1);
+INSERT INTO t VALUES (733, 5, 58, 8.58, 0.1);
+INSERT INTO t VALUES (734, 5, 95, 8.59, 0.1);
+INSERT INTO t VALUES (735, 5, 35, 8.60, 0.1);
+INSERT INTO t VALUES (736, 5, 72, 8.61, 0.1);
+INSERT INTO t VALUES (737, 5, 12, 8.62, 0.1);
+INSERT INTO t VALUES (738, 5, 49, 8.63, 0.1);
+INSERT INTO t VALUES (739, 5, 86, 8.64, 0.1);
+INSERT INTO t VALUES (740, 5, 26, 8.65, 0.1);
+INSERT INTO t VALUES (741, 5, 63, 8.66, 0.1);
+INSERT INTO t VALUES (742, 5, 3, 8.67, 0.1);
+INSERT INTO t VALUES (743, 5, 40, 8.68, 0.1);
+INSERT INTO t VALUES (744, 5, 77, 8.69, 0.1);
+INSERT INTO t VALUES (745, 5, 17, 8.70, 0.1);
+INSERT INTO t VALUES (746, 5, 54, 8.71, 0.1);
+INSERT INTO t VALUES (747, 5, 91, 8.72, 0.1);
+INSERT INTO t VALUES (748, 5, 31, 8.73, 0.1);
+INSERT INTO t VALUES (749, 5, 68, 8.74, 0.1);
+INSERT INTO t VALUES (750, 5, 8, 8.75, 0.1);
+INSERT INTO t VALUES (751, 5, 45, 8.76, 0.1);
+INSERT INTO t VALUES (752, 5, 82, 8.77, 0.1);
+INSERT INTO t VALUES (753, 5, 22, 8.78, 0.1);
+INSERT INTO t VALUES (754, 5, 59, 8.79, 0.1);
+INSERT INTO t VALUES (755, 5, 96, 8.80, 0.1);
+INSERT INTO t VALUES (756, 5, 36, 8.81, 0.1);
+INSERT INTO t VALUES (757, 5, 73, 8.82, 0.1);
+INSERT INTO t VALUES (758, 5, 13, 8.83, 0.1);
+INSERT INTO t VALUES (759, 5, 50, 8.84, 0.1);
+INSERT INTO t VALUES (760, 5, 87, 8.85, 0.1);
+INSERT INTO t VALUES (761, 5, 27, 8.86, 0.1);
+INSERT INTO t VALUES (762, 5, 64, 8.87, 0.1);
+INSERT INTO t VALUES (763, 5, 4, 8.88, 0.1);
+INSERT INTO t VALUES (764, 5, 41, 8.89, 0.1);
+INSERT INTO t VALUES (765, 5, 78, 8.90, 0.1);
+INSERT INTO t VALUES (766, 5, 18, 8.91, 0.1);
+INSERT INTO t VALUES (767, 5, 55, 8.92, 0.1);
+INSERT INTO t VALUES (768, 5, 92, 8.93, 0.1);
+INSERT INTO t VALUES (769, 5, 32, 8.94, 0.1);
+INSERT INTO t VALUES (770, 5, 69, 8.95, 0.1);
+INSERT INTO t VALUES (771, 5, 9, 8.96, 0.1);
+INSERT INTO t VALUES (772, 5, 46, 8.97, 0.1);
+INSERT INTO t VALUES (773, 5, 83, 8.98, 0.1);
+INSERT INTO t VALUES (774, 5, 23, 8.99, 0.1);
+INSERT INTO t VALUES (775, 5, 60, 9.00, 0.1);
+INSERT INTO t VALUES (776, 5, 0, 9.01, 0.1);
+INSERT INTO t VALUES (777, 5, 37, 9.02, 0.1);
+INSERT INTO t VALUES (778, 5, 74, 9.03, 0.1);
+INSERT INTO t VALUES (779, 5, 14, 9.04, 0.1);
+INSERT INTO t VALUES (780, 5, 51, 9.05, 0.1);
+INSERT INTO t VALUES (781, 5, 88, 9.06, 0.1);
+INSERT INTO t VALUES (782, 5, 28, 9.07, 0.1);
+INSERT INTO t VALUES (783, 5, 65, 9.08, 0.1);
+INSERT INTO t VALUES (784, 5, 5, 9.09, 0.1);
+INSERT INTO t VALUES (785, 5, 42, 9.10, 0.1);
+INSERT INTO t VALUES (786, 5, 79, 9.11, 0.1);
+INSERT INTO t VALUES (787, 5, 19, 9.12, 0.1);
+INSERT INTO t VALUES (788, 5, 56, 9.13, 0.1);
+INSERT INTO t VALUES (789, 5, 93, 9.14, 0.1);
+INSERT INTO t VALUES (790, 5, 33, 9.15, 0.1);
+INSERT INTO t VALUES (791, 5, 70, 9.16, 0.1);
+INSERT INTO t VALUES (792, 5, 10, 9.17, 0.1);
+INSERT INTO t VALUES (793, 5, 47, 9.18, 0.1);
+INSERT INTO t VALUES (794, 5, 84, 9.19, 0.1);
+INSERT INTO t VALUES (795, 5, 24, 9.20, 0.1);
+INSERT INTO t VALUES (796, 5, 61, 9.21, 0.1);
+INSERT INTO t VALUES (797, 5, 1, 9.22, 0.1);
+INSERT INTO t VALUES (798, 5, 38, 9.23, 0.1);
+INSERT INTO t VALUES (799, 5, 75, 9.24, 0.1);
+INSERT INTO t VALUES (800, 5, 15, 9.25, 0.1);
+INSERT INTO t VALUES (801, 5, 52, 9.26, 0.1);
+INSERT INTO t VALUES (802, 5, 89, 9.27, 0.1);
+INSERT INTO t VALUES (803, 5, 29, 9.28, 0.1);
+INSERT INTO t VALUES (804, 5, 66, 9.29, 0.1);
+INSERT INTO t VALUES (805, 5, 6, 9.30, 0.1);
+INSERT INTO t VALUES (806, 5, 43, 9.31, 0.1);
+INSERT INTO t VALUES (807, 5, 80, 9.32, 0.1);
+INSERT INTO t VALUES (808, 5, 20, 9.33, 0.1);
+INSERT INTO t VALUES (809, 5, 57, 9.34, 0.1);
+INSERT INTO t VALUES (810, 5, 94, 9.35, 0.1);
+INSERT INTO t VALUES (811, 5, 34, 9.36, 0.1);
+INSERT INTO t VALUES (812, 5, 71, 9.37, 0.1);
+INSERT INTO t VALUES (813, 5, 11, 9.38, 0.1);
+INSERT INTO t VALUES (814, 5, 48, 9.39, 0.1);
+INSERT INTO t VALUES (815, 5, 85, 9.40, 0.1);
+INSERT INTO t VALUES (816, 5, 25, 9.41, 0.1);
+INSERT INTO t VALUES (817, 5, 62, 9.42, 0.1);
+INSERT INTO t VALUES (818, 5, 2, 9.43, 0.1);
+INSERT INTO t VALUES (819, 5, 39, 9.44, 0.1);
+INSERT INTO t VALUES (820, 5, 76, 9.45, 0.1);
+INSERT INTO t VALUES (821, 5, 16, 9.46, 0.1);
+INSERT INTO t VALUES (822, 5, 53, 9.47, 0.1);
+INSERT INTO t VALUES (823, 5, 90, 9.48, 0.1);
+INSERT INTO t VALUES (824, 5, 30, 9.49, 0.1);
+INSERT INTO t VALUES (825, 5, 67, 9.50, 0.1);
+INSERT INTO t VALUES (826, 5, 7, 9.51, 0.1);
+INSERT INTO t VALUES (827, 5, 44, 9.52, 0.1);
+INSERT INTO t VALUES (828, 5, 81, 9.53, 0.1);
+INSERT INTO t VALUES (829, 5, 21, 9.54, 0.1);
+INSERT INTO t VALUES (830, 5, 58, 9.55, 0.1);
+INSERT INTO t VALUES (831, 5, 95, 9.56, 0.1);
+INSERT INTO t VALUES (832, 5, 35, 9.57, 0.1);
+INSERT INTO t VALUES (833, 5, 72, 9.58, 0.1);
+INSERT INTO t VALUES (834, 5, 12, 9.59, 0.1);
+INSERT INTO t VALUES (835, 5, 49, 9.60, 0.1);
+INSERT INTO t VALUES (836, 5, 86, 9.61, 0.1);
+INSERT INTO t VALUES (837, 5, 26, 9.62, 0.1);
+INSERT INTO t VALUES (838, 5, 63, 9.63, 0.1);
+INSERT INTO t VALUES (839, 5, 3, 9.64, 0.1);
+INSERT INTO t VALUES (840, 5, 40, 9.65, 0.1);
+INSERT INTO t VALUES (841, 5, 77, 9.66, 0.1);
+INSERT INTO t VALUES (842, 5, 17, 9.67, 0.1);
+INSERT INTO t VALUES (843, 5, 54, 9.68, 0.1);
+INSERT INTO t VALUES (844, 5, 91, 9.69, 0.1);
+INSERT INTO t VALUES (845, 5, 31, 9.70, 0.1);
+INSERT INTO t VALUES (846, 5, 68, 9.71, 0.1);
+INSERT INTO t VALUES (847, 5, 8, 9.72, 0.1);
+INSERT INTO t VALUES (848, 5, 45, 9.73, 0.1);
+INSERT INTO t VALUES (849, 5, 82, 9.74, 0.1);
+INSERT INTO t VALUES (850, 5, 22, 9.75, 0.1);
+INSERT INTO t VALUES (851, 5, 59, 9.76, 0.1);
+INSERT INTO t VALUES (852, 5, 96, 9.77, 0.1);
+INSERT INTO t VALUES (853, 5, 36, 9.78, 0.1);
+INSERT INTO t VALUES (854, 5, 73, 9.79, 0.1);
+INSERT INTO t VALUES (855, 5, 13, 9.80, 0.1);
+INSERT INTO t VALUES (856, 5, 50, 9.81, 0.1);
+INSERT INTO t VALUES (857, 5, 87, 9.82, 0.1);
+INSERT INTO t VALUES (858, 5, 27, 9.83, 0.1);
+INSERT INTO t VALUES (859, 5, 64, 9.84, 0.1);
+INSERT INTO t VALUES (860, 5, 4, 9.85, 0.1);
+INSERT INTO t VALUES (861, 5, 41, 9.86, 0.1);
+INSERT INTO t VALUES (862, 5, 78, 9.87, 0.1);
+INSERT INTO t VALUES (863, 5, 18, 9.88, 0.1);
+INSERT INTO t VALUES (864, 5, 55, 9.89, 0.1);
+INSERT INTO t VALUES (865, 5, 92, 9.90, 0.1);
+INSERT INTO t VALUES (866, 5, 32, 9.91, 0.1);
+INSERT INTO t VALUES (867, 5, 69, 9.92, 0.1);
+INSERT INTO t VALUES (868, 5, 9, 9.93, 0.1);
+INSERT INTO t VALUES (869, 5, 46, 9.94, 0.1);
+INSERT INTO t VALUES (870, 5, 83, 9.95, 0.1);
+INSERT INTO t VALUES (871, 5, 23, 9.96, 0.1);
+INSERT INTO t VALUES (872, 5, 60, 9.97, 0.1);
+INSERT INTO t VALUES (873, 5, 0, 9.98, 0.1);
+INSERT INTO t VALUES (874, 5, 37, 9.99, 0.1);
+INSERT INTO t VALUES (875, 5, 74, 10.00, 0.1);
+INSERT INTO t VALUES (876, 5, 14, 10.01, 0.1);
+INSERT INTO t VALUES (877, 5, 51, 10.02, 0.1);
+INSERT INTO t VALUES (878, 5, 88, 10.03, 0.1);
+INSERT INTO t VALUES (879, 5, 28, 10.04, 0.1);
+INSERT INTO t VALUES (880, 5, 65, 10.05, 0.1);
+INSERT INTO t VALUES (881, 5, 5, 10.06, 0.1);
+INSERT INTO t VALUES (882, 5, 42, 10.07, 0.1);
+INSERT INTO t VALUES (883, 5, 79, 10.08, 0.1);
+INSERT INTO t VALUES (884, 5, 19, 10.09, 0.1);
+INSERT INTO t VALUES (885, 5, 56, 10.10, 0.1);
+INSERT INTO t VALUES (886, 5, 93, 10.11, 0.1);
+INSERT INTO t VALUES (887, 5, 33, 10.12, 0.1);
+INSERT INTO t VALUES (888, 5, 70, 10.13, 0.1);
+INSERT INTO t VALUES (889, 5, 10, 10.14, 0.1);
+INSERT INTO t VALUES (890, 5, 47, 10.15, 0.1);
+INSERT INTO t VALUES (891, 5, 84, 10.16, 0.1);
+INSERT INTO t VALUES (892, 5, 24, 10.17, 0.1);
+INSERT INTO t VALUES (893, 5, 61, 10.18, 0.1);
+INSERT INTO t VALUES (894, 5, 1, 10.19, 0.1);
+INSERT INTO t VALUES (895, 5, 38, 10.20, 0.1);
+INSERT INTO t VALUES (896, 5, 75, 10.21, 0.1);
+INSERT INTO t VALUES (897, 5, 15, 10.22, 0.1);
+INSERT INTO t VALUES (898, 5, 52, 10.23, 0.1);
+INSERT INTO t VALUES (899, 5, 89, 10.24, 0.1);
+INSERT INTO t VALUES (900, 5, 29, 10.25, 0.1);
+INSERT INTO t VALUES (901, 5, 66, 10.26, 0.1);
+INSERT INTO t VALUES (902, 5, 6, 10.27, 0.1);
+INSERT INTO t VALUES (903, 5, 43, 10.28, 0.1);
+INSERT INTO t VALUES (904, 5, 80, 10.29, 0.1);
+INSERT INTO t VALUES (905, 5, 20, 10.30, 0.1);
+INSERT INTO t VALUES (906, 5, 57, 10.31, 0.1);
+INSERT INTO t VALUES (907, 5, 94, 10.32, 0.1);
+INSERT INTO t VALUES (908, 5, 34, 10.33, 0.1);
+INSERT INTO t VALUES (909, 5, 71, 10.34, 0.1);
+INSERT INTO t VALUES (910, 5, 11, 10.35, 0.1);
+INSERT INTO t VALUES (911, 5, 48, 10.36, 0.1);
+INSERT INTO t VALUES (912, 5, 85, 10.37, 0.1);
+INSERT INTO t VALUES (913, 5, 25, 10.38, 0.1);
+INSERT INTO t VALUES (914, 5, 62, 10.39, 0.1);
+INSERT INTO t VALUES (915, 5, 2, 10.40, 0.1);
+INSERT INTO t VALUES (916, 5, 39, 10.41, 0.1);
+INSERT INTO t VALUES (917, 5, 76, 10.42, 0.1);
+INSERT INTO t VALUES (918, 5, 16, 10.43, 0.1);
+INSERT INTO t VALUES (919, 5, 53, 10.44, 0.1);
+INSERT INTO t VALUES (920, 5, 90, 10.45, 0.1);
+INSERT INTO t VALUES (921, 5, 30, 10.46, 0.1);
+INSERT INTO t VALUES (922, 5, 67, 10.47, 0.1);
+INSERT INTO t VALUES (923, 5, 7, 10.48, 0.1);
+INSERT INTO t VALUES (924, 5, 44, 10.49, 0.1);
+INSERT INTO t VALUES (925, 5, 81, 10.50, 0.1);
+INSERT INTO t VALUES (926, 5, 21, 10.51, 0.1);
+INSERT INTO t VALUES (927, 5, 58, 10.52, 0.1);
+INSERT INTO t VALUES (928, 5, 95, 10.53, 0.1);
+INSERT INTO t VALUES (929, 5, 35, 10.54, 0.1);
+INSERT INTO t VALUES (930, 5, 72, 10.55, 0.1);
+INSERT INTO t VALUES (931, 5, 12, 10.56, 0.1);
+INSERT INTO t VALUES (932, 5, 49, 10.57, 0.1);
+INSERT INTO t VALUES (933, 5, 86, 10.58, 0.1);
+INSERT INTO t VALUES (934, 5, 26, 10.59, 0.1);
+INSERT INTO t VALUES (935, 5, 63, 10.60, 0.1);
+INSERT INTO t VALUES (936, 5, 3, 10.61, 0.1);
+INSERT INTO t VALUES (937, 5, 40, 10.62, 0.1);
+INSERT INTO t VALUES (938, 5, 77, 10.63, 0.1);
+INSERT INTO t VALUES (939, 5, 17, 10.64, 0.1);
+INSERT INTO t VALUES (940, 5, 54, 10.65, 0.1);
+INSERT INTO t VALUES (941, 5, 91, 10.66, 0.1);
+INSERT INTO t VALUES (942, 5, 31, 10.67, 0.1);
+INSERT INTO t VALUES (943, 5, 68, 10.68, 0.1);
+INSERT INTO t VALUES (944, 5, 8, 10.69, 0.1);
+INSERT INTO t VALUES (945, 5, 45, 10.70, 0.1);
+INSERT INTO t VALUES (946, 5, 82, 10.71, 0.1);
+INSERT INTO t VALUES (947, 5, 22, 10.72, 0.1);
+INSERT INTO t VALUES (948, 5, 59, 10.73, 0.1);
+INSERT INTO t VALUES (949, 5, 96, 10.74, 0.1);
+INSERT INTO t VALUES (950, 5, 36, 10.75, 0.1);
+INSERT INTO t VALUES (951, 5, 73, 10.76, 0.1);
+INSERT INTO t VALUES (952, 5, 13, 10.77, 0.1);
+INSERT INTO t VALUES (953, 5, 50, 10.78, 0.1);
+INSERT INTO t VALUES (954, 5, 87, 10.79, 0.1);
+INSERT INTO t VALUES (955, 5, 27, 10.80, 0.1);
+INSERT INTO t VALUES (956, 5, 64, 10.81, 0.1);
+INSERT INTO t VALUES (957, 5, 4, 10.82, 0.1);
+INSERT INTO t VALUES (958, 5, 41, 10.83, 0.1);
+INSERT INTO t VALUES (959, 5, 78, 10.84, 0.1);
+INSERT INTO t VALUES (960, 5, 18, 10.85, 0.1);
+INSERT INTO t VALUES (961, 5, 55, 10.86, 0.1);
+INSERT INTO t VALUES (962, 5, 92, 10.87, 0.1);
+INSERT INTO t VALUES (963, 5, 32, 10.88, 0.1);
+INSERT INTO t VALUES (964, 5, 69, 10.89, 0.1);
+INSERT INTO t VALUES (965, 5, 9, 10.90, 0.1);
+INSERT INTO t VALUES (966, 5, 46, 10.91, 0.1);
+INSERT INTO t VALUES (967, 5, 83, 10.92, 0.1);
+INSERT INTO t VALUES (968, 5, 23, 10.93, 0.1);
+INSERT INTO t VALUES (969, 5, 60, 10.94, 0.1);
+INSERT INTO t VALUES (970, 5, 0, 10.95, 0.1);
+INSERT INTO t VALUES (971, 5, 37, 10.96, 0.1);
+INSERT INTO t VALUES (972, 5, 74, 10.97, 0.1);
+INSERT INTO t VALUES (973, 5, 14, 10.98, 0.1);
+INSERT INTO t VALUES (974, 5, 51, 10.99, 0.1);
+INSERT INTO t VALUES (975, 5, 88, 11.00, 0.1);
+INSERT INTO t VALUES (976, 5, 28, 11.01, 0.1);
+INSERT INTO t VALUES (977, 5, 65, 11.02, 0.1);
+INSERT INTO t VALUES (978, 5, 5, 11.03, 0.1);
+INSERT INTO t VALUES (979, 5, 42, 11.04, 0.1);
+INSERT INTO t VALUES (980, 5, 79, 11.05, 0.1);
+INSERT INTO t VALUES (981, 5, 19, 11.06, 0.1);
+INSERT INTO t VALUES (982, 5, 56, 11.07, 0.1);
+INSERT INTO t VALUES (983, 5, 93, 11.08, 0.1);
+INSERT INTO t VALUES (984, 5, 33, 11.09, 0.1);
+INSERT INTO t VALUES (985, 5, 70, 11.10, 0.1);
+INSERT INTO t VALUES (986, 5, 10, 11.11, 0.1);
+INSERT INTO t VALUES (987, 5, 47, 11.12, 0.1);
+INSERT INTO t VALUES (988, 5, 84, 11.13, 0.1);
+INSERT INTO t VALUES (989, 5, 24, 11.14, 0.1);
+INSERT INTO t VALUES (990, 5, 61, 11.15, 0.1);
+INSERT INTO t VALUES (991, 5, 1, 11.16, 0.1);
+INSERT INTO t VALUES (992, 5, 38, 11.17, 0.1);
+INSERT INTO t VALUES (993, 5, 75, 11.18, 0.1);
+INSERT INTO t VALUES (994, 5, 15, 11.19, 0.1);
+INSERT INTO t VALUES (995, 5, 52, 11.20, 0.1);
+INSERT INTO t VALUES (996, 5, 89, 11.21, 0.1);
+INSERT INTO t VALUES (997, 5, 29, 11.22, 0.1);
+INSERT INTO t VALUES (998, 5, 66, 11.23, 0.1);
+INSERT INTO t VALUES (999, 5, 6, 11.24, 0.1);
+INSERT INTO t VALUES (1000, 5, 43, 1.25, 0.1);
+INSERT INTO t VALUES (1001, 5, 80, 1.26, 0.1);
+INSERT INTO t VALUES (1002, 5, 20, 1.27, 0.1);
+INSERT INTO t VALUES (1003, 5, 57, 1.28, 0.1);
+INSERT INTO t VALUES (1004, 5, 94, 1.29, 0.1);
+INSERT INTO t VALUES (1005, 5, 34, 1.30, 0.1);
+INSERT INTO t VALUES (1006, 5, 71, 1.31, 0.1);
+INSERT INTO t VALUES (1007, 5, 11, 1.32, 0.1);
+INSERT INTO t VALUES (1008, 5, 48, 1.33, 0.1);
+INSERT INTO t VALUES (1009, 5, 85, 1.34, 0.1);
+INSERT INTO t VALUES (1010, 5, 25, 1.35, 0.1);
+INSERT INTO t VALUES (1011, 5, 62, 1.36, 0.1);
+INSERT INTO t VALUES (1012, 5, 2, 1.37, 0.1);
+INSERT INTO t VALUES (1013, 5, 39, 1.38, 0.1);
+INSERT INTO t VALUES (1014, 5, 76, 1.39, 0.1);
+INSERT INTO t VALUES (1015, 5, 16, 1.40, 0.1);
+INSERT INTO t VALUES (1016, 5, 53, 1.41, 0.1);
+INSERT INTO t VALUES (1017, 5, 90, 1.42, 0.1);
+INSERT INTO t VALUES (1018, 5, 30, 1.43, 0.1);
+INSERT INTO t VALUES (1019, 5, 67, 1.44, 0.1);
+INSERT INTO t VALUES (1020, 5, 7, 1.45, 0.1);
+INSERT INTO t VALUES (1021, 5, 44, 1.46, 0.1);
+INSERT INTO t VALUES (1022, 5, 81, 1.47, 0.1);
+INSERT INTO t VALUES (1023, 5, 21, 1.48, 0.1);
+INSERT INTO t VALUES (1024, 5, 58, 1.49, 0.1);
+INSERT INTO t VALUES (1025, 5, 95, 1.50, 0.1);
+INSERT INTO t VALUES (1026, 5, 35, 1.51, 0.1);
+INSERT INTO t VALUES (1027, 5, 72, 1.52, 0.1);
+INSERT INTO t VALUES (1028, 5, 12, 1.53, 0.1);
+INSERT INTO t VALUES (1029, 5, 49, 1.54, 0.1);
+INSERT INTO t VALUES (1030, 5, 86, 1.55, 0.1);
+INSERT INTO t VALUES (1031, 5, 26, 1.56, 0.1);
+INSERT INTO t VALUES (1032, 5, 63, 1.57, 0.1);
+INSERT INTO t VALUES (1033, 5, 3, 1.58, 0.1);
+INSERT INTO t VALUES (1034, 5, 40, 1.59, 0.1);
+INSERT INTO t VALUES (1035, 5, 77, 1.60, 0.1);
+INSERT INTO t VALUES (1036, 5, 17, 1.61, 0.1);
+INSERT INTO t VALUES (1037, 5, 54, 1.62, 0.1);
+INSERT INTO t VALUES (1038, 5, 91, 1.63, 0.1);
+INSERT INTO t VALUES (1039, 5, 31, 1.64, 0.1);
+INSERT INTO t VALUES (1040, 5, 68, 1.65, 0.1);
+INSERT INTO t VALUES (1041, 5, 8, 1.66, 0.1);
+INSERT INTO t VALUES (1042, 5, 45, 1.67, 0.1);
+INSERT INTO t VALUES (1043, 5, 82, 1.68, 0.1);
+INSERT INTO t VALUES (1044, 5, 22, 1.69, 0.1);
+INSERT INTO t VALUES (1045, 5, 59, 1.70, 0.1);
+INSERT INTO t VALUES (1046, 5, 96, 1.71, 0.1);
+INSERT INTO t VALUES (1047, 5, 36, 1.72, 0.1);
+INSERT INTO t VALUES (1048, 5, 73, 1.73, 0.1);
+INSERT INTO t VALUES (1049, 5, 13, 1.74, 0.1);
+INSERT INTO t VALUES (1050, 5, 50, 1.75, 0.1);
+INSERT INTO t VALUES (1051, 5, 87, 1.76, 0.1);
+INSERT INTO t VALUES (1052, 5, 27, 1.77, 0.1);
+INSERT INTO t VALUES (1053, 5, 64, 1.78, 0.1);
+INSERT INTO t VALUES (1054, 5, 4, 1.79, 0.1);
+INSERT INTO t VALUES (1055, 5, 41, 1.80, 0.1);
+INSERT INTO t VALUES (1056, 5, 78, 1.81, 0.1);
+INSERT INTO t VALUES (1057, 5, 18, 1.82, 0.1);
+INSERT INTO t VALUES (1058, 5, 55, 1.83, 0.1);
+INSERT INTO t VALUES (1059, 5, 92, 1.84, 0.1);
+INSERT INTO t VALUES (1060, 5, 32, 1.85, 0.1);
+INSERT INTO t VALUES (1061, 5, 69, 1.86, 0.1);
+INSERT INTO t VALUES (1062, 5, 9, 1.87, 0.1);
+INSERT INTO t VALUES (1063, 5, 46, 1.88, 0.1);
+INSERT INTO t VALUES (1064, 5, 83, 1.89, 0.1);
+INSERT INTO t VALUES (1065, 5, 23, 1.90, 0.1);
+INSERT INTO t VALUES (1066, 5, 60, 1.91, 0.1);
+INSERT INTO t VALUES (1067, 5, 0, 1.92, 0.1);
+INSERT INTO t VALUES (1068, 5, 37, 1.93, 0.1);
+INSERT INTO t VALUES (1069, 5, 74, 1.94, 0.1);
+INSERT INTO t VALUES (1070, 5, 14, 1.95, 0.1);
+INSERT INTO t VALUES (1071, 5, 51, 1.96, 0.1);
+INSERT INTO t VALUES (1072, 5, 88, 1.97, 0.1);
+INSERT INTO t VALUES (1073, 5, 28, 1.98, 0.1);
+INSERT INTO t VALUES (1074, 5, 65, 1.99, 0.1);
+INSERT INTO t VALUES (1075, 5, 5, 2.00, 0.1);
+INSERT INTO t VALUES (1076, 5, 42, 2.01, 0.1);
+INSERT INTO t VALUES (1077, 5, 79, 2.02, 0.1);
+INSERT INTO t VALUES (1078, 5, 19, 2.03, 0.1);
+INSERT INTO t VALUES (1079, 5, 56, 2.04, 0.1);
+INSERT INTO t VALUES (1080, 5, 93, 2.05, 0.1);
+INSERT INTO t VALUES (1081, 5, 33, 2.06, 0.1);
+INSERT INTO t VALUES (1082, 5, 70, 2.07, 0.1);
+INSERT INTO t VALUES (1083, 5, 10, 2.08, 0.1);
+INSERT INTO t VALUES (1084, 5, 47, 2.09, 0.1);
+INSERT INTO t VALUES (1085, 5, 84, 2.10, 0.1);
+INSERT INTO t VALUES (1086, 5, 24, 2.11, 0.1);
+INSERT INTO t VALUES (1087, 5, 61, 2.12, 0.1);
+INSERT INTO t VALUES (1088, 5, 1, 2.13, 0.1);
+INSERT INTO t VALUES (1089, 5, 38, 2.14, 0.1);
+INSERT INTO t VALUES (1090, 5, 75, 2.15, 0.1);
+INSERT INTO t VALUES (1091, 5, 15, 2.16, 0.1);
+INSERT INTO t VALUES (1092, 5, 52, 2.17, 0.1);
+INSERT INTO t VALUES (1093, 5, 89, 2.18, 0.1);
+INSERT INTO t VALUES (1094, 5, 29, 2.19, 0.1);
+INSERT INTO t VALUES (1095, 5, 66, 2.20, 0.1);
+INSERT INTO t VALUES (1096, 5, 6, 2.21, 0.1);
+INSERT INTO t VALUES (1097, 5, 43, 2.22, 0.1);
+INSERT INTO t VALUES (1098, 5, 80, 2.23, 0.1);
+INSERT INTO t VALUES (1099, 5, 20, 2.24, 0.1);
+INSERT INTO t VALUES (1100, 5, 57, 2.25, 0.1);
+INSERT INTO t VALUES (1101, 5, 94, 2.26, 0.1);
+INSERT INTO t VALUES (1102, 5, 34, 2.27, 0.1);
+INSERT INTO t VALUES (1103, 5, 71, 2.28, 0.1);
+INSERT INTO t VALUES (1104, 5, 11, 2.29, 0.1);
+INSERT INTO t VALUES (1105, 5, 48, 2.30, 0.1);
+INSERT INTO t VALUES (1106, 5, 85, 2.31, 0.1);
+INSERT INTO t VALUES (1107, 5, 25, 2.32, 0.1);
+INSERT INTO t VALUES (1108, 5, 62, 2.33, 0.1);
+INSERT INTO t VALUES (1109, 5, 2, 2.34, 0.1);
+INSERT INTO t VALUES (1110, 5, 39, 2.35, 0.1);
+INSERT INTO t VALUES (1111, 5, 76, 2.36, 0.1);
+INSERT INTO t VALUES (1112, 5, 16, 2.37, 0.1);
+INSERT INTO t VALUES (1113, 5, 53, 2.38, 0.1);
+INSERT INTO t VALUES (1114, 5, 90, 2.39, 0.1);
+INSERT INTO t VALUES (1115, 5, 30, 2.40, 0.1);
+INSERT INTO t VALUES (1116, 5, 67, 2.41, 0.1);
+INSERT INTO t VALUES (1117, 5, 7, 2.42, 0.1);
+INSERT INTO t VALUES (1118, 5, 44, 2.43, 0.1);
+INSERT INTO t VALUES (1119, 5, 81, 2.44, 0.1);
+INSERT INTO t VALUES (1120, 5, 21, 2.45, 0.1);
+INSERT INTO t VALUES (1121, 5, 58, 2.46, 0.1);
+INSERT INTO t VALUES (1122, 5, 95, 2.47, 0.1);
+INSERT INTO t VALUES (1123, 5, 35, 2.48, 0.1);
+INSERT INTO t VALUES (1124, 5, 72, 2.49, 0.1);
+INSERT INTO t VALUES (1125, 5, 12, 2.50, 0.1);
+INSERT INTO t VALUES (1126, 5, 49, 2.51, 0.1);
+INSERT INTO t VALUES (1127, 5, 86, 2.52, 0.1);
+INSERT INTO t VALUES (1128, 5, 26, 2.53, 0.1);
+INSERT INTO t VALUES (1129, 5, 63, 2.54, 0.1);
+INSERT INTO t VALUES (1130, 5, 3, 2.55, 0.1);
+INSERT INTO t VALUES (1131, 5, 40, 2.56, 0.1);
+INSERT INTO t VALUES (1132, 5, 77, 2.57, 0.1);
+INSERT INTO t VALUES (1133, 5, 17, 2.58, 0.1);
+INSERT INTO t VALUES (1134, 5, 54, 2.59, 0.1);
+INSERT INTO t VALUES (1135, 5, 91, 2.60, 0.1);
+INSERT INTO t VALUES (1136, 5, 31, 2.61, 0.1);
+INSERT INTO t VALUES (1137, 5, 68, 2.62, 0.1);
+INSERT INTO t VALUES (1138, 5, 8, 2.63, 0.1);
+INSERT INTO t VALUES (1139, 5, 45, 2.64, 0.1);
+INSERT INTO t VALUES (1140, 5, 82, 2.65, 0.1);
+INSERT INTO t VALUES (1141, 5, 22, 2.66, 0.1);
+INSERT INTO t VALUES (1142, 5, 59, 2.67, 0.1);
+INSERT INTO t VALUES (1143, 5, 96, 2.68, 0.1);
+INSERT INTO t VALUES (1144, 5, 36, 2.69, 0.1);
+INSERT INTO t VALUES (1145, 5, 73, 2.70, 0.1);
+INSERT INTO t VALUES (1146, 5, 13, 2.71, 0.1);
+INSERT INTO t VALUES (1147, 5, 50, 2.72, 0.1);
+INSERT INTO t VALUES (1148, 5, 87, 2.73, 0.1);
+INSERT INTO t VALUES (1149, 5, 27, 2.74, 0.1);
+INSERT INTO t VALUES (1150, 5, 64, 2.75, 0.1);
+INSERT INTO t VALUES (1151, 5, 4, 2.76, 0.1);
+INSERT INTO t VALUES (1152, 5, 41, 2.77, 0.1);
+INSERT INTO t VALUES (1153, 5, 78, 2.78, 0.1);
+INSERT INTO t VALUES (1154, 5, 18, 2.79, 0.1);
+INSERT INTO t VALUES (1155, 5, 55, 2.80, 0.1);
+INSERT INTO t VALUES (1156, 5, 92, 2.81, 0.1);
+INSERT INTO t VALUES (1157, 5, 32, 2.82, 0.1);
+INSERT INTO t VALUES (1158, 5, 69, 2.83, 0.1);
+INSERT INTO t VALUES (1159, 5, 9, 2.84, 0.1);
+INSERT INTO t VALUES (1160, 5, 46, 2.85, 0.1);
+INSERT INTO t VALUES (1161, 5, 83, 2.86, 0.1);
+INSERT INTO t VALUES (1162, 5, 23, 2.87, 0.1);
+INSERT INTO t VALUES (1163, 5, 60, 2.88, 0.1);
+INSERT INTO t VALUES (1164, 5, 0, 2.89, 0.1);
+INSERT INTO t VALUES (1165, 5, 37, 2.90, 0.1);
+INSERT INTO t VALUES (1166, 5, 74, 2.91, 0.1);
+INSERT INTO t VALUES (1167, 5, 14, 2.92, 0.1);
+INSERT INTO t VALUES (1168, 5, 51, 2.93, 0.1);
+INSERT INTO t VALUES (1169, 5, 88, 2.94, 0.1);
+INSERT INTO t VALUES (1170, 5, 28, 2.95, 0.1);
+INSERT INTO t VALUES (1171, 5, 65, 2.96, 0.1);
+INSERT INTO t VALUES (1172, 5, 5, 2.97, 0.1);
+INSERT INTO t VALUES (1173, 5, 42, 2.98, 0.1);
+INSERT INTO t VALUES (1174, 5, 79, 2.99, 0.1);
+INSERT INTO t VALUES (1175, 5, 19, 3.00, 0.1);
+INSERT INTO t VALUES (1176, 5, 56, 3.01, 0.1);
+INSERT INTO t VALUES (1177, 5, 93, 3.02, 0.1);
+INSERT INTO t VALUES (1178, 5, 33, 3.03, 0.1);
+INSERT INTO t VALUES (1179, 5, 70, 3.04, 0.1);
+INSERT INTO t VALUES (1180, 5, 10, 3.05, 0.1);
+INSERT INTO t VALUES (1181, 5, 47, 3.06, 0.1);
+INSERT INTO t VALUES (1182, 5, 84, 3.07, 0.1);
+INSERT INTO t VALUES (1183, 5, 24, 3.08, 0.1);
+INSERT INTO t VALUES (1184, 5, 61, 3.09, 0.1);
+INSERT INTO t VALUES (1185, 5, 1, 3.10, 0.1);
+INSERT INTO t VALUES (1186, 5, 38, 3.11, 0.1);
+INSERT INTO t VALUES (1187, 5, 75, 3.12, 0.1);
+INSERT INTO t VALUES (1188, 5, 15, 3.13, 0.1);
+INSERT INTO t VALUES (1189, 5, 52, 3.14, 0.1);
+INSERT INTO t VALUES (1190, 5, 89, 3.15, 0.1);
+INSERT INTO t VALUES (1191, 5, 29, 3.16, 0.1);
+INSERT INTO t VALUES (1192, 5, 66, 3.17, 0.1);
+INSERT INTO t VALUES (1193, 5, 6, 3.18, 0.1);
+INSERT INTO t VALUES (1194, 5, 43, 3.19, 0.1);
+INSERT INTO t VALUES (1195, 5, 80, 3.20, 0.1);
+INSERT INTO t VALUES (1196, 5, 20, 3.21, 0.1);
+INSERT INTO t VALUES (1197, 5, 57, 3.22, 0.1);
+INSERT INTO t VALUES (1198, 5, 94, 3.23, 0.1);
+INSERT INTO t VALUES (1199, 5, 34, 3.24, 0.1);
+INSERT INTO t VALUES (1200, 5, 71, 3.25, 0.1);
+INSERT INTO t VALUES (1201, 5, 11, 3.26, 0.1);
+INSERT INTO t VALUES (1202, 5, 48, 3.27, 0.1);
+INSERT INTO t VALUES (1203, 5, 85, 3.28, 0.1);
+INSERT INTO t VALUES (1204, 5, 25, 3.29, 0.1);
+INSERT INTO t VALUES (1205, 5, 62, 3.30, 0.1);
+INSERT INTO t VALUES (1206, 5, 2, 3.31, 0.1);
+INSERT INTO t VALUES (1207, 5, 39, 3.32, 0.1);
+INSERT INTO t VALUES (1208, 5, 76, 3.33, 0.1);
+INSERT INTO t VALUES (1209, 5, 16, 3.34, 0.1);
+INSERT INTO t VALUES (1210, 5, 53, 3.35, 0.1);
+INSERT INTO t VALUES (1211, 5, 90, 3.36, 0.1);
+INSERT INTO t VALUES (1212, 5, 30, 3.37, 0.1);
+INSERT INTO t VALUES (1213, 5, 67, 3.38, 0.1);
+INSERT INTO t VALUES (1214, 5, 7, 3.39, 0.1);
+INSERT INTO t VALUES (1215, 5, 44, 3.40, 0.1);
+INSERT INTO t VALUES (1216, 5, 81, 3.41, 0.1);
+INSERT INTO t VALUES (1217, 5, 21, 3.42, 0.1);
+INSERT INTO t VALUES (1218, 5, 58, 3.43, 0.1);
+INSERT INTO t VALUES (1219, 5, 95, 3.44, 0.1);
+INSERT INTO t VALUES (1220, 5, 35, 3.45, 0.1);
+INSERT INTO t VALUES (1221, 5, 72, 3.46, 0.1);
+INSERT INTO t VALUES (1222, 5, 12, 3.47, 0.1);
+INSERT INTO t VALUES (1223, 5, 49, 3.48, 0.1);
+INSERT INTO t VALUES (1224, 5, 86, 3.49, 0.1);
+INSERT INTO t VALUES (1225, 5, 26, 3.50, 0.1);
+INSERT INTO t VALUES (1226, 5, 63, 3.51, 0.1);
+INSERT INTO t VALUES (1227, 5, 3, 3.52, 0.1);
+INSERT INTO t VALUES (1228, 5, 40, 3.53, 0.1);
+INSERT INTO t VALUES (1229, 5, 77, 3.54, 0.1);
+INSERT INTO t VALUES (1230, 5, 17, 3.55, 0.1);
+INSERT INTO t VALUES (1231, 5, 54, 3.56, 0.1);
+INSERT INTO t VALUES (1232, 5, 91, 3.57, 0.1);
+INSERT INTO t VALUES (1233, 5, 31, 3.58, 0.1);
+INSERT INTO t VALUES (1234, 5, 68, 3.59, 0.1);
+INSERT INTO t VALUES (1235, 5, 8, 3.60, 0.1);
+INSERT INTO t VALUES (1236, 5, 45, 3.61, 0.1);
+INSERT INTO t VALUES (1237, 5, 82, 3.62, 0.1);
+INSERT INTO t VALUES (1238, 5, 22, 3.63, 0.1);
+INSERT INTO t VALUES (1239, 5, 59, 3.64, 0.1);
+INSERT INTO t VALUES (1240, 5, 96, 3.65, 0.1);
+INSERT INTO t VALUES (1241, 5, 36, 3.66, 0.1);
+INSERT INTO t VALUES (1242, 5, 73, 3.67, 0.1);
+INSERT INTO t VALUES (1243, 5, 13, 3.68, 0.1);
+INSERT INTO t VALUES (1244, 5, 50, 3.69, 0.1);
+INSERT INTO t VALUES (1245, 5, 87, 3.70, 0.1);
+INSERT INTO t VALUES (1246, 5, 27, 3.71, 0.1);
+INSERT INTO t VALUES (1247, 5, 64, 3.72, 0.1);
+INSERT INTO t VALUES (1248, 5, 4, 3.73, 0.1);
+INSERT INTO t VALUES (1249, 5, 41, 3.74, 0.1);
+INSERT INTO t VALUES (1250, 5, 78, 3.75, 0.1);
+INSERT INTO t VALUES (1251, 5, 18, 3.76, 0.1);
+INSERT INTO t VALUES (1252, 5, 55, 3.77, 0.1);
+INSERT INTO t VALUES (1253, 5, 92, 3.78, 0.1);
+INSERT INTO t VALUES (1254, 5, 32, 3.79, 0.1);
+INSERT INTO t VALUES (1255, 5, 69, 3.80, 0.1);
+INSERT INTO t VALUES (1256, 5, 9, 3.81, 0.1);
+INSERT INTO t VALUES (1257, 5, 46, 3.82, 0.1);
+INSERT INTO t VALUES (1258, 5, 83, 3.83, 0.1);
+INSERT INTO t VALUES (1259, 5, 23, 3.84, 0.1);
+INSERT INTO t VALUES (1260, 5, 60, 3.85, 0.1);
+INSERT INTO t VALUES (1261, 5, 0, 3.86, 0.1);
+INSERT INTO t VALUES (1262, 5, 37, 3.87, 0.1);
+INSERT INTO t VALUES (1263, 5, 74, 3.88, 0.1);
+INSERT INTO t VALUES (1264, 5, 14, 3.89, 0.1);
+INSERT INTO t VALUES (1265, 5, 51, 3.90, 0.1);
+INSERT INTO t VALUES (1266, 5, 88, 3.91, 0.1);
+INSERT INTO t VALUES (1267, 5, 28, 3.92, 0.1);
+INSERT INTO t VALUES (1268, 5, 65, 3.93, 0.1);
+INSERT INTO t VALUES (1269, 5, 5, 3.94, 0.1);
+INSERT INTO t VALUES (1270, 5, 42, 3.95, 0.1);
+INSERT INTO t VALUES (1271, 5, 79, 3.96, 0.1);
+INSERT INTO t VALUES (1272, 5, 19, 3.97, 0.1);
+INSERT INTO t VALUES (1273, 5, 56, 3.98, 0.1);
+INSERT INTO t VALUES (1274, 5, 93, 3.99, 0.1);
+INSERT INTO t VALUES (1275, 5, 33, 4.00, 0.1);
+INSERT INTO t VALUES (1276, 5, 70, 4.01, 0.1);
+INSERT INTO t VALUES (1277, 5, 10, 4.02, 0.1);
+INSERT INTO t VALUES (1278, 5, 47, 4.03, 0.1);
+INSERT INTO t VALUES (1279, 5, 84, 4.04, 0.1);
+INSERT INTO t VALUES (1280, 5, 24, 4.05, 0.1);
+INSERT INTO t VALUES (1281, 5, 61, 4.06, 0.1);
+INSERT INTO t VALUES (1282, 5, 1, 4.07, 0.1);
+INSERT INTO t VALUES (1283, 5, 38, 4.08, 0.1);
+INSERT INTO t VALUES (1284, 5, 75, 4.09, 0.1);
+INSERT INTO t VALUES (1285, 5, 15, 4.10, 0.1);
+INSERT INTO t VALUES (1286, 5, 52, 4.11, 0.1);
+INSERT INTO t VALUES (1287, 5, 89, 4.12, 0.1);
+INSERT INTO t VALUES (1288, 5, 29, 4.13, 0.1);
+INSERT INTO t VALUES (1289, 5, 66, 4.14, 0.1);
+INSERT INTO t VALUES (1290, 5, 6, 4.15, 0.1);
+INSERT INTO t VALUES (1291, 5, 43, 4.16, 0.1);
+INSERT INTO t VALUES (1292, 5, 80, 4.17, 0.1);
+INSERT INTO t VALUES (1293, 5, 20, 4.18, 0.1);
+INSERT INTO t VALUES (1294, 5, 57, 4.19, 0.1);
+INSERT INTO t VALUES (1295, 5, 94, 4.20, 0.1);
+INSERT INTO t VALUES (1296, 5, 34, 4.21, 0.1);
+INSERT INTO t VALUES (1297, 5, 71, 4.22, 0.1);
+INSERT INTO t VALUES (1298, 5, 11, 4.23, 0.1);
+INSERT INTO t VALUES (1299, 5, 48, 4.24, 0.1);
+INSERT INTO t VALUES (1300, 5, 85, 4.25, 0.1);
+INSERT INTO t VALUES (1301, 5, 25, 4.26, 0.1);
+INSERT INTO t VALUES (1302, 5, 62, 4.27, 0.1);
+INSERT INTO t VALUES (1303, 5, 2, 4.28, 0.1);
+INSERT INTO t VALUES (1304, 5, 39, 4.29, 0.1);
+INSERT INTO t VALUES (1305, 5, 76, 4.30, 0.1);
+INSERT INTO t VALUES (1306, 5, 16, 4.31, 0.1);
+INSERT INTO t VALUES (1307, 5, 53, 4.32, 0.1);
+INSERT INTO t VALUES (1308, 5, 90, 4.33, 0.1);
+INSERT INTO t VALUES (1309, 5, 30, 4.34, 0.1);
+INSERT INTO t VALUES (1310, 5, 67, 4.35, 0.1);
+INSERT INTO t VALUES (1311, 5, 7, 4.36, 0.1);
+INSERT INTO t VALUES (1312, 5, 44, 4.37, 0.1);
+INSERT INTO t VALUES (1313, 5, 81, 4.38, 0.1);
+INSERT INTO t VALUES (1314, 5, 21, 4.39, 0.1);
+INSERT INTO t VALUES (1315, 5, 58, 4.40, 0.1);
+INSERT INTO t VALUES (1316, 5, 95, 4.41, 0.1);
+INSERT INTO t VALUES (1317, 5, 35, 4.42, 0.1);
+INSERT INTO t VALUES (1318, 5, 72, 4.43, 0.1);
+INSERT INTO t VALUES (1319, 5, 12, 4.44, 0.1);
+INSERT INTO t VALUES (1320, 5, 49, 4.45, 0.1);
+INSERT INTO t VALUES (1321, 5, 86, 4.46, 0.1);
+INSERT INTO t VALUES (1322, 5, 26, 4.47, 0.1);
+INSERT INTO t VALUES (1323, 5, 63, 4.48, 0.1);
+INSERT INTO t VALUES (1324, 5, 3, 4.49, 0.1);
+INSERT INTO t VALUES (1325, 5, 40, 4.50, 0.1);
+INSERT INTO t VALUES (1326, 5, 77, 4.51, 0.1);
+INSERT INTO t VALUES (1327, 5, 17, 4.52, 0.1);
+INSERT INTO t VALUES (1328, 5, 54, 4.53, 0.1);
+INSERT INTO t VALUES (1329, 5, 91, 4.54, 0.1);
+INSERT INTO t VALUES (1330, 5, 31, 4.55, 0.1);
+INSERT INTO t VALUES (1331, 5, 68, 4.56, 0.1);
+INSERT INTO t VALUES (1332, 5, 8, 4.57, 0.1);
+INSERT INTO t VALUES (1333, 5, 45, 4.58, 0.1);
+INSERT INTO t VALUES (1334, 5, 82, 4.59, 0.1);
+INSERT INTO t VALUES (1335, 5, 22, 4.60, 0.1);
+INSERT INTO t VALUES (1336, 5, 59, 4.61, 0.1);
+INSERT INTO t VALUES (1337, 5, 96, 4.62, 0.1);
+INSERT INTO t VALUES (1338, 5, 36, 4.63, 0.1);
+INSERT INTO t VALUES (1339, 5, 73, 4.64, 0.1);
+INSERT INTO t VALUES (1340, 5, 13, 4.65, 0.1);
+INSERT INTO t VALUES (1341, 5, 50, 4.66, 0.1);
+INSERT INTO t VALUES (1342, 5, 87, 4.67, 0.1);
+INSERT INTO t VALUES (1343, 5, 27, 4.68, 0.1);
+INSERT INTO t VALUES (1344, 5, 64, 4.69, 0.1);
+INSERT INTO t VALUES (1345, 5, 4, 4.70, 0.1);
+INSERT INTO t VALUES (1346, 5, 41, 4.71, 0.1);
+INSERT INTO t VALUES (1347, 5, 78, 4.72, 0.1);
+INSERT INTO t VALUES (1348, 5, 18, 4.73, 0.1);
+INSERT INTO t VALUES (1349, 5, 55, 4.74, 0.1);
+INSERT INTO t VALUES (1350, 5, 92, 4.75, 0.1);
+INSERT INTO t VALUES (1351, 5, 32, 4.76, 0.1);
+INSERT INTO t VALUES (1352, 5, 69, 4.77, 0.1);
+INSERT INTO t VALUES (1353, 5, 9, 4.78, 0.1);
+INSERT INTO t VALUES (1354, 5, 46, 4.79, 0.1);
+INSERT INTO t VALUES (1355, 5, 83, 4.80, 0.1);
+INSERT INTO t VALUES (1356, 5, 23, 4.81, 0.1);
+INSERT INTO t VALUES (1357, 5, 60, 4.82, 0.1);
+INSERT INTO t VALUES (1358, 5, 0, 4.83, 0.1);
+INSERT INTO t VALUES (1359, 5, 37, 4.84, 0.1);
+INSERT INTO t VALUES (1360, 5, 74, 4.85, 0.1);
+INSERT INTO t VALUES (1361, 5, 14, 4.86, 0.1);
+INSERT INTO t VALUES (1362, 5, 51, 4.87, 0.1);
+INSERT INTO t VALUES (1363, 5, 88, 4.88, 0.1);
+INSERT INTO t VALUES (1364, 5, 28, 4.89, 0.1);
+INSERT INTO t VALUES (1365, 5, 65, 4.90, 0.1);
+INSERT INTO t VALUES (1366, 5, 5, 4.91, 0.1);
+INSERT INTO t VALUES (1367, 5, 42, 4.92, 0.1);
+INSERT INTO t VALUES (1368, 5, 79, 4.93, 0.1);
+INSERT INTO t VALUES (1369, 5, 19, 4.94, 0.1);
+INSERT INTO t VALUES (1370, 5, 56, 4.95, 0.1);
+INSERT INTO t VALUES (1371, 5, 93, 4.96, 0.1);
+INSERT INTO t VALUES (1372, 5, 33, 4.97, 0.1);
+INSERT INTO t VALUES (1373, 5, 70, 4.98, 0.1);
+INSERT INTO t VALUES (1374, 5, 10, 4.99, 0.1);
+INSERT INTO t VALUES (1375, 5, 47, 5.00, 0.1);
+INSERT INTO t VALUES (1376, 5, 84, 5.01, 0.1);
+INSERT INTO t VALUES (1377, 5, 24, 5.02, 0.1);
+INSERT INTO t VALUES (1378, 5, 61, 5.03, 0.1);
+INSERT INTO t VALUES (1379, 5, 1, 5.04, 0.1);
+INSERT INTO t VALUES (1380, 5, 38, 5.05, 0.1);
+INSERT INTO t VALUES (1381, 5, 75, 5.06, 0.1);
+INSERT INTO t VALUES (1382, 5, 15, 5.07, 0.1);
+INSERT INTO t VALUES (1383, 5, 52, 5.08, 0.1);
+INSERT INTO t VALUES (1384, 5, 89, 5.09, 0.1);
+INSERT INTO t VALUES (1385, 5, 29, 5.10, 0.1);
+INSERT INTO t VALUES (1386, 5, 66, 5.11, 0.1);
+INSERT INTO t VALUES (1387, 5, 6, 5.12, 0.1);
+INSERT INTO t VALUES (1388, 5, 43, 5.13, 0.1);
+INSERT INTO t VALUES (1389, 5, 80, 5.14, 0.1);
+INSERT INTO t VALUES (1390, 5, 20, 5.15, 0.1);
+INSERT INTO t VALUES (1391, 5, 57, 5.16, 0.1);
+INSERT INTO t VALUES (1392, 5, 94, 5.17, 0.1);
+INSERT INTO t VALUES (1393, 5, 34, 5.18, 0.1);
+INSERT INTO t VALUES (1394, 5, 71, 5.19, 0.1);
+INSERT INTO t VALUES (1395, 5, 11, 5.20, 0.1);
+INSERT INTO t VALUES (1396, 5, 48, 5.21, 0.1);
+INSERT INTO t VALUES (1397, 5, 85, 5.22, 0.1);
+INSERT INTO t VALUES (1398, 5, 25, 5.23, 0.1);
+INSERT INTO t VALUES (1399, 5, 62, 5.24, 0.1);
+INSERT INTO t VALUES (1400, 5, 2, 5.25, 0.1);
+INSERT INTO t VALUES (1401, 5, 39, 5.26, 0.1);
+INSERT INTO t VALUES (1402, 5, 76, 5.27, 0.1);
+INSERT INTO t VALUES (1403, 5, 16, 5.28, 0.1);
+INSERT INTO t VALUES (1404, 5, 53, 5.29, 0.1);
+INSERT INTO t VALUES (1405, 5, 90, 5.30, 0.1);
+INSERT INTO t VALUES (1406, 5, 30, 5.31, 0.1);
+INSERT INTO t VALUES (1407, 5, 67, 5.32, 0.1);
+INSERT INTO t VALUES (1408, 5, 7, 5.33, 0.1);
+INSERT INTO t VALUES (1409, 5, 44, 5.34, 0.1);
+INSERT INTO t VALUES (1410, 5, 81, 5.35, 0.1);
+INSERT INTO t VALUES (1411, 5, 21, 5.36, 0.1);
+INSERT INTO t VALUES (1412, 5, 58, 5.37, 0.1);
+INSERT INTO t VALUES (1413, 5, 95, 5.38, 0.1);
+INSERT INTO t VALUES (1414, 5, 35, 5.39, 0.1);
+INSERT INTO t VALUES (1415, 5, 72, 5.40, 0.1);
+INSERT INTO t VALUES (1416, 5, 12, 5.41, 0.1);
+INSERT INTO t VALUES (1417, 5, 49, 5.42, 0.1);
+INSERT INTO t VALUES (1418, 5, 86, 5.43, 0.1);
+INSERT INTO t VALUES (1419, 5, 26, 5.44, 0.1);
+INSERT INTO t VALUES (1420, 5, 63, 5.45, 0.1);
+INSERT INTO t VALUES (1421, 5, 3, 5.46, 0.1);
+INSERT INTO t VALUES (1422, 5, 40, 5.47, 0.1);
+INSERT INTO t VALUES (1423, 5, 77, 5.48, 0.1);
+INSERT INTO t VALUES (1424, 5, 17, 5.49, 0.1);
+INSERT INTO t VALUES (1425, 5, 54, 5.50, 0.1);
+INSERT INTO t VALUES (1426, 5, 91, 5.51, 0.1);
+INSERT INTO t VALUES (1427, 5, 31, 5.52, 0.1);
+INSERT INTO t VALUES (1428, 5, 68, 5.53, 0.1);
+INSERT INTO t VALUES (1429, 5, 8, 5.54, 0.1);
+INSERT INTO t VALUES (1430, 5, 45, 5.55, 0.1);
+INSERT INTO t VALUES (1431, 5, 82, 5.56, 0.1);
+INSERT INTO t VALUES (1432, 5, 22, 5.57, 0.1);
+INSERT INTO t VALUES (1433, 5, 59, 5.58, 0.1);
+INSERT INTO t VALUES (1434, 5, 96, 5.59, 0.1);
+INSERT INTO t VALUES (1435, 5, 36, 5.60, 0.1);
+INSERT INTO t VALUES (1436, 5, 73, 5.61, 0.1);
+INSERT INTO t VALUES (1437, 5, 13, 5.62, 0.1);
+INSERT INTO t VALUES (1438, 5, 50, 5.63, 0.1);
+INSERT INTO t VALUES (1439, 5, 87, 5.64, 0.1);
+INSERT INTO t VALUES (1440, 5, 27, 5.65, 0.1);
+INSERT INTO t VALUES (1441, 5, 64, 5.66, 0.1);
+INSERT INTO t VALUES (1442, 5, 4, 5.67, 0.1);
+INSERT INTO t VALUES (1443, 5, 41, 5.68, 0.1);
+INSERT INTO t VALUES (1444, 5, 78, 5.69, 0.1);
+INSERT INTO t VALUES (1445, 5, 18, 5.70, 0.1);
+INSERT INTO t VALUES (1446, 5, 55, 5.71, 0.1);
+INSERT INTO t VALUES (1447, 5, 92, 5.72, 0.1);
+INSERT INTO t VALUES (1448, 5, 32, 5.73, 0.1);
+INSERT INTO t VALUES (1449, 5, 69, 5.74, 0.1);
+INSERT INTO t VALUES (1450, 5, 9, 5.75, 0.1);
+INSERT INTO t VALUES (1451, 5, 46, 5.76, 0.1);
+INSERT INTO t VALUES (1452, 5, 83, 5.77, 0.1);
+INSERT INTO t VALUES (1453, 5, 23, 5.78, 0.1);
+INSERT INTO t VALUES (1454, 5, 60, 5.79, 0.1);
+INSERT INTO t VALUES (1455, 5, 0, 5.80, 0.1);
+INSERT INTO t VALUES (1456, 5, 37, 5.81, 0.1);
+INSERT INTO t VALUES (1457, 5, 74, 5.82, 0.1);
+INSERT INTO t VALUES (1458, 5, 14, 5.83, 0.1);
+INSERT INTO t VALUES (1459, 5, 51, 5.84, 0.1);
+INSERT INTO t VALUES (1460, 5, 88, 5.85, 0.1);
+INSERT INTO t VALUES (1461, 5, 28, 5.86, 0.1);
+INSERT INTO t VALUES (1462, 5, 65, 5.87, 0.1);
+INSERT INTO t VALUES (1463, 5, 5, 5.88, 0.1);
+INSERT INTO t VALUES (1464, 5, 42, 5.89, 0.1);
+INSERT INTO t VALUES (1465, 5, 79, 5.90, 0.1);
+INSERT INTO t VALUES (1466, 5, 19, 5.91, 0.1);
+INSERT INTO t VALUES (1467, 5, 56, 5.92, 0.1);
+INSERT INTO t VALUES (1468, 5, 93, 5.93, 0.1);
+INSERT INTO t VALUES (1469, 5, 33, 5.94, 0.1);
+INSERT INTO t VALUES (1470, 5, 70, 5.95, 0.1);
+INSERT INTO t VALUES (1471, 5, 10, 5.96, 0.1);
+INSERT INTO t VALUES (1472, 5, 47, 5.97, 0.1);
+INSERT INTO t VALUES (1473, 5, 84, 5.98, 0.1);
+INSERT INTO t VALUES (1474, 5, 24, 5.99, 0.1);
+INSERT INTO t VALUES (1475, 5, 61, 6.00, 0.1);
+INSERT INTO t VALUES (1476, 5, 1, 6.01, 0.1);
+INSERT INTO t VALUES (1477, 5, 38, 6.02, 0.1);
+INSERT INTO t VALUES (1478, 5, 75, 6.03, 0.1);
+INSERT INTO t VALUES (1479, 5, 15, 6.04, 0.1);
+INSERT INTO t VALUES (1480, 5, 52, 6.05, 0.1);
+INSERT INTO t VALUES (1481, 5, 89, 6.06, 0.1);
+INSERT INTO t VALUES (1482, 5, 29, 6.07, 0.1);
+INSERT INTO t VALUES (1483, 5, 66, 6.08, 0.1);
+INSERT INTO t VALUES (1484, 5, 6, 6.09, 0.1);
+INSERT INTO t VALUES (1485, 5, 43, 6.10, 0.1);
+INSERT INTO t VALUES (1486, 5, 80, 6.11, 0.1);
+INSERT INTO t VALUES (1487, 5, 20, 6.12, 0.1);
+INSERT INTO t VALUES (1488, 5, 57, 6.13, 0.1);
+INSERT INTO t VALUES (1489, 5, 94, 6.14, 0.1);
+INSERT INTO t VALUES (1490, 5, 34, 6.15, 0.1);
+INSERT INTO t VALUES (1491, 5, 71, 6.16, 0.1);
+INSERT INTO t VALUES (1492, 5, 11, 6.17, 0.1);
+INSERT INTO t VALUES (1493, 5, 48, 6.18, 0.1);
+INSERT INTO t VALUES (1494, 5, 85, 6.19, 0.1);
+INSERT INTO t VALUES (1495, 5, 25, 6.20, 0.1);
+INSERT INTO t VALUES (1496, 5, 62, 6.21, 0.1);
+INSERT INTO t VALUES (1497, 5, 2, 6.22, 0.1);
+INSERT INTO t VALUES (1498, 5, 39, 6.23, 0.1);
+INSERT INTO t VALUES (1499, 5, 76, 6.24, 0.1);
+INSERT INTO t VALUES (1500, 5, 16, 6.25, 0.1);
+INSERT INTO t VALUES (1501, 5, 53, 6.26, 0.1);
+INSERT INTO t VALUES (1502, 5, 90, 6.27, 0.1);
+INSERT INTO t VALUES (1503, 5, 30, 6.28, 0.1);
+INSERT INTO t VALUES (1504, 5, 67, 6.29, 0.1);
+INSERT INTO t VALUES (1505, 5, 7, 6.30, 0.1);
+INSERT INTO t VALUES (1506, 5, 44, 6.31, 0.1);
+INSERT INTO t VALUES (1507, 5, 81, 6.32, 0.1);
+INSERT INTO t VALUES (1508, 5, 21, 6.33, 0.1);
+INSERT INTO t VALUES (1509, 5, 58, 6.34, 0.1);
+INSERT INTO t VALUES (1510, 5, 95, 6.35, 0.1);
+INSERT INTO t VALUES (1511, 5, 35, 6.36, 0.1);
+INSERT INTO t VALUES (1512, 5, 72, 6.37, 0.1);
+INSERT INTO t VALUES (1513, 5, 12, 6.38, 0.1);
+INSERT INTO t VALUES (1514, 5, 49, 6.39, 0.1);
+INSERT INTO t VALUES (1515, 5, 86, 6.40, 0.1);
+INSERT INTO t VALUES (1516, 5, 26, 6.41, 0.1);
+INSERT INTO t VALUES (1517, 5, 63, 6.42, 0.1);
+INSERT INTO t VALUES (1518, 5, 3, 6.43, 0.1);
+INSERT INTO t VALUES (1519, 5, 40, 6.44, 0.1);
+INSERT INTO t VALUES (1520, 5, 77, 6.45, 0.1);
+INSERT INTO t VALUES (1521, 5, 17, 6.46, 0.1);
+INSERT INTO t VALUES (1522, 5, 54, 6.47, 0.1);
+INSERT INTO t VALUES (1523, 5, 91, 6.48, 0.1);
+INSERT INTO t VALUES (1524, 5, 31, 6.49, 0.1);
+INSERT INTO t VALUES (1525, 5, 68, 6.50, 0.1);
+INSERT INTO t VALUES (1526, 5, 8, 6.51, 0.1);
+INSERT INTO t VALUES (1527, 5, 45, 6.52, 0.1);
+INSERT INTO t VALUES (1528, 5, 82, 6.53, 0.1);
+INSERT INTO t VALUES (1529, 5, 22, 6.54, 0.1);
+INSERT INTO t VALUES (1530, 5, 59, 6.55, 0.1);
+INSERT INTO t VALUES (1531, 5, 96, 6.56, 0.1);
+INSERT INTO t VALUES (1532, 5, 36, 6.57, 0.1);
+INSERT INTO t VALUES (1533, 5, 73, 6.58, 0.1);
+INSERT INTO t VALUES (1534, 5, 13, 6.59, 0.1);
+INSERT INTO t VALUES (1535, 5, 50, 6.60, 0.1);
+INSERT INTO t VALUES (1536, 5, 87, 6.61, 0.1);
+INSERT INTO t VALUES (1537, 5, 27, 6.62, 0.1);
+INSERT INTO t VALUES (1538, 5, 64, 6.63, 0.1);
+INSERT INTO t VALUES (1539, 5, 4, 6.64, 0.1);
+INSERT INTO t VALUES (1540, 5, 41, 6.65, 0.1);
+INSERT INTO t VALUES (1541, 5, 78, 6.66, 0.1);
+INSERT INTO t VALUES (1542, 5, 18, 6.67, 0.1);
+INSERT INTO t VALUES (1543, 5, 55, 6.68, 0.1);
+INSERT INTO t VALUES (1544, 5, 92, 6.69, 0.1);
+INSERT INTO t VALUES (1545, 5, 32, 6.70, 0.1);
+INSERT INTO t VALUES (1546, 5, 69, 6.71, 0.1);
+INSERT INTO t VALUES (1547, 5, 9, 6.72, 0.1);
+INSERT INTO t VALUES (1548, 5, 46, 6.73, 0.1);
+INSERT INTO t VALUES (1549, 5, 83, 6.74, 0.1);
+INSERT INTO t VALUES (1550, 5, 23, 6.75, 0.1);
+INSERT INTO t VALUES (1551, 5, 60, 6.76, 0.1);
+INSERT INTO t VALUES (1552, 5, 0, 6.77, 0.1);
+INSERT INTO t VALUES (1553, 5, 37, 6.78, 0.1);
+INSERT INTO t VALUES (1554, 5, 74, 6.79, 0.1);
+INSERT INTO t VALUES (1555, 5, 14, 6.80, 0.1);
+INSERT INTO t VALUES (1556, 5, 51, 6.81, 0.1);
+INSERT INTO t VALUES (1557, 5, 88, 6.82, 0.1);
+INSERT INTO t VALUES (1558, 5, 28, 6.83, 0.1);
+INSERT INTO t VALUES (1559, 5, 65, 6.84, 0.1);
+INSERT INTO t VALUES (1560, 5, 5, 6.85, 0.1);
+INSERT INTO t VALUES (1561, 5, 42, 6.86, 0.1);
+INSERT INTO t VALUES (1562, 5, 79, 6.87, 0.1);
+INSERT INTO t VALUES (1563, 5, 19, 6.88, 0.1);
+INSERT INTO t VALUES (1564, 5, 56, 6.89, 0.1);
+INSERT INTO t VALUES (1565, 5, 93, 6.90, 0.1);
+INSERT INTO t VALUES (1566, 5, 33, 6.91, 0.1);
+INSERT INTO t VALUES (1567, 5, 70, 6.92, 0.1);
+INSERT INTO t VALUES (1568, 5, 10, 6.93, 0.1);
+INSERT INTO t VALUES (1569, 5, 47, 6.94, 0.1);
+INSERT INTO t VALUES (1570, 5, 84, 6.95, 0.1);
+INSERT INTO t VALUES (1571, 5, 24, 6.96, 0.1);
+INSERT INTO t VALUES (1572, 5, 61, 6.97, 0.1);
+INSERT INTO t VALUES (1573, 5, 1, 6.98, 0.1);
+INSERT INTO t VALUES (1574, 5, 38, 6.99, 0.1);
+INSERT INTO t VALUES (1575, 5, 75, 7.00, 0.1);
+INSERT INTO t VALUES (1576, 5, 15, 7.01, 0.1);
+INSERT INTO t VALUES (1577, 5, 52, 7.02, 0.1);
+INSERT INTO t VALUES (1578, 5, 89, 7.03, 0.1);
+INSERT INTO t VALUES (1579, 5, 29, 7.04, 0.1);
+INSERT INTO t VALUES (1580, 5, 66, 7.05, 0.1);
+INSERT INTO t VALUES (1581, 5, 6, 7.06, 0.1);
+INSERT INTO t VALUES (1582, 5, 43, 7.07, 0.1);
+INSERT INTO t VALUES (1583, 5, 80, 7.08, 0.1);
+INSERT INTO t VALUES (1584, 5, 20, 7.09, 0.1);
+INSERT INTO t VALUES (1585, 5, 57, 7.10, 0.1);
+INSERT INTO t VALUES (1586, 5, 94, 7.11, 0.1);
+INSERT INTO t VALUES (1587, 5, 34, 7.12, 0.1);
+INSERT INTO t VALUES (1588, 5, 71, 7.13, 0.1);
+INSERT INTO t VALUES (1589, 5, 11, 7.14, 0.1);
+INSERT INTO t VALUES (1590, 5, 48, 7.15, 0.1);
+INSERT INTO t VALUES (1591, 5, 85, 7.16, 0.1);
+INSERT INTO t VALUES (1592, 5, 25, 7.17, 0.1);
+INSERT INTO t VALUES (1593, 5, 62, 7.18, 0.1);
+INSERT INTO t VALUES (1594, 5, 2, 7.19, 0.1);
+INSERT INTO t VALUES (1595, 5, 39, 7.20, 0.1);
+INSERT INTO t VALUES (1596, 5, 76, 7.21, 0.1);
+INSERT INTO t VALUES (1597, 5, 16, 7.22, 0.1);
+INSERT INTO t VALUES (1598, 5, 53, 7.23, 0.1);
+INSERT INTO t VALUES (1599, 5, 90, 7.24, 0.1);
+INSERT INTO t VALUES (1600, 5, 30, 7.25, 0.1);
+INSERT INTO t VALUES (1601, 5, 67, 7.26, 0.1);
+INSERT INTO t VALUES (1602, 5, 7, 7.27, 0.1);
+INSERT INTO t VALUES (1603, 5, 44, 7.28, 0.1);
+INSERT INTO t VALUES (1604, 5, 81, 7.29, 0.1);
+INSERT INTO t VALUES (1605, 5, 21, 7.30, 0.1);
+INSERT INTO t VALUES (1606, 5, 58, 7.31, 0.1);
+INSERT INTO t VALUES (1607, 5, 95, 7.32, 0.1);
+INSERT INTO t VALUES (1608, 5, 35, 7.33, 0.1);
+INSERT INTO t VALUES (1609, 5, 72, 7.34, 0.1);
+INSERT INTO t VALUES (1610, 5, 12, 7.35, 0.1);
+INSERT INTO t VALUES (1611, 5, 49, 7.36, 0.1);
+INSERT INTO t VALUES (1612, 5, 86, 7.37, 0.1);
+INSERT INTO t VALUES (1613, 5, 26, 7.38, 0.1);
+INSERT INTO t VALUES (1614, 5, 63, 7.39, 0.1);
+INSERT INTO t VALUES (1615, 5, 3, 7.40, 0.1);
+INSERT INTO t VALUES (1616, 5, 40, 7.41, 0.1);
+INSERT INTO t VALUES (1617, 5, 77, 7.42, 0.1);
+INSERT INTO t VALUES (1618, 5, 17, 7.43, 0.1);
+INSERT INTO t VALUES (1619, 5, 54, 7.44, 0.1);
+INSERT INTO t VALUES (1620, 5, 91, 7.45, 0.1);
+INSERT INTO t VALUES (1621, 5, 31, 7.46, 0.1);
+INSERT INTO t VALUES (1622, 5, 68, 7.47, 0.1);
+INSERT INTO t VALUES (1623, 5, 8, 7.48, 0.1);
+INSERT INTO t VALUES (1624, 5, 45, 7.49, 0.1);
+INSERT INTO t VALUES (1625, 5, 82, 7.50, 0.1);
+INSERT INTO t VALUES (1626, 5, 22, 7.51, 0.1);
+INSERT INTO t VALUES (1627, 5, 59, 7.52, 0.1);
+INSERT INTO t VALUES (1628, 5, 96, 7.53, 0.1);
+INSERT INTO t VALUES (1629, 5, 36, 7.54, 0.1);
+INSERT INTO t VALUES (1630, 5, 73, 7.55, 0.1);
+INSERT INTO t VALUES (1631, 5, 13, 7.56, 0.1);
+INSERT INTO t VALUES (1632, 5, 50, 7.57, 0.1);
+INSERT INTO t VALUES (1633, 5, 87, 7.58, 0.1);
+INSERT INTO t VALUES (1634, 5, 27, 7.59, 0.1);
+INSERT INTO t VALUES (1635, 5, 64, 7.60, 0.1);
+INSERT INTO t VALUES (1636, 5, 4, 7.61, 0.1);
+INSERT INTO t VALUES (1637, 5, 41, 7.62, 0.1);
+INSERT INTO t VALUES (1638, 5, 78, 7.63, 0.1);
+INSERT INTO t VALUES (1639, 5, 18, 7.64, 0.1);
+INSERT INTO t VALUES (1640, 5, 55, 7.65, 0.1);
+INSERT INTO t VALUES (1641, 5, 92, 7.66, 0.1);
+INSERT INTO t VALUES (1642, 5, 32, 7.67, 0.1);
+INSERT INTO t VALUES (1643, 5, 69, 7.68, 0.1);
+INSERT INTO t VALUES (1644, 5, 9, 7.69, 0.1);
+INSERT INTO t VALUES (1645, 5, 46, 7.70, 0.1);
+INSERT INTO t VALUES (1646, 5, 83, 7.71, 0.1);
+INSERT INTO t VALUES (1647, 5, 23, 7.72, 0.1);
+INSERT INTO t VALUES (1648, 5, 60, 7.73, 0.1);
+INSERT INTO t VALUES (1649, 5, 0, 7.74, 0.1);
+INSERT INTO t VALUES (1650, 5, 37, 7.75, 0.1);
+INSERT INTO t VALUES (1651, 5, 74, 7.76, 0.1);
+INSERT INTO t VALUES (1652, 5, 14, 7.77, 0.1);
+INSERT INTO t VALUES (1653, 5, 51, 7.78, 0.1);
+INSERT INTO t VALUES (1654, 5, 88, 7.79, 0.1);
+INSERT INTO t VALUES (1655, 5, 28, 7.80, 0.1);
+INSERT INTO t VALUES (1656, 5, 65, 7.81, 0.1);
+INSERT INTO t VALUES (1657, 5, 5, 7.82, 0.1);
+INSERT INTO t VALUES (1658, 5, 42, 7.83, 0.1);
+INSERT INTO t VALUES (1659, 5, 79, 7.84, 0.1);
+INSERT INTO t VALUES (1660, 5, 19, 7.85, 0.1);
+INSERT INTO t VALUES (1661, 5, 56, 7.86, 0.1);
+INSERT INTO t VALUES (1662, 5, 93, 7.87, 0.1);
+INSERT INTO t VALUES (1663, 5, 33, 7.88, 0.1);
+INSERT INTO t VALUES (1664, 5, 70, 7.89, 0.1);
+INSERT INTO t VALUES (1665, 5, 10, 7.90, 0.1);
+INSERT INTO t VALUES (1666, 5, 47, 7.91, 0.1);
+INSERT INTO t VALUES (1667, 5, 84, 7.92, 0.1);
+INSERT INTO t VALUES (1668, 5, 24, 7.93, 0.1);
+INSERT INTO t VALUES (1669, 5, 61, 7.94, 0.1);
+INSERT INTO t VALUES (1670, 5, 1, 7.95, 0.1);
+INSERT INTO t VALUES (1671, 5, 38, 7.96, 0.1);
+INSERT INTO t VALUES (1672, 5, 75, 7.97, 0.1);
+INSERT INTO t VALUES (1673, 5, 15, 7.98, 0.1);
+INSERT INTO t VALUES (1674, 5, 52, 7.99, 0.1);
+INSERT INTO t VALUES (1675, 5, 89, 8.00, 0.1);
+INSERT INTO t VALUES (1676, 5, 29, 8.01, 0.1);
+INSERT INTO t VALUES (1677, 5, 66, 8.02, 0.1);
+INSERT INTO t VALUES (1678, 5, 6, 8.03, 0.1);
+INSERT INTO t VALUES (1679, 5, 43, 8.04, 0.1);
+INSERT INTO t VALUES (1680, 5, 80, 8.05, 0.1);
+INSERT INTO t VALUES (1681, 5, 20, 8.06, 0.1);
+INSERT INTO t VALUES (1682, 5, 57, 8.07, 0.1);
+INSERT INTO t VALUES (1683, 5, 94, 8.08, 0.1);
+INSERT INTO t VALUES (1684, 5, 34, 8.09, 0.1);
+INSERT INTO t VALUES (1685, 5, 71, 8.10, 0.1);
+INSERT INTO t VALUES (1686, 5, 11, 8.11, 0.1);
+INSERT INTO t VALUES (1687, 5, 48, 8.12, 0.1);
+INSERT INTO t VALUES (1688, 5, 85, 8.13, 0.1);
+INSERT INTO t VALUES (1689, 5, 25, 8.14, 0.1);
+INSERT INTO t VALUES (1690, 5, 62, 8.15, 0.1);
+INSERT INTO t VALUES (1691, 5, 2, 8.16, 0.1);
+INSERT INTO t VALUES (1692, 5, 39, 8.17, 0.1);
+INSERT INTO t VALUES (1693, 5, 76, 8.18, 0.1);
+INSERT INTO t VALUES (1694, 5, 16, 8.19, 0.1);
+INSERT INTO t VALUES (1695, 5, 53, 8.20, 0.1);
+INSERT INTO t VALUES (1696, 5, 90, 8.21, 0.1);
+INSERT INTO t VALUES (1697, 5, 30, 8.22, 0.1);
+INSERT INTO t VALUES (1698, 5, 67, 8.23, 0.1);
+INSERT INTO t VALUES (1699, 5, 7, 8.24, 0.1);
+INSERT INTO t VALUES (1700, 5, 44, 8.25, 0.1);
+INSERT INTO t VALUES (1701, 5, 81, 8.26, 0.1);
+INSERT INTO t VALUES (1702, 5, 21, 8.27, 0.1);
+INSERT INTO t VALUES (1703, 5, 58, 8.28, 0.1);
+INSERT INTO t VALUES (1704, 5, 95, 8.29, 0.1);
+INSERT INTO t VALUES (1705, 5, 35, 8.30, 0.1);
+INSERT INTO t VALUES (1706, 5, 72, 8.31, 0.1);
+INSERT INTO t VALUES (1707, 5, 12, 8.32, 0.1);
+INSERT INTO t VALUES (1708, 5, 49, 8.33, 0.1);
+INSERT INTO t VALUES (1709, 5, 86, 8.34, 0.1);
+INSERT INTO t VALUES (1710, 5, 26, 8.35, 0.1);
+INSERT INTO t VALUES (1711, 5, 63, 8.36, 0.1);
+INSERT INTO t VALUES (1712, 5, 3, 8.37, 0.1);
+INSERT INTO t VALUES (1713, 5, 40, 8.38, 0.1);
+INSERT INTO t VALUES (1714, 5, 77, 8.39, 0.1);
+INSERT INTO t VALUES (1715, 5, 17, 8.40, 0.1);
+INSERT INTO t VALUES (1716, 5, 54, 8.41, 0.1);
+INSERT INTO t VALUES (1717, 5, 91, 8.42, 0.1);
+INSERT INTO t VALUES (1718, 5, 31, 8.43, 0.1);
+INSERT INTO t VALUES (1719, 5, 68, 8.44, 0.1);
+INSERT INTO t VALUES (1720, 5, 8, 8.45, 0.1);
+INSERT INTO t VALUES (1721, 5, 45, 8.46, 0.1);
+INSERT INTO t VALUES (1722, 5, 82, 8.47, 0.1);
+INSERT INTO t VALUES (1723, 5, 22, 8.48, 0.1);
+INSERT INTO t VALUES (1724, 5, 59, 8.49, 0.1);
+INSERT INTO t VALUES (1725, 5, 96, 8.50, 0.1);
+INSERT INTO t VALUES (1726, 5, 36, 8.51, 0.1);
+INSERT INTO t VALUES (1727, 5, 73, 8.52, 0.1);
+INSERT INTO t VALUES (1728, 5, 13, 8.53, 0.1);
+INSERT INTO t VALUES (1729, 5, 50, 8.54, 0.1);
+INSERT INTO t VALUES (1730, 5, 87, 8.55, 0.1);
+INSERT INTO t VALUES (1731, 5, 27, 8.56, 0.1);
+INSERT INTO t VALUES (1732, 5, 64, 8.57, 0.1);
+INSERT INTO t VALUES (1733, 5, 4, 8.58, 0.1);
+INSERT INTO t VALUES (1734, 5, 41, 8.59, 0.1);
+INSERT INTO t VALUES (1735, 5, 78, 8.60, 0.1);
+INSERT INTO t VALUES (1736, 5, 18, 8.61, 0.1);
+INSERT INTO t VALUES (1737, 5, 55, 8.62, 0.1);
+INSERT INTO t VALUES (1738, 5, 92, 8.63, 0.1);
+INSERT INTO t VALUES (1739, 5, 32, 8.64, 0.1);
+INSERT INTO t VALUES (1740, 5, 69, 8.65, 0.1);
+INSERT INTO t VALUES (1741, 5, 9, 8.66, 0.1);
+INSERT INTO t VALUES (1742, 5, 46, 8.67, 0.1);
+INSERT INTO t VALUES (1743, 5, 83, 8.68, 0.1);
+INSERT INTO t VALUES (1744, 5, 23, 8.69, 0.1);
+INSERT INTO t VALUES (1745, 5, 60, 8.70, 0.1);
+INSERT INTO t VALUES (1746, 5, 0, 8.71, 0.1);
+INSERT INTO t VALUES (1747, 5, 37, 8.72, 0.1);
+INSERT INTO t VALUES (1748, 5, 74, 8.73, 0.1);
+INSERT INTO t VALUES (1749, 5, 14, 8.74, 0.1);
+INSERT INTO t VALUES (1750, 5, 51, 8.75, 0.1);
+INSERT INTO t VALUES (1751, 5, 88, 8.76, 0.1);
+INSERT INTO t VALUES (1752, 5, 28, 8.77, 0.1);
+INSERT INTO t VALUES (1753, 5, 65, 8.78, 0.1);
+INSERT INTO t VALUES (1754, 5, 5, 8.79, 0.1);
+INSERT INTO t VALUES (1755, 5, 42, 8.80, 0.1);
+INSERT INTO t VALUES (1756, 5, 79, 8.81, 0.1);
+INSERT INTO t VALUES (1757, 5, 19, 8.82, 0.1);
+INSERT INTO t VALUES (1758, 5, 56, 8.83, 0.1);
+INSERT INTO t VALUES (1759, 5, 93, 8.84, 0.1);
+INSERT INTO t VALUES (1760, 5, 33, 8.85, 0.1);
+INSERT INTO t VALUES (1761, 5, 70, 8.86, 0.1);
+INSERT INTO t VALUES (1762, 5, 10, 8.87, 0.1);
+INSERT INTO t VALUES (1763, 5, 47, 8.88, 0.1);
+INSERT INTO t VALUES (1764, 5, 84, 8.89, 0.1);
+INSERT INTO t VALUES (1765, 5, 24, 8.90, 0.1);
+INSERT INTO t VALUES (1766, 5, 61, 8.91, 0.1);
+INSERT INTO t VALUES (1767, 5, 1, 8.92, 0.1);
+INSERT INTO t VALUES (1768, 5, 38, 8.93, 0.1);
+INSERT INTO t VALUES (1769, 5, 75, 8.94, 0.1);
+INSERT INTO t VALUES (1770, 5, 15, 8.95, 0.1);
+INSERT INTO t VALUES (1771, 5, 52, 8.96, 0.1);
+INSERT INTO t VALUES (1772, 5, 89, 8.97, 0.1);
+INSERT INTO t VALUES (1773, 5, 29, 8.98, 0.1);
+INSERT INTO t VALUES (1774, 5, 66, 8.99, 0.1);
+INSERT INTO t VALUES (1775, 5, 6, 9.00, 0.1);
+INSERT INTO t VALUES (1776, 5, 43, 9.01, 0.1);
+INSERT INTO t VALUES (1777, 5, 80, 9.02, 0.1);
+INSERT INTO t VALUES (1778, 5, 20, 9.03, 0.1);
+INSERT INTO t VALUES (1779, 5, 57, 9.04, 0.1);
+INSERT INTO t VALUES (1780, 5, 94, 9.05, 0.1);
+INSERT INTO t VALUES (1781, 5, 34, 9.06, 0.1);
+INSERT INTO t VALUES (1782, 5, 71, 9.07, 0.1);
+INSERT INTO t VALUES (1783, 5, 11, 9.08, 0.1);
+INSERT INTO t VALUES (1784, 5, 48, 9.09, 0.1);
+INSERT INTO t VALUES (1785, 5, 85, 9.10, 0.1);
+INSERT INTO t VALUES (1786, 5, 25, 9.11, 0.1);
+INSERT INTO t VALUES (1787, 5, 62, 9.12, 0.1);
+INSERT INTO t VALUES (1788, 5, 2, 9.13, 0.1);
+INSERT INTO t VALUES (1789, 5, 39, 9.14, 0.1);
+INSERT INTO t VALUES (1790, 5, 76, 9.15, 0.1);
+INSERT INTO t VALUES (1791, 5, 16, 9.16, 0.1);
+INSERT INTO t VALUES (1792, 5, 53, 9.17, 0.1);
+INSERT INTO t VALUES (1793, 5, 90, 9.18, 0.1);
+INSERT INTO t VALUES (1794, 5, 30, 9.19, 0.1);
+INSERT INTO t VALUES (1795, 5, 67, 9.20, 0.1);
+INSERT INTO t VALUES (1796, 5, 7, 9.21, 0.1);
+INSERT INTO t VALUES (1797, 5, 44, 9.22, 0.1);
+INSERT INTO t VALUES (1798, 5, 81, 9.23, 0.1);
+INSERT INTO t VALUES (1799, 5, 21, 9.24, 0.1);
+INSERT INTO t VALUES (1800, 5, 58, 9.25, 0.1);
+INSERT INTO t VALUES (1801, 5, 95, 9.26, 0.1);
+INSERT INTO t VALUES (1802, 5, 35, 9.27, 0.1);
+INSERT INTO t VALUES (1803, 5, 72, 9.28, 0.1);
+INSERT INTO t VALUES (1804, 5, 12, 9.29, 0.1);
+INSERT INTO t VALUES (1805, 5, 49, 9.30, 0.1);
+INSERT INTO t VALUES (1806, 5, 86, 9.31, 0.1);
+INSERT INTO t VALUES (1807, 5, 26, 9.32, 0.1);
+INSERT INTO t VALUES (1808, 5, 63, 9.33, 0.1);
+INSERT INTO t VALUES (1809, 5, 3, 9.34, 0.1);
+INSERT INTO t VALUES (1810, 5, 40, 9.35, 0.1);
+INSERT INTO t VALUES (1811, 5, 77, 9.36, 0.1);
+INSERT INTO t VALUES (1812, 5, 17, 9.37, 0.1);
+INSERT INTO t VALUES (1813, 5, 54, 9.38, 0.1);
+INSERT INTO t VALUES (1814, 5, 91, 9.39, 0.1);
+INSERT INTO t VALUES (1815, 5, 31, 9.40, 0.1);
+INSERT INTO t VALUES (1816, 5, 68, 9.41, 0.1);
+INSERT INTO t VALUES (1817, 5, 8, 9.42, 0.1);
+INSERT INTO t VALUES (1818, 5, 45, 9.43, 0.1);
+INSERT INTO t VALUES (1819, 5, 82, 9.44, 0.1);
+INSERT INTO t VALUES (1820, 5, 22, 9.45, 0.1);
+INSERT INTO t VALUES (1821, 5, 59, 9.46, 0.1);
+INSERT INTO t VALUES (1822, 5, 96, 9.47, 0.1);
+INSERT INTO t VALUES (1823, 5, 36, 9.48, 0.1);
+INSERT INTO t VALUES (1824, 5, 73, 9.49, 0.1);
+INSERT INTO t VALUES (1825, 5, 13, 9.50, 0.1);
+INSERT INTO t VALUES (1826, 5, 50, 9.51, 0.1);
+INSERT INTO t VALUES (1827, 5, 87, 9.52, 0.1);
+INSERT INTO t VALUES (1828, 5, 27, 9.53, 0.1);
+INSERT INTO t VALUES (1829, 5, 64, 9.54, 0.1);
+INSERT INTO t VALUES (1830, 5, 4, 9.55, 0.1);
+INSERT INTO t VALUES (1831, 5, 41, 9.56, 0.1);
+INSERT INTO t VALUES (1832, 5, 78, 9.57, 0.1);
+INSERT INTO t VALUES (1833, 5, 18, 9.58, 0.1);
+INSERT INTO t VALUES (1834, 5, 55, 9.59, 0.1);
+INSERT INTO t VALUES (1835, 5, 92, 9.60, 0.1);
+INSERT INTO t VALUES (1836, 5, 32, 9.61, 0.1);
+INSERT INTO t VALUES (1837, 5, 69, 9.62, 0.1);
+INSERT INTO t VALUES (1838, 5, 9, 9.63, 0.1);
+INSERT INTO t VALUES (1839, 5, 46, 9.64, 0.1);
+INSERT INTO t VALUES (1840, 5, 83, 9.65, 0.1);
+INSERT INTO t VALUES (1841, 5, 23, 9.66, 0.1);
+INSERT INTO t VALUES (1842, 5, 60, 9.67, 0.1);
+INSERT INTO t VALUES (1843, 5, 0, 9.68, 0.1);
+INSERT INTO t VALUES (1844, 5, 37, 9.69, 0.1);
+INSERT INTO t VALUES (1845, 5, 74, 9.70, 0.1);
+INSERT INTO t VALUES (1846, 5, 14, 9.71, 0.1);
+INSERT INTO t VALUES (1847, 5, 51, 9.72, 0.1);
+INSERT INTO t VALUES (1848, 5, 88, 9.73, 0.1);
+INSERT INTO t VALUES (1849, 5, 28, 9.74, 0.1);
+INSERT INTO t VALUES (1850, 5, 65, 9.75, 0.1);
+INSERT INTO t VALUES (1851, 5, 5, 9.76, 0.1);
+INSERT INTO t VALUES (1852, 5, 42, 9.77, 0.1);
+INSERT INTO t VALUES (1853, 5, 79, 9.78, 0.1);
+INSERT INTO t VALUES (1854, 5, 19, 9.79, 0.1);
+INSERT INTO t VALUES (1855, 5, 56, 9.80, 0.1);
+INSERT INTO t VALUES (1856, 5, 93, 9.81, 0.1);
+INSERT INTO t VALUES (1857, 5, 33, 9.82, 0.1);
+INSERT INTO t VALUES (1858, 5, 70, 9.83, 0.1);
+INSERT INTO t VALUES (1859, 5, 10, 9.84, 0.1);
+INSERT INTO t VALUES (1860, 5, 47, 9.85, 0.1);
+INSERT INTO t VALUES (1861, 5, 84, 9.86, 0.1);
+INSERT INTO t VALUES (1862, 5, 24, 9.87, 0.1);
+INSERT INTO t VALUES (1863, 5, 61, 9.88, 0.1);
+INSERT INTO t VALUES (1864, 5, 1, 9.89, 0.1);
+INSERT INTO t VALUES (1865, 5, 38, 9.90, 0.1);
+INSERT INTO t VALUES (1866, 5, 75, 9.91, 0.1);
+INSERT INTO t VALUES (1867, 5, 15, 9.92, 0.1);
+INSERT INTO t VALUES (1868, 5, 52, 9.93, 0.1);
+INSERT INTO t VALUES (1869, 5, 89, 9.94, 0.1);
+INSERT INTO t VALUES (1870, 5, 29, 9.95, 0.1);
+INSERT INTO t VALUES (1871, 5, 66, 9.96, 0.1);
+INSERT INTO t VALUES (1872, 5, 6, 9.97, 0.1);
+INSERT INTO t VALUES (1873, 5, 43, 9.98, 0.1);
+INSERT INTO t VALUES (1874, 5, 80, 9.99, 0.1);
+INSERT INTO t VALUES (1875, 5, 20, 10.00, 0.1);
+INSERT INTO t VALUES (1876, 5, 57, 10.01, 0.1);
+INSERT INTO t VALUES (1877, 5, 94, 10.02, 0.1);
+INSERT INTO t VALUES (1878, 5, 34, 10.03, 0.1);
+INSERT INTO t VALUES (1879, 5, 71, 10.04, 0.1);
+INSERT INTO t VALUES (1880, 5, 11, 10.05, 0.1);
+INSERT INTO t VALUES (1881, 5, 48, 10.06, 0.1);
+INSERT INTO t VALUES (1882, 5, 85, 10.07, 0.1);
+INSERT INTO t VALUES (1883, 5, 25, 10.08, 0.1);
+INSERT INTO t VALUES (1884, 5, 62, 10.09, 0.1);
+INSERT INTO t VALUES (1885, 5, 2, 10.10, 0.1);
+INSERT INTO t VALUES (1886, 5, 39, 10.11, 0.1);
+INSERT INTO t VALUES (1887, 5, 76, 10.12, 0.1);
+INSERT INTO t VALUES (1888, 5, 16, 10.13, 0.1);
+INSERT INTO t VALUES (1889, 5, 53, 10.14, 0.1);
+INSERT INTO t VALUES (1890, 5, 90, 10.15, 0.1);
+INSERT INTO t VALUES (1891, 5, 30, 10.16, 0.1);
+INSERT INTO t VALUES (1892, 5, 67, 10.17, 0.1);
+INSERT INTO t VALUES (1893, 5, 7, 10.18, 0.1);
+INSERT INTO t VALUES (1894, 5, 44, 10.19, 0.1);
+INSERT INTO t VALUES (1895, 5, 81, 10.20, 0.1);
+INSERT INTO t VALUES (1896, 5, 21, 10.21, 0.1);
+INSERT INTO t VALUES (1897, 5, 58, 10.22, 0.1);
+INSERT INTO t VALUES (1898, 5, 95, 10.23, 0.1);
+INSERT INTO t VALUES (1899, 5, 35, 10.24, 0.1);
+INSERT INTO t VALUES (1900, 5, 72, 10.25, 0.1);
+INSERT INTO t VALUES (1901, 5, 12, 10.26, 0.1);
+INSERT INTO t VALUES (1902, 5, 49, 10.27, 0.1);
+INSERT INTO t VALUES (1903, 5, 86, 10.28, 0.1);
+INSERT INTO t VALUES (1904, 5, 26, 10.29, 0.1);
+INSERT INTO t VALUES (1905, 5, 63, 10.30, 0.1);
+INSERT INTO t VALUES (1906, 5, 3, 10.31, 0.1);
+INSERT INTO t VALUES (1907, 5, 40, 10.32, 0.1);
+INSERT INTO t VALUES (1908, 5, 77, 10.33, 0.1);
+INSERT INTO t VALUES (1909, 5, 17, 10.34, 0.1);
+INSERT INTO t VALUES (1910, 5, 54, 10.35, 0.1);
+INSERT INTO t VALUES (1911, 5, 91, 10.36, 0.1);
+INSERT INTO t VALUES (1912, 5, 31, 10.37, 0.1);
+INSERT INTO t VALUES (1913, 5, 68, 10.38, 0.1);
+INSERT INTO t VALUES (1914, 5, 8, 10.39, 0.1);
+INSERT INTO t VALUES (1915, 5, 45, 10.40, 0.1);
+INSERT INTO t VALUES (1916, 5, 82, 10.41, 0.1);
+INSERT INTO t VALUES (1917, 5, 22, 10.42, 0.1);
+INSERT INTO t VALUES (1918, 5, 59, 10.43, 0.1);
+INSERT INTO t VALUES (1919, 5, 96, 10.44, 0.1);
+INSERT INTO t VALUES (1920, 5, 36, 10.45, 0.1);
+INSERT INTO t VALUES (1921, 5, 73, 10.46, 0.1);
+INSERT INTO t VALUES (1922, 5, 13, 10.47, 0.1);
+INSERT INTO t VALUES (1923, 5, 50, 10.48, 0.1);
+INSERT INTO t VALUES (1924, 5, 87, 10.49, 0.1);
+INSERT INTO t VALUES (1925, 5, 27, 10.50, 0.1);
+INSERT INTO t VALUES (1926, 5, 64, 10.51, 0.1);
+INSERT INTO t VALUES (1927, 5, 4, 10.52, 0.1);
+INSERT INTO t VALUES (1928, 5, 41, 10.53, 0.1);
+INSERT INTO t VALUES (1929, 5, 78, 10.54, 0.1);
+INSERT INTO t VALUES (1930, 5, 18, 10.55, 0.1);
+INSERT INTO t VALUES (1931, 5, 55, 10.56, 0.1);
+INSERT INTO t VALUES (1932, 5, 92, 10.57, 0.1);
+INSERT INTO t VALUES (1933, 5, 32, 10.58, 0.1);
+INSERT INTO t VALUES (1934, 5, 69, 10.59, 0.1);
+INSERT INTO t VALUES (1935, 5, 9, 10.60, 0.1);
+INSERT INTO t VALUES (1936, 5, 46, 10.61, 0.1);
+INSERT INTO t VALUES (1937, 5, 83, 10.62, 0.1);
+INSERT INTO t VALUES (1938, 5, 23, 10.63, 0.1);
+INSERT INTO t VALUES (1939, 5, 60, 10.64, 0.1);
+INSERT INTO t VALUES (1940, 5, 0, 10.65, 0.1);
+INSERT INTO t VALUES (1941, 5, 37, 10.66, 0.1);
+INSERT INTO t VALUES (1942, 5, 74, 10.67, 0.1);
+INSERT INTO t VALUES (1943, 5, 14, 10.68, 0.1);
+INSERT INTO t VALUES (1944, 5, 51, 10.69, 0.1);
+INSERT INTO t VALUES (1945, 5, 88, 10.70, 0.1);
+INSERT INTO t VALUES (1946, 5, 28, 10.71, 0.1);
+INSERT INTO t VALUES (1947, 5, 65, 10.72, 0.1);
+INSERT INTO t VALUES (1948, 5, 5, 10.73, 0.1);
+INSERT INTO t VALUES (1949, 5, 42, 10.74, 0.1);
+INSERT INTO t VALUES (1950, 5, 79, 10.75, 0.1);
+INSERT INTO t VALUES (1951, 5, 19, 10.76, 0.1);
+INSERT INTO t VALUES (1952, 5, 56, 10.77, 0.1);
+INSERT INTO t VALUES (1953, 5, 93, 10.78, 0.1);
+INSERT INTO t VALUES (1954, 5, 33, 10.79, 0.1);
+INSERT INTO t VALUES (1955, 5, 70, 10.80, 0.1);
+INSERT INTO t VALUES (1956, 5, 10, 10.81, 0.1);
+INSERT INTO t VALUES (1957, 5, 47, 10.82, 0.1);
+INSERT INTO t VALUES (1958, 5, 84, 10.83, 0.1);
+INSERT INTO t VALUES (1959, 5, 24, 10.84, 0.1);
+INSERT INTO t VALUES (1960, 5, 61, 10.85, 0.1);
+INSERT INTO t VALUES (1961, 5, 1, 10.86, 0.1);
+INSERT INTO t VALUES (1962, 5, 38, 10.87, 0.1);
+INSERT INTO t VALUES (1963, 5, 75, 10.88, 0.1);
+INSERT INTO t VALUES (1964, 5, 15, 10.89, 0.1);
+INSERT INTO t VALUES (1965, 5, 52, 10.90, 0.1);
+INSERT INTO t VALUES (1966, 5, 89, 10.91, 0.1);
+INSERT INTO t VALUES (1967, 5, 29, 10.92, 0.1);
+INSERT INTO t VALUES (1968, 5, 66, 10.93, 0.1);
+INSERT INTO t VALUES (1969, 5, 6, 10.94, 0.1);
+INSERT INTO t VALUES (1970, 5, 43, 10.95, 0.1);
+INSERT INTO t VALUES (1971, 5, 80, 10.96, 0.1);
+INSERT INTO t VALUES (1972, 5, 20, 10.97, 0.1);
+INSERT INTO t VALUES (1973, 5, 57, 10.98, 0.1);
+INSERT INTO t VALUES (1974, 5, 94, 10.99, 0.1);
+INSERT INTO t VALUES (1975, 5, 34, 11.00, 0.1);
+INSERT INTO t VALUES (1976, 5, 71, 11.01, 0.1);
+INSERT INTO t VALUES (1977, 5, 11, 11.02, 0.1);
+INSERT INTO t VALUES (1978, 5, 48, 11.03, 0.1);
+INSERT INTO t VALUES (1979, 5, 85, 11.04, 0.1);
+INSERT INTO t VALUES (1980, 5, 25, 11.05, 0.1);
+INSERT INTO t VALUES (1981, 5, 62, 11.06, 0.1);
+INSERT INTO t VALUES (1982, 5, 2, 11.07, 0.1);
+INSERT INTO t VALUES (1983, 5, 39, 11.08, 0.1);
+INSERT INTO t VALUES (1984, 5, 76, 11.09, 0.1);
+INSERT INTO t VALUES (1985, 5, 16, 11.10, 0.1);
+INSERT INTO t VALUES (1986, 5, 53, 11.11, 0.1);
+INSERT INTO t VALUES (1987, 5, 90, 11.12, 0.1);
+INSERT INTO t VALUES (1988, 5, 30, 11.13, 0.1);
+INSERT INTO t VALUES (1989, 5, 67, 11.14, 0.1);
+INSERT INTO t VALUES (1990, 5, 7, 11.15, 0.1);
+INSERT INTO t VALUES (1991, 5, 44, 11.16, 0.1);
+INSERT INTO t VALUES (1992, 5, 81, 11.17, 0.1);
+INSERT INTO t VALUES (1993, 5, 21, 11.18, 0.1);
+INSERT INTO t VALUES (1994, 5, 58, 11.19, 0.1);
+INSERT INTO t VALUES (1995, 5, 95, 11.20, 0.1);
+INSERT INTO t VALUES (1996, 5, 35, 11.21, 0.1);
+INSERT INTO t VALUES (1997, 5, 72, 11.22, 0.1);
+INSERT INTO t VALUES (1998, 5, 12, 11.23, 0.1);
+INSERT INTO t VALUES (1999, 5, 49, 11.24, 0.1);
+INSERT INTO t VALUES (2000, 5, 86, 1.25, 0.1);
+INSERT INTO t VALUES (2001, 5, 26, 1.26, 0.1);
+INSERT INTO t VALUES (2002, 5, 63, 1.27, 0.1);
+INSERT INTO t VALUES (2003, 5, 3, 1.28, 0.1);
+INSERT INTO t VALUES (2004, 5, 40, 1.29, 0.1);
+INSERT INTO t VALUES (2005, 5, 77, 1.30, 0.1);
+INSERT INTO t VALUES (2006, 5, 17, 1.31, 0.1);
+INSERT INTO t VALUES (2007, 5, 54, 1.32, 0.1);
+INSERT INTO t VALUES (2008, 5, 91, 1.33, 0.1);
+INSERT INTO t VALUES (2009, 5, 31, 1.34, 0.1);
+INSERT INTO t VALUES (2010, 5, 68, 1.35, 0.1);
+INSERT INTO t VALUES (2011, 5, 8, 1.36, 0.1);
+INSERT INTO t VALUES (2012, 5, 45, 1.37, 0.1);
+INSERT INTO t VALUES (2013, 5, 82, 1.38, 0.1);
+INSERT INTO t VALUES (2014, 5, 22, 1.39, 0.1);
+INSERT INTO t VALUES (2015, 5, 59, 1.40, 0.1);
+INSERT INTO t VALUES (2016, 5, 96, 1.41, 0.1);
+INSERT INTO t VALUES (2017, 5, 36, 1.42, 0.1);
+INSERT INTO t VALUES (2018, 5, 73, 1.43, 0.1);
+INSERT INTO t VALUES (2019, 5, 13, 1.44, 0.1);
+INSERT INTO t VALUES (2020, 5, 50, 1.45, 0.1);
+INSERT INTO t VALUES (2021, 5, 87, 1.46, 0.1);
+INSERT INTO t VALUES (2022, 5, 27, 1.47, 0.1);
+INSERT INTO t VALUES (2023, 5, 64, 1.48, 0.1);
+INSERT INTO t VALUES (2024, 5, 4, 1.49, 0.1);
+INSERT INTO t VALUES (2025, 5, 41, 1.50, 0.1);
+INSERT INTO t VALUES (2026, 5, 78, 1.51, 0.1);
+INSERT INTO t VALUES (2027, 5, 18, 1.52, 0.1);
+INSERT INTO t VALUES (2028, 5, 55, 1.53, 0.1);
+INSERT INTO t VALUES (2029, 5, 92, 1.54, 0.1);
+INSERT INTO t VALUES (2030, 5, 32, 1.55, 0.1);
+INSERT INTO t VALUES (2031, 5, 69, 1.56, 0.1);
+INSERT INTO t VALUES (2032, 5, 9, 1.57, 0.1);
+INSERT INTO t VALUES (2033, 5, 46, 1.58, 0.1);
+INSERT INTO t VALUES (2034, 5, 83, 1.59, 0.1);
+INSERT INTO t VALUES (2035, 5, 23, 1.60, 0.1);
+INSERT INTO t VALUES (2036, 5, 60, 1.61, 0.1);
+INSERT INTO t VALUES (2037, 5, 0, 1.62, 0.1);
+INSERT INTO t VALUES (2038, 5, 37, 1.63, 0.1);
+INSERT INTO t VALUES (2039, 5, 74, 1.64, 0.1);
+INSERT INTO t VALUES (2040, 5, 14, 1.65, 0.1);
+INSERT INTO t VALUES (2041, 5, 51, 1.66, 0.1);
+INSERT INTO t VALUES (2042, 5, 88, 1.67, 0.1);
+INSERT INTO t VALUES (2043, 5, 28, 1.68, 0.1);
+INSERT INTO t VALUES (2044, 5, 65, 1.69, 0.1);
+INSERT INTO t VALUES (2045, 5, 5, 1.70, 0.1);
+INSERT INTO t VALUES (2046, 5, 42, 1.71, 0.1);
+INSERT INTO t VALUES (2047, 5, 79, 1.72, 0.1);
+INSERT INTO t VALUES (2048, 20, 19, 1.73, 0.1);
+INSERT INTO t VALUES (2049, 20, 56, 1.74, 0.1);
+INSERT INTO t VALUES (2050, 20, 93, 1.75, 0.1);
+INSERT INTO t VALUES (2051, 20, 33, 1.76, 0.1);
+INSERT INTO t VALUES (2052, 20, 70, 1.77, 0.1);
+INSERT INTO t VALUES (2053, 20, 10, 1.78, 0.1);
+INSERT INTO t VALUES (2054, 20, 47, 1.79, 0.1);
+INSERT INTO t VALUES (2055, 20, 84, 1.80, 0.1);
+INSERT INTO t VALUES (2056, 20, 24, 1.81, 0.1);
+INSERT INTO t VALUES (2057, 20, 61, 1.82, 0.1);
+INSERT INTO t VALUES (2058, 20, 1, 1.83, 0.1);
+INSERT INTO t VALUES (2059, 20, 38, 1.84, 0.1);
+INSERT INTO t VALUES (2060, 20, 75, 1.85, 0.1);
+INSERT INTO t VALUES (2061, 20, 15, 1.86, 0.1);
+INSERT INTO t VALUES (2062, 20, 52, 1.87, 0.1);
+INSERT INTO t VALUES (2063, 20, 89, 1.88, 0.1);
+INSERT INTO t VALUES (2064, 20, 29, 1.89, 0.1);
+INSERT INTO t VALUES (2065, 20, 66, 1.90, 0.1);
+INSERT INTO t VALUES (2066, 20, 6, 1.91, 0.1);
+INSERT INTO t VALUES (2067, 20, 43, 1.92, 0.1);
+INSERT INTO t VALUES (2068, 20, 80, 1.93, 0.1);
+INSERT INTO t VALUES (2069, 20, 20, 1.94, 0.1);
+INSERT INTO t VALUES (2070, 20, 57, 1.95, 0.1);
+INSERT INTO t VALUES (2071, 20, 94, 1.96, 0.1);
+INSERT INTO t VALUES (2072, 20, 34, 1.97, 0.1);
+INSERT INTO t VALUES (2073, 20, 71, 1.98, 0.1);
+INSERT INTO t VALUES (2074, 20, 11, 1.99, 0.1);
+INSERT INTO t VALUES (2075, 20, 48, 2.00, 0.1);
+INSERT INTO t VALUES (2076, 20, 85, 2.01, 0.1);
+INSERT INTO t VALUES (2077, 20, 25, 2.02, 0.1);
+INSERT INTO t VALUES (2078, 20, 62, 2.03, 0.1);
+INSERT INTO t VALUES (2079, 20, 2, 2.04, 0.1);
+INSERT INTO t VALUES (2080, 20, 39, 2.05, 0.1);
+INSERT INTO t VALUES (2081, 20, 76, 2.06, 0.1);
+INSERT INTO t VALUES (2082, 20, 16, 2.07, 0.1);
+INSERT INTO t VALUES (2083, 20, 53, 2.08, 0.1);
+INSERT INTO t VALUES (2084, 20, 90, 2.09, 0.1);
+INSERT INTO t VALUES (2085, 20, 30, 2.10, 0.1);
+INSERT INTO t VALUES (2086, 20, 67, 2.11, 0.1);
+INSERT INTO t VALUES (2087, 20, 7, 2.12, 0.1);
+INSERT INTO t VALUES (2088, 20, 44, 2.13, 0.1);
+INSERT INTO t VALUES (2089, 20, 81, 2.14, 0.1);
+INSERT INTO t VALUES (2090, 20, 21, 2.15, 0.1);
+INSERT INTO t VALUES (2091, 20, 58, 2.16, 0.1);
+INSERT INTO t VALUES (2092, 20, 95, 2.17, 0.1);
+INSERT INTO t VALUES (2093, 20, 35, 2.18, 0.1);
+INSERT INTO t VALUES (2094, 20, 72, 2.19, 0.1);
+INSERT INTO t VALUES (2095, 20, 12, 2.20, 0.1);
+INSERT INTO t VALUES (2096, 20, 49, 2.21, 0.1);
+INSERT INTO t VALUES (2097, 20, 86, 2.22, 0.1);
+INSERT INTO t VALUES (2098, 20, 26, 2.23, 0.1);
+INSERT INTO t VALUES (2099, 20, 63, 2.24, 0.1);
+INSERT INTO t VALUES (2100, 21, 3, 2.25, 0.1);
+INSERT INTO t VALUES (2101, 21, 40, 2.26, 0.1);
+INSERT INTO t VALUES (2102, 21, 77, 2.27, 0.1);
+INSERT INTO t VALUES (2103, 21, 17, 2.28, 0.1);
+INSERT INTO t VALUES (2104, 21, 54, 2.29, 0.1);
+INSERT INTO t VALUES (2105, 21, 91, 2.30, 0.1);
+INSERT INTO t VALUES (2106, 21, 31, 2.31, 0.1);
+INSERT INTO t VALUES (2107, 21, 68, 2.32, 0.1);
+INSERT INTO t VALUES (2108, 21, 8, 2.33, 0.1);
+INSERT INTO t VALUES (2109, 21, 45, 2.34, 0.1);
+INSERT INTO t VALUES (2110, 21, 82, 2.35, 0.1);
+INSERT INTO t VALUES (2111, 21, 22, 2.36, 0.1);
+INSERT INTO t VALUES (2112, 21, 59, 2.37, 0.1);
+INSERT INTO t VALUES (2113, 21, 96, 2.38, 0.1);
+INSERT INTO t VALUES (2114, 21, 36, 2.39, 0.1);
+INSERT INTO t VALUES (2115, 21, 73, 2.40, 0.1);
+INSERT INTO t VALUES (2116, 21, 13, 2.41, 0.1);
+INSERT INTO t VALUES (2117, 21, 50, 2.42, 0.1);
+INSERT INTO t VALUES (2118, 21, 87, 2.43, 0.1);
+INSERT INTO t VALUES (2119, 21, 27, 2.44, 0.1);
+INSERT INTO t VALUES (2120, 21, 64, 2.45, 0.1);
+INSERT INTO t VALUES (2121, 21, 4, 2.46, 0.1);
+INSERT INTO t VALUES (2122, 21, 41, 2.47, 0.1);
+INSERT INTO t VALUES (2123, 21, 78, 2.48, 0.1);
+INSERT INTO t VALUES (2124, 21, 18, 2.49, 0.1);
+INSERT INTO t VALUES (2125, 21, 55, 2.50, 0.1);
+INSERT INTO t VALUES (2126, 21, 92, 2.51, 0.1);
+INSERT INTO t VALUES (2127, 21, 32, 2.52, 0.1);
+INSERT INTO t VALUES (2128, 21, 69, 2.53, 0.1);
+INSERT INTO t VALUES (2129, 21, 9, 2.54, 0.1);
+INSERT INTO t VALUES (2130, 21, 46, 2.55, 0.1);
+INSERT INTO t VALUES (2131, 21, 83, 2.56, 0.1);
+INSERT INTO t VALUES (2132, 21, 23, 2.57, 0.1);
+INSERT INTO t VALUES (2133, 21, 60, 2.58, 0.1);
+INSERT INTO t VALUES (2134, 21, 0, 2.59, 0.1);
+INSERT INTO t VALUES (2135, 21, 37, 2.60, 0.1);
+INSERT INTO t VALUES (2136, 21, 74, 2.61, 0.1);
+INSERT INTO t VALUES (2137, 21, 14, 2.62, 0.1);
+INSERT INTO t VALUES (2138, 21, 51, 2.63, 0.1);
+INSERT INTO t VALUES (2139, 21, 88, 2.64, 0.1);
+INSERT INTO t VALUES (2140, 21, 28, 2.65, 0.1);
+INSERT INTO t VALUES (2141, 21, 65, 2.66, 0.1);
+INSERT INTO t VALUES (2142, 21, 5, 2.67, 0.1);
+INSERT INTO t VALUES (2143, 21, 42, 2.68, 0.1);
+INSERT INTO t VALUES (2144, 21, 79, 2.69, 0.1);
+INSERT INTO t VALUES (2145, 21, 19, 2.70, 0.1);
+INSERT INTO t VALUES (2146, 21, 56, 2.71, 0.1);
+INSERT INTO t VALUES (2147, 21, 93, 2.72, 0.1);
+INSERT INTO t VALUES (2148, 21, 33, 2.73, 0.1);
+INSERT INTO t VALUES (2149, 21, 70, 2.74, 0.1);
+INSERT INTO t VALUES (2150, 21, 10, 2.75, 0.1);
+INSERT INTO t VALUES (2151, 21, 47, 2.76, 0.1);
+INSERT INTO t VALUES (2152, 21, 84, 2.77, 0.1);
+INSERT INTO t VALUES (2153, 21, 24, 2.78, 0.1);
+INSERT INTO t VALUES (2154, 21, 61, 2.79, 0.1);
+INSERT INTO t VALUES (2155, 21, 1, 2.80, 0.1);
+INSERT INTO t VALUES (2156, 21, 38, 2.81, 0.1);
+INSERT INTO t VALUES (2157, 21, 75, 2.82, 0.1);
+INSERT INTO t VALUES (2158, 21, 15, 2.83, 0.1);
+INSERT INTO t VALUES (2159, 21, 52, 2.84, 0.1);
+INSERT INTO t VALUES (2160, 21, 89, 2.85, 0.1);
+INSERT INTO t VALUES (2161, 21, 29, 2.86, 0.1);
+INSERT INTO t VALUES (2162, 21, 66, 2.87, 0.1);
+INSERT INTO t VALUES (2163, 21, 6, 2.88, 0.1);
+INSERT INTO t VALUES (2164, 21, 43, 2.89, 0.1);
+INSERT INTO t VALUES (2165, 21, 80, 2.90, 0.1);
+INSERT INTO t VALUES (2166, 21, 20, 2.91, 0.1);
+INSERT INTO t VALUES (2167, 21, 57, 2.92, 0.1);
+INSERT INTO t VALUES (2168, 21, 94, 2.93, 0.1);
+INSERT INTO t VALUES (2169, 21, 34, 2.94, 0.1);
+INSERT INTO t VALUES (2170, 21, 71, 2.95, 0.1);
+INSERT INTO t VALUES (2171, 21, 11, 2.96, 0.1);
+INSERT INTO t VALUES (2172, 21, 48, 2.97, 0.1);
+INSERT INTO t VALUES (2173, 21, 85, 2.98, 0.1);
+INSERT INTO t VALUES (2174, 21, 25, 2.99, 0.1);
+INSERT INTO t VALUES (2175, 21, 62, 3.00, 0.1);
+INSERT INTO t VALUES (2176, 21, 2, 3.01, 0.1);
+INSERT INTO t VALUES (2177, 21, 39, 3.02, 0.1);
+INSERT INTO t VALUES (2178, 21, 76, 3.03, 0.1);
+INSERT INTO t VALUES (2179, 21, 16, 3.04, 0.1);
+INSERT INTO t VALUES (2180, 21, 53, 3.05, 0.1);
+INSERT INTO t VALUES (2181, 21, 90, 3.06, 0.1);
+INSERT INTO t VALUES (2182, 21, 30, 3.07, 0.1);
+INSERT INTO t VALUES (2183, 21, 67, 3.08, 0.1);
+INSERT INTO t VALUES (2184, 21, 7, 3.09, 0.1);
+INSERT INTO t VALUES (2185, 21, 44, 3.10, 0.1);
+INSERT INTO t VALUES (2186, 21, 81, 3.11, 0.1);
+INSERT INTO t VALUES (2187, 21, 21, 3.12, 0.1);
+INSERT INTO t VALUES (2188, 21, 58, 3.13, 0.1);
+INSERT INTO t VALUES (2189, 21, 95, 3.14, 0.1);
+INSERT INTO t VALUES (2190, 21, 35, 3.15, 0.1);
+INSERT INTO t VALUES (2191, 21, 72, 3.16, 0.1);
+INSERT INTO t VALUES (2192, 21, 12, 3.17, 0.1);
+INSERT INTO t VALUES (2193, 21, 49, 3.18, 0.1);
+INSERT INTO t VALUES (2194, 21, 86, 3.19, 0.1);
+INSERT INTO t VALUES (2195, 21, 26, 3.20, 0.1);
+INSERT INTO t VALUES (2196, 21, 63, 3.21, 0.1);
+INSERT INTO t VALUES (2197, 21, 3, 3.22, 0.1);
+INSERT INTO t VALUES (2198, 21, 40, 3.23, 0.1);
+INSERT INTO t VALUES (2199, 21, 77, 3.24, 0.1);
+INSERT INTO t VALUES (2200, 22, 17, 3.25, 0.1);
+INSERT INTO t VALUES (2201, 22, 54, 3.26, 0.1);
+INSERT INTO t VALUES (2202, 22, 91, 3.27, 0.1);
+INSERT INTO t VALUES (2203, 22, 31, 3.28, 0.1);
+INSERT INTO t VALUES (2204, 22, 68, 3.29, 0.1);
+INSERT INTO t VALUES (2205, 22, 8, 3.30, 0.1);
+INSERT INTO t VALUES (2206, 22, 45, 3.31, 0.1);
+INSERT INTO t VALUES (2207, 22, 82, 3.32, 0.1);
+INSERT INTO t VALUES (2208, 22, 22, 3.33, 0.1);
+INSERT INTO t VALUES (2209, 22, 59, 3.34, 0.1);
+INSERT INTO t VALUES (2210, 22, 96, 3.35, 0.1);
+INSERT INTO t VALUES (2211, 22, 36, 3.36, 0.1);
+INSERT INTO t VALUES (2212, 22, 73, 3.37, 0.1);
+INSERT INTO t VALUES (2213, 22, 13, 3.38, 0.1);
+INSERT INTO t VALUES (2214, 22, 50, 3.39, 0.1);
+INSERT INTO t VALUES (2215, 22, 87, 3.40, 0.1);
+INSERT INTO t VALUES (2216, 22, 27, 3.41, 0.1);
+INSERT INTO t VALUES (2217, 22, 64, 3.42, 0.1);
+INSERT INTO t VALUES (2218, 22, 4, 3.43, 0.1);
+INSERT INTO t VALUES (2219, 22, 41, 3.44, 0.1);
+INSERT INTO t VALUES (2220, 22, 78, 3.45, 0.1);
+INSERT INTO t VALUES (2221, 22, 18, 3.46, 0.1);
+INSERT INTO t VALUES (2222, 22, 55, 3.47, 0.1);
+INSERT INTO t VALUES (2223, 22, 92, 3.48, 0.1);
+INSERT INTO t VALUES (2224, 22, 32, 3.49, 0.1);
+INSERT INTO t VALUES (2225, 22, 69, 3.50, 0.1);
+INSERT INTO t VALUES (2226, 22, 9, 3.51, 0.1);
+INSERT INTO t VALUES (2227, 22, 46, 3.52, 0.1);
+INSERT INTO t VALUES (2228, 22, 83, 3.53, 0.1);
+INSERT INTO t VALUES (2229, 22, 23, 3.54, 0.1);
+INSERT INTO t VALUES (2230, 22, 60, 3.55, 0.1);
+INSERT INTO t VALUES (2231, 22, 0, 3.56, 0.1);
+INSERT INTO t VALUES (2232, 22, 37, 3.57, 0.1);
+INSERT INTO t VALUES (2233, 22, 74, 3.58, 0.1);
+INSERT INTO t VALUES (2234, 22, 14, 3.59, 0.1);
+INSERT INTO t VALUES (2235, 22, 51, 3.60, 0.1);
+INSERT INTO t VALUES (2236, 22, 88, 3.61, 0.1);
+INSERT INTO t VALUES (2237, 22, 28, 3.62, 0.1);
+INSERT INTO t VALUES (2238, 22, 65, 3.63, 0.1);
+INSERT INTO t VALUES (2239, 22, 5, 3.64, 0.1);
+INSERT INTO t VALUES (2240, 22, 42, 3.65, 0.1);
+INSERT INTO t VALUES (2241, 22, 79, 3.66, 0.1);
+INSERT INTO t VALUES (2242, 22, 19, 3.67, 0.1);
+INSERT INTO t VALUES (2243, 22, 56, 3.68, 0.1);
+INSERT INTO t VALUES (2244, 22, 93, 3.69, 0.1);
+INSERT INTO t VALUES (2245, 22, 33, 3.70, 0.1);
+INSERT INTO t VALUES (2246, 22, 70, 3.71, 0.1);
+INSERT INTO t VALUES (2247, 22, 10, 3.72, 0.1);
+INSERT INTO t VALUES (2248, 22, 47, 3.73, 0.1);
+INSERT INTO t VALUES (2249, 22, 84, 3.74, 0.1);
+INSERT INTO t VALUES (2250, 22, 24, 3.75, 0.1);
+INSERT INTO t VALUES (2251, 22, 61, 3.76, 0.1);
+INSERT INTO t VALUES (2252, 22, 1, 3.77, 0.1);
+INSERT INTO t VALUES (2253, 22, 38, 3.78, 0.1);
+INSERT INTO t VALUES (2254, 22, 75, 3.79, 0.1);
+INSERT INTO t VALUES (2255, 22, 15, 3.80, 0.1);
+INSERT INTO t VALUES (2256, 22, 52, 3.81, 0.1);
+INSERT INTO t VALUES (2257, 22, 89, 3.82, 0.1);
+INSERT INTO t VALUES (2258, 22, 29, 3.83, 0.1);
+INSERT INTO t VALUES (2259, 22, 66, 3.84, 0.1);
+INSERT INTO t VALUES (2260, 22, 6, 3.85, 0.1);
+INSERT INTO t VALUES (2261, 22, 43, 3.86, 0.1);
+INSERT INTO t VALUES (2262, 22, 80, 3.87, 0.1);
+INSERT INTO t VALUES (2263, 22, 20, 3.88, 0.1);
+INSERT INTO t VALUES (2264, 22, 57, 3.89, 0.1);
+INSERT INTO t VALUES (2265, 22, 94, 3.90, 0.1);
+INSERT INTO t VALUES (2266, 22, 34, 3.91, 0.1);
+INSERT INTO t VALUES (2267, 22, 71, 3.92, 0.1);
+INSERT INTO t VALUES (2268, 22, 11, 3.93, 0.1);
+INSERT INTO t VALUES (2269, 22, 48, 3.94, 0.1);
+INSERT INTO t VALUES (2270, 22, 85, 3.95, 0.1);
+INSERT INTO t VALUES (2271, 22, 25, 3.96, 0.1);
+INSERT INTO t VALUES (2272, 22, 62, 3.97, 0.1);
+INSERT INTO t VALUES (2273, 22, 2, 3.98, 0.1);
+INSERT INTO t VALUES (2274, 22, 39, 3.99, 0.1);
+INSERT INTO t VALUES (2275, 22, 76, 4.00, 0.1);
+INSERT INTO t VALUES (2276, 22, 16, 4.01, 0.1);
+INSERT INTO t VALUES (2277, 22, 53, 4.02, 0.1);
+INSERT INTO t VALUES (2278, 22, 90, 4.03, 0.1);
+INSERT INTO t VALUES (2279, 22, 30, 4.04, 0.1);
+INSERT INTO t VALUES (2280, 22, 67, 4.05, 0.1);
+INSERT INTO t VALUES (2281, 22, 7, 4.06, 0.1);
+INSERT INTO t VALUES (2282, 22, 44, 4.07, 0.1);
+INSERT INTO t VALUES (2283, 22, 81, 4.08, 0.1);
+INSERT INTO t VALUES (2284, 22, 21, 4.09, 0.1);
+INSERT INTO t VALUES (2285, 22, 58, 4.10, 0.1);
+INSERT INTO t VALUES (2286, 22, 95, 4.11, 0.1);
+INSERT INTO t VALUES (2287, 22, 35, 4.12, 0.1);
+INSERT INTO t VALUES (2288, 22, 72, 4.13, 0.1);
+INSERT INTO t VALUES (2289, 22, 12, 4.14, 0.1);
+INSERT INTO t VALUES (2290, 22, 49, 4.15, 0.1);
+INSERT INTO t VALUES (2291, 22, 86, 4.16, 0.1);
+INSERT INTO t VALUES (2292, 22, 26, 4.17, 0.1);
+INSERT INTO t VALUES (2293, 22, 63, 4.18, 0.1);
+INSERT INTO t VALUES (2294, 22, 3, 4.19, 0.1);
+INSERT INTO t VALUES (2295, 22, 40, 4.20, 0.1);
+INSERT INTO t VALUES (2296, 22, 77, 4.21, 0.1);
+INSERT INTO t VALUES (2297, 22, 17, 4.22, 0.1);
+INSERT INTO t VALUES (2298, 22, 54, 4.23, 0.1);
+INSERT INTO t VALUES (2299, 22, 91, 4.24, 0.1);
+INSERT INTO t VALUES (2300, 23, 31, 4.25, 0.1);
+INSERT INTO t VALUES (2301, 23, 68, 4.26, 0.1);
+INSERT INTO t VALUES (2302, 23, 8, 4.27, 0.1);
+INSERT INTO t VALUES (2303, 23, 45, 4.28, 0.1);
+INSERT INTO t VALUES (2304, 23, 82, 4.29, 0.1);
+INSERT INTO t VALUES (2305, 23, 22, 4.30, 0.1);
+INSERT INTO t VALUES (2306, 23, 59, 4.31, 0.1);
+INSERT INTO t VALUES (2307, 23, 96, 4.32, 0.1);
+INSERT INTO t VALUES (2308, 23, 36, 4.33, 0.1);
+INSERT INTO t VALUES (2309, 23, 73, 4.34, 0.1);
+INSERT INTO t VALUES (2310, 23, 13, 4.35, 0.1);
+INSERT INTO t VALUES (2311, 23, 50, 4.36, 0.1);
+INSERT INTO t VALUES (2312, 23, 87, 4.37, 0.1);
+INSERT INTO t VALUES (2313, 23, 27, 4.38, 0.1);
+INSERT INTO t VALUES (2314, 23, 64, 4.39, 0.1);
+INSERT INTO t VALUES (2315, 23, 4, 4.40, 0.1);
+INSERT INTO t VALUES (2316, 23, 41, 4.41, 0.1);
+INSERT INTO t VALUES (2317, 23, 78, 4.42, 0.1);
+INSERT INTO t VALUES (2318, 23, 18, 4.43, 0.1);
+INSERT INTO t VALUES (2319, 23, 55, 4.44, 0.1);
+INSERT INTO t VALUES (2320, 23, 92, 4.45, 0.1);
+INSERT INTO t VALUES (2321, 23, 32, 4.46, 0.1);
+INSERT INTO t VALUES (2322, 23, 69, 4.47, 0.1);
+INSERT INTO t VALUES (2323, 23, 9, 4.48, 0.1);
+INSERT INTO t VALUES (2324, 23, 46, 4.49, 0.1);
+INSERT INTO t VALUES (2325, 23, 83, 4.50, 0.1);
+INSERT INTO t VALUES (2326, 23, 23, 4.51, 0.1);
+INSERT INTO t VALUES (2327, 23, 60, 4.52, 0.1);
+INSERT INTO t VALUES (2328, 23, 0, 4.53, 0.1);
+INSERT INTO t VALUES (2329, 23, 37, 4.54, 0.1);
+INSERT INTO t VALUES (2330, 23, 74, 4.55, 0.1);
+INSERT INTO t VALUES (2331, 23, 14, 4.56, 0.1);
+INSERT INTO t VALUES (2332, 23, 51, 4.57, 0.1);
+INSERT INTO t VALUES (2333, 23, 88, 4.58, 0.1);
+INSERT INTO t VALUES (2334, 23, 28, 4.59, 0.1);
+INSERT INTO t VALUES (2335, 23, 65, 4.60, 0.1);
+INSERT INTO t VALUES (2336, 23, 5, 4.61, 0.1);
+INSERT INTO t VALUES (2337, 23, 42, 4.62, 0.1);
+INSERT INTO t VALUES (2338, 23, 79, 4.63, 0.1);
+INSERT INTO t VALUES (2339, 23, 19, 4.64, 0.1);
+INSERT INTO t VALUES (2340, 23, 56, 4.65, 0.1);
+INSERT INTO t VALUES (2341, 23, 93, 4.66, 0.1);
+INSERT INTO t VALUES (2342, 23, 33, 4.67, 0.1);
+INSERT INTO t VALUES (2343, 23, 70, 4.68, 0.1);
+INSERT INTO t VALUES (2344, 23, 10, 4.69, 0.1);
+INSERT INTO t VALUES (2345, 23, 47, 4.70, 0.1);
+INSERT INTO t VALUES (2346, 23, 84, 4.71, 0.1);
+INSERT INTO t VALUES (2347, 23, 24, 4.72, 0.1);
+INSERT INTO t VALUES (2348, 23, 61, 4.73, 0.1);
+INSERT INTO t VALUES (2349, 23, 1, 4.74, 0.1);
+INSERT INTO t VALUES (2350, 23, 38, 4.75, 0.1);
+INSERT INTO t VALUES (2351, 23, 75, 4.76, 0.1);
+INSERT INTO t VALUES (2352, 23, 15, 4.77, 0.1);
+INSERT INTO t VALUES (2353, 23, 52, 4.78, 0.1);
+INSERT INTO t VALUES (2354, 23, 89, 4.79, 0.1);
+INSERT INTO t VALUES (2355, 23, 29, 4.80, 0.1);
+INSERT INTO t VALUES (2356, 23, 66, 4.81, 0.1);
+INSERT INTO t VALUES (2357, 23, 6, 4.82, 0.1);
+INSERT INTO t VALUES (2358, 23, 43, 4.83, 0.1);
+INSERT INTO t VALUES (2359, 23, 80, 4.84, 0.1);
+INSERT INTO t VALUES (2360, 23, 20, 4.85, 0.1);
+INSERT INTO t VALUES (2361, 23, 57, 4.86, 0.1);
+INSERT INTO t VALUES (2362, 23, 94, 4.87, 0.1);
+INSERT INTO t VALUES (2363, 23, 34, 4.88, 0.1);
+INSERT INTO t VALUES (2364, 23, 71, 4.89, 0.1);
+INSERT INTO t VALUES (2365, 23, 11, 4.90, 0.1);
+INSERT INTO t VALUES (2366, 23, 48, 4.91, 0.1);
+INSERT INTO t VALUES (2367, 23, 85, 4.92, 0.1);
+INSERT INTO t VALUES (2368, 23, 25, 4.93, 0.1);
+INSERT INTO t VALUES (2369, 23, 62, 4.94, 0.1);
+INSERT INTO t VALUES (2370, 23, 2, 4.95, 0.1);
+INSERT INTO t VALUES (2371, 23, 39, 4.96, 0.1);
+INSERT INTO t VALUES (2372, 23, 76, 4.97, 0.1);
+INSERT INTO t VALUES (2373, 23, 16, 4.98, 0.1);
+INSERT INTO t VALUES (2374, 23, 53, 4.99, 0.1);
+INSERT INTO t VALUES (2375, 23, 90, 5.00, 0.1);
+INSERT INTO t VALUES (2376, 23, 30, 5.01, 0.1);
+INSERT INTO t VALUES (2377, 23, 67, 5.02, 0.1);
+INSERT INTO t VALUES (2378, 23, 7, 5.03, 0.1);
+INSERT INTO t VALUES (2379, 23, 44, 5.04, 0.1);
+INSERT INTO t VALUES (2380, 23, 81, 5.05, 0.1);
+INSERT INTO t VALUES (2381, 23, 21, 5.06, 0.1);
+INSERT INTO t VALUES (2382, 23, 58, 5.07, 0.1);
+INSERT INTO t VALUES (2383, 23, 95, 5.08, 0.1);
+INSERT INTO t VALUES (2384, 23, 35, 5.09, 0.1);
+INSERT INTO t VALUES (2385, 23, 72, 5.10, 0.1);
+INSERT INTO t VALUES (2386, 23, 12, 5.11, 0.1);
+INSERT INTO t VALUES (2387, 23, 49, 5.12, 0.1);
+INSERT INTO t VALUES (2388, 23, 86, 5.13, 0.1);
+INSERT INTO t VALUES (2389, 23, 26, 5.14, 0.1);
+INSERT INTO t VALUES (2390, 23, 63, 5.15, 0.1);
+INSERT INTO t VALUES (2391, 23, 3, 5.16, 0.1);
+INSERT INTO t VALUES (2392, 23, 40, 5.17, 0.1);
+INSERT INTO t VALUES (2393, 23, 77, 5.18, 0.1);
+INSERT INTO t VALUES (2394, 23, 17, 5.19, 0.1);
+INSERT INTO t VALUES (2395, 23, 54, 5.20, 0.1);
+INSERT INTO t VALUES (2396, 23, 91, 5.21, 0.1);
+INSERT INTO t VALUES (2397, 23, 31, 5.22, 0.1);
+INSERT INTO t VALUES (2398, 23, 68, 5.23, 0.1);
+INSERT INTO t VALUES (2399, 23, 8, 5.24, 0.1);
+INSERT INTO t VALUES (2400, 24, 45, 5.25, 0.1);
+INSERT INTO t VALUES (2401, 24, 82, 5.26, 0.1);
+INSERT INTO t VALUES (2402, 24, 22, 5.27, 0.1);
+INSERT INTO t VALUES (2403, 24, 59, 5.28, 0.1);
+INSERT INTO t VALUES (2404, 24, 96, 5.29, 0.1);
+INSERT INTO t VALUES (2405, 24, 36, 5.30, 0.1);
+INSERT INTO t VALUES (2406, 24, 73, 5.31, 0.1);
+INSERT INTO t VALUES (2407, 24, 13, 5.32, 0.1);
+INSERT INTO t VALUES (2408, 24, 50, 5.33, 0.1);
+INSERT INTO t VALUES (2409, 24, 87, 5.34, 0.1);
+INSERT INTO t VALUES (2410, 24, 27, 5.35, 0.1);
+INSERT INTO t VALUES (2411, 24, 64, 5.36, 0.1);
+INSERT INTO t VALUES (2412, 24, 4, 5.37, 0.1);
+INSERT INTO t VALUES (2413, 24, 41, 5.38, 0.1);
+INSERT INTO t VALUES (2414, 24, 78, 5.39, 0.1);
+INSERT INTO t VALUES (2415, 24, 18, 5.40, 0.1);
+INSERT INTO t VALUES (2416, 24, 55, 5.41, 0.1);
+INSERT INTO t VALUES (2417, 24, 92, 5.42, 0.1);
+INSERT INTO t VALUES (2418, 24, 32, 5.43, 0.1);
+INSERT INTO t VALUES (2419, 24, 69, 5.44, 0.1);
+INSERT INTO t VALUES (2420, 24, 9, 5.45, 0.1);
+INSERT INTO t VALUES (2421, 24, 46, 5.46, 0.1);
+INSERT INTO t VALUES (2422, 24, 83, 5.47, 0.1);
+INSERT INTO t VALUES (2423, 24, 23, 5.48, 0.1);
+INSERT INTO t VALUES (2424, 24, 60, 5.49, 0.1);
+INSERT INTO t VALUES (2425, 24, 0, 5.50, 0.1);
+INSERT INTO t VALUES (2426, 24, 37, 5.51, 0.1);
+INSERT INTO t VALUES (2427, 24, 74, 5.52, 0.1);
+INSERT INTO t VALUES (2428, 24, 14, 5.53, 0.1);
+INSERT INTO t VALUES (2429, 24, 51, 5.54, 0.1);
+INSERT INTO t VALUES (2430, 24, 88, 5.55, 0.1);
+INSERT INTO t VALUES (2431, 24, 28, 5.56, 0.1);
+INSERT INTO t VALUES (2432, 24, 65, 5.57, 0.1);
+INSERT INTO t VALUES (2433, 24, 5, 5.58, 0.1);
+INSERT INTO t VALUES (2434, 24, 42, 5.59, 0.1);
+INSERT INTO t VALUES (2435, 24, 79, 5.60, 0.1);
+INSERT INTO t VALUES (2436, 24, 19, 5.61, 0.1);
+INSERT INTO t VALUES (2437, 24, 56, 5.62, 0.1);
+INSERT INTO t VALUES (2438, 24, 93, 5.63, 0.1);
+INSERT INTO t VALUES (2439, 24, 33, 5.64, 0.1);
+INSERT INTO t VALUES (2440, 24, 70, 5.65, 0.1);
+INSERT INTO t VALUES (2441, 24, 10, 5.66, 0.1);
+INSERT INTO t VALUES (2442, 24, 47, 5.67, 0.1);
+INSERT INTO t VALUES (2443, 24, 84, 5.68, 0.1);
+INSERT INTO t VALUES (2444, 24, 24, 5.69, 0.1);
+INSERT INTO t VALUES (2445, 24, 61, 5.70, 0.1);
+INSERT INTO t VALUES (2446, 24, 1, 5.71, 0.1);
+INSERT INTO t VALUES (2447, 24, 38, 5.72, 0.1);
+INSERT INTO t VALUES (2448, 24, 75, 5.73, 0.1);
+INSERT INTO t VALUES (2449, 24, 15, 5.74, 0.1);
+INSERT INTO t VALUES (2450, 24, 52, 5.75, 0.1);
+INSERT INTO t VALUES (2451, 24, 89, 5.76, 0.1);
+INSERT INTO t VALUES (2452, 24, 29, 5.77, 0.1);
+INSERT INTO t VALUES (2453, 24, 66, 5.78, 0.1);
+INSERT INTO t VALUES (2454, 24, 6, 5.79, 0.1);
+INSERT INTO t VALUES (2455, 24, 43, 5.80, 0.1);
+INSERT INTO t VALUES (2456, 24, 80, 5.81, 0.1);
+INSERT INTO t VALUES (2457, 24, 20, 5.82, 0.1);
+INSERT INTO t VALUES (2458, 24, 57, 5.83, 0.1);
+INSERT INTO t VALUES (2459, 24, 94, 5.84, 0.1);
+INSERT INTO t VALUES (2460, 24, 34, 5.85, 0.1);
+INSERT INTO t VALUES (2461, 24, 71, 5.86, 0.1);
+INSERT INTO t VALUES (2462, 24, 11, 5.87, 0.1);
+INSERT INTO t VALUES (2463, 24, 48, 5.88, 0.1);
+INSERT INTO t VALUES (2464, 24, 85, 5.89, 0.1);
+INSERT INTO t VALUES (2465, 24, 25, 5.90, 0.1);
+INSERT INTO t VALUES (2466, 24, 62, 5.91, 0.1);
+INSERT INTO t VALUES (2467, 24, 2, 5.92, 0.1);
+INSERT INTO t VALUES (2468, 24, 39, 5.93, 0.1);
+INSERT INTO t VALUES (2469, 24, 76, 5.94, 0.1);
+INSERT INTO t VALUES (2470, 24, 16, 5.95, 0.1);
+INSERT INTO t VALUES (2471, 24, 53, 5.96, 0.1);
+INSERT INTO t VALUES (2472, 24, 90, 5.97, 0.1);
+INSERT INTO t VALUES (2473, 24, 30, 5.98, 0.1);
+INSERT INTO t VALUES (2474, 24, 67, 5.99, 0.1);
+INSERT INTO t VALUES (2475, 24, 7, 6.00, 0.1);
+INSERT INTO t VALUES (2476, 24, 44, 6.01, 0.1);
+INSERT INTO t VALUES (2477, 24, 81, 6.02, 0.1);
+INSERT INTO t VALUES (2478, 24, 21, 6.03, 0.1);
+INSERT INTO t VALUES (2479, 24, 58, 6.04, 0.1);
+INSERT INTO t VALUES (2480, 24, 95, 6.05, 0.1);
+INSERT INTO t VALUES (2481, 24, 35, 6.06, 0.1);
+INSERT INTO t VALUES (2482, 24, 72, 6.07, 0.1);
+INSERT INTO t VALUES (2483, 24, 12, 6.08, 0.1);
+INSERT INTO t VALUES (2484, 24, 49, 6.09, 0.1);
+INSERT INTO t VALUES (2485, 24, 86, 6.10, 0.1);
+INSERT INTO t VALUES (2486, 24, 26, 6.11, 0.1);
+INSERT INTO t VALUES (2487, 24, 63, 6.12, 0.1);
+INSERT INTO t VALUES (2488, 24, 3, 6.13, 0.1);
+INSERT INTO t VALUES (2489, 24, 40, 6.14, 0.1);
+INSERT INTO t VALUES (2490, 24, 77, 6.15, 0.1);
+INSERT INTO t VALUES (2491, 24, 17, 6.16, 0.1);
+INSERT INTO t VALUES (2492, 24, 54, 6.17, 0.1);
+INSERT INTO t VALUES (2493, 24, 91, 6.18, 0.1);
+INSERT INTO t VALUES (2494, 24, 31, 6.19, 0.1);
+INSERT INTO t VALUES (2495, 24, 68, 6.20, 0.1);
+INSERT INTO t VALUES (2496, 24, 8, 6.21, 0.1);
+INSERT INTO t VALUES (2497, 24, 45, 6.22, 0.1);
+INSERT INTO t VALUES (2498, 24, 82, 6.23, 0.1);
+INSERT INTO t VALUES (2499, 24, 22, 6.24, 0.1);
+INSERT INTO t VALUES (2500, 25, 59, 6.25, 0.1);
+INSERT INTO t VALUES (2501, 25, 96, 6.26, 0.1);
+INSERT INTO t VALUES (2502, 25, 36, 6.27, 0.1);
+INSERT INTO t VALUES (2503, 25, 73, 6.28, 0.1);
+INSERT INTO t VALUES (2504, 25, 13, 6.29, 0.1);
+INSERT INTO t VALUES (2505, 25, 50, 6.30, 0.1);
+INSERT INTO t VALUES (2506, 25, 87, 6.31, 0.1);
+INSERT INTO t VALUES (2507, 25, 27, 6.32, 0.1);
+INSERT INTO t VALUES (2508, 25, 64, 6.33, 0.1);
+INSERT INTO t VALUES (2509, 25, 4, 6.34, 0.1);
+INSERT INTO t VALUES (2510, 25, 41, 6.35, 0.1);
+INSERT INTO t VALUES (2511, 25, 78, 6.36, 0.1);
+INSERT INTO t VALUES (2512, 25, 18, 6.37, 0.1);
+INSERT INTO t VALUES (2513, 25, 55, 6.38, 0.1);
+INSERT INTO t VALUES (2514, 25, 92, 6.39, 0.1);
+INSERT INTO t VALUES (2515, 25, 32, 6.40, 0.1);
+INSERT INTO t VALUES (2516, 25, 69, 6.41, 0.1);
+INSERT INTO t VALUES (2517, 25, 9, 6.42, 0.1);
+INSERT INTO t VALUES (2518, 25, 46, 6.43, 0.1);
+INSERT INTO t VALUES (2519, 25, 83, 6.44, 0.1);
+INSERT INTO t VALUES (2520, 25, 23, 6.45, 0.1);
+INSERT INTO t VALUES (2521, 25, 60, 6.46, 0.1);
+INSERT INTO t VALUES (2522, 25, 0, 6.47, 0.1);
+INSERT INTO t VALUES (2523, 25, 37, 6.48, 0.1);
+INSERT INTO t VALUES (2524, 25, 74, 6.49, 0.1);
+INSERT INTO t VALUES (2525, 25, 14, 6.50, 0.1);
+INSERT INTO t VALUES (2526, 25, 51, 6.51, 0.1);
+INSERT INTO t VALUES (2527, 25, 88, 6.52, 0.1);
+INSERT INTO t VALUES (2528, 25, 28, 6.53, 0.1);
+INSERT INTO t VALUES (2529, 25, 65, 6.54, 0.1);
+INSERT INTO t VALUES (2530, 25, 5, 6.55, 0.1);
+INSERT INTO t VALUES (2531, 25, 42, 6.56, 0.1);
+INSERT INTO t VALUES (2532, 25, 79, 6.57, 0.1);
+INSERT INTO t VALUES (2533, 25, 19, 6.58, 0.1);
+INSERT INTO t VALUES (2534, 25, 56, 6.59, 0.1);
+INSERT INTO t VALUES (2535, 25, 93, 6.60, 0.1);
+INSERT INTO t VALUES (2536, 25, 33, 6.61, 0.1);
+INSERT INTO t VALUES (2537, 25, 70, 6.62, 0.1);
+INSERT INTO t VALUES (2538, 25, 10, 6.63, 0.1);
+INSERT INTO t VALUES (2539, 25, 47, 6.64, 0.1);
+INSERT INTO t VALUES (2540, 25, 84, 6.65, 0.1);
+INSERT INTO t VALUES (2541, 25, 24, 6.66, 0.1);
+INSERT INTO t VALUES (2542, 25, 61, 6.67, 0.1);
+INSERT INTO t VALUES (2543, 25, 1, 6.68, 0.1);
+INSERT INTO t VALUES (2544, 25, 38, 6.69, 0.1);
+INSERT INTO t VALUES (2545, 25, 75, 6.70, 0.1);
+INSERT INTO t VALUES (2546, 25, 15, 6.71, 0.1);
+INSERT INTO t VALUES (2547, 25, 52, 6.72, 0.1);
+INSERT INTO t VALUES (2548, 25, 89, 6.73, 0.1);
+INSERT INTO t VALUES (2549, 25, 29, 6.74, 0.1);
+INSERT INTO t VALUES (2550, 25, 66, 6.75, 0.1);
+INSERT INTO t VALUES (2551, 25, 6, 6.76, 0.1);
+INSERT INTO t VALUES (2552, 25, 43, 6.77, 0.1);
+INSERT INTO t VALUES (2553, 25, 80, 6.78, 0.1);
+INSERT INTO t VALUES (2554, 25, 20, 6.79, 0.1);
+INSERT INTO t VALUES (2555, 25, 57, 6.80, 0.1);
+INSERT INTO t VALUES (2556, 25, 94, 6.81, 0.1);
+INSERT INTO t VALUES (2557, 25, 34, 6.82, 0.1);
+INSERT INTO t VALUES (2558, 25, 71, 6.83, 0.1);
+INSERT INTO t VALUES (2559, 25, 11, 6.84, 0.1);
+INSERT INTO t VALUES (2560, 25, 48, 6.85, 0.1);
+INSERT INTO t VALUES (2561, 25, 85, 6.86, 0.1);
+INSERT INTO t VALUES (2562, 25, 25, 6.87, 0.1);
+INSERT INTO t VALUES (2563, 25, 62, 6.88, 0.1);
+INSERT INTO t VALUES (2564, 25, 2, 6.89, 0.1);
+INSERT INTO t VALUES (2565, 25, 39, 6.90, 0.1);
+INSERT INTO t VALUES (2566, 25, 76, 6.91, 0.1);
+INSERT INTO t VALUES (2567, 25, 16, 6.92, 0.1);
+INSERT INTO t VALUES (2568, 25, 53, 6.93, 0.1);
+INSERT INTO t VALUES (2569, 25, 90, 6.94, 0.1);
+INSERT INTO t VALUES (2570, 25, 30, 6.95, 0.1);
+INSERT INTO t VALUES (2571, 25, 67, 6.96, 0.1);
+INSERT INTO t VALUES (2572, 25, 7, 6.97, 0.1);
+INSERT INTO t VALUES (2573, 25, 44, 6.98, 0.1);
+INSERT INTO t VALUES (2574, 25, 81, 6.99, 0.1);
+INSERT INTO t VALUES (2575, 25, 21, 7.00, 0.1);
+INSERT INTO t VALUES (2576, 25, 58, 7.01, 0.1);
+INSERT INTO t VALUES (2577, 25, 95, 7.02, 0.1);
+INSERT INTO t VALUES (2578, 25, 35, 7.03, 0.1);
+INSERT INTO t VALUES (2579, 25, 72, 7.04, 0.1);
+INSERT INTO t VALUES (2580, 25, 12, 7.05, 0.1);
+INSERT INTO t VALUES (2581, 25, 49, 7.06, 0.1);
+INSERT INTO t VALUES (2582, 25, 86, 7.07, 0.1);
+INSERT INTO t VALUES (2583, 25, 26, 7.08, 0.1);
+INSERT INTO t VALUES (2584, 25, 63, 7.09, 0.1);
+INSERT INTO t VALUES (2585, 25, 3, 7.10, 0.1);
+INSERT INTO t VALUES (2586, 25, 40, 7.11, 0.1);
+INSERT INTO t VALUES (2587, 25, 77, 7.12, 0.1);
+INSERT INTO t VALUES (2588, 25, 17, 7.13, 0.1);
+INSERT INTO t VALUES (2589, 25, 54, 7.14, 0.1);
+INSERT INTO t VALUES (2590, 25, 91, 7.15, 0.1);
+INSERT INTO t VALUES (2591, 25, 31, 7.16, 0.1);
+INSERT INTO t VALUES (2592, 25, 68, 7.17, 0.1);
+INSERT INTO t VALUES (2593, 25, 8, 7.18, 0.1);
+INSERT INTO t VALUES (2594, 25, 45, 7.19, 0.1);
+INSERT INTO t VALUES (2595, 25, 82, 7.20, 0.1);
+INSERT INTO t VALUES (2596, 25, 22, 7.21, 0.1);
+INSERT INTO t VALUES (2597, 25, 59, 7.22, 0.1);
+INSERT INTO t VALUES (2598, 25, 96, 7.23, 0.1);
+INSERT INTO t VALUES (2599, 25, 36, 7.24, 0.1);
+INSERT INTO t VALUES (2600, 26, 73, 7.25, 0.1);
+INSERT INTO t VALUES (2601, 26, 13, 7.26, 0.1);
+INSERT INTO t VALUES (2602, 26, 50, 7.27, 0.1);
+INSERT INTO t VALUES (2603, 26, 87, 7.28, 0.1);
+INSERT INTO t VALUES (2604, 26, 27, 7.29, 0.1);
+INSERT INTO t VALUES (2605, 26, 64, 7.30, 0.1);
+INSERT INTO t VALUES (2606, 26, 4, 7.31, 0.1);
+INSERT INTO t VALUES (2607, 26, 41, 7.32, 0.1);
+INSERT INTO t VALUES (2608, 26, 78, 7.33, 0.1);
+INSERT INTO t VALUES (2609, 26, 18, 7.34, 0.1);
+INSERT INTO t VALUES (2610, 26, 55, 7.35, 0.1);
+INSERT INTO t VALUES (2611, 26, 92, 7.36, 0.1);
+INSERT INTO t VALUES (2612, 26, 32, 7.37, 0.1);
+INSERT INTO t VALUES (2613, 26, 69, 7.38, 0.1);
+INSERT INTO t VALUES (2614, 26, 9, 7.39, 0.1);
+INSERT INTO t VALUES (2615, 26, 46, 7.40, 0.1);
+INSERT INTO t VALUES (2616, 26, 83, 7.41, 0.1);
+INSERT INTO t VALUES (2617, 26, 23, 7.42, 0.1);
+INSERT INTO t VALUES (2618, 26, 60, 7.43, 0.1);
+INSERT INTO t VALUES (2619, 26, 0, 7.44, 0.1);
+INSERT INTO t VALUES (2620, 26, 37, 7.45, 0.1);
+INSERT INTO t VALUES (2621, 26, 74, 7.46, 0.1);
+INSERT INTO t VALUES (2622, 26, 14, 7.47, 0.1);
+INSERT INTO t VALUES (2623, 26, 51, 7.48, 0.1);
+INSERT INTO t VALUES (2624, 26, 88, 7.49, 0.1);
+INSERT INTO t VALUES (2625, 26, 28, 7.50, 0.1);
+INSERT INTO t VALUES (2626, 26, 65, 7.51, 0.1);
+INSERT INTO t VALUES (2627, 26, 5, 7.52, 0.1);
+INSERT INTO t VALUES (2628, 26, 42, 7.53, 0.1);
+INSERT INTO t VALUES (2629, 26, 79, 7.54, 0.1);
+INSERT INTO t VALUES (2630, 26, 19, 7.55, 0.1);
+INSERT INTO t VALUES (2631, 26, 56, 7.56, 0.1);
+INSERT INTO t VALUES (2632, 26, 93, 7.57, 0.1);
+INSERT INTO t VALUES (2633, 26, 33, 7.58, 0.1);
+INSERT INTO t VALUES (2634, 26, 70, 7.59, 0.1);
+INSERT INTO t VALUES (2635, 26, 10, 7.60, 0.1);
+INSERT INTO t VALUES (2636, 26, 47, 7.61, 0.1);
+INSERT INTO t VALUES (2637, 26, 84, 7.62, 0.1);
+INSERT INTO t VALUES (2638, 26, 24, 7.63, 0.1);
+INSERT INTO t VALUES (2639, 26, 61, 7.64, 0.1);
+INSERT INTO t VALUES (2640, 26, 1, 7.65, 0.1);
+INSERT INTO t VALUES (2641, 26, 38, 7.66, 0.1);
+INSERT INTO t VALUES (2642, 26, 75, 7.67, 0.1);
+INSERT INTO t VALUES (2643, 26, 15, 7.68, 0.1);
+INSERT INTO t VALUES (2644, 26, 52, 7.69, 0.1);
+INSERT INTO t VALUES (2645, 26, 89, 7.70, 0.1);
+INSERT INTO t VALUES (2646, 26, 29, 7.71, 0.1);
+INSERT INTO t VALUES (2647, 26, 66, 7.72, 0.1);
+INSERT INTO t VALUES (2648, 26, 6, 7.73, 0.1);
+INSERT INTO t VALUES (2649, 26, 43, 7.74, 0.1);
+INSERT INTO t VALUES (2650, 26, 80, 7.75, 0.1);
+INSERT INTO t VALUES (2651, 26, 20, 7.76, 0.1);
+INSERT INTO t VALUES (2652, 26, 57, 7.77, 0.1);
+INSERT INTO t VALUES (2653, 26, 94, 7.78, 0.1);
+INSERT INTO t VALUES (2654, 26, 34, 7.79, 0.1);
+INSERT INTO t VALUES (2655, 26, 71, 7.80, 0.1);
+INSERT INTO t VALUES (2656, 26, 11, 7.81, 0.1);
+INSERT INTO t VALUES (2657, 26, 48, 7.82, 0.1);
+INSERT INTO t VALUES (2658, 26, 85, 7.83, 0.1);
+INSERT INTO t VALUES (2659, 26, 25, 7.84, 0.1);
+INSERT INTO t VALUES (2660, 26, 62, 7.85, 0.1);
+INSERT INTO t VALUES (2661, 26, 2, 7.86, 0.1);
+INSERT INTO t VALUES (2662, 26, 39, 7.87, 0.1);
+INSERT INTO t VALUES (2663, 26, 76, 7.88, 0.1);
+INSERT INTO t VALUES (2664, 26, 16, 7.89, 0.1);
+INSERT INTO t VALUES (2665, 26, 53, 7.90, 0.1);
+INSERT INTO t VALUES (2666, 26, 90, 7.91, 0.1);
+INSERT INTO t VALUES (2667, 26, 30, 7.92, 0.1);
+INSERT INTO t VALUES (2668, 26, 67, 7.93, 0.1);
+INSERT INTO t VALUES (2669, 26, 7, 7.94, 0.1);
+INSERT INTO t VALUES (2670, 26, 44, 7.95, 0.1);
+INSERT INTO t VALUES (2671, 26, 81, 7.96, 0.1);
+INSERT INTO t VALUES (2672, 26, 21, 7.97, 0.1);
+INSERT INTO t VALUES (2673, 26, 58, 7.98, 0.1);
+INSERT INTO t VALUES (2674, 26, 95, 7.99, 0.1);
+INSERT INTO t VALUES (2675, 26, 35, 8.00, 0.1);
+INSERT INTO t VALUES (2676, 26, 72, 8.01, 0.1);
+INSERT INTO t VALUES (2677, 26, 12, 8.02, 0.1);
+INSERT INTO t VALUES (2678, 26, 49, 8.03, 0.1);
+INSERT INTO t VALUES (2679, 26, 86, 8.04, 0.1);
+INSERT INTO t VALUES (2680, 26, 26, 8.05, 0.1);
+INSERT INTO t VALUES (2681, 26, 63, 8.06, 0.1);
+INSERT INTO t VALUES (2682, 26, 3, 8.07, 0.1);
+INSERT INTO t VALUES (2683, 26, 40, 8.08, 0.1);
+INSERT INTO t VALUES (2684, 26, 77, 8.09, 0.1);
+INSERT INTO t VALUES (2685, 26, 17, 8.10, 0.1);
+INSERT INTO t VALUES (2686, 26, 54, 8.11, 0.1);
+INSERT INTO t VALUES (2687, 26, 91, 8.12, 0.1);
+INSERT INTO t VALUES (2688, 26, 31, 8.13, 0.1);
+INSERT INTO t VALUES (2689, 26, 68, 8.14, 0.1);
+INSERT INTO t VALUES (2690, 26, 8, 8.15, 0.1);
+INSERT INTO t VALUES (2691, 26, 45, 8.16, 0.1);
+INSERT INTO t VALUES (2692, 26, 82, 8.17, 0.1);
+INSERT INTO t VALUES (2693, 26, 22, 8.18, 0.1);
+INSERT INTO t VALUES (2694, 26, 59, 8.19, 0.1);
+INSERT INTO t VALUES (2695, 26, 96, 8.20, 0.1);
+INSERT INTO t VALUES (2696, 26, 36, 8.21, 0.1);
+INSERT INTO t VALUES (2697, 26, 73, 8.22, 0.1);
+INSERT INTO t VALUES (2698, 26, 13, 8.23, 0.1);
+INSERT INTO t VALUES (2699, 26, 50, 8.24, 0.1);
+INSERT INTO t VALUES (2700, 27, 87, 8.25, 0.1);
+INSERT INTO t VALUES (2701, 27, 27, 8.26, 0.1);
+INSERT INTO t VALUES (2702, 27, 64, 8.27, 0.1);
+INSERT INTO t VALUES (2703, 27, 4, 8.28, 0.1);
+INSERT INTO t VALUES (2704, 27, 41, 8.29, 0.1);
+INSERT INTO t VALUES (2705, 27, 78, 8.30, 0.1);
+INSERT INTO t VALUES (2706, 27, 18, 8.31, 0.1);
+INSERT INTO t VALUES (2707, 27, 55, 8.32, 0.1);
+INSERT INTO t VALUES (2708, 27, 92, 8.33, 0.1);
+INSERT INTO t VALUES (2709, 27, 32, 8.34, 0.1);
+INSERT INTO t VALUES (2710, 27, 69, 8.35, 0.1);
+INSERT INTO t VALUES (2711, 27, 9, 8.36, 0.1);
+INSERT INTO t VALUES (2712, 27, 46, 8.37, 0.1);
+INSERT INTO t VALUES (2713, 27, 83, 8.38, 0.1);
+INSERT INTO t VALUES (2714, 27, 23, 8.39, 0.1);
+INSERT INTO t VALUES (2715, 27, 60, 8.40, 0.1);
+INSERT INTO t VALUES (2716, 27, 0, 8.41, 0.1);
+INSERT INTO t VALUES (2717, 27, 37, 8.42, 0.1);
+INSERT INTO t VALUES (2718, 27, 74, 8.43, 0.1);
+INSERT INTO t VALUES (2719, 27, 14, 8.44, 0.1);
+INSERT INTO t VALUES (2720, 27, 51, 8.45, 0.1);
+INSERT INTO t VALUES (2721, 27, 88, 8.46, 0.1);
+INSERT INTO t VALUES (2722, 27, 28, 8.47, 0.1);
+INSERT INTO t VALUES (2723, 27, 65, 8.48, 0.1);
+INSERT INTO t VALUES (2724, 27, 5, 8.49, 0.1);
+INSERT INTO t VALUES (2725, 27, 42, 8.50, 0.1);
+INSERT INTO t VALUES (2726, 27, 79, 8.51, 0.1);
+INSERT INTO t VALUES (2727, 27, 19, 8.52, 0.1);
+INSERT INTO t VALUES (2728, 27, 56, 8.53, 0.1);
+INSERT INTO t VALUES (2729, 27, 93, 8.54, 0.1);
+INSERT INTO t VALUES (2730, 27, 33, 8.55, 0.1);
+INSERT INTO t VALUES (2731, 27, 70, 8.56, 0.1);
+INSERT INTO t VALUES (2732, 27, 10, 8.57, 0.1);
+INSERT INTO t VALUES (2733, 27, 47, 8.58, 0.1);
+INSERT INTO t VALUES (2734, 27, 84, 8.59, 0.1);
+INSERT INTO t VALUES (2735, 27, 24, 8.60, 0.1);
+INSERT INTO t VALUES (2736, 27, 61, 8.61, 0.1);
+INSERT INTO t VALUES (2737, 27, 1, 8.62, 0.1);
+INSERT INTO t VALUES (2738, 27, 38, 8.63, 0.1);
+INSERT INTO t VALUES (2739, 27, 75, 8.64, 0.1);
+INSERT INTO t VALUES (2740, 27, 15, 8.65, 0.1);
+INSERT INTO t VALUES (2741, 27, 52, 8.66, 0.1);
+INSERT INTO t VALUES (2742, 27, 89, 8.67, 0.1);
+INSERT INTO t VALUES (2743, 27, 29, 8.68, 0.1);
+INSERT INTO t VALUES (2744, 27, 66, 8.69, 0.1);
+INSERT INTO t VALUES (2745, 27, 6, 8.70, 0.1);
+INSERT INTO t VALUES (2746, 27, 43, 8.71, 0.1);
+INSERT INTO t VALUES (2747, 27, 80, 8.72, 0.1);
+INSERT INTO t VALUES (2748, 27, 20, 8.73, 0.1);
+INSERT INTO t VALUES (2749, 27, 57, 8.74, 0.1);
+INSERT INTO t VALUES (2750, 27, 94, 8.75, 0.1);
+INSERT INTO t VALUES (2751, 27, 34, 8.76, 0.1);
+INSERT INTO t VALUES (2752, 27, 71, 8.77, 0.1);
+INSERT INTO t VALUES (2753, 27, 11, 8.78, 0.1);
+INSERT INTO t VALUES (2754, 27, 48, 8.79, 0.1);
+INSERT INTO t VALUES (2755, 27, 85, 8.80, 0.1);
+INSERT INTO t VALUES (2756, 27, 25, 8.81, 0.1);
+INSERT INTO t VALUES (2757, 27, 62, 8.82, 0.1);
+INSERT INTO t VALUES (2758, 27, 2, 8.83, 0.1);
+INSERT INTO t VALUES (2759, 27, 39, 8.84, 0.1);
+INSERT INTO t VALUES (2760, 27, 76, 8.85, 0.1);
+INSERT INTO t VALUES (2761, 27, 16, 8.86, 0.1);
+INSERT INTO t VALUES (2762, 27, 53, 8.87, 0.1);
+INSERT INTO t VALUES (2763, 27, 90, 8.88, 0.1);
+INSERT INTO t VALUES (2764, 27, 30, 8.89, 0.1);
+INSERT INTO t VALUES (2765, 27, 67, 8.90, 0.1);
+INSERT INTO t VALUES (2766, 27, 7, 8.91, 0.1);
+INSERT INTO t VALUES (2767, 27, 44, 8.92, 0.1);
+INSERT INTO t VALUES (2768, 27, 81, 8.93, 0.1);
+INSERT INTO t VALUES (2769, 27, 21, 8.94, 0.1);
+INSERT INTO t VALUES (2770, 27, 58, 8.95, 0.1);
+INSERT INTO t VALUES (2771, 27, 95, 8.96, 0.1);
+INSERT INTO t VALUES (2772, 27, 35, 8.97, 0.1);
+INSERT INTO t VALUES (2773, 27, 72, 8.98, 0.1);
+INSERT INTO t VALUES (2774, 27, 12, 8.99, 0.1);
+INSERT INTO t VALUES (2775, 27, 49, 9.00, 0.1);
+INSERT INTO t VALUES (2776, 27, 86, 9.01, 0.1);
+INSERT INTO t VALUES (2777, 27, 26, 9.02, 0.1);
+INSERT INTO t VALUES (2778, 27, 63, 9.03, 0.1);
+INSERT INTO t VALUES (2779, 27, 3, 9.04, 0.1);
+INSERT INTO t VALUES (2780, 27, 40, 9.05, 0.1);
+INSERT INTO t VALUES (2781, 27, 77, 9.06, 0.1);
+INSERT INTO t VALUES (2782, 27, 17, 9.07, 0.1);
+INSERT INTO t VALUES (2783, 27, 54, 9.08, 0.1);
+INSERT INTO t VALUES (2784, 27, 91, 9.09, 0.1);
+INSERT INTO t VALUES (2785, 27, 31, 9.10, 0.1);
+INSERT INTO t VALUES (2786, 27, 68, 9.11, 0.1);
+INSERT INTO t VALUES (2787, 27, 8, 9.12, 0.1);
+INSERT INTO t VALUES (2788, 27, 45, 9.13, 0.1);
+INSERT INTO t VALUES (2789, 27, 82, 9.14, 0.1);
+INSERT INTO t VALUES (2790, 27, 22, 9.15, 0.1);
+INSERT INTO t VALUES (2791, 27, 59, 9.16, 0.1);
+INSERT INTO t VALUES (2792, 27, 96, 9.17, 0.1);
+INSERT INTO t VALUES (2793, 27, 36, 9.18, 0.1);
+INSERT INTO t VALUES (2794, 27, 73, 9.19, 0.1);
+INSERT INTO t VALUES (2795, 27, 13, 9.20, 0.1);
+INSERT INTO t VALUES (2796, 27, 50, 9.21, 0.1);
+INSERT INTO t VALUES (2797, 27, 87, 9.22, 0.1);
+INSERT INTO t VALUES (2798, 27, 27, 9.23, 0.1);
+INSERT INTO t VALUES (2799, 27, 64, 9.24, 0.1);
+INSERT INTO t VALUES (2800, 28, 4, 9.25, 0.1);
+INSERT INTO t VALUES (2801, 28, 41, 9.26, 0.1);
+INSERT INTO t VALUES (2802, 28, 78, 9.27, 0.1);
+INSERT INTO t VALUES (2803, 28, 18, 9.28, 0.1);
+INSERT INTO t VALUES (2804, 28, 55, 9.29, 0.1);
+INSERT INTO t VALUES (2805, 28, 92, 9.30, 0.1);
+INSERT INTO t VALUES (2806, 28, 32, 9.31, 0.1);
+INSERT INTO t VALUES (2807, 28, 69, 9.32, 0.1);
+INSERT INTO t VALUES (2808, 28, 9, 9.33, 0.1);
+INSERT INTO t VALUES (2809, 28, 46, 9.34, 0.1);
+INSERT INTO t VALUES (2810, 28, 83, 9.35, 0.1);
+INSERT INTO t VALUES (2811, 28, 23, 9.36, 0.1);
+INSERT INTO t VALUES (2812, 28, 60, 9.37, 0.1);
+INSERT INTO t VALUES (2813, 28, 0, 9.38, 0.1);
+INSERT INTO t VALUES (2814, 28, 37, 9.39, 0.1);
+INSERT INTO t VALUES (2815, 28, 74, 9.40, 0.1);
+INSERT INTO t VALUES (2816, 28, 14, 9.41, 0.1);
+INSERT INTO t VALUES (2817, 28, 51, 9.42, 0.1);
+INSERT INTO t VALUES (2818, 28, 88, 9.43, 0.1);
+INSERT INTO t VALUES (2819, 28, 28, 9.44, 0.1);
+INSERT INTO t VALUES (2820, 28, 65, 9.45, 0.1);
+INSERT INTO t VALUES (2821, 28, 5, 9.46, 0.1);
+INSERT INTO t VALUES (2822, 28, 42, 9.47, 0.1);
+INSERT INTO t VALUES (2823, 28, 79, 9.48, 0.1);
+INSERT INTO t VALUES (2824, 28, 19, 9.49, 0.1);
+INSERT INTO t VALUES (2825, 28, 56, 9.50, 0.1);
+INSERT INTO t VALUES (2826, 28, 93, 9.51, 0.1);
+INSERT INTO t VALUES (2827, 28, 33, 9.52, 0.1);
+INSERT INTO t VALUES (2828, 28, 70, 9.53, 0.1);
+INSERT INTO t VALUES (2829, 28, 10, 9.54, 0.1);
+INSERT INTO t VALUES (2830, 28, 47, 9.55, 0.1);
+INSERT INTO t VALUES (2831, 28, 84, 9.56, 0.1);
+INSERT INTO t VALUES (2832, 28, 24, 9.57, 0.1);
+INSERT INTO t VALUES (2833, 28, 61, 9.58, 0.1);
+INSERT INTO t VALUES (2834, 28, 1, 9.59, 0.1);
+INSERT INTO t VALUES (2835, 28, 38, 9.60, 0.1);
+INSERT INTO t VALUES (2836, 28, 75, 9.61, 0.1);
+INSERT INTO t VALUES (2837, 28, 15, 9.62, 0.1);
+INSERT INTO t VALUES (2838, 28, 52, 9.63, 0.1);
+INSERT INTO t VALUES (2839, 28, 89, 9.64, 0.1);
+INSERT INTO t VALUES (2840, 28, 29, 9.65, 0.1);
+INSERT INTO t VALUES (2841, 28, 66, 9.66, 0.1);
+INSERT INTO t VALUES (2842, 28, 6, 9.67, 0.1);
+INSERT INTO t VALUES (2843, 28, 43, 9.68, 0.1);
+INSERT INTO t VALUES (2844, 28, 80, 9.69, 0.1);
+INSERT INTO t VALUES (2845, 28, 20, 9.70, 0.1);
+INSERT INTO t VALUES (2846, 28, 57, 9.71, 0.1);
+INSERT INTO t VALUES (2847, 28, 94, 9.72, 0.1);
+INSERT INTO t VALUES (2848, 28, 34, 9.73, 0.1);
+INSERT INTO t VALUES (2849, 28, 71, 9.74, 0.1);
+INSERT INTO t VALUES (2850, 28, 11, 9.75, 0.1);
+INSERT INTO t VALUES (2851, 28, 48, 9.76, 0.1);
+INSERT INTO t VALUES (2852, 28, 85, 9.77, 0.1);
+INSERT INTO t VALUES (2853, 28, 25, 9.78, 0.1);
+INSERT INTO t VALUES (2854, 28, 62, 9.79, 0.1);
+INSERT INTO t VALUES (2855, 28, 2, 9.80, 0.1);
+INSERT INTO t VALUES (2856, 28, 39, 9.81, 0.1);
+INSERT INTO t VALUES (2857, 28, 76, 9.82, 0.1);
+INSERT INTO t VALUES (2858, 28, 16, 9.83, 0.1);
+INSERT INTO t VALUES (2859, 28, 53, 9.84, 0.1);
+INSERT INTO t VALUES (2860, 28, 90, 9.85, 0.1);
+INSERT INTO t VALUES (2861, 28, 30, 9.86, 0.1);
+INSERT INTO t VALUES (2862, 28, 67, 9.87, 0.1);
+INSERT INTO t VALUES (2863, 28, 7, 9.88, 0.1);
+INSERT INTO t VALUES (2864, 28, 44, 9.89, 0.1);
+INSERT INTO t VALUES (2865, 28, 81, 9.90, 0.1);
+INSERT INTO t VALUES (2866, 28, 21, 9.91, 0.1);
+INSERT INTO t VALUES (2867, 28, 58, 9.92, 0.1);
+INSERT INTO t VALUES (2868, 28, 95, 9.93, 0.1);
+INSERT INTO t VALUES (2869, 28, 35, 9.94, 0.1);
+INSERT INTO t VALUES (2870, 28, 72, 9.95, 0.1);
+INSERT INTO t VALUES (2871, 28, 12, 9.96, 0.1);
+INSERT INTO t VALUES (2872, 28, 49, 9.97, 0.1);
+INSERT INTO t VALUES (2873, 28, 86, 9.98, 0.1);
+INSERT INTO t VALUES (2874, 28, 26, 9.99, 0.1);
+INSERT INTO t VALUES (2875, 28, 63, 10.00, 0.1);
+INSERT INTO t VALUES (2876, 28, 3, 10.01, 0.1);
+INSERT INTO t VALUES (2877, 28, 40, 10.02, 0.1);
+INSERT INTO t VALUES (2878, 28, 77, 10.03, 0.1);
+INSERT INTO t VALUES (2879, 28, 17, 10.04, 0.1);
+INSERT INTO t VALUES (2880, 28, 54, 10.05, 0.1);
+INSERT INTO t VALUES (2881, 28, 91, 10.06, 0.1);
+INSERT INTO t VALUES (2882, 28, 31, 10.07, 0.1);
+INSERT INTO t VALUES (2883, 28, 68, 10.08, 0.1);
+INSERT INTO t VALUES (2884, 28, 8, 10.09, 0.1);
+INSERT INTO t VALUES (2885, 28, 45, 10.10, 0.1);
+INSERT INTO t VALUES (2886, 28, 82, 10.11, 0.1);
+INSERT INTO t VALUES (2887, 28, 22, 10.12, 0.1);
+INSERT INTO t VALUES (2888, 28, 59, 10.13, 0.1);
+INSERT INTO t VALUES (2889, 28, 96, 10.14, 0.1);
+INSERT INTO t VALUES (2890, 28, 36, 10.15, 0.1);
+INSERT INTO t VALUES (2891, 28, 73, 10.16, 0.1);
+INSERT INTO t VALUES (2892, 28, 13, 10.17, 0.1);
+INSERT INTO t VALUES (2893, 28, 50, 10.18, 0.1);
+INSERT INTO t VALUES (2894, 28, 87, 10.19, 0.1);
+INSERT INTO t VALUES (2895, 28, 27, 10.20, 0.1);
+INSERT INTO t VALUES (2896, 28, 64, 10.21, 0.1);
+INSERT INTO t VALUES (2897, 28, 4, 10.22, 0.1);
+INSERT INTO t VALUES (2898, 28, 41, 10.23, 0.1);
+INSERT INTO t VALUES (2899, 28, 78, 10.24, 0.1);
+INSERT INTO t VALUES (2900, 29, 18, 10.25, 0.1);
+INSERT INTO t VALUES (2901, 29, 55, 10.26, 0.1);
+INSERT INTO t VALUES (2902, 29, 92, 10.27, 0.1);
+INSERT INTO t VALUES (2903, 29, 32, 10.28, 0.1);
+INSERT INTO t VALUES (2904, 29, 69, 10.29, 0.1);
+INSERT INTO t VALUES (2905, 29, 9, 10.30, 0.1);
+INSERT INTO t VALUES (2906, 29, 46, 10.31, 0.1);
+INSERT INTO t VALUES (2907, 29, 83, 10.32, 0.1);
+INSERT INTO t VALUES (2908, 29, 23, 10.33, 0.1);
+INSERT INTO t VALUES (2909, 29, 60, 10.34, 0.1);
+INSERT INTO t VALUES (2910, 29, 0, 10.35, 0.1);
+INSERT INTO t VALUES (2911, 29, 37, 10.36, 0.1);
+INSERT INTO t VALUES (2912, 29, 74, 10.37, 0.1);
+INSERT INTO t VALUES (2913, 29, 14, 10.38, 0.1);
+INSERT INTO t VALUES (2914, 29, 51, 10.39, 0.1);
+INSERT INTO t VALUES (2915, 29, 88, 10.40, 0.1);
+INSERT INTO t VALUES (2916, 29, 28, 10.41, 0.1);
+INSERT INTO t VALUES (2917, 29, 65, 10.42, 0.1);
+INSERT INTO t VALUES (2918, 29, 5, 10.43, 0.1);
+INSERT INTO t VALUES (2919, 29, 42, 10.44, 0.1);
+INSERT INTO t VALUES (2920, 29, 79, 10.45, 0.1);
+INSERT INTO t VALUES (2921, 29, 19, 10.46, 0.1);
+INSERT INTO t VALUES (2922, 29, 56, 10.47, 0.1);
+INSERT INTO t VALUES (2923, 29, 93, 10.48, 0.1);
+INSERT INTO t VALUES (2924, 29, 33, 10.49, 0.1);
+INSERT INTO t VALUES (2925, 29, 70, 10.50, 0.1);
+INSERT INTO t VALUES (2926, 29, 10, 10.51, 0.1);
+INSERT INTO t VALUES (2927, 29, 47, 10.52, 0.1);
+INSERT INTO t VALUES (2928, 29, 84, 10.53, 0.1);
+INSERT INTO t VALUES (2929, 29, 24, 10.54, 0.1);
+INSERT INTO t VALUES (2930, 29, 61, 10.55, 0.1);
+INSERT INTO t VALUES (2931, 29, 1, 10.56, 0.1);
+INSERT INTO t VALUES (2932, 29, 38, 10.57, 0.1);
+INSERT INTO t VALUES (2933, 29, 75, 10.58, 0.1);
+INSERT INTO t VALUES (2934, 29, 15, 10.59, 0.1);
+INSERT INTO t VALUES (2935, 29, 52, 10.60, 0.1);
+INSERT INTO t VALUES (2936, 29, 89, 10.61, 0.1);
+INSERT INTO t VALUES (2937, 29, 29, 10.62, 0.1);
+INSERT INTO t VALUES (2938, 29, 66, 10.63, 0.1);
+INSERT INTO t VALUES (2939, 29, 6, 10.64, 0.1);
+INSERT INTO t VALUES (2940, 29, 43, 10.65, 0.1);
+INSERT INTO t VALUES (2941, 29, 80, 10.66, 0.1);
+INSERT INTO t VALUES (2942, 29, 20, 10.67, 0.1);
+INSERT INTO t VALUES (2943, 29, 57, 10.68, 0.1);
+INSERT INTO t VALUES (2944, 29, 94, 10.69, 0.1);
+INSERT INTO t VALUES (2945, 29, 34, 10.70, 0.1);
+INSERT INTO t VALUES (2946, 29, 71, 10.71, 0.1);
+INSERT INTO t VALUES (2947, 29, 11, 10.72, 0.1);
+INSERT INTO t VALUES (2948, 29, 48, 10.73, 0.1);
+INSERT INTO t VALUES (2949, 29, 85, 10.74, 0.1);
+INSERT INTO t VALUES (2950, 29, 25, 10.75, 0.1);
+INSERT INTO t VALUES (2951, 29, 62, 10.76, 0.1);
+INSERT INTO t VALUES (2952, 29, 2, 10.77, 0.1);
+INSERT INTO t VALUES (2953, 29, 39, 10.78, 0.1);
+INSERT INTO t VALUES (2954, 29, 76, 10.79, 0.1);
+INSERT INTO t VALUES (2955, 29, 16, 10.80, 0.1);
+INSERT INTO t VALUES (2956, 29, 53, 10.81, 0.1);
+INSERT INTO t VALUES (2957, 29, 90, 10.82, 0.1);
+INSERT INTO t VALUES (2958, 29, 30, 10.83, 0.1);
+INSERT INTO t VALUES (2959, 29, 67, 10.84, 0.1);
+INSERT INTO t VALUES (2960, 29, 7, 10.85, 0.1);
+INSERT INTO t VALUES (2961, 29, 44, 10.86, 0.1);
+INSERT INTO t VALUES (2962, 29, 81, 10.87, 0.1);
+INSERT INTO t VALUES (2963, 29, 21, 10.88, 0.1);
+INSERT INTO t VALUES (2964, 29, 58, 10.89, 0.1);
+INSERT INTO t VALUES (2965, 29, 95, 10.90, 0.1);
+INSERT INTO t VALUES (2966, 29, 35, 10.91, 0.1);
+INSERT INTO t VALUES (2967, 29, 72, 10.92, 0.1);
+INSERT INTO t VALUES (2968, 29, 12, 10.93, 0.1);
+INSERT INTO t VALUES (2969, 29, 49, 10.94, 0.1);
+INSERT INTO t VALUES (2970, 29, 86, 10.95, 0.1);
+INSERT INTO t VALUES (2971, 29, 26, 10.96, 0.1);
+INSERT INTO t VALUES (2972, 29, 63, 10.97, 0.1);
+INSERT INTO t VALUES (2973, 29, 3, 10.98, 0.1);
+INSERT INTO t VALUES (2974, 29, 40, 10.99, 0.1);
+INSERT INTO t VALUES (2975, 29, 77, 11.00, 0.1);
+INSERT INTO t VALUES (2976, 29, 17, 11.01, 0.1);
+INSERT INTO t VALUES (2977, 29, 54, 11.02, 0.1);
+INSERT INTO t VALUES (2978, 29, 91, 11.03, 0.1);
+INSERT INTO t VALUES (2979, 29, 31, 11.04, 0.1);
+INSERT INTO t VALUES (2980, 29, 68, 11.05, 0.1);
+INSERT INTO t VALUES (2981, 29, 8, 11.06, 0.1);
+INSERT INTO t VALUES (2982, 29, 45, 11.07, 0.1);
+INSERT INTO t VALUES (2983, 29, 82, 11.08, 0.1);
+INSERT INTO t VALUES (2984, 29, 22, 11.09, 0.1);
+INSERT INTO t VALUES (2985, 29, 59, 11.10, 0.1);
+INSERT INTO t VALUES (2986, 29, 96, 11.11, 0.1);
+INSERT INTO t VALUES (2987, 29, 36, 11.12, 0.1);
+INSERT INTO t VALUES (2988, 29, 73, 11.13, 0.1);
+INSERT INTO t VALUES (2989, 29, 13, 11.14, 0.1);
+INSERT INTO t VALUES (2990, 29, 50, 11.15, 0.1);
+INSERT INTO t VALUES (2991, 29, 87, 11.16, 0.1);
+INSERT INTO t VALUES (2992, 29, 27, 11.17, 0.1);
+INSERT INTO t VALUES (2993, 29, 64, 11.18, 0.1);
+INSERT INTO t VALUES (2994, 29, 4, 11.19, 0.1);
+INSERT INTO t VALUES (2995, 29, 41, 11.20, 0.1);
+INSERT INTO t VALUES (2996, 29, 78, 11.21, 0.1);
+INSERT INTO t VALUES (2997, 29, 18, 11.22, 0.1);
+INSERT INTO t VALUES (2998, 29, 55, 11.23, 0.1);
+INSERT INTO t VALUES (2999, 29, 92, 11.24, 0.1);
+INSERT INTO t VALUES (3000, 30, -2147483647, 1.25, 0.2);
+INSERT INTO t VALUES (3001, 30, 69, 1.26, 0.2);
+INSERT INTO t VALUES (3002, 30, 9, 1.27, 0.2);
+INSERT INTO t VALUES (3003, 30, 46, 1.28, 0.2);
+INSERT INTO t VALUES (3004, 30, 83, 1.29, 0.2);
+INSERT INTO t VALUES (3005, 30, 23, 1.30, 0.2);
+INSERT INTO t VALUES (3006, 30, 60, 1.31, 0.2);
+INSERT INTO t VALUES (3007, 30, 0, 1.32, 0.2);
+INSERT INTO t VALUES (3008, 30, 37, 1.33, 0.2);
+INSERT INTO t VALUES (3009, 30, 74, 1.34, 0.2);
+INSERT INTO t VALUES (3010, 30, 14, 1.35, 0.2);
+INSERT INTO t VALUES (3011, 30, 51, 1.36, 0.2);
+INSERT INTO t VALUES (3012, 30, 88, 1.37, 0.2);
+INSERT INTO t VALUES (3013, 30, 28, 1.38, 0.2);
+INSERT INTO t VALUES (3014, 30, 65, 1.39, 0.2);
+INSERT INTO t VALUES (3015, 30, 5, 1.40, 0.2);
+INSERT INTO t VALUES (3016, 30, 42, 1.41, 0.2);
+INSERT INTO t VALUES (3017, 30, 79, 1.42, 0.2);
+INSERT INTO t VALUES (3018, 30, 19, 1.43, 0.2);
+INSERT INTO t VALUES (3019, 30, 56, 1.44, 0.2);
+INSERT INTO t VALUES (3020, 30, 93, 1.45, 0.2);
+INSERT INTO t VALUES (3021, 30, 33, 1.46, 0.2);
+INSERT INTO t VALUES (3022, 30, 70, 1.47, 0.2);
+INSERT INTO t VALUES (3023, 30, 10, 1.48, 0.2);
+INSERT INTO t VALUES (3024, 30, 47, 1.49, 0.2);
+INSERT INTO t VALUES (3025, 30, 84, 1.50, 0.2);
+INSERT INTO t VALUES (3026, 30, 24, 1.51, 0.2);
+INSERT INTO t VALUES (3027, 30, 61, 1.52, 0.2);
+INSERT INTO t VALUES (3028, 30, 1, 1.53, 0.2);
+INSERT INTO t VALUES (3029, 30, 38, 1.54, 0.2);
+INSERT INTO t VALUES (3030, 30, 75, 1.55, 0.2);
+INSERT INTO t VALUES (3031, 30, 15, 1.56, 0.2);
+INSERT INTO t VALUES (3032, 30, 52, 1.57, 0.2);
+INSERT INTO t VALUES (3033, 30, 89, 1.58, 0.2);
+INSERT INTO t VALUES (3034, 30, 29, 1.59, 0.2);
+INSERT INTO t VALUES (3035, 30, 66, 1.60, 0.2);
+INSERT INTO t VALUES (3036, 30, 6, 1.61, 0.2);
+INSERT INTO t VALUES (3037, 30, 43, 1.62, 0.2);
+INSERT INTO t VALUES (3038, 30, 80, 1.63, 0.2);
+INSERT INTO t VALUES (3039, 30, 20, 1.64, 0.2);
+INSERT INTO t VALUES (3040, 30, 57, 1.65, 0.2);
+INSERT INTO t VALUES (3041, 30, 94, 1.66, 0.2);
+INSERT INTO t VALUES (3042, 30, 34, 1.67, 0.2);
+INSERT INTO t VALUES (3043, 30, 71, 1.68, 0.2);
+INSERT INTO t VALUES (3044, 30, 11, 1.69, 0.2);
+INSERT INTO t VALUES (3045, 30, 48, 1.70, 0.2);
+INSERT INTO t VALUES (3046, 30, 85, 1.71, 0.2);
+INSERT INTO t VALUES (3047, 30, 25, 1.72, 0.2);
+INSERT INTO t VALUES (3048, 30, 62, 1.73, 0.2);
+INSERT INTO t VALUES (3049, 30, 2, 1.74, 0.2);
+INSERT INTO t VALUES (3050, 30, 39, 1.75, 0.2);
+INSERT INTO t VALUES (3051, 30, 76, 1.76, 0.2);
+INSERT INTO t VALUES (3052, 30, 16, 1.77, 0.2);
+INSERT INTO t VALUES (3053, 30, 53, 1.78, 0.2);
+INSERT INTO t VALUES (3054, 30, 90, 1.79, 0.2);
+INSERT INTO t VALUES (3055, 30, 30, 1.80, 0.2);
+INSERT INTO t VALUES (3056, 30, 67, 1.81, 0.2);
+INSERT INTO t VALUES (3057, 30, 7, 1.82, 0.2);
+INSERT INTO t VALUES (3058, 30, 44, 1.83, 0.2);
+INSERT INTO t VALUES (3059, 30, 81, 1.84, 0.2);
+INSERT INTO t VALUES (3060, 30, 21, 1.85, 0.2);
+INSERT INTO t VALUES (3061, 30, 58, 1.86, 0.2);
+INSERT INTO t VALUES (3062, 30, 95, 1.87, 0.2);
+INSERT INTO t VALUES (3063, 30, 35, 1.88, 0.2);
+INSERT INTO t VALUES (3064, 30, 72, 1.89, 0.2);
+INSERT INTO t VALUES (3065, 30, 12, 1.90, 0.2);
+INSERT INTO t VALUES (3066, 30, 49, 1.91, 0.2);
+INSERT INTO t VALUES (3067, 30, 86, 1.92, 0.2);
+INSERT INTO t VALUES (3068, 30, 26, 1.93, 0.2);
+INSERT INTO t VALUES (3069, 30, 63, 1.94, 0.2);
+INSERT INTO t VALUES (3070, 30, 3, 1.95, 0.2);
+INSERT INTO t VALUES (3071, 30, 40, 1.96, 0.2);
+INSERT INTO t VALUES (3072, 30, 77, 1.97, 0.2);
+INSERT INTO t VALUES (3073, 30, 17, 1.98, 0.2);
+INSERT INTO t VALUES (3074, 30, 54, 1.99, 0.2);
+INSERT INTO t VALUES (3075, 30, 91, 2.00, 0.2);
+INSERT INTO t VALUES (3076, 30, 31, 2.01, 0.2);
+INSERT INTO t VALUES (3077, 30, 68, 2.02, 0.2);
+INSERT INTO t VALUES (3078, 30, 8, 2.03, 0.2);
+INSERT INTO t VALUES (3079, 30, 45, 2.04, 0.2);
+INSERT INTO t VALUES (3080, 30, 82, 2.05, 0.2);
+INSERT INTO t VALUES (3081, 30, 22, 2.06, 0.2);
+INSERT INTO t VALUES (3082, 30, 59, 2.07, 0.2);
+INSERT INTO t VALUES (3083, 30, 96, 2.08, 0.2);
+INSERT INTO t VALUES (3084, 30, 36, 2.09, 0.2);
+INSERT INTO t VALUES (3085, 30, 73, 2.10, 0.2);
+INSERT INTO t VALUES (3086, 30, 13, 2.11, 0.2);
+INSERT INTO t VALUES (3087, 30, 50, 2.12, 0.2);
+INSERT INTO t VALUES (3088, 30, 87, 2.13, 0.2);
+INSERT INTO t VALUES (3089, 30, 27, 2.14, 0.2);
+INSERT INTO t VALUES (3090, 30, 64, 2.15, 0.2);
+INSERT INTO t VALUES (3091, 30, 4, 2.16, 0.2);
+INSERT INTO t VALUES (3092, 30, 41, 2.17, 0.2);
+INSERT INTO t VALUES (3093, 30, 78, 2.18, 0.2);
+INSERT INTO t VALUES (3094, 30, 18, 2.19, 0.2);
+INSERT INTO t VALUES (3095, 30, 55, 2.20, 0.2);
+INSERT INTO t VALUES (3096, 30, 92, 2.21, 0.2);
+INSERT INTO t VALUES (3097, 30, 32, 2.22, 0.2);
+INSERT INTO t VALUES (3098, 30, 69, 2.23, 0.2);
+INSERT INTO t VALUES (3099, 30, 9, 2.24, 0.2);
+INSERT INTO t VALUES (3100, 31, 46, 2.25, 0.2);
+INSERT INTO t VALUES (3101, 31, 83, 2.26, 0.2);
+INSERT INTO t VALUES (3102, 31, 23, 2.27, 0.2);
+INSERT INTO t VALUES (3103, 31, 60, 2.28, 0.2);
+INSERT INTO t VALUES (3104, 31, 0, 2.29, 0.2);
+INSERT INTO t VALUES (3105, 31, 37, 2.30, 0.2);
+INSERT INTO t VALUES (3106, 31, 74, 2.31, 0.2);
+INSERT INTO t VALUES (3107, 31, 14, 2.32, 0.2);
+INSERT INTO t VALUES (3108, 31, 51, 2.33, 0.2);
+INSERT INTO t VALUES (3109, 31, 88, 2.34, 0.2);
+INSERT INTO t VALUES (3110, 31, 28, 2.35, 0.2);
+INSERT INTO t VALUES (3111, 31, 65, 2.36, 0.2);
+INSERT INTO t VALUES (3112, 31, 5, 2.37, 0.2);
+INSERT INTO t VALUES (3113, 31, 42, 2.38, 0.2);
+INSERT INTO t VALUES (3114, 31, 79, 2.39, 0.2);
+INSERT INTO t VALUES (3115, 31, 19, 2.40, 0.2);
+INSERT INTO t VALUES (3116, 31, 56, 2.41, 0.2);
+INSERT INTO t VALUES (3117, 31, 93, 2.42, 0.2);
+INSERT INTO t VALUES (3118, 31, 33, 2.43, 0.2);
+INSERT INTO t VALUES (3119, 31, 70, 2.44, 0.2);
+INSERT INTO t VALUES (3120, 31, 10, 2.45, 0.2);
+INSERT INTO t VALUES (3121, 31, 47, 2.46, 0.2);
+INSERT INTO t VALUES (3122, 31, 84, 2.47, 0.2);
+INSERT INTO t VALUES (3123, 31, 24, 2.48, 0.2);
+INSERT INTO t VALUES (3124, 31, 61, 2.49, 0.2);
+INSERT INTO t VALUES (3125, 31, 1, 2.50, 0.2);
+INSERT INTO t VALUES (3126, 31, 38, 2.51, 0.2);
+INSERT INTO t VALUES (3127, 31, 75, 2.52, 0.2);
+INSERT INTO t VALUES (3128, 31, 15, 2.53, 0.2);
+INSERT INTO t VALUES (3129, 31, 52, 2.54, 0.2);
+INSERT INTO t VALUES (3130, 31, 89, 2.55, 0.2);
+INSERT INTO t VALUES (3131, 31, 29, 2.56, 0.2);
+INSERT INTO t VALUES (3132, 31, 66, 2.57, 0.2);
+INSERT INTO t VALUES (3133, 31, 6, 2.58, 0.2);
+INSERT INTO t VALUES (3134, 31, 43, 2.59, 0.2);
+INSERT INTO t VALUES (3135, 31, 80, 2.60, 0.2);
+INSERT INTO t VALUES (3136, 31, 20, 2.61, 0.2);
+INSERT INTO t VALUES (3137, 31, 57, 2.62, 0.2);
+INSERT INTO t VALUES (3138, 31, 94, 2.63, 0.2);
+INSERT INTO t VALUES (3139, 31, 34, 2.64, 0.2);
+INSERT INTO t VALUES (3140, 31, 71, 2.65, 0.2);
+INSERT INTO t VALUES (3141, 31, 11, 2.66, 0.2);
+INSERT INTO t VALUES (3142, 31, 48, 2.67, 0.2);
+INSERT INTO t VALUES (3143, 31, 85, 2.68, 0.2);
+INSERT INTO t VALUES (3144, 31, 25, 2.69, 0.2);
+INSERT INTO t VALUES (3145, 31, 62, 2.70, 0.2);
+INSERT INTO t VALUES (3146, 31, 2, 2.71, 0.2);
+INSERT INTO t VALUES (3147, 31, 39, 2.72, 0.2);
+INSERT INTO t VALUES (3148, 31, 76, 2.73, 0.2);
+INSERT INTO t VALUES (3149, 31, 16, 2.74, 0.2);
+INSERT INTO t VALUES (3150, 31, 53, 2.75, 0.2);
+INSERT INTO t VALUES (3151, 31, 90, 2.76, 0.2);
+INSERT INTO t VALUES (3152, 31, 30, 2.77, 0.2);
+INSERT INTO t VALUES (3153, 31, 67, 2.78, 0.2);
+INSERT INTO t VALUES (3154, 31, 7, 2.79, 0.2);
+INSERT INTO t VALUES (3155, 31, 44, 2.80, 0.2);
+INSERT INTO t VALUES (3156, 31, 81, 2.81, 0.2);
+INSERT INTO t VALUES (3157, 31, 21, 2.82, 0.2);
+INSERT INTO t VALUES (3158, 31, 58, 2.83, 0.2);
+INSERT INTO t VALUES (3159, 31, 95, 2.84, 0.2);
+INSERT INTO t VALUES (3160, 31, 35, 2.85, 0.2);
+INSERT INTO t VALUES (3161, 31, 72, 2.86, 0.2);
+INSERT INTO t VALUES (3162, 31, 12, 2.87, 0.2);
+INSERT INTO t VALUES (3163, 31, 49, 2.88, 0.2);
+INSERT INTO t VALUES (3164, 31, 86, 2.89, 0.2);
+INSERT INTO t VALUES (3165, 31, 26, 2.90, 0.2);
+INSERT INTO t VALUES (3166, 31, 63, 2.91, 0.2);
+INSERT INTO t VALUES (3167, 31, 3, 2.92, 0.2);
+INSERT INTO t VALUES (3168, 31, 40, 2.93, 0.2);
+INSERT INTO t VALUES (3169, 31, 77, 2.94, 0.2);
+INSERT INTO t VALUES (3170, 31, 17, 2.95, 0.2);
+INSERT INTO t VALUES (3171, 31, 54, 2.96, 0.2);
+INSERT INTO t VALUES (3172, 31, 91, 2.97, 0.2);
+INSERT INTO t VALUES (3173, 31, 31, 2.98, 0.2);
+INSERT INTO t VALUES (3174, 31, 68, 2.99, 0.2);
+INSERT INTO t VALUES (3175, 31, 8, 3.00, 0.2);
+INSERT INTO t VALUES (3176, 31, 45, 3.01, 0.2);
+INSERT INTO t VALUES (3177, 31, 82, 3.02, 0.2);
+INSERT INTO t VALUES (3178, 31, 22, 3.03, 0.2);
+INSERT INTO t VALUES (3179, 31, 59, 3.04, 0.2);
+INSERT INTO t VALUES (3180, 31, 96, 3.05, 0.2);
+INSERT INTO t VALUES (3181, 31, 36, 3.06, 0.2);
+INSERT INTO t VALUES (3182, 31, 73, 3.07, 0.2);
+INSERT INTO t VALUES (3183, 31, 13, 3.08, 0.2);
+INSERT INTO t VALUES (3184, 31, 50, 3.09, 0.2);
+INSERT INTO t VALUES (3185, 31, 87, 3.10, 0.2);
+INSERT INTO t VALUES (3186, 31, 27, 3.11, 0.2);
+INSERT INTO t VALUES (3187, 31, 64, 3.12, 0.2);
+INSERT INTO t VALUES (3188, 31, 4, 3.13, 0.2);
+INSERT INTO t VALUES (3189, 31, 41, 3.14, 0.2);
+INSERT INTO t VALUES (3190, 31, 78, 3.15, 0.2);
+INSERT INTO t VALUES (3191, 31, 18, 3.16, 0.2);
+INSERT INTO t VALUES (3192, 31, 55, 3.17, 0.2);
+INSERT INTO t VALUES (3193, 31, 92, 3.18, 0.2);
+INSERT INTO t VALUES (3194, 31, 32, 3.19, 0.2);
+INSERT INTO t VALUES (3195, 31, 69, 3.20, 0.2);
+INSERT INTO t VALUES (3196, 31, 9, 3.21, 0.2);
+INSERT INTO t VALUES (3197, 31, 46, 3.22, 0.2);
+INSERT INTO t VALUES (3198, 31, 83, 3.23, 0.2);
+INSERT INTO t VALUES (3199, 31, 23, 3.24, 0.2);
+INSERT INTO t VALUES (3200, 32, 60, 3.25, 0.2);
+INSERT INTO t VALUES (3201, 32, 0, 3.26, 0.2);
+INSERT INTO t VALUES (3202, 32, 37, 3.27, 0.2);
+INSERT INTO t VALUES (3203, 32, 74, 3.28, 0.2);
+INSERT INTO t VALUES (3204, 32, 14, 3.29, 0.2);
+INSERT INTO t VALUES (3205, 32, 51, 3.30, 0.2);
+INSERT INTO t VALUES (3206, 32, 88, 3.31, 0.2);
+INSERT INTO t VALUES (3207, 32, 28, 3.32, 0.2);
+INSERT INTO t VALUES (3208, 32, 65, 3.33, 0.2);
+INSERT INTO t VALUES (3209, 32, 5, 3.34, 0.2);
+INSERT INTO t VALUES (3210, 32, 42, 3.35, 0.2);
+INSERT INTO t VALUES (3211, 32, 79, 3.36, 0.2);
+INSERT INTO t VALUES (3212, 32, 19, 3.37, 0.2);
+INSERT INTO t VALUES (3213, 32, 56, 3.38, 0.2);
+INSERT INTO t VALUES (3214, 32, 93, 3.39, 0.2);
+INSERT INTO t VALUES (3215, 32, 33, 3.40, 0.2);
+INSERT INTO t VALUES (3216, 32, 70, 3.41, 0.2);
+INSERT INTO t VALUES (3217, 32, 10, 3.42, 0.2);
+INSERT INTO t VALUES (3218, 32, 47, 3.43, 0.2);
+INSERT INTO t VALUES (3219, 32, 84, 3.44, 0.2);
+INSERT INTO t VALUES (3220, 32, 24, 3.45, 0.2);
+INSERT INTO t VALUES (3221, 32, 61, 3.46, 0.2);
+INSERT INTO t VALUES (3222, 32, 1, 3.47, 0.2);
+INSERT INTO t VALUES (3223, 32, 38, 3.48, 0.2);
+INSERT INTO t VALUES (3224, 32, 75, 3.49, 0.2);
+INSERT INTO t VALUES (3225, 32, 15, 3.50, 0.2);
+INSERT INTO t VALUES (3226, 32, 52, 3.51, 0.2);
+INSERT INTO t VALUES (3227, 32, 89, 3.52, 0.2);
+INSERT INTO t VALUES (3228, 32, 29, 3.53, 0.2);
+INSERT INTO t VALUES (3229, 32, 66, 3.54, 0.2);
+INSERT INTO t VALUES (3230, 32, 6, 3.55, 0.2);
+INSERT INTO t VALUES (3231, 32, 43, 3.56, 0.2);
+INSERT INTO t VALUES (3232, 32, 80, 3.57, 0.2);
+INSERT INTO t VALUES (3233, 32, 20, 3.58, 0.2);
+INSERT INTO t VALUES (3234, 32, 57, 3.59, 0.2);
+INSERT INTO t VALUES (3235, 32, 94, 3.60, 0.2);
+INSERT INTO t VALUES (3236, 32, 34, 3.61, 0.2);
+INSERT INTO t VALUES (3237, 32, 71, 3.62, 0.2);
+INSERT INTO t VALUES (3238, 32, 11, 3.63, 0.2);
+INSERT INTO t VALUES (3239, 32, 48, 3.64, 0.2);
+INSERT INTO t VALUES (3240, 32, 85, 3.65, 0.2);
+INSERT INTO t VALUES (3241, 32, 25, 3.66, 0.2);
+INSERT INTO t VALUES (3242, 32, 62, 3.67, 0.2);
+INSERT INTO t VALUES (3243, 32, 2, 3.68, 0.2);
+INSERT INTO t VALUES (3244, 32, 39, 3.69, 0.2);
+INSERT INTO t VALUES (3245, 32, 76, 3.70, 0.2);
+INSERT INTO t VALUES (3246, 32, 16, 3.71, 0.2);
+INSERT INTO t VALUES (3247, 32, 53, 3.72, 0.2);
+INSERT INTO t VALUES (3248, 32, 90, 3.73, 0.2);
+INSERT INTO t VALUES (3249, 32, 30, 3.74, 0.2);
+INSERT INTO t VALUES (3250, 32, 67, 3.75, 0.2);
+INSERT INTO t VALUES (3251, 32, 7, 3.76, 0.2);
+INSERT INTO t VALUES (3252, 32, 44, 3.77, 0.2);
+INSERT INTO t VALUES (3253, 32, 81, 3.78, 0.2);
+INSERT INTO t VALUES (3254, 32, 21, 3.79, 0.2);
+INSERT INTO t VALUES (3255, 32, 58, 3.80, 0.2);
+INSERT INTO t VALUES (3256, 32, 95, 3.81, 0.2);
+INSERT INTO t VALUES (3257, 32, 35, 3.82, 0.2);
+INSERT INTO t VALUES (3258, 32, 72, 3.83, 0.2);
+INSERT INTO t VALUES (3259, 32, 12, 3.84, 0.2);
+INSERT INTO t VALUES (3260, 32, 49, 3.85, 0.2);
+INSERT INTO t VALUES (3261, 32, 86, 3.86, 0.2);
+INSERT INTO t VALUES (3262, 32, 26, 3.87, 0.2);
+INSERT INTO t VALUES (3263, 32, 63, 3.88, 0.2);
+INSERT INTO t VALUES (3264, 32, 3, 3.89, 0.2);
+INSERT INTO t VALUES (3265, 32, 40, 3.90, 0.2);
+INSERT INTO t VALUES (3266, 32, 77, 3.91, 0.2);
+INSERT INTO t VALUES (3267, 32, 17, 3.92, 0.2);
+INSERT INTO t VALUES (3268, 32, 54, 3.93, 0.2);
+INSERT INTO t VALUES (3269, 32, 91, 3.94, 0.2);
+INSERT INTO t VALUES (3270, 32, 31, 3.95, 0.2);
+INSERT INTO t VALUES (3271, 32, 68, 3.96, 0.2);
+INSERT INTO t VALUES (3272, 32, 8, 3.97, 0.2);
+INSERT INTO t VALUES (3273, 32, 45, 3.98, 0.2);
+INSERT INTO t VALUES (3274, 32, 82, 3.99, 0.2);
+INSERT INTO t VALUES (3275, 32, 22, 4.00, 0.2);
+INSERT INTO t VALUES (3276, 32, 59, 4.01, 0.2);
+INSERT INTO t VALUES (3277, 32, 96, 4.02, 0.2);
+INSERT INTO t VALUES (3278, 32, 36, 4.03, 0.2);
+INSERT INTO t VALUES (3279, 32, 73, 4.04, 0.2);
+INSERT INTO t VALUES (3280, 32, 13, 4.05, 0.2);
+INSERT INTO t VALUES (3281, 32, 50, 4.06, 0.2);
+INSERT INTO t VALUES (3282, 32, 87, 4.07, 0.2);
+INSERT INTO t VALUES (3283, 32, 27, 4.08, 0.2);
+INSERT INTO t VALUES (3284, 32, 64, 4.09, 0.2);
+INSERT INTO t VALUES (3285, 32, 4, 4.10, 0.2);
+INSERT INTO t VALUES (3286, 32, 41, 4.11, 0.2);
+INSERT INTO t VALUES (3287, 32, 78, 4.12, 0.2);
+INSERT INTO t VALUES (3288, 32, 18, 4.13, 0.2);
+INSERT INTO t VALUES (3289, 32, 55, 4.14, 0.2);
+INSERT INTO t VALUES (3290, 32, 92, 4.15, 0.2);
+INSERT INTO t VALUES (3291, 32, 32, 4.16, 0.2);
+INSERT INTO t VALUES (3292, 32, 69, 4.17, 0.2);
+INSERT INTO t VALUES (3293, 32, 9, 4.18, 0.2);
+INSERT INTO t VALUES (3294, 32, 46, 4.19, 0.2);
+INSERT INTO t VALUES (3295, 32, 83, 4.20, 0.2);
+INSERT INTO t VALUES (3296, 32, 23, 4.21, 0.2);
+INSERT INTO t VALUES (3297, 32, 60, 4.22, 0.2);
+INSERT INTO t VALUES (3298, 32, 0, 4.23, 0.2);
+INSERT INTO t VALUES (3299, 32, 37, 4.24, 0.2);
+INSERT INTO t VALUES (3300, 33, 74, 4.25, 0.2);
+INSERT INTO t VALUES (3301, 33, 14, 4.26, 0.2);
+INSERT INTO t VALUES (3302, 33, 51, 4.27, 0.2);
+INSERT INTO t VALUES (3303, 33, 88, 4.28, 0.2);
+INSERT INTO t VALUES (3304, 33, 28, 4.29, 0.2);
+INSERT INTO t VALUES (3305, 33, 65, 4.30, 0.2);
+INSERT INTO t VALUES (3306, 33, 5, 4.31, 0.2);
+INSERT INTO t VALUES (3307, 33, 42, 4.32, 0.2);
+INSERT INTO t VALUES (3308, 33, 79, 4.33, 0.2);
+INSERT INTO t VALUES (3309, 33, 19, 4.34, 0.2);
+INSERT INTO t VALUES (3310, 33, 56, 4.35, 0.2);
+INSERT INTO t VALUES (3311, 33, 93, 4.36, 0.2);
+INSERT INTO t VALUES (3312, 33, 33, 4.37, 0.2);
+INSERT INTO t VALUES (3313, 33, 70, 4.38, 0.2);
+INSERT INTO t VALUES (3314, 33, 10, 4.39, 0.2);
+INSERT INTO t VALUES (3315, 33, 47, 4.40, 0.2);
+INSERT INTO t VALUES (3316, 33, 84, 4.41, 0.2);
+INSERT INTO t VALUES (3317, 33, 24, 4.42, 0.2);
+INSERT INTO t VALUES (3318, 33, 61, 4.43, 0.2);
+INSERT INTO t VALUES (3319, 33, 1, 4.44, 0.2);
+INSERT INTO t VALUES (3320, 33, 38, 4.45, 0.2);
+INSERT INTO t VALUES (3321, 33, 75, 4.46, 0.2);
+INSERT INTO t VALUES (3322, 33, 15, 4.47, 0.2);
+INSERT INTO t VALUES (3323, 33, 52, 4.48, 0.2);
+INSERT INTO t VALUES (3324, 33, 89, 4.49, 0.2);
+INSERT INTO t VALUES (3325, 33, 29, 4.50, 0.2);
+INSERT INTO t VALUES (3326, 33, 66, 4.51, 0.2);
+INSERT INTO t VALUES (3327, 33, 6, 4.52, 0.2);
+INSERT INTO t VALUES (3328, 33, 43, 4.53, 0.2);
+INSERT INTO t VALUES (3329, 33, 80, 4.54, 0.2);
+INSERT INTO t VALUES (3330, 33, 20, 4.55, 0.2);
+INSERT INTO t VALUES (3331, 33, 57, 4.56, 0.2);
+INSERT INTO t VALUES (3332, 33, 94, 4.57, 0.2);
+INSERT INTO t VALUES (3333, 33, 34, 4.58, 0.2);
+INSERT INTO t VALUES (3334, 33, 71, 4.59, 0.2);
+INSERT INTO t VALUES (3335, 33, 11, 4.60, 0.2);
+INSERT INTO t VALUES (3336, 33, 48, 4.61, 0.2);
+INSERT INTO t VALUES (3337, 33, 85, 4.62, 0.2);
+INSERT INTO t VALUES (3338, 33, 25, 4.63, 0.2);
+INSERT INTO t VALUES (3339, 33, 62, 4.64, 0.2);
+INSERT INTO t VALUES (3340, 33, 2, 4.65, 0.2);
+INSERT INTO t VALUES (3341, 33, 39, 4.66, 0.2);
+INSERT INTO t VALUES (3342, 33, 76, 4.67, 0.2);
+INSERT INTO t VALUES (3343, 33, 16, 4.68, 0.2);
+INSERT INTO t VALUES (3344, 33, 53, 4.69, 0.2);
+INSERT INTO t VALUES (3345, 33, 90, 4.70, 0.2);
+INSERT INTO t VALUES (3346, 33, 30, 4.71, 0.2);
+INSERT INTO t VALUES (3347, 33, 67, 4.72, 0.2);
+INSERT INTO t VALUES (3348, 33, 7, 4.73, 0.2);
+INSERT INTO t VALUES (3349, 33, 44, 4.74, 0.2);
+INSERT INTO t VALUES (3350, 33, 81, 4.75, 0.2);
+INSERT INTO t VALUES (3351, 33, 21, 4.76, 0.2);
+INSERT INTO t VALUES (3352, 33, 58, 4.77, 0.2);
+INSERT INTO t VALUES (3353, 33, 95, 4.78, 0.2);
+INSERT INTO t VALUES (3354, 33, 35, 4.79, 0.2);
+INSERT INTO t VALUES (3355, 33, 72, 4.80, 0.2);
+INSERT INTO t VALUES (3356, 33, 12, 4.81, 0.2);
+INSERT INTO t VALUES (3357, 33, 49, 4.82, 0.2);
+INSERT INTO t VALUES (3358, 33, 86, 4.83, 0.2);
+INSERT INTO t VALUES (3359, 33, 26, 4.84, 0.2);
+INSERT INTO t VALUES (3360, 33, 63, 4.85, 0.2);
+INSERT INTO t VALUES (3361, 33, 3, 4.86, 0.2);
+INSERT INTO t VALUES (3362, 33, 40, 4.87, 0.2);
+INSERT INTO t VALUES (3363, 33, 77, 4.88, 0.2);
+INSERT INTO t VALUES (3364, 33, 17, 4.89, 0.2);
+INSERT INTO t VALUES (3365, 33, 54, 4.90, 0.2);
+INSERT INTO t VALUES (3366, 33, 91, 4.91, 0.2);
+INSERT INTO t VALUES (3367, 33, 31, 4.92, 0.2);
+INSERT INTO t VALUES (3368, 33, 68, 4.93, 0.2);
+INSERT INTO t VALUES (3369, 33, 8, 4.94, 0.2);
+INSERT INTO t VALUES (3370, 33, 45, 4.95, 0.2);
+INSERT INTO t VALUES (3371, 33, 82, 4.96, 0.2);
+INSERT INTO t VALUES (3372, 33, 22, 4.97, 0.2);
+INSERT INTO t VALUES (3373, 33, 59, 4.98, 0.2);
+INSERT INTO t VALUES (3374, 33, 96, 4.99, 0.2);
+INSERT INTO t VALUES (3375, 33, 36, 5.00, 0.2);
+INSERT INTO t VALUES (3376, 33, 73, 5.01, 0.2);
+INSERT INTO t VALUES (3377, 33, 13, 5.02, 0.2);
+INSERT INTO t VALUES (3378, 33, 50, 5.03, 0.2);
+INSERT INTO t VALUES (3379, 33, 87, 5.04, 0.2);
+INSERT INTO t VALUES (3380, 33, 27, 5.05, 0.2);
+INSERT INTO t VALUES (3381, 33, 64, 5.06, 0.2);
+INSERT INTO t VALUES (3382, 33, 4, 5.07, 0.2);
+INSERT INTO t VALUES (3383, 33, 41, 5.08, 0.2);
+INSERT INTO t VALUES (3384, 33, 78, 5.09, 0.2);
+INSERT INTO t VALUES (3385, 33, 18, 5.10, 0.2);
+INSERT INTO t VALUES (3386, 33, 55, 5.11, 0.2);
+INSERT INTO t VALUES (3387, 33, 92, 5.12, 0.2);
+INSERT INTO t VALUES (3388, 33, 32, 5.13, 0.2);
+INSERT INTO t VALUES (3389, 33, 69, 5.14, 0.2);
+INSERT INTO t VALUES (3390, 33, 9, 5.15, 0.2);
+INSERT INTO t VALUES (3391, 33, 46, 5.16, 0.2);
+INSERT INTO t VALUES (3392, 33, 83, 5.17, 0.2);
+INSERT INTO t VALUES (3393, 33, 23, 5.18, 0.2);
+INSERT INTO t VALUES (3394, 33, 60, 5.19, 0.2);
+INSERT INTO t VALUES (3395, 33, 0, 5.20, 0.2);
+INSERT INTO t VALUES (3396, 33, 37, 5.21, 0.2);
+INSERT INTO t VALUES (3397, 33, 74, 5.22, 0.2);
+INSERT INTO t VALUES (3398, 33, 14, 5.23, 0.2);
+INSERT INTO t VALUES (3399, 33, 51, 5.24, 0.2);
+INSERT INTO t VALUES (3400, 34, 88, 5.25, 0.2);
+INSERT INTO t VALUES (3401, 34, 28, 5.26, 0.2);
+INSERT INTO t VALUES (3402, 34, 65, 5.27, 0.2);
+INSERT INTO t VALUES (3403, 34, 5, 5.28, 0.2);
+INSERT INTO t VALUES (3404, 34, 42, 5.29, 0.2);
+INSERT INTO t VALUES (3405, 34, 79, 5.30, 0.2);
+INSERT INTO t VALUES (3406, 34, 19, 5.31, 0.2);
+INSERT INTO t VALUES (3407, 34, 56, 5.32, 0.2);
+INSERT INTO t VALUES (3408, 34, 93, 5.33, 0.2);
+INSERT INTO t VALUES (3409, 34, 33, 5.34, 0.2);
+INSERT INTO t VALUES (3410, 34, 70, 5.35, 0.2);
+INSERT INTO t VALUES (3411, 34, 10, 5.36, 0.2);
+INSERT INTO t VALUES (3412, 34, 47, 5.37, 0.2);
+INSERT INTO t VALUES (3413, 34, 84, 5.38, 0.2);
+INSERT INTO t VALUES (3414, 34, 24, 5.39, 0.2);
+INSERT INTO t VALUES (3415, 34, 61, 5.40, 0.2);
+INSERT INTO t VALUES (3416, 34, 1, 5.41, 0.2);
+INSERT INTO t VALUES (3417, 34, 38, 5.42, 0.2);
+INSERT INTO t VALUES (3418, 34, 75, 5.43, 0.2);
+INSERT INTO t VALUES (3419, 34, 15, 5.44, 0.2);
+INSERT INTO t VALUES (3420, 34, 52, 5.45, 0.2);
+INSERT INTO t VALUES (3421, 34, 89, 5.46, 0.2);
+INSERT INTO t VALUES (3422, 34, 29, 5.47, 0.2);
+INSERT INTO t VALUES (3423, 34, 66, 5.48, 0.2);
+INSERT INTO t VALUES (3424, 34, 6, 5.49, 0.2);
+INSERT INTO t VALUES (3425, 34, 43, 5.50, 0.2);
+INSERT INTO t VALUES (3426, 34, 80, 5.51, 0.2);
+INSERT INTO t VALUES (3427, 34, 20, 5.52, 0.2);
+INSERT INTO t VALUES (3428, 34, 57, 5.53, 0.2);
+INSERT INTO t VALUES (3429, 34, 94, 5.54, 0.2);
+INSERT INTO t VALUES (3430, 34, 34, 5.55, 0.2);
+INSERT INTO t VALUES (3431, 34, 71, 5.56, 0.2);
+INSERT INTO t VALUES (3432, 34, 11, 5.57, 0.2);
+INSERT INTO t VALUES (3433, 34, 48, 5.58, 0.2);
+INSERT INTO t VALUES (3434, 34, 85, 5.59, 0.2);
+INSERT INTO t VALUES (3435, 34, 25, 5.60, 0.2);
+INSERT INTO t VALUES (3436, 34, 62, 5.61, 0.2);
+INSERT INTO t VALUES (3437, 34, 2, 5.62, 0.2);
+INSERT INTO t VALUES (3438, 34, 39, 5.63, 0.2);
+INSERT INTO t VALUES (3439, 34, 76, 5.64, 0.2);
+INSERT INTO t VALUES (3440, 34, 16, 5.65, 0.2);
+INSERT INTO t VALUES (3441, 34, 53, 5.66, 0.2);
+INSERT INTO t VALUES (3442, 34, 90, 5.67, 0.2);
+INSERT INTO t VALUES (3443, 34, 30, 5.68, 0.2);
+INSERT INTO t VALUES (3444, 34, 67, 5.69, 0.2);
+INSERT INTO t VALUES (3445, 34, 7, 5.70, 0.2);
+INSERT INTO t VALUES (3446, 34, 44, 5.71, 0.2);
+INSERT INTO t VALUES (3447, 34, 81, 5.72, 0.2);
+INSERT INTO t VALUES (3448, 34, 21, 5.73, 0.2);
+INSERT INTO t VALUES (3449, 34, 58, 5.74, 0.2);
+INSERT INTO t VALUES (3450, 34, 95, 5.75, 0.2);
+INSERT INTO t VALUES (3451, 34, 35, 5.76, 0.2);
+INSERT INTO t VALUES (3452, 34, 72, 5.77, 0.2);
+INSERT INTO t VALUES (3453, 34, 12, 5.78, 0.2);
+INSERT INTO t VALUES (3454, 34, 49, 5.79, 0.2);
+INSERT INTO t VALUES (3455, 34, 86, 5.80, 0.2);
+INSERT INTO t VALUES (3456, 34, 26, 5.81, 0.2);
+INSERT INTO t VALUES (3457, 34, 63, 5.82, 0.2);
+INSERT INTO t VALUES (3458, 34, 3, 5.83, 0.2);
+INSERT INTO t VALUES (3459, 34, 40, 5.84, 0.2);
+INSERT INTO t VALUES (3460, 34, 77, 5.85, 0.2);
+INSERT INTO t VALUES (3461, 34, 17, 5.86, 0.2);
+INSERT INTO t VALUES (3462, 34, 54, 5.87, 0.2);
+INSERT INTO t VALUES (3463, 34, 91, 5.88, 0.2);
+INSERT INTO t VALUES (3464, 34, 31, 5.89, 0.2);
+INSERT INTO t VALUES (3465, 34, 68, 5.90, 0.2);
+INSERT INTO t VALUES (3466, 34, 8, 5.91, 0.2);
+INSERT INTO t VALUES (3467, 34, 45, 5.92, 0.2);
+INSERT INTO t VALUES (3468, 34, 82, 5.93, 0.2);
+INSERT INTO t VALUES (3469, 34, 22, 5.94, 0.2);
+INSERT INTO t VALUES (3470, 34, 59, 5.95, 0.2);
+INSERT INTO t VALUES (3471, 34, 96, 5.96, 0.2);
+INSERT INTO t VALUES (3472, 34, 36, 5.97, 0.2);
+INSERT INTO t VALUES (3473, 34, 73, 5.98, 0.2);
+INSERT INTO t VALUES (3474, 34, 13, 5.99, 0.2);
+INSERT INTO t VALUES (3475, 34, 50, 6.00, 0.2);
+INSERT INTO t VALUES (3476, 34, 87, 6.01, 0.2);
+INSERT INTO t VALUES (3477, 34, 27, 6.02, 0.2);
+INSERT INTO t VALUES (3478, 34, 64, 6.03, 0.2);
+INSERT INTO t VALUES (3479, 34, 4, 6.04, 0.2);
+INSERT INTO t VALUES (3480, 34, 41, 6.05, 0.2);
+INSERT INTO t VALUES (3481, 34, 78, 6.06, 0.2);
+INSERT INTO t VALUES (3482, 34, 18, 6.07, 0.2);
+INSERT INTO t VALUES (3483, 34, 55, 6.08, 0.2);
+INSERT INTO t VALUES (3484, 34, 92, 6.09, 0.2);
+INSERT INTO t VALUES (3485, 34, 32, 6.10, 0.2);
+INSERT INTO t VALUES (3486, 34, 69, 6.11, 0.2);
+INSERT INTO t VALUES (3487, 34, 9, 6.12, 0.2);
+INSERT INTO t VALUES (3488, 34, 46, 6.13, 0.2);
+INSERT INTO t VALUES (3489, 34, 83, 6.14, 0.2);
+INSERT INTO t VALUES (3490, 34, 23, 6.15, 0.2);
+INSERT INTO t VALUES (3491, 34, 60, 6.16, 0.2);
+INSERT INTO t VALUES (3492, 34, 0, 6.17, 0.2);
+INSERT INTO t VALUES (3493, 34, 37, 6.18, 0.2);
+INSERT INTO t VALUES (3494, 34, 74, 6.19, 0.2);
+INSERT INTO t VALUES (3495, 34, 14, 6.20, 0.2);
+INSERT INTO t VALUES (3496, 34, 51, 6.21, 0.2);
+INSERT INTO t VALUES (3497, 34, 88, 6.22, 0.2);
+INSERT INTO t VALUES (3498, 34, 28, 6.23, 0.2);
+INSERT INTO t VALUES (3499, 34, 65, 6.24, 0.2);
+INSERT INTO t VALUES (3500, 35, 5, 6.25, 0.2);
+INSERT INTO t VALUES (3501, 35, 42, 6.26, 0.2);
+INSERT INTO t VALUES (3502, 35, 79, 6.27, 0.2);
+INSERT INTO t VALUES (3503, 35, 19, 6.28, 0.2);
+INSERT INTO t VALUES (3504, 35, 56, 6.29, 0.2);
+INSERT INTO t VALUES (3505, 35, 93, 6.30, 0.2);
+INSERT INTO t VALUES (3506, 35, 33, 6.31, 0.2);
+INSERT INTO t VALUES (3507, 35, 70, 6.32, 0.2);
+INSERT INTO t VALUES (3508, 35, 10, 6.33, 0.2);
+INSERT INTO t VALUES (3509, 35, 47, 6.34, 0.2);
+INSERT INTO t VALUES (3510, 35, 84, 6.35, 0.2);
+INSERT INTO t VALUES (3511, 35, 24, 6.36, 0.2);
+INSERT INTO t VALUES (3512, 35, 61, 6.37, 0.2);
+INSERT INTO t VALUES (3513, 35, 1, 6.38, 0.2);
+INSERT INTO t VALUES (3514, 35, 38, 6.39, 0.2);
+INSERT INTO t VALUES (3515, 35, 75, 6.40, 0.2);
+INSERT INTO t VALUES (3516, 35, 15, 6.41, 0.2);
+INSERT INTO t VALUES (3517, 35, 52, 6.42, 0.2);
+INSERT INTO t VALUES (3518, 35, 89, 6.43, 0.2);
+INSERT INTO t VALUES (3519, 35, 29, 6.44, 0.2);
+INSERT INTO t VALUES (3520, 35, 66, 6.45, 0.2);
+INSERT INTO t VALUES (3521, 35, 6, 6.46, 0.2);
+INSERT INTO t VALUES (3522, 35, 43, 6.47, 0.2);
+INSERT INTO t VALUES (3523, 35, 80, 6.48, 0.2);
+INSERT INTO t VALUES (3524, 35, 20, 6.49, 0.2);
+INSERT INTO t VALUES (3525, 35, 57, 6.50, 0.2);
+INSERT INTO t VALUES (3526, 35, 94, 6.51, 0.2);
+INSERT INTO t VALUES (3527, 35, 34, 6.52, 0.2);
+INSERT INTO t VALUES (3528, 35, 71, 6.53, 0.2);
+INSERT INTO t VALUES (3529, 35, 11, 6.54, 0.2);
+INSERT INTO t VALUES (3530, 35, 48, 6.55, 0.2);
+INSERT INTO t VALUES (3531, 35, 85, 6.56, 0.2);
+INSERT INTO t VALUES (3532, 35, 25, 6.57, 0.2);
+INSERT INTO t VALUES (3533, 35, 62, 6.58, 0.2);
+INSERT INTO t VALUES (3534, 35, 2, 6.59, 0.2);
+INSERT INTO t VALUES (3535, 35, 39, 6.60, 0.2);
+INSERT INTO t VALUES (3536, 35, 76, 6.61, 0.2);
+INSERT INTO t VALUES (3537, 35, 16, 6.62, 0.2);
+INSERT INTO t VALUES (3538, 35, 53, 6.63, 0.2);
+INSERT INTO t VALUES (3539, 35, 90, 6.64, 0.2);
+INSERT INTO t VALUES (3540, 35, 30, 6.65, 0.2);
+INSERT INTO t VALUES (3541, 35, 67, 6.66, 0.2);
+INSERT INTO t VALUES (3542, 35, 7, 6.67, 0.2);
+INSERT INTO t VALUES (3543, 35, 44, 6.68, 0.2);
+INSERT INTO t VALUES (3544, 35, 81, 6.69, 0.2);
+INSERT INTO t VALUES (3545, 35, 21, 6.70, 0.2);
+INSERT INTO t VALUES (3546, 35, 58, 6.71, 0.2);
+INSERT INTO t VALUES (3547, 35, 95, 6.72, 0.2);
+INSERT INTO t VALUES (3548, 35, 35, 6.73, 0.2);
+INSERT INTO t VALUES (3549, 35, 72, 6.74, 0.2);
+INSERT INTO t VALUES (3550, 35, 12, 6.75, 0.2);
+INSERT INTO t VALUES (3551, 35, 49, 6.76, 0.2);
+INSERT INTO t VALUES (3552, 35, 86, 6.77, 0.2);
+INSERT INTO t VALUES (3553, 35, 26, 6.78, 0.2);
+INSERT INTO t VALUES (3554, 35, 63, 6.79, 0.2);
+INSERT INTO t VALUES (3555, 35, 3, 6.80, 0.2);
+INSERT INTO t VALUES (3556, 35, 40, 6.81, 0.2);
+INSERT INTO t VALUES (3557, 35, 77, 6.82, 0.2);
+INSERT INTO t VALUES (3558, 35, 17, 6.83, 0.2);
+INSERT INTO t VALUES (3559, 35, 54, 6.84, 0.2);
+INSERT INTO t VALUES (3560, 35, 91, 6.85, 0.2);
+INSERT INTO t VALUES (3561, 35, 31, 6.86, 0.2);
+INSERT INTO t VALUES (3562, 35, 68, 6.87, 0.2);
+INSERT INTO t VALUES (3563, 35, 8, 6.88, 0.2);
+INSERT INTO t VALUES (3564, 35, 45, 6.89, 0.2);
+INSERT INTO t VALUES (3565, 35, 82, 6.90, 0.2);
+INSERT INTO t VALUES (3566, 35, 22, 6.91, 0.2);
+INSERT INTO t VALUES (3567, 35, 59, 6.92, 0.2);
+INSERT INTO t VALUES (3568, 35, 96, 6.93, 0.2);
+INSERT INTO t VALUES (3569, 35, 36, 6.94, 0.2);
+INSERT INTO t VALUES (3570, 35, 73, 6.95, 0.2);
+INSERT INTO t VALUES (3571, 35, 13, 6.96, 0.2);
+INSERT INTO t VALUES (3572, 35, 50, 6.97, 0.2);
+INSERT INTO t VALUES (3573, 35, 87, 6.98, 0.2);
+INSERT INTO t VALUES (3574, 35, 27, 6.99, 0.2);
+INSERT INTO t VALUES (3575, 35, 64, 7.00, 0.2);
+INSERT INTO t VALUES (3576, 35, 4, 7.01, 0.2);
+INSERT INTO t VALUES (3577, 35, 41, 7.02, 0.2);
+INSERT INTO t VALUES (3578, 35, 78, 7.03, 0.2);
+INSERT INTO t VALUES (3579, 35, 18, 7.04, 0.2);
+INSERT INTO t VALUES (3580, 35, 55, 7.05, 0.2);
+INSERT INTO t VALUES (3581, 35, 92, 7.06, 0.2);
+INSERT INTO t VALUES (3582, 35, 32, 7.07, 0.2);
+INSERT INTO t VALUES (3583, 35, 69, 7.08, 0.2);
+INSERT INTO t VALUES (3584, 35, 9, 7.09, 0.2);
+INSERT INTO t VALUES (3585, 35, 46, 7.10, 0.2);
+INSERT INTO t VALUES (3586, 35, 83, 7.11, 0.2);
+INSERT INTO t VALUES (3587, 35, 23, 7.12, 0.2);
+INSERT INTO t VALUES (3588, 35, 60, 7.13, 0.2);
+INSERT INTO t VALUES (3589, 35, 0, 7.14, 0.2);
+INSERT INTO t VALUES (3590, 35, 37, 7.15, 0.2);
+INSERT INTO t VALUES (3591, 35, 74, 7.16, 0.2);
+INSERT INTO t VALUES (3592, 35, 14, 7.17, 0.2);
+INSERT INTO t VALUES (3593, 35, 51, 7.18, 0.2);
+INSERT INTO t VALUES (3594, 35, 88, 7.19, 0.2);
+INSERT INTO t VALUES (3595, 35, 28, 7.20, 0.2);
+INSERT INTO t VALUES (3596, 35, 65, 7.21, 0.2);
+INSERT INTO t VALUES (3597, 35, 5, 7.22, 0.2);
+INSERT INTO t VALUES (3598, 35, 42, 7.23, 0.2);
+INSERT INTO t VALUES (3599, 35, 79, 7.24, 0.2);
+INSERT INTO t VALUES (3600, 36, 19, 7.25, 0.2);
+INSERT INTO t VALUES (3601, 36, 56, 7.26, 0.2);
+INSERT INTO t VALUES (3602, 36, 93, 7.27, 0.2);
+INSERT INTO t VALUES (3603, 36, 33, 7.28, 0.2);
+INSERT INTO t VALUES (3604, 36, 70, 7.29, 0.2);
+INSERT INTO t VALUES (3605, 36, 10, 7.30, 0.2);
+INSERT INTO t VALUES (3606, 36, 47, 7.31, 0.2);
+INSERT INTO t VALUES (3607, 36, 84, 7.32, 0.2);
+INSERT INTO t VALUES (3608, 36, 24, 7.33, 0.2);
+INSERT INTO t VALUES (3609, 36, 61, 7.34, 0.2);
+INSERT INTO t VALUES (3610, 36, 1, 7.35, 0.2);
+INSERT INTO t VALUES (3611, 36, 38, 7.36, 0.2);
+INSERT INTO t VALUES (3612, 36, 75, 7.37, 0.2);
+INSERT INTO t VALUES (3613, 36, 15, 7.38, 0.2);
+INSERT INTO t VALUES (3614, 36, 52, 7.39, 0.2);
+INSERT INTO t VALUES (3615, 36, 89, 7.40, 0.2);
+INSERT INTO t VALUES (3616, 36, 29, 7.41, 0.2);
+INSERT INTO t VALUES (3617, 36, 66, 7.42, 0.2);
+INSERT INTO t VALUES (3618, 36, 6, 7.43, 0.2);
+INSERT INTO t VALUES (3619, 36, 43, 7.44, 0.2);
+INSERT INTO t VALUES (3620, 36, 80, 7.45, 0.2);
+INSERT INTO t VALUES (3621, 36, 20, 7.46, 0.2);
+INSERT INTO t VALUES (3622, 36, 57, 7.47, 0.2);
+INSERT INTO t VALUES (3623, 36, 94, 7.48, 0.2);
+INSERT INTO t VALUES (3624, 36, 34, 7.49, 0.2);
+INSERT INTO t VALUES (3625, 36, 71, 7.50, 0.2);
+INSERT INTO t VALUES (3626, 36, 11, 7.51, 0.2);
+INSERT INTO t VALUES (3627, 36, 48, 7.52, 0.2);
+INSERT INTO t VALUES (3628, 36, 85, 7.53, 0.2);
+INSERT INTO t VALUES (3629, 36, 25, 7.54, 0.2);
+INSERT INTO t VALUES (3630, 36, 62, 7.55, 0.2);
+INSERT INTO t VALUES (3631, 36, 2, 7.56, 0.2);
+INSERT INTO t VALUES (3632, 36, 39, 7.57, 0.2);
+INSERT INTO t VALUES (3633, 36, 76, 7.58, 0.2);
+INSERT INTO t VALUES (3634, 36, 16, 7.59, 0.2);
+INSERT INTO t VALUES (3635, 36, 53, 7.60, 0.2);
+INSERT INTO t VALUES (3636, 36, 90, 7.61, 0.2);
+INSERT INTO t VALUES (3637, 36, 30, 7.62, 0.2);
+INSERT INTO t VALUES (3638, 36, 67, 7.63, 0.2);
+INSERT INTO t VALUES (3639, 36, 7, 7.64, 0.2);
+INSERT INTO t VALUES (3640, 36, 44, 7.65, 0.2);
+INSERT INTO t VALUES (3641, 36, 81, 7.66, 0.2);
+INSERT INTO t VALUES (3642, 36, 21, 7.67, 0.2);
+INSERT INTO t VALUES (3643, 36, 58, 7.68, 0.2);
+INSERT INTO t VALUES (3644, 36, 95, 7.69, 0.2);
+INSERT INTO t VALUES (3645, 36, 35, 7.70, 0.2);
+INSERT INTO t VALUES (3646, 36, 72, 7.71, 0.2);
+INSERT INTO t VALUES (3647, 36, 12, 7.72, 0.2);
+INSERT INTO t VALUES (3648, 36, 49, 7.73, 0.2);
+INSERT INTO t VALUES (3649, 36, 86, 7.74, 0.2);
+INSERT INTO t VALUES (3650, 36, 26, 7.75, 0.2);
+INSERT INTO t VALUES (3651, 36, 63, 7.76, 0.2);
+INSERT INTO t VALUES (3652, 36, 3, 7.77, 0.2);
+INSERT INTO t VALUES (3653, 36, 40, 7.78, 0.2);
+INSERT INTO t VALUES (3654, 36, 77, 7.79, 0.2);
+INSERT INTO t VALUES (3655, 36, 17, 7.80, 0.2);
+INSERT INTO t VALUES (3656, 36, 54, 7.81, 0.2);
+INSERT INTO t VALUES (3657, 36, 91, 7.82, 0.2);
+INSERT INTO t VALUES (3658, 36, 31, 7.83, 0.2);
+INSERT INTO t VALUES (3659, 36, 68, 7.84, 0.2);
+INSERT INTO t VALUES (3660, 36, 8, 7.85, 0.2);
+INSERT INTO t VALUES (3661, 36, 45, 7.86, 0.2);
+INSERT INTO t VALUES (3662, 36, 82, 7.87, 0.2);
+INSERT INTO t VALUES (3663, 36, 22, 7.88, 0.2);
+INSERT INTO t VALUES (3664, 36, 59, 7.89, 0.2);
+INSERT INTO t VALUES (3665, 36, 96, 7.90, 0.2);
+INSERT INTO t VALUES (3666, 36, 36, 7.91, 0.2);
+INSERT INTO t VALUES (3667, 36, 73, 7.92, 0.2);
+INSERT INTO t VALUES (3668, 36, 13, 7.93, 0.2);
+INSERT INTO t VALUES (3669, 36, 50, 7.94, 0.2);
+INSERT INTO t VALUES (3670, 36, 87, 7.95, 0.2);
+INSERT INTO t VALUES (3671, 36, 27, 7.96, 0.2);
+INSERT INTO t VALUES (3672, 36, 64, 7.97, 0.2);
+INSERT INTO t VALUES (3673, 36, 4, 7.98, 0.2);
+INSERT INTO t VALUES (3674, 36, 41, 7.99, 0.2);
+INSERT INTO t VALUES (3675, 36, 78, 8.00, 0.2);
+INSERT INTO t VALUES (3676, 36, 18, 8.01, 0.2);
+INSERT INTO t VALUES (3677, 36, 55, 8.02, 0.2);
+INSERT INTO t VALUES (3678, 36, 92, 8.03, 0.2);
+INSERT INTO t VALUES (3679, 36, 32, 8.04, 0.2);
+INSERT INTO t VALUES (3680, 36, 69, 8.05, 0.2);
+INSERT INTO t VALUES (3681, 36, 9, 8.06, 0.2);
+INSERT INTO t VALUES (3682, 36, 46, 8.07, 0.2);
+INSERT INTO t VALUES (3683, 36, 83, 8.08, 0.2);
+INSERT INTO t VALUES (3684, 36, 23, 8.09, 0.2);
+INSERT INTO t VALUES (3685, 36, 60, 8.10, 0.2);
+INSERT INTO t VALUES (3686, 36, 0, 8.11, 0.2);
+INSERT INTO t VALUES (3687, 36, 37, 8.12, 0.2);
+INSERT INTO t VALUES (3688, 36, 74, 8.13, 0.2);
+INSERT INTO t VALUES (3689, 36, 14, 8.14, 0.2);
+INSERT INTO t VALUES (3690, 36, 51, 8.15, 0.2);
+INSERT INTO t VALUES (3691, 36, 88, 8.16, 0.2);
+INSERT INTO t VALUES (3692, 36, 28, 8.17, 0.2);
+INSERT INTO t VALUES (3693, 36, 65, 8.18, 0.2);
+INSERT INTO t VALUES (3694, 36, 5, 8.19, 0.2);
+INSERT INTO t VALUES (3695, 36, 42, 8.20, 0.2);
+INSERT INTO t VALUES (3696, 36, 79, 8.21, 0.2);
+INSERT INTO t VALUES (3697, 36, 19, 8.22, 0.2);
+INSERT INTO t VALUES (3698, 36, 56, 8.23, 0.2);
+INSERT INTO t VALUES (3699, 36, 93, 8.24, 0.2);
+INSERT INTO t VALUES (3700, 37, 33, 8.25, 0.2);
+INSERT INTO t VALUES (3701, 37, 70, 8.26, 0.2);
+INSERT INTO t VALUES (3702, 37, 10, 8.27, 0.2);
+INSERT INTO t VALUES (3703, 37, 47, 8.28, 0.2);
+INSERT INTO t VALUES (3704, 37, 84, 8.29, 0.2);
+INSERT INTO t VALUES (3705, 37, 24, 8.30, 0.2);
+INSERT INTO t VALUES (3706, 37, 61, 8.31, 0.2);
+INSERT INTO t VALUES (3707, 37, 1, 8.32, 0.2);
+INSERT INTO t VALUES (3708, 37, 38, 8.33, 0.2);
+INSERT INTO t VALUES (3709, 37, 75, 8.34, 0.2);
+INSERT INTO t VALUES (3710, 37, 15, 8.35, 0.2);
+INSERT INTO t VALUES (3711, 37, 52, 8.36, 0.2);
+INSERT INTO t VALUES (3712, 37, 89, 8.37, 0.2);
+INSERT INTO t VALUES (3713, 37, 29, 8.38, 0.2);
+INSERT INTO t VALUES (3714, 37, 66, 8.39, 0.2);
+INSERT INTO t VALUES (3715, 37, 6, 8.40, 0.2);
+INSERT INTO t VALUES (3716, 37, 43, 8.41, 0.2);
+INSERT INTO t VALUES (3717, 37, 80, 8.42, 0.2);
+INSERT INTO t VALUES (3718, 37, 20, 8.43, 0.2);
+INSERT INTO t VALUES (3719, 37, 57, 8.44, 0.2);
+INSERT INTO t VALUES (3720, 37, 94, 8.45, 0.2);
+INSERT INTO t VALUES (3721, 37, 34, 8.46, 0.2);
+INSERT INTO t VALUES (3722, 37, 71, 8.47, 0.2);
+INSERT INTO t VALUES (3723, 37, 11, 8.48, 0.2);
+INSERT INTO t VALUES (3724, 37, 48, 8.49, 0.2);
+INSERT INTO t VALUES (3725, 37, 85, 8.50, 0.2);
+INSERT INTO t VALUES (3726, 37, 25, 8.51, 0.2);
+INSERT INTO t VALUES (3727, 37, 62, 8.52, 0.2);
+INSERT INTO t VALUES (3728, 37, 2, 8.53, 0.2);
+INSERT INTO t VALUES (3729, 37, 39, 8.54, 0.2);
+INSERT INTO t VALUES (3730, 37, 76, 8.55, 0.2);
+INSERT INTO t VALUES (3731, 37, 16, 8.56, 0.2);
+INSERT INTO t VALUES (3732, 37, 53, 8.57, 0.2);
+INSERT INTO t VALUES (3733, 37, 90, 8.58, 0.2);
+INSERT INTO t VALUES (3734, 37, 30, 8.59, 0.2);
+INSERT INTO t VALUES (3735, 37, 67, 8.60, 0.2);
+INSERT INTO t VALUES (3736, 37, 7, 8.61, 0.2);
+INSERT INTO t VALUES (3737, 37, 44, 8.62, 0.2);
+INSERT INTO t VALUES (3738, 37, 81, 8.63, 0.2);
+INSERT INTO t VALUES (3739, 37, 21, 8.64, 0.2);
+INSERT INTO t VALUES (3740, 37, 58, 8.65, 0.2);
+INSERT INTO t VALUES (3741, 37, 95, 8.66, 0.2);
+INSERT INTO t VALUES (3742, 37, 35, 8.67, 0.2);
+INSERT INTO t VALUES (3743, 37, 72, 8.68, 0.2);
+INSERT INTO t VALUES (3744, 37, 12, 8.69, 0.2);
+INSERT INTO t VALUES (3745, 37, 49, 8.70, 0.2);
+INSERT INTO t VALUES (3746, 37, 86, 8.71, 0.2);
+INSERT INTO t VALUES (3747, 37, 26, 8.72, 0.2);
+INSERT INTO t VALUES (3748, 37, 63, 8.73, 0.2);
+INSERT INTO t VALUES (3749, 37, 3, 8.74, 0.2);
+INSERT INTO t VALUES (3750, 37, 40, 8.75, 0.2);
+INSERT INTO t VALUES (3751, 37, 77, 8.76, 0.2);
+INSERT INTO t VALUES (3752, 37, 17, 8.77, 0.2);
+INSERT INTO t VALUES (3753, 37, 54, 8.78, 0.2);
+INSERT INTO t VALUES (3754, 37, 91, 8.79, 0.2);
+INSERT INTO t VALUES (3755, 37, 31, 8.80, 0.2);
+INSERT INTO t VALUES (3756, 37, 68, 8.81, 0.2);
+INSERT INTO t VALUES (3757, 37, 8, 8.82, 0.2);
+INSERT INTO t VALUES (3758, 37, 45, 8.83, 0.2);
+INSERT INTO t VALUES (3759, 37, 82, 8.84, 0.2);
+INSERT INTO t VALUES (3760, 37, 22, 8.85, 0.2);
+INSERT INTO t VALUES (3761, 37, 59, 8.86, 0.2);
+INSERT INTO t VALUES (3762, 37, 96, 8.87, 0.2);
+INSERT INTO t VALUES (3763, 37, 36, 8.88, 0.2);
+INSERT INTO t VALUES (3764, 37, 73, 8.89, 0.2);
+INSERT INTO t VALUES (3765, 37, 13, 8.90, 0.2);
+INSERT INTO t VALUES (3766, 37, 50, 8.91, 0.2);
+INSERT INTO t VALUES (3767, 37, 87, 8.92, 0.2);
+INSERT INTO t VALUES (3768, 37, 27, 8.93, 0.2);
+INSERT INTO t VALUES (3769, 37, 64, 8.94, 0.2);
+INSERT INTO t VALUES (3770, 37, 4, 8.95, 0.2);
+INSERT INTO t VALUES (3771, 37, 41, 8.96, 0.2);
+INSERT INTO t VALUES (3772, 37, 78, 8.97, 0.2);
+INSERT INTO t VALUES (3773, 37, 18, 8.98, 0.2);
+INSERT INTO t VALUES (3774, 37, 55, 8.99, 0.2);
+INSERT INTO t VALUES (3775, 37, 92, 9.00, 0.2);
+INSERT INTO t VALUES (3776, 37, 32, 9.01, 0.2);
+INSERT INTO t VALUES (3777, 37, 69, 9.02, 0.2);
+INSERT INTO t VALUES (3778, 37, 9, 9.03, 0.2);
+INSERT INTO t VALUES (3779, 37, 46, 9.04, 0.2);
+INSERT INTO t VALUES (3780, 37, 83, 9.05, 0.2);
+INSERT INTO t VALUES (3781, 37, 23, 9.06, 0.2);
+INSERT INTO t VALUES (3782, 37, 60, 9.07, 0.2);
+INSERT INTO t VALUES (3783, 37, 0, 9.08, 0.2);
+INSERT INTO t VALUES (3784, 37, 37, 9.09, 0.2);
+INSERT INTO t VALUES (3785, 37, 74, 9.10, 0.2);
+INSERT INTO t VALUES (3786, 37, 14, 9.11, 0.2);
+INSERT INTO t VALUES (3787, 37, 51, 9.12, 0.2);
+INSERT INTO t VALUES (3788, 37, 88, 9.13, 0.2);
+INSERT INTO t VALUES (3789, 37, 28, 9.14, 0.2);
+INSERT INTO t VALUES (3790, 37, 65, 9.15, 0.2);
+INSERT INTO t VALUES (3791, 37, 5, 9.16, 0.2);
+INSERT INTO t VALUES (3792, 37, 42, 9.17, 0.2);
+INSERT INTO t VALUES (3793, 37, 79, 9.18, 0.2);
+INSERT INTO t VALUES (3794, 37, 19, 9.19, 0.2);
+INSERT INTO t VALUES (3795, 37, 56, 9.20, 0.2);
+INSERT INTO t VALUES (3796, 37, 93, 9.21, 0.2);
+INSERT INTO t VALUES (3797, 37, 33, 9.22, 0.2);
+INSERT INTO t VALUES (3798, 37, 70, 9.23, 0.2);
+INSERT INTO t VALUES (3799, 37, 10, 9.24, 0.2);
+INSERT INTO t VALUES (3800, 38, 47, 9.25, 0.2);
+INSERT INTO t VALUES (3801, 38, 84, 9.26, 0.2);
+INSERT INTO t VALUES (3802, 38, 24, 9.27, 0.2);
+INSERT INTO t VALUES (3803, 38, 61, 9.28, 0.2);
+INSERT INTO t VALUES (3804, 38, 1, 9.29, 0.2);
+INSERT INTO t VALUES (3805, 38, 38, 9.30, 0.2);
+INSERT INTO t VALUES (3806, 38, 75, 9.31, 0.2);
+INSERT INTO t VALUES (3807, 38, 15, 9.32, 0.2);
+INSERT INTO t VALUES (3808, 38, 52, 9.33, 0.2);
+INSERT INTO t VALUES (3809, 38, 89, 9.34, 0.2);
+INSERT INTO t VALUES (3810, 38, 29, 9.35, 0.2);
+INSERT INTO t VALUES (3811, 38, 66, 9.36, 0.2);
+INSERT INTO t VALUES (3812, 38, 6, 9.37, 0.2);
+INSERT INTO t VALUES (3813, 38, 43, 9.38, 0.2);
+INSERT INTO t VALUES (3814, 38, 80, 9.39, 0.2);
+INSERT INTO t VALUES (3815, 38, 20, 9.40, 0.2);
+INSERT INTO t VALUES (3816, 38, 57, 9.41, 0.2);
+INSERT INTO t VALUES (3817, 38, 94, 9.42, 0.2);
+INSERT INTO t VALUES (3818, 38, 34, 9.43, 0.2);
+INSERT INTO t VALUES (3819, 38, 71, 9.44, 0.2);
+INSERT INTO t VALUES (3820, 38, 11, 9.45, 0.2);
+INSERT INTO t VALUES (3821, 38, 48, 9.46, 0.2);
+INSERT INTO t VALUES (3822, 38, 85, 9.47, 0.2);
+INSERT INTO t VALUES (3823, 38, 25, 9.48, 0.2);
+INSERT INTO t VALUES (3824, 38, 62, 9.49, 0.2);
+INSERT INTO t VALUES (3825, 38, 2, 9.50, 0.2);
+INSERT INTO t VALUES (3826, 38, 39, 9.51, 0.2);
+INSERT INTO t VALUES (3827, 38, 76, 9.52, 0.2);
+INSERT INTO t VALUES (3828, 38, 16, 9.53, 0.2);
+INSERT INTO t VALUES (3829, 38, 53, 9.54, 0.2);
+INSERT INTO t VALUES (3830, 38, 90, 9.55, 0.2);
+INSERT INTO t VALUES (3831, 38, 30, 9.56, 0.2);
+INSERT INTO t VALUES (3832, 38, 67, 9.57, 0.2);
+INSERT INTO t VALUES (3833, 38, 7, 9.58, 0.2);
+INSERT INTO t VALUES (3834, 38, 44, 9.59, 0.2);
+INSERT INTO t VALUES (3835, 38, 81, 9.60, 0.2);
+INSERT INTO t VALUES (3836, 38, 21, 9.61, 0.2);
+INSERT INTO t VALUES (3837, 38, 58, 9.62, 0.2);
+INSERT INTO t VALUES (3838, 38, 95, 9.63, 0.2);
+INSERT INTO t VALUES (3839, 38, 35, 9.64, 0.2);
+INSERT INTO t VALUES (3840, 38, 72, 9.65, 0.2);
+INSERT INTO t VALUES (3841, 38, 12, 9.66, 0.2);
+INSERT INTO t VALUES (3842, 38, 49, 9.67, 0.2);
+INSERT INTO t VALUES (3843, 38, 86, 9.68, 0.2);
+INSERT INTO t VALUES (3844, 38, 26, 9.69, 0.2);
+INSERT INTO t VALUES (3845, 38, 63, 9.70, 0.2);
+INSERT INTO t VALUES (3846, 38, 3, 9.71, 0.2);
+INSERT INTO t VALUES (3847, 38, 40, 9.72, 0.2);
+INSERT INTO t VALUES (3848, 38, 77, 9.73, 0.2);
+INSERT INTO t VALUES (3849, 38, 17, 9.74, 0.2);
+INSERT INTO t VALUES (3850, 38, 54, 9.75, 0.2);
+INSERT INTO t VALUES (3851, 38, 91, 9.76, 0.2);
+INSERT INTO t VALUES (3852, 38, 31, 9.77, 0.2);
+INSERT INTO t VALUES (3853, 38, 68, 9.78, 0.2);
+INSERT INTO t VALUES (3854, 38, 8, 9.79, 0.2);
+INSERT INTO t VALUES (3855, 38, 45, 9.80, 0.2);
+INSERT INTO t VALUES (3856, 38, 82, 9.81, 0.2);
+INSERT INTO t VALUES (3857, 38, 22, 9.82, 0.2);
+INSERT INTO t VALUES (3858, 38, 59, 9.83, 0.2);
+INSERT INTO t VALUES (3859, 38, 96, 9.84, 0.2);
+INSERT INTO t VALUES (3860, 38, 36, 9.85, 0.2);
+INSERT INTO t VALUES (3861, 38, 73, 9.86, 0.2);
+INSERT INTO t VALUES (3862, 38, 13, 9.87, 0.2);
+INSERT INTO t VALUES (3863, 38, 50, 9.88, 0.2);
+INSERT INTO t VALUES (3864, 38, 87, 9.89, 0.2);
+INSERT INTO t VALUES (3865, 38, 27, 9.90, 0.2);
+INSERT INTO t VALUES (3866, 38, 64, 9.91, 0.2);
+INSERT INTO t VALUES (3867, 38, 4, 9.92, 0.2);
+INSERT INTO t VALUES (3868, 38, 41, 9.93, 0.2);
+INSERT INTO t VALUES (3869, 38, 78, 9.94, 0.2);
+INSERT INTO t VALUES (3870, 38, 18, 9.95, 0.2);
+INSERT INTO t VALUES (3871, 38, 55, 9.96, 0.2);
+INSERT INTO t VALUES (3872, 38, 92, 9.97, 0.2);
+INSERT INTO t VALUES (3873, 38, 32, 9.98, 0.2);
+INSERT INTO t VALUES (3874, 38, 69, 9.99, 0.2);
+INSERT INTO t VALUES (3875, 38, 9, 10.00, 0.2);
+INSERT INTO t VALUES (3876, 38, 46, 10.01, 0.2);
+INSERT INTO t VALUES (3877, 38, 83, 10.02, 0.2);
+INSERT INTO t VALUES (3878, 38, 23, 10.03, 0.2);
+INSERT INTO t VALUES (3879, 38, 60, 10.04, 0.2);
+INSERT INTO t VALUES (3880, 38, 0, 10.05, 0.2);
+INSERT INTO t VALUES (3881, 38, 37, 10.06, 0.2);
+INSERT INTO t VALUES (3882, 38, 74, 10.07, 0.2);
+INSERT INTO t VALUES (3883, 38, 14, 10.08, 0.2);
+INSERT INTO t VALUES (3884, 38, 51, 10.09, 0.2);
+INSERT INTO t VALUES (3885, 38, 88, 10.10, 0.2);
+INSERT INTO t VALUES (3886, 38, 28, 10.11, 0.2);
+INSERT INTO t VALUES (3887, 38, 65, 10.12, 0.2);
+INSERT INTO t VALUES (3888, 38, 5, 10.13, 0.2);
+INSERT INTO t VALUES (3889, 38, 42, 10.14, 0.2);
+INSERT INTO t VALUES (3890, 38, 79, 10.15, 0.2);
+INSERT INTO t VALUES (3891, 38, 19, 10.16, 0.2);
+INSERT INTO t VALUES (3892, 38, 56, 10.17, 0.2);
+INSERT INTO t VALUES (3893, 38, 93, 10.18, 0.2);
+INSERT INTO t VALUES (3894, 38, 33, 10.19, 0.2);
+INSERT INTO t VALUES (3895, 38, 70, 10.20, 0.2);
+INSERT INTO t VALUES (3896, 38, 10, 10.21, 0.2);
+INSERT INTO t VALUES (3897, 38, 47, 10.22, 0.2);
+INSERT INTO t VALUES (3898, 38, 84, 10.23, 0.2);
+INSERT INTO t VALUES (3899, 38, 24, 10.24, 0.2);
+INSERT INTO t VALUES (3900, 39, 61, 10.25, 0.2);
+INSERT INTO t VALUES (3901, 39, 1, 10.26, 0.2);
+INSERT INTO t VALUES (3902, 39, 38, 10.27, 0.2);
+INSERT INTO t VALUES (3903, 39, 75, 10.28, 0.2);
+INSERT INTO t VALUES (3904, 39, 15, 10.29, 0.2);
+INSERT INTO t VALUES (3905, 39, 52, 10.30, 0.2);
+INSERT INTO t VALUES (3906, 39, 89, 10.31, 0.2);
+INSERT INTO t VALUES (3907, 39, 29, 10.32, 0.2);
+INSERT INTO t VALUES (3908, 39, 66, 10.33, 0.2);
+INSERT INTO t VALUES (3909, 39, 6, 10.34, 0.2);
+INSERT INTO t VALUES (3910, 39, 43, 10.35, 0.2);
+INSERT INTO t VALUES (3911, 39, 80, 10.36, 0.2);
+INSERT INTO t VALUES (3912, 39, 20, 10.37, 0.2);
+INSERT INTO t VALUES (3913, 39, 57, 10.38, 0.2);
+INSERT INTO t VALUES (3914, 39, 94, 10.39, 0.2);
+INSERT INTO t VALUES (3915, 39, 34, 10.40, 0.2);
+INSERT INTO t VALUES (3916, 39, 71, 10.41, 0.2);
+INSERT INTO t VALUES (3917, 39, 11, 10.42, 0.2);
+INSERT INTO t VALUES (3918, 39, 48, 10.43, 0.2);
+INSERT INTO t VALUES (3919, 39, 85, 10.44, 0.2);
+INSERT INTO t VALUES (3920, 39, 25, 10.45, 0.2);
+INSERT INTO t VALUES (3921, 39, 62, 10.46, 0.2);
+INSERT INTO t VALUES (3922, 39, 2, 10.47, 0.2);
+INSERT INTO t VALUES (3923, 39, 39, 10.48, 0.2);
+INSERT INTO t VALUES (3924, 39, 76, 10.49, 0.2);
+INSERT INTO t VALUES (3925, 39, 16, 10.50, 0.2);
+INSERT INTO t VALUES (3926, 39, 53, 10.51, 0.2);
+INSERT INTO t VALUES (3927, 39, 90, 10.52, 0.2);
+INSERT INTO t VALUES (3928, 39, 30, 10.53, 0.2);
+INSERT INTO t VALUES (3929, 39, 67, 10.54, 0.2);
+INSERT INTO t VALUES (3930, 39, 7, 10.55, 0.2);
+INSERT INTO t VALUES (3931, 39, 44, 10.56, 0.2);
+INSERT INTO t VALUES (3932, 39, 81, 10.57, 0.2);
+INSERT INTO t VALUES (3933, 39, 21, 10.58, 0.2);
+INSERT INTO t VALUES (3934, 39, 58, 10.59, 0.2);
+INSERT INTO t VALUES (3935, 39, 95, 10.60, 0.2);
+INSERT INTO t VALUES (3936, 39, 35, 10.61, 0.2);
+INSERT INTO t VALUES (3937, 39, 72, 10.62, 0.2);
+INSERT INTO t VALUES (3938, 39, 12, 10.63, 0.2);
+INSERT INTO t VALUES (3939, 39, 49, 10.64, 0.2);
+INSERT INTO t VALUES (3940, 39, 86, 10.65, 0.2);
+INSERT INTO t VALUES (3941, 39, 26, 10.66, 0.2);
+INSERT INTO t VALUES (3942, 39, 63, 10.67, 0.2);
+INSERT INTO t VALUES (3943, 39, 3, 10.68, 0.2);
+INSERT INTO t VALUES (3944, 39, 40, 10.69, 0.2);
+INSERT INTO t VALUES (3945, 39, 77, 10.70, 0.2);
+INSERT INTO t VALUES (3946, 39, 17, 10.71, 0.2);
+INSERT INTO t VALUES (3947, 39, 54, 10.72, 0.2);
+INSERT INTO t VALUES (3948, 39, 91, 10.73, 0.2);
+INSERT INTO t VALUES (3949, 39, 31, 10.74, 0.2);
+INSERT INTO t VALUES (3950, 39, 68, 10.75, 0.2);
+INSERT INTO t VALUES (3951, 39, 8, 10.76, 0.2);
+INSERT INTO t VALUES (3952, 39, 45, 10.77, 0.2);
+INSERT INTO t VALUES (3953, 39, 82, 10.78, 0.2);
+INSERT INTO t VALUES (3954, 39, 22, 10.79, 0.2);
+INSERT INTO t VALUES (3955, 39, 59, 10.80, 0.2);
+INSERT INTO t VALUES (3956, 39, 96, 10.81, 0.2);
+INSERT INTO t VALUES (3957, 39, 36, 10.82, 0.2);
+INSERT INTO t VALUES (3958, 39, 73, 10.83, 0.2);
+INSERT INTO t VALUES (3959, 39, 13, 10.84, 0.2);
+INSERT INTO t VALUES (3960, 39, 50, 10.85, 0.2);
+INSERT INTO t VALUES (3961, 39, 87, 10.86, 0.2);
+INSERT INTO t VALUES (3962, 39, 27, 10.87, 0.2);
+INSERT INTO t VALUES (3963, 39, 64, 10.88, 0.2);
+INSERT INTO t VALUES (3964, 39, 4, 10.89, 0.2);
+INSERT INTO t VALUES (3965, 39, 41, 10.90, 0.2);
+INSERT INTO t VALUES (3966, 39, 78, 10.91, 0.2);
+INSERT INTO t VALUES (3967, 39, 18, 10.92, 0.2);
+INSERT INTO t VALUES (3968, 39, 55, 10.93, 0.2);
+INSERT INTO t VALUES (3969, 39, 92, 10.94, 0.2);
+INSERT INTO t VALUES (3970, 39, 32, 10.95, 0.2);
+INSERT INTO t VALUES (3971, 39, 69, 10.96, 0.2);
+INSERT INTO t VALUES (3972, 39, 9, 10.97, 0.2);
+INSERT INTO t VALUES (3973, 39, 46, 10.98, 0.2);
+INSERT INTO t VALUES (3974, 39, 83, 10.99, 0.2);
+INSERT INTO t VALUES (3975, 39, 23, 11.00, 0.2);
+INSERT INTO t VALUES (3976, 39, 60, 11.01, 0.2);
+INSERT INTO t VALUES (3977, 39, 0, 11.02, 0.2);
+INSERT INTO t VALUES (3978, 39, 37, 11.03, 0.2);
+INSERT INTO t VALUES (3979, 39, 74, 11.04, 0.2);
+INSERT INTO t VALUES (3980, 39, 14, 11.05, 0.2);
+INSERT INTO t VALUES (3981, 39, 51, 11.06, 0.2);
+INSERT INTO t VALUES (3982, 39, 88, 11.07, 0.2);
+INSERT INTO t VALUES (3983, 39, 28, 11.08, 0.2);
+INSERT INTO t VALUES (3984, 39, 65, 11.09, 0.2);
+INSERT INTO t VALUES (3985, 39, 5, 11.10, 0.2);
+INSERT INTO t VALUES (3986, 39, 42, 11.11, 0.2);
+INSERT INTO t VALUES (3987, 39, 79, 11.12, 0.2);
+INSERT INTO t VALUES (3988, 39, 19, 11.13, 0.2);
+INSERT INTO t VALUES (3989, 39, 56, 11.14, 0.2);
+INSERT INTO t VALUES (3990, 39, 93, 11.15, 0.2);
+INSERT INTO t VALUES (3991, 39, 33, 11.16, 0.2);
+INSERT INTO t VALUES (3992, 39, 70, 11.17, 0.2);
+INSERT INTO t VALUES (3993, 39, 10, 11.18, 0.2);
+INSERT INTO t VALUES (3994, 39, 47, 11.19, 0.2);
+INSERT INTO t VALUES (3995, 39, 84, 11.20, 0.2);
+INSERT INTO t VALUES (3996, 39, 24, 11.21, 0.2);
+INSERT INTO t VALUES (3997, 39, 61, 11.22, 0.2);
+INSERT INTO t VALUES (3998, 39, 1, 11.23, 0.2);
+INSERT INTO t VALUES (3999, 39, 38, 11.24, 0.2);
+INSERT INTO t VALUES (4000, 40, 75, 1.25, 0.2);
+INSERT INTO t VALUES (4001, 40, 15, 1.26, 0.2);
+INSERT INTO t VALUES (4002, 40, 52, 1.27, 0.2);
+INSERT INTO t VALUES (4003, 40, 89, 1.28, 0.2);
+INSERT INTO t VALUES (4004, 40, 29, 1.29, 0.2);
+INSERT INTO t VALUES (4005, 40, 66, 1.30, 0.2);
+INSERT INTO t VALUES (4006, 40, 6, 1.31, 0.2);
+INSERT INTO t VALUES (4007, 40, 43, 1.32, 0.2);
+INSERT INTO t VALUES (4008, 40, 80, 1.33, 0.2);
+INSERT INTO t VALUES (4009, 40, 20, 1.34, 0.2);
+INSERT INTO t VALUES (4010, 40, 57, 1.35, 0.2);
+INSERT INTO t VALUES (4011, 40, 94, 1.36, 0.2);
+INSERT INTO t VALUES (4012, 40, 34, 1.37, 0.2);
+INSERT INTO t VALUES (4013, 40, 71, 1.38, 0.2);
+INSERT INTO t VALUES (4014, 40, 11, 1.39, 0.2);
+INSERT INTO t VALUES (4015, 40, 48, 1.40, 0.2);
+INSERT INTO t VALUES (4016, 40, 85, 1.41, 0.2);
+INSERT INTO t VALUES (4017, 40, 25, 1.42, 0.2);
+INSERT INTO t VALUES (4018, 40, 62, 1.43, 0.2);
+INSERT INTO t VALUES (4019, 40, 2, 1.44, 0.2);
+INSERT INTO t VALUES (4020, 40, 39, 1.45, 0.2);
+INSERT INTO t VALUES (4021, 40, 76, 1.46, 0.2);
+INSERT INTO t VALUES (4022, 40, 16, 1.47, 0.2);
+INSERT INTO t VALUES (4023, 40, 53, 1.48, 0.2);
+INSERT INTO t VALUES (4024, 40, 90, 1.49, 0.2);
+INSERT INTO t VALUES (4025, 40, 30, 1.50, 0.2);
+INSERT INTO t VALUES (4026, 40, 67, 1.51, 0.2);
+INSERT INTO t VALUES (4027, 40, 7, 1.52, 0.2);
+INSERT INTO t VALUES (4028, 40, 44, 1.53, 0.2);
+INSERT INTO t VALUES (4029, 40, 81, 1.54, 0.2);
+INSERT INTO t VALUES (4030, 40, 21, 1.55, 0.2);
+INSERT INTO t VALUES (4031, 40, 58, 1.56, 0.2);
+INSERT INTO t VALUES (4032, 40, 95, 1.57, 0.2);
+INSERT INTO t VALUES (4033, 40, 35, 1.58, 0.2);
+INSERT INTO t VALUES (4034, 40, 72, 1.59, 0.2);
+INSERT INTO t VALUES (4035, 40, 12, 1.60, 0.2);
+INSERT INTO t VALUES (4036, 40, 49, 1.61, 0.2);
+INSERT INTO t VALUES (4037, 40, 86, 1.62, 0.2);
+INSERT INTO t VALUES (4038, 40, 26, 1.63, 0.2);
+INSERT INTO t VALUES (4039, 40, 63, 1.64, 0.2);
+INSERT INTO t VALUES (4040, 40, 3, 1.65, 0.2);
+INSERT INTO t VALUES (4041, 40, 40, 1.66, 0.2);
+INSERT INTO t VALUES (4042, 40, 77, 1.67, 0.2);
+INSERT INTO t VALUES (4043, 40, 17, 1.68, 0.2);
+INSERT INTO t VALUES (4044, 40, 54, 1.69, 0.2);
+INSERT INTO t VALUES (4045, 40, 91, 1.70, 0.2);
+INSERT INTO t VALUES (4046, 40, 31, 1.71, 0.2);
+INSERT INTO t VALUES (4047, 40, 68, 1.72, 0.2);
+INSERT INTO t VALUES (4048, 40, 8, 1.73, 0.2);
+INSERT INTO t VALUES (4049, 40, 45, 1.74, 0.2);
+INSERT INTO t VALUES (4050, 40, 82, 1.75, 0.2);
+INSERT INTO t VALUES (4051, 40, 22, 1.76, 0.2);
+INSERT INTO t VALUES (4052, 40, 59, 1.77, 0.2);
+INSERT INTO t VALUES (4053, 40, 96, 1.78, 0.2);
+INSERT INTO t VALUES (4054, 40, 36, 1.79, 0.2);
+INSERT INTO t VALUES (4055, 40, 73, 1.80, 0.2);
+INSERT INTO t VALUES (4056, 40, 13, 1.81, 0.2);
+INSERT INTO t VALUES (4057, 40, 50, 1.82, 0.2);
+INSERT INTO t VALUES (4058, 40, 87, 1.83, 0.2);
+INSERT INTO t VALUES (4059, 40, 27, 1.84, 0.2);
+INSERT INTO t VALUES (4060, 40, 64, 1.85, 0.2);
+INSERT INTO t VALUES (4061, 40, 4, 1.86, 0.2);
+INSERT INTO t VALUES (4062, 40, 41, 1.87, 0.2);
+INSERT INTO t VALUES (4063, 40, 78, 1.88, 0.2);
+INSERT INTO t VALUES (4064, 40, 18, 1.89, 0.2);
+INSERT INTO t VALUES (4065, 40, 55, 1.90, 0.2);
+INSERT INTO t VALUES (4066, 40, 92, 1.91, 0.2);
+INSERT INTO t VALUES (4067, 40, 32, 1.92, 0.2);
+INSERT INTO t VALUES (4068, 40, 69, 1.93, 0.2);
+INSERT INTO t VALUES (4069, 40, 9, 1.94, 0.2);
+INSERT INTO t VALUES (4070, 40, 46, 1.95, 0.2);
+INSERT INTO t VALUES (4071, 40, 83, 1.96, 0.2);
+INSERT INTO t VALUES (4072, 40, 23, 1.97, 0.2);
+INSERT INTO t VALUES (4073, 40, 60, 1.98, 0.2);
+INSERT INTO t VALUES (4074, 40, 0, 1.99, 0.2);
+INSERT INTO t VALUES (4075, 40, 37, 2.00, 0.2);
+INSERT INTO t VALUES (4076, 40, 74, 2.01, 0.2);
+INSERT INTO t VALUES (4077, 40, 14, 2.02, 0.2);
+INSERT INTO t VALUES (4078, 40, 51, 2.03, 0.2);
+INSERT INTO t VALUES (4079, 40, 88, 2.04, 0.2);
+INSERT INTO t VALUES (4080, 40, 28, 2.05, 0.2);
+INSERT INTO t VALUES (4081, 40, 65, 2.06, 0.2);
+INSERT INTO t VALUES (4082, 40, 5, 2.07, 0.2);
+INSERT INTO t VALUES (4083, 40, 42, 2.08, 0.2);
+INSERT INTO t VALUES (4084, 40, 79, 2.09, 0.2);
+INSERT INTO t VALUES (4085, 40, 19, 2.10, 0.2);
+INSERT INTO t VALUES (4086, 40, 56, 2.11, 0.2);
+INSERT INTO t VALUES (4087, 40, 93, 2.12, 0.2);
+INSERT INTO t VALUES (4088, 40, 33, 2.13, 0.2);
+INSERT INTO t VALUES (4089, 40, 70, 2.14, 0.2);
+INSERT INTO t VALUES (4090, 40, 10, 2.15, 0.2);
+INSERT INTO t VALUES (4091, 40, 47, 2.16, 0.2);
+INSERT INTO t VALUES (4092, 40, 84, 2.17, 0.2);
+INSERT INTO t VALUES (4093, 40, 24, 2.18, 0.2);
+INSERT INTO t VALUES (4094, 40, 61, 2.19, 0.2);
+INSERT INTO t VALUES (4095, 40, 1, 2.20, 0.2);
+INSERT INTO t VALUES (4096, 40, 38, 2.21, 0.2);
+INSERT INTO t VALUES (4097, 40, 75, 2.22, 0.2);
+INSERT INTO t VALUES (4098, 40, 15, 2.23, 0.2);
+INSERT INTO t VALUES (4099, 40, 52, 2.24, 0.2);
+UPDATE t SET ratio = ratio * 3.0;
+UPDATE t SET price = price * 1.01 WHERE id > 4095;
+SELECT id, grp, qty, price, ratio FROM t WHERE id < 2 OR id = 2047 OR id = 2048 OR id = 3000 OR id > 4097;
+SELECT id FROM t WHERE ratio > 0.3 AND id > 2045 AND id < 2050;
+SELECT id, ratio FROM t WHERE ratio > 0.6 AND id > 4092;
+SELECT id FROM t WHERE ratio < 0.6 AND id > 2997 AND id < 3003;
+SELECT id FROM t WHERE grp = 5 AND id > 2045;
+SELECT id, grp FROM t WHERE grp > 20 AND id < 2103;
+SELECT id, qty FROM t WHERE qty < 0 OR qty = 96 AND id < 400;
+SELECT id, price FROM t WHERE price > 11.23 AND id < 3000;
+SELECT id, price FROM t WHERE price < 1.27;
@@ -0,0 +1,21 @@
+USE DATABASE shop;
+SELECT id, grp, qty, price, ratio FROM t WHERE id < 2 OR id = 2047 OR id = 2048 OR id = 3000 OR id > 4097;
+SELECT id FROM t WHERE ratio > 0.3 AND id > 2045 AND id < 2050;
+SELECT id, ratio FROM t WHERE ratio > 0.6 AND id > 4092;
+SELECT id FROM t WHERE ratio < 0.6 AND id > 2997 AND id < 3003;
+SELECT id FROM t WHERE grp = 5 AND id > 2045;
+SELECT id, grp FROM t WHERE grp > 20 AND id < 2103;
+SELECT id, qty FROM t WHERE qty < 0 OR qty = 96 AND id < 400;
+SELECT id, price FROM t WHERE price > 11.23 AND id < 3000;
+SELECT id, price FROM t WHERE price < 1.27;
+UPDATE t SET grp = 7 WHERE id = 2100;
+SELECT id, grp, qty, price, ratio FROM t WHERE id < 2 OR id = 2047 OR id = 2048 OR id = 3000 OR id > 4097;
+SELECT id FROM t WHERE ratio > 0.3 AND id > 2045 AND id < 2050;
+SELECT id, ratio FROM t WHERE ratio > 0.6 AND id > 4092;
+SELECT id FROM t WHERE ratio < 0.6 AND id > 2997 AND id < 3003;
+SELECT id FROM t WHERE grp = 5 AND id > 2045;
+SELECT id, grp FROM t WHERE grp > 20 AND id < 2103;
+SELECT id, qty FROM t WHERE qty < 0 OR qty = 96 AND id < 400;
+SELECT id, price FROM t WHERE price > 11.23 AND id < 3000;
+SELECT id, price FROM t WHERE price < 1.27;
+SELECT id, grp FROM t WHERE grp = 7;
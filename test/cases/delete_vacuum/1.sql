@@ -0,0 +1,8066 @@
+CREATE DATABASE shop;
+USE DATABASE shop;
+CREATE TABLE items (id INTEGER, grp INTEGER, price FLOAT, name TEXT);
+CREATE TABLE orders (id INTEGER, item_id INTEGER, qty INTEGER);
+CREATE TABLE notes (id INTEGER, body TEXT);
+INSERT INTO items VALUES (0, 0, 1.00, 'item0');
+INSERT INTO items VALUES (1, 1, 1.25, 'item1');
+INSERT INTO items VALUES (2, 2, 1.50, 'item2');
+INSERT INTO items VALUES (3, 0, 1.75, 'item3');
+INSERT INTO items VALUES (4, 1, 2.00, 'item4');
+INSERT INTO items VALUES (5, 2, 2.25, 'item5');
+INSERT INTO items VALUES (6, 0, 2.50, 'item6');
+INSERT INTO items VALUES (7, 1, 2.75, 'item7');
+INSERT INTO items VALUES (8, 2, 3.00, 'item8');
+INSERT INTO items VALUES (9, 0, 3.25, 'item9');
+INSERT INTO items VALUES (10, 1, 3.50, 'item10');
+INSERT INTO items VALUES (11, 2, 3.75, 'item11');
+INSERT INTO items VALUES (12, 0, 4.00, 'item12');
+INSERT INTO items VALUES (13, 1, 4.25, 'item13');
+INSERT INTO items VALUES (14, 2, 4.50, 'item14');
+INSERT INTO items VALUES (15, 0, 4.75, 'item15');
+INSERT INTO items VALUES (16, 1, 5.00, 'item16');
+INSERT INTO items VALUES (17, 2, 5.25, 'item17');
+INSERT INTO items VALUES (18, 0, 5.50, 'item18');
+INSERT INTO items VALUES (19, 1, 5.75, 'item19');
+INSERT INTO items VALUES (20, 2, 6.00, 'item20');
+INSERT INTO items VALUES (21, 0, 6.25, 'item21');
+INSERT INTO items VALUES (22, 1, 6.50, 'item22');
+INSERT INTO items VALUES (23, 2, 6.75, 'item23');
+INSERT INTO items VALUES (24, 0, 7.00, 'item24');
+INSERT INTO items VALUES (25, 1, 7.25, 'item25');
+INSERT INTO items VALUES (26, 2, 7.50, 'item26');
+INSERT INTO items VALUES (27, 0, 7.75, 'item27');
+INSERT INTO items VALUES (28, 1, 8.00, 'item28');
+INSERT INTO items VALUES (29, 2, 8.25, 'item29');
+INSERT INTO items VALUES (30, 0, 8.50, 'item30');
+INSERT INTO items VALUES (31, 1, 8.75, 'item31');
+INSERT INTO items VALUES (32, 2, 9.00, 'item32');
+INSERT INTO items VALUES (33, 0, 9.25, 'item33');
+INSERT INTO items VALUES (34, 1, 9.50, 'item34');
+INSERT INTO items VALUES (35, 2, 9.75, 'item35');
+INSERT INTO items VALUES (36, 0, 10.00, 'item36');
+INSERT INTO items VALUES (37, 1, 10.25, 'item37');
+INSERT INTO items VALUES (38, 2, 10.50, 'item38');
+INSERT INTO items VALUES (39, 0, 10.75, 'item39');
+INSERT INTO items VALUES (40, 1, 11.00, 'item40');
+INSERT INTO items VALUES (41, 2, 11.25, 'item41');
+INSERT INTO items VALUES (42, 0, 11.50, 'item42');
+INSERT INTO items VALUES (43, 1, 11.75, 'item43');
+INSERT INTO items VALUES (44, 2, 12.00, 'item44');
+INSERT INTO items VALUES (45, 0, 12.25, 'item45');
+INSERT INTO items VALUES (46, 1, 12.50, 'item46');
+INSERT INTO items VALUES (47, 2, 12.75, 'item47');
+INSERT INTO items VALUES (48, 0, 13.00, 'item48');
+INSERT INTO items VALUES (49, 1, 13.25, 'item49');
+INSERT INTO items VALUES (50, 2, 1.00, 'item50');
+INSERT INTO items VALUES (51, 0, 1.25, 'item51');
+INSERT INTO items VALUES (52, 1, 1.50, 'item52');
+INSERT INTO items VALUES (53, 2, 1.75, 'item53');
+INSERT INTO items VALUES (54, 0, 2.00, 'item54');
+INSERT INTO items VALUES (55, 1, 2.25, 'item55');
+INSERT INTO items VALUES (56, 2, 2.50, 'item56');
+INSERT INTO items VALUES (57, 0, 2.75, 'item57');
+INSERT INTO items VALUES (58, 1, 3.00, 'item58');
+INSERT INTO items VALUES (59, 2, 3.25, 'item59');
+INSERT INTO items VALUES (60, 0, 3.50, 'item60');
+INSERT INTO items VALUES (61, 1, 3.75, 'item61');
+INSERT INTO items VALUES (62, 2, 4.00, 'item62');
+INSERT INTO items VALUES (63, 0, 4.25, 'item63');
+INSERT INTO items VALUES (64, 1, 4.50, 'item64');
+INSERT INTO items VALUES (65, 2, 4.75, 'item65');
+INSERT INTO items VALUES (66, 0, 5.00, 'item66');
+INSERT INTO items VALUES (67, 1, 5.25, 'item67');
+INSERT INTO items VALUES (68, 2, 5.50, 'item68');
+INSERT INTO items VALUES (69, 0, 5.75, 'item69');
+INSERT INTO items VALUES (70, 1, 6.00, 'item70');
+INSERT INTO items VALUES (71, 2, 6.25, 'item71');
+INSERT INTO items VALUES (72, 0, 6.50, 'item72');
+INSERT INTO items VALUES (73, 1, 6.75, 'item73');
+INSERT INTO items VALUES (74, 2, 7.00, 'item74');
+INSERT INTO items VALUES (75, 0, 7.25, 'item75');
+INSERT INTO items VALUES (76, 1, 7.50, 'item76');
+INSERT INTO items VALUES (77, 2, 7.75, 'item77');
+INSERT INTO items VALUES (78, 0, 8.00, 'item78');
+INSERT INTO items VALUES (79, 1, 8.25, 'item79');
+INSERT INTO items VALUES (80, 2, 8.50, 'item80');
+INSERT INTO items VALUES (81, 0, 8.75, 'item81');
+INSERT INTO items VALUES (82, 1, 9.00, 'item82');
+INSERT INTO items VALUES (83, 2, 9.25, 'item83');
+INSERT INTO items VALUES (84, 0, 9.50, 'item84');
+INSERT INTO items VALUES (85, 1, 9.75, 'item85');
+INSERT INTO items VALUES (86, 2, 10.00, 'item86');
+INSERT INTO items VALUES (87, 0, 10.25, 'item87');
+INSERT INTO items VALUES (88, 1, 10.50, 'item88');
+INSERT INTO items VALUES (89, 2, 10.75, 'item89');
+INSERT INTO items VALUES (90, 0, 11.00, 'item90');
+INSERT INTO items VALUES (91, 1, 11.25, 'item91');
+INSERT INTO items VALUES (92, 2, 11.50, 'item92');
+INSERT INTO items VALUES (93, 0, 11.75, 'item93');
+INSERT INTO items VALUES (94, 1, 12.00, 'item94');
+INSERT INTO items VALUES (95, 2, 12.25, 'item95');
+INSERT INTO items VALUES (96, 0, 12.50, 'item96');
+INSERT INTO items VALUES (97, 1, 12.75, 'item97');
+INSERT INTO items VALUES (98, 2, 13.00, 'item98');
+INSERT INTO items VALUES (99, 0, 13.25, 'item99');
+INSERT INTO items VALUES (100, 1, 1.00, 'item100');
+INSERT INTO items VALUES (101, 2, 1.25, 'item101');
+INSERT INTO items VALUES (102, 0, 1.50, 'item102');
+INSERT INTO items VALUES (103, 1, 1.75, 'item103');
+INSERT INTO items VALUES (104, 2, 2.00, 'item104');
+INSERT INTO items VALUES (105, 0, 2.25, 'item105');
+INSERT INTO items VALUES (106, 1, 2.50, 'item106');
+INSERT INTO items VALUES (107, 2, 2.75, 'item107');
+INSERT INTO items VALUES (108, 0, 3.00, 'item108');
+INSERT INTO items VALUES (109, 1, 3.25, 'item109');
+INSERT INTO items VALUES (110, 2, 3.50, 'item110');
+INSERT INTO items VALUES (111, 0, 3.75, 'item111');
+INSERT INTO items VALUES (112, 1, 4.00, 'item112');
+INSERT INTO items VALUES (113, 2, 4.25, 'item113');
+INSERT INTO items VALUES (114, 0, 4.50, 'item114');
+INSERT INTO items VALUES (115, 1, 4.75, 'item115');
+INSERT INTO items VALUES (116, 2, 5.00, 'item116');
+INSERT INTO items VALUES (117, 0, 5.25, 'item117');
+INSERT INTO items VALUES (118, 1, 5.50, 'item118');
+INSERT INTO items VALUES (119, 2, 5.75, 'item119');
+INSERT INTO items VALUES (120, 0, 6.00, 'item120');
+INSERT INTO items VALUES (121, 1, 6.25, 'item121');
+INSERT INTO items VALUES (122, 2, 6.50, 'item122');
+INSERT INTO items VALUES (123, 0, 6.75, 'item123');
+INSERT INTO items VALUES (124, 1, 7.00, 'item124');
+INSERT INTO items VALUES (125, 2, 7.25, 'item125');
+INSERT INTO items VALUES (126, 0, 7.50, 'item126');
+INSERT INTO items VALUES (127, 1, 7.75, 'item127');
+INSERT INTO items VALUES (128, 2, 8.00, 'item128');
+INSERT INTO items VALUES (129, 0, 8.25, 'item129');
+INSERT INTO items VALUES (130, 1, 8.50, 'item130');
+INSERT INTO items VALUES (131, 2, 8.75, 'item131');
+INSERT INTO items VALUES (132, 0, 9.00, 'item132');
+INSERT INTO items VALUES (133, 1, 9.25, 'item133');
+INSERT INTO items VALUES (134, 2, 9.50, 'item134');
+INSERT INTO items VALUES (135, 0, 9.75, 'item135');
+INSERT INTO items VALUES (136, 1, 10.00, 'item136');
+INSERT INTO items VALUES (137, 2, 10.25, 'item137');
+INSERT INTO items VALUES (138, 0, 10.50, 'item138');
+INSERT INTO items VALUES (139, 1, 10.75, 'item139');
+INSERT INTO items VALUES (140, 2, 11.00, 'item140');
+INSERT INTO items VALUES (141, 0, 11.25, 'item141');
+INSERT INTO items VALUES (142, 1, 11.50, 'item142');
+INSERT INTO items VALUES (143, 2, 11.75, 'item143');
+INSERT INTO items VALUES (144, 0, 12.00, 'item144');
+INSERT INTO items VALUES (145, 1, 12.25, 'item145');
+INSERT INTO items VALUES (146, 2, 12.50, 'item146');
+INSERT INTO items VALUES (147, 0, 12.75, 'item147');
+INSERT INTO items VALUES (148, 1, 13.00, 'item148');
+INSERT INTO items VALUES (149, 2, 13.25, 'item149');
+INSERT INTO items VALUES (150, 0, 1.00, 'item150');
+INSERT INTO items VALUES (151, 1, 1.25, 'item151');
+INSERT INTO items VALUES (152, 2, 1.50, 'item152');
+INSERT INTO items VALUES (153, 0, 1.75, 'item153');
+INSERT INTO items VALUES (154, 1, 2.00, 'item154');
+INSERT INTO items VALUES (155, 2, 2.25, 'item155');
+INSERT INTO items VALUES (156, 0, 2.50, 'item156');
+INSERT INTO items VALUES (157, 1, 2.75, 'item157');
+INSERT INTO items VALUES (158, 2, 3.00, 'item158');
+INSERT INTO items VALUES (159, 0, 3.25, 'item159');
+INSERT INTO items VALUES (160, 1, 3.50, 'item160');
+INSERT INTO items VALUES (161, 2, 3.75, 'item161');
+INSERT INTO items VALUES (162, 0, 4.00, 'item162');
+INSERT INTO items VALUES (163, 1, 4.25, 'item163');
+INSERT INTO items VALUES (164, 2, 4.50, 'item164');
+INSERT INTO items VALUES (165, 0, 4.75, 'item165');
+INSERT INTO items VALUES (166, 1, 5.00, 'item166');
+INSERT INTO items VALUES (167, 2, 5.25, 'item167');
+INSERT INTO items VALUES (168, 0, 5.50, 'item168');
+INSERT INTO items VALUES (169, 1, 5.75, 'item169');
+INSERT INTO items VALUES (170, 2, 6.00, 'item170');
+INSERT INTO items VALUES (171, 0, 6.25, 'item171');
+INSERT INTO items VALUES (172, 1, 6.50, 'item172');
+INSERT INTO items VALUES (173, 2, 6.75, 'item173');
+INSERT INTO items VALUES (174, 0, 7.00, 'item174');
+INSERT INTO items VALUES (175, 1, 7.25, 'item175');
+INSERT INTO items VALUES (176, 2, 7.50, 'item176');
+INSERT INTO items VALUES (177, 0, 7.75, 'item177');
+INSERT INTO items VALUES (178, 1, 8.00, 'item178');
+INSERT INTO items VALUES (179, 2, 8.25, 'item179');
+INSERT INTO items VALUES (180, 0, 8.50, 'item180');
+INSERT INTO items VALUES (181, 1, 8.75, 'item181');
+INSERT INTO items VALUES (182, 2, 9.00, 'item182');
+INSERT INTO items VALUES (183, 0, 9.25, 'item183');
+INSERT INTO items VALUES (184, 1, 9.50, 'item184');
+INSERT INTO items VALUES (185, 2, 9.75, 'item185');
+INSERT INTO items VALUES (186, 0, 10.00, 'item186');
+INSERT INTO items VALUES (187, 1, 10.25, 'item187');
+INSERT INTO items VALUES (188, 2, 10.50, 'item188');
+INSERT INTO items VALUES (189, 0, 10.75, 'item189');
+INSERT INTO items VALUES (190, 1, 11.00, 'item190');
+INSERT INTO items VALUES (191, 2, 11.25, 'item191');
+INSERT INTO items VALUES (192, 0, 11.50, 'item192');
+INSERT INTO items VALUES (193, 1, 11.75, 'item193');
+INSERT INTO items VALUES (194, 2, 12.00, 'item194');
+INSERT INTO items VALUES (195, 0, 12.25, 'item195');
+INSERT INTO items VALUES (196, 1, 12.50, 'item196');
+INSERT INTO items VALUES (197, 2, 12.75, 'item197');
+INSERT INTO items VALUES (198, 0, 13.00, 'item198');
+INSERT INTO items VALUES (199, 1, 13.25, 'item199');
+INSERT INTO items VALUES (200, 2, 1.00, 'item200');
+INSERT INTO items VALUES (201, 0, 1.25, 'item201');
+INSERT INTO items VALUES (202, 1, 1.50, 'item202');
+INSERT INTO items VALUES (203, 2, 1.75, 'item203');
+INSERT INTO items VALUES (204, 0, 2.00, 'item204');
+INSERT INTO items VALUES (205, 1, 2.25, 'item205');
+INSERT INTO items VALUES (206, 2, 2.50, 'item206');
+INSERT INTO items VALUES (207, 0, 2.75, 'item207');
+INSERT INTO items VALUES (208, 1, 3.00, 'item208');
+INSERT INTO items VALUES (209, 2, 3.25, 'item209');
+INSERT INTO items VALUES (210, 0, 3.50, 'item210');
+INSERT INTO items VALUES (211, 1, 3.75, 'item211');
+INSERT INTO items VALUES (212, 2, 4.00, 'item212');
+INSERT INTO items VALUES (213, 0, 4.25, 'item213');
+INSERT INTO items VALUES (214, 1, 4.50, 'item214');
+INSERT INTO items VALUES (215, 2, 4.75, 'item215');
+INSERT INTO items VALUES (216, 0, 5.00, 'item216');
+INSERT INTO items VALUES (217, 1, 5.25, 'item217');
+INSERT INTO items VALUES (218, 2, 5.50, 'item218');
+INSERT INTO items VALUES (219, 0, 5.75, 'item219');
+INSERT INTO items VALUES (220, 1, 6.00, 'item220');
+INSERT INTO items VALUES (221, 2, 6.25, 'item221');
+INSERT INTO items VALUES (222, 0, 6.50, 'item222');
+INSERT INTO items VALUES (223, 1, 6.75, 'item223');
+INSERT INTO items VALUES (224, 2, 7.00, 'item224');
+INSERT INTO items VALUES (225, 0, 7.25, 'item225');
+INSERT INTO items VALUES (226, 1, 7.50, 'item226');
+INSERT INTO items VALUES (227, 2, 7.75, 'item227');
+INSERT INTO items VALUES (228, 0, 8.00, 'item228');
+INSERT INTO items VALUES (229, 1, 8.25, 'item229');
+INSERT INTO items VALUES (230, 2, 8.50, 'item230');
+INSERT INTO items VALUES (231, 0, 8.75, 'item231');
+INSERT INTO items VALUES (232, 1, 9.00, 'item232');
+INSERT INTO items VALUES (233, 2, 9.25, 'item233');
+INSERT INTO items VALUES (234, 0, 9.50, 'item234');
+INSERT INTO items VALUES (235, 1, 9.75, 'item235');
+INSERT INTO items VALUES (236, 2, 10.00, 'item236');
+INSERT INTO items VALUES (237, 0, 10.25, 'item237');
+INSERT INTO items VALUES (238, 1, 10.50, 'item238');
+INSERT INTO items VALUES (239, 2, 10.75, 'item239');
+INSERT INTO items VALUES (240, 0, 11.00, 'item240');
+INSERT INTO items VALUES (241, 1, 11.25, 'item241');
+INSERT INTO items VALUES (242, 2, 11.50, 'item242');
+INSERT INTO items VALUES (243, 0, 11.75, 'item243');
+INSERT INTO items VALUES (244, 1, 12.00, 'item244');
+INSERT INTO items VALUES (245, 2, 12.25, 'item245');
+INSERT INTO items VALUES (246, 0, 12.50, 'item246');
+INSERT INTO items VALUES (247, 1, 12.75, 'item247');
+INSERT INTO items VALUES (248, 2, 13.00, 'item248');
+INSERT INTO items VALUES (249, 0, 13.25, 'item249');
+INSERT INTO items VALUES (250, 1, 1.00, 'item250');
+INSERT INTO items VALUES (251, 2, 1.25, 'item251');
+INSERT INTO items VALUES (252, 0, 1.50, 'item252');
+INSERT INTO items VALUES (253, 1, 1.75, 'item253');
+INSERT INTO items VALUES (254, 2, 2.00, 'item254');
+INSERT INTO items VALUES (255, 0, 2.25, 'item255');
+INSERT INTO items VALUES (256, 1, 2.50, 'item256');
+INSERT INTO items VALUES (257, 2, 2.75, 'item257');
+INSERT INTO items VALUES (258, 0, 3.00, 'item258');
+INSERT INTO items VALUES (259, 1, 3.25, 'item259');
+INSERT INTO items VALUES (260, 2, 3.50, 'item260');
+INSERT INTO items VALUES (261, 0, 3.75, 'item261');
+INSERT INTO items VALUES (262, 1, 4.00, 'item262');
+INSERT INTO items VALUES (263, 2, 4.25, 'item263');
+INSERT INTO items VALUES (264, 0, 4.50, 'item264');
+INSERT INTO items VALUES (265, 1, 4.75, 'item265');
+INSERT INTO items VALUES (266, 2, 5.00, 'item266');
+INSERT INTO items VALUES (267, 0, 5.25, 'item267');
+INSERT INTO items VALUES (268, 1, 5.50, 'item268');
+INSERT INTO items VALUES (269, 2, 5.75, 'item269');
+INSERT INTO items VALUES (270, 0, 6.00, 'item270');
+INSERT INTO items VALUES (271, 1, 6.25, 'item271');
+INSERT INTO items VALUES (272, 2, 6.50, 'item272');
+INSERT INTO items VALUES (273, 0, 6.75, 'item273');
+INSERT INTO items VALUES (274, 1, 7.00, 'item274');
+INSERT INTO items VALUES (275, 2, 7.25, 'item275');
+INSERT INTO items VALUES (276, 0, 7.50, 'item276');
+INSERT INTO items VALUES (277, 1, 7.75, 'item277');
+INSERT INTO items VALUES (278, 2, 8.00, 'item278');
+INSERT INTO items VALUES (279, 0, 8.25, 'item279');
+INSERT INTO items VALUES (280, 1, 8.50, 'item280');
+INSERT INTO items VALUES (281, 2, 8.75, 'item281');
+INSERT INTO items VALUES (282, 0, 9.00, 'item282');
+INSERT INTO items VALUES (283, 1, 9.25, 'item283');
+INSERT INTO items VALUES (284, 2, 9.50, 'item284');
+INSERT INTO items VALUES (285, 0, 9.75, 'item285');
+INSERT INTO items VALUES (286, 1, 10.00, 'item286');
+INSERT INTO items VALUES (287, 2, 10.25, 'item287');
+INSERT INTO items VALUES (288, 0, 10.50, 'item288');
+INSERT INTO items VALUES (289, 1, 10.75, 'item289');
+INSERT INTO items VALUES (290, 2, 11.00, 'item290');
+INSERT INTO items VALUES (291, 0, 11.25, 'item291');
+INSERT INTO items VALUES (292, 1, 11.50, 'item292');
+INSERT INTO items VALUES (293, 2, 11.75, 'item293');
+INSERT INTO items VALUES (294, 0, 12.00, 'item294');
+INSERT INTO items VALUES (295, 1, 12.25, 'item295');
+INSERT INTO items VALUES (296, 2, 12.50, 'item296');
+INSERT INTO items VALUES (297, 0, 12.75, 'item297');
+INSERT INTO items VALUES (298, 1, 13.00, 'item298');
+INSERT INTO items VALUES (299, 2, 13.25, 'item299');
+INSERT INTO items VALUES (300, 0, 1.00, 'item300');
+INSERT INTO items VALUES (301, 1, 1.25, 'item301');
+INSERT INTO items VALUES (302, 2, 1.50, 'item302');
+INSERT INTO items VALUES (303, 0, 1.75, 'item303');
+INSERT INTO items VALUES (304, 1, 2.00, 'item304');
+INSERT INTO items VALUES (305, 2, 2.25, 'item305');
+INSERT INTO items VALUES (306, 0, 2.50, 'item306');
+INSERT INTO items VALUES (307, 1, 2.75, 'item307');
+INSERT INTO items VALUES (308, 2, 3.00, 'item308');
+INSERT INTO items VALUES (309, 0, 3.25, 'item309');
+INSERT INTO items VALUES (310, 1, 3.50, 'item310');
+INSERT INTO items VALUES (311, 2, 3.75, 'item311');
+INSERT INTO items VALUES (312, 0, 4.00, 'item312');
+INSERT INTO items VALUES (313, 1, 4.25, 'item313');
+INSERT INTO items VALUES (314, 2, 4.50, 'item314');
+INSERT INTO items VALUES (315, 0, 4.75, 'item315');
+INSERT INTO items VALUES (316, 1, 5.00, 'item316');
+INSERT INTO items VALUES (317, 2, 5.25, 'item317');
+INSERT INTO items VALUES (318, 0, 5.50, 'item318');
+INSERT INTO items VALUES (319, 1, 5.75, 'item319');
+INSERT INTO items VALUES (320, 2, 6.00, 'item320');
+INSERT INTO items VALUES (321, 0, 6.25, 'item321');
+INSERT INTO items VALUES (322, 1, 6.50, 'item322');
+INSERT INTO items VALUES (323, 2, 6.75, 'item323');
+INSERT INTO items VALUES (324, 0, 7.00, 'item324');
+INSERT INTO items VALUES (325, 1, 7.25, 'item325');
+INSERT INTO items VALUES (326, 2, 7.50, 'item326');
+INSERT INTO items VALUES (327, 0, 7.75, 'item327');
+INSERT INTO items VALUES (328, 1, 8.00, 'item328');
+INSERT INTO items VALUES (329, 2, 8.25, 'item329');
+INSERT INTO items VALUES (330, 0, 8.50, 'item330');
+INSERT INTO items VALUES (331, 1, 8.75, 'item331');
+INSERT INTO items VALUES (332, 2, 9.00, 'item332');
+INSERT INTO items VALUES (333, 0, 9.25, 'item333');
+INSERT INTO items VALUES (334, 1, 9.50, 'item334');
+INSERT INTO items VALUES (335, 2, 9.75, 'item335');
+INSERT INTO items VALUES (336, 0, 10.00, 'item336');
+INSERT INTO items VALUES (337, 1, 10.25, 'item337');
+INSERT INTO items VALUES (338, 2, 10.50, 'item338');
+INSERT INTO items VALUES (339, 0, 10.75, 'item339');
+INSERT INTO items VALUES (340, 1, 11.00, 'item340');
+INSERT INTO items VALUES (341, 2, 11.25, 'item341');
+INSERT INTO items VALUES (342, 0, 11.50, 'item342');
+INSERT INTO items VALUES (343, 1, 11.75, 'item343');
+INSERT INTO items VALUES (344, 2, 12.00, 'item344');
+INSERT INTO items VALUES (345, 0, 12.25, 'item345');
+INSERT INTO items VALUES (346, 1, 12.50, 'item346');
+INSERT INTO items VALUES (347, 2, 12.75, 'item347');
+INSERT INTO items VALUES (348, 0, 13.00, 'item348');
+INSERT INTO items VALUES (349, 1, 13.25, 'item349');
+INSERT INTO items VALUES (350, 2, 1.00, 'item350');
+INSERT INTO items VALUES (351, 0, 1.25, 'item351');
+INSERT INTO items VALUES (352, 1, 1.50, 'item352');
+INSERT INTO items VALUES (353, 2, 1.75, 'item353');
+INSERT INTO items VALUES (354, 0, 2.00, 'item354');
+INSERT INTO items VALUES (355, 1, 2.25, 'item355');
+INSERT INTO items VALUES (356, 2, 2.50, 'item356');
+INSERT INTO items VALUES (357, 0, 2.75, 'item357');
+INSERT INTO items VALUES (358, 1, 3.00, 'item358');
+INSERT INTO items VALUES (359, 2, 3.25, 'item359');
+INSERT INTO items VALUES (360, 0, 3.50, 'item360');
+INSERT INTO items VALUES (361, 1, 3.75, 'item361');
+INSERT INTO items VALUES (362, 2, 4.00, 'item362');
+INSERT INTO items VALUES (363, 0, 4.25, 'item363');
+INSERT INTO items VALUES (364, 1, 4.50, 'item364');
+INSERT INTO items VALUES (365, 2, 4.75, 'item365');
+INSERT INTO items VALUES (366, 0, 5.00, 'item366');
+INSERT INTO items VALUES (367, 1, 5.25, 'item367');
+INSERT INTO items VALUES (368, 2, 5.50, 'item368');
+INSERT INTO items VALUES (369, 0, 5.75, 'item369');
+INSERT INTO items VALUES (370, 1, 6.00, 'item370');
+INSERT INTO items VALUES (371, 2, 6.25, 'item371');
+INSERT INTO items VALUES (372, 0, 6.50, 'item372');
+INSERT INTO items VALUES (373, 1, 6.75, 'item373');
+INSERT INTO items VALUES (374, 2, 7.00, 'item374');
+INSERT INTO items VALUES (375, 0, 7.25, 'item375');
+INSERT INTO items VALUES (376, 1, 7.50, 'item376');
+INSERT INTO items VALUES (377, 2, 7.75, 'item377');
+INSERT INTO items VALUES (378, 0, 8.00, 'item378');
+INSERT INTO items VALUES (379, 1, 8.25, 'item379');
+INSERT INTO items VALUES (380, 2, 8.50, 'item380');
+INSERT INTO items VALUES (381, 0, 8.75, 'item381');
+INSERT INTO items VALUES (382, 1, 9.00, 'item382');
+INSERT INTO items VALUES (383, 2, 9.25, 'item383');
+INSERT INTO items VALUES (384, 0, 9.50, 'item384');
+INSERT INTO items VALUES (385, 1, 9.75, 'item385');
+INSERT INTO items VALUES (386, 2, 10.00, 'item386');
+INSERT INTO items VALUES (387, 0, 10.25, 'item387');
+INSERT INTO items VALUES (388, 1, 10.50, 'item388');
+INSERT INTO items VALUES (389, 2, 10.75, 'item389');
+INSERT INTO items VALUES (390, 0, 11.00, 'item390');
+INSERT INTO items VALUES (391, 1, 11.25, 'item391');
+INSERT INTO items VALUES (392, 2, 11.50, 'item392');
+INSERT INTO items VALUES (393, 0, 11.75, 'item393');
+INSERT INTO items VALUES (394, 1, 12.00, 'item394');
+INSERT INTO items VALUES (395, 2, 12.25, 'item395');
+INSERT INTO items VALUES (396, 0, 12.50, 'item396');
+INSERT INTO items VALUES (397, 1, 12.75, 'item397');
+INSERT INTO items VALUES (398, 2, 13.00, 'item398');
+INSERT INTO items VALUES (399, 0, 13.25, 'item399');
+INSERT INTO items VALUES (400, 1, 1.00, 'item400');
+INSERT INTO items VALUES (401, 2, 1.25, 'item401');
+INSERT INTO items VALUES (402, 0, 1.50, 'item402');
+INSERT INTO items VALUES (403, 1, 1.75, 'item403');
+INSERT INTO items VALUES (404, 2, 2.00, 'item404');
+INSERT INTO items VALUES (405, 0, 2.25, 'item405');
+INSERT INTO items VALUES (406, 1, 2.50, 'item406');
+INSERT INTO items VALUES (407, 2, 2.75, 'item407');
+INSERT INTO items VALUES (408, 0, 3.00, 'item408');
+INSERT INTO items VALUES (409, 1, 3.25, 'item409');
+INSERT INTO items VALUES (410, 2, 3.50, 'item410');
+INSERT INTO items VALUES (411, 0, 3.75, 'item411');
+INSERT INTO items VALUES (412, 1, 4.00, 'item412');
+INSERT INTO items VALUES (413, 2, 4.25, 'item413');
+INSERT INTO items VALUES (414, 0, 4.50, 'item414');
+INSERT INTO items VALUES (415, 1, 4.75, 'item415');
+INSERT INTO items VALUES (416, 2, 5.00, 'item416');
+INSERT INTO items VALUES (417, 0, 5.25, 'item417');
+INSERT INTO items VALUES (418, 1, 5.50, 'item418');
+INSERT INTO items VALUES (419, 2, 5.75, 'item419');
+INSERT INTO items VALUES (420, 0, 6.00, 'item420');
+INSERT INTO items VALUES (421, 1, 6.25, 'item421');
+INSERT INTO items VALUES (422, 2, 6.50, 'item422');
+INSERT INTO items VALUES (423, 0, 6.75, 'item423');
+INSERT INTO items VALUES (424, 1, 7.00, 'item424');
+INSERT INTO items VALUES (425, 2, 7.25, 'item425');
+INSERT INTO items VALUES (426, 0, 7.50, 'item426');
+INSERT INTO items VALUES (427, 1, 7.75, 'item427');
+INSERT INTO items VALUES (428, 2, 8.00, 'item428');
+INSERT INTO items VALUES (429, 0, 8.25, 'item429');
+INSERT INTO items VALUES (430, 1, 8.50, 'item430');
+INSERT INTO items VALUES (431, 2, 8.75, 'item431');
+INSERT INTO items VALUES (432, 0, 9.00, 'item432');
+INSERT INTO items VALUES (433, 1, 9.25, 'item433');
+INSERT INTO items VALUES (434, 2, 9.50, 'item434');
+INSERT INTO items VALUES (435, 0, 9.75, 'item435');
+INSERT INTO items VALUES (436, 1, 10.00, 'item436');
+INSERT INTO items VALUES (437, 2, 10.25, 'item437');
+INSERT INTO items VALUES (438, 0, 10.50, 'item438');
+INSERT INTO items VALUES (439, 1, 10.75, 'item439');
+INSERT INTO items VALUES (440, 2, 11.00, 'item440');
+INSERT INTO items VALUES (441, 0, 11.25, 'item441');
+INSERT INTO items VALUES (442, 1, 11.50, 'item442');
+INSERT INTO items VALUES (443, 2, 11.75, 'item443');
+INSERT INTO items VALUES (444, 0, 12.00, 'item444');
+INSERT INTO items VALUES (445, 1, 12.25, 'item445');
+INSERT INTO items VALUES (446, 2, 12.50, 'item446');
+INSERT INTO items VALUES (447, 0, 12.75, 'item447');
+INSERT INTO items VALUES (448, 1, 13.00, 'item448');
+INSERT INTO items VALUES (449, 2, 13.25, 'item449');
+INSERT INTO items VALUES (450, 0, 1.00, 'item450');
+INSERT INTO items VALUES (451, 1, 1.25, 'item451');
+INSERT INTO items VALUES (452, 2, 1.50, 'item452');
+INSERT INTO items VALUES (453, 0, 1.75, 'item453');
+INSERT INTO items VALUES (454, 1, 2.00, 'item454');
+INSERT INTO items VALUES (455, 2, 2.25, 'item455');
+INSERT INTO items VALUES (456, 0, 2.50, 'item456');
+INSERT INTO items VALUES (457, 1, 2.75, 'item457');
+INSERT INTO items VALUES (458, 2, 3.00, 'item458');
+INSERT INTO items VALUES (459, 0, 3.25, 'item459');
+INSERT INTO items VALUES (460, 1, 3.50, 'item460');
+INSERT INTO items VALUES (461, 2, 3.75, 'item461');
+INSERT INTO items VALUES (462, 0, 4.00, 'item462');
+INSERT INTO items VALUES (463, 1, 4.25, 'item463');
+INSERT INTO items VALUES (464, 2, 4.50, 'item464');
+INSERT INTO items VALUES (465, 0, 4.75, 'item465');
+INSERT INTO items VALUES (466, 1, 5.00, 'item466');
+INSERT INTO items VALUES (467, 2, 5.25, 'item467');
+INSERT INTO items VALUES (468, 0, 5.50, 'item468');
+INSERT INTO items VALUES (469, 1, 5.75, 'item469');
+INSERT INTO items VALUES (470, 2, 6.00, 'item470');
+INSERT INTO items VALUES (471, 0, 6.25, 'item471');
+INSERT INTO items VALUES (472, 1, 6.50, 'item472');
+INSERT INTO items VALUES (473, 2, 6.75, 'item473');
+INSERT INTO items VALUES (474, 0, 7.00, 'item474');
+INSERT INTO items VALUES (475, 1, 7.25, 'item475');
+INSERT INTO items VALUES (476, 2, 7.50, 'item476');
+INSERT INTO items VALUES (477, 0, 7.75, 'item477');
+INSERT INTO items VALUES (478, 1, 8.00, 'item478');
+INSERT INTO items VALUES (479, 2, 8.25, 'item479');
+INSERT INTO items VALUES (480, 0, 8.50, 'item480');
+INSERT INTO items VALUES (481, 1, 8.75, 'item481');
+INSERT INTO items VALUES (482, 2, 9.00, 'item482');
+INSERT INTO items VALUES (483, 0, 9.25, 'item483');
+INSERT INTO items VALUES (484, 1, 9.50, 'item484');
+INSERT INTO items VALUES (485, 2, 9.75, 'item485');
+INSERT INTO items VALUES (486, 0, 10.00, 'item486');
+INSERT INTO items VALUES (487, 1, 10.25, 'item487');
+INSERT INTO items VALUES (488, 2, 10.50, 'item488');
+INSERT INTO items VALUES (489, 0, 10.75, 'item489');
+INSERT INTO items VALUES (490, 1, 11.00, 'item490');
+INSERT INTO items VALUES (491, 2, 11.25, 'item491');
+INSERT INTO items VALUES (492, 0, 11.50, 'item492');
+INSERT INTO items VALUES (493, 1, 11.75, 'item493');
+INSERT INTO items VALUES (494, 2, 12.00, 'item494');
+INSERT INTO items VALUES (495, 0, 12.25, 'item495');
+INSERT INTO items VALUES (496, 1, 12.50, 'item496');
+INSERT INTO items VALUES (497, 2, 12.75, 'item497');
+INSERT INTO items VALUES (498, 0, 13.00, 'item498');
+INSERT INTO items VALUES (499, 1, 13.25, 'item499');
+INSERT INTO items VALUES (500, 2, 1.00, 'item500');
+INSERT INTO items VALUES (501, 0, 1.25, 'item501');
+INSERT INTO items VALUES (502, 1, 1.50, 'item502');
+INSERT INTO items VALUES (503, 2, 1.75, 'item503');
+INSERT INTO items VALUES (504, 0, 2.00, 'item504');
+INSERT INTO items VALUES (505, 1, 2.25, 'item505');
+INSERT INTO items VALUES (506, 2, 2.50, 'item506');
+INSERT INTO items VALUES (507, 0, 2.75, 'item507');
+INSERT INTO items VALUES (508, 1, 3.00, 'item508');
+INSERT INTO items VALUES (509, 2, 3.25, 'item509');
+INSERT INTO items VALUES (510, 0, 3.50, 'item510');
+INSERT INTO items VALUES (511, 1, 3.75, 'item511');
+INSERT INTO items VALUES (512, 2, 4.00, 'item512');
+INSERT INTO items VALUES (513, 0, 4.25, 'item513');
+INSERT INTO items VALUES (514, 1, 4.50, 'item514');
+INSERT INTO items VALUES (515, 2, 4.75, 'item515');
+INSERT INTO items VALUES (516, 0, 5.00, 'item516');
+INSERT INTO items VALUES (517, 1, 5.25, 'item517');
+INSERT INTO items VALUES (518, 2, 5.50, 'item518');
+INSERT INTO items VALUES (519, 0, 5.75, 'item519');
+INSERT INTO items VALUES (520, 1, 6.00, 'item520');
+INSERT INTO items VALUES (521, 2, 6.25, 'item521');
+INSERT INTO items VALUES (522, 0, 6.50, 'item522');
+INSERT INTO items VALUES (523, 1, 6.75, 'item523');
+INSERT INTO items VALUES (524, 2, 7.00, 'item524');
+INSERT INTO items VALUES (525, 0, 7.25, 'item525');
+INSERT INTO items VALUES (526, 1, 7.50, 'item526');
+INSERT INTO items VALUES (527, 2, 7.75, 'item527');
+INSERT INTO items VALUES (528, 0, 8.00, 'item528');
+INSERT INTO items VALUES (529, 1, 8.25, 'item529');
+INSERT INTO items VALUES (530, 2, 8.50, 'item530');
+INSERT INTO items VALUES (531, 0, 8.75, 'item531');
+INSERT INTO items VALUES (532, 1, 9.00, 'item532');
+INSERT INTO items VALUES (533, 2, 9.25, 'item533');
+INSERT INTO items VALUES (534, 0, 9.50, 'item534');
+INSERT INTO items VALUES (535, 1, 9.75, 'item535');
+INSERT INTO items VALUES (536, 2, 10.00, 'item536');
+INSERT INTO items VALUES (537, 0, 10.25, 'item537');
+INSERT INTO items VALUES (538, 1, 10.50, 'item538');
+INSERT INTO items VALUES (539, 2, 10.75, 'item539');
+INSERT INTO items VALUES (540, 0, 11.00, 'item540');
+INSERT INTO items VALUES (541, 1, 11.25, 'item541');
+INSERT INTO items VALUES (542, 2, 11.50, 'item542');
+INSERT INTO items VALUES (543, 0, 11.75, 'item543');
+INSERT INTO items VALUES (544, 1, 12.00, 'item544');
+INSERT INTO items VALUES (545, 2, 12.25, 'item545');
+INSERT INTO items VALUES (546, 0, 12.50, 'item546');
+INSERT INTO items VALUES (547, 1, 12.75, 'item547');
+INSERT INTO items VALUES (548, 2, 13.00, 'item548');
+INSERT INTO items VALUES (549, 0, 13.25, 'item549');
+INSERT INTO items VALUES (550, 1, 1.00, 'item550');
+INSERT INTO items VALUES (551, 2, 1.25, 'item551');
+INSERT INTO items VALUES (552, 0, 1.50, 'item552');
+INSERT INTO items VALUES (553, 1, 1.75, 'item553');
+INSERT INTO items VALUES (554, 2, 2.00, 'item554');
+INSERT INTO items VALUES (555, 0, 2.25, 'item555');
+INSERT INTO items VALUES (556, 1, 2.50, 'item556');
+INSERT INTO items VALUES (557, 2, 2.75, 'item557');
+INSERT INTO items VALUES (558, 0, 3.00, 'item558');
+INSERT INTO items VALUES (559, 1, 3.25, 'item559');
+INSERT INTO items VALUES (560, 2, 3.50, 'item560');
+INSERT INTO items VALUES (561, 0, 3.75, 'item561');
+INSERT INTO items VALUES (562, 1, 4.00, 'item562');
+INSERT INTO items VALUES (563, 2, 4.25, 'item563');
+INSERT INTO items VALUES (564, 0, 4.50, 'item564');
+INSERT INTO items VALUES (565, 1, 4.75, 'item565');
+INSERT INTO items VALUES (566, 2, 5.00, 'item566');
+INSERT INTO items VALUES (567, 0, 5.25, 'item567');
+INSERT INTO items VALUES (568, 1, 5.50, 'item568');
+INSERT INTO items VALUES (569, 2, 5.75, 'item569');
+INSERT INTO items VALUES (570, 0, 6.00, 'item570');
+INSERT INTO items VALUES (571, 1, 6.25, 'item571');
+INSERT INTO items VALUES (572, 2, 6.50, 'item572');
+INSERT INTO items VALUES (573, 0, 6.75, 'item573');
+INSERT INTO items VALUES (574, 1, 7.00, 'item574');
+INSERT INTO items VALUES (575, 2, 7.25, 'item575');
+INSERT INTO items VALUES (576, 0, 7.50, 'item576');
+INSERT INTO items VALUES (577, 1, 7.75, 'item577');
+INSERT INTO items VALUES (578, 2, 8.00, 'item578');
+INSERT INTO items VALUES (579, 0, 8.25, 'item579');
+INSERT INTO items VALUES (580, 1, 8.50, 'item580');
+INSERT INTO items VALUES (581, 2, 8.75, 'item581');
+INSERT INTO items VALUES (582, 0, 9.00, 'item582');
+INSERT INTO items VALUES (583, 1, 9.25, 'item583');
+INSERT INTO items VALUES (584, 2, 9.50, 'item584');
+INSERT INTO items VALUES (585, 0, 9.75, 'item585');
+INSERT INTO items VALUES (586, 1, 10.00, 'item586');
+INSERT INTO items VALUES (587, 2, 10.25, 'item587');
+INSERT INTO items VALUES (588, 0, 10.50, 'item588');
+INSERT INTO items VALUES (589, 1, 10.75, 'item589');
+INSERT INTO items VALUES (590, 2, 11.00, 'item590');
+INSERT INTO items VALUES (591, 0, 11.25, 'item591');
+INSERT INTO items VALUES (592, 1, 11.50, 'item592');
+INSERT INTO items VALUES (593, 2, 11.75, 'item593');
+INSERT INTO items VALUES (594, 0, 12.00, 'item594');
+INSERT INTO items VALUES (595, 1, 12.25, 'item595');
+INSERT INTO items VALUES (596, 2, 12.50, 'item596');
+INSERT INTO items VALUES (597, 0, 12.75, 'item597');
+INSERT INTO items VALUES (598, 1, 13.00, 'item598');
+INSERT INTO items VALUES (599, 2, 13.25, 'item599');
+INSERT INTO items VALUES (600, 0, 1.00, 'item600');
+INSERT INTO items VALUES (601, 1, 1.25, 'item601');
+INSERT INTO items VALUES (602, 2, 1.50, 'item602');
+INSERT INTO items VALUES (603, 0, 1.75, 'item603');
+INSERT INTO items VALUES (604, 1, 2.00, 'item604');
+INSERT INTO items VALUES (605, 2, 2.25, 'item605');
+INSERT INTO items VALUES (606, 0, 2.50, 'item606');
+INSERT INTO items VALUES (607, 1, 2.75, 'item607');
+INSERT INTO items VALUES (608, 2, 3.00, 'item608');
+INSERT INTO items VALUES (609, 0, 3.25, 'item609');
+INSERT INTO items VALUES (610, 1, 3.50, 'item610');
+INSERT INTO items VALUES (611, 2, 3.75, 'item611');
+INSERT INTO items VALUES (612, 0, 4.00, 'item612');
+INSERT INTO items VALUES (613, 1, 4.25, 'item613');
+INSERT INTO items VALUES (614, 2, 4.50, 'item614');
+INSERT INTO items VALUES (615, 0, 4.75, 'item615');
+INSERT INTO items VALUES (616, 1, 5.00, 'item616');
+INSERT INTO items VALUES (617, 2, 5.25, 'item617');
+INSERT INTO items VALUES (618, 0, 5.50, 'item618');
+INSERT INTO items VALUES (619, 1, 5.75, 'item619');
+INSERT INTO items VALUES (620, 2, 6.00, 'item620');
+INSERT INTO items VALUES (621, 0, 6.25, 'item621');
+INSERT INTO items VALUES (622, 1, 6.50, 'item622');
+INSERT INTO items VALUES (623, 2, 6.75, 'item623');
+INSERT INTO items VALUES (624, 0, 7.00, 'item624');
+INSERT INTO items VALUES (625, 1, 7.25, 'item625');
+INSERT INTO items VALUES (626, 2, 7.50, 'item626');
+INSERT INTO items VALUES (627, 0, 7.75, 'item627');
+INSERT INTO items VALUES (628, 1, 8.00, 'item628');
+INSERT INTO items VALUES (629, 2, 8.25, 'item629');
+INSERT INTO items VALUES (630, 0, 8.50, 'item630');
+INSERT INTO items VALUES (631, 1, 8.75, 'item631');
+INSERT INTO items VALUES (632, 2, 9.00, 'item632');
+INSERT INTO items VALUES (633, 0, 9.25, 'item633');
+INSERT INTO items VALUES (634, 1, 9.50, 'item634');
+INSERT INTO items VALUES (635, 2, 9.75, 'item635');
+INSERT INTO items VALUES (636, 0, 10.00, 'item636');
+INSERT INTO items VALUES (637, 1, 10.25, 'item637');
+INSERT INTO items VALUES (638, 2, 10.50, 'item638');
+INSERT INTO items VALUES (639, 0, 10.75, 'item639');
+INSERT INTO items VALUES (640, 1, 11.00, 'item640');
+INSERT INTO items VALUES (641, 2, 11.25, 'item641');
+INSERT INTO items VALUES (642, 0, 11.50, 'item642');
+INSERT INTO items VALUES (643, 1, 11.75, 'item643');
+INSERT INTO items VALUES (644, 2, 12.00, 'item644');
+INSERT INTO items VALUES (645, 0, 12.25, 'item645');
+INSERT INTO items VALUES (646, 1, 12.50, 'item646');
+INSERT INTO items VALUES (647, 2, 12.75, 'item647');
+INSERT INTO items VALUES (648, 0, 13.00, 'item648');
+INSERT INTO items VALUES (649, 1, 13.25, 'item649');
+INSERT INTO items VALUES (650, 2, 1.00, 'item650');
+INSERT INTO items VALUES (651, 0, 1.25, 'item651');
+INSERT INTO items VALUES (652, 1, 1.50, 'item652');
+INSERT INTO items VALUES (653, 2, 1.75, 'item653');
+INSERT INTO items VALUES (654, 0, 2.00, 'item654');
+INSERT INTO items VALUES (655, 1, 2.25, 'item655');
+INSERT INTO items VALUES (656, 2, 2.50, 'item656');
+INSERT INTO items VALUES (657, 0, 2.75, 'item657');
+INSERT INTO items VALUES (658, 1, 3.00, 'item658');
+INSERT INTO items VALUES (659, 2, 3.25, 'item659');
+INSERT INTO items VALUES (660, 0, 3.50, 'item660');
+INSERT INTO items VALUES (661, 1, 3.75, 'item661');
+INSERT INTO items VALUES (662, 2, 4.00, 'item662');
+INSERT INTO items VALUES (663, 0, 4.25, 'item663');
+INSERT INTO items VALUES (664, 1, 4.50, 'item664');
+INSERT INTO items VALUES (665, 2, 4.75, 'item665');
+INSERT INTO items VALUES (666, 0, 5.00, 'item666');
+INSERT INTO items VALUES (667, 1, 5.25, 'item667');
+INSERT INTO items VALUES (668, 2, 5.50, 'item668');
+INSERT INTO items VALUES (669, 0, 5.75, 'item669');
+INSERT INTO items VALUES (670, 1, 6.00, 'item670');
+INSERT INTO items VALUES (671, 2, 6.25, 'item671');
+INSERT INTO items VALUES (672, 0, 6.50, 'item672');
+INSERT INTO items VALUES (673, 1, 6.75, 'item673');
+INSERT INTO items VALUES (674, 2, 7.00, 'item674');
+INSERT INTO items VALUES (675, 0, 7.25, 'item675');
+INSERT INTO items VALUES (676, 1, 7.50, 'item676');
+INSERT INTO items VALUES (677, 2, 7.75, 'item677');
+INSERT INTO items VALUES (678, 0, 8.00, 'item678');
+INSERT INTO items VALUES (679, 1, 8.25, 'item679');
+INSERT INTO items VALUES (680, 2, 8.50, 'item680');
+INSERT INTO items VALUES (681, 0, 8.75, 'item681');
+INSERT INTO items VALUES (682, 1, 9.00, 'item682');
+INSERT INTO items VALUES (683, 2, 9.25, 'item683');
+INSERT INTO items VALUES (684, 0, 9.50, 'item684');
+INSERT INTO items VALUES (685, 1, 9.75, 'item685');
+INSERT INTO items VALUES (686, 2, 10.00, 'item686');
+INSERT INTO items VALUES (687, 0, 10.25, 'item687');
+INSERT INTO items VALUES (688, 1, 10.50, 'item688');
+INSERT INTO items VALUES (689, 2, 10.75, 'item689');
+INSERT INTO items VALUES (690, 0, 11.00, 'item690');
+INSERT INTO items VALUES (691, 1, 11.25, 'item691');
+INSERT INTO items VALUES (692, 2, 11.50, 'item692');
+INSERT INTO items VALUES (693, 0, 11.75, 'item693');
+INSERT INTO items VALUES (694, 1, 12.00, 'item694');
+INSERT INTO items VALUES (695, 2, 12.25, 'item695');
+INSERT INTO items VALUES (696, 0, 12.50, 'item696');
+INSERT INTO items VALUES (697, 1, 12.75, 'item697');
+INSERT INTO items VALUES (698, 2, 13.00, 'item698');
+INSERT INTO items VALUES (699, 0, 13.25, 'item699');
+INSERT INTO items VALUES (700, 1, 1.00, 'item700');
+INSERT INTO items VALUES (701, 2, 1.25, 'item701');
+INSERT INTO items VALUES (702, 0, 1.50, 'item702');
+INSERT INTO items VALUES (703, 1, 1.75, 'item703');
+INSERT INTO items VALUES (704, 2, 2.00, 'item704');
+INSERT INTO items VALUES (705, 0, 2.25, 'item705');
+INSERT INTO items VALUES (706, 1, 2.50, 'item706');
+INSERT INTO items VALUES (707, 2, 2.75, 'item707');
+INSERT INTO items VALUES (708, 0, 3.00, 'item708');
+INSERT INTO items VALUES (709, 1, 3.25, 'item709');
+INSERT INTO items VALUES (710, 2, 3.50, 'item710');
+INSERT INTO items VALUES (711, 0, 3.75, 'item711');
+INSERT INTO items VALUES (712, 1, 4.00, 'item712');
+INSERT INTO items VALUES (713, 2, 4.25, 'item713');
+INSERT INTO items VALUES (714, 0, 4.50, 'item714');
+INSERT INTO items VALUES (715, 1, 4.75, 'item715');
+INSERT INTO items VALUES (716, 2, 5.00, 'item716');
+INSERT INTO items VALUES (717, 0, 5.25, 'item717');
+INSERT INTO items VALUES (718, 1, 5.50, 'item718');
+INSERT INTO items VALUES (719, 2, 5.75, 'item719');
+INSERT INTO items VALUES (720, 0, 6.00, 'item720');
+INSERT INTO items VALUES (721, 1, 6.25, 'item721');
+INSERT INTO items VALUES (722, 2, 6.50, 'item722');
+INSERT INTO items VALUES (723, 0, 6.75, 'item723');
+INSERT INTO items VALUES (724, 1, 7.00, 'item724');
+INSERT INTO items VALUES (725, 2, 7.25, 'item725');
+INSERT INTO items VALUES (726, 0, 7.50, 'item726');
+INSERT INTO items VALUES (727, 1, 7.75, 'item727');
+INSERT INTO items VALUES (728, 2, 8.00, 'item728');
+INSERT INTO items VALUES (729, 0, 8.25, 'item729');
+INSERT INTO items VALUES (730, 1, 8.50, 'item730');
+INSERT INTO items VALUES (731, 2, 8.75, 'item731');
+INSERT INTO items VALUES (732, 0, 9.00, 'item732');
+INSERT INTO items VALUES (733, 1, 9.25, 'item733');
+INSERT INTO items VALUES (734, 2, 9.50, 'item734');
+INSERT INTO items VALUES (735, 0, 9.75, 'item735');
+INSERT INTO items VALUES (736, 1, 10.00, 'item736');
+INSERT INTO items VALUES (737, 2, 10.25, 'item737');
+INSERT INTO items VALUES (738, 0, 10.50, 'item738');
+INSERT INTO items VALUES (739, 1, 10.75, 'item739');
+INSERT INTO items VALUES (740, 2, 11.00, 'item740');
+INSERT INTO items VALUES (741, 0, 11.25, 'item741');
+INSERT INTO items VALUES (742, 1, 11.50, 'item742');
+INSERT INTO items VALUES (743, 2, 11.75, 'item743');
+INSERT INTO items VALUES (744, 0, 12.00, 'item744');
+INSERT INTO items VALUES (745, 1, 12.25, 'item745');
+INSERT INTO items VALUES (746, 2, 12.50, 'item746');
+INSERT INTO items VALUES (747, 0, 12.75, 'item747');
+INSERT INTO items VALUES (748, 1, 13.00, 'item748');
+INSERT INTO items VALUES (749, 2, 13.25, 'item749');
+INSERT INTO items VALUES (750, 0, 1.00, 'item750');
+INSERT INTO items VALUES (751, 1, 1.25, 'item751');
+INSERT INTO items VALUES (752, 2, 1.50, 'item752');
+INSERT INTO items VALUES (753, 0, 1.75, 'item753');
+INSERT INTO items VALUES (754, 1, 2.00, 'item754');
+INSERT INTO items VALUES (755, 2, 2.25, 'item755');
+INSERT INTO items VALUES (756, 0, 2.50, 'item756');
+INSERT INTO items VALUES (757, 1, 2.75, 'item757');
+INSERT INTO items VALUES (758, 2, 3.00, 'item758');
+INSERT INTO items VALUES (759, 0, 3.25, 'item759');
+INSERT INTO items VALUES (760, 1, 3.50, 'item760');
+INSERT INTO items VALUES (761, 2, 3.75, 'item761');
+INSERT INTO items VALUES (762, 0, 4.00, 'item762');
+INSERT INTO items VALUES (763, 1, 4.25, 'item763');
+INSERT INTO items VALUES (764, 2, 4.50, 'item764');
+INSERT INTO items VALUES (765, 0, 4.75, 'item765');
+INSERT INTO items VALUES (766, 1, 5.00, 'item766');
+INSERT INTO items VALUES (767, 2, 5.25, 'item767');
+INSERT INTO items VALUES (768, 0, 5.50, 'item768');
+INSERT INTO items VALUES (769, 1, 5.75, 'item769');
+INSERT INTO items VALUES (770, 2, 6.00, 'item770');
+INSERT INTO items VALUES (771, 0, 6.25, 'item771');
+INSERT INTO items VALUES (772, 1, 6.50, 'item772');
+INSERT INTO items VALUES (773, 2, 6.75, 'item773');
+INSERT INTO items VALUES (774, 0, 7.00, 'item774');
+INSERT INTO items VALUES (775, 1, 7.25, 'item775');
+INSERT INTO items VALUES (776, 2, 7.50, 'item776');
+INSERT INTO items VALUES (777, 0, 7.75, 'item777');
+INSERT INTO items VALUES (778, 1, 8.00, 'item778');
+INSERT INTO items VALUES (779, 2, 8.25, 'item779');
+INSERT INTO items VALUES (780, 0, 8.50, 'item780');
+INSERT INTO items VALUES (781, 1, 8.75, 'item781');
+INSERT INTO items VALUES (782, 2, 9.00, 'item782');
+INSERT INTO items VALUES (783, 0, 9.25, 'item783');
+INSERT INTO items VALUES (784, 1, 9.50, 'item784');
+INSERT INTO items VALUES (785, 2, 9.75, 'item785');
+INSERT INTO items VALUES (786, 0, 10.00, 'item786');
+INSERT INTO items VALUES (787, 1, 10.25, 'item787');
+INSERT INTO items VALUES (788, 2, 10.50, 'item788');
+INSERT INTO items VALUES (789, 0, 10.75, 'item789');
+INSERT INTO items VALUES (790, 1, 11.00, 'item790');
+INSERT INTO items VALUES (791, 2, 11.25, 'item791');
+INSERT INTO items VALUES (792, 0, 11.50, 'item792');
+INSERT INTO items VALUES (793, 1, 11.75, 'item793');
+INSERT INTO items VALUES (794, 2, 12.00, 'item794');
+INSERT INTO items VALUES (795, 0, 12.25, 'item795');
+INSERT INTO items VALUES (796, 1, 12.50, 'item796');
+INSERT INTO items VALUES (797, 2, 12.75, 'item797');
+INSERT INTO items VALUES (798, 0, 13.00, 'item798');
+INSERT INTO items VALUES (799, 1, 13.25, 'item799');
+INSERT INTO items VALUES (800, 2, 1.00, 'item800');
+INSERT INTO items VALUES (801, 0, 1.25, 'item801');
+INSERT INTO items VALUES (802, 1, 1.50, 'item802');
+INSERT INTO items VALUES (803, 2, 1.75, 'item803');
+INSERT INTO items VALUES (804, 0, 2.00, 'item804');
+INSERT INTO items VALUES (805, 1, 2.25, 'item805');
+INSERT INTO items VALUES (806, 2, 2.50, 'item806');
+INSERT INTO items VALUES (807, 0, 2.75, 'item807');
+INSERT INTO items VALUES (808, 1, 3.00, 'item808');
+INSERT INTO items VALUES (809, 2, 3.25, 'item809');
+INSERT INTO items VALUES (810, 0, 3.50, 'item810');
+INSERT INTO items VALUES (811, 1, 3.75, 'item811');
+INSERT INTO items VALUES (812, 2, 4.00, 'item812');
+INSERT INTO items VALUES (813, 0, 4.25, 'item813');
+INSERT INTO items VALUES (814, 1, 4.50, 'item814');
+INSERT INTO items VALUES (815, 2, 4.75, 'item815');
+INSERT INTO items VALUES (816, 0, 5.00, 'item816');
+INSERT INTO items VALUES (817, 1, 5.25, 'item817');
+INSERT INTO items VALUES (818, 2, 5.50, 'item818');
+INSERT INTO items VALUES (819, 0, 5.75, 'item819');
+INSERT INTO items VALUES (820, 1, 6.00, 'item820');
+INSERT INTO items VALUES (821, 2, 6.25, 'item821');
+INSERT INTO items VALUES (822, 0, 6.50, 'item822');
+INSERT INTO items VALUES (823, 1, 6.75, 'item823');
+INSERT INTO items VALUES (824, 2, 7.00, 'item824');
+INSERT INTO items VALUES (825, 0, 7.25, 'item825');
+INSERT INTO items VALUES (826, 1, 7.50, 'item826');
+INSERT INTO items VALUES (827, 2, 7.75, 'item827');
+INSERT INTO items VALUES (828, 0, 8.00, 'item828');
+INSERT INTO items VALUES (829, 1, 8.25, 'item829');
+INSERT INTO items VALUES (830, 2, 8.50, 'item830');
+INSERT INTO items VALUES (831, 0, 8.75, 'item831');
+INSERT INTO items VALUES (832, 1, 9.00, 'item832');
+INSERT INTO items VALUES (833, 2, 9.25, 'item833');
+INSERT INTO items VALUES (834, 0, 9.50, 'item834');
+INSERT INTO items VALUES (835, 1, 9.75, 'item835');
+INSERT INTO items VALUES (836, 2, 10.00, 'item836');
+INSERT INTO items VALUES (837, 0, 10.25, 'item837');
+INSERT INTO items VALUES (838, 1, 10.50, 'item838');
+INSERT INTO items VALUES (839, 2, 10.75, 'item839');
+INSERT INTO items VALUES (840, 0, 11.00, 'item840');
+INSERT INTO items VALUES (841, 1, 11.25, 'item841');
+INSERT INTO items VALUES (842, 2, 11.50, 'item842');
+INSERT INTO items VALUES (843, 0, 11.75, 'item843');
+INSERT INTO items VALUES (844, 1, 12.00, 'item844');
+INSERT INTO items VALUES (845, 2, 12.25, 'item845');
+INSERT INTO items VALUES (846, 0, 12.50, 'item846');
+INSERT INTO items VALUES (847, 1, 12.75, 'item847');
+INSERT INTO items VALUES (848, 2, 13.00, 'item848');
+INSERT INTO items VALUES (849, 0, 13.25, 'item849');
+INSERT INTO items VALUES (850, 1, 1.00, 'item850');
+INSERT INTO items VALUES (851, 2, 1.25, 'item851');
+INSERT INTO items VALUES (852, 0, 1.50, 'item852');
+INSERT INTO items VALUES (853, 1, 1.75, 'item853');
+INSERT INTO items VALUES (854, 2, 2.00, 'item854');
+INSERT INTO items VALUES (855, 0, 2.25, 'item855');
+INSERT INTO items VALUES (856, 1, 2.50, 'item856');
+INSERT INTO items VALUES (857, 2, 2.75, 'item857');
+INSERT INTO items VALUES (858, 0, 3.00, 'item858');
+INSERT INTO items VALUES (859, 1, 3.25, 'item859');
+INSERT INTO items VALUES (860, 2, 3.50, 'item860');
+INSERT INTO items VALUES (861, 0, 3.75, 'item861');
+INSERT INTO items VALUES (862, 1, 4.00, 'item862');
+INSERT INTO items VALUES (863, 2, 4.25, 'item863');
+INSERT INTO items VALUES (864, 0, 4.50, 'item864');
+INSERT INTO items VALUES (865, 1, 4.75, 'item865');
+INSERT INTO items VALUES (866, 2, 5.00, 'item866');
+INSERT INTO items VALUES (867, 0, 5.25, 'item867');
+INSERT INTO items VALUES (868, 1, 5.50, 'item868');
+INSERT INTO items VALUES (869, 2, 5.75, 'item869');
+INSERT INTO items VALUES (870, 0, 6.00, 'item870');
+INSERT INTO items VALUES (871, 1, 6.25, 'item871');
+INSERT INTO items VALUES (872, 2, 6.50, 'item872');
+INSERT INTO items VALUES (873, 0, 6.75, 'item873');
+INSERT INTO items VALUES (874, 1, 7.00, 'item874');
+INSERT INTO items VALUES (875, 2, 7.25, 'item875');
+INSERT INTO items VALUES (876, 0, 7.50, 'item876');
+INSERT INTO items VALUES (877, 1, 7.75, 'item877');
+INSERT INTO items VALUES (878, 2, 8.00, 'item878');
+INSERT INTO items VALUES (879, 0, 8.25, 'item879');
+INSERT INTO items VALUES (880, 1, 8.50, 'item880');
+INSERT INTO items VALUES (881, 2, 8.75, 'item881');
+INSERT INTO items VALUES (882, 0, 9.00, 'item882');
+INSERT INTO items VALUES (883, 1, 9.25, 'item883');
+INSERT INTO items VALUES (884, 2, 9.50, 'item884');
+INSERT INTO items VALUES (885, 0, 9.75, 'item885');
+INSERT INTO items VALUES (886, 1, 10.00, 'item886');
+INSERT INTO items VALUES (887, 2, 10.25, 'item887');
+INSERT INTO items VALUES (888, 0, 10.50, 'item888');
+INSERT INTO items VALUES (889, 1, 10.75, 'item889');
+INSERT INTO items VALUES (890, 2, 11.00, 'item890');
+INSERT INTO items VALUES (891, 0, 11.25, 'item891');
+INSERT INTO items VALUES (892, 1, 11.50, 'item892');
+INSERT INTO items VALUES (893, 2, 11.75, 'item893');
+INSERT INTO items VALUES (894, 0, 12.00, 'item894');
+INSERT INTO items VALUES (895, 1, 12.25, 'item895');
+INSERT INTO items VALUES (896, 2, 12.50, 'item896');
+INSERT INTO items VALUES (897, 0, 12.75, 'item897');
+INSERT INTO items VALUES (898, 1, 13.00, 'item898');
+INSERT INTO items VALUES (899, 2, 13.25, 'item899');
+INSERT INTO items VALUES (900, 0, 1.00, 'item900');
+INSERT INTO items VALUES (901, 1, 1.25, 'item901');
+INSERT INTO items VALUES (902, 2, 1.50, 'item902');
+INSERT INTO items VALUES (903, 0, 1.75, 'item903');
+INSERT INTO items VALUES (904, 1, 2.00, 'item904');
+INSERT INTO items VALUES (905, 2, 2.25, 'item905');
+INSERT INTO items VALUES (906, 0, 2.50, 'item906');
+INSERT INTO items VALUES (907, 1, 2.75, 'item907');
+INSERT INTO items VALUES (908, 2, 3.00, 'item908');
+INSERT INTO items VALUES (909, 0, 3.25, 'item909');
+INSERT INTO items VALUES (910, 1, 3.50, 'item910');
+INSERT INTO items VALUES (911, 2, 3.75, 'item911');
+INSERT INTO items VALUES (912, 0, 4.00, 'item912');
+INSERT INTO items VALUES (913, 1, 4.25, 'item913');
+INSERT INTO items VALUES (914, 2, 4.50, 'item914');
+INSERT INTO items VALUES (915, 0, 4.75, 'item915');
+INSERT INTO items VALUES (916, 1, 5.00, 'item916');
+INSERT INTO items VALUES (917, 2, 5.25, 'item917');
+INSERT INTO items VALUES (918, 0, 5.50, 'item918');
+INSERT INTO items VALUES (919, 1, 5.75, 'item919');
+INSERT INTO items VALUES (920, 2, 6.00, 'item920');
+INSERT INTO items VALUES (921, 0, 6.25, 'item921');
+INSERT INTO items VALUES (922, 1, 6.50, 'item922');
+INSERT INTO items VALUES (923, 2, 6.75, 'item923');
+INSERT INTO items VALUES (924, 0, 7.00, 'item924');
+INSERT INTO items VALUES (925, 1, 7.25, 'item925');
+INSERT INTO items VALUES (926, 2, 7.50, 'item926');
+INSERT INTO items VALUES (927, 0, 7.75, 'item927');
+INSERT INTO items VALUES (928, 1, 8.00, 'item928');
+INSERT INTO items VALUES (929, 2, 8.25, 'item929');
+INSERT INTO items VALUES (930, 0, 8.50, 'item930');
+INSERT INTO items VALUES (931, 1, 8.75, 'item931');
+INSERT INTO items VALUES (932, 2, 9.00, 'item932');
+INSERT INTO items VALUES (933, 0, 9.25, 'item933');
+INSERT INTO items VALUES (934, 1, 9.50, 'item934');
+INSERT INTO items VALUES (935, 2, 9.75, 'item935');
+INSERT INTO items VALUES (936, 0, 10.00, 'item936');
+INSERT INTO items VALUES (937, 1, 10.25, 'item937');
+INSERT INTO items VALUES (938, 2, 10.50, 'item938');
+INSERT INTO items VALUES (939, 0, 10.75, 'item939');
+INSERT INTO items VALUES (940, 1, 11.00, 'item940');
+INSERT INTO items VALUES (941, 2, 11.25, 'item941');
+INSERT INTO items VALUES (942, 0, 11.50, 'item942');
+INSERT INTO items VALUES (943, 1, 11.75, 'item943');
+INSERT INTO items VALUES (944, 2, 12.00, 'item944');
+INSERT INTO items VALUES (945, 0, 12.25, 'item945');
+INSERT INTO items VALUES (946, 1, 12.50, 'item946');
+INSERT INTO items VALUES (947, 2, 12.75, 'item947');
+INSERT INTO items VALUES (948, 0, 13.00, 'item948');
+INSERT INTO items VALUES (949, 1, 13.25, 'item949');
+INSERT INTO items VALUES (950, 2, 1.00, 'item950');
+INSERT INTO items VALUES (951, 0, 1.25, 'item951');
+INSERT INTO items VALUES (952, 1, 1.50, 'item952');
+INSERT INTO items VALUES (953, 2, 1.75, 'item953');
+INSERT INTO items VALUES (954, 0, 2.00, 'item954');
+INSERT INTO items VALUES (955, 1, 2.25, 'item955');
+INSERT INTO items VALUES (956, 2, 2.50, 'item956');
+INSERT INTO items VALUES (957, 0, 2.75, 'item957');
+INSERT INTO items VALUES (958, 1, 3.00, 'item958');
+INSERT INTO items VALUES (959, 2, 3.25, 'item959');
+INSERT INTO items VALUES (960, 0, 3.50, 'item960');
+INSERT INTO items VALUES (961, 1, 3.75, 'item961');
+INSERT INTO items VALUES (962, 2, 4.00, 'item962');
+INSERT INTO items VALUES (963, 0, 4.25, 'item963');
+INSERT INTO items VALUES (964, 1, 4.50, 'item964');
+INSERT INTO items VALUES (965, 2, 4.75, 'item965');
+INSERT INTO items VALUES (966, 0, 5.00, 'item966');
+INSERT INTO items VALUES (967, 1, 5.25, 'item967');
+INSERT INTO items VALUES (968, 2, 5.50, 'item968');
+INSERT INTO items VALUES (969, 0, 5.75, 'item969');
+INSERT INTO items VALUES (970, 1, 6.00, 'item970');
+INSERT INTO items VALUES (971, 2, 6.25, 'item971');
+INSERT INTO items VALUES (972, 0, 6.50, 'item972');
+INSERT INTO items VALUES (973, 1, 6.75, 'item973');
+INSERT INTO items VALUES (974, 2, 7.00, 'item974');
+INSERT INTO items VALUES (975, 0, 7.25, 'item975');
+INSERT INTO items VALUES (976, 1, 7.50, 'item976');
+INSERT INTO items VALUES (977, 2, 7.75, 'item977');
+INSERT INTO items VALUES (978, 0, 8.00, 'item978');
+INSERT INTO items VALUES (979, 1, 8.25, 'item979');
+INSERT INTO items VALUES (980, 2, 8.50, 'item980');
+INSERT INTO items VALUES (981, 0, 8.75, 'item981');
+INSERT INTO items VALUES (982, 1, 9.00, 'item982');
+INSERT INTO items VALUES (983, 2, 9.25, 'item983');
+INSERT INTO items VALUES (984, 0, 9.50, 'item984');
+INSERT INTO items VALUES (985, 1, 9.75, 'item985');
+INSERT INTO items VALUES (986, 2, 10.00, 'item986');
+INSERT INTO items VALUES (987, 0, 10.25, 'item987');
+INSERT INTO items VALUES (988, 1, 10.50, 'item988');
+INSERT INTO items VALUES (989, 2, 10.75, 'item989');
+INSERT INTO items VALUES (990, 0, 11.00, 'item990');
+INSERT INTO items VALUES (991, 1, 11.25, 'item991');
+INSERT INTO items VALUES (992, 2, 11.50, 'item992');
+INSERT INTO items VALUES (993, 0, 11.75, 'item993');
+INSERT INTO items VALUES (994, 1, 12.00, 'item994');
+INSERT INTO items VALUES (995, 2, 12.25, 'item995');
+INSERT INTO items VALUES (996, 0, 12.50, 'item996');
+INSERT INTO items VALUES (997, 1, 12.75, 'item997');
+INSERT INTO items VALUES (998, 2, 13.00, 'item998');
+INSERT INTO items VALUES (999, 0, 13.25, 'item999');
+INSERT INTO items VALUES (1000, 1, 1.00, 'item1000');
+INSERT INTO items VALUES (1001, 2, 1.25, 'item1001');
+INSERT INTO items VALUES (1002, 0, 1.50, 'item1002');
+INSERT INTO items VALUES (1003, 1, 1.75, 'item1003');
+INSERT INTO items VALUES (1004, 2, 2.00, 'item1004');
+INSERT INTO items VALUES (1005, 0, 2.25, 'item1005');
+INSERT INTO items VALUES (1006, 1, 2.50, 'item1006');
+INSERT INTO items VALUES (1007, 2, 2.75, 'item1007');
+INSERT INTO items VALUES (1008, 0, 3.00, 'item1008');
+INSERT INTO items VALUES (1009, 1, 3.25, 'item1009');
+INSERT INTO items VALUES (1010, 2, 3.50, 'item1010');
+INSERT INTO items VALUES (1011, 0, 3.75, 'item1011');
+INSERT INTO items VALUES (1012, 1, 4.00, 'item1012');
+INSERT INTO items VALUES (1013, 2, 4.25, 'item1013');
+INSERT INTO items VALUES (1014, 0, 4.50, 'item1014');
+INSERT INTO items VALUES (1015, 1, 4.75, 'item1015');
+INSERT INTO items VALUES (1016, 2, 5.00, 'item1016');
+INSERT INTO items VALUES (1017, 0, 5.25, 'item1017');
+INSERT INTO items VALUES (1018, 1, 5.50, 'item1018');
+INSERT INTO items VALUES (1019, 2, 5.75, 'item1019');
+INSERT INTO items VALUES (1020, 0, 6.00, 'item1020');
+INSERT INTO items VALUES (1021, 1, 6.25, 'item1021');
+INSERT INTO items VALUES (1022, 2, 6.50, 'item1022');
+INSERT INTO items VALUES (1023, 0, 6.75, 'item1023');
+INSERT INTO items VALUES (1024, 1, 7.00, 'item1024');
+INSERT INTO items VALUES (1025, 2, 7.25, 'item1025');
+INSERT INTO items VALUES (1026, 0, 7.50, 'item1026');
+INSERT INTO items VALUES (1027, 1, 7.75, 'item1027');
+INSERT INTO items VALUES (1028, 2, 8.00, 'item1028');
+INSERT INTO items VALUES (1029, 0, 8.25, 'item1029');
+INSERT INTO items VALUES (1030, 1, 8.50, 'item1030');
+INSERT INTO items VALUES (1031, 2, 8.75, 'item1031');
+INSERT INTO items VALUES (1032, 0, 9.00, 'item1032');
+INSERT INTO items VALUES (1033, 1, 9.25, 'item1033');
+INSERT INTO items VALUES (1034, 2, 9.50, 'item1034');
+INSERT INTO items VALUES (1035, 0, 9.75, 'item1035');
+INSERT INTO items VALUES (1036, 1, 10.00, 'item1036');
+INSERT INTO items VALUES (1037, 2, 10.25, 'item1037');
+INSERT INTO items VALUES (1038, 0, 10.50, 'item1038');
+INSERT INTO items VALUES (1039, 1, 10.75, 'item1039');
+INSERT INTO items VALUES (1040, 2, 11.00, 'item1040');
+INSERT INTO items VALUES (1041, 0, 11.25, 'item1041');
+INSERT INTO items VALUES (1042, 1, 11.50, 'item1042');
+INSERT INTO items VALUES (1043, 2, 11.75, 'item1043');
+INSERT INTO items VALUES (1044, 0, 12.00, 'item1044');
+INSERT INTO items VALUES (1045, 1, 12.25, 'item1045');
+INSERT INTO items VALUES (1046, 2, 12.50, 'item1046');
+INSERT INTO items VALUES (1047, 0, 12.75, 'item1047');
+INSERT INTO items VALUES (1048, 1, 13.00, 'item1048');
+INSERT INTO items VALUES (1049, 2, 13.25, 'item1049');
+INSERT INTO items VALUES (1050, 0, 1.00, 'item1050');
+INSERT INTO items VALUES (1051, 1, 1.25, 'item1051');
+INSERT INTO items VALUES (1052, 2, 1.50, 'item1052');
+INSERT INTO items VALUES (1053, 0, 1.75, 'item1053');
+INSERT INTO items VALUES (1054, 1, 2.00, 'item1054');
+INSERT INTO items VALUES (1055, 2, 2.25, 'item1055');
+INSERT INTO items VALUES (1056, 0, 2.50, 'item1056');
+INSERT INTO items VALUES (1057, 1, 2.75, 'item1057');
+INSERT INTO items VALUES (1058, 2, 3.00, 'item1058');
+INSERT INTO items VALUES (1059, 0, 3.25, 'item1059');
+INSERT INTO items VALUES (1060, 1, 3.50, 'item1060');
+INSERT INTO items VALUES (1061, 2, 3.75, 'item1061');
+INSERT INTO items VALUES (1062, 0, 4.00, 'item1062');
+INSERT INTO items VALUES (1063, 1, 4.25, 'item1063');
+INSERT INTO items VALUES (1064, 2, 4.50, 'item1064');
+INSERT INTO items VALUES (1065, 0, 4.75, 'item1065');
+INSERT INTO items VALUES (1066, 1, 5.00, 'item1066');
+INSERT INTO items VALUES (1067, 2, 5.25, 'item1067');
+INSERT INTO items VALUES (1068, 0, 5.50, 'item1068');
+INSERT INTO items VALUES (1069, 1, 5.75, 'item1069');
+INSERT INTO items VALUES (1070, 2, 6.00, 'item1070');
+INSERT INTO items VALUES (1071, 0, 6.25, 'item1071');
+INSERT INTO items VALUES (1072, 1, 6.50, 'item1072');
+INSERT INTO items VALUES (1073, 2, 6.75, 'item1073');
+INSERT INTO items VALUES (1074, 0, 7.00, 'item1074');
+INSERT INTO items VALUES (1075, 1, 7.25, 'item1075');
+INSERT INTO items VALUES (1076, 2, 7.50, 'item1076');
+INSERT INTO items VALUES (1077, 0, 7.75, 'item1077');
+INSERT INTO items VALUES (1078, 1, 8.00, 'item1078');
+INSERT INTO items VALUES (1079, 2, 8.25, 'item1079');
+INSERT INTO items VALUES (1080, 0, 8.50, 'item1080');
+INSERT INTO items VALUES (1081, 1, 8.75, 'item1081');
+INSERT INTO items VALUES (1082, 2, 9.00, 'item1082');
+INSERT INTO items VALUES (1083, 0, 9.25, 'item1083');
+INSERT INTO items VALUES (1084, 1, 9.50, 'item1084');
+INSERT INTO items VALUES (1085, 2, 9.75, 'item1085');
+INSERT INTO items VALUES (1086, 0, 10.00, 'item1086');
+INSERT INTO items VALUES (1087, 1, 10.25, 'item1087');
+INSERT INTO items VALUES (1088, 2, 10.50, 'item1088');
+INSERT INTO items VALUES (1089, 0, 10.75, 'item1089');
+INSERT INTO items VALUES (1090, 1, 11.00, 'item1090');
+INSERT INTO items VALUES (1091, 2, 11.25, 'item1091');
+INSERT INTO items VALUES (1092, 0, 11.50, 'item1092');
+INSERT INTO items VALUES (1093, 1, 11.75, 'item1093');
+INSERT INTO items VALUES (1094, 2, 12.00, 'item1094');
+INSERT INTO items VALUES (1095, 0, 12.25, 'item1095');
+INSERT INTO items VALUES (1096, 1, 12.50, 'item1096');
+INSERT INTO items VALUES (1097, 2, 12.75, 'item1097');
+INSERT INTO items VALUES (1098, 0, 13.00, 'item1098');
+INSERT INTO items VALUES (1099, 1, 13.25, 'item1099');
+INSERT INTO items VALUES (1100, 2, 1.00, 'item1100');
+INSERT INTO items VALUES (1101, 0, 1.25, 'item1101');
+INSERT INTO items VALUES (1102, 1, 1.50, 'item1102');
+INSERT INTO items VALUES (1103, 2, 1.75, 'item1103');
+INSERT INTO items VALUES (1104, 0, 2.00, 'item1104');
+INSERT INTO items VALUES (1105, 1, 2.25, 'item1105');
+INSERT INTO items VALUES (1106, 2, 2.50, 'item1106');
+INSERT INTO items VALUES (1107, 0, 2.75, 'item1107');
+INSERT INTO items VALUES (1108, 1, 3.00, 'item1108');
+INSERT INTO items VALUES (1109, 2, 3.25, 'item1109');
+INSERT INTO items VALUES (1110, 0, 3.50, 'item1110');
+INSERT INTO items VALUES (1111, 1, 3.75, 'item1111');
+INSERT INTO items VALUES (1112, 2, 4.00, 'item1112');
+INSERT INTO items VALUES (1113, 0, 4.25, 'item1113');
+INSERT INTO items VALUES (1114, 1, 4.50, 'item1114');
+INSERT INTO items VALUES (1115, 2, 4.75, 'item1115');
+INSERT INTO items VALUES (1116, 0, 5.00, 'item1116');
+INSERT INTO items VALUES (1117, 1, 5.25, 'item1117');
+INSERT INTO items VALUES (1118, 2, 5.50, 'item1118');
+INSERT INTO items VALUES (1119, 0, 5.75, 'item1119');
+INSERT INTO items VALUES (1120, 1, 6.00, 'item1120');
+INSERT INTO items VALUES (1121, 2, 6.25, 'item1121');
+INSERT INTO items VALUES (1122, 0, 6.50, 'item1122');
+INSERT INTO items VALUES (1123, 1, 6.75, 'item1123');
+INSERT INTO items VALUES (1124, 2, 7.00, 'item1124');
+INSERT INTO items VALUES (1125, 0, 7.25, 'item1125');
+INSERT INTO items VALUES (1126, 1, 7.50, 'item1126');
+INSERT INTO items VALUES (1127, 2, 7.75, 'item1127');
+INSERT INTO items VALUES (1128, 0, 8.00, 'item1128');
+INSERT INTO items VALUES (1129, 1, 8.25, 'item1129');
+INSERT INTO items VALUES (1130, 2, 8.50, 'item1130');
+INSERT INTO items VALUES (1131, 0, 8.75, 'item1131');
+INSERT INTO items VALUES (1132, 1, 9.00, 'item1132');
+INSERT INTO items VALUES (1133, 2, 9.25, 'item1133');
+INSERT INTO items VALUES (1134, 0, 9.50, 'item1134');
+INSERT INTO items VALUES (1135, 1, 9.75, 'item1135');
+INSERT INTO items VALUES (1136, 2, 10.00, 'item1136');
+INSERT INTO items VALUES (1137, 0, 10.25, 'item1137');
+INSERT INTO items VALUES (1138, 1, 10.50, 'item1138');
+INSERT INTO items VALUES (1139, 2, 10.75, 'item1139');
+INSERT INTO items VALUES (1140, 0, 11.00, 'item1140');
+INSERT INTO items VALUES (1141, 1, 11.25, 'item1141');
+INSERT INTO items VALUES (1142, 2, 11.50, 'item1142');
+INSERT INTO items VALUES (1143, 0, 11.75, 'item1143');
+INSERT INTO items VALUES (1144, 1, 12.00, 'item1144');
+INSERT INTO items VALUES (1145, 2, 12.25, 'item1145');
+INSERT INTO items VALUES (1146, 0, 12.50, 'item1146');
+INSERT INTO items VALUES (1147, 1, 12.75, 'item1147');
+INSERT INTO items VALUES (1148, 2, 13.00, 'item1148');
+INSERT INTO items VALUES (1149, 0, 13.25, 'item1149');
+INSERT INTO items VALUES (1150, 1, 1.00, 'item1150');
+INSERT INTO items VALUES (1151, 2, 1.25, 'item1151');
+INSERT INTO items VALUES (1152, 0, 1.50, 'item1152');
+INSERT INTO items VALUES (1153, 1, 1.75, 'item1153');
+INSERT INTO items VALUES (1154, 2, 2.00, 'item1154');
+INSERT INTO items VALUES (1155, 0, 2.25, 'item1155');
+INSERT INTO items VALUES (1156, 1, 2.50, 'item1156');
+INSERT INTO items VALUES (1157, 2, 2.75, 'item1157');
+INSERT INTO items VALUES (1158, 0, 3.00, 'item1158');
+INSERT INTO items VALUES (1159, 1, 3.25, 'item1159');
+INSERT INTO items VALUES (1160, 2, 3.50, 'item1160');
+INSERT INTO items VALUES (1161, 0, 3.75, 'item1161');
+INSERT INTO items VALUES (1162, 1, 4.00, 'item1162');
+INSERT INTO items VALUES (1163, 2, 4.25, 'item1163');
+INSERT INTO items VALUES (1164, 0, 4.50, 'item1164');
+INSERT INTO items VALUES (1165, 1, 4.75, 'item1165');
+INSERT INTO items VALUES (1166, 2, 5.00, 'item1166');
+INSERT INTO items VALUES (1167, 0, 5.25, 'item1167');
+INSERT INTO items VALUES (1168, 1, 5.50, 'item1168');
+INSERT INTO items VALUES (1169, 2, 5.75, 'item1169');
+INSERT INTO items VALUES (1170, 0, 6.00, 'item1170');
+INSERT INTO items VALUES (1171, 1, 6.25, 'item1171');
+INSERT INTO items VALUES (1172, 2, 6.50, 'item1172');
+INSERT INTO items VALUES (1173, 0, 6.75, 'item1173');
+INSERT INTO items VALUES (1174, 1, 7.00, 'item1174');
+INSERT INTO items VALUES (1175, 2, 7.25, 'item1175');
+INSERT INTO items VALUES (1176, 0, 7.50, 'item1176');
+INSERT INTO items VALUES (1177, 1, 7.75, 'item1177');
+INSERT INTO items VALUES (1178, 2, 8.00, 'item1178');
+INSERT INTO items VALUES (1179, 0, 8.25, 'item1179');
+INSERT INTO items VALUES (1180, 1, 8.50, 'item1180');
+INSERT INTO items VALUES (1181, 2, 8.75, 'item1181');
+INSERT INTO items VALUES (1182, 0, 9.00, 'item1182');
+INSERT INTO items VALUES (1183, 1, 9.25, 'item1183');
+INSERT INTO items VALUES (1184, 2, 9.50, 'item1184');
+INSERT INTO items VALUES (1185, 0, 9.75, 'item1185');
+INSERT INTO items VALUES (1186, 1, 10.00, 'item1186');
+INSERT INTO items VALUES (1187, 2, 10.25, 'item1187');
+INSERT INTO items VALUES (1188, 0, 10.50, 'item1188');
+INSERT INTO items VALUES (1189, 1, 10.75, 'item1189');
+INSERT INTO items VALUES (1190, 2, 11.00, 'item1190');
+INSERT INTO items VALUES (1191, 0, 11.25, 'item1191');
+INSERT INTO items VALUES (1192, 1, 11.50, 'item1192');
+INSERT INTO items VALUES (1193, 2, 11.75, 'item1193');
+INSERT INTO items VALUES (1194, 0, 12.00, 'item1194');
+INSERT INTO items VALUES (1195, 1, 12.25, 'item1195');
+INSERT INTO items VALUES (1196, 2, 12.50, 'item1196');
+INSERT INTO items VALUES (1197, 0, 12.75, 'item1197');
+INSERT INTO items VALUES (1198, 1, 13.00, 'item1198');
+INSERT INTO items VALUES (1199, 2, 13.25, 'item1199');
+INSERT INTO items VALUES (1200, 0, 1.00, 'item1200');
+INSERT INTO items VALUES (1201, 1, 1.25, 'item1201');
+INSERT INTO items VALUES (1202, 2, 1.50, 'item1202');
+INSERT INTO items VALUES (1203, 0, 1.75, 'item1203');
+INSERT INTO items VALUES (1204, 1, 2.00, 'item1204');
+INSERT INTO items VALUES (1205, 2, 2.25, 'item1205');
+INSERT INTO items VALUES (1206, 0, 2.50, 'item1206');
+INSERT INTO items VALUES (1207, 1, 2.75, 'item1207');
+INSERT INTO items VALUES (1208, 2, 3.00, 'item1208');
+INSERT INTO items VALUES (1209, 0, 3.25, 'item1209');
+INSERT INTO items VALUES (1210, 1, 3.50, 'item1210');
+INSERT INTO items VALUES (1211, 2, 3.75, 'item1211');
+INSERT INTO items VALUES (1212, 0, 4.00, 'item1212');
+INSERT INTO items VALUES (1213, 1, 4.25, 'item1213');
+INSERT INTO items VALUES (1214, 2, 4.50, 'item1214');
+INSERT INTO items VALUES (1215, 0, 4.75, 'item1215');
+INSERT INTO items VALUES (1216, 1, 5.00, 'item1216');
+INSERT INTO items VALUES (1217, 2, 5.25, 'item1217');
+INSERT INTO items VALUES (1218, 0, 5.50, 'item1218');
+INSERT INTO items VALUES (1219, 1, 5.75, 'item1219');
+INSERT INTO items VALUES (1220, 2, 6.00, 'item1220');
+INSERT INTO items VALUES (1221, 0, 6.25, 'item1221');
+INSERT INTO items VALUES (1222, 1, 6.50, 'item1222');
+INSERT INTO items VALUES (1223, 2, 6.75, 'item1223');
+INSERT INTO items VALUES (1224, 0, 7.00, 'item1224');
+INSERT INTO items VALUES (1225, 1, 7.25, 'item1225');
+INSERT INTO items VALUES (1226, 2, 7.50, 'item1226');
+INSERT INTO items VALUES (1227, 0, 7.75, 'item1227');
+INSERT INTO items VALUES (1228, 1, 8.00, 'item1228');
+INSERT INTO items VALUES (1229, 2, 8.25, 'item1229');
+INSERT INTO items VALUES (1230, 0, 8.50, 'item1230');
+INSERT INTO items VALUES (1231, 1, 8.75, 'item1231');
+INSERT INTO items VALUES (1232, 2, 9.00, 'item1232');
+INSERT INTO items VALUES (1233, 0, 9.25, 'item1233');
+INSERT INTO items VALUES (1234, 1, 9.50, 'item1234');
+INSERT INTO items VALUES (1235, 2, 9.75, 'item1235');
+INSERT INTO items VALUES (1236, 0, 10.00, 'item1236');
+INSERT INTO items VALUES (1237, 1, 10.25, 'item1237');
+INSERT INTO items VALUES (1238, 2, 10.50, 'item1238');
+INSERT INTO items VALUES (1239, 0, 10.75, 'item1239');
+INSERT INTO items VALUES (1240, 1, 11.00, 'item1240');
+INSERT INTO items VALUES (1241, 2, 11.25, 'item1241');
+INSERT INTO items VALUES (1242, 0, 11.50, 'item1242');
+INSERT INTO items VALUES (1243, 1, 11.75, 'item1243');
+INSERT INTO items VALUES (1244, 2, 12.00, 'item1244');
+INSERT INTO items VALUES (1245, 0, 12.25, 'item1245');
+INSERT INTO items VALUES (1246, 1, 12.50, 'item1246');
+INSERT INTO items VALUES (1247, 2, 12.75, 'item1247');
+INSERT INTO items VALUES (1248, 0, 13.00, 'item1248');
+INSERT INTO items VALUES (1249, 1, 13.25, 'item1249');
+INSERT INTO items VALUES (1250, 2, 1.00, 'item1250');
+INSERT INTO items VALUES (1251, 0, 1.25, 'item1251');
+INSERT INTO items VALUES (1252, 1, 1.50, 'item1252');
+INSERT INTO items VALUES (1253, 2, 1.75, 'item1253');
+INSERT INTO items VALUES (1254, 0, 2.00, 'item1254');
+INSERT INTO items VALUES (1255, 1, 2.25, 'item1255');
+INSERT INTO items VALUES (1256, 2, 2.50, 'item1256');
+INSERT INTO items VALUES (1257, 0, 2.75, 'item1257');
+INSERT INTO items VALUES (1258, 1, 3.00, 'item1258');
+INSERT INTO items VALUES (1259, 2, 3.25, 'item1259');
+INSERT INTO items VALUES (1260, 0, 3.50, 'item1260');
+INSERT INTO items VALUES (1261, 1, 3.75, 'item1261');
+INSERT INTO items VALUES (1262, 2, 4.00, 'item1262');
+INSERT INTO items VALUES (1263, 0, 4.25, 'item1263');
+INSERT INTO items VALUES (1264, 1, 4.50, 'item1264');
+INSERT INTO items VALUES (1265, 2, 4.75, 'item1265');
+INSERT INTO items VALUES (1266, 0, 5.00, 'item1266');
+INSERT INTO items VALUES (1267, 1, 5.25, 'item1267');
+INSERT INTO items VALUES (1268, 2, 5.50, 'item1268');
+INSERT INTO items VALUES (1269, 0, 5.75, 'item1269');
+INSERT INTO items VALUES (1270, 1, 6.00, 'item1270');
+INSERT INTO items VALUES (1271, 2, 6.25, 'item1271');
+INSERT INTO items VALUES (1272, 0, 6.50, 'item1272');
+INSERT INTO items VALUES (1273, 1, 6.75, 'item1273');
+INSERT INTO items VALUES (1274, 2, 7.00, 'item1274');
+INSERT INTO items VALUES (1275, 0, 7.25, 'item1275');
+INSERT INTO items VALUES (1276, 1, 7.50, 'item1276');
+INSERT INTO items VALUES (1277, 2, 7.75, 'item1277');
+INSERT INTO items VALUES (1278, 0, 8.00, 'item1278');
+INSERT INTO items VALUES (1279, 1, 8.25, 'item1279');
+INSERT INTO items VALUES (1280, 2, 8.50, 'item1280');
+INSERT INTO items VALUES (1281, 0, 8.75, 'item1281');
+INSERT INTO items VALUES (1282, 1, 9.00, 'item1282');
+INSERT INTO items VALUES (1283, 2, 9.25, 'item1283');
+INSERT INTO items VALUES (1284, 0, 9.50, 'item1284');
+INSERT INTO items VALUES (1285, 1, 9.75, 'item1285');
+INSERT INTO items VALUES (1286, 2, 10.00, 'item1286');
+INSERT INTO items VALUES (1287, 0, 10.25, 'item1287');
+INSERT INTO items VALUES (1288, 1, 10.50, 'item1288');
+INSERT INTO items VALUES (1289, 2, 10.75, 'item1289');
+INSERT INTO items VALUES (1290, 0, 11.00, 'item1290');
+INSERT INTO items VALUES (1291, 1, 11.25, 'item1291');
+INSERT INTO items VALUES (1292, 2, 11.50, 'item1292');
+INSERT INTO items VALUES (1293, 0, 11.75, 'item1293');
+INSERT INTO items VALUES (1294, 1, 12.00, 'item1294');
+INSERT INTO items VALUES (1295, 2, 12.25, 'item1295');
+INSERT INTO items VALUES (1296, 0, 12.50, 'item1296');
+INSERT INTO items VALUES (1297, 1, 12.75, 'item1297');
+INSERT INTO items VALUES (1298, 2, 13.00, 'item1298');
+INSERT INTO items VALUES (1299, 0, 13.25, 'item1299');
+INSERT INTO items VALUES (1300, 1, 1.00, 'item1300');
+INSERT INTO items VALUES (1301, 2, 1.25, 'item1301');
+INSERT INTO items VALUES (1302, 0, 1.50, 'item1302');
+INSERT INTO items VALUES (1303, 1, 1.75, 'item1303');
+INSERT INTO items VALUES (1304, 2, 2.00, 'item1304');
+INSERT INTO items VALUES (1305, 0, 2.25, 'item1305');
+INSERT INTO items VALUES (1306, 1, 2.50, 'item1306');
+INSERT INTO items VALUES (1307, 2, 2.75, 'item1307');
+INSERT INTO items VALUES (1308, 0, 3.00, 'item1308');
+INSERT INTO items VALUES (1309, 1, 3.25, 'item1309');
+INSERT INTO items VALUES (1310, 2, 3.50, 'item1310');
+INSERT INTO items VALUES (1311, 0, 3.75, 'item1311');
+INSERT INTO items VALUES (1312, 1, 4.00, 'item1312');
+INSERT INTO items VALUES (1313, 2, 4.25, 'item1313');
+INSERT INTO items VALUES (1314, 0, 4.50, 'item1314');
+INSERT INTO items VALUES (1315, 1, 4.75, 'item1315');
+INSERT INTO items VALUES (1316, 2, 5.00, 'item1316');
+INSERT INTO items VALUES (1317, 0, 5.25, 'item1317');
+INSERT INTO items VALUES (1318, 1, 5.50, 'item1318');
+INSERT INTO items VALUES (1319, 2, 5.75, 'item1319');
+INSERT INTO items VALUES (1320, 0, 6.00, 'item1320');
+INSERT INTO items VALUES (1321, 1, 6.25, 'item1321');
+INSERT INTO items VALUES (1322, 2, 6.50, 'item1322');
+INSERT INTO items VALUES (1323, 0, 6.75, 'item1323');
+INSERT INTO items VALUES (1324, 1, 7.00, 'item1324');
+INSERT INTO items VALUES (1325, 2, 7.25, 'item1325');
+INSERT INTO items VALUES (1326, 0, 7.50, 'item1326');
+INSERT INTO items VALUES (1327, 1, 7.75, 'item1327');
+INSERT INTO items VALUES (1328, 2, 8.00, 'item1328');
+INSERT INTO items VALUES (1329, 0, 8.25, 'item1329');
+INSERT INTO items VALUES (1330, 1, 8.50, 'item1330');
+INSERT INTO items VALUES (1331, 2, 8.75, 'item1331');
+INSERT INTO items VALUES (1332, 0, 9.00, 'item1332');
+INSERT INTO items VALUES (1333, 1, 9.25, 'item1333');
+INSERT INTO items VALUES (1334, 2, 9.50, 'item1334');
+INSERT INTO items VALUES (1335, 0, 9.75, 'item1335');
+INSERT INTO items VALUES (1336, 1, 10.00, 'item1336');
+INSERT INTO items VALUES (1337, 2, 10.25, 'item1337');
+INSERT INTO items VALUES (1338, 0, 10.50, 'item1338');
+INSERT INTO items VALUES (1339, 1, 10.75, 'item1339');
+INSERT INTO items VALUES (1340, 2, 11.00, 'item1340');
+INSERT INTO items VALUES (1341, 0, 11.25, 'item1341');
+INSERT INTO items VALUES (1342, 1, 11.50, 'item1342');
+INSERT INTO items VALUES (1343, 2, 11.75, 'item1343');
+INSERT INTO items VALUES (1344, 0, 12.00, 'item1344');
+INSERT INTO items VALUES (1345, 1, 12.25, 'item1345');
+INSERT INTO items VALUES (1346, 2, 12.50, 'item1346');
+INSERT INTO items VALUES (1347, 0, 12.75, 'item1347');
+INSERT INTO items VALUES (1348, 1, 13.00, 'item1348');
+INSERT INTO items VALUES (1349, 2, 13.25, 'item1349');
+INSERT INTO items VALUES (1350, 0, 1.00, 'item1350');
+INSERT INTO items VALUES (1351, 1, 1.25, 'item1351');
+INSERT INTO items VALUES (1352, 2, 1.50, 'item1352');
+INSERT INTO items VALUES (1353, 0, 1.75, 'item1353');
+INSERT INTO items VALUES (1354, 1, 2.00, 'item1354');
+INSERT INTO items VALUES (1355, 2, 2.25, 'item1355');
+INSERT INTO items VALUES (1356, 0, 2.50, 'item1356');
+INSERT INTO items VALUES (1357, 1, 2.75, 'item1357');
+INSERT INTO items VALUES (1358, 2, 3.00, 'item1358');
+INSERT INTO items VALUES (1359, 0, 3.25, 'item1359');
+INSERT INTO items VALUES (1360, 1, 3.50, 'item1360');
+INSERT INTO items VALUES (1361, 2, 3.75, 'item1361');
+INSERT INTO items VALUES (1362, 0, 4.00, 'item1362');
+INSERT INTO items VALUES (1363, 1, 4.25, 'item1363');
+INSERT INTO items VALUES (1364, 2, 4.50, 'item1364');
+INSERT INTO items VALUES (1365, 0, 4.75, 'item1365');
+INSERT INTO items VALUES (1366, 1, 5.00, 'item1366');
+INSERT INTO items VALUES (1367, 2, 5.25, 'item1367');
+INSERT INTO items VALUES (1368, 0, 5.50, 'item1368');
+INSERT INTO items VALUES (1369, 1, 5.75, 'item1369');
+INSERT INTO items VALUES (1370, 2, 6.00, 'item1370');
+INSERT INTO items VALUES (1371, 0, 6.25, 'item1371');
+INSERT INTO items VALUES (1372, 1, 6.50, 'item1372');
+INSERT INTO items VALUES (1373, 2, 6.75, 'item1373');
+INSERT INTO items VALUES (1374, 0, 7.00, 'item1374');
+INSERT INTO items VALUES (1375, 1, 7.25, 'item1375');
+INSERT INTO items VALUES (1376, 2, 7.50, 'item1376');
+INSERT INTO items VALUES (1377, 0, 7.75, 'item1377');
+INSERT INTO items VALUES (1378, 1, 8.00, 'item1378');
+INSERT INTO items VALUES (1379, 2, 8.25, 'item1379');
+INSERT INTO items VALUES (1380, 0, 8.50, 'item1380');
+INSERT INTO items VALUES (1381, 1, 8.75, 'item1381');
+INSERT INTO items VALUES (1382, 2, 9.00, 'item1382');
+INSERT INTO items VALUES (1383, 0, 9.25, 'item1383');
+INSERT INTO items VALUES (1384, 1, 9.50, 'item1384');
+INSERT INTO items VALUES (1385, 2, 9.75, 'item1385');
+INSERT INTO items VALUES (1386, 0, 10.00, 'item1386');
+INSERT INTO items VALUES (1387, 1, 10.25, 'item1387');
+INSERT INTO items VALUES (1388, 2, 10.50, 'item1388');
+INSERT INTO items VALUES (1389, 0, 10.75, 'item1389');
+INSERT INTO items VALUES (1390, 1, 11.00, 'item1390');
+INSERT INTO items VALUES (1391, 2, 11.25, 'item1391');
+INSERT INTO items VALUES (1392, 0, 11.50, 'item1392');
+INSERT INTO items VALUES (1393, 1, 11.75, 'item1393');
+INSERT INTO items VALUES (1394, 2, 12.00, 'item1394');
+INSERT INTO items VALUES (1395, 0, 12.25, 'item1395');
+INSERT INTO items VALUES (1396, 1, 12.50, 'item1396');
+INSERT INTO items VALUES (1397, 2, 12.75, 'item1397');
+INSERT INTO items VALUES (1398, 0, 13.00, 'item1398');
+INSERT INTO items VALUES (1399, 1, 13.25, 'item1399');
+INSERT INTO items VALUES (1400, 2, 1.00, 'item1400');
+INSERT INTO items VALUES (1401, 0, 1.25, 'item1401');
+INSERT INTO items VALUES (1402, 1, 1.50, 'item1402');
+INSERT INTO items VALUES (1403, 2, 1.75, 'item1403');
+INSERT INTO items VALUES (1404, 0, 2.00, 'item1404');
+INSERT INTO items VALUES (1405, 1, 2.25, 'item1405');
+INSERT INTO items VALUES (1406, 2, 2.50, 'item1406');
+INSERT INTO items VALUES (1407, 0, 2.75, 'item1407');
+INSERT INTO items VALUES (1408, 1, 3.00, 'item1408');
+INSERT INTO items VALUES (1409, 2, 3.25, 'item1409');
+INSERT INTO items VALUES (1410, 0, 3.50, 'item1410');
+INSERT INTO items VALUES (1411, 1, 3.75, 'item1411');
+INSERT INTO items VALUES (1412, 2, 4.00, 'item1412');
+INSERT INTO items VALUES (1413, 0, 4.25, 'item1413');
+INSERT INTO items VALUES (1414, 1, 4.50, 'item1414');
+INSERT INTO items VALUES (1415, 2, 4.75, 'item1415');
+INSERT INTO items VALUES (1416, 0, 5.00, 'item1416');
+INSERT INTO items VALUES (1417, 1, 5.25, 'item1417');
+INSERT INTO items VALUES (1418, 2, 5.50, 'item1418');
+INSERT INTO items VALUES (1419, 0, 5.75, 'item1419');
+INSERT INTO items VALUES (1420, 1, 6.00, 'item1420');
+INSERT INTO items VALUES (1421, 2, 6.25, 'item1421');
+INSERT INTO items VALUES (1422, 0, 6.50, 'item1422');
+INSERT INTO items VALUES (1423, 1, 6.75, 'item1423');
+INSERT INTO items VALUES (1424, 2, 7.00, 'item1424');
+INSERT INTO items VALUES (1425, 0, 7.25, 'item1425');
+INSERT INTO items VALUES (1426, 1, 7.50, 'item1426');
+INSERT INTO items VALUES (1427, 2, 7.75, 'item1427');
+INSERT INTO items VALUES (1428, 0, 8.00, 'item1428');
+INSERT INTO items VALUES (1429, 1, 8.25, 'item1429');
+INSERT INTO items VALUES (1430, 2, 8.50, 'item1430');
+INSERT INTO items VALUES (1431, 0, 8.75, 'item1431');
+INSERT INTO items VALUES (1432, 1, 9.00, 'item1432');
+INSERT INTO items VALUES (1433, 2, 9.25, 'item1433');
+INSERT INTO items VALUES (1434, 0, 9.50, 'item1434');
+INSERT INTO items VALUES (1435, 1, 9.75, 'item1435');
+INSERT INTO items VALUES (1436, 2, 10.00, 'item1436');
+INSERT INTO items VALUES (1437, 0, 10.25, 'item1437');
+INSERT INTO items VALUES (1438, 1, 10.50, 'item1438');
+INSERT INTO items VALUES (1439, 2, 10.75, 'item1439');
+INSERT INTO items VALUES (1440, 0, 11.00, 'item1440');
+INSERT INTO items VALUES (1441, 1, 11.25, 'item1441');
+INSERT INTO items VALUES (1442, 2, 11.50, 'item1442');
+INSERT INTO items VALUES (1443, 0, 11.75, 'item1443');
+INSERT INTO items VALUES (1444, 1, 12.00, 'item1444');
+INSERT INTO items VALUES (1445, 2, 12.25, 'item1445');
+INSERT INTO items VALUES (1446, 0, 12.50, 'item1446');
+INSERT INTO items VALUES (1447, 1, 12.75, 'item1447');
+INSERT INTO items VALUES (1448, 2, 13.00, 'item1448');
+INSERT INTO items VALUES (1449, 0, 13.25, 'item1449');
+INSERT INTO items VALUES (1450, 1, 1.00, 'item1450');
+INSERT INTO items VALUES (1451, 2, 1.25, 'item1451');
+INSERT INTO items VALUES (1452, 0, 1.50, 'item1452');
+INSERT INTO items VALUES (1453, 1, 1.75, 'item1453');
+INSERT INTO items VALUES (1454, 2, 2.00, 'item1454');
+INSERT INTO items VALUES (1455, 0, 2.25, 'item1455');
+INSERT INTO items VALUES (1456, 1, 2.50, 'item1456');
+INSERT INTO items VALUES (1457, 2, 2.75, 'item1457');
+INSERT INTO items VALUES (1458, 0, 3.00, 'item1458');
+INSERT INTO items VALUES (1459, 1, 3.25, 'item1459');
+INSERT INTO items VALUES (1460, 2, 3.50, 'item1460');
+INSERT INTO items VALUES (1461, 0, 3.75, 'item1461');
+INSERT INTO items VALUES (1462, 1, 4.00, 'item1462');
+INSERT INTO items VALUES (1463, 2, 4.25, 'item1463');
+INSERT INTO items VALUES (1464, 0, 4.50, 'item1464');
+INSERT INTO items VALUES (1465, 1, 4.75, 'item1465');
+INSERT INTO items VALUES (1466, 2, 5.00, 'item1466');
+INSERT INTO items VALUES (1467, 0, 5.25, 'item1467');
+INSERT INTO items VALUES (1468, 1, 5.50, 'item1468');
+INSERT INTO items VALUES (1469, 2, 5.75, 'item1469');
+INSERT INTO items VALUES (1470, 0, 6.00, 'item1470');
+INSERT INTO items VALUES (1471, 1, 6.25, 'item1471');
+INSERT INTO items VALUES (1472, 2, 6.50, 'item1472');
+INSERT INTO items VALUES (1473, 0, 6.75, 'item1473');
+INSERT INTO items VALUES (1474, 1, 7.00, 'item1474');
+INSERT INTO items VALUES (1475, 2, 7.25, 'item1475');
+INSERT INTO items VALUES (1476, 0, 7.50, 'item1476');
+INSERT INTO items VALUES (1477, 1, 7.75, 'item1477');
+INSERT INTO items VALUES (1478, 2, 8.00, 'item1478');
+INSERT INTO items VALUES (1479, 0, 8.25, 'item1479');
+INSERT INTO items VALUES (1480, 1, 8.50, 'item1480');
+INSERT INTO items VALUES (1481, 2, 8.75, 'item1481');
+INSERT INTO items VALUES (1482, 0, 9.00, 'item1482');
+INSERT INTO items VALUES (1483, 1, 9.25, 'item1483');
+INSERT INTO items VALUES (1484, 2, 9.50, 'item1484');
+INSERT INTO items VALUES (1485, 0, 9.75, 'item1485');
+INSERT INTO items VALUES (1486, 1, 10.00, 'item1486');
+INSERT INTO items VALUES (1487, 2, 10.25, 'item1487');
+INSERT INTO items VALUES (1488, 0, 10.50, 'item1488');
+INSERT INTO items VALUES (1489, 1, 10.75, 'item1489');
+INSERT INTO items VALUES (1490, 2, 11.00, 'item1490');
+INSERT INTO items VALUES (1491, 0, 11.25, 'item1491');
+INSERT INTO items VALUES (1492, 1, 11.50, 'item1492');
+INSERT INTO items VALUES (1493, 2, 11.75, 'item1493');
+INSERT INTO items VALUES (1494, 0, 12.00, 'item1494');
+INSERT INTO items VALUES (1495, 1, 12.25, 'item1495');
+INSERT INTO items VALUES (1496, 2, 12.50, 'item1496');
+INSERT INTO items VALUES (1497, 0, 12.75, 'item1497');
+INSERT INTO items VALUES (1498, 1, 13.00, 'item1498');
+INSERT INTO items VALUES (1499, 2, 13.25, 'item1499');
+INSERT INTO items VALUES (1500, 0, 1.00, 'item1500');
+INSERT INTO items VALUES (1501, 1, 1.25, 'item1501');
+INSERT INTO items VALUES (1502, 2, 1.50, 'item1502');
+INSERT INTO items VALUES (1503, 0, 1.75, 'item1503');
+INSERT INTO items VALUES (1504, 1, 2.00, 'item1504');
+INSERT INTO items VALUES (1505, 2, 2.25, 'item1505');
+INSERT INTO items VALUES (1506, 0, 2.50, 'item1506');
+INSERT INTO items VALUES (1507, 1, 2.75, 'item1507');
+INSERT INTO items VALUES (1508, 2, 3.00, 'item1508');
+INSERT INTO items VALUES (1509, 0, 3.25, 'item1509');
+INSERT INTO items VALUES (1510, 1, 3.50, 'item1510');
+INSERT INTO items VALUES (1511, 2, 3.75, 'item1511');
+INSERT INTO items VALUES (1512, 0, 4.00, 'item1512');
+INSERT INTO items VALUES (1513, 1, 4.25, 'item1513');
+INSERT INTO items VALUES (1514, 2, 4.50, 'item1514');
+INSERT INTO items VALUES (1515, 0, 4.75, 'item1515');
+INSERT INTO items VALUES (1516, 1, 5.00, 'item1516');
+INSERT INTO items VALUES (1517, 2, 5.25, 'item1517');
+INSERT INTO items VALUES (1518, 0, 5.50, 'item1518');
+INSERT INTO items VALUES (1519, 1, 5.75, 'item1519');
+INSERT INTO items VALUES (1520, 2, 6.00, 'item1520');
+INSERT INTO items VALUES (1521, 0, 6.25, 'item1521');
+INSERT INTO items VALUES (1522, 1, 6.50, 'item1522');
+INSERT INTO items VALUES (1523, 2, 6.75, 'item1523');
+INSERT INTO items VALUES (1524, 0, 7.00, 'item1524');
+INSERT INTO items VALUES (1525, 1, 7.25, 'item1525');
+INSERT INTO items VALUES (1526, 2, 7.50, 'item1526');
+INSERT INTO items VALUES (1527, 0, 7.75, 'item1527');
+INSERT INTO items VALUES (1528, 1, 8.00, 'item1528');
+INSERT INTO items VALUES (1529, 2, 8.25, 'item1529');
+INSERT INTO items VALUES (1530, 0, 8.50, 'item1530');
+INSERT INTO items VALUES (1531, 1, 8.75, 'item1531');
+INSERT INTO items VALUES (1532, 2, 9.00, 'item1532');
+INSERT INTO items VALUES (1533, 0, 9.25, 'item1533');
+INSERT INTO items VALUES (1534, 1, 9.50, 'item1534');
+INSERT INTO items VALUES (1535, 2, 9.75, 'item1535');
+INSERT INTO items VALUES (1536, 0, 10.00, 'item1536');
+INSERT INTO items VALUES (1537, 1, 10.25, 'item1537');
+INSERT INTO items VALUES (1538, 2, 10.50, 'item1538');
+INSERT INTO items VALUES (1539, 0, 10.75, 'item1539');
+INSERT INTO items VALUES (1540, 1, 11.00, 'item1540');
+INSERT INTO items VALUES (1541, 2, 11.25, 'item1541');
+INSERT INTO items VALUES (1542, 0, 11.50, 'item1542');
+INSERT INTO items VALUES (1543, 1, 11.75, 'item1543');
+INSERT INTO items VALUES (1544, 2, 12.00, 'item1544');
+INSERT INTO items VALUES (1545, 0, 12.25, 'item1545');
+INSERT INTO items VALUES (1546, 1, 12.50, 'item1546');
+INSERT INTO items VALUES (1547, 2, 12.75, 'item1547');
+INSERT INTO items VALUES (1548, 0, 13.00, 'item1548');
+INSERT INTO items VALUES (1549, 1, 13.25, 'item1549');
+INSERT INTO items VALUES (1550, 2, 1.00, 'item1550');
+INSERT INTO items VALUES (1551, 0, 1.25, 'item1551');
+INSERT INTO items VALUES (1552, 1, 1.50, 'item1552');
+INSERT INTO items VALUES (1553, 2, 1.75, 'item1553');
+INSERT INTO items VALUES (1554, 0, 2.00, 'item1554');
+INSERT INTO items VALUES (1555, 1, 2.25, 'item1555');
+INSERT INTO items VALUES (1556, 2, 2.50, 'item1556');
+INSERT INTO items VALUES (1557, 0, 2.75, 'item1557');
+INSERT INTO items VALUES (1558, 1, 3.00, 'item1558');
+INSERT INTO items VALUES (1559, 2, 3.25, 'item1559');
+INSERT INTO items VALUES (1560, 0, 3.50, 'item1560');
+INSERT INTO items VALUES (1561, 1, 3.75, 'item1561');
+INSERT INTO items VALUES (1562, 2, 4.00, 'item1562');
+INSERT INTO items VALUES (1563, 0, 4.25, 'item1563');
+INSERT INTO items VALUES (1564, 1, 4.50, 'item1564');
+INSERT INTO items VALUES (1565, 2, 4.75, 'item1565');
+INSERT INTO items VALUES (1566, 0, 5.00, 'item1566');
+INSERT INTO items VALUES (1567, 1, 5.25, 'item1567');
+INSERT INTO items VALUES (1568, 2, 5.50, 'item1568');
+INSERT INTO items VALUES (1569, 0, 5.75, 'item1569');
+INSERT INTO items VALUES (1570, 1, 6.00, 'item1570');
+INSERT INTO items VALUES (1571, 2, 6.25, 'item1571');
+INSERT INTO items VALUES (1572, 0, 6.50, 'item1572');
+INSERT INTO items VALUES (1573, 1, 6.75, 'item1573');
+INSERT INTO items VALUES (1574, 2, 7.00, 'item1574');
+INSERT INTO items VALUES (1575, 0, 7.25, 'item1575');
+INSERT INTO items VALUES (1576, 1, 7.50, 'item1576');
+INSERT INTO items VALUES (1577, 2, 7.75, 'item1577');
+INSERT INTO items VALUES (1578, 0, 8.00, 'item1578');
+INSERT INTO items VALUES (1579, 1, 8.25, 'item1579');
+INSERT INTO items VALUES (1580, 2, 8.50, 'item1580');
+INSERT INTO items VALUES (1581, 0, 8.75, 'item1581');
+INSERT INTO items VALUES (1582, 1, 9.00, 'item1582');
+INSERT INTO items VALUES (1583, 2, 9.25, 'item1583');
+INSERT INTO items VALUES (1584, 0, 9.50, 'item1584');
+INSERT INTO items VALUES (1585, 1, 9.75, 'item1585');
+INSERT INTO items VALUES (1586, 2, 10.00, 'item1586');
+INSERT INTO items VALUES (1587, 0, 10.25, 'item1587');
+INSERT INTO items VALUES (1588, 1, 10.50, 'item1588');
+INSERT INTO items VALUES (1589, 2, 10.75, 'item1589');
+INSERT INTO items VALUES (1590, 0, 11.00, 'item1590');
+INSERT INTO items VALUES (1591, 1, 11.25, 'item1591');
+INSERT INTO items VALUES (1592, 2, 11.50, 'item1592');
+INSERT INTO items VALUES (1593, 0, 11.75, 'item1593');
+INSERT INTO items VALUES (1594, 1, 12.00, 'item1594');
+INSERT INTO items VALUES (1595, 2, 12.25, 'item1595');
+INSERT INTO items VALUES (1596, 0, 12.50, 'item1596');
+INSERT INTO items VALUES (1597, 1, 12.75, 'item1597');
+INSERT INTO items VALUES (1598, 2, 13.00, 'item1598');
+INSERT INTO items VALUES (1599, 0, 13.25, 'item1599');
+INSERT INTO items VALUES (1600, 1, 1.00, 'item1600');
+INSERT INTO items VALUES (1601, 2, 1.25, 'item1601');
+INSERT INTO items VALUES (1602, 0, 1.50, 'item1602');
+INSERT INTO items VALUES (1603, 1, 1.75, 'item1603');
+INSERT INTO items VALUES (1604, 2, 2.00, 'item1604');
+INSERT INTO items VALUES (1605, 0, 2.25, 'item1605');
+INSERT INTO items VALUES (1606, 1, 2.50, 'item1606');
+INSERT INTO items VALUES (1607, 2, 2.75, 'item1607');
+INSERT INTO items VALUES (1608, 0, 3.00, 'item1608');
+INSERT INTO items VALUES (1609, 1, 3.25, 'item1609');
+INSERT INTO items VALUES (1610, 2, 3.50, 'item1610');
+INSERT INTO items VALUES (1611, 0, 3.75, 'item1611');
+INSERT INTO items VALUES (1612, 1, 4.00, 'item1612');
+INSERT INTO items VALUES (1613, 2, 4.25, 'item1613');
+INSERT INTO items VALUES (1614, 0, 4.50, 'item1614');
+INSERT INTO items VALUES (1615, 1, 4.75, 'item1615');
+INSERT INTO items VALUES (1616, 2, 5.00, 'item1616');
+INSERT INTO items VALUES (1617, 0, 5.25, 'item1617');
+INSERT INTO items VALUES (1618, 1, 5.50, 'item1618');
+INSERT INTO items VALUES (1619, 2, 5.75, 'item1619');
+INSERT INTO items VALUES (1620, 0, 6.00, 'item1620');
+INSERT INTO items VALUES (1621, 1, 6.25, 'item1621');
+INSERT INTO items VALUES (1622, 2, 6.50, 'item1622');
+INSERT INTO items VALUES (1623, 0, 6.75, 'item1623');
+INSERT INTO items VALUES (1624, 1, 7.00, 'item1624');
+INSERT INTO items VALUES (1625, 2, 7.25, 'item1625');
+INSERT INTO items VALUES (1626, 0, 7.50, 'item1626');
+INSERT INTO items VALUES (1627, 1, 7.75, 'item1627');
+INSERT INTO items VALUES (1628, 2, 8.00, 'item1628');
+INSERT INTO items VALUES (1629, 0, 8.25, 'item1629');
+INSERT INTO items VALUES (1630, 1, 8.50, 'item1630');
+INSERT INTO items VALUES (1631, 2, 8.75, 'item1631');
+INSERT INTO items VALUES (1632, 0, 9.00, 'item1632');
+INSERT INTO items VALUES (1633, 1, 9.25, 'item1633');
+INSERT INTO items VALUES (1634, 2, 9.50, 'item1634');
+INSERT INTO items VALUES (1635, 0, 9.75, 'item1635');
+INSERT INTO items VALUES (1636, 1, 10.00, 'item1636');
+INSERT INTO items VALUES (1637, 2, 10.25, 'item1637');
+INSERT INTO items VALUES (1638, 0, 10.50, 'item1638');
+INSERT INTO items VALUES (1639, 1, 10.75, 'item1639');
+INSERT INTO items VALUES (1640, 2, 11.00, 'item1640');
+INSERT INTO items VALUES (1641, 0, 11.25, 'item1641');
+INSERT INTO items VALUES (1642, 1, 11.50, 'item1642');
+INSERT INTO items VALUES (1643, 2, 11.75, 'item1643');
+INSERT INTO items VALUES (1644, 0, 12.00, 'item1644');
+INSERT INTO items VALUES (1645, 1, 12.25, 'item1645');
+INSERT INTO items VALUES (1646, 2, 12.50, 'item1646');
+INSERT INTO items VALUES (1647, 0, 12.75, 'item1647');
+INSERT INTO items VALUES (1648, 1, 13.00, 'item1648');
+INSERT INTO items VALUES (1649, 2, 13.25, 'item1649');
+INSERT INTO items VALUES (1650, 0, 1.00, 'item1650');
+INSERT INTO items VALUES (1651, 1, 1.25, 'item1651');
+INSERT INTO items VALUES (1652, 2, 1.50, 'item1652');
+INSERT INTO items VALUES (1653, 0, 1.75, 'item1653');
+INSERT INTO items VALUES (1654, 1, 2.00, 'item1654');
+INSERT INTO items VALUES (1655, 2, 2.25, 'item1655');
+INSERT INTO items VALUES (1656, 0, 2.50, 'item1656');
+INSERT INTO items VALUES (1657, 1, 2.75, 'item1657');
+INSERT INTO items VALUES (1658, 2, 3.00, 'item1658');
+INSERT INTO items VALUES (1659, 0, 3.25, 'item1659');
+INSERT INTO items VALUES (1660, 1, 3.50, 'item1660');
+INSERT INTO items VALUES (1661, 2, 3.75, 'item1661');
+INSERT INTO items VALUES (1662, 0, 4.00, 'item1662');
+INSERT INTO items VALUES (1663, 1, 4.25, 'item1663');
+INSERT INTO items VALUES (1664, 2, 4.50, 'item1664');
+INSERT INTO items VALUES (1665, 0, 4.75, 'item1665');
+INSERT INTO items VALUES (1666, 1, 5.00, 'item1666');
+INSERT INTO items VALUES (1667, 2, 5.25, 'item1667');
+INSERT INTO items VALUES (1668, 0, 5.50, 'item1668');
+INSERT INTO items VALUES (1669, 1, 5.75, 'item1669');
+INSERT INTO items VALUES (1670, 2, 6.00, 'item1670');
+INSERT INTO items VALUES (1671, 0, 6.25, 'item1671');
+INSERT INTO items VALUES (1672, 1, 6.50, 'item1672');
+INSERT INTO items VALUES (1673, 2, 6.75, 'item1673');
+INSERT INTO items VALUES (1674, 0, 7.00, 'item1674');
+INSERT INTO items VALUES (1675, 1, 7.25, 'item1675');
+INSERT INTO items VALUES (1676, 2, 7.50, 'item1676');
+INSERT INTO items VALUES (1677, 0, 7.75, 'item1677');
+INSERT INTO items VALUES (1678, 1, 8.00, 'item1678');
+INSERT INTO items VALUES (1679, 2, 8.25, 'item1679');
+INSERT INTO items VALUES (1680, 0, 8.50, 'item1680');
+INSERT INTO items VALUES (1681, 1, 8.75, 'item1681');
+INSERT INTO items VALUES (1682, 2, 9.00, 'item1682');
+INSERT INTO items VALUES (1683, 0, 9.25, 'item1683');
+INSERT INTO items VALUES (1684, 1, 9.50, 'item1684');
+INSERT INTO items VALUES (1685, 2, 9.75, 'item1685');
+INSERT INTO items VALUES (1686, 0, 10.00, 'item1686');
+INSERT INTO items VALUES (1687, 1, 10.25, 'item1687');
+INSERT INTO items VALUES (1688, 2, 10.50, 'item1688');
+INSERT INTO items VALUES (1689, 0, 10.75, 'item1689');
+INSERT INTO items VALUES (1690, 1, 11.00, 'item1690');
+INSERT INTO items VALUES (1691, 2, 11.25, 'item1691');
+INSERT INTO items VALUES (1692, 0, 11.50, 'item1692');
+INSERT INTO items VALUES (1693, 1, 11.75, 'item1693');
+INSERT INTO items VALUES (1694, 2, 12.00, 'item1694');
+INSERT INTO items VALUES (1695, 0, 12.25, 'item1695');
+INSERT INTO items VALUES (1696, 1, 12.50, 'item1696');
+INSERT INTO items VALUES (1697, 2, 12.75, 'item1697');
+INSERT INTO items VALUES (1698, 0, 13.00, 'item1698');
+INSERT INTO items VALUES (1699, 1, 13.25, 'item1699');
+INSERT INTO items VALUES (1700, 2, 1.00, 'item1700');
+INSERT INTO items VALUES (1701, 0, 1.25, 'item1701');
+INSERT INTO items VALUES (1702, 1, 1.50, 'item1702');
+INSERT INTO items VALUES (1703, 2, 1.75, 'item1703');
+INSERT INTO items VALUES (1704, 0, 2.00, 'item1704');
+INSERT INTO items VALUES (1705, 1, 2.25, 'item1705');
+INSERT INTO items VALUES (1706, 2, 2.50, 'item1706');
+INSERT INTO items VALUES (1707, 0, 2.75, 'item1707');
+INSERT INTO items VALUES (1708, 1, 3.00, 'item1708');
+INSERT INTO items VALUES (1709, 2, 3.25, 'item1709');
+INSERT INTO items VALUES (1710, 0, 3.50, 'item1710');
+INSERT INTO items VALUES (1711, 1, 3.75, 'item1711');
+INSERT INTO items VALUES (1712, 2, 4.00, 'item1712');
+INSERT INTO items VALUES (1713, 0, 4.25, 'item1713');
+INSERT INTO items VALUES (1714, 1, 4.50, 'item1714');
+INSERT INTO items VALUES (1715, 2, 4.75, 'item1715');
+INSERT INTO items VALUES (1716, 0, 5.00, 'item1716');
+INSERT INTO items VALUES (1717, 1, 5.25, 'item1717');
+INSERT INTO items VALUES (1718, 2, 5.50, 'item1718');
+INSERT INTO items VALUES (1719, 0, 5.75, 'item1719');
+INSERT INTO items VALUES (1720, 1, 6.00, 'item1720');
+INSERT INTO items VALUES (1721, 2, 6.25, 'item1721');
+INSERT INTO items VALUES (1722, 0, 6.50, 'item1722');
+INSERT INTO items VALUES (1723, 1, 6.75, 'item1723');
+INSERT INTO items VALUES (1724, 2, 7.00, 'item1724');
+INSERT INTO items VALUES (1725, 0, 7.25, 'item1725');
+INSERT INTO items VALUES (1726, 1, 7.50, 'item1726');
+INSERT INTO items VALUES (1727, 2, 7.75, 'item1727');
+INSERT INTO items VALUES (1728, 0, 8.00, 'item1728');
+INSERT INTO items VALUES (1729, 1, 8.25, 'item1729');
+INSERT INTO items VALUES (1730, 2, 8.50, 'item1730');
+INSERT INTO items VALUES (1731, 0, 8.75, 'item1731');
+INSERT INTO items VALUES (1732, 1, 9.00, 'item1732');
+INSERT INTO items VALUES (1733, 2, 9.25, 'item1733');
+INSERT INTO items VALUES (1734, 0, 9.50, 'item1734');
+INSERT INTO items VALUES (1735, 1, 9.75, 'item1735');
+INSERT INTO items VALUES (1736, 2, 10.00, 'item1736');
+INSERT INTO items VALUES (1737, 0, 10.25, 'item1737');
+INSERT INTO items VALUES (1738, 1, 10.50, 'item1738');
+INSERT INTO items VALUES (1739, 2, 10.75, 'item1739');
+INSERT INTO items VALUES (1740, 0, 11.00, 'item1740');
+INSERT INTO items VALUES (1741, 1, 11.25, 'item1741');
+INSERT INTO items VALUES (1742, 2, 11.50, 'item1742');
+INSERT INTO items VALUES (1743, 0, 11.75, 'item1743');
+INSERT INTO items VALUES (1744, 1, 12.00, 'item1744');
+INSERT INTO items VALUES (1745, 2, 12.25, 'item1745');
+INSERT INTO items VALUES (1746, 0, 12.50, 'item1746');
+INSERT INTO items VALUES (1747, 1, 12.75, 'item1747');
+INSERT INTO items VALUES (1748, 2, 13.00, 'item1748');
+INSERT INTO items VALUES (1749, 0, 13.25, 'item1749');
+INSERT INTO items VALUES (1750, 1, 1.00, 'item1750');
+INSERT INTO items VALUES (1751, 2, 1.25, 'item1751');
+INSERT INTO items VALUES (1752, 0, 1.50, 'item1752');
+INSERT INTO items VALUES (1753, 1, 1.75, 'item1753');
+INSERT INTO items VALUES (1754, 2, 2.00, 'item1754');
+INSERT INTO items VALUES (1755, 0, 2.25, 'item1755');
+INSERT INTO items VALUES (1756, 1, 2.50, 'item1756');
+INSERT INTO items VALUES (1757, 2, 2.75, 'item1757');
+INSERT INTO items VALUES (1758, 0, 3.00, 'item1758');
+INSERT INTO items VALUES (1759, 1, 3.25, 'item1759');
+INSERT INTO items VALUES (1760, 2, 3.50, 'item1760');
+INSERT INTO items VALUES (1761, 0, 3.75, 'item1761');
+INSERT INTO items VALUES (1762, 1, 4.00, 'item1762');
+INSERT INTO items VALUES (1763, 2, 4.25, 'item1763');
+INSERT INTO items VALUES (1764, 0, 4.50, 'item1764');
+INSERT INTO items VALUES (1765, 1, 4.75, 'item1765');
+INSERT INTO items VALUES (1766, 2, 5.00, 'item1766');
+INSERT INTO items VALUES (1767, 0, 5.25, 'item1767');
+INSERT INTO items VALUES (1768, 1, 5.50, 'item1768');
+INSERT INTO items VALUES (1769, 2, 5.75, 'item1769');
+INSERT INTO items VALUES (1770, 0, 6.00, 'item1770');
+INSERT INTO items VALUES (1771, 1, 6.25, 'item1771');
+INSERT INTO items VALUES (1772, 2, 6.50, 'item1772');
+INSERT INTO items VALUES (1773, 0, 6.75, 'item1773');
+INSERT INTO items VALUES (1774, 1, 7.00, 'item1774');
+INSERT INTO items VALUES (1775, 2, 7.25, 'item1775');
+INSERT INTO items VALUES (1776, 0, 7.50, 'item1776');
+INSERT INTO items VALUES (1777, 1, 7.75, 'item1777');
+INSERT INTO items VALUES (1778, 2, 8.00, 'item1778');
+INSERT INTO items VALUES (1779, 0, 8.25, 'item1779');
+INSERT INTO items VALUES (1780, 1, 8.50, 'item1780');
+INSERT INTO items VALUES (1781, 2, 8.75, 'item1781');
+INSERT INTO items VALUES (1782, 0, 9.00, 'item1782');
+INSERT INTO items VALUES (1783, 1, 9.25, 'item1783');
+INSERT INTO items VALUES (1784, 2, 9.50, 'item1784');
+INSERT INTO items VALUES (1785, 0, 9.75, 'item1785');
+INSERT INTO items VALUES (1786, 1, 10.00, 'item1786');
+INSERT INTO items VALUES (1787, 2, 10.25, 'item1787');
+INSERT INTO items VALUES (1788, 0, 10.50, 'item1788');
+INSERT INTO items VALUES (1789, 1, 10.75, 'item1789');
+INSERT INTO items VALUES (1790, 2, 11.00, 'item1790');
+INSERT INTO items VALUES (1791, 0, 11.25, 'item1791');
+INSERT INTO items VALUES (1792, 1, 11.50, 'item1792');
+INSERT INTO items VALUES (1793, 2, 11.75, 'item1793');
+INSERT INTO items VALUES (1794, 0, 12.00, 'item1794');
+INSERT INTO items VALUES (1795, 1, 12.25, 'item1795');
+INSERT INTO items VALUES (1796, 2, 12.50, 'item1796');
+INSERT INTO items VALUES (1797, 0, 12.75, 'item1797');
+INSERT INTO items VALUES (1798, 1, 13.00, 'item1798');
+INSERT INTO items VALUES (1799, 2, 13.25, 'item1799');
+INSERT INTO items VALUES (1800, 0, 1.00, 'item1800');
+INSERT INTO items VALUES (1801, 1, 1.25, 'item1801');
+INSERT INTO items VALUES (1802, 2, 1.50, 'item1802');
+INSERT INTO items VALUES (1803, 0, 1.75, 'item1803');
+INSERT INTO items VALUES (1804, 1, 2.00, 'item1804');
+INSERT INTO items VALUES (1805, 2, 2.25, 'item1805');
+INSERT INTO items VALUES (1806, 0, 2.50, 'item1806');
+INSERT INTO items VALUES (1807, 1, 2.75, 'item1807');
+INSERT INTO items VALUES (1808, 2, 3.00, 'item1808');
+INSERT INTO items VALUES (1809, 0, 3.25, 'item1809');
+INSERT INTO items VALUES (1810, 1, 3.50, 'item1810');
+INSERT INTO items VALUES (1811, 2, 3.75, 'item1811');
+INSERT INTO items VALUES (1812, 0, 4.00, 'item1812');
+INSERT INTO items VALUES (1813, 1, 4.25, 'item1813');
+INSERT INTO items VALUES (1814, 2, 4.50, 'item1814');
+INSERT INTO items VALUES (1815, 0, 4.75, 'item1815');
+INSERT INTO items VALUES (1816, 1, 5.00, 'item1816');
+INSERT INTO items VALUES (1817, 2, 5.25, 'item1817');
+INSERT INTO items VALUES (1818, 0, 5.50, 'item1818');
+INSERT INTO items VALUES (1819, 1, 5.75, 'item1819');
+INSERT INTO items VALUES (1820, 2, 6.00, 'item1820');
+INSERT INTO items VALUES (1821, 0, 6.25, 'item1821');
+INSERT INTO items VALUES (1822, 1, 6.50, 'item1822');
+INSERT INTO items VALUES (1823, 2, 6.75, 'item1823');
+INSERT INTO items VALUES (1824, 0, 7.00, 'item1824');
+INSERT INTO items VALUES (1825, 1, 7.25, 'item1825');
+INSERT INTO items VALUES (1826, 2, 7.50, 'item1826');
+INSERT INTO items VALUES (1827, 0, 7.75, 'item1827');
+INSERT INTO items VALUES (1828, 1, 8.00, 'item1828');
+INSERT INTO items VALUES (1829, 2, 8.25, 'item1829');
+INSERT INTO items VALUES (1830, 0, 8.50, 'item1830');
+INSERT INTO items VALUES (1831, 1, 8.75, 'item1831');
+INSERT INTO items VALUES (1832, 2, 9.00, 'item1832');
+INSERT INTO items VALUES (1833, 0, 9.25, 'item1833');
+INSERT INTO items VALUES (1834, 1, 9.50, 'item1834');
+INSERT INTO items VALUES (1835, 2, 9.75, 'item1835');
+INSERT INTO items VALUES (1836, 0, 10.00, 'item1836');
+INSERT INTO items VALUES (1837, 1, 10.25, 'item1837');
+INSERT INTO items VALUES (1838, 2, 10.50, 'item1838');
+INSERT INTO items VALUES (1839, 0, 10.75, 'item1839');
+INSERT INTO items VALUES (1840, 1, 11.00, 'item1840');
+INSERT INTO items VALUES (1841, 2, 11.25, 'item1841');
+INSERT INTO items VALUES (1842, 0, 11.50, 'item1842');
+INSERT INTO items VALUES (1843, 1, 11.75, 'item1843');
+INSERT INTO items VALUES (1844, 2, 12.00, 'item1844');
+INSERT INTO items VALUES (1845, 0, 12.25, 'item1845');
+INSERT INTO items VALUES (1846, 1, 12.50, 'item1846');
+INSERT INTO items VALUES (1847, 2, 12.75, 'item1847');
+INSERT INTO items VALUES (1848, 0, 13.00, 'item1848');
+INSERT INTO items VALUES (1849, 1, 13.25, 'item1849');
+INSERT INTO items VALUES (1850, 2, 1.00, 'item1850');
+INSERT INTO items VALUES (1851, 0, 1.25, 'item1851');
+INSERT INTO items VALUES (1852, 1, 1.50, 'item1852');
+INSERT INTO items VALUES (1853, 2, 1.75, 'item1853');
+INSERT INTO items VALUES (1854, 0, 2.00, 'item1854');
+INSERT INTO items VALUES (1855, 1, 2.25, 'item1855');
+INSERT INTO items VALUES (1856, 2, 2.50, 'item1856');
+INSERT INTO items VALUES (1857, 0, 2.75, 'item1857');
+INSERT INTO items VALUES (1858, 1, 3.00, 'item1858');
+INSERT INTO items VALUES (1859, 2, 3.25, 'item1859');
+INSERT INTO items VALUES (1860, 0, 3.50, 'item1860');
+INSERT INTO items VALUES (1861, 1, 3.75, 'item1861');
+INSERT INTO items VALUES (1862, 2, 4.00, 'item1862');
+INSERT INTO items VALUES (1863, 0, 4.25, 'item1863');
+INSERT INTO items VALUES (1864, 1, 4.50, 'item1864');
+INSERT INTO items VALUES (1865, 2, 4.75, 'item1865');
+INSERT INTO items VALUES (1866, 0, 5.00, 'item1866');
+INSERT INTO items VALUES (1867, 1, 5.25, 'item1867');
+INSERT INTO items VALUES (1868, 2, 5.50, 'item1868');
+INSERT INTO items VALUES (1869, 0, 5.75, 'item1869');
+INSERT INTO items VALUES (1870, 1, 6.00, 'item1870');
+INSERT INTO items VALUES (1871, 2, 6.25, 'item1871');
+INSERT INTO items VALUES (1872, 0, 6.50, 'item1872');
+INSERT INTO items VALUES (1873, 1, 6.75, 'item1873');
+INSERT INTO items VALUES (1874, 2, 7.00, 'item1874');
+INSERT INTO items VALUES (1875, 0, 7.25, 'item1875');
+INSERT INTO items VALUES (1876, 1, 7.50, 'item1876');
+INSERT INTO items VALUES (1877, 2, 7.75, 'item1877');
+INSERT INTO items VALUES (1878, 0, 8.00, 'item1878');
+INSERT INTO items VALUES (1879, 1, 8.25, 'item1879');
+INSERT INTO items VALUES (1880, 2, 8.50, 'item1880');
+INSERT INTO items VALUES (1881, 0, 8.75, 'item1881');
+INSERT INTO items VALUES (1882, 1, 9.00, 'item1882');
+INSERT INTO items VALUES (1883, 2, 9.25, 'item1883');
+INSERT INTO items VALUES (1884, 0, 9.50, 'item1884');
+INSERT INTO items VALUES (1885, 1, 9.75, 'item1885');
+INSERT INTO items VALUES (1886, 2, 10.00, 'item1886');
+INSERT INTO items VALUES (1887, 0, 10.25, 'item1887');
+INSERT INTO items VALUES (1888, 1, 10.50, 'item1888');
+INSERT INTO items VALUES (1889, 2, 10.75, 'item1889');
+INSERT INTO items VALUES (1890, 0, 11.00, 'item1890');
+INSERT INTO items VALUES (1891, 1, 11.25, 'item1891');
+INSERT INTO items VALUES (1892, 2, 11.50, 'item1892');
+INSERT INTO items VALUES (1893, 0, 11.75, 'item1893');
+INSERT INTO items VALUES (1894, 1, 12.00, 'item1894');
+INSERT INTO items VALUES (1895, 2, 12.25, 'item1895');
+INSERT INTO items VALUES (1896, 0, 12.50, 'item1896');
+INSERT INTO items VALUES (1897, 1, 12.75, 'item1897');
+INSERT INTO items VALUES (1898, 2, 13.00, 'item1898');
+INSERT INTO items VALUES (1899, 0, 13.25, 'item1899');
+INSERT INTO items VALUES (1900, 1, 1.00, 'item1900');
+INSERT INTO items VALUES (1901, 2, 1.25, 'item1901');
+INSERT INTO items VALUES (1902, 0, 1.50, 'item1902');
+INSERT INTO items VALUES (1903, 1, 1.75, 'item1903');
+INSERT INTO items VALUES (1904, 2, 2.00, 'item1904');
+INSERT INTO items VALUES (1905, 0, 2.25, 'item1905');
+INSERT INTO items VALUES (1906, 1, 2.50, 'item1906');
+INSERT INTO items VALUES (1907, 2, 2.75, 'item1907');
+INSERT INTO items VALUES (1908, 0, 3.00, 'item1908');
+INSERT INTO items VALUES (1909, 1, 3.25, 'item1909');
+INSERT INTO items VALUES (1910, 2, 3.50, 'item1910');
+INSERT INTO items VALUES (1911, 0, 3.75, 'item1911');
+INSERT INTO items VALUES (1912, 1, 4.00, 'item1912');
+INSERT INTO items VALUES (1913, 2, 4.25, 'item1913');
+INSERT INTO items VALUES (1914, 0, 4.50, 'item1914');
+INSERT INTO items VALUES (1915, 1, 4.75, 'item1915');
+INSERT INTO items VALUES (1916, 2, 5.00, 'item1916');
+INSERT INTO items VALUES (1917, 0, 5.25, 'item1917');
+INSERT INTO items VALUES (1918, 1, 5.50, 'item1918');
+INSERT INTO items VALUES (1919, 2, 5.75, 'item1919');
+INSERT INTO items VALUES (1920, 0, 6.00, 'item1920');
+INSERT INTO items VALUES (1921, 1, 6.25, 'item1921');
+INSERT INTO items VALUES (1922, 2, 6.50, 'item1922');
+INSERT INTO items VALUES (1923, 0, 6.75, 'item1923');
+INSERT INTO items VALUES (1924, 1, 7.00, 'item1924');
+INSERT INTO items VALUES (1925, 2, 7.25, 'item1925');
+INSERT INTO items VALUES (1926, 0, 7.50, 'item1926');
+INSERT INTO items VALUES (1927, 1, 7.75, 'item1927');
+INSERT INTO items VALUES (1928, 2, 8.00, 'item1928');
+INSERT INTO items VALUES (1929, 0, 8.25, 'item1929');
+INSERT INTO items VALUES (1930, 1, 8.50, 'item1930');
+INSERT INTO items VALUES (1931, 2, 8.75, 'item1931');
+INSERT INTO items VALUES (1932, 0, 9.00, 'item1932');
+INSERT INTO items VALUES (1933, 1, 9.25, 'item1933');
+INSERT INTO items VALUES (1934, 2, 9.50, 'item1934');
+INSERT INTO items VALUES (1935, 0, 9.75, 'item1935');
+INSERT INTO items VALUES (1936, 1, 10.00, 'item1936');
+INSERT INTO items VALUES (1937, 2, 10.25, 'item1937');
+INSERT INTO items VALUES (1938, 0, 10.50, 'item1938');
+INSERT INTO items VALUES (1939, 1, 10.75, 'item1939');
+INSERT INTO items VALUES (1940, 2, 11.00, 'item1940');
+INSERT INTO items VALUES (1941, 0, 11.25, 'item1941');
+INSERT INTO items VALUES (1942, 1, 11.50, 'item1942');
+INSERT INTO items VALUES (1943, 2, 11.75, 'item1943');
+INSERT INTO items VALUES (1944, 0, 12.00, 'item1944');
+INSERT INTO items VALUES (1945, 1, 12.25, 'item1945');
+INSERT INTO items VALUES (1946, 2, 12.50, 'item1946');
+INSERT INTO items VALUES (1947, 0, 12.75, 'item1947');
+INSERT INTO items VALUES (1948, 1, 13.00, 'item1948');
+INSERT INTO items VALUES (1949, 2, 13.25, 'item1949');
+INSERT INTO items VALUES (1950, 0, 1.00, 'item1950');
+INSERT INTO items VALUES (1951, 1, 1.25, 'item1951');
+INSERT INTO items VALUES (1952, 2, 1.50, 'item1952');
+INSERT INTO items VALUES (1953, 0, 1.75, 'item1953');
+INSERT INTO items VALUES (1954, 1, 2.00, 'item1954');
+INSERT INTO items VALUES (1955, 2, 2.25, 'item1955');
+INSERT INTO items VALUES (1956, 0, 2.50, 'item1956');
+INSERT INTO items VALUES (1957, 1, 2.75, 'item1957');
+INSERT INTO items VALUES (1958, 2, 3.00, 'item1958');
+INSERT INTO items VALUES (1959, 0, 3.25, 'item1959');
+INSERT INTO items VALUES (1960, 1, 3.50, 'item1960');
+INSERT INTO items VALUES (1961, 2, 3.75, 'item1961');
+INSERT INTO items VALUES (1962, 0, 4.00, 'item1962');
+INSERT INTO items VALUES (1963, 1, 4.25, 'item1963');
+INSERT INTO items VALUES (1964, 2, 4.50, 'item1964');
+INSERT INTO items VALUES (1965, 0, 4.75, 'item1965');
+INSERT INTO items VALUES (1966, 1, 5.00, 'item1966');
+INSERT INTO items VALUES (1967, 2, 5.25, 'item1967');
+INSERT INTO items VALUES (1968, 0, 5.50, 'item1968');
+INSERT INTO items VALUES (1969, 1, 5.75, 'item1969');
+INSERT INTO items VALUES (1970, 2, 6.00, 'item1970');
+INSERT INTO items VALUES (1971, 0, 6.25, 'item1971');
+INSERT INTO items VALUES (1972, 1, 6.50, 'item1972');
+INSERT INTO items VALUES (1973, 2, 6.75, 'item1973');
+INSERT INTO items VALUES (1974, 0, 7.00, 'item1974');
+INSERT INTO items VALUES (1975, 1, 7.25, 'item1975');
+INSERT INTO items VALUES (1976, 2, 7.50, 'item1976');
+INSERT INTO items VALUES (1977, 0, 7.75, 'item1977');
+INSERT INTO items VALUES (1978, 1, 8.00, 'item1978');
+INSERT INTO items VALUES (1979, 2, 8.25, 'item1979');
+INSERT INTO items VALUES (1980, 0, 8.50, 'item1980');
+INSERT INTO items VALUES (1981, 1, 8.75, 'item1981');
+INSERT INTO items VALUES (1982, 2, 9.00, 'item1982');
+INSERT INTO items VALUES (1983, 0, 9.25, 'item1983');
+INSERT INTO items VALUES (1984, 1, 9.50, 'item1984');
+INSERT INTO items VALUES (1985, 2, 9.75, 'item1985');
+INSERT INTO items VALUES (1986, 0, 10.00, 'item1986');
+INSERT INTO items VALUES (1987, 1, 10.25, 'item1987');
+INSERT INTO items VALUES (1988, 2, 10.50, 'item1988');
+INSERT INTO items VALUES (1989, 0, 10.75, 'item1989');
+INSERT INTO items VALUES (1990, 1, 11.00, 'item1990');
+INSERT INTO items VALUES (1991, 2, 11.25, 'item1991');
+INSERT INTO items VALUES (1992, 0, 11.50, 'item1992');
+INSERT INTO items VALUES (1993, 1, 11.75, 'item1993');
+INSERT INTO items VALUES (1994, 2, 12.00, 'item1994');
+INSERT INTO items VALUES (1995, 0, 12.25, 'item1995');
+INSERT INTO items VALUES (1996, 1, 12.50, 'item1996');
+INSERT INTO items VALUES (1997, 2, 12.75, 'item1997');
+INSERT INTO items VALUES (1998, 0, 13.00, 'item1998');
+INSERT INTO items VALUES (1999, 1, 13.25, 'item1999');
+INSERT INTO items VALUES (2000, 2, 1.00, 'item2000');
+INSERT INTO items VALUES (2001, 0, 1.25, 'item2001');
+INSERT INTO items VALUES (2002, 1, 1.50, 'item2002');
+INSERT INTO items VALUES (2003, 2, 1.75, 'item2003');
+INSERT INTO items VALUES (2004, 0, 2.00, 'item2004');
+INSERT INTO items VALUES (2005, 1, 2.25, 'item2005');
+INSERT INTO items VALUES (2006, 2, 2.50, 'item2006');
+INSERT INTO items VALUES (2007, 0, 2.75, 'item2007');
+INSERT INTO items VALUES (2008, 1, 3.00, 'item2008');
+INSERT INTO items VALUES (2009, 2, 3.25, 'item2009');
+INSERT INTO items VALUES (2010, 0, 3.50, 'item2010');
+INSERT INTO items VALUES (2011, 1, 3.75, 'item2011');
+INSERT INTO items VALUES (2012, 2, 4.00, 'item2012');
+INSERT INTO items VALUES (2013, 0, 4.25, 'item2013');
+INSERT INTO items VALUES (2014, 1, 4.50, 'item2014');
+INSERT INTO items VALUES (2015, 2, 4.75, 'item2015');
+INSERT INTO items VALUES (2016, 0, 5.00, 'item2016');
+INSERT INTO items VALUES (2017, 1, 5.25, 'item2017');
+INSERT INTO items VALUES (2018, 2, 5.50, 'item2018');
+INSERT INTO items VALUES (2019, 0, 5.75, 'item2019');
+INSERT INTO items VALUES (2020, 1, 6.00, 'item2020');
+INSERT INTO items VALUES (2021, 2, 6.25, 'item2021');
+INSERT INTO items VALUES (2022, 0, 6.50, 'item2022');
+INSERT INTO items VALUES (2023, 1, 6.75, 'item2023');
+INSERT INTO items VALUES (2024, 2, 7.00, 'item2024');
+INSERT INTO items VALUES (2025, 0, 7.25, 'item2025');
+INSERT INTO items VALUES (2026, 1, 7.50, 'item2026');
+INSERT INTO items VALUES (2027, 2, 7.75, 'item2027');
+INSERT INTO items VALUES (2028, 0, 8.00, 'item2028');
+INSERT INTO items VALUES (2029, 1, 8.25, 'item2029');
+INSERT INTO items VALUES (2030, 2, 8.50, 'item2030');
+INSERT INTO items VALUES (2031, 0, 8.75, 'item2031');
+INSERT INTO items VALUES (2032, 1, 9.00, 'item2032');
+INSERT INTO items VALUES (2033, 2, 9.25, 'item2033');
+INSERT INTO items VALUES (2034, 0, 9.50, 'item2034');
+INSERT INTO items VALUES (2035, 1, 9.75, 'item2035');
+INSERT INTO items VALUES (2036, 2, 10.00, 'item2036');
+INSERT INTO items VALUES (2037, 0, 10.25, 'item2037');
+INSERT INTO items VALUES (2038, 1, 10.50, 'item2038');
+INSERT INTO items VALUES (2039, 2, 10.75, 'item2039');
+INSERT INTO items VALUES (2040, 0, 11.00, 'item2040');
+INSERT INTO items VALUES (2041, 1, 11.25, 'item2041');
+INSERT INTO items VALUES (2042, 2, 11.50, 'item2042');
+INSERT INTO items VALUES (2043, 0, 11.75, 'item2043');
+INSERT INTO items VALUES (2044, 1, 12.00, 'item2044');
+INSERT INTO items VALUES (2045, 2, 12.25, 'item2045');
+INSERT INTO items VALUES (2046, 0, 12.50, 'item2046');
+INSERT INTO items VALUES (2047, 1, 12.75, 'item2047');
+INSERT INTO items VALUES (2048, 2, 13.00, 'item2048');
+INSERT INTO items VALUES (2049, 0, 13.25, 'item2049');
+INSERT INTO items VALUES (2050, 1, 1.00, 'item2050');
+INSERT INTO items VALUES (2051, 2, 1.25, 'item2051');
+INSERT INTO items VALUES (2052, 0, 1.50, 'item2052');
+INSERT INTO items VALUES (2053, 1, 1.75, 'item2053');
+INSERT INTO items VALUES (2054, 2, 2.00, 'item2054');
+INSERT INTO items VALUES (2055, 0, 2.25, 'item2055');
+INSERT INTO items VALUES (2056, 1, 2.50, 'item2056');
+INSERT INTO items VALUES (2057, 2, 2.75, 'item2057');
+INSERT INTO items VALUES (2058, 0, 3.00, 'item2058');
+INSERT INTO items VALUES (2059, 1, 3.25, 'item2059');
+INSERT INTO items VALUES (2060, 2, 3.50, 'item2060');
+INSERT INTO items VALUES (2061, 0, 3.75, 'item2061');
+INSERT INTO items VALUES (2062, 1, 4.00, 'item2062');
+INSERT INTO items VALUES (2063, 2, 4.25, 'item2063');
+INSERT INTO items VALUES (2064, 0, 4.50, 'item2064');
+INSERT INTO items VALUES (2065, 1, 4.75, 'item2065');
+INSERT INTO items VALUES (2066, 2, 5.00, 'item2066');
+INSERT INTO items VALUES (2067, 0, 5.25, 'item2067');
+INSERT INTO items VALUES (2068, 1, 5.50, 'item2068');
+INSERT INTO items VALUES (2069, 2, 5.75, 'item2069');
+INSERT INTO items VALUES (2070, 0, 6.00, 'item2070');
+INSERT INTO items VALUES (2071, 1, 6.25, 'item2071');
+INSERT INTO items VALUES (2072, 2, 6.50, 'item2072');
+INSERT INTO items VALUES (2073, 0, 6.75, 'item2073');
+INSERT INTO items VALUES (2074, 1, 7.00, 'item2074');
+INSERT INTO items VALUES (2075, 2, 7.25, 'item2075');
+INSERT INTO items VALUES (2076, 0, 7.50, 'item2076');
+INSERT INTO items VALUES (2077, 1, 7.75, 'item2077');
+INSERT INTO items VALUES (2078, 2, 8.00, 'item2078');
+INSERT INTO items VALUES (2079, 0, 8.25, 'item2079');
+INSERT INTO items VALUES (2080, 1, 8.50, 'item2080');
+INSERT INTO items VALUES (2081, 2, 8.75, 'item2081');
+INSERT INTO items VALUES (2082, 0, 9.00, 'item2082');
+INSERT INTO items VALUES (2083, 1, 9.25, 'item2083');
+INSERT INTO items VALUES (2084, 2, 9.50, 'item2084');
+INSERT INTO items VALUES (2085, 0, 9.75, 'item2085');
+INSERT INTO items VALUES (2086, 1, 10.00, 'item2086');
+INSERT INTO items VALUES (2087, 2, 10.25, 'item2087');
+INSERT INTO items VALUES (2088, 0, 10.50, 'item2088');
+INSERT INTO items VALUES (2089, 1, 10.75, 'item2089');
+INSERT INTO items VALUES (2090, 2, 11.00, 'item2090');
+INSERT INTO items VALUES (2091, 0, 11.25, 'item2091');
+INSERT INTO items VALUES (2092, 1, 11.50, 'item2092');
+INSERT INTO items VALUES (2093, 2, 11.75, 'item2093');
+INSERT INTO items VALUES (2094, 0, 12.00, 'item2094');
+INSERT INTO items VALUES (2095, 1, 12.25, 'item2095');
+INSERT INTO items VALUES (2096, 2, 12.50, 'item2096');
+INSERT INTO items VALUES (2097, 0, 12.75, 'item2097');
+INSERT INTO items VALUES (2098, 1, 13.00, 'item2098');
+INSERT INTO items VALUES (2099, 2, 13.25, 'item2099');
+INSERT INTO items VALUES (2100, 0, 1.00, 'item2100');
+INSERT INTO items VALUES (2101, 1, 1.25, 'item2101');
+INSERT INTO items VALUES (2102, 2, 1.50, 'item2102');
+INSERT INTO items VALUES (2103, 0, 1.75, 'item2103');
+INSERT INTO items VALUES (2104, 1, 2.00, 'item2104');
+INSERT INTO items VALUES (2105, 2, 2.25, 'item2105');
+INSERT INTO items VALUES (2106, 0, 2.50, 'item2106');
+INSERT INTO items VALUES (2107, 1, 2.75, 'item2107');
+INSERT INTO items VALUES (2108, 2, 3.00, 'item2108');
+INSERT INTO items VALUES (2109, 0, 3.25, 'item2109');
+INSERT INTO items VALUES (2110, 1, 3.50, 'item2110');
+INSERT INTO items VALUES (2111, 2, 3.75, 'item2111');
+INSERT INTO items VALUES (2112, 0, 4.00, 'item2112');
+INSERT INTO items VALUES (2113, 1, 4.25, 'item2113');
+INSERT INTO items VALUES (2114, 2, 4.50, 'item2114');
+INSERT INTO items VALUES (2115, 0, 4.75, 'item2115');
+INSERT INTO items VALUES (2116, 1, 5.00, 'item2116');
+INSERT INTO items VALUES (2117, 2, 5.25, 'item2117');
+INSERT INTO items VALUES (2118, 0, 5.50, 'item2118');
+INSERT INTO items VALUES (2119, 1, 5.75, 'item2119');
+INSERT INTO items VALUES (2120, 2, 6.00, 'item2120');
+INSERT INTO items VALUES (2121, 0, 6.25, 'item2121');
+INSERT INTO items VALUES (2122, 1, 6.50, 'item2122');
+INSERT INTO items VALUES (2123, 2, 6.75, 'item2123');
+INSERT INTO items VALUES (2124, 0, 7.00, 'item2124');
+INSERT INTO items VALUES (2125, 1, 7.25, 'item2125');
+INSERT INTO items VALUES (2126, 2, 7.50, 'item2126');
+INSERT INTO items VALUES (2127, 0, 7.75, 'item2127');
+INSERT INTO items VALUES (2128, 1, 8.00, 'item2128');
+INSERT INTO items VALUES (2129, 2, 8.25, 'item2129');
+INSERT INTO items VALUES (2130, 0, 8.50, 'item2130');
+INSERT INTO items VALUES (2131, 1, 8.75, 'item2131');
+INSERT INTO items VALUES (2132, 2, 9.00, 'item2132');
+INSERT INTO items VALUES (2133, 0, 9.25, 'item2133');
+INSERT INTO items VALUES (2134, 1, 9.50, 'item2134');
+INSERT INTO items VALUES (2135, 2, 9.75, 'item2135');
+INSERT INTO items VALUES (2136, 0, 10.00, 'item2136');
+INSERT INTO items VALUES (2137, 1, 10.25, 'item2137');
+INSERT INTO items VALUES (2138, 2, 10.50, 'item2138');
+INSERT INTO items VALUES (2139, 0, 10.75, 'item2139');
+INSERT INTO items VALUES (2140, 1, 11.00, 'item2140');
+INSERT INTO items VALUES (2141, 2, 11.25, 'item2141');
+INSERT INTO items VALUES (2142, 0, 11.50, 'item2142');
+INSERT INTO items VALUES (2143, 1, 11.75, 'item2143');
+INSERT INTO items VALUES (2144, 2, 12.00, 'item2144');
+INSERT INTO items VALUES (2145, 0, 12.25, 'item2145');
+INSERT INTO items VALUES (2146, 1, 12.50, 'item2146');
+INSERT INTO items VALUES (2147, 2, 12.75, 'item2147');
+INSERT INTO items VALUES (2148, 0, 13.00, 'item2148');
+INSERT INTO items VALUES (2149, 1, 13.25, 'item2149');
+INSERT INTO items VALUES (2150, 2, 1.00, 'item2150');
+INSERT INTO items VALUES (2151, 0, 1.25, 'item2151');
+INSERT INTO items VALUES (2152, 1, 1.50, 'item2152');
+INSERT INTO items VALUES (2153, 2, 1.75, 'item2153');
+INSERT INTO items VALUES (2154, 0, 2.00, 'item2154');
+INSERT INTO items VALUES (2155, 1, 2.25, 'item2155');
+INSERT INTO items VALUES (2156, 2, 2.50, 'item2156');
+INSERT INTO items VALUES (2157, 0, 2.75, 'item2157');
+INSERT INTO items VALUES (2158, 1, 3.00, 'item2158');
+INSERT INTO items VALUES (2159, 2, 3.25, 'item2159');
+INSERT INTO items VALUES (2160, 0, 3.50, 'item2160');
+INSERT INTO items VALUES (2161, 1, 3.75, 'item2161');
+INSERT INTO items VALUES (2162, 2, 4.00, 'item2162');
+INSERT INTO items VALUES (2163, 0, 4.25, 'item2163');
+INSERT INTO items VALUES (2164, 1, 4.50, 'item2164');
+INSERT INTO items VALUES (2165, 2, 4.75, 'item2165');
+INSERT INTO items VALUES (2166, 0, 5.00, 'item2166');
+INSERT INTO items VALUES (2167, 1, 5.25, 'item2167');
+INSERT INTO items VALUES (2168, 2, 5.50, 'item2168');
+INSERT INTO items VALUES (2169, 0, 5.75, 'item2169');
+INSERT INTO items VALUES (2170, 1, 6.00, 'item2170');
+INSERT INTO items VALUES (2171, 2, 6.25, 'item2171');
+INSERT INTO items VALUES (2172, 0, 6.50, 'item2172');
+INSERT INTO items VALUES (2173, 1, 6.75, 'item2173');
+INSERT INTO items VALUES (2174, 2, 7.00, 'item2174');
+INSERT INTO items VALUES (2175, 0, 7.25, 'item2175');
+INSERT INTO items VALUES (2176, 1, 7.50, 'item2176');
+INSERT INTO items VALUES (2177, 2, 7.75, 'item2177');
+INSERT INTO items VALUES (2178, 0, 8.00, 'item2178');
+INSERT INTO items VALUES (2179, 1, 8.25, 'item2179');
+INSERT INTO items VALUES (2180, 2, 8.50, 'item2180');
+INSERT INTO items VALUES (2181, 0, 8.75, 'item2181');
+INSERT INTO items VALUES (2182, 1, 9.00, 'item2182');
+INSERT INTO items VALUES (2183, 2, 9.25, 'item2183');
+INSERT INTO items VALUES (2184, 0, 9.50, 'item2184');
+INSERT INTO items VALUES (2185, 1, 9.75, 'item2185');
+INSERT INTO items VALUES (2186, 2, 10.00, 'item2186');
+INSERT INTO items VALUES (2187, 0, 10.25, 'item2187');
+INSERT INTO items VALUES (2188, 1, 10.50, 'item2188');
+INSERT INTO items VALUES (2189, 2, 10.75, 'item2189');
+INSERT INTO items VALUES (2190, 0, 11.00, 'item2190');
+INSERT INTO items VALUES (2191, 1, 11.25, 'item2191');
+INSERT INTO items VALUES (2192, 2, 11.50, 'item2192');
+INSERT INTO items VALUES (2193, 0, 11.75, 'item2193');
+INSERT INTO items VALUES (2194, 1, 12.00, 'item2194');
+INSERT INTO items VALUES (2195, 2, 12.25, 'item2195');
+INSERT INTO items VALUES (2196, 0, 12.50, 'item2196');
+INSERT INTO items VALUES (2197, 1, 12.75, 'item2197');
+INSERT INTO items VALUES (2198, 2, 13.00, 'item2198');
+INSERT INTO items VALUES (2199, 0, 13.25, 'item2199');
+INSERT INTO items VALUES (2200, 1, 1.00, 'item2200');
+INSERT INTO items VALUES (2201, 2, 1.25, 'item2201');
+INSERT INTO items VALUES (2202, 0, 1.50, 'item2202');
+INSERT INTO items VALUES (2203, 1, 1.75, 'item2203');
+INSERT INTO items VALUES (2204, 2, 2.00, 'item2204');
+INSERT INTO items VALUES (2205, 0, 2.25, 'item2205');
+INSERT INTO items VALUES (2206, 1, 2.50, 'item2206');
+INSERT INTO items VALUES (2207, 2, 2.75, 'item2207');
+INSERT INTO items VALUES (2208, 0, 3.00, 'item2208');
+INSERT INTO items VALUES (2209, 1, 3.25, 'item2209');
+INSERT INTO items VALUES (2210, 2, 3.50, 'item2210');
+INSERT INTO items VALUES (2211, 0, 3.75, 'item2211');
+INSERT INTO items VALUES (2212, 1, 4.00, 'item2212');
+INSERT INTO items VALUES (2213, 2, 4.25, 'item2213');
+INSERT INTO items VALUES (2214, 0, 4.50, 'item2214');
+INSERT INTO items VALUES (2215, 1, 4.75, 'item2215');
+INSERT INTO items VALUES (2216, 2, 5.00, 'item2216');
+INSERT INTO items VALUES (2217, 0, 5.25, 'item2217');
+INSERT INTO items VALUES (2218, 1, 5.50, 'item2218');
+INSERT INTO items VALUES (2219, 2, 5.75, 'item2219');
+INSERT INTO items VALUES (2220, 0, 6.00, 'item2220');
+INSERT INTO items VALUES (2221, 1, 6.25, 'item2221');
+INSERT INTO items VALUES (2222, 2, 6.50, 'item2222');
+INSERT INTO items VALUES (2223, 0, 6.75, 'item2223');
+INSERT INTO items VALUES (2224, 1, 7.00, 'item2224');
+INSERT INTO items VALUES (2225, 2, 7.25, 'item2225');
+INSERT INTO items VALUES (2226, 0, 7.50, 'item2226');
+INSERT INTO items VALUES (2227, 1, 7.75, 'item2227');
+INSERT INTO items VALUES (2228, 2, 8.00, 'item2228');
+INSERT INTO items VALUES (2229, 0, 8.25, 'item2229');
+INSERT INTO items VALUES (2230, 1, 8.50, 'item2230');
+INSERT INTO items VALUES (2231, 2, 8.75, 'item2231');
+INSERT INTO items VALUES (2232, 0, 9.00, 'item2232');
+INSERT INTO items VALUES (2233, 1, 9.25, 'item2233');
+INSERT INTO items VALUES (2234, 2, 9.50, 'item2234');
+INSERT INTO items VALUES (2235, 0, 9.75, 'item2235');
+INSERT INTO items VALUES (2236, 1, 10.00, 'item2236');
+INSERT INTO items VALUES (2237, 2, 10.25, 'item2237');
+INSERT INTO items VALUES (2238, 0, 10.50, 'item2238');
+INSERT INTO items VALUES (2239, 1, 10.75, 'item2239');
+INSERT INTO items VALUES (2240, 2, 11.00, 'item2240');
+INSERT INTO items VALUES (2241, 0, 11.25, 'item2241');
+INSERT INTO items VALUES (2242, 1, 11.50, 'item2242');
+INSERT INTO items VALUES (2243, 2, 11.75, 'item2243');
+INSERT INTO items VALUES (2244, 0, 12.00, 'item2244');
+INSERT INTO items VALUES (2245, 1, 12.25, 'item2245');
+INSERT INTO items VALUES (2246, 2, 12.50, 'item2246');
+INSERT INTO items VALUES (2247, 0, 12.75, 'item2247');
+INSERT INTO items VALUES (2248, 1, 13.00, 'item2248');
+INSERT INTO items VALUES (2249, 2, 13.25, 'item2249');
+INSERT INTO items VALUES (2250, 0, 1.00, 'item2250');
+INSERT INTO items VALUES (2251, 1, 1.25, 'item2251');
+INSERT INTO items VALUES (2252, 2, 1.50, 'item2252');
+INSERT INTO items VALUES (2253, 0, 1.75, 'item2253');
+INSERT INTO items VALUES (2254, 1, 2.00, 'item2254');
+INSERT INTO items VALUES (2255, 2, 2.25, 'item2255');
+INSERT INTO items VALUES (2256, 0, 2.50, 'item2256');
+INSERT INTO items VALUES (2257, 1, 2.75, 'item2257');
+INSERT INTO items VALUES (2258, 2, 3.00, 'item2258');
+INSERT INTO items VALUES (2259, 0, 3.25, 'item2259');
+INSERT INTO items VALUES (2260, 1, 3.50, 'item2260');
+INSERT INTO items VALUES (2261, 2, 3.75, 'item2261');
+INSERT INTO items VALUES (2262, 0, 4.00, 'item2262');
+INSERT INTO items VALUES (2263, 1, 4.25, 'item2263');
+INSERT INTO items VALUES (2264, 2, 4.50, 'item2264');
+INSERT INTO items VALUES (2265, 0, 4.75, 'item2265');
+INSERT INTO items VALUES (2266, 1, 5.00, 'item2266');
+INSERT INTO items VALUES (2267, 2, 5.25, 'item2267');
+INSERT INTO items VALUES (2268, 0, 5.50, 'item2268');
+INSERT INTO items VALUES (2269, 1, 5.75, 'item2269');
+INSERT INTO items VALUES (2270, 2, 6.00, 'item2270');
+INSERT INTO items VALUES (2271, 0, 6.25, 'item2271');
+INSERT INTO items VALUES (2272, 1, 6.50, 'item2272');
+INSERT INTO items VALUES (2273, 2, 6.75, 'item2273');
+INSERT INTO items VALUES (2274, 0, 7.00, 'item2274');
+INSERT INTO items VALUES (2275, 1, 7.25, 'item2275');
+INSERT INTO items VALUES (2276, 2, 7.50, 'item2276');
+INSERT INTO items VALUES (2277, 0, 7.75, 'item2277');
+INSERT INTO items VALUES (2278, 1, 8.00, 'item2278');
+INSERT INTO items VALUES (2279, 2, 8.25, 'item2279');
+INSERT INTO items VALUES (2280, 0, 8.50, 'item2280');
+INSERT INTO items VALUES (2281, 1, 8.75, 'item2281');
+INSERT INTO items VALUES (2282, 2, 9.00, 'item2282');
+INSERT INTO items VALUES (2283, 0, 9.25, 'item2283');
+INSERT INTO items VALUES (2284, 1, 9.50, 'item2284');
+INSERT INTO items VALUES (2285, 2, 9.75, 'item2285');
+INSERT INTO items VALUES (2286, 0, 10.00, 'item2286');
+INSERT INTO items VALUES (2287, 1, 10.25, 'item2287');
+INSERT INTO items VALUES (2288, 2, 10.50, 'item2288');
+INSERT INTO items VALUES (2289, 0, 10.75, 'item2289');
+INSERT INTO items VALUES (2290, 1, 11.00, 'item2290');
+INSERT INTO items VALUES (2291, 2, 11.25, 'item2291');
+INSERT INTO items VALUES (2292, 0, 11.50, 'item2292');
+INSERT INTO items VALUES (2293, 1, 11.75, 'item2293');
+INSERT INTO items VALUES (2294, 2, 12.00, 'item2294');
+INSERT INTO items VALUES (2295, 0, 12.25, 'item2295');
+INSERT INTO items VALUES (2296, 1, 12.50, 'item2296');
+INSERT INTO items VALUES (2297, 2, 12.75, 'item2297');
+INSERT INTO items VALUES (2298, 0, 13.00, 'item2298');
+INSERT INTO items VALUES (2299, 1, 13.25, 'item2299');
+INSERT INTO items VALUES (2300, 2, 1.00, 'item2300');
+INSERT INTO items VALUES (2301, 0, 1.25, 'item2301');
+INSERT INTO items VALUES (2302, 1, 1.50, 'item2302');
+INSERT INTO items VALUES (2303, 2, 1.75, 'item2303');
+INSERT INTO items VALUES (2304, 0, 2.00, 'item2304');
+INSERT INTO items VALUES (2305, 1, 2.25, 'item2305');
+INSERT INTO items VALUES (2306, 2, 2.50, 'item2306');
+INSERT INTO items VALUES (2307, 0, 2.75, 'item2307');
+INSERT INTO items VALUES (2308, 1, 3.00, 'item2308');
+INSERT INTO items VALUES (2309, 2, 3.25, 'item2309');
+INSERT INTO items VALUES (2310, 0, 3.50, 'item2310');
+INSERT INTO items VALUES (2311, 1, 3.75, 'item2311');
+INSERT INTO items VALUES (2312, 2, 4.00, 'item2312');
+INSERT INTO items VALUES (2313, 0, 4.25, 'item2313');
+INSERT INTO items VALUES (2314, 1, 4.50, 'item2314');
+INSERT INTO items VALUES (2315, 2, 4.75, 'item2315');
+INSERT INTO items VALUES (2316, 0, 5.00, 'item2316');
+INSERT INTO items VALUES (2317, 1, 5.25, 'item2317');
+INSERT INTO items VALUES (2318, 2, 5.50, 'item2318');
+INSERT INTO items VALUES (2319, 0, 5.75, 'item2319');
+INSERT INTO items VALUES (2320, 1, 6.00, 'item2320');
+INSERT INTO items VALUES (2321, 2, 6.25, 'item2321');
+INSERT INTO items VALUES (2322, 0, 6.50, 'item2322');
+INSERT INTO items VALUES (2323, 1, 6.75, 'item2323');
+INSERT INTO items VALUES (2324, 2, 7.00, 'item2324');
+INSERT INTO items VALUES (2325, 0, 7.25, 'item2325');
+INSERT INTO items VALUES (2326, 1, 7.50, 'item2326');
+INSERT INTO items VALUES (2327, 2, 7.75, 'item2327');
+INSERT INTO items VALUES (2328, 0, 8.00, 'item2328');
+INSERT INTO items VALUES (2329, 1, 8.25, 'item2329');
+INSERT INTO items VALUES (2330, 2, 8.50, 'item2330');
+INSERT INTO items VALUES (2331, 0, 8.75, 'item2331');
+INSERT INTO items VALUES (2332, 1, 9.00, 'item2332');
+INSERT INTO items VALUES (2333, 2, 9.25, 'item2333');
+INSERT INTO items VALUES (2334, 0, 9.50, 'item2334');
+INSERT INTO items VALUES (2335, 1, 9.75, 'item2335');
+INSERT INTO items VALUES (2336, 2, 10.00, 'item2336');
+INSERT INTO items VALUES (2337, 0, 10.25, 'item2337');
+INSERT INTO items VALUES (2338, 1, 10.50, 'item2338');
+INSERT INTO items VALUES (2339, 2, 10.75, 'item2339');
+INSERT INTO items VALUES (2340, 0, 11.00, 'item2340');
+INSERT INTO items VALUES (2341, 1, 11.25, 'item2341');
+INSERT INTO items VALUES (2342, 2, 11.50, 'item2342');
+INSERT INTO items VALUES (2343, 0, 11.75, 'item2343');
+INSERT INTO items VALUES (2344, 1, 12.00, 'item2344');
+INSERT INTO items VALUES (2345, 2, 12.25, 'item2345');
+INSERT INTO items VALUES (2346, 0, 12.50, 'item2346');
+INSERT INTO items VALUES (2347, 1, 12.75, 'item2347');
+INSERT INTO items VALUES (2348, 2, 13.00, 'item2348');
+INSERT INTO items VALUES (2349, 0, 13.25, 'item2349');
+INSERT INTO items VALUES (2350, 1, 1.00, 'item2350');
+INSERT INTO items VALUES (2351, 2, 1.25, 'item2351');
+INSERT INTO items VALUES (2352, 0, 1.50, 'item2352');
+INSERT INTO items VALUES (2353, 1, 1.75, 'item2353');
+INSERT INTO items VALUES (2354, 2, 2.00, 'item2354');
+INSERT INTO items VALUES (2355, 0, 2.25, 'item2355');
+INSERT INTO items VALUES (2356, 1, 2.50, 'item2356');
+INSERT INTO items VALUES (2357, 2, 2.75, 'item2357');
+INSERT INTO items VALUES (2358, 0, 3.00, 'item2358');
+INSERT INTO items VALUES (2359, 1, 3.25, 'item2359');
+INSERT INTO items VALUES (2360, 2, 3.50, 'item2360');
+INSERT INTO items VALUES (2361, 0, 3.75, 'item2361');
+INSERT INTO items VALUES (2362, 1, 4.00, 'item2362');
+INSERT INTO items VALUES (2363, 2, 4.25, 'item2363');
+INSERT INTO items VALUES (2364, 0, 4.50, 'item2364');
+INSERT INTO items VALUES (2365, 1, 4.75, 'item2365');
+INSERT INTO items VALUES (2366, 2, 5.00, 'item2366');
+INSERT INTO items VALUES (2367, 0, 5.25, 'item2367');
+INSERT INTO items VALUES (2368, 1, 5.50, 'item2368');
+INSERT INTO items VALUES (2369, 2, 5.75, 'item2369');
+INSERT INTO items VALUES (2370, 0, 6.00, 'item2370');
+INSERT INTO items VALUES (2371, 1, 6.25, 'item2371');
+INSERT INTO items VALUES (2372, 2, 6.50, 'item2372');
+INSERT INTO items VALUES (2373, 0, 6.75, 'item2373');
+INSERT INTO items VALUES (2374, 1, 7.00, 'item2374');
+INSERT INTO items VALUES (2375, 2, 7.25, 'item2375');
+INSERT INTO items VALUES (2376, 0, 7.50, 'item2376');
+INSERT INTO items VALUES (2377, 1, 7.75, 'item2377');
+INSERT INTO items VALUES (2378, 2, 8.00, 'item2378');
+INSERT INTO items VALUES (2379, 0, 8.25, 'item2379');
+INSERT INTO items VALUES (2380, 1, 8.50, 'item2380');
+INSERT INTO items VALUES (2381, 2, 8.75, 'item2381');
+INSERT INTO items VALUES (2382, 0, 9.00, 'item2382');
+INSERT INTO items VALUES (2383, 1, 9.25, 'item2383');
+INSERT INTO items VALUES (2384, 2, 9.50, 'item2384');
+INSERT INTO items VALUES (2385, 0, 9.75, 'item2385');
+INSERT INTO items VALUES (2386, 1, 10.00, 'item2386');
+INSERT INTO items VALUES (2387, 2, 10.25, 'item2387');
+INSERT INTO items VALUES (2388, 0, 10.50, 'item2388');
+INSERT INTO items VALUES (2389, 1, 10.75, 'item2389');
+INSERT INTO items VALUES (2390, 2, 11.00, 'item2390');
+INSERT INTO items VALUES (2391, 0, 11.25, 'item2391');
+INSERT INTO items VALUES (2392, 1, 11.50, 'item2392');
+INSERT INTO items VALUES (2393, 2, 11.75, 'item2393');
+INSERT INTO items VALUES (2394, 0, 12.00, 'item2394');
+INSERT INTO items VALUES (2395, 1, 12.25, 'item2395');
+INSERT INTO items VALUES (2396, 2, 12.50, 'item2396');
+INSERT INTO items VALUES (2397, 0, 12.75, 'item2397');
+INSERT INTO items VALUES (2398, 1, 13.00, 'item2398');
+INSERT INTO items VALUES (2399, 2, 13.25, 'item2399');
+INSERT INTO items VALUES (2400, 0, 1.00, 'item2400');
+INSERT INTO items VALUES (2401, 1, 1.25, 'item2401');
+INSERT INTO items VALUES (2402, 2, 1.50, 'item2402');
+INSERT INTO items VALUES (2403, 0, 1.75, 'item2403');
+INSERT INTO items VALUES (2404, 1, 2.00, 'item2404');
+INSERT INTO items VALUES (2405, 2, 2.25, 'item2405');
+INSERT INTO items VALUES (2406, 0, 2.50, 'item2406');
+INSERT INTO items VALUES (2407, 1, 2.75, 'item2407');
+INSERT INTO items VALUES (2408, 2, 3.00, 'item2408');
+INSERT INTO items VALUES (2409, 0, 3.25, 'item2409');
+INSERT INTO items VALUES (2410, 1, 3.50, 'item2410');
+INSERT INTO items VALUES (2411, 2, 3.75, 'item2411');
+INSERT INTO items VALUES (2412, 0, 4.00, 'item2412');
+INSERT INTO items VALUES (2413, 1, 4.25, 'item2413');
+INSERT INTO items VALUES (2414, 2, 4.50, 'item2414');
+INSERT INTO items VALUES (2415, 0, 4.75, 'item2415');
+INSERT INTO items VALUES (2416, 1, 5.00, 'item2416');
+INSERT INTO items VALUES (2417, 2, 5.25, 'item2417');
+INSERT INTO items VALUES (2418, 0, 5.50, 'item2418');
+INSERT INTO items VALUES (2419, 1, 5.75, 'item2419');
+INSERT INTO items VALUES (2420, 2, 6.00, 'item2420');
+INSERT INTO items VALUES (2421, 0, 6.25, 'item2421');
+INSERT INTO items VALUES (2422, 1, 6.50, 'item2422');
+INSERT INTO items VALUES (2423, 2, 6.75, 'item2423');
+INSERT INTO items VALUES (2424, 0, 7.00, 'item2424');
+INSERT INTO items VALUES (2425, 1, 7.25, 'item2425');
+INSERT INTO items VALUES (2426, 2, 7.50, 'item2426');
+INSERT INTO items VALUES (2427, 0, 7.75, 'item2427');
+INSERT INTO items VALUES (2428, 1, 8.00, 'item2428');
+INSERT INTO items VALUES (2429, 2, 8.25, 'item2429');
+INSERT INTO items VALUES (2430, 0, 8.50, 'item2430');
+INSERT INTO items VALUES (2431, 1, 8.75, 'item2431');
+INSERT INTO items VALUES (2432, 2, 9.00, 'item2432');
+INSERT INTO items VALUES (2433, 0, 9.25, 'item2433');
+INSERT INTO items VALUES (2434, 1, 9.50, 'item2434');
+INSERT INTO items VALUES (2435, 2, 9.75, 'item2435');
+INSERT INTO items VALUES (2436, 0, 10.00, 'item2436');
+INSERT INTO items VALUES (2437, 1, 10.25, 'item2437');
+INSERT INTO items VALUES (2438, 2, 10.50, 'item2438');
+INSERT INTO items VALUES (2439, 0, 10.75, 'item2439');
+INSERT INTO items VALUES (2440, 1, 11.00, 'item2440');
+INSERT INTO items VALUES (2441, 2, 11.25, 'item2441');
+INSERT INTO items VALUES (2442, 0, 11.50, 'item2442');
+INSERT INTO items VALUES (2443, 1, 11.75, 'item2443');
+INSERT INTO items VALUES (2444, 2, 12.00, 'item2444');
+INSERT INTO items VALUES (2445, 0, 12.25, 'item2445');
+INSERT INTO items VALUES (2446, 1, 12.50, 'item2446');
+INSERT INTO items VALUES (2447, 2, 12.75, 'item2447');
+INSERT INTO items VALUES (2448, 0, 13.00, 'item2448');
+INSERT INTO items VALUES (2449, 1, 13.25, 'item2449');
+INSERT INTO items VALUES (2450, 2, 1.00, 'item2450');
+INSERT INTO items VALUES (2451, 0, 1.25, 'item2451');
+INSERT INTO items VALUES (2452, 1, 1.50, 'item2452');
+INSERT INTO items VALUES (2453, 2, 1.75, 'item2453');
+INSERT INTO items VALUES (2454, 0, 2.00, 'item2454');
+INSERT INTO items VALUES (2455, 1, 2.25, 'item2455');
+INSERT INTO items VALUES (2456, 2, 2.50, 'item2456');
+INSERT INTO items VALUES (2457, 0, 2.75, 'item2457');
+INSERT INTO items VALUES (2458, 1, 3.00, 'item2458');
+INSERT INTO items VALUES (2459, 2, 3.25, 'item2459');
+INSERT INTO items VALUES (2460, 0, 3.50, 'item2460');
+INSERT INTO items VALUES (2461, 1, 3.75, 'item2461');
+INSERT INTO items VALUES (2462, 2, 4.00, 'item2462');
+INSERT INTO items VALUES (2463, 0, 4.25, 'item2463');
+INSERT INTO items VALUES (2464, 1, 4.50, 'item2464');
+INSERT INTO items VALUES (2465, 2, 4.75, 'item2465');
+INSERT INTO items VALUES (2466, 0, 5.00, 'item2466');
+INSERT INTO items VALUES (2467, 1, 5.25, 'item2467');
+INSERT INTO items VALUES (2468, 2, 5.50, 'item2468');
+INSERT INTO items VALUES (2469, 0, 5.75, 'item2469');
+INSERT INTO items VALUES (2470, 1, 6.00, 'item2470');
+INSERT INTO items VALUES (2471, 2, 6.25, 'item2471');
+INSERT INTO items VALUES (2472, 0, 6.50, 'item2472');
+INSERT INTO items VALUES (2473, 1, 6.75, 'item2473');
+INSERT INTO items VALUES (2474, 2, 7.00, 'item2474');
+INSERT INTO items VALUES (2475, 0, 7.25, 'item2475');
+INSERT INTO items VALUES (2476, 1, 7.50, 'item2476');
+INSERT INTO items VALUES (2477, 2, 7.75, 'item2477');
+INSERT INTO items VALUES (2478, 0, 8.00, 'item2478');
+INSERT INTO items VALUES (2479, 1, 8.25, 'item2479');
+INSERT INTO items VALUES (2480, 2, 8.50, 'item2480');
+INSERT INTO items VALUES (2481, 0, 8.75, 'item2481');
+INSERT INTO items VALUES (2482, 1, 9.00, 'item2482');
+INSERT INTO items VALUES (2483, 2, 9.25, 'item2483');
+INSERT INTO items VALUES (2484, 0, 9.50, 'item2484');
+INSERT INTO items VALUES (2485, 1, 9.75, 'item2485');
+INSERT INTO items VALUES (2486, 2, 10.00, 'item2486');
+INSERT INTO items VALUES (2487, 0, 10.25, 'item2487');
+INSERT INTO items VALUES (2488, 1, 10.50, 'item2488');
+INSERT INTO items VALUES (2489, 2, 10.75, 'item2489');
+INSERT INTO items VALUES (2490, 0, 11.00, 'item2490');
+INSERT INTO items VALUES (2491, 1, 11.25, 'item2491');
+INSERT INTO items VALUES (2492, 2, 11.50, 'item2492');
+INSERT INTO items VALUES (2493, 0, 11.75, 'item2493');
+INSERT INTO items VALUES (2494, 1, 12.00, 'item2494');
+INSERT INTO items VALUES (2495, 2, 12.25, 'item2495');
+INSERT INTO items VALUES (2496, 0, 12.50, 'item2496');
+INSERT INTO items VALUES (2497, 1, 12.75, 'item2497');
+INSERT INTO items VALUES (2498, 2, 13.00, 'item2498');
+INSERT INTO items VALUES (2499, 0, 13.25, 'item2499');
+INSERT INTO items VALUES (2500, 1, 1.00, 'item2500');
+INSERT INTO items VALUES (2501, 2, 1.25, 'item2501');
+INSERT INTO items VALUES (2502, 0, 1.50, 'item2502');
+INSERT INTO items VALUES (2503, 1, 1.75, 'item2503');
+INSERT INTO items VALUES (2504, 2, 2.00, 'item2504');
+INSERT INTO items VALUES (2505, 0, 2.25, 'item2505');
+INSERT INTO items VALUES (2506, 1, 2.50, 'item2506');
+INSERT INTO items VALUES (2507, 2, 2.75, 'item2507');
+INSERT INTO items VALUES (2508, 0, 3.00, 'item2508');
+INSERT INTO items VALUES (2509, 1, 3.25, 'item2509');
+INSERT INTO items VALUES (2510, 2, 3.50, 'item2510');
+INSERT INTO items VALUES (2511, 0, 3.75, 'item2511');
+INSERT INTO items VALUES (2512, 1, 4.00, 'item2512');
+INSERT INTO items VALUES (2513, 2, 4.25, 'item2513');
+INSERT INTO items VALUES (2514, 0, 4.50, 'item2514');
+INSERT INTO items VALUES (2515, 1, 4.75, 'item2515');
+INSERT INTO items VALUES (2516, 2, 5.00, 'item2516');
+INSERT INTO items VALUES (2517, 0, 5.25, 'item2517');
+INSERT INTO items VALUES (2518, 1, 5.50, 'item2518');
+INSERT INTO items VALUES (2519, 2, 5.75, 'item2519');
+INSERT INTO items VALUES (2520, 0, 6.00, 'item2520');
+INSERT INTO items VALUES (2521, 1, 6.25, 'item2521');
+INSERT INTO items VALUES (2522, 2, 6.50, 'item2522');
+INSERT INTO items VALUES (2523, 0, 6.75, 'item2523');
+INSERT INTO items VALUES (2524, 1, 7.00, 'item2524');
+INSERT INTO items VALUES (2525, 2, 7.25, 'item2525');
+INSERT INTO items VALUES (2526, 0, 7.50, 'item2526');
+INSERT INTO items VALUES (2527, 1, 7.75, 'item2527');
+INSERT INTO items VALUES (2528, 2, 8.00, 'item2528');
+INSERT INTO items VALUES (2529, 0, 8.25, 'item2529');
+INSERT INTO items VALUES (2530, 1, 8.50, 'item2530');
+INSERT INTO items VALUES (2531, 2, 8.75, 'item2531');
+INSERT INTO items VALUES (2532, 0, 9.00, 'item2532');
+INSERT INTO items VALUES (2533, 1, 9.25, 'item2533');
+INSERT INTO items VALUES (2534, 2, 9.50, 'item2534');
+INSERT INTO items VALUES (2535, 0, 9.75, 'item2535');
+INSERT INTO items VALUES (2536, 1, 10.00, 'item2536');
+INSERT INTO items VALUES (2537, 2, 10.25, 'item2537');
+INSERT INTO items VALUES (2538, 0, 10.50, 'item2538');
+INSERT INTO items VALUES (2539, 1, 10.75, 'item2539');
+INSERT INTO items VALUES (2540, 2, 11.00, 'item2540');
+INSERT INTO items VALUES (2541, 0, 11.25, 'item2541');
+INSERT INTO items VALUES (2542, 1, 11.50, 'item2542');
+INSERT INTO items VALUES (2543, 2, 11.75, 'item2543');
+INSERT INTO items VALUES (2544, 0, 12.00, 'item2544');
+INSERT INTO items VALUES (2545, 1, 12.25, 'item2545');
+INSERT INTO items VALUES (2546, 2, 12.50, 'item2546');
+INSERT INTO items VALUES (2547, 0, 12.75, 'item2547');
+INSERT INTO items VALUES (2548, 1, 13.00, 'item2548');
+INSERT INTO items VALUES (2549, 2, 13.25, 'item2549');
+INSERT INTO items VALUES (2550, 0, 1.00, 'item2550');
+INSERT INTO items VALUES (2551, 1, 1.25, 'item2551');
+INSERT INTO items VALUES (2552, 2, 1.50, 'item2552');
+INSERT INTO items VALUES (2553, 0, 1.75, 'item2553');
+INSERT INTO items VALUES (2554, 1, 2.00, 'item2554');
+INSERT INTO items VALUES (2555, 2, 2.25, 'item2555');
+INSERT INTO items VALUES (2556, 0, 2.50, 'item2556');
+INSERT INTO items VALUES (2557, 1, 2.75, 'item2557');
+INSERT INTO items VALUES (2558, 2, 3.00, 'item2558');
+INSERT INTO items VALUES (2559, 0, 3.25, 'item2559');
+INSERT INTO items VALUES (2560, 1, 3.50, 'item2560');
+INSERT INTO items VALUES (2561, 2, 3.75, 'item2561');
+INSERT INTO items VALUES (2562, 0, 4.00, 'item2562');
+INSERT INTO items VALUES (2563, 1, 4.25, 'item2563');
+INSERT INTO items VALUES (2564, 2, 4.50, 'item2564');
+INSERT INTO items VALUES (2565, 0, 4.75, 'item2565');
+INSERT INTO items VALUES (2566, 1, 5.00, 'item2566');
+INSERT INTO items VALUES (2567, 2, 5.25, 'item2567');
+INSERT INTO items VALUES (2568, 0, 5.50, 'item2568');
+INSERT INTO items VALUES (2569, 1, 5.75, 'item2569');
+INSERT INTO items VALUES (2570, 2, 6.00, 'item2570');
+INSERT INTO items VALUES (2571, 0, 6.25, 'item2571');
+INSERT INTO items VALUES (2572, 1, 6.50, 'item2572');
+INSERT INTO items VALUES (2573, 2, 6.75, 'item2573');
+INSERT INTO items VALUES (2574, 0, 7.00, 'item2574');
+INSERT INTO items VALUES (2575, 1, 7.25, 'item2575');
+INSERT INTO items VALUES (2576, 2, 7.50, 'item2576');
+INSERT INTO items VALUES (2577, 0, 7.75, 'item2577');
+INSERT INTO items VALUES (2578, 1, 8.00, 'item2578');
+INSERT INTO items VALUES (2579, 2, 8.25, 'item2579');
+INSERT INTO items VALUES (2580, 0, 8.50, 'item2580');
+INSERT INTO items VALUES (2581, 1, 8.75, 'item2581');
+INSERT INTO items VALUES (2582, 2, 9.00, 'item2582');
+INSERT INTO items VALUES (2583, 0, 9.25, 'item2583');
+INSERT INTO items VALUES (2584, 1, 9.50, 'item2584');
+INSERT INTO items VALUES (2585, 2, 9.75, 'item2585');
+INSERT INTO items VALUES (2586, 0, 10.00, 'item2586');
+INSERT INTO items VALUES (2587, 1, 10.25, 'item2587');
+INSERT INTO items VALUES (2588, 2, 10.50, 'item2588');
+INSERT INTO items VALUES (2589, 0, 10.75, 'item2589');
+INSERT INTO items VALUES (2590, 1, 11.00, 'item2590');
+INSERT INTO items VALUES (2591, 2, 11.25, 'item2591');
+INSERT INTO items VALUES (2592, 0, 11.50, 'item2592');
+INSERT INTO items VALUES (2593, 1, 11.75, 'item2593');
+INSERT INTO items VALUES (2594, 2, 12.00, 'item2594');
+INSERT INTO items VALUES (2595, 0, 12.25, 'item2595');
+INSERT INTO items VALUES (2596, 1, 12.50, 'item2596');
+INSERT INTO items VALUES (2597, 2, 12.75, 'item2597');
+INSERT INTO items VALUES (2598, 0, 13.00, 'item2598');
+INSERT INTO items VALUES (2599, 1, 13.25, 'item2599');
+INSERT INTO items VALUES (2600, 2, 1.00, 'item2600');
+INSERT INTO items VALUES (2601, 0, 1.25, 'item2601');
+INSERT INTO items VALUES (2602, 1, 1.50, 'item2602');
+INSERT INTO items VALUES (2603, 2, 1.75, 'item2603');
+INSERT INTO items VALUES (2604, 0, 2.00, 'item2604');
+INSERT INTO items VALUES (2605, 1, 2.25, 'item2605');
+INSERT INTO items VALUES (2606, 2, 2.50, 'item2606');
+INSERT INTO items VALUES (2607, 0, 2.75, 'item2607');
+INSERT INTO items VALUES (2608, 1, 3.00, 'item2608');
+INSERT INTO items VALUES (2609, 2, 3.25, 'item2609');
+INSERT INTO items VALUES (2610, 0, 3.50, 'item2610');
+INSERT INTO items VALUES (2611, 1, 3.75, 'item2611');
+INSERT INTO items VALUES (2612, 2, 4.00, 'item2612');
+INSERT INTO items VALUES (2613, 0, 4.25, 'item2613');
+INSERT INTO items VALUES (2614, 1, 4.50, 'item2614');
+INSERT INTO items VALUES (2615, 2, 4.75, 'item2615');
+INSERT INTO items VALUES (2616, 0, 5.00, 'item2616');
+INSERT INTO items VALUES (2617, 1, 5.25, 'item2617');
+INSERT INTO items VALUES (2618, 2, 5.50, 'item2618');
+INSERT INTO items VALUES (2619, 0, 5.75, 'item2619');
+INSERT INTO items VALUES (2620, 1, 6.00, 'item2620');
+INSERT INTO items VALUES (2621, 2, 6.25, 'item2621');
+INSERT INTO items VALUES (2622, 0, 6.50, 'item2622');
+INSERT INTO items VALUES (2623, 1, 6.75, 'item2623');
+INSERT INTO items VALUES (2624, 2, 7.00, 'item2624');
+INSERT INTO items VALUES (2625, 0, 7.25, 'item2625');
+INSERT INTO items VALUES (2626, 1, 7.50, 'item2626');
+INSERT INTO items VALUES (2627, 2, 7.75, 'item2627');
+INSERT INTO items VALUES (2628, 0, 8.00, 'item2628');
+INSERT INTO items VALUES (2629, 1, 8.25, 'item2629');
+INSERT INTO items VALUES (2630, 2, 8.50, 'item2630');
+INSERT INTO items VALUES (2631, 0, 8.75, 'item2631');
+INSERT INTO items VALUES (2632, 1, 9.00, 'item2632');
+INSERT INTO items VALUES (2633, 2, 9.25, 'item2633');
+INSERT INTO items VALUES (2634, 0, 9.50, 'item2634');
+INSERT INTO items VALUES (2635, 1, 9.75, 'item2635');
+INSERT INTO items VALUES (2636, 2, 10.00, 'item2636');
+INSERT INTO items VALUES (2637, 0, 10.25, 'item2637');
+INSERT INTO items VALUES (2638, 1, 10.50, 'item2638');
+INSERT INTO items VALUES (2639, 2, 10.75, 'item2639');
+INSERT INTO items VALUES (2640, 0, 11.00, 'item2640');
+INSERT INTO items VALUES (2641, 1, 11.25, 'item2641');
+INSERT INTO items VALUES (2642, 2, 11.50, 'item2642');
+INSERT INTO items VALUES (2643, 0, 11.75, 'item2643');
+INSERT INTO items VALUES (2644, 1, 12.00, 'item2644');
+INSERT INTO items VALUES (2645, 2, 12.25, 'item2645');
+INSERT INTO items VALUES (2646, 0, 12.50, 'item2646');
+INSERT INTO items VALUES (2647, 1, 12.75, 'item2647');
+INSERT INTO items VALUES (2648, 2, 13.00, 'item2648');
+INSERT INTO items VALUES (2649, 0, 13.25, 'item2649');
+INSERT INTO items VALUES (2650, 1, 1.00, 'item2650');
+INSERT INTO items VALUES (2651, 2, 1.25, 'item2651');
+INSERT INTO items VALUES (2652, 0, 1.50, 'item2652');
+INSERT INTO items VALUES (2653, 1, 1.75, 'item2653');
+INSERT INTO items VALUES (2654, 2, 2.00, 'item2654');
+INSERT INTO items VALUES (2655, 0, 2.25, 'item2655');
+INSERT INTO items VALUES (2656, 1, 2.50, 'item2656');
+INSERT INTO items VALUES (2657, 2, 2.75, 'item2657');
+INSERT INTO items VALUES (2658, 0, 3.00, 'item2658');
+INSERT INTO items VALUES (2659, 1, 3.25, 'item2659');
+INSERT INTO items VALUES (2660, 2, 3.50, 'item2660');
+INSERT INTO items VALUES (2661, 0, 3.75, 'item2661');
+INSERT INTO items VALUES (2662, 1, 4.00, 'item2662');
+INSERT INTO items VALUES (2663, 2, 4.25, 'item2663');
+INSERT INTO items VALUES (2664, 0, 4.50, 'item2664');
+INSERT INTO items VALUES (2665, 1, 4.75, 'item2665');
+INSERT INTO items VALUES (2666, 2, 5.00, 'item2666');
+INSERT INTO items VALUES (2667, 0, 5.25, 'item2667');
+INSERT INTO items VALUES (2668, 1, 5.50, 'item2668');
+INSERT INTO items VALUES (2669, 2, 5.75, 'item2669');
+INSERT INTO items VALUES (2670, 0, 6.00, 'item2670');
+INSERT INTO items VALUES (2671, 1, 6.25, 'item2671');
+INSERT INTO items VALUES (2672, 2, 6.50, 'item2672');
+INSERT INTO items VALUES (2673, 0, 6.75, 'item2673');
+INSERT INTO items VALUES (2674, 1, 7.00, 'item2674');
+INSERT INTO items VALUES (2675, 2, 7.25, 'item2675');
+INSERT INTO items VALUES (2676, 0, 7.50, 'item2676');
+INSERT INTO items VALUES (2677, 1, 7.75, 'item2677');
+INSERT INTO items VALUES (2678, 2, 8.00, 'item2678');
+INSERT INTO items VALUES (2679, 0, 8.25, 'item2679');
+INSERT INTO items VALUES (2680, 1, 8.50, 'item2680');
+INSERT INTO items VALUES (2681, 2, 8.75, 'item2681');
+INSERT INTO items VALUES (2682, 0, 9.00, 'item2682');
+INSERT INTO items VALUES (2683, 1, 9.25, 'item2683');
+INSERT INTO items VALUES (2684, 2, 9.50, 'item2684');
+INSERT INTO items VALUES (2685, 0, 9.75, 'item2685');
+INSERT INTO items VALUES (2686, 1, 10.00, 'item2686');
+INSERT INTO items VALUES (2687, 2, 10.25, 'item2687');
+INSERT INTO items VALUES (2688, 0, 10.50, 'item2688');
+INSERT INTO items VALUES (2689, 1, 10.75, 'item2689');
+INSERT INTO items VALUES (2690, 2, 11.00, 'item2690');
+INSERT INTO items VALUES (2691, 0, 11.25, 'item2691');
+INSERT INTO items VALUES (2692, 1, 11.50, 'item2692');
+INSERT INTO items VALUES (2693, 2, 11.75, 'item2693');
+INSERT INTO items VALUES (2694, 0, 12.00, 'item2694');
+INSERT INTO items VALUES (2695, 1, 12.25, 'item2695');
+INSERT INTO items VALUES (2696, 2, 12.50, 'item2696');
+INSERT INTO items VALUES (2697, 0, 12.75, 'item2697');
+INSERT INTO items VALUES (2698, 1, 13.00, 'item2698');
+INSERT INTO items VALUES (2699, 2, 13.25, 'item2699');
+INSERT INTO items VALUES (2700, 0, 1.00, 'item2700');
+INSERT INTO items VALUES (2701, 1, 1.25, 'item2701');
+INSERT INTO items VALUES (2702, 2, 1.50, 'item2702');
+INSERT INTO items VALUES (2703, 0, 1.75, 'item2703');
+INSERT INTO items VALUES (2704, 1, 2.00, 'item2704');
+INSERT INTO items VALUES (2705, 2, 2.25, 'item2705');
+INSERT INTO items VALUES (2706, 0, 2.50, 'item2706');
+INSERT INTO items VALUES (2707, 1, 2.75, 'item2707');
+INSERT INTO items VALUES (2708, 2, 3.00, 'item2708');
+INSERT INTO items VALUES (2709, 0, 3.25, 'item2709');
+INSERT INTO items VALUES (2710, 1, 3.50, 'item2710');
+INSERT INTO items VALUES (2711, 2, 3.75, 'item2711');
+INSERT INTO items VALUES (2712, 0, 4.00, 'item2712');
+INSERT INTO items VALUES (2713, 1, 4.25, 'item2713');
+INSERT INTO items VALUES (2714, 2, 4.50, 'item2714');
+INSERT INTO items VALUES (2715, 0, 4.75, 'item2715');
+INSERT INTO items VALUES (2716, 1, 5.00, 'item2716');
+INSERT INTO items VALUES (2717, 2, 5.25, 'item2717');
+INSERT INTO items VALUES (2718, 0, 5.50, 'item2718');
+INSERT INTO items VALUES (2719, 1, 5.75, 'item2719');
+INSERT INTO items VALUES (2720, 2, 6.00, 'item2720');
+INSERT INTO items VALUES (2721, 0, 6.25, 'item2721');
+INSERT INTO items VALUES (2722, 1, 6.50, 'item2722');
+INSERT INTO items VALUES (2723, 2, 6.75, 'item2723');
+INSERT INTO items VALUES (2724, 0, 7.00, 'item2724');
+INSERT INTO items VALUES (2725, 1, 7.25, 'item2725');
+INSERT INTO items VALUES (2726, 2, 7.50, 'item2726');
+INSERT INTO items VALUES (2727, 0, 7.75, 'item2727');
+INSERT INTO items VALUES (2728, 1, 8.00, 'item2728');
+INSERT INTO items VALUES (2729, 2, 8.25, 'item2729');
+INSERT INTO items VALUES (2730, 0, 8.50, 'item2730');
+INSERT INTO items VALUES (2731, 1, 8.75, 'item2731');
+INSERT INTO items VALUES (2732, 2, 9.00, 'item2732');
+INSERT INTO items VALUES (2733, 0, 9.25, 'item2733');
+INSERT INTO items VALUES (2734, 1, 9.50, 'item2734');
+INSERT INTO items VALUES (2735, 2, 9.75, 'item2735');
+INSERT INTO items VALUES (2736, 0, 10.00, 'item2736');
+INSERT INTO items VALUES (2737, 1, 10.25, 'item2737');
+INSERT INTO items VALUES (2738, 2, 10.50, 'item2738');
+INSERT INTO items VALUES (2739, 0, 10.75, 'item2739');
+INSERT INTO items VALUES (2740, 1, 11.00, 'item2740');
+INSERT INTO items VALUES (2741, 2, 11.25, 'item2741');
+INSERT INTO items VALUES (2742, 0, 11.50, 'item2742');
+INSERT INTO items VALUES (2743, 1, 11.75, 'item2743');
+INSERT INTO items VALUES (2744, 2, 12.00, 'item2744');
+INSERT INTO items VALUES (2745, 0, 12.25, 'item2745');
+INSERT INTO items VALUES (2746, 1, 12.50, 'item2746');
+INSERT INTO items VALUES (2747, 2, 12.75, 'item2747');
+INSERT INTO items VALUES (2748, 0, 13.00, 'item2748');
+INSERT INTO items VALUES (2749, 1, 13.25, 'item2749');
+INSERT INTO items VALUES (2750, 2, 1.00, 'item2750');
+INSERT INTO items VALUES (2751, 0, 1.25, 'item2751');
+INSERT INTO items VALUES (2752, 1, 1.50, 'item2752');
+INSERT INTO items VALUES (2753, 2, 1.75, 'item2753');
+INSERT INTO items VALUES (2754, 0, 2.00, 'item2754');
+INSERT INTO items VALUES (2755, 1, 2.25, 'item2755');
+INSERT INTO items VALUES (2756, 2, 2.50, 'item2756');
+INSERT INTO items VALUES (2757, 0, 2.75, 'item2757');
+INSERT INTO items VALUES (2758, 1, 3.00, 'item2758');
+INSERT INTO items VALUES (2759, 2, 3.25, 'item2759');
+INSERT INTO items VALUES (2760, 0, 3.50, 'item2760');
+INSERT INTO items VALUES (2761, 1, 3.75, 'item2761');
+INSERT INTO items VALUES (2762, 2, 4.00, 'item2762');
+INSERT INTO items VALUES (2763, 0, 4.25, 'item2763');
+INSERT INTO items VALUES (2764, 1, 4.50, 'item2764');
+INSERT INTO items VALUES (2765, 2, 4.75, 'item2765');
+INSERT INTO items VALUES (2766, 0, 5.00, 'item2766');
+INSERT INTO items VALUES (2767, 1, 5.25, 'item2767');
+INSERT INTO items VALUES (2768, 2, 5.50, 'item2768');
+INSERT INTO items VALUES (2769, 0, 5.75, 'item2769');
+INSERT INTO items VALUES (2770, 1, 6.00, 'item2770');
+INSERT INTO items VALUES (2771, 2, 6.25, 'item2771');
+INSERT INTO items VALUES (2772, 0, 6.50, 'item2772');
+INSERT INTO items VALUES (2773, 1, 6.75, 'item2773');
+INSERT INTO items VALUES (2774, 2, 7.00, 'item2774');
+INSERT INTO items VALUES (2775, 0, 7.25, 'item2775');
+INSERT INTO items VALUES (2776, 1, 7.50, 'item2776');
+INSERT INTO items VALUES (2777, 2, 7.75, 'item2777');
+INSERT INTO items VALUES (2778, 0, 8.00, 'item2778');
+INSERT INTO items VALUES (2779, 1, 8.25, 'item2779');
+INSERT INTO items VALUES (2780, 2, 8.50, 'item2780');
+INSERT INTO items VALUES (2781, 0, 8.75, 'item2781');
+INSERT INTO items VALUES (2782, 1, 9.00, 'item2782');
+INSERT INTO items VALUES (2783, 2, 9.25, 'item2783');
+INSERT INTO items VALUES (2784, 0, 9.50, 'item2784');
+INSERT INTO items VALUES (2785, 1, 9.75, 'item2785');
+INSERT INTO items VALUES (2786, 2, 10.00, 'item2786');
+INSERT INTO items VALUES (2787, 0, 10.25, 'item2787');
+INSERT INTO items VALUES (2788, 1, 10.50, 'item2788');
+INSERT INTO items VALUES (2789, 2, 10.75, 'item2789');
+INSERT INTO items VALUES (2790, 0, 11.00, 'item2790');
+INSERT INTO items VALUES (2791, 1, 11.25, 'item2791');
+INSERT INTO items VALUES (2792, 2, 11.50, 'item2792');
+INSERT INTO items VALUES (2793, 0, 11.75, 'item2793');
+INSERT INTO items VALUES (2794, 1, 12.00, 'item2794');
+INSERT INTO items VALUES (2795, 2, 12.25, 'item2795');
+INSERT INTO items VALUES (2796, 0, 12.50, 'item2796');
+INSERT INTO items VALUES (2797, 1, 12.75, 'item2797');
+INSERT INTO items VALUES (2798, 2, 13.00, 'item2798');
+INSERT INTO items VALUES (2799, 0, 13.25, 'item2799');
+INSERT INTO items VALUES (2800, 1, 1.00, 'item2800');
+INSERT INTO items VALUES (2801, 2, 1.25, 'item2801');
+INSERT INTO items VALUES (2802, 0, 1.50, 'item2802');
+INSERT INTO items VALUES (2803, 1, 1.75, 'item2803');
+INSERT INTO items VALUES (2804, 2, 2.00, 'item2804');
+INSERT INTO items VALUES (2805, 0, 2.25, 'item2805');
+INSERT INTO items VALUES (2806, 1, 2.50, 'item2806');
+INSERT INTO items VALUES (2807, 2, 2.75, 'item2807');
+INSERT INTO items VALUES (2808, 0, 3.00, 'item2808');
+INSERT INTO items VALUES (2809, 1, 3.25, 'item2809');
+INSERT INTO items VALUES (2810, 2, 3.50, 'item2810');
+INSERT INTO items VALUES (2811, 0, 3.75, 'item2811');
+INSERT INTO items VALUES (2812, 1, 4.00, 'item2812');
+INSERT INTO items VALUES (2813, 2, 4.25, 'item2813');
+INSERT INTO items VALUES (2814, 0, 4.50, 'item2814');
+INSERT INTO items VALUES (2815, 1, 4.75, 'item2815');
+INSERT INTO items VALUES (2816, 2, 5.00, 'item2816');
+INSERT INTO items VALUES (2817, 0, 5.25, 'item2817');
+INSERT INTO items VALUES (2818, 1, 5.50, 'item2818');
+INSERT INTO items VALUES (2819, 2, 5.75, 'item2819');
+INSERT INTO items VALUES (2820, 0, 6.00, 'item2820');
+INSERT INTO items VALUES (2821, 1, 6.25, 'item2821');
+INSERT INTO items VALUES (2822, 2, 6.50, 'item2822');
+INSERT INTO items VALUES (2823, 0, 6.75, 'item2823');
+INSERT INTO items VALUES (2824, 1, 7.00, 'item2824');
+INSERT INTO items VALUES (2825, 2, 7.25, 'item2825');
+INSERT INTO items VALUES (2826, 0, 7.50, 'item2826');
+INSERT INTO items VALUES (2827, 1, 7.75, 'item2827');
+INSERT INTO items VALUES (2828, 2, 8.00, 'item2828');
+INSERT INTO items VALUES (2829, 0, 8.25, 'item2829');
+INSERT INTO items VALUES (2830, 1, 8.50, 'item2830');
+INSERT INTO items VALUES (2831, 2, 8.75, 'item2831');
+INSERT INTO items VALUES (2832, 0, 9.00, 'item2832');
+INSERT INTO items VALUES (2833, 1, 9.25, 'item2833');
+INSERT INTO items VALUES (2834, 2, 9.50, 'item2834');
+INSERT INTO items VALUES (2835, 0, 9.75, 'item2835');
+INSERT INTO items VALUES (2836, 1, 10.00, 'item2836');
+INSERT INTO items VALUES (2837, 2, 10.25, 'item2837');
+INSERT INTO items VALUES (2838, 0, 10.50, 'item2838');
+INSERT INTO items VALUES (2839, 1, 10.75, 'item2839');
+INSERT INTO items VALUES (2840, 2, 11.00, 'item2840');
+INSERT INTO items VALUES (2841, 0, 11.25, 'item2841');
+INSERT INTO items VALUES (2842, 1, 11.50, 'item2842');
+INSERT INTO items VALUES (2843, 2, 11.75, 'item2843');
+INSERT INTO items VALUES (2844, 0, 12.00, 'item2844');
+INSERT INTO items VALUES (2845, 1, 12.25, 'item2845');
+INSERT INTO items VALUES (2846, 2, 12.50, 'item2846');
+INSERT INTO items VALUES (2847, 0, 12.75, 'item2847');
+INSERT INTO items VALUES (2848, 1, 13.00, 'item2848');
+INSERT INTO items VALUES (2849, 2, 13.25, 'item2849');
+INSERT INTO items VALUES (2850, 0, 1.00, 'item2850');
+INSERT INTO items VALUES (2851, 1, 1.25, 'item2851');
+INSERT INTO items VALUES (2852, 2, 1.50, 'item2852');
+INSERT INTO items VALUES (2853, 0, 1.75, 'item2853');
+INSERT INTO items VALUES (2854, 1, 2.00, 'item2854');
+INSERT INTO items VALUES (2855, 2, 2.25, 'item2855');
+INSERT INTO items VALUES (2856, 0, 2.50, 'item2856');
+INSERT INTO items VALUES (2857, 1, 2.75, 'item2857');
+INSERT INTO items VALUES (2858, 2, 3.00, 'item2858');
+INSERT INTO items VALUES (2859, 0, 3.25, 'item2859');
+INSERT INTO items VALUES (2860, 1, 3.50, 'item2860');
+INSERT INTO items VALUES (2861, 2, 3.75, 'item2861');
+INSERT INTO items VALUES (2862, 0, 4.00, 'item2862');
+INSERT INTO items VALUES (2863, 1, 4.25, 'item2863');
+INSERT INTO items VALUES (2864, 2, 4.50, 'item2864');
+INSERT INTO items VALUES (2865, 0, 4.75, 'item2865');
+INSERT INTO items VALUES (2866, 1, 5.00, 'item2866');
+INSERT INTO items VALUES (2867, 2, 5.25, 'item2867');
+INSERT INTO items VALUES (2868, 0, 5.50, 'item2868');
+INSERT INTO items VALUES (2869, 1, 5.75, 'item2869');
+INSERT INTO items VALUES (2870, 2, 6.00, 'item2870');
+INSERT INTO items VALUES (2871, 0, 6.25, 'item2871');
+INSERT INTO items VALUES (2872, 1, 6.50, 'item2872');
+INSERT INTO items VALUES (2873, 2, 6.75, 'item2873');
+INSERT INTO items VALUES (2874, 0, 7.00, 'item2874');
+INSERT INTO items VALUES (2875, 1, 7.25, 'item2875');
+INSERT INTO items VALUES (2876, 2, 7.50, 'item2876');
+INSERT INTO items VALUES (2877, 0, 7.75, 'item2877');
+INSERT INTO items VALUES (2878, 1, 8.00, 'item2878');
+INSERT INTO items VALUES (2879, 2, 8.25, 'item2879');
+INSERT INTO items VALUES (2880, 0, 8.50, 'item2880');
+INSERT INTO items VALUES (2881, 1, 8.75, 'item2881');
+INSERT INTO items VALUES (2882, 2, 9.00, 'item2882');
+INSERT INTO items VALUES (2883, 0, 9.25, 'item2883');
+INSERT INTO items VALUES (2884, 1, 9.50, 'item2884');
+INSERT INTO items VALUES (2885, 2, 9.75, 'item2885');
+INSERT INTO items VALUES (2886, 0, 10.00, 'item2886');
+INSERT INTO items VALUES (2887, 1, 10.25, 'item2887');
+INSERT INTO items VALUES (2888, 2, 10.50, 'item2888');
+INSERT INTO items VALUES (2889, 0, 10.75, 'item2889');
+INSERT INTO items VALUES (2890, 1, 11.00, 'item2890');
+INSERT INTO items VALUES (2891, 2, 11.25, 'item2891');
+INSERT INTO items VALUES (2892, 0, 11.50, 'item2892');
+INSERT INTO items VALUES (2893, 1, 11.75, 'item2893');
+INSERT INTO items VALUES (2894, 2, 12.00, 'item2894');
+INSERT INTO items VALUES (2895, 0, 12.25, 'item2895');
+INSERT INTO items VALUES (2896, 1, 12.50, 'item2896');
+INSERT INTO items VALUES (2897, 2, 12.75, 'item2897');
+INSERT INTO items VALUES (2898, 0, 13.00, 'item2898');
+INSERT INTO items VALUES (2899, 1, 13.25, 'item2899');
+INSERT INTO items VALUES (2900, 2, 1.00, 'item2900');
+INSERT INTO items VALUES (2901, 0, 1.25, 'item2901');
+INSERT INTO items VALUES (2902, 1, 1.50, 'item2902');
+INSERT INTO items VALUES (2903, 2, 1.75, 'item2903');
+INSERT INTO items VALUES (2904, 0, 2.00, 'item2904');
+INSERT INTO items VALUES (2905, 1, 2.25, 'item2905');
+INSERT INTO items VALUES (2906, 2, 2.50, 'item2906');
+INSERT INTO items VALUES (2907, 0, 2.75, 'item2907');
+INSERT INTO items VALUES (2908, 1, 3.00, 'item2908');
+INSERT INTO items VALUES (2909, 2, 3.25, 'item2909');
+INSERT INTO items VALUES (2910, 0, 3.50, 'item2910');
+INSERT INTO items VALUES (2911, 1, 3.75, 'item2911');
+INSERT INTO items VALUES (2912, 2, 4.00, 'item2912');
+INSERT INTO items VALUES (2913, 0, 4.25, 'item2913');
+INSERT INTO items VALUES (2914, 1, 4.50, 'item2914');
+INSERT INTO items VALUES (2915, 2, 4.75, 'item2915');
+INSERT INTO items VALUES (2916, 0, 5.00, 'item2916');
+INSERT INTO items VALUES (2917, 1, 5.25, 'item2917');
+INSERT INTO items VALUES (2918, 2, 5.50, 'item2918');
+INSERT INTO items VALUES (2919, 0, 5.75, 'item2919');
+INSERT INTO items VALUES (2920, 1, 6.00, 'item2920');
+INSERT INTO items VALUES (2921, 2, 6.25, 'item2921');
+INSERT INTO items VALUES (2922, 0, 6.50, 'item2922');
+INSERT INTO items VALUES (2923, 1, 6.75, 'item2923');
+INSERT INTO items VALUES (2924, 2, 7.00, 'item2924');
+INSERT INTO items VALUES (2925, 0, 7.25, 'item2925');
+INSERT INTO items VALUES (2926, 1, 7.50, 'item2926');
+INSERT INTO items VALUES (2927, 2, 7.75, 'item2927');
+INSERT INTO items VALUES (2928, 0, 8.00, 'item2928');
+INSERT INTO items VALUES (2929, 1, 8.25, 'item2929');
+INSERT INTO items VALUES (2930, 2, 8.50, 'item2930');
+INSERT INTO items VALUES (2931, 0, 8.75, 'item2931');
+INSERT INTO items VALUES (2932, 1, 9.00, 'item2932');
+INSERT INTO items VALUES (2933, 2, 9.25, 'item2933');
+INSERT INTO items VALUES (2934, 0, 9.50, 'item2934');
+INSERT INTO items VALUES (2935, 1, 9.75, 'item2935');
+INSERT INTO items VALUES (2936, 2, 10.00, 'item2936');
+INSERT INTO items VALUES (2937, 0, 10.25, 'item2937');
+INSERT INTO items VALUES (2938, 1, 10.50, 'item2938');
+INSERT INTO items VALUES (2939, 2, 10.75, 'item2939');
+INSERT INTO items VALUES (2940, 0, 11.00, 'item2940');
+INSERT INTO items VALUES (2941, 1, 11.25, 'item2941');
+INSERT INTO items VALUES (2942, 2, 11.50, 'item2942');
+INSERT INTO items VALUES (2943, 0, 11.75, 'item2943');
+INSERT INTO items VALUES (2944, 1, 12.00, 'item2944');
+INSERT INTO items VALUES (2945, 2, 12.25, 'item2945');
+INSERT INTO items VALUES (2946, 0, 12.50, 'item2946');
+INSERT INTO items VALUES (2947, 1, 12.75, 'item2947');
+INSERT INTO items VALUES (2948, 2, 13.00, 'item2948');
+INSERT INTO items VALUES (2949, 0, 13.25, 'item2949');
+INSERT INTO items VALUES (2950, 1, 1.00, 'item2950');
+INSERT INTO items VALUES (2951, 2, 1.25, 'item2951');
+INSERT INTO items VALUES (2952, 0, 1.50, 'item2952');
+INSERT INTO items VALUES (2953, 1, 1.75, 'item2953');
+INSERT INTO items VALUES (2954, 2, 2.00, 'item2954');
+INSERT INTO items VALUES (2955, 0, 2.25, 'item2955');
+INSERT INTO items VALUES (2956, 1, 2.50, 'item2956');
+INSERT INTO items VALUES (2957, 2, 2.75, 'item2957');
+INSERT INTO items VALUES (2958, 0, 3.00, 'item2958');
+INSERT INTO items VALUES (2959, 1, 3.25, 'item2959');
+INSERT INTO items VALUES (2960, 2, 3.50, 'item2960');
+INSERT INTO items VALUES (2961, 0, 3.75, 'item2961');
+INSERT INTO items VALUES (2962, 1, 4.00, 'item2962');
+INSERT INTO items VALUES (2963, 2, 4.25, 'item2963');
+INSERT INTO items VALUES (2964, 0, 4.50, 'item2964');
+INSERT INTO items VALUES (2965, 1, 4.75, 'item2965');
+INSERT INTO items VALUES (2966, 2, 5.00, 'item2966');
+INSERT INTO items VALUES (2967, 0, 5.25, 'item2967');
+INSERT INTO items VALUES (2968, 1, 5.50, 'item2968');
+INSERT INTO items VALUES (2969, 2, 5.75, 'item2969');
+INSERT INTO items VALUES (2970, 0, 6.00, 'item2970');
+INSERT INTO items VALUES (2971, 1, 6.25, 'item2971');
+INSERT INTO items VALUES (2972, 2, 6.50, 'item2972');
+INSERT INTO items VALUES (2973, 0, 6.75, 'item2973');
+INSERT INTO items VALUES (2974, 1, 7.00, 'item2974');
+INSERT INTO items VALUES (2975, 2, 7.25, 'item2975');
+INSERT INTO items VALUES (2976, 0, 7.50, 'item2976');
+INSERT INTO items VALUES (2977, 1, 7.75, 'item2977');
+INSERT INTO items VALUES (2978, 2, 8.00, 'item2978');
+INSERT INTO items VALUES (2979, 0, 8.25, 'item2979');
+INSERT INTO items VALUES (2980, 1, 8.50, 'item2980');
+INSERT INTO items VALUES (2981, 2, 8.75, 'item2981');
+INSERT INTO items VALUES (2982, 0, 9.00, 'item2982');
+INSERT INTO items VALUES (2983, 1, 9.25, 'item2983');
+INSERT INTO items VALUES (2984, 2, 9.50, 'item2984');
+INSERT INTO items VALUES (2985, 0, 9.75, 'item2985');
+INSERT INTO items VALUES (2986, 1, 10.00, 'item2986');
+INSERT INTO items VALUES (2987, 2, 10.25, 'item2987');
+INSERT INTO items VALUES (2988, 0, 10.50, 'item2988');
+INSERT INTO items VALUES (2989, 1, 10.75, 'item2989');
+INSERT INTO items VALUES (2990, 2, 11.00, 'item2990');
+INSERT INTO items VALUES (2991, 0, 11.25, 'item2991');
+INSERT INTO items VALUES (2992, 1, 11.50, 'item2992');
+INSERT INTO items VALUES (2993, 2, 11.75, 'item2993');
+INSERT INTO items VALUES (2994, 0, 12.00, 'item2994');
+INSERT INTO items VALUES (2995, 1, 12.25, 'item2995');
+INSERT INTO items VALUES (2996, 2, 12.50, 'item2996');
+INSERT INTO items VALUES (2997, 0, 12.75, 'item2997');
+INSERT INTO items VALUES (2998, 1, 13.00, 'item2998');
+INSERT INTO items VALUES (2999, 2, 13.25, 'item2999');
+INSERT INTO items VALUES (3000, 0, 1.00, 'item3000');
+INSERT INTO items VALUES (3001, 1, 1.25, 'item3001');
+INSERT INTO items VALUES (3002, 2, 1.50, 'item3002');
+INSERT INTO items VALUES (3003, 0, 1.75, 'item3003');
+INSERT INTO items VALUES (3004, 1, 2.00, 'item3004');
+INSERT INTO items VALUES (3005, 2, 2.25, 'item3005');
+INSERT INTO items VALUES (3006, 0, 2.50, 'item3006');
+INSERT INTO items VALUES (3007, 1, 2.75, 'item3007');
+INSERT INTO items VALUES (3008, 2, 3.00, 'item3008');
+INSERT INTO items VALUES (3009, 0, 3.25, 'item3009');
+INSERT INTO items VALUES (3010, 1, 3.50, 'item3010');
+INSERT INTO items VALUES (3011, 2, 3.75, 'item3011');
+INSERT INTO items VALUES (3012, 0, 4.00, 'item3012');
+INSERT INTO items VALUES (3013, 1, 4.25, 'item3013');
+INSERT INTO items VALUES (3014, 2, 4.50, 'item3014');
+INSERT INTO items VALUES (3015, 0, 4.75, 'item3015');
+INSERT INTO items VALUES (3016, 1, 5.00, 'item3016');
+INSERT INTO items VALUES (3017, 2, 5.25, 'item3017');
+INSERT INTO items VALUES (3018, 0, 5.50, 'item3018');
+INSERT INTO items VALUES (3019, 1, 5.75, 'item3019');
+INSERT INTO items VALUES (3020, 2, 6.00, 'item3020');
+INSERT INTO items VALUES (3021, 0, 6.25, 'item3021');
+INSERT INTO items VALUES (3022, 1, 6.50, 'item3022');
+INSERT INTO items VALUES (3023, 2, 6.75, 'item3023');
+INSERT INTO items VALUES (3024, 0, 7.00, 'item3024');
+INSERT INTO items VALUES (3025, 1, 7.25, 'item3025');
+INSERT INTO items VALUES (3026, 2, 7.50, 'item3026');
+INSERT INTO items VALUES (3027, 0, 7.75, 'item3027');
+INSERT INTO items VALUES (3028, 1, 8.00, 'item3028');
+INSERT INTO items VALUES (3029, 2, 8.25, 'item3029');
+INSERT INTO items VALUES (3030, 0, 8.50, 'item3030');
+INSERT INTO items VALUES (3031, 1, 8.75, 'item3031');
+INSERT INTO items VALUES (3032, 2, 9.00, 'item3032');
+INSERT INTO items VALUES (3033, 0, 9.25, 'item3033');
+INSERT INTO items VALUES (3034, 1, 9.50, 'item3034');
+INSERT INTO items VALUES (3035, 2, 9.75, 'item3035');
+INSERT INTO items VALUES (3036, 0, 10.00, 'item3036');
+INSERT INTO items VALUES (3037, 1, 10.25, 'item3037');
+INSERT INTO items VALUES (3038, 2, 10.50, 'item3038');
+INSERT INTO items VALUES (3039, 0, 10.75, 'item3039');
+INSERT INTO items VALUES (3040, 1, 11.00, 'item3040');
+INSERT INTO items VALUES (3041, 2, 11.25, 'item3041');
+INSERT INTO items VALUES (3042, 0, 11.50, 'item3042');
+INSERT INTO items VALUES (3043, 1, 11.75, 'item3043');
+INSERT INTO items VALUES (3044, 2, 12.00, 'item3044');
+INSERT INTO items VALUES (3045, 0, 12.25, 'item3045');
+INSERT INTO items VALUES (3046, 1, 12.50, 'item3046');
+INSERT INTO items VALUES (3047, 2, 12.75, 'item3047');
+INSERT INTO items VALUES (3048, 0, 13.00, 'item3048');
+INSERT INTO items VALUES (3049, 1, 13.25, 'item3049');
+INSERT INTO items VALUES (3050, 2, 1.00, 'item3050');
+INSERT INTO items VALUES (3051, 0, 1.25, 'item3051');
+INSERT INTO items VALUES (3052, 1, 1.50, 'item3052');
+INSERT INTO items VALUES (3053, 2, 1.75, 'item3053');
+INSERT INTO items VALUES (3054, 0, 2.00, 'item3054');
+INSERT INTO items VALUES (3055, 1, 2.25, 'item3055');
+INSERT INTO items VALUES (3056, 2, 2.50, 'item3056');
+INSERT INTO items VALUES (3057, 0, 2.75, 'item3057');
+INSERT INTO items VALUES (3058, 1, 3.00, 'item3058');
+INSERT INTO items VALUES (3059, 2, 3.25, 'item3059');
+INSERT INTO items VALUES (3060, 0, 3.50, 'item3060');
+INSERT INTO items VALUES (3061, 1, 3.75, 'item3061');
+INSERT INTO items VALUES (3062, 2, 4.00, 'item3062');
+INSERT INTO items VALUES (3063, 0, 4.25, 'item3063');
+INSERT INTO items VALUES (3064, 1, 4.50, 'item3064');
+INSERT INTO items VALUES (3065, 2, 4.75, 'item3065');
+INSERT INTO items VALUES (3066, 0, 5.00, 'item3066');
+INSERT INTO items VALUES (3067, 1, 5.25, 'item3067');
+INSERT INTO items VALUES (3068, 2, 5.50, 'item3068');
+INSERT INTO items VALUES (3069, 0, 5.75, 'item3069');
+INSERT INTO items VALUES (3070, 1, 6.00, 'item3070');
+INSERT INTO items VALUES (3071, 2, 6.25, 'item3071');
+INSERT INTO items VALUES (3072, 0, 6.50, 'item3072');
+INSERT INTO items VALUES (3073, 1, 6.75, 'item3073');
+INSERT INTO items VALUES (3074, 2, 7.00, 'item3074');
+INSERT INTO items VALUES (3075, 0, 7.25, 'item3075');
+INSERT INTO items VALUES (3076, 1, 7.50, 'item3076');
+INSERT INTO items VALUES (3077, 2, 7.75, 'item3077');
+INSERT INTO items VALUES (3078, 0, 8.00, 'item3078');
+INSERT INTO items VALUES (3079, 1, 8.25, 'item3079');
+INSERT INTO items VALUES (3080, 2, 8.50, 'item3080');
+INSERT INTO items VALUES (3081, 0, 8.75, 'item3081');
+INSERT INTO items VALUES (3082, 1, 9.00, 'item3082');
+INSERT INTO items VALUES (3083, 2, 9.25, 'item3083');
+INSERT INTO items VALUES (3084, 0, 9.50, 'item3084');
+INSERT INTO items VALUES (3085, 1, 9.75, 'item3085');
+INSERT INTO items VALUES (3086, 2, 10.00, 'item3086');
+INSERT INTO items VALUES (3087, 0, 10.25, 'item3087');
+INSERT INTO items VALUES (3088, 1, 10.50, 'item3088');
+INSERT INTO items VALUES (3089, 2, 10.75, 'item3089');
+INSERT INTO items VALUES (3090, 0, 11.00, 'item3090');
+INSERT INTO items VALUES (3091, 1, 11.25, 'item3091');
+INSERT INTO items VALUES (3092, 2, 11.50, 'item3092');
+INSERT INTO items VALUES (3093, 0, 11.75, 'item3093');
+INSERT INTO items VALUES (3094, 1, 12.00, 'item3094');
+INSERT INTO items VALUES (3095, 2, 12.25, 'item3095');
+INSERT INTO items VALUES (3096, 0, 12.50, 'item3096');
+INSERT INTO items VALUES (3097, 1, 12.75, 'item3097');
+INSERT INTO items VALUES (3098, 2, 13.00, 'item3098');
+INSERT INTO items VALUES (3099, 0, 13.25, 'item3099');
+INSERT INTO items VALUES (3100, 1, 1.00, 'item3100');
+INSERT INTO items VALUES (3101, 2, 1.25, 'item3101');
+INSERT INTO items VALUES (3102, 0, 1.50, 'item3102');
+INSERT INTO items VALUES (3103, 1, 1.75, 'item3103');
+INSERT INTO items VALUES (3104, 2, 2.00, 'item3104');
+INSERT INTO items VALUES (3105, 0, 2.25, 'item3105');
+INSERT INTO items VALUES (3106, 1, 2.50, 'item3106');
+INSERT INTO items VALUES (3107, 2, 2.75, 'item3107');
+INSERT INTO items VALUES (3108, 0, 3.00, 'item3108');
+INSERT INTO items VALUES (3109, 1, 3.25, 'item3109');
+INSERT INTO items VALUES (3110, 2, 3.50, 'item3110');
+INSERT INTO items VALUES (3111, 0, 3.75, 'item3111');
+INSERT INTO items VALUES (3112, 1, 4.00, 'item3112');
+INSERT INTO items VALUES (3113, 2, 4.25, 'item3113');
+INSERT INTO items VALUES (3114, 0, 4.50, 'item3114');
+INSERT INTO items VALUES (3115, 1, 4.75, 'item3115');
+INSERT INTO items VALUES (3116, 2, 5.00, 'item3116');
+INSERT INTO items VALUES (3117, 0, 5.25, 'item3117');
+INSERT INTO items VALUES (3118, 1, 5.50, 'item3118');
+INSERT INTO items VALUES (3119, 2, 5.75, 'item3119');
+INSERT INTO items VALUES (3120, 0, 6.00, 'item3120');
+INSERT INTO items VALUES (3121, 1, 6.25, 'item3121');
+INSERT INTO items VALUES (3122, 2, 6.50, 'item3122');
+INSERT INTO items VALUES (3123, 0, 6.75, 'item3123');
+INSERT INTO items VALUES (3124, 1, 7.00, 'item3124');
+INSERT INTO items VALUES (3125, 2, 7.25, 'item3125');
+INSERT INTO items VALUES (3126, 0, 7.50, 'item3126');
+INSERT INTO items VALUES (3127, 1, 7.75, 'item3127');
+INSERT INTO items VALUES (3128, 2, 8.00, 'item3128');
+INSERT INTO items VALUES (3129, 0, 8.25, 'item3129');
+INSERT INTO items VALUES (3130, 1, 8.50, 'item3130');
+INSERT INTO items VALUES (3131, 2, 8.75, 'item3131');
+INSERT INTO items VALUES (3132, 0, 9.00, 'item3132');
+INSERT INTO items VALUES (3133, 1, 9.25, 'item3133');
+INSERT INTO items VALUES (3134, 2, 9.50, 'item3134');
+INSERT INTO items VALUES (3135, 0, 9.75, 'item3135');
+INSERT INTO items VALUES (3136, 1, 10.00, 'item3136');
+INSERT INTO items VALUES (3137, 2, 10.25, 'item3137');
+INSERT INTO items VALUES (3138, 0, 10.50, 'item3138');
+INSERT INTO items VALUES (3139, 1, 10.75, 'item3139');
+INSERT INTO items VALUES (3140, 2, 11.00, 'item3140');
+INSERT INTO items VALUES (3141, 0, 11.25, 'item3141');
+INSERT INTO items VALUES (3142, 1, 11.50, 'item3142');
+INSERT INTO items VALUES (3143, 2, 11.75, 'item3143');
+INSERT INTO items VALUES (3144, 0, 12.00, 'item3144');
+INSERT INTO items VALUES (3145, 1, 12.25, 'item3145');
+INSERT INTO items VALUES (3146, 2, 12.50, 'item3146');
+INSERT INTO items VALUES (3147, 0, 12.75, 'item3147');
+INSERT INTO items VALUES (3148, 1, 13.00, 'item3148');
+INSERT INTO items VALUES (3149, 2, 13.25, 'item3149');
+INSERT INTO items VALUES (3150, 0, 1.00, 'item3150');
+INSERT INTO items VALUES (3151, 1, 1.25, 'item3151');
+INSERT INTO items VALUES (3152, 2, 1.50, 'item3152');
+INSERT INTO items VALUES (3153, 0, 1.75, 'item3153');
+INSERT INTO items VALUES (3154, 1, 2.00, 'item3154');
+INSERT INTO items VALUES (3155, 2, 2.25, 'item3155');
+INSERT INTO items VALUES (3156, 0, 2.50, 'item3156');
+INSERT INTO items VALUES (3157, 1, 2.75, 'item3157');
+INSERT INTO items VALUES (3158, 2, 3.00, 'item3158');
+INSERT INTO items VALUES (3159, 0, 3.25, 'item3159');
+INSERT INTO items VALUES (3160, 1, 3.50, 'item3160');
+INSERT INTO items VALUES (3161, 2, 3.75, 'item3161');
+INSERT INTO items VALUES (3162, 0, 4.00, 'item3162');
+INSERT INTO items VALUES (3163, 1, 4.25, 'item3163');
+INSERT INTO items VALUES (3164, 2, 4.50, 'item3164');
+INSERT INTO items VALUES (3165, 0, 4.75, 'item3165');
+INSERT INTO items VALUES (3166, 1, 5.00, 'item3166');
+INSERT INTO items VALUES (3167, 2, 5.25, 'item3167');
+INSERT INTO items VALUES (3168, 0, 5.50, 'item3168');
+INSERT INTO items VALUES (3169, 1, 5.75, 'item3169');
+INSERT INTO items VALUES (3170, 2, 6.00, 'item3170');
+INSERT INTO items VALUES (3171, 0, 6.25, 'item3171');
+INSERT INTO items VALUES (3172, 1, 6.50, 'item3172');
+INSERT INTO items VALUES (3173, 2, 6.75, 'item3173');
+INSERT INTO items VALUES (3174, 0, 7.00, 'item3174');
+INSERT INTO items VALUES (3175, 1, 7.25, 'item3175');
+INSERT INTO items VALUES (3176, 2, 7.50, 'item3176');
+INSERT INTO items VALUES (3177, 0, 7.75, 'item3177');
+INSERT INTO items VALUES (3178, 1, 8.00, 'item3178');
+INSERT INTO items VALUES (3179, 2, 8.25, 'item3179');
+INSERT INTO items VALUES (3180, 0, 8.50, 'item3180');
+INSERT INTO items VALUES (3181, 1, 8.75, 'item3181');
+INSERT INTO items VALUES (3182, 2, 9.00, 'item3182');
+INSERT INTO items VALUES (3183, 0, 9.25, 'item3183');
+INSERT INTO items VALUES (3184, 1, 9.50, 'item3184');
+INSERT INTO items VALUES (3185, 2, 9.75, 'item3185');
+INSERT INTO items VALUES (3186, 0, 10.00, 'item3186');
+INSERT INTO items VALUES (3187, 1, 10.25, 'item3187');
+INSERT INTO items VALUES (3188, 2, 10.50, 'item3188');
+INSERT INTO items VALUES (3189, 0, 10.75, 'item3189');
+INSERT INTO items VALUES (3190, 1, 11.00, 'item3190');
+INSERT INTO items VALUES (3191, 2, 11.25, 'item3191');
+INSERT INTO items VALUES (3192, 0, 11.50, 'item3192');
+INSERT INTO items VALUES (3193, 1, 11.75, 'item3193');
+INSERT INTO items VALUES (3194, 2, 12.00, 'item3194');
+INSERT INTO items VALUES (3195, 0, 12.25, 'item3195');
+INSERT INTO items VALUES (3196, 1, 12.50, 'item3196');
+INSERT INTO items VALUES (3197, 2, 12.75, 'item3197');
+INSERT INTO items VALUES (3198, 0, 13.00, 'item3198');
+INSERT INTO items VALUES (3199, 1, 13.25, 'item3199');
+INSERT INTO items VALUES (3200, 2, 1.00, 'item3200');
+INSERT INTO items VALUES (3201, 0, 1.25, 'item3201');
+INSERT INTO items VALUES (3202, 1, 1.50, 'item3202');
+INSERT INTO items VALUES (3203, 2, 1.75, 'item3203');
+INSERT INTO items VALUES (3204, 0, 2.00, 'item3204');
+INSERT INTO items VALUES (3205, 1, 2.25, 'item3205');
+INSERT INTO items VALUES (3206, 2, 2.50, 'item3206');
+INSERT INTO items VALUES (3207, 0, 2.75, 'item3207');
+INSERT INTO items VALUES (3208, 1, 3.00, 'item3208');
+INSERT INTO items VALUES (3209, 2, 3.25, 'item3209');
+INSERT INTO items VALUES (3210, 0, 3.50, 'item3210');
+INSERT INTO items VALUES (3211, 1, 3.75, 'item3211');
+INSERT INTO items VALUES (3212, 2, 4.00, 'item3212');
+INSERT INTO items VALUES (3213, 0, 4.25, 'item3213');
+INSERT INTO items VALUES (3214, 1, 4.50, 'item3214');
+INSERT INTO items VALUES (3215, 2, 4.75, 'item3215');
+INSERT INTO items VALUES (3216, 0, 5.00, 'item3216');
+INSERT INTO items VALUES (3217, 1, 5.25, 'item3217');
+INSERT INTO items VALUES (3218, 2, 5.50, 'item3218');
+INSERT INTO items VALUES (3219, 0, 5.75, 'item3219');
+INSERT INTO items VALUES (3220, 1, 6.00, 'item3220');
+INSERT INTO items VALUES (3221, 2, 6.25, 'item3221');
+INSERT INTO items VALUES (3222, 0, 6.50, 'item3222');
+INSERT INTO items VALUES (3223, 1, 6.75, 'item3223');
+INSERT INTO items VALUES (3224, 2, 7.00, 'item3224');
+INSERT INTO items VALUES (3225, 0, 7.25, 'item3225');
+INSERT INTO items VALUES (3226, 1, 7.50, 'item3226');
+INSERT INTO items VALUES (3227, 2, 7.75, 'item3227');
+INSERT INTO items VALUES (3228, 0, 8.00, 'item3228');
+INSERT INTO items VALUES (3229, 1, 8.25, 'item3229');
+INSERT INTO items VALUES (3230, 2, 8.50, 'item3230');
+INSERT INTO items VALUES (3231, 0, 8.75, 'item3231');
+INSERT INTO items VALUES (3232, 1, 9.00, 'item3232');
+INSERT INTO items VALUES (3233, 2, 9.25, 'item3233');
+INSERT INTO items VALUES (3234, 0, 9.50, 'item3234');
+INSERT INTO items VALUES (3235, 1, 9.75, 'item3235');
+INSERT INTO items VALUES (3236, 2, 10.00, 'item3236');
+INSERT INTO items VALUES (3237, 0, 10.25, 'item3237');
+INSERT INTO items VALUES (3238, 1, 10.50, 'item3238');
+INSERT INTO items VALUES (3239, 2, 10.75, 'item3239');
+INSERT INTO items VALUES (3240, 0, 11.00, 'item3240');
+INSERT INTO items VALUES (3241, 1, 11.25, 'item3241');
+INSERT INTO items VALUES (3242, 2, 11.50, 'item3242');
+INSERT INTO items VALUES (3243, 0, 11.75, 'item3243');
+INSERT INTO items VALUES (3244, 1, 12.00, 'item3244');
+INSERT INTO items VALUES (3245, 2, 12.25, 'item3245');
+INSERT INTO items VALUES (3246, 0, 12.50, 'item3246');
+INSERT INTO items VALUES (3247, 1, 12.75, 'item3247');
+INSERT INTO items VALUES (3248, 2, 13.00, 'item3248');
+INSERT INTO items VALUES (3249, 0, 13.25, 'item3249');
+INSERT INTO items VALUES (3250, 1, 1.00, 'item3250');
+INSERT INTO items VALUES (3251, 2, 1.25, 'item3251');
+INSERT INTO items VALUES (3252, 0, 1.50, 'item3252');
+INSERT INTO items VALUES (3253, 1, 1.75, 'item3253');
+INSERT INTO items VALUES (3254, 2, 2.00, 'item3254');
+INSERT INTO items VALUES (3255, 0, 2.25, 'item3255');
+INSERT INTO items VALUES (3256, 1, 2.50, 'item3256');
+INSERT INTO items VALUES (3257, 2, 2.75, 'item3257');
+INSERT INTO items VALUES (3258, 0, 3.00, 'item3258');
+INSERT INTO items VALUES (3259, 1, 3.25, 'item3259');
+INSERT INTO items VALUES (3260, 2, 3.50, 'item3260');
+INSERT INTO items VALUES (3261, 0, 3.75, 'item3261');
+INSERT INTO items VALUES (3262, 1, 4.00, 'item3262');
+INSERT INTO items VALUES (3263, 2, 4.25, 'item3263');
+INSERT INTO items VALUES (3264, 0, 4.50, 'item3264');
+INSERT INTO items VALUES (3265, 1, 4.75, 'item3265');
+INSERT INTO items VALUES (3266, 2, 5.00, 'item3266');
+INSERT INTO items VALUES (3267, 0, 5.25, 'item3267');
+INSERT INTO items VALUES (3268, 1, 5.50, 'item3268');
+INSERT INTO items VALUES (3269, 2, 5.75, 'item3269');
+INSERT INTO items VALUES (3270, 0, 6.00, 'item3270');
+INSERT INTO items VALUES (3271, 1, 6.25, 'item3271');
+INSERT INTO items VALUES (3272, 2, 6.50, 'item3272');
+INSERT INTO items VALUES (3273, 0, 6.75, 'item3273');
+INSERT INTO items VALUES (3274, 1, 7.00, 'item3274');
+INSERT INTO items VALUES (3275, 2, 7.25, 'item3275');
+INSERT INTO items VALUES (3276, 0, 7.50, 'item3276');
+INSERT INTO items VALUES (3277, 1, 7.75, 'item3277');
+INSERT INTO items VALUES (3278, 2, 8.00, 'item3278');
+INSERT INTO items VALUES (3279, 0, 8.25, 'item3279');
+INSERT INTO items VALUES (3280, 1, 8.50, 'item3280');
+INSERT INTO items VALUES (3281, 2, 8.75, 'item3281');
+INSERT INTO items VALUES (3282, 0, 9.00, 'item3282');
+INSERT INTO items VALUES (3283, 1, 9.25, 'item3283');
+INSERT INTO items VALUES (3284, 2, 9.50, 'item3284');
+INSERT INTO items VALUES (3285, 0, 9.75, 'item3285');
+INSERT INTO items VALUES (3286, 1, 10.00, 'item3286');
+INSERT INTO items VALUES (3287, 2, 10.25, 'item3287');
+INSERT INTO items VALUES (3288, 0, 10.50, 'item3288');
+INSERT INTO items VALUES (3289, 1, 10.75, 'item3289');
+INSERT INTO items VALUES (3290, 2, 11.00, 'item3290');
+INSERT INTO items VALUES (3291, 0, 11.25, 'item3291');
+INSERT INTO items VALUES (3292, 1, 11.50, 'item3292');
+INSERT INTO items VALUES (3293, 2, 11.75, 'item3293');
+INSERT INTO items VALUES (3294, 0, 12.00, 'item3294');
+INSERT INTO items VALUES (3295, 1, 12.25, 'item3295');
+INSERT INTO items VALUES (3296, 2, 12.50, 'item3296');
+INSERT INTO items VALUES (3297, 0, 12.75, 'item3297');
+INSERT INTO items VALUES (3298, 1, 13.00, 'item3298');
+INSERT INTO items VALUES (3299, 2, 13.25, 'item3299');
+INSERT INTO items VALUES (3300, 0, 1.00, 'item3300');
+INSERT INTO items VALUES (3301, 1, 1.25, 'item3301');
+INSERT INTO items VALUES (3302, 2, 1.50, 'item3302');
+INSERT INTO items VALUES (3303, 0, 1.75, 'item3303');
+INSERT INTO items VALUES (3304, 1, 2.00, 'item3304');
+INSERT INTO items VALUES (3305, 2, 2.25, 'item3305');
+INSERT INTO items VALUES (3306, 0, 2.50, 'item3306');
+INSERT INTO items VALUES (3307, 1, 2.75, 'item3307');
+INSERT INTO items VALUES (3308, 2, 3.00, 'item3308');
+INSERT INTO items VALUES (3309, 0, 3.25, 'item3309');
+INSERT INTO items VALUES (3310, 1, 3.50, 'item3310');
+INSERT INTO items VALUES (3311, 2, 3.75, 'item3311');
+INSERT INTO items VALUES (3312, 0, 4.00, 'item3312');
+INSERT INTO items VALUES (3313, 1, 4.25, 'item3313');
+INSERT INTO items VALUES (3314, 2, 4.50, 'item3314');
+INSERT INTO items VALUES (3315, 0, 4.75, 'item3315');
+INSERT INTO items VALUES (3316, 1, 5.00, 'item3316');
+INSERT INTO items VALUES (3317, 2, 5.25, 'item3317');
+INSERT INTO items VALUES (3318, 0, 5.50, 'item3318');
+INSERT INTO items VALUES (3319, 1, 5.75, 'item3319');
+INSERT INTO items VALUES (3320, 2, 6.00, 'item3320');
+INSERT INTO items VALUES (3321, 0, 6.25, 'item3321');
+INSERT INTO items VALUES (3322, 1, 6.50, 'item3322');
+INSERT INTO items VALUES (3323, 2, 6.75, 'item3323');
+INSERT INTO items VALUES (3324, 0, 7.00, 'item3324');
+INSERT INTO items VALUES (3325, 1, 7.25, 'item3325');
+INSERT INTO items VALUES (3326, 2, 7.50, 'item3326');
+INSERT INTO items VALUES (3327, 0, 7.75, 'item3327');
+INSERT INTO items VALUES (3328, 1, 8.00, 'item3328');
+INSERT INTO items VALUES (3329, 2, 8.25, 'item3329');
+INSERT INTO items VALUES (3330, 0, 8.50, 'item3330');
+INSERT INTO items VALUES (3331, 1, 8.75, 'item3331');
+INSERT INTO items VALUES (3332, 2, 9.00, 'item3332');
+INSERT INTO items VALUES (3333, 0, 9.25, 'item3333');
+INSERT INTO items VALUES (3334, 1, 9.50, 'item3334');
+INSERT INTO items VALUES (3335, 2, 9.75, 'item3335');
+INSERT INTO items VALUES (3336, 0, 10.00, 'item3336');
+INSERT INTO items VALUES (3337, 1, 10.25, 'item3337');
+INSERT INTO items VALUES (3338, 2, 10.50, 'item3338');
+INSERT INTO items VALUES (3339, 0, 10.75, 'item3339');
+INSERT INTO items VALUES (3340, 1, 11.00, 'item3340');
+INSERT INTO items VALUES (3341, 2, 11.25, 'item3341');
+INSERT INTO items VALUES (3342, 0, 11.50, 'item3342');
+INSERT INTO items VALUES (3343, 1, 11.75, 'item3343');
+INSERT INTO items VALUES (3344, 2, 12.00, 'item3344');
+INSERT INTO items VALUES (3345, 0, 12.25, 'item3345');
+INSERT INTO items VALUES (3346, 1, 12.50, 'item3346');
+INSERT INTO items VALUES (3347, 2, 12.75, 'item3347');
+INSERT INTO items VALUES (3348, 0, 13.00, 'item3348');
+INSERT INTO items VALUES (3349, 1, 13.25, 'item3349');
+INSERT INTO items VALUES (3350, 2, 1.00, 'item3350');
+INSERT INTO items VALUES (3351, 0, 1.25, 'item3351');
+INSERT INTO items VALUES (3352, 1, 1.50, 'item3352');
+INSERT INTO items VALUES (3353, 2, 1.75, 'item3353');
+INSERT INTO items VALUES (3354, 0, 2.00, 'item3354');
+INSERT INTO items VALUES (3355, 1, 2.25, 'item3355');
+INSERT INTO items VALUES (3356, 2, 2.50, 'item3356');
+INSERT INTO items VALUES (3357, 0, 2.75, 'item3357');
+INSERT INTO items VALUES (3358, 1, 3.00, 'item3358');
+INSERT INTO items VALUES (3359, 2, 3.25, 'item3359');
+INSERT INTO items VALUES (3360, 0, 3.50, 'item3360');
+INSERT INTO items VALUES (3361, 1, 3.75, 'item3361');
+INSERT INTO items VALUES (3362, 2, 4.00, 'item3362');
+INSERT INTO items VALUES (3363, 0, 4.25, 'item3363');
+INSERT INTO items VALUES (3364, 1, 4.50, 'item3364');
+INSERT INTO items VALUES (3365, 2, 4.75, 'item3365');
+INSERT INTO items VALUES (3366, 0, 5.00, 'item3366');
+INSERT INTO items VALUES (3367, 1, 5.25, 'item3367');
+INSERT INTO items VALUES (3368, 2, 5.50, 'item3368');
+INSERT INTO items VALUES (3369, 0, 5.75, 'item3369');
+INSERT INTO items VALUES (3370, 1, 6.00, 'item3370');
+INSERT INTO items VALUES (3371, 2, 6.25, 'item3371');
+INSERT INTO items VALUES (3372, 0, 6.50, 'item3372');
+INSERT INTO items VALUES (3373, 1, 6.75, 'item3373');
+INSERT INTO items VALUES (3374, 2, 7.00, 'item3374');
+INSERT INTO items VALUES (3375, 0, 7.25, 'item3375');
+INSERT INTO items VALUES (3376, 1, 7.50, 'item3376');
+INSERT INTO items VALUES (3377, 2, 7.75, 'item3377');
+INSERT INTO items VALUES (3378, 0, 8.00, 'item3378');
+INSERT INTO items VALUES (3379, 1, 8.25, 'item3379');
+INSERT INTO items VALUES (3380, 2, 8.50, 'item3380');
+INSERT INTO items VALUES (3381, 0, 8.75, 'item3381');
+INSERT INTO items VALUES (3382, 1, 9.00, 'item3382');
+INSERT INTO items VALUES (3383, 2, 9.25, 'item3383');
+INSERT INTO items VALUES (3384, 0, 9.50, 'item3384');
+INSERT INTO items VALUES (3385, 1, 9.75, 'item3385');
+INSERT INTO items VALUES (3386, 2, 10.00, 'item3386');
+INSERT INTO items VALUES (3387, 0, 10.25, 'item3387');
+INSERT INTO items VALUES (3388, 1, 10.50, 'item3388');
+INSERT INTO items VALUES (3389, 2, 10.75, 'item3389');
+INSERT INTO items VALUES (3390, 0, 11.00, 'item3390');
+INSERT INTO items VALUES (3391, 1, 11.25, 'item3391');
+INSERT INTO items VALUES (3392, 2, 11.50, 'item3392');
+INSERT INTO items VALUES (3393, 0, 11.75, 'item3393');
+INSERT INTO items VALUES (3394, 1, 12.00, 'item3394');
+INSERT INTO items VALUES (3395, 2, 12.25, 'item3395');
+INSERT INTO items VALUES (3396, 0, 12.50, 'item3396');
+INSERT INTO items VALUES (3397, 1, 12.75, 'item3397');
+INSERT INTO items VALUES (3398, 2, 13.00, 'item3398');
+INSERT INTO items VALUES (3399, 0, 13.25, 'item3399');
+INSERT INTO items VALUES (3400, 1, 1.00, 'item3400');
+INSERT INTO items VALUES (3401, 2, 1.25, 'item3401');
+INSERT INTO items VALUES (3402, 0, 1.50, 'item3402');
+INSERT INTO items VALUES (3403, 1, 1.75, 'item3403');
+INSERT INTO items VALUES (3404, 2, 2.00, 'item3404');
+INSERT INTO items VALUES (3405, 0, 2.25, 'item3405');
+INSERT INTO items VALUES (3406, 1, 2.50, 'item3406');
+INSERT INTO items VALUES (3407, 2, 2.75, 'item3407');
+INSERT INTO items VALUES (3408, 0, 3.00, 'item3408');
+INSERT INTO items VALUES (3409, 1, 3.25, 'item3409');
+INSERT INTO items VALUES (3410, 2, 3.50, 'item3410');
+INSERT INTO items VALUES (3411, 0, 3.75, 'item3411');
+INSERT INTO items VALUES (3412, 1, 4.00, 'item3412');
+INSERT INTO items VALUES (3413, 2, 4.25, 'item3413');
+INSERT INTO items VALUES (3414, 0, 4.50, 'item3414');
+INSERT INTO items VALUES (3415, 1, 4.75, 'item3415');
+INSERT INTO items VALUES (3416, 2, 5.00, 'item3416');
+INSERT INTO items VALUES (3417, 0, 5.25, 'item3417');
+INSERT INTO items VALUES (3418, 1, 5.50, 'item3418');
+INSERT INTO items VALUES (3419, 2, 5.75, 'item3419');
+INSERT INTO items VALUES (3420, 0, 6.00, 'item3420');
+INSERT INTO items VALUES (3421, 1, 6.25, 'item3421');
+INSERT INTO items VALUES (3422, 2, 6.50, 'item3422');
+INSERT INTO items VALUES (3423, 0, 6.75, 'item3423');
+INSERT INTO items VALUES (3424, 1, 7.00, 'item3424');
+INSERT INTO items VALUES (3425, 2, 7.25, 'item3425');
+INSERT INTO items VALUES (3426, 0, 7.50, 'item3426');
+INSERT INTO items VALUES (3427, 1, 7.75, 'item3427');
+INSERT INTO items VALUES (3428, 2, 8.00, 'item3428');
+INSERT INTO items VALUES (3429, 0, 8.25, 'item3429');
+INSERT INTO items VALUES (3430, 1, 8.50, 'item3430');
+INSERT INTO items VALUES (3431, 2, 8.75, 'item3431');
+INSERT INTO items VALUES (3432, 0, 9.00, 'item3432');
+INSERT INTO items VALUES (3433, 1, 9.25, 'item3433');
+INSERT INTO items VALUES (3434, 2, 9.50, 'item3434');
+INSERT INTO items VALUES (3435, 0, 9.75, 'item3435');
+INSERT INTO items VALUES (3436, 1, 10.00, 'item3436');
+INSERT INTO items VALUES (3437, 2, 10.25, 'item3437');
+INSERT INTO items VALUES (3438, 0, 10.50, 'item3438');
+INSERT INTO items VALUES (3439, 1, 10.75, 'item3439');
+INSERT INTO items VALUES (3440, 2, 11.00, 'item3440');
+INSERT INTO items VALUES (3441, 0, 11.25, 'item3441');
+INSERT INTO items VALUES (3442, 1, 11.50, 'item3442');
+INSERT INTO items VALUES (3443, 2, 11.75, 'item3443');
+INSERT INTO items VALUES (3444, 0, 12.00, 'item3444');
+INSERT INTO items VALUES (3445, 1, 12.25, 'item3445');
+INSERT INTO items VALUES (3446, 2, 12.50, 'item3446');
+INSERT INTO items VALUES (3447, 0, 12.75, 'item3447');
+INSERT INTO items VALUES (3448, 1, 13.00, 'item3448');
+INSERT INTO items VALUES (3449, 2, 13.25, 'item3449');
+INSERT INTO items VALUES (3450, 0, 1.00, 'item3450');
+INSERT INTO items VALUES (3451, 1, 1.25, 'item3451');
+INSERT INTO items VALUES (3452, 2, 1.50, 'item3452');
+INSERT INTO items VALUES (3453, 0, 1.75, 'item3453');
+INSERT INTO items VALUES (3454, 1, 2.00, 'item3454');
+INSERT INTO items VALUES (3455, 2, 2.25, 'item3455');
+INSERT INTO items VALUES (3456, 0, 2.50, 'item3456');
+INSERT INTO items VALUES (3457, 1, 2.75, 'item3457');
+INSERT INTO items VALUES (3458, 2, 3.00, 'item3458');
+INSERT INTO items VALUES (3459, 0, 3.25, 'item3459');
+INSERT INTO items VALUES (3460, 1, 3.50, 'item3460');
+INSERT INTO items VALUES (3461, 2, 3.75, 'item3461');
+INSERT INTO items VALUES (3462, 0, 4.00, 'item3462');
+INSERT INTO items VALUES (3463, 1, 4.25, 'item3463');
+INSERT INTO items VALUES (3464, 2, 4.50, 'item3464');
+INSERT INTO items VALUES (3465, 0, 4.75, 'item3465');
+INSERT INTO items VALUES (3466, 1, 5.00, 'item3466');
+INSERT INTO items VALUES (3467, 2, 5.25, 'item3467');
+INSERT INTO items VALUES (3468, 0, 5.50, 'item3468');
+INSERT INTO items VALUES (3469, 1, 5.75, 'item3469');
+INSERT INTO items VALUES (3470, 2, 6.00, 'item3470');
+INSERT INTO items VALUES (3471, 0, 6.25, 'item3471');
+INSERT INTO items VALUES (3472, 1, 6.50, 'item3472');
+INSERT INTO items VALUES (3473, 2, 6.75, 'item3473');
+INSERT INTO items VALUES (3474, 0, 7.00, 'item3474');
+INSERT INTO items VALUES (3475, 1, 7.25, 'item3475');
+INSERT INTO items VALUES (3476, 2, 7.50, 'item3476');
+INSERT INTO items VALUES (3477, 0, 7.75, 'item3477');
+INSERT INTO items VALUES (3478, 1, 8.00, 'item3478');
+INSERT INTO items VALUES (3479, 2, 8.25, 'item3479');
+INSERT INTO items VALUES (3480, 0, 8.50, 'item3480');
+INSERT INTO items VALUES (3481, 1, 8.75, 'item3481');
+INSERT INTO items VALUES (3482, 2, 9.00, 'item3482');
+INSERT INTO items VALUES (3483, 0, 9.25, 'item3483');
+INSERT INTO items VALUES (3484, 1, 9.50, 'item3484');
+INSERT INTO items VALUES (3485, 2, 9.75, 'item3485');
+INSERT INTO items VALUES (3486, 0, 10.00, 'item3486');
+INSERT INTO items VALUES (3487, 1, 10.25, 'item3487');
+INSERT INTO items VALUES (3488, 2, 10.50, 'item3488');
+INSERT INTO items VALUES (3489, 0, 10.75, 'item3489');
+INSERT INTO items VALUES (3490, 1, 11.00, 'item3490');
+INSERT INTO items VALUES (3491, 2, 11.25, 'item3491');
+INSERT INTO items VALUES (3492, 0, 11.50, 'item3492');
+INSERT INTO items VALUES (3493, 1, 11.75, 'item3493');
+INSERT INTO items VALUES (3494, 2, 12.00, 'item3494');
+INSERT INTO items VALUES (3495, 0, 12.25, 'item3495');
+INSERT INTO items VALUES (3496, 1, 12.50, 'item3496');
+INSERT INTO items VALUES (3497, 2, 12.75, 'item3497');
+INSERT INTO items VALUES (3498, 0, 13.00, 'item3498');
+INSERT INTO items VALUES (3499, 1, 13.25, 'item3499');
+INSERT INTO items VALUES (3500, 2, 1.00, 'item3500');
+INSERT INTO items VALUES (3501, 0, 1.25, 'item3501');
+INSERT INTO items VALUES (3502, 1, 1.50, 'item3502');
+INSERT INTO items VALUES (3503, 2, 1.75, 'item3503');
+INSERT INTO items VALUES (3504, 0, 2.00, 'item3504');
+INSERT INTO items VALUES (3505, 1, 2.25, 'item3505');
+INSERT INTO items VALUES (3506, 2, 2.50, 'item3506');
+INSERT INTO items VALUES (3507, 0, 2.75, 'item3507');
+INSERT INTO items VALUES (3508, 1, 3.00, 'item3508');
+INSERT INTO items VALUES (3509, 2, 3.25, 'item3509');
+INSERT INTO items VALUES (3510, 0, 3.50, 'item3510');
+INSERT INTO items VALUES (3511, 1, 3.75, 'item3511');
+INSERT INTO items VALUES (3512, 2, 4.00, 'item3512');
+INSERT INTO items VALUES (3513, 0, 4.25, 'item3513');
+INSERT INTO items VALUES (3514, 1, 4.50, 'item3514');
+INSERT INTO items VALUES (3515, 2, 4.75, 'item3515');
+INSERT INTO items VALUES (3516, 0, 5.00, 'item3516');
+INSERT INTO items VALUES (3517, 1, 5.25, 'item3517');
+INSERT INTO items VALUES (3518, 2, 5.50, 'item3518');
+INSERT INTO items VALUES (3519, 0, 5.75, 'item3519');
+INSERT INTO items VALUES (3520, 1, 6.00, 'item3520');
+INSERT INTO items VALUES (3521, 2, 6.25, 'item3521');
+INSERT INTO items VALUES (3522, 0, 6.50, 'item3522');
+INSERT INTO items VALUES (3523, 1, 6.75, 'item3523');
+INSERT INTO items VALUES (3524, 2, 7.00, 'item3524');
+INSERT INTO items VALUES (3525, 0, 7.25, 'item3525');
+INSERT INTO items VALUES (3526, 1, 7.50, 'item3526');
+INSERT INTO items VALUES (3527, 2, 7.75, 'item3527');
+INSERT INTO items VALUES (3528, 0, 8.00, 'item3528');
+INSERT INTO items VALUES (3529, 1, 8.25, 'item3529');
+INSERT INTO items VALUES (3530, 2, 8.50, 'item3530');
+INSERT INTO items VALUES (3531, 0, 8.75, 'item3531');
+INSERT INTO items VALUES (3532, 1, 9.00, 'item3532');
+INSERT INTO items VALUES (3533, 2, 9.25, 'item3533');
+INSERT INTO items VALUES (3534, 0, 9.50, 'item3534');
+INSERT INTO items VALUES (3535, 1, 9.75, 'item3535');
+INSERT INTO items VALUES (3536, 2, 10.00, 'item3536');
+INSERT INTO items VALUES (3537, 0, 10.25, 'item3537');
+INSERT INTO items VALUES (3538, 1, 10.50, 'item3538');
+INSERT INTO items VALUES (3539, 2, 10.75, 'item3539');
+INSERT INTO items VALUES (3540, 0, 11.00, 'item3540');
+INSERT INTO items VALUES (3541, 1, 11.25, 'item3541');
+INSERT INTO items VALUES (3542, 2, 11.50, 'item3542');
+INSERT INTO items VALUES (3543, 0, 11.75, 'item3543');
+INSERT INTO items VALUES (3544, 1, 12.00, 'item3544');
+INSERT INTO items VALUES (3545, 2, 12.25, 'item3545');
+INSERT INTO items VALUES (3546, 0, 12.50, 'item3546');
+INSERT INTO items VALUES (3547, 1, 12.75, 'item3547');
+INSERT INTO items VALUES (3548, 2, 13.00, 'item3548');
+INSERT INTO items VALUES (3549, 0, 13.25, 'item3549');
+INSERT INTO items VALUES (3550, 1, 1.00, 'item3550');
+INSERT INTO items VALUES (3551, 2, 1.25, 'item3551');
+INSERT INTO items VALUES (3552, 0, 1.50, 'item3552');
+INSERT INTO items VALUES (3553, 1, 1.75, 'item3553');
+INSERT INTO items VALUES (3554, 2, 2.00, 'item3554');
+INSERT INTO items VALUES (3555, 0, 2.25, 'item3555');
+INSERT INTO items VALUES (3556, 1, 2.50, 'item3556');
+INSERT INTO items VALUES (3557, 2, 2.75, 'item3557');
+INSERT INTO items VALUES (3558, 0, 3.00, 'item3558');
+INSERT INTO items VALUES (3559, 1, 3.25, 'item3559');
+INSERT INTO items VALUES (3560, 2, 3.50, 'item3560');
+INSERT INTO items VALUES (3561, 0, 3.75, 'item3561');
+INSERT INTO items VALUES (3562, 1, 4.00, 'item3562');
+INSERT INTO items VALUES (3563, 2, 4.25, 'item3563');
+INSERT INTO items VALUES (3564, 0, 4.50, 'item3564');
+INSERT INTO items VALUES (3565, 1, 4.75, 'item3565');
+INSERT INTO items VALUES (3566, 2, 5.00, 'item3566');
+INSERT INTO items VALUES (3567, 0, 5.25, 'item3567');
+INSERT INTO items VALUES (3568, 1, 5.50, 'item3568');
+INSERT INTO items VALUES (3569, 2, 5.75, 'item3569');
+INSERT INTO items VALUES (3570, 0, 6.00, 'item3570');
+INSERT INTO items VALUES (3571, 1, 6.25, 'item3571');
+INSERT INTO items VALUES (3572, 2, 6.50, 'item3572');
+INSERT INTO items VALUES (3573, 0, 6.75, 'item3573');
+INSERT INTO items VALUES (3574, 1, 7.00, 'item3574');
+INSERT INTO items VALUES (3575, 2, 7.25, 'item3575');
+INSERT INTO items VALUES (3576, 0, 7.50, 'item3576');
+INSERT INTO items VALUES (3577, 1, 7.75, 'item3577');
+INSERT INTO items VALUES (3578, 2, 8.00, 'item3578');
+INSERT INTO items VALUES (3579, 0, 8.25, 'item3579');
+INSERT INTO items VALUES (3580, 1, 8.50, 'item3580');
+INSERT INTO items VALUES (3581, 2, 8.75, 'item3581');
+INSERT INTO items VALUES (3582, 0, 9.00, 'item3582');
+INSERT INTO items VALUES (3583, 1, 9.25, 'item3583');
+INSERT INTO items VALUES (3584, 2, 9.50, 'item3584');
+INSERT INTO items VALUES (3585, 0, 9.75, 'item3585');
+INSERT INTO items VALUES (3586, 1, 10.00, 'item3586');
+INSERT INTO items VALUES (3587, 2, 10.25, 'item3587');
+INSERT INTO items VALUES (3588, 0, 10.50, 'item3588');
+INSERT INTO items VALUES (3589, 1, 10.75, 'item3589');
+INSERT INTO items VALUES (3590, 2, 11.00, 'item3590');
+INSERT INTO items VALUES (3591, 0, 11.25, 'item3591');
+INSERT INTO items VALUES (3592, 1, 11.50, 'item3592');
+INSERT INTO items VALUES (3593, 2, 11.75, 'item3593');
+INSERT INTO items VALUES (3594, 0, 12.00, 'item3594');
+INSERT INTO items VALUES (3595, 1, 12.25, 'item3595');
+INSERT INTO items VALUES (3596, 2, 12.50, 'item3596');
+INSERT INTO items VALUES (3597, 0, 12.75, 'item3597');
+INSERT INTO items VALUES (3598, 1, 13.00, 'item3598');
+INSERT INTO items VALUES (3599, 2, 13.25, 'item3599');
+INSERT INTO items VALUES (3600, 0, 1.00, 'item3600');
+INSERT INTO items VALUES (3601, 1, 1.25, 'item3601');
+INSERT INTO items VALUES (3602, 2, 1.50, 'item3602');
+INSERT INTO items VALUES (3603, 0, 1.75, 'item3603');
+INSERT INTO items VALUES (3604, 1, 2.00, 'item3604');
+INSERT INTO items VALUES (3605, 2, 2.25, 'item3605');
+INSERT INTO items VALUES (3606, 0, 2.50, 'item3606');
+INSERT INTO items VALUES (3607, 1, 2.75, 'item3607');
+INSERT INTO items VALUES (3608, 2, 3.00, 'item3608');
+INSERT INTO items VALUES (3609, 0, 3.25, 'item3609');
+INSERT INTO items VALUES (3610, 1, 3.50, 'item3610');
+INSERT INTO items VALUES (3611, 2, 3.75, 'item3611');
+INSERT INTO items VALUES (3612, 0, 4.00, 'item3612');
+INSERT INTO items VALUES (3613, 1, 4.25, 'item3613');
+INSERT INTO items VALUES (3614, 2, 4.50, 'item3614');
+INSERT INTO items VALUES (3615, 0, 4.75, 'item3615');
+INSERT INTO items VALUES (3616, 1, 5.00, 'item3616');
+INSERT INTO items VALUES (3617, 2, 5.25, 'item3617');
+INSERT INTO items VALUES (3618, 0, 5.50, 'item3618');
+INSERT INTO items VALUES (3619, 1, 5.75, 'item3619');
+INSERT INTO items VALUES (3620, 2, 6.00, 'item3620');
+INSERT INTO items VALUES (3621, 0, 6.25, 'item3621');
+INSERT INTO items VALUES (3622, 1, 6.50, 'item3622');
+INSERT INTO items VALUES (3623, 2, 6.75, 'item3623');
+INSERT INTO items VALUES (3624, 0, 7.00, 'item3624');
+INSERT INTO items VALUES (3625, 1, 7.25, 'item3625');
+INSERT INTO items VALUES (3626, 2, 7.50, 'item3626');
+INSERT INTO items VALUES (3627, 0, 7.75, 'item3627');
+INSERT INTO items VALUES (3628, 1, 8.00, 'item3628');
+INSERT INTO items VALUES (3629, 2, 8.25, 'item3629');
+INSERT INTO items VALUES (3630, 0, 8.50, 'item3630');
+INSERT INTO items VALUES (3631, 1, 8.75, 'item3631');
+INSERT INTO items VALUES (3632, 2, 9.00, 'item3632');
+INSERT INTO items VALUES (3633, 0, 9.25, 'item3633');
+INSERT INTO items VALUES (3634, 1, 9.50, 'item3634');
+INSERT INTO items VALUES (3635, 2, 9.75, 'item3635');
+INSERT INTO items VALUES (3636, 0, 10.00, 'item3636');
+INSERT INTO items VALUES (3637, 1, 10.25, 'item3637');
+INSERT INTO items VALUES (3638, 2, 10.50, 'item3638');
+INSERT INTO items VALUES (3639, 0, 10.75, 'item3639');
+INSERT INTO items VALUES (3640, 1, 11.00, 'item3640');
+INSERT INTO items VALUES (3641, 2, 11.25, 'item3641');
+INSERT INTO items VALUES (3642, 0, 11.50, 'item3642');
+INSERT INTO items VALUES (3643, 1, 11.75, 'item3643');
+INSERT INTO items VALUES (3644, 2, 12.00, 'item3644');
+INSERT INTO items VALUES (3645, 0, 12.25, 'item3645');
+INSERT INTO items VALUES (3646, 1, 12.50, 'item3646');
+INSERT INTO items VALUES (3647, 2, 12.75, 'item3647');
+INSERT INTO items VALUES (3648, 0, 13.00, 'item3648');
+INSERT INTO items VALUES (3649, 1, 13.25, 'item3649');
+INSERT INTO items VALUES (3650, 2, 1.00, 'item3650');
+INSERT INTO items VALUES (3651, 0, 1.25, 'item3651');
+INSERT INTO items VALUES (3652, 1, 1.50, 'item3652');
+INSERT INTO items VALUES (3653, 2, 1.75, 'item3653');
+INSERT INTO items VALUES (3654, 0, 2.00, 'item3654');
+INSERT INTO items VALUES (3655, 1, 2.25, 'item3655');
+INSERT INTO items VALUES (3656, 2, 2.50, 'item3656');
+INSERT INTO items VALUES (3657, 0, 2.75, 'item3657');
+INSERT INTO items VALUES (3658, 1, 3.00, 'item3658');
+INSERT INTO items VALUES (3659, 2, 3.25, 'item3659');
+INSERT INTO items VALUES (3660, 0, 3.50, 'item3660');
+INSERT INTO items VALUES (3661, 1, 3.75, 'item3661');
+INSERT INTO items VALUES (3662, 2, 4.00, 'item3662');
+INSERT INTO items VALUES (3663, 0, 4.25, 'item3663');
+INSERT INTO items VALUES (3664, 1, 4.50, 'item3664');
+INSERT INTO items VALUES (3665, 2, 4.75, 'item3665');
+INSERT INTO items VALUES (3666, 0, 5.00, 'item3666');
+INSERT INTO items VALUES (3667, 1, 5.25, 'item3667');
+INSERT INTO items VALUES (3668, 2, 5.50, 'item3668');
+INSERT INTO items VALUES (3669, 0, 5.75, 'item3669');
+INSERT INTO items VALUES (3670, 1, 6.00, 'item3670');
+INSERT INTO items VALUES (3671, 2, 6.25, 'item3671');
+INSERT INTO items VALUES (3672, 0, 6.50, 'item3672');
+INSERT INTO items VALUES (3673, 1, 6.75, 'item3673');
+INSERT INTO items VALUES (3674, 2, 7.00, 'item3674');
+INSERT INTO items VALUES (3675, 0, 7.25, 'item3675');
+INSERT INTO items VALUES (3676, 1, 7.50, 'item3676');
+INSERT INTO items VALUES (3677, 2, 7.75, 'item3677');
+INSERT INTO items VALUES (3678, 0, 8.00, 'item3678');
+INSERT INTO items VALUES (3679, 1, 8.25, 'item3679');
+INSERT INTO items VALUES (3680, 2, 8.50, 'item3680');
+INSERT INTO items VALUES (3681, 0, 8.75, 'item3681');
+INSERT INTO items VALUES (3682, 1, 9.00, 'item3682');
+INSERT INTO items VALUES (3683, 2, 9.25, 'item3683');
+INSERT INTO items VALUES (3684, 0, 9.50, 'item3684');
+INSERT INTO items VALUES (3685, 1, 9.75, 'item3685');
+INSERT INTO items VALUES (3686, 2, 10.00, 'item3686');
+INSERT INTO items VALUES (3687, 0, 10.25, 'item3687');
+INSERT INTO items VALUES (3688, 1, 10.50, 'item3688');
+INSERT INTO items VALUES (3689, 2, 10.75, 'item3689');
+INSERT INTO items VALUES (3690, 0, 11.00, 'item3690');
+INSERT INTO items VALUES (3691, 1, 11.25, 'item3691');
+INSERT INTO items VALUES (3692, 2, 11.50, 'item3692');
+INSERT INTO items VALUES (3693, 0, 11.75, 'item3693');
+INSERT INTO items VALUES (3694, 1, 12.00, 'item3694');
+INSERT INTO items VALUES (3695, 2, 12.25, 'item3695');
+INSERT INTO items VALUES (3696, 0, 12.50, 'item3696');
+INSERT INTO items VALUES (3697, 1, 12.75, 'item3697');
+INSERT INTO items VALUES (3698, 2, 13.00, 'item3698');
+INSERT INTO items VALUES (3699, 0, 13.25, 'item3699');
+INSERT INTO items VALUES (3700, 1, 1.00, 'item3700');
+INSERT INTO items VALUES (3701, 2, 1.25, 'item3701');
+INSERT INTO items VALUES (3702, 0, 1.50, 'item3702');
+INSERT INTO items VALUES (3703, 1, 1.75, 'item3703');
+INSERT INTO items VALUES (3704, 2, 2.00, 'item3704');
+INSERT INTO items VALUES (3705, 0, 2.25, 'item3705');
+INSERT INTO items VALUES (3706, 1, 2.50, 'item3706');
+INSERT INTO items VALUES (3707, 2, 2.75, 'item3707');
+INSERT INTO items VALUES (3708, 0, 3.00, 'item3708');
+INSERT INTO items VALUES (3709, 1, 3.25, 'item3709');
+INSERT INTO items VALUES (3710, 2, 3.50, 'item3710');
+INSERT INTO items VALUES (3711, 0, 3.75, 'item3711');
+INSERT INTO items VALUES (3712, 1, 4.00, 'item3712');
+INSERT INTO items VALUES (3713, 2, 4.25, 'item3713');
+INSERT INTO items VALUES (3714, 0, 4.50, 'item3714');
+INSERT INTO items VALUES (3715, 1, 4.75, 'item3715');
+INSERT INTO items VALUES (3716, 2, 5.00, 'item3716');
+INSERT INTO items VALUES (3717, 0, 5.25, 'item3717');
+INSERT INTO items VALUES (3718, 1, 5.50, 'item3718');
+INSERT INTO items VALUES (3719, 2, 5.75, 'item3719');
+INSERT INTO items VALUES (3720, 0, 6.00, 'item3720');
+INSERT INTO items VALUES (3721, 1, 6.25, 'item3721');
+INSERT INTO items VALUES (3722, 2, 6.50, 'item3722');
+INSERT INTO items VALUES (3723, 0, 6.75, 'item3723');
+INSERT INTO items VALUES (3724, 1, 7.00, 'item3724');
+INSERT INTO items VALUES (3725, 2, 7.25, 'item3725');
+INSERT INTO items VALUES (3726, 0, 7.50, 'item3726');
+INSERT INTO items VALUES (3727, 1, 7.75, 'item3727');
+INSERT INTO items VALUES (3728, 2, 8.00, 'item3728');
+INSERT INTO items VALUES (3729, 0, 8.25, 'item3729');
+INSERT INTO items VALUES (3730, 1, 8.50, 'item3730');
+INSERT INTO items VALUES (3731, 2, 8.75, 'item3731');
+INSERT INTO items VALUES (3732, 0, 9.00, 'item3732');
+INSERT INTO items VALUES (3733, 1, 9.25, 'item3733');
+INSERT INTO items VALUES (3734, 2, 9.50, 'item3734');
+INSERT INTO items VALUES (3735, 0, 9.75, 'item3735');
+INSERT INTO items VALUES (3736, 1, 10.00, 'item3736');
+INSERT INTO items VALUES (3737, 2, 10.25, 'item3737');
+INSERT INTO items VALUES (3738, 0, 10.50, 'item3738');
+INSERT INTO items VALUES (3739, 1, 10.75, 'item3739');
+INSERT INTO items VALUES (3740, 2, 11.00, 'item3740');
+INSERT INTO items VALUES (3741, 0, 11.25, 'item3741');
+INSERT INTO items VALUES (3742, 1, 11.50, 'item3742');
+INSERT INTO items VALUES (3743, 2, 11.75, 'item3743');
+INSERT INTO items VALUES (3744, 0, 12.00, 'item3744');
+INSERT INTO items VALUES (3745, 1, 12.25, 'item3745');
+INSERT INTO items VALUES (3746, 2, 12.50, 'item3746');
+INSERT INTO items VALUES (3747, 0, 12.75, 'item3747');
+INSERT INTO items VALUES (3748, 1, 13.00, 'item3748');
+INSERT INTO items VALUES (3749, 2, 13.25, 'item3749');
+INSERT INTO items VALUES (3750, 0, 1.00, 'item3750');
+INSERT INTO items VALUES (3751, 1, 1.25, 'item3751');
+INSERT INTO items VALUES (3752, 2, 1.50, 'item3752');
+INSERT INTO items VALUES (3753, 0, 1.75, 'item3753');
+INSERT INTO items VALUES (3754, 1, 2.00, 'item3754');
+INSERT INTO items VALUES (3755, 2, 2.25, 'item3755');
+INSERT INTO items VALUES (3756, 0, 2.50, 'item3756');
+INSERT INTO items VALUES (3757, 1, 2.75, 'item3757');
+INSERT INTO items VALUES (3758, 2, 3.00, 'item3758');
+INSERT INTO items VALUES (3759, 0, 3.25, 'item3759');
+INSERT INTO items VALUES (3760, 1, 3.50, 'item3760');
+INSERT INTO items VALUES (3761, 2, 3.75, 'item3761');
+INSERT INTO items VALUES (3762, 0, 4.00, 'item3762');
+INSERT INTO items VALUES (3763, 1, 4.25, 'item3763');
+INSERT INTO items VALUES (3764, 2, 4.50, 'item3764');
+INSERT INTO items VALUES (3765, 0, 4.75, 'item3765');
+INSERT INTO items VALUES (3766, 1, 5.00, 'item3766');
+INSERT INTO items VALUES (3767, 2, 5.25, 'item3767');
+INSERT INTO items VALUES (3768, 0, 5.50, 'item3768');
+INSERT INTO items VALUES (3769, 1, 5.75, 'item3769');
+INSERT INTO items VALUES (3770, 2, 6.00, 'item3770');
+INSERT INTO items VALUES (3771, 0, 6.25, 'item3771');
+INSERT INTO items VALUES (3772, 1, 6.50, 'item3772');
+INSERT INTO items VALUES (3773, 2, 6.75, 'item3773');
+INSERT INTO items VALUES (3774, 0, 7.00, 'item3774');
+INSERT INTO items VALUES (3775, 1, 7.25, 'item3775');
+INSERT INTO items VALUES (3776, 2, 7.50, 'item3776');
+INSERT INTO items VALUES (3777, 0, 7.75, 'item3777');
+INSERT INTO items VALUES (3778, 1, 8.00, 'item3778');
+INSERT INTO items VALUES (3779, 2, 8.25, 'item3779');
+INSERT INTO items VALUES (3780, 0, 8.50, 'item3780');
+INSERT INTO items VALUES (3781, 1, 8.75, 'item3781');
+INSERT INTO items VALUES (3782, 2, 9.00, 'item3782');
+INSERT INTO items VALUES (3783, 0, 9.25, 'item3783');
+INSERT INTO items VALUES (3784, 1, 9.50, 'item3784');
+INSERT INTO items VALUES (3785, 2, 9.75, 'item3785');
+INSERT INTO items VALUES (3786, 0, 10.00, 'item3786');
+INSERT INTO items VALUES (3787, 1, 10.25, 'item3787');
+INSERT INTO items VALUES (3788, 2, 10.50, 'item3788');
+INSERT INTO items VALUES (3789, 0, 10.75, 'item3789');
+INSERT INTO items VALUES (3790, 1, 11.00, 'item3790');
+INSERT INTO items VALUES (3791, 2, 11.25, 'item3791');
+INSERT INTO items VALUES (3792, 0, 11.50, 'item3792');
+INSERT INTO items VALUES (3793, 1, 11.75, 'item3793');
+INSERT INTO items VALUES (3794, 2, 12.00, 'item3794');
+INSERT INTO items VALUES (3795, 0, 12.25, 'item3795');
+INSERT INTO items VALUES (3796, 1, 12.50, 'item3796');
+INSERT INTO items VALUES (3797, 2, 12.75, 'item3797');
+INSERT INTO items VALUES (3798, 0, 13.00, 'item3798');
+INSERT INTO items VALUES (3799, 1, 13.25, 'item3799');
+INSERT INTO items VALUES (3800, 2, 1.00, 'item3800');
+INSERT INTO items VALUES (3801, 0, 1.25, 'item3801');
+INSERT INTO items VALUES (3802, 1, 1.50, 'item3802');
+INSERT INTO items VALUES (3803, 2, 1.75, 'item3803');
+INSERT INTO items VALUES (3804, 0, 2.00, 'item3804');
+INSERT INTO items VALUES (3805, 1, 2.25, 'item3805');
+INSERT INTO items VALUES (3806, 2, 2.50, 'item3806');
+INSERT INTO items VALUES (3807, 0, 2.75, 'item3807');
+INSERT INTO items VALUES (3808, 1, 3.00, 'item3808');
+INSERT INTO items VALUES (3809, 2, 3.25, 'item3809');
+INSERT INTO items VALUES (3810, 0, 3.50, 'item3810');
+INSERT INTO items VALUES (3811, 1, 3.75, 'item3811');
+INSERT INTO items VALUES (3812, 2, 4.00, 'item3812');
+INSERT INTO items VALUES (3813, 0, 4.25, 'item3813');
+INSERT INTO items VALUES (3814, 1, 4.50, 'item3814');
+INSERT INTO items VALUES (3815, 2, 4.75, 'item3815');
+INSERT INTO items VALUES (3816, 0, 5.00, 'item3816');
+INSERT INTO items VALUES (3817, 1, 5.25, 'item3817');
+INSERT INTO items VALUES (3818, 2, 5.50, 'item3818');
+INSERT INTO items VALUES (3819, 0, 5.75, 'item3819');
+INSERT INTO items VALUES (3820, 1, 6.00, 'item3820');
+INSERT INTO items VALUES (3821, 2, 6.25, 'item3821');
+INSERT INTO items VALUES (3822, 0, 6.50, 'item3822');
+INSERT INTO items VALUES (3823, 1, 6.75, 'item3823');
+INSERT INTO items VALUES (3824, 2, 7.00, 'item3824');
+INSERT INTO items VALUES (3825, 0, 7.25, 'item3825');
+INSERT INTO items VALUES (3826, 1, 7.50, 'item3826');
+INSERT INTO items VALUES (3827, 2, 7.75, 'item3827');
+INSERT INTO items VALUES (3828, 0, 8.00, 'item3828');
+INSERT INTO items VALUES (3829, 1, 8.25, 'item3829');
+INSERT INTO items VALUES (3830, 2, 8.50, 'item3830');
+INSERT INTO items VALUES (3831, 0, 8.75, 'item3831');
+INSERT INTO items VALUES (3832, 1, 9.00, 'item3832');
+INSERT INTO items VALUES (3833, 2, 9.25, 'item3833');
+INSERT INTO items VALUES (3834, 0, 9.50, 'item3834');
+INSERT INTO items VALUES (3835, 1, 9.75, 'item3835');
+INSERT INTO items VALUES (3836, 2, 10.00, 'item3836');
+INSERT INTO items VALUES (3837, 0, 10.25, 'item3837');
+INSERT INTO items VALUES (3838, 1, 10.50, 'item3838');
+INSERT INTO items VALUES (3839, 2, 10.75, 'item3839');
+INSERT INTO items VALUES (3840, 0, 11.00, 'item3840');
+INSERT INTO items VALUES (3841, 1, 11.25, 'item3841');
+INSERT INTO items VALUES (3842, 2, 11.50, 'item3842');
+INSERT INTO items VALUES (3843, 0, 11.75, 'item3843');
+INSERT INTO items VALUES (3844, 1, 12.00, 'item3844');
+INSERT INTO items VALUES (3845, 2, 12.25, 'item3845');
+INSERT INTO items VALUES (3846, 0, 12.50, 'item3846');
+INSERT INTO items VALUES (3847, 1, 12.75, 'item3847');
+INSERT INTO items VALUES (3848, 2, 13.00, 'item3848');
+INSERT INTO items VALUES (3849, 0, 13.25, 'item3849');
+INSERT INTO items VALUES (3850, 1, 1.00, 'item3850');
+INSERT INTO items VALUES (3851, 2, 1.25, 'item3851');
+INSERT INTO items VALUES (3852, 0, 1.50, 'item3852');
+INSERT INTO items VALUES (3853, 1, 1.75, 'item3853');
+INSERT INTO items VALUES (3854, 2, 2.00, 'item3854');
+INSERT INTO items VALUES (3855, 0, 2.25, 'item3855');
+INSERT INTO items VALUES (3856, 1, 2.50, 'item3856');
+INSERT INTO items VALUES (3857, 2, 2.75, 'item3857');
+INSERT INTO items VALUES (3858, 0, 3.00, 'item3858');
+INSERT INTO items VALUES (3859, 1, 3.25, 'item3859');
+INSERT INTO items VALUES (3860, 2, 3.50, 'item3860');
+INSERT INTO items VALUES (3861, 0, 3.75, 'item3861');
+INSERT INTO items VALUES (3862, 1, 4.00, 'item3862');
+INSERT INTO items VALUES (3863, 2, 4.25, 'item3863');
+INSERT INTO items VALUES (3864, 0, 4.50, 'item3864');
+INSERT INTO items VALUES (3865, 1, 4.75, 'item3865');
+INSERT INTO items VALUES (3866, 2, 5.00, 'item3866');
+INSERT INTO items VALUES (3867, 0, 5.25, 'item3867');
+INSERT INTO items VALUES (3868, 1, 5.50, 'item3868');
+INSERT INTO items VALUES (3869, 2, 5.75, 'item3869');
+INSERT INTO items VALUES (3870, 0, 6.00, 'item3870');
+INSERT INTO items VALUES (3871, 1, 6.25, 'item3871');
+INSERT INTO items VALUES (3872, 2, 6.50, 'item3872');
+INSERT INTO items VALUES (3873, 0, 6.75, 'item3873');
+INSERT INTO items VALUES (3874, 1, 7.00, 'item3874');
+INSERT INTO items VALUES (3875, 2, 7.25, 'item3875');
+INSERT INTO items VALUES (3876, 0, 7.50, 'item3876');
+INSERT INTO items VALUES (3877, 1, 7.75, 'item3877');
+INSERT INTO items VALUES (3878, 2, 8.00, 'item3878');
+INSERT INTO items VALUES (3879, 0, 8.25, 'item3879');
+INSERT INTO items VALUES (3880, 1, 8.50, 'item3880');
+INSERT INTO items VALUES (3881, 2, 8.75, 'item3881');
+INSERT INTO items VALUES (3882, 0, 9.00, 'item3882');
+INSERT INTO items VALUES (3883, 1, 9.25, 'item3883');
+INSERT INTO items VALUES (3884, 2, 9.50, 'item3884');
+INSERT INTO items VALUES (3885, 0, 9.75, 'item3885');
+INSERT INTO items VALUES (3886, 1, 10.00, 'item3886');
+INSERT INTO items VALUES (3887, 2, 10.25, 'item3887');
+INSERT INTO items VALUES (3888, 0, 10.50, 'item3888');
+INSERT INTO items VALUES (3889, 1, 10.75, 'item3889');
+INSERT INTO items VALUES (3890, 2, 11.00, 'item3890');
+INSERT INTO items VALUES (3891, 0, 11.25, 'item3891');
+INSERT INTO items VALUES (3892, 1, 11.50, 'item3892');
+INSERT INTO items VALUES (3893, 2, 11.75, 'item3893');
+INSERT INTO items VALUES (3894, 0, 12.00, 'item3894');
+INSERT INTO items VALUES (3895, 1, 12.25, 'item3895');
+INSERT INTO items VALUES (3896, 2, 12.50, 'item3896');
+INSERT INTO items VALUES (3897, 0, 12.75, 'item3897');
+INSERT INTO items VALUES (3898, 1, 13.00, 'item3898');
+INSERT INTO items VALUES (3899, 2, 13.25, 'item3899');
+INSERT INTO items VALUES (3900, 0, 1.00, 'item3900');
+INSERT INTO items VALUES (3901, 1, 1.25, 'item3901');
+INSERT INTO items VALUES (3902, 2, 1.50, 'item3902');
+INSERT INTO items VALUES (3903, 0, 1.75, 'item3903');
+INSERT INTO items VALUES (3904, 1, 2.00, 'item3904');
+INSERT INTO items VALUES (3905, 2, 2.25, 'item3905');
+INSERT INTO items VALUES (3906, 0, 2.50, 'item3906');
+INSERT INTO items VALUES (3907, 1, 2.75, 'item3907');
+INSERT INTO items VALUES (3908, 2, 3.00, 'item3908');
+INSERT INTO items VALUES (3909, 0, 3.25, 'item3909');
+INSERT INTO items VALUES (3910, 1, 3.50, 'item3910');
+INSERT INTO items VALUES (3911, 2, 3.75, 'item3911');
+INSERT INTO items VALUES (3912, 0, 4.00, 'item3912');
+INSERT INTO items VALUES (3913, 1, 4.25, 'item3913');
+INSERT INTO items VALUES (3914, 2, 4.50, 'item3914');
+INSERT INTO items VALUES (3915, 0, 4.75, 'item3915');
+INSERT INTO items VALUES (3916, 1, 5.00, 'item3916');
+INSERT INTO items VALUES (3917, 2, 5.25, 'item3917');
+INSERT INTO items VALUES (3918, 0, 5.50, 'item3918');
+INSERT INTO items VALUES (3919, 1, 5.75, 'item3919');
+INSERT INTO items VALUES (3920, 2, 6.00, 'item3920');
+INSERT INTO items VALUES (3921, 0, 6.25, 'item3921');
+INSERT INTO items VALUES (3922, 1, 6.50, 'item3922');
+INSERT INTO items VALUES (3923, 2, 6.75, 'item3923');
+INSERT INTO items VALUES (3924, 0, 7.00, 'item3924');
+INSERT INTO items VALUES (3925, 1, 7.25, 'item3925');
+INSERT INTO items VALUES (3926, 2, 7.50, 'item3926');
+INSERT INTO items VALUES (3927, 0, 7.75, 'item3927');
+INSERT INTO items VALUES (3928, 1, 8.00, 'item3928');
+INSERT INTO items VALUES (3929, 2, 8.25, 'item3929');
+INSERT INTO items VALUES (3930, 0, 8.50, 'item3930');
+INSERT INTO items VALUES (3931, 1, 8.75, 'item3931');
+INSERT INTO items VALUES (3932, 2, 9.00, 'item3932');
+INSERT INTO items VALUES (3933, 0, 9.25, 'item3933');
+INSERT INTO items VALUES (3934, 1, 9.50, 'item3934');
+INSERT INTO items VALUES (3935, 2, 9.75, 'item3935');
+INSERT INTO items VALUES (3936, 0, 10.00, 'item3936');
+INSERT INTO items VALUES (3937, 1, 10.25, 'item3937');
+INSERT INTO items VALUES (3938, 2, 10.50, 'item3938');
+INSERT INTO items VALUES (3939, 0, 10.75, 'item3939');
+INSERT INTO items VALUES (3940, 1, 11.00, 'item3940');
+INSERT INTO items VALUES (3941, 2, 11.25, 'item3941');
+INSERT INTO items VALUES (3942, 0, 11.50, 'item3942');
+INSERT INTO items VALUES (3943, 1, 11.75, 'item3943');
+INSERT INTO items VALUES (3944, 2, 12.00, 'item3944');
+INSERT INTO items VALUES (3945, 0, 12.25, 'item3945');
+INSERT INTO items VALUES (3946, 1, 12.50, 'item3946');
+INSERT INTO items VALUES (3947, 2, 12.75, 'item3947');
+INSERT INTO items VALUES (3948, 0, 13.00, 'item3948');
+INSERT INTO items VALUES (3949, 1, 13.25, 'item3949');
+INSERT INTO items VALUES (3950, 2, 1.00, 'item3950');
+INSERT INTO items VALUES (3951, 0, 1.25, 'item3951');
+INSERT INTO items VALUES (3952, 1, 1.50, 'item3952');
+INSERT INTO items VALUES (3953, 2, 1.75, 'item3953');
+INSERT INTO items VALUES (3954, 0, 2.00, 'item3954');
+INSERT INTO items VALUES (3955, 1, 2.25, 'item3955');
+INSERT INTO items VALUES (3956, 2, 2.50, 'item3956');
+INSERT INTO items VALUES (3957, 0, 2.75, 'item3957');
+INSERT INTO items VALUES (3958, 1, 3.00, 'item3958');
+INSERT INTO items VALUES (3959, 2, 3.25, 'item3959');
+INSERT INTO items VALUES (3960, 0, 3.50, 'item3960');
+INSERT INTO items VALUES (3961, 1, 3.75, 'item3961');
+INSERT INTO items VALUES (3962, 2, 4.00, 'item3962');
+INSERT INTO items VALUES (3963, 0, 4.25, 'item3963');
+INSERT INTO items VALUES (3964, 1, 4.50, 'item3964');
+INSERT INTO items VALUES (3965, 2, 4.75, 'item3965');
+INSERT INTO items VALUES (3966, 0, 5.00, 'item3966');
+INSERT INTO items VALUES (3967, 1, 5.25, 'item3967');
+INSERT INTO items VALUES (3968, 2, 5.50, 'item3968');
+INSERT INTO items VALUES (3969, 0, 5.75, 'item3969');
+INSERT INTO items VALUES (3970, 1, 6.00, 'item3970');
+INSERT INTO items VALUES (3971, 2, 6.25, 'item3971');
+INSERT INTO items VALUES (3972, 0, 6.50, 'item3972');
+INSERT INTO items VALUES (3973, 1, 6.75, 'item3973');
+INSERT INTO items VALUES (3974, 2, 7.00, 'item3974');
+INSERT INTO items VALUES (3975, 0, 7.25, 'item3975');
+INSERT INTO items VALUES (3976, 1, 7.50, 'item3976');
+INSERT INTO items VALUES (3977, 2, 7.75, 'item3977');
+INSERT INTO items VALUES (3978, 0, 8.00, 'item3978');
+INSERT INTO items VALUES (3979, 1, 8.25, 'item3979');
+INSERT INTO items VALUES (3980, 2, 8.50, 'item3980');
+INSERT INTO items VALUES (3981, 0, 8.75, 'item3981');
+INSERT INTO items VALUES (3982, 1, 9.00, 'item3982');
+INSERT INTO items VALUES (3983, 2, 9.25, 'item3983');
+INSERT INTO items VALUES (3984, 0, 9.50, 'item3984');
+INSERT INTO items VALUES (3985, 1, 9.75, 'item3985');
+INSERT INTO items VALUES (3986, 2, 10.00, 'item3986');
+INSERT INTO items VALUES (3987, 0, 10.25, 'item3987');
+INSERT INTO items VALUES (3988, 1, 10.50, 'item3988');
+INSERT INTO items VALUES (3989, 2, 10.75, 'item3989');
+INSERT INTO items VALUES (3990, 0, 11.00, 'item3990');
+INSERT INTO items VALUES (3991, 1, 11.25, 'item3991');
+INSERT INTO items VALUES (3992, 2, 11.50, 'item3992');
+INSERT INTO items VALUES (3993, 0, 11.75, 'item3993');
+INSERT INTO items VALUES (3994, 1, 12.00, 'item3994');
+INSERT INTO items VALUES (3995, 2, 12.25, 'item3995');
+INSERT INTO items VALUES (3996, 0, 12.50, 'item3996');
+INSERT INTO items VALUES (3997, 1, 12.75, 'item3997');
+INSERT INTO items VALUES (3998, 2, 13.00, 'item3998');
+INSERT INTO items VALUES (3999, 0, 13.25, 'item3999');
+INSERT INTO items VALUES (4000, 1, 1.00, 'item4000');
+INSERT INTO items VALUES (4001, 2, 1.25, 'item4001');
+INSERT INTO items VALUES (4002, 0, 1.50, 'item4002');
+INSERT INTO items VALUES (4003, 1, 1.75, 'item4003');
+INSERT INTO items VALUES (4004, 2, 2.00, 'item4004');
+INSERT INTO items VALUES (4005, 0, 2.25, 'item4005');
+INSERT INTO items VALUES (4006, 1, 2.50, 'item4006');
+INSERT INTO items VALUES (4007, 2, 2.75, 'item4007');
+INSERT INTO items VALUES (4008, 0, 3.00, 'item4008');
+INSERT INTO items VALUES (4009, 1, 3.25, 'item4009');
+INSERT INTO items VALUES (4010, 2, 3.50, 'item4010');
+INSERT INTO items VALUES (4011, 0, 3.75, 'item4011');
+INSERT INTO items VALUES (4012, 1, 4.00, 'item4012');
+INSERT INTO items VALUES (4013, 2, 4.25, 'item4013');
+INSERT INTO items VALUES (4014, 0, 4.50, 'item4014');
+INSERT INTO items VALUES (4015, 1, 4.75, 'item4015');
+INSERT INTO items VALUES (4016, 2, 5.00, 'item4016');
+INSERT INTO items VALUES (4017, 0, 5.25, 'item4017');
+INSERT INTO items VALUES (4018, 1, 5.50, 'item4018');
+INSERT INTO items VALUES (4019, 2, 5.75, 'item4019');
+INSERT INTO items VALUES (4020, 0, 6.00, 'item4020');
+INSERT INTO items VALUES (4021, 1, 6.25, 'item4021');
+INSERT INTO items VALUES (4022, 2, 6.50, 'item4022');
+INSERT INTO items VALUES (4023, 0, 6.75, 'item4023');
+INSERT INTO items VALUES (4024, 1, 7.00, 'item4024');
+INSERT INTO items VALUES (4025, 2, 7.25, 'item4025');
+INSERT INTO items VALUES (4026, 0, 7.50, 'item4026');
+INSERT INTO items VALUES (4027, 1, 7.75, 'item4027');
+INSERT INTO items VALUES (4028, 2, 8.00, 'item4028');
+INSERT INTO items VALUES (4029, 0, 8.25, 'item4029');
+INSERT INTO items VALUES (4030, 1, 8.50, 'item4030');
+INSERT INTO items VALUES (4031, 2, 8.75, 'item4031');
+INSERT INTO items VALUES (4032, 0, 9.00, 'item4032');
+INSERT INTO items VALUES (4033, 1, 9.25, 'item4033');
+INSERT INTO items VALUES (4034, 2, 9.50, 'item4034');
+INSERT INTO items VALUES (4035, 0, 9.75, 'item4035');
+INSERT INTO items VALUES (4036, 1, 10.00, 'item4036');
+INSERT INTO items VALUES (4037, 2, 10.25, 'item4037');
+INSERT INTO items VALUES (4038, 0, 10.50, 'item4038');
+INSERT INTO items VALUES (4039, 1, 10.75, 'item4039');
+INSERT INTO items VALUES (4040, 2, 11.00, 'item4040');
+INSERT INTO items VALUES (4041, 0, 11.25, 'item4041');
+INSERT INTO items VALUES (4042, 1, 11.50, 'item4042');
+INSERT INTO items VALUES (4043, 2, 11.75, 'item4043');
+INSERT INTO items VALUES (4044, 0, 12.00, 'item4044');
+INSERT INTO items VALUES (4045, 1, 12.25, 'item4045');
+INSERT INTO items VALUES (4046, 2, 12.50, 'item4046');
+INSERT INTO items VALUES (4047, 0, 12.75, 'item4047');
+INSERT INTO items VALUES (4048, 1, 13.00, 'item4048');
+INSERT INTO items VALUES (4049, 2, 13.25, 'item4049');
+INSERT INTO items VALUES (4050, 0, 1.00, 'item4050');
+INSERT INTO items VALUES (4051, 1, 1.25, 'item4051');
+INSERT INTO items VALUES (4052, 2, 1.50, 'item4052');
+INSERT INTO items VALUES (4053, 0, 1.75, 'item4053');
+INSERT INTO items VALUES (4054, 1, 2.00, 'item4054');
+INSERT INTO items VALUES (4055, 2, 2.25, 'item4055');
+INSERT INTO items VALUES (4056, 0, 2.50, 'item4056');
+INSERT INTO items VALUES (4057, 1, 2.75, 'item4057');
+INSERT INTO items VALUES (4058, 2, 3.00, 'item4058');
+INSERT INTO items VALUES (4059, 0, 3.25, 'item4059');
+INSERT INTO items VALUES (4060, 1, 3.50, 'item4060');
+INSERT INTO items VALUES (4061, 2, 3.75, 'item4061');
+INSERT INTO items VALUES (4062, 0, 4.00, 'item4062');
+INSERT INTO items VALUES (4063, 1, 4.25, 'item4063');
+INSERT INTO items VALUES (4064, 2, 4.50, 'item4064');
+INSERT INTO items VALUES (4065, 0, 4.75, 'item4065');
+INSERT INTO items VALUES (4066, 1, 5.00, 'item4066');
+INSERT INTO items VALUES (4067, 2, 5.25, 'item4067');
+INSERT INTO items VALUES (4068, 0, 5.50, 'item4068');
+INSERT INTO items VALUES (4069, 1, 5.75, 'item4069');
+INSERT INTO items VALUES (4070, 2, 6.00, 'item4070');
+INSERT INTO items VALUES (4071, 0, 6.25, 'item4071');
+INSERT INTO items VALUES (4072, 1, 6.50, 'item4072');
+INSERT INTO items VALUES (4073, 2, 6.75, 'item4073');
+INSERT INTO items VALUES (4074, 0, 7.00, 'item4074');
+INSERT INTO items VALUES (4075, 1, 7.25, 'item4075');
+INSERT INTO items VALUES (4076, 2, 7.50, 'item4076');
+INSERT INTO items VALUES (4077, 0, 7.75, 'item4077');
+INSERT INTO items VALUES (4078, 1, 8.00, 'item4078');
+INSERT INTO items VALUES (4079, 2, 8.25, 'item4079');
+INSERT INTO items VALUES (4080, 0, 8.50, 'item4080');
+INSERT INTO items VALUES (4081, 1, 8.75, 'item4081');
+INSERT INTO items VALUES (4082, 2, 9.00, 'item4082');
+INSERT INTO items VALUES (4083, 0, 9.25, 'item4083');
+INSERT INTO items VALUES (4084, 1, 9.50, 'item4084');
+INSERT INTO items VALUES (4085, 2, 9.75, 'item4085');
+INSERT INTO items VALUES (4086, 0, 10.00, 'item4086');
+INSERT INTO items VALUES (4087, 1, 10.25, 'item4087');
+INSERT INTO items VALUES (4088, 2, 10.50, 'item4088');
+INSERT INTO items VALUES (4089, 0, 10.75, 'item4089');
+INSERT INTO items VALUES (4090, 1, 11.00, 'item4090');
+INSERT INTO items VALUES (4091, 2, 11.25, 'item4091');
+INSERT INTO items VALUES (4092, 0, 11.50, 'item4092');
+INSERT INTO items VALUES (4093, 1, 11.75, 'item4093');
+INSERT INTO items VALUES (4094, 2, 12.00, 'item4094');
+INSERT INTO items VALUES (4095, 0, 12.25, 'item4095');
+INSERT INTO items VALUES (4096, 1, 12.50, 'item4096');
+INSERT INTO items VALUES (4097, 2, 12.75, 'item4097');
+INSERT INTO items VALUES (4098, 0, 13.00, 'item4098');
+INSERT INTO items VALUES (4099, 1, 13.25, 'item4099');
+INSERT INTO items VALUES (4100, 2, 1.00, 'item4100');
+INSERT INTO items VALUES (4101, 0, 1.25, 'item4101');
+INSERT INTO items VALUES (4102, 1, 1.50, 'item4102');
+INSERT INTO items VALUES (4103, 2, 1.75, 'item4103');
+INSERT INTO items VALUES (4104, 0, 2.00, 'item4104');
+INSERT INTO items VALUES (4105, 1, 2.25, 'item4105');
+INSERT INTO items VALUES (4106, 2, 2.50, 'item4106');
+INSERT INTO items VALUES (4107, 0, 2.75, 'item4107');
+INSERT INTO items VALUES (4108, 1, 3.00, 'item4108');
+INSERT INTO items VALUES (4109, 2, 3.25, 'item4109');
+INSERT INTO items VALUES (4110, 0, 3.50, 'item4110');
+INSERT INTO items VALUES (4111, 1, 3.75, 'item4111');
+INSERT INTO items VALUES (4112, 2, 4.00, 'item4112');
+INSERT INTO items VALUES (4113, 0, 4.25, 'item4113');
+INSERT INTO items VALUES (4114, 1, 4.50, 'item4114');
+INSERT INTO items VALUES (4115, 2, 4.75, 'item4115');
+INSERT INTO items VALUES (4116, 0, 5.00, 'item4116');
+INSERT INTO items VALUES (4117, 1, 5.25, 'item4117');
+INSERT INTO items VALUES (4118, 2, 5.50, 'item4118');
+INSERT INTO items VALUES (4119, 0, 5.75, 'item4119');
+INSERT INTO items VALUES (4120, 1, 6.00, 'item4120');
+INSERT INTO items VALUES (4121, 2, 6.25, 'item4121');
+INSERT INTO items VALUES (4122, 0, 6.50, 'item4122');
+INSERT INTO items VALUES (4123, 1, 6.75, 'item4123');
+INSERT INTO items VALUES (4124, 2, 7.00, 'item4124');
+INSERT INTO items VALUES (4125, 0, 7.25, 'item4125');
+INSERT INTO items VALUES (4126, 1, 7.50, 'item4126');
+INSERT INTO items VALUES (4127, 2, 7.75, 'item4127');
+INSERT INTO items VALUES (4128, 0, 8.00, 'item4128');
+INSERT INTO items VALUES (4129, 1, 8.25, 'item4129');
+INSERT INTO items VALUES (4130, 2, 8.50, 'item4130');
+INSERT INTO items VALUES (4131, 0, 8.75, 'item4131');
+INSERT INTO items VALUES (4132, 1, 9.00, 'item4132');
+INSERT INTO items VALUES (4133, 2, 9.25, 'item4133');
+INSERT INTO items VALUES (4134, 0, 9.50, 'item4134');
+INSERT INTO items VALUES (4135, 1, 9.75, 'item4135');
+INSERT INTO items VALUES (4136, 2, 10.00, 'item4136');
+INSERT INTO items VALUES (4137, 0, 10.25, 'item4137');
+INSERT INTO items VALUES (4138, 1, 10.50, 'item4138');
+INSERT INTO items VALUES (4139, 2, 10.75, 'item4139');
+INSERT INTO items VALUES (4140, 0, 11.00, 'item4140');
+INSERT INTO items VALUES (4141, 1, 11.25, 'item4141');
+INSERT INTO items VALUES (4142, 2, 11.50, 'item4142');
+INSERT INTO items VALUES (4143, 0, 11.75, 'item4143');
+INSERT INTO items VALUES (4144, 1, 12.00, 'item4144');
+INSERT INTO items VALUES (4145, 2, 12.25, 'item4145');
+INSERT INTO items VALUES (4146, 0, 12.50, 'item4146');
+INSERT INTO items VALUES (4147, 1, 12.75, 'item4147');
+INSERT INTO items VALUES (4148, 2, 13.00, 'item4148');
+INSERT INTO items VALUES (4149, 0, 13.25, 'item4149');
+INSERT INTO items VALUES (4150, 1, 1.00, 'item4150');
+INSERT INTO items VALUES (4151, 2, 1.25, 'item4151');
+INSERT INTO items VALUES (4152, 0, 1.50, 'item4152');
+INSERT INTO items VALUES (4153, 1, 1.75, 'item4153');
+INSERT INTO items VALUES (4154, 2, 2.00, 'item4154');
+INSERT INTO items VALUES (4155, 0, 2.25, 'item4155');
+INSERT INTO items VALUES (4156, 1, 2.50, 'item4156');
+INSERT INTO items VALUES (4157, 2, 2.75, 'item4157');
+INSERT INTO items VALUES (4158, 0, 3.00, 'item4158');
+INSERT INTO items VALUES (4159, 1, 3.25, 'item4159');
+INSERT INTO items VALUES (4160, 2, 3.50, 'item4160');
+INSERT INTO items VALUES (4161, 0, 3.75, 'item4161');
+INSERT INTO items VALUES (4162, 1, 4.00, 'item4162');
+INSERT INTO items VALUES (4163, 2, 4.25, 'item4163');
+INSERT INTO items VALUES (4164, 0, 4.50, 'item4164');
+INSERT INTO items VALUES (4165, 1, 4.75, 'item4165');
+INSERT INTO items VALUES (4166, 2, 5.00, 'item4166');
+INSERT INTO items VALUES (4167, 0, 5.25, 'item4167');
+INSERT INTO items VALUES (4168, 1, 5.50, 'item4168');
+INSERT INTO items VALUES (4169, 2, 5.75, 'item4169');
+INSERT INTO items VALUES (4170, 0, 6.00, 'item4170');
+INSERT INTO items VALUES (4171, 1, 6.25, 'item4171');
+INSERT INTO items VALUES (4172, 2, 6.50, 'item4172');
+INSERT INTO items VALUES (4173, 0, 6.75, 'item4173');
+INSERT INTO items VALUES (4174, 1, 7.00, 'item4174');
+INSERT INTO items VALUES (4175, 2, 7.25, 'item4175');
+INSERT INTO items VALUES (4176, 0, 7.50, 'item4176');
+INSERT INTO items VALUES (4177, 1, 7.75, 'item4177');
+INSERT INTO items VALUES (4178, 2, 8.00, 'item4178');
+INSERT INTO items VALUES (4179, 0, 8.25, 'item4179');
+INSERT INTO items VALUES (4180, 1, 8.50, 'item4180');
+INSERT INTO items VALUES (4181, 2, 8.75, 'item4181');
+INSERT INTO items VALUES (4182, 0, 9.00, 'item4182');
+INSERT INTO items VALUES (4183, 1, 9.25, 'item4183');
+INSERT INTO items VALUES (4184, 2, 9.50, 'item4184');
+INSERT INTO items VALUES (4185, 0, 9.75, 'item4185');
+INSERT INTO items VALUES (4186, 1, 10.00, 'item4186');
+INSERT INTO items VALUES (4187, 2, 10.25, 'item4187');
+INSERT INTO items VALUES (4188, 0, 10.50, 'item4188');
+INSERT INTO items VALUES (4189, 1, 10.75, 'item4189');
+INSERT INTO items VALUES (4190, 2, 11.00, 'item4190');
+INSERT INTO items VALUES (4191, 0, 11.25, 'item4191');
+INSERT INTO items VALUES (4192, 1, 11.50, 'item4192');
+INSERT INTO items VALUES (4193, 2, 11.75, 'item4193');
+INSERT INTO items VALUES (4194, 0, 12.00, 'item4194');
+INSERT INTO items VALUES (4195, 1, 12.25, 'item4195');
+INSERT INTO items VALUES (4196, 2, 12.50, 'item4196');
+INSERT INTO items VALUES (4197, 0, 12.75, 'item4197');
+INSERT INTO items VALUES (4198, 1, 13.00, 'item4198');
+INSERT INTO items VALUES (4199, 2, 13.25, 'item4199');
+INSERT INTO items VALUES (4200, 0, 1.00, 'item4200');
+INSERT INTO items VALUES (4201, 1, 1.25, 'item4201');
+INSERT INTO items VALUES (4202, 2, 1.50, 'item4202');
+INSERT INTO items VALUES (4203, 0, 1.75, 'item4203');
+INSERT INTO items VALUES (4204, 1, 2.00, 'item4204');
+INSERT INTO items VALUES (4205, 2, 2.25, 'item4205');
+INSERT INTO items VALUES (4206, 0, 2.50, 'item4206');
+INSERT INTO items VALUES (4207, 1, 2.75, 'item4207');
+INSERT INTO items VALUES (4208, 2, 3.00, 'item4208');
+INSERT INTO items VALUES (4209, 0, 3.25, 'item4209');
+INSERT INTO items VALUES (4210, 1, 3.50, 'item4210');
+INSERT INTO items VALUES (4211, 2, 3.75, 'item4211');
+INSERT INTO items VALUES (4212, 0, 4.00, 'item4212');
+INSERT INTO items VALUES (4213, 1, 4.25, 'item4213');
+INSERT INTO items VALUES (4214, 2, 4.50, 'item4214');
+INSERT INTO items VALUES (4215, 0, 4.75, 'item4215');
+INSERT INTO items VALUES (4216, 1, 5.00, 'item4216');
+INSERT INTO items VALUES (4217, 2, 5.25, 'item4217');
+INSERT INTO items VALUES (4218, 0, 5.50, 'item4218');
+INSERT INTO items VALUES (4219, 1, 5.75, 'item4219');
+INSERT INTO items VALUES (4220, 2, 6.00, 'item4220');
+INSERT INTO items VALUES (4221, 0, 6.25, 'item4221');
+INSERT INTO items VALUES (4222, 1, 6.50, 'item4222');
+INSERT INTO items VALUES (4223, 2, 6.75, 'item4223');
+INSERT INTO items VALUES (4224, 0, 7.00, 'item4224');
+INSERT INTO items VALUES (4225, 1, 7.25, 'item4225');
+INSERT INTO items VALUES (4226, 2, 7.50, 'item4226');
+INSERT INTO items VALUES (4227, 0, 7.75, 'item4227');
+INSERT INTO items VALUES (4228, 1, 8.00, 'item4228');
+INSERT INTO items VALUES (4229, 2, 8.25, 'item4229');
+INSERT INTO items VALUES (4230, 0, 8.50, 'item4230');
+INSERT INTO items VALUES (4231, 1, 8.75, 'item4231');
+INSERT INTO items VALUES (4232, 2, 9.00, 'item4232');
+INSERT INTO items VALUES (4233, 0, 9.25, 'item4233');
+INSERT INTO items VALUES (4234, 1, 9.50, 'item4234');
+INSERT INTO items VALUES (4235, 2, 9.75, 'item4235');
+INSERT INTO items VALUES (4236, 0, 10.00, 'item4236');
+INSERT INTO items VALUES (4237, 1, 10.25, 'item4237');
+INSERT INTO items VALUES (4238, 2, 10.50, 'item4238');
+INSERT INTO items VALUES (4239, 0, 10.75, 'item4239');
+INSERT INTO items VALUES (4240, 1, 11.00, 'item4240');
+INSERT INTO items VALUES (4241, 2, 11.25, 'item4241');
+INSERT INTO items VALUES (4242, 0, 11.50, 'item4242');
+INSERT INTO items VALUES (4243, 1, 11.75, 'item4243');
+INSERT INTO items VALUES (4244, 2, 12.00, 'item4244');
+INSERT INTO items VALUES (4245, 0, 12.25, 'item4245');
+INSERT INTO items VALUES (4246, 1, 12.50, 'item4246');
+INSERT INTO items VALUES (4247, 2, 12.75, 'item4247');
+INSERT INTO items VALUES (4248, 0, 13.00, 'item4248');
+INSERT INTO items VALUES (4249, 1, 13.25, 'item4249');
+INSERT INTO items VALUES (4250, 2, 1.00, 'item4250');
+INSERT INTO items VALUES (4251, 0, 1.25, 'item4251');
+INSERT INTO items VALUES (4252, 1, 1.50, 'item4252');
+INSERT INTO items VALUES (4253, 2, 1.75, 'item4253');
+INSERT INTO items VALUES (4254, 0, 2.00, 'item4254');
+INSERT INTO items VALUES (4255, 1, 2.25, 'item4255');
+INSERT INTO items VALUES (4256, 2, 2.50, 'item4256');
+INSERT INTO items VALUES (4257, 0, 2.75, 'item4257');
+INSERT INTO items VALUES (4258, 1, 3.00, 'item4258');
+INSERT INTO items VALUES (4259, 2, 3.25, 'item4259');
+INSERT INTO items VALUES (4260, 0, 3.50, 'item4260');
+INSERT INTO items VALUES (4261, 1, 3.75, 'item4261');
+INSERT INTO items VALUES (4262, 2, 4.00, 'item4262');
+INSERT INTO items VALUES (4263, 0, 4.25, 'item4263');
+INSERT INTO items VALUES (4264, 1, 4.50, 'item4264');
+INSERT INTO items VALUES (4265, 2, 4.75, 'item4265');
+INSERT INTO items VALUES (4266, 0, 5.00, 'item4266');
+INSERT INTO items VALUES (4267, 1, 5.25, 'item4267');
+INSERT INTO items VALUES (4268, 2, 5.50, 'item4268');
+INSERT INTO items VALUES (4269, 0, 5.75, 'item4269');
+INSERT INTO items VALUES (4270, 1, 6.00, 'item4270');
+INSERT INTO items VALUES (4271, 2, 6.25, 'item4271');
+INSERT INTO items VALUES (4272, 0, 6.50, 'item4272');
+INSERT INTO items VALUES (4273, 1, 6.75, 'item4273');
+INSERT INTO items VALUES (4274, 2, 7.00, 'item4274');
+INSERT INTO items VALUES (4275, 0, 7.25, 'item4275');
+INSERT INTO items VALUES (4276, 1, 7.50, 'item4276');
+INSERT INTO items VALUES (4277, 2, 7.75, 'item4277');
+INSERT INTO items VALUES (4278, 0, 8.00, 'item4278');
+INSERT INTO items VALUES (4279, 1, 8.25, 'item4279');
+INSERT INTO items VALUES (4280, 2, 8.50, 'item4280');
+INSERT INTO items VALUES (4281, 0, 8.75, 'item4281');
+INSERT INTO items VALUES (4282, 1, 9.00, 'item4282');
+INSERT INTO items VALUES (4283, 2, 9.25, 'item4283');
+INSERT INTO items VALUES (4284, 0, 9.50, 'item4284');
+INSERT INTO items VALUES (4285, 1, 9.75, 'item4285');
+INSERT INTO items VALUES (4286, 2, 10.00, 'item4286');
+INSERT INTO items VALUES (4287, 0, 10.25, 'item4287');
+INSERT INTO items VALUES (4288, 1, 10.50, 'item4288');
+INSERT INTO items VALUES (4289, 2, 10.75, 'item4289');
+INSERT INTO items VALUES (4290, 0, 11.00, 'item4290');
+INSERT INTO items VALUES (4291, 1, 11.25, 'item4291');
+INSERT INTO items VALUES (4292, 2, 11.50, 'item4292');
+INSERT INTO items VALUES (4293, 0, 11.75, 'item4293');
+INSERT INTO items VALUES (4294, 1, 12.00, 'item4294');
+INSERT INTO items VALUES (4295, 2, 12.25, 'item4295');
+INSERT INTO items VALUES (4296, 0, 12.50, 'item4296');
+INSERT INTO items VALUES (4297, 1, 12.75, 'item4297');
+INSERT INTO items VALUES (4298, 2, 13.00, 'item4298');
+INSERT INTO items VALUES (4299, 0, 13.25, 'item4299');
+INSERT INTO items VALUES (4300, 1, 1.00, 'item4300');
+INSERT INTO items VALUES (4301, 2, 1.25, 'item4301');
+INSERT INTO items VALUES (4302, 0, 1.50, 'item4302');
+INSERT INTO items VALUES (4303, 1, 1.75, 'item4303');
+INSERT INTO items VALUES (4304, 2, 2.00, 'item4304');
+INSERT INTO items VALUES (4305, 0, 2.25, 'item4305');
+INSERT INTO items VALUES (4306, 1, 2.50, 'item4306');
+INSERT INTO items VALUES (4307, 2, 2.75, 'item4307');
+INSERT INTO items VALUES (4308, 0, 3.00, 'item4308');
+INSERT INTO items VALUES (4309, 1, 3.25, 'item4309');
+INSERT INTO items VALUES (4310, 2, 3.50, 'item4310');
+INSERT INTO items VALUES (4311, 0, 3.75, 'item4311');
+INSERT INTO items VALUES (4312, 1, 4.00, 'item4312');
+INSERT INTO items VALUES (4313, 2, 4.25, 'item4313');
+INSERT INTO items VALUES (4314, 0, 4.50, 'item4314');
+INSERT INTO items VALUES (4315, 1, 4.75, 'item4315');
+INSERT INTO items VALUES (4316, 2, 5.00, 'item4316');
+INSERT INTO items VALUES (4317, 0, 5.25, 'item4317');
+INSERT INTO items VALUES (4318, 1, 5.50, 'item4318');
+INSERT INTO items VALUES (4319, 2, 5.75, 'item4319');
+INSERT INTO items VALUES (4320, 0, 6.00, 'item4320');
+INSERT INTO items VALUES (4321, 1, 6.25, 'item4321');
+INSERT INTO items VALUES (4322, 2, 6.50, 'item4322');
+INSERT INTO items VALUES (4323, 0, 6.75, 'item4323');
+INSERT INTO items VALUES (4324, 1, 7.00, 'item4324');
+INSERT INTO items VALUES (4325, 2, 7.25, 'item4325');
+INSERT INTO items VALUES (4326, 0, 7.50, 'item4326');
+INSERT INTO items VALUES (4327, 1, 7.75, 'item4327');
+INSERT INTO items VALUES (4328, 2, 8.00, 'item4328');
+INSERT INTO items VALUES (4329, 0, 8.25, 'item4329');
+INSERT INTO items VALUES (4330, 1, 8.50, 'item4330');
+INSERT INTO items VALUES (4331, 2, 8.75, 'item4331');
+INSERT INTO items VALUES (4332, 0, 9.00, 'item4332');
+INSERT INTO items VALUES (4333, 1, 9.25, 'item4333');
+INSERT INTO items VALUES (4334, 2, 9.50, 'item4334');
+INSERT INTO items VALUES (4335, 0, 9.75, 'item4335');
+INSERT INTO items VALUES (4336, 1, 10.00, 'item4336');
+INSERT INTO items VALUES (4337, 2, 10.25, 'item4337');
+INSERT INTO items VALUES (4338, 0, 10.50, 'item4338');
+INSERT INTO items VALUES (4339, 1, 10.75, 'item4339');
+INSERT INTO items VALUES (4340, 2, 11.00, 'item4340');
+INSERT INTO items VALUES (4341, 0, 11.25, 'item4341');
+INSERT INTO items VALUES (4342, 1, 11.50, 'item4342');
+INSERT INTO items VALUES (4343, 2, 11.75, 'item4343');
+INSERT INTO items VALUES (4344, 0, 12.00, 'item4344');
+INSERT INTO items VALUES (4345, 1, 12.25, 'item4345');
+INSERT INTO items VALUES (4346, 2, 12.50, 'item4346');
+INSERT INTO items VALUES (4347, 0, 12.75, 'item4347');
+INSERT INTO items VALUES (4348, 1, 13.00, 'item4348');
+INSERT INTO items VALUES (4349, 2, 13.25, 'item4349');
+INSERT INTO items VALUES (4350, 0, 1.00, 'item4350');
+INSERT INTO items VALUES (4351, 1, 1.25, 'item4351');
+INSERT INTO items VALUES (4352, 2, 1.50, 'item4352');
+INSERT INTO items VALUES (4353, 0, 1.75, 'item4353');
+INSERT INTO items VALUES (4354, 1, 2.00, 'item4354');
+INSERT INTO items VALUES (4355, 2, 2.25, 'item4355');
+INSERT INTO items VALUES (4356, 0, 2.50, 'item4356');
+INSERT INTO items VALUES (4357, 1, 2.75, 'item4357');
+INSERT INTO items VALUES (4358, 2, 3.00, 'item4358');
+INSERT INTO items VALUES (4359, 0, 3.25, 'item4359');
+INSERT INTO items VALUES (4360, 1, 3.50, 'item4360');
+INSERT INTO items VALUES (4361, 2, 3.75, 'item4361');
+INSERT INTO items VALUES (4362, 0, 4.00, 'item4362');
+INSERT INTO items VALUES (4363, 1, 4.25, 'item4363');
+INSERT INTO items VALUES (4364, 2, 4.50, 'item4364');
+INSERT INTO items VALUES (4365, 0, 4.75, 'item4365');
+INSERT INTO items VALUES (4366, 1, 5.00, 'item4366');
+INSERT INTO items VALUES (4367, 2, 5.25, 'item4367');
+INSERT INTO items VALUES (4368, 0, 5.50, 'item4368');
+INSERT INTO items VALUES (4369, 1, 5.75, 'item4369');
+INSERT INTO items VALUES (4370, 2, 6.00, 'item4370');
+INSERT INTO items VALUES (4371, 0, 6.25, 'item4371');
+INSERT INTO items VALUES (4372, 1, 6.50, 'item4372');
+INSERT INTO items VALUES (4373, 2, 6.75, 'item4373');
+INSERT INTO items VALUES (4374, 0, 7.00, 'item4374');
+INSERT INTO items VALUES (4375, 1, 7.25, 'item4375');
+INSERT INTO items VALUES (4376, 2, 7.50, 'item4376');
+INSERT INTO items VALUES (4377, 0, 7.75, 'item4377');
+INSERT INTO items VALUES (4378, 1, 8.00, 'item4378');
+INSERT INTO items VALUES (4379, 2, 8.25, 'item4379');
+INSERT INTO items VALUES (4380, 0, 8.50, 'item4380');
+INSERT INTO items VALUES (4381, 1, 8.75, 'item4381');
+INSERT INTO items VALUES (4382, 2, 9.00, 'item4382');
+INSERT INTO items VALUES (4383, 0, 9.25, 'item4383');
+INSERT INTO items VALUES (4384, 1, 9.50, 'item4384');
+INSERT INTO items VALUES (4385, 2, 9.75, 'item4385');
+INSERT INTO items VALUES (4386, 0, 10.00, 'item4386');
+INSERT INTO items VALUES (4387, 1, 10.25, 'item4387');
+INSERT INTO items VALUES (4388, 2, 10.50, 'item4388');
+INSERT INTO items VALUES (4389, 0, 10.75, 'item4389');
+INSERT INTO items VALUES (4390, 1, 11.00, 'item4390');
+INSERT INTO items VALUES (4391, 2, 11.25, 'item4391');
+INSERT INTO items VALUES (4392, 0, 11.50, 'item4392');
+INSERT INTO items VALUES (4393, 1, 11.75, 'item4393');
+INSERT INTO items VALUES (4394, 2, 12.00, 'item4394');
+INSERT INTO items VALUES (4395, 0, 12.25, 'item4395');
+INSERT INTO items VALUES (4396, 1, 12.50, 'item4396');
+INSERT INTO items VALUES (4397, 2, 12.75, 'item4397');
+INSERT INTO items VALUES (4398, 0, 13.00, 'item4398');
+INSERT INTO items VALUES (4399, 1, 13.25, 'item4399');
+INSERT INTO items VALUES (4400, 2, 1.00, 'item4400');
+INSERT INTO items VALUES (4401, 0, 1.25, 'item4401');
+INSERT INTO items VALUES (4402, 1, 1.50, 'item4402');
+INSERT INTO items VALUES (4403, 2, 1.75, 'item4403');
+INSERT INTO items VALUES (4404, 0, 2.00, 'item4404');
+INSERT INTO items VALUES (4405, 1, 2.25, 'item4405');
+INSERT INTO items VALUES (4406, 2, 2.50, 'item4406');
+INSERT INTO items VALUES (4407, 0, 2.75, 'item4407');
+INSERT INTO items VALUES (4408, 1, 3.00, 'item4408');
+INSERT INTO items VALUES (4409, 2, 3.25, 'item4409');
+INSERT INTO items VALUES (4410, 0, 3.50, 'item4410');
+INSERT INTO items VALUES (4411, 1, 3.75, 'item4411');
+INSERT INTO items VALUES (4412, 2, 4.00, 'item4412');
+INSERT INTO items VALUES (4413, 0, 4.25, 'item4413');
+INSERT INTO items VALUES (4414, 1, 4.50, 'item4414');
+INSERT INTO items VALUES (4415, 2, 4.75, 'item4415');
+INSERT INTO items VALUES (4416, 0, 5.00, 'item4416');
+INSERT INTO items VALUES (4417, 1, 5.25, 'item4417');
+INSERT INTO items VALUES (4418, 2, 5.50, 'item4418');
+INSERT INTO items VALUES (4419, 0, 5.75, 'item4419');
+INSERT INTO items VALUES (4420, 1, 6.00, 'item4420');
+INSERT INTO items VALUES (4421, 2, 6.25, 'item4421');
+INSERT INTO items VALUES (4422, 0, 6.50, 'item4422');
+INSERT INTO items VALUES (4423, 1, 6.75, 'item4423');
+INSERT INTO items VALUES (4424, 2, 7.00, 'item4424');
+INSERT INTO items VALUES (4425, 0, 7.25, 'item4425');
+INSERT INTO items VALUES (4426, 1, 7.50, 'item4426');
+INSERT INTO items VALUES (4427, 2, 7.75, 'item4427');
+INSERT INTO items VALUES (4428, 0, 8.00, 'item4428');
+INSERT INTO items VALUES (4429, 1, 8.25, 'item4429');
+INSERT INTO items VALUES (4430, 2, 8.50, 'item4430');
+INSERT INTO items VALUES (4431, 0, 8.75, 'item4431');
+INSERT INTO items VALUES (4432, 1, 9.00, 'item4432');
+INSERT INTO items VALUES (4433, 2, 9.25, 'item4433');
+INSERT INTO items VALUES (4434, 0, 9.50, 'item4434');
+INSERT INTO items VALUES (4435, 1, 9.75, 'item4435');
+INSERT INTO items VALUES (4436, 2, 10.00, 'item4436');
+INSERT INTO items VALUES (4437, 0, 10.25, 'item4437');
+INSERT INTO items VALUES (4438, 1, 10.50, 'item4438');
+INSERT INTO items VALUES (4439, 2, 10.75, 'item4439');
+INSERT INTO items VALUES (4440, 0, 11.00, 'item4440');
+INSERT INTO items VALUES (4441, 1, 11.25, 'item4441');
+INSERT INTO items VALUES (4442, 2, 11.50, 'item4442');
+INSERT INTO items VALUES (4443, 0, 11.75, 'item4443');
+INSERT INTO items VALUES (4444, 1, 12.00, 'item4444');
+INSERT INTO items VALUES (4445, 2, 12.25, 'item4445');
+INSERT INTO items VALUES (4446, 0, 12.50, 'item4446');
+INSERT INTO items VALUES (4447, 1, 12.75, 'item4447');
+INSERT INTO items VALUES (4448, 2, 13.00, 'item4448');
+INSERT INTO items VALUES (4449, 0, 13.25, 'item4449');
+INSERT INTO items VALUES (4450, 1, 1.00, 'item4450');
+INSERT INTO items VALUES (4451, 2, 1.25, 'item4451');
+INSERT INTO items VALUES (4452, 0, 1.50, 'item4452');
+INSERT INTO items VALUES (4453, 1, 1.75, 'item4453');
+INSERT INTO items VALUES (4454, 2, 2.00, 'item4454');
+INSERT INTO items VALUES (4455, 0, 2.25, 'item4455');
+INSERT INTO items VALUES (4456, 1, 2.50, 'item4456');
+INSERT INTO items VALUES (4457, 2, 2.75, 'item4457');
+INSERT INTO items VALUES (4458, 0, 3.00, 'item4458');
+INSERT INTO items VALUES (4459, 1, 3.25, 'item4459');
+INSERT INTO items VALUES (4460, 2, 3.50, 'item4460');
+INSERT INTO items VALUES (4461, 0, 3.75, 'item4461');
+INSERT INTO items VALUES (4462, 1, 4.00, 'item4462');
+INSERT INTO items VALUES (4463, 2, 4.25, 'item4463');
+INSERT INTO items VALUES (4464, 0, 4.50, 'item4464');
+INSERT INTO items VALUES (4465, 1, 4.75, 'item4465');
+INSERT INTO items VALUES (4466, 2, 5.00, 'item4466');
+INSERT INTO items VALUES (4467, 0, 5.25, 'item4467');
+INSERT INTO items VALUES (4468, 1, 5.50, 'item4468');
+INSERT INTO items VALUES (4469, 2, 5.75, 'item4469');
+INSERT INTO items VALUES (4470, 0, 6.00, 'item4470');
+INSERT INTO items VALUES (4471, 1, 6.25, 'item4471');
+INSERT INTO items VALUES (4472, 2, 6.50, 'item4472');
+INSERT INTO items VALUES (4473, 0, 6.75, 'item4473');
+INSERT INTO items VALUES (4474, 1, 7.00, 'item4474');
+INSERT INTO items VALUES (4475, 2, 7.25, 'item4475');
+INSERT INTO items VALUES (4476, 0, 7.50, 'item4476');
+INSERT INTO items VALUES (4477, 1, 7.75, 'item4477');
+INSERT INTO items VALUES (4478, 2, 8.00, 'item4478');
+INSERT INTO items VALUES (4479, 0, 8.25, 'item4479');
+INSERT INTO items VALUES (4480, 1, 8.50, 'item4480');
+INSERT INTO items VALUES (4481, 2, 8.75, 'item4481');
+INSERT INTO items VALUES (4482, 0, 9.00, 'item4482');
+INSERT INTO items VALUES (4483, 1, 9.25, 'item4483');
+INSERT INTO items VALUES (4484, 2, 9.50, 'item4484');
+INSERT INTO items VALUES (4485, 0, 9.75, 'item4485');
+INSERT INTO items VALUES (4486, 1, 10.00, 'item4486');
+INSERT INTO items VALUES (4487, 2, 10.25, 'item4487');
+INSERT INTO items VALUES (4488, 0, 10.50, 'item4488');
+INSERT INTO items VALUES (4489, 1, 10.75, 'item4489');
+INSERT INTO items VALUES (4490, 2, 11.00, 'item4490');
+INSERT INTO items VALUES (4491, 0, 11.25, 'item4491');
+INSERT INTO items VALUES (4492, 1, 11.50, 'item4492');
+INSERT INTO items VALUES (4493, 2, 11.75, 'item4493');
+INSERT INTO items VALUES (4494, 0, 12.00, 'item4494');
+INSERT INTO items VALUES (4495, 1, 12.25, 'item4495');
+INSERT INTO items VALUES (4496, 2, 12.50, 'item4496');
+INSERT INTO items VALUES (4497, 0, 12.75, 'item4497');
+INSERT INTO items VALUES (4498, 1, 13.00, 'item4498');
+INSERT INTO items VALUES (4499, 2, 13.25, 'item4499');
+INSERT INTO items VALUES (4500, 0, 1.00, 'item4500');
+INSERT INTO items VALUES (4501, 1, 1.25, 'item4501');
+INSERT INTO items VALUES (4502, 2, 1.50, 'item4502');
+INSERT INTO items VALUES (4503, 0, 1.75, 'item4503');
+INSERT INTO items VALUES (4504, 1, 2.00, 'item4504');
+INSERT INTO items VALUES (4505, 2, 2.25, 'item4505');
+INSERT INTO items VALUES (4506, 0, 2.50, 'item4506');
+INSERT INTO items VALUES (4507, 1, 2.75, 'item4507');
+INSERT INTO items VALUES (4508, 2, 3.00, 'item4508');
+INSERT INTO items VALUES (4509, 0, 3.25, 'item4509');
+INSERT INTO items VALUES (4510, 1, 3.50, 'item4510');
+INSERT INTO items VALUES (4511, 2, 3.75, 'item4511');
+INSERT INTO items VALUES (4512, 0, 4.00, 'item4512');
+INSERT INTO items VALUES (4513, 1, 4.25, 'item4513');
+INSERT INTO items VALUES (4514, 2, 4.50, 'item4514');
+INSERT INTO items VALUES (4515, 0, 4.75, 'item4515');
+INSERT INTO items VALUES (4516, 1, 5.00, 'item4516');
+INSERT INTO items VALUES (4517, 2, 5.25, 'item4517');
+INSERT INTO items VALUES (4518, 0, 5.50, 'item4518');
+INSERT INTO items VALUES (4519, 1, 5.75, 'item4519');
+INSERT INTO items VALUES (4520, 2, 6.00, 'item4520');
+INSERT INTO items VALUES (4521, 0, 6.25, 'item4521');
+INSERT INTO items VALUES (4522, 1, 6.50, 'item4522');
+INSERT INTO items VALUES (4523, 2, 6.75, 'item4523');
+INSERT INTO items VALUES (4524, 0, 7.00, 'item4524');
+INSERT INTO items VALUES (4525, 1, 7.25, 'item4525');
+INSERT INTO items VALUES (4526, 2, 7.50, 'item4526');
+INSERT INTO items VALUES (4527, 0, 7.75, 'item4527');
+INSERT INTO items VALUES (4528, 1, 8.00, 'item4528');
+INSERT INTO items VALUES (4529, 2, 8.25, 'item4529');
+INSERT INTO items VALUES (4530, 0, 8.50, 'item4530');
+INSERT INTO items VALUES (4531, 1, 8.75, 'item4531');
+INSERT INTO items VALUES (4532, 2, 9.00, 'item4532');
+INSERT INTO items VALUES (4533, 0, 9.25, 'item4533');
+INSERT INTO items VALUES (4534, 1, 9.50, 'item4534');
+INSERT INTO items VALUES (4535, 2, 9.75, 'item4535');
+INSERT INTO items VALUES (4536, 0, 10.00, 'item4536');
+INSERT INTO items VALUES (4537, 1, 10.25, 'item4537');
+INSERT INTO items VALUES (4538, 2, 10.50, 'item4538');
+INSERT INTO items VALUES (4539, 0, 10.75, 'item4539');
+INSERT INTO items VALUES (4540, 1, 11.00, 'item4540');
+INSERT INTO items VALUES (4541, 2, 11.25, 'item4541');
+INSERT INTO items VALUES (4542, 0, 11.50, 'item4542');
+INSERT INTO items VALUES (4543, 1, 11.75, 'item4543');
+INSERT INTO items VALUES (4544, 2, 12.00, 'item4544');
+INSERT INTO items VALUES (4545, 0, 12.25, 'item4545');
+INSERT INTO items VALUES (4546, 1, 12.50, 'item4546');
+INSERT INTO items VALUES (4547, 2, 12.75, 'item4547');
+INSERT INTO items VALUES (4548, 0, 13.00, 'item4548');
+INSERT INTO items VALUES (4549, 1, 13.25, 'item4549');
+INSERT INTO items VALUES (4550, 2, 1.00, 'item4550');
+INSERT INTO items VALUES (4551, 0, 1.25, 'item4551');
+INSERT INTO items VALUES (4552, 1, 1.50, 'item4552');
+INSERT INTO items VALUES (4553, 2, 1.75, 'item4553');
+INSERT INTO items VALUES (4554, 0, 2.00, 'item4554');
+INSERT INTO items VALUES (4555, 1, 2.25, 'item4555');
+INSERT INTO items VALUES (4556, 2, 2.50, 'item4556');
+INSERT INTO items VALUES (4557, 0, 2.75, 'item4557');
+INSERT INTO items VALUES (4558, 1, 3.00, 'item4558');
+INSERT INTO items VALUES (4559, 2, 3.25, 'item4559');
+INSERT INTO items VALUES (4560, 0, 3.50, 'item4560');
+INSERT INTO items VALUES (4561, 1, 3.75, 'item4561');
+INSERT INTO items VALUES (4562, 2, 4.00, 'item4562');
+INSERT INTO items VALUES (4563, 0, 4.25, 'item4563');
+INSERT INTO items VALUES (4564, 1, 4.50, 'item4564');
+INSERT INTO items VALUES (4565, 2, 4.75, 'item4565');
+INSERT INTO items VALUES (4566, 0, 5.00, 'item4566');
+INSERT INTO items VALUES (4567, 1, 5.25, 'item4567');
+INSERT INTO items VALUES (4568, 2, 5.50, 'item4568');
+INSERT INTO items VALUES (4569, 0, 5.75, 'item4569');
+INSERT INTO items VALUES (4570, 1, 6.00, 'item4570');
+INSERT INTO items VALUES (4571, 2, 6.25, 'item4571');
+INSERT INTO items VALUES (4572, 0, 6.50, 'item4572');
+INSERT INTO items VALUES (4573, 1, 6.75, 'item4573');
+INSERT INTO items VALUES (4574, 2, 7.00, 'item4574');
+INSERT INTO items VALUES (4575, 0, 7.25, 'item4575');
+INSERT INTO items VALUES (4576, 1, 7.50, 'item4576');
+INSERT INTO items VALUES (4577, 2, 7.75, 'item4577');
+INSERT INTO items VALUES (4578, 0, 8.00, 'item4578');
+INSERT INTO items VALUES (4579, 1, 8.25, 'item4579');
+INSERT INTO items VALUES (4580, 2, 8.50, 'item4580');
+INSERT INTO items VALUES (4581, 0, 8.75, 'item4581');
+INSERT INTO items VALUES (4582, 1, 9.00, 'item4582');
+INSERT INTO items VALUES (4583, 2, 9.25, 'item4583');
+INSERT INTO items VALUES (4584, 0, 9.50, 'item4584');
+INSERT INTO items VALUES (4585, 1, 9.75, 'item4585');
+INSERT INTO items VALUES (4586, 2, 10.00, 'item4586');
+INSERT INTO items VALUES (4587, 0, 10.25, 'item4587');
+INSERT INTO items VALUES (4588, 1, 10.50, 'item4588');
+INSERT INTO items VALUES (4589, 2, 10.75, 'item4589');
+INSERT INTO items VALUES (4590, 0, 11.00, 'item4590');
+INSERT INTO items VALUES (4591, 1, 11.25, 'item4591');
+INSERT INTO items VALUES (4592, 2, 11.50, 'item4592');
+INSERT INTO items VALUES (4593, 0, 11.75, 'item4593');
+INSERT INTO items VALUES (4594, 1, 12.00, 'item4594');
+INSERT INTO items VALUES (4595, 2, 12.25, 'item4595');
+INSERT INTO items VALUES (4596, 0, 12.50, 'item4596');
+INSERT INTO items VALUES (4597, 1, 12.75, 'item4597');
+INSERT INTO items VALUES (4598, 2, 13.00, 'item4598');
+INSERT INTO items VALUES (4599, 0, 13.25, 'item4599');
+INSERT INTO items VALUES (4600, 1, 1.00, 'item4600');
+INSERT INTO items VALUES (4601, 2, 1.25, 'item4601');
+INSERT INTO items VALUES (4602, 0, 1.50, 'item4602');
+INSERT INTO items VALUES (4603, 1, 1.75, 'item4603');
+INSERT INTO items VALUES (4604, 2, 2.00, 'item4604');
+INSERT INTO items VALUES (4605, 0, 2.25, 'item4605');
+INSERT INTO items VALUES (4606, 1, 2.50, 'item4606');
+INSERT INTO items VALUES (4607, 2, 2.75, 'item4607');
+INSERT INTO items VALUES (4608, 0, 3.00, 'item4608');
+INSERT INTO items VALUES (4609, 1, 3.25, 'item4609');
+INSERT INTO items VALUES (4610, 2, 3.50, 'item4610');
+INSERT INTO items VALUES (4611, 0, 3.75, 'item4611');
+INSERT INTO items VALUES (4612, 1, 4.00, 'item4612');
+INSERT INTO items VALUES (4613, 2, 4.25, 'item4613');
+INSERT INTO items VALUES (4614, 0, 4.50, 'item4614');
+INSERT INTO items VALUES (4615, 1, 4.75, 'item4615');
+INSERT INTO items VALUES (4616, 2, 5.00, 'item4616');
+INSERT INTO items VALUES (4617, 0, 5.25, 'item4617');
+INSERT INTO items VALUES (4618, 1, 5.50, 'item4618');
+INSERT INTO items VALUES (4619, 2, 5.75, 'item4619');
+INSERT INTO items VALUES (4620, 0, 6.00, 'item4620');
+INSERT INTO items VALUES (4621, 1, 6.25, 'item4621');
+INSERT INTO items VALUES (4622, 2, 6.50, 'item4622');
+INSERT INTO items VALUES (4623, 0, 6.75, 'item4623');
+INSERT INTO items VALUES (4624, 1, 7.00, 'item4624');
+INSERT INTO items VALUES (4625, 2, 7.25, 'item4625');
+INSERT INTO items VALUES (4626, 0, 7.50, 'item4626');
+INSERT INTO items VALUES (4627, 1, 7.75, 'item4627');
+INSERT INTO items VALUES (4628, 2, 8.00, 'item4628');
+INSERT INTO items VALUES (4629, 0, 8.25, 'item4629');
+INSERT INTO items VALUES (4630, 1, 8.50, 'item4630');
+INSERT INTO items VALUES (4631, 2, 8.75, 'item4631');
+INSERT INTO items VALUES (4632, 0, 9.00, 'item4632');
+INSERT INTO items VALUES (4633, 1, 9.25, 'item4633');
+INSERT INTO items VALUES (4634, 2, 9.50, 'item4634');
+INSERT INTO items VALUES (4635, 0, 9.75, 'item4635');
+INSERT INTO items VALUES (4636, 1, 10.00, 'item4636');
+INSERT INTO items VALUES (4637, 2, 10.25, 'item4637');
+INSERT INTO items VALUES (4638, 0, 10.50, 'item4638');
+INSERT INTO items VALUES (4639, 1, 10.75, 'item4639');
+INSERT INTO items VALUES (4640, 2, 11.00, 'item4640');
+INSERT INTO items VALUES (4641, 0, 11.25, 'item4641');
+INSERT INTO items VALUES (4642, 1, 11.50, 'item4642');
+INSERT INTO items VALUES (4643, 2, 11.75, 'item4643');
+INSERT INTO items VALUES (4644, 0, 12.00, 'item4644');
+INSERT INTO items VALUES (4645, 1, 12.25, 'item4645');
+INSERT INTO items VALUES (4646, 2, 12.50, 'item4646');
+INSERT INTO items VALUES (4647, 0, 12.75, 'item4647');
+INSERT INTO items VALUES (4648, 1, 13.00, 'item4648');
+INSERT INTO items VALUES (4649, 2, 13.25, 'item4649');
+INSERT INTO items VALUES (4650, 0, 1.00, 'item4650');
+INSERT INTO items VALUES (4651, 1, 1.25, 'item4651');
+INSERT INTO items VALUES (4652, 2, 1.50, 'item4652');
+INSERT INTO items VALUES (4653, 0, 1.75, 'item4653');
+INSERT INTO items VALUES (4654, 1, 2.00, 'item4654');
+INSERT INTO items VALUES (4655, 2, 2.25, 'item4655');
+INSERT INTO items VALUES (4656, 0, 2.50, 'item4656');
+INSERT INTO items VALUES (4657, 1, 2.75, 'item4657');
+INSERT INTO items VALUES (4658, 2, 3.00, 'item4658');
+INSERT INTO items VALUES (4659, 0, 3.25, 'item4659');
+INSERT INTO items VALUES (4660, 1, 3.50, 'item4660');
+INSERT INTO items VALUES (4661, 2, 3.75, 'item4661');
+INSERT INTO items VALUES (4662, 0, 4.00, 'item4662');
+INSERT INTO items VALUES (4663, 1, 4.25, 'item4663');
+INSERT INTO items VALUES (4664, 2, 4.50, 'item4664');
+INSERT INTO items VALUES (4665, 0, 4.75, 'item4665');
+INSERT INTO items VALUES (4666, 1, 5.00, 'item4666');
+INSERT INTO items VALUES (4667, 2, 5.25, 'item4667');
+INSERT INTO items VALUES (4668, 0, 5.50, 'item4668');
+INSERT INTO items VALUES (4669, 1, 5.75, 'item4669');
+INSERT INTO items VALUES (4670, 2, 6.00, 'item4670');
+INSERT INTO items VALUES (4671, 0, 6.25, 'item4671');
+INSERT INTO items VALUES (4672, 1, 6.50, 'item4672');
+INSERT INTO items VALUES (4673, 2, 6.75, 'item4673');
+INSERT INTO items VALUES (4674, 0, 7.00, 'item4674');
+INSERT INTO items VALUES (4675, 1, 7.25, 'item4675');
+INSERT INTO items VALUES (4676, 2, 7.50, 'item4676');
+INSERT INTO items VALUES (4677, 0, 7.75, 'item4677');
+INSERT INTO items VALUES (4678, 1, 8.00, 'item4678');
+INSERT INTO items VALUES (4679, 2, 8.25, 'item4679');
+INSERT INTO items VALUES (4680, 0, 8.50, 'item4680');
+INSERT INTO items VALUES (4681, 1, 8.75, 'item4681');
+INSERT INTO items VALUES (4682, 2, 9.00, 'item4682');
+INSERT INTO items VALUES (4683, 0, 9.25, 'item4683');
+INSERT INTO items VALUES (4684, 1, 9.50, 'item4684');
+INSERT INTO items VALUES (4685, 2, 9.75, 'item4685');
+INSERT INTO items VALUES (4686, 0, 10.00, 'item4686');
+INSERT INTO items VALUES (4687, 1, 10.25, 'item4687');
+INSERT INTO items VALUES (4688, 2, 10.50, 'item4688');
+INSERT INTO items VALUES (4689, 0, 10.75, 'item4689');
+INSERT INTO items VALUES (4690, 1, 11.00, 'item4690');
+INSERT INTO items VALUES (4691, 2, 11.25, 'item4691');
+INSERT INTO items VALUES (4692, 0, 11.50, 'item4692');
+INSERT INTO items VALUES (4693, 1, 11.75, 'item4693');
+INSERT INTO items VALUES (4694, 2, 12.00, 'item4694');
+INSERT INTO items VALUES (4695, 0, 12.25, 'item4695');
+INSERT INTO items VALUES (4696, 1, 12.50, 'item4696');
+INSERT INTO items VALUES (4697, 2, 12.75, 'item4697');
+INSERT INTO items VALUES (4698, 0, 13.00, 'item4698');
+INSERT INTO items VALUES (4699, 1, 13.25, 'item4699');
+INSERT INTO items VALUES (4700, 2, 1.00, 'item4700');
+INSERT INTO items VALUES (4701, 0, 1.25, 'item4701');
+INSERT INTO items VALUES (4702, 1, 1.50, 'item4702');
+INSERT INTO items VALUES (4703, 2, 1.75, 'item4703');
+INSERT INTO items VALUES (4704, 0, 2.00, 'item4704');
+INSERT INTO items VALUES (4705, 1, 2.25, 'item4705');
+INSERT INTO items VALUES (4706, 2, 2.50, 'item4706');
+INSERT INTO items VALUES (4707, 0, 2.75, 'item4707');
+INSERT INTO items VALUES (4708, 1, 3.00, 'item4708');
+INSERT INTO items VALUES (4709, 2, 3.25, 'item4709');
+INSERT INTO items VALUES (4710, 0, 3.50, 'item4710');
+INSERT INTO items VALUES (4711, 1, 3.75, 'item4711');
+INSERT INTO items VALUES (4712, 2, 4.00, 'item4712');
+INSERT INTO items VALUES (4713, 0, 4.25, 'item4713');
+INSERT INTO items VALUES (4714, 1, 4.50, 'item4714');
+INSERT INTO items VALUES (4715, 2, 4.75, 'item4715');
+INSERT INTO items VALUES (4716, 0, 5.00, 'item4716');
+INSERT INTO items VALUES (4717, 1, 5.25, 'item4717');
+INSERT INTO items VALUES (4718, 2, 5.50, 'item4718');
+INSERT INTO items VALUES (4719, 0, 5.75, 'item4719');
+INSERT INTO items VALUES (4720, 1, 6.00, 'item4720');
+INSERT INTO items VALUES (4721, 2, 6.25, 'item4721');
+INSERT INTO items VALUES (4722, 0, 6.50, 'item4722');
+INSERT INTO items VALUES (4723, 1, 6.75, 'item4723');
+INSERT INTO items VALUES (4724, 2, 7.00, 'item4724');
+INSERT INTO items VALUES (4725, 0, 7.25, 'item4725');
+INSERT INTO items VALUES (4726, 1, 7.50, 'item4726');
+INSERT INTO items VALUES (4727, 2, 7.75, 'item4727');
+INSERT INTO items VALUES (4728, 0, 8.00, 'item4728');
+INSERT INTO items VALUES (4729, 1, 8.25, 'item4729');
+INSERT INTO items VALUES (4730, 2, 8.50, 'item4730');
+INSERT INTO items VALUES (4731, 0, 8.75, 'item4731');
+INSERT INTO items VALUES (4732, 1, 9.00, 'item4732');
+INSERT INTO items VALUES (4733, 2, 9.25, 'item4733');
+INSERT INTO items VALUES (4734, 0, 9.50, 'item4734');
+INSERT INTO items VALUES (4735, 1, 9.75, 'item4735');
+INSERT INTO items VALUES (4736, 2, 10.00, 'item4736');
+INSERT INTO items VALUES (4737, 0, 10.25, 'item4737');
+INSERT INTO items VALUES (4738, 1, 10.50, 'item4738');
+INSERT INTO items VALUES (4739, 2, 10.75, 'item4739');
+INSERT INTO items VALUES (4740, 0, 11.00, 'item4740');
+INSERT INTO items VALUES (4741, 1, 11.25, 'item4741');
+INSERT INTO items VALUES (4742, 2, 11.50, 'item4742');
+INSERT INTO items VALUES (4743, 0, 11.75, 'item4743');
+INSERT INTO items VALUES (4744, 1, 12.00, 'item4744');
+INSERT INTO items VALUES (4745, 2, 12.25, 'item4745');
+INSERT INTO items VALUES (4746, 0, 12.50, 'item4746');
+INSERT INTO items VALUES (4747, 1, 12.75, 'item4747');
+INSERT INTO items VALUES (4748, 2, 13.00, 'item4748');
+INSERT INTO items VALUES (4749, 0, 13.25, 'item4749');
+INSERT INTO items VALUES (4750, 1, 1.00, 'item4750');
+INSERT INTO items VALUES (4751, 2, 1.25, 'item4751');
+INSERT INTO items VALUES (4752, 0, 1.50, 'item4752');
+INSERT INTO items VALUES (4753, 1, 1.75, 'item4753');
+INSERT INTO items VALUES (4754, 2, 2.00, 'item4754');
+INSERT INTO items VALUES (4755, 0, 2.25, 'item4755');
+INSERT INTO items VALUES (4756, 1, 2.50, 'item4756');
+INSERT INTO items VALUES (4757, 2, 2.75, 'item4757');
+INSERT INTO items VALUES (4758, 0, 3.00, 'item4758');
+INSERT INTO items VALUES (4759, 1, 3.25, 'item4759');
+INSERT INTO items VALUES (4760, 2, 3.50, 'item4760');
+INSERT INTO items VALUES (4761, 0, 3.75, 'item4761');
+INSERT INTO items VALUES (4762, 1, 4.00, 'item4762');
+INSERT INTO items VALUES (4763, 2, 4.25, 'item4763');
+INSERT INTO items VALUES (4764, 0, 4.50, 'item4764');
+INSERT INTO items VALUES (4765, 1, 4.75, 'item4765');
+INSERT INTO items VALUES (4766, 2, 5.00, 'item4766');
+INSERT INTO items VALUES (4767, 0, 5.25, 'item4767');
+INSERT INTO items VALUES (4768, 1, 5.50, 'item4768');
+INSERT INTO items VALUES (4769, 2, 5.75, 'item4769');
+INSERT INTO items VALUES (4770, 0, 6.00, 'item4770');
+INSERT INTO items VALUES (4771, 1, 6.25, 'item4771');
+INSERT INTO items VALUES (4772, 2, 6.50, 'item4772');
+INSERT INTO items VALUES (4773, 0, 6.75, 'item4773');
+INSERT INTO items VALUES (4774, 1, 7.00, 'item4774');
+INSERT INTO items VALUES (4775, 2, 7.25, 'item4775');
+INSERT INTO items VALUES (4776, 0, 7.50, 'item4776');
+INSERT INTO items VALUES (4777, 1, 7.75, 'item4777');
+INSERT INTO items VALUES (4778, 2, 8.00, 'item4778');
+INSERT INTO items VALUES (4779, 0, 8.25, 'item4779');
+INSERT INTO items VALUES (4780, 1, 8.50, 'item4780');
+INSERT INTO items VALUES (4781, 2, 8.75, 'item4781');
+INSERT INTO items VALUES (4782, 0, 9.00, 'item4782');
+INSERT INTO items VALUES (4783, 1, 9.25, 'item4783');
+INSERT INTO items VALUES (4784, 2, 9.50, 'item4784');
+INSERT INTO items VALUES (4785, 0, 9.75, 'item4785');
+INSERT INTO items VALUES (4786, 1, 10.00, 'item4786');
+INSERT INTO items VALUES (4787, 2, 10.25, 'item4787');
+INSERT INTO items VALUES (4788, 0, 10.50, 'item4788');
+INSERT INTO items VALUES (4789, 1, 10.75, 'item4789');
+INSERT INTO items VALUES (4790, 2, 11.00, 'item4790');
+INSERT INTO items VALUES (4791, 0, 11.25, 'item4791');
+INSERT INTO items VALUES (4792, 1, 11.50, 'item4792');
+INSERT INTO items VALUES (4793, 2, 11.75, 'item4793');
+INSERT INTO items VALUES (4794, 0, 12.00, 'item4794');
+INSERT INTO items VALUES (4795, 1, 12.25, 'item4795');
+INSERT INTO items VALUES (4796, 2, 12.50, 'item4796');
+INSERT INTO items VALUES (4797, 0, 12.75, 'item4797');
+INSERT INTO items VALUES (4798, 1, 13.00, 'item4798');
+INSERT INTO items VALUES (4799, 2, 13.25, 'item4799');
+INSERT INTO items VALUES (4800, 0, 1.00, 'item4800');
+INSERT INTO items VALUES (4801, 1, 1.25, 'item4801');
+INSERT INTO items VALUES (4802, 2, 1.50, 'item4802');
+INSERT INTO items VALUES (4803, 0, 1.75, 'item4803');
+INSERT INTO items VALUES (4804, 1, 2.00, 'item4804');
+INSERT INTO items VALUES (4805, 2, 2.25, 'item4805');
+INSERT INTO items VALUES (4806, 0, 2.50, 'item4806');
+INSERT INTO items VALUES (4807, 1, 2.75, 'item4807');
+INSERT INTO items VALUES (4808, 2, 3.00, 'item4808');
+INSERT INTO items VALUES (4809, 0, 3.25, 'item4809');
+INSERT INTO items VALUES (4810, 1, 3.50, 'item4810');
+INSERT INTO items VALUES (4811, 2, 3.75, 'item4811');
+INSERT INTO items VALUES (4812, 0, 4.00, 'item4812');
+INSERT INTO items VALUES (4813, 1, 4.25, 'item4813');
+INSERT INTO items VALUES (4814, 2, 4.50, 'item4814');
+INSERT INTO items VALUES (4815, 0, 4.75, 'item4815');
+INSERT INTO items VALUES (4816, 1, 5.00, 'item4816');
+INSERT INTO items VALUES (4817, 2, 5.25, 'item4817');
+INSERT INTO items VALUES (4818, 0, 5.50, 'item4818');
+INSERT INTO items VALUES (4819, 1, 5.75, 'item4819');
+INSERT INTO items VALUES (4820, 2, 6.00, 'item4820');
+INSERT INTO items VALUES (4821, 0, 6.25, 'item4821');
+INSERT INTO items VALUES (4822, 1, 6.50, 'item4822');
+INSERT INTO items VALUES (4823, 2, 6.75, 'item4823');
+INSERT INTO items VALUES (4824, 0, 7.00, 'item4824');
+INSERT INTO items VALUES (4825, 1, 7.25, 'item4825');
+INSERT INTO items VALUES (4826, 2, 7.50, 'item4826');
+INSERT INTO items VALUES (4827, 0, 7.75, 'item4827');
+INSERT INTO items VALUES (4828, 1, 8.00, 'item4828');
+INSERT INTO items VALUES (4829, 2, 8.25, 'item4829');
+INSERT INTO items VALUES (4830, 0, 8.50, 'item4830');
+INSERT INTO items VALUES (4831, 1, 8.75, 'item4831');
+INSERT INTO items VALUES (4832, 2, 9.00, 'item4832');
+INSERT INTO items VALUES (4833, 0, 9.25, 'item4833');
+INSERT INTO items VALUES (4834, 1, 9.50, 'item4834');
+INSERT INTO items VALUES (4835, 2, 9.75, 'item4835');
+INSERT INTO items VALUES (4836, 0, 10.00, 'item4836');
+INSERT INTO items VALUES (4837, 1, 10.25, 'item4837');
+INSERT INTO items VALUES (4838, 2, 10.50, 'item4838');
+INSERT INTO items VALUES (4839, 0, 10.75, 'item4839');
+INSERT INTO items VALUES (4840, 1, 11.00, 'item4840');
+INSERT INTO items VALUES (4841, 2, 11.25, 'item4841');
+INSERT INTO items VALUES (4842, 0, 11.50, 'item4842');
+INSERT INTO items VALUES (4843, 1, 11.75, 'item4843');
+INSERT INTO items VALUES (4844, 2, 12.00, 'item4844');
+INSERT INTO items VALUES (4845, 0, 12.25, 'item4845');
+INSERT INTO items VALUES (4846, 1, 12.50, 'item4846');
+INSERT INTO items VALUES (4847, 2, 12.75, 'item4847');
+INSERT INTO items VALUES (4848, 0, 13.00, 'item4848');
+INSERT INTO items VALUES (4849, 1, 13.25, 'item4849');
+INSERT INTO items VALUES (4850, 2, 1.00, 'item4850');
+INSERT INTO items VALUES (4851, 0, 1.25, 'item4851');
+INSERT INTO items VALUES (4852, 1, 1.50, 'item4852');
+INSERT INTO items VALUES (4853, 2, 1.75, 'item4853');
+INSERT INTO items VALUES (4854, 0, 2.00, 'item4854');
+INSERT INTO items VALUES (4855, 1, 2.25, 'item4855');
+INSERT INTO items VALUES (4856, 2, 2.50, 'item4856');
+INSERT INTO items VALUES (4857, 0, 2.75, 'item4857');
+INSERT INTO items VALUES (4858, 1, 3.00, 'item4858');
+INSERT INTO items VALUES (4859, 2, 3.25, 'item4859');
+INSERT INTO items VALUES (4860, 0, 3.50, 'item4860');
+INSERT INTO items VALUES (4861, 1, 3.75, 'item4861');
+INSERT INTO items VALUES (4862, 2, 4.00, 'item4862');
+INSERT INTO items VALUES (4863, 0, 4.25, 'item4863');
+INSERT INTO items VALUES (4864, 1, 4.50, 'item4864');
+INSERT INTO items VALUES (4865, 2, 4.75, 'item4865');
+INSERT INTO items VALUES (4866, 0, 5.00, 'item4866');
+INSERT INTO items VALUES (4867, 1, 5.25, 'item4867');
+INSERT INTO items VALUES (4868, 2, 5.50, 'item4868');
+INSERT INTO items VALUES (4869, 0, 5.75, 'item4869');
+INSERT INTO items VALUES (4870, 1, 6.00, 'item4870');
+INSERT INTO items VALUES (4871, 2, 6.25, 'item4871');
+INSERT INTO items VALUES (4872, 0, 6.50, 'item4872');
+INSERT INTO items VALUES (4873, 1, 6.75, 'item4873');
+INSERT INTO items VALUES (4874, 2, 7.00, 'item4874');
+INSERT INTO items VALUES (4875, 0, 7.25, 'item4875');
+INSERT INTO items VALUES (4876, 1, 7.50, 'item4876');
+INSERT INTO items VALUES (4877, 2, 7.75, 'item4877');
+INSERT INTO items VALUES (4878, 0, 8.00, 'item4878');
+INSERT INTO items VALUES (4879, 1, 8.25, 'item4879');
+INSERT INTO items VALUES (4880, 2, 8.50, 'item4880');
+INSERT INTO items VALUES (4881, 0, 8.75, 'item4881');
+INSERT INTO items VALUES (4882, 1, 9.00, 'item4882');
+INSERT INTO items VALUES (4883, 2, 9.25, 'item4883');
+INSERT INTO items VALUES (4884, 0, 9.50, 'item4884');
+INSERT INTO items VALUES (4885, 1, 9.75, 'item4885');
+INSERT INTO items VALUES (4886, 2, 10.00, 'item4886');
+INSERT INTO items VALUES (4887, 0, 10.25, 'item4887');
+INSERT INTO items VALUES (4888, 1, 10.50, 'item4888');
+INSERT INTO items VALUES (4889, 2, 10.75, 'item4889');
+INSERT INTO items VALUES (4890, 0, 11.00, 'item4890');
+INSERT INTO items VALUES (4891, 1, 11.25, 'item4891');
+INSERT INTO items VALUES (4892, 2, 11.50, 'item4892');
+INSERT INTO items VALUES (4893, 0, 11.75, 'item4893');
+INSERT INTO items VALUES (4894, 1, 12.00, 'item4894');
+INSERT INTO items VALUES (4895, 2, 12.25, 'item4895');
+INSERT INTO items VALUES (4896, 0, 12.50, 'item4896');
+INSERT INTO items VALUES (4897, 1, 12.75, 'item4897');
+INSERT INTO items VALUES (4898, 2, 13.00, 'item4898');
+INSERT INTO items VALUES (4899, 0, 13.25, 'item4899');
+INSERT INTO items VALUES (4900, 1, 1.00, 'item4900');
+INSERT INTO items VALUES (4901, 2, 1.25, 'item4901');
+INSERT INTO items VALUES (4902, 0, 1.50, 'item4902');
+INSERT INTO items VALUES (4903, 1, 1.75, 'item4903');
+INSERT INTO items VALUES (4904, 2, 2.00, 'item4904');
+INSERT INTO items VALUES (4905, 0, 2.25, 'item4905');
+INSERT INTO items VALUES (4906, 1, 2.50, 'item4906');
+INSERT INTO items VALUES (4907, 2, 2.75, 'item4907');
+INSERT INTO items VALUES (4908, 0, 3.00, 'item4908');
+INSERT INTO items VALUES (4909, 1, 3.25, 'item4909');
+INSERT INTO items VALUES (4910, 2, 3.50, 'item4910');
+INSERT INTO items VALUES (4911, 0, 3.75, 'item4911');
+INSERT INTO items VALUES (4912, 1, 4.00, 'item4912');
+INSERT INTO items VALUES (4913, 2, 4.25, 'item4913');
+INSERT INTO items VALUES (4914, 0, 4.50, 'item4914');
+INSERT INTO items VALUES (4915, 1, 4.75, 'item4915');
+INSERT INTO items VALUES (4916, 2, 5.00, 'item4916');
+INSERT INTO items VALUES (4917, 0, 5.25, 'item4917');
+INSERT INTO items VALUES (4918, 1, 5.50, 'item4918');
+INSERT INTO items VALUES (4919, 2, 5.75, 'item4919');
+INSERT INTO items VALUES (4920, 0, 6.00, 'item4920');
+INSERT INTO items VALUES (4921, 1, 6.25, 'item4921');
+INSERT INTO items VALUES (4922, 2, 6.50, 'item4922');
+INSERT INTO items VALUES (4923, 0, 6.75, 'item4923');
+INSERT INTO items VALUES (4924, 1, 7.00, 'item4924');
+INSERT INTO items VALUES (4925, 2, 7.25, 'item4925');
+INSERT INTO items VALUES (4926, 0, 7.50, 'item4926');
+INSERT INTO items VALUES (4927, 1, 7.75, 'item4927');
+INSERT INTO items VALUES (4928, 2, 8.00, 'item4928');
+INSERT INTO items VALUES (4929, 0, 8.25, 'item4929');
+INSERT INTO items VALUES (4930, 1, 8.50, 'item4930');
+INSERT INTO items VALUES (4931, 2, 8.75, 'item4931');
+INSERT INTO items VALUES (4932, 0, 9.00, 'item4932');
+INSERT INTO items VALUES (4933, 1, 9.25, 'item4933');
+INSERT INTO items VALUES (4934, 2, 9.50, 'item4934');
+INSERT INTO items VALUES (4935, 0, 9.75, 'item4935');
+INSERT INTO items VALUES (4936, 1, 10.00, 'item4936');
+INSERT INTO items VALUES (4937, 2, 10.25, 'item4937');
+INSERT INTO items VALUES (4938, 0, 10.50, 'item4938');
+INSERT INTO items VALUES (4939, 1, 10.75, 'item4939');
+INSERT INTO items VALUES (4940, 2, 11.00, 'item4940');
+INSERT INTO items VALUES (4941, 0, 11.25, 'item4941');
+INSERT INTO items VALUES (4942, 1, 11.50, 'item4942');
+INSERT INTO items VALUES (4943, 2, 11.75, 'item4943');
+INSERT INTO items VALUES (4944, 0, 12.00, 'item4944');
+INSERT INTO items VALUES (4945, 1, 12.25, 'item4945');
+INSERT INTO items VALUES (4946, 2, 12.50, 'item4946');
+INSERT INTO items VALUES (4947, 0, 12.75, 'item4947');
+INSERT INTO items VALUES (4948, 1, 13.00, 'item4948');
+INSERT INTO items VALUES (4949, 2, 13.25, 'item4949');
+INSERT INTO items VALUES (4950, 0, 1.00, 'item4950');
+INSERT INTO items VALUES (4951, 1, 1.25, 'item4951');
+INSERT INTO items VALUES (4952, 2, 1.50, 'item4952');
+INSERT INTO items VALUES (4953, 0, 1.75, 'item4953');
+INSERT INTO items VALUES (4954, 1, 2.00, 'item4954');
+INSERT INTO items VALUES (4955, 2, 2.25, 'item4955');
+INSERT INTO items VALUES (4956, 0, 2.50, 'item4956');
+INSERT INTO items VALUES (4957, 1, 2.75, 'item4957');
+INSERT INTO items VALUES (4958, 2, 3.00, 'item4958');
+INSERT INTO items VALUES (4959, 0, 3.25, 'item4959');
+INSERT INTO items VALUES (4960, 1, 3.50, 'item4960');
+INSERT INTO items VALUES (4961, 2, 3.75, 'item4961');
+INSERT INTO items VALUES (4962, 0, 4.00, 'item4962');
+INSERT INTO items VALUES (4963, 1, 4.25, 'item4963');
+INSERT INTO items VALUES (4964, 2, 4.50, 'item4964');
+INSERT INTO items VALUES (4965, 0, 4.75, 'item4965');
+INSERT INTO items VALUES (4966, 1, 5.00, 'item4966');
+INSERT INTO items VALUES (4967, 2, 5.25, 'item4967');
+INSERT INTO items VALUES (4968, 0, 5.50, 'item4968');
+INSERT INTO items VALUES (4969, 1, 5.75, 'item4969');
+INSERT INTO items VALUES (4970, 2, 6.00, 'item4970');
+INSERT INTO items VALUES (4971, 0, 6.25, 'item4971');
+INSERT INTO items VALUES (4972, 1, 6.50, 'item4972');
+INSERT INTO items VALUES (4973, 2, 6.75, 'item4973');
+INSERT INTO items VALUES (4974, 0, 7.00, 'item4974');
+INSERT INTO items VALUES (4975, 1, 7.25, 'item4975');
+INSERT INTO items VALUES (4976, 2, 7.50, 'item4976');
+INSERT INTO items VALUES (4977, 0, 7.75, 'item4977');
+INSERT INTO items VALUES (4978, 1, 8.00, 'item4978');
+INSERT INTO items VALUES (4979, 2, 8.25, 'item4979');
+INSERT INTO items VALUES (4980, 0, 8.50, 'item4980');
+INSERT INTO items VALUES (4981, 1, 8.75, 'item4981');
+INSERT INTO items VALUES (4982, 2, 9.00, 'item4982');
+INSERT INTO items VALUES (4983, 0, 9.25, 'item4983');
+INSERT INTO items VALUES (4984, 1, 9.50, 'item4984');
+INSERT INTO items VALUES (4985, 2, 9.75, 'item4985');
+INSERT INTO items VALUES (4986, 0, 10.00, 'item4986');
+INSERT INTO items VALUES (4987, 1, 10.25, 'item4987');
+INSERT INTO items VALUES (4988, 2, 10.50, 'item4988');
+INSERT INTO items VALUES (4989, 0, 10.75, 'item4989');
+INSERT INTO items VALUES (4990, 1, 11.00, 'item4990');
+INSERT INTO items VALUES (4991, 2, 11.25, 'item4991');
+INSERT INTO items VALUES (4992, 0, 11.50, 'item4992');
+INSERT INTO items VALUES (4993, 1, 11.75, 'item4993');
+INSERT INTO items VALUES (4994, 2, 12.00, 'item4994');
+INSERT INTO items VALUES (4995, 0, 12.25, 'item4995');
+INSERT INTO items VALUES (4996, 1, 12.50, 'item4996');
+INSERT INTO items VALUES (4997, 2, 12.75, 'item4997');
+INSERT INTO items VALUES (4998, 0, 13.00, 'item4998');
+INSERT INTO items VALUES (4999, 1, 13.25, 'item4999');
+INSERT INTO orders VALUES (0, 0, 0);
+INSERT INTO orders VALUES (1, 7, 13);
+INSERT INTO orders VALUES (2, 14, 26);
+INSERT INTO orders VALUES (3, 21, 39);
+INSERT INTO orders VALUES (4, 28, 52);
+INSERT INTO orders VALUES (5, 35, 65);
+INSERT INTO orders VALUES (6, 42, 78);
+INSERT INTO orders VALUES (7, 49, 91);
+INSERT INTO orders VALUES (8, 56, 4);
+INSERT INTO orders VALUES (9, 63, 17);
+INSERT INTO orders VALUES (10, 70, 30);
+INSERT INTO orders VALUES (11, 77, 43);
+INSERT INTO orders VALUES (12, 84, 56);
+INSERT INTO orders VALUES (13, 91, 69);
+INSERT INTO orders VALUES (14, 98, 82);
+INSERT INTO orders VALUES (15, 105, 95);
+INSERT INTO orders VALUES (16, 112, 8);
+INSERT INTO orders VALUES (17, 119, 21);
+INSERT INTO orders VALUES (18, 126, 34);
+INSERT INTO orders VALUES (19, 133, 47);
+INSERT INTO orders VALUES (20, 140, 60);
+INSERT INTO orders VALUES (21, 147, 73);
+INSERT INTO orders VALUES (22, 154, 86);
+INSERT INTO orders VALUES (23, 161, 99);
+INSERT INTO orders VALUES (24, 168, 12);
+INSERT INTO orders VALUES (25, 175, 25);
+INSERT INTO orders VALUES (26, 182, 38);
+INSERT INTO orders VALUES (27, 189, 51);
+INSERT INTO orders VALUES (28, 196, 64);
+INSERT INTO orders VALUES (29, 203, 77);
+INSERT INTO orders VALUES (30, 210, 90);
+INSERT INTO orders VALUES (31, 217, 3);
+INSERT INTO orders VALUES (32, 224, 16);
+INSERT INTO orders VALUES (33, 231, 29);
+INSERT INTO orders VALUES (34, 238, 42);
+INSERT INTO orders VALUES (35, 245, 55);
+INSERT INTO orders VALUES (36, 252, 68);
+INSERT INTO orders VALUES (37, 259, 81);
+INSERT INTO orders VALUES (38, 266, 94);
+INSERT INTO orders VALUES (39, 273, 7);
+INSERT INTO orders VALUES (40, 280, 20);
+INSERT INTO orders VALUES (41, 287, 33);
+INSERT INTO orders VALUES (42, 294, 46);
+INSERT INTO orders VALUES (43, 301, 59);
+INSERT INTO orders VALUES (44, 308, 72);
+INSERT INTO orders VALUES (45, 315, 85);
+INSERT INTO orders VALUES (46, 322, 98);
+INSERT INTO orders VALUES (47, 329, 11);
+INSERT INTO orders VALUES (48, 336, 24);
+INSERT INTO orders VALUES (49, 343, 37);
+INSERT INTO orders VALUES (50, 350, 50);
+INSERT INTO orders VALUES (51, 357, 63);
+INSERT INTO orders VALUES (52, 364, 76);
+INSERT INTO orders VALUES (53, 371, 89);
+INSERT INTO orders VALUES (54, 378, 2);
+INSERT INTO orders VALUES (55, 385, 15);
+INSERT INTO orders VALUES (56, 392, 28);
+INSERT INTO orders VALUES (57, 399, 41);
+INSERT INTO orders VALUES (58, 406, 54);
+INSERT INTO orders VALUES (59, 413, 67);
+INSERT INTO orders VALUES (60, 420, 80);
+INSERT INTO orders VALUES (61, 427, 93);
+INSERT INTO orders VALUES (62, 434, 6);
+INSERT INTO orders VALUES (63, 441, 19);
+INSERT INTO orders VALUES (64, 448, 32);
+INSERT INTO orders VALUES (65, 455, 45);
+INSERT INTO orders VALUES (66, 462, 58);
+INSERT INTO orders VALUES (67, 469, 71);
+INSERT INTO orders VALUES (68, 476, 84);
+INSERT INTO orders VALUES (69, 483, 97);
+INSERT INTO orders VALUES (70, 490, 10);
+INSERT INTO orders VALUES (71, 497, 23);
+INSERT INTO orders VALUES (72, 504, 36);
+INSERT INTO orders VALUES (73, 511, 49);
+INSERT INTO orders VALUES (74, 518, 62);
+INSERT INTO orders VALUES (75, 525, 75);
+INSERT INTO orders VALUES (76, 532, 88);
+INSERT INTO orders VALUES (77, 539, 1);
+INSERT INTO orders VALUES (78, 546, 14);
+INSERT INTO orders VALUES (79, 553, 27);
+INSERT INTO orders VALUES (80, 560, 40);
+INSERT INTO orders VALUES (81, 567, 53);
+INSERT INTO orders VALUES (82, 574, 66);
+INSERT INTO orders VALUES (83, 581, 79);
+INSERT INTO orders VALUES (84, 588, 92);
+INSERT INTO orders VALUES (85, 595, 5);
+INSERT INTO orders VALUES (86, 602, 18);
+INSERT INTO orders VALUES (87, 609, 31);
+INSERT INTO orders VALUES (88, 616, 44);
+INSERT INTO orders VALUES (89, 623, 57);
+INSERT INTO orders VALUES (90, 630, 70);
+INSERT INTO orders VALUES (91, 637, 83);
+INSERT INTO orders VALUES (92, 644, 96);
+INSERT INTO orders VALUES (93, 651, 9);
+INSERT INTO orders VALUES (94, 658, 22);
+INSERT INTO orders VALUES (95, 665, 35);
+INSERT INTO orders VALUES (96, 672, 48);
+INSERT INTO orders VALUES (97, 679, 61);
+INSERT INTO orders VALUES (98, 686, 74);
+INSERT INTO orders VALUES (99, 693, 87);
+INSERT INTO orders VALUES (100, 700, 0);
+INSERT INTO orders VALUES (101, 707, 13);
+INSERT INTO orders VALUES (102, 714, 26);
+INSERT INTO orders VALUES (103, 721, 39);
+INSERT INTO orders VALUES (104, 728, 52);
+INSERT INTO orders VALUES (105, 735, 65);
+INSERT INTO orders VALUES (106, 742, 78);
+INSERT INTO orders VALUES (107, 749, 91);
+INSERT INTO orders VALUES (108, 756, 4);
+INSERT INTO orders VALUES (109, 763, 17);
+INSERT INTO orders VALUES (110, 770, 30);
+INSERT INTO orders VALUES (111, 777, 43);
+INSERT INTO orders VALUES (112, 784, 56);
+INSERT INTO orders VALUES (113, 791, 69);
+INSERT INTO orders VALUES (114, 798, 82);
+INSERT INTO orders VALUES (115, 805, 95);
+INSERT INTO orders VALUES (116, 812, 8);
+INSERT INTO orders VALUES (117, 819, 21);
+INSERT INTO orders VALUES (118, 826, 34);
+INSERT INTO orders VALUES (119, 833, 47);
+INSERT INTO orders VALUES (120, 840, 60);
+INSERT INTO orders VALUES (121, 847, 73);
+INSERT INTO orders VALUES (122, 854, 86);
+INSERT INTO orders VALUES (123, 861, 99);
+INSERT INTO orders VALUES (124, 868, 12);
+INSERT INTO orders VALUES (125, 875, 25);
+INSERT INTO orders VALUES (126, 882, 38);
+INSERT INTO orders VALUES (127, 889, 51);
+INSERT INTO orders VALUES (128, 896, 64);
+INSERT INTO orders VALUES (129, 903, 77);
+INSERT INTO orders VALUES (130, 910, 90);
+INSERT INTO orders VALUES (131, 917, 3);
+INSERT INTO orders VALUES (132, 924, 16);
+INSERT INTO orders VALUES (133, 931, 29);
+INSERT INTO orders VALUES (134, 938, 42);
+INSERT INTO orders VALUES (135, 945, 55);
+INSERT INTO orders VALUES (136, 952, 68);
+INSERT INTO orders VALUES (137, 959, 81);
+INSERT INTO orders VALUES (138, 966, 94);
+INSERT INTO orders VALUES (139, 973, 7);
+INSERT INTO orders VALUES (140, 980, 20);
+INSERT INTO orders VALUES (141, 987, 33);
+INSERT INTO orders VALUES (142, 994, 46);
+INSERT INTO orders VALUES (143, 1001, 59);
+INSERT INTO orders VALUES (144, 1008, 72);
+INSERT INTO orders VALUES (145, 1015, 85);
+INSERT INTO orders VALUES (146, 1022, 98);
+INSERT INTO orders VALUES (147, 1029, 11);
+INSERT INTO orders VALUES (148, 1036, 24);
+INSERT INTO orders VALUES (149, 1043, 37);
+INSERT INTO orders VALUES (150, 1050, 50);
+INSERT INTO orders VALUES (151, 1057, 63);
+INSERT INTO orders VALUES (152, 1064, 76);
+INSERT INTO orders VALUES (153, 1071, 89);
+INSERT INTO orders VALUES (154, 1078, 2);
+INSERT INTO orders VALUES (155, 1085, 15);
+INSERT INTO orders VALUES (156, 1092, 28);
+INSERT INTO orders VALUES (157, 1099, 41);
+INSERT INTO orders VALUES (158, 1106, 54);
+INSERT INTO orders VALUES (159, 1113, 67);
+INSERT INTO orders VALUES (160, 1120, 80);
+INSERT INTO orders VALUES (161, 1127, 93);
+INSERT INTO orders VALUES (162, 1134, 6);
+INSERT INTO orders VALUES (163, 1141, 19);
+INSERT INTO orders VALUES (164, 1148, 32);
+INSERT INTO orders VALUES (165, 1155, 45);
+INSERT INTO orders VALUES (166, 1162, 58);
+INSERT INTO orders VALUES (167, 1169, 71);
+INSERT INTO orders VALUES (168, 1176, 84);
+INSERT INTO orders VALUES (169, 1183, 97);
+INSERT INTO orders VALUES (170, 1190, 10);
+INSERT INTO orders VALUES (171, 1197, 23);
+INSERT INTO orders VALUES (172, 1204, 36);
+INSERT INTO orders VALUES (173, 1211, 49);
+INSERT INTO orders VALUES (174, 1218, 62);
+INSERT INTO orders VALUES (175, 1225, 75);
+INSERT INTO orders VALUES (176, 1232, 88);
+INSERT INTO orders VALUES (177, 1239, 1);
+INSERT INTO orders VALUES (178, 1246, 14);
+INSERT INTO orders VALUES (179, 1253, 27);
+INSERT INTO orders VALUES (180, 1260, 40);
+INSERT INTO orders VALUES (181, 1267, 53);
+INSERT INTO orders VALUES (182, 1274, 66);
+INSERT INTO orders VALUES (183, 1281, 79);
+INSERT INTO orders VALUES (184, 1288, 92);
+INSERT INTO orders VALUES (185, 1295, 5);
+INSERT INTO orders VALUES (186, 1302, 18);
+INSERT INTO orders VALUES (187, 1309, 31);
+INSERT INTO orders VALUES (188, 1316, 44);
+INSERT INTO orders VALUES (189, 1323, 57);
+INSERT INTO orders VALUES (190, 1330, 70);
+INSERT INTO orders VALUES (191, 1337, 83);
+INSERT INTO orders VALUES (192, 1344, 96);
+INSERT INTO orders VALUES (193, 1351, 9);
+INSERT INTO orders VALUES (194, 1358, 22);
+INSERT INTO orders VALUES (195, 1365, 35);
+INSERT INTO orders VALUES (196, 1372, 48);
+INSERT INTO orders VALUES (197, 1379, 61);
+INSERT INTO orders VALUES (198, 1386, 74);
+INSERT INTO orders VALUES (199, 1393, 87);
+INSERT INTO orders VALUES (200, 1400, 0);
+INSERT INTO orders VALUES (201, 1407, 13);
+INSERT INTO orders VALUES (202, 1414, 26);
+INSERT INTO orders VALUES (203, 1421, 39);
+INSERT INTO orders VALUES (204, 1428, 52);
+INSERT INTO orders VALUES (205, 1435, 65);
+INSERT INTO orders VALUES (206, 1442, 78);
+INSERT INTO orders VALUES (207, 1449, 91);
+INSERT INTO orders VALUES (208, 1456, 4);
+INSERT INTO orders VALUES (209, 1463, 17);
+INSERT INTO orders VALUES (210, 1470, 30);
+INSERT INTO orders VALUES (211, 1477, 43);
+INSERT INTO orders VALUES (212, 1484, 56);
+INSERT INTO orders VALUES (213, 1491, 69);
+INSERT INTO orders VALUES (214, 1498, 82);
+INSERT INTO orders VALUES (215, 1505, 95);
+INSERT INTO orders VALUES (216, 1512, 8);
+INSERT INTO orders VALUES (217, 1519, 21);
+INSERT INTO orders VALUES (218, 1526, 34);
+INSERT INTO orders VALUES (219, 1533, 47);
+INSERT INTO orders VALUES (220, 1540, 60);
+INSERT INTO orders VALUES (221, 1547, 73);
+INSERT INTO orders VALUES (222, 1554, 86);
+INSERT INTO orders VALUES (223, 1561, 99);
+INSERT INTO orders VALUES (224, 1568, 12);
+INSERT INTO orders VALUES (225, 1575, 25);
+INSERT INTO orders VALUES (226, 1582, 38);
+INSERT INTO orders VALUES (227, 1589, 51);
+INSERT INTO orders VALUES (228, 1596, 64);
+INSERT INTO orders VALUES (229, 1603, 77);
+INSERT INTO orders VALUES (230, 1610, 90);
+INSERT INTO orders VALUES (231, 1617, 3);
+INSERT INTO orders VALUES (232, 1624, 16);
+INSERT INTO orders VALUES (233, 1631, 29);
+INSERT INTO orders VALUES (234, 1638, 42);
+INSERT INTO orders VALUES (235, 1645, 55);
+INSERT INTO orders VALUES (236, 1652, 68);
+INSERT INTO orders VALUES (237, 1659, 81);
+INSERT INTO orders VALUES (238, 1666, 94);
+INSERT INTO orders VALUES (239, 1673, 7);
+INSERT INTO orders VALUES (240, 1680, 20);
+INSERT INTO orders VALUES (241, 1687, 33);
+INSERT INTO orders VALUES (242, 1694, 46);
+INSERT INTO orders VALUES (243, 1701, 59);
+INSERT INTO orders VALUES (244, 1708, 72);
+INSERT INTO orders VALUES (245, 1715, 85);
+INSERT INTO orders VALUES (246, 1722, 98);
+INSERT INTO orders VALUES (247, 1729, 11);
+INSERT INTO orders VALUES (248, 1736, 24);
+INSERT INTO orders VALUES (249, 1743, 37);
+INSERT INTO orders VALUES (250, 1750, 50);
+INSERT INTO orders VALUES (251, 1757, 63);
+INSERT INTO orders VALUES (252, 1764, 76);
+INSERT INTO orders VALUES (253, 1771, 89);
+INSERT INTO orders VALUES (254, 1778, 2);
+INSERT INTO orders VALUES (255, 1785, 15);
+INSERT INTO orders VALUES (256, 1792, 28);
+INSERT INTO orders VALUES (257, 1799, 41);
+INSERT INTO orders VALUES (258, 1806, 54);
+INSERT INTO orders VALUES (259, 1813, 67);
+INSERT INTO orders VALUES (260, 1820, 80);
+INSERT INTO orders VALUES (261, 1827, 93);
+INSERT INTO orders VALUES (262, 1834, 6);
+INSERT INTO orders VALUES (263, 1841, 19);
+INSERT INTO orders VALUES (264, 1848, 32);
+INSERT INTO orders VALUES (265, 1855, 45);
+INSERT INTO orders VALUES (266, 1862, 58);
+INSERT INTO orders VALUES (267, 1869, 71);
+INSERT INTO orders VALUES (268, 1876, 84);
+INSERT INTO orders VALUES (269, 1883, 97);
+INSERT INTO orders VALUES (270, 1890, 10);
+INSERT INTO orders VALUES (271, 1897, 23);
+INSERT INTO orders VALUES (272, 1904, 36);
+INSERT INTO orders VALUES (273, 1911, 49);
+INSERT INTO orders VALUES (274, 1918, 62);
+INSERT INTO orders VALUES (275, 1925, 75);
+INSERT INTO orders VALUES (276, 1932, 88);
+INSERT INTO orders VALUES (277, 1939, 1);
+INSERT INTO orders VALUES (278, 1946, 14);
+INSERT INTO orders VALUES (279, 1953, 27);
+INSERT INTO orders VALUES (280, 1960, 40);
+INSERT INTO orders VALUES (281, 1967, 53);
+INSERT INTO orders VALUES (282, 1974, 66);
+INSERT INTO orders VALUES (283, 1981, 79);
+INSERT INTO orders VALUES (284, 1988, 92);
+INSERT INTO orders VALUES (285, 1995, 5);
+INSERT INTO orders VALUES (286, 2002, 18);
+INSERT INTO orders VALUES (287, 2009, 31);
+INSERT INTO orders VALUES (288, 2016, 44);
+INSERT INTO orders VALUES (289, 2023, 57);
+INSERT INTO orders VALUES (290, 2030, 70);
+INSERT INTO orders VALUES (291, 2037, 83);
+INSERT INTO orders VALUES (292, 2044, 96);
+INSERT INTO orders VALUES (293, 2051, 9);
+INSERT INTO orders VALUES (294, 2058, 22);
+INSERT INTO orders VALUES (295, 2065, 35);
+INSERT INTO orders VALUES (296, 2072, 48);
+INSERT INTO orders VALUES (297, 2079, 61);
+INSERT INTO orders VALUES (298, 2086, 74);
+INSERT INTO orders VALUES (299, 2093, 87);
+INSERT INTO orders VALUES (300, 2100, 0);
+INSERT INTO orders VALUES (301, 2107, 13);
+INSERT INTO orders VALUES (302, 2114, 26);
+INSERT INTO orders VALUES (303, 2121, 39);
+INSERT INTO orders VALUES (304, 2128, 52);
+INSERT INTO orders VALUES (305, 2135, 65);
+INSERT INTO orders VALUES (306, 2142, 78);
+INSERT INTO orders VALUES (307, 2149, 91);
+INSERT INTO orders VALUES (308, 2156, 4);
+INSERT INTO orders VALUES (309, 2163, 17);
+INSERT INTO orders VALUES (310, 2170, 30);
+INSERT INTO orders VALUES (311, 2177, 43);
+INSERT INTO orders VALUES (312, 2184, 56);
+INSERT INTO orders VALUES (313, 2191, 69);
+INSERT INTO orders VALUES (314, 2198, 82);
+INSERT INTO orders VALUES (315, 2205, 95);
+INSERT INTO orders VALUES (316, 2212, 8);
+INSERT INTO orders VALUES (317, 2219, 21);
+INSERT INTO orders VALUES (318, 2226, 34);
+INSERT INTO orders VALUES (319, 2233, 47);
+INSERT INTO orders VALUES (320, 2240, 60);
+INSERT INTO orders VALUES (321, 2247, 73);
+INSERT INTO orders VALUES (322, 2254, 86);
+INSERT INTO orders VALUES (323, 2261, 99);
+INSERT INTO orders VALUES (324, 2268, 12);
+INSERT INTO orders VALUES (325, 2275, 25);
+INSERT INTO orders VALUES (326, 2282, 38);
+INSERT INTO orders VALUES (327, 2289, 51);
+INSERT INTO orders VALUES (328, 2296, 64);
+INSERT INTO orders VALUES (329, 2303, 77);
+INSERT INTO orders VALUES (330, 2310, 90);
+INSERT INTO orders VALUES (331, 2317, 3);
+INSERT INTO orders VALUES (332, 2324, 16);
+INSERT INTO orders VALUES (333, 2331, 29);
+INSERT INTO orders VALUES (334, 2338, 42);
+INSERT INTO orders VALUES (335, 2345, 55);
+INSERT INTO orders VALUES (336, 2352, 68);
+INSERT INTO orders VALUES (337, 2359, 81);
+INSERT INTO orders VALUES (338, 2366, 94);
+INSERT INTO orders VALUES (339, 2373, 7);
+INSERT INTO orders VALUES (340, 2380, 20);
+INSERT INTO orders VALUES (341, 2387, 33);
+INSERT INTO orders VALUES (342, 2394, 46);
+INSERT INTO orders VALUES (343, 2401, 59);
+INSERT INTO orders VALUES (344, 2408, 72);
+INSERT INTO orders VALUES (345, 2415, 85);
+INSERT INTO orders VALUES (346, 2422, 98);
+INSERT INTO orders VALUES (347, 2429, 11);
+INSERT INTO orders VALUES (348, 2436, 24);
+INSERT INTO orders VALUES (349, 2443, 37);
+INSERT INTO orders VALUES (350, 2450, 50);
+INSERT INTO orders VALUES (351, 2457, 63);
+INSERT INTO orders VALUES (352, 2464, 76);
+INSERT INTO orders VALUES (353, 2471, 89);
+INSERT INTO orders VALUES (354, 2478, 2);
+INSERT INTO orders VALUES (355, 2485, 15);
+INSERT INTO orders VALUES (356, 2492, 28);
+INSERT INTO orders VALUES (357, 2499, 41);
+INSERT INTO orders VALUES (358, 2506, 54);
+INSERT INTO orders VALUES (359, 2513, 67);
+INSERT INTO orders VALUES (360, 2520, 80);
+INSERT INTO orders VALUES (361, 2527, 93);
+INSERT INTO orders VALUES (362, 2534, 6);
+INSERT INTO orders VALUES (363, 2541, 19);
+INSERT INTO orders VALUES (364, 2548, 32);
+INSERT INTO orders VALUES (365, 2555, 45);
+INSERT INTO orders VALUES (366, 2562, 58);
+INSERT INTO orders VALUES (367, 2569, 71);
+INSERT INTO orders VALUES (368, 2576, 84);
+INSERT INTO orders VALUES (369, 2583, 97);
+INSERT INTO orders VALUES (370, 2590, 10);
+INSERT INTO orders VALUES (371, 2597, 23);
+INSERT INTO orders VALUES (372, 2604, 36);
+INSERT INTO orders VALUES (373, 2611, 49);
+INSERT INTO orders VALUES (374, 2618, 62);
+INSERT INTO orders VALUES (375, 2625, 75);
+INSERT INTO orders VALUES (376, 2632, 88);
+INSERT INTO orders VALUES (377, 2639, 1);
+INSERT INTO orders VALUES (378, 2646, 14);
+INSERT INTO orders VALUES (379, 2653, 27);
+INSERT INTO orders VALUES (380, 2660, 40);
+INSERT INTO orders VALUES (381, 2667, 53);
+INSERT INTO orders VALUES (382, 2674, 66);
+INSERT INTO orders VALUES (383, 2681, 79);
+INSERT INTO orders VALUES (384, 2688, 92);
+INSERT INTO orders VALUES (385, 2695, 5);
+INSERT INTO orders VALUES (386, 2702, 18);
+INSERT INTO orders VALUES (387, 2709, 31);
+INSERT INTO orders VALUES (388, 2716, 44);
+INSERT INTO orders VALUES (389, 2723, 57);
+INSERT INTO orders VALUES (390, 2730, 70);
+INSERT INTO orders VALUES (391, 2737, 83);
+INSERT INTO orders VALUES (392, 2744, 96);
+INSERT INTO orders VALUES (393, 2751, 9);
+INSERT INTO orders VALUES (394, 2758, 22);
+INSERT INTO orders VALUES (395, 2765, 35);
+INSERT INTO orders VALUES (396, 2772, 48);
+INSERT INTO orders VALUES (397, 2779, 61);
+INSERT INTO orders VALUES (398, 2786, 74);
+INSERT INTO orders VALUES (399, 2793, 87);
+INSERT INTO orders VALUES (400, 2800, 0);
+INSERT INTO orders VALUES (401, 2807, 13);
+INSERT INTO orders VALUES (402, 2814, 26);
+INSERT INTO orders VALUES (403, 2821, 39);
+INSERT INTO orders VALUES (404, 2828, 52);
+INSERT INTO orders VALUES (405, 2835, 65);
+INSERT INTO orders VALUES (406, 2842, 78);
+INSERT INTO orders VALUES (407, 2849, 91);
+INSERT INTO orders VALUES (408, 2856, 4);
+INSERT INTO orders VALUES (409, 2863, 17);
+INSERT INTO orders VALUES (410, 2870, 30);
+INSERT INTO orders VALUES (411, 2877, 43);
+INSERT INTO orders VALUES (412, 2884, 56);
+INSERT INTO orders VALUES (413, 2891, 69);
+INSERT INTO orders VALUES (414, 2898, 82);
+INSERT INTO orders VALUES (415, 2905, 95);
+INSERT INTO orders VALUES (416, 2912, 8);
+INSERT INTO orders VALUES (417, 2919, 21);
+INSERT INTO orders VALUES (418, 2926, 34);
+INSERT INTO orders VALUES (419, 2933, 47);
+INSERT INTO orders VALUES (420, 2940, 60);
+INSERT INTO orders VALUES (421, 2947, 73);
+INSERT INTO orders VALUES (422, 2954, 86);
+INSERT INTO orders VALUES (423, 2961, 99);
+INSERT INTO orders VALUES (424, 2968, 12);
+INSERT INTO orders VALUES (425, 2975, 25);
+INSERT INTO orders VALUES (426, 2982, 38);
+INSERT INTO orders VALUES (427, 2989, 51);
+INSERT INTO orders VALUES (428, 2996, 64);
+INSERT INTO orders VALUES (429, 3003, 77);
+INSERT INTO orders VALUES (430, 3010, 90);
+INSERT INTO orders VALUES (431, 3017, 3);
+INSERT INTO orders VALUES (432, 3024, 16);
+INSERT INTO orders VALUES (433, 3031, 29);
+INSERT INTO orders VALUES (434, 3038, 42);
+INSERT INTO orders VALUES (435, 3045, 55);
+INSERT INTO orders VALUES (436, 3052, 68);
+INSERT INTO orders VALUES (437, 3059, 81);
+INSERT INTO orders VALUES (438, 3066, 94);
+INSERT INTO orders VALUES (439, 3073, 7);
+INSERT INTO orders VALUES (440, 3080, 20);
+INSERT INTO orders VALUES (441, 3087, 33);
+INSERT INTO orders VALUES (442, 3094, 46);
+INSERT INTO orders VALUES (443, 3101, 59);
+INSERT INTO orders VALUES (444, 3108, 72);
+INSERT INTO orders VALUES (445, 3115, 85);
+INSERT INTO orders VALUES (446, 3122, 98);
+INSERT INTO orders VALUES (447, 3129, 11);
+INSERT INTO orders VALUES (448, 3136, 24);
+INSERT INTO orders VALUES (449, 3143, 37);
+INSERT INTO orders VALUES (450, 3150, 50);
+INSERT INTO orders VALUES (451, 3157, 63);
+INSERT INTO orders VALUES (452, 3164, 76);
+INSERT INTO orders VALUES (453, 3171, 89);
+INSERT INTO orders VALUES (454, 3178, 2);
+INSERT INTO orders VALUES (455, 3185, 15);
+INSERT INTO orders VALUES (456, 3192, 28);
+INSERT INTO orders VALUES (457, 3199, 41);
+INSERT INTO orders VALUES (458, 3206, 54);
+INSERT INTO orders VALUES (459, 3213, 67);
+INSERT INTO orders VALUES (460, 3220, 80);
+INSERT INTO orders VALUES (461, 3227, 93);
+INSERT INTO orders VALUES (462, 3234, 6);
+INSERT INTO orders VALUES (463, 3241, 19);
+INSERT INTO orders VALUES (464, 3248, 32);
+INSERT INTO orders VALUES (465, 3255, 45);
+INSERT INTO orders VALUES (466, 3262, 58);
+INSERT INTO orders VALUES (467, 3269, 71);
+INSERT INTO orders VALUES (468, 3276, 84);
+INSERT INTO orders VALUES (469, 3283, 97);
+INSERT INTO orders VALUES (470, 3290, 10);
+INSERT INTO orders VALUES (471, 3297, 23);
+INSERT INTO orders VALUES (472, 3304, 36);
+INSERT INTO orders VALUES (473, 3311, 49);
+INSERT INTO orders VALUES (474, 3318, 62);
+INSERT INTO orders VALUES (475, 3325, 75);
+INSERT INTO orders VALUES (476, 3332, 88);
+INSERT INTO orders VALUES (477, 3339, 1);
+INSERT INTO orders VALUES (478, 3346, 14);
+INSERT INTO orders VALUES (479, 3353, 27);
+INSERT INTO orders VALUES (480, 3360, 40);
+INSERT INTO orders VALUES (481, 3367, 53);
+INSERT INTO orders VALUES (482, 3374, 66);
+INSERT INTO orders VALUES (483, 3381, 79);
+INSERT INTO orders VALUES (484, 3388, 92);
+INSERT INTO orders VALUES (485, 3395, 5);
+INSERT INTO orders VALUES (486, 3402, 18);
+INSERT INTO orders VALUES (487, 3409, 31);
+INSERT INTO orders VALUES (488, 3416, 44);
+INSERT INTO orders VALUES (489, 3423, 57);
+INSERT INTO orders VALUES (490, 3430, 70);
+INSERT INTO orders VALUES (491, 3437, 83);
+INSERT INTO orders VALUES (492, 3444, 96);
+INSERT INTO orders VALUES (493, 3451, 9);
+INSERT INTO orders VALUES (494, 3458, 22);
+INSERT INTO orders VALUES (495, 3465, 35);
+INSERT INTO orders VALUES (496, 3472, 48);
+INSERT INTO orders VALUES (497, 3479, 61);
+INSERT INTO orders VALUES (498, 3486, 74);
+INSERT INTO orders VALUES (499, 3493, 87);
+INSERT INTO orders VALUES (500, 3500, 0);
+INSERT INTO orders VALUES (501, 3507, 13);
+INSERT INTO orders VALUES (502, 3514, 26);
+INSERT INTO orders VALUES (503, 3521, 39);
+INSERT INTO orders VALUES (504, 3528, 52);
+INSERT INTO orders VALUES (505, 3535, 65);
+INSERT INTO orders VALUES (506, 3542, 78);
+INSERT INTO orders VALUES (507, 3549, 91);
+INSERT INTO orders VALUES (508, 3556, 4);
+INSERT INTO orders VALUES (509, 3563, 17);
+INSERT INTO orders VALUES (510, 3570, 30);
+INSERT INTO orders VALUES (511, 3577, 43);
+INSERT INTO orders VALUES (512, 3584, 56);
+INSERT INTO orders VALUES (513, 3591, 69);
+INSERT INTO orders VALUES (514, 3598, 82);
+INSERT INTO orders VALUES (515, 3605, 95);
+INSERT INTO orders VALUES (516, 3612, 8);
+INSERT INTO orders VALUES (517, 3619, 21);
+INSERT INTO orders VALUES (518, 3626, 34);
+INSERT INTO orders VALUES (519, 3633, 47);
+INSERT INTO orders VALUES (520, 3640, 60);
+INSERT INTO orders VALUES (521, 3647, 73);
+INSERT INTO orders VALUES (522, 3654, 86);
+INSERT INTO orders VALUES (523, 3661, 99);
+INSERT INTO orders VALUES (524, 3668, 12);
+INSERT INTO orders VALUES (525, 3675, 25);
+INSERT INTO orders VALUES (526, 3682, 38);
+INSERT INTO orders VALUES (527, 3689, 51);
+INSERT INTO orders VALUES (528, 3696, 64);
+INSERT INTO orders VALUES (529, 3703, 77);
+INSERT INTO orders VALUES (530, 3710, 90);
+INSERT INTO orders VALUES (531, 3717, 3);
+INSERT INTO orders VALUES (532, 3724, 16);
+INSERT INTO orders VALUES (533, 3731, 29);
+INSERT INTO orders VALUES (534, 3738, 42);
+INSERT INTO orders VALUES (535, 3745, 55);
+INSERT INTO orders VALUES (536, 3752, 68);
+INSERT INTO orders VALUES (537, 3759, 81);
+INSERT INTO orders VALUES (538, 3766, 94);
+INSERT INTO orders VALUES (539, 3773, 7);
+INSERT INTO orders VALUES (540, 3780, 20);
+INSERT INTO orders VALUES (541, 3787, 33);
+INSERT INTO orders VALUES (542, 3794, 46);
+INSERT INTO orders VALUES (543, 3801, 59);
+INSERT INTO orders VALUES (544, 3808, 72);
+INSERT INTO orders VALUES (545, 3815, 85);
+INSERT INTO orders VALUES (546, 3822, 98);
+INSERT INTO orders VALUES (547, 3829, 11);
+INSERT INTO orders VALUES (548, 3836, 24);
+INSERT INTO orders VALUES (549, 3843, 37);
+INSERT INTO orders VALUES (550, 3850, 50);
+INSERT INTO orders VALUES (551, 3857, 63);
+INSERT INTO orders VALUES (552, 3864, 76);
+INSERT INTO orders VALUES (553, 3871, 89);
+INSERT INTO orders VALUES (554, 3878, 2);
+INSERT INTO orders VALUES (555, 3885, 15);
+INSERT INTO orders VALUES (556, 3892, 28);
+INSERT INTO orders VALUES (557, 3899, 41);
+INSERT INTO orders VALUES (558, 3906, 54);
+INSERT INTO orders VALUES (559, 3913, 67);
+INSERT INTO orders VALUES (560, 3920, 80);
+INSERT INTO orders VALUES (561, 3927, 93);
+INSERT INTO orders VALUES (562, 3934, 6);
+INSERT INTO orders VALUES (563, 3941, 19);
+INSERT INTO orders VALUES (564, 3948, 32);
+INSERT INTO orders VALUES (565, 3955, 45);
+INSERT INTO orders VALUES (566, 3962, 58);
+INSERT INTO orders VALUES (567, 3969, 71);
+INSERT INTO orders VALUES (568, 3976, 84);
+INSERT INTO orders VALUES (569, 3983, 97);
+INSERT INTO orders VALUES (570, 3990, 10);
+INSERT INTO orders VALUES (571, 3997, 23);
+INSERT INTO orders VALUES (572, 4004, 36);
+INSERT INTO orders VALUES (573, 4011, 49);
+INSERT INTO orders VALUES (574, 4018, 62);
+INSERT INTO orders VALUES (575, 4025, 75);
+INSERT INTO orders VALUES (576, 4032, 88);
+INSERT INTO orders VALUES (577, 4039, 1);
+INSERT INTO orders VALUES (578, 4046, 14);
+INSERT INTO orders VALUES (579, 4053, 27);
+INSERT INTO orders VALUES (580, 4060, 40);
+INSERT INTO orders VALUES (581, 4067, 53);
+INSERT INTO orders VALUES (582, 4074, 66);
+INSERT INTO orders VALUES (583, 4081, 79);
+INSERT INTO orders VALUES (584, 4088, 92);
+INSERT INTO orders VALUES (585, 4095, 5);
+INSERT INTO orders VALUES (586, 4102, 18);
+INSERT INTO orders VALUES (587, 4109, 31);
+INSERT INTO orders VALUES (588, 4116, 44);
+INSERT INTO orders VALUES (589, 4123, 57);
+INSERT INTO orders VALUES (590, 4130, 70);
+INSERT INTO orders VALUES (591, 4137, 83);
+INSERT INTO orders VALUES (592, 4144, 96);
+INSERT INTO orders VALUES (593, 4151, 9);
+INSERT INTO orders VALUES (594, 4158, 22);
+INSERT INTO orders VALUES (595, 4165, 35);
+INSERT INTO orders VALUES (596, 4172, 48);
+INSERT INTO orders VALUES (597, 4179, 61);
+INSERT INTO orders VALUES (598, 4186, 74);
+INSERT INTO orders VALUES (599, 4193, 87);
+INSERT INTO orders VALUES (600, 4200, 0);
+INSERT INTO orders VALUES (601, 4207, 13);
+INSERT INTO orders VALUES (602, 4214, 26);
+INSERT INTO orders VALUES (603, 4221, 39);
+INSERT INTO orders VALUES (604, 4228, 52);
+INSERT INTO orders VALUES (605, 4235, 65);
+INSERT INTO orders VALUES (606, 4242, 78);
+INSERT INTO orders VALUES (607, 4249, 91);
+INSERT INTO orders VALUES (608, 4256, 4);
+INSERT INTO orders VALUES (609, 4263, 17);
+INSERT INTO orders VALUES (610, 4270, 30);
+INSERT INTO orders VALUES (611, 4277, 43);
+INSERT INTO orders VALUES (612, 4284, 56);
+INSERT INTO orders VALUES (613, 4291, 69);
+INSERT INTO orders VALUES (614, 4298, 82);
+INSERT INTO orders VALUES (615, 4305, 95);
+INSERT INTO orders VALUES (616, 4312, 8);
+INSERT INTO orders VALUES (617, 4319, 21);
+INSERT INTO orders VALUES (618, 4326, 34);
+INSERT INTO orders VALUES (619, 4333, 47);
+INSERT INTO orders VALUES (620, 4340, 60);
+INSERT INTO orders VALUES (621, 4347, 73);
+INSERT INTO orders VALUES (622, 4354, 86);
+INSERT INTO orders VALUES (623, 4361, 99);
+INSERT INTO orders VALUES (624, 4368, 12);
+INSERT INTO orders VALUES (625, 4375, 25);
+INSERT INTO orders VALUES (626, 4382, 38);
+INSERT INTO orders VALUES (627, 4389, 51);
+INSERT INTO orders VALUES (628, 4396, 64);
+INSERT INTO orders VALUES (629, 4403, 77);
+INSERT INTO orders VALUES (630, 4410, 90);
+INSERT INTO orders VALUES (631, 4417, 3);
+INSERT INTO orders VALUES (632, 4424, 16);
+INSERT INTO orders VALUES (633, 4431, 29);
+INSERT INTO orders VALUES (634, 4438, 42);
+INSERT INTO orders VALUES (635, 4445, 55);
+INSERT INTO orders VALUES (636, 4452, 68);
+INSERT INTO orders VALUES (637, 4459, 81);
+INSERT INTO orders VALUES (638, 4466, 94);
+INSERT INTO orders VALUES (639, 4473, 7);
+INSERT INTO orders VALUES (640, 4480, 20);
+INSERT INTO orders VALUES (641, 4487, 33);
+INSERT INTO orders VALUES (642, 4494, 46);
+INSERT INTO orders VALUES (643, 4501, 59);
+INSERT INTO orders VALUES (644, 4508, 72);
+INSERT INTO orders VALUES (645, 4515, 85);
+INSERT INTO orders VALUES (646, 4522, 98);
+INSERT INTO orders VALUES (647, 4529, 11);
+INSERT INTO orders VALUES (648, 4536, 24);
+INSERT INTO orders VALUES (649, 4543, 37);
+INSERT INTO orders VALUES (650, 4550, 50);
+INSERT INTO orders VALUES (651, 4557, 63);
+INSERT INTO orders VALUES (652, 4564, 76);
+INSERT INTO orders VALUES (653, 4571, 89);
+INSERT INTO orders VALUES (654, 4578, 2);
+INSERT INTO orders VALUES (655, 4585, 15);
+INSERT INTO orders VALUES (656, 4592, 28);
+INSERT INTO orders VALUES (657, 4599, 41);
+INSERT INTO orders VALUES (658, 4606, 54);
+INSERT INTO orders VALUES (659, 4613, 67);
+INSERT INTO orders VALUES (660, 4620, 80);
+INSERT INTO orders VALUES (661, 4627, 93);
+INSERT INTO orders VALUES (662, 4634, 6);
+INSERT INTO orders VALUES (663, 4641, 19);
+INSERT INTO orders VALUES (664, 4648, 32);
+INSERT INTO orders VALUES (665, 4655, 45);
+INSERT INTO orders VALUES (666, 4662, 58);
+INSERT INTO orders VALUES (667, 4669, 71);
+INSERT INTO orders VALUES (668, 4676, 84);
+INSERT INTO orders VALUES (669, 4683, 97);
+INSERT INTO orders VALUES (670, 4690, 10);
+INSERT INTO orders VALUES (671, 4697, 23);
+INSERT INTO orders VALUES (672, 4704, 36);
+INSERT INTO orders VALUES (673, 4711, 49);
+INSERT INTO orders VALUES (674, 4718, 62);
+INSERT INTO orders VALUES (675, 4725, 75);
+INSERT INTO orders VALUES (676, 4732, 88);
+INSERT INTO orders VALUES (677, 4739, 1);
+INSERT INTO orders VALUES (678, 4746, 14);
+INSERT INTO orders VALUES (679, 4753, 27);
+INSERT INTO orders VALUES (680, 4760, 40);
+INSERT INTO orders VALUES (681, 4767, 53);
+INSERT INTO orders VALUES (682, 4774, 66);
+INSERT INTO orders VALUES (683, 4781, 79);
+INSERT INTO orders VALUES (684, 4788, 92);
+INSERT INTO orders VALUES (685, 4795, 5);
+INSERT INTO orders VALUES (686, 4802, 18);
+INSERT INTO orders VALUES (687, 4809, 31);
+INSERT INTO orders VALUES (688, 4816, 44);
+INSERT INTO orders VALUES (689, 4823, 57);
+INSERT INTO orders VALUES (690, 4830, 70);
+INSERT INTO orders VALUES (691, 4837, 83);
+INSERT INTO orders VALUES (692, 4844, 96);
+INSERT INTO orders VALUES (693, 4851, 9);
+INSERT INTO orders VALUES (694, 4858, 22);
+INSERT INTO orders VALUES (695, 4865, 35);
+INSERT INTO orders VALUES (696, 4872, 48);
+INSERT INTO orders VALUES (697, 4879, 61);
+INSERT INTO orders VALUES (698, 4886, 74);
+INSERT INTO orders VALUES (699, 4893, 87);
+INSERT INTO orders VALUES (700, 4900, 0);
+INSERT INTO orders VALUES (701, 4907, 13);
+INSERT INTO orders VALUES (702, 4914, 26);
+INSERT INTO orders VALUES (703, 4921, 39);
+INSERT INTO orders VALUES (704, 4928, 52);
+INSERT INTO orders VALUES (705, 4935, 65);
+INSERT INTO orders VALUES (706, 4942, 78);
+INSERT INTO orders VALUES (707, 4949, 91);
+INSERT INTO orders VALUES (708, 4956, 4);
+INSERT INTO orders VALUES (709, 4963, 17);
+INSERT INTO orders VALUES (710, 4970, 30);
+INSERT INTO orders VALUES (711, 4977, 43);
+INSERT INTO orders VALUES (712, 4984, 56);
+INSERT INTO orders VALUES (713, 4991, 69);
+INSERT INTO orders VALUES (714, 4998, 82);
+INSERT INTO orders VALUES (715, 5, 95);
+INSERT INTO orders VALUES (716, 12, 8);
+INSERT INTO orders VALUES (717, 19, 21);
+INSERT INTO orders VALUES (718, 26, 34);
+INSERT INTO orders VALUES (719, 33, 47);
+INSERT INTO orders VALUES (720, 40, 60);
+INSERT INTO orders VALUES (721, 47, 73);
+INSERT INTO orders VALUES (722, 54, 86);
+INSERT INTO orders VALUES (723, 61, 99);
+INSERT INTO orders VALUES (724, 68, 12);
+INSERT INTO orders VALUES (725, 75, 25);
+INSERT INTO orders VALUES (726, 82, 38);
+INSERT INTO orders VALUES (727, 89, 51);
+INSERT INTO orders VALUES (728, 96, 64);
+INSERT INTO orders VALUES (729, 103, 77);
+INSERT INTO orders VALUES (730, 110, 90);
+INSERT INTO orders VALUES (731, 117, 3);
+INSERT INTO orders VALUES (732, 124, 16);
+INSERT INTO orders VALUES (733, 131, 29);
+INSERT INTO orders VALUES (734, 138, 42);
+INSERT INTO orders VALUES (735, 145, 55);
+INSERT INTO orders VALUES (736, 152, 68);
+INSERT INTO orders VALUES (737, 159, 81);
+INSERT INTO orders VALUES (738, 166, 94);
+INSERT INTO orders VALUES (739, 173, 7);
+INSERT INTO orders VALUES (740, 180, 20);
+INSERT INTO orders VALUES (741, 187, 33);
+INSERT INTO orders VALUES (742, 194, 46);
+INSERT INTO orders VALUES (743, 201, 59);
+INSERT INTO orders VALUES (744, 208, 72);
+INSERT INTO orders VALUES (745, 215, 85);
+INSERT INTO orders VALUES (746, 222, 98);
+INSERT INTO orders VALUES (747, 229, 11);
+INSERT INTO orders VALUES (748, 236, 24);
+INSERT INTO orders VALUES (749, 243, 37);
+INSERT INTO orders VALUES (750, 250, 50);
+INSERT INTO orders VALUES (751, 257, 63);
+INSERT INTO orders VALUES (752, 264, 76);
+INSERT INTO orders VALUES (753, 271, 89);
+INSERT INTO orders VALUES (754, 278, 2);
+INSERT INTO orders VALUES (755, 285, 15);
+INSERT INTO orders VALUES (756, 292, 28);
+INSERT INTO orders VALUES (757, 299, 41);
+INSERT INTO orders VALUES (758, 306, 54);
+INSERT INTO orders VALUES (759, 313, 67);
+INSERT INTO orders VALUES (760, 320, 80);
+INSERT INTO orders VALUES (761, 327, 93);
+INSERT INTO orders VALUES (762, 334, 6);
+INSERT INTO orders VALUES (763, 341, 19);
+INSERT INTO orders VALUES (764, 348, 32);
+INSERT INTO orders VALUES (765, 355, 45);
+INSERT INTO orders VALUES (766, 362, 58);
+INSERT INTO orders VALUES (767, 369, 71);
+INSERT INTO orders VALUES (768, 376, 84);
+INSERT INTO orders VALUES (769, 383, 97);
+INSERT INTO orders VALUES (770, 390, 10);
+INSERT INTO orders VALUES (771, 397, 23);
+INSERT INTO orders VALUES (772, 404, 36);
+INSERT INTO orders VALUES (773, 411, 49);
+INSERT INTO orders VALUES (774, 418, 62);
+INSERT INTO orders VALUES (775, 425, 75);
+INSERT INTO orders VALUES (776, 432, 88);
+INSERT INTO orders VALUES (777, 439, 1);
+INSERT INTO orders VALUES (778, 446, 14);
+INSERT INTO orders VALUES (779, 453, 27);
+INSERT INTO orders VALUES (780, 460, 40);
+INSERT INTO orders VALUES (781, 467, 53);
+INSERT INTO orders VALUES (782, 474, 66);
+INSERT INTO orders VALUES (783, 481, 79);
+INSERT INTO orders VALUES (784, 488, 92);
+INSERT INTO orders VALUES (785, 495, 5);
+INSERT INTO orders VALUES (786, 502, 18);
+INSERT INTO orders VALUES (787, 509, 31);
+INSERT INTO orders VALUES (788, 516, 44);
+INSERT INTO orders VALUES (789, 523, 57);
+INSERT INTO orders VALUES (790, 530, 70);
+INSERT INTO orders VALUES (791, 537, 83);
+INSERT INTO orders VALUES (792, 544, 96);
+INSERT INTO orders VALUES (793, 551, 9);
+INSERT INTO orders VALUES (794, 558, 22);
+INSERT INTO orders VALUES (795, 565, 35);
+INSERT INTO orders VALUES (796, 572, 48);
+INSERT INTO orders VALUES (797, 579, 61);
+INSERT INTO orders VALUES (798, 586, 74);
+INSERT INTO orders VALUES (799, 593, 87);
+INSERT INTO orders VALUES (800, 600, 0);
+INSERT INTO orders VALUES (801, 607, 13);
+INSERT INTO orders VALUES (802, 614, 26);
+INSERT INTO orders VALUES (803, 621, 39);
+INSERT INTO orders VALUES (804, 628, 52);
+INSERT INTO orders VALUES (805, 635, 65);
+INSERT INTO orders VALUES (806, 642, 78);
+INSERT INTO orders VALUES (807, 649, 91);
+INSERT INTO orders VALUES (808, 656, 4);
+INSERT INTO orders VALUES (809, 663, 17);
+INSERT INTO orders VALUES (810, 670, 30);
+INSERT INTO orders VALUES (811, 677, 43);
+INSERT INTO orders VALUES (812, 684, 56);
+INSERT INTO orders VALUES (813, 691, 69);
+INSERT INTO orders VALUES (814, 698, 82);
+INSERT INTO orders VALUES (815, 705, 95);
+INSERT INTO orders VALUES (816, 712, 8);
+INSERT INTO orders VALUES (817, 719, 21);
+INSERT INTO orders VALUES (818, 726, 34);
+INSERT INTO orders VALUES (819, 733, 47);
+INSERT INTO orders VALUES (820, 740, 60);
+INSERT INTO orders VALUES (821, 747, 73);
+INSERT INTO orders VALUES (822, 754, 86);
+INSERT INTO orders VALUES (823, 761, 99);
+INSERT INTO orders VALUES (824, 768, 12);
+INSERT INTO orders VALUES (825, 775, 25);
+INSERT INTO orders VALUES (826, 782, 38);
+INSERT INTO orders VALUES (827, 789, 51);
+INSERT INTO orders VALUES (828, 796, 64);
+INSERT INTO orders VALUES (829, 803, 77);
+INSERT INTO orders VALUES (830, 810, 90);
+INSERT INTO orders VALUES (831, 817, 3);
+INSERT INTO orders VALUES (832, 824, 16);
+INSERT INTO orders VALUES (833, 831, 29);
+INSERT INTO orders VALUES (834, 838, 42);
+INSERT INTO orders VALUES (835, 845, 55);
+INSERT INTO orders VALUES (836, 852, 68);
+INSERT INTO orders VALUES (837, 859, 81);
+INSERT INTO orders VALUES (838, 866, 94);
+INSERT INTO orders VALUES (839, 873, 7);
+INSERT INTO orders VALUES (840, 880, 20);
+INSERT INTO orders VALUES (841, 887, 33);
+INSERT INTO orders VALUES (842, 894, 46);
+INSERT INTO orders VALUES (843, 901, 59);
+INSERT INTO orders VALUES (844, 908, 72);
+INSERT INTO orders VALUES (845, 915, 85);
+INSERT INTO orders VALUES (846, 922, 98);
+INSERT INTO orders VALUES (847, 929, 11);
+INSERT INTO orders VALUES (848, 936, 24);
+INSERT INTO orders VALUES (849, 943, 37);
+INSERT INTO orders VALUES (850, 950, 50);
+INSERT INTO orders VALUES (851, 957, 63);
+INSERT INTO orders VALUES (852, 964, 76);
+INSERT INTO orders VALUES (853, 971, 89);
+INSERT INTO orders VALUES (854, 978, 2);
+INSERT INTO orders VALUES (855, 985, 15);
+INSERT INTO orders VALUES (856, 992, 28);
+INSERT INTO orders VALUES (857, 999, 41);
+INSERT INTO orders VALUES (858, 1006, 54);
+INSERT INTO orders VALUES (859, 1013, 67);
+INSERT INTO orders VALUES (860, 1020, 80);
+INSERT INTO orders VALUES (861, 1027, 93);
+INSERT INTO orders VALUES (862, 1034, 6);
+INSERT INTO orders VALUES (863, 1041, 19);
+INSERT INTO orders VALUES (864, 1048, 32);
+INSERT INTO orders VALUES (865, 1055, 45);
+INSERT INTO orders VALUES (866, 1062, 58);
+INSERT INTO orders VALUES (867, 1069, 71);
+INSERT INTO orders VALUES (868, 1076, 84);
+INSERT INTO orders VALUES (869, 1083, 97);
+INSERT INTO orders VALUES (870, 1090, 10);
+INSERT INTO orders VALUES (871, 1097, 23);
+INSERT INTO orders VALUES (872, 1104, 36);
+INSERT INTO orders VALUES (873, 1111, 49);
+INSERT INTO orders VALUES (874, 1118, 62);
+INSERT INTO orders VALUES (875, 1125, 75);
+INSERT INTO orders VALUES (876, 1132, 88);
+INSERT INTO orders VALUES (877, 1139, 1);
+INSERT INTO orders VALUES (878, 1146, 14);
+INSERT INTO orders VALUES (879, 1153, 27);
+INSERT INTO orders VALUES (880, 1160, 40);
+INSERT INTO orders VALUES (881, 1167, 53);
+INSERT INTO orders VALUES (882, 1174, 66);
+INSERT INTO orders VALUES (883, 1181, 79);
+INSERT INTO orders VALUES (884, 1188, 92);
+INSERT INTO orders VALUES (885, 1195, 5);
+INSERT INTO orders VALUES (886, 1202, 18);
+INSERT INTO orders VALUES (887, 1209, 31);
+INSERT INTO orders VALUES (888, 1216, 44);
+INSERT INTO orders VALUES (889, 1223, 57);
+INSERT INTO orders VALUES (890, 1230, 70);
+INSERT INTO orders VALUES (891, 1237, 83);
+INSERT INTO orders VALUES (892, 1244, 96);
+INSERT INTO orders VALUES (893, 1251, 9);
+INSERT INTO orders VALUES (894, 1258, 22);
+INSERT INTO orders VALUES (895, 1265, 35);
+INSERT INTO orders VALUES (896, 1272, 48);
+INSERT INTO orders VALUES (897, 1279, 61);
+INSERT INTO orders VALUES (898, 1286, 74);
+INSERT INTO orders VALUES (899, 1293, 87);
+INSERT INTO orders VALUES (900, 1300, 0);
+INSERT INTO orders VALUES (901, 1307, 13);
+INSERT INTO orders VALUES (902, 1314, 26);
+INSERT INTO orders VALUES (903, 1321, 39);
+INSERT INTO orders VALUES (904, 1328, 52);
+INSERT INTO orders VALUES (905, 1335, 65);
+INSERT INTO orders VALUES (906, 1342, 78);
+INSERT INTO orders VALUES (907, 1349, 91);
+INSERT INTO orders VALUES (908, 1356, 4);
+INSERT INTO orders VALUES (909, 1363, 17);
+INSERT INTO orders VALUES (910, 1370, 30);
+INSERT INTO orders VALUES (911, 1377, 43);
+INSERT INTO orders VALUES (912, 1384, 56);
+INSERT INTO orders VALUES (913, 1391, 69);
+INSERT INTO orders VALUES (914, 1398, 82);
+INSERT INTO orders VALUES (915, 1405, 95);
+INSERT INTO orders VALUES (916, 1412, 8);
+INSERT INTO orders VALUES (917, 1419, 21);
+INSERT INTO orders VALUES (918, 1426, 34);
+INSERT INTO orders VALUES (919, 1433, 47);
+INSERT INTO orders VALUES (920, 1440, 60);
+INSERT INTO orders VALUES (921, 1447, 73);
+INSERT INTO orders VALUES (922, 1454, 86);
+INSERT INTO orders VALUES (923, 1461, 99);
+INSERT INTO orders VALUES (924, 1468, 12);
+INSERT INTO orders VALUES (925, 1475, 25);
+INSERT INTO orders VALUES (926, 1482, 38);
+INSERT INTO orders VALUES (927, 1489, 51);
+INSERT INTO orders VALUES (928, 1496, 64);
+INSERT INTO orders VALUES (929, 1503, 77);
+INSERT INTO orders VALUES (930, 1510, 90);
+INSERT INTO orders VALUES (931, 1517, 3);
+INSERT INTO orders VALUES (932, 1524, 16);
+INSERT INTO orders VALUES (933, 1531, 29);
+INSERT INTO orders VALUES (934, 1538, 42);
+INSERT INTO orders VALUES (935, 1545, 55);
+INSERT INTO orders VALUES (936, 1552, 68);
+INSERT INTO orders VALUES (937, 1559, 81);
+INSERT INTO orders VALUES (938, 1566, 94);
+INSERT INTO orders VALUES (939, 1573, 7);
+INSERT INTO orders VALUES (940, 1580, 20);
+INSERT INTO orders VALUES (941, 1587, 33);
+INSERT INTO orders VALUES (942, 1594, 46);
+INSERT INTO orders VALUES (943, 1601, 59);
+INSERT INTO orders VALUES (944, 1608, 72);
+INSERT INTO orders VALUES (945, 1615, 85);
+INSERT INTO orders VALUES (946, 1622, 98);
+INSERT INTO orders VALUES (947, 1629, 11);
+INSERT INTO orders VALUES (948, 1636, 24);
+INSERT INTO orders VALUES (949, 1643, 37);
+INSERT INTO orders VALUES (950, 1650, 50);
+INSERT INTO orders VALUES (951, 1657, 63);
+INSERT INTO orders VALUES (952, 1664, 76);
+INSERT INTO orders VALUES (953, 1671, 89);
+INSERT INTO orders VALUES (954, 1678, 2);
+INSERT INTO orders VALUES (955, 1685, 15);
+INSERT INTO orders VALUES (956, 1692, 28);
+INSERT INTO orders VALUES (957, 1699, 41);
+INSERT INTO orders VALUES (958, 1706, 54);
+INSERT INTO orders VALUES (959, 1713, 67);
+INSERT INTO orders VALUES (960, 1720, 80);
+INSERT INTO orders VALUES (961, 1727, 93);
+INSERT INTO orders VALUES (962, 1734, 6);
+INSERT INTO orders VALUES (963, 1741, 19);
+INSERT INTO orders VALUES (964, 1748, 32);
+INSERT INTO orders VALUES (965, 1755, 45);
+INSERT INTO orders VALUES (966, 1762, 58);
+INSERT INTO orders VALUES (967, 1769, 71);
+INSERT INTO orders VALUES (968, 1776, 84);
+INSERT INTO orders VALUES (969, 1783, 97);
+INSERT INTO orders VALUES (970, 1790, 10);
+INSERT INTO orders VALUES (971, 1797, 23);
+INSERT INTO orders VALUES (972, 1804, 36);
+INSERT INTO orders VALUES (973, 1811, 49);
+INSERT INTO orders VALUES (974, 1818, 62);
+INSERT INTO orders VALUES (975, 1825, 75);
+INSERT INTO orders VALUES (976, 1832, 88);
+INSERT INTO orders VALUES (977, 1839, 1);
+INSERT INTO orders VALUES (978, 1846, 14);
+INSERT INTO orders VALUES (979, 1853, 27);
+INSERT INTO orders VALUES (980, 1860, 40);
+INSERT INTO orders VALUES (981, 1867, 53);
+INSERT INTO orders VALUES (982, 1874, 66);
+INSERT INTO orders VALUES (983, 1881, 79);
+INSERT INTO orders VALUES (984, 1888, 92);
+INSERT INTO orders VALUES (985, 1895, 5);
+INSERT INTO orders VALUES (986, 1902, 18);
+INSERT INTO orders VALUES (987, 1909, 31);
+INSERT INTO orders VALUES (988, 1916, 44);
+INSERT INTO orders VALUES (989, 1923, 57);
+INSERT INTO orders VALUES (990, 1930, 70);
+INSERT INTO orders VALUES (991, 1937, 83);
+INSERT INTO orders VALUES (992, 1944, 96);
+INSERT INTO orders VALUES (993, 1951, 9);
+INSERT INTO orders VALUES (994, 1958, 22);
+INSERT INTO orders VALUES (995, 1965, 35);
+INSERT INTO orders VALUES (996, 1972, 48);
+INSERT INTO orders VALUES (997, 1979, 61);
+INSERT INTO orders VALUES (998, 1986, 74);
+INSERT INTO orders VALUES (999, 1993, 87);
+INSERT INTO orders VALUES (1000, 2000, 0);
+INSERT INTO orders VALUES (1001, 2007, 13);
+INSERT INTO orders VALUES (1002, 2014, 26);
+INSERT INTO orders VALUES (1003, 2021, 39);
+INSERT INTO orders VALUES (1004, 2028, 52);
+INSERT INTO orders VALUES (1005, 2035, 65);
+INSERT INTO orders VALUES (1006, 2042, 78);
+INSERT INTO orders VALUES (1007, 2049, 91);
+INSERT INTO orders VALUES (1008, 2056, 4);
+INSERT INTO orders VALUES (1009, 2063, 17);
+INSERT INTO orders VALUES (1010, 2070, 30);
+INSERT INTO orders VALUES (1011, 2077, 43);
+INSERT INTO orders VALUES (1012, 2084, 56);
+INSERT INTO orders VALUES (1013, 2091, 69);
+INSERT INTO orders VALUES (1014, 2098, 82);
+INSERT INTO orders VALUES (1015, 2105, 95);
+INSERT INTO orders VALUES (1016, 2112, 8);
+INSERT INTO orders VALUES (1017, 2119, 21);
+INSERT INTO orders VALUES (1018, 2126, 34);
+INSERT INTO orders VALUES (1019, 2133, 47);
+INSERT INTO orders VALUES (1020, 2140, 60);
+INSERT INTO orders VALUES (1021, 2147, 73);
+INSERT INTO orders VALUES (1022, 2154, 86);
+INSERT INTO orders VALUES (1023, 2161, 99);
+INSERT INTO orders VALUES (1024, 2168, 12);
+INSERT INTO orders VALUES (1025, 2175, 25);
+INSERT INTO orders VALUES (1026, 2182, 38);
+INSERT INTO orders VALUES (1027, 2189, 51);
+INSERT INTO orders VALUES (1028, 2196, 64);
+INSERT INTO orders VALUES (1029, 2203, 77);
+INSERT INTO orders VALUES (1030, 2210, 90);
+INSERT INTO orders VALUES (1031, 2217, 3);
+INSERT INTO orders VALUES (1032, 2224, 16);
+INSERT INTO orders VALUES (1033, 2231, 29);
+INSERT INTO orders VALUES (1034, 2238, 42);
+INSERT INTO orders VALUES (1035, 2245, 55);
+INSERT INTO orders VALUES (1036, 2252, 68);
+INSERT INTO orders VALUES (1037, 2259, 81);
+INSERT INTO orders VALUES (1038, 2266, 94);
+INSERT INTO orders VALUES (1039, 2273, 7);
+INSERT INTO orders VALUES (1040, 2280, 20);
+INSERT INTO orders VALUES (1041, 2287, 33);
+INSERT INTO orders VALUES (1042, 2294, 46);
+INSERT INTO orders VALUES (1043, 2301, 59);
+INSERT INTO orders VALUES (1044, 2308, 72);
+INSERT INTO orders VALUES (1045, 2315, 85);
+INSERT INTO orders VALUES (1046, 2322, 98);
+INSERT INTO orders VALUES (1047, 2329, 11);
+INSERT INTO orders VALUES (1048, 2336, 24);
+INSERT INTO orders VALUES (1049, 2343, 37);
+INSERT INTO orders VALUES (1050, 2350, 50);
+INSERT INTO orders VALUES (1051, 2357, 63);
+INSERT INTO orders VALUES (1052, 2364, 76);
+INSERT INTO orders VALUES (1053, 2371, 89);
+INSERT INTO orders VALUES (1054, 2378, 2);
+INSERT INTO orders VALUES (1055, 2385, 15);
+INSERT INTO orders VALUES (1056, 2392, 28);
+INSERT INTO orders VALUES (1057, 2399, 41);
+INSERT INTO orders VALUES (1058, 2406, 54);
+INSERT INTO orders VALUES (1059, 2413, 67);
+INSERT INTO orders VALUES (1060, 2420, 80);
+INSERT INTO orders VALUES (1061, 2427, 93);
+INSERT INTO orders VALUES (1062, 2434, 6);
+INSERT INTO orders VALUES (1063, 2441, 19);
+INSERT INTO orders VALUES (1064, 2448, 32);
+INSERT INTO orders VALUES (1065, 2455, 45);
+INSERT INTO orders VALUES (1066, 2462, 58);
+INSERT INTO orders VALUES (1067, 2469, 71);
+INSERT INTO orders VALUES (1068, 2476, 84);
+INSERT INTO orders VALUES (1069, 2483, 97);
+INSERT INTO orders VALUES (1070, 2490, 10);
+INSERT INTO orders VALUES (1071, 2497, 23);
+INSERT INTO orders VALUES (1072, 2504, 36);
+INSERT INTO orders VALUES (1073, 2511, 49);
+INSERT INTO orders VALUES (1074, 2518, 62);
+INSERT INTO orders VALUES (1075, 2525, 75);
+INSERT INTO orders VALUES (1076, 2532, 88);
+INSERT INTO orders VALUES (1077, 2539, 1);
+INSERT INTO orders VALUES (1078, 2546, 14);
+INSERT INTO orders VALUES (1079, 2553, 27);
+INSERT INTO orders VALUES (1080, 2560, 40);
+INSERT INTO orders VALUES (1081, 2567, 53);
+INSERT INTO orders VALUES (1082, 2574, 66);
+INSERT INTO orders VALUES (1083, 2581, 79);
+INSERT INTO orders VALUES (1084, 2588, 92);
+INSERT INTO orders VALUES (1085, 2595, 5);
+INSERT INTO orders VALUES (1086, 2602, 18);
+INSERT INTO orders VALUES (1087, 2609, 31);
+INSERT INTO orders VALUES (1088, 2616, 44);
+INSERT INTO orders VALUES (1089, 2623, 57);
+INSERT INTO orders VALUES (1090, 2630, 70);
+INSERT INTO orders VALUES (1091, 2637, 83);
+INSERT INTO orders VALUES (1092, 2644, 96);
+INSERT INTO orders VALUES (1093, 2651, 9);
+INSERT INTO orders VALUES (1094, 2658, 22);
+INSERT INTO orders VALUES (1095, 2665, 35);
+INSERT INTO orders VALUES (1096, 2672, 48);
+INSERT INTO orders VALUES (1097, 2679, 61);
+INSERT INTO orders VALUES (1098, 2686, 74);
+INSERT INTO orders VALUES (1099, 2693, 87);
+INSERT INTO orders VALUES (1100, 2700, 0);
+INSERT INTO orders VALUES (1101, 2707, 13);
+INSERT INTO orders VALUES (1102, 2714, 26);
+INSERT INTO orders VALUES (1103, 2721, 39);
+INSERT INTO orders VALUES (1104, 2728, 52);
+INSERT INTO orders VALUES (1105, 2735, 65);
+INSERT INTO orders VALUES (1106, 2742, 78);
+INSERT INTO orders VALUES (1107, 2749, 91);
+INSERT INTO orders VALUES (1108, 2756, 4);
+INSERT INTO orders VALUES (1109, 2763, 17);
+INSERT INTO orders VALUES (1110, 2770, 30);
+INSERT INTO orders VALUES (1111, 2777, 43);
+INSERT INTO orders VALUES (1112, 2784, 56);
+INSERT INTO orders VALUES (1113, 2791, 69);
+INSERT INTO orders VALUES (1114, 2798, 82);
+INSERT INTO orders VALUES (1115, 2805, 95);
+INSERT INTO orders VALUES (1116, 2812, 8);
+INSERT INTO orders VALUES (1117, 2819, 21);
+INSERT INTO orders VALUES (1118, 2826, 34);
+INSERT INTO orders VALUES (1119, 2833, 47);
+INSERT INTO orders VALUES (1120, 2840, 60);
+INSERT INTO orders VALUES (1121, 2847, 73);
+INSERT INTO orders VALUES (1122, 2854, 86);
+INSERT INTO orders VALUES (1123, 2861, 99);
+INSERT INTO orders VALUES (1124, 2868, 12);
+INSERT INTO orders VALUES (1125, 2875, 25);
+INSERT INTO orders VALUES (1126, 2882, 38);
+INSERT INTO orders VALUES (1127, 2889, 51);
+INSERT INTO orders VALUES (1128, 2896, 64);
+INSERT INTO orders VALUES (1129, 2903, 77);
+INSERT INTO orders VALUES (1130, 2910, 90);
+INSERT INTO orders VALUES (1131, 2917, 3);
+INSERT INTO orders VALUES (1132, 2924, 16);
+INSERT INTO orders VALUES (1133, 2931, 29);
+INSERT INTO orders VALUES (1134, 2938, 42);
+INSERT INTO orders VALUES (1135, 2945, 55);
+INSERT INTO orders VALUES (1136, 2952, 68);
+INSERT INTO orders VALUES (1137, 2959, 81);
+INSERT INTO orders VALUES (1138, 2966, 94);
+INSERT INTO orders VALUES (1139, 2973, 7);
+INSERT INTO orders VALUES (1140, 2980, 20);
+INSERT INTO orders VALUES (1141, 2987, 33);
+INSERT INTO orders VALUES (1142, 2994, 46);
+INSERT INTO orders VALUES (1143, 3001, 59);
+INSERT INTO orders VALUES (1144, 3008, 72);
+INSERT INTO orders VALUES (1145, 3015, 85);
+INSERT INTO orders VALUES (1146, 3022, 98);
+INSERT INTO orders VALUES (1147, 3029, 11);
+INSERT INTO orders VALUES (1148, 3036, 24);
+INSERT INTO orders VALUES (1149, 3043, 37);
+INSERT INTO orders VALUES (1150, 3050, 50);
+INSERT INTO orders VALUES (1151, 3057, 63);
+INSERT INTO orders VALUES (1152, 3064, 76);
+INSERT INTO orders VALUES (1153, 3071, 89);
+INSERT INTO orders VALUES (1154, 3078, 2);
+INSERT INTO orders VALUES (1155, 3085, 15);
+INSERT INTO orders VALUES (1156, 3092, 28);
+INSERT INTO orders VALUES (1157, 3099, 41);
+INSERT INTO orders VALUES (1158, 3106, 54);
+INSERT INTO orders VALUES (1159, 3113, 67);
+INSERT INTO orders VALUES (1160, 3120, 80);
+INSERT INTO orders VALUES (1161, 3127, 93);
+INSERT INTO orders VALUES (1162, 3134, 6);
+INSERT INTO orders VALUES (1163, 3141, 19);
+INSERT INTO orders VALUES (1164, 3148, 32);
+INSERT INTO orders VALUES (1165, 3155, 45);
+INSERT INTO orders VALUES (1166, 3162, 58);
+INSERT INTO orders VALUES (1167, 3169, 71);
+INSERT INTO orders VALUES (1168, 3176, 84);
+INSERT INTO orders VALUES (1169, 3183, 97);
+INSERT INTO orders VALUES (1170, 3190, 10);
+INSERT INTO orders VALUES (1171, 3197, 23);
+INSERT INTO orders VALUES (1172, 3204, 36);
+INSERT INTO orders VALUES (1173, 3211, 49);
+INSERT INTO orders VALUES (1174, 3218, 62);
+INSERT INTO orders VALUES (1175, 3225, 75);
+INSERT INTO orders VALUES (1176, 3232, 88);
+INSERT INTO orders VALUES (1177, 3239, 1);
+INSERT INTO orders VALUES (1178, 3246, 14);
+INSERT INTO orders VALUES (1179, 3253, 27);
+INSERT INTO orders VALUES (1180, 3260, 40);
+INSERT INTO orders VALUES (1181, 3267, 53);
+INSERT INTO orders VALUES (1182, 3274, 66);
+INSERT INTO orders VALUES (1183, 3281, 79);
+INSERT INTO orders VALUES (1184, 3288, 92);
+INSERT INTO orders VALUES (1185, 3295, 5);
+INSERT INTO orders VALUES (1186, 3302, 18);
+INSERT INTO orders VALUES (1187, 3309, 31);
+INSERT INTO orders VALUES (1188, 3316, 44);
+INSERT INTO orders VALUES (1189, 3323, 57);
+INSERT INTO orders VALUES (1190, 3330, 70);
+INSERT INTO orders VALUES (1191, 3337, 83);
+INSERT INTO orders VALUES (1192, 3344, 96);
+INSERT INTO orders VALUES (1193, 3351, 9);
+INSERT INTO orders VALUES (1194, 3358, 22);
+INSERT INTO orders VALUES (1195, 3365, 35);
+INSERT INTO orders VALUES (1196, 3372, 48);
+INSERT INTO orders VALUES (1197, 3379, 61);
+INSERT INTO orders VALUES (1198, 3386, 74);
+INSERT INTO orders VALUES (1199, 3393, 87);
+INSERT INTO orders VALUES (1200, 3400, 0);
+INSERT INTO orders VALUES (1201, 3407, 13);
+INSERT INTO orders VALUES (1202, 3414, 26);
+INSERT INTO orders VALUES (1203, 3421, 39);
+INSERT INTO orders VALUES (1204, 3428, 52);
+INSERT INTO orders VALUES (1205, 3435, 65);
+INSERT INTO orders VALUES (1206, 3442, 78);
+INSERT INTO orders VALUES (1207, 3449, 91);
+INSERT INTO orders VALUES (1208, 3456, 4);
+INSERT INTO orders VALUES (1209, 3463, 17);
+INSERT INTO orders VALUES (1210, 3470, 30);
+INSERT INTO orders VALUES (1211, 3477, 43);
+INSERT INTO orders VALUES (1212, 3484, 56);
+INSERT INTO orders VALUES (1213, 3491, 69);
+INSERT INTO orders VALUES (1214, 3498, 82);
+INSERT INTO orders VALUES (1215, 3505, 95);
+INSERT INTO orders VALUES (1216, 3512, 8);
+INSERT INTO orders VALUES (1217, 3519, 21);
+INSERT INTO orders VALUES (1218, 3526, 34);
+INSERT INTO orders VALUES (1219, 3533, 47);
+INSERT INTO orders VALUES (1220, 3540, 60);
+INSERT INTO orders VALUES (1221, 3547, 73);
+INSERT INTO orders VALUES (1222, 3554, 86);
+INSERT INTO orders VALUES (1223, 3561, 99);
+INSERT INTO orders VALUES (1224, 3568, 12);
+INSERT INTO orders VALUES (1225, 3575, 25);
+INSERT INTO orders VALUES (1226, 3582, 38);
+INSERT INTO orders VALUES (1227, 3589, 51);
+INSERT INTO orders VALUES (1228, 3596, 64);
+INSERT INTO orders VALUES (1229, 3603, 77);
+INSERT INTO orders VALUES (1230, 3610, 90);
+INSERT INTO orders VALUES (1231, 3617, 3);
+INSERT INTO orders VALUES (1232, 3624, 16);
+INSERT INTO orders VALUES (1233, 3631, 29);
+INSERT INTO orders VALUES (1234, 3638, 42);
+INSERT INTO orders VALUES (1235, 3645, 55);
+INSERT INTO orders VALUES (1236, 3652, 68);
+INSERT INTO orders VALUES (1237, 3659, 81);
+INSERT INTO orders VALUES (1238, 3666, 94);
+INSERT INTO orders VALUES (1239, 3673, 7);
+INSERT INTO orders VALUES (1240, 3680, 20);
+INSERT INTO orders VALUES (1241, 3687, 33);
+INSERT INTO orders VALUES (1242, 3694, 46);
+INSERT INTO orders VALUES (1243, 3701, 59);
+INSERT INTO orders VALUES (1244, 3708, 72);
+INSERT INTO orders VALUES (1245, 3715, 85);
+INSERT INTO orders VALUES (1246, 3722, 98);
+INSERT INTO orders VALUES (1247, 3729, 11);
+INSERT INTO orders VALUES (1248, 3736, 24);
+INSERT INTO orders VALUES (1249, 3743, 37);
+INSERT INTO orders VALUES (1250, 3750, 50);
+INSERT INTO orders VALUES (1251, 3757, 63);
+INSERT INTO orders VALUES (1252, 3764, 76);
+INSERT INTO orders VALUES (1253, 3771, 89);
+INSERT INTO orders VALUES (1254, 3778, 2);
+INSERT INTO orders VALUES (1255, 3785, 15);
+INSERT INTO orders VALUES (1256, 3792, 28);
+INSERT INTO orders VALUES (1257, 3799, 41);
+INSERT INTO orders VALUES (1258, 3806, 54);
+INSERT INTO orders VALUES (1259, 3813, 67);
+INSERT INTO orders VALUES (1260, 3820, 80);
+INSERT INTO orders VALUES (1261, 3827, 93);
+INSERT INTO orders VALUES (1262, 3834, 6);
+INSERT INTO orders VALUES (1263, 3841, 19);
+INSERT INTO orders VALUES (1264, 3848, 32);
+INSERT INTO orders VALUES (1265, 3855, 45);
+INSERT INTO orders VALUES (1266, 3862, 58);
+INSERT INTO orders VALUES (1267, 3869, 71);
+INSERT INTO orders VALUES (1268, 3876, 84);
+INSERT INTO orders VALUES (1269, 3883, 97);
+INSERT INTO orders VALUES (1270, 3890, 10);
+INSERT INTO orders VALUES (1271, 3897, 23);
+INSERT INTO orders VALUES (1272, 3904, 36);
+INSERT INTO orders VALUES (1273, 3911, 49);
+INSERT INTO orders VALUES (1274, 3918, 62);
+INSERT INTO orders VALUES (1275, 3925, 75);
+INSERT INTO orders VALUES (1276, 3932, 88);
+INSERT INTO orders VALUES (1277, 3939, 1);
+INSERT INTO orders VALUES (1278, 3946, 14);
+INSERT INTO orders VALUES (1279, 3953, 27);
+INSERT INTO orders VALUES (1280, 3960, 40);
+INSERT INTO orders VALUES (1281, 3967, 53);
+INSERT INTO orders VALUES (1282, 3974, 66);
+INSERT INTO orders VALUES (1283, 3981, 79);
+INSERT INTO orders VALUES (1284, 3988, 92);
+INSERT INTO orders VALUES (1285, 3995, 5);
+INSERT INTO orders VALUES (1286, 4002, 18);
+INSERT INTO orders VALUES (1287, 4009, 31);
+INSERT INTO orders VALUES (1288, 4016, 44);
+INSERT INTO orders VALUES (1289, 4023, 57);
+INSERT INTO orders VALUES (1290, 4030, 70);
+INSERT INTO orders VALUES (1291, 4037, 83);
+INSERT INTO orders VALUES (1292, 4044, 96);
+INSERT INTO orders VALUES (1293, 4051, 9);
+INSERT INTO orders VALUES (1294, 4058, 22);
+INSERT INTO orders VALUES (1295, 4065, 35);
+INSERT INTO orders VALUES (1296, 4072, 48);
+INSERT INTO orders VALUES (1297, 4079, 61);
+INSERT INTO orders VALUES (1298, 4086, 74);
+INSERT INTO orders VALUES (1299, 4093, 87);
+INSERT INTO orders VALUES (1300, 4100, 0);
+INSERT INTO orders VALUES (1301, 4107, 13);
+INSERT INTO orders VALUES (1302, 4114, 26);
+INSERT INTO orders VALUES (1303, 4121, 39);
+INSERT INTO orders VALUES (1304, 4128, 52);
+INSERT INTO orders VALUES (1305, 4135, 65);
+INSERT INTO orders VALUES (1306, 4142, 78);
+INSERT INTO orders VALUES (1307, 4149, 91);
+INSERT INTO orders VALUES (1308, 4156, 4);
+INSERT INTO orders VALUES (1309, 4163, 17);
+INSERT INTO orders VALUES (1310, 4170, 30);
+INSERT INTO orders VALUES (1311, 4177, 43);
+INSERT INTO orders VALUES (1312, 4184, 56);
+INSERT INTO orders VALUES (1313, 4191, 69);
+INSERT INTO orders VALUES (1314, 4198, 82);
+INSERT INTO orders VALUES (1315, 4205, 95);
+INSERT INTO orders VALUES (1316, 4212, 8);
+INSERT INTO orders VALUES (1317, 4219, 21);
+INSERT INTO orders VALUES (1318, 4226, 34);
+INSERT INTO orders VALUES (1319, 4233, 47);
+INSERT INTO orders VALUES (1320, 4240, 60);
+INSERT INTO orders VALUES (1321, 4247, 73);
+INSERT INTO orders VALUES (1322, 4254, 86);
+INSERT INTO orders VALUES (1323, 4261, 99);
+INSERT INTO orders VALUES (1324, 4268, 12);
+INSERT INTO orders VALUES (1325, 4275, 25);
+INSERT INTO orders VALUES (1326, 4282, 38);
+INSERT INTO orders VALUES (1327, 4289, 51);
+INSERT INTO orders VALUES (1328, 4296, 64);
+INSERT INTO orders VALUES (1329, 4303, 77);
+INSERT INTO orders VALUES (1330, 4310, 90);
+INSERT INTO orders VALUES (1331, 4317, 3);
+INSERT INTO orders VALUES (1332, 4324, 16);
+INSERT INTO orders VALUES (1333, 4331, 29);
+INSERT INTO orders VALUES (1334, 4338, 42);
+INSERT INTO orders VALUES (1335, 4345, 55);
+INSERT INTO orders VALUES (1336, 4352, 68);
+INSERT INTO orders VALUES (1337, 4359, 81);
+INSERT INTO orders VALUES (1338, 4366, 94);
+INSERT INTO orders VALUES (1339, 4373, 7);
+INSERT INTO orders VALUES (1340, 4380, 20);
+INSERT INTO orders VALUES (1341, 4387, 33);
+INSERT INTO orders VALUES (1342, 4394, 46);
+INSERT INTO orders VALUES (1343, 4401, 59);
+INSERT INTO orders VALUES (1344, 4408, 72);
+INSERT INTO orders VALUES (1345, 4415, 85);
+INSERT INTO orders VALUES (1346, 4422, 98);
+INSERT INTO orders VALUES (1347, 4429, 11);
+INSERT INTO orders VALUES (1348, 4436, 24);
+INSERT INTO orders VALUES (1349, 4443, 37);
+INSERT INTO orders VALUES (1350, 4450, 50);
+INSERT INTO orders VALUES (1351, 4457, 63);
+INSERT INTO orders VALUES (1352, 4464, 76);
+INSERT INTO orders VALUES (1353, 4471, 89);
+INSERT INTO orders VALUES (1354, 4478, 2);
+INSERT INTO orders VALUES (1355, 4485, 15);
+INSERT INTO orders VALUES (1356, 4492, 28);
+INSERT INTO orders VALUES (1357, 4499, 41);
+INSERT INTO orders VALUES (1358, 4506, 54);
+INSERT INTO orders VALUES (1359, 4513, 67);
+INSERT INTO orders VALUES (1360, 4520, 80);
+INSERT INTO orders VALUES (1361, 4527, 93);
+INSERT INTO orders VALUES (1362, 4534, 6);
+INSERT INTO orders VALUES (1363, 4541, 19);
+INSERT INTO orders VALUES (1364, 4548, 32);
+INSERT INTO orders VALUES (1365, 4555, 45);
+INSERT INTO orders VALUES (1366, 4562, 58);
+INSERT INTO orders VALUES (1367, 4569, 71);
+INSERT INTO orders VALUES (1368, 4576, 84);
+INSERT INTO orders VALUES (1369, 4583, 97);
+INSERT INTO orders VALUES (1370, 4590, 10);
+INSERT INTO orders VALUES (1371, 4597, 23);
+INSERT INTO orders VALUES (1372, 4604, 36);
+INSERT INTO orders VALUES (1373, 4611, 49);
+INSERT INTO orders VALUES (1374, 4618, 62);
+INSERT INTO orders VALUES (1375, 4625, 75);
+INSERT INTO orders VALUES (1376, 4632, 88);
+INSERT INTO orders VALUES (1377, 4639, 1);
+INSERT INTO orders VALUES (1378, 4646, 14);
+INSERT INTO orders VALUES (1379, 4653, 27);
+INSERT INTO orders VALUES (1380, 4660, 40);
+INSERT INTO orders VALUES (1381, 4667, 53);
+INSERT INTO orders VALUES (1382, 4674, 66);
+INSERT INTO orders VALUES (1383, 4681, 79);
+INSERT INTO orders VALUES (1384, 4688, 92);
+INSERT INTO orders VALUES (1385, 4695, 5);
+INSERT INTO orders VALUES (1386, 4702, 18);
+INSERT INTO orders VALUES (1387, 4709, 31);
+INSERT INTO orders VALUES (1388, 4716, 44);
+INSERT INTO orders VALUES (1389, 4723, 57);
+INSERT INTO orders VALUES (1390, 4730, 70);
+INSERT INTO orders VALUES (1391, 4737, 83);
+INSERT INTO orders VALUES (1392, 4744, 96);
+INSERT INTO orders VALUES (1393, 4751, 9);
+INSERT INTO orders VALUES (1394, 4758, 22);
+INSERT INTO orders VALUES (1395, 4765, 35);
+INSERT INTO orders VALUES (1396, 4772, 48);
+INSERT INTO orders VALUES (1397, 4779, 61);
+INSERT INTO orders VALUES (1398, 4786, 74);
+INSERT INTO orders VALUES (1399, 4793, 87);
+INSERT INTO orders VALUES (1400, 4800, 0);
+INSERT INTO orders VALUES (1401, 4807, 13);
+INSERT INTO orders VALUES (1402, 4814, 26);
+INSERT INTO orders VALUES (1403, 4821, 39);
+INSERT INTO orders VALUES (1404, 4828, 52);
+INSERT INTO orders VALUES (1405, 4835, 65);
+INSERT INTO orders VALUES (1406, 4842, 78);
+INSERT INTO orders VALUES (1407, 4849, 91);
+INSERT INTO orders VALUES (1408, 4856, 4);
+INSERT INTO orders VALUES (1409, 4863, 17);
+INSERT INTO orders VALUES (1410, 4870, 30);
+INSERT INTO orders VALUES (1411, 4877, 43);
+INSERT INTO orders VALUES (1412, 4884, 56);
+INSERT INTO orders VALUES (1413, 4891, 69);
+INSERT INTO orders VALUES (1414, 4898, 82);
+INSERT INTO orders VALUES (1415, 4905, 95);
+INSERT INTO orders VALUES (1416, 4912, 8);
+INSERT INTO orders VALUES (1417, 4919, 21);
+INSERT INTO orders VALUES (1418, 4926, 34);
+INSERT INTO orders VALUES (1419, 4933, 47);
+INSERT INTO orders VALUES (1420, 4940, 60);
+INSERT INTO orders VALUES (1421, 4947, 73);
+INSERT INTO orders VALUES (1422, 4954, 86);
+INSERT INTO orders VALUES (1423, 4961, 99);
+INSERT INTO orders VALUES (1424, 4968, 12);
+INSERT INTO orders VALUES (1425, 4975, 25);
+INSERT INTO orders VALUES (1426, 4982, 38);
+INSERT INTO orders VALUES (1427, 4989, 51);
+INSERT INTO orders VALUES (1428, 4996, 64);
+INSERT INTO orders VALUES (1429, 3, 77);
+INSERT INTO orders VALUES (1430, 10, 90);
+INSERT INTO orders VALUES (1431, 17, 3);
+INSERT INTO orders VALUES (1432, 24, 16);
+INSERT INTO orders VALUES (1433, 31, 29);
+INSERT INTO orders VALUES (1434, 38, 42);
+INSERT INTO orders VALUES (1435, 45, 55);
+INSERT INTO orders VALUES (1436, 52, 68);
+INSERT INTO orders VALUES (1437, 59, 81);
+INSERT INTO orders VALUES (1438, 66, 94);
+INSERT INTO orders VALUES (1439, 73, 7);
+INSERT INTO orders VALUES (1440, 80, 20);
+INSERT INTO orders VALUES (1441, 87, 33);
+INSERT INTO orders VALUES (1442, 94, 46);
+INSERT INTO orders VALUES (1443, 101, 59);
+INSERT INTO orders VALUES (1444, 108, 72);
+INSERT INTO orders VALUES (1445, 115, 85);
+INSERT INTO orders VALUES (1446, 122, 98);
+INSERT INTO orders VALUES (1447, 129, 11);
+INSERT INTO orders VALUES (1448, 136, 24);
+INSERT INTO orders VALUES (1449, 143, 37);
+INSERT INTO orders VALUES (1450, 150, 50);
+INSERT INTO orders VALUES (1451, 157, 63);
+INSERT INTO orders VALUES (1452, 164, 76);
+INSERT INTO orders VALUES (1453, 171, 89);
+INSERT INTO orders VALUES (1454, 178, 2);
+INSERT INTO orders VALUES (1455, 185, 15);
+INSERT INTO orders VALUES (1456, 192, 28);
+INSERT INTO orders VALUES (1457, 199, 41);
+INSERT INTO orders VALUES (1458, 206, 54);
+INSERT INTO orders VALUES (1459, 213, 67);
+INSERT INTO orders VALUES (1460, 220, 80);
+INSERT INTO orders VALUES (1461, 227, 93);
+INSERT INTO orders VALUES (1462, 234, 6);
+INSERT INTO orders VALUES (1463, 241, 19);
+INSERT INTO orders VALUES (1464, 248, 32);
+INSERT INTO orders VALUES (1465, 255, 45);
+INSERT INTO orders VALUES (1466, 262, 58);
+INSERT INTO orders VALUES (1467, 269, 71);
+INSERT INTO orders VALUES (1468, 276, 84);
+INSERT INTO orders VALUES (1469, 283, 97);
+INSERT INTO orders VALUES (1470, 290, 10);
+INSERT INTO orders VALUES (1471, 297, 23);
+INSERT INTO orders VALUES (1472, 304, 36);
+INSERT INTO orders VALUES (1473, 311, 49);
+INSERT INTO orders VALUES (1474, 318, 62);
+INSERT INTO orders VALUES (1475, 325, 75);
+INSERT INTO orders VALUES (1476, 332, 88);
+INSERT INTO orders VALUES (1477, 339, 1);
+INSERT INTO orders VALUES (1478, 346, 14);
+INSERT INTO orders VALUES (1479, 353, 27);
+INSERT INTO orders VALUES (1480, 360, 40);
+INSERT INTO orders VALUES (1481, 367, 53);
+INSERT INTO orders VALUES (1482, 374, 66);
+INSERT INTO orders VALUES (1483, 381, 79);
+INSERT INTO orders VALUES (1484, 388, 92);
+INSERT INTO orders VALUES (1485, 395, 5);
+INSERT INTO orders VALUES (1486, 402, 18);
+INSERT INTO orders VALUES (1487, 409, 31);
+INSERT INTO orders VALUES (1488, 416, 44);
+INSERT INTO orders VALUES (1489, 423, 57);
+INSERT INTO orders VALUES (1490, 430, 70);
+INSERT INTO orders VALUES (1491, 437, 83);
+INSERT INTO orders VALUES (1492, 444, 96);
+INSERT INTO orders VALUES (1493, 451, 9);
+INSERT INTO orders VALUES (1494, 458, 22);
+INSERT INTO orders VALUES (1495, 465, 35);
+INSERT INTO orders VALUES (1496, 472, 48);
+INSERT INTO orders VALUES (1497, 479, 61);
+INSERT INTO orders VALUES (1498, 486, 74);
+INSERT INTO orders VALUES (1499, 493, 87);
+INSERT INTO orders VALUES (1500, 500, 0);
+INSERT INTO orders VALUES (1501, 507, 13);
+INSERT INTO orders VALUES (1502, 514, 26);
+INSERT INTO orders VALUES (1503, 521, 39);
+INSERT INTO orders VALUES (1504, 528, 52);
+INSERT INTO orders VALUES (1505, 535, 65);
+INSERT INTO orders VALUES (1506, 542, 78);
+INSERT INTO orders VALUES (1507, 549, 91);
+INSERT INTO orders VALUES (1508, 556, 4);
+INSERT INTO orders VALUES (1509, 563, 17);
+INSERT INTO orders VALUES (1510, 570, 30);
+INSERT INTO orders VALUES (1511, 577, 43);
+INSERT INTO orders VALUES (1512, 584, 56);
+INSERT INTO orders VALUES (1513, 591, 69);
+INSERT INTO orders VALUES (1514, 598, 82);
+INSERT INTO orders VALUES (1515, 605, 95);
+INSERT INTO orders VALUES (1516, 612, 8);
+INSERT INTO orders VALUES (1517, 619, 21);
+INSERT INTO orders VALUES (1518, 626, 34);
+INSERT INTO orders VALUES (1519, 633, 47);
+INSERT INTO orders VALUES (1520, 640, 60);
+INSERT INTO orders VALUES (1521, 647, 73);
+INSERT INTO orders VALUES (1522, 654, 86);
+INSERT INTO orders VALUES (1523, 661, 99);
+INSERT INTO orders VALUES (1524, 668, 12);
+INSERT INTO orders VALUES (1525, 675, 25);
+INSERT INTO orders VALUES (1526, 682, 38);
+INSERT INTO orders VALUES (1527, 689, 51);
+INSERT INTO orders VALUES (1528, 696, 64);
+INSERT INTO orders VALUES (1529, 703, 77);
+INSERT INTO orders VALUES (1530, 710, 90);
+INSERT INTO orders VALUES (1531, 717, 3);
+INSERT INTO orders VALUES (1532, 724, 16);
+INSERT INTO orders VALUES (1533, 731, 29);
+INSERT INTO orders VALUES (1534, 738, 42);
+INSERT INTO orders VALUES (1535, 745, 55);
+INSERT INTO orders VALUES (1536, 752, 68);
+INSERT INTO orders VALUES (1537, 759, 81);
+INSERT INTO orders VALUES (1538, 766, 94);
+INSERT INTO orders VALUES (1539, 773, 7);
+INSERT INTO orders VALUES (1540, 780, 20);
+INSERT INTO orders VALUES (1541, 787, 33);
+INSERT INTO orders VALUES (1542, 794, 46);
+INSERT INTO orders VALUES (1543, 801, 59);
+INSERT INTO orders VALUES (1544, 808, 72);
+INSERT INTO orders VALUES (1545, 815, 85);
+INSERT INTO orders VALUES (1546, 822, 98);
+INSERT INTO orders VALUES (1547, 829, 11);
+INSERT INTO orders VALUES (1548, 836, 24);
+INSERT INTO orders VALUES (1549, 843, 37);
+INSERT INTO orders VALUES (1550, 850, 50);
+INSERT INTO orders VALUES (1551, 857, 63);
+INSERT INTO orders VALUES (1552, 864, 76);
+INSERT INTO orders VALUES (1553, 871, 89);
+INSERT INTO orders VALUES (1554, 878, 2);
+INSERT INTO orders VALUES (1555, 885, 15);
+INSERT INTO orders VALUES (1556, 892, 28);
+INSERT INTO orders VALUES (1557, 899, 41);
+INSERT INTO orders VALUES (1558, 906, 54);
+INSERT INTO orders VALUES (1559, 913, 67);
+INSERT INTO orders VALUES (1560, 920, 80);
+INSERT INTO orders VALUES (1561, 927, 93);
+INSERT INTO orders VALUES (1562, 934, 6);
+INSERT INTO orders VALUES (1563, 941, 19);
+INSERT INTO orders VALUES (1564, 948, 32);
+INSERT INTO orders VALUES (1565, 955, 45);
+INSERT INTO orders VALUES (1566, 962, 58);
+INSERT INTO orders VALUES (1567, 969, 71);
+INSERT INTO orders VALUES (1568, 976, 84);
+INSERT INTO orders VALUES (1569, 983, 97);
+INSERT INTO orders VALUES (1570, 990, 10);
+INSERT INTO orders VALUES (1571, 997, 23);
+INSERT INTO orders VALUES (1572, 1004, 36);
+INSERT INTO orders VALUES (1573, 1011, 49);
+INSERT INTO orders VALUES (1574, 1018, 62);
+INSERT INTO orders VALUES (1575, 1025, 75);
+INSERT INTO orders VALUES (1576, 1032, 88);
+INSERT INTO orders VALUES (1577, 1039, 1);
+INSERT INTO orders VALUES (1578, 1046, 14);
+INSERT INTO orders VALUES (1579, 1053, 27);
+INSERT INTO orders VALUES (1580, 1060, 40);
+INSERT INTO orders VALUES (1581, 1067, 53);
+INSERT INTO orders VALUES (1582, 1074, 66);
+INSERT INTO orders VALUES (1583, 1081, 79);
+INSERT INTO orders VALUES (1584, 1088, 92);
+INSERT INTO orders VALUES (1585, 1095, 5);
+INSERT INTO orders VALUES (1586, 1102, 18);
+INSERT INTO orders VALUES (1587, 1109, 31);
+INSERT INTO orders VALUES (1588, 1116, 44);
+INSERT INTO orders VALUES (1589, 1123, 57);
+INSERT INTO orders VALUES (1590, 1130, 70);
+INSERT INTO orders VALUES (1591, 1137, 83);
+INSERT INTO orders VALUES (1592, 1144, 96);
+INSERT INTO orders VALUES (1593, 1151, 9);
+INSERT INTO orders VALUES (1594, 1158, 22);
+INSERT INTO orders VALUES (1595, 1165, 35);
+INSERT INTO orders VALUES (1596, 1172, 48);
+INSERT INTO orders VALUES (1597, 1179, 61);
+INSERT INTO orders VALUES (1598, 1186, 74);
+INSERT INTO orders VALUES (1599, 1193, 87);
+INSERT INTO orders VALUES (1600, 1200, 0);
+INSERT INTO orders VALUES (1601, 1207, 13);
+INSERT INTO orders VALUES (1602, 1214, 26);
+INSERT INTO orders VALUES (1603, 1221, 39);
+INSERT INTO orders VALUES (1604, 1228, 52);
+INSERT INTO orders VALUES (1605, 1235, 65);
+INSERT INTO orders VALUES (1606, 1242, 78);
+INSERT INTO orders VALUES (1607, 1249, 91);
+INSERT INTO orders VALUES (1608, 1256, 4);
+INSERT INTO orders VALUES (1609, 1263, 17);
+INSERT INTO orders VALUES (1610, 1270, 30);
+INSERT INTO orders VALUES (1611, 1277, 43);
+INSERT INTO orders VALUES (1612, 1284, 56);
+INSERT INTO orders VALUES (1613, 1291, 69);
+INSERT INTO orders VALUES (1614, 1298, 82);
+INSERT INTO orders VALUES (1615, 1305, 95);
+INSERT INTO orders VALUES (1616, 1312, 8);
+INSERT INTO orders VALUES (1617, 1319, 21);
+INSERT INTO orders VALUES (1618, 1326, 34);
+INSERT INTO orders VALUES (1619, 1333, 47);
+INSERT INTO orders VALUES (1620, 1340, 60);
+INSERT INTO orders VALUES (1621, 1347, 73);
+INSERT INTO orders VALUES (1622, 1354, 86);
+INSERT INTO orders VALUES (1623, 1361, 99);
+INSERT INTO orders VALUES (1624, 1368, 12);
+INSERT INTO orders VALUES (1625, 1375, 25);
+INSERT INTO orders VALUES (1626, 1382, 38);
+INSERT INTO orders VALUES (1627, 1389, 51);
+INSERT INTO orders VALUES (1628, 1396, 64);
+INSERT INTO orders VALUES (1629, 1403, 77);
+INSERT INTO orders VALUES (1630, 1410, 90);
+INSERT INTO orders VALUES (1631, 1417, 3);
+INSERT INTO orders VALUES (1632, 1424, 16);
+INSERT INTO orders VALUES (1633, 1431, 29);
+INSERT INTO orders VALUES (1634, 1438, 42);
+INSERT INTO orders VALUES (1635, 1445, 55);
+INSERT INTO orders VALUES (1636, 1452, 68);
+INSERT INTO orders VALUES (1637, 1459, 81);
+INSERT INTO orders VALUES (1638, 1466, 94);
+INSERT INTO orders VALUES (1639, 1473, 7);
+INSERT INTO orders VALUES (1640, 1480, 20);
+INSERT INTO orders VALUES (1641, 1487, 33);
+INSERT INTO orders VALUES (1642, 1494, 46);
+INSERT INTO orders VALUES (1643, 1501, 59);
+INSERT INTO orders VALUES (1644, 1508, 72);
+INSERT INTO orders VALUES (1645, 1515, 85);
+INSERT INTO orders VALUES (1646, 1522, 98);
+INSERT INTO orders VALUES (1647, 1529, 11);
+INSERT INTO orders VALUES (1648, 1536, 24);
+INSERT INTO orders VALUES (1649, 1543, 37);
+INSERT INTO orders VALUES (1650, 1550, 50);
+INSERT INTO orders VALUES (1651, 1557, 63);
+INSERT INTO orders VALUES (1652, 1564, 76);
+INSERT INTO orders VALUES (1653, 1571, 89);
+INSERT INTO orders VALUES (1654, 1578, 2);
+INSERT INTO orders VALUES (1655, 1585, 15);
+INSERT INTO orders VALUES (1656, 1592, 28);
+INSERT INTO orders VALUES (1657, 1599, 41);
+INSERT INTO orders VALUES (1658, 1606, 54);
+INSERT INTO orders VALUES (1659, 1613, 67);
+INSERT INTO orders VALUES (1660, 1620, 80);
+INSERT INTO orders VALUES (1661, 1627, 93);
+INSERT INTO orders VALUES (1662, 1634, 6);
+INSERT INTO orders VALUES (1663, 1641, 19);
+INSERT INTO orders VALUES (1664, 1648, 32);
+INSERT INTO orders VALUES (1665, 1655, 45);
+INSERT INTO orders VALUES (1666, 1662, 58);
+INSERT INTO orders VALUES (1667, 1669, 71);
+INSERT INTO orders VALUES (1668, 1676, 84);
+INSERT INTO orders VALUES (1669, 1683, 97);
+INSERT INTO orders VALUES (1670, 1690, 10);
+INSERT INTO orders VALUES (1671, 1697, 23);
+INSERT INTO orders VALUES (1672, 1704, 36);
+INSERT INTO orders VALUES (1673, 1711, 49);
+INSERT INTO orders VALUES (1674, 1718, 62);
+INSERT INTO orders VALUES (1675, 1725, 75);
+INSERT INTO orders VALUES (1676, 1732, 88);
+INSERT INTO orders VALUES (1677, 1739, 1);
+INSERT INTO orders VALUES (1678, 1746, 14);
+INSERT INTO orders VALUES (1679, 1753, 27);
+INSERT INTO orders VALUES (1680, 1760, 40);
+INSERT INTO orders VALUES (1681, 1767, 53);
+INSERT INTO orders VALUES (1682, 1774, 66);
+INSERT INTO orders VALUES (1683, 1781, 79);
+INSERT INTO orders VALUES (1684, 1788, 92);
+INSERT INTO orders VALUES (1685, 1795, 5);
+INSERT INTO orders VALUES (1686, 1802, 18);
+INSERT INTO orders VALUES (1687, 1809, 31);
+INSERT INTO orders VALUES (1688, 1816, 44);
+INSERT INTO orders VALUES (1689, 1823, 57);
+INSERT INTO orders VALUES (1690, 1830, 70);
+INSERT INTO orders VALUES (1691, 1837, 83);
+INSERT INTO orders VALUES (1692, 1844, 96);
+INSERT INTO orders VALUES (1693, 1851, 9);
+INSERT INTO orders VALUES (1694, 1858, 22);
+INSERT INTO orders VALUES (1695, 1865, 35);
+INSERT INTO orders VALUES (1696, 1872, 48);
+INSERT INTO orders VALUES (1697, 1879, 61);
+INSERT INTO orders VALUES (1698, 1886, 74);
+INSERT INTO orders VALUES (1699, 1893, 87);
+INSERT INTO orders VALUES (1700, 1900, 0);
+INSERT INTO orders VALUES (1701, 1907, 13);
+INSERT INTO orders VALUES (1702, 1914, 26);
+INSERT INTO orders VALUES (1703, 1921, 39);
+INSERT INTO orders VALUES (1704, 1928, 52);
+INSERT INTO orders VALUES (1705, 1935, 65);
+INSERT INTO orders VALUES (1706, 1942, 78);
+INSERT INTO orders VALUES (1707, 1949, 91);
+INSERT INTO orders VALUES (1708, 1956, 4);
+INSERT INTO orders VALUES (1709, 1963, 17);
+INSERT INTO orders VALUES (1710, 1970, 30);
+INSERT INTO orders VALUES (1711, 1977, 43);
+INSERT INTO orders VALUES (1712, 1984, 56);
+INSERT INTO orders VALUES (1713, 1991, 69);
+INSERT INTO orders VALUES (1714, 1998, 82);
+INSERT INTO orders VALUES (1715, 2005, 95);
+INSERT INTO orders VALUES (1716, 2012, 8);
+INSERT INTO orders VALUES (1717, 2019, 21);
+INSERT INTO orders VALUES (1718, 2026, 34);
+INSERT INTO orders VALUES (1719, 2033, 47);
+INSERT INTO orders VALUES (1720, 2040, 60);
+INSERT INTO orders VALUES (1721, 2047, 73);
+INSERT INTO orders VALUES (1722, 2054, 86);
+INSERT INTO orders VALUES (1723, 2061, 99);
+INSERT INTO orders VALUES (1724, 2068, 12);
+INSERT INTO orders VALUES (1725, 2075, 25);
+INSERT INTO orders VALUES (1726, 2082, 38);
+INSERT INTO orders VALUES (1727, 2089, 51);
+INSERT INTO orders VALUES (1728, 2096, 64);
+INSERT INTO orders VALUES (1729, 2103, 77);
+INSERT INTO orders VALUES (1730, 2110, 90);
+INSERT INTO orders VALUES (1731, 2117, 3);
+INSERT INTO orders VALUES (1732, 2124, 16);
+INSERT INTO orders VALUES (1733, 2131, 29);
+INSERT INTO orders VALUES (1734, 2138, 42);
+INSERT INTO orders VALUES (1735, 2145, 55);
+INSERT INTO orders VALUES (1736, 2152, 68);
+INSERT INTO orders VALUES (1737, 2159, 81);
+INSERT INTO orders VALUES (1738, 2166, 94);
+INSERT INTO orders VALUES (1739, 2173, 7);
+INSERT INTO orders VALUES (1740, 2180, 20);
+INSERT INTO orders VALUES (1741, 2187, 33);
+INSERT INTO orders VALUES (1742, 2194, 46);
+INSERT INTO orders VALUES (1743, 2201, 59);
+INSERT INTO orders VALUES (1744, 2208, 72);
+INSERT INTO orders VALUES (1745, 2215, 85);
+INSERT INTO orders VALUES (1746, 2222, 98);
+INSERT INTO orders VALUES (1747, 2229, 11);
+INSERT INTO orders VALUES (1748, 2236, 24);
+INSERT INTO orders VALUES (1749, 2243, 37);
+INSERT INTO orders VALUES (1750, 2250, 50);
+INSERT INTO orders VALUES (1751, 2257, 63);
+INSERT INTO orders VALUES (1752, 2264, 76);
+INSERT INTO orders VALUES (1753, 2271, 89);
+INSERT INTO orders VALUES (1754, 2278, 2);
+INSERT INTO orders VALUES (1755, 2285, 15);
+INSERT INTO orders VALUES (1756, 2292, 28);
+INSERT INTO orders VALUES (1757, 2299, 41);
+INSERT INTO orders VALUES (1758, 2306, 54);
+INSERT INTO orders VALUES (1759, 2313, 67);
+INSERT INTO orders VALUES (1760, 2320, 80);
+INSERT INTO orders VALUES (1761, 2327, 93);
+INSERT INTO orders VALUES (1762, 2334, 6);
+INSERT INTO orders VALUES (1763, 2341, 19);
+INSERT INTO orders VALUES (1764, 2348, 32);
+INSERT INTO orders VALUES (1765, 2355, 45);
+INSERT INTO orders VALUES (1766, 2362, 58);
+INSERT INTO orders VALUES (1767, 2369, 71);
+INSERT INTO orders VALUES (1768, 2376, 84);
+INSERT INTO orders VALUES (1769, 2383, 97);
+INSERT INTO orders VALUES (1770, 2390, 10);
+INSERT INTO orders VALUES (1771, 2397, 23);
+INSERT INTO orders VALUES (1772, 2404, 36);
+INSERT INTO orders VALUES (1773, 2411, 49);
+INSERT INTO orders VALUES (1774, 2418, 62);
+INSERT INTO orders VALUES (1775, 2425, 75);
+INSERT INTO orders VALUES (1776, 2432, 88);
+INSERT INTO orders VALUES (1777, 2439, 1);
+INSERT INTO orders VALUES (1778, 2446, 14);
+INSERT INTO orders VALUES (1779, 2453, 27);
+INSERT INTO orders VALUES (1780, 2460, 40);
+INSERT INTO orders VALUES (1781, 2467, 53);
+INSERT INTO orders VALUES (1782, 2474, 66);
+INSERT INTO orders VALUES (1783, 2481, 79);
+INSERT INTO orders VALUES (1784, 2488, 92);
+INSERT INTO orders VALUES (1785, 2495, 5);
+INSERT INTO orders VALUES (1786, 2502, 18);
+INSERT INTO orders VALUES (1787, 2509, 31);
+INSERT INTO orders VALUES (1788, 2516, 44);
+INSERT INTO orders VALUES (1789, 2523, 57);
+INSERT INTO orders VALUES (1790, 2530, 70);
+INSERT INTO orders VALUES (1791, 2537, 83);
+INSERT INTO orders VALUES (1792, 2544, 96);
+INSERT INTO orders VALUES (1793, 2551, 9);
+INSERT INTO orders VALUES (1794, 2558, 22);
+INSERT INTO orders VALUES (1795, 2565, 35);
+INSERT INTO orders VALUES (1796, 2572, 48);
+INSERT INTO orders VALUES (1797, 2579, 61);
+INSERT INTO orders VALUES (1798, 2586, 74);
+INSERT INTO orders VALUES (1799, 2593, 87);
+INSERT INTO orders VALUES (1800, 2600, 0);
+INSERT INTO orders VALUES (1801, 2607, 13);
+INSERT INTO orders VALUES (1802, 2614, 26);
+INSERT INTO orders VALUES (1803, 2621, 39);
+INSERT INTO orders VALUES (1804, 2628, 52);
+INSERT INTO orders VALUES (1805, 2635, 65);
+INSERT INTO orders VALUES (1806, 2642, 78);
+INSERT INTO orders VALUES (1807, 2649, 91);
+INSERT INTO orders VALUES (1808, 2656, 4);
+INSERT INTO orders VALUES (1809, 2663, 17);
+INSERT INTO orders VALUES (1810, 2670, 30);
+INSERT INTO orders VALUES (1811, 2677, 43);
+INSERT INTO orders VALUES (1812, 2684, 56);
+INSERT INTO orders VALUES (1813, 2691, 69);
+INSERT INTO orders VALUES (1814, 2698, 82);
+INSERT INTO orders VALUES (1815, 2705, 95);
+INSERT INTO orders VALUES (1816, 2712, 8);
+INSERT INTO orders VALUES (1817, 2719, 21);
+INSERT INTO orders VALUES (1818, 2726, 34);
+INSERT INTO orders VALUES (1819, 2733, 47);
+INSERT INTO orders VALUES (1820, 2740, 60);
+INSERT INTO orders VALUES (1821, 2747, 73);
+INSERT INTO orders VALUES (1822, 2754, 86);
+INSERT INTO orders VALUES (1823, 2761, 99);
+INSERT INTO orders VALUES (1824, 2768, 12);
+INSERT INTO orders VALUES (1825, 2775, 25);
+INSERT INTO orders VALUES (1826, 2782, 38);
+INSERT INTO orders VALUES (1827, 2789, 51);
+INSERT INTO orders VALUES (1828, 2796, 64);
+INSERT INTO orders VALUES (1829, 2803, 77);
+INSERT INTO orders VALUES (1830, 2810, 90);
+INSERT INTO orders VALUES (1831, 2817, 3);
+INSERT INTO orders VALUES (1832, 2824, 16);
+INSERT INTO orders VALUES (1833, 2831, 29);
+INSERT INTO orders VALUES (1834, 2838, 42);
+INSERT INTO orders VALUES (1835, 2845, 55);
+INSERT INTO orders VALUES (1836, 2852, 68);
+INSERT INTO orders VALUES (1837, 2859, 81);
+INSERT INTO orders VALUES (1838, 2866, 94);
+INSERT INTO orders VALUES (1839, 2873, 7);
+INSERT INTO orders VALUES (1840, 2880, 20);
+INSERT INTO orders VALUES (1841, 2887, 33);
+INSERT INTO orders VALUES (1842, 2894, 46);
+INSERT INTO orders VALUES (1843, 2901, 59);
+INSERT INTO orders VALUES (1844, 2908, 72);
+INSERT INTO orders VALUES (1845, 2915, 85);
+INSERT INTO orders VALUES (1846, 2922, 98);
+INSERT INTO orders VALUES (1847, 2929, 11);
+INSERT INTO orders VALUES (1848, 2936, 24);
+INSERT INTO orders VALUES (1849, 2943, 37);
+INSERT INTO orders VALUES (1850, 2950, 50);
+INSERT INTO orders VALUES (1851, 2957, 63);
+INSERT INTO orders VALUES (1852, 2964, 76);
+INSERT INTO orders VALUES (1853, 2971, 89);
+INSERT INTO orders VALUES (1854, 2978, 2);
+INSERT INTO orders VALUES (1855, 2985, 15);
+INSERT INTO orders VALUES (1856, 2992, 28);
+INSERT INTO orders VALUES (1857, 2999, 41);
+INSERT INTO orders VALUES (1858, 3006, 54);
+INSERT INTO orders VALUES (1859, 3013, 67);
+INSERT INTO orders VALUES (1860, 3020, 80);
+INSERT INTO orders VALUES (1861, 3027, 93);
+INSERT INTO orders VALUES (1862, 3034, 6);
+INSERT INTO orders VALUES (1863, 3041, 19);
+INSERT INTO orders VALUES (1864, 3048, 32);
+INSERT INTO orders VALUES (1865, 3055, 45);
+INSERT INTO orders VALUES (1866, 3062, 58);
+INSERT INTO orders VALUES (1867, 3069, 71);
+INSERT INTO orders VALUES (1868, 3076, 84);
+INSERT INTO orders VALUES (1869, 3083, 97);
+INSERT INTO orders VALUES (1870, 3090, 10);
+INSERT INTO orders VALUES (1871, 3097, 23);
+INSERT INTO orders VALUES (1872, 3104, 36);
+INSERT INTO orders VALUES (1873, 3111, 49);
+INSERT INTO orders VALUES (1874, 3118, 62);
+INSERT INTO orders VALUES (1875, 3125, 75);
+INSERT INTO orders VALUES (1876, 3132, 88);
+INSERT INTO orders VALUES (1877, 3139, 1);
+INSERT INTO orders VALUES (1878, 3146, 14);
+INSERT INTO orders VALUES (1879, 3153, 27);
+INSERT INTO orders VALUES (1880, 3160, 40);
+INSERT INTO orders VALUES (1881, 3167, 53);
+INSERT INTO orders VALUES (1882, 3174, 66);
+INSERT INTO orders VALUES (1883, 3181, 79);
+INSERT INTO orders VALUES (1884, 3188, 92);
+INSERT INTO orders VALUES (1885, 3195, 5);
+INSERT INTO orders VALUES (1886, 3202, 18);
+INSERT INTO orders VALUES (1887, 3209, 31);
+INSERT INTO orders VALUES (1888, 3216, 44);
+INSERT INTO orders VALUES (1889, 3223, 57);
+INSERT INTO orders VALUES (1890, 3230, 70);
+INSERT INTO orders VALUES (1891, 3237, 83);
+INSERT INTO orders VALUES (1892, 3244, 96);
+INSERT INTO orders VALUES (1893, 3251, 9);
+INSERT INTO orders VALUES (1894, 3258, 22);
+INSERT INTO orders VALUES (1895, 3265, 35);
+INSERT INTO orders VALUES (1896, 3272, 48);
+INSERT INTO orders VALUES (1897, 3279, 61);
+INSERT INTO orders VALUES (1898, 3286, 74);
+INSERT INTO orders VALUES (1899, 3293, 87);
+INSERT INTO orders VALUES (1900, 3300, 0);
+INSERT INTO orders VALUES (1901, 3307, 13);
+INSERT INTO orders VALUES (1902, 3314, 26);
+INSERT INTO orders VALUES (1903, 3321, 39);
+INSERT INTO orders VALUES (1904, 3328, 52);
+INSERT INTO orders VALUES (1905, 3335, 65);
+INSERT INTO orders VALUES (1906, 3342, 78);
+INSERT INTO orders VALUES (1907, 3349, 91);
+INSERT INTO orders VALUES (1908, 3356, 4);
+INSERT INTO orders VALUES (1909, 3363, 17);
+INSERT INTO orders VALUES (1910, 3370, 30);
+INSERT INTO orders VALUES (1911, 3377, 43);
+INSERT INTO orders VALUES (1912, 3384, 56);
+INSERT INTO orders VALUES (1913, 3391, 69);
+INSERT INTO orders VALUES (1914, 3398, 82);
+INSERT INTO orders VALUES (1915, 3405, 95);
+INSERT INTO orders VALUES (1916, 3412, 8);
+INSERT INTO orders VALUES (1917, 3419, 21);
+INSERT INTO orders VALUES (1918, 3426, 34);
+INSERT INTO orders VALUES (1919, 3433, 47);
+INSERT INTO orders VALUES (1920, 3440, 60);
+INSERT INTO orders VALUES (1921, 3447, 73);
+INSERT INTO orders VALUES (1922, 3454, 86);
+INSERT INTO orders VALUES (1923, 3461, 99);
+INSERT INTO orders VALUES (1924, 3468, 12);
+INSERT INTO orders VALUES (1925, 3475, 25);
+INSERT INTO orders VALUES (1926, 3482, 38);
+INSERT INTO orders VALUES (1927, 3489, 51);
+INSERT INTO orders VALUES (1928, 3496, 64);
+INSERT INTO orders VALUES (1929, 3503, 77);
+INSERT INTO orders VALUES (1930, 3510, 90);
+INSERT INTO orders VALUES (1931, 3517, 3);
+INSERT INTO orders VALUES (1932, 3524, 16);
+INSERT INTO orders VALUES (1933, 3531, 29);
+INSERT INTO orders VALUES (1934, 3538, 42);
+INSERT INTO orders VALUES (1935, 3545, 55);
+INSERT INTO orders VALUES (1936, 3552, 68);
+INSERT INTO orders VALUES (1937, 3559, 81);
+INSERT INTO orders VALUES (1938, 3566, 94);
+INSERT INTO orders VALUES (1939, 3573, 7);
+INSERT INTO orders VALUES (1940, 3580, 20);
+INSERT INTO orders VALUES (1941, 3587, 33);
+INSERT INTO orders VALUES (1942, 3594, 46);
+INSERT INTO orders VALUES (1943, 3601, 59);
+INSERT INTO orders VALUES (1944, 3608, 72);
+INSERT INTO orders VALUES (1945, 3615, 85);
+INSERT INTO orders VALUES (1946, 3622, 98);
+INSERT INTO orders VALUES (1947, 3629, 11);
+INSERT INTO orders VALUES (1948, 3636, 24);
+INSERT INTO orders VALUES (1949, 3643, 37);
+INSERT INTO orders VALUES (1950, 3650, 50);
+INSERT INTO orders VALUES (1951, 3657, 63);
+INSERT INTO orders VALUES (1952, 3664, 76);
+INSERT INTO orders VALUES (1953, 3671, 89);
+INSERT INTO orders VALUES (1954, 3678, 2);
+INSERT INTO orders VALUES (1955, 3685, 15);
+INSERT INTO orders VALUES (1956, 3692, 28);
+INSERT INTO orders VALUES (1957, 3699, 41);
+INSERT INTO orders VALUES (1958, 3706, 54);
+INSERT INTO orders VALUES (1959, 3713, 67);
+INSERT INTO orders VALUES (1960, 3720, 80);
+INSERT INTO orders VALUES (1961, 3727, 93);
+INSERT INTO orders VALUES (1962, 3734, 6);
+INSERT INTO orders VALUES (1963, 3741, 19);
+INSERT INTO orders VALUES (1964, 3748, 32);
+INSERT INTO orders VALUES (1965, 3755, 45);
+INSERT INTO orders VALUES (1966, 3762, 58);
+INSERT INTO orders VALUES (1967, 3769, 71);
+INSERT INTO orders VALUES (1968, 3776, 84);
+INSERT INTO orders VALUES (1969, 3783, 97);
+INSERT INTO orders VALUES (1970, 3790, 10);
+INSERT INTO orders VALUES (1971, 3797, 23);
+INSERT INTO orders VALUES (1972, 3804, 36);
+INSERT INTO orders VALUES (1973, 3811, 49);
+INSERT INTO orders VALUES (1974, 3818, 62);
+INSERT INTO orders VALUES (1975, 3825, 75);
+INSERT INTO orders VALUES (1976, 3832, 88);
+INSERT INTO orders VALUES (1977, 3839, 1);
+INSERT INTO orders VALUES (1978, 3846, 14);
+INSERT INTO orders VALUES (1979, 3853, 27);
+INSERT INTO orders VALUES (1980, 3860, 40);
+INSERT INTO orders VALUES (1981, 3867, 53);
+INSERT INTO orders VALUES (1982, 3874, 66);
+INSERT INTO orders VALUES (1983, 3881, 79);
+INSERT INTO orders VALUES (1984, 3888, 92);
+INSERT INTO orders VALUES (1985, 3895, 5);
+INSERT INTO orders VALUES (1986, 3902, 18);
+INSERT INTO orders VALUES (1987, 3909, 31);
+INSERT INTO orders VALUES (1988, 3916, 44);
+INSERT INTO orders VALUES (1989, 3923, 57);
+INSERT INTO orders VALUES (1990, 3930, 70);
+INSERT INTO orders VALUES (1991, 3937, 83);
+INSERT INTO orders VALUES (1992, 3944, 96);
+INSERT INTO orders VALUES (1993, 3951, 9);
+INSERT INTO orders VALUES (1994, 3958, 22);
+INSERT INTO orders VALUES (1995, 3965, 35);
+INSERT INTO orders VALUES (1996, 3972, 48);
+INSERT INTO orders VALUES (1997, 3979, 61);
+INSERT INTO orders VALUES (1998, 3986, 74);
+INSERT INTO orders VALUES (1999, 3993, 87);
+INSERT INTO orders VALUES (2000, 4000, 0);
+INSERT INTO orders VALUES (2001, 4007, 13);
+INSERT INTO orders VALUES (2002, 4014, 26);
+INSERT INTO orders VALUES (2003, 4021, 39);
+INSERT INTO orders VALUES (2004, 4028, 52);
+INSERT INTO orders VALUES (2005, 4035, 65);
+INSERT INTO orders VALUES (2006, 4042, 78);
+INSERT INTO orders VALUES (2007, 4049, 91);
+INSERT INTO orders VALUES (2008, 4056, 4);
+INSERT INTO orders VALUES (2009, 4063, 17);
+INSERT INTO orders VALUES (2010, 4070, 30);
+INSERT INTO orders VALUES (2011, 4077, 43);
+INSERT INTO orders VALUES (2012, 4084, 56);
+INSERT INTO orders VALUES (2013, 4091, 69);
+INSERT INTO orders VALUES (2014, 4098, 82);
+INSERT INTO orders VALUES (2015, 4105, 95);
+INSERT INTO orders VALUES (2016, 4112, 8);
+INSERT INTO orders VALUES (2017, 4119, 21);
+INSERT INTO orders VALUES (2018, 4126, 34);
+INSERT INTO orders VALUES (2019, 4133, 47);
+INSERT INTO orders VALUES (2020, 4140, 60);
+INSERT INTO orders VALUES (2021, 4147, 73);
+INSERT INTO orders VALUES (2022, 4154, 86);
+INSERT INTO orders VALUES (2023, 4161, 99);
+INSERT INTO orders VALUES (2024, 4168, 12);
+INSERT INTO orders VALUES (2025, 4175, 25);
+INSERT INTO orders VALUES (2026, 4182, 38);
+INSERT INTO orders VALUES (2027, 4189, 51);
+INSERT INTO orders VALUES (2028, 4196, 64);
+INSERT INTO orders VALUES (2029, 4203, 77);
+INSERT INTO orders VALUES (2030, 4210, 90);
+INSERT INTO orders VALUES (2031, 4217, 3);
+INSERT INTO orders VALUES (2032, 4224, 16);
+INSERT INTO orders VALUES (2033, 4231, 29);
+INSERT INTO orders VALUES (2034, 4238, 42);
+INSERT INTO orders VALUES (2035, 4245, 55);
+INSERT INTO orders VALUES (2036, 4252, 68);
+INSERT INTO orders VALUES (2037, 4259, 81);
+INSERT INTO orders VALUES (2038, 4266, 94);
+INSERT INTO orders VALUES (2039, 4273, 7);
+INSERT INTO orders VALUES (2040, 4280, 20);
+INSERT INTO orders VALUES (2041, 4287, 33);
+INSERT INTO orders VALUES (2042, 4294, 46);
+INSERT INTO orders VALUES (2043, 4301, 59);
+INSERT INTO orders VALUES (2044, 4308, 72);
+INSERT INTO orders VALUES (2045, 4315, 85);
+INSERT INTO orders VALUES (2046, 4322, 98);
+INSERT INTO orders VALUES (2047, 4329, 11);
+INSERT INTO orders VALUES (2048, 4336, 24);
+INSERT INTO orders VALUES (2049, 4343, 37);
+INSERT INTO orders VALUES (2050, 4350, 50);
+INSERT INTO orders VALUES (2051, 4357, 63);
+INSERT INTO orders VALUES (2052, 4364, 76);
+INSERT INTO orders VALUES (2053, 4371, 89);
+INSERT INTO orders VALUES (2054, 4378, 2);
+INSERT INTO orders VALUES (2055, 4385, 15);
+INSERT INTO orders VALUES (2056, 4392, 28);
+INSERT INTO orders VALUES (2057, 4399, 41);
+INSERT INTO orders VALUES (2058, 4406, 54);
+INSERT INTO orders VALUES (2059, 4413, 67);
+INSERT INTO orders VALUES (2060, 4420, 80);
+INSERT INTO orders VALUES (2061, 4427, 93);
+INSERT INTO orders VALUES (2062, 4434, 6);
+INSERT INTO orders VALUES (2063, 4441, 19);
+INSERT INTO orders VALUES (2064, 4448, 32);
+INSERT INTO orders VALUES (2065, 4455, 45);
+INSERT INTO orders VALUES (2066, 4462, 58);
+INSERT INTO orders VALUES (2067, 4469, 71);
+INSERT INTO orders VALUES (2068, 4476, 84);
+INSERT INTO orders VALUES (2069, 4483, 97);
+INSERT INTO orders VALUES (2070, 4490, 10);
+INSERT INTO orders VALUES (2071, 4497, 23);
+INSERT INTO orders VALUES (2072, 4504, 36);
+INSERT INTO orders VALUES (2073, 4511, 49);
+INSERT INTO orders VALUES (2074, 4518, 62);
+INSERT INTO orders VALUES (2075, 4525, 75);
+INSERT INTO orders VALUES (2076, 4532, 88);
+INSERT INTO orders VALUES (2077, 4539, 1);
+INSERT INTO orders VALUES (2078, 4546, 14);
+INSERT INTO orders VALUES (2079, 4553, 27);
+INSERT INTO orders VALUES (2080, 4560, 40);
+INSERT INTO orders VALUES (2081, 4567, 53);
+INSERT INTO orders VALUES (2082, 4574, 66);
+INSERT INTO orders VALUES (2083, 4581, 79);
+INSERT INTO orders VALUES (2084, 4588, 92);
+INSERT INTO orders VALUES (2085, 4595, 5);
+INSERT INTO orders VALUES (2086, 4602, 18);
+INSERT INTO orders VALUES (2087, 4609, 31);
+INSERT INTO orders VALUES (2088, 4616, 44);
+INSERT INTO orders VALUES (2089, 4623, 57);
+INSERT INTO orders VALUES (2090, 4630, 70);
+INSERT INTO orders VALUES (2091, 4637, 83);
+INSERT INTO orders VALUES (2092, 4644, 96);
+INSERT INTO orders VALUES (2093, 4651, 9);
+INSERT INTO orders VALUES (2094, 4658, 22);
+INSERT INTO orders VALUES (2095, 4665, 35);
+INSERT INTO orders VALUES (2096, 4672, 48);
+INSERT INTO orders VALUES (2097, 4679, 61);
+INSERT INTO orders VALUES (2098, 4686, 74);
+INSERT INTO orders VALUES (2099, 4693, 87);
+INSERT INTO orders VALUES (2100, 4700, 0);
+INSERT INTO orders VALUES (2101, 4707, 13);
+INSERT INTO orders VALUES (2102, 4714, 26);
+INSERT INTO orders VALUES (2103, 4721, 39);
+INSERT INTO orders VALUES (2104, 4728, 52);
+INSERT INTO orders VALUES (2105, 4735, 65);
+INSERT INTO orders VALUES (2106, 4742, 78);
+INSERT INTO orders VALUES (2107, 4749, 91);
+INSERT INTO orders VALUES (2108, 4756, 4);
+INSERT INTO orders VALUES (2109, 4763, 17);
+INSERT INTO orders VALUES (2110, 4770, 30);
+INSERT INTO orders VALUES (2111, 4777, 43);
+INSERT INTO orders VALUES (2112, 4784, 56);
+INSERT INTO orders VALUES (2113, 4791, 69);
+INSERT INTO orders VALUES (2114, 4798, 82);
+INSERT INTO orders VALUES (2115, 4805, 95);
+INSERT INTO orders VALUES (2116, 4812, 8);
+INSERT INTO orders VALUES (2117, 4819, 21);
+INSERT INTO orders VALUES (2118, 4826, 34);
+INSERT INTO orders VALUES (2119, 4833, 47);
+INSERT INTO orders VALUES (2120, 4840, 60);
+INSERT INTO orders VALUES (2121, 4847, 73);
+INSERT INTO orders VALUES (2122, 4854, 86);
+INSERT INTO orders VALUES (2123, 4861, 99);
+INSERT INTO orders VALUES (2124, 4868, 12);
+INSERT INTO orders VALUES (2125, 4875, 25);
+INSERT INTO orders VALUES (2126, 4882, 38);
+INSERT INTO orders VALUES (2127, 4889, 51);
+INSERT INTO orders VALUES (2128, 4896, 64);
+INSERT INTO orders VALUES (2129, 4903, 77);
+INSERT INTO orders VALUES (2130, 4910, 90);
+INSERT INTO orders VALUES (2131, 4917, 3);
+INSERT INTO orders VALUES (2132, 4924, 16);
+INSERT INTO orders VALUES (2133, 4931, 29);
+INSERT INTO orders VALUES (2134, 4938, 42);
+INSERT INTO orders VALUES (2135, 4945, 55);
+INSERT INTO orders VALUES (2136, 4952, 68);
+INSERT INTO orders VALUES (2137, 4959, 81);
+INSERT INTO orders VALUES (2138, 4966, 94);
+INSERT INTO orders VALUES (2139, 4973, 7);
+INSERT INTO orders VALUES (2140, 4980, 20);
+INSERT INTO orders VALUES (2141, 4987, 33);
+INSERT INTO orders VALUES (2142, 4994, 46);
+INSERT INTO orders VALUES (2143, 1, 59);
+INSERT INTO orders VALUES (2144, 8, 72);
+INSERT INTO orders VALUES (2145, 15, 85);
+INSERT INTO orders VALUES (2146, 22, 98);
+INSERT INTO orders VALUES (2147, 29, 11);
+INSERT INTO orders VALUES (2148, 36, 24);
+INSERT INTO orders VALUES (2149, 43, 37);
+INSERT INTO orders VALUES (2150, 50, 50);
+INSERT INTO orders VALUES (2151, 57, 63);
+INSERT INTO orders VALUES (2152, 64, 76);
+INSERT INTO orders VALUES (2153, 71, 89);
+INSERT INTO orders VALUES (2154, 78, 2);
+INSERT INTO orders VALUES (2155, 85, 15);
+INSERT INTO orders VALUES (2156, 92, 28);
+INSERT INTO orders VALUES (2157, 99, 41);
+INSERT INTO orders VALUES (2158, 106, 54);
+INSERT INTO orders VALUES (2159, 113, 67);
+INSERT INTO orders VALUES (2160, 120, 80);
+INSERT INTO orders VALUES (2161, 127, 93);
+INSERT INTO orders VALUES (2162, 134, 6);
+INSERT INTO orders VALUES (2163, 141, 19);
+INSERT INTO orders VALUES (2164, 148, 32);
+INSERT INTO orders VALUES (2165, 155, 45);
+INSERT INTO orders VALUES (2166, 162, 58);
+INSERT INTO orders VALUES (2167, 169, 71);
+INSERT INTO orders VALUES (2168, 176, 84);
+INSERT INTO orders VALUES (2169, 183, 97);
+INSERT INTO orders VALUES (2170, 190, 10);
+INSERT INTO orders VALUES (2171, 197, 23);
+INSERT INTO orders VALUES (2172, 204, 36);
+INSERT INTO orders VALUES (2173, 211, 49);
+INSERT INTO orders VALUES (2174, 218, 62);
+INSERT INTO orders VALUES (2175, 225, 75);
+INSERT INTO orders VALUES (2176, 232, 88);
+INSERT INTO orders VALUES (2177, 239, 1);
+INSERT INTO orders VALUES (2178, 246, 14);
+INSERT INTO orders VALUES (2179, 253, 27);
+INSERT INTO orders VALUES (2180, 260, 40);
+INSERT INTO orders VALUES (2181, 267, 53);
+INSERT INTO orders VALUES (2182, 274, 66);
+INSERT INTO orders VALUES (2183, 281, 79);
+INSERT INTO orders VALUES (2184, 288, 92);
+INSERT INTO orders VALUES (2185, 295, 5);
+INSERT INTO orders VALUES (2186, 302, 18);
+INSERT INTO orders VALUES (2187, 309, 31);
+INSERT INTO orders VALUES (2188, 316, 44);
+INSERT INTO orders VALUES (2189, 323, 57);
+INSERT INTO orders VALUES (2190, 330, 70);
+INSERT INTO orders VALUES (2191, 337, 83);
+INSERT INTO orders VALUES (2192, 344, 96);
+INSERT INTO orders VALUES (2193, 351, 9);
+INSERT INTO orders VALUES (2194, 358, 22);
+INSERT INTO orders VALUES (2195, 365, 35);
+INSERT INTO orders VALUES (2196, 372, 48);
+INSERT INTO orders VALUES (2197, 379, 61);
+INSERT INTO orders VALUES (2198, 386, 74);
+INSERT INTO orders VALUES (2199, 393, 87);
+INSERT INTO orders VALUES (2200, 400, 0);
+INSERT INTO orders VALUES (2201, 407, 13);
+INSERT INTO orders VALUES (2202, 414, 26);
+INSERT INTO orders VALUES (2203, 421, 39);
+INSERT INTO orders VALUES (2204, 428, 52);
+INSERT INTO orders VALUES (2205, 435, 65);
+INSERT INTO orders VALUES (2206, 442, 78);
+INSERT INTO orders VALUES (2207, 449, 91);
+INSERT INTO orders VALUES (2208, 456, 4);
+INSERT INTO orders VALUES (2209, 463, 17);
+INSERT INTO orders VALUES (2210, 470, 30);
+INSERT INTO orders VALUES (2211, 477, 43);
+INSERT INTO orders VALUES (2212, 484, 56);
+INSERT INTO orders VALUES (2213, 491, 69);
+INSERT INTO orders VALUES (2214, 498, 82);
+INSERT INTO orders VALUES (2215, 505, 95);
+INSERT INTO orders VALUES (2216, 512, 8);
+INSERT INTO orders VALUES (2217, 519, 21);
+INSERT INTO orders VALUES (2218, 526, 34);
+INSERT INTO orders VALUES (2219, 533, 47);
+INSERT INTO orders VALUES (2220, 540, 60);
+INSERT INTO orders VALUES (2221, 547, 73);
+INSERT INTO orders VALUES (2222, 554, 86);
+INSERT INTO orders VALUES (2223, 561, 99);
+INSERT INTO orders VALUES (2224, 568, 12);
+INSERT INTO orders VALUES (2225, 575, 25);
+INSERT INTO orders VALUES (2226, 582, 38);
+INSERT INTO orders VALUES (2227, 589, 51);
+INSERT INTO orders VALUES (2228, 596, 64);
+INSERT INTO orders VALUES (2229, 603, 77);
+INSERT INTO orders VALUES (2230, 610, 90);
+INSERT INTO orders VALUES (2231, 617, 3);
+INSERT INTO orders VALUES (2232, 624, 16);
+INSERT INTO orders VALUES (2233, 631, 29);
+INSERT INTO orders VALUES (2234, 638, 42);
+INSERT INTO orders VALUES (2235, 645, 55);
+INSERT INTO orders VALUES (2236, 652, 68);
+INSERT INTO orders VALUES (2237, 659, 81);
+INSERT INTO orders VALUES (2238, 666, 94);
+INSERT INTO orders VALUES (2239, 673, 7);
+INSERT INTO orders VALUES (2240, 680, 20);
+INSERT INTO orders VALUES (2241, 687, 33);
+INSERT INTO orders VALUES (2242, 694, 46);
+INSERT INTO orders VALUES (2243, 701, 59);
+INSERT INTO orders VALUES (2244, 708, 72);
+INSERT INTO orders VALUES (2245, 715, 85);
+INSERT INTO orders VALUES (2246, 722, 98);
+INSERT INTO orders VALUES (2247, 729, 11);
+INSERT INTO orders VALUES (2248, 736, 24);
+INSERT INTO orders VALUES (2249, 743, 37);
+INSERT INTO orders VALUES (2250, 750, 50);
+INSERT INTO orders VALUES (2251, 757, 63);
+INSERT INTO orders VALUES (2252, 764, 76);
+INSERT INTO orders VALUES (2253, 771, 89);
+INSERT INTO orders VALUES (2254, 778, 2);
+INSERT INTO orders VALUES (2255, 785, 15);
+INSERT INTO orders VALUES (2256, 792, 28);
+INSERT INTO orders VALUES (2257, 799, 41);
+INSERT INTO orders VALUES (2258, 806, 54);
+INSERT INTO orders VALUES (2259, 813, 67);
+INSERT INTO orders VALUES (2260, 820, 80);
+INSERT INTO orders VALUES (2261, 827, 93);
+INSERT INTO orders VALUES (2262, 834, 6);
+INSERT INTO orders VALUES (2263, 841, 19);
+INSERT INTO orders VALUES (2264, 848, 32);
+INSERT INTO orders VALUES (2265, 855, 45);
+INSERT INTO orders VALUES (2266, 862, 58);
+INSERT INTO orders VALUES (2267, 869, 71);
+INSERT INTO orders VALUES (2268, 876, 84);
+INSERT INTO orders VALUES (2269, 883, 97);
+INSERT INTO orders VALUES (2270, 890, 10);
+INSERT INTO orders VALUES (2271, 897, 23);
+INSERT INTO orders VALUES (2272, 904, 36);
+INSERT INTO orders VALUES (2273, 911, 49);
+INSERT INTO orders VALUES (2274, 918, 62);
+INSERT INTO orders VALUES (2275, 925, 75);
+INSERT INTO orders VALUES (2276, 932, 88);
+INSERT INTO orders VALUES (2277, 939, 1);
+INSERT INTO orders VALUES (2278, 946, 14);
+INSERT INTO orders VALUES (2279, 953, 27);
+INSERT INTO orders VALUES (2280, 960, 40);
+INSERT INTO orders VALUES (2281, 967, 53);
+INSERT INTO orders VALUES (2282, 974, 66);
+INSERT INTO orders VALUES (2283, 981, 79);
+INSERT INTO orders VALUES (2284, 988, 92);
+INSERT INTO orders VALUES (2285, 995, 5);
+INSERT INTO orders VALUES (2286, 1002, 18);
+INSERT INTO orders VALUES (2287, 1009, 31);
+INSERT INTO orders VALUES (2288, 1016, 44);
+INSERT INTO orders VALUES (2289, 1023, 57);
+INSERT INTO orders VALUES (2290, 1030, 70);
+INSERT INTO orders VALUES (2291, 1037, 83);
+INSERT INTO orders VALUES (2292, 1044, 96);
+INSERT INTO orders VALUES (2293, 1051, 9);
+INSERT INTO orders VALUES (2294, 1058, 22);
+INSERT INTO orders VALUES (2295, 1065, 35);
+INSERT INTO orders VALUES (2296, 1072, 48);
+INSERT INTO orders VALUES (2297, 1079, 61);
+INSERT INTO orders VALUES (2298, 1086, 74);
+INSERT INTO orders VALUES (2299, 1093, 87);
+INSERT INTO orders VALUES (2300, 1100, 0);
+INSERT INTO orders VALUES (2301, 1107, 13);
+INSERT INTO orders VALUES (2302, 1114, 26);
+INSERT INTO orders VALUES (2303, 1121, 39);
+INSERT INTO orders VALUES (2304, 1128, 52);
+INSERT INTO orders VALUES (2305, 1135, 65);
+INSERT INTO orders VALUES (2306, 1142, 78);
+INSERT INTO orders VALUES (2307, 1149, 91);
+INSERT INTO orders VALUES (2308, 1156, 4);
+INSERT INTO orders VALUES (2309, 1163, 17);
+INSERT INTO orders VALUES (2310, 1170, 30);
+INSERT INTO orders VALUES (2311, 1177, 43);
+INSERT INTO orders VALUES (2312, 1184, 56);
+INSERT INTO orders VALUES (2313, 1191, 69);
+INSERT INTO orders VALUES (2314, 1198, 82);
+INSERT INTO orders VALUES (2315, 1205, 95);
+INSERT INTO orders VALUES (2316, 1212, 8);
+INSERT INTO orders VALUES (2317, 1219, 21);
+INSERT INTO orders VALUES (2318, 1226, 34);
+INSERT INTO orders VALUES (2319, 1233, 47);
+INSERT INTO orders VALUES (2320, 1240, 60);
+INSERT INTO orders VALUES (2321, 1247, 73);
+INSERT INTO orders VALUES (2322, 1254, 86);
+INSERT INTO orders VALUES (2323, 1261, 99);
+INSERT INTO orders VALUES (2324, 1268, 12);
+INSERT INTO orders VALUES (2325, 1275, 25);
+INSERT INTO orders VALUES (2326, 1282, 38);
+INSERT INTO orders VALUES (2327, 1289, 51);
+INSERT INTO orders VALUES (2328, 1296, 64);
+INSERT INTO orders VALUES (2329, 1303, 77);
+INSERT INTO orders VALUES (2330, 1310, 90);
+INSERT INTO orders VALUES (2331, 1317, 3);
+INSERT INTO orders VALUES (2332, 1324, 16);
+INSERT INTO orders VALUES (2333, 1331, 29);
+INSERT INTO orders VALUES (2334, 1338, 42);
+INSERT INTO orders VALUES (2335, 1345, 55);
+INSERT INTO orders VALUES (2336, 1352, 68);
+INSERT INTO orders VALUES (2337, 1359, 81);
+INSERT INTO orders VALUES (2338, 1366, 94);
+INSERT INTO orders VALUES (2339, 1373, 7);
+INSERT INTO orders VALUES (2340, 1380, 20);
+INSERT INTO orders VALUES (2341, 1387, 33);
+INSERT INTO orders VALUES (2342, 1394, 46);
+INSERT INTO orders VALUES (2343, 1401, 59);
+INSERT INTO orders VALUES (2344, 1408, 72);
+INSERT INTO orders VALUES (2345, 1415, 85);
+INSERT INTO orders VALUES (2346, 1422, 98);
+INSERT INTO orders VALUES (2347, 1429, 11);
+INSERT INTO orders VALUES (2348, 1436, 24);
+INSERT INTO orders VALUES (2349, 1443, 37);
+INSERT INTO orders VALUES (2350, 1450, 50);
+INSERT INTO orders VALUES (2351, 1457, 63);
+INSERT INTO orders VALUES (2352, 1464, 76);
+INSERT INTO orders VALUES (2353, 1471, 89);
+INSERT INTO orders VALUES (2354, 1478, 2);
+INSERT INTO orders VALUES (2355, 1485, 15);
+INSERT INTO orders VALUES (2356, 1492, 28);
+INSERT INTO orders VALUES (2357, 1499, 41);
+INSERT INTO orders VALUES (2358, 1506, 54);
+INSERT INTO orders VALUES (2359, 1513, 67);
+INSERT INTO orders VALUES (2360, 1520, 80);
+INSERT INTO orders VALUES (2361, 1527, 93);
+INSERT INTO orders VALUES (2362, 1534, 6);
+INSERT INTO orders VALUES (2363, 1541, 19);
+INSERT INTO orders VALUES (2364, 1548, 32);
+INSERT INTO orders VALUES (2365, 1555, 45);
+INSERT INTO orders VALUES (2366, 1562, 58);
+INSERT INTO orders VALUES (2367, 1569, 71);
+INSERT INTO orders VALUES (2368, 1576, 84);
+INSERT INTO orders VALUES (2369, 1583, 97);
+INSERT INTO orders VALUES (2370, 1590, 10);
+INSERT INTO orders VALUES (2371, 1597, 23);
+INSERT INTO orders VALUES (2372, 1604, 36);
+INSERT INTO orders VALUES (2373, 1611, 49);
+INSERT INTO orders VALUES (2374, 1618, 62);
+INSERT INTO orders VALUES (2375, 1625, 75);
+INSERT INTO orders VALUES (2376, 1632, 88);
+INSERT INTO orders VALUES (2377, 1639, 1);
+INSERT INTO orders VALUES (2378, 1646, 14);
+INSERT INTO orders VALUES (2379, 1653, 27);
+INSERT INTO orders VALUES (2380, 1660, 40);
+INSERT INTO orders VALUES (2381, 1667, 53);
+INSERT INTO orders VALUES (2382, 1674, 66);
+INSERT INTO orders VALUES (2383, 1681, 79);
+INSERT INTO orders VALUES (2384, 1688, 92);
+INSERT INTO orders VALUES (2385, 1695, 5);
+INSERT INTO orders VALUES (2386, 1702, 18);
+INSERT INTO orders VALUES (2387, 1709, 31);
+INSERT INTO orders VALUES (2388, 1716, 44);
+INSERT INTO orders VALUES (2389, 1723, 57);
+INSERT INTO orders VALUES (2390, 1730, 70);
+INSERT INTO orders VALUES (2391, 1737, 83);
+INSERT INTO orders VALUES (2392, 1744, 96);
+INSERT INTO orders VALUES (2393, 1751, 9);
+INSERT INTO orders VALUES (2394, 1758, 22);
+INSERT INTO orders VALUES (2395, 1765, 35);
+INSERT INTO orders VALUES (2396, 1772, 48);
+INSERT INTO orders VALUES (2397, 1779, 61);
+INSERT INTO orders VALUES (2398, 1786, 74);
+INSERT INTO orders VALUES (2399, 1793, 87);
+INSERT INTO orders VALUES (2400, 1800, 0);
+INSERT INTO orders VALUES (2401, 1807, 13);
+INSERT INTO orders VALUES (2402, 1814, 26);
+INSERT INTO orders VALUES (2403, 1821, 39);
+INSERT INTO orders VALUES (2404, 1828, 52);
+INSERT INTO orders VALUES (2405, 1835, 65);
+INSERT INTO orders VALUES (2406, 1842, 78);
+INSERT INTO orders VALUES (2407, 1849, 91);
+INSERT INTO orders VALUES (2408, 1856, 4);
+INSERT INTO orders VALUES (2409, 1863, 17);
+INSERT INTO orders VALUES (2410, 1870, 30);
+INSERT INTO orders VALUES (2411, 1877, 43);
+INSERT INTO orders VALUES (2412, 1884, 56);
+INSERT INTO orders VALUES (2413, 1891, 69);
+INSERT INTO orders VALUES (2414, 1898, 82);
+INSERT INTO orders VALUES (2415, 1905, 95);
+INSERT INTO orders VALUES (2416, 1912, 8);
+INSERT INTO orders VALUES (2417, 1919, 21);
+INSERT INTO orders VALUES (2418, 1926, 34);
+INSERT INTO orders VALUES (2419, 1933, 47);
+INSERT INTO orders VALUES (2420, 1940, 60);
+INSERT INTO orders VALUES (2421, 1947, 73);
+INSERT INTO orders VALUES (2422, 1954, 86);
+INSERT INTO orders VALUES (2423, 1961, 99);
+INSERT INTO orders VALUES (2424, 1968, 12);
+INSERT INTO orders VALUES (2425, 1975, 25);
+INSERT INTO orders VALUES (2426, 1982, 38);
+INSERT INTO orders VALUES (2427, 1989, 51);
+INSERT INTO orders VALUES (2428, 1996, 64);
+INSERT INTO orders VALUES (2429, 2003, 77);
+INSERT INTO orders VALUES (2430, 2010, 90);
+INSERT INTO orders VALUES (2431, 2017, 3);
+INSERT INTO orders VALUES (2432, 2024, 16);
+INSERT INTO orders VALUES (2433, 2031, 29);
+INSERT INTO orders VALUES (2434, 2038, 42);
+INSERT INTO orders VALUES (2435, 2045, 55);
+INSERT INTO orders VALUES (2436, 2052, 68);
+INSERT INTO orders VALUES (2437, 2059, 81);
+INSERT INTO orders VALUES (2438, 2066, 94);
+INSERT INTO orders VALUES (2439, 2073, 7);
+INSERT INTO orders VALUES (2440, 2080, 20);
+INSERT INTO orders VALUES (2441, 2087, 33);
+INSERT INTO orders VALUES (2442, 2094, 46);
+INSERT INTO orders VALUES (2443, 2101, 59);
+INSERT INTO orders VALUES (2444, 2108, 72);
+INSERT INTO orders VALUES (2445, 2115, 85);
+INSERT INTO orders VALUES (2446, 2122, 98);
+INSERT INTO orders VALUES (2447, 2129, 11);
+INSERT INTO orders VALUES (2448, 2136, 24);
+INSERT INTO orders VALUES (2449, 2143, 37);
+INSERT INTO orders VALUES (2450, 2150, 50);
+INSERT INTO orders VALUES (2451, 2157, 63);
+INSERT INTO orders VALUES (2452, 2164, 76);
+INSERT INTO orders VALUES (2453, 2171, 89);
+INSERT INTO orders VALUES (2454, 2178, 2);
+INSERT INTO orders VALUES (2455, 2185, 15);
+INSERT INTO orders VALUES (2456, 2192, 28);
+INSERT INTO orders VALUES (2457, 2199, 41);
+INSERT INTO orders VALUES (2458, 2206, 54);
+INSERT INTO orders VALUES (2459, 2213, 67);
+INSERT INTO orders VALUES (2460, 2220, 80);
+INSERT INTO orders VALUES (2461, 2227, 93);
+INSERT INTO orders VALUES (2462, 2234, 6);
+INSERT INTO orders VALUES (2463, 2241, 19);
+INSERT INTO orders VALUES (2464, 2248, 32);
+INSERT INTO orders VALUES (2465, 2255, 45);
+INSERT INTO orders VALUES (2466, 2262, 58);
+INSERT INTO orders VALUES (2467, 2269, 71);
+INSERT INTO orders VALUES (2468, 2276, 84);
+INSERT INTO orders VALUES (2469, 2283, 97);
+INSERT INTO orders VALUES (2470, 2290, 10);
+INSERT INTO orders VALUES (2471, 2297, 23);
+INSERT INTO orders VALUES (2472, 2304, 36);
+INSERT INTO orders VALUES (2473, 2311, 49);
+INSERT INTO orders VALUES (2474, 2318, 62);
+INSERT INTO orders VALUES (2475, 2325, 75);
+INSERT INTO orders VALUES (2476, 2332, 88);
+INSERT INTO orders VALUES (2477, 2339, 1);
+INSERT INTO orders VALUES (2478, 2346, 14);
+INSERT INTO orders VALUES (2479, 2353, 27);
+INSERT INTO orders VALUES (2480, 2360, 40);
+INSERT INTO orders VALUES (2481, 2367, 53);
+INSERT INTO orders VALUES (2482, 2374, 66);
+INSERT INTO orders VALUES (2483, 2381, 79);
+INSERT INTO orders VALUES (2484, 2388, 92);
+INSERT INTO orders VALUES (2485, 2395, 5);
+INSERT INTO orders VALUES (2486, 2402, 18);
+INSERT INTO orders VALUES (2487, 2409, 31);
+INSERT INTO orders VALUES (2488, 2416, 44);
+INSERT INTO orders VALUES (2489, 2423, 57);
+INSERT INTO orders VALUES (2490, 2430, 70);
+INSERT INTO orders VALUES (2491, 2437, 83);
+INSERT INTO orders VALUES (2492, 2444, 96);
+INSERT INTO orders VALUES (2493, 2451, 9);
+INSERT INTO orders VALUES (2494, 2458, 22);
+INSERT INTO orders VALUES (2495, 2465, 35);
+INSERT INTO orders VALUES (2496, 2472, 48);
+INSERT INTO orders VALUES (2497, 2479, 61);
+INSERT INTO orders VALUES (2498, 2486, 74);
+INSERT INTO orders VALUES (2499, 2493, 87);
+INSERT INTO orders VALUES (2500, 2500, 0);
+INSERT INTO orders VALUES (2501, 2507, 13);
+INSERT INTO orders VALUES (2502, 2514, 26);
+INSERT INTO orders VALUES (2503, 2521, 39);
+INSERT INTO orders VALUES (2504, 2528, 52);
+INSERT INTO orders VALUES (2505, 2535, 65);
+INSERT INTO orders VALUES (2506, 2542, 78);
+INSERT INTO orders VALUES (2507, 2549, 91);
+INSERT INTO orders VALUES (2508, 2556, 4);
+INSERT INTO orders VALUES (2509, 2563, 17);
+INSERT INTO orders VALUES (2510, 2570, 30);
+INSERT INTO orders VALUES (2511, 2577, 43);
+INSERT INTO orders VALUES (2512, 2584, 56);
+INSERT INTO orders VALUES (2513, 2591, 69);
+INSERT INTO orders VALUES (2514, 2598, 82);
+INSERT INTO orders VALUES (2515, 2605, 95);
+INSERT INTO orders VALUES (2516, 2612, 8);
+INSERT INTO orders VALUES (2517, 2619, 21);
+INSERT INTO orders VALUES (2518, 2626, 34);
+INSERT INTO orders VALUES (2519, 2633, 47);
+INSERT INTO orders VALUES (2520, 2640, 60);
+INSERT INTO orders VALUES (2521, 2647, 73);
+INSERT INTO orders VALUES (2522, 2654, 86);
+INSERT INTO orders VALUES (2523, 2661, 99);
+INSERT INTO orders VALUES (2524, 2668, 12);
+INSERT INTO orders VALUES (2525, 2675, 25);
+INSERT INTO orders VALUES (2526, 2682, 38);
+INSERT INTO orders VALUES (2527, 2689, 51);
+INSERT INTO orders VALUES (2528, 2696, 64);
+INSERT INTO orders VALUES (2529, 2703, 77);
+INSERT INTO orders VALUES (2530, 2710, 90);
+INSERT INTO orders VALUES (2531, 2717, 3);
+INSERT INTO orders VALUES (2532, 2724, 16);
+INSERT INTO orders VALUES (2533, 2731, 29);
+INSERT INTO orders VALUES (2534, 2738, 42);
+INSERT INTO orders VALUES (2535, 2745, 55);
+INSERT INTO orders VALUES (2536, 2752, 68);
+INSERT INTO orders VALUES (2537, 2759, 81);
+INSERT INTO orders VALUES (2538, 2766, 94);
+INSERT INTO orders VALUES (2539, 2773, 7);
+INSERT INTO orders VALUES (2540, 2780, 20);
+INSERT INTO orders VALUES (2541, 2787, 33);
+INSERT INTO orders VALUES (2542, 2794, 46);
+INSERT INTO orders VALUES (2543, 2801, 59);
+INSERT INTO orders VALUES (2544, 2808, 72);
+INSERT INTO orders VALUES (2545, 2815, 85);
+INSERT INTO orders VALUES (2546, 2822, 98);
+INSERT INTO orders VALUES (2547, 2829, 11);
+INSERT INTO orders VALUES (2548, 2836, 24);
+INSERT INTO orders VALUES (2549, 2843, 37);
+INSERT INTO orders VALUES (2550, 2850, 50);
+INSERT INTO orders VALUES (2551, 2857, 63);
+INSERT INTO orders VALUES (2552, 2864, 76);
+INSERT INTO orders VALUES (2553, 2871, 89);
+INSERT INTO orders VALUES (2554, 2878, 2);
+INSERT INTO orders VALUES (2555, 2885, 15);
+INSERT INTO orders VALUES (2556, 2892, 28);
+INSERT INTO orders VALUES (2557, 2899, 41);
+INSERT INTO orders VALUES (2558, 2906, 54);
+INSERT INTO orders VALUES (2559, 2913, 67);
+INSERT INTO orders VALUES (2560, 2920, 80);
+INSERT INTO orders VALUES (2561, 2927, 93);
+INSERT INTO orders VALUES (2562, 2934, 6);
+INSERT INTO orders VALUES (2563, 2941, 19);
+INSERT INTO orders VALUES (2564, 2948, 32);
+INSERT INTO orders VALUES (2565, 2955, 45);
+INSERT INTO orders VALUES (2566, 2962, 58);
+INSERT INTO orders VALUES (2567, 2969, 71);
+INSERT INTO orders VALUES (2568, 2976, 84);
+INSERT INTO orders VALUES (2569, 2983, 97);
+INSERT INTO orders VALUES (2570, 2990, 10);
+INSERT INTO orders VALUES (2571, 2997, 23);
+INSERT INTO orders VALUES (2572, 3004, 36);
+INSERT INTO orders VALUES (2573, 3011, 49);
+INSERT INTO orders VALUES (2574, 3018, 62);
+INSERT INTO orders VALUES (2575, 3025, 75);
+INSERT INTO orders VALUES (2576, 3032, 88);
+INSERT INTO orders VALUES (2577, 3039, 1);
+INSERT INTO orders VALUES (2578, 3046, 14);
+INSERT INTO orders VALUES (2579, 3053, 27);
+INSERT INTO orders VALUES (2580, 3060, 40);
+INSERT INTO orders VALUES (2581, 3067, 53);
+INSERT INTO orders VALUES (2582, 3074, 66);
+INSERT INTO orders VALUES (2583, 3081, 79);
+INSERT INTO orders VALUES (2584, 3088, 92);
+INSERT INTO orders VALUES (2585, 3095, 5);
+INSERT INTO orders VALUES (2586, 3102, 18);
+INSERT INTO orders VALUES (2587, 3109, 31);
+INSERT INTO orders VALUES (2588, 3116, 44);
+INSERT INTO orders VALUES (2589, 3123, 57);
+INSERT INTO orders VALUES (2590, 3130, 70);
+INSERT INTO orders VALUES (2591, 3137, 83);
+INSERT INTO orders VALUES (2592, 3144, 96);
+INSERT INTO orders VALUES (2593, 3151, 9);
+INSERT INTO orders VALUES (2594, 3158, 22);
+INSERT INTO orders VALUES (2595, 3165, 35);
+INSERT INTO orders VALUES (2596, 3172, 48);
+INSERT INTO orders VALUES (2597, 3179, 61);
+INSERT INTO orders VALUES (2598, 3186, 74);
+INSERT INTO orders VALUES (2599, 3193, 87);
+INSERT INTO orders VALUES (2600, 3200, 0);
+INSERT INTO orders VALUES (2601, 3207, 13);
+INSERT INTO orders VALUES (2602, 3214, 26);
+INSERT INTO orders VALUES (2603, 3221, 39);
+INSERT INTO orders VALUES (2604, 3228, 52);
+INSERT INTO orders VALUES (2605, 3235, 65);
+INSERT INTO orders VALUES (2606, 3242, 78);
+INSERT INTO orders VALUES (2607, 3249, 91);
+INSERT INTO orders VALUES (2608, 3256, 4);
+INSERT INTO orders VALUES (2609, 3263, 17);
+INSERT INTO orders VALUES (2610, 3270, 30);
+INSERT INTO orders VALUES (2611, 3277, 43);
+INSERT INTO orders VALUES (2612, 3284, 56);
+INSERT INTO orders VALUES (2613, 3291, 69);
+INSERT INTO orders VALUES (2614, 3298, 82);
+INSERT INTO orders VALUES (2615, 3305, 95);
+INSERT INTO orders VALUES (2616, 3312, 8);
+INSERT INTO orders VALUES (2617, 3319, 21);
+INSERT INTO orders VALUES (2618, 3326, 34);
+INSERT INTO orders VALUES (2619, 3333, 47);
+INSERT INTO orders VALUES (2620, 3340, 60);
+INSERT INTO orders VALUES (2621, 3347, 73);
+INSERT INTO orders VALUES (2622, 3354, 86);
+INSERT INTO orders VALUES (2623, 3361, 99);
+INSERT INTO orders VALUES (2624, 3368, 12);
+INSERT INTO orders VALUES (2625, 3375, 25);
+INSERT INTO orders VALUES (2626, 3382, 38);
+INSERT INTO orders VALUES (2627, 3389, 51);
+INSERT INTO orders VALUES (2628, 3396, 64);
+INSERT INTO orders VALUES (2629, 3403, 77);
+INSERT INTO orders VALUES (2630, 3410, 90);
+INSERT INTO orders VALUES (2631, 3417, 3);
+INSERT INTO orders VALUES (2632, 3424, 16);
+INSERT INTO orders VALUES (2633, 3431, 29);
+INSERT INTO orders VALUES (2634, 3438, 42);
+INSERT INTO orders VALUES (2635, 3445, 55);
+INSERT INTO orders VALUES (2636, 3452, 68);
+INSERT INTO orders VALUES (2637, 3459, 81);
+INSERT INTO orders VALUES (2638, 3466, 94);
+INSERT INTO orders VALUES (2639, 3473, 7);
+INSERT INTO orders VALUES (2640, 3480, 20);
+INSERT INTO orders VALUES (2641, 3487, 33);
+INSERT INTO orders VALUES (2642, 3494, 46);
+INSERT INTO orders VALUES (2643, 3501, 59);
+INSERT INTO orders VALUES (2644, 3508, 72);
+INSERT INTO orders VALUES (2645, 3515, 85);
+INSERT INTO orders VALUES (2646, 3522, 98);
+INSERT INTO orders VALUES (2647, 3529, 11);
+INSERT INTO orders VALUES (2648, 3536, 24);
+INSERT INTO orders VALUES (2649, 3543, 37);
+INSERT INTO orders VALUES (2650, 3550, 50);
+INSERT INTO orders VALUES (2651, 3557, 63);
+INSERT INTO orders VALUES (2652, 3564, 76);
+INSERT INTO orders VALUES (2653, 3571, 89);
+INSERT INTO orders VALUES (2654, 3578, 2);
+INSERT INTO orders VALUES (2655, 3585, 15);
+INSERT INTO orders VALUES (2656, 3592, 28);
+INSERT INTO orders VALUES (2657, 3599, 41);
+INSERT INTO orders VALUES (2658, 3606, 54);
+INSERT INTO orders VALUES (2659, 3613, 67);
+INSERT INTO orders VALUES (2660, 3620, 80);
+INSERT INTO orders VALUES (2661, 3627, 93);
+INSERT INTO orders VALUES (2662, 3634, 6);
+INSERT INTO orders VALUES (2663, 3641, 19);
+INSERT INTO orders VALUES (2664, 3648, 32);
+INSERT INTO orders VALUES (2665, 3655, 45);
+INSERT INTO orders VALUES (2666, 3662, 58);
+INSERT INTO orders VALUES (2667, 3669, 71);
+INSERT INTO orders VALUES (2668, 3676, 84);
+INSERT INTO orders VALUES (2669, 3683, 97);
+INSERT INTO orders VALUES (2670, 3690, 10);
+INSERT INTO orders VALUES (2671, 3697, 23);
+INSERT INTO orders VALUES (2672, 3704, 36);
+INSERT INTO orders VALUES (2673, 3711, 49);
+INSERT INTO orders VALUES (2674, 3718, 62);
+INSERT INTO orders VALUES (2675, 3725, 75);
+INSERT INTO orders VALUES (2676, 3732, 88);
+INSERT INTO orders VALUES (2677, 3739, 1);
+INSERT INTO orders VALUES (2678, 3746, 14);
+INSERT INTO orders VALUES (2679, 3753, 27);
+INSERT INTO orders VALUES (2680, 3760, 40);
+INSERT INTO orders VALUES (2681, 3767, 53);
+INSERT INTO orders VALUES (2682, 3774, 66);
+INSERT INTO orders VALUES (2683, 3781, 79);
+INSERT INTO orders VALUES (2684, 3788, 92);
+INSERT INTO orders VALUES (2685, 3795, 5);
+INSERT INTO orders VALUES (2686, 3802, 18);
+INSERT INTO orders VALUES (2687, 3809, 31);
+INSERT INTO orders VALUES (2688, 3816, 44);
+INSERT INTO orders VALUES (2689, 3823, 57);
+INSERT INTO orders VALUES (2690, 3830, 70);
+INSERT INTO orders VALUES (2691, 3837, 83);
+INSERT INTO orders VALUES (2692, 3844, 96);
+INSERT INTO orders VALUES (2693, 3851, 9);
+INSERT INTO orders VALUES (2694, 3858, 22);
+INSERT INTO orders VALUES (2695, 3865, 35);
+INSERT INTO orders VALUES (2696, 3872, 48);
+INSERT INTO orders VALUES (2697, 3879, 61);
+INSERT INTO orders VALUES (2698, 3886, 74);
+INSERT INTO orders VALUES (2699, 3893, 87);
+INSERT INTO orders VALUES (2700, 3900, 0);
+INSERT INTO orders VALUES (2701, 3907, 13);
+INSERT INTO orders VALUES (2702, 3914, 26);
+INSERT INTO orders VALUES (2703, 3921, 39);
+INSERT INTO orders VALUES (2704, 3928, 52);
+INSERT INTO orders VALUES (2705, 3935, 65);
+INSERT INTO orders VALUES (2706, 3942, 78);
+INSERT INTO orders VALUES (2707, 3949, 91);
+INSERT INTO orders VALUES (2708, 3956, 4);
+INSERT INTO orders VALUES (2709, 3963, 17);
+INSERT INTO orders VALUES (2710, 3970, 30);
+INSERT INTO orders VALUES (2711, 3977, 43);
+INSERT INTO orders VALUES (2712, 3984, 56);
+INSERT INTO orders VALUES (2713, 3991, 69);
+INSERT INTO orders VALUES (2714, 3998, 82);
+INSERT INTO orders VALUES (2715, 4005, 95);
+INSERT INTO orders VALUES (2716, 4012, 8);
+INSERT INTO orders VALUES (2717, 4019, 21);
+INSERT INTO orders VALUES (2718, 4026, 34);
+INSERT INTO orders VALUES (2719, 4033, 47);
+INSERT INTO orders VALUES (2720, 4040, 60);
+INSERT INTO orders VALUES (2721, 4047, 73);
+INSERT INTO orders VALUES (2722, 4054, 86);
+INSERT INTO orders VALUES (2723, 4061, 99);
+INSERT INTO orders VALUES (2724, 4068, 12);
+INSERT INTO orders VALUES (2725, 4075, 25);
+INSERT INTO orders VALUES (2726, 4082, 38);
+INSERT INTO orders VALUES (2727, 4089, 51);
+INSERT INTO orders VALUES (2728, 4096, 64);
+INSERT INTO orders VALUES (2729, 4103, 77);
+INSERT INTO orders VALUES (2730, 4110, 90);
+INSERT INTO orders VALUES (2731, 4117, 3);
+INSERT INTO orders VALUES (2732, 4124, 16);
+INSERT INTO orders VALUES (2733, 4131, 29);
+INSERT INTO orders VALUES (2734, 4138, 42);
+INSERT INTO orders VALUES (2735, 4145, 55);
+INSERT INTO orders VALUES (2736, 4152, 68);
+INSERT INTO orders VALUES (2737, 4159, 81);
+INSERT INTO orders VALUES (2738, 4166, 94);
+INSERT INTO orders VALUES (2739, 4173, 7);
+INSERT INTO orders VALUES (2740, 4180, 20);
+INSERT INTO orders VALUES (2741, 4187, 33);
+INSERT INTO orders VALUES (2742, 4194, 46);
+INSERT INTO orders VALUES (2743, 4201, 59);
+INSERT INTO orders VALUES (2744, 4208, 72);
+INSERT INTO orders VALUES (2745, 4215, 85);
+INSERT INTO orders VALUES (2746, 4222, 98);
+INSERT INTO orders VALUES (2747, 4229, 11);
+INSERT INTO orders VALUES (2748, 4236, 24);
+INSERT INTO orders VALUES (2749, 4243, 37);
+INSERT INTO orders VALUES (2750, 4250, 50);
+INSERT INTO orders VALUES (2751, 4257, 63);
+INSERT INTO orders VALUES (2752, 4264, 76);
+INSERT INTO orders VALUES (2753, 4271, 89);
+INSERT INTO orders VALUES (2754, 4278, 2);
+INSERT INTO orders VALUES (2755, 4285, 15);
+INSERT INTO orders VALUES (2756, 4292, 28);
+INSERT INTO orders VALUES (2757, 4299, 41);
+INSERT INTO orders VALUES (2758, 4306, 54);
+INSERT INTO orders VALUES (2759, 4313, 67);
+INSERT INTO orders VALUES (2760, 4320, 80);
+INSERT INTO orders VALUES (2761, 4327, 93);
+INSERT INTO orders VALUES (2762, 4334, 6);
+INSERT INTO orders VALUES (2763, 4341, 19);
+INSERT INTO orders VALUES (2764, 4348, 32);
+INSERT INTO orders VALUES (2765, 4355, 45);
+INSERT INTO orders VALUES (2766, 4362, 58);
+INSERT INTO orders VALUES (2767, 4369, 71);
+INSERT INTO orders VALUES (2768, 4376, 84);
+INSERT INTO orders VALUES (2769, 4383, 97);
+INSERT INTO orders VALUES (2770, 4390, 10);
+INSERT INTO orders VALUES (2771, 4397, 23);
+INSERT INTO orders VALUES (2772, 4404, 36);
+INSERT INTO orders VALUES (2773, 4411, 49);
+INSERT INTO orders VALUES (2774, 4418, 62);
+INSERT INTO orders VALUES (2775, 4425, 75);
+INSERT INTO orders VALUES (2776, 4432, 88);
+INSERT INTO orders VALUES (2777, 4439, 1);
+INSERT INTO orders VALUES (2778, 4446, 14);
+INSERT INTO orders VALUES (2779, 4453, 27);
+INSERT INTO orders VALUES (2780, 4460, 40);
+INSERT INTO orders VALUES (2781, 4467, 53);
+INSERT INTO orders VALUES (2782, 4474, 66);
+INSERT INTO orders VALUES (2783, 4481, 79);
+INSERT INTO orders VALUES (2784, 4488, 92);
+INSERT INTO orders VALUES (2785, 4495, 5);
+INSERT INTO orders VALUES (2786, 4502, 18);
+INSERT INTO orders VALUES (2787, 4509, 31);
+INSERT INTO orders VALUES (2788, 4516, 44);
+INSERT INTO orders VALUES (2789, 4523, 57);
+INSERT INTO orders VALUES (2790, 4530, 70);
+INSERT INTO orders VALUES (2791, 4537, 83);
+INSERT INTO orders VALUES (2792, 4544, 96);
+INSERT INTO orders VALUES (2793, 4551, 9);
+INSERT INTO orders VALUES (2794, 4558, 22);
+INSERT INTO orders VALUES (2795, 4565, 35);
+INSERT INTO orders VALUES (2796, 4572, 48);
+INSERT INTO orders VALUES (2797, 4579, 61);
+INSERT INTO orders VALUES (2798, 4586, 74);
+INSERT INTO orders VALUES (2799, 4593, 87);
+INSERT INTO orders VALUES (2800, 4600, 0);
+INSERT INTO orders VALUES (2801, 4607, 13);
+INSERT INTO orders VALUES (2802, 4614, 26);
+INSERT INTO orders VALUES (2803, 4621, 39);
+INSERT INTO orders VALUES (2804, 4628, 52);
+INSERT INTO orders VALUES (2805, 4635, 65);
+INSERT INTO orders VALUES (2806, 4642, 78);
+INSERT INTO orders VALUES (2807, 4649, 91);
+INSERT INTO orders VALUES (2808, 4656, 4);
+INSERT INTO orders VALUES (2809, 4663, 17);
+INSERT INTO orders VALUES (2810, 4670, 30);
+INSERT INTO orders VALUES (2811, 4677, 43);
+INSERT INTO orders VALUES (2812, 4684, 56);
+INSERT INTO orders VALUES (2813, 4691, 69);
+INSERT INTO orders VALUES (2814, 4698, 82);
+INSERT INTO orders VALUES (2815, 4705, 95);
+INSERT INTO orders VALUES (2816, 4712, 8);
+INSERT INTO orders VALUES (2817, 4719, 21);
+INSERT INTO orders VALUES (2818, 4726, 34);
+INSERT INTO orders VALUES (2819, 4733, 47);
+INSERT INTO orders VALUES (2820, 4740, 60);
+INSERT INTO orders VALUES (2821, 4747, 73);
+INSERT INTO orders VALUES (2822, 4754, 86);
+INSERT INTO orders VALUES (2823, 4761, 99);
+INSERT INTO orders VALUES (2824, 4768, 12);
+INSERT INTO orders VALUES (2825, 4775, 25);
+INSERT INTO orders VALUES (2826, 4782, 38);
+INSERT INTO orders VALUES (2827, 4789, 51);
+INSERT INTO orders VALUES (2828, 4796, 64);
+INSERT INTO orders VALUES (2829, 4803, 77);
+INSERT INTO orders VALUES (2830, 4810, 90);
+INSERT INTO orders VALUES (2831, 4817, 3);
+INSERT INTO orders VALUES (2832, 4824, 16);
+INSERT INTO orders VALUES (2833, 4831, 29);
+INSERT INTO orders VALUES (2834, 4838, 42);
+INSERT INTO orders VALUES (2835, 4845, 55);
+INSERT INTO orders VALUES (2836, 4852, 68);
+INSERT INTO orders VALUES (2837, 4859, 81);
+INSERT INTO orders VALUES (2838, 4866, 94);
+INSERT INTO orders VALUES (2839, 4873, 7);
+INSERT INTO orders VALUES (2840, 4880, 20);
+INSERT INTO orders VALUES (2841, 4887, 33);
+INSERT INTO orders VALUES (2842, 4894, 46);
+INSERT INTO orders VALUES (2843, 4901, 59);
+INSERT INTO orders VALUES (2844, 4908, 72);
+INSERT INTO orders VALUES (2845, 4915, 85);
+INSERT INTO orders VALUES (2846, 4922, 98);
+INSERT INTO orders VALUES (2847, 4929, 11);
+INSERT INTO orders VALUES (2848, 4936, 24);
+INSERT INTO orders VALUES (2849, 4943, 37);
+INSERT INTO orders VALUES (2850, 4950, 50);
+INSERT INTO orders VALUES (2851, 4957, 63);
+INSERT INTO orders VALUES (2852, 4964, 76);
+INSERT INTO orders VALUES (2853, 4971, 89);
+INSERT INTO orders VALUES (2854, 4978, 2);
+INSERT INTO orders VALUES (2855, 4985, 15);
+INSERT INTO orders VALUES (2856, 4992, 28);
+INSERT INTO orders VALUES (2857, 4999, 41);
+INSERT INTO orders VALUES (2858, 6, 54);
+INSERT INTO orders VALUES (2859, 13, 67);
+INSERT INTO orders VALUES (2860, 20, 80);
+INSERT INTO orders VALUES (2861, 27, 93);
+INSERT INTO orders VALUES (2862, 34, 6);
+INSERT INTO orders VALUES (2863, 41, 19);
+INSERT INTO orders VALUES (2864, 48, 32);
+INSERT INTO orders VALUES (2865, 55, 45);
+INSERT INTO orders VALUES (2866, 62, 58);
+INSERT INTO orders VALUES (2867, 69, 71);
+INSERT INTO orders VALUES (2868, 76, 84);
+INSERT INTO orders VALUES (2869, 83, 97);
+INSERT INTO orders VALUES (2870, 90, 10);
+INSERT INTO orders VALUES (2871, 97, 23);
+INSERT INTO orders VALUES (2872, 104, 36);
+INSERT INTO orders VALUES (2873, 111, 49);
+INSERT INTO orders VALUES (2874, 118, 62);
+INSERT INTO orders VALUES (2875, 125, 75);
+INSERT INTO orders VALUES (2876, 132, 88);
+INSERT INTO orders VALUES (2877, 139, 1);
+INSERT INTO orders VALUES (2878, 146, 14);
+INSERT INTO orders VALUES (2879, 153, 27);
+INSERT INTO orders VALUES (2880, 160, 40);
+INSERT INTO orders VALUES (2881, 167, 53);
+INSERT INTO orders VALUES (2882, 174, 66);
+INSERT INTO orders VALUES (2883, 181, 79);
+INSERT INTO orders VALUES (2884, 188, 92);
+INSERT INTO orders VALUES (2885, 195, 5);
+INSERT INTO orders VALUES (2886, 202, 18);
+INSERT INTO orders VALUES (2887, 209, 31);
+INSERT INTO orders VALUES (2888, 216, 44);
+INSERT INTO orders VALUES (2889, 223, 57);
+INSERT INTO orders VALUES (2890, 230, 70);
+INSERT INTO orders VALUES (2891, 237, 83);
+INSERT INTO orders VALUES (2892, 244, 96);
+INSERT INTO orders VALUES (2893, 251, 9);
+INSERT INTO orders VALUES (2894, 258, 22);
+INSERT INTO orders VALUES (2895, 265, 35);
+INSERT INTO orders VALUES (2896, 272, 48);
+INSERT INTO orders VALUES (2897, 279, 61);
+INSERT INTO orders VALUES (2898, 286, 74);
+INSERT INTO orders VALUES (2899, 293, 87);
+INSERT INTO orders VALUES (2900, 300, 0);
+INSERT INTO orders VALUES (2901, 307, 13);
+INSERT INTO orders VALUES (2902, 314, 26);
+INSERT INTO orders VALUES (2903, 321, 39);
+INSERT INTO orders VALUES (2904, 328, 52);
+INSERT INTO orders VALUES (2905, 335, 65);
+INSERT INTO orders VALUES (2906, 342, 78);
+INSERT INTO orders VALUES (2907, 349, 91);
+INSERT INTO orders VALUES (2908, 356, 4);
+INSERT INTO orders VALUES (2909, 363, 17);
+INSERT INTO orders VALUES (2910, 370, 30);
+INSERT INTO orders VALUES (2911, 377, 43);
+INSERT INTO orders VALUES (2912, 384, 56);
+INSERT INTO orders VALUES (2913, 391, 69);
+INSERT INTO orders VALUES (2914, 398, 82);
+INSERT INTO orders VALUES (2915, 405, 95);
+INSERT INTO orders VALUES (2916, 412, 8);
+INSERT INTO orders VALUES (2917, 419, 21);
+INSERT INTO orders VALUES (2918, 426, 34);
+INSERT INTO orders VALUES (2919, 433, 47);
+INSERT INTO orders VALUES (2920, 440, 60);
+INSERT INTO orders VALUES (2921, 447, 73);
+INSERT INTO orders VALUES (2922, 454, 86);
+INSERT INTO orders VALUES (2923, 461, 99);
+INSERT INTO orders VALUES (2924, 468, 12);
+INSERT INTO orders VALUES (2925, 475, 25);
+INSERT INTO orders VALUES (2926, 482, 38);
+INSERT INTO orders VALUES (2927, 489, 51);
+INSERT INTO orders VALUES (2928, 496, 64);
+INSERT INTO orders VALUES (2929, 503, 77);
+INSERT INTO orders VALUES (2930, 510, 90);
+INSERT INTO orders VALUES (2931, 517, 3);
+INSERT INTO orders VALUES (2932, 524, 16);
+INSERT INTO orders VALUES (2933, 531, 29);
+INSERT INTO orders VALUES (2934, 538, 42);
+INSERT INTO orders VALUES (2935, 545, 55);
+INSERT INTO orders VALUES (2936, 552, 68);
+INSERT INTO orders VALUES (2937, 559, 81);
+INSERT INTO orders VALUES (2938, 566, 94);
+INSERT INTO orders VALUES (2939, 573, 7);
+INSERT INTO orders VALUES (2940, 580, 20);
+INSERT INTO orders VALUES (2941, 587, 33);
+INSERT INTO orders VALUES (2942, 594, 46);
+INSERT INTO orders VALUES (2943, 601, 59);
+INSERT INTO orders VALUES (2944, 608, 72);
+INSERT INTO orders VALUES (2945, 615, 85);
+INSERT INTO orders VALUES (2946, 622, 98);
+INSERT INTO orders VALUES (2947, 629, 11);
+INSERT INTO orders VALUES (2948, 636, 24);
+INSERT INTO orders VALUES (2949, 643, 37);
+INSERT INTO orders VALUES (2950, 650, 50);
+INSERT INTO orders VALUES (2951, 657, 63);
+INSERT INTO orders VALUES (2952, 664, 76);
+INSERT INTO orders VALUES (2953, 671, 89);
+INSERT INTO orders VALUES (2954, 678, 2);
+INSERT INTO orders VALUES (2955, 685, 15);
+INSERT INTO orders VALUES (2956, 692, 28);
+INSERT INTO orders VALUES (2957, 699, 41);
+INSERT INTO orders VALUES (2958, 706, 54);
+INSERT INTO orders VALUES (2959, 713, 67);
+INSERT INTO orders VALUES (2960, 720, 80);
+INSERT INTO orders VALUES (2961, 727, 93);
+INSERT INTO orders VALUES (2962, 734, 6);
+INSERT INTO orders VALUES (2963, 741, 19);
+INSERT INTO orders VALUES (2964, 748, 32);
+INSERT INTO orders VALUES (2965, 755, 45);
+INSERT INTO orders VALUES (2966, 762, 58);
+INSERT INTO orders VALUES (2967, 769, 71);
+INSERT INTO orders VALUES (2968, 776, 84);
+INSERT INTO orders VALUES (2969, 783, 97);
+INSERT INTO orders VALUES (2970, 790, 10);
+INSERT INTO orders VALUES (2971, 797, 23);
+INSERT INTO orders VALUES (2972, 804, 36);
+INSERT INTO orders VALUES (2973, 811, 49);
+INSERT INTO orders VALUES (2974, 818, 62);
+INSERT INTO orders VALUES (2975, 825, 75);
+INSERT INTO orders VALUES (2976, 832, 88);
+INSERT INTO orders VALUES (2977, 839, 1);
+INSERT INTO orders VALUES (2978, 846, 14);
+INSERT INTO orders VALUES (2979, 853, 27);
+INSERT INTO orders VALUES (2980, 860, 40);
+INSERT INTO orders VALUES (2981, 867, 53);
+INSERT INTO orders VALUES (2982, 874, 66);
+INSERT INTO orders VALUES (2983, 881, 79);
+INSERT INTO orders VALUES (2984, 888, 92);
+INSERT INTO orders VALUES (2985, 895, 5);
+INSERT INTO orders VALUES (2986, 902, 18);
+INSERT INTO orders VALUES (2987, 909, 31);
+INSERT INTO orders VALUES (2988, 916, 44);
+INSERT INTO orders VALUES (2989, 923, 57);
+INSERT INTO orders VALUES (2990, 930, 70);
+INSERT INTO orders VALUES (2991, 937, 83);
+INSERT INTO orders VALUES (2992, 944, 96);
+INSERT INTO orders VALUES (2993, 951, 9);
+INSERT INTO orders VALUES (2994, 958, 22);
+INSERT INTO orders VALUES (2995, 965, 35);
+INSERT INTO orders VALUES (2996, 972, 48);
+INSERT INTO orders VALUES (2997, 979, 61);
+INSERT INTO orders VALUES (2998, 986, 74);
+INSERT INTO orders VALUES (2999, 993, 87);
+INSERT INTO notes VALUES (0, 'note0');
+INSERT INTO notes VALUES (1, 'note1');
+INSERT INTO notes VALUES (2, 'note2');
+DELETE FROM items WHERE id > 2045 AND id < 2050;
+UPDATE items SET grp = 0 - 1 WHERE id > 2043 AND id < 2052;
+INSERT INTO items VALUES (2047, 7, 1.50, 'again');
+SELECT id, grp, name FROM items WHERE id > 2043 AND id < 2052;
+SELECT id, price FROM items WHERE id < 8 OR id > 4994;
+SELECT id FROM items WHERE grp = 2 AND price > 13.00;
+SELECT id, qty FROM orders WHERE id < 12;
+SELECT id FROM orders WHERE qty < 3;
+SELECT items.id, orders.id, orders.qty FROM items INNER JOIN orders ON items.id = orders.item_id WHERE items.id < 30;
+SELECT * FROM notes;
+DELETE FROM items WHERE grp = 0;
+SELECT id, grp, name FROM items WHERE id > 2043 AND id < 2052;
+SELECT id, price FROM items WHERE id < 8 OR id > 4994;
+SELECT id FROM items WHERE grp = 2 AND price > 13.00;
+SELECT id, qty FROM orders WHERE id < 12;
+SELECT id FROM orders WHERE qty < 3;
+SELECT items.id, orders.id, orders.qty FROM items INNER JOIN orders ON items.id = orders.item_id WHERE items.id < 30;
+SELECT * FROM notes;
+UPDATE items SET price = price + 1.00 WHERE id < 30;
+DELETE FROM orders WHERE qty < 40;
+SELECT id, grp, name FROM items WHERE id > 2043 AND id < 2052;
+SELECT id, price FROM items WHERE id < 8 OR id > 4994;
+SELECT id FROM items WHERE grp = 2 AND price > 13.00;
+SELECT id, qty FROM orders WHERE id < 12;
+SELECT id FROM orders WHERE qty < 3;
+SELECT items.id, orders.id, orders.qty FROM items INNER JOIN orders ON items.id = orders.item_id WHERE items.id < 30;
+SELECT * FROM notes;
+BEGIN;
+DELETE FROM items WHERE id > 3000;
+SELECT id FROM items WHERE id > 4990;
+ROLLBACK;
+SELECT id, grp, name FROM items WHERE id > 2043 AND id < 2052;
+SELECT id, price FROM items WHERE id < 8 OR id > 4994;
+SELECT id FROM items WHERE grp = 2 AND price > 13.00;
+SELECT id, qty FROM orders WHERE id < 12;
+SELECT id FROM orders WHERE qty < 3;
+SELECT items.id, orders.id, orders.qty FROM items INNER JOIN orders ON items.id = orders.item_id WHERE items.id < 30;
+SELECT * FROM notes;
+BEGIN;
+DELETE FROM items WHERE id > 3500;
+DELETE FROM orders WHERE item_id > 3500;
+COMMIT;
+SELECT id, grp, name FROM items WHERE id > 2043 AND id < 2052;
+SELECT id, price FROM items WHERE id < 8 OR id > 4994;
+SELECT id FROM items WHERE grp = 2 AND price > 13.00;
+SELECT id, qty FROM orders WHERE id < 12;
+SELECT id FROM orders WHERE qty < 3;
+SELECT items.id, orders.id, orders.qty FROM items INNER JOIN orders ON items.id = orders.item_id WHERE items.id < 30;
+SELECT * FROM notes;
+DELETE FROM notes;
+INSERT INTO notes VALUES (1, 'only');
+SELECT id, grp, name FROM items WHERE id > 2043 AND id < 2052;
+SELECT id, price FROM items WHERE id < 8 OR id > 4994;
+SELECT id FROM items WHERE grp = 2 AND price > 13.00;
+SELECT id, qty FROM orders WHERE id < 12;
+SELECT id FROM orders WHERE qty < 3;
+SELECT items.id, orders.id, orders.qty FROM items INNER JOIN orders ON items.id = orders.item_id WHERE items.id < 30;
+SELECT * FROM notes;
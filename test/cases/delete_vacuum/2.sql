@@ -0,0 +1,8 @@
+USE DATABASE shop;
+SELECT id, grp, name FROM items WHERE id > 2043 AND id < 2052;
+SELECT id, price FROM items WHERE id < 8 OR id > 4994;
+SELECT id FROM items WHERE grp = 2 AND price > 13.00;
+SELECT id, qty FROM orders WHERE id < 12;
+SELECT id FROM orders WHERE qty < 3;
+SELECT items.id, orders.id, orders.qty FROM items INNER JOIN orders ON items.id = orders.item_id WHERE items.id < 30;
+SELECT * FROM notes;
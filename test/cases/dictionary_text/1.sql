@@ -0,0 +1,5021 @@
+CREATE DATABASE shop;
+USE DATABASE shop;
+CREATE TABLE notes (id INTEGER, item INTEGER, tag TEXT);
+CREATE TABLE items (id INTEGER, price FLOAT, name TEXT);
+CREATE TABLE labels (tag TEXT, text TEXT);
+INSERT INTO notes VALUES (0, 0, 't0');
+INSERT INTO notes VALUES (1, 7, 't13');
+INSERT INTO notes VALUES (2, 14, 't26');
+INSERT INTO notes VALUES (3, 21, 't39');
+INSERT INTO notes VALUES (4, 28, 't52');
+INSERT INTO notes VALUES (5, 35, 't5');
+INSERT INTO notes VALUES (6, 42, 't18');
+INSERT INTO notes VALUES (7, 49, 't31');
+INSERT INTO notes VALUES (8, 56, 't44');
+INSERT INTO notes VALUES (9, 63, 't57');
+INSERT INTO notes VALUES (10, 70, 't10');
+INSERT INTO notes VALUES (11, 77, 't23');
+INSERT INTO notes VALUES (12, 84, 't36');
+INSERT INTO notes VALUES (13, 91, 't49');
+INSERT INTO notes VALUES (14, 98, 't2');
+INSERT INTO notes VALUES (15, 105, 't15');
+INSERT INTO notes VALUES (16, 112, 't28');
+INSERT INTO notes VALUES (17, 119, 't41');
+INSERT INTO notes VALUES (18, 126, 't54');
+INSERT INTO notes VALUES (19, 133, 't7');
+INSERT INTO notes VALUES (20, 140, 't20');
+INSERT INTO notes VALUES (21, 147, 't33');
+INSERT INTO notes VALUES (22, 154, 't46');
+INSERT INTO notes VALUES (23, 161, 't59');
+INSERT INTO notes VALUES (24, 168, 't12');
+INSERT INTO notes VALUES (25, 175, 't25');
+INSERT INTO notes VALUES (26, 182, 't38');
+INSERT INTO notes VALUES (27, 189, 't51');
+INSERT INTO notes VALUES (28, 196, 't4');
+INSERT INTO notes VALUES (29, 203, 't17');
+INSERT INTO notes VALUES (30, 210, 't30');
+INSERT INTO notes VALUES (31, 217, 't43');
+INSERT INTO notes VALUES (32, 224, 't56');
+INSERT INTO notes VALUES (33, 231, 't9');
+INSERT INTO notes VALUES (34, 238, 't22');
+INSERT INTO notes VALUES (35, 245, 't35');
+INSERT INTO notes VALUES (36, 252, 't48');
+INSERT INTO notes VALUES (37, 259, 't1');
+INSERT INTO notes VALUES (38, 266, 't14');
+INSERT INTO notes VALUES (39, 273, 't27');
+INSERT INTO notes VALUES (40, 280, 't40');
+INSERT INTO notes VALUES (41, 287, 't53');
+INSERT INTO notes VALUES (42, 294, 't6');
+INSERT INTO notes VALUES (43, 301, 't19');
+INSERT INTO notes VALUES (44, 308, 't32');
+INSERT INTO notes VALUES (45, 315, 't45');
+INSERT INTO notes VALUES (46, 322, 't58');
+INSERT INTO notes VALUES (47, 329, 't11');
+INSERT INTO notes VALUES (48, 336, 't24');
+INSERT INTO notes VALUES (49, 343, 't37');
+INSERT INTO notes VALUES (50, 350, 't50');
+INSERT INTO notes VALUES (51, 357, 't3');
+INSERT INTO notes VALUES (52, 364, 't16');
+INSERT INTO notes VALUES (53, 371, 't29');
+INSERT INTO notes VALUES (54, 378, 't42');
+INSERT INTO notes VALUES (55, 385, 't55');
+INSERT INTO notes VALUES (56, 392, 't8');
+INSERT INTO notes VALUES (57, 399, 't21');
+INSERT INTO notes VALUES (58, 406, 't34');
+INSERT INTO notes VALUES (59, 413, 't47');
+INSERT INTO notes VALUES (60, 420, 't0');
+INSERT INTO notes VALUES (61, 427, 't13');
+INSERT INTO notes VALUES (62, 434, 't26');
+INSERT INTO notes VALUES (63, 441, 't39');
+INSERT INTO notes VALUES (64, 448, 't52');
+INSERT INTO notes VALUES (65, 455, 't5');
+INSERT INTO notes VALUES (66, 462, 't18');
+INSERT INTO notes VALUES (67, 469, 't31');
+INSERT INTO notes VALUES (68, 476, 't44');
+INSERT INTO notes VALUES (69, 483, 't57');
+INSERT INTO notes VALUES (70, 490, 't10');
+INSERT INTO notes VALUES (71, 497, 't23');
+INSERT INTO notes VALUES (72, 504, 't36');
+INSERT INTO notes VALUES (73, 511, 't49');
+INSERT INTO notes VALUES (74, 518, 't2');
+INSERT INTO notes VALUES (75, 525, 't15');
+INSERT INTO notes VALUES (76, 532, 't28');
+INSERT INTO notes VALUES (77, 539, 't41');
+INSERT INTO notes VALUES (78, 546, 't54');
+INSERT INTO notes VALUES (79, 553, 't7');
+INSERT INTO notes VALUES (80, 560, 't20');
+INSERT INTO notes VALUES (81, 567, 't33');
+INSERT INTO notes VALUES (82, 574, 't46');
+INSERT INTO notes VALUES (83, 581, 't59');
+INSERT INTO notes VALUES (84, 588, 't12');
+INSERT INTO notes VALUES (85, 595, 't25');
+INSERT INTO notes VALUES (86, 602, 't38');
+INSERT INTO notes VALUES (87, 609, 't51');
+INSERT INTO notes VALUES (88, 616, 't4');
+INSERT INTO notes VALUES (89, 623, 't17');
+INSERT INTO notes VALUES (90, 630, 't30');
+INSERT INTO notes VALUES (91, 637, 't43');
+INSERT INTO notes VALUES (92, 644, 't56');
+INSERT INTO notes VALUES (93, 651, 't9');
+INSERT INTO notes VALUES (94, 658, 't22');
+INSERT INTO notes VALUES (95, 665, 't35');
+INSERT INTO notes VALUES (96, 672, 't48');
+INSERT INTO notes VALUES (97, 679, 't1');
+INSERT INTO notes VALUES (98, 686, 't14');
+INSERT INTO notes VALUES (99, 693, 't27');
+INSERT INTO notes VALUES (100, 700, 't40');
+INSERT INTO notes VALUES (101, 707, 't53');
+INSERT INTO notes VALUES (102, 714, 't6');
+INSERT INTO notes VALUES (103, 721, 't19');
+INSERT INTO notes VALUES (104, 728, 't32');
+INSERT INTO notes VALUES (105, 735, 't45');
+INSERT INTO notes VALUES (106, 742, 't58');
+INSERT INTO notes VALUES (107, 749, 't11');
+INSERT INTO notes VALUES (108, 756, 't24');
+INSERT INTO notes VALUES (109, 763, 't37');
+INSERT INTO notes VALUES (110, 770, 't50');
+INSERT INTO notes VALUES (111, 777, 't3');
+INSERT INTO notes VALUES (112, 784, 't16');
+INSERT INTO notes VALUES (113, 791, 't29');
+INSERT INTO notes VALUES (114, 798, 't42');
+INSERT INTO notes VALUES (115, 805, 't55');
+INSERT INTO notes VALUES (116, 812, 't8');
+INSERT INTO notes VALUES (117, 819, 't21');
+INSERT INTO notes VALUES (118, 826, 't34');
+INSERT INTO notes VALUES (119, 833, 't47');
+INSERT INTO notes VALUES (120, 840, 't0');
+INSERT INTO notes VALUES (121, 847, 't13');
+INSERT INTO notes VALUES (122, 854, 't26');
+INSERT INTO notes VALUES (123, 861, 't39');
+INSERT INTO notes VALUES (124, 868, 't52');
+INSERT INTO notes VALUES (125, 875, 't5');
+INSERT INTO notes VALUES (126, 882, 't18');
+INSERT INTO notes VALUES (127, 889, 't31');
+INSERT INTO notes VALUES (128, 896, 't44');
+INSERT INTO notes VALUES (129, 903, 't57');
+INSERT INTO notes VALUES (130, 910, 't10');
+INSERT INTO notes VALUES (131, 917, 't23');
+INSERT INTO notes VALUES (132, 924, 't36');
+INSERT INTO notes VALUES (133, 931, 't49');
+INSERT INTO notes VALUES (134, 938, 't2');
+INSERT INTO notes VALUES (135, 945, 't15');
+INSERT INTO notes VALUES (136, 952, 't28');
+INSERT INTO notes VALUES (137, 959, 't41');
+INSERT INTO notes VALUES (138, 966, 't54');
+INSERT INTO notes VALUES (139, 973, 't7');
+INSERT INTO notes VALUES (140, 980, 't20');
+INSERT INTO notes VALUES (141, 987, 't33');
+INSERT INTO notes VALUES (142, 994, 't46');
+INSERT INTO notes VALUES (143, 1001, 't59');
+INSERT INTO notes VALUES (144, 1008, 't12');
+INSERT INTO notes VALUES (145, 1015, 't25');
+INSERT INTO notes VALUES (146, 1022, 't38');
+INSERT INTO notes VALUES (147, 1029, 't51');
+INSERT INTO notes VALUES (148, 1036, 't4');
+INSERT INTO notes VALUES (149, 1043, 't17');
+INSERT INTO notes VALUES (150, 1050, 't30');
+INSERT INTO notes VALUES (151, 1057, 't43');
+INSERT INTO notes VALUES (152, 1064, 't56');
+INSERT INTO notes VALUES (153, 1071, 't9');
+INSERT INTO notes VALUES (154, 1078, 't22');
+INSERT INTO notes VALUES (155, 1085, 't35');
+INSERT INTO notes VALUES (156, 1092, 't48');
+INSERT INTO notes VALUES (157, 1099, 't1');
+INSERT INTO notes VALUES (158, 1106, 't14');
+INSERT INTO notes VALUES (159, 1113, 't27');
+INSERT INTO notes VALUES (160, 1120, 't40');
+INSERT INTO notes VALUES (161, 1127, 't53');
+INSERT INTO notes VALUES (162, 1134, 't6');
+INSERT INTO notes VALUES (163, 1141, 't19');
+INSERT INTO notes VALUES (164, 1148, 't32');
+INSERT INTO notes VALUES (165, 1155, 't45');
+INSERT INTO notes VALUES (166, 1162, 't58');
+INSERT INTO notes VALUES (167, 1169, 't11');
+INSERT INTO notes VALUES (168, 1176, 't24');
+INSERT INTO notes VALUES (169, 1183, 't37');
+INSERT INTO notes VALUES (170, 1190, 't50');
+INSERT INTO notes VALUES (171, 1197, 't3');
+INSERT INTO notes VALUES (172, 1204, 't16');
+INSERT INTO notes VALUES (173, 1211, 't29');
+INSERT INTO notes VALUES (174, 1218, 't42');
+INSERT INTO notes VALUES (175, 1225, 't55');
+INSERT INTO notes VALUES (176, 1232, 't8');
+INSERT INTO notes VALUES (177, 1239, 't21');
+INSERT INTO notes VALUES (178, 1246, 't34');
+INSERT INTO notes VALUES (179, 1253, 't47');
+INSERT INTO notes VALUES (180, 1260, 't0');
+INSERT INTO notes VALUES (181, 1267, 't13');
+INSERT INTO notes VALUES (182, 1274, 't26');
+INSERT INTO notes VALUES (183, 1281, 't39');
+INSERT INTO notes VALUES (184, 1288, 't52');
+INSERT INTO notes VALUES (185, 1295, 't5');
+INSERT INTO notes VALUES (186, 1302, 't18');
+INSERT INTO notes VALUES (187, 1309, 't31');
+INSERT INTO notes VALUES (188, 1316, 't44');
+INSERT INTO notes VALUES (189, 1323, 't57');
+INSERT INTO notes VALUES (190, 1330, 't10');
+INSERT INTO notes VALUES (191, 1337, 't23');
+INSERT INTO notes VALUES (192, 1344, 't36');
+INSERT INTO notes VALUES (193, 1351, 't49');
+INSERT INTO notes VALUES (194, 1358, 't2');
+INSERT INTO notes VALUES (195, 1365, 't15');
+INSERT INTO notes VALUES (196, 1372, 't28');
+INSERT INTO notes VALUES (197, 1379, 't41');
+INSERT INTO notes VALUES (198, 1386, 't54');
+INSERT INTO notes VALUES (199, 1393, 't7');
+INSERT INTO notes VALUES (200, 1400, 't20');
+INSERT INTO notes VALUES (201, 1407, 't33');
+INSERT INTO notes VALUES (202, 1414, 't46');
+INSERT INTO notes VALUES (203, 1421, 't59');
+INSERT INTO notes VALUES (204, 1428, 't12');
+INSERT INTO notes VALUES (205, 1435, 't25');
+INSERT INTO notes VALUES (206, 1442, 't38');
+INSERT INTO notes VALUES (207, 1449, 't51');
+INSERT INTO notes VALUES (208, 1456, 't4');
+INSERT INTO notes VALUES (209, 1463, 't17');
+INSERT INTO notes VALUES (210, 1470, 't30');
+INSERT INTO notes VALUES (211, 1477, 't43');
+INSERT INTO notes VALUES (212, 1484, 't56');
+INSERT INTO notes VALUES (213, 1491, 't9');
+INSERT INTO notes VALUES (214, 1498, 't22');
+INSERT INTO notes VALUES (215, 1505, 't35');
+INSERT INTO notes VALUES (216, 1512, 't48');
+INSERT INTO notes VALUES (217, 1519, 't1');
+INSERT INTO notes VALUES (218, 1526, 't14');
+INSERT INTO notes VALUES (219, 1533, 't27');
+INSERT INTO notes VALUES (220, 1540, 't40');
+INSERT INTO notes VALUES (221, 1547, 't53');
+INSERT INTO notes VALUES (222, 1554, 't6');
+INSERT INTO notes VALUES (223, 1561, 't19');
+INSERT INTO notes VALUES (224, 1568, 't32');
+INSERT INTO notes VALUES (225, 1575, 't45');
+INSERT INTO notes VALUES (226, 1582, 't58');
+INSERT INTO notes VALUES (227, 1589, 't11');
+INSERT INTO notes VALUES (228, 1596, 't24');
+INSERT INTO notes VALUES (229, 1603, 't37');
+INSERT INTO notes VALUES (230, 1610, 't50');
+INSERT INTO notes VALUES (231, 1617, 't3');
+INSERT INTO notes VALUES (232, 1624, 't16');
+INSERT INTO notes VALUES (233, 1631, 't29');
+INSERT INTO notes VALUES (234, 1638, 't42');
+INSERT INTO notes VALUES (235, 1645, 't55');
+INSERT INTO notes VALUES (236, 1652, 't8');
+INSERT INTO notes VALUES (237, 1659, 't21');
+INSERT INTO notes VALUES (238, 1666, 't34');
+INSERT INTO notes VALUES (239, 1673, 't47');
+INSERT INTO notes VALUES (240, 1680, 't0');
+INSERT INTO notes VALUES (241, 1687, 't13');
+INSERT INTO notes VALUES (242, 1694, 't26');
+INSERT INTO notes VALUES (243, 1701, 't39');
+INSERT INTO notes VALUES (244, 1708, 't52');
+INSERT INTO notes VALUES (245, 1715, 't5');
+INSERT INTO notes VALUES (246, 1722, 't18');
+INSERT INTO notes VALUES (247, 1729, 't31');
+INSERT INTO notes VALUES (248, 1736, 't44');
+INSERT INTO notes VALUES (249, 1743, 't57');
+INSERT INTO notes VALUES (250, 1750, 't10');
+INSERT INTO notes VALUES (251, 1757, 't23');
+INSERT INTO notes VALUES (252, 1764, 't36');
+INSERT INTO notes VALUES (253, 1771, 't49');
+INSERT INTO notes VALUES (254, 1778, 't2');
+INSERT INTO notes VALUES (255, 1785, 't15');
+INSERT INTO notes VALUES (256, 1792, 't28');
+INSERT INTO notes VALUES (257, 1799, 't41');
+INSERT INTO notes VALUES (258, 1806, 't54');
+INSERT INTO notes VALUES (259, 1813, 't7');
+INSERT INTO notes VALUES (260, 1820, 't20');
+INSERT INTO notes VALUES (261, 1827, 't33');
+INSERT INTO notes VALUES (262, 1834, 't46');
+INSERT INTO notes VALUES (263, 1841, 't59');
+INSERT INTO notes VALUES (264, 1848, 't12');
+INSERT INTO notes VALUES (265, 1855, 't25');
+INSERT INTO notes VALUES (266, 1862, 't38');
+INSERT INTO notes VALUES (267, 1869, 't51');
+INSERT INTO notes VALUES (268, 1876, 't4');
+INSERT INTO notes VALUES (269, 1883, 't17');
+INSERT INTO notes VALUES (270, 1890, 't30');
+INSERT INTO notes VALUES (271, 1897, 't43');
+INSERT INTO notes VALUES (272, 1904, 't56');
+INSERT INTO notes VALUES (273, 1911, 't9');
+INSERT INTO notes VALUES (274, 1918, 't22');
+INSERT INTO notes VALUES (275, 1925, 't35');
+INSERT INTO notes VALUES (276, 1932, 't48');
+INSERT INTO notes VALUES (277, 1939, 't1');
+INSERT INTO notes VALUES (278, 1946, 't14');
+INSERT INTO notes VALUES (279, 1953, 't27');
+INSERT INTO notes VALUES (280, 1960, 't40');
+INSERT INTO notes VALUES (281, 1967, 't53');
+INSERT INTO notes VALUES (282, 1974, 't6');
+INSERT INTO notes VALUES (283, 1981, 't19');
+INSERT INTO notes VALUES (284, 1988, 't32');
+INSERT INTO notes VALUES (285, 1995, 't45');
+INSERT INTO notes VALUES (286, 2, 't58');
+INSERT INTO notes VALUES (287, 9, 't11');
+INSERT INTO notes VALUES (288, 16, 't24');
+INSERT INTO notes VALUES (289, 23, 't37');
+INSERT INTO notes VALUES (290, 30, 't50');
+INSERT INTO notes VALUES (291, 37, 't3');
+INSERT INTO notes VALUES (292, 44, 't16');
+INSERT INTO notes VALUES (293, 51, 't29');
+INSERT INTO notes VALUES (294, 58, 't42');
+INSERT INTO notes VALUES (295, 65, 't55');
+INSERT INTO notes VALUES (296, 72, 't8');
+INSERT INTO notes VALUES (297, 79, 't21');
+INSERT INTO notes VALUES (298, 86, 't34');
+INSERT INTO notes VALUES (299, 93, 't47');
+INSERT INTO notes VALUES (300, 100, 't0');
+INSERT INTO notes VALUES (301, 107, 't13');
+INSERT INTO notes VALUES (302, 114, 't26');
+INSERT INTO notes VALUES (303, 121, 't39');
+INSERT INTO notes VALUES (304, 128, 't52');
+INSERT INTO notes VALUES (305, 135, 't5');
+INSERT INTO notes VALUES (306, 142, 't18');
+INSERT INTO notes VALUES (307, 149, 't31');
+INSERT INTO notes VALUES (308, 156, 't44');
+INSERT INTO notes VALUES (309, 163, 't57');
+INSERT INTO notes VALUES (310, 170, 't10');
+INSERT INTO notes VALUES (311, 177, 't23');
+INSERT INTO notes VALUES (312, 184, 't36');
+INSERT INTO notes VALUES (313, 191, 't49');
+INSERT INTO notes VALUES (314, 198, 't2');
+INSERT INTO notes VALUES (315, 205, 't15');
+INSERT INTO notes VALUES (316, 212, 't28');
+INSERT INTO notes VALUES (317, 219, 't41');
+INSERT INTO notes VALUES (318, 226, 't54');
+INSERT INTO notes VALUES (319, 233, 't7');
+INSERT INTO notes VALUES (320, 240, 't20');
+INSERT INTO notes VALUES (321, 247, 't33');
+INSERT INTO notes VALUES (322, 254, 't46');
+INSERT INTO notes VALUES (323, 261, 't59');
+INSERT INTO notes VALUES (324, 268, 't12');
+INSERT INTO notes VALUES (325, 275, 't25');
+INSERT INTO notes VALUES (326, 282, 't38');
+INSERT INTO notes VALUES (327, 289, 't51');
+INSERT INTO notes VALUES (328, 296, 't4');
+INSERT INTO notes VALUES (329, 303, 't17');
+INSERT INTO notes VALUES (330, 310, 't30');
+INSERT INTO notes VALUES (331, 317, 't43');
+INSERT INTO notes VALUES (332, 324, 't56');
+INSERT INTO notes VALUES (333, 331, 't9');
+INSERT INTO notes VALUES (334, 338, 't22');
+INSERT INTO notes VALUES (335, 345, 't35');
+INSERT INTO notes VALUES (336, 352, 't48');
+INSERT INTO notes VALUES (337, 359, 't1');
+INSERT INTO notes VALUES (338, 366, 't14');
+INSERT INTO notes VALUES (339, 373, 't27');
+INSERT INTO notes VALUES (340, 380, 't40');
+INSERT INTO notes VALUES (341, 387, 't53');
+INSERT INTO notes VALUES (342, 394, 't6');
+INSERT INTO notes VALUES (343, 401, 't19');
+INSERT INTO notes VALUES (344, 408, 't32');
+INSERT INTO notes VALUES (345, 415, 't45');
+INSERT INTO notes VALUES (346, 422, 't58');
+INSERT INTO notes VALUES (347, 429, 't11');
+INSERT INTO notes VALUES (348, 436, 't24');
+INSERT INTO notes VALUES (349, 443, 't37');
+INSERT INTO notes VALUES (350, 450, 't50');
+INSERT INTO notes VALUES (351, 457, 't3');
+INSERT INTO notes VALUES (352, 464, 't16');
+INSERT INTO notes VALUES (353, 471, 't29');
+INSERT INTO notes VALUES (354, 478, 't42');
+INSERT INTO notes VALUES (355, 485, 't55');
+INSERT INTO notes VALUES (356, 492, 't8');
+INSERT INTO notes VALUES (357, 499, 't21');
+INSERT INTO notes VALUES (358, 506, 't34');
+INSERT INTO notes VALUES (359, 513, 't47');
+INSERT INTO notes VALUES (360, 520, 't0');
+INSERT INTO notes VALUES (361, 527, 't13');
+INSERT INTO notes VALUES (362, 534, 't26');
+INSERT INTO notes VALUES (363, 541, 't39');
+INSERT INTO notes VALUES (364, 548, 't52');
+INSERT INTO notes VALUES (365, 555, 't5');
+INSERT INTO notes VALUES (366, 562, 't18');
+INSERT INTO notes VALUES (367, 569, 't31');
+INSERT INTO notes VALUES (368, 576, 't44');
+INSERT INTO notes VALUES (369, 583, 't57');
+INSERT INTO notes VALUES (370, 590, 't10');
+INSERT INTO notes VALUES (371, 597, 't23');
+INSERT INTO notes VALUES (372, 604, 't36');
+INSERT INTO notes VALUES (373, 611, 't49');
+INSERT INTO notes VALUES (374, 618, 't2');
+INSERT INTO notes VALUES (375, 625, 't15');
+INSERT INTO notes VALUES (376, 632, 't28');
+INSERT INTO notes VALUES (377, 639, 't41');
+INSERT INTO notes VALUES (378, 646, 't54');
+INSERT INTO notes VALUES (379, 653, 't7');
+INSERT INTO notes VALUES (380, 660, 't20');
+INSERT INTO notes VALUES (381, 667, 't33');
+INSERT INTO notes VALUES (382, 674, 't46');
+INSERT INTO notes VALUES (383, 681, 't59');
+INSERT INTO notes VALUES (384, 688, 't12');
+INSERT INTO notes VALUES (385, 695, 't25');
+INSERT INTO notes VALUES (386, 702, 't38');
+INSERT INTO notes VALUES (387, 709, 't51');
+INSERT INTO notes VALUES (388, 716, 't4');
+INSERT INTO notes VALUES (389, 723, 't17');
+INSERT INTO notes VALUES (390, 730, 't30');
+INSERT INTO notes VALUES (391, 737, 't43');
+INSERT INTO notes VALUES (392, 744, 't56');
+INSERT INTO notes VALUES (393, 751, 't9');
+INSERT INTO notes VALUES (394, 758, 't22');
+INSERT INTO notes VALUES (395, 765, 't35');
+INSERT INTO notes VALUES (396, 772, 't48');
+INSERT INTO notes VALUES (397, 779, 't1');
+INSERT INTO notes VALUES (398, 786, 't14');
+INSERT INTO notes VALUES (399, 793, 't27');
+INSERT INTO notes VALUES (400, 800, 't40');
+INSERT INTO notes VALUES (401, 807, 't53');
+INSERT INTO notes VALUES (402, 814, 't6');
+INSERT INTO notes VALUES (403, 821, 't19');
+INSERT INTO notes VALUES (404, 828, 't32');
+INSERT INTO notes VALUES (405, 835, 't45');
+INSERT INTO notes VALUES (406, 842, 't58');
+INSERT INTO notes VALUES (407, 849, 't11');
+INSERT INTO notes VALUES (408, 856, 't24');
+INSERT INTO notes VALUES (409, 863, 't37');
+INSERT INTO notes VALUES (410, 870, 't50');
+INSERT INTO notes VALUES (411, 877, 't3');
+INSERT INTO notes VALUES (412, 884, 't16');
+INSERT INTO notes VALUES (413, 891, 't29');
+INSERT INTO notes VALUES (414, 898, 't42');
+INSERT INTO notes VALUES (415, 905, 't55');
+INSERT INTO notes VALUES (416, 912, 't8');
+INSERT INTO notes VALUES (417, 919, 't21');
+INSERT INTO notes VALUES (418, 926, 't34');
+INSERT INTO notes VALUES (419, 933, 't47');
+INSERT INTO notes VALUES (420, 940, 't0');
+INSERT INTO notes VALUES (421, 947, 't13');
+INSERT INTO notes VALUES (422, 954, 't26');
+INSERT INTO notes VALUES (423, 961, 't39');
+INSERT INTO notes VALUES (424, 968, 't52');
+INSERT INTO notes VALUES (425, 975, 't5');
+INSERT INTO notes VALUES (426, 982, 't18');
+INSERT INTO notes VALUES (427, 989, 't31');
+INSERT INTO notes VALUES (428, 996, 't44');
+INSERT INTO notes VALUES (429, 1003, 't57');
+INSERT INTO notes VALUES (430, 1010, 't10');
+INSERT INTO notes VALUES (431, 1017, 't23');
+INSERT INTO notes VALUES (432, 1024, 't36');
+INSERT INTO notes VALUES (433, 1031, 't49');
+INSERT INTO notes VALUES (434, 1038, 't2');
+INSERT INTO notes VALUES (435, 1045, 't15');
+INSERT INTO notes VALUES (436, 1052, 't28');
+INSERT INTO notes VALUES (437, 1059, 't41');
+INSERT INTO notes VALUES (438, 1066, 't54');
+INSERT INTO notes VALUES (439, 1073, 't7');
+INSERT INTO notes VALUES (440, 1080, 't20');
+INSERT INTO notes VALUES (441, 1087, 't33');
+INSERT INTO notes VALUES (442, 1094, 't46');
+INSERT INTO notes VALUES (443, 1101, 't59');
+INSERT INTO notes VALUES (444, 1108, 't12');
+INSERT INTO notes VALUES (445, 1115, 't25');
+INSERT INTO notes VALUES (446, 1122, 't38');
+INSERT INTO notes VALUES (447, 1129, 't51');
+INSERT INTO notes VALUES (448, 1136, 't4');
+INSERT INTO notes VALUES (449, 1143, 't17');
+INSERT INTO notes VALUES (450, 1150, 't30');
+INSERT INTO notes VALUES (451, 1157, 't43');
+INSERT INTO notes VALUES (452, 1164, 't56');
+INSERT INTO notes VALUES (453, 1171, 't9');
+INSERT INTO notes VALUES (454, 1178, 't22');
+INSERT INTO notes VALUES (455, 1185, 't35');
+INSERT INTO notes VALUES (456, 1192, 't48');
+INSERT INTO notes VALUES (457, 1199, 't1');
+INSERT INTO notes VALUES (458, 1206, 't14');
+INSERT INTO notes VALUES (459, 1213, 't27');
+INSERT INTO notes VALUES (460, 1220, 't40');
+INSERT INTO notes VALUES (461, 1227, 't53');
+INSERT INTO notes VALUES (462, 1234, 't6');
+INSERT INTO notes VALUES (463, 1241, 't19');
+INSERT INTO notes VALUES (464, 1248, 't32');
+INSERT INTO notes VALUES (465, 1255, 't45');
+INSERT INTO notes VALUES (466, 1262, 't58');
+INSERT INTO notes VALUES (467, 1269, 't11');
+INSERT INTO notes VALUES (468, 1276, 't24');
+INSERT INTO notes VALUES (469, 1283, 't37');
+INSERT INTO notes VALUES (470, 1290, 't50');
+INSERT INTO notes VALUES (471, 1297, 't3');
+INSERT INTO notes VALUES (472, 1304, 't16');
+INSERT INTO notes VALUES (473, 1311, 't29');
+INSERT INTO notes VALUES (474, 1318, 't42');
+INSERT INTO notes VALUES (475, 1325, 't55');
+INSERT INTO notes VALUES (476, 1332, 't8');
+INSERT INTO notes VALUES (477, 1339, 't21');
+INSERT INTO notes VALUES (478, 1346, 't34');
+INSERT INTO notes VALUES (479, 1353, 't47');
+INSERT INTO notes VALUES (480, 1360, 't0');
+INSERT INTO notes VALUES (481, 1367, 't13');
+INSERT INTO notes VALUES (482, 1374, 't26');
+INSERT INTO notes VALUES (483, 1381, 't39');
+INSERT INTO notes VALUES (484, 1388, 't52');
+INSERT INTO notes VALUES (485, 1395, 't5');
+INSERT INTO notes VALUES (486, 1402, 't18');
+INSERT INTO notes VALUES (487, 1409, 't31');
+INSERT INTO notes VALUES (488, 1416, 't44');
+INSERT INTO notes VALUES (489, 1423, 't57');
+INSERT INTO notes VALUES (490, 1430, 't10');
+INSERT INTO notes VALUES (491, 1437, 't23');
+INSERT INTO notes VALUES (492, 1444, 't36');
+INSERT INTO notes VALUES (493, 1451, 't49');
+INSERT INTO notes VALUES (494, 1458, 't2');
+INSERT INTO notes VALUES (495, 1465, 't15');
+INSERT INTO notes VALUES (496, 1472, 't28');
+INSERT INTO notes VALUES (497, 1479, 't41');
+INSERT INTO notes VALUES (498, 1486, 't54');
+INSERT INTO notes VALUES (499, 1493, 't7');
+INSERT INTO notes VALUES (500, 1500, 't20');
+INSERT INTO notes VALUES (501, 1507, 't33');
+INSERT INTO notes VALUES (502, 1514, 't46');
+INSERT INTO notes VALUES (503, 1521, 't59');
+INSERT INTO notes VALUES (504, 1528, 't12');
+INSERT INTO notes VALUES (505, 1535, 't25');
+INSERT INTO notes VALUES (506, 1542, 't38');
+INSERT INTO notes VALUES (507, 1549, 't51');
+INSERT INTO notes VALUES (508, 1556, 't4');
+INSERT INTO notes VALUES (509, 1563, 't17');
+INSERT INTO notes VALUES (510, 1570, 't30');
+INSERT INTO notes VALUES (511, 1577, 't43');
+INSERT INTO notes VALUES (512, 1584, 't56');
+INSERT INTO notes VALUES (513, 1591, 't9');
+INSERT INTO notes VALUES (514, 1598, 't22');
+INSERT INTO notes VALUES (515, 1605, 't35');
+INSERT INTO notes VALUES (516, 1612, 't48');
+INSERT INTO notes VALUES (517, 1619, 't1');
+INSERT INTO notes VALUES (518, 1626, 't14');
+INSERT INTO notes VALUES (519, 1633, 't27');
+INSERT INTO notes VALUES (520, 1640, 't40');
+INSERT INTO notes VALUES (521, 1647, 't53');
+INSERT INTO notes VALUES (522, 1654, 't6');
+INSERT INTO notes VALUES (523, 1661, 't19');
+INSERT INTO notes VALUES (524, 1668, 't32');
+INSERT INTO notes VALUES (525, 1675, 't45');
+INSERT INTO notes VALUES (526, 1682, 't58');
+INSERT INTO notes VALUES (527, 1689, 't11');
+INSERT INTO notes VALUES (528, 1696, 't24');
+INSERT INTO notes VALUES (529, 1703, 't37');
+INSERT INTO notes VALUES (530, 1710, 't50');
+INSERT INTO notes VALUES (531, 1717, 't3');
+INSERT INTO notes VALUES (532, 1724, 't16');
+INSERT INTO notes VALUES (533, 1731, 't29');
+INSERT INTO notes VALUES (534, 1738, 't42');
+INSERT INTO notes VALUES (535, 1745, 't55');
+INSERT INTO notes VALUES (536, 1752, 't8');
+INSERT INTO notes VALUES (537, 1759, 't21');
+INSERT INTO notes VALUES (538, 1766, 't34');
+INSERT INTO notes VALUES (539, 1773, 't47');
+INSERT INTO notes VALUES (540, 1780, 't0');
+INSERT INTO notes VALUES (541, 1787, 't13');
+INSERT INTO notes VALUES (542, 1794, 't26');
+INSERT INTO notes VALUES (543, 1801, 't39');
+INSERT INTO notes VALUES (544, 1808, 't52');
+INSERT INTO notes VALUES (545, 1815, 't5');
+INSERT INTO notes VALUES (546, 1822, 't18');
+INSERT INTO notes VALUES (547, 1829, 't31');
+INSERT INTO notes VALUES (548, 1836, 't44');
+INSERT INTO notes VALUES (549, 1843, 't57');
+INSERT INTO notes VALUES (550, 1850, 't10');
+INSERT INTO notes VALUES (551, 1857, 't23');
+INSERT INTO notes VALUES (552, 1864, 't36');
+INSERT INTO notes VALUES (553, 1871, 't49');
+INSERT INTO notes VALUES (554, 1878, 't2');
+INSERT INTO notes VALUES (555, 1885, 't15');
+INSERT INTO notes VALUES (556, 1892, 't28');
+INSERT INTO notes VALUES (557, 1899, 't41');
+INSERT INTO notes VALUES (558, 1906, 't54');
+INSERT INTO notes VALUES (559, 1913, 't7');
+INSERT INTO notes VALUES (560, 1920, 't20');
+INSERT INTO notes VALUES (561, 1927, 't33');
+INSERT INTO notes VALUES (562, 1934, 't46');
+INSERT INTO notes VALUES (563, 1941, 't59');
+INSERT INTO notes VALUES (564, 1948, 't12');
+INSERT INTO notes VALUES (565, 1955, 't25');
+INSERT INTO notes VALUES (566, 1962, 't38');
+INSERT INTO notes VALUES (567, 1969, 't51');
+INSERT INTO notes VALUES (568, 1976, 't4');
+INSERT INTO notes VALUES (569, 1983, 't17');
+INSERT INTO notes VALUES (570, 1990, 't30');
+INSERT INTO notes VALUES (571, 1997, 't43');
+INSERT INTO notes VALUES (572, 4, 't56');
+INSERT INTO notes VALUES (573, 11, 't9');
+INSERT INTO notes VALUES (574, 18, 't22');
+INSERT INTO notes VALUES (575, 25, 't35');
+INSERT INTO notes VALUES (576, 32, 't48');
+INSERT INTO notes VALUES (577, 39, 't1');
+INSERT INTO notes VALUES (578, 46, 't14');
+INSERT INTO notes VALUES (579, 53, 't27');
+INSERT INTO notes VALUES (580, 60, 't40');
+INSERT INTO notes VALUES (581, 67, 't53');
+INSERT INTO notes VALUES (582, 74, 't6');
+INSERT INTO notes VALUES (583, 81, 't19');
+INSERT INTO notes VALUES (584, 88, 't32');
+INSERT INTO notes VALUES (585, 95, 't45');
+INSERT INTO notes VALUES (586, 102, 't58');
+INSERT INTO notes VALUES (587, 109, 't11');
+INSERT INTO notes VALUES (588, 116, 't24');
+INSERT INTO notes VALUES (589, 123, 't37');
+INSERT INTO notes VALUES (590, 130, 't50');
+INSERT INTO notes VALUES (591, 137, 't3');
+INSERT INTO notes VALUES (592, 144, 't16');
+INSERT INTO notes VALUES (593, 151, 't29');
+INSERT INTO notes VALUES (594, 158, 't42');
+INSERT INTO notes VALUES (595, 165, 't55');
+INSERT INTO notes VALUES (596, 172, 't8');
+INSERT INTO notes VALUES (597, 179, 't21');
+INSERT INTO notes VALUES (598, 186, 't34');
+INSERT INTO notes VALUES (599, 193, 't47');
+INSERT INTO notes VALUES (600, 200, 't0');
+INSERT INTO notes VALUES (601, 207, 't13');
+INSERT INTO notes VALUES (602, 214, 't26');
+INSERT INTO notes VALUES (603, 221, 't39');
+INSERT INTO notes VALUES (604, 228, 't52');
+INSERT INTO notes VALUES (605, 235, 't5');
+INSERT INTO notes VALUES (606, 242, 't18');
+INSERT INTO notes VALUES (607, 249, 't31');
+INSERT INTO notes VALUES (608, 256, 't44');
+INSERT INTO notes VALUES (609, 263, 't57');
+INSERT INTO notes VALUES (610, 270, 't10');
+INSERT INTO notes VALUES (611, 277, 't23');
+INSERT INTO notes VALUES (612, 284, 't36');
+INSERT INTO notes VALUES (613, 291, 't49');
+INSERT INTO notes VALUES (614, 298, 't2');
+INSERT INTO notes VALUES (615, 305, 't15');
+INSERT INTO notes VALUES (616, 312, 't28');
+INSERT INTO notes VALUES (617, 319, 't41');
+INSERT INTO notes VALUES (618, 326, 't54');
+INSERT INTO notes VALUES (619, 333, 't7');
+INSERT INTO notes VALUES (620, 340, 't20');
+INSERT INTO notes VALUES (621, 347, 't33');
+INSERT INTO notes VALUES (622, 354, 't46');
+INSERT INTO notes VALUES (623, 361, 't59');
+INSERT INTO notes VALUES (624, 368, 't12');
+INSERT INTO notes VALUES (625, 375, 't25');
+INSERT INTO notes VALUES (626, 382, 't38');
+INSERT INTO notes VALUES (627, 389, 't51');
+INSERT INTO notes VALUES (628, 396, 't4');
+INSERT INTO notes VALUES (629, 403, 't17');
+INSERT INTO notes VALUES (630, 410, 't30');
+INSERT INTO notes VALUES (631, 417, 't43');
+INSERT INTO notes VALUES (632, 424, 't56');
+INSERT INTO notes VALUES (633, 431, 't9');
+INSERT INTO notes VALUES (634, 438, 't22');
+INSERT INTO notes VALUES (635, 445, 't35');
+INSERT INTO notes VALUES (636, 452, 't48');
+INSERT INTO notes VALUES (637, 459, 't1');
+INSERT INTO notes VALUES (638, 466, 't14');
+INSERT INTO notes VALUES (639, 473, 't27');
+INSERT INTO notes VALUES (640, 480, 't40');
+INSERT INTO notes VALUES (641, 487, 't53');
+INSERT INTO notes VALUES (642, 494, 't6');
+INSERT INTO notes VALUES (643, 501, 't19');
+INSERT INTO notes VALUES (644, 508, 't32');
+INSERT INTO notes VALUES (645, 515, 't45');
+INSERT INTO notes VALUES (646, 522, 't58');
+INSERT INTO notes VALUES (647, 529, 't11');
+INSERT INTO notes VALUES (648, 536, 't24');
+INSERT INTO notes VALUES (649, 543, 't37');
+INSERT INTO notes VALUES (650, 550, 't50');
+INSERT INTO notes VALUES (651, 557, 't3');
+INSERT INTO notes VALUES (652, 564, 't16');
+INSERT INTO notes VALUES (653, 571, 't29');
+INSERT INTO notes VALUES (654, 578, 't42');
+INSERT INTO notes VALUES (655, 585, 't55');
+INSERT INTO notes VALUES (656, 592, 't8');
+INSERT INTO notes VALUES (657, 599, 't21');
+INSERT INTO notes VALUES (658, 606, 't34');
+INSERT INTO notes VALUES (659, 613, 't47');
+INSERT INTO notes VALUES (660, 620, 't0');
+INSERT INTO notes VALUES (661, 627, 't13');
+INSERT INTO notes VALUES (662, 634, 't26');
+INSERT INTO notes VALUES (663, 641, 't39');
+INSERT INTO notes VALUES (664, 648, 't52');
+INSERT INTO notes VALUES (665, 655, 't5');
+INSERT INTO notes VALUES (666, 662, 't18');
+INSERT INTO notes VALUES (667, 669, 't31');
+INSERT INTO notes VALUES (668, 676, 't44');
+INSERT INTO notes VALUES (669, 683, 't57');
+INSERT INTO notes VALUES (670, 690, 't10');
+INSERT INTO notes VALUES (671, 697, 't23');
+INSERT INTO notes VALUES (672, 704, 't36');
+INSERT INTO notes VALUES (673, 711, 't49');
+INSERT INTO notes VALUES (674, 718, 't2');
+INSERT INTO notes VALUES (675, 725, 't15');
+INSERT INTO notes VALUES (676, 732, 't28');
+INSERT INTO notes VALUES (677, 739, 't41');
+INSERT INTO notes VALUES (678, 746, 't54');
+INSERT INTO notes VALUES (679, 753, 't7');
+INSERT INTO notes VALUES (680, 760, 't20');
+INSERT INTO notes VALUES (681, 767, 't33');
+INSERT INTO notes VALUES (682, 774, 't46');
+INSERT INTO notes VALUES (683, 781, 't59');
+INSERT INTO notes VALUES (684, 788, 't12');
+INSERT INTO notes VALUES (685, 795, 't25');
+INSERT INTO notes VALUES (686, 802, 't38');
+INSERT INTO notes VALUES (687, 809, 't51');
+INSERT INTO notes VALUES (688, 816, 't4');
+INSERT INTO notes VALUES (689, 823, 't17');
+INSERT INTO notes VALUES (690, 830, 't30');
+INSERT INTO notes VALUES (691, 837, 't43');
+INSERT INTO notes VALUES (692, 844, 't56');
+INSERT INTO notes VALUES (693, 851, 't9');
+INSERT INTO notes VALUES (694, 858, 't22');
+INSERT INTO notes VALUES (695, 865, 't35');
+INSERT INTO notes VALUES (696, 872, 't48');
+INSERT INTO notes VALUES (697, 879, 't1');
+INSERT INTO notes VALUES (698, 886, 't14');
+INSERT INTO notes VALUES (699, 893, 't27');
+INSERT INTO notes VALUES (700, 900, 't40');
+INSERT INTO notes VALUES (701, 907, 't53');
+INSERT INTO notes VALUES (702, 914, 't6');
+INSERT INTO notes VALUES (703, 921, 't19');
+INSERT INTO notes VALUES (704, 928, 't32');
+INSERT INTO notes VALUES (705, 935, 't45');
+INSERT INTO notes VALUES (706, 942, 't58');
+INSERT INTO notes VALUES (707, 949, 't11');
+INSERT INTO notes VALUES (708, 956, 't24');
+INSERT INTO notes VALUES (709, 963, 't37');
+INSERT INTO notes VALUES (710, 970, 't50');
+INSERT INTO notes VALUES (711, 977, 't3');
+INSERT INTO notes VALUES (712, 984, 't16');
+INSERT INTO notes VALUES (713, 991, 't29');
+INSERT INTO notes VALUES (714, 998, 't42');
+INSERT INTO notes VALUES (715, 1005, 't55');
+INSERT INTO notes VALUES (716, 1012, 't8');
+INSERT INTO notes VALUES (717, 1019, 't21');
+INSERT INTO notes VALUES (718, 1026, 't34');
+INSERT INTO notes VALUES (719, 1033, 't47');
+INSERT INTO notes VALUES (720, 1040, 't0');
+INSERT INTO notes VALUES (721, 1047, 't13');
+INSERT INTO notes VALUES (722, 1054, 't26');
+INSERT INTO notes VALUES (723, 1061, 't39');
+INSERT INTO notes VALUES (724, 1068, 't52');
+INSERT INTO notes VALUES (725, 1075, 't5');
+INSERT INTO notes VALUES (726, 1082, 't18');
+INSERT INTO notes VALUES (727, 1089, 't31');
+INSERT INTO notes VALUES (728, 1096, 't44');
+INSERT INTO notes VALUES (729, 1103, 't57');
+INSERT INTO notes VALUES (730, 1110, 't10');
+INSERT INTO notes VALUES (731, 1117, 't23');
+INSERT INTO notes VALUES (732, 1124, 't36');
+INSERT INTO notes VALUES (733, 1131, 't49');
+INSERT INTO notes VALUES (734, 1138, 't2');
+INSERT INTO notes VALUES (735, 1145, 't15');
+INSERT INTO notes VALUES (736, 1152, 't28');
+INSERT INTO notes VALUES (737, 1159, 't41');
+INSERT INTO notes VALUES (738, 1166, 't54');
+INSERT INTO notes VALUES (739, 1173, 't7');
+INSERT INTO notes VALUES (740, 1180, 't20');
+INSERT INTO notes VALUES (741, 1187, 't33');
+INSERT INTO notes VALUES (742, 1194, 't46');
+INSERT INTO notes VALUES (743, 1201, 't59');
+INSERT INTO notes VALUES (744, 1208, 't12');
+INSERT INTO notes VALUES (745, 1215, 't25');
+INSERT INTO notes VALUES (746, 1222, 't38');
+INSERT INTO notes VALUES (747, 1229, 't51');
+INSERT INTO notes VALUES (748, 1236, 't4');
+INSERT INTO notes VALUES (749, 1243, 't17');
+INSERT INTO notes VALUES (750, 1250, 't30');
+INSERT INTO notes VALUES (751, 1257, 't43');
+INSERT INTO notes VALUES (752, 1264, 't56');
+INSERT INTO notes VALUES (753, 1271, 't9');
+INSERT INTO notes VALUES (754, 1278, 't22');
+INSERT INTO notes VALUES (755, 1285, 't35');
+INSERT INTO notes VALUES (756, 1292, 't48');
+INSERT INTO notes VALUES (757, 1299, 't1');
+INSERT INTO notes VALUES (758, 1306, 't14');
+INSERT INTO notes VALUES (759, 1313, 't27');
+INSERT INTO notes VALUES (760, 1320, 't40');
+INSERT INTO notes VALUES (761, 1327, 't53');
+INSERT INTO notes VALUES (762, 1334, 't6');
+INSERT INTO notes VALUES (763, 1341, 't19');
+INSERT INTO notes VALUES (764, 1348, 't32');
+INSERT INTO notes VALUES (765, 1355, 't45');
+INSERT INTO notes VALUES (766, 1362, 't58');
+INSERT INTO notes VALUES (767, 1369, 't11');
+INSERT INTO notes VALUES (768, 1376, 't24');
+INSERT INTO notes VALUES (769, 1383, 't37');
+INSERT INTO notes VALUES (770, 1390, 't50');
+INSERT INTO notes VALUES (771, 1397, 't3');
+INSERT INTO notes VALUES (772, 1404, 't16');
+INSERT INTO notes VALUES (773, 1411, 't29');
+INSERT INTO notes VALUES (774, 1418, 't42');
+INSERT INTO notes VALUES (775, 1425, 't55');
+INSERT INTO notes VALUES (776, 1432, 't8');
+INSERT INTO notes VALUES (777, 1439, 't21');
+INSERT INTO notes VALUES (778, 1446, 't34');
+INSERT INTO notes VALUES (779, 1453, 't47');
+INSERT INTO notes VALUES (780, 1460, 't0');
+INSERT INTO notes VALUES (781, 1467, 't13');
+INSERT INTO notes VALUES (782, 1474, 't26');
+INSERT INTO notes VALUES (783, 1481, 't39');
+INSERT INTO notes VALUES (784, 1488, 't52');
+INSERT INTO notes VALUES (785, 1495, 't5');
+INSERT INTO notes VALUES (786, 1502, 't18');
+INSERT INTO notes VALUES (787, 1509, 't31');
+INSERT INTO notes VALUES (788, 1516, 't44');
+INSERT INTO notes VALUES (789, 1523, 't57');
+INSERT INTO notes VALUES (790, 1530, 't10');
+INSERT INTO notes VALUES (791, 1537, 't23');
+INSERT INTO notes VALUES (792, 1544, 't36');
+INSERT INTO notes VALUES (793, 1551, 't49');
+INSERT INTO notes VALUES (794, 1558, 't2');
+INSERT INTO notes VALUES (795, 1565, 't15');
+INSERT INTO notes VALUES (796, 1572, 't28');
+INSERT INTO notes VALUES (797, 1579, 't41');
+INSERT INTO notes VALUES (798, 1586, 't54');
+INSERT INTO notes VALUES (799, 1593, 't7');
+INSERT INTO notes VALUES (800, 1600, 't20');
+INSERT INTO notes VALUES (801, 1607, 't33');
+INSERT INTO notes VALUES (802, 1614, 't46');
+INSERT INTO notes VALUES (803, 1621, 't59');
+INSERT INTO notes VALUES (804, 1628, 't12');
+INSERT INTO notes VALUES (805, 1635, 't25');
+INSERT INTO notes VALUES (806, 1642, 't38');
+INSERT INTO notes VALUES (807, 1649, 't51');
+INSERT INTO notes VALUES (808, 1656, 't4');
+INSERT INTO notes VALUES (809, 1663, 't17');
+INSERT INTO notes VALUES (810, 1670, 't30');
+INSERT INTO notes VALUES (811, 1677, 't43');
+INSERT INTO notes VALUES (812, 1684, 't56');
+INSERT INTO notes VALUES (813, 1691, 't9');
+INSERT INTO notes VALUES (814, 1698, 't22');
+INSERT INTO notes VALUES (815, 1705, 't35');
+INSERT INTO notes VALUES (816, 1712, 't48');
+INSERT INTO notes VALUES (817, 1719, 't1');
+INSERT INTO notes VALUES (818, 1726, 't14');
+INSERT INTO notes VALUES (819, 1733, 't27');
+INSERT INTO notes VALUES (820, 1740, 't40');
+INSERT INTO notes VALUES (821, 1747, 't53');
+INSERT INTO notes VALUES (822, 1754, 't6');
+INSERT INTO notes VALUES (823, 1761, 't19');
+INSERT INTO notes VALUES (824, 1768, 't32');
+INSERT INTO notes VALUES (825, 1775, 't45');
+INSERT INTO notes VALUES (826, 1782, 't58');
+INSERT INTO notes VALUES (827, 1789, 't11');
+INSERT INTO notes VALUES (828, 1796, 't24');
+INSERT INTO notes VALUES (829, 1803, 't37');
+INSERT INTO notes VALUES (830, 1810, 't50');
+INSERT INTO notes VALUES (831, 1817, 't3');
+INSERT INTO notes VALUES (832, 1824, 't16');
+INSERT INTO notes VALUES (833, 1831, 't29');
+INSERT INTO notes VALUES (834, 1838, 't42');
+INSERT INTO notes VALUES (835, 1845, 't55');
+INSERT INTO notes VALUES (836, 1852, 't8');
+INSERT INTO notes VALUES (837, 1859, 't21');
+INSERT INTO notes VALUES (838, 1866, 't34');
+INSERT INTO notes VALUES (839, 1873, 't47');
+INSERT INTO notes VALUES (840, 1880, 't0');
+INSERT INTO notes VALUES (841, 1887, 't13');
+INSERT INTO notes VALUES (842, 1894, 't26');
+INSERT INTO notes VALUES (843, 1901, 't39');
+INSERT INTO notes VALUES (844, 1908, 't52');
+INSERT INTO notes VALUES (845, 1915, 't5');
+INSERT INTO notes VALUES (846, 1922, 't18');
+INSERT INTO notes VALUES (847, 1929, 't31');
+INSERT INTO notes VALUES (848, 1936, 't44');
+INSERT INTO notes VALUES (849, 1943, 't57');
+INSERT INTO notes VALUES (850, 1950, 't10');
+INSERT INTO notes VALUES (851, 1957, 't23');
+INSERT INTO notes VALUES (852, 1964, 't36');
+INSERT INTO notes VALUES (853, 1971, 't49');
+INSERT INTO notes VALUES (854, 1978, 't2');
+INSERT INTO notes VALUES (855, 1985, 't15');
+INSERT INTO notes VALUES (856, 1992, 't28');
+INSERT INTO notes VALUES (857, 1999, 't41');
+INSERT INTO notes VALUES (858, 6, 't54');
+INSERT INTO notes VALUES (859, 13, 't7');
+INSERT INTO notes VALUES (860, 20, 't20');
+INSERT INTO notes VALUES (861, 27, 't33');
+INSERT INTO notes VALUES (862, 34, 't46');
+INSERT INTO notes VALUES (863, 41, 't59');
+INSERT INTO notes VALUES (864, 48, 't12');
+INSERT INTO notes VALUES (865, 55, 't25');
+INSERT INTO notes VALUES (866, 62, 't38');
+INSERT INTO notes VALUES (867, 69, 't51');
+INSERT INTO notes VALUES (868, 76, 't4');
+INSERT INTO notes VALUES (869, 83, 't17');
+INSERT INTO notes VALUES (870, 90, 't30');
+INSERT INTO notes VALUES (871, 97, 't43');
+INSERT INTO notes VALUES (872, 104, 't56');
+INSERT INTO notes VALUES (873, 111, 't9');
+INSERT INTO notes VALUES (874, 118, 't22');
+INSERT INTO notes VALUES (875, 125, 't35');
+INSERT INTO notes VALUES (876, 132, 't48');
+INSERT INTO notes VALUES (877, 139, 't1');
+INSERT INTO notes VALUES (878, 146, 't14');
+INSERT INTO notes VALUES (879, 153, 't27');
+INSERT INTO notes VALUES (880, 160, 't40');
+INSERT INTO notes VALUES (881, 167, 't53');
+INSERT INTO notes VALUES (882, 174, 't6');
+INSERT INTO notes VALUES (883, 181, 't19');
+INSERT INTO notes VALUES (884, 188, 't32');
+INSERT INTO notes VALUES (885, 195, 't45');
+INSERT INTO notes VALUES (886, 202, 't58');
+INSERT INTO notes VALUES (887, 209, 't11');
+INSERT INTO notes VALUES (888, 216, 't24');
+INSERT INTO notes VALUES (889, 223, 't37');
+INSERT INTO notes VALUES (890, 230, 't50');
+INSERT INTO notes VALUES (891, 237, 't3');
+INSERT INTO notes VALUES (892, 244, 't16');
+INSERT INTO notes VALUES (893, 251, 't29');
+INSERT INTO notes VALUES (894, 258, 't42');
+INSERT INTO notes VALUES (895, 265, 't55');
+INSERT INTO notes VALUES (896, 272, 't8');
+INSERT INTO notes VALUES (897, 279, 't21');
+INSERT INTO notes VALUES (898, 286, 't34');
+INSERT INTO notes VALUES (899, 293, 't47');
+INSERT INTO notes VALUES (900, 300, 't0');
+INSERT INTO notes VALUES (901, 307, 't13');
+INSERT INTO notes VALUES (902, 314, 't26');
+INSERT INTO notes VALUES (903, 321, 't39');
+INSERT INTO notes VALUES (904, 328, 't52');
+INSERT INTO notes VALUES (905, 335, 't5');
+INSERT INTO notes VALUES (906, 342, 't18');
+INSERT INTO notes VALUES (907, 349, 't31');
+INSERT INTO notes VALUES (908, 356, 't44');
+INSERT INTO notes VALUES (909, 363, 't57');
+INSERT INTO notes VALUES (910, 370, 't10');
+INSERT INTO notes VALUES (911, 377, 't23');
+INSERT INTO notes VALUES (912, 384, 't36');
+INSERT INTO notes VALUES (913, 391, 't49');
+INSERT INTO notes VALUES (914, 398, 't2');
+INSERT INTO notes VALUES (915, 405, 't15');
+INSERT INTO notes VALUES (916, 412, 't28');
+INSERT INTO notes VALUES (917, 419, 't41');
+INSERT INTO notes VALUES (918, 426, 't54');
+INSERT INTO notes VALUES (919, 433, 't7');
+INSERT INTO notes VALUES (920, 440, 't20');
+INSERT INTO notes VALUES (921, 447, 't33');
+INSERT INTO notes VALUES (922, 454, 't46');
+INSERT INTO notes VALUES (923, 461, 't59');
+INSERT INTO notes VALUES (924, 468, 't12');
+INSERT INTO notes VALUES (925, 475, 't25');
+INSERT INTO notes VALUES (926, 482, 't38');
+INSERT INTO notes VALUES (927, 489, 't51');
+INSERT INTO notes VALUES (928, 496, 't4');
+INSERT INTO notes VALUES (929, 503, 't17');
+INSERT INTO notes VALUES (930, 510, 't30');
+INSERT INTO notes VALUES (931, 517, 't43');
+INSERT INTO notes VALUES (932, 524, 't56');
+INSERT INTO notes VALUES (933, 531, 't9');
+INSERT INTO notes VALUES (934, 538, 't22');
+INSERT INTO notes VALUES (935, 545, 't35');
+INSERT INTO notes VALUES (936, 552, 't48');
+INSERT INTO notes VALUES (937, 559, 't1');
+INSERT INTO notes VALUES (938, 566, 't14');
+INSERT INTO notes VALUES (939, 573, 't27');
+INSERT INTO notes VALUES (940, 580, 't40');
+INSERT INTO notes VALUES (941, 587, 't53');
+INSERT INTO notes VALUES (942, 594, 't6');
+INSERT INTO notes VALUES (943, 601, 't19');
+INSERT INTO notes VALUES (944, 608, 't32');
+INSERT INTO notes VALUES (945, 615, 't45');
+INSERT INTO notes VALUES (946, 622, 't58');
+INSERT INTO notes VALUES (947, 629, 't11');
+INSERT INTO notes VALUES (948, 636, 't24');
+INSERT INTO notes VALUES (949, 643, 't37');
+INSERT INTO notes VALUES (950, 650, 't50');
+INSERT INTO notes VALUES (951, 657, 't3');
+INSERT INTO notes VALUES (952, 664, 't16');
+INSERT INTO notes VALUES (953, 671, 't29');
+INSERT INTO notes VALUES (954, 678, 't42');
+INSERT INTO notes VALUES (955, 685, 't55');
+INSERT INTO notes VALUES (956, 692, 't8');
+INSERT INTO notes VALUES (957, 699, 't21');
+INSERT INTO notes VALUES (958, 706, 't34');
+INSERT INTO notes VALUES (959, 713, 't47');
+INSERT INTO notes VALUES (960, 720, 't0');
+INSERT INTO notes VALUES (961, 727, 't13');
+INSERT INTO notes VALUES (962, 734, 't26');
+INSERT INTO notes VALUES (963, 741, 't39');
+INSERT INTO notes VALUES (964, 748, 't52');
+INSERT INTO notes VALUES (965, 755, 't5');
+INSERT INTO notes VALUES (966, 762, 't18');
+INSERT INTO notes VALUES (967, 769, 't31');
+INSERT INTO notes VALUES (968, 776, 't44');
+INSERT INTO notes VALUES (969, 783, 't57');
+INSERT INTO notes VALUES (970, 790, 't10');
+INSERT INTO notes VALUES (971, 797, 't23');
+INSERT INTO notes VALUES (972, 804, 't36');
+INSERT INTO notes VALUES (973, 811, 't49');
+INSERT INTO notes VALUES (974, 818, 't2');
+INSERT INTO notes VALUES (975, 825, 't15');
+INSERT INTO notes VALUES (976, 832, 't28');
+INSERT INTO notes VALUES (977, 839, 't41');
+INSERT INTO notes VALUES (978, 846, 't54');
+INSERT INTO notes VALUES (979, 853, 't7');
+INSERT INTO notes VALUES (980, 860, 't20');
+INSERT INTO notes VALUES (981, 867, 't33');
+INSERT INTO notes VALUES (982, 874, 't46');
+INSERT INTO notes VALUES (983, 881, 't59');
+INSERT INTO notes VALUES (984, 888, 't12');
+INSERT INTO notes VALUES (985, 895, 't25');
+INSERT INTO notes VALUES (986, 902, 't38');
+INSERT INTO notes VALUES (987, 909, 't51');
+INSERT INTO notes VALUES (988, 916, 't4');
+INSERT INTO notes VALUES (989, 923, 't17');
+INSERT INTO notes VALUES (990, 930, 't30');
+INSERT INTO notes VALUES (991, 937, 't43');
+INSERT INTO notes VALUES (992, 944, 't56');
+INSERT INTO notes VALUES (993, 951, 't9');
+INSERT INTO notes VALUES (994, 958, 't22');
+INSERT INTO notes VALUES (995, 965, 't35');
+INSERT INTO notes VALUES (996, 972, 't48');
+INSERT INTO notes VALUES (997, 979, 't1');
+INSERT INTO notes VALUES (998, 986, 't14');
+INSERT INTO notes VALUES (999, 993, 't27');
+INSERT INTO notes VALUES (1000, 1000, 't40');
+INSERT INTO notes VALUES (1001, 1007, 't53');
+INSERT INTO notes VALUES (1002, 1014, 't6');
+INSERT INTO notes VALUES (1003, 1021, 't19');
+INSERT INTO notes VALUES (1004, 1028, 't32');
+INSERT INTO notes VALUES (1005, 1035, 't45');
+INSERT INTO notes VALUES (1006, 1042, 't58');
+INSERT INTO notes VALUES (1007, 1049, 't11');
+INSERT INTO notes VALUES (1008, 1056, 't24');
+INSERT INTO notes VALUES (1009, 1063, 't37');
+INSERT INTO notes VALUES (1010, 1070, 't50');
+INSERT INTO notes VALUES (1011, 1077, 't3');
+INSERT INTO notes VALUES (1012, 1084, 't16');
+INSERT INTO notes VALUES (1013, 1091, 't29');
+INSERT INTO notes VALUES (1014, 1098, 't42');
+INSERT INTO notes VALUES (1015, 1105, 't55');
+INSERT INTO notes VALUES (1016, 1112, 't8');
+INSERT INTO notes VALUES (1017, 1119, 't21');
+INSERT INTO notes VALUES (1018, 1126, 't34');
+INSERT INTO notes VALUES (1019, 1133, 't47');
+INSERT INTO notes VALUES (1020, 1140, 't0');
+INSERT INTO notes VALUES (1021, 1147, 't13');
+INSERT INTO notes VALUES (1022, 1154, 't26');
+INSERT INTO notes VALUES (1023, 1161, 't39');
+INSERT INTO notes VALUES (1024, 1168, 't52');
+INSERT INTO notes VALUES (1025, 1175, 't5');
+INSERT INTO notes VALUES (1026, 1182, 't18');
+INSERT INTO notes VALUES (1027, 1189, 't31');
+INSERT INTO notes VALUES (1028, 1196, 't44');
+INSERT INTO notes VALUES (1029, 1203, 't57');
+INSERT INTO notes VALUES (1030, 1210, 't10');
+INSERT INTO notes VALUES (1031, 1217, 't23');
+INSERT INTO notes VALUES (1032, 1224, 't36');
+INSERT INTO notes VALUES (1033, 1231, 't49');
+INSERT INTO notes VALUES (1034, 1238, 't2');
+INSERT INTO notes VALUES (1035, 1245, 't15');
+INSERT INTO notes VALUES (1036, 1252, 't28');
+INSERT INTO notes VALUES (1037, 1259, 't41');
+INSERT INTO notes VALUES (1038, 1266, 't54');
+INSERT INTO notes VALUES (1039, 1273, 't7');
+INSERT INTO notes VALUES (1040, 1280, 't20');
+INSERT INTO notes VALUES (1041, 1287, 't33');
+INSERT INTO notes VALUES (1042, 1294, 't46');
+INSERT INTO notes VALUES (1043, 1301, 't59');
+INSERT INTO notes VALUES (1044, 1308, 't12');
+INSERT INTO notes VALUES (1045, 1315, 't25');
+INSERT INTO notes VALUES (1046, 1322, 't38');
+INSERT INTO notes VALUES (1047, 1329, 't51');
+INSERT INTO notes VALUES (1048, 1336, 't4');
+INSERT INTO notes VALUES (1049, 1343, 't17');
+INSERT INTO notes VALUES (1050, 1350, 't30');
+INSERT INTO notes VALUES (1051, 1357, 't43');
+INSERT INTO notes VALUES (1052, 1364, 't56');
+INSERT INTO notes VALUES (1053, 1371, 't9');
+INSERT INTO notes VALUES (1054, 1378, 't22');
+INSERT INTO notes VALUES (1055, 1385, 't35');
+INSERT INTO notes VALUES (1056, 1392, 't48');
+INSERT INTO notes VALUES (1057, 1399, 't1');
+INSERT INTO notes VALUES (1058, 1406, 't14');
+INSERT INTO notes VALUES (1059, 1413, 't27');
+INSERT INTO notes VALUES (1060, 1420, 't40');
+INSERT INTO notes VALUES (1061, 1427, 't53');
+INSERT INTO notes VALUES (1062, 1434, 't6');
+INSERT INTO notes VALUES (1063, 1441, 't19');
+INSERT INTO notes VALUES (1064, 1448, 't32');
+INSERT INTO notes VALUES (1065, 1455, 't45');
+INSERT INTO notes VALUES (1066, 1462, 't58');
+INSERT INTO notes VALUES (1067, 1469, 't11');
+INSERT INTO notes VALUES (1068, 1476, 't24');
+INSERT INTO notes VALUES (1069, 1483, 't37');
+INSERT INTO notes VALUES (1070, 1490, 't50');
+INSERT INTO notes VALUES (1071, 1497, 't3');
+INSERT INTO notes VALUES (1072, 1504, 't16');
+INSERT INTO notes VALUES (1073, 1511, 't29');
+INSERT INTO notes VALUES (1074, 1518, 't42');
+INSERT INTO notes VALUES (1075, 1525, 't55');
+INSERT INTO notes VALUES (1076, 1532, 't8');
+INSERT INTO notes VALUES (1077, 1539, 't21');
+INSERT INTO notes VALUES (1078, 1546, 't34');
+INSERT INTO notes VALUES (1079, 1553, 't47');
+INSERT INTO notes VALUES (1080, 1560, 't0');
+INSERT INTO notes VALUES (1081, 1567, 't13');
+INSERT INTO notes VALUES (1082, 1574, 't26');
+INSERT INTO notes VALUES (1083, 1581, 't39');
+INSERT INTO notes VALUES (1084, 1588, 't52');
+INSERT INTO notes VALUES (1085, 1595, 't5');
+INSERT INTO notes VALUES (1086, 1602, 't18');
+INSERT INTO notes VALUES (1087, 1609, 't31');
+INSERT INTO notes VALUES (1088, 1616, 't44');
+INSERT INTO notes VALUES (1089, 1623, 't57');
+INSERT INTO notes VALUES (1090, 1630, 't10');
+INSERT INTO notes VALUES (1091, 1637, 't23');
+INSERT INTO notes VALUES (1092, 1644, 't36');
+INSERT INTO notes VALUES (1093, 1651, 't49');
+INSERT INTO notes VALUES (1094, 1658, 't2');
+INSERT INTO notes VALUES (1095, 1665, 't15');
+INSERT INTO notes VALUES (1096, 1672, 't28');
+INSERT INTO notes VALUES (1097, 1679, 't41');
+INSERT INTO notes VALUES (1098, 1686, 't54');
+INSERT INTO notes VALUES (1099, 1693, 't7');
+INSERT INTO notes VALUES (1100, 1700, 't20');
+INSERT INTO notes VALUES (1101, 1707, 't33');
+INSERT INTO notes VALUES (1102, 1714, 't46');
+INSERT INTO notes VALUES (1103, 1721, 't59');
+INSERT INTO notes VALUES (1104, 1728, 't12');
+INSERT INTO notes VALUES (1105, 1735, 't25');
+INSERT INTO notes VALUES (1106, 1742, 't38');
+INSERT INTO notes VALUES (1107, 1749, 't51');
+INSERT INTO notes VALUES (1108, 1756, 't4');
+INSERT INTO notes VALUES (1109, 1763, 't17');
+INSERT INTO notes VALUES (1110, 1770, 't30');
+INSERT INTO notes VALUES (1111, 1777, 't43');
+INSERT INTO notes VALUES (1112, 1784, 't56');
+INSERT INTO notes VALUES (1113, 1791, 't9');
+INSERT INTO notes VALUES (1114, 1798, 't22');
+INSERT INTO notes VALUES (1115, 1805, 't35');
+INSERT INTO notes VALUES (1116, 1812, 't48');
+INSERT INTO notes VALUES (1117, 1819, 't1');
+INSERT INTO notes VALUES (1118, 1826, 't14');
+INSERT INTO notes VALUES (1119, 1833, 't27');
+INSERT INTO notes VALUES (1120, 1840, 't40');
+INSERT INTO notes VALUES (1121, 1847, 't53');
+INSERT INTO notes VALUES (1122, 1854, 't6');
+INSERT INTO notes VALUES (1123, 1861, 't19');
+INSERT INTO notes VALUES (1124, 1868, 't32');
+INSERT INTO notes VALUES (1125, 1875, 't45');
+INSERT INTO notes VALUES (1126, 1882, 't58');
+INSERT INTO notes VALUES (1127, 1889, 't11');
+INSERT INTO notes VALUES (1128, 1896, 't24');
+INSERT INTO notes VALUES (1129, 1903, 't37');
+INSERT INTO notes VALUES (1130, 1910, 't50');
+INSERT INTO notes VALUES (1131, 1917, 't3');
+INSERT INTO notes VALUES (1132, 1924, 't16');
+INSERT INTO notes VALUES (1133, 1931, 't29');
+INSERT INTO notes VALUES (1134, 1938, 't42');
+INSERT INTO notes VALUES (1135, 1945, 't55');
+INSERT INTO notes VALUES (1136, 1952, 't8');
+INSERT INTO notes VALUES (1137, 1959, 't21');
+INSERT INTO notes VALUES (1138, 1966, 't34');
+INSERT INTO notes VALUES (1139, 1973, 't47');
+INSERT INTO notes VALUES (1140, 1980, 't0');
+INSERT INTO notes VALUES (1141, 1987, 't13');
+INSERT INTO notes VALUES (1142, 1994, 't26');
+INSERT INTO notes VALUES (1143, 1, 't39');
+INSERT INTO notes VALUES (1144, 8, 't52');
+INSERT INTO notes VALUES (1145, 15, 't5');
+INSERT INTO notes VALUES (1146, 22, 't18');
+INSERT INTO notes VALUES (1147, 29, 't31');
+INSERT INTO notes VALUES (1148, 36, 't44');
+INSERT INTO notes VALUES (1149, 43, 't57');
+INSERT INTO notes VALUES (1150, 50, 't10');
+INSERT INTO notes VALUES (1151, 57, 't23');
+INSERT INTO notes VALUES (1152, 64, 't36');
+INSERT INTO notes VALUES (1153, 71, 't49');
+INSERT INTO notes VALUES (1154, 78, 't2');
+INSERT INTO notes VALUES (1155, 85, 't15');
+INSERT INTO notes VALUES (1156, 92, 't28');
+INSERT INTO notes VALUES (1157, 99, 't41');
+INSERT INTO notes VALUES (1158, 106, 't54');
+INSERT INTO notes VALUES (1159, 113, 't7');
+INSERT INTO notes VALUES (1160, 120, 't20');
+INSERT INTO notes VALUES (1161, 127, 't33');
+INSERT INTO notes VALUES (1162, 134, 't46');
+INSERT INTO notes VALUES (1163, 141, 't59');
+INSERT INTO notes VALUES (1164, 148, 't12');
+INSERT INTO notes VALUES (1165, 155, 't25');
+INSERT INTO notes VALUES (1166, 162, 't38');
+INSERT INTO notes VALUES (1167, 169, 't51');
+INSERT INTO notes VALUES (1168, 176, 't4');
+INSERT INTO notes VALUES (1169, 183, 't17');
+INSERT INTO notes VALUES (1170, 190, 't30');
+INSERT INTO notes VALUES (1171, 197, 't43');
+INSERT INTO notes VALUES (1172, 204, 't56');
+INSERT INTO notes VALUES (1173, 211, 't9');
+INSERT INTO notes VALUES (1174, 218, 't22');
+INSERT INTO notes VALUES (1175, 225, 't35');
+INSERT INTO notes VALUES (1176, 232, 't48');
+INSERT INTO notes VALUES (1177, 239, 't1');
+INSERT INTO notes VALUES (1178, 246, 't14');
+INSERT INTO notes VALUES (1179, 253, 't27');
+INSERT INTO notes VALUES (1180, 260, 't40');
+INSERT INTO notes VALUES (1181, 267, 't53');
+INSERT INTO notes VALUES (1182, 274, 't6');
+INSERT INTO notes VALUES (1183, 281, 't19');
+INSERT INTO notes VALUES (1184, 288, 't32');
+INSERT INTO notes VALUES (1185, 295, 't45');
+INSERT INTO notes VALUES (1186, 302, 't58');
+INSERT INTO notes VALUES (1187, 309, 't11');
+INSERT INTO notes VALUES (1188, 316, 't24');
+INSERT INTO notes VALUES (1189, 323, 't37');
+INSERT INTO notes VALUES (1190, 330, 't50');
+INSERT INTO notes VALUES (1191, 337, 't3');
+INSERT INTO notes VALUES (1192, 344, 't16');
+INSERT INTO notes VALUES (1193, 351, 't29');
+INSERT INTO notes VALUES (1194, 358, 't42');
+INSERT INTO notes VALUES (1195, 365, 't55');
+INSERT INTO notes VALUES (1196, 372, 't8');
+INSERT INTO notes VALUES (1197, 379, 't21');
+INSERT INTO notes VALUES (1198, 386, 't34');
+INSERT INTO notes VALUES (1199, 393, 't47');
+INSERT INTO notes VALUES (1200, 400, 't0');
+INSERT INTO notes VALUES (1201, 407, 't13');
+INSERT INTO notes VALUES (1202, 414, 't26');
+INSERT INTO notes VALUES (1203, 421, 't39');
+INSERT INTO notes VALUES (1204, 428, 't52');
+INSERT INTO notes VALUES (1205, 435, 't5');
+INSERT INTO notes VALUES (1206, 442, 't18');
+INSERT INTO notes VALUES (1207, 449, 't31');
+INSERT INTO notes VALUES (1208, 456, 't44');
+INSERT INTO notes VALUES (1209, 463, 't57');
+INSERT INTO notes VALUES (1210, 470, 't10');
+INSERT INTO notes VALUES (1211, 477, 't23');
+INSERT INTO notes VALUES (1212, 484, 't36');
+INSERT INTO notes VALUES (1213, 491, 't49');
+INSERT INTO notes VALUES (1214, 498, 't2');
+INSERT INTO notes VALUES (1215, 505, 't15');
+INSERT INTO notes VALUES (1216, 512, 't28');
+INSERT INTO notes VALUES (1217, 519, 't41');
+INSERT INTO notes VALUES (1218, 526, 't54');
+INSERT INTO notes VALUES (1219, 533, 't7');
+INSERT INTO notes VALUES (1220, 540, 't20');
+INSERT INTO notes VALUES (1221, 547, 't33');
+INSERT INTO notes VALUES (1222, 554, 't46');
+INSERT INTO notes VALUES (1223, 561, 't59');
+INSERT INTO notes VALUES (1224, 568, 't12');
+INSERT INTO notes VALUES (1225, 575, 't25');
+INSERT INTO notes VALUES (1226, 582, 't38');
+INSERT INTO notes VALUES (1227, 589, 't51');
+INSERT INTO notes VALUES (1228, 596, 't4');
+INSERT INTO notes VALUES (1229, 603, 't17');
+INSERT INTO notes VALUES (1230, 610, 't30');
+INSERT INTO notes VALUES (1231, 617, 't43');
+INSERT INTO notes VALUES (1232, 624, 't56');
+INSERT INTO notes VALUES (1233, 631, 't9');
+INSERT INTO notes VALUES (1234, 638, 't22');
+INSERT INTO notes VALUES (1235, 645, 't35');
+INSERT INTO notes VALUES (1236, 652, 't48');
+INSERT INTO notes VALUES (1237, 659, 't1');
+INSERT INTO notes VALUES (1238, 666, 't14');
+INSERT INTO notes VALUES (1239, 673, 't27');
+INSERT INTO notes VALUES (1240, 680, 't40');
+INSERT INTO notes VALUES (1241, 687, 't53');
+INSERT INTO notes VALUES (1242, 694, 't6');
+INSERT INTO notes VALUES (1243, 701, 't19');
+INSERT INTO notes VALUES (1244, 708, 't32');
+INSERT INTO notes VALUES (1245, 715, 't45');
+INSERT INTO notes VALUES (1246, 722, 't58');
+INSERT INTO notes VALUES (1247, 729, 't11');
+INSERT INTO notes VALUES (1248, 736, 't24');
+INSERT INTO notes VALUES (1249, 743, 't37');
+INSERT INTO notes VALUES (1250, 750, 't50');
+INSERT INTO notes VALUES (1251, 757, 't3');
+INSERT INTO notes VALUES (1252, 764, 't16');
+INSERT INTO notes VALUES (1253, 771, 't29');
+INSERT INTO notes VALUES (1254, 778, 't42');
+INSERT INTO notes VALUES (1255, 785, 't55');
+INSERT INTO notes VALUES (1256, 792, 't8');
+INSERT INTO notes VALUES (1257, 799, 't21');
+INSERT INTO notes VALUES (1258, 806, 't34');
+INSERT INTO notes VALUES (1259, 813, 't47');
+INSERT INTO notes VALUES (1260, 820, 't0');
+INSERT INTO notes VALUES (1261, 827, 't13');
+INSERT INTO notes VALUES (1262, 834, 't26');
+INSERT INTO notes VALUES (1263, 841, 't39');
+INSERT INTO notes VALUES (1264, 848, 't52');
+INSERT INTO notes VALUES (1265, 855, 't5');
+INSERT INTO notes VALUES (1266, 862, 't18');
+INSERT INTO notes VALUES (1267, 869, 't31');
+INSERT INTO notes VALUES (1268, 876, 't44');
+INSERT INTO notes VALUES (1269, 883, 't57');
+INSERT INTO notes VALUES (1270, 890, 't10');
+INSERT INTO notes VALUES (1271, 897, 't23');
+INSERT INTO notes VALUES (1272, 904, 't36');
+INSERT INTO notes VALUES (1273, 911, 't49');
+INSERT INTO notes VALUES (1274, 918, 't2');
+INSERT INTO notes VALUES (1275, 925, 't15');
+INSERT INTO notes VALUES (1276, 932, 't28');
+INSERT INTO notes VALUES (1277, 939, 't41');
+INSERT INTO notes VALUES (1278, 946, 't54');
+INSERT INTO notes VALUES (1279, 953, 't7');
+INSERT INTO notes VALUES (1280, 960, 't20');
+INSERT INTO notes VALUES (1281, 967, 't33');
+INSERT INTO notes VALUES (1282, 974, 't46');
+INSERT INTO notes VALUES (1283, 981, 't59');
+INSERT INTO notes VALUES (1284, 988, 't12');
+INSERT INTO notes VALUES (1285, 995, 't25');
+INSERT INTO notes VALUES (1286, 1002, 't38');
+INSERT INTO notes VALUES (1287, 1009, 't51');
+INSERT INTO notes VALUES (1288, 1016, 't4');
+INSERT INTO notes VALUES (1289, 1023, 't17');
+INSERT INTO notes VALUES (1290, 1030, 't30');
+INSERT INTO notes VALUES (1291, 1037, 't43');
+INSERT INTO notes VALUES (1292, 1044, 't56');
+INSERT INTO notes VALUES (1293, 1051, 't9');
+INSERT INTO notes VALUES (1294, 1058, 't22');
+INSERT INTO notes VALUES (1295, 1065, 't35');
+INSERT INTO notes VALUES (1296, 1072, 't48');
+INSERT INTO notes VALUES (1297, 1079, 't1');
+INSERT INTO notes VALUES (1298, 1086, 't14');
+INSERT INTO notes VALUES (1299, 1093, 't27');
+INSERT INTO notes VALUES (1300, 1100, 't40');
+INSERT INTO notes VALUES (1301, 1107, 't53');
+INSERT INTO notes VALUES (1302, 1114, 't6');
+INSERT INTO notes VALUES (1303, 1121, 't19');
+INSERT INTO notes VALUES (1304, 1128, 't32');
+INSERT INTO notes VALUES (1305, 1135, 't45');
+INSERT INTO notes VALUES (1306, 1142, 't58');
+INSERT INTO notes VALUES (1307, 1149, 't11');
+INSERT INTO notes VALUES (1308, 1156, 't24');
+INSERT INTO notes VALUES (1309, 1163, 't37');
+INSERT INTO notes VALUES (1310, 1170, 't50');
+INSERT INTO notes VALUES (1311, 1177, 't3');
+INSERT INTO notes VALUES (1312, 1184, 't16');
+INSERT INTO notes VALUES (1313, 1191, 't29');
+INSERT INTO notes VALUES (1314, 1198, 't42');
+INSERT INTO notes VALUES (1315, 1205, 't55');
+INSERT INTO notes VALUES (1316, 1212, 't8');
+INSERT INTO notes VALUES (1317, 1219, 't21');
+INSERT INTO notes VALUES (1318, 1226, 't34');
+INSERT INTO notes VALUES (1319, 1233, 't47');
+INSERT INTO notes VALUES (1320, 1240, 't0');
+INSERT INTO notes VALUES (1321, 1247, 't13');
+INSERT INTO notes VALUES (1322, 1254, 't26');
+INSERT INTO notes VALUES (1323, 1261, 't39');
+INSERT INTO notes VALUES (1324, 1268, 't52');
+INSERT INTO notes VALUES (1325, 1275, 't5');
+INSERT INTO notes VALUES (1326, 1282, 't18');
+INSERT INTO notes VALUES (1327, 1289, 't31');
+INSERT INTO notes VALUES (1328, 1296, 't44');
+INSERT INTO notes VALUES (1329, 1303, 't57');
+INSERT INTO notes VALUES (1330, 1310, 't10');
+INSERT INTO notes VALUES (1331, 1317, 't23');
+INSERT INTO notes VALUES (1332, 1324, 't36');
+INSERT INTO notes VALUES (1333, 1331, 't49');
+INSERT INTO notes VALUES (1334, 1338, 't2');
+INSERT INTO notes VALUES (1335, 1345, 't15');
+INSERT INTO notes VALUES (1336, 1352, 't28');
+INSERT INTO notes VALUES (1337, 1359, 't41');
+INSERT INTO notes VALUES (1338, 1366, 't54');
+INSERT INTO notes VALUES (1339, 1373, 't7');
+INSERT INTO notes VALUES (1340, 1380, 't20');
+INSERT INTO notes VALUES (1341, 1387, 't33');
+INSERT INTO notes VALUES (1342, 1394, 't46');
+INSERT INTO notes VALUES (1343, 1401, 't59');
+INSERT INTO notes VALUES (1344, 1408, 't12');
+INSERT INTO notes VALUES (1345, 1415, 't25');
+INSERT INTO notes VALUES (1346, 1422, 't38');
+INSERT INTO notes VALUES (1347, 1429, 't51');
+INSERT INTO notes VALUES (1348, 1436, 't4');
+INSERT INTO notes VALUES (1349, 1443, 't17');
+INSERT INTO notes VALUES (1350, 1450, 't30');
+INSERT INTO notes VALUES (1351, 1457, 't43');
+INSERT INTO notes VALUES (1352, 1464, 't56');
+INSERT INTO notes VALUES (1353, 1471, 't9');
+INSERT INTO notes VALUES (1354, 1478, 't22');
+INSERT INTO notes VALUES (1355, 1485, 't35');
+INSERT INTO notes VALUES (1356, 1492, 't48');
+INSERT INTO notes VALUES (1357, 1499, 't1');
+INSERT INTO notes VALUES (1358, 1506, 't14');
+INSERT INTO notes VALUES (1359, 1513, 't27');
+INSERT INTO notes VALUES (1360, 1520, 't40');
+INSERT INTO notes VALUES (1361, 1527, 't53');
+INSERT INTO notes VALUES (1362, 1534, 't6');
+INSERT INTO notes VALUES (1363, 1541, 't19');
+INSERT INTO notes VALUES (1364, 1548, 't32');
+INSERT INTO notes VALUES (1365, 1555, 't45');
+INSERT INTO notes VALUES (1366, 1562, 't58');
+INSERT INTO notes VALUES (1367, 1569, 't11');
+INSERT INTO notes VALUES (1368, 1576, 't24');
+INSERT INTO notes VALUES (1369, 1583, 't37');
+INSERT INTO notes VALUES (1370, 1590, 't50');
+INSERT INTO notes VALUES (1371, 1597, 't3');
+INSERT INTO notes VALUES (1372, 1604, 't16');
+INSERT INTO notes VALUES (1373, 1611, 't29');
+INSERT INTO notes VALUES (1374, 1618, 't42');
+INSERT INTO notes VALUES (1375, 1625, 't55');
+INSERT INTO notes VALUES (1376, 1632, 't8');
+INSERT INTO notes VALUES (1377, 1639, 't21');
+INSERT INTO notes VALUES (1378, 1646, 't34');
+INSERT INTO notes VALUES (1379, 1653, 't47');
+INSERT INTO notes VALUES (1380, 1660, 't0');
+INSERT INTO notes VALUES (1381, 1667, 't13');
+INSERT INTO notes VALUES (1382, 1674, 't26');
+INSERT INTO notes VALUES (1383, 1681, 't39');
+INSERT INTO notes VALUES (1384, 1688, 't52');
+INSERT INTO notes VALUES (1385, 1695, 't5');
+INSERT INTO notes VALUES (1386, 1702, 't18');
+INSERT INTO notes VALUES (1387, 1709, 't31');
+INSERT INTO notes VALUES (1388, 1716, 't44');
+INSERT INTO notes VALUES (1389, 1723, 't57');
+INSERT INTO notes VALUES (1390, 1730, 't10');
+INSERT INTO notes VALUES (1391, 1737, 't23');
+INSERT INTO notes VALUES (1392, 1744, 't36');
+INSERT INTO notes VALUES (1393, 1751, 't49');
+INSERT INTO notes VALUES (1394, 1758, 't2');
+INSERT INTO notes VALUES (1395, 1765, 't15');
+INSERT INTO notes VALUES (1396, 1772, 't28');
+INSERT INTO notes VALUES (1397, 1779, 't41');
+INSERT INTO notes VALUES (1398, 1786, 't54');
+INSERT INTO notes VALUES (1399, 1793, 't7');
+INSERT INTO notes VALUES (1400, 1800, 't20');
+INSERT INTO notes VALUES (1401, 1807, 't33');
+INSERT INTO notes VALUES (1402, 1814, 't46');
+INSERT INTO notes VALUES (1403, 1821, 't59');
+INSERT INTO notes VALUES (1404, 1828, 't12');
+INSERT INTO notes VALUES (1405, 1835, 't25');
+INSERT INTO notes VALUES (1406, 1842, 't38');
+INSERT INTO notes VALUES (1407, 1849, 't51');
+INSERT INTO notes VALUES (1408, 1856, 't4');
+INSERT INTO notes VALUES (1409, 1863, 't17');
+INSERT INTO notes VALUES (1410, 1870, 't30');
+INSERT INTO notes VALUES (1411, 1877, 't43');
+INSERT INTO notes VALUES (1412, 1884, 't56');
+INSERT INTO notes VALUES (1413, 1891, 't9');
+INSERT INTO notes VALUES (1414, 1898, 't22');
+INSERT INTO notes VALUES (1415, 1905, 't35');
+INSERT INTO notes VALUES (1416, 1912, 't48');
+INSERT INTO notes VALUES (1417, 1919, 't1');
+INSERT INTO notes VALUES (1418, 1926, 't14');
+INSERT INTO notes VALUES (1419, 1933, 't27');
+INSERT INTO notes VALUES (1420, 1940, 't40');
+INSERT INTO notes VALUES (1421, 1947, 't53');
+INSERT INTO notes VALUES (1422, 1954, 't6');
+INSERT INTO notes VALUES (1423, 1961, 't19');
+INSERT INTO notes VALUES (1424, 1968, 't32');
+INSERT INTO notes VALUES (1425, 1975, 't45');
+INSERT INTO notes VALUES (1426, 1982, 't58');
+INSERT INTO notes VALUES (1427, 1989, 't11');
+INSERT INTO notes VALUES (1428, 1996, 't24');
+INSERT INTO notes VALUES (1429, 3, 't37');
+INSERT INTO notes VALUES (1430, 10, 't50');
+INSERT INTO notes VALUES (1431, 17, 't3');
+INSERT INTO notes VALUES (1432, 24, 't16');
+INSERT INTO notes VALUES (1433, 31, 't29');
+INSERT INTO notes VALUES (1434, 38, 't42');
+INSERT INTO notes VALUES (1435, 45, 't55');
+INSERT INTO notes VALUES (1436, 52, 't8');
+INSERT INTO notes VALUES (1437, 59, 't21');
+INSERT INTO notes VALUES (1438, 66, 't34');
+INSERT INTO notes VALUES (1439, 73, 't47');
+INSERT INTO notes VALUES (1440, 80, 't0');
+INSERT INTO notes VALUES (1441, 87, 't13');
+INSERT INTO notes VALUES (1442, 94, 't26');
+INSERT INTO notes VALUES (1443, 101, 't39');
+INSERT INTO notes VALUES (1444, 108, 't52');
+INSERT INTO notes VALUES (1445, 115, 't5');
+INSERT INTO notes VALUES (1446, 122, 't18');
+INSERT INTO notes VALUES (1447, 129, 't31');
+INSERT INTO notes VALUES (1448, 136, 't44');
+INSERT INTO notes VALUES (1449, 143, 't57');
+INSERT INTO notes VALUES (1450, 150, 't10');
+INSERT INTO notes VALUES (1451, 157, 't23');
+INSERT INTO notes VALUES (1452, 164, 't36');
+INSERT INTO notes VALUES (1453, 171, 't49');
+INSERT INTO notes VALUES (1454, 178, 't2');
+INSERT INTO notes VALUES (1455, 185, 't15');
+INSERT INTO notes VALUES (1456, 192, 't28');
+INSERT INTO notes VALUES (1457, 199, 't41');
+INSERT INTO notes VALUES (1458, 206, 't54');
+INSERT INTO notes VALUES (1459, 213, 't7');
+INSERT INTO notes VALUES (1460, 220, 't20');
+INSERT INTO notes VALUES (1461, 227, 't33');
+INSERT INTO notes VALUES (1462, 234, 't46');
+INSERT INTO notes VALUES (1463, 241, 't59');
+INSERT INTO notes VALUES (1464, 248, 't12');
+INSERT INTO notes VALUES (1465, 255, 't25');
+INSERT INTO notes VALUES (1466, 262, 't38');
+INSERT INTO notes VALUES (1467, 269, 't51');
+INSERT INTO notes VALUES (1468, 276, 't4');
+INSERT INTO notes VALUES (1469, 283, 't17');
+INSERT INTO notes VALUES (1470, 290, 't30');
+INSERT INTO notes VALUES (1471, 297, 't43');
+INSERT INTO notes VALUES (1472, 304, 't56');
+INSERT INTO notes VALUES (1473, 311, 't9');
+INSERT INTO notes VALUES (1474, 318, 't22');
+INSERT INTO notes VALUES (1475, 325, 't35');
+INSERT INTO notes VALUES (1476, 332, 't48');
+INSERT INTO notes VALUES (1477, 339, 't1');
+INSERT INTO notes VALUES (1478, 346, 't14');
+INSERT INTO notes VALUES (1479, 353, 't27');
+INSERT INTO notes VALUES (1480, 360, 't40');
+INSERT INTO notes VALUES (1481, 367, 't53');
+INSERT INTO notes VALUES (1482, 374, 't6');
+INSERT INTO notes VALUES (1483, 381, 't19');
+INSERT INTO notes VALUES (1484, 388, 't32');
+INSERT INTO notes VALUES (1485, 395, 't45');
+INSERT INTO notes VALUES (1486, 402, 't58');
+INSERT INTO notes VALUES (1487, 409, 't11');
+INSERT INTO notes VALUES (1488, 416, 't24');
+INSERT INTO notes VALUES (1489, 423, 't37');
+INSERT INTO notes VALUES (1490, 430, 't50');
+INSERT INTO notes VALUES (1491, 437, 't3');
+INSERT INTO notes VALUES (1492, 444, 't16');
+INSERT INTO notes VALUES (1493, 451, 't29');
+INSERT INTO notes VALUES (1494, 458, 't42');
+INSERT INTO notes VALUES (1495, 465, 't55');
+INSERT INTO notes VALUES (1496, 472, 't8');
+INSERT INTO notes VALUES (1497, 479, 't21');
+INSERT INTO notes VALUES (1498, 486, 't34');
+INSERT INTO notes VALUES (1499, 493, 't47');
+INSERT INTO notes VALUES (1500, 500, 't0');
+INSERT INTO notes VALUES (1501, 507, 't13');
+INSERT INTO notes VALUES (1502, 514, 't26');
+INSERT INTO notes VALUES (1503, 521, 't39');
+INSERT INTO notes VALUES (1504, 528, 't52');
+INSERT INTO notes VALUES (1505, 535, 't5');
+INSERT INTO notes VALUES (1506, 542, 't18');
+INSERT INTO notes VALUES (1507, 549, 't31');
+INSERT INTO notes VALUES (1508, 556, 't44');
+INSERT INTO notes VALUES (1509, 563, 't57');
+INSERT INTO notes VALUES (1510, 570, 't10');
+INSERT INTO notes VALUES (1511, 577, 't23');
+INSERT INTO notes VALUES (1512, 584, 't36');
+INSERT INTO notes VALUES (1513, 591, 't49');
+INSERT INTO notes VALUES (1514, 598, 't2');
+INSERT INTO notes VALUES (1515, 605, 't15');
+INSERT INTO notes VALUES (1516, 612, 't28');
+INSERT INTO notes VALUES (1517, 619, 't41');
+INSERT INTO notes VALUES (1518, 626, 't54');
+INSERT INTO notes VALUES (1519, 633, 't7');
+INSERT INTO notes VALUES (1520, 640, 't20');
+INSERT INTO notes VALUES (1521, 647, 't33');
+INSERT INTO notes VALUES (1522, 654, 't46');
+INSERT INTO notes VALUES (1523, 661, 't59');
+INSERT INTO notes VALUES (1524, 668, 't12');
+INSERT INTO notes VALUES (1525, 675, 't25');
+INSERT INTO notes VALUES (1526, 682, 't38');
+INSERT INTO notes VALUES (1527, 689, 't51');
+INSERT INTO notes VALUES (1528, 696, 't4');
+INSERT INTO notes VALUES (1529, 703, 't17');
+INSERT INTO notes VALUES (1530, 710, 't30');
+INSERT INTO notes VALUES (1531, 717, 't43');
+INSERT INTO notes VALUES (1532, 724, 't56');
+INSERT INTO notes VALUES (1533, 731, 't9');
+INSERT INTO notes VALUES (1534, 738, 't22');
+INSERT INTO notes VALUES (1535, 745, 't35');
+INSERT INTO notes VALUES (1536, 752, 't48');
+INSERT INTO notes VALUES (1537, 759, 't1');
+INSERT INTO notes VALUES (1538, 766, 't14');
+INSERT INTO notes VALUES (1539, 773, 't27');
+INSERT INTO notes VALUES (1540, 780, 't40');
+INSERT INTO notes VALUES (1541, 787, 't53');
+INSERT INTO notes VALUES (1542, 794, 't6');
+INSERT INTO notes VALUES (1543, 801, 't19');
+INSERT INTO notes VALUES (1544, 808, 't32');
+INSERT INTO notes VALUES (1545, 815, 't45');
+INSERT INTO notes VALUES (1546, 822, 't58');
+INSERT INTO notes VALUES (1547, 829, 't11');
+INSERT INTO notes VALUES (1548, 836, 't24');
+INSERT INTO notes VALUES (1549, 843, 't37');
+INSERT INTO notes VALUES (1550, 850, 't50');
+INSERT INTO notes VALUES (1551, 857, 't3');
+INSERT INTO notes VALUES (1552, 864, 't16');
+INSERT INTO notes VALUES (1553, 871, 't29');
+INSERT INTO notes VALUES (1554, 878, 't42');
+INSERT INTO notes VALUES (1555, 885, 't55');
+INSERT INTO notes VALUES (1556, 892, 't8');
+INSERT INTO notes VALUES (1557, 899, 't21');
+INSERT INTO notes VALUES (1558, 906, 't34');
+INSERT INTO notes VALUES (1559, 913, 't47');
+INSERT INTO notes VALUES (1560, 920, 't0');
+INSERT INTO notes VALUES (1561, 927, 't13');
+INSERT INTO notes VALUES (1562, 934, 't26');
+INSERT INTO notes VALUES (1563, 941, 't39');
+INSERT INTO notes VALUES (1564, 948, 't52');
+INSERT INTO notes VALUES (1565, 955, 't5');
+INSERT INTO notes VALUES (1566, 962, 't18');
+INSERT INTO notes VALUES (1567, 969, 't31');
+INSERT INTO notes VALUES (1568, 976, 't44');
+INSERT INTO notes VALUES (1569, 983, 't57');
+INSERT INTO notes VALUES (1570, 990, 't10');
+INSERT INTO notes VALUES (1571, 997, 't23');
+INSERT INTO notes VALUES (1572, 1004, 't36');
+INSERT INTO notes VALUES (1573, 1011, 't49');
+INSERT INTO notes VALUES (1574, 1018, 't2');
+INSERT INTO notes VALUES (1575, 1025, 't15');
+INSERT INTO notes VALUES (1576, 1032, 't28');
+INSERT INTO notes VALUES (1577, 1039, 't41');
+INSERT INTO notes VALUES (1578, 1046, 't54');
+INSERT INTO notes VALUES (1579, 1053, 't7');
+INSERT INTO notes VALUES (1580, 1060, 't20');
+INSERT INTO notes VALUES (1581, 1067, 't33');
+INSERT INTO notes VALUES (1582, 1074, 't46');
+INSERT INTO notes VALUES (1583, 1081, 't59');
+INSERT INTO notes VALUES (1584, 1088, 't12');
+INSERT INTO notes VALUES (1585, 1095, 't25');
+INSERT INTO notes VALUES (1586, 1102, 't38');
+INSERT INTO notes VALUES (1587, 1109, 't51');
+INSERT INTO notes VALUES (1588, 1116, 't4');
+INSERT INTO notes VALUES (1589, 1123, 't17');
+INSERT INTO notes VALUES (1590, 1130, 't30');
+INSERT INTO notes VALUES (1591, 1137, 't43');
+INSERT INTO notes VALUES (1592, 1144, 't56');
+INSERT INTO notes VALUES (1593, 1151, 't9');
+INSERT INTO notes VALUES (1594, 1158, 't22');
+INSERT INTO notes VALUES (1595, 1165, 't35');
+INSERT INTO notes VALUES (1596, 1172, 't48');
+INSERT INTO notes VALUES (1597, 1179, 't1');
+INSERT INTO notes VALUES (1598, 1186, 't14');
+INSERT INTO notes VALUES (1599, 1193, 't27');
+INSERT INTO notes VALUES (1600, 1200, 't40');
+INSERT INTO notes VALUES (1601, 1207, 't53');
+INSERT INTO notes VALUES (1602, 1214, 't6');
+INSERT INTO notes VALUES (1603, 1221, 't19');
+INSERT INTO notes VALUES (1604, 1228, 't32');
+INSERT INTO notes VALUES (1605, 1235, 't45');
+INSERT INTO notes VALUES (1606, 1242, 't58');
+INSERT INTO notes VALUES (1607, 1249, 't11');
+INSERT INTO notes VALUES (1608, 1256, 't24');
+INSERT INTO notes VALUES (1609, 1263, 't37');
+INSERT INTO notes VALUES (1610, 1270, 't50');
+INSERT INTO notes VALUES (1611, 1277, 't3');
+INSERT INTO notes VALUES (1612, 1284, 't16');
+INSERT INTO notes VALUES (1613, 1291, 't29');
+INSERT INTO notes VALUES (1614, 1298, 't42');
+INSERT INTO notes VALUES (1615, 1305, 't55');
+INSERT INTO notes VALUES (1616, 1312, 't8');
+INSERT INTO notes VALUES (1617, 1319, 't21');
+INSERT INTO notes VALUES (1618, 1326, 't34');
+INSERT INTO notes VALUES (1619, 1333, 't47');
+INSERT INTO notes VALUES (1620, 1340, 't0');
+INSERT INTO notes VALUES (1621, 1347, 't13');
+INSERT INTO notes VALUES (1622, 1354, 't26');
+INSERT INTO notes VALUES (1623, 1361, 't39');
+INSERT INTO notes VALUES (1624, 1368, 't52');
+INSERT INTO notes VALUES (1625, 1375, 't5');
+INSERT INTO notes VALUES (1626, 1382, 't18');
+INSERT INTO notes VALUES (1627, 1389, 't31');
+INSERT INTO notes VALUES (1628, 1396, 't44');
+INSERT INTO notes VALUES (1629, 1403, 't57');
+INSERT INTO notes VALUES (1630, 1410, 't10');
+INSERT INTO notes VALUES (1631, 1417, 't23');
+INSERT INTO notes VALUES (1632, 1424, 't36');
+INSERT INTO notes VALUES (1633, 1431, 't49');
+INSERT INTO notes VALUES (1634, 1438, 't2');
+INSERT INTO notes VALUES (1635, 1445, 't15');
+INSERT INTO notes VALUES (1636, 1452, 't28');
+INSERT INTO notes VALUES (1637, 1459, 't41');
+INSERT INTO notes VALUES (1638, 1466, 't54');
+INSERT INTO notes VALUES (1639, 1473, 't7');
+INSERT INTO notes VALUES (1640, 1480, 't20');
+INSERT INTO notes VALUES (1641, 1487, 't33');
+INSERT INTO notes VALUES (1642, 1494, 't46');
+INSERT INTO notes VALUES (1643, 1501, 't59');
+INSERT INTO notes VALUES (1644, 1508, 't12');
+INSERT INTO notes VALUES (1645, 1515, 't25');
+INSERT INTO notes VALUES (1646, 1522, 't38');
+INSERT INTO notes VALUES (1647, 1529, 't51');
+INSERT INTO notes VALUES (1648, 1536, 't4');
+INSERT INTO notes VALUES (1649, 1543, 't17');
+INSERT INTO notes VALUES (1650, 1550, 't30');
+INSERT INTO notes VALUES (1651, 1557, 't43');
+INSERT INTO notes VALUES (1652, 1564, 't56');
+INSERT INTO notes VALUES (1653, 1571, 't9');
+INSERT INTO notes VALUES (1654, 1578, 't22');
+INSERT INTO notes VALUES (1655, 1585, 't35');
+INSERT INTO notes VALUES (1656, 1592, 't48');
+INSERT INTO notes VALUES (1657, 1599, 't1');
+INSERT INTO notes VALUES (1658, 1606, 't14');
+INSERT INTO notes VALUES (1659, 1613, 't27');
+INSERT INTO notes VALUES (1660, 1620, 't40');
+INSERT INTO notes VALUES (1661, 1627, 't53');
+INSERT INTO notes VALUES (1662, 1634, 't6');
+INSERT INTO notes VALUES (1663, 1641, 't19');
+INSERT INTO notes VALUES (1664, 1648, 't32');
+INSERT INTO notes VALUES (1665, 1655, 't45');
+INSERT INTO notes VALUES (1666, 1662, 't58');
+INSERT INTO notes VALUES (1667, 1669, 't11');
+INSERT INTO notes VALUES (1668, 1676, 't24');
+INSERT INTO notes VALUES (1669, 1683, 't37');
+INSERT INTO notes VALUES (1670, 1690, 't50');
+INSERT INTO notes VALUES (1671, 1697, 't3');
+INSERT INTO notes VALUES (1672, 1704, 't16');
+INSERT INTO notes VALUES (1673, 1711, 't29');
+INSERT INTO notes VALUES (1674, 1718, 't42');
+INSERT INTO notes VALUES (1675, 1725, 't55');
+INSERT INTO notes VALUES (1676, 1732, 't8');
+INSERT INTO notes VALUES (1677, 1739, 't21');
+INSERT INTO notes VALUES (1678, 1746, 't34');
+INSERT INTO notes VALUES (1679, 1753, 't47');
+INSERT INTO notes VALUES (1680, 1760, 't0');
+INSERT INTO notes VALUES (1681, 1767, 't13');
+INSERT INTO notes VALUES (1682, 1774, 't26');
+INSERT INTO notes VALUES (1683, 1781, 't39');
+INSERT INTO notes VALUES (1684, 1788, 't52');
+INSERT INTO notes VALUES (1685, 1795, 't5');
+INSERT INTO notes VALUES (1686, 1802, 't18');
+INSERT INTO notes VALUES (1687, 1809, 't31');
+INSERT INTO notes VALUES (1688, 1816, 't44');
+INSERT INTO notes VALUES (1689, 1823, 't57');
+INSERT INTO notes VALUES (1690, 1830, 't10');
+INSERT INTO notes VALUES (1691, 1837, 't23');
+INSERT INTO notes VALUES (1692, 1844, 't36');
+INSERT INTO notes VALUES (1693, 1851, 't49');
+INSERT INTO notes VALUES (1694, 1858, 't2');
+INSERT INTO notes VALUES (1695, 1865, 't15');
+INSERT INTO notes VALUES (1696, 1872, 't28');
+INSERT INTO notes VALUES (1697, 1879, 't41');
+INSERT INTO notes VALUES (1698, 1886, 't54');
+INSERT INTO notes VALUES (1699, 1893, 't7');
+INSERT INTO notes VALUES (1700, 1900, 't20');
+INSERT INTO notes VALUES (1701, 1907, 't33');
+INSERT INTO notes VALUES (1702, 1914, 't46');
+INSERT INTO notes VALUES (1703, 1921, 't59');
+INSERT INTO notes VALUES (1704, 1928, 't12');
+INSERT INTO notes VALUES (1705, 1935, 't25');
+INSERT INTO notes VALUES (1706, 1942, 't38');
+INSERT INTO notes VALUES (1707, 1949, 't51');
+INSERT INTO notes VALUES (1708, 1956, 't4');
+INSERT INTO notes VALUES (1709, 1963, 't17');
+INSERT INTO notes VALUES (1710, 1970, 't30');
+INSERT INTO notes VALUES (1711, 1977, 't43');
+INSERT INTO notes VALUES (1712, 1984, 't56');
+INSERT INTO notes VALUES (1713, 1991, 't9');
+INSERT INTO notes VALUES (1714, 1998, 't22');
+INSERT INTO notes VALUES (1715, 5, 't35');
+INSERT INTO notes VALUES (1716, 12, 't48');
+INSERT INTO notes VALUES (1717, 19, 't1');
+INSERT INTO notes VALUES (1718, 26, 't14');
+INSERT INTO notes VALUES (1719, 33, 't27');
+INSERT INTO notes VALUES (1720, 40, 't40');
+INSERT INTO notes VALUES (1721, 47, 't53');
+INSERT INTO notes VALUES (1722, 54, 't6');
+INSERT INTO notes VALUES (1723, 61, 't19');
+INSERT INTO notes VALUES (1724, 68, 't32');
+INSERT INTO notes VALUES (1725, 75, 't45');
+INSERT INTO notes VALUES (1726, 82, 't58');
+INSERT INTO notes VALUES (1727, 89, 't11');
+INSERT INTO notes VALUES (1728, 96, 't24');
+INSERT INTO notes VALUES (1729, 103, 't37');
+INSERT INTO notes VALUES (1730, 110, 't50');
+INSERT INTO notes VALUES (1731, 117, 't3');
+INSERT INTO notes VALUES (1732, 124, 't16');
+INSERT INTO notes VALUES (1733, 131, 't29');
+INSERT INTO notes VALUES (1734, 138, 't42');
+INSERT INTO notes VALUES (1735, 145, 't55');
+INSERT INTO notes VALUES (1736, 152, 't8');
+INSERT INTO notes VALUES (1737, 159, 't21');
+INSERT INTO notes VALUES (1738, 166, 't34');
+INSERT INTO notes VALUES (1739, 173, 't47');
+INSERT INTO notes VALUES (1740, 180, 't0');
+INSERT INTO notes VALUES (1741, 187, 't13');
+INSERT INTO notes VALUES (1742, 194, 't26');
+INSERT INTO notes VALUES (1743, 201, 't39');
+INSERT INTO notes VALUES (1744, 208, 't52');
+INSERT INTO notes VALUES (1745, 215, 't5');
+INSERT INTO notes VALUES (1746, 222, 't18');
+INSERT INTO notes VALUES (1747, 229, 't31');
+INSERT INTO notes VALUES (1748, 236, 't44');
+INSERT INTO notes VALUES (1749, 243, 't57');
+INSERT INTO notes VALUES (1750, 250, 't10');
+INSERT INTO notes VALUES (1751, 257, 't23');
+INSERT INTO notes VALUES (1752, 264, 't36');
+INSERT INTO notes VALUES (1753, 271, 't49');
+INSERT INTO notes VALUES (1754, 278, 't2');
+INSERT INTO notes VALUES (1755, 285, 't15');
+INSERT INTO notes VALUES (1756, 292, 't28');
+INSERT INTO notes VALUES (1757, 299, 't41');
+INSERT INTO notes VALUES (1758, 306, 't54');
+INSERT INTO notes VALUES (1759, 313, 't7');
+INSERT INTO notes VALUES (1760, 320, 't20');
+INSERT INTO notes VALUES (1761, 327, 't33');
+INSERT INTO notes VALUES (1762, 334, 't46');
+INSERT INTO notes VALUES (1763, 341, 't59');
+INSERT INTO notes VALUES (1764, 348, 't12');
+INSERT INTO notes VALUES (1765, 355, 't25');
+INSERT INTO notes VALUES (1766, 362, 't38');
+INSERT INTO notes VALUES (1767, 369, 't51');
+INSERT INTO notes VALUES (1768, 376, 't4');
+INSERT INTO notes VALUES (1769, 383, 't17');
+INSERT INTO notes VALUES (1770, 390, 't30');
+INSERT INTO notes VALUES (1771, 397, 't43');
+INSERT INTO notes VALUES (1772, 404, 't56');
+INSERT INTO notes VALUES (1773, 411, 't9');
+INSERT INTO notes VALUES (1774, 418, 't22');
+INSERT INTO notes VALUES (1775, 425, 't35');
+INSERT INTO notes VALUES (1776, 432, 't48');
+INSERT INTO notes VALUES (1777, 439, 't1');
+INSERT INTO notes VALUES (1778, 446, 't14');
+INSERT INTO notes VALUES (1779, 453, 't27');
+INSERT INTO notes VALUES (1780, 460, 't40');
+INSERT INTO notes VALUES (1781, 467, 't53');
+INSERT INTO notes VALUES (1782, 474, 't6');
+INSERT INTO notes VALUES (1783, 481, 't19');
+INSERT INTO notes VALUES (1784, 488, 't32');
+INSERT INTO notes VALUES (1785, 495, 't45');
+INSERT INTO notes VALUES (1786, 502, 't58');
+INSERT INTO notes VALUES (1787, 509, 't11');
+INSERT INTO notes VALUES (1788, 516, 't24');
+INSERT INTO notes VALUES (1789, 523, 't37');
+INSERT INTO notes VALUES (1790, 530, 't50');
+INSERT INTO notes VALUES (1791, 537, 't3');
+INSERT INTO notes VALUES (1792, 544, 't16');
+INSERT INTO notes VALUES (1793, 551, 't29');
+INSERT INTO notes VALUES (1794, 558, 't42');
+INSERT INTO notes VALUES (1795, 565, 't55');
+INSERT INTO notes VALUES (1796, 572, 't8');
+INSERT INTO notes VALUES (1797, 579, 't21');
+INSERT INTO notes VALUES (1798, 586, 't34');
+INSERT INTO notes VALUES (1799, 593, 't47');
+INSERT INTO notes VALUES (1800, 600, 't0');
+INSERT INTO notes VALUES (1801, 607, 't13');
+INSERT INTO notes VALUES (1802, 614, 't26');
+INSERT INTO notes VALUES (1803, 621, 't39');
+INSERT INTO notes VALUES (1804, 628, 't52');
+INSERT INTO notes VALUES (1805, 635, 't5');
+INSERT INTO notes VALUES (1806, 642, 't18');
+INSERT INTO notes VALUES (1807, 649, 't31');
+INSERT INTO notes VALUES (1808, 656, 't44');
+INSERT INTO notes VALUES (1809, 663, 't57');
+INSERT INTO notes VALUES (1810, 670, 't10');
+INSERT INTO notes VALUES (1811, 677, 't23');
+INSERT INTO notes VALUES (1812, 684, 't36');
+INSERT INTO notes VALUES (1813, 691, 't49');
+INSERT INTO notes VALUES (1814, 698, 't2');
+INSERT INTO notes VALUES (1815, 705, 't15');
+INSERT INTO notes VALUES (1816, 712, 't28');
+INSERT INTO notes VALUES (1817, 719, 't41');
+INSERT INTO notes VALUES (1818, 726, 't54');
+INSERT INTO notes VALUES (1819, 733, 't7');
+INSERT INTO notes VALUES (1820, 740, 't20');
+INSERT INTO notes VALUES (1821, 747, 't33');
+INSERT INTO notes VALUES (1822, 754, 't46');
+INSERT INTO notes VALUES (1823, 761, 't59');
+INSERT INTO notes VALUES (1824, 768, 't12');
+INSERT INTO notes VALUES (1825, 775, 't25');
+INSERT INTO notes VALUES (1826, 782, 't38');
+INSERT INTO notes VALUES (1827, 789, 't51');
+INSERT INTO notes VALUES (1828, 796, 't4');
+INSERT INTO notes VALUES (1829, 803, 't17');
+INSERT INTO notes VALUES (1830, 810, 't30');
+INSERT INTO notes VALUES (1831, 817, 't43');
+INSERT INTO notes VALUES (1832, 824, 't56');
+INSERT INTO notes VALUES (1833, 831, 't9');
+INSERT INTO notes VALUES (1834, 838, 't22');
+INSERT INTO notes VALUES (1835, 845, 't35');
+INSERT INTO notes VALUES (1836, 852, 't48');
+INSERT INTO notes VALUES (1837, 859, 't1');
+INSERT INTO notes VALUES (1838, 866, 't14');
+INSERT INTO notes VALUES (1839, 873, 't27');
+INSERT INTO notes VALUES (1840, 880, 't40');
+INSERT INTO notes VALUES (1841, 887, 't53');
+INSERT INTO notes VALUES (1842, 894, 't6');
+INSERT INTO notes VALUES (1843, 901, 't19');
+INSERT INTO notes VALUES (1844, 908, 't32');
+INSERT INTO notes VALUES (1845, 915, 't45');
+INSERT INTO notes VALUES (1846, 922, 't58');
+INSERT INTO notes VALUES (1847, 929, 't11');
+INSERT INTO notes VALUES (1848, 936, 't24');
+INSERT INTO notes VALUES (1849, 943, 't37');
+INSERT INTO notes VALUES (1850, 950, 't50');
+INSERT INTO notes VALUES (1851, 957, 't3');
+INSERT INTO notes VALUES (1852, 964, 't16');
+INSERT INTO notes VALUES (1853, 971, 't29');
+INSERT INTO notes VALUES (1854, 978, 't42');
+INSERT INTO notes VALUES (1855, 985, 't55');
+INSERT INTO notes VALUES (1856, 992, 't8');
+INSERT INTO notes VALUES (1857, 999, 't21');
+INSERT INTO notes VALUES (1858, 1006, 't34');
+INSERT INTO notes VALUES (1859, 1013, 't47');
+INSERT INTO notes VALUES (1860, 1020, 't0');
+INSERT INTO notes VALUES (1861, 1027, 't13');
+INSERT INTO notes VALUES (1862, 1034, 't26');
+INSERT INTO notes VALUES (1863, 1041, 't39');
+INSERT INTO notes VALUES (1864, 1048, 't52');
+INSERT INTO notes VALUES (1865, 1055, 't5');
+INSERT INTO notes VALUES (1866, 1062, 't18');
+INSERT INTO notes VALUES (1867, 1069, 't31');
+INSERT INTO notes VALUES (1868, 1076, 't44');
+INSERT INTO notes VALUES (1869, 1083, 't57');
+INSERT INTO notes VALUES (1870, 1090, 't10');
+INSERT INTO notes VALUES (1871, 1097, 't23');
+INSERT INTO notes VALUES (1872, 1104, 't36');
+INSERT INTO notes VALUES (1873, 1111, 't49');
+INSERT INTO notes VALUES (1874, 1118, 't2');
+INSERT INTO notes VALUES (1875, 1125, 't15');
+INSERT INTO notes VALUES (1876, 1132, 't28');
+INSERT INTO notes VALUES (1877, 1139, 't41');
+INSERT INTO notes VALUES (1878, 1146, 't54');
+INSERT INTO notes VALUES (1879, 1153, 't7');
+INSERT INTO notes VALUES (1880, 1160, 't20');
+INSERT INTO notes VALUES (1881, 1167, 't33');
+INSERT INTO notes VALUES (1882, 1174, 't46');
+INSERT INTO notes VALUES (1883, 1181, 't59');
+INSERT INTO notes VALUES (1884, 1188, 't12');
+INSERT INTO notes VALUES (1885, 1195, 't25');
+INSERT INTO notes VALUES (1886, 1202, 't38');
+INSERT INTO notes VALUES (1887, 1209, 't51');
+INSERT INTO notes VALUES (1888, 1216, 't4');
+INSERT INTO notes VALUES (1889, 1223, 't17');
+INSERT INTO notes VALUES (1890, 1230, 't30');
+INSERT INTO notes VALUES (1891, 1237, 't43');
+INSERT INTO notes VALUES (1892, 1244, 't56');
+INSERT INTO notes VALUES (1893, 1251, 't9');
+INSERT INTO notes VALUES (1894, 1258, 't22');
+INSERT INTO notes VALUES (1895, 1265, 't35');
+INSERT INTO notes VALUES (1896, 1272, 't48');
+INSERT INTO notes VALUES (1897, 1279, 't1');
+INSERT INTO notes VALUES (1898, 1286, 't14');
+INSERT INTO notes VALUES (1899, 1293, 't27');
+INSERT INTO notes VALUES (1900, 1300, 't40');
+INSERT INTO notes VALUES (1901, 1307, 't53');
+INSERT INTO notes VALUES (1902, 1314, 't6');
+INSERT INTO notes VALUES (1903, 1321, 't19');
+INSERT INTO notes VALUES (1904, 1328, 't32');
+INSERT INTO notes VALUES (1905, 1335, 't45');
+INSERT INTO notes VALUES (1906, 1342, 't58');
+INSERT INTO notes VALUES (1907, 1349, 't11');
+INSERT INTO notes VALUES (1908, 1356, 't24');
+INSERT INTO notes VALUES (1909, 1363, 't37');
+INSERT INTO notes VALUES (1910, 1370, 't50');
+INSERT INTO notes VALUES (1911, 1377, 't3');
+INSERT INTO notes VALUES (1912, 1384, 't16');
+INSERT INTO notes VALUES (1913, 1391, 't29');
+INSERT INTO notes VALUES (1914, 1398, 't42');
+INSERT INTO notes VALUES (1915, 1405, 't55');
+INSERT INTO notes VALUES (1916, 1412, 't8');
+INSERT INTO notes VALUES (1917, 1419, 't21');
+INSERT INTO notes VALUES (1918, 1426, 't34');
+INSERT INTO notes VALUES (1919, 1433, 't47');
+INSERT INTO notes VALUES (1920, 1440, 't0');
+INSERT INTO notes VALUES (1921, 1447, 't13');
+INSERT INTO notes VALUES (1922, 1454, 't26');
+INSERT INTO notes VALUES (1923, 1461, 't39');
+INSERT INTO notes VALUES (1924, 1468, 't52');
+INSERT INTO notes VALUES (1925, 1475, 't5');
+INSERT INTO notes VALUES (1926, 1482, 't18');
+INSERT INTO notes VALUES (1927, 1489, 't31');
+INSERT INTO notes VALUES (1928, 1496, 't44');
+INSERT INTO notes VALUES (1929, 1503, 't57');
+INSERT INTO notes VALUES (1930, 1510, 't10');
+INSERT INTO notes VALUES (1931, 1517, 't23');
+INSERT INTO notes VALUES (1932, 1524, 't36');
+INSERT INTO notes VALUES (1933, 1531, 't49');
+INSERT INTO notes VALUES (1934, 1538, 't2');
+INSERT INTO notes VALUES (1935, 1545, 't15');
+INSERT INTO notes VALUES (1936, 1552, 't28');
+INSERT INTO notes VALUES (1937, 1559, 't41');
+INSERT INTO notes VALUES (1938, 1566, 't54');
+INSERT INTO notes VALUES (1939, 1573, 't7');
+INSERT INTO notes VALUES (1940, 1580, 't20');
+INSERT INTO notes VALUES (1941, 1587, 't33');
+INSERT INTO notes VALUES (1942, 1594, 't46');
+INSERT INTO notes VALUES (1943, 1601, 't59');
+INSERT INTO notes VALUES (1944, 1608, 't12');
+INSERT INTO notes VALUES (1945, 1615, 't25');
+INSERT INTO notes VALUES (1946, 1622, 't38');
+INSERT INTO notes VALUES (1947, 1629, 't51');
+INSERT INTO notes VALUES (1948, 1636, 't4');
+INSERT INTO notes VALUES (1949, 1643, 't17');
+INSERT INTO notes VALUES (1950, 1650, 't30');
+INSERT INTO notes VALUES (1951, 1657, 't43');
+INSERT INTO notes VALUES (1952, 1664, 't56');
+INSERT INTO notes VALUES (1953, 1671, 't9');
+INSERT INTO notes VALUES (1954, 1678, 't22');
+INSERT INTO notes VALUES (1955, 1685, 't35');
+INSERT INTO notes VALUES (1956, 1692, 't48');
+INSERT INTO notes VALUES (1957, 1699, 't1');
+INSERT INTO notes VALUES (1958, 1706, 't14');
+INSERT INTO notes VALUES (1959, 1713, 't27');
+INSERT INTO notes VALUES (1960, 1720, 't40');
+INSERT INTO notes VALUES (1961, 1727, 't53');
+INSERT INTO notes VALUES (1962, 1734, 't6');
+INSERT INTO notes VALUES (1963, 1741, 't19');
+INSERT INTO notes VALUES (1964, 1748, 't32');
+INSERT INTO notes VALUES (1965, 1755, 't45');
+INSERT INTO notes VALUES (1966, 1762, 't58');
+INSERT INTO notes VALUES (1967, 1769, 't11');
+INSERT INTO notes VALUES (1968, 1776, 't24');
+INSERT INTO notes VALUES (1969, 1783, 't37');
+INSERT INTO notes VALUES (1970, 1790, 't50');
+INSERT INTO notes VALUES (1971, 1797, 't3');
+INSERT INTO notes VALUES (1972, 1804, 't16');
+INSERT INTO notes VALUES (1973, 1811, 't29');
+INSERT INTO notes VALUES (1974, 1818, 't42');
+INSERT INTO notes VALUES (1975, 1825, 't55');
+INSERT INTO notes VALUES (1976, 1832, 't8');
+INSERT INTO notes VALUES (1977, 1839, 't21');
+INSERT INTO notes VALUES (1978, 1846, 't34');
+INSERT INTO notes VALUES (1979, 1853, 't47');
+INSERT INTO notes VALUES (1980, 1860, 't0');
+INSERT INTO notes VALUES (1981, 1867, 't13');
+INSERT INTO notes VALUES (1982, 1874, 't26');
+INSERT INTO notes VALUES (1983, 1881, 't39');
+INSERT INTO notes VALUES (1984, 1888, 't52');
+INSERT INTO notes VALUES (1985, 1895, 't5');
+INSERT INTO notes VALUES (1986, 1902, 't18');
+INSERT INTO notes VALUES (1987, 1909, 't31');
+INSERT INTO notes VALUES (1988, 1916, 't44');
+INSERT INTO notes VALUES (1989, 1923, 't57');
+INSERT INTO notes VALUES (1990, 1930, 't10');
+INSERT INTO notes VALUES (1991, 1937, 't23');
+INSERT INTO notes VALUES (1992, 1944, 't36');
+INSERT INTO notes VALUES (1993, 1951, 't49');
+INSERT INTO notes VALUES (1994, 1958, 't2');
+INSERT INTO notes VALUES (1995, 1965, 't15');
+INSERT INTO notes VALUES (1996, 1972, 't28');
+INSERT INTO notes VALUES (1997, 1979, 't41');
+INSERT INTO notes VALUES (1998, 1986, 't54');
+INSERT INTO notes VALUES (1999, 1993, 't7');
+INSERT INTO notes VALUES (2000, 0, 't20');
+INSERT INTO notes VALUES (2001, 7, 't33');
+INSERT INTO notes VALUES (2002, 14, 't46');
+INSERT INTO notes VALUES (2003, 21, 't59');
+INSERT INTO notes VALUES (2004, 28, 't12');
+INSERT INTO notes VALUES (2005, 35, 't25');
+INSERT INTO notes VALUES (2006, 42, 't38');
+INSERT INTO notes VALUES (2007, 49, 't51');
+INSERT INTO notes VALUES (2008, 56, 't4');
+INSERT INTO notes VALUES (2009, 63, 't17');
+INSERT INTO notes VALUES (2010, 70, 't30');
+INSERT INTO notes VALUES (2011, 77, 't43');
+INSERT INTO notes VALUES (2012, 84, 't56');
+INSERT INTO notes VALUES (2013, 91, 't9');
+INSERT INTO notes VALUES (2014, 98, 't22');
+INSERT INTO notes VALUES (2015, 105, 't35');
+INSERT INTO notes VALUES (2016, 112, 't48');
+INSERT INTO notes VALUES (2017, 119, 't1');
+INSERT INTO notes VALUES (2018, 126, 't14');
+INSERT INTO notes VALUES (2019, 133, 't27');
+INSERT INTO notes VALUES (2020, 140, 't40');
+INSERT INTO notes VALUES (2021, 147, 't53');
+INSERT INTO notes VALUES (2022, 154, 't6');
+INSERT INTO notes VALUES (2023, 161, 't19');
+INSERT INTO notes VALUES (2024, 168, 't32');
+INSERT INTO notes VALUES (2025, 175, 't45');
+INSERT INTO notes VALUES (2026, 182, 't58');
+INSERT INTO notes VALUES (2027, 189, 't11');
+INSERT INTO notes VALUES (2028, 196, 't24');
+INSERT INTO notes VALUES (2029, 203, 't37');
+INSERT INTO notes VALUES (2030, 210, 't50');
+INSERT INTO notes VALUES (2031, 217, 't3');
+INSERT INTO notes VALUES (2032, 224, 't16');
+INSERT INTO notes VALUES (2033, 231, 't29');
+INSERT INTO notes VALUES (2034, 238, 't42');
+INSERT INTO notes VALUES (2035, 245, 't55');
+INSERT INTO notes VALUES (2036, 252, 't8');
+INSERT INTO notes VALUES (2037, 259, 't21');
+INSERT INTO notes VALUES (2038, 266, 't34');
+INSERT INTO notes VALUES (2039, 273, 't47');
+INSERT INTO notes VALUES (2040, 280, 't0');
+INSERT INTO notes VALUES (2041, 287, 't13');
+INSERT INTO notes VALUES (2042, 294, 't26');
+INSERT INTO notes VALUES (2043, 301, 't39');
+INSERT INTO notes VALUES (2044, 308, 't52');
+INSERT INTO notes VALUES (2045, 315, 't5');
+INSERT INTO notes VALUES (2046, 322, 't18');
+INSERT INTO notes VALUES (2047, 329, 't31');
+INSERT INTO notes VALUES (2048, 336, 't44');
+INSERT INTO notes VALUES (2049, 343, 't57');
+INSERT INTO notes VALUES (2050, 350, 't10');
+INSERT INTO notes VALUES (2051, 357, 't23');
+INSERT INTO notes VALUES (2052, 364, 't36');
+INSERT INTO notes VALUES (2053, 371, 't49');
+INSERT INTO notes VALUES (2054, 378, 't2');
+INSERT INTO notes VALUES (2055, 385, 't15');
+INSERT INTO notes VALUES (2056, 392, 't28');
+INSERT INTO notes VALUES (2057, 399, 't41');
+INSERT INTO notes VALUES (2058, 406, 't54');
+INSERT INTO notes VALUES (2059, 413, 't7');
+INSERT INTO notes VALUES (2060, 420, 't20');
+INSERT INTO notes VALUES (2061, 427, 't33');
+INSERT INTO notes VALUES (2062, 434, 't46');
+INSERT INTO notes VALUES (2063, 441, 't59');
+INSERT INTO notes VALUES (2064, 448, 't12');
+INSERT INTO notes VALUES (2065, 455, 't25');
+INSERT INTO notes VALUES (2066, 462, 't38');
+INSERT INTO notes VALUES (2067, 469, 't51');
+INSERT INTO notes VALUES (2068, 476, 't4');
+INSERT INTO notes VALUES (2069, 483, 't17');
+INSERT INTO notes VALUES (2070, 490, 't30');
+INSERT INTO notes VALUES (2071, 497, 't43');
+INSERT INTO notes VALUES (2072, 504, 't56');
+INSERT INTO notes VALUES (2073, 511, 't9');
+INSERT INTO notes VALUES (2074, 518, 't22');
+INSERT INTO notes VALUES (2075, 525, 't35');
+INSERT INTO notes VALUES (2076, 532, 't48');
+INSERT INTO notes VALUES (2077, 539, 't1');
+INSERT INTO notes VALUES (2078, 546, 't14');
+INSERT INTO notes VALUES (2079, 553, 't27');
+INSERT INTO notes VALUES (2080, 560, 't40');
+INSERT INTO notes VALUES (2081, 567, 't53');
+INSERT INTO notes VALUES (2082, 574, 't6');
+INSERT INTO notes VALUES (2083, 581, 't19');
+INSERT INTO notes VALUES (2084, 588, 't32');
+INSERT INTO notes VALUES (2085, 595, 't45');
+INSERT INTO notes VALUES (2086, 602, 't58');
+INSERT INTO notes VALUES (2087, 609, 't11');
+INSERT INTO notes VALUES (2088, 616, 't24');
+INSERT INTO notes VALUES (2089, 623, 't37');
+INSERT INTO notes VALUES (2090, 630, 't50');
+INSERT INTO notes VALUES (2091, 637, 't3');
+INSERT INTO notes VALUES (2092, 644, 't16');
+INSERT INTO notes VALUES (2093, 651, 't29');
+INSERT INTO notes VALUES (2094, 658, 't42');
+INSERT INTO notes VALUES (2095, 665, 't55');
+INSERT INTO notes VALUES (2096, 672, 't8');
+INSERT INTO notes VALUES (2097, 679, 't21');
+INSERT INTO notes VALUES (2098, 686, 't34');
+INSERT INTO notes VALUES (2099, 693, 't47');
+INSERT INTO notes VALUES (2100, 700, 't0');
+INSERT INTO notes VALUES (2101, 707, 't13');
+INSERT INTO notes VALUES (2102, 714, 't26');
+INSERT INTO notes VALUES (2103, 721, 't39');
+INSERT INTO notes VALUES (2104, 728, 't52');
+INSERT INTO notes VALUES (2105, 735, 't5');
+INSERT INTO notes VALUES (2106, 742, 't18');
+INSERT INTO notes VALUES (2107, 749, 't31');
+INSERT INTO notes VALUES (2108, 756, 't44');
+INSERT INTO notes VALUES (2109, 763, 't57');
+INSERT INTO notes VALUES (2110, 770, 't10');
+INSERT INTO notes VALUES (2111, 777, 't23');
+INSERT INTO notes VALUES (2112, 784, 't36');
+INSERT INTO notes VALUES (2113, 791, 't49');
+INSERT INTO notes VALUES (2114, 798, 't2');
+INSERT INTO notes VALUES (2115, 805, 't15');
+INSERT INTO notes VALUES (2116, 812, 't28');
+INSERT INTO notes VALUES (2117, 819, 't41');
+INSERT INTO notes VALUES (2118, 826, 't54');
+INSERT INTO notes VALUES (2119, 833, 't7');
+INSERT INTO notes VALUES (2120, 840, 't20');
+INSERT INTO notes VALUES (2121, 847, 't33');
+INSERT INTO notes VALUES (2122, 854, 't46');
+INSERT INTO notes VALUES (2123, 861, 't59');
+INSERT INTO notes VALUES (2124, 868, 't12');
+INSERT INTO notes VALUES (2125, 875, 't25');
+INSERT INTO notes VALUES (2126, 882, 't38');
+INSERT INTO notes VALUES (2127, 889, 't51');
+INSERT INTO notes VALUES (2128, 896, 't4');
+INSERT INTO notes VALUES (2129, 903, 't17');
+INSERT INTO notes VALUES (2130, 910, 't30');
+INSERT INTO notes VALUES (2131, 917, 't43');
+INSERT INTO notes VALUES (2132, 924, 't56');
+INSERT INTO notes VALUES (2133, 931, 't9');
+INSERT INTO notes VALUES (2134, 938, 't22');
+INSERT INTO notes VALUES (2135, 945, 't35');
+INSERT INTO notes VALUES (2136, 952, 't48');
+INSERT INTO notes VALUES (2137, 959, 't1');
+INSERT INTO notes VALUES (2138, 966, 't14');
+INSERT INTO notes VALUES (2139, 973, 't27');
+INSERT INTO notes VALUES (2140, 980, 't40');
+INSERT INTO notes VALUES (2141, 987, 't53');
+INSERT INTO notes VALUES (2142, 994, 't6');
+INSERT INTO notes VALUES (2143, 1001, 't19');
+INSERT INTO notes VALUES (2144, 1008, 't32');
+INSERT INTO notes VALUES (2145, 1015, 't45');
+INSERT INTO notes VALUES (2146, 1022, 't58');
+INSERT INTO notes VALUES (2147, 1029, 't11');
+INSERT INTO notes VALUES (2148, 1036, 't24');
+INSERT INTO notes VALUES (2149, 1043, 't37');
+INSERT INTO notes VALUES (2150, 1050, 't50');
+INSERT INTO notes VALUES (2151, 1057, 't3');
+INSERT INTO notes VALUES (2152, 1064, 't16');
+INSERT INTO notes VALUES (2153, 1071, 't29');
+INSERT INTO notes VALUES (2154, 1078, 't42');
+INSERT INTO notes VALUES (2155, 1085, 't55');
+INSERT INTO notes VALUES (2156, 1092, 't8');
+INSERT INTO notes VALUES (2157, 1099, 't21');
+INSERT INTO notes VALUES (2158, 1106, 't34');
+INSERT INTO notes VALUES (2159, 1113, 't47');
+INSERT INTO notes VALUES (2160, 1120, 't0');
+INSERT INTO notes VALUES (2161, 1127, 't13');
+INSERT INTO notes VALUES (2162, 1134, 't26');
+INSERT INTO notes VALUES (2163, 1141, 't39');
+INSERT INTO notes VALUES (2164, 1148, 't52');
+INSERT INTO notes VALUES (2165, 1155, 't5');
+INSERT INTO notes VALUES (2166, 1162, 't18');
+INSERT INTO notes VALUES (2167, 1169, 't31');
+INSERT INTO notes VALUES (2168, 1176, 't44');
+INSERT INTO notes VALUES (2169, 1183, 't57');
+INSERT INTO notes VALUES (2170, 1190, 't10');
+INSERT INTO notes VALUES (2171, 1197, 't23');
+INSERT INTO notes VALUES (2172, 1204, 't36');
+INSERT INTO notes VALUES (2173, 1211, 't49');
+INSERT INTO notes VALUES (2174, 1218, 't2');
+INSERT INTO notes VALUES (2175, 1225, 't15');
+INSERT INTO notes VALUES (2176, 1232, 't28');
+INSERT INTO notes VALUES (2177, 1239, 't41');
+INSERT INTO notes VALUES (2178, 1246, 't54');
+INSERT INTO notes VALUES (2179, 1253, 't7');
+INSERT INTO notes VALUES (2180, 1260, 't20');
+INSERT INTO notes VALUES (2181, 1267, 't33');
+INSERT INTO notes VALUES (2182, 1274, 't46');
+INSERT INTO notes VALUES (2183, 1281, 't59');
+INSERT INTO notes VALUES (2184, 1288, 't12');
+INSERT INTO notes VALUES (2185, 1295, 't25');
+INSERT INTO notes VALUES (2186, 1302, 't38');
+INSERT INTO notes VALUES (2187, 1309, 't51');
+INSERT INTO notes VALUES (2188, 1316, 't4');
+INSERT INTO notes VALUES (2189, 1323, 't17');
+INSERT INTO notes VALUES (2190, 1330, 't30');
+INSERT INTO notes VALUES (2191, 1337, 't43');
+INSERT INTO notes VALUES (2192, 1344, 't56');
+INSERT INTO notes VALUES (2193, 1351, 't9');
+INSERT INTO notes VALUES (2194, 1358, 't22');
+INSERT INTO notes VALUES (2195, 1365, 't35');
+INSERT INTO notes VALUES (2196, 1372, 't48');
+INSERT INTO notes VALUES (2197, 1379, 't1');
+INSERT INTO notes VALUES (2198, 1386, 't14');
+INSERT INTO notes VALUES (2199, 1393, 't27');
+INSERT INTO notes VALUES (2200, 1400, 't40');
+INSERT INTO notes VALUES (2201, 1407, 't53');
+INSERT INTO notes VALUES (2202, 1414, 't6');
+INSERT INTO notes VALUES (2203, 1421, 't19');
+INSERT INTO notes VALUES (2204, 1428, 't32');
+INSERT INTO notes VALUES (2205, 1435, 't45');
+INSERT INTO notes VALUES (2206, 1442, 't58');
+INSERT INTO notes VALUES (2207, 1449, 't11');
+INSERT INTO notes VALUES (2208, 1456, 't24');
+INSERT INTO notes VALUES (2209, 1463, 't37');
+INSERT INTO notes VALUES (2210, 1470, 't50');
+INSERT INTO notes VALUES (2211, 1477, 't3');
+INSERT INTO notes VALUES (2212, 1484, 't16');
+INSERT INTO notes VALUES (2213, 1491, 't29');
+INSERT INTO notes VALUES (2214, 1498, 't42');
+INSERT INTO notes VALUES (2215, 1505, 't55');
+INSERT INTO notes VALUES (2216, 1512, 't8');
+INSERT INTO notes VALUES (2217, 1519, 't21');
+INSERT INTO notes VALUES (2218, 1526, 't34');
+INSERT INTO notes VALUES (2219, 1533, 't47');
+INSERT INTO notes VALUES (2220, 1540, 't0');
+INSERT INTO notes VALUES (2221, 1547, 't13');
+INSERT INTO notes VALUES (2222, 1554, 't26');
+INSERT INTO notes VALUES (2223, 1561, 't39');
+INSERT INTO notes VALUES (2224, 1568, 't52');
+INSERT INTO notes VALUES (2225, 1575, 't5');
+INSERT INTO notes VALUES (2226, 1582, 't18');
+INSERT INTO notes VALUES (2227, 1589, 't31');
+INSERT INTO notes VALUES (2228, 1596, 't44');
+INSERT INTO notes VALUES (2229, 1603, 't57');
+INSERT INTO notes VALUES (2230, 1610, 't10');
+INSERT INTO notes VALUES (2231, 1617, 't23');
+INSERT INTO notes VALUES (2232, 1624, 't36');
+INSERT INTO notes VALUES (2233, 1631, 't49');
+INSERT INTO notes VALUES (2234, 1638, 't2');
+INSERT INTO notes VALUES (2235, 1645, 't15');
+INSERT INTO notes VALUES (2236, 1652, 't28');
+INSERT INTO notes VALUES (2237, 1659, 't41');
+INSERT INTO notes VALUES (2238, 1666, 't54');
+INSERT INTO notes VALUES (2239, 1673, 't7');
+INSERT INTO notes VALUES (2240, 1680, 't20');
+INSERT INTO notes VALUES (2241, 1687, 't33');
+INSERT INTO notes VALUES (2242, 1694, 't46');
+INSERT INTO notes VALUES (2243, 1701, 't59');
+INSERT INTO notes VALUES (2244, 1708, 't12');
+INSERT INTO notes VALUES (2245, 1715, 't25');
+INSERT INTO notes VALUES (2246, 1722, 't38');
+INSERT INTO notes VALUES (2247, 1729, 't51');
+INSERT INTO notes VALUES (2248, 1736, 't4');
+INSERT INTO notes VALUES (2249, 1743, 't17');
+INSERT INTO notes VALUES (2250, 1750, 't30');
+INSERT INTO notes VALUES (2251, 1757, 't43');
+INSERT INTO notes VALUES (2252, 1764, 't56');
+INSERT INTO notes VALUES (2253, 1771, 't9');
+INSERT INTO notes VALUES (2254, 1778, 't22');
+INSERT INTO notes VALUES (2255, 1785, 't35');
+INSERT INTO notes VALUES (2256, 1792, 't48');
+INSERT INTO notes VALUES (2257, 1799, 't1');
+INSERT INTO notes VALUES (2258, 1806, 't14');
+INSERT INTO notes VALUES (2259, 1813, 't27');
+INSERT INTO notes VALUES (2260, 1820, 't40');
+INSERT INTO notes VALUES (2261, 1827, 't53');
+INSERT INTO notes VALUES (2262, 1834, 't6');
+INSERT INTO notes VALUES (2263, 1841, 't19');
+INSERT INTO notes VALUES (2264, 1848, 't32');
+INSERT INTO notes VALUES (2265, 1855, 't45');
+INSERT INTO notes VALUES (2266, 1862, 't58');
+INSERT INTO notes VALUES (2267, 1869, 't11');
+INSERT INTO notes VALUES (2268, 1876, 't24');
+INSERT INTO notes VALUES (2269, 1883, 't37');
+INSERT INTO notes VALUES (2270, 1890, 't50');
+INSERT INTO notes VALUES (2271, 1897, 't3');
+INSERT INTO notes VALUES (2272, 1904, 't16');
+INSERT INTO notes VALUES (2273, 1911, 't29');
+INSERT INTO notes VALUES (2274, 1918, 't42');
+INSERT INTO notes VALUES (2275, 1925, 't55');
+INSERT INTO notes VALUES (2276, 1932, 't8');
+INSERT INTO notes VALUES (2277, 1939, 't21');
+INSERT INTO notes VALUES (2278, 1946, 't34');
+INSERT INTO notes VALUES (2279, 1953, 't47');
+INSERT INTO notes VALUES (2280, 1960, 't0');
+INSERT INTO notes VALUES (2281, 1967, 't13');
+INSERT INTO notes VALUES (2282, 1974, 't26');
+INSERT INTO notes VALUES (2283, 1981, 't39');
+INSERT INTO notes VALUES (2284, 1988, 't52');
+INSERT INTO notes VALUES (2285, 1995, 't5');
+INSERT INTO notes VALUES (2286, 2, 't18');
+INSERT INTO notes VALUES (2287, 9, 't31');
+INSERT INTO notes VALUES (2288, 16, 't44');
+INSERT INTO notes VALUES (2289, 23, 't57');
+INSERT INTO notes VALUES (2290, 30, 't10');
+INSERT INTO notes VALUES (2291, 37, 't23');
+INSERT INTO notes VALUES (2292, 44, 't36');
+INSERT INTO notes VALUES (2293, 51, 't49');
+INSERT INTO notes VALUES (2294, 58, 't2');
+INSERT INTO notes VALUES (2295, 65, 't15');
+INSERT INTO notes VALUES (2296, 72, 't28');
+INSERT INTO notes VALUES (2297, 79, 't41');
+INSERT INTO notes VALUES (2298, 86, 't54');
+INSERT INTO notes VALUES (2299, 93, 't7');
+INSERT INTO notes VALUES (2300, 100, 't20');
+INSERT INTO notes VALUES (2301, 107, 't33');
+INSERT INTO notes VALUES (2302, 114, 't46');
+INSERT INTO notes VALUES (2303, 121, 't59');
+INSERT INTO notes VALUES (2304, 128, 't12');
+INSERT INTO notes VALUES (2305, 135, 't25');
+INSERT INTO notes VALUES (2306, 142, 't38');
+INSERT INTO notes VALUES (2307, 149, 't51');
+INSERT INTO notes VALUES (2308, 156, 't4');
+INSERT INTO notes VALUES (2309, 163, 't17');
+INSERT INTO notes VALUES (2310, 170, 't30');
+INSERT INTO notes VALUES (2311, 177, 't43');
+INSERT INTO notes VALUES (2312, 184, 't56');
+INSERT INTO notes VALUES (2313, 191, 't9');
+INSERT INTO notes VALUES (2314, 198, 't22');
+INSERT INTO notes VALUES (2315, 205, 't35');
+INSERT INTO notes VALUES (2316, 212, 't48');
+INSERT INTO notes VALUES (2317, 219, 't1');
+INSERT INTO notes VALUES (2318, 226, 't14');
+INSERT INTO notes VALUES (2319, 233, 't27');
+INSERT INTO notes VALUES (2320, 240, 't40');
+INSERT INTO notes VALUES (2321, 247, 't53');
+INSERT INTO notes VALUES (2322, 254, 't6');
+INSERT INTO notes VALUES (2323, 261, 't19');
+INSERT INTO notes VALUES (2324, 268, 't32');
+INSERT INTO notes VALUES (2325, 275, 't45');
+INSERT INTO notes VALUES (2326, 282, 't58');
+INSERT INTO notes VALUES (2327, 289, 't11');
+INSERT INTO notes VALUES (2328, 296, 't24');
+INSERT INTO notes VALUES (2329, 303, 't37');
+INSERT INTO notes VALUES (2330, 310, 't50');
+INSERT INTO notes VALUES (2331, 317, 't3');
+INSERT INTO notes VALUES (2332, 324, 't16');
+INSERT INTO notes VALUES (2333, 331, 't29');
+INSERT INTO notes VALUES (2334, 338, 't42');
+INSERT INTO notes VALUES (2335, 345, 't55');
+INSERT INTO notes VALUES (2336, 352, 't8');
+INSERT INTO notes VALUES (2337, 359, 't21');
+INSERT INTO notes VALUES (2338, 366, 't34');
+INSERT INTO notes VALUES (2339, 373, 't47');
+INSERT INTO notes VALUES (2340, 380, 't0');
+INSERT INTO notes VALUES (2341, 387, 't13');
+INSERT INTO notes VALUES (2342, 394, 't26');
+INSERT INTO notes VALUES (2343, 401, 't39');
+INSERT INTO notes VALUES (2344, 408, 't52');
+INSERT INTO notes VALUES (2345, 415, 't5');
+INSERT INTO notes VALUES (2346, 422, 't18');
+INSERT INTO notes VALUES (2347, 429, 't31');
+INSERT INTO notes VALUES (2348, 436, 't44');
+INSERT INTO notes VALUES (2349, 443, 't57');
+INSERT INTO notes VALUES (2350, 450, 't10');
+INSERT INTO notes VALUES (2351, 457, 't23');
+INSERT INTO notes VALUES (2352, 464, 't36');
+INSERT INTO notes VALUES (2353, 471, 't49');
+INSERT INTO notes VALUES (2354, 478, 't2');
+INSERT INTO notes VALUES (2355, 485, 't15');
+INSERT INTO notes VALUES (2356, 492, 't28');
+INSERT INTO notes VALUES (2357, 499, 't41');
+INSERT INTO notes VALUES (2358, 506, 't54');
+INSERT INTO notes VALUES (2359, 513, 't7');
+INSERT INTO notes VALUES (2360, 520, 't20');
+INSERT INTO notes VALUES (2361, 527, 't33');
+INSERT INTO notes VALUES (2362, 534, 't46');
+INSERT INTO notes VALUES (2363, 541, 't59');
+INSERT INTO notes VALUES (2364, 548, 't12');
+INSERT INTO notes VALUES (2365, 555, 't25');
+INSERT INTO notes VALUES (2366, 562, 't38');
+INSERT INTO notes VALUES (2367, 569, 't51');
+INSERT INTO notes VALUES (2368, 576, 't4');
+INSERT INTO notes VALUES (2369, 583, 't17');
+INSERT INTO notes VALUES (2370, 590, 't30');
+INSERT INTO notes VALUES (2371, 597, 't43');
+INSERT INTO notes VALUES (2372, 604, 't56');
+INSERT INTO notes VALUES (2373, 611, 't9');
+INSERT INTO notes VALUES (2374, 618, 't22');
+INSERT INTO notes VALUES (2375, 625, 't35');
+INSERT INTO notes VALUES (2376, 632, 't48');
+INSERT INTO notes VALUES (2377, 639, 't1');
+INSERT INTO notes VALUES (2378, 646, 't14');
+INSERT INTO notes VALUES (2379, 653, 't27');
+INSERT INTO notes VALUES (2380, 660, 't40');
+INSERT INTO notes VALUES (2381, 667, 't53');
+INSERT INTO notes VALUES (2382, 674, 't6');
+INSERT INTO notes VALUES (2383, 681, 't19');
+INSERT INTO notes VALUES (2384, 688, 't32');
+INSERT INTO notes VALUES (2385, 695, 't45');
+INSERT INTO notes VALUES (2386, 702, 't58');
+INSERT INTO notes VALUES (2387, 709, 't11');
+INSERT INTO notes VALUES (2388, 716, 't24');
+INSERT INTO notes VALUES (2389, 723, 't37');
+INSERT INTO notes VALUES (2390, 730, 't50');
+INSERT INTO notes VALUES (2391, 737, 't3');
+INSERT INTO notes VALUES (2392, 744, 't16');
+INSERT INTO notes VALUES (2393, 751, 't29');
+INSERT INTO notes VALUES (2394, 758, 't42');
+INSERT INTO notes VALUES (2395, 765, 't55');
+INSERT INTO notes VALUES (2396, 772, 't8');
+INSERT INTO notes VALUES (2397, 779, 't21');
+INSERT INTO notes VALUES (2398, 786, 't34');
+INSERT INTO notes VALUES (2399, 793, 't47');
+INSERT INTO notes VALUES (2400, 800, 't0');
+INSERT INTO notes VALUES (2401, 807, 't13');
+INSERT INTO notes VALUES (2402, 814, 't26');
+INSERT INTO notes VALUES (2403, 821, 't39');
+INSERT INTO notes VALUES (2404, 828, 't52');
+INSERT INTO notes VALUES (2405, 835, 't5');
+INSERT INTO notes VALUES (2406, 842, 't18');
+INSERT INTO notes VALUES (2407, 849, 't31');
+INSERT INTO notes VALUES (2408, 856, 't44');
+INSERT INTO notes VALUES (2409, 863, 't57');
+INSERT INTO notes VALUES (2410, 870, 't10');
+INSERT INTO notes VALUES (2411, 877, 't23');
+INSERT INTO notes VALUES (2412, 884, 't36');
+INSERT INTO notes VALUES (2413, 891, 't49');
+INSERT INTO notes VALUES (2414, 898, 't2');
+INSERT INTO notes VALUES (2415, 905, 't15');
+INSERT INTO notes VALUES (2416, 912, 't28');
+INSERT INTO notes VALUES (2417, 919, 't41');
+INSERT INTO notes VALUES (2418, 926, 't54');
+INSERT INTO notes VALUES (2419, 933, 't7');
+INSERT INTO notes VALUES (2420, 940, 't20');
+INSERT INTO notes VALUES (2421, 947, 't33');
+INSERT INTO notes VALUES (2422, 954, 't46');
+INSERT INTO notes VALUES (2423, 961, 't59');
+INSERT INTO notes VALUES (2424, 968, 't12');
+INSERT INTO notes VALUES (2425, 975, 't25');
+INSERT INTO notes VALUES (2426, 982, 't38');
+INSERT INTO notes VALUES (2427, 989, 't51');
+INSERT INTO notes VALUES (2428, 996, 't4');
+INSERT INTO notes VALUES (2429, 1003, 't17');
+INSERT INTO notes VALUES (2430, 1010, 't30');
+INSERT INTO notes VALUES (2431, 1017, 't43');
+INSERT INTO notes VALUES (2432, 1024, 't56');
+INSERT INTO notes VALUES (2433, 1031, 't9');
+INSERT INTO notes VALUES (2434, 1038, 't22');
+INSERT INTO notes VALUES (2435, 1045, 't35');
+INSERT INTO notes VALUES (2436, 1052, 't48');
+INSERT INTO notes VALUES (2437, 1059, 't1');
+INSERT INTO notes VALUES (2438, 1066, 't14');
+INSERT INTO notes VALUES (2439, 1073, 't27');
+INSERT INTO notes VALUES (2440, 1080, 't40');
+INSERT INTO notes VALUES (2441, 1087, 't53');
+INSERT INTO notes VALUES (2442, 1094, 't6');
+INSERT INTO notes VALUES (2443, 1101, 't19');
+INSERT INTO notes VALUES (2444, 1108, 't32');
+INSERT INTO notes VALUES (2445, 1115, 't45');
+INSERT INTO notes VALUES (2446, 1122, 't58');
+INSERT INTO notes VALUES (2447, 1129, 't11');
+INSERT INTO notes VALUES (2448, 1136, 't24');
+INSERT INTO notes VALUES (2449, 1143, 't37');
+INSERT INTO notes VALUES (2450, 1150, 't50');
+INSERT INTO notes VALUES (2451, 1157, 't3');
+INSERT INTO notes VALUES (2452, 1164, 't16');
+INSERT INTO notes VALUES (2453, 1171, 't29');
+INSERT INTO notes VALUES (2454, 1178, 't42');
+INSERT INTO notes VALUES (2455, 1185, 't55');
+INSERT INTO notes VALUES (2456, 1192, 't8');
+INSERT INTO notes VALUES (2457, 1199, 't21');
+INSERT INTO notes VALUES (2458, 1206, 't34');
+INSERT INTO notes VALUES (2459, 1213, 't47');
+INSERT INTO notes VALUES (2460, 1220, 't0');
+INSERT INTO notes VALUES (2461, 1227, 't13');
+INSERT INTO notes VALUES (2462, 1234, 't26');
+INSERT INTO notes VALUES (2463, 1241, 't39');
+INSERT INTO notes VALUES (2464, 1248, 't52');
+INSERT INTO notes VALUES (2465, 1255, 't5');
+INSERT INTO notes VALUES (2466, 1262, 't18');
+INSERT INTO notes VALUES (2467, 1269, 't31');
+INSERT INTO notes VALUES (2468, 1276, 't44');
+INSERT INTO notes VALUES (2469, 1283, 't57');
+INSERT INTO notes VALUES (2470, 1290, 't10');
+INSERT INTO notes VALUES (2471, 1297, 't23');
+INSERT INTO notes VALUES (2472, 1304, 't36');
+INSERT INTO notes VALUES (2473, 1311, 't49');
+INSERT INTO notes VALUES (2474, 1318, 't2');
+INSERT INTO notes VALUES (2475, 1325, 't15');
+INSERT INTO notes VALUES (2476, 1332, 't28');
+INSERT INTO notes VALUES (2477, 1339, 't41');
+INSERT INTO notes VALUES (2478, 1346, 't54');
+INSERT INTO notes VALUES (2479, 1353, 't7');
+INSERT INTO notes VALUES (2480, 1360, 't20');
+INSERT INTO notes VALUES (2481, 1367, 't33');
+INSERT INTO notes VALUES (2482, 1374, 't46');
+INSERT INTO notes VALUES (2483, 1381, 't59');
+INSERT INTO notes VALUES (2484, 1388, 't12');
+INSERT INTO notes VALUES (2485, 1395, 't25');
+INSERT INTO notes VALUES (2486, 1402, 't38');
+INSERT INTO notes VALUES (2487, 1409, 't51');
+INSERT INTO notes VALUES (2488, 1416, 't4');
+INSERT INTO notes VALUES (2489, 1423, 't17');
+INSERT INTO notes VALUES (2490, 1430, 't30');
+INSERT INTO notes VALUES (2491, 1437, 't43');
+INSERT INTO notes VALUES (2492, 1444, 't56');
+INSERT INTO notes VALUES (2493, 1451, 't9');
+INSERT INTO notes VALUES (2494, 1458, 't22');
+INSERT INTO notes VALUES (2495, 1465, 't35');
+INSERT INTO notes VALUES (2496, 1472, 't48');
+INSERT INTO notes VALUES (2497, 1479, 't1');
+INSERT INTO notes VALUES (2498, 1486, 't14');
+INSERT INTO notes VALUES (2499, 1493, 't27');
+INSERT INTO notes VALUES (2500, 1500, 't40');
+INSERT INTO notes VALUES (2501, 1507, 't53');
+INSERT INTO notes VALUES (2502, 1514, 't6');
+INSERT INTO notes VALUES (2503, 1521, 't19');
+INSERT INTO notes VALUES (2504, 1528, 't32');
+INSERT INTO notes VALUES (2505, 1535, 't45');
+INSERT INTO notes VALUES (2506, 1542, 't58');
+INSERT INTO notes VALUES (2507, 1549, 't11');
+INSERT INTO notes VALUES (2508, 1556, 't24');
+INSERT INTO notes VALUES (2509, 1563, 't37');
+INSERT INTO notes VALUES (2510, 1570, 't50');
+INSERT INTO notes VALUES (2511, 1577, 't3');
+INSERT INTO notes VALUES (2512, 1584, 't16');
+INSERT INTO notes VALUES (2513, 1591, 't29');
+INSERT INTO notes VALUES (2514, 1598, 't42');
+INSERT INTO notes VALUES (2515, 1605, 't55');
+INSERT INTO notes VALUES (2516, 1612, 't8');
+INSERT INTO notes VALUES (2517, 1619, 't21');
+INSERT INTO notes VALUES (2518, 1626, 't34');
+INSERT INTO notes VALUES (2519, 1633, 't47');
+INSERT INTO notes VALUES (2520, 1640, 't0');
+INSERT INTO notes VALUES (2521, 1647, 't13');
+INSERT INTO notes VALUES (2522, 1654, 't26');
+INSERT INTO notes VALUES (2523, 1661, 't39');
+INSERT INTO notes VALUES (2524, 1668, 't52');
+INSERT INTO notes VALUES (2525, 1675, 't5');
+INSERT INTO notes VALUES (2526, 1682, 't18');
+INSERT INTO notes VALUES (2527, 1689, 't31');
+INSERT INTO notes VALUES (2528, 1696, 't44');
+INSERT INTO notes VALUES (2529, 1703, 't57');
+INSERT INTO notes VALUES (2530, 1710, 't10');
+INSERT INTO notes VALUES (2531, 1717, 't23');
+INSERT INTO notes VALUES (2532, 1724, 't36');
+INSERT INTO notes VALUES (2533, 1731, 't49');
+INSERT INTO notes VALUES (2534, 1738, 't2');
+INSERT INTO notes VALUES (2535, 1745, 't15');
+INSERT INTO notes VALUES (2536, 1752, 't28');
+INSERT INTO notes VALUES (2537, 1759, 't41');
+INSERT INTO notes VALUES (2538, 1766, 't54');
+INSERT INTO notes VALUES (2539, 1773, 't7');
+INSERT INTO notes VALUES (2540, 1780, 't20');
+INSERT INTO notes VALUES (2541, 1787, 't33');
+INSERT INTO notes VALUES (2542, 1794, 't46');
+INSERT INTO notes VALUES (2543, 1801, 't59');
+INSERT INTO notes VALUES (2544, 1808, 't12');
+INSERT INTO notes VALUES (2545, 1815, 't25');
+INSERT INTO notes VALUES (2546, 1822, 't38');
+INSERT INTO notes VALUES (2547, 1829, 't51');
+INSERT INTO notes VALUES (2548, 1836, 't4');
+INSERT INTO notes VALUES (2549, 1843, 't17');
+INSERT INTO notes VALUES (2550, 1850, 't30');
+INSERT INTO notes VALUES (2551, 1857, 't43');
+INSERT INTO notes VALUES (2552, 1864, 't56');
+INSERT INTO notes VALUES (2553, 1871, 't9');
+INSERT INTO notes VALUES (2554, 1878, 't22');
+INSERT INTO notes VALUES (2555, 1885, 't35');
+INSERT INTO notes VALUES (2556, 1892, 't48');
+INSERT INTO notes VALUES (2557, 1899, 't1');
+INSERT INTO notes VALUES (2558, 1906, 't14');
+INSERT INTO notes VALUES (2559, 1913, 't27');
+INSERT INTO notes VALUES (2560, 1920, 't40');
+INSERT INTO notes VALUES (2561, 1927, 't53');
+INSERT INTO notes VALUES (2562, 1934, 't6');
+INSERT INTO notes VALUES (2563, 1941, 't19');
+INSERT INTO notes VALUES (2564, 1948, 't32');
+INSERT INTO notes VALUES (2565, 1955, 't45');
+INSERT INTO notes VALUES (2566, 1962, 't58');
+INSERT INTO notes VALUES (2567, 1969, 't11');
+INSERT INTO notes VALUES (2568, 1976, 't24');
+INSERT INTO notes VALUES (2569, 1983, 't37');
+INSERT INTO notes VALUES (2570, 1990, 't50');
+INSERT INTO notes VALUES (2571, 1997, 't3');
+INSERT INTO notes VALUES (2572, 4, 't16');
+INSERT INTO notes VALUES (2573, 11, 't29');
+INSERT INTO notes VALUES (2574, 18, 't42');
+INSERT INTO notes VALUES (2575, 25, 't55');
+INSERT INTO notes VALUES (2576, 32, 't8');
+INSERT INTO notes VALUES (2577, 39, 't21');
+INSERT INTO notes VALUES (2578, 46, 't34');
+INSERT INTO notes VALUES (2579, 53, 't47');
+INSERT INTO notes VALUES (2580, 60, 't0');
+INSERT INTO notes VALUES (2581, 67, 't13');
+INSERT INTO notes VALUES (2582, 74, 't26');
+INSERT INTO notes VALUES (2583, 81, 't39');
+INSERT INTO notes VALUES (2584, 88, 't52');
+INSERT INTO notes VALUES (2585, 95, 't5');
+INSERT INTO notes VALUES (2586, 102, 't18');
+INSERT INTO notes VALUES (2587, 109, 't31');
+INSERT INTO notes VALUES (2588, 116, 't44');
+INSERT INTO notes VALUES (2589, 123, 't57');
+INSERT INTO notes VALUES (2590, 130, 't10');
+INSERT INTO notes VALUES (2591, 137, 't23');
+INSERT INTO notes VALUES (2592, 144, 't36');
+INSERT INTO notes VALUES (2593, 151, 't49');
+INSERT INTO notes VALUES (2594, 158, 't2');
+INSERT INTO notes VALUES (2595, 165, 't15');
+INSERT INTO notes VALUES (2596, 172, 't28');
+INSERT INTO notes VALUES (2597, 179, 't41');
+INSERT INTO notes VALUES (2598, 186, 't54');
+INSERT INTO notes VALUES (2599, 193, 't7');
+INSERT INTO notes VALUES (2600, 200, 't20');
+INSERT INTO notes VALUES (2601, 207, 't33');
+INSERT INTO notes VALUES (2602, 214, 't46');
+INSERT INTO notes VALUES (2603, 221, 't59');
+INSERT INTO notes VALUES (2604, 228, 't12');
+INSERT INTO notes VALUES (2605, 235, 't25');
+INSERT INTO notes VALUES (2606, 242, 't38');
+INSERT INTO notes VALUES (2607, 249, 't51');
+INSERT INTO notes VALUES (2608, 256, 't4');
+INSERT INTO notes VALUES (2609, 263, 't17');
+INSERT INTO notes VALUES (2610, 270, 't30');
+INSERT INTO notes VALUES (2611, 277, 't43');
+INSERT INTO notes VALUES (2612, 284, 't56');
+INSERT INTO notes VALUES (2613, 291, 't9');
+INSERT INTO notes VALUES (2614, 298, 't22');
+INSERT INTO notes VALUES (2615, 305, 't35');
+INSERT INTO notes VALUES (2616, 312, 't48');
+INSERT INTO notes VALUES (2617, 319, 't1');
+INSERT INTO notes VALUES (2618, 326, 't14');
+INSERT INTO notes VALUES (2619, 333, 't27');
+INSERT INTO notes VALUES (2620, 340, 't40');
+INSERT INTO notes VALUES (2621, 347, 't53');
+INSERT INTO notes VALUES (2622, 354, 't6');
+INSERT INTO notes VALUES (2623, 361, 't19');
+INSERT INTO notes VALUES (2624, 368, 't32');
+INSERT INTO notes VALUES (2625, 375, 't45');
+INSERT INTO notes VALUES (2626, 382, 't58');
+INSERT INTO notes VALUES (2627, 389, 't11');
+INSERT INTO notes VALUES (2628, 396, 't24');
+INSERT INTO notes VALUES (2629, 403, 't37');
+INSERT INTO notes VALUES (2630, 410, 't50');
+INSERT INTO notes VALUES (2631, 417, 't3');
+INSERT INTO notes VALUES (2632, 424, 't16');
+INSERT INTO notes VALUES (2633, 431, 't29');
+INSERT INTO notes VALUES (2634, 438, 't42');
+INSERT INTO notes VALUES (2635, 445, 't55');
+INSERT INTO notes VALUES (2636, 452, 't8');
+INSERT INTO notes VALUES (2637, 459, 't21');
+INSERT INTO notes VALUES (2638, 466, 't34');
+INSERT INTO notes VALUES (2639, 473, 't47');
+INSERT INTO notes VALUES (2640, 480, 't0');
+INSERT INTO notes VALUES (2641, 487, 't13');
+INSERT INTO notes VALUES (2642, 494, 't26');
+INSERT INTO notes VALUES (2643, 501, 't39');
+INSERT INTO notes VALUES (2644, 508, 't52');
+INSERT INTO notes VALUES (2645, 515, 't5');
+INSERT INTO notes VALUES (2646, 522, 't18');
+INSERT INTO notes VALUES (2647, 529, 't31');
+INSERT INTO notes VALUES (2648, 536, 't44');
+INSERT INTO notes VALUES (2649, 543, 't57');
+INSERT INTO notes VALUES (2650, 550, 't10');
+INSERT INTO notes VALUES (2651, 557, 't23');
+INSERT INTO notes VALUES (2652, 564, 't36');
+INSERT INTO notes VALUES (2653, 571, 't49');
+INSERT INTO notes VALUES (2654, 578, 't2');
+INSERT INTO notes VALUES (2655, 585, 't15');
+INSERT INTO notes VALUES (2656, 592, 't28');
+INSERT INTO notes VALUES (2657, 599, 't41');
+INSERT INTO notes VALUES (2658, 606, 't54');
+INSERT INTO notes VALUES (2659, 613, 't7');
+INSERT INTO notes VALUES (2660, 620, 't20');
+INSERT INTO notes VALUES (2661, 627, 't33');
+INSERT INTO notes VALUES (2662, 634, 't46');
+INSERT INTO notes VALUES (2663, 641, 't59');
+INSERT INTO notes VALUES (2664, 648, 't12');
+INSERT INTO notes VALUES (2665, 655, 't25');
+INSERT INTO notes VALUES (2666, 662, 't38');
+INSERT INTO notes VALUES (2667, 669, 't51');
+INSERT INTO notes VALUES (2668, 676, 't4');
+INSERT INTO notes VALUES (2669, 683, 't17');
+INSERT INTO notes VALUES (2670, 690, 't30');
+INSERT INTO notes VALUES (2671, 697, 't43');
+INSERT INTO notes VALUES (2672, 704, 't56');
+INSERT INTO notes VALUES (2673, 711, 't9');
+INSERT INTO notes VALUES (2674, 718, 't22');
+INSERT INTO notes VALUES (2675, 725, 't35');
+INSERT INTO notes VALUES (2676, 732, 't48');
+INSERT INTO notes VALUES (2677, 739, 't1');
+INSERT INTO notes VALUES (2678, 746, 't14');
+INSERT INTO notes VALUES (2679, 753, 't27');
+INSERT INTO notes VALUES (2680, 760, 't40');
+INSERT INTO notes VALUES (2681, 767, 't53');
+INSERT INTO notes VALUES (2682, 774, 't6');
+INSERT INTO notes VALUES (2683, 781, 't19');
+INSERT INTO notes VALUES (2684, 788, 't32');
+INSERT INTO notes VALUES (2685, 795, 't45');
+INSERT INTO notes VALUES (2686, 802, 't58');
+INSERT INTO notes VALUES (2687, 809, 't11');
+INSERT INTO notes VALUES (2688, 816, 't24');
+INSERT INTO notes VALUES (2689, 823, 't37');
+INSERT INTO notes VALUES (2690, 830, 't50');
+INSERT INTO notes VALUES (2691, 837, 't3');
+INSERT INTO notes VALUES (2692, 844, 't16');
+INSERT INTO notes VALUES (2693, 851, 't29');
+INSERT INTO notes VALUES (2694, 858, 't42');
+INSERT INTO notes VALUES (2695, 865, 't55');
+INSERT INTO notes VALUES (2696, 872, 't8');
+INSERT INTO notes VALUES (2697, 879, 't21');
+INSERT INTO notes VALUES (2698, 886, 't34');
+INSERT INTO notes VALUES (2699, 893, 't47');
+INSERT INTO notes VALUES (2700, 900, 't0');
+INSERT INTO notes VALUES (2701, 907, 't13');
+INSERT INTO notes VALUES (2702, 914, 't26');
+INSERT INTO notes VALUES (2703, 921, 't39');
+INSERT INTO notes VALUES (2704, 928, 't52');
+INSERT INTO notes VALUES (2705, 935, 't5');
+INSERT INTO notes VALUES (2706, 942, 't18');
+INSERT INTO notes VALUES (2707, 949, 't31');
+INSERT INTO notes VALUES (2708, 956, 't44');
+INSERT INTO notes VALUES (2709, 963, 't57');
+INSERT INTO notes VALUES (2710, 970, 't10');
+INSERT INTO notes VALUES (2711, 977, 't23');
+INSERT INTO notes VALUES (2712, 984, 't36');
+INSERT INTO notes VALUES (2713, 991, 't49');
+INSERT INTO notes VALUES (2714, 998, 't2');
+INSERT INTO notes VALUES (2715, 1005, 't15');
+INSERT INTO notes VALUES (2716, 1012, 't28');
+INSERT INTO notes VALUES (2717, 1019, 't41');
+INSERT INTO notes VALUES (2718, 1026, 't54');
+INSERT INTO notes VALUES (2719, 1033, 't7');
+INSERT INTO notes VALUES (2720, 1040, 't20');
+INSERT INTO notes VALUES (2721, 1047, 't33');
+INSERT INTO notes VALUES (2722, 1054, 't46');
+INSERT INTO notes VALUES (2723, 1061, 't59');
+INSERT INTO notes VALUES (2724, 1068, 't12');
+INSERT INTO notes VALUES (2725, 1075, 't25');
+INSERT INTO notes VALUES (2726, 1082, 't38');
+INSERT INTO notes VALUES (2727, 1089, 't51');
+INSERT INTO notes VALUES (2728, 1096, 't4');
+INSERT INTO notes VALUES (2729, 1103, 't17');
+INSERT INTO notes VALUES (2730, 1110, 't30');
+INSERT INTO notes VALUES (2731, 1117, 't43');
+INSERT INTO notes VALUES (2732, 1124, 't56');
+INSERT INTO notes VALUES (2733, 1131, 't9');
+INSERT INTO notes VALUES (2734, 1138, 't22');
+INSERT INTO notes VALUES (2735, 1145, 't35');
+INSERT INTO notes VALUES (2736, 1152, 't48');
+INSERT INTO notes VALUES (2737, 1159, 't1');
+INSERT INTO notes VALUES (2738, 1166, 't14');
+INSERT INTO notes VALUES (2739, 1173, 't27');
+INSERT INTO notes VALUES (2740, 1180, 't40');
+INSERT INTO notes VALUES (2741, 1187, 't53');
+INSERT INTO notes VALUES (2742, 1194, 't6');
+INSERT INTO notes VALUES (2743, 1201, 't19');
+INSERT INTO notes VALUES (2744, 1208, 't32');
+INSERT INTO notes VALUES (2745, 1215, 't45');
+INSERT INTO notes VALUES (2746, 1222, 't58');
+INSERT INTO notes VALUES (2747, 1229, 't11');
+INSERT INTO notes VALUES (2748, 1236, 't24');
+INSERT INTO notes VALUES (2749, 1243, 't37');
+INSERT INTO notes VALUES (2750, 1250, 't50');
+INSERT INTO notes VALUES (2751, 1257, 't3');
+INSERT INTO notes VALUES (2752, 1264, 't16');
+INSERT INTO notes VALUES (2753, 1271, 't29');
+INSERT INTO notes VALUES (2754, 1278, 't42');
+INSERT INTO notes VALUES (2755, 1285, 't55');
+INSERT INTO notes VALUES (2756, 1292, 't8');
+INSERT INTO notes VALUES (2757, 1299, 't21');
+INSERT INTO notes VALUES (2758, 1306, 't34');
+INSERT INTO notes VALUES (2759, 1313, 't47');
+INSERT INTO notes VALUES (2760, 1320, 't0');
+INSERT INTO notes VALUES (2761, 1327, 't13');
+INSERT INTO notes VALUES (2762, 1334, 't26');
+INSERT INTO notes VALUES (2763, 1341, 't39');
+INSERT INTO notes VALUES (2764, 1348, 't52');
+INSERT INTO notes VALUES (2765, 1355, 't5');
+INSERT INTO notes VALUES (2766, 1362, 't18');
+INSERT INTO notes VALUES (2767, 1369, 't31');
+INSERT INTO notes VALUES (2768, 1376, 't44');
+INSERT INTO notes VALUES (2769, 1383, 't57');
+INSERT INTO notes VALUES (2770, 1390, 't10');
+INSERT INTO notes VALUES (2771, 1397, 't23');
+INSERT INTO notes VALUES (2772, 1404, 't36');
+INSERT INTO notes VALUES (2773, 1411, 't49');
+INSERT INTO notes VALUES (2774, 1418, 't2');
+INSERT INTO notes VALUES (2775, 1425, 't15');
+INSERT INTO notes VALUES (2776, 1432, 't28');
+INSERT INTO notes VALUES (2777, 1439, 't41');
+INSERT INTO notes VALUES (2778, 1446, 't54');
+INSERT INTO notes VALUES (2779, 1453, 't7');
+INSERT INTO notes VALUES (2780, 1460, 't20');
+INSERT INTO notes VALUES (2781, 1467, 't33');
+INSERT INTO notes VALUES (2782, 1474, 't46');
+INSERT INTO notes VALUES (2783, 1481, 't59');
+INSERT INTO notes VALUES (2784, 1488, 't12');
+INSERT INTO notes VALUES (2785, 1495, 't25');
+INSERT INTO notes VALUES (2786, 1502, 't38');
+INSERT INTO notes VALUES (2787, 1509, 't51');
+INSERT INTO notes VALUES (2788, 1516, 't4');
+INSERT INTO notes VALUES (2789, 1523, 't17');
+INSERT INTO notes VALUES (2790, 1530, 't30');
+INSERT INTO notes VALUES (2791, 1537, 't43');
+INSERT INTO notes VALUES (2792, 1544, 't56');
+INSERT INTO notes VALUES (2793, 1551, 't9');
+INSERT INTO notes VALUES (2794, 1558, 't22');
+INSERT INTO notes VALUES (2795, 1565, 't35');
+INSERT INTO notes VALUES (2796, 1572, 't48');
+INSERT INTO notes VALUES (2797, 1579, 't1');
+INSERT INTO notes VALUES (2798, 1586, 't14');
+INSERT INTO notes VALUES (2799, 1593, 't27');
+INSERT INTO notes VALUES (2800, 1600, 't40');
+INSERT INTO notes VALUES (2801, 1607, 't53');
+INSERT INTO notes VALUES (2802, 1614, 't6');
+INSERT INTO notes VALUES (2803, 1621, 't19');
+INSERT INTO notes VALUES (2804, 1628, 't32');
+INSERT INTO notes VALUES (2805, 1635, 't45');
+INSERT INTO notes VALUES (2806, 1642, 't58');
+INSERT INTO notes VALUES (2807, 1649, 't11');
+INSERT INTO notes VALUES (2808, 1656, 't24');
+INSERT INTO notes VALUES (2809, 1663, 't37');
+INSERT INTO notes VALUES (2810, 1670, 't50');
+INSERT INTO notes VALUES (2811, 1677, 't3');
+INSERT INTO notes VALUES (2812, 1684, 't16');
+INSERT INTO notes VALUES (2813, 1691, 't29');
+INSERT INTO notes VALUES (2814, 1698, 't42');
+INSERT INTO notes VALUES (2815, 1705, 't55');
+INSERT INTO notes VALUES (2816, 1712, 't8');
+INSERT INTO notes VALUES (2817, 1719, 't21');
+INSERT INTO notes VALUES (2818, 1726, 't34');
+INSERT INTO notes VALUES (2819, 1733, 't47');
+INSERT INTO notes VALUES (2820, 1740, 't0');
+INSERT INTO notes VALUES (2821, 1747, 't13');
+INSERT INTO notes VALUES (2822, 1754, 't26');
+INSERT INTO notes VALUES (2823, 1761, 't39');
+INSERT INTO notes VALUES (2824, 1768, 't52');
+INSERT INTO notes VALUES (2825, 1775, 't5');
+INSERT INTO notes VALUES (2826, 1782, 't18');
+INSERT INTO notes VALUES (2827, 1789, 't31');
+INSERT INTO notes VALUES (2828, 1796, 't44');
+INSERT INTO notes VALUES (2829, 1803, 't57');
+INSERT INTO notes VALUES (2830, 1810, 't10');
+INSERT INTO notes VALUES (2831, 1817, 't23');
+INSERT INTO notes VALUES (2832, 1824, 't36');
+INSERT INTO notes VALUES (2833, 1831, 't49');
+INSERT INTO notes VALUES (2834, 1838, 't2');
+INSERT INTO notes VALUES (2835, 1845, 't15');
+INSERT INTO notes VALUES (2836, 1852, 't28');
+INSERT INTO notes VALUES (2837, 1859, 't41');
+INSERT INTO notes VALUES (2838, 1866, 't54');
+INSERT INTO notes VALUES (2839, 1873, 't7');
+INSERT INTO notes VALUES (2840, 1880, 't20');
+INSERT INTO notes VALUES (2841, 1887, 't33');
+INSERT INTO notes VALUES (2842, 1894, 't46');
+INSERT INTO notes VALUES (2843, 1901, 't59');
+INSERT INTO notes VALUES (2844, 1908, 't12');
+INSERT INTO notes VALUES (2845, 1915, 't25');
+INSERT INTO notes VALUES (2846, 1922, 't38');
+INSERT INTO notes VALUES (2847, 1929, 't51');
+INSERT INTO notes VALUES (2848, 1936, 't4');
+INSERT INTO notes VALUES (2849, 1943, 't17');
+INSERT INTO notes VALUES (2850, 1950, 't30');
+INSERT INTO notes VALUES (2851, 1957, 't43');
+INSERT INTO notes VALUES (2852, 1964, 't56');
+INSERT INTO notes VALUES (2853, 1971, 't9');
+INSERT INTO notes VALUES (2854, 1978, 't22');
+INSERT INTO notes VALUES (2855, 1985, 't35');
+INSERT INTO notes VALUES (2856, 1992, 't48');
+INSERT INTO notes VALUES (2857, 1999, 't1');
+INSERT INTO notes VALUES (2858, 6, 't14');
+INSERT INTO notes VALUES (2859, 13, 't27');
+INSERT INTO notes VALUES (2860, 20, 't40');
+INSERT INTO notes VALUES (2861, 27, 't53');
+INSERT INTO notes VALUES (2862, 34, 't6');
+INSERT INTO notes VALUES (2863, 41, 't19');
+INSERT INTO notes VALUES (2864, 48, 't32');
+INSERT INTO notes VALUES (2865, 55, 't45');
+INSERT INTO notes VALUES (2866, 62, 't58');
+INSERT INTO notes VALUES (2867, 69, 't11');
+INSERT INTO notes VALUES (2868, 76, 't24');
+INSERT INTO notes VALUES (2869, 83, 't37');
+INSERT INTO notes VALUES (2870, 90, 't50');
+INSERT INTO notes VALUES (2871, 97, 't3');
+INSERT INTO notes VALUES (2872, 104, 't16');
+INSERT INTO notes VALUES (2873, 111, 't29');
+INSERT INTO notes VALUES (2874, 118, 't42');
+INSERT INTO notes VALUES (2875, 125, 't55');
+INSERT INTO notes VALUES (2876, 132, 't8');
+INSERT INTO notes VALUES (2877, 139, 't21');
+INSERT INTO notes VALUES (2878, 146, 't34');
+INSERT INTO notes VALUES (2879, 153, 't47');
+INSERT INTO notes VALUES (2880, 160, 't0');
+INSERT INTO notes VALUES (2881, 167, 't13');
+INSERT INTO notes VALUES (2882, 174, 't26');
+INSERT INTO notes VALUES (2883, 181, 't39');
+INSERT INTO notes VALUES (2884, 188, 't52');
+INSERT INTO notes VALUES (2885, 195, 't5');
+INSERT INTO notes VALUES (2886, 202, 't18');
+INSERT INTO notes VALUES (2887, 209, 't31');
+INSERT INTO notes VALUES (2888, 216, 't44');
+INSERT INTO notes VALUES (2889, 223, 't57');
+INSERT INTO notes VALUES (2890, 230, 't10');
+INSERT INTO notes VALUES (2891, 237, 't23');
+INSERT INTO notes VALUES (2892, 244, 't36');
+INSERT INTO notes VALUES (2893, 251, 't49');
+INSERT INTO notes VALUES (2894, 258, 't2');
+INSERT INTO notes VALUES (2895, 265, 't15');
+INSERT INTO notes VALUES (2896, 272, 't28');
+INSERT INTO notes VALUES (2897, 279, 't41');
+INSERT INTO notes VALUES (2898, 286, 't54');
+INSERT INTO notes VALUES (2899, 293, 't7');
+INSERT INTO notes VALUES (2900, 300, 't20');
+INSERT INTO notes VALUES (2901, 307, 't33');
+INSERT INTO notes VALUES (2902, 314, 't46');
+INSERT INTO notes VALUES (2903, 321, 't59');
+INSERT INTO notes VALUES (2904, 328, 't12');
+INSERT INTO notes VALUES (2905, 335, 't25');
+INSERT INTO notes VALUES (2906, 342, 't38');
+INSERT INTO notes VALUES (2907, 349, 't51');
+INSERT INTO notes VALUES (2908, 356, 't4');
+INSERT INTO notes VALUES (2909, 363, 't17');
+INSERT INTO notes VALUES (2910, 370, 't30');
+INSERT INTO notes VALUES (2911, 377, 't43');
+INSERT INTO notes VALUES (2912, 384, 't56');
+INSERT INTO notes VALUES (2913, 391, 't9');
+INSERT INTO notes VALUES (2914, 398, 't22');
+INSERT INTO notes VALUES (2915, 405, 't35');
+INSERT INTO notes VALUES (2916, 412, 't48');
+INSERT INTO notes VALUES (2917, 419, 't1');
+INSERT INTO notes VALUES (2918, 426, 't14');
+INSERT INTO notes VALUES (2919, 433, 't27');
+INSERT INTO notes VALUES (2920, 440, 't40');
+INSERT INTO notes VALUES (2921, 447, 't53');
+INSERT INTO notes VALUES (2922, 454, 't6');
+INSERT INTO notes VALUES (2923, 461, 't19');
+INSERT INTO notes VALUES (2924, 468, 't32');
+INSERT INTO notes VALUES (2925, 475, 't45');
+INSERT INTO notes VALUES (2926, 482, 't58');
+INSERT INTO notes VALUES (2927, 489, 't11');
+INSERT INTO notes VALUES (2928, 496, 't24');
+INSERT INTO notes VALUES (2929, 503, 't37');
+INSERT INTO notes VALUES (2930, 510, 't50');
+INSERT INTO notes VALUES (2931, 517, 't3');
+INSERT INTO notes VALUES (2932, 524, 't16');
+INSERT INTO notes VALUES (2933, 531, 't29');
+INSERT INTO notes VALUES (2934, 538, 't42');
+INSERT INTO notes VALUES (2935, 545, 't55');
+INSERT INTO notes VALUES (2936, 552, 't8');
+INSERT INTO notes VALUES (2937, 559, 't21');
+INSERT INTO notes VALUES (2938, 566, 't34');
+INSERT INTO notes VALUES (2939, 573, 't47');
+INSERT INTO notes VALUES (2940, 580, 't0');
+INSERT INTO notes VALUES (2941, 587, 't13');
+INSERT INTO notes VALUES (2942, 594, 't26');
+INSERT INTO notes VALUES (2943, 601, 't39');
+INSERT INTO notes VALUES (2944, 608, 't52');
+INSERT INTO notes VALUES (2945, 615, 't5');
+INSERT INTO notes VALUES (2946, 622, 't18');
+INSERT INTO notes VALUES (2947, 629, 't31');
+INSERT INTO notes VALUES (2948, 636, 't44');
+INSERT INTO notes VALUES (2949, 643, 't57');
+INSERT INTO notes VALUES (2950, 650, 't10');
+INSERT INTO notes VALUES (2951, 657, 't23');
+INSERT INTO notes VALUES (2952, 664, 't36');
+INSERT INTO notes VALUES (2953, 671, 't49');
+INSERT INTO notes VALUES (2954, 678, 't2');
+INSERT INTO notes VALUES (2955, 685, 't15');
+INSERT INTO notes VALUES (2956, 692, 't28');
+INSERT INTO notes VALUES (2957, 699, 't41');
+INSERT INTO notes VALUES (2958, 706, 't54');
+INSERT INTO notes VALUES (2959, 713, 't7');
+INSERT INTO notes VALUES (2960, 720, 't20');
+INSERT INTO notes VALUES (2961, 727, 't33');
+INSERT INTO notes VALUES (2962, 734, 't46');
+INSERT INTO notes VALUES (2963, 741, 't59');
+INSERT INTO notes VALUES (2964, 748, 't12');
+INSERT INTO notes VALUES (2965, 755, 't25');
+INSERT INTO notes VALUES (2966, 762, 't38');
+INSERT INTO notes VALUES (2967, 769, 't51');
+INSERT INTO notes VALUES (2968, 776, 't4');
+INSERT INTO notes VALUES (2969, 783, 't17');
+INSERT INTO notes VALUES (2970, 790, 't30');
+INSERT INTO notes VALUES (2971, 797, 't43');
+INSERT INTO notes VALUES (2972, 804, 't56');
+INSERT INTO notes VALUES (2973, 811, 't9');
+INSERT INTO notes VALUES (2974, 818, 't22');
+INSERT INTO notes VALUES (2975, 825, 't35');
+INSERT INTO notes VALUES (2976, 832, 't48');
+INSERT INTO notes VALUES (2977, 839, 't1');
+INSERT INTO notes VALUES (2978, 846, 't14');
+INSERT INTO notes VALUES (2979, 853, 't27');
+INSERT INTO notes VALUES (2980, 860, 't40');
+INSERT INTO notes VALUES (2981, 867, 't53');
+INSERT INTO notes VALUES (2982, 874, 't6');
+INSERT INTO notes VALUES (2983, 881, 't19');
+INSERT INTO notes VALUES (2984, 888, 't32');
+INSERT INTO notes VALUES (2985, 895, 't45');
+INSERT INTO notes VALUES (2986, 902, 't58');
+INSERT INTO notes VALUES (2987, 909, 't11');
+INSERT INTO notes VALUES (2988, 916, 't24');
+INSERT INTO notes VALUES (2989, 923, 't37');
+INSERT INTO notes VALUES (2990, 930, 't50');
+INSERT INTO notes VALUES (2991, 937, 't3');
+INSERT INTO notes VALUES (2992, 944, 't16');
+INSERT INTO notes VALUES (2993, 951, 't29');
+INSERT INTO notes VALUES (2994, 958, 't42');
+INSERT INTO notes VALUES (2995, 965, 't55');
+INSERT INTO notes VALUES (2996, 972, 't8');
+INSERT INTO notes VALUES (2997, 979, 't21');
+INSERT INTO notes VALUES (2998, 986, 't34');
+INSERT INTO notes VALUES (2999, 993, 't47');
+INSERT INTO items VALUES (0, 0.00, 'item0');
+INSERT INTO items VALUES (1, 1.01, 'item1');
+INSERT INTO items VALUES (2, 2.02, 'item2');
+INSERT INTO items VALUES (3, 3.03, 'item3');
+INSERT INTO items VALUES (4, 4.04, 'item4');
+INSERT INTO items VALUES (5, 5.05, 'item5');
+INSERT INTO items VALUES (6, 6.06, 'item6');
+INSERT INTO items VALUES (7, 7.07, 'item7');
+INSERT INTO items VALUES (8, 8.08, 'item8');
+INSERT INTO items VALUES (9, 9.09, 'item9');
+INSERT INTO items VALUES (10, 10.10, 'item10');
+INSERT INTO items VALUES (11, 11.11, 'item11');
+INSERT INTO items VALUES (12, 12.12, 'item12');
+INSERT INTO items VALUES (13, 13.13, 'item13');
+INSERT INTO items VALUES (14, 14.14, 'item14');
+INSERT INTO items VALUES (15, 15.15, 'item15');
+INSERT INTO items VALUES (16, 16.16, 'item16');
+INSERT INTO items VALUES (17, 17.17, 'item17');
+INSERT INTO items VALUES (18, 18.18, 'item18');
+INSERT INTO items VALUES (19, 19.19, 'item19');
+INSERT INTO items VALUES (20, 20.20, 'item20');
+INSERT INTO items VALUES (21, 21.21, 'item21');
+INSERT INTO items VALUES (22, 22.22, 'item22');
+INSERT INTO items VALUES (23, 23.23, 'item23');
+INSERT INTO items VALUES (24, 24.24, 'item24');
+INSERT INTO items VALUES (25, 25.25, 'item25');
+INSERT INTO items VALUES (26, 26.26, 'item26');
+INSERT INTO items VALUES (27, 27.27, 'item27');
+INSERT INTO items VALUES (28, 28.28, 'item28');
+INSERT INTO items VALUES (29, 29.29, 'item29');
+INSERT INTO items VALUES (30, 30.30, 'item30');
+INSERT INTO items VALUES (31, 31.31, 'item31');
+INSERT INTO items VALUES (32, 32.32, 'item32');
+INSERT INTO items VALUES (33, 33.33, 'item33');
+INSERT INTO items VALUES (34, 34.34, 'item34');
+INSERT INTO items VALUES (35, 35.35, 'item35');
+INSERT INTO items VALUES (36, 36.36, 'item36');
+INSERT INTO items VALUES (37, 37.37, 'item37');
+INSERT INTO items VALUES (38, 38.38, 'item38');
+INSERT INTO items VALUES (39, 39.39, 'item39');
+INSERT INTO items VALUES (40, 40.40, 'item40');
+INSERT INTO items VALUES (41, 41.41, 'item41');
+INSERT INTO items VALUES (42, 42.42, 'item42');
+INSERT INTO items VALUES (43, 43.43, 'item43');
+INSERT INTO items VALUES (44, 44.44, 'item44');
+INSERT INTO items VALUES (45, 45.45, 'item45');
+INSERT INTO items VALUES (46, 46.46, 'item46');
+INSERT INTO items VALUES (47, 47.47, 'item47');
+INSERT INTO items VALUES (48, 48.48, 'item48');
+INSERT INTO items VALUES (49, 49.49, 'item49');
+INSERT INTO items VALUES (50, 50.50, 'item50');
+INSERT INTO items VALUES (51, 51.51, 'item51');
+INSERT INTO items VALUES (52, 52.52, 'item52');
+INSERT INTO items VALUES (53, 53.53, 'item53');
+INSERT INTO items VALUES (54, 54.54, 'item54');
+INSERT INTO items VALUES (55, 55.55, 'item55');
+INSERT INTO items VALUES (56, 56.56, 'item56');
+INSERT INTO items VALUES (57, 57.57, 'item57');
+INSERT INTO items VALUES (58, 58.58, 'item58');
+INSERT INTO items VALUES (59, 59.59, 'item59');
+INSERT INTO items VALUES (60, 60.60, 'item60');
+INSERT INTO items VALUES (61, 61.61, 'item61');
+INSERT INTO items VALUES (62, 62.62, 'item62');
+INSERT INTO items VALUES (63, 63.63, 'item63');
+INSERT INTO items VALUES (64, 64.64, 'item64');
+INSERT INTO items VALUES (65, 65.65, 'item65');
+INSERT INTO items VALUES (66, 66.66, 'item66');
+INSERT INTO items VALUES (67, 67.67, 'item67');
+INSERT INTO items VALUES (68, 68.68, 'item68');
+INSERT INTO items VALUES (69, 69.69, 'item69');
+INSERT INTO items VALUES (70, 70.70, 'item70');
+INSERT INTO items VALUES (71, 71.71, 'item71');
+INSERT INTO items VALUES (72, 72.72, 'item72');
+INSERT INTO items VALUES (73, 73.73, 'item73');
+INSERT INTO items VALUES (74, 74.74, 'item74');
+INSERT INTO items VALUES (75, 75.75, 'item75');
+INSERT INTO items VALUES (76, 76.76, 'item76');
+INSERT INTO items VALUES (77, 77.77, 'item77');
+INSERT INTO items VALUES (78, 78.78, 'item78');
+INSERT INTO items VALUES (79, 79.79, 'item79');
+INSERT INTO items VALUES (80, 80.80, 'item80');
+INSERT INTO items VALUES (81, 81.81, 'item81');
+INSERT INTO items VALUES (82, 82.82, 'item82');
+INSERT INTO items VALUES (83, 83.83, 'item83');
+INSERT INTO items VALUES (84, 84.84, 'item84');
+INSERT INTO items VALUES (85, 85.85, 'item85');
+INSERT INTO items VALUES (86, 86.86, 'item86');
+INSERT INTO items VALUES (87, 87.87, 'item87');
+INSERT INTO items VALUES (88, 88.88, 'item88');
+INSERT INTO items VALUES (89, 89.89, 'item89');
+INSERT INTO items VALUES (90, 0.90, 'item90');
+INSERT INTO items VALUES (91, 1.91, 'item91');
+INSERT INTO items VALUES (92, 2.92, 'item92');
+INSERT INTO items VALUES (93, 3.93, 'item93');
+INSERT INTO items VALUES (94, 4.94, 'item94');
+INSERT INTO items VALUES (95, 5.95, 'item95');
+INSERT INTO items VALUES (96, 6.96, 'item96');
+INSERT INTO items VALUES (97, 7.97, 'item97');
+INSERT INTO items VALUES (98, 8.98, 'item98');
+INSERT INTO items VALUES (99, 9.99, 'item99');
+INSERT INTO items VALUES (100, 10.00, 'item100');
+INSERT INTO items VALUES (101, 11.01, 'item101');
+INSERT INTO items VALUES (102, 12.02, 'item102');
+INSERT INTO items VALUES (103, 13.03, 'item103');
+INSERT INTO items VALUES (104, 14.04, 'item104');
+INSERT INTO items VALUES (105, 15.05, 'item105');
+INSERT INTO items VALUES (106, 16.06, 'item106');
+INSERT INTO items VALUES (107, 17.07, 'item107');
+INSERT INTO items VALUES (108, 18.08, 'item108');
+INSERT INTO items VALUES (109, 19.09, 'item109');
+INSERT INTO items VALUES (110, 20.10, 'item110');
+INSERT INTO items VALUES (111, 21.11, 'item111');
+INSERT INTO items VALUES (112, 22.12, 'item112');
+INSERT INTO items VALUES (113, 23.13, 'item113');
+INSERT INTO items VALUES (114, 24.14, 'item114');
+INSERT INTO items VALUES (115, 25.15, 'item115');
+INSERT INTO items VALUES (116, 26.16, 'item116');
+INSERT INTO items VALUES (117, 27.17, 'item117');
+INSERT INTO items VALUES (118, 28.18, 'item118');
+INSERT INTO items VALUES (119, 29.19, 'item119');
+INSERT INTO items VALUES (120, 30.20, 'item120');
+INSERT INTO items VALUES (121, 31.21, 'item121');
+INSERT INTO items VALUES (122, 32.22, 'item122');
+INSERT INTO items VALUES (123, 33.23, 'item123');
+INSERT INTO items VALUES (124, 34.24, 'item124');
+INSERT INTO items VALUES (125, 35.25, 'item125');
+INSERT INTO items VALUES (126, 36.26, 'item126');
+INSERT INTO items VALUES (127, 37.27, 'item127');
+INSERT INTO items VALUES (128, 38.28, 'item128');
+INSERT INTO items VALUES (129, 39.29, 'item129');
+INSERT INTO items VALUES (130, 40.30, 'item130');
+INSERT INTO items VALUES (131, 41.31, 'item131');
+INSERT INTO items VALUES (132, 42.32, 'item132');
+INSERT INTO items VALUES (133, 43.33, 'item133');
+INSERT INTO items VALUES (134, 44.34, 'item134');
+INSERT INTO items VALUES (135, 45.35, 'item135');
+INSERT INTO items VALUES (136, 46.36, 'item136');
+INSERT INTO items VALUES (137, 47.37, 'item137');
+INSERT INTO items VALUES (138, 48.38, 'item138');
+INSERT INTO items VALUES (139, 49.39, 'item139');
+INSERT INTO items VALUES (140, 50.40, 'item140');
+INSERT INTO items VALUES (141, 51.41, 'item141');
+INSERT INTO items VALUES (142, 52.42, 'item142');
+INSERT INTO items VALUES (143, 53.43, 'item143');
+INSERT INTO items VALUES (144, 54.44, 'item144');
+INSERT INTO items VALUES (145, 55.45, 'item145');
+INSERT INTO items VALUES (146, 56.46, 'item146');
+INSERT INTO items VALUES (147, 57.47, 'item147');
+INSERT INTO items VALUES (148, 58.48, 'item148');
+INSERT INTO items VALUES (149, 59.49, 'item149');
+INSERT INTO items VALUES (150, 60.50, 'item150');
+INSERT INTO items VALUES (151, 61.51, 'item151');
+INSERT INTO items VALUES (152, 62.52, 'item152');
+INSERT INTO items VALUES (153, 63.53, 'item153');
+INSERT INTO items VALUES (154, 64.54, 'item154');
+INSERT INTO items VALUES (155, 65.55, 'item155');
+INSERT INTO items VALUES (156, 66.56, 'item156');
+INSERT INTO items VALUES (157, 67.57, 'item157');
+INSERT INTO items VALUES (158, 68.58, 'item158');
+INSERT INTO items VALUES (159, 69.59, 'item159');
+INSERT INTO items VALUES (160, 70.60, 'item160');
+INSERT INTO items VALUES (161, 71.61, 'item161');
+INSERT INTO items VALUES (162, 72.62, 'item162');
+INSERT INTO items VALUES (163, 73.63, 'item163');
+INSERT INTO items VALUES (164, 74.64, 'item164');
+INSERT INTO items VALUES (165, 75.65, 'item165');
+INSERT INTO items VALUES (166, 76.66, 'item166');
+INSERT INTO items VALUES (167, 77.67, 'item167');
+INSERT INTO items VALUES (168, 78.68, 'item168');
+INSERT INTO items VALUES (169, 79.69, 'item169');
+INSERT INTO items VALUES (170, 80.70, 'item170');
+INSERT INTO items VALUES (171, 81.71, 'item171');
+INSERT INTO items VALUES (172, 82.72, 'item172');
+INSERT INTO items VALUES (173, 83.73, 'item173');
+INSERT INTO items VALUES (174, 84.74, 'item174');
+INSERT INTO items VALUES (175, 85.75, 'item175');
+INSERT INTO items VALUES (176, 86.76, 'item176');
+INSERT INTO items VALUES (177, 87.77, 'item177');
+INSERT INTO items VALUES (178, 88.78, 'item178');
+INSERT INTO items VALUES (179, 89.79, 'item179');
+INSERT INTO items VALUES (180, 0.80, 'item180');
+INSERT INTO items VALUES (181, 1.81, 'item181');
+INSERT INTO items VALUES (182, 2.82, 'item182');
+INSERT INTO items VALUES (183, 3.83, 'item183');
+INSERT INTO items VALUES (184, 4.84, 'item184');
+INSERT INTO items VALUES (185, 5.85, 'item185');
+INSERT INTO items VALUES (186, 6.86, 'item186');
+INSERT INTO items VALUES (187, 7.87, 'item187');
+INSERT INTO items VALUES (188, 8.88, 'item188');
+INSERT INTO items VALUES (189, 9.89, 'item189');
+INSERT INTO items VALUES (190, 10.90, 'item190');
+INSERT INTO items VALUES (191, 11.91, 'item191');
+INSERT INTO items VALUES (192, 12.92, 'item192');
+INSERT INTO items VALUES (193, 13.93, 'item193');
+INSERT INTO items VALUES (194, 14.94, 'item194');
+INSERT INTO items VALUES (195, 15.95, 'item195');
+INSERT INTO items VALUES (196, 16.96, 'item196');
+INSERT INTO items VALUES (197, 17.97, 'item197');
+INSERT INTO items VALUES (198, 18.98, 'item198');
+INSERT INTO items VALUES (199, 19.99, 'item199');
+INSERT INTO items VALUES (200, 20.00, 'item200');
+INSERT INTO items VALUES (201, 21.01, 'item201');
+INSERT INTO items VALUES (202, 22.02, 'item202');
+INSERT INTO items VALUES (203, 23.03, 'item203');
+INSERT INTO items VALUES (204, 24.04, 'item204');
+INSERT INTO items VALUES (205, 25.05, 'item205');
+INSERT INTO items VALUES (206, 26.06, 'item206');
+INSERT INTO items VALUES (207, 27.07, 'item207');
+INSERT INTO items VALUES (208, 28.08, 'item208');
+INSERT INTO items VALUES (209, 29.09, 'item209');
+INSERT INTO items VALUES (210, 30.10, 'item210');
+INSERT INTO items VALUES (211, 31.11, 'item211');
+INSERT INTO items VALUES (212, 32.12, 'item212');
+INSERT INTO items VALUES (213, 33.13, 'item213');
+INSERT INTO items VALUES (214, 34.14, 'item214');
+INSERT INTO items VALUES (215, 35.15, 'item215');
+INSERT INTO items VALUES (216, 36.16, 'item216');
+INSERT INTO items VALUES (217, 37.17, 'item217');
+INSERT INTO items VALUES (218, 38.18, 'item218');
+INSERT INTO items VALUES (219, 39.19, 'item219');
+INSERT INTO items VALUES (220, 40.20, 'item220');
+INSERT INTO items VALUES (221, 41.21, 'item221');
+INSERT INTO items VALUES (222, 42.22, 'item222');
+INSERT INTO items VALUES (223, 43.23, 'item223');
+INSERT INTO items VALUES (224, 44.24, 'item224');
+INSERT INTO items VALUES (225, 45.25, 'item225');
+INSERT INTO items VALUES (226, 46.26, 'item226');
+INSERT INTO items VALUES (227, 47.27, 'item227');
+INSERT INTO items VALUES (228, 48.28, 'item228');
+INSERT INTO items VALUES (229, 49.29, 'item229');
+INSERT INTO items VALUES (230, 50.30, 'item230');
+INSERT INTO items VALUES (231, 51.31, 'item231');
+INSERT INTO items VALUES (232, 52.32, 'item232');
+INSERT INTO items VALUES (233, 53.33, 'item233');
+INSERT INTO items VALUES (234, 54.34, 'item234');
+INSERT INTO items VALUES (235, 55.35, 'item235');
+INSERT INTO items VALUES (236, 56.36, 'item236');
+INSERT INTO items VALUES (237, 57.37, 'item237');
+INSERT INTO items VALUES (238, 58.38, 'item238');
+INSERT INTO items VALUES (239, 59.39, 'item239');
+INSERT INTO items VALUES (240, 60.40, 'item240');
+INSERT INTO items VALUES (241, 61.41, 'item241');
+INSERT INTO items VALUES (242, 62.42, 'item242');
+INSERT INTO items VALUES (243, 63.43, 'item243');
+INSERT INTO items VALUES (244, 64.44, 'item244');
+INSERT INTO items VALUES (245, 65.45, 'item245');
+INSERT INTO items VALUES (246, 66.46, 'item246');
+INSERT INTO items VALUES (247, 67.47, 'item247');
+INSERT INTO items VALUES (248, 68.48, 'item248');
+INSERT INTO items VALUES (249, 69.49, 'item249');
+INSERT INTO items VALUES (250, 70.50, 'item250');
+INSERT INTO items VALUES (251, 71.51, 'item251');
+INSERT INTO items VALUES (252, 72.52, 'item252');
+INSERT INTO items VALUES (253, 73.53, 'item253');
+INSERT INTO items VALUES (254, 74.54, 'item254');
+INSERT INTO items VALUES (255, 75.55, 'item255');
+INSERT INTO items VALUES (256, 76.56, 'item256');
+INSERT INTO items VALUES (257, 77.57, 'item257');
+INSERT INTO items VALUES (258, 78.58, 'item258');
+INSERT INTO items VALUES (259, 79.59, 'item259');
+INSERT INTO items VALUES (260, 80.60, 'item260');
+INSERT INTO items VALUES (261, 81.61, 'item261');
+INSERT INTO items VALUES (262, 82.62, 'item262');
+INSERT INTO items VALUES (263, 83.63, 'item263');
+INSERT INTO items VALUES (264, 84.64, 'item264');
+INSERT INTO items VALUES (265, 85.65, 'item265');
+INSERT INTO items VALUES (266, 86.66, 'item266');
+INSERT INTO items VALUES (267, 87.67, 'item267');
+INSERT INTO items VALUES (268, 88.68, 'item268');
+INSERT INTO items VALUES (269, 89.69, 'item269');
+INSERT INTO items VALUES (270, 0.70, 'item270');
+INSERT INTO items VALUES (271, 1.71, 'item271');
+INSERT INTO items VALUES (272, 2.72, 'item272');
+INSERT INTO items VALUES (273, 3.73, 'item273');
+INSERT INTO items VALUES (274, 4.74, 'item274');
+INSERT INTO items VALUES (275, 5.75, 'item275');
+INSERT INTO items VALUES (276, 6.76, 'item276');
+INSERT INTO items VALUES (277, 7.77, 'item277');
+INSERT INTO items VALUES (278, 8.78, 'item278');
+INSERT INTO items VALUES (279, 9.79, 'item279');
+INSERT INTO items VALUES (280, 10.80, 'item280');
+INSERT INTO items VALUES (281, 11.81, 'item281');
+INSERT INTO items VALUES (282, 12.82, 'item282');
+INSERT INTO items VALUES (283, 13.83, 'item283');
+INSERT INTO items VALUES (284, 14.84, 'item284');
+INSERT INTO items VALUES (285, 15.85, 'item285');
+INSERT INTO items VALUES (286, 16.86, 'item286');
+INSERT INTO items VALUES (287, 17.87, 'item287');
+INSERT INTO items VALUES (288, 18.88, 'item288');
+INSERT INTO items VALUES (289, 19.89, 'item289');
+INSERT INTO items VALUES (290, 20.90, 'item290');
+INSERT INTO items VALUES (291, 21.91, 'item291');
+INSERT INTO items VALUES (292, 22.92, 'item292');
+INSERT INTO items VALUES (293, 23.93, 'item293');
+INSERT INTO items VALUES (294, 24.94, 'item294');
+INSERT INTO items VALUES (295, 25.95, 'item295');
+INSERT INTO items VALUES (296, 26.96, 'item296');
+INSERT INTO items VALUES (297, 27.97, 'item297');
+INSERT INTO items VALUES (298, 28.98, 'item298');
+INSERT INTO items VALUES (299, 29.99, 'item299');
+INSERT INTO items VALUES (300, 30.00, 'item300');
+INSERT INTO items VALUES (301, 31.01, 'item301');
+INSERT INTO items VALUES (302, 32.02, 'item302');
+INSERT INTO items VALUES (303, 33.03, 'item303');
+INSERT INTO items VALUES (304, 34.04, 'item304');
+INSERT INTO items VALUES (305, 35.05, 'item305');
+INSERT INTO items VALUES (306, 36.06, 'item306');
+INSERT INTO items VALUES (307, 37.07, 'item307');
+INSERT INTO items VALUES (308, 38.08, 'item308');
+INSERT INTO items VALUES (309, 39.09, 'item309');
+INSERT INTO items VALUES (310, 40.10, 'item310');
+INSERT INTO items VALUES (311, 41.11, 'item311');
+INSERT INTO items VALUES (312, 42.12, 'item312');
+INSERT INTO items VALUES (313, 43.13, 'item313');
+INSERT INTO items VALUES (314, 44.14, 'item314');
+INSERT INTO items VALUES (315, 45.15, 'item315');
+INSERT INTO items VALUES (316, 46.16, 'item316');
+INSERT INTO items VALUES (317, 47.17, 'item317');
+INSERT INTO items VALUES (318, 48.18, 'item318');
+INSERT INTO items VALUES (319, 49.19, 'item319');
+INSERT INTO items VALUES (320, 50.20, 'item320');
+INSERT INTO items VALUES (321, 51.21, 'item321');
+INSERT INTO items VALUES (322, 52.22, 'item322');
+INSERT INTO items VALUES (323, 53.23, 'item323');
+INSERT INTO items VALUES (324, 54.24, 'item324');
+INSERT INTO items VALUES (325, 55.25, 'item325');
+INSERT INTO items VALUES (326, 56.26, 'item326');
+INSERT INTO items VALUES (327, 57.27, 'item327');
+INSERT INTO items VALUES (328, 58.28, 'item328');
+INSERT INTO items VALUES (329, 59.29, 'item329');
+INSERT INTO items VALUES (330, 60.30, 'item330');
+INSERT INTO items VALUES (331, 61.31, 'item331');
+INSERT INTO items VALUES (332, 62.32, 'item332');
+INSERT INTO items VALUES (333, 63.33, 'item333');
+INSERT INTO items VALUES (334, 64.34, 'item334');
+INSERT INTO items VALUES (335, 65.35, 'item335');
+INSERT INTO items VALUES (336, 66.36, 'item336');
+INSERT INTO items VALUES (337, 67.37, 'item337');
+INSERT INTO items VALUES (338, 68.38, 'item338');
+INSERT INTO items VALUES (339, 69.39, 'item339');
+INSERT INTO items VALUES (340, 70.40, 'item340');
+INSERT INTO items VALUES (341, 71.41, 'item341');
+INSERT INTO items VALUES (342, 72.42, 'item342');
+INSERT INTO items VALUES (343, 73.43, 'item343');
+INSERT INTO items VALUES (344, 74.44, 'item344');
+INSERT INTO items VALUES (345, 75.45, 'item345');
+INSERT INTO items VALUES (346, 76.46, 'item346');
+INSERT INTO items VALUES (347, 77.47, 'item347');
+INSERT INTO items VALUES (348, 78.48, 'item348');
+INSERT INTO items VALUES (349, 79.49, 'item349');
+INSERT INTO items VALUES (350, 80.50, 'item350');
+INSERT INTO items VALUES (351, 81.51, 'item351');
+INSERT INTO items VALUES (352, 82.52, 'item352');
+INSERT INTO items VALUES (353, 83.53, 'item353');
+INSERT INTO items VALUES (354, 84.54, 'item354');
+INSERT INTO items VALUES (355, 85.55, 'item355');
+INSERT INTO items VALUES (356, 86.56, 'item356');
+INSERT INTO items VALUES (357, 87.57, 'item357');
+INSERT INTO items VALUES (358, 88.58, 'item358');
+INSERT INTO items VALUES (359, 89.59, 'item359');
+INSERT INTO items VALUES (360, 0.60, 'item360');
+INSERT INTO items VALUES (361, 1.61, 'item361');
+INSERT INTO items VALUES (362, 2.62, 'item362');
+INSERT INTO items VALUES (363, 3.63, 'item363');
+INSERT INTO items VALUES (364, 4.64, 'item364');
+INSERT INTO items VALUES (365, 5.65, 'item365');
+INSERT INTO items VALUES (366, 6.66, 'item366');
+INSERT INTO items VALUES (367, 7.67, 'item367');
+INSERT INTO items VALUES (368, 8.68, 'item368');
+INSERT INTO items VALUES (369, 9.69, 'item369');
+INSERT INTO items VALUES (370, 10.70, 'item370');
+INSERT INTO items VALUES (371, 11.71, 'item371');
+INSERT INTO items VALUES (372, 12.72, 'item372');
+INSERT INTO items VALUES (373, 13.73, 'item373');
+INSERT INTO items VALUES (374, 14.74, 'item374');
+INSERT INTO items VALUES (375, 15.75, 'item375');
+INSERT INTO items VALUES (376, 16.76, 'item376');
+INSERT INTO items VALUES (377, 17.77, 'item377');
+INSERT INTO items VALUES (378, 18.78, 'item378');
+INSERT INTO items VALUES (379, 19.79, 'item379');
+INSERT INTO items VALUES (380, 20.80, 'item380');
+INSERT INTO items VALUES (381, 21.81, 'item381');
+INSERT INTO items VALUES (382, 22.82, 'item382');
+INSERT INTO items VALUES (383, 23.83, 'item383');
+INSERT INTO items VALUES (384, 24.84, 'item384');
+INSERT INTO items VALUES (385, 25.85, 'item385');
+INSERT INTO items VALUES (386, 26.86, 'item386');
+INSERT INTO items VALUES (387, 27.87, 'item387');
+INSERT INTO items VALUES (388, 28.88, 'item388');
+INSERT INTO items VALUES (389, 29.89, 'item389');
+INSERT INTO items VALUES (390, 30.90, 'item390');
+INSERT INTO items VALUES (391, 31.91, 'item391');
+INSERT INTO items VALUES (392, 32.92, 'item392');
+INSERT INTO items VALUES (393, 33.93, 'item393');
+INSERT INTO items VALUES (394, 34.94, 'item394');
+INSERT INTO items VALUES (395, 35.95, 'item395');
+INSERT INTO items VALUES (396, 36.96, 'item396');
+INSERT INTO items VALUES (397, 37.97, 'item397');
+INSERT INTO items VALUES (398, 38.98, 'item398');
+INSERT INTO items VALUES (399, 39.99, 'item399');
+INSERT INTO items VALUES (400, 40.00, 'item400');
+INSERT INTO items VALUES (401, 41.01, 'item401');
+INSERT INTO items VALUES (402, 42.02, 'item402');
+INSERT INTO items VALUES (403, 43.03, 'item403');
+INSERT INTO items VALUES (404, 44.04, 'item404');
+INSERT INTO items VALUES (405, 45.05, 'item405');
+INSERT INTO items VALUES (406, 46.06, 'item406');
+INSERT INTO items VALUES (407, 47.07, 'item407');
+INSERT INTO items VALUES (408, 48.08, 'item408');
+INSERT INTO items VALUES (409, 49.09, 'item409');
+INSERT INTO items VALUES (410, 50.10, 'item410');
+INSERT INTO items VALUES (411, 51.11, 'item411');
+INSERT INTO items VALUES (412, 52.12, 'item412');
+INSERT INTO items VALUES (413, 53.13, 'item413');
+INSERT INTO items VALUES (414, 54.14, 'item414');
+INSERT INTO items VALUES (415, 55.15, 'item415');
+INSERT INTO items VALUES (416, 56.16, 'item416');
+INSERT INTO items VALUES (417, 57.17, 'item417');
+INSERT INTO items VALUES (418, 58.18, 'item418');
+INSERT INTO items VALUES (419, 59.19, 'item419');
+INSERT INTO items VALUES (420, 60.20, 'item420');
+INSERT INTO items VALUES (421, 61.21, 'item421');
+INSERT INTO items VALUES (422, 62.22, 'item422');
+INSERT INTO items VALUES (423, 63.23, 'item423');
+INSERT INTO items VALUES (424, 64.24, 'item424');
+INSERT INTO items VALUES (425, 65.25, 'item425');
+INSERT INTO items VALUES (426, 66.26, 'item426');
+INSERT INTO items VALUES (427, 67.27, 'item427');
+INSERT INTO items VALUES (428, 68.28, 'item428');
+INSERT INTO items VALUES (429, 69.29, 'item429');
+INSERT INTO items VALUES (430, 70.30, 'item430');
+INSERT INTO items VALUES (431, 71.31, 'item431');
+INSERT INTO items VALUES (432, 72.32, 'item432');
+INSERT INTO items VALUES (433, 73.33, 'item433');
+INSERT INTO items VALUES (434, 74.34, 'item434');
+INSERT INTO items VALUES (435, 75.35, 'item435');
+INSERT INTO items VALUES (436, 76.36, 'item436');
+INSERT INTO items VALUES (437, 77.37, 'item437');
+INSERT INTO items VALUES (438, 78.38, 'item438');
+INSERT INTO items VALUES (439, 79.39, 'item439');
+INSERT INTO items VALUES (440, 80.40, 'item440');
+INSERT INTO items VALUES (441, 81.41, 'item441');
+INSERT INTO items VALUES (442, 82.42, 'item442');
+INSERT INTO items VALUES (443, 83.43, 'item443');
+INSERT INTO items VALUES (444, 84.44, 'item444');
+INSERT INTO items VALUES (445, 85.45, 'item445');
+INSERT INTO items VALUES (446, 86.46, 'item446');
+INSERT INTO items VALUES (447, 87.47, 'item447');
+INSERT INTO items VALUES (448, 88.48, 'item448');
+INSERT INTO items VALUES (449, 89.49, 'item449');
+INSERT INTO items VALUES (450, 0.50, 'item450');
+INSERT INTO items VALUES (451, 1.51, 'item451');
+INSERT INTO items VALUES (452, 2.52, 'item452');
+INSERT INTO items VALUES (453, 3.53, 'item453');
+INSERT INTO items VALUES (454, 4.54, 'item454');
+INSERT INTO items VALUES (455, 5.55, 'item455');
+INSERT INTO items VALUES (456, 6.56, 'item456');
+INSERT INTO items VALUES (457, 7.57, 'item457');
+INSERT INTO items VALUES (458, 8.58, 'item458');
+INSERT INTO items VALUES (459, 9.59, 'item459');
+INSERT INTO items VALUES (460, 10.60, 'item460');
+INSERT INTO items VALUES (461, 11.61, 'item461');
+INSERT INTO items VALUES (462, 12.62, 'item462');
+INSERT INTO items VALUES (463, 13.63, 'item463');
+INSERT INTO items VALUES (464, 14.64, 'item464');
+INSERT INTO items VALUES (465, 15.65, 'item465');
+INSERT INTO items VALUES (466, 16.66, 'item466');
+INSERT INTO items VALUES (467, 17.67, 'item467');
+INSERT INTO items VALUES (468, 18.68, 'item468');
+INSERT INTO items VALUES (469, 19.69, 'item469');
+INSERT INTO items VALUES (470, 20.70, 'item470');
+INSERT INTO items VALUES (471, 21.71, 'item471');
+INSERT INTO items VALUES (472, 22.72, 'item472');
+INSERT INTO items VALUES (473, 23.73, 'item473');
+INSERT INTO items VALUES (474, 24.74, 'item474');
+INSERT INTO items VALUES (475, 25.75, 'item475');
+INSERT INTO items VALUES (476, 26.76, 'item476');
+INSERT INTO items VALUES (477, 27.77, 'item477');
+INSERT INTO items VALUES (478, 28.78, 'item478');
+INSERT INTO items VALUES (479, 29.79, 'item479');
+INSERT INTO items VALUES (480, 30.80, 'item480');
+INSERT INTO items VALUES (481, 31.81, 'item481');
+INSERT INTO items VALUES (482, 32.82, 'item482');
+INSERT INTO items VALUES (483, 33.83, 'item483');
+INSERT INTO items VALUES (484, 34.84, 'item484');
+INSERT INTO items VALUES (485, 35.85, 'item485');
+INSERT INTO items VALUES (486, 36.86, 'item486');
+INSERT INTO items VALUES (487, 37.87, 'item487');
+INSERT INTO items VALUES (488, 38.88, 'item488');
+INSERT INTO items VALUES (489, 39.89, 'item489');
+INSERT INTO items VALUES (490, 40.90, 'item490');
+INSERT INTO items VALUES (491, 41.91, 'item491');
+INSERT INTO items VALUES (492, 42.92, 'item492');
+INSERT INTO items VALUES (493, 43.93, 'item493');
+INSERT INTO items VALUES (494, 44.94, 'item494');
+INSERT INTO items VALUES (495, 45.95, 'item495');
+INSERT INTO items VALUES (496, 46.96, 'item496');
+INSERT INTO items VALUES (497, 47.97, 'item497');
+INSERT INTO items VALUES (498, 48.98, 'item498');
+INSERT INTO items VALUES (499, 49.99, 'item499');
+INSERT INTO items VALUES (500, 50.00, 'item500');
+INSERT INTO items VALUES (501, 51.01, 'item501');
+INSERT INTO items VALUES (502, 52.02, 'item502');
+INSERT INTO items VALUES (503, 53.03, 'item503');
+INSERT INTO items VALUES (504, 54.04, 'item504');
+INSERT INTO items VALUES (505, 55.05, 'item505');
+INSERT INTO items VALUES (506, 56.06, 'item506');
+INSERT INTO items VALUES (507, 57.07, 'item507');
+INSERT INTO items VALUES (508, 58.08, 'item508');
+INSERT INTO items VALUES (509, 59.09, 'item509');
+INSERT INTO items VALUES (510, 60.10, 'item510');
+INSERT INTO items VALUES (511, 61.11, 'item511');
+INSERT INTO items VALUES (512, 62.12, 'item512');
+INSERT INTO items VALUES (513, 63.13, 'item513');
+INSERT INTO items VALUES (514, 64.14, 'item514');
+INSERT INTO items VALUES (515, 65.15, 'item515');
+INSERT INTO items VALUES (516, 66.16, 'item516');
+INSERT INTO items VALUES (517, 67.17, 'item517');
+INSERT INTO items VALUES (518, 68.18, 'item518');
+INSERT INTO items VALUES (519, 69.19, 'item519');
+INSERT INTO items VALUES (520, 70.20, 'item520');
+INSERT INTO items VALUES (521, 71.21, 'item521');
+INSERT INTO items VALUES (522, 72.22, 'item522');
+INSERT INTO items VALUES (523, 73.23, 'item523');
+INSERT INTO items VALUES (524, 74.24, 'item524');
+INSERT INTO items VALUES (525, 75.25, 'item525');
+INSERT INTO items VALUES (526, 76.26, 'item526');
+INSERT INTO items VALUES (527, 77.27, 'item527');
+INSERT INTO items VALUES (528, 78.28, 'item528');
+INSERT INTO items VALUES (529, 79.29, 'item529');
+INSERT INTO items VALUES (530, 80.30, 'item530');
+INSERT INTO items VALUES (531, 81.31, 'item531');
+INSERT INTO items VALUES (532, 82.32, 'item532');
+INSERT INTO items VALUES (533, 83.33, 'item533');
+INSERT INTO items VALUES (534, 84.34, 'item534');
+INSERT INTO items VALUES (535, 85.35, 'item535');
+INSERT INTO items VALUES (536, 86.36, 'item536');
+INSERT INTO items VALUES (537, 87.37, 'item537');
+INSERT INTO items VALUES (538, 88.38, 'item538');
+INSERT INTO items VALUES (539, 89.39, 'item539');
+INSERT INTO items VALUES (540, 0.40, 'item540');
+INSERT INTO items VALUES (541, 1.41, 'item541');
+INSERT INTO items VALUES (542, 2.42, 'item542');
+INSERT INTO items VALUES (543, 3.43, 'item543');
+INSERT INTO items VALUES (544, 4.44, 'item544');
+INSERT INTO items VALUES (545, 5.45, 'item545');
+INSERT INTO items VALUES (546, 6.46, 'item546');
+INSERT INTO items VALUES (547, 7.47, 'item547');
+INSERT INTO items VALUES (548, 8.48, 'item548');
+INSERT INTO items VALUES (549, 9.49, 'item549');
+INSERT INTO items VALUES (550, 10.50, 'item550');
+INSERT INTO items VALUES (551, 11.51, 'item551');
+INSERT INTO items VALUES (552, 12.52, 'item552');
+INSERT INTO items VALUES (553, 13.53, 'item553');
+INSERT INTO items VALUES (554, 14.54, 'item554');
+INSERT INTO items VALUES (555, 15.55, 'item555');
+INSERT INTO items VALUES (556, 16.56, 'item556');
+INSERT INTO items VALUES (557, 17.57, 'item557');
+INSERT INTO items VALUES (558, 18.58, 'item558');
+INSERT INTO items VALUES (559, 19.59, 'item559');
+INSERT INTO items VALUES (560, 20.60, 'item560');
+INSERT INTO items VALUES (561, 21.61, 'item561');
+INSERT INTO items VALUES (562, 22.62, 'item562');
+INSERT INTO items VALUES (563, 23.63, 'item563');
+INSERT INTO items VALUES (564, 24.64, 'item564');
+INSERT INTO items VALUES (565, 25.65, 'item565');
+INSERT INTO items VALUES (566, 26.66, 'item566');
+INSERT INTO items VALUES (567, 27.67, 'item567');
+INSERT INTO items VALUES (568, 28.68, 'item568');
+INSERT INTO items VALUES (569, 29.69, 'item569');
+INSERT INTO items VALUES (570, 30.70, 'item570');
+INSERT INTO items VALUES (571, 31.71, 'item571');
+INSERT INTO items VALUES (572, 32.72, 'item572');
+INSERT INTO items VALUES (573, 33.73, 'item573');
+INSERT INTO items VALUES (574, 34.74, 'item574');
+INSERT INTO items VALUES (575, 35.75, 'item575');
+INSERT INTO items VALUES (576, 36.76, 'item576');
+INSERT INTO items VALUES (577, 37.77, 'item577');
+INSERT INTO items VALUES (578, 38.78, 'item578');
+INSERT INTO items VALUES (579, 39.79, 'item579');
+INSERT INTO items VALUES (580, 40.80, 'item580');
+INSERT INTO items VALUES (581, 41.81, 'item581');
+INSERT INTO items VALUES (582, 42.82, 'item582');
+INSERT INTO items VALUES (583, 43.83, 'item583');
+INSERT INTO items VALUES (584, 44.84, 'item584');
+INSERT INTO items VALUES (585, 45.85, 'item585');
+INSERT INTO items VALUES (586, 46.86, 'item586');
+INSERT INTO items VALUES (587, 47.87, 'item587');
+INSERT INTO items VALUES (588, 48.88, 'item588');
+INSERT INTO items VALUES (589, 49.89, 'item589');
+INSERT INTO items VALUES (590, 50.90, 'item590');
+INSERT INTO items VALUES (591, 51.91, 'item591');
+INSERT INTO items VALUES (592, 52.92, 'item592');
+INSERT INTO items VALUES (593, 53.93, 'item593');
+INSERT INTO items VALUES (594, 54.94, 'item594');
+INSERT INTO items VALUES (595, 55.95, 'item595');
+INSERT INTO items VALUES (596, 56.96, 'item596');
+INSERT INTO items VALUES (597, 57.97, 'item597');
+INSERT INTO items VALUES (598, 58.98, 'item598');
+INSERT INTO items VALUES (599, 59.99, 'item599');
+INSERT INTO items VALUES (600, 60.00, 'item600');
+INSERT INTO items VALUES (601, 61.01, 'item601');
+INSERT INTO items VALUES (602, 62.02, 'item602');
+INSERT INTO items VALUES (603, 63.03, 'item603');
+INSERT INTO items VALUES (604, 64.04, 'item604');
+INSERT INTO items VALUES (605, 65.05, 'item605');
+INSERT INTO items VALUES (606, 66.06, 'item606');
+INSERT INTO items VALUES (607, 67.07, 'item607');
+INSERT INTO items VALUES (608, 68.08, 'item608');
+INSERT INTO items VALUES (609, 69.09, 'item609');
+INSERT INTO items VALUES (610, 70.10, 'item610');
+INSERT INTO items VALUES (611, 71.11, 'item611');
+INSERT INTO items VALUES (612, 72.12, 'item612');
+INSERT INTO items VALUES (613, 73.13, 'item613');
+INSERT INTO items VALUES (614, 74.14, 'item614');
+INSERT INTO items VALUES (615, 75.15, 'item615');
+INSERT INTO items VALUES (616, 76.16, 'item616');
+INSERT INTO items VALUES (617, 77.17, 'item617');
+INSERT INTO items VALUES (618, 78.18, 'item618');
+INSERT INTO items VALUES (619, 79.19, 'item619');
+INSERT INTO items VALUES (620, 80.20, 'item620');
+INSERT INTO items VALUES (621, 81.21, 'item621');
+INSERT INTO items VALUES (622, 82.22, 'item622');
+INSERT INTO items VALUES (623, 83.23, 'item623');
+INSERT INTO items VALUES (624, 84.24, 'item624');
+INSERT INTO items VALUES (625, 85.25, 'item625');
+INSERT INTO items VALUES (626, 86.26, 'item626');
+INSERT INTO items VALUES (627, 87.27, 'item627');
+INSERT INTO items VALUES (628, 88.28, 'item628');
+INSERT INTO items VALUES (629, 89.29, 'item629');
+INSERT INTO items VALUES (630, 0.30, 'item630');
+INSERT INTO items VALUES (631, 1.31, 'item631');
+INSERT INTO items VALUES (632, 2.32, 'item632');
+INSERT INTO items VALUES (633, 3.33, 'item633');
+INSERT INTO items VALUES (634, 4.34, 'item634');
+INSERT INTO items VALUES (635, 5.35, 'item635');
+INSERT INTO items VALUES (636, 6.36, 'item636');
+INSERT INTO items VALUES (637, 7.37, 'item637');
+INSERT INTO items VALUES (638, 8.38, 'item638');
+INSERT INTO items VALUES (639, 9.39, 'item639');
+INSERT INTO items VALUES (640, 10.40, 'item640');
+INSERT INTO items VALUES (641, 11.41, 'item641');
+INSERT INTO items VALUES (642, 12.42, 'item642');
+INSERT INTO items VALUES (643, 13.43, 'item643');
+INSERT INTO items VALUES (644, 14.44, 'item644');
+INSERT INTO items VALUES (645, 15.45, 'item645');
+INSERT INTO items VALUES (646, 16.46, 'item646');
+INSERT INTO items VALUES (647, 17.47, 'item647');
+INSERT INTO items VALUES (648, 18.48, 'item648');
+INSERT INTO items VALUES (649, 19.49, 'item649');
+INSERT INTO items VALUES (650, 20.50, 'item650');
+INSERT INTO items VALUES (651, 21.51, 'item651');
+INSERT INTO items VALUES (652, 22.52, 'item652');
+INSERT INTO items VALUES (653, 23.53, 'item653');
+INSERT INTO items VALUES (654, 24.54, 'item654');
+INSERT INTO items VALUES (655, 25.55, 'item655');
+INSERT INTO items VALUES (656, 26.56, 'item656');
+INSERT INTO items VALUES (657, 27.57, 'item657');
+INSERT INTO items VALUES (658, 28.58, 'item658');
+INSERT INTO items VALUES (659, 29.59, 'item659');
+INSERT INTO items VALUES (660, 30.60, 'item660');
+INSERT INTO items VALUES (661, 31.61, 'item661');
+INSERT INTO items VALUES (662, 32.62, 'item662');
+INSERT INTO items VALUES (663, 33.63, 'item663');
+INSERT INTO items VALUES (664, 34.64, 'item664');
+INSERT INTO items VALUES (665, 35.65, 'item665');
+INSERT INTO items VALUES (666, 36.66, 'item666');
+INSERT INTO items VALUES (667, 37.67, 'item667');
+INSERT INTO items VALUES (668, 38.68, 'item668');
+INSERT INTO items VALUES (669, 39.69, 'item669');
+INSERT INTO items VALUES (670, 40.70, 'item670');
+INSERT INTO items VALUES (671, 41.71, 'item671');
+INSERT INTO items VALUES (672, 42.72, 'item672');
+INSERT INTO items VALUES (673, 43.73, 'item673');
+INSERT INTO items VALUES (674, 44.74, 'item674');
+INSERT INTO items VALUES (675, 45.75, 'item675');
+INSERT INTO items VALUES (676, 46.76, 'item676');
+INSERT INTO items VALUES (677, 47.77, 'item677');
+INSERT INTO items VALUES (678, 48.78, 'item678');
+INSERT INTO items VALUES (679, 49.79, 'item679');
+INSERT INTO items VALUES (680, 50.80, 'item680');
+INSERT INTO items VALUES (681, 51.81, 'item681');
+INSERT INTO items VALUES (682, 52.82, 'item682');
+INSERT INTO items VALUES (683, 53.83, 'item683');
+INSERT INTO items VALUES (684, 54.84, 'item684');
+INSERT INTO items VALUES (685, 55.85, 'item685');
+INSERT INTO items VALUES (686, 56.86, 'item686');
+INSERT INTO items VALUES (687, 57.87, 'item687');
+INSERT INTO items VALUES (688, 58.88, 'item688');
+INSERT INTO items VALUES (689, 59.89, 'item689');
+INSERT INTO items VALUES (690, 60.90, 'item690');
+INSERT INTO items VALUES (691, 61.91, 'item691');
+INSERT INTO items VALUES (692, 62.92, 'item692');
+INSERT INTO items VALUES (693, 63.93, 'item693');
+INSERT INTO items VALUES (694, 64.94, 'item694');
+INSERT INTO items VALUES (695, 65.95, 'item695');
+INSERT INTO items VALUES (696, 66.96, 'item696');
+INSERT INTO items VALUES (697, 67.97, 'item697');
+INSERT INTO items VALUES (698, 68.98, 'item698');
+INSERT INTO items VALUES (699, 69.99, 'item699');
+INSERT INTO items VALUES (700, 70.00, 'item700');
+INSERT INTO items VALUES (701, 71.01, 'item701');
+INSERT INTO items VALUES (702, 72.02, 'item702');
+INSERT INTO items VALUES (703, 73.03, 'item703');
+INSERT INTO items VALUES (704, 74.04, 'item704');
+INSERT INTO items VALUES (705, 75.05, 'item705');
+INSERT INTO items VALUES (706, 76.06, 'item706');
+INSERT INTO items VALUES (707, 77.07, 'item707');
+INSERT INTO items VALUES (708, 78.08, 'item708');
+INSERT INTO items VALUES (709, 79.09, 'item709');
+INSERT INTO items VALUES (710, 80.10, 'item710');
+INSERT INTO items VALUES (711, 81.11, 'item711');
+INSERT INTO items VALUES (712, 82.12, 'item712');
+INSERT INTO items VALUES (713, 83.13, 'item713');
+INSERT INTO items VALUES (714, 84.14, 'item714');
+INSERT INTO items VALUES (715, 85.15, 'item715');
+INSERT INTO items VALUES (716, 86.16, 'item716');
+INSERT INTO items VALUES (717, 87.17, 'item717');
+INSERT INTO items VALUES (718, 88.18, 'item718');
+INSERT INTO items VALUES (719, 89.19, 'item719');
+INSERT INTO items VALUES (720, 0.20, 'item720');
+INSERT INTO items VALUES (721, 1.21, 'item721');
+INSERT INTO items VALUES (722, 2.22, 'item722');
+INSERT INTO items VALUES (723, 3.23, 'item723');
+INSERT INTO items VALUES (724, 4.24, 'item724');
+INSERT INTO items VALUES (725, 5.25, 'item725');
+INSERT INTO items VALUES (726, 6.26, 'item726');
+INSERT INTO items VALUES (727, 7.27, 'item727');
+INSERT INTO items VALUES (728, 8.28, 'item728');
+INSERT INTO items VALUES (729, 9.29, 'item729');
+INSERT INTO items VALUES (730, 10.30, 'item730');
+INSERT INTO items VALUES (731, 11.31, 'item731');
+INSERT INTO items VALUES (732, 12.32, 'item732');
+INSERT INTO items VALUES (733, 13.33, 'item733');
+INSERT INTO items VALUES (734, 14.34, 'item734');
+INSERT INTO items VALUES (735, 15.35, 'item735');
+INSERT INTO items VALUES (736, 16.36, 'item736');
+INSERT INTO items VALUES (737, 17.37, 'item737');
+INSERT INTO items VALUES (738, 18.38, 'item738');
+INSERT INTO items VALUES (739, 19.39, 'item739');
+INSERT INTO items VALUES (740, 20.40, 'item740');
+INSERT INTO items VALUES (741, 21.41, 'item741');
+INSERT INTO items VALUES (742, 22.42, 'item742');
+INSERT INTO items VALUES (743, 23.43, 'item743');
+INSERT INTO items VALUES (744, 24.44, 'item744');
+INSERT INTO items VALUES (745, 25.45, 'item745');
+INSERT INTO items VALUES (746, 26.46, 'item746');
+INSERT INTO items VALUES (747, 27.47, 'item747');
+INSERT INTO items VALUES (748, 28.48, 'item748');
+INSERT INTO items VALUES (749, 29.49, 'item749');
+INSERT INTO items VALUES (750, 30.50, 'item750');
+INSERT INTO items VALUES (751, 31.51, 'item751');
+INSERT INTO items VALUES (752, 32.52, 'item752');
+INSERT INTO items VALUES (753, 33.53, 'item753');
+INSERT INTO items VALUES (754, 34.54, 'item754');
+INSERT INTO items VALUES (755, 35.55, 'item755');
+INSERT INTO items VALUES (756, 36.56, 'item756');
+INSERT INTO items VALUES (757, 37.57, 'item757');
+INSERT INTO items VALUES (758, 38.58, 'item758');
+INSERT INTO items VALUES (759, 39.59, 'item759');
+INSERT INTO items VALUES (760, 40.60, 'item760');
+INSERT INTO items VALUES (761, 41.61, 'item761');
+INSERT INTO items VALUES (762, 42.62, 'item762');
+INSERT INTO items VALUES (763, 43.63, 'item763');
+INSERT INTO items VALUES (764, 44.64, 'item764');
+INSERT INTO items VALUES (765, 45.65, 'item765');
+INSERT INTO items VALUES (766, 46.66, 'item766');
+INSERT INTO items VALUES (767, 47.67, 'item767');
+INSERT INTO items VALUES (768, 48.68, 'item768');
+INSERT INTO items VALUES (769, 49.69, 'item769');
+INSERT INTO items VALUES (770, 50.70, 'item770');
+INSERT INTO items VALUES (771, 51.71, 'item771');
+INSERT INTO items VALUES (772, 52.72, 'item772');
+INSERT INTO items VALUES (773, 53.73, 'item773');
+INSERT INTO items VALUES (774, 54.74, 'item774');
+INSERT INTO items VALUES (775, 55.75, 'item775');
+INSERT INTO items VALUES (776, 56.76, 'item776');
+INSERT INTO items VALUES (777, 57.77, 'item777');
+INSERT INTO items VALUES (778, 58.78, 'item778');
+INSERT INTO items VALUES (779, 59.79, 'item779');
+INSERT INTO items VALUES (780, 60.80, 'item780');
+INSERT INTO items VALUES (781, 61.81, 'item781');
+INSERT INTO items VALUES (782, 62.82, 'item782');
+INSERT INTO items VALUES (783, 63.83, 'item783');
+INSERT INTO items VALUES (784, 64.84, 'item784');
+INSERT INTO items VALUES (785, 65.85, 'item785');
+INSERT INTO items VALUES (786, 66.86, 'item786');
+INSERT INTO items VALUES (787, 67.87, 'item787');
+INSERT INTO items VALUES (788, 68.88, 'item788');
+INSERT INTO items VALUES (789, 69.89, 'item789');
+INSERT INTO items VALUES (790, 70.90, 'item790');
+INSERT INTO items VALUES (791, 71.91, 'item791');
+INSERT INTO items VALUES (792, 72.92, 'item792');
+INSERT INTO items VALUES (793, 73.93, 'item793');
+INSERT INTO items VALUES (794, 74.94, 'item794');
+INSERT INTO items VALUES (795, 75.95, 'item795');
+INSERT INTO items VALUES (796, 76.96, 'item796');
+INSERT INTO items VALUES (797, 77.97, 'item797');
+INSERT INTO items VALUES (798, 78.98, 'item798');
+INSERT INTO items VALUES (799, 79.99, 'item799');
+INSERT INTO items VALUES (800, 80.00, 'item800');
+INSERT INTO items VALUES (801, 81.01, 'item801');
+INSERT INTO items VALUES (802, 82.02, 'item802');
+INSERT INTO items VALUES (803, 83.03, 'item803');
+INSERT INTO items VALUES (804, 84.04, 'item804');
+INSERT INTO items VALUES (805, 85.05, 'item805');
+INSERT INTO items VALUES (806, 86.06, 'item806');
+INSERT INTO items VALUES (807, 87.07, 'item807');
+INSERT INTO items VALUES (808, 88.08, 'item808');
+INSERT INTO items VALUES (809, 89.09, 'item809');
+INSERT INTO items VALUES (810, 0.10, 'item810');
+INSERT INTO items VALUES (811, 1.11, 'item811');
+INSERT INTO items VALUES (812, 2.12, 'item812');
+INSERT INTO items VALUES (813, 3.13, 'item813');
+INSERT INTO items VALUES (814, 4.14, 'item814');
+INSERT INTO items VALUES (815, 5.15, 'item815');
+INSERT INTO items VALUES (816, 6.16, 'item816');
+INSERT INTO items VALUES (817, 7.17, 'item817');
+INSERT INTO items VALUES (818, 8.18, 'item818');
+INSERT INTO items VALUES (819, 9.19, 'item819');
+INSERT INTO items VALUES (820, 10.20, 'item820');
+INSERT INTO items VALUES (821, 11.21, 'item821');
+INSERT INTO items VALUES (822, 12.22, 'item822');
+INSERT INTO items VALUES (823, 13.23, 'item823');
+INSERT INTO items VALUES (824, 14.24, 'item824');
+INSERT INTO items VALUES (825, 15.25, 'item825');
+INSERT INTO items VALUES (826, 16.26, 'item826');
+INSERT INTO items VALUES (827, 17.27, 'item827');
+INSERT INTO items VALUES (828, 18.28, 'item828');
+INSERT INTO items VALUES (829, 19.29, 'item829');
+INSERT INTO items VALUES (830, 20.30, 'item830');
+INSERT INTO items VALUES (831, 21.31, 'item831');
+INSERT INTO items VALUES (832, 22.32, 'item832');
+INSERT INTO items VALUES (833, 23.33, 'item833');
+INSERT INTO items VALUES (834, 24.34, 'item834');
+INSERT INTO items VALUES (835, 25.35, 'item835');
+INSERT INTO items VALUES (836, 26.36, 'item836');
+INSERT INTO items VALUES (837, 27.37, 'item837');
+INSERT INTO items VALUES (838, 28.38, 'item838');
+INSERT INTO items VALUES (839, 29.39, 'item839');
+INSERT INTO items VALUES (840, 30.40, 'item840');
+INSERT INTO items VALUES (841, 31.41, 'item841');
+INSERT INTO items VALUES (842, 32.42, 'item842');
+INSERT INTO items VALUES (843, 33.43, 'item843');
+INSERT INTO items VALUES (844, 34.44, 'item844');
+INSERT INTO items VALUES (845, 35.45, 'item845');
+INSERT INTO items VALUES (846, 36.46, 'item846');
+INSERT INTO items VALUES (847, 37.47, 'item847');
+INSERT INTO items VALUES (848, 38.48, 'item848');
+INSERT INTO items VALUES (849, 39.49, 'item849');
+INSERT INTO items VALUES (850, 40.50, 'item850');
+INSERT INTO items VALUES (851, 41.51, 'item851');
+INSERT INTO items VALUES (852, 42.52, 'item852');
+INSERT INTO items VALUES (853, 43.53, 'item853');
+INSERT INTO items VALUES (854, 44.54, 'item854');
+INSERT INTO items VALUES (855, 45.55, 'item855');
+INSERT INTO items VALUES (856, 46.56, 'item856');
+INSERT INTO items VALUES (857, 47.57, 'item857');
+INSERT INTO items VALUES (858, 48.58, 'item858');
+INSERT INTO items VALUES (859, 49.59, 'item859');
+INSERT INTO items VALUES (860, 50.60, 'item860');
+INSERT INTO items VALUES (861, 51.61, 'item861');
+INSERT INTO items VALUES (862, 52.62, 'item862');
+INSERT INTO items VALUES (863, 53.63, 'item863');
+INSERT INTO items VALUES (864, 54.64, 'item864');
+INSERT INTO items VALUES (865, 55.65, 'item865');
+INSERT INTO items VALUES (866, 56.66, 'item866');
+INSERT INTO items VALUES (867, 57.67, 'item867');
+INSERT INTO items VALUES (868, 58.68, 'item868');
+INSERT INTO items VALUES (869, 59.69, 'item869');
+INSERT INTO items VALUES (870, 60.70, 'item870');
+INSERT INTO items VALUES (871, 61.71, 'item871');
+INSERT INTO items VALUES (872, 62.72, 'item872');
+INSERT INTO items VALUES (873, 63.73, 'item873');
+INSERT INTO items VALUES (874, 64.74, 'item874');
+INSERT INTO items VALUES (875, 65.75, 'item875');
+INSERT INTO items VALUES (876, 66.76, 'item876');
+INSERT INTO items VALUES (877, 67.77, 'item877');
+INSERT INTO items VALUES (878, 68.78, 'item878');
+INSERT INTO items VALUES (879, 69.79, 'item879');
+INSERT INTO items VALUES (880, 70.80, 'item880');
+INSERT INTO items VALUES (881, 71.81, 'item881');
+INSERT INTO items VALUES (882, 72.82, 'item882');
+INSERT INTO items VALUES (883, 73.83, 'item883');
+INSERT INTO items VALUES (884, 74.84, 'item884');
+INSERT INTO items VALUES (885, 75.85, 'item885');
+INSERT INTO items VALUES (886, 76.86, 'item886');
+INSERT INTO items VALUES (887, 77.87, 'item887');
+INSERT INTO items VALUES (888, 78.88, 'item888');
+INSERT INTO items VALUES (889, 79.89, 'item889');
+INSERT INTO items VALUES (890, 80.90, 'item890');
+INSERT INTO items VALUES (891, 81.91, 'item891');
+INSERT INTO items VALUES (892, 82.92, 'item892');
+INSERT INTO items VALUES (893, 83.93, 'item893');
+INSERT INTO items VALUES (894, 84.94, 'item894');
+INSERT INTO items VALUES (895, 85.95, 'item895');
+INSERT INTO items VALUES (896, 86.96, 'item896');
+INSERT INTO items VALUES (897, 87.97, 'item897');
+INSERT INTO items VALUES (898, 88.98, 'item898');
+INSERT INTO items VALUES (899, 89.99, 'item899');
+INSERT INTO items VALUES (900, 0.00, 'item900');
+INSERT INTO items VALUES (901, 1.01, 'item901');
+INSERT INTO items VALUES (902, 2.02, 'item902');
+INSERT INTO items VALUES (903, 3.03, 'item903');
+INSERT INTO items VALUES (904, 4.04, 'item904');
+INSERT INTO items VALUES (905, 5.05, 'item905');
+INSERT INTO items VALUES (906, 6.06, 'item906');
+INSERT INTO items VALUES (907, 7.07, 'item907');
+INSERT INTO items VALUES (908, 8.08, 'item908');
+INSERT INTO items VALUES (909, 9.09, 'item909');
+INSERT INTO items VALUES (910, 10.10, 'item910');
+INSERT INTO items VALUES (911, 11.11, 'item911');
+INSERT INTO items VALUES (912, 12.12, 'item912');
+INSERT INTO items VALUES (913, 13.13, 'item913');
+INSERT INTO items VALUES (914, 14.14, 'item914');
+INSERT INTO items VALUES (915, 15.15, 'item915');
+INSERT INTO items VALUES (916, 16.16, 'item916');
+INSERT INTO items VALUES (917, 17.17, 'item917');
+INSERT INTO items VALUES (918, 18.18, 'item918');
+INSERT INTO items VALUES (919, 19.19, 'item919');
+INSERT INTO items VALUES (920, 20.20, 'item920');
+INSERT INTO items VALUES (921, 21.21, 'item921');
+INSERT INTO items VALUES (922, 22.22, 'item922');
+INSERT INTO items VALUES (923, 23.23, 'item923');
+INSERT INTO items VALUES (924, 24.24, 'item924');
+INSERT INTO items VALUES (925, 25.25, 'item925');
+INSERT INTO items VALUES (926, 26.26, 'item926');
+INSERT INTO items VALUES (927, 27.27, 'item927');
+INSERT INTO items VALUES (928, 28.28, 'item928');
+INSERT INTO items VALUES (929, 29.29, 'item929');
+INSERT INTO items VALUES (930, 30.30, 'item930');
+INSERT INTO items VALUES (931, 31.31, 'item931');
+INSERT INTO items VALUES (932, 32.32, 'item932');
+INSERT INTO items VALUES (933, 33.33, 'item933');
+INSERT INTO items VALUES (934, 34.34, 'item934');
+INSERT INTO items VALUES (935, 35.35, 'item935');
+INSERT INTO items VALUES (936, 36.36, 'item936');
+INSERT INTO items VALUES (937, 37.37, 'item937');
+INSERT INTO items VALUES (938, 38.38, 'item938');
+INSERT INTO items VALUES (939, 39.39, 'item939');
+INSERT INTO items VALUES (940, 40.40, 'item940');
+INSERT INTO items VALUES (941, 41.41, 'item941');
+INSERT INTO items VALUES (942, 42.42, 'item942');
+INSERT INTO items VALUES (943, 43.43, 'item943');
+INSERT INTO items VALUES (944, 44.44, 'item944');
+INSERT INTO items VALUES (945, 45.45, 'item945');
+INSERT INTO items VALUES (946, 46.46, 'item946');
+INSERT INTO items VALUES (947, 47.47, 'item947');
+INSERT INTO items VALUES (948, 48.48, 'item948');
+INSERT INTO items VALUES (949, 49.49, 'item949');
+INSERT INTO items VALUES (950, 50.50, 'item950');
+INSERT INTO items VALUES (951, 51.51, 'item951');
+INSERT INTO items VALUES (952, 52.52, 'item952');
+INSERT INTO items VALUES (953, 53.53, 'item953');
+INSERT INTO items VALUES (954, 54.54, 'item954');
+INSERT INTO items VALUES (955, 55.55, 'item955');
+INSERT INTO items VALUES (956, 56.56, 'item956');
+INSERT INTO items VALUES (957, 57.57, 'item957');
+INSERT INTO items VALUES (958, 58.58, 'item958');
+INSERT INTO items VALUES (959, 59.59, 'item959');
+INSERT INTO items VALUES (960, 60.60, 'item960');
+INSERT INTO items VALUES (961, 61.61, 'item961');
+INSERT INTO items VALUES (962, 62.62, 'item962');
+INSERT INTO items VALUES (963, 63.63, 'item963');
+INSERT INTO items VALUES (964, 64.64, 'item964');
+INSERT INTO items VALUES (965, 65.65, 'item965');
+INSERT INTO items VALUES (966, 66.66, 'item966');
+INSERT INTO items VALUES (967, 67.67, 'item967');
+INSERT INTO items VALUES (968, 68.68, 'item968');
+INSERT INTO items VALUES (969, 69.69, 'item969');
+INSERT INTO items VALUES (970, 70.70, 'item970');
+INSERT INTO items VALUES (971, 71.71, 'item971');
+INSERT INTO items VALUES (972, 72.72, 'item972');
+INSERT INTO items VALUES (973, 73.73, 'item973');
+INSERT INTO items VALUES (974, 74.74, 'item974');
+INSERT INTO items VALUES (975, 75.75, 'item975');
+INSERT INTO items VALUES (976, 76.76, 'item976');
+INSERT INTO items VALUES (977, 77.77, 'item977');
+INSERT INTO items VALUES (978, 78.78, 'item978');
+INSERT INTO items VALUES (979, 79.79, 'item979');
+INSERT INTO items VALUES (980, 80.80, 'item980');
+INSERT INTO items VALUES (981, 81.81, 'item981');
+INSERT INTO items VALUES (982, 82.82, 'item982');
+INSERT INTO items VALUES (983, 83.83, 'item983');
+INSERT INTO items VALUES (984, 84.84, 'item984');
+INSERT INTO items VALUES (985, 85.85, 'item985');
+INSERT INTO items VALUES (986, 86.86, 'item986');
+INSERT INTO items VALUES (987, 87.87, 'item987');
+INSERT INTO items VALUES (988, 88.88, 'item988');
+INSERT INTO items VALUES (989, 89.89, 'item989');
+INSERT INTO items VALUES (990, 0.90, 'item990');
+INSERT INTO items VALUES (991, 1.91, 'item991');
+INSERT INTO items VALUES (992, 2.92, 'item992');
+INSERT INTO items VALUES (993, 3.93, 'item993');
+INSERT INTO items VALUES (994, 4.94, 'item994');
+INSERT INTO items VALUES (995, 5.95, 'item995');
+INSERT INTO items VALUES (996, 6.96, 'item996');
+INSERT INTO items VALUES (997, 7.97, 'item997');
+INSERT INTO items VALUES (998, 8.98, 'item998');
+INSERT INTO items VALUES (999, 9.99, 'item999');
+INSERT INTO items VALUES (1000, 10.00, 'item1000');
+INSERT INTO items VALUES (1001, 11.01, 'item1001');
+INSERT INTO items VALUES (1002, 12.02, 'item1002');
+INSERT INTO items VALUES (1003, 13.03, 'item1003');
+INSERT INTO items VALUES (1004, 14.04, 'item1004');
+INSERT INTO items VALUES (1005, 15.05, 'item1005');
+INSERT INTO items VALUES (1006, 16.06, 'item1006');
+INSERT INTO items VALUES (1007, 17.07, 'item1007');
+INSERT INTO items VALUES (1008, 18.08, 'item1008');
+INSERT INTO items VALUES (1009, 19.09, 'item1009');
+INSERT INTO items VALUES (1010, 20.10, 'item1010');
+INSERT INTO items VALUES (1011, 21.11, 'item1011');
+INSERT INTO items VALUES (1012, 22.12, 'item1012');
+INSERT INTO items VALUES (1013, 23.13, 'item1013');
+INSERT INTO items VALUES (1014, 24.14, 'item1014');
+INSERT INTO items VALUES (1015, 25.15, 'item1015');
+INSERT INTO items VALUES (1016, 26.16, 'item1016');
+INSERT INTO items VALUES (1017, 27.17, 'item1017');
+INSERT INTO items VALUES (1018, 28.18, 'item1018');
+INSERT INTO items VALUES (1019, 29.19, 'item1019');
+INSERT INTO items VALUES (1020, 30.20, 'item1020');
+INSERT INTO items VALUES (1021, 31.21, 'item1021');
+INSERT INTO items VALUES (1022, 32.22, 'item1022');
+INSERT INTO items VALUES (1023, 33.23, 'item1023');
+INSERT INTO items VALUES (1024, 34.24, 'item1024');
+INSERT INTO items VALUES (1025, 35.25, 'item1025');
+INSERT INTO items VALUES (1026, 36.26, 'item1026');
+INSERT INTO items VALUES (1027, 37.27, 'item1027');
+INSERT INTO items VALUES (1028, 38.28, 'item1028');
+INSERT INTO items VALUES (1029, 39.29, 'item1029');
+INSERT INTO items VALUES (1030, 40.30, 'item1030');
+INSERT INTO items VALUES (1031, 41.31, 'item1031');
+INSERT INTO items VALUES (1032, 42.32, 'item1032');
+INSERT INTO items VALUES (1033, 43.33, 'item1033');
+INSERT INTO items VALUES (1034, 44.34, 'item1034');
+INSERT INTO items VALUES (1035, 45.35, 'item1035');
+INSERT INTO items VALUES (1036, 46.36, 'item1036');
+INSERT INTO items VALUES (1037, 47.37, 'item1037');
+INSERT INTO items VALUES (1038, 48.38, 'item1038');
+INSERT INTO items VALUES (1039, 49.39, 'item1039');
+INSERT INTO items VALUES (1040, 50.40, 'item1040');
+INSERT INTO items VALUES (1041, 51.41, 'item1041');
+INSERT INTO items VALUES (1042, 52.42, 'item1042');
+INSERT INTO items VALUES (1043, 53.43, 'item1043');
+INSERT INTO items VALUES (1044, 54.44, 'item1044');
+INSERT INTO items VALUES (1045, 55.45, 'item1045');
+INSERT INTO items VALUES (1046, 56.46, 'item1046');
+INSERT INTO items VALUES (1047, 57.47, 'item1047');
+INSERT INTO items VALUES (1048, 58.48, 'item1048');
+INSERT INTO items VALUES (1049, 59.49, 'item1049');
+INSERT INTO items VALUES (1050, 60.50, 'item1050');
+INSERT INTO items VALUES (1051, 61.51, 'item1051');
+INSERT INTO items VALUES (1052, 62.52, 'item1052');
+INSERT INTO items VALUES (1053, 63.53, 'item1053');
+INSERT INTO items VALUES (1054, 64.54, 'item1054');
+INSERT INTO items VALUES (1055, 65.55, 'item1055');
+INSERT INTO items VALUES (1056, 66.56, 'item1056');
+INSERT INTO items VALUES (1057, 67.57, 'item1057');
+INSERT INTO items VALUES (1058, 68.58, 'item1058');
+INSERT INTO items VALUES (1059, 69.59, 'item1059');
+INSERT INTO items VALUES (1060, 70.60, 'item1060');
+INSERT INTO items VALUES (1061, 71.61, 'item1061');
+INSERT INTO items VALUES (1062, 72.62, 'item1062');
+INSERT INTO items VALUES (1063, 73.63, 'item1063');
+INSERT INTO items VALUES (1064, 74.64, 'item1064');
+INSERT INTO items VALUES (1065, 75.65, 'item1065');
+INSERT INTO items VALUES (1066, 76.66, 'item1066');
+INSERT INTO items VALUES (1067, 77.67, 'item1067');
+INSERT INTO items VALUES (1068, 78.68, 'item1068');
+INSERT INTO items VALUES (1069, 79.69, 'item1069');
+INSERT INTO items VALUES (1070, 80.70, 'item1070');
+INSERT INTO items VALUES (1071, 81.71, 'item1071');
+INSERT INTO items VALUES (1072, 82.72, 'item1072');
+INSERT INTO items VALUES (1073, 83.73, 'item1073');
+INSERT INTO items VALUES (1074, 84.74, 'item1074');
+INSERT INTO items VALUES (1075, 85.75, 'item1075');
+INSERT INTO items VALUES (1076, 86.76, 'item1076');
+INSERT INTO items VALUES (1077, 87.77, 'item1077');
+INSERT INTO items VALUES (1078, 88.78, 'item1078');
+INSERT INTO items VALUES (1079, 89.79, 'item1079');
+INSERT INTO items VALUES (1080, 0.80, 'item1080');
+INSERT INTO items VALUES (1081, 1.81, 'item1081');
+INSERT INTO items VALUES (1082, 2.82, 'item1082');
+INSERT INTO items VALUES (1083, 3.83, 'item1083');
+INSERT INTO items VALUES (1084, 4.84, 'item1084');
+INSERT INTO items VALUES (1085, 5.85, 'item1085');
+INSERT INTO items VALUES (1086, 6.86, 'item1086');
+INSERT INTO items VALUES (1087, 7.87, 'item1087');
+INSERT INTO items VALUES (1088, 8.88, 'item1088');
+INSERT INTO items VALUES (1089, 9.89, 'item1089');
+INSERT INTO items VALUES (1090, 10.90, 'item1090');
+INSERT INTO items VALUES (1091, 11.91, 'item1091');
+INSERT INTO items VALUES (1092, 12.92, 'item1092');
+INSERT INTO items VALUES (1093, 13.93, 'item1093');
+INSERT INTO items VALUES (1094, 14.94, 'item1094');
+INSERT INTO items VALUES (1095, 15.95, 'item1095');
+INSERT INTO items VALUES (1096, 16.96, 'item1096');
+INSERT INTO items VALUES (1097, 17.97, 'item1097');
+INSERT INTO items VALUES (1098, 18.98, 'item1098');
+INSERT INTO items VALUES (1099, 19.99, 'item1099');
+INSERT INTO items VALUES (1100, 20.00, 'item1100');
+INSERT INTO items VALUES (1101, 21.01, 'item1101');
+INSERT INTO items VALUES (1102, 22.02, 'item1102');
+INSERT INTO items VALUES (1103, 23.03, 'item1103');
+INSERT INTO items VALUES (1104, 24.04, 'item1104');
+INSERT INTO items VALUES (1105, 25.05, 'item1105');
+INSERT INTO items VALUES (1106, 26.06, 'item1106');
+INSERT INTO items VALUES (1107, 27.07, 'item1107');
+INSERT INTO items VALUES (1108, 28.08, 'item1108');
+INSERT INTO items VALUES (1109, 29.09, 'item1109');
+INSERT INTO items VALUES (1110, 30.10, 'item1110');
+INSERT INTO items VALUES (1111, 31.11, 'item1111');
+INSERT INTO items VALUES (1112, 32.12, 'item1112');
+INSERT INTO items VALUES (1113, 33.13, 'item1113');
+INSERT INTO items VALUES (1114, 34.14, 'item1114');
+INSERT INTO items VALUES (1115, 35.15, 'item1115');
+INSERT INTO items VALUES (1116, 36.16, 'item1116');
+INSERT INTO items VALUES (1117, 37.17, 'item1117');
+INSERT INTO items VALUES (1118, 38.18, 'item1118');
+INSERT INTO items VALUES (1119, 39.19, 'item1119');
+INSERT INTO items VALUES (1120, 40.20, 'item1120');
+INSERT INTO items VALUES (1121, 41.21, 'item1121');
+INSERT INTO items VALUES (1122, 42.22, 'item1122');
+INSERT INTO items VALUES (1123, 43.23, 'item1123');
+INSERT INTO items VALUES (1124, 44.24, 'item1124');
+INSERT INTO items VALUES (1125, 45.25, 'item1125');
+INSERT INTO items VALUES (1126, 46.26, 'item1126');
+INSERT INTO items VALUES (1127, 47.27, 'item1127');
+INSERT INTO items VALUES (1128, 48.28, 'item1128');
+INSERT INTO items VALUES (1129, 49.29, 'item1129');
+INSERT INTO items VALUES (1130, 50.30, 'item1130');
+INSERT INTO items VALUES (1131, 51.31, 'item1131');
+INSERT INTO items VALUES (1132, 52.32, 'item1132');
+INSERT INTO items VALUES (1133, 53.33, 'item1133');
+INSERT INTO items VALUES (1134, 54.34, 'item1134');
+INSERT INTO items VALUES (1135, 55.35, 'item1135');
+INSERT INTO items VALUES (1136, 56.36, 'item1136');
+INSERT INTO items VALUES (1137, 57.37, 'item1137');
+INSERT INTO items VALUES (1138, 58.38, 'item1138');
+INSERT INTO items VALUES (1139, 59.39, 'item1139');
+INSERT INTO items VALUES (1140, 60.40, 'item1140');
+INSERT INTO items VALUES (1141, 61.41, 'item1141');
+INSERT INTO items VALUES (1142, 62.42, 'item1142');
+INSERT INTO items VALUES (1143, 63.43, 'item1143');
+INSERT INTO items VALUES (1144, 64.44, 'item1144');
+INSERT INTO items VALUES (1145, 65.45, 'item1145');
+INSERT INTO items VALUES (1146, 66.46, 'item1146');
+INSERT INTO items VALUES (1147, 67.47, 'item1147');
+INSERT INTO items VALUES (1148, 68.48, 'item1148');
+INSERT INTO items VALUES (1149, 69.49, 'item1149');
+INSERT INTO items VALUES (1150, 70.50, 'item1150');
+INSERT INTO items VALUES (1151, 71.51, 'item1151');
+INSERT INTO items VALUES (1152, 72.52, 'item1152');
+INSERT INTO items VALUES (1153, 73.53, 'item1153');
+INSERT INTO items VALUES (1154, 74.54, 'item1154');
+INSERT INTO items VALUES (1155, 75.55, 'item1155');
+INSERT INTO items VALUES (1156, 76.56, 'item1156');
+INSERT INTO items VALUES (1157, 77.57, 'item1157');
+INSERT INTO items VALUES (1158, 78.58, 'item1158');
+INSERT INTO items VALUES (1159, 79.59, 'item1159');
+INSERT INTO items VALUES (1160, 80.60, 'item1160');
+INSERT INTO items VALUES (1161, 81.61, 'item1161');
+INSERT INTO items VALUES (1162, 82.62, 'item1162');
+INSERT INTO items VALUES (1163, 83.63, 'item1163');
+INSERT INTO items VALUES (1164, 84.64, 'item1164');
+INSERT INTO items VALUES (1165, 85.65, 'item1165');
+INSERT INTO items VALUES (1166, 86.66, 'item1166');
+INSERT INTO items VALUES (1167, 87.67, 'item1167');
+INSERT INTO items VALUES (1168, 88.68, 'item1168');
+INSERT INTO items VALUES (1169, 89.69, 'item1169');
+INSERT INTO items VALUES (1170, 0.70, 'item1170');
+INSERT INTO items VALUES (1171, 1.71, 'item1171');
+INSERT INTO items VALUES (1172, 2.72, 'item1172');
+INSERT INTO items VALUES (1173, 3.73, 'item1173');
+INSERT INTO items VALUES (1174, 4.74, 'item1174');
+INSERT INTO items VALUES (1175, 5.75, 'item1175');
+INSERT INTO items VALUES (1176, 6.76, 'item1176');
+INSERT INTO items VALUES (1177, 7.77, 'item1177');
+INSERT INTO items VALUES (1178, 8.78, 'item1178');
+INSERT INTO items VALUES (1179, 9.79, 'item1179');
+INSERT INTO items VALUES (1180, 10.80, 'item1180');
+INSERT INTO items VALUES (1181, 11.81, 'item1181');
+INSERT INTO items VALUES (1182, 12.82, 'item1182');
+INSERT INTO items VALUES (1183, 13.83, 'item1183');
+INSERT INTO items VALUES (1184, 14.84, 'item1184');
+INSERT INTO items VALUES (1185, 15.85, 'item1185');
+INSERT INTO items VALUES (1186, 16.86, 'item1186');
+INSERT INTO items VALUES (1187, 17.87, 'item1187');
+INSERT INTO items VALUES (1188, 18.88, 'item1188');
+INSERT INTO items VALUES (1189, 19.89, 'item1189');
+INSERT INTO items VALUES (1190, 20.90, 'item1190');
+INSERT INTO items VALUES (1191, 21.91, 'item1191');
+INSERT INTO items VALUES (1192, 22.92, 'item1192');
+INSERT INTO items VALUES (1193, 23.93, 'item1193');
+INSERT INTO items VALUES (1194, 24.94, 'item1194');
+INSERT INTO items VALUES (1195, 25.95, 'item1195');
+INSERT INTO items VALUES (1196, 26.96, 'item1196');
+INSERT INTO items VALUES (1197, 27.97, 'item1197');
+INSERT INTO items VALUES (1198, 28.98, 'item1198');
+INSERT INTO items VALUES (1199, 29.99, 'item1199');
+INSERT INTO items VALUES (1200, 30.00, 'item1200');
+INSERT INTO items VALUES (1201, 31.01, 'item1201');
+INSERT INTO items VALUES (1202, 32.02, 'item1202');
+INSERT INTO items VALUES (1203, 33.03, 'item1203');
+INSERT INTO items VALUES (1204, 34.04, 'item1204');
+INSERT INTO items VALUES (1205, 35.05, 'item1205');
+INSERT INTO items VALUES (1206, 36.06, 'item1206');
+INSERT INTO items VALUES (1207, 37.07, 'item1207');
+INSERT INTO items VALUES (1208, 38.08, 'item1208');
+INSERT INTO items VALUES (1209, 39.09, 'item1209');
+INSERT INTO items VALUES (1210, 40.10, 'item1210');
+INSERT INTO items VALUES (1211, 41.11, 'item1211');
+INSERT INTO items VALUES (1212, 42.12, 'item1212');
+INSERT INTO items VALUES (1213, 43.13, 'item1213');
+INSERT INTO items VALUES (1214, 44.14, 'item1214');
+INSERT INTO items VALUES (1215, 45.15, 'item1215');
+INSERT INTO items VALUES (1216, 46.16, 'item1216');
+INSERT INTO items VALUES (1217, 47.17, 'item1217');
+INSERT INTO items VALUES (1218, 48.18, 'item1218');
+INSERT INTO items VALUES (1219, 49.19, 'item1219');
+INSERT INTO items VALUES (1220, 50.20, 'item1220');
+INSERT INTO items VALUES (1221, 51.21, 'item1221');
+INSERT INTO items VALUES (1222, 52.22, 'item1222');
+INSERT INTO items VALUES (1223, 53.23, 'item1223');
+INSERT INTO items VALUES (1224, 54.24, 'item1224');
+INSERT INTO items VALUES (1225, 55.25, 'item1225');
+INSERT INTO items VALUES (1226, 56.26, 'item1226');
+INSERT INTO items VALUES (1227, 57.27, 'item1227');
+INSERT INTO items VALUES (1228, 58.28, 'item1228');
+INSERT INTO items VALUES (1229, 59.29, 'item1229');
+INSERT INTO items VALUES (1230, 60.30, 'item1230');
+INSERT INTO items VALUES (1231, 61.31, 'item1231');
+INSERT INTO items VALUES (1232, 62.32, 'item1232');
+INSERT INTO items VALUES (1233, 63.33, 'item1233');
+INSERT INTO items VALUES (1234, 64.34, 'item1234');
+INSERT INTO items VALUES (1235, 65.35, 'item1235');
+INSERT INTO items VALUES (1236, 66.36, 'item1236');
+INSERT INTO items VALUES (1237, 67.37, 'item1237');
+INSERT INTO items VALUES (1238, 68.38, 'item1238');
+INSERT INTO items VALUES (1239, 69.39, 'item1239');
+INSERT INTO items VALUES (1240, 70.40, 'item1240');
+INSERT INTO items VALUES (1241, 71.41, 'item1241');
+INSERT INTO items VALUES (1242, 72.42, 'item1242');
+INSERT INTO items VALUES (1243, 73.43, 'item1243');
+INSERT INTO items VALUES (1244, 74.44, 'item1244');
+INSERT INTO items VALUES (1245, 75.45, 'item1245');
+INSERT INTO items VALUES (1246, 76.46, 'item1246');
+INSERT INTO items VALUES (1247, 77.47, 'item1247');
+INSERT INTO items VALUES (1248, 78.48, 'item1248');
+INSERT INTO items VALUES (1249, 79.49, 'item1249');
+INSERT INTO items VALUES (1250, 80.50, 'item1250');
+INSERT INTO items VALUES (1251, 81.51, 'item1251');
+INSERT INTO items VALUES (1252, 82.52, 'item1252');
+INSERT INTO items VALUES (1253, 83.53, 'item1253');
+INSERT INTO items VALUES (1254, 84.54, 'item1254');
+INSERT INTO items VALUES (1255, 85.55, 'item1255');
+INSERT INTO items VALUES (1256, 86.56, 'item1256');
+INSERT INTO items VALUES (1257, 87.57, 'item1257');
+INSERT INTO items VALUES (1258, 88.58, 'item1258');
+INSERT INTO items VALUES (1259, 89.59, 'item1259');
+INSERT INTO items VALUES (1260, 0.60, 'item1260');
+INSERT INTO items VALUES (1261, 1.61, 'item1261');
+INSERT INTO items VALUES (1262, 2.62, 'item1262');
+INSERT INTO items VALUES (1263, 3.63, 'item1263');
+INSERT INTO items VALUES (1264, 4.64, 'item1264');
+INSERT INTO items VALUES (1265, 5.65, 'item1265');
+INSERT INTO items VALUES (1266, 6.66, 'item1266');
+INSERT INTO items VALUES (1267, 7.67, 'item1267');
+INSERT INTO items VALUES (1268, 8.68, 'item1268');
+INSERT INTO items VALUES (1269, 9.69, 'item1269');
+INSERT INTO items VALUES (1270, 10.70, 'item1270');
+INSERT INTO items VALUES (1271, 11.71, 'item1271');
+INSERT INTO items VALUES (1272, 12.72, 'item1272');
+INSERT INTO items VALUES (1273, 13.73, 'item1273');
+INSERT INTO items VALUES (1274, 14.74, 'item1274');
+INSERT INTO items VALUES (1275, 15.75, 'item1275');
+INSERT INTO items VALUES (1276, 16.76, 'item1276');
+INSERT INTO items VALUES (1277, 17.77, 'item1277');
+INSERT INTO items VALUES (1278, 18.78, 'item1278');
+INSERT INTO items VALUES (1279, 19.79, 'item1279');
+INSERT INTO items VALUES (1280, 20.80, 'item1280');
+INSERT INTO items VALUES (1281, 21.81, 'item1281');
+INSERT INTO items VALUES (1282, 22.82, 'item1282');
+INSERT INTO items VALUES (1283, 23.83, 'item1283');
+INSERT INTO items VALUES (1284, 24.84, 'item1284');
+INSERT INTO items VALUES (1285, 25.85, 'item1285');
+INSERT INTO items VALUES (1286, 26.86, 'item1286');
+INSERT INTO items VALUES (1287, 27.87, 'item1287');
+INSERT INTO items VALUES (1288, 28.88, 'item1288');
+INSERT INTO items VALUES (1289, 29.89, 'item1289');
+INSERT INTO items VALUES (1290, 30.90, 'item1290');
+INSERT INTO items VALUES (1291, 31.91, 'item1291');
+INSERT INTO items VALUES (1292, 32.92, 'item1292');
+INSERT INTO items VALUES (1293, 33.93, 'item1293');
+INSERT INTO items VALUES (1294, 34.94, 'item1294');
+INSERT INTO items VALUES (1295, 35.95, 'item1295');
+INSERT INTO items VALUES (1296, 36.96, 'item1296');
+INSERT INTO items VALUES (1297, 37.97, 'item1297');
+INSERT INTO items VALUES (1298, 38.98, 'item1298');
+INSERT INTO items VALUES (1299, 39.99, 'item1299');
+INSERT INTO items VALUES (1300, 40.00, 'item1300');
+INSERT INTO items VALUES (1301, 41.01, 'item1301');
+INSERT INTO items VALUES (1302, 42.02, 'item1302');
+INSERT INTO items VALUES (1303, 43.03, 'item1303');
+INSERT INTO items VALUES (1304, 44.04, 'item1304');
+INSERT INTO items VALUES (1305, 45.05, 'item1305');
+INSERT INTO items VALUES (1306, 46.06, 'item1306');
+INSERT INTO items VALUES (1307, 47.07, 'item1307');
+INSERT INTO items VALUES (1308, 48.08, 'item1308');
+INSERT INTO items VALUES (1309, 49.09, 'item1309');
+INSERT INTO items VALUES (1310, 50.10, 'item1310');
+INSERT INTO items VALUES (1311, 51.11, 'item1311');
+INSERT INTO items VALUES (1312, 52.12, 'item1312');
+INSERT INTO items VALUES (1313, 53.13, 'item1313');
+INSERT INTO items VALUES (1314, 54.14, 'item1314');
+INSERT INTO items VALUES (1315, 55.15, 'item1315');
+INSERT INTO items VALUES (1316, 56.16, 'item1316');
+INSERT INTO items VALUES (1317, 57.17, 'item1317');
+INSERT INTO items VALUES (1318, 58.18, 'item1318');
+INSERT INTO items VALUES (1319, 59.19, 'item1319');
+INSERT INTO items VALUES (1320, 60.20, 'item1320');
+INSERT INTO items VALUES (1321, 61.21, 'item1321');
+INSERT INTO items VALUES (1322, 62.22, 'item1322');
+INSERT INTO items VALUES (1323, 63.23, 'item1323');
+INSERT INTO items VALUES (1324, 64.24, 'item1324');
+INSERT INTO items VALUES (1325, 65.25, 'item1325');
+INSERT INTO items VALUES (1326, 66.26, 'item1326');
+INSERT INTO items VALUES (1327, 67.27, 'item1327');
+INSERT INTO items VALUES (1328, 68.28, 'item1328');
+INSERT INTO items VALUES (1329, 69.29, 'item1329');
+INSERT INTO items VALUES (1330, 70.30, 'item1330');
+INSERT INTO items VALUES (1331, 71.31, 'item1331');
+INSERT INTO items VALUES (1332, 72.32, 'item1332');
+INSERT INTO items VALUES (1333, 73.33, 'item1333');
+INSERT INTO items VALUES (1334, 74.34, 'item1334');
+INSERT INTO items VALUES (1335, 75.35, 'item1335');
+INSERT INTO items VALUES (1336, 76.36, 'item1336');
+INSERT INTO items VALUES (1337, 77.37, 'item1337');
+INSERT INTO items VALUES (1338, 78.38, 'item1338');
+INSERT INTO items VALUES (1339, 79.39, 'item1339');
+INSERT INTO items VALUES (1340, 80.40, 'item1340');
+INSERT INTO items VALUES (1341, 81.41, 'item1341');
+INSERT INTO items VALUES (1342, 82.42, 'item1342');
+INSERT INTO items VALUES (1343, 83.43, 'item1343');
+INSERT INTO items VALUES (1344, 84.44, 'item1344');
+INSERT INTO items VALUES (1345, 85.45, 'item1345');
+INSERT INTO items VALUES (1346, 86.46, 'item1346');
+INSERT INTO items VALUES (1347, 87.47, 'item1347');
+INSERT INTO items VALUES (1348, 88.48, 'item1348');
+INSERT INTO items VALUES (1349, 89.49, 'item1349');
+INSERT INTO items VALUES (1350, 0.50, 'item1350');
+INSERT INTO items VALUES (1351, 1.51, 'item1351');
+INSERT INTO items VALUES (1352, 2.52, 'item1352');
+INSERT INTO items VALUES (1353, 3.53, 'item1353');
+INSERT INTO items VALUES (1354, 4.54, 'item1354');
+INSERT INTO items VALUES (1355, 5.55, 'item1355');
+INSERT INTO items VALUES (1356, 6.56, 'item1356');
+INSERT INTO items VALUES (1357, 7.57, 'item1357');
+INSERT INTO items VALUES (1358, 8.58, 'item1358');
+INSERT INTO items VALUES (1359, 9.59, 'item1359');
+INSERT INTO items VALUES (1360, 10.60, 'item1360');
+INSERT INTO items VALUES (1361, 11.61, 'item1361');
+INSERT INTO items VALUES (1362, 12.62, 'item1362');
+INSERT INTO items VALUES (1363, 13.63, 'item1363');
+INSERT INTO items VALUES (1364, 14.64, 'item1364');
+INSERT INTO items VALUES (1365, 15.65, 'item1365');
+INSERT INTO items VALUES (1366, 16.66, 'item1366');
+INSERT INTO items VALUES (1367, 17.67, 'item1367');
+INSERT INTO items VALUES (1368, 18.68, 'item1368');
+INSERT INTO items VALUES (1369, 19.69, 'item1369');
+INSERT INTO items VALUES (1370, 20.70, 'item1370');
+INSERT INTO items VALUES (1371, 21.71, 'item1371');
+INSERT INTO items VALUES (1372, 22.72, 'item1372');
+INSERT INTO items VALUES (1373, 23.73, 'item1373');
+INSERT INTO items VALUES (1374, 24.74, 'item1374');
+INSERT INTO items VALUES (1375, 25.75, 'item1375');
+INSERT INTO items VALUES (1376, 26.76, 'item1376');
+INSERT INTO items VALUES (1377, 27.77, 'item1377');
+INSERT INTO items VALUES (1378, 28.78, 'item1378');
+INSERT INTO items VALUES (1379, 29.79, 'item1379');
+INSERT INTO items VALUES (1380, 30.80, 'item1380');
+INSERT INTO items VALUES (1381, 31.81, 'item1381');
+INSERT INTO items VALUES (1382, 32.82, 'item1382');
+INSERT INTO items VALUES (1383, 33.83, 'item1383');
+INSERT INTO items VALUES (1384, 34.84, 'item1384');
+INSERT INTO items VALUES (1385, 35.85, 'item1385');
+INSERT INTO items VALUES (1386, 36.86, 'item1386');
+INSERT INTO items VALUES (1387, 37.87, 'item1387');
+INSERT INTO items VALUES (1388, 38.88, 'item1388');
+INSERT INTO items VALUES (1389, 39.89, 'item1389');
+INSERT INTO items VALUES (1390, 40.90, 'item1390');
+INSERT INTO items VALUES (1391, 41.91, 'item1391');
+INSERT INTO items VALUES (1392, 42.92, 'item1392');
+INSERT INTO items VALUES (1393, 43.93, 'item1393');
+INSERT INTO items VALUES (1394, 44.94, 'item1394');
+INSERT INTO items VALUES (1395, 45.95, 'item1395');
+INSERT INTO items VALUES (1396, 46.96, 'item1396');
+INSERT INTO items VALUES (1397, 47.97, 'item1397');
+INSERT INTO items VALUES (1398, 48.98, 'item1398');
+INSERT INTO items VALUES (1399, 49.99, 'item1399');
+INSERT INTO items VALUES (1400, 50.00, 'item1400');
+INSERT INTO items VALUES (1401, 51.01, 'item1401');
+INSERT INTO items VALUES (1402, 52.02, 'item1402');
+INSERT INTO items VALUES (1403, 53.03, 'item1403');
+INSERT INTO items VALUES (1404, 54.04, 'item1404');
+INSERT INTO items VALUES (1405, 55.05, 'item1405');
+INSERT INTO items VALUES (1406, 56.06, 'item1406');
+INSERT INTO items VALUES (1407, 57.07, 'item1407');
+INSERT INTO items VALUES (1408, 58.08, 'item1408');
+INSERT INTO items VALUES (1409, 59.09, 'item1409');
+INSERT INTO items VALUES (1410, 60.10, 'item1410');
+INSERT INTO items VALUES (1411, 61.11, 'item1411');
+INSERT INTO items VALUES (1412, 62.12, 'item1412');
+INSERT INTO items VALUES (1413, 63.13, 'item1413');
+INSERT INTO items VALUES (1414, 64.14, 'item1414');
+INSERT INTO items VALUES (1415, 65.15, 'item1415');
+INSERT INTO items VALUES (1416, 66.16, 'item1416');
+INSERT INTO items VALUES (1417, 67.17, 'item1417');
+INSERT INTO items VALUES (1418, 68.18, 'item1418');
+INSERT INTO items VALUES (1419, 69.19, 'item1419');
+INSERT INTO items VALUES (1420, 70.20, 'item1420');
+INSERT INTO items VALUES (1421, 71.21, 'item1421');
+INSERT INTO items VALUES (1422, 72.22, 'item1422');
+INSERT INTO items VALUES (1423, 73.23, 'item1423');
+INSERT INTO items VALUES (1424, 74.24, 'item1424');
+INSERT INTO items VALUES (1425, 75.25, 'item1425');
+INSERT INTO items VALUES (1426, 76.26, 'item1426');
+INSERT INTO items VALUES (1427, 77.27, 'item1427');
+INSERT INTO items VALUES (1428, 78.28, 'item1428');
+INSERT INTO items VALUES (1429, 79.29, 'item1429');
+INSERT INTO items VALUES (1430, 80.30, 'item1430');
+INSERT INTO items VALUES (1431, 81.31, 'item1431');
+INSERT INTO items VALUES (1432, 82.32, 'item1432');
+INSERT INTO items VALUES (1433, 83.33, 'item1433');
+INSERT INTO items VALUES (1434, 84.34, 'item1434');
+INSERT INTO items VALUES (1435, 85.35, 'item1435');
+INSERT INTO items VALUES (1436, 86.36, 'item1436');
+INSERT INTO items VALUES (1437, 87.37, 'item1437');
+INSERT INTO items VALUES (1438, 88.38, 'item1438');
+INSERT INTO items VALUES (1439, 89.39, 'item1439');
+INSERT INTO items VALUES (1440, 0.40, 'item1440');
+INSERT INTO items VALUES (1441, 1.41, 'item1441');
+INSERT INTO items VALUES (1442, 2.42, 'item1442');
+INSERT INTO items VALUES (1443, 3.43, 'item1443');
+INSERT INTO items VALUES (1444, 4.44, 'item1444');
+INSERT INTO items VALUES (1445, 5.45, 'item1445');
+INSERT INTO items VALUES (1446, 6.46, 'item1446');
+INSERT INTO items VALUES (1447, 7.47, 'item1447');
+INSERT INTO items VALUES (1448, 8.48, 'item1448');
+INSERT INTO items VALUES (1449, 9.49, 'item1449');
+INSERT INTO items VALUES (1450, 10.50, 'item1450');
+INSERT INTO items VALUES (1451, 11.51, 'item1451');
+INSERT INTO items VALUES (1452, 12.52, 'item1452');
+INSERT INTO items VALUES (1453, 13.53, 'item1453');
+INSERT INTO items VALUES (1454, 14.54, 'item1454');
+INSERT INTO items VALUES (1455, 15.55, 'item1455');
+INSERT INTO items VALUES (1456, 16.56, 'item1456');
+INSERT INTO items VALUES (1457, 17.57, 'item1457');
+INSERT INTO items VALUES (1458, 18.58, 'item1458');
+INSERT INTO items VALUES (1459, 19.59, 'item1459');
+INSERT INTO items VALUES (1460, 20.60, 'item1460');
+INSERT INTO items VALUES (1461, 21.61, 'item1461');
+INSERT INTO items VALUES (1462, 22.62, 'item1462');
+INSERT INTO items VALUES (1463, 23.63, 'item1463');
+INSERT INTO items VALUES (1464, 24.64, 'item1464');
+INSERT INTO items VALUES (1465, 25.65, 'item1465');
+INSERT INTO items VALUES (1466, 26.66, 'item1466');
+INSERT INTO items VALUES (1467, 27.67, 'item1467');
+INSERT INTO items VALUES (1468, 28.68, 'item1468');
+INSERT INTO items VALUES (1469, 29.69, 'item1469');
+INSERT INTO items VALUES (1470, 30.70, 'item1470');
+INSERT INTO items VALUES (1471, 31.71, 'item1471');
+INSERT INTO items VALUES (1472, 32.72, 'item1472');
+INSERT INTO items VALUES (1473, 33.73, 'item1473');
+INSERT INTO items VALUES (1474, 34.74, 'item1474');
+INSERT INTO items VALUES (1475, 35.75, 'item1475');
+INSERT INTO items VALUES (1476, 36.76, 'item1476');
+INSERT INTO items VALUES (1477, 37.77, 'item1477');
+INSERT INTO items VALUES (1478, 38.78, 'item1478');
+INSERT INTO items VALUES (1479, 39.79, 'item1479');
+INSERT INTO items VALUES (1480, 40.80, 'item1480');
+INSERT INTO items VALUES (1481, 41.81, 'item1481');
+INSERT INTO items VALUES (1482, 42.82, 'item1482');
+INSERT INTO items VALUES (1483, 43.83, 'item1483');
+INSERT INTO items VALUES (1484, 44.84, 'item1484');
+INSERT INTO items VALUES (1485, 45.85, 'item1485');
+INSERT INTO items VALUES (1486, 46.86, 'item1486');
+INSERT INTO items VALUES (1487, 47.87, 'item1487');
+INSERT INTO items VALUES (1488, 48.88, 'item1488');
+INSERT INTO items VALUES (1489, 49.89, 'item1489');
+INSERT INTO items VALUES (1490, 50.90, 'item1490');
+INSERT INTO items VALUES (1491, 51.91, 'item1491');
+INSERT INTO items VALUES (1492, 52.92, 'item1492');
+INSERT INTO items VALUES (1493, 53.93, 'item1493');
+INSERT INTO items VALUES (1494, 54.94, 'item1494');
+INSERT INTO items VALUES (1495, 55.95, 'item1495');
+INSERT INTO items VALUES (1496, 56.96, 'item1496');
+INSERT INTO items VALUES (1497, 57.97, 'item1497');
+INSERT INTO items VALUES (1498, 58.98, 'item1498');
+INSERT INTO items VALUES (1499, 59.99, 'item1499');
+INSERT INTO items VALUES (1500, 60.00, 'item1500');
+INSERT INTO items VALUES (1501, 61.01, 'item1501');
+INSERT INTO items VALUES (1502, 62.02, 'item1502');
+INSERT INTO items VALUES (1503, 63.03, 'item1503');
+INSERT INTO items VALUES (1504, 64.04, 'item1504');
+INSERT INTO items VALUES (1505, 65.05, 'item1505');
+INSERT INTO items VALUES (1506, 66.06, 'item1506');
+INSERT INTO items VALUES (1507, 67.07, 'item1507');
+INSERT INTO items VALUES (1508, 68.08, 'item1508');
+INSERT INTO items VALUES (1509, 69.09, 'item1509');
+INSERT INTO items VALUES (1510, 70.10, 'item1510');
+INSERT INTO items VALUES (1511, 71.11, 'item1511');
+INSERT INTO items VALUES (1512, 72.12, 'item1512');
+INSERT INTO items VALUES (1513, 73.13, 'item1513');
+INSERT INTO items VALUES (1514, 74.14, 'item1514');
+INSERT INTO items VALUES (1515, 75.15, 'item1515');
+INSERT INTO items VALUES (1516, 76.16, 'item1516');
+INSERT INTO items VALUES (1517, 77.17, 'item1517');
+INSERT INTO items VALUES (1518, 78.18, 'item1518');
+INSERT INTO items VALUES (1519, 79.19, 'item1519');
+INSERT INTO items VALUES (1520, 80.20, 'item1520');
+INSERT INTO items VALUES (1521, 81.21, 'item1521');
+INSERT INTO items VALUES (1522, 82.22, 'item1522');
+INSERT INTO items VALUES (1523, 83.23, 'item1523');
+INSERT INTO items VALUES (1524, 84.24, 'item1524');
+INSERT INTO items VALUES (1525, 85.25, 'item1525');
+INSERT INTO items VALUES (1526, 86.26, 'item1526');
+INSERT INTO items VALUES (1527, 87.27, 'item1527');
+INSERT INTO items VALUES (1528, 88.28, 'item1528');
+INSERT INTO items VALUES (1529, 89.29, 'item1529');
+INSERT INTO items VALUES (1530, 0.30, 'item1530');
+INSERT INTO items VALUES (1531, 1.31, 'item1531');
+INSERT INTO items VALUES (1532, 2.32, 'item1532');
+INSERT INTO items VALUES (1533, 3.33, 'item1533');
+INSERT INTO items VALUES (1534, 4.34, 'item1534');
+INSERT INTO items VALUES (1535, 5.35, 'item1535');
+INSERT INTO items VALUES (1536, 6.36, 'item1536');
+INSERT INTO items VALUES (1537, 7.37, 'item1537');
+INSERT INTO items VALUES (1538, 8.38, 'item1538');
+INSERT INTO items VALUES (1539, 9.39, 'item1539');
+INSERT INTO items VALUES (1540, 10.40, 'item1540');
+INSERT INTO items VALUES (1541, 11.41, 'item1541');
+INSERT INTO items VALUES (1542, 12.42, 'item1542');
+INSERT INTO items VALUES (1543, 13.43, 'item1543');
+INSERT INTO items VALUES (1544, 14.44, 'item1544');
+INSERT INTO items VALUES (1545, 15.45, 'item1545');
+INSERT INTO items VALUES (1546, 16.46, 'item1546');
+INSERT INTO items VALUES (1547, 17.47, 'item1547');
+INSERT INTO items VALUES (1548, 18.48, 'item1548');
+INSERT INTO items VALUES (1549, 19.49, 'item1549');
+INSERT INTO items VALUES (1550, 20.50, 'item1550');
+INSERT INTO items VALUES (1551, 21.51, 'item1551');
+INSERT INTO items VALUES (1552, 22.52, 'item1552');
+INSERT INTO items VALUES (1553, 23.53, 'item1553');
+INSERT INTO items VALUES (1554, 24.54, 'item1554');
+INSERT INTO items VALUES (1555, 25.55, 'item1555');
+INSERT INTO items VALUES (1556, 26.56, 'item1556');
+INSERT INTO items VALUES (1557, 27.57, 'item1557');
+INSERT INTO items VALUES (1558, 28.58, 'item1558');
+INSERT INTO items VALUES (1559, 29.59, 'item1559');
+INSERT INTO items VALUES (1560, 30.60, 'item1560');
+INSERT INTO items VALUES (1561, 31.61, 'item1561');
+INSERT INTO items VALUES (1562, 32.62, 'item1562');
+INSERT INTO items VALUES (1563, 33.63, 'item1563');
+INSERT INTO items VALUES (1564, 34.64, 'item1564');
+INSERT INTO items VALUES (1565, 35.65, 'item1565');
+INSERT INTO items VALUES (1566, 36.66, 'item1566');
+INSERT INTO items VALUES (1567, 37.67, 'item1567');
+INSERT INTO items VALUES (1568, 38.68, 'item1568');
+INSERT INTO items VALUES (1569, 39.69, 'item1569');
+INSERT INTO items VALUES (1570, 40.70, 'item1570');
+INSERT INTO items VALUES (1571, 41.71, 'item1571');
+INSERT INTO items VALUES (1572, 42.72, 'item1572');
+INSERT INTO items VALUES (1573, 43.73, 'item1573');
+INSERT INTO items VALUES (1574, 44.74, 'item1574');
+INSERT INTO items VALUES (1575, 45.75, 'item1575');
+INSERT INTO items VALUES (1576, 46.76, 'item1576');
+INSERT INTO items VALUES (1577, 47.77, 'item1577');
+INSERT INTO items VALUES (1578, 48.78, 'item1578');
+INSERT INTO items VALUES (1579, 49.79, 'item1579');
+INSERT INTO items VALUES (1580, 50.80, 'item1580');
+INSERT INTO items VALUES (1581, 51.81, 'item1581');
+INSERT INTO items VALUES (1582, 52.82, 'item1582');
+INSERT INTO items VALUES (1583, 53.83, 'item1583');
+INSERT INTO items VALUES (1584, 54.84, 'item1584');
+INSERT INTO items VALUES (1585, 55.85, 'item1585');
+INSERT INTO items VALUES (1586, 56.86, 'item1586');
+INSERT INTO items VALUES (1587, 57.87, 'item1587');
+INSERT INTO items VALUES (1588, 58.88, 'item1588');
+INSERT INTO items VALUES (1589, 59.89, 'item1589');
+INSERT INTO items VALUES (1590, 60.90, 'item1590');
+INSERT INTO items VALUES (1591, 61.91, 'item1591');
+INSERT INTO items VALUES (1592, 62.92, 'item1592');
+INSERT INTO items VALUES (1593, 63.93, 'item1593');
+INSERT INTO items VALUES (1594, 64.94, 'item1594');
+INSERT INTO items VALUES (1595, 65.95, 'item1595');
+INSERT INTO items VALUES (1596, 66.96, 'item1596');
+INSERT INTO items VALUES (1597, 67.97, 'item1597');
+INSERT INTO items VALUES (1598, 68.98, 'item1598');
+INSERT INTO items VALUES (1599, 69.99, 'item1599');
+INSERT INTO items VALUES (1600, 70.00, 'item1600');
+INSERT INTO items VALUES (1601, 71.01, 'item1601');
+INSERT INTO items VALUES (1602, 72.02, 'item1602');
+INSERT INTO items VALUES (1603, 73.03, 'item1603');
+INSERT INTO items VALUES (1604, 74.04, 'item1604');
+INSERT INTO items VALUES (1605, 75.05, 'item1605');
+INSERT INTO items VALUES (1606, 76.06, 'item1606');
+INSERT INTO items VALUES (1607, 77.07, 'item1607');
+INSERT INTO items VALUES (1608, 78.08, 'item1608');
+INSERT INTO items VALUES (1609, 79.09, 'item1609');
+INSERT INTO items VALUES (1610, 80.10, 'item1610');
+INSERT INTO items VALUES (1611, 81.11, 'item1611');
+INSERT INTO items VALUES (1612, 82.12, 'item1612');
+INSERT INTO items VALUES (1613, 83.13, 'item1613');
+INSERT INTO items VALUES (1614, 84.14, 'item1614');
+INSERT INTO items VALUES (1615, 85.15, 'item1615');
+INSERT INTO items VALUES (1616, 86.16, 'item1616');
+INSERT INTO items VALUES (1617, 87.17, 'item1617');
+INSERT INTO items VALUES (1618, 88.18, 'item1618');
+INSERT INTO items VALUES (1619, 89.19, 'item1619');
+INSERT INTO items VALUES (1620, 0.20, 'item1620');
+INSERT INTO items VALUES (1621, 1.21, 'item1621');
+INSERT INTO items VALUES (1622, 2.22, 'item1622');
+INSERT INTO items VALUES (1623, 3.23, 'item1623');
+INSERT INTO items VALUES (1624, 4.24, 'item1624');
+INSERT INTO items VALUES (1625, 5.25, 'item1625');
+INSERT INTO items VALUES (1626, 6.26, 'item1626');
+INSERT INTO items VALUES (1627, 7.27, 'item1627');
+INSERT INTO items VALUES (1628, 8.28, 'item1628');
+INSERT INTO items VALUES (1629, 9.29, 'item1629');
+INSERT INTO items VALUES (1630, 10.30, 'item1630');
+INSERT INTO items VALUES (1631, 11.31, 'item1631');
+INSERT INTO items VALUES (1632, 12.32, 'item1632');
+INSERT INTO items VALUES (1633, 13.33, 'item1633');
+INSERT INTO items VALUES (1634, 14.34, 'item1634');
+INSERT INTO items VALUES (1635, 15.35, 'item1635');
+INSERT INTO items VALUES (1636, 16.36, 'item1636');
+INSERT INTO items VALUES (1637, 17.37, 'item1637');
+INSERT INTO items VALUES (1638, 18.38, 'item1638');
+INSERT INTO items VALUES (1639, 19.39, 'item1639');
+INSERT INTO items VALUES (1640, 20.40, 'item1640');
+INSERT INTO items VALUES (1641, 21.41, 'item1641');
+INSERT INTO items VALUES (1642, 22.42, 'item1642');
+INSERT INTO items VALUES (1643, 23.43, 'item1643');
+INSERT INTO items VALUES (1644, 24.44, 'item1644');
+INSERT INTO items VALUES (1645, 25.45, 'item1645');
+INSERT INTO items VALUES (1646, 26.46, 'item1646');
+INSERT INTO items VALUES (1647, 27.47, 'item1647');
+INSERT INTO items VALUES (1648, 28.48, 'item1648');
+INSERT INTO items VALUES (1649, 29.49, 'item1649');
+INSERT INTO items VALUES (1650, 30.50, 'item1650');
+INSERT INTO items VALUES (1651, 31.51, 'item1651');
+INSERT INTO items VALUES (1652, 32.52, 'item1652');
+INSERT INTO items VALUES (1653, 33.53, 'item1653');
+INSERT INTO items VALUES (1654, 34.54, 'item1654');
+INSERT INTO items VALUES (1655, 35.55, 'item1655');
+INSERT INTO items VALUES (1656, 36.56, 'item1656');
+INSERT INTO items VALUES (1657, 37.57, 'item1657');
+INSERT INTO items VALUES (1658, 38.58, 'item1658');
+INSERT INTO items VALUES (1659, 39.59, 'item1659');
+INSERT INTO items VALUES (1660, 40.60, 'item1660');
+INSERT INTO items VALUES (1661, 41.61, 'item1661');
+INSERT INTO items VALUES (1662, 42.62, 'item1662');
+INSERT INTO items VALUES (1663, 43.63, 'item1663');
+INSERT INTO items VALUES (1664, 44.64, 'item1664');
+INSERT INTO items VALUES (1665, 45.65, 'item1665');
+INSERT INTO items VALUES (1666, 46.66, 'item1666');
+INSERT INTO items VALUES (1667, 47.67, 'item1667');
+INSERT INTO items VALUES (1668, 48.68, 'item1668');
+INSERT INTO items VALUES (1669, 49.69, 'item1669');
+INSERT INTO items VALUES (1670, 50.70, 'item1670');
+INSERT INTO items VALUES (1671, 51.71, 'item1671');
+INSERT INTO items VALUES (1672, 52.72, 'item1672');
+INSERT INTO items VALUES (1673, 53.73, 'item1673');
+INSERT INTO items VALUES (1674, 54.74, 'item1674');
+INSERT INTO items VALUES (1675, 55.75, 'item1675');
+INSERT INTO items VALUES (1676, 56.76, 'item1676');
+INSERT INTO items VALUES (1677, 57.77, 'item1677');
+INSERT INTO items VALUES (1678, 58.78, 'item1678');
+INSERT INTO items VALUES (1679, 59.79, 'item1679');
+INSERT INTO items VALUES (1680, 60.80, 'item1680');
+INSERT INTO items VALUES (1681, 61.81, 'item1681');
+INSERT INTO items VALUES (1682, 62.82, 'item1682');
+INSERT INTO items VALUES (1683, 63.83, 'item1683');
+INSERT INTO items VALUES (1684, 64.84, 'item1684');
+INSERT INTO items VALUES (1685, 65.85, 'item1685');
+INSERT INTO items VALUES (1686, 66.86, 'item1686');
+INSERT INTO items VALUES (1687, 67.87, 'item1687');
+INSERT INTO items VALUES (1688, 68.88, 'item1688');
+INSERT INTO items VALUES (1689, 69.89, 'item1689');
+INSERT INTO items VALUES (1690, 70.90, 'item1690');
+INSERT INTO items VALUES (1691, 71.91, 'item1691');
+INSERT INTO items VALUES (1692, 72.92, 'item1692');
+INSERT INTO items VALUES (1693, 73.93, 'item1693');
+INSERT INTO items VALUES (1694, 74.94, 'item1694');
+INSERT INTO items VALUES (1695, 75.95, 'item1695');
+INSERT INTO items VALUES (1696, 76.96, 'item1696');
+INSERT INTO items VALUES (1697, 77.97, 'item1697');
+INSERT INTO items VALUES (1698, 78.98, 'item1698');
+INSERT INTO items VALUES (1699, 79.99, 'item1699');
+INSERT INTO items VALUES (1700, 80.00, 'item1700');
+INSERT INTO items VALUES (1701, 81.01, 'item1701');
+INSERT INTO items VALUES (1702, 82.02, 'item1702');
+INSERT INTO items VALUES (1703, 83.03, 'item1703');
+INSERT INTO items VALUES (1704, 84.04, 'item1704');
+INSERT INTO items VALUES (1705, 85.05, 'item1705');
+INSERT INTO items VALUES (1706, 86.06, 'item1706');
+INSERT INTO items VALUES (1707, 87.07, 'item1707');
+INSERT INTO items VALUES (1708, 88.08, 'item1708');
+INSERT INTO items VALUES (1709, 89.09, 'item1709');
+INSERT INTO items VALUES (1710, 0.10, 'item1710');
+INSERT INTO items VALUES (1711, 1.11, 'item1711');
+INSERT INTO items VALUES (1712, 2.12, 'item1712');
+INSERT INTO items VALUES (1713, 3.13, 'item1713');
+INSERT INTO items VALUES (1714, 4.14, 'item1714');
+INSERT INTO items VALUES (1715, 5.15, 'item1715');
+INSERT INTO items VALUES (1716, 6.16, 'item1716');
+INSERT INTO items VALUES (1717, 7.17, 'item1717');
+INSERT INTO items VALUES (1718, 8.18, 'item1718');
+INSERT INTO items VALUES (1719, 9.19, 'item1719');
+INSERT INTO items VALUES (1720, 10.20, 'item1720');
+INSERT INTO items VALUES (1721, 11.21, 'item1721');
+INSERT INTO items VALUES (1722, 12.22, 'item1722');
+INSERT INTO items VALUES (1723, 13.23, 'item1723');
+INSERT INTO items VALUES (1724, 14.24, 'item1724');
+INSERT INTO items VALUES (1725, 15.25, 'item1725');
+INSERT INTO items VALUES (1726, 16.26, 'item1726');
+INSERT INTO items VALUES (1727, 17.27, 'item1727');
+INSERT INTO items VALUES (1728, 18.28, 'item1728');
+INSERT INTO items VALUES (1729, 19.29, 'item1729');
+INSERT INTO items VALUES (1730, 20.30, 'item1730');
+INSERT INTO items VALUES (1731, 21.31, 'item1731');
+INSERT INTO items VALUES (1732, 22.32, 'item1732');
+INSERT INTO items VALUES (1733, 23.33, 'item1733');
+INSERT INTO items VALUES (1734, 24.34, 'item1734');
+INSERT INTO items VALUES (1735, 25.35, 'item1735');
+INSERT INTO items VALUES (1736, 26.36, 'item1736');
+INSERT INTO items VALUES (1737, 27.37, 'item1737');
+INSERT INTO items VALUES (1738, 28.38, 'item1738');
+INSERT INTO items VALUES (1739, 29.39, 'item1739');
+INSERT INTO items VALUES (1740, 30.40, 'item1740');
+INSERT INTO items VALUES (1741, 31.41, 'item1741');
+INSERT INTO items VALUES (1742, 32.42, 'item1742');
+INSERT INTO items VALUES (1743, 33.43, 'item1743');
+INSERT INTO items VALUES (1744, 34.44, 'item1744');
+INSERT INTO items VALUES (1745, 35.45, 'item1745');
+INSERT INTO items VALUES (1746, 36.46, 'item1746');
+INSERT INTO items VALUES (1747, 37.47, 'item1747');
+INSERT INTO items VALUES (1748, 38.48, 'item1748');
+INSERT INTO items VALUES (1749, 39.49, 'item1749');
+INSERT INTO items VALUES (1750, 40.50, 'item1750');
+INSERT INTO items VALUES (1751, 41.51, 'item1751');
+INSERT INTO items VALUES (1752, 42.52, 'item1752');
+INSERT INTO items VALUES (1753, 43.53, 'item1753');
+INSERT INTO items VALUES (1754, 44.54, 'item1754');
+INSERT INTO items VALUES (1755, 45.55, 'item1755');
+INSERT INTO items VALUES (1756, 46.56, 'item1756');
+INSERT INTO items VALUES (1757, 47.57, 'item1757');
+INSERT INTO items VALUES (1758, 48.58, 'item1758');
+INSERT INTO items VALUES (1759, 49.59, 'item1759');
+INSERT INTO items VALUES (1760, 50.60, 'item1760');
+INSERT INTO items VALUES (1761, 51.61, 'item1761');
+INSERT INTO items VALUES (1762, 52.62, 'item1762');
+INSERT INTO items VALUES (1763, 53.63, 'item1763');
+INSERT INTO items VALUES (1764, 54.64, 'item1764');
+INSERT INTO items VALUES (1765, 55.65, 'item1765');
+INSERT INTO items VALUES (1766, 56.66, 'item1766');
+INSERT INTO items VALUES (1767, 57.67, 'item1767');
+INSERT INTO items VALUES (1768, 58.68, 'item1768');
+INSERT INTO items VALUES (1769, 59.69, 'item1769');
+INSERT INTO items VALUES (1770, 60.70, 'item1770');
+INSERT INTO items VALUES (1771, 61.71, 'item1771');
+INSERT INTO items VALUES (1772, 62.72, 'item1772');
+INSERT INTO items VALUES (1773, 63.73, 'item1773');
+INSERT INTO items VALUES (1774, 64.74, 'item1774');
+INSERT INTO items VALUES (1775, 65.75, 'item1775');
+INSERT INTO items VALUES (1776, 66.76, 'item1776');
+INSERT INTO items VALUES (1777, 67.77, 'item1777');
+INSERT INTO items VALUES (1778, 68.78, 'item1778');
+INSERT INTO items VALUES (1779, 69.79, 'item1779');
+INSERT INTO items VALUES (1780, 70.80, 'item1780');
+INSERT INTO items VALUES (1781, 71.81, 'item1781');
+INSERT INTO items VALUES (1782, 72.82, 'item1782');
+INSERT INTO items VALUES (1783, 73.83, 'item1783');
+INSERT INTO items VALUES (1784, 74.84, 'item1784');
+INSERT INTO items VALUES (1785, 75.85, 'item1785');
+INSERT INTO items VALUES (1786, 76.86, 'item1786');
+INSERT INTO items VALUES (1787, 77.87, 'item1787');
+INSERT INTO items VALUES (1788, 78.88, 'item1788');
+INSERT INTO items VALUES (1789, 79.89, 'item1789');
+INSERT INTO items VALUES (1790, 80.90, 'item1790');
+INSERT INTO items VALUES (1791, 81.91, 'item1791');
+INSERT INTO items VALUES (1792, 82.92, 'item1792');
+INSERT INTO items VALUES (1793, 83.93, 'item1793');
+INSERT INTO items VALUES (1794, 84.94, 'item1794');
+INSERT INTO items VALUES (1795, 85.95, 'item1795');
+INSERT INTO items VALUES (1796, 86.96, 'item1796');
+INSERT INTO items VALUES (1797, 87.97, 'item1797');
+INSERT INTO items VALUES (1798, 88.98, 'item1798');
+INSERT INTO items VALUES (1799, 89.99, 'item1799');
+INSERT INTO items VALUES (1800, 0.00, 'item1800');
+INSERT INTO items VALUES (1801, 1.01, 'item1801');
+INSERT INTO items VALUES (1802, 2.02, 'item1802');
+INSERT INTO items VALUES (1803, 3.03, 'item1803');
+INSERT INTO items VALUES (1804, 4.04, 'item1804');
+INSERT INTO items VALUES (1805, 5.05, 'item1805');
+INSERT INTO items VALUES (1806, 6.06, 'item1806');
+INSERT INTO items VALUES (1807, 7.07, 'item1807');
+INSERT INTO items VALUES (1808, 8.08, 'item1808');
+INSERT INTO items VALUES (1809, 9.09, 'item1809');
+INSERT INTO items VALUES (1810, 10.10, 'item1810');
+INSERT INTO items VALUES (1811, 11.11, 'item1811');
+INSERT INTO items VALUES (1812, 12.12, 'item1812');
+INSERT INTO items VALUES (1813, 13.13, 'item1813');
+INSERT INTO items VALUES (1814, 14.14, 'item1814');
+INSERT INTO items VALUES (1815, 15.15, 'item1815');
+INSERT INTO items VALUES (1816, 16.16, 'item1816');
+INSERT INTO items VALUES (1817, 17.17, 'item1817');
+INSERT INTO items VALUES (1818, 18.18, 'item1818');
+INSERT INTO items VALUES (1819, 19.19, 'item1819');
+INSERT INTO items VALUES (1820, 20.20, 'item1820');
+INSERT INTO items VALUES (1821, 21.21, 'item1821');
+INSERT INTO items VALUES (1822, 22.22, 'item1822');
+INSERT INTO items VALUES (1823, 23.23, 'item1823');
+INSERT INTO items VALUES (1824, 24.24, 'item1824');
+INSERT INTO items VALUES (1825, 25.25, 'item1825');
+INSERT INTO items VALUES (1826, 26.26, 'item1826');
+INSERT INTO items VALUES (1827, 27.27, 'item1827');
+INSERT INTO items VALUES (1828, 28.28, 'item1828');
+INSERT INTO items VALUES (1829, 29.29, 'item1829');
+INSERT INTO items VALUES (1830, 30.30, 'item1830');
+INSERT INTO items VALUES (1831, 31.31, 'item1831');
+INSERT INTO items VALUES (1832, 32.32, 'item1832');
+INSERT INTO items VALUES (1833, 33.33, 'item1833');
+INSERT INTO items VALUES (1834, 34.34, 'item1834');
+INSERT INTO items VALUES (1835, 35.35, 'item1835');
+INSERT INTO items VALUES (1836, 36.36, 'item1836');
+INSERT INTO items VALUES (1837, 37.37, 'item1837');
+INSERT INTO items VALUES (1838, 38.38, 'item1838');
+INSERT INTO items VALUES (1839, 39.39, 'item1839');
+INSERT INTO items VALUES (1840, 40.40, 'item1840');
+INSERT INTO items VALUES (1841, 41.41, 'item1841');
+INSERT INTO items VALUES (1842, 42.42, 'item1842');
+INSERT INTO items VALUES (1843, 43.43, 'item1843');
+INSERT INTO items VALUES (1844, 44.44, 'item1844');
+INSERT INTO items VALUES (1845, 45.45, 'item1845');
+INSERT INTO items VALUES (1846, 46.46, 'item1846');
+INSERT INTO items VALUES (1847, 47.47, 'item1847');
+INSERT INTO items VALUES (1848, 48.48, 'item1848');
+INSERT INTO items VALUES (1849, 49.49, 'item1849');
+INSERT INTO items VALUES (1850, 50.50, 'item1850');
+INSERT INTO items VALUES (1851, 51.51, 'item1851');
+INSERT INTO items VALUES (1852, 52.52, 'item1852');
+INSERT INTO items VALUES (1853, 53.53, 'item1853');
+INSERT INTO items VALUES (1854, 54.54, 'item1854');
+INSERT INTO items VALUES (1855, 55.55, 'item1855');
+INSERT INTO items VALUES (1856, 56.56, 'item1856');
+INSERT INTO items VALUES (1857, 57.57, 'item1857');
+INSERT INTO items VALUES (1858, 58.58, 'item1858');
+INSERT INTO items VALUES (1859, 59.59, 'item1859');
+INSERT INTO items VALUES (1860, 60.60, 'item1860');
+INSERT INTO items VALUES (1861, 61.61, 'item1861');
+INSERT INTO items VALUES (1862, 62.62, 'item1862');
+INSERT INTO items VALUES (1863, 63.63, 'item1863');
+INSERT INTO items VALUES (1864, 64.64, 'item1864');
+INSERT INTO items VALUES (1865, 65.65, 'item1865');
+INSERT INTO items VALUES (1866, 66.66, 'item1866');
+INSERT INTO items VALUES (1867, 67.67, 'item1867');
+INSERT INTO items VALUES (1868, 68.68, 'item1868');
+INSERT INTO items VALUES (1869, 69.69, 'item1869');
+INSERT INTO items VALUES (1870, 70.70, 'item1870');
+INSERT INTO items VALUES (1871, 71.71, 'item1871');
+INSERT INTO items VALUES (1872, 72.72, 'item1872');
+INSERT INTO items VALUES (1873, 73.73, 'item1873');
+INSERT INTO items VALUES (1874, 74.74, 'item1874');
+INSERT INTO items VALUES (1875, 75.75, 'item1875');
+INSERT INTO items VALUES (1876, 76.76, 'item1876');
+INSERT INTO items VALUES (1877, 77.77, 'item1877');
+INSERT INTO items VALUES (1878, 78.78, 'item1878');
+INSERT INTO items VALUES (1879, 79.79, 'item1879');
+INSERT INTO items VALUES (1880, 80.80, 'item1880');
+INSERT INTO items VALUES (1881, 81.81, 'item1881');
+INSERT INTO items VALUES (1882, 82.82, 'item1882');
+INSERT INTO items VALUES (1883, 83.83, 'item1883');
+INSERT INTO items VALUES (1884, 84.84, 'item1884');
+INSERT INTO items VALUES (1885, 85.85, 'item1885');
+INSERT INTO items VALUES (1886, 86.86, 'item1886');
+INSERT INTO items VALUES (1887, 87.87, 'item1887');
+INSERT INTO items VALUES (1888, 88.88, 'item1888');
+INSERT INTO items VALUES (1889, 89.89, 'item1889');
+INSERT INTO items VALUES (1890, 0.90, 'item1890');
+INSERT INTO items VALUES (1891, 1.91, 'item1891');
+INSERT INTO items VALUES (1892, 2.92, 'item1892');
+INSERT INTO items VALUES (1893, 3.93, 'item1893');
+INSERT INTO items VALUES (1894, 4.94, 'item1894');
+INSERT INTO items VALUES (1895, 5.95, 'item1895');
+INSERT INTO items VALUES (1896, 6.96, 'item1896');
+INSERT INTO items VALUES (1897, 7.97, 'item1897');
+INSERT INTO items VALUES (1898, 8.98, 'item1898');
+INSERT INTO items VALUES (1899, 9.99, 'item1899');
+INSERT INTO items VALUES (1900, 10.00, 'item1900');
+INSERT INTO items VALUES (1901, 11.01, 'item1901');
+INSERT INTO items VALUES (1902, 12.02, 'item1902');
+INSERT INTO items VALUES (1903, 13.03, 'item1903');
+INSERT INTO items VALUES (1904, 14.04, 'item1904');
+INSERT INTO items VALUES (1905, 15.05, 'item1905');
+INSERT INTO items VALUES (1906, 16.06, 'item1906');
+INSERT INTO items VALUES (1907, 17.07, 'item1907');
+INSERT INTO items VALUES (1908, 18.08, 'item1908');
+INSERT INTO items VALUES (1909, 19.09, 'item1909');
+INSERT INTO items VALUES (1910, 20.10, 'item1910');
+INSERT INTO items VALUES (1911, 21.11, 'item1911');
+INSERT INTO items VALUES (1912, 22.12, 'item1912');
+INSERT INTO items VALUES (1913, 23.13, 'item1913');
+INSERT INTO items VALUES (1914, 24.14, 'item1914');
+INSERT INTO items VALUES (1915, 25.15, 'item1915');
+INSERT INTO items VALUES (1916, 26.16, 'item1916');
+INSERT INTO items VALUES (1917, 27.17, 'item1917');
+INSERT INTO items VALUES (1918, 28.18, 'item1918');
+INSERT INTO items VALUES (1919, 29.19, 'item1919');
+INSERT INTO items VALUES (1920, 30.20, 'item1920');
+INSERT INTO items VALUES (1921, 31.21, 'item1921');
+INSERT INTO items VALUES (1922, 32.22, 'item1922');
+INSERT INTO items VALUES (1923, 33.23, 'item1923');
+INSERT INTO items VALUES (1924, 34.24, 'item1924');
+INSERT INTO items VALUES (1925, 35.25, 'item1925');
+INSERT INTO items VALUES (1926, 36.26, 'item1926');
+INSERT INTO items VALUES (1927, 37.27, 'item1927');
+INSERT INTO items VALUES (1928, 38.28, 'item1928');
+INSERT INTO items VALUES (1929, 39.29, 'item1929');
+INSERT INTO items VALUES (1930, 40.30, 'item1930');
+INSERT INTO items VALUES (1931, 41.31, 'item1931');
+INSERT INTO items VALUES (1932, 42.32, 'item1932');
+INSERT INTO items VALUES (1933, 43.33, 'item1933');
+INSERT INTO items VALUES (1934, 44.34, 'item1934');
+INSERT INTO items VALUES (1935, 45.35, 'item1935');
+INSERT INTO items VALUES (1936, 46.36, 'item1936');
+INSERT INTO items VALUES (1937, 47.37, 'item1937');
+INSERT INTO items VALUES (1938, 48.38, 'item1938');
+INSERT INTO items VALUES (1939, 49.39, 'item1939');
+INSERT INTO items VALUES (1940, 50.40, 'item1940');
+INSERT INTO items VALUES (1941, 51.41, 'item1941');
+INSERT INTO items VALUES (1942, 52.42, 'item1942');
+INSERT INTO items VALUES (1943, 53.43, 'item1943');
+INSERT INTO items VALUES (1944, 54.44, 'item1944');
+INSERT INTO items VALUES (1945, 55.45, 'item1945');
+INSERT INTO items VALUES (1946, 56.46, 'item1946');
+INSERT INTO items VALUES (1947, 57.47, 'item1947');
+INSERT INTO items VALUES (1948, 58.48, 'item1948');
+INSERT INTO items VALUES (1949, 59.49, 'item1949');
+INSERT INTO items VALUES (1950, 60.50, 'item1950');
+INSERT INTO items VALUES (1951, 61.51, 'item1951');
+INSERT INTO items VALUES (1952, 62.52, 'item1952');
+INSERT INTO items VALUES (1953, 63.53, 'item1953');
+INSERT INTO items VALUES (1954, 64.54, 'item1954');
+INSERT INTO items VALUES (1955, 65.55, 'item1955');
+INSERT INTO items VALUES (1956, 66.56, 'item1956');
+INSERT INTO items VALUES (1957, 67.57, 'item1957');
+INSERT INTO items VALUES (1958, 68.58, 'item1958');
+INSERT INTO items VALUES (1959, 69.59, 'item1959');
+INSERT INTO items VALUES (1960, 70.60, 'item1960');
+INSERT INTO items VALUES (1961, 71.61, 'item1961');
+INSERT INTO items VALUES (1962, 72.62, 'item1962');
+INSERT INTO items VALUES (1963, 73.63, 'item1963');
+INSERT INTO items VALUES (1964, 74.64, 'item1964');
+INSERT INTO items VALUES (1965, 75.65, 'item1965');
+INSERT INTO items VALUES (1966, 76.66, 'item1966');
+INSERT INTO items VALUES (1967, 77.67, 'item1967');
+INSERT INTO items VALUES (1968, 78.68, 'item1968');
+INSERT INTO items VALUES (1969, 79.69, 'item1969');
+INSERT INTO items VALUES (1970, 80.70, 'item1970');
+INSERT INTO items VALUES (1971, 81.71, 'item1971');
+INSERT INTO items VALUES (1972, 82.72, 'item1972');
+INSERT INTO items VALUES (1973, 83.73, 'item1973');
+INSERT INTO items VALUES (1974, 84.74, 'item1974');
+INSERT INTO items VALUES (1975, 85.75, 'item1975');
+INSERT INTO items VALUES (1976, 86.76, 'item1976');
+INSERT INTO items VALUES (1977, 87.77, 'item1977');
+INSERT INTO items VALUES (1978, 88.78, 'item1978');
+INSERT INTO items VALUES (1979, 89.79, 'item1979');
+INSERT INTO items VALUES (1980, 0.80, 'item1980');
+INSERT INTO items VALUES (1981, 1.81, 'item1981');
+INSERT INTO items VALUES (1982, 2.82, 'item1982');
+INSERT INTO items VALUES (1983, 3.83, 'item1983');
+INSERT INTO items VALUES (1984, 4.84, 'item1984');
+INSERT INTO items VALUES (1985, 5.85, 'item1985');
+INSERT INTO items VALUES (1986, 6.86, 'item1986');
+INSERT INTO items VALUES (1987, 7.87, 'item1987');
+INSERT INTO items VALUES (1988, 8.88, 'item1988');
+INSERT INTO items VALUES (1989, 9.89, 'item1989');
+INSERT INTO items VALUES (1990, 10.90, 'item1990');
+INSERT INTO items VALUES (1991, 11.91, 'item1991');
+INSERT INTO items VALUES (1992, 12.92, 'item1992');
+INSERT INTO items VALUES (1993, 13.93, 'item1993');
+INSERT INTO items VALUES (1994, 14.94, 'item1994');
+INSERT INTO items VALUES (1995, 15.95, 'item1995');
+INSERT INTO items VALUES (1996, 16.96, 'item1996');
+INSERT INTO items VALUES (1997, 17.97, 'item1997');
+INSERT INTO items VALUES (1998, 18.98, 'item1998');
+INSERT INTO items VALUES (1999, 19.99, 'item1999');
+INSERT INTO labels VALUES ('t0', 'label t0');
+INSERT INTO labels VALUES ('t7', 'label t7');
+INSERT INTO labels VALUES ('t59', 'label t59');
+INSERT INTO labels VALUES ('x1', 'label x1');
+INSERT INTO labels VALUES ('t7', 'label t7');
+INSERT INTO labels VALUES ('fresh', 'label fresh');
+INSERT INTO labels VALUES ('item5', 'label item5');
+SELECT id, item FROM notes WHERE tag = 't7' AND id > 2500;
+SELECT id, tag FROM notes WHERE tag != 't1' AND id > 2990;
+SELECT id FROM notes WHERE tag = 'missing';
+SELECT id FROM notes WHERE tag != 'missing' AND id < 3;
+SELECT id, price FROM items WHERE name = 'item1999' OR name = 'item0';
+SELECT id, name FROM items WHERE name != 'item3' AND id < 5;
+SELECT labels.text, notes.id FROM labels INNER JOIN notes ON labels.tag = notes.tag WHERE notes.id > 2900;
+SELECT notes.id, labels.text FROM notes INNER JOIN labels ON notes.tag = labels.tag WHERE notes.id < 200;
+SELECT labels.text, items.id, items.price FROM labels INNER JOIN items ON labels.tag = items.name;
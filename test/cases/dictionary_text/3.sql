@@ -0,0 +1,11 @@
+USE DATABASE shop;
+SELECT id, item FROM notes WHERE tag = 't7' AND id > 2500;
+SELECT id, tag FROM notes WHERE tag != 't1' AND id > 2990;
+SELECT id FROM notes WHERE tag = 'missing';
+SELECT id FROM notes WHERE tag != 'missing' AND id < 3;
+SELECT id, price FROM items WHERE name = 'item1999' OR name = 'item0';
+SELECT id, name FROM items WHERE name != 'item3' AND id < 5;
+SELECT labels.text, notes.id FROM labels INNER JOIN notes ON labels.tag = notes.tag WHERE notes.id > 2900;
+SELECT notes.id, labels.text FROM notes INNER JOIN labels ON notes.tag = labels.tag WHERE notes.id < 200;
+SELECT labels.text, items.id, items.price FROM labels INNER JOIN items ON labels.tag = items.name;
+SELECT id, tag FROM notes WHERE tag = 'fresh';
@@ -0,0 +1,28 @@
+CREATE DATABASE shop;
+USE DATABASE shop;
+CREATE TABLE items (id INTEGER, price FLOAT, name TEXT);
+CREATE TABLE orders (id INTEGER, item_id INTEGER, qty INTEGER);
+CREATE TABLE notes (id INTEGER, order_id INTEGER, tag TEXT);
+INSERT INTO items VALUES (1, 1.50, 'pen');
+INSERT INTO items VALUES (2, 7.25, 'ink');
+INSERT INTO items VALUES (3, 3.00, 'pad');
+INSERT INTO items VALUES (4, 12.00, 'lamp');
+INSERT INTO orders VALUES (10, 1, 2);
+INSERT INTO orders VALUES (11, 2, 1);
+INSERT INTO orders VALUES (12, 2, 5);
+INSERT INTO orders VALUES (13, 4, 1);
+INSERT INTO notes VALUES (100, 11, 'gift');
+INSERT INTO notes VALUES (101, 12, 'rush');
+INSERT INTO notes VALUES (102, 13, 'gift');
+EXPLAIN SELECT id, name FROM items WHERE price > 2.00 AND (id = 1 OR id = 4) LIMIT 1;
+EXPLAIN SELECT * FROM items;
+EXPLAIN SELECT items.name, orders.qty FROM items INNER JOIN orders ON items.id = orders.item_id;
+EXPLAIN SELECT items.name, orders.qty, notes.tag FROM items INNER JOIN orders ON items.id = orders.item_id INNER JOIN notes ON orders.id = notes.order_id WHERE notes.tag = 'gift';
+EXPLAIN SELECT items.id, orders.id FROM items INNER JOIN orders ON items.id < orders.item_id;
+EXPLAIN INSERT INTO items VALUES (5, 0.50, 'cap');
+EXPLAIN UPDATE items SET price = price * 2 WHERE id > 2;
+EXPLAIN DELETE FROM orders WHERE qty = 1;
+EXPLAIN DELETE FROM notes;
+SELECT * FROM items;
+SELECT id FROM orders;
+SELECT id FROM notes;
@@ -0,0 +1,9 @@
+USE DATABASE shop;
+EXPLAIN ANALYZE SELECT id, name FROM items WHERE price > 2.00 AND (id = 1 OR id = 4);
+EXPLAIN ANALYZE SELECT items.name, orders.qty, notes.tag FROM items INNER JOIN orders ON items.id = orders.item_id INNER JOIN notes ON orders.id = notes.order_id WHERE notes.tag = 'gift';
+EXPLAIN ANALYZE SELECT items.id, orders.id FROM items INNER JOIN orders ON items.id < orders.item_id;
+EXPLAIN ANALYZE INSERT INTO items VALUES (5, 0.50, 'cap');
+EXPLAIN ANALYZE UPDATE items SET price = price * 2 WHERE id > 2;
+EXPLAIN ANALYZE DELETE FROM orders WHERE qty = 1;
+SELECT * FROM items;
+SELECT id FROM orders;
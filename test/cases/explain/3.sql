@@ -0,0 +1,4 @@
+USE DATABASE shop;
+SELECT * FROM items;
+SELECT id FROM orders;
+EXPLAIN CREATE TABLE tags (id INTEGER);
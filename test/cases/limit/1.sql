@@ -0,0 +1,19 @@
+CREATE DATABASE school;
+USE DATABASE school;
+CREATE TABLE students (id INTEGER, name TEXT, gpa FLOAT);
+INSERT INTO students VALUES (1, 'Ann', 3.50);
+INSERT INTO students VALUES (2, 'Bob', 2.80);
+INSERT INTO students VALUES (3, 'Cid', 3.90);
+INSERT INTO students VALUES (4, 'Dee', 3.10);
+INSERT INTO students VALUES (5, 'Eve', 3.70);
+CREATE TABLE grades (student_id INTEGER, course TEXT);
+INSERT INTO grades VALUES (1, 'math');
+INSERT INTO grades VALUES (3, 'math');
+INSERT INTO grades VALUES (3, 'art');
+INSERT INTO grades VALUES (5, 'art');
+SELECT * FROM students LIMIT 2;
+SELECT name FROM students WHERE gpa > 3.20 LIMIT 2;
+SELECT id FROM students LIMIT 0;
+SELECT id FROM students WHERE id > 3 LIMIT 10;
+SELECT students.name, grades.course FROM students INNER JOIN grades ON students.id = grades.student_id LIMIT 3;
+SELECT students.name, grades.course FROM students INNER JOIN grades ON students.id = grades.student_id WHERE grades.course = 'art' LIMIT 1;
@@ -0,0 +1,4 @@
+USE DATABASE school;
+SELECT id FROM students LIMIT 1;
+SELECT id FROM students LIMIT -1;
+SELECT id FROM students LIMIT 2;
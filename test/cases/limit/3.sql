@@ -0,0 +1,4 @@
+USE DATABASE school;
+SELECT id FROM students LIMIT 2147483647;
+SELECT id FROM students
+LIMIT 99999999999;
@@ -0,0 +1,2 @@
+USE DATABASE shop;
+SELECT * FROM items;
@@ -0,0 +1,2 @@
+USE DATABASE ledger;
+SELECT * FROM entries;
@@ -0,0 +1,3 @@
+USE DATABASE ledger;
+INSERT INTO entries VALUES (6, 60.00, 'after recovery');
+SELECT * FROM entries;
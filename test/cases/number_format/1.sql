@@ -0,0 +1,15 @@
+CREATE DATABASE numbers;
+USE DATABASE numbers;
+CREATE TABLE samples (id INTEGER, amount FLOAT, label TEXT);
+INSERT INTO samples VALUES (0, 0.0, 'zero');
+INSERT INTO samples VALUES (-1, -0.004, 'small negative');
+INSERT INTO samples VALUES (2147483647, 3.14159, 'pi');
+INSERT INTO samples VALUES (-2147483647, -2.5, 'negative');
+INSERT INTO samples VALUES (42, 12345678.9, 'large');
+INSERT INTO samples VALUES (7, 0.006, 'rounds up');
+INSERT INTO samples VALUES (100000, 99.999, 'carries');
+INSERT INTO samples VALUES (8, 10000000000.126, 'ten digits');
+SELECT * FROM samples;
+UPDATE samples SET amount = amount * 3 WHERE id = 42;
+UPDATE samples SET id = id - 100 WHERE label = 'zero';
+SELECT id, amount FROM samples WHERE id < 50;
@@ -0,0 +1,6003 @@
+CREATE DATABASE store;
+USE DATABASE store;
+CREATE TABLE items (id INTEGER, grp INTEGER, price FLOAT, name TEXT);
+INSERT INTO items VALUES (0, 0, 0.00, 'item0');
+INSERT INTO items VALUES (1, 1, 0.25, 'item1');
+INSERT INTO items VALUES (2, 2, 0.50, 'item2');
+INSERT INTO items VALUES (3, 3, 0.75, 'item3');
+INSERT INTO items VALUES (4, 4, 1.00, 'item4');
+INSERT INTO items VALUES (5, 5, 1.25, 'item5');
+INSERT INTO items VALUES (6, 6, 1.50, 'item6');
+INSERT INTO items VALUES (7, 7, 1.75, 'item7');
+INSERT INTO items VALUES (8, 8, 2.00, 'item8');
+INSERT INTO items VALUES (9, 9, 2.25, 'item9');
+INSERT INTO items VALUES (10, 10, 2.50, 'item10');
+INSERT INTO items VALUES (11, 11, 2.75, 'item11');
+INSERT INTO items VALUES (12, 12, 3.00, 'item12');
+INSERT INTO items VALUES (13, 13, 3.25, 'item13');
+INSERT INTO items VALUES (14, 14, 3.50, 'item14');
+INSERT INTO items VALUES (15, 15, 3.75, 'item15');
+INSERT INTO items VALUES (16, 16, 4.00, 'item16');
+INSERT INTO items VALUES (17, 17, 4.25, 'item17');
+INSERT INTO items VALUES (18, 18, 4.50, 'item18');
+INSERT INTO items VALUES (19, 19, 4.75, 'item19');
+INSERT INTO items VALUES (20, 20, 5.00, 'item20');
+INSERT INTO items VALUES (21, 21, 5.25, 'item21');
+INSERT INTO items VALUES (22, 22, 5.50, 'item22');
+INSERT INTO items VALUES (23, 23, 5.75, 'item23');
+INSERT INTO items VALUES (24, 24, 6.00, 'item24');
+INSERT INTO items VALUES (25, 25, 6.25, 'item25');
+INSERT INTO items VALUES (26, 26, 6.50, 'item26');
+INSERT INTO items VALUES (27, 27, 6.75, 'item27');
+INSERT INTO items VALUES (28, 28, 7.00, 'item28');
+INSERT INTO items VALUES (29, 29, 7.25, 'item29');
+INSERT INTO items VALUES (30, 30, 7.50, 'item30');
+INSERT INTO items VALUES (31, 31, 7.75, 'item31');
+INSERT INTO items VALUES (32, 32, 8.00, 'item32');
+INSERT INTO items VALUES (33, 33, 8.25, 'item33');
+INSERT INTO items VALUES (34, 34, 8.50, 'item34');
+INSERT INTO items VALUES (35, 35, 8.75, 'item35');
+INSERT INTO items VALUES (36, 36, 9.00, 'item36');
+INSERT INTO items VALUES (37, 37, 9.25, 'item37');
+INSERT INTO items VALUES (38, 38, 9.50, 'item38');
+INSERT INTO items VALUES (39, 39, 9.75, 'item39');
+INSERT INTO items VALUES (40, 0, 10.00, 'item40');
+INSERT INTO items VALUES (41, 1, 10.25, 'item41');
+INSERT INTO items VALUES (42, 2, 10.50, 'item42');
+INSERT INTO items VALUES (43, 3, 10.75, 'item43');
+INSERT INTO items VALUES (44, 4, 11.00, 'item44');
+INSERT INTO items VALUES (45, 5, 11.25, 'item45');
+INSERT INTO items VALUES (46, 6, 11.50, 'item46');
+INSERT INTO items VALUES (47, 7, 11.75, 'item47');
+INSERT INTO items VALUES (48, 8, 12.00, 'item48');
+INSERT INTO items VALUES (49, 9, 12.25, 'item49');
+INSERT INTO items VALUES (50, 10, 12.50, 'item50');
+INSERT INTO items VALUES (51, 11, 12.75, 'item51');
+INSERT INTO items VALUES (52, 12, 13.00, 'item52');
+INSERT INTO items VALUES (53, 13, 13.25, 'item53');
+INSERT INTO items VALUES (54, 14, 13.50, 'item54');
+INSERT INTO items VALUES (55, 15, 13.75, 'item55');
+INSERT INTO items VALUES (56, 16, 14.00, 'item56');
+INSERT INTO items VALUES (57, 17, 14.25, 'item57');
+INSERT INTO items VALUES (58, 18, 14.50, 'item58');
+INSERT INTO items VALUES (59, 19, 14.75, 'item59');
+INSERT INTO items VALUES (60, 20, 15.00, 'item60');
+INSERT INTO items VALUES (61, 21, 15.25, 'item61');
+INSERT INTO items VALUES (62, 22, 15.50, 'item62');
+INSERT INTO items VALUES (63, 23, 15.75, 'item63');
+INSERT INTO items VALUES (64, 24, 16.00, 'item64');
+INSERT INTO items VALUES (65, 25, 16.25, 'item65');
+INSERT INTO items VALUES (66, 26, 16.50, 'item66');
+INSERT INTO items VALUES (67, 27, 16.75, 'item67');
+INSERT INTO items VALUES (68, 28, 17.00, 'item68');
+INSERT INTO items VALUES (69, 29, 17.25, 'item69');
+INSERT INTO items VALUES (70, 30, 17.50, 'item70');
+INSERT INTO items VALUES (71, 31, 17.75, 'item71');
+INSERT INTO items VALUES (72, 32, 18.00, 'item72');
+INSERT INTO items VALUES (73, 33, 18.25, 'item73');
+INSERT INTO items VALUES (74, 34, 18.50, 'item74');
+INSERT INTO items VALUES (75, 35, 18.75, 'item75');
+INSERT INTO items VALUES (76, 36, 19.00, 'item76');
+INSERT INTO items VALUES (77, 37, 19.25, 'item77');
+INSERT INTO items VALUES (78, 38, 19.50, 'item78');
+INSERT INTO items VALUES (79, 39, 19.75, 'item79');
+INSERT INTO items VALUES (80, 0, 20.00, 'item80');
+INSERT INTO items VALUES (81, 1, 20.25, 'item81');
+INSERT INTO items VALUES (82, 2, 20.50, 'item82');
+INSERT INTO items VALUES (83, 3, 20.75, 'item83');
+INSERT INTO items VALUES (84, 4, 21.00, 'item84');
+INSERT INTO items VALUES (85, 5, 21.25, 'item85');
+INSERT INTO items VALUES (86, 6, 21.50, 'item86');
+INSERT INTO items VALUES (87, 7, 21.75, 'item87');
+INSERT INTO items VALUES (88, 8, 22.00, 'item88');
+INSERT INTO items VALUES (89, 9, 22.25, 'item89');
+INSERT INTO items VALUES (90, 10, 22.50, 'item90');
+INSERT INTO items VALUES (91, 11, 22.75, 'item91');
+INSERT INTO items VALUES (92, 12, 23.00, 'item92');
+INSERT INTO items VALUES (93, 13, 23.25, 'item93');
+INSERT INTO items VALUES (94, 14, 23.50, 'item94');
+INSERT INTO items VALUES (95, 15, 23.75, 'item95');
+INSERT INTO items VALUES (96, 16, 24.00, 'item96');
+INSERT INTO items VALUES (97, 17, 24.25, 'item97');
+INSERT INTO items VALUES (98, 18, 24.50, 'item98');
+INSERT INTO items VALUES (99, 19, 24.75, 'item99');
+INSERT INTO items VALUES (100, 20, 25.00, 'item100');
+INSERT INTO items VALUES (101, 21, 25.25, 'item101');
+INSERT INTO items VALUES (102, 22, 25.50, 'item102');
+INSERT INTO items VALUES (103, 23, 25.75, 'item103');
+INSERT INTO items VALUES (104, 24, 26.00, 'item104');
+INSERT INTO items VALUES (105, 25, 26.25, 'item105');
+INSERT INTO items VALUES (106, 26, 26.50, 'item106');
+INSERT INTO items VALUES (107, 27, 26.75, 'item107');
+INSERT INTO items VALUES (108, 28, 27.00, 'item108');
+INSERT INTO items VALUES (109, 29, 27.25, 'item109');
+INSERT INTO items VALUES (110, 30, 27.50, 'item110');
+INSERT INTO items VALUES (111, 31, 27.75, 'item111');
+INSERT INTO items VALUES (112, 32, 28.00, 'item112');
+INSERT INTO items VALUES (113, 33, 28.25, 'item113');
+INSERT INTO items VALUES (114, 34, 28.50, 'item114');
+INSERT INTO items VALUES (115, 35, 28.75, 'item115');
+INSERT INTO items VALUES (116, 36, 29.00, 'item116');
+INSERT INTO items VALUES (117, 37, 29.25, 'item117');
+INSERT INTO items VALUES (118, 38, 29.50, 'item118');
+INSERT INTO items VALUES (119, 39, 29.75, 'item119');
+INSERT INTO items VALUES (120, 0, 30.00, 'item120');
+INSERT INTO items VALUES (121, 1, 30.25, 'item121');
+INSERT INTO items VALUES (122, 2, 30.50, 'item122');
+INSERT INTO items VALUES (123, 3, 30.75, 'item123');
+INSERT INTO items VALUES (124, 4, 31.00, 'item124');
+INSERT INTO items VALUES (125, 5, 31.25, 'item125');
+INSERT INTO items VALUES (126, 6, 31.50, 'item126');
+INSERT INTO items VALUES (127, 7, 31.75, 'item127');
+INSERT INTO items VALUES (128, 8, 32.00, 'item128');
+INSERT INTO items VALUES (129, 9, 32.25, 'item129');
+INSERT INTO items VALUES (130, 10, 32.50, 'item130');
+INSERT INTO items VALUES (131, 11, 32.75, 'item131');
+INSERT INTO items VALUES (132, 12, 33.00, 'item132');
+INSERT INTO items VALUES (133, 13, 33.25, 'item133');
+INSERT INTO items VALUES (134, 14, 33.50, 'item134');
+INSERT INTO items VALUES (135, 15, 33.75, 'item135');
+INSERT INTO items VALUES (136, 16, 34.00, 'item136');
+INSERT INTO items VALUES (137, 17, 34.25, 'item137');
+INSERT INTO items VALUES (138, 18, 34.50, 'item138');
+INSERT INTO items VALUES (139, 19, 34.75, 'item139');
+INSERT INTO items VALUES (140, 20, 35.00, 'item140');
+INSERT INTO items VALUES (141, 21, 35.25, 'item141');
+INSERT INTO items VALUES (142, 22, 35.50, 'item142');
+INSERT INTO items VALUES (143, 23, 35.75, 'item143');
+INSERT INTO items VALUES (144, 24, 36.00, 'item144');
+INSERT INTO items VALUES (145, 25, 36.25, 'item145');
+INSERT INTO items VALUES (146, 26, 36.50, 'item146');
+INSERT INTO items VALUES (147, 27, 36.75, 'item147');
+INSERT INTO items VALUES (148, 28, 37.00, 'item148');
+INSERT INTO items VALUES (149, 29, 37.25, 'item149');
+INSERT INTO items VALUES (150, 30, 37.50, 'item150');
+INSERT INTO items VALUES (151, 31, 37.75, 'item151');
+INSERT INTO items VALUES (152, 32, 38.00, 'item152');
+INSERT INTO items VALUES (153, 33, 38.25, 'item153');
+INSERT INTO items VALUES (154, 34, 38.50, 'item154');
+INSERT INTO items VALUES (155, 35, 38.75, 'item155');
+INSERT INTO items VALUES (156, 36, 39.00, 'item156');
+INSERT INTO items VALUES (157, 37, 39.25, 'item157');
+INSERT INTO items VALUES (158, 38, 39.50, 'item158');
+INSERT INTO items VALUES (159, 39, 39.75, 'item159');
+INSERT INTO items VALUES (160, 0, 40.00, 'item160');
+INSERT INTO items VALUES (161, 1, 40.25, 'item161');
+INSERT INTO items VALUES (162, 2, 40.50, 'item162');
+INSERT INTO items VALUES (163, 3, 40.75, 'item163');
+INSERT INTO items VALUES (164, 4, 41.00, 'item164');
+INSERT INTO items VALUES (165, 5, 41.25, 'item165');
+INSERT INTO items VALUES (166, 6, 41.50, 'item166');
+INSERT INTO items VALUES (167, 7, 41.75, 'item167');
+INSERT INTO items VALUES (168, 8, 42.00, 'item168');
+INSERT INTO items VALUES (169, 9, 42.25, 'item169');
+INSERT INTO items VALUES (170, 10, 42.50, 'item170');
+INSERT INTO items VALUES (171, 11, 42.75, 'item171');
+INSERT INTO items VALUES (172, 12, 43.00, 'item172');
+INSERT INTO items VALUES (173, 13, 43.25, 'item173');
+INSERT INTO items VALUES (174, 14, 43.50, 'item174');
+INSERT INTO items VALUES (175, 15, 43.75, 'item175');
+INSERT INTO items VALUES (176, 16, 44.00, 'item176');
+INSERT INTO items VALUES (177, 17, 44.25, 'item177');
+INSERT INTO items VALUES (178, 18, 44.50, 'item178');
+INSERT INTO items VALUES (179, 19, 44.75, 'item179');
+INSERT INTO items VALUES (180, 20, 45.00, 'item180');
+INSERT INTO items VALUES (181, 21, 45.25, 'item181');
+INSERT INTO items VALUES (182, 22, 45.50, 'item182');
+INSERT INTO items VALUES (183, 23, 45.75, 'item183');
+INSERT INTO items VALUES (184, 24, 46.00, 'item184');
+INSERT INTO items VALUES (185, 25, 46.25, 'item185');
+INSERT INTO items VALUES (186, 26, 46.50, 'item186');
+INSERT INTO items VALUES (187, 27, 46.75, 'item187');
+INSERT INTO items VALUES (188, 28, 47.00, 'item188');
+INSERT INTO items VALUES (189, 29, 47.25, 'item189');
+INSERT INTO items VALUES (190, 30, 47.50, 'item190');
+INSERT INTO items VALUES (191, 31, 47.75, 'item191');
+INSERT INTO items VALUES (192, 32, 48.00, 'item192');
+INSERT INTO items VALUES (193, 33, 48.25, 'item193');
+INSERT INTO items VALUES (194, 34, 48.50, 'item194');
+INSERT INTO items VALUES (195, 35, 48.75, 'item195');
+INSERT INTO items VALUES (196, 36, 49.00, 'item196');
+INSERT INTO items VALUES (197, 37, 49.25, 'item197');
+INSERT INTO items VALUES (198, 38, 49.50, 'item198');
+INSERT INTO items VALUES (199, 39, 49.75, 'item199');
+INSERT INTO items VALUES (200, 0, 50.00, 'item200');
+INSERT INTO items VALUES (201, 1, 50.25, 'item201');
+INSERT INTO items VALUES (202, 2, 50.50, 'item202');
+INSERT INTO items VALUES (203, 3, 50.75, 'item203');
+INSERT INTO items VALUES (204, 4, 51.00, 'item204');
+INSERT INTO items VALUES (205, 5, 51.25, 'item205');
+INSERT INTO items VALUES (206, 6, 51.50, 'item206');
+INSERT INTO items VALUES (207, 7, 51.75, 'item207');
+INSERT INTO items VALUES (208, 8, 52.00, 'item208');
+INSERT INTO items VALUES (209, 9, 52.25, 'item209');
+INSERT INTO items VALUES (210, 10, 52.50, 'item210');
+INSERT INTO items VALUES (211, 11, 52.75, 'item211');
+INSERT INTO items VALUES (212, 12, 53.00, 'item212');
+INSERT INTO items VALUES (213, 13, 53.25, 'item213');
+INSERT INTO items VALUES (214, 14, 53.50, 'item214');
+INSERT INTO items VALUES (215, 15, 53.75, 'item215');
+INSERT INTO items VALUES (216, 16, 54.00, 'item216');
+INSERT INTO items VALUES (217, 17, 54.25, 'item217');
+INSERT INTO items VALUES (218, 18, 54.50, 'item218');
+INSERT INTO items VALUES (219, 19, 54.75, 'item219');
+INSERT INTO items VALUES (220, 20, 55.00, 'item220');
+INSERT INTO items VALUES (221, 21, 55.25, 'item221');
+INSERT INTO items VALUES (222, 22, 55.50, 'item222');
+INSERT INTO items VALUES (223, 23, 55.75, 'item223');
+INSERT INTO items VALUES (224, 24, 56.00, 'item224');
+INSERT INTO items VALUES (225, 25, 56.25, 'item225');
+INSERT INTO items VALUES (226, 26, 56.50, 'item226');
+INSERT INTO items VALUES (227, 27, 56.75, 'item227');
+INSERT INTO items VALUES (228, 28, 57.00, 'item228');
+INSERT INTO items VALUES (229, 29, 57.25, 'item229');
+INSERT INTO items VALUES (230, 30, 57.50, 'item230');
+INSERT INTO items VALUES (231, 31, 57.75, 'item231');
+INSERT INTO items VALUES (232, 32, 58.00, 'item232');
+INSERT INTO items VALUES (233, 33, 58.25, 'item233');
+INSERT INTO items VALUES (234, 34, 58.50, 'item234');
+INSERT INTO items VALUES (235, 35, 58.75, 'item235');
+INSERT INTO items VALUES (236, 36, 59.00, 'item236');
+INSERT INTO items VALUES (237, 37, 59.25, 'item237');
+INSERT INTO items VALUES (238, 38, 59.50, 'item238');
+INSERT INTO items VALUES (239, 39, 59.75, 'item239');
+INSERT INTO items VALUES (240, 0, 60.00, 'item240');
+INSERT INTO items VALUES (241, 1, 60.25, 'item241');
+INSERT INTO items VALUES (242, 2, 60.50, 'item242');
+INSERT INTO items VALUES (243, 3, 60.75, 'item243');
+INSERT INTO items VALUES (244, 4, 61.00, 'item244');
+INSERT INTO items VALUES (245, 5, 61.25, 'item245');
+INSERT INTO items VALUES (246, 6, 61.50, 'item246');
+INSERT INTO items VALUES (247, 7, 61.75, 'item247');
+INSERT INTO items VALUES (248, 8, 62.00, 'item248');
+INSERT INTO items VALUES (249, 9, 62.25, 'item249');
+INSERT INTO items VALUES (250, 10, 62.50, 'item250');
+INSERT INTO items VALUES (251, 11, 62.75, 'item251');
+INSERT INTO items VALUES (252, 12, 63.00, 'item252');
+INSERT INTO items VALUES (253, 13, 63.25, 'item253');
+INSERT INTO items VALUES (254, 14, 63.50, 'item254');
+INSERT INTO items VALUES (255, 15, 63.75, 'item255');
+INSERT INTO items VALUES (256, 16, 64.00, 'item256');
+INSERT INTO items VALUES (257, 17, 64.25, 'item257');
+INSERT INTO items VALUES (258, 18, 64.50, 'item258');
+INSERT INTO items VALUES (259, 19, 64.75, 'item259');
+INSERT INTO items VALUES (260, 20, 65.00, 'item260');
+INSERT INTO items VALUES (261, 21, 65.25, 'item261');
+INSERT INTO items VALUES (262, 22, 65.50, 'item262');
+INSERT INTO items VALUES (263, 23, 65.75, 'item263');
+INSERT INTO items VALUES (264, 24, 66.00, 'item264');
+INSERT INTO items VALUES (265, 25, 66.25, 'item265');
+INSERT INTO items VALUES (266, 26, 66.50, 'item266');
+INSERT INTO items VALUES (267, 27, 66.75, 'item267');
+INSERT INTO items VALUES (268, 28, 67.00, 'item268');
+INSERT INTO items VALUES (269, 29, 67.25, 'item269');
+INSERT INTO items VALUES (270, 30, 67.50, 'item270');
+INSERT INTO items VALUES (271, 31, 67.75, 'item271');
+INSERT INTO items VALUES (272, 32, 68.00, 'item272');
+INSERT INTO items VALUES (273, 33, 68.25, 'item273');
+INSERT INTO items VALUES (274, 34, 68.50, 'item274');
+INSERT INTO items VALUES (275, 35, 68.75, 'item275');
+INSERT INTO items VALUES (276, 36, 69.00, 'item276');
+INSERT INTO items VALUES (277, 37, 69.25, 'item277');
+INSERT INTO items VALUES (278, 38, 69.50, 'item278');
+INSERT INTO items VALUES (279, 39, 69.75, 'item279');
+INSERT INTO items VALUES (280, 0, 70.00, 'item280');
+INSERT INTO items VALUES (281, 1, 70.25, 'item281');
+INSERT INTO items VALUES (282, 2, 70.50, 'item282');
+INSERT INTO items VALUES (283, 3, 70.75, 'item283');
+INSERT INTO items VALUES (284, 4, 71.00, 'item284');
+INSERT INTO items VALUES (285, 5, 71.25, 'item285');
+INSERT INTO items VALUES (286, 6, 71.50, 'item286');
+INSERT INTO items VALUES (287, 7, 71.75, 'item287');
+INSERT INTO items VALUES (288, 8, 72.00, 'item288');
+INSERT INTO items VALUES (289, 9, 72.25, 'item289');
+INSERT INTO items VALUES (290, 10, 72.50, 'item290');
+INSERT INTO items VALUES (291, 11, 72.75, 'item291');
+INSERT INTO items VALUES (292, 12, 73.00, 'item292');
+INSERT INTO items VALUES (293, 13, 73.25, 'item293');
+INSERT INTO items VALUES (294, 14, 73.50, 'item294');
+INSERT INTO items VALUES (295, 15, 73.75, 'item295');
+INSERT INTO items VALUES (296, 16, 74.00, 'item296');
+INSERT INTO items VALUES (297, 17, 74.25, 'item297');
+INSERT INTO items VALUES (298, 18, 74.50, 'item298');
+INSERT INTO items VALUES (299, 19, 74.75, 'item299');
+INSERT INTO items VALUES (300, 20, 75.00, 'item300');
+INSERT INTO items VALUES (301, 21, 75.25, 'item301');
+INSERT INTO items VALUES (302, 22, 75.50, 'item302');
+INSERT INTO items VALUES (303, 23, 75.75, 'item303');
+INSERT INTO items VALUES (304, 24, 76.00, 'item304');
+INSERT INTO items VALUES (305, 25, 76.25, 'item305');
+INSERT INTO items VALUES (306, 26, 76.50, 'item306');
+INSERT INTO items VALUES (307, 27, 76.75, 'item307');
+INSERT INTO items VALUES (308, 28, 77.00, 'item308');
+INSERT INTO items VALUES (309, 29, 77.25, 'item309');
+INSERT INTO items VALUES (310, 30, 77.50, 'item310');
+INSERT INTO items VALUES (311, 31, 77.75, 'item311');
+INSERT INTO items VALUES (312, 32, 78.00, 'item312');
+INSERT INTO items VALUES (313, 33, 78.25, 'item313');
+INSERT INTO items VALUES (314, 34, 78.50, 'item314');
+INSERT INTO items VALUES (315, 35, 78.75, 'item315');
+INSERT INTO items VALUES (316, 36, 79.00, 'item316');
+INSERT INTO items VALUES (317, 37, 79.25, 'item317');
+INSERT INTO items VALUES (318, 38, 79.50, 'item318');
+INSERT INTO items VALUES (319, 39, 79.75, 'item319');
+INSERT INTO items VALUES (320, 0, 80.00, 'item320');
+INSERT INTO items VALUES (321, 1, 80.25, 'item321');
+INSERT INTO items VALUES (322, 2, 80.50, 'item322');
+INSERT INTO items VALUES (323, 3, 80.75, 'item323');
+INSERT INTO items VALUES (324, 4, 81.00, 'item324');
+INSERT INTO items VALUES (325, 5, 81.25, 'item325');
+INSERT INTO items VALUES (326, 6, 81.50, 'item326');
+INSERT INTO items VALUES (327, 7, 81.75, 'item327');
+INSERT INTO items VALUES (328, 8, 82.00, 'item328');
+INSERT INTO items VALUES (329, 9, 82.25, 'item329');
+INSERT INTO items VALUES (330, 10, 82.50, 'item330');
+INSERT INTO items VALUES (331, 11, 82.75, 'item331');
+INSERT INTO items VALUES (332, 12, 83.00, 'item332');
+INSERT INTO items VALUES (333, 13, 83.25, 'item333');
+INSERT INTO items VALUES (334, 14, 83.50, 'item334');
+INSERT INTO items VALUES (335, 15, 83.75, 'item335');
+INSERT INTO items VALUES (336, 16, 84.00, 'item336');
+INSERT INTO items VALUES (337, 17, 84.25, 'item337');
+INSERT INTO items VALUES (338, 18, 84.50, 'item338');
+INSERT INTO items VALUES (339, 19, 84.75, 'item339');
+INSERT INTO items VALUES (340, 20, 85.00, 'item340');
+INSERT INTO items VALUES (341, 21, 85.25, 'item341');
+INSERT INTO items VALUES (342, 22, 85.50, 'item342');
+INSERT INTO items VALUES (343, 23, 85.75, 'item343');
+INSERT INTO items VALUES (344, 24, 86.00, 'item344');
+INSERT INTO items VALUES (345, 25, 86.25, 'item345');
+INSERT INTO items VALUES (346, 26, 86.50, 'item346');
+INSERT INTO items VALUES (347, 27, 86.75, 'item347');
+INSERT INTO items VALUES (348, 28, 87.00, 'item348');
+INSERT INTO items VALUES (349, 29, 87.25, 'item349');
+INSERT INTO items VALUES (350, 30, 87.50, 'item350');
+INSERT INTO items VALUES (351, 31, 87.75, 'item351');
+INSERT INTO items VALUES (352, 32, 88.00, 'item352');
+INSERT INTO items VALUES (353, 33, 88.25, 'item353');
+INSERT INTO items VALUES (354, 34, 88.50, 'item354');
+INSERT INTO items VALUES (355, 35, 88.75, 'item355');
+INSERT INTO items VALUES (356, 36, 89.00, 'item356');
+INSERT INTO items VALUES (357, 37, 89.25, 'item357');
+INSERT INTO items VALUES (358, 38, 89.50, 'item358');
+INSERT INTO items VALUES (359, 39, 89.75, 'item359');
+INSERT INTO items VALUES (360, 0, 90.00, 'item360');
+INSERT INTO items VALUES (361, 1, 90.25, 'item361');
+INSERT INTO items VALUES (362, 2, 90.50, 'item362');
+INSERT INTO items VALUES (363, 3, 90.75, 'item363');
+INSERT INTO items VALUES (364, 4, 91.00, 'item364');
+INSERT INTO items VALUES (365, 5, 91.25, 'item365');
+INSERT INTO items VALUES (366, 6, 91.50, 'item366');
+INSERT INTO items VALUES (367, 7, 91.75, 'item367');
+INSERT INTO items VALUES (368, 8, 92.00, 'item368');
+INSERT INTO items VALUES (369, 9, 92.25, 'item369');
+INSERT INTO items VALUES (370, 10, 92.50, 'item370');
+INSERT INTO items VALUES (371, 11, 92.75, 'item371');
+INSERT INTO items VALUES (372, 12, 93.00, 'item372');
+INSERT INTO items VALUES (373, 13, 93.25, 'item373');
+INSERT INTO items VALUES (374, 14, 93.50, 'item374');
+INSERT INTO items VALUES (375, 15, 93.75, 'item375');
+INSERT INTO items VALUES (376, 16, 94.00, 'item376');
+INSERT INTO items VALUES (377, 17, 94.25, 'item377');
+INSERT INTO items VALUES (378, 18, 94.50, 'item378');
+INSERT INTO items VALUES (379, 19, 94.75, 'item379');
+INSERT INTO items VALUES (380, 20, 95.00, 'item380');
+INSERT INTO items VALUES (381, 21, 95.25, 'item381');
+INSERT INTO items VALUES (382, 22, 95.50, 'item382');
+INSERT INTO items VALUES (383, 23, 95.75, 'item383');
+INSERT INTO items VALUES (384, 24, 96.00, 'item384');
+INSERT INTO items VALUES (385, 25, 96.25, 'item385');
+INSERT INTO items VALUES (386, 26, 96.50, 'item386');
+INSERT INTO items VALUES (387, 27, 96.75, 'item387');
+INSERT INTO items VALUES (388, 28, 97.00, 'item388');
+INSERT INTO items VALUES (389, 29, 97.25, 'item389');
+INSERT INTO items VALUES (390, 30, 97.50, 'item390');
+INSERT INTO items VALUES (391, 31, 97.75, 'item391');
+INSERT INTO items VALUES (392, 32, 98.00, 'item392');
+INSERT INTO items VALUES (393, 33, 98.25, 'item393');
+INSERT INTO items VALUES (394, 34, 98.50, 'item394');
+INSERT INTO items VALUES (395, 35, 98.75, 'item395');
+INSERT INTO items VALUES (396, 36, 99.00, 'item396');
+INSERT INTO items VALUES (397, 37, 99.25, 'item397');
+INSERT INTO items VALUES (398, 38, 99.50, 'item398');
+INSERT INTO items VALUES (399, 39, 99.75, 'item399');
+INSERT INTO items VALUES (400, 0, 0.00, 'item400');
+INSERT INTO items VALUES (401, 1, 0.25, 'item401');
+INSERT INTO items VALUES (402, 2, 0.50, 'item402');
+INSERT INTO items VALUES (403, 3, 0.75, 'item403');
+INSERT INTO items VALUES (404, 4, 1.00, 'item404');
+INSERT INTO items VALUES (405, 5, 1.25, 'item405');
+INSERT INTO items VALUES (406, 6, 1.50, 'item406');
+INSERT INTO items VALUES (407, 7, 1.75, 'item407');
+INSERT INTO items VALUES (408, 8, 2.00, 'item408');
+INSERT INTO items VALUES (409, 9, 2.25, 'item409');
+INSERT INTO items VALUES (410, 10, 2.50, 'item410');
+INSERT INTO items VALUES (411, 11, 2.75, 'item411');
+INSERT INTO items VALUES (412, 12, 3.00, 'item412');
+INSERT INTO items VALUES (413, 13, 3.25, 'item413');
+INSERT INTO items VALUES (414, 14, 3.50, 'item414');
+INSERT INTO items VALUES (415, 15, 3.75, 'item415');
+INSERT INTO items VALUES (416, 16, 4.00, 'item416');
+INSERT INTO items VALUES (417, 17, 4.25, 'item417');
+INSERT INTO items VALUES (418, 18, 4.50, 'item418');
+INSERT INTO items VALUES (419, 19, 4.75, 'item419');
+INSERT INTO items VALUES (420, 20, 5.00, 'item420');
+INSERT INTO items VALUES (421, 21, 5.25, 'item421');
+INSERT INTO items VALUES (422, 22, 5.50, 'item422');
+INSERT INTO items VALUES (423, 23, 5.75, 'item423');
+INSERT INTO items VALUES (424, 24, 6.00, 'item424');
+INSERT INTO items VALUES (425, 25, 6.25, 'item425');
+INSERT INTO items VALUES (426, 26, 6.50, 'item426');
+INSERT INTO items VALUES (427, 27, 6.75, 'item427');
+INSERT INTO items VALUES (428, 28, 7.00, 'item428');
+INSERT INTO items VALUES (429, 29, 7.25, 'item429');
+INSERT INTO items VALUES (430, 30, 7.50, 'item430');
+INSERT INTO items VALUES (431, 31, 7.75, 'item431');
+INSERT INTO items VALUES (432, 32, 8.00, 'item432');
+INSERT INTO items VALUES (433, 33, 8.25, 'item433');
+INSERT INTO items VALUES (434, 34, 8.50, 'item434');
+INSERT INTO items VALUES (435, 35, 8.75, 'item435');
+INSERT INTO items VALUES (436, 36, 9.00, 'item436');
+INSERT INTO items VALUES (437, 37, 9.25, 'item437');
+INSERT INTO items VALUES (438, 38, 9.50, 'item438');
+INSERT INTO items VALUES (439, 39, 9.75, 'item439');
+INSERT INTO items VALUES (440, 0, 10.00, 'item440');
+INSERT INTO items VALUES (441, 1, 10.25, 'item441');
+INSERT INTO items VALUES (442, 2, 10.50, 'item442');
+INSERT INTO items VALUES (443, 3, 10.75, 'item443');
+INSERT INTO items VALUES (444, 4, 11.00, 'item444');
+INSERT INTO items VALUES (445, 5, 11.25, 'item445');
+INSERT INTO items VALUES (446, 6, 11.50, 'item446');
+INSERT INTO items VALUES (447, 7, 11.75, 'item447');
+INSERT INTO items VALUES (448, 8, 12.00, 'item448');
+INSERT INTO items VALUES (449, 9, 12.25, 'item449');
+INSERT INTO items VALUES (450, 10, 12.50, 'item450');
+INSERT INTO items VALUES (451, 11, 12.75, 'item451');
+INSERT INTO items VALUES (452, 12, 13.00, 'item452');
+INSERT INTO items VALUES (453, 13, 13.25, 'item453');
+INSERT INTO items VALUES (454, 14, 13.50, 'item454');
+INSERT INTO items VALUES (455, 15, 13.75, 'item455');
+INSERT INTO items VALUES (456, 16, 14.00, 'item456');
+INSERT INTO items VALUES (457, 17, 14.25, 'item457');
+INSERT INTO items VALUES (458, 18, 14.50, 'item458');
+INSERT INTO items VALUES (459, 19, 14.75, 'item459');
+INSERT INTO items VALUES (460, 20, 15.00, 'item460');
+INSERT INTO items VALUES (461, 21, 15.25, 'item461');
+INSERT INTO items VALUES (462, 22, 15.50, 'item462');
+INSERT INTO items VALUES (463, 23, 15.75, 'item463');
+INSERT INTO items VALUES (464, 24, 16.00, 'item464');
+INSERT INTO items VALUES (465, 25, 16.25, 'item465');
+INSERT INTO items VALUES (466, 26, 16.50, 'item466');
+INSERT INTO items VALUES (467, 27, 16.75, 'item467');
+INSERT INTO items VALUES (468, 28, 17.00, 'item468');
+INSERT INTO items VALUES (469, 29, 17.25, 'item469');
+INSERT INTO items VALUES (470, 30, 17.50, 'item470');
+INSERT INTO items VALUES (471, 31, 17.75, 'item471');
+INSERT INTO items VALUES (472, 32, 18.00, 'item472');
+INSERT INTO items VALUES (473, 33, 18.25, 'item473');
+INSERT INTO items VALUES (474, 34, 18.50, 'item474');
+INSERT INTO items VALUES (475, 35, 18.75, 'item475');
+INSERT INTO items VALUES (476, 36, 19.00, 'item476');
+INSERT INTO items VALUES (477, 37, 19.25, 'item477');
+INSERT INTO items VALUES (478, 38, 19.50, 'item478');
+INSERT INTO items VALUES (479, 39, 19.75, 'item479');
+INSERT INTO items VALUES (480, 0, 20.00, 'item480');
+INSERT INTO items VALUES (481, 1, 20.25, 'item481');
+INSERT INTO items VALUES (482, 2, 20.50, 'item482');
+INSERT INTO items VALUES (483, 3, 20.75, 'item483');
+INSERT INTO items VALUES (484, 4, 21.00, 'item484');
+INSERT INTO items VALUES (485, 5, 21.25, 'item485');
+INSERT INTO items VALUES (486, 6, 21.50, 'item486');
+INSERT INTO items VALUES (487, 7, 21.75, 'item487');
+INSERT INTO items VALUES (488, 8, 22.00, 'item488');
+INSERT INTO items VALUES (489, 9, 22.25, 'item489');
+INSERT INTO items VALUES (490, 10, 22.50, 'item490');
+INSERT INTO items VALUES (491, 11, 22.75, 'item491');
+INSERT INTO items VALUES (492, 12, 23.00, 'item492');
+INSERT INTO items VALUES (493, 13, 23.25, 'item493');
+INSERT INTO items VALUES (494, 14, 23.50, 'item494');
+INSERT INTO items VALUES (495, 15, 23.75, 'item495');
+INSERT INTO items VALUES (496, 16, 24.00, 'item496');
+INSERT INTO items VALUES (497, 17, 24.25, 'item497');
+INSERT INTO items VALUES (498, 18, 24.50, 'item498');
+INSERT INTO items VALUES (499, 19, 24.75, 'item499');
+INSERT INTO items VALUES (500, 20, 25.00, 'item500');
+INSERT INTO items VALUES (501, 21, 25.25, 'item501');
+INSERT INTO items VALUES (502, 22, 25.50, 'item502');
+INSERT INTO items VALUES (503, 23, 25.75, 'item503');
+INSERT INTO items VALUES (504, 24, 26.00, 'item504');
+INSERT INTO items VALUES (505, 25, 26.25, 'item505');
+INSERT INTO items VALUES (506, 26, 26.50, 'item506');
+INSERT INTO items VALUES (507, 27, 26.75, 'item507');
+INSERT INTO items VALUES (508, 28, 27.00, 'item508');
+INSERT INTO items VALUES (509, 29, 27.25, 'item509');
+INSERT INTO items VALUES (510, 30, 27.50, 'item510');
+INSERT INTO items VALUES (511, 31, 27.75, 'item511');
+INSERT INTO items VALUES (512, 32, 28.00, 'item512');
+INSERT INTO items VALUES (513, 33, 28.25, 'item513');
+INSERT INTO items VALUES (514, 34, 28.50, 'item514');
+INSERT INTO items VALUES (515, 35, 28.75, 'item515');
+INSERT INTO items VALUES (516, 36, 29.00, 'item516');
+INSERT INTO items VALUES (517, 37, 29.25, 'item517');
+INSERT INTO items VALUES (518, 38, 29.50, 'item518');
+INSERT INTO items VALUES (519, 39, 29.75, 'item519');
+INSERT INTO items VALUES (520, 0, 30.00, 'item520');
+INSERT INTO items VALUES (521, 1, 30.25, 'item521');
+INSERT INTO items VALUES (522, 2, 30.50, 'item522');
+INSERT INTO items VALUES (523, 3, 30.75, 'item523');
+INSERT INTO items VALUES (524, 4, 31.00, 'item524');
+INSERT INTO items VALUES (525, 5, 31.25, 'item525');
+INSERT INTO items VALUES (526, 6, 31.50, 'item526');
+INSERT INTO items VALUES (527, 7, 31.75, 'item527');
+INSERT INTO items VALUES (528, 8, 32.00, 'item528');
+INSERT INTO items VALUES (529, 9, 32.25, 'item529');
+INSERT INTO items VALUES (530, 10, 32.50, 'item530');
+INSERT INTO items VALUES (531, 11, 32.75, 'item531');
+INSERT INTO items VALUES (532, 12, 33.00, 'item532');
+INSERT INTO items VALUES (533, 13, 33.25, 'item533');
+INSERT INTO items VALUES (534, 14, 33.50, 'item534');
+INSERT INTO items VALUES (535, 15, 33.75, 'item535');
+INSERT INTO items VALUES (536, 16, 34.00, 'item536');
+INSERT INTO items VALUES (537, 17, 34.25, 'item537');
+INSERT INTO items VALUES (538, 18, 34.50, 'item538');
+INSERT INTO items VALUES (539, 19, 34.75, 'item539');
+INSERT INTO items VALUES (540, 20, 35.00, 'item540');
+INSERT INTO items VALUES (541, 21, 35.25, 'item541');
+INSERT INTO items VALUES (542, 22, 35.50, 'item542');
+INSERT INTO items VALUES (543, 23, 35.75, 'item543');
+INSERT INTO items VALUES (544, 24, 36.00, 'item544');
+INSERT INTO items VALUES (545, 25, 36.25, 'item545');
+INSERT INTO items VALUES (546, 26, 36.50, 'item546');
+INSERT INTO items VALUES (547, 27, 36.75, 'item547');
+INSERT INTO items VALUES (548, 28, 37.00, 'item548');
+INSERT INTO items VALUES (549, 29, 37.25, 'item549');
+INSERT INTO items VALUES (550, 30, 37.50, 'item550');
+INSERT INTO items VALUES (551, 31, 37.75, 'item551');
+INSERT INTO items VALUES (552, 32, 38.00, 'item552');
+INSERT INTO items VALUES (553, 33, 38.25, 'item553');
+INSERT INTO items VALUES (554, 34, 38.50, 'item554');
+INSERT INTO items VALUES (555, 35, 38.75, 'item555');
+INSERT INTO items VALUES (556, 36, 39.00, 'item556');
+INSERT INTO items VALUES (557, 37, 39.25, 'item557');
+INSERT INTO items VALUES (558, 38, 39.50, 'item558');
+INSERT INTO items VALUES (559, 39, 39.75, 'item559');
+INSERT INTO items VALUES (560, 0, 40.00, 'item560');
+INSERT INTO items VALUES (561, 1, 40.25, 'item561');
+INSERT INTO items VALUES (562, 2, 40.50, 'item562');
+INSERT INTO items VALUES (563, 3, 40.75, 'item563');
+INSERT INTO items VALUES (564, 4, 41.00, 'item564');
+INSERT INTO items VALUES (565, 5, 41.25, 'item565');
+INSERT INTO items VALUES (566, 6, 41.50, 'item566');
+INSERT INTO items VALUES (567, 7, 41.75, 'item567');
+INSERT INTO items VALUES (568, 8, 42.00, 'item568');
+INSERT INTO items VALUES (569, 9, 42.25, 'item569');
+INSERT INTO items VALUES (570, 10, 42.50, 'item570');
+INSERT INTO items VALUES (571, 11, 42.75, 'item571');
+INSERT INTO items VALUES (572, 12, 43.00, 'item572');
+INSERT INTO items VALUES (573, 13, 43.25, 'item573');
+INSERT INTO items VALUES (574, 14, 43.50, 'item574');
+INSERT INTO items VALUES (575, 15, 43.75, 'item575');
+INSERT INTO items VALUES (576, 16, 44.00, 'item576');
+INSERT INTO items VALUES (577, 17, 44.25, 'item577');
+INSERT INTO items VALUES (578, 18, 44.50, 'item578');
+INSERT INTO items VALUES (579, 19, 44.75, 'item579');
+INSERT INTO items VALUES (580, 20, 45.00, 'item580');
+INSERT INTO items VALUES (581, 21, 45.25, 'item581');
+INSERT INTO items VALUES (582, 22, 45.50, 'item582');
+INSERT INTO items VALUES (583, 23, 45.75, 'item583');
+INSERT INTO items VALUES (584, 24, 46.00, 'item584');
+INSERT INTO items VALUES (585, 25, 46.25, 'item585');
+INSERT INTO items VALUES (586, 26, 46.50, 'item586');
+INSERT INTO items VALUES (587, 27, 46.75, 'item587');
+INSERT INTO items VALUES (588, 28, 47.00, 'item588');
+INSERT INTO items VALUES (589, 29, 47.25, 'item589');
+INSERT INTO items VALUES (590, 30, 47.50, 'item590');
+INSERT INTO items VALUES (591, 31, 47.75, 'item591');
+INSERT INTO items VALUES (592, 32, 48.00, 'item592');
+INSERT INTO items VALUES (593, 33, 48.25, 'item593');
+INSERT INTO items VALUES (594, 34, 48.50, 'item594');
+INSERT INTO items VALUES (595, 35, 48.75, 'item595');
+INSERT INTO items VALUES (596, 36, 49.00, 'item596');
+INSERT INTO items VALUES (597, 37, 49.25, 'item597');
+INSERT INTO items VALUES (598, 38, 49.50, 'item598');
+INSERT INTO items VALUES (599, 39, 49.75, 'item599');
+INSERT INTO items VALUES (600, 0, 50.00, 'item600');
+INSERT INTO items VALUES (601, 1, 50.25, 'item601');
+INSERT INTO items VALUES (602, 2, 50.50, 'item602');
+INSERT INTO items VALUES (603, 3, 50.75, 'item603');
+INSERT INTO items VALUES (604, 4, 51.00, 'item604');
+INSERT INTO items VALUES (605, 5, 51.25, 'item605');
+INSERT INTO items VALUES (606, 6, 51.50, 'item606');
+INSERT INTO items VALUES (607, 7, 51.75, 'item607');
+INSERT INTO items VALUES (608, 8, 52.00, 'item608');
+INSERT INTO items VALUES (609, 9, 52.25, 'item609');
+INSERT INTO items VALUES (610, 10, 52.50, 'item610');
+INSERT INTO items VALUES (611, 11, 52.75, 'item611');
+INSERT INTO items VALUES (612, 12, 53.00, 'item612');
+INSERT INTO items VALUES (613, 13, 53.25, 'item613');
+INSERT INTO items VALUES (614, 14, 53.50, 'item614');
+INSERT INTO items VALUES (615, 15, 53.75, 'item615');
+INSERT INTO items VALUES (616, 16, 54.00, 'item616');
+INSERT INTO items VALUES (617, 17, 54.25, 'item617');
+INSERT INTO items VALUES (618, 18, 54.50, 'item618');
+INSERT INTO items VALUES (619, 19, 54.75, 'item619');
+INSERT INTO items VALUES (620, 20, 55.00, 'item620');
+INSERT INTO items VALUES (621, 21, 55.25, 'item621');
+INSERT INTO items VALUES (622, 22, 55.50, 'item622');
+INSERT INTO items VALUES (623, 23, 55.75, 'item623');
+INSERT INTO items VALUES (624, 24, 56.00, 'item624');
+INSERT INTO items VALUES (625, 25, 56.25, 'item625');
+INSERT INTO items VALUES (626, 26, 56.50, 'item626');
+INSERT INTO items VALUES (627, 27, 56.75, 'item627');
+INSERT INTO items VALUES (628, 28, 57.00, 'item628');
+INSERT INTO items VALUES (629, 29, 57.25, 'item629');
+INSERT INTO items VALUES (630, 30, 57.50, 'item630');
+INSERT INTO items VALUES (631, 31, 57.75, 'item631');
+INSERT INTO items VALUES (632, 32, 58.00, 'item632');
+INSERT INTO items VALUES (633, 33, 58.25, 'item633');
+INSERT INTO items VALUES (634, 34, 58.50, 'item634');
+INSERT INTO items VALUES (635, 35, 58.75, 'item635');
+INSERT INTO items VALUES (636, 36, 59.00, 'item636');
+INSERT INTO items VALUES (637, 37, 59.25, 'item637');
+INSERT INTO items VALUES (638, 38, 59.50, 'item638');
+INSERT INTO items VALUES (639, 39, 59.75, 'item639');
+INSERT INTO items VALUES (640, 0, 60.00, 'item640');
+INSERT INTO items VALUES (641, 1, 60.25, 'item641');
+INSERT INTO items VALUES (642, 2, 60.50, 'item642');
+INSERT INTO items VALUES (643, 3, 60.75, 'item643');
+INSERT INTO items VALUES (644, 4, 61.00, 'item644');
+INSERT INTO items VALUES (645, 5, 61.25, 'item645');
+INSERT INTO items VALUES (646, 6, 61.50, 'item646');
+INSERT INTO items VALUES (647, 7, 61.75, 'item647');
+INSERT INTO items VALUES (648, 8, 62.00, 'item648');
+INSERT INTO items VALUES (649, 9, 62.25, 'item649');
+INSERT INTO items VALUES (650, 10, 62.50, 'item650');
+INSERT INTO items VALUES (651, 11, 62.75, 'item651');
+INSERT INTO items VALUES (652, 12, 63.00, 'item652');
+INSERT INTO items VALUES (653, 13, 63.25, 'item653');
+INSERT INTO items VALUES (654, 14, 63.50, 'item654');
+INSERT INTO items VALUES (655, 15, 63.75, 'item655');
+INSERT INTO items VALUES (656, 16, 64.00, 'item656');
+INSERT INTO items VALUES (657, 17, 64.25, 'item657');
+INSERT INTO items VALUES (658, 18, 64.50, 'item658');
+INSERT INTO items VALUES (659, 19, 64.75, 'item659');
+INSERT INTO items VALUES (660, 20, 65.00, 'item660');
+INSERT INTO items VALUES (661, 21, 65.25, 'item661');
+INSERT INTO items VALUES (662, 22, 65.50, 'item662');
+INSERT INTO items VALUES (663, 23, 65.75, 'item663');
+INSERT INTO items VALUES (664, 24, 66.00, 'item664');
+INSERT INTO items VALUES (665, 25, 66.25, 'item665');
+INSERT INTO items VALUES (666, 26, 66.50, 'item666');
+INSERT INTO items VALUES (667, 27, 66.75, 'item667');
+INSERT INTO items VALUES (668, 28, 67.00, 'item668');
+INSERT INTO items VALUES (669, 29, 67.25, 'item669');
+INSERT INTO items VALUES (670, 30, 67.50, 'item670');
+INSERT INTO items VALUES (671, 31, 67.75, 'item671');
+INSERT INTO items VALUES (672, 32, 68.00, 'item672');
+INSERT INTO items VALUES (673, 33, 68.25, 'item673');
+INSERT INTO items VALUES (674, 34, 68.50, 'item674');
+INSERT INTO items VALUES (675, 35, 68.75, 'item675');
+INSERT INTO items VALUES (676, 36, 69.00, 'item676');
+INSERT INTO items VALUES (677, 37, 69.25, 'item677');
+INSERT INTO items VALUES (678, 38, 69.50, 'item678');
+INSERT INTO items VALUES (679, 39, 69.75, 'item679');
+INSERT INTO items VALUES (680, 0, 70.00, 'item680');
+INSERT INTO items VALUES (681, 1, 70.25, 'item681');
+INSERT INTO items VALUES (682, 2, 70.50, 'item682');
+INSERT INTO items VALUES (683, 3, 70.75, 'item683');
+INSERT INTO items VALUES (684, 4, 71.00, 'item684');
+INSERT INTO items VALUES (685, 5, 71.25, 'item685');
+INSERT INTO items VALUES (686, 6, 71.50, 'item686');
+INSERT INTO items VALUES (687, 7, 71.75, 'item687');
+INSERT INTO items VALUES (688, 8, 72.00, 'item688');
+INSERT INTO items VALUES (689, 9, 72.25, 'item689');
+INSERT INTO items VALUES (690, 10, 72.50, 'item690');
+INSERT INTO items VALUES (691, 11, 72.75, 'item691');
+INSERT INTO items VALUES (692, 12, 73.00, 'item692');
+INSERT INTO items VALUES (693, 13, 73.25, 'item693');
+INSERT INTO items VALUES (694, 14, 73.50, 'item694');
+INSERT INTO items VALUES (695, 15, 73.75, 'item695');
+INSERT INTO items VALUES (696, 16, 74.00, 'item696');
+INSERT INTO items VALUES (697, 17, 74.25, 'item697');
+INSERT INTO items VALUES (698, 18, 74.50, 'item698');
+INSERT INTO items VALUES (699, 19, 74.75, 'item699');
+INSERT INTO items VALUES (700, 20, 75.00, 'item700');
+INSERT INTO items VALUES (701, 21, 75.25, 'item701');
+INSERT INTO items VALUES (702, 22, 75.50, 'item702');
+INSERT INTO items VALUES (703, 23, 75.75, 'item703');
+INSERT INTO items VALUES (704, 24, 76.00, 'item704');
+INSERT INTO items VALUES (705, 25, 76.25, 'item705');
+INSERT INTO items VALUES (706, 26, 76.50, 'item706');
+INSERT INTO items VALUES (707, 27, 76.75, 'item707');
+INSERT INTO items VALUES (708, 28, 77.00, 'item708');
+INSERT INTO items VALUES (709, 29, 77.25, 'item709');
+INSERT INTO items VALUES (710, 30, 77.50, 'item710');
+INSERT INTO items VALUES (711, 31, 77.75, 'item711');
+INSERT INTO items VALUES (712, 32, 78.00, 'item712');
+INSERT INTO items VALUES (713, 33, 78.25, 'item713');
+INSERT INTO items VALUES (714, 34, 78.50, 'item714');
+INSERT INTO items VALUES (715, 35, 78.75, 'item715');
+INSERT INTO items VALUES (716, 36, 79.00, 'item716');
+INSERT INTO items VALUES (717, 37, 79.25, 'item717');
+INSERT INTO items VALUES (718, 38, 79.50, 'item718');
+INSERT INTO items VALUES (719, 39, 79.75, 'item719');
+INSERT INTO items VALUES (720, 0, 80.00, 'item720');
+INSERT INTO items VALUES (721, 1, 80.25, 'item721');
+INSERT INTO items VALUES (722, 2, 80.50, 'item722');
+INSERT INTO items VALUES (723, 3, 80.75, 'item723');
+INSERT INTO items VALUES (724, 4, 81.00, 'item724');
+INSERT INTO items VALUES (725, 5, 81.25, 'item725');
+INSERT INTO items VALUES (726, 6, 81.50, 'item726');
+INSERT INTO items VALUES (727, 7, 81.75, 'item727');
+INSERT INTO items VALUES (728, 8, 82.00, 'item728');
+INSERT INTO items VALUES (729, 9, 82.25, 'item729');
+INSERT INTO items VALUES (730, 10, 82.50, 'item730');
+INSERT INTO items VALUES (731, 11, 82.75, 'item731');
+INSERT INTO items VALUES (732, 12, 83.00, 'item732');
+INSERT INTO items VALUES (733, 13, 83.25, 'item733');
+INSERT INTO items VALUES (734, 14, 83.50, 'item734');
+INSERT INTO items VALUES (735, 15, 83.75, 'item735');
+INSERT INTO items VALUES (736, 16, 84.00, 'item736');
+INSERT INTO items VALUES (737, 17, 84.25, 'item737');
+INSERT INTO items VALUES (738, 18, 84.50, 'item738');
+INSERT INTO items VALUES (739, 19, 84.75, 'item739');
+INSERT INTO items VALUES (740, 20, 85.00, 'item740');
+INSERT INTO items VALUES (741, 21, 85.25, 'item741');
+INSERT INTO items VALUES (742, 22, 85.50, 'item742');
+INSERT INTO items VALUES (743, 23, 85.75, 'item743');
+INSERT INTO items VALUES (744, 24, 86.00, 'item744');
+INSERT INTO items VALUES (745, 25, 86.25, 'item745');
+INSERT INTO items VALUES (746, 26, 86.50, 'item746');
+INSERT INTO items VALUES (747, 27, 86.75, 'item747');
+INSERT INTO items VALUES (748, 28, 87.00, 'item748');
+INSERT INTO items VALUES (749, 29, 87.25, 'item749');
+INSERT INTO items VALUES (750, 30, 87.50, 'item750');
+INSERT INTO items VALUES (751, 31, 87.75, 'item751');
+INSERT INTO items VALUES (752, 32, 88.00, 'item752');
+INSERT INTO items VALUES (753, 33, 88.25, 'item753');
+INSERT INTO items VALUES (754, 34, 88.50, 'item754');
+INSERT INTO items VALUES (755, 35, 88.75, 'item755');
+INSERT INTO items VALUES (756, 36, 89.00, 'item756');
+INSERT INTO items VALUES (757, 37, 89.25, 'item757');
+INSERT INTO items VALUES (758, 38, 89.50, 'item758');
+INSERT INTO items VALUES (759, 39, 89.75, 'item759');
+INSERT INTO items VALUES (760, 0, 90.00, 'item760');
+INSERT INTO items VALUES (761, 1, 90.25, 'item761');
+INSERT INTO items VALUES (762, 2, 90.50, 'item762');
+INSERT INTO items VALUES (763, 3, 90.75, 'item763');
+INSERT INTO items VALUES (764, 4, 91.00, 'item764');
+INSERT INTO items VALUES (765, 5, 91.25, 'item765');
+INSERT INTO items VALUES (766, 6, 91.50, 'item766');
+INSERT INTO items VALUES (767, 7, 91.75, 'item767');
+INSERT INTO items VALUES (768, 8, 92.00, 'item768');
+INSERT INTO items VALUES (769, 9, 92.25, 'item769');
+INSERT INTO items VALUES (770, 10, 92.50, 'item770');
+INSERT INTO items VALUES (771, 11, 92.75, 'item771');
+INSERT INTO items VALUES (772, 12, 93.00, 'item772');
+INSERT INTO items VALUES (773, 13, 93.25, 'item773');
+INSERT INTO items VALUES (774, 14, 93.50, 'item774');
+INSERT INTO items VALUES (775, 15, 93.75, 'item775');
+INSERT INTO items VALUES (776, 16, 94.00, 'item776');
+INSERT INTO items VALUES (777, 17, 94.25, 'item777');
+INSERT INTO items VALUES (778, 18, 94.50, 'item778');
+INSERT INTO items VALUES (779, 19, 94.75, 'item779');
+INSERT INTO items VALUES (780, 20, 95.00, 'item780');
+INSERT INTO items VALUES (781, 21, 95.25, 'item781');
+INSERT INTO items VALUES (782, 22, 95.50, 'item782');
+INSERT INTO items VALUES (783, 23, 95.75, 'item783');
+INSERT INTO items VALUES (784, 24, 96.00, 'item784');
+INSERT INTO items VALUES (785, 25, 96.25, 'item785');
+INSERT INTO items VALUES (786, 26, 96.50, 'item786');
+INSERT INTO items VALUES (787, 27, 96.75, 'item787');
+INSERT INTO items VALUES (788, 28, 97.00, 'item788');
+INSERT INTO items VALUES (789, 29, 97.25, 'item789');
+INSERT INTO items VALUES (790, 30, 97.50, 'item790');
+INSERT INTO items VALUES (791, 31, 97.75, 'item791');
+INSERT INTO items VALUES (792, 32, 98.00, 'item792');
+INSERT INTO items VALUES (793, 33, 98.25, 'item793');
+INSERT INTO items VALUES (794, 34, 98.50, 'item794');
+INSERT INTO items VALUES (795, 35, 98.75, 'item795');
+INSERT INTO items VALUES (796, 36, 99.00, 'item796');
+INSERT INTO items VALUES (797, 37, 99.25, 'item797');
+INSERT INTO items VALUES (798, 38, 99.50, 'item798');
+INSERT INTO items VALUES (799, 39, 99.75, 'item799');
+INSERT INTO items VALUES (800, 0, 0.00, 'item800');
+INSERT INTO items VALUES (801, 1, 0.25, 'item801');
+INSERT INTO items VALUES (802, 2, 0.50, 'item802');
+INSERT INTO items VALUES (803, 3, 0.75, 'item803');
+INSERT INTO items VALUES (804, 4, 1.00, 'item804');
+INSERT INTO items VALUES (805, 5, 1.25, 'item805');
+INSERT INTO items VALUES (806, 6, 1.50, 'item806');
+INSERT INTO items VALUES (807, 7, 1.75, 'item807');
+INSERT INTO items VALUES (808, 8, 2.00, 'item808');
+INSERT INTO items VALUES (809, 9, 2.25, 'item809');
+INSERT INTO items VALUES (810, 10, 2.50, 'item810');
+INSERT INTO items VALUES (811, 11, 2.75, 'item811');
+INSERT INTO items VALUES (812, 12, 3.00, 'item812');
+INSERT INTO items VALUES (813, 13, 3.25, 'item813');
+INSERT INTO items VALUES (814, 14, 3.50, 'item814');
+INSERT INTO items VALUES (815, 15, 3.75, 'item815');
+INSERT INTO items VALUES (816, 16, 4.00, 'item816');
+INSERT INTO items VALUES (817, 17, 4.25, 'item817');
+INSERT INTO items VALUES (818, 18, 4.50, 'item818');
+INSERT INTO items VALUES (819, 19, 4.75, 'item819');
+INSERT INTO items VALUES (820, 20, 5.00, 'item820');
+INSERT INTO items VALUES (821, 21, 5.25, 'item821');
+INSERT INTO items VALUES (822, 22, 5.50, 'item822');
+INSERT INTO items VALUES (823, 23, 5.75, 'item823');
+INSERT INTO items VALUES (824, 24, 6.00, 'item824');
+INSERT INTO items VALUES (825, 25, 6.25, 'item825');
+INSERT INTO items VALUES (826, 26, 6.50, 'item826');
+INSERT INTO items VALUES (827, 27, 6.75, 'item827');
+INSERT INTO items VALUES (828, 28, 7.00, 'item828');
+INSERT INTO items VALUES (829, 29, 7.25, 'item829');
+INSERT INTO items VALUES (830, 30, 7.50, 'item830');
+INSERT INTO items VALUES (831, 31, 7.75, 'item831');
+INSERT INTO items VALUES (832, 32, 8.00, 'item832');
+INSERT INTO items VALUES (833, 33, 8.25, 'item833');
+INSERT INTO items VALUES (834, 34, 8.50, 'item834');
+INSERT INTO items VALUES (835, 35, 8.75, 'item835');
+INSERT INTO items VALUES (836, 36, 9.00, 'item836');
+INSERT INTO items VALUES (837, 37, 9.25, 'item837');
+INSERT INTO items VALUES (838, 38, 9.50, 'item838');
+INSERT INTO items VALUES (839, 39, 9.75, 'item839');
+INSERT INTO items VALUES (840, 0, 10.00, 'item840');
+INSERT INTO items VALUES (841, 1, 10.25, 'item841');
+INSERT INTO items VALUES (842, 2, 10.50, 'item842');
+INSERT INTO items VALUES (843, 3, 10.75, 'item843');
+INSERT INTO items VALUES (844, 4, 11.00, 'item844');
+INSERT INTO items VALUES (845, 5, 11.25, 'item845');
+INSERT INTO items VALUES (846, 6, 11.50, 'item846');
+INSERT INTO items VALUES (847, 7, 11.75, 'item847');
+INSERT INTO items VALUES (848, 8, 12.00, 'item848');
+INSERT INTO items VALUES (849, 9, 12.25, 'item849');
+INSERT INTO items VALUES (850, 10, 12.50, 'item850');
+INSERT INTO items VALUES (851, 11, 12.75, 'item851');
+INSERT INTO items VALUES (852, 12, 13.00, 'item852');
+INSERT INTO items VALUES (853, 13, 13.25, 'item853');
+INSERT INTO items VALUES (854, 14, 13.50, 'item854');
+INSERT INTO items VALUES (855, 15, 13.75, 'item855');
+INSERT INTO items VALUES (856, 16, 14.00, 'item856');
+INSERT INTO items VALUES (857, 17, 14.25, 'item857');
+INSERT INTO items VALUES (858, 18, 14.50, 'item858');
+INSERT INTO items VALUES (859, 19, 14.75, 'item859');
+INSERT INTO items VALUES (860, 20, 15.00, 'item860');
+INSERT INTO items VALUES (861, 21, 15.25, 'item861');
+INSERT INTO items VALUES (862, 22, 15.50, 'item862');
+INSERT INTO items VALUES (863, 23, 15.75, 'item863');
+INSERT INTO items VALUES (864, 24, 16.00, 'item864');
+INSERT INTO items VALUES (865, 25, 16.25, 'item865');
+INSERT INTO items VALUES (866, 26, 16.50, 'item866');
+INSERT INTO items VALUES (867, 27, 16.75, 'item867');
+INSERT INTO items VALUES (868, 28, 17.00, 'item868');
+INSERT INTO items VALUES (869, 29, 17.25, 'item869');
+INSERT INTO items VALUES (870, 30, 17.50, 'item870');
+INSERT INTO items VALUES (871, 31, 17.75, 'item871');
+INSERT INTO items VALUES (872, 32, 18.00, 'item872');
+INSERT INTO items VALUES (873, 33, 18.25, 'item873');
+INSERT INTO items VALUES (874, 34, 18.50, 'item874');
+INSERT INTO items VALUES (875, 35, 18.75, 'item875');
+INSERT INTO items VALUES (876, 36, 19.00, 'item876');
+INSERT INTO items VALUES (877, 37, 19.25, 'item877');
+INSERT INTO items VALUES (878, 38, 19.50, 'item878');
+INSERT INTO items VALUES (879, 39, 19.75, 'item879');
+INSERT INTO items VALUES (880, 0, 20.00, 'item880');
+INSERT INTO items VALUES (881, 1, 20.25, 'item881');
+INSERT INTO items VALUES (882, 2, 20.50, 'item882');
+INSERT INTO items VALUES (883, 3, 20.75, 'item883');
+INSERT INTO items VALUES (884, 4, 21.00, 'item884');
+INSERT INTO items VALUES (885, 5, 21.25, 'item885');
+INSERT INTO items VALUES (886, 6, 21.50, 'item886');
+INSERT INTO items VALUES (887, 7, 21.75, 'item887');
+INSERT INTO items VALUES (888, 8, 22.00, 'item888');
+INSERT INTO items VALUES (889, 9, 22.25, 'item889');
+INSERT INTO items VALUES (890, 10, 22.50, 'item890');
+INSERT INTO items VALUES (891, 11, 22.75, 'item891');
+INSERT INTO items VALUES (892, 12, 23.00, 'item892');
+INSERT INTO items VALUES (893, 13, 23.25, 'item893');
+INSERT INTO items VALUES (894, 14, 23.50, 'item894');
+INSERT INTO items VALUES (895, 15, 23.75, 'item895');
+INSERT INTO items VALUES (896, 16, 24.00, 'item896');
+INSERT INTO items VALUES (897, 17, 24.25, 'item897');
+INSERT INTO items VALUES (898, 18, 24.50, 'item898');
+INSERT INTO items VALUES (899, 19, 24.75, 'item899');
+INSERT INTO items VALUES (900, 20, 25.00, 'item900');
+INSERT INTO items VALUES (901, 21, 25.25, 'item901');
+INSERT INTO items VALUES (902, 22, 25.50, 'item902');
+INSERT INTO items VALUES (903, 23, 25.75, 'item903');
+INSERT INTO items VALUES (904, 24, 26.00, 'item904');
+INSERT INTO items VALUES (905, 25, 26.25, 'item905');
+INSERT INTO items VALUES (906, 26, 26.50, 'item906');
+INSERT INTO items VALUES (907, 27, 26.75, 'item907');
+INSERT INTO items VALUES (908, 28, 27.00, 'item908');
+INSERT INTO items VALUES (909, 29, 27.25, 'item909');
+INSERT INTO items VALUES (910, 30, 27.50, 'item910');
+INSERT INTO items VALUES (911, 31, 27.75, 'item911');
+INSERT INTO items VALUES (912, 32, 28.00, 'item912');
+INSERT INTO items VALUES (913, 33, 28.25, 'item913');
+INSERT INTO items VALUES (914, 34, 28.50, 'item914');
+INSERT INTO items VALUES (915, 35, 28.75, 'item915');
+INSERT INTO items VALUES (916, 36, 29.00, 'item916');
+INSERT INTO items VALUES (917, 37, 29.25, 'item917');
+INSERT INTO items VALUES (918, 38, 29.50, 'item918');
+INSERT INTO items VALUES (919, 39, 29.75, 'item919');
+INSERT INTO items VALUES (920, 0, 30.00, 'item920');
+INSERT INTO items VALUES (921, 1, 30.25, 'item921');
+INSERT INTO items VALUES (922, 2, 30.50, 'item922');
+INSERT INTO items VALUES (923, 3, 30.75, 'item923');
+INSERT INTO items VALUES (924, 4, 31.00, 'item924');
+INSERT INTO items VALUES (925, 5, 31.25, 'item925');
+INSERT INTO items VALUES (926, 6, 31.50, 'item926');
+INSERT INTO items VALUES (927, 7, 31.75, 'item927');
+INSERT INTO items VALUES (928, 8, 32.00, 'item928');
+INSERT INTO items VALUES (929, 9, 32.25, 'item929');
+INSERT INTO items VALUES (930, 10, 32.50, 'item930');
+INSERT INTO items VALUES (931, 11, 32.75, 'item931');
+INSERT INTO items VALUES (932, 12, 33.00, 'item932');
+INSERT INTO items VALUES (933, 13, 33.25, 'item933');
+INSERT INTO items VALUES (934, 14, 33.50, 'item934');
+INSERT INTO items VALUES (935, 15, 33.75, 'item935');
+INSERT INTO items VALUES (936, 16, 34.00, 'item936');
+INSERT INTO items VALUES (937, 17, 34.25, 'item937');
+INSERT INTO items VALUES (938, 18, 34.50, 'item938');
+INSERT INTO items VALUES (939, 19, 34.75, 'item939');
+INSERT INTO items VALUES (940, 20, 35.00, 'item940');
+INSERT INTO items VALUES (941, 21, 35.25, 'item941');
+INSERT INTO items VALUES (942, 22, 35.50, 'item942');
+INSERT INTO items VALUES (943, 23, 35.75, 'item943');
+INSERT INTO items VALUES (944, 24, 36.00, 'item944');
+INSERT INTO items VALUES (945, 25, 36.25, 'item945');
+INSERT INTO items VALUES (946, 26, 36.50, 'item946');
+INSERT INTO items VALUES (947, 27, 36.75, 'item947');
+INSERT INTO items VALUES (948, 28, 37.00, 'item948');
+INSERT INTO items VALUES (949, 29, 37.25, 'item949');
+INSERT INTO items VALUES (950, 30, 37.50, 'item950');
+INSERT INTO items VALUES (951, 31, 37.75, 'item951');
+INSERT INTO items VALUES (952, 32, 38.00, 'item952');
+INSERT INTO items VALUES (953, 33, 38.25, 'item953');
+INSERT INTO items VALUES (954, 34, 38.50, 'item954');
+INSERT INTO items VALUES (955, 35, 38.75, 'item955');
+INSERT INTO items VALUES (956, 36, 39.00, 'item956');
+INSERT INTO items VALUES (957, 37, 39.25, 'item957');
+INSERT INTO items VALUES (958, 38, 39.50, 'item958');
+INSERT INTO items VALUES (959, 39, 39.75, 'item959');
+INSERT INTO items VALUES (960, 0, 40.00, 'item960');
+INSERT INTO items VALUES (961, 1, 40.25, 'item961');
+INSERT INTO items VALUES (962, 2, 40.50, 'item962');
+INSERT INTO items VALUES (963, 3, 40.75, 'item963');
+INSERT INTO items VALUES (964, 4, 41.00, 'item964');
+INSERT INTO items VALUES (965, 5, 41.25, 'item965');
+INSERT INTO items VALUES (966, 6, 41.50, 'item966');
+INSERT INTO items VALUES (967, 7, 41.75, 'item967');
+INSERT INTO items VALUES (968, 8, 42.00, 'item968');
+INSERT INTO items VALUES (969, 9, 42.25, 'item969');
+INSERT INTO items VALUES (970, 10, 42.50, 'item970');
+INSERT INTO items VALUES (971, 11, 42.75, 'item971');
+INSERT INTO items VALUES (972, 12, 43.00, 'item972');
+INSERT INTO items VALUES (973, 13, 43.25, 'item973');
+INSERT INTO items VALUES (974, 14, 43.50, 'item974');
+INSERT INTO items VALUES (975, 15, 43.75, 'item975');
+INSERT INTO items VALUES (976, 16, 44.00, 'item976');
+INSERT INTO items VALUES (977, 17, 44.25, 'item977');
+INSERT INTO items VALUES (978, 18, 44.50, 'item978');
+INSERT INTO items VALUES (979, 19, 44.75, 'item979');
+INSERT INTO items VALUES (980, 20, 45.00, 'item980');
+INSERT INTO items VALUES (981, 21, 45.25, 'item981');
+INSERT INTO items VALUES (982, 22, 45.50, 'item982');
+INSERT INTO items VALUES (983, 23, 45.75, 'item983');
+INSERT INTO items VALUES (984, 24, 46.00, 'item984');
+INSERT INTO items VALUES (985, 25, 46.25, 'item985');
+INSERT INTO items VALUES (986, 26, 46.50, 'item986');
+INSERT INTO items VALUES (987, 27, 46.75, 'item987');
+INSERT INTO items VALUES (988, 28, 47.00, 'item988');
+INSERT INTO items VALUES (989, 29, 47.25, 'item989');
+INSERT INTO items VALUES (990, 30, 47.50, 'item990');
+INSERT INTO items VALUES (991, 31, 47.75, 'item991');
+INSERT INTO items VALUES (992, 32, 48.00, 'item992');
+INSERT INTO items VALUES (993, 33, 48.25, 'item993');
+INSERT INTO items VALUES (994, 34, 48.50, 'item994');
+INSERT INTO items VALUES (995, 35, 48.75, 'item995');
+INSERT INTO items VALUES (996, 36, 49.00, 'item996');
+INSERT INTO items VALUES (997, 37, 49.25, 'item997');
+INSERT INTO items VALUES (998, 38, 49.50, 'item998');
+INSERT INTO items VALUES (999, 39, 49.75, 'item999');
+INSERT INTO items VALUES (1000, 0, 50.00, 'item1000');
+INSERT INTO items VALUES (1001, 1, 50.25, 'item1001');
+INSERT INTO items VALUES (1002, 2, 50.50, 'item1002');
+INSERT INTO items VALUES (1003, 3, 50.75, 'item1003');
+INSERT INTO items VALUES (1004, 4, 51.00, 'item1004');
+INSERT INTO items VALUES (1005, 5, 51.25, 'item1005');
+INSERT INTO items VALUES (1006, 6, 51.50, 'item1006');
+INSERT INTO items VALUES (1007, 7, 51.75, 'item1007');
+INSERT INTO items VALUES (1008, 8, 52.00, 'item1008');
+INSERT INTO items VALUES (1009, 9, 52.25, 'item1009');
+INSERT INTO items VALUES (1010, 10, 52.50, 'item1010');
+INSERT INTO items VALUES (1011, 11, 52.75, 'item1011');
+INSERT INTO items VALUES (1012, 12, 53.00, 'item1012');
+INSERT INTO items VALUES (1013, 13, 53.25, 'item1013');
+INSERT INTO items VALUES (1014, 14, 53.50, 'item1014');
+INSERT INTO items VALUES (1015, 15, 53.75, 'item1015');
+INSERT INTO items VALUES (1016, 16, 54.00, 'item1016');
+INSERT INTO items VALUES (1017, 17, 54.25, 'item1017');
+INSERT INTO items VALUES (1018, 18, 54.50, 'item1018');
+INSERT INTO items VALUES (1019, 19, 54.75, 'item1019');
+INSERT INTO items VALUES (1020, 20, 55.00, 'item1020');
+INSERT INTO items VALUES (1021, 21, 55.25, 'item1021');
+INSERT INTO items VALUES (1022, 22, 55.50, 'item1022');
+INSERT INTO items VALUES (1023, 23, 55.75, 'item1023');
+INSERT INTO items VALUES (1024, 24, 56.00, 'item1024');
+INSERT INTO items VALUES (1025, 25, 56.25, 'item1025');
+INSERT INTO items VALUES (1026, 26, 56.50, 'item1026');
+INSERT INTO items VALUES (1027, 27, 56.75, 'item1027');
+INSERT INTO items VALUES (1028, 28, 57.00, 'item1028');
+INSERT INTO items VALUES (1029, 29, 57.25, 'item1029');
+INSERT INTO items VALUES (1030, 30, 57.50, 'item1030');
+INSERT INTO items VALUES (1031, 31, 57.75, 'item1031');
+INSERT INTO items VALUES (1032, 32, 58.00, 'item1032');
+INSERT INTO items VALUES (1033, 33, 58.25, 'item1033');
+INSERT INTO items VALUES (1034, 34, 58.50, 'item1034');
+INSERT INTO items VALUES (1035, 35, 58.75, 'item1035');
+INSERT INTO items VALUES (1036, 36, 59.00, 'item1036');
+INSERT INTO items VALUES (1037, 37, 59.25, 'item1037');
+INSERT INTO items VALUES (1038, 38, 59.50, 'item1038');
+INSERT INTO items VALUES (1039, 39, 59.75, 'item1039');
+INSERT INTO items VALUES (1040, 0, 60.00, 'item1040');
+INSERT INTO items VALUES (1041, 1, 60.25, 'item1041');
+INSERT INTO items VALUES (1042, 2, 60.50, 'item1042');
+INSERT INTO items VALUES (1043, 3, 60.75, 'item1043');
+INSERT INTO items VALUES (1044, 4, 61.00, 'item1044');
+INSERT INTO items VALUES (1045, 5, 61.25, 'item1045');
+INSERT INTO items VALUES (1046, 6, 61.50, 'item1046');
+INSERT INTO items VALUES (1047, 7, 61.75, 'item1047');
+INSERT INTO items VALUES (1048, 8, 62.00, 'item1048');
+INSERT INTO items VALUES (1049, 9, 62.25, 'item1049');
+INSERT INTO items VALUES (1050, 10, 62.50, 'item1050');
+INSERT INTO items VALUES (1051, 11, 62.75, 'item1051');
+INSERT INTO items VALUES (1052, 12, 63.00, 'item1052');
+INSERT INTO items VALUES (1053, 13, 63.25, 'item1053');
+INSERT INTO items VALUES (1054, 14, 63.50, 'item1054');
+INSERT INTO items VALUES (1055, 15, 63.75, 'item1055');
+INSERT INTO items VALUES (1056, 16, 64.00, 'item1056');
+INSERT INTO items VALUES (1057, 17, 64.25, 'item1057');
+INSERT INTO items VALUES (1058, 18, 64.50, 'item1058');
+INSERT INTO items VALUES (1059, 19, 64.75, 'item1059');
+INSERT INTO items VALUES (1060, 20, 65.00, 'item1060');
+INSERT INTO items VALUES (1061, 21, 65.25, 'item1061');
+INSERT INTO items VALUES (1062, 22, 65.50, 'item1062');
+INSERT INTO items VALUES (1063, 23, 65.75, 'item1063');
+INSERT INTO items VALUES (1064, 24, 66.00, 'item1064');
+INSERT INTO items VALUES (1065, 25, 66.25, 'item1065');
+INSERT INTO items VALUES (1066, 26, 66.50, 'item1066');
+INSERT INTO items VALUES (1067, 27, 66.75, 'item1067');
+INSERT INTO items VALUES (1068, 28, 67.00, 'item1068');
+INSERT INTO items VALUES (1069, 29, 67.25, 'item1069');
+INSERT INTO items VALUES (1070, 30, 67.50, 'item1070');
+INSERT INTO items VALUES (1071, 31, 67.75, 'item1071');
+INSERT INTO items VALUES (1072, 32, 68.00, 'item1072');
+INSERT INTO items VALUES (1073, 33, 68.25, 'item1073');
+INSERT INTO items VALUES (1074, 34, 68.50, 'item1074');
+INSERT INTO items VALUES (1075, 35, 68.75, 'item1075');
+INSERT INTO items VALUES (1076, 36, 69.00, 'item1076');
+INSERT INTO items VALUES (1077, 37, 69.25, 'item1077');
+INSERT INTO items VALUES (1078, 38, 69.50, 'item1078');
+INSERT INTO items VALUES (1079, 39, 69.75, 'item1079');
+INSERT INTO items VALUES (1080, 0, 70.00, 'item1080');
+INSERT INTO items VALUES (1081, 1, 70.25, 'item1081');
+INSERT INTO items VALUES (1082, 2, 70.50, 'item1082');
+INSERT INTO items VALUES (1083, 3, 70.75, 'item1083');
+INSERT INTO items VALUES (1084, 4, 71.00, 'item1084');
+INSERT INTO items VALUES (1085, 5, 71.25, 'item1085');
+INSERT INTO items VALUES (1086, 6, 71.50, 'item1086');
+INSERT INTO items VALUES (1087, 7, 71.75, 'item1087');
+INSERT INTO items VALUES (1088, 8, 72.00, 'item1088');
+INSERT INTO items VALUES (1089, 9, 72.25, 'item1089');
+INSERT INTO items VALUES (1090, 10, 72.50, 'item1090');
+INSERT INTO items VALUES (1091, 11, 72.75, 'item1091');
+INSERT INTO items VALUES (1092, 12, 73.00, 'item1092');
+INSERT INTO items VALUES (1093, 13, 73.25, 'item1093');
+INSERT INTO items VALUES (1094, 14, 73.50, 'item1094');
+INSERT INTO items VALUES (1095, 15, 73.75, 'item1095');
+INSERT INTO items VALUES (1096, 16, 74.00, 'item1096');
+INSERT INTO items VALUES (1097, 17, 74.25, 'item1097');
+INSERT INTO items VALUES (1098, 18, 74.50, 'item1098');
+INSERT INTO items VALUES (1099, 19, 74.75, 'item1099');
+INSERT INTO items VALUES (1100, 20, 75.00, 'item1100');
+INSERT INTO items VALUES (1101, 21, 75.25, 'item1101');
+INSERT INTO items VALUES (1102, 22, 75.50, 'item1102');
+INSERT INTO items VALUES (1103, 23, 75.75, 'item1103');
+INSERT INTO items VALUES (1104, 24, 76.00, 'item1104');
+INSERT INTO items VALUES (1105, 25, 76.25, 'item1105');
+INSERT INTO items VALUES (1106, 26, 76.50, 'item1106');
+INSERT INTO items VALUES (1107, 27, 76.75, 'item1107');
+INSERT INTO items VALUES (1108, 28, 77.00, 'item1108');
+INSERT INTO items VALUES (1109, 29, 77.25, 'item1109');
+INSERT INTO items VALUES (1110, 30, 77.50, 'item1110');
+INSERT INTO items VALUES (1111, 31, 77.75, 'item1111');
+INSERT INTO items VALUES (1112, 32, 78.00, 'item1112');
+INSERT INTO items VALUES (1113, 33, 78.25, 'item1113');
+INSERT INTO items VALUES (1114, 34, 78.50, 'item1114');
+INSERT INTO items VALUES (1115, 35, 78.75, 'item1115');
+INSERT INTO items VALUES (1116, 36, 79.00, 'item1116');
+INSERT INTO items VALUES (1117, 37, 79.25, 'item1117');
+INSERT INTO items VALUES (1118, 38, 79.50, 'item1118');
+INSERT INTO items VALUES (1119, 39, 79.75, 'item1119');
+INSERT INTO items VALUES (1120, 0, 80.00, 'item1120');
+INSERT INTO items VALUES (1121, 1, 80.25, 'item1121');
+INSERT INTO items VALUES (1122, 2, 80.50, 'item1122');
+INSERT INTO items VALUES (1123, 3, 80.75, 'item1123');
+INSERT INTO items VALUES (1124, 4, 81.00, 'item1124');
+INSERT INTO items VALUES (1125, 5, 81.25, 'item1125');
+INSERT INTO items VALUES (1126, 6, 81.50, 'item1126');
+INSERT INTO items VALUES (1127, 7, 81.75, 'item1127');
+INSERT INTO items VALUES (1128, 8, 82.00, 'item1128');
+INSERT INTO items VALUES (1129, 9, 82.25, 'item1129');
+INSERT INTO items VALUES (1130, 10, 82.50, 'item1130');
+INSERT INTO items VALUES (1131, 11, 82.75, 'item1131');
+INSERT INTO items VALUES (1132, 12, 83.00, 'item1132');
+INSERT INTO items VALUES (1133, 13, 83.25, 'item1133');
+INSERT INTO items VALUES (1134, 14, 83.50, 'item1134');
+INSERT INTO items VALUES (1135, 15, 83.75, 'item1135');
+INSERT INTO items VALUES (1136, 16, 84.00, 'item1136');
+INSERT INTO items VALUES (1137, 17, 84.25, 'item1137');
+INSERT INTO items VALUES (1138, 18, 84.50, 'item1138');
+INSERT INTO items VALUES (1139, 19, 84.75, 'item1139');
+INSERT INTO items VALUES (1140, 20, 85.00, 'item1140');
+INSERT INTO items VALUES (1141, 21, 85.25, 'item1141');
+INSERT INTO items VALUES (1142, 22, 85.50, 'item1142');
+INSERT INTO items VALUES (1143, 23, 85.75, 'item1143');
+INSERT INTO items VALUES (1144, 24, 86.00, 'item1144');
+INSERT INTO items VALUES (1145, 25, 86.25, 'item1145');
+INSERT INTO items VALUES (1146, 26, 86.50, 'item1146');
+INSERT INTO items VALUES (1147, 27, 86.75, 'item1147');
+INSERT INTO items VALUES (1148, 28, 87.00, 'item1148');
+INSERT INTO items VALUES (1149, 29, 87.25, 'item1149');
+INSERT INTO items VALUES (1150, 30, 87.50, 'item1150');
+INSERT INTO items VALUES (1151, 31, 87.75, 'item1151');
+INSERT INTO items VALUES (1152, 32, 88.00, 'item1152');
+INSERT INTO items VALUES (1153, 33, 88.25, 'item1153');
+INSERT INTO items VALUES (1154, 34, 88.50, 'item1154');
+INSERT INTO items VALUES (1155, 35, 88.75, 'item1155');
+INSERT INTO items VALUES (1156, 36, 89.00, 'item1156');
+INSERT INTO items VALUES (1157, 37, 89.25, 'item1157');
+INSERT INTO items VALUES (1158, 38, 89.50, 'item1158');
+INSERT INTO items VALUES (1159, 39, 89.75, 'item1159');
+INSERT INTO items VALUES (1160, 0, 90.00, 'item1160');
+INSERT INTO items VALUES (1161, 1, 90.25, 'item1161');
+INSERT INTO items VALUES (1162, 2, 90.50, 'item1162');
+INSERT INTO items VALUES (1163, 3, 90.75, 'item1163');
+INSERT INTO items VALUES (1164, 4, 91.00, 'item1164');
+INSERT INTO items VALUES (1165, 5, 91.25, 'item1165');
+INSERT INTO items VALUES (1166, 6, 91.50, 'item1166');
+INSERT INTO items VALUES (1167, 7, 91.75, 'item1167');
+INSERT INTO items VALUES (1168, 8, 92.00, 'item1168');
+INSERT INTO items VALUES (1169, 9, 92.25, 'item1169');
+INSERT INTO items VALUES (1170, 10, 92.50, 'item1170');
+INSERT INTO items VALUES (1171, 11, 92.75, 'item1171');
+INSERT INTO items VALUES (1172, 12, 93.00, 'item1172');
+INSERT INTO items VALUES (1173, 13, 93.25, 'item1173');
+INSERT INTO items VALUES (1174, 14, 93.50, 'item1174');
+INSERT INTO items VALUES (1175, 15, 93.75, 'item1175');
+INSERT INTO items VALUES (1176, 16, 94.00, 'item1176');
+INSERT INTO items VALUES (1177, 17, 94.25, 'item1177');
+INSERT INTO items VALUES (1178, 18, 94.50, 'item1178');
+INSERT INTO items VALUES (1179, 19, 94.75, 'item1179');
+INSERT INTO items VALUES (1180, 20, 95.00, 'item1180');
+INSERT INTO items VALUES (1181, 21, 95.25, 'item1181');
+INSERT INTO items VALUES (1182, 22, 95.50, 'item1182');
+INSERT INTO items VALUES (1183, 23, 95.75, 'item1183');
+INSERT INTO items VALUES (1184, 24, 96.00, 'item1184');
+INSERT INTO items VALUES (1185, 25, 96.25, 'item1185');
+INSERT INTO items VALUES (1186, 26, 96.50, 'item1186');
+INSERT INTO items VALUES (1187, 27, 96.75, 'item1187');
+INSERT INTO items VALUES (1188, 28, 97.00, 'item1188');
+INSERT INTO items VALUES (1189, 29, 97.25, 'item1189');
+INSERT INTO items VALUES (1190, 30, 97.50, 'item1190');
+INSERT INTO items VALUES (1191, 31, 97.75, 'item1191');
+INSERT INTO items VALUES (1192, 32, 98.00, 'item1192');
+INSERT INTO items VALUES (1193, 33, 98.25, 'item1193');
+INSERT INTO items VALUES (1194, 34, 98.50, 'item1194');
+INSERT INTO items VALUES (1195, 35, 98.75, 'item1195');
+INSERT INTO items VALUES (1196, 36, 99.00, 'item1196');
+INSERT INTO items VALUES (1197, 37, 99.25, 'item1197');
+INSERT INTO items VALUES (1198, 38, 99.50, 'item1198');
+INSERT INTO items VALUES (1199, 39, 99.75, 'item1199');
+INSERT INTO items VALUES (1200, 0, 0.00, 'item1200');
+INSERT INTO items VALUES (1201, 1, 0.25, 'item1201');
+INSERT INTO items VALUES (1202, 2, 0.50, 'item1202');
+INSERT INTO items VALUES (1203, 3, 0.75, 'item1203');
+INSERT INTO items VALUES (1204, 4, 1.00, 'item1204');
+INSERT INTO items VALUES (1205, 5, 1.25, 'item1205');
+INSERT INTO items VALUES (1206, 6, 1.50, 'item1206');
+INSERT INTO items VALUES (1207, 7, 1.75, 'item1207');
+INSERT INTO items VALUES (1208, 8, 2.00, 'item1208');
+INSERT INTO items VALUES (1209, 9, 2.25, 'item1209');
+INSERT INTO items VALUES (1210, 10, 2.50, 'item1210');
+INSERT INTO items VALUES (1211, 11, 2.75, 'item1211');
+INSERT INTO items VALUES (1212, 12, 3.00, 'item1212');
+INSERT INTO items VALUES (1213, 13, 3.25, 'item1213');
+INSERT INTO items VALUES (1214, 14, 3.50, 'item1214');
+INSERT INTO items VALUES (1215, 15, 3.75, 'item1215');
+INSERT INTO items VALUES (1216, 16, 4.00, 'item1216');
+INSERT INTO items VALUES (1217, 17, 4.25, 'item1217');
+INSERT INTO items VALUES (1218, 18, 4.50, 'item1218');
+INSERT INTO items VALUES (1219, 19, 4.75, 'item1219');
+INSERT INTO items VALUES (1220, 20, 5.00, 'item1220');
+INSERT INTO items VALUES (1221, 21, 5.25, 'item1221');
+INSERT INTO items VALUES (1222, 22, 5.50, 'item1222');
+INSERT INTO items VALUES (1223, 23, 5.75, 'item1223');
+INSERT INTO items VALUES (1224, 24, 6.00, 'item1224');
+INSERT INTO items VALUES (1225, 25, 6.25, 'item1225');
+INSERT INTO items VALUES (1226, 26, 6.50, 'item1226');
+INSERT INTO items VALUES (1227, 27, 6.75, 'item1227');
+INSERT INTO items VALUES (1228, 28, 7.00, 'item1228');
+INSERT INTO items VALUES (1229, 29, 7.25, 'item1229');
+INSERT INTO items VALUES (1230, 30, 7.50, 'item1230');
+INSERT INTO items VALUES (1231, 31, 7.75, 'item1231');
+INSERT INTO items VALUES (1232, 32, 8.00, 'item1232');
+INSERT INTO items VALUES (1233, 33, 8.25, 'item1233');
+INSERT INTO items VALUES (1234, 34, 8.50, 'item1234');
+INSERT INTO items VALUES (1235, 35, 8.75, 'item1235');
+INSERT INTO items VALUES (1236, 36, 9.00, 'item1236');
+INSERT INTO items VALUES (1237, 37, 9.25, 'item1237');
+INSERT INTO items VALUES (1238, 38, 9.50, 'item1238');
+INSERT INTO items VALUES (1239, 39, 9.75, 'item1239');
+INSERT INTO items VALUES (1240, 0, 10.00, 'item1240');
+INSERT INTO items VALUES (1241, 1, 10.25, 'item1241');
+INSERT INTO items VALUES (1242, 2, 10.50, 'item1242');
+INSERT INTO items VALUES (1243, 3, 10.75, 'item1243');
+INSERT INTO items VALUES (1244, 4, 11.00, 'item1244');
+INSERT INTO items VALUES (1245, 5, 11.25, 'item1245');
+INSERT INTO items VALUES (1246, 6, 11.50, 'item1246');
+INSERT INTO items VALUES (1247, 7, 11.75, 'item1247');
+INSERT INTO items VALUES (1248, 8, 12.00, 'item1248');
+INSERT INTO items VALUES (1249, 9, 12.25, 'item1249');
+INSERT INTO items VALUES (1250, 10, 12.50, 'item1250');
+INSERT INTO items VALUES (1251, 11, 12.75, 'item1251');
+INSERT INTO items VALUES (1252, 12, 13.00, 'item1252');
+INSERT INTO items VALUES (1253, 13, 13.25, 'item1253');
+INSERT INTO items VALUES (1254, 14, 13.50, 'item1254');
+INSERT INTO items VALUES (1255, 15, 13.75, 'item1255');
+INSERT INTO items VALUES (1256, 16, 14.00, 'item1256');
+INSERT INTO items VALUES (1257, 17, 14.25, 'item1257');
+INSERT INTO items VALUES (1258, 18, 14.50, 'item1258');
+INSERT INTO items VALUES (1259, 19, 14.75, 'item1259');
+INSERT INTO items VALUES (1260, 20, 15.00, 'item1260');
+INSERT INTO items VALUES (1261, 21, 15.25, 'item1261');
+INSERT INTO items VALUES (1262, 22, 15.50, 'item1262');
+INSERT INTO items VALUES (1263, 23, 15.75, 'item1263');
+INSERT INTO items VALUES (1264, 24, 16.00, 'item1264');
+INSERT INTO items VALUES (1265, 25, 16.25, 'item1265');
+INSERT INTO items VALUES (1266, 26, 16.50, 'item1266');
+INSERT INTO items VALUES (1267, 27, 16.75, 'item1267');
+INSERT INTO items VALUES (1268, 28, 17.00, 'item1268');
+INSERT INTO items VALUES (1269, 29, 17.25, 'item1269');
+INSERT INTO items VALUES (1270, 30, 17.50, 'item1270');
+INSERT INTO items VALUES (1271, 31, 17.75, 'item1271');
+INSERT INTO items VALUES (1272, 32, 18.00, 'item1272');
+INSERT INTO items VALUES (1273, 33, 18.25, 'item1273');
+INSERT INTO items VALUES (1274, 34, 18.50, 'item1274');
+INSERT INTO items VALUES (1275, 35, 18.75, 'item1275');
+INSERT INTO items VALUES (1276, 36, 19.00, 'item1276');
+INSERT INTO items VALUES (1277, 37, 19.25, 'item1277');
+INSERT INTO items VALUES (1278, 38, 19.50, 'item1278');
+INSERT INTO items VALUES (1279, 39, 19.75, 'item1279');
+INSERT INTO items VALUES (1280, 0, 20.00, 'item1280');
+INSERT INTO items VALUES (1281, 1, 20.25, 'item1281');
+INSERT INTO items VALUES (1282, 2, 20.50, 'item1282');
+INSERT INTO items VALUES (1283, 3, 20.75, 'item1283');
+INSERT INTO items VALUES (1284, 4, 21.00, 'item1284');
+INSERT INTO items VALUES (1285, 5, 21.25, 'item1285');
+INSERT INTO items VALUES (1286, 6, 21.50, 'item1286');
+INSERT INTO items VALUES (1287, 7, 21.75, 'item1287');
+INSERT INTO items VALUES (1288, 8, 22.00, 'item1288');
+INSERT INTO items VALUES (1289, 9, 22.25, 'item1289');
+INSERT INTO items VALUES (1290, 10, 22.50, 'item1290');
+INSERT INTO items VALUES (1291, 11, 22.75, 'item1291');
+INSERT INTO items VALUES (1292, 12, 23.00, 'item1292');
+INSERT INTO items VALUES (1293, 13, 23.25, 'item1293');
+INSERT INTO items VALUES (1294, 14, 23.50, 'item1294');
+INSERT INTO items VALUES (1295, 15, 23.75, 'item1295');
+INSERT INTO items VALUES (1296, 16, 24.00, 'item1296');
+INSERT INTO items VALUES (1297, 17, 24.25, 'item1297');
+INSERT INTO items VALUES (1298, 18, 24.50, 'item1298');
+INSERT INTO items VALUES (1299, 19, 24.75, 'item1299');
+INSERT INTO items VALUES (1300, 20, 25.00, 'item1300');
+INSERT INTO items VALUES (1301, 21, 25.25, 'item1301');
+INSERT INTO items VALUES (1302, 22, 25.50, 'item1302');
+INSERT INTO items VALUES (1303, 23, 25.75, 'item1303');
+INSERT INTO items VALUES (1304, 24, 26.00, 'item1304');
+INSERT INTO items VALUES (1305, 25, 26.25, 'item1305');
+INSERT INTO items VALUES (1306, 26, 26.50, 'item1306');
+INSERT INTO items VALUES (1307, 27, 26.75, 'item1307');
+INSERT INTO items VALUES (1308, 28, 27.00, 'item1308');
+INSERT INTO items VALUES (1309, 29, 27.25, 'item1309');
+INSERT INTO items VALUES (1310, 30, 27.50, 'item1310');
+INSERT INTO items VALUES (1311, 31, 27.75, 'item1311');
+INSERT INTO items VALUES (1312, 32, 28.00, 'item1312');
+INSERT INTO items VALUES (1313, 33, 28.25, 'item1313');
+INSERT INTO items VALUES (1314, 34, 28.50, 'item1314');
+INSERT INTO items VALUES (1315, 35, 28.75, 'item1315');
+INSERT INTO items VALUES (1316, 36, 29.00, 'item1316');
+INSERT INTO items VALUES (1317, 37, 29.25, 'item1317');
+INSERT INTO items VALUES (1318, 38, 29.50, 'item1318');
+INSERT INTO items VALUES (1319, 39, 29.75, 'item1319');
+INSERT INTO items VALUES (1320, 0, 30.00, 'item1320');
+INSERT INTO items VALUES (1321, 1, 30.25, 'item1321');
+INSERT INTO items VALUES (1322, 2, 30.50, 'item1322');
+INSERT INTO items VALUES (1323, 3, 30.75, 'item1323');
+INSERT INTO items VALUES (1324, 4, 31.00, 'item1324');
+INSERT INTO items VALUES (1325, 5, 31.25, 'item1325');
+INSERT INTO items VALUES (1326, 6, 31.50, 'item1326');
+INSERT INTO items VALUES (1327, 7, 31.75, 'item1327');
+INSERT INTO items VALUES (1328, 8, 32.00, 'item1328');
+INSERT INTO items VALUES (1329, 9, 32.25, 'item1329');
+INSERT INTO items VALUES (1330, 10, 32.50, 'item1330');
+INSERT INTO items VALUES (1331, 11, 32.75, 'item1331');
+INSERT INTO items VALUES (1332, 12, 33.00, 'item1332');
+INSERT INTO items VALUES (1333, 13, 33.25, 'item1333');
+INSERT INTO items VALUES (1334, 14, 33.50, 'item1334');
+INSERT INTO items VALUES (1335, 15, 33.75, 'item1335');
+INSERT INTO items VALUES (1336, 16, 34.00, 'item1336');
+INSERT INTO items VALUES (1337, 17, 34.25, 'item1337');
+INSERT INTO items VALUES (1338, 18, 34.50, 'item1338');
+INSERT INTO items VALUES (1339, 19, 34.75, 'item1339');
+INSERT INTO items VALUES (1340, 20, 35.00, 'item1340');
+INSERT INTO items VALUES (1341, 21, 35.25, 'item1341');
+INSERT INTO items VALUES (1342, 22, 35.50, 'item1342');
+INSERT INTO items VALUES (1343, 23, 35.75, 'item1343');
+INSERT INTO items VALUES (1344, 24, 36.00, 'item1344');
+INSERT INTO items VALUES (1345, 25, 36.25, 'item1345');
+INSERT INTO items VALUES (1346, 26, 36.50, 'item1346');
+INSERT INTO items VALUES (1347, 27, 36.75, 'item1347');
+INSERT INTO items VALUES (1348, 28, 37.00, 'item1348');
+INSERT INTO items VALUES (1349, 29, 37.25, 'item1349');
+INSERT INTO items VALUES (1350, 30, 37.50, 'item1350');
+INSERT INTO items VALUES (1351, 31, 37.75, 'item1351');
+INSERT INTO items VALUES (1352, 32, 38.00, 'item1352');
+INSERT INTO items VALUES (1353, 33, 38.25, 'item1353');
+INSERT INTO items VALUES (1354, 34, 38.50, 'item1354');
+INSERT INTO items VALUES (1355, 35, 38.75, 'item1355');
+INSERT INTO items VALUES (1356, 36, 39.00, 'item1356');
+INSERT INTO items VALUES (1357, 37, 39.25, 'item1357');
+INSERT INTO items VALUES (1358, 38, 39.50, 'item1358');
+INSERT INTO items VALUES (1359, 39, 39.75, 'item1359');
+INSERT INTO items VALUES (1360, 0, 40.00, 'item1360');
+INSERT INTO items VALUES (1361, 1, 40.25, 'item1361');
+INSERT INTO items VALUES (1362, 2, 40.50, 'item1362');
+INSERT INTO items VALUES (1363, 3, 40.75, 'item1363');
+INSERT INTO items VALUES (1364, 4, 41.00, 'item1364');
+INSERT INTO items VALUES (1365, 5, 41.25, 'item1365');
+INSERT INTO items VALUES (1366, 6, 41.50, 'item1366');
+INSERT INTO items VALUES (1367, 7, 41.75, 'item1367');
+INSERT INTO items VALUES (1368, 8, 42.00, 'item1368');
+INSERT INTO items VALUES (1369, 9, 42.25, 'item1369');
+INSERT INTO items VALUES (1370, 10, 42.50, 'item1370');
+INSERT INTO items VALUES (1371, 11, 42.75, 'item1371');
+INSERT INTO items VALUES (1372, 12, 43.00, 'item1372');
+INSERT INTO items VALUES (1373, 13, 43.25, 'item1373');
+INSERT INTO items VALUES (1374, 14, 43.50, 'item1374');
+INSERT INTO items VALUES (1375, 15, 43.75, 'item1375');
+INSERT INTO items VALUES (1376, 16, 44.00, 'item1376');
+INSERT INTO items VALUES (1377, 17, 44.25, 'item1377');
+INSERT INTO items VALUES (1378, 18, 44.50, 'item1378');
+INSERT INTO items VALUES (1379, 19, 44.75, 'item1379');
+INSERT INTO items VALUES (1380, 20, 45.00, 'item1380');
+INSERT INTO items VALUES (1381, 21, 45.25, 'item1381');
+INSERT INTO items VALUES (1382, 22, 45.50, 'item1382');
+INSERT INTO items VALUES (1383, 23, 45.75, 'item1383');
+INSERT INTO items VALUES (1384, 24, 46.00, 'item1384');
+INSERT INTO items VALUES (1385, 25, 46.25, 'item1385');
+INSERT INTO items VALUES (1386, 26, 46.50, 'item1386');
+INSERT INTO items VALUES (1387, 27, 46.75, 'item1387');
+INSERT INTO items VALUES (1388, 28, 47.00, 'item1388');
+INSERT INTO items VALUES (1389, 29, 47.25, 'item1389');
+INSERT INTO items VALUES (1390, 30, 47.50, 'item1390');
+INSERT INTO items VALUES (1391, 31, 47.75, 'item1391');
+INSERT INTO items VALUES (1392, 32, 48.00, 'item1392');
+INSERT INTO items VALUES (1393, 33, 48.25, 'item1393');
+INSERT INTO items VALUES (1394, 34, 48.50, 'item1394');
+INSERT INTO items VALUES (1395, 35, 48.75, 'item1395');
+INSERT INTO items VALUES (1396, 36, 49.00, 'item1396');
+INSERT INTO items VALUES (1397, 37, 49.25, 'item1397');
+INSERT INTO items VALUES (1398, 38, 49.50, 'item1398');
+INSERT INTO items VALUES (1399, 39, 49.75, 'item1399');
+INSERT INTO items VALUES (1400, 0, 50.00, 'item1400');
+INSERT INTO items VALUES (1401, 1, 50.25, 'item1401');
+INSERT INTO items VALUES (1402, 2, 50.50, 'item1402');
+INSERT INTO items VALUES (1403, 3, 50.75, 'item1403');
+INSERT INTO items VALUES (1404, 4, 51.00, 'item1404');
+INSERT INTO items VALUES (1405, 5, 51.25, 'item1405');
+INSERT INTO items VALUES (1406, 6, 51.50, 'item1406');
+INSERT INTO items VALUES (1407, 7, 51.75, 'item1407');
+INSERT INTO items VALUES (1408, 8, 52.00, 'item1408');
+INSERT INTO items VALUES (1409, 9, 52.25, 'item1409');
+INSERT INTO items VALUES (1410, 10, 52.50, 'item1410');
+INSERT INTO items VALUES (1411, 11, 52.75, 'item1411');
+INSERT INTO items VALUES (1412, 12, 53.00, 'item1412');
+INSERT INTO items VALUES (1413, 13, 53.25, 'item1413');
+INSERT INTO items VALUES (1414, 14, 53.50, 'item1414');
+INSERT INTO items VALUES (1415, 15, 53.75, 'item1415');
+INSERT INTO items VALUES (1416, 16, 54.00, 'item1416');
+INSERT INTO items VALUES (1417, 17, 54.25, 'item1417');
+INSERT INTO items VALUES (1418, 18, 54.50, 'item1418');
+INSERT INTO items VALUES (1419, 19, 54.75, 'item1419');
+INSERT INTO items VALUES (1420, 20, 55.00, 'item1420');
+INSERT INTO items VALUES (1421, 21, 55.25, 'item1421');
+INSERT INTO items VALUES (1422, 22, 55.50, 'item1422');
+INSERT INTO items VALUES (1423, 23, 55.75, 'item1423');
+INSERT INTO items VALUES (1424, 24, 56.00, 'item1424');
+INSERT INTO items VALUES (1425, 25, 56.25, 'item1425');
+INSERT INTO items VALUES (1426, 26, 56.50, 'item1426');
+INSERT INTO items VALUES (1427, 27, 56.75, 'item1427');
+INSERT INTO items VALUES (1428, 28, 57.00, 'item1428');
+INSERT INTO items VALUES (1429, 29, 57.25, 'item1429');
+INSERT INTO items VALUES (1430, 30, 57.50, 'item1430');
+INSERT INTO items VALUES (1431, 31, 57.75, 'item1431');
+INSERT INTO items VALUES (1432, 32, 58.00, 'item1432');
+INSERT INTO items VALUES (1433, 33, 58.25, 'item1433');
+INSERT INTO items VALUES (1434, 34, 58.50, 'item1434');
+INSERT INTO items VALUES (1435, 35, 58.75, 'item1435');
+INSERT INTO items VALUES (1436, 36, 59.00, 'item1436');
+INSERT INTO items VALUES (1437, 37, 59.25, 'item1437');
+INSERT INTO items VALUES (1438, 38, 59.50, 'item1438');
+INSERT INTO items VALUES (1439, 39, 59.75, 'item1439');
+INSERT INTO items VALUES (1440, 0, 60.00, 'item1440');
+INSERT INTO items VALUES (1441, 1, 60.25, 'item1441');
+INSERT INTO items VALUES (1442, 2, 60.50, 'item1442');
+INSERT INTO items VALUES (1443, 3, 60.75, 'item1443');
+INSERT INTO items VALUES (1444, 4, 61.00, 'item1444');
+INSERT INTO items VALUES (1445, 5, 61.25, 'item1445');
+INSERT INTO items VALUES (1446, 6, 61.50, 'item1446');
+INSERT INTO items VALUES (1447, 7, 61.75, 'item1447');
+INSERT INTO items VALUES (1448, 8, 62.00, 'item1448');
+INSERT INTO items VALUES (1449, 9, 62.25, 'item1449');
+INSERT INTO items VALUES (1450, 10, 62.50, 'item1450');
+INSERT INTO items VALUES (1451, 11, 62.75, 'item1451');
+INSERT INTO items VALUES (1452, 12, 63.00, 'item1452');
+INSERT INTO items VALUES (1453, 13, 63.25, 'item1453');
+INSERT INTO items VALUES (1454, 14, 63.50, 'item1454');
+INSERT INTO items VALUES (1455, 15, 63.75, 'item1455');
+INSERT INTO items VALUES (1456, 16, 64.00, 'item1456');
+INSERT INTO items VALUES (1457, 17, 64.25, 'item1457');
+INSERT INTO items VALUES (1458, 18, 64.50, 'item1458');
+INSERT INTO items VALUES (1459, 19, 64.75, 'item1459');
+INSERT INTO items VALUES (1460, 20, 65.00, 'item1460');
+INSERT INTO items VALUES (1461, 21, 65.25, 'item1461');
+INSERT INTO items VALUES (1462, 22, 65.50, 'item1462');
+INSERT INTO items VALUES (1463, 23, 65.75, 'item1463');
+INSERT INTO items VALUES (1464, 24, 66.00, 'item1464');
+INSERT INTO items VALUES (1465, 25, 66.25, 'item1465');
+INSERT INTO items VALUES (1466, 26, 66.50, 'item1466');
+INSERT INTO items VALUES (1467, 27, 66.75, 'item1467');
+INSERT INTO items VALUES (1468, 28, 67.00, 'item1468');
+INSERT INTO items VALUES (1469, 29, 67.25, 'item1469');
+INSERT INTO items VALUES (1470, 30, 67.50, 'item1470');
+INSERT INTO items VALUES (1471, 31, 67.75, 'item1471');
+INSERT INTO items VALUES (1472, 32, 68.00, 'item1472');
+INSERT INTO items VALUES (1473, 33, 68.25, 'item1473');
+INSERT INTO items VALUES (1474, 34, 68.50, 'item1474');
+INSERT INTO items VALUES (1475, 35, 68.75, 'item1475');
+INSERT INTO items VALUES (1476, 36, 69.00, 'item1476');
+INSERT INTO items VALUES (1477, 37, 69.25, 'item1477');
+INSERT INTO items VALUES (1478, 38, 69.50, 'item1478');
+INSERT INTO items VALUES (1479, 39, 69.75, 'item1479');
+INSERT INTO items VALUES (1480, 0, 70.00, 'item1480');
+INSERT INTO items VALUES (1481, 1, 70.25, 'item1481');
+INSERT INTO items VALUES (1482, 2, 70.50, 'item1482');
+INSERT INTO items VALUES (1483, 3, 70.75, 'item1483');
+INSERT INTO items VALUES (1484, 4, 71.00, 'item1484');
+INSERT INTO items VALUES (1485, 5, 71.25, 'item1485');
+INSERT INTO items VALUES (1486, 6, 71.50, 'item1486');
+INSERT INTO items VALUES (1487, 7, 71.75, 'item1487');
+INSERT INTO items VALUES (1488, 8, 72.00, 'item1488');
+INSERT INTO items VALUES (1489, 9, 72.25, 'item1489');
+INSERT INTO items VALUES (1490, 10, 72.50, 'item1490');
+INSERT INTO items VALUES (1491, 11, 72.75, 'item1491');
+INSERT INTO items VALUES (1492, 12, 73.00, 'item1492');
+INSERT INTO items VALUES (1493, 13, 73.25, 'item1493');
+INSERT INTO items VALUES (1494, 14, 73.50, 'item1494');
+INSERT INTO items VALUES (1495, 15, 73.75, 'item1495');
+INSERT INTO items VALUES (1496, 16, 74.00, 'item1496');
+INSERT INTO items VALUES (1497, 17, 74.25, 'item1497');
+INSERT INTO items VALUES (1498, 18, 74.50, 'item1498');
+INSERT INTO items VALUES (1499, 19, 74.75, 'item1499');
+INSERT INTO items VALUES (1500, 20, 75.00, 'item1500');
+INSERT INTO items VALUES (1501, 21, 75.25, 'item1501');
+INSERT INTO items VALUES (1502, 22, 75.50, 'item1502');
+INSERT INTO items VALUES (1503, 23, 75.75, 'item1503');
+INSERT INTO items VALUES (1504, 24, 76.00, 'item1504');
+INSERT INTO items VALUES (1505, 25, 76.25, 'item1505');
+INSERT INTO items VALUES (1506, 26, 76.50, 'item1506');
+INSERT INTO items VALUES (1507, 27, 76.75, 'item1507');
+INSERT INTO items VALUES (1508, 28, 77.00, 'item1508');
+INSERT INTO items VALUES (1509, 29, 77.25, 'item1509');
+INSERT INTO items VALUES (1510, 30, 77.50, 'item1510');
+INSERT INTO items VALUES (1511, 31, 77.75, 'item1511');
+INSERT INTO items VALUES (1512, 32, 78.00, 'item1512');
+INSERT INTO items VALUES (1513, 33, 78.25, 'item1513');
+INSERT INTO items VALUES (1514, 34, 78.50, 'item1514');
+INSERT INTO items VALUES (1515, 35, 78.75, 'item1515');
+INSERT INTO items VALUES (1516, 36, 79.00, 'item1516');
+INSERT INTO items VALUES (1517, 37, 79.25, 'item1517');
+INSERT INTO items VALUES (1518, 38, 79.50, 'item1518');
+INSERT INTO items VALUES (1519, 39, 79.75, 'item1519');
+INSERT INTO items VALUES (1520, 0, 80.00, 'item1520');
+INSERT INTO items VALUES (1521, 1, 80.25, 'item1521');
+INSERT INTO items VALUES (1522, 2, 80.50, 'item1522');
+INSERT INTO items VALUES (1523, 3, 80.75, 'item1523');
+INSERT INTO items VALUES (1524, 4, 81.00, 'item1524');
+INSERT INTO items VALUES (1525, 5, 81.25, 'item1525');
+INSERT INTO items VALUES (1526, 6, 81.50, 'item1526');
+INSERT INTO items VALUES (1527, 7, 81.75, 'item1527');
+INSERT INTO items VALUES (1528, 8, 82.00, 'item1528');
+INSERT INTO items VALUES (1529, 9, 82.25, 'item1529');
+INSERT INTO items VALUES (1530, 10, 82.50, 'item1530');
+INSERT INTO items VALUES (1531, 11, 82.75, 'item1531');
+INSERT INTO items VALUES (1532, 12, 83.00, 'item1532');
+INSERT INTO items VALUES (1533, 13, 83.25, 'item1533');
+INSERT INTO items VALUES (1534, 14, 83.50, 'item1534');
+INSERT INTO items VALUES (1535, 15, 83.75, 'item1535');
+INSERT INTO items VALUES (1536, 16, 84.00, 'item1536');
+INSERT INTO items VALUES (1537, 17, 84.25, 'item1537');
+INSERT INTO items VALUES (1538, 18, 84.50, 'item1538');
+INSERT INTO items VALUES (1539, 19, 84.75, 'item1539');
+INSERT INTO items VALUES (1540, 20, 85.00, 'item1540');
+INSERT INTO items VALUES (1541, 21, 85.25, 'item1541');
+INSERT INTO items VALUES (1542, 22, 85.50, 'item1542');
+INSERT INTO items VALUES (1543, 23, 85.75, 'item1543');
+INSERT INTO items VALUES (1544, 24, 86.00, 'item1544');
+INSERT INTO items VALUES (1545, 25, 86.25, 'item1545');
+INSERT INTO items VALUES (1546, 26, 86.50, 'item1546');
+INSERT INTO items VALUES (1547, 27, 86.75, 'item1547');
+INSERT INTO items VALUES (1548, 28, 87.00, 'item1548');
+INSERT INTO items VALUES (1549, 29, 87.25, 'item1549');
+INSERT INTO items VALUES (1550, 30, 87.50, 'item1550');
+INSERT INTO items VALUES (1551, 31, 87.75, 'item1551');
+INSERT INTO items VALUES (1552, 32, 88.00, 'item1552');
+INSERT INTO items VALUES (1553, 33, 88.25, 'item1553');
+INSERT INTO items VALUES (1554, 34, 88.50, 'item1554');
+INSERT INTO items VALUES (1555, 35, 88.75, 'item1555');
+INSERT INTO items VALUES (1556, 36, 89.00, 'item1556');
+INSERT INTO items VALUES (1557, 37, 89.25, 'item1557');
+INSERT INTO items VALUES (1558, 38, 89.50, 'item1558');
+INSERT INTO items VALUES (1559, 39, 89.75, 'item1559');
+INSERT INTO items VALUES (1560, 0, 90.00, 'item1560');
+INSERT INTO items VALUES (1561, 1, 90.25, 'item1561');
+INSERT INTO items VALUES (1562, 2, 90.50, 'item1562');
+INSERT INTO items VALUES (1563, 3, 90.75, 'item1563');
+INSERT INTO items VALUES (1564, 4, 91.00, 'item1564');
+INSERT INTO items VALUES (1565, 5, 91.25, 'item1565');
+INSERT INTO items VALUES (1566, 6, 91.50, 'item1566');
+INSERT INTO items VALUES (1567, 7, 91.75, 'item1567');
+INSERT INTO items VALUES (1568, 8, 92.00, 'item1568');
+INSERT INTO items VALUES (1569, 9, 92.25, 'item1569');
+INSERT INTO items VALUES (1570, 10, 92.50, 'item1570');
+INSERT INTO items VALUES (1571, 11, 92.75, 'item1571');
+INSERT INTO items VALUES (1572, 12, 93.00, 'item1572');
+INSERT INTO items VALUES (1573, 13, 93.25, 'item1573');
+INSERT INTO items VALUES (1574, 14, 93.50, 'item1574');
+INSERT INTO items VALUES (1575, 15, 93.75, 'item1575');
+INSERT INTO items VALUES (1576, 16, 94.00, 'item1576');
+INSERT INTO items VALUES (1577, 17, 94.25, 'item1577');
+INSERT INTO items VALUES (1578, 18, 94.50, 'item1578');
+INSERT INTO items VALUES (1579, 19, 94.75, 'item1579');
+INSERT INTO items VALUES (1580, 20, 95.00, 'item1580');
+INSERT INTO items VALUES (1581, 21, 95.25, 'item1581');
+INSERT INTO items VALUES (1582, 22, 95.50, 'item1582');
+INSERT INTO items VALUES (1583, 23, 95.75, 'item1583');
+INSERT INTO items VALUES (1584, 24, 96.00, 'item1584');
+INSERT INTO items VALUES (1585, 25, 96.25, 'item1585');
+INSERT INTO items VALUES (1586, 26, 96.50, 'item1586');
+INSERT INTO items VALUES (1587, 27, 96.75, 'item1587');
+INSERT INTO items VALUES (1588, 28, 97.00, 'item1588');
+INSERT INTO items VALUES (1589, 29, 97.25, 'item1589');
+INSERT INTO items VALUES (1590, 30, 97.50, 'item1590');
+INSERT INTO items VALUES (1591, 31, 97.75, 'item1591');
+INSERT INTO items VALUES (1592, 32, 98.00, 'item1592');
+INSERT INTO items VALUES (1593, 33, 98.25, 'item1593');
+INSERT INTO items VALUES (1594, 34, 98.50, 'item1594');
+INSERT INTO items VALUES (1595, 35, 98.75, 'item1595');
+INSERT INTO items VALUES (1596, 36, 99.00, 'item1596');
+INSERT INTO items VALUES (1597, 37, 99.25, 'item1597');
+INSERT INTO items VALUES (1598, 38, 99.50, 'item1598');
+INSERT INTO items VALUES (1599, 39, 99.75, 'item1599');
+INSERT INTO items VALUES (1600, 0, 0.00, 'item1600');
+INSERT INTO items VALUES (1601, 1, 0.25, 'item1601');
+INSERT INTO items VALUES (1602, 2, 0.50, 'item1602');
+INSERT INTO items VALUES (1603, 3, 0.75, 'item1603');
+INSERT INTO items VALUES (1604, 4, 1.00, 'item1604');
+INSERT INTO items VALUES (1605, 5, 1.25, 'item1605');
+INSERT INTO items VALUES (1606, 6, 1.50, 'item1606');
+INSERT INTO items VALUES (1607, 7, 1.75, 'item1607');
+INSERT INTO items VALUES (1608, 8, 2.00, 'item1608');
+INSERT INTO items VALUES (1609, 9, 2.25, 'item1609');
+INSERT INTO items VALUES (1610, 10, 2.50, 'item1610');
+INSERT INTO items VALUES (1611, 11, 2.75, 'item1611');
+INSERT INTO items VALUES (1612, 12, 3.00, 'item1612');
+INSERT INTO items VALUES (1613, 13, 3.25, 'item1613');
+INSERT INTO items VALUES (1614, 14, 3.50, 'item1614');
+INSERT INTO items VALUES (1615, 15, 3.75, 'item1615');
+INSERT INTO items VALUES (1616, 16, 4.00, 'item1616');
+INSERT INTO items VALUES (1617, 17, 4.25, 'item1617');
+INSERT INTO items VALUES (1618, 18, 4.50, 'item1618');
+INSERT INTO items VALUES (1619, 19, 4.75, 'item1619');
+INSERT INTO items VALUES (1620, 20, 5.00, 'item1620');
+INSERT INTO items VALUES (1621, 21, 5.25, 'item1621');
+INSERT INTO items VALUES (1622, 22, 5.50, 'item1622');
+INSERT INTO items VALUES (1623, 23, 5.75, 'item1623');
+INSERT INTO items VALUES (1624, 24, 6.00, 'item1624');
+INSERT INTO items VALUES (1625, 25, 6.25, 'item1625');
+INSERT INTO items VALUES (1626, 26, 6.50, 'item1626');
+INSERT INTO items VALUES (1627, 27, 6.75, 'item1627');
+INSERT INTO items VALUES (1628, 28, 7.00, 'item1628');
+INSERT INTO items VALUES (1629, 29, 7.25, 'item1629');
+INSERT INTO items VALUES (1630, 30, 7.50, 'item1630');
+INSERT INTO items VALUES (1631, 31, 7.75, 'item1631');
+INSERT INTO items VALUES (1632, 32, 8.00, 'item1632');
+INSERT INTO items VALUES (1633, 33, 8.25, 'item1633');
+INSERT INTO items VALUES (1634, 34, 8.50, 'item1634');
+INSERT INTO items VALUES (1635, 35, 8.75, 'item1635');
+INSERT INTO items VALUES (1636, 36, 9.00, 'item1636');
+INSERT INTO items VALUES (1637, 37, 9.25, 'item1637');
+INSERT INTO items VALUES (1638, 38, 9.50, 'item1638');
+INSERT INTO items VALUES (1639, 39, 9.75, 'item1639');
+INSERT INTO items VALUES (1640, 0, 10.00, 'item1640');
+INSERT INTO items VALUES (1641, 1, 10.25, 'item1641');
+INSERT INTO items VALUES (1642, 2, 10.50, 'item1642');
+INSERT INTO items VALUES (1643, 3, 10.75, 'item1643');
+INSERT INTO items VALUES (1644, 4, 11.00, 'item1644');
+INSERT INTO items VALUES (1645, 5, 11.25, 'item1645');
+INSERT INTO items VALUES (1646, 6, 11.50, 'item1646');
+INSERT INTO items VALUES (1647, 7, 11.75, 'item1647');
+INSERT INTO items VALUES (1648, 8, 12.00, 'item1648');
+INSERT INTO items VALUES (1649, 9, 12.25, 'item1649');
+INSERT INTO items VALUES (1650, 10, 12.50, 'item1650');
+INSERT INTO items VALUES (1651, 11, 12.75, 'item1651');
+INSERT INTO items VALUES (1652, 12, 13.00, 'item1652');
+INSERT INTO items VALUES (1653, 13, 13.25, 'item1653');
+INSERT INTO items VALUES (1654, 14, 13.50, 'item1654');
+INSERT INTO items VALUES (1655, 15, 13.75, 'item1655');
+INSERT INTO items VALUES (1656, 16, 14.00, 'item1656');
+INSERT INTO items VALUES (1657, 17, 14.25, 'item1657');
+INSERT INTO items VALUES (1658, 18, 14.50, 'item1658');
+INSERT INTO items VALUES (1659, 19, 14.75, 'item1659');
+INSERT INTO items VALUES (1660, 20, 15.00, 'item1660');
+INSERT INTO items VALUES (1661, 21, 15.25, 'item1661');
+INSERT INTO items VALUES (1662, 22, 15.50, 'item1662');
+INSERT INTO items VALUES (1663, 23, 15.75, 'item1663');
+INSERT INTO items VALUES (1664, 24, 16.00, 'item1664');
+INSERT INTO items VALUES (1665, 25, 16.25, 'item1665');
+INSERT INTO items VALUES (1666, 26, 16.50, 'item1666');
+INSERT INTO items VALUES (1667, 27, 16.75, 'item1667');
+INSERT INTO items VALUES (1668, 28, 17.00, 'item1668');
+INSERT INTO items VALUES (1669, 29, 17.25, 'item1669');
+INSERT INTO items VALUES (1670, 30, 17.50, 'item1670');
+INSERT INTO items VALUES (1671, 31, 17.75, 'item1671');
+INSERT INTO items VALUES (1672, 32, 18.00, 'item1672');
+INSERT INTO items VALUES (1673, 33, 18.25, 'item1673');
+INSERT INTO items VALUES (1674, 34, 18.50, 'item1674');
+INSERT INTO items VALUES (1675, 35, 18.75, 'item1675');
+INSERT INTO items VALUES (1676, 36, 19.00, 'item1676');
+INSERT INTO items VALUES (1677, 37, 19.25, 'item1677');
+INSERT INTO items VALUES (1678, 38, 19.50, 'item1678');
+INSERT INTO items VALUES (1679, 39, 19.75, 'item1679');
+INSERT INTO items VALUES (1680, 0, 20.00, 'item1680');
+INSERT INTO items VALUES (1681, 1, 20.25, 'item1681');
+INSERT INTO items VALUES (1682, 2, 20.50, 'item1682');
+INSERT INTO items VALUES (1683, 3, 20.75, 'item1683');
+INSERT INTO items VALUES (1684, 4, 21.00, 'item1684');
+INSERT INTO items VALUES (1685, 5, 21.25, 'item1685');
+INSERT INTO items VALUES (1686, 6, 21.50, 'item1686');
+INSERT INTO items VALUES (1687, 7, 21.75, 'item1687');
+INSERT INTO items VALUES (1688, 8, 22.00, 'item1688');
+INSERT INTO items VALUES (1689, 9, 22.25, 'item1689');
+INSERT INTO items VALUES (1690, 10, 22.50, 'item1690');
+INSERT INTO items VALUES (1691, 11, 22.75, 'item1691');
+INSERT INTO items VALUES (1692, 12, 23.00, 'item1692');
+INSERT INTO items VALUES (1693, 13, 23.25, 'item1693');
+INSERT INTO items VALUES (1694, 14, 23.50, 'item1694');
+INSERT INTO items VALUES (1695, 15, 23.75, 'item1695');
+INSERT INTO items VALUES (1696, 16, 24.00, 'item1696');
+INSERT INTO items VALUES (1697, 17, 24.25, 'item1697');
+INSERT INTO items VALUES (1698, 18, 24.50, 'item1698');
+INSERT INTO items VALUES (1699, 19, 24.75, 'item1699');
+INSERT INTO items VALUES (1700, 20, 25.00, 'item1700');
+INSERT INTO items VALUES (1701, 21, 25.25, 'item1701');
+INSERT INTO items VALUES (1702, 22, 25.50, 'item1702');
+INSERT INTO items VALUES (1703, 23, 25.75, 'item1703');
+INSERT INTO items VALUES (1704, 24, 26.00, 'item1704');
+INSERT INTO items VALUES (1705, 25, 26.25, 'item1705');
+INSERT INTO items VALUES (1706, 26, 26.50, 'item1706');
+INSERT INTO items VALUES (1707, 27, 26.75, 'item1707');
+INSERT INTO items VALUES (1708, 28, 27.00, 'item1708');
+INSERT INTO items VALUES (1709, 29, 27.25, 'item1709');
+INSERT INTO items VALUES (1710, 30, 27.50, 'item1710');
+INSERT INTO items VALUES (1711, 31, 27.75, 'item1711');
+INSERT INTO items VALUES (1712, 32, 28.00, 'item1712');
+INSERT INTO items VALUES (1713, 33, 28.25, 'item1713');
+INSERT INTO items VALUES (1714, 34, 28.50, 'item1714');
+INSERT INTO items VALUES (1715, 35, 28.75, 'item1715');
+INSERT INTO items VALUES (1716, 36, 29.00, 'item1716');
+INSERT INTO items VALUES (1717, 37, 29.25, 'item1717');
+INSERT INTO items VALUES (1718, 38, 29.50, 'item1718');
+INSERT INTO items VALUES (1719, 39, 29.75, 'item1719');
+INSERT INTO items VALUES (1720, 0, 30.00, 'item1720');
+INSERT INTO items VALUES (1721, 1, 30.25, 'item1721');
+INSERT INTO items VALUES (1722, 2, 30.50, 'item1722');
+INSERT INTO items VALUES (1723, 3, 30.75, 'item1723');
+INSERT INTO items VALUES (1724, 4, 31.00, 'item1724');
+INSERT INTO items VALUES (1725, 5, 31.25, 'item1725');
+INSERT INTO items VALUES (1726, 6, 31.50, 'item1726');
+INSERT INTO items VALUES (1727, 7, 31.75, 'item1727');
+INSERT INTO items VALUES (1728, 8, 32.00, 'item1728');
+INSERT INTO items VALUES (1729, 9, 32.25, 'item1729');
+INSERT INTO items VALUES (1730, 10, 32.50, 'item1730');
+INSERT INTO items VALUES (1731, 11, 32.75, 'item1731');
+INSERT INTO items VALUES (1732, 12, 33.00, 'item1732');
+INSERT INTO items VALUES (1733, 13, 33.25, 'item1733');
+INSERT INTO items VALUES (1734, 14, 33.50, 'item1734');
+INSERT INTO items VALUES (1735, 15, 33.75, 'item1735');
+INSERT INTO items VALUES (1736, 16, 34.00, 'item1736');
+INSERT INTO items VALUES (1737, 17, 34.25, 'item1737');
+INSERT INTO items VALUES (1738, 18, 34.50, 'item1738');
+INSERT INTO items VALUES (1739, 19, 34.75, 'item1739');
+INSERT INTO items VALUES (1740, 20, 35.00, 'item1740');
+INSERT INTO items VALUES (1741, 21, 35.25, 'item1741');
+INSERT INTO items VALUES (1742, 22, 35.50, 'item1742');
+INSERT INTO items VALUES (1743, 23, 35.75, 'item1743');
+INSERT INTO items VALUES (1744, 24, 36.00, 'item1744');
+INSERT INTO items VALUES (1745, 25, 36.25, 'item1745');
+INSERT INTO items VALUES (1746, 26, 36.50, 'item1746');
+INSERT INTO items VALUES (1747, 27, 36.75, 'item1747');
+INSERT INTO items VALUES (1748, 28, 37.00, 'item1748');
+INSERT INTO items VALUES (1749, 29, 37.25, 'item1749');
+INSERT INTO items VALUES (1750, 30, 37.50, 'item1750');
+INSERT INTO items VALUES (1751, 31, 37.75, 'item1751');
+INSERT INTO items VALUES (1752, 32, 38.00, 'item1752');
+INSERT INTO items VALUES (1753, 33, 38.25, 'item1753');
+INSERT INTO items VALUES (1754, 34, 38.50, 'item1754');
+INSERT INTO items VALUES (1755, 35, 38.75, 'item1755');
+INSERT INTO items VALUES (1756, 36, 39.00, 'item1756');
+INSERT INTO items VALUES (1757, 37, 39.25, 'item1757');
+INSERT INTO items VALUES (1758, 38, 39.50, 'item1758');
+INSERT INTO items VALUES (1759, 39, 39.75, 'item1759');
+INSERT INTO items VALUES (1760, 0, 40.00, 'item1760');
+INSERT INTO items VALUES (1761, 1, 40.25, 'item1761');
+INSERT INTO items VALUES (1762, 2, 40.50, 'item1762');
+INSERT INTO items VALUES (1763, 3, 40.75, 'item1763');
+INSERT INTO items VALUES (1764, 4, 41.00, 'item1764');
+INSERT INTO items VALUES (1765, 5, 41.25, 'item1765');
+INSERT INTO items VALUES (1766, 6, 41.50, 'item1766');
+INSERT INTO items VALUES (1767, 7, 41.75, 'item1767');
+INSERT INTO items VALUES (1768, 8, 42.00, 'item1768');
+INSERT INTO items VALUES (1769, 9, 42.25, 'item1769');
+INSERT INTO items VALUES (1770, 10, 42.50, 'item1770');
+INSERT INTO items VALUES (1771, 11, 42.75, 'item1771');
+INSERT INTO items VALUES (1772, 12, 43.00, 'item1772');
+INSERT INTO items VALUES (1773, 13, 43.25, 'item1773');
+INSERT INTO items VALUES (1774, 14, 43.50, 'item1774');
+INSERT INTO items VALUES (1775, 15, 43.75, 'item1775');
+INSERT INTO items VALUES (1776, 16, 44.00, 'item1776');
+INSERT INTO items VALUES (1777, 17, 44.25, 'item1777');
+INSERT INTO items VALUES (1778, 18, 44.50, 'item1778');
+INSERT INTO items VALUES (1779, 19, 44.75, 'item1779');
+INSERT INTO items VALUES (1780, 20, 45.00, 'item1780');
+INSERT INTO items VALUES (1781, 21, 45.25, 'item1781');
+INSERT INTO items VALUES (1782, 22, 45.50, 'item1782');
+INSERT INTO items VALUES (1783, 23, 45.75, 'item1783');
+INSERT INTO items VALUES (1784, 24, 46.00, 'item1784');
+INSERT INTO items VALUES (1785, 25, 46.25, 'item1785');
+INSERT INTO items VALUES (1786, 26, 46.50, 'item1786');
+INSERT INTO items VALUES (1787, 27, 46.75, 'item1787');
+INSERT INTO items VALUES (1788, 28, 47.00, 'item1788');
+INSERT INTO items VALUES (1789, 29, 47.25, 'item1789');
+INSERT INTO items VALUES (1790, 30, 47.50, 'item1790');
+INSERT INTO items VALUES (1791, 31, 47.75, 'item1791');
+INSERT INTO items VALUES (1792, 32, 48.00, 'item1792');
+INSERT INTO items VALUES (1793, 33, 48.25, 'item1793');
+INSERT INTO items VALUES (1794, 34, 48.50, 'item1794');
+INSERT INTO items VALUES (1795, 35, 48.75, 'item1795');
+INSERT INTO items VALUES (1796, 36, 49.00, 'item1796');
+INSERT INTO items VALUES (1797, 37, 49.25, 'item1797');
+INSERT INTO items VALUES (1798, 38, 49.50, 'item1798');
+INSERT INTO items VALUES (1799, 39, 49.75, 'item1799');
+INSERT INTO items VALUES (1800, 0, 50.00, 'item1800');
+INSERT INTO items VALUES (1801, 1, 50.25, 'item1801');
+INSERT INTO items VALUES (1802, 2, 50.50, 'item1802');
+INSERT INTO items VALUES (1803, 3, 50.75, 'item1803');
+INSERT INTO items VALUES (1804, 4, 51.00, 'item1804');
+INSERT INTO items VALUES (1805, 5, 51.25, 'item1805');
+INSERT INTO items VALUES (1806, 6, 51.50, 'item1806');
+INSERT INTO items VALUES (1807, 7, 51.75, 'item1807');
+INSERT INTO items VALUES (1808, 8, 52.00, 'item1808');
+INSERT INTO items VALUES (1809, 9, 52.25, 'item1809');
+INSERT INTO items VALUES (1810, 10, 52.50, 'item1810');
+INSERT INTO items VALUES (1811, 11, 52.75, 'item1811');
+INSERT INTO items VALUES (1812, 12, 53.00, 'item1812');
+INSERT INTO items VALUES (1813, 13, 53.25, 'item1813');
+INSERT INTO items VALUES (1814, 14, 53.50, 'item1814');
+INSERT INTO items VALUES (1815, 15, 53.75, 'item1815');
+INSERT INTO items VALUES (1816, 16, 54.00, 'item1816');
+INSERT INTO items VALUES (1817, 17, 54.25, 'item1817');
+INSERT INTO items VALUES (1818, 18, 54.50, 'item1818');
+INSERT INTO items VALUES (1819, 19, 54.75, 'item1819');
+INSERT INTO items VALUES (1820, 20, 55.00, 'item1820');
+INSERT INTO items VALUES (1821, 21, 55.25, 'item1821');
+INSERT INTO items VALUES (1822, 22, 55.50, 'item1822');
+INSERT INTO items VALUES (1823, 23, 55.75, 'item1823');
+INSERT INTO items VALUES (1824, 24, 56.00, 'item1824');
+INSERT INTO items VALUES (1825, 25, 56.25, 'item1825');
+INSERT INTO items VALUES (1826, 26, 56.50, 'item1826');
+INSERT INTO items VALUES (1827, 27, 56.75, 'item1827');
+INSERT INTO items VALUES (1828, 28, 57.00, 'item1828');
+INSERT INTO items VALUES (1829, 29, 57.25, 'item1829');
+INSERT INTO items VALUES (1830, 30, 57.50, 'item1830');
+INSERT INTO items VALUES (1831, 31, 57.75, 'item1831');
+INSERT INTO items VALUES (1832, 32, 58.00, 'item1832');
+INSERT INTO items VALUES (1833, 33, 58.25, 'item1833');
+INSERT INTO items VALUES (1834, 34, 58.50, 'item1834');
+INSERT INTO items VALUES (1835, 35, 58.75, 'item1835');
+INSERT INTO items VALUES (1836, 36, 59.00, 'item1836');
+INSERT INTO items VALUES (1837, 37, 59.25, 'item1837');
+INSERT INTO items VALUES (1838, 38, 59.50, 'item1838');
+INSERT INTO items VALUES (1839, 39, 59.75, 'item1839');
+INSERT INTO items VALUES (1840, 0, 60.00, 'item1840');
+INSERT INTO items VALUES (1841, 1, 60.25, 'item1841');
+INSERT INTO items VALUES (1842, 2, 60.50, 'item1842');
+INSERT INTO items VALUES (1843, 3, 60.75, 'item1843');
+INSERT INTO items VALUES (1844, 4, 61.00, 'item1844');
+INSERT INTO items VALUES (1845, 5, 61.25, 'item1845');
+INSERT INTO items VALUES (1846, 6, 61.50, 'item1846');
+INSERT INTO items VALUES (1847, 7, 61.75, 'item1847');
+INSERT INTO items VALUES (1848, 8, 62.00, 'item1848');
+INSERT INTO items VALUES (1849, 9, 62.25, 'item1849');
+INSERT INTO items VALUES (1850, 10, 62.50, 'item1850');
+INSERT INTO items VALUES (1851, 11, 62.75, 'item1851');
+INSERT INTO items VALUES (1852, 12, 63.00, 'item1852');
+INSERT INTO items VALUES (1853, 13, 63.25, 'item1853');
+INSERT INTO items VALUES (1854, 14, 63.50, 'item1854');
+INSERT INTO items VALUES (1855, 15, 63.75, 'item1855');
+INSERT INTO items VALUES (1856, 16, 64.00, 'item1856');
+INSERT INTO items VALUES (1857, 17, 64.25, 'item1857');
+INSERT INTO items VALUES (1858, 18, 64.50, 'item1858');
+INSERT INTO items VALUES (1859, 19, 64.75, 'item1859');
+INSERT INTO items VALUES (1860, 20, 65.00, 'item1860');
+INSERT INTO items VALUES (1861, 21, 65.25, 'item1861');
+INSERT INTO items VALUES (1862, 22, 65.50, 'item1862');
+INSERT INTO items VALUES (1863, 23, 65.75, 'item1863');
+INSERT INTO items VALUES (1864, 24, 66.00, 'item1864');
+INSERT INTO items VALUES (1865, 25, 66.25, 'item1865');
+INSERT INTO items VALUES (1866, 26, 66.50, 'item1866');
+INSERT INTO items VALUES (1867, 27, 66.75, 'item1867');
+INSERT INTO items VALUES (1868, 28, 67.00, 'item1868');
+INSERT INTO items VALUES (1869, 29, 67.25, 'item1869');
+INSERT INTO items VALUES (1870, 30, 67.50, 'item1870');
+INSERT INTO items VALUES (1871, 31, 67.75, 'item1871');
+INSERT INTO items VALUES (1872, 32, 68.00, 'item1872');
+INSERT INTO items VALUES (1873, 33, 68.25, 'item1873');
+INSERT INTO items VALUES (1874, 34, 68.50, 'item1874');
+INSERT INTO items VALUES (1875, 35, 68.75, 'item1875');
+INSERT INTO items VALUES (1876, 36, 69.00, 'item1876');
+INSERT INTO items VALUES (1877, 37, 69.25, 'item1877');
+INSERT INTO items VALUES (1878, 38, 69.50, 'item1878');
+INSERT INTO items VALUES (1879, 39, 69.75, 'item1879');
+INSERT INTO items VALUES (1880, 0, 70.00, 'item1880');
+INSERT INTO items VALUES (1881, 1, 70.25, 'item1881');
+INSERT INTO items VALUES (1882, 2, 70.50, 'item1882');
+INSERT INTO items VALUES (1883, 3, 70.75, 'item1883');
+INSERT INTO items VALUES (1884, 4, 71.00, 'item1884');
+INSERT INTO items VALUES (1885, 5, 71.25, 'item1885');
+INSERT INTO items VALUES (1886, 6, 71.50, 'item1886');
+INSERT INTO items VALUES (1887, 7, 71.75, 'item1887');
+INSERT INTO items VALUES (1888, 8, 72.00, 'item1888');
+INSERT INTO items VALUES (1889, 9, 72.25, 'item1889');
+INSERT INTO items VALUES (1890, 10, 72.50, 'item1890');
+INSERT INTO items VALUES (1891, 11, 72.75, 'item1891');
+INSERT INTO items VALUES (1892, 12, 73.00, 'item1892');
+INSERT INTO items VALUES (1893, 13, 73.25, 'item1893');
+INSERT INTO items VALUES (1894, 14, 73.50, 'item1894');
+INSERT INTO items VALUES (1895, 15, 73.75, 'item1895');
+INSERT INTO items VALUES (1896, 16, 74.00, 'item1896');
+INSERT INTO items VALUES (1897, 17, 74.25, 'item1897');
+INSERT INTO items VALUES (1898, 18, 74.50, 'item1898');
+INSERT INTO items VALUES (1899, 19, 74.75, 'item1899');
+INSERT INTO items VALUES (1900, 20, 75.00, 'item1900');
+INSERT INTO items VALUES (1901, 21, 75.25, 'item1901');
+INSERT INTO items VALUES (1902, 22, 75.50, 'item1902');
+INSERT INTO items VALUES (1903, 23, 75.75, 'item1903');
+INSERT INTO items VALUES (1904, 24, 76.00, 'item1904');
+INSERT INTO items VALUES (1905, 25, 76.25, 'item1905');
+INSERT INTO items VALUES (1906, 26, 76.50, 'item1906');
+INSERT INTO items VALUES (1907, 27, 76.75, 'item1907');
+INSERT INTO items VALUES (1908, 28, 77.00, 'item1908');
+INSERT INTO items VALUES (1909, 29, 77.25, 'item1909');
+INSERT INTO items VALUES (1910, 30, 77.50, 'item1910');
+INSERT INTO items VALUES (1911, 31, 77.75, 'item1911');
+INSERT INTO items VALUES (1912, 32, 78.00, 'item1912');
+INSERT INTO items VALUES (1913, 33, 78.25, 'item1913');
+INSERT INTO items VALUES (1914, 34, 78.50, 'item1914');
+INSERT INTO items VALUES (1915, 35, 78.75, 'item1915');
+INSERT INTO items VALUES (1916, 36, 79.00, 'item1916');
+INSERT INTO items VALUES (1917, 37, 79.25, 'item1917');
+INSERT INTO items VALUES (1918, 38, 79.50, 'item1918');
+INSERT INTO items VALUES (1919, 39, 79.75, 'item1919');
+INSERT INTO items VALUES (1920, 0, 80.00, 'item1920');
+INSERT INTO items VALUES (1921, 1, 80.25, 'item1921');
+INSERT INTO items VALUES (1922, 2, 80.50, 'item1922');
+INSERT INTO items VALUES (1923, 3, 80.75, 'item1923');
+INSERT INTO items VALUES (1924, 4, 81.00, 'item1924');
+INSERT INTO items VALUES (1925, 5, 81.25, 'item1925');
+INSERT INTO items VALUES (1926, 6, 81.50, 'item1926');
+INSERT INTO items VALUES (1927, 7, 81.75, 'item1927');
+INSERT INTO items VALUES (1928, 8, 82.00, 'item1928');
+INSERT INTO items VALUES (1929, 9, 82.25, 'item1929');
+INSERT INTO items VALUES (1930, 10, 82.50, 'item1930');
+INSERT INTO items VALUES (1931, 11, 82.75, 'item1931');
+INSERT INTO items VALUES (1932, 12, 83.00, 'item1932');
+INSERT INTO items VALUES (1933, 13, 83.25, 'item1933');
+INSERT INTO items VALUES (1934, 14, 83.50, 'item1934');
+INSERT INTO items VALUES (1935, 15, 83.75, 'item1935');
+INSERT INTO items VALUES (1936, 16, 84.00, 'item1936');
+INSERT INTO items VALUES (1937, 17, 84.25, 'item1937');
+INSERT INTO items VALUES (1938, 18, 84.50, 'item1938');
+INSERT INTO items VALUES (1939, 19, 84.75, 'item1939');
+INSERT INTO items VALUES (1940, 20, 85.00, 'item1940');
+INSERT INTO items VALUES (1941, 21, 85.25, 'item1941');
+INSERT INTO items VALUES (1942, 22, 85.50, 'item1942');
+INSERT INTO items VALUES (1943, 23, 85.75, 'item1943');
+INSERT INTO items VALUES (1944, 24, 86.00, 'item1944');
+INSERT INTO items VALUES (1945, 25, 86.25, 'item1945');
+INSERT INTO items VALUES (1946, 26, 86.50, 'item1946');
+INSERT INTO items VALUES (1947, 27, 86.75, 'item1947');
+INSERT INTO items VALUES (1948, 28, 87.00, 'item1948');
+INSERT INTO items VALUES (1949, 29, 87.25, 'item1949');
+INSERT INTO items VALUES (1950, 30, 87.50, 'item1950');
+INSERT INTO items VALUES (1951, 31, 87.75, 'item1951');
+INSERT INTO items VALUES (1952, 32, 88.00, 'item1952');
+INSERT INTO items VALUES (1953, 33, 88.25, 'item1953');
+INSERT INTO items VALUES (1954, 34, 88.50, 'item1954');
+INSERT INTO items VALUES (1955, 35, 88.75, 'item1955');
+INSERT INTO items VALUES (1956, 36, 89.00, 'item1956');
+INSERT INTO items VALUES (1957, 37, 89.25, 'item1957');
+INSERT INTO items VALUES (1958, 38, 89.50, 'item1958');
+INSERT INTO items VALUES (1959, 39, 89.75, 'item1959');
+INSERT INTO items VALUES (1960, 0, 90.00, 'item1960');
+INSERT INTO items VALUES (1961, 1, 90.25, 'item1961');
+INSERT INTO items VALUES (1962, 2, 90.50, 'item1962');
+INSERT INTO items VALUES (1963, 3, 90.75, 'item1963');
+INSERT INTO items VALUES (1964, 4, 91.00, 'item1964');
+INSERT INTO items VALUES (1965, 5, 91.25, 'item1965');
+INSERT INTO items VALUES (1966, 6, 91.50, 'item1966');
+INSERT INTO items VALUES (1967, 7, 91.75, 'item1967');
+INSERT INTO items VALUES (1968, 8, 92.00, 'item1968');
+INSERT INTO items VALUES (1969, 9, 92.25, 'item1969');
+INSERT INTO items VALUES (1970, 10, 92.50, 'item1970');
+INSERT INTO items VALUES (1971, 11, 92.75, 'item1971');
+INSERT INTO items VALUES (1972, 12, 93.00, 'item1972');
+INSERT INTO items VALUES (1973, 13, 93.25, 'item1973');
+INSERT INTO items VALUES (1974, 14, 93.50, 'item1974');
+INSERT INTO items VALUES (1975, 15, 93.75, 'item1975');
+INSERT INTO items VALUES (1976, 16, 94.00, 'item1976');
+INSERT INTO items VALUES (1977, 17, 94.25, 'item1977');
+INSERT INTO items VALUES (1978, 18, 94.50, 'item1978');
+INSERT INTO items VALUES (1979, 19, 94.75, 'item1979');
+INSERT INTO items VALUES (1980, 20, 95.00, 'item1980');
+INSERT INTO items VALUES (1981, 21, 95.25, 'item1981');
+INSERT INTO items VALUES (1982, 22, 95.50, 'item1982');
+INSERT INTO items VALUES (1983, 23, 95.75, 'item1983');
+INSERT INTO items VALUES (1984, 24, 96.00, 'item1984');
+INSERT INTO items VALUES (1985, 25, 96.25, 'item1985');
+INSERT INTO items VALUES (1986, 26, 96.50, 'item1986');
+INSERT INTO items VALUES (1987, 27, 96.75, 'item1987');
+INSERT INTO items VALUES (1988, 28, 97.00, 'item1988');
+INSERT INTO items VALUES (1989, 29, 97.25, 'item1989');
+INSERT INTO items VALUES (1990, 30, 97.50, 'item1990');
+INSERT INTO items VALUES (1991, 31, 97.75, 'item1991');
+INSERT INTO items VALUES (1992, 32, 98.00, 'item1992');
+INSERT INTO items VALUES (1993, 33, 98.25, 'item1993');
+INSERT INTO items VALUES (1994, 34, 98.50, 'item1994');
+INSERT INTO items VALUES (1995, 35, 98.75, 'item1995');
+INSERT INTO items VALUES (1996, 36, 99.00, 'item1996');
+INSERT INTO items VALUES (1997, 37, 99.25, 'item1997');
+INSERT INTO items VALUES (1998, 38, 99.50, 'item1998');
+INSERT INTO items VALUES (1999, 39, 99.75, 'item1999');
+INSERT INTO items VALUES (2000, 0, 0.00, 'item2000');
+INSERT INTO items VALUES (2001, 1, 0.25, 'item2001');
+INSERT INTO items VALUES (2002, 2, 0.50, 'item2002');
+INSERT INTO items VALUES (2003, 3, 0.75, 'item2003');
+INSERT INTO items VALUES (2004, 4, 1.00, 'item2004');
+INSERT INTO items VALUES (2005, 5, 1.25, 'item2005');
+INSERT INTO items VALUES (2006, 6, 1.50, 'item2006');
+INSERT INTO items VALUES (2007, 7, 1.75, 'item2007');
+INSERT INTO items VALUES (2008, 8, 2.00, 'item2008');
+INSERT INTO items VALUES (2009, 9, 2.25, 'item2009');
+INSERT INTO items VALUES (2010, 10, 2.50, 'item2010');
+INSERT INTO items VALUES (2011, 11, 2.75, 'item2011');
+INSERT INTO items VALUES (2012, 12, 3.00, 'item2012');
+INSERT INTO items VALUES (2013, 13, 3.25, 'item2013');
+INSERT INTO items VALUES (2014, 14, 3.50, 'item2014');
+INSERT INTO items VALUES (2015, 15, 3.75, 'item2015');
+INSERT INTO items VALUES (2016, 16, 4.00, 'item2016');
+INSERT INTO items VALUES (2017, 17, 4.25, 'item2017');
+INSERT INTO items VALUES (2018, 18, 4.50, 'item2018');
+INSERT INTO items VALUES (2019, 19, 4.75, 'item2019');
+INSERT INTO items VALUES (2020, 20, 5.00, 'item2020');
+INSERT INTO items VALUES (2021, 21, 5.25, 'item2021');
+INSERT INTO items VALUES (2022, 22, 5.50, 'item2022');
+INSERT INTO items VALUES (2023, 23, 5.75, 'item2023');
+INSERT INTO items VALUES (2024, 24, 6.00, 'item2024');
+INSERT INTO items VALUES (2025, 25, 6.25, 'item2025');
+INSERT INTO items VALUES (2026, 26, 6.50, 'item2026');
+INSERT INTO items VALUES (2027, 27, 6.75, 'item2027');
+INSERT INTO items VALUES (2028, 28, 7.00, 'item2028');
+INSERT INTO items VALUES (2029, 29, 7.25, 'item2029');
+INSERT INTO items VALUES (2030, 30, 7.50, 'item2030');
+INSERT INTO items VALUES (2031, 31, 7.75, 'item2031');
+INSERT INTO items VALUES (2032, 32, 8.00, 'item2032');
+INSERT INTO items VALUES (2033, 33, 8.25, 'item2033');
+INSERT INTO items VALUES (2034, 34, 8.50, 'item2034');
+INSERT INTO items VALUES (2035, 35, 8.75, 'item2035');
+INSERT INTO items VALUES (2036, 36, 9.00, 'item2036');
+INSERT INTO items VALUES (2037, 37, 9.25, 'item2037');
+INSERT INTO items VALUES (2038, 38, 9.50, 'item2038');
+INSERT INTO items VALUES (2039, 39, 9.75, 'item2039');
+INSERT INTO items VALUES (2040, 0, 10.00, 'item2040');
+INSERT INTO items VALUES (2041, 1, 10.25, 'item2041');
+INSERT INTO items VALUES (2042, 2, 10.50, 'item2042');
+INSERT INTO items VALUES (2043, 3, 10.75, 'item2043');
+INSERT INTO items VALUES (2044, 4, 11.00, 'item2044');
+INSERT INTO items VALUES (2045, 5, 11.25, 'item2045');
+INSERT INTO items VALUES (2046, 6, 11.50, 'item2046');
+INSERT INTO items VALUES (2047, 7, 11.75, 'item2047');
+INSERT INTO items VALUES (2048, 8, 12.00, 'item2048');
+INSERT INTO items VALUES (2049, 9, 12.25, 'item2049');
+INSERT INTO items VALUES (2050, 10, 12.50, 'item2050');
+INSERT INTO items VALUES (2051, 11, 12.75, 'item2051');
+INSERT INTO items VALUES (2052, 12, 13.00, 'item2052');
+INSERT INTO items VALUES (2053, 13, 13.25, 'item2053');
+INSERT INTO items VALUES (2054, 14, 13.50, 'item2054');
+INSERT INTO items VALUES (2055, 15, 13.75, 'item2055');
+INSERT INTO items VALUES (2056, 16, 14.00, 'item2056');
+INSERT INTO items VALUES (2057, 17, 14.25, 'item2057');
+INSERT INTO items VALUES (2058, 18, 14.50, 'item2058');
+INSERT INTO items VALUES (2059, 19, 14.75, 'item2059');
+INSERT INTO items VALUES (2060, 20, 15.00, 'item2060');
+INSERT INTO items VALUES (2061, 21, 15.25, 'item2061');
+INSERT INTO items VALUES (2062, 22, 15.50, 'item2062');
+INSERT INTO items VALUES (2063, 23, 15.75, 'item2063');
+INSERT INTO items VALUES (2064, 24, 16.00, 'item2064');
+INSERT INTO items VALUES (2065, 25, 16.25, 'item2065');
+INSERT INTO items VALUES (2066, 26, 16.50, 'item2066');
+INSERT INTO items VALUES (2067, 27, 16.75, 'item2067');
+INSERT INTO items VALUES (2068, 28, 17.00, 'item2068');
+INSERT INTO items VALUES (2069, 29, 17.25, 'item2069');
+INSERT INTO items VALUES (2070, 30, 17.50, 'item2070');
+INSERT INTO items VALUES (2071, 31, 17.75, 'item2071');
+INSERT INTO items VALUES (2072, 32, 18.00, 'item2072');
+INSERT INTO items VALUES (2073, 33, 18.25, 'item2073');
+INSERT INTO items VALUES (2074, 34, 18.50, 'item2074');
+INSERT INTO items VALUES (2075, 35, 18.75, 'item2075');
+INSERT INTO items VALUES (2076, 36, 19.00, 'item2076');
+INSERT INTO items VALUES (2077, 37, 19.25, 'item2077');
+INSERT INTO items VALUES (2078, 38, 19.50, 'item2078');
+INSERT INTO items VALUES (2079, 39, 19.75, 'item2079');
+INSERT INTO items VALUES (2080, 0, 20.00, 'item2080');
+INSERT INTO items VALUES (2081, 1, 20.25, 'item2081');
+INSERT INTO items VALUES (2082, 2, 20.50, 'item2082');
+INSERT INTO items VALUES (2083, 3, 20.75, 'item2083');
+INSERT INTO items VALUES (2084, 4, 21.00, 'item2084');
+INSERT INTO items VALUES (2085, 5, 21.25, 'item2085');
+INSERT INTO items VALUES (2086, 6, 21.50, 'item2086');
+INSERT INTO items VALUES (2087, 7, 21.75, 'item2087');
+INSERT INTO items VALUES (2088, 8, 22.00, 'item2088');
+INSERT INTO items VALUES (2089, 9, 22.25, 'item2089');
+INSERT INTO items VALUES (2090, 10, 22.50, 'item2090');
+INSERT INTO items VALUES (2091, 11, 22.75, 'item2091');
+INSERT INTO items VALUES (2092, 12, 23.00, 'item2092');
+INSERT INTO items VALUES (2093, 13, 23.25, 'item2093');
+INSERT INTO items VALUES (2094, 14, 23.50, 'item2094');
+INSERT INTO items VALUES (2095, 15, 23.75, 'item2095');
+INSERT INTO items VALUES (2096, 16, 24.00, 'item2096');
+INSERT INTO items VALUES (2097, 17, 24.25, 'item2097');
+INSERT INTO items VALUES (2098, 18, 24.50, 'item2098');
+INSERT INTO items VALUES (2099, 19, 24.75, 'item2099');
+INSERT INTO items VALUES (2100, 20, 25.00, 'item2100');
+INSERT INTO items VALUES (2101, 21, 25.25, 'item2101');
+INSERT INTO items VALUES (2102, 22, 25.50, 'item2102');
+INSERT INTO items VALUES (2103, 23, 25.75, 'item2103');
+INSERT INTO items VALUES (2104, 24, 26.00, 'item2104');
+INSERT INTO items VALUES (2105, 25, 26.25, 'item2105');
+INSERT INTO items VALUES (2106, 26, 26.50, 'item2106');
+INSERT INTO items VALUES (2107, 27, 26.75, 'item2107');
+INSERT INTO items VALUES (2108, 28, 27.00, 'item2108');
+INSERT INTO items VALUES (2109, 29, 27.25, 'item2109');
+INSERT INTO items VALUES (2110, 30, 27.50, 'item2110');
+INSERT INTO items VALUES (2111, 31, 27.75, 'item2111');
+INSERT INTO items VALUES (2112, 32, 28.00, 'item2112');
+INSERT INTO items VALUES (2113, 33, 28.25, 'item2113');
+INSERT INTO items VALUES (2114, 34, 28.50, 'item2114');
+INSERT INTO items VALUES (2115, 35, 28.75, 'item2115');
+INSERT INTO items VALUES (2116, 36, 29.00, 'item2116');
+INSERT INTO items VALUES (2117, 37, 29.25, 'item2117');
+INSERT INTO items VALUES (2118, 38, 29.50, 'item2118');
+INSERT INTO items VALUES (2119, 39, 29.75, 'item2119');
+INSERT INTO items VALUES (2120, 0, 30.00, 'item2120');
+INSERT INTO items VALUES (2121, 1, 30.25, 'item2121');
+INSERT INTO items VALUES (2122, 2, 30.50, 'item2122');
+INSERT INTO items VALUES (2123, 3, 30.75, 'item2123');
+INSERT INTO items VALUES (2124, 4, 31.00, 'item2124');
+INSERT INTO items VALUES (2125, 5, 31.25, 'item2125');
+INSERT INTO items VALUES (2126, 6, 31.50, 'item2126');
+INSERT INTO items VALUES (2127, 7, 31.75, 'item2127');
+INSERT INTO items VALUES (2128, 8, 32.00, 'item2128');
+INSERT INTO items VALUES (2129, 9, 32.25, 'item2129');
+INSERT INTO items VALUES (2130, 10, 32.50, 'item2130');
+INSERT INTO items VALUES (2131, 11, 32.75, 'item2131');
+INSERT INTO items VALUES (2132, 12, 33.00, 'item2132');
+INSERT INTO items VALUES (2133, 13, 33.25, 'item2133');
+INSERT INTO items VALUES (2134, 14, 33.50, 'item2134');
+INSERT INTO items VALUES (2135, 15, 33.75, 'item2135');
+INSERT INTO items VALUES (2136, 16, 34.00, 'item2136');
+INSERT INTO items VALUES (2137, 17, 34.25, 'item2137');
+INSERT INTO items VALUES (2138, 18, 34.50, 'item2138');
+INSERT INTO items VALUES (2139, 19, 34.75, 'item2139');
+INSERT INTO items VALUES (2140, 20, 35.00, 'item2140');
+INSERT INTO items VALUES (2141, 21, 35.25, 'item2141');
+INSERT INTO items VALUES (2142, 22, 35.50, 'item2142');
+INSERT INTO items VALUES (2143, 23, 35.75, 'item2143');
+INSERT INTO items VALUES (2144, 24, 36.00, 'item2144');
+INSERT INTO items VALUES (2145, 25, 36.25, 'item2145');
+INSERT INTO items VALUES (2146, 26, 36.50, 'item2146');
+INSERT INTO items VALUES (2147, 27, 36.75, 'item2147');
+INSERT INTO items VALUES (2148, 28, 37.00, 'item2148');
+INSERT INTO items VALUES (2149, 29, 37.25, 'item2149');
+INSERT INTO items VALUES (2150, 30, 37.50, 'item2150');
+INSERT INTO items VALUES (2151, 31, 37.75, 'item2151');
+INSERT INTO items VALUES (2152, 32, 38.00, 'item2152');
+INSERT INTO items VALUES (2153, 33, 38.25, 'item2153');
+INSERT INTO items VALUES (2154, 34, 38.50, 'item2154');
+INSERT INTO items VALUES (2155, 35, 38.75, 'item2155');
+INSERT INTO items VALUES (2156, 36, 39.00, 'item2156');
+INSERT INTO items VALUES (2157, 37, 39.25, 'item2157');
+INSERT INTO items VALUES (2158, 38, 39.50, 'item2158');
+INSERT INTO items VALUES (2159, 39, 39.75, 'item2159');
+INSERT INTO items VALUES (2160, 0, 40.00, 'item2160');
+INSERT INTO items VALUES (2161, 1, 40.25, 'item2161');
+INSERT INTO items VALUES (2162, 2, 40.50, 'item2162');
+INSERT INTO items VALUES (2163, 3, 40.75, 'item2163');
+INSERT INTO items VALUES (2164, 4, 41.00, 'item2164');
+INSERT INTO items VALUES (2165, 5, 41.25, 'item2165');
+INSERT INTO items VALUES (2166, 6, 41.50, 'item2166');
+INSERT INTO items VALUES (2167, 7, 41.75, 'item2167');
+INSERT INTO items VALUES (2168, 8, 42.00, 'item2168');
+INSERT INTO items VALUES (2169, 9, 42.25, 'item2169');
+INSERT INTO items VALUES (2170, 10, 42.50, 'item2170');
+INSERT INTO items VALUES (2171, 11, 42.75, 'item2171');
+INSERT INTO items VALUES (2172, 12, 43.00, 'item2172');
+INSERT INTO items VALUES (2173, 13, 43.25, 'item2173');
+INSERT INTO items VALUES (2174, 14, 43.50, 'item2174');
+INSERT INTO items VALUES (2175, 15, 43.75, 'item2175');
+INSERT INTO items VALUES (2176, 16, 44.00, 'item2176');
+INSERT INTO items VALUES (2177, 17, 44.25, 'item2177');
+INSERT INTO items VALUES (2178, 18, 44.50, 'item2178');
+INSERT INTO items VALUES (2179, 19, 44.75, 'item2179');
+INSERT INTO items VALUES (2180, 20, 45.00, 'item2180');
+INSERT INTO items VALUES (2181, 21, 45.25, 'item2181');
+INSERT INTO items VALUES (2182, 22, 45.50, 'item2182');
+INSERT INTO items VALUES (2183, 23, 45.75, 'item2183');
+INSERT INTO items VALUES (2184, 24, 46.00, 'item2184');
+INSERT INTO items VALUES (2185, 25, 46.25, 'item2185');
+INSERT INTO items VALUES (2186, 26, 46.50, 'item2186');
+INSERT INTO items VALUES (2187, 27, 46.75, 'item2187');
+INSERT INTO items VALUES (2188, 28, 47.00, 'item2188');
+INSERT INTO items VALUES (2189, 29, 47.25, 'item2189');
+INSERT INTO items VALUES (2190, 30, 47.50, 'item2190');
+INSERT INTO items VALUES (2191, 31, 47.75, 'item2191');
+INSERT INTO items VALUES (2192, 32, 48.00, 'item2192');
+INSERT INTO items VALUES (2193, 33, 48.25, 'item2193');
+INSERT INTO items VALUES (2194, 34, 48.50, 'item2194');
+INSERT INTO items VALUES (2195, 35, 48.75, 'item2195');
+INSERT INTO items VALUES (2196, 36, 49.00, 'item2196');
+INSERT INTO items VALUES (2197, 37, 49.25, 'item2197');
+INSERT INTO items VALUES (2198, 38, 49.50, 'item2198');
+INSERT INTO items VALUES (2199, 39, 49.75, 'item2199');
+INSERT INTO items VALUES (2200, 0, 50.00, 'item2200');
+INSERT INTO items VALUES (2201, 1, 50.25, 'item2201');
+INSERT INTO items VALUES (2202, 2, 50.50, 'item2202');
+INSERT INTO items VALUES (2203, 3, 50.75, 'item2203');
+INSERT INTO items VALUES (2204, 4, 51.00, 'item2204');
+INSERT INTO items VALUES (2205, 5, 51.25, 'item2205');
+INSERT INTO items VALUES (2206, 6, 51.50, 'item2206');
+INSERT INTO items VALUES (2207, 7, 51.75, 'item2207');
+INSERT INTO items VALUES (2208, 8, 52.00, 'item2208');
+INSERT INTO items VALUES (2209, 9, 52.25, 'item2209');
+INSERT INTO items VALUES (2210, 10, 52.50, 'item2210');
+INSERT INTO items VALUES (2211, 11, 52.75, 'item2211');
+INSERT INTO items VALUES (2212, 12, 53.00, 'item2212');
+INSERT INTO items VALUES (2213, 13, 53.25, 'item2213');
+INSERT INTO items VALUES (2214, 14, 53.50, 'item2214');
+INSERT INTO items VALUES (2215, 15, 53.75, 'item2215');
+INSERT INTO items VALUES (2216, 16, 54.00, 'item2216');
+INSERT INTO items VALUES (2217, 17, 54.25, 'item2217');
+INSERT INTO items VALUES (2218, 18, 54.50, 'item2218');
+INSERT INTO items VALUES (2219, 19, 54.75, 'item2219');
+INSERT INTO items VALUES (2220, 20, 55.00, 'item2220');
+INSERT INTO items VALUES (2221, 21, 55.25, 'item2221');
+INSERT INTO items VALUES (2222, 22, 55.50, 'item2222');
+INSERT INTO items VALUES (2223, 23, 55.75, 'item2223');
+INSERT INTO items VALUES (2224, 24, 56.00, 'item2224');
+INSERT INTO items VALUES (2225, 25, 56.25, 'item2225');
+INSERT INTO items VALUES (2226, 26, 56.50, 'item2226');
+INSERT INTO items VALUES (2227, 27, 56.75, 'item2227');
+INSERT INTO items VALUES (2228, 28, 57.00, 'item2228');
+INSERT INTO items VALUES (2229, 29, 57.25, 'item2229');
+INSERT INTO items VALUES (2230, 30, 57.50, 'item2230');
+INSERT INTO items VALUES (2231, 31, 57.75, 'item2231');
+INSERT INTO items VALUES (2232, 32, 58.00, 'item2232');
+INSERT INTO items VALUES (2233, 33, 58.25, 'item2233');
+INSERT INTO items VALUES (2234, 34, 58.50, 'item2234');
+INSERT INTO items VALUES (2235, 35, 58.75, 'item2235');
+INSERT INTO items VALUES (2236, 36, 59.00, 'item2236');
+INSERT INTO items VALUES (2237, 37, 59.25, 'item2237');
+INSERT INTO items VALUES (2238, 38, 59.50, 'item2238');
+INSERT INTO items VALUES (2239, 39, 59.75, 'item2239');
+INSERT INTO items VALUES (2240, 0, 60.00, 'item2240');
+INSERT INTO items VALUES (2241, 1, 60.25, 'item2241');
+INSERT INTO items VALUES (2242, 2, 60.50, 'item2242');
+INSERT INTO items VALUES (2243, 3, 60.75, 'item2243');
+INSERT INTO items VALUES (2244, 4, 61.00, 'item2244');
+INSERT INTO items VALUES (2245, 5, 61.25, 'item2245');
+INSERT INTO items VALUES (2246, 6, 61.50, 'item2246');
+INSERT INTO items VALUES (2247, 7, 61.75, 'item2247');
+INSERT INTO items VALUES (2248, 8, 62.00, 'item2248');
+INSERT INTO items VALUES (2249, 9, 62.25, 'item2249');
+INSERT INTO items VALUES (2250, 10, 62.50, 'item2250');
+INSERT INTO items VALUES (2251, 11, 62.75, 'item2251');
+INSERT INTO items VALUES (2252, 12, 63.00, 'item2252');
+INSERT INTO items VALUES (2253, 13, 63.25, 'item2253');
+INSERT INTO items VALUES (2254, 14, 63.50, 'item2254');
+INSERT INTO items VALUES (2255, 15, 63.75, 'item2255');
+INSERT INTO items VALUES (2256, 16, 64.00, 'item2256');
+INSERT INTO items VALUES (2257, 17, 64.25, 'item2257');
+INSERT INTO items VALUES (2258, 18, 64.50, 'item2258');
+INSERT INTO items VALUES (2259, 19, 64.75, 'item2259');
+INSERT INTO items VALUES (2260, 20, 65.00, 'item2260');
+INSERT INTO items VALUES (2261, 21, 65.25, 'item2261');
+INSERT INTO items VALUES (2262, 22, 65.50, 'item2262');
+INSERT INTO items VALUES (2263, 23, 65.75, 'item2263');
+INSERT INTO items VALUES (2264, 24, 66.00, 'item2264');
+INSERT INTO items VALUES (2265, 25, 66.25, 'item2265');
+INSERT INTO items VALUES (2266, 26, 66.50, 'item2266');
+INSERT INTO items VALUES (2267, 27, 66.75, 'item2267');
+INSERT INTO items VALUES (2268, 28, 67.00, 'item2268');
+INSERT INTO items VALUES (2269, 29, 67.25, 'item2269');
+INSERT INTO items VALUES (2270, 30, 67.50, 'item2270');
+INSERT INTO items VALUES (2271, 31, 67.75, 'item2271');
+INSERT INTO items VALUES (2272, 32, 68.00, 'item2272');
+INSERT INTO items VALUES (2273, 33, 68.25, 'item2273');
+INSERT INTO items VALUES (2274, 34, 68.50, 'item2274');
+INSERT INTO items VALUES (2275, 35, 68.75, 'item2275');
+INSERT INTO items VALUES (2276, 36, 69.00, 'item2276');
+INSERT INTO items VALUES (2277, 37, 69.25, 'item2277');
+INSERT INTO items VALUES (2278, 38, 69.50, 'item2278');
+INSERT INTO items VALUES (2279, 39, 69.75, 'item2279');
+INSERT INTO items VALUES (2280, 0, 70.00, 'item2280');
+INSERT INTO items VALUES (2281, 1, 70.25, 'item2281');
+INSERT INTO items VALUES (2282, 2, 70.50, 'item2282');
+INSERT INTO items VALUES (2283, 3, 70.75, 'item2283');
+INSERT INTO items VALUES (2284, 4, 71.00, 'item2284');
+INSERT INTO items VALUES (2285, 5, 71.25, 'item2285');
+INSERT INTO items VALUES (2286, 6, 71.50, 'item2286');
+INSERT INTO items VALUES (2287, 7, 71.75, 'item2287');
+INSERT INTO items VALUES (2288, 8, 72.00, 'item2288');
+INSERT INTO items VALUES (2289, 9, 72.25, 'item2289');
+INSERT INTO items VALUES (2290, 10, 72.50, 'item2290');
+INSERT INTO items VALUES (2291, 11, 72.75, 'item2291');
+INSERT INTO items VALUES (2292, 12, 73.00, 'item2292');
+INSERT INTO items VALUES (2293, 13, 73.25, 'item2293');
+INSERT INTO items VALUES (2294, 14, 73.50, 'item2294');
+INSERT INTO items VALUES (2295, 15, 73.75, 'item2295');
+INSERT INTO items VALUES (2296, 16, 74.00, 'item2296');
+INSERT INTO items VALUES (2297, 17, 74.25, 'item2297');
+INSERT INTO items VALUES (2298, 18, 74.50, 'item2298');
+INSERT INTO items VALUES (2299, 19, 74.75, 'item2299');
+INSERT INTO items VALUES (2300, 20, 75.00, 'item2300');
+INSERT INTO items VALUES (2301, 21, 75.25, 'item2301');
+INSERT INTO items VALUES (2302, 22, 75.50, 'item2302');
+INSERT INTO items VALUES (2303, 23, 75.75, 'item2303');
+INSERT INTO items VALUES (2304, 24, 76.00, 'item2304');
+INSERT INTO items VALUES (2305, 25, 76.25, 'item2305');
+INSERT INTO items VALUES (2306, 26, 76.50, 'item2306');
+INSERT INTO items VALUES (2307, 27, 76.75, 'item2307');
+INSERT INTO items VALUES (2308, 28, 77.00, 'item2308');
+INSERT INTO items VALUES (2309, 29, 77.25, 'item2309');
+INSERT INTO items VALUES (2310, 30, 77.50, 'item2310');
+INSERT INTO items VALUES (2311, 31, 77.75, 'item2311');
+INSERT INTO items VALUES (2312, 32, 78.00, 'item2312');
+INSERT INTO items VALUES (2313, 33, 78.25, 'item2313');
+INSERT INTO items VALUES (2314, 34, 78.50, 'item2314');
+INSERT INTO items VALUES (2315, 35, 78.75, 'item2315');
+INSERT INTO items VALUES (2316, 36, 79.00, 'item2316');
+INSERT INTO items VALUES (2317, 37, 79.25, 'item2317');
+INSERT INTO items VALUES (2318, 38, 79.50, 'item2318');
+INSERT INTO items VALUES (2319, 39, 79.75, 'item2319');
+INSERT INTO items VALUES (2320, 0, 80.00, 'item2320');
+INSERT INTO items VALUES (2321, 1, 80.25, 'item2321');
+INSERT INTO items VALUES (2322, 2, 80.50, 'item2322');
+INSERT INTO items VALUES (2323, 3, 80.75, 'item2323');
+INSERT INTO items VALUES (2324, 4, 81.00, 'item2324');
+INSERT INTO items VALUES (2325, 5, 81.25, 'item2325');
+INSERT INTO items VALUES (2326, 6, 81.50, 'item2326');
+INSERT INTO items VALUES (2327, 7, 81.75, 'item2327');
+INSERT INTO items VALUES (2328, 8, 82.00, 'item2328');
+INSERT INTO items VALUES (2329, 9, 82.25, 'item2329');
+INSERT INTO items VALUES (2330, 10, 82.50, 'item2330');
+INSERT INTO items VALUES (2331, 11, 82.75, 'item2331');
+INSERT INTO items VALUES (2332, 12, 83.00, 'item2332');
+INSERT INTO items VALUES (2333, 13, 83.25, 'item2333');
+INSERT INTO items VALUES (2334, 14, 83.50, 'item2334');
+INSERT INTO items VALUES (2335, 15, 83.75, 'item2335');
+INSERT INTO items VALUES (2336, 16, 84.00, 'item2336');
+INSERT INTO items VALUES (2337, 17, 84.25, 'item2337');
+INSERT INTO items VALUES (2338, 18, 84.50, 'item2338');
+INSERT INTO items VALUES (2339, 19, 84.75, 'item2339');
+INSERT INTO items VALUES (2340, 20, 85.00, 'item2340');
+INSERT INTO items VALUES (2341, 21, 85.25, 'item2341');
+INSERT INTO items VALUES (2342, 22, 85.50, 'item2342');
+INSERT INTO items VALUES (2343, 23, 85.75, 'item2343');
+INSERT INTO items VALUES (2344, 24, 86.00, 'item2344');
+INSERT INTO items VALUES (2345, 25, 86.25, 'item2345');
+INSERT INTO items VALUES (2346, 26, 86.50, 'item2346');
+INSERT INTO items VALUES (2347, 27, 86.75, 'item2347');
+INSERT INTO items VALUES (2348, 28, 87.00, 'item2348');
+INSERT INTO items VALUES (2349, 29, 87.25, 'item2349');
+INSERT INTO items VALUES (2350, 30, 87.50, 'item2350');
+INSERT INTO items VALUES (2351, 31, 87.75, 'item2351');
+INSERT INTO items VALUES (2352, 32, 88.00, 'item2352');
+INSERT INTO items VALUES (2353, 33, 88.25, 'item2353');
+INSERT INTO items VALUES (2354, 34, 88.50, 'item2354');
+INSERT INTO items VALUES (2355, 35, 88.75, 'item2355');
+INSERT INTO items VALUES (2356, 36, 89.00, 'item2356');
+INSERT INTO items VALUES (2357, 37, 89.25, 'item2357');
+INSERT INTO items VALUES (2358, 38, 89.50, 'item2358');
+INSERT INTO items VALUES (2359, 39, 89.75, 'item2359');
+INSERT INTO items VALUES (2360, 0, 90.00, 'item2360');
+INSERT INTO items VALUES (2361, 1, 90.25, 'item2361');
+INSERT INTO items VALUES (2362, 2, 90.50, 'item2362');
+INSERT INTO items VALUES (2363, 3, 90.75, 'item2363');
+INSERT INTO items VALUES (2364, 4, 91.00, 'item2364');
+INSERT INTO items VALUES (2365, 5, 91.25, 'item2365');
+INSERT INTO items VALUES (2366, 6, 91.50, 'item2366');
+INSERT INTO items VALUES (2367, 7, 91.75, 'item2367');
+INSERT INTO items VALUES (2368, 8, 92.00, 'item2368');
+INSERT INTO items VALUES (2369, 9, 92.25, 'item2369');
+INSERT INTO items VALUES (2370, 10, 92.50, 'item2370');
+INSERT INTO items VALUES (2371, 11, 92.75, 'item2371');
+INSERT INTO items VALUES (2372, 12, 93.00, 'item2372');
+INSERT INTO items VALUES (2373, 13, 93.25, 'item2373');
+INSERT INTO items VALUES (2374, 14, 93.50, 'item2374');
+INSERT INTO items VALUES (2375, 15, 93.75, 'item2375');
+INSERT INTO items VALUES (2376, 16, 94.00, 'item2376');
+INSERT INTO items VALUES (2377, 17, 94.25, 'item2377');
+INSERT INTO items VALUES (2378, 18, 94.50, 'item2378');
+INSERT INTO items VALUES (2379, 19, 94.75, 'item2379');
+INSERT INTO items VALUES (2380, 20, 95.00, 'item2380');
+INSERT INTO items VALUES (2381, 21, 95.25, 'item2381');
+INSERT INTO items VALUES (2382, 22, 95.50, 'item2382');
+INSERT INTO items VALUES (2383, 23, 95.75, 'item2383');
+INSERT INTO items VALUES (2384, 24, 96.00, 'item2384');
+INSERT INTO items VALUES (2385, 25, 96.25, 'item2385');
+INSERT INTO items VALUES (2386, 26, 96.50, 'item2386');
+INSERT INTO items VALUES (2387, 27, 96.75, 'item2387');
+INSERT INTO items VALUES (2388, 28, 97.00, 'item2388');
+INSERT INTO items VALUES (2389, 29, 97.25, 'item2389');
+INSERT INTO items VALUES (2390, 30, 97.50, 'item2390');
+INSERT INTO items VALUES (2391, 31, 97.75, 'item2391');
+INSERT INTO items VALUES (2392, 32, 98.00, 'item2392');
+INSERT INTO items VALUES (2393, 33, 98.25, 'item2393');
+INSERT INTO items VALUES (2394, 34, 98.50, 'item2394');
+INSERT INTO items VALUES (2395, 35, 98.75, 'item2395');
+INSERT INTO items VALUES (2396, 36, 99.00, 'item2396');
+INSERT INTO items VALUES (2397, 37, 99.25, 'item2397');
+INSERT INTO items VALUES (2398, 38, 99.50, 'item2398');
+INSERT INTO items VALUES (2399, 39, 99.75, 'item2399');
+INSERT INTO items VALUES (2400, 0, 0.00, 'item2400');
+INSERT INTO items VALUES (2401, 1, 0.25, 'item2401');
+INSERT INTO items VALUES (2402, 2, 0.50, 'item2402');
+INSERT INTO items VALUES (2403, 3, 0.75, 'item2403');
+INSERT INTO items VALUES (2404, 4, 1.00, 'item2404');
+INSERT INTO items VALUES (2405, 5, 1.25, 'item2405');
+INSERT INTO items VALUES (2406, 6, 1.50, 'item2406');
+INSERT INTO items VALUES (2407, 7, 1.75, 'item2407');
+INSERT INTO items VALUES (2408, 8, 2.00, 'item2408');
+INSERT INTO items VALUES (2409, 9, 2.25, 'item2409');
+INSERT INTO items VALUES (2410, 10, 2.50, 'item2410');
+INSERT INTO items VALUES (2411, 11, 2.75, 'item2411');
+INSERT INTO items VALUES (2412, 12, 3.00, 'item2412');
+INSERT INTO items VALUES (2413, 13, 3.25, 'item2413');
+INSERT INTO items VALUES (2414, 14, 3.50, 'item2414');
+INSERT INTO items VALUES (2415, 15, 3.75, 'item2415');
+INSERT INTO items VALUES (2416, 16, 4.00, 'item2416');
+INSERT INTO items VALUES (2417, 17, 4.25, 'item2417');
+INSERT INTO items VALUES (2418, 18, 4.50, 'item2418');
+INSERT INTO items VALUES (2419, 19, 4.75, 'item2419');
+INSERT INTO items VALUES (2420, 20, 5.00, 'item2420');
+INSERT INTO items VALUES (2421, 21, 5.25, 'item2421');
+INSERT INTO items VALUES (2422, 22, 5.50, 'item2422');
+INSERT INTO items VALUES (2423, 23, 5.75, 'item2423');
+INSERT INTO items VALUES (2424, 24, 6.00, 'item2424');
+INSERT INTO items VALUES (2425, 25, 6.25, 'item2425');
+INSERT INTO items VALUES (2426, 26, 6.50, 'item2426');
+INSERT INTO items VALUES (2427, 27, 6.75, 'item2427');
+INSERT INTO items VALUES (2428, 28, 7.00, 'item2428');
+INSERT INTO items VALUES (2429, 29, 7.25, 'item2429');
+INSERT INTO items VALUES (2430, 30, 7.50, 'item2430');
+INSERT INTO items VALUES (2431, 31, 7.75, 'item2431');
+INSERT INTO items VALUES (2432, 32, 8.00, 'item2432');
+INSERT INTO items VALUES (2433, 33, 8.25, 'item2433');
+INSERT INTO items VALUES (2434, 34, 8.50, 'item2434');
+INSERT INTO items VALUES (2435, 35, 8.75, 'item2435');
+INSERT INTO items VALUES (2436, 36, 9.00, 'item2436');
+INSERT INTO items VALUES (2437, 37, 9.25, 'item2437');
+INSERT INTO items VALUES (2438, 38, 9.50, 'item2438');
+INSERT INTO items VALUES (2439, 39, 9.75, 'item2439');
+INSERT INTO items VALUES (2440, 0, 10.00, 'item2440');
+INSERT INTO items VALUES (2441, 1, 10.25, 'item2441');
+INSERT INTO items VALUES (2442, 2, 10.50, 'item2442');
+INSERT INTO items VALUES (2443, 3, 10.75, 'item2443');
+INSERT INTO items VALUES (2444, 4, 11.00, 'item2444');
+INSERT INTO items VALUES (2445, 5, 11.25, 'item2445');
+INSERT INTO items VALUES (2446, 6, 11.50, 'item2446');
+INSERT INTO items VALUES (2447, 7, 11.75, 'item2447');
+INSERT INTO items VALUES (2448, 8, 12.00, 'item2448');
+INSERT INTO items VALUES (2449, 9, 12.25, 'item2449');
+INSERT INTO items VALUES (2450, 10, 12.50, 'item2450');
+INSERT INTO items VALUES (2451, 11, 12.75, 'item2451');
+INSERT INTO items VALUES (2452, 12, 13.00, 'item2452');
+INSERT INTO items VALUES (2453, 13, 13.25, 'item2453');
+INSERT INTO items VALUES (2454, 14, 13.50, 'item2454');
+INSERT INTO items VALUES (2455, 15, 13.75, 'item2455');
+INSERT INTO items VALUES (2456, 16, 14.00, 'item2456');
+INSERT INTO items VALUES (2457, 17, 14.25, 'item2457');
+INSERT INTO items VALUES (2458, 18, 14.50, 'item2458');
+INSERT INTO items VALUES (2459, 19, 14.75, 'item2459');
+INSERT INTO items VALUES (2460, 20, 15.00, 'item2460');
+INSERT INTO items VALUES (2461, 21, 15.25, 'item2461');
+INSERT INTO items VALUES (2462, 22, 15.50, 'item2462');
+INSERT INTO items VALUES (2463, 23, 15.75, 'item2463');
+INSERT INTO items VALUES (2464, 24, 16.00, 'item2464');
+INSERT INTO items VALUES (2465, 25, 16.25, 'item2465');
+INSERT INTO items VALUES (2466, 26, 16.50, 'item2466');
+INSERT INTO items VALUES (2467, 27, 16.75, 'item2467');
+INSERT INTO items VALUES (2468, 28, 17.00, 'item2468');
+INSERT INTO items VALUES (2469, 29, 17.25, 'item2469');
+INSERT INTO items VALUES (2470, 30, 17.50, 'item2470');
+INSERT INTO items VALUES (2471, 31, 17.75, 'item2471');
+INSERT INTO items VALUES (2472, 32, 18.00, 'item2472');
+INSERT INTO items VALUES (2473, 33, 18.25, 'item2473');
+INSERT INTO items VALUES (2474, 34, 18.50, 'item2474');
+INSERT INTO items VALUES (2475, 35, 18.75, 'item2475');
+INSERT INTO items VALUES (2476, 36, 19.00, 'item2476');
+INSERT INTO items VALUES (2477, 37, 19.25, 'item2477');
+INSERT INTO items VALUES (2478, 38, 19.50, 'item2478');
+INSERT INTO items VALUES (2479, 39, 19.75, 'item2479');
+INSERT INTO items VALUES (2480, 0, 20.00, 'item2480');
+INSERT INTO items VALUES (2481, 1, 20.25, 'item2481');
+INSERT INTO items VALUES (2482, 2, 20.50, 'item2482');
+INSERT INTO items VALUES (2483, 3, 20.75, 'item2483');
+INSERT INTO items VALUES (2484, 4, 21.00, 'item2484');
+INSERT INTO items VALUES (2485, 5, 21.25, 'item2485');
+INSERT INTO items VALUES (2486, 6, 21.50, 'item2486');
+INSERT INTO items VALUES (2487, 7, 21.75, 'item2487');
+INSERT INTO items VALUES (2488, 8, 22.00, 'item2488');
+INSERT INTO items VALUES (2489, 9, 22.25, 'item2489');
+INSERT INTO items VALUES (2490, 10, 22.50, 'item2490');
+INSERT INTO items VALUES (2491, 11, 22.75, 'item2491');
+INSERT INTO items VALUES (2492, 12, 23.00, 'item2492');
+INSERT INTO items VALUES (2493, 13, 23.25, 'item2493');
+INSERT INTO items VALUES (2494, 14, 23.50, 'item2494');
+INSERT INTO items VALUES (2495, 15, 23.75, 'item2495');
+INSERT INTO items VALUES (2496, 16, 24.00, 'item2496');
+INSERT INTO items VALUES (2497, 17, 24.25, 'item2497');
+INSERT INTO items VALUES (2498, 18, 24.50, 'item2498');
+INSERT INTO items VALUES (2499, 19, 24.75, 'item2499');
+INSERT INTO items VALUES (2500, 20, 25.00, 'item2500');
+INSERT INTO items VALUES (2501, 21, 25.25, 'item2501');
+INSERT INTO items VALUES (2502, 22, 25.50, 'item2502');
+INSERT INTO items VALUES (2503, 23, 25.75, 'item2503');
+INSERT INTO items VALUES (2504, 24, 26.00, 'item2504');
+INSERT INTO items VALUES (2505, 25, 26.25, 'item2505');
+INSERT INTO items VALUES (2506, 26, 26.50, 'item2506');
+INSERT INTO items VALUES (2507, 27, 26.75, 'item2507');
+INSERT INTO items VALUES (2508, 28, 27.00, 'item2508');
+INSERT INTO items VALUES (2509, 29, 27.25, 'item2509');
+INSERT INTO items VALUES (2510, 30, 27.50, 'item2510');
+INSERT INTO items VALUES (2511, 31, 27.75, 'item2511');
+INSERT INTO items VALUES (2512, 32, 28.00, 'item2512');
+INSERT INTO items VALUES (2513, 33, 28.25, 'item2513');
+INSERT INTO items VALUES (2514, 34, 28.50, 'item2514');
+INSERT INTO items VALUES (2515, 35, 28.75, 'item2515');
+INSERT INTO items VALUES (2516, 36, 29.00, 'item2516');
+INSERT INTO items VALUES (2517, 37, 29.25, 'item2517');
+INSERT INTO items VALUES (2518, 38, 29.50, 'item2518');
+INSERT INTO items VALUES (2519, 39, 29.75, 'item2519');
+INSERT INTO items VALUES (2520, 0, 30.00, 'item2520');
+INSERT INTO items VALUES (2521, 1, 30.25, 'item2521');
+INSERT INTO items VALUES (2522, 2, 30.50, 'item2522');
+INSERT INTO items VALUES (2523, 3, 30.75, 'item2523');
+INSERT INTO items VALUES (2524, 4, 31.00, 'item2524');
+INSERT INTO items VALUES (2525, 5, 31.25, 'item2525');
+INSERT INTO items VALUES (2526, 6, 31.50, 'item2526');
+INSERT INTO items VALUES (2527, 7, 31.75, 'item2527');
+INSERT INTO items VALUES (2528, 8, 32.00, 'item2528');
+INSERT INTO items VALUES (2529, 9, 32.25, 'item2529');
+INSERT INTO items VALUES (2530, 10, 32.50, 'item2530');
+INSERT INTO items VALUES (2531, 11, 32.75, 'item2531');
+INSERT INTO items VALUES (2532, 12, 33.00, 'item2532');
+INSERT INTO items VALUES (2533, 13, 33.25, 'item2533');
+INSERT INTO items VALUES (2534, 14, 33.50, 'item2534');
+INSERT INTO items VALUES (2535, 15, 33.75, 'item2535');
+INSERT INTO items VALUES (2536, 16, 34.00, 'item2536');
+INSERT INTO items VALUES (2537, 17, 34.25, 'item2537');
+INSERT INTO items VALUES (2538, 18, 34.50, 'item2538');
+INSERT INTO items VALUES (2539, 19, 34.75, 'item2539');
+INSERT INTO items VALUES (2540, 20, 35.00, 'item2540');
+INSERT INTO items VALUES (2541, 21, 35.25, 'item2541');
+INSERT INTO items VALUES (2542, 22, 35.50, 'item2542');
+INSERT INTO items VALUES (2543, 23, 35.75, 'item2543');
+INSERT INTO items VALUES (2544, 24, 36.00, 'item2544');
+INSERT INTO items VALUES (2545, 25, 36.25, 'item2545');
+INSERT INTO items VALUES (2546, 26, 36.50, 'item2546');
+INSERT INTO items VALUES (2547, 27, 36.75, 'item2547');
+INSERT INTO items VALUES (2548, 28, 37.00, 'item2548');
+INSERT INTO items VALUES (2549, 29, 37.25, 'item2549');
+INSERT INTO items VALUES (2550, 30, 37.50, 'item2550');
+INSERT INTO items VALUES (2551, 31, 37.75, 'item2551');
+INSERT INTO items VALUES (2552, 32, 38.00, 'item2552');
+INSERT INTO items VALUES (2553, 33, 38.25, 'item2553');
+INSERT INTO items VALUES (2554, 34, 38.50, 'item2554');
+INSERT INTO items VALUES (2555, 35, 38.75, 'item2555');
+INSERT INTO items VALUES (2556, 36, 39.00, 'item2556');
+INSERT INTO items VALUES (2557, 37, 39.25, 'item2557');
+INSERT INTO items VALUES (2558, 38, 39.50, 'item2558');
+INSERT INTO items VALUES (2559, 39, 39.75, 'item2559');
+INSERT INTO items VALUES (2560, 0, 40.00, 'item2560');
+INSERT INTO items VALUES (2561, 1, 40.25, 'item2561');
+INSERT INTO items VALUES (2562, 2, 40.50, 'item2562');
+INSERT INTO items VALUES (2563, 3, 40.75, 'item2563');
+INSERT INTO items VALUES (2564, 4, 41.00, 'item2564');
+INSERT INTO items VALUES (2565, 5, 41.25, 'item2565');
+INSERT INTO items VALUES (2566, 6, 41.50, 'item2566');
+INSERT INTO items VALUES (2567, 7, 41.75, 'item2567');
+INSERT INTO items VALUES (2568, 8, 42.00, 'item2568');
+INSERT INTO items VALUES (2569, 9, 42.25, 'item2569');
+INSERT INTO items VALUES (2570, 10, 42.50, 'item2570');
+INSERT INTO items VALUES (2571, 11, 42.75, 'item2571');
+INSERT INTO items VALUES (2572, 12, 43.00, 'item2572');
+INSERT INTO items VALUES (2573, 13, 43.25, 'item2573');
+INSERT INTO items VALUES (2574, 14, 43.50, 'item2574');
+INSERT INTO items VALUES (2575, 15, 43.75, 'item2575');
+INSERT INTO items VALUES (2576, 16, 44.00, 'item2576');
+INSERT INTO items VALUES (2577, 17, 44.25, 'item2577');
+INSERT INTO items VALUES (2578, 18, 44.50, 'item2578');
+INSERT INTO items VALUES (2579, 19, 44.75, 'item2579');
+INSERT INTO items VALUES (2580, 20, 45.00, 'item2580');
+INSERT INTO items VALUES (2581, 21, 45.25, 'item2581');
+INSERT INTO items VALUES (2582, 22, 45.50, 'item2582');
+INSERT INTO items VALUES (2583, 23, 45.75, 'item2583');
+INSERT INTO items VALUES (2584, 24, 46.00, 'item2584');
+INSERT INTO items VALUES (2585, 25, 46.25, 'item2585');
+INSERT INTO items VALUES (2586, 26, 46.50, 'item2586');
+INSERT INTO items VALUES (2587, 27, 46.75, 'item2587');
+INSERT INTO items VALUES (2588, 28, 47.00, 'item2588');
+INSERT INTO items VALUES (2589, 29, 47.25, 'item2589');
+INSERT INTO items VALUES (2590, 30, 47.50, 'item2590');
+INSERT INTO items VALUES (2591, 31, 47.75, 'item2591');
+INSERT INTO items VALUES (2592, 32, 48.00, 'item2592');
+INSERT INTO items VALUES (2593, 33, 48.25, 'item2593');
+INSERT INTO items VALUES (2594, 34, 48.50, 'item2594');
+INSERT INTO items VALUES (2595, 35, 48.75, 'item2595');
+INSERT INTO items VALUES (2596, 36, 49.00, 'item2596');
+INSERT INTO items VALUES (2597, 37, 49.25, 'item2597');
+INSERT INTO items VALUES (2598, 38, 49.50, 'item2598');
+INSERT INTO items VALUES (2599, 39, 49.75, 'item2599');
+INSERT INTO items VALUES (2600, 0, 50.00, 'item2600');
+INSERT INTO items VALUES (2601, 1, 50.25, 'item2601');
+INSERT INTO items VALUES (2602, 2, 50.50, 'item2602');
+INSERT INTO items VALUES (2603, 3, 50.75, 'item2603');
+INSERT INTO items VALUES (2604, 4, 51.00, 'item2604');
+INSERT INTO items VALUES (2605, 5, 51.25, 'item2605');
+INSERT INTO items VALUES (2606, 6, 51.50, 'item2606');
+INSERT INTO items VALUES (2607, 7, 51.75, 'item2607');
+INSERT INTO items VALUES (2608, 8, 52.00, 'item2608');
+INSERT INTO items VALUES (2609, 9, 52.25, 'item2609');
+INSERT INTO items VALUES (2610, 10, 52.50, 'item2610');
+INSERT INTO items VALUES (2611, 11, 52.75, 'item2611');
+INSERT INTO items VALUES (2612, 12, 53.00, 'item2612');
+INSERT INTO items VALUES (2613, 13, 53.25, 'item2613');
+INSERT INTO items VALUES (2614, 14, 53.50, 'item2614');
+INSERT INTO items VALUES (2615, 15, 53.75, 'item2615');
+INSERT INTO items VALUES (2616, 16, 54.00, 'item2616');
+INSERT INTO items VALUES (2617, 17, 54.25, 'item2617');
+INSERT INTO items VALUES (2618, 18, 54.50, 'item2618');
+INSERT INTO items VALUES (2619, 19, 54.75, 'item2619');
+INSERT INTO items VALUES (2620, 20, 55.00, 'item2620');
+INSERT INTO items VALUES (2621, 21, 55.25, 'item2621');
+INSERT INTO items VALUES (2622, 22, 55.50, 'item2622');
+INSERT INTO items VALUES (2623, 23, 55.75, 'item2623');
+INSERT INTO items VALUES (2624, 24, 56.00, 'item2624');
+INSERT INTO items VALUES (2625, 25, 56.25, 'item2625');
+INSERT INTO items VALUES (2626, 26, 56.50, 'item2626');
+INSERT INTO items VALUES (2627, 27, 56.75, 'item2627');
+INSERT INTO items VALUES (2628, 28, 57.00, 'item2628');
+INSERT INTO items VALUES (2629, 29, 57.25, 'item2629');
+INSERT INTO items VALUES (2630, 30, 57.50, 'item2630');
+INSERT INTO items VALUES (2631, 31, 57.75, 'item2631');
+INSERT INTO items VALUES (2632, 32, 58.00, 'item2632');
+INSERT INTO items VALUES (2633, 33, 58.25, 'item2633');
+INSERT INTO items VALUES (2634, 34, 58.50, 'item2634');
+INSERT INTO items VALUES (2635, 35, 58.75, 'item2635');
+INSERT INTO items VALUES (2636, 36, 59.00, 'item2636');
+INSERT INTO items VALUES (2637, 37, 59.25, 'item2637');
+INSERT INTO items VALUES (2638, 38, 59.50, 'item2638');
+INSERT INTO items VALUES (2639, 39, 59.75, 'item2639');
+INSERT INTO items VALUES (2640, 0, 60.00, 'item2640');
+INSERT INTO items VALUES (2641, 1, 60.25, 'item2641');
+INSERT INTO items VALUES (2642, 2, 60.50, 'item2642');
+INSERT INTO items VALUES (2643, 3, 60.75, 'item2643');
+INSERT INTO items VALUES (2644, 4, 61.00, 'item2644');
+INSERT INTO items VALUES (2645, 5, 61.25, 'item2645');
+INSERT INTO items VALUES (2646, 6, 61.50, 'item2646');
+INSERT INTO items VALUES (2647, 7, 61.75, 'item2647');
+INSERT INTO items VALUES (2648, 8, 62.00, 'item2648');
+INSERT INTO items VALUES (2649, 9, 62.25, 'item2649');
+INSERT INTO items VALUES (2650, 10, 62.50, 'item2650');
+INSERT INTO items VALUES (2651, 11, 62.75, 'item2651');
+INSERT INTO items VALUES (2652, 12, 63.00, 'item2652');
+INSERT INTO items VALUES (2653, 13, 63.25, 'item2653');
+INSERT INTO items VALUES (2654, 14, 63.50, 'item2654');
+INSERT INTO items VALUES (2655, 15, 63.75, 'item2655');
+INSERT INTO items VALUES (2656, 16, 64.00, 'item2656');
+INSERT INTO items VALUES (2657, 17, 64.25, 'item2657');
+INSERT INTO items VALUES (2658, 18, 64.50, 'item2658');
+INSERT INTO items VALUES (2659, 19, 64.75, 'item2659');
+INSERT INTO items VALUES (2660, 20, 65.00, 'item2660');
+INSERT INTO items VALUES (2661, 21, 65.25, 'item2661');
+INSERT INTO items VALUES (2662, 22, 65.50, 'item2662');
+INSERT INTO items VALUES (2663, 23, 65.75, 'item2663');
+INSERT INTO items VALUES (2664, 24, 66.00, 'item2664');
+INSERT INTO items VALUES (2665, 25, 66.25, 'item2665');
+INSERT INTO items VALUES (2666, 26, 66.50, 'item2666');
+INSERT INTO items VALUES (2667, 27, 66.75, 'item2667');
+INSERT INTO items VALUES (2668, 28, 67.00, 'item2668');
+INSERT INTO items VALUES (2669, 29, 67.25, 'item2669');
+INSERT INTO items VALUES (2670, 30, 67.50, 'item2670');
+INSERT INTO items VALUES (2671, 31, 67.75, 'item2671');
+INSERT INTO items VALUES (2672, 32, 68.00, 'item2672');
+INSERT INTO items VALUES (2673, 33, 68.25, 'item2673');
+INSERT INTO items VALUES (2674, 34, 68.50, 'item2674');
+INSERT INTO items VALUES (2675, 35, 68.75, 'item2675');
+INSERT INTO items VALUES (2676, 36, 69.00, 'item2676');
+INSERT INTO items VALUES (2677, 37, 69.25, 'item2677');
+INSERT INTO items VALUES (2678, 38, 69.50, 'item2678');
+INSERT INTO items VALUES (2679, 39, 69.75, 'item2679');
+INSERT INTO items VALUES (2680, 0, 70.00, 'item2680');
+INSERT INTO items VALUES (2681, 1, 70.25, 'item2681');
+INSERT INTO items VALUES (2682, 2, 70.50, 'item2682');
+INSERT INTO items VALUES (2683, 3, 70.75, 'item2683');
+INSERT INTO items VALUES (2684, 4, 71.00, 'item2684');
+INSERT INTO items VALUES (2685, 5, 71.25, 'item2685');
+INSERT INTO items VALUES (2686, 6, 71.50, 'item2686');
+INSERT INTO items VALUES (2687, 7, 71.75, 'item2687');
+INSERT INTO items VALUES (2688, 8, 72.00, 'item2688');
+INSERT INTO items VALUES (2689, 9, 72.25, 'item2689');
+INSERT INTO items VALUES (2690, 10, 72.50, 'item2690');
+INSERT INTO items VALUES (2691, 11, 72.75, 'item2691');
+INSERT INTO items VALUES (2692, 12, 73.00, 'item2692');
+INSERT INTO items VALUES (2693, 13, 73.25, 'item2693');
+INSERT INTO items VALUES (2694, 14, 73.50, 'item2694');
+INSERT INTO items VALUES (2695, 15, 73.75, 'item2695');
+INSERT INTO items VALUES (2696, 16, 74.00, 'item2696');
+INSERT INTO items VALUES (2697, 17, 74.25, 'item2697');
+INSERT INTO items VALUES (2698, 18, 74.50, 'item2698');
+INSERT INTO items VALUES (2699, 19, 74.75, 'item2699');
+INSERT INTO items VALUES (2700, 20, 75.00, 'item2700');
+INSERT INTO items VALUES (2701, 21, 75.25, 'item2701');
+INSERT INTO items VALUES (2702, 22, 75.50, 'item2702');
+INSERT INTO items VALUES (2703, 23, 75.75, 'item2703');
+INSERT INTO items VALUES (2704, 24, 76.00, 'item2704');
+INSERT INTO items VALUES (2705, 25, 76.25, 'item2705');
+INSERT INTO items VALUES (2706, 26, 76.50, 'item2706');
+INSERT INTO items VALUES (2707, 27, 76.75, 'item2707');
+INSERT INTO items VALUES (2708, 28, 77.00, 'item2708');
+INSERT INTO items VALUES (2709, 29, 77.25, 'item2709');
+INSERT INTO items VALUES (2710, 30, 77.50, 'item2710');
+INSERT INTO items VALUES (2711, 31, 77.75, 'item2711');
+INSERT INTO items VALUES (2712, 32, 78.00, 'item2712');
+INSERT INTO items VALUES (2713, 33, 78.25, 'item2713');
+INSERT INTO items VALUES (2714, 34, 78.50, 'item2714');
+INSERT INTO items VALUES (2715, 35, 78.75, 'item2715');
+INSERT INTO items VALUES (2716, 36, 79.00, 'item2716');
+INSERT INTO items VALUES (2717, 37, 79.25, 'item2717');
+INSERT INTO items VALUES (2718, 38, 79.50, 'item2718');
+INSERT INTO items VALUES (2719, 39, 79.75, 'item2719');
+INSERT INTO items VALUES (2720, 0, 80.00, 'item2720');
+INSERT INTO items VALUES (2721, 1, 80.25, 'item2721');
+INSERT INTO items VALUES (2722, 2, 80.50, 'item2722');
+INSERT INTO items VALUES (2723, 3, 80.75, 'item2723');
+INSERT INTO items VALUES (2724, 4, 81.00, 'item2724');
+INSERT INTO items VALUES (2725, 5, 81.25, 'item2725');
+INSERT INTO items VALUES (2726, 6, 81.50, 'item2726');
+INSERT INTO items VALUES (2727, 7, 81.75, 'item2727');
+INSERT INTO items VALUES (2728, 8, 82.00, 'item2728');
+INSERT INTO items VALUES (2729, 9, 82.25, 'item2729');
+INSERT INTO items VALUES (2730, 10, 82.50, 'item2730');
+INSERT INTO items VALUES (2731, 11, 82.75, 'item2731');
+INSERT INTO items VALUES (2732, 12, 83.00, 'item2732');
+INSERT INTO items VALUES (2733, 13, 83.25, 'item2733');
+INSERT INTO items VALUES (2734, 14, 83.50, 'item2734');
+INSERT INTO items VALUES (2735, 15, 83.75, 'item2735');
+INSERT INTO items VALUES (2736, 16, 84.00, 'item2736');
+INSERT INTO items VALUES (2737, 17, 84.25, 'item2737');
+INSERT INTO items VALUES (2738, 18, 84.50, 'item2738');
+INSERT INTO items VALUES (2739, 19, 84.75, 'item2739');
+INSERT INTO items VALUES (2740, 20, 85.00, 'item2740');
+INSERT INTO items VALUES (2741, 21, 85.25, 'item2741');
+INSERT INTO items VALUES (2742, 22, 85.50, 'item2742');
+INSERT INTO items VALUES (2743, 23, 85.75, 'item2743');
+INSERT INTO items VALUES (2744, 24, 86.00, 'item2744');
+INSERT INTO items VALUES (2745, 25, 86.25, 'item2745');
+INSERT INTO items VALUES (2746, 26, 86.50, 'item2746');
+INSERT INTO items VALUES (2747, 27, 86.75, 'item2747');
+INSERT INTO items VALUES (2748, 28, 87.00, 'item2748');
+INSERT INTO items VALUES (2749, 29, 87.25, 'item2749');
+INSERT INTO items VALUES (2750, 30, 87.50, 'item2750');
+INSERT INTO items VALUES (2751, 31, 87.75, 'item2751');
+INSERT INTO items VALUES (2752, 32, 88.00, 'item2752');
+INSERT INTO items VALUES (2753, 33, 88.25, 'item2753');
+INSERT INTO items VALUES (2754, 34, 88.50, 'item2754');
+INSERT INTO items VALUES (2755, 35, 88.75, 'item2755');
+INSERT INTO items VALUES (2756, 36, 89.00, 'item2756');
+INSERT INTO items VALUES (2757, 37, 89.25, 'item2757');
+INSERT INTO items VALUES (2758, 38, 89.50, 'item2758');
+INSERT INTO items VALUES (2759, 39, 89.75, 'item2759');
+INSERT INTO items VALUES (2760, 0, 90.00, 'item2760');
+INSERT INTO items VALUES (2761, 1, 90.25, 'item2761');
+INSERT INTO items VALUES (2762, 2, 90.50, 'item2762');
+INSERT INTO items VALUES (2763, 3, 90.75, 'item2763');
+INSERT INTO items VALUES (2764, 4, 91.00, 'item2764');
+INSERT INTO items VALUES (2765, 5, 91.25, 'item2765');
+INSERT INTO items VALUES (2766, 6, 91.50, 'item2766');
+INSERT INTO items VALUES (2767, 7, 91.75, 'item2767');
+INSERT INTO items VALUES (2768, 8, 92.00, 'item2768');
+INSERT INTO items VALUES (2769, 9, 92.25, 'item2769');
+INSERT INTO items VALUES (2770, 10, 92.50, 'item2770');
+INSERT INTO items VALUES (2771, 11, 92.75, 'item2771');
+INSERT INTO items VALUES (2772, 12, 93.00, 'item2772');
+INSERT INTO items VALUES (2773, 13, 93.25, 'item2773');
+INSERT INTO items VALUES (2774, 14, 93.50, 'item2774');
+INSERT INTO items VALUES (2775, 15, 93.75, 'item2775');
+INSERT INTO items VALUES (2776, 16, 94.00, 'item2776');
+INSERT INTO items VALUES (2777, 17, 94.25, 'item2777');
+INSERT INTO items VALUES (2778, 18, 94.50, 'item2778');
+INSERT INTO items VALUES (2779, 19, 94.75, 'item2779');
+INSERT INTO items VALUES (2780, 20, 95.00, 'item2780');
+INSERT INTO items VALUES (2781, 21, 95.25, 'item2781');
+INSERT INTO items VALUES (2782, 22, 95.50, 'item2782');
+INSERT INTO items VALUES (2783, 23, 95.75, 'item2783');
+INSERT INTO items VALUES (2784, 24, 96.00, 'item2784');
+INSERT INTO items VALUES (2785, 25, 96.25, 'item2785');
+INSERT INTO items VALUES (2786, 26, 96.50, 'item2786');
+INSERT INTO items VALUES (2787, 27, 96.75, 'item2787');
+INSERT INTO items VALUES (2788, 28, 97.00, 'item2788');
+INSERT INTO items VALUES (2789, 29, 97.25, 'item2789');
+INSERT INTO items VALUES (2790, 30, 97.50, 'item2790');
+INSERT INTO items VALUES (2791, 31, 97.75, 'item2791');
+INSERT INTO items VALUES (2792, 32, 98.00, 'item2792');
+INSERT INTO items VALUES (2793, 33, 98.25, 'item2793');
+INSERT INTO items VALUES (2794, 34, 98.50, 'item2794');
+INSERT INTO items VALUES (2795, 35, 98.75, 'item2795');
+INSERT INTO items VALUES (2796, 36, 99.00, 'item2796');
+INSERT INTO items VALUES (2797, 37, 99.25, 'item2797');
+INSERT INTO items VALUES (2798, 38, 99.50, 'item2798');
+INSERT INTO items VALUES (2799, 39, 99.75, 'item2799');
+INSERT INTO items VALUES (2800, 0, 0.00, 'item2800');
+INSERT INTO items VALUES (2801, 1, 0.25, 'item2801');
+INSERT INTO items VALUES (2802, 2, 0.50, 'item2802');
+INSERT INTO items VALUES (2803, 3, 0.75, 'item2803');
+INSERT INTO items VALUES (2804, 4, 1.00, 'item2804');
+INSERT INTO items VALUES (2805, 5, 1.25, 'item2805');
+INSERT INTO items VALUES (2806, 6, 1.50, 'item2806');
+INSERT INTO items VALUES (2807, 7, 1.75, 'item2807');
+INSERT INTO items VALUES (2808, 8, 2.00, 'item2808');
+INSERT INTO items VALUES (2809, 9, 2.25, 'item2809');
+INSERT INTO items VALUES (2810, 10, 2.50, 'item2810');
+INSERT INTO items VALUES (2811, 11, 2.75, 'item2811');
+INSERT INTO items VALUES (2812, 12, 3.00, 'item2812');
+INSERT INTO items VALUES (2813, 13, 3.25, 'item2813');
+INSERT INTO items VALUES (2814, 14, 3.50, 'item2814');
+INSERT INTO items VALUES (2815, 15, 3.75, 'item2815');
+INSERT INTO items VALUES (2816, 16, 4.00, 'item2816');
+INSERT INTO items VALUES (2817, 17, 4.25, 'item2817');
+INSERT INTO items VALUES (2818, 18, 4.50, 'item2818');
+INSERT INTO items VALUES (2819, 19, 4.75, 'item2819');
+INSERT INTO items VALUES (2820, 20, 5.00, 'item2820');
+INSERT INTO items VALUES (2821, 21, 5.25, 'item2821');
+INSERT INTO items VALUES (2822, 22, 5.50, 'item2822');
+INSERT INTO items VALUES (2823, 23, 5.75, 'item2823');
+INSERT INTO items VALUES (2824, 24, 6.00, 'item2824');
+INSERT INTO items VALUES (2825, 25, 6.25, 'item2825');
+INSERT INTO items VALUES (2826, 26, 6.50, 'item2826');
+INSERT INTO items VALUES (2827, 27, 6.75, 'item2827');
+INSERT INTO items VALUES (2828, 28, 7.00, 'item2828');
+INSERT INTO items VALUES (2829, 29, 7.25, 'item2829');
+INSERT INTO items VALUES (2830, 30, 7.50, 'item2830');
+INSERT INTO items VALUES (2831, 31, 7.75, 'item2831');
+INSERT INTO items VALUES (2832, 32, 8.00, 'item2832');
+INSERT INTO items VALUES (2833, 33, 8.25, 'item2833');
+INSERT INTO items VALUES (2834, 34, 8.50, 'item2834');
+INSERT INTO items VALUES (2835, 35, 8.75, 'item2835');
+INSERT INTO items VALUES (2836, 36, 9.00, 'item2836');
+INSERT INTO items VALUES (2837, 37, 9.25, 'item2837');
+INSERT INTO items VALUES (2838, 38, 9.50, 'item2838');
+INSERT INTO items VALUES (2839, 39, 9.75, 'item2839');
+INSERT INTO items VALUES (2840, 0, 10.00, 'item2840');
+INSERT INTO items VALUES (2841, 1, 10.25, 'item2841');
+INSERT INTO items VALUES (2842, 2, 10.50, 'item2842');
+INSERT INTO items VALUES (2843, 3, 10.75, 'item2843');
+INSERT INTO items VALUES (2844, 4, 11.00, 'item2844');
+INSERT INTO items VALUES (2845, 5, 11.25, 'item2845');
+INSERT INTO items VALUES (2846, 6, 11.50, 'item2846');
+INSERT INTO items VALUES (2847, 7, 11.75, 'item2847');
+INSERT INTO items VALUES (2848, 8, 12.00, 'item2848');
+INSERT INTO items VALUES (2849, 9, 12.25, 'item2849');
+INSERT INTO items VALUES (2850, 10, 12.50, 'item2850');
+INSERT INTO items VALUES (2851, 11, 12.75, 'item2851');
+INSERT INTO items VALUES (2852, 12, 13.00, 'item2852');
+INSERT INTO items VALUES (2853, 13, 13.25, 'item2853');
+INSERT INTO items VALUES (2854, 14, 13.50, 'item2854');
+INSERT INTO items VALUES (2855, 15, 13.75, 'item2855');
+INSERT INTO items VALUES (2856, 16, 14.00, 'item2856');
+INSERT INTO items VALUES (2857, 17, 14.25, 'item2857');
+INSERT INTO items VALUES (2858, 18, 14.50, 'item2858');
+INSERT INTO items VALUES (2859, 19, 14.75, 'item2859');
+INSERT INTO items VALUES (2860, 20, 15.00, 'item2860');
+INSERT INTO items VALUES (2861, 21, 15.25, 'item2861');
+INSERT INTO items VALUES (2862, 22, 15.50, 'item2862');
+INSERT INTO items VALUES (2863, 23, 15.75, 'item2863');
+INSERT INTO items VALUES (2864, 24, 16.00, 'item2864');
+INSERT INTO items VALUES (2865, 25, 16.25, 'item2865');
+INSERT INTO items VALUES (2866, 26, 16.50, 'item2866');
+INSERT INTO items VALUES (2867, 27, 16.75, 'item2867');
+INSERT INTO items VALUES (2868, 28, 17.00, 'item2868');
+INSERT INTO items VALUES (2869, 29, 17.25, 'item2869');
+INSERT INTO items VALUES (2870, 30, 17.50, 'item2870');
+INSERT INTO items VALUES (2871, 31, 17.75, 'item2871');
+INSERT INTO items VALUES (2872, 32, 18.00, 'item2872');
+INSERT INTO items VALUES (2873, 33, 18.25, 'item2873');
+INSERT INTO items VALUES (2874, 34, 18.50, 'item2874');
+INSERT INTO items VALUES (2875, 35, 18.75, 'item2875');
+INSERT INTO items VALUES (2876, 36, 19.00, 'item2876');
+INSERT INTO items VALUES (2877, 37, 19.25, 'item2877');
+INSERT INTO items VALUES (2878, 38, 19.50, 'item2878');
+INSERT INTO items VALUES (2879, 39, 19.75, 'item2879');
+INSERT INTO items VALUES (2880, 0, 20.00, 'item2880');
+INSERT INTO items VALUES (2881, 1, 20.25, 'item2881');
+INSERT INTO items VALUES (2882, 2, 20.50, 'item2882');
+INSERT INTO items VALUES (2883, 3, 20.75, 'item2883');
+INSERT INTO items VALUES (2884, 4, 21.00, 'item2884');
+INSERT INTO items VALUES (2885, 5, 21.25, 'item2885');
+INSERT INTO items VALUES (2886, 6, 21.50, 'item2886');
+INSERT INTO items VALUES (2887, 7, 21.75, 'item2887');
+INSERT INTO items VALUES (2888, 8, 22.00, 'item2888');
+INSERT INTO items VALUES (2889, 9, 22.25, 'item2889');
+INSERT INTO items VALUES (2890, 10, 22.50, 'item2890');
+INSERT INTO items VALUES (2891, 11, 22.75, 'item2891');
+INSERT INTO items VALUES (2892, 12, 23.00, 'item2892');
+INSERT INTO items VALUES (2893, 13, 23.25, 'item2893');
+INSERT INTO items VALUES (2894, 14, 23.50, 'item2894');
+INSERT INTO items VALUES (2895, 15, 23.75, 'item2895');
+INSERT INTO items VALUES (2896, 16, 24.00, 'item2896');
+INSERT INTO items VALUES (2897, 17, 24.25, 'item2897');
+INSERT INTO items VALUES (2898, 18, 24.50, 'item2898');
+INSERT INTO items VALUES (2899, 19, 24.75, 'item2899');
+INSERT INTO items VALUES (2900, 20, 25.00, 'item2900');
+INSERT INTO items VALUES (2901, 21, 25.25, 'item2901');
+INSERT INTO items VALUES (2902, 22, 25.50, 'item2902');
+INSERT INTO items VALUES (2903, 23, 25.75, 'item2903');
+INSERT INTO items VALUES (2904, 24, 26.00, 'item2904');
+INSERT INTO items VALUES (2905, 25, 26.25, 'item2905');
+INSERT INTO items VALUES (2906, 26, 26.50, 'item2906');
+INSERT INTO items VALUES (2907, 27, 26.75, 'item2907');
+INSERT INTO items VALUES (2908, 28, 27.00, 'item2908');
+INSERT INTO items VALUES (2909, 29, 27.25, 'item2909');
+INSERT INTO items VALUES (2910, 30, 27.50, 'item2910');
+INSERT INTO items VALUES (2911, 31, 27.75, 'item2911');
+INSERT INTO items VALUES (2912, 32, 28.00, 'item2912');
+INSERT INTO items VALUES (2913, 33, 28.25, 'item2913');
+INSERT INTO items VALUES (2914, 34, 28.50, 'item2914');
+INSERT INTO items VALUES (2915, 35, 28.75, 'item2915');
+INSERT INTO items VALUES (2916, 36, 29.00, 'item2916');
+INSERT INTO items VALUES (2917, 37, 29.25, 'item2917');
+INSERT INTO items VALUES (2918, 38, 29.50, 'item2918');
+INSERT INTO items VALUES (2919, 39, 29.75, 'item2919');
+INSERT INTO items VALUES (2920, 0, 30.00, 'item2920');
+INSERT INTO items VALUES (2921, 1, 30.25, 'item2921');
+INSERT INTO items VALUES (2922, 2, 30.50, 'item2922');
+INSERT INTO items VALUES (2923, 3, 30.75, 'item2923');
+INSERT INTO items VALUES (2924, 4, 31.00, 'item2924');
+INSERT INTO items VALUES (2925, 5, 31.25, 'item2925');
+INSERT INTO items VALUES (2926, 6, 31.50, 'item2926');
+INSERT INTO items VALUES (2927, 7, 31.75, 'item2927');
+INSERT INTO items VALUES (2928, 8, 32.00, 'item2928');
+INSERT INTO items VALUES (2929, 9, 32.25, 'item2929');
+INSERT INTO items VALUES (2930, 10, 32.50, 'item2930');
+INSERT INTO items VALUES (2931, 11, 32.75, 'item2931');
+INSERT INTO items VALUES (2932, 12, 33.00, 'item2932');
+INSERT INTO items VALUES (2933, 13, 33.25, 'item2933');
+INSERT INTO items VALUES (2934, 14, 33.50, 'item2934');
+INSERT INTO items VALUES (2935, 15, 33.75, 'item2935');
+INSERT INTO items VALUES (2936, 16, 34.00, 'item2936');
+INSERT INTO items VALUES (2937, 17, 34.25, 'item2937');
+INSERT INTO items VALUES (2938, 18, 34.50, 'item2938');
+INSERT INTO items VALUES (2939, 19, 34.75, 'item2939');
+INSERT INTO items VALUES (2940, 20, 35.00, 'item2940');
+INSERT INTO items VALUES (2941, 21, 35.25, 'item2941');
+INSERT INTO items VALUES (2942, 22, 35.50, 'item2942');
+INSERT INTO items VALUES (2943, 23, 35.75, 'item2943');
+INSERT INTO items VALUES (2944, 24, 36.00, 'item2944');
+INSERT INTO items VALUES (2945, 25, 36.25, 'item2945');
+INSERT INTO items VALUES (2946, 26, 36.50, 'item2946');
+INSERT INTO items VALUES (2947, 27, 36.75, 'item2947');
+INSERT INTO items VALUES (2948, 28, 37.00, 'item2948');
+INSERT INTO items VALUES (2949, 29, 37.25, 'item2949');
+INSERT INTO items VALUES (2950, 30, 37.50, 'item2950');
+INSERT INTO items VALUES (2951, 31, 37.75, 'item2951');
+INSERT INTO items VALUES (2952, 32, 38.00, 'item2952');
+INSERT INTO items VALUES (2953, 33, 38.25, 'item2953');
+INSERT INTO items VALUES (2954, 34, 38.50, 'item2954');
+INSERT INTO items VALUES (2955, 35, 38.75, 'item2955');
+INSERT INTO items VALUES (2956, 36, 39.00, 'item2956');
+INSERT INTO items VALUES (2957, 37, 39.25, 'item2957');
+INSERT INTO items VALUES (2958, 38, 39.50, 'item2958');
+INSERT INTO items VALUES (2959, 39, 39.75, 'item2959');
+INSERT INTO items VALUES (2960, 0, 40.00, 'item2960');
+INSERT INTO items VALUES (2961, 1, 40.25, 'item2961');
+INSERT INTO items VALUES (2962, 2, 40.50, 'item2962');
+INSERT INTO items VALUES (2963, 3, 40.75, 'item2963');
+INSERT INTO items VALUES (2964, 4, 41.00, 'item2964');
+INSERT INTO items VALUES (2965, 5, 41.25, 'item2965');
+INSERT INTO items VALUES (2966, 6, 41.50, 'item2966');
+INSERT INTO items VALUES (2967, 7, 41.75, 'item2967');
+INSERT INTO items VALUES (2968, 8, 42.00, 'item2968');
+INSERT INTO items VALUES (2969, 9, 42.25, 'item2969');
+INSERT INTO items VALUES (2970, 10, 42.50, 'item2970');
+INSERT INTO items VALUES (2971, 11, 42.75, 'item2971');
+INSERT INTO items VALUES (2972, 12, 43.00, 'item2972');
+INSERT INTO items VALUES (2973, 13, 43.25, 'item2973');
+INSERT INTO items VALUES (2974, 14, 43.50, 'item2974');
+INSERT INTO items VALUES (2975, 15, 43.75, 'item2975');
+INSERT INTO items VALUES (2976, 16, 44.00, 'item2976');
+INSERT INTO items VALUES (2977, 17, 44.25, 'item2977');
+INSERT INTO items VALUES (2978, 18, 44.50, 'item2978');
+INSERT INTO items VALUES (2979, 19, 44.75, 'item2979');
+INSERT INTO items VALUES (2980, 20, 45.00, 'item2980');
+INSERT INTO items VALUES (2981, 21, 45.25, 'item2981');
+INSERT INTO items VALUES (2982, 22, 45.50, 'item2982');
+INSERT INTO items VALUES (2983, 23, 45.75, 'item2983');
+INSERT INTO items VALUES (2984, 24, 46.00, 'item2984');
+INSERT INTO items VALUES (2985, 25, 46.25, 'item2985');
+INSERT INTO items VALUES (2986, 26, 46.50, 'item2986');
+INSERT INTO items VALUES (2987, 27, 46.75, 'item2987');
+INSERT INTO items VALUES (2988, 28, 47.00, 'item2988');
+INSERT INTO items VALUES (2989, 29, 47.25, 'item2989');
+INSERT INTO items VALUES (2990, 30, 47.50, 'item2990');
+INSERT INTO items VALUES (2991, 31, 47.75, 'item2991');
+INSERT INTO items VALUES (2992, 32, 48.00, 'item2992');
+INSERT INTO items VALUES (2993, 33, 48.25, 'item2993');
+INSERT INTO items VALUES (2994, 34, 48.50, 'item2994');
+INSERT INTO items VALUES (2995, 35, 48.75, 'item2995');
+INSERT INTO items VALUES (2996, 36, 49.00, 'item2996');
+INSERT INTO items VALUES (2997, 37, 49.25, 'item2997');
+INSERT INTO items VALUES (2998, 38, 49.50, 'item2998');
+INSERT INTO items VALUES (2999, 39, 49.75, 'item2999');
+INSERT INTO items VALUES (3000, 0, 50.00, 'item3000');
+INSERT INTO items VALUES (3001, 1, 50.25, 'item3001');
+INSERT INTO items VALUES (3002, 2, 50.50, 'item3002');
+INSERT INTO items VALUES (3003, 3, 50.75, 'item3003');
+INSERT INTO items VALUES (3004, 4, 51.00, 'item3004');
+INSERT INTO items VALUES (3005, 5, 51.25, 'item3005');
+INSERT INTO items VALUES (3006, 6, 51.50, 'item3006');
+INSERT INTO items VALUES (3007, 7, 51.75, 'item3007');
+INSERT INTO items VALUES (3008, 8, 52.00, 'item3008');
+INSERT INTO items VALUES (3009, 9, 52.25, 'item3009');
+INSERT INTO items VALUES (3010, 10, 52.50, 'item3010');
+INSERT INTO items VALUES (3011, 11, 52.75, 'item3011');
+INSERT INTO items VALUES (3012, 12, 53.00, 'item3012');
+INSERT INTO items VALUES (3013, 13, 53.25, 'item3013');
+INSERT INTO items VALUES (3014, 14, 53.50, 'item3014');
+INSERT INTO items VALUES (3015, 15, 53.75, 'item3015');
+INSERT INTO items VALUES (3016, 16, 54.00, 'item3016');
+INSERT INTO items VALUES (3017, 17, 54.25, 'item3017');
+INSERT INTO items VALUES (3018, 18, 54.50, 'item3018');
+INSERT INTO items VALUES (3019, 19, 54.75, 'item3019');
+INSERT INTO items VALUES (3020, 20, 55.00, 'item3020');
+INSERT INTO items VALUES (3021, 21, 55.25, 'item3021');
+INSERT INTO items VALUES (3022, 22, 55.50, 'item3022');
+INSERT INTO items VALUES (3023, 23, 55.75, 'item3023');
+INSERT INTO items VALUES (3024, 24, 56.00, 'item3024');
+INSERT INTO items VALUES (3025, 25, 56.25, 'item3025');
+INSERT INTO items VALUES (3026, 26, 56.50, 'item3026');
+INSERT INTO items VALUES (3027, 27, 56.75, 'item3027');
+INSERT INTO items VALUES (3028, 28, 57.00, 'item3028');
+INSERT INTO items VALUES (3029, 29, 57.25, 'item3029');
+INSERT INTO items VALUES (3030, 30, 57.50, 'item3030');
+INSERT INTO items VALUES (3031, 31, 57.75, 'item3031');
+INSERT INTO items VALUES (3032, 32, 58.00, 'item3032');
+INSERT INTO items VALUES (3033, 33, 58.25, 'item3033');
+INSERT INTO items VALUES (3034, 34, 58.50, 'item3034');
+INSERT INTO items VALUES (3035, 35, 58.75, 'item3035');
+INSERT INTO items VALUES (3036, 36, 59.00, 'item3036');
+INSERT INTO items VALUES (3037, 37, 59.25, 'item3037');
+INSERT INTO items VALUES (3038, 38, 59.50, 'item3038');
+INSERT INTO items VALUES (3039, 39, 59.75, 'item3039');
+INSERT INTO items VALUES (3040, 0, 60.00, 'item3040');
+INSERT INTO items VALUES (3041, 1, 60.25, 'item3041');
+INSERT INTO items VALUES (3042, 2, 60.50, 'item3042');
+INSERT INTO items VALUES (3043, 3, 60.75, 'item3043');
+INSERT INTO items VALUES (3044, 4, 61.00, 'item3044');
+INSERT INTO items VALUES (3045, 5, 61.25, 'item3045');
+INSERT INTO items VALUES (3046, 6, 61.50, 'item3046');
+INSERT INTO items VALUES (3047, 7, 61.75, 'item3047');
+INSERT INTO items VALUES (3048, 8, 62.00, 'item3048');
+INSERT INTO items VALUES (3049, 9, 62.25, 'item3049');
+INSERT INTO items VALUES (3050, 10, 62.50, 'item3050');
+INSERT INTO items VALUES (3051, 11, 62.75, 'item3051');
+INSERT INTO items VALUES (3052, 12, 63.00, 'item3052');
+INSERT INTO items VALUES (3053, 13, 63.25, 'item3053');
+INSERT INTO items VALUES (3054, 14, 63.50, 'item3054');
+INSERT INTO items VALUES (3055, 15, 63.75, 'item3055');
+INSERT INTO items VALUES (3056, 16, 64.00, 'item3056');
+INSERT INTO items VALUES (3057, 17, 64.25, 'item3057');
+INSERT INTO items VALUES (3058, 18, 64.50, 'item3058');
+INSERT INTO items VALUES (3059, 19, 64.75, 'item3059');
+INSERT INTO items VALUES (3060, 20, 65.00, 'item3060');
+INSERT INTO items VALUES (3061, 21, 65.25, 'item3061');
+INSERT INTO items VALUES (3062, 22, 65.50, 'item3062');
+INSERT INTO items VALUES (3063, 23, 65.75, 'item3063');
+INSERT INTO items VALUES (3064, 24, 66.00, 'item3064');
+INSERT INTO items VALUES (3065, 25, 66.25, 'item3065');
+INSERT INTO items VALUES (3066, 26, 66.50, 'item3066');
+INSERT INTO items VALUES (3067, 27, 66.75, 'item3067');
+INSERT INTO items VALUES (3068, 28, 67.00, 'item3068');
+INSERT INTO items VALUES (3069, 29, 67.25, 'item3069');
+INSERT INTO items VALUES (3070, 30, 67.50, 'item3070');
+INSERT INTO items VALUES (3071, 31, 67.75, 'item3071');
+INSERT INTO items VALUES (3072, 32, 68.00, 'item3072');
+INSERT INTO items VALUES (3073, 33, 68.25, 'item3073');
+INSERT INTO items VALUES (3074, 34, 68.50, 'item3074');
+INSERT INTO items VALUES (3075, 35, 68.75, 'item3075');
+INSERT INTO items VALUES (3076, 36, 69.00, 'item3076');
+INSERT INTO items VALUES (3077, 37, 69.25, 'item3077');
+INSERT INTO items VALUES (3078, 38, 69.50, 'item3078');
+INSERT INTO items VALUES (3079, 39, 69.75, 'item3079');
+INSERT INTO items VALUES (3080, 0, 70.00, 'item3080');
+INSERT INTO items VALUES (3081, 1, 70.25, 'item3081');
+INSERT INTO items VALUES (3082, 2, 70.50, 'item3082');
+INSERT INTO items VALUES (3083, 3, 70.75, 'item3083');
+INSERT INTO items VALUES (3084, 4, 71.00, 'item3084');
+INSERT INTO items VALUES (3085, 5, 71.25, 'item3085');
+INSERT INTO items VALUES (3086, 6, 71.50, 'item3086');
+INSERT INTO items VALUES (3087, 7, 71.75, 'item3087');
+INSERT INTO items VALUES (3088, 8, 72.00, 'item3088');
+INSERT INTO items VALUES (3089, 9, 72.25, 'item3089');
+INSERT INTO items VALUES (3090, 10, 72.50, 'item3090');
+INSERT INTO items VALUES (3091, 11, 72.75, 'item3091');
+INSERT INTO items VALUES (3092, 12, 73.00, 'item3092');
+INSERT INTO items VALUES (3093, 13, 73.25, 'item3093');
+INSERT INTO items VALUES (3094, 14, 73.50, 'item3094');
+INSERT INTO items VALUES (3095, 15, 73.75, 'item3095');
+INSERT INTO items VALUES (3096, 16, 74.00, 'item3096');
+INSERT INTO items VALUES (3097, 17, 74.25, 'item3097');
+INSERT INTO items VALUES (3098, 18, 74.50, 'item3098');
+INSERT INTO items VALUES (3099, 19, 74.75, 'item3099');
+INSERT INTO items VALUES (3100, 20, 75.00, 'item3100');
+INSERT INTO items VALUES (3101, 21, 75.25, 'item3101');
+INSERT INTO items VALUES (3102, 22, 75.50, 'item3102');
+INSERT INTO items VALUES (3103, 23, 75.75, 'item3103');
+INSERT INTO items VALUES (3104, 24, 76.00, 'item3104');
+INSERT INTO items VALUES (3105, 25, 76.25, 'item3105');
+INSERT INTO items VALUES (3106, 26, 76.50, 'item3106');
+INSERT INTO items VALUES (3107, 27, 76.75, 'item3107');
+INSERT INTO items VALUES (3108, 28, 77.00, 'item3108');
+INSERT INTO items VALUES (3109, 29, 77.25, 'item3109');
+INSERT INTO items VALUES (3110, 30, 77.50, 'item3110');
+INSERT INTO items VALUES (3111, 31, 77.75, 'item3111');
+INSERT INTO items VALUES (3112, 32, 78.00, 'item3112');
+INSERT INTO items VALUES (3113, 33, 78.25, 'item3113');
+INSERT INTO items VALUES (3114, 34, 78.50, 'item3114');
+INSERT INTO items VALUES (3115, 35, 78.75, 'item3115');
+INSERT INTO items VALUES (3116, 36, 79.00, 'item3116');
+INSERT INTO items VALUES (3117, 37, 79.25, 'item3117');
+INSERT INTO items VALUES (3118, 38, 79.50, 'item3118');
+INSERT INTO items VALUES (3119, 39, 79.75, 'item3119');
+INSERT INTO items VALUES (3120, 0, 80.00, 'item3120');
+INSERT INTO items VALUES (3121, 1, 80.25, 'item3121');
+INSERT INTO items VALUES (3122, 2, 80.50, 'item3122');
+INSERT INTO items VALUES (3123, 3, 80.75, 'item3123');
+INSERT INTO items VALUES (3124, 4, 81.00, 'item3124');
+INSERT INTO items VALUES (3125, 5, 81.25, 'item3125');
+INSERT INTO items VALUES (3126, 6, 81.50, 'item3126');
+INSERT INTO items VALUES (3127, 7, 81.75, 'item3127');
+INSERT INTO items VALUES (3128, 8, 82.00, 'item3128');
+INSERT INTO items VALUES (3129, 9, 82.25, 'item3129');
+INSERT INTO items VALUES (3130, 10, 82.50, 'item3130');
+INSERT INTO items VALUES (3131, 11, 82.75, 'item3131');
+INSERT INTO items VALUES (3132, 12, 83.00, 'item3132');
+INSERT INTO items VALUES (3133, 13, 83.25, 'item3133');
+INSERT INTO items VALUES (3134, 14, 83.50, 'item3134');
+INSERT INTO items VALUES (3135, 15, 83.75, 'item3135');
+INSERT INTO items VALUES (3136, 16, 84.00, 'item3136');
+INSERT INTO items VALUES (3137, 17, 84.25, 'item3137');
+INSERT INTO items VALUES (3138, 18, 84.50, 'item3138');
+INSERT INTO items VALUES (3139, 19, 84.75, 'item3139');
+INSERT INTO items VALUES (3140, 20, 85.00, 'item3140');
+INSERT INTO items VALUES (3141, 21, 85.25, 'item3141');
+INSERT INTO items VALUES (3142, 22, 85.50, 'item3142');
+INSERT INTO items VALUES (3143, 23, 85.75, 'item3143');
+INSERT INTO items VALUES (3144, 24, 86.00, 'item3144');
+INSERT INTO items VALUES (3145, 25, 86.25, 'item3145');
+INSERT INTO items VALUES (3146, 26, 86.50, 'item3146');
+INSERT INTO items VALUES (3147, 27, 86.75, 'item3147');
+INSERT INTO items VALUES (3148, 28, 87.00, 'item3148');
+INSERT INTO items VALUES (3149, 29, 87.25, 'item3149');
+INSERT INTO items VALUES (3150, 30, 87.50, 'item3150');
+INSERT INTO items VALUES (3151, 31, 87.75, 'item3151');
+INSERT INTO items VALUES (3152, 32, 88.00, 'item3152');
+INSERT INTO items VALUES (3153, 33, 88.25, 'item3153');
+INSERT INTO items VALUES (3154, 34, 88.50, 'item3154');
+INSERT INTO items VALUES (3155, 35, 88.75, 'item3155');
+INSERT INTO items VALUES (3156, 36, 89.00, 'item3156');
+INSERT INTO items VALUES (3157, 37, 89.25, 'item3157');
+INSERT INTO items VALUES (3158, 38, 89.50, 'item3158');
+INSERT INTO items VALUES (3159, 39, 89.75, 'item3159');
+INSERT INTO items VALUES (3160, 0, 90.00, 'item3160');
+INSERT INTO items VALUES (3161, 1, 90.25, 'item3161');
+INSERT INTO items VALUES (3162, 2, 90.50, 'item3162');
+INSERT INTO items VALUES (3163, 3, 90.75, 'item3163');
+INSERT INTO items VALUES (3164, 4, 91.00, 'item3164');
+INSERT INTO items VALUES (3165, 5, 91.25, 'item3165');
+INSERT INTO items VALUES (3166, 6, 91.50, 'item3166');
+INSERT INTO items VALUES (3167, 7, 91.75, 'item3167');
+INSERT INTO items VALUES (3168, 8, 92.00, 'item3168');
+INSERT INTO items VALUES (3169, 9, 92.25, 'item3169');
+INSERT INTO items VALUES (3170, 10, 92.50, 'item3170');
+INSERT INTO items VALUES (3171, 11, 92.75, 'item3171');
+INSERT INTO items VALUES (3172, 12, 93.00, 'item3172');
+INSERT INTO items VALUES (3173, 13, 93.25, 'item3173');
+INSERT INTO items VALUES (3174, 14, 93.50, 'item3174');
+INSERT INTO items VALUES (3175, 15, 93.75, 'item3175');
+INSERT INTO items VALUES (3176, 16, 94.00, 'item3176');
+INSERT INTO items VALUES (3177, 17, 94.25, 'item3177');
+INSERT INTO items VALUES (3178, 18, 94.50, 'item3178');
+INSERT INTO items VALUES (3179, 19, 94.75, 'item3179');
+INSERT INTO items VALUES (3180, 20, 95.00, 'item3180');
+INSERT INTO items VALUES (3181, 21, 95.25, 'item3181');
+INSERT INTO items VALUES (3182, 22, 95.50, 'item3182');
+INSERT INTO items VALUES (3183, 23, 95.75, 'item3183');
+INSERT INTO items VALUES (3184, 24, 96.00, 'item3184');
+INSERT INTO items VALUES (3185, 25, 96.25, 'item3185');
+INSERT INTO items VALUES (3186, 26, 96.50, 'item3186');
+INSERT INTO items VALUES (3187, 27, 96.75, 'item3187');
+INSERT INTO items VALUES (3188, 28, 97.00, 'item3188');
+INSERT INTO items VALUES (3189, 29, 97.25, 'item3189');
+INSERT INTO items VALUES (3190, 30, 97.50, 'item3190');
+INSERT INTO items VALUES (3191, 31, 97.75, 'item3191');
+INSERT INTO items VALUES (3192, 32, 98.00, 'item3192');
+INSERT INTO items VALUES (3193, 33, 98.25, 'item3193');
+INSERT INTO items VALUES (3194, 34, 98.50, 'item3194');
+INSERT INTO items VALUES (3195, 35, 98.75, 'item3195');
+INSERT INTO items VALUES (3196, 36, 99.00, 'item3196');
+INSERT INTO items VALUES (3197, 37, 99.25, 'item3197');
+INSERT INTO items VALUES (3198, 38, 99.50, 'item3198');
+INSERT INTO items VALUES (3199, 39, 99.75, 'item3199');
+INSERT INTO items VALUES (3200, 0, 0.00, 'item3200');
+INSERT INTO items VALUES (3201, 1, 0.25, 'item3201');
+INSERT INTO items VALUES (3202, 2, 0.50, 'item3202');
+INSERT INTO items VALUES (3203, 3, 0.75, 'item3203');
+INSERT INTO items VALUES (3204, 4, 1.00, 'item3204');
+INSERT INTO items VALUES (3205, 5, 1.25, 'item3205');
+INSERT INTO items VALUES (3206, 6, 1.50, 'item3206');
+INSERT INTO items VALUES (3207, 7, 1.75, 'item3207');
+INSERT INTO items VALUES (3208, 8, 2.00, 'item3208');
+INSERT INTO items VALUES (3209, 9, 2.25, 'item3209');
+INSERT INTO items VALUES (3210, 10, 2.50, 'item3210');
+INSERT INTO items VALUES (3211, 11, 2.75, 'item3211');
+INSERT INTO items VALUES (3212, 12, 3.00, 'item3212');
+INSERT INTO items VALUES (3213, 13, 3.25, 'item3213');
+INSERT INTO items VALUES (3214, 14, 3.50, 'item3214');
+INSERT INTO items VALUES (3215, 15, 3.75, 'item3215');
+INSERT INTO items VALUES (3216, 16, 4.00, 'item3216');
+INSERT INTO items VALUES (3217, 17, 4.25, 'item3217');
+INSERT INTO items VALUES (3218, 18, 4.50, 'item3218');
+INSERT INTO items VALUES (3219, 19, 4.75, 'item3219');
+INSERT INTO items VALUES (3220, 20, 5.00, 'item3220');
+INSERT INTO items VALUES (3221, 21, 5.25, 'item3221');
+INSERT INTO items VALUES (3222, 22, 5.50, 'item3222');
+INSERT INTO items VALUES (3223, 23, 5.75, 'item3223');
+INSERT INTO items VALUES (3224, 24, 6.00, 'item3224');
+INSERT INTO items VALUES (3225, 25, 6.25, 'item3225');
+INSERT INTO items VALUES (3226, 26, 6.50, 'item3226');
+INSERT INTO items VALUES (3227, 27, 6.75, 'item3227');
+INSERT INTO items VALUES (3228, 28, 7.00, 'item3228');
+INSERT INTO items VALUES (3229, 29, 7.25, 'item3229');
+INSERT INTO items VALUES (3230, 30, 7.50, 'item3230');
+INSERT INTO items VALUES (3231, 31, 7.75, 'item3231');
+INSERT INTO items VALUES (3232, 32, 8.00, 'item3232');
+INSERT INTO items VALUES (3233, 33, 8.25, 'item3233');
+INSERT INTO items VALUES (3234, 34, 8.50, 'item3234');
+INSERT INTO items VALUES (3235, 35, 8.75, 'item3235');
+INSERT INTO items VALUES (3236, 36, 9.00, 'item3236');
+INSERT INTO items VALUES (3237, 37, 9.25, 'item3237');
+INSERT INTO items VALUES (3238, 38, 9.50, 'item3238');
+INSERT INTO items VALUES (3239, 39, 9.75, 'item3239');
+INSERT INTO items VALUES (3240, 0, 10.00, 'item3240');
+INSERT INTO items VALUES (3241, 1, 10.25, 'item3241');
+INSERT INTO items VALUES (3242, 2, 10.50, 'item3242');
+INSERT INTO items VALUES (3243, 3, 10.75, 'item3243');
+INSERT INTO items VALUES (3244, 4, 11.00, 'item3244');
+INSERT INTO items VALUES (3245, 5, 11.25, 'item3245');
+INSERT INTO items VALUES (3246, 6, 11.50, 'item3246');
+INSERT INTO items VALUES (3247, 7, 11.75, 'item3247');
+INSERT INTO items VALUES (3248, 8, 12.00, 'item3248');
+INSERT INTO items VALUES (3249, 9, 12.25, 'item3249');
+INSERT INTO items VALUES (3250, 10, 12.50, 'item3250');
+INSERT INTO items VALUES (3251, 11, 12.75, 'item3251');
+INSERT INTO items VALUES (3252, 12, 13.00, 'item3252');
+INSERT INTO items VALUES (3253, 13, 13.25, 'item3253');
+INSERT INTO items VALUES (3254, 14, 13.50, 'item3254');
+INSERT INTO items VALUES (3255, 15, 13.75, 'item3255');
+INSERT INTO items VALUES (3256, 16, 14.00, 'item3256');
+INSERT INTO items VALUES (3257, 17, 14.25, 'item3257');
+INSERT INTO items VALUES (3258, 18, 14.50, 'item3258');
+INSERT INTO items VALUES (3259, 19, 14.75, 'item3259');
+INSERT INTO items VALUES (3260, 20, 15.00, 'item3260');
+INSERT INTO items VALUES (3261, 21, 15.25, 'item3261');
+INSERT INTO items VALUES (3262, 22, 15.50, 'item3262');
+INSERT INTO items VALUES (3263, 23, 15.75, 'item3263');
+INSERT INTO items VALUES (3264, 24, 16.00, 'item3264');
+INSERT INTO items VALUES (3265, 25, 16.25, 'item3265');
+INSERT INTO items VALUES (3266, 26, 16.50, 'item3266');
+INSERT INTO items VALUES (3267, 27, 16.75, 'item3267');
+INSERT INTO items VALUES (3268, 28, 17.00, 'item3268');
+INSERT INTO items VALUES (3269, 29, 17.25, 'item3269');
+INSERT INTO items VALUES (3270, 30, 17.50, 'item3270');
+INSERT INTO items VALUES (3271, 31, 17.75, 'item3271');
+INSERT INTO items VALUES (3272, 32, 18.00, 'item3272');
+INSERT INTO items VALUES (3273, 33, 18.25, 'item3273');
+INSERT INTO items VALUES (3274, 34, 18.50, 'item3274');
+INSERT INTO items VALUES (3275, 35, 18.75, 'item3275');
+INSERT INTO items VALUES (3276, 36, 19.00, 'item3276');
+INSERT INTO items VALUES (3277, 37, 19.25, 'item3277');
+INSERT INTO items VALUES (3278, 38, 19.50, 'item3278');
+INSERT INTO items VALUES (3279, 39, 19.75, 'item3279');
+INSERT INTO items VALUES (3280, 0, 20.00, 'item3280');
+INSERT INTO items VALUES (3281, 1, 20.25, 'item3281');
+INSERT INTO items VALUES (3282, 2, 20.50, 'item3282');
+INSERT INTO items VALUES (3283, 3, 20.75, 'item3283');
+INSERT INTO items VALUES (3284, 4, 21.00, 'item3284');
+INSERT INTO items VALUES (3285, 5, 21.25, 'item3285');
+INSERT INTO items VALUES (3286, 6, 21.50, 'item3286');
+INSERT INTO items VALUES (3287, 7, 21.75, 'item3287');
+INSERT INTO items VALUES (3288, 8, 22.00, 'item3288');
+INSERT INTO items VALUES (3289, 9, 22.25, 'item3289');
+INSERT INTO items VALUES (3290, 10, 22.50, 'item3290');
+INSERT INTO items VALUES (3291, 11, 22.75, 'item3291');
+INSERT INTO items VALUES (3292, 12, 23.00, 'item3292');
+INSERT INTO items VALUES (3293, 13, 23.25, 'item3293');
+INSERT INTO items VALUES (3294, 14, 23.50, 'item3294');
+INSERT INTO items VALUES (3295, 15, 23.75, 'item3295');
+INSERT INTO items VALUES (3296, 16, 24.00, 'item3296');
+INSERT INTO items VALUES (3297, 17, 24.25, 'item3297');
+INSERT INTO items VALUES (3298, 18, 24.50, 'item3298');
+INSERT INTO items VALUES (3299, 19, 24.75, 'item3299');
+INSERT INTO items VALUES (3300, 20, 25.00, 'item3300');
+INSERT INTO items VALUES (3301, 21, 25.25, 'item3301');
+INSERT INTO items VALUES (3302, 22, 25.50, 'item3302');
+INSERT INTO items VALUES (3303, 23, 25.75, 'item3303');
+INSERT INTO items VALUES (3304, 24, 26.00, 'item3304');
+INSERT INTO items VALUES (3305, 25, 26.25, 'item3305');
+INSERT INTO items VALUES (3306, 26, 26.50, 'item3306');
+INSERT INTO items VALUES (3307, 27, 26.75, 'item3307');
+INSERT INTO items VALUES (3308, 28, 27.00, 'item3308');
+INSERT INTO items VALUES (3309, 29, 27.25, 'item3309');
+INSERT INTO items VALUES (3310, 30, 27.50, 'item3310');
+INSERT INTO items VALUES (3311, 31, 27.75, 'item3311');
+INSERT INTO items VALUES (3312, 32, 28.00, 'item3312');
+INSERT INTO items VALUES (3313, 33, 28.25, 'item3313');
+INSERT INTO items VALUES (3314, 34, 28.50, 'item3314');
+INSERT INTO items VALUES (3315, 35, 28.75, 'item3315');
+INSERT INTO items VALUES (3316, 36, 29.00, 'item3316');
+INSERT INTO items VALUES (3317, 37, 29.25, 'item3317');
+INSERT INTO items VALUES (3318, 38, 29.50, 'item3318');
+INSERT INTO items VALUES (3319, 39, 29.75, 'item3319');
+INSERT INTO items VALUES (3320, 0, 30.00, 'item3320');
+INSERT INTO items VALUES (3321, 1, 30.25, 'item3321');
+INSERT INTO items VALUES (3322, 2, 30.50, 'item3322');
+INSERT INTO items VALUES (3323, 3, 30.75, 'item3323');
+INSERT INTO items VALUES (3324, 4, 31.00, 'item3324');
+INSERT INTO items VALUES (3325, 5, 31.25, 'item3325');
+INSERT INTO items VALUES (3326, 6, 31.50, 'item3326');
+INSERT INTO items VALUES (3327, 7, 31.75, 'item3327');
+INSERT INTO items VALUES (3328, 8, 32.00, 'item3328');
+INSERT INTO items VALUES (3329, 9, 32.25, 'item3329');
+INSERT INTO items VALUES (3330, 10, 32.50, 'item3330');
+INSERT INTO items VALUES (3331, 11, 32.75, 'item3331');
+INSERT INTO items VALUES (3332, 12, 33.00, 'item3332');
+INSERT INTO items VALUES (3333, 13, 33.25, 'item3333');
+INSERT INTO items VALUES (3334, 14, 33.50, 'item3334');
+INSERT INTO items VALUES (3335, 15, 33.75, 'item3335');
+INSERT INTO items VALUES (3336, 16, 34.00, 'item3336');
+INSERT INTO items VALUES (3337, 17, 34.25, 'item3337');
+INSERT INTO items VALUES (3338, 18, 34.50, 'item3338');
+INSERT INTO items VALUES (3339, 19, 34.75, 'item3339');
+INSERT INTO items VALUES (3340, 20, 35.00, 'item3340');
+INSERT INTO items VALUES (3341, 21, 35.25, 'item3341');
+INSERT INTO items VALUES (3342, 22, 35.50, 'item3342');
+INSERT INTO items VALUES (3343, 23, 35.75, 'item3343');
+INSERT INTO items VALUES (3344, 24, 36.00, 'item3344');
+INSERT INTO items VALUES (3345, 25, 36.25, 'item3345');
+INSERT INTO items VALUES (3346, 26, 36.50, 'item3346');
+INSERT INTO items VALUES (3347, 27, 36.75, 'item3347');
+INSERT INTO items VALUES (3348, 28, 37.00, 'item3348');
+INSERT INTO items VALUES (3349, 29, 37.25, 'item3349');
+INSERT INTO items VALUES (3350, 30, 37.50, 'item3350');
+INSERT INTO items VALUES (3351, 31, 37.75, 'item3351');
+INSERT INTO items VALUES (3352, 32, 38.00, 'item3352');
+INSERT INTO items VALUES (3353, 33, 38.25, 'item3353');
+INSERT INTO items VALUES (3354, 34, 38.50, 'item3354');
+INSERT INTO items VALUES (3355, 35, 38.75, 'item3355');
+INSERT INTO items VALUES (3356, 36, 39.00, 'item3356');
+INSERT INTO items VALUES (3357, 37, 39.25, 'item3357');
+INSERT INTO items VALUES (3358, 38, 39.50, 'item3358');
+INSERT INTO items VALUES (3359, 39, 39.75, 'item3359');
+INSERT INTO items VALUES (3360, 0, 40.00, 'item3360');
+INSERT INTO items VALUES (3361, 1, 40.25, 'item3361');
+INSERT INTO items VALUES (3362, 2, 40.50, 'item3362');
+INSERT INTO items VALUES (3363, 3, 40.75, 'item3363');
+INSERT INTO items VALUES (3364, 4, 41.00, 'item3364');
+INSERT INTO items VALUES (3365, 5, 41.25, 'item3365');
+INSERT INTO items VALUES (3366, 6, 41.50, 'item3366');
+INSERT INTO items VALUES (3367, 7, 41.75, 'item3367');
+INSERT INTO items VALUES (3368, 8, 42.00, 'item3368');
+INSERT INTO items VALUES (3369, 9, 42.25, 'item3369');
+INSERT INTO items VALUES (3370, 10, 42.50, 'item3370');
+INSERT INTO items VALUES (3371, 11, 42.75, 'item3371');
+INSERT INTO items VALUES (3372, 12, 43.00, 'item3372');
+INSERT INTO items VALUES (3373, 13, 43.25, 'item3373');
+INSERT INTO items VALUES (3374, 14, 43.50, 'item3374');
+INSERT INTO items VALUES (3375, 15, 43.75, 'item3375');
+INSERT INTO items VALUES (3376, 16, 44.00, 'item3376');
+INSERT INTO items VALUES (3377, 17, 44.25, 'item3377');
+INSERT INTO items VALUES (3378, 18, 44.50, 'item3378');
+INSERT INTO items VALUES (3379, 19, 44.75, 'item3379');
+INSERT INTO items VALUES (3380, 20, 45.00, 'item3380');
+INSERT INTO items VALUES (3381, 21, 45.25, 'item3381');
+INSERT INTO items VALUES (3382, 22, 45.50, 'item3382');
+INSERT INTO items VALUES (3383, 23, 45.75, 'item3383');
+INSERT INTO items VALUES (3384, 24, 46.00, 'item3384');
+INSERT INTO items VALUES (3385, 25, 46.25, 'item3385');
+INSERT INTO items VALUES (3386, 26, 46.50, 'item3386');
+INSERT INTO items VALUES (3387, 27, 46.75, 'item3387');
+INSERT INTO items VALUES (3388, 28, 47.00, 'item3388');
+INSERT INTO items VALUES (3389, 29, 47.25, 'item3389');
+INSERT INTO items VALUES (3390, 30, 47.50, 'item3390');
+INSERT INTO items VALUES (3391, 31, 47.75, 'item3391');
+INSERT INTO items VALUES (3392, 32, 48.00, 'item3392');
+INSERT INTO items VALUES (3393, 33, 48.25, 'item3393');
+INSERT INTO items VALUES (3394, 34, 48.50, 'item3394');
+INSERT INTO items VALUES (3395, 35, 48.75, 'item3395');
+INSERT INTO items VALUES (3396, 36, 49.00, 'item3396');
+INSERT INTO items VALUES (3397, 37, 49.25, 'item3397');
+INSERT INTO items VALUES (3398, 38, 49.50, 'item3398');
+INSERT INTO items VALUES (3399, 39, 49.75, 'item3399');
+INSERT INTO items VALUES (3400, 0, 50.00, 'item3400');
+INSERT INTO items VALUES (3401, 1, 50.25, 'item3401');
+INSERT INTO items VALUES (3402, 2, 50.50, 'item3402');
+INSERT INTO items VALUES (3403, 3, 50.75, 'item3403');
+INSERT INTO items VALUES (3404, 4, 51.00, 'item3404');
+INSERT INTO items VALUES (3405, 5, 51.25, 'item3405');
+INSERT INTO items VALUES (3406, 6, 51.50, 'item3406');
+INSERT INTO items VALUES (3407, 7, 51.75, 'item3407');
+INSERT INTO items VALUES (3408, 8, 52.00, 'item3408');
+INSERT INTO items VALUES (3409, 9, 52.25, 'item3409');
+INSERT INTO items VALUES (3410, 10, 52.50, 'item3410');
+INSERT INTO items VALUES (3411, 11, 52.75, 'item3411');
+INSERT INTO items VALUES (3412, 12, 53.00, 'item3412');
+INSERT INTO items VALUES (3413, 13, 53.25, 'item3413');
+INSERT INTO items VALUES (3414, 14, 53.50, 'item3414');
+INSERT INTO items VALUES (3415, 15, 53.75, 'item3415');
+INSERT INTO items VALUES (3416, 16, 54.00, 'item3416');
+INSERT INTO items VALUES (3417, 17, 54.25, 'item3417');
+INSERT INTO items VALUES (3418, 18, 54.50, 'item3418');
+INSERT INTO items VALUES (3419, 19, 54.75, 'item3419');
+INSERT INTO items VALUES (3420, 20, 55.00, 'item3420');
+INSERT INTO items VALUES (3421, 21, 55.25, 'item3421');
+INSERT INTO items VALUES (3422, 22, 55.50, 'item3422');
+INSERT INTO items VALUES (3423, 23, 55.75, 'item3423');
+INSERT INTO items VALUES (3424, 24, 56.00, 'item3424');
+INSERT INTO items VALUES (3425, 25, 56.25, 'item3425');
+INSERT INTO items VALUES (3426, 26, 56.50, 'item3426');
+INSERT INTO items VALUES (3427, 27, 56.75, 'item3427');
+INSERT INTO items VALUES (3428, 28, 57.00, 'item3428');
+INSERT INTO items VALUES (3429, 29, 57.25, 'item3429');
+INSERT INTO items VALUES (3430, 30, 57.50, 'item3430');
+INSERT INTO items VALUES (3431, 31, 57.75, 'item3431');
+INSERT INTO items VALUES (3432, 32, 58.00, 'item3432');
+INSERT INTO items VALUES (3433, 33, 58.25, 'item3433');
+INSERT INTO items VALUES (3434, 34, 58.50, 'item3434');
+INSERT INTO items VALUES (3435, 35, 58.75, 'item3435');
+INSERT INTO items VALUES (3436, 36, 59.00, 'item3436');
+INSERT INTO items VALUES (3437, 37, 59.25, 'item3437');
+INSERT INTO items VALUES (3438, 38, 59.50, 'item3438');
+INSERT INTO items VALUES (3439, 39, 59.75, 'item3439');
+INSERT INTO items VALUES (3440, 0, 60.00, 'item3440');
+INSERT INTO items VALUES (3441, 1, 60.25, 'item3441');
+INSERT INTO items VALUES (3442, 2, 60.50, 'item3442');
+INSERT INTO items VALUES (3443, 3, 60.75, 'item3443');
+INSERT INTO items VALUES (3444, 4, 61.00, 'item3444');
+INSERT INTO items VALUES (3445, 5, 61.25, 'item3445');
+INSERT INTO items VALUES (3446, 6, 61.50, 'item3446');
+INSERT INTO items VALUES (3447, 7, 61.75, 'item3447');
+INSERT INTO items VALUES (3448, 8, 62.00, 'item3448');
+INSERT INTO items VALUES (3449, 9, 62.25, 'item3449');
+INSERT INTO items VALUES (3450, 10, 62.50, 'item3450');
+INSERT INTO items VALUES (3451, 11, 62.75, 'item3451');
+INSERT INTO items VALUES (3452, 12, 63.00, 'item3452');
+INSERT INTO items VALUES (3453, 13, 63.25, 'item3453');
+INSERT INTO items VALUES (3454, 14, 63.50, 'item3454');
+INSERT INTO items VALUES (3455, 15, 63.75, 'item3455');
+INSERT INTO items VALUES (3456, 16, 64.00, 'item3456');
+INSERT INTO items VALUES (3457, 17, 64.25, 'item3457');
+INSERT INTO items VALUES (3458, 18, 64.50, 'item3458');
+INSERT INTO items VALUES (3459, 19, 64.75, 'item3459');
+INSERT INTO items VALUES (3460, 20, 65.00, 'item3460');
+INSERT INTO items VALUES (3461, 21, 65.25, 'item3461');
+INSERT INTO items VALUES (3462, 22, 65.50, 'item3462');
+INSERT INTO items VALUES (3463, 23, 65.75, 'item3463');
+INSERT INTO items VALUES (3464, 24, 66.00, 'item3464');
+INSERT INTO items VALUES (3465, 25, 66.25, 'item3465');
+INSERT INTO items VALUES (3466, 26, 66.50, 'item3466');
+INSERT INTO items VALUES (3467, 27, 66.75, 'item3467');
+INSERT INTO items VALUES (3468, 28, 67.00, 'item3468');
+INSERT INTO items VALUES (3469, 29, 67.25, 'item3469');
+INSERT INTO items VALUES (3470, 30, 67.50, 'item3470');
+INSERT INTO items VALUES (3471, 31, 67.75, 'item3471');
+INSERT INTO items VALUES (3472, 32, 68.00, 'item3472');
+INSERT INTO items VALUES (3473, 33, 68.25, 'item3473');
+INSERT INTO items VALUES (3474, 34, 68.50, 'item3474');
+INSERT INTO items VALUES (3475, 35, 68.75, 'item3475');
+INSERT INTO items VALUES (3476, 36, 69.00, 'item3476');
+INSERT INTO items VALUES (3477, 37, 69.25, 'item3477');
+INSERT INTO items VALUES (3478, 38, 69.50, 'item3478');
+INSERT INTO items VALUES (3479, 39, 69.75, 'item3479');
+INSERT INTO items VALUES (3480, 0, 70.00, 'item3480');
+INSERT INTO items VALUES (3481, 1, 70.25, 'item3481');
+INSERT INTO items VALUES (3482, 2, 70.50, 'item3482');
+INSERT INTO items VALUES (3483, 3, 70.75, 'item3483');
+INSERT INTO items VALUES (3484, 4, 71.00, 'item3484');
+INSERT INTO items VALUES (3485, 5, 71.25, 'item3485');
+INSERT INTO items VALUES (3486, 6, 71.50, 'item3486');
+INSERT INTO items VALUES (3487, 7, 71.75, 'item3487');
+INSERT INTO items VALUES (3488, 8, 72.00, 'item3488');
+INSERT INTO items VALUES (3489, 9, 72.25, 'item3489');
+INSERT INTO items VALUES (3490, 10, 72.50, 'item3490');
+INSERT INTO items VALUES (3491, 11, 72.75, 'item3491');
+INSERT INTO items VALUES (3492, 12, 73.00, 'item3492');
+INSERT INTO items VALUES (3493, 13, 73.25, 'item3493');
+INSERT INTO items VALUES (3494, 14, 73.50, 'item3494');
+INSERT INTO items VALUES (3495, 15, 73.75, 'item3495');
+INSERT INTO items VALUES (3496, 16, 74.00, 'item3496');
+INSERT INTO items VALUES (3497, 17, 74.25, 'item3497');
+INSERT INTO items VALUES (3498, 18, 74.50, 'item3498');
+INSERT INTO items VALUES (3499, 19, 74.75, 'item3499');
+INSERT INTO items VALUES (3500, 20, 75.00, 'item3500');
+INSERT INTO items VALUES (3501, 21, 75.25, 'item3501');
+INSERT INTO items VALUES (3502, 22, 75.50, 'item3502');
+INSERT INTO items VALUES (3503, 23, 75.75, 'item3503');
+INSERT INTO items VALUES (3504, 24, 76.00, 'item3504');
+INSERT INTO items VALUES (3505, 25, 76.25, 'item3505');
+INSERT INTO items VALUES (3506, 26, 76.50, 'item3506');
+INSERT INTO items VALUES (3507, 27, 76.75, 'item3507');
+INSERT INTO items VALUES (3508, 28, 77.00, 'item3508');
+INSERT INTO items VALUES (3509, 29, 77.25, 'item3509');
+INSERT INTO items VALUES (3510, 30, 77.50, 'item3510');
+INSERT INTO items VALUES (3511, 31, 77.75, 'item3511');
+INSERT INTO items VALUES (3512, 32, 78.00, 'item3512');
+INSERT INTO items VALUES (3513, 33, 78.25, 'item3513');
+INSERT INTO items VALUES (3514, 34, 78.50, 'item3514');
+INSERT INTO items VALUES (3515, 35, 78.75, 'item3515');
+INSERT INTO items VALUES (3516, 36, 79.00, 'item3516');
+INSERT INTO items VALUES (3517, 37, 79.25, 'item3517');
+INSERT INTO items VALUES (3518, 38, 79.50, 'item3518');
+INSERT INTO items VALUES (3519, 39, 79.75, 'item3519');
+INSERT INTO items VALUES (3520, 0, 80.00, 'item3520');
+INSERT INTO items VALUES (3521, 1, 80.25, 'item3521');
+INSERT INTO items VALUES (3522, 2, 80.50, 'item3522');
+INSERT INTO items VALUES (3523, 3, 80.75, 'item3523');
+INSERT INTO items VALUES (3524, 4, 81.00, 'item3524');
+INSERT INTO items VALUES (3525, 5, 81.25, 'item3525');
+INSERT INTO items VALUES (3526, 6, 81.50, 'item3526');
+INSERT INTO items VALUES (3527, 7, 81.75, 'item3527');
+INSERT INTO items VALUES (3528, 8, 82.00, 'item3528');
+INSERT INTO items VALUES (3529, 9, 82.25, 'item3529');
+INSERT INTO items VALUES (3530, 10, 82.50, 'item3530');
+INSERT INTO items VALUES (3531, 11, 82.75, 'item3531');
+INSERT INTO items VALUES (3532, 12, 83.00, 'item3532');
+INSERT INTO items VALUES (3533, 13, 83.25, 'item3533');
+INSERT INTO items VALUES (3534, 14, 83.50, 'item3534');
+INSERT INTO items VALUES (3535, 15, 83.75, 'item3535');
+INSERT INTO items VALUES (3536, 16, 84.00, 'item3536');
+INSERT INTO items VALUES (3537, 17, 84.25, 'item3537');
+INSERT INTO items VALUES (3538, 18, 84.50, 'item3538');
+INSERT INTO items VALUES (3539, 19, 84.75, 'item3539');
+INSERT INTO items VALUES (3540, 20, 85.00, 'item3540');
+INSERT INTO items VALUES (3541, 21, 85.25, 'item3541');
+INSERT INTO items VALUES (3542, 22, 85.50, 'item3542');
+INSERT INTO items VALUES (3543, 23, 85.75, 'item3543');
+INSERT INTO items VALUES (3544, 24, 86.00, 'item3544');
+INSERT INTO items VALUES (3545, 25, 86.25, 'item3545');
+INSERT INTO items VALUES (3546, 26, 86.50, 'item3546');
+INSERT INTO items VALUES (3547, 27, 86.75, 'item3547');
+INSERT INTO items VALUES (3548, 28, 87.00, 'item3548');
+INSERT INTO items VALUES (3549, 29, 87.25, 'item3549');
+INSERT INTO items VALUES (3550, 30, 87.50, 'item3550');
+INSERT INTO items VALUES (3551, 31, 87.75, 'item3551');
+INSERT INTO items VALUES (3552, 32, 88.00, 'item3552');
+INSERT INTO items VALUES (3553, 33, 88.25, 'item3553');
+INSERT INTO items VALUES (3554, 34, 88.50, 'item3554');
+INSERT INTO items VALUES (3555, 35, 88.75, 'item3555');
+INSERT INTO items VALUES (3556, 36, 89.00, 'item3556');
+INSERT INTO items VALUES (3557, 37, 89.25, 'item3557');
+INSERT INTO items VALUES (3558, 38, 89.50, 'item3558');
+INSERT INTO items VALUES (3559, 39, 89.75, 'item3559');
+INSERT INTO items VALUES (3560, 0, 90.00, 'item3560');
+INSERT INTO items VALUES (3561, 1, 90.25, 'item3561');
+INSERT INTO items VALUES (3562, 2, 90.50, 'item3562');
+INSERT INTO items VALUES (3563, 3, 90.75, 'item3563');
+INSERT INTO items VALUES (3564, 4, 91.00, 'item3564');
+INSERT INTO items VALUES (3565, 5, 91.25, 'item3565');
+INSERT INTO items VALUES (3566, 6, 91.50, 'item3566');
+INSERT INTO items VALUES (3567, 7, 91.75, 'item3567');
+INSERT INTO items VALUES (3568, 8, 92.00, 'item3568');
+INSERT INTO items VALUES (3569, 9, 92.25, 'item3569');
+INSERT INTO items VALUES (3570, 10, 92.50, 'item3570');
+INSERT INTO items VALUES (3571, 11, 92.75, 'item3571');
+INSERT INTO items VALUES (3572, 12, 93.00, 'item3572');
+INSERT INTO items VALUES (3573, 13, 93.25, 'item3573');
+INSERT INTO items VALUES (3574, 14, 93.50, 'item3574');
+INSERT INTO items VALUES (3575, 15, 93.75, 'item3575');
+INSERT INTO items VALUES (3576, 16, 94.00, 'item3576');
+INSERT INTO items VALUES (3577, 17, 94.25, 'item3577');
+INSERT INTO items VALUES (3578, 18, 94.50, 'item3578');
+INSERT INTO items VALUES (3579, 19, 94.75, 'item3579');
+INSERT INTO items VALUES (3580, 20, 95.00, 'item3580');
+INSERT INTO items VALUES (3581, 21, 95.25, 'item3581');
+INSERT INTO items VALUES (3582, 22, 95.50, 'item3582');
+INSERT INTO items VALUES (3583, 23, 95.75, 'item3583');
+INSERT INTO items VALUES (3584, 24, 96.00, 'item3584');
+INSERT INTO items VALUES (3585, 25, 96.25, 'item3585');
+INSERT INTO items VALUES (3586, 26, 96.50, 'item3586');
+INSERT INTO items VALUES (3587, 27, 96.75, 'item3587');
+INSERT INTO items VALUES (3588, 28, 97.00, 'item3588');
+INSERT INTO items VALUES (3589, 29, 97.25, 'item3589');
+INSERT INTO items VALUES (3590, 30, 97.50, 'item3590');
+INSERT INTO items VALUES (3591, 31, 97.75, 'item3591');
+INSERT INTO items VALUES (3592, 32, 98.00, 'item3592');
+INSERT INTO items VALUES (3593, 33, 98.25, 'item3593');
+INSERT INTO items VALUES (3594, 34, 98.50, 'item3594');
+INSERT INTO items VALUES (3595, 35, 98.75, 'item3595');
+INSERT INTO items VALUES (3596, 36, 99.00, 'item3596');
+INSERT INTO items VALUES (3597, 37, 99.25, 'item3597');
+INSERT INTO items VALUES (3598, 38, 99.50, 'item3598');
+INSERT INTO items VALUES (3599, 39, 99.75, 'item3599');
+INSERT INTO items VALUES (3600, 0, 0.00, 'item3600');
+INSERT INTO items VALUES (3601, 1, 0.25, 'item3601');
+INSERT INTO items VALUES (3602, 2, 0.50, 'item3602');
+INSERT INTO items VALUES (3603, 3, 0.75, 'item3603');
+INSERT INTO items VALUES (3604, 4, 1.00, 'item3604');
+INSERT INTO items VALUES (3605, 5, 1.25, 'item3605');
+INSERT INTO items VALUES (3606, 6, 1.50, 'item3606');
+INSERT INTO items VALUES (3607, 7, 1.75, 'item3607');
+INSERT INTO items VALUES (3608, 8, 2.00, 'item3608');
+INSERT INTO items VALUES (3609, 9, 2.25, 'item3609');
+INSERT INTO items VALUES (3610, 10, 2.50, 'item3610');
+INSERT INTO items VALUES (3611, 11, 2.75, 'item3611');
+INSERT INTO items VALUES (3612, 12, 3.00, 'item3612');
+INSERT INTO items VALUES (3613, 13, 3.25, 'item3613');
+INSERT INTO items VALUES (3614, 14, 3.50, 'item3614');
+INSERT INTO items VALUES (3615, 15, 3.75, 'item3615');
+INSERT INTO items VALUES (3616, 16, 4.00, 'item3616');
+INSERT INTO items VALUES (3617, 17, 4.25, 'item3617');
+INSERT INTO items VALUES (3618, 18, 4.50, 'item3618');
+INSERT INTO items VALUES (3619, 19, 4.75, 'item3619');
+INSERT INTO items VALUES (3620, 20, 5.00, 'item3620');
+INSERT INTO items VALUES (3621, 21, 5.25, 'item3621');
+INSERT INTO items VALUES (3622, 22, 5.50, 'item3622');
+INSERT INTO items VALUES (3623, 23, 5.75, 'item3623');
+INSERT INTO items VALUES (3624, 24, 6.00, 'item3624');
+INSERT INTO items VALUES (3625, 25, 6.25, 'item3625');
+INSERT INTO items VALUES (3626, 26, 6.50, 'item3626');
+INSERT INTO items VALUES (3627, 27, 6.75, 'item3627');
+INSERT INTO items VALUES (3628, 28, 7.00, 'item3628');
+INSERT INTO items VALUES (3629, 29, 7.25, 'item3629');
+INSERT INTO items VALUES (3630, 30, 7.50, 'item3630');
+INSERT INTO items VALUES (3631, 31, 7.75, 'item3631');
+INSERT INTO items VALUES (3632, 32, 8.00, 'item3632');
+INSERT INTO items VALUES (3633, 33, 8.25, 'item3633');
+INSERT INTO items VALUES (3634, 34, 8.50, 'item3634');
+INSERT INTO items VALUES (3635, 35, 8.75, 'item3635');
+INSERT INTO items VALUES (3636, 36, 9.00, 'item3636');
+INSERT INTO items VALUES (3637, 37, 9.25, 'item3637');
+INSERT INTO items VALUES (3638, 38, 9.50, 'item3638');
+INSERT INTO items VALUES (3639, 39, 9.75, 'item3639');
+INSERT INTO items VALUES (3640, 0, 10.00, 'item3640');
+INSERT INTO items VALUES (3641, 1, 10.25, 'item3641');
+INSERT INTO items VALUES (3642, 2, 10.50, 'item3642');
+INSERT INTO items VALUES (3643, 3, 10.75, 'item3643');
+INSERT INTO items VALUES (3644, 4, 11.00, 'item3644');
+INSERT INTO items VALUES (3645, 5, 11.25, 'item3645');
+INSERT INTO items VALUES (3646, 6, 11.50, 'item3646');
+INSERT INTO items VALUES (3647, 7, 11.75, 'item3647');
+INSERT INTO items VALUES (3648, 8, 12.00, 'item3648');
+INSERT INTO items VALUES (3649, 9, 12.25, 'item3649');
+INSERT INTO items VALUES (3650, 10, 12.50, 'item3650');
+INSERT INTO items VALUES (3651, 11, 12.75, 'item3651');
+INSERT INTO items VALUES (3652, 12, 13.00, 'item3652');
+INSERT INTO items VALUES (3653, 13, 13.25, 'item3653');
+INSERT INTO items VALUES (3654, 14, 13.50, 'item3654');
+INSERT INTO items VALUES (3655, 15, 13.75, 'item3655');
+INSERT INTO items VALUES (3656, 16, 14.00, 'item3656');
+INSERT INTO items VALUES (3657, 17, 14.25, 'item3657');
+INSERT INTO items VALUES (3658, 18, 14.50, 'item3658');
+INSERT INTO items VALUES (3659, 19, 14.75, 'item3659');
+INSERT INTO items VALUES (3660, 20, 15.00, 'item3660');
+INSERT INTO items VALUES (3661, 21, 15.25, 'item3661');
+INSERT INTO items VALUES (3662, 22, 15.50, 'item3662');
+INSERT INTO items VALUES (3663, 23, 15.75, 'item3663');
+INSERT INTO items VALUES (3664, 24, 16.00, 'item3664');
+INSERT INTO items VALUES (3665, 25, 16.25, 'item3665');
+INSERT INTO items VALUES (3666, 26, 16.50, 'item3666');
+INSERT INTO items VALUES (3667, 27, 16.75, 'item3667');
+INSERT INTO items VALUES (3668, 28, 17.00, 'item3668');
+INSERT INTO items VALUES (3669, 29, 17.25, 'item3669');
+INSERT INTO items VALUES (3670, 30, 17.50, 'item3670');
+INSERT INTO items VALUES (3671, 31, 17.75, 'item3671');
+INSERT INTO items VALUES (3672, 32, 18.00, 'item3672');
+INSERT INTO items VALUES (3673, 33, 18.25, 'item3673');
+INSERT INTO items VALUES (3674, 34, 18.50, 'item3674');
+INSERT INTO items VALUES (3675, 35, 18.75, 'item3675');
+INSERT INTO items VALUES (3676, 36, 19.00, 'item3676');
+INSERT INTO items VALUES (3677, 37, 19.25, 'item3677');
+INSERT INTO items VALUES (3678, 38, 19.50, 'item3678');
+INSERT INTO items VALUES (3679, 39, 19.75, 'item3679');
+INSERT INTO items VALUES (3680, 0, 20.00, 'item3680');
+INSERT INTO items VALUES (3681, 1, 20.25, 'item3681');
+INSERT INTO items VALUES (3682, 2, 20.50, 'item3682');
+INSERT INTO items VALUES (3683, 3, 20.75, 'item3683');
+INSERT INTO items VALUES (3684, 4, 21.00, 'item3684');
+INSERT INTO items VALUES (3685, 5, 21.25, 'item3685');
+INSERT INTO items VALUES (3686, 6, 21.50, 'item3686');
+INSERT INTO items VALUES (3687, 7, 21.75, 'item3687');
+INSERT INTO items VALUES (3688, 8, 22.00, 'item3688');
+INSERT INTO items VALUES (3689, 9, 22.25, 'item3689');
+INSERT INTO items VALUES (3690, 10, 22.50, 'item3690');
+INSERT INTO items VALUES (3691, 11, 22.75, 'item3691');
+INSERT INTO items VALUES (3692, 12, 23.00, 'item3692');
+INSERT INTO items VALUES (3693, 13, 23.25, 'item3693');
+INSERT INTO items VALUES (3694, 14, 23.50, 'item3694');
+INSERT INTO items VALUES (3695, 15, 23.75, 'item3695');
+INSERT INTO items VALUES (3696, 16, 24.00, 'item3696');
+INSERT INTO items VALUES (3697, 17, 24.25, 'item3697');
+INSERT INTO items VALUES (3698, 18, 24.50, 'item3698');
+INSERT INTO items VALUES (3699, 19, 24.75, 'item3699');
+INSERT INTO items VALUES (3700, 20, 25.00, 'item3700');
+INSERT INTO items VALUES (3701, 21, 25.25, 'item3701');
+INSERT INTO items VALUES (3702, 22, 25.50, 'item3702');
+INSERT INTO items VALUES (3703, 23, 25.75, 'item3703');
+INSERT INTO items VALUES (3704, 24, 26.00, 'item3704');
+INSERT INTO items VALUES (3705, 25, 26.25, 'item3705');
+INSERT INTO items VALUES (3706, 26, 26.50, 'item3706');
+INSERT INTO items VALUES (3707, 27, 26.75, 'item3707');
+INSERT INTO items VALUES (3708, 28, 27.00, 'item3708');
+INSERT INTO items VALUES (3709, 29, 27.25, 'item3709');
+INSERT INTO items VALUES (3710, 30, 27.50, 'item3710');
+INSERT INTO items VALUES (3711, 31, 27.75, 'item3711');
+INSERT INTO items VALUES (3712, 32, 28.00, 'item3712');
+INSERT INTO items VALUES (3713, 33, 28.25, 'item3713');
+INSERT INTO items VALUES (3714, 34, 28.50, 'item3714');
+INSERT INTO items VALUES (3715, 35, 28.75, 'item3715');
+INSERT INTO items VALUES (3716, 36, 29.00, 'item3716');
+INSERT INTO items VALUES (3717, 37, 29.25, 'item3717');
+INSERT INTO items VALUES (3718, 38, 29.50, 'item3718');
+INSERT INTO items VALUES (3719, 39, 29.75, 'item3719');
+INSERT INTO items VALUES (3720, 0, 30.00, 'item3720');
+INSERT INTO items VALUES (3721, 1, 30.25, 'item3721');
+INSERT INTO items VALUES (3722, 2, 30.50, 'item3722');
+INSERT INTO items VALUES (3723, 3, 30.75, 'item3723');
+INSERT INTO items VALUES (3724, 4, 31.00, 'item3724');
+INSERT INTO items VALUES (3725, 5, 31.25, 'item3725');
+INSERT INTO items VALUES (3726, 6, 31.50, 'item3726');
+INSERT INTO items VALUES (3727, 7, 31.75, 'item3727');
+INSERT INTO items VALUES (3728, 8, 32.00, 'item3728');
+INSERT INTO items VALUES (3729, 9, 32.25, 'item3729');
+INSERT INTO items VALUES (3730, 10, 32.50, 'item3730');
+INSERT INTO items VALUES (3731, 11, 32.75, 'item3731');
+INSERT INTO items VALUES (3732, 12, 33.00, 'item3732');
+INSERT INTO items VALUES (3733, 13, 33.25, 'item3733');
+INSERT INTO items VALUES (3734, 14, 33.50, 'item3734');
+INSERT INTO items VALUES (3735, 15, 33.75, 'item3735');
+INSERT INTO items VALUES (3736, 16, 34.00, 'item3736');
+INSERT INTO items VALUES (3737, 17, 34.25, 'item3737');
+INSERT INTO items VALUES (3738, 18, 34.50, 'item3738');
+INSERT INTO items VALUES (3739, 19, 34.75, 'item3739');
+INSERT INTO items VALUES (3740, 20, 35.00, 'item3740');
+INSERT INTO items VALUES (3741, 21, 35.25, 'item3741');
+INSERT INTO items VALUES (3742, 22, 35.50, 'item3742');
+INSERT INTO items VALUES (3743, 23, 35.75, 'item3743');
+INSERT INTO items VALUES (3744, 24, 36.00, 'item3744');
+INSERT INTO items VALUES (3745, 25, 36.25, 'item3745');
+INSERT INTO items VALUES (3746, 26, 36.50, 'item3746');
+INSERT INTO items VALUES (3747, 27, 36.75, 'item3747');
+INSERT INTO items VALUES (3748, 28, 37.00, 'item3748');
+INSERT INTO items VALUES (3749, 29, 37.25, 'item3749');
+INSERT INTO items VALUES (3750, 30, 37.50, 'item3750');
+INSERT INTO items VALUES (3751, 31, 37.75, 'item3751');
+INSERT INTO items VALUES (3752, 32, 38.00, 'item3752');
+INSERT INTO items VALUES (3753, 33, 38.25, 'item3753');
+INSERT INTO items VALUES (3754, 34, 38.50, 'item3754');
+INSERT INTO items VALUES (3755, 35, 38.75, 'item3755');
+INSERT INTO items VALUES (3756, 36, 39.00, 'item3756');
+INSERT INTO items VALUES (3757, 37, 39.25, 'item3757');
+INSERT INTO items VALUES (3758, 38, 39.50, 'item3758');
+INSERT INTO items VALUES (3759, 39, 39.75, 'item3759');
+INSERT INTO items VALUES (3760, 0, 40.00, 'item3760');
+INSERT INTO items VALUES (3761, 1, 40.25, 'item3761');
+INSERT INTO items VALUES (3762, 2, 40.50, 'item3762');
+INSERT INTO items VALUES (3763, 3, 40.75, 'item3763');
+INSERT INTO items VALUES (3764, 4, 41.00, 'item3764');
+INSERT INTO items VALUES (3765, 5, 41.25, 'item3765');
+INSERT INTO items VALUES (3766, 6, 41.50, 'item3766');
+INSERT INTO items VALUES (3767, 7, 41.75, 'item3767');
+INSERT INTO items VALUES (3768, 8, 42.00, 'item3768');
+INSERT INTO items VALUES (3769, 9, 42.25, 'item3769');
+INSERT INTO items VALUES (3770, 10, 42.50, 'item3770');
+INSERT INTO items VALUES (3771, 11, 42.75, 'item3771');
+INSERT INTO items VALUES (3772, 12, 43.00, 'item3772');
+INSERT INTO items VALUES (3773, 13, 43.25, 'item3773');
+INSERT INTO items VALUES (3774, 14, 43.50, 'item3774');
+INSERT INTO items VALUES (3775, 15, 43.75, 'item3775');
+INSERT INTO items VALUES (3776, 16, 44.00, 'item3776');
+INSERT INTO items VALUES (3777, 17, 44.25, 'item3777');
+INSERT INTO items VALUES (3778, 18, 44.50, 'item3778');
+INSERT INTO items VALUES (3779, 19, 44.75, 'item3779');
+INSERT INTO items VALUES (3780, 20, 45.00, 'item3780');
+INSERT INTO items VALUES (3781, 21, 45.25, 'item3781');
+INSERT INTO items VALUES (3782, 22, 45.50, 'item3782');
+INSERT INTO items VALUES (3783, 23, 45.75, 'item3783');
+INSERT INTO items VALUES (3784, 24, 46.00, 'item3784');
+INSERT INTO items VALUES (3785, 25, 46.25, 'item3785');
+INSERT INTO items VALUES (3786, 26, 46.50, 'item3786');
+INSERT INTO items VALUES (3787, 27, 46.75, 'item3787');
+INSERT INTO items VALUES (3788, 28, 47.00, 'item3788');
+INSERT INTO items VALUES (3789, 29, 47.25, 'item3789');
+INSERT INTO items VALUES (3790, 30, 47.50, 'item3790');
+INSERT INTO items VALUES (3791, 31, 47.75, 'item3791');
+INSERT INTO items VALUES (3792, 32, 48.00, 'item3792');
+INSERT INTO items VALUES (3793, 33, 48.25, 'item3793');
+INSERT INTO items VALUES (3794, 34, 48.50, 'item3794');
+INSERT INTO items VALUES (3795, 35, 48.75, 'item3795');
+INSERT INTO items VALUES (3796, 36, 49.00, 'item3796');
+INSERT INTO items VALUES (3797, 37, 49.25, 'item3797');
+INSERT INTO items VALUES (3798, 38, 49.50, 'item3798');
+INSERT INTO items VALUES (3799, 39, 49.75, 'item3799');
+INSERT INTO items VALUES (3800, 0, 50.00, 'item3800');
+INSERT INTO items VALUES (3801, 1, 50.25, 'item3801');
+INSERT INTO items VALUES (3802, 2, 50.50, 'item3802');
+INSERT INTO items VALUES (3803, 3, 50.75, 'item3803');
+INSERT INTO items VALUES (3804, 4, 51.00, 'item3804');
+INSERT INTO items VALUES (3805, 5, 51.25, 'item3805');
+INSERT INTO items VALUES (3806, 6, 51.50, 'item3806');
+INSERT INTO items VALUES (3807, 7, 51.75, 'item3807');
+INSERT INTO items VALUES (3808, 8, 52.00, 'item3808');
+INSERT INTO items VALUES (3809, 9, 52.25, 'item3809');
+INSERT INTO items VALUES (3810, 10, 52.50, 'item3810');
+INSERT INTO items VALUES (3811, 11, 52.75, 'item3811');
+INSERT INTO items VALUES (3812, 12, 53.00, 'item3812');
+INSERT INTO items VALUES (3813, 13, 53.25, 'item3813');
+INSERT INTO items VALUES (3814, 14, 53.50, 'item3814');
+INSERT INTO items VALUES (3815, 15, 53.75, 'item3815');
+INSERT INTO items VALUES (3816, 16, 54.00, 'item3816');
+INSERT INTO items VALUES (3817, 17, 54.25, 'item3817');
+INSERT INTO items VALUES (3818, 18, 54.50, 'item3818');
+INSERT INTO items VALUES (3819, 19, 54.75, 'item3819');
+INSERT INTO items VALUES (3820, 20, 55.00, 'item3820');
+INSERT INTO items VALUES (3821, 21, 55.25, 'item3821');
+INSERT INTO items VALUES (3822, 22, 55.50, 'item3822');
+INSERT INTO items VALUES (3823, 23, 55.75, 'item3823');
+INSERT INTO items VALUES (3824, 24, 56.00, 'item3824');
+INSERT INTO items VALUES (3825, 25, 56.25, 'item3825');
+INSERT INTO items VALUES (3826, 26, 56.50, 'item3826');
+INSERT INTO items VALUES (3827, 27, 56.75, 'item3827');
+INSERT INTO items VALUES (3828, 28, 57.00, 'item3828');
+INSERT INTO items VALUES (3829, 29, 57.25, 'item3829');
+INSERT INTO items VALUES (3830, 30, 57.50, 'item3830');
+INSERT INTO items VALUES (3831, 31, 57.75, 'item3831');
+INSERT INTO items VALUES (3832, 32, 58.00, 'item3832');
+INSERT INTO items VALUES (3833, 33, 58.25, 'item3833');
+INSERT INTO items VALUES (3834, 34, 58.50, 'item3834');
+INSERT INTO items VALUES (3835, 35, 58.75, 'item3835');
+INSERT INTO items VALUES (3836, 36, 59.00, 'item3836');
+INSERT INTO items VALUES (3837, 37, 59.25, 'item3837');
+INSERT INTO items VALUES (3838, 38, 59.50, 'item3838');
+INSERT INTO items VALUES (3839, 39, 59.75, 'item3839');
+INSERT INTO items VALUES (3840, 0, 60.00, 'item3840');
+INSERT INTO items VALUES (3841, 1, 60.25, 'item3841');
+INSERT INTO items VALUES (3842, 2, 60.50, 'item3842');
+INSERT INTO items VALUES (3843, 3, 60.75, 'item3843');
+INSERT INTO items VALUES (3844, 4, 61.00, 'item3844');
+INSERT INTO items VALUES (3845, 5, 61.25, 'item3845');
+INSERT INTO items VALUES (3846, 6, 61.50, 'item3846');
+INSERT INTO items VALUES (3847, 7, 61.75, 'item3847');
+INSERT INTO items VALUES (3848, 8, 62.00, 'item3848');
+INSERT INTO items VALUES (3849, 9, 62.25, 'item3849');
+INSERT INTO items VALUES (3850, 10, 62.50, 'item3850');
+INSERT INTO items VALUES (3851, 11, 62.75, 'item3851');
+INSERT INTO items VALUES (3852, 12, 63.00, 'item3852');
+INSERT INTO items VALUES (3853, 13, 63.25, 'item3853');
+INSERT INTO items VALUES (3854, 14, 63.50, 'item3854');
+INSERT INTO items VALUES (3855, 15, 63.75, 'item3855');
+INSERT INTO items VALUES (3856, 16, 64.00, 'item3856');
+INSERT INTO items VALUES (3857, 17, 64.25, 'item3857');
+INSERT INTO items VALUES (3858, 18, 64.50, 'item3858');
+INSERT INTO items VALUES (3859, 19, 64.75, 'item3859');
+INSERT INTO items VALUES (3860, 20, 65.00, 'item3860');
+INSERT INTO items VALUES (3861, 21, 65.25, 'item3861');
+INSERT INTO items VALUES (3862, 22, 65.50, 'item3862');
+INSERT INTO items VALUES (3863, 23, 65.75, 'item3863');
+INSERT INTO items VALUES (3864, 24, 66.00, 'item3864');
+INSERT INTO items VALUES (3865, 25, 66.25, 'item3865');
+INSERT INTO items VALUES (3866, 26, 66.50, 'item3866');
+INSERT INTO items VALUES (3867, 27, 66.75, 'item3867');
+INSERT INTO items VALUES (3868, 28, 67.00, 'item3868');
+INSERT INTO items VALUES (3869, 29, 67.25, 'item3869');
+INSERT INTO items VALUES (3870, 30, 67.50, 'item3870');
+INSERT INTO items VALUES (3871, 31, 67.75, 'item3871');
+INSERT INTO items VALUES (3872, 32, 68.00, 'item3872');
+INSERT INTO items VALUES (3873, 33, 68.25, 'item3873');
+INSERT INTO items VALUES (3874, 34, 68.50, 'item3874');
+INSERT INTO items VALUES (3875, 35, 68.75, 'item3875');
+INSERT INTO items VALUES (3876, 36, 69.00, 'item3876');
+INSERT INTO items VALUES (3877, 37, 69.25, 'item3877');
+INSERT INTO items VALUES (3878, 38, 69.50, 'item3878');
+INSERT INTO items VALUES (3879, 39, 69.75, 'item3879');
+INSERT INTO items VALUES (3880, 0, 70.00, 'item3880');
+INSERT INTO items VALUES (3881, 1, 70.25, 'item3881');
+INSERT INTO items VALUES (3882, 2, 70.50, 'item3882');
+INSERT INTO items VALUES (3883, 3, 70.75, 'item3883');
+INSERT INTO items VALUES (3884, 4, 71.00, 'item3884');
+INSERT INTO items VALUES (3885, 5, 71.25, 'item3885');
+INSERT INTO items VALUES (3886, 6, 71.50, 'item3886');
+INSERT INTO items VALUES (3887, 7, 71.75, 'item3887');
+INSERT INTO items VALUES (3888, 8, 72.00, 'item3888');
+INSERT INTO items VALUES (3889, 9, 72.25, 'item3889');
+INSERT INTO items VALUES (3890, 10, 72.50, 'item3890');
+INSERT INTO items VALUES (3891, 11, 72.75, 'item3891');
+INSERT INTO items VALUES (3892, 12, 73.00, 'item3892');
+INSERT INTO items VALUES (3893, 13, 73.25, 'item3893');
+INSERT INTO items VALUES (3894, 14, 73.50, 'item3894');
+INSERT INTO items VALUES (3895, 15, 73.75, 'item3895');
+INSERT INTO items VALUES (3896, 16, 74.00, 'item3896');
+INSERT INTO items VALUES (3897, 17, 74.25, 'item3897');
+INSERT INTO items VALUES (3898, 18, 74.50, 'item3898');
+INSERT INTO items VALUES (3899, 19, 74.75, 'item3899');
+INSERT INTO items VALUES (3900, 20, 75.00, 'item3900');
+INSERT INTO items VALUES (3901, 21, 75.25, 'item3901');
+INSERT INTO items VALUES (3902, 22, 75.50, 'item3902');
+INSERT INTO items VALUES (3903, 23, 75.75, 'item3903');
+INSERT INTO items VALUES (3904, 24, 76.00, 'item3904');
+INSERT INTO items VALUES (3905, 25, 76.25, 'item3905');
+INSERT INTO items VALUES (3906, 26, 76.50, 'item3906');
+INSERT INTO items VALUES (3907, 27, 76.75, 'item3907');
+INSERT INTO items VALUES (3908, 28, 77.00, 'item3908');
+INSERT INTO items VALUES (3909, 29, 77.25, 'item3909');
+INSERT INTO items VALUES (3910, 30, 77.50, 'item3910');
+INSERT INTO items VALUES (3911, 31, 77.75, 'item3911');
+INSERT INTO items VALUES (3912, 32, 78.00, 'item3912');
+INSERT INTO items VALUES (3913, 33, 78.25, 'item3913');
+INSERT INTO items VALUES (3914, 34, 78.50, 'item3914');
+INSERT INTO items VALUES (3915, 35, 78.75, 'item3915');
+INSERT INTO items VALUES (3916, 36, 79.00, 'item3916');
+INSERT INTO items VALUES (3917, 37, 79.25, 'item3917');
+INSERT INTO items VALUES (3918, 38, 79.50, 'item3918');
+INSERT INTO items VALUES (3919, 39, 79.75, 'item3919');
+INSERT INTO items VALUES (3920, 0, 80.00, 'item3920');
+INSERT INTO items VALUES (3921, 1, 80.25, 'item3921');
+INSERT INTO items VALUES (3922, 2, 80.50, 'item3922');
+INSERT INTO items VALUES (3923, 3, 80.75, 'item3923');
+INSERT INTO items VALUES (3924, 4, 81.00, 'item3924');
+INSERT INTO items VALUES (3925, 5, 81.25, 'item3925');
+INSERT INTO items VALUES (3926, 6, 81.50, 'item3926');
+INSERT INTO items VALUES (3927, 7, 81.75, 'item3927');
+INSERT INTO items VALUES (3928, 8, 82.00, 'item3928');
+INSERT INTO items VALUES (3929, 9, 82.25, 'item3929');
+INSERT INTO items VALUES (3930, 10, 82.50, 'item3930');
+INSERT INTO items VALUES (3931, 11, 82.75, 'item3931');
+INSERT INTO items VALUES (3932, 12, 83.00, 'item3932');
+INSERT INTO items VALUES (3933, 13, 83.25, 'item3933');
+INSERT INTO items VALUES (3934, 14, 83.50, 'item3934');
+INSERT INTO items VALUES (3935, 15, 83.75, 'item3935');
+INSERT INTO items VALUES (3936, 16, 84.00, 'item3936');
+INSERT INTO items VALUES (3937, 17, 84.25, 'item3937');
+INSERT INTO items VALUES (3938, 18, 84.50, 'item3938');
+INSERT INTO items VALUES (3939, 19, 84.75, 'item3939');
+INSERT INTO items VALUES (3940, 20, 85.00, 'item3940');
+INSERT INTO items VALUES (3941, 21, 85.25, 'item3941');
+INSERT INTO items VALUES (3942, 22, 85.50, 'item3942');
+INSERT INTO items VALUES (3943, 23, 85.75, 'item3943');
+INSERT INTO items VALUES (3944, 24, 86.00, 'item3944');
+INSERT INTO items VALUES (3945, 25, 86.25, 'item3945');
+INSERT INTO items VALUES (3946, 26, 86.50, 'item3946');
+INSERT INTO items VALUES (3947, 27, 86.75, 'item3947');
+INSERT INTO items VALUES (3948, 28, 87.00, 'item3948');
+INSERT INTO items VALUES (3949, 29, 87.25, 'item3949');
+INSERT INTO items VALUES (3950, 30, 87.50, 'item3950');
+INSERT INTO items VALUES (3951, 31, 87.75, 'item3951');
+INSERT INTO items VALUES (3952, 32, 88.00, 'item3952');
+INSERT INTO items VALUES (3953, 33, 88.25, 'item3953');
+INSERT INTO items VALUES (3954, 34, 88.50, 'item3954');
+INSERT INTO items VALUES (3955, 35, 88.75, 'item3955');
+INSERT INTO items VALUES (3956, 36, 89.00, 'item3956');
+INSERT INTO items VALUES (3957, 37, 89.25, 'item3957');
+INSERT INTO items VALUES (3958, 38, 89.50, 'item3958');
+INSERT INTO items VALUES (3959, 39, 89.75, 'item3959');
+INSERT INTO items VALUES (3960, 0, 90.00, 'item3960');
+INSERT INTO items VALUES (3961, 1, 90.25, 'item3961');
+INSERT INTO items VALUES (3962, 2, 90.50, 'item3962');
+INSERT INTO items VALUES (3963, 3, 90.75, 'item3963');
+INSERT INTO items VALUES (3964, 4, 91.00, 'item3964');
+INSERT INTO items VALUES (3965, 5, 91.25, 'item3965');
+INSERT INTO items VALUES (3966, 6, 91.50, 'item3966');
+INSERT INTO items VALUES (3967, 7, 91.75, 'item3967');
+INSERT INTO items VALUES (3968, 8, 92.00, 'item3968');
+INSERT INTO items VALUES (3969, 9, 92.25, 'item3969');
+INSERT INTO items VALUES (3970, 10, 92.50, 'item3970');
+INSERT INTO items VALUES (3971, 11, 92.75, 'item3971');
+INSERT INTO items VALUES (3972, 12, 93.00, 'item3972');
+INSERT INTO items VALUES (3973, 13, 93.25, 'item3973');
+INSERT INTO items VALUES (3974, 14, 93.50, 'item3974');
+INSERT INTO items VALUES (3975, 15, 93.75, 'item3975');
+INSERT INTO items VALUES (3976, 16, 94.00, 'item3976');
+INSERT INTO items VALUES (3977, 17, 94.25, 'item3977');
+INSERT INTO items VALUES (3978, 18, 94.50, 'item3978');
+INSERT INTO items VALUES (3979, 19, 94.75, 'item3979');
+INSERT INTO items VALUES (3980, 20, 95.00, 'item3980');
+INSERT INTO items VALUES (3981, 21, 95.25, 'item3981');
+INSERT INTO items VALUES (3982, 22, 95.50, 'item3982');
+INSERT INTO items VALUES (3983, 23, 95.75, 'item3983');
+INSERT INTO items VALUES (3984, 24, 96.00, 'item3984');
+INSERT INTO items VALUES (3985, 25, 96.25, 'item3985');
+INSERT INTO items VALUES (3986, 26, 96.50, 'item3986');
+INSERT INTO items VALUES (3987, 27, 96.75, 'item3987');
+INSERT INTO items VALUES (3988, 28, 97.00, 'item3988');
+INSERT INTO items VALUES (3989, 29, 97.25, 'item3989');
+INSERT INTO items VALUES (3990, 30, 97.50, 'item3990');
+INSERT INTO items VALUES (3991, 31, 97.75, 'item3991');
+INSERT INTO items VALUES (3992, 32, 98.00, 'item3992');
+INSERT INTO items VALUES (3993, 33, 98.25, 'item3993');
+INSERT INTO items VALUES (3994, 34, 98.50, 'item3994');
+INSERT INTO items VALUES (3995, 35, 98.75, 'item3995');
+INSERT INTO items VALUES (3996, 36, 99.00, 'item3996');
+INSERT INTO items VALUES (3997, 37, 99.25, 'item3997');
+INSERT INTO items VALUES (3998, 38, 99.50, 'item3998');
+INSERT INTO items VALUES (3999, 39, 99.75, 'item3999');
+INSERT INTO items VALUES (4000, 0, 0.00, 'item4000');
+INSERT INTO items VALUES (4001, 1, 0.25, 'item4001');
+INSERT INTO items VALUES (4002, 2, 0.50, 'item4002');
+INSERT INTO items VALUES (4003, 3, 0.75, 'item4003');
+INSERT INTO items VALUES (4004, 4, 1.00, 'item4004');
+INSERT INTO items VALUES (4005, 5, 1.25, 'item4005');
+INSERT INTO items VALUES (4006, 6, 1.50, 'item4006');
+INSERT INTO items VALUES (4007, 7, 1.75, 'item4007');
+INSERT INTO items VALUES (4008, 8, 2.00, 'item4008');
+INSERT INTO items VALUES (4009, 9, 2.25, 'item4009');
+INSERT INTO items VALUES (4010, 10, 2.50, 'item4010');
+INSERT INTO items VALUES (4011, 11, 2.75, 'item4011');
+INSERT INTO items VALUES (4012, 12, 3.00, 'item4012');
+INSERT INTO items VALUES (4013, 13, 3.25, 'item4013');
+INSERT INTO items VALUES (4014, 14, 3.50, 'item4014');
+INSERT INTO items VALUES (4015, 15, 3.75, 'item4015');
+INSERT INTO items VALUES (4016, 16, 4.00, 'item4016');
+INSERT INTO items VALUES (4017, 17, 4.25, 'item4017');
+INSERT INTO items VALUES (4018, 18, 4.50, 'item4018');
+INSERT INTO items VALUES (4019, 19, 4.75, 'item4019');
+INSERT INTO items VALUES (4020, 20, 5.00, 'item4020');
+INSERT INTO items VALUES (4021, 21, 5.25, 'item4021');
+INSERT INTO items VALUES (4022, 22, 5.50, 'item4022');
+INSERT INTO items VALUES (4023, 23, 5.75, 'item4023');
+INSERT INTO items VALUES (4024, 24, 6.00, 'item4024');
+INSERT INTO items VALUES (4025, 25, 6.25, 'item4025');
+INSERT INTO items VALUES (4026, 26, 6.50, 'item4026');
+INSERT INTO items VALUES (4027, 27, 6.75, 'item4027');
+INSERT INTO items VALUES (4028, 28, 7.00, 'item4028');
+INSERT INTO items VALUES (4029, 29, 7.25, 'item4029');
+INSERT INTO items VALUES (4030, 30, 7.50, 'item4030');
+INSERT INTO items VALUES (4031, 31, 7.75, 'item4031');
+INSERT INTO items VALUES (4032, 32, 8.00, 'item4032');
+INSERT INTO items VALUES (4033, 33, 8.25, 'item4033');
+INSERT INTO items VALUES (4034, 34, 8.50, 'item4034');
+INSERT INTO items VALUES (4035, 35, 8.75, 'item4035');
+INSERT INTO items VALUES (4036, 36, 9.00, 'item4036');
+INSERT INTO items VALUES (4037, 37, 9.25, 'item4037');
+INSERT INTO items VALUES (4038, 38, 9.50, 'item4038');
+INSERT INTO items VALUES (4039, 39, 9.75, 'item4039');
+INSERT INTO items VALUES (4040, 0, 10.00, 'item4040');
+INSERT INTO items VALUES (4041, 1, 10.25, 'item4041');
+INSERT INTO items VALUES (4042, 2, 10.50, 'item4042');
+INSERT INTO items VALUES (4043, 3, 10.75, 'item4043');
+INSERT INTO items VALUES (4044, 4, 11.00, 'item4044');
+INSERT INTO items VALUES (4045, 5, 11.25, 'item4045');
+INSERT INTO items VALUES (4046, 6, 11.50, 'item4046');
+INSERT INTO items VALUES (4047, 7, 11.75, 'item4047');
+INSERT INTO items VALUES (4048, 8, 12.00, 'item4048');
+INSERT INTO items VALUES (4049, 9, 12.25, 'item4049');
+INSERT INTO items VALUES (4050, 10, 12.50, 'item4050');
+INSERT INTO items VALUES (4051, 11, 12.75, 'item4051');
+INSERT INTO items VALUES (4052, 12, 13.00, 'item4052');
+INSERT INTO items VALUES (4053, 13, 13.25, 'item4053');
+INSERT INTO items VALUES (4054, 14, 13.50, 'item4054');
+INSERT INTO items VALUES (4055, 15, 13.75, 'item4055');
+INSERT INTO items VALUES (4056, 16, 14.00, 'item4056');
+INSERT INTO items VALUES (4057, 17, 14.25, 'item4057');
+INSERT INTO items VALUES (4058, 18, 14.50, 'item4058');
+INSERT INTO items VALUES (4059, 19, 14.75, 'item4059');
+INSERT INTO items VALUES (4060, 20, 15.00, 'item4060');
+INSERT INTO items VALUES (4061, 21, 15.25, 'item4061');
+INSERT INTO items VALUES (4062, 22, 15.50, 'item4062');
+INSERT INTO items VALUES (4063, 23, 15.75, 'item4063');
+INSERT INTO items VALUES (4064, 24, 16.00, 'item4064');
+INSERT INTO items VALUES (4065, 25, 16.25, 'item4065');
+INSERT INTO items VALUES (4066, 26, 16.50, 'item4066');
+INSERT INTO items VALUES (4067, 27, 16.75, 'item4067');
+INSERT INTO items VALUES (4068, 28, 17.00, 'item4068');
+INSERT INTO items VALUES (4069, 29, 17.25, 'item4069');
+INSERT INTO items VALUES (4070, 30, 17.50, 'item4070');
+INSERT INTO items VALUES (4071, 31, 17.75, 'item4071');
+INSERT INTO items VALUES (4072, 32, 18.00, 'item4072');
+INSERT INTO items VALUES (4073, 33, 18.25, 'item4073');
+INSERT INTO items VALUES (4074, 34, 18.50, 'item4074');
+INSERT INTO items VALUES (4075, 35, 18.75, 'item4075');
+INSERT INTO items VALUES (4076, 36, 19.00, 'item4076');
+INSERT INTO items VALUES (4077, 37, 19.25, 'item4077');
+INSERT INTO items VALUES (4078, 38, 19.50, 'item4078');
+INSERT INTO items VALUES (4079, 39, 19.75, 'item4079');
+INSERT INTO items VALUES (4080, 0, 20.00, 'item4080');
+INSERT INTO items VALUES (4081, 1, 20.25, 'item4081');
+INSERT INTO items VALUES (4082, 2, 20.50, 'item4082');
+INSERT INTO items VALUES (4083, 3, 20.75, 'item4083');
+INSERT INTO items VALUES (4084, 4, 21.00, 'item4084');
+INSERT INTO items VALUES (4085, 5, 21.25, 'item4085');
+INSERT INTO items VALUES (4086, 6, 21.50, 'item4086');
+INSERT INTO items VALUES (4087, 7, 21.75, 'item4087');
+INSERT INTO items VALUES (4088, 8, 22.00, 'item4088');
+INSERT INTO items VALUES (4089, 9, 22.25, 'item4089');
+INSERT INTO items VALUES (4090, 10, 22.50, 'item4090');
+INSERT INTO items VALUES (4091, 11, 22.75, 'item4091');
+INSERT INTO items VALUES (4092, 12, 23.00, 'item4092');
+INSERT INTO items VALUES (4093, 13, 23.25, 'item4093');
+INSERT INTO items VALUES (4094, 14, 23.50, 'item4094');
+INSERT INTO items VALUES (4095, 15, 23.75, 'item4095');
+INSERT INTO items VALUES (4096, 16, 24.00, 'item4096');
+INSERT INTO items VALUES (4097, 17, 24.25, 'item4097');
+INSERT INTO items VALUES (4098, 18, 24.50, 'item4098');
+INSERT INTO items VALUES (4099, 19, 24.75, 'item4099');
+INSERT INTO items VALUES (4100, 20, 25.00, 'item4100');
+INSERT INTO items VALUES (4101, 21, 25.25, 'item4101');
+INSERT INTO items VALUES (4102, 22, 25.50, 'item4102');
+INSERT INTO items VALUES (4103, 23, 25.75, 'item4103');
+INSERT INTO items VALUES (4104, 24, 26.00, 'item4104');
+INSERT INTO items VALUES (4105, 25, 26.25, 'item4105');
+INSERT INTO items VALUES (4106, 26, 26.50, 'item4106');
+INSERT INTO items VALUES (4107, 27, 26.75, 'item4107');
+INSERT INTO items VALUES (4108, 28, 27.00, 'item4108');
+INSERT INTO items VALUES (4109, 29, 27.25, 'item4109');
+INSERT INTO items VALUES (4110, 30, 27.50, 'item4110');
+INSERT INTO items VALUES (4111, 31, 27.75, 'item4111');
+INSERT INTO items VALUES (4112, 32, 28.00, 'item4112');
+INSERT INTO items VALUES (4113, 33, 28.25, 'item4113');
+INSERT INTO items VALUES (4114, 34, 28.50, 'item4114');
+INSERT INTO items VALUES (4115, 35, 28.75, 'item4115');
+INSERT INTO items VALUES (4116, 36, 29.00, 'item4116');
+INSERT INTO items VALUES (4117, 37, 29.25, 'item4117');
+INSERT INTO items VALUES (4118, 38, 29.50, 'item4118');
+INSERT INTO items VALUES (4119, 39, 29.75, 'item4119');
+INSERT INTO items VALUES (4120, 0, 30.00, 'item4120');
+INSERT INTO items VALUES (4121, 1, 30.25, 'item4121');
+INSERT INTO items VALUES (4122, 2, 30.50, 'item4122');
+INSERT INTO items VALUES (4123, 3, 30.75, 'item4123');
+INSERT INTO items VALUES (4124, 4, 31.00, 'item4124');
+INSERT INTO items VALUES (4125, 5, 31.25, 'item4125');
+INSERT INTO items VALUES (4126, 6, 31.50, 'item4126');
+INSERT INTO items VALUES (4127, 7, 31.75, 'item4127');
+INSERT INTO items VALUES (4128, 8, 32.00, 'item4128');
+INSERT INTO items VALUES (4129, 9, 32.25, 'item4129');
+INSERT INTO items VALUES (4130, 10, 32.50, 'item4130');
+INSERT INTO items VALUES (4131, 11, 32.75, 'item4131');
+INSERT INTO items VALUES (4132, 12, 33.00, 'item4132');
+INSERT INTO items VALUES (4133, 13, 33.25, 'item4133');
+INSERT INTO items VALUES (4134, 14, 33.50, 'item4134');
+INSERT INTO items VALUES (4135, 15, 33.75, 'item4135');
+INSERT INTO items VALUES (4136, 16, 34.00, 'item4136');
+INSERT INTO items VALUES (4137, 17, 34.25, 'item4137');
+INSERT INTO items VALUES (4138, 18, 34.50, 'item4138');
+INSERT INTO items VALUES (4139, 19, 34.75, 'item4139');
+INSERT INTO items VALUES (4140, 20, 35.00, 'item4140');
+INSERT INTO items VALUES (4141, 21, 35.25, 'item4141');
+INSERT INTO items VALUES (4142, 22, 35.50, 'item4142');
+INSERT INTO items VALUES (4143, 23, 35.75, 'item4143');
+INSERT INTO items VALUES (4144, 24, 36.00, 'item4144');
+INSERT INTO items VALUES (4145, 25, 36.25, 'item4145');
+INSERT INTO items VALUES (4146, 26, 36.50, 'item4146');
+INSERT INTO items VALUES (4147, 27, 36.75, 'item4147');
+INSERT INTO items VALUES (4148, 28, 37.00, 'item4148');
+INSERT INTO items VALUES (4149, 29, 37.25, 'item4149');
+INSERT INTO items VALUES (4150, 30, 37.50, 'item4150');
+INSERT INTO items VALUES (4151, 31, 37.75, 'item4151');
+INSERT INTO items VALUES (4152, 32, 38.00, 'item4152');
+INSERT INTO items VALUES (4153, 33, 38.25, 'item4153');
+INSERT INTO items VALUES (4154, 34, 38.50, 'item4154');
+INSERT INTO items VALUES (4155, 35, 38.75, 'item4155');
+INSERT INTO items VALUES (4156, 36, 39.00, 'item4156');
+INSERT INTO items VALUES (4157, 37, 39.25, 'item4157');
+INSERT INTO items VALUES (4158, 38, 39.50, 'item4158');
+INSERT INTO items VALUES (4159, 39, 39.75, 'item4159');
+INSERT INTO items VALUES (4160, 0, 40.00, 'item4160');
+INSERT INTO items VALUES (4161, 1, 40.25, 'item4161');
+INSERT INTO items VALUES (4162, 2, 40.50, 'item4162');
+INSERT INTO items VALUES (4163, 3, 40.75, 'item4163');
+INSERT INTO items VALUES (4164, 4, 41.00, 'item4164');
+INSERT INTO items VALUES (4165, 5, 41.25, 'item4165');
+INSERT INTO items VALUES (4166, 6, 41.50, 'item4166');
+INSERT INTO items VALUES (4167, 7, 41.75, 'item4167');
+INSERT INTO items VALUES (4168, 8, 42.00, 'item4168');
+INSERT INTO items VALUES (4169, 9, 42.25, 'item4169');
+INSERT INTO items VALUES (4170, 10, 42.50, 'item4170');
+INSERT INTO items VALUES (4171, 11, 42.75, 'item4171');
+INSERT INTO items VALUES (4172, 12, 43.00, 'item4172');
+INSERT INTO items VALUES (4173, 13, 43.25, 'item4173');
+INSERT INTO items VALUES (4174, 14, 43.50, 'item4174');
+INSERT INTO items VALUES (4175, 15, 43.75, 'item4175');
+INSERT INTO items VALUES (4176, 16, 44.00, 'item4176');
+INSERT INTO items VALUES (4177, 17, 44.25, 'item4177');
+INSERT INTO items VALUES (4178, 18, 44.50, 'item4178');
+INSERT INTO items VALUES (4179, 19, 44.75, 'item4179');
+INSERT INTO items VALUES (4180, 20, 45.00, 'item4180');
+INSERT INTO items VALUES (4181, 21, 45.25, 'item4181');
+INSERT INTO items VALUES (4182, 22, 45.50, 'item4182');
+INSERT INTO items VALUES (4183, 23, 45.75, 'item4183');
+INSERT INTO items VALUES (4184, 24, 46.00, 'item4184');
+INSERT INTO items VALUES (4185, 25, 46.25, 'item4185');
+INSERT INTO items VALUES (4186, 26, 46.50, 'item4186');
+INSERT INTO items VALUES (4187, 27, 46.75, 'item4187');
+INSERT INTO items VALUES (4188, 28, 47.00, 'item4188');
+INSERT INTO items VALUES (4189, 29, 47.25, 'item4189');
+INSERT INTO items VALUES (4190, 30, 47.50, 'item4190');
+INSERT INTO items VALUES (4191, 31, 47.75, 'item4191');
+INSERT INTO items VALUES (4192, 32, 48.00, 'item4192');
+INSERT INTO items VALUES (4193, 33, 48.25, 'item4193');
+INSERT INTO items VALUES (4194, 34, 48.50, 'item4194');
+INSERT INTO items VALUES (4195, 35, 48.75, 'item4195');
+INSERT INTO items VALUES (4196, 36, 49.00, 'item4196');
+INSERT INTO items VALUES (4197, 37, 49.25, 'item4197');
+INSERT INTO items VALUES (4198, 38, 49.50, 'item4198');
+INSERT INTO items VALUES (4199, 39, 49.75, 'item4199');
+INSERT INTO items VALUES (4200, 0, 50.00, 'item4200');
+INSERT INTO items VALUES (4201, 1, 50.25, 'item4201');
+INSERT INTO items VALUES (4202, 2, 50.50, 'item4202');
+INSERT INTO items VALUES (4203, 3, 50.75, 'item4203');
+INSERT INTO items VALUES (4204, 4, 51.00, 'item4204');
+INSERT INTO items VALUES (4205, 5, 51.25, 'item4205');
+INSERT INTO items VALUES (4206, 6, 51.50, 'item4206');
+INSERT INTO items VALUES (4207, 7, 51.75, 'item4207');
+INSERT INTO items VALUES (4208, 8, 52.00, 'item4208');
+INSERT INTO items VALUES (4209, 9, 52.25, 'item4209');
+INSERT INTO items VALUES (4210, 10, 52.50, 'item4210');
+INSERT INTO items VALUES (4211, 11, 52.75, 'item4211');
+INSERT INTO items VALUES (4212, 12, 53.00, 'item4212');
+INSERT INTO items VALUES (4213, 13, 53.25, 'item4213');
+INSERT INTO items VALUES (4214, 14, 53.50, 'item4214');
+INSERT INTO items VALUES (4215, 15, 53.75, 'item4215');
+INSERT INTO items VALUES (4216, 16, 54.00, 'item4216');
+INSERT INTO items VALUES (4217, 17, 54.25, 'item4217');
+INSERT INTO items VALUES (4218, 18, 54.50, 'item4218');
+INSERT INTO items VALUES (4219, 19, 54.75, 'item4219');
+INSERT INTO items VALUES (4220, 20, 55.00, 'item4220');
+INSERT INTO items VALUES (4221, 21, 55.25, 'item4221');
+INSERT INTO items VALUES (4222, 22, 55.50, 'item4222');
+INSERT INTO items VALUES (4223, 23, 55.75, 'item4223');
+INSERT INTO items VALUES (4224, 24, 56.00, 'item4224');
+INSERT INTO items VALUES (4225, 25, 56.25, 'item4225');
+INSERT INTO items VALUES (4226, 26, 56.50, 'item4226');
+INSERT INTO items VALUES (4227, 27, 56.75, 'item4227');
+INSERT INTO items VALUES (4228, 28, 57.00, 'item4228');
+INSERT INTO items VALUES (4229, 29, 57.25, 'item4229');
+INSERT INTO items VALUES (4230, 30, 57.50, 'item4230');
+INSERT INTO items VALUES (4231, 31, 57.75, 'item4231');
+INSERT INTO items VALUES (4232, 32, 58.00, 'item4232');
+INSERT INTO items VALUES (4233, 33, 58.25, 'item4233');
+INSERT INTO items VALUES (4234, 34, 58.50, 'item4234');
+INSERT INTO items VALUES (4235, 35, 58.75, 'item4235');
+INSERT INTO items VALUES (4236, 36, 59.00, 'item4236');
+INSERT INTO items VALUES (4237, 37, 59.25, 'item4237');
+INSERT INTO items VALUES (4238, 38, 59.50, 'item4238');
+INSERT INTO items VALUES (4239, 39, 59.75, 'item4239');
+INSERT INTO items VALUES (4240, 0, 60.00, 'item4240');
+INSERT INTO items VALUES (4241, 1, 60.25, 'item4241');
+INSERT INTO items VALUES (4242, 2, 60.50, 'item4242');
+INSERT INTO items VALUES (4243, 3, 60.75, 'item4243');
+INSERT INTO items VALUES (4244, 4, 61.00, 'item4244');
+INSERT INTO items VALUES (4245, 5, 61.25, 'item4245');
+INSERT INTO items VALUES (4246, 6, 61.50, 'item4246');
+INSERT INTO items VALUES (4247, 7, 61.75, 'item4247');
+INSERT INTO items VALUES (4248, 8, 62.00, 'item4248');
+INSERT INTO items VALUES (4249, 9, 62.25, 'item4249');
+INSERT INTO items VALUES (4250, 10, 62.50, 'item4250');
+INSERT INTO items VALUES (4251, 11, 62.75, 'item4251');
+INSERT INTO items VALUES (4252, 12, 63.00, 'item4252');
+INSERT INTO items VALUES (4253, 13, 63.25, 'item4253');
+INSERT INTO items VALUES (4254, 14, 63.50, 'item4254');
+INSERT INTO items VALUES (4255, 15, 63.75, 'item4255');
+INSERT INTO items VALUES (4256, 16, 64.00, 'item4256');
+INSERT INTO items VALUES (4257, 17, 64.25, 'item4257');
+INSERT INTO items VALUES (4258, 18, 64.50, 'item4258');
+INSERT INTO items VALUES (4259, 19, 64.75, 'item4259');
+INSERT INTO items VALUES (4260, 20, 65.00, 'item4260');
+INSERT INTO items VALUES (4261, 21, 65.25, 'item4261');
+INSERT INTO items VALUES (4262, 22, 65.50, 'item4262');
+INSERT INTO items VALUES (4263, 23, 65.75, 'item4263');
+INSERT INTO items VALUES (4264, 24, 66.00, 'item4264');
+INSERT INTO items VALUES (4265, 25, 66.25, 'item4265');
+INSERT INTO items VALUES (4266, 26, 66.50, 'item4266');
+INSERT INTO items VALUES (4267, 27, 66.75, 'item4267');
+INSERT INTO items VALUES (4268, 28, 67.00, 'item4268');
+INSERT INTO items VALUES (4269, 29, 67.25, 'item4269');
+INSERT INTO items VALUES (4270, 30, 67.50, 'item4270');
+INSERT INTO items VALUES (4271, 31, 67.75, 'item4271');
+INSERT INTO items VALUES (4272, 32, 68.00, 'item4272');
+INSERT INTO items VALUES (4273, 33, 68.25, 'item4273');
+INSERT INTO items VALUES (4274, 34, 68.50, 'item4274');
+INSERT INTO items VALUES (4275, 35, 68.75, 'item4275');
+INSERT INTO items VALUES (4276, 36, 69.00, 'item4276');
+INSERT INTO items VALUES (4277, 37, 69.25, 'item4277');
+INSERT INTO items VALUES (4278, 38, 69.50, 'item4278');
+INSERT INTO items VALUES (4279, 39, 69.75, 'item4279');
+INSERT INTO items VALUES (4280, 0, 70.00, 'item4280');
+INSERT INTO items VALUES (4281, 1, 70.25, 'item4281');
+INSERT INTO items VALUES (4282, 2, 70.50, 'item4282');
+INSERT INTO items VALUES (4283, 3, 70.75, 'item4283');
+INSERT INTO items VALUES (4284, 4, 71.00, 'item4284');
+INSERT INTO items VALUES (4285, 5, 71.25, 'item4285');
+INSERT INTO items VALUES (4286, 6, 71.50, 'item4286');
+INSERT INTO items VALUES (4287, 7, 71.75, 'item4287');
+INSERT INTO items VALUES (4288, 8, 72.00, 'item4288');
+INSERT INTO items VALUES (4289, 9, 72.25, 'item4289');
+INSERT INTO items VALUES (4290, 10, 72.50, 'item4290');
+INSERT INTO items VALUES (4291, 11, 72.75, 'item4291');
+INSERT INTO items VALUES (4292, 12, 73.00, 'item4292');
+INSERT INTO items VALUES (4293, 13, 73.25, 'item4293');
+INSERT INTO items VALUES (4294, 14, 73.50, 'item4294');
+INSERT INTO items VALUES (4295, 15, 73.75, 'item4295');
+INSERT INTO items VALUES (4296, 16, 74.00, 'item4296');
+INSERT INTO items VALUES (4297, 17, 74.25, 'item4297');
+INSERT INTO items VALUES (4298, 18, 74.50, 'item4298');
+INSERT INTO items VALUES (4299, 19, 74.75, 'item4299');
+INSERT INTO items VALUES (4300, 20, 75.00, 'item4300');
+INSERT INTO items VALUES (4301, 21, 75.25, 'item4301');
+INSERT INTO items VALUES (4302, 22, 75.50, 'item4302');
+INSERT INTO items VALUES (4303, 23, 75.75, 'item4303');
+INSERT INTO items VALUES (4304, 24, 76.00, 'item4304');
+INSERT INTO items VALUES (4305, 25, 76.25, 'item4305');
+INSERT INTO items VALUES (4306, 26, 76.50, 'item4306');
+INSERT INTO items VALUES (4307, 27, 76.75, 'item4307');
+INSERT INTO items VALUES (4308, 28, 77.00, 'item4308');
+INSERT INTO items VALUES (4309, 29, 77.25, 'item4309');
+INSERT INTO items VALUES (4310, 30, 77.50, 'item4310');
+INSERT INTO items VALUES (4311, 31, 77.75, 'item4311');
+INSERT INTO items VALUES (4312, 32, 78.00, 'item4312');
+INSERT INTO items VALUES (4313, 33, 78.25, 'item4313');
+INSERT INTO items VALUES (4314, 34, 78.50, 'item4314');
+INSERT INTO items VALUES (4315, 35, 78.75, 'item4315');
+INSERT INTO items VALUES (4316, 36, 79.00, 'item4316');
+INSERT INTO items VALUES (4317, 37, 79.25, 'item4317');
+INSERT INTO items VALUES (4318, 38, 79.50, 'item4318');
+INSERT INTO items VALUES (4319, 39, 79.75, 'item4319');
+INSERT INTO items VALUES (4320, 0, 80.00, 'item4320');
+INSERT INTO items VALUES (4321, 1, 80.25, 'item4321');
+INSERT INTO items VALUES (4322, 2, 80.50, 'item4322');
+INSERT INTO items VALUES (4323, 3, 80.75, 'item4323');
+INSERT INTO items VALUES (4324, 4, 81.00, 'item4324');
+INSERT INTO items VALUES (4325, 5, 81.25, 'item4325');
+INSERT INTO items VALUES (4326, 6, 81.50, 'item4326');
+INSERT INTO items VALUES (4327, 7, 81.75, 'item4327');
+INSERT INTO items VALUES (4328, 8, 82.00, 'item4328');
+INSERT INTO items VALUES (4329, 9, 82.25, 'item4329');
+INSERT INTO items VALUES (4330, 10, 82.50, 'item4330');
+INSERT INTO items VALUES (4331, 11, 82.75, 'item4331');
+INSERT INTO items VALUES (4332, 12, 83.00, 'item4332');
+INSERT INTO items VALUES (4333, 13, 83.25, 'item4333');
+INSERT INTO items VALUES (4334, 14, 83.50, 'item4334');
+INSERT INTO items VALUES (4335, 15, 83.75, 'item4335');
+INSERT INTO items VALUES (4336, 16, 84.00, 'item4336');
+INSERT INTO items VALUES (4337, 17, 84.25, 'item4337');
+INSERT INTO items VALUES (4338, 18, 84.50, 'item4338');
+INSERT INTO items VALUES (4339, 19, 84.75, 'item4339');
+INSERT INTO items VALUES (4340, 20, 85.00, 'item4340');
+INSERT INTO items VALUES (4341, 21, 85.25, 'item4341');
+INSERT INTO items VALUES (4342, 22, 85.50, 'item4342');
+INSERT INTO items VALUES (4343, 23, 85.75, 'item4343');
+INSERT INTO items VALUES (4344, 24, 86.00, 'item4344');
+INSERT INTO items VALUES (4345, 25, 86.25, 'item4345');
+INSERT INTO items VALUES (4346, 26, 86.50, 'item4346');
+INSERT INTO items VALUES (4347, 27, 86.75, 'item4347');
+INSERT INTO items VALUES (4348, 28, 87.00, 'item4348');
+INSERT INTO items VALUES (4349, 29, 87.25, 'item4349');
+INSERT INTO items VALUES (4350, 30, 87.50, 'item4350');
+INSERT INTO items VALUES (4351, 31, 87.75, 'item4351');
+INSERT INTO items VALUES (4352, 32, 88.00, 'item4352');
+INSERT INTO items VALUES (4353, 33, 88.25, 'item4353');
+INSERT INTO items VALUES (4354, 34, 88.50, 'item4354');
+INSERT INTO items VALUES (4355, 35, 88.75, 'item4355');
+INSERT INTO items VALUES (4356, 36, 89.00, 'item4356');
+INSERT INTO items VALUES (4357, 37, 89.25, 'item4357');
+INSERT INTO items VALUES (4358, 38, 89.50, 'item4358');
+INSERT INTO items VALUES (4359, 39, 89.75, 'item4359');
+INSERT INTO items VALUES (4360, 0, 90.00, 'item4360');
+INSERT INTO items VALUES (4361, 1, 90.25, 'item4361');
+INSERT INTO items VALUES (4362, 2, 90.50, 'item4362');
+INSERT INTO items VALUES (4363, 3, 90.75, 'item4363');
+INSERT INTO items VALUES (4364, 4, 91.00, 'item4364');
+INSERT INTO items VALUES (4365, 5, 91.25, 'item4365');
+INSERT INTO items VALUES (4366, 6, 91.50, 'item4366');
+INSERT INTO items VALUES (4367, 7, 91.75, 'item4367');
+INSERT INTO items VALUES (4368, 8, 92.00, 'item4368');
+INSERT INTO items VALUES (4369, 9, 92.25, 'item4369');
+INSERT INTO items VALUES (4370, 10, 92.50, 'item4370');
+INSERT INTO items VALUES (4371, 11, 92.75, 'item4371');
+INSERT INTO items VALUES (4372, 12, 93.00, 'item4372');
+INSERT INTO items VALUES (4373, 13, 93.25, 'item4373');
+INSERT INTO items VALUES (4374, 14, 93.50, 'item4374');
+INSERT INTO items VALUES (4375, 15, 93.75, 'item4375');
+INSERT INTO items VALUES (4376, 16, 94.00, 'item4376');
+INSERT INTO items VALUES (4377, 17, 94.25, 'item4377');
+INSERT INTO items VALUES (4378, 18, 94.50, 'item4378');
+INSERT INTO items VALUES (4379, 19, 94.75, 'item4379');
+INSERT INTO items VALUES (4380, 20, 95.00, 'item4380');
+INSERT INTO items VALUES (4381, 21, 95.25, 'item4381');
+INSERT INTO items VALUES (4382, 22, 95.50, 'item4382');
+INSERT INTO items VALUES (4383, 23, 95.75, 'item4383');
+INSERT INTO items VALUES (4384, 24, 96.00, 'item4384');
+INSERT INTO items VALUES (4385, 25, 96.25, 'item4385');
+INSERT INTO items VALUES (4386, 26, 96.50, 'item4386');
+INSERT INTO items VALUES (4387, 27, 96.75, 'item4387');
+INSERT INTO items VALUES (4388, 28, 97.00, 'item4388');
+INSERT INTO items VALUES (4389, 29, 97.25, 'item4389');
+INSERT INTO items VALUES (4390, 30, 97.50, 'item4390');
+INSERT INTO items VALUES (4391, 31, 97.75, 'item4391');
+INSERT INTO items VALUES (4392, 32, 98.00, 'item4392');
+INSERT INTO items VALUES (4393, 33, 98.25, 'item4393');
+INSERT INTO items VALUES (4394, 34, 98.50, 'item4394');
+INSERT INTO items VALUES (4395, 35, 98.75, 'item4395');
+INSERT INTO items VALUES (4396, 36, 99.00, 'item4396');
+INSERT INTO items VALUES (4397, 37, 99.25, 'item4397');
+INSERT INTO items VALUES (4398, 38, 99.50, 'item4398');
+INSERT INTO items VALUES (4399, 39, 99.75, 'item4399');
+INSERT INTO items VALUES (4400, 0, 0.00, 'item4400');
+INSERT INTO items VALUES (4401, 1, 0.25, 'item4401');
+INSERT INTO items VALUES (4402, 2, 0.50, 'item4402');
+INSERT INTO items VALUES (4403, 3, 0.75, 'item4403');
+INSERT INTO items VALUES (4404, 4, 1.00, 'item4404');
+INSERT INTO items VALUES (4405, 5, 1.25, 'item4405');
+INSERT INTO items VALUES (4406, 6, 1.50, 'item4406');
+INSERT INTO items VALUES (4407, 7, 1.75, 'item4407');
+INSERT INTO items VALUES (4408, 8, 2.00, 'item4408');
+INSERT INTO items VALUES (4409, 9, 2.25, 'item4409');
+INSERT INTO items VALUES (4410, 10, 2.50, 'item4410');
+INSERT INTO items VALUES (4411, 11, 2.75, 'item4411');
+INSERT INTO items VALUES (4412, 12, 3.00, 'item4412');
+INSERT INTO items VALUES (4413, 13, 3.25, 'item4413');
+INSERT INTO items VALUES (4414, 14, 3.50, 'item4414');
+INSERT INTO items VALUES (4415, 15, 3.75, 'item4415');
+INSERT INTO items VALUES (4416, 16, 4.00, 'item4416');
+INSERT INTO items VALUES (4417, 17, 4.25, 'item4417');
+INSERT INTO items VALUES (4418, 18, 4.50, 'item4418');
+INSERT INTO items VALUES (4419, 19, 4.75, 'item4419');
+INSERT INTO items VALUES (4420, 20, 5.00, 'item4420');
+INSERT INTO items VALUES (4421, 21, 5.25, 'item4421');
+INSERT INTO items VALUES (4422, 22, 5.50, 'item4422');
+INSERT INTO items VALUES (4423, 23, 5.75, 'item4423');
+INSERT INTO items VALUES (4424, 24, 6.00, 'item4424');
+INSERT INTO items VALUES (4425, 25, 6.25, 'item4425');
+INSERT INTO items VALUES (4426, 26, 6.50, 'item4426');
+INSERT INTO items VALUES (4427, 27, 6.75, 'item4427');
+INSERT INTO items VALUES (4428, 28, 7.00, 'item4428');
+INSERT INTO items VALUES (4429, 29, 7.25, 'item4429');
+INSERT INTO items VALUES (4430, 30, 7.50, 'item4430');
+INSERT INTO items VALUES (4431, 31, 7.75, 'item4431');
+INSERT INTO items VALUES (4432, 32, 8.00, 'item4432');
+INSERT INTO items VALUES (4433, 33, 8.25, 'item4433');
+INSERT INTO items VALUES (4434, 34, 8.50, 'item4434');
+INSERT INTO items VALUES (4435, 35, 8.75, 'item4435');
+INSERT INTO items VALUES (4436, 36, 9.00, 'item4436');
+INSERT INTO items VALUES (4437, 37, 9.25, 'item4437');
+INSERT INTO items VALUES (4438, 38, 9.50, 'item4438');
+INSERT INTO items VALUES (4439, 39, 9.75, 'item4439');
+INSERT INTO items VALUES (4440, 0, 10.00, 'item4440');
+INSERT INTO items VALUES (4441, 1, 10.25, 'item4441');
+INSERT INTO items VALUES (4442, 2, 10.50, 'item4442');
+INSERT INTO items VALUES (4443, 3, 10.75, 'item4443');
+INSERT INTO items VALUES (4444, 4, 11.00, 'item4444');
+INSERT INTO items VALUES (4445, 5, 11.25, 'item4445');
+INSERT INTO items VALUES (4446, 6, 11.50, 'item4446');
+INSERT INTO items VALUES (4447, 7, 11.75, 'item4447');
+INSERT INTO items VALUES (4448, 8, 12.00, 'item4448');
+INSERT INTO items VALUES (4449, 9, 12.25, 'item4449');
+INSERT INTO items VALUES (4450, 10, 12.50, 'item4450');
+INSERT INTO items VALUES (4451, 11, 12.75, 'item4451');
+INSERT INTO items VALUES (4452, 12, 13.00, 'item4452');
+INSERT INTO items VALUES (4453, 13, 13.25, 'item4453');
+INSERT INTO items VALUES (4454, 14, 13.50, 'item4454');
+INSERT INTO items VALUES (4455, 15, 13.75, 'item4455');
+INSERT INTO items VALUES (4456, 16, 14.00, 'item4456');
+INSERT INTO items VALUES (4457, 17, 14.25, 'item4457');
+INSERT INTO items VALUES (4458, 18, 14.50, 'item4458');
+INSERT INTO items VALUES (4459, 19, 14.75, 'item4459');
+INSERT INTO items VALUES (4460, 20, 15.00, 'item4460');
+INSERT INTO items VALUES (4461, 21, 15.25, 'item4461');
+INSERT INTO items VALUES (4462, 22, 15.50, 'item4462');
+INSERT INTO items VALUES (4463, 23, 15.75, 'item4463');
+INSERT INTO items VALUES (4464, 24, 16.00, 'item4464');
+INSERT INTO items VALUES (4465, 25, 16.25, 'item4465');
+INSERT INTO items VALUES (4466, 26, 16.50, 'item4466');
+INSERT INTO items VALUES (4467, 27, 16.75, 'item4467');
+INSERT INTO items VALUES (4468, 28, 17.00, 'item4468');
+INSERT INTO items VALUES (4469, 29, 17.25, 'item4469');
+INSERT INTO items VALUES (4470, 30, 17.50, 'item4470');
+INSERT INTO items VALUES (4471, 31, 17.75, 'item4471');
+INSERT INTO items VALUES (4472, 32, 18.00, 'item4472');
+INSERT INTO items VALUES (4473, 33, 18.25, 'item4473');
+INSERT INTO items VALUES (4474, 34, 18.50, 'item4474');
+INSERT INTO items VALUES (4475, 35, 18.75, 'item4475');
+INSERT INTO items VALUES (4476, 36, 19.00, 'item4476');
+INSERT INTO items VALUES (4477, 37, 19.25, 'item4477');
+INSERT INTO items VALUES (4478, 38, 19.50, 'item4478');
+INSERT INTO items VALUES (4479, 39, 19.75, 'item4479');
+INSERT INTO items VALUES (4480, 0, 20.00, 'item4480');
+INSERT INTO items VALUES (4481, 1, 20.25, 'item4481');
+INSERT INTO items VALUES (4482, 2, 20.50, 'item4482');
+INSERT INTO items VALUES (4483, 3, 20.75, 'item4483');
+INSERT INTO items VALUES (4484, 4, 21.00, 'item4484');
+INSERT INTO items VALUES (4485, 5, 21.25, 'item4485');
+INSERT INTO items VALUES (4486, 6, 21.50, 'item4486');
+INSERT INTO items VALUES (4487, 7, 21.75, 'item4487');
+INSERT INTO items VALUES (4488, 8, 22.00, 'item4488');
+INSERT INTO items VALUES (4489, 9, 22.25, 'item4489');
+INSERT INTO items VALUES (4490, 10, 22.50, 'item4490');
+INSERT INTO items VALUES (4491, 11, 22.75, 'item4491');
+INSERT INTO items VALUES (4492, 12, 23.00, 'item4492');
+INSERT INTO items VALUES (4493, 13, 23.25, 'item4493');
+INSERT INTO items VALUES (4494, 14, 23.50, 'item4494');
+INSERT INTO items VALUES (4495, 15, 23.75, 'item4495');
+INSERT INTO items VALUES (4496, 16, 24.00, 'item4496');
+INSERT INTO items VALUES (4497, 17, 24.25, 'item4497');
+INSERT INTO items VALUES (4498, 18, 24.50, 'item4498');
+INSERT INTO items VALUES (4499, 19, 24.75, 'item4499');
+INSERT INTO items VALUES (4500, 20, 25.00, 'item4500');
+INSERT INTO items VALUES (4501, 21, 25.25, 'item4501');
+INSERT INTO items VALUES (4502, 22, 25.50, 'item4502');
+INSERT INTO items VALUES (4503, 23, 25.75, 'item4503');
+INSERT INTO items VALUES (4504, 24, 26.00, 'item4504');
+INSERT INTO items VALUES (4505, 25, 26.25, 'item4505');
+INSERT INTO items VALUES (4506, 26, 26.50, 'item4506');
+INSERT INTO items VALUES (4507, 27, 26.75, 'item4507');
+INSERT INTO items VALUES (4508, 28, 27.00, 'item4508');
+INSERT INTO items VALUES (4509, 29, 27.25, 'item4509');
+INSERT INTO items VALUES (4510, 30, 27.50, 'item4510');
+INSERT INTO items VALUES (4511, 31, 27.75, 'item4511');
+INSERT INTO items VALUES (4512, 32, 28.00, 'item4512');
+INSERT INTO items VALUES (4513, 33, 28.25, 'item4513');
+INSERT INTO items VALUES (4514, 34, 28.50, 'item4514');
+INSERT INTO items VALUES (4515, 35, 28.75, 'item4515');
+INSERT INTO items VALUES (4516, 36, 29.00, 'item4516');
+INSERT INTO items VALUES (4517, 37, 29.25, 'item4517');
+INSERT INTO items VALUES (4518, 38, 29.50, 'item4518');
+INSERT INTO items VALUES (4519, 39, 29.75, 'item4519');
+INSERT INTO items VALUES (4520, 0, 30.00, 'item4520');
+INSERT INTO items VALUES (4521, 1, 30.25, 'item4521');
+INSERT INTO items VALUES (4522, 2, 30.50, 'item4522');
+INSERT INTO items VALUES (4523, 3, 30.75, 'item4523');
+INSERT INTO items VALUES (4524, 4, 31.00, 'item4524');
+INSERT INTO items VALUES (4525, 5, 31.25, 'item4525');
+INSERT INTO items VALUES (4526, 6, 31.50, 'item4526');
+INSERT INTO items VALUES (4527, 7, 31.75, 'item4527');
+INSERT INTO items VALUES (4528, 8, 32.00, 'item4528');
+INSERT INTO items VALUES (4529, 9, 32.25, 'item4529');
+INSERT INTO items VALUES (4530, 10, 32.50, 'item4530');
+INSERT INTO items VALUES (4531, 11, 32.75, 'item4531');
+INSERT INTO items VALUES (4532, 12, 33.00, 'item4532');
+INSERT INTO items VALUES (4533, 13, 33.25, 'item4533');
+INSERT INTO items VALUES (4534, 14, 33.50, 'item4534');
+INSERT INTO items VALUES (4535, 15, 33.75, 'item4535');
+INSERT INTO items VALUES (4536, 16, 34.00, 'item4536');
+INSERT INTO items VALUES (4537, 17, 34.25, 'item4537');
+INSERT INTO items VALUES (4538, 18, 34.50, 'item4538');
+INSERT INTO items VALUES (4539, 19, 34.75, 'item4539');
+INSERT INTO items VALUES (4540, 20, 35.00, 'item4540');
+INSERT INTO items VALUES (4541, 21, 35.25, 'item4541');
+INSERT INTO items VALUES (4542, 22, 35.50, 'item4542');
+INSERT INTO items VALUES (4543, 23, 35.75, 'item4543');
+INSERT INTO items VALUES (4544, 24, 36.00, 'item4544');
+INSERT INTO items VALUES (4545, 25, 36.25, 'item4545');
+INSERT INTO items VALUES (4546, 26, 36.50, 'item4546');
+INSERT INTO items VALUES (4547, 27, 36.75, 'item4547');
+INSERT INTO items VALUES (4548, 28, 37.00, 'item4548');
+INSERT INTO items VALUES (4549, 29, 37.25, 'item4549');
+INSERT INTO items VALUES (4550, 30, 37.50, 'item4550');
+INSERT INTO items VALUES (4551, 31, 37.75, 'item4551');
+INSERT INTO items VALUES (4552, 32, 38.00, 'item4552');
+INSERT INTO items VALUES (4553, 33, 38.25, 'item4553');
+INSERT INTO items VALUES (4554, 34, 38.50, 'item4554');
+INSERT INTO items VALUES (4555, 35, 38.75, 'item4555');
+INSERT INTO items VALUES (4556, 36, 39.00, 'item4556');
+INSERT INTO items VALUES (4557, 37, 39.25, 'item4557');
+INSERT INTO items VALUES (4558, 38, 39.50, 'item4558');
+INSERT INTO items VALUES (4559, 39, 39.75, 'item4559');
+INSERT INTO items VALUES (4560, 0, 40.00, 'item4560');
+INSERT INTO items VALUES (4561, 1, 40.25, 'item4561');
+INSERT INTO items VALUES (4562, 2, 40.50, 'item4562');
+INSERT INTO items VALUES (4563, 3, 40.75, 'item4563');
+INSERT INTO items VALUES (4564, 4, 41.00, 'item4564');
+INSERT INTO items VALUES (4565, 5, 41.25, 'item4565');
+INSERT INTO items VALUES (4566, 6, 41.50, 'item4566');
+INSERT INTO items VALUES (4567, 7, 41.75, 'item4567');
+INSERT INTO items VALUES (4568, 8, 42.00, 'item4568');
+INSERT INTO items VALUES (4569, 9, 42.25, 'item4569');
+INSERT INTO items VALUES (4570, 10, 42.50, 'item4570');
+INSERT INTO items VALUES (4571, 11, 42.75, 'item4571');
+INSERT INTO items VALUES (4572, 12, 43.00, 'item4572');
+INSERT INTO items VALUES (4573, 13, 43.25, 'item4573');
+INSERT INTO items VALUES (4574, 14, 43.50, 'item4574');
+INSERT INTO items VALUES (4575, 15, 43.75, 'item4575');
+INSERT INTO items VALUES (4576, 16, 44.00, 'item4576');
+INSERT INTO items VALUES (4577, 17, 44.25, 'item4577');
+INSERT INTO items VALUES (4578, 18, 44.50, 'item4578');
+INSERT INTO items VALUES (4579, 19, 44.75, 'item4579');
+INSERT INTO items VALUES (4580, 20, 45.00, 'item4580');
+INSERT INTO items VALUES (4581, 21, 45.25, 'item4581');
+INSERT INTO items VALUES (4582, 22, 45.50, 'item4582');
+INSERT INTO items VALUES (4583, 23, 45.75, 'item4583');
+INSERT INTO items VALUES (4584, 24, 46.00, 'item4584');
+INSERT INTO items VALUES (4585, 25, 46.25, 'item4585');
+INSERT INTO items VALUES (4586, 26, 46.50, 'item4586');
+INSERT INTO items VALUES (4587, 27, 46.75, 'item4587');
+INSERT INTO items VALUES (4588, 28, 47.00, 'item4588');
+INSERT INTO items VALUES (4589, 29, 47.25, 'item4589');
+INSERT INTO items VALUES (4590, 30, 47.50, 'item4590');
+INSERT INTO items VALUES (4591, 31, 47.75, 'item4591');
+INSERT INTO items VALUES (4592, 32, 48.00, 'item4592');
+INSERT INTO items VALUES (4593, 33, 48.25, 'item4593');
+INSERT INTO items VALUES (4594, 34, 48.50, 'item4594');
+INSERT INTO items VALUES (4595, 35, 48.75, 'item4595');
+INSERT INTO items VALUES (4596, 36, 49.00, 'item4596');
+INSERT INTO items VALUES (4597, 37, 49.25, 'item4597');
+INSERT INTO items VALUES (4598, 38, 49.50, 'item4598');
+INSERT INTO items VALUES (4599, 39, 49.75, 'item4599');
+INSERT INTO items VALUES (4600, 0, 50.00, 'item4600');
+INSERT INTO items VALUES (4601, 1, 50.25, 'item4601');
+INSERT INTO items VALUES (4602, 2, 50.50, 'item4602');
+INSERT INTO items VALUES (4603, 3, 50.75, 'item4603');
+INSERT INTO items VALUES (4604, 4, 51.00, 'item4604');
+INSERT INTO items VALUES (4605, 5, 51.25, 'item4605');
+INSERT INTO items VALUES (4606, 6, 51.50, 'item4606');
+INSERT INTO items VALUES (4607, 7, 51.75, 'item4607');
+INSERT INTO items VALUES (4608, 8, 52.00, 'item4608');
+INSERT INTO items VALUES (4609, 9, 52.25, 'item4609');
+INSERT INTO items VALUES (4610, 10, 52.50, 'item4610');
+INSERT INTO items VALUES (4611, 11, 52.75, 'item4611');
+INSERT INTO items VALUES (4612, 12, 53.00, 'item4612');
+INSERT INTO items VALUES (4613, 13, 53.25, 'item4613');
+INSERT INTO items VALUES (4614, 14, 53.50, 'item4614');
+INSERT INTO items VALUES (4615, 15, 53.75, 'item4615');
+INSERT INTO items VALUES (4616, 16, 54.00, 'item4616');
+INSERT INTO items VALUES (4617, 17, 54.25, 'item4617');
+INSERT INTO items VALUES (4618, 18, 54.50, 'item4618');
+INSERT INTO items VALUES (4619, 19, 54.75, 'item4619');
+INSERT INTO items VALUES (4620, 20, 55.00, 'item4620');
+INSERT INTO items VALUES (4621, 21, 55.25, 'item4621');
+INSERT INTO items VALUES (4622, 22, 55.50, 'item4622');
+INSERT INTO items VALUES (4623, 23, 55.75, 'item4623');
+INSERT INTO items VALUES (4624, 24, 56.00, 'item4624');
+INSERT INTO items VALUES (4625, 25, 56.25, 'item4625');
+INSERT INTO items VALUES (4626, 26, 56.50, 'item4626');
+INSERT INTO items VALUES (4627, 27, 56.75, 'item4627');
+INSERT INTO items VALUES (4628, 28, 57.00, 'item4628');
+INSERT INTO items VALUES (4629, 29, 57.25, 'item4629');
+INSERT INTO items VALUES (4630, 30, 57.50, 'item4630');
+INSERT INTO items VALUES (4631, 31, 57.75, 'item4631');
+INSERT INTO items VALUES (4632, 32, 58.00, 'item4632');
+INSERT INTO items VALUES (4633, 33, 58.25, 'item4633');
+INSERT INTO items VALUES (4634, 34, 58.50, 'item4634');
+INSERT INTO items VALUES (4635, 35, 58.75, 'item4635');
+INSERT INTO items VALUES (4636, 36, 59.00, 'item4636');
+INSERT INTO items VALUES (4637, 37, 59.25, 'item4637');
+INSERT INTO items VALUES (4638, 38, 59.50, 'item4638');
+INSERT INTO items VALUES (4639, 39, 59.75, 'item4639');
+INSERT INTO items VALUES (4640, 0, 60.00, 'item4640');
+INSERT INTO items VALUES (4641, 1, 60.25, 'item4641');
+INSERT INTO items VALUES (4642, 2, 60.50, 'item4642');
+INSERT INTO items VALUES (4643, 3, 60.75, 'item4643');
+INSERT INTO items VALUES (4644, 4, 61.00, 'item4644');
+INSERT INTO items VALUES (4645, 5, 61.25, 'item4645');
+INSERT INTO items VALUES (4646, 6, 61.50, 'item4646');
+INSERT INTO items VALUES (4647, 7, 61.75, 'item4647');
+INSERT INTO items VALUES (4648, 8, 62.00, 'item4648');
+INSERT INTO items VALUES (4649, 9, 62.25, 'item4649');
+INSERT INTO items VALUES (4650, 10, 62.50, 'item4650');
+INSERT INTO items VALUES (4651, 11, 62.75, 'item4651');
+INSERT INTO items VALUES (4652, 12, 63.00, 'item4652');
+INSERT INTO items VALUES (4653, 13, 63.25, 'item4653');
+INSERT INTO items VALUES (4654, 14, 63.50, 'item4654');
+INSERT INTO items VALUES (4655, 15, 63.75, 'item4655');
+INSERT INTO items VALUES (4656, 16, 64.00, 'item4656');
+INSERT INTO items VALUES (4657, 17, 64.25, 'item4657');
+INSERT INTO items VALUES (4658, 18, 64.50, 'item4658');
+INSERT INTO items VALUES (4659, 19, 64.75, 'item4659');
+INSERT INTO items VALUES (4660, 20, 65.00, 'item4660');
+INSERT INTO items VALUES (4661, 21, 65.25, 'item4661');
+INSERT INTO items VALUES (4662, 22, 65.50, 'item4662');
+INSERT INTO items VALUES (4663, 23, 65.75, 'item4663');
+INSERT INTO items VALUES (4664, 24, 66.00, 'item4664');
+INSERT INTO items VALUES (4665, 25, 66.25, 'item4665');
+INSERT INTO items VALUES (4666, 26, 66.50, 'item4666');
+INSERT INTO items VALUES (4667, 27, 66.75, 'item4667');
+INSERT INTO items VALUES (4668, 28, 67.00, 'item4668');
+INSERT INTO items VALUES (4669, 29, 67.25, 'item4669');
+INSERT INTO items VALUES (4670, 30, 67.50, 'item4670');
+INSERT INTO items VALUES (4671, 31, 67.75, 'item4671');
+INSERT INTO items VALUES (4672, 32, 68.00, 'item4672');
+INSERT INTO items VALUES (4673, 33, 68.25, 'item4673');
+INSERT INTO items VALUES (4674, 34, 68.50, 'item4674');
+INSERT INTO items VALUES (4675, 35, 68.75, 'item4675');
+INSERT INTO items VALUES (4676, 36, 69.00, 'item4676');
+INSERT INTO items VALUES (4677, 37, 69.25, 'item4677');
+INSERT INTO items VALUES (4678, 38, 69.50, 'item4678');
+INSERT INTO items VALUES (4679, 39, 69.75, 'item4679');
+INSERT INTO items VALUES (4680, 0, 70.00, 'item4680');
+INSERT INTO items VALUES (4681, 1, 70.25, 'item4681');
+INSERT INTO items VALUES (4682, 2, 70.50, 'item4682');
+INSERT INTO items VALUES (4683, 3, 70.75, 'item4683');
+INSERT INTO items VALUES (4684, 4, 71.00, 'item4684');
+INSERT INTO items VALUES (4685, 5, 71.25, 'item4685');
+INSERT INTO items VALUES (4686, 6, 71.50, 'item4686');
+INSERT INTO items VALUES (4687, 7, 71.75, 'item4687');
+INSERT INTO items VALUES (4688, 8, 72.00, 'item4688');
+INSERT INTO items VALUES (4689, 9, 72.25, 'item4689');
+INSERT INTO items VALUES (4690, 10, 72.50, 'item4690');
+INSERT INTO items VALUES (4691, 11, 72.75, 'item4691');
+INSERT INTO items VALUES (4692, 12, 73.00, 'item4692');
+INSERT INTO items VALUES (4693, 13, 73.25, 'item4693');
+INSERT INTO items VALUES (4694, 14, 73.50, 'item4694');
+INSERT INTO items VALUES (4695, 15, 73.75, 'item4695');
+INSERT INTO items VALUES (4696, 16, 74.00, 'item4696');
+INSERT INTO items VALUES (4697, 17, 74.25, 'item4697');
+INSERT INTO items VALUES (4698, 18, 74.50, 'item4698');
+INSERT INTO items VALUES (4699, 19, 74.75, 'item4699');
+INSERT INTO items VALUES (4700, 20, 75.00, 'item4700');
+INSERT INTO items VALUES (4701, 21, 75.25, 'item4701');
+INSERT INTO items VALUES (4702, 22, 75.50, 'item4702');
+INSERT INTO items VALUES (4703, 23, 75.75, 'item4703');
+INSERT INTO items VALUES (4704, 24, 76.00, 'item4704');
+INSERT INTO items VALUES (4705, 25, 76.25, 'item4705');
+INSERT INTO items VALUES (4706, 26, 76.50, 'item4706');
+INSERT INTO items VALUES (4707, 27, 76.75, 'item4707');
+INSERT INTO items VALUES (4708, 28, 77.00, 'item4708');
+INSERT INTO items VALUES (4709, 29, 77.25, 'item4709');
+INSERT INTO items VALUES (4710, 30, 77.50, 'item4710');
+INSERT INTO items VALUES (4711, 31, 77.75, 'item4711');
+INSERT INTO items VALUES (4712, 32, 78.00, 'item4712');
+INSERT INTO items VALUES (4713, 33, 78.25, 'item4713');
+INSERT INTO items VALUES (4714, 34, 78.50, 'item4714');
+INSERT INTO items VALUES (4715, 35, 78.75, 'item4715');
+INSERT INTO items VALUES (4716, 36, 79.00, 'item4716');
+INSERT INTO items VALUES (4717, 37, 79.25, 'item4717');
+INSERT INTO items VALUES (4718, 38, 79.50, 'item4718');
+INSERT INTO items VALUES (4719, 39, 79.75, 'item4719');
+INSERT INTO items VALUES (4720, 0, 80.00, 'item4720');
+INSERT INTO items VALUES (4721, 1, 80.25, 'item4721');
+INSERT INTO items VALUES (4722, 2, 80.50, 'item4722');
+INSERT INTO items VALUES (4723, 3, 80.75, 'item4723');
+INSERT INTO items VALUES (4724, 4, 81.00, 'item4724');
+INSERT INTO items VALUES (4725, 5, 81.25, 'item4725');
+INSERT INTO items VALUES (4726, 6, 81.50, 'item4726');
+INSERT INTO items VALUES (4727, 7, 81.75, 'item4727');
+INSERT INTO items VALUES (4728, 8, 82.00, 'item4728');
+INSERT INTO items VALUES (4729, 9, 82.25, 'item4729');
+INSERT INTO items VALUES (4730, 10, 82.50, 'item4730');
+INSERT INTO items VALUES (4731, 11, 82.75, 'item4731');
+INSERT INTO items VALUES (4732, 12, 83.00, 'item4732');
+INSERT INTO items VALUES (4733, 13, 83.25, 'item4733');
+INSERT INTO items VALUES (4734, 14, 83.50, 'item4734');
+INSERT INTO items VALUES (4735, 15, 83.75, 'item4735');
+INSERT INTO items VALUES (4736, 16, 84.00, 'item4736');
+INSERT INTO items VALUES (4737, 17, 84.25, 'item4737');
+INSERT INTO items VALUES (4738, 18, 84.50, 'item4738');
+INSERT INTO items VALUES (4739, 19, 84.75, 'item4739');
+INSERT INTO items VALUES (4740, 20, 85.00, 'item4740');
+INSERT INTO items VALUES (4741, 21, 85.25, 'item4741');
+INSERT INTO items VALUES (4742, 22, 85.50, 'item4742');
+INSERT INTO items VALUES (4743, 23, 85.75, 'item4743');
+INSERT INTO items VALUES (4744, 24, 86.00, 'item4744');
+INSERT INTO items VALUES (4745, 25, 86.25, 'item4745');
+INSERT INTO items VALUES (4746, 26, 86.50, 'item4746');
+INSERT INTO items VALUES (4747, 27, 86.75, 'item4747');
+INSERT INTO items VALUES (4748, 28, 87.00, 'item4748');
+INSERT INTO items VALUES (4749, 29, 87.25, 'item4749');
+INSERT INTO items VALUES (4750, 30, 87.50, 'item4750');
+INSERT INTO items VALUES (4751, 31, 87.75, 'item4751');
+INSERT INTO items VALUES (4752, 32, 88.00, 'item4752');
+INSERT INTO items VALUES (4753, 33, 88.25, 'item4753');
+INSERT INTO items VALUES (4754, 34, 88.50, 'item4754');
+INSERT INTO items VALUES (4755, 35, 88.75, 'item4755');
+INSERT INTO items VALUES (4756, 36, 89.00, 'item4756');
+INSERT INTO items VALUES (4757, 37, 89.25, 'item4757');
+INSERT INTO items VALUES (4758, 38, 89.50, 'item4758');
+INSERT INTO items VALUES (4759, 39, 89.75, 'item4759');
+INSERT INTO items VALUES (4760, 0, 90.00, 'item4760');
+INSERT INTO items VALUES (4761, 1, 90.25, 'item4761');
+INSERT INTO items VALUES (4762, 2, 90.50, 'item4762');
+INSERT INTO items VALUES (4763, 3, 90.75, 'item4763');
+INSERT INTO items VALUES (4764, 4, 91.00, 'item4764');
+INSERT INTO items VALUES (4765, 5, 91.25, 'item4765');
+INSERT INTO items VALUES (4766, 6, 91.50, 'item4766');
+INSERT INTO items VALUES (4767, 7, 91.75, 'item4767');
+INSERT INTO items VALUES (4768, 8, 92.00, 'item4768');
+INSERT INTO items VALUES (4769, 9, 92.25, 'item4769');
+INSERT INTO items VALUES (4770, 10, 92.50, 'item4770');
+INSERT INTO items VALUES (4771, 11, 92.75, 'item4771');
+INSERT INTO items VALUES (4772, 12, 93.00, 'item4772');
+INSERT INTO items VALUES (4773, 13, 93.25, 'item4773');
+INSERT INTO items VALUES (4774, 14, 93.50, 'item4774');
+INSERT INTO items VALUES (4775, 15, 93.75, 'item4775');
+INSERT INTO items VALUES (4776, 16, 94.00, 'item4776');
+INSERT INTO items VALUES (4777, 17, 94.25, 'item4777');
+INSERT INTO items VALUES (4778, 18, 94.50, 'item4778');
+INSERT INTO items VALUES (4779, 19, 94.75, 'item4779');
+INSERT INTO items VALUES (4780, 20, 95.00, 'item4780');
+INSERT INTO items VALUES (4781, 21, 95.25, 'item4781');
+INSERT INTO items VALUES (4782, 22, 95.50, 'item4782');
+INSERT INTO items VALUES (4783, 23, 95.75, 'item4783');
+INSERT INTO items VALUES (4784, 24, 96.00, 'item4784');
+INSERT INTO items VALUES (4785, 25, 96.25, 'item4785');
+INSERT INTO items VALUES (4786, 26, 96.50, 'item4786');
+INSERT INTO items VALUES (4787, 27, 96.75, 'item4787');
+INSERT INTO items VALUES (4788, 28, 97.00, 'item4788');
+INSERT INTO items VALUES (4789, 29, 97.25, 'item4789');
+INSERT INTO items VALUES (4790, 30, 97.50, 'item4790');
+INSERT INTO items VALUES (4791, 31, 97.75, 'item4791');
+INSERT INTO items VALUES (4792, 32, 98.00, 'item4792');
+INSERT INTO items VALUES (4793, 33, 98.25, 'item4793');
+INSERT INTO items VALUES (4794, 34, 98.50, 'item4794');
+INSERT INTO items VALUES (4795, 35, 98.75, 'item4795');
+INSERT INTO items VALUES (4796, 36, 99.00, 'item4796');
+INSERT INTO items VALUES (4797, 37, 99.25, 'item4797');
+INSERT INTO items VALUES (4798, 38, 99.50, 'item4798');
+INSERT INTO items VALUES (4799, 39, 99.75, 'item4799');
+INSERT INTO items VALUES (4800, 0, 0.00, 'item4800');
+INSERT INTO items VALUES (4801, 1, 0.25, 'item4801');
+INSERT INTO items VALUES (4802, 2, 0.50, 'item4802');
+INSERT INTO items VALUES (4803, 3, 0.75, 'item4803');
+INSERT INTO items VALUES (4804, 4, 1.00, 'item4804');
+INSERT INTO items VALUES (4805, 5, 1.25, 'item4805');
+INSERT INTO items VALUES (4806, 6, 1.50, 'item4806');
+INSERT INTO items VALUES (4807, 7, 1.75, 'item4807');
+INSERT INTO items VALUES (4808, 8, 2.00, 'item4808');
+INSERT INTO items VALUES (4809, 9, 2.25, 'item4809');
+INSERT INTO items VALUES (4810, 10, 2.50, 'item4810');
+INSERT INTO items VALUES (4811, 11, 2.75, 'item4811');
+INSERT INTO items VALUES (4812, 12, 3.00, 'item4812');
+INSERT INTO items VALUES (4813, 13, 3.25, 'item4813');
+INSERT INTO items VALUES (4814, 14, 3.50, 'item4814');
+INSERT INTO items VALUES (4815, 15, 3.75, 'item4815');
+INSERT INTO items VALUES (4816, 16, 4.00, 'item4816');
+INSERT INTO items VALUES (4817, 17, 4.25, 'item4817');
+INSERT INTO items VALUES (4818, 18, 4.50, 'item4818');
+INSERT INTO items VALUES (4819, 19, 4.75, 'item4819');
+INSERT INTO items VALUES (4820, 20, 5.00, 'item4820');
+INSERT INTO items VALUES (4821, 21, 5.25, 'item4821');
+INSERT INTO items VALUES (4822, 22, 5.50, 'item4822');
+INSERT INTO items VALUES (4823, 23, 5.75, 'item4823');
+INSERT INTO items VALUES (4824, 24, 6.00, 'item4824');
+INSERT INTO items VALUES (4825, 25, 6.25, 'item4825');
+INSERT INTO items VALUES (4826, 26, 6.50, 'item4826');
+INSERT INTO items VALUES (4827, 27, 6.75, 'item4827');
+INSERT INTO items VALUES (4828, 28, 7.00, 'item4828');
+INSERT INTO items VALUES (4829, 29, 7.25, 'item4829');
+INSERT INTO items VALUES (4830, 30, 7.50, 'item4830');
+INSERT INTO items VALUES (4831, 31, 7.75, 'item4831');
+INSERT INTO items VALUES (4832, 32, 8.00, 'item4832');
+INSERT INTO items VALUES (4833, 33, 8.25, 'item4833');
+INSERT INTO items VALUES (4834, 34, 8.50, 'item4834');
+INSERT INTO items VALUES (4835, 35, 8.75, 'item4835');
+INSERT INTO items VALUES (4836, 36, 9.00, 'item4836');
+INSERT INTO items VALUES (4837, 37, 9.25, 'item4837');
+INSERT INTO items VALUES (4838, 38, 9.50, 'item4838');
+INSERT INTO items VALUES (4839, 39, 9.75, 'item4839');
+INSERT INTO items VALUES (4840, 0, 10.00, 'item4840');
+INSERT INTO items VALUES (4841, 1, 10.25, 'item4841');
+INSERT INTO items VALUES (4842, 2, 10.50, 'item4842');
+INSERT INTO items VALUES (4843, 3, 10.75, 'item4843');
+INSERT INTO items VALUES (4844, 4, 11.00, 'item4844');
+INSERT INTO items VALUES (4845, 5, 11.25, 'item4845');
+INSERT INTO items VALUES (4846, 6, 11.50, 'item4846');
+INSERT INTO items VALUES (4847, 7, 11.75, 'item4847');
+INSERT INTO items VALUES (4848, 8, 12.00, 'item4848');
+INSERT INTO items VALUES (4849, 9, 12.25, 'item4849');
+INSERT INTO items VALUES (4850, 10, 12.50, 'item4850');
+INSERT INTO items VALUES (4851, 11, 12.75, 'item4851');
+INSERT INTO items VALUES (4852, 12, 13.00, 'item4852');
+INSERT INTO items VALUES (4853, 13, 13.25, 'item4853');
+INSERT INTO items VALUES (4854, 14, 13.50, 'item4854');
+INSERT INTO items VALUES (4855, 15, 13.75, 'item4855');
+INSERT INTO items VALUES (4856, 16, 14.00, 'item4856');
+INSERT INTO items VALUES (4857, 17, 14.25, 'item4857');
+INSERT INTO items VALUES (4858, 18, 14.50, 'item4858');
+INSERT INTO items VALUES (4859, 19, 14.75, 'item4859');
+INSERT INTO items VALUES (4860, 20, 15.00, 'item4860');
+INSERT INTO items VALUES (4861, 21, 15.25, 'item4861');
+INSERT INTO items VALUES (4862, 22, 15.50, 'item4862');
+INSERT INTO items VALUES (4863, 23, 15.75, 'item4863');
+INSERT INTO items VALUES (4864, 24, 16.00, 'item4864');
+INSERT INTO items VALUES (4865, 25, 16.25, 'item4865');
+INSERT INTO items VALUES (4866, 26, 16.50, 'item4866');
+INSERT INTO items VALUES (4867, 27, 16.75, 'item4867');
+INSERT INTO items VALUES (4868, 28, 17.00, 'item4868');
+INSERT INTO items VALUES (4869, 29, 17.25, 'item4869');
+INSERT INTO items VALUES (4870, 30, 17.50, 'item4870');
+INSERT INTO items VALUES (4871, 31, 17.75, 'item4871');
+INSERT INTO items VALUES (4872, 32, 18.00, 'item4872');
+INSERT INTO items VALUES (4873, 33, 18.25, 'item4873');
+INSERT INTO items VALUES (4874, 34, 18.50, 'item4874');
+INSERT INTO items VALUES (4875, 35, 18.75, 'item4875');
+INSERT INTO items VALUES (4876, 36, 19.00, 'item4876');
+INSERT INTO items VALUES (4877, 37, 19.25, 'item4877');
+INSERT INTO items VALUES (4878, 38, 19.50, 'item4878');
+INSERT INTO items VALUES (4879, 39, 19.75, 'item4879');
+INSERT INTO items VALUES (4880, 0, 20.00, 'item4880');
+INSERT INTO items VALUES (4881, 1, 20.25, 'item4881');
+INSERT INTO items VALUES (4882, 2, 20.50, 'item4882');
+INSERT INTO items VALUES (4883, 3, 20.75, 'item4883');
+INSERT INTO items VALUES (4884, 4, 21.00, 'item4884');
+INSERT INTO items VALUES (4885, 5, 21.25, 'item4885');
+INSERT INTO items VALUES (4886, 6, 21.50, 'item4886');
+INSERT INTO items VALUES (4887, 7, 21.75, 'item4887');
+INSERT INTO items VALUES (4888, 8, 22.00, 'item4888');
+INSERT INTO items VALUES (4889, 9, 22.25, 'item4889');
+INSERT INTO items VALUES (4890, 10, 22.50, 'item4890');
+INSERT INTO items VALUES (4891, 11, 22.75, 'item4891');
+INSERT INTO items VALUES (4892, 12, 23.00, 'item4892');
+INSERT INTO items VALUES (4893, 13, 23.25, 'item4893');
+INSERT INTO items VALUES (4894, 14, 23.50, 'item4894');
+INSERT INTO items VALUES (4895, 15, 23.75, 'item4895');
+INSERT INTO items VALUES (4896, 16, 24.00, 'item4896');
+INSERT INTO items VALUES (4897, 17, 24.25, 'item4897');
+INSERT INTO items VALUES (4898, 18, 24.50, 'item4898');
+INSERT INTO items VALUES (4899, 19, 24.75, 'item4899');
+INSERT INTO items VALUES (4900, 20, 25.00, 'item4900');
+INSERT INTO items VALUES (4901, 21, 25.25, 'item4901');
+INSERT INTO items VALUES (4902, 22, 25.50, 'item4902');
+INSERT INTO items VALUES (4903, 23, 25.75, 'item4903');
+INSERT INTO items VALUES (4904, 24, 26.00, 'item4904');
+INSERT INTO items VALUES (4905, 25, 26.25, 'item4905');
+INSERT INTO items VALUES (4906, 26, 26.50, 'item4906');
+INSERT INTO items VALUES (4907, 27, 26.75, 'item4907');
+INSERT INTO items VALUES (4908, 28, 27.00, 'item4908');
+INSERT INTO items VALUES (4909, 29, 27.25, 'item4909');
+INSERT INTO items VALUES (4910, 30, 27.50, 'item4910');
+INSERT INTO items VALUES (4911, 31, 27.75, 'item4911');
+INSERT INTO items VALUES (4912, 32, 28.00, 'item4912');
+INSERT INTO items VALUES (4913, 33, 28.25, 'item4913');
+INSERT INTO items VALUES (4914, 34, 28.50, 'item4914');
+INSERT INTO items VALUES (4915, 35, 28.75, 'item4915');
+INSERT INTO items VALUES (4916, 36, 29.00, 'item4916');
+INSERT INTO items VALUES (4917, 37, 29.25, 'item4917');
+INSERT INTO items VALUES (4918, 38, 29.50, 'item4918');
+INSERT INTO items VALUES (4919, 39, 29.75, 'item4919');
+INSERT INTO items VALUES (4920, 0, 30.00, 'item4920');
+INSERT INTO items VALUES (4921, 1, 30.25, 'item4921');
+INSERT INTO items VALUES (4922, 2, 30.50, 'item4922');
+INSERT INTO items VALUES (4923, 3, 30.75, 'item4923');
+INSERT INTO items VALUES (4924, 4, 31.00, 'item4924');
+INSERT INTO items VALUES (4925, 5, 31.25, 'item4925');
+INSERT INTO items VALUES (4926, 6, 31.50, 'item4926');
+INSERT INTO items VALUES (4927, 7, 31.75, 'item4927');
+INSERT INTO items VALUES (4928, 8, 32.00, 'item4928');
+INSERT INTO items VALUES (4929, 9, 32.25, 'item4929');
+INSERT INTO items VALUES (4930, 10, 32.50, 'item4930');
+INSERT INTO items VALUES (4931, 11, 32.75, 'item4931');
+INSERT INTO items VALUES (4932, 12, 33.00, 'item4932');
+INSERT INTO items VALUES (4933, 13, 33.25, 'item4933');
+INSERT INTO items VALUES (4934, 14, 33.50, 'item4934');
+INSERT INTO items VALUES (4935, 15, 33.75, 'item4935');
+INSERT INTO items VALUES (4936, 16, 34.00, 'item4936');
+INSERT INTO items VALUES (4937, 17, 34.25, 'item4937');
+INSERT INTO items VALUES (4938, 18, 34.50, 'item4938');
+INSERT INTO items VALUES (4939, 19, 34.75, 'item4939');
+INSERT INTO items VALUES (4940, 20, 35.00, 'item4940');
+INSERT INTO items VALUES (4941, 21, 35.25, 'item4941');
+INSERT INTO items VALUES (4942, 22, 35.50, 'item4942');
+INSERT INTO items VALUES (4943, 23, 35.75, 'item4943');
+INSERT INTO items VALUES (4944, 24, 36.00, 'item4944');
+INSERT INTO items VALUES (4945, 25, 36.25, 'item4945');
+INSERT INTO items VALUES (4946, 26, 36.50, 'item4946');
+INSERT INTO items VALUES (4947, 27, 36.75, 'item4947');
+INSERT INTO items VALUES (4948, 28, 37.00, 'item4948');
+INSERT INTO items VALUES (4949, 29, 37.25, 'item4949');
+INSERT INTO items VALUES (4950, 30, 37.50, 'item4950');
+INSERT INTO items VALUES (4951, 31, 37.75, 'item4951');
+INSERT INTO items VALUES (4952, 32, 38.00, 'item4952');
+INSERT INTO items VALUES (4953, 33, 38.25, 'item4953');
+INSERT INTO items VALUES (4954, 34, 38.50, 'item4954');
+INSERT INTO items VALUES (4955, 35, 38.75, 'item4955');
+INSERT INTO items VALUES (4956, 36, 39.00, 'item4956');
+INSERT INTO items VALUES (4957, 37, 39.25, 'item4957');
+INSERT INTO items VALUES (4958, 38, 39.50, 'item4958');
+INSERT INTO items VALUES (4959, 39, 39.75, 'item4959');
+INSERT INTO items VALUES (4960, 0, 40.00, 'item4960');
+INSERT INTO items VALUES (4961, 1, 40.25, 'item4961');
+INSERT INTO items VALUES (4962, 2, 40.50, 'item4962');
+INSERT INTO items VALUES (4963, 3, 40.75, 'item4963');
+INSERT INTO items VALUES (4964, 4, 41.00, 'item4964');
+INSERT INTO items VALUES (4965, 5, 41.25, 'item4965');
+INSERT INTO items VALUES (4966, 6, 41.50, 'item4966');
+INSERT INTO items VALUES (4967, 7, 41.75, 'item4967');
+INSERT INTO items VALUES (4968, 8, 42.00, 'item4968');
+INSERT INTO items VALUES (4969, 9, 42.25, 'item4969');
+INSERT INTO items VALUES (4970, 10, 42.50, 'item4970');
+INSERT INTO items VALUES (4971, 11, 42.75, 'item4971');
+INSERT INTO items VALUES (4972, 12, 43.00, 'item4972');
+INSERT INTO items VALUES (4973, 13, 43.25, 'item4973');
+INSERT INTO items VALUES (4974, 14, 43.50, 'item4974');
+INSERT INTO items VALUES (4975, 15, 43.75, 'item4975');
+INSERT INTO items VALUES (4976, 16, 44.00, 'item4976');
+INSERT INTO items VALUES (4977, 17, 44.25, 'item4977');
+INSERT INTO items VALUES (4978, 18, 44.50, 'item4978');
+INSERT INTO items VALUES (4979, 19, 44.75, 'item4979');
+INSERT INTO items VALUES (4980, 20, 45.00, 'item4980');
+INSERT INTO items VALUES (4981, 21, 45.25, 'item4981');
+INSERT INTO items VALUES (4982, 22, 45.50, 'item4982');
+INSERT INTO items VALUES (4983, 23, 45.75, 'item4983');
+INSERT INTO items VALUES (4984, 24, 46.00, 'item4984');
+INSERT INTO items VALUES (4985, 25, 46.25, 'item4985');
+INSERT INTO items VALUES (4986, 26, 46.50, 'item4986');
+INSERT INTO items VALUES (4987, 27, 46.75, 'item4987');
+INSERT INTO items VALUES (4988, 28, 47.00, 'item4988');
+INSERT INTO items VALUES (4989, 29, 47.25, 'item4989');
+INSERT INTO items VALUES (4990, 30, 47.50, 'item4990');
+INSERT INTO items VALUES (4991, 31, 47.75, 'item4991');
+INSERT INTO items VALUES (4992, 32, 48.00, 'item4992');
+INSERT INTO items VALUES (4993, 33, 48.25, 'item4993');
+INSERT INTO items VALUES (4994, 34, 48.50, 'item4994');
+INSERT INTO items VALUES (4995, 35, 48.75, 'item4995');
+INSERT INTO items VALUES (4996, 36, 49.00, 'item4996');
+INSERT INTO items VALUES (4997, 37, 49.25, 'item4997');
+INSERT INTO items VALUES (4998, 38, 49.50, 'item4998');
+INSERT INTO items VALUES (4999, 39, 49.75, 'item4999');
+INSERT INTO items VALUES (5000, 0, 50.00, 'item5000');
+INSERT INTO items VALUES (5001, 1, 50.25, 'item5001');
+INSERT INTO items VALUES (5002, 2, 50.50, 'item5002');
+INSERT INTO items VALUES (5003, 3, 50.75, 'item5003');
+INSERT INTO items VALUES (5004, 4, 51.00, 'item5004');
+INSERT INTO items VALUES (5005, 5, 51.25, 'item5005');
+INSERT INTO items VALUES (5006, 6, 51.50, 'item5006');
+INSERT INTO items VALUES (5007, 7, 51.75, 'item5007');
+INSERT INTO items VALUES (5008, 8, 52.00, 'item5008');
+INSERT INTO items VALUES (5009, 9, 52.25, 'item5009');
+INSERT INTO items VALUES (5010, 10, 52.50, 'item5010');
+INSERT INTO items VALUES (5011, 11, 52.75, 'item5011');
+INSERT INTO items VALUES (5012, 12, 53.00, 'item5012');
+INSERT INTO items VALUES (5013, 13, 53.25, 'item5013');
+INSERT INTO items VALUES (5014, 14, 53.50, 'item5014');
+INSERT INTO items VALUES (5015, 15, 53.75, 'item5015');
+INSERT INTO items VALUES (5016, 16, 54.00, 'item5016');
+INSERT INTO items VALUES (5017, 17, 54.25, 'item5017');
+INSERT INTO items VALUES (5018, 18, 54.50, 'item5018');
+INSERT INTO items VALUES (5019, 19, 54.75, 'item5019');
+INSERT INTO items VALUES (5020, 20, 55.00, 'item5020');
+INSERT INTO items VALUES (5021, 21, 55.25, 'item5021');
+INSERT INTO items VALUES (5022, 22, 55.50, 'item5022');
+INSERT INTO items VALUES (5023, 23, 55.75, 'item5023');
+INSERT INTO items VALUES (5024, 24, 56.00, 'item5024');
+INSERT INTO items VALUES (5025, 25, 56.25, 'item5025');
+INSERT INTO items VALUES (5026, 26, 56.50, 'item5026');
+INSERT INTO items VALUES (5027, 27, 56.75, 'item5027');
+INSERT INTO items VALUES (5028, 28, 57.00, 'item5028');
+INSERT INTO items VALUES (5029, 29, 57.25, 'item5029');
+INSERT INTO items VALUES (5030, 30, 57.50, 'item5030');
+INSERT INTO items VALUES (5031, 31, 57.75, 'item5031');
+INSERT INTO items VALUES (5032, 32, 58.00, 'item5032');
+INSERT INTO items VALUES (5033, 33, 58.25, 'item5033');
+INSERT INTO items VALUES (5034, 34, 58.50, 'item5034');
+INSERT INTO items VALUES (5035, 35, 58.75, 'item5035');
+INSERT INTO items VALUES (5036, 36, 59.00, 'item5036');
+INSERT INTO items VALUES (5037, 37, 59.25, 'item5037');
+INSERT INTO items VALUES (5038, 38, 59.50, 'item5038');
+INSERT INTO items VALUES (5039, 39, 59.75, 'item5039');
+INSERT INTO items VALUES (5040, 0, 60.00, 'item5040');
+INSERT INTO items VALUES (5041, 1, 60.25, 'item5041');
+INSERT INTO items VALUES (5042, 2, 60.50, 'item5042');
+INSERT INTO items VALUES (5043, 3, 60.75, 'item5043');
+INSERT INTO items VALUES (5044, 4, 61.00, 'item5044');
+INSERT INTO items VALUES (5045, 5, 61.25, 'item5045');
+INSERT INTO items VALUES (5046, 6, 61.50, 'item5046');
+INSERT INTO items VALUES (5047, 7, 61.75, 'item5047');
+INSERT INTO items VALUES (5048, 8, 62.00, 'item5048');
+INSERT INTO items VALUES (5049, 9, 62.25, 'item5049');
+INSERT INTO items VALUES (5050, 10, 62.50, 'item5050');
+INSERT INTO items VALUES (5051, 11, 62.75, 'item5051');
+INSERT INTO items VALUES (5052, 12, 63.00, 'item5052');
+INSERT INTO items VALUES (5053, 13, 63.25, 'item5053');
+INSERT INTO items VALUES (5054, 14, 63.50, 'item5054');
+INSERT INTO items VALUES (5055, 15, 63.75, 'item5055');
+INSERT INTO items VALUES (5056, 16, 64.00, 'item5056');
+INSERT INTO items VALUES (5057, 17, 64.25, 'item5057');
+INSERT INTO items VALUES (5058, 18, 64.50, 'item5058');
+INSERT INTO items VALUES (5059, 19, 64.75, 'item5059');
+INSERT INTO items VALUES (5060, 20, 65.00, 'item5060');
+INSERT INTO items VALUES (5061, 21, 65.25, 'item5061');
+INSERT INTO items VALUES (5062, 22, 65.50, 'item5062');
+INSERT INTO items VALUES (5063, 23, 65.75, 'item5063');
+INSERT INTO items VALUES (5064, 24, 66.00, 'item5064');
+INSERT INTO items VALUES (5065, 25, 66.25, 'item5065');
+INSERT INTO items VALUES (5066, 26, 66.50, 'item5066');
+INSERT INTO items VALUES (5067, 27, 66.75, 'item5067');
+INSERT INTO items VALUES (5068, 28, 67.00, 'item5068');
+INSERT INTO items VALUES (5069, 29, 67.25, 'item5069');
+INSERT INTO items VALUES (5070, 30, 67.50, 'item5070');
+INSERT INTO items VALUES (5071, 31, 67.75, 'item5071');
+INSERT INTO items VALUES (5072, 32, 68.00, 'item5072');
+INSERT INTO items VALUES (5073, 33, 68.25, 'item5073');
+INSERT INTO items VALUES (5074, 34, 68.50, 'item5074');
+INSERT INTO items VALUES (5075, 35, 68.75, 'item5075');
+INSERT INTO items VALUES (5076, 36, 69.00, 'item5076');
+INSERT INTO items VALUES (5077, 37, 69.25, 'item5077');
+INSERT INTO items VALUES (5078, 38, 69.50, 'item5078');
+INSERT INTO items VALUES (5079, 39, 69.75, 'item5079');
+INSERT INTO items VALUES (5080, 0, 70.00, 'item5080');
+INSERT INTO items VALUES (5081, 1, 70.25, 'item5081');
+INSERT INTO items VALUES (5082, 2, 70.50, 'item5082');
+INSERT INTO items VALUES (5083, 3, 70.75, 'item5083');
+INSERT INTO items VALUES (5084, 4, 71.00, 'item5084');
+INSERT INTO items VALUES (5085, 5, 71.25, 'item5085');
+INSERT INTO items VALUES (5086, 6, 71.50, 'item5086');
+INSERT INTO items VALUES (5087, 7, 71.75, 'item5087');
+INSERT INTO items VALUES (5088, 8, 72.00, 'item5088');
+INSERT INTO items VALUES (5089, 9, 72.25, 'item5089');
+INSERT INTO items VALUES (5090, 10, 72.50, 'item5090');
+INSERT INTO items VALUES (5091, 11, 72.75, 'item5091');
+INSERT INTO items VALUES (5092, 12, 73.00, 'item5092');
+INSERT INTO items VALUES (5093, 13, 73.25, 'item5093');
+INSERT INTO items VALUES (5094, 14, 73.50, 'item5094');
+INSERT INTO items VALUES (5095, 15, 73.75, 'item5095');
+INSERT INTO items VALUES (5096, 16, 74.00, 'item5096');
+INSERT INTO items VALUES (5097, 17, 74.25, 'item5097');
+INSERT INTO items VALUES (5098, 18, 74.50, 'item5098');
+INSERT INTO items VALUES (5099, 19, 74.75, 'item5099');
+INSERT INTO items VALUES (5100, 20, 75.00, 'item5100');
+INSERT INTO items VALUES (5101, 21, 75.25, 'item5101');
+INSERT INTO items VALUES (5102, 22, 75.50, 'item5102');
+INSERT INTO items VALUES (5103, 23, 75.75, 'item5103');
+INSERT INTO items VALUES (5104, 24, 76.00, 'item5104');
+INSERT INTO items VALUES (5105, 25, 76.25, 'item5105');
+INSERT INTO items VALUES (5106, 26, 76.50, 'item5106');
+INSERT INTO items VALUES (5107, 27, 76.75, 'item5107');
+INSERT INTO items VALUES (5108, 28, 77.00, 'item5108');
+INSERT INTO items VALUES (5109, 29, 77.25, 'item5109');
+INSERT INTO items VALUES (5110, 30, 77.50, 'item5110');
+INSERT INTO items VALUES (5111, 31, 77.75, 'item5111');
+INSERT INTO items VALUES (5112, 32, 78.00, 'item5112');
+INSERT INTO items VALUES (5113, 33, 78.25, 'item5113');
+INSERT INTO items VALUES (5114, 34, 78.50, 'item5114');
+INSERT INTO items VALUES (5115, 35, 78.75, 'item5115');
+INSERT INTO items VALUES (5116, 36, 79.00, 'item5116');
+INSERT INTO items VALUES (5117, 37, 79.25, 'item5117');
+INSERT INTO items VALUES (5118, 38, 79.50, 'item5118');
+INSERT INTO items VALUES (5119, 39, 79.75, 'item5119');
+INSERT INTO items VALUES (5120, 0, 80.00, 'item5120');
+INSERT INTO items VALUES (5121, 1, 80.25, 'item5121');
+INSERT INTO items VALUES (5122, 2, 80.50, 'item5122');
+INSERT INTO items VALUES (5123, 3, 80.75, 'item5123');
+INSERT INTO items VALUES (5124, 4, 81.00, 'item5124');
+INSERT INTO items VALUES (5125, 5, 81.25, 'item5125');
+INSERT INTO items VALUES (5126, 6, 81.50, 'item5126');
+INSERT INTO items VALUES (5127, 7, 81.75, 'item5127');
+INSERT INTO items VALUES (5128, 8, 82.00, 'item5128');
+INSERT INTO items VALUES (5129, 9, 82.25, 'item5129');
+INSERT INTO items VALUES (5130, 10, 82.50, 'item5130');
+INSERT INTO items VALUES (5131, 11, 82.75, 'item5131');
+INSERT INTO items VALUES (5132, 12, 83.00, 'item5132');
+INSERT INTO items VALUES (5133, 13, 83.25, 'item5133');
+INSERT INTO items VALUES (5134, 14, 83.50, 'item5134');
+INSERT INTO items VALUES (5135, 15, 83.75, 'item5135');
+INSERT INTO items VALUES (5136, 16, 84.00, 'item5136');
+INSERT INTO items VALUES (5137, 17, 84.25, 'item5137');
+INSERT INTO items VALUES (5138, 18, 84.50, 'item5138');
+INSERT INTO items VALUES (5139, 19, 84.75, 'item5139');
+INSERT INTO items VALUES (5140, 20, 85.00, 'item5140');
+INSERT INTO items VALUES (5141, 21, 85.25, 'item5141');
+INSERT INTO items VALUES (5142, 22, 85.50, 'item5142');
+INSERT INTO items VALUES (5143, 23, 85.75, 'item5143');
+INSERT INTO items VALUES (5144, 24, 86.00, 'item5144');
+INSERT INTO items VALUES (5145, 25, 86.25, 'item5145');
+INSERT INTO items VALUES (5146, 26, 86.50, 'item5146');
+INSERT INTO items VALUES (5147, 27, 86.75, 'item5147');
+INSERT INTO items VALUES (5148, 28, 87.00, 'item5148');
+INSERT INTO items VALUES (5149, 29, 87.25, 'item5149');
+INSERT INTO items VALUES (5150, 30, 87.50, 'item5150');
+INSERT INTO items VALUES (5151, 31, 87.75, 'item5151');
+INSERT INTO items VALUES (5152, 32, 88.00, 'item5152');
+INSERT INTO items VALUES (5153, 33, 88.25, 'item5153');
+INSERT INTO items VALUES (5154, 34, 88.50, 'item5154');
+INSERT INTO items VALUES (5155, 35, 88.75, 'item5155');
+INSERT INTO items VALUES (5156, 36, 89.00, 'item5156');
+INSERT INTO items VALUES (5157, 37, 89.25, 'item5157');
+INSERT INTO items VALUES (5158, 38, 89.50, 'item5158');
+INSERT INTO items VALUES (5159, 39, 89.75, 'item5159');
+INSERT INTO items VALUES (5160, 0, 90.00, 'item5160');
+INSERT INTO items VALUES (5161, 1, 90.25, 'item5161');
+INSERT INTO items VALUES (5162, 2, 90.50, 'item5162');
+INSERT INTO items VALUES (5163, 3, 90.75, 'item5163');
+INSERT INTO items VALUES (5164, 4, 91.00, 'item5164');
+INSERT INTO items VALUES (5165, 5, 91.25, 'item5165');
+INSERT INTO items VALUES (5166, 6, 91.50, 'item5166');
+INSERT INTO items VALUES (5167, 7, 91.75, 'item5167');
+INSERT INTO items VALUES (5168, 8, 92.00, 'item5168');
+INSERT INTO items VALUES (5169, 9, 92.25, 'item5169');
+INSERT INTO items VALUES (5170, 10, 92.50, 'item5170');
+INSERT INTO items VALUES (5171, 11, 92.75, 'item5171');
+INSERT INTO items VALUES (5172, 12, 93.00, 'item5172');
+INSERT INTO items VALUES (5173, 13, 93.25, 'item5173');
+INSERT INTO items VALUES (5174, 14, 93.50, 'item5174');
+INSERT INTO items VALUES (5175, 15, 93.75, 'item5175');
+INSERT INTO items VALUES (5176, 16, 94.00, 'item5176');
+INSERT INTO items VALUES (5177, 17, 94.25, 'item5177');
+INSERT INTO items VALUES (5178, 18, 94.50, 'item5178');
+INSERT INTO items VALUES (5179, 19, 94.75, 'item5179');
+INSERT INTO items VALUES (5180, 20, 95.00, 'item5180');
+INSERT INTO items VALUES (5181, 21, 95.25, 'item5181');
+INSERT INTO items VALUES (5182, 22, 95.50, 'item5182');
+INSERT INTO items VALUES (5183, 23, 95.75, 'item5183');
+INSERT INTO items VALUES (5184, 24, 96.00, 'item5184');
+INSERT INTO items VALUES (5185, 25, 96.25, 'item5185');
+INSERT INTO items VALUES (5186, 26, 96.50, 'item5186');
+INSERT INTO items VALUES (5187, 27, 96.75, 'item5187');
+INSERT INTO items VALUES (5188, 28, 97.00, 'item5188');
+INSERT INTO items VALUES (5189, 29, 97.25, 'item5189');
+INSERT INTO items VALUES (5190, 30, 97.50, 'item5190');
+INSERT INTO items VALUES (5191, 31, 97.75, 'item5191');
+INSERT INTO items VALUES (5192, 32, 98.00, 'item5192');
+INSERT INTO items VALUES (5193, 33, 98.25, 'item5193');
+INSERT INTO items VALUES (5194, 34, 98.50, 'item5194');
+INSERT INTO items VALUES (5195, 35, 98.75, 'item5195');
+INSERT INTO items VALUES (5196, 36, 99.00, 'item5196');
+INSERT INTO items VALUES (5197, 37, 99.25, 'item5197');
+INSERT INTO items VALUES (5198, 38, 99.50, 'item5198');
+INSERT INTO items VALUES (5199, 39, 99.75, 'item5199');
+INSERT INTO items VALUES (5200, 0, 0.00, 'item5200');
+INSERT INTO items VALUES (5201, 1, 0.25, 'item5201');
+INSERT INTO items VALUES (5202, 2, 0.50, 'item5202');
+INSERT INTO items VALUES (5203, 3, 0.75, 'item5203');
+INSERT INTO items VALUES (5204, 4, 1.00, 'item5204');
+INSERT INTO items VALUES (5205, 5, 1.25, 'item5205');
+INSERT INTO items VALUES (5206, 6, 1.50, 'item5206');
+INSERT INTO items VALUES (5207, 7, 1.75, 'item5207');
+INSERT INTO items VALUES (5208, 8, 2.00, 'item5208');
+INSERT INTO items VALUES (5209, 9, 2.25, 'item5209');
+INSERT INTO items VALUES (5210, 10, 2.50, 'item5210');
+INSERT INTO items VALUES (5211, 11, 2.75, 'item5211');
+INSERT INTO items VALUES (5212, 12, 3.00, 'item5212');
+INSERT INTO items VALUES (5213, 13, 3.25, 'item5213');
+INSERT INTO items VALUES (5214, 14, 3.50, 'item5214');
+INSERT INTO items VALUES (5215, 15, 3.75, 'item5215');
+INSERT INTO items VALUES (5216, 16, 4.00, 'item5216');
+INSERT INTO items VALUES (5217, 17, 4.25, 'item5217');
+INSERT INTO items VALUES (5218, 18, 4.50, 'item5218');
+INSERT INTO items VALUES (5219, 19, 4.75, 'item5219');
+INSERT INTO items VALUES (5220, 20, 5.00, 'item5220');
+INSERT INTO items VALUES (5221, 21, 5.25, 'item5221');
+INSERT INTO items VALUES (5222, 22, 5.50, 'item5222');
+INSERT INTO items VALUES (5223, 23, 5.75, 'item5223');
+INSERT INTO items VALUES (5224, 24, 6.00, 'item5224');
+INSERT INTO items VALUES (5225, 25, 6.25, 'item5225');
+INSERT INTO items VALUES (5226, 26, 6.50, 'item5226');
+INSERT INTO items VALUES (5227, 27, 6.75, 'item5227');
+INSERT INTO items VALUES (5228, 28, 7.00, 'item5228');
+INSERT INTO items VALUES (5229, 29, 7.25, 'item5229');
+INSERT INTO items VALUES (5230, 30, 7.50, 'item5230');
+INSERT INTO items VALUES (5231, 31, 7.75, 'item5231');
+INSERT INTO items VALUES (5232, 32, 8.00, 'item5232');
+INSERT INTO items VALUES (5233, 33, 8.25, 'item5233');
+INSERT INTO items VALUES (5234, 34, 8.50, 'item5234');
+INSERT INTO items VALUES (5235, 35, 8.75, 'item5235');
+INSERT INTO items VALUES (5236, 36, 9.00, 'item5236');
+INSERT INTO items VALUES (5237, 37, 9.25, 'item5237');
+INSERT INTO items VALUES (5238, 38, 9.50, 'item5238');
+INSERT INTO items VALUES (5239, 39, 9.75, 'item5239');
+INSERT INTO items VALUES (5240, 0, 10.00, 'item5240');
+INSERT INTO items VALUES (5241, 1, 10.25, 'item5241');
+INSERT INTO items VALUES (5242, 2, 10.50, 'item5242');
+INSERT INTO items VALUES (5243, 3, 10.75, 'item5243');
+INSERT INTO items VALUES (5244, 4, 11.00, 'item5244');
+INSERT INTO items VALUES (5245, 5, 11.25, 'item5245');
+INSERT INTO items VALUES (5246, 6, 11.50, 'item5246');
+INSERT INTO items VALUES (5247, 7, 11.75, 'item5247');
+INSERT INTO items VALUES (5248, 8, 12.00, 'item5248');
+INSERT INTO items VALUES (5249, 9, 12.25, 'item5249');
+INSERT INTO items VALUES (5250, 10, 12.50, 'item5250');
+INSERT INTO items VALUES (5251, 11, 12.75, 'item5251');
+INSERT INTO items VALUES (5252, 12, 13.00, 'item5252');
+INSERT INTO items VALUES (5253, 13, 13.25, 'item5253');
+INSERT INTO items VALUES (5254, 14, 13.50, 'item5254');
+INSERT INTO items VALUES (5255, 15, 13.75, 'item5255');
+INSERT INTO items VALUES (5256, 16, 14.00, 'item5256');
+INSERT INTO items VALUES (5257, 17, 14.25, 'item5257');
+INSERT INTO items VALUES (5258, 18, 14.50, 'item5258');
+INSERT INTO items VALUES (5259, 19, 14.75, 'item5259');
+INSERT INTO items VALUES (5260, 20, 15.00, 'item5260');
+INSERT INTO items VALUES (5261, 21, 15.25, 'item5261');
+INSERT INTO items VALUES (5262, 22, 15.50, 'item5262');
+INSERT INTO items VALUES (5263, 23, 15.75, 'item5263');
+INSERT INTO items VALUES (5264, 24, 16.00, 'item5264');
+INSERT INTO items VALUES (5265, 25, 16.25, 'item5265');
+INSERT INTO items VALUES (5266, 26, 16.50, 'item5266');
+INSERT INTO items VALUES (5267, 27, 16.75, 'item5267');
+INSERT INTO items VALUES (5268, 28, 17.00, 'item5268');
+INSERT INTO items VALUES (5269, 29, 17.25, 'item5269');
+INSERT INTO items VALUES (5270, 30, 17.50, 'item5270');
+INSERT INTO items VALUES (5271, 31, 17.75, 'item5271');
+INSERT INTO items VALUES (5272, 32, 18.00, 'item5272');
+INSERT INTO items VALUES (5273, 33, 18.25, 'item5273');
+INSERT INTO items VALUES (5274, 34, 18.50, 'item5274');
+INSERT INTO items VALUES (5275, 35, 18.75, 'item5275');
+INSERT INTO items VALUES (5276, 36, 19.00, 'item5276');
+INSERT INTO items VALUES (5277, 37, 19.25, 'item5277');
+INSERT INTO items VALUES (5278, 38, 19.50, 'item5278');
+INSERT INTO items VALUES (5279, 39, 19.75, 'item5279');
+INSERT INTO items VALUES (5280, 0, 20.00, 'item5280');
+INSERT INTO items VALUES (5281, 1, 20.25, 'item5281');
+INSERT INTO items VALUES (5282, 2, 20.50, 'item5282');
+INSERT INTO items VALUES (5283, 3, 20.75, 'item5283');
+INSERT INTO items VALUES (5284, 4, 21.00, 'item5284');
+INSERT INTO items VALUES (5285, 5, 21.25, 'item5285');
+INSERT INTO items VALUES (5286, 6, 21.50, 'item5286');
+INSERT INTO items VALUES (5287, 7, 21.75, 'item5287');
+INSERT INTO items VALUES (5288, 8, 22.00, 'item5288');
+INSERT INTO items VALUES (5289, 9, 22.25, 'item5289');
+INSERT INTO items VALUES (5290, 10, 22.50, 'item5290');
+INSERT INTO items VALUES (5291, 11, 22.75, 'item5291');
+INSERT INTO items VALUES (5292, 12, 23.00, 'item5292');
+INSERT INTO items VALUES (5293, 13, 23.25, 'item5293');
+INSERT INTO items VALUES (5294, 14, 23.50, 'item5294');
+INSERT INTO items VALUES (5295, 15, 23.75, 'item5295');
+INSERT INTO items VALUES (5296, 16, 24.00, 'item5296');
+INSERT INTO items VALUES (5297, 17, 24.25, 'item5297');
+INSERT INTO items VALUES (5298, 18, 24.50, 'item5298');
+INSERT INTO items VALUES (5299, 19, 24.75, 'item5299');
+INSERT INTO items VALUES (5300, 20, 25.00, 'item5300');
+INSERT INTO items VALUES (5301, 21, 25.25, 'item5301');
+INSERT INTO items VALUES (5302, 22, 25.50, 'item5302');
+INSERT INTO items VALUES (5303, 23, 25.75, 'item5303');
+INSERT INTO items VALUES (5304, 24, 26.00, 'item5304');
+INSERT INTO items VALUES (5305, 25, 26.25, 'item5305');
+INSERT INTO items VALUES (5306, 26, 26.50, 'item5306');
+INSERT INTO items VALUES (5307, 27, 26.75, 'item5307');
+INSERT INTO items VALUES (5308, 28, 27.00, 'item5308');
+INSERT INTO items VALUES (5309, 29, 27.25, 'item5309');
+INSERT INTO items VALUES (5310, 30, 27.50, 'item5310');
+INSERT INTO items VALUES (5311, 31, 27.75, 'item5311');
+INSERT INTO items VALUES (5312, 32, 28.00, 'item5312');
+INSERT INTO items VALUES (5313, 33, 28.25, 'item5313');
+INSERT INTO items VALUES (5314, 34, 28.50, 'item5314');
+INSERT INTO items VALUES (5315, 35, 28.75, 'item5315');
+INSERT INTO items VALUES (5316, 36, 29.00, 'item5316');
+INSERT INTO items VALUES (5317, 37, 29.25, 'item5317');
+INSERT INTO items VALUES (5318, 38, 29.50, 'item5318');
+INSERT INTO items VALUES (5319, 39, 29.75, 'item5319');
+INSERT INTO items VALUES (5320, 0, 30.00, 'item5320');
+INSERT INTO items VALUES (5321, 1, 30.25, 'item5321');
+INSERT INTO items VALUES (5322, 2, 30.50, 'item5322');
+INSERT INTO items VALUES (5323, 3, 30.75, 'item5323');
+INSERT INTO items VALUES (5324, 4, 31.00, 'item5324');
+INSERT INTO items VALUES (5325, 5, 31.25, 'item5325');
+INSERT INTO items VALUES (5326, 6, 31.50, 'item5326');
+INSERT INTO items VALUES (5327, 7, 31.75, 'item5327');
+INSERT INTO items VALUES (5328, 8, 32.00, 'item5328');
+INSERT INTO items VALUES (5329, 9, 32.25, 'item5329');
+INSERT INTO items VALUES (5330, 10, 32.50, 'item5330');
+INSERT INTO items VALUES (5331, 11, 32.75, 'item5331');
+INSERT INTO items VALUES (5332, 12, 33.00, 'item5332');
+INSERT INTO items VALUES (5333, 13, 33.25, 'item5333');
+INSERT INTO items VALUES (5334, 14, 33.50, 'item5334');
+INSERT INTO items VALUES (5335, 15, 33.75, 'item5335');
+INSERT INTO items VALUES (5336, 16, 34.00, 'item5336');
+INSERT INTO items VALUES (5337, 17, 34.25, 'item5337');
+INSERT INTO items VALUES (5338, 18, 34.50, 'item5338');
+INSERT INTO items VALUES (5339, 19, 34.75, 'item5339');
+INSERT INTO items VALUES (5340, 20, 35.00, 'item5340');
+INSERT INTO items VALUES (5341, 21, 35.25, 'item5341');
+INSERT INTO items VALUES (5342, 22, 35.50, 'item5342');
+INSERT INTO items VALUES (5343, 23, 35.75, 'item5343');
+INSERT INTO items VALUES (5344, 24, 36.00, 'item5344');
+INSERT INTO items VALUES (5345, 25, 36.25, 'item5345');
+INSERT INTO items VALUES (5346, 26, 36.50, 'item5346');
+INSERT INTO items VALUES (5347, 27, 36.75, 'item5347');
+INSERT INTO items VALUES (5348, 28, 37.00, 'item5348');
+INSERT INTO items VALUES (5349, 29, 37.25, 'item5349');
+INSERT INTO items VALUES (5350, 30, 37.50, 'item5350');
+INSERT INTO items VALUES (5351, 31, 37.75, 'item5351');
+INSERT INTO items VALUES (5352, 32, 38.00, 'item5352');
+INSERT INTO items VALUES (5353, 33, 38.25, 'item5353');
+INSERT INTO items VALUES (5354, 34, 38.50, 'item5354');
+INSERT INTO items VALUES (5355, 35, 38.75, 'item5355');
+INSERT INTO items VALUES (5356, 36, 39.00, 'item5356');
+INSERT INTO items VALUES (5357, 37, 39.25, 'item5357');
+INSERT INTO items VALUES (5358, 38, 39.50, 'item5358');
+INSERT INTO items VALUES (5359, 39, 39.75, 'item5359');
+INSERT INTO items VALUES (5360, 0, 40.00, 'item5360');
+INSERT INTO items VALUES (5361, 1, 40.25, 'item5361');
+INSERT INTO items VALUES (5362, 2, 40.50, 'item5362');
+INSERT INTO items VALUES (5363, 3, 40.75, 'item5363');
+INSERT INTO items VALUES (5364, 4, 41.00, 'item5364');
+INSERT INTO items VALUES (5365, 5, 41.25, 'item5365');
+INSERT INTO items VALUES (5366, 6, 41.50, 'item5366');
+INSERT INTO items VALUES (5367, 7, 41.75, 'item5367');
+INSERT INTO items VALUES (5368, 8, 42.00, 'item5368');
+INSERT INTO items VALUES (5369, 9, 42.25, 'item5369');
+INSERT INTO items VALUES (5370, 10, 42.50, 'item5370');
+INSERT INTO items VALUES (5371, 11, 42.75, 'item5371');
+INSERT INTO items VALUES (5372, 12, 43.00, 'item5372');
+INSERT INTO items VALUES (5373, 13, 43.25, 'item5373');
+INSERT INTO items VALUES (5374, 14, 43.50, 'item5374');
+INSERT INTO items VALUES (5375, 15, 43.75, 'item5375');
+INSERT INTO items VALUES (5376, 16, 44.00, 'item5376');
+INSERT INTO items VALUES (5377, 17, 44.25, 'item5377');
+INSERT INTO items VALUES (5378, 18, 44.50, 'item5378');
+INSERT INTO items VALUES (5379, 19, 44.75, 'item5379');
+INSERT INTO items VALUES (5380, 20, 45.00, 'item5380');
+INSERT INTO items VALUES (5381, 21, 45.25, 'item5381');
+INSERT INTO items VALUES (5382, 22, 45.50, 'item5382');
+INSERT INTO items VALUES (5383, 23, 45.75, 'item5383');
+INSERT INTO items VALUES (5384, 24, 46.00, 'item5384');
+INSERT INTO items VALUES (5385, 25, 46.25, 'item5385');
+INSERT INTO items VALUES (5386, 26, 46.50, 'item5386');
+INSERT INTO items VALUES (5387, 27, 46.75, 'item5387');
+INSERT INTO items VALUES (5388, 28, 47.00, 'item5388');
+INSERT INTO items VALUES (5389, 29, 47.25, 'item5389');
+INSERT INTO items VALUES (5390, 30, 47.50, 'item5390');
+INSERT INTO items VALUES (5391, 31, 47.75, 'item5391');
+INSERT INTO items VALUES (5392, 32, 48.00, 'item5392');
+INSERT INTO items VALUES (5393, 33, 48.25, 'item5393');
+INSERT INTO items VALUES (5394, 34, 48.50, 'item5394');
+INSERT INTO items VALUES (5395, 35, 48.75, 'item5395');
+INSERT INTO items VALUES (5396, 36, 49.00, 'item5396');
+INSERT INTO items VALUES (5397, 37, 49.25, 'item5397');
+INSERT INTO items VALUES (5398, 38, 49.50, 'item5398');
+INSERT INTO items VALUES (5399, 39, 49.75, 'item5399');
+INSERT INTO items VALUES (5400, 0, 50.00, 'item5400');
+INSERT INTO items VALUES (5401, 1, 50.25, 'item5401');
+INSERT INTO items VALUES (5402, 2, 50.50, 'item5402');
+INSERT INTO items VALUES (5403, 3, 50.75, 'item5403');
+INSERT INTO items VALUES (5404, 4, 51.00, 'item5404');
+INSERT INTO items VALUES (5405, 5, 51.25, 'item5405');
+INSERT INTO items VALUES (5406, 6, 51.50, 'item5406');
+INSERT INTO items VALUES (5407, 7, 51.75, 'item5407');
+INSERT INTO items VALUES (5408, 8, 52.00, 'item5408');
+INSERT INTO items VALUES (5409, 9, 52.25, 'item5409');
+INSERT INTO items VALUES (5410, 10, 52.50, 'item5410');
+INSERT INTO items VALUES (5411, 11, 52.75, 'item5411');
+INSERT INTO items VALUES (5412, 12, 53.00, 'item5412');
+INSERT INTO items VALUES (5413, 13, 53.25, 'item5413');
+INSERT INTO items VALUES (5414, 14, 53.50, 'item5414');
+INSERT INTO items VALUES (5415, 15, 53.75, 'item5415');
+INSERT INTO items VALUES (5416, 16, 54.00, 'item5416');
+INSERT INTO items VALUES (5417, 17, 54.25, 'item5417');
+INSERT INTO items VALUES (5418, 18, 54.50, 'item5418');
+INSERT INTO items VALUES (5419, 19, 54.75, 'item5419');
+INSERT INTO items VALUES (5420, 20, 55.00, 'item5420');
+INSERT INTO items VALUES (5421, 21, 55.25, 'item5421');
+INSERT INTO items VALUES (5422, 22, 55.50, 'item5422');
+INSERT INTO items VALUES (5423, 23, 55.75, 'item5423');
+INSERT INTO items VALUES (5424, 24, 56.00, 'item5424');
+INSERT INTO items VALUES (5425, 25, 56.25, 'item5425');
+INSERT INTO items VALUES (5426, 26, 56.50, 'item5426');
+INSERT INTO items VALUES (5427, 27, 56.75, 'item5427');
+INSERT INTO items VALUES (5428, 28, 57.00, 'item5428');
+INSERT INTO items VALUES (5429, 29, 57.25, 'item5429');
+INSERT INTO items VALUES (5430, 30, 57.50, 'item5430');
+INSERT INTO items VALUES (5431, 31, 57.75, 'item5431');
+INSERT INTO items VALUES (5432, 32, 58.00, 'item5432');
+INSERT INTO items VALUES (5433, 33, 58.25, 'item5433');
+INSERT INTO items VALUES (5434, 34, 58.50, 'item5434');
+INSERT INTO items VALUES (5435, 35, 58.75, 'item5435');
+INSERT INTO items VALUES (5436, 36, 59.00, 'item5436');
+INSERT INTO items VALUES (5437, 37, 59.25, 'item5437');
+INSERT INTO items VALUES (5438, 38, 59.50, 'item5438');
+INSERT INTO items VALUES (5439, 39, 59.75, 'item5439');
+INSERT INTO items VALUES (5440, 0, 60.00, 'item5440');
+INSERT INTO items VALUES (5441, 1, 60.25, 'item5441');
+INSERT INTO items VALUES (5442, 2, 60.50, 'item5442');
+INSERT INTO items VALUES (5443, 3, 60.75, 'item5443');
+INSERT INTO items VALUES (5444, 4, 61.00, 'item5444');
+INSERT INTO items VALUES (5445, 5, 61.25, 'item5445');
+INSERT INTO items VALUES (5446, 6, 61.50, 'item5446');
+INSERT INTO items VALUES (5447, 7, 61.75, 'item5447');
+INSERT INTO items VALUES (5448, 8, 62.00, 'item5448');
+INSERT INTO items VALUES (5449, 9, 62.25, 'item5449');
+INSERT INTO items VALUES (5450, 10, 62.50, 'item5450');
+INSERT INTO items VALUES (5451, 11, 62.75, 'item5451');
+INSERT INTO items VALUES (5452, 12, 63.00, 'item5452');
+INSERT INTO items VALUES (5453, 13, 63.25, 'item5453');
+INSERT INTO items VALUES (5454, 14, 63.50, 'item5454');
+INSERT INTO items VALUES (5455, 15, 63.75, 'item5455');
+INSERT INTO items VALUES (5456, 16, 64.00, 'item5456');
+INSERT INTO items VALUES (5457, 17, 64.25, 'item5457');
+INSERT INTO items VALUES (5458, 18, 64.50, 'item5458');
+INSERT INTO items VALUES (5459, 19, 64.75, 'item5459');
+INSERT INTO items VALUES (5460, 20, 65.00, 'item5460');
+INSERT INTO items VALUES (5461, 21, 65.25, 'item5461');
+INSERT INTO items VALUES (5462, 22, 65.50, 'item5462');
+INSERT INTO items VALUES (5463, 23, 65.75, 'item5463');
+INSERT INTO items VALUES (5464, 24, 66.00, 'item5464');
+INSERT INTO items VALUES (5465, 25, 66.25, 'item5465');
+INSERT INTO items VALUES (5466, 26, 66.50, 'item5466');
+INSERT INTO items VALUES (5467, 27, 66.75, 'item5467');
+INSERT INTO items VALUES (5468, 28, 67.00, 'item5468');
+INSERT INTO items VALUES (5469, 29, 67.25, 'item5469');
+INSERT INTO items VALUES (5470, 30, 67.50, 'item5470');
+INSERT INTO items VALUES (5471, 31, 67.75, 'item5471');
+INSERT INTO items VALUES (5472, 32, 68.00, 'item5472');
+INSERT INTO items VALUES (5473, 33, 68.25, 'item5473');
+INSERT INTO items VALUES (5474, 34, 68.50, 'item5474');
+INSERT INTO items VALUES (5475, 35, 68.75, 'item5475');
+INSERT INTO items VALUES (5476, 36, 69.00, 'item5476');
+INSERT INTO items VALUES (5477, 37, 69.25, 'item5477');
+INSERT INTO items VALUES (5478, 38, 69.50, 'item5478');
+INSERT INTO items VALUES (5479, 39, 69.75, 'item5479');
+INSERT INTO items VALUES (5480, 0, 70.00, 'item5480');
+INSERT INTO items VALUES (5481, 1, 70.25, 'item5481');
+INSERT INTO items VALUES (5482, 2, 70.50, 'item5482');
+INSERT INTO items VALUES (5483, 3, 70.75, 'item5483');
+INSERT INTO items VALUES (5484, 4, 71.00, 'item5484');
+INSERT INTO items VALUES (5485, 5, 71.25, 'item5485');
+INSERT INTO items VALUES (5486, 6, 71.50, 'item5486');
+INSERT INTO items VALUES (5487, 7, 71.75, 'item5487');
+INSERT INTO items VALUES (5488, 8, 72.00, 'item5488');
+INSERT INTO items VALUES (5489, 9, 72.25, 'item5489');
+INSERT INTO items VALUES (5490, 10, 72.50, 'item5490');
+INSERT INTO items VALUES (5491, 11, 72.75, 'item5491');
+INSERT INTO items VALUES (5492, 12, 73.00, 'item5492');
+INSERT INTO items VALUES (5493, 13, 73.25, 'item5493');
+INSERT INTO items VALUES (5494, 14, 73.50, 'item5494');
+INSERT INTO items VALUES (5495, 15, 73.75, 'item5495');
+INSERT INTO items VALUES (5496, 16, 74.00, 'item5496');
+INSERT INTO items VALUES (5497, 17, 74.25, 'item5497');
+INSERT INTO items VALUES (5498, 18, 74.50, 'item5498');
+INSERT INTO items VALUES (5499, 19, 74.75, 'item5499');
+INSERT INTO items VALUES (5500, 20, 75.00, 'item5500');
+INSERT INTO items VALUES (5501, 21, 75.25, 'item5501');
+INSERT INTO items VALUES (5502, 22, 75.50, 'item5502');
+INSERT INTO items VALUES (5503, 23, 75.75, 'item5503');
+INSERT INTO items VALUES (5504, 24, 76.00, 'item5504');
+INSERT INTO items VALUES (5505, 25, 76.25, 'item5505');
+INSERT INTO items VALUES (5506, 26, 76.50, 'item5506');
+INSERT INTO items VALUES (5507, 27, 76.75, 'item5507');
+INSERT INTO items VALUES (5508, 28, 77.00, 'item5508');
+INSERT INTO items VALUES (5509, 29, 77.25, 'item5509');
+INSERT INTO items VALUES (5510, 30, 77.50, 'item5510');
+INSERT INTO items VALUES (5511, 31, 77.75, 'item5511');
+INSERT INTO items VALUES (5512, 32, 78.00, 'item5512');
+INSERT INTO items VALUES (5513, 33, 78.25, 'item5513');
+INSERT INTO items VALUES (5514, 34, 78.50, 'item5514');
+INSERT INTO items VALUES (5515, 35, 78.75, 'item5515');
+INSERT INTO items VALUES (5516, 36, 79.00, 'item5516');
+INSERT INTO items VALUES (5517, 37, 79.25, 'item5517');
+INSERT INTO items VALUES (5518, 38, 79.50, 'item5518');
+INSERT INTO items VALUES (5519, 39, 79.75, 'item5519');
+INSERT INTO items VALUES (5520, 0, 80.00, 'item5520');
+INSERT INTO items VALUES (5521, 1, 80.25, 'item5521');
+INSERT INTO items VALUES (5522, 2, 80.50, 'item5522');
+INSERT INTO items VALUES (5523, 3, 80.75, 'item5523');
+INSERT INTO items VALUES (5524, 4, 81.00, 'item5524');
+INSERT INTO items VALUES (5525, 5, 81.25, 'item5525');
+INSERT INTO items VALUES (5526, 6, 81.50, 'item5526');
+INSERT INTO items VALUES (5527, 7, 81.75, 'item5527');
+INSERT INTO items VALUES (5528, 8, 82.00, 'item5528');
+INSERT INTO items VALUES (5529, 9, 82.25, 'item5529');
+INSERT INTO items VALUES (5530, 10, 82.50, 'item5530');
+INSERT INTO items VALUES (5531, 11, 82.75, 'item5531');
+INSERT INTO items VALUES (5532, 12, 83.00, 'item5532');
+INSERT INTO items VALUES (5533, 13, 83.25, 'item5533');
+INSERT INTO items VALUES (5534, 14, 83.50, 'item5534');
+INSERT INTO items VALUES (5535, 15, 83.75, 'item5535');
+INSERT INTO items VALUES (5536, 16, 84.00, 'item5536');
+INSERT INTO items VALUES (5537, 17, 84.25, 'item5537');
+INSERT INTO items VALUES (5538, 18, 84.50, 'item5538');
+INSERT INTO items VALUES (5539, 19, 84.75, 'item5539');
+INSERT INTO items VALUES (5540, 20, 85.00, 'item5540');
+INSERT INTO items VALUES (5541, 21, 85.25, 'item5541');
+INSERT INTO items VALUES (5542, 22, 85.50, 'item5542');
+INSERT INTO items VALUES (5543, 23, 85.75, 'item5543');
+INSERT INTO items VALUES (5544, 24, 86.00, 'item5544');
+INSERT INTO items VALUES (5545, 25, 86.25, 'item5545');
+INSERT INTO items VALUES (5546, 26, 86.50, 'item5546');
+INSERT INTO items VALUES (5547, 27, 86.75, 'item5547');
+INSERT INTO items VALUES (5548, 28, 87.00, 'item5548');
+INSERT INTO items VALUES (5549, 29, 87.25, 'item5549');
+INSERT INTO items VALUES (5550, 30, 87.50, 'item5550');
+INSERT INTO items VALUES (5551, 31, 87.75, 'item5551');
+INSERT INTO items VALUES (5552, 32, 88.00, 'item5552');
+INSERT INTO items VALUES (5553, 33, 88.25, 'item5553');
+INSERT INTO items VALUES (5554, 34, 88.50, 'item5554');
+INSERT INTO items VALUES (5555, 35, 88.75, 'item5555');
+INSERT INTO items VALUES (5556, 36, 89.00, 'item5556');
+INSERT INTO items VALUES (5557, 37, 89.25, 'item5557');
+INSERT INTO items VALUES (5558, 38, 89.50, 'item5558');
+INSERT INTO items VALUES (5559, 39, 89.75, 'item5559');
+INSERT INTO items VALUES (5560, 0, 90.00, 'item5560');
+INSERT INTO items VALUES (5561, 1, 90.25, 'item5561');
+INSERT INTO items VALUES (5562, 2, 90.50, 'item5562');
+INSERT INTO items VALUES (5563, 3, 90.75, 'item5563');
+INSERT INTO items VALUES (5564, 4, 91.00, 'item5564');
+INSERT INTO items VALUES (5565, 5, 91.25, 'item5565');
+INSERT INTO items VALUES (5566, 6, 91.50, 'item5566');
+INSERT INTO items VALUES (5567, 7, 91.75, 'item5567');
+INSERT INTO items VALUES (5568, 8, 92.00, 'item5568');
+INSERT INTO items VALUES (5569, 9, 92.25, 'item5569');
+INSERT INTO items VALUES (5570, 10, 92.50, 'item5570');
+INSERT INTO items VALUES (5571, 11, 92.75, 'item5571');
+INSERT INTO items VALUES (5572, 12, 93.00, 'item5572');
+INSERT INTO items VALUES (5573, 13, 93.25, 'item5573');
+INSERT INTO items VALUES (5574, 14, 93.50, 'item5574');
+INSERT INTO items VALUES (5575, 15, 93.75, 'item5575');
+INSERT INTO items VALUES (5576, 16, 94.00, 'item5576');
+INSERT INTO items VALUES (5577, 17, 94.25, 'item5577');
+INSERT INTO items VALUES (5578, 18, 94.50, 'item5578');
+INSERT INTO items VALUES (5579, 19, 94.75, 'item5579');
+INSERT INTO items VALUES (5580, 20, 95.00, 'item5580');
+INSERT INTO items VALUES (5581, 21, 95.25, 'item5581');
+INSERT INTO items VALUES (5582, 22, 95.50, 'item5582');
+INSERT INTO items VALUES (5583, 23, 95.75, 'item5583');
+INSERT INTO items VALUES (5584, 24, 96.00, 'item5584');
+INSERT INTO items VALUES (5585, 25, 96.25, 'item5585');
+INSERT INTO items VALUES (5586, 26, 96.50, 'item5586');
+INSERT INTO items VALUES (5587, 27, 96.75, 'item5587');
+INSERT INTO items VALUES (5588, 28, 97.00, 'item5588');
+INSERT INTO items VALUES (5589, 29, 97.25, 'item5589');
+INSERT INTO items VALUES (5590, 30, 97.50, 'item5590');
+INSERT INTO items VALUES (5591, 31, 97.75, 'item5591');
+INSERT INTO items VALUES (5592, 32, 98.00, 'item5592');
+INSERT INTO items VALUES (5593, 33, 98.25, 'item5593');
+INSERT INTO items VALUES (5594, 34, 98.50, 'item5594');
+INSERT INTO items VALUES (5595, 35, 98.75, 'item5595');
+INSERT INTO items VALUES (5596, 36, 99.00, 'item5596');
+INSERT INTO items VALUES (5597, 37, 99.25, 'item5597');
+INSERT INTO items VALUES (5598, 38, 99.50, 'item5598');
+INSERT INTO items VALUES (5599, 39, 99.75, 'item5599');
+INSERT INTO items VALUES (5600, 0, 0.00, 'item5600');
+INSERT INTO items VALUES (5601, 1, 0.25, 'item5601');
+INSERT INTO items VALUES (5602, 2, 0.50, 'item5602');
+INSERT INTO items VALUES (5603, 3, 0.75, 'item5603');
+INSERT INTO items VALUES (5604, 4, 1.00, 'item5604');
+INSERT INTO items VALUES (5605, 5, 1.25, 'item5605');
+INSERT INTO items VALUES (5606, 6, 1.50, 'item5606');
+INSERT INTO items VALUES (5607, 7, 1.75, 'item5607');
+INSERT INTO items VALUES (5608, 8, 2.00, 'item5608');
+INSERT INTO items VALUES (5609, 9, 2.25, 'item5609');
+INSERT INTO items VALUES (5610, 10, 2.50, 'item5610');
+INSERT INTO items VALUES (5611, 11, 2.75, 'item5611');
+INSERT INTO items VALUES (5612, 12, 3.00, 'item5612');
+INSERT INTO items VALUES (5613, 13, 3.25, 'item5613');
+INSERT INTO items VALUES (5614, 14, 3.50, 'item5614');
+INSERT INTO items VALUES (5615, 15, 3.75, 'item5615');
+INSERT INTO items VALUES (5616, 16, 4.00, 'item5616');
+INSERT INTO items VALUES (5617, 17, 4.25, 'item5617');
+INSERT INTO items VALUES (5618, 18, 4.50, 'item5618');
+INSERT INTO items VALUES (5619, 19, 4.75, 'item5619');
+INSERT INTO items VALUES (5620, 20, 5.00, 'item5620');
+INSERT INTO items VALUES (5621, 21, 5.25, 'item5621');
+INSERT INTO items VALUES (5622, 22, 5.50, 'item5622');
+INSERT INTO items VALUES (5623, 23, 5.75, 'item5623');
+INSERT INTO items VALUES (5624, 24, 6.00, 'item5624');
+INSERT INTO items VALUES (5625, 25, 6.25, 'item5625');
+INSERT INTO items VALUES (5626, 26, 6.50, 'item5626');
+INSERT INTO items VALUES (5627, 27, 6.75, 'item5627');
+INSERT INTO items VALUES (5628, 28, 7.00, 'item5628');
+INSERT INTO items VALUES (5629, 29, 7.25, 'item5629');
+INSERT INTO items VALUES (5630, 30, 7.50, 'item5630');
+INSERT INTO items VALUES (5631, 31, 7.75, 'item5631');
+INSERT INTO items VALUES (5632, 32, 8.00, 'item5632');
+INSERT INTO items VALUES (5633, 33, 8.25, 'item5633');
+INSERT INTO items VALUES (5634, 34, 8.50, 'item5634');
+INSERT INTO items VALUES (5635, 35, 8.75, 'item5635');
+INSERT INTO items VALUES (5636, 36, 9.00, 'item5636');
+INSERT INTO items VALUES (5637, 37, 9.25, 'item5637');
+INSERT INTO items VALUES (5638, 38, 9.50, 'item5638');
+INSERT INTO items VALUES (5639, 39, 9.75, 'item5639');
+INSERT INTO items VALUES (5640, 0, 10.00, 'item5640');
+INSERT INTO items VALUES (5641, 1, 10.25, 'item5641');
+INSERT INTO items VALUES (5642, 2, 10.50, 'item5642');
+INSERT INTO items VALUES (5643, 3, 10.75, 'item5643');
+INSERT INTO items VALUES (5644, 4, 11.00, 'item5644');
+INSERT INTO items VALUES (5645, 5, 11.25, 'item5645');
+INSERT INTO items VALUES (5646, 6, 11.50, 'item5646');
+INSERT INTO items VALUES (5647, 7, 11.75, 'item5647');
+INSERT INTO items VALUES (5648, 8, 12.00, 'item5648');
+INSERT INTO items VALUES (5649, 9, 12.25, 'item5649');
+INSERT INTO items VALUES (5650, 10, 12.50, 'item5650');
+INSERT INTO items VALUES (5651, 11, 12.75, 'item5651');
+INSERT INTO items VALUES (5652, 12, 13.00, 'item5652');
+INSERT INTO items VALUES (5653, 13, 13.25, 'item5653');
+INSERT INTO items VALUES (5654, 14, 13.50, 'item5654');
+INSERT INTO items VALUES (5655, 15, 13.75, 'item5655');
+INSERT INTO items VALUES (5656, 16, 14.00, 'item5656');
+INSERT INTO items VALUES (5657, 17, 14.25, 'item5657');
+INSERT INTO items VALUES (5658, 18, 14.50, 'item5658');
+INSERT INTO items VALUES (5659, 19, 14.75, 'item5659');
+INSERT INTO items VALUES (5660, 20, 15.00, 'item5660');
+INSERT INTO items VALUES (5661, 21, 15.25, 'item5661');
+INSERT INTO items VALUES (5662, 22, 15.50, 'item5662');
+INSERT INTO items VALUES (5663, 23, 15.75, 'item5663');
+INSERT INTO items VALUES (5664, 24, 16.00, 'item5664');
+INSERT INTO items VALUES (5665, 25, 16.25, 'item5665');
+INSERT INTO items VALUES (5666, 26, 16.50, 'item5666');
+INSERT INTO items VALUES (5667, 27, 16.75, 'item5667');
+INSERT INTO items VALUES (5668, 28, 17.00, 'item5668');
+INSERT INTO items VALUES (5669, 29, 17.25, 'item5669');
+INSERT INTO items VALUES (5670, 30, 17.50, 'item5670');
+INSERT INTO items VALUES (5671, 31, 17.75, 'item5671');
+INSERT INTO items VALUES (5672, 32, 18.00, 'item5672');
+INSERT INTO items VALUES (5673, 33, 18.25, 'item5673');
+INSERT INTO items VALUES (5674, 34, 18.50, 'item5674');
+INSERT INTO items VALUES (5675, 35, 18.75, 'item5675');
+INSERT INTO items VALUES (5676, 36, 19.00, 'item5676');
+INSERT INTO items VALUES (5677, 37, 19.25, 'item5677');
+INSERT INTO items VALUES (5678, 38, 19.50, 'item5678');
+INSERT INTO items VALUES (5679, 39, 19.75, 'item5679');
+INSERT INTO items VALUES (5680, 0, 20.00, 'item5680');
+INSERT INTO items VALUES (5681, 1, 20.25, 'item5681');
+INSERT INTO items VALUES (5682, 2, 20.50, 'item5682');
+INSERT INTO items VALUES (5683, 3, 20.75, 'item5683');
+INSERT INTO items VALUES (5684, 4, 21.00, 'item5684');
+INSERT INTO items VALUES (5685, 5, 21.25, 'item5685');
+INSERT INTO items VALUES (5686, 6, 21.50, 'item5686');
+INSERT INTO items VALUES (5687, 7, 21.75, 'item5687');
+INSERT INTO items VALUES (5688, 8, 22.00, 'item5688');
+INSERT INTO items VALUES (5689, 9, 22.25, 'item5689');
+INSERT INTO items VALUES (5690, 10, 22.50, 'item5690');
+INSERT INTO items VALUES (5691, 11, 22.75, 'item5691');
+INSERT INTO items VALUES (5692, 12, 23.00, 'item5692');
+INSERT INTO items VALUES (5693, 13, 23.25, 'item5693');
+INSERT INTO items VALUES (5694, 14, 23.50, 'item5694');
+INSERT INTO items VALUES (5695, 15, 23.75, 'item5695');
+INSERT INTO items VALUES (5696, 16, 24.00, 'item5696');
+INSERT INTO items VALUES (5697, 17, 24.25, 'item5697');
+INSERT INTO items VALUES (5698, 18, 24.50, 'item5698');
+INSERT INTO items VALUES (5699, 19, 24.75, 'item5699');
+INSERT INTO items VALUES (5700, 20, 25.00, 'item5700');
+INSERT INTO items VALUES (5701, 21, 25.25, 'item5701');
+INSERT INTO items VALUES (5702, 22, 25.50, 'item5702');
+INSERT INTO items VALUES (5703, 23, 25.75, 'item5703');
+INSERT INTO items VALUES (5704, 24, 26.00, 'item5704');
+INSERT INTO items VALUES (5705, 25, 26.25, 'item5705');
+INSERT INTO items VALUES (5706, 26, 26.50, 'item5706');
+INSERT INTO items VALUES (5707, 27, 26.75, 'item5707');
+INSERT INTO items VALUES (5708, 28, 27.00, 'item5708');
+INSERT INTO items VALUES (5709, 29, 27.25, 'item5709');
+INSERT INTO items VALUES (5710, 30, 27.50, 'item5710');
+INSERT INTO items VALUES (5711, 31, 27.75, 'item5711');
+INSERT INTO items VALUES (5712, 32, 28.00, 'item5712');
+INSERT INTO items VALUES (5713, 33, 28.25, 'item5713');
+INSERT INTO items VALUES (5714, 34, 28.50, 'item5714');
+INSERT INTO items VALUES (5715, 35, 28.75, 'item5715');
+INSERT INTO items VALUES (5716, 36, 29.00, 'item5716');
+INSERT INTO items VALUES (5717, 37, 29.25, 'item5717');
+INSERT INTO items VALUES (5718, 38, 29.50, 'item5718');
+INSERT INTO items VALUES (5719, 39, 29.75, 'item5719');
+INSERT INTO items VALUES (5720, 0, 30.00, 'item5720');
+INSERT INTO items VALUES (5721, 1, 30.25, 'item5721');
+INSERT INTO items VALUES (5722, 2, 30.50, 'item5722');
+INSERT INTO items VALUES (5723, 3, 30.75, 'item5723');
+INSERT INTO items VALUES (5724, 4, 31.00, 'item5724');
+INSERT INTO items VALUES (5725, 5, 31.25, 'item5725');
+INSERT INTO items VALUES (5726, 6, 31.50, 'item5726');
+INSERT INTO items VALUES (5727, 7, 31.75, 'item5727');
+INSERT INTO items VALUES (5728, 8, 32.00, 'item5728');
+INSERT INTO items VALUES (5729, 9, 32.25, 'item5729');
+INSERT INTO items VALUES (5730, 10, 32.50, 'item5730');
+INSERT INTO items VALUES (5731, 11, 32.75, 'item5731');
+INSERT INTO items VALUES (5732, 12, 33.00, 'item5732');
+INSERT INTO items VALUES (5733, 13, 33.25, 'item5733');
+INSERT INTO items VALUES (5734, 14, 33.50, 'item5734');
+INSERT INTO items VALUES (5735, 15, 33.75, 'item5735');
+INSERT INTO items VALUES (5736, 16, 34.00, 'item5736');
+INSERT INTO items VALUES (5737, 17, 34.25, 'item5737');
+INSERT INTO items VALUES (5738, 18, 34.50, 'item5738');
+INSERT INTO items VALUES (5739, 19, 34.75, 'item5739');
+INSERT INTO items VALUES (5740, 20, 35.00, 'item5740');
+INSERT INTO items VALUES (5741, 21, 35.25, 'item5741');
+INSERT INTO items VALUES (5742, 22, 35.50, 'item5742');
+INSERT INTO items VALUES (5743, 23, 35.75, 'item5743');
+INSERT INTO items VALUES (5744, 24, 36.00, 'item5744');
+INSERT INTO items VALUES (5745, 25, 36.25, 'item5745');
+INSERT INTO items VALUES (5746, 26, 36.50, 'item5746');
+INSERT INTO items VALUES (5747, 27, 36.75, 'item5747');
+INSERT INTO items VALUES (5748, 28, 37.00, 'item5748');
+INSERT INTO items VALUES (5749, 29, 37.25, 'item5749');
+INSERT INTO items VALUES (5750, 30, 37.50, 'item5750');
+INSERT INTO items VALUES (5751, 31, 37.75, 'item5751');
+INSERT INTO items VALUES (5752, 32, 38.00, 'item5752');
+INSERT INTO items VALUES (5753, 33, 38.25, 'item5753');
+INSERT INTO items VALUES (5754, 34, 38.50, 'item5754');
+INSERT INTO items VALUES (5755, 35, 38.75, 'item5755');
+INSERT INTO items VALUES (5756, 36, 39.00, 'item5756');
+INSERT INTO items VALUES (5757, 37, 39.25, 'item5757');
+INSERT INTO items VALUES (5758, 38, 39.50, 'item5758');
+INSERT INTO items VALUES (5759, 39, 39.75, 'item5759');
+INSERT INTO items VALUES (5760, 0, 40.00, 'item5760');
+INSERT INTO items VALUES (5761, 1, 40.25, 'item5761');
+INSERT INTO items VALUES (5762, 2, 40.50, 'item5762');
+INSERT INTO items VALUES (5763, 3, 40.75, 'item5763');
+INSERT INTO items VALUES (5764, 4, 41.00, 'item5764');
+INSERT INTO items VALUES (5765, 5, 41.25, 'item5765');
+INSERT INTO items VALUES (5766, 6, 41.50, 'item5766');
+INSERT INTO items VALUES (5767, 7, 41.75, 'item5767');
+INSERT INTO items VALUES (5768, 8, 42.00, 'item5768');
+INSERT INTO items VALUES (5769, 9, 42.25, 'item5769');
+INSERT INTO items VALUES (5770, 10, 42.50, 'item5770');
+INSERT INTO items VALUES (5771, 11, 42.75, 'item5771');
+INSERT INTO items VALUES (5772, 12, 43.00, 'item5772');
+INSERT INTO items VALUES (5773, 13, 43.25, 'item5773');
+INSERT INTO items VALUES (5774, 14, 43.50, 'item5774');
+INSERT INTO items VALUES (5775, 15, 43.75, 'item5775');
+INSERT INTO items VALUES (5776, 16, 44.00, 'item5776');
+INSERT INTO items VALUES (5777, 17, 44.25, 'item5777');
+INSERT INTO items VALUES (5778, 18, 44.50, 'item5778');
+INSERT INTO items VALUES (5779, 19, 44.75, 'item5779');
+INSERT INTO items VALUES (5780, 20, 45.00, 'item5780');
+INSERT INTO items VALUES (5781, 21, 45.25, 'item5781');
+INSERT INTO items VALUES (5782, 22, 45.50, 'item5782');
+INSERT INTO items VALUES (5783, 23, 45.75, 'item5783');
+INSERT INTO items VALUES (5784, 24, 46.00, 'item5784');
+INSERT INTO items VALUES (5785, 25, 46.25, 'item5785');
+INSERT INTO items VALUES (5786, 26, 46.50, 'item5786');
+INSERT INTO items VALUES (5787, 27, 46.75, 'item5787');
+INSERT INTO items VALUES (5788, 28, 47.00, 'item5788');
+INSERT INTO items VALUES (5789, 29, 47.25, 'item5789');
+INSERT INTO items VALUES (5790, 30, 47.50, 'item5790');
+INSERT INTO items VALUES (5791, 31, 47.75, 'item5791');
+INSERT INTO items VALUES (5792, 32, 48.00, 'item5792');
+INSERT INTO items VALUES (5793, 33, 48.25, 'item5793');
+INSERT INTO items VALUES (5794, 34, 48.50, 'item5794');
+INSERT INTO items VALUES (5795, 35, 48.75, 'item5795');
+INSERT INTO items VALUES (5796, 36, 49.00, 'item5796');
+INSERT INTO items VALUES (5797, 37, 49.25, 'item5797');
+INSERT INTO items VALUES (5798, 38, 49.50, 'item5798');
+INSERT INTO items VALUES (5799, 39, 49.75, 'item5799');
+INSERT INTO items VALUES (5800, 0, 50.00, 'item5800');
+INSERT INTO items VALUES (5801, 1, 50.25, 'item5801');
+INSERT INTO items VALUES (5802, 2, 50.50, 'item5802');
+INSERT INTO items VALUES (5803, 3, 50.75, 'item5803');
+INSERT INTO items VALUES (5804, 4, 51.00, 'item5804');
+INSERT INTO items VALUES (5805, 5, 51.25, 'item5805');
+INSERT INTO items VALUES (5806, 6, 51.50, 'item5806');
+INSERT INTO items VALUES (5807, 7, 51.75, 'item5807');
+INSERT INTO items VALUES (5808, 8, 52.00, 'item5808');
+INSERT INTO items VALUES (5809, 9, 52.25, 'item5809');
+INSERT INTO items VALUES (5810, 10, 52.50, 'item5810');
+INSERT INTO items VALUES (5811, 11, 52.75, 'item5811');
+INSERT INTO items VALUES (5812, 12, 53.00, 'item5812');
+INSERT INTO items VALUES (5813, 13, 53.25, 'item5813');
+INSERT INTO items VALUES (5814, 14, 53.50, 'item5814');
+INSERT INTO items VALUES (5815, 15, 53.75, 'item5815');
+INSERT INTO items VALUES (5816, 16, 54.00, 'item5816');
+INSERT INTO items VALUES (5817, 17, 54.25, 'item5817');
+INSERT INTO items VALUES (5818, 18, 54.50, 'item5818');
+INSERT INTO items VALUES (5819, 19, 54.75, 'item5819');
+INSERT INTO items VALUES (5820, 20, 55.00, 'item5820');
+INSERT INTO items VALUES (5821, 21, 55.25, 'item5821');
+INSERT INTO items VALUES (5822, 22, 55.50, 'item5822');
+INSERT INTO items VALUES (5823, 23, 55.75, 'item5823');
+INSERT INTO items VALUES (5824, 24, 56.00, 'item5824');
+INSERT INTO items VALUES (5825, 25, 56.25, 'item5825');
+INSERT INTO items VALUES (5826, 26, 56.50, 'item5826');
+INSERT INTO items VALUES (5827, 27, 56.75, 'item5827');
+INSERT INTO items VALUES (5828, 28, 57.00, 'item5828');
+INSERT INTO items VALUES (5829, 29, 57.25, 'item5829');
+INSERT INTO items VALUES (5830, 30, 57.50, 'item5830');
+INSERT INTO items VALUES (5831, 31, 57.75, 'item5831');
+INSERT INTO items VALUES (5832, 32, 58.00, 'item5832');
+INSERT INTO items VALUES (5833, 33, 58.25, 'item5833');
+INSERT INTO items VALUES (5834, 34, 58.50, 'item5834');
+INSERT INTO items VALUES (5835, 35, 58.75, 'item5835');
+INSERT INTO items VALUES (5836, 36, 59.00, 'item5836');
+INSERT INTO items VALUES (5837, 37, 59.25, 'item5837');
+INSERT INTO items VALUES (5838, 38, 59.50, 'item5838');
+INSERT INTO items VALUES (5839, 39, 59.75, 'item5839');
+INSERT INTO items VALUES (5840, 0, 60.00, 'item5840');
+INSERT INTO items VALUES (5841, 1, 60.25, 'item5841');
+INSERT INTO items VALUES (5842, 2, 60.50, 'item5842');
+INSERT INTO items VALUES (5843, 3, 60.75, 'item5843');
+INSERT INTO items VALUES (5844, 4, 61.00, 'item5844');
+INSERT INTO items VALUES (5845, 5, 61.25, 'item5845');
+INSERT INTO items VALUES (5846, 6, 61.50, 'item5846');
+INSERT INTO items VALUES (5847, 7, 61.75, 'item5847');
+INSERT INTO items VALUES (5848, 8, 62.00, 'item5848');
+INSERT INTO items VALUES (5849, 9, 62.25, 'item5849');
+INSERT INTO items VALUES (5850, 10, 62.50, 'item5850');
+INSERT INTO items VALUES (5851, 11, 62.75, 'item5851');
+INSERT INTO items VALUES (5852, 12, 63.00, 'item5852');
+INSERT INTO items VALUES (5853, 13, 63.25, 'item5853');
+INSERT INTO items VALUES (5854, 14, 63.50, 'item5854');
+INSERT INTO items VALUES (5855, 15, 63.75, 'item5855');
+INSERT INTO items VALUES (5856, 16, 64.00, 'item5856');
+INSERT INTO items VALUES (5857, 17, 64.25, 'item5857');
+INSERT INTO items VALUES (5858, 18, 64.50, 'item5858');
+INSERT INTO items VALUES (5859, 19, 64.75, 'item5859');
+INSERT INTO items VALUES (5860, 20, 65.00, 'item5860');
+INSERT INTO items VALUES (5861, 21, 65.25, 'item5861');
+INSERT INTO items VALUES (5862, 22, 65.50, 'item5862');
+INSERT INTO items VALUES (5863, 23, 65.75, 'item5863');
+INSERT INTO items VALUES (5864, 24, 66.00, 'item5864');
+INSERT INTO items VALUES (5865, 25, 66.25, 'item5865');
+INSERT INTO items VALUES (5866, 26, 66.50, 'item5866');
+INSERT INTO items VALUES (5867, 27, 66.75, 'item5867');
+INSERT INTO items VALUES (5868, 28, 67.00, 'item5868');
+INSERT INTO items VALUES (5869, 29, 67.25, 'item5869');
+INSERT INTO items VALUES (5870, 30, 67.50, 'item5870');
+INSERT INTO items VALUES (5871, 31, 67.75, 'item5871');
+INSERT INTO items VALUES (5872, 32, 68.00, 'item5872');
+INSERT INTO items VALUES (5873, 33, 68.25, 'item5873');
+INSERT INTO items VALUES (5874, 34, 68.50, 'item5874');
+INSERT INTO items VALUES (5875, 35, 68.75, 'item5875');
+INSERT INTO items VALUES (5876, 36, 69.00, 'item5876');
+INSERT INTO items VALUES (5877, 37, 69.25, 'item5877');
+INSERT INTO items VALUES (5878, 38, 69.50, 'item5878');
+INSERT INTO items VALUES (5879, 39, 69.75, 'item5879');
+INSERT INTO items VALUES (5880, 0, 70.00, 'item5880');
+INSERT INTO items VALUES (5881, 1, 70.25, 'item5881');
+INSERT INTO items VALUES (5882, 2, 70.50, 'item5882');
+INSERT INTO items VALUES (5883, 3, 70.75, 'item5883');
+INSERT INTO items VALUES (5884, 4, 71.00, 'item5884');
+INSERT INTO items VALUES (5885, 5, 71.25, 'item5885');
+INSERT INTO items VALUES (5886, 6, 71.50, 'item5886');
+INSERT INTO items VALUES (5887, 7, 71.75, 'item5887');
+INSERT INTO items VALUES (5888, 8, 72.00, 'item5888');
+INSERT INTO items VALUES (5889, 9, 72.25, 'item5889');
+INSERT INTO items VALUES (5890, 10, 72.50, 'item5890');
+INSERT INTO items VALUES (5891, 11, 72.75, 'item5891');
+INSERT INTO items VALUES (5892, 12, 73.00, 'item5892');
+INSERT INTO items VALUES (5893, 13, 73.25, 'item5893');
+INSERT INTO items VALUES (5894, 14, 73.50, 'item5894');
+INSERT INTO items VALUES (5895, 15, 73.75, 'item5895');
+INSERT INTO items VALUES (5896, 16, 74.00, 'item5896');
+INSERT INTO items VALUES (5897, 17, 74.25, 'item5897');
+INSERT INTO items VALUES (5898, 18, 74.50, 'item5898');
+INSERT INTO items VALUES (5899, 19, 74.75, 'item5899');
+INSERT INTO items VALUES (5900, 20, 75.00, 'item5900');
+INSERT INTO items VALUES (5901, 21, 75.25, 'item5901');
+INSERT INTO items VALUES (5902, 22, 75.50, 'item5902');
+INSERT INTO items VALUES (5903, 23, 75.75, 'item5903');
+INSERT INTO items VALUES (5904, 24, 76.00, 'item5904');
+INSERT INTO items VALUES (5905, 25, 76.25, 'item5905');
+INSERT INTO items VALUES (5906, 26, 76.50, 'item5906');
+INSERT INTO items VALUES (5907, 27, 76.75, 'item5907');
+INSERT INTO items VALUES (5908, 28, 77.00, 'item5908');
+INSERT INTO items VALUES (5909, 29, 77.25, 'item5909');
+INSERT INTO items VALUES (5910, 30, 77.50, 'item5910');
+INSERT INTO items VALUES (5911, 31, 77.75, 'item5911');
+INSERT INTO items VALUES (5912, 32, 78.00, 'item5912');
+INSERT INTO items VALUES (5913, 33, 78.25, 'item5913');
+INSERT INTO items VALUES (5914, 34, 78.50, 'item5914');
+INSERT INTO items VALUES (5915, 35, 78.75, 'item5915');
+INSERT INTO items VALUES (5916, 36, 79.00, 'item5916');
+INSERT INTO items VALUES (5917, 37, 79.25, 'item5917');
+INSERT INTO items VALUES (5918, 38, 79.50, 'item5918');
+INSERT INTO items VALUES (5919, 39, 79.75, 'item5919');
+INSERT INTO items VALUES (5920, 0, 80.00, 'item5920');
+INSERT INTO items VALUES (5921, 1, 80.25, 'item5921');
+INSERT INTO items VALUES (5922, 2, 80.50, 'item5922');
+INSERT INTO items VALUES (5923, 3, 80.75, 'item5923');
+INSERT INTO items VALUES (5924, 4, 81.00, 'item5924');
+INSERT INTO items VALUES (5925, 5, 81.25, 'item5925');
+INSERT INTO items VALUES (5926, 6, 81.50, 'item5926');
+INSERT INTO items VALUES (5927, 7, 81.75, 'item5927');
+INSERT INTO items VALUES (5928, 8, 82.00, 'item5928');
+INSERT INTO items VALUES (5929, 9, 82.25, 'item5929');
+INSERT INTO items VALUES (5930, 10, 82.50, 'item5930');
+INSERT INTO items VALUES (5931, 11, 82.75, 'item5931');
+INSERT INTO items VALUES (5932, 12, 83.00, 'item5932');
+INSERT INTO items VALUES (5933, 13, 83.25, 'item5933');
+INSERT INTO items VALUES (5934, 14, 83.50, 'item5934');
+INSERT INTO items VALUES (5935, 15, 83.75, 'item5935');
+INSERT INTO items VALUES (5936, 16, 84.00, 'item5936');
+INSERT INTO items VALUES (5937, 17, 84.25, 'item5937');
+INSERT INTO items VALUES (5938, 18, 84.50, 'item5938');
+INSERT INTO items VALUES (5939, 19, 84.75, 'item5939');
+INSERT INTO items VALUES (5940, 20, 85.00, 'item5940');
+INSERT INTO items VALUES (5941, 21, 85.25, 'item5941');
+INSERT INTO items VALUES (5942, 22, 85.50, 'item5942');
+INSERT INTO items VALUES (5943, 23, 85.75, 'item5943');
+INSERT INTO items VALUES (5944, 24, 86.00, 'item5944');
+INSERT INTO items VALUES (5945, 25, 86.25, 'item5945');
+INSERT INTO items VALUES (5946, 26, 86.50, 'item5946');
+INSERT INTO items VALUES (5947, 27, 86.75, 'item5947');
+INSERT INTO items VALUES (5948, 28, 87.00, 'item5948');
+INSERT INTO items VALUES (5949, 29, 87.25, 'item5949');
+INSERT INTO items VALUES (5950, 30, 87.50, 'item5950');
+INSERT INTO items VALUES (5951, 31, 87.75, 'item5951');
+INSERT INTO items VALUES (5952, 32, 88.00, 'item5952');
+INSERT INTO items VALUES (5953, 33, 88.25, 'item5953');
+INSERT INTO items VALUES (5954, 34, 88.50, 'item5954');
+INSERT INTO items VALUES (5955, 35, 88.75, 'item5955');
+INSERT INTO items VALUES (5956, 36, 89.00, 'item5956');
+INSERT INTO items VALUES (5957, 37, 89.25, 'item5957');
+INSERT INTO items VALUES (5958, 38, 89.50, 'item5958');
+INSERT INTO items VALUES (5959, 39, 89.75, 'item5959');
+INSERT INTO items VALUES (5960, 0, 90.00, 'item5960');
+INSERT INTO items VALUES (5961, 1, 90.25, 'item5961');
+INSERT INTO items VALUES (5962, 2, 90.50, 'item5962');
+INSERT INTO items VALUES (5963, 3, 90.75, 'item5963');
+INSERT INTO items VALUES (5964, 4, 91.00, 'item5964');
+INSERT INTO items VALUES (5965, 5, 91.25, 'item5965');
+INSERT INTO items VALUES (5966, 6, 91.50, 'item5966');
+INSERT INTO items VALUES (5967, 7, 91.75, 'item5967');
+INSERT INTO items VALUES (5968, 8, 92.00, 'item5968');
+INSERT INTO items VALUES (5969, 9, 92.25, 'item5969');
+INSERT INTO items VALUES (5970, 10, 92.50, 'item5970');
+INSERT INTO items VALUES (5971, 11, 92.75, 'item5971');
+INSERT INTO items VALUES (5972, 12, 93.00, 'item5972');
+INSERT INTO items VALUES (5973, 13, 93.25, 'item5973');
+INSERT INTO items VALUES (5974, 14, 93.50, 'item5974');
+INSERT INTO items VALUES (5975, 15, 93.75, 'item5975');
+INSERT INTO items VALUES (5976, 16, 94.00, 'item5976');
+INSERT INTO items VALUES (5977, 17, 94.25, 'item5977');
+INSERT INTO items VALUES (5978, 18, 94.50, 'item5978');
+INSERT INTO items VALUES (5979, 19, 94.75, 'item5979');
+INSERT INTO items VALUES (5980, 20, 95.00, 'item5980');
+INSERT INTO items VALUES (5981, 21, 95.25, 'item5981');
+INSERT INTO items VALUES (5982, 22, 95.50, 'item5982');
+INSERT INTO items VALUES (5983, 23, 95.75, 'item5983');
+INSERT INTO items VALUES (5984, 24, 96.00, 'item5984');
+INSERT INTO items VALUES (5985, 25, 96.25, 'item5985');
+INSERT INTO items VALUES (5986, 26, 96.50, 'item5986');
+INSERT INTO items VALUES (5987, 27, 96.75, 'item5987');
+INSERT INTO items VALUES (5988, 28, 97.00, 'item5988');
+INSERT INTO items VALUES (5989, 29, 97.25, 'item5989');
+INSERT INTO items VALUES (5990, 30, 97.50, 'item5990');
+INSERT INTO items VALUES (5991, 31, 97.75, 'item5991');
+INSERT INTO items VALUES (5992, 32, 98.00, 'item5992');
+INSERT INTO items VALUES (5993, 33, 98.25, 'item5993');
+INSERT INTO items VALUES (5994, 34, 98.50, 'item5994');
+INSERT INTO items VALUES (5995, 35, 98.75, 'item5995');
+INSERT INTO items VALUES (5996, 36, 99.00, 'item5996');
+INSERT INTO items VALUES (5997, 37, 99.25, 'item5997');
+INSERT INTO items VALUES (5998, 38, 99.50, 'item5998');
+INSERT INTO items VALUES (5999, 39, 99.75, 'item5999');
@@ -0,0 +1,12 @@
+USE DATABASE store;
+SELECT id, grp, price FROM items WHERE name = 'item5999' OR name = 'item17';
+SELECT id, name FROM items WHERE price > 99.5 AND grp = 39;
+SELECT id, grp, price FROM items WHERE id > 5994 OR id < 3;
+UPDATE items SET price = price + 0.5 WHERE grp < 20;
+SELECT id, grp, price FROM items WHERE name = 'item5999' OR name = 'item17';
+SELECT id, name FROM items WHERE price > 99.5 AND grp = 39;
+SELECT id, grp, price FROM items WHERE id > 5994 OR id < 3;
+UPDATE items SET grp = grp + 100 WHERE id > 5990;
+SELECT id, grp, price FROM items WHERE name = 'item5999' OR name = 'item17';
+SELECT id, name FROM items WHERE price > 99.5 AND grp = 39;
+SELECT id, grp, price FROM items WHERE id > 5994 OR id < 3;
@@ -0,0 +1,12 @@
+USE DATABASE store;
+SELECT id, grp, price FROM items WHERE name = 'item5999' OR name = 'item17';
+SELECT id, name FROM items WHERE price > 99.5 AND grp = 39;
+SELECT id, grp, price FROM items WHERE id > 5994 OR id < 3;
+UPDATE items SET price = price * 2.0 WHERE grp > 30;
+SELECT id, grp, price FROM items WHERE name = 'item5999' OR name = 'item17';
+SELECT id, name FROM items WHERE price > 99.5 AND grp = 39;
+SELECT id, grp, price FROM items WHERE id > 5994 OR id < 3;
+DELETE FROM items WHERE id < 2;
+SELECT id, grp, price FROM items WHERE name = 'item5999' OR name = 'item17';
+SELECT id, name FROM items WHERE price > 99.5 AND grp = 39;
+SELECT id, grp, price FROM items WHERE id > 5994 OR id < 3;
@@ -0,0 +1,12 @@
+USE DATABASE bench_100;
+SELECT id, grp, price, name FROM items WHERE id > 96;
+USE DATABASE bench_3000;
+SELECT id, item_id, qty FROM orders WHERE id = 0 OR id = 2047 OR id = 2048 OR id = 2999;
+SELECT id, tag FROM notes WHERE id > 2996;
+USE DATABASE bench_5000;
+SELECT id, price, name FROM items WHERE id = 0 OR id = 2048 OR id = 4096 OR id = 4999;
+SELECT id, order_id, tag FROM notes WHERE tag = 't9' AND id > 4800;
+CREATE DATABASE extra;
+USE DATABASE extra;
+CREATE TABLE t (id INTEGER);
+INSERT INTO t VALUES (1);
@@ -0,0 +1,6 @@
+USE DATABASE extra;
+SELECT * FROM t;
+USE DATABASE bench_5000;
+SELECT id, price, name FROM items WHERE id = 0 OR id = 2048 OR id = 4096 OR id = 4999;
+USE DATABASE bench_100;
+SELECT id, grp, price, name FROM items WHERE id > 96;
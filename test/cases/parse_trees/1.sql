@@ -0,0 +1,15 @@
+CREATE DATABASE trees;
+USE DATABASE trees;
+CREATE TABLE t (a INTEGER, b FLOAT, c TEXT);
+INSERT INTO t VALUES (1, 1.25, 'one');
+INSERT INTO t VALUES (2, 2.50, 'two');
+INSERT INTO t VALUES (3, 3.75, 'xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx');
+INSERT INTO t VALUES (4, 5.00, 'four');
+INSERT INTO t VALUES (5, 6.25, 'five');
+SELECT a FROM t WHERE (a > 1 AND (b < 5.00 OR c = 'five')) OR (a = 1 AND c = 'one');
+SELECT a, c FROM t WHERE ((((a = 3))));
+SELECT a FROM t WHERE a > 1 AND a < 5 AND (c = 'two' OR c = 'four' OR c = 'xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx');
+UPDATE t SET a = ((a + 1) * (a - 1) + 2) * 3 - a, b = (b + 0.75) * 2 WHERE a > 2;
+SELECT a, b FROM t;
+SELECT a FROM t WHERE (a = 1 OR (a = 2);
+SELECT a FROM t;
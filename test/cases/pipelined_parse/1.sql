@@ -0,0 +1,214 @@
+CREATE DATABASE p;
+USE DATABASE p;
+CREATE TABLE t (id INTEGER, s TEXT);
+INSERT INTO t VALUES (0, 'semicolon');
+SELECT * FROM t WHERE s = 'semicolon';
+INSERT INTO t VALUES (1, 'row1');
+INSERT INTO t VALUES (2, 'row2');
+INSERT INTO t VALUES (3, 'row3');
+INSERT INTO t VALUES (4, 'row4');
+INSERT INTO t VALUES (5, 'row5');
+INSERT INTO t VALUES (6, 'row6');
+INSERT INTO t VALUES (7, 'row7');
+INSERT INTO t VALUES (8, 'row8');
+INSERT INTO t VALUES (9, 'row9');
+INSERT INTO t VALUES (10, 'row10');
+INSERT INTO t VALUES (11, 'row11');
+INSERT INTO t VALUES (12, 'row12');
+INSERT INTO t VALUES (13, 'row13');
+INSERT INTO t VALUES (14, 'row14');
+INSERT INTO t VALUES (15, 'row15');
+INSERT INTO t VALUES (16, 'row16');
+INSERT INTO t VALUES (17, 'row17');
+INSERT INTO t VALUES (18, 'row18');
+INSERT INTO t VALUES (19, 'row19');
+INSERT INTO t VALUES (20, 'row20');
+INSERT INTO t VALUES (21, 'row21');
+INSERT INTO t VALUES (22, 'row22');
+INSERT INTO t VALUES (23, 'row23');
+INSERT INTO t VALUES (24, 'row24');
+INSERT INTO t VALUES (25, 'row25');
+INSERT INTO t VALUES (26, 'row26');
+INSERT INTO t VALUES (27, 'row27');
+INSERT INTO t VALUES (28, 'row28');
+INSERT INTO t VALUES (29, 'row29');
+INSERT INTO t VALUES (30, 'row30');
+INSERT INTO t VALUES (31, 'row31');
+INSERT INTO t VALUES (32, 'row32');
+INSERT INTO t VALUES (33, 'row33');
+INSERT INTO t VALUES (34, 'row34');
+INSERT INTO t VALUES (35, 'row35');
+INSERT INTO t VALUES (36, 'row36');
+INSERT INTO t VALUES (37, 'row37');
+INSERT INTO t VALUES (38, 'row38');
+INSERT INTO t VALUES (39, 'row39');
+INSERT INTO t VALUES (40, 'row40');
+INSERT INTO t VALUES (41, 'row41');
+INSERT INTO t VALUES (42, 'row42');
+INSERT INTO t VALUES (43, 'row43');
+INSERT INTO t VALUES (44, 'row44');
+INSERT INTO t VALUES (45, 'row45');
+INSERT INTO t VALUES (46, 'row46');
+INSERT INTO t VALUES (47, 'row47');
+INSERT INTO t VALUES (48, 'row48');
+INSERT INTO t VALUES (49, 'row49');
+INSERT INTO t VALUES (50, 'row50');
+INSERT INTO t VALUES (51, 'row51');
+INSERT INTO t VALUES (52, 'row52');
+INSERT INTO t VALUES (53, 'row53');
+INSERT INTO t VALUES (54, 'row54');
+INSERT INTO t VALUES (55, 'row55');
+INSERT INTO t VALUES (56, 'row56');
+INSERT INTO t VALUES (57, 'row57');
+INSERT INTO t VALUES (58, 'row58');
+INSERT INTO t VALUES (59, 'row59');
+INSERT INTO t VALUES (60, 'row60');
+INSERT INTO t VALUES (61, 'row61');
+INSERT INTO t VALUES (62, 'row62');
+INSERT INTO t VALUES (63, 'row63');
+INSERT INTO t VALUES (64, 'row64');
+INSERT INTO t VALUES (65, 'row65');
+INSERT INTO t VALUES (66, 'row66');
+INSERT INTO t VALUES (67, 'row67');
+INSERT INTO t VALUES (68, 'row68');
+INSERT INTO t VALUES (69, 'row69');
+INSERT INTO t VALUES (70, 'row70');
+INSERT INTO t VALUES (71, 'row71');
+INSERT INTO t VALUES (72, 'row72');
+INSERT INTO t VALUES (73, 'row73');
+INSERT INTO t VALUES (74, 'row74');
+INSERT INTO t VALUES (75, 'row75');
+INSERT INTO t VALUES (76, 'row76');
+INSERT INTO t VALUES (77, 'row77');
+INSERT INTO t VALUES (78, 'row78');
+INSERT INTO t VALUES (79, 'row79');
+INSERT INTO t VALUES (80, 'row80');
+INSERT INTO t VALUES (81, 'row81');
+INSERT INTO t VALUES (82, 'row82');
+INSERT INTO t VALUES (83, 'row83');
+INSERT INTO t VALUES (84, 'row84');
+INSERT INTO t VALUES (85, 'row85');
+INSERT INTO t VALUES (86, 'row86');
+INSERT INTO t VALUES (87, 'row87');
+INSERT INTO t VALUES (88, 'row88');
+INSERT INTO t VALUES (89, 'row89');
+INSERT INTO t VALUES (90, 'row90');
+INSERT INTO t VALUES (91, 'row91');
+INSERT INTO t VALUES (92, 'row92');
+INSERT INTO t VALUES (93, 'row93');
+INSERT INTO t VALUES (94, 'row94');
+INSERT INTO t VALUES (95, 'row95');
+INSERT INTO t VALUES (96, 'row96');
+INSERT INTO t VALUES (97, 'row97');
+INSERT INTO t VALUES (98, 'row98');
+INSERT INTO t VALUES (99, 'row99');
+INSERT INTO t VALUES (100, 'row100');
+INSERT INTO t VALUES (101, 'row101');
+INSERT INTO t VALUES (102, 'row102');
+INSERT INTO t VALUES (103, 'row103');
+INSERT INTO t VALUES (104, 'row104');
+INSERT INTO t VALUES (105, 'row105');
+INSERT INTO t VALUES (106, 'row106');
+INSERT INTO t VALUES (107, 'row107');
+INSERT INTO t VALUES (108, 'row108');
+INSERT INTO t VALUES (109, 'row109');
+INSERT INTO t VALUES (110, 'row110');
+INSERT INTO t VALUES (111, 'row111');
+INSERT INTO t VALUES (112, 'row112');
+INSERT INTO t VALUES (113, 'row113');
+INSERT INTO t VALUES (114, 'row114');
+INSERT INTO t VALUES (115, 'row115');
+INSERT INTO t VALUES (116, 'row116');
+INSERT INTO t VALUES (117, 'row117');
+INSERT INTO t VALUES (118, 'row118');
+INSERT INTO t VALUES (119, 'row119');
+INSERT INTO t VALUES (120, 'row120');
+INSERT INTO t VALUES (121, 'row121');
+INSERT INTO t VALUES (122, 'row122');
+INSERT INTO t VALUES (123, 'row123');
+INSERT INTO t VALUES (124, 'row124');
+INSERT INTO t VALUES (125, 'row125');
+INSERT INTO t VALUES (126, 'row126');
+INSERT INTO t VALUES (127, 'row127');
+INSERT INTO t VALUES (128, 'row128');
+INSERT INTO t VALUES (129, 'row129');
+INSERT INTO t VALUES (130, 'row130');
+INSERT INTO t VALUES (131, 'row131');
+INSERT INTO t VALUES (132, 'row132');
+INSERT INTO t VALUES (133, 'row133');
+INSERT INTO t VALUES (134, 'row134');
+INSERT INTO t VALUES (135, 'row135');
+INSERT INTO t VALUES (136, 'row136');
+INSERT INTO t VALUES (137, 'row137');
+INSERT INTO t VALUES (138, 'row138');
+INSERT INTO t VALUES (139, 'row139');
+INSERT INTO t VALUES (140, 'row140');
+INSERT INTO t VALUES (141, 'row141');
+INSERT INTO t VALUES (142, 'row142');
+INSERT INTO t VALUES (143, 'row143');
+INSERT INTO t VALUES (144, 'row144');
+INSERT INTO t VALUES (145, 'row145');
+INSERT INTO t VALUES (146, 'row146');
+INSERT INTO t VALUES (147, 'row147');
+INSERT INTO t VALUES (148, 'row148');
+INSERT INTO t VALUES (149, 'row149');
+INSERT INTO t VALUES (150, 'row150');
+INSERT INTO t VALUES (151, 'row151');
+INSERT INTO t VALUES (152, 'row152');
+INSERT INTO t VALUES (153, 'row153');
+INSERT INTO t VALUES (154, 'row154');
+INSERT INTO t VALUES (155, 'row155');
+INSERT INTO t VALUES (156, 'row156');
+INSERT INTO t VALUES (157, 'row157');
+INSERT INTO t VALUES (158, 'row158');
+INSERT INTO t VALUES (159, 'row159');
+INSERT INTO t VALUES (160, 'row160');
+INSERT INTO t VALUES (161, 'row161');
+INSERT INTO t VALUES (162, 'row162');
+INSERT INTO t VALUES (163, 'row163');
+INSERT INTO t VALUES (164, 'row164');
+INSERT INTO t VALUES (165, 'row165');
+INSERT INTO t VALUES (166, 'row166');
+INSERT INTO t VALUES (167, 'row167');
+INSERT INTO t VALUES (168, 'row168');
+INSERT INTO t VALUES (169, 'row169');
+INSERT INTO t VALUES (170, 'row170');
+INSERT INTO t VALUES (171, 'row171');
+INSERT INTO t VALUES (172, 'row172');
+INSERT INTO t VALUES (173, 'row173');
+INSERT INTO t VALUES (174, 'row174');
+INSERT INTO t VALUES (175, 'row175');
+INSERT INTO t VALUES (176, 'row176');
+INSERT INTO t VALUES (177, 'row177');
+INSERT INTO t VALUES (178, 'row178');
+INSERT INTO t VALUES (179, 'row179');
+INSERT INTO t VALUES (180, 'row180');
+INSERT INTO t VALUES (181, 'row181');
+INSERT INTO t VALUES (182, 'row182');
+INSERT INTO t VALUES (183, 'row183');
+INSERT INTO t VALUES (184, 'row184');
+INSERT INTO t VALUES (185, 'row185');
+INSERT INTO t VALUES (186, 'row186');
+INSERT INTO t VALUES (187, 'row187');
+INSERT INTO t VALUES (188, 'row188');
+INSERT INTO t VALUES (189, 'row189');
+INSERT INTO t VALUES (190, 'row190');
+INSERT INTO t VALUES (191, 'row191');
+INSERT INTO t VALUES (192, 'row192');
+INSERT INTO t VALUES (193, 'row193');
+INSERT INTO t VALUES (194, 'row194');
+INSERT INTO t VALUES (195, 'row195');
+INSERT INTO t VALUES (196, 'row196');
+INSERT INTO t VALUES (197, 'row197');
+INSERT INTO t VALUES (198, 'row198');
+INSERT INTO t VALUES (199, 'row199');
+SELECT id, s FROM t WHERE id > 197;
+SELECT id
+FROM t
+WHERE id < 2;
+INSERT INTO t VALUES (200, 'last');
+SELECT id FROM t WHERE id = 200
+;
+SELEC id FROM t;
+INSERT INTO t VALUES (201, 'after the error');
+SELECT id FROM t WHERE id > 199;
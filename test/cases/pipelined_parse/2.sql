@@ -0,0 +1,8 @@
+USE DATABASE p;
+SELECT id, s FROM t WHERE id > 198;
+CREATE TABLE u (id INTEGER);
+INSERT INTO u VALUES (1);
+SELECT * FROM u;
+DROP TABLE u;
+SELECT * FROM u;
+SELECT * FROM t WHERE id = 0;
@@ -0,0 +1,8305 @@
+CREATE DATABASE shop;
+USE DATABASE shop;
+CREATE TABLE items (id INTEGER, grp INTEGER, name TEXT);
+CREATE TABLE orders (id INTEGER, item_id INTEGER, qty INTEGER);
+CREATE TABLE notes (id INTEGER, order_id INTEGER, tag TEXT);
+INSERT INTO items VALUES (0, 0, 'item0');
+INSERT INTO items VALUES (1, 1, 'item1');
+INSERT INTO items VALUES (2, 2, 'item2');
+INSERT INTO items VALUES (3, 3, 'item3');
+INSERT INTO items VALUES (4, 4, 'item4');
+INSERT INTO items VALUES (5, 5, 'item5');
+INSERT INTO items VALUES (6, 6, 'item6');
+INSERT INTO items VALUES (7, 7, 'item7');
+INSERT INTO items VALUES (8, 8, 'item8');
+INSERT INTO items VALUES (9, 9, 'item9');
+INSERT INTO items VALUES (10, 10, 'item10');
+INSERT INTO items VALUES (11, 11, 'item11');
+INSERT INTO items VALUES (12, 12, 'item12');
+INSERT INTO items VALUES (13, 13, 'item13');
+INSERT INTO items VALUES (14, 14, 'item14');
+INSERT INTO items VALUES (15, 15, 'item15');
+INSERT INTO items VALUES (16, 16, 'item16');
+INSERT INTO items VALUES (17, 17, 'item17');
+INSERT INTO items VALUES (18, 18, 'item18');
+INSERT INTO items VALUES (19, 19, 'item19');
+INSERT INTO items VALUES (20, 20, 'item20');
+INSERT INTO items VALUES (21, 21, 'item21');
+INSERT INTO items VALUES (22, 22, 'item22');
+INSERT INTO items VALUES (23, 23, 'item23');
+INSERT INTO items VALUES (24, 24, 'item24');
+INSERT INTO items VALUES (25, 25, 'item25');
+INSERT INTO items VALUES (26, 26, 'item26');
+INSERT INTO items VALUES (27, 27, 'item27');
+INSERT INTO items VALUES (28, 28, 'item28');
+INSERT INTO items VALUES (29, 29, 'item29');
+INSERT INTO items VALUES (30, 30, 'item30');
+INSERT INTO items VALUES (31, 31, 'item31');
+INSERT INTO items VALUES (32, 32, 'item32');
+INSERT INTO items VALUES (33, 33, 'item33');
+INSERT INTO items VALUES (34, 34, 'item34');
+INSERT INTO items VALUES (35, 35, 'item35');
+INSERT INTO items VALUES (36, 36, 'item36');
+INSERT INTO items VALUES (37, 37, 'item37');
+INSERT INTO items VALUES (38, 38, 'item38');
+INSERT INTO items VALUES (39, 39, 'item39');
+INSERT INTO items VALUES (40, 40, 'item40');
+INSERT INTO items VALUES (41, 41, 'item41');
+INSERT INTO items VALUES (42, 42, 'item42');
+INSERT INTO items VALUES (43, 43, 'item43');
+INSERT INTO items VALUES (44, 44, 'item44');
+INSERT INTO items VALUES (45, 45, 'item45');
+INSERT INTO items VALUES (46, 46, 'item46');
+INSERT INTO items VALUES (47, 47, 'item47');
+INSERT INTO items VALUES (48, 48, 'item48');
+INSERT INTO items VALUES (49, 49, 'item49');
+INSERT INTO items VALUES (50, 50, 'item50');
+INSERT INTO items VALUES (51, 51, 'item51');
+INSERT INTO items VALUES (52, 52, 'item52');
+INSERT INTO items VALUES (53, 53, 'item53');
+INSERT INTO items VALUES (54, 54, 'item54');
+INSERT INTO items VALUES (55, 55, 'item55');
+INSERT INTO items VALUES (56, 56, 'item56');
+INSERT INTO items VALUES (57, 57, 'item57');
+INSERT INTO items VALUES (58, 58, 'item58');
+INSERT INTO items VALUES (59, 59, 'item59');
+INSERT INTO items VALUES (60, 60, 'item60');
+INSERT INTO items VALUES (61, 61, 'item61');
+INSERT INTO items VALUES (62, 62, 'item62');
+INSERT INTO items VALUES (63, 63, 'item63');
+INSERT INTO items VALUES (64, 64, 'item64');
+INSERT INTO items VALUES (65, 65, 'item65');
+INSERT INTO items VALUES (66, 66, 'item66');
+INSERT INTO items VALUES (67, 67, 'item67');
+INSERT INTO items VALUES (68, 68, 'item68');
+INSERT INTO items VALUES (69, 69, 'item69');
+INSERT INTO items VALUES (70, 70, 'item70');
+INSERT INTO items VALUES (71, 71, 'item71');
+INSERT INTO items VALUES (72, 72, 'item72');
+INSERT INTO items VALUES (73, 73, 'item73');
+INSERT INTO items VALUES (74, 74, 'item74');
+INSERT INTO items VALUES (75, 75, 'item75');
+INSERT INTO items VALUES (76, 76, 'item76');
+INSERT INTO items VALUES (77, 77, 'item77');
+INSERT INTO items VALUES (78, 78, 'item78');
+INSERT INTO items VALUES (79, 79, 'item79');
+INSERT INTO items VALUES (80, 80, 'item80');
+INSERT INTO items VALUES (81, 81, 'item81');
+INSERT INTO items VALUES (82, 82, 'item82');
+INSERT INTO items VALUES (83, 83, 'item83');
+INSERT INTO items VALUES (84, 84, 'item84');
+INSERT INTO items VALUES (85, 85, 'item85');
+INSERT INTO items VALUES (86, 86, 'item86');
+INSERT INTO items VALUES (87, 87, 'item87');
+INSERT INTO items VALUES (88, 88, 'item88');
+INSERT INTO items VALUES (89, 89, 'item89');
+INSERT INTO items VALUES (90, 90, 'item90');
+INSERT INTO items VALUES (91, 91, 'item91');
+INSERT INTO items VALUES (92, 92, 'item92');
+INSERT INTO items VALUES (93, 93, 'item93');
+INSERT INTO items VALUES (94, 94, 'item94');
+INSERT INTO items VALUES (95, 95, 'item95');
+INSERT INTO items VALUES (96, 96, 'item96');
+INSERT INTO items VALUES (97, 97, 'item97');
+INSERT INTO items VALUES (98, 98, 'item98');
+INSERT INTO items VALUES (99, 99, 'item99');
+INSERT INTO items VALUES (100, 0, 'item100');
+INSERT INTO items VALUES (101, 1, 'item101');
+INSERT INTO items VALUES (102, 2, 'item102');
+INSERT INTO items VALUES (103, 3, 'item103');
+INSERT INTO items VALUES (104, 4, 'item104');
+INSERT INTO items VALUES (105, 5, 'item105');
+INSERT INTO items VALUES (106, 6, 'item106');
+INSERT INTO items VALUES (107, 7, 'item107');
+INSERT INTO items VALUES (108, 8, 'item108');
+INSERT INTO items VALUES (109, 9, 'item109');
+INSERT INTO items VALUES (110, 10, 'item110');
+INSERT INTO items VALUES (111, 11, 'item111');
+INSERT INTO items VALUES (112, 12, 'item112');
+INSERT INTO items VALUES (113, 13, 'item113');
+INSERT INTO items VALUES (114, 14, 'item114');
+INSERT INTO items VALUES (115, 15, 'item115');
+INSERT INTO items VALUES (116, 16, 'item116');
+INSERT INTO items VALUES (117, 17, 'item117');
+INSERT INTO items VALUES (118, 18, 'item118');
+INSERT INTO items VALUES (119, 19, 'item119');
+INSERT INTO items VALUES (120, 20, 'item120');
+INSERT INTO items VALUES (121, 21, 'item121');
+INSERT INTO items VALUES (122, 22, 'item122');
+INSERT INTO items VALUES (123, 23, 'item123');
+INSERT INTO items VALUES (124, 24, 'item124');
+INSERT INTO items VALUES (125, 25, 'item125');
+INSERT INTO items VALUES (126, 26, 'item126');
+INSERT INTO items VALUES (127, 27, 'item127');
+INSERT INTO items VALUES (128, 28, 'item128');
+INSERT INTO items VALUES (129, 29, 'item129');
+INSERT INTO items VALUES (130, 30, 'item130');
+INSERT INTO items VALUES (131, 31, 'item131');
+INSERT INTO items VALUES (132, 32, 'item132');
+INSERT INTO items VALUES (133, 33, 'item133');
+INSERT INTO items VALUES (134, 34, 'item134');
+INSERT INTO items VALUES (135, 35, 'item135');
+INSERT INTO items VALUES (136, 36, 'item136');
+INSERT INTO items VALUES (137, 37, 'item137');
+INSERT INTO items VALUES (138, 38, 'item138');
+INSERT INTO items VALUES (139, 39, 'item139');
+INSERT INTO items VALUES (140, 40, 'item140');
+INSERT INTO items VALUES (141, 41, 'item141');
+INSERT INTO items VALUES (142, 42, 'item142');
+INSERT INTO items VALUES (143, 43, 'item143');
+INSERT INTO items VALUES (144, 44, 'item144');
+INSERT INTO items VALUES (145, 45, 'item145');
+INSERT INTO items VALUES (146, 46, 'item146');
+INSERT INTO items VALUES (147, 47, 'item147');
+INSERT INTO items VALUES (148, 48, 'item148');
+INSERT INTO items VALUES (149, 49, 'item149');
+INSERT INTO items VALUES (150, 50, 'item150');
+INSERT INTO items VALUES (151, 51, 'item151');
+INSERT INTO items VALUES (152, 52, 'item152');
+INSERT INTO items VALUES (153, 53, 'item153');
+INSERT INTO items VALUES (154, 54, 'item154');
+INSERT INTO items VALUES (155, 55, 'item155');
+INSERT INTO items VALUES (156, 56, 'item156');
+INSERT INTO items VALUES (157, 57, 'item157');
+INSERT INTO items VALUES (158, 58, 'item158');
+INSERT INTO items VALUES (159, 59, 'item159');
+INSERT INTO items VALUES (160, 60, 'item160');
+INSERT INTO items VALUES (161, 61, 'item161');
+INSERT INTO items VALUES (162, 62, 'item162');
+INSERT INTO items VALUES (163, 63, 'item163');
+INSERT INTO items VALUES (164, 64, 'item164');
+INSERT INTO items VALUES (165, 65, 'item165');
+INSERT INTO items VALUES (166, 66, 'item166');
+INSERT INTO items VALUES (167, 67, 'item167');
+INSERT INTO items VALUES (168, 68, 'item168');
+INSERT INTO items VALUES (169, 69, 'item169');
+INSERT INTO items VALUES (170, 70, 'item170');
+INSERT INTO items VALUES (171, 71, 'item171');
+INSERT INTO items VALUES (172, 72, 'item172');
+INSERT INTO items VALUES (173, 73, 'item173');
+INSERT INTO items VALUES (174, 74, 'item174');
+INSERT INTO items VALUES (175, 75, 'item175');
+INSERT INTO items VALUES (176, 76, 'item176');
+INSERT INTO items VALUES (177, 77, 'item177');
+INSERT INTO items VALUES (178, 78, 'item178');
+INSERT INTO items VALUES (179, 79, 'item179');
+INSERT INTO items VALUES (180, 80, 'item180');
+INSERT INTO items VALUES (181, 81, 'item181');
+INSERT INTO items VALUES (182, 82, 'item182');
+INSERT INTO items VALUES (183, 83, 'item183');
+INSERT INTO items VALUES (184, 84, 'item184');
+INSERT INTO items VALUES (185, 85, 'item185');
+INSERT INTO items VALUES (186, 86, 'item186');
+INSERT INTO items VALUES (187, 87, 'item187');
+INSERT INTO items VALUES (188, 88, 'item188');
+INSERT INTO items VALUES (189, 89, 'item189');
+INSERT INTO items VALUES (190, 90, 'item190');
+INSERT INTO items VALUES (191, 91, 'item191');
+INSERT INTO items VALUES (192, 92, 'item192');
+INSERT INTO items VALUES (193, 93, 'item193');
+INSERT INTO items VALUES (194, 94, 'item194');
+INSERT INTO items VALUES (195, 95, 'item195');
+INSERT INTO items VALUES (196, 96, 'item196');
+INSERT INTO items VALUES (197, 97, 'item197');
+INSERT INTO items VALUES (198, 98, 'item198');
+INSERT INTO items VALUES (199, 99, 'item199');
+INSERT INTO items VALUES (200, 0, 'item200');
+INSERT INTO items VALUES (201, 1, 'item201');
+INSERT INTO items VALUES (202, 2, 'item202');
+INSERT INTO items VALUES (203, 3, 'item203');
+INSERT INTO items VALUES (204, 4, 'item204');
+INSERT INTO items VALUES (205, 5, 'item205');
+INSERT INTO items VALUES (206, 6, 'item206');
+INSERT INTO items VALUES (207, 7, 'item207');
+INSERT INTO items VALUES (208, 8, 'item208');
+INSERT INTO items VALUES (209, 9, 'item209');
+INSERT INTO items VALUES (210, 10, 'item210');
+INSERT INTO items VALUES (211, 11, 'item211');
+INSERT INTO items VALUES (212, 12, 'item212');
+INSERT INTO items VALUES (213, 13, 'item213');
+INSERT INTO items VALUES (214, 14, 'item214');
+INSERT INTO items VALUES (215, 15, 'item215');
+INSERT INTO items VALUES (216, 16, 'item216');
+INSERT INTO items VALUES (217, 17, 'item217');
+INSERT INTO items VALUES (218, 18, 'item218');
+INSERT INTO items VALUES (219, 19, 'item219');
+INSERT INTO items VALUES (220, 20, 'item220');
+INSERT INTO items VALUES (221, 21, 'item221');
+INSERT INTO items VALUES (222, 22, 'item222');
+INSERT INTO items VALUES (223, 23, 'item223');
+INSERT INTO items VALUES (224, 24, 'item224');
+INSERT INTO items VALUES (225, 25, 'item225');
+INSERT INTO items VALUES (226, 26, 'item226');
+INSERT INTO items VALUES (227, 27, 'item227');
+INSERT INTO items VALUES (228, 28, 'item228');
+INSERT INTO items VALUES (229, 29, 'item229');
+INSERT INTO items VALUES (230, 30, 'item230');
+INSERT INTO items VALUES (231, 31, 'item231');
+INSERT INTO items VALUES (232, 32, 'item232');
+INSERT INTO items VALUES (233, 33, 'item233');
+INSERT INTO items VALUES (234, 34, 'item234');
+INSERT INTO items VALUES (235, 35, 'item235');
+INSERT INTO items VALUES (236, 36, 'item236');
+INSERT INTO items VALUES (237, 37, 'item237');
+INSERT INTO items VALUES (238, 38, 'item238');
+INSERT INTO items VALUES (239, 39, 'item239');
+INSERT INTO items VALUES (240, 40, 'item240');
+INSERT INTO items VALUES (241, 41, 'item241');
+INSERT INTO items VALUES (242, 42, 'item242');
+INSERT INTO items VALUES (243, 43, 'item243');
+INSERT INTO items VALUES (244, 44, 'item244');
+INSERT INTO items VALUES (245, 45, 'item245');
+INSERT INTO items VALUES (246, 46, 'item246');
+INSERT INTO items VALUES (247, 47, 'item247');
+INSERT INTO items VALUES (248, 48, 'item248');
+INSERT INTO items VALUES (249, 49, 'item249');
+INSERT INTO items VALUES (250, 50, 'item250');
+INSERT INTO items VALUES (251, 51, 'item251');
+INSERT INTO items VALUES (252, 52, 'item252');
+INSERT INTO items VALUES (253, 53, 'item253');
+INSERT INTO items VALUES (254, 54, 'item254');
+INSERT INTO items VALUES (255, 55, 'item255');
+INSERT INTO items VALUES (256, 56, 'item256');
+INSERT INTO items VALUES (257, 57, 'item257');
+INSERT INTO items VALUES (258, 58, 'item258');
+INSERT INTO items VALUES (259, 59, 'item259');
+INSERT INTO items VALUES (260, 60, 'item260');
+INSERT INTO items VALUES (261, 61, 'item261');
+INSERT INTO items VALUES (262, 62, 'item262');
+INSERT INTO items VALUES (263, 63, 'item263');
+INSERT INTO items VALUES (264, 64, 'item264');
+INSERT INTO items VALUES (265, 65, 'item265');
+INSERT INTO items VALUES (266, 66, 'item266');
+INSERT INTO items VALUES (267, 67, 'item267');
+INSERT INTO items VALUES (268, 68, 'item268');
+INSERT INTO items VALUES (269, 69, 'item269');
+INSERT INTO items VALUES (270, 70, 'item270');
+INSERT INTO items VALUES (271, 71, 'item271');
+INSERT INTO items VALUES (272, 72, 'item272');
+INSERT INTO items VALUES (273, 73, 'item273');
+INSERT INTO items VALUES (274, 74, 'item274');
+INSERT INTO items VALUES (275, 75, 'item275');
+INSERT INTO items VALUES (276, 76, 'item276');
+INSERT INTO items VALUES (277, 77, 'item277');
+INSERT INTO items VALUES (278, 78, 'item278');
+INSERT INTO items VALUES (279, 79, 'item279');
+INSERT INTO items VALUES (280, 80, 'item280');
+INSERT INTO items VALUES (281, 81, 'item281');
+INSERT INTO items VALUES (282, 82, 'item282');
+INSERT INTO items VALUES (283, 83, 'item283');
+INSERT INTO items VALUES (284, 84, 'item284');
+INSERT INTO items VALUES (285, 85, 'item285');
+INSERT INTO items VALUES (286, 86, 'item286');
+INSERT INTO items VALUES (287, 87, 'item287');
+INSERT INTO items VALUES (288, 88, 'item288');
+INSERT INTO items VALUES (289, 89, 'item289');
+INSERT INTO items VALUES (290, 90, 'item290');
+INSERT INTO items VALUES (291, 91, 'item291');
+INSERT INTO items VALUES (292, 92, 'item292');
+INSERT INTO items VALUES (293, 93, 'item293');
+INSERT INTO items VALUES (294, 94, 'item294');
+INSERT INTO items VALUES (295, 95, 'item295');
+INSERT INTO items VALUES (296, 96, 'item296');
+INSERT INTO items VALUES (297, 97, 'item297');
+INSERT INTO items VALUES (298, 98, 'item298');
+INSERT INTO items VALUES (299, 99, 'item299');
+INSERT INTO items VALUES (300, 0, 'item300');
+INSERT INTO items VALUES (301, 1, 'item301');
+INSERT INTO items VALUES (302, 2, 'item302');
+INSERT INTO items VALUES (303, 3, 'item303');
+INSERT INTO items VALUES (304, 4, 'item304');
+INSERT INTO items VALUES (305, 5, 'item305');
+INSERT INTO items VALUES (306, 6, 'item306');
+INSERT INTO items VALUES (307, 7, 'item307');
+INSERT INTO items VALUES (308, 8, 'item308');
+INSERT INTO items VALUES (309, 9, 'item309');
+INSERT INTO items VALUES (310, 10, 'item310');
+INSERT INTO items VALUES (311, 11, 'item311');
+INSERT INTO items VALUES (312, 12, 'item312');
+INSERT INTO items VALUES (313, 13, 'item313');
+INSERT INTO items VALUES (314, 14, 'item314');
+INSERT INTO items VALUES (315, 15, 'item315');
+INSERT INTO items VALUES (316, 16, 'item316');
+INSERT INTO items VALUES (317, 17, 'item317');
+INSERT INTO items VALUES (318, 18, 'item318');
+INSERT INTO items VALUES (319, 19, 'item319');
+INSERT INTO items VALUES (320, 20, 'item320');
+INSERT INTO items VALUES (321, 21, 'item321');
+INSERT INTO items VALUES (322, 22, 'item322');
+INSERT INTO items VALUES (323, 23, 'item323');
+INSERT INTO items VALUES (324, 24, 'item324');
+INSERT INTO items VALUES (325, 25, 'item325');
+INSERT INTO items VALUES (326, 26, 'item326');
+INSERT INTO items VALUES (327, 27, 'item327');
+INSERT INTO items VALUES (328, 28, 'item328');
+INSERT INTO items VALUES (329, 29, 'item329');
+INSERT INTO items VALUES (330, 30, 'item330');
+INSERT INTO items VALUES (331, 31, 'item331');
+INSERT INTO items VALUES (332, 32, 'item332');
+INSERT INTO items VALUES (333, 33, 'item333');
+INSERT INTO items VALUES (334, 34, 'item334');
+INSERT INTO items VALUES (335, 35, 'item335');
+INSERT INTO items VALUES (336, 36, 'item336');
+INSERT INTO items VALUES (337, 37, 'item337');
+INSERT INTO items VALUES (338, 38, 'item338');
+INSERT INTO items VALUES (339, 39, 'item339');
+INSERT INTO items VALUES (340, 40, 'item340');
+INSERT INTO items VALUES (341, 41, 'item341');
+INSERT INTO items VALUES (342, 42, 'item342');
+INSERT INTO items VALUES (343, 43, 'item343');
+INSERT INTO items VALUES (344, 44, 'item344');
+INSERT INTO items VALUES (345, 45, 'item345');
+INSERT INTO items VALUES (346, 46, 'item346');
+INSERT INTO items VALUES (347, 47, 'item347');
+INSERT INTO items VALUES (348, 48, 'item348');
+INSERT INTO items VALUES (349, 49, 'item349');
+INSERT INTO items VALUES (350, 50, 'item350');
+INSERT INTO items VALUES (351, 51, 'item351');
+INSERT INTO items VALUES (352, 52, 'item352');
+INSERT INTO items VALUES (353, 53, 'item353');
+INSERT INTO items VALUES (354, 54, 'item354');
+INSERT INTO items VALUES (355, 55, 'item355');
+INSERT INTO items VALUES (356, 56, 'item356');
+INSERT INTO items VALUES (357, 57, 'item357');
+INSERT INTO items VALUES (358, 58, 'item358');
+INSERT INTO items VALUES (359, 59, 'item359');
+INSERT INTO items VALUES (360, 60, 'item360');
+INSERT INTO items VALUES (361, 61, 'item361');
+INSERT INTO items VALUES (362, 62, 'item362');
+INSERT INTO items VALUES (363, 63, 'item363');
+INSERT INTO items VALUES (364, 64, 'item364');
+INSERT INTO items VALUES (365, 65, 'item365');
+INSERT INTO items VALUES (366, 66, 'item366');
+INSERT INTO items VALUES (367, 67, 'item367');
+INSERT INTO items VALUES (368, 68, 'item368');
+INSERT INTO items VALUES (369, 69, 'item369');
+INSERT INTO items VALUES (370, 70, 'item370');
+INSERT INTO items VALUES (371, 71, 'item371');
+INSERT INTO items VALUES (372, 72, 'item372');
+INSERT INTO items VALUES (373, 73, 'item373');
+INSERT INTO items VALUES (374, 74, 'item374');
+INSERT INTO items VALUES (375, 75, 'item375');
+INSERT INTO items VALUES (376, 76, 'item376');
+INSERT INTO items VALUES (377, 77, 'item377');
+INSERT INTO items VALUES (378, 78, 'item378');
+INSERT INTO items VALUES (379, 79, 'item379');
+INSERT INTO items VALUES (380, 80, 'item380');
+INSERT INTO items VALUES (381, 81, 'item381');
+INSERT INTO items VALUES (382, 82, 'item382');
+INSERT INTO items VALUES (383, 83, 'item383');
+INSERT INTO items VALUES (384, 84, 'item384');
+INSERT INTO items VALUES (385, 85, 'item385');
+INSERT INTO items VALUES (386, 86, 'item386');
+INSERT INTO items VALUES (387, 87, 'item387');
+INSERT INTO items VALUES (388, 88, 'item388');
+INSERT INTO items VALUES (389, 89, 'item389');
+INSERT INTO items VALUES (390, 90, 'item390');
+INSERT INTO items VALUES (391, 91, 'item391');
+INSERT INTO items VALUES (392, 92, 'item392');
+INSERT INTO items VALUES (393, 93, 'item393');
+INSERT INTO items VALUES (394, 94, 'item394');
+INSERT INTO items VALUES (395, 95, 'item395');
+INSERT INTO items VALUES (396, 96, 'item396');
+INSERT INTO items VALUES (397, 97, 'item397');
+INSERT INTO items VALUES (398, 98, 'item398');
+INSERT INTO items VALUES (399, 99, 'item399');
+INSERT INTO items VALUES (400, 0, 'item400');
+INSERT INTO items VALUES (401, 1, 'item401');
+INSERT INTO items VALUES (402, 2, 'item402');
+INSERT INTO items VALUES (403, 3, 'item403');
+INSERT INTO items VALUES (404, 4, 'item404');
+INSERT INTO items VALUES (405, 5, 'item405');
+INSERT INTO items VALUES (406, 6, 'item406');
+INSERT INTO items VALUES (407, 7, 'item407');
+INSERT INTO items VALUES (408, 8, 'item408');
+INSERT INTO items VALUES (409, 9, 'item409');
+INSERT INTO items VALUES (410, 10, 'item410');
+INSERT INTO items VALUES (411, 11, 'item411');
+INSERT INTO items VALUES (412, 12, 'item412');
+INSERT INTO items VALUES (413, 13, 'item413');
+INSERT INTO items VALUES (414, 14, 'item414');
+INSERT INTO items VALUES (415, 15, 'item415');
+INSERT INTO items VALUES (416, 16, 'item416');
+INSERT INTO items VALUES (417, 17, 'item417');
+INSERT INTO items VALUES (418, 18, 'item418');
+INSERT INTO items VALUES (419, 19, 'item419');
+INSERT INTO items VALUES (420, 20, 'item420');
+INSERT INTO items VALUES (421, 21, 'item421');
+INSERT INTO items VALUES (422, 22, 'item422');
+INSERT INTO items VALUES (423, 23, 'item423');
+INSERT INTO items VALUES (424, 24, 'item424');
+INSERT INTO items VALUES (425, 25, 'item425');
+INSERT INTO items VALUES (426, 26, 'item426');
+INSERT INTO items VALUES (427, 27, 'item427');
+INSERT INTO items VALUES (428, 28, 'item428');
+INSERT INTO items VALUES (429, 29, 'item429');
+INSERT INTO items VALUES (430, 30, 'item430');
+INSERT INTO items VALUES (431, 31, 'item431');
+INSERT INTO items VALUES (432, 32, 'item432');
+INSERT INTO items VALUES (433, 33, 'item433');
+INSERT INTO items VALUES (434, 34, 'item434');
+INSERT INTO items VALUES (435, 35, 'item435');
+INSERT INTO items VALUES (436, 36, 'item436');
+INSERT INTO items VALUES (437, 37, 'item437');
+INSERT INTO items VALUES (438, 38, 'item438');
+INSERT INTO items VALUES (439, 39, 'item439');
+INSERT INTO items VALUES (440, 40, 'item440');
+INSERT INTO items VALUES (441, 41, 'item441');
+INSERT INTO items VALUES (442, 42, 'item442');
+INSERT INTO items VALUES (443, 43, 'item443');
+INSERT INTO items VALUES (444, 44, 'item444');
+INSERT INTO items VALUES (445, 45, 'item445');
+INSERT INTO items VALUES (446, 46, 'item446');
+INSERT INTO items VALUES (447, 47, 'item447');
+INSERT INTO items VALUES (448, 48, 'item448');
+INSERT INTO items VALUES (449, 49, 'item449');
+INSERT INTO items VALUES (450, 50, 'item450');
+INSERT INTO items VALUES (451, 51, 'item451');
+INSERT INTO items VALUES (452, 52, 'item452');
+INSERT INTO items VALUES (453, 53, 'item453');
+INSERT INTO items VALUES (454, 54, 'item454');
+INSERT INTO items VALUES (455, 55, 'item455');
+INSERT INTO items VALUES (456, 56, 'item456');
+INSERT INTO items VALUES (457, 57, 'item457');
+INSERT INTO items VALUES (458, 58, 'item458');
+INSERT INTO items VALUES (459, 59, 'item459');
+INSERT INTO items VALUES (460, 60, 'item460');
+INSERT INTO items VALUES (461, 61, 'item461');
+INSERT INTO items VALUES (462, 62, 'item462');
+INSERT INTO items VALUES (463, 63, 'item463');
+INSERT INTO items VALUES (464, 64, 'item464');
+INSERT INTO items VALUES (465, 65, 'item465');
+INSERT INTO items VALUES (466, 66, 'item466');
+INSERT INTO items VALUES (467, 67, 'item467');
+INSERT INTO items VALUES (468, 68, 'item468');
+INSERT INTO items VALUES (469, 69, 'item469');
+INSERT INTO items VALUES (470, 70, 'item470');
+INSERT INTO items VALUES (471, 71, 'item471');
+INSERT INTO items VALUES (472, 72, 'item472');
+INSERT INTO items VALUES (473, 73, 'item473');
+INSERT INTO items VALUES (474, 74, 'item474');
+INSERT INTO items VALUES (475, 75, 'item475');
+INSERT INTO items VALUES (476, 76, 'item476');
+INSERT INTO items VALUES (477, 77, 'item477');
+INSERT INTO items VALUES (478, 78, 'item478');
+INSERT INTO items VALUES (479, 79, 'item479');
+INSERT INTO items VALUES (480, 80, 'item480');
+INSERT INTO items VALUES (481, 81, 'item481');
+INSERT INTO items VALUES (482, 82, 'item482');
+INSERT INTO items VALUES (483, 83, 'item483');
+INSERT INTO items VALUES (484, 84, 'item484');
+INSERT INTO items VALUES (485, 85, 'item485');
+INSERT INTO items VALUES (486, 86, 'item486');
+INSERT INTO items VALUES (487, 87, 'item487');
+INSERT INTO items VALUES (488, 88, 'item488');
+INSERT INTO items VALUES (489, 89, 'item489');
+INSERT INTO items VALUES (490, 90, 'item490');
+INSERT INTO items VALUES (491, 91, 'item491');
+INSERT INTO items VALUES (492, 92, 'item492');
+INSERT INTO items VALUES (493, 93, 'item493');
+INSERT INTO items VALUES (494, 94, 'item494');
+INSERT INTO items VALUES (495, 95, 'item495');
+INSERT INTO items VALUES (496, 96, 'item496');
+INSERT INTO items VALUES (497, 97, 'item497');
+INSERT INTO items VALUES (498, 98, 'item498');
+INSERT INTO items VALUES (499, 99, 'item499');
+INSERT INTO items VALUES (500, 0, 'item500');
+INSERT INTO items VALUES (501, 1, 'item501');
+INSERT INTO items VALUES (502, 2, 'item502');
+INSERT INTO items VALUES (503, 3, 'item503');
+INSERT INTO items VALUES (504, 4, 'item504');
+INSERT INTO items VALUES (505, 5, 'item505');
+INSERT INTO items VALUES (506, 6, 'item506');
+INSERT INTO items VALUES (507, 7, 'item507');
+INSERT INTO items VALUES (508, 8, 'item508');
+INSERT INTO items VALUES (509, 9, 'item509');
+INSERT INTO items VALUES (510, 10, 'item510');
+INSERT INTO items VALUES (511, 11, 'item511');
+INSERT INTO items VALUES (512, 12, 'item512');
+INSERT INTO items VALUES (513, 13, 'item513');
+INSERT INTO items VALUES (514, 14, 'item514');
+INSERT INTO items VALUES (515, 15, 'item515');
+INSERT INTO items VALUES (516, 16, 'item516');
+INSERT INTO items VALUES (517, 17, 'item517');
+INSERT INTO items VALUES (518, 18, 'item518');
+INSERT INTO items VALUES (519, 19, 'item519');
+INSERT INTO items VALUES (520, 20, 'item520');
+INSERT INTO items VALUES (521, 21, 'item521');
+INSERT INTO items VALUES (522, 22, 'item522');
+INSERT INTO items VALUES (523, 23, 'item523');
+INSERT INTO items VALUES (524, 24, 'item524');
+INSERT INTO items VALUES (525, 25, 'item525');
+INSERT INTO items VALUES (526, 26, 'item526');
+INSERT INTO items VALUES (527, 27, 'item527');
+INSERT INTO items VALUES (528, 28, 'item528');
+INSERT INTO items VALUES (529, 29, 'item529');
+INSERT INTO items VALUES (530, 30, 'item530');
+INSERT INTO items VALUES (531, 31, 'item531');
+INSERT INTO items VALUES (532, 32, 'item532');
+INSERT INTO items VALUES (533, 33, 'item533');
+INSERT INTO items VALUES (534, 34, 'item534');
+INSERT INTO items VALUES (535, 35, 'item535');
+INSERT INTO items VALUES (536, 36, 'item536');
+INSERT INTO items VALUES (537, 37, 'item537');
+INSERT INTO items VALUES (538, 38, 'item538');
+INSERT INTO items VALUES (539, 39, 'item539');
+INSERT INTO items VALUES (540, 40, 'item540');
+INSERT INTO items VALUES (541, 41, 'item541');
+INSERT INTO items VALUES (542, 42, 'item542');
+INSERT INTO items VALUES (543, 43, 'item543');
+INSERT INTO items VALUES (544, 44, 'item544');
+INSERT INTO items VALUES (545, 45, 'item545');
+INSERT INTO items VALUES (546, 46, 'item546');
+INSERT INTO items VALUES (547, 47, 'item547');
+INSERT INTO items VALUES (548, 48, 'item548');
+INSERT INTO items VALUES (549, 49, 'item549');
+INSERT INTO items VALUES (550, 50, 'item550');
+INSERT INTO items VALUES (551, 51, 'item551');
+INSERT INTO items VALUES (552, 52, 'item552');
+INSERT INTO items VALUES (553, 53, 'item553');
+INSERT INTO items VALUES (554, 54, 'item554');
+INSERT INTO items VALUES (555, 55, 'item555');
+INSERT INTO items VALUES (556, 56, 'item556');
+INSERT INTO items VALUES (557, 57, 'item557');
+INSERT INTO items VALUES (558, 58, 'item558');
+INSERT INTO items VALUES (559, 59, 'item559');
+INSERT INTO items VALUES (560, 60, 'item560');
+INSERT INTO items VALUES (561, 61, 'item561');
+INSERT INTO items VALUES (562, 62, 'item562');
+INSERT INTO items VALUES (563, 63, 'item563');
+INSERT INTO items VALUES (564, 64, 'item564');
+INSERT INTO items VALUES (565, 65, 'item565');
+INSERT INTO items VALUES (566, 66, 'item566');
+INSERT INTO items VALUES (567, 67, 'item567');
+INSERT INTO items VALUES (568, 68, 'item568');
+INSERT INTO items VALUES (569, 69, 'item569');
+INSERT INTO items VALUES (570, 70, 'item570');
+INSERT INTO items VALUES (571, 71, 'item571');
+INSERT INTO items VALUES (572, 72, 'item572');
+INSERT INTO items VALUES (573, 73, 'item573');
+INSERT INTO items VALUES (574, 74, 'item574');
+INSERT INTO items VALUES (575, 75, 'item575');
+INSERT INTO items VALUES (576, 76, 'item576');
+INSERT INTO items VALUES (577, 77, 'item577');
+INSERT INTO items VALUES (578, 78, 'item578');
+INSERT INTO items VALUES (579, 79, 'item579');
+INSERT INTO items VALUES (580, 80, 'item580');
+INSERT INTO items VALUES (581, 81, 'item581');
+INSERT INTO items VALUES (582, 82, 'item582');
+INSERT INTO items VALUES (583, 83, 'item583');
+INSERT INTO items VALUES (584, 84, 'item584');
+INSERT INTO items VALUES (585, 85, 'item585');
+INSERT INTO items VALUES (586, 86, 'item586');
+INSERT INTO items VALUES (587, 87, 'item587');
+INSERT INTO items VALUES (588, 88, 'item588');
+INSERT INTO items VALUES (589, 89, 'item589');
+INSERT INTO items VALUES (590, 90, 'item590');
+INSERT INTO items VALUES (591, 91, 'item591');
+INSERT INTO items VALUES (592, 92, 'item592');
+INSERT INTO items VALUES (593, 93, 'item593');
+INSERT INTO items VALUES (594, 94, 'item594');
+INSERT INTO items VALUES (595, 95, 'item595');
+INSERT INTO items VALUES (596, 96, 'item596');
+INSERT INTO items VALUES (597, 97, 'item597');
+INSERT INTO items VALUES (598, 98, 'item598');
+INSERT INTO items VALUES (599, 99, 'item599');
+INSERT INTO items VALUES (600, 0, 'item600');
+INSERT INTO items VALUES (601, 1, 'item601');
+INSERT INTO items VALUES (602, 2, 'item602');
+INSERT INTO items VALUES (603, 3, 'item603');
+INSERT INTO items VALUES (604, 4, 'item604');
+INSERT INTO items VALUES (605, 5, 'item605');
+INSERT INTO items VALUES (606, 6, 'item606');
+INSERT INTO items VALUES (607, 7, 'item607');
+INSERT INTO items VALUES (608, 8, 'item608');
+INSERT INTO items VALUES (609, 9, 'item609');
+INSERT INTO items VALUES (610, 10, 'item610');
+INSERT INTO items VALUES (611, 11, 'item611');
+INSERT INTO items VALUES (612, 12, 'item612');
+INSERT INTO items VALUES (613, 13, 'item613');
+INSERT INTO items VALUES (614, 14, 'item614');
+INSERT INTO items VALUES (615, 15, 'item615');
+INSERT INTO items VALUES (616, 16, 'item616');
+INSERT INTO items VALUES (617, 17, 'item617');
+INSERT INTO items VALUES (618, 18, 'item618');
+INSERT INTO items VALUES (619, 19, 'item619');
+INSERT INTO items VALUES (620, 20, 'item620');
+INSERT INTO items VALUES (621, 21, 'item621');
+INSERT INTO items VALUES (622, 22, 'item622');
+INSERT INTO items VALUES (623, 23, 'item623');
+INSERT INTO items VALUES (624, 24, 'item624');
+INSERT INTO items VALUES (625, 25, 'item625');
+INSERT INTO items VALUES (626, 26, 'item626');
+INSERT INTO items VALUES (627, 27, 'item627');
+INSERT INTO items VALUES (628, 28, 'item628');
+INSERT INTO items VALUES (629, 29, 'item629');
+INSERT INTO items VALUES (630, 30, 'item630');
+INSERT INTO items VALUES (631, 31, 'item631');
+INSERT INTO items VALUES (632, 32, 'item632');
+INSERT INTO items VALUES (633, 33, 'item633');
+INSERT INTO items VALUES (634, 34, 'item634');
+INSERT INTO items VALUES (635, 35, 'item635');
+INSERT INTO items VALUES (636, 36, 'item636');
+INSERT INTO items VALUES (637, 37, 'item637');
+INSERT INTO items VALUES (638, 38, 'item638');
+INSERT INTO items VALUES (639, 39, 'item639');
+INSERT INTO items VALUES (640, 40, 'item640');
+INSERT INTO items VALUES (641, 41, 'item641');
+INSERT INTO items VALUES (642, 42, 'item642');
+INSERT INTO items VALUES (643, 43, 'item643');
+INSERT INTO items VALUES (644, 44, 'item644');
+INSERT INTO items VALUES (645, 45, 'item645');
+INSERT INTO items VALUES (646, 46, 'item646');
+INSERT INTO items VALUES (647, 47, 'item647');
+INSERT INTO items VALUES (648, 48, 'item648');
+INSERT INTO items VALUES (649, 49, 'item649');
+INSERT INTO items VALUES (650, 50, 'item650');
+INSERT INTO items VALUES (651, 51, 'item651');
+INSERT INTO items VALUES (652, 52, 'item652');
+INSERT INTO items VALUES (653, 53, 'item653');
+INSERT INTO items VALUES (654, 54, 'item654');
+INSERT INTO items VALUES (655, 55, 'item655');
+INSERT INTO items VALUES (656, 56, 'item656');
+INSERT INTO items VALUES (657, 57, 'item657');
+INSERT INTO items VALUES (658, 58, 'item658');
+INSERT INTO items VALUES (659, 59, 'item659');
+INSERT INTO items VALUES (660, 60, 'item660');
+INSERT INTO items VALUES (661, 61, 'item661');
+INSERT INTO items VALUES (662, 62, 'item662');
+INSERT INTO items VALUES (663, 63, 'item663');
+INSERT INTO items VALUES (664, 64, 'item664');
+INSERT INTO items VALUES (665, 65, 'item665');
+INSERT INTO items VALUES (666, 66, 'item666');
+INSERT INTO items VALUES (667, 67, 'item667');
+INSERT INTO items VALUES (668, 68, 'item668');
+INSERT INTO items VALUES (669, 69, 'item669');
+INSERT INTO items VALUES (670, 70, 'item670');
+INSERT INTO items VALUES (671, 71, 'item671');
+INSERT INTO items VALUES (672, 72, 'item672');
+INSERT INTO items VALUES (673, 73, 'item673');
+INSERT INTO items VALUES (674, 74, 'item674');
+INSERT INTO items VALUES (675, 75, 'item675');
+INSERT INTO items VALUES (676, 76, 'item676');
+INSERT INTO items VALUES (677, 77, 'item677');
+INSERT INTO items VALUES (678, 78, 'item678');
+INSERT INTO items VALUES (679, 79, 'item679');
+INSERT INTO items VALUES (680, 80, 'item680');
+INSERT INTO items VALUES (681, 81, 'item681');
+INSERT INTO items VALUES (682, 82, 'item682');
+INSERT INTO items VALUES (683, 83, 'item683');
+INSERT INTO items VALUES (684, 84, 'item684');
+INSERT INTO items VALUES (685, 85, 'item685');
+INSERT INTO items VALUES (686, 86, 'item686');
+INSERT INTO items VALUES (687, 87, 'item687');
+INSERT INTO items VALUES (688, 88, 'item688');
+INSERT INTO items VALUES (689, 89, 'item689');
+INSERT INTO items VALUES (690, 90, 'item690');
+INSERT INTO items VALUES (691, 91, 'item691');
+INSERT INTO items VALUES (692, 92, 'item692');
+INSERT INTO items VALUES (693, 93, 'item693');
+INSERT INTO items VALUES (694, 94, 'item694');
+INSERT INTO items VALUES (695, 95, 'item695');
+INSERT INTO items VALUES (696, 96, 'item696');
+INSERT INTO items VALUES (697, 97, 'item697');
+INSERT INTO items VALUES (698, 98, 'item698');
+INSERT INTO items VALUES (699, 99, 'item699');
+INSERT INTO items VALUES (700, 0, 'item700');
+INSERT INTO items VALUES (701, 1, 'item701');
+INSERT INTO items VALUES (702, 2, 'item702');
+INSERT INTO items VALUES (703, 3, 'item703');
+INSERT INTO items VALUES (704, 4, 'item704');
+INSERT INTO items VALUES (705, 5, 'item705');
+INSERT INTO items VALUES (706, 6, 'item706');
+INSERT INTO items VALUES (707, 7, 'item707');
+INSERT INTO items VALUES (708, 8, 'item708');
+INSERT INTO items VALUES (709, 9, 'item709');
+INSERT INTO items VALUES (710, 10, 'item710');
+INSERT INTO items VALUES (711, 11, 'item711');
+INSERT INTO items VALUES (712, 12, 'item712');
+INSERT INTO items VALUES (713, 13, 'item713');
+INSERT INTO items VALUES (714, 14, 'item714');
+INSERT INTO items VALUES (715, 15, 'item715');
+INSERT INTO items VALUES (716, 16, 'item716');
+INSERT INTO items VALUES (717, 17, 'item717');
+INSERT INTO items VALUES (718, 18, 'item718');
+INSERT INTO items VALUES (719, 19, 'item719');
+INSERT INTO items VALUES (720, 20, 'item720');
+INSERT INTO items VALUES (721, 21, 'item721');
+INSERT INTO items VALUES (722, 22, 'item722');
+INSERT INTO items VALUES (723, 23, 'item723');
+INSERT INTO items VALUES (724, 24, 'item724');
+INSERT INTO items VALUES (725, 25, 'item725');
+INSERT INTO items VALUES (726, 26, 'item726');
+INSERT INTO items VALUES (727, 27, 'item727');
+INSERT INTO items VALUES (728, 28, 'item728');
+INSERT INTO items VALUES (729, 29, 'item729');
+INSERT INTO items VALUES (730, 30, 'item730');
+INSERT INTO items VALUES (731, 31, 'item731');
+INSERT INTO items VALUES (732, 32, 'item732');
+INSERT INTO items VALUES (733, 33, 'item733');
+INSERT INTO items VALUES (734, 34, 'item734');
+INSERT INTO items VALUES (735, 35, 'item735');
+INSERT INTO items VALUES (736, 36, 'item736');
+INSERT INTO items VALUES (737, 37, 'item737');
+INSERT INTO items VALUES (738, 38, 'item738');
+INSERT INTO items VALUES (739, 39, 'item739');
+INSERT INTO items VALUES (740, 40, 'item740');
+INSERT INTO items VALUES (741, 41, 'item741');
+INSERT INTO items VALUES (742, 42, 'item742');
+INSERT INTO items VALUES (743, 43, 'item743');
+INSERT INTO items VALUES (744, 44, 'item744');
+INSERT INTO items VALUES (745, 45, 'item745');
+INSERT INTO items VALUES (746, 46, 'item746');
+INSERT INTO items VALUES (747, 47, 'item747');
+INSERT INTO items VALUES (748, 48, 'item748');
+INSERT INTO items VALUES (749, 49, 'item749');
+INSERT INTO items VALUES (750, 50, 'item750');
+INSERT INTO items VALUES (751, 51, 'item751');
+INSERT INTO items VALUES (752, 52, 'item752');
+INSERT INTO items VALUES (753, 53, 'item753');
+INSERT INTO items VALUES (754, 54, 'item754');
+INSERT INTO items VALUES (755, 55, 'item755');
+INSERT INTO items VALUES (756, 56, 'item756');
+INSERT INTO items VALUES (757, 57, 'item757');
+INSERT INTO items VALUES (758, 58, 'item758');
+INSERT INTO items VALUES (759, 59, 'item759');
+INSERT INTO items VALUES (760, 60, 'item760');
+INSERT INTO items VALUES (761, 61, 'item761');
+INSERT INTO items VALUES (762, 62, 'item762');
+INSERT INTO items VALUES (763, 63, 'item763');
+INSERT INTO items VALUES (764, 64, 'item764');
+INSERT INTO items VALUES (765, 65, 'item765');
+INSERT INTO items VALUES (766, 66, 'item766');
+INSERT INTO items VALUES (767, 67, 'item767');
+INSERT INTO items VALUES (768, 68, 'item768');
+INSERT INTO items VALUES (769, 69, 'item769');
+INSERT INTO items VALUES (770, 70, 'item770');
+INSERT INTO items VALUES (771, 71, 'item771');
+INSERT INTO items VALUES (772, 72, 'item772');
+INSERT INTO items VALUES (773, 73, 'item773');
+INSERT INTO items VALUES (774, 74, 'item774');
+INSERT INTO items VALUES (775, 75, 'item775');
+INSERT INTO items VALUES (776, 76, 'item776');
+INSERT INTO items VALUES (777, 77, 'item777');
+INSERT INTO items VALUES (778, 78, 'item778');
+INSERT INTO items VALUES (779, 79, 'item779');
+INSERT INTO items VALUES (780, 80, 'item780');
+INSERT INTO items VALUES (781, 81, 'item781');
+INSERT INTO items VALUES (782, 82, 'item782');
+INSERT INTO items VALUES (783, 83, 'item783');
+INSERT INTO items VALUES (784, 84, 'item784');
+INSERT INTO items VALUES (785, 85, 'item785');
+INSERT INTO items VALUES (786, 86, 'item786');
+INSERT INTO items VALUES (787, 87, 'item787');
+INSERT INTO items VALUES (788, 88, 'item788');
+INSERT INTO items VALUES (789, 89, 'item789');
+INSERT INTO items VALUES (790, 90, 'item790');
+INSERT INTO items VALUES (791, 91, 'item791');
+INSERT INTO items VALUES (792, 92, 'item792');
+INSERT INTO items VALUES (793, 93, 'item793');
+INSERT INTO items VALUES (794, 94, 'item794');
+INSERT INTO items VALUES (795, 95, 'item795');
+INSERT INTO items VALUES (796, 96, 'item796');
+INSERT INTO items VALUES (797, 97, 'item797');
+INSERT INTO items VALUES (798, 98, 'item798');
+INSERT INTO items VALUES (799, 99, 'item799');
+INSERT INTO items VALUES (800, 0, 'item800');
+INSERT INTO items VALUES (801, 1, 'item801');
+INSERT INTO items VALUES (802, 2, 'item802');
+INSERT INTO items VALUES (803, 3, 'item803');
+INSERT INTO items VALUES (804, 4, 'item804');
+INSERT INTO items VALUES (805, 5, 'item805');
+INSERT INTO items VALUES (806, 6, 'item806');
+INSERT INTO items VALUES (807, 7, 'item807');
+INSERT INTO items VALUES (808, 8, 'item808');
+INSERT INTO items VALUES (809, 9, 'item809');
+INSERT INTO items VALUES (810, 10, 'item810');
+INSERT INTO items VALUES (811, 11, 'item811');
+INSERT INTO items VALUES (812, 12, 'item812');
+INSERT INTO items VALUES (813, 13, 'item813');
+INSERT INTO items VALUES (814, 14, 'item814');
+INSERT INTO items VALUES (815, 15, 'item815');
+INSERT INTO items VALUES (816, 16, 'item816');
+INSERT INTO items VALUES (817, 17, 'item817');
+INSERT INTO items VALUES (818, 18, 'item818');
+INSERT INTO items VALUES (819, 19, 'item819');
+INSERT INTO items VALUES (820, 20, 'item820');
+INSERT INTO items VALUES (821, 21, 'item821');
+INSERT INTO items VALUES (822, 22, 'item822');
+INSERT INTO items VALUES (823, 23, 'item823');
+INSERT INTO items VALUES (824, 24, 'item824');
+INSERT INTO items VALUES (825, 25, 'item825');
+INSERT INTO items VALUES (826, 26, 'item826');
+INSERT INTO items VALUES (827, 27, 'item827');
+INSERT INTO items VALUES (828, 28, 'item828');
+INSERT INTO items VALUES (829, 29, 'item829');
+INSERT INTO items VALUES (830, 30, 'item830');
+INSERT INTO items VALUES (831, 31, 'item831');
+INSERT INTO items VALUES (832, 32, 'item832');
+INSERT INTO items VALUES (833, 33, 'item833');
+INSERT INTO items VALUES (834, 34, 'item834');
+INSERT INTO items VALUES (835, 35, 'item835');
+INSERT INTO items VALUES (836, 36, 'item836');
+INSERT INTO items VALUES (837, 37, 'item837');
+INSERT INTO items VALUES (838, 38, 'item838');
+INSERT INTO items VALUES (839, 39, 'item839');
+INSERT INTO items VALUES (840, 40, 'item840');
+INSERT INTO items VALUES (841, 41, 'item841');
+INSERT INTO items VALUES (842, 42, 'item842');
+INSERT INTO items VALUES (843, 43, 'item843');
+INSERT INTO items VALUES (844, 44, 'item844');
+INSERT INTO items VALUES (845, 45, 'item845');
+INSERT INTO items VALUES (846, 46, 'item846');
+INSERT INTO items VALUES (847, 47, 'item847');
+INSERT INTO items VALUES (848, 48, 'item848');
+INSERT INTO items VALUES (849, 49, 'item849');
+INSERT INTO items VALUES (850, 50, 'item850');
+INSERT INTO items VALUES (851, 51, 'item851');
+INSERT INTO items VALUES (852, 52, 'item852');
+INSERT INTO items VALUES (853, 53, 'item853');
+INSERT INTO items VALUES (854, 54, 'item854');
+INSERT INTO items VALUES (855, 55, 'item855');
+INSERT INTO items VALUES (856, 56, 'item856');
+INSERT INTO items VALUES (857, 57, 'item857');
+INSERT INTO items VALUES (858, 58, 'item858');
+INSERT INTO items VALUES (859, 59, 'item859');
+INSERT INTO items VALUES (860, 60, 'item860');
+INSERT INTO items VALUES (861, 61, 'item861');
+INSERT INTO items VALUES (862, 62, 'item862');
+INSERT INTO items VALUES (863, 63, 'item863');
+INSERT INTO items VALUES (864, 64, 'item864');
+INSERT INTO items VALUES (865, 65, 'item865');
+INSERT INTO items VALUES (866, 66, 'item866');
+INSERT INTO items VALUES (867, 67, 'item867');
+INSERT INTO items VALUES (868, 68, 'item868');
+INSERT INTO items VALUES (869, 69, 'item869');
+INSERT INTO items VALUES (870, 70, 'item870');
+INSERT INTO items VALUES (871, 71, 'item871');
+INSERT INTO items VALUES (872, 72, 'item872');
+INSERT INTO items VALUES (873, 73, 'item873');
+INSERT INTO items VALUES (874, 74, 'item874');
+INSERT INTO items VALUES (875, 75, 'item875');
+INSERT INTO items VALUES (876, 76, 'item876');
+INSERT INTO items VALUES (877, 77, 'item877');
+INSERT INTO items VALUES (878, 78, 'item878');
+INSERT INTO items VALUES (879, 79, 'item879');
+INSERT INTO items VALUES (880, 80, 'item880');
+INSERT INTO items VALUES (881, 81, 'item881');
+INSERT INTO items VALUES (882, 82, 'item882');
+INSERT INTO items VALUES (883, 83, 'item883');
+INSERT INTO items VALUES (884, 84, 'item884');
+INSERT INTO items VALUES (885, 85, 'item885');
+INSERT INTO items VALUES (886, 86, 'item886');
+INSERT INTO items VALUES (887, 87, 'item887');
+INSERT INTO items VALUES (888, 88, 'item888');
+INSERT INTO items VALUES (889, 89, 'item889');
+INSERT INTO items VALUES (890, 90, 'item890');
+INSERT INTO items VALUES (891, 91, 'item891');
+INSERT INTO items VALUES (892, 92, 'item892');
+INSERT INTO items VALUES (893, 93, 'item893');
+INSERT INTO items VALUES (894, 94, 'item894');
+INSERT INTO items VALUES (895, 95, 'item895');
+INSERT INTO items VALUES (896, 96, 'item896');
+INSERT INTO items VALUES (897, 97, 'item897');
+INSERT INTO items VALUES (898, 98, 'item898');
+INSERT INTO items VALUES (899, 99, 'item899');
+INSERT INTO items VALUES (900, 0, 'item900');
+INSERT INTO items VALUES (901, 1, 'item901');
+INSERT INTO items VALUES (902, 2, 'item902');
+INSERT INTO items VALUES (903, 3, 'item903');
+INSERT INTO items VALUES (904, 4, 'item904');
+INSERT INTO items VALUES (905, 5, 'item905');
+INSERT INTO items VALUES (906, 6, 'item906');
+INSERT INTO items VALUES (907, 7, 'item907');
+INSERT INTO items VALUES (908, 8, 'item908');
+INSERT INTO items VALUES (909, 9, 'item909');
+INSERT INTO items VALUES (910, 10, 'item910');
+INSERT INTO items VALUES (911, 11, 'item911');
+INSERT INTO items VALUES (912, 12, 'item912');
+INSERT INTO items VALUES (913, 13, 'item913');
+INSERT INTO items VALUES (914, 14, 'item914');
+INSERT INTO items VALUES (915, 15, 'item915');
+INSERT INTO items VALUES (916, 16, 'item916');
+INSERT INTO items VALUES (917, 17, 'item917');
+INSERT INTO items VALUES (918, 18, 'item918');
+INSERT INTO items VALUES (919, 19, 'item919');
+INSERT INTO items VALUES (920, 20, 'item920');
+INSERT INTO items VALUES (921, 21, 'item921');
+INSERT INTO items VALUES (922, 22, 'item922');
+INSERT INTO items VALUES (923, 23, 'item923');
+INSERT INTO items VALUES (924, 24, 'item924');
+INSERT INTO items VALUES (925, 25, 'item925');
+INSERT INTO items VALUES (926, 26, 'item926');
+INSERT INTO items VALUES (927, 27, 'item927');
+INSERT INTO items VALUES (928, 28, 'item928');
+INSERT INTO items VALUES (929, 29, 'item929');
+INSERT INTO items VALUES (930, 30, 'item930');
+INSERT INTO items VALUES (931, 31, 'item931');
+INSERT INTO items VALUES (932, 32, 'item932');
+INSERT INTO items VALUES (933, 33, 'item933');
+INSERT INTO items VALUES (934, 34, 'item934');
+INSERT INTO items VALUES (935, 35, 'item935');
+INSERT INTO items VALUES (936, 36, 'item936');
+INSERT INTO items VALUES (937, 37, 'item937');
+INSERT INTO items VALUES (938, 38, 'item938');
+INSERT INTO items VALUES (939, 39, 'item939');
+INSERT INTO items VALUES (940, 40, 'item940');
+INSERT INTO items VALUES (941, 41, 'item941');
+INSERT INTO items VALUES (942, 42, 'item942');
+INSERT INTO items VALUES (943, 43, 'item943');
+INSERT INTO items VALUES (944, 44, 'item944');
+INSERT INTO items VALUES (945, 45, 'item945');
+INSERT INTO items VALUES (946, 46, 'item946');
+INSERT INTO items VALUES (947, 47, 'item947');
+INSERT INTO items VALUES (948, 48, 'item948');
+INSERT INTO items VALUES (949, 49, 'item949');
+INSERT INTO items VALUES (950, 50, 'item950');
+INSERT INTO items VALUES (951, 51, 'item951');
+INSERT INTO items VALUES (952, 52, 'item952');
+INSERT INTO items VALUES (953, 53, 'item953');
+INSERT INTO items VALUES (954, 54, 'item954');
+INSERT INTO items VALUES (955, 55, 'item955');
+INSERT INTO items VALUES (956, 56, 'item956');
+INSERT INTO items VALUES (957, 57, 'item957');
+INSERT INTO items VALUES (958, 58, 'item958');
+INSERT INTO items VALUES (959, 59, 'item959');
+INSERT INTO items VALUES (960, 60, 'item960');
+INSERT INTO items VALUES (961, 61, 'item961');
+INSERT INTO items VALUES (962, 62, 'item962');
+INSERT INTO items VALUES (963, 63, 'item963');
+INSERT INTO items VALUES (964, 64, 'item964');
+INSERT INTO items VALUES (965, 65, 'item965');
+INSERT INTO items VALUES (966, 66, 'item966');
+INSERT INTO items VALUES (967, 67, 'item967');
+INSERT INTO items VALUES (968, 68, 'item968');
+INSERT INTO items VALUES (969, 69, 'item969');
+INSERT INTO items VALUES (970, 70, 'item970');
+INSERT INTO items VALUES (971, 71, 'item971');
+INSERT INTO items VALUES (972, 72, 'item972');
+INSERT INTO items VALUES (973, 73, 'item973');
+INSERT INTO items VALUES (974, 74, 'item974');
+INSERT INTO items VALUES (975, 75, 'item975');
+INSERT INTO items VALUES (976, 76, 'item976');
+INSERT INTO items VALUES (977, 77, 'item977');
+INSERT INTO items VALUES (978, 78, 'item978');
+INSERT INTO items VALUES (979, 79, 'item979');
+INSERT INTO items VALUES (980, 80, 'item980');
+INSERT INTO items VALUES (981, 81, 'item981');
+INSERT INTO items VALUES (982, 82, 'item982');
+INSERT INTO items VALUES (983, 83, 'item983');
+INSERT INTO items VALUES (984, 84, 'item984');
+INSERT INTO items VALUES (985, 85, 'item985');
+INSERT INTO items VALUES (986, 86, 'item986');
+INSERT INTO items VALUES (987, 87, 'item987');
+INSERT INTO items VALUES (988, 88, 'item988');
+INSERT INTO items VALUES (989, 89, 'item989');
+INSERT INTO items VALUES (990, 90, 'item990');
+INSERT INTO items VALUES (991, 91, 'item991');
+INSERT INTO items VALUES (992, 92, 'item992');
+INSERT INTO items VALUES (993, 93, 'item993');
+INSERT INTO items VALUES (994, 94, 'item994');
+INSERT INTO items VALUES (995, 95, 'item995');
+INSERT INTO items VALUES (996, 96, 'item996');
+INSERT INTO items VALUES (997, 97, 'item997');
+INSERT INTO items VALUES (998, 98, 'item998');
+INSERT INTO items VALUES (999, 99, 'item999');
+INSERT INTO items VALUES (1000, 0, 'item1000');
+INSERT INTO items VALUES (1001, 1, 'item1001');
+INSERT INTO items VALUES (1002, 2, 'item1002');
+INSERT INTO items VALUES (1003, 3, 'item1003');
+INSERT INTO items VALUES (1004, 4, 'item1004');
+INSERT INTO items VALUES (1005, 5, 'item1005');
+INSERT INTO items VALUES (1006, 6, 'item1006');
+INSERT INTO items VALUES (1007, 7, 'item1007');
+INSERT INTO items VALUES (1008, 8, 'item1008');
+INSERT INTO items VALUES (1009, 9, 'item1009');
+INSERT INTO items VALUES (1010, 10, 'item1010');
+INSERT INTO items VALUES (1011, 11, 'item1011');
+INSERT INTO items VALUES (1012, 12, 'item1012');
+INSERT INTO items VALUES (1013, 13, 'item1013');
+INSERT INTO items VALUES (1014, 14, 'item1014');
+INSERT INTO items VALUES (1015, 15, 'item1015');
+INSERT INTO items VALUES (1016, 16, 'item1016');
+INSERT INTO items VALUES (1017, 17, 'item1017');
+INSERT INTO items VALUES (1018, 18, 'item1018');
+INSERT INTO items VALUES (1019, 19, 'item1019');
+INSERT INTO items VALUES (1020, 20, 'item1020');
+INSERT INTO items VALUES (1021, 21, 'item1021');
+INSERT INTO items VALUES (1022, 22, 'item1022');
+INSERT INTO items VALUES (1023, 23, 'item1023');
+INSERT INTO items VALUES (1024, 24, 'item1024');
+INSERT INTO items VALUES (1025, 25, 'item1025');
+INSERT INTO items VALUES (1026, 26, 'item1026');
+INSERT INTO items VALUES (1027, 27, 'item1027');
+INSERT INTO items VALUES (1028, 28, 'item1028');
+INSERT INTO items VALUES (1029, 29, 'item1029');
+INSERT INTO items VALUES (1030, 30, 'item1030');
+INSERT INTO items VALUES (1031, 31, 'item1031');
+INSERT INTO items VALUES (1032, 32, 'item1032');
+INSERT INTO items VALUES (1033, 33, 'item1033');
+INSERT INTO items VALUES (1034, 34, 'item1034');
+INSERT INTO items VALUES (1035, 35, 'item1035');
+INSERT INTO items VALUES (1036, 36, 'item1036');
+INSERT INTO items VALUES (1037, 37, 'item1037');
+INSERT INTO items VALUES (1038, 38, 'item1038');
+INSERT INTO items VALUES (1039, 39, 'item1039');
+INSERT INTO items VALUES (1040, 40, 'item1040');
+INSERT INTO items VALUES (1041, 41, 'item1041');
+INSERT INTO items VALUES (1042, 42, 'item1042');
+INSERT INTO items VALUES (1043, 43, 'item1043');
+INSERT INTO items VALUES (1044, 44, 'item1044');
+INSERT INTO items VALUES (1045, 45, 'item1045');
+INSERT INTO items VALUES (1046, 46, 'item1046');
+INSERT INTO items VALUES (1047, 47, 'item1047');
+INSERT INTO items VALUES (1048, 48, 'item1048');
+INSERT INTO items VALUES (1049, 49, 'item1049');
+INSERT INTO items VALUES (1050, 50, 'item1050');
+INSERT INTO items VALUES (1051, 51, 'item1051');
+INSERT INTO items VALUES (1052, 52, 'item1052');
+INSERT INTO items VALUES (1053, 53, 'item1053');
+INSERT INTO items VALUES (1054, 54, 'item1054');
+INSERT INTO items VALUES (1055, 55, 'item1055');
+INSERT INTO items VALUES (1056, 56, 'item1056');
+INSERT INTO items VALUES (1057, 57, 'item1057');
+INSERT INTO items VALUES (1058, 58, 'item1058');
+INSERT INTO items VALUES (1059, 59, 'item1059');
+INSERT INTO items VALUES (1060, 60, 'item1060');
+INSERT INTO items VALUES (1061, 61, 'item1061');
+INSERT INTO items VALUES (1062, 62, 'item1062');
+INSERT INTO items VALUES (1063, 63, 'item1063');
+INSERT INTO items VALUES (1064, 64, 'item1064');
+INSERT INTO items VALUES (1065, 65, 'item1065');
+INSERT INTO items VALUES (1066, 66, 'item1066');
+INSERT INTO items VALUES (1067, 67, 'item1067');
+INSERT INTO items VALUES (1068, 68, 'item1068');
+INSERT INTO items VALUES (1069, 69, 'item1069');
+INSERT INTO items VALUES (1070, 70, 'item1070');
+INSERT INTO items VALUES (1071, 71, 'item1071');
+INSERT INTO items VALUES (1072, 72, 'item1072');
+INSERT INTO items VALUES (1073, 73, 'item1073');
+INSERT INTO items VALUES (1074, 74, 'item1074');
+INSERT INTO items VALUES (1075, 75, 'item1075');
+INSERT INTO items VALUES (1076, 76, 'item1076');
+INSERT INTO items VALUES (1077, 77, 'item1077');
+INSERT INTO items VALUES (1078, 78, 'item1078');
+INSERT INTO items VALUES (1079, 79, 'item1079');
+INSERT INTO items VALUES (1080, 80, 'item1080');
+INSERT INTO items VALUES (1081, 81, 'item1081');
+INSERT INTO items VALUES (1082, 82, 'item1082');
+INSERT INTO items VALUES (1083, 83, 'item1083');
+INSERT INTO items VALUES (1084, 84, 'item1084');
+INSERT INTO items VALUES (1085, 85, 'item1085');
+INSERT INTO items VALUES (1086, 86, 'item1086');
+INSERT INTO items VALUES (1087, 87, 'item1087');
+INSERT INTO items VALUES (1088, 88, 'item1088');
+INSERT INTO items VALUES (1089, 89, 'item1089');
+INSERT INTO items VALUES (1090, 90, 'item1090');
+INSERT INTO items VALUES (1091, 91, 'item1091');
+INSERT INTO items VALUES (1092, 92, 'item1092');
+INSERT INTO items VALUES (1093, 93, 'item1093');
+INSERT INTO items VALUES (1094, 94, 'item1094');
+INSERT INTO items VALUES (1095, 95, 'item1095');
+INSERT INTO items VALUES (1096, 96, 'item1096');
+INSERT INTO items VALUES (1097, 97, 'item1097');
+INSERT INTO items VALUES (1098, 98, 'item1098');
+INSERT INTO items VALUES (1099, 99, 'item1099');
+INSERT INTO items VALUES (1100, 0, 'item1100');
+INSERT INTO items VALUES (1101, 1, 'item1101');
+INSERT INTO items VALUES (1102, 2, 'item1102');
+INSERT INTO items VALUES (1103, 3, 'item1103');
+INSERT INTO items VALUES (1104, 4, 'item1104');
+INSERT INTO items VALUES (1105, 5, 'item1105');
+INSERT INTO items VALUES (1106, 6, 'item1106');
+INSERT INTO items VALUES (1107, 7, 'item1107');
+INSERT INTO items VALUES (1108, 8, 'item1108');
+INSERT INTO items VALUES (1109, 9, 'item1109');
+INSERT INTO items VALUES (1110, 10, 'item1110');
+INSERT INTO items VALUES (1111, 11, 'item1111');
+INSERT INTO items VALUES (1112, 12, 'item1112');
+INSERT INTO items VALUES (1113, 13, 'item1113');
+INSERT INTO items VALUES (1114, 14, 'item1114');
+INSERT INTO items VALUES (1115, 15, 'item1115');
+INSERT INTO items VALUES (1116, 16, 'item1116');
+INSERT INTO items VALUES (1117, 17, 'item1117');
+INSERT INTO items VALUES (1118, 18, 'item1118');
+INSERT INTO items VALUES (1119, 19, 'item1119');
+INSERT INTO items VALUES (1120, 20, 'item1120');
+INSERT INTO items VALUES (1121, 21, 'item1121');
+INSERT INTO items VALUES (1122, 22, 'item1122');
+INSERT INTO items VALUES (1123, 23, 'item1123');
+INSERT INTO items VALUES (1124, 24, 'item1124');
+INSERT INTO items VALUES (1125, 25, 'item1125');
+INSERT INTO items VALUES (1126, 26, 'item1126');
+INSERT INTO items VALUES (1127, 27, 'item1127');
+INSERT INTO items VALUES (1128, 28, 'item1128');
+INSERT INTO items VALUES (1129, 29, 'item1129');
+INSERT INTO items VALUES (1130, 30, 'item1130');
+INSERT INTO items VALUES (1131, 31, 'item1131');
+INSERT INTO items VALUES (1132, 32, 'item1132');
+INSERT INTO items VALUES (1133, 33, 'item1133');
+INSERT INTO items VALUES (1134, 34, 'item1134');
+INSERT INTO items VALUES (1135, 35, 'item1135');
+INSERT INTO items VALUES (1136, 36, 'item1136');
+INSERT INTO items VALUES (1137, 37, 'item1137');
+INSERT INTO items VALUES (1138, 38, 'item1138');
+INSERT INTO items VALUES (1139, 39, 'item1139');
+INSERT INTO items VALUES (1140, 40, 'item1140');
+INSERT INTO items VALUES (1141, 41, 'item1141');
+INSERT INTO items VALUES (1142, 42, 'item1142');
+INSERT INTO items VALUES (1143, 43, 'item1143');
+INSERT INTO items VALUES (1144, 44, 'item1144');
+INSERT INTO items VALUES (1145, 45, 'item1145');
+INSERT INTO items VALUES (1146, 46, 'item1146');
+INSERT INTO items VALUES (1147, 47, 'item1147');
+INSERT INTO items VALUES (1148, 48, 'item1148');
+INSERT INTO items VALUES (1149, 49, 'item1149');
+INSERT INTO items VALUES (1150, 50, 'item1150');
+INSERT INTO items VALUES (1151, 51, 'item1151');
+INSERT INTO items VALUES (1152, 52, 'item1152');
+INSERT INTO items VALUES (1153, 53, 'item1153');
+INSERT INTO items VALUES (1154, 54, 'item1154');
+INSERT INTO items VALUES (1155, 55, 'item1155');
+INSERT INTO items VALUES (1156, 56, 'item1156');
+INSERT INTO items VALUES (1157, 57, 'item1157');
+INSERT INTO items VALUES (1158, 58, 'item1158');
+INSERT INTO items VALUES (1159, 59, 'item1159');
+INSERT INTO items VALUES (1160, 60, 'item1160');
+INSERT INTO items VALUES (1161, 61, 'item1161');
+INSERT INTO items VALUES (1162, 62, 'item1162');
+INSERT INTO items VALUES (1163, 63, 'item1163');
+INSERT INTO items VALUES (1164, 64, 'item1164');
+INSERT INTO items VALUES (1165, 65, 'item1165');
+INSERT INTO items VALUES (1166, 66, 'item1166');
+INSERT INTO items VALUES (1167, 67, 'item1167');
+INSERT INTO items VALUES (1168, 68, 'item1168');
+INSERT INTO items VALUES (1169, 69, 'item1169');
+INSERT INTO items VALUES (1170, 70, 'item1170');
+INSERT INTO items VALUES (1171, 71, 'item1171');
+INSERT INTO items VALUES (1172, 72, 'item1172');
+INSERT INTO items VALUES (1173, 73, 'item1173');
+INSERT INTO items VALUES (1174, 74, 'item1174');
+INSERT INTO items VALUES (1175, 75, 'item1175');
+INSERT INTO items VALUES (1176, 76, 'item1176');
+INSERT INTO items VALUES (1177, 77, 'item1177');
+INSERT INTO items VALUES (1178, 78, 'item1178');
+INSERT INTO items VALUES (1179, 79, 'item1179');
+INSERT INTO items VALUES (1180, 80, 'item1180');
+INSERT INTO items VALUES (1181, 81, 'item1181');
+INSERT INTO items VALUES (1182, 82, 'item1182');
+INSERT INTO items VALUES (1183, 83, 'item1183');
+INSERT INTO items VALUES (1184, 84, 'item1184');
+INSERT INTO items VALUES (1185, 85, 'item1185');
+INSERT INTO items VALUES (1186, 86, 'item1186');
+INSERT INTO items VALUES (1187, 87, 'item1187');
+INSERT INTO items VALUES (1188, 88, 'item1188');
+INSERT INTO items VALUES (1189, 89, 'item1189');
+INSERT INTO items VALUES (1190, 90, 'item1190');
+INSERT INTO items VALUES (1191, 91, 'item1191');
+INSERT INTO items VALUES (1192, 92, 'item1192');
+INSERT INTO items VALUES (1193, 93, 'item1193');
+INSERT INTO items VALUES (1194, 94, 'item1194');
+INSERT INTO items VALUES (1195, 95, 'item1195');
+INSERT INTO items VALUES (1196, 96, 'item1196');
+INSERT INTO items VALUES (1197, 97, 'item1197');
+INSERT INTO items VALUES (1198, 98, 'item1198');
+INSERT INTO items VALUES (1199, 99, 'item1199');
+INSERT INTO items VALUES (1200, 0, 'item1200');
+INSERT INTO items VALUES (1201, 1, 'item1201');
+INSERT INTO items VALUES (1202, 2, 'item1202');
+INSERT INTO items VALUES (1203, 3, 'item1203');
+INSERT INTO items VALUES (1204, 4, 'item1204');
+INSERT INTO items VALUES (1205, 5, 'item1205');
+INSERT INTO items VALUES (1206, 6, 'item1206');
+INSERT INTO items VALUES (1207, 7, 'item1207');
+INSERT INTO items VALUES (1208, 8, 'item1208');
+INSERT INTO items VALUES (1209, 9, 'item1209');
+INSERT INTO items VALUES (1210, 10, 'item1210');
+INSERT INTO items VALUES (1211, 11, 'item1211');
+INSERT INTO items VALUES (1212, 12, 'item1212');
+INSERT INTO items VALUES (1213, 13, 'item1213');
+INSERT INTO items VALUES (1214, 14, 'item1214');
+INSERT INTO items VALUES (1215, 15, 'item1215');
+INSERT INTO items VALUES (1216, 16, 'item1216');
+INSERT INTO items VALUES (1217, 17, 'item1217');
+INSERT INTO items VALUES (1218, 18, 'item1218');
+INSERT INTO items VALUES (1219, 19, 'item1219');
+INSERT INTO items VALUES (1220, 20, 'item1220');
+INSERT INTO items VALUES (1221, 21, 'item1221');
+INSERT INTO items VALUES (1222, 22, 'item1222');
+INSERT INTO items VALUES (1223, 23, 'item1223');
+INSERT INTO items VALUES (1224, 24, 'item1224');
+INSERT INTO items VALUES (1225, 25, 'item1225');
+INSERT INTO items VALUES (1226, 26, 'item1226');
+INSERT INTO items VALUES (1227, 27, 'item1227');
+INSERT INTO items VALUES (1228, 28, 'item1228');
+INSERT INTO items VALUES (1229, 29, 'item1229');
+INSERT INTO items VALUES (1230, 30, 'item1230');
+INSERT INTO items VALUES (1231, 31, 'item1231');
+INSERT INTO items VALUES (1232, 32, 'item1232');
+INSERT INTO items VALUES (1233, 33, 'item1233');
+INSERT INTO items VALUES (1234, 34, 'item1234');
+INSERT INTO items VALUES (1235, 35, 'item1235');
+INSERT INTO items VALUES (1236, 36, 'item1236');
+INSERT INTO items VALUES (1237, 37, 'item1237');
+INSERT INTO items VALUES (1238, 38, 'item1238');
+INSERT INTO items VALUES (1239, 39, 'item1239');
+INSERT INTO items VALUES (1240, 40, 'item1240');
+INSERT INTO items VALUES (1241, 41, 'item1241');
+INSERT INTO items VALUES (1242, 42, 'item1242');
+INSERT INTO items VALUES (1243, 43, 'item1243');
+INSERT INTO items VALUES (1244, 44, 'item1244');
+INSERT INTO items VALUES (1245, 45, 'item1245');
+INSERT INTO items VALUES (1246, 46, 'item1246');
+INSERT INTO items VALUES (1247, 47, 'item1247');
+INSERT INTO items VALUES (1248, 48, 'item1248');
+INSERT INTO items VALUES (1249, 49, 'item1249');
+INSERT INTO items VALUES (1250, 50, 'item1250');
+INSERT INTO items VALUES (1251, 51, 'item1251');
+INSERT INTO items VALUES (1252, 52, 'item1252');
+INSERT INTO items VALUES (1253, 53, 'item1253');
+INSERT INTO items VALUES (1254, 54, 'item1254');
+INSERT INTO items VALUES (1255, 55, 'item1255');
+INSERT INTO items VALUES (1256, 56, 'item1256');
+INSERT INTO items VALUES (1257, 57, 'item1257');
+INSERT INTO items VALUES (1258, 58, 'item1258');
+INSERT INTO items VALUES (1259, 59, 'item1259');
+INSERT INTO items VALUES (1260, 60, 'item1260');
+INSERT INTO items VALUES (1261, 61, 'item1261');
+INSERT INTO items VALUES (1262, 62, 'item1262');
+INSERT INTO items VALUES (1263, 63, 'item1263');
+INSERT INTO items VALUES (1264, 64, 'item1264');
+INSERT INTO items VALUES (1265, 65, 'item1265');
+INSERT INTO items VALUES (1266, 66, 'item1266');
+INSERT INTO items VALUES (1267, 67, 'item1267');
+INSERT INTO items VALUES (1268, 68, 'item1268');
+INSERT INTO items VALUES (1269, 69, 'item1269');
+INSERT INTO items VALUES (1270, 70, 'item1270');
+INSERT INTO items VALUES (1271, 71, 'item1271');
+INSERT INTO items VALUES (1272, 72, 'item1272');
+INSERT INTO items VALUES (1273, 73, 'item1273');
+INSERT INTO items VALUES (1274, 74, 'item1274');
+INSERT INTO items VALUES (1275, 75, 'item1275');
+INSERT INTO items VALUES (1276, 76, 'item1276');
+INSERT INTO items VALUES (1277, 77, 'item1277');
+INSERT INTO items VALUES (1278, 78, 'item1278');
+INSERT INTO items VALUES (1279, 79, 'item1279');
+INSERT INTO items VALUES (1280, 80, 'item1280');
+INSERT INTO items VALUES (1281, 81, 'item1281');
+INSERT INTO items VALUES (1282, 82, 'item1282');
+INSERT INTO items VALUES (1283, 83, 'item1283');
+INSERT INTO items VALUES (1284, 84, 'item1284');
+INSERT INTO items VALUES (1285, 85, 'item1285');
+INSERT INTO items VALUES (1286, 86, 'item1286');
+INSERT INTO items VALUES (1287, 87, 'item1287');
+INSERT INTO items VALUES (1288, 88, 'item1288');
+INSERT INTO items VALUES (1289, 89, 'item1289');
+INSERT INTO items VALUES (1290, 90, 'item1290');
+INSERT INTO items VALUES (1291, 91, 'item1291');
+INSERT INTO items VALUES (1292, 92, 'item1292');
+INSERT INTO items VALUES (1293, 93, 'item1293');
+INSERT INTO items VALUES (1294, 94, 'item1294');
+INSERT INTO items VALUES (1295, 95, 'item1295');
+INSERT INTO items VALUES (1296, 96, 'item1296');
+INSERT INTO items VALUES (1297, 97, 'item1297');
+INSERT INTO items VALUES (1298, 98, 'item1298');
+INSERT INTO items VALUES (1299, 99, 'item1299');
+INSERT INTO items VALUES (1300, 0, 'item1300');
+INSERT INTO items VALUES (1301, 1, 'item1301');
+INSERT INTO items VALUES (1302, 2, 'item1302');
+INSERT INTO items VALUES (1303, 3, 'item1303');
+INSERT INTO items VALUES (1304, 4, 'item1304');
+INSERT INTO items VALUES (1305, 5, 'item1305');
+INSERT INTO items VALUES (1306, 6, 'item1306');
+INSERT INTO items VALUES (1307, 7, 'item1307');
+INSERT INTO items VALUES (1308, 8, 'item1308');
+INSERT INTO items VALUES (1309, 9, 'item1309');
+INSERT INTO items VALUES (1310, 10, 'item1310');
+INSERT INTO items VALUES (1311, 11, 'item1311');
+INSERT INTO items VALUES (1312, 12, 'item1312');
+INSERT INTO items VALUES (1313, 13, 'item1313');
+INSERT INTO items VALUES (1314, 14, 'item1314');
+INSERT INTO items VALUES (1315, 15, 'item1315');
+INSERT INTO items VALUES (1316, 16, 'item1316');
+INSERT INTO items VALUES (1317, 17, 'item1317');
+INSERT INTO items VALUES (1318, 18, 'item1318');
+INSERT INTO items VALUES (1319, 19, 'item1319');
+INSERT INTO items VALUES (1320, 20, 'item1320');
+INSERT INTO items VALUES (1321, 21, 'item1321');
+INSERT INTO items VALUES (1322, 22, 'item1322');
+INSERT INTO items VALUES (1323, 23, 'item1323');
+INSERT INTO items VALUES (1324, 24, 'item1324');
+INSERT INTO items VALUES (1325, 25, 'item1325');
+INSERT INTO items VALUES (1326, 26, 'item1326');
+INSERT INTO items VALUES (1327, 27, 'item1327');
+INSERT INTO items VALUES (1328, 28, 'item1328');
+INSERT INTO items VALUES (1329, 29, 'item1329');
+INSERT INTO items VALUES (1330, 30, 'item1330');
+INSERT INTO items VALUES (1331, 31, 'item1331');
+INSERT INTO items VALUES (1332, 32, 'item1332');
+INSERT INTO items VALUES (1333, 33, 'item1333');
+INSERT INTO items VALUES (1334, 34, 'item1334');
+INSERT INTO items VALUES (1335, 35, 'item1335');
+INSERT INTO items VALUES (1336, 36, 'item1336');
+INSERT INTO items VALUES (1337, 37, 'item1337');
+INSERT INTO items VALUES (1338, 38, 'item1338');
+INSERT INTO items VALUES (1339, 39, 'item1339');
+INSERT INTO items VALUES (1340, 40, 'item1340');
+INSERT INTO items VALUES (1341, 41, 'item1341');
+INSERT INTO items VALUES (1342, 42, 'item1342');
+INSERT INTO items VALUES (1343, 43, 'item1343');
+INSERT INTO items VALUES (1344, 44, 'item1344');
+INSERT INTO items VALUES (1345, 45, 'item1345');
+INSERT INTO items VALUES (1346, 46, 'item1346');
+INSERT INTO items VALUES (1347, 47, 'item1347');
+INSERT INTO items VALUES (1348, 48, 'item1348');
+INSERT INTO items VALUES (1349, 49, 'item1349');
+INSERT INTO items VALUES (1350, 50, 'item1350');
+INSERT INTO items VALUES (1351, 51, 'item1351');
+INSERT INTO items VALUES (1352, 52, 'item1352');
+INSERT INTO items VALUES (1353, 53, 'item1353');
+INSERT INTO items VALUES (1354, 54, 'item1354');
+INSERT INTO items VALUES (1355, 55, 'item1355');
+INSERT INTO items VALUES (1356, 56, 'item1356');
+INSERT INTO items VALUES (1357, 57, 'item1357');
+INSERT INTO items VALUES (1358, 58, 'item1358');
+INSERT INTO items VALUES (1359, 59, 'item1359');
+INSERT INTO items VALUES (1360, 60, 'item1360');
+INSERT INTO items VALUES (1361, 61, 'item1361');
+INSERT INTO items VALUES (1362, 62, 'item1362');
+INSERT INTO items VALUES (1363, 63, 'item1363');
+INSERT INTO items VALUES (1364, 64, 'item1364');
+INSERT INTO items VALUES (1365, 65, 'item1365');
+INSERT INTO items VALUES (1366, 66, 'item1366');
+INSERT INTO items VALUES (1367, 67, 'item1367');
+INSERT INTO items VALUES (1368, 68, 'item1368');
+INSERT INTO items VALUES (1369, 69, 'item1369');
+INSERT INTO items VALUES (1370, 70, 'item1370');
+INSERT INTO items VALUES (1371, 71, 'item1371');
+INSERT INTO items VALUES (1372, 72, 'item1372');
+INSERT INTO items VALUES (1373, 73, 'item1373');
+INSERT INTO items VALUES (1374, 74, 'item1374');
+INSERT INTO items VALUES (1375, 75, 'item1375');
+INSERT INTO items VALUES (1376, 76, 'item1376');
+INSERT INTO items VALUES (1377, 77, 'item1377');
+INSERT INTO items VALUES (1378, 78, 'item1378');
+INSERT INTO items VALUES (1379, 79, 'item1379');
+INSERT INTO items VALUES (1380, 80, 'item1380');
+INSERT INTO items VALUES (1381, 81, 'item1381');
+INSERT INTO items VALUES (1382, 82, 'item1382');
+INSERT INTO items VALUES (1383, 83, 'item1383');
+INSERT INTO items VALUES (1384, 84, 'item1384');
+INSERT INTO items VALUES (1385, 85, 'item1385');
+INSERT INTO items VALUES (1386, 86, 'item1386');
+INSERT INTO items VALUES (1387, 87, 'item1387');
+INSERT INTO items VALUES (1388, 88, 'item1388');
+INSERT INTO items VALUES (1389, 89, 'item1389');
+INSERT INTO items VALUES (1390, 90, 'item1390');
+INSERT INTO items VALUES (1391, 91, 'item1391');
+INSERT INTO items VALUES (1392, 92, 'item1392');
+INSERT INTO items VALUES (1393, 93, 'item1393');
+INSERT INTO items VALUES (1394, 94, 'item1394');
+INSERT INTO items VALUES (1395, 95, 'item1395');
+INSERT INTO items VALUES (1396, 96, 'item1396');
+INSERT INTO items VALUES (1397, 97, 'item1397');
+INSERT INTO items VALUES (1398, 98, 'item1398');
+INSERT INTO items VALUES (1399, 99, 'item1399');
+INSERT INTO items VALUES (1400, 0, 'item1400');
+INSERT INTO items VALUES (1401, 1, 'item1401');
+INSERT INTO items VALUES (1402, 2, 'item1402');
+INSERT INTO items VALUES (1403, 3, 'item1403');
+INSERT INTO items VALUES (1404, 4, 'item1404');
+INSERT INTO items VALUES (1405, 5, 'item1405');
+INSERT INTO items VALUES (1406, 6, 'item1406');
+INSERT INTO items VALUES (1407, 7, 'item1407');
+INSERT INTO items VALUES (1408, 8, 'item1408');
+INSERT INTO items VALUES (1409, 9, 'item1409');
+INSERT INTO items VALUES (1410, 10, 'item1410');
+INSERT INTO items VALUES (1411, 11, 'item1411');
+INSERT INTO items VALUES (1412, 12, 'item1412');
+INSERT INTO items VALUES (1413, 13, 'item1413');
+INSERT INTO items VALUES (1414, 14, 'item1414');
+INSERT INTO items VALUES (1415, 15, 'item1415');
+INSERT INTO items VALUES (1416, 16, 'item1416');
+INSERT INTO items VALUES (1417, 17, 'item1417');
+INSERT INTO items VALUES (1418, 18, 'item1418');
+INSERT INTO items VALUES (1419, 19, 'item1419');
+INSERT INTO items VALUES (1420, 20, 'item1420');
+INSERT INTO items VALUES (1421, 21, 'item1421');
+INSERT INTO items VALUES (1422, 22, 'item1422');
+INSERT INTO items VALUES (1423, 23, 'item1423');
+INSERT INTO items VALUES (1424, 24, 'item1424');
+INSERT INTO items VALUES (1425, 25, 'item1425');
+INSERT INTO items VALUES (1426, 26, 'item1426');
+INSERT INTO items VALUES (1427, 27, 'item1427');
+INSERT INTO items VALUES (1428, 28, 'item1428');
+INSERT INTO items VALUES (1429, 29, 'item1429');
+INSERT INTO items VALUES (1430, 30, 'item1430');
+INSERT INTO items VALUES (1431, 31, 'item1431');
+INSERT INTO items VALUES (1432, 32, 'item1432');
+INSERT INTO items VALUES (1433, 33, 'item1433');
+INSERT INTO items VALUES (1434, 34, 'item1434');
+INSERT INTO items VALUES (1435, 35, 'item1435');
+INSERT INTO items VALUES (1436, 36, 'item1436');
+INSERT INTO items VALUES (1437, 37, 'item1437');
+INSERT INTO items VALUES (1438, 38, 'item1438');
+INSERT INTO items VALUES (1439, 39, 'item1439');
+INSERT INTO items VALUES (1440, 40, 'item1440');
+INSERT INTO items VALUES (1441, 41, 'item1441');
+INSERT INTO items VALUES (1442, 42, 'item1442');
+INSERT INTO items VALUES (1443, 43, 'item1443');
+INSERT INTO items VALUES (1444, 44, 'item1444');
+INSERT INTO items VALUES (1445, 45, 'item1445');
+INSERT INTO items VALUES (1446, 46, 'item1446');
+INSERT INTO items VALUES (1447, 47, 'item1447');
+INSERT INTO items VALUES (1448, 48, 'item1448');
+INSERT INTO items VALUES (1449, 49, 'item1449');
+INSERT INTO items VALUES (1450, 50, 'item1450');
+INSERT INTO items VALUES (1451, 51, 'item1451');
+INSERT INTO items VALUES (1452, 52, 'item1452');
+INSERT INTO items VALUES (1453, 53, 'item1453');
+INSERT INTO items VALUES (1454, 54, 'item1454');
+INSERT INTO items VALUES (1455, 55, 'item1455');
+INSERT INTO items VALUES (1456, 56, 'item1456');
+INSERT INTO items VALUES (1457, 57, 'item1457');
+INSERT INTO items VALUES (1458, 58, 'item1458');
+INSERT INTO items VALUES (1459, 59, 'item1459');
+INSERT INTO items VALUES (1460, 60, 'item1460');
+INSERT INTO items VALUES (1461, 61, 'item1461');
+INSERT INTO items VALUES (1462, 62, 'item1462');
+INSERT INTO items VALUES (1463, 63, 'item1463');
+INSERT INTO items VALUES (1464, 64, 'item1464');
+INSERT INTO items VALUES (1465, 65, 'item1465');
+INSERT INTO items VALUES (1466, 66, 'item1466');
+INSERT INTO items VALUES (1467, 67, 'item1467');
+INSERT INTO items VALUES (1468, 68, 'item1468');
+INSERT INTO items VALUES (1469, 69, 'item1469');
+INSERT INTO items VALUES (1470, 70, 'item1470');
+INSERT INTO items VALUES (1471, 71, 'item1471');
+INSERT INTO items VALUES (1472, 72, 'item1472');
+INSERT INTO items VALUES (1473, 73, 'item1473');
+INSERT INTO items VALUES (1474, 74, 'item1474');
+INSERT INTO items VALUES (1475, 75, 'item1475');
+INSERT INTO items VALUES (1476, 76, 'item1476');
+INSERT INTO items VALUES (1477, 77, 'item1477');
+INSERT INTO items VALUES (1478, 78, 'item1478');
+INSERT INTO items VALUES (1479, 79, 'item1479');
+INSERT INTO items VALUES (1480, 80, 'item1480');
+INSERT INTO items VALUES (1481, 81, 'item1481');
+INSERT INTO items VALUES (1482, 82, 'item1482');
+INSERT INTO items VALUES (1483, 83, 'item1483');
+INSERT INTO items VALUES (1484, 84, 'item1484');
+INSERT INTO items VALUES (1485, 85, 'item1485');
+INSERT INTO items VALUES (1486, 86, 'item1486');
+INSERT INTO items VALUES (1487, 87, 'item1487');
+INSERT INTO items VALUES (1488, 88, 'item1488');
+INSERT INTO items VALUES (1489, 89, 'item1489');
+INSERT INTO items VALUES (1490, 90, 'item1490');
+INSERT INTO items VALUES (1491, 91, 'item1491');
+INSERT INTO items VALUES (1492, 92, 'item1492');
+INSERT INTO items VALUES (1493, 93, 'item1493');
+INSERT INTO items VALUES (1494, 94, 'item1494');
+INSERT INTO items VALUES (1495, 95, 'item1495');
+INSERT INTO items VALUES (1496, 96, 'item1496');
+INSERT INTO items VALUES (1497, 97, 'item1497');
+INSERT INTO items VALUES (1498, 98, 'item1498');
+INSERT INTO items VALUES (1499, 99, 'item1499');
+INSERT INTO items VALUES (1500, 0, 'item1500');
+INSERT INTO items VALUES (1501, 1, 'item1501');
+INSERT INTO items VALUES (1502, 2, 'item1502');
+INSERT INTO items VALUES (1503, 3, 'item1503');
+INSERT INTO items VALUES (1504, 4, 'item1504');
+INSERT INTO items VALUES (1505, 5, 'item1505');
+INSERT INTO items VALUES (1506, 6, 'item1506');
+INSERT INTO items VALUES (1507, 7, 'item1507');
+INSERT INTO items VALUES (1508, 8, 'item1508');
+INSERT INTO items VALUES (1509, 9, 'item1509');
+INSERT INTO items VALUES (1510, 10, 'item1510');
+INSERT INTO items VALUES (1511, 11, 'item1511');
+INSERT INTO items VALUES (1512, 12, 'item1512');
+INSERT INTO items VALUES (1513, 13, 'item1513');
+INSERT INTO items VALUES (1514, 14, 'item1514');
+INSERT INTO items VALUES (1515, 15, 'item1515');
+INSERT INTO items VALUES (1516, 16, 'item1516');
+INSERT INTO items VALUES (1517, 17, 'item1517');
+INSERT INTO items VALUES (1518, 18, 'item1518');
+INSERT INTO items VALUES (1519, 19, 'item1519');
+INSERT INTO items VALUES (1520, 20, 'item1520');
+INSERT INTO items VALUES (1521, 21, 'item1521');
+INSERT INTO items VALUES (1522, 22, 'item1522');
+INSERT INTO items VALUES (1523, 23, 'item1523');
+INSERT INTO items VALUES (1524, 24, 'item1524');
+INSERT INTO items VALUES (1525, 25, 'item1525');
+INSERT INTO items VALUES (1526, 26, 'item1526');
+INSERT INTO items VALUES (1527, 27, 'item1527');
+INSERT INTO items VALUES (1528, 28, 'item1528');
+INSERT INTO items VALUES (1529, 29, 'item1529');
+INSERT INTO items VALUES (1530, 30, 'item1530');
+INSERT INTO items VALUES (1531, 31, 'item1531');
+INSERT INTO items VALUES (1532, 32, 'item1532');
+INSERT INTO items VALUES (1533, 33, 'item1533');
+INSERT INTO items VALUES (1534, 34, 'item1534');
+INSERT INTO items VALUES (1535, 35, 'item1535');
+INSERT INTO items VALUES (1536, 36, 'item1536');
+INSERT INTO items VALUES (1537, 37, 'item1537');
+INSERT INTO items VALUES (1538, 38, 'item1538');
+INSERT INTO items VALUES (1539, 39, 'item1539');
+INSERT INTO items VALUES (1540, 40, 'item1540');
+INSERT INTO items VALUES (1541, 41, 'item1541');
+INSERT INTO items VALUES (1542, 42, 'item1542');
+INSERT INTO items VALUES (1543, 43, 'item1543');
+INSERT INTO items VALUES (1544, 44, 'item1544');
+INSERT INTO items VALUES (1545, 45, 'item1545');
+INSERT INTO items VALUES (1546, 46, 'item1546');
+INSERT INTO items VALUES (1547, 47, 'item1547');
+INSERT INTO items VALUES (1548, 48, 'item1548');
+INSERT INTO items VALUES (1549, 49, 'item1549');
+INSERT INTO items VALUES (1550, 50, 'item1550');
+INSERT INTO items VALUES (1551, 51, 'item1551');
+INSERT INTO items VALUES (1552, 52, 'item1552');
+INSERT INTO items VALUES (1553, 53, 'item1553');
+INSERT INTO items VALUES (1554, 54, 'item1554');
+INSERT INTO items VALUES (1555, 55, 'item1555');
+INSERT INTO items VALUES (1556, 56, 'item1556');
+INSERT INTO items VALUES (1557, 57, 'item1557');
+INSERT INTO items VALUES (1558, 58, 'item1558');
+INSERT INTO items VALUES (1559, 59, 'item1559');
+INSERT INTO items VALUES (1560, 60, 'item1560');
+INSERT INTO items VALUES (1561, 61, 'item1561');
+INSERT INTO items VALUES (1562, 62, 'item1562');
+INSERT INTO items VALUES (1563, 63, 'item1563');
+INSERT INTO items VALUES (1564, 64, 'item1564');
+INSERT INTO items VALUES (1565, 65, 'item1565');
+INSERT INTO items VALUES (1566, 66, 'item1566');
+INSERT INTO items VALUES (1567, 67, 'item1567');
+INSERT INTO items VALUES (1568, 68, 'item1568');
+INSERT INTO items VALUES (1569, 69, 'item1569');
+INSERT INTO items VALUES (1570, 70, 'item1570');
+INSERT INTO items VALUES (1571, 71, 'item1571');
+INSERT INTO items VALUES (1572, 72, 'item1572');
+INSERT INTO items VALUES (1573, 73, 'item1573');
+INSERT INTO items VALUES (1574, 74, 'item1574');
+INSERT INTO items VALUES (1575, 75, 'item1575');
+INSERT INTO items VALUES (1576, 76, 'item1576');
+INSERT INTO items VALUES (1577, 77, 'item1577');
+INSERT INTO items VALUES (1578, 78, 'item1578');
+INSERT INTO items VALUES (1579, 79, 'item1579');
+INSERT INTO items VALUES (1580, 80, 'item1580');
+INSERT INTO items VALUES (1581, 81, 'item1581');
+INSERT INTO items VALUES (1582, 82, 'item1582');
+INSERT INTO items VALUES (1583, 83, 'item1583');
+INSERT INTO items VALUES (1584, 84, 'item1584');
+INSERT INTO items VALUES (1585, 85, 'item1585');
+INSERT INTO items VALUES (1586, 86, 'item1586');
+INSERT INTO items VALUES (1587, 87, 'item1587');
+INSERT INTO items VALUES (1588, 88, 'item1588');
+INSERT INTO items VALUES (1589, 89, 'item1589');
+INSERT INTO items VALUES (1590, 90, 'item1590');
+INSERT INTO items VALUES (1591, 91, 'item1591');
+INSERT INTO items VALUES (1592, 92, 'item1592');
+INSERT INTO items VALUES (1593, 93, 'item1593');
+INSERT INTO items VALUES (1594, 94, 'item1594');
+INSERT INTO items VALUES (1595, 95, 'item1595');
+INSERT INTO items VALUES (1596, 96, 'item1596');
+INSERT INTO items VALUES (1597, 97, 'item1597');
+INSERT INTO items VALUES (1598, 98, 'item1598');
+INSERT INTO items VALUES (1599, 99, 'item1599');
+INSERT INTO items VALUES (1600, 0, 'item1600');
+INSERT INTO items VALUES (1601, 1, 'item1601');
+INSERT INTO items VALUES (1602, 2, 'item1602');
+INSERT INTO items VALUES (1603, 3, 'item1603');
+INSERT INTO items VALUES (1604, 4, 'item1604');
+INSERT INTO items VALUES (1605, 5, 'item1605');
+INSERT INTO items VALUES (1606, 6, 'item1606');
+INSERT INTO items VALUES (1607, 7, 'item1607');
+INSERT INTO items VALUES (1608, 8, 'item1608');
+INSERT INTO items VALUES (1609, 9, 'item1609');
+INSERT INTO items VALUES (1610, 10, 'item1610');
+INSERT INTO items VALUES (1611, 11, 'item1611');
+INSERT INTO items VALUES (1612, 12, 'item1612');
+INSERT INTO items VALUES (1613, 13, 'item1613');
+INSERT INTO items VALUES (1614, 14, 'item1614');
+INSERT INTO items VALUES (1615, 15, 'item1615');
+INSERT INTO items VALUES (1616, 16, 'item1616');
+INSERT INTO items VALUES (1617, 17, 'item1617');
+INSERT INTO items VALUES (1618, 18, 'item1618');
+INSERT INTO items VALUES (1619, 19, 'item1619');
+INSERT INTO items VALUES (1620, 20, 'item1620');
+INSERT INTO items VALUES (1621, 21, 'item1621');
+INSERT INTO items VALUES (1622, 22, 'item1622');
+INSERT INTO items VALUES (1623, 23, 'item1623');
+INSERT INTO items VALUES (1624, 24, 'item1624');
+INSERT INTO items VALUES (1625, 25, 'item1625');
+INSERT INTO items VALUES (1626, 26, 'item1626');
+INSERT INTO items VALUES (1627, 27, 'item1627');
+INSERT INTO items VALUES (1628, 28, 'item1628');
+INSERT INTO items VALUES (1629, 29, 'item1629');
+INSERT INTO items VALUES (1630, 30, 'item1630');
+INSERT INTO items VALUES (1631, 31, 'item1631');
+INSERT INTO items VALUES (1632, 32, 'item1632');
+INSERT INTO items VALUES (1633, 33, 'item1633');
+INSERT INTO items VALUES (1634, 34, 'item1634');
+INSERT INTO items VALUES (1635, 35, 'item1635');
+INSERT INTO items VALUES (1636, 36, 'item1636');
+INSERT INTO items VALUES (1637, 37, 'item1637');
+INSERT INTO items VALUES (1638, 38, 'item1638');
+INSERT INTO items VALUES (1639, 39, 'item1639');
+INSERT INTO items VALUES (1640, 40, 'item1640');
+INSERT INTO items VALUES (1641, 41, 'item1641');
+INSERT INTO items VALUES (1642, 42, 'item1642');
+INSERT INTO items VALUES (1643, 43, 'item1643');
+INSERT INTO items VALUES (1644, 44, 'item1644');
+INSERT INTO items VALUES (1645, 45, 'item1645');
+INSERT INTO items VALUES (1646, 46, 'item1646');
+INSERT INTO items VALUES (1647, 47, 'item1647');
+INSERT INTO items VALUES (1648, 48, 'item1648');
+INSERT INTO items VALUES (1649, 49, 'item1649');
+INSERT INTO items VALUES (1650, 50, 'item1650');
+INSERT INTO items VALUES (1651, 51, 'item1651');
+INSERT INTO items VALUES (1652, 52, 'item1652');
+INSERT INTO items VALUES (1653, 53, 'item1653');
+INSERT INTO items VALUES (1654, 54, 'item1654');
+INSERT INTO items VALUES (1655, 55, 'item1655');
+INSERT INTO items VALUES (1656, 56, 'item1656');
+INSERT INTO items VALUES (1657, 57, 'item1657');
+INSERT INTO items VALUES (1658, 58, 'item1658');
+INSERT INTO items VALUES (1659, 59, 'item1659');
+INSERT INTO items VALUES (1660, 60, 'item1660');
+INSERT INTO items VALUES (1661, 61, 'item1661');
+INSERT INTO items VALUES (1662, 62, 'item1662');
+INSERT INTO items VALUES (1663, 63, 'item1663');
+INSERT INTO items VALUES (1664, 64, 'item1664');
+INSERT INTO items VALUES (1665, 65, 'item1665');
+INSERT INTO items VALUES (1666, 66, 'item1666');
+INSERT INTO items VALUES (1667, 67, 'item1667');
+INSERT INTO items VALUES (1668, 68, 'item1668');
+INSERT INTO items VALUES (1669, 69, 'item1669');
+INSERT INTO items VALUES (1670, 70, 'item1670');
+INSERT INTO items VALUES (1671, 71, 'item1671');
+INSERT INTO items VALUES (1672, 72, 'item1672');
+INSERT INTO items VALUES (1673, 73, 'item1673');
+INSERT INTO items VALUES (1674, 74, 'item1674');
+INSERT INTO items VALUES (1675, 75, 'item1675');
+INSERT INTO items VALUES (1676, 76, 'item1676');
+INSERT INTO items VALUES (1677, 77, 'item1677');
+INSERT INTO items VALUES (1678, 78, 'item1678');
+INSERT INTO items VALUES (1679, 79, 'item1679');
+INSERT INTO items VALUES (1680, 80, 'item1680');
+INSERT INTO items VALUES (1681, 81, 'item1681');
+INSERT INTO items VALUES (1682, 82, 'item1682');
+INSERT INTO items VALUES (1683, 83, 'item1683');
+INSERT INTO items VALUES (1684, 84, 'item1684');
+INSERT INTO items VALUES (1685, 85, 'item1685');
+INSERT INTO items VALUES (1686, 86, 'item1686');
+INSERT INTO items VALUES (1687, 87, 'item1687');
+INSERT INTO items VALUES (1688, 88, 'item1688');
+INSERT INTO items VALUES (1689, 89, 'item1689');
+INSERT INTO items VALUES (1690, 90, 'item1690');
+INSERT INTO items VALUES (1691, 91, 'item1691');
+INSERT INTO items VALUES (1692, 92, 'item1692');
+INSERT INTO items VALUES (1693, 93, 'item1693');
+INSERT INTO items VALUES (1694, 94, 'item1694');
+INSERT INTO items VALUES (1695, 95, 'item1695');
+INSERT INTO items VALUES (1696, 96, 'item1696');
+INSERT INTO items VALUES (1697, 97, 'item1697');
+INSERT INTO items VALUES (1698, 98, 'item1698');
+INSERT INTO items VALUES (1699, 99, 'item1699');
+INSERT INTO items VALUES (1700, 0, 'item1700');
+INSERT INTO items VALUES (1701, 1, 'item1701');
+INSERT INTO items VALUES (1702, 2, 'item1702');
+INSERT INTO items VALUES (1703, 3, 'item1703');
+INSERT INTO items VALUES (1704, 4, 'item1704');
+INSERT INTO items VALUES (1705, 5, 'item1705');
+INSERT INTO items VALUES (1706, 6, 'item1706');
+INSERT INTO items VALUES (1707, 7, 'item1707');
+INSERT INTO items VALUES (1708, 8, 'item1708');
+INSERT INTO items VALUES (1709, 9, 'item1709');
+INSERT INTO items VALUES (1710, 10, 'item1710');
+INSERT INTO items VALUES (1711, 11, 'item1711');
+INSERT INTO items VALUES (1712, 12, 'item1712');
+INSERT INTO items VALUES (1713, 13, 'item1713');
+INSERT INTO items VALUES (1714, 14, 'item1714');
+INSERT INTO items VALUES (1715, 15, 'item1715');
+INSERT INTO items VALUES (1716, 16, 'item1716');
+INSERT INTO items VALUES (1717, 17, 'item1717');
+INSERT INTO items VALUES (1718, 18, 'item1718');
+INSERT INTO items VALUES (1719, 19, 'item1719');
+INSERT INTO items VALUES (1720, 20, 'item1720');
+INSERT INTO items VALUES (1721, 21, 'item1721');
+INSERT INTO items VALUES (1722, 22, 'item1722');
+INSERT INTO items VALUES (1723, 23, 'item1723');
+INSERT INTO items VALUES (1724, 24, 'item1724');
+INSERT INTO items VALUES (1725, 25, 'item1725');
+INSERT INTO items VALUES (1726, 26, 'item1726');
+INSERT INTO items VALUES (1727, 27, 'item1727');
+INSERT INTO items VALUES (1728, 28, 'item1728');
+INSERT INTO items VALUES (1729, 29, 'item1729');
+INSERT INTO items VALUES (1730, 30, 'item1730');
+INSERT INTO items VALUES (1731, 31, 'item1731');
+INSERT INTO items VALUES (1732, 32, 'item1732');
+INSERT INTO items VALUES (1733, 33, 'item1733');
+INSERT INTO items VALUES (1734, 34, 'item1734');
+INSERT INTO items VALUES (1735, 35, 'item1735');
+INSERT INTO items VALUES (1736, 36, 'item1736');
+INSERT INTO items VALUES (1737, 37, 'item1737');
+INSERT INTO items VALUES (1738, 38, 'item1738');
+INSERT INTO items VALUES (1739, 39, 'item1739');
+INSERT INTO items VALUES (1740, 40, 'item1740');
+INSERT INTO items VALUES (1741, 41, 'item1741');
+INSERT INTO items VALUES (1742, 42, 'item1742');
+INSERT INTO items VALUES (1743, 43, 'item1743');
+INSERT INTO items VALUES (1744, 44, 'item1744');
+INSERT INTO items VALUES (1745, 45, 'item1745');
+INSERT INTO items VALUES (1746, 46, 'item1746');
+INSERT INTO items VALUES (1747, 47, 'item1747');
+INSERT INTO items VALUES (1748, 48, 'item1748');
+INSERT INTO items VALUES (1749, 49, 'item1749');
+INSERT INTO items VALUES (1750, 50, 'item1750');
+INSERT INTO items VALUES (1751, 51, 'item1751');
+INSERT INTO items VALUES (1752, 52, 'item1752');
+INSERT INTO items VALUES (1753, 53, 'item1753');
+INSERT INTO items VALUES (1754, 54, 'item1754');
+INSERT INTO items VALUES (1755, 55, 'item1755');
+INSERT INTO items VALUES (1756, 56, 'item1756');
+INSERT INTO items VALUES (1757, 57, 'item1757');
+INSERT INTO items VALUES (1758, 58, 'item1758');
+INSERT INTO items VALUES (1759, 59, 'item1759');
+INSERT INTO items VALUES (1760, 60, 'item1760');
+INSERT INTO items VALUES (1761, 61, 'item1761');
+INSERT INTO items VALUES (1762, 62, 'item1762');
+INSERT INTO items VALUES (1763, 63, 'item1763');
+INSERT INTO items VALUES (1764, 64, 'item1764');
+INSERT INTO items VALUES (1765, 65, 'item1765');
+INSERT INTO items VALUES (1766, 66, 'item1766');
+INSERT INTO items VALUES (1767, 67, 'item1767');
+INSERT INTO items VALUES (1768, 68, 'item1768');
+INSERT INTO items VALUES (1769, 69, 'item1769');
+INSERT INTO items VALUES (1770, 70, 'item1770');
+INSERT INTO items VALUES (1771, 71, 'item1771');
+INSERT INTO items VALUES (1772, 72, 'item1772');
+INSERT INTO items VALUES (1773, 73, 'item1773');
+INSERT INTO items VALUES (1774, 74, 'item1774');
+INSERT INTO items VALUES (1775, 75, 'item1775');
+INSERT INTO items VALUES (1776, 76, 'item1776');
+INSERT INTO items VALUES (1777, 77, 'item1777');
+INSERT INTO items VALUES (1778, 78, 'item1778');
+INSERT INTO items VALUES (1779, 79, 'item1779');
+INSERT INTO items VALUES (1780, 80, 'item1780');
+INSERT INTO items VALUES (1781, 81, 'item1781');
+INSERT INTO items VALUES (1782, 82, 'item1782');
+INSERT INTO items VALUES (1783, 83, 'item1783');
+INSERT INTO items VALUES (1784, 84, 'item1784');
+INSERT INTO items VALUES (1785, 85, 'item1785');
+INSERT INTO items VALUES (1786, 86, 'item1786');
+INSERT INTO items VALUES (1787, 87, 'item1787');
+INSERT INTO items VALUES (1788, 88, 'item1788');
+INSERT INTO items VALUES (1789, 89, 'item1789');
+INSERT INTO items VALUES (1790, 90, 'item1790');
+INSERT INTO items VALUES (1791, 91, 'item1791');
+INSERT INTO items VALUES (1792, 92, 'item1792');
+INSERT INTO items VALUES (1793, 93, 'item1793');
+INSERT INTO items VALUES (1794, 94, 'item1794');
+INSERT INTO items VALUES (1795, 95, 'item1795');
+INSERT INTO items VALUES (1796, 96, 'item1796');
+INSERT INTO items VALUES (1797, 97, 'item1797');
+INSERT INTO items VALUES (1798, 98, 'item1798');
+INSERT INTO items VALUES (1799, 99, 'item1799');
+INSERT INTO items VALUES (1800, 0, 'item1800');
+INSERT INTO items VALUES (1801, 1, 'item1801');
+INSERT INTO items VALUES (1802, 2, 'item1802');
+INSERT INTO items VALUES (1803, 3, 'item1803');
+INSERT INTO items VALUES (1804, 4, 'item1804');
+INSERT INTO items VALUES (1805, 5, 'item1805');
+INSERT INTO items VALUES (1806, 6, 'item1806');
+INSERT INTO items VALUES (1807, 7, 'item1807');
+INSERT INTO items VALUES (1808, 8, 'item1808');
+INSERT INTO items VALUES (1809, 9, 'item1809');
+INSERT INTO items VALUES (1810, 10, 'item1810');
+INSERT INTO items VALUES (1811, 11, 'item1811');
+INSERT INTO items VALUES (1812, 12, 'item1812');
+INSERT INTO items VALUES (1813, 13, 'item1813');
+INSERT INTO items VALUES (1814, 14, 'item1814');
+INSERT INTO items VALUES (1815, 15, 'item1815');
+INSERT INTO items VALUES (1816, 16, 'item1816');
+INSERT INTO items VALUES (1817, 17, 'item1817');
+INSERT INTO items VALUES (1818, 18, 'item1818');
+INSERT INTO items VALUES (1819, 19, 'item1819');
+INSERT INTO items VALUES (1820, 20, 'item1820');
+INSERT INTO items VALUES (1821, 21, 'item1821');
+INSERT INTO items VALUES (1822, 22, 'item1822');
+INSERT INTO items VALUES (1823, 23, 'item1823');
+INSERT INTO items VALUES (1824, 24, 'item1824');
+INSERT INTO items VALUES (1825, 25, 'item1825');
+INSERT INTO items VALUES (1826, 26, 'item1826');
+INSERT INTO items VALUES (1827, 27, 'item1827');
+INSERT INTO items VALUES (1828, 28, 'item1828');
+INSERT INTO items VALUES (1829, 29, 'item1829');
+INSERT INTO items VALUES (1830, 30, 'item1830');
+INSERT INTO items VALUES (1831, 31, 'item1831');
+INSERT INTO items VALUES (1832, 32, 'item1832');
+INSERT INTO items VALUES (1833, 33, 'item1833');
+INSERT INTO items VALUES (1834, 34, 'item1834');
+INSERT INTO items VALUES (1835, 35, 'item1835');
+INSERT INTO items VALUES (1836, 36, 'item1836');
+INSERT INTO items VALUES (1837, 37, 'item1837');
+INSERT INTO items VALUES (1838, 38, 'item1838');
+INSERT INTO items VALUES (1839, 39, 'item1839');
+INSERT INTO items VALUES (1840, 40, 'item1840');
+INSERT INTO items VALUES (1841, 41, 'item1841');
+INSERT INTO items VALUES (1842, 42, 'item1842');
+INSERT INTO items VALUES (1843, 43, 'item1843');
+INSERT INTO items VALUES (1844, 44, 'item1844');
+INSERT INTO items VALUES (1845, 45, 'item1845');
+INSERT INTO items VALUES (1846, 46, 'item1846');
+INSERT INTO items VALUES (1847, 47, 'item1847');
+INSERT INTO items VALUES (1848, 48, 'item1848');
+INSERT INTO items VALUES (1849, 49, 'item1849');
+INSERT INTO items VALUES (1850, 50, 'item1850');
+INSERT INTO items VALUES (1851, 51, 'item1851');
+INSERT INTO items VALUES (1852, 52, 'item1852');
+INSERT INTO items VALUES (1853, 53, 'item1853');
+INSERT INTO items VALUES (1854, 54, 'item1854');
+INSERT INTO items VALUES (1855, 55, 'item1855');
+INSERT INTO items VALUES (1856, 56, 'item1856');
+INSERT INTO items VALUES (1857, 57, 'item1857');
+INSERT INTO items VALUES (1858, 58, 'item1858');
+INSERT INTO items VALUES (1859, 59, 'item1859');
+INSERT INTO items VALUES (1860, 60, 'item1860');
+INSERT INTO items VALUES (1861, 61, 'item1861');
+INSERT INTO items VALUES (1862, 62, 'item1862');
+INSERT INTO items VALUES (1863, 63, 'item1863');
+INSERT INTO items VALUES (1864, 64, 'item1864');
+INSERT INTO items VALUES (1865, 65, 'item1865');
+INSERT INTO items VALUES (1866, 66, 'item1866');
+INSERT INTO items VALUES (1867, 67, 'item1867');
+INSERT INTO items VALUES (1868, 68, 'item1868');
+INSERT INTO items VALUES (1869, 69, 'item1869');
+INSERT INTO items VALUES (1870, 70, 'item1870');
+INSERT INTO items VALUES (1871, 71, 'item1871');
+INSERT INTO items VALUES (1872, 72, 'item1872');
+INSERT INTO items VALUES (1873, 73, 'item1873');
+INSERT INTO items VALUES (1874, 74, 'item1874');
+INSERT INTO items VALUES (1875, 75, 'item1875');
+INSERT INTO items VALUES (1876, 76, 'item1876');
+INSERT INTO items VALUES (1877, 77, 'item1877');
+INSERT INTO items VALUES (1878, 78, 'item1878');
+INSERT INTO items VALUES (1879, 79, 'item1879');
+INSERT INTO items VALUES (1880, 80, 'item1880');
+INSERT INTO items VALUES (1881, 81, 'item1881');
+INSERT INTO items VALUES (1882, 82, 'item1882');
+INSERT INTO items VALUES (1883, 83, 'item1883');
+INSERT INTO items VALUES (1884, 84, 'item1884');
+INSERT INTO items VALUES (1885, 85, 'item1885');
+INSERT INTO items VALUES (1886, 86, 'item1886');
+INSERT INTO items VALUES (1887, 87, 'item1887');
+INSERT INTO items VALUES (1888, 88, 'item1888');
+INSERT INTO items VALUES (1889, 89, 'item1889');
+INSERT INTO items VALUES (1890, 90, 'item1890');
+INSERT INTO items VALUES (1891, 91, 'item1891');
+INSERT INTO items VALUES (1892, 92, 'item1892');
+INSERT INTO items VALUES (1893, 93, 'item1893');
+INSERT INTO items VALUES (1894, 94, 'item1894');
+INSERT INTO items VALUES (1895, 95, 'item1895');
+INSERT INTO items VALUES (1896, 96, 'item1896');
+INSERT INTO items VALUES (1897, 97, 'item1897');
+INSERT INTO items VALUES (1898, 98, 'item1898');
+INSERT INTO items VALUES (1899, 99, 'item1899');
+INSERT INTO items VALUES (1900, 0, 'item1900');
+INSERT INTO items VALUES (1901, 1, 'item1901');
+INSERT INTO items VALUES (1902, 2, 'item1902');
+INSERT INTO items VALUES (1903, 3, 'item1903');
+INSERT INTO items VALUES (1904, 4, 'item1904');
+INSERT INTO items VALUES (1905, 5, 'item1905');
+INSERT INTO items VALUES (1906, 6, 'item1906');
+INSERT INTO items VALUES (1907, 7, 'item1907');
+INSERT INTO items VALUES (1908, 8, 'item1908');
+INSERT INTO items VALUES (1909, 9, 'item1909');
+INSERT INTO items VALUES (1910, 10, 'item1910');
+INSERT INTO items VALUES (1911, 11, 'item1911');
+INSERT INTO items VALUES (1912, 12, 'item1912');
+INSERT INTO items VALUES (1913, 13, 'item1913');
+INSERT INTO items VALUES (1914, 14, 'item1914');
+INSERT INTO items VALUES (1915, 15, 'item1915');
+INSERT INTO items VALUES (1916, 16, 'item1916');
+INSERT INTO items VALUES (1917, 17, 'item1917');
+INSERT INTO items VALUES (1918, 18, 'item1918');
+INSERT INTO items VALUES (1919, 19, 'item1919');
+INSERT INTO items VALUES (1920, 20, 'item1920');
+INSERT INTO items VALUES (1921, 21, 'item1921');
+INSERT INTO items VALUES (1922, 22, 'item1922');
+INSERT INTO items VALUES (1923, 23, 'item1923');
+INSERT INTO items VALUES (1924, 24, 'item1924');
+INSERT INTO items VALUES (1925, 25, 'item1925');
+INSERT INTO items VALUES (1926, 26, 'item1926');
+INSERT INTO items VALUES (1927, 27, 'item1927');
+INSERT INTO items VALUES (1928, 28, 'item1928');
+INSERT INTO items VALUES (1929, 29, 'item1929');
+INSERT INTO items VALUES (1930, 30, 'item1930');
+INSERT INTO items VALUES (1931, 31, 'item1931');
+INSERT INTO items VALUES (1932, 32, 'item1932');
+INSERT INTO items VALUES (1933, 33, 'item1933');
+INSERT INTO items VALUES (1934, 34, 'item1934');
+INSERT INTO items VALUES (1935, 35, 'item1935');
+INSERT INTO items VALUES (1936, 36, 'item1936');
+INSERT INTO items VALUES (1937, 37, 'item1937');
+INSERT INTO items VALUES (1938, 38, 'item1938');
+INSERT INTO items VALUES (1939, 39, 'item1939');
+INSERT INTO items VALUES (1940, 40, 'item1940');
+INSERT INTO items VALUES (1941, 41, 'item1941');
+INSERT INTO items VALUES (1942, 42, 'item1942');
+INSERT INTO items VALUES (1943, 43, 'item1943');
+INSERT INTO items VALUES (1944, 44, 'item1944');
+INSERT INTO items VALUES (1945, 45, 'item1945');
+INSERT INTO items VALUES (1946, 46, 'item1946');
+INSERT INTO items VALUES (1947, 47, 'item1947');
+INSERT INTO items VALUES (1948, 48, 'item1948');
+INSERT INTO items VALUES (1949, 49, 'item1949');
+INSERT INTO items VALUES (1950, 50, 'item1950');
+INSERT INTO items VALUES (1951, 51, 'item1951');
+INSERT INTO items VALUES (1952, 52, 'item1952');
+INSERT INTO items VALUES (1953, 53, 'item1953');
+INSERT INTO items VALUES (1954, 54, 'item1954');
+INSERT INTO items VALUES (1955, 55, 'item1955');
+INSERT INTO items VALUES (1956, 56, 'item1956');
+INSERT INTO items VALUES (1957, 57, 'item1957');
+INSERT INTO items VALUES (1958, 58, 'item1958');
+INSERT INTO items VALUES (1959, 59, 'item1959');
+INSERT INTO items VALUES (1960, 60, 'item1960');
+INSERT INTO items VALUES (1961, 61, 'item1961');
+INSERT INTO items VALUES (1962, 62, 'item1962');
+INSERT INTO items VALUES (1963, 63, 'item1963');
+INSERT INTO items VALUES (1964, 64, 'item1964');
+INSERT INTO items VALUES (1965, 65, 'item1965');
+INSERT INTO items VALUES (1966, 66, 'item1966');
+INSERT INTO items VALUES (1967, 67, 'item1967');
+INSERT INTO items VALUES (1968, 68, 'item1968');
+INSERT INTO items VALUES (1969, 69, 'item1969');
+INSERT INTO items VALUES (1970, 70, 'item1970');
+INSERT INTO items VALUES (1971, 71, 'item1971');
+INSERT INTO items VALUES (1972, 72, 'item1972');
+INSERT INTO items VALUES (1973, 73, 'item1973');
+INSERT INTO items VALUES (1974, 74, 'item1974');
+INSERT INTO items VALUES (1975, 75, 'item1975');
+INSERT INTO items VALUES (1976, 76, 'item1976');
+INSERT INTO items VALUES (1977, 77, 'item1977');
+INSERT INTO items VALUES (1978, 78, 'item1978');
+INSERT INTO items VALUES (1979, 79, 'item1979');
+INSERT INTO items VALUES (1980, 80, 'item1980');
+INSERT INTO items VALUES (1981, 81, 'item1981');
+INSERT INTO items VALUES (1982, 82, 'item1982');
+INSERT INTO items VALUES (1983, 83, 'item1983');
+INSERT INTO items VALUES (1984, 84, 'item1984');
+INSERT INTO items VALUES (1985, 85, 'item1985');
+INSERT INTO items VALUES (1986, 86, 'item1986');
+INSERT INTO items VALUES (1987, 87, 'item1987');
+INSERT INTO items VALUES (1988, 88, 'item1988');
+INSERT INTO items VALUES (1989, 89, 'item1989');
+INSERT INTO items VALUES (1990, 90, 'item1990');
+INSERT INTO items VALUES (1991, 91, 'item1991');
+INSERT INTO items VALUES (1992, 92, 'item1992');
+INSERT INTO items VALUES (1993, 93, 'item1993');
+INSERT INTO items VALUES (1994, 94, 'item1994');
+INSERT INTO items VALUES (1995, 95, 'item1995');
+INSERT INTO items VALUES (1996, 96, 'item1996');
+INSERT INTO items VALUES (1997, 97, 'item1997');
+INSERT INTO items VALUES (1998, 98, 'item1998');
+INSERT INTO items VALUES (1999, 99, 'item1999');
+INSERT INTO items VALUES (2000, 0, 'item2000');
+INSERT INTO items VALUES (2001, 1, 'item2001');
+INSERT INTO items VALUES (2002, 2, 'item2002');
+INSERT INTO items VALUES (2003, 3, 'item2003');
+INSERT INTO items VALUES (2004, 4, 'item2004');
+INSERT INTO items VALUES (2005, 5, 'item2005');
+INSERT INTO items VALUES (2006, 6, 'item2006');
+INSERT INTO items VALUES (2007, 7, 'item2007');
+INSERT INTO items VALUES (2008, 8, 'item2008');
+INSERT INTO items VALUES (2009, 9, 'item2009');
+INSERT INTO items VALUES (2010, 10, 'item2010');
+INSERT INTO items VALUES (2011, 11, 'item2011');
+INSERT INTO items VALUES (2012, 12, 'item2012');
+INSERT INTO items VALUES (2013, 13, 'item2013');
+INSERT INTO items VALUES (2014, 14, 'item2014');
+INSERT INTO items VALUES (2015, 15, 'item2015');
+INSERT INTO items VALUES (2016, 16, 'item2016');
+INSERT INTO items VALUES (2017, 17, 'item2017');
+INSERT INTO items VALUES (2018, 18, 'item2018');
+INSERT INTO items VALUES (2019, 19, 'item2019');
+INSERT INTO items VALUES (2020, 20, 'item2020');
+INSERT INTO items VALUES (2021, 21, 'item2021');
+INSERT INTO items VALUES (2022, 22, 'item2022');
+INSERT INTO items VALUES (2023, 23, 'item2023');
+INSERT INTO items VALUES (2024, 24, 'item2024');
+INSERT INTO items VALUES (2025, 25, 'item2025');
+INSERT INTO items VALUES (2026, 26, 'item2026');
+INSERT INTO items VALUES (2027, 27, 'item2027');
+INSERT INTO items VALUES (2028, 28, 'item2028');
+INSERT INTO items VALUES (2029, 29, 'item2029');
+INSERT INTO items VALUES (2030, 30, 'item2030');
+INSERT INTO items VALUES (2031, 31, 'item2031');
+INSERT INTO items VALUES (2032, 32, 'item2032');
+INSERT INTO items VALUES (2033, 33, 'item2033');
+INSERT INTO items VALUES (2034, 34, 'item2034');
+INSERT INTO items VALUES (2035, 35, 'item2035');
+INSERT INTO items VALUES (2036, 36, 'item2036');
+INSERT INTO items VALUES (2037, 37, 'item2037');
+INSERT INTO items VALUES (2038, 38, 'item2038');
+INSERT INTO items VALUES (2039, 39, 'item2039');
+INSERT INTO items VALUES (2040, 40, 'item2040');
+INSERT INTO items VALUES (2041, 41, 'item2041');
+INSERT INTO items VALUES (2042, 42, 'item2042');
+INSERT INTO items VALUES (2043, 43, 'item2043');
+INSERT INTO items VALUES (2044, 44, 'item2044');
+INSERT INTO items VALUES (2045, 45, 'item2045');
+INSERT INTO items VALUES (2046, 46, 'item2046');
+INSERT INTO items VALUES (2047, 47, 'item2047');
+INSERT INTO items VALUES (2048, 48, 'item2048');
+INSERT INTO items VALUES (2049, 49, 'item2049');
+INSERT INTO items VALUES (2050, 50, 'item2050');
+INSERT INTO items VALUES (2051, 51, 'item2051');
+INSERT INTO items VALUES (2052, 52, 'item2052');
+INSERT INTO items VALUES (2053, 53, 'item2053');
+INSERT INTO items VALUES (2054, 54, 'item2054');
+INSERT INTO items VALUES (2055, 55, 'item2055');
+INSERT INTO items VALUES (2056, 56, 'item2056');
+INSERT INTO items VALUES (2057, 57, 'item2057');
+INSERT INTO items VALUES (2058, 58, 'item2058');
+INSERT INTO items VALUES (2059, 59, 'item2059');
+INSERT INTO items VALUES (2060, 60, 'item2060');
+INSERT INTO items VALUES (2061, 61, 'item2061');
+INSERT INTO items VALUES (2062, 62, 'item2062');
+INSERT INTO items VALUES (2063, 63, 'item2063');
+INSERT INTO items VALUES (2064, 64, 'item2064');
+INSERT INTO items VALUES (2065, 65, 'item2065');
+INSERT INTO items VALUES (2066, 66, 'item2066');
+INSERT INTO items VALUES (2067, 67, 'item2067');
+INSERT INTO items VALUES (2068, 68, 'item2068');
+INSERT INTO items VALUES (2069, 69, 'item2069');
+INSERT INTO items VALUES (2070, 70, 'item2070');
+INSERT INTO items VALUES (2071, 71, 'item2071');
+INSERT INTO items VALUES (2072, 72, 'item2072');
+INSERT INTO items VALUES (2073, 73, 'item2073');
+INSERT INTO items VALUES (2074, 74, 'item2074');
+INSERT INTO items VALUES (2075, 75, 'item2075');
+INSERT INTO items VALUES (2076, 76, 'item2076');
+INSERT INTO items VALUES (2077, 77, 'item2077');
+INSERT INTO items VALUES (2078, 78, 'item2078');
+INSERT INTO items VALUES (2079, 79, 'item2079');
+INSERT INTO items VALUES (2080, 80, 'item2080');
+INSERT INTO items VALUES (2081, 81, 'item2081');
+INSERT INTO items VALUES (2082, 82, 'item2082');
+INSERT INTO items VALUES (2083, 83, 'item2083');
+INSERT INTO items VALUES (2084, 84, 'item2084');
+INSERT INTO items VALUES (2085, 85, 'item2085');
+INSERT INTO items VALUES (2086, 86, 'item2086');
+INSERT INTO items VALUES (2087, 87, 'item2087');
+INSERT INTO items VALUES (2088, 88, 'item2088');
+INSERT INTO items VALUES (2089, 89, 'item2089');
+INSERT INTO items VALUES (2090, 90, 'item2090');
+INSERT INTO items VALUES (2091, 91, 'item2091');
+INSERT INTO items VALUES (2092, 92, 'item2092');
+INSERT INTO items VALUES (2093, 93, 'item2093');
+INSERT INTO items VALUES (2094, 94, 'item2094');
+INSERT INTO items VALUES (2095, 95, 'item2095');
+INSERT INTO items VALUES (2096, 96, 'item2096');
+INSERT INTO items VALUES (2097, 97, 'item2097');
+INSERT INTO items VALUES (2098, 98, 'item2098');
+INSERT INTO items VALUES (2099, 99, 'item2099');
+INSERT INTO items VALUES (2100, 0, 'item2100');
+INSERT INTO items VALUES (2101, 1, 'item2101');
+INSERT INTO items VALUES (2102, 2, 'item2102');
+INSERT INTO items VALUES (2103, 3, 'item2103');
+INSERT INTO items VALUES (2104, 4, 'item2104');
+INSERT INTO items VALUES (2105, 5, 'item2105');
+INSERT INTO items VALUES (2106, 6, 'item2106');
+INSERT INTO items VALUES (2107, 7, 'item2107');
+INSERT INTO items VALUES (2108, 8, 'item2108');
+INSERT INTO items VALUES (2109, 9, 'item2109');
+INSERT INTO items VALUES (2110, 10, 'item2110');
+INSERT INTO items VALUES (2111, 11, 'item2111');
+INSERT INTO items VALUES (2112, 12, 'item2112');
+INSERT INTO items VALUES (2113, 13, 'item2113');
+INSERT INTO items VALUES (2114, 14, 'item2114');
+INSERT INTO items VALUES (2115, 15, 'item2115');
+INSERT INTO items VALUES (2116, 16, 'item2116');
+INSERT INTO items VALUES (2117, 17, 'item2117');
+INSERT INTO items VALUES (2118, 18, 'item2118');
+INSERT INTO items VALUES (2119, 19, 'item2119');
+INSERT INTO items VALUES (2120, 20, 'item2120');
+INSERT INTO items VALUES (2121, 21, 'item2121');
+INSERT INTO items VALUES (2122, 22, 'item2122');
+INSERT INTO items VALUES (2123, 23, 'item2123');
+INSERT INTO items VALUES (2124, 24, 'item2124');
+INSERT INTO items VALUES (2125, 25, 'item2125');
+INSERT INTO items VALUES (2126, 26, 'item2126');
+INSERT INTO items VALUES (2127, 27, 'item2127');
+INSERT INTO items VALUES (2128, 28, 'item2128');
+INSERT INTO items VALUES (2129, 29, 'item2129');
+INSERT INTO items VALUES (2130, 30, 'item2130');
+INSERT INTO items VALUES (2131, 31, 'item2131');
+INSERT INTO items VALUES (2132, 32, 'item2132');
+INSERT INTO items VALUES (2133, 33, 'item2133');
+INSERT INTO items VALUES (2134, 34, 'item2134');
+INSERT INTO items VALUES (2135, 35, 'item2135');
+INSERT INTO items VALUES (2136, 36, 'item2136');
+INSERT INTO items VALUES (2137, 37, 'item2137');
+INSERT INTO items VALUES (2138, 38, 'item2138');
+INSERT INTO items VALUES (2139, 39, 'item2139');
+INSERT INTO items VALUES (2140, 40, 'item2140');
+INSERT INTO items VALUES (2141, 41, 'item2141');
+INSERT INTO items VALUES (2142, 42, 'item2142');
+INSERT INTO items VALUES (2143, 43, 'item2143');
+INSERT INTO items VALUES (2144, 44, 'item2144');
+INSERT INTO items VALUES (2145, 45, 'item2145');
+INSERT INTO items VALUES (2146, 46, 'item2146');
+INSERT INTO items VALUES (2147, 47, 'item2147');
+INSERT INTO items VALUES (2148, 48, 'item2148');
+INSERT INTO items VALUES (2149, 49, 'item2149');
+INSERT INTO items VALUES (2150, 50, 'item2150');
+INSERT INTO items VALUES (2151, 51, 'item2151');
+INSERT INTO items VALUES (2152, 52, 'item2152');
+INSERT INTO items VALUES (2153, 53, 'item2153');
+INSERT INTO items VALUES (2154, 54, 'item2154');
+INSERT INTO items VALUES (2155, 55, 'item2155');
+INSERT INTO items VALUES (2156, 56, 'item2156');
+INSERT INTO items VALUES (2157, 57, 'item2157');
+INSERT INTO items VALUES (2158, 58, 'item2158');
+INSERT INTO items VALUES (2159, 59, 'item2159');
+INSERT INTO items VALUES (2160, 60, 'item2160');
+INSERT INTO items VALUES (2161, 61, 'item2161');
+INSERT INTO items VALUES (2162, 62, 'item2162');
+INSERT INTO items VALUES (2163, 63, 'item2163');
+INSERT INTO items VALUES (2164, 64, 'item2164');
+INSERT INTO items VALUES (2165, 65, 'item2165');
+INSERT INTO items VALUES (2166, 66, 'item2166');
+INSERT INTO items VALUES (2167, 67, 'item2167');
+INSERT INTO items VALUES (2168, 68, 'item2168');
+INSERT INTO items VALUES (2169, 69, 'item2169');
+INSERT INTO items VALUES (2170, 70, 'item2170');
+INSERT INTO items VALUES (2171, 71, 'item2171');
+INSERT INTO items VALUES (2172, 72, 'item2172');
+INSERT INTO items VALUES (2173, 73, 'item2173');
+INSERT INTO items VALUES (2174, 74, 'item2174');
+INSERT INTO items VALUES (2175, 75, 'item2175');
+INSERT INTO items VALUES (2176, 76, 'item2176');
+INSERT INTO items VALUES (2177, 77, 'item2177');
+INSERT INTO items VALUES (2178, 78, 'item2178');
+INSERT INTO items VALUES (2179, 79, 'item2179');
+INSERT INTO items VALUES (2180, 80, 'item2180');
+INSERT INTO items VALUES (2181, 81, 'item2181');
+INSERT INTO items VALUES (2182, 82, 'item2182');
+INSERT INTO items VALUES (2183, 83, 'item2183');
+INSERT INTO items VALUES (2184, 84, 'item2184');
+INSERT INTO items VALUES (2185, 85, 'item2185');
+INSERT INTO items VALUES (2186, 86, 'item2186');
+INSERT INTO items VALUES (2187, 87, 'item2187');
+INSERT INTO items VALUES (2188, 88, 'item2188');
+INSERT INTO items VALUES (2189, 89, 'item2189');
+INSERT INTO items VALUES (2190, 90, 'item2190');
+INSERT INTO items VALUES (2191, 91, 'item2191');
+INSERT INTO items VALUES (2192, 92, 'item2192');
+INSERT INTO items VALUES (2193, 93, 'item2193');
+INSERT INTO items VALUES (2194, 94, 'item2194');
+INSERT INTO items VALUES (2195, 95, 'item2195');
+INSERT INTO items VALUES (2196, 96, 'item2196');
+INSERT INTO items VALUES (2197, 97, 'item2197');
+INSERT INTO items VALUES (2198, 98, 'item2198');
+INSERT INTO items VALUES (2199, 99, 'item2199');
+INSERT INTO items VALUES (2200, 0, 'item2200');
+INSERT INTO items VALUES (2201, 1, 'item2201');
+INSERT INTO items VALUES (2202, 2, 'item2202');
+INSERT INTO items VALUES (2203, 3, 'item2203');
+INSERT INTO items VALUES (2204, 4, 'item2204');
+INSERT INTO items VALUES (2205, 5, 'item2205');
+INSERT INTO items VALUES (2206, 6, 'item2206');
+INSERT INTO items VALUES (2207, 7, 'item2207');
+INSERT INTO items VALUES (2208, 8, 'item2208');
+INSERT INTO items VALUES (2209, 9, 'item2209');
+INSERT INTO items VALUES (2210, 10, 'item2210');
+INSERT INTO items VALUES (2211, 11, 'item2211');
+INSERT INTO items VALUES (2212, 12, 'item2212');
+INSERT INTO items VALUES (2213, 13, 'item2213');
+INSERT INTO items VALUES (2214, 14, 'item2214');
+INSERT INTO items VALUES (2215, 15, 'item2215');
+INSERT INTO items VALUES (2216, 16, 'item2216');
+INSERT INTO items VALUES (2217, 17, 'item2217');
+INSERT INTO items VALUES (2218, 18, 'item2218');
+INSERT INTO items VALUES (2219, 19, 'item2219');
+INSERT INTO items VALUES (2220, 20, 'item2220');
+INSERT INTO items VALUES (2221, 21, 'item2221');
+INSERT INTO items VALUES (2222, 22, 'item2222');
+INSERT INTO items VALUES (2223, 23, 'item2223');
+INSERT INTO items VALUES (2224, 24, 'item2224');
+INSERT INTO items VALUES (2225, 25, 'item2225');
+INSERT INTO items VALUES (2226, 26, 'item2226');
+INSERT INTO items VALUES (2227, 27, 'item2227');
+INSERT INTO items VALUES (2228, 28, 'item2228');
+INSERT INTO items VALUES (2229, 29, 'item2229');
+INSERT INTO items VALUES (2230, 30, 'item2230');
+INSERT INTO items VALUES (2231, 31, 'item2231');
+INSERT INTO items VALUES (2232, 32, 'item2232');
+INSERT INTO items VALUES (2233, 33, 'item2233');
+INSERT INTO items VALUES (2234, 34, 'item2234');
+INSERT INTO items VALUES (2235, 35, 'item2235');
+INSERT INTO items VALUES (2236, 36, 'item2236');
+INSERT INTO items VALUES (2237, 37, 'item2237');
+INSERT INTO items VALUES (2238, 38, 'item2238');
+INSERT INTO items VALUES (2239, 39, 'item2239');
+INSERT INTO items VALUES (2240, 40, 'item2240');
+INSERT INTO items VALUES (2241, 41, 'item2241');
+INSERT INTO items VALUES (2242, 42, 'item2242');
+INSERT INTO items VALUES (2243, 43, 'item2243');
+INSERT INTO items VALUES (2244, 44, 'item2244');
+INSERT INTO items VALUES (2245, 45, 'item2245');
+INSERT INTO items VALUES (2246, 46, 'item2246');
+INSERT INTO items VALUES (2247, 47, 'item2247');
+INSERT INTO items VALUES (2248, 48, 'item2248');
+INSERT INTO items VALUES (2249, 49, 'item2249');
+INSERT INTO items VALUES (2250, 50, 'item2250');
+INSERT INTO items VALUES (2251, 51, 'item2251');
+INSERT INTO items VALUES (2252, 52, 'item2252');
+INSERT INTO items VALUES (2253, 53, 'item2253');
+INSERT INTO items VALUES (2254, 54, 'item2254');
+INSERT INTO items VALUES (2255, 55, 'item2255');
+INSERT INTO items VALUES (2256, 56, 'item2256');
+INSERT INTO items VALUES (2257, 57, 'item2257');
+INSERT INTO items VALUES (2258, 58, 'item2258');
+INSERT INTO items VALUES (2259, 59, 'item2259');
+INSERT INTO items VALUES (2260, 60, 'item2260');
+INSERT INTO items VALUES (2261, 61, 'item2261');
+INSERT INTO items VALUES (2262, 62, 'item2262');
+INSERT INTO items VALUES (2263, 63, 'item2263');
+INSERT INTO items VALUES (2264, 64, 'item2264');
+INSERT INTO items VALUES (2265, 65, 'item2265');
+INSERT INTO items VALUES (2266, 66, 'item2266');
+INSERT INTO items VALUES (2267, 67, 'item2267');
+INSERT INTO items VALUES (2268, 68, 'item2268');
+INSERT INTO items VALUES (2269, 69, 'item2269');
+INSERT INTO items VALUES (2270, 70, 'item2270');
+INSERT INTO items VALUES (2271, 71, 'item2271');
+INSERT INTO items VALUES (2272, 72, 'item2272');
+INSERT INTO items VALUES (2273, 73, 'item2273');
+INSERT INTO items VALUES (2274, 74, 'item2274');
+INSERT INTO items VALUES (2275, 75, 'item2275');
+INSERT INTO items VALUES (2276, 76, 'item2276');
+INSERT INTO items VALUES (2277, 77, 'item2277');
+INSERT INTO items VALUES (2278, 78, 'item2278');
+INSERT INTO items VALUES (2279, 79, 'item2279');
+INSERT INTO items VALUES (2280, 80, 'item2280');
+INSERT INTO items VALUES (2281, 81, 'item2281');
+INSERT INTO items VALUES (2282, 82, 'item2282');
+INSERT INTO items VALUES (2283, 83, 'item2283');
+INSERT INTO items VALUES (2284, 84, 'item2284');
+INSERT INTO items VALUES (2285, 85, 'item2285');
+INSERT INTO items VALUES (2286, 86, 'item2286');
+INSERT INTO items VALUES (2287, 87, 'item2287');
+INSERT INTO items VALUES (2288, 88, 'item2288');
+INSERT INTO items VALUES (2289, 89, 'item2289');
+INSERT INTO items VALUES (2290, 90, 'item2290');
+INSERT INTO items VALUES (2291, 91, 'item2291');
+INSERT INTO items VALUES (2292, 92, 'item2292');
+INSERT INTO items VALUES (2293, 93, 'item2293');
+INSERT INTO items VALUES (2294, 94, 'item2294');
+INSERT INTO items VALUES (2295, 95, 'item2295');
+INSERT INTO items VALUES (2296, 96, 'item2296');
+INSERT INTO items VALUES (2297, 97, 'item2297');
+INSERT INTO items VALUES (2298, 98, 'item2298');
+INSERT INTO items VALUES (2299, 99, 'item2299');
+INSERT INTO items VALUES (2300, 0, 'item2300');
+INSERT INTO items VALUES (2301, 1, 'item2301');
+INSERT INTO items VALUES (2302, 2, 'item2302');
+INSERT INTO items VALUES (2303, 3, 'item2303');
+INSERT INTO items VALUES (2304, 4, 'item2304');
+INSERT INTO items VALUES (2305, 5, 'item2305');
+INSERT INTO items VALUES (2306, 6, 'item2306');
+INSERT INTO items VALUES (2307, 7, 'item2307');
+INSERT INTO items VALUES (2308, 8, 'item2308');
+INSERT INTO items VALUES (2309, 9, 'item2309');
+INSERT INTO items VALUES (2310, 10, 'item2310');
+INSERT INTO items VALUES (2311, 11, 'item2311');
+INSERT INTO items VALUES (2312, 12, 'item2312');
+INSERT INTO items VALUES (2313, 13, 'item2313');
+INSERT INTO items VALUES (2314, 14, 'item2314');
+INSERT INTO items VALUES (2315, 15, 'item2315');
+INSERT INTO items VALUES (2316, 16, 'item2316');
+INSERT INTO items VALUES (2317, 17, 'item2317');
+INSERT INTO items VALUES (2318, 18, 'item2318');
+INSERT INTO items VALUES (2319, 19, 'item2319');
+INSERT INTO items VALUES (2320, 20, 'item2320');
+INSERT INTO items VALUES (2321, 21, 'item2321');
+INSERT INTO items VALUES (2322, 22, 'item2322');
+INSERT INTO items VALUES (2323, 23, 'item2323');
+INSERT INTO items VALUES (2324, 24, 'item2324');
+INSERT INTO items VALUES (2325, 25, 'item2325');
+INSERT INTO items VALUES (2326, 26, 'item2326');
+INSERT INTO items VALUES (2327, 27, 'item2327');
+INSERT INTO items VALUES (2328, 28, 'item2328');
+INSERT INTO items VALUES (2329, 29, 'item2329');
+INSERT INTO items VALUES (2330, 30, 'item2330');
+INSERT INTO items VALUES (2331, 31, 'item2331');
+INSERT INTO items VALUES (2332, 32, 'item2332');
+INSERT INTO items VALUES (2333, 33, 'item2333');
+INSERT INTO items VALUES (2334, 34, 'item2334');
+INSERT INTO items VALUES (2335, 35, 'item2335');
+INSERT INTO items VALUES (2336, 36, 'item2336');
+INSERT INTO items VALUES (2337, 37, 'item2337');
+INSERT INTO items VALUES (2338, 38, 'item2338');
+INSERT INTO items VALUES (2339, 39, 'item2339');
+INSERT INTO items VALUES (2340, 40, 'item2340');
+INSERT INTO items VALUES (2341, 41, 'item2341');
+INSERT INTO items VALUES (2342, 42, 'item2342');
+INSERT INTO items VALUES (2343, 43, 'item2343');
+INSERT INTO items VALUES (2344, 44, 'item2344');
+INSERT INTO items VALUES (2345, 45, 'item2345');
+INSERT INTO items VALUES (2346, 46, 'item2346');
+INSERT INTO items VALUES (2347, 47, 'item2347');
+INSERT INTO items VALUES (2348, 48, 'item2348');
+INSERT INTO items VALUES (2349, 49, 'item2349');
+INSERT INTO items VALUES (2350, 50, 'item2350');
+INSERT INTO items VALUES (2351, 51, 'item2351');
+INSERT INTO items VALUES (2352, 52, 'item2352');
+INSERT INTO items VALUES (2353, 53, 'item2353');
+INSERT INTO items VALUES (2354, 54, 'item2354');
+INSERT INTO items VALUES (2355, 55, 'item2355');
+INSERT INTO items VALUES (2356, 56, 'item2356');
+INSERT INTO items VALUES (2357, 57, 'item2357');
+INSERT INTO items VALUES (2358, 58, 'item2358');
+INSERT INTO items VALUES (2359, 59, 'item2359');
+INSERT INTO items VALUES (2360, 60, 'item2360');
+INSERT INTO items VALUES (2361, 61, 'item2361');
+INSERT INTO items VALUES (2362, 62, 'item2362');
+INSERT INTO items VALUES (2363, 63, 'item2363');
+INSERT INTO items VALUES (2364, 64, 'item2364');
+INSERT INTO items VALUES (2365, 65, 'item2365');
+INSERT INTO items VALUES (2366, 66, 'item2366');
+INSERT INTO items VALUES (2367, 67, 'item2367');
+INSERT INTO items VALUES (2368, 68, 'item2368');
+INSERT INTO items VALUES (2369, 69, 'item2369');
+INSERT INTO items VALUES (2370, 70, 'item2370');
+INSERT INTO items VALUES (2371, 71, 'item2371');
+INSERT INTO items VALUES (2372, 72, 'item2372');
+INSERT INTO items VALUES (2373, 73, 'item2373');
+INSERT INTO items VALUES (2374, 74, 'item2374');
+INSERT INTO items VALUES (2375, 75, 'item2375');
+INSERT INTO items VALUES (2376, 76, 'item2376');
+INSERT INTO items VALUES (2377, 77, 'item2377');
+INSERT INTO items VALUES (2378, 78, 'item2378');
+INSERT INTO items VALUES (2379, 79, 'item2379');
+INSERT INTO items VALUES (2380, 80, 'item2380');
+INSERT INTO items VALUES (2381, 81, 'item2381');
+INSERT INTO items VALUES (2382, 82, 'item2382');
+INSERT INTO items VALUES (2383, 83, 'item2383');
+INSERT INTO items VALUES (2384, 84, 'item2384');
+INSERT INTO items VALUES (2385, 85, 'item2385');
+INSERT INTO items VALUES (2386, 86, 'item2386');
+INSERT INTO items VALUES (2387, 87, 'item2387');
+INSERT INTO items VALUES (2388, 88, 'item2388');
+INSERT INTO items VALUES (2389, 89, 'item2389');
+INSERT INTO items VALUES (2390, 90, 'item2390');
+INSERT INTO items VALUES (2391, 91, 'item2391');
+INSERT INTO items VALUES (2392, 92, 'item2392');
+INSERT INTO items VALUES (2393, 93, 'item2393');
+INSERT INTO items VALUES (2394, 94, 'item2394');
+INSERT INTO items VALUES (2395, 95, 'item2395');
+INSERT INTO items VALUES (2396, 96, 'item2396');
+INSERT INTO items VALUES (2397, 97, 'item2397');
+INSERT INTO items VALUES (2398, 98, 'item2398');
+INSERT INTO items VALUES (2399, 99, 'item2399');
+INSERT INTO items VALUES (2400, 0, 'item2400');
+INSERT INTO items VALUES (2401, 1, 'item2401');
+INSERT INTO items VALUES (2402, 2, 'item2402');
+INSERT INTO items VALUES (2403, 3, 'item2403');
+INSERT INTO items VALUES (2404, 4, 'item2404');
+INSERT INTO items VALUES (2405, 5, 'item2405');
+INSERT INTO items VALUES (2406, 6, 'item2406');
+INSERT INTO items VALUES (2407, 7, 'item2407');
+INSERT INTO items VALUES (2408, 8, 'item2408');
+INSERT INTO items VALUES (2409, 9, 'item2409');
+INSERT INTO items VALUES (2410, 10, 'item2410');
+INSERT INTO items VALUES (2411, 11, 'item2411');
+INSERT INTO items VALUES (2412, 12, 'item2412');
+INSERT INTO items VALUES (2413, 13, 'item2413');
+INSERT INTO items VALUES (2414, 14, 'item2414');
+INSERT INTO items VALUES (2415, 15, 'item2415');
+INSERT INTO items VALUES (2416, 16, 'item2416');
+INSERT INTO items VALUES (2417, 17, 'item2417');
+INSERT INTO items VALUES (2418, 18, 'item2418');
+INSERT INTO items VALUES (2419, 19, 'item2419');
+INSERT INTO items VALUES (2420, 20, 'item2420');
+INSERT INTO items VALUES (2421, 21, 'item2421');
+INSERT INTO items VALUES (2422, 22, 'item2422');
+INSERT INTO items VALUES (2423, 23, 'item2423');
+INSERT INTO items VALUES (2424, 24, 'item2424');
+INSERT INTO items VALUES (2425, 25, 'item2425');
+INSERT INTO items VALUES (2426, 26, 'item2426');
+INSERT INTO items VALUES (2427, 27, 'item2427');
+INSERT INTO items VALUES (2428, 28, 'item2428');
+INSERT INTO items VALUES (2429, 29, 'item2429');
+INSERT INTO items VALUES (2430, 30, 'item2430');
+INSERT INTO items VALUES (2431, 31, 'item2431');
+INSERT INTO items VALUES (2432, 32, 'item2432');
+INSERT INTO items VALUES (2433, 33, 'item2433');
+INSERT INTO items VALUES (2434, 34, 'item2434');
+INSERT INTO items VALUES (2435, 35, 'item2435');
+INSERT INTO items VALUES (2436, 36, 'item2436');
+INSERT INTO items VALUES (2437, 37, 'item2437');
+INSERT INTO items VALUES (2438, 38, 'item2438');
+INSERT INTO items VALUES (2439, 39, 'item2439');
+INSERT INTO items VALUES (2440, 40, 'item2440');
+INSERT INTO items VALUES (2441, 41, 'item2441');
+INSERT INTO items VALUES (2442, 42, 'item2442');
+INSERT INTO items VALUES (2443, 43, 'item2443');
+INSERT INTO items VALUES (2444, 44, 'item2444');
+INSERT INTO items VALUES (2445, 45, 'item2445');
+INSERT INTO items VALUES (2446, 46, 'item2446');
+INSERT INTO items VALUES (2447, 47, 'item2447');
+INSERT INTO items VALUES (2448, 48, 'item2448');
+INSERT INTO items VALUES (2449, 49, 'item2449');
+INSERT INTO items VALUES (2450, 50, 'item2450');
+INSERT INTO items VALUES (2451, 51, 'item2451');
+INSERT INTO items VALUES (2452, 52, 'item2452');
+INSERT INTO items VALUES (2453, 53, 'item2453');
+INSERT INTO items VALUES (2454, 54, 'item2454');
+INSERT INTO items VALUES (2455, 55, 'item2455');
+INSERT INTO items VALUES (2456, 56, 'item2456');
+INSERT INTO items VALUES (2457, 57, 'item2457');
+INSERT INTO items VALUES (2458, 58, 'item2458');
+INSERT INTO items VALUES (2459, 59, 'item2459');
+INSERT INTO items VALUES (2460, 60, 'item2460');
+INSERT INTO items VALUES (2461, 61, 'item2461');
+INSERT INTO items VALUES (2462, 62, 'item2462');
+INSERT INTO items VALUES (2463, 63, 'item2463');
+INSERT INTO items VALUES (2464, 64, 'item2464');
+INSERT INTO items VALUES (2465, 65, 'item2465');
+INSERT INTO items VALUES (2466, 66, 'item2466');
+INSERT INTO items VALUES (2467, 67, 'item2467');
+INSERT INTO items VALUES (2468, 68, 'item2468');
+INSERT INTO items VALUES (2469, 69, 'item2469');
+INSERT INTO items VALUES (2470, 70, 'item2470');
+INSERT INTO items VALUES (2471, 71, 'item2471');
+INSERT INTO items VALUES (2472, 72, 'item2472');
+INSERT INTO items VALUES (2473, 73, 'item2473');
+INSERT INTO items VALUES (2474, 74, 'item2474');
+INSERT INTO items VALUES (2475, 75, 'item2475');
+INSERT INTO items VALUES (2476, 76, 'item2476');
+INSERT INTO items VALUES (2477, 77, 'item2477');
+INSERT INTO items VALUES (2478, 78, 'item2478');
+INSERT INTO items VALUES (2479, 79, 'item2479');
+INSERT INTO items VALUES (2480, 80, 'item2480');
+INSERT INTO items VALUES (2481, 81, 'item2481');
+INSERT INTO items VALUES (2482, 82, 'item2482');
+INSERT INTO items VALUES (2483, 83, 'item2483');
+INSERT INTO items VALUES (2484, 84, 'item2484');
+INSERT INTO items VALUES (2485, 85, 'item2485');
+INSERT INTO items VALUES (2486, 86, 'item2486');
+INSERT INTO items VALUES (2487, 87, 'item2487');
+INSERT INTO items VALUES (2488, 88, 'item2488');
+INSERT INTO items VALUES (2489, 89, 'item2489');
+INSERT INTO items VALUES (2490, 90, 'item2490');
+INSERT INTO items VALUES (2491, 91, 'item2491');
+INSERT INTO items VALUES (2492, 92, 'item2492');
+INSERT INTO items VALUES (2493, 93, 'item2493');
+INSERT INTO items VALUES (2494, 94, 'item2494');
+INSERT INTO items VALUES (2495, 95, 'item2495');
+INSERT INTO items VALUES (2496, 96, 'item2496');
+INSERT INTO items VALUES (2497, 97, 'item2497');
+INSERT INTO items VALUES (2498, 98, 'item2498');
+INSERT INTO items VALUES (2499, 99, 'item2499');
+INSERT INTO items VALUES (2500, 0, 'item2500');
+INSERT INTO items VALUES (2501, 1, 'item2501');
+INSERT INTO items VALUES (2502, 2, 'item2502');
+INSERT INTO items VALUES (2503, 3, 'item2503');
+INSERT INTO items VALUES (2504, 4, 'item2504');
+INSERT INTO items VALUES (2505, 5, 'item2505');
+INSERT INTO items VALUES (2506, 6, 'item2506');
+INSERT INTO items VALUES (2507, 7, 'item2507');
+INSERT INTO items VALUES (2508, 8, 'item2508');
+INSERT INTO items VALUES (2509, 9, 'item2509');
+INSERT INTO items VALUES (2510, 10, 'item2510');
+INSERT INTO items VALUES (2511, 11, 'item2511');
+INSERT INTO items VALUES (2512, 12, 'item2512');
+INSERT INTO items VALUES (2513, 13, 'item2513');
+INSERT INTO items VALUES (2514, 14, 'item2514');
+INSERT INTO items VALUES (2515, 15, 'item2515');
+INSERT INTO items VALUES (2516, 16, 'item2516');
+INSERT INTO items VALUES (2517, 17, 'item2517');
+INSERT INTO items VALUES (2518, 18, 'item2518');
+INSERT INTO items VALUES (2519, 19, 'item2519');
+INSERT INTO items VALUES (2520, 20, 'item2520');
+INSERT INTO items VALUES (2521, 21, 'item2521');
+INSERT INTO items VALUES (2522, 22, 'item2522');
+INSERT INTO items VALUES (2523, 23, 'item2523');
+INSERT INTO items VALUES (2524, 24, 'item2524');
+INSERT INTO items VALUES (2525, 25, 'item2525');
+INSERT INTO items VALUES (2526, 26, 'item2526');
+INSERT INTO items VALUES (2527, 27, 'item2527');
+INSERT INTO items VALUES (2528, 28, 'item2528');
+INSERT INTO items VALUES (2529, 29, 'item2529');
+INSERT INTO items VALUES (2530, 30, 'item2530');
+INSERT INTO items VALUES (2531, 31, 'item2531');
+INSERT INTO items VALUES (2532, 32, 'item2532');
+INSERT INTO items VALUES (2533, 33, 'item2533');
+INSERT INTO items VALUES (2534, 34, 'item2534');
+INSERT INTO items VALUES (2535, 35, 'item2535');
+INSERT INTO items VALUES (2536, 36, 'item2536');
+INSERT INTO items VALUES (2537, 37, 'item2537');
+INSERT INTO items VALUES (2538, 38, 'item2538');
+INSERT INTO items VALUES (2539, 39, 'item2539');
+INSERT INTO items VALUES (2540, 40, 'item2540');
+INSERT INTO items VALUES (2541, 41, 'item2541');
+INSERT INTO items VALUES (2542, 42, 'item2542');
+INSERT INTO items VALUES (2543, 43, 'item2543');
+INSERT INTO items VALUES (2544, 44, 'item2544');
+INSERT INTO items VALUES (2545, 45, 'item2545');
+INSERT INTO items VALUES (2546, 46, 'item2546');
+INSERT INTO items VALUES (2547, 47, 'item2547');
+INSERT INTO items VALUES (2548, 48, 'item2548');
+INSERT INTO items VALUES (2549, 49, 'item2549');
+INSERT INTO items VALUES (2550, 50, 'item2550');
+INSERT INTO items VALUES (2551, 51, 'item2551');
+INSERT INTO items VALUES (2552, 52, 'item2552');
+INSERT INTO items VALUES (2553, 53, 'item2553');
+INSERT INTO items VALUES (2554, 54, 'item2554');
+INSERT INTO items VALUES (2555, 55, 'item2555');
+INSERT INTO items VALUES (2556, 56, 'item2556');
+INSERT INTO items VALUES (2557, 57, 'item2557');
+INSERT INTO items VALUES (2558, 58, 'item2558');
+INSERT INTO items VALUES (2559, 59, 'item2559');
+INSERT INTO items VALUES (2560, 60, 'item2560');
+INSERT INTO items VALUES (2561, 61, 'item2561');
+INSERT INTO items VALUES (2562, 62, 'item2562');
+INSERT INTO items VALUES (2563, 63, 'item2563');
+INSERT INTO items VALUES (2564, 64, 'item2564');
+INSERT INTO items VALUES (2565, 65, 'item2565');
+INSERT INTO items VALUES (2566, 66, 'item2566');
+INSERT INTO items VALUES (2567, 67, 'item2567');
+INSERT INTO items VALUES (2568, 68, 'item2568');
+INSERT INTO items VALUES (2569, 69, 'item2569');
+INSERT INTO items VALUES (2570, 70, 'item2570');
+INSERT INTO items VALUES (2571, 71, 'item2571');
+INSERT INTO items VALUES (2572, 72, 'item2572');
+INSERT INTO items VALUES (2573, 73, 'item2573');
+INSERT INTO items VALUES (2574, 74, 'item2574');
+INSERT INTO items VALUES (2575, 75, 'item2575');
+INSERT INTO items VALUES (2576, 76, 'item2576');
+INSERT INTO items VALUES (2577, 77, 'item2577');
+INSERT INTO items VALUES (2578, 78, 'item2578');
+INSERT INTO items VALUES (2579, 79, 'item2579');
+INSERT INTO items VALUES (2580, 80, 'item2580');
+INSERT INTO items VALUES (2581, 81, 'item2581');
+INSERT INTO items VALUES (2582, 82, 'item2582');
+INSERT INTO items VALUES (2583, 83, 'item2583');
+INSERT INTO items VALUES (2584, 84, 'item2584');
+INSERT INTO items VALUES (2585, 85, 'item2585');
+INSERT INTO items VALUES (2586, 86, 'item2586');
+INSERT INTO items VALUES (2587, 87, 'item2587');
+INSERT INTO items VALUES (2588, 88, 'item2588');
+INSERT INTO items VALUES (2589, 89, 'item2589');
+INSERT INTO items VALUES (2590, 90, 'item2590');
+INSERT INTO items VALUES (2591, 91, 'item2591');
+INSERT INTO items VALUES (2592, 92, 'item2592');
+INSERT INTO items VALUES (2593, 93, 'item2593');
+INSERT INTO items VALUES (2594, 94, 'item2594');
+INSERT INTO items VALUES (2595, 95, 'item2595');
+INSERT INTO items VALUES (2596, 96, 'item2596');
+INSERT INTO items VALUES (2597, 97, 'item2597');
+INSERT INTO items VALUES (2598, 98, 'item2598');
+INSERT INTO items VALUES (2599, 99, 'item2599');
+INSERT INTO items VALUES (2600, 0, 'item2600');
+INSERT INTO items VALUES (2601, 1, 'item2601');
+INSERT INTO items VALUES (2602, 2, 'item2602');
+INSERT INTO items VALUES (2603, 3, 'item2603');
+INSERT INTO items VALUES (2604, 4, 'item2604');
+INSERT INTO items VALUES (2605, 5, 'item2605');
+INSERT INTO items VALUES (2606, 6, 'item2606');
+INSERT INTO items VALUES (2607, 7, 'item2607');
+INSERT INTO items VALUES (2608, 8, 'item2608');
+INSERT INTO items VALUES (2609, 9, 'item2609');
+INSERT INTO items VALUES (2610, 10, 'item2610');
+INSERT INTO items VALUES (2611, 11, 'item2611');
+INSERT INTO items VALUES (2612, 12, 'item2612');
+INSERT INTO items VALUES (2613, 13, 'item2613');
+INSERT INTO items VALUES (2614, 14, 'item2614');
+INSERT INTO items VALUES (2615, 15, 'item2615');
+INSERT INTO items VALUES (2616, 16, 'item2616');
+INSERT INTO items VALUES (2617, 17, 'item2617');
+INSERT INTO items VALUES (2618, 18, 'item2618');
+INSERT INTO items VALUES (2619, 19, 'item2619');
+INSERT INTO items VALUES (2620, 20, 'item2620');
+INSERT INTO items VALUES (2621, 21, 'item2621');
+INSERT INTO items VALUES (2622, 22, 'item2622');
+INSERT INTO items VALUES (2623, 23, 'item2623');
+INSERT INTO items VALUES (2624, 24, 'item2624');
+INSERT INTO items VALUES (2625, 25, 'item2625');
+INSERT INTO items VALUES (2626, 26, 'item2626');
+INSERT INTO items VALUES (2627, 27, 'item2627');
+INSERT INTO items VALUES (2628, 28, 'item2628');
+INSERT INTO items VALUES (2629, 29, 'item2629');
+INSERT INTO items VALUES (2630, 30, 'item2630');
+INSERT INTO items VALUES (2631, 31, 'item2631');
+INSERT INTO items VALUES (2632, 32, 'item2632');
+INSERT INTO items VALUES (2633, 33, 'item2633');
+INSERT INTO items VALUES (2634, 34, 'item2634');
+INSERT INTO items VALUES (2635, 35, 'item2635');
+INSERT INTO items VALUES (2636, 36, 'item2636');
+INSERT INTO items VALUES (2637, 37, 'item2637');
+INSERT INTO items VALUES (2638, 38, 'item2638');
+INSERT INTO items VALUES (2639, 39, 'item2639');
+INSERT INTO items VALUES (2640, 40, 'item2640');
+INSERT INTO items VALUES (2641, 41, 'item2641');
+INSERT INTO items VALUES (2642, 42, 'item2642');
+INSERT INTO items VALUES (2643, 43, 'item2643');
+INSERT INTO items VALUES (2644, 44, 'item2644');
+INSERT INTO items VALUES (2645, 45, 'item2645');
+INSERT INTO items VALUES (2646, 46, 'item2646');
+INSERT INTO items VALUES (2647, 47, 'item2647');
+INSERT INTO items VALUES (2648, 48, 'item2648');
+INSERT INTO items VALUES (2649, 49, 'item2649');
+INSERT INTO items VALUES (2650, 50, 'item2650');
+INSERT INTO items VALUES (2651, 51, 'item2651');
+INSERT INTO items VALUES (2652, 52, 'item2652');
+INSERT INTO items VALUES (2653, 53, 'item2653');
+INSERT INTO items VALUES (2654, 54, 'item2654');
+INSERT INTO items VALUES (2655, 55, 'item2655');
+INSERT INTO items VALUES (2656, 56, 'item2656');
+INSERT INTO items VALUES (2657, 57, 'item2657');
+INSERT INTO items VALUES (2658, 58, 'item2658');
+INSERT INTO items VALUES (2659, 59, 'item2659');
+INSERT INTO items VALUES (2660, 60, 'item2660');
+INSERT INTO items VALUES (2661, 61, 'item2661');
+INSERT INTO items VALUES (2662, 62, 'item2662');
+INSERT INTO items VALUES (2663, 63, 'item2663');
+INSERT INTO items VALUES (2664, 64, 'item2664');
+INSERT INTO items VALUES (2665, 65, 'item2665');
+INSERT INTO items VALUES (2666, 66, 'item2666');
+INSERT INTO items VALUES (2667, 67, 'item2667');
+INSERT INTO items VALUES (2668, 68, 'item2668');
+INSERT INTO items VALUES (2669, 69, 'item2669');
+INSERT INTO items VALUES (2670, 70, 'item2670');
+INSERT INTO items VALUES (2671, 71, 'item2671');
+INSERT INTO items VALUES (2672, 72, 'item2672');
+INSERT INTO items VALUES (2673, 73, 'item2673');
+INSERT INTO items VALUES (2674, 74, 'item2674');
+INSERT INTO items VALUES (2675, 75, 'item2675');
+INSERT INTO items VALUES (2676, 76, 'item2676');
+INSERT INTO items VALUES (2677, 77, 'item2677');
+INSERT INTO items VALUES (2678, 78, 'item2678');
+INSERT INTO items VALUES (2679, 79, 'item2679');
+INSERT INTO items VALUES (2680, 80, 'item2680');
+INSERT INTO items VALUES (2681, 81, 'item2681');
+INSERT INTO items VALUES (2682, 82, 'item2682');
+INSERT INTO items VALUES (2683, 83, 'item2683');
+INSERT INTO items VALUES (2684, 84, 'item2684');
+INSERT INTO items VALUES (2685, 85, 'item2685');
+INSERT INTO items VALUES (2686, 86, 'item2686');
+INSERT INTO items VALUES (2687, 87, 'item2687');
+INSERT INTO items VALUES (2688, 88, 'item2688');
+INSERT INTO items VALUES (2689, 89, 'item2689');
+INSERT INTO items VALUES (2690, 90, 'item2690');
+INSERT INTO items VALUES (2691, 91, 'item2691');
+INSERT INTO items VALUES (2692, 92, 'item2692');
+INSERT INTO items VALUES (2693, 93, 'item2693');
+INSERT INTO items VALUES (2694, 94, 'item2694');
+INSERT INTO items VALUES (2695, 95, 'item2695');
+INSERT INTO items VALUES (2696, 96, 'item2696');
+INSERT INTO items VALUES (2697, 97, 'item2697');
+INSERT INTO items VALUES (2698, 98, 'item2698');
+INSERT INTO items VALUES (2699, 99, 'item2699');
+INSERT INTO items VALUES (2700, 0, 'item2700');
+INSERT INTO items VALUES (2701, 1, 'item2701');
+INSERT INTO items VALUES (2702, 2, 'item2702');
+INSERT INTO items VALUES (2703, 3, 'item2703');
+INSERT INTO items VALUES (2704, 4, 'item2704');
+INSERT INTO items VALUES (2705, 5, 'item2705');
+INSERT INTO items VALUES (2706, 6, 'item2706');
+INSERT INTO items VALUES (2707, 7, 'item2707');
+INSERT INTO items VALUES (2708, 8, 'item2708');
+INSERT INTO items VALUES (2709, 9, 'item2709');
+INSERT INTO items VALUES (2710, 10, 'item2710');
+INSERT INTO items VALUES (2711, 11, 'item2711');
+INSERT INTO items VALUES (2712, 12, 'item2712');
+INSERT INTO items VALUES (2713, 13, 'item2713');
+INSERT INTO items VALUES (2714, 14, 'item2714');
+INSERT INTO items VALUES (2715, 15, 'item2715');
+INSERT INTO items VALUES (2716, 16, 'item2716');
+INSERT INTO items VALUES (2717, 17, 'item2717');
+INSERT INTO items VALUES (2718, 18, 'item2718');
+INSERT INTO items VALUES (2719, 19, 'item2719');
+INSERT INTO items VALUES (2720, 20, 'item2720');
+INSERT INTO items VALUES (2721, 21, 'item2721');
+INSERT INTO items VALUES (2722, 22, 'item2722');
+INSERT INTO items VALUES (2723, 23, 'item2723');
+INSERT INTO items VALUES (2724, 24, 'item2724');
+INSERT INTO items VALUES (2725, 25, 'item2725');
+INSERT INTO items VALUES (2726, 26, 'item2726');
+INSERT INTO items VALUES (2727, 27, 'item2727');
+INSERT INTO items VALUES (2728, 28, 'item2728');
+INSERT INTO items VALUES (2729, 29, 'item2729');
+INSERT INTO items VALUES (2730, 30, 'item2730');
+INSERT INTO items VALUES (2731, 31, 'item2731');
+INSERT INTO items VALUES (2732, 32, 'item2732');
+INSERT INTO items VALUES (2733, 33, 'item2733');
+INSERT INTO items VALUES (2734, 34, 'item2734');
+INSERT INTO items VALUES (2735, 35, 'item2735');
+INSERT INTO items VALUES (2736, 36, 'item2736');
+INSERT INTO items VALUES (2737, 37, 'item2737');
+INSERT INTO items VALUES (2738, 38, 'item2738');
+INSERT INTO items VALUES (2739, 39, 'item2739');
+INSERT INTO items VALUES (2740, 40, 'item2740');
+INSERT INTO items VALUES (2741, 41, 'item2741');
+INSERT INTO items VALUES (2742, 42, 'item2742');
+INSERT INTO items VALUES (2743, 43, 'item2743');
+INSERT INTO items VALUES (2744, 44, 'item2744');
+INSERT INTO items VALUES (2745, 45, 'item2745');
+INSERT INTO items VALUES (2746, 46, 'item2746');
+INSERT INTO items VALUES (2747, 47, 'item2747');
+INSERT INTO items VALUES (2748, 48, 'item2748');
+INSERT INTO items VALUES (2749, 49, 'item2749');
+INSERT INTO items VALUES (2750, 50, 'item2750');
+INSERT INTO items VALUES (2751, 51, 'item2751');
+INSERT INTO items VALUES (2752, 52, 'item2752');
+INSERT INTO items VALUES (2753, 53, 'item2753');
+INSERT INTO items VALUES (2754, 54, 'item2754');
+INSERT INTO items VALUES (2755, 55, 'item2755');
+INSERT INTO items VALUES (2756, 56, 'item2756');
+INSERT INTO items VALUES (2757, 57, 'item2757');
+INSERT INTO items VALUES (2758, 58, 'item2758');
+INSERT INTO items VALUES (2759, 59, 'item2759');
+INSERT INTO items VALUES (2760, 60, 'item2760');
+INSERT INTO items VALUES (2761, 61, 'item2761');
+INSERT INTO items VALUES (2762, 62, 'item2762');
+INSERT INTO items VALUES (2763, 63, 'item2763');
+INSERT INTO items VALUES (2764, 64, 'item2764');
+INSERT INTO items VALUES (2765, 65, 'item2765');
+INSERT INTO items VALUES (2766, 66, 'item2766');
+INSERT INTO items VALUES (2767, 67, 'item2767');
+INSERT INTO items VALUES (2768, 68, 'item2768');
+INSERT INTO items VALUES (2769, 69, 'item2769');
+INSERT INTO items VALUES (2770, 70, 'item2770');
+INSERT INTO items VALUES (2771, 71, 'item2771');
+INSERT INTO items VALUES (2772, 72, 'item2772');
+INSERT INTO items VALUES (2773, 73, 'item2773');
+INSERT INTO items VALUES (2774, 74, 'item2774');
+INSERT INTO items VALUES (2775, 75, 'item2775');
+INSERT INTO items VALUES (2776, 76, 'item2776');
+INSERT INTO items VALUES (2777, 77, 'item2777');
+INSERT INTO items VALUES (2778, 78, 'item2778');
+INSERT INTO items VALUES (2779, 79, 'item2779');
+INSERT INTO items VALUES (2780, 80, 'item2780');
+INSERT INTO items VALUES (2781, 81, 'item2781');
+INSERT INTO items VALUES (2782, 82, 'item2782');
+INSERT INTO items VALUES (2783, 83, 'item2783');
+INSERT INTO items VALUES (2784, 84, 'item2784');
+INSERT INTO items VALUES (2785, 85, 'item2785');
+INSERT INTO items VALUES (2786, 86, 'item2786');
+INSERT INTO items VALUES (2787, 87, 'item2787');
+INSERT INTO items VALUES (2788, 88, 'item2788');
+INSERT INTO items VALUES (2789, 89, 'item2789');
+INSERT INTO items VALUES (2790, 90, 'item2790');
+INSERT INTO items VALUES (2791, 91, 'item2791');
+INSERT INTO items VALUES (2792, 92, 'item2792');
+INSERT INTO items VALUES (2793, 93, 'item2793');
+INSERT INTO items VALUES (2794, 94, 'item2794');
+INSERT INTO items VALUES (2795, 95, 'item2795');
+INSERT INTO items VALUES (2796, 96, 'item2796');
+INSERT INTO items VALUES (2797, 97, 'item2797');
+INSERT INTO items VALUES (2798, 98, 'item2798');
+INSERT INTO items VALUES (2799, 99, 'item2799');
+INSERT INTO items VALUES (2800, 0, 'item2800');
+INSERT INTO items VALUES (2801, 1, 'item2801');
+INSERT INTO items VALUES (2802, 2, 'item2802');
+INSERT INTO items VALUES (2803, 3, 'item2803');
+INSERT INTO items VALUES (2804, 4, 'item2804');
+INSERT INTO items VALUES (2805, 5, 'item2805');
+INSERT INTO items VALUES (2806, 6, 'item2806');
+INSERT INTO items VALUES (2807, 7, 'item2807');
+INSERT INTO items VALUES (2808, 8, 'item2808');
+INSERT INTO items VALUES (2809, 9, 'item2809');
+INSERT INTO items VALUES (2810, 10, 'item2810');
+INSERT INTO items VALUES (2811, 11, 'item2811');
+INSERT INTO items VALUES (2812, 12, 'item2812');
+INSERT INTO items VALUES (2813, 13, 'item2813');
+INSERT INTO items VALUES (2814, 14, 'item2814');
+INSERT INTO items VALUES (2815, 15, 'item2815');
+INSERT INTO items VALUES (2816, 16, 'item2816');
+INSERT INTO items VALUES (2817, 17, 'item2817');
+INSERT INTO items VALUES (2818, 18, 'item2818');
+INSERT INTO items VALUES (2819, 19, 'item2819');
+INSERT INTO items VALUES (2820, 20, 'item2820');
+INSERT INTO items VALUES (2821, 21, 'item2821');
+INSERT INTO items VALUES (2822, 22, 'item2822');
+INSERT INTO items VALUES (2823, 23, 'item2823');
+INSERT INTO items VALUES (2824, 24, 'item2824');
+INSERT INTO items VALUES (2825, 25, 'item2825');
+INSERT INTO items VALUES (2826, 26, 'item2826');
+INSERT INTO items VALUES (2827, 27, 'item2827');
+INSERT INTO items VALUES (2828, 28, 'item2828');
+INSERT INTO items VALUES (2829, 29, 'item2829');
+INSERT INTO items VALUES (2830, 30, 'item2830');
+INSERT INTO items VALUES (2831, 31, 'item2831');
+INSERT INTO items VALUES (2832, 32, 'item2832');
+INSERT INTO items VALUES (2833, 33, 'item2833');
+INSERT INTO items VALUES (2834, 34, 'item2834');
+INSERT INTO items VALUES (2835, 35, 'item2835');
+INSERT INTO items VALUES (2836, 36, 'item2836');
+INSERT INTO items VALUES (2837, 37, 'item2837');
+INSERT INTO items VALUES (2838, 38, 'item2838');
+INSERT INTO items VALUES (2839, 39, 'item2839');
+INSERT INTO items VALUES (2840, 40, 'item2840');
+INSERT INTO items VALUES (2841, 41, 'item2841');
+INSERT INTO items VALUES (2842, 42, 'item2842');
+INSERT INTO items VALUES (2843, 43, 'item2843');
+INSERT INTO items VALUES (2844, 44, 'item2844');
+INSERT INTO items VALUES (2845, 45, 'item2845');
+INSERT INTO items VALUES (2846, 46, 'item2846');
+INSERT INTO items VALUES (2847, 47, 'item2847');
+INSERT INTO items VALUES (2848, 48, 'item2848');
+INSERT INTO items VALUES (2849, 49, 'item2849');
+INSERT INTO items VALUES (2850, 50, 'item2850');
+INSERT INTO items VALUES (2851, 51, 'item2851');
+INSERT INTO items VALUES (2852, 52, 'item2852');
+INSERT INTO items VALUES (2853, 53, 'item2853');
+INSERT INTO items VALUES (2854, 54, 'item2854');
+INSERT INTO items VALUES (2855, 55, 'item2855');
+INSERT INTO items VALUES (2856, 56, 'item2856');
+INSERT INTO items VALUES (2857, 57, 'item2857');
+INSERT INTO items VALUES (2858, 58, 'item2858');
+INSERT INTO items VALUES (2859, 59, 'item2859');
+INSERT INTO items VALUES (2860, 60, 'item2860');
+INSERT INTO items VALUES (2861, 61, 'item2861');
+INSERT INTO items VALUES (2862, 62, 'item2862');
+INSERT INTO items VALUES (2863, 63, 'item2863');
+INSERT INTO items VALUES (2864, 64, 'item2864');
+INSERT INTO items VALUES (2865, 65, 'item2865');
+INSERT INTO items VALUES (2866, 66, 'item2866');
+INSERT INTO items VALUES (2867, 67, 'item2867');
+INSERT INTO items VALUES (2868, 68, 'item2868');
+INSERT INTO items VALUES (2869, 69, 'item2869');
+INSERT INTO items VALUES (2870, 70, 'item2870');
+INSERT INTO items VALUES (2871, 71, 'item2871');
+INSERT INTO items VALUES (2872, 72, 'item2872');
+INSERT INTO items VALUES (2873, 73, 'item2873');
+INSERT INTO items VALUES (2874, 74, 'item2874');
+INSERT INTO items VALUES (2875, 75, 'item2875');
+INSERT INTO items VALUES (2876, 76, 'item2876');
+INSERT INTO items VALUES (2877, 77, 'item2877');
+INSERT INTO items VALUES (2878, 78, 'item2878');
+INSERT INTO items VALUES (2879, 79, 'item2879');
+INSERT INTO items VALUES (2880, 80, 'item2880');
+INSERT INTO items VALUES (2881, 81, 'item2881');
+INSERT INTO items VALUES (2882, 82, 'item2882');
+INSERT INTO items VALUES (2883, 83, 'item2883');
+INSERT INTO items VALUES (2884, 84, 'item2884');
+INSERT INTO items VALUES (2885, 85, 'item2885');
+INSERT INTO items VALUES (2886, 86, 'item2886');
+INSERT INTO items VALUES (2887, 87, 'item2887');
+INSERT INTO items VALUES (2888, 88, 'item2888');
+INSERT INTO items VALUES (2889, 89, 'item2889');
+INSERT INTO items VALUES (2890, 90, 'item2890');
+INSERT INTO items VALUES (2891, 91, 'item2891');
+INSERT INTO items VALUES (2892, 92, 'item2892');
+INSERT INTO items VALUES (2893, 93, 'item2893');
+INSERT INTO items VALUES (2894, 94, 'item2894');
+INSERT INTO items VALUES (2895, 95, 'item2895');
+INSERT INTO items VALUES (2896, 96, 'item2896');
+INSERT INTO items VALUES (2897, 97, 'item2897');
+INSERT INTO items VALUES (2898, 98, 'item2898');
+INSERT INTO items VALUES (2899, 99, 'item2899');
+INSERT INTO items VALUES (2900, 0, 'item2900');
+INSERT INTO items VALUES (2901, 1, 'item2901');
+INSERT INTO items VALUES (2902, 2, 'item2902');
+INSERT INTO items VALUES (2903, 3, 'item2903');
+INSERT INTO items VALUES (2904, 4, 'item2904');
+INSERT INTO items VALUES (2905, 5, 'item2905');
+INSERT INTO items VALUES (2906, 6, 'item2906');
+INSERT INTO items VALUES (2907, 7, 'item2907');
+INSERT INTO items VALUES (2908, 8, 'item2908');
+INSERT INTO items VALUES (2909, 9, 'item2909');
+INSERT INTO items VALUES (2910, 10, 'item2910');
+INSERT INTO items VALUES (2911, 11, 'item2911');
+INSERT INTO items VALUES (2912, 12, 'item2912');
+INSERT INTO items VALUES (2913, 13, 'item2913');
+INSERT INTO items VALUES (2914, 14, 'item2914');
+INSERT INTO items VALUES (2915, 15, 'item2915');
+INSERT INTO items VALUES (2916, 16, 'item2916');
+INSERT INTO items VALUES (2917, 17, 'item2917');
+INSERT INTO items VALUES (2918, 18, 'item2918');
+INSERT INTO items VALUES (2919, 19, 'item2919');
+INSERT INTO items VALUES (2920, 20, 'item2920');
+INSERT INTO items VALUES (2921, 21, 'item2921');
+INSERT INTO items VALUES (2922, 22, 'item2922');
+INSERT INTO items VALUES (2923, 23, 'item2923');
+INSERT INTO items VALUES (2924, 24, 'item2924');
+INSERT INTO items VALUES (2925, 25, 'item2925');
+INSERT INTO items VALUES (2926, 26, 'item2926');
+INSERT INTO items VALUES (2927, 27, 'item2927');
+INSERT INTO items VALUES (2928, 28, 'item2928');
+INSERT INTO items VALUES (2929, 29, 'item2929');
+INSERT INTO items VALUES (2930, 30, 'item2930');
+INSERT INTO items VALUES (2931, 31, 'item2931');
+INSERT INTO items VALUES (2932, 32, 'item2932');
+INSERT INTO items VALUES (2933, 33, 'item2933');
+INSERT INTO items VALUES (2934, 34, 'item2934');
+INSERT INTO items VALUES (2935, 35, 'item2935');
+INSERT INTO items VALUES (2936, 36, 'item2936');
+INSERT INTO items VALUES (2937, 37, 'item2937');
+INSERT INTO items VALUES (2938, 38, 'item2938');
+INSERT INTO items VALUES (2939, 39, 'item2939');
+INSERT INTO items VALUES (2940, 40, 'item2940');
+INSERT INTO items VALUES (2941, 41, 'item2941');
+INSERT INTO items VALUES (2942, 42, 'item2942');
+INSERT INTO items VALUES (2943, 43, 'item2943');
+INSERT INTO items VALUES (2944, 44, 'item2944');
+INSERT INTO items VALUES (2945, 45, 'item2945');
+INSERT INTO items VALUES (2946, 46, 'item2946');
+INSERT INTO items VALUES (2947, 47, 'item2947');
+INSERT INTO items VALUES (2948, 48, 'item2948');
+INSERT INTO items VALUES (2949, 49, 'item2949');
+INSERT INTO items VALUES (2950, 50, 'item2950');
+INSERT INTO items VALUES (2951, 51, 'item2951');
+INSERT INTO items VALUES (2952, 52, 'item2952');
+INSERT INTO items VALUES (2953, 53, 'item2953');
+INSERT INTO items VALUES (2954, 54, 'item2954');
+INSERT INTO items VALUES (2955, 55, 'item2955');
+INSERT INTO items VALUES (2956, 56, 'item2956');
+INSERT INTO items VALUES (2957, 57, 'item2957');
+INSERT INTO items VALUES (2958, 58, 'item2958');
+INSERT INTO items VALUES (2959, 59, 'item2959');
+INSERT INTO items VALUES (2960, 60, 'item2960');
+INSERT INTO items VALUES (2961, 61, 'item2961');
+INSERT INTO items VALUES (2962, 62, 'item2962');
+INSERT INTO items VALUES (2963, 63, 'item2963');
+INSERT INTO items VALUES (2964, 64, 'item2964');
+INSERT INTO items VALUES (2965, 65, 'item2965');
+INSERT INTO items VALUES (2966, 66, 'item2966');
+INSERT INTO items VALUES (2967, 67, 'item2967');
+INSERT INTO items VALUES (2968, 68, 'item2968');
+INSERT INTO items VALUES (2969, 69, 'item2969');
+INSERT INTO items VALUES (2970, 70, 'item2970');
+INSERT INTO items VALUES (2971, 71, 'item2971');
+INSERT INTO items VALUES (2972, 72, 'item2972');
+INSERT INTO items VALUES (2973, 73, 'item2973');
+INSERT INTO items VALUES (2974, 74, 'item2974');
+INSERT INTO items VALUES (2975, 75, 'item2975');
+INSERT INTO items VALUES (2976, 76, 'item2976');
+INSERT INTO items VALUES (2977, 77, 'item2977');
+INSERT INTO items VALUES (2978, 78, 'item2978');
+INSERT INTO items VALUES (2979, 79, 'item2979');
+INSERT INTO items VALUES (2980, 80, 'item2980');
+INSERT INTO items VALUES (2981, 81, 'item2981');
+INSERT INTO items VALUES (2982, 82, 'item2982');
+INSERT INTO items VALUES (2983, 83, 'item2983');
+INSERT INTO items VALUES (2984, 84, 'item2984');
+INSERT INTO items VALUES (2985, 85, 'item2985');
+INSERT INTO items VALUES (2986, 86, 'item2986');
+INSERT INTO items VALUES (2987, 87, 'item2987');
+INSERT INTO items VALUES (2988, 88, 'item2988');
+INSERT INTO items VALUES (2989, 89, 'item2989');
+INSERT INTO items VALUES (2990, 90, 'item2990');
+INSERT INTO items VALUES (2991, 91, 'item2991');
+INSERT INTO items VALUES (2992, 92, 'item2992');
+INSERT INTO items VALUES (2993, 93, 'item2993');
+INSERT INTO items VALUES (2994, 94, 'item2994');
+INSERT INTO items VALUES (2995, 95, 'item2995');
+INSERT INTO items VALUES (2996, 96, 'item2996');
+INSERT INTO items VALUES (2997, 97, 'item2997');
+INSERT INTO items VALUES (2998, 98, 'item2998');
+INSERT INTO items VALUES (2999, 99, 'item2999');
+INSERT INTO items VALUES (3000, 0, 'item3000');
+INSERT INTO items VALUES (3001, 1, 'item3001');
+INSERT INTO items VALUES (3002, 2, 'item3002');
+INSERT INTO items VALUES (3003, 3, 'item3003');
+INSERT INTO items VALUES (3004, 4, 'item3004');
+INSERT INTO items VALUES (3005, 5, 'item3005');
+INSERT INTO items VALUES (3006, 6, 'item3006');
+INSERT INTO items VALUES (3007, 7, 'item3007');
+INSERT INTO items VALUES (3008, 8, 'item3008');
+INSERT INTO items VALUES (3009, 9, 'item3009');
+INSERT INTO items VALUES (3010, 10, 'item3010');
+INSERT INTO items VALUES (3011, 11, 'item3011');
+INSERT INTO items VALUES (3012, 12, 'item3012');
+INSERT INTO items VALUES (3013, 13, 'item3013');
+INSERT INTO items VALUES (3014, 14, 'item3014');
+INSERT INTO items VALUES (3015, 15, 'item3015');
+INSERT INTO items VALUES (3016, 16, 'item3016');
+INSERT INTO items VALUES (3017, 17, 'item3017');
+INSERT INTO items VALUES (3018, 18, 'item3018');
+INSERT INTO items VALUES (3019, 19, 'item3019');
+INSERT INTO items VALUES (3020, 20, 'item3020');
+INSERT INTO items VALUES (3021, 21, 'item3021');
+INSERT INTO items VALUES (3022, 22, 'item3022');
+INSERT INTO items VALUES (3023, 23, 'item3023');
+INSERT INTO items VALUES (3024, 24, 'item3024');
+INSERT INTO items VALUES (3025, 25, 'item3025');
+INSERT INTO items VALUES (3026, 26, 'item3026');
+INSERT INTO items VALUES (3027, 27, 'item3027');
+INSERT INTO items VALUES (3028, 28, 'item3028');
+INSERT INTO items VALUES (3029, 29, 'item3029');
+INSERT INTO items VALUES (3030, 30, 'item3030');
+INSERT INTO items VALUES (3031, 31, 'item3031');
+INSERT INTO items VALUES (3032, 32, 'item3032');
+INSERT INTO items VALUES (3033, 33, 'item3033');
+INSERT INTO items VALUES (3034, 34, 'item3034');
+INSERT INTO items VALUES (3035, 35, 'item3035');
+INSERT INTO items VALUES (3036, 36, 'item3036');
+INSERT INTO items VALUES (3037, 37, 'item3037');
+INSERT INTO items VALUES (3038, 38, 'item3038');
+INSERT INTO items VALUES (3039, 39, 'item3039');
+INSERT INTO items VALUES (3040, 40, 'item3040');
+INSERT INTO items VALUES (3041, 41, 'item3041');
+INSERT INTO items VALUES (3042, 42, 'item3042');
+INSERT INTO items VALUES (3043, 43, 'item3043');
+INSERT INTO items VALUES (3044, 44, 'item3044');
+INSERT INTO items VALUES (3045, 45, 'item3045');
+INSERT INTO items VALUES (3046, 46, 'item3046');
+INSERT INTO items VALUES (3047, 47, 'item3047');
+INSERT INTO items VALUES (3048, 48, 'item3048');
+INSERT INTO items VALUES (3049, 49, 'item3049');
+INSERT INTO items VALUES (3050, 50, 'item3050');
+INSERT INTO items VALUES (3051, 51, 'item3051');
+INSERT INTO items VALUES (3052, 52, 'item3052');
+INSERT INTO items VALUES (3053, 53, 'item3053');
+INSERT INTO items VALUES (3054, 54, 'item3054');
+INSERT INTO items VALUES (3055, 55, 'item3055');
+INSERT INTO items VALUES (3056, 56, 'item3056');
+INSERT INTO items VALUES (3057, 57, 'item3057');
+INSERT INTO items VALUES (3058, 58, 'item3058');
+INSERT INTO items VALUES (3059, 59, 'item3059');
+INSERT INTO items VALUES (3060, 60, 'item3060');
+INSERT INTO items VALUES (3061, 61, 'item3061');
+INSERT INTO items VALUES (3062, 62, 'item3062');
+INSERT INTO items VALUES (3063, 63, 'item3063');
+INSERT INTO items VALUES (3064, 64, 'item3064');
+INSERT INTO items VALUES (3065, 65, 'item3065');
+INSERT INTO items VALUES (3066, 66, 'item3066');
+INSERT INTO items VALUES (3067, 67, 'item3067');
+INSERT INTO items VALUES (3068, 68, 'item3068');
+INSERT INTO items VALUES (3069, 69, 'item3069');
+INSERT INTO items VALUES (3070, 70, 'item3070');
+INSERT INTO items VALUES (3071, 71, 'item3071');
+INSERT INTO items VALUES (3072, 72, 'item3072');
+INSERT INTO items VALUES (3073, 73, 'item3073');
+INSERT INTO items VALUES (3074, 74, 'item3074');
+INSERT INTO items VALUES (3075, 75, 'item3075');
+INSERT INTO items VALUES (3076, 76, 'item3076');
+INSERT INTO items VALUES (3077, 77, 'item3077');
+INSERT INTO items VALUES (3078, 78, 'item3078');
+INSERT INTO items VALUES (3079, 79, 'item3079');
+INSERT INTO items VALUES (3080, 80, 'item3080');
+INSERT INTO items VALUES (3081, 81, 'item3081');
+INSERT INTO items VALUES (3082, 82, 'item3082');
+INSERT INTO items VALUES (3083, 83, 'item3083');
+INSERT INTO items VALUES (3084, 84, 'item3084');
+INSERT INTO items VALUES (3085, 85, 'item3085');
+INSERT INTO items VALUES (3086, 86, 'item3086');
+INSERT INTO items VALUES (3087, 87, 'item3087');
+INSERT INTO items VALUES (3088, 88, 'item3088');
+INSERT INTO items VALUES (3089, 89, 'item3089');
+INSERT INTO items VALUES (3090, 90, 'item3090');
+INSERT INTO items VALUES (3091, 91, 'item3091');
+INSERT INTO items VALUES (3092, 92, 'item3092');
+INSERT INTO items VALUES (3093, 93, 'item3093');
+INSERT INTO items VALUES (3094, 94, 'item3094');
+INSERT INTO items VALUES (3095, 95, 'item3095');
+INSERT INTO items VALUES (3096, 96, 'item3096');
+INSERT INTO items VALUES (3097, 97, 'item3097');
+INSERT INTO items VALUES (3098, 98, 'item3098');
+INSERT INTO items VALUES (3099, 99, 'item3099');
+INSERT INTO items VALUES (3100, 0, 'item3100');
+INSERT INTO items VALUES (3101, 1, 'item3101');
+INSERT INTO items VALUES (3102, 2, 'item3102');
+INSERT INTO items VALUES (3103, 3, 'item3103');
+INSERT INTO items VALUES (3104, 4, 'item3104');
+INSERT INTO items VALUES (3105, 5, 'item3105');
+INSERT INTO items VALUES (3106, 6, 'item3106');
+INSERT INTO items VALUES (3107, 7, 'item3107');
+INSERT INTO items VALUES (3108, 8, 'item3108');
+INSERT INTO items VALUES (3109, 9, 'item3109');
+INSERT INTO items VALUES (3110, 10, 'item3110');
+INSERT INTO items VALUES (3111, 11, 'item3111');
+INSERT INTO items VALUES (3112, 12, 'item3112');
+INSERT INTO items VALUES (3113, 13, 'item3113');
+INSERT INTO items VALUES (3114, 14, 'item3114');
+INSERT INTO items VALUES (3115, 15, 'item3115');
+INSERT INTO items VALUES (3116, 16, 'item3116');
+INSERT INTO items VALUES (3117, 17, 'item3117');
+INSERT INTO items VALUES (3118, 18, 'item3118');
+INSERT INTO items VALUES (3119, 19, 'item3119');
+INSERT INTO items VALUES (3120, 20, 'item3120');
+INSERT INTO items VALUES (3121, 21, 'item3121');
+INSERT INTO items VALUES (3122, 22, 'item3122');
+INSERT INTO items VALUES (3123, 23, 'item3123');
+INSERT INTO items VALUES (3124, 24, 'item3124');
+INSERT INTO items VALUES (3125, 25, 'item3125');
+INSERT INTO items VALUES (3126, 26, 'item3126');
+INSERT INTO items VALUES (3127, 27, 'item3127');
+INSERT INTO items VALUES (3128, 28, 'item3128');
+INSERT INTO items VALUES (3129, 29, 'item3129');
+INSERT INTO items VALUES (3130, 30, 'item3130');
+INSERT INTO items VALUES (3131, 31, 'item3131');
+INSERT INTO items VALUES (3132, 32, 'item3132');
+INSERT INTO items VALUES (3133, 33, 'item3133');
+INSERT INTO items VALUES (3134, 34, 'item3134');
+INSERT INTO items VALUES (3135, 35, 'item3135');
+INSERT INTO items VALUES (3136, 36, 'item3136');
+INSERT INTO items VALUES (3137, 37, 'item3137');
+INSERT INTO items VALUES (3138, 38, 'item3138');
+INSERT INTO items VALUES (3139, 39, 'item3139');
+INSERT INTO items VALUES (3140, 40, 'item3140');
+INSERT INTO items VALUES (3141, 41, 'item3141');
+INSERT INTO items VALUES (3142, 42, 'item3142');
+INSERT INTO items VALUES (3143, 43, 'item3143');
+INSERT INTO items VALUES (3144, 44, 'item3144');
+INSERT INTO items VALUES (3145, 45, 'item3145');
+INSERT INTO items VALUES (3146, 46, 'item3146');
+INSERT INTO items VALUES (3147, 47, 'item3147');
+INSERT INTO items VALUES (3148, 48, 'item3148');
+INSERT INTO items VALUES (3149, 49, 'item3149');
+INSERT INTO items VALUES (3150, 50, 'item3150');
+INSERT INTO items VALUES (3151, 51, 'item3151');
+INSERT INTO items VALUES (3152, 52, 'item3152');
+INSERT INTO items VALUES (3153, 53, 'item3153');
+INSERT INTO items VALUES (3154, 54, 'item3154');
+INSERT INTO items VALUES (3155, 55, 'item3155');
+INSERT INTO items VALUES (3156, 56, 'item3156');
+INSERT INTO items VALUES (3157, 57, 'item3157');
+INSERT INTO items VALUES (3158, 58, 'item3158');
+INSERT INTO items VALUES (3159, 59, 'item3159');
+INSERT INTO items VALUES (3160, 60, 'item3160');
+INSERT INTO items VALUES (3161, 61, 'item3161');
+INSERT INTO items VALUES (3162, 62, 'item3162');
+INSERT INTO items VALUES (3163, 63, 'item3163');
+INSERT INTO items VALUES (3164, 64, 'item3164');
+INSERT INTO items VALUES (3165, 65, 'item3165');
+INSERT INTO items VALUES (3166, 66, 'item3166');
+INSERT INTO items VALUES (3167, 67, 'item3167');
+INSERT INTO items VALUES (3168, 68, 'item3168');
+INSERT INTO items VALUES (3169, 69, 'item3169');
+INSERT INTO items VALUES (3170, 70, 'item3170');
+INSERT INTO items VALUES (3171, 71, 'item3171');
+INSERT INTO items VALUES (3172, 72, 'item3172');
+INSERT INTO items VALUES (3173, 73, 'item3173');
+INSERT INTO items VALUES (3174, 74, 'item3174');
+INSERT INTO items VALUES (3175, 75, 'item3175');
+INSERT INTO items VALUES (3176, 76, 'item3176');
+INSERT INTO items VALUES (3177, 77, 'item3177');
+INSERT INTO items VALUES (3178, 78, 'item3178');
+INSERT INTO items VALUES (3179, 79, 'item3179');
+INSERT INTO items VALUES (3180, 80, 'item3180');
+INSERT INTO items VALUES (3181, 81, 'item3181');
+INSERT INTO items VALUES (3182, 82, 'item3182');
+INSERT INTO items VALUES (3183, 83, 'item3183');
+INSERT INTO items VALUES (3184, 84, 'item3184');
+INSERT INTO items VALUES (3185, 85, 'item3185');
+INSERT INTO items VALUES (3186, 86, 'item3186');
+INSERT INTO items VALUES (3187, 87, 'item3187');
+INSERT INTO items VALUES (3188, 88, 'item3188');
+INSERT INTO items VALUES (3189, 89, 'item3189');
+INSERT INTO items VALUES (3190, 90, 'item3190');
+INSERT INTO items VALUES (3191, 91, 'item3191');
+INSERT INTO items VALUES (3192, 92, 'item3192');
+INSERT INTO items VALUES (3193, 93, 'item3193');
+INSERT INTO items VALUES (3194, 94, 'item3194');
+INSERT INTO items VALUES (3195, 95, 'item3195');
+INSERT INTO items VALUES (3196, 96, 'item3196');
+INSERT INTO items VALUES (3197, 97, 'item3197');
+INSERT INTO items VALUES (3198, 98, 'item3198');
+INSERT INTO items VALUES (3199, 99, 'item3199');
+INSERT INTO items VALUES (3200, 0, 'item3200');
+INSERT INTO items VALUES (3201, 1, 'item3201');
+INSERT INTO items VALUES (3202, 2, 'item3202');
+INSERT INTO items VALUES (3203, 3, 'item3203');
+INSERT INTO items VALUES (3204, 4, 'item3204');
+INSERT INTO items VALUES (3205, 5, 'item3205');
+INSERT INTO items VALUES (3206, 6, 'item3206');
+INSERT INTO items VALUES (3207, 7, 'item3207');
+INSERT INTO items VALUES (3208, 8, 'item3208');
+INSERT INTO items VALUES (3209, 9, 'item3209');
+INSERT INTO items VALUES (3210, 10, 'item3210');
+INSERT INTO items VALUES (3211, 11, 'item3211');
+INSERT INTO items VALUES (3212, 12, 'item3212');
+INSERT INTO items VALUES (3213, 13, 'item3213');
+INSERT INTO items VALUES (3214, 14, 'item3214');
+INSERT INTO items VALUES (3215, 15, 'item3215');
+INSERT INTO items VALUES (3216, 16, 'item3216');
+INSERT INTO items VALUES (3217, 17, 'item3217');
+INSERT INTO items VALUES (3218, 18, 'item3218');
+INSERT INTO items VALUES (3219, 19, 'item3219');
+INSERT INTO items VALUES (3220, 20, 'item3220');
+INSERT INTO items VALUES (3221, 21, 'item3221');
+INSERT INTO items VALUES (3222, 22, 'item3222');
+INSERT INTO items VALUES (3223, 23, 'item3223');
+INSERT INTO items VALUES (3224, 24, 'item3224');
+INSERT INTO items VALUES (3225, 25, 'item3225');
+INSERT INTO items VALUES (3226, 26, 'item3226');
+INSERT INTO items VALUES (3227, 27, 'item3227');
+INSERT INTO items VALUES (3228, 28, 'item3228');
+INSERT INTO items VALUES (3229, 29, 'item3229');
+INSERT INTO items VALUES (3230, 30, 'item3230');
+INSERT INTO items VALUES (3231, 31, 'item3231');
+INSERT INTO items VALUES (3232, 32, 'item3232');
+INSERT INTO items VALUES (3233, 33, 'item3233');
+INSERT INTO items VALUES (3234, 34, 'item3234');
+INSERT INTO items VALUES (3235, 35, 'item3235');
+INSERT INTO items VALUES (3236, 36, 'item3236');
+INSERT INTO items VALUES (3237, 37, 'item3237');
+INSERT INTO items VALUES (3238, 38, 'item3238');
+INSERT INTO items VALUES (3239, 39, 'item3239');
+INSERT INTO items VALUES (3240, 40, 'item3240');
+INSERT INTO items VALUES (3241, 41, 'item3241');
+INSERT INTO items VALUES (3242, 42, 'item3242');
+INSERT INTO items VALUES (3243, 43, 'item3243');
+INSERT INTO items VALUES (3244, 44, 'item3244');
+INSERT INTO items VALUES (3245, 45, 'item3245');
+INSERT INTO items VALUES (3246, 46, 'item3246');
+INSERT INTO items VALUES (3247, 47, 'item3247');
+INSERT INTO items VALUES (3248, 48, 'item3248');
+INSERT INTO items VALUES (3249, 49, 'item3249');
+INSERT INTO items VALUES (3250, 50, 'item3250');
+INSERT INTO items VALUES (3251, 51, 'item3251');
+INSERT INTO items VALUES (3252, 52, 'item3252');
+INSERT INTO items VALUES (3253, 53, 'item3253');
+INSERT INTO items VALUES (3254, 54, 'item3254');
+INSERT INTO items VALUES (3255, 55, 'item3255');
+INSERT INTO items VALUES (3256, 56, 'item3256');
+INSERT INTO items VALUES (3257, 57, 'item3257');
+INSERT INTO items VALUES (3258, 58, 'item3258');
+INSERT INTO items VALUES (3259, 59, 'item3259');
+INSERT INTO items VALUES (3260, 60, 'item3260');
+INSERT INTO items VALUES (3261, 61, 'item3261');
+INSERT INTO items VALUES (3262, 62, 'item3262');
+INSERT INTO items VALUES (3263, 63, 'item3263');
+INSERT INTO items VALUES (3264, 64, 'item3264');
+INSERT INTO items VALUES (3265, 65, 'item3265');
+INSERT INTO items VALUES (3266, 66, 'item3266');
+INSERT INTO items VALUES (3267, 67, 'item3267');
+INSERT INTO items VALUES (3268, 68, 'item3268');
+INSERT INTO items VALUES (3269, 69, 'item3269');
+INSERT INTO items VALUES (3270, 70, 'item3270');
+INSERT INTO items VALUES (3271, 71, 'item3271');
+INSERT INTO items VALUES (3272, 72, 'item3272');
+INSERT INTO items VALUES (3273, 73, 'item3273');
+INSERT INTO items VALUES (3274, 74, 'item3274');
+INSERT INTO items VALUES (3275, 75, 'item3275');
+INSERT INTO items VALUES (3276, 76, 'item3276');
+INSERT INTO items VALUES (3277, 77, 'item3277');
+INSERT INTO items VALUES (3278, 78, 'item3278');
+INSERT INTO items VALUES (3279, 79, 'item3279');
+INSERT INTO items VALUES (3280, 80, 'item3280');
+INSERT INTO items VALUES (3281, 81, 'item3281');
+INSERT INTO items VALUES (3282, 82, 'item3282');
+INSERT INTO items VALUES (3283, 83, 'item3283');
+INSERT INTO items VALUES (3284, 84, 'item3284');
+INSERT INTO items VALUES (3285, 85, 'item3285');
+INSERT INTO items VALUES (3286, 86, 'item3286');
+INSERT INTO items VALUES (3287, 87, 'item3287');
+INSERT INTO items VALUES (3288, 88, 'item3288');
+INSERT INTO items VALUES (3289, 89, 'item3289');
+INSERT INTO items VALUES (3290, 90, 'item3290');
+INSERT INTO items VALUES (3291, 91, 'item3291');
+INSERT INTO items VALUES (3292, 92, 'item3292');
+INSERT INTO items VALUES (3293, 93, 'item3293');
+INSERT INTO items VALUES (3294, 94, 'item3294');
+INSERT INTO items VALUES (3295, 95, 'item3295');
+INSERT INTO items VALUES (3296, 96, 'item3296');
+INSERT INTO items VALUES (3297, 97, 'item3297');
+INSERT INTO items VALUES (3298, 98, 'item3298');
+INSERT INTO items VALUES (3299, 99, 'item3299');
+INSERT INTO items VALUES (3300, 0, 'item3300');
+INSERT INTO items VALUES (3301, 1, 'item3301');
+INSERT INTO items VALUES (3302, 2, 'item3302');
+INSERT INTO items VALUES (3303, 3, 'item3303');
+INSERT INTO items VALUES (3304, 4, 'item3304');
+INSERT INTO items VALUES (3305, 5, 'item3305');
+INSERT INTO items VALUES (3306, 6, 'item3306');
+INSERT INTO items VALUES (3307, 7, 'item3307');
+INSERT INTO items VALUES (3308, 8, 'item3308');
+INSERT INTO items VALUES (3309, 9, 'item3309');
+INSERT INTO items VALUES (3310, 10, 'item3310');
+INSERT INTO items VALUES (3311, 11, 'item3311');
+INSERT INTO items VALUES (3312, 12, 'item3312');
+INSERT INTO items VALUES (3313, 13, 'item3313');
+INSERT INTO items VALUES (3314, 14, 'item3314');
+INSERT INTO items VALUES (3315, 15, 'item3315');
+INSERT INTO items VALUES (3316, 16, 'item3316');
+INSERT INTO items VALUES (3317, 17, 'item3317');
+INSERT INTO items VALUES (3318, 18, 'item3318');
+INSERT INTO items VALUES (3319, 19, 'item3319');
+INSERT INTO items VALUES (3320, 20, 'item3320');
+INSERT INTO items VALUES (3321, 21, 'item3321');
+INSERT INTO items VALUES (3322, 22, 'item3322');
+INSERT INTO items VALUES (3323, 23, 'item3323');
+INSERT INTO items VALUES (3324, 24, 'item3324');
+INSERT INTO items VALUES (3325, 25, 'item3325');
+INSERT INTO items VALUES (3326, 26, 'item3326');
+INSERT INTO items VALUES (3327, 27, 'item3327');
+INSERT INTO items VALUES (3328, 28, 'item3328');
+INSERT INTO items VALUES (3329, 29, 'item3329');
+INSERT INTO items VALUES (3330, 30, 'item3330');
+INSERT INTO items VALUES (3331, 31, 'item3331');
+INSERT INTO items VALUES (3332, 32, 'item3332');
+INSERT INTO items VALUES (3333, 33, 'item3333');
+INSERT INTO items VALUES (3334, 34, 'item3334');
+INSERT INTO items VALUES (3335, 35, 'item3335');
+INSERT INTO items VALUES (3336, 36, 'item3336');
+INSERT INTO items VALUES (3337, 37, 'item3337');
+INSERT INTO items VALUES (3338, 38, 'item3338');
+INSERT INTO items VALUES (3339, 39, 'item3339');
+INSERT INTO items VALUES (3340, 40, 'item3340');
+INSERT INTO items VALUES (3341, 41, 'item3341');
+INSERT INTO items VALUES (3342, 42, 'item3342');
+INSERT INTO items VALUES (3343, 43, 'item3343');
+INSERT INTO items VALUES (3344, 44, 'item3344');
+INSERT INTO items VALUES (3345, 45, 'item3345');
+INSERT INTO items VALUES (3346, 46, 'item3346');
+INSERT INTO items VALUES (3347, 47, 'item3347');
+INSERT INTO items VALUES (3348, 48, 'item3348');
+INSERT INTO items VALUES (3349, 49, 'item3349');
+INSERT INTO items VALUES (3350, 50, 'item3350');
+INSERT INTO items VALUES (3351, 51, 'item3351');
+INSERT INTO items VALUES (3352, 52, 'item3352');
+INSERT INTO items VALUES (3353, 53, 'item3353');
+INSERT INTO items VALUES (3354, 54, 'item3354');
+INSERT INTO items VALUES (3355, 55, 'item3355');
+INSERT INTO items VALUES (3356, 56, 'item3356');
+INSERT INTO items VALUES (3357, 57, 'item3357');
+INSERT INTO items VALUES (3358, 58, 'item3358');
+INSERT INTO items VALUES (3359, 59, 'item3359');
+INSERT INTO items VALUES (3360, 60, 'item3360');
+INSERT INTO items VALUES (3361, 61, 'item3361');
+INSERT INTO items VALUES (3362, 62, 'item3362');
+INSERT INTO items VALUES (3363, 63, 'item3363');
+INSERT INTO items VALUES (3364, 64, 'item3364');
+INSERT INTO items VALUES (3365, 65, 'item3365');
+INSERT INTO items VALUES (3366, 66, 'item3366');
+INSERT INTO items VALUES (3367, 67, 'item3367');
+INSERT INTO items VALUES (3368, 68, 'item3368');
+INSERT INTO items VALUES (3369, 69, 'item3369');
+INSERT INTO items VALUES (3370, 70, 'item3370');
+INSERT INTO items VALUES (3371, 71, 'item3371');
+INSERT INTO items VALUES (3372, 72, 'item3372');
+INSERT INTO items VALUES (3373, 73, 'item3373');
+INSERT INTO items VALUES (3374, 74, 'item3374');
+INSERT INTO items VALUES (3375, 75, 'item3375');
+INSERT INTO items VALUES (3376, 76, 'item3376');
+INSERT INTO items VALUES (3377, 77, 'item3377');
+INSERT INTO items VALUES (3378, 78, 'item3378');
+INSERT INTO items VALUES (3379, 79, 'item3379');
+INSERT INTO items VALUES (3380, 80, 'item3380');
+INSERT INTO items VALUES (3381, 81, 'item3381');
+INSERT INTO items VALUES (3382, 82, 'item3382');
+INSERT INTO items VALUES (3383, 83, 'item3383');
+INSERT INTO items VALUES (3384, 84, 'item3384');
+INSERT INTO items VALUES (3385, 85, 'item3385');
+INSERT INTO items VALUES (3386, 86, 'item3386');
+INSERT INTO items VALUES (3387, 87, 'item3387');
+INSERT INTO items VALUES (3388, 88, 'item3388');
+INSERT INTO items VALUES (3389, 89, 'item3389');
+INSERT INTO items VALUES (3390, 90, 'item3390');
+INSERT INTO items VALUES (3391, 91, 'item3391');
+INSERT INTO items VALUES (3392, 92, 'item3392');
+INSERT INTO items VALUES (3393, 93, 'item3393');
+INSERT INTO items VALUES (3394, 94, 'item3394');
+INSERT INTO items VALUES (3395, 95, 'item3395');
+INSERT INTO items VALUES (3396, 96, 'item3396');
+INSERT INTO items VALUES (3397, 97, 'item3397');
+INSERT INTO items VALUES (3398, 98, 'item3398');
+INSERT INTO items VALUES (3399, 99, 'item3399');
+INSERT INTO items VALUES (3400, 0, 'item3400');
+INSERT INTO items VALUES (3401, 1, 'item3401');
+INSERT INTO items VALUES (3402, 2, 'item3402');
+INSERT INTO items VALUES (3403, 3, 'item3403');
+INSERT INTO items VALUES (3404, 4, 'item3404');
+INSERT INTO items VALUES (3405, 5, 'item3405');
+INSERT INTO items VALUES (3406, 6, 'item3406');
+INSERT INTO items VALUES (3407, 7, 'item3407');
+INSERT INTO items VALUES (3408, 8, 'item3408');
+INSERT INTO items VALUES (3409, 9, 'item3409');
+INSERT INTO items VALUES (3410, 10, 'item3410');
+INSERT INTO items VALUES (3411, 11, 'item3411');
+INSERT INTO items VALUES (3412, 12, 'item3412');
+INSERT INTO items VALUES (3413, 13, 'item3413');
+INSERT INTO items VALUES (3414, 14, 'item3414');
+INSERT INTO items VALUES (3415, 15, 'item3415');
+INSERT INTO items VALUES (3416, 16, 'item3416');
+INSERT INTO items VALUES (3417, 17, 'item3417');
+INSERT INTO items VALUES (3418, 18, 'item3418');
+INSERT INTO items VALUES (3419, 19, 'item3419');
+INSERT INTO items VALUES (3420, 20, 'item3420');
+INSERT INTO items VALUES (3421, 21, 'item3421');
+INSERT INTO items VALUES (3422, 22, 'item3422');
+INSERT INTO items VALUES (3423, 23, 'item3423');
+INSERT INTO items VALUES (3424, 24, 'item3424');
+INSERT INTO items VALUES (3425, 25, 'item3425');
+INSERT INTO items VALUES (3426, 26, 'item3426');
+INSERT INTO items VALUES (3427, 27, 'item3427');
+INSERT INTO items VALUES (3428, 28, 'item3428');
+INSERT INTO items VALUES (3429, 29, 'item3429');
+INSERT INTO items VALUES (3430, 30, 'item3430');
+INSERT INTO items VALUES (3431, 31, 'item3431');
+INSERT INTO items VALUES (3432, 32, 'item3432');
+INSERT INTO items VALUES (3433, 33, 'item3433');
+INSERT INTO items VALUES (3434, 34, 'item3434');
+INSERT INTO items VALUES (3435, 35, 'item3435');
+INSERT INTO items VALUES (3436, 36, 'item3436');
+INSERT INTO items VALUES (3437, 37, 'item3437');
+INSERT INTO items VALUES (3438, 38, 'item3438');
+INSERT INTO items VALUES (3439, 39, 'item3439');
+INSERT INTO items VALUES (3440, 40, 'item3440');
+INSERT INTO items VALUES (3441, 41, 'item3441');
+INSERT INTO items VALUES (3442, 42, 'item3442');
+INSERT INTO items VALUES (3443, 43, 'item3443');
+INSERT INTO items VALUES (3444, 44, 'item3444');
+INSERT INTO items VALUES (3445, 45, 'item3445');
+INSERT INTO items VALUES (3446, 46, 'item3446');
+INSERT INTO items VALUES (3447, 47, 'item3447');
+INSERT INTO items VALUES (3448, 48, 'item3448');
+INSERT INTO items VALUES (3449, 49, 'item3449');
+INSERT INTO items VALUES (3450, 50, 'item3450');
+INSERT INTO items VALUES (3451, 51, 'item3451');
+INSERT INTO items VALUES (3452, 52, 'item3452');
+INSERT INTO items VALUES (3453, 53, 'item3453');
+INSERT INTO items VALUES (3454, 54, 'item3454');
+INSERT INTO items VALUES (3455, 55, 'item3455');
+INSERT INTO items VALUES (3456, 56, 'item3456');
+INSERT INTO items VALUES (3457, 57, 'item3457');
+INSERT INTO items VALUES (3458, 58, 'item3458');
+INSERT INTO items VALUES (3459, 59, 'item3459');
+INSERT INTO items VALUES (3460, 60, 'item3460');
+INSERT INTO items VALUES (3461, 61, 'item3461');
+INSERT INTO items VALUES (3462, 62, 'item3462');
+INSERT INTO items VALUES (3463, 63, 'item3463');
+INSERT INTO items VALUES (3464, 64, 'item3464');
+INSERT INTO items VALUES (3465, 65, 'item3465');
+INSERT INTO items VALUES (3466, 66, 'item3466');
+INSERT INTO items VALUES (3467, 67, 'item3467');
+INSERT INTO items VALUES (3468, 68, 'item3468');
+INSERT INTO items VALUES (3469, 69, 'item3469');
+INSERT INTO items VALUES (3470, 70, 'item3470');
+INSERT INTO items VALUES (3471, 71, 'item3471');
+INSERT INTO items VALUES (3472, 72, 'item3472');
+INSERT INTO items VALUES (3473, 73, 'item3473');
+INSERT INTO items VALUES (3474, 74, 'item3474');
+INSERT INTO items VALUES (3475, 75, 'item3475');
+INSERT INTO items VALUES (3476, 76, 'item3476');
+INSERT INTO items VALUES (3477, 77, 'item3477');
+INSERT INTO items VALUES (3478, 78, 'item3478');
+INSERT INTO items VALUES (3479, 79, 'item3479');
+INSERT INTO items VALUES (3480, 80, 'item3480');
+INSERT INTO items VALUES (3481, 81, 'item3481');
+INSERT INTO items VALUES (3482, 82, 'item3482');
+INSERT INTO items VALUES (3483, 83, 'item3483');
+INSERT INTO items VALUES (3484, 84, 'item3484');
+INSERT INTO items VALUES (3485, 85, 'item3485');
+INSERT INTO items VALUES (3486, 86, 'item3486');
+INSERT INTO items VALUES (3487, 87, 'item3487');
+INSERT INTO items VALUES (3488, 88, 'item3488');
+INSERT INTO items VALUES (3489, 89, 'item3489');
+INSERT INTO items VALUES (3490, 90, 'item3490');
+INSERT INTO items VALUES (3491, 91, 'item3491');
+INSERT INTO items VALUES (3492, 92, 'item3492');
+INSERT INTO items VALUES (3493, 93, 'item3493');
+INSERT INTO items VALUES (3494, 94, 'item3494');
+INSERT INTO items VALUES (3495, 95, 'item3495');
+INSERT INTO items VALUES (3496, 96, 'item3496');
+INSERT INTO items VALUES (3497, 97, 'item3497');
+INSERT INTO items VALUES (3498, 98, 'item3498');
+INSERT INTO items VALUES (3499, 99, 'item3499');
+INSERT INTO items VALUES (3500, 0, 'item3500');
+INSERT INTO items VALUES (3501, 1, 'item3501');
+INSERT INTO items VALUES (3502, 2, 'item3502');
+INSERT INTO items VALUES (3503, 3, 'item3503');
+INSERT INTO items VALUES (3504, 4, 'item3504');
+INSERT INTO items VALUES (3505, 5, 'item3505');
+INSERT INTO items VALUES (3506, 6, 'item3506');
+INSERT INTO items VALUES (3507, 7, 'item3507');
+INSERT INTO items VALUES (3508, 8, 'item3508');
+INSERT INTO items VALUES (3509, 9, 'item3509');
+INSERT INTO items VALUES (3510, 10, 'item3510');
+INSERT INTO items VALUES (3511, 11, 'item3511');
+INSERT INTO items VALUES (3512, 12, 'item3512');
+INSERT INTO items VALUES (3513, 13, 'item3513');
+INSERT INTO items VALUES (3514, 14, 'item3514');
+INSERT INTO items VALUES (3515, 15, 'item3515');
+INSERT INTO items VALUES (3516, 16, 'item3516');
+INSERT INTO items VALUES (3517, 17, 'item3517');
+INSERT INTO items VALUES (3518, 18, 'item3518');
+INSERT INTO items VALUES (3519, 19, 'item3519');
+INSERT INTO items VALUES (3520, 20, 'item3520');
+INSERT INTO items VALUES (3521, 21, 'item3521');
+INSERT INTO items VALUES (3522, 22, 'item3522');
+INSERT INTO items VALUES (3523, 23, 'item3523');
+INSERT INTO items VALUES (3524, 24, 'item3524');
+INSERT INTO items VALUES (3525, 25, 'item3525');
+INSERT INTO items VALUES (3526, 26, 'item3526');
+INSERT INTO items VALUES (3527, 27, 'item3527');
+INSERT INTO items VALUES (3528, 28, 'item3528');
+INSERT INTO items VALUES (3529, 29, 'item3529');
+INSERT INTO items VALUES (3530, 30, 'item3530');
+INSERT INTO items VALUES (3531, 31, 'item3531');
+INSERT INTO items VALUES (3532, 32, 'item3532');
+INSERT INTO items VALUES (3533, 33, 'item3533');
+INSERT INTO items VALUES (3534, 34, 'item3534');
+INSERT INTO items VALUES (3535, 35, 'item3535');
+INSERT INTO items VALUES (3536, 36, 'item3536');
+INSERT INTO items VALUES (3537, 37, 'item3537');
+INSERT INTO items VALUES (3538, 38, 'item3538');
+INSERT INTO items VALUES (3539, 39, 'item3539');
+INSERT INTO items VALUES (3540, 40, 'item3540');
+INSERT INTO items VALUES (3541, 41, 'item3541');
+INSERT INTO items VALUES (3542, 42, 'item3542');
+INSERT INTO items VALUES (3543, 43, 'item3543');
+INSERT INTO items VALUES (3544, 44, 'item3544');
+INSERT INTO items VALUES (3545, 45, 'item3545');
+INSERT INTO items VALUES (3546, 46, 'item3546');
+INSERT INTO items VALUES (3547, 47, 'item3547');
+INSERT INTO items VALUES (3548, 48, 'item3548');
+INSERT INTO items VALUES (3549, 49, 'item3549');
+INSERT INTO items VALUES (3550, 50, 'item3550');
+INSERT INTO items VALUES (3551, 51, 'item3551');
+INSERT INTO items VALUES (3552, 52, 'item3552');
+INSERT INTO items VALUES (3553, 53, 'item3553');
+INSERT INTO items VALUES (3554, 54, 'item3554');
+INSERT INTO items VALUES (3555, 55, 'item3555');
+INSERT INTO items VALUES (3556, 56, 'item3556');
+INSERT INTO items VALUES (3557, 57, 'item3557');
+INSERT INTO items VALUES (3558, 58, 'item3558');
+INSERT INTO items VALUES (3559, 59, 'item3559');
+INSERT INTO items VALUES (3560, 60, 'item3560');
+INSERT INTO items VALUES (3561, 61, 'item3561');
+INSERT INTO items VALUES (3562, 62, 'item3562');
+INSERT INTO items VALUES (3563, 63, 'item3563');
+INSERT INTO items VALUES (3564, 64, 'item3564');
+INSERT INTO items VALUES (3565, 65, 'item3565');
+INSERT INTO items VALUES (3566, 66, 'item3566');
+INSERT INTO items VALUES (3567, 67, 'item3567');
+INSERT INTO items VALUES (3568, 68, 'item3568');
+INSERT INTO items VALUES (3569, 69, 'item3569');
+INSERT INTO items VALUES (3570, 70, 'item3570');
+INSERT INTO items VALUES (3571, 71, 'item3571');
+INSERT INTO items VALUES (3572, 72, 'item3572');
+INSERT INTO items VALUES (3573, 73, 'item3573');
+INSERT INTO items VALUES (3574, 74, 'item3574');
+INSERT INTO items VALUES (3575, 75, 'item3575');
+INSERT INTO items VALUES (3576, 76, 'item3576');
+INSERT INTO items VALUES (3577, 77, 'item3577');
+INSERT INTO items VALUES (3578, 78, 'item3578');
+INSERT INTO items VALUES (3579, 79, 'item3579');
+INSERT INTO items VALUES (3580, 80, 'item3580');
+INSERT INTO items VALUES (3581, 81, 'item3581');
+INSERT INTO items VALUES (3582, 82, 'item3582');
+INSERT INTO items VALUES (3583, 83, 'item3583');
+INSERT INTO items VALUES (3584, 84, 'item3584');
+INSERT INTO items VALUES (3585, 85, 'item3585');
+INSERT INTO items VALUES (3586, 86, 'item3586');
+INSERT INTO items VALUES (3587, 87, 'item3587');
+INSERT INTO items VALUES (3588, 88, 'item3588');
+INSERT INTO items VALUES (3589, 89, 'item3589');
+INSERT INTO items VALUES (3590, 90, 'item3590');
+INSERT INTO items VALUES (3591, 91, 'item3591');
+INSERT INTO items VALUES (3592, 92, 'item3592');
+INSERT INTO items VALUES (3593, 93, 'item3593');
+INSERT INTO items VALUES (3594, 94, 'item3594');
+INSERT INTO items VALUES (3595, 95, 'item3595');
+INSERT INTO items VALUES (3596, 96, 'item3596');
+INSERT INTO items VALUES (3597, 97, 'item3597');
+INSERT INTO items VALUES (3598, 98, 'item3598');
+INSERT INTO items VALUES (3599, 99, 'item3599');
+INSERT INTO items VALUES (3600, 0, 'item3600');
+INSERT INTO items VALUES (3601, 1, 'item3601');
+INSERT INTO items VALUES (3602, 2, 'item3602');
+INSERT INTO items VALUES (3603, 3, 'item3603');
+INSERT INTO items VALUES (3604, 4, 'item3604');
+INSERT INTO items VALUES (3605, 5, 'item3605');
+INSERT INTO items VALUES (3606, 6, 'item3606');
+INSERT INTO items VALUES (3607, 7, 'item3607');
+INSERT INTO items VALUES (3608, 8, 'item3608');
+INSERT INTO items VALUES (3609, 9, 'item3609');
+INSERT INTO items VALUES (3610, 10, 'item3610');
+INSERT INTO items VALUES (3611, 11, 'item3611');
+INSERT INTO items VALUES (3612, 12, 'item3612');
+INSERT INTO items VALUES (3613, 13, 'item3613');
+INSERT INTO items VALUES (3614, 14, 'item3614');
+INSERT INTO items VALUES (3615, 15, 'item3615');
+INSERT INTO items VALUES (3616, 16, 'item3616');
+INSERT INTO items VALUES (3617, 17, 'item3617');
+INSERT INTO items VALUES (3618, 18, 'item3618');
+INSERT INTO items VALUES (3619, 19, 'item3619');
+INSERT INTO items VALUES (3620, 20, 'item3620');
+INSERT INTO items VALUES (3621, 21, 'item3621');
+INSERT INTO items VALUES (3622, 22, 'item3622');
+INSERT INTO items VALUES (3623, 23, 'item3623');
+INSERT INTO items VALUES (3624, 24, 'item3624');
+INSERT INTO items VALUES (3625, 25, 'item3625');
+INSERT INTO items VALUES (3626, 26, 'item3626');
+INSERT INTO items VALUES (3627, 27, 'item3627');
+INSERT INTO items VALUES (3628, 28, 'item3628');
+INSERT INTO items VALUES (3629, 29, 'item3629');
+INSERT INTO items VALUES (3630, 30, 'item3630');
+INSERT INTO items VALUES (3631, 31, 'item3631');
+INSERT INTO items VALUES (3632, 32, 'item3632');
+INSERT INTO items VALUES (3633, 33, 'item3633');
+INSERT INTO items VALUES (3634, 34, 'item3634');
+INSERT INTO items VALUES (3635, 35, 'item3635');
+INSERT INTO items VALUES (3636, 36, 'item3636');
+INSERT INTO items VALUES (3637, 37, 'item3637');
+INSERT INTO items VALUES (3638, 38, 'item3638');
+INSERT INTO items VALUES (3639, 39, 'item3639');
+INSERT INTO items VALUES (3640, 40, 'item3640');
+INSERT INTO items VALUES (3641, 41, 'item3641');
+INSERT INTO items VALUES (3642, 42, 'item3642');
+INSERT INTO items VALUES (3643, 43, 'item3643');
+INSERT INTO items VALUES (3644, 44, 'item3644');
+INSERT INTO items VALUES (3645, 45, 'item3645');
+INSERT INTO items VALUES (3646, 46, 'item3646');
+INSERT INTO items VALUES (3647, 47, 'item3647');
+INSERT INTO items VALUES (3648, 48, 'item3648');
+INSERT INTO items VALUES (3649, 49, 'item3649');
+INSERT INTO items VALUES (3650, 50, 'item3650');
+INSERT INTO items VALUES (3651, 51, 'item3651');
+INSERT INTO items VALUES (3652, 52, 'item3652');
+INSERT INTO items VALUES (3653, 53, 'item3653');
+INSERT INTO items VALUES (3654, 54, 'item3654');
+INSERT INTO items VALUES (3655, 55, 'item3655');
+INSERT INTO items VALUES (3656, 56, 'item3656');
+INSERT INTO items VALUES (3657, 57, 'item3657');
+INSERT INTO items VALUES (3658, 58, 'item3658');
+INSERT INTO items VALUES (3659, 59, 'item3659');
+INSERT INTO items VALUES (3660, 60, 'item3660');
+INSERT INTO items VALUES (3661, 61, 'item3661');
+INSERT INTO items VALUES (3662, 62, 'item3662');
+INSERT INTO items VALUES (3663, 63, 'item3663');
+INSERT INTO items VALUES (3664, 64, 'item3664');
+INSERT INTO items VALUES (3665, 65, 'item3665');
+INSERT INTO items VALUES (3666, 66, 'item3666');
+INSERT INTO items VALUES (3667, 67, 'item3667');
+INSERT INTO items VALUES (3668, 68, 'item3668');
+INSERT INTO items VALUES (3669, 69, 'item3669');
+INSERT INTO items VALUES (3670, 70, 'item3670');
+INSERT INTO items VALUES (3671, 71, 'item3671');
+INSERT INTO items VALUES (3672, 72, 'item3672');
+INSERT INTO items VALUES (3673, 73, 'item3673');
+INSERT INTO items VALUES (3674, 74, 'item3674');
+INSERT INTO items VALUES (3675, 75, 'item3675');
+INSERT INTO items VALUES (3676, 76, 'item3676');
+INSERT INTO items VALUES (3677, 77, 'item3677');
+INSERT INTO items VALUES (3678, 78, 'item3678');
+INSERT INTO items VALUES (3679, 79, 'item3679');
+INSERT INTO items VALUES (3680, 80, 'item3680');
+INSERT INTO items VALUES (3681, 81, 'item3681');
+INSERT INTO items VALUES (3682, 82, 'item3682');
+INSERT INTO items VALUES (3683, 83, 'item3683');
+INSERT INTO items VALUES (3684, 84, 'item3684');
+INSERT INTO items VALUES (3685, 85, 'item3685');
+INSERT INTO items VALUES (3686, 86, 'item3686');
+INSERT INTO items VALUES (3687, 87, 'item3687');
+INSERT INTO items VALUES (3688, 88, 'item3688');
+INSERT INTO items VALUES (3689, 89, 'item3689');
+INSERT INTO items VALUES (3690, 90, 'item3690');
+INSERT INTO items VALUES (3691, 91, 'item3691');
+INSERT INTO items VALUES (3692, 92, 'item3692');
+INSERT INTO items VALUES (3693, 93, 'item3693');
+INSERT INTO items VALUES (3694, 94, 'item3694');
+INSERT INTO items VALUES (3695, 95, 'item3695');
+INSERT INTO items VALUES (3696, 96, 'item3696');
+INSERT INTO items VALUES (3697, 97, 'item3697');
+INSERT INTO items VALUES (3698, 98, 'item3698');
+INSERT INTO items VALUES (3699, 99, 'item3699');
+INSERT INTO items VALUES (3700, 0, 'item3700');
+INSERT INTO items VALUES (3701, 1, 'item3701');
+INSERT INTO items VALUES (3702, 2, 'item3702');
+INSERT INTO items VALUES (3703, 3, 'item3703');
+INSERT INTO items VALUES (3704, 4, 'item3704');
+INSERT INTO items VALUES (3705, 5, 'item3705');
+INSERT INTO items VALUES (3706, 6, 'item3706');
+INSERT INTO items VALUES (3707, 7, 'item3707');
+INSERT INTO items VALUES (3708, 8, 'item3708');
+INSERT INTO items VALUES (3709, 9, 'item3709');
+INSERT INTO items VALUES (3710, 10, 'item3710');
+INSERT INTO items VALUES (3711, 11, 'item3711');
+INSERT INTO items VALUES (3712, 12, 'item3712');
+INSERT INTO items VALUES (3713, 13, 'item3713');
+INSERT INTO items VALUES (3714, 14, 'item3714');
+INSERT INTO items VALUES (3715, 15, 'item3715');
+INSERT INTO items VALUES (3716, 16, 'item3716');
+INSERT INTO items VALUES (3717, 17, 'item3717');
+INSERT INTO items VALUES (3718, 18, 'item3718');
+INSERT INTO items VALUES (3719, 19, 'item3719');
+INSERT INTO items VALUES (3720, 20, 'item3720');
+INSERT INTO items VALUES (3721, 21, 'item3721');
+INSERT INTO items VALUES (3722, 22, 'item3722');
+INSERT INTO items VALUES (3723, 23, 'item3723');
+INSERT INTO items VALUES (3724, 24, 'item3724');
+INSERT INTO items VALUES (3725, 25, 'item3725');
+INSERT INTO items VALUES (3726, 26, 'item3726');
+INSERT INTO items VALUES (3727, 27, 'item3727');
+INSERT INTO items VALUES (3728, 28, 'item3728');
+INSERT INTO items VALUES (3729, 29, 'item3729');
+INSERT INTO items VALUES (3730, 30, 'item3730');
+INSERT INTO items VALUES (3731, 31, 'item3731');
+INSERT INTO items VALUES (3732, 32, 'item3732');
+INSERT INTO items VALUES (3733, 33, 'item3733');
+INSERT INTO items VALUES (3734, 34, 'item3734');
+INSERT INTO items VALUES (3735, 35, 'item3735');
+INSERT INTO items VALUES (3736, 36, 'item3736');
+INSERT INTO items VALUES (3737, 37, 'item3737');
+INSERT INTO items VALUES (3738, 38, 'item3738');
+INSERT INTO items VALUES (3739, 39, 'item3739');
+INSERT INTO items VALUES (3740, 40, 'item3740');
+INSERT INTO items VALUES (3741, 41, 'item3741');
+INSERT INTO items VALUES (3742, 42, 'item3742');
+INSERT INTO items VALUES (3743, 43, 'item3743');
+INSERT INTO items VALUES (3744, 44, 'item3744');
+INSERT INTO items VALUES (3745, 45, 'item3745');
+INSERT INTO items VALUES (3746, 46, 'item3746');
+INSERT INTO items VALUES (3747, 47, 'item3747');
+INSERT INTO items VALUES (3748, 48, 'item3748');
+INSERT INTO items VALUES (3749, 49, 'item3749');
+INSERT INTO items VALUES (3750, 50, 'item3750');
+INSERT INTO items VALUES (3751, 51, 'item3751');
+INSERT INTO items VALUES (3752, 52, 'item3752');
+INSERT INTO items VALUES (3753, 53, 'item3753');
+INSERT INTO items VALUES (3754, 54, 'item3754');
+INSERT INTO items VALUES (3755, 55, 'item3755');
+INSERT INTO items VALUES (3756, 56, 'item3756');
+INSERT INTO items VALUES (3757, 57, 'item3757');
+INSERT INTO items VALUES (3758, 58, 'item3758');
+INSERT INTO items VALUES (3759, 59, 'item3759');
+INSERT INTO items VALUES (3760, 60, 'item3760');
+INSERT INTO items VALUES (3761, 61, 'item3761');
+INSERT INTO items VALUES (3762, 62, 'item3762');
+INSERT INTO items VALUES (3763, 63, 'item3763');
+INSERT INTO items VALUES (3764, 64, 'item3764');
+INSERT INTO items VALUES (3765, 65, 'item3765');
+INSERT INTO items VALUES (3766, 66, 'item3766');
+INSERT INTO items VALUES (3767, 67, 'item3767');
+INSERT INTO items VALUES (3768, 68, 'item3768');
+INSERT INTO items VALUES (3769, 69, 'item3769');
+INSERT INTO items VALUES (3770, 70, 'item3770');
+INSERT INTO items VALUES (3771, 71, 'item3771');
+INSERT INTO items VALUES (3772, 72, 'item3772');
+INSERT INTO items VALUES (3773, 73, 'item3773');
+INSERT INTO items VALUES (3774, 74, 'item3774');
+INSERT INTO items VALUES (3775, 75, 'item3775');
+INSERT INTO items VALUES (3776, 76, 'item3776');
+INSERT INTO items VALUES (3777, 77, 'item3777');
+INSERT INTO items VALUES (3778, 78, 'item3778');
+INSERT INTO items VALUES (3779, 79, 'item3779');
+INSERT INTO items VALUES (3780, 80, 'item3780');
+INSERT INTO items VALUES (3781, 81, 'item3781');
+INSERT INTO items VALUES (3782, 82, 'item3782');
+INSERT INTO items VALUES (3783, 83, 'item3783');
+INSERT INTO items VALUES (3784, 84, 'item3784');
+INSERT INTO items VALUES (3785, 85, 'item3785');
+INSERT INTO items VALUES (3786, 86, 'item3786');
+INSERT INTO items VALUES (3787, 87, 'item3787');
+INSERT INTO items VALUES (3788, 88, 'item3788');
+INSERT INTO items VALUES (3789, 89, 'item3789');
+INSERT INTO items VALUES (3790, 90, 'item3790');
+INSERT INTO items VALUES (3791, 91, 'item3791');
+INSERT INTO items VALUES (3792, 92, 'item3792');
+INSERT INTO items VALUES (3793, 93, 'item3793');
+INSERT INTO items VALUES (3794, 94, 'item3794');
+INSERT INTO items VALUES (3795, 95, 'item3795');
+INSERT INTO items VALUES (3796, 96, 'item3796');
+INSERT INTO items VALUES (3797, 97, 'item3797');
+INSERT INTO items VALUES (3798, 98, 'item3798');
+INSERT INTO items VALUES (3799, 99, 'item3799');
+INSERT INTO items VALUES (3800, 0, 'item3800');
+INSERT INTO items VALUES (3801, 1, 'item3801');
+INSERT INTO items VALUES (3802, 2, 'item3802');
+INSERT INTO items VALUES (3803, 3, 'item3803');
+INSERT INTO items VALUES (3804, 4, 'item3804');
+INSERT INTO items VALUES (3805, 5, 'item3805');
+INSERT INTO items VALUES (3806, 6, 'item3806');
+INSERT INTO items VALUES (3807, 7, 'item3807');
+INSERT INTO items VALUES (3808, 8, 'item3808');
+INSERT INTO items VALUES (3809, 9, 'item3809');
+INSERT INTO items VALUES (3810, 10, 'item3810');
+INSERT INTO items VALUES (3811, 11, 'item3811');
+INSERT INTO items VALUES (3812, 12, 'item3812');
+INSERT INTO items VALUES (3813, 13, 'item3813');
+INSERT INTO items VALUES (3814, 14, 'item3814');
+INSERT INTO items VALUES (3815, 15, 'item3815');
+INSERT INTO items VALUES (3816, 16, 'item3816');
+INSERT INTO items VALUES (3817, 17, 'item3817');
+INSERT INTO items VALUES (3818, 18, 'item3818');
+INSERT INTO items VALUES (3819, 19, 'item3819');
+INSERT INTO items VALUES (3820, 20, 'item3820');
+INSERT INTO items VALUES (3821, 21, 'item3821');
+INSERT INTO items VALUES (3822, 22, 'item3822');
+INSERT INTO items VALUES (3823, 23, 'item3823');
+INSERT INTO items VALUES (3824, 24, 'item3824');
+INSERT INTO items VALUES (3825, 25, 'item3825');
+INSERT INTO items VALUES (3826, 26, 'item3826');
+INSERT INTO items VALUES (3827, 27, 'item3827');
+INSERT INTO items VALUES (3828, 28, 'item3828');
+INSERT INTO items VALUES (3829, 29, 'item3829');
+INSERT INTO items VALUES (3830, 30, 'item3830');
+INSERT INTO items VALUES (3831, 31, 'item3831');
+INSERT INTO items VALUES (3832, 32, 'item3832');
+INSERT INTO items VALUES (3833, 33, 'item3833');
+INSERT INTO items VALUES (3834, 34, 'item3834');
+INSERT INTO items VALUES (3835, 35, 'item3835');
+INSERT INTO items VALUES (3836, 36, 'item3836');
+INSERT INTO items VALUES (3837, 37, 'item3837');
+INSERT INTO items VALUES (3838, 38, 'item3838');
+INSERT INTO items VALUES (3839, 39, 'item3839');
+INSERT INTO items VALUES (3840, 40, 'item3840');
+INSERT INTO items VALUES (3841, 41, 'item3841');
+INSERT INTO items VALUES (3842, 42, 'item3842');
+INSERT INTO items VALUES (3843, 43, 'item3843');
+INSERT INTO items VALUES (3844, 44, 'item3844');
+INSERT INTO items VALUES (3845, 45, 'item3845');
+INSERT INTO items VALUES (3846, 46, 'item3846');
+INSERT INTO items VALUES (3847, 47, 'item3847');
+INSERT INTO items VALUES (3848, 48, 'item3848');
+INSERT INTO items VALUES (3849, 49, 'item3849');
+INSERT INTO items VALUES (3850, 50, 'item3850');
+INSERT INTO items VALUES (3851, 51, 'item3851');
+INSERT INTO items VALUES (3852, 52, 'item3852');
+INSERT INTO items VALUES (3853, 53, 'item3853');
+INSERT INTO items VALUES (3854, 54, 'item3854');
+INSERT INTO items VALUES (3855, 55, 'item3855');
+INSERT INTO items VALUES (3856, 56, 'item3856');
+INSERT INTO items VALUES (3857, 57, 'item3857');
+INSERT INTO items VALUES (3858, 58, 'item3858');
+INSERT INTO items VALUES (3859, 59, 'item3859');
+INSERT INTO items VALUES (3860, 60, 'item3860');
+INSERT INTO items VALUES (3861, 61, 'item3861');
+INSERT INTO items VALUES (3862, 62, 'item3862');
+INSERT INTO items VALUES (3863, 63, 'item3863');
+INSERT INTO items VALUES (3864, 64, 'item3864');
+INSERT INTO items VALUES (3865, 65, 'item3865');
+INSERT INTO items VALUES (3866, 66, 'item3866');
+INSERT INTO items VALUES (3867, 67, 'item3867');
+INSERT INTO items VALUES (3868, 68, 'item3868');
+INSERT INTO items VALUES (3869, 69, 'item3869');
+INSERT INTO items VALUES (3870, 70, 'item3870');
+INSERT INTO items VALUES (3871, 71, 'item3871');
+INSERT INTO items VALUES (3872, 72, 'item3872');
+INSERT INTO items VALUES (3873, 73, 'item3873');
+INSERT INTO items VALUES (3874, 74, 'item3874');
+INSERT INTO items VALUES (3875, 75, 'item3875');
+INSERT INTO items VALUES (3876, 76, 'item3876');
+INSERT INTO items VALUES (3877, 77, 'item3877');
+INSERT INTO items VALUES (3878, 78, 'item3878');
+INSERT INTO items VALUES (3879, 79, 'item3879');
+INSERT INTO items VALUES (3880, 80, 'item3880');
+INSERT INTO items VALUES (3881, 81, 'item3881');
+INSERT INTO items VALUES (3882, 82, 'item3882');
+INSERT INTO items VALUES (3883, 83, 'item3883');
+INSERT INTO items VALUES (3884, 84, 'item3884');
+INSERT INTO items VALUES (3885, 85, 'item3885');
+INSERT INTO items VALUES (3886, 86, 'item3886');
+INSERT INTO items VALUES (3887, 87, 'item3887');
+INSERT INTO items VALUES (3888, 88, 'item3888');
+INSERT INTO items VALUES (3889, 89, 'item3889');
+INSERT INTO items VALUES (3890, 90, 'item3890');
+INSERT INTO items VALUES (3891, 91, 'item3891');
+INSERT INTO items VALUES (3892, 92, 'item3892');
+INSERT INTO items VALUES (3893, 93, 'item3893');
+INSERT INTO items VALUES (3894, 94, 'item3894');
+INSERT INTO items VALUES (3895, 95, 'item3895');
+INSERT INTO items VALUES (3896, 96, 'item3896');
+INSERT INTO items VALUES (3897, 97, 'item3897');
+INSERT INTO items VALUES (3898, 98, 'item3898');
+INSERT INTO items VALUES (3899, 99, 'item3899');
+INSERT INTO items VALUES (3900, 0, 'item3900');
+INSERT INTO items VALUES (3901, 1, 'item3901');
+INSERT INTO items VALUES (3902, 2, 'item3902');
+INSERT INTO items VALUES (3903, 3, 'item3903');
+INSERT INTO items VALUES (3904, 4, 'item3904');
+INSERT INTO items VALUES (3905, 5, 'item3905');
+INSERT INTO items VALUES (3906, 6, 'item3906');
+INSERT INTO items VALUES (3907, 7, 'item3907');
+INSERT INTO items VALUES (3908, 8, 'item3908');
+INSERT INTO items VALUES (3909, 9, 'item3909');
+INSERT INTO items VALUES (3910, 10, 'item3910');
+INSERT INTO items VALUES (3911, 11, 'item3911');
+INSERT INTO items VALUES (3912, 12, 'item3912');
+INSERT INTO items VALUES (3913, 13, 'item3913');
+INSERT INTO items VALUES (3914, 14, 'item3914');
+INSERT INTO items VALUES (3915, 15, 'item3915');
+INSERT INTO items VALUES (3916, 16, 'item3916');
+INSERT INTO items VALUES (3917, 17, 'item3917');
+INSERT INTO items VALUES (3918, 18, 'item3918');
+INSERT INTO items VALUES (3919, 19, 'item3919');
+INSERT INTO items VALUES (3920, 20, 'item3920');
+INSERT INTO items VALUES (3921, 21, 'item3921');
+INSERT INTO items VALUES (3922, 22, 'item3922');
+INSERT INTO items VALUES (3923, 23, 'item3923');
+INSERT INTO items VALUES (3924, 24, 'item3924');
+INSERT INTO items VALUES (3925, 25, 'item3925');
+INSERT INTO items VALUES (3926, 26, 'item3926');
+INSERT INTO items VALUES (3927, 27, 'item3927');
+INSERT INTO items VALUES (3928, 28, 'item3928');
+INSERT INTO items VALUES (3929, 29, 'item3929');
+INSERT INTO items VALUES (3930, 30, 'item3930');
+INSERT INTO items VALUES (3931, 31, 'item3931');
+INSERT INTO items VALUES (3932, 32, 'item3932');
+INSERT INTO items VALUES (3933, 33, 'item3933');
+INSERT INTO items VALUES (3934, 34, 'item3934');
+INSERT INTO items VALUES (3935, 35, 'item3935');
+INSERT INTO items VALUES (3936, 36, 'item3936');
+INSERT INTO items VALUES (3937, 37, 'item3937');
+INSERT INTO items VALUES (3938, 38, 'item3938');
+INSERT INTO items VALUES (3939, 39, 'item3939');
+INSERT INTO items VALUES (3940, 40, 'item3940');
+INSERT INTO items VALUES (3941, 41, 'item3941');
+INSERT INTO items VALUES (3942, 42, 'item3942');
+INSERT INTO items VALUES (3943, 43, 'item3943');
+INSERT INTO items VALUES (3944, 44, 'item3944');
+INSERT INTO items VALUES (3945, 45, 'item3945');
+INSERT INTO items VALUES (3946, 46, 'item3946');
+INSERT INTO items VALUES (3947, 47, 'item3947');
+INSERT INTO items VALUES (3948, 48, 'item3948');
+INSERT INTO items VALUES (3949, 49, 'item3949');
+INSERT INTO items VALUES (3950, 50, 'item3950');
+INSERT INTO items VALUES (3951, 51, 'item3951');
+INSERT INTO items VALUES (3952, 52, 'item3952');
+INSERT INTO items VALUES (3953, 53, 'item3953');
+INSERT INTO items VALUES (3954, 54, 'item3954');
+INSERT INTO items VALUES (3955, 55, 'item3955');
+INSERT INTO items VALUES (3956, 56, 'item3956');
+INSERT INTO items VALUES (3957, 57, 'item3957');
+INSERT INTO items VALUES (3958, 58, 'item3958');
+INSERT INTO items VALUES (3959, 59, 'item3959');
+INSERT INTO items VALUES (3960, 60, 'item3960');
+INSERT INTO items VALUES (3961, 61, 'item3961');
+INSERT INTO items VALUES (3962, 62, 'item3962');
+INSERT INTO items VALUES (3963, 63, 'item3963');
+INSERT INTO items VALUES (3964, 64, 'item3964');
+INSERT INTO items VALUES (3965, 65, 'item3965');
+INSERT INTO items VALUES (3966, 66, 'item3966');
+INSERT INTO items VALUES (3967, 67, 'item3967');
+INSERT INTO items VALUES (3968, 68, 'item3968');
+INSERT INTO items VALUES (3969, 69, 'item3969');
+INSERT INTO items VALUES (3970, 70, 'item3970');
+INSERT INTO items VALUES (3971, 71, 'item3971');
+INSERT INTO items VALUES (3972, 72, 'item3972');
+INSERT INTO items VALUES (3973, 73, 'item3973');
+INSERT INTO items VALUES (3974, 74, 'item3974');
+INSERT INTO items VALUES (3975, 75, 'item3975');
+INSERT INTO items VALUES (3976, 76, 'item3976');
+INSERT INTO items VALUES (3977, 77, 'item3977');
+INSERT INTO items VALUES (3978, 78, 'item3978');
+INSERT INTO items VALUES (3979, 79, 'item3979');
+INSERT INTO items VALUES (3980, 80, 'item3980');
+INSERT INTO items VALUES (3981, 81, 'item3981');
+INSERT INTO items VALUES (3982, 82, 'item3982');
+INSERT INTO items VALUES (3983, 83, 'item3983');
+INSERT INTO items VALUES (3984, 84, 'item3984');
+INSERT INTO items VALUES (3985, 85, 'item3985');
+INSERT INTO items VALUES (3986, 86, 'item3986');
+INSERT INTO items VALUES (3987, 87, 'item3987');
+INSERT INTO items VALUES (3988, 88, 'item3988');
+INSERT INTO items VALUES (3989, 89, 'item3989');
+INSERT INTO items VALUES (3990, 90, 'item3990');
+INSERT INTO items VALUES (3991, 91, 'item3991');
+INSERT INTO items VALUES (3992, 92, 'item3992');
+INSERT INTO items VALUES (3993, 93, 'item3993');
+INSERT INTO items VALUES (3994, 94, 'item3994');
+INSERT INTO items VALUES (3995, 95, 'item3995');
+INSERT INTO items VALUES (3996, 96, 'item3996');
+INSERT INTO items VALUES (3997, 97, 'item3997');
+INSERT INTO items VALUES (3998, 98, 'item3998');
+INSERT INTO items VALUES (3999, 99, 'item3999');
+INSERT INTO items VALUES (4000, 0, 'item4000');
+INSERT INTO items VALUES (4001, 1, 'item4001');
+INSERT INTO items VALUES (4002, 2, 'item4002');
+INSERT INTO items VALUES (4003, 3, 'item4003');
+INSERT INTO items VALUES (4004, 4, 'item4004');
+INSERT INTO items VALUES (4005, 5, 'item4005');
+INSERT INTO items VALUES (4006, 6, 'item4006');
+INSERT INTO items VALUES (4007, 7, 'item4007');
+INSERT INTO items VALUES (4008, 8, 'item4008');
+INSERT INTO items VALUES (4009, 9, 'item4009');
+INSERT INTO items VALUES (4010, 10, 'item4010');
+INSERT INTO items VALUES (4011, 11, 'item4011');
+INSERT INTO items VALUES (4012, 12, 'item4012');
+INSERT INTO items VALUES (4013, 13, 'item4013');
+INSERT INTO items VALUES (4014, 14, 'item4014');
+INSERT INTO items VALUES (4015, 15, 'item4015');
+INSERT INTO items VALUES (4016, 16, 'item4016');
+INSERT INTO items VALUES (4017, 17, 'item4017');
+INSERT INTO items VALUES (4018, 18, 'item4018');
+INSERT INTO items VALUES (4019, 19, 'item4019');
+INSERT INTO items VALUES (4020, 20, 'item4020');
+INSERT INTO items VALUES (4021, 21, 'item4021');
+INSERT INTO items VALUES (4022, 22, 'item4022');
+INSERT INTO items VALUES (4023, 23, 'item4023');
+INSERT INTO items VALUES (4024, 24, 'item4024');
+INSERT INTO items VALUES (4025, 25, 'item4025');
+INSERT INTO items VALUES (4026, 26, 'item4026');
+INSERT INTO items VALUES (4027, 27, 'item4027');
+INSERT INTO items VALUES (4028, 28, 'item4028');
+INSERT INTO items VALUES (4029, 29, 'item4029');
+INSERT INTO items VALUES (4030, 30, 'item4030');
+INSERT INTO items VALUES (4031, 31, 'item4031');
+INSERT INTO items VALUES (4032, 32, 'item4032');
+INSERT INTO items VALUES (4033, 33, 'item4033');
+INSERT INTO items VALUES (4034, 34, 'item4034');
+INSERT INTO items VALUES (4035, 35, 'item4035');
+INSERT INTO items VALUES (4036, 36, 'item4036');
+INSERT INTO items VALUES (4037, 37, 'item4037');
+INSERT INTO items VALUES (4038, 38, 'item4038');
+INSERT INTO items VALUES (4039, 39, 'item4039');
+INSERT INTO items VALUES (4040, 40, 'item4040');
+INSERT INTO items VALUES (4041, 41, 'item4041');
+INSERT INTO items VALUES (4042, 42, 'item4042');
+INSERT INTO items VALUES (4043, 43, 'item4043');
+INSERT INTO items VALUES (4044, 44, 'item4044');
+INSERT INTO items VALUES (4045, 45, 'item4045');
+INSERT INTO items VALUES (4046, 46, 'item4046');
+INSERT INTO items VALUES (4047, 47, 'item4047');
+INSERT INTO items VALUES (4048, 48, 'item4048');
+INSERT INTO items VALUES (4049, 49, 'item4049');
+INSERT INTO items VALUES (4050, 50, 'item4050');
+INSERT INTO items VALUES (4051, 51, 'item4051');
+INSERT INTO items VALUES (4052, 52, 'item4052');
+INSERT INTO items VALUES (4053, 53, 'item4053');
+INSERT INTO items VALUES (4054, 54, 'item4054');
+INSERT INTO items VALUES (4055, 55, 'item4055');
+INSERT INTO items VALUES (4056, 56, 'item4056');
+INSERT INTO items VALUES (4057, 57, 'item4057');
+INSERT INTO items VALUES (4058, 58, 'item4058');
+INSERT INTO items VALUES (4059, 59, 'item4059');
+INSERT INTO items VALUES (4060, 60, 'item4060');
+INSERT INTO items VALUES (4061, 61, 'item4061');
+INSERT INTO items VALUES (4062, 62, 'item4062');
+INSERT INTO items VALUES (4063, 63, 'item4063');
+INSERT INTO items VALUES (4064, 64, 'item4064');
+INSERT INTO items VALUES (4065, 65, 'item4065');
+INSERT INTO items VALUES (4066, 66, 'item4066');
+INSERT INTO items VALUES (4067, 67, 'item4067');
+INSERT INTO items VALUES (4068, 68, 'item4068');
+INSERT INTO items VALUES (4069, 69, 'item4069');
+INSERT INTO items VALUES (4070, 70, 'item4070');
+INSERT INTO items VALUES (4071, 71, 'item4071');
+INSERT INTO items VALUES (4072, 72, 'item4072');
+INSERT INTO items VALUES (4073, 73, 'item4073');
+INSERT INTO items VALUES (4074, 74, 'item4074');
+INSERT INTO items VALUES (4075, 75, 'item4075');
+INSERT INTO items VALUES (4076, 76, 'item4076');
+INSERT INTO items VALUES (4077, 77, 'item4077');
+INSERT INTO items VALUES (4078, 78, 'item4078');
+INSERT INTO items VALUES (4079, 79, 'item4079');
+INSERT INTO items VALUES (4080, 80, 'item4080');
+INSERT INTO items VALUES (4081, 81, 'item4081');
+INSERT INTO items VALUES (4082, 82, 'item4082');
+INSERT INTO items VALUES (4083, 83, 'item4083');
+INSERT INTO items VALUES (4084, 84, 'item4084');
+INSERT INTO items VALUES (4085, 85, 'item4085');
+INSERT INTO items VALUES (4086, 86, 'item4086');
+INSERT INTO items VALUES (4087, 87, 'item4087');
+INSERT INTO items VALUES (4088, 88, 'item4088');
+INSERT INTO items VALUES (4089, 89, 'item4089');
+INSERT INTO items VALUES (4090, 90, 'item4090');
+INSERT INTO items VALUES (4091, 91, 'item4091');
+INSERT INTO items VALUES (4092, 92, 'item4092');
+INSERT INTO items VALUES (4093, 93, 'item4093');
+INSERT INTO items VALUES (4094, 94, 'item4094');
+INSERT INTO items VALUES (4095, 95, 'item4095');
+INSERT INTO items VALUES (4096, 96, 'item4096');
+INSERT INTO items VALUES (4097, 97, 'item4097');
+INSERT INTO items VALUES (4098, 98, 'item4098');
+INSERT INTO items VALUES (4099, 99, 'item4099');
+INSERT INTO items VALUES (4100, 0, 'item4100');
+INSERT INTO items VALUES (4101, 1, 'item4101');
+INSERT INTO items VALUES (4102, 2, 'item4102');
+INSERT INTO items VALUES (4103, 3, 'item4103');
+INSERT INTO items VALUES (4104, 4, 'item4104');
+INSERT INTO items VALUES (4105, 5, 'item4105');
+INSERT INTO items VALUES (4106, 6, 'item4106');
+INSERT INTO items VALUES (4107, 7, 'item4107');
+INSERT INTO items VALUES (4108, 8, 'item4108');
+INSERT INTO items VALUES (4109, 9, 'item4109');
+INSERT INTO items VALUES (4110, 10, 'item4110');
+INSERT INTO items VALUES (4111, 11, 'item4111');
+INSERT INTO items VALUES (4112, 12, 'item4112');
+INSERT INTO items VALUES (4113, 13, 'item4113');
+INSERT INTO items VALUES (4114, 14, 'item4114');
+INSERT INTO items VALUES (4115, 15, 'item4115');
+INSERT INTO items VALUES (4116, 16, 'item4116');
+INSERT INTO items VALUES (4117, 17, 'item4117');
+INSERT INTO items VALUES (4118, 18, 'item4118');
+INSERT INTO items VALUES (4119, 19, 'item4119');
+INSERT INTO items VALUES (4120, 20, 'item4120');
+INSERT INTO items VALUES (4121, 21, 'item4121');
+INSERT INTO items VALUES (4122, 22, 'item4122');
+INSERT INTO items VALUES (4123, 23, 'item4123');
+INSERT INTO items VALUES (4124, 24, 'item4124');
+INSERT INTO items VALUES (4125, 25, 'item4125');
+INSERT INTO items VALUES (4126, 26, 'item4126');
+INSERT INTO items VALUES (4127, 27, 'item4127');
+INSERT INTO items VALUES (4128, 28, 'item4128');
+INSERT INTO items VALUES (4129, 29, 'item4129');
+INSERT INTO items VALUES (4130, 30, 'item4130');
+INSERT INTO items VALUES (4131, 31, 'item4131');
+INSERT INTO items VALUES (4132, 32, 'item4132');
+INSERT INTO items VALUES (4133, 33, 'item4133');
+INSERT INTO items VALUES (4134, 34, 'item4134');
+INSERT INTO items VALUES (4135, 35, 'item4135');
+INSERT INTO items VALUES (4136, 36, 'item4136');
+INSERT INTO items VALUES (4137, 37, 'item4137');
+INSERT INTO items VALUES (4138, 38, 'item4138');
+INSERT INTO items VALUES (4139, 39, 'item4139');
+INSERT INTO items VALUES (4140, 40, 'item4140');
+INSERT INTO items VALUES (4141, 41, 'item4141');
+INSERT INTO items VALUES (4142, 42, 'item4142');
+INSERT INTO items VALUES (4143, 43, 'item4143');
+INSERT INTO items VALUES (4144, 44, 'item4144');
+INSERT INTO items VALUES (4145, 45, 'item4145');
+INSERT INTO items VALUES (4146, 46, 'item4146');
+INSERT INTO items VALUES (4147, 47, 'item4147');
+INSERT INTO items VALUES (4148, 48, 'item4148');
+INSERT INTO items VALUES (4149, 49, 'item4149');
+INSERT INTO items VALUES (4150, 50, 'item4150');
+INSERT INTO items VALUES (4151, 51, 'item4151');
+INSERT INTO items VALUES (4152, 52, 'item4152');
+INSERT INTO items VALUES (4153, 53, 'item4153');
+INSERT INTO items VALUES (4154, 54, 'item4154');
+INSERT INTO items VALUES (4155, 55, 'item4155');
+INSERT INTO items VALUES (4156, 56, 'item4156');
+INSERT INTO items VALUES (4157, 57, 'item4157');
+INSERT INTO items VALUES (4158, 58, 'item4158');
+INSERT INTO items VALUES (4159, 59, 'item4159');
+INSERT INTO items VALUES (4160, 60, 'item4160');
+INSERT INTO items VALUES (4161, 61, 'item4161');
+INSERT INTO items VALUES (4162, 62, 'item4162');
+INSERT INTO items VALUES (4163, 63, 'item4163');
+INSERT INTO items VALUES (4164, 64, 'item4164');
+INSERT INTO items VALUES (4165, 65, 'item4165');
+INSERT INTO items VALUES (4166, 66, 'item4166');
+INSERT INTO items VALUES (4167, 67, 'item4167');
+INSERT INTO items VALUES (4168, 68, 'item4168');
+INSERT INTO items VALUES (4169, 69, 'item4169');
+INSERT INTO items VALUES (4170, 70, 'item4170');
+INSERT INTO items VALUES (4171, 71, 'item4171');
+INSERT INTO items VALUES (4172, 72, 'item4172');
+INSERT INTO items VALUES (4173, 73, 'item4173');
+INSERT INTO items VALUES (4174, 74, 'item4174');
+INSERT INTO items VALUES (4175, 75, 'item4175');
+INSERT INTO items VALUES (4176, 76, 'item4176');
+INSERT INTO items VALUES (4177, 77, 'item4177');
+INSERT INTO items VALUES (4178, 78, 'item4178');
+INSERT INTO items VALUES (4179, 79, 'item4179');
+INSERT INTO items VALUES (4180, 80, 'item4180');
+INSERT INTO items VALUES (4181, 81, 'item4181');
+INSERT INTO items VALUES (4182, 82, 'item4182');
+INSERT INTO items VALUES (4183, 83, 'item4183');
+INSERT INTO items VALUES (4184, 84, 'item4184');
+INSERT INTO items VALUES (4185, 85, 'item4185');
+INSERT INTO items VALUES (4186, 86, 'item4186');
+INSERT INTO items VALUES (4187, 87, 'item4187');
+INSERT INTO items VALUES (4188, 88, 'item4188');
+INSERT INTO items VALUES (4189, 89, 'item4189');
+INSERT INTO items VALUES (4190, 90, 'item4190');
+INSERT INTO items VALUES (4191, 91, 'item4191');
+INSERT INTO items VALUES (4192, 92, 'item4192');
+INSERT INTO items VALUES (4193, 93, 'item4193');
+INSERT INTO items VALUES (4194, 94, 'item4194');
+INSERT INTO items VALUES (4195, 95, 'item4195');
+INSERT INTO items VALUES (4196, 96, 'item4196');
+INSERT INTO items VALUES (4197, 97, 'item4197');
+INSERT INTO items VALUES (4198, 98, 'item4198');
+INSERT INTO items VALUES (4199, 99, 'item4199');
+INSERT INTO items VALUES (4200, 0, 'item4200');
+INSERT INTO items VALUES (4201, 1, 'item4201');
+INSERT INTO items VALUES (4202, 2, 'item4202');
+INSERT INTO items VALUES (4203, 3, 'item4203');
+INSERT INTO items VALUES (4204, 4, 'item4204');
+INSERT INTO items VALUES (4205, 5, 'item4205');
+INSERT INTO items VALUES (4206, 6, 'item4206');
+INSERT INTO items VALUES (4207, 7, 'item4207');
+INSERT INTO items VALUES (4208, 8, 'item4208');
+INSERT INTO items VALUES (4209, 9, 'item4209');
+INSERT INTO items VALUES (4210, 10, 'item4210');
+INSERT INTO items VALUES (4211, 11, 'item4211');
+INSERT INTO items VALUES (4212, 12, 'item4212');
+INSERT INTO items VALUES (4213, 13, 'item4213');
+INSERT INTO items VALUES (4214, 14, 'item4214');
+INSERT INTO items VALUES (4215, 15, 'item4215');
+INSERT INTO items VALUES (4216, 16, 'item4216');
+INSERT INTO items VALUES (4217, 17, 'item4217');
+INSERT INTO items VALUES (4218, 18, 'item4218');
+INSERT INTO items VALUES (4219, 19, 'item4219');
+INSERT INTO items VALUES (4220, 20, 'item4220');
+INSERT INTO items VALUES (4221, 21, 'item4221');
+INSERT INTO items VALUES (4222, 22, 'item4222');
+INSERT INTO items VALUES (4223, 23, 'item4223');
+INSERT INTO items VALUES (4224, 24, 'item4224');
+INSERT INTO items VALUES (4225, 25, 'item4225');
+INSERT INTO items VALUES (4226, 26, 'item4226');
+INSERT INTO items VALUES (4227, 27, 'item4227');
+INSERT INTO items VALUES (4228, 28, 'item4228');
+INSERT INTO items VALUES (4229, 29, 'item4229');
+INSERT INTO items VALUES (4230, 30, 'item4230');
+INSERT INTO items VALUES (4231, 31, 'item4231');
+INSERT INTO items VALUES (4232, 32, 'item4232');
+INSERT INTO items VALUES (4233, 33, 'item4233');
+INSERT INTO items VALUES (4234, 34, 'item4234');
+INSERT INTO items VALUES (4235, 35, 'item4235');
+INSERT INTO items VALUES (4236, 36, 'item4236');
+INSERT INTO items VALUES (4237, 37, 'item4237');
+INSERT INTO items VALUES (4238, 38, 'item4238');
+INSERT INTO items VALUES (4239, 39, 'item4239');
+INSERT INTO items VALUES (4240, 40, 'item4240');
+INSERT INTO items VALUES (4241, 41, 'item4241');
+INSERT INTO items VALUES (4242, 42, 'item4242');
+INSERT INTO items VALUES (4243, 43, 'item4243');
+INSERT INTO items VALUES (4244, 44, 'item4244');
+INSERT INTO items VALUES (4245, 45, 'item4245');
+INSERT INTO items VALUES (4246, 46, 'item4246');
+INSERT INTO items VALUES (4247, 47, 'item4247');
+INSERT INTO items VALUES (4248, 48, 'item4248');
+INSERT INTO items VALUES (4249, 49, 'item4249');
+INSERT INTO items VALUES (4250, 50, 'item4250');
+INSERT INTO items VALUES (4251, 51, 'item4251');
+INSERT INTO items VALUES (4252, 52, 'item4252');
+INSERT INTO items VALUES (4253, 53, 'item4253');
+INSERT INTO items VALUES (4254, 54, 'item4254');
+INSERT INTO items VALUES (4255, 55, 'item4255');
+INSERT INTO items VALUES (4256, 56, 'item4256');
+INSERT INTO items VALUES (4257, 57, 'item4257');
+INSERT INTO items VALUES (4258, 58, 'item4258');
+INSERT INTO items VALUES (4259, 59, 'item4259');
+INSERT INTO items VALUES (4260, 60, 'item4260');
+INSERT INTO items VALUES (4261, 61, 'item4261');
+INSERT INTO items VALUES (4262, 62, 'item4262');
+INSERT INTO items VALUES (4263, 63, 'item4263');
+INSERT INTO items VALUES (4264, 64, 'item4264');
+INSERT INTO items VALUES (4265, 65, 'item4265');
+INSERT INTO items VALUES (4266, 66, 'item4266');
+INSERT INTO items VALUES (4267, 67, 'item4267');
+INSERT INTO items VALUES (4268, 68, 'item4268');
+INSERT INTO items VALUES (4269, 69, 'item4269');
+INSERT INTO items VALUES (4270, 70, 'item4270');
+INSERT INTO items VALUES (4271, 71, 'item4271');
+INSERT INTO items VALUES (4272, 72, 'item4272');
+INSERT INTO items VALUES (4273, 73, 'item4273');
+INSERT INTO items VALUES (4274, 74, 'item4274');
+INSERT INTO items VALUES (4275, 75, 'item4275');
+INSERT INTO items VALUES (4276, 76, 'item4276');
+INSERT INTO items VALUES (4277, 77, 'item4277');
+INSERT INTO items VALUES (4278, 78, 'item4278');
+INSERT INTO items VALUES (4279, 79, 'item4279');
+INSERT INTO items VALUES (4280, 80, 'item4280');
+INSERT INTO items VALUES (4281, 81, 'item4281');
+INSERT INTO items VALUES (4282, 82, 'item4282');
+INSERT INTO items VALUES (4283, 83, 'item4283');
+INSERT INTO items VALUES (4284, 84, 'item4284');
+INSERT INTO items VALUES (4285, 85, 'item4285');
+INSERT INTO items VALUES (4286, 86, 'item4286');
+INSERT INTO items VALUES (4287, 87, 'item4287');
+INSERT INTO items VALUES (4288, 88, 'item4288');
+INSERT INTO items VALUES (4289, 89, 'item4289');
+INSERT INTO items VALUES (4290, 90, 'item4290');
+INSERT INTO items VALUES (4291, 91, 'item4291');
+INSERT INTO items VALUES (4292, 92, 'item4292');
+INSERT INTO items VALUES (4293, 93, 'item4293');
+INSERT INTO items VALUES (4294, 94, 'item4294');
+INSERT INTO items VALUES (4295, 95, 'item4295');
+INSERT INTO items VALUES (4296, 96, 'item4296');
+INSERT INTO items VALUES (4297, 97, 'item4297');
+INSERT INTO items VALUES (4298, 98, 'item4298');
+INSERT INTO items VALUES (4299, 99, 'item4299');
+INSERT INTO items VALUES (4300, 0, 'item4300');
+INSERT INTO items VALUES (4301, 1, 'item4301');
+INSERT INTO items VALUES (4302, 2, 'item4302');
+INSERT INTO items VALUES (4303, 3, 'item4303');
+INSERT INTO items VALUES (4304, 4, 'item4304');
+INSERT INTO items VALUES (4305, 5, 'item4305');
+INSERT INTO items VALUES (4306, 6, 'item4306');
+INSERT INTO items VALUES (4307, 7, 'item4307');
+INSERT INTO items VALUES (4308, 8, 'item4308');
+INSERT INTO items VALUES (4309, 9, 'item4309');
+INSERT INTO items VALUES (4310, 10, 'item4310');
+INSERT INTO items VALUES (4311, 11, 'item4311');
+INSERT INTO items VALUES (4312, 12, 'item4312');
+INSERT INTO items VALUES (4313, 13, 'item4313');
+INSERT INTO items VALUES (4314, 14, 'item4314');
+INSERT INTO items VALUES (4315, 15, 'item4315');
+INSERT INTO items VALUES (4316, 16, 'item4316');
+INSERT INTO items VALUES (4317, 17, 'item4317');
+INSERT INTO items VALUES (4318, 18, 'item4318');
+INSERT INTO items VALUES (4319, 19, 'item4319');
+INSERT INTO items VALUES (4320, 20, 'item4320');
+INSERT INTO items VALUES (4321, 21, 'item4321');
+INSERT INTO items VALUES (4322, 22, 'item4322');
+INSERT INTO items VALUES (4323, 23, 'item4323');
+INSERT INTO items VALUES (4324, 24, 'item4324');
+INSERT INTO items VALUES (4325, 25, 'item4325');
+INSERT INTO items VALUES (4326, 26, 'item4326');
+INSERT INTO items VALUES (4327, 27, 'item4327');
+INSERT INTO items VALUES (4328, 28, 'item4328');
+INSERT INTO items VALUES (4329, 29, 'item4329');
+INSERT INTO items VALUES (4330, 30, 'item4330');
+INSERT INTO items VALUES (4331, 31, 'item4331');
+INSERT INTO items VALUES (4332, 32, 'item4332');
+INSERT INTO items VALUES (4333, 33, 'item4333');
+INSERT INTO items VALUES (4334, 34, 'item4334');
+INSERT INTO items VALUES (4335, 35, 'item4335');
+INSERT INTO items VALUES (4336, 36, 'item4336');
+INSERT INTO items VALUES (4337, 37, 'item4337');
+INSERT INTO items VALUES (4338, 38, 'item4338');
+INSERT INTO items VALUES (4339, 39, 'item4339');
+INSERT INTO items VALUES (4340, 40, 'item4340');
+INSERT INTO items VALUES (4341, 41, 'item4341');
+INSERT INTO items VALUES (4342, 42, 'item4342');
+INSERT INTO items VALUES (4343, 43, 'item4343');
+INSERT INTO items VALUES (4344, 44, 'item4344');
+INSERT INTO items VALUES (4345, 45, 'item4345');
+INSERT INTO items VALUES (4346, 46, 'item4346');
+INSERT INTO items VALUES (4347, 47, 'item4347');
+INSERT INTO items VALUES (4348, 48, 'item4348');
+INSERT INTO items VALUES (4349, 49, 'item4349');
+INSERT INTO items VALUES (4350, 50, 'item4350');
+INSERT INTO items VALUES (4351, 51, 'item4351');
+INSERT INTO items VALUES (4352, 52, 'item4352');
+INSERT INTO items VALUES (4353, 53, 'item4353');
+INSERT INTO items VALUES (4354, 54, 'item4354');
+INSERT INTO items VALUES (4355, 55, 'item4355');
+INSERT INTO items VALUES (4356, 56, 'item4356');
+INSERT INTO items VALUES (4357, 57, 'item4357');
+INSERT INTO items VALUES (4358, 58, 'item4358');
+INSERT INTO items VALUES (4359, 59, 'item4359');
+INSERT INTO items VALUES (4360, 60, 'item4360');
+INSERT INTO items VALUES (4361, 61, 'item4361');
+INSERT INTO items VALUES (4362, 62, 'item4362');
+INSERT INTO items VALUES (4363, 63, 'item4363');
+INSERT INTO items VALUES (4364, 64, 'item4364');
+INSERT INTO items VALUES (4365, 65, 'item4365');
+INSERT INTO items VALUES (4366, 66, 'item4366');
+INSERT INTO items VALUES (4367, 67, 'item4367');
+INSERT INTO items VALUES (4368, 68, 'item4368');
+INSERT INTO items VALUES (4369, 69, 'item4369');
+INSERT INTO items VALUES (4370, 70, 'item4370');
+INSERT INTO items VALUES (4371, 71, 'item4371');
+INSERT INTO items VALUES (4372, 72, 'item4372');
+INSERT INTO items VALUES (4373, 73, 'item4373');
+INSERT INTO items VALUES (4374, 74, 'item4374');
+INSERT INTO items VALUES (4375, 75, 'item4375');
+INSERT INTO items VALUES (4376, 76, 'item4376');
+INSERT INTO items VALUES (4377, 77, 'item4377');
+INSERT INTO items VALUES (4378, 78, 'item4378');
+INSERT INTO items VALUES (4379, 79, 'item4379');
+INSERT INTO items VALUES (4380, 80, 'item4380');
+INSERT INTO items VALUES (4381, 81, 'item4381');
+INSERT INTO items VALUES (4382, 82, 'item4382');
+INSERT INTO items VALUES (4383, 83, 'item4383');
+INSERT INTO items VALUES (4384, 84, 'item4384');
+INSERT INTO items VALUES (4385, 85, 'item4385');
+INSERT INTO items VALUES (4386, 86, 'item4386');
+INSERT INTO items VALUES (4387, 87, 'item4387');
+INSERT INTO items VALUES (4388, 88, 'item4388');
+INSERT INTO items VALUES (4389, 89, 'item4389');
+INSERT INTO items VALUES (4390, 90, 'item4390');
+INSERT INTO items VALUES (4391, 91, 'item4391');
+INSERT INTO items VALUES (4392, 92, 'item4392');
+INSERT INTO items VALUES (4393, 93, 'item4393');
+INSERT INTO items VALUES (4394, 94, 'item4394');
+INSERT INTO items VALUES (4395, 95, 'item4395');
+INSERT INTO items VALUES (4396, 96, 'item4396');
+INSERT INTO items VALUES (4397, 97, 'item4397');
+INSERT INTO items VALUES (4398, 98, 'item4398');
+INSERT INTO items VALUES (4399, 99, 'item4399');
+INSERT INTO items VALUES (4400, 0, 'item4400');
+INSERT INTO items VALUES (4401, 1, 'item4401');
+INSERT INTO items VALUES (4402, 2, 'item4402');
+INSERT INTO items VALUES (4403, 3, 'item4403');
+INSERT INTO items VALUES (4404, 4, 'item4404');
+INSERT INTO items VALUES (4405, 5, 'item4405');
+INSERT INTO items VALUES (4406, 6, 'item4406');
+INSERT INTO items VALUES (4407, 7, 'item4407');
+INSERT INTO items VALUES (4408, 8, 'item4408');
+INSERT INTO items VALUES (4409, 9, 'item4409');
+INSERT INTO items VALUES (4410, 10, 'item4410');
+INSERT INTO items VALUES (4411, 11, 'item4411');
+INSERT INTO items VALUES (4412, 12, 'item4412');
+INSERT INTO items VALUES (4413, 13, 'item4413');
+INSERT INTO items VALUES (4414, 14, 'item4414');
+INSERT INTO items VALUES (4415, 15, 'item4415');
+INSERT INTO items VALUES (4416, 16, 'item4416');
+INSERT INTO items VALUES (4417, 17, 'item4417');
+INSERT INTO items VALUES (4418, 18, 'item4418');
+INSERT INTO items VALUES (4419, 19, 'item4419');
+INSERT INTO items VALUES (4420, 20, 'item4420');
+INSERT INTO items VALUES (4421, 21, 'item4421');
+INSERT INTO items VALUES (4422, 22, 'item4422');
+INSERT INTO items VALUES (4423, 23, 'item4423');
+INSERT INTO items VALUES (4424, 24, 'item4424');
+INSERT INTO items VALUES (4425, 25, 'item4425');
+INSERT INTO items VALUES (4426, 26, 'item4426');
+INSERT INTO items VALUES (4427, 27, 'item4427');
+INSERT INTO items VALUES (4428, 28, 'item4428');
+INSERT INTO items VALUES (4429, 29, 'item4429');
+INSERT INTO items VALUES (4430, 30, 'item4430');
+INSERT INTO items VALUES (4431, 31, 'item4431');
+INSERT INTO items VALUES (4432, 32, 'item4432');
+INSERT INTO items VALUES (4433, 33, 'item4433');
+INSERT INTO items VALUES (4434, 34, 'item4434');
+INSERT INTO items VALUES (4435, 35, 'item4435');
+INSERT INTO items VALUES (4436, 36, 'item4436');
+INSERT INTO items VALUES (4437, 37, 'item4437');
+INSERT INTO items VALUES (4438, 38, 'item4438');
+INSERT INTO items VALUES (4439, 39, 'item4439');
+INSERT INTO items VALUES (4440, 40, 'item4440');
+INSERT INTO items VALUES (4441, 41, 'item4441');
+INSERT INTO items VALUES (4442, 42, 'item4442');
+INSERT INTO items VALUES (4443, 43, 'item4443');
+INSERT INTO items VALUES (4444, 44, 'item4444');
+INSERT INTO items VALUES (4445, 45, 'item4445');
+INSERT INTO items VALUES (4446, 46, 'item4446');
+INSERT INTO items VALUES (4447, 47, 'item4447');
+INSERT INTO items VALUES (4448, 48, 'item4448');
+INSERT INTO items VALUES (4449, 49, 'item4449');
+INSERT INTO items VALUES (4450, 50, 'item4450');
+INSERT INTO items VALUES (4451, 51, 'item4451');
+INSERT INTO items VALUES (4452, 52, 'item4452');
+INSERT INTO items VALUES (4453, 53, 'item4453');
+INSERT INTO items VALUES (4454, 54, 'item4454');
+INSERT INTO items VALUES (4455, 55, 'item4455');
+INSERT INTO items VALUES (4456, 56, 'item4456');
+INSERT INTO items VALUES (4457, 57, 'item4457');
+INSERT INTO items VALUES (4458, 58, 'item4458');
+INSERT INTO items VALUES (4459, 59, 'item4459');
+INSERT INTO items VALUES (4460, 60, 'item4460');
+INSERT INTO items VALUES (4461, 61, 'item4461');
+INSERT INTO items VALUES (4462, 62, 'item4462');
+INSERT INTO items VALUES (4463, 63, 'item4463');
+INSERT INTO items VALUES (4464, 64, 'item4464');
+INSERT INTO items VALUES (4465, 65, 'item4465');
+INSERT INTO items VALUES (4466, 66, 'item4466');
+INSERT INTO items VALUES (4467, 67, 'item4467');
+INSERT INTO items VALUES (4468, 68, 'item4468');
+INSERT INTO items VALUES (4469, 69, 'item4469');
+INSERT INTO items VALUES (4470, 70, 'item4470');
+INSERT INTO items VALUES (4471, 71, 'item4471');
+INSERT INTO items VALUES (4472, 72, 'item4472');
+INSERT INTO items VALUES (4473, 73, 'item4473');
+INSERT INTO items VALUES (4474, 74, 'item4474');
+INSERT INTO items VALUES (4475, 75, 'item4475');
+INSERT INTO items VALUES (4476, 76, 'item4476');
+INSERT INTO items VALUES (4477, 77, 'item4477');
+INSERT INTO items VALUES (4478, 78, 'item4478');
+INSERT INTO items VALUES (4479, 79, 'item4479');
+INSERT INTO items VALUES (4480, 80, 'item4480');
+INSERT INTO items VALUES (4481, 81, 'item4481');
+INSERT INTO items VALUES (4482, 82, 'item4482');
+INSERT INTO items VALUES (4483, 83, 'item4483');
+INSERT INTO items VALUES (4484, 84, 'item4484');
+INSERT INTO items VALUES (4485, 85, 'item4485');
+INSERT INTO items VALUES (4486, 86, 'item4486');
+INSERT INTO items VALUES (4487, 87, 'item4487');
+INSERT INTO items VALUES (4488, 88, 'item4488');
+INSERT INTO items VALUES (4489, 89, 'item4489');
+INSERT INTO items VALUES (4490, 90, 'item4490');
+INSERT INTO items VALUES (4491, 91, 'item4491');
+INSERT INTO items VALUES (4492, 92, 'item4492');
+INSERT INTO items VALUES (4493, 93, 'item4493');
+INSERT INTO items VALUES (4494, 94, 'item4494');
+INSERT INTO items VALUES (4495, 95, 'item4495');
+INSERT INTO items VALUES (4496, 96, 'item4496');
+INSERT INTO items VALUES (4497, 97, 'item4497');
+INSERT INTO items VALUES (4498, 98, 'item4498');
+INSERT INTO items VALUES (4499, 99, 'item4499');
+INSERT INTO items VALUES (4500, 0, 'item4500');
+INSERT INTO items VALUES (4501, 1, 'item4501');
+INSERT INTO items VALUES (4502, 2, 'item4502');
+INSERT INTO items VALUES (4503, 3, 'item4503');
+INSERT INTO items VALUES (4504, 4, 'item4504');
+INSERT INTO items VALUES (4505, 5, 'item4505');
+INSERT INTO items VALUES (4506, 6, 'item4506');
+INSERT INTO items VALUES (4507, 7, 'item4507');
+INSERT INTO items VALUES (4508, 8, 'item4508');
+INSERT INTO items VALUES (4509, 9, 'item4509');
+INSERT INTO items VALUES (4510, 10, 'item4510');
+INSERT INTO items VALUES (4511, 11, 'item4511');
+INSERT INTO items VALUES (4512, 12, 'item4512');
+INSERT INTO items VALUES (4513, 13, 'item4513');
+INSERT INTO items VALUES (4514, 14, 'item4514');
+INSERT INTO items VALUES (4515, 15, 'item4515');
+INSERT INTO items VALUES (4516, 16, 'item4516');
+INSERT INTO items VALUES (4517, 17, 'item4517');
+INSERT INTO items VALUES (4518, 18, 'item4518');
+INSERT INTO items VALUES (4519, 19, 'item4519');
+INSERT INTO items VALUES (4520, 20, 'item4520');
+INSERT INTO items VALUES (4521, 21, 'item4521');
+INSERT INTO items VALUES (4522, 22, 'item4522');
+INSERT INTO items VALUES (4523, 23, 'item4523');
+INSERT INTO items VALUES (4524, 24, 'item4524');
+INSERT INTO items VALUES (4525, 25, 'item4525');
+INSERT INTO items VALUES (4526, 26, 'item4526');
+INSERT INTO items VALUES (4527, 27, 'item4527');
+INSERT INTO items VALUES (4528, 28, 'item4528');
+INSERT INTO items VALUES (4529, 29, 'item4529');
+INSERT INTO items VALUES (4530, 30, 'item4530');
+INSERT INTO items VALUES (4531, 31, 'item4531');
+INSERT INTO items VALUES (4532, 32, 'item4532');
+INSERT INTO items VALUES (4533, 33, 'item4533');
+INSERT INTO items VALUES (4534, 34, 'item4534');
+INSERT INTO items VALUES (4535, 35, 'item4535');
+INSERT INTO items VALUES (4536, 36, 'item4536');
+INSERT INTO items VALUES (4537, 37, 'item4537');
+INSERT INTO items VALUES (4538, 38, 'item4538');
+INSERT INTO items VALUES (4539, 39, 'item4539');
+INSERT INTO items VALUES (4540, 40, 'item4540');
+INSERT INTO items VALUES (4541, 41, 'item4541');
+INSERT INTO items VALUES (4542, 42, 'item4542');
+INSERT INTO items VALUES (4543, 43, 'item4543');
+INSERT INTO items VALUES (4544, 44, 'item4544');
+INSERT INTO items VALUES (4545, 45, 'item4545');
+INSERT INTO items VALUES (4546, 46, 'item4546');
+INSERT INTO items VALUES (4547, 47, 'item4547');
+INSERT INTO items VALUES (4548, 48, 'item4548');
+INSERT INTO items VALUES (4549, 49, 'item4549');
+INSERT INTO items VALUES (4550, 50, 'item4550');
+INSERT INTO items VALUES (4551, 51, 'item4551');
+INSERT INTO items VALUES (4552, 52, 'item4552');
+INSERT INTO items VALUES (4553, 53, 'item4553');
+INSERT INTO items VALUES (4554, 54, 'item4554');
+INSERT INTO items VALUES (4555, 55, 'item4555');
+INSERT INTO items VALUES (4556, 56, 'item4556');
+INSERT INTO items VALUES (4557, 57, 'item4557');
+INSERT INTO items VALUES (4558, 58, 'item4558');
+INSERT INTO items VALUES (4559, 59, 'item4559');
+INSERT INTO items VALUES (4560, 60, 'item4560');
+INSERT INTO items VALUES (4561, 61, 'item4561');
+INSERT INTO items VALUES (4562, 62, 'item4562');
+INSERT INTO items VALUES (4563, 63, 'item4563');
+INSERT INTO items VALUES (4564, 64, 'item4564');
+INSERT INTO items VALUES (4565, 65, 'item4565');
+INSERT INTO items VALUES (4566, 66, 'item4566');
+INSERT INTO items VALUES (4567, 67, 'item4567');
+INSERT INTO items VALUES (4568, 68, 'item4568');
+INSERT INTO items VALUES (4569, 69, 'item4569');
+INSERT INTO items VALUES (4570, 70, 'item4570');
+INSERT INTO items VALUES (4571, 71, 'item4571');
+INSERT INTO items VALUES (4572, 72, 'item4572');
+INSERT INTO items VALUES (4573, 73, 'item4573');
+INSERT INTO items VALUES (4574, 74, 'item4574');
+INSERT INTO items VALUES (4575, 75, 'item4575');
+INSERT INTO items VALUES (4576, 76, 'item4576');
+INSERT INTO items VALUES (4577, 77, 'item4577');
+INSERT INTO items VALUES (4578, 78, 'item4578');
+INSERT INTO items VALUES (4579, 79, 'item4579');
+INSERT INTO items VALUES (4580, 80, 'item4580');
+INSERT INTO items VALUES (4581, 81, 'item4581');
+INSERT INTO items VALUES (4582, 82, 'item4582');
+INSERT INTO items VALUES (4583, 83, 'item4583');
+INSERT INTO items VALUES (4584, 84, 'item4584');
+INSERT INTO items VALUES (4585, 85, 'item4585');
+INSERT INTO items VALUES (4586, 86, 'item4586');
+INSERT INTO items VALUES (4587, 87, 'item4587');
+INSERT INTO items VALUES (4588, 88, 'item4588');
+INSERT INTO items VALUES (4589, 89, 'item4589');
+INSERT INTO items VALUES (4590, 90, 'item4590');
+INSERT INTO items VALUES (4591, 91, 'item4591');
+INSERT INTO items VALUES (4592, 92, 'item4592');
+INSERT INTO items VALUES (4593, 93, 'item4593');
+INSERT INTO items VALUES (4594, 94, 'item4594');
+INSERT INTO items VALUES (4595, 95, 'item4595');
+INSERT INTO items VALUES (4596, 96, 'item4596');
+INSERT INTO items VALUES (4597, 97, 'item4597');
+INSERT INTO items VALUES (4598, 98, 'item4598');
+INSERT INTO items VALUES (4599, 99, 'item4599');
+INSERT INTO items VALUES (4600, 0, 'item4600');
+INSERT INTO items VALUES (4601, 1, 'item4601');
+INSERT INTO items VALUES (4602, 2, 'item4602');
+INSERT INTO items VALUES (4603, 3, 'item4603');
+INSERT INTO items VALUES (4604, 4, 'item4604');
+INSERT INTO items VALUES (4605, 5, 'item4605');
+INSERT INTO items VALUES (4606, 6, 'item4606');
+INSERT INTO items VALUES (4607, 7, 'item4607');
+INSERT INTO items VALUES (4608, 8, 'item4608');
+INSERT INTO items VALUES (4609, 9, 'item4609');
+INSERT INTO items VALUES (4610, 10, 'item4610');
+INSERT INTO items VALUES (4611, 11, 'item4611');
+INSERT INTO items VALUES (4612, 12, 'item4612');
+INSERT INTO items VALUES (4613, 13, 'item4613');
+INSERT INTO items VALUES (4614, 14, 'item4614');
+INSERT INTO items VALUES (4615, 15, 'item4615');
+INSERT INTO items VALUES (4616, 16, 'item4616');
+INSERT INTO items VALUES (4617, 17, 'item4617');
+INSERT INTO items VALUES (4618, 18, 'item4618');
+INSERT INTO items VALUES (4619, 19, 'item4619');
+INSERT INTO items VALUES (4620, 20, 'item4620');
+INSERT INTO items VALUES (4621, 21, 'item4621');
+INSERT INTO items VALUES (4622, 22, 'item4622');
+INSERT INTO items VALUES (4623, 23, 'item4623');
+INSERT INTO items VALUES (4624, 24, 'item4624');
+INSERT INTO items VALUES (4625, 25, 'item4625');
+INSERT INTO items VALUES (4626, 26, 'item4626');
+INSERT INTO items VALUES (4627, 27, 'item4627');
+INSERT INTO items VALUES (4628, 28, 'item4628');
+INSERT INTO items VALUES (4629, 29, 'item4629');
+INSERT INTO items VALUES (4630, 30, 'item4630');
+INSERT INTO items VALUES (4631, 31, 'item4631');
+INSERT INTO items VALUES (4632, 32, 'item4632');
+INSERT INTO items VALUES (4633, 33, 'item4633');
+INSERT INTO items VALUES (4634, 34, 'item4634');
+INSERT INTO items VALUES (4635, 35, 'item4635');
+INSERT INTO items VALUES (4636, 36, 'item4636');
+INSERT INTO items VALUES (4637, 37, 'item4637');
+INSERT INTO items VALUES (4638, 38, 'item4638');
+INSERT INTO items VALUES (4639, 39, 'item4639');
+INSERT INTO items VALUES (4640, 40, 'item4640');
+INSERT INTO items VALUES (4641, 41, 'item4641');
+INSERT INTO items VALUES (4642, 42, 'item4642');
+INSERT INTO items VALUES (4643, 43, 'item4643');
+INSERT INTO items VALUES (4644, 44, 'item4644');
+INSERT INTO items VALUES (4645, 45, 'item4645');
+INSERT INTO items VALUES (4646, 46, 'item4646');
+INSERT INTO items VALUES (4647, 47, 'item4647');
+INSERT INTO items VALUES (4648, 48, 'item4648');
+INSERT INTO items VALUES (4649, 49, 'item4649');
+INSERT INTO items VALUES (4650, 50, 'item4650');
+INSERT INTO items VALUES (4651, 51, 'item4651');
+INSERT INTO items VALUES (4652, 52, 'item4652');
+INSERT INTO items VALUES (4653, 53, 'item4653');
+INSERT INTO items VALUES (4654, 54, 'item4654');
+INSERT INTO items VALUES (4655, 55, 'item4655');
+INSERT INTO items VALUES (4656, 56, 'item4656');
+INSERT INTO items VALUES (4657, 57, 'item4657');
+INSERT INTO items VALUES (4658, 58, 'item4658');
+INSERT INTO items VALUES (4659, 59, 'item4659');
+INSERT INTO items VALUES (4660, 60, 'item4660');
+INSERT INTO items VALUES (4661, 61, 'item4661');
+INSERT INTO items VALUES (4662, 62, 'item4662');
+INSERT INTO items VALUES (4663, 63, 'item4663');
+INSERT INTO items VALUES (4664, 64, 'item4664');
+INSERT INTO items VALUES (4665, 65, 'item4665');
+INSERT INTO items VALUES (4666, 66, 'item4666');
+INSERT INTO items VALUES (4667, 67, 'item4667');
+INSERT INTO items VALUES (4668, 68, 'item4668');
+INSERT INTO items VALUES (4669, 69, 'item4669');
+INSERT INTO items VALUES (4670, 70, 'item4670');
+INSERT INTO items VALUES (4671, 71, 'item4671');
+INSERT INTO items VALUES (4672, 72, 'item4672');
+INSERT INTO items VALUES (4673, 73, 'item4673');
+INSERT INTO items VALUES (4674, 74, 'item4674');
+INSERT INTO items VALUES (4675, 75, 'item4675');
+INSERT INTO items VALUES (4676, 76, 'item4676');
+INSERT INTO items VALUES (4677, 77, 'item4677');
+INSERT INTO items VALUES (4678, 78, 'item4678');
+INSERT INTO items VALUES (4679, 79, 'item4679');
+INSERT INTO items VALUES (4680, 80, 'item4680');
+INSERT INTO items VALUES (4681, 81, 'item4681');
+INSERT INTO items VALUES (4682, 82, 'item4682');
+INSERT INTO items VALUES (4683, 83, 'item4683');
+INSERT INTO items VALUES (4684, 84, 'item4684');
+INSERT INTO items VALUES (4685, 85, 'item4685');
+INSERT INTO items VALUES (4686, 86, 'item4686');
+INSERT INTO items VALUES (4687, 87, 'item4687');
+INSERT INTO items VALUES (4688, 88, 'item4688');
+INSERT INTO items VALUES (4689, 89, 'item4689');
+INSERT INTO items VALUES (4690, 90, 'item4690');
+INSERT INTO items VALUES (4691, 91, 'item4691');
+INSERT INTO items VALUES (4692, 92, 'item4692');
+INSERT INTO items VALUES (4693, 93, 'item4693');
+INSERT INTO items VALUES (4694, 94, 'item4694');
+INSERT INTO items VALUES (4695, 95, 'item4695');
+INSERT INTO items VALUES (4696, 96, 'item4696');
+INSERT INTO items VALUES (4697, 97, 'item4697');
+INSERT INTO items VALUES (4698, 98, 'item4698');
+INSERT INTO items VALUES (4699, 99, 'item4699');
+INSERT INTO items VALUES (4700, 0, 'item4700');
+INSERT INTO items VALUES (4701, 1, 'item4701');
+INSERT INTO items VALUES (4702, 2, 'item4702');
+INSERT INTO items VALUES (4703, 3, 'item4703');
+INSERT INTO items VALUES (4704, 4, 'item4704');
+INSERT INTO items VALUES (4705, 5, 'item4705');
+INSERT INTO items VALUES (4706, 6, 'item4706');
+INSERT INTO items VALUES (4707, 7, 'item4707');
+INSERT INTO items VALUES (4708, 8, 'item4708');
+INSERT INTO items VALUES (4709, 9, 'item4709');
+INSERT INTO items VALUES (4710, 10, 'item4710');
+INSERT INTO items VALUES (4711, 11, 'item4711');
+INSERT INTO items VALUES (4712, 12, 'item4712');
+INSERT INTO items VALUES (4713, 13, 'item4713');
+INSERT INTO items VALUES (4714, 14, 'item4714');
+INSERT INTO items VALUES (4715, 15, 'item4715');
+INSERT INTO items VALUES (4716, 16, 'item4716');
+INSERT INTO items VALUES (4717, 17, 'item4717');
+INSERT INTO items VALUES (4718, 18, 'item4718');
+INSERT INTO items VALUES (4719, 19, 'item4719');
+INSERT INTO items VALUES (4720, 20, 'item4720');
+INSERT INTO items VALUES (4721, 21, 'item4721');
+INSERT INTO items VALUES (4722, 22, 'item4722');
+INSERT INTO items VALUES (4723, 23, 'item4723');
+INSERT INTO items VALUES (4724, 24, 'item4724');
+INSERT INTO items VALUES (4725, 25, 'item4725');
+INSERT INTO items VALUES (4726, 26, 'item4726');
+INSERT INTO items VALUES (4727, 27, 'item4727');
+INSERT INTO items VALUES (4728, 28, 'item4728');
+INSERT INTO items VALUES (4729, 29, 'item4729');
+INSERT INTO items VALUES (4730, 30, 'item4730');
+INSERT INTO items VALUES (4731, 31, 'item4731');
+INSERT INTO items VALUES (4732, 32, 'item4732');
+INSERT INTO items VALUES (4733, 33, 'item4733');
+INSERT INTO items VALUES (4734, 34, 'item4734');
+INSERT INTO items VALUES (4735, 35, 'item4735');
+INSERT INTO items VALUES (4736, 36, 'item4736');
+INSERT INTO items VALUES (4737, 37, 'item4737');
+INSERT INTO items VALUES (4738, 38, 'item4738');
+INSERT INTO items VALUES (4739, 39, 'item4739');
+INSERT INTO items VALUES (4740, 40, 'item4740');
+INSERT INTO items VALUES (4741, 41, 'item4741');
+INSERT INTO items VALUES (4742, 42, 'item4742');
+INSERT INTO items VALUES (4743, 43, 'item4743');
+INSERT INTO items VALUES (4744, 44, 'item4744');
+INSERT INTO items VALUES (4745, 45, 'item4745');
+INSERT INTO items VALUES (4746, 46, 'item4746');
+INSERT INTO items VALUES (4747, 47, 'item4747');
+INSERT INTO items VALUES (4748, 48, 'item4748');
+INSERT INTO items VALUES (4749, 49, 'item4749');
+INSERT INTO items VALUES (4750, 50, 'item4750');
+INSERT INTO items VALUES (4751, 51, 'item4751');
+INSERT INTO items VALUES (4752, 52, 'item4752');
+INSERT INTO items VALUES (4753, 53, 'item4753');
+INSERT INTO items VALUES (4754, 54, 'item4754');
+INSERT INTO items VALUES (4755, 55, 'item4755');
+INSERT INTO items VALUES (4756, 56, 'item4756');
+INSERT INTO items VALUES (4757, 57, 'item4757');
+INSERT INTO items VALUES (4758, 58, 'item4758');
+INSERT INTO items VALUES (4759, 59, 'item4759');
+INSERT INTO items VALUES (4760, 60, 'item4760');
+INSERT INTO items VALUES (4761, 61, 'item4761');
+INSERT INTO items VALUES (4762, 62, 'item4762');
+INSERT INTO items VALUES (4763, 63, 'item4763');
+INSERT INTO items VALUES (4764, 64, 'item4764');
+INSERT INTO items VALUES (4765, 65, 'item4765');
+INSERT INTO items VALUES (4766, 66, 'item4766');
+INSERT INTO items VALUES (4767, 67, 'item4767');
+INSERT INTO items VALUES (4768, 68, 'item4768');
+INSERT INTO items VALUES (4769, 69, 'item4769');
+INSERT INTO items VALUES (4770, 70, 'item4770');
+INSERT INTO items VALUES (4771, 71, 'item4771');
+INSERT INTO items VALUES (4772, 72, 'item4772');
+INSERT INTO items VALUES (4773, 73, 'item4773');
+INSERT INTO items VALUES (4774, 74, 'item4774');
+INSERT INTO items VALUES (4775, 75, 'item4775');
+INSERT INTO items VALUES (4776, 76, 'item4776');
+INSERT INTO items VALUES (4777, 77, 'item4777');
+INSERT INTO items VALUES (4778, 78, 'item4778');
+INSERT INTO items VALUES (4779, 79, 'item4779');
+INSERT INTO items VALUES (4780, 80, 'item4780');
+INSERT INTO items VALUES (4781, 81, 'item4781');
+INSERT INTO items VALUES (4782, 82, 'item4782');
+INSERT INTO items VALUES (4783, 83, 'item4783');
+INSERT INTO items VALUES (4784, 84, 'item4784');
+INSERT INTO items VALUES (4785, 85, 'item4785');
+INSERT INTO items VALUES (4786, 86, 'item4786');
+INSERT INTO items VALUES (4787, 87, 'item4787');
+INSERT INTO items VALUES (4788, 88, 'item4788');
+INSERT INTO items VALUES (4789, 89, 'item4789');
+INSERT INTO items VALUES (4790, 90, 'item4790');
+INSERT INTO items VALUES (4791, 91, 'item4791');
+INSERT INTO items VALUES (4792, 92, 'item4792');
+INSERT INTO items VALUES (4793, 93, 'item4793');
+INSERT INTO items VALUES (4794, 94, 'item4794');
+INSERT INTO items VALUES (4795, 95, 'item4795');
+INSERT INTO items VALUES (4796, 96, 'item4796');
+INSERT INTO items VALUES (4797, 97, 'item4797');
+INSERT INTO items VALUES (4798, 98, 'item4798');
+INSERT INTO items VALUES (4799, 99, 'item4799');
+INSERT INTO items VALUES (4800, 0, 'item4800');
+INSERT INTO items VALUES (4801, 1, 'item4801');
+INSERT INTO items VALUES (4802, 2, 'item4802');
+INSERT INTO items VALUES (4803, 3, 'item4803');
+INSERT INTO items VALUES (4804, 4, 'item4804');
+INSERT INTO items VALUES (4805, 5, 'item4805');
+INSERT INTO items VALUES (4806, 6, 'item4806');
+INSERT INTO items VALUES (4807, 7, 'item4807');
+INSERT INTO items VALUES (4808, 8, 'item4808');
+INSERT INTO items VALUES (4809, 9, 'item4809');
+INSERT INTO items VALUES (4810, 10, 'item4810');
+INSERT INTO items VALUES (4811, 11, 'item4811');
+INSERT INTO items VALUES (4812, 12, 'item4812');
+INSERT INTO items VALUES (4813, 13, 'item4813');
+INSERT INTO items VALUES (4814, 14, 'item4814');
+INSERT INTO items VALUES (4815, 15, 'item4815');
+INSERT INTO items VALUES (4816, 16, 'item4816');
+INSERT INTO items VALUES (4817, 17, 'item4817');
+INSERT INTO items VALUES (4818, 18, 'item4818');
+INSERT INTO items VALUES (4819, 19, 'item4819');
+INSERT INTO items VALUES (4820, 20, 'item4820');
+INSERT INTO items VALUES (4821, 21, 'item4821');
+INSERT INTO items VALUES (4822, 22, 'item4822');
+INSERT INTO items VALUES (4823, 23, 'item4823');
+INSERT INTO items VALUES (4824, 24, 'item4824');
+INSERT INTO items VALUES (4825, 25, 'item4825');
+INSERT INTO items VALUES (4826, 26, 'item4826');
+INSERT INTO items VALUES (4827, 27, 'item4827');
+INSERT INTO items VALUES (4828, 28, 'item4828');
+INSERT INTO items VALUES (4829, 29, 'item4829');
+INSERT INTO items VALUES (4830, 30, 'item4830');
+INSERT INTO items VALUES (4831, 31, 'item4831');
+INSERT INTO items VALUES (4832, 32, 'item4832');
+INSERT INTO items VALUES (4833, 33, 'item4833');
+INSERT INTO items VALUES (4834, 34, 'item4834');
+INSERT INTO items VALUES (4835, 35, 'item4835');
+INSERT INTO items VALUES (4836, 36, 'item4836');
+INSERT INTO items VALUES (4837, 37, 'item4837');
+INSERT INTO items VALUES (4838, 38, 'item4838');
+INSERT INTO items VALUES (4839, 39, 'item4839');
+INSERT INTO items VALUES (4840, 40, 'item4840');
+INSERT INTO items VALUES (4841, 41, 'item4841');
+INSERT INTO items VALUES (4842, 42, 'item4842');
+INSERT INTO items VALUES (4843, 43, 'item4843');
+INSERT INTO items VALUES (4844, 44, 'item4844');
+INSERT INTO items VALUES (4845, 45, 'item4845');
+INSERT INTO items VALUES (4846, 46, 'item4846');
+INSERT INTO items VALUES (4847, 47, 'item4847');
+INSERT INTO items VALUES (4848, 48, 'item4848');
+INSERT INTO items VALUES (4849, 49, 'item4849');
+INSERT INTO items VALUES (4850, 50, 'item4850');
+INSERT INTO items VALUES (4851, 51, 'item4851');
+INSERT INTO items VALUES (4852, 52, 'item4852');
+INSERT INTO items VALUES (4853, 53, 'item4853');
+INSERT INTO items VALUES (4854, 54, 'item4854');
+INSERT INTO items VALUES (4855, 55, 'item4855');
+INSERT INTO items VALUES (4856, 56, 'item4856');
+INSERT INTO items VALUES (4857, 57, 'item4857');
+INSERT INTO items VALUES (4858, 58, 'item4858');
+INSERT INTO items VALUES (4859, 59, 'item4859');
+INSERT INTO items VALUES (4860, 60, 'item4860');
+INSERT INTO items VALUES (4861, 61, 'item4861');
+INSERT INTO items VALUES (4862, 62, 'item4862');
+INSERT INTO items VALUES (4863, 63, 'item4863');
+INSERT INTO items VALUES (4864, 64, 'item4864');
+INSERT INTO items VALUES (4865, 65, 'item4865');
+INSERT INTO items VALUES (4866, 66, 'item4866');
+INSERT INTO items VALUES (4867, 67, 'item4867');
+INSERT INTO items VALUES (4868, 68, 'item4868');
+INSERT INTO items VALUES (4869, 69, 'item4869');
+INSERT INTO items VALUES (4870, 70, 'item4870');
+INSERT INTO items VALUES (4871, 71, 'item4871');
+INSERT INTO items VALUES (4872, 72, 'item4872');
+INSERT INTO items VALUES (4873, 73, 'item4873');
+INSERT INTO items VALUES (4874, 74, 'item4874');
+INSERT INTO items VALUES (4875, 75, 'item4875');
+INSERT INTO items VALUES (4876, 76, 'item4876');
+INSERT INTO items VALUES (4877, 77, 'item4877');
+INSERT INTO items VALUES (4878, 78, 'item4878');
+INSERT INTO items VALUES (4879, 79, 'item4879');
+INSERT INTO items VALUES (4880, 80, 'item4880');
+INSERT INTO items VALUES (4881, 81, 'item4881');
+INSERT INTO items VALUES (4882, 82, 'item4882');
+INSERT INTO items VALUES (4883, 83, 'item4883');
+INSERT INTO items VALUES (4884, 84, 'item4884');
+INSERT INTO items VALUES (4885, 85, 'item4885');
+INSERT INTO items VALUES (4886, 86, 'item4886');
+INSERT INTO items VALUES (4887, 87, 'item4887');
+INSERT INTO items VALUES (4888, 88, 'item4888');
+INSERT INTO items VALUES (4889, 89, 'item4889');
+INSERT INTO items VALUES (4890, 90, 'item4890');
+INSERT INTO items VALUES (4891, 91, 'item4891');
+INSERT INTO items VALUES (4892, 92, 'item4892');
+INSERT INTO items VALUES (4893, 93, 'item4893');
+INSERT INTO items VALUES (4894, 94, 'item4894');
+INSERT INTO items VALUES (4895, 95, 'item4895');
+INSERT INTO items VALUES (4896, 96, 'item4896');
+INSERT INTO items VALUES (4897, 97, 'item4897');
+INSERT INTO items VALUES (4898, 98, 'item4898');
+INSERT INTO items VALUES (4899, 99, 'item4899');
+INSERT INTO items VALUES (4900, 0, 'item4900');
+INSERT INTO items VALUES (4901, 1, 'item4901');
+INSERT INTO items VALUES (4902, 2, 'item4902');
+INSERT INTO items VALUES (4903, 3, 'item4903');
+INSERT INTO items VALUES (4904, 4, 'item4904');
+INSERT INTO items VALUES (4905, 5, 'item4905');
+INSERT INTO items VALUES (4906, 6, 'item4906');
+INSERT INTO items VALUES (4907, 7, 'item4907');
+INSERT INTO items VALUES (4908, 8, 'item4908');
+INSERT INTO items VALUES (4909, 9, 'item4909');
+INSERT INTO items VALUES (4910, 10, 'item4910');
+INSERT INTO items VALUES (4911, 11, 'item4911');
+INSERT INTO items VALUES (4912, 12, 'item4912');
+INSERT INTO items VALUES (4913, 13, 'item4913');
+INSERT INTO items VALUES (4914, 14, 'item4914');
+INSERT INTO items VALUES (4915, 15, 'item4915');
+INSERT INTO items VALUES (4916, 16, 'item4916');
+INSERT INTO items VALUES (4917, 17, 'item4917');
+INSERT INTO items VALUES (4918, 18, 'item4918');
+INSERT INTO items VALUES (4919, 19, 'item4919');
+INSERT INTO items VALUES (4920, 20, 'item4920');
+INSERT INTO items VALUES (4921, 21, 'item4921');
+INSERT INTO items VALUES (4922, 22, 'item4922');
+INSERT INTO items VALUES (4923, 23, 'item4923');
+INSERT INTO items VALUES (4924, 24, 'item4924');
+INSERT INTO items VALUES (4925, 25, 'item4925');
+INSERT INTO items VALUES (4926, 26, 'item4926');
+INSERT INTO items VALUES (4927, 27, 'item4927');
+INSERT INTO items VALUES (4928, 28, 'item4928');
+INSERT INTO items VALUES (4929, 29, 'item4929');
+INSERT INTO items VALUES (4930, 30, 'item4930');
+INSERT INTO items VALUES (4931, 31, 'item4931');
+INSERT INTO items VALUES (4932, 32, 'item4932');
+INSERT INTO items VALUES (4933, 33, 'item4933');
+INSERT INTO items VALUES (4934, 34, 'item4934');
+INSERT INTO items VALUES (4935, 35, 'item4935');
+INSERT INTO items VALUES (4936, 36, 'item4936');
+INSERT INTO items VALUES (4937, 37, 'item4937');
+INSERT INTO items VALUES (4938, 38, 'item4938');
+INSERT INTO items VALUES (4939, 39, 'item4939');
+INSERT INTO items VALUES (4940, 40, 'item4940');
+INSERT INTO items VALUES (4941, 41, 'item4941');
+INSERT INTO items VALUES (4942, 42, 'item4942');
+INSERT INTO items VALUES (4943, 43, 'item4943');
+INSERT INTO items VALUES (4944, 44, 'item4944');
+INSERT INTO items VALUES (4945, 45, 'item4945');
+INSERT INTO items VALUES (4946, 46, 'item4946');
+INSERT INTO items VALUES (4947, 47, 'item4947');
+INSERT INTO items VALUES (4948, 48, 'item4948');
+INSERT INTO items VALUES (4949, 49, 'item4949');
+INSERT INTO items VALUES (4950, 50, 'item4950');
+INSERT INTO items VALUES (4951, 51, 'item4951');
+INSERT INTO items VALUES (4952, 52, 'item4952');
+INSERT INTO items VALUES (4953, 53, 'item4953');
+INSERT INTO items VALUES (4954, 54, 'item4954');
+INSERT INTO items VALUES (4955, 55, 'item4955');
+INSERT INTO items VALUES (4956, 56, 'item4956');
+INSERT INTO items VALUES (4957, 57, 'item4957');
+INSERT INTO items VALUES (4958, 58, 'item4958');
+INSERT INTO items VALUES (4959, 59, 'item4959');
+INSERT INTO items VALUES (4960, 60, 'item4960');
+INSERT INTO items VALUES (4961, 61, 'item4961');
+INSERT INTO items VALUES (4962, 62, 'item4962');
+INSERT INTO items VALUES (4963, 63, 'item4963');
+INSERT INTO items VALUES (4964, 64, 'item4964');
+INSERT INTO items VALUES (4965, 65, 'item4965');
+INSERT INTO items VALUES (4966, 66, 'item4966');
+INSERT INTO items VALUES (4967, 67, 'item4967');
+INSERT INTO items VALUES (4968, 68, 'item4968');
+INSERT INTO items VALUES (4969, 69, 'item4969');
+INSERT INTO items VALUES (4970, 70, 'item4970');
+INSERT INTO items VALUES (4971, 71, 'item4971');
+INSERT INTO items VALUES (4972, 72, 'item4972');
+INSERT INTO items VALUES (4973, 73, 'item4973');
+INSERT INTO items VALUES (4974, 74, 'item4974');
+INSERT INTO items VALUES (4975, 75, 'item4975');
+INSERT INTO items VALUES (4976, 76, 'item4976');
+INSERT INTO items VALUES (4977, 77, 'item4977');
+INSERT INTO items VALUES (4978, 78, 'item4978');
+INSERT INTO items VALUES (4979, 79, 'item4979');
+INSERT INTO items VALUES (4980, 80, 'item4980');
+INSERT INTO items VALUES (4981, 81, 'item4981');
+INSERT INTO items VALUES (4982, 82, 'item4982');
+INSERT INTO items VALUES (4983, 83, 'item4983');
+INSERT INTO items VALUES (4984, 84, 'item4984');
+INSERT INTO items VALUES (4985, 85, 'item4985');
+INSERT INTO items VALUES (4986, 86, 'item4986');
+INSERT INTO items VALUES (4987, 87, 'item4987');
+INSERT INTO items VALUES (4988, 88, 'item4988');
+INSERT INTO items VALUES (4989, 89, 'item4989');
+INSERT INTO items VALUES (4990, 90, 'item4990');
+INSERT INTO items VALUES (4991, 91, 'item4991');
+INSERT INTO items VALUES (4992, 92, 'item4992');
+INSERT INTO items VALUES (4993, 93, 'item4993');
+INSERT INTO items VALUES (4994, 94, 'item4994');
+INSERT INTO items VALUES (4995, 95, 'item4995');
+INSERT INTO items VALUES (4996, 96, 'item4996');
+INSERT INTO items VALUES (4997, 97, 'item4997');
+INSERT INTO items VALUES (4998, 98, 'item4998');
+INSERT INTO items VALUES (4999, 99, 'item4999');
+INSERT INTO orders VALUES (0, 0, 0);
+INSERT INTO orders VALUES (1, 2919, 31);
+INSERT INTO orders VALUES (2, 838, 62);
+INSERT INTO orders VALUES (3, 3757, 93);
+INSERT INTO orders VALUES (4, 1676, 27);
+INSERT INTO orders VALUES (5, 4595, 58);
+INSERT INTO orders VALUES (6, 2514, 89);
+INSERT INTO orders VALUES (7, 433, 23);
+INSERT INTO orders VALUES (8, 3352, 54);
+INSERT INTO orders VALUES (9, 1271, 85);
+INSERT INTO orders VALUES (10, 4190, 19);
+INSERT INTO orders VALUES (11, 2109, 50);
+INSERT INTO orders VALUES (12, 28, 81);
+INSERT INTO orders VALUES (13, 2947, 15);
+INSERT INTO orders VALUES (14, 866, 46);
+INSERT INTO orders VALUES (15, 3785, 77);
+INSERT INTO orders VALUES (16, 1704, 11);
+INSERT INTO orders VALUES (17, 4623, 42);
+INSERT INTO orders VALUES (18, 2542, 73);
+INSERT INTO orders VALUES (19, 461, 7);
+INSERT INTO orders VALUES (20, 3380, 38);
+INSERT INTO orders VALUES (21, 1299, 69);
+INSERT INTO orders VALUES (22, 4218, 3);
+INSERT INTO orders VALUES (23, 2137, 34);
+INSERT INTO orders VALUES (24, 56, 65);
+INSERT INTO orders VALUES (25, 2975, 96);
+INSERT INTO orders VALUES (26, 894, 30);
+INSERT INTO orders VALUES (27, 3813, 61);
+INSERT INTO orders VALUES (28, 1732, 92);
+INSERT INTO orders VALUES (29, 4651, 26);
+INSERT INTO orders VALUES (30, 2570, 57);
+INSERT INTO orders VALUES (31, 489, 88);
+INSERT INTO orders VALUES (32, 3408, 22);
+INSERT INTO orders VALUES (33, 1327, 53);
+INSERT INTO orders VALUES (34, 4246, 84);
+INSERT INTO orders VALUES (35, 2165, 18);
+INSERT INTO orders VALUES (36, 84, 49);
+INSERT INTO orders VALUES (37, 3003, 80);
+INSERT INTO orders VALUES (38, 922, 14);
+INSERT INTO orders VALUES (39, 3841, 45);
+INSERT INTO orders VALUES (40, 1760, 76);
+INSERT INTO orders VALUES (41, 4679, 10);
+INSERT INTO orders VALUES (42, 2598, 41);
+INSERT INTO orders VALUES (43, 517, 72);
+INSERT INTO orders VALUES (44, 3436, 6);
+INSERT INTO orders VALUES (45, 1355, 37);
+INSERT INTO orders VALUES (46, 4274, 68);
+INSERT INTO orders VALUES (47, 2193, 2);
+INSERT INTO orders VALUES (48, 112, 33);
+INSERT INTO orders VALUES (49, 3031, 64);
+INSERT INTO orders VALUES (50, 950, 95);
+INSERT INTO orders VALUES (51, 3869, 29);
+INSERT INTO orders VALUES (52, 1788, 60);
+INSERT INTO orders VALUES (53, 4707, 91);
+INSERT INTO orders VALUES (54, 2626, 25);
+INSERT INTO orders VALUES (55, 545, 56);
+INSERT INTO orders VALUES (56, 3464, 87);
+INSERT INTO orders VALUES (57, 1383, 21);
+INSERT INTO orders VALUES (58, 4302, 52);
+INSERT INTO orders VALUES (59, 2221, 83);
+INSERT INTO orders VALUES (60, 140, 17);
+INSERT INTO orders VALUES (61, 3059, 48);
+INSERT INTO orders VALUES (62, 978, 79);
+INSERT INTO orders VALUES (63, 3897, 13);
+INSERT INTO orders VALUES (64, 1816, 44);
+INSERT INTO orders VALUES (65, 4735, 75);
+INSERT INTO orders VALUES (66, 2654, 9);
+INSERT INTO orders VALUES (67, 573, 40);
+INSERT INTO orders VALUES (68, 3492, 71);
+INSERT INTO orders VALUES (69, 1411, 5);
+INSERT INTO orders VALUES (70, 4330, 36);
+INSERT INTO orders VALUES (71, 2249, 67);
+INSERT INTO orders VALUES (72, 168, 1);
+INSERT INTO orders VALUES (73, 3087, 32);
+INSERT INTO orders VALUES (74, 1006, 63);
+INSERT INTO orders VALUES (75, 3925, 94);
+INSERT INTO orders VALUES (76, 1844, 28);
+INSERT INTO orders VALUES (77, 4763, 59);
+INSERT INTO orders VALUES (78, 2682, 90);
+INSERT INTO orders VALUES (79, 601, 24);
+INSERT INTO orders VALUES (80, 3520, 55);
+INSERT INTO orders VALUES (81, 1439, 86);
+INSERT INTO orders VALUES (82, 4358, 20);
+INSERT INTO orders VALUES (83, 2277, 51);
+INSERT INTO orders VALUES (84, 196, 82);
+INSERT INTO orders VALUES (85, 3115, 16);
+INSERT INTO orders VALUES (86, 1034, 47);
+INSERT INTO orders VALUES (87, 3953, 78);
+INSERT INTO orders VALUES (88, 1872, 12);
+INSERT INTO orders VALUES (89, 4791, 43);
+INSERT INTO orders VALUES (90, 2710, 74);
+INSERT INTO orders VALUES (91, 629, 8);
+INSERT INTO orders VALUES (92, 3548, 39);
+INSERT INTO orders VALUES (93, 1467, 70);
+INSERT INTO orders VALUES (94, 4386, 4);
+INSERT INTO orders VALUES (95, 2305, 35);
+INSERT INTO orders VALUES (96, 224, 66);
+INSERT INTO orders VALUES (97, 3143, 0);
+INSERT INTO orders VALUES (98, 1062, 31);
+INSERT INTO orders VALUES (99, 3981, 62);
+INSERT INTO orders VALUES (100, 1900, 93);
+INSERT INTO orders VALUES (101, 4819, 27);
+INSERT INTO orders VALUES (102, 2738, 58);
+INSERT INTO orders VALUES (103, 657, 89);
+INSERT INTO orders VALUES (104, 3576, 23);
+INSERT INTO orders VALUES (105, 1495, 54);
+INSERT INTO orders VALUES (106, 4414, 85);
+INSERT INTO orders VALUES (107, 2333, 19);
+INSERT INTO orders VALUES (108, 252, 50);
+INSERT INTO orders VALUES (109, 3171, 81);
+INSERT INTO orders VALUES (110, 1090, 15);
+INSERT INTO orders VALUES (111, 4009, 46);
+INSERT INTO orders VALUES (112, 1928, 77);
+INSERT INTO orders VALUES (113, 4847, 11);
+INSERT INTO orders VALUES (114, 2766, 42);
+INSERT INTO orders VALUES (115, 685, 73);
+INSERT INTO orders VALUES (116, 3604, 7);
+INSERT INTO orders VALUES (117, 1523, 38);
+INSERT INTO orders VALUES (118, 4442, 69);
+INSERT INTO orders VALUES (119, 2361, 3);
+INSERT INTO orders VALUES (120, 280, 34);
+INSERT INTO orders VALUES (121, 3199, 65);
+INSERT INTO orders VALUES (122, 1118, 96);
+INSERT INTO orders VALUES (123, 4037, 30);
+INSERT INTO orders VALUES (124, 1956, 61);
+INSERT INTO orders VALUES (125, 4875, 92);
+INSERT INTO orders VALUES (126, 2794, 26);
+INSERT INTO orders VALUES (127, 713, 57);
+INSERT INTO orders VALUES (128, 3632, 88);
+INSERT INTO orders VALUES (129, 1551, 22);
+INSERT INTO orders VALUES (130, 4470, 53);
+INSERT INTO orders VALUES (131, 2389, 84);
+INSERT INTO orders VALUES (132, 308, 18);
+INSERT INTO orders VALUES (133, 3227, 49);
+INSERT INTO orders VALUES (134, 1146, 80);
+INSERT INTO orders VALUES (135, 4065, 14);
+INSERT INTO orders VALUES (136, 1984, 45);
+INSERT INTO orders VALUES (137, 4903, 76);
+INSERT INTO orders VALUES (138, 2822, 10);
+INSERT INTO orders VALUES (139, 741, 41);
+INSERT INTO orders VALUES (140, 3660, 72);
+INSERT INTO orders VALUES (141, 1579, 6);
+INSERT INTO orders VALUES (142, 4498, 37);
+INSERT INTO orders VALUES (143, 2417, 68);
+INSERT INTO orders VALUES (144, 336, 2);
+INSERT INTO orders VALUES (145, 3255, 33);
+INSERT INTO orders VALUES (146, 1174, 64);
+INSERT INTO orders VALUES (147, 4093, 95);
+INSERT INTO orders VALUES (148, 2012, 29);
+INSERT INTO orders VALUES (149, 4931, 60);
+INSERT INTO orders VALUES (150, 2850, 91);
+INSERT INTO orders VALUES (151, 769, 25);
+INSERT INTO orders VALUES (152, 3688, 56);
+INSERT INTO orders VALUES (153, 1607, 87);
+INSERT INTO orders VALUES (154, 4526, 21);
+INSERT INTO orders VALUES (155, 2445, 52);
+INSERT INTO orders VALUES (156, 364, 83);
+INSERT INTO orders VALUES (157, 3283, 17);
+INSERT INTO orders VALUES (158, 1202, 48);
+INSERT INTO orders VALUES (159, 4121, 79);
+INSERT INTO orders VALUES (160, 2040, 13);
+INSERT INTO orders VALUES (161, 4959, 44);
+INSERT INTO orders VALUES (162, 2878, 75);
+INSERT INTO orders VALUES (163, 797, 9);
+INSERT INTO orders VALUES (164, 3716, 40);
+INSERT INTO orders VALUES (165, 1635, 71);
+INSERT INTO orders VALUES (166, 4554, 5);
+INSERT INTO orders VALUES (167, 2473, 36);
+INSERT INTO orders VALUES (168, 392, 67);
+INSERT INTO orders VALUES (169, 3311, 1);
+INSERT INTO orders VALUES (170, 1230, 32);
+INSERT INTO orders VALUES (171, 4149, 63);
+INSERT INTO orders VALUES (172, 2068, 94);
+INSERT INTO orders VALUES (173, 4987, 28);
+INSERT INTO orders VALUES (174, 2906, 59);
+INSERT INTO orders VALUES (175, 825, 90);
+INSERT INTO orders VALUES (176, 3744, 24);
+INSERT INTO orders VALUES (177, 1663, 55);
+INSERT INTO orders VALUES (178, 4582, 86);
+INSERT INTO orders VALUES (179, 2501, 20);
+INSERT INTO orders VALUES (180, 420, 51);
+INSERT INTO orders VALUES (181, 3339, 82);
+INSERT INTO orders VALUES (182, 1258, 16);
+INSERT INTO orders VALUES (183, 4177, 47);
+INSERT INTO orders VALUES (184, 2096, 78);
+INSERT INTO orders VALUES (185, 15, 12);
+INSERT INTO orders VALUES (186, 2934, 43);
+INSERT INTO orders VALUES (187, 853, 74);
+INSERT INTO orders VALUES (188, 3772, 8);
+INSERT INTO orders VALUES (189, 1691, 39);
+INSERT INTO orders VALUES (190, 4610, 70);
+INSERT INTO orders VALUES (191, 2529, 4);
+INSERT INTO orders VALUES (192, 448, 35);
+INSERT INTO orders VALUES (193, 3367, 66);
+INSERT INTO orders VALUES (194, 1286, 0);
+INSERT INTO orders VALUES (195, 4205, 31);
+INSERT INTO orders VALUES (196, 2124, 62);
+INSERT INTO orders VALUES (197, 43, 93);
+INSERT INTO orders VALUES (198, 2962, 27);
+INSERT INTO orders VALUES (199, 881, 58);
+INSERT INTO orders VALUES (200, 3800, 89);
+INSERT INTO orders VALUES (201, 1719, 23);
+INSERT INTO orders VALUES (202, 4638, 54);
+INSERT INTO orders VALUES (203, 2557, 85);
+INSERT INTO orders VALUES (204, 476, 19);
+INSERT INTO orders VALUES (205, 3395, 50);
+INSERT INTO orders VALUES (206, 1314, 81);
+INSERT INTO orders VALUES (207, 4233, 15);
+INSERT INTO orders VALUES (208, 2152, 46);
+INSERT INTO orders VALUES (209, 71, 77);
+INSERT INTO orders VALUES (210, 2990, 11);
+INSERT INTO orders VALUES (211, 909, 42);
+INSERT INTO orders VALUES (212, 3828, 73);
+INSERT INTO orders VALUES (213, 1747, 7);
+INSERT INTO orders VALUES (214, 4666, 38);
+INSERT INTO orders VALUES (215, 2585, 69);
+INSERT INTO orders VALUES (216, 504, 3);
+INSERT INTO orders VALUES (217, 3423, 34);
+INSERT INTO orders VALUES (218, 1342, 65);
+INSERT INTO orders VALUES (219, 4261, 96);
+INSERT INTO orders VALUES (220, 2180, 30);
+INSERT INTO orders VALUES (221, 99, 61);
+INSERT INTO orders VALUES (222, 3018, 92);
+INSERT INTO orders VALUES (223, 937, 26);
+INSERT INTO orders VALUES (224, 3856, 57);
+INSERT INTO orders VALUES (225, 1775, 88);
+INSERT INTO orders VALUES (226, 4694, 22);
+INSERT INTO orders VALUES (227, 2613, 53);
+INSERT INTO orders VALUES (228, 532, 84);
+INSERT INTO orders VALUES (229, 3451, 18);
+INSERT INTO orders VALUES (230, 1370, 49);
+INSERT INTO orders VALUES (231, 4289, 80);
+INSERT INTO orders VALUES (232, 2208, 14);
+INSERT INTO orders VALUES (233, 127, 45);
+INSERT INTO orders VALUES (234, 3046, 76);
+INSERT INTO orders VALUES (235, 965, 10);
+INSERT INTO orders VALUES (236, 3884, 41);
+INSERT INTO orders VALUES (237, 1803, 72);
+INSERT INTO orders VALUES (238, 4722, 6);
+INSERT INTO orders VALUES (239, 2641, 37);
+INSERT INTO orders VALUES (240, 560, 68);
+INSERT INTO orders VALUES (241, 3479, 2);
+INSERT INTO orders VALUES (242, 1398, 33);
+INSERT INTO orders VALUES (243, 4317, 64);
+INSERT INTO orders VALUES (244, 2236, 95);
+INSERT INTO orders VALUES (245, 155, 29);
+INSERT INTO orders VALUES (246, 3074, 60);
+INSERT INTO orders VALUES (247, 993, 91);
+INSERT INTO orders VALUES (248, 3912, 25);
+INSERT INTO orders VALUES (249, 1831, 56);
+INSERT INTO orders VALUES (250, 4750, 87);
+INSERT INTO orders VALUES (251, 2669, 21);
+INSERT INTO orders VALUES (252, 588, 52);
+INSERT INTO orders VALUES (253, 3507, 83);
+INSERT INTO orders VALUES (254, 1426, 17);
+INSERT INTO orders VALUES (255, 4345, 48);
+INSERT INTO orders VALUES (256, 2264, 79);
+INSERT INTO orders VALUES (257, 183, 13);
+INSERT INTO orders VALUES (258, 3102, 44);
+INSERT INTO orders VALUES (259, 1021, 75);
+INSERT INTO orders VALUES (260, 3940, 9);
+INSERT INTO orders VALUES (261, 1859, 40);
+INSERT INTO orders VALUES (262, 4778, 71);
+INSERT INTO orders VALUES (263, 2697, 5);
+INSERT INTO orders VALUES (264, 616, 36);
+INSERT INTO orders VALUES (265, 3535, 67);
+INSERT INTO orders VALUES (266, 1454, 1);
+INSERT INTO orders VALUES (267, 4373, 32);
+INSERT INTO orders VALUES (268, 2292, 63);
+INSERT INTO orders VALUES (269, 211, 94);
+INSERT INTO orders VALUES (270, 3130, 28);
+INSERT INTO orders VALUES (271, 1049, 59);
+INSERT INTO orders VALUES (272, 3968, 90);
+INSERT INTO orders VALUES (273, 1887, 24);
+INSERT INTO orders VALUES (274, 4806, 55);
+INSERT INTO orders VALUES (275, 2725, 86);
+INSERT INTO orders VALUES (276, 644, 20);
+INSERT INTO orders VALUES (277, 3563, 51);
+INSERT INTO orders VALUES (278, 1482, 82);
+INSERT INTO orders VALUES (279, 4401, 16);
+INSERT INTO orders VALUES (280, 2320, 47);
+INSERT INTO orders VALUES (281, 239, 78);
+INSERT INTO orders VALUES (282, 3158, 12);
+INSERT INTO orders VALUES (283, 1077, 43);
+INSERT INTO orders VALUES (284, 3996, 74);
+INSERT INTO orders VALUES (285, 1915, 8);
+INSERT INTO orders VALUES (286, 4834, 39);
+INSERT INTO orders VALUES (287, 2753, 70);
+INSERT INTO orders VALUES (288, 672, 4);
+INSERT INTO orders VALUES (289, 3591, 35);
+INSERT INTO orders VALUES (290, 1510, 66);
+INSERT INTO orders VALUES (291, 4429, 0);
+INSERT INTO orders VALUES (292, 2348, 31);
+INSERT INTO orders VALUES (293, 267, 62);
+INSERT INTO orders VALUES (294, 3186, 93);
+INSERT INTO orders VALUES (295, 1105, 27);
+INSERT INTO orders VALUES (296, 4024, 58);
+INSERT INTO orders VALUES (297, 1943, 89);
+INSERT INTO orders VALUES (298, 4862, 23);
+INSERT INTO orders VALUES (299, 2781, 54);
+INSERT INTO orders VALUES (300, 700, 85);
+INSERT INTO orders VALUES (301, 3619, 19);
+INSERT INTO orders VALUES (302, 1538, 50);
+INSERT INTO orders VALUES (303, 4457, 81);
+INSERT INTO orders VALUES (304, 2376, 15);
+INSERT INTO orders VALUES (305, 295, 46);
+INSERT INTO orders VALUES (306, 3214, 77);
+INSERT INTO orders VALUES (307, 1133, 11);
+INSERT INTO orders VALUES (308, 4052, 42);
+INSERT INTO orders VALUES (309, 1971, 73);
+INSERT INTO orders VALUES (310, 4890, 7);
+INSERT INTO orders VALUES (311, 2809, 38);
+INSERT INTO orders VALUES (312, 728, 69);
+INSERT INTO orders VALUES (313, 3647, 3);
+INSERT INTO orders VALUES (314, 1566, 34);
+INSERT INTO orders VALUES (315, 4485, 65);
+INSERT INTO orders VALUES (316, 2404, 96);
+INSERT INTO orders VALUES (317, 323, 30);
+INSERT INTO orders VALUES (318, 3242, 61);
+INSERT INTO orders VALUES (319, 1161, 92);
+INSERT INTO orders VALUES (320, 4080, 26);
+INSERT INTO orders VALUES (321, 1999, 57);
+INSERT INTO orders VALUES (322, 4918, 88);
+INSERT INTO orders VALUES (323, 2837, 22);
+INSERT INTO orders VALUES (324, 756, 53);
+INSERT INTO orders VALUES (325, 3675, 84);
+INSERT INTO orders VALUES (326, 1594, 18);
+INSERT INTO orders VALUES (327, 4513, 49);
+INSERT INTO orders VALUES (328, 2432, 80);
+INSERT INTO orders VALUES (329, 351, 14);
+INSERT INTO orders VALUES (330, 3270, 45);
+INSERT INTO orders VALUES (331, 1189, 76);
+INSERT INTO orders VALUES (332, 4108, 10);
+INSERT INTO orders VALUES (333, 2027, 41);
+INSERT INTO orders VALUES (334, 4946, 72);
+INSERT INTO orders VALUES (335, 2865, 6);
+INSERT INTO orders VALUES (336, 784, 37);
+INSERT INTO orders VALUES (337, 3703, 68);
+INSERT INTO orders VALUES (338, 1622, 2);
+INSERT INTO orders VALUES (339, 4541, 33);
+INSERT INTO orders VALUES (340, 2460, 64);
+INSERT INTO orders VALUES (341, 379, 95);
+INSERT INTO orders VALUES (342, 3298, 29);
+INSERT INTO orders VALUES (343, 1217, 60);
+INSERT INTO orders VALUES (344, 4136, 91);
+INSERT INTO orders VALUES (345, 2055, 25);
+INSERT INTO orders VALUES (346, 4974, 56);
+INSERT INTO orders VALUES (347, 2893, 87);
+INSERT INTO orders VALUES (348, 812, 21);
+INSERT INTO orders VALUES (349, 3731, 52);
+INSERT INTO orders VALUES (350, 1650, 83);
+INSERT INTO orders VALUES (351, 4569, 17);
+INSERT INTO orders VALUES (352, 2488, 48);
+INSERT INTO orders VALUES (353, 407, 79);
+INSERT INTO orders VALUES (354, 3326, 13);
+INSERT INTO orders VALUES (355, 1245, 44);
+INSERT INTO orders VALUES (356, 4164, 75);
+INSERT INTO orders VALUES (357, 2083, 9);
+INSERT INTO orders VALUES (358, 2, 40);
+INSERT INTO orders VALUES (359, 2921, 71);
+INSERT INTO orders VALUES (360, 840, 5);
+INSERT INTO orders VALUES (361, 3759, 36);
+INSERT INTO orders VALUES (362, 1678, 67);
+INSERT INTO orders VALUES (363, 4597, 1);
+INSERT INTO orders VALUES (364, 2516, 32);
+INSERT INTO orders VALUES (365, 435, 63);
+INSERT INTO orders VALUES (366, 3354, 94);
+INSERT INTO orders VALUES (367, 1273, 28);
+INSERT INTO orders VALUES (368, 4192, 59);
+INSERT INTO orders VALUES (369, 2111, 90);
+INSERT INTO orders VALUES (370, 30, 24);
+INSERT INTO orders VALUES (371, 2949, 55);
+INSERT INTO orders VALUES (372, 868, 86);
+INSERT INTO orders VALUES (373, 3787, 20);
+INSERT INTO orders VALUES (374, 1706, 51);
+INSERT INTO orders VALUES (375, 4625, 82);
+INSERT INTO orders VALUES (376, 2544, 16);
+INSERT INTO orders VALUES (377, 463, 47);
+INSERT INTO orders VALUES (378, 3382, 78);
+INSERT INTO orders VALUES (379, 1301, 12);
+INSERT INTO orders VALUES (380, 4220, 43);
+INSERT INTO orders VALUES (381, 2139, 74);
+INSERT INTO orders VALUES (382, 58, 8);
+INSERT INTO orders VALUES (383, 2977, 39);
+INSERT INTO orders VALUES (384, 896, 70);
+INSERT INTO orders VALUES (385, 3815, 4);
+INSERT INTO orders VALUES (386, 1734, 35);
+INSERT INTO orders VALUES (387, 4653, 66);
+INSERT INTO orders VALUES (388, 2572, 0);
+INSERT INTO orders VALUES (389, 491, 31);
+INSERT INTO orders VALUES (390, 3410, 62);
+INSERT INTO orders VALUES (391, 1329, 93);
+INSERT INTO orders VALUES (392, 4248, 27);
+INSERT INTO orders VALUES (393, 2167, 58);
+INSERT INTO orders VALUES (394, 86, 89);
+INSERT INTO orders VALUES (395, 3005, 23);
+INSERT INTO orders VALUES (396, 924, 54);
+INSERT INTO orders VALUES (397, 3843, 85);
+INSERT INTO orders VALUES (398, 1762, 19);
+INSERT INTO orders VALUES (399, 4681, 50);
+INSERT INTO orders VALUES (400, 2600, 81);
+INSERT INTO orders VALUES (401, 519, 15);
+INSERT INTO orders VALUES (402, 3438, 46);
+INSERT INTO orders VALUES (403, 1357, 77);
+INSERT INTO orders VALUES (404, 4276, 11);
+INSERT INTO orders VALUES (405, 2195, 42);
+INSERT INTO orders VALUES (406, 114, 73);
+INSERT INTO orders VALUES (407, 3033, 7);
+INSERT INTO orders VALUES (408, 952, 38);
+INSERT INTO orders VALUES (409, 3871, 69);
+INSERT INTO orders VALUES (410, 1790, 3);
+INSERT INTO orders VALUES (411, 4709, 34);
+INSERT INTO orders VALUES (412, 2628, 65);
+INSERT INTO orders VALUES (413, 547, 96);
+INSERT INTO orders VALUES (414, 3466, 30);
+INSERT INTO orders VALUES (415, 1385, 61);
+INSERT INTO orders VALUES (416, 4304, 92);
+INSERT INTO orders VALUES (417, 2223, 26);
+INSERT INTO orders VALUES (418, 142, 57);
+INSERT INTO orders VALUES (419, 3061, 88);
+INSERT INTO orders VALUES (420, 980, 22);
+INSERT INTO orders VALUES (421, 3899, 53);
+INSERT INTO orders VALUES (422, 1818, 84);
+INSERT INTO orders VALUES (423, 4737, 18);
+INSERT INTO orders VALUES (424, 2656, 49);
+INSERT INTO orders VALUES (425, 575, 80);
+INSERT INTO orders VALUES (426, 3494, 14);
+INSERT INTO orders VALUES (427, 1413, 45);
+INSERT INTO orders VALUES (428, 4332, 76);
+INSERT INTO orders VALUES (429, 2251, 10);
+INSERT INTO orders VALUES (430, 170, 41);
+INSERT INTO orders VALUES (431, 3089, 72);
+INSERT INTO orders VALUES (432, 1008, 6);
+INSERT INTO orders VALUES (433, 3927, 37);
+INSERT INTO orders VALUES (434, 1846, 68);
+INSERT INTO orders VALUES (435, 4765, 2);
+INSERT INTO orders VALUES (436, 2684, 33);
+INSERT INTO orders VALUES (437, 603, 64);
+INSERT INTO orders VALUES (438, 3522, 95);
+INSERT INTO orders VALUES (439, 1441, 29);
+INSERT INTO orders VALUES (440, 4360, 60);
+INSERT INTO orders VALUES (441, 2279, 91);
+INSERT INTO orders VALUES (442, 198, 25);
+INSERT INTO orders VALUES (443, 3117, 56);
+INSERT INTO orders VALUES (444, 1036, 87);
+INSERT INTO orders VALUES (445, 3955, 21);
+INSERT INTO orders VALUES (446, 1874, 52);
+INSERT INTO orders VALUES (447, 4793, 83);
+INSERT INTO orders VALUES (448, 2712, 17);
+INSERT INTO orders VALUES (449, 631, 48);
+INSERT INTO orders VALUES (450, 3550, 79);
+INSERT INTO orders VALUES (451, 1469, 13);
+INSERT INTO orders VALUES (452, 4388, 44);
+INSERT INTO orders VALUES (453, 2307, 75);
+INSERT INTO orders VALUES (454, 226, 9);
+INSERT INTO orders VALUES (455, 3145, 40);
+INSERT INTO orders VALUES (456, 1064, 71);
+INSERT INTO orders VALUES (457, 3983, 5);
+INSERT INTO orders VALUES (458, 1902, 36);
+INSERT INTO orders VALUES (459, 4821, 67);
+INSERT INTO orders VALUES (460, 2740, 1);
+INSERT INTO orders VALUES (461, 659, 32);
+INSERT INTO orders VALUES (462, 3578, 63);
+INSERT INTO orders VALUES (463, 1497, 94);
+INSERT INTO orders VALUES (464, 4416, 28);
+INSERT INTO orders VALUES (465, 2335, 59);
+INSERT INTO orders VALUES (466, 254, 90);
+INSERT INTO orders VALUES (467, 3173, 24);
+INSERT INTO orders VALUES (468, 1092, 55);
+INSERT INTO orders VALUES (469, 4011, 86);
+INSERT INTO orders VALUES (470, 1930, 20);
+INSERT INTO orders VALUES (471, 4849, 51);
+INSERT INTO orders VALUES (472, 2768, 82);
+INSERT INTO orders VALUES (473, 687, 16);
+INSERT INTO orders VALUES (474, 3606, 47);
+INSERT INTO orders VALUES (475, 1525, 78);
+INSERT INTO orders VALUES (476, 4444, 12);
+INSERT INTO orders VALUES (477, 2363, 43);
+INSERT INTO orders VALUES (478, 282, 74);
+INSERT INTO orders VALUES (479, 3201, 8);
+INSERT INTO orders VALUES (480, 1120, 39);
+INSERT INTO orders VALUES (481, 4039, 70);
+INSERT INTO orders VALUES (482, 1958, 4);
+INSERT INTO orders VALUES (483, 4877, 35);
+INSERT INTO orders VALUES (484, 2796, 66);
+INSERT INTO orders VALUES (485, 715, 0);
+INSERT INTO orders VALUES (486, 3634, 31);
+INSERT INTO orders VALUES (487, 1553, 62);
+INSERT INTO orders VALUES (488, 4472, 93);
+INSERT INTO orders VALUES (489, 2391, 27);
+INSERT INTO orders VALUES (490, 310, 58);
+INSERT INTO orders VALUES (491, 3229, 89);
+INSERT INTO orders VALUES (492, 1148, 23);
+INSERT INTO orders VALUES (493, 4067, 54);
+INSERT INTO orders VALUES (494, 1986, 85);
+INSERT INTO orders VALUES (495, 4905, 19);
+INSERT INTO orders VALUES (496, 2824, 50);
+INSERT INTO orders VALUES (497, 743, 81);
+INSERT INTO orders VALUES (498, 3662, 15);
+INSERT INTO orders VALUES (499, 1581, 46);
+INSERT INTO orders VALUES (500, 4500, 77);
+INSERT INTO orders VALUES (501, 2419, 11);
+INSERT INTO orders VALUES (502, 338, 42);
+INSERT INTO orders VALUES (503, 3257, 73);
+INSERT INTO orders VALUES (504, 1176, 7);
+INSERT INTO orders VALUES (505, 4095, 38);
+INSERT INTO orders VALUES (506, 2014, 69);
+INSERT INTO orders VALUES (507, 4933, 3);
+INSERT INTO orders VALUES (508, 2852, 34);
+INSERT INTO orders VALUES (509, 771, 65);
+INSERT INTO orders VALUES (510, 3690, 96);
+INSERT INTO orders VALUES (511, 1609, 30);
+INSERT INTO orders VALUES (512, 4528, 61);
+INSERT INTO orders VALUES (513, 2447, 92);
+INSERT INTO orders VALUES (514, 366, 26);
+INSERT INTO orders VALUES (515, 3285, 57);
+INSERT INTO orders VALUES (516, 1204, 88);
+INSERT INTO orders VALUES (517, 4123, 22);
+INSERT INTO orders VALUES (518, 2042, 53);
+INSERT INTO orders VALUES (519, 4961, 84);
+INSERT INTO orders VALUES (520, 2880, 18);
+INSERT INTO orders VALUES (521, 799, 49);
+INSERT INTO orders VALUES (522, 3718, 80);
+INSERT INTO orders VALUES (523, 1637, 14);
+INSERT INTO orders VALUES (524, 4556, 45);
+INSERT INTO orders VALUES (525, 2475, 76);
+INSERT INTO orders VALUES (526, 394, 10);
+INSERT INTO orders VALUES (527, 3313, 41);
+INSERT INTO orders VALUES (528, 1232, 72);
+INSERT INTO orders VALUES (529, 4151, 6);
+INSERT INTO orders VALUES (530, 2070, 37);
+INSERT INTO orders VALUES (531, 4989, 68);
+INSERT INTO orders VALUES (532, 2908, 2);
+INSERT INTO orders VALUES (533, 827, 33);
+INSERT INTO orders VALUES (534, 3746, 64);
+INSERT INTO orders VALUES (535, 1665, 95);
+INSERT INTO orders VALUES (536, 4584, 29);
+INSERT INTO orders VALUES (537, 2503, 60);
+INSERT INTO orders VALUES (538, 422, 91);
+INSERT INTO orders VALUES (539, 3341, 25);
+INSERT INTO orders VALUES (540, 1260, 56);
+INSERT INTO orders VALUES (541, 4179, 87);
+INSERT INTO orders VALUES (542, 2098, 21);
+INSERT INTO orders VALUES (543, 17, 52);
+INSERT INTO orders VALUES (544, 2936, 83);
+INSERT INTO orders VALUES (545, 855, 17);
+INSERT INTO orders VALUES (546, 3774, 48);
+INSERT INTO orders VALUES (547, 1693, 79);
+INSERT INTO orders VALUES (548, 4612, 13);
+INSERT INTO orders VALUES (549, 2531, 44);
+INSERT INTO orders VALUES (550, 450, 75);
+INSERT INTO orders VALUES (551, 3369, 9);
+INSERT INTO orders VALUES (552, 1288, 40);
+INSERT INTO orders VALUES (553, 4207, 71);
+INSERT INTO orders VALUES (554, 2126, 5);
+INSERT INTO orders VALUES (555, 45, 36);
+INSERT INTO orders VALUES (556, 2964, 67);
+INSERT INTO orders VALUES (557, 883, 1);
+INSERT INTO orders VALUES (558, 3802, 32);
+INSERT INTO orders VALUES (559, 1721, 63);
+INSERT INTO orders VALUES (560, 4640, 94);
+INSERT INTO orders VALUES (561, 2559, 28);
+INSERT INTO orders VALUES (562, 478, 59);
+INSERT INTO orders VALUES (563, 3397, 90);
+INSERT INTO orders VALUES (564, 1316, 24);
+INSERT INTO orders VALUES (565, 4235, 55);
+INSERT INTO orders VALUES (566, 2154, 86);
+INSERT INTO orders VALUES (567, 73, 20);
+INSERT INTO orders VALUES (568, 2992, 51);
+INSERT INTO orders VALUES (569, 911, 82);
+INSERT INTO orders VALUES (570, 3830, 16);
+INSERT INTO orders VALUES (571, 1749, 47);
+INSERT INTO orders VALUES (572, 4668, 78);
+INSERT INTO orders VALUES (573, 2587, 12);
+INSERT INTO orders VALUES (574, 506, 43);
+INSERT INTO orders VALUES (575, 3425, 74);
+INSERT INTO orders VALUES (576, 1344, 8);
+INSERT INTO orders VALUES (577, 4263, 39);
+INSERT INTO orders VALUES (578, 2182, 70);
+INSERT INTO orders VALUES (579, 101, 4);
+INSERT INTO orders VALUES (580, 3020, 35);
+INSERT INTO orders VALUES (581, 939, 66);
+INSERT INTO orders VALUES (582, 3858, 0);
+INSERT INTO orders VALUES (583, 1777, 31);
+INSERT INTO orders VALUES (584, 4696, 62);
+INSERT INTO orders VALUES (585, 2615, 93);
+INSERT INTO orders VALUES (586, 534, 27);
+INSERT INTO orders VALUES (587, 3453, 58);
+INSERT INTO orders VALUES (588, 1372, 89);
+INSERT INTO orders VALUES (589, 4291, 23);
+INSERT INTO orders VALUES (590, 2210, 54);
+INSERT INTO orders VALUES (591, 129, 85);
+INSERT INTO orders VALUES (592, 3048, 19);
+INSERT INTO orders VALUES (593, 967, 50);
+INSERT INTO orders VALUES (594, 3886, 81);
+INSERT INTO orders VALUES (595, 1805, 15);
+INSERT INTO orders VALUES (596, 4724, 46);
+INSERT INTO orders VALUES (597, 2643, 77);
+INSERT INTO orders VALUES (598, 562, 11);
+INSERT INTO orders VALUES (599, 3481, 42);
+INSERT INTO orders VALUES (600, 1400, 73);
+INSERT INTO orders VALUES (601, 4319, 7);
+INSERT INTO orders VALUES (602, 2238, 38);
+INSERT INTO orders VALUES (603, 157, 69);
+INSERT INTO orders VALUES (604, 3076, 3);
+INSERT INTO orders VALUES (605, 995, 34);
+INSERT INTO orders VALUES (606, 3914, 65);
+INSERT INTO orders VALUES (607, 1833, 96);
+INSERT INTO orders VALUES (608, 4752, 30);
+INSERT INTO orders VALUES (609, 2671, 61);
+INSERT INTO orders VALUES (610, 590, 92);
+INSERT INTO orders VALUES (611, 3509, 26);
+INSERT INTO orders VALUES (612, 1428, 57);
+INSERT INTO orders VALUES (613, 4347, 88);
+INSERT INTO orders VALUES (614, 2266, 22);
+INSERT INTO orders VALUES (615, 185, 53);
+INSERT INTO orders VALUES (616, 3104, 84);
+INSERT INTO orders VALUES (617, 1023, 18);
+INSERT INTO orders VALUES (618, 3942, 49);
+INSERT INTO orders VALUES (619, 1861, 80);
+INSERT INTO orders VALUES (620, 4780, 14);
+INSERT INTO orders VALUES (621, 2699, 45);
+INSERT INTO orders VALUES (622, 618, 76);
+INSERT INTO orders VALUES (623, 3537, 10);
+INSERT INTO orders VALUES (624, 1456, 41);
+INSERT INTO orders VALUES (625, 4375, 72);
+INSERT INTO orders VALUES (626, 2294, 6);
+INSERT INTO orders VALUES (627, 213, 37);
+INSERT INTO orders VALUES (628, 3132, 68);
+INSERT INTO orders VALUES (629, 1051, 2);
+INSERT INTO orders VALUES (630, 3970, 33);
+INSERT INTO orders VALUES (631, 1889, 64);
+INSERT INTO orders VALUES (632, 4808, 95);
+INSERT INTO orders VALUES (633, 2727, 29);
+INSERT INTO orders VALUES (634, 646, 60);
+INSERT INTO orders VALUES (635, 3565, 91);
+INSERT INTO orders VALUES (636, 1484, 25);
+INSERT INTO orders VALUES (637, 4403, 56);
+INSERT INTO orders VALUES (638, 2322, 87);
+INSERT INTO orders VALUES (639, 241, 21);
+INSERT INTO orders VALUES (640, 3160, 52);
+INSERT INTO orders VALUES (641, 1079, 83);
+INSERT INTO orders VALUES (642, 3998, 17);
+INSERT INTO orders VALUES (643, 1917, 48);
+INSERT INTO orders VALUES (644, 4836, 79);
+INSERT INTO orders VALUES (645, 2755, 13);
+INSERT INTO orders VALUES (646, 674, 44);
+INSERT INTO orders VALUES (647, 3593, 75);
+INSERT INTO orders VALUES (648, 1512, 9);
+INSERT INTO orders VALUES (649, 4431, 40);
+INSERT INTO orders VALUES (650, 2350, 71);
+INSERT INTO orders VALUES (651, 269, 5);
+INSERT INTO orders VALUES (652, 3188, 36);
+INSERT INTO orders VALUES (653, 1107, 67);
+INSERT INTO orders VALUES (654, 4026, 1);
+INSERT INTO orders VALUES (655, 1945, 32);
+INSERT INTO orders VALUES (656, 4864, 63);
+INSERT INTO orders VALUES (657, 2783, 94);
+INSERT INTO orders VALUES (658, 702, 28);
+INSERT INTO orders VALUES (659, 3621, 59);
+INSERT INTO orders VALUES (660, 1540, 90);
+INSERT INTO orders VALUES (661, 4459, 24);
+INSERT INTO orders VALUES (662, 2378, 55);
+INSERT INTO orders VALUES (663, 297, 86);
+INSERT INTO orders VALUES (664, 3216, 20);
+INSERT INTO orders VALUES (665, 1135, 51);
+INSERT INTO orders VALUES (666, 4054, 82);
+INSERT INTO orders VALUES (667, 1973, 16);
+INSERT INTO orders VALUES (668, 4892, 47);
+INSERT INTO orders VALUES (669, 2811, 78);
+INSERT INTO orders VALUES (670, 730, 12);
+INSERT INTO orders VALUES (671, 3649, 43);
+INSERT INTO orders VALUES (672, 1568, 74);
+INSERT INTO orders VALUES (673, 4487, 8);
+INSERT INTO orders VALUES (674, 2406, 39);
+INSERT INTO orders VALUES (675, 325, 70);
+INSERT INTO orders VALUES (676, 3244, 4);
+INSERT INTO orders VALUES (677, 1163, 35);
+INSERT INTO orders VALUES (678, 4082, 66);
+INSERT INTO orders VALUES (679, 2001, 0);
+INSERT INTO orders VALUES (680, 4920, 31);
+INSERT INTO orders VALUES (681, 2839, 62);
+INSERT INTO orders VALUES (682, 758, 93);
+INSERT INTO orders VALUES (683, 3677, 27);
+INSERT INTO orders VALUES (684, 1596, 58);
+INSERT INTO orders VALUES (685, 4515, 89);
+INSERT INTO orders VALUES (686, 2434, 23);
+INSERT INTO orders VALUES (687, 353, 54);
+INSERT INTO orders VALUES (688, 3272, 85);
+INSERT INTO orders VALUES (689, 1191, 19);
+INSERT INTO orders VALUES (690, 4110, 50);
+INSERT INTO orders VALUES (691, 2029, 81);
+INSERT INTO orders VALUES (692, 4948, 15);
+INSERT INTO orders VALUES (693, 2867, 46);
+INSERT INTO orders VALUES (694, 786, 77);
+INSERT INTO orders VALUES (695, 3705, 11);
+INSERT INTO orders VALUES (696, 1624, 42);
+INSERT INTO orders VALUES (697, 4543, 73);
+INSERT INTO orders VALUES (698, 2462, 7);
+INSERT INTO orders VALUES (699, 381, 38);
+INSERT INTO orders VALUES (700, 3300, 69);
+INSERT INTO orders VALUES (701, 1219, 3);
+INSERT INTO orders VALUES (702, 4138, 34);
+INSERT INTO orders VALUES (703, 2057, 65);
+INSERT INTO orders VALUES (704, 4976, 96);
+INSERT INTO orders VALUES (705, 2895, 30);
+INSERT INTO orders VALUES (706, 814, 61);
+INSERT INTO orders VALUES (707, 3733, 92);
+INSERT INTO orders VALUES (708, 1652, 26);
+INSERT INTO orders VALUES (709, 4571, 57);
+INSERT INTO orders VALUES (710, 2490, 88);
+INSERT INTO orders VALUES (711, 409, 22);
+INSERT INTO orders VALUES (712, 3328, 53);
+INSERT INTO orders VALUES (713, 1247, 84);
+INSERT INTO orders VALUES (714, 4166, 18);
+INSERT INTO orders VALUES (715, 2085, 49);
+INSERT INTO orders VALUES (716, 4, 80);
+INSERT INTO orders VALUES (717, 2923, 14);
+INSERT INTO orders VALUES (718, 842, 45);
+INSERT INTO orders VALUES (719, 3761, 76);
+INSERT INTO orders VALUES (720, 1680, 10);
+INSERT INTO orders VALUES (721, 4599, 41);
+INSERT INTO orders VALUES (722, 2518, 72);
+INSERT INTO orders VALUES (723, 437, 6);
+INSERT INTO orders VALUES (724, 3356, 37);
+INSERT INTO orders VALUES (725, 1275, 68);
+INSERT INTO orders VALUES (726, 4194, 2);
+INSERT INTO orders VALUES (727, 2113, 33);
+INSERT INTO orders VALUES (728, 32, 64);
+INSERT INTO orders VALUES (729, 2951, 95);
+INSERT INTO orders VALUES (730, 870, 29);
+INSERT INTO orders VALUES (731, 3789, 60);
+INSERT INTO orders VALUES (732, 1708, 91);
+INSERT INTO orders VALUES (733, 4627, 25);
+INSERT INTO orders VALUES (734, 2546, 56);
+INSERT INTO orders VALUES (735, 465, 87);
+INSERT INTO orders VALUES (736, 3384, 21);
+INSERT INTO orders VALUES (737, 1303, 52);
+INSERT INTO orders VALUES (738, 4222, 83);
+INSERT INTO orders VALUES (739, 2141, 17);
+INSERT INTO orders VALUES (740, 60, 48);
+INSERT INTO orders VALUES (741, 2979, 79);
+INSERT INTO orders VALUES (742, 898, 13);
+INSERT INTO orders VALUES (743, 3817, 44);
+INSERT INTO orders VALUES (744, 1736, 75);
+INSERT INTO orders VALUES (745, 4655, 9);
+INSERT INTO orders VALUES (746, 2574, 40);
+INSERT INTO orders VALUES (747, 493, 71);
+INSERT INTO orders VALUES (748, 3412, 5);
+INSERT INTO orders VALUES (749, 1331, 36);
+INSERT INTO orders VALUES (750, 4250, 67);
+INSERT INTO orders VALUES (751, 2169, 1);
+INSERT INTO orders VALUES (752, 88, 32);
+INSERT INTO orders VALUES (753, 3007, 63);
+INSERT INTO orders VALUES (754, 926, 94);
+INSERT INTO orders VALUES (755, 3845, 28);
+INSERT INTO orders VALUES (756, 1764, 59);
+INSERT INTO orders VALUES (757, 4683, 90);
+INSERT INTO orders VALUES (758, 2602, 24);
+INSERT INTO orders VALUES (759, 521, 55);
+INSERT INTO orders VALUES (760, 3440, 86);
+INSERT INTO orders VALUES (761, 1359, 20);
+INSERT INTO orders VALUES (762, 4278, 51);
+INSERT INTO orders VALUES (763, 2197, 82);
+INSERT INTO orders VALUES (764, 116, 16);
+INSERT INTO orders VALUES (765, 3035, 47);
+INSERT INTO orders VALUES (766, 954, 78);
+INSERT INTO orders VALUES (767, 3873, 12);
+INSERT INTO orders VALUES (768, 1792, 43);
+INSERT INTO orders VALUES (769, 4711, 74);
+INSERT INTO orders VALUES (770, 2630, 8);
+INSERT INTO orders VALUES (771, 549, 39);
+INSERT INTO orders VALUES (772, 3468, 70);
+INSERT INTO orders VALUES (773, 1387, 4);
+INSERT INTO orders VALUES (774, 4306, 35);
+INSERT INTO orders VALUES (775, 2225, 66);
+INSERT INTO orders VALUES (776, 144, 0);
+INSERT INTO orders VALUES (777, 3063, 31);
+INSERT INTO orders VALUES (778, 982, 62);
+INSERT INTO orders VALUES (779, 3901, 93);
+INSERT INTO orders VALUES (780, 1820, 27);
+INSERT INTO orders VALUES (781, 4739, 58);
+INSERT INTO orders VALUES (782, 2658, 89);
+INSERT INTO orders VALUES (783, 577, 23);
+INSERT INTO orders VALUES (784, 3496, 54);
+INSERT INTO orders VALUES (785, 1415, 85);
+INSERT INTO orders VALUES (786, 4334, 19);
+INSERT INTO orders VALUES (787, 2253, 50);
+INSERT INTO orders VALUES (788, 172, 81);
+INSERT INTO orders VALUES (789, 3091, 15);
+INSERT INTO orders VALUES (790, 1010, 46);
+INSERT INTO orders VALUES (791, 3929, 77);
+INSERT INTO orders VALUES (792, 1848, 11);
+INSERT INTO orders VALUES (793, 4767, 42);
+INSERT INTO orders VALUES (794, 2686, 73);
+INSERT INTO orders VALUES (795, 605, 7);
+INSERT INTO orders VALUES (796, 3524, 38);
+INSERT INTO orders VALUES (797, 1443, 69);
+INSERT INTO orders VALUES (798, 4362, 3);
+INSERT INTO orders VALUES (799, 2281, 34);
+INSERT INTO orders VALUES (800, 200, 65);
+INSERT INTO orders VALUES (801, 3119, 96);
+INSERT INTO orders VALUES (802, 1038, 30);
+INSERT INTO orders VALUES (803, 3957, 61);
+INSERT INTO orders VALUES (804, 1876, 92);
+INSERT INTO orders VALUES (805, 4795, 26);
+INSERT INTO orders VALUES (806, 2714, 57);
+INSERT INTO orders VALUES (807, 633, 88);
+INSERT INTO orders VALUES (808, 3552, 22);
+INSERT INTO orders VALUES (809, 1471, 53);
+INSERT INTO orders VALUES (810, 4390, 84);
+INSERT INTO orders VALUES (811, 2309, 18);
+INSERT INTO orders VALUES (812, 228, 49);
+INSERT INTO orders VALUES (813, 3147, 80);
+INSERT INTO orders VALUES (814, 1066, 14);
+INSERT INTO orders VALUES (815, 3985, 45);
+INSERT INTO orders VALUES (816, 1904, 76);
+INSERT INTO orders VALUES (817, 4823, 10);
+INSERT INTO orders VALUES (818, 2742, 41);
+INSERT INTO orders VALUES (819, 661, 72);
+INSERT INTO orders VALUES (820, 3580, 6);
+INSERT INTO orders VALUES (821, 1499, 37);
+INSERT INTO orders VALUES (822, 4418, 68);
+INSERT INTO orders VALUES (823, 2337, 2);
+INSERT INTO orders VALUES (824, 256, 33);
+INSERT INTO orders VALUES (825, 3175, 64);
+INSERT INTO orders VALUES (826, 1094, 95);
+INSERT INTO orders VALUES (827, 4013, 29);
+INSERT INTO orders VALUES (828, 1932, 60);
+INSERT INTO orders VALUES (829, 4851, 91);
+INSERT INTO orders VALUES (830, 2770, 25);
+INSERT INTO orders VALUES (831, 689, 56);
+INSERT INTO orders VALUES (832, 3608, 87);
+INSERT INTO orders VALUES (833, 1527, 21);
+INSERT INTO orders VALUES (834, 4446, 52);
+INSERT INTO orders VALUES (835, 2365, 83);
+INSERT INTO orders VALUES (836, 284, 17);
+INSERT INTO orders VALUES (837, 3203, 48);
+INSERT INTO orders VALUES (838, 1122, 79);
+INSERT INTO orders VALUES (839, 4041, 13);
+INSERT INTO orders VALUES (840, 1960, 44);
+INSERT INTO orders VALUES (841, 4879, 75);
+INSERT INTO orders VALUES (842, 2798, 9);
+INSERT INTO orders VALUES (843, 717, 40);
+INSERT INTO orders VALUES (844, 3636, 71);
+INSERT INTO orders VALUES (845, 1555, 5);
+INSERT INTO orders VALUES (846, 4474, 36);
+INSERT INTO orders VALUES (847, 2393, 67);
+INSERT INTO orders VALUES (848, 312, 1);
+INSERT INTO orders VALUES (849, 3231, 32);
+INSERT INTO orders VALUES (850, 1150, 63);
+INSERT INTO orders VALUES (851, 4069, 94);
+INSERT INTO orders VALUES (852, 1988, 28);
+INSERT INTO orders VALUES (853, 4907, 59);
+INSERT INTO orders VALUES (854, 2826, 90);
+INSERT INTO orders VALUES (855, 745, 24);
+INSERT INTO orders VALUES (856, 3664, 55);
+INSERT INTO orders VALUES (857, 1583, 86);
+INSERT INTO orders VALUES (858, 4502, 20);
+INSERT INTO orders VALUES (859, 2421, 51);
+INSERT INTO orders VALUES (860, 340, 82);
+INSERT INTO orders VALUES (861, 3259, 16);
+INSERT INTO orders VALUES (862, 1178, 47);
+INSERT INTO orders VALUES (863, 4097, 78);
+INSERT INTO orders VALUES (864, 2016, 12);
+INSERT INTO orders VALUES (865, 4935, 43);
+INSERT INTO orders VALUES (866, 2854, 74);
+INSERT INTO orders VALUES (867, 773, 8);
+INSERT INTO orders VALUES (868, 3692, 39);
+INSERT INTO orders VALUES (869, 1611, 70);
+INSERT INTO orders VALUES (870, 4530, 4);
+INSERT INTO orders VALUES (871, 2449, 35);
+INSERT INTO orders VALUES (872, 368, 66);
+INSERT INTO orders VALUES (873, 3287, 0);
+INSERT INTO orders VALUES (874, 1206, 31);
+INSERT INTO orders VALUES (875, 4125, 62);
+INSERT INTO orders VALUES (876, 2044, 93);
+INSERT INTO orders VALUES (877, 4963, 27);
+INSERT INTO orders VALUES (878, 2882, 58);
+INSERT INTO orders VALUES (879, 801, 89);
+INSERT INTO orders VALUES (880, 3720, 23);
+INSERT INTO orders VALUES (881, 1639, 54);
+INSERT INTO orders VALUES (882, 4558, 85);
+INSERT INTO orders VALUES (883, 2477, 19);
+INSERT INTO orders VALUES (884, 396, 50);
+INSERT INTO orders VALUES (885, 3315, 81);
+INSERT INTO orders VALUES (886, 1234, 15);
+INSERT INTO orders VALUES (887, 4153, 46);
+INSERT INTO orders VALUES (888, 2072, 77);
+INSERT INTO orders VALUES (889, 4991, 11);
+INSERT INTO orders VALUES (890, 2910, 42);
+INSERT INTO orders VALUES (891, 829, 73);
+INSERT INTO orders VALUES (892, 3748, 7);
+INSERT INTO orders VALUES (893, 1667, 38);
+INSERT INTO orders VALUES (894, 4586, 69);
+INSERT INTO orders VALUES (895, 2505, 3);
+INSERT INTO orders VALUES (896, 424, 34);
+INSERT INTO orders VALUES (897, 3343, 65);
+INSERT INTO orders VALUES (898, 1262, 96);
+INSERT INTO orders VALUES (899, 4181, 30);
+INSERT INTO orders VALUES (900, 2100, 61);
+INSERT INTO orders VALUES (901, 19, 92);
+INSERT INTO orders VALUES (902, 2938, 26);
+INSERT INTO orders VALUES (903, 857, 57);
+INSERT INTO orders VALUES (904, 3776, 88);
+INSERT INTO orders VALUES (905, 1695, 22);
+INSERT INTO orders VALUES (906, 4614, 53);
+INSERT INTO orders VALUES (907, 2533, 84);
+INSERT INTO orders VALUES (908, 452, 18);
+INSERT INTO orders VALUES (909, 3371, 49);
+INSERT INTO orders VALUES (910, 1290, 80);
+INSERT INTO orders VALUES (911, 4209, 14);
+INSERT INTO orders VALUES (912, 2128, 45);
+INSERT INTO orders VALUES (913, 47, 76);
+INSERT INTO orders VALUES (914, 2966, 10);
+INSERT INTO orders VALUES (915, 885, 41);
+INSERT INTO orders VALUES (916, 3804, 72);
+INSERT INTO orders VALUES (917, 1723, 6);
+INSERT INTO orders VALUES (918, 4642, 37);
+INSERT INTO orders VALUES (919, 2561, 68);
+INSERT INTO orders VALUES (920, 480, 2);
+INSERT INTO orders VALUES (921, 3399, 33);
+INSERT INTO orders VALUES (922, 1318, 64);
+INSERT INTO orders VALUES (923, 4237, 95);
+INSERT INTO orders VALUES (924, 2156, 29);
+INSERT INTO orders VALUES (925, 75, 60);
+INSERT INTO orders VALUES (926, 2994, 91);
+INSERT INTO orders VALUES (927, 913, 25);
+INSERT INTO orders VALUES (928, 3832, 56);
+INSERT INTO orders VALUES (929, 1751, 87);
+INSERT INTO orders VALUES (930, 4670, 21);
+INSERT INTO orders VALUES (931, 2589, 52);
+INSERT INTO orders VALUES (932, 508, 83);
+INSERT INTO orders VALUES (933, 3427, 17);
+INSERT INTO orders VALUES (934, 1346, 48);
+INSERT INTO orders VALUES (935, 4265, 79);
+INSERT INTO orders VALUES (936, 2184, 13);
+INSERT INTO orders VALUES (937, 103, 44);
+INSERT INTO orders VALUES (938, 3022, 75);
+INSERT INTO orders VALUES (939, 941, 9);
+INSERT INTO orders VALUES (940, 3860, 40);
+INSERT INTO orders VALUES (941, 1779, 71);
+INSERT INTO orders VALUES (942, 4698, 5);
+INSERT INTO orders VALUES (943, 2617, 36);
+INSERT INTO orders VALUES (944, 536, 67);
+INSERT INTO orders VALUES (945, 3455, 1);
+INSERT INTO orders VALUES (946, 1374, 32);
+INSERT INTO orders VALUES (947, 4293, 63);
+INSERT INTO orders VALUES (948, 2212, 94);
+INSERT INTO orders VALUES (949, 131, 28);
+INSERT INTO orders VALUES (950, 3050, 59);
+INSERT INTO orders VALUES (951, 969, 90);
+INSERT INTO orders VALUES (952, 3888, 24);
+INSERT INTO orders VALUES (953, 1807, 55);
+INSERT INTO orders VALUES (954, 4726, 86);
+INSERT INTO orders VALUES (955, 2645, 20);
+INSERT INTO orders VALUES (956, 564, 51);
+INSERT INTO orders VALUES (957, 3483, 82);
+INSERT INTO orders VALUES (958, 1402, 16);
+INSERT INTO orders VALUES (959, 4321, 47);
+INSERT INTO orders VALUES (960, 2240, 78);
+INSERT INTO orders VALUES (961, 159, 12);
+INSERT INTO orders VALUES (962, 3078, 43);
+INSERT INTO orders VALUES (963, 997, 74);
+INSERT INTO orders VALUES (964, 3916, 8);
+INSERT INTO orders VALUES (965, 1835, 39);
+INSERT INTO orders VALUES (966, 4754, 70);
+INSERT INTO orders VALUES (967, 2673, 4);
+INSERT INTO orders VALUES (968, 592, 35);
+INSERT INTO orders VALUES (969, 3511, 66);
+INSERT INTO orders VALUES (970, 1430, 0);
+INSERT INTO orders VALUES (971, 4349, 31);
+INSERT INTO orders VALUES (972, 2268, 62);
+INSERT INTO orders VALUES (973, 187, 93);
+INSERT INTO orders VALUES (974, 3106, 27);
+INSERT INTO orders VALUES (975, 1025, 58);
+INSERT INTO orders VALUES (976, 3944, 89);
+INSERT INTO orders VALUES (977, 1863, 23);
+INSERT INTO orders VALUES (978, 4782, 54);
+INSERT INTO orders VALUES (979, 2701, 85);
+INSERT INTO orders VALUES (980, 620, 19);
+INSERT INTO orders VALUES (981, 3539, 50);
+INSERT INTO orders VALUES (982, 1458, 81);
+INSERT INTO orders VALUES (983, 4377, 15);
+INSERT INTO orders VALUES (984, 2296, 46);
+INSERT INTO orders VALUES (985, 215, 77);
+INSERT INTO orders VALUES (986, 3134, 11);
+INSERT INTO orders VALUES (987, 1053, 42);
+INSERT INTO orders VALUES (988, 3972, 73);
+INSERT INTO orders VALUES (989, 1891, 7);
+INSERT INTO orders VALUES (990, 4810, 38);
+INSERT INTO orders VALUES (991, 2729, 69);
+INSERT INTO orders VALUES (992, 648, 3);
+INSERT INTO orders VALUES (993, 3567, 34);
+INSERT INTO orders VALUES (994, 1486, 65);
+INSERT INTO orders VALUES (995, 4405, 96);
+INSERT INTO orders VALUES (996, 2324, 30);
+INSERT INTO orders VALUES (997, 243, 61);
+INSERT INTO orders VALUES (998, 3162, 92);
+INSERT INTO orders VALUES (999, 1081, 26);
+INSERT INTO orders VALUES (1000, 4000, 57);
+INSERT INTO orders VALUES (1001, 1919, 88);
+INSERT INTO orders VALUES (1002, 4838, 22);
+INSERT INTO orders VALUES (1003, 2757, 53);
+INSERT INTO orders VALUES (1004, 676, 84);
+INSERT INTO orders VALUES (1005, 3595, 18);
+INSERT INTO orders VALUES (1006, 1514, 49);
+INSERT INTO orders VALUES (1007, 4433, 80);
+INSERT INTO orders VALUES (1008, 2352, 14);
+INSERT INTO orders VALUES (1009, 271, 45);
+INSERT INTO orders VALUES (1010, 3190, 76);
+INSERT INTO orders VALUES (1011, 1109, 10);
+INSERT INTO orders VALUES (1012, 4028, 41);
+INSERT INTO orders VALUES (1013, 1947, 72);
+INSERT INTO orders VALUES (1014, 4866, 6);
+INSERT INTO orders VALUES (1015, 2785, 37);
+INSERT INTO orders VALUES (1016, 704, 68);
+INSERT INTO orders VALUES (1017, 3623, 2);
+INSERT INTO orders VALUES (1018, 1542, 33);
+INSERT INTO orders VALUES (1019, 4461, 64);
+INSERT INTO orders VALUES (1020, 2380, 95);
+INSERT INTO orders VALUES (1021, 299, 29);
+INSERT INTO orders VALUES (1022, 3218, 60);
+INSERT INTO orders VALUES (1023, 1137, 91);
+INSERT INTO orders VALUES (1024, 4056, 25);
+INSERT INTO orders VALUES (1025, 1975, 56);
+INSERT INTO orders VALUES (1026, 4894, 87);
+INSERT INTO orders VALUES (1027, 2813, 21);
+INSERT INTO orders VALUES (1028, 732, 52);
+INSERT INTO orders VALUES (1029, 3651, 83);
+INSERT INTO orders VALUES (1030, 1570, 17);
+INSERT INTO orders VALUES (1031, 4489, 48);
+INSERT INTO orders VALUES (1032, 2408, 79);
+INSERT INTO orders VALUES (1033, 327, 13);
+INSERT INTO orders VALUES (1034, 3246, 44);
+INSERT INTO orders VALUES (1035, 1165, 75);
+INSERT INTO orders VALUES (1036, 4084, 9);
+INSERT INTO orders VALUES (1037, 2003, 40);
+INSERT INTO orders VALUES (1038, 4922, 71);
+INSERT INTO orders VALUES (1039, 2841, 5);
+INSERT INTO orders VALUES (1040, 760, 36);
+INSERT INTO orders VALUES (1041, 3679, 67);
+INSERT INTO orders VALUES (1042, 1598, 1);
+INSERT INTO orders VALUES (1043, 4517, 32);
+INSERT INTO orders VALUES (1044, 2436, 63);
+INSERT INTO orders VALUES (1045, 355, 94);
+INSERT INTO orders VALUES (1046, 3274, 28);
+INSERT INTO orders VALUES (1047, 1193, 59);
+INSERT INTO orders VALUES (1048, 4112, 90);
+INSERT INTO orders VALUES (1049, 2031, 24);
+INSERT INTO orders VALUES (1050, 4950, 55);
+INSERT INTO orders VALUES (1051, 2869, 86);
+INSERT INTO orders VALUES (1052, 788, 20);
+INSERT INTO orders VALUES (1053, 3707, 51);
+INSERT INTO orders VALUES (1054, 1626, 82);
+INSERT INTO orders VALUES (1055, 4545, 16);
+INSERT INTO orders VALUES (1056, 2464, 47);
+INSERT INTO orders VALUES (1057, 383, 78);
+INSERT INTO orders VALUES (1058, 3302, 12);
+INSERT INTO orders VALUES (1059, 1221, 43);
+INSERT INTO orders VALUES (1060, 4140, 74);
+INSERT INTO orders VALUES (1061, 2059, 8);
+INSERT INTO orders VALUES (1062, 4978, 39);
+INSERT INTO orders VALUES (1063, 2897, 70);
+INSERT INTO orders VALUES (1064, 816, 4);
+INSERT INTO orders VALUES (1065, 3735, 35);
+INSERT INTO orders VALUES (1066, 1654, 66);
+INSERT INTO orders VALUES (1067, 4573, 0);
+INSERT INTO orders VALUES (1068, 2492, 31);
+INSERT INTO orders VALUES (1069, 411, 62);
+INSERT INTO orders VALUES (1070, 3330, 93);
+INSERT INTO orders VALUES (1071, 1249, 27);
+INSERT INTO orders VALUES (1072, 4168, 58);
+INSERT INTO orders VALUES (1073, 2087, 89);
+INSERT INTO orders VALUES (1074, 6, 23);
+INSERT INTO orders VALUES (1075, 2925, 54);
+INSERT INTO orders VALUES (1076, 844, 85);
+INSERT INTO orders VALUES (1077, 3763, 19);
+INSERT INTO orders VALUES (1078, 1682, 50);
+INSERT INTO orders VALUES (1079, 4601, 81);
+INSERT INTO orders VALUES (1080, 2520, 15);
+INSERT INTO orders VALUES (1081, 439, 46);
+INSERT INTO orders VALUES (1082, 3358, 77);
+INSERT INTO orders VALUES (1083, 1277, 11);
+INSERT INTO orders VALUES (1084, 4196, 42);
+INSERT INTO orders VALUES (1085, 2115, 73);
+INSERT INTO orders VALUES (1086, 34, 7);
+INSERT INTO orders VALUES (1087, 2953, 38);
+INSERT INTO orders VALUES (1088, 872, 69);
+INSERT INTO orders VALUES (1089, 3791, 3);
+INSERT INTO orders VALUES (1090, 1710, 34);
+INSERT INTO orders VALUES (1091, 4629, 65);
+INSERT INTO orders VALUES (1092, 2548, 96);
+INSERT INTO orders VALUES (1093, 467, 30);
+INSERT INTO orders VALUES (1094, 3386, 61);
+INSERT INTO orders VALUES (1095, 1305, 92);
+INSERT INTO orders VALUES (1096, 4224, 26);
+INSERT INTO orders VALUES (1097, 2143, 57);
+INSERT INTO orders VALUES (1098, 62, 88);
+INSERT INTO orders VALUES (1099, 2981, 22);
+INSERT INTO orders VALUES (1100, 900, 53);
+INSERT INTO orders VALUES (1101, 3819, 84);
+INSERT INTO orders VALUES (1102, 1738, 18);
+INSERT INTO orders VALUES (1103, 4657, 49);
+INSERT INTO orders VALUES (1104, 2576, 80);
+INSERT INTO orders VALUES (1105, 495, 14);
+INSERT INTO orders VALUES (1106, 3414, 45);
+INSERT INTO orders VALUES (1107, 1333, 76);
+INSERT INTO orders VALUES (1108, 4252, 10);
+INSERT INTO orders VALUES (1109, 2171, 41);
+INSERT INTO orders VALUES (1110, 90, 72);
+INSERT INTO orders VALUES (1111, 3009, 6);
+INSERT INTO orders VALUES (1112, 928, 37);
+INSERT INTO orders VALUES (1113, 3847, 68);
+INSERT INTO orders VALUES (1114, 1766, 2);
+INSERT INTO orders VALUES (1115, 4685, 33);
+INSERT INTO orders VALUES (1116, 2604, 64);
+INSERT INTO orders VALUES (1117, 523, 95);
+INSERT INTO orders VALUES (1118, 3442, 29);
+INSERT INTO orders VALUES (1119, 1361, 60);
+INSERT INTO orders VALUES (1120, 4280, 91);
+INSERT INTO orders VALUES (1121, 2199, 25);
+INSERT INTO orders VALUES (1122, 118, 56);
+INSERT INTO orders VALUES (1123, 3037, 87);
+INSERT INTO orders VALUES (1124, 956, 21);
+INSERT INTO orders VALUES (1125, 3875, 52);
+INSERT INTO orders VALUES (1126, 1794, 83);
+INSERT INTO orders VALUES (1127, 4713, 17);
+INSERT INTO orders VALUES (1128, 2632, 48);
+INSERT INTO orders VALUES (1129, 551, 79);
+INSERT INTO orders VALUES (1130, 3470, 13);
+INSERT INTO orders VALUES (1131, 1389, 44);
+INSERT INTO orders VALUES (1132, 4308, 75);
+INSERT INTO orders VALUES (1133, 2227, 9);
+INSERT INTO orders VALUES (1134, 146, 40);
+INSERT INTO orders VALUES (1135, 3065, 71);
+INSERT INTO orders VALUES (1136, 984, 5);
+INSERT INTO orders VALUES (1137, 3903, 36);
+INSERT INTO orders VALUES (1138, 1822, 67);
+INSERT INTO orders VALUES (1139, 4741, 1);
+INSERT INTO orders VALUES (1140, 2660, 32);
+INSERT INTO orders VALUES (1141, 579, 63);
+INSERT INTO orders VALUES (1142, 3498, 94);
+INSERT INTO orders VALUES (1143, 1417, 28);
+INSERT INTO orders VALUES (1144, 4336, 59);
+INSERT INTO orders VALUES (1145, 2255, 90);
+INSERT INTO orders VALUES (1146, 174, 24);
+INSERT INTO orders VALUES (1147, 3093, 55);
+INSERT INTO orders VALUES (1148, 1012, 86);
+INSERT INTO orders VALUES (1149, 3931, 20);
+INSERT INTO orders VALUES (1150, 1850, 51);
+INSERT INTO orders VALUES (1151, 4769, 82);
+INSERT INTO orders VALUES (1152, 2688, 16);
+INSERT INTO orders VALUES (1153, 607, 47);
+INSERT INTO orders VALUES (1154, 3526, 78);
+INSERT INTO orders VALUES (1155, 1445, 12);
+INSERT INTO orders VALUES (1156, 4364, 43);
+INSERT INTO orders VALUES (1157, 2283, 74);
+INSERT INTO orders VALUES (1158, 202, 8);
+INSERT INTO orders VALUES (1159, 3121, 39);
+INSERT INTO orders VALUES (1160, 1040, 70);
+INSERT INTO orders VALUES (1161, 3959, 4);
+INSERT INTO orders VALUES (1162, 1878, 35);
+INSERT INTO orders VALUES (1163, 4797, 66);
+INSERT INTO orders VALUES (1164, 2716, 0);
+INSERT INTO orders VALUES (1165, 635, 31);
+INSERT INTO orders VALUES (1166, 3554, 62);
+INSERT INTO orders VALUES (1167, 1473, 93);
+INSERT INTO orders VALUES (1168, 4392, 27);
+INSERT INTO orders VALUES (1169, 2311, 58);
+INSERT INTO orders VALUES (1170, 230, 89);
+INSERT INTO orders VALUES (1171, 3149, 23);
+INSERT INTO orders VALUES (1172, 1068, 54);
+INSERT INTO orders VALUES (1173, 3987, 85);
+INSERT INTO orders VALUES (1174, 1906, 19);
+INSERT INTO orders VALUES (1175, 4825, 50);
+INSERT INTO orders VALUES (1176, 2744, 81);
+INSERT INTO orders VALUES (1177, 663, 15);
+INSERT INTO orders VALUES (1178, 3582, 46);
+INSERT INTO orders VALUES (1179, 1501, 77);
+INSERT INTO orders VALUES (1180, 4420, 11);
+INSERT INTO orders VALUES (1181, 2339, 42);
+INSERT INTO orders VALUES (1182, 258, 73);
+INSERT INTO orders VALUES (1183, 3177, 7);
+INSERT INTO orders VALUES (1184, 1096, 38);
+INSERT INTO orders VALUES (1185, 4015, 69);
+INSERT INTO orders VALUES (1186, 1934, 3);
+INSERT INTO orders VALUES (1187, 4853, 34);
+INSERT INTO orders VALUES (1188, 2772, 65);
+INSERT INTO orders VALUES (1189, 691, 96);
+INSERT INTO orders VALUES (1190, 3610, 30);
+INSERT INTO orders VALUES (1191, 1529, 61);
+INSERT INTO orders VALUES (1192, 4448, 92);
+INSERT INTO orders VALUES (1193, 2367, 26);
+INSERT INTO orders VALUES (1194, 286, 57);
+INSERT INTO orders VALUES (1195, 3205, 88);
+INSERT INTO orders VALUES (1196, 1124, 22);
+INSERT INTO orders VALUES (1197, 4043, 53);
+INSERT INTO orders VALUES (1198, 1962, 84);
+INSERT INTO orders VALUES (1199, 4881, 18);
+INSERT INTO orders VALUES (1200, 2800, 49);
+INSERT INTO orders VALUES (1201, 719, 80);
+INSERT INTO orders VALUES (1202, 3638, 14);
+INSERT INTO orders VALUES (1203, 1557, 45);
+INSERT INTO orders VALUES (1204, 4476, 76);
+INSERT INTO orders VALUES (1205, 2395, 10);
+INSERT INTO orders VALUES (1206, 314, 41);
+INSERT INTO orders VALUES (1207, 3233, 72);
+INSERT INTO orders VALUES (1208, 1152, 6);
+INSERT INTO orders VALUES (1209, 4071, 37);
+INSERT INTO orders VALUES (1210, 1990, 68);
+INSERT INTO orders VALUES (1211, 4909, 2);
+INSERT INTO orders VALUES (1212, 2828, 33);
+INSERT INTO orders VALUES (1213, 747, 64);
+INSERT INTO orders VALUES (1214, 3666, 95);
+INSERT INTO orders VALUES (1215, 1585, 29);
+INSERT INTO orders VALUES (1216, 4504, 60);
+INSERT INTO orders VALUES (1217, 2423, 91);
+INSERT INTO orders VALUES (1218, 342, 25);
+INSERT INTO orders VALUES (1219, 3261, 56);
+INSERT INTO orders VALUES (1220, 1180, 87);
+INSERT INTO orders VALUES (1221, 4099, 21);
+INSERT INTO orders VALUES (1222, 2018, 52);
+INSERT INTO orders VALUES (1223, 4937, 83);
+INSERT INTO orders VALUES (1224, 2856, 17);
+INSERT INTO orders VALUES (1225, 775, 48);
+INSERT INTO orders VALUES (1226, 3694, 79);
+INSERT INTO orders VALUES (1227, 1613, 13);
+INSERT INTO orders VALUES (1228, 4532, 44);
+INSERT INTO orders VALUES (1229, 2451, 75);
+INSERT INTO orders VALUES (1230, 370, 9);
+INSERT INTO orders VALUES (1231, 3289, 40);
+INSERT INTO orders VALUES (1232, 1208, 71);
+INSERT INTO orders VALUES (1233, 4127, 5);
+INSERT INTO orders VALUES (1234, 2046, 36);
+INSERT INTO orders VALUES (1235, 4965, 67);
+INSERT INTO orders VALUES (1236, 2884, 1);
+INSERT INTO orders VALUES (1237, 803, 32);
+INSERT INTO orders VALUES (1238, 3722, 63);
+INSERT INTO orders VALUES (1239, 1641, 94);
+INSERT INTO orders VALUES (1240, 4560, 28);
+INSERT INTO orders VALUES (1241, 2479, 59);
+INSERT INTO orders VALUES (1242, 398, 90);
+INSERT INTO orders VALUES (1243, 3317, 24);
+INSERT INTO orders VALUES (1244, 1236, 55);
+INSERT INTO orders VALUES (1245, 4155, 86);
+INSERT INTO orders VALUES (1246, 2074, 20);
+INSERT INTO orders VALUES (1247, 4993, 51);
+INSERT INTO orders VALUES (1248, 2912, 82);
+INSERT INTO orders VALUES (1249, 831, 16);
+INSERT INTO orders VALUES (1250, 3750, 47);
+INSERT INTO orders VALUES (1251, 1669, 78);
+INSERT INTO orders VALUES (1252, 4588, 12);
+INSERT INTO orders VALUES (1253, 2507, 43);
+INSERT INTO orders VALUES (1254, 426, 74);
+INSERT INTO orders VALUES (1255, 3345, 8);
+INSERT INTO orders VALUES (1256, 1264, 39);
+INSERT INTO orders VALUES (1257, 4183, 70);
+INSERT INTO orders VALUES (1258, 2102, 4);
+INSERT INTO orders VALUES (1259, 21, 35);
+INSERT INTO orders VALUES (1260, 2940, 66);
+INSERT INTO orders VALUES (1261, 859, 0);
+INSERT INTO orders VALUES (1262, 3778, 31);
+INSERT INTO orders VALUES (1263, 1697, 62);
+INSERT INTO orders VALUES (1264, 4616, 93);
+INSERT INTO orders VALUES (1265, 2535, 27);
+INSERT INTO orders VALUES (1266, 454, 58);
+INSERT INTO orders VALUES (1267, 3373, 89);
+INSERT INTO orders VALUES (1268, 1292, 23);
+INSERT INTO orders VALUES (1269, 4211, 54);
+INSERT INTO orders VALUES (1270, 2130, 85);
+INSERT INTO orders VALUES (1271, 49, 19);
+INSERT INTO orders VALUES (1272, 2968, 50);
+INSERT INTO orders VALUES (1273, 887, 81);
+INSERT INTO orders VALUES (1274, 3806, 15);
+INSERT INTO orders VALUES (1275, 1725, 46);
+INSERT INTO orders VALUES (1276, 4644, 77);
+INSERT INTO orders VALUES (1277, 2563, 11);
+INSERT INTO orders VALUES (1278, 482, 42);
+INSERT INTO orders VALUES (1279, 3401, 73);
+INSERT INTO orders VALUES (1280, 1320, 7);
+INSERT INTO orders VALUES (1281, 4239, 38);
+INSERT INTO orders VALUES (1282, 2158, 69);
+INSERT INTO orders VALUES (1283, 77, 3);
+INSERT INTO orders VALUES (1284, 2996, 34);
+INSERT INTO orders VALUES (1285, 915, 65);
+INSERT INTO orders VALUES (1286, 3834, 96);
+INSERT INTO orders VALUES (1287, 1753, 30);
+INSERT INTO orders VALUES (1288, 4672, 61);
+INSERT INTO orders VALUES (1289, 2591, 92);
+INSERT INTO orders VALUES (1290, 510, 26);
+INSERT INTO orders VALUES (1291, 3429, 57);
+INSERT INTO orders VALUES (1292, 1348, 88);
+INSERT INTO orders VALUES (1293, 4267, 22);
+INSERT INTO orders VALUES (1294, 2186, 53);
+INSERT INTO orders VALUES (1295, 105, 84);
+INSERT INTO orders VALUES (1296, 3024, 18);
+INSERT INTO orders VALUES (1297, 943, 49);
+INSERT INTO orders VALUES (1298, 3862, 80);
+INSERT INTO orders VALUES (1299, 1781, 14);
+INSERT INTO orders VALUES (1300, 4700, 45);
+INSERT INTO orders VALUES (1301, 2619, 76);
+INSERT INTO orders VALUES (1302, 538, 10);
+INSERT INTO orders VALUES (1303, 3457, 41);
+INSERT INTO orders VALUES (1304, 1376, 72);
+INSERT INTO orders VALUES (1305, 4295, 6);
+INSERT INTO orders VALUES (1306, 2214, 37);
+INSERT INTO orders VALUES (1307, 133, 68);
+INSERT INTO orders VALUES (1308, 3052, 2);
+INSERT INTO orders VALUES (1309, 971, 33);
+INSERT INTO orders VALUES (1310, 3890, 64);
+INSERT INTO orders VALUES (1311, 1809, 95);
+INSERT INTO orders VALUES (1312, 4728, 29);
+INSERT INTO orders VALUES (1313, 2647, 60);
+INSERT INTO orders VALUES (1314, 566, 91);
+INSERT INTO orders VALUES (1315, 3485, 25);
+INSERT INTO orders VALUES (1316, 1404, 56);
+INSERT INTO orders VALUES (1317, 4323, 87);
+INSERT INTO orders VALUES (1318, 2242, 21);
+INSERT INTO orders VALUES (1319, 161, 52);
+INSERT INTO orders VALUES (1320, 3080, 83);
+INSERT INTO orders VALUES (1321, 999, 17);
+INSERT INTO orders VALUES (1322, 3918, 48);
+INSERT INTO orders VALUES (1323, 1837, 79);
+INSERT INTO orders VALUES (1324, 4756, 13);
+INSERT INTO orders VALUES (1325, 2675, 44);
+INSERT INTO orders VALUES (1326, 594, 75);
+INSERT INTO orders VALUES (1327, 3513, 9);
+INSERT INTO orders VALUES (1328, 1432, 40);
+INSERT INTO orders VALUES (1329, 4351, 71);
+INSERT INTO orders VALUES (1330, 2270, 5);
+INSERT INTO orders VALUES (1331, 189, 36);
+INSERT INTO orders VALUES (1332, 3108, 67);
+INSERT INTO orders VALUES (1333, 1027, 1);
+INSERT INTO orders VALUES (1334, 3946, 32);
+INSERT INTO orders VALUES (1335, 1865, 63);
+INSERT INTO orders VALUES (1336, 4784, 94);
+INSERT INTO orders VALUES (1337, 2703, 28);
+INSERT INTO orders VALUES (1338, 622, 59);
+INSERT INTO orders VALUES (1339, 3541, 90);
+INSERT INTO orders VALUES (1340, 1460, 24);
+INSERT INTO orders VALUES (1341, 4379, 55);
+INSERT INTO orders VALUES (1342, 2298, 86);
+INSERT INTO orders VALUES (1343, 217, 20);
+INSERT INTO orders VALUES (1344, 3136, 51);
+INSERT INTO orders VALUES (1345, 1055, 82);
+INSERT INTO orders VALUES (1346, 3974, 16);
+INSERT INTO orders VALUES (1347, 1893, 47);
+INSERT INTO orders VALUES (1348, 4812, 78);
+INSERT INTO orders VALUES (1349, 2731, 12);
+INSERT INTO orders VALUES (1350, 650, 43);
+INSERT INTO orders VALUES (1351, 3569, 74);
+INSERT INTO orders VALUES (1352, 1488, 8);
+INSERT INTO orders VALUES (1353, 4407, 39);
+INSERT INTO orders VALUES (1354, 2326, 70);
+INSERT INTO orders VALUES (1355, 245, 4);
+INSERT INTO orders VALUES (1356, 3164, 35);
+INSERT INTO orders VALUES (1357, 1083, 66);
+INSERT INTO orders VALUES (1358, 4002, 0);
+INSERT INTO orders VALUES (1359, 1921, 31);
+INSERT INTO orders VALUES (1360, 4840, 62);
+INSERT INTO orders VALUES (1361, 2759, 93);
+INSERT INTO orders VALUES (1362, 678, 27);
+INSERT INTO orders VALUES (1363, 3597, 58);
+INSERT INTO orders VALUES (1364, 1516, 89);
+INSERT INTO orders VALUES (1365, 4435, 23);
+INSERT INTO orders VALUES (1366, 2354, 54);
+INSERT INTO orders VALUES (1367, 273, 85);
+INSERT INTO orders VALUES (1368, 3192, 19);
+INSERT INTO orders VALUES (1369, 1111, 50);
+INSERT INTO orders VALUES (1370, 4030, 81);
+INSERT INTO orders VALUES (1371, 1949, 15);
+INSERT INTO orders VALUES (1372, 4868, 46);
+INSERT INTO orders VALUES (1373, 2787, 77);
+INSERT INTO orders VALUES (1374, 706, 11);
+INSERT INTO orders VALUES (1375, 3625, 42);
+INSERT INTO orders VALUES (1376, 1544, 73);
+INSERT INTO orders VALUES (1377, 4463, 7);
+INSERT INTO orders VALUES (1378, 2382, 38);
+INSERT INTO orders VALUES (1379, 301, 69);
+INSERT INTO orders VALUES (1380, 3220, 3);
+INSERT INTO orders VALUES (1381, 1139, 34);
+INSERT INTO orders VALUES (1382, 4058, 65);
+INSERT INTO orders VALUES (1383, 1977, 96);
+INSERT INTO orders VALUES (1384, 4896, 30);
+INSERT INTO orders VALUES (1385, 2815, 61);
+INSERT INTO orders VALUES (1386, 734, 92);
+INSERT INTO orders VALUES (1387, 3653, 26);
+INSERT INTO orders VALUES (1388, 1572, 57);
+INSERT INTO orders VALUES (1389, 4491, 88);
+INSERT INTO orders VALUES (1390, 2410, 22);
+INSERT INTO orders VALUES (1391, 329, 53);
+INSERT INTO orders VALUES (1392, 3248, 84);
+INSERT INTO orders VALUES (1393, 1167, 18);
+INSERT INTO orders VALUES (1394, 4086, 49);
+INSERT INTO orders VALUES (1395, 2005, 80);
+INSERT INTO orders VALUES (1396, 4924, 14);
+INSERT INTO orders VALUES (1397, 2843, 45);
+INSERT INTO orders VALUES (1398, 762, 76);
+INSERT INTO orders VALUES (1399, 3681, 10);
+INSERT INTO orders VALUES (1400, 1600, 41);
+INSERT INTO orders VALUES (1401, 4519, 72);
+INSERT INTO orders VALUES (1402, 2438, 6);
+INSERT INTO orders VALUES (1403, 357, 37);
+INSERT INTO orders VALUES (1404, 3276, 68);
+INSERT INTO orders VALUES (1405, 1195, 2);
+INSERT INTO orders VALUES (1406, 4114, 33);
+INSERT INTO orders VALUES (1407, 2033, 64);
+INSERT INTO orders VALUES (1408, 4952, 95);
+INSERT INTO orders VALUES (1409, 2871, 29);
+INSERT INTO orders VALUES (1410, 790, 60);
+INSERT INTO orders VALUES (1411, 3709, 91);
+INSERT INTO orders VALUES (1412, 1628, 25);
+INSERT INTO orders VALUES (1413, 4547, 56);
+INSERT INTO orders VALUES (1414, 2466, 87);
+INSERT INTO orders VALUES (1415, 385, 21);
+INSERT INTO orders VALUES (1416, 3304, 52);
+INSERT INTO orders VALUES (1417, 1223, 83);
+INSERT INTO orders VALUES (1418, 4142, 17);
+INSERT INTO orders VALUES (1419, 2061, 48);
+INSERT INTO orders VALUES (1420, 4980, 79);
+INSERT INTO orders VALUES (1421, 2899, 13);
+INSERT INTO orders VALUES (1422, 818, 44);
+INSERT INTO orders VALUES (1423, 3737, 75);
+INSERT INTO orders VALUES (1424, 1656, 9);
+INSERT INTO orders VALUES (1425, 4575, 40);
+INSERT INTO orders VALUES (1426, 2494, 71);
+INSERT INTO orders VALUES (1427, 413, 5);
+INSERT INTO orders VALUES (1428, 3332, 36);
+INSERT INTO orders VALUES (1429, 1251, 67);
+INSERT INTO orders VALUES (1430, 4170, 1);
+INSERT INTO orders VALUES (1431, 2089, 32);
+INSERT INTO orders VALUES (1432, 8, 63);
+INSERT INTO orders VALUES (1433, 2927, 94);
+INSERT INTO orders VALUES (1434, 846, 28);
+INSERT INTO orders VALUES (1435, 3765, 59);
+INSERT INTO orders VALUES (1436, 1684, 90);
+INSERT INTO orders VALUES (1437, 4603, 24);
+INSERT INTO orders VALUES (1438, 2522, 55);
+INSERT INTO orders VALUES (1439, 441, 86);
+INSERT INTO orders VALUES (1440, 3360, 20);
+INSERT INTO orders VALUES (1441, 1279, 51);
+INSERT INTO orders VALUES (1442, 4198, 82);
+INSERT INTO orders VALUES (1443, 2117, 16);
+INSERT INTO orders VALUES (1444, 36, 47);
+INSERT INTO orders VALUES (1445, 2955, 78);
+INSERT INTO orders VALUES (1446, 874, 12);
+INSERT INTO orders VALUES (1447, 3793, 43);
+INSERT INTO orders VALUES (1448, 1712, 74);
+INSERT INTO orders VALUES (1449, 4631, 8);
+INSERT INTO orders VALUES (1450, 2550, 39);
+INSERT INTO orders VALUES (1451, 469, 70);
+INSERT INTO orders VALUES (1452, 3388, 4);
+INSERT INTO orders VALUES (1453, 1307, 35);
+INSERT INTO orders VALUES (1454, 4226, 66);
+INSERT INTO orders VALUES (1455, 2145, 0);
+INSERT INTO orders VALUES (1456, 64, 31);
+INSERT INTO orders VALUES (1457, 2983, 62);
+INSERT INTO orders VALUES (1458, 902, 93);
+INSERT INTO orders VALUES (1459, 3821, 27);
+INSERT INTO orders VALUES (1460, 1740, 58);
+INSERT INTO orders VALUES (1461, 4659, 89);
+INSERT INTO orders VALUES (1462, 2578, 23);
+INSERT INTO orders VALUES (1463, 497, 54);
+INSERT INTO orders VALUES (1464, 3416, 85);
+INSERT INTO orders VALUES (1465, 1335, 19);
+INSERT INTO orders VALUES (1466, 4254, 50);
+INSERT INTO orders VALUES (1467, 2173, 81);
+INSERT INTO orders VALUES (1468, 92, 15);
+INSERT INTO orders VALUES (1469, 3011, 46);
+INSERT INTO orders VALUES (1470, 930, 77);
+INSERT INTO orders VALUES (1471, 3849, 11);
+INSERT INTO orders VALUES (1472, 1768, 42);
+INSERT INTO orders VALUES (1473, 4687, 73);
+INSERT INTO orders VALUES (1474, 2606, 7);
+INSERT INTO orders VALUES (1475, 525, 38);
+INSERT INTO orders VALUES (1476, 3444, 69);
+INSERT INTO orders VALUES (1477, 1363, 3);
+INSERT INTO orders VALUES (1478, 4282, 34);
+INSERT INTO orders VALUES (1479, 2201, 65);
+INSERT INTO orders VALUES (1480, 120, 96);
+INSERT INTO orders VALUES (1481, 3039, 30);
+INSERT INTO orders VALUES (1482, 958, 61);
+INSERT INTO orders VALUES (1483, 3877, 92);
+INSERT INTO orders VALUES (1484, 1796, 26);
+INSERT INTO orders VALUES (1485, 4715, 57);
+INSERT INTO orders VALUES (1486, 2634, 88);
+INSERT INTO orders VALUES (1487, 553, 22);
+INSERT INTO orders VALUES (1488, 3472, 53);
+INSERT INTO orders VALUES (1489, 1391, 84);
+INSERT INTO orders VALUES (1490, 4310, 18);
+INSERT INTO orders VALUES (1491, 2229, 49);
+INSERT INTO orders VALUES (1492, 148, 80);
+INSERT INTO orders VALUES (1493, 3067, 14);
+INSERT INTO orders VALUES (1494, 986, 45);
+INSERT INTO orders VALUES (1495, 3905, 76);
+INSERT INTO orders VALUES (1496, 1824, 10);
+INSERT INTO orders VALUES (1497, 4743, 41);
+INSERT INTO orders VALUES (1498, 2662, 72);
+INSERT INTO orders VALUES (1499, 581, 6);
+INSERT INTO orders VALUES (1500, 3500, 37);
+INSERT INTO orders VALUES (1501, 1419, 68);
+INSERT INTO orders VALUES (1502, 4338, 2);
+INSERT INTO orders VALUES (1503, 2257, 33);
+INSERT INTO orders VALUES (1504, 176, 64);
+INSERT INTO orders VALUES (1505, 3095, 95);
+INSERT INTO orders VALUES (1506, 1014, 29);
+INSERT INTO orders VALUES (1507, 3933, 60);
+INSERT INTO orders VALUES (1508, 1852, 91);
+INSERT INTO orders VALUES (1509, 4771, 25);
+INSERT INTO orders VALUES (1510, 2690, 56);
+INSERT INTO orders VALUES (1511, 609, 87);
+INSERT INTO orders VALUES (1512, 3528, 21);
+INSERT INTO orders VALUES (1513, 1447, 52);
+INSERT INTO orders VALUES (1514, 4366, 83);
+INSERT INTO orders VALUES (1515, 2285, 17);
+INSERT INTO orders VALUES (1516, 204, 48);
+INSERT INTO orders VALUES (1517, 3123, 79);
+INSERT INTO orders VALUES (1518, 1042, 13);
+INSERT INTO orders VALUES (1519, 3961, 44);
+INSERT INTO orders VALUES (1520, 1880, 75);
+INSERT INTO orders VALUES (1521, 4799, 9);
+INSERT INTO orders VALUES (1522, 2718, 40);
+INSERT INTO orders VALUES (1523, 637, 71);
+INSERT INTO orders VALUES (1524, 3556, 5);
+INSERT INTO orders VALUES (1525, 1475, 36);
+INSERT INTO orders VALUES (1526, 4394, 67);
+INSERT INTO orders VALUES (1527, 2313, 1);
+INSERT INTO orders VALUES (1528, 232, 32);
+INSERT INTO orders VALUES (1529, 3151, 63);
+INSERT INTO orders VALUES (1530, 1070, 94);
+INSERT INTO orders VALUES (1531, 3989, 28);
+INSERT INTO orders VALUES (1532, 1908, 59);
+INSERT INTO orders VALUES (1533, 4827, 90);
+INSERT INTO orders VALUES (1534, 2746, 24);
+INSERT INTO orders VALUES (1535, 665, 55);
+INSERT INTO orders VALUES (1536, 3584, 86);
+INSERT INTO orders VALUES (1537, 1503, 20);
+INSERT INTO orders VALUES (1538, 4422, 51);
+INSERT INTO orders VALUES (1539, 2341, 82);
+INSERT INTO orders VALUES (1540, 260, 16);
+INSERT INTO orders VALUES (1541, 3179, 47);
+INSERT INTO orders VALUES (1542, 1098, 78);
+INSERT INTO orders VALUES (1543, 4017, 12);
+INSERT INTO orders VALUES (1544, 1936, 43);
+INSERT INTO orders VALUES (1545, 4855, 74);
+INSERT INTO orders VALUES (1546, 2774, 8);
+INSERT INTO orders VALUES (1547, 693, 39);
+INSERT INTO orders VALUES (1548, 3612, 70);
+INSERT INTO orders VALUES (1549, 1531, 4);
+INSERT INTO orders VALUES (1550, 4450, 35);
+INSERT INTO orders VALUES (1551, 2369, 66);
+INSERT INTO orders VALUES (1552, 288, 0);
+INSERT INTO orders VALUES (1553, 3207, 31);
+INSERT INTO orders VALUES (1554, 1126, 62);
+INSERT INTO orders VALUES (1555, 4045, 93);
+INSERT INTO orders VALUES (1556, 1964, 27);
+INSERT INTO orders VALUES (1557, 4883, 58);
+INSERT INTO orders VALUES (1558, 2802, 89);
+INSERT INTO orders VALUES (1559, 721, 23);
+INSERT INTO orders VALUES (1560, 3640, 54);
+INSERT INTO orders VALUES (1561, 1559, 85);
+INSERT INTO orders VALUES (1562, 4478, 19);
+INSERT INTO orders VALUES (1563, 2397, 50);
+INSERT INTO orders VALUES (1564, 316, 81);
+INSERT INTO orders VALUES (1565, 3235, 15);
+INSERT INTO orders VALUES (1566, 1154, 46);
+INSERT INTO orders VALUES (1567, 4073, 77);
+INSERT INTO orders VALUES (1568, 1992, 11);
+INSERT INTO orders VALUES (1569, 4911, 42);
+INSERT INTO orders VALUES (1570, 2830, 73);
+INSERT INTO orders VALUES (1571, 749, 7);
+INSERT INTO orders VALUES (1572, 3668, 38);
+INSERT INTO orders VALUES (1573, 1587, 69);
+INSERT INTO orders VALUES (1574, 4506, 3);
+INSERT INTO orders VALUES (1575, 2425, 34);
+INSERT INTO orders VALUES (1576, 344, 65);
+INSERT INTO orders VALUES (1577, 3263, 96);
+INSERT INTO orders VALUES (1578, 1182, 30);
+INSERT INTO orders VALUES (1579, 4101, 61);
+INSERT INTO orders VALUES (1580, 2020, 92);
+INSERT INTO orders VALUES (1581, 4939, 26);
+INSERT INTO orders VALUES (1582, 2858, 57);
+INSERT INTO orders VALUES (1583, 777, 88);
+INSERT INTO orders VALUES (1584, 3696, 22);
+INSERT INTO orders VALUES (1585, 1615, 53);
+INSERT INTO orders VALUES (1586, 4534, 84);
+INSERT INTO orders VALUES (1587, 2453, 18);
+INSERT INTO orders VALUES (1588, 372, 49);
+INSERT INTO orders VALUES (1589, 3291, 80);
+INSERT INTO orders VALUES (1590, 1210, 14);
+INSERT INTO orders VALUES (1591, 4129, 45);
+INSERT INTO orders VALUES (1592, 2048, 76);
+INSERT INTO orders VALUES (1593, 4967, 10);
+INSERT INTO orders VALUES (1594, 2886, 41);
+INSERT INTO orders VALUES (1595, 805, 72);
+INSERT INTO orders VALUES (1596, 3724, 6);
+INSERT INTO orders VALUES (1597, 1643, 37);
+INSERT INTO orders VALUES (1598, 4562, 68);
+INSERT INTO orders VALUES (1599, 2481, 2);
+INSERT INTO orders VALUES (1600, 400, 33);
+INSERT INTO orders VALUES (1601, 3319, 64);
+INSERT INTO orders VALUES (1602, 1238, 95);
+INSERT INTO orders VALUES (1603, 4157, 29);
+INSERT INTO orders VALUES (1604, 2076, 60);
+INSERT INTO orders VALUES (1605, 4995, 91);
+INSERT INTO orders VALUES (1606, 2914, 25);
+INSERT INTO orders VALUES (1607, 833, 56);
+INSERT INTO orders VALUES (1608, 3752, 87);
+INSERT INTO orders VALUES (1609, 1671, 21);
+INSERT INTO orders VALUES (1610, 4590, 52);
+INSERT INTO orders VALUES (1611, 2509, 83);
+INSERT INTO orders VALUES (1612, 428, 17);
+INSERT INTO orders VALUES (1613, 3347, 48);
+INSERT INTO orders VALUES (1614, 1266, 79);
+INSERT INTO orders VALUES (1615, 4185, 13);
+INSERT INTO orders VALUES (1616, 2104, 44);
+INSERT INTO orders VALUES (1617, 23, 75);
+INSERT INTO orders VALUES (1618, 2942, 9);
+INSERT INTO orders VALUES (1619, 861, 40);
+INSERT INTO orders VALUES (1620, 3780, 71);
+INSERT INTO orders VALUES (1621, 1699, 5);
+INSERT INTO orders VALUES (1622, 4618, 36);
+INSERT INTO orders VALUES (1623, 2537, 67);
+INSERT INTO orders VALUES (1624, 456, 1);
+INSERT INTO orders VALUES (1625, 3375, 32);
+INSERT INTO orders VALUES (1626, 1294, 63);
+INSERT INTO orders VALUES (1627, 4213, 94);
+INSERT INTO orders VALUES (1628, 2132, 28);
+INSERT INTO orders VALUES (1629, 51, 59);
+INSERT INTO orders VALUES (1630, 2970, 90);
+INSERT INTO orders VALUES (1631, 889, 24);
+INSERT INTO orders VALUES (1632, 3808, 55);
+INSERT INTO orders VALUES (1633, 1727, 86);
+INSERT INTO orders VALUES (1634, 4646, 20);
+INSERT INTO orders VALUES (1635, 2565, 51);
+INSERT INTO orders VALUES (1636, 484, 82);
+INSERT INTO orders VALUES (1637, 3403, 16);
+INSERT INTO orders VALUES (1638, 1322, 47);
+INSERT INTO orders VALUES (1639, 4241, 78);
+INSERT INTO orders VALUES (1640, 2160, 12);
+INSERT INTO orders VALUES (1641, 79, 43);
+INSERT INTO orders VALUES (1642, 2998, 74);
+INSERT INTO orders VALUES (1643, 917, 8);
+INSERT INTO orders VALUES (1644, 3836, 39);
+INSERT INTO orders VALUES (1645, 1755, 70);
+INSERT INTO orders VALUES (1646, 4674, 4);
+INSERT INTO orders VALUES (1647, 2593, 35);
+INSERT INTO orders VALUES (1648, 512, 66);
+INSERT INTO orders VALUES (1649, 3431, 0);
+INSERT INTO orders VALUES (1650, 1350, 31);
+INSERT INTO orders VALUES (1651, 4269, 62);
+INSERT INTO orders VALUES (1652, 2188, 93);
+INSERT INTO orders VALUES (1653, 107, 27);
+INSERT INTO orders VALUES (1654, 3026, 58);
+INSERT INTO orders VALUES (1655, 945, 89);
+INSERT INTO orders VALUES (1656, 3864, 23);
+INSERT INTO orders VALUES (1657, 1783, 54);
+INSERT INTO orders VALUES (1658, 4702, 85);
+INSERT INTO orders VALUES (1659, 2621, 19);
+INSERT INTO orders VALUES (1660, 540, 50);
+INSERT INTO orders VALUES (1661, 3459, 81);
+INSERT INTO orders VALUES (1662, 1378, 15);
+INSERT INTO orders VALUES (1663, 4297, 46);
+INSERT INTO orders VALUES (1664, 2216, 77);
+INSERT INTO orders VALUES (1665, 135, 11);
+INSERT INTO orders VALUES (1666, 3054, 42);
+INSERT INTO orders VALUES (1667, 973, 73);
+INSERT INTO orders VALUES (1668, 3892, 7);
+INSERT INTO orders VALUES (1669, 1811, 38);
+INSERT INTO orders VALUES (1670, 4730, 69);
+INSERT INTO orders VALUES (1671, 2649, 3);
+INSERT INTO orders VALUES (1672, 568, 34);
+INSERT INTO orders VALUES (1673, 3487, 65);
+INSERT INTO orders VALUES (1674, 1406, 96);
+INSERT INTO orders VALUES (1675, 4325, 30);
+INSERT INTO orders VALUES (1676, 2244, 61);
+INSERT INTO orders VALUES (1677, 163, 92);
+INSERT INTO orders VALUES (1678, 3082, 26);
+INSERT INTO orders VALUES (1679, 1001, 57);
+INSERT INTO orders VALUES (1680, 3920, 88);
+INSERT INTO orders VALUES (1681, 1839, 22);
+INSERT INTO orders VALUES (1682, 4758, 53);
+INSERT INTO orders VALUES (1683, 2677, 84);
+INSERT INTO orders VALUES (1684, 596, 18);
+INSERT INTO orders VALUES (1685, 3515, 49);
+INSERT INTO orders VALUES (1686, 1434, 80);
+INSERT INTO orders VALUES (1687, 4353, 14);
+INSERT INTO orders VALUES (1688, 2272, 45);
+INSERT INTO orders VALUES (1689, 191, 76);
+INSERT INTO orders VALUES (1690, 3110, 10);
+INSERT INTO orders VALUES (1691, 1029, 41);
+INSERT INTO orders VALUES (1692, 3948, 72);
+INSERT INTO orders VALUES (1693, 1867, 6);
+INSERT INTO orders VALUES (1694, 4786, 37);
+INSERT INTO orders VALUES (1695, 2705, 68);
+INSERT INTO orders VALUES (1696, 624, 2);
+INSERT INTO orders VALUES (1697, 3543, 33);
+INSERT INTO orders VALUES (1698, 1462, 64);
+INSERT INTO orders VALUES (1699, 4381, 95);
+INSERT INTO orders VALUES (1700, 2300, 29);
+INSERT INTO orders VALUES (1701, 219, 60);
+INSERT INTO orders VALUES (1702, 3138, 91);
+INSERT INTO orders VALUES (1703, 1057, 25);
+INSERT INTO orders VALUES (1704, 3976, 56);
+INSERT INTO orders VALUES (1705, 1895, 87);
+INSERT INTO orders VALUES (1706, 4814, 21);
+INSERT INTO orders VALUES (1707, 2733, 52);
+INSERT INTO orders VALUES (1708, 652, 83);
+INSERT INTO orders VALUES (1709, 3571, 17);
+INSERT INTO orders VALUES (1710, 1490, 48);
+INSERT INTO orders VALUES (1711, 4409, 79);
+INSERT INTO orders VALUES (1712, 2328, 13);
+INSERT INTO orders VALUES (1713, 247, 44);
+INSERT INTO orders VALUES (1714, 3166, 75);
+INSERT INTO orders VALUES (1715, 1085, 9);
+INSERT INTO orders VALUES (1716, 4004, 40);
+INSERT INTO orders VALUES (1717, 1923, 71);
+INSERT INTO orders VALUES (1718, 4842, 5);
+INSERT INTO orders VALUES (1719, 2761, 36);
+INSERT INTO orders VALUES (1720, 680, 67);
+INSERT INTO orders VALUES (1721, 3599, 1);
+INSERT INTO orders VALUES (1722, 1518, 32);
+INSERT INTO orders VALUES (1723, 4437, 63);
+INSERT INTO orders VALUES (1724, 2356, 94);
+INSERT INTO orders VALUES (1725, 275, 28);
+INSERT INTO orders VALUES (1726, 3194, 59);
+INSERT INTO orders VALUES (1727, 1113, 90);
+INSERT INTO orders VALUES (1728, 4032, 24);
+INSERT INTO orders VALUES (1729, 1951, 55);
+INSERT INTO orders VALUES (1730, 4870, 86);
+INSERT INTO orders VALUES (1731, 2789, 20);
+INSERT INTO orders VALUES (1732, 708, 51);
+INSERT INTO orders VALUES (1733, 3627, 82);
+INSERT INTO orders VALUES (1734, 1546, 16);
+INSERT INTO orders VALUES (1735, 4465, 47);
+INSERT INTO orders VALUES (1736, 2384, 78);
+INSERT INTO orders VALUES (1737, 303, 12);
+INSERT INTO orders VALUES (1738, 3222, 43);
+INSERT INTO orders VALUES (1739, 1141, 74);
+INSERT INTO orders VALUES (1740, 4060, 8);
+INSERT INTO orders VALUES (1741, 1979, 39);
+INSERT INTO orders VALUES (1742, 4898, 70);
+INSERT INTO orders VALUES (1743, 2817, 4);
+INSERT INTO orders VALUES (1744, 736, 35);
+INSERT INTO orders VALUES (1745, 3655, 66);
+INSERT INTO orders VALUES (1746, 1574, 0);
+INSERT INTO orders VALUES (1747, 4493, 31);
+INSERT INTO orders VALUES (1748, 2412, 62);
+INSERT INTO orders VALUES (1749, 331, 93);
+INSERT INTO orders VALUES (1750, 3250, 27);
+INSERT INTO orders VALUES (1751, 1169, 58);
+INSERT INTO orders VALUES (1752, 4088, 89);
+INSERT INTO orders VALUES (1753, 2007, 23);
+INSERT INTO orders VALUES (1754, 4926, 54);
+INSERT INTO orders VALUES (1755, 2845, 85);
+INSERT INTO orders VALUES (1756, 764, 19);
+INSERT INTO orders VALUES (1757, 3683, 50);
+INSERT INTO orders VALUES (1758, 1602, 81);
+INSERT INTO orders VALUES (1759, 4521, 15);
+INSERT INTO orders VALUES (1760, 2440, 46);
+INSERT INTO orders VALUES (1761, 359, 77);
+INSERT INTO orders VALUES (1762, 3278, 11);
+INSERT INTO orders VALUES (1763, 1197, 42);
+INSERT INTO orders VALUES (1764, 4116, 73);
+INSERT INTO orders VALUES (1765, 2035, 7);
+INSERT INTO orders VALUES (1766, 4954, 38);
+INSERT INTO orders VALUES (1767, 2873, 69);
+INSERT INTO orders VALUES (1768, 792, 3);
+INSERT INTO orders VALUES (1769, 3711, 34);
+INSERT INTO orders VALUES (1770, 1630, 65);
+INSERT INTO orders VALUES (1771, 4549, 96);
+INSERT INTO orders VALUES (1772, 2468, 30);
+INSERT INTO orders VALUES (1773, 387, 61);
+INSERT INTO orders VALUES (1774, 3306, 92);
+INSERT INTO orders VALUES (1775, 1225, 26);
+INSERT INTO orders VALUES (1776, 4144, 57);
+INSERT INTO orders VALUES (1777, 2063, 88);
+INSERT INTO orders VALUES (1778, 4982, 22);
+INSERT INTO orders VALUES (1779, 2901, 53);
+INSERT INTO orders VALUES (1780, 820, 84);
+INSERT INTO orders VALUES (1781, 3739, 18);
+INSERT INTO orders VALUES (1782, 1658, 49);
+INSERT INTO orders VALUES (1783, 4577, 80);
+INSERT INTO orders VALUES (1784, 2496, 14);
+INSERT INTO orders VALUES (1785, 415, 45);
+INSERT INTO orders VALUES (1786, 3334, 76);
+INSERT INTO orders VALUES (1787, 1253, 10);
+INSERT INTO orders VALUES (1788, 4172, 41);
+INSERT INTO orders VALUES (1789, 2091, 72);
+INSERT INTO orders VALUES (1790, 10, 6);
+INSERT INTO orders VALUES (1791, 2929, 37);
+INSERT INTO orders VALUES (1792, 848, 68);
+INSERT INTO orders VALUES (1793, 3767, 2);
+INSERT INTO orders VALUES (1794, 1686, 33);
+INSERT INTO orders VALUES (1795, 4605, 64);
+INSERT INTO orders VALUES (1796, 2524, 95);
+INSERT INTO orders VALUES (1797, 443, 29);
+INSERT INTO orders VALUES (1798, 3362, 60);
+INSERT INTO orders VALUES (1799, 1281, 91);
+INSERT INTO orders VALUES (1800, 4200, 25);
+INSERT INTO orders VALUES (1801, 2119, 56);
+INSERT INTO orders VALUES (1802, 38, 87);
+INSERT INTO orders VALUES (1803, 2957, 21);
+INSERT INTO orders VALUES (1804, 876, 52);
+INSERT INTO orders VALUES (1805, 3795, 83);
+INSERT INTO orders VALUES (1806, 1714, 17);
+INSERT INTO orders VALUES (1807, 4633, 48);
+INSERT INTO orders VALUES (1808, 2552, 79);
+INSERT INTO orders VALUES (1809, 471, 13);
+INSERT INTO orders VALUES (1810, 3390, 44);
+INSERT INTO orders VALUES (1811, 1309, 75);
+INSERT INTO orders VALUES (1812, 4228, 9);
+INSERT INTO orders VALUES (1813, 2147, 40);
+INSERT INTO orders VALUES (1814, 66, 71);
+INSERT INTO orders VALUES (1815, 2985, 5);
+INSERT INTO orders VALUES (1816, 904, 36);
+INSERT INTO orders VALUES (1817, 3823, 67);
+INSERT INTO orders VALUES (1818, 1742, 1);
+INSERT INTO orders VALUES (1819, 4661, 32);
+INSERT INTO orders VALUES (1820, 2580, 63);
+INSERT INTO orders VALUES (1821, 499, 94);
+INSERT INTO orders VALUES (1822, 3418, 28);
+INSERT INTO orders VALUES (1823, 1337, 59);
+INSERT INTO orders VALUES (1824, 4256, 90);
+INSERT INTO orders VALUES (1825, 2175, 24);
+INSERT INTO orders VALUES (1826, 94, 55);
+INSERT INTO orders VALUES (1827, 3013, 86);
+INSERT INTO orders VALUES (1828, 932, 20);
+INSERT INTO orders VALUES (1829, 3851, 51);
+INSERT INTO orders VALUES (1830, 1770, 82);
+INSERT INTO orders VALUES (1831, 4689, 16);
+INSERT INTO orders VALUES (1832, 2608, 47);
+INSERT INTO orders VALUES (1833, 527, 78);
+INSERT INTO orders VALUES (1834, 3446, 12);
+INSERT INTO orders VALUES (1835, 1365, 43);
+INSERT INTO orders VALUES (1836, 4284, 74);
+INSERT INTO orders VALUES (1837, 2203, 8);
+INSERT INTO orders VALUES (1838, 122, 39);
+INSERT INTO orders VALUES (1839, 3041, 70);
+INSERT INTO orders VALUES (1840, 960, 4);
+INSERT INTO orders VALUES (1841, 3879, 35);
+INSERT INTO orders VALUES (1842, 1798, 66);
+INSERT INTO orders VALUES (1843, 4717, 0);
+INSERT INTO orders VALUES (1844, 2636, 31);
+INSERT INTO orders VALUES (1845, 555, 62);
+INSERT INTO orders VALUES (1846, 3474, 93);
+INSERT INTO orders VALUES (1847, 1393, 27);
+INSERT INTO orders VALUES (1848, 4312, 58);
+INSERT INTO orders VALUES (1849, 2231, 89);
+INSERT INTO orders VALUES (1850, 150, 23);
+INSERT INTO orders VALUES (1851, 3069, 54);
+INSERT INTO orders VALUES (1852, 988, 85);
+INSERT INTO orders VALUES (1853, 3907, 19);
+INSERT INTO orders VALUES (1854, 1826, 50);
+INSERT INTO orders VALUES (1855, 4745, 81);
+INSERT INTO orders VALUES (1856, 2664, 15);
+INSERT INTO orders VALUES (1857, 583, 46);
+INSERT INTO orders VALUES (1858, 3502, 77);
+INSERT INTO orders VALUES (1859, 1421, 11);
+INSERT INTO orders VALUES (1860, 4340, 42);
+INSERT INTO orders VALUES (1861, 2259, 73);
+INSERT INTO orders VALUES (1862, 178, 7);
+INSERT INTO orders VALUES (1863, 3097, 38);
+INSERT INTO orders VALUES (1864, 1016, 69);
+INSERT INTO orders VALUES (1865, 3935, 3);
+INSERT INTO orders VALUES (1866, 1854, 34);
+INSERT INTO orders VALUES (1867, 4773, 65);
+INSERT INTO orders VALUES (1868, 2692, 96);
+INSERT INTO orders VALUES (1869, 611, 30);
+INSERT INTO orders VALUES (1870, 3530, 61);
+INSERT INTO orders VALUES (1871, 1449, 92);
+INSERT INTO orders VALUES (1872, 4368, 26);
+INSERT INTO orders VALUES (1873, 2287, 57);
+INSERT INTO orders VALUES (1874, 206, 88);
+INSERT INTO orders VALUES (1875, 3125, 22);
+INSERT INTO orders VALUES (1876, 1044, 53);
+INSERT INTO orders VALUES (1877, 3963, 84);
+INSERT INTO orders VALUES (1878, 1882, 18);
+INSERT INTO orders VALUES (1879, 4801, 49);
+INSERT INTO orders VALUES (1880, 2720, 80);
+INSERT INTO orders VALUES (1881, 639, 14);
+INSERT INTO orders VALUES (1882, 3558, 45);
+INSERT INTO orders VALUES (1883, 1477, 76);
+INSERT INTO orders VALUES (1884, 4396, 10);
+INSERT INTO orders VALUES (1885, 2315, 41);
+INSERT INTO orders VALUES (1886, 234, 72);
+INSERT INTO orders VALUES (1887, 3153, 6);
+INSERT INTO orders VALUES (1888, 1072, 37);
+INSERT INTO orders VALUES (1889, 3991, 68);
+INSERT INTO orders VALUES (1890, 1910, 2);
+INSERT INTO orders VALUES (1891, 4829, 33);
+INSERT INTO orders VALUES (1892, 2748, 64);
+INSERT INTO orders VALUES (1893, 667, 95);
+INSERT INTO orders VALUES (1894, 3586, 29);
+INSERT INTO orders VALUES (1895, 1505, 60);
+INSERT INTO orders VALUES (1896, 4424, 91);
+INSERT INTO orders VALUES (1897, 2343, 25);
+INSERT INTO orders VALUES (1898, 262, 56);
+INSERT INTO orders VALUES (1899, 3181, 87);
+INSERT INTO orders VALUES (1900, 1100, 21);
+INSERT INTO orders VALUES (1901, 4019, 52);
+INSERT INTO orders VALUES (1902, 1938, 83);
+INSERT INTO orders VALUES (1903, 4857, 17);
+INSERT INTO orders VALUES (1904, 2776, 48);
+INSERT INTO orders VALUES (1905, 695, 79);
+INSERT INTO orders VALUES (1906, 3614, 13);
+INSERT INTO orders VALUES (1907, 1533, 44);
+INSERT INTO orders VALUES (1908, 4452, 75);
+INSERT INTO orders VALUES (1909, 2371, 9);
+INSERT INTO orders VALUES (1910, 290, 40);
+INSERT INTO orders VALUES (1911, 3209, 71);
+INSERT INTO orders VALUES (1912, 1128, 5);
+INSERT INTO orders VALUES (1913, 4047, 36);
+INSERT INTO orders VALUES (1914, 1966, 67);
+INSERT INTO orders VALUES (1915, 4885, 1);
+INSERT INTO orders VALUES (1916, 2804, 32);
+INSERT INTO orders VALUES (1917, 723, 63);
+INSERT INTO orders VALUES (1918, 3642, 94);
+INSERT INTO orders VALUES (1919, 1561, 28);
+INSERT INTO orders VALUES (1920, 4480, 59);
+INSERT INTO orders VALUES (1921, 2399, 90);
+INSERT INTO orders VALUES (1922, 318, 24);
+INSERT INTO orders VALUES (1923, 3237, 55);
+INSERT INTO orders VALUES (1924, 1156, 86);
+INSERT INTO orders VALUES (1925, 4075, 20);
+INSERT INTO orders VALUES (1926, 1994, 51);
+INSERT INTO orders VALUES (1927, 4913, 82);
+INSERT INTO orders VALUES (1928, 2832, 16);
+INSERT INTO orders VALUES (1929, 751, 47);
+INSERT INTO orders VALUES (1930, 3670, 78);
+INSERT INTO orders VALUES (1931, 1589, 12);
+INSERT INTO orders VALUES (1932, 4508, 43);
+INSERT INTO orders VALUES (1933, 2427, 74);
+INSERT INTO orders VALUES (1934, 346, 8);
+INSERT INTO orders VALUES (1935, 3265, 39);
+INSERT INTO orders VALUES (1936, 1184, 70);
+INSERT INTO orders VALUES (1937, 4103, 4);
+INSERT INTO orders VALUES (1938, 2022, 35);
+INSERT INTO orders VALUES (1939, 4941, 66);
+INSERT INTO orders VALUES (1940, 2860, 0);
+INSERT INTO orders VALUES (1941, 779, 31);
+INSERT INTO orders VALUES (1942, 3698, 62);
+INSERT INTO orders VALUES (1943, 1617, 93);
+INSERT INTO orders VALUES (1944, 4536, 27);
+INSERT INTO orders VALUES (1945, 2455, 58);
+INSERT INTO orders VALUES (1946, 374, 89);
+INSERT INTO orders VALUES (1947, 3293, 23);
+INSERT INTO orders VALUES (1948, 1212, 54);
+INSERT INTO orders VALUES (1949, 4131, 85);
+INSERT INTO orders VALUES (1950, 2050, 19);
+INSERT INTO orders VALUES (1951, 4969, 50);
+INSERT INTO orders VALUES (1952, 2888, 81);
+INSERT INTO orders VALUES (1953, 807, 15);
+INSERT INTO orders VALUES (1954, 3726, 46);
+INSERT INTO orders VALUES (1955, 1645, 77);
+INSERT INTO orders VALUES (1956, 4564, 11);
+INSERT INTO orders VALUES (1957, 2483, 42);
+INSERT INTO orders VALUES (1958, 402, 73);
+INSERT INTO orders VALUES (1959, 3321, 7);
+INSERT INTO orders VALUES (1960, 1240, 38);
+INSERT INTO orders VALUES (1961, 4159, 69);
+INSERT INTO orders VALUES (1962, 2078, 3);
+INSERT INTO orders VALUES (1963, 4997, 34);
+INSERT INTO orders VALUES (1964, 2916, 65);
+INSERT INTO orders VALUES (1965, 835, 96);
+INSERT INTO orders VALUES (1966, 3754, 30);
+INSERT INTO orders VALUES (1967, 1673, 61);
+INSERT INTO orders VALUES (1968, 4592, 92);
+INSERT INTO orders VALUES (1969, 2511, 26);
+INSERT INTO orders VALUES (1970, 430, 57);
+INSERT INTO orders VALUES (1971, 3349, 88);
+INSERT INTO orders VALUES (1972, 1268, 22);
+INSERT INTO orders VALUES (1973, 4187, 53);
+INSERT INTO orders VALUES (1974, 2106, 84);
+INSERT INTO orders VALUES (1975, 25, 18);
+INSERT INTO orders VALUES (1976, 2944, 49);
+INSERT INTO orders VALUES (1977, 863, 80);
+INSERT INTO orders VALUES (1978, 3782, 14);
+INSERT INTO orders VALUES (1979, 1701, 45);
+INSERT INTO orders VALUES (1980, 4620, 76);
+INSERT INTO orders VALUES (1981, 2539, 10);
+INSERT INTO orders VALUES (1982, 458, 41);
+INSERT INTO orders VALUES (1983, 3377, 72);
+INSERT INTO orders VALUES (1984, 1296, 6);
+INSERT INTO orders VALUES (1985, 4215, 37);
+INSERT INTO orders VALUES (1986, 2134, 68);
+INSERT INTO orders VALUES (1987, 53, 2);
+INSERT INTO orders VALUES (1988, 2972, 33);
+INSERT INTO orders VALUES (1989, 891, 64);
+INSERT INTO orders VALUES (1990, 3810, 95);
+INSERT INTO orders VALUES (1991, 1729, 29);
+INSERT INTO orders VALUES (1992, 4648, 60);
+INSERT INTO orders VALUES (1993, 2567, 91);
+INSERT INTO orders VALUES (1994, 486, 25);
+INSERT INTO orders VALUES (1995, 3405, 56);
+INSERT INTO orders VALUES (1996, 1324, 87);
+INSERT INTO orders VALUES (1997, 4243, 21);
+INSERT INTO orders VALUES (1998, 2162, 52);
+INSERT INTO orders VALUES (1999, 81, 83);
+INSERT INTO orders VALUES (2000, 3000, 17);
+INSERT INTO orders VALUES (2001, 919, 48);
+INSERT INTO orders VALUES (2002, 3838, 79);
+INSERT INTO orders VALUES (2003, 1757, 13);
+INSERT INTO orders VALUES (2004, 4676, 44);
+INSERT INTO orders VALUES (2005, 2595, 75);
+INSERT INTO orders VALUES (2006, 514, 9);
+INSERT INTO orders VALUES (2007, 3433, 40);
+INSERT INTO orders VALUES (2008, 1352, 71);
+INSERT INTO orders VALUES (2009, 4271, 5);
+INSERT INTO orders VALUES (2010, 2190, 36);
+INSERT INTO orders VALUES (2011, 109, 67);
+INSERT INTO orders VALUES (2012, 3028, 1);
+INSERT INTO orders VALUES (2013, 947, 32);
+INSERT INTO orders VALUES (2014, 3866, 63);
+INSERT INTO orders VALUES (2015, 1785, 94);
+INSERT INTO orders VALUES (2016, 4704, 28);
+INSERT INTO orders VALUES (2017, 2623, 59);
+INSERT INTO orders VALUES (2018, 542, 90);
+INSERT INTO orders VALUES (2019, 3461, 24);
+INSERT INTO orders VALUES (2020, 1380, 55);
+INSERT INTO orders VALUES (2021, 4299, 86);
+INSERT INTO orders VALUES (2022, 2218, 20);
+INSERT INTO orders VALUES (2023, 137, 51);
+INSERT INTO orders VALUES (2024, 3056, 82);
+INSERT INTO orders VALUES (2025, 975, 16);
+INSERT INTO orders VALUES (2026, 3894, 47);
+INSERT INTO orders VALUES (2027, 1813, 78);
+INSERT INTO orders VALUES (2028, 4732, 12);
+INSERT INTO orders VALUES (2029, 2651, 43);
+INSERT INTO orders VALUES (2030, 570, 74);
+INSERT INTO orders VALUES (2031, 3489, 8);
+INSERT INTO orders VALUES (2032, 1408, 39);
+INSERT INTO orders VALUES (2033, 4327, 70);
+INSERT INTO orders VALUES (2034, 2246, 4);
+INSERT INTO orders VALUES (2035, 165, 35);
+INSERT INTO orders VALUES (2036, 3084, 66);
+INSERT INTO orders VALUES (2037, 1003, 0);
+INSERT INTO orders VALUES (2038, 3922, 31);
+INSERT INTO orders VALUES (2039, 1841, 62);
+INSERT INTO orders VALUES (2040, 4760, 93);
+INSERT INTO orders VALUES (2041, 2679, 27);
+INSERT INTO orders VALUES (2042, 598, 58);
+INSERT INTO orders VALUES (2043, 3517, 89);
+INSERT INTO orders VALUES (2044, 1436, 23);
+INSERT INTO orders VALUES (2045, 4355, 54);
+INSERT INTO orders VALUES (2046, 2274, 85);
+INSERT INTO orders VALUES (2047, 193, 19);
+INSERT INTO orders VALUES (2048, 3112, 50);
+INSERT INTO orders VALUES (2049, 1031, 81);
+INSERT INTO orders VALUES (2050, 3950, 15);
+INSERT INTO orders VALUES (2051, 1869, 46);
+INSERT INTO orders VALUES (2052, 4788, 77);
+INSERT INTO orders VALUES (2053, 2707, 11);
+INSERT INTO orders VALUES (2054, 626, 42);
+INSERT INTO orders VALUES (2055, 3545, 73);
+INSERT INTO orders VALUES (2056, 1464, 7);
+INSERT INTO orders VALUES (2057, 4383, 38);
+INSERT INTO orders VALUES (2058, 2302, 69);
+INSERT INTO orders VALUES (2059, 221, 3);
+INSERT INTO orders VALUES (2060, 3140, 34);
+INSERT INTO orders VALUES (2061, 1059, 65);
+INSERT INTO orders VALUES (2062, 3978, 96);
+INSERT INTO orders VALUES (2063, 1897, 30);
+INSERT INTO orders VALUES (2064, 4816, 61);
+INSERT INTO orders VALUES (2065, 2735, 92);
+INSERT INTO orders VALUES (2066, 654, 26);
+INSERT INTO orders VALUES (2067, 3573, 57);
+INSERT INTO orders VALUES (2068, 1492, 88);
+INSERT INTO orders VALUES (2069, 4411, 22);
+INSERT INTO orders VALUES (2070, 2330, 53);
+INSERT INTO orders VALUES (2071, 249, 84);
+INSERT INTO orders VALUES (2072, 3168, 18);
+INSERT INTO orders VALUES (2073, 1087, 49);
+INSERT INTO orders VALUES (2074, 4006, 80);
+INSERT INTO orders VALUES (2075, 1925, 14);
+INSERT INTO orders VALUES (2076, 4844, 45);
+INSERT INTO orders VALUES (2077, 2763, 76);
+INSERT INTO orders VALUES (2078, 682, 10);
+INSERT INTO orders VALUES (2079, 3601, 41);
+INSERT INTO orders VALUES (2080, 1520, 72);
+INSERT INTO orders VALUES (2081, 4439, 6);
+INSERT INTO orders VALUES (2082, 2358, 37);
+INSERT INTO orders VALUES (2083, 277, 68);
+INSERT INTO orders VALUES (2084, 3196, 2);
+INSERT INTO orders VALUES (2085, 1115, 33);
+INSERT INTO orders VALUES (2086, 4034, 64);
+INSERT INTO orders VALUES (2087, 1953, 95);
+INSERT INTO orders VALUES (2088, 4872, 29);
+INSERT INTO orders VALUES (2089, 2791, 60);
+INSERT INTO orders VALUES (2090, 710, 91);
+INSERT INTO orders VALUES (2091, 3629, 25);
+INSERT INTO orders VALUES (2092, 1548, 56);
+INSERT INTO orders VALUES (2093, 4467, 87);
+INSERT INTO orders VALUES (2094, 2386, 21);
+INSERT INTO orders VALUES (2095, 305, 52);
+INSERT INTO orders VALUES (2096, 3224, 83);
+INSERT INTO orders VALUES (2097, 1143, 17);
+INSERT INTO orders VALUES (2098, 4062, 48);
+INSERT INTO orders VALUES (2099, 1981, 79);
+INSERT INTO orders VALUES (2100, 4900, 13);
+INSERT INTO orders VALUES (2101, 2819, 44);
+INSERT INTO orders VALUES (2102, 738, 75);
+INSERT INTO orders VALUES (2103, 3657, 9);
+INSERT INTO orders VALUES (2104, 1576, 40);
+INSERT INTO orders VALUES (2105, 4495, 71);
+INSERT INTO orders VALUES (2106, 2414, 5);
+INSERT INTO orders VALUES (2107, 333, 36);
+INSERT INTO orders VALUES (2108, 3252, 67);
+INSERT INTO orders VALUES (2109, 1171, 1);
+INSERT INTO orders VALUES (2110, 4090, 32);
+INSERT INTO orders VALUES (2111, 2009, 63);
+INSERT INTO orders VALUES (2112, 4928, 94);
+INSERT INTO orders VALUES (2113, 2847, 28);
+INSERT INTO orders VALUES (2114, 766, 59);
+INSERT INTO orders VALUES (2115, 3685, 90);
+INSERT INTO orders VALUES (2116, 1604, 24);
+INSERT INTO orders VALUES (2117, 4523, 55);
+INSERT INTO orders VALUES (2118, 2442, 86);
+INSERT INTO orders VALUES (2119, 361, 20);
+INSERT INTO orders VALUES (2120, 3280, 51);
+INSERT INTO orders VALUES (2121, 1199, 82);
+INSERT INTO orders VALUES (2122, 4118, 16);
+INSERT INTO orders VALUES (2123, 2037, 47);
+INSERT INTO orders VALUES (2124, 4956, 78);
+INSERT INTO orders VALUES (2125, 2875, 12);
+INSERT INTO orders VALUES (2126, 794, 43);
+INSERT INTO orders VALUES (2127, 3713, 74);
+INSERT INTO orders VALUES (2128, 1632, 8);
+INSERT INTO orders VALUES (2129, 4551, 39);
+INSERT INTO orders VALUES (2130, 2470, 70);
+INSERT INTO orders VALUES (2131, 389, 4);
+INSERT INTO orders VALUES (2132, 3308, 35);
+INSERT INTO orders VALUES (2133, 1227, 66);
+INSERT INTO orders VALUES (2134, 4146, 0);
+INSERT INTO orders VALUES (2135, 2065, 31);
+INSERT INTO orders VALUES (2136, 4984, 62);
+INSERT INTO orders VALUES (2137, 2903, 93);
+INSERT INTO orders VALUES (2138, 822, 27);
+INSERT INTO orders VALUES (2139, 3741, 58);
+INSERT INTO orders VALUES (2140, 1660, 89);
+INSERT INTO orders VALUES (2141, 4579, 23);
+INSERT INTO orders VALUES (2142, 2498, 54);
+INSERT INTO orders VALUES (2143, 417, 85);
+INSERT INTO orders VALUES (2144, 3336, 19);
+INSERT INTO orders VALUES (2145, 1255, 50);
+INSERT INTO orders VALUES (2146, 4174, 81);
+INSERT INTO orders VALUES (2147, 2093, 15);
+INSERT INTO orders VALUES (2148, 12, 46);
+INSERT INTO orders VALUES (2149, 2931, 77);
+INSERT INTO orders VALUES (2150, 850, 11);
+INSERT INTO orders VALUES (2151, 3769, 42);
+INSERT INTO orders VALUES (2152, 1688, 73);
+INSERT INTO orders VALUES (2153, 4607, 7);
+INSERT INTO orders VALUES (2154, 2526, 38);
+INSERT INTO orders VALUES (2155, 445, 69);
+INSERT INTO orders VALUES (2156, 3364, 3);
+INSERT INTO orders VALUES (2157, 1283, 34);
+INSERT INTO orders VALUES (2158, 4202, 65);
+INSERT INTO orders VALUES (2159, 2121, 96);
+INSERT INTO orders VALUES (2160, 40, 30);
+INSERT INTO orders VALUES (2161, 2959, 61);
+INSERT INTO orders VALUES (2162, 878, 92);
+INSERT INTO orders VALUES (2163, 3797, 26);
+INSERT INTO orders VALUES (2164, 1716, 57);
+INSERT INTO orders VALUES (2165, 4635, 88);
+INSERT INTO orders VALUES (2166, 2554, 22);
+INSERT INTO orders VALUES (2167, 473, 53);
+INSERT INTO orders VALUES (2168, 3392, 84);
+INSERT INTO orders VALUES (2169, 1311, 18);
+INSERT INTO orders VALUES (2170, 4230, 49);
+INSERT INTO orders VALUES (2171, 2149, 80);
+INSERT INTO orders VALUES (2172, 68, 14);
+INSERT INTO orders VALUES (2173, 2987, 45);
+INSERT INTO orders VALUES (2174, 906, 76);
+INSERT INTO orders VALUES (2175, 3825, 10);
+INSERT INTO orders VALUES (2176, 1744, 41);
+INSERT INTO orders VALUES (2177, 4663, 72);
+INSERT INTO orders VALUES (2178, 2582, 6);
+INSERT INTO orders VALUES (2179, 501, 37);
+INSERT INTO orders VALUES (2180, 3420, 68);
+INSERT INTO orders VALUES (2181, 1339, 2);
+INSERT INTO orders VALUES (2182, 4258, 33);
+INSERT INTO orders VALUES (2183, 2177, 64);
+INSERT INTO orders VALUES (2184, 96, 95);
+INSERT INTO orders VALUES (2185, 3015, 29);
+INSERT INTO orders VALUES (2186, 934, 60);
+INSERT INTO orders VALUES (2187, 3853, 91);
+INSERT INTO orders VALUES (2188, 1772, 25);
+INSERT INTO orders VALUES (2189, 4691, 56);
+INSERT INTO orders VALUES (2190, 2610, 87);
+INSERT INTO orders VALUES (2191, 529, 21);
+INSERT INTO orders VALUES (2192, 3448, 52);
+INSERT INTO orders VALUES (2193, 1367, 83);
+INSERT INTO orders VALUES (2194, 4286, 17);
+INSERT INTO orders VALUES (2195, 2205, 48);
+INSERT INTO orders VALUES (2196, 124, 79);
+INSERT INTO orders VALUES (2197, 3043, 13);
+INSERT INTO orders VALUES (2198, 962, 44);
+INSERT INTO orders VALUES (2199, 3881, 75);
+INSERT INTO orders VALUES (2200, 1800, 9);
+INSERT INTO orders VALUES (2201, 4719, 40);
+INSERT INTO orders VALUES (2202, 2638, 71);
+INSERT INTO orders VALUES (2203, 557, 5);
+INSERT INTO orders VALUES (2204, 3476, 36);
+INSERT INTO orders VALUES (2205, 1395, 67);
+INSERT INTO orders VALUES (2206, 4314, 1);
+INSERT INTO orders VALUES (2207, 2233, 32);
+INSERT INTO orders VALUES (2208, 152, 63);
+INSERT INTO orders VALUES (2209, 3071, 94);
+INSERT INTO orders VALUES (2210, 990, 28);
+INSERT INTO orders VALUES (2211, 3909, 59);
+INSERT INTO orders VALUES (2212, 1828, 90);
+INSERT INTO orders VALUES (2213, 4747, 24);
+INSERT INTO orders VALUES (2214, 2666, 55);
+INSERT INTO orders VALUES (2215, 585, 86);
+INSERT INTO orders VALUES (2216, 3504, 20);
+INSERT INTO orders VALUES (2217, 1423, 51);
+INSERT INTO orders VALUES (2218, 4342, 82);
+INSERT INTO orders VALUES (2219, 2261, 16);
+INSERT INTO orders VALUES (2220, 180, 47);
+INSERT INTO orders VALUES (2221, 3099, 78);
+INSERT INTO orders VALUES (2222, 1018, 12);
+INSERT INTO orders VALUES (2223, 3937, 43);
+INSERT INTO orders VALUES (2224, 1856, 74);
+INSERT INTO orders VALUES (2225, 4775, 8);
+INSERT INTO orders VALUES (2226, 2694, 39);
+INSERT INTO orders VALUES (2227, 613, 70);
+INSERT INTO orders VALUES (2228, 3532, 4);
+INSERT INTO orders VALUES (2229, 1451, 35);
+INSERT INTO orders VALUES (2230, 4370, 66);
+INSERT INTO orders VALUES (2231, 2289, 0);
+INSERT INTO orders VALUES (2232, 208, 31);
+INSERT INTO orders VALUES (2233, 3127, 62);
+INSERT INTO orders VALUES (2234, 1046, 93);
+INSERT INTO orders VALUES (2235, 3965, 27);
+INSERT INTO orders VALUES (2236, 1884, 58);
+INSERT INTO orders VALUES (2237, 4803, 89);
+INSERT INTO orders VALUES (2238, 2722, 23);
+INSERT INTO orders VALUES (2239, 641, 54);
+INSERT INTO orders VALUES (2240, 3560, 85);
+INSERT INTO orders VALUES (2241, 1479, 19);
+INSERT INTO orders VALUES (2242, 4398, 50);
+INSERT INTO orders VALUES (2243, 2317, 81);
+INSERT INTO orders VALUES (2244, 236, 15);
+INSERT INTO orders VALUES (2245, 3155, 46);
+INSERT INTO orders VALUES (2246, 1074, 77);
+INSERT INTO orders VALUES (2247, 3993, 11);
+INSERT INTO orders VALUES (2248, 1912, 42);
+INSERT INTO orders VALUES (2249, 4831, 73);
+INSERT INTO orders VALUES (2250, 2750, 7);
+INSERT INTO orders VALUES (2251, 669, 38);
+INSERT INTO orders VALUES (2252, 3588, 69);
+INSERT INTO orders VALUES (2253, 1507, 3);
+INSERT INTO orders VALUES (2254, 4426, 34);
+INSERT INTO orders VALUES (2255, 2345, 65);
+INSERT INTO orders VALUES (2256, 264, 96);
+INSERT INTO orders VALUES (2257, 3183, 30);
+INSERT INTO orders VALUES (2258, 1102, 61);
+INSERT INTO orders VALUES (2259, 4021, 92);
+INSERT INTO orders VALUES (2260, 1940, 26);
+INSERT INTO orders VALUES (2261, 4859, 57);
+INSERT INTO orders VALUES (2262, 2778, 88);
+INSERT INTO orders VALUES (2263, 697, 22);
+INSERT INTO orders VALUES (2264, 3616, 53);
+INSERT INTO orders VALUES (2265, 1535, 84);
+INSERT INTO orders VALUES (2266, 4454, 18);
+INSERT INTO orders VALUES (2267, 2373, 49);
+INSERT INTO orders VALUES (2268, 292, 80);
+INSERT INTO orders VALUES (2269, 3211, 14);
+INSERT INTO orders VALUES (2270, 1130, 45);
+INSERT INTO orders VALUES (2271, 4049, 76);
+INSERT INTO orders VALUES (2272, 1968, 10);
+INSERT INTO orders VALUES (2273, 4887, 41);
+INSERT INTO orders VALUES (2274, 2806, 72);
+INSERT INTO orders VALUES (2275, 725, 6);
+INSERT INTO orders VALUES (2276, 3644, 37);
+INSERT INTO orders VALUES (2277, 1563, 68);
+INSERT INTO orders VALUES (2278, 4482, 2);
+INSERT INTO orders VALUES (2279, 2401, 33);
+INSERT INTO orders VALUES (2280, 320, 64);
+INSERT INTO orders VALUES (2281, 3239, 95);
+INSERT INTO orders VALUES (2282, 1158, 29);
+INSERT INTO orders VALUES (2283, 4077, 60);
+INSERT INTO orders VALUES (2284, 1996, 91);
+INSERT INTO orders VALUES (2285, 4915, 25);
+INSERT INTO orders VALUES (2286, 2834, 56);
+INSERT INTO orders VALUES (2287, 753, 87);
+INSERT INTO orders VALUES (2288, 3672, 21);
+INSERT INTO orders VALUES (2289, 1591, 52);
+INSERT INTO orders VALUES (2290, 4510, 83);
+INSERT INTO orders VALUES (2291, 2429, 17);
+INSERT INTO orders VALUES (2292, 348, 48);
+INSERT INTO orders VALUES (2293, 3267, 79);
+INSERT INTO orders VALUES (2294, 1186, 13);
+INSERT INTO orders VALUES (2295, 4105, 44);
+INSERT INTO orders VALUES (2296, 2024, 75);
+INSERT INTO orders VALUES (2297, 4943, 9);
+INSERT INTO orders VALUES (2298, 2862, 40);
+INSERT INTO orders VALUES (2299, 781, 71);
+INSERT INTO orders VALUES (2300, 3700, 5);
+INSERT INTO orders VALUES (2301, 1619, 36);
+INSERT INTO orders VALUES (2302, 4538, 67);
+INSERT INTO orders VALUES (2303, 2457, 1);
+INSERT INTO orders VALUES (2304, 376, 32);
+INSERT INTO orders VALUES (2305, 3295, 63);
+INSERT INTO orders VALUES (2306, 1214, 94);
+INSERT INTO orders VALUES (2307, 4133, 28);
+INSERT INTO orders VALUES (2308, 2052, 59);
+INSERT INTO orders VALUES (2309, 4971, 90);
+INSERT INTO orders VALUES (2310, 2890, 24);
+INSERT INTO orders VALUES (2311, 809, 55);
+INSERT INTO orders VALUES (2312, 3728, 86);
+INSERT INTO orders VALUES (2313, 1647, 20);
+INSERT INTO orders VALUES (2314, 4566, 51);
+INSERT INTO orders VALUES (2315, 2485, 82);
+INSERT INTO orders VALUES (2316, 404, 16);
+INSERT INTO orders VALUES (2317, 3323, 47);
+INSERT INTO orders VALUES (2318, 1242, 78);
+INSERT INTO orders VALUES (2319, 4161, 12);
+INSERT INTO orders VALUES (2320, 2080, 43);
+INSERT INTO orders VALUES (2321, 4999, 74);
+INSERT INTO orders VALUES (2322, 2918, 8);
+INSERT INTO orders VALUES (2323, 837, 39);
+INSERT INTO orders VALUES (2324, 3756, 70);
+INSERT INTO orders VALUES (2325, 1675, 4);
+INSERT INTO orders VALUES (2326, 4594, 35);
+INSERT INTO orders VALUES (2327, 2513, 66);
+INSERT INTO orders VALUES (2328, 432, 0);
+INSERT INTO orders VALUES (2329, 3351, 31);
+INSERT INTO orders VALUES (2330, 1270, 62);
+INSERT INTO orders VALUES (2331, 4189, 93);
+INSERT INTO orders VALUES (2332, 2108, 27);
+INSERT INTO orders VALUES (2333, 27, 58);
+INSERT INTO orders VALUES (2334, 2946, 89);
+INSERT INTO orders VALUES (2335, 865, 23);
+INSERT INTO orders VALUES (2336, 3784, 54);
+INSERT INTO orders VALUES (2337, 1703, 85);
+INSERT INTO orders VALUES (2338, 4622, 19);
+INSERT INTO orders VALUES (2339, 2541, 50);
+INSERT INTO orders VALUES (2340, 460, 81);
+INSERT INTO orders VALUES (2341, 3379, 15);
+INSERT INTO orders VALUES (2342, 1298, 46);
+INSERT INTO orders VALUES (2343, 4217, 77);
+INSERT INTO orders VALUES (2344, 2136, 11);
+INSERT INTO orders VALUES (2345, 55, 42);
+INSERT INTO orders VALUES (2346, 2974, 73);
+INSERT INTO orders VALUES (2347, 893, 7);
+INSERT INTO orders VALUES (2348, 3812, 38);
+INSERT INTO orders VALUES (2349, 1731, 69);
+INSERT INTO orders VALUES (2350, 4650, 3);
+INSERT INTO orders VALUES (2351, 2569, 34);
+INSERT INTO orders VALUES (2352, 488, 65);
+INSERT INTO orders VALUES (2353, 3407, 96);
+INSERT INTO orders VALUES (2354, 1326, 30);
+INSERT INTO orders VALUES (2355, 4245, 61);
+INSERT INTO orders VALUES (2356, 2164, 92);
+INSERT INTO orders VALUES (2357, 83, 26);
+INSERT INTO orders VALUES (2358, 3002, 57);
+INSERT INTO orders VALUES (2359, 921, 88);
+INSERT INTO orders VALUES (2360, 3840, 22);
+INSERT INTO orders VALUES (2361, 1759, 53);
+INSERT INTO orders VALUES (2362, 4678, 84);
+INSERT INTO orders VALUES (2363, 2597, 18);
+INSERT INTO orders VALUES (2364, 516, 49);
+INSERT INTO orders VALUES (2365, 3435, 80);
+INSERT INTO orders VALUES (2366, 1354, 14);
+INSERT INTO orders VALUES (2367, 4273, 45);
+INSERT INTO orders VALUES (2368, 2192, 76);
+INSERT INTO orders VALUES (2369, 111, 10);
+INSERT INTO orders VALUES (2370, 3030, 41);
+INSERT INTO orders VALUES (2371, 949, 72);
+INSERT INTO orders VALUES (2372, 3868, 6);
+INSERT INTO orders VALUES (2373, 1787, 37);
+INSERT INTO orders VALUES (2374, 4706, 68);
+INSERT INTO orders VALUES (2375, 2625, 2);
+INSERT INTO orders VALUES (2376, 544, 33);
+INSERT INTO orders VALUES (2377, 3463, 64);
+INSERT INTO orders VALUES (2378, 1382, 95);
+INSERT INTO orders VALUES (2379, 4301, 29);
+INSERT INTO orders VALUES (2380, 2220, 60);
+INSERT INTO orders VALUES (2381, 139, 91);
+INSERT INTO orders VALUES (2382, 3058, 25);
+INSERT INTO orders VALUES (2383, 977, 56);
+INSERT INTO orders VALUES (2384, 3896, 87);
+INSERT INTO orders VALUES (2385, 1815, 21);
+INSERT INTO orders VALUES (2386, 4734, 52);
+INSERT INTO orders VALUES (2387, 2653, 83);
+INSERT INTO orders VALUES (2388, 572, 17);
+INSERT INTO orders VALUES (2389, 3491, 48);
+INSERT INTO orders VALUES (2390, 1410, 79);
+INSERT INTO orders VALUES (2391, 4329, 13);
+INSERT INTO orders VALUES (2392, 2248, 44);
+INSERT INTO orders VALUES (2393, 167, 75);
+INSERT INTO orders VALUES (2394, 3086, 9);
+INSERT INTO orders VALUES (2395, 1005, 40);
+INSERT INTO orders VALUES (2396, 3924, 71);
+INSERT INTO orders VALUES (2397, 1843, 5);
+INSERT INTO orders VALUES (2398, 4762, 36);
+INSERT INTO orders VALUES (2399, 2681, 67);
+INSERT INTO orders VALUES (2400, 600, 1);
+INSERT INTO orders VALUES (2401, 3519, 32);
+INSERT INTO orders VALUES (2402, 1438, 63);
+INSERT INTO orders VALUES (2403, 4357, 94);
+INSERT INTO orders VALUES (2404, 2276, 28);
+INSERT INTO orders VALUES (2405, 195, 59);
+INSERT INTO orders VALUES (2406, 3114, 90);
+INSERT INTO orders VALUES (2407, 1033, 24);
+INSERT INTO orders VALUES (2408, 3952, 55);
+INSERT INTO orders VALUES (2409, 1871, 86);
+INSERT INTO orders VALUES (2410, 4790, 20);
+INSERT INTO orders VALUES (2411, 2709, 51);
+INSERT INTO orders VALUES (2412, 628, 82);
+INSERT INTO orders VALUES (2413, 3547, 16);
+INSERT INTO orders VALUES (2414, 1466, 47);
+INSERT INTO orders VALUES (2415, 4385, 78);
+INSERT INTO orders VALUES (2416, 2304, 12);
+INSERT INTO orders VALUES (2417, 223, 43);
+INSERT INTO orders VALUES (2418, 3142, 74);
+INSERT INTO orders VALUES (2419, 1061, 8);
+INSERT INTO orders VALUES (2420, 3980, 39);
+INSERT INTO orders VALUES (2421, 1899, 70);
+INSERT INTO orders VALUES (2422, 4818, 4);
+INSERT INTO orders VALUES (2423, 2737, 35);
+INSERT INTO orders VALUES (2424, 656, 66);
+INSERT INTO orders VALUES (2425, 3575, 0);
+INSERT INTO orders VALUES (2426, 1494, 31);
+INSERT INTO orders VALUES (2427, 4413, 62);
+INSERT INTO orders VALUES (2428, 2332, 93);
+INSERT INTO orders VALUES (2429, 251, 27);
+INSERT INTO orders VALUES (2430, 3170, 58);
+INSERT INTO orders VALUES (2431, 1089, 89);
+INSERT INTO orders VALUES (2432, 4008, 23);
+INSERT INTO orders VALUES (2433, 1927, 54);
+INSERT INTO orders VALUES (2434, 4846, 85);
+INSERT INTO orders VALUES (2435, 2765, 19);
+INSERT INTO orders VALUES (2436, 684, 50);
+INSERT INTO orders VALUES (2437, 3603, 81);
+INSERT INTO orders VALUES (2438, 1522, 15);
+INSERT INTO orders VALUES (2439, 4441, 46);
+INSERT INTO orders VALUES (2440, 2360, 77);
+INSERT INTO orders VALUES (2441, 279, 11);
+INSERT INTO orders VALUES (2442, 3198, 42);
+INSERT INTO orders VALUES (2443, 1117, 73);
+INSERT INTO orders VALUES (2444, 4036, 7);
+INSERT INTO orders VALUES (2445, 1955, 38);
+INSERT INTO orders VALUES (2446, 4874, 69);
+INSERT INTO orders VALUES (2447, 2793, 3);
+INSERT INTO orders VALUES (2448, 712, 34);
+INSERT INTO orders VALUES (2449, 3631, 65);
+INSERT INTO orders VALUES (2450, 1550, 96);
+INSERT INTO orders VALUES (2451, 4469, 30);
+INSERT INTO orders VALUES (2452, 2388, 61);
+INSERT INTO orders VALUES (2453, 307, 92);
+INSERT INTO orders VALUES (2454, 3226, 26);
+INSERT INTO orders VALUES (2455, 1145, 57);
+INSERT INTO orders VALUES (2456, 4064, 88);
+INSERT INTO orders VALUES (2457, 1983, 22);
+INSERT INTO orders VALUES (2458, 4902, 53);
+INSERT INTO orders VALUES (2459, 2821, 84);
+INSERT INTO orders VALUES (2460, 740, 18);
+INSERT INTO orders VALUES (2461, 3659, 49);
+INSERT INTO orders VALUES (2462, 1578, 80);
+INSERT INTO orders VALUES (2463, 4497, 14);
+INSERT INTO orders VALUES (2464, 2416, 45);
+INSERT INTO orders VALUES (2465, 335, 76);
+INSERT INTO orders VALUES (2466, 3254, 10);
+INSERT INTO orders VALUES (2467, 1173, 41);
+INSERT INTO orders VALUES (2468, 4092, 72);
+INSERT INTO orders VALUES (2469, 2011, 6);
+INSERT INTO orders VALUES (2470, 4930, 37);
+INSERT INTO orders VALUES (2471, 2849, 68);
+INSERT INTO orders VALUES (2472, 768, 2);
+INSERT INTO orders VALUES (2473, 3687, 33);
+INSERT INTO orders VALUES (2474, 1606, 64);
+INSERT INTO orders VALUES (2475, 4525, 95);
+INSERT INTO orders VALUES (2476, 2444, 29);
+INSERT INTO orders VALUES (2477, 363, 60);
+INSERT INTO orders VALUES (2478, 3282, 91);
+INSERT INTO orders VALUES (2479, 1201, 25);
+INSERT INTO orders VALUES (2480, 4120, 56);
+INSERT INTO orders VALUES (2481, 2039, 87);
+INSERT INTO orders VALUES (2482, 4958, 21);
+INSERT INTO orders VALUES (2483, 2877, 52);
+INSERT INTO orders VALUES (2484, 796, 83);
+INSERT INTO orders VALUES (2485, 3715, 17);
+INSERT INTO orders VALUES (2486, 1634, 48);
+INSERT INTO orders VALUES (2487, 4553, 79);
+INSERT INTO orders VALUES (2488, 2472, 13);
+INSERT INTO orders VALUES (2489, 391, 44);
+INSERT INTO orders VALUES (2490, 3310, 75);
+INSERT INTO orders VALUES (2491, 1229, 9);
+INSERT INTO orders VALUES (2492, 4148, 40);
+INSERT INTO orders VALUES (2493, 2067, 71);
+INSERT INTO orders VALUES (2494, 4986, 5);
+INSERT INTO orders VALUES (2495, 2905, 36);
+INSERT INTO orders VALUES (2496, 824, 67);
+INSERT INTO orders VALUES (2497, 3743, 1);
+INSERT INTO orders VALUES (2498, 1662, 32);
+INSERT INTO orders VALUES (2499, 4581, 63);
+INSERT INTO orders VALUES (2500, 2500, 94);
+INSERT INTO orders VALUES (2501, 419, 28);
+INSERT INTO orders VALUES (2502, 3338, 59);
+INSERT INTO orders VALUES (2503, 1257, 90);
+INSERT INTO orders VALUES (2504, 4176, 24);
+INSERT INTO orders VALUES (2505, 2095, 55);
+INSERT INTO orders VALUES (2506, 14, 86);
+INSERT INTO orders VALUES (2507, 2933, 20);
+INSERT INTO orders VALUES (2508, 852, 51);
+INSERT INTO orders VALUES (2509, 3771, 82);
+INSERT INTO orders VALUES (2510, 1690, 16);
+INSERT INTO orders VALUES (2511, 4609, 47);
+INSERT INTO orders VALUES (2512, 2528, 78);
+INSERT INTO orders VALUES (2513, 447, 12);
+INSERT INTO orders VALUES (2514, 3366, 43);
+INSERT INTO orders VALUES (2515, 1285, 74);
+INSERT INTO orders VALUES (2516, 4204, 8);
+INSERT INTO orders VALUES (2517, 2123, 39);
+INSERT INTO orders VALUES (2518, 42, 70);
+INSERT INTO orders VALUES (2519, 2961, 4);
+INSERT INTO orders VALUES (2520, 880, 35);
+INSERT INTO orders VALUES (2521, 3799, 66);
+INSERT INTO orders VALUES (2522, 1718, 0);
+INSERT INTO orders VALUES (2523, 4637, 31);
+INSERT INTO orders VALUES (2524, 2556, 62);
+INSERT INTO orders VALUES (2525, 475, 93);
+INSERT INTO orders VALUES (2526, 3394, 27);
+INSERT INTO orders VALUES (2527, 1313, 58);
+INSERT INTO orders VALUES (2528, 4232, 89);
+INSERT INTO orders VALUES (2529, 2151, 23);
+INSERT INTO orders VALUES (2530, 70, 54);
+INSERT INTO orders VALUES (2531, 2989, 85);
+INSERT INTO orders VALUES (2532, 908, 19);
+INSERT INTO orders VALUES (2533, 3827, 50);
+INSERT INTO orders VALUES (2534, 1746, 81);
+INSERT INTO orders VALUES (2535, 4665, 15);
+INSERT INTO orders VALUES (2536, 2584, 46);
+INSERT INTO orders VALUES (2537, 503, 77);
+INSERT INTO orders VALUES (2538, 3422, 11);
+INSERT INTO orders VALUES (2539, 1341, 42);
+INSERT INTO orders VALUES (2540, 4260, 73);
+INSERT INTO orders VALUES (2541, 2179, 7);
+INSERT INTO orders VALUES (2542, 98, 38);
+INSERT INTO orders VALUES (2543, 3017, 69);
+INSERT INTO orders VALUES (2544, 936, 3);
+INSERT INTO orders VALUES (2545, 3855, 34);
+INSERT INTO orders VALUES (2546, 1774, 65);
+INSERT INTO orders VALUES (2547, 4693, 96);
+INSERT INTO orders VALUES (2548, 2612, 30);
+INSERT INTO orders VALUES (2549, 531, 61);
+INSERT INTO orders VALUES (2550, 3450, 92);
+INSERT INTO orders VALUES (2551, 1369, 26);
+INSERT INTO orders VALUES (2552, 4288, 57);
+INSERT INTO orders VALUES (2553, 2207, 88);
+INSERT INTO orders VALUES (2554, 126, 22);
+INSERT INTO orders VALUES (2555, 3045, 53);
+INSERT INTO orders VALUES (2556, 964, 84);
+INSERT INTO orders VALUES (2557, 3883, 18);
+INSERT INTO orders VALUES (2558, 1802, 49);
+INSERT INTO orders VALUES (2559, 4721, 80);
+INSERT INTO orders VALUES (2560, 2640, 14);
+INSERT INTO orders VALUES (2561, 559, 45);
+INSERT INTO orders VALUES (2562, 3478, 76);
+INSERT INTO orders VALUES (2563, 1397, 10);
+INSERT INTO orders VALUES (2564, 4316, 41);
+INSERT INTO orders VALUES (2565, 2235, 72);
+INSERT INTO orders VALUES (2566, 154, 6);
+INSERT INTO orders VALUES (2567, 3073, 37);
+INSERT INTO orders VALUES (2568, 992, 68);
+INSERT INTO orders VALUES (2569, 3911, 2);
+INSERT INTO orders VALUES (2570, 1830, 33);
+INSERT INTO orders VALUES (2571, 4749, 64);
+INSERT INTO orders VALUES (2572, 2668, 95);
+INSERT INTO orders VALUES (2573, 587, 29);
+INSERT INTO orders VALUES (2574, 3506, 60);
+INSERT INTO orders VALUES (2575, 1425, 91);
+INSERT INTO orders VALUES (2576, 4344, 25);
+INSERT INTO orders VALUES (2577, 2263, 56);
+INSERT INTO orders VALUES (2578, 182, 87);
+INSERT INTO orders VALUES (2579, 3101, 21);
+INSERT INTO orders VALUES (2580, 1020, 52);
+INSERT INTO orders VALUES (2581, 3939, 83);
+INSERT INTO orders VALUES (2582, 1858, 17);
+INSERT INTO orders VALUES (2583, 4777, 48);
+INSERT INTO orders VALUES (2584, 2696, 79);
+INSERT INTO orders VALUES (2585, 615, 13);
+INSERT INTO orders VALUES (2586, 3534, 44);
+INSERT INTO orders VALUES (2587, 1453, 75);
+INSERT INTO orders VALUES (2588, 4372, 9);
+INSERT INTO orders VALUES (2589, 2291, 40);
+INSERT INTO orders VALUES (2590, 210, 71);
+INSERT INTO orders VALUES (2591, 3129, 5);
+INSERT INTO orders VALUES (2592, 1048, 36);
+INSERT INTO orders VALUES (2593, 3967, 67);
+INSERT INTO orders VALUES (2594, 1886, 1);
+INSERT INTO orders VALUES (2595, 4805, 32);
+INSERT INTO orders VALUES (2596, 2724, 63);
+INSERT INTO orders VALUES (2597, 643, 94);
+INSERT INTO orders VALUES (2598, 3562, 28);
+INSERT INTO orders VALUES (2599, 1481, 59);
+INSERT INTO orders VALUES (2600, 4400, 90);
+INSERT INTO orders VALUES (2601, 2319, 24);
+INSERT INTO orders VALUES (2602, 238, 55);
+INSERT INTO orders VALUES (2603, 3157, 86);
+INSERT INTO orders VALUES (2604, 1076, 20);
+INSERT INTO orders VALUES (2605, 3995, 51);
+INSERT INTO orders VALUES (2606, 1914, 82);
+INSERT INTO orders VALUES (2607, 4833, 16);
+INSERT INTO orders VALUES (2608, 2752, 47);
+INSERT INTO orders VALUES (2609, 671, 78);
+INSERT INTO orders VALUES (2610, 3590, 12);
+INSERT INTO orders VALUES (2611, 1509, 43);
+INSERT INTO orders VALUES (2612, 4428, 74);
+INSERT INTO orders VALUES (2613, 2347, 8);
+INSERT INTO orders VALUES (2614, 266, 39);
+INSERT INTO orders VALUES (2615, 3185, 70);
+INSERT INTO orders VALUES (2616, 1104, 4);
+INSERT INTO orders VALUES (2617, 4023, 35);
+INSERT INTO orders VALUES (2618, 1942, 66);
+INSERT INTO orders VALUES (2619, 4861, 0);
+INSERT INTO orders VALUES (2620, 2780, 31);
+INSERT INTO orders VALUES (2621, 699, 62);
+INSERT INTO orders VALUES (2622, 3618, 93);
+INSERT INTO orders VALUES (2623, 1537, 27);
+INSERT INTO orders VALUES (2624, 4456, 58);
+INSERT INTO orders VALUES (2625, 2375, 89);
+INSERT INTO orders VALUES (2626, 294, 23);
+INSERT INTO orders VALUES (2627, 3213, 54);
+INSERT INTO orders VALUES (2628, 1132, 85);
+INSERT INTO orders VALUES (2629, 4051, 19);
+INSERT INTO orders VALUES (2630, 1970, 50);
+INSERT INTO orders VALUES (2631, 4889, 81);
+INSERT INTO orders VALUES (2632, 2808, 15);
+INSERT INTO orders VALUES (2633, 727, 46);
+INSERT INTO orders VALUES (2634, 3646, 77);
+INSERT INTO orders VALUES (2635, 1565, 11);
+INSERT INTO orders VALUES (2636, 4484, 42);
+INSERT INTO orders VALUES (2637, 2403, 73);
+INSERT INTO orders VALUES (2638, 322, 7);
+INSERT INTO orders VALUES (2639, 3241, 38);
+INSERT INTO orders VALUES (2640, 1160, 69);
+INSERT INTO orders VALUES (2641, 4079, 3);
+INSERT INTO orders VALUES (2642, 1998, 34);
+INSERT INTO orders VALUES (2643, 4917, 65);
+INSERT INTO orders VALUES (2644, 2836, 96);
+INSERT INTO orders VALUES (2645, 755, 30);
+INSERT INTO orders VALUES (2646, 3674, 61);
+INSERT INTO orders VALUES (2647, 1593, 92);
+INSERT INTO orders VALUES (2648, 4512, 26);
+INSERT INTO orders VALUES (2649, 2431, 57);
+INSERT INTO orders VALUES (2650, 350, 88);
+INSERT INTO orders VALUES (2651, 3269, 22);
+INSERT INTO orders VALUES (2652, 1188, 53);
+INSERT INTO orders VALUES (2653, 4107, 84);
+INSERT INTO orders VALUES (2654, 2026, 18);
+INSERT INTO orders VALUES (2655, 4945, 49);
+INSERT INTO orders VALUES (2656, 2864, 80);
+INSERT INTO orders VALUES (2657, 783, 14);
+INSERT INTO orders VALUES (2658, 3702, 45);
+INSERT INTO orders VALUES (2659, 1621, 76);
+INSERT INTO orders VALUES (2660, 4540, 10);
+INSERT INTO orders VALUES (2661, 2459, 41);
+INSERT INTO orders VALUES (2662, 378, 72);
+INSERT INTO orders VALUES (2663, 3297, 6);
+INSERT INTO orders VALUES (2664, 1216, 37);
+INSERT INTO orders VALUES (2665, 4135, 68);
+INSERT INTO orders VALUES (2666, 2054, 2);
+INSERT INTO orders VALUES (2667, 4973, 33);
+INSERT INTO orders VALUES (2668, 2892, 64);
+INSERT INTO orders VALUES (2669, 811, 95);
+INSERT INTO orders VALUES (2670, 3730, 29);
+INSERT INTO orders VALUES (2671, 1649, 60);
+INSERT INTO orders VALUES (2672, 4568, 91);
+INSERT INTO orders VALUES (2673, 2487, 25);
+INSERT INTO orders VALUES (2674, 406, 56);
+INSERT INTO orders VALUES (2675, 3325, 87);
+INSERT INTO orders VALUES (2676, 1244, 21);
+INSERT INTO orders VALUES (2677, 4163, 52);
+INSERT INTO orders VALUES (2678, 2082, 83);
+INSERT INTO orders VALUES (2679, 1, 17);
+INSERT INTO orders VALUES (2680, 2920, 48);
+INSERT INTO orders VALUES (2681, 839, 79);
+INSERT INTO orders VALUES (2682, 3758, 13);
+INSERT INTO orders VALUES (2683, 1677, 44);
+INSERT INTO orders VALUES (2684, 4596, 75);
+INSERT INTO orders VALUES (2685, 2515, 9);
+INSERT INTO orders VALUES (2686, 434, 40);
+INSERT INTO orders VALUES (2687, 3353, 71);
+INSERT INTO orders VALUES (2688, 1272, 5);
+INSERT INTO orders VALUES (2689, 4191, 36);
+INSERT INTO orders VALUES (2690, 2110, 67);
+INSERT INTO orders VALUES (2691, 29, 1);
+INSERT INTO orders VALUES (2692, 2948, 32);
+INSERT INTO orders VALUES (2693, 867, 63);
+INSERT INTO orders VALUES (2694, 3786, 94);
+INSERT INTO orders VALUES (2695, 1705, 28);
+INSERT INTO orders VALUES (2696, 4624, 59);
+INSERT INTO orders VALUES (2697, 2543, 90);
+INSERT INTO orders VALUES (2698, 462, 24);
+INSERT INTO orders VALUES (2699, 3381, 55);
+INSERT INTO orders VALUES (2700, 1300, 86);
+INSERT INTO orders VALUES (2701, 4219, 20);
+INSERT INTO orders VALUES (2702, 2138, 51);
+INSERT INTO orders VALUES (2703, 57, 82);
+INSERT INTO orders VALUES (2704, 2976, 16);
+INSERT INTO orders VALUES (2705, 895, 47);
+INSERT INTO orders VALUES (2706, 3814, 78);
+INSERT INTO orders VALUES (2707, 1733, 12);
+INSERT INTO orders VALUES (2708, 4652, 43);
+INSERT INTO orders VALUES (2709, 2571, 74);
+INSERT INTO orders VALUES (2710, 490, 8);
+INSERT INTO orders VALUES (2711, 3409, 39);
+INSERT INTO orders VALUES (2712, 1328, 70);
+INSERT INTO orders VALUES (2713, 4247, 4);
+INSERT INTO orders VALUES (2714, 2166, 35);
+INSERT INTO orders VALUES (2715, 85, 66);
+INSERT INTO orders VALUES (2716, 3004, 0);
+INSERT INTO orders VALUES (2717, 923, 31);
+INSERT INTO orders VALUES (2718, 3842, 62);
+INSERT INTO orders VALUES (2719, 1761, 93);
+INSERT INTO orders VALUES (2720, 4680, 27);
+INSERT INTO orders VALUES (2721, 2599, 58);
+INSERT INTO orders VALUES (2722, 518, 89);
+INSERT INTO orders VALUES (2723, 3437, 23);
+INSERT INTO orders VALUES (2724, 1356, 54);
+INSERT INTO orders VALUES (2725, 4275, 85);
+INSERT INTO orders VALUES (2726, 2194, 19);
+INSERT INTO orders VALUES (2727, 113, 50);
+INSERT INTO orders VALUES (2728, 3032, 81);
+INSERT INTO orders VALUES (2729, 951, 15);
+INSERT INTO orders VALUES (2730, 3870, 46);
+INSERT INTO orders VALUES (2731, 1789, 77);
+INSERT INTO orders VALUES (2732, 4708, 11);
+INSERT INTO orders VALUES (2733, 2627, 42);
+INSERT INTO orders VALUES (2734, 546, 73);
+INSERT INTO orders VALUES (2735, 3465, 7);
+INSERT INTO orders VALUES (2736, 1384, 38);
+INSERT INTO orders VALUES (2737, 4303, 69);
+INSERT INTO orders VALUES (2738, 2222, 3);
+INSERT INTO orders VALUES (2739, 141, 34);
+INSERT INTO orders VALUES (2740, 3060, 65);
+INSERT INTO orders VALUES (2741, 979, 96);
+INSERT INTO orders VALUES (2742, 3898, 30);
+INSERT INTO orders VALUES (2743, 1817, 61);
+INSERT INTO orders VALUES (2744, 4736, 92);
+INSERT INTO orders VALUES (2745, 2655, 26);
+INSERT INTO orders VALUES (2746, 574, 57);
+INSERT INTO orders VALUES (2747, 3493, 88);
+INSERT INTO orders VALUES (2748, 1412, 22);
+INSERT INTO orders VALUES (2749, 4331, 53);
+INSERT INTO orders VALUES (2750, 2250, 84);
+INSERT INTO orders VALUES (2751, 169, 18);
+INSERT INTO orders VALUES (2752, 3088, 49);
+INSERT INTO orders VALUES (2753, 1007, 80);
+INSERT INTO orders VALUES (2754, 3926, 14);
+INSERT INTO orders VALUES (2755, 1845, 45);
+INSERT INTO orders VALUES (2756, 4764, 76);
+INSERT INTO orders VALUES (2757, 2683, 10);
+INSERT INTO orders VALUES (2758, 602, 41);
+INSERT INTO orders VALUES (2759, 3521, 72);
+INSERT INTO orders VALUES (2760, 1440, 6);
+INSERT INTO orders VALUES (2761, 4359, 37);
+INSERT INTO orders VALUES (2762, 2278, 68);
+INSERT INTO orders VALUES (2763, 197, 2);
+INSERT INTO orders VALUES (2764, 3116, 33);
+INSERT INTO orders VALUES (2765, 1035, 64);
+INSERT INTO orders VALUES (2766, 3954, 95);
+INSERT INTO orders VALUES (2767, 1873, 29);
+INSERT INTO orders VALUES (2768, 4792, 60);
+INSERT INTO orders VALUES (2769, 2711, 91);
+INSERT INTO orders VALUES (2770, 630, 25);
+INSERT INTO orders VALUES (2771, 3549, 56);
+INSERT INTO orders VALUES (2772, 1468, 87);
+INSERT INTO orders VALUES (2773, 4387, 21);
+INSERT INTO orders VALUES (2774, 2306, 52);
+INSERT INTO orders VALUES (2775, 225, 83);
+INSERT INTO orders VALUES (2776, 3144, 17);
+INSERT INTO orders VALUES (2777, 1063, 48);
+INSERT INTO orders VALUES (2778, 3982, 79);
+INSERT INTO orders VALUES (2779, 1901, 13);
+INSERT INTO orders VALUES (2780, 4820, 44);
+INSERT INTO orders VALUES (2781, 2739, 75);
+INSERT INTO orders VALUES (2782, 658, 9);
+INSERT INTO orders VALUES (2783, 3577, 40);
+INSERT INTO orders VALUES (2784, 1496, 71);
+INSERT INTO orders VALUES (2785, 4415, 5);
+INSERT INTO orders VALUES (2786, 2334, 36);
+INSERT INTO orders VALUES (2787, 253, 67);
+INSERT INTO orders VALUES (2788, 3172, 1);
+INSERT INTO orders VALUES (2789, 1091, 32);
+INSERT INTO orders VALUES (2790, 4010, 63);
+INSERT INTO orders VALUES (2791, 1929, 94);
+INSERT INTO orders VALUES (2792, 4848, 28);
+INSERT INTO orders VALUES (2793, 2767, 59);
+INSERT INTO orders VALUES (2794, 686, 90);
+INSERT INTO orders VALUES (2795, 3605, 24);
+INSERT INTO orders VALUES (2796, 1524, 55);
+INSERT INTO orders VALUES (2797, 4443, 86);
+INSERT INTO orders VALUES (2798, 2362, 20);
+INSERT INTO orders VALUES (2799, 281, 51);
+INSERT INTO orders VALUES (2800, 3200, 82);
+INSERT INTO orders VALUES (2801, 1119, 16);
+INSERT INTO orders VALUES (2802, 4038, 47);
+INSERT INTO orders VALUES (2803, 1957, 78);
+INSERT INTO orders VALUES (2804, 4876, 12);
+INSERT INTO orders VALUES (2805, 2795, 43);
+INSERT INTO orders VALUES (2806, 714, 74);
+INSERT INTO orders VALUES (2807, 3633, 8);
+INSERT INTO orders VALUES (2808, 1552, 39);
+INSERT INTO orders VALUES (2809, 4471, 70);
+INSERT INTO orders VALUES (2810, 2390, 4);
+INSERT INTO orders VALUES (2811, 309, 35);
+INSERT INTO orders VALUES (2812, 3228, 66);
+INSERT INTO orders VALUES (2813, 1147, 0);
+INSERT INTO orders VALUES (2814, 4066, 31);
+INSERT INTO orders VALUES (2815, 1985, 62);
+INSERT INTO orders VALUES (2816, 4904, 93);
+INSERT INTO orders VALUES (2817, 2823, 27);
+INSERT INTO orders VALUES (2818, 742, 58);
+INSERT INTO orders VALUES (2819, 3661, 89);
+INSERT INTO orders VALUES (2820, 1580, 23);
+INSERT INTO orders VALUES (2821, 4499, 54);
+INSERT INTO orders VALUES (2822, 2418, 85);
+INSERT INTO orders VALUES (2823, 337, 19);
+INSERT INTO orders VALUES (2824, 3256, 50);
+INSERT INTO orders VALUES (2825, 1175, 81);
+INSERT INTO orders VALUES (2826, 4094, 15);
+INSERT INTO orders VALUES (2827, 2013, 46);
+INSERT INTO orders VALUES (2828, 4932, 77);
+INSERT INTO orders VALUES (2829, 2851, 11);
+INSERT INTO orders VALUES (2830, 770, 42);
+INSERT INTO orders VALUES (2831, 3689, 73);
+INSERT INTO orders VALUES (2832, 1608, 7);
+INSERT INTO orders VALUES (2833, 4527, 38);
+INSERT INTO orders VALUES (2834, 2446, 69);
+INSERT INTO orders VALUES (2835, 365, 3);
+INSERT INTO orders VALUES (2836, 3284, 34);
+INSERT INTO orders VALUES (2837, 1203, 65);
+INSERT INTO orders VALUES (2838, 4122, 96);
+INSERT INTO orders VALUES (2839, 2041, 30);
+INSERT INTO orders VALUES (2840, 4960, 61);
+INSERT INTO orders VALUES (2841, 2879, 92);
+INSERT INTO orders VALUES (2842, 798, 26);
+INSERT INTO orders VALUES (2843, 3717, 57);
+INSERT INTO orders VALUES (2844, 1636, 88);
+INSERT INTO orders VALUES (2845, 4555, 22);
+INSERT INTO orders VALUES (2846, 2474, 53);
+INSERT INTO orders VALUES (2847, 393, 84);
+INSERT INTO orders VALUES (2848, 3312, 18);
+INSERT INTO orders VALUES (2849, 1231, 49);
+INSERT INTO orders VALUES (2850, 4150, 80);
+INSERT INTO orders VALUES (2851, 2069, 14);
+INSERT INTO orders VALUES (2852, 4988, 45);
+INSERT INTO orders VALUES (2853, 2907, 76);
+INSERT INTO orders VALUES (2854, 826, 10);
+INSERT INTO orders VALUES (2855, 3745, 41);
+INSERT INTO orders VALUES (2856, 1664, 72);
+INSERT INTO orders VALUES (2857, 4583, 6);
+INSERT INTO orders VALUES (2858, 2502, 37);
+INSERT INTO orders VALUES (2859, 421, 68);
+INSERT INTO orders VALUES (2860, 3340, 2);
+INSERT INTO orders VALUES (2861, 1259, 33);
+INSERT INTO orders VALUES (2862, 4178, 64);
+INSERT INTO orders VALUES (2863, 2097, 95);
+INSERT INTO orders VALUES (2864, 16, 29);
+INSERT INTO orders VALUES (2865, 2935, 60);
+INSERT INTO orders VALUES (2866, 854, 91);
+INSERT INTO orders VALUES (2867, 3773, 25);
+INSERT INTO orders VALUES (2868, 1692, 56);
+INSERT INTO orders VALUES (2869, 4611, 87);
+INSERT INTO orders VALUES (2870, 2530, 21);
+INSERT INTO orders VALUES (2871, 449, 52);
+INSERT INTO orders VALUES (2872, 3368, 83);
+INSERT INTO orders VALUES (2873, 1287, 17);
+INSERT INTO orders VALUES (2874, 4206, 48);
+INSERT INTO orders VALUES (2875, 2125, 79);
+INSERT INTO orders VALUES (2876, 44, 13);
+INSERT INTO orders VALUES (2877, 2963, 44);
+INSERT INTO orders VALUES (2878, 882, 75);
+INSERT INTO orders VALUES (2879, 3801, 9);
+INSERT INTO orders VALUES (2880, 1720, 40);
+INSERT INTO orders VALUES (2881, 4639, 71);
+INSERT INTO orders VALUES (2882, 2558, 5);
+INSERT INTO orders VALUES (2883, 477, 36);
+INSERT INTO orders VALUES (2884, 3396, 67);
+INSERT INTO orders VALUES (2885, 1315, 1);
+INSERT INTO orders VALUES (2886, 4234, 32);
+INSERT INTO orders VALUES (2887, 2153, 63);
+INSERT INTO orders VALUES (2888, 72, 94);
+INSERT INTO orders VALUES (2889, 2991, 28);
+INSERT INTO orders VALUES (2890, 910, 59);
+INSERT INTO orders VALUES (2891, 3829, 90);
+INSERT INTO orders VALUES (2892, 1748, 24);
+INSERT INTO orders VALUES (2893, 4667, 55);
+INSERT INTO orders VALUES (2894, 2586, 86);
+INSERT INTO orders VALUES (2895, 505, 20);
+INSERT INTO orders VALUES (2896, 3424, 51);
+INSERT INTO orders VALUES (2897, 1343, 82);
+INSERT INTO orders VALUES (2898, 4262, 16);
+INSERT INTO orders VALUES (2899, 2181, 47);
+INSERT INTO orders VALUES (2900, 100, 78);
+INSERT INTO orders VALUES (2901, 3019, 12);
+INSERT INTO orders VALUES (2902, 938, 43);
+INSERT INTO orders VALUES (2903, 3857, 74);
+INSERT INTO orders VALUES (2904, 1776, 8);
+INSERT INTO orders VALUES (2905, 4695, 39);
+INSERT INTO orders VALUES (2906, 2614, 70);
+INSERT INTO orders VALUES (2907, 533, 4);
+INSERT INTO orders VALUES (2908, 3452, 35);
+INSERT INTO orders VALUES (2909, 1371, 66);
+INSERT INTO orders VALUES (2910, 4290, 0);
+INSERT INTO orders VALUES (2911, 2209, 31);
+INSERT INTO orders VALUES (2912, 128, 62);
+INSERT INTO orders VALUES (2913, 3047, 93);
+INSERT INTO orders VALUES (2914, 966, 27);
+INSERT INTO orders VALUES (2915, 3885, 58);
+INSERT INTO orders VALUES (2916, 1804, 89);
+INSERT INTO orders VALUES (2917, 4723, 23);
+INSERT INTO orders VALUES (2918, 2642, 54);
+INSERT INTO orders VALUES (2919, 561, 85);
+INSERT INTO orders VALUES (2920, 3480, 19);
+INSERT INTO orders VALUES (2921, 1399, 50);
+INSERT INTO orders VALUES (2922, 4318, 81);
+INSERT INTO orders VALUES (2923, 2237, 15);
+INSERT INTO orders VALUES (2924, 156, 46);
+INSERT INTO orders VALUES (2925, 3075, 77);
+INSERT INTO orders VALUES (2926, 994, 11);
+INSERT INTO orders VALUES (2927, 3913, 42);
+INSERT INTO orders VALUES (2928, 1832, 73);
+INSERT INTO orders VALUES (2929, 4751, 7);
+INSERT INTO orders VALUES (2930, 2670, 38);
+INSERT INTO orders VALUES (2931, 589, 69);
+INSERT INTO orders VALUES (2932, 3508, 3);
+INSERT INTO orders VALUES (2933, 1427, 34);
+INSERT INTO orders VALUES (2934, 4346, 65);
+INSERT INTO orders VALUES (2935, 2265, 96);
+INSERT INTO orders VALUES (2936, 184, 30);
+INSERT INTO orders VALUES (2937, 3103, 61);
+INSERT INTO orders VALUES (2938, 1022, 92);
+INSERT INTO orders VALUES (2939, 3941, 26);
+INSERT INTO orders VALUES (2940, 1860, 57);
+INSERT INTO orders VALUES (2941, 4779, 88);
+INSERT INTO orders VALUES (2942, 2698, 22);
+INSERT INTO orders VALUES (2943, 617, 53);
+INSERT INTO orders VALUES (2944, 3536, 84);
+INSERT INTO orders VALUES (2945, 1455, 18);
+INSERT INTO orders VALUES (2946, 4374, 49);
+INSERT INTO orders VALUES (2947, 2293, 80);
+INSERT INTO orders VALUES (2948, 212, 14);
+INSERT INTO orders VALUES (2949, 3131, 45);
+INSERT INTO orders VALUES (2950, 1050, 76);
+INSERT INTO orders VALUES (2951, 3969, 10);
+INSERT INTO orders VALUES (2952, 1888, 41);
+INSERT INTO orders VALUES (2953, 4807, 72);
+INSERT INTO orders VALUES (2954, 2726, 6);
+INSERT INTO orders VALUES (2955, 645, 37);
+INSERT INTO orders VALUES (2956, 3564, 68);
+INSERT INTO orders VALUES (2957, 1483, 2);
+INSERT INTO orders VALUES (2958, 4402, 33);
+INSERT INTO orders VALUES (2959, 2321, 64);
+INSERT INTO orders VALUES (2960, 240, 95);
+INSERT INTO orders VALUES (2961, 3159, 29);
+INSERT INTO orders VALUES (2962, 1078, 60);
+INSERT INTO orders VALUES (2963, 3997, 91);
+INSERT INTO orders VALUES (2964, 1916, 25);
+INSERT INTO orders VALUES (2965, 4835, 56);
+INSERT INTO orders VALUES (2966, 2754, 87);
+INSERT INTO orders VALUES (2967, 673, 21);
+INSERT INTO orders VALUES (2968, 3592, 52);
+INSERT INTO orders VALUES (2969, 1511, 83);
+INSERT INTO orders VALUES (2970, 4430, 17);
+INSERT INTO orders VALUES (2971, 2349, 48);
+INSERT INTO orders VALUES (2972, 268, 79);
+INSERT INTO orders VALUES (2973, 3187, 13);
+INSERT INTO orders VALUES (2974, 1106, 44);
+INSERT INTO orders VALUES (2975, 4025, 75);
+INSERT INTO orders VALUES (2976, 1944, 9);
+INSERT INTO orders VALUES (2977, 4863, 40);
+INSERT INTO orders VALUES (2978, 2782, 71);
+INSERT INTO orders VALUES (2979, 701, 5);
+INSERT INTO orders VALUES (2980, 3620, 36);
+INSERT INTO orders VALUES (2981, 1539, 67);
+INSERT INTO orders VALUES (2982, 4458, 1);
+INSERT INTO orders VALUES (2983, 2377, 32);
+INSERT INTO orders VALUES (2984, 296, 63);
+INSERT INTO orders VALUES (2985, 3215, 94);
+INSERT INTO orders VALUES (2986, 1134, 28);
+INSERT INTO orders VALUES (2987, 4053, 59);
+INSERT INTO orders VALUES (2988, 1972, 90);
+INSERT INTO orders VALUES (2989, 4891, 24);
+INSERT INTO orders VALUES (2990, 2810, 55);
+INSERT INTO orders VALUES (2991, 729, 86);
+INSERT INTO orders VALUES (2992, 3648, 20);
+INSERT INTO orders VALUES (2993, 1567, 51);
+INSERT INTO orders VALUES (2994, 4486, 82);
+INSERT INTO orders VALUES (2995, 2405, 16);
+INSERT INTO orders VALUES (2996, 324, 47);
+INSERT INTO orders VALUES (2997, 3243, 78);
+INSERT INTO orders VALUES (2998, 1162, 12);
+INSERT INTO orders VALUES (2999, 4081, 43);
+INSERT INTO notes VALUES (0, 0, 't0');
+INSERT INTO notes VALUES (1, 613, 't1');
+INSERT INTO notes VALUES (2, 1226, 't2');
+INSERT INTO notes VALUES (3, 1839, 't3');
+INSERT INTO notes VALUES (4, 2452, 't4');
+INSERT INTO notes VALUES (5, 65, 't5');
+INSERT INTO notes VALUES (6, 678, 't6');
+INSERT INTO notes VALUES (7, 1291, 't7');
+INSERT INTO notes VALUES (8, 1904, 't8');
+INSERT INTO notes VALUES (9, 2517, 't0');
+INSERT INTO notes VALUES (10, 130, 't1');
+INSERT INTO notes VALUES (11, 743, 't2');
+INSERT INTO notes VALUES (12, 1356, 't3');
+INSERT INTO notes VALUES (13, 1969, 't4');
+INSERT INTO notes VALUES (14, 2582, 't5');
+INSERT INTO notes VALUES (15, 195, 't6');
+INSERT INTO notes VALUES (16, 808, 't7');
+INSERT INTO notes VALUES (17, 1421, 't8');
+INSERT INTO notes VALUES (18, 2034, 't0');
+INSERT INTO notes VALUES (19, 2647, 't1');
+INSERT INTO notes VALUES (20, 260, 't2');
+INSERT INTO notes VALUES (21, 873, 't3');
+INSERT INTO notes VALUES (22, 1486, 't4');
+INSERT INTO notes VALUES (23, 2099, 't5');
+INSERT INTO notes VALUES (24, 2712, 't6');
+INSERT INTO notes VALUES (25, 325, 't7');
+INSERT INTO notes VALUES (26, 938, 't8');
+INSERT INTO notes VALUES (27, 1551, 't0');
+INSERT INTO notes VALUES (28, 2164, 't1');
+INSERT INTO notes VALUES (29, 2777, 't2');
+INSERT INTO notes VALUES (30, 390, 't3');
+INSERT INTO notes VALUES (31, 1003, 't4');
+INSERT INTO notes VALUES (32, 1616, 't5');
+INSERT INTO notes VALUES (33, 2229, 't6');
+INSERT INTO notes VALUES (34, 2842, 't7');
+INSERT INTO notes VALUES (35, 455, 't8');
+INSERT INTO notes VALUES (36, 1068, 't0');
+INSERT INTO notes VALUES (37, 1681, 't1');
+INSERT INTO notes VALUES (38, 2294, 't2');
+INSERT INTO notes VALUES (39, 2907, 't3');
+INSERT INTO notes VALUES (40, 520, 't4');
+INSERT INTO notes VALUES (41, 1133, 't5');
+INSERT INTO notes VALUES (42, 1746, 't6');
+INSERT INTO notes VALUES (43, 2359, 't7');
+INSERT INTO notes VALUES (44, 2972, 't8');
+INSERT INTO notes VALUES (45, 585, 't0');
+INSERT INTO notes VALUES (46, 1198, 't1');
+INSERT INTO notes VALUES (47, 1811, 't2');
+INSERT INTO notes VALUES (48, 2424, 't3');
+INSERT INTO notes VALUES (49, 37, 't4');
+INSERT INTO notes VALUES (50, 650, 't5');
+INSERT INTO notes VALUES (51, 1263, 't6');
+INSERT INTO notes VALUES (52, 1876, 't7');
+INSERT INTO notes VALUES (53, 2489, 't8');
+INSERT INTO notes VALUES (54, 102, 't0');
+INSERT INTO notes VALUES (55, 715, 't1');
+INSERT INTO notes VALUES (56, 1328, 't2');
+INSERT INTO notes VALUES (57, 1941, 't3');
+INSERT INTO notes VALUES (58, 2554, 't4');
+INSERT INTO notes VALUES (59, 167, 't5');
+INSERT INTO notes VALUES (60, 780, 't6');
+INSERT INTO notes VALUES (61, 1393, 't7');
+INSERT INTO notes VALUES (62, 2006, 't8');
+INSERT INTO notes VALUES (63, 2619, 't0');
+INSERT INTO notes VALUES (64, 232, 't1');
+INSERT INTO notes VALUES (65, 845, 't2');
+INSERT INTO notes VALUES (66, 1458, 't3');
+INSERT INTO notes VALUES (67, 2071, 't4');
+INSERT INTO notes VALUES (68, 2684, 't5');
+INSERT INTO notes VALUES (69, 297, 't6');
+INSERT INTO notes VALUES (70, 910, 't7');
+INSERT INTO notes VALUES (71, 1523, 't8');
+INSERT INTO notes VALUES (72, 2136, 't0');
+INSERT INTO notes VALUES (73, 2749, 't1');
+INSERT INTO notes VALUES (74, 362, 't2');
+INSERT INTO notes VALUES (75, 975, 't3');
+INSERT INTO notes VALUES (76, 1588, 't4');
+INSERT INTO notes VALUES (77, 2201, 't5');
+INSERT INTO notes VALUES (78, 2814, 't6');
+INSERT INTO notes VALUES (79, 427, 't7');
+INSERT INTO notes VALUES (80, 1040, 't8');
+INSERT INTO notes VALUES (81, 1653, 't0');
+INSERT INTO notes VALUES (82, 2266, 't1');
+INSERT INTO notes VALUES (83, 2879, 't2');
+INSERT INTO notes VALUES (84, 492, 't3');
+INSERT INTO notes VALUES (85, 1105, 't4');
+INSERT INTO notes VALUES (86, 1718, 't5');
+INSERT INTO notes VALUES (87, 2331, 't6');
+INSERT INTO notes VALUES (88, 2944, 't7');
+INSERT INTO notes VALUES (89, 557, 't8');
+INSERT INTO notes VALUES (90, 1170, 't0');
+INSERT INTO notes VALUES (91, 1783, 't1');
+INSERT INTO notes VALUES (92, 2396, 't2');
+INSERT INTO notes VALUES (93, 9, 't3');
+INSERT INTO notes VALUES (94, 622, 't4');
+INSERT INTO notes VALUES (95, 1235, 't5');
+INSERT INTO notes VALUES (96, 1848, 't6');
+INSERT INTO notes VALUES (97, 2461, 't7');
+INSERT INTO notes VALUES (98, 74, 't8');
+INSERT INTO notes VALUES (99, 687, 't0');
+INSERT INTO notes VALUES (100, 1300, 't1');
+INSERT INTO notes VALUES (101, 1913, 't2');
+INSERT INTO notes VALUES (102, 2526, 't3');
+INSERT INTO notes VALUES (103, 139, 't4');
+INSERT INTO notes VALUES (104, 752, 't5');
+INSERT INTO notes VALUES (105, 1365, 't6');
+INSERT INTO notes VALUES (106, 1978, 't7');
+INSERT INTO notes VALUES (107, 2591, 't8');
+INSERT INTO notes VALUES (108, 204, 't0');
+INSERT INTO notes VALUES (109, 817, 't1');
+INSERT INTO notes VALUES (110, 1430, 't2');
+INSERT INTO notes VALUES (111, 2043, 't3');
+INSERT INTO notes VALUES (112, 2656, 't4');
+INSERT INTO notes VALUES (113, 269, 't5');
+INSERT INTO notes VALUES (114, 882, 't6');
+INSERT INTO notes VALUES (115, 1495, 't7');
+INSERT INTO notes VALUES (116, 2108, 't8');
+INSERT INTO notes VALUES (117, 2721, 't0');
+INSERT INTO notes VALUES (118, 334, 't1');
+INSERT INTO notes VALUES (119, 947, 't2');
+INSERT INTO notes VALUES (120, 1560, 't3');
+INSERT INTO notes VALUES (121, 2173, 't4');
+INSERT INTO notes VALUES (122, 2786, 't5');
+INSERT INTO notes VALUES (123, 399, 't6');
+INSERT INTO notes VALUES (124, 1012, 't7');
+INSERT INTO notes VALUES (125, 1625, 't8');
+INSERT INTO notes VALUES (126, 2238, 't0');
+INSERT INTO notes VALUES (127, 2851, 't1');
+INSERT INTO notes VALUES (128, 464, 't2');
+INSERT INTO notes VALUES (129, 1077, 't3');
+INSERT INTO notes VALUES (130, 1690, 't4');
+INSERT INTO notes VALUES (131, 2303, 't5');
+INSERT INTO notes VALUES (132, 2916, 't6');
+INSERT INTO notes VALUES (133, 529, 't7');
+INSERT INTO notes VALUES (134, 1142, 't8');
+INSERT INTO notes VALUES (135, 1755, 't0');
+INSERT INTO notes VALUES (136, 2368, 't1');
+INSERT INTO notes VALUES (137, 2981, 't2');
+INSERT INTO notes VALUES (138, 594, 't3');
+INSERT INTO notes VALUES (139, 1207, 't4');
+INSERT INTO notes VALUES (140, 1820, 't5');
+INSERT INTO notes VALUES (141, 2433, 't6');
+INSERT INTO notes VALUES (142, 46, 't7');
+INSERT INTO notes VALUES (143, 659, 't8');
+INSERT INTO notes VALUES (144, 1272, 't0');
+INSERT INTO notes VALUES (145, 1885, 't1');
+INSERT INTO notes VALUES (146, 2498, 't2');
+INSERT INTO notes VALUES (147, 111, 't3');
+INSERT INTO notes VALUES (148, 724, 't4');
+INSERT INTO notes VALUES (149, 1337, 't5');
+INSERT INTO notes VALUES (150, 1950, 't6');
+INSERT INTO notes VALUES (151, 2563, 't7');
+INSERT INTO notes VALUES (152, 176, 't8');
+INSERT INTO notes VALUES (153, 789, 't0');
+INSERT INTO notes VALUES (154, 1402, 't1');
+INSERT INTO notes VALUES (155, 2015, 't2');
+INSERT INTO notes VALUES (156, 2628, 't3');
+INSERT INTO notes VALUES (157, 241, 't4');
+INSERT INTO notes VALUES (158, 854, 't5');
+INSERT INTO notes VALUES (159, 1467, 't6');
+INSERT INTO notes VALUES (160, 2080, 't7');
+INSERT INTO notes VALUES (161, 2693, 't8');
+INSERT INTO notes VALUES (162, 306, 't0');
+INSERT INTO notes VALUES (163, 919, 't1');
+INSERT INTO notes VALUES (164, 1532, 't2');
+INSERT INTO notes VALUES (165, 2145, 't3');
+INSERT INTO notes VALUES (166, 2758, 't4');
+INSERT INTO notes VALUES (167, 371, 't5');
+INSERT INTO notes VALUES (168, 984, 't6');
+INSERT INTO notes VALUES (169, 1597, 't7');
+INSERT INTO notes VALUES (170, 2210, 't8');
+INSERT INTO notes VALUES (171, 2823, 't0');
+INSERT INTO notes VALUES (172, 436, 't1');
+INSERT INTO notes VALUES (173, 1049, 't2');
+INSERT INTO notes VALUES (174, 1662, 't3');
+INSERT INTO notes VALUES (175, 2275, 't4');
+INSERT INTO notes VALUES (176, 2888, 't5');
+INSERT INTO notes VALUES (177, 501, 't6');
+INSERT INTO notes VALUES (178, 1114, 't7');
+INSERT INTO notes VALUES (179, 1727, 't8');
+INSERT INTO notes VALUES (180, 2340, 't0');
+INSERT INTO notes VALUES (181, 2953, 't1');
+INSERT INTO notes VALUES (182, 566, 't2');
+INSERT INTO notes VALUES (183, 1179, 't3');
+INSERT INTO notes VALUES (184, 1792, 't4');
+INSERT INTO notes VALUES (185, 2405, 't5');
+INSERT INTO notes VALUES (186, 18, 't6');
+INSERT INTO notes VALUES (187, 631, 't7');
+INSERT INTO notes VALUES (188, 1244, 't8');
+INSERT INTO notes VALUES (189, 1857, 't0');
+INSERT INTO notes VALUES (190, 2470, 't1');
+INSERT INTO notes VALUES (191, 83, 't2');
+INSERT INTO notes VALUES (192, 696, 't3');
+INSERT INTO notes VALUES (193, 1309, 't4');
+INSERT INTO notes VALUES (194, 1922, 't5');
+INSERT INTO notes VALUES (195, 2535, 't6');
+INSERT INTO notes VALUES (196, 148, 't7');
+INSERT INTO notes VALUES (197, 761, 't8');
+INSERT INTO notes VALUES (198, 1374, 't0');
+INSERT INTO notes VALUES (199, 1987, 't1');
+INSERT INTO notes VALUES (200, 2600, 't2');
+INSERT INTO notes VALUES (201, 213, 't3');
+INSERT INTO notes VALUES (202, 826, 't4');
+INSERT INTO notes VALUES (203, 1439, 't5');
+INSERT INTO notes VALUES (204, 2052, 't6');
+INSERT INTO notes VALUES (205, 2665, 't7');
+INSERT INTO notes VALUES (206, 278, 't8');
+INSERT INTO notes VALUES (207, 891, 't0');
+INSERT INTO notes VALUES (208, 1504, 't1');
+INSERT INTO notes VALUES (209, 2117, 't2');
+INSERT INTO notes VALUES (210, 2730, 't3');
+INSERT INTO notes VALUES (211, 343, 't4');
+INSERT INTO notes VALUES (212, 956, 't5');
+INSERT INTO notes VALUES (213, 1569, 't6');
+INSERT INTO notes VALUES (214, 2182, 't7');
+INSERT INTO notes VALUES (215, 2795, 't8');
+INSERT INTO notes VALUES (216, 408, 't0');
+INSERT INTO notes VALUES (217, 1021, 't1');
+INSERT INTO notes VALUES (218, 1634, 't2');
+INSERT INTO notes VALUES (219, 2247, 't3');
+INSERT INTO notes VALUES (220, 2860, 't4');
+INSERT INTO notes VALUES (221, 473, 't5');
+INSERT INTO notes VALUES (222, 1086, 't6');
+INSERT INTO notes VALUES (223, 1699, 't7');
+INSERT INTO notes VALUES (224, 2312, 't8');
+INSERT INTO notes VALUES (225, 2925, 't0');
+INSERT INTO notes VALUES (226, 538, 't1');
+INSERT INTO notes VALUES (227, 1151, 't2');
+INSERT INTO notes VALUES (228, 1764, 't3');
+INSERT INTO notes VALUES (229, 2377, 't4');
+INSERT INTO notes VALUES (230, 2990, 't5');
+INSERT INTO notes VALUES (231, 603, 't6');
+INSERT INTO notes VALUES (232, 1216, 't7');
+INSERT INTO notes VALUES (233, 1829, 't8');
+INSERT INTO notes VALUES (234, 2442, 't0');
+INSERT INTO notes VALUES (235, 55, 't1');
+INSERT INTO notes VALUES (236, 668, 't2');
+INSERT INTO notes VALUES (237, 1281, 't3');
+INSERT INTO notes VALUES (238, 1894, 't4');
+INSERT INTO notes VALUES (239, 2507, 't5');
+INSERT INTO notes VALUES (240, 120, 't6');
+INSERT INTO notes VALUES (241, 733, 't7');
+INSERT INTO notes VALUES (242, 1346, 't8');
+INSERT INTO notes VALUES (243, 1959, 't0');
+INSERT INTO notes VALUES (244, 2572, 't1');
+INSERT INTO notes VALUES (245, 185, 't2');
+INSERT INTO notes VALUES (246, 798, 't3');
+INSERT INTO notes VALUES (247, 1411, 't4');
+INSERT INTO notes VALUES (248, 2024, 't5');
+INSERT INTO notes VALUES (249, 2637, 't6');
+INSERT INTO notes VALUES (250, 250, 't7');
+INSERT INTO notes VALUES (251, 863, 't8');
+INSERT INTO notes VALUES (252, 1476, 't0');
+INSERT INTO notes VALUES (253, 2089, 't1');
+INSERT INTO notes VALUES (254, 2702, 't2');
+INSERT INTO notes VALUES (255, 315, 't3');
+INSERT INTO notes VALUES (256, 928, 't4');
+INSERT INTO notes VALUES (257, 1541, 't5');
+INSERT INTO notes VALUES (258, 2154, 't6');
+INSERT INTO notes VALUES (259, 2767, 't7');
+INSERT INTO notes VALUES (260, 380, 't8');
+INSERT INTO notes VALUES (261, 993, 't0');
+INSERT INTO notes VALUES (262, 1606, 't1');
+INSERT INTO notes VALUES (263, 2219, 't2');
+INSERT INTO notes VALUES (264, 2832, 't3');
+INSERT INTO notes VALUES (265, 445, 't4');
+INSERT INTO notes VALUES (266, 1058, 't5');
+INSERT INTO notes VALUES (267, 1671, 't6');
+INSERT INTO notes VALUES (268, 2284, 't7');
+INSERT INTO notes VALUES (269, 2897, 't8');
+INSERT INTO notes VALUES (270, 510, 't0');
+INSERT INTO notes VALUES (271, 1123, 't1');
+INSERT INTO notes VALUES (272, 1736, 't2');
+INSERT INTO notes VALUES (273, 2349, 't3');
+INSERT INTO notes VALUES (274, 2962, 't4');
+INSERT INTO notes VALUES (275, 575, 't5');
+INSERT INTO notes VALUES (276, 1188, 't6');
+INSERT INTO notes VALUES (277, 1801, 't7');
+INSERT INTO notes VALUES (278, 2414, 't8');
+INSERT INTO notes VALUES (279, 27, 't0');
+INSERT INTO notes VALUES (280, 640, 't1');
+INSERT INTO notes VALUES (281, 1253, 't2');
+INSERT INTO notes VALUES (282, 1866, 't3');
+INSERT INTO notes VALUES (283, 2479, 't4');
+INSERT INTO notes VALUES (284, 92, 't5');
+INSERT INTO notes VALUES (285, 705, 't6');
+INSERT INTO notes VALUES (286, 1318, 't7');
+INSERT INTO notes VALUES (287, 1931, 't8');
+INSERT INTO notes VALUES (288, 2544, 't0');
+INSERT INTO notes VALUES (289, 157, 't1');
+INSERT INTO notes VALUES (290, 770, 't2');
+INSERT INTO notes VALUES (291, 1383, 't3');
+INSERT INTO notes VALUES (292, 1996, 't4');
+INSERT INTO notes VALUES (293, 2609, 't5');
+INSERT INTO notes VALUES (294, 222, 't6');
+INSERT INTO notes VALUES (295, 835, 't7');
+INSERT INTO notes VALUES (296, 1448, 't8');
+INSERT INTO notes VALUES (297, 2061, 't0');
+INSERT INTO notes VALUES (298, 2674, 't1');
+INSERT INTO notes VALUES (299, 287, 't2');
@@ -0,0 +1,6 @@
+USE DATABASE shop;
+SELECT items.id, orders.id, orders.qty FROM items INNER JOIN orders ON items.id = orders.item_id WHERE orders.qty < 1 AND items.id < 1500;
+SELECT items.name, orders.qty, notes.tag FROM items INNER JOIN orders ON items.id = orders.item_id INNER JOIN notes ON orders.id = notes.order_id WHERE notes.tag = 't5' AND items.id > 4000;
+SELECT orders.id, notes.id FROM orders INNER JOIN notes ON orders.id = notes.order_id WHERE orders.id > 2950;
+SELECT orders.id, items.name FROM orders INNER JOIN items ON orders.item_id = items.id WHERE orders.id < 4;
+SELECT id, name FROM items WHERE id < 3;
@@ -0,0 +1,5 @@
+USE DATABASE shop;
+SELECT id, name FROM items WHERE id < 3;
+SELECT orders.id, notes.id FROM orders INNER JOIN notes ON orders.id = notes.order_id WHERE orders.id > 2950;
+SELECT items.id, orders.id, orders.qty FROM items INNER JOIN orders ON items.id = orders.item_id WHERE orders.qty < 1 AND items.id < 1500;
+SELECT id, name FROM items WHERE id < 3;
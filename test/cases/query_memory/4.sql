@@ -0,0 +1,5 @@
+USE DATABASE shop;
+SELECT id, name FROM items WHERE id < 3;
+SELECT items.id, orders.id, orders.qty FROM items INNER JOIN orders ON items.id = orders.item_id WHERE orders.qty < 1 AND items.id < 1500;
+SELECT orders.id, items.name FROM orders INNER JOIN items ON orders.item_id = items.id WHERE orders.id < 4;
+SELECT id, name FROM items WHERE id < 3;
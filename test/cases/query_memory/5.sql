@@ -0,0 +1,2 @@
+USE DATABASE shop;
+SELECT orders.id, items.name FROM orders INNER JOIN items ON orders.item_id = items.id WHERE orders.id < 4;
@@ -0,0 +1,12021 @@
+CREATE DATABASE shop;
+USE DATABASE shop;
+CREATE TABLE items (id INTEGER, grp INTEGER, name TEXT);
+CREATE TABLE orders (id INTEGER, item_id INTEGER, qty INTEGER);
+CREATE TABLE notes (id INTEGER, order_id INTEGER, tag TEXT);
+INSERT INTO items VALUES (0, 0, 'item0');
+INSERT INTO items VALUES (1, 1, 'item1');
+INSERT INTO items VALUES (2, 2, 'item2');
+INSERT INTO items VALUES (3, 3, 'item3');
+INSERT INTO items VALUES (4, 4, 'item4');
+INSERT INTO items VALUES (5, 5, 'item5');
+INSERT INTO items VALUES (6, 6, 'item6');
+INSERT INTO items VALUES (7, 7, 'item7');
+INSERT INTO items VALUES (8, 8, 'item8');
+INSERT INTO items VALUES (9, 9, 'item9');
+INSERT INTO items VALUES (10, 10, 'item10');
+INSERT INTO items VALUES (11, 11, 'item11');
+INSERT INTO items VALUES (12, 12, 'item12');
+INSERT INTO items VALUES (13, 13, 'item13');
+INSERT INTO items VALUES (14, 14, 'item14');
+INSERT INTO items VALUES (15, 15, 'item15');
+INSERT INTO items VALUES (16, 16, 'item16');
+INSERT INTO items VALUES (17, 17, 'item17');
+INSERT INTO items VALUES (18, 18, 'item18');
+INSERT INTO items VALUES (19, 19, 'item19');
+INSERT INTO items VALUES (20, 20, 'item20');
+INSERT INTO items VALUES (21, 21, 'item21');
+INSERT INTO items VALUES (22, 22, 'item22');
+INSERT INTO items VALUES (23, 23, 'item23');
+INSERT INTO items VALUES (24, 24, 'item24');
+INSERT INTO items VALUES (25, 25, 'item25');
+INSERT INTO items VALUES (26, 26, 'item26');
+INSERT INTO items VALUES (27, 27, 'item27');
+INSERT INTO items VALUES (28, 28, 'item28');
+INSERT INTO items VALUES (29, 29, 'item29');
+INSERT INTO items VALUES (30, 30, 'item30');
+INSERT INTO items VALUES (31, 31, 'item31');
+INSERT INTO items VALUES (32, 32, 'item32');
+INSERT INTO items VALUES (33, 33, 'item33');
+INSERT INTO items VALUES (34, 34, 'item34');
+INSERT INTO items VALUES (35, 35, 'item35');
+INSERT INTO items VALUES (36, 36, 'item36');
+INSERT INTO items VALUES (37, 37, 'item37');
+INSERT INTO items VALUES (38, 38, 'item38');
+INSERT INTO items VALUES (39, 39, 'item39');
+INSERT INTO items VALUES (40, 40, 'item40');
+INSERT INTO items VALUES (41, 41, 'item41');
+INSERT INTO items VALUES (42, 42, 'item42');
+INSERT INTO items VALUES (43, 43, 'item43');
+INSERT INTO items VALUES (44, 44, 'item44');
+INSERT INTO items VALUES (45, 45, 'item45');
+INSERT INTO items VALUES (46, 46, 'item46');
+INSERT INTO items VALUES (47, 47, 'item47');
+INSERT INTO items VALUES (48, 48, 'item48');
+INSERT INTO items VALUES (49, 49, 'item49');
+INSERT INTO items VALUES (50, 50, 'item50');
+INSERT INTO items VALUES (51, 51, 'item51');
+INSERT INTO items VALUES (52, 52, 'item52');
+INSERT INTO items VALUES (53, 53, 'item53');
+INSERT INTO items VALUES (54, 54, 'item54');
+INSERT INTO items VALUES (55, 55, 'item55');
+INSERT INTO items VALUES (56, 56, 'item56');
+INSERT INTO items VALUES (57, 57, 'item57');
+INSERT INTO items VALUES (58, 58, 'item58');
+INSERT INTO items VALUES (59, 59, 'item59');
+INSERT INTO items VALUES (60, 60, 'item60');
+INSERT INTO items VALUES (61, 61, 'item61');
+INSERT INTO items VALUES (62, 62, 'item62');
+INSERT INTO items VALUES (63, 63, 'item63');
+INSERT INTO items VALUES (64, 64, 'item64');
+INSERT INTO items VALUES (65, 65, 'item65');
+INSERT INTO items VALUES (66, 66, 'item66');
+INSERT INTO items VALUES (67, 67, 'item67');
+INSERT INTO items VALUES (68, 68, 'item68');
+INSERT INTO items VALUES (69, 69, 'item69');
+INSERT INTO items VALUES (70, 70, 'item70');
+INSERT INTO items VALUES (71, 71, 'item71');
+INSERT INTO items VALUES (72, 72, 'item72');
+INSERT INTO items VALUES (73, 73, 'item73');
+INSERT INTO items VALUES (74, 74, 'item74');
+INSERT INTO items VALUES (75, 75, 'item75');
+INSERT INTO items VALUES (76, 76, 'item76');
+INSERT INTO items VALUES (77, 77, 'item77');
+INSERT INTO items VALUES (78, 78, 'item78');
+INSERT INTO items VALUES (79, 79, 'item79');
+INSERT INTO items VALUES (80, 80, 'item80');
+INSERT INTO items VALUES (81, 81, 'item81');
+INSERT INTO items VALUES (82, 82, 'item82');
+INSERT INTO items VALUES (83, 83, 'item83');
+INSERT INTO items VALUES (84, 84, 'item84');
+INSERT INTO items VALUES (85, 85, 'item85');
+INSERT INTO items VALUES (86, 86, 'item86');
+INSERT INTO items VALUES (87, 87, 'item87');
+INSERT INTO items VALUES (88, 88, 'item88');
+INSERT INTO items VALUES (89, 89, 'item89');
+INSERT INTO items VALUES (90, 90, 'item90');
+INSERT INTO items VALUES (91, 91, 'item91');
+INSERT INTO items VALUES (92, 92, 'item92');
+INSERT INTO items VALUES (93, 93, 'item93');
+INSERT INTO items VALUES (94, 94, 'item94');
+INSERT INTO items VALUES (95, 95, 'item95');
+INSERT INTO items VALUES (96, 96, 'item96');
+INSERT INTO items VALUES (97, 97, 'item97');
+INSERT INTO items VALUES (98, 98, 'item98');
+INSERT INTO items VALUES (99, 99, 'item99');
+INSERT INTO items VALUES (100, 0, 'item100');
+INSERT INTO items VALUES (101, 1, 'item101');
+INSERT INTO items VALUES (102, 2, 'item102');
+INSERT INTO items VALUES (103, 3, 'item103');
+INSERT INTO items VALUES (104, 4, 'item104');
+INSERT INTO items VALUES (105, 5, 'item105');
+INSERT INTO items VALUES (106, 6, 'item106');
+INSERT INTO items VALUES (107, 7, 'item107');
+INSERT INTO items VALUES (108, 8, 'item108');
+INSERT INTO items VALUES (109, 9, 'item109');
+INSERT INTO items VALUES (110, 10, 'item110');
+INSERT INTO items VALUES (111, 11, 'item111');
+INSERT INTO items VALUES (112, 12, 'item112');
+INSERT INTO items VALUES (113, 13, 'item113');
+INSERT INTO items VALUES (114, 14, 'item114');
+INSERT INTO items VALUES (115, 15, 'item115');
+INSERT INTO items VALUES (116, 16, 'item116');
+INSERT INTO items VALUES (117, 17, 'item117');
+INSERT INTO items VALUES (118, 18, 'item118');
+INSERT INTO items VALUES (119, 19, 'item119');
+INSERT INTO items VALUES (120, 20, 'item120');
+INSERT INTO items VALUES (121, 21, 'item121');
+INSERT INTO items VALUES (122, 22, 'item122');
+INSERT INTO items VALUES (123, 23, 'item123');
+INSERT INTO items VALUES (124, 24, 'item124');
+INSERT INTO items VALUES (125, 25, 'item125');
+INSERT INTO items VALUES (126, 26, 'item126');
+INSERT INTO items VALUES (127, 27, 'item127');
+INSERT INTO items VALUES (128, 28, 'item128');
+INSERT INTO items VALUES (129, 29, 'item129');
+INSERT INTO items VALUES (130, 30, 'item130');
+INSERT INTO items VALUES (131, 31, 'item131');
+INSERT INTO items VALUES (132, 32, 'item132');
+INSERT INTO items VALUES (133, 33, 'item133');
+INSERT INTO items VALUES (134, 34, 'item134');
+INSERT INTO items VALUES (135, 35, 'item135');
+INSERT INTO items VALUES (136, 36, 'item136');
+INSERT INTO items VALUES (137, 37, 'item137');
+INSERT INTO items VALUES (138, 38, 'item138');
+INSERT INTO items VALUES (139, 39, 'item139');
+INSERT INTO items VALUES (140, 40, 'item140');
+INSERT INTO items VALUES (141, 41, 'item141');
+INSERT INTO items VALUES (142, 42, 'item142');
+INSERT INTO items VALUES (143, 43, 'item143');
+INSERT INTO items VALUES (144, 44, 'item144');
+INSERT INTO items VALUES (145, 45, 'item145');
+INSERT INTO items VALUES (146, 46, 'item146');
+INSERT INTO items VALUES (147, 47, 'item147');
+INSERT INTO items VALUES (148, 48, 'item148');
+INSERT INTO items VALUES (149, 49, 'item149');
+INSERT INTO items VALUES (150, 50, 'item150');
+INSERT INTO items VALUES (151, 51, 'item151');
+INSERT INTO items VALUES (152, 52, 'item152');
+INSERT INTO items VALUES (153, 53, 'item153');
+INSERT INTO items VALUES (154, 54, 'item154');
+INSERT INTO items VALUES (155, 55, 'item155');
+INSERT INTO items VALUES (156, 56, 'item156');
+INSERT INTO items VALUES (157, 57, 'item157');
+INSERT INTO items VALUES (158, 58, 'item158');
+INSERT INTO items VALUES (159, 59, 'item159');
+INSERT INTO items VALUES (160, 60, 'item160');
+INSERT INTO items VALUES (161, 61, 'item161');
+INSERT INTO items VALUES (162, 62, 'item162');
+INSERT INTO items VALUES (163, 63, 'item163');
+INSERT INTO items VALUES (164, 64, 'item164');
+INSERT INTO items VALUES (165, 65, 'item165');
+INSERT INTO items VALUES (166, 66, 'item166');
+INSERT INTO items VALUES (167, 67, 'item167');
+INSERT INTO items VALUES (168, 68, 'item168');
+INSERT INTO items VALUES (169, 69, 'item169');
+INSERT INTO items VALUES (170, 70, 'item170');
+INSERT INTO items VALUES (171, 71, 'item171');
+INSERT INTO items VALUES (172, 72, 'item172');
+INSERT INTO items VALUES (173, 73, 'item173');
+INSERT INTO items VALUES (174, 74, 'item174');
+INSERT INTO items VALUES (175, 75, 'item175');
+INSERT INTO items VALUES (176, 76, 'item176');
+INSERT INTO items VALUES (177, 77, 'item177');
+INSERT INTO items VALUES (178, 78, 'item178');
+INSERT INTO items VALUES (179, 79, 'item179');
+INSERT INTO items VALUES (180, 80, 'item180');
+INSERT INTO items VALUES (181, 81, 'item181');
+INSERT INTO items VALUES (182, 82, 'item182');
+INSERT INTO items VALUES (183, 83, 'item183');
+INSERT INTO items VALUES (184, 84, 'item184');
+INSERT INTO items VALUES (185, 85, 'item185');
+INSERT INTO items VALUES (186, 86, 'item186');
+INSERT INTO items VALUES (187, 87, 'item187');
+INSERT INTO items VALUES (188, 88, 'item188');
+INSERT INTO items VALUES (189, 89, 'item189');
+INSERT INTO items VALUES (190, 90, 'item190');
+INSERT INTO items VALUES (191, 91, 'item191');
+INSERT INTO items VALUES (192, 92, 'item192');
+INSERT INTO items VALUES (193, 93, 'item193');
+INSERT INTO items VALUES (194, 94, 'item194');
+INSERT INTO items VALUES (195, 95, 'item195');
+INSERT INTO items VALUES (196, 96, 'item196');
+INSERT INTO items VALUES (197, 97, 'item197');
+INSERT INTO items VALUES (198, 98, 'item198');
+INSERT INTO items VALUES (199, 99, 'item199');
+INSERT INTO items VALUES (200, 0, 'item200');
+INSERT INTO items VALUES (201, 1, 'item201');
+INSERT INTO items VALUES (202, 2, 'item202');
+INSERT INTO items VALUES (203, 3, 'item203');
+INSERT INTO items VALUES (204, 4, 'item204');
+INSERT INTO items VALUES (205, 5, 'item205');
+INSERT INTO items VALUES (206, 6, 'item206');
+INSERT INTO items VALUES (207, 7, 'item207');
+INSERT INTO items VALUES (208, 8, 'item208');
+INSERT INTO items VALUES (209, 9, 'item209');
+INSERT INTO items VALUES (210, 10, 'item210');
+INSERT INTO items VALUES (211, 11, 'item211');
+INSERT INTO items VALUES (212, 12, 'item212');
+INSERT INTO items VALUES (213, 13, 'item213');
+INSERT INTO items VALUES (214, 14, 'item214');
+INSERT INTO items VALUES (215, 15, 'item215');
+INSERT INTO items VALUES (216, 16, 'item216');
+INSERT INTO items VALUES (217, 17, 'item217');
+INSERT INTO items VALUES (218, 18, 'item218');
+INSERT INTO items VALUES (219, 19, 'item219');
+INSERT INTO items VALUES (220, 20, 'item220');
+INSERT INTO items VALUES (221, 21, 'item221');
+INSERT INTO items VALUES (222, 22, 'item222');
+INSERT INTO items VALUES (223, 23, 'item223');
+INSERT INTO items VALUES (224, 24, 'item224');
+INSERT INTO items VALUES (225, 25, 'item225');
+INSERT INTO items VALUES (226, 26, 'item226');
+INSERT INTO items VALUES (227, 27, 'item227');
+INSERT INTO items VALUES (228, 28, 'item228');
+INSERT INTO items VALUES (229, 29, 'item229');
+INSERT INTO items VALUES (230, 30, 'item230');
+INSERT INTO items VALUES (231, 31, 'item231');
+INSERT INTO items VALUES (232, 32, 'item232');
+INSERT INTO items VALUES (233, 33, 'item233');
+INSERT INTO items VALUES (234, 34, 'item234');
+INSERT INTO items VALUES (235, 35, 'item235');
+INSERT INTO items VALUES (236, 36, 'item236');
+INSERT INTO items VALUES (237, 37, 'item237');
+INSERT INTO items VALUES (238, 38, 'item238');
+INSERT INTO items VALUES (239, 39, 'item239');
+INSERT INTO items VALUES (240, 40, 'item240');
+INSERT INTO items VALUES (241, 41, 'item241');
+INSERT INTO items VALUES (242, 42, 'item242');
+INSERT INTO items VALUES (243, 43, 'item243');
+INSERT INTO items VALUES (244, 44, 'item244');
+INSERT INTO items VALUES (245, 45, 'item245');
+INSERT INTO items VALUES (246, 46, 'item246');
+INSERT INTO items VALUES (247, 47, 'item247');
+INSERT INTO items VALUES (248, 48, 'item248');
+INSERT INTO items VALUES (249, 49, 'item249');
+INSERT INTO items VALUES (250, 50, 'item250');
+INSERT INTO items VALUES (251, 51, 'item251');
+INSERT INTO items VALUES (252, 52, 'item252');
+INSERT INTO items VALUES (253, 53, 'item253');
+INSERT INTO items VALUES (254, 54, 'item254');
+INSERT INTO items VALUES (255, 55, 'item255');
+INSERT INTO items VALUES (256, 56, 'item256');
+INSERT INTO items VALUES (257, 57, 'item257');
+INSERT INTO items VALUES (258, 58, 'item258');
+INSERT INTO items VALUES (259, 59, 'item259');
+INSERT INTO items VALUES (260, 60, 'item260');
+INSERT INTO items VALUES (261, 61, 'item261');
+INSERT INTO items VALUES (262, 62, 'item262');
+INSERT INTO items VALUES (263, 63, 'item263');
+INSERT INTO items VALUES (264, 64, 'item264');
+INSERT INTO items VALUES (265, 65, 'item265');
+INSERT INTO items VALUES (266, 66, 'item266');
+INSERT INTO items VALUES (267, 67, 'item267');
+INSERT INTO items VALUES (268, 68, 'item268');
+INSERT INTO items VALUES (269, 69, 'item269');
+INSERT INTO items VALUES (270, 70, 'item270');
+INSERT INTO items VALUES (271, 71, 'item271');
+INSERT INTO items VALUES (272, 72, 'item272');
+INSERT INTO items VALUES (273, 73, 'item273');
+INSERT INTO items VALUES (274, 74, 'item274');
+INSERT INTO items VALUES (275, 75, 'item275');
+INSERT INTO items VALUES (276, 76, 'item276');
+INSERT INTO items VALUES (277, 77, 'item277');
+INSERT INTO items VALUES (278, 78, 'item278');
+INSERT INTO items VALUES (279, 79, 'item279');
+INSERT INTO items VALUES (280, 80, 'item280');
+INSERT INTO items VALUES (281, 81, 'item281');
+INSERT INTO items VALUES (282, 82, 'item282');
+INSERT INTO items VALUES (283, 83, 'item283');
+INSERT INTO items VALUES (284, 84, 'item284');
+INSERT INTO items VALUES (285, 85, 'item285');
+INSERT INTO items VALUES (286, 86, 'item286');
+INSERT INTO items VALUES (287, 87, 'item287');
+INSERT INTO items VALUES (288, 88, 'item288');
+INSERT INTO items VALUES (289, 89, 'item289');
+INSERT INTO items VALUES (290, 90, 'item290');
+INSERT INTO items VALUES (291, 91, 'item291');
+INSERT INTO items VALUES (292, 92, 'item292');
+INSERT INTO items VALUES (293, 93, 'item293');
+INSERT INTO items VALUES (294, 94, 'item294');
+INSERT INTO items VALUES (295, 95, 'item295');
+INSERT INTO items VALUES (296, 96, 'item296');
+INSERT INTO items VALUES (297, 97, 'item297');
+INSERT INTO items VALUES (298, 98, 'item298');
+INSERT INTO items VALUES (299, 99, 'item299');
+INSERT INTO items VALUES (300, 0, 'item300');
+INSERT INTO items VALUES (301, 1, 'item301');
+INSERT INTO items VALUES (302, 2, 'item302');
+INSERT INTO items VALUES (303, 3, 'item303');
+INSERT INTO items VALUES (304, 4, 'item304');
+INSERT INTO items VALUES (305, 5, 'item305');
+INSERT INTO items VALUES (306, 6, 'item306');
+INSERT INTO items VALUES (307, 7, 'item307');
+INSERT INTO items VALUES (308, 8, 'item308');
+INSERT INTO items VALUES (309, 9, 'item309');
+INSERT INTO items VALUES (310, 10, 'item310');
+INSERT INTO items VALUES (311, 11, 'item311');
+INSERT INTO items VALUES (312, 12, 'item312');
+INSERT INTO items VALUES (313, 13, 'item313');
+INSERT INTO items VALUES (314, 14, 'item314');
+INSERT INTO items VALUES (315, 15, 'item315');
+INSERT INTO items VALUES (316, 16, 'item316');
+INSERT INTO items VALUES (317, 17, 'item317');
+INSERT INTO items VALUES (318, 18, 'item318');
+INSERT INTO items VALUES (319, 19, 'item319');
+INSERT INTO items VALUES (320, 20, 'item320');
+INSERT INTO items VALUES (321, 21, 'item321');
+INSERT INTO items VALUES (322, 22, 'item322');
+INSERT INTO items VALUES (323, 23, 'item323');
+INSERT INTO items VALUES (324, 24, 'item324');
+INSERT INTO items VALUES (325, 25, 'item325');
+INSERT INTO items VALUES (326, 26, 'item326');
+INSERT INTO items VALUES (327, 27, 'item327');
+INSERT INTO items VALUES (328, 28, 'item328');
+INSERT INTO items VALUES (329, 29, 'item329');
+INSERT INTO items VALUES (330, 30, 'item330');
+INSERT INTO items VALUES (331, 31, 'item331');
+INSERT INTO items VALUES (332, 32, 'item332');
+INSERT INTO items VALUES (333, 33, 'item333');
+INSERT INTO items VALUES (334, 34, 'item334');
+INSERT INTO items VALUES (335, 35, 'item335');
+INSERT INTO items VALUES (336, 36, 'item336');
+INSERT INTO items VALUES (337, 37, 'item337');
+INSERT INTO items VALUES (338, 38, 'item338');
+INSERT INTO items VALUES (339, 39, 'item339');
+INSERT INTO items VALUES (340, 40, 'item340');
+INSERT INTO items VALUES (341, 41, 'item341');
+INSERT INTO items VALUES (342, 42, 'item342');
+INSERT INTO items VALUES (343, 43, 'item343');
+INSERT INTO items VALUES (344, 44, 'item344');
+INSERT INTO items VALUES (345, 45, 'item345');
+INSERT INTO items VALUES (346, 46, 'item346');
+INSERT INTO items VALUES (347, 47, 'item347');
+INSERT INTO items VALUES (348, 48, 'item348');
+INSERT INTO items VALUES (349, 49, 'item349');
+INSERT INTO items VALUES (350, 50, 'item350');
+INSERT INTO items VALUES (351, 51, 'item351');
+INSERT INTO items VALUES (352, 52, 'item352');
+INSERT INTO items VALUES (353, 53, 'item353');
+INSERT INTO items VALUES (354, 54, 'item354');
+INSERT INTO items VALUES (355, 55, 'item355');
+INSERT INTO items VALUES (356, 56, 'item356');
+INSERT INTO items VALUES (357, 57, 'item357');
+INSERT INTO items VALUES (358, 58, 'item358');
+INSERT INTO items VALUES (359, 59, 'item359');
+INSERT INTO items VALUES (360, 60, 'item360');
+INSERT INTO items VALUES (361, 61, 'item361');
+INSERT INTO items VALUES (362, 62, 'item362');
+INSERT INTO items VALUES (363, 63, 'item363');
+INSERT INTO items VALUES (364, 64, 'item364');
+INSERT INTO items VALUES (365, 65, 'item365');
+INSERT INTO items VALUES (366, 66, 'item366');
+INSERT INTO items VALUES (367, 67, 'item367');
+INSERT INTO items VALUES (368, 68, 'item368');
+INSERT INTO items VALUES (369, 69, 'item369');
+INSERT INTO items VALUES (370, 70, 'item370');
+INSERT INTO items VALUES (371, 71, 'item371');
+INSERT INTO items VALUES (372, 72, 'item372');
+INSERT INTO items VALUES (373, 73, 'item373');
+INSERT INTO items VALUES (374, 74, 'item374');
+INSERT INTO items VALUES (375, 75, 'item375');
+INSERT INTO items VALUES (376, 76, 'item376');
+INSERT INTO items VALUES (377, 77, 'item377');
+INSERT INTO items VALUES (378, 78, 'item378');
+INSERT INTO items VALUES (379, 79, 'item379');
+INSERT INTO items VALUES (380, 80, 'item380');
+INSERT INTO items VALUES (381, 81, 'item381');
+INSERT INTO items VALUES (382, 82, 'item382');
+INSERT INTO items VALUES (383, 83, 'item383');
+INSERT INTO items VALUES (384, 84, 'item384');
+INSERT INTO items VALUES (385, 85, 'item385');
+INSERT INTO items VALUES (386, 86, 'item386');
+INSERT INTO items VALUES (387, 87, 'item387');
+INSERT INTO items VALUES (388, 88, 'item388');
+INSERT INTO items VALUES (389, 89, 'item389');
+INSERT INTO items VALUES (390, 90, 'item390');
+INSERT INTO items VALUES (391, 91, 'item391');
+INSERT INTO items VALUES (392, 92, 'item392');
+INSERT INTO items VALUES (393, 93, 'item393');
+INSERT INTO items VALUES (394, 94, 'item394');
+INSERT INTO items VALUES (395, 95, 'item395');
+INSERT INTO items VALUES (396, 96, 'item396');
+INSERT INTO items VALUES (397, 97, 'item397');
+INSERT INTO items VALUES (398, 98, 'item398');
+INSERT INTO items VALUES (399, 99, 'item399');
+INSERT INTO items VALUES (400, 0, 'item400');
+INSERT INTO items VALUES (401, 1, 'item401');
+INSERT INTO items VALUES (402, 2, 'item402');
+INSERT INTO items VALUES (403, 3, 'item403');
+INSERT INTO items VALUES (404, 4, 'item404');
+INSERT INTO items VALUES (405, 5, 'item405');
+INSERT INTO items VALUES (406, 6, 'item406');
+INSERT INTO items VALUES (407, 7, 'item407');
+INSERT INTO items VALUES (408, 8, 'item408');
+INSERT INTO items VALUES (409, 9, 'item409');
+INSERT INTO items VALUES (410, 10, 'item410');
+INSERT INTO items VALUES (411, 11, 'item411');
+INSERT INTO items VALUES (412, 12, 'item412');
+INSERT INTO items VALUES (413, 13, 'item413');
+INSERT INTO items VALUES (414, 14, 'item414');
+INSERT INTO items VALUES (415, 15, 'item415');
+INSERT INTO items VALUES (416, 16, 'item416');
+INSERT INTO items VALUES (417, 17, 'item417');
+INSERT INTO items VALUES (418, 18, 'item418');
+INSERT INTO items VALUES (419, 19, 'item419');
+INSERT INTO items VALUES (420, 20, 'item420');
+INSERT INTO items VALUES (421, 21, 'item421');
+INSERT INTO items VALUES (422, 22, 'item422');
+INSERT INTO items VALUES (423, 23, 'item423');
+INSERT INTO items VALUES (424, 24, 'item424');
+INSERT INTO items VALUES (425, 25, 'item425');
+INSERT INTO items VALUES (426, 26, 'item426');
+INSERT INTO items VALUES (427, 27, 'item427');
+INSERT INTO items VALUES (428, 28, 'item428');
+INSERT INTO items VALUES (429, 29, 'item429');
+INSERT INTO items VALUES (430, 30, 'item430');
+INSERT INTO items VALUES (431, 31, 'item431');
+INSERT INTO items VALUES (432, 32, 'item432');
+INSERT INTO items VALUES (433, 33, 'item433');
+INSERT INTO items VALUES (434, 34, 'item434');
+INSERT INTO items VALUES (435, 35, 'item435');
+INSERT INTO items VALUES (436, 36, 'item436');
+INSERT INTO items VALUES (437, 37, 'item437');
+INSERT INTO items VALUES (438, 38, 'item438');
+INSERT INTO items VALUES (439, 39, 'item439');
+INSERT INTO items VALUES (440, 40, 'item440');
+INSERT INTO items VALUES (441, 41, 'item441');
+INSERT INTO items VALUES (442, 42, 'item442');
+INSERT INTO items VALUES (443, 43, 'item443');
+INSERT INTO items VALUES (444, 44, 'item444');
+INSERT INTO items VALUES (445, 45, 'item445');
+INSERT INTO items VALUES (446, 46, 'item446');
+INSERT INTO items VALUES (447, 47, 'item447');
+INSERT INTO items VALUES (448, 48, 'item448');
+INSERT INTO items VALUES (449, 49, 'item449');
+INSERT INTO items VALUES (450, 50, 'item450');
+INSERT INTO items VALUES (451, 51, 'item451');
+INSERT INTO items VALUES (452, 52, 'item452');
+INSERT INTO items VALUES (453, 53, 'item453');
+INSERT INTO items VALUES (454, 54, 'item454');
+INSERT INTO items VALUES (455, 55, 'item455');
+INSERT INTO items VALUES (456, 56, 'item456');
+INSERT INTO items VALUES (457, 57, 'item457');
+INSERT INTO items VALUES (458, 58, 'item458');
+INSERT INTO items VALUES (459, 59, 'item459');
+INSERT INTO items VALUES (460, 60, 'item460');
+INSERT INTO items VALUES (461, 61, 'item461');
+INSERT INTO items VALUES (462, 62, 'item462');
+INSERT INTO items VALUES (463, 63, 'item463');
+INSERT INTO items VALUES (464, 64, 'item464');
+INSERT INTO items VALUES (465, 65, 'item465');
+INSERT INTO items VALUES (466, 66, 'item466');
+INSERT INTO items VALUES (467, 67, 'item467');
+INSERT INTO items VALUES (468, 68, 'item468');
+INSERT INTO items VALUES (469, 69, 'item469');
+INSERT INTO items VALUES (470, 70, 'item470');
+INSERT INTO items VALUES (471, 71, 'item471');
+INSERT INTO items VALUES (472, 72, 'item472');
+INSERT INTO items VALUES (473, 73, 'item473');
+INSERT INTO items VALUES (474, 74, 'item474');
+INSERT INTO items VALUES (475, 75, 'item475');
+INSERT INTO items VALUES (476, 76, 'item476');
+INSERT INTO items VALUES (477, 77, 'item477');
+INSERT INTO items VALUES (478, 78, 'item478');
+INSERT INTO items VALUES (479, 79, 'item479');
+INSERT INTO items VALUES (480, 80, 'item480');
+INSERT INTO items VALUES (481, 81, 'item481');
+INSERT INTO items VALUES (482, 82, 'item482');
+INSERT INTO items VALUES (483, 83, 'item483');
+INSERT INTO items VALUES (484, 84, 'item484');
+INSERT INTO items VALUES (485, 85, 'item485');
+INSERT INTO items VALUES (486, 86, 'item486');
+INSERT INTO items VALUES (487, 87, 'item487');
+INSERT INTO items VALUES (488, 88, 'item488');
+INSERT INTO items VALUES (489, 89, 'item489');
+INSERT INTO items VALUES (490, 90, 'item490');
+INSERT INTO items VALUES (491, 91, 'item491');
+INSERT INTO items VALUES (492, 92, 'item492');
+INSERT INTO items VALUES (493, 93, 'item493');
+INSERT INTO items VALUES (494, 94, 'item494');
+INSERT INTO items VALUES (495, 95, 'item495');
+INSERT INTO items VALUES (496, 96, 'item496');
+INSERT INTO items VALUES (497, 97, 'item497');
+INSERT INTO items VALUES (498, 98, 'item498');
+INSERT INTO items VALUES (499, 99, 'item499');
+INSERT INTO items VALUES (500, 0, 'item500');
+INSERT INTO items VALUES (501, 1, 'item501');
+INSERT INTO items VALUES (502, 2, 'item502');
+INSERT INTO items VALUES (503, 3, 'item503');
+INSERT INTO items VALUES (504, 4, 'item504');
+INSERT INTO items VALUES (505, 5, 'item505');
+INSERT INTO items VALUES (506, 6, 'item506');
+INSERT INTO items VALUES (507, 7, 'item507');
+INSERT INTO items VALUES (508, 8, 'item508');
+INSERT INTO items VALUES (509, 9, 'item509');
+INSERT INTO items VALUES (510, 10, 'item510');
+INSERT INTO items VALUES (511, 11, 'item511');
+INSERT INTO items VALUES (512, 12, 'item512');
+INSERT INTO items VALUES (513, 13, 'item513');
+INSERT INTO items VALUES (514, 14, 'item514');
+INSERT INTO items VALUES (515, 15, 'item515');
+INSERT INTO items VALUES (516, 16, 'item516');
+INSERT INTO items VALUES (517, 17, 'item517');
+INSERT INTO items VALUES (518, 18, 'item518');
+INSERT INTO items VALUES (519, 19, 'item519');
+INSERT INTO items VALUES (520, 20, 'item520');
+INSERT INTO items VALUES (521, 21, 'item521');
+INSERT INTO items VALUES (522, 22, 'item522');
+INSERT INTO items VALUES (523, 23, 'item523');
+INSERT INTO items VALUES (524, 24, 'item524');
+INSERT INTO items VALUES (525, 25, 'item525');
+INSERT INTO items VALUES (526, 26, 'item526');
+INSERT INTO items VALUES (527, 27, 'item527');
+INSERT INTO items VALUES (528, 28, 'item528');
+INSERT INTO items VALUES (529, 29, 'item529');
+INSERT INTO items VALUES (530, 30, 'item530');
+INSERT INTO items VALUES (531, 31, 'item531');
+INSERT INTO items VALUES (532, 32, 'item532');
+INSERT INTO items VALUES (533, 33, 'item533');
+INSERT INTO items VALUES (534, 34, 'item534');
+INSERT INTO items VALUES (535, 35, 'item535');
+INSERT INTO items VALUES (536, 36, 'item536');
+INSERT INTO items VALUES (537, 37, 'item537');
+INSERT INTO items VALUES (538, 38, 'item538');
+INSERT INTO items VALUES (539, 39, 'item539');
+INSERT INTO items VALUES (540, 40, 'item540');
+INSERT INTO items VALUES (541, 41, 'item541');
+INSERT INTO items VALUES (542, 42, 'item542');
+INSERT INTO items VALUES (543, 43, 'item543');
+INSERT INTO items VALUES (544, 44, 'item544');
+INSERT INTO items VALUES (545, 45, 'item545');
+INSERT INTO items VALUES (546, 46, 'item546');
+INSERT INTO items VALUES (547, 47, 'item547');
+INSERT INTO items VALUES (548, 48, 'item548');
+INSERT INTO items VALUES (549, 49, 'item549');
+INSERT INTO items VALUES (550, 50, 'item550');
+INSERT INTO items VALUES (551, 51, 'item551');
+INSERT INTO items VALUES (552, 52, 'item552');
+INSERT INTO items VALUES (553, 53, 'item553');
+INSERT INTO items VALUES (554, 54, 'item554');
+INSERT INTO items VALUES (555, 55, 'item555');
+INSERT INTO items VALUES (556, 56, 'item556');
+INSERT INTO items VALUES (557, 57, 'item557');
+INSERT INTO items VALUES (558, 58, 'item558');
+INSERT INTO items VALUES (559, 59, 'item559');
+INSERT INTO items VALUES (560, 60, 'item560');
+INSERT INTO items VALUES (561, 61, 'item561');
+INSERT INTO items VALUES (562, 62, 'item562');
+INSERT INTO items VALUES (563, 63, 'item563');
+INSERT INTO items VALUES (564, 64, 'item564');
+INSERT INTO items VALUES (565, 65, 'item565');
+INSERT INTO items VALUES (566, 66, 'item566');
+INSERT INTO items VALUES (567, 67, 'item567');
+INSERT INTO items VALUES (568, 68, 'item568');
+INSERT INTO items VALUES (569, 69, 'item569');
+INSERT INTO items VALUES (570, 70, 'item570');
+INSERT INTO items VALUES (571, 71, 'item571');
+INSERT INTO items VALUES (572, 72, 'item572');
+INSERT INTO items VALUES (573, 73, 'item573');
+INSERT INTO items VALUES (574, 74, 'item574');
+INSERT INTO items VALUES (575, 75, 'item575');
+INSERT INTO items VALUES (576, 76, 'item576');
+INSERT INTO items VALUES (577, 77, 'item577');
+INSERT INTO items VALUES (578, 78, 'item578');
+INSERT INTO items VALUES (579, 79, 'item579');
+INSERT INTO items VALUES (580, 80, 'item580');
+INSERT INTO items VALUES (581, 81, 'item581');
+INSERT INTO items VALUES (582, 82, 'item582');
+INSERT INTO items VALUES (583, 83, 'item583');
+INSERT INTO items VALUES (584, 84, 'item584');
+INSERT INTO items VALUES (585, 85, 'item585');
+INSERT INTO items VALUES (586, 86, 'item586');
+INSERT INTO items VALUES (587, 87, 'item587');
+INSERT INTO items VALUES (588, 88, 'item588');
+INSERT INTO items VALUES (589, 89, 'item589');
+INSERT INTO items VALUES (590, 90, 'item590');
+INSERT INTO items VALUES (591, 91, 'item591');
+INSERT INTO items VALUES (592, 92, 'item592');
+INSERT INTO items VALUES (593, 93, 'item593');
+INSERT INTO items VALUES (594, 94, 'item594');
+INSERT INTO items VALUES (595, 95, 'item595');
+INSERT INTO items VALUES (596, 96, 'item596');
+INSERT INTO items VALUES (597, 97, 'item597');
+INSERT INTO items VALUES (598, 98, 'item598');
+INSERT INTO items VALUES (599, 99, 'item599');
+INSERT INTO items VALUES (600, 0, 'item600');
+INSERT INTO items VALUES (601, 1, 'item601');
+INSERT INTO items VALUES (602, 2, 'item602');
+INSERT INTO items VALUES (603, 3, 'item603');
+INSERT INTO items VALUES (604, 4, 'item604');
+INSERT INTO items VALUES (605, 5, 'item605');
+INSERT INTO items VALUES (606, 6, 'item606');
+INSERT INTO items VALUES (607, 7, 'item607');
+INSERT INTO items VALUES (608, 8, 'item608');
+INSERT INTO items VALUES (609, 9, 'item609');
+INSERT INTO items VALUES (610, 10, 'item610');
+INSERT INTO items VALUES (611, 11, 'item611');
+INSERT INTO items VALUES (612, 12, 'item612');
+INSERT INTO items VALUES (613, 13, 'item613');
+INSERT INTO items VALUES (614, 14, 'item614');
+INSERT INTO items VALUES (615, 15, 'item615');
+INSERT INTO items VALUES (616, 16, 'item616');
+INSERT INTO items VALUES (617, 17, 'item617');
+INSERT INTO items VALUES (618, 18, 'item618');
+INSERT INTO items VALUES (619, 19, 'item619');
+INSERT INTO items VALUES (620, 20, 'item620');
+INSERT INTO items VALUES (621, 21, 'item621');
+INSERT INTO items VALUES (622, 22, 'item622');
+INSERT INTO items VALUES (623, 23, 'item623');
+INSERT INTO items VALUES (624, 24, 'item624');
+INSERT INTO items VALUES (625, 25, 'item625');
+INSERT INTO items VALUES (626, 26, 'item626');
+INSERT INTO items VALUES (627, 27, 'item627');
+INSERT INTO items VALUES (628, 28, 'item628');
+INSERT INTO items VALUES (629, 29, 'item629');
+INSERT INTO items VALUES (630, 30, 'item630');
+INSERT INTO items VALUES (631, 31, 'item631');
+INSERT INTO items VALUES (632, 32, 'item632');
+INSERT INTO items VALUES (633, 33, 'item633');
+INSERT INTO items VALUES (634, 34, 'item634');
+INSERT INTO items VALUES (635, 35, 'item635');
+INSERT INTO items VALUES (636, 36, 'item636');
+INSERT INTO items VALUES (637, 37, 'item637');
+INSERT INTO items VALUES (638, 38, 'item638');
+INSERT INTO items VALUES (639, 39, 'item639');
+INSERT INTO items VALUES (640, 40, 'item640');
+INSERT INTO items VALUES (641, 41, 'item641');
+INSERT INTO items VALUES (642, 42, 'item642');
+INSERT INTO items VALUES (643, 43, 'item643');
+INSERT INTO items VALUES (644, 44, 'item644');
+INSERT INTO items VALUES (645, 45, 'item645');
+INSERT INTO items VALUES (646, 46, 'item646');
+INSERT INTO items VALUES (647, 47, 'item647');
+INSERT INTO items VALUES (648, 48, 'item648');
+INSERT INTO items VALUES (649, 49, 'item649');
+INSERT INTO items VALUES (650, 50, 'item650');
+INSERT INTO items VALUES (651, 51, 'item651');
+INSERT INTO items VALUES (652, 52, 'item652');
+INSERT INTO items VALUES (653, 53, 'item653');
+INSERT INTO items VALUES (654, 54, 'item654');
+INSERT INTO items VALUES (655, 55, 'item655');
+INSERT INTO items VALUES (656, 56, 'item656');
+INSERT INTO items VALUES (657, 57, 'item657');
+INSERT INTO items VALUES (658, 58, 'item658');
+INSERT INTO items VALUES (659, 59, 'item659');
+INSERT INTO items VALUES (660, 60, 'item660');
+INSERT INTO items VALUES (661, 61, 'item661');
+INSERT INTO items VALUES (662, 62, 'item662');
+INSERT INTO items VALUES (663, 63, 'item663');
+INSERT INTO items VALUES (664, 64, 'item664');
+INSERT INTO items VALUES (665, 65, 'item665');
+INSERT INTO items VALUES (666, 66, 'item666');
+INSERT INTO items VALUES (667, 67, 'item667');
+INSERT INTO items VALUES (668, 68, 'item668');
+INSERT INTO items VALUES (669, 69, 'item669');
+INSERT INTO items VALUES (670, 70, 'item670');
+INSERT INTO items VALUES (671, 71, 'item671');
+INSERT INTO items VALUES (672, 72, 'item672');
+INSERT INTO items VALUES (673, 73, 'item673');
+INSERT INTO items VALUES (674, 74, 'item674');
+INSERT INTO items VALUES (675, 75, 'item675');
+INSERT INTO items VALUES (676, 76, 'item676');
+INSERT INTO items VALUES (677, 77, 'item677');
+INSERT INTO items VALUES (678, 78, 'item678');
+INSERT INTO items VALUES (679, 79, 'item679');
+INSERT INTO items VALUES (680, 80, 'item680');
+INSERT INTO items VALUES (681, 81, 'item681');
+INSERT INTO items VALUES (682, 82, 'item682');
+INSERT INTO items VALUES (683, 83, 'item683');
+INSERT INTO items VALUES (684, 84, 'item684');
+INSERT INTO items VALUES (685, 85, 'item685');
+INSERT INTO items VALUES (686, 86, 'item686');
+INSERT INTO items VALUES (687, 87, 'item687');
+INSERT INTO items VALUES (688, 88, 'item688');
+INSERT INTO items VALUES (689, 89, 'item689');
+INSERT INTO items VALUES (690, 90, 'item690');
+INSERT INTO items VALUES (691, 91, 'item691');
+INSERT INTO items VALUES (692, 92, 'item692');
+INSERT INTO items VALUES (693, 93, 'item693');
+INSERT INTO items VALUES (694, 94, 'item694');
+INSERT INTO items VALUES (695, 95, 'item695');
+INSERT INTO items VALUES (696, 96, 'item696');
+INSERT INTO items VALUES (697, 97, 'item697');
+INSERT INTO items VALUES (698, 98, 'item698');
+INSERT INTO items VALUES (699, 99, 'item699');
+INSERT INTO items VALUES (700, 0, 'item700');
+INSERT INTO items VALUES (701, 1, 'item701');
+INSERT INTO items VALUES (702, 2, 'item702');
+INSERT INTO items VALUES (703, 3, 'item703');
+INSERT INTO items VALUES (704, 4, 'item704');
+INSERT INTO items VALUES (705, 5, 'item705');
+INSERT INTO items VALUES (706, 6, 'item706');
+INSERT INTO items VALUES (707, 7, 'item707');
+INSERT INTO items VALUES (708, 8, 'item708');
+INSERT INTO items VALUES (709, 9, 'item709');
+INSERT INTO items VALUES (710, 10, 'item710');
+INSERT INTO items VALUES (711, 11, 'item711');
+INSERT INTO items VALUES (712, 12, 'item712');
+INSERT INTO items VALUES (713, 13, 'item713');
+INSERT INTO items VALUES (714, 14, 'item714');
+INSERT INTO items VALUES (715, 15, 'item715');
+INSERT INTO items VALUES (716, 16, 'item716');
+INSERT INTO items VALUES (717, 17, 'item717');
+INSERT INTO items VALUES (718, 18, 'item718');
+INSERT INTO items VALUES (719, 19, 'item719');
+INSERT INTO items VALUES (720, 20, 'item720');
+INSERT INTO items VALUES (721, 21, 'item721');
+INSERT INTO items VALUES (722, 22, 'item722');
+INSERT INTO items VALUES (723, 23, 'item723');
+INSERT INTO items VALUES (724, 24, 'item724');
+INSERT INTO items VALUES (725, 25, 'item725');
+INSERT INTO items VALUES (726, 26, 'item726');
+INSERT INTO items VALUES (727, 27, 'item727');
+INSERT INTO items VALUES (728, 28, 'item728');
+INSERT INTO items VALUES (729, 29, 'item729');
+INSERT INTO items VALUES (730, 30, 'item730');
+INSERT INTO items VALUES (731, 31, 'item731');
+INSERT INTO items VALUES (732, 32, 'item732');
+INSERT INTO items VALUES (733, 33, 'item733');
+INSERT INTO items VALUES (734, 34, 'item734');
+INSERT INTO items VALUES (735, 35, 'item735');
+INSERT INTO items VALUES (736, 36, 'item736');
+INSERT INTO items VALUES (737, 37, 'item737');
+INSERT INTO items VALUES (738, 38, 'item738');
+INSERT INTO items VALUES (739, 39, 'item739');
+INSERT INTO items VALUES (740, 40, 'item740');
+INSERT INTO items VALUES (741, 41, 'item741');
+INSERT INTO items VALUES (742, 42, 'item742');
+INSERT INTO items VALUES (743, 43, 'item743');
+INSERT INTO items VALUES (744, 44, 'item744');
+INSERT INTO items VALUES (745, 45, 'item745');
+INSERT INTO items VALUES (746, 46, 'item746');
+INSERT INTO items VALUES (747, 47, 'item747');
+INSERT INTO items VALUES (748, 48, 'item748');
+INSERT INTO items VALUES (749, 49, 'item749');
+INSERT INTO items VALUES (750, 50, 'item750');
+INSERT INTO items VALUES (751, 51, 'item751');
+INSERT INTO items VALUES (752, 52, 'item752');
+INSERT INTO items VALUES (753, 53, 'item753');
+INSERT INTO items VALUES (754, 54, 'item754');
+INSERT INTO items VALUES (755, 55, 'item755');
+INSERT INTO items VALUES (756, 56, 'item756');
+INSERT INTO items VALUES (757, 57, 'item757');
+INSERT INTO items VALUES (758, 58, 'item758');
+INSERT INTO items VALUES (759, 59, 'item759');
+INSERT INTO items VALUES (760, 60, 'item760');
+INSERT INTO items VALUES (761, 61, 'item761');
+INSERT INTO items VALUES (762, 62, 'item762');
+INSERT INTO items VALUES (763, 63, 'item763');
+INSERT INTO items VALUES (764, 64, 'item764');
+INSERT INTO items VALUES (765, 65, 'item765');
+INSERT INTO items VALUES (766, 66, 'item766');
+INSERT INTO items VALUES (767, 67, 'item767');
+INSERT INTO items VALUES (768, 68, 'item768');
+INSERT INTO items VALUES (769, 69, 'item769');
+INSERT INTO items VALUES (770, 70, 'item770');
+INSERT INTO items VALUES (771, 71, 'item771');
+INSERT INTO items VALUES (772, 72, 'item772');
+INSERT INTO items VALUES (773, 73, 'item773');
+INSERT INTO items VALUES (774, 74, 'item774');
+INSERT INTO items VALUES (775, 75, 'item775');
+INSERT INTO items VALUES (776, 76, 'item776');
+INSERT INTO items VALUES (777, 77, 'item777');
+INSERT INTO items VALUES (778, 78, 'item778');
+INSERT INTO items VALUES (779, 79, 'item779');
+INSERT INTO items VALUES (780, 80, 'item780');
+INSERT INTO items VALUES (781, 81, 'item781');
+INSERT INTO items VALUES (782, 82, 'item782');
+INSERT INTO items VALUES (783, 83, 'item783');
+INSERT INTO items VALUES (784, 84, 'item784');
+INSERT INTO items VALUES (785, 85, 'item785');
+INSERT INTO items VALUES (786, 86, 'item786');
+INSERT INTO items VALUES (787, 87, 'item787');
+INSERT INTO items VALUES (788, 88, 'item788');
+INSERT INTO items VALUES (789, 89, 'item789');
+INSERT INTO items VALUES (790, 90, 'item790');
+INSERT INTO items VALUES (791, 91, 'item791');
+INSERT INTO items VALUES (792, 92, 'item792');
+INSERT INTO items VALUES (793, 93, 'item793');
+INSERT INTO items VALUES (794, 94, 'item794');
+INSERT INTO items VALUES (795, 95, 'item795');
+INSERT INTO items VALUES (796, 96, 'item796');
+INSERT INTO items VALUES (797, 97, 'item797');
+INSERT INTO items VALUES (798, 98, 'item798');
+INSERT INTO items VALUES (799, 99, 'item799');
+INSERT INTO items VALUES (800, 0, 'item800');
+INSERT INTO items VALUES (801, 1, 'item801');
+INSERT INTO items VALUES (802, 2, 'item802');
+INSERT INTO items VALUES (803, 3, 'item803');
+INSERT INTO items VALUES (804, 4, 'item804');
+INSERT INTO items VALUES (805, 5, 'item805');
+INSERT INTO items VALUES (806, 6, 'item806');
+INSERT INTO items VALUES (807, 7, 'item807');
+INSERT INTO items VALUES (808, 8, 'item808');
+INSERT INTO items VALUES (809, 9, 'item809');
+INSERT INTO items VALUES (810, 10, 'item810');
+INSERT INTO items VALUES (811, 11, 'item811');
+INSERT INTO items VALUES (812, 12, 'item812');
+INSERT INTO items VALUES (813, 13, 'item813');
+INSERT INTO items VALUES (814, 14, 'item814');
+INSERT INTO items VALUES (815, 15, 'item815');
+INSERT INTO items VALUES (816, 16, 'item816');
+INSERT INTO items VALUES (817, 17, 'item817');
+INSERT INTO items VALUES (818, 18, 'item818');
+INSERT INTO items VALUES (819, 19, 'item819');
+INSERT INTO items VALUES (820, 20, 'item820');
+INSERT INTO items VALUES (821, 21, 'item821');
+INSERT INTO items VALUES (822, 22, 'item822');
+INSERT INTO items VALUES (823, 23, 'item823');
+INSERT INTO items VALUES (824, 24, 'item824');
+INSERT INTO items VALUES (825, 25, 'item825');
+INSERT INTO items VALUES (826, 26, 'item826');
+INSERT INTO items VALUES (827, 27, 'item827');
+INSERT INTO items VALUES (828, 28, 'item828');
+INSERT INTO items VALUES (829, 29, 'item829');
+INSERT INTO items VALUES (830, 30, 'item830');
+INSERT INTO items VALUES (831, 31, 'item831');
+INSERT INTO items VALUES (832, 32, 'item832');
+INSERT INTO items VALUES (833, 33, 'item833');
+INSERT INTO items VALUES (834, 34, 'item834');
+INSERT INTO items VALUES (835, 35, 'item835');
+INSERT INTO items VALUES (836, 36, 'item836');
+INSERT INTO items VALUES (837, 37, 'item837');
+INSERT INTO items VALUES (838, 38, 'item838');
+INSERT INTO items VALUES (839, 39, 'item839');
+INSERT INTO items VALUES (840, 40, 'item840');
+INSERT INTO items VALUES (841, 41, 'item841');
+INSERT INTO items VALUES (842, 42, 'item842');
+INSERT INTO items VALUES (843, 43, 'item843');
+INSERT INTO items VALUES (844, 44, 'item844');
+INSERT INTO items VALUES (845, 45, 'item845');
+INSERT INTO items VALUES (846, 46, 'item846');
+INSERT INTO items VALUES (847, 47, 'item847');
+INSERT INTO items VALUES (848, 48, 'item848');
+INSERT INTO items VALUES (849, 49, 'item849');
+INSERT INTO items VALUES (850, 50, 'item850');
+INSERT INTO items VALUES (851, 51, 'item851');
+INSERT INTO items VALUES (852, 52, 'item852');
+INSERT INTO items VALUES (853, 53, 'item853');
+INSERT INTO items VALUES (854, 54, 'item854');
+INSERT INTO items VALUES (855, 55, 'item855');
+INSERT INTO items VALUES (856, 56, 'item856');
+INSERT INTO items VALUES (857, 57, 'item857');
+INSERT INTO items VALUES (858, 58, 'item858');
+INSERT INTO items VALUES (859, 59, 'item859');
+INSERT INTO items VALUES (860, 60, 'item860');
+INSERT INTO items VALUES (861, 61, 'item861');
+INSERT INTO items VALUES (862, 62, 'item862');
+INSERT INTO items VALUES (863, 63, 'item863');
+INSERT INTO items VALUES (864, 64, 'item864');
+INSERT INTO items VALUES (865, 65, 'item865');
+INSERT INTO items VALUES (866, 66, 'item866');
+INSERT INTO items VALUES (867, 67, 'item867');
+INSERT INTO items VALUES (868, 68, 'item868');
+INSERT INTO items VALUES (869, 69, 'item869');
+INSERT INTO items VALUES (870, 70, 'item870');
+INSERT INTO items VALUES (871, 71, 'item871');
+INSERT INTO items VALUES (872, 72, 'item872');
+INSERT INTO items VALUES (873, 73, 'item873');
+INSERT INTO items VALUES (874, 74, 'item874');
+INSERT INTO items VALUES (875, 75, 'item875');
+INSERT INTO items VALUES (876, 76, 'item876');
+INSERT INTO items VALUES (877, 77, 'item877');
+INSERT INTO items VALUES (878, 78, 'item878');
+INSERT INTO items VALUES (879, 79, 'item879');
+INSERT INTO items VALUES (880, 80, 'item880');
+INSERT INTO items VALUES (881, 81, 'item881');
+INSERT INTO items VALUES (882, 82, 'item882');
+INSERT INTO items VALUES (883, 83, 'item883');
+INSERT INTO items VALUES (884, 84, 'item884');
+INSERT INTO items VALUES (885, 85, 'item885');
+INSERT INTO items VALUES (886, 86, 'item886');
+INSERT INTO items VALUES (887, 87, 'item887');
+INSERT INTO items VALUES (888, 88, 'item888');
+INSERT INTO items VALUES (889, 89, 'item889');
+INSERT INTO items VALUES (890, 90, 'item890');
+INSERT INTO items VALUES (891, 91, 'item891');
+INSERT INTO items VALUES (892, 92, 'item892');
+INSERT INTO items VALUES (893, 93, 'item893');
+INSERT INTO items VALUES (894, 94, 'item894');
+INSERT INTO items VALUES (895, 95, 'item895');
+INSERT INTO items VALUES (896, 96, 'item896');
+INSERT INTO items VALUES (897, 97, 'item897');
+INSERT INTO items VALUES (898, 98, 'item898');
+INSERT INTO items VALUES (899, 99, 'item899');
+INSERT INTO items VALUES (900, 0, 'item900');
+INSERT INTO items VALUES (901, 1, 'item901');
+INSERT INTO items VALUES (902, 2, 'item902');
+INSERT INTO items VALUES (903, 3, 'item903');
+INSERT INTO items VALUES (904, 4, 'item904');
+INSERT INTO items VALUES (905, 5, 'item905');
+INSERT INTO items VALUES (906, 6, 'item906');
+INSERT INTO items VALUES (907, 7, 'item907');
+INSERT INTO items VALUES (908, 8, 'item908');
+INSERT INTO items VALUES (909, 9, 'item909');
+INSERT INTO items VALUES (910, 10, 'item910');
+INSERT INTO items VALUES (911, 11, 'item911');
+INSERT INTO items VALUES (912, 12, 'item912');
+INSERT INTO items VALUES (913, 13, 'item913');
+INSERT INTO items VALUES (914, 14, 'item914');
+INSERT INTO items VALUES (915, 15, 'item915');
+INSERT INTO items VALUES (916, 16, 'item916');
+INSERT INTO items VALUES (917, 17, 'item917');
+INSERT INTO items VALUES (918, 18, 'item918');
+INSERT INTO items VALUES (919, 19, 'item919');
+INSERT INTO items VALUES (920, 20, 'item920');
+INSERT INTO items VALUES (921, 21, 'item921');
+INSERT INTO items VALUES (922, 22, 'item922');
+INSERT INTO items VALUES (923, 23, 'item923');
+INSERT INTO items VALUES (924, 24, 'item924');
+INSERT INTO items VALUES (925, 25, 'item925');
+INSERT INTO items VALUES (926, 26, 'item926');
+INSERT INTO items VALUES (927, 27, 'item927');
+INSERT INTO items VALUES (928, 28, 'item928');
+INSERT INTO items VALUES (929, 29, 'item929');
+INSERT INTO items VALUES (930, 30, 'item930');
+INSERT INTO items VALUES (931, 31, 'item931');
+INSERT INTO items VALUES (932, 32, 'item932');
+INSERT INTO items VALUES (933, 33, 'item933');
+INSERT INTO items VALUES (934, 34, 'item934');
+INSERT INTO items VALUES (935, 35, 'item935');
+INSERT INTO items VALUES (936, 36, 'item936');
+INSERT INTO items VALUES (937, 37, 'item937');
+INSERT INTO items VALUES (938, 38, 'item938');
+INSERT INTO items VALUES (939, 39, 'item939');
+INSERT INTO items VALUES (940, 40, 'item940');
+INSERT INTO items VALUES (941, 41, 'item941');
+INSERT INTO items VALUES (942, 42, 'item942');
+INSERT INTO items VALUES (943, 43, 'item943');
+INSERT INTO items VALUES (944, 44, 'item944');
+INSERT INTO items VALUES (945, 45, 'item945');
+INSERT INTO items VALUES (946, 46, 'item946');
+INSERT INTO items VALUES (947, 47, 'item947');
+INSERT INTO items VALUES (948, 48, 'item948');
+INSERT INTO items VALUES (949, 49, 'item949');
+INSERT INTO items VALUES (950, 50, 'item950');
+INSERT INTO items VALUES (951, 51, 'item951');
+INSERT INTO items VALUES (952, 52, 'item952');
+INSERT INTO items VALUES (953, 53, 'item953');
+INSERT INTO items VALUES (954, 54, 'item954');
+INSERT INTO items VALUES (955, 55, 'item955');
+INSERT INTO items VALUES (956, 56, 'item956');
+INSERT INTO items VALUES (957, 57, 'item957');
+INSERT INTO items VALUES (958, 58, 'item958');
+INSERT INTO items VALUES (959, 59, 'item959');
+INSERT INTO items VALUES (960, 60, 'item960');
+INSERT INTO items VALUES (961, 61, 'item961');
+INSERT INTO items VALUES (962, 62, 'item962');
+INSERT INTO items VALUES (963, 63, 'item963');
+INSERT INTO items VALUES (964, 64, 'item964');
+INSERT INTO items VALUES (965, 65, 'item965');
+INSERT INTO items VALUES (966, 66, 'item966');
+INSERT INTO items VALUES (967, 67, 'item967');
+INSERT INTO items VALUES (968, 68, 'item968');
+INSERT INTO items VALUES (969, 69, 'item969');
+INSERT INTO items VALUES (970, 70, 'item970');
+INSERT INTO items VALUES (971, 71, 'item971');
+INSERT INTO items VALUES (972, 72, 'item972');
+INSERT INTO items VALUES (973, 73, 'item973');
+INSERT INTO items VALUES (974, 74, 'item974');
+INSERT INTO items VALUES (975, 75, 'item975');
+INSERT INTO items VALUES (976, 76, 'item976');
+INSERT INTO items VALUES (977, 77, 'item977');
+INSERT INTO items VALUES (978, 78, 'item978');
+INSERT INTO items VALUES (979, 79, 'item979');
+INSERT INTO items VALUES (980, 80, 'item980');
+INSERT INTO items VALUES (981, 81, 'item981');
+INSERT INTO items VALUES (982, 82, 'item982');
+INSERT INTO items VALUES (983, 83, 'item983');
+INSERT INTO items VALUES (984, 84, 'item984');
+INSERT INTO items VALUES (985, 85, 'item985');
+INSERT INTO items VALUES (986, 86, 'item986');
+INSERT INTO items VALUES (987, 87, 'item987');
+INSERT INTO items VALUES (988, 88, 'item988');
+INSERT INTO items VALUES (989, 89, 'item989');
+INSERT INTO items VALUES (990, 90, 'item990');
+INSERT INTO items VALUES (991, 91, 'item991');
+INSERT INTO items VALUES (992, 92, 'item992');
+INSERT INTO items VALUES (993, 93, 'item993');
+INSERT INTO items VALUES (994, 94, 'item994');
+INSERT INTO items VALUES (995, 95, 'item995');
+INSERT INTO items VALUES (996, 96, 'item996');
+INSERT INTO items VALUES (997, 97, 'item997');
+INSERT INTO items VALUES (998, 98, 'item998');
+INSERT INTO items VALUES (999, 99, 'item999');
+INSERT INTO items VALUES (1000, 0, 'item1000');
+INSERT INTO items VALUES (1001, 1, 'item1001');
+INSERT INTO items VALUES (1002, 2, 'item1002');
+INSERT INTO items VALUES (1003, 3, 'item1003');
+INSERT INTO items VALUES (1004, 4, 'item1004');
+INSERT INTO items VALUES (1005, 5, 'item1005');
+INSERT INTO items VALUES (1006, 6, 'item1006');
+INSERT INTO items VALUES (1007, 7, 'item1007');
+INSERT INTO items VALUES (1008, 8, 'item1008');
+INSERT INTO items VALUES (1009, 9, 'item1009');
+INSERT INTO items VALUES (1010, 10, 'item1010');
+INSERT INTO items VALUES (1011, 11, 'item1011');
+INSERT INTO items VALUES (1012, 12, 'item1012');
+INSERT INTO items VALUES (1013, 13, 'item1013');
+INSERT INTO items VALUES (1014, 14, 'item1014');
+INSERT INTO items VALUES (1015, 15, 'item1015');
+INSERT INTO items VALUES (1016, 16, 'item1016');
+INSERT INTO items VALUES (1017, 17, 'item1017');
+INSERT INTO items VALUES (1018, 18, 'item1018');
+INSERT INTO items VALUES (1019, 19, 'item1019');
+INSERT INTO items VALUES (1020, 20, 'item1020');
+INSERT INTO items VALUES (1021, 21, 'item1021');
+INSERT INTO items VALUES (1022, 22, 'item1022');
+INSERT INTO items VALUES (1023, 23, 'item1023');
+INSERT INTO items VALUES (1024, 24, 'item1024');
+INSERT INTO items VALUES (1025, 25, 'item1025');
+INSERT INTO items VALUES (1026, 26, 'item1026');
+INSERT INTO items VALUES (1027, 27, 'item1027');
+INSERT INTO items VALUES (1028, 28, 'item1028');
+INSERT INTO items VALUES (1029, 29, 'item1029');
+INSERT INTO items VALUES (1030, 30, 'item1030');
+INSERT INTO items VALUES (1031, 31, 'item1031');
+INSERT INTO items VALUES (1032, 32, 'item1032');
+INSERT INTO items VALUES (1033, 33, 'item1033');
+INSERT INTO items VALUES (1034, 34, 'item1034');
+INSERT INTO items VALUES (1035, 35, 'item1035');
+INSERT INTO items VALUES (1036, 36, 'item1036');
+INSERT INTO items VALUES (1037, 37, 'item1037');
+INSERT INTO items VALUES (1038, 38, 'item1038');
+INSERT INTO items VALUES (1039, 39, 'item1039');
+INSERT INTO items VALUES (1040, 40, 'item1040');
+INSERT INTO items VALUES (1041, 41, 'item1041');
+INSERT INTO items VALUES (1042, 42, 'item1042');
+INSERT INTO items VALUES (1043, 43, 'item1043');
+INSERT INTO items VALUES (1044, 44, 'item1044');
+INSERT INTO items VALUES (1045, 45, 'item1045');
+INSERT INTO items VALUES (1046, 46, 'item1046');
+INSERT INTO items VALUES (1047, 47, 'item1047');
+INSERT INTO items VALUES (1048, 48, 'item1048');
+INSERT INTO items VALUES (1049, 49, 'item1049');
+INSERT INTO items VALUES (1050, 50, 'item1050');
+INSERT INTO items VALUES (1051, 51, 'item1051');
+INSERT INTO items VALUES (1052, 52, 'item1052');
+INSERT INTO items VALUES (1053, 53, 'item1053');
+INSERT INTO items VALUES (1054, 54, 'item1054');
+INSERT INTO items VALUES (1055, 55, 'item1055');
+INSERT INTO items VALUES (1056, 56, 'item1056');
+INSERT INTO items VALUES (1057, 57, 'item1057');
+INSERT INTO items VALUES (1058, 58, 'item1058');
+INSERT INTO items VALUES (1059, 59, 'item1059');
+INSERT INTO items VALUES (1060, 60, 'item1060');
+INSERT INTO items VALUES (1061, 61, 'item1061');
+INSERT INTO items VALUES (1062, 62, 'item1062');
+INSERT INTO items VALUES (1063, 63, 'item1063');
+INSERT INTO items VALUES (1064, 64, 'item1064');
+INSERT INTO items VALUES (1065, 65, 'item1065');
+INSERT INTO items VALUES (1066, 66, 'item1066');
+INSERT INTO items VALUES (1067, 67, 'item1067');
+INSERT INTO items VALUES (1068, 68, 'item1068');
+INSERT INTO items VALUES (1069, 69, 'item1069');
+INSERT INTO items VALUES (1070, 70, 'item1070');
+INSERT INTO items VALUES (1071, 71, 'item1071');
+INSERT INTO items VALUES (1072, 72, 'item1072');
+INSERT INTO items VALUES (1073, 73, 'item1073');
+INSERT INTO items VALUES (1074, 74, 'item1074');
+INSERT INTO items VALUES (1075, 75, 'item1075');
+INSERT INTO items VALUES (1076, 76, 'item1076');
+INSERT INTO items VALUES (1077, 77, 'item1077');
+INSERT INTO items VALUES (1078, 78, 'item1078');
+INSERT INTO items VALUES (1079, 79, 'item1079');
+INSERT INTO items VALUES (1080, 80, 'item1080');
+INSERT INTO items VALUES (1081, 81, 'item1081');
+INSERT INTO items VALUES (1082, 82, 'item1082');
+INSERT INTO items VALUES (1083, 83, 'item1083');
+INSERT INTO items VALUES (1084, 84, 'item1084');
+INSERT INTO items VALUES (1085, 85, 'item1085');
+INSERT INTO items VALUES (1086, 86, 'item1086');
+INSERT INTO items VALUES (1087, 87, 'item1087');
+INSERT INTO items VALUES (1088, 88, 'item1088');
+INSERT INTO items VALUES (1089, 89, 'item1089');
+INSERT INTO items VALUES (1090, 90, 'item1090');
+INSERT INTO items VALUES (1091, 91, 'item1091');
+INSERT INTO items VALUES (1092, 92, 'item1092');
+INSERT INTO items VALUES (1093, 93, 'item1093');
+INSERT INTO items VALUES (1094, 94, 'item1094');
+INSERT INTO items VALUES (1095, 95, 'item1095');
+INSERT INTO items VALUES (1096, 96, 'item1096');
+INSERT INTO items VALUES (1097, 97, 'item1097');
+INSERT INTO items VALUES (1098, 98, 'item1098');
+INSERT INTO items VALUES (1099, 99, 'item1099');
+INSERT INTO items VALUES (1100, 0, 'item1100');
+INSERT INTO items VALUES (1101, 1, 'item1101');
+INSERT INTO items VALUES (1102, 2, 'item1102');
+INSERT INTO items VALUES (1103, 3, 'item1103');
+INSERT INTO items VALUES (1104, 4, 'item1104');
+INSERT INTO items VALUES (1105, 5, 'item1105');
+INSERT INTO items VALUES (1106, 6, 'item1106');
+INSERT INTO items VALUES (1107, 7, 'item1107');
+INSERT INTO items VALUES (1108, 8, 'item1108');
+INSERT INTO items VALUES (1109, 9, 'item1109');
+INSERT INTO items VALUES (1110, 10, 'item1110');
+INSERT INTO items VALUES (1111, 11, 'item1111');
+INSERT INTO items VALUES (1112, 12, 'item1112');
+INSERT INTO items VALUES (1113, 13, 'item1113');
+INSERT INTO items VALUES (1114, 14, 'item1114');
+INSERT INTO items VALUES (1115, 15, 'item1115');
+INSERT INTO items VALUES (1116, 16, 'item1116');
+INSERT INTO items VALUES (1117, 17, 'item1117');
+INSERT INTO items VALUES (1118, 18, 'item1118');
+INSERT INTO items VALUES (1119, 19, 'item1119');
+INSERT INTO items VALUES (1120, 20, 'item1120');
+INSERT INTO items VALUES (1121, 21, 'item1121');
+INSERT INTO items VALUES (1122, 22, 'item1122');
+INSERT INTO items VALUES (1123, 23, 'item1123');
+INSERT INTO items VALUES (1124, 24, 'item1124');
+INSERT INTO items VALUES (1125, 25, 'item1125');
+INSERT INTO items VALUES (1126, 26, 'item1126');
+INSERT INTO items VALUES (1127, 27, 'item1127');
+INSERT INTO items VALUES (1128, 28, 'item1128');
+INSERT INTO items VALUES (1129, 29, 'item1129');
+INSERT INTO items VALUES (1130, 30, 'item1130');
+INSERT INTO items VALUES (1131, 31, 'item1131');
+INSERT INTO items VALUES (1132, 32, 'item1132');
+INSERT INTO items VALUES (1133, 33, 'item1133');
+INSERT INTO items VALUES (1134, 34, 'item1134');
+INSERT INTO items VALUES (1135, 35, 'item1135');
+INSERT INTO items VALUES (1136, 36, 'item1136');
+INSERT INTO items VALUES (1137, 37, 'item1137');
+INSERT INTO items VALUES (1138, 38, 'item1138');
+INSERT INTO items VALUES (1139, 39, 'item1139');
+INSERT INTO items VALUES (1140, 40, 'item1140');
+INSERT INTO items VALUES (1141, 41, 'item1141');
+INSERT INTO items VALUES (1142, 42, 'item1142');
+INSERT INTO items VALUES (1143, 43, 'item1143');
+INSERT INTO items VALUES (1144, 44, 'item1144');
+INSERT INTO items VALUES (1145, 45, 'item1145');
+INSERT INTO items VALUES (1146, 46, 'item1146');
+INSERT INTO items VALUES (1147, 47, 'item1147');
+INSERT INTO items VALUES (1148, 48, 'item1148');
+INSERT INTO items VALUES (1149, 49, 'item1149');
+INSERT INTO items VALUES (1150, 50, 'item1150');
+INSERT INTO items VALUES (1151, 51, 'item1151');
+INSERT INTO items VALUES (1152, 52, 'item1152');
+INSERT INTO items VALUES (1153, 53, 'item1153');
+INSERT INTO items VALUES (1154, 54, 'item1154');
+INSERT INTO items VALUES (1155, 55, 'item1155');
+INSERT INTO items VALUES (1156, 56, 'item1156');
+INSERT INTO items VALUES (1157, 57, 'item1157');
+INSERT INTO items VALUES (1158, 58, 'item1158');
+INSERT INTO items VALUES (1159, 59, 'item1159');
+INSERT INTO items VALUES (1160, 60, 'item1160');
+INSERT INTO items VALUES (1161, 61, 'item1161');
+INSERT INTO items VALUES (1162, 62, 'item1162');
+INSERT INTO items VALUES (1163, 63, 'item1163');
+INSERT INTO items VALUES (1164, 64, 'item1164');
+INSERT INTO items VALUES (1165, 65, 'item1165');
+INSERT INTO items VALUES (1166, 66, 'item1166');
+INSERT INTO items VALUES (1167, 67, 'item1167');
+INSERT INTO items VALUES (1168, 68, 'item1168');
+INSERT INTO items VALUES (1169, 69, 'item1169');
+INSERT INTO items VALUES (1170, 70, 'item1170');
+INSERT INTO items VALUES (1171, 71, 'item1171');
+INSERT INTO items VALUES (1172, 72, 'item1172');
+INSERT INTO items VALUES (1173, 73, 'item1173');
+INSERT INTO items VALUES (1174, 74, 'item1174');
+INSERT INTO items VALUES (1175, 75, 'item1175');
+INSERT INTO items VALUES (1176, 76, 'item1176');
+INSERT INTO items VALUES (1177, 77, 'item1177');
+INSERT INTO items VALUES (1178, 78, 'item1178');
+INSERT INTO items VALUES (1179, 79, 'item1179');
+INSERT INTO items VALUES (1180, 80, 'item1180');
+INSERT INTO items VALUES (1181, 81, 'item1181');
+INSERT INTO items VALUES (1182, 82, 'item1182');
+INSERT INTO items VALUES (1183, 83, 'item1183');
+INSERT INTO items VALUES (1184, 84, 'item1184');
+INSERT INTO items VALUES (1185, 85, 'item1185');
+INSERT INTO items VALUES (1186, 86, 'item1186');
+INSERT INTO items VALUES (1187, 87, 'item1187');
+INSERT INTO items VALUES (1188, 88, 'item1188');
+INSERT INTO items VALUES (1189, 89, 'item1189');
+INSERT INTO items VALUES (1190, 90, 'item1190');
+INSERT INTO items VALUES (1191, 91, 'item1191');
+INSERT INTO items VALUES (1192, 92, 'item1192');
+INSERT INTO items VALUES (1193, 93, 'item1193');
+INSERT INTO items VALUES (1194, 94, 'item1194');
+INSERT INTO items VALUES (1195, 95, 'item1195');
+INSERT INTO items VALUES (1196, 96, 'item1196');
+INSERT INTO items VALUES (1197, 97, 'item1197');
+INSERT INTO items VALUES (1198, 98, 'item1198');
+INSERT INTO items VALUES (1199, 99, 'item1199');
+INSERT INTO items VALUES (1200, 0, 'item1200');
+INSERT INTO items VALUES (1201, 1, 'item1201');
+INSERT INTO items VALUES (1202, 2, 'item1202');
+INSERT INTO items VALUES (1203, 3, 'item1203');
+INSERT INTO items VALUES (1204, 4, 'item1204');
+INSERT INTO items VALUES (1205, 5, 'item1205');
+INSERT INTO items VALUES (1206, 6, 'item1206');
+INSERT INTO items VALUES (1207, 7, 'item1207');
+INSERT INTO items VALUES (1208, 8, 'item1208');
+INSERT INTO items VALUES (1209, 9, 'item1209');
+INSERT INTO items VALUES (1210, 10, 'item1210');
+INSERT INTO items VALUES (1211, 11, 'item1211');
+INSERT INTO items VALUES (1212, 12, 'item1212');
+INSERT INTO items VALUES (1213, 13, 'item1213');
+INSERT INTO items VALUES (1214, 14, 'item1214');
+INSERT INTO items VALUES (1215, 15, 'item1215');
+INSERT INTO items VALUES (1216, 16, 'item1216');
+INSERT INTO items VALUES (1217, 17, 'item1217');
+INSERT INTO items VALUES (1218, 18, 'item1218');
+INSERT INTO items VALUES (1219, 19, 'item1219');
+INSERT INTO items VALUES (1220, 20, 'item1220');
+INSERT INTO items VALUES (1221, 21, 'item1221');
+INSERT INTO items VALUES (1222, 22, 'item1222');
+INSERT INTO items VALUES (1223, 23, 'item1223');
+INSERT INTO items VALUES (1224, 24, 'item1224');
+INSERT INTO items VALUES (1225, 25, 'item1225');
+INSERT INTO items VALUES (1226, 26, 'item1226');
+INSERT INTO items VALUES (1227, 27, 'item1227');
+INSERT INTO items VALUES (1228, 28, 'item1228');
+INSERT INTO items VALUES (1229, 29, 'item1229');
+INSERT INTO items VALUES (1230, 30, 'item1230');
+INSERT INTO items VALUES (1231, 31, 'item1231');
+INSERT INTO items VALUES (1232, 32, 'item1232');
+INSERT INTO items VALUES (1233, 33, 'item1233');
+INSERT INTO items VALUES (1234, 34, 'item1234');
+INSERT INTO items VALUES (1235, 35, 'item1235');
+INSERT INTO items VALUES (1236, 36, 'item1236');
+INSERT INTO items VALUES (1237, 37, 'item1237');
+INSERT INTO items VALUES (1238, 38, 'item1238');
+INSERT INTO items VALUES (1239, 39, 'item1239');
+INSERT INTO items VALUES (1240, 40, 'item1240');
+INSERT INTO items VALUES (1241, 41, 'item1241');
+INSERT INTO items VALUES (1242, 42, 'item1242');
+INSERT INTO items VALUES (1243, 43, 'item1243');
+INSERT INTO items VALUES (1244, 44, 'item1244');
+INSERT INTO items VALUES (1245, 45, 'item1245');
+INSERT INTO items VALUES (1246, 46, 'item1246');
+INSERT INTO items VALUES (1247, 47, 'item1247');
+INSERT INTO items VALUES (1248, 48, 'item1248');
+INSERT INTO items VALUES (1249, 49, 'item1249');
+INSERT INTO items VALUES (1250, 50, 'item1250');
+INSERT INTO items VALUES (1251, 51, 'item1251');
+INSERT INTO items VALUES (1252, 52, 'item1252');
+INSERT INTO items VALUES (1253, 53, 'item1253');
+INSERT INTO items VALUES (1254, 54, 'item1254');
+INSERT INTO items VALUES (1255, 55, 'item1255');
+INSERT INTO items VALUES (1256, 56, 'item1256');
+INSERT INTO items VALUES (1257, 57, 'item1257');
+INSERT INTO items VALUES (1258, 58, 'item1258');
+INSERT INTO items VALUES (1259, 59, 'item1259');
+INSERT INTO items VALUES (1260, 60, 'item1260');
+INSERT INTO items VALUES (1261, 61, 'item1261');
+INSERT INTO items VALUES (1262, 62, 'item1262');
+INSERT INTO items VALUES (1263, 63, 'item1263');
+INSERT INTO items VALUES (1264, 64, 'item1264');
+INSERT INTO items VALUES (1265, 65, 'item1265');
+INSERT INTO items VALUES (1266, 66, 'item1266');
+INSERT INTO items VALUES (1267, 67, 'item1267');
+INSERT INTO items VALUES (1268, 68, 'item1268');
+INSERT INTO items VALUES (1269, 69, 'item1269');
+INSERT INTO items VALUES (1270, 70, 'item1270');
+INSERT INTO items VALUES (1271, 71, 'item1271');
+INSERT INTO items VALUES (1272, 72, 'item1272');
+INSERT INTO items VALUES (1273, 73, 'item1273');
+INSERT INTO items VALUES (1274, 74, 'item1274');
+INSERT INTO items VALUES (1275, 75, 'item1275');
+INSERT INTO items VALUES (1276, 76, 'item1276');
+INSERT INTO items VALUES (1277, 77, 'item1277');
+INSERT INTO items VALUES (1278, 78, 'item1278');
+INSERT INTO items VALUES (1279, 79, 'item1279');
+INSERT INTO items VALUES (1280, 80, 'item1280');
+INSERT INTO items VALUES (1281, 81, 'item1281');
+INSERT INTO items VALUES (1282, 82, 'item1282');
+INSERT INTO items VALUES (1283, 83, 'item1283');
+INSERT INTO items VALUES (1284, 84, 'item1284');
+INSERT INTO items VALUES (1285, 85, 'item1285');
+INSERT INTO items VALUES (1286, 86, 'item1286');
+INSERT INTO items VALUES (1287, 87, 'item1287');
+INSERT INTO items VALUES (1288, 88, 'item1288');
+INSERT INTO items VALUES (1289, 89, 'item1289');
+INSERT INTO items VALUES (1290, 90, 'item1290');
+INSERT INTO items VALUES (1291, 91, 'item1291');
+INSERT INTO items VALUES (1292, 92, 'item1292');
+INSERT INTO items VALUES (1293, 93, 'item1293');
+INSERT INTO items VALUES (1294, 94, 'item1294');
+INSERT INTO items VALUES (1295, 95, 'item1295');
+INSERT INTO items VALUES (1296, 96, 'item1296');
+INSERT INTO items VALUES (1297, 97, 'item1297');
+INSERT INTO items VALUES (1298, 98, 'item1298');
+INSERT INTO items VALUES (1299, 99, 'item1299');
+INSERT INTO items VALUES (1300, 0, 'item1300');
+INSERT INTO items VALUES (1301, 1, 'item1301');
+INSERT INTO items VALUES (1302, 2, 'item1302');
+INSERT INTO items VALUES (1303, 3, 'item1303');
+INSERT INTO items VALUES (1304, 4, 'item1304');
+INSERT INTO items VALUES (1305, 5, 'item1305');
+INSERT INTO items VALUES (1306, 6, 'item1306');
+INSERT INTO items VALUES (1307, 7, 'item1307');
+INSERT INTO items VALUES (1308, 8, 'item1308');
+INSERT INTO items VALUES (1309, 9, 'item1309');
+INSERT INTO items VALUES (1310, 10, 'item1310');
+INSERT INTO items VALUES (1311, 11, 'item1311');
+INSERT INTO items VALUES (1312, 12, 'item1312');
+INSERT INTO items VALUES (1313, 13, 'item1313');
+INSERT INTO items VALUES (1314, 14, 'item1314');
+INSERT INTO items VALUES (1315, 15, 'item1315');
+INSERT INTO items VALUES (1316, 16, 'item1316');
+INSERT INTO items VALUES (1317, 17, 'item1317');
+INSERT INTO items VALUES (1318, 18, 'item1318');
+INSERT INTO items VALUES (1319, 19, 'item1319');
+INSERT INTO items VALUES (1320, 20, 'item1320');
+INSERT INTO items VALUES (1321, 21, 'item1321');
+INSERT INTO items VALUES (1322, 22, 'item1322');
+INSERT INTO items VALUES (1323, 23, 'item1323');
+INSERT INTO items VALUES (1324, 24, 'item1324');
+INSERT INTO items VALUES (1325, 25, 'item1325');
+INSERT INTO items VALUES (1326, 26, 'item1326');
+INSERT INTO items VALUES (1327, 27, 'item1327');
+INSERT INTO items VALUES (1328, 28, 'item1328');
+INSERT INTO items VALUES (1329, 29, 'item1329');
+INSERT INTO items VALUES (1330, 30, 'item1330');
+INSERT INTO items VALUES (1331, 31, 'item1331');
+INSERT INTO items VALUES (1332, 32, 'item1332');
+INSERT INTO items VALUES (1333, 33, 'item1333');
+INSERT INTO items VALUES (1334, 34, 'item1334');
+INSERT INTO items VALUES (1335, 35, 'item1335');
+INSERT INTO items VALUES (1336, 36, 'item1336');
+INSERT INTO items VALUES (1337, 37, 'item1337');
+INSERT INTO items VALUES (1338, 38, 'item1338');
+INSERT INTO items VALUES (1339, 39, 'item1339');
+INSERT INTO items VALUES (1340, 40, 'item1340');
+INSERT INTO items VALUES (1341, 41, 'item1341');
+INSERT INTO items VALUES (1342, 42, 'item1342');
+INSERT INTO items VALUES (1343, 43, 'item1343');
+INSERT INTO items VALUES (1344, 44, 'item1344');
+INSERT INTO items VALUES (1345, 45, 'item1345');
+INSERT INTO items VALUES (1346, 46, 'item1346');
+INSERT INTO items VALUES (1347, 47, 'item1347');
+INSERT INTO items VALUES (1348, 48, 'item1348');
+INSERT INTO items VALUES (1349, 49, 'item1349');
+INSERT INTO items VALUES (1350, 50, 'item1350');
+INSERT INTO items VALUES (1351, 51, 'item1351');
+INSERT INTO items VALUES (1352, 52, 'item1352');
+INSERT INTO items VALUES (1353, 53, 'item1353');
+INSERT INTO items VALUES (1354, 54, 'item1354');
+INSERT INTO items VALUES (1355, 55, 'item1355');
+INSERT INTO items VALUES (1356, 56, 'item1356');
+INSERT INTO items VALUES (1357, 57, 'item1357');
+INSERT INTO items VALUES (1358, 58, 'item1358');
+INSERT INTO items VALUES (1359, 59, 'item1359');
+INSERT INTO items VALUES (1360, 60, 'item1360');
+INSERT INTO items VALUES (1361, 61, 'item1361');
+INSERT INTO items VALUES (1362, 62, 'item1362');
+INSERT INTO items VALUES (1363, 63, 'item1363');
+INSERT INTO items VALUES (1364, 64, 'item1364');
+INSERT INTO items VALUES (1365, 65, 'item1365');
+INSERT INTO items VALUES (1366, 66, 'item1366');
+INSERT INTO items VALUES (1367, 67, 'item1367');
+INSERT INTO items VALUES (1368, 68, 'item1368');
+INSERT INTO items VALUES (1369, 69, 'item1369');
+INSERT INTO items VALUES (1370, 70, 'item1370');
+INSERT INTO items VALUES (1371, 71, 'item1371');
+INSERT INTO items VALUES (1372, 72, 'item1372');
+INSERT INTO items VALUES (1373, 73, 'item1373');
+INSERT INTO items VALUES (1374, 74, 'item1374');
+INSERT INTO items VALUES (1375, 75, 'item1375');
+INSERT INTO items VALUES (1376, 76, 'item1376');
+INSERT INTO items VALUES (1377, 77, 'item1377');
+INSERT INTO items VALUES (1378, 78, 'item1378');
+INSERT INTO items VALUES (1379, 79, 'item1379');
+INSERT INTO items VALUES (1380, 80, 'item1380');
+INSERT INTO items VALUES (1381, 81, 'item1381');
+INSERT INTO items VALUES (1382, 82, 'item1382');
+INSERT INTO items VALUES (1383, 83, 'item1383');
+INSERT INTO items VALUES (1384, 84, 'item1384');
+INSERT INTO items VALUES (1385, 85, 'item1385');
+INSERT INTO items VALUES (1386, 86, 'item1386');
+INSERT INTO items VALUES (1387, 87, 'item1387');
+INSERT INTO items VALUES (1388, 88, 'item1388');
+INSERT INTO items VALUES (1389, 89, 'item1389');
+INSERT INTO items VALUES (1390, 90, 'item1390');
+INSERT INTO items VALUES (1391, 91, 'item1391');
+INSERT INTO items VALUES (1392, 92, 'item1392');
+INSERT INTO items VALUES (1393, 93, 'item1393');
+INSERT INTO items VALUES (1394, 94, 'item1394');
+INSERT INTO items VALUES (1395, 95, 'item1395');
+INSERT INTO items VALUES (1396, 96, 'item1396');
+INSERT INTO items VALUES (1397, 97, 'item1397');
+INSERT INTO items VALUES (1398, 98, 'item1398');
+INSERT INTO items VALUES (1399, 99, 'item1399');
+INSERT INTO items VALUES (1400, 0, 'item1400');
+INSERT INTO items VALUES (1401, 1, 'item1401');
+INSERT INTO items VALUES (1402, 2, 'item1402');
+INSERT INTO items VALUES (1403, 3, 'item1403');
+INSERT INTO items VALUES (1404, 4, 'item1404');
+INSERT INTO items VALUES (1405, 5, 'item1405');
+INSERT INTO items VALUES (1406, 6, 'item1406');
+INSERT INTO items VALUES (1407, 7, 'item1407');
+INSERT INTO items VALUES (1408, 8, 'item1408');
+INSERT INTO items VALUES (1409, 9, 'item1409');
+INSERT INTO items VALUES (1410, 10, 'item1410');
+INSERT INTO items VALUES (1411, 11, 'item1411');
+INSERT INTO items VALUES (1412, 12, 'item1412');
+INSERT INTO items VALUES (1413, 13, 'item1413');
+INSERT INTO items VALUES (1414, 14, 'item1414');
+INSERT INTO items VALUES (1415, 15, 'item1415');
+INSERT INTO items VALUES (1416, 16, 'item1416');
+INSERT INTO items VALUES (1417, 17, 'item1417');
+INSERT INTO items VALUES (1418, 18, 'item1418');
+INSERT INTO items VALUES (1419, 19, 'item1419');
+INSERT INTO items VALUES (1420, 20, 'item1420');
+INSERT INTO items VALUES (1421, 21, 'item1421');
+INSERT INTO items VALUES (1422, 22, 'item1422');
+INSERT INTO items VALUES (1423, 23, 'item1423');
+INSERT INTO items VALUES (1424, 24, 'item1424');
+INSERT INTO items VALUES (1425, 25, 'item1425');
+INSERT INTO items VALUES (1426, 26, 'item1426');
+INSERT INTO items VALUES (1427, 27, 'item1427');
+INSERT INTO items VALUES (1428, 28, 'item1428');
+INSERT INTO items VALUES (1429, 29, 'item1429');
+INSERT INTO items VALUES (1430, 30, 'item1430');
+INSERT INTO items VALUES (1431, 31, 'item1431');
+INSERT INTO items VALUES (1432, 32, 'item1432');
+INSERT INTO items VALUES (1433, 33, 'item1433');
+INSERT INTO items VALUES (1434, 34, 'item1434');
+INSERT INTO items VALUES (1435, 35, 'item1435');
+INSERT INTO items VALUES (1436, 36, 'item1436');
+INSERT INTO items VALUES (1437, 37, 'item1437');
+INSERT INTO items VALUES (1438, 38, 'item1438');
+INSERT INTO items VALUES (1439, 39, 'item1439');
+INSERT INTO items VALUES (1440, 40, 'item1440');
+INSERT INTO items VALUES (1441, 41, 'item1441');
+INSERT INTO items VALUES (1442, 42, 'item1442');
+INSERT INTO items VALUES (1443, 43, 'item1443');
+INSERT INTO items VALUES (1444, 44, 'item1444');
+INSERT INTO items VALUES (1445, 45, 'item1445');
+INSERT INTO items VALUES (1446, 46, 'item1446');
+INSERT INTO items VALUES (1447, 47, 'item1447');
+INSERT INTO items VALUES (1448, 48, 'item1448');
+INSERT INTO items VALUES (1449, 49, 'item1449');
+INSERT INTO items VALUES (1450, 50, 'item1450');
+INSERT INTO items VALUES (1451, 51, 'item1451');
+INSERT INTO items VALUES (1452, 52, 'item1452');
+INSERT INTO items VALUES (1453, 53, 'item1453');
+INSERT INTO items VALUES (1454, 54, 'item1454');
+INSERT INTO items VALUES (1455, 55, 'item1455');
+INSERT INTO items VALUES (1456, 56, 'item1456');
+INSERT INTO items VALUES (1457, 57, 'item1457');
+INSERT INTO items VALUES (1458, 58, 'item1458');
+INSERT INTO items VALUES (1459, 59, 'item1459');
+INSERT INTO items VALUES (1460, 60, 'item1460');
+INSERT INTO items VALUES (1461, 61, 'item1461');
+INSERT INTO items VALUES (1462, 62, 'item1462');
+INSERT INTO items VALUES (1463, 63, 'item1463');
+INSERT INTO items VALUES (1464, 64, 'item1464');
+INSERT INTO items VALUES (1465, 65, 'item1465');
+INSERT INTO items VALUES (1466, 66, 'item1466');
+INSERT INTO items VALUES (1467, 67, 'item1467');
+INSERT INTO items VALUES (1468, 68, 'item1468');
+INSERT INTO items VALUES (1469, 69, 'item1469');
+INSERT INTO items VALUES (1470, 70, 'item1470');
+INSERT INTO items VALUES (1471, 71, 'item1471');
+INSERT INTO items VALUES (1472, 72, 'item1472');
+INSERT INTO items VALUES (1473, 73, 'item1473');
+INSERT INTO items VALUES (1474, 74, 'item1474');
+INSERT INTO items VALUES (1475, 75, 'item1475');
+INSERT INTO items VALUES (1476, 76, 'item1476');
+INSERT INTO items VALUES (1477, 77, 'item1477');
+INSERT INTO items VALUES (1478, 78, 'item1478');
+INSERT INTO items VALUES (1479, 79, 'item1479');
+INSERT INTO items VALUES (1480, 80, 'item1480');
+INSERT INTO items VALUES (1481, 81, 'item1481');
+INSERT INTO items VALUES (1482, 82, 'item1482');
+INSERT INTO items VALUES (1483, 83, 'item1483');
+INSERT INTO items VALUES (1484, 84, 'item1484');
+INSERT INTO items VALUES (1485, 85, 'item1485');
+INSERT INTO items VALUES (1486, 86, 'item1486');
+INSERT INTO items VALUES (1487, 87, 'item1487');
+INSERT INTO items VALUES (1488, 88, 'item1488');
+INSERT INTO items VALUES (1489, 89, 'item1489');
+INSERT INTO items VALUES (1490, 90, 'item1490');
+INSERT INTO items VALUES (1491, 91, 'item1491');
+INSERT INTO items VALUES (1492, 92, 'item1492');
+INSERT INTO items VALUES (1493, 93, 'item1493');
+INSERT INTO items VALUES (1494, 94, 'item1494');
+INSERT INTO items VALUES (1495, 95, 'item1495');
+INSERT INTO items VALUES (1496, 96, 'item1496');
+INSERT INTO items VALUES (1497, 97, 'item1497');
+INSERT INTO items VALUES (1498, 98, 'item1498');
+INSERT INTO items VALUES (1499, 99, 'item1499');
+INSERT INTO items VALUES (1500, 0, 'item1500');
+INSERT INTO items VALUES (1501, 1, 'item1501');
+INSERT INTO items VALUES (1502, 2, 'item1502');
+INSERT INTO items VALUES (1503, 3, 'item1503');
+INSERT INTO items VALUES (1504, 4, 'item1504');
+INSERT INTO items VALUES (1505, 5, 'item1505');
+INSERT INTO items VALUES (1506, 6, 'item1506');
+INSERT INTO items VALUES (1507, 7, 'item1507');
+INSERT INTO items VALUES (1508, 8, 'item1508');
+INSERT INTO items VALUES (1509, 9, 'item1509');
+INSERT INTO items VALUES (1510, 10, 'item1510');
+INSERT INTO items VALUES (1511, 11, 'item1511');
+INSERT INTO items VALUES (1512, 12, 'item1512');
+INSERT INTO items VALUES (1513, 13, 'item1513');
+INSERT INTO items VALUES (1514, 14, 'item1514');
+INSERT INTO items VALUES (1515, 15, 'item1515');
+INSERT INTO items VALUES (1516, 16, 'item1516');
+INSERT INTO items VALUES (1517, 17, 'item1517');
+INSERT INTO items VALUES (1518, 18, 'item1518');
+INSERT INTO items VALUES (1519, 19, 'item1519');
+INSERT INTO items VALUES (1520, 20, 'item1520');
+INSERT INTO items VALUES (1521, 21, 'item1521');
+INSERT INTO items VALUES (1522, 22, 'item1522');
+INSERT INTO items VALUES (1523, 23, 'item1523');
+INSERT INTO items VALUES (1524, 24, 'item1524');
+INSERT INTO items VALUES (1525, 25, 'item1525');
+INSERT INTO items VALUES (1526, 26, 'item1526');
+INSERT INTO items VALUES (1527, 27, 'item1527');
+INSERT INTO items VALUES (1528, 28, 'item1528');
+INSERT INTO items VALUES (1529, 29, 'item1529');
+INSERT INTO items VALUES (1530, 30, 'item1530');
+INSERT INTO items VALUES (1531, 31, 'item1531');
+INSERT INTO items VALUES (1532, 32, 'item1532');
+INSERT INTO items VALUES (1533, 33, 'item1533');
+INSERT INTO items VALUES (1534, 34, 'item1534');
+INSERT INTO items VALUES (1535, 35, 'item1535');
+INSERT INTO items VALUES (1536, 36, 'item1536');
+INSERT INTO items VALUES (1537, 37, 'item1537');
+INSERT INTO items VALUES (1538, 38, 'item1538');
+INSERT INTO items VALUES (1539, 39, 'item1539');
+INSERT INTO items VALUES (1540, 40, 'item1540');
+INSERT INTO items VALUES (1541, 41, 'item1541');
+INSERT INTO items VALUES (1542, 42, 'item1542');
+INSERT INTO items VALUES (1543, 43, 'item1543');
+INSERT INTO items VALUES (1544, 44, 'item1544');
+INSERT INTO items VALUES (1545, 45, 'item1545');
+INSERT INTO items VALUES (1546, 46, 'item1546');
+INSERT INTO items VALUES (1547, 47, 'item1547');
+INSERT INTO items VALUES (1548, 48, 'item1548');
+INSERT INTO items VALUES (1549, 49, 'item1549');
+INSERT INTO items VALUES (1550, 50, 'item1550');
+INSERT INTO items VALUES (1551, 51, 'item1551');
+INSERT INTO items VALUES (1552, 52, 'item1552');
+INSERT INTO items VALUES (1553, 53, 'item1553');
+INSERT INTO items VALUES (1554, 54, 'item1554');
+INSERT INTO items VALUES (1555, 55, 'item1555');
+INSERT INTO items VALUES (1556, 56, 'item1556');
+INSERT INTO items VALUES (1557, 57, 'item1557');
+INSERT INTO items VALUES (1558, 58, 'item1558');
+INSERT INTO items VALUES (1559, 59, 'item1559');
+INSERT INTO items VALUES (1560, 60, 'item1560');
+INSERT INTO items VALUES (1561, 61, 'item1561');
+INSERT INTO items VALUES (1562, 62, 'item1562');
+INSERT INTO items VALUES (1563, 63, 'item1563');
+INSERT INTO items VALUES (1564, 64, 'item1564');
+INSERT INTO items VALUES (1565, 65, 'item1565');
+INSERT INTO items VALUES (1566, 66, 'item1566');
+INSERT INTO items VALUES (1567, 67, 'item1567');
+INSERT INTO items VALUES (1568, 68, 'item1568');
+INSERT INTO items VALUES (1569, 69, 'item1569');
+INSERT INTO items VALUES (1570, 70, 'item1570');
+INSERT INTO items VALUES (1571, 71, 'item1571');
+INSERT INTO items VALUES (1572, 72, 'item1572');
+INSERT INTO items VALUES (1573, 73, 'item1573');
+INSERT INTO items VALUES (1574, 74, 'item1574');
+INSERT INTO items VALUES (1575, 75, 'item1575');
+INSERT INTO items VALUES (1576, 76, 'item1576');
+INSERT INTO items VALUES (1577, 77, 'item1577');
+INSERT INTO items VALUES (1578, 78, 'item1578');
+INSERT INTO items VALUES (1579, 79, 'item1579');
+INSERT INTO items VALUES (1580, 80, 'item1580');
+INSERT INTO items VALUES (1581, 81, 'item1581');
+INSERT INTO items VALUES (1582, 82, 'item1582');
+INSERT INTO items VALUES (1583, 83, 'item1583');
+INSERT INTO items VALUES (1584, 84, 'item1584');
+INSERT INTO items VALUES (1585, 85, 'item1585');
+INSERT INTO items VALUES (1586, 86, 'item1586');
+INSERT INTO items VALUES (1587, 87, 'item1587');
+INSERT INTO items VALUES (1588, 88, 'item1588');
+INSERT INTO items VALUES (1589, 89, 'item1589');
+INSERT INTO items VALUES (1590, 90, 'item1590');
+INSERT INTO items VALUES (1591, 91, 'item1591');
+INSERT INTO items VALUES (1592, 92, 'item1592');
+INSERT INTO items VALUES (1593, 93, 'item1593');
+INSERT INTO items VALUES (1594, 94, 'item1594');
+INSERT INTO items VALUES (1595, 95, 'item1595');
+INSERT INTO items VALUES (1596, 96, 'item1596');
+INSERT INTO items VALUES (1597, 97, 'item1597');
+INSERT INTO items VALUES (1598, 98, 'item1598');
+INSERT INTO items VALUES (1599, 99, 'item1599');
+INSERT INTO items VALUES (1600, 0, 'item1600');
+INSERT INTO items VALUES (1601, 1, 'item1601');
+INSERT INTO items VALUES (1602, 2, 'item1602');
+INSERT INTO items VALUES (1603, 3, 'item1603');
+INSERT INTO items VALUES (1604, 4, 'item1604');
+INSERT INTO items VALUES (1605, 5, 'item1605');
+INSERT INTO items VALUES (1606, 6, 'item1606');
+INSERT INTO items VALUES (1607, 7, 'item1607');
+INSERT INTO items VALUES (1608, 8, 'item1608');
+INSERT INTO items VALUES (1609, 9, 'item1609');
+INSERT INTO items VALUES (1610, 10, 'item1610');
+INSERT INTO items VALUES (1611, 11, 'item1611');
+INSERT INTO items VALUES (1612, 12, 'item1612');
+INSERT INTO items VALUES (1613, 13, 'item1613');
+INSERT INTO items VALUES (1614, 14, 'item1614');
+INSERT INTO items VALUES (1615, 15, 'item1615');
+INSERT INTO items VALUES (1616, 16, 'item1616');
+INSERT INTO items VALUES (1617, 17, 'item1617');
+INSERT INTO items VALUES (1618, 18, 'item1618');
+INSERT INTO items VALUES (1619, 19, 'item1619');
+INSERT INTO items VALUES (1620, 20, 'item1620');
+INSERT INTO items VALUES (1621, 21, 'item1621');
+INSERT INTO items VALUES (1622, 22, 'item1622');
+INSERT INTO items VALUES (1623, 23, 'item1623');
+INSERT INTO items VALUES (1624, 24, 'item1624');
+INSERT INTO items VALUES (1625, 25, 'item1625');
+INSERT INTO items VALUES (1626, 26, 'item1626');
+INSERT INTO items VALUES (1627, 27, 'item1627');
+INSERT INTO items VALUES (1628, 28, 'item1628');
+INSERT INTO items VALUES (1629, 29, 'item1629');
+INSERT INTO items VALUES (1630, 30, 'item1630');
+INSERT INTO items VALUES (1631, 31, 'item1631');
+INSERT INTO items VALUES (1632, 32, 'item1632');
+INSERT INTO items VALUES (1633, 33, 'item1633');
+INSERT INTO items VALUES (1634, 34, 'item1634');
+INSERT INTO items VALUES (1635, 35, 'item1635');
+INSERT INTO items VALUES (1636, 36, 'item1636');
+INSERT INTO items VALUES (1637, 37, 'item1637');
+INSERT INTO items VALUES (1638, 38, 'item1638');
+INSERT INTO items VALUES (1639, 39, 'item1639');
+INSERT INTO items VALUES (1640, 40, 'item1640');
+INSERT INTO items VALUES (1641, 41, 'item1641');
+INSERT INTO items VALUES (1642, 42, 'item1642');
+INSERT INTO items VALUES (1643, 43, 'item1643');
+INSERT INTO items VALUES (1644, 44, 'item1644');
+INSERT INTO items VALUES (1645, 45, 'item1645');
+INSERT INTO items VALUES (1646, 46, 'item1646');
+INSERT INTO items VALUES (1647, 47, 'item1647');
+INSERT INTO items VALUES (1648, 48, 'item1648');
+INSERT INTO items VALUES (1649, 49, 'item1649');
+INSERT INTO items VALUES (1650, 50, 'item1650');
+INSERT INTO items VALUES (1651, 51, 'item1651');
+INSERT INTO items VALUES (1652, 52, 'item1652');
+INSERT INTO items VALUES (1653, 53, 'item1653');
+INSERT INTO items VALUES (1654, 54, 'item1654');
+INSERT INTO items VALUES (1655, 55, 'item1655');
+INSERT INTO items VALUES (1656, 56, 'item1656');
+INSERT INTO items VALUES (1657, 57, 'item1657');
+INSERT INTO items VALUES (1658, 58, 'item1658');
+INSERT INTO items VALUES (1659, 59, 'item1659');
+INSERT INTO items VALUES (1660, 60, 'item1660');
+INSERT INTO items VALUES (1661, 61, 'item1661');
+INSERT INTO items VALUES (1662, 62, 'item1662');
+INSERT INTO items VALUES (1663, 63, 'item1663');
+INSERT INTO items VALUES (1664, 64, 'item1664');
+INSERT INTO items VALUES (1665, 65, 'item1665');
+INSERT INTO items VALUES (1666, 66, 'item1666');
+INSERT INTO items VALUES (1667, 67, 'item1667');
+INSERT INTO items VALUES (1668, 68, 'item1668');
+INSERT INTO items VALUES (1669, 69, 'item1669');
+INSERT INTO items VALUES (1670, 70, 'item1670');
+INSERT INTO items VALUES (1671, 71, 'item1671');
+INSERT INTO items VALUES (1672, 72, 'item1672');
+INSERT INTO items VALUES (1673, 73, 'item1673');
+INSERT INTO items VALUES (1674, 74, 'item1674');
+INSERT INTO items VALUES (1675, 75, 'item1675');
+INSERT INTO items VALUES (1676, 76, 'item1676');
+INSERT INTO items VALUES (1677, 77, 'item1677');
+INSERT INTO items VALUES (1678, 78, 'item1678');
+INSERT INTO items VALUES (1679, 79, 'item1679');
+INSERT INTO items VALUES (1680, 80, 'item1680');
+INSERT INTO items VALUES (1681, 81, 'item1681');
+INSERT INTO items VALUES (1682, 82, 'item1682');
+INSERT INTO items VALUES (1683, 83, 'item1683');
+INSERT INTO items VALUES (1684, 84, 'item1684');
+INSERT INTO items VALUES (1685, 85, 'item1685');
+INSERT INTO items VALUES (1686, 86, 'item1686');
+INSERT INTO items VALUES (1687, 87, 'item1687');
+INSERT INTO items VALUES (1688, 88, 'item1688');
+INSERT INTO items VALUES (1689, 89, 'item1689');
+INSERT INTO items VALUES (1690, 90, 'item1690');
+INSERT INTO items VALUES (1691, 91, 'item1691');
+INSERT INTO items VALUES (1692, 92, 'item1692');
+INSERT INTO items VALUES (1693, 93, 'item1693');
+INSERT INTO items VALUES (1694, 94, 'item1694');
+INSERT INTO items VALUES (1695, 95, 'item1695');
+INSERT INTO items VALUES (1696, 96, 'item1696');
+INSERT INTO items VALUES (1697, 97, 'item1697');
+INSERT INTO items VALUES (1698, 98, 'item1698');
+INSERT INTO items VALUES (1699, 99, 'item1699');
+INSERT INTO items VALUES (1700, 0, 'item1700');
+INSERT INTO items VALUES (1701, 1, 'item1701');
+INSERT INTO items VALUES (1702, 2, 'item1702');
+INSERT INTO items VALUES (1703, 3, 'item1703');
+INSERT INTO items VALUES (1704, 4, 'item1704');
+INSERT INTO items VALUES (1705, 5, 'item1705');
+INSERT INTO items VALUES (1706, 6, 'item1706');
+INSERT INTO items VALUES (1707, 7, 'item1707');
+INSERT INTO items VALUES (1708, 8, 'item1708');
+INSERT INTO items VALUES (1709, 9, 'item1709');
+INSERT INTO items VALUES (1710, 10, 'item1710');
+INSERT INTO items VALUES (1711, 11, 'item1711');
+INSERT INTO items VALUES (1712, 12, 'item1712');
+INSERT INTO items VALUES (1713, 13, 'item1713');
+INSERT INTO items VALUES (1714, 14, 'item1714');
+INSERT INTO items VALUES (1715, 15, 'item1715');
+INSERT INTO items VALUES (1716, 16, 'item1716');
+INSERT INTO items VALUES (1717, 17, 'item1717');
+INSERT INTO items VALUES (1718, 18, 'item1718');
+INSERT INTO items VALUES (1719, 19, 'item1719');
+INSERT INTO items VALUES (1720, 20, 'item1720');
+INSERT INTO items VALUES (1721, 21, 'item1721');
+INSERT INTO items VALUES (1722, 22, 'item1722');
+INSERT INTO items VALUES (1723, 23, 'item1723');
+INSERT INTO items VALUES (1724, 24, 'item1724');
+INSERT INTO items VALUES (1725, 25, 'item1725');
+INSERT INTO items VALUES (1726, 26, 'item1726');
+INSERT INTO items VALUES (1727, 27, 'item1727');
+INSERT INTO items VALUES (1728, 28, 'item1728');
+INSERT INTO items VALUES (1729, 29, 'item1729');
+INSERT INTO items VALUES (1730, 30, 'item1730');
+INSERT INTO items VALUES (1731, 31, 'item1731');
+INSERT INTO items VALUES (1732, 32, 'item1732');
+INSERT INTO items VALUES (1733, 33, 'item1733');
+INSERT INTO items VALUES (1734, 34, 'item1734');
+INSERT INTO items VALUES (1735, 35, 'item1735');
+INSERT INTO items VALUES (1736, 36, 'item1736');
+INSERT INTO items VALUES (1737, 37, 'item1737');
+INSERT INTO items VALUES (1738, 38, 'item1738');
+INSERT INTO items VALUES (1739, 39, 'item1739');
+INSERT INTO items VALUES (1740, 40, 'item1740');
+INSERT INTO items VALUES (1741, 41, 'item1741');
+INSERT INTO items VALUES (1742, 42, 'item1742');
+INSERT INTO items VALUES (1743, 43, 'item1743');
+INSERT INTO items VALUES (1744, 44, 'item1744');
+INSERT INTO items VALUES (1745, 45, 'item1745');
+INSERT INTO items VALUES (1746, 46, 'item1746');
+INSERT INTO items VALUES (1747, 47, 'item1747');
+INSERT INTO items VALUES (1748, 48, 'item1748');
+INSERT INTO items VALUES (1749, 49, 'item1749');
+INSERT INTO items VALUES (1750, 50, 'item1750');
+INSERT INTO items VALUES (1751, 51, 'item1751');
+INSERT INTO items VALUES (1752, 52, 'item1752');
+INSERT INTO items VALUES (1753, 53, 'item1753');
+INSERT INTO items VALUES (1754, 54, 'item1754');
+INSERT INTO items VALUES (1755, 55, 'item1755');
+INSERT INTO items VALUES (1756, 56, 'item1756');
+INSERT INTO items VALUES (1757, 57, 'item1757');
+INSERT INTO items VALUES (1758, 58, 'item1758');
+INSERT INTO items VALUES (1759, 59, 'item1759');
+INSERT INTO items VALUES (1760, 60, 'item1760');
+INSERT INTO items VALUES (1761, 61, 'item1761');
+INSERT INTO items VALUES (1762, 62, 'item1762');
+INSERT INTO items VALUES (1763, 63, 'item1763');
+INSERT INTO items VALUES (1764, 64, 'item1764');
+INSERT INTO items VALUES (1765, 65, 'item1765');
+INSERT INTO items VALUES (1766, 66, 'item1766');
+INSERT INTO items VALUES (1767, 67, 'item1767');
+INSERT INTO items VALUES (1768, 68, 'item1768');
+INSERT INTO items VALUES (1769, 69, 'item1769');
+INSERT INTO items VALUES (1770, 70, 'item1770');
+INSERT INTO items VALUES (1771, 71, 'item1771');
+INSERT INTO items VALUES (1772, 72, 'item1772');
+INSERT INTO items VALUES (1773, 73, 'item1773');
+INSERT INTO items VALUES (1774, 74, 'item1774');
+INSERT INTO items VALUES (1775, 75, 'item1775');
+INSERT INTO items VALUES (1776, 76, 'item1776');
+INSERT INTO items VALUES (1777, 77, 'item1777');
+INSERT INTO items VALUES (1778, 78, 'item1778');
+INSERT INTO items VALUES (1779, 79, 'item1779');
+INSERT INTO items VALUES (1780, 80, 'item1780');
+INSERT INTO items VALUES (1781, 81, 'item1781');
+INSERT INTO items VALUES (1782, 82, 'item1782');
+INSERT INTO items VALUES (1783, 83, 'item1783');
+INSERT INTO items VALUES (1784, 84, 'item1784');
+INSERT INTO items VALUES (1785, 85, 'item1785');
+INSERT INTO items VALUES (1786, 86, 'item1786');
+INSERT INTO items VALUES (1787, 87, 'item1787');
+INSERT INTO items VALUES (1788, 88, 'item1788');
+INSERT INTO items VALUES (1789, 89, 'item1789');
+INSERT INTO items VALUES (1790, 90, 'item1790');
+INSERT INTO items VALUES (1791, 91, 'item1791');
+INSERT INTO items VALUES (1792, 92, 'item1792');
+INSERT INTO items VALUES (1793, 93, 'item1793');
+INSERT INTO items VALUES (1794, 94, 'item1794');
+INSERT INTO items VALUES (1795, 95, 'item1795');
+INSERT INTO items VALUES (1796, 96, 'item1796');
+INSERT INTO items VALUES (1797, 97, 'item1797');
+INSERT INTO items VALUES (1798, 98, 'item1798');
+INSERT INTO items VALUES (1799, 99, 'item1799');
+INSERT INTO items VALUES (1800, 0, 'item1800');
+INSERT INTO items VALUES (1801, 1, 'item1801');
+INSERT INTO items VALUES (1802, 2, 'item1802');
+INSERT INTO items VALUES (1803, 3, 'item1803');
+INSERT INTO items VALUES (1804, 4, 'item1804');
+INSERT INTO items VALUES (1805, 5, 'item1805');
+INSERT INTO items VALUES (1806, 6, 'item1806');
+INSERT INTO items VALUES (1807, 7, 'item1807');
+INSERT INTO items VALUES (1808, 8, 'item1808');
+INSERT INTO items VALUES (1809, 9, 'item1809');
+INSERT INTO items VALUES (1810, 10, 'item1810');
+INSERT INTO items VALUES (1811, 11, 'item1811');
+INSERT INTO items VALUES (1812, 12, 'item1812');
+INSERT INTO items VALUES (1813, 13, 'item1813');
+INSERT INTO items VALUES (1814, 14, 'item1814');
+INSERT INTO items VALUES (1815, 15, 'item1815');
+INSERT INTO items VALUES (1816, 16, 'item1816');
+INSERT INTO items VALUES (1817, 17, 'item1817');
+INSERT INTO items VALUES (1818, 18, 'item1818');
+INSERT INTO items VALUES (1819, 19, 'item1819');
+INSERT INTO items VALUES (1820, 20, 'item1820');
+INSERT INTO items VALUES (1821, 21, 'item1821');
+INSERT INTO items VALUES (1822, 22, 'item1822');
+INSERT INTO items VALUES (1823, 23, 'item1823');
+INSERT INTO items VALUES (1824, 24, 'item1824');
+INSERT INTO items VALUES (1825, 25, 'item1825');
+INSERT INTO items VALUES (1826, 26, 'item1826');
+INSERT INTO items VALUES (1827, 27, 'item1827');
+INSERT INTO items VALUES (1828, 28, 'item1828');
+INSERT INTO items VALUES (1829, 29, 'item1829');
+INSERT INTO items VALUES (1830, 30, 'item1830');
+INSERT INTO items VALUES (1831, 31, 'item1831');
+INSERT INTO items VALUES (1832, 32, 'item1832');
+INSERT INTO items VALUES (1833, 33, 'item1833');
+INSERT INTO items VALUES (1834, 34, 'item1834');
+INSERT INTO items VALUES (1835, 35, 'item1835');
+INSERT INTO items VALUES (1836, 36, 'item1836');
+INSERT INTO items VALUES (1837, 37, 'item1837');
+INSERT INTO items VALUES (1838, 38, 'item1838');
+INSERT INTO items VALUES (1839, 39, 'item1839');
+INSERT INTO items VALUES (1840, 40, 'item1840');
+INSERT INTO items VALUES (1841, 41, 'item1841');
+INSERT INTO items VALUES (1842, 42, 'item1842');
+INSERT INTO items VALUES (1843, 43, 'item1843');
+INSERT INTO items VALUES (1844, 44, 'item1844');
+INSERT INTO items VALUES (1845, 45, 'item1845');
+INSERT INTO items VALUES (1846, 46, 'item1846');
+INSERT INTO items VALUES (1847, 47, 'item1847');
+INSERT INTO items VALUES (1848, 48, 'item1848');
+INSERT INTO items VALUES (1849, 49, 'item1849');
+INSERT INTO items VALUES (1850, 50, 'item1850');
+INSERT INTO items VALUES (1851, 51, 'item1851');
+INSERT INTO items VALUES (1852, 52, 'item1852');
+INSERT INTO items VALUES (1853, 53, 'item1853');
+INSERT INTO items VALUES (1854, 54, 'item1854');
+INSERT INTO items VALUES (1855, 55, 'item1855');
+INSERT INTO items VALUES (1856, 56, 'item1856');
+INSERT INTO items VALUES (1857, 57, 'item1857');
+INSERT INTO items VALUES (1858, 58, 'item1858');
+INSERT INTO items VALUES (1859, 59, 'item1859');
+INSERT INTO items VALUES (1860, 60, 'item1860');
+INSERT INTO items VALUES (1861, 61, 'item1861');
+INSERT INTO items VALUES (1862, 62, 'item1862');
+INSERT INTO items VALUES (1863, 63, 'item1863');
+INSERT INTO items VALUES (1864, 64, 'item1864');
+INSERT INTO items VALUES (1865, 65, 'item1865');
+INSERT INTO items VALUES (1866, 66, 'item1866');
+INSERT INTO items VALUES (1867, 67, 'item1867');
+INSERT INTO items VALUES (1868, 68, 'item1868');
+INSERT INTO items VALUES (1869, 69, 'item1869');
+INSERT INTO items VALUES (1870, 70, 'item1870');
+INSERT INTO items VALUES (1871, 71, 'item1871');
+INSERT INTO items VALUES (1872, 72, 'item1872');
+INSERT INTO items VALUES (1873, 73, 'item1873');
+INSERT INTO items VALUES (1874, 74, 'item1874');
+INSERT INTO items VALUES (1875, 75, 'item1875');
+INSERT INTO items VALUES (1876, 76, 'item1876');
+INSERT INTO items VALUES (1877, 77, 'item1877');
+INSERT INTO items VALUES (1878, 78, 'item1878');
+INSERT INTO items VALUES (1879, 79, 'item1879');
+INSERT INTO items VALUES (1880, 80, 'item1880');
+INSERT INTO items VALUES (1881, 81, 'item1881');
+INSERT INTO items VALUES (1882, 82, 'item1882');
+INSERT INTO items VALUES (1883, 83, 'item1883');
+INSERT INTO items VALUES (1884, 84, 'item1884');
+INSERT INTO items VALUES (1885, 85, 'item1885');
+INSERT INTO items VALUES (1886, 86, 'item1886');
+INSERT INTO items VALUES (1887, 87, 'item1887');
+INSERT INTO items VALUES (1888, 88, 'item1888');
+INSERT INTO items VALUES (1889, 89, 'item1889');
+INSERT INTO items VALUES (1890, 90, 'item1890');
+INSERT INTO items VALUES (1891, 91, 'item1891');
+INSERT INTO items VALUES (1892, 92, 'item1892');
+INSERT INTO items VALUES (1893, 93, 'item1893');
+INSERT INTO items VALUES (1894, 94, 'item1894');
+INSERT INTO items VALUES (1895, 95, 'item1895');
+INSERT INTO items VALUES (1896, 96, 'item1896');
+INSERT INTO items VALUES (1897, 97, 'item1897');
+INSERT INTO items VALUES (1898, 98, 'item1898');
+INSERT INTO items VALUES (1899, 99, 'item1899');
+INSERT INTO items VALUES (1900, 0, 'item1900');
+INSERT INTO items VALUES (1901, 1, 'item1901');
+INSERT INTO items VALUES (1902, 2, 'item1902');
+INSERT INTO items VALUES (1903, 3, 'item1903');
+INSERT INTO items VALUES (1904, 4, 'item1904');
+INSERT INTO items VALUES (1905, 5, 'item1905');
+INSERT INTO items VALUES (1906, 6, 'item1906');
+INSERT INTO items VALUES (1907, 7, 'item1907');
+INSERT INTO items VALUES (1908, 8, 'item1908');
+INSERT INTO items VALUES (1909, 9, 'item1909');
+INSERT INTO items VALUES (1910, 10, 'item1910');
+INSERT INTO items VALUES (1911, 11, 'item1911');
+INSERT INTO items VALUES (1912, 12, 'item1912');
+INSERT INTO items VALUES (1913, 13, 'item1913');
+INSERT INTO items VALUES (1914, 14, 'item1914');
+INSERT INTO items VALUES (1915, 15, 'item1915');
+INSERT INTO items VALUES (1916, 16, 'item1916');
+INSERT INTO items VALUES (1917, 17, 'item1917');
+INSERT INTO items VALUES (1918, 18, 'item1918');
+INSERT INTO items VALUES (1919, 19, 'item1919');
+INSERT INTO items VALUES (1920, 20, 'item1920');
+INSERT INTO items VALUES (1921, 21, 'item1921');
+INSERT INTO items VALUES (1922, 22, 'item1922');
+INSERT INTO items VALUES (1923, 23, 'item1923');
+INSERT INTO items VALUES (1924, 24, 'item1924');
+INSERT INTO items VALUES (1925, 25, 'item1925');
+INSERT INTO items VALUES (1926, 26, 'item1926');
+INSERT INTO items VALUES (1927, 27, 'item1927');
+INSERT INTO items VALUES (1928, 28, 'item1928');
+INSERT INTO items VALUES (1929, 29, 'item1929');
+INSERT INTO items VALUES (1930, 30, 'item1930');
+INSERT INTO items VALUES (1931, 31, 'item1931');
+INSERT INTO items VALUES (1932, 32, 'item1932');
+INSERT INTO items VALUES (1933, 33, 'item1933');
+INSERT INTO items VALUES (1934, 34, 'item1934');
+INSERT INTO items VALUES (1935, 35, 'item1935');
+INSERT INTO items VALUES (1936, 36, 'item1936');
+INSERT INTO items VALUES (1937, 37, 'item1937');
+INSERT INTO items VALUES (1938, 38, 'item1938');
+INSERT INTO items VALUES (1939, 39, 'item1939');
+INSERT INTO items VALUES (1940, 40, 'item1940');
+INSERT INTO items VALUES (1941, 41, 'item1941');
+INSERT INTO items VALUES (1942, 42, 'item1942');
+INSERT INTO items VALUES (1943, 43, 'item1943');
+INSERT INTO items VALUES (1944, 44, 'item1944');
+INSERT INTO items VALUES (1945, 45, 'item1945');
+INSERT INTO items VALUES (1946, 46, 'item1946');
+INSERT INTO items VALUES (1947, 47, 'item1947');
+INSERT INTO items VALUES (1948, 48, 'item1948');
+INSERT INTO items VALUES (1949, 49, 'item1949');
+INSERT INTO items VALUES (1950, 50, 'item1950');
+INSERT INTO items VALUES (1951, 51, 'item1951');
+INSERT INTO items VALUES (1952, 52, 'item1952');
+INSERT INTO items VALUES (1953, 53, 'item1953');
+INSERT INTO items VALUES (1954, 54, 'item1954');
+INSERT INTO items VALUES (1955, 55, 'item1955');
+INSERT INTO items VALUES (1956, 56, 'item1956');
+INSERT INTO items VALUES (1957, 57, 'item1957');
+INSERT INTO items VALUES (1958, 58, 'item1958');
+INSERT INTO items VALUES (1959, 59, 'item1959');
+INSERT INTO items VALUES (1960, 60, 'item1960');
+INSERT INTO items VALUES (1961, 61, 'item1961');
+INSERT INTO items VALUES (1962, 62, 'item1962');
+INSERT INTO items VALUES (1963, 63, 'item1963');
+INSERT INTO items VALUES (1964, 64, 'item1964');
+INSERT INTO items VALUES (1965, 65, 'item1965');
+INSERT INTO items VALUES (1966, 66, 'item1966');
+INSERT INTO items VALUES (1967, 67, 'item1967');
+INSERT INTO items VALUES (1968, 68, 'item1968');
+INSERT INTO items VALUES (1969, 69, 'item1969');
+INSERT INTO items VALUES (1970, 70, 'item1970');
+INSERT INTO items VALUES (1971, 71, 'item1971');
+INSERT INTO items VALUES (1972, 72, 'item1972');
+INSERT INTO items VALUES (1973, 73, 'item1973');
+INSERT INTO items VALUES (1974, 74, 'item1974');
+INSERT INTO items VALUES (1975, 75, 'item1975');
+INSERT INTO items VALUES (1976, 76, 'item1976');
+INSERT INTO items VALUES (1977, 77, 'item1977');
+INSERT INTO items VALUES (1978, 78, 'item1978');
+INSERT INTO items VALUES (1979, 79, 'item1979');
+INSERT INTO items VALUES (1980, 80, 'item1980');
+INSERT INTO items VALUES (1981, 81, 'item1981');
+INSERT INTO items VALUES (1982, 82, 'item1982');
+INSERT INTO items VALUES (1983, 83, 'item1983');
+INSERT INTO items VALUES (1984, 84, 'item1984');
+INSERT INTO items VALUES (1985, 85, 'item1985');
+INSERT INTO items VALUES (1986, 86, 'item1986');
+INSERT INTO items VALUES (1987, 87, 'item1987');
+INSERT INTO items VALUES (1988, 88, 'item1988');
+INSERT INTO items VALUES (1989, 89, 'item1989');
+INSERT INTO items VALUES (1990, 90, 'item1990');
+INSERT INTO items VALUES (1991, 91, 'item1991');
+INSERT INTO items VALUES (1992, 92, 'item1992');
+INSERT INTO items VALUES (1993, 93, 'item1993');
+INSERT INTO items VALUES (1994, 94, 'item1994');
+INSERT INTO items VALUES (1995, 95, 'item1995');
+INSERT INTO items VALUES (1996, 96, 'item1996');
+INSERT INTO items VALUES (1997, 97, 'item1997');
+INSERT INTO items VALUES (1998, 98, 'item1998');
+INSERT INTO items VALUES (1999, 99, 'item1999');
+INSERT INTO items VALUES (2000, 0, 'item2000');
+INSERT INTO items VALUES (2001, 1, 'item2001');
+INSERT INTO items VALUES (2002, 2, 'item2002');
+INSERT INTO items VALUES (2003, 3, 'item2003');
+INSERT INTO items VALUES (2004, 4, 'item2004');
+INSERT INTO items VALUES (2005, 5, 'item2005');
+INSERT INTO items VALUES (2006, 6, 'item2006');
+INSERT INTO items VALUES (2007, 7, 'item2007');
+INSERT INTO items VALUES (2008, 8, 'item2008');
+INSERT INTO items VALUES (2009, 9, 'item2009');
+INSERT INTO items VALUES (2010, 10, 'item2010');
+INSERT INTO items VALUES (2011, 11, 'item2011');
+INSERT INTO items VALUES (2012, 12, 'item2012');
+INSERT INTO items VALUES (2013, 13, 'item2013');
+INSERT INTO items VALUES (2014, 14, 'item2014');
+INSERT INTO items VALUES (2015, 15, 'item2015');
+INSERT INTO items VALUES (2016, 16, 'item2016');
+INSERT INTO items VALUES (2017, 17, 'item2017');
+INSERT INTO items VALUES (2018, 18, 'item2018');
+INSERT INTO items VALUES (2019, 19, 'item2019');
+INSERT INTO items VALUES (2020, 20, 'item2020');
+INSERT INTO items VALUES (2021, 21, 'item2021');
+INSERT INTO items VALUES (2022, 22, 'item2022');
+INSERT INTO items VALUES (2023, 23, 'item2023');
+INSERT INTO items VALUES (2024, 24, 'item2024');
+INSERT INTO items VALUES (2025, 25, 'item2025');
+INSERT INTO items VALUES (2026, 26, 'item2026');
+INSERT INTO items VALUES (2027, 27, 'item2027');
+INSERT INTO items VALUES (2028, 28, 'item2028');
+INSERT INTO items VALUES (2029, 29, 'item2029');
+INSERT INTO items VALUES (2030, 30, 'item2030');
+INSERT INTO items VALUES (2031, 31, 'item2031');
+INSERT INTO items VALUES (2032, 32, 'item2032');
+INSERT INTO items VALUES (2033, 33, 'item2033');
+INSERT INTO items VALUES (2034, 34, 'item2034');
+INSERT INTO items VALUES (2035, 35, 'item2035');
+INSERT INTO items VALUES (2036, 36, 'item2036');
+INSERT INTO items VALUES (2037, 37, 'item2037');
+INSERT INTO items VALUES (2038, 38, 'item2038');
+INSERT INTO items VALUES (2039, 39, 'item2039');
+INSERT INTO items VALUES (2040, 40, 'item2040');
+INSERT INTO items VALUES (2041, 41, 'item2041');
+INSERT INTO items VALUES (2042, 42, 'item2042');
+INSERT INTO items VALUES (2043, 43, 'item2043');
+INSERT INTO items VALUES (2044, 44, 'item2044');
+INSERT INTO items VALUES (2045, 45, 'item2045');
+INSERT INTO items VALUES (2046, 46, 'item2046');
+INSERT INTO items VALUES (2047, 47, 'item2047');
+INSERT INTO items VALUES (2048, 48, 'item2048');
+INSERT INTO items VALUES (2049, 49, 'item2049');
+INSERT INTO items VALUES (2050, 50, 'item2050');
+INSERT INTO items VALUES (2051, 51, 'item2051');
+INSERT INTO items VALUES (2052, 52, 'item2052');
+INSERT INTO items VALUES (2053, 53, 'item2053');
+INSERT INTO items VALUES (2054, 54, 'item2054');
+INSERT INTO items VALUES (2055, 55, 'item2055');
+INSERT INTO items VALUES (2056, 56, 'item2056');
+INSERT INTO items VALUES (2057, 57, 'item2057');
+INSERT INTO items VALUES (2058, 58, 'item2058');
+INSERT INTO items VALUES (2059, 59, 'item2059');
+INSERT INTO items VALUES (2060, 60, 'item2060');
+INSERT INTO items VALUES (2061, 61, 'item2061');
+INSERT INTO items VALUES (2062, 62, 'item2062');
+INSERT INTO items VALUES (2063, 63, 'item2063');
+INSERT INTO items VALUES (2064, 64, 'item2064');
+INSERT INTO items VALUES (2065, 65, 'item2065');
+INSERT INTO items VALUES (2066, 66, 'item2066');
+INSERT INTO items VALUES (2067, 67, 'item2067');
+INSERT INTO items VALUES (2068, 68, 'item2068');
+INSERT INTO items VALUES (2069, 69, 'item2069');
+INSERT INTO items VALUES (2070, 70, 'item2070');
+INSERT INTO items VALUES (2071, 71, 'item2071');
+INSERT INTO items VALUES (2072, 72, 'item2072');
+INSERT INTO items VALUES (2073, 73, 'item2073');
+INSERT INTO items VALUES (2074, 74, 'item2074');
+INSERT INTO items VALUES (2075, 75, 'item2075');
+INSERT INTO items VALUES (2076, 76, 'item2076');
+INSERT INTO items VALUES (2077, 77, 'item2077');
+INSERT INTO items VALUES (2078, 78, 'item2078');
+INSERT INTO items VALUES (2079, 79, 'item2079');
+INSERT INTO items VALUES (2080, 80, 'item2080');
+INSERT INTO items VALUES (2081, 81, 'item2081');
+INSERT INTO items VALUES (2082, 82, 'item2082');
+INSERT INTO items VALUES (2083, 83, 'item2083');
+INSERT INTO items VALUES (2084, 84, 'item2084');
+INSERT INTO items VALUES (2085, 85, 'item2085');
+INSERT INTO items VALUES (2086, 86, 'item2086');
+INSERT INTO items VALUES (2087, 87, 'item2087');
+INSERT INTO items VALUES (2088, 88, 'item2088');
+INSERT INTO items VALUES (2089, 89, 'item2089');
+INSERT INTO items VALUES (2090, 90, 'item2090');
+INSERT INTO items VALUES (2091, 91, 'item2091');
+INSERT INTO items VALUES (2092, 92, 'item2092');
+INSERT INTO items VALUES (2093, 93, 'item2093');
+INSERT INTO items VALUES (2094, 94, 'item2094');
+INSERT INTO items VALUES (2095, 95, 'item2095');
+INSERT INTO items VALUES (2096, 96, 'item2096');
+INSERT INTO items VALUES (2097, 97, 'item2097');
+INSERT INTO items VALUES (2098, 98, 'item2098');
+INSERT INTO items VALUES (2099, 99, 'item2099');
+INSERT INTO items VALUES (2100, 0, 'item2100');
+INSERT INTO items VALUES (2101, 1, 'item2101');
+INSERT INTO items VALUES (2102, 2, 'item2102');
+INSERT INTO items VALUES (2103, 3, 'item2103');
+INSERT INTO items VALUES (2104, 4, 'item2104');
+INSERT INTO items VALUES (2105, 5, 'item2105');
+INSERT INTO items VALUES (2106, 6, 'item2106');
+INSERT INTO items VALUES (2107, 7, 'item2107');
+INSERT INTO items VALUES (2108, 8, 'item2108');
+INSERT INTO items VALUES (2109, 9, 'item2109');
+INSERT INTO items VALUES (2110, 10, 'item2110');
+INSERT INTO items VALUES (2111, 11, 'item2111');
+INSERT INTO items VALUES (2112, 12, 'item2112');
+INSERT INTO items VALUES (2113, 13, 'item2113');
+INSERT INTO items VALUES (2114, 14, 'item2114');
+INSERT INTO items VALUES (2115, 15, 'item2115');
+INSERT INTO items VALUES (2116, 16, 'item2116');
+INSERT INTO items VALUES (2117, 17, 'item2117');
+INSERT INTO items VALUES (2118, 18, 'item2118');
+INSERT INTO items VALUES (2119, 19, 'item2119');
+INSERT INTO items VALUES (2120, 20, 'item2120');
+INSERT INTO items VALUES (2121, 21, 'item2121');
+INSERT INTO items VALUES (2122, 22, 'item2122');
+INSERT INTO items VALUES (2123, 23, 'item2123');
+INSERT INTO items VALUES (2124, 24, 'item2124');
+INSERT INTO items VALUES (2125, 25, 'item2125');
+INSERT INTO items VALUES (2126, 26, 'item2126');
+INSERT INTO items VALUES (2127, 27, 'item2127');
+INSERT INTO items VALUES (2128, 28, 'item2128');
+INSERT INTO items VALUES (2129, 29, 'item2129');
+INSERT INTO items VALUES (2130, 30, 'item2130');
+INSERT INTO items VALUES (2131, 31, 'item2131');
+INSERT INTO items VALUES (2132, 32, 'item2132');
+INSERT INTO items VALUES (2133, 33, 'item2133');
+INSERT INTO items VALUES (2134, 34, 'item2134');
+INSERT INTO items VALUES (2135, 35, 'item2135');
+INSERT INTO items VALUES (2136, 36, 'item2136');
+INSERT INTO items VALUES (2137, 37, 'item2137');
+INSERT INTO items VALUES (2138, 38, 'item2138');
+INSERT INTO items VALUES (2139, 39, 'item2139');
+INSERT INTO items VALUES (2140, 40, 'item2140');
+INSERT INTO items VALUES (2141, 41, 'item2141');
+INSERT INTO items VALUES (2142, 42, 'item2142');
+INSERT INTO items VALUES (2143, 43, 'item2143');
+INSERT INTO items VALUES (2144, 44, 'item2144');
+INSERT INTO items VALUES (2145, 45, 'item2145');
+INSERT INTO items VALUES (2146, 46, 'item2146');
+INSERT INTO items VALUES (2147, 47, 'item2147');
+INSERT INTO items VALUES (2148, 48, 'item2148');
+INSERT INTO items VALUES (2149, 49, 'item2149');
+INSERT INTO items VALUES (2150, 50, 'item2150');
+INSERT INTO items VALUES (2151, 51, 'item2151');
+INSERT INTO items VALUES (2152, 52, 'item2152');
+INSERT INTO items VALUES (2153, 53, 'item2153');
+INSERT INTO items VALUES (2154, 54, 'item2154');
+INSERT INTO items VALUES (2155, 55, 'item2155');
+INSERT INTO items VALUES (2156, 56, 'item2156');
+INSERT INTO items VALUES (2157, 57, 'item2157');
+INSERT INTO items VALUES (2158, 58, 'item2158');
+INSERT INTO items VALUES (2159, 59, 'item2159');
+INSERT INTO items VALUES (2160, 60, 'item2160');
+INSERT INTO items VALUES (2161, 61, 'item2161');
+INSERT INTO items VALUES (2162, 62, 'item2162');
+INSERT INTO items VALUES (2163, 63, 'item2163');
+INSERT INTO items VALUES (2164, 64, 'item2164');
+INSERT INTO items VALUES (2165, 65, 'item2165');
+INSERT INTO items VALUES (2166, 66, 'item2166');
+INSERT INTO items VALUES (2167, 67, 'item2167');
+INSERT INTO items VALUES (2168, 68, 'item2168');
+INSERT INTO items VALUES (2169, 69, 'item2169');
+INSERT INTO items VALUES (2170, 70, 'item2170');
+INSERT INTO items VALUES (2171, 71, 'item2171');
+INSERT INTO items VALUES (2172, 72, 'item2172');
+INSERT INTO items VALUES (2173, 73, 'item2173');
+INSERT INTO items VALUES (2174, 74, 'item2174');
+INSERT INTO items VALUES (2175, 75, 'item2175');
+INSERT INTO items VALUES (2176, 76, 'item2176');
+INSERT INTO items VALUES (2177, 77, 'item2177');
+INSERT INTO items VALUES (2178, 78, 'item2178');
+INSERT INTO items VALUES (2179, 79, 'item2179');
+INSERT INTO items VALUES (2180, 80, 'item2180');
+INSERT INTO items VALUES (2181, 81, 'item2181');
+INSERT INTO items VALUES (2182, 82, 'item2182');
+INSERT INTO items VALUES (2183, 83, 'item2183');
+INSERT INTO items VALUES (2184, 84, 'item2184');
+INSERT INTO items VALUES (2185, 85, 'item2185');
+INSERT INTO items VALUES (2186, 86, 'item2186');
+INSERT INTO items VALUES (2187, 87, 'item2187');
+INSERT INTO items VALUES (2188, 88, 'item2188');
+INSERT INTO items VALUES (2189, 89, 'item2189');
+INSERT INTO items VALUES (2190, 90, 'item2190');
+INSERT INTO items VALUES (2191, 91, 'item2191');
+INSERT INTO items VALUES (2192, 92, 'item2192');
+INSERT INTO items VALUES (2193, 93, 'item2193');
+INSERT INTO items VALUES (2194, 94, 'item2194');
+INSERT INTO items VALUES (2195, 95, 'item2195');
+INSERT INTO items VALUES (2196, 96, 'item2196');
+INSERT INTO items VALUES (2197, 97, 'item2197');
+INSERT INTO items VALUES (2198, 98, 'item2198');
+INSERT INTO items VALUES (2199, 99, 'item2199');
+INSERT INTO items VALUES (2200, 0, 'item2200');
+INSERT INTO items VALUES (2201, 1, 'item2201');
+INSERT INTO items VALUES (2202, 2, 'item2202');
+INSERT INTO items VALUES (2203, 3, 'item2203');
+INSERT INTO items VALUES (2204, 4, 'item2204');
+INSERT INTO items VALUES (2205, 5, 'item2205');
+INSERT INTO items VALUES (2206, 6, 'item2206');
+INSERT INTO items VALUES (2207, 7, 'item2207');
+INSERT INTO items VALUES (2208, 8, 'item2208');
+INSERT INTO items VALUES (2209, 9, 'item2209');
+INSERT INTO items VALUES (2210, 10, 'item2210');
+INSERT INTO items VALUES (2211, 11, 'item2211');
+INSERT INTO items VALUES (2212, 12, 'item2212');
+INSERT INTO items VALUES (2213, 13, 'item2213');
+INSERT INTO items VALUES (2214, 14, 'item2214');
+INSERT INTO items VALUES (2215, 15, 'item2215');
+INSERT INTO items VALUES (2216, 16, 'item2216');
+INSERT INTO items VALUES (2217, 17, 'item2217');
+INSERT INTO items VALUES (2218, 18, 'item2218');
+INSERT INTO items VALUES (2219, 19, 'item2219');
+INSERT INTO items VALUES (2220, 20, 'item2220');
+INSERT INTO items VALUES (2221, 21, 'item2221');
+INSERT INTO items VALUES (2222, 22, 'item2222');
+INSERT INTO items VALUES (2223, 23, 'item2223');
+INSERT INTO items VALUES (2224, 24, 'item2224');
+INSERT INTO items VALUES (2225, 25, 'item2225');
+INSERT INTO items VALUES (2226, 26, 'item2226');
+INSERT INTO items VALUES (2227, 27, 'item2227');
+INSERT INTO items VALUES (2228, 28, 'item2228');
+INSERT INTO items VALUES (2229, 29, 'item2229');
+INSERT INTO items VALUES (2230, 30, 'item2230');
+INSERT INTO items VALUES (2231, 31, 'item2231');
+INSERT INTO items VALUES (2232, 32, 'item2232');
+INSERT INTO items VALUES (2233, 33, 'item2233');
+INSERT INTO items VALUES (2234, 34, 'item2234');
+INSERT INTO items VALUES (2235, 35, 'item2235');
+INSERT INTO items VALUES (2236, 36, 'item2236');
+INSERT INTO items VALUES (2237, 37, 'item2237');
+INSERT INTO items VALUES (2238, 38, 'item2238');
+INSERT INTO items VALUES (2239, 39, 'item2239');
+INSERT INTO items VALUES (2240, 40, 'item2240');
+INSERT INTO items VALUES (2241, 41, 'item2241');
+INSERT INTO items VALUES (2242, 42, 'item2242');
+INSERT INTO items VALUES (2243, 43, 'item2243');
+INSERT INTO items VALUES (2244, 44, 'item2244');
+INSERT INTO items VALUES (2245, 45, 'item2245');
+INSERT INTO items VALUES (2246, 46, 'item2246');
+INSERT INTO items VALUES (2247, 47, 'item2247');
+INSERT INTO items VALUES (2248, 48, 'item2248');
+INSERT INTO items VALUES (2249, 49, 'item2249');
+INSERT INTO items VALUES (2250, 50, 'item2250');
+INSERT INTO items VALUES (2251, 51, 'item2251');
+INSERT INTO items VALUES (2252, 52, 'item2252');
+INSERT INTO items VALUES (2253, 53, 'item2253');
+INSERT INTO items VALUES (2254, 54, 'item2254');
+INSERT INTO items VALUES (2255, 55, 'item2255');
+INSERT INTO items VALUES (2256, 56, 'item2256');
+INSERT INTO items VALUES (2257, 57, 'item2257');
+INSERT INTO items VALUES (2258, 58, 'item2258');
+INSERT INTO items VALUES (2259, 59, 'item2259');
+INSERT INTO items VALUES (2260, 60, 'item2260');
+INSERT INTO items VALUES (2261, 61, 'item2261');
+INSERT INTO items VALUES (2262, 62, 'item2262');
+INSERT INTO items VALUES (2263, 63, 'item2263');
+INSERT INTO items VALUES (2264, 64, 'item2264');
+INSERT INTO items VALUES (2265, 65, 'item2265');
+INSERT INTO items VALUES (2266, 66, 'item2266');
+INSERT INTO items VALUES (2267, 67, 'item2267');
+INSERT INTO items VALUES (2268, 68, 'item2268');
+INSERT INTO items VALUES (2269, 69, 'item2269');
+INSERT INTO items VALUES (2270, 70, 'item2270');
+INSERT INTO items VALUES (2271, 71, 'item2271');
+INSERT INTO items VALUES (2272, 72, 'item2272');
+INSERT INTO items VALUES (2273, 73, 'item2273');
+INSERT INTO items VALUES (2274, 74, 'item2274');
+INSERT INTO items VALUES (2275, 75, 'item2275');
+INSERT INTO items VALUES (2276, 76, 'item2276');
+INSERT INTO items VALUES (2277, 77, 'item2277');
+INSERT INTO items VALUES (2278, 78, 'item2278');
+INSERT INTO items VALUES (2279, 79, 'item2279');
+INSERT INTO items VALUES (2280, 80, 'item2280');
+INSERT INTO items VALUES (2281, 81, 'item2281');
+INSERT INTO items VALUES (2282, 82, 'item2282');
+INSERT INTO items VALUES (2283, 83, 'item2283');
+INSERT INTO items VALUES (2284, 84, 'item2284');
+INSERT INTO items VALUES (2285, 85, 'item2285');
+INSERT INTO items VALUES (2286, 86, 'item2286');
+INSERT INTO items VALUES (2287, 87, 'item2287');
+INSERT INTO items VALUES (2288, 88, 'item2288');
+INSERT INTO items VALUES (2289, 89, 'item2289');
+INSERT INTO items VALUES (2290, 90, 'item2290');
+INSERT INTO items VALUES (2291, 91, 'item2291');
+INSERT INTO items VALUES (2292, 92, 'item2292');
+INSERT INTO items VALUES (2293, 93, 'item2293');
+INSERT INTO items VALUES (2294, 94, 'item2294');
+INSERT INTO items VALUES (2295, 95, 'item2295');
+INSERT INTO items VALUES (2296, 96, 'item2296');
+INSERT INTO items VALUES (2297, 97, 'item2297');
+INSERT INTO items VALUES (2298, 98, 'item2298');
+INSERT INTO items VALUES (2299, 99, 'item2299');
+INSERT INTO items VALUES (2300, 0, 'item2300');
+INSERT INTO items VALUES (2301, 1, 'item2301');
+INSERT INTO items VALUES (2302, 2, 'item2302');
+INSERT INTO items VALUES (2303, 3, 'item2303');
+INSERT INTO items VALUES (2304, 4, 'item2304');
+INSERT INTO items VALUES (2305, 5, 'item2305');
+INSERT INTO items VALUES (2306, 6, 'item2306');
+INSERT INTO items VALUES (2307, 7, 'item2307');
+INSERT INTO items VALUES (2308, 8, 'item2308');
+INSERT INTO items VALUES (2309, 9, 'item2309');
+INSERT INTO items VALUES (2310, 10, 'item2310');
+INSERT INTO items VALUES (2311, 11, 'item2311');
+INSERT INTO items VALUES (2312, 12, 'item2312');
+INSERT INTO items VALUES (2313, 13, 'item2313');
+INSERT INTO items VALUES (2314, 14, 'item2314');
+INSERT INTO items VALUES (2315, 15, 'item2315');
+INSERT INTO items VALUES (2316, 16, 'item2316');
+INSERT INTO items VALUES (2317, 17, 'item2317');
+INSERT INTO items VALUES (2318, 18, 'item2318');
+INSERT INTO items VALUES (2319, 19, 'item2319');
+INSERT INTO items VALUES (2320, 20, 'item2320');
+INSERT INTO items VALUES (2321, 21, 'item2321');
+INSERT INTO items VALUES (2322, 22, 'item2322');
+INSERT INTO items VALUES (2323, 23, 'item2323');
+INSERT INTO items VALUES (2324, 24, 'item2324');
+INSERT INTO items VALUES (2325, 25, 'item2325');
+INSERT INTO items VALUES (2326, 26, 'item2326');
+INSERT INTO items VALUES (2327, 27, 'item2327');
+INSERT INTO items VALUES (2328, 28, 'item2328');
+INSERT INTO items VALUES (2329, 29, 'item2329');
+INSERT INTO items VALUES (2330, 30, 'item2330');
+INSERT INTO items VALUES (2331, 31, 'item2331');
+INSERT INTO items VALUES (2332, 32, 'item2332');
+INSERT INTO items VALUES (2333, 33, 'item2333');
+INSERT INTO items VALUES (2334, 34, 'item2334');
+INSERT INTO items VALUES (2335, 35, 'item2335');
+INSERT INTO items VALUES (2336, 36, 'item2336');
+INSERT INTO items VALUES (2337, 37, 'item2337');
+INSERT INTO items VALUES (2338, 38, 'item2338');
+INSERT INTO items VALUES (2339, 39, 'item2339');
+INSERT INTO items VALUES (2340, 40, 'item2340');
+INSERT INTO items VALUES (2341, 41, 'item2341');
+INSERT INTO items VALUES (2342, 42, 'item2342');
+INSERT INTO items VALUES (2343, 43, 'item2343');
+INSERT INTO items VALUES (2344, 44, 'item2344');
+INSERT INTO items VALUES (2345, 45, 'item2345');
+INSERT INTO items VALUES (2346, 46, 'item2346');
+INSERT INTO items VALUES (2347, 47, 'item2347');
+INSERT INTO items VALUES (2348, 48, 'item2348');
+INSERT INTO items VALUES (2349, 49, 'item2349');
+INSERT INTO items VALUES (2350, 50, 'item2350');
+INSERT INTO items VALUES (2351, 51, 'item2351');
+INSERT INTO items VALUES (2352, 52, 'item2352');
+INSERT INTO items VALUES (2353, 53, 'item2353');
+INSERT INTO items VALUES (2354, 54, 'item2354');
+INSERT INTO items VALUES (2355, 55, 'item2355');
+INSERT INTO items VALUES (2356, 56, 'item2356');
+INSERT INTO items VALUES (2357, 57, 'item2357');
+INSERT INTO items VALUES (2358, 58, 'item2358');
+INSERT INTO items VALUES (2359, 59, 'item2359');
+INSERT INTO items VALUES (2360, 60, 'item2360');
+INSERT INTO items VALUES (2361, 61, 'item2361');
+INSERT INTO items VALUES (2362, 62, 'item2362');
+INSERT INTO items VALUES (2363, 63, 'item2363');
+INSERT INTO items VALUES (2364, 64, 'item2364');
+INSERT INTO items VALUES (2365, 65, 'item2365');
+INSERT INTO items VALUES (2366, 66, 'item2366');
+INSERT INTO items VALUES (2367, 67, 'item2367');
+INSERT INTO items VALUES (2368, 68, 'item2368');
+INSERT INTO items VALUES (2369, 69, 'item2369');
+INSERT INTO items VALUES (2370, 70, 'item2370');
+INSERT INTO items VALUES (2371, 71, 'item2371');
+INSERT INTO items VALUES (2372, 72, 'item2372');
+INSERT INTO items VALUES (2373, 73, 'item2373');
+INSERT INTO items VALUES (2374, 74, 'item2374');
+INSERT INTO items VALUES (2375, 75, 'item2375');
+INSERT INTO items VALUES (2376, 76, 'item2376');
+INSERT INTO items VALUES (2377, 77, 'item2377');
+INSERT INTO items VALUES (2378, 78, 'item2378');
+INSERT INTO items VALUES (2379, 79, 'item2379');
+INSERT INTO items VALUES (2380, 80, 'item2380');
+INSERT INTO items VALUES (2381, 81, 'item2381');
+INSERT INTO items VALUES (2382, 82, 'item2382');
+INSERT INTO items VALUES (2383, 83, 'item2383');
+INSERT INTO items VALUES (2384, 84, 'item2384');
+INSERT INTO items VALUES (2385, 85, 'item2385');
+INSERT INTO items VALUES (2386, 86, 'item2386');
+INSERT INTO items VALUES (2387, 87, 'item2387');
+INSERT INTO items VALUES (2388, 88, 'item2388');
+INSERT INTO items VALUES (2389, 89, 'item2389');
+INSERT INTO items VALUES (2390, 90, 'item2390');
+INSERT INTO items VALUES (2391, 91, 'item2391');
+INSERT INTO items VALUES (2392, 92, 'item2392');
+INSERT INTO items VALUES (2393, 93, 'item2393');
+INSERT INTO items VALUES (2394, 94, 'item2394');
+INSERT INTO items VALUES (2395, 95, 'item2395');
+INSERT INTO items VALUES (2396, 96, 'item2396');
+INSERT INTO items VALUES (2397, 97, 'item2397');
+INSERT INTO items VALUES (2398, 98, 'item2398');
+INSERT INTO items VALUES (2399, 99, 'item2399');
+INSERT INTO items VALUES (2400, 0, 'item2400');
+INSERT INTO items VALUES (2401, 1, 'item2401');
+INSERT INTO items VALUES (2402, 2, 'item2402');
+INSERT INTO items VALUES (2403, 3, 'item2403');
+INSERT INTO items VALUES (2404, 4, 'item2404');
+INSERT INTO items VALUES (2405, 5, 'item2405');
+INSERT INTO items VALUES (2406, 6, 'item2406');
+INSERT INTO items VALUES (2407, 7, 'item2407');
+INSERT INTO items VALUES (2408, 8, 'item2408');
+INSERT INTO items VALUES (2409, 9, 'item2409');
+INSERT INTO items VALUES (2410, 10, 'item2410');
+INSERT INTO items VALUES (2411, 11, 'item2411');
+INSERT INTO items VALUES (2412, 12, 'item2412');
+INSERT INTO items VALUES (2413, 13, 'item2413');
+INSERT INTO items VALUES (2414, 14, 'item2414');
+INSERT INTO items VALUES (2415, 15, 'item2415');
+INSERT INTO items VALUES (2416, 16, 'item2416');
+INSERT INTO items VALUES (2417, 17, 'item2417');
+INSERT INTO items VALUES (2418, 18, 'item2418');
+INSERT INTO items VALUES (2419, 19, 'item2419');
+INSERT INTO items VALUES (2420, 20, 'item2420');
+INSERT INTO items VALUES (2421, 21, 'item2421');
+INSERT INTO items VALUES (2422, 22, 'item2422');
+INSERT INTO items VALUES (2423, 23, 'item2423');
+INSERT INTO items VALUES (2424, 24, 'item2424');
+INSERT INTO items VALUES (2425, 25, 'item2425');
+INSERT INTO items VALUES (2426, 26, 'item2426');
+INSERT INTO items VALUES (2427, 27, 'item2427');
+INSERT INTO items VALUES (2428, 28, 'item2428');
+INSERT INTO items VALUES (2429, 29, 'item2429');
+INSERT INTO items VALUES (2430, 30, 'item2430');
+INSERT INTO items VALUES (2431, 31, 'item2431');
+INSERT INTO items VALUES (2432, 32, 'item2432');
+INSERT INTO items VALUES (2433, 33, 'item2433');
+INSERT INTO items VALUES (2434, 34, 'item2434');
+INSERT INTO items VALUES (2435, 35, 'item2435');
+INSERT INTO items VALUES (2436, 36, 'item2436');
+INSERT INTO items VALUES (2437, 37, 'item2437');
+INSERT INTO items VALUES (2438, 38, 'item2438');
+INSERT INTO items VALUES (2439, 39, 'item2439');
+INSERT INTO items VALUES (2440, 40, 'item2440');
+INSERT INTO items VALUES (2441, 41, 'item2441');
+INSERT INTO items VALUES (2442, 42, 'item2442');
+INSERT INTO items VALUES (2443, 43, 'item2443');
+INSERT INTO items VALUES (2444, 44, 'item2444');
+INSERT INTO items VALUES (2445, 45, 'item2445');
+INSERT INTO items VALUES (2446, 46, 'item2446');
+INSERT INTO items VALUES (2447, 47, 'item2447');
+INSERT INTO items VALUES (2448, 48, 'item2448');
+INSERT INTO items VALUES (2449, 49, 'item2449');
+INSERT INTO items VALUES (2450, 50, 'item2450');
+INSERT INTO items VALUES (2451, 51, 'item2451');
+INSERT INTO items VALUES (2452, 52, 'item2452');
+INSERT INTO items VALUES (2453, 53, 'item2453');
+INSERT INTO items VALUES (2454, 54, 'item2454');
+INSERT INTO items VALUES (2455, 55, 'item2455');
+INSERT INTO items VALUES (2456, 56, 'item2456');
+INSERT INTO items VALUES (2457, 57, 'item2457');
+INSERT INTO items VALUES (2458, 58, 'item2458');
+INSERT INTO items VALUES (2459, 59, 'item2459');
+INSERT INTO items VALUES (2460, 60, 'item2460');
+INSERT INTO items VALUES (2461, 61, 'item2461');
+INSERT INTO items VALUES (2462, 62, 'item2462');
+INSERT INTO items VALUES (2463, 63, 'item2463');
+INSERT INTO items VALUES (2464, 64, 'item2464');
+INSERT INTO items VALUES (2465, 65, 'item2465');
+INSERT INTO items VALUES (2466, 66, 'item2466');
+INSERT INTO items VALUES (2467, 67, 'item2467');
+INSERT INTO items VALUES (2468, 68, 'item2468');
+INSERT INTO items VALUES (2469, 69, 'item2469');
+INSERT INTO items VALUES (2470, 70, 'item2470');
+INSERT INTO items VALUES (2471, 71, 'item2471');
+INSERT INTO items VALUES (2472, 72, 'item2472');
+INSERT INTO items VALUES (2473, 73, 'item2473');
+INSERT INTO items VALUES (2474, 74, 'item2474');
+INSERT INTO items VALUES (2475, 75, 'item2475');
+INSERT INTO items VALUES (2476, 76, 'item2476');
+INSERT INTO items VALUES (2477, 77, 'item2477');
+INSERT INTO items VALUES (2478, 78, 'item2478');
+INSERT INTO items VALUES (2479, 79, 'item2479');
+INSERT INTO items VALUES (2480, 80, 'item2480');
+INSERT INTO items VALUES (2481, 81, 'item2481');
+INSERT INTO items VALUES (2482, 82, 'item2482');
+INSERT INTO items VALUES (2483, 83, 'item2483');
+INSERT INTO items VALUES (2484, 84, 'item2484');
+INSERT INTO items VALUES (2485, 85, 'item2485');
+INSERT INTO items VALUES (2486, 86, 'item2486');
+INSERT INTO items VALUES (2487, 87, 'item2487');
+INSERT INTO items VALUES (2488, 88, 'item2488');
+INSERT INTO items VALUES (2489, 89, 'item2489');
+INSERT INTO items VALUES (2490, 90, 'item2490');
+INSERT INTO items VALUES (2491, 91, 'item2491');
+INSERT INTO items VALUES (2492, 92, 'item2492');
+INSERT INTO items VALUES (2493, 93, 'item2493');
+INSERT INTO items VALUES (2494, 94, 'item2494');
+INSERT INTO items VALUES (2495, 95, 'item2495');
+INSERT INTO items VALUES (2496, 96, 'item2496');
+INSERT INTO items VALUES (2497, 97, 'item2497');
+INSERT INTO items VALUES (2498, 98, 'item2498');
+INSERT INTO items VALUES (2499, 99, 'item2499');
+INSERT INTO items VALUES (2500, 0, 'item2500');
+INSERT INTO items VALUES (2501, 1, 'item2501');
+INSERT INTO items VALUES (2502, 2, 'item2502');
+INSERT INTO items VALUES (2503, 3, 'item2503');
+INSERT INTO items VALUES (2504, 4, 'item2504');
+INSERT INTO items VALUES (2505, 5, 'item2505');
+INSERT INTO items VALUES (2506, 6, 'item2506');
+INSERT INTO items VALUES (2507, 7, 'item2507');
+INSERT INTO items VALUES (2508, 8, 'item2508');
+INSERT INTO items VALUES (2509, 9, 'item2509');
+INSERT INTO items VALUES (2510, 10, 'item2510');
+INSERT INTO items VALUES (2511, 11, 'item2511');
+INSERT INTO items VALUES (2512, 12, 'item2512');
+INSERT INTO items VALUES (2513, 13, 'item2513');
+INSERT INTO items VALUES (2514, 14, 'item2514');
+INSERT INTO items VALUES (2515, 15, 'item2515');
+INSERT INTO items VALUES (2516, 16, 'item2516');
+INSERT INTO items VALUES (2517, 17, 'item2517');
+INSERT INTO items VALUES (2518, 18, 'item2518');
+INSERT INTO items VALUES (2519, 19, 'item2519');
+INSERT INTO items VALUES (2520, 20, 'item2520');
+INSERT INTO items VALUES (2521, 21, 'item2521');
+INSERT INTO items VALUES (2522, 22, 'item2522');
+INSERT INTO items VALUES (2523, 23, 'item2523');
+INSERT INTO items VALUES (2524, 24, 'item2524');
+INSERT INTO items VALUES (2525, 25, 'item2525');
+INSERT INTO items VALUES (2526, 26, 'item2526');
+INSERT INTO items VALUES (2527, 27, 'item2527');
+INSERT INTO items VALUES (2528, 28, 'item2528');
+INSERT INTO items VALUES (2529, 29, 'item2529');
+INSERT INTO items VALUES (2530, 30, 'item2530');
+INSERT INTO items VALUES (2531, 31, 'item2531');
+INSERT INTO items VALUES (2532, 32, 'item2532');
+INSERT INTO items VALUES (2533, 33, 'item2533');
+INSERT INTO items VALUES (2534, 34, 'item2534');
+INSERT INTO items VALUES (2535, 35, 'item2535');
+INSERT INTO items VALUES (2536, 36, 'item2536');
+INSERT INTO items VALUES (2537, 37, 'item2537');
+INSERT INTO items VALUES (2538, 38, 'item2538');
+INSERT INTO items VALUES (2539, 39, 'item2539');
+INSERT INTO items VALUES (2540, 40, 'item2540');
+INSERT INTO items VALUES (2541, 41, 'item2541');
+INSERT INTO items VALUES (2542, 42, 'item2542');
+INSERT INTO items VALUES (2543, 43, 'item2543');
+INSERT INTO items VALUES (2544, 44, 'item2544');
+INSERT INTO items VALUES (2545, 45, 'item2545');
+INSERT INTO items VALUES (2546, 46, 'item2546');
+INSERT INTO items VALUES (2547, 47, 'item2547');
+INSERT INTO items VALUES (2548, 48, 'item2548');
+INSERT INTO items VALUES (2549, 49, 'item2549');
+INSERT INTO items VALUES (2550, 50, 'item2550');
+INSERT INTO items VALUES (2551, 51, 'item2551');
+INSERT INTO items VALUES (2552, 52, 'item2552');
+INSERT INTO items VALUES (2553, 53, 'item2553');
+INSERT INTO items VALUES (2554, 54, 'item2554');
+INSERT INTO items VALUES (2555, 55, 'item2555');
+INSERT INTO items VALUES (2556, 56, 'item2556');
+INSERT INTO items VALUES (2557, 57, 'item2557');
+INSERT INTO items VALUES (2558, 58, 'item2558');
+INSERT INTO items VALUES (2559, 59, 'item2559');
+INSERT INTO items VALUES (2560, 60, 'item2560');
+INSERT INTO items VALUES (2561, 61, 'item2561');
+INSERT INTO items VALUES (2562, 62, 'item2562');
+INSERT INTO items VALUES (2563, 63, 'item2563');
+INSERT INTO items VALUES (2564, 64, 'item2564');
+INSERT INTO items VALUES (2565, 65, 'item2565');
+INSERT INTO items VALUES (2566, 66, 'item2566');
+INSERT INTO items VALUES (2567, 67, 'item2567');
+INSERT INTO items VALUES (2568, 68, 'item2568');
+INSERT INTO items VALUES (2569, 69, 'item2569');
+INSERT INTO items VALUES (2570, 70, 'item2570');
+INSERT INTO items VALUES (2571, 71, 'item2571');
+INSERT INTO items VALUES (2572, 72, 'item2572');
+INSERT INTO items VALUES (2573, 73, 'item2573');
+INSERT INTO items VALUES (2574, 74, 'item2574');
+INSERT INTO items VALUES (2575, 75, 'item2575');
+INSERT INTO items VALUES (2576, 76, 'item2576');
+INSERT INTO items VALUES (2577, 77, 'item2577');
+INSERT INTO items VALUES (2578, 78, 'item2578');
+INSERT INTO items VALUES (2579, 79, 'item2579');
+INSERT INTO items VALUES (2580, 80, 'item2580');
+INSERT INTO items VALUES (2581, 81, 'item2581');
+INSERT INTO items VALUES (2582, 82, 'item2582');
+INSERT INTO items VALUES (2583, 83, 'item2583');
+INSERT INTO items VALUES (2584, 84, 'item2584');
+INSERT INTO items VALUES (2585, 85, 'item2585');
+INSERT INTO items VALUES (2586, 86, 'item2586');
+INSERT INTO items VALUES (2587, 87, 'item2587');
+INSERT INTO items VALUES (2588, 88, 'item2588');
+INSERT INTO items VALUES (2589, 89, 'item2589');
+INSERT INTO items VALUES (2590, 90, 'item2590');
+INSERT INTO items VALUES (2591, 91, 'item2591');
+INSERT INTO items VALUES (2592, 92, 'item2592');
+INSERT INTO items VALUES (2593, 93, 'item2593');
+INSERT INTO items VALUES (2594, 94, 'item2594');
+INSERT INTO items VALUES (2595, 95, 'item2595');
+INSERT INTO items VALUES (2596, 96, 'item2596');
+INSERT INTO items VALUES (2597, 97, 'item2597');
+INSERT INTO items VALUES (2598, 98, 'item2598');
+INSERT INTO items VALUES (2599, 99, 'item2599');
+INSERT INTO items VALUES (2600, 0, 'item2600');
+INSERT INTO items VALUES (2601, 1, 'item2601');
+INSERT INTO items VALUES (2602, 2, 'item2602');
+INSERT INTO items VALUES (2603, 3, 'item2603');
+INSERT INTO items VALUES (2604, 4, 'item2604');
+INSERT INTO items VALUES (2605, 5, 'item2605');
+INSERT INTO items VALUES (2606, 6, 'item2606');
+INSERT INTO items VALUES (2607, 7, 'item2607');
+INSERT INTO items VALUES (2608, 8, 'item2608');
+INSERT INTO items VALUES (2609, 9, 'item2609');
+INSERT INTO items VALUES (2610, 10, 'item2610');
+INSERT INTO items VALUES (2611, 11, 'item2611');
+INSERT INTO items VALUES (2612, 12, 'item2612');
+INSERT INTO items VALUES (2613, 13, 'item2613');
+INSERT INTO items VALUES (2614, 14, 'item2614');
+INSERT INTO items VALUES (2615, 15, 'item2615');
+INSERT INTO items VALUES (2616, 16, 'item2616');
+INSERT INTO items VALUES (2617, 17, 'item2617');
+INSERT INTO items VALUES (2618, 18, 'item2618');
+INSERT INTO items VALUES (2619, 19, 'item2619');
+INSERT INTO items VALUES (2620, 20, 'item2620');
+INSERT INTO items VALUES (2621, 21, 'item2621');
+INSERT INTO items VALUES (2622, 22, 'item2622');
+INSERT INTO items VALUES (2623, 23, 'item2623');
+INSERT INTO items VALUES (2624, 24, 'item2624');
+INSERT INTO items VALUES (2625, 25, 'item2625');
+INSERT INTO items VALUES (2626, 26, 'item2626');
+INSERT INTO items VALUES (2627, 27, 'item2627');
+INSERT INTO items VALUES (2628, 28, 'item2628');
+INSERT INTO items VALUES (2629, 29, 'item2629');
+INSERT INTO items VALUES (2630, 30, 'item2630');
+INSERT INTO items VALUES (2631, 31, 'item2631');
+INSERT INTO items VALUES (2632, 32, 'item2632');
+INSERT INTO items VALUES (2633, 33, 'item2633');
+INSERT INTO items VALUES (2634, 34, 'item2634');
+INSERT INTO items VALUES (2635, 35, 'item2635');
+INSERT INTO items VALUES (2636, 36, 'item2636');
+INSERT INTO items VALUES (2637, 37, 'item2637');
+INSERT INTO items VALUES (2638, 38, 'item2638');
+INSERT INTO items VALUES (2639, 39, 'item2639');
+INSERT INTO items VALUES (2640, 40, 'item2640');
+INSERT INTO items VALUES (2641, 41, 'item2641');
+INSERT INTO items VALUES (2642, 42, 'item2642');
+INSERT INTO items VALUES (2643, 43, 'item2643');
+INSERT INTO items VALUES (2644, 44, 'item2644');
+INSERT INTO items VALUES (2645, 45, 'item2645');
+INSERT INTO items VALUES (2646, 46, 'item2646');
+INSERT INTO items VALUES (2647, 47, 'item2647');
+INSERT INTO items VALUES (2648, 48, 'item2648');
+INSERT INTO items VALUES (2649, 49, 'item2649');
+INSERT INTO items VALUES (2650, 50, 'item2650');
+INSERT INTO items VALUES (2651, 51, 'item2651');
+INSERT INTO items VALUES (2652, 52, 'item2652');
+INSERT INTO items VALUES (2653, 53, 'item2653');
+INSERT INTO items VALUES (2654, 54, 'item2654');
+INSERT INTO items VALUES (2655, 55, 'item2655');
+INSERT INTO items VALUES (2656, 56, 'item2656');
+INSERT INTO items VALUES (2657, 57, 'item2657');
+INSERT INTO items VALUES (2658, 58, 'item2658');
+INSERT INTO items VALUES (2659, 59, 'item2659');
+INSERT INTO items VALUES (2660, 60, 'item2660');
+INSERT INTO items VALUES (2661, 61, 'item2661');
+INSERT INTO items VALUES (2662, 62, 'item2662');
+INSERT INTO items VALUES (2663, 63, 'item2663');
+INSERT INTO items VALUES (2664, 64, 'item2664');
+INSERT INTO items VALUES (2665, 65, 'item2665');
+INSERT INTO items VALUES (2666, 66, 'item2666');
+INSERT INTO items VALUES (2667, 67, 'item2667');
+INSERT INTO items VALUES (2668, 68, 'item2668');
+INSERT INTO items VALUES (2669, 69, 'item2669');
+INSERT INTO items VALUES (2670, 70, 'item2670');
+INSERT INTO items VALUES (2671, 71, 'item2671');
+INSERT INTO items VALUES (2672, 72, 'item2672');
+INSERT INTO items VALUES (2673, 73, 'item2673');
+INSERT INTO items VALUES (2674, 74, 'item2674');
+INSERT INTO items VALUES (2675, 75, 'item2675');
+INSERT INTO items VALUES (2676, 76, 'item2676');
+INSERT INTO items VALUES (2677, 77, 'item2677');
+INSERT INTO items VALUES (2678, 78, 'item2678');
+INSERT INTO items VALUES (2679, 79, 'item2679');
+INSERT INTO items VALUES (2680, 80, 'item2680');
+INSERT INTO items VALUES (2681, 81, 'item2681');
+INSERT INTO items VALUES (2682, 82, 'item2682');
+INSERT INTO items VALUES (2683, 83, 'item2683');
+INSERT INTO items VALUES (2684, 84, 'item2684');
+INSERT INTO items VALUES (2685, 85, 'item2685');
+INSERT INTO items VALUES (2686, 86, 'item2686');
+INSERT INTO items VALUES (2687, 87, 'item2687');
+INSERT INTO items VALUES (2688, 88, 'item2688');
+INSERT INTO items VALUES (2689, 89, 'item2689');
+INSERT INTO items VALUES (2690, 90, 'item2690');
+INSERT INTO items VALUES (2691, 91, 'item2691');
+INSERT INTO items VALUES (2692, 92, 'item2692');
+INSERT INTO items VALUES (2693, 93, 'item2693');
+INSERT INTO items VALUES (2694, 94, 'item2694');
+INSERT INTO items VALUES (2695, 95, 'item2695');
+INSERT INTO items VALUES (2696, 96, 'item2696');
+INSERT INTO items VALUES (2697, 97, 'item2697');
+INSERT INTO items VALUES (2698, 98, 'item2698');
+INSERT INTO items VALUES (2699, 99, 'item2699');
+INSERT INTO items VALUES (2700, 0, 'item2700');
+INSERT INTO items VALUES (2701, 1, 'item2701');
+INSERT INTO items VALUES (2702, 2, 'item2702');
+INSERT INTO items VALUES (2703, 3, 'item2703');
+INSERT INTO items VALUES (2704, 4, 'item2704');
+INSERT INTO items VALUES (2705, 5, 'item2705');
+INSERT INTO items VALUES (2706, 6, 'item2706');
+INSERT INTO items VALUES (2707, 7, 'item2707');
+INSERT INTO items VALUES (2708, 8, 'item2708');
+INSERT INTO items VALUES (2709, 9, 'item2709');
+INSERT INTO items VALUES (2710, 10, 'item2710');
+INSERT INTO items VALUES (2711, 11, 'item2711');
+INSERT INTO items VALUES (2712, 12, 'item2712');
+INSERT INTO items VALUES (2713, 13, 'item2713');
+INSERT INTO items VALUES (2714, 14, 'item2714');
+INSERT INTO items VALUES (2715, 15, 'item2715');
+INSERT INTO items VALUES (2716, 16, 'item2716');
+INSERT INTO items VALUES (2717, 17, 'item2717');
+INSERT INTO items VALUES (2718, 18, 'item2718');
+INSERT INTO items VALUES (2719, 19, 'item2719');
+INSERT INTO items VALUES (2720, 20, 'item2720');
+INSERT INTO items VALUES (2721, 21, 'item2721');
+INSERT INTO items VALUES (2722, 22, 'item2722');
+INSERT INTO items VALUES (2723, 23, 'item2723');
+INSERT INTO items VALUES (2724, 24, 'item2724');
+INSERT INTO items VALUES (2725, 25, 'item2725');
+INSERT INTO items VALUES (2726, 26, 'item2726');
+INSERT INTO items VALUES (2727, 27, 'item2727');
+INSERT INTO items VALUES (2728, 28, 'item2728');
+INSERT INTO items VALUES (2729, 29, 'item2729');
+INSERT INTO items VALUES (2730, 30, 'item2730');
+INSERT INTO items VALUES (2731, 31, 'item2731');
+INSERT INTO items VALUES (2732, 32, 'item2732');
+INSERT INTO items VALUES (2733, 33, 'item2733');
+INSERT INTO items VALUES (2734, 34, 'item2734');
+INSERT INTO items VALUES (2735, 35, 'item2735');
+INSERT INTO items VALUES (2736, 36, 'item2736');
+INSERT INTO items VALUES (2737, 37, 'item2737');
+INSERT INTO items VALUES (2738, 38, 'item2738');
+INSERT INTO items VALUES (2739, 39, 'item2739');
+INSERT INTO items VALUES (2740, 40, 'item2740');
+INSERT INTO items VALUES (2741, 41, 'item2741');
+INSERT INTO items VALUES (2742, 42, 'item2742');
+INSERT INTO items VALUES (2743, 43, 'item2743');
+INSERT INTO items VALUES (2744, 44, 'item2744');
+INSERT INTO items VALUES (2745, 45, 'item2745');
+INSERT INTO items VALUES (2746, 46, 'item2746');
+INSERT INTO items VALUES (2747, 47, 'item2747');
+INSERT INTO items VALUES (2748, 48, 'item2748');
+INSERT INTO items VALUES (2749, 49, 'item2749');
+INSERT INTO items VALUES (2750, 50, 'item2750');
+INSERT INTO items VALUES (2751, 51, 'item2751');
+INSERT INTO items VALUES (2752, 52, 'item2752');
+INSERT INTO items VALUES (2753, 53, 'item2753');
+INSERT INTO items VALUES (2754, 54, 'item2754');
+INSERT INTO items VALUES (2755, 55, 'item2755');
+INSERT INTO items VALUES (2756, 56, 'item2756');
+INSERT INTO items VALUES (2757, 57, 'item2757');
+INSERT INTO items VALUES (2758, 58, 'item2758');
+INSERT INTO items VALUES (2759, 59, 'item2759');
+INSERT INTO items VALUES (2760, 60, 'item2760');
+INSERT INTO items VALUES (2761, 61, 'item2761');
+INSERT INTO items VALUES (2762, 62, 'item2762');
+INSERT INTO items VALUES (2763, 63, 'item2763');
+INSERT INTO items VALUES (2764, 64, 'item2764');
+INSERT INTO items VALUES (2765, 65, 'item2765');
+INSERT INTO items VALUES (2766, 66, 'item2766');
+INSERT INTO items VALUES (2767, 67, 'item2767');
+INSERT INTO items VALUES (2768, 68, 'item2768');
+INSERT INTO items VALUES (2769, 69, 'item2769');
+INSERT INTO items VALUES (2770, 70, 'item2770');
+INSERT INTO items VALUES (2771, 71, 'item2771');
+INSERT INTO items VALUES (2772, 72, 'item2772');
+INSERT INTO items VALUES (2773, 73, 'item2773');
+INSERT INTO items VALUES (2774, 74, 'item2774');
+INSERT INTO items VALUES (2775, 75, 'item2775');
+INSERT INTO items VALUES (2776, 76, 'item2776');
+INSERT INTO items VALUES (2777, 77, 'item2777');
+INSERT INTO items VALUES (2778, 78, 'item2778');
+INSERT INTO items VALUES (2779, 79, 'item2779');
+INSERT INTO items VALUES (2780, 80, 'item2780');
+INSERT INTO items VALUES (2781, 81, 'item2781');
+INSERT INTO items VALUES (2782, 82, 'item2782');
+INSERT INTO items VALUES (2783, 83, 'item2783');
+INSERT INTO items VALUES (2784, 84, 'item2784');
+INSERT INTO items VALUES (2785, 85, 'item2785');
+INSERT INTO items VALUES (2786, 86, 'item2786');
+INSERT INTO items VALUES (2787, 87, 'item2787');
+INSERT INTO items VALUES (2788, 88, 'item2788');
+INSERT INTO items VALUES (2789, 89, 'item2789');
+INSERT INTO items VALUES (2790, 90, 'item2790');
+INSERT INTO items VALUES (2791, 91, 'item2791');
+INSERT INTO items VALUES (2792, 92, 'item2792');
+INSERT INTO items VALUES (2793, 93, 'item2793');
+INSERT INTO items VALUES (2794, 94, 'item2794');
+INSERT INTO items VALUES (2795, 95, 'item2795');
+INSERT INTO items VALUES (2796, 96, 'item2796');
+INSERT INTO items VALUES (2797, 97, 'item2797');
+INSERT INTO items VALUES (2798, 98, 'item2798');
+INSERT INTO items VALUES (2799, 99, 'item2799');
+INSERT INTO items VALUES (2800, 0, 'item2800');
+INSERT INTO items VALUES (2801, 1, 'item2801');
+INSERT INTO items VALUES (2802, 2, 'item2802');
+INSERT INTO items VALUES (2803, 3, 'item2803');
+INSERT INTO items VALUES (2804, 4, 'item2804');
+INSERT INTO items VALUES (2805, 5, 'item2805');
+INSERT INTO items VALUES (2806, 6, 'item2806');
+INSERT INTO items VALUES (2807, 7, 'item2807');
+INSERT INTO items VALUES (2808, 8, 'item2808');
+INSERT INTO items VALUES (2809, 9, 'item2809');
+INSERT INTO items VALUES (2810, 10, 'item2810');
+INSERT INTO items VALUES (2811, 11, 'item2811');
+INSERT INTO items VALUES (2812, 12, 'item2812');
+INSERT INTO items VALUES (2813, 13, 'item2813');
+INSERT INTO items VALUES (2814, 14, 'item2814');
+INSERT INTO items VALUES (2815, 15, 'item2815');
+INSERT INTO items VALUES (2816, 16, 'item2816');
+INSERT INTO items VALUES (2817, 17, 'item2817');
+INSERT INTO items VALUES (2818, 18, 'item2818');
+INSERT INTO items VALUES (2819, 19, 'item2819');
+INSERT INTO items VALUES (2820, 20, 'item2820');
+INSERT INTO items VALUES (2821, 21, 'item2821');
+INSERT INTO items VALUES (2822, 22, 'item2822');
+INSERT INTO items VALUES (2823, 23, 'item2823');
+INSERT INTO items VALUES (2824, 24, 'item2824');
+INSERT INTO items VALUES (2825, 25, 'item2825');
+INSERT INTO items VALUES (2826, 26, 'item2826');
+INSERT INTO items VALUES (2827, 27, 'item2827');
+INSERT INTO items VALUES (2828, 28, 'item2828');
+INSERT INTO items VALUES (2829, 29, 'item2829');
+INSERT INTO items VALUES (2830, 30, 'item2830');
+INSERT INTO items VALUES (2831, 31, 'item2831');
+INSERT INTO items VALUES (2832, 32, 'item2832');
+INSERT INTO items VALUES (2833, 33, 'item2833');
+INSERT INTO items VALUES (2834, 34, 'item2834');
+INSERT INTO items VALUES (2835, 35, 'item2835');
+INSERT INTO items VALUES (2836, 36, 'item2836');
+INSERT INTO items VALUES (2837, 37, 'item2837');
+INSERT INTO items VALUES (2838, 38, 'item2838');
+INSERT INTO items VALUES (2839, 39, 'item2839');
+INSERT INTO items VALUES (2840, 40, 'item2840');
+INSERT INTO items VALUES (2841, 41, 'item2841');
+INSERT INTO items VALUES (2842, 42, 'item2842');
+INSERT INTO items VALUES (2843, 43, 'item2843');
+INSERT INTO items VALUES (2844, 44, 'item2844');
+INSERT INTO items VALUES (2845, 45, 'item2845');
+INSERT INTO items VALUES (2846, 46, 'item2846');
+INSERT INTO items VALUES (2847, 47, 'item2847');
+INSERT INTO items VALUES (2848, 48, 'item2848');
+INSERT INTO items VALUES (2849, 49, 'item2849');
+INSERT INTO items VALUES (2850, 50, 'item2850');
+INSERT INTO items VALUES (2851, 51, 'item2851');
+INSERT INTO items VALUES (2852, 52, 'item2852');
+INSERT INTO items VALUES (2853, 53, 'item2853');
+INSERT INTO items VALUES (2854, 54, 'item2854');
+INSERT INTO items VALUES (2855, 55, 'item2855');
+INSERT INTO items VALUES (2856, 56, 'item2856');
+INSERT INTO items VALUES (2857, 57, 'item2857');
+INSERT INTO items VALUES (2858, 58, 'item2858');
+INSERT INTO items VALUES (2859, 59, 'item2859');
+INSERT INTO items VALUES (2860, 60, 'item2860');
+INSERT INTO items VALUES (2861, 61, 'item2861');
+INSERT INTO items VALUES (2862, 62, 'item2862');
+INSERT INTO items VALUES (2863, 63, 'item2863');
+INSERT INTO items VALUES (2864, 64, 'item2864');
+INSERT INTO items VALUES (2865, 65, 'item2865');
+INSERT INTO items VALUES (2866, 66, 'item2866');
+INSERT INTO items VALUES (2867, 67, 'item2867');
+INSERT INTO items VALUES (2868, 68, 'item2868');
+INSERT INTO items VALUES (2869, 69, 'item2869');
+INSERT INTO items VALUES (2870, 70, 'item2870');
+INSERT INTO items VALUES (2871, 71, 'item2871');
+INSERT INTO items VALUES (2872, 72, 'item2872');
+INSERT INTO items VALUES (2873, 73, 'item2873');
+INSERT INTO items VALUES (2874, 74, 'item2874');
+INSERT INTO items VALUES (2875, 75, 'item2875');
+INSERT INTO items VALUES (2876, 76, 'item2876');
+INSERT INTO items VALUES (2877, 77, 'item2877');
+INSERT INTO items VALUES (2878, 78, 'item2878');
+INSERT INTO items VALUES (2879, 79, 'item2879');
+INSERT INTO items VALUES (2880, 80, 'item2880');
+INSERT INTO items VALUES (2881, 81, 'item2881');
+INSERT INTO items VALUES (2882, 82, 'item2882');
+INSERT INTO items VALUES (2883, 83, 'item2883');
+INSERT INTO items VALUES (2884, 84, 'item2884');
+INSERT INTO items VALUES (2885, 85, 'item2885');
+INSERT INTO items VALUES (2886, 86, 'item2886');
+INSERT INTO items VALUES (2887, 87, 'item2887');
+INSERT INTO items VALUES (2888, 88, 'item2888');
+INSERT INTO items VALUES (2889, 89, 'item2889');
+INSERT INTO items VALUES (2890, 90, 'item2890');
+INSERT INTO items VALUES (2891, 91, 'item2891');
+INSERT INTO items VALUES (2892, 92, 'item2892');
+INSERT INTO items VALUES (2893, 93, 'item2893');
+INSERT INTO items VALUES (2894, 94, 'item2894');
+INSERT INTO items VALUES (2895, 95, 'item2895');
+INSERT INTO items VALUES (2896, 96, 'item2896');
+INSERT INTO items VALUES (2897, 97, 'item2897');
+INSERT INTO items VALUES (2898, 98, 'item2898');
+INSERT INTO items VALUES (2899, 99, 'item2899');
+INSERT INTO items VALUES (2900, 0, 'item2900');
+INSERT INTO items VALUES (2901, 1, 'item2901');
+INSERT INTO items VALUES (2902, 2, 'item2902');
+INSERT INTO items VALUES (2903, 3, 'item2903');
+INSERT INTO items VALUES (2904, 4, 'item2904');
+INSERT INTO items VALUES (2905, 5, 'item2905');
+INSERT INTO items VALUES (2906, 6, 'item2906');
+INSERT INTO items VALUES (2907, 7, 'item2907');
+INSERT INTO items VALUES (2908, 8, 'item2908');
+INSERT INTO items VALUES (2909, 9, 'item2909');
+INSERT INTO items VALUES (2910, 10, 'item2910');
+INSERT INTO items VALUES (2911, 11, 'item2911');
+INSERT INTO items VALUES (2912, 12, 'item2912');
+INSERT INTO items VALUES (2913, 13, 'item2913');
+INSERT INTO items VALUES (2914, 14, 'item2914');
+INSERT INTO items VALUES (2915, 15, 'item2915');
+INSERT INTO items VALUES (2916, 16, 'item2916');
+INSERT INTO items VALUES (2917, 17, 'item2917');
+INSERT INTO items VALUES (2918, 18, 'item2918');
+INSERT INTO items VALUES (2919, 19, 'item2919');
+INSERT INTO items VALUES (2920, 20, 'item2920');
+INSERT INTO items VALUES (2921, 21, 'item2921');
+INSERT INTO items VALUES (2922, 22, 'item2922');
+INSERT INTO items VALUES (2923, 23, 'item2923');
+INSERT INTO items VALUES (2924, 24, 'item2924');
+INSERT INTO items VALUES (2925, 25, 'item2925');
+INSERT INTO items VALUES (2926, 26, 'item2926');
+INSERT INTO items VALUES (2927, 27, 'item2927');
+INSERT INTO items VALUES (2928, 28, 'item2928');
+INSERT INTO items VALUES (2929, 29, 'item2929');
+INSERT INTO items VALUES (2930, 30, 'item2930');
+INSERT INTO items VALUES (2931, 31, 'item2931');
+INSERT INTO items VALUES (2932, 32, 'item2932');
+INSERT INTO items VALUES (2933, 33, 'item2933');
+INSERT INTO items VALUES (2934, 34, 'item2934');
+INSERT INTO items VALUES (2935, 35, 'item2935');
+INSERT INTO items VALUES (2936, 36, 'item2936');
+INSERT INTO items VALUES (2937, 37, 'item2937');
+INSERT INTO items VALUES (2938, 38, 'item2938');
+INSERT INTO items VALUES (2939, 39, 'item2939');
+INSERT INTO items VALUES (2940, 40, 'item2940');
+INSERT INTO items VALUES (2941, 41, 'item2941');
+INSERT INTO items VALUES (2942, 42, 'item2942');
+INSERT INTO items VALUES (2943, 43, 'item2943');
+INSERT INTO items VALUES (2944, 44, 'item2944');
+INSERT INTO items VALUES (2945, 45, 'item2945');
+INSERT INTO items VALUES (2946, 46, 'item2946');
+INSERT INTO items VALUES (2947, 47, 'item2947');
+INSERT INTO items VALUES (2948, 48, 'item2948');
+INSERT INTO items VALUES (2949, 49, 'item2949');
+INSERT INTO items VALUES (2950, 50, 'item2950');
+INSERT INTO items VALUES (2951, 51, 'item2951');
+INSERT INTO items VALUES (2952, 52, 'item2952');
+INSERT INTO items VALUES (2953, 53, 'item2953');
+INSERT INTO items VALUES (2954, 54, 'item2954');
+INSERT INTO items VALUES (2955, 55, 'item2955');
+INSERT INTO items VALUES (2956, 56, 'item2956');
+INSERT INTO items VALUES (2957, 57, 'item2957');
+INSERT INTO items VALUES (2958, 58, 'item2958');
+INSERT INTO items VALUES (2959, 59, 'item2959');
+INSERT INTO items VALUES (2960, 60, 'item2960');
+INSERT INTO items VALUES (2961, 61, 'item2961');
+INSERT INTO items VALUES (2962, 62, 'item2962');
+INSERT INTO items VALUES (2963, 63, 'item2963');
+INSERT INTO items VALUES (2964, 64, 'item2964');
+INSERT INTO items VALUES (2965, 65, 'item2965');
+INSERT INTO items VALUES (2966, 66, 'item2966');
+INSERT INTO items VALUES (2967, 67, 'item2967');
+INSERT INTO items VALUES (2968, 68, 'item2968');
+INSERT INTO items VALUES (2969, 69, 'item2969');
+INSERT INTO items VALUES (2970, 70, 'item2970');
+INSERT INTO items VALUES (2971, 71, 'item2971');
+INSERT INTO items VALUES (2972, 72, 'item2972');
+INSERT INTO items VALUES (2973, 73, 'item2973');
+INSERT INTO items VALUES (2974, 74, 'item2974');
+INSERT INTO items VALUES (2975, 75, 'item2975');
+INSERT INTO items VALUES (2976, 76, 'item2976');
+INSERT INTO items VALUES (2977, 77, 'item2977');
+INSERT INTO items VALUES (2978, 78, 'item2978');
+INSERT INTO items VALUES (2979, 79, 'item2979');
+INSERT INTO items VALUES (2980, 80, 'item2980');
+INSERT INTO items VALUES (2981, 81, 'item2981');
+INSERT INTO items VALUES (2982, 82, 'item2982');
+INSERT INTO items VALUES (2983, 83, 'item2983');
+INSERT INTO items VALUES (2984, 84, 'item2984');
+INSERT INTO items VALUES (2985, 85, 'item2985');
+INSERT INTO items VALUES (2986, 86, 'item2986');
+INSERT INTO items VALUES (2987, 87, 'item2987');
+INSERT INTO items VALUES (2988, 88, 'item2988');
+INSERT INTO items VALUES (2989, 89, 'item2989');
+INSERT INTO items VALUES (2990, 90, 'item2990');
+INSERT INTO items VALUES (2991, 91, 'item2991');
+INSERT INTO items VALUES (2992, 92, 'item2992');
+INSERT INTO items VALUES (2993, 93, 'item2993');
+INSERT INTO items VALUES (2994, 94, 'item2994');
+INSERT INTO items VALUES (2995, 95, 'item2995');
+INSERT INTO items VALUES (2996, 96, 'item2996');
+INSERT INTO items VALUES (2997, 97, 'item2997');
+INSERT INTO items VALUES (2998, 98, 'item2998');
+INSERT INTO items VALUES (2999, 99, 'item2999');
+INSERT INTO items VALUES (3000, 0, 'item3000');
+INSERT INTO items VALUES (3001, 1, 'item3001');
+INSERT INTO items VALUES (3002, 2, 'item3002');
+INSERT INTO items VALUES (3003, 3, 'item3003');
+INSERT INTO items VALUES (3004, 4, 'item3004');
+INSERT INTO items VALUES (3005, 5, 'item3005');
+INSERT INTO items VALUES (3006, 6, 'item3006');
+INSERT INTO items VALUES (3007, 7, 'item3007');
+INSERT INTO items VALUES (3008, 8, 'item3008');
+INSERT INTO items VALUES (3009, 9, 'item3009');
+INSERT INTO items VALUES (3010, 10, 'item3010');
+INSERT INTO items VALUES (3011, 11, 'item3011');
+INSERT INTO items VALUES (3012, 12, 'item3012');
+INSERT INTO items VALUES (3013, 13, 'item3013');
+INSERT INTO items VALUES (3014, 14, 'item3014');
+INSERT INTO items VALUES (3015, 15, 'item3015');
+INSERT INTO items VALUES (3016, 16, 'item3016');
+INSERT INTO items VALUES (3017, 17, 'item3017');
+INSERT INTO items VALUES (3018, 18, 'item3018');
+INSERT INTO items VALUES (3019, 19, 'item3019');
+INSERT INTO items VALUES (3020, 20, 'item3020');
+INSERT INTO items VALUES (3021, 21, 'item3021');
+INSERT INTO items VALUES (3022, 22, 'item3022');
+INSERT INTO items VALUES (3023, 23, 'item3023');
+INSERT INTO items VALUES (3024, 24, 'item3024');
+INSERT INTO items VALUES (3025, 25, 'item3025');
+INSERT INTO items VALUES (3026, 26, 'item3026');
+INSERT INTO items VALUES (3027, 27, 'item3027');
+INSERT INTO items VALUES (3028, 28, 'item3028');
+INSERT INTO items VALUES (3029, 29, 'item3029');
+INSERT INTO items VALUES (3030, 30, 'item3030');
+INSERT INTO items VALUES (3031, 31, 'item3031');
+INSERT INTO items VALUES (3032, 32, 'item3032');
+INSERT INTO items VALUES (3033, 33, 'item3033');
+INSERT INTO items VALUES (3034, 34, 'item3034');
+INSERT INTO items VALUES (3035, 35, 'item3035');
+INSERT INTO items VALUES (3036, 36, 'item3036');
+INSERT INTO items VALUES (3037, 37, 'item3037');
+INSERT INTO items VALUES (3038, 38, 'item3038');
+INSERT INTO items VALUES (3039, 39, 'item3039');
+INSERT INTO items VALUES (3040, 40, 'item3040');
+INSERT INTO items VALUES (3041, 41, 'item3041');
+INSERT INTO items VALUES (3042, 42, 'item3042');
+INSERT INTO items VALUES (3043, 43, 'item3043');
+INSERT INTO items VALUES (3044, 44, 'item3044');
+INSERT INTO items VALUES (3045, 45, 'item3045');
+INSERT INTO items VALUES (3046, 46, 'item3046');
+INSERT INTO items VALUES (3047, 47, 'item3047');
+INSERT INTO items VALUES (3048, 48, 'item3048');
+INSERT INTO items VALUES (3049, 49, 'item3049');
+INSERT INTO items VALUES (3050, 50, 'item3050');
+INSERT INTO items VALUES (3051, 51, 'item3051');
+INSERT INTO items VALUES (3052, 52, 'item3052');
+INSERT INTO items VALUES (3053, 53, 'item3053');
+INSERT INTO items VALUES (3054, 54, 'item3054');
+INSERT INTO items VALUES (3055, 55, 'item3055');
+INSERT INTO items VALUES (3056, 56, 'item3056');
+INSERT INTO items VALUES (3057, 57, 'item3057');
+INSERT INTO items VALUES (3058, 58, 'item3058');
+INSERT INTO items VALUES (3059, 59, 'item3059');
+INSERT INTO items VALUES (3060, 60, 'item3060');
+INSERT INTO items VALUES (3061, 61, 'item3061');
+INSERT INTO items VALUES (3062, 62, 'item3062');
+INSERT INTO items VALUES (3063, 63, 'item3063');
+INSERT INTO items VALUES (3064, 64, 'item3064');
+INSERT INTO items VALUES (3065, 65, 'item3065');
+INSERT INTO items VALUES (3066, 66, 'item3066');
+INSERT INTO items VALUES (3067, 67, 'item3067');
+INSERT INTO items VALUES (3068, 68, 'item3068');
+INSERT INTO items VALUES (3069, 69, 'item3069');
+INSERT INTO items VALUES (3070, 70, 'item3070');
+INSERT INTO items VALUES (3071, 71, 'item3071');
+INSERT INTO items VALUES (3072, 72, 'item3072');
+INSERT INTO items VALUES (3073, 73, 'item3073');
+INSERT INTO items VALUES (3074, 74, 'item3074');
+INSERT INTO items VALUES (3075, 75, 'item3075');
+INSERT INTO items VALUES (3076, 76, 'item3076');
+INSERT INTO items VALUES (3077, 77, 'item3077');
+INSERT INTO items VALUES (3078, 78, 'item3078');
+INSERT INTO items VALUES (3079, 79, 'item3079');
+INSERT INTO items VALUES (3080, 80, 'item3080');
+INSERT INTO items VALUES (3081, 81, 'item3081');
+INSERT INTO items VALUES (3082, 82, 'item3082');
+INSERT INTO items VALUES (3083, 83, 'item3083');
+INSERT INTO items VALUES (3084, 84, 'item3084');
+INSERT INTO items VALUES (3085, 85, 'item3085');
+INSERT INTO items VALUES (3086, 86, 'item3086');
+INSERT INTO items VALUES (3087, 87, 'item3087');
+INSERT INTO items VALUES (3088, 88, 'item3088');
+INSERT INTO items VALUES (3089, 89, 'item3089');
+INSERT INTO items VALUES (3090, 90, 'item3090');
+INSERT INTO items VALUES (3091, 91, 'item3091');
+INSERT INTO items VALUES (3092, 92, 'item3092');
+INSERT INTO items VALUES (3093, 93, 'item3093');
+INSERT INTO items VALUES (3094, 94, 'item3094');
+INSERT INTO items VALUES (3095, 95, 'item3095');
+INSERT INTO items VALUES (3096, 96, 'item3096');
+INSERT INTO items VALUES (3097, 97, 'item3097');
+INSERT INTO items VALUES (3098, 98, 'item3098');
+INSERT INTO items VALUES (3099, 99, 'item3099');
+INSERT INTO items VALUES (3100, 0, 'item3100');
+INSERT INTO items VALUES (3101, 1, 'item3101');
+INSERT INTO items VALUES (3102, 2, 'item3102');
+INSERT INTO items VALUES (3103, 3, 'item3103');
+INSERT INTO items VALUES (3104, 4, 'item3104');
+INSERT INTO items VALUES (3105, 5, 'item3105');
+INSERT INTO items VALUES (3106, 6, 'item3106');
+INSERT INTO items VALUES (3107, 7, 'item3107');
+INSERT INTO items VALUES (3108, 8, 'item3108');
+INSERT INTO items VALUES (3109, 9, 'item3109');
+INSERT INTO items VALUES (3110, 10, 'item3110');
+INSERT INTO items VALUES (3111, 11, 'item3111');
+INSERT INTO items VALUES (3112, 12, 'item3112');
+INSERT INTO items VALUES (3113, 13, 'item3113');
+INSERT INTO items VALUES (3114, 14, 'item3114');
+INSERT INTO items VALUES (3115, 15, 'item3115');
+INSERT INTO items VALUES (3116, 16, 'item3116');
+INSERT INTO items VALUES (3117, 17, 'item3117');
+INSERT INTO items VALUES (3118, 18, 'item3118');
+INSERT INTO items VALUES (3119, 19, 'item3119');
+INSERT INTO items VALUES (3120, 20, 'item3120');
+INSERT INTO items VALUES (3121, 21, 'item3121');
+INSERT INTO items VALUES (3122, 22, 'item3122');
+INSERT INTO items VALUES (3123, 23, 'item3123');
+INSERT INTO items VALUES (3124, 24, 'item3124');
+INSERT INTO items VALUES (3125, 25, 'item3125');
+INSERT INTO items VALUES (3126, 26, 'item3126');
+INSERT INTO items VALUES (3127, 27, 'item3127');
+INSERT INTO items VALUES (3128, 28, 'item3128');
+INSERT INTO items VALUES (3129, 29, 'item3129');
+INSERT INTO items VALUES (3130, 30, 'item3130');
+INSERT INTO items VALUES (3131, 31, 'item3131');
+INSERT INTO items VALUES (3132, 32, 'item3132');
+INSERT INTO items VALUES (3133, 33, 'item3133');
+INSERT INTO items VALUES (3134, 34, 'item3134');
+INSERT INTO items VALUES (3135, 35, 'item3135');
+INSERT INTO items VALUES (3136, 36, 'item3136');
+INSERT INTO items VALUES (3137, 37, 'item3137');
+INSERT INTO items VALUES (3138, 38, 'item3138');
+INSERT INTO items VALUES (3139, 39, 'item3139');
+INSERT INTO items VALUES (3140, 40, 'item3140');
+INSERT INTO items VALUES (3141, 41, 'item3141');
+INSERT INTO items VALUES (3142, 42, 'item3142');
+INSERT INTO items VALUES (3143, 43, 'item3143');
+INSERT INTO items VALUES (3144, 44, 'item3144');
+INSERT INTO items VALUES (3145, 45, 'item3145');
+INSERT INTO items VALUES (3146, 46, 'item3146');
+INSERT INTO items VALUES (3147, 47, 'item3147');
+INSERT INTO items VALUES (3148, 48, 'item3148');
+INSERT INTO items VALUES (3149, 49, 'item3149');
+INSERT INTO items VALUES (3150, 50, 'item3150');
+INSERT INTO items VALUES (3151, 51, 'item3151');
+INSERT INTO items VALUES (3152, 52, 'item3152');
+INSERT INTO items VALUES (3153, 53, 'item3153');
+INSERT INTO items VALUES (3154, 54, 'item3154');
+INSERT INTO items VALUES (3155, 55, 'item3155');
+INSERT INTO items VALUES (3156, 56, 'item3156');
+INSERT INTO items VALUES (3157, 57, 'item3157');
+INSERT INTO items VALUES (3158, 58, 'item3158');
+INSERT INTO items VALUES (3159, 59, 'item3159');
+INSERT INTO items VALUES (3160, 60, 'item3160');
+INSERT INTO items VALUES (3161, 61, 'item3161');
+INSERT INTO items VALUES (3162, 62, 'item3162');
+INSERT INTO items VALUES (3163, 63, 'item3163');
+INSERT INTO items VALUES (3164, 64, 'item3164');
+INSERT INTO items VALUES (3165, 65, 'item3165');
+INSERT INTO items VALUES (3166, 66, 'item3166');
+INSERT INTO items VALUES (3167, 67, 'item3167');
+INSERT INTO items VALUES (3168, 68, 'item3168');
+INSERT INTO items VALUES (3169, 69, 'item3169');
+INSERT INTO items VALUES (3170, 70, 'item3170');
+INSERT INTO items VALUES (3171, 71, 'item3171');
+INSERT INTO items VALUES (3172, 72, 'item3172');
+INSERT INTO items VALUES (3173, 73, 'item3173');
+INSERT INTO items VALUES (3174, 74, 'item3174');
+INSERT INTO items VALUES (3175, 75, 'item3175');
+INSERT INTO items VALUES (3176, 76, 'item3176');
+INSERT INTO items VALUES (3177, 77, 'item3177');
+INSERT INTO items VALUES (3178, 78, 'item3178');
+INSERT INTO items VALUES (3179, 79, 'item3179');
+INSERT INTO items VALUES (3180, 80, 'item3180');
+INSERT INTO items VALUES (3181, 81, 'item3181');
+INSERT INTO items VALUES (3182, 82, 'item3182');
+INSERT INTO items VALUES (3183, 83, 'item3183');
+INSERT INTO items VALUES (3184, 84, 'item3184');
+INSERT INTO items VALUES (3185, 85, 'item3185');
+INSERT INTO items VALUES (3186, 86, 'item3186');
+INSERT INTO items VALUES (3187, 87, 'item3187');
+INSERT INTO items VALUES (3188, 88, 'item3188');
+INSERT INTO items VALUES (3189, 89, 'item3189');
+INSERT INTO items VALUES (3190, 90, 'item3190');
+INSERT INTO items VALUES (3191, 91, 'item3191');
+INSERT INTO items VALUES (3192, 92, 'item3192');
+INSERT INTO items VALUES (3193, 93, 'item3193');
+INSERT INTO items VALUES (3194, 94, 'item3194');
+INSERT INTO items VALUES (3195, 95, 'item3195');
+INSERT INTO items VALUES (3196, 96, 'item3196');
+INSERT INTO items VALUES (3197, 97, 'item3197');
+INSERT INTO items VALUES (3198, 98, 'item3198');
+INSERT INTO items VALUES (3199, 99, 'item3199');
+INSERT INTO items VALUES (3200, 0, 'item3200');
+INSERT INTO items VALUES (3201, 1, 'item3201');
+INSERT INTO items VALUES (3202, 2, 'item3202');
+INSERT INTO items VALUES (3203, 3, 'item3203');
+INSERT INTO items VALUES (3204, 4, 'item3204');
+INSERT INTO items VALUES (3205, 5, 'item3205');
+INSERT INTO items VALUES (3206, 6, 'item3206');
+INSERT INTO items VALUES (3207, 7, 'item3207');
+INSERT INTO items VALUES (3208, 8, 'item3208');
+INSERT INTO items VALUES (3209, 9, 'item3209');
+INSERT INTO items VALUES (3210, 10, 'item3210');
+INSERT INTO items VALUES (3211, 11, 'item3211');
+INSERT INTO items VALUES (3212, 12, 'item3212');
+INSERT INTO items VALUES (3213, 13, 'item3213');
+INSERT INTO items VALUES (3214, 14, 'item3214');
+INSERT INTO items VALUES (3215, 15, 'item3215');
+INSERT INTO items VALUES (3216, 16, 'item3216');
+INSERT INTO items VALUES (3217, 17, 'item3217');
+INSERT INTO items VALUES (3218, 18, 'item3218');
+INSERT INTO items VALUES (3219, 19, 'item3219');
+INSERT INTO items VALUES (3220, 20, 'item3220');
+INSERT INTO items VALUES (3221, 21, 'item3221');
+INSERT INTO items VALUES (3222, 22, 'item3222');
+INSERT INTO items VALUES (3223, 23, 'item3223');
+INSERT INTO items VALUES (3224, 24, 'item3224');
+INSERT INTO items VALUES (3225, 25, 'item3225');
+INSERT INTO items VALUES (3226, 26, 'item3226');
+INSERT INTO items VALUES (3227, 27, 'item3227');
+INSERT INTO items VALUES (3228, 28, 'item3228');
+INSERT INTO items VALUES (3229, 29, 'item3229');
+INSERT INTO items VALUES (3230, 30, 'item3230');
+INSERT INTO items VALUES (3231, 31, 'item3231');
+INSERT INTO items VALUES (3232, 32, 'item3232');
+INSERT INTO items VALUES (3233, 33, 'item3233');
+INSERT INTO items VALUES (3234, 34, 'item3234');
+INSERT INTO items VALUES (3235, 35, 'item3235');
+INSERT INTO items VALUES (3236, 36, 'item3236');
+INSERT INTO items VALUES (3237, 37, 'item3237');
+INSERT INTO items VALUES (3238, 38, 'item3238');
+INSERT INTO items VALUES (3239, 39, 'item3239');
+INSERT INTO items VALUES (3240, 40, 'item3240');
+INSERT INTO items VALUES (3241, 41, 'item3241');
+INSERT INTO items VALUES (3242, 42, 'item3242');
+INSERT INTO items VALUES (3243, 43, 'item3243');
+INSERT INTO items VALUES (3244, 44, 'item3244');
+INSERT INTO items VALUES (3245, 45, 'item3245');
+INSERT INTO items VALUES (3246, 46, 'item3246');
+INSERT INTO items VALUES (3247, 47, 'item3247');
+INSERT INTO items VALUES (3248, 48, 'item3248');
+INSERT INTO items VALUES (3249, 49, 'item3249');
+INSERT INTO items VALUES (3250, 50, 'item3250');
+INSERT INTO items VALUES (3251, 51, 'item3251');
+INSERT INTO items VALUES (3252, 52, 'item3252');
+INSERT INTO items VALUES (3253, 53, 'item3253');
+INSERT INTO items VALUES (3254, 54, 'item3254');
+INSERT INTO items VALUES (3255, 55, 'item3255');
+INSERT INTO items VALUES (3256, 56, 'item3256');
+INSERT INTO items VALUES (3257, 57, 'item3257');
+INSERT INTO items VALUES (3258, 58, 'item3258');
+INSERT INTO items VALUES (3259, 59, 'item3259');
+INSERT INTO items VALUES (3260, 60, 'item3260');
+INSERT INTO items VALUES (3261, 61, 'item3261');
+INSERT INTO items VALUES (3262, 62, 'item3262');
+INSERT INTO items VALUES (3263, 63, 'item3263');
+INSERT INTO items VALUES (3264, 64, 'item3264');
+INSERT INTO items VALUES (3265, 65, 'item3265');
+INSERT INTO items VALUES (3266, 66, 'item3266');
+INSERT INTO items VALUES (3267, 67, 'item3267');
+INSERT INTO items VALUES (3268, 68, 'item3268');
+INSERT INTO items VALUES (3269, 69, 'item3269');
+INSERT INTO items VALUES (3270, 70, 'item3270');
+INSERT INTO items VALUES (3271, 71, 'item3271');
+INSERT INTO items VALUES (3272, 72, 'item3272');
+INSERT INTO items VALUES (3273, 73, 'item3273');
+INSERT INTO items VALUES (3274, 74, 'item3274');
+INSERT INTO items VALUES (3275, 75, 'item3275');
+INSERT INTO items VALUES (3276, 76, 'item3276');
+INSERT INTO items VALUES (3277, 77, 'item3277');
+INSERT INTO items VALUES (3278, 78, 'item3278');
+INSERT INTO items VALUES (3279, 79, 'item3279');
+INSERT INTO items VALUES (3280, 80, 'item3280');
+INSERT INTO items VALUES (3281, 81, 'item3281');
+INSERT INTO items VALUES (3282, 82, 'item3282');
+INSERT INTO items VALUES (3283, 83, 'item3283');
+INSERT INTO items VALUES (3284, 84, 'item3284');
+INSERT INTO items VALUES (3285, 85, 'item3285');
+INSERT INTO items VALUES (3286, 86, 'item3286');
+INSERT INTO items VALUES (3287, 87, 'item3287');
+INSERT INTO items VALUES (3288, 88, 'item3288');
+INSERT INTO items VALUES (3289, 89, 'item3289');
+INSERT INTO items VALUES (3290, 90, 'item3290');
+INSERT INTO items VALUES (3291, 91, 'item3291');
+INSERT INTO items VALUES (3292, 92, 'item3292');
+INSERT INTO items VALUES (3293, 93, 'item3293');
+INSERT INTO items VALUES (3294, 94, 'item3294');
+INSERT INTO items VALUES (3295, 95, 'item3295');
+INSERT INTO items VALUES (3296, 96, 'item3296');
+INSERT INTO items VALUES (3297, 97, 'item3297');
+INSERT INTO items VALUES (3298, 98, 'item3298');
+INSERT INTO items VALUES (3299, 99, 'item3299');
+INSERT INTO items VALUES (3300, 0, 'item3300');
+INSERT INTO items VALUES (3301, 1, 'item3301');
+INSERT INTO items VALUES (3302, 2, 'item3302');
+INSERT INTO items VALUES (3303, 3, 'item3303');
+INSERT INTO items VALUES (3304, 4, 'item3304');
+INSERT INTO items VALUES (3305, 5, 'item3305');
+INSERT INTO items VALUES (3306, 6, 'item3306');
+INSERT INTO items VALUES (3307, 7, 'item3307');
+INSERT INTO items VALUES (3308, 8, 'item3308');
+INSERT INTO items VALUES (3309, 9, 'item3309');
+INSERT INTO items VALUES (3310, 10, 'item3310');
+INSERT INTO items VALUES (3311, 11, 'item3311');
+INSERT INTO items VALUES (3312, 12, 'item3312');
+INSERT INTO items VALUES (3313, 13, 'item3313');
+INSERT INTO items VALUES (3314, 14, 'item3314');
+INSERT INTO items VALUES (3315, 15, 'item3315');
+INSERT INTO items VALUES (3316, 16, 'item3316');
+INSERT INTO items VALUES (3317, 17, 'item3317');
+INSERT INTO items VALUES (3318, 18, 'item3318');
+INSERT INTO items VALUES (3319, 19, 'item3319');
+INSERT INTO items VALUES (3320, 20, 'item3320');
+INSERT INTO items VALUES (3321, 21, 'item3321');
+INSERT INTO items VALUES (3322, 22, 'item3322');
+INSERT INTO items VALUES (3323, 23, 'item3323');
+INSERT INTO items VALUES (3324, 24, 'item3324');
+INSERT INTO items VALUES (3325, 25, 'item3325');
+INSERT INTO items VALUES (3326, 26, 'item3326');
+INSERT INTO items VALUES (3327, 27, 'item3327');
+INSERT INTO items VALUES (3328, 28, 'item3328');
+INSERT INTO items VALUES (3329, 29, 'item3329');
+INSERT INTO items VALUES (3330, 30, 'item3330');
+INSERT INTO items VALUES (3331, 31, 'item3331');
+INSERT INTO items VALUES (3332, 32, 'item3332');
+INSERT INTO items VALUES (3333, 33, 'item3333');
+INSERT INTO items VALUES (3334, 34, 'item3334');
+INSERT INTO items VALUES (3335, 35, 'item3335');
+INSERT INTO items VALUES (3336, 36, 'item3336');
+INSERT INTO items VALUES (3337, 37, 'item3337');
+INSERT INTO items VALUES (3338, 38, 'item3338');
+INSERT INTO items VALUES (3339, 39, 'item3339');
+INSERT INTO items VALUES (3340, 40, 'item3340');
+INSERT INTO items VALUES (3341, 41, 'item3341');
+INSERT INTO items VALUES (3342, 42, 'item3342');
+INSERT INTO items VALUES (3343, 43, 'item3343');
+INSERT INTO items VALUES (3344, 44, 'item3344');
+INSERT INTO items VALUES (3345, 45, 'item3345');
+INSERT INTO items VALUES (3346, 46, 'item3346');
+INSERT INTO items VALUES (3347, 47, 'item3347');
+INSERT INTO items VALUES (3348, 48, 'item3348');
+INSERT INTO items VALUES (3349, 49, 'item3349');
+INSERT INTO items VALUES (3350, 50, 'item3350');
+INSERT INTO items VALUES (3351, 51, 'item3351');
+INSERT INTO items VALUES (3352, 52, 'item3352');
+INSERT INTO items VALUES (3353, 53, 'item3353');
+INSERT INTO items VALUES (3354, 54, 'item3354');
+INSERT INTO items VALUES (3355, 55, 'item3355');
+INSERT INTO items VALUES (3356, 56, 'item3356');
+INSERT INTO items VALUES (3357, 57, 'item3357');
+INSERT INTO items VALUES (3358, 58, 'item3358');
+INSERT INTO items VALUES (3359, 59, 'item3359');
+INSERT INTO items VALUES (3360, 60, 'item3360');
+INSERT INTO items VALUES (3361, 61, 'item3361');
+INSERT INTO items VALUES (3362, 62, 'item3362');
+INSERT INTO items VALUES (3363, 63, 'item3363');
+INSERT INTO items VALUES (3364, 64, 'item3364');
+INSERT INTO items VALUES (3365, 65, 'item3365');
+INSERT INTO items VALUES (3366, 66, 'item3366');
+INSERT INTO items VALUES (3367, 67, 'item3367');
+INSERT INTO items VALUES (3368, 68, 'item3368');
+INSERT INTO items VALUES (3369, 69, 'item3369');
+INSERT INTO items VALUES (3370, 70, 'item3370');
+INSERT INTO items VALUES (3371, 71, 'item3371');
+INSERT INTO items VALUES (3372, 72, 'item3372');
+INSERT INTO items VALUES (3373, 73, 'item3373');
+INSERT INTO items VALUES (3374, 74, 'item3374');
+INSERT INTO items VALUES (3375, 75, 'item3375');
+INSERT INTO items VALUES (3376, 76, 'item3376');
+INSERT INTO items VALUES (3377, 77, 'item3377');
+INSERT INTO items VALUES (3378, 78, 'item3378');
+INSERT INTO items VALUES (3379, 79, 'item3379');
+INSERT INTO items VALUES (3380, 80, 'item3380');
+INSERT INTO items VALUES (3381, 81, 'item3381');
+INSERT INTO items VALUES (3382, 82, 'item3382');
+INSERT INTO items VALUES (3383, 83, 'item3383');
+INSERT INTO items VALUES (3384, 84, 'item3384');
+INSERT INTO items VALUES (3385, 85, 'item3385');
+INSERT INTO items VALUES (3386, 86, 'item3386');
+INSERT INTO items VALUES (3387, 87, 'item3387');
+INSERT INTO items VALUES (3388, 88, 'item3388');
+INSERT INTO items VALUES (3389, 89, 'item3389');
+INSERT INTO items VALUES (3390, 90, 'item3390');
+INSERT INTO items VALUES (3391, 91, 'item3391');
+INSERT INTO items VALUES (3392, 92, 'item3392');
+INSERT INTO items VALUES (3393, 93, 'item3393');
+INSERT INTO items VALUES (3394, 94, 'item3394');
+INSERT INTO items VALUES (3395, 95, 'item3395');
+INSERT INTO items VALUES (3396, 96, 'item3396');
+INSERT INTO items VALUES (3397, 97, 'item3397');
+INSERT INTO items VALUES (3398, 98, 'item3398');
+INSERT INTO items VALUES (3399, 99, 'item3399');
+INSERT INTO items VALUES (3400, 0, 'item3400');
+INSERT INTO items VALUES (3401, 1, 'item3401');
+INSERT INTO items VALUES (3402, 2, 'item3402');
+INSERT INTO items VALUES (3403, 3, 'item3403');
+INSERT INTO items VALUES (3404, 4, 'item3404');
+INSERT INTO items VALUES (3405, 5, 'item3405');
+INSERT INTO items VALUES (3406, 6, 'item3406');
+INSERT INTO items VALUES (3407, 7, 'item3407');
+INSERT INTO items VALUES (3408, 8, 'item3408');
+INSERT INTO items VALUES (3409, 9, 'item3409');
+INSERT INTO items VALUES (3410, 10, 'item3410');
+INSERT INTO items VALUES (3411, 11, 'item3411');
+INSERT INTO items VALUES (3412, 12, 'item3412');
+INSERT INTO items VALUES (3413, 13, 'item3413');
+INSERT INTO items VALUES (3414, 14, 'item3414');
+INSERT INTO items VALUES (3415, 15, 'item3415');
+INSERT INTO items VALUES (3416, 16, 'item3416');
+INSERT INTO items VALUES (3417, 17, 'item3417');
+INSERT INTO items VALUES (3418, 18, 'item3418');
+INSERT INTO items VALUES (3419, 19, 'item3419');
+INSERT INTO items VALUES (3420, 20, 'item3420');
+INSERT INTO items VALUES (3421, 21, 'item3421');
+INSERT INTO items VALUES (3422, 22, 'item3422');
+INSERT INTO items VALUES (3423, 23, 'item3423');
+INSERT INTO items VALUES (3424, 24, 'item3424');
+INSERT INTO items VALUES (3425, 25, 'item3425');
+INSERT INTO items VALUES (3426, 26, 'item3426');
+INSERT INTO items VALUES (3427, 27, 'item3427');
+INSERT INTO items VALUES (3428, 28, 'item3428');
+INSERT INTO items VALUES (3429, 29, 'item3429');
+INSERT INTO items VALUES (3430, 30, 'item3430');
+INSERT INTO items VALUES (3431, 31, 'item3431');
+INSERT INTO items VALUES (3432, 32, 'item3432');
+INSERT INTO items VALUES (3433, 33, 'item3433');
+INSERT INTO items VALUES (3434, 34, 'item3434');
+INSERT INTO items VALUES (3435, 35, 'item3435');
+INSERT INTO items VALUES (3436, 36, 'item3436');
+INSERT INTO items VALUES (3437, 37, 'item3437');
+INSERT INTO items VALUES (3438, 38, 'item3438');
+INSERT INTO items VALUES (3439, 39, 'item3439');
+INSERT INTO items VALUES (3440, 40, 'item3440');
+INSERT INTO items VALUES (3441, 41, 'item3441');
+INSERT INTO items VALUES (3442, 42, 'item3442');
+INSERT INTO items VALUES (3443, 43, 'item3443');
+INSERT INTO items VALUES (3444, 44, 'item3444');
+INSERT INTO items VALUES (3445, 45, 'item3445');
+INSERT INTO items VALUES (3446, 46, 'item3446');
+INSERT INTO items VALUES (3447, 47, 'item3447');
+INSERT INTO items VALUES (3448, 48, 'item3448');
+INSERT INTO items VALUES (3449, 49, 'item3449');
+INSERT INTO items VALUES (3450, 50, 'item3450');
+INSERT INTO items VALUES (3451, 51, 'item3451');
+INSERT INTO items VALUES (3452, 52, 'item3452');
+INSERT INTO items VALUES (3453, 53, 'item3453');
+INSERT INTO items VALUES (3454, 54, 'item3454');
+INSERT INTO items VALUES (3455, 55, 'item3455');
+INSERT INTO items VALUES (3456, 56, 'item3456');
+INSERT INTO items VALUES (3457, 57, 'item3457');
+INSERT INTO items VALUES (3458, 58, 'item3458');
+INSERT INTO items VALUES (3459, 59, 'item3459');
+INSERT INTO items VALUES (3460, 60, 'item3460');
+INSERT INTO items VALUES (3461, 61, 'item3461');
+INSERT INTO items VALUES (3462, 62, 'item3462');
+INSERT INTO items VALUES (3463, 63, 'item3463');
+INSERT INTO items VALUES (3464, 64, 'item3464');
+INSERT INTO items VALUES (3465, 65, 'item3465');
+INSERT INTO items VALUES (3466, 66, 'item3466');
+INSERT INTO items VALUES (3467, 67, 'item3467');
+INSERT INTO items VALUES (3468, 68, 'item3468');
+INSERT INTO items VALUES (3469, 69, 'item3469');
+INSERT INTO items VALUES (3470, 70, 'item3470');
+INSERT INTO items VALUES (3471, 71, 'item3471');
+INSERT INTO items VALUES (3472, 72, 'item3472');
+INSERT INTO items VALUES (3473, 73, 'item3473');
+INSERT INTO items VALUES (3474, 74, 'item3474');
+INSERT INTO items VALUES (3475, 75, 'item3475');
+INSERT INTO items VALUES (3476, 76, 'item3476');
+INSERT INTO items VALUES (3477, 77, 'item3477');
+INSERT INTO items VALUES (3478, 78, 'item3478');
+INSERT INTO items VALUES (3479, 79, 'item3479');
+INSERT INTO items VALUES (3480, 80, 'item3480');
+INSERT INTO items VALUES (3481, 81, 'item3481');
+INSERT INTO items VALUES (3482, 82, 'item3482');
+INSERT INTO items VALUES (3483, 83, 'item3483');
+INSERT INTO items VALUES (3484, 84, 'item3484');
+INSERT INTO items VALUES (3485, 85, 'item3485');
+INSERT INTO items VALUES (3486, 86, 'item3486');
+INSERT INTO items VALUES (3487, 87, 'item3487');
+INSERT INTO items VALUES (3488, 88, 'item3488');
+INSERT INTO items VALUES (3489, 89, 'item3489');
+INSERT INTO items VALUES (3490, 90, 'item3490');
+INSERT INTO items VALUES (3491, 91, 'item3491');
+INSERT INTO items VALUES (3492, 92, 'item3492');
+INSERT INTO items VALUES (3493, 93, 'item3493');
+INSERT INTO items VALUES (3494, 94, 'item3494');
+INSERT INTO items VALUES (3495, 95, 'item3495');
+INSERT INTO items VALUES (3496, 96, 'item3496');
+INSERT INTO items VALUES (3497, 97, 'item3497');
+INSERT INTO items VALUES (3498, 98, 'item3498');
+INSERT INTO items VALUES (3499, 99, 'item3499');
+INSERT INTO items VALUES (3500, 0, 'item3500');
+INSERT INTO items VALUES (3501, 1, 'item3501');
+INSERT INTO items VALUES (3502, 2, 'item3502');
+INSERT INTO items VALUES (3503, 3, 'item3503');
+INSERT INTO items VALUES (3504, 4, 'item3504');
+INSERT INTO items VALUES (3505, 5, 'item3505');
+INSERT INTO items VALUES (3506, 6, 'item3506');
+INSERT INTO items VALUES (3507, 7, 'item3507');
+INSERT INTO items VALUES (3508, 8, 'item3508');
+INSERT INTO items VALUES (3509, 9, 'item3509');
+INSERT INTO items VALUES (3510, 10, 'item3510');
+INSERT INTO items VALUES (3511, 11, 'item3511');
+INSERT INTO items VALUES (3512, 12, 'item3512');
+INSERT INTO items VALUES (3513, 13, 'item3513');
+INSERT INTO items VALUES (3514, 14, 'item3514');
+INSERT INTO items VALUES (3515, 15, 'item3515');
+INSERT INTO items VALUES (3516, 16, 'item3516');
+INSERT INTO items VALUES (3517, 17, 'item3517');
+INSERT INTO items VALUES (3518, 18, 'item3518');
+INSERT INTO items VALUES (3519, 19, 'item3519');
+INSERT INTO items VALUES (3520, 20, 'item3520');
+INSERT INTO items VALUES (3521, 21, 'item3521');
+INSERT INTO items VALUES (3522, 22, 'item3522');
+INSERT INTO items VALUES (3523, 23, 'item3523');
+INSERT INTO items VALUES (3524, 24, 'item3524');
+INSERT INTO items VALUES (3525, 25, 'item3525');
+INSERT INTO items VALUES (3526, 26, 'item3526');
+INSERT INTO items VALUES (3527, 27, 'item3527');
+INSERT INTO items VALUES (3528, 28, 'item3528');
+INSERT INTO items VALUES (3529, 29, 'item3529');
+INSERT INTO items VALUES (3530, 30, 'item3530');
+INSERT INTO items VALUES (3531, 31, 'item3531');
+INSERT INTO items VALUES (3532, 32, 'item3532');
+INSERT INTO items VALUES (3533, 33, 'item3533');
+INSERT INTO items VALUES (3534, 34, 'item3534');
+INSERT INTO items VALUES (3535, 35, 'item3535');
+INSERT INTO items VALUES (3536, 36, 'item3536');
+INSERT INTO items VALUES (3537, 37, 'item3537');
+INSERT INTO items VALUES (3538, 38, 'item3538');
+INSERT INTO items VALUES (3539, 39, 'item3539');
+INSERT INTO items VALUES (3540, 40, 'item3540');
+INSERT INTO items VALUES (3541, 41, 'item3541');
+INSERT INTO items VALUES (3542, 42, 'item3542');
+INSERT INTO items VALUES (3543, 43, 'item3543');
+INSERT INTO items VALUES (3544, 44, 'item3544');
+INSERT INTO items VALUES (3545, 45, 'item3545');
+INSERT INTO items VALUES (3546, 46, 'item3546');
+INSERT INTO items VALUES (3547, 47, 'item3547');
+INSERT INTO items VALUES (3548, 48, 'item3548');
+INSERT INTO items VALUES (3549, 49, 'item3549');
+INSERT INTO items VALUES (3550, 50, 'item3550');
+INSERT INTO items VALUES (3551, 51, 'item3551');
+INSERT INTO items VALUES (3552, 52, 'item3552');
+INSERT INTO items VALUES (3553, 53, 'item3553');
+INSERT INTO items VALUES (3554, 54, 'item3554');
+INSERT INTO items VALUES (3555, 55, 'item3555');
+INSERT INTO items VALUES (3556, 56, 'item3556');
+INSERT INTO items VALUES (3557, 57, 'item3557');
+INSERT INTO items VALUES (3558, 58, 'item3558');
+INSERT INTO items VALUES (3559, 59, 'item3559');
+INSERT INTO items VALUES (3560, 60, 'item3560');
+INSERT INTO items VALUES (3561, 61, 'item3561');
+INSERT INTO items VALUES (3562, 62, 'item3562');
+INSERT INTO items VALUES (3563, 63, 'item3563');
+INSERT INTO items VALUES (3564, 64, 'item3564');
+INSERT INTO items VALUES (3565, 65, 'item3565');
+INSERT INTO items VALUES (3566, 66, 'item3566');
+INSERT INTO items VALUES (3567, 67, 'item3567');
+INSERT INTO items VALUES (3568, 68, 'item3568');
+INSERT INTO items VALUES (3569, 69, 'item3569');
+INSERT INTO items VALUES (3570, 70, 'item3570');
+INSERT INTO items VALUES (3571, 71, 'item3571');
+INSERT INTO items VALUES (3572, 72, 'item3572');
+INSERT INTO items VALUES (3573, 73, 'item3573');
+INSERT INTO items VALUES (3574, 74, 'item3574');
+INSERT INTO items VALUES (3575, 75, 'item3575');
+INSERT INTO items VALUES (3576, 76, 'item3576');
+INSERT INTO items VALUES (3577, 77, 'item3577');
+INSERT INTO items VALUES (3578, 78, 'item3578');
+INSERT INTO items VALUES (3579, 79, 'item3579');
+INSERT INTO items VALUES (3580, 80, 'item3580');
+INSERT INTO items VALUES (3581, 81, 'item3581');
+INSERT INTO items VALUES (3582, 82, 'item3582');
+INSERT INTO items VALUES (3583, 83, 'item3583');
+INSERT INTO items VALUES (3584, 84, 'item3584');
+INSERT INTO items VALUES (3585, 85, 'item3585');
+INSERT INTO items VALUES (3586, 86, 'item3586');
+INSERT INTO items VALUES (3587, 87, 'item3587');
+INSERT INTO items VALUES (3588, 88, 'item3588');
+INSERT INTO items VALUES (3589, 89, 'item3589');
+INSERT INTO items VALUES (3590, 90, 'item3590');
+INSERT INTO items VALUES (3591, 91, 'item3591');
+INSERT INTO items VALUES (3592, 92, 'item3592');
+INSERT INTO items VALUES (3593, 93, 'item3593');
+INSERT INTO items VALUES (3594, 94, 'item3594');
+INSERT INTO items VALUES (3595, 95, 'item3595');
+INSERT INTO items VALUES (3596, 96, 'item3596');
+INSERT INTO items VALUES (3597, 97, 'item3597');
+INSERT INTO items VALUES (3598, 98, 'item3598');
+INSERT INTO items VALUES (3599, 99, 'item3599');
+INSERT INTO items VALUES (3600, 0, 'item3600');
+INSERT INTO items VALUES (3601, 1, 'item3601');
+INSERT INTO items VALUES (3602, 2, 'item3602');
+INSERT INTO items VALUES (3603, 3, 'item3603');
+INSERT INTO items VALUES (3604, 4, 'item3604');
+INSERT INTO items VALUES (3605, 5, 'item3605');
+INSERT INTO items VALUES (3606, 6, 'item3606');
+INSERT INTO items VALUES (3607, 7, 'item3607');
+INSERT INTO items VALUES (3608, 8, 'item3608');
+INSERT INTO items VALUES (3609, 9, 'item3609');
+INSERT INTO items VALUES (3610, 10, 'item3610');
+INSERT INTO items VALUES (3611, 11, 'item3611');
+INSERT INTO items VALUES (3612, 12, 'item3612');
+INSERT INTO items VALUES (3613, 13, 'item3613');
+INSERT INTO items VALUES (3614, 14, 'item3614');
+INSERT INTO items VALUES (3615, 15, 'item3615');
+INSERT INTO items VALUES (3616, 16, 'item3616');
+INSERT INTO items VALUES (3617, 17, 'item3617');
+INSERT INTO items VALUES (3618, 18, 'item3618');
+INSERT INTO items VALUES (3619, 19, 'item3619');
+INSERT INTO items VALUES (3620, 20, 'item3620');
+INSERT INTO items VALUES (3621, 21, 'item3621');
+INSERT INTO items VALUES (3622, 22, 'item3622');
+INSERT INTO items VALUES (3623, 23, 'item3623');
+INSERT INTO items VALUES (3624, 24, 'item3624');
+INSERT INTO items VALUES (3625, 25, 'item3625');
+INSERT INTO items VALUES (3626, 26, 'item3626');
+INSERT INTO items VALUES (3627, 27, 'item3627');
+INSERT INTO items VALUES (3628, 28, 'item3628');
+INSERT INTO items VALUES (3629, 29, 'item3629');
+INSERT INTO items VALUES (3630, 30, 'item3630');
+INSERT INTO items VALUES (3631, 31, 'item3631');
+INSERT INTO items VALUES (3632, 32, 'item3632');
+INSERT INTO items VALUES (3633, 33, 'item3633');
+INSERT INTO items VALUES (3634, 34, 'item3634');
+INSERT INTO items VALUES (3635, 35, 'item3635');
+INSERT INTO items VALUES (3636, 36, 'item3636');
+INSERT INTO items VALUES (3637, 37, 'item3637');
+INSERT INTO items VALUES (3638, 38, 'item3638');
+INSERT INTO items VALUES (3639, 39, 'item3639');
+INSERT INTO items VALUES (3640, 40, 'item3640');
+INSERT INTO items VALUES (3641, 41, 'item3641');
+INSERT INTO items VALUES (3642, 42, 'item3642');
+INSERT INTO items VALUES (3643, 43, 'item3643');
+INSERT INTO items VALUES (3644, 44, 'item3644');
+INSERT INTO items VALUES (3645, 45, 'item3645');
+INSERT INTO items VALUES (3646, 46, 'item3646');
+INSERT INTO items VALUES (3647, 47, 'item3647');
+INSERT INTO items VALUES (3648, 48, 'item3648');
+INSERT INTO items VALUES (3649, 49, 'item3649');
+INSERT INTO items VALUES (3650, 50, 'item3650');
+INSERT INTO items VALUES (3651, 51, 'item3651');
+INSERT INTO items VALUES (3652, 52, 'item3652');
+INSERT INTO items VALUES (3653, 53, 'item3653');
+INSERT INTO items VALUES (3654, 54, 'item3654');
+INSERT INTO items VALUES (3655, 55, 'item3655');
+INSERT INTO items VALUES (3656, 56, 'item3656');
+INSERT INTO items VALUES (3657, 57, 'item3657');
+INSERT INTO items VALUES (3658, 58, 'item3658');
+INSERT INTO items VALUES (3659, 59, 'item3659');
+INSERT INTO items VALUES (3660, 60, 'item3660');
+INSERT INTO items VALUES (3661, 61, 'item3661');
+INSERT INTO items VALUES (3662, 62, 'item3662');
+INSERT INTO items VALUES (3663, 63, 'item3663');
+INSERT INTO items VALUES (3664, 64, 'item3664');
+INSERT INTO items VALUES (3665, 65, 'item3665');
+INSERT INTO items VALUES (3666, 66, 'item3666');
+INSERT INTO items VALUES (3667, 67, 'item3667');
+INSERT INTO items VALUES (3668, 68, 'item3668');
+INSERT INTO items VALUES (3669, 69, 'item3669');
+INSERT INTO items VALUES (3670, 70, 'item3670');
+INSERT INTO items VALUES (3671, 71, 'item3671');
+INSERT INTO items VALUES (3672, 72, 'item3672');
+INSERT INTO items VALUES (3673, 73, 'item3673');
+INSERT INTO items VALUES (3674, 74, 'item3674');
+INSERT INTO items VALUES (3675, 75, 'item3675');
+INSERT INTO items VALUES (3676, 76, 'item3676');
+INSERT INTO items VALUES (3677, 77, 'item3677');
+INSERT INTO items VALUES (3678, 78, 'item3678');
+INSERT INTO items VALUES (3679, 79, 'item3679');
+INSERT INTO items VALUES (3680, 80, 'item3680');
+INSERT INTO items VALUES (3681, 81, 'item3681');
+INSERT INTO items VALUES (3682, 82, 'item3682');
+INSERT INTO items VALUES (3683, 83, 'item3683');
+INSERT INTO items VALUES (3684, 84, 'item3684');
+INSERT INTO items VALUES (3685, 85, 'item3685');
+INSERT INTO items VALUES (3686, 86, 'item3686');
+INSERT INTO items VALUES (3687, 87, 'item3687');
+INSERT INTO items VALUES (3688, 88, 'item3688');
+INSERT INTO items VALUES (3689, 89, 'item3689');
+INSERT INTO items VALUES (3690, 90, 'item3690');
+INSERT INTO items VALUES (3691, 91, 'item3691');
+INSERT INTO items VALUES (3692, 92, 'item3692');
+INSERT INTO items VALUES (3693, 93, 'item3693');
+INSERT INTO items VALUES (3694, 94, 'item3694');
+INSERT INTO items VALUES (3695, 95, 'item3695');
+INSERT INTO items VALUES (3696, 96, 'item3696');
+INSERT INTO items VALUES (3697, 97, 'item3697');
+INSERT INTO items VALUES (3698, 98, 'item3698');
+INSERT INTO items VALUES (3699, 99, 'item3699');
+INSERT INTO items VALUES (3700, 0, 'item3700');
+INSERT INTO items VALUES (3701, 1, 'item3701');
+INSERT INTO items VALUES (3702, 2, 'item3702');
+INSERT INTO items VALUES (3703, 3, 'item3703');
+INSERT INTO items VALUES (3704, 4, 'item3704');
+INSERT INTO items VALUES (3705, 5, 'item3705');
+INSERT INTO items VALUES (3706, 6, 'item3706');
+INSERT INTO items VALUES (3707, 7, 'item3707');
+INSERT INTO items VALUES (3708, 8, 'item3708');
+INSERT INTO items VALUES (3709, 9, 'item3709');
+INSERT INTO items VALUES (3710, 10, 'item3710');
+INSERT INTO items VALUES (3711, 11, 'item3711');
+INSERT INTO items VALUES (3712, 12, 'item3712');
+INSERT INTO items VALUES (3713, 13, 'item3713');
+INSERT INTO items VALUES (3714, 14, 'item3714');
+INSERT INTO items VALUES (3715, 15, 'item3715');
+INSERT INTO items VALUES (3716, 16, 'item3716');
+INSERT INTO items VALUES (3717, 17, 'item3717');
+INSERT INTO items VALUES (3718, 18, 'item3718');
+INSERT INTO items VALUES (3719, 19, 'item3719');
+INSERT INTO items VALUES (3720, 20, 'item3720');
+INSERT INTO items VALUES (3721, 21, 'item3721');
+INSERT INTO items VALUES (3722, 22, 'item3722');
+INSERT INTO items VALUES (3723, 23, 'item3723');
+INSERT INTO items VALUES (3724, 24, 'item3724');
+INSERT INTO items VALUES (3725, 25, 'item3725');
+INSERT INTO items VALUES (3726, 26, 'item3726');
+INSERT INTO items VALUES (3727, 27, 'item3727');
+INSERT INTO items VALUES (3728, 28, 'item3728');
+INSERT INTO items VALUES (3729, 29, 'item3729');
+INSERT INTO items VALUES (3730, 30, 'item3730');
+INSERT INTO items VALUES (3731, 31, 'item3731');
+INSERT INTO items VALUES (3732, 32, 'item3732');
+INSERT INTO items VALUES (3733, 33, 'item3733');
+INSERT INTO items VALUES (3734, 34, 'item3734');
+INSERT INTO items VALUES (3735, 35, 'item3735');
+INSERT INTO items VALUES (3736, 36, 'item3736');
+INSERT INTO items VALUES (3737, 37, 'item3737');
+INSERT INTO items VALUES (3738, 38, 'item3738');
+INSERT INTO items VALUES (3739, 39, 'item3739');
+INSERT INTO items VALUES (3740, 40, 'item3740');
+INSERT INTO items VALUES (3741, 41, 'item3741');
+INSERT INTO items VALUES (3742, 42, 'item3742');
+INSERT INTO items VALUES (3743, 43, 'item3743');
+INSERT INTO items VALUES (3744, 44, 'item3744');
+INSERT INTO items VALUES (3745, 45, 'item3745');
+INSERT INTO items VALUES (3746, 46, 'item3746');
+INSERT INTO items VALUES (3747, 47, 'item3747');
+INSERT INTO items VALUES (3748, 48, 'item3748');
+INSERT INTO items VALUES (3749, 49, 'item3749');
+INSERT INTO items VALUES (3750, 50, 'item3750');
+INSERT INTO items VALUES (3751, 51, 'item3751');
+INSERT INTO items VALUES (3752, 52, 'item3752');
+INSERT INTO items VALUES (3753, 53, 'item3753');
+INSERT INTO items VALUES (3754, 54, 'item3754');
+INSERT INTO items VALUES (3755, 55, 'item3755');
+INSERT INTO items VALUES (3756, 56, 'item3756');
+INSERT INTO items VALUES (3757, 57, 'item3757');
+INSERT INTO items VALUES (3758, 58, 'item3758');
+INSERT INTO items VALUES (3759, 59, 'item3759');
+INSERT INTO items VALUES (3760, 60, 'item3760');
+INSERT INTO items VALUES (3761, 61, 'item3761');
+INSERT INTO items VALUES (3762, 62, 'item3762');
+INSERT INTO items VALUES (3763, 63, 'item3763');
+INSERT INTO items VALUES (3764, 64, 'item3764');
+INSERT INTO items VALUES (3765, 65, 'item3765');
+INSERT INTO items VALUES (3766, 66, 'item3766');
+INSERT INTO items VALUES (3767, 67, 'item3767');
+INSERT INTO items VALUES (3768, 68, 'item3768');
+INSERT INTO items VALUES (3769, 69, 'item3769');
+INSERT INTO items VALUES (3770, 70, 'item3770');
+INSERT INTO items VALUES (3771, 71, 'item3771');
+INSERT INTO items VALUES (3772, 72, 'item3772');
+INSERT INTO items VALUES (3773, 73, 'item3773');
+INSERT INTO items VALUES (3774, 74, 'item3774');
+INSERT INTO items VALUES (3775, 75, 'item3775');
+INSERT INTO items VALUES (3776, 76, 'item3776');
+INSERT INTO items VALUES (3777, 77, 'item3777');
+INSERT INTO items VALUES (3778, 78, 'item3778');
+INSERT INTO items VALUES (3779, 79, 'item3779');
+INSERT INTO items VALUES (3780, 80, 'item3780');
+INSERT INTO items VALUES (3781, 81, 'item3781');
+INSERT INTO items VALUES (3782, 82, 'item3782');
+INSERT INTO items VALUES (3783, 83, 'item3783');
+INSERT INTO items VALUES (3784, 84, 'item3784');
+INSERT INTO items VALUES (3785, 85, 'item3785');
+INSERT INTO items VALUES (3786, 86, 'item3786');
+INSERT INTO items VALUES (3787, 87, 'item3787');
+INSERT INTO items VALUES (3788, 88, 'item3788');
+INSERT INTO items VALUES (3789, 89, 'item3789');
+INSERT INTO items VALUES (3790, 90, 'item3790');
+INSERT INTO items VALUES (3791, 91, 'item3791');
+INSERT INTO items VALUES (3792, 92, 'item3792');
+INSERT INTO items VALUES (3793, 93, 'item3793');
+INSERT INTO items VALUES (3794, 94, 'item3794');
+INSERT INTO items VALUES (3795, 95, 'item3795');
+INSERT INTO items VALUES (3796, 96, 'item3796');
+INSERT INTO items VALUES (3797, 97, 'item3797');
+INSERT INTO items VALUES (3798, 98, 'item3798');
+INSERT INTO items VALUES (3799, 99, 'item3799');
+INSERT INTO items VALUES (3800, 0, 'item3800');
+INSERT INTO items VALUES (3801, 1, 'item3801');
+INSERT INTO items VALUES (3802, 2, 'item3802');
+INSERT INTO items VALUES (3803, 3, 'item3803');
+INSERT INTO items VALUES (3804, 4, 'item3804');
+INSERT INTO items VALUES (3805, 5, 'item3805');
+INSERT INTO items VALUES (3806, 6, 'item3806');
+INSERT INTO items VALUES (3807, 7, 'item3807');
+INSERT INTO items VALUES (3808, 8, 'item3808');
+INSERT INTO items VALUES (3809, 9, 'item3809');
+INSERT INTO items VALUES (3810, 10, 'item3810');
+INSERT INTO items VALUES (3811, 11, 'item3811');
+INSERT INTO items VALUES (3812, 12, 'item3812');
+INSERT INTO items VALUES (3813, 13, 'item3813');
+INSERT INTO items VALUES (3814, 14, 'item3814');
+INSERT INTO items VALUES (3815, 15, 'item3815');
+INSERT INTO items VALUES (3816, 16, 'item3816');
+INSERT INTO items VALUES (3817, 17, 'item3817');
+INSERT INTO items VALUES (3818, 18, 'item3818');
+INSERT INTO items VALUES (3819, 19, 'item3819');
+INSERT INTO items VALUES (3820, 20, 'item3820');
+INSERT INTO items VALUES (3821, 21, 'item3821');
+INSERT INTO items VALUES (3822, 22, 'item3822');
+INSERT INTO items VALUES (3823, 23, 'item3823');
+INSERT INTO items VALUES (3824, 24, 'item3824');
+INSERT INTO items VALUES (3825, 25, 'item3825');
+INSERT INTO items VALUES (3826, 26, 'item3826');
+INSERT INTO items VALUES (3827, 27, 'item3827');
+INSERT INTO items VALUES (3828, 28, 'item3828');
+INSERT INTO items VALUES (3829, 29, 'item3829');
+INSERT INTO items VALUES (3830, 30, 'item3830');
+INSERT INTO items VALUES (3831, 31, 'item3831');
+INSERT INTO items VALUES (3832, 32, 'item3832');
+INSERT INTO items VALUES (3833, 33, 'item3833');
+INSERT INTO items VALUES (3834, 34, 'item3834');
+INSERT INTO items VALUES (3835, 35, 'item3835');
+INSERT INTO items VALUES (3836, 36, 'item3836');
+INSERT INTO items VALUES (3837, 37, 'item3837');
+INSERT INTO items VALUES (3838, 38, 'item3838');
+INSERT INTO items VALUES (3839, 39, 'item3839');
+INSERT INTO items VALUES (3840, 40, 'item3840');
+INSERT INTO items VALUES (3841, 41, 'item3841');
+INSERT INTO items VALUES (3842, 42, 'item3842');
+INSERT INTO items VALUES (3843, 43, 'item3843');
+INSERT INTO items VALUES (3844, 44, 'item3844');
+INSERT INTO items VALUES (3845, 45, 'item3845');
+INSERT INTO items VALUES (3846, 46, 'item3846');
+INSERT INTO items VALUES (3847, 47, 'item3847');
+INSERT INTO items VALUES (3848, 48, 'item3848');
+INSERT INTO items VALUES (3849, 49, 'item3849');
+INSERT INTO items VALUES (3850, 50, 'item3850');
+INSERT INTO items VALUES (3851, 51, 'item3851');
+INSERT INTO items VALUES (3852, 52, 'item3852');
+INSERT INTO items VALUES (3853, 53, 'item3853');
+INSERT INTO items VALUES (3854, 54, 'item3854');
+INSERT INTO items VALUES (3855, 55, 'item3855');
+INSERT INTO items VALUES (3856, 56, 'item3856');
+INSERT INTO items VALUES (3857, 57, 'item3857');
+INSERT INTO items VALUES (3858, 58, 'item3858');
+INSERT INTO items VALUES (3859, 59, 'item3859');
+INSERT INTO items VALUES (3860, 60, 'item3860');
+INSERT INTO items VALUES (3861, 61, 'item3861');
+INSERT INTO items VALUES (3862, 62, 'item3862');
+INSERT INTO items VALUES (3863, 63, 'item3863');
+INSERT INTO items VALUES (3864, 64, 'item3864');
+INSERT INTO items VALUES (3865, 65, 'item3865');
+INSERT INTO items VALUES (3866, 66, 'item3866');
+INSERT INTO items VALUES (3867, 67, 'item3867');
+INSERT INTO items VALUES (3868, 68, 'item3868');
+INSERT INTO items VALUES (3869, 69, 'item3869');
+INSERT INTO items VALUES (3870, 70, 'item3870');
+INSERT INTO items VALUES (3871, 71, 'item3871');
+INSERT INTO items VALUES (3872, 72, 'item3872');
+INSERT INTO items VALUES (3873, 73, 'item3873');
+INSERT INTO items VALUES (3874, 74, 'item3874');
+INSERT INTO items VALUES (3875, 75, 'item3875');
+INSERT INTO items VALUES (3876, 76, 'item3876');
+INSERT INTO items VALUES (3877, 77, 'item3877');
+INSERT INTO items VALUES (3878, 78, 'item3878');
+INSERT INTO items VALUES (3879, 79, 'item3879');
+INSERT INTO items VALUES (3880, 80, 'item3880');
+INSERT INTO items VALUES (3881, 81, 'item3881');
+INSERT INTO items VALUES (3882, 82, 'item3882');
+INSERT INTO items VALUES (3883, 83, 'item3883');
+INSERT INTO items VALUES (3884, 84, 'item3884');
+INSERT INTO items VALUES (3885, 85, 'item3885');
+INSERT INTO items VALUES (3886, 86, 'item3886');
+INSERT INTO items VALUES (3887, 87, 'item3887');
+INSERT INTO items VALUES (3888, 88, 'item3888');
+INSERT INTO items VALUES (3889, 89, 'item3889');
+INSERT INTO items VALUES (3890, 90, 'item3890');
+INSERT INTO items VALUES (3891, 91, 'item3891');
+INSERT INTO items VALUES (3892, 92, 'item3892');
+INSERT INTO items VALUES (3893, 93, 'item3893');
+INSERT INTO items VALUES (3894, 94, 'item3894');
+INSERT INTO items VALUES (3895, 95, 'item3895');
+INSERT INTO items VALUES (3896, 96, 'item3896');
+INSERT INTO items VALUES (3897, 97, 'item3897');
+INSERT INTO items VALUES (3898, 98, 'item3898');
+INSERT INTO items VALUES (3899, 99, 'item3899');
+INSERT INTO items VALUES (3900, 0, 'item3900');
+INSERT INTO items VALUES (3901, 1, 'item3901');
+INSERT INTO items VALUES (3902, 2, 'item3902');
+INSERT INTO items VALUES (3903, 3, 'item3903');
+INSERT INTO items VALUES (3904, 4, 'item3904');
+INSERT INTO items VALUES (3905, 5, 'item3905');
+INSERT INTO items VALUES (3906, 6, 'item3906');
+INSERT INTO items VALUES (3907, 7, 'item3907');
+INSERT INTO items VALUES (3908, 8, 'item3908');
+INSERT INTO items VALUES (3909, 9, 'item3909');
+INSERT INTO items VALUES (3910, 10, 'item3910');
+INSERT INTO items VALUES (3911, 11, 'item3911');
+INSERT INTO items VALUES (3912, 12, 'item3912');
+INSERT INTO items VALUES (3913, 13, 'item3913');
+INSERT INTO items VALUES (3914, 14, 'item3914');
+INSERT INTO items VALUES (3915, 15, 'item3915');
+INSERT INTO items VALUES (3916, 16, 'item3916');
+INSERT INTO items VALUES (3917, 17, 'item3917');
+INSERT INTO items VALUES (3918, 18, 'item3918');
+INSERT INTO items VALUES (3919, 19, 'item3919');
+INSERT INTO items VALUES (3920, 20, 'item3920');
+INSERT INTO items VALUES (3921, 21, 'item3921');
+INSERT INTO items VALUES (3922, 22, 'item3922');
+INSERT INTO items VALUES (3923, 23, 'item3923');
+INSERT INTO items VALUES (3924, 24, 'item3924');
+INSERT INTO items VALUES (3925, 25, 'item3925');
+INSERT INTO items VALUES (3926, 26, 'item3926');
+INSERT INTO items VALUES (3927, 27, 'item3927');
+INSERT INTO items VALUES (3928, 28, 'item3928');
+INSERT INTO items VALUES (3929, 29, 'item3929');
+INSERT INTO items VALUES (3930, 30, 'item3930');
+INSERT INTO items VALUES (3931, 31, 'item3931');
+INSERT INTO items VALUES (3932, 32, 'item3932');
+INSERT INTO items VALUES (3933, 33, 'item3933');
+INSERT INTO items VALUES (3934, 34, 'item3934');
+INSERT INTO items VALUES (3935, 35, 'item3935');
+INSERT INTO items VALUES (3936, 36, 'item3936');
+INSERT INTO items VALUES (3937, 37, 'item3937');
+INSERT INTO items VALUES (3938, 38, 'item3938');
+INSERT INTO items VALUES (3939, 39, 'item3939');
+INSERT INTO items VALUES (3940, 40, 'item3940');
+INSERT INTO items VALUES (3941, 41, 'item3941');
+INSERT INTO items VALUES (3942, 42, 'item3942');
+INSERT INTO items VALUES (3943, 43, 'item3943');
+INSERT INTO items VALUES (3944, 44, 'item3944');
+INSERT INTO items VALUES (3945, 45, 'item3945');
+INSERT INTO items VALUES (3946, 46, 'item3946');
+INSERT INTO items VALUES (3947, 47, 'item3947');
+INSERT INTO items VALUES (3948, 48, 'item3948');
+INSERT INTO items VALUES (3949, 49, 'item3949');
+INSERT INTO items VALUES (3950, 50, 'item3950');
+INSERT INTO items VALUES (3951, 51, 'item3951');
+INSERT INTO items VALUES (3952, 52, 'item3952');
+INSERT INTO items VALUES (3953, 53, 'item3953');
+INSERT INTO items VALUES (3954, 54, 'item3954');
+INSERT INTO items VALUES (3955, 55, 'item3955');
+INSERT INTO items VALUES (3956, 56, 'item3956');
+INSERT INTO items VALUES (3957, 57, 'item3957');
+INSERT INTO items VALUES (3958, 58, 'item3958');
+INSERT INTO items VALUES (3959, 59, 'item3959');
+INSERT INTO items VALUES (3960, 60, 'item3960');
+INSERT INTO items VALUES (3961, 61, 'item3961');
+INSERT INTO items VALUES (3962, 62, 'item3962');
+INSERT INTO items VALUES (3963, 63, 'item3963');
+INSERT INTO items VALUES (3964, 64, 'item3964');
+INSERT INTO items VALUES (3965, 65, 'item3965');
+INSERT INTO items VALUES (3966, 66, 'item3966');
+INSERT INTO items VALUES (3967, 67, 'item3967');
+INSERT INTO items VALUES (3968, 68, 'item3968');
+INSERT INTO items VALUES (3969, 69, 'item3969');
+INSERT INTO items VALUES (3970, 70, 'item3970');
+INSERT INTO items VALUES (3971, 71, 'item3971');
+INSERT INTO items VALUES (3972, 72, 'item3972');
+INSERT INTO items VALUES (3973, 73, 'item3973');
+INSERT INTO items VALUES (3974, 74, 'item3974');
+INSERT INTO items VALUES (3975, 75, 'item3975');
+INSERT INTO items VALUES (3976, 76, 'item3976');
+INSERT INTO items VALUES (3977, 77, 'item3977');
+INSERT INTO items VALUES (3978, 78, 'item3978');
+INSERT INTO items VALUES (3979, 79, 'item3979');
+INSERT INTO items VALUES (3980, 80, 'item3980');
+INSERT INTO items VALUES (3981, 81, 'item3981');
+INSERT INTO items VALUES (3982, 82, 'item3982');
+INSERT INTO items VALUES (3983, 83, 'item3983');
+INSERT INTO items VALUES (3984, 84, 'item3984');
+INSERT INTO items VALUES (3985, 85, 'item3985');
+INSERT INTO items VALUES (3986, 86, 'item3986');
+INSERT INTO items VALUES (3987, 87, 'item3987');
+INSERT INTO items VALUES (3988, 88, 'item3988');
+INSERT INTO items VALUES (3989, 89, 'item3989');
+INSERT INTO items VALUES (3990, 90, 'item3990');
+INSERT INTO items VALUES (3991, 91, 'item3991');
+INSERT INTO items VALUES (3992, 92, 'item3992');
+INSERT INTO items VALUES (3993, 93, 'item3993');
+INSERT INTO items VALUES (3994, 94, 'item3994');
+INSERT INTO items VALUES (3995, 95, 'item3995');
+INSERT INTO items VALUES (3996, 96, 'item3996');
+INSERT INTO items VALUES (3997, 97, 'item3997');
+INSERT INTO items VALUES (3998, 98, 'item3998');
+INSERT INTO items VALUES (3999, 99, 'item3999');
+INSERT INTO orders VALUES (0, 0, 0);
+INSERT INTO orders VALUES (1, 3919, 31);
+INSERT INTO orders VALUES (2, 3838, 62);
+INSERT INTO orders VALUES (3, 3757, 93);
+INSERT INTO orders VALUES (4, 3676, 27);
+INSERT INTO orders VALUES (5, 3595, 58);
+INSERT INTO orders VALUES (6, 3514, 89);
+INSERT INTO orders VALUES (7, 3433, 23);
+INSERT INTO orders VALUES (8, 3352, 54);
+INSERT INTO orders VALUES (9, 3271, 85);
+INSERT INTO orders VALUES (10, 3190, 19);
+INSERT INTO orders VALUES (11, 3109, 50);
+INSERT INTO orders VALUES (12, 3028, 81);
+INSERT INTO orders VALUES (13, 2947, 15);
+INSERT INTO orders VALUES (14, 2866, 46);
+INSERT INTO orders VALUES (15, 2785, 77);
+INSERT INTO orders VALUES (16, 2704, 11);
+INSERT INTO orders VALUES (17, 2623, 42);
+INSERT INTO orders VALUES (18, 2542, 73);
+INSERT INTO orders VALUES (19, 2461, 7);
+INSERT INTO orders VALUES (20, 2380, 38);
+INSERT INTO orders VALUES (21, 2299, 69);
+INSERT INTO orders VALUES (22, 2218, 3);
+INSERT INTO orders VALUES (23, 2137, 34);
+INSERT INTO orders VALUES (24, 2056, 65);
+INSERT INTO orders VALUES (25, 1975, 96);
+INSERT INTO orders VALUES (26, 1894, 30);
+INSERT INTO orders VALUES (27, 1813, 61);
+INSERT INTO orders VALUES (28, 1732, 92);
+INSERT INTO orders VALUES (29, 1651, 26);
+INSERT INTO orders VALUES (30, 1570, 57);
+INSERT INTO orders VALUES (31, 1489, 88);
+INSERT INTO orders VALUES (32, 1408, 22);
+INSERT INTO orders VALUES (33, 1327, 53);
+INSERT INTO orders VALUES (34, 1246, 84);
+INSERT INTO orders VALUES (35, 1165, 18);
+INSERT INTO orders VALUES (36, 1084, 49);
+INSERT INTO orders VALUES (37, 1003, 80);
+INSERT INTO orders VALUES (38, 922, 14);
+INSERT INTO orders VALUES (39, 841, 45);
+INSERT INTO orders VALUES (40, 760, 76);
+INSERT INTO orders VALUES (41, 679, 10);
+INSERT INTO orders VALUES (42, 598, 41);
+INSERT INTO orders VALUES (43, 517, 72);
+INSERT INTO orders VALUES (44, 436, 6);
+INSERT INTO orders VALUES (45, 355, 37);
+INSERT INTO orders VALUES (46, 274, 68);
+INSERT INTO orders VALUES (47, 193, 2);
+INSERT INTO orders VALUES (48, 112, 33);
+INSERT INTO orders VALUES (49, 31, 64);
+INSERT INTO orders VALUES (50, 3950, 95);
+INSERT INTO orders VALUES (51, 3869, 29);
+INSERT INTO orders VALUES (52, 3788, 60);
+INSERT INTO orders VALUES (53, 3707, 91);
+INSERT INTO orders VALUES (54, 3626, 25);
+INSERT INTO orders VALUES (55, 3545, 56);
+INSERT INTO orders VALUES (56, 3464, 87);
+INSERT INTO orders VALUES (57, 3383, 21);
+INSERT INTO orders VALUES (58, 3302, 52);
+INSERT INTO orders VALUES (59, 3221, 83);
+INSERT INTO orders VALUES (60, 3140, 17);
+INSERT INTO orders VALUES (61, 3059, 48);
+INSERT INTO orders VALUES (62, 2978, 79);
+INSERT INTO orders VALUES (63, 2897, 13);
+INSERT INTO orders VALUES (64, 2816, 44);
+INSERT INTO orders VALUES (65, 2735, 75);
+INSERT INTO orders VALUES (66, 2654, 9);
+INSERT INTO orders VALUES (67, 2573, 40);
+INSERT INTO orders VALUES (68, 2492, 71);
+INSERT INTO orders VALUES (69, 2411, 5);
+INSERT INTO orders VALUES (70, 2330, 36);
+INSERT INTO orders VALUES (71, 2249, 67);
+INSERT INTO orders VALUES (72, 2168, 1);
+INSERT INTO orders VALUES (73, 2087, 32);
+INSERT INTO orders VALUES (74, 2006, 63);
+INSERT INTO orders VALUES (75, 1925, 94);
+INSERT INTO orders VALUES (76, 1844, 28);
+INSERT INTO orders VALUES (77, 1763, 59);
+INSERT INTO orders VALUES (78, 1682, 90);
+INSERT INTO orders VALUES (79, 1601, 24);
+INSERT INTO orders VALUES (80, 1520, 55);
+INSERT INTO orders VALUES (81, 1439, 86);
+INSERT INTO orders VALUES (82, 1358, 20);
+INSERT INTO orders VALUES (83, 1277, 51);
+INSERT INTO orders VALUES (84, 1196, 82);
+INSERT INTO orders VALUES (85, 1115, 16);
+INSERT INTO orders VALUES (86, 1034, 47);
+INSERT INTO orders VALUES (87, 953, 78);
+INSERT INTO orders VALUES (88, 872, 12);
+INSERT INTO orders VALUES (89, 791, 43);
+INSERT INTO orders VALUES (90, 710, 74);
+INSERT INTO orders VALUES (91, 629, 8);
+INSERT INTO orders VALUES (92, 548, 39);
+INSERT INTO orders VALUES (93, 467, 70);
+INSERT INTO orders VALUES (94, 386, 4);
+INSERT INTO orders VALUES (95, 305, 35);
+INSERT INTO orders VALUES (96, 224, 66);
+INSERT INTO orders VALUES (97, 143, 0);
+INSERT INTO orders VALUES (98, 62, 31);
+INSERT INTO orders VALUES (99, 3981, 62);
+INSERT INTO orders VALUES (100, 3900, 93);
+INSERT INTO orders VALUES (101, 3819, 27);
+INSERT INTO orders VALUES (102, 3738, 58);
+INSERT INTO orders VALUES (103, 3657, 89);
+INSERT INTO orders VALUES (104, 3576, 23);
+INSERT INTO orders VALUES (105, 3495, 54);
+INSERT INTO orders VALUES (106, 3414, 85);
+INSERT INTO orders VALUES (107, 3333, 19);
+INSERT INTO orders VALUES (108, 3252, 50);
+INSERT INTO orders VALUES (109, 3171, 81);
+INSERT INTO orders VALUES (110, 3090, 15);
+INSERT INTO orders VALUES (111, 3009, 46);
+INSERT INTO orders VALUES (112, 2928, 77);
+INSERT INTO orders VALUES (113, 2847, 11);
+INSERT INTO orders VALUES (114, 2766, 42);
+INSERT INTO orders VALUES (115, 2685, 73);
+INSERT INTO orders VALUES (116, 2604, 7);
+INSERT INTO orders VALUES (117, 2523, 38);
+INSERT INTO orders VALUES (118, 2442, 69);
+INSERT INTO orders VALUES (119, 2361, 3);
+INSERT INTO orders VALUES (120, 2280, 34);
+INSERT INTO orders VALUES (121, 2199, 65);
+INSERT INTO orders VALUES (122, 2118, 96);
+INSERT INTO orders VALUES (123, 2037, 30);
+INSERT INTO orders VALUES (124, 1956, 61);
+INSERT INTO orders VALUES (125, 1875, 92);
+INSERT INTO orders VALUES (126, 1794, 26);
+INSERT INTO orders VALUES (127, 1713, 57);
+INSERT INTO orders VALUES (128, 1632, 88);
+INSERT INTO orders VALUES (129, 1551, 22);
+INSERT INTO orders VALUES (130, 1470, 53);
+INSERT INTO orders VALUES (131, 1389, 84);
+INSERT INTO orders VALUES (132, 1308, 18);
+INSERT INTO orders VALUES (133, 1227, 49);
+INSERT INTO orders VALUES (134, 1146, 80);
+INSERT INTO orders VALUES (135, 1065, 14);
+INSERT INTO orders VALUES (136, 984, 45);
+INSERT INTO orders VALUES (137, 903, 76);
+INSERT INTO orders VALUES (138, 822, 10);
+INSERT INTO orders VALUES (139, 741, 41);
+INSERT INTO orders VALUES (140, 660, 72);
+INSERT INTO orders VALUES (141, 579, 6);
+INSERT INTO orders VALUES (142, 498, 37);
+INSERT INTO orders VALUES (143, 417, 68);
+INSERT INTO orders VALUES (144, 336, 2);
+INSERT INTO orders VALUES (145, 255, 33);
+INSERT INTO orders VALUES (146, 174, 64);
+INSERT INTO orders VALUES (147, 93, 95);
+INSERT INTO orders VALUES (148, 12, 29);
+INSERT INTO orders VALUES (149, 3931, 60);
+INSERT INTO orders VALUES (150, 3850, 91);
+INSERT INTO orders VALUES (151, 3769, 25);
+INSERT INTO orders VALUES (152, 3688, 56);
+INSERT INTO orders VALUES (153, 3607, 87);
+INSERT INTO orders VALUES (154, 3526, 21);
+INSERT INTO orders VALUES (155, 3445, 52);
+INSERT INTO orders VALUES (156, 3364, 83);
+INSERT INTO orders VALUES (157, 3283, 17);
+INSERT INTO orders VALUES (158, 3202, 48);
+INSERT INTO orders VALUES (159, 3121, 79);
+INSERT INTO orders VALUES (160, 3040, 13);
+INSERT INTO orders VALUES (161, 2959, 44);
+INSERT INTO orders VALUES (162, 2878, 75);
+INSERT INTO orders VALUES (163, 2797, 9);
+INSERT INTO orders VALUES (164, 2716, 40);
+INSERT INTO orders VALUES (165, 2635, 71);
+INSERT INTO orders VALUES (166, 2554, 5);
+INSERT INTO orders VALUES (167, 2473, 36);
+INSERT INTO orders VALUES (168, 2392, 67);
+INSERT INTO orders VALUES (169, 2311, 1);
+INSERT INTO orders VALUES (170, 2230, 32);
+INSERT INTO orders VALUES (171, 2149, 63);
+INSERT INTO orders VALUES (172, 2068, 94);
+INSERT INTO orders VALUES (173, 1987, 28);
+INSERT INTO orders VALUES (174, 1906, 59);
+INSERT INTO orders VALUES (175, 1825, 90);
+INSERT INTO orders VALUES (176, 1744, 24);
+INSERT INTO orders VALUES (177, 1663, 55);
+INSERT INTO orders VALUES (178, 1582, 86);
+INSERT INTO orders VALUES (179, 1501, 20);
+INSERT INTO orders VALUES (180, 1420, 51);
+INSERT INTO orders VALUES (181, 1339, 82);
+INSERT INTO orders VALUES (182, 1258, 16);
+INSERT INTO orders VALUES (183, 1177, 47);
+INSERT INTO orders VALUES (184, 1096, 78);
+INSERT INTO orders VALUES (185, 1015, 12);
+INSERT INTO orders VALUES (186, 934, 43);
+INSERT INTO orders VALUES (187, 853, 74);
+INSERT INTO orders VALUES (188, 772, 8);
+INSERT INTO orders VALUES (189, 691, 39);
+INSERT INTO orders VALUES (190, 610, 70);
+INSERT INTO orders VALUES (191, 529, 4);
+INSERT INTO orders VALUES (192, 448, 35);
+INSERT INTO orders VALUES (193, 367, 66);
+INSERT INTO orders VALUES (194, 286, 0);
+INSERT INTO orders VALUES (195, 205, 31);
+INSERT INTO orders VALUES (196, 124, 62);
+INSERT INTO orders VALUES (197, 43, 93);
+INSERT INTO orders VALUES (198, 3962, 27);
+INSERT INTO orders VALUES (199, 3881, 58);
+INSERT INTO orders VALUES (200, 3800, 89);
+INSERT INTO orders VALUES (201, 3719, 23);
+INSERT INTO orders VALUES (202, 3638, 54);
+INSERT INTO orders VALUES (203, 3557, 85);
+INSERT INTO orders VALUES (204, 3476, 19);
+INSERT INTO orders VALUES (205, 3395, 50);
+INSERT INTO orders VALUES (206, 3314, 81);
+INSERT INTO orders VALUES (207, 3233, 15);
+INSERT INTO orders VALUES (208, 3152, 46);
+INSERT INTO orders VALUES (209, 3071, 77);
+INSERT INTO orders VALUES (210, 2990, 11);
+INSERT INTO orders VALUES (211, 2909, 42);
+INSERT INTO orders VALUES (212, 2828, 73);
+INSERT INTO orders VALUES (213, 2747, 7);
+INSERT INTO orders VALUES (214, 2666, 38);
+INSERT INTO orders VALUES (215, 2585, 69);
+INSERT INTO orders VALUES (216, 2504, 3);
+INSERT INTO orders VALUES (217, 2423, 34);
+INSERT INTO orders VALUES (218, 2342, 65);
+INSERT INTO orders VALUES (219, 2261, 96);
+INSERT INTO orders VALUES (220, 2180, 30);
+INSERT INTO orders VALUES (221, 2099, 61);
+INSERT INTO orders VALUES (222, 2018, 92);
+INSERT INTO orders VALUES (223, 1937, 26);
+INSERT INTO orders VALUES (224, 1856, 57);
+INSERT INTO orders VALUES (225, 1775, 88);
+INSERT INTO orders VALUES (226, 1694, 22);
+INSERT INTO orders VALUES (227, 1613, 53);
+INSERT INTO orders VALUES (228, 1532, 84);
+INSERT INTO orders VALUES (229, 1451, 18);
+INSERT INTO orders VALUES (230, 1370, 49);
+INSERT INTO orders VALUES (231, 1289, 80);
+INSERT INTO orders VALUES (232, 1208, 14);
+INSERT INTO orders VALUES (233, 1127, 45);
+INSERT INTO orders VALUES (234, 1046, 76);
+INSERT INTO orders VALUES (235, 965, 10);
+INSERT INTO orders VALUES (236, 884, 41);
+INSERT INTO orders VALUES (237, 803, 72);
+INSERT INTO orders VALUES (238, 722, 6);
+INSERT INTO orders VALUES (239, 641, 37);
+INSERT INTO orders VALUES (240, 560, 68);
+INSERT INTO orders VALUES (241, 479, 2);
+INSERT INTO orders VALUES (242, 398, 33);
+INSERT INTO orders VALUES (243, 317, 64);
+INSERT INTO orders VALUES (244, 236, 95);
+INSERT INTO orders VALUES (245, 155, 29);
+INSERT INTO orders VALUES (246, 74, 60);
+INSERT INTO orders VALUES (247, 3993, 91);
+INSERT INTO orders VALUES (248, 3912, 25);
+INSERT INTO orders VALUES (249, 3831, 56);
+INSERT INTO orders VALUES (250, 3750, 87);
+INSERT INTO orders VALUES (251, 3669, 21);
+INSERT INTO orders VALUES (252, 3588, 52);
+INSERT INTO orders VALUES (253, 3507, 83);
+INSERT INTO orders VALUES (254, 3426, 17);
+INSERT INTO orders VALUES (255, 3345, 48);
+INSERT INTO orders VALUES (256, 3264, 79);
+INSERT INTO orders VALUES (257, 3183, 13);
+INSERT INTO orders VALUES (258, 3102, 44);
+INSERT INTO orders VALUES (259, 3021, 75);
+INSERT INTO orders VALUES (260, 2940, 9);
+INSERT INTO orders VALUES (261, 2859, 40);
+INSERT INTO orders VALUES (262, 2778, 71);
+INSERT INTO orders VALUES (263, 2697, 5);
+INSERT INTO orders VALUES (264, 2616, 36);
+INSERT INTO orders VALUES (265, 2535, 67);
+INSERT INTO orders VALUES (266, 2454, 1);
+INSERT INTO orders VALUES (267, 2373, 32);
+INSERT INTO orders VALUES (268, 2292, 63);
+INSERT INTO orders VALUES (269, 2211, 94);
+INSERT INTO orders VALUES (270, 2130, 28);
+INSERT INTO orders VALUES (271, 2049, 59);
+INSERT INTO orders VALUES (272, 1968, 90);
+INSERT INTO orders VALUES (273, 1887, 24);
+INSERT INTO orders VALUES (274, 1806, 55);
+INSERT INTO orders VALUES (275, 1725, 86);
+INSERT INTO orders VALUES (276, 1644, 20);
+INSERT INTO orders VALUES (277, 1563, 51);
+INSERT INTO orders VALUES (278, 1482, 82);
+INSERT INTO orders VALUES (279, 1401, 16);
+INSERT INTO orders VALUES (280, 1320, 47);
+INSERT INTO orders VALUES (281, 1239, 78);
+INSERT INTO orders VALUES (282, 1158, 12);
+INSERT INTO orders VALUES (283, 1077, 43);
+INSERT INTO orders VALUES (284, 996, 74);
+INSERT INTO orders VALUES (285, 915, 8);
+INSERT INTO orders VALUES (286, 834, 39);
+INSERT INTO orders VALUES (287, 753, 70);
+INSERT INTO orders VALUES (288, 672, 4);
+INSERT INTO orders VALUES (289, 591, 35);
+INSERT INTO orders VALUES (290, 510, 66);
+INSERT INTO orders VALUES (291, 429, 0);
+INSERT INTO orders VALUES (292, 348, 31);
+INSERT INTO orders VALUES (293, 267, 62);
+INSERT INTO orders VALUES (294, 186, 93);
+INSERT INTO orders VALUES (295, 105, 27);
+INSERT INTO orders VALUES (296, 24, 58);
+INSERT INTO orders VALUES (297, 3943, 89);
+INSERT INTO orders VALUES (298, 3862, 23);
+INSERT INTO orders VALUES (299, 3781, 54);
+INSERT INTO orders VALUES (300, 3700, 85);
+INSERT INTO orders VALUES (301, 3619, 19);
+INSERT INTO orders VALUES (302, 3538, 50);
+INSERT INTO orders VALUES (303, 3457, 81);
+INSERT INTO orders VALUES (304, 3376, 15);
+INSERT INTO orders VALUES (305, 3295, 46);
+INSERT INTO orders VALUES (306, 3214, 77);
+INSERT INTO orders VALUES (307, 3133, 11);
+INSERT INTO orders VALUES (308, 3052, 42);
+INSERT INTO orders VALUES (309, 2971, 73);
+INSERT INTO orders VALUES (310, 2890, 7);
+INSERT INTO orders VALUES (311, 2809, 38);
+INSERT INTO orders VALUES (312, 2728, 69);
+INSERT INTO orders VALUES (313, 2647, 3);
+INSERT INTO orders VALUES (314, 2566, 34);
+INSERT INTO orders VALUES (315, 2485, 65);
+INSERT INTO orders VALUES (316, 2404, 96);
+INSERT INTO orders VALUES (317, 2323, 30);
+INSERT INTO orders VALUES (318, 2242, 61);
+INSERT INTO orders VALUES (319, 2161, 92);
+INSERT INTO orders VALUES (320, 2080, 26);
+INSERT INTO orders VALUES (321, 1999, 57);
+INSERT INTO orders VALUES (322, 1918, 88);
+INSERT INTO orders VALUES (323, 1837, 22);
+INSERT INTO orders VALUES (324, 1756, 53);
+INSERT INTO orders VALUES (325, 1675, 84);
+INSERT INTO orders VALUES (326, 1594, 18);
+INSERT INTO orders VALUES (327, 1513, 49);
+INSERT INTO orders VALUES (328, 1432, 80);
+INSERT INTO orders VALUES (329, 1351, 14);
+INSERT INTO orders VALUES (330, 1270, 45);
+INSERT INTO orders VALUES (331, 1189, 76);
+INSERT INTO orders VALUES (332, 1108, 10);
+INSERT INTO orders VALUES (333, 1027, 41);
+INSERT INTO orders VALUES (334, 946, 72);
+INSERT INTO orders VALUES (335, 865, 6);
+INSERT INTO orders VALUES (336, 784, 37);
+INSERT INTO orders VALUES (337, 703, 68);
+INSERT INTO orders VALUES (338, 622, 2);
+INSERT INTO orders VALUES (339, 541, 33);
+INSERT INTO orders VALUES (340, 460, 64);
+INSERT INTO orders VALUES (341, 379, 95);
+INSERT INTO orders VALUES (342, 298, 29);
+INSERT INTO orders VALUES (343, 217, 60);
+INSERT INTO orders VALUES (344, 136, 91);
+INSERT INTO orders VALUES (345, 55, 25);
+INSERT INTO orders VALUES (346, 3974, 56);
+INSERT INTO orders VALUES (347, 3893, 87);
+INSERT INTO orders VALUES (348, 3812, 21);
+INSERT INTO orders VALUES (349, 3731, 52);
+INSERT INTO orders VALUES (350, 3650, 83);
+INSERT INTO orders VALUES (351, 3569, 17);
+INSERT INTO orders VALUES (352, 3488, 48);
+INSERT INTO orders VALUES (353, 3407, 79);
+INSERT INTO orders VALUES (354, 3326, 13);
+INSERT INTO orders VALUES (355, 3245, 44);
+INSERT INTO orders VALUES (356, 3164, 75);
+INSERT INTO orders VALUES (357, 3083, 9);
+INSERT INTO orders VALUES (358, 3002, 40);
+INSERT INTO orders VALUES (359, 2921, 71);
+INSERT INTO orders VALUES (360, 2840, 5);
+INSERT INTO orders VALUES (361, 2759, 36);
+INSERT INTO orders VALUES (362, 2678, 67);
+INSERT INTO orders VALUES (363, 2597, 1);
+INSERT INTO orders VALUES (364, 2516, 32);
+INSERT INTO orders VALUES (365, 2435, 63);
+INSERT INTO orders VALUES (366, 2354, 94);
+INSERT INTO orders VALUES (367, 2273, 28);
+INSERT INTO orders VALUES (368, 2192, 59);
+INSERT INTO orders VALUES (369, 2111, 90);
+INSERT INTO orders VALUES (370, 2030, 24);
+INSERT INTO orders VALUES (371, 1949, 55);
+INSERT INTO orders VALUES (372, 1868, 86);
+INSERT INTO orders VALUES (373, 1787, 20);
+INSERT INTO orders VALUES (374, 1706, 51);
+INSERT INTO orders VALUES (375, 1625, 82);
+INSERT INTO orders VALUES (376, 1544, 16);
+INSERT INTO orders VALUES (377, 1463, 47);
+INSERT INTO orders VALUES (378, 1382, 78);
+INSERT INTO orders VALUES (379, 1301, 12);
+INSERT INTO orders VALUES (380, 1220, 43);
+INSERT INTO orders VALUES (381, 1139, 74);
+INSERT INTO orders VALUES (382, 1058, 8);
+INSERT INTO orders VALUES (383, 977, 39);
+INSERT INTO orders VALUES (384, 896, 70);
+INSERT INTO orders VALUES (385, 815, 4);
+INSERT INTO orders VALUES (386, 734, 35);
+INSERT INTO orders VALUES (387, 653, 66);
+INSERT INTO orders VALUES (388, 572, 0);
+INSERT INTO orders VALUES (389, 491, 31);
+INSERT INTO orders VALUES (390, 410, 62);
+INSERT INTO orders VALUES (391, 329, 93);
+INSERT INTO orders VALUES (392, 248, 27);
+INSERT INTO orders VALUES (393, 167, 58);
+INSERT INTO orders VALUES (394, 86, 89);
+INSERT INTO orders VALUES (395, 5, 23);
+INSERT INTO orders VALUES (396, 3924, 54);
+INSERT INTO orders VALUES (397, 3843, 85);
+INSERT INTO orders VALUES (398, 3762, 19);
+INSERT INTO orders VALUES (399, 3681, 50);
+INSERT INTO orders VALUES (400, 3600, 81);
+INSERT INTO orders VALUES (401, 3519, 15);
+INSERT INTO orders VALUES (402, 3438, 46);
+INSERT INTO orders VALUES (403, 3357, 77);
+INSERT INTO orders VALUES (404, 3276, 11);
+INSERT INTO orders VALUES (405, 3195, 42);
+INSERT INTO orders VALUES (406, 3114, 73);
+INSERT INTO orders VALUES (407, 3033, 7);
+INSERT INTO orders VALUES (408, 2952, 38);
+INSERT INTO orders VALUES (409, 2871, 69);
+INSERT INTO orders VALUES (410, 2790, 3);
+INSERT INTO orders VALUES (411, 2709, 34);
+INSERT INTO orders VALUES (412, 2628, 65);
+INSERT INTO orders VALUES (413, 2547, 96);
+INSERT INTO orders VALUES (414, 2466, 30);
+INSERT INTO orders VALUES (415, 2385, 61);
+INSERT INTO orders VALUES (416, 2304, 92);
+INSERT INTO orders VALUES (417, 2223, 26);
+INSERT INTO orders VALUES (418, 2142, 57);
+INSERT INTO orders VALUES (419, 2061, 88);
+INSERT INTO orders VALUES (420, 1980, 22);
+INSERT INTO orders VALUES (421, 1899, 53);
+INSERT INTO orders VALUES (422, 1818, 84);
+INSERT INTO orders VALUES (423, 1737, 18);
+INSERT INTO orders VALUES (424, 1656, 49);
+INSERT INTO orders VALUES (425, 1575, 80);
+INSERT INTO orders VALUES (426, 1494, 14);
+INSERT INTO orders VALUES (427, 1413, 45);
+INSERT INTO orders VALUES (428, 1332, 76);
+INSERT INTO orders VALUES (429, 1251, 10);
+INSERT INTO orders VALUES (430, 1170, 41);
+INSERT INTO orders VALUES (431, 1089, 72);
+INSERT INTO orders VALUES (432, 1008, 6);
+INSERT INTO orders VALUES (433, 927, 37);
+INSERT INTO orders VALUES (434, 846, 68);
+INSERT INTO orders VALUES (435, 765, 2);
+INSERT INTO orders VALUES (436, 684, 33);
+INSERT INTO orders VALUES (437, 603, 64);
+INSERT INTO orders VALUES (438, 522, 95);
+INSERT INTO orders VALUES (439, 441, 29);
+INSERT INTO orders VALUES (440, 360, 60);
+INSERT INTO orders VALUES (441, 279, 91);
+INSERT INTO orders VALUES (442, 198, 25);
+INSERT INTO orders VALUES (443, 117, 56);
+INSERT INTO orders VALUES (444, 36, 87);
+INSERT INTO orders VALUES (445, 3955, 21);
+INSERT INTO orders VALUES (446, 3874, 52);
+INSERT INTO orders VALUES (447, 3793, 83);
+INSERT INTO orders VALUES (448, 3712, 17);
+INSERT INTO orders VALUES (449, 3631, 48);
+INSERT INTO orders VALUES (450, 3550, 79);
+INSERT INTO orders VALUES (451, 3469, 13);
+INSERT INTO orders VALUES (452, 3388, 44);
+INSERT INTO orders VALUES (453, 3307, 75);
+INSERT INTO orders VALUES (454, 3226, 9);
+INSERT INTO orders VALUES (455, 3145, 40);
+INSERT INTO orders VALUES (456, 3064, 71);
+INSERT INTO orders VALUES (457, 2983, 5);
+INSERT INTO orders VALUES (458, 2902, 36);
+INSERT INTO orders VALUES (459, 2821, 67);
+INSERT INTO orders VALUES (460, 2740, 1);
+INSERT INTO orders VALUES (461, 2659, 32);
+INSERT INTO orders VALUES (462, 2578, 63);
+INSERT INTO orders VALUES (463, 2497, 94);
+INSERT INTO orders VALUES (464, 2416, 28);
+INSERT INTO orders VALUES (465, 2335, 59);
+INSERT INTO orders VALUES (466, 2254, 90);
+INSERT INTO orders VALUES (467, 2173, 24);
+INSERT INTO orders VALUES (468, 2092, 55);
+INSERT INTO orders VALUES (469, 2011, 86);
+INSERT INTO orders VALUES (470, 1930, 20);
+INSERT INTO orders VALUES (471, 1849, 51);
+INSERT INTO orders VALUES (472, 1768, 82);
+INSERT INTO orders VALUES (473, 1687, 16);
+INSERT INTO orders VALUES (474, 1606, 47);
+INSERT INTO orders VALUES (475, 1525, 78);
+INSERT INTO orders VALUES (476, 1444, 12);
+INSERT INTO orders VALUES (477, 1363, 43);
+INSERT INTO orders VALUES (478, 1282, 74);
+INSERT INTO orders VALUES (479, 1201, 8);
+INSERT INTO orders VALUES (480, 1120, 39);
+INSERT INTO orders VALUES (481, 1039, 70);
+INSERT INTO orders VALUES (482, 958, 4);
+INSERT INTO orders VALUES (483, 877, 35);
+INSERT INTO orders VALUES (484, 796, 66);
+INSERT INTO orders VALUES (485, 715, 0);
+INSERT INTO orders VALUES (486, 634, 31);
+INSERT INTO orders VALUES (487, 553, 62);
+INSERT INTO orders VALUES (488, 472, 93);
+INSERT INTO orders VALUES (489, 391, 27);
+INSERT INTO orders VALUES (490, 310, 58);
+INSERT INTO orders VALUES (491, 229, 89);
+INSERT INTO orders VALUES (492, 148, 23);
+INSERT INTO orders VALUES (493, 67, 54);
+INSERT INTO orders VALUES (494, 3986, 85);
+INSERT INTO orders VALUES (495, 3905, 19);
+INSERT INTO orders VALUES (496, 3824, 50);
+INSERT INTO orders VALUES (497, 3743, 81);
+INSERT INTO orders VALUES (498, 3662, 15);
+INSERT INTO orders VALUES (499, 3581, 46);
+INSERT INTO orders VALUES (500, 3500, 77);
+INSERT INTO orders VALUES (501, 3419, 11);
+INSERT INTO orders VALUES (502, 3338, 42);
+INSERT INTO orders VALUES (503, 3257, 73);
+INSERT INTO orders VALUES (504, 3176, 7);
+INSERT INTO orders VALUES (505, 3095, 38);
+INSERT INTO orders VALUES (506, 3014, 69);
+INSERT INTO orders VALUES (507, 2933, 3);
+INSERT INTO orders VALUES (508, 2852, 34);
+INSERT INTO orders VALUES (509, 2771, 65);
+INSERT INTO orders VALUES (510, 2690, 96);
+INSERT INTO orders VALUES (511, 2609, 30);
+INSERT INTO orders VALUES (512, 2528, 61);
+INSERT INTO orders VALUES (513, 2447, 92);
+INSERT INTO orders VALUES (514, 2366, 26);
+INSERT INTO orders VALUES (515, 2285, 57);
+INSERT INTO orders VALUES (516, 2204, 88);
+INSERT INTO orders VALUES (517, 2123, 22);
+INSERT INTO orders VALUES (518, 2042, 53);
+INSERT INTO orders VALUES (519, 1961, 84);
+INSERT INTO orders VALUES (520, 1880, 18);
+INSERT INTO orders VALUES (521, 1799, 49);
+INSERT INTO orders VALUES (522, 1718, 80);
+INSERT INTO orders VALUES (523, 1637, 14);
+INSERT INTO orders VALUES (524, 1556, 45);
+INSERT INTO orders VALUES (525, 1475, 76);
+INSERT INTO orders VALUES (526, 1394, 10);
+INSERT INTO orders VALUES (527, 1313, 41);
+INSERT INTO orders VALUES (528, 1232, 72);
+INSERT INTO orders VALUES (529, 1151, 6);
+INSERT INTO orders VALUES (530, 1070, 37);
+INSERT INTO orders VALUES (531, 989, 68);
+INSERT INTO orders VALUES (532, 908, 2);
+INSERT INTO orders VALUES (533, 827, 33);
+INSERT INTO orders VALUES (534, 746, 64);
+INSERT INTO orders VALUES (535, 665, 95);
+INSERT INTO orders VALUES (536, 584, 29);
+INSERT INTO orders VALUES (537, 503, 60);
+INSERT INTO orders VALUES (538, 422, 91);
+INSERT INTO orders VALUES (539, 341, 25);
+INSERT INTO orders VALUES (540, 260, 56);
+INSERT INTO orders VALUES (541, 179, 87);
+INSERT INTO orders VALUES (542, 98, 21);
+INSERT INTO orders VALUES (543, 17, 52);
+INSERT INTO orders VALUES (544, 3936, 83);
+INSERT INTO orders VALUES (545, 3855, 17);
+INSERT INTO orders VALUES (546, 3774, 48);
+INSERT INTO orders VALUES (547, 3693, 79);
+INSERT INTO orders VALUES (548, 3612, 13);
+INSERT INTO orders VALUES (549, 3531, 44);
+INSERT INTO orders VALUES (550, 3450, 75);
+INSERT INTO orders VALUES (551, 3369, 9);
+INSERT INTO orders VALUES (552, 3288, 40);
+INSERT INTO orders VALUES (553, 3207, 71);
+INSERT INTO orders VALUES (554, 3126, 5);
+INSERT INTO orders VALUES (555, 3045, 36);
+INSERT INTO orders VALUES (556, 2964, 67);
+INSERT INTO orders VALUES (557, 2883, 1);
+INSERT INTO orders VALUES (558, 2802, 32);
+INSERT INTO orders VALUES (559, 2721, 63);
+INSERT INTO orders VALUES (560, 2640, 94);
+INSERT INTO orders VALUES (561, 2559, 28);
+INSERT INTO orders VALUES (562, 2478, 59);
+INSERT INTO orders VALUES (563, 2397, 90);
+INSERT INTO orders VALUES (564, 2316, 24);
+INSERT INTO orders VALUES (565, 2235, 55);
+INSERT INTO orders VALUES (566, 2154, 86);
+INSERT INTO orders VALUES (567, 2073, 20);
+INSERT INTO orders VALUES (568, 1992, 51);
+INSERT INTO orders VALUES (569, 1911, 82);
+INSERT INTO orders VALUES (570, 1830, 16);
+INSERT INTO orders VALUES (571, 1749, 47);
+INSERT INTO orders VALUES (572, 1668, 78);
+INSERT INTO orders VALUES (573, 1587, 12);
+INSERT INTO orders VALUES (574, 1506, 43);
+INSERT INTO orders VALUES (575, 1425, 74);
+INSERT INTO orders VALUES (576, 1344, 8);
+INSERT INTO orders VALUES (577, 1263, 39);
+INSERT INTO orders VALUES (578, 1182, 70);
+INSERT INTO orders VALUES (579, 1101, 4);
+INSERT INTO orders VALUES (580, 1020, 35);
+INSERT INTO orders VALUES (581, 939, 66);
+INSERT INTO orders VALUES (582, 858, 0);
+INSERT INTO orders VALUES (583, 777, 31);
+INSERT INTO orders VALUES (584, 696, 62);
+INSERT INTO orders VALUES (585, 615, 93);
+INSERT INTO orders VALUES (586, 534, 27);
+INSERT INTO orders VALUES (587, 453, 58);
+INSERT INTO orders VALUES (588, 372, 89);
+INSERT INTO orders VALUES (589, 291, 23);
+INSERT INTO orders VALUES (590, 210, 54);
+INSERT INTO orders VALUES (591, 129, 85);
+INSERT INTO orders VALUES (592, 48, 19);
+INSERT INTO orders VALUES (593, 3967, 50);
+INSERT INTO orders VALUES (594, 3886, 81);
+INSERT INTO orders VALUES (595, 3805, 15);
+INSERT INTO orders VALUES (596, 3724, 46);
+INSERT INTO orders VALUES (597, 3643, 77);
+INSERT INTO orders VALUES (598, 3562, 11);
+INSERT INTO orders VALUES (599, 3481, 42);
+INSERT INTO orders VALUES (600, 3400, 73);
+INSERT INTO orders VALUES (601, 3319, 7);
+INSERT INTO orders VALUES (602, 3238, 38);
+INSERT INTO orders VALUES (603, 3157, 69);
+INSERT INTO orders VALUES (604, 3076, 3);
+INSERT INTO orders VALUES (605, 2995, 34);
+INSERT INTO orders VALUES (606, 2914, 65);
+INSERT INTO orders VALUES (607, 2833, 96);
+INSERT INTO orders VALUES (608, 2752, 30);
+INSERT INTO orders VALUES (609, 2671, 61);
+INSERT INTO orders VALUES (610, 2590, 92);
+INSERT INTO orders VALUES (611, 2509, 26);
+INSERT INTO orders VALUES (612, 2428, 57);
+INSERT INTO orders VALUES (613, 2347, 88);
+INSERT INTO orders VALUES (614, 2266, 22);
+INSERT INTO orders VALUES (615, 2185, 53);
+INSERT INTO orders VALUES (616, 2104, 84);
+INSERT INTO orders VALUES (617, 2023, 18);
+INSERT INTO orders VALUES (618, 1942, 49);
+INSERT INTO orders VALUES (619, 1861, 80);
+INSERT INTO orders VALUES (620, 1780, 14);
+INSERT INTO orders VALUES (621, 1699, 45);
+INSERT INTO orders VALUES (622, 1618, 76);
+INSERT INTO orders VALUES (623, 1537, 10);
+INSERT INTO orders VALUES (624, 1456, 41);
+INSERT INTO orders VALUES (625, 1375, 72);
+INSERT INTO orders VALUES (626, 1294, 6);
+INSERT INTO orders VALUES (627, 1213, 37);
+INSERT INTO orders VALUES (628, 1132, 68);
+INSERT INTO orders VALUES (629, 1051, 2);
+INSERT INTO orders VALUES (630, 970, 33);
+INSERT INTO orders VALUES (631, 889, 64);
+INSERT INTO orders VALUES (632, 808, 95);
+INSERT INTO orders VALUES (633, 727, 29);
+INSERT INTO orders VALUES (634, 646, 60);
+INSERT INTO orders VALUES (635, 565, 91);
+INSERT INTO orders VALUES (636, 484, 25);
+INSERT INTO orders VALUES (637, 403, 56);
+INSERT INTO orders VALUES (638, 322, 87);
+INSERT INTO orders VALUES (639, 241, 21);
+INSERT INTO orders VALUES (640, 160, 52);
+INSERT INTO orders VALUES (641, 79, 83);
+INSERT INTO orders VALUES (642, 3998, 17);
+INSERT INTO orders VALUES (643, 3917, 48);
+INSERT INTO orders VALUES (644, 3836, 79);
+INSERT INTO orders VALUES (645, 3755, 13);
+INSERT INTO orders VALUES (646, 3674, 44);
+INSERT INTO orders VALUES (647, 3593, 75);
+INSERT INTO orders VALUES (648, 3512, 9);
+INSERT INTO orders VALUES (649, 3431, 40);
+INSERT INTO orders VALUES (650, 3350, 71);
+INSERT INTO orders VALUES (651, 3269, 5);
+INSERT INTO orders VALUES (652, 3188, 36);
+INSERT INTO orders VALUES (653, 3107, 67);
+INSERT INTO orders VALUES (654, 3026, 1);
+INSERT INTO orders VALUES (655, 2945, 32);
+INSERT INTO orders VALUES (656, 2864, 63);
+INSERT INTO orders VALUES (657, 2783, 94);
+INSERT INTO orders VALUES (658, 2702, 28);
+INSERT INTO orders VALUES (659, 2621, 59);
+INSERT INTO orders VALUES (660, 2540, 90);
+INSERT INTO orders VALUES (661, 2459, 24);
+INSERT INTO orders VALUES (662, 2378, 55);
+INSERT INTO orders VALUES (663, 2297, 86);
+INSERT INTO orders VALUES (664, 2216, 20);
+INSERT INTO orders VALUES (665, 2135, 51);
+INSERT INTO orders VALUES (666, 2054, 82);
+INSERT INTO orders VALUES (667, 1973, 16);
+INSERT INTO orders VALUES (668, 1892, 47);
+INSERT INTO orders VALUES (669, 1811, 78);
+INSERT INTO orders VALUES (670, 1730, 12);
+INSERT INTO orders VALUES (671, 1649, 43);
+INSERT INTO orders VALUES (672, 1568, 74);
+INSERT INTO orders VALUES (673, 1487, 8);
+INSERT INTO orders VALUES (674, 1406, 39);
+INSERT INTO orders VALUES (675, 1325, 70);
+INSERT INTO orders VALUES (676, 1244, 4);
+INSERT INTO orders VALUES (677, 1163, 35);
+INSERT INTO orders VALUES (678, 1082, 66);
+INSERT INTO orders VALUES (679, 1001, 0);
+INSERT INTO orders VALUES (680, 920, 31);
+INSERT INTO orders VALUES (681, 839, 62);
+INSERT INTO orders VALUES (682, 758, 93);
+INSERT INTO orders VALUES (683, 677, 27);
+INSERT INTO orders VALUES (684, 596, 58);
+INSERT INTO orders VALUES (685, 515, 89);
+INSERT INTO orders VALUES (686, 434, 23);
+INSERT INTO orders VALUES (687, 353, 54);
+INSERT INTO orders VALUES (688, 272, 85);
+INSERT INTO orders VALUES (689, 191, 19);
+INSERT INTO orders VALUES (690, 110, 50);
+INSERT INTO orders VALUES (691, 29, 81);
+INSERT INTO orders VALUES (692, 3948, 15);
+INSERT INTO orders VALUES (693, 3867, 46);
+INSERT INTO orders VALUES (694, 3786, 77);
+INSERT INTO orders VALUES (695, 3705, 11);
+INSERT INTO orders VALUES (696, 3624, 42);
+INSERT INTO orders VALUES (697, 3543, 73);
+INSERT INTO orders VALUES (698, 3462, 7);
+INSERT INTO orders VALUES (699, 3381, 38);
+INSERT INTO orders VALUES (700, 3300, 69);
+INSERT INTO orders VALUES (701, 3219, 3);
+INSERT INTO orders VALUES (702, 3138, 34);
+INSERT INTO orders VALUES (703, 3057, 65);
+INSERT INTO orders VALUES (704, 2976, 96);
+INSERT INTO orders VALUES (705, 2895, 30);
+INSERT INTO orders VALUES (706, 2814, 61);
+INSERT INTO orders VALUES (707, 2733, 92);
+INSERT INTO orders VALUES (708, 2652, 26);
+INSERT INTO orders VALUES (709, 2571, 57);
+INSERT INTO orders VALUES (710, 2490, 88);
+INSERT INTO orders VALUES (711, 2409, 22);
+INSERT INTO orders VALUES (712, 2328, 53);
+INSERT INTO orders VALUES (713, 2247, 84);
+INSERT INTO orders VALUES (714, 2166, 18);
+INSERT INTO orders VALUES (715, 2085, 49);
+INSERT INTO orders VALUES (716, 2004, 80);
+INSERT INTO orders VALUES (717, 1923, 14);
+INSERT INTO orders VALUES (718, 1842, 45);
+INSERT INTO orders VALUES (719, 1761, 76);
+INSERT INTO orders VALUES (720, 1680, 10);
+INSERT INTO orders VALUES (721, 1599, 41);
+INSERT INTO orders VALUES (722, 1518, 72);
+INSERT INTO orders VALUES (723, 1437, 6);
+INSERT INTO orders VALUES (724, 1356, 37);
+INSERT INTO orders VALUES (725, 1275, 68);
+INSERT INTO orders VALUES (726, 1194, 2);
+INSERT INTO orders VALUES (727, 1113, 33);
+INSERT INTO orders VALUES (728, 1032, 64);
+INSERT INTO orders VALUES (729, 951, 95);
+INSERT INTO orders VALUES (730, 870, 29);
+INSERT INTO orders VALUES (731, 789, 60);
+INSERT INTO orders VALUES (732, 708, 91);
+INSERT INTO orders VALUES (733, 627, 25);
+INSERT INTO orders VALUES (734, 546, 56);
+INSERT INTO orders VALUES (735, 465, 87);
+INSERT INTO orders VALUES (736, 384, 21);
+INSERT INTO orders VALUES (737, 303, 52);
+INSERT INTO orders VALUES (738, 222, 83);
+INSERT INTO orders VALUES (739, 141, 17);
+INSERT INTO orders VALUES (740, 60, 48);
+INSERT INTO orders VALUES (741, 3979, 79);
+INSERT INTO orders VALUES (742, 3898, 13);
+INSERT INTO orders VALUES (743, 3817, 44);
+INSERT INTO orders VALUES (744, 3736, 75);
+INSERT INTO orders VALUES (745, 3655, 9);
+INSERT INTO orders VALUES (746, 3574, 40);
+INSERT INTO orders VALUES (747, 3493, 71);
+INSERT INTO orders VALUES (748, 3412, 5);
+INSERT INTO orders VALUES (749, 3331, 36);
+INSERT INTO orders VALUES (750, 3250, 67);
+INSERT INTO orders VALUES (751, 3169, 1);
+INSERT INTO orders VALUES (752, 3088, 32);
+INSERT INTO orders VALUES (753, 3007, 63);
+INSERT INTO orders VALUES (754, 2926, 94);
+INSERT INTO orders VALUES (755, 2845, 28);
+INSERT INTO orders VALUES (756, 2764, 59);
+INSERT INTO orders VALUES (757, 2683, 90);
+INSERT INTO orders VALUES (758, 2602, 24);
+INSERT INTO orders VALUES (759, 2521, 55);
+INSERT INTO orders VALUES (760, 2440, 86);
+INSERT INTO orders VALUES (761, 2359, 20);
+INSERT INTO orders VALUES (762, 2278, 51);
+INSERT INTO orders VALUES (763, 2197, 82);
+INSERT INTO orders VALUES (764, 2116, 16);
+INSERT INTO orders VALUES (765, 2035, 47);
+INSERT INTO orders VALUES (766, 1954, 78);
+INSERT INTO orders VALUES (767, 1873, 12);
+INSERT INTO orders VALUES (768, 1792, 43);
+INSERT INTO orders VALUES (769, 1711, 74);
+INSERT INTO orders VALUES (770, 1630, 8);
+INSERT INTO orders VALUES (771, 1549, 39);
+INSERT INTO orders VALUES (772, 1468, 70);
+INSERT INTO orders VALUES (773, 1387, 4);
+INSERT INTO orders VALUES (774, 1306, 35);
+INSERT INTO orders VALUES (775, 1225, 66);
+INSERT INTO orders VALUES (776, 1144, 0);
+INSERT INTO orders VALUES (777, 1063, 31);
+INSERT INTO orders VALUES (778, 982, 62);
+INSERT INTO orders VALUES (779, 901, 93);
+INSERT INTO orders VALUES (780, 820, 27);
+INSERT INTO orders VALUES (781, 739, 58);
+INSERT INTO orders VALUES (782, 658, 89);
+INSERT INTO orders VALUES (783, 577, 23);
+INSERT INTO orders VALUES (784, 496, 54);
+INSERT INTO orders VALUES (785, 415, 85);
+INSERT INTO orders VALUES (786, 334, 19);
+INSERT INTO orders VALUES (787, 253, 50);
+INSERT INTO orders VALUES (788, 172, 81);
+INSERT INTO orders VALUES (789, 91, 15);
+INSERT INTO orders VALUES (790, 10, 46);
+INSERT INTO orders VALUES (791, 3929, 77);
+INSERT INTO orders VALUES (792, 3848, 11);
+INSERT INTO orders VALUES (793, 3767, 42);
+INSERT INTO orders VALUES (794, 3686, 73);
+INSERT INTO orders VALUES (795, 3605, 7);
+INSERT INTO orders VALUES (796, 3524, 38);
+INSERT INTO orders VALUES (797, 3443, 69);
+INSERT INTO orders VALUES (798, 3362, 3);
+INSERT INTO orders VALUES (799, 3281, 34);
+INSERT INTO orders VALUES (800, 3200, 65);
+INSERT INTO orders VALUES (801, 3119, 96);
+INSERT INTO orders VALUES (802, 3038, 30);
+INSERT INTO orders VALUES (803, 2957, 61);
+INSERT INTO orders VALUES (804, 2876, 92);
+INSERT INTO orders VALUES (805, 2795, 26);
+INSERT INTO orders VALUES (806, 2714, 57);
+INSERT INTO orders VALUES (807, 2633, 88);
+INSERT INTO orders VALUES (808, 2552, 22);
+INSERT INTO orders VALUES (809, 2471, 53);
+INSERT INTO orders VALUES (810, 2390, 84);
+INSERT INTO orders VALUES (811, 2309, 18);
+INSERT INTO orders VALUES (812, 2228, 49);
+INSERT INTO orders VALUES (813, 2147, 80);
+INSERT INTO orders VALUES (814, 2066, 14);
+INSERT INTO orders VALUES (815, 1985, 45);
+INSERT INTO orders VALUES (816, 1904, 76);
+INSERT INTO orders VALUES (817, 1823, 10);
+INSERT INTO orders VALUES (818, 1742, 41);
+INSERT INTO orders VALUES (819, 1661, 72);
+INSERT INTO orders VALUES (820, 1580, 6);
+INSERT INTO orders VALUES (821, 1499, 37);
+INSERT INTO orders VALUES (822, 1418, 68);
+INSERT INTO orders VALUES (823, 1337, 2);
+INSERT INTO orders VALUES (824, 1256, 33);
+INSERT INTO orders VALUES (825, 1175, 64);
+INSERT INTO orders VALUES (826, 1094, 95);
+INSERT INTO orders VALUES (827, 1013, 29);
+INSERT INTO orders VALUES (828, 932, 60);
+INSERT INTO orders VALUES (829, 851, 91);
+INSERT INTO orders VALUES (830, 770, 25);
+INSERT INTO orders VALUES (831, 689, 56);
+INSERT INTO orders VALUES (832, 608, 87);
+INSERT INTO orders VALUES (833, 527, 21);
+INSERT INTO orders VALUES (834, 446, 52);
+INSERT INTO orders VALUES (835, 365, 83);
+INSERT INTO orders VALUES (836, 284, 17);
+INSERT INTO orders VALUES (837, 203, 48);
+INSERT INTO orders VALUES (838, 122, 79);
+INSERT INTO orders VALUES (839, 41, 13);
+INSERT INTO orders VALUES (840, 3960, 44);
+INSERT INTO orders VALUES (841, 3879, 75);
+INSERT INTO orders VALUES (842, 3798, 9);
+INSERT INTO orders VALUES (843, 3717, 40);
+INSERT INTO orders VALUES (844, 3636, 71);
+INSERT INTO orders VALUES (845, 3555, 5);
+INSERT INTO orders VALUES (846, 3474, 36);
+INSERT INTO orders VALUES (847, 3393, 67);
+INSERT INTO orders VALUES (848, 3312, 1);
+INSERT INTO orders VALUES (849, 3231, 32);
+INSERT INTO orders VALUES (850, 3150, 63);
+INSERT INTO orders VALUES (851, 3069, 94);
+INSERT INTO orders VALUES (852, 2988, 28);
+INSERT INTO orders VALUES (853, 2907, 59);
+INSERT INTO orders VALUES (854, 2826, 90);
+INSERT INTO orders VALUES (855, 2745, 24);
+INSERT INTO orders VALUES (856, 2664, 55);
+INSERT INTO orders VALUES (857, 2583, 86);
+INSERT INTO orders VALUES (858, 2502, 20);
+INSERT INTO orders VALUES (859, 2421, 51);
+INSERT INTO orders VALUES (860, 2340, 82);
+INSERT INTO orders VALUES (861, 2259, 16);
+INSERT INTO orders VALUES (862, 2178, 47);
+INSERT INTO orders VALUES (863, 2097, 78);
+INSERT INTO orders VALUES (864, 2016, 12);
+INSERT INTO orders VALUES (865, 1935, 43);
+INSERT INTO orders VALUES (866, 1854, 74);
+INSERT INTO orders VALUES (867, 1773, 8);
+INSERT INTO orders VALUES (868, 1692, 39);
+INSERT INTO orders VALUES (869, 1611, 70);
+INSERT INTO orders VALUES (870, 1530, 4);
+INSERT INTO orders VALUES (871, 1449, 35);
+INSERT INTO orders VALUES (872, 1368, 66);
+INSERT INTO orders VALUES (873, 1287, 0);
+INSERT INTO orders VALUES (874, 1206, 31);
+INSERT INTO orders VALUES (875, 1125, 62);
+INSERT INTO orders VALUES (876, 1044, 93);
+INSERT INTO orders VALUES (877, 963, 27);
+INSERT INTO orders VALUES (878, 882, 58);
+INSERT INTO orders VALUES (879, 801, 89);
+INSERT INTO orders VALUES (880, 720, 23);
+INSERT INTO orders VALUES (881, 639, 54);
+INSERT INTO orders VALUES (882, 558, 85);
+INSERT INTO orders VALUES (883, 477, 19);
+INSERT INTO orders VALUES (884, 396, 50);
+INSERT INTO orders VALUES (885, 315, 81);
+INSERT INTO orders VALUES (886, 234, 15);
+INSERT INTO orders VALUES (887, 153, 46);
+INSERT INTO orders VALUES (888, 72, 77);
+INSERT INTO orders VALUES (889, 3991, 11);
+INSERT INTO orders VALUES (890, 3910, 42);
+INSERT INTO orders VALUES (891, 3829, 73);
+INSERT INTO orders VALUES (892, 3748, 7);
+INSERT INTO orders VALUES (893, 3667, 38);
+INSERT INTO orders VALUES (894, 3586, 69);
+INSERT INTO orders VALUES (895, 3505, 3);
+INSERT INTO orders VALUES (896, 3424, 34);
+INSERT INTO orders VALUES (897, 3343, 65);
+INSERT INTO orders VALUES (898, 3262, 96);
+INSERT INTO orders VALUES (899, 3181, 30);
+INSERT INTO orders VALUES (900, 3100, 61);
+INSERT INTO orders VALUES (901, 3019, 92);
+INSERT INTO orders VALUES (902, 2938, 26);
+INSERT INTO orders VALUES (903, 2857, 57);
+INSERT INTO orders VALUES (904, 2776, 88);
+INSERT INTO orders VALUES (905, 2695, 22);
+INSERT INTO orders VALUES (906, 2614, 53);
+INSERT INTO orders VALUES (907, 2533, 84);
+INSERT INTO orders VALUES (908, 2452, 18);
+INSERT INTO orders VALUES (909, 2371, 49);
+INSERT INTO orders VALUES (910, 2290, 80);
+INSERT INTO orders VALUES (911, 2209, 14);
+INSERT INTO orders VALUES (912, 2128, 45);
+INSERT INTO orders VALUES (913, 2047, 76);
+INSERT INTO orders VALUES (914, 1966, 10);
+INSERT INTO orders VALUES (915, 1885, 41);
+INSERT INTO orders VALUES (916, 1804, 72);
+INSERT INTO orders VALUES (917, 1723, 6);
+INSERT INTO orders VALUES (918, 1642, 37);
+INSERT INTO orders VALUES (919, 1561, 68);
+INSERT INTO orders VALUES (920, 1480, 2);
+INSERT INTO orders VALUES (921, 1399, 33);
+INSERT INTO orders VALUES (922, 1318, 64);
+INSERT INTO orders VALUES (923, 1237, 95);
+INSERT INTO orders VALUES (924, 1156, 29);
+INSERT INTO orders VALUES (925, 1075, 60);
+INSERT INTO orders VALUES (926, 994, 91);
+INSERT INTO orders VALUES (927, 913, 25);
+INSERT INTO orders VALUES (928, 832, 56);
+INSERT INTO orders VALUES (929, 751, 87);
+INSERT INTO orders VALUES (930, 670, 21);
+INSERT INTO orders VALUES (931, 589, 52);
+INSERT INTO orders VALUES (932, 508, 83);
+INSERT INTO orders VALUES (933, 427, 17);
+INSERT INTO orders VALUES (934, 346, 48);
+INSERT INTO orders VALUES (935, 265, 79);
+INSERT INTO orders VALUES (936, 184, 13);
+INSERT INTO orders VALUES (937, 103, 44);
+INSERT INTO orders VALUES (938, 22, 75);
+INSERT INTO orders VALUES (939, 3941, 9);
+INSERT INTO orders VALUES (940, 3860, 40);
+INSERT INTO orders VALUES (941, 3779, 71);
+INSERT INTO orders VALUES (942, 3698, 5);
+INSERT INTO orders VALUES (943, 3617, 36);
+INSERT INTO orders VALUES (944, 3536, 67);
+INSERT INTO orders VALUES (945, 3455, 1);
+INSERT INTO orders VALUES (946, 3374, 32);
+INSERT INTO orders VALUES (947, 3293, 63);
+INSERT INTO orders VALUES (948, 3212, 94);
+INSERT INTO orders VALUES (949, 3131, 28);
+INSERT INTO orders VALUES (950, 3050, 59);
+INSERT INTO orders VALUES (951, 2969, 90);
+INSERT INTO orders VALUES (952, 2888, 24);
+INSERT INTO orders VALUES (953, 2807, 55);
+INSERT INTO orders VALUES (954, 2726, 86);
+INSERT INTO orders VALUES (955, 2645, 20);
+INSERT INTO orders VALUES (956, 2564, 51);
+INSERT INTO orders VALUES (957, 2483, 82);
+INSERT INTO orders VALUES (958, 2402, 16);
+INSERT INTO orders VALUES (959, 2321, 47);
+INSERT INTO orders VALUES (960, 2240, 78);
+INSERT INTO orders VALUES (961, 2159, 12);
+INSERT INTO orders VALUES (962, 2078, 43);
+INSERT INTO orders VALUES (963, 1997, 74);
+INSERT INTO orders VALUES (964, 1916, 8);
+INSERT INTO orders VALUES (965, 1835, 39);
+INSERT INTO orders VALUES (966, 1754, 70);
+INSERT INTO orders VALUES (967, 1673, 4);
+INSERT INTO orders VALUES (968, 1592, 35);
+INSERT INTO orders VALUES (969, 1511, 66);
+INSERT INTO orders VALUES (970, 1430, 0);
+INSERT INTO orders VALUES (971, 1349, 31);
+INSERT INTO orders VALUES (972, 1268, 62);
+INSERT INTO orders VALUES (973, 1187, 93);
+INSERT INTO orders VALUES (974, 1106, 27);
+INSERT INTO orders VALUES (975, 1025, 58);
+INSERT INTO orders VALUES (976, 944, 89);
+INSERT INTO orders VALUES (977, 863, 23);
+INSERT INTO orders VALUES (978, 782, 54);
+INSERT INTO orders VALUES (979, 701, 85);
+INSERT INTO orders VALUES (980, 620, 19);
+INSERT INTO orders VALUES (981, 539, 50);
+INSERT INTO orders VALUES (982, 458, 81);
+INSERT INTO orders VALUES (983, 377, 15);
+INSERT INTO orders VALUES (984, 296, 46);
+INSERT INTO orders VALUES (985, 215, 77);
+INSERT INTO orders VALUES (986, 134, 11);
+INSERT INTO orders VALUES (987, 53, 42);
+INSERT INTO orders VALUES (988, 3972, 73);
+INSERT INTO orders VALUES (989, 3891, 7);
+INSERT INTO orders VALUES (990, 3810, 38);
+INSERT INTO orders VALUES (991, 3729, 69);
+INSERT INTO orders VALUES (992, 3648, 3);
+INSERT INTO orders VALUES (993, 3567, 34);
+INSERT INTO orders VALUES (994, 3486, 65);
+INSERT INTO orders VALUES (995, 3405, 96);
+INSERT INTO orders VALUES (996, 3324, 30);
+INSERT INTO orders VALUES (997, 3243, 61);
+INSERT INTO orders VALUES (998, 3162, 92);
+INSERT INTO orders VALUES (999, 3081, 26);
+INSERT INTO orders VALUES (1000, 3000, 57);
+INSERT INTO orders VALUES (1001, 2919, 88);
+INSERT INTO orders VALUES (1002, 2838, 22);
+INSERT INTO orders VALUES (1003, 2757, 53);
+INSERT INTO orders VALUES (1004, 2676, 84);
+INSERT INTO orders VALUES (1005, 2595, 18);
+INSERT INTO orders VALUES (1006, 2514, 49);
+INSERT INTO orders VALUES (1007, 2433, 80);
+INSERT INTO orders VALUES (1008, 2352, 14);
+INSERT INTO orders VALUES (1009, 2271, 45);
+INSERT INTO orders VALUES (1010, 2190, 76);
+INSERT INTO orders VALUES (1011, 2109, 10);
+INSERT INTO orders VALUES (1012, 2028, 41);
+INSERT INTO orders VALUES (1013, 1947, 72);
+INSERT INTO orders VALUES (1014, 1866, 6);
+INSERT INTO orders VALUES (1015, 1785, 37);
+INSERT INTO orders VALUES (1016, 1704, 68);
+INSERT INTO orders VALUES (1017, 1623, 2);
+INSERT INTO orders VALUES (1018, 1542, 33);
+INSERT INTO orders VALUES (1019, 1461, 64);
+INSERT INTO orders VALUES (1020, 1380, 95);
+INSERT INTO orders VALUES (1021, 1299, 29);
+INSERT INTO orders VALUES (1022, 1218, 60);
+INSERT INTO orders VALUES (1023, 1137, 91);
+INSERT INTO orders VALUES (1024, 1056, 25);
+INSERT INTO orders VALUES (1025, 975, 56);
+INSERT INTO orders VALUES (1026, 894, 87);
+INSERT INTO orders VALUES (1027, 813, 21);
+INSERT INTO orders VALUES (1028, 732, 52);
+INSERT INTO orders VALUES (1029, 651, 83);
+INSERT INTO orders VALUES (1030, 570, 17);
+INSERT INTO orders VALUES (1031, 489, 48);
+INSERT INTO orders VALUES (1032, 408, 79);
+INSERT INTO orders VALUES (1033, 327, 13);
+INSERT INTO orders VALUES (1034, 246, 44);
+INSERT INTO orders VALUES (1035, 165, 75);
+INSERT INTO orders VALUES (1036, 84, 9);
+INSERT INTO orders VALUES (1037, 3, 40);
+INSERT INTO orders VALUES (1038, 3922, 71);
+INSERT INTO orders VALUES (1039, 3841, 5);
+INSERT INTO orders VALUES (1040, 3760, 36);
+INSERT INTO orders VALUES (1041, 3679, 67);
+INSERT INTO orders VALUES (1042, 3598, 1);
+INSERT INTO orders VALUES (1043, 3517, 32);
+INSERT INTO orders VALUES (1044, 3436, 63);
+INSERT INTO orders VALUES (1045, 3355, 94);
+INSERT INTO orders VALUES (1046, 3274, 28);
+INSERT INTO orders VALUES (1047, 3193, 59);
+INSERT INTO orders VALUES (1048, 3112, 90);
+INSERT INTO orders VALUES (1049, 3031, 24);
+INSERT INTO orders VALUES (1050, 2950, 55);
+INSERT INTO orders VALUES (1051, 2869, 86);
+INSERT INTO orders VALUES (1052, 2788, 20);
+INSERT INTO orders VALUES (1053, 2707, 51);
+INSERT INTO orders VALUES (1054, 2626, 82);
+INSERT INTO orders VALUES (1055, 2545, 16);
+INSERT INTO orders VALUES (1056, 2464, 47);
+INSERT INTO orders VALUES (1057, 2383, 78);
+INSERT INTO orders VALUES (1058, 2302, 12);
+INSERT INTO orders VALUES (1059, 2221, 43);
+INSERT INTO orders VALUES (1060, 2140, 74);
+INSERT INTO orders VALUES (1061, 2059, 8);
+INSERT INTO orders VALUES (1062, 1978, 39);
+INSERT INTO orders VALUES (1063, 1897, 70);
+INSERT INTO orders VALUES (1064, 1816, 4);
+INSERT INTO orders VALUES (1065, 1735, 35);
+INSERT INTO orders VALUES (1066, 1654, 66);
+INSERT INTO orders VALUES (1067, 1573, 0);
+INSERT INTO orders VALUES (1068, 1492, 31);
+INSERT INTO orders VALUES (1069, 1411, 62);
+INSERT INTO orders VALUES (1070, 1330, 93);
+INSERT INTO orders VALUES (1071, 1249, 27);
+INSERT INTO orders VALUES (1072, 1168, 58);
+INSERT INTO orders VALUES (1073, 1087, 89);
+INSERT INTO orders VALUES (1074, 1006, 23);
+INSERT INTO orders VALUES (1075, 925, 54);
+INSERT INTO orders VALUES (1076, 844, 85);
+INSERT INTO orders VALUES (1077, 763, 19);
+INSERT INTO orders VALUES (1078, 682, 50);
+INSERT INTO orders VALUES (1079, 601, 81);
+INSERT INTO orders VALUES (1080, 520, 15);
+INSERT INTO orders VALUES (1081, 439, 46);
+INSERT INTO orders VALUES (1082, 358, 77);
+INSERT INTO orders VALUES (1083, 277, 11);
+INSERT INTO orders VALUES (1084, 196, 42);
+INSERT INTO orders VALUES (1085, 115, 73);
+INSERT INTO orders VALUES (1086, 34, 7);
+INSERT INTO orders VALUES (1087, 3953, 38);
+INSERT INTO orders VALUES (1088, 3872, 69);
+INSERT INTO orders VALUES (1089, 3791, 3);
+INSERT INTO orders VALUES (1090, 3710, 34);
+INSERT INTO orders VALUES (1091, 3629, 65);
+INSERT INTO orders VALUES (1092, 3548, 96);
+INSERT INTO orders VALUES (1093, 3467, 30);
+INSERT INTO orders VALUES (1094, 3386, 61);
+INSERT INTO orders VALUES (1095, 3305, 92);
+INSERT INTO orders VALUES (1096, 3224, 26);
+INSERT INTO orders VALUES (1097, 3143, 57);
+INSERT INTO orders VALUES (1098, 3062, 88);
+INSERT INTO orders VALUES (1099, 2981, 22);
+INSERT INTO orders VALUES (1100, 2900, 53);
+INSERT INTO orders VALUES (1101, 2819, 84);
+INSERT INTO orders VALUES (1102, 2738, 18);
+INSERT INTO orders VALUES (1103, 2657, 49);
+INSERT INTO orders VALUES (1104, 2576, 80);
+INSERT INTO orders VALUES (1105, 2495, 14);
+INSERT INTO orders VALUES (1106, 2414, 45);
+INSERT INTO orders VALUES (1107, 2333, 76);
+INSERT INTO orders VALUES (1108, 2252, 10);
+INSERT INTO orders VALUES (1109, 2171, 41);
+INSERT INTO orders VALUES (1110, 2090, 72);
+INSERT INTO orders VALUES (1111, 2009, 6);
+INSERT INTO orders VALUES (1112, 1928, 37);
+INSERT INTO orders VALUES (1113, 1847, 68);
+INSERT INTO orders VALUES (1114, 1766, 2);
+INSERT INTO orders VALUES (1115, 1685, 33);
+INSERT INTO orders VALUES (1116, 1604, 64);
+INSERT INTO orders VALUES (1117, 1523, 95);
+INSERT INTO orders VALUES (1118, 1442, 29);
+INSERT INTO orders VALUES (1119, 1361, 60);
+INSERT INTO orders VALUES (1120, 1280, 91);
+INSERT INTO orders VALUES (1121, 1199, 25);
+INSERT INTO orders VALUES (1122, 1118, 56);
+INSERT INTO orders VALUES (1123, 1037, 87);
+INSERT INTO orders VALUES (1124, 956, 21);
+INSERT INTO orders VALUES (1125, 875, 52);
+INSERT INTO orders VALUES (1126, 794, 83);
+INSERT INTO orders VALUES (1127, 713, 17);
+INSERT INTO orders VALUES (1128, 632, 48);
+INSERT INTO orders VALUES (1129, 551, 79);
+INSERT INTO orders VALUES (1130, 470, 13);
+INSERT INTO orders VALUES (1131, 389, 44);
+INSERT INTO orders VALUES (1132, 308, 75);
+INSERT INTO orders VALUES (1133, 227, 9);
+INSERT INTO orders VALUES (1134, 146, 40);
+INSERT INTO orders VALUES (1135, 65, 71);
+INSERT INTO orders VALUES (1136, 3984, 5);
+INSERT INTO orders VALUES (1137, 3903, 36);
+INSERT INTO orders VALUES (1138, 3822, 67);
+INSERT INTO orders VALUES (1139, 3741, 1);
+INSERT INTO orders VALUES (1140, 3660, 32);
+INSERT INTO orders VALUES (1141, 3579, 63);
+INSERT INTO orders VALUES (1142, 3498, 94);
+INSERT INTO orders VALUES (1143, 3417, 28);
+INSERT INTO orders VALUES (1144, 3336, 59);
+INSERT INTO orders VALUES (1145, 3255, 90);
+INSERT INTO orders VALUES (1146, 3174, 24);
+INSERT INTO orders VALUES (1147, 3093, 55);
+INSERT INTO orders VALUES (1148, 3012, 86);
+INSERT INTO orders VALUES (1149, 2931, 20);
+INSERT INTO orders VALUES (1150, 2850, 51);
+INSERT INTO orders VALUES (1151, 2769, 82);
+INSERT INTO orders VALUES (1152, 2688, 16);
+INSERT INTO orders VALUES (1153, 2607, 47);
+INSERT INTO orders VALUES (1154, 2526, 78);
+INSERT INTO orders VALUES (1155, 2445, 12);
+INSERT INTO orders VALUES (1156, 2364, 43);
+INSERT INTO orders VALUES (1157, 2283, 74);
+INSERT INTO orders VALUES (1158, 2202, 8);
+INSERT INTO orders VALUES (1159, 2121, 39);
+INSERT INTO orders VALUES (1160, 2040, 70);
+INSERT INTO orders VALUES (1161, 1959, 4);
+INSERT INTO orders VALUES (1162, 1878, 35);
+INSERT INTO orders VALUES (1163, 1797, 66);
+INSERT INTO orders VALUES (1164, 1716, 0);
+INSERT INTO orders VALUES (1165, 1635, 31);
+INSERT INTO orders VALUES (1166, 1554, 62);
+INSERT INTO orders VALUES (1167, 1473, 93);
+INSERT INTO orders VALUES (1168, 1392, 27);
+INSERT INTO orders VALUES (1169, 1311, 58);
+INSERT INTO orders VALUES (1170, 1230, 89);
+INSERT INTO orders VALUES (1171, 1149, 23);
+INSERT INTO orders VALUES (1172, 1068, 54);
+INSERT INTO orders VALUES (1173, 987, 85);
+INSERT INTO orders VALUES (1174, 906, 19);
+INSERT INTO orders VALUES (1175, 825, 50);
+INSERT INTO orders VALUES (1176, 744, 81);
+INSERT INTO orders VALUES (1177, 663, 15);
+INSERT INTO orders VALUES (1178, 582, 46);
+INSERT INTO orders VALUES (1179, 501, 77);
+INSERT INTO orders VALUES (1180, 420, 11);
+INSERT INTO orders VALUES (1181, 339, 42);
+INSERT INTO orders VALUES (1182, 258, 73);
+INSERT INTO orders VALUES (1183, 177, 7);
+INSERT INTO orders VALUES (1184, 96, 38);
+INSERT INTO orders VALUES (1185, 15, 69);
+INSERT INTO orders VALUES (1186, 3934, 3);
+INSERT INTO orders VALUES (1187, 3853, 34);
+INSERT INTO orders VALUES (1188, 3772, 65);
+INSERT INTO orders VALUES (1189, 3691, 96);
+INSERT INTO orders VALUES (1190, 3610, 30);
+INSERT INTO orders VALUES (1191, 3529, 61);
+INSERT INTO orders VALUES (1192, 3448, 92);
+INSERT INTO orders VALUES (1193, 3367, 26);
+INSERT INTO orders VALUES (1194, 3286, 57);
+INSERT INTO orders VALUES (1195, 3205, 88);
+INSERT INTO orders VALUES (1196, 3124, 22);
+INSERT INTO orders VALUES (1197, 3043, 53);
+INSERT INTO orders VALUES (1198, 2962, 84);
+INSERT INTO orders VALUES (1199, 2881, 18);
+INSERT INTO orders VALUES (1200, 2800, 49);
+INSERT INTO orders VALUES (1201, 2719, 80);
+INSERT INTO orders VALUES (1202, 2638, 14);
+INSERT INTO orders VALUES (1203, 2557, 45);
+INSERT INTO orders VALUES (1204, 2476, 76);
+INSERT INTO orders VALUES (1205, 2395, 10);
+INSERT INTO orders VALUES (1206, 2314, 41);
+INSERT INTO orders VALUES (1207, 2233, 72);
+INSERT INTO orders VALUES (1208, 2152, 6);
+INSERT INTO orders VALUES (1209, 2071, 37);
+INSERT INTO orders VALUES (1210, 1990, 68);
+INSERT INTO orders VALUES (1211, 1909, 2);
+INSERT INTO orders VALUES (1212, 1828, 33);
+INSERT INTO orders VALUES (1213, 1747, 64);
+INSERT INTO orders VALUES (1214, 1666, 95);
+INSERT INTO orders VALUES (1215, 1585, 29);
+INSERT INTO orders VALUES (1216, 1504, 60);
+INSERT INTO orders VALUES (1217, 1423, 91);
+INSERT INTO orders VALUES (1218, 1342, 25);
+INSERT INTO orders VALUES (1219, 1261, 56);
+INSERT INTO orders VALUES (1220, 1180, 87);
+INSERT INTO orders VALUES (1221, 1099, 21);
+INSERT INTO orders VALUES (1222, 1018, 52);
+INSERT INTO orders VALUES (1223, 937, 83);
+INSERT INTO orders VALUES (1224, 856, 17);
+INSERT INTO orders VALUES (1225, 775, 48);
+INSERT INTO orders VALUES (1226, 694, 79);
+INSERT INTO orders VALUES (1227, 613, 13);
+INSERT INTO orders VALUES (1228, 532, 44);
+INSERT INTO orders VALUES (1229, 451, 75);
+INSERT INTO orders VALUES (1230, 370, 9);
+INSERT INTO orders VALUES (1231, 289, 40);
+INSERT INTO orders VALUES (1232, 208, 71);
+INSERT INTO orders VALUES (1233, 127, 5);
+INSERT INTO orders VALUES (1234, 46, 36);
+INSERT INTO orders VALUES (1235, 3965, 67);
+INSERT INTO orders VALUES (1236, 3884, 1);
+INSERT INTO orders VALUES (1237, 3803, 32);
+INSERT INTO orders VALUES (1238, 3722, 63);
+INSERT INTO orders VALUES (1239, 3641, 94);
+INSERT INTO orders VALUES (1240, 3560, 28);
+INSERT INTO orders VALUES (1241, 3479, 59);
+INSERT INTO orders VALUES (1242, 3398, 90);
+INSERT INTO orders VALUES (1243, 3317, 24);
+INSERT INTO orders VALUES (1244, 3236, 55);
+INSERT INTO orders VALUES (1245, 3155, 86);
+INSERT INTO orders VALUES (1246, 3074, 20);
+INSERT INTO orders VALUES (1247, 2993, 51);
+INSERT INTO orders VALUES (1248, 2912, 82);
+INSERT INTO orders VALUES (1249, 2831, 16);
+INSERT INTO orders VALUES (1250, 2750, 47);
+INSERT INTO orders VALUES (1251, 2669, 78);
+INSERT INTO orders VALUES (1252, 2588, 12);
+INSERT INTO orders VALUES (1253, 2507, 43);
+INSERT INTO orders VALUES (1254, 2426, 74);
+INSERT INTO orders VALUES (1255, 2345, 8);
+INSERT INTO orders VALUES (1256, 2264, 39);
+INSERT INTO orders VALUES (1257, 2183, 70);
+INSERT INTO orders VALUES (1258, 2102, 4);
+INSERT INTO orders VALUES (1259, 2021, 35);
+INSERT INTO orders VALUES (1260, 1940, 66);
+INSERT INTO orders VALUES (1261, 1859, 0);
+INSERT INTO orders VALUES (1262, 1778, 31);
+INSERT INTO orders VALUES (1263, 1697, 62);
+INSERT INTO orders VALUES (1264, 1616, 93);
+INSERT INTO orders VALUES (1265, 1535, 27);
+INSERT INTO orders VALUES (1266, 1454, 58);
+INSERT INTO orders VALUES (1267, 1373, 89);
+INSERT INTO orders VALUES (1268, 1292, 23);
+INSERT INTO orders VALUES (1269, 1211, 54);
+INSERT INTO orders VALUES (1270, 1130, 85);
+INSERT INTO orders VALUES (1271, 1049, 19);
+INSERT INTO orders VALUES (1272, 968, 50);
+INSERT INTO orders VALUES (1273, 887, 81);
+INSERT INTO orders VALUES (1274, 806, 15);
+INSERT INTO orders VALUES (1275, 725, 46);
+INSERT INTO orders VALUES (1276, 644, 77);
+INSERT INTO orders VALUES (1277, 563, 11);
+INSERT INTO orders VALUES (1278, 482, 42);
+INSERT INTO orders VALUES (1279, 401, 73);
+INSERT INTO orders VALUES (1280, 320, 7);
+INSERT INTO orders VALUES (1281, 239, 38);
+INSERT INTO orders VALUES (1282, 158, 69);
+INSERT INTO orders VALUES (1283, 77, 3);
+INSERT INTO orders VALUES (1284, 3996, 34);
+INSERT INTO orders VALUES (1285, 3915, 65);
+INSERT INTO orders VALUES (1286, 3834, 96);
+INSERT INTO orders VALUES (1287, 3753, 30);
+INSERT INTO orders VALUES (1288, 3672, 61);
+INSERT INTO orders VALUES (1289, 3591, 92);
+INSERT INTO orders VALUES (1290, 3510, 26);
+INSERT INTO orders VALUES (1291, 3429, 57);
+INSERT INTO orders VALUES (1292, 3348, 88);
+INSERT INTO orders VALUES (1293, 3267, 22);
+INSERT INTO orders VALUES (1294, 3186, 53);
+INSERT INTO orders VALUES (1295, 3105, 84);
+INSERT INTO orders VALUES (1296, 3024, 18);
+INSERT INTO orders VALUES (1297, 2943, 49);
+INSERT INTO orders VALUES (1298, 2862, 80);
+INSERT INTO orders VALUES (1299, 2781, 14);
+INSERT INTO orders VALUES (1300, 2700, 45);
+INSERT INTO orders VALUES (1301, 2619, 76);
+INSERT INTO orders VALUES (1302, 2538, 10);
+INSERT INTO orders VALUES (1303, 2457, 41);
+INSERT INTO orders VALUES (1304, 2376, 72);
+INSERT INTO orders VALUES (1305, 2295, 6);
+INSERT INTO orders VALUES (1306, 2214, 37);
+INSERT INTO orders VALUES (1307, 2133, 68);
+INSERT INTO orders VALUES (1308, 2052, 2);
+INSERT INTO orders VALUES (1309, 1971, 33);
+INSERT INTO orders VALUES (1310, 1890, 64);
+INSERT INTO orders VALUES (1311, 1809, 95);
+INSERT INTO orders VALUES (1312, 1728, 29);
+INSERT INTO orders VALUES (1313, 1647, 60);
+INSERT INTO orders VALUES (1314, 1566, 91);
+INSERT INTO orders VALUES (1315, 1485, 25);
+INSERT INTO orders VALUES (1316, 1404, 56);
+INSERT INTO orders VALUES (1317, 1323, 87);
+INSERT INTO orders VALUES (1318, 1242, 21);
+INSERT INTO orders VALUES (1319, 1161, 52);
+INSERT INTO orders VALUES (1320, 1080, 83);
+INSERT INTO orders VALUES (1321, 999, 17);
+INSERT INTO orders VALUES (1322, 918, 48);
+INSERT INTO orders VALUES (1323, 837, 79);
+INSERT INTO orders VALUES (1324, 756, 13);
+INSERT INTO orders VALUES (1325, 675, 44);
+INSERT INTO orders VALUES (1326, 594, 75);
+INSERT INTO orders VALUES (1327, 513, 9);
+INSERT INTO orders VALUES (1328, 432, 40);
+INSERT INTO orders VALUES (1329, 351, 71);
+INSERT INTO orders VALUES (1330, 270, 5);
+INSERT INTO orders VALUES (1331, 189, 36);
+INSERT INTO orders VALUES (1332, 108, 67);
+INSERT INTO orders VALUES (1333, 27, 1);
+INSERT INTO orders VALUES (1334, 3946, 32);
+INSERT INTO orders VALUES (1335, 3865, 63);
+INSERT INTO orders VALUES (1336, 3784, 94);
+INSERT INTO orders VALUES (1337, 3703, 28);
+INSERT INTO orders VALUES (1338, 3622, 59);
+INSERT INTO orders VALUES (1339, 3541, 90);
+INSERT INTO orders VALUES (1340, 3460, 24);
+INSERT INTO orders VALUES (1341, 3379, 55);
+INSERT INTO orders VALUES (1342, 3298, 86);
+INSERT INTO orders VALUES (1343, 3217, 20);
+INSERT INTO orders VALUES (1344, 3136, 51);
+INSERT INTO orders VALUES (1345, 3055, 82);
+INSERT INTO orders VALUES (1346, 2974, 16);
+INSERT INTO orders VALUES (1347, 2893, 47);
+INSERT INTO orders VALUES (1348, 2812, 78);
+INSERT INTO orders VALUES (1349, 2731, 12);
+INSERT INTO orders VALUES (1350, 2650, 43);
+INSERT INTO orders VALUES (1351, 2569, 74);
+INSERT INTO orders VALUES (1352, 2488, 8);
+INSERT INTO orders VALUES (1353, 2407, 39);
+INSERT INTO orders VALUES (1354, 2326, 70);
+INSERT INTO orders VALUES (1355, 2245, 4);
+INSERT INTO orders VALUES (1356, 2164, 35);
+INSERT INTO orders VALUES (1357, 2083, 66);
+INSERT INTO orders VALUES (1358, 2002, 0);
+INSERT INTO orders VALUES (1359, 1921, 31);
+INSERT INTO orders VALUES (1360, 1840, 62);
+INSERT INTO orders VALUES (1361, 1759, 93);
+INSERT INTO orders VALUES (1362, 1678, 27);
+INSERT INTO orders VALUES (1363, 1597, 58);
+INSERT INTO orders VALUES (1364, 1516, 89);
+INSERT INTO orders VALUES (1365, 1435, 23);
+INSERT INTO orders VALUES (1366, 1354, 54);
+INSERT INTO orders VALUES (1367, 1273, 85);
+INSERT INTO orders VALUES (1368, 1192, 19);
+INSERT INTO orders VALUES (1369, 1111, 50);
+INSERT INTO orders VALUES (1370, 1030, 81);
+INSERT INTO orders VALUES (1371, 949, 15);
+INSERT INTO orders VALUES (1372, 868, 46);
+INSERT INTO orders VALUES (1373, 787, 77);
+INSERT INTO orders VALUES (1374, 706, 11);
+INSERT INTO orders VALUES (1375, 625, 42);
+INSERT INTO orders VALUES (1376, 544, 73);
+INSERT INTO orders VALUES (1377, 463, 7);
+INSERT INTO orders VALUES (1378, 382, 38);
+INSERT INTO orders VALUES (1379, 301, 69);
+INSERT INTO orders VALUES (1380, 220, 3);
+INSERT INTO orders VALUES (1381, 139, 34);
+INSERT INTO orders VALUES (1382, 58, 65);
+INSERT INTO orders VALUES (1383, 3977, 96);
+INSERT INTO orders VALUES (1384, 3896, 30);
+INSERT INTO orders VALUES (1385, 3815, 61);
+INSERT INTO orders VALUES (1386, 3734, 92);
+INSERT INTO orders VALUES (1387, 3653, 26);
+INSERT INTO orders VALUES (1388, 3572, 57);
+INSERT INTO orders VALUES (1389, 3491, 88);
+INSERT INTO orders VALUES (1390, 3410, 22);
+INSERT INTO orders VALUES (1391, 3329, 53);
+INSERT INTO orders VALUES (1392, 3248, 84);
+INSERT INTO orders VALUES (1393, 3167, 18);
+INSERT INTO orders VALUES (1394, 3086, 49);
+INSERT INTO orders VALUES (1395, 3005, 80);
+INSERT INTO orders VALUES (1396, 2924, 14);
+INSERT INTO orders VALUES (1397, 2843, 45);
+INSERT INTO orders VALUES (1398, 2762, 76);
+INSERT INTO orders VALUES (1399, 2681, 10);
+INSERT INTO orders VALUES (1400, 2600, 41);
+INSERT INTO orders VALUES (1401, 2519, 72);
+INSERT INTO orders VALUES (1402, 2438, 6);
+INSERT INTO orders VALUES (1403, 2357, 37);
+INSERT INTO orders VALUES (1404, 2276, 68);
+INSERT INTO orders VALUES (1405, 2195, 2);
+INSERT INTO orders VALUES (1406, 2114, 33);
+INSERT INTO orders VALUES (1407, 2033, 64);
+INSERT INTO orders VALUES (1408, 1952, 95);
+INSERT INTO orders VALUES (1409, 1871, 29);
+INSERT INTO orders VALUES (1410, 1790, 60);
+INSERT INTO orders VALUES (1411, 1709, 91);
+INSERT INTO orders VALUES (1412, 1628, 25);
+INSERT INTO orders VALUES (1413, 1547, 56);
+INSERT INTO orders VALUES (1414, 1466, 87);
+INSERT INTO orders VALUES (1415, 1385, 21);
+INSERT INTO orders VALUES (1416, 1304, 52);
+INSERT INTO orders VALUES (1417, 1223, 83);
+INSERT INTO orders VALUES (1418, 1142, 17);
+INSERT INTO orders VALUES (1419, 1061, 48);
+INSERT INTO orders VALUES (1420, 980, 79);
+INSERT INTO orders VALUES (1421, 899, 13);
+INSERT INTO orders VALUES (1422, 818, 44);
+INSERT INTO orders VALUES (1423, 737, 75);
+INSERT INTO orders VALUES (1424, 656, 9);
+INSERT INTO orders VALUES (1425, 575, 40);
+INSERT INTO orders VALUES (1426, 494, 71);
+INSERT INTO orders VALUES (1427, 413, 5);
+INSERT INTO orders VALUES (1428, 332, 36);
+INSERT INTO orders VALUES (1429, 251, 67);
+INSERT INTO orders VALUES (1430, 170, 1);
+INSERT INTO orders VALUES (1431, 89, 32);
+INSERT INTO orders VALUES (1432, 8, 63);
+INSERT INTO orders VALUES (1433, 3927, 94);
+INSERT INTO orders VALUES (1434, 3846, 28);
+INSERT INTO orders VALUES (1435, 3765, 59);
+INSERT INTO orders VALUES (1436, 3684, 90);
+INSERT INTO orders VALUES (1437, 3603, 24);
+INSERT INTO orders VALUES (1438, 3522, 55);
+INSERT INTO orders VALUES (1439, 3441, 86);
+INSERT INTO orders VALUES (1440, 3360, 20);
+INSERT INTO orders VALUES (1441, 3279, 51);
+INSERT INTO orders VALUES (1442, 3198, 82);
+INSERT INTO orders VALUES (1443, 3117, 16);
+INSERT INTO orders VALUES (1444, 3036, 47);
+INSERT INTO orders VALUES (1445, 2955, 78);
+INSERT INTO orders VALUES (1446, 2874, 12);
+INSERT INTO orders VALUES (1447, 2793, 43);
+INSERT INTO orders VALUES (1448, 2712, 74);
+INSERT INTO orders VALUES (1449, 2631, 8);
+INSERT INTO orders VALUES (1450, 2550, 39);
+INSERT INTO orders VALUES (1451, 2469, 70);
+INSERT INTO orders VALUES (1452, 2388, 4);
+INSERT INTO orders VALUES (1453, 2307, 35);
+INSERT INTO orders VALUES (1454, 2226, 66);
+INSERT INTO orders VALUES (1455, 2145, 0);
+INSERT INTO orders VALUES (1456, 2064, 31);
+INSERT INTO orders VALUES (1457, 1983, 62);
+INSERT INTO orders VALUES (1458, 1902, 93);
+INSERT INTO orders VALUES (1459, 1821, 27);
+INSERT INTO orders VALUES (1460, 1740, 58);
+INSERT INTO orders VALUES (1461, 1659, 89);
+INSERT INTO orders VALUES (1462, 1578, 23);
+INSERT INTO orders VALUES (1463, 1497, 54);
+INSERT INTO orders VALUES (1464, 1416, 85);
+INSERT INTO orders VALUES (1465, 1335, 19);
+INSERT INTO orders VALUES (1466, 1254, 50);
+INSERT INTO orders VALUES (1467, 1173, 81);
+INSERT INTO orders VALUES (1468, 1092, 15);
+INSERT INTO orders VALUES (1469, 1011, 46);
+INSERT INTO orders VALUES (1470, 930, 77);
+INSERT INTO orders VALUES (1471, 849, 11);
+INSERT INTO orders VALUES (1472, 768, 42);
+INSERT INTO orders VALUES (1473, 687, 73);
+INSERT INTO orders VALUES (1474, 606, 7);
+INSERT INTO orders VALUES (1475, 525, 38);
+INSERT INTO orders VALUES (1476, 444, 69);
+INSERT INTO orders VALUES (1477, 363, 3);
+INSERT INTO orders VALUES (1478, 282, 34);
+INSERT INTO orders VALUES (1479, 201, 65);
+INSERT INTO orders VALUES (1480, 120, 96);
+INSERT INTO orders VALUES (1481, 39, 30);
+INSERT INTO orders VALUES (1482, 3958, 61);
+INSERT INTO orders VALUES (1483, 3877, 92);
+INSERT INTO orders VALUES (1484, 3796, 26);
+INSERT INTO orders VALUES (1485, 3715, 57);
+INSERT INTO orders VALUES (1486, 3634, 88);
+INSERT INTO orders VALUES (1487, 3553, 22);
+INSERT INTO orders VALUES (1488, 3472, 53);
+INSERT INTO orders VALUES (1489, 3391, 84);
+INSERT INTO orders VALUES (1490, 3310, 18);
+INSERT INTO orders VALUES (1491, 3229, 49);
+INSERT INTO orders VALUES (1492, 3148, 80);
+INSERT INTO orders VALUES (1493, 3067, 14);
+INSERT INTO orders VALUES (1494, 2986, 45);
+INSERT INTO orders VALUES (1495, 2905, 76);
+INSERT INTO orders VALUES (1496, 2824, 10);
+INSERT INTO orders VALUES (1497, 2743, 41);
+INSERT INTO orders VALUES (1498, 2662, 72);
+INSERT INTO orders VALUES (1499, 2581, 6);
+INSERT INTO orders VALUES (1500, 2500, 37);
+INSERT INTO orders VALUES (1501, 2419, 68);
+INSERT INTO orders VALUES (1502, 2338, 2);
+INSERT INTO orders VALUES (1503, 2257, 33);
+INSERT INTO orders VALUES (1504, 2176, 64);
+INSERT INTO orders VALUES (1505, 2095, 95);
+INSERT INTO orders VALUES (1506, 2014, 29);
+INSERT INTO orders VALUES (1507, 1933, 60);
+INSERT INTO orders VALUES (1508, 1852, 91);
+INSERT INTO orders VALUES (1509, 1771, 25);
+INSERT INTO orders VALUES (1510, 1690, 56);
+INSERT INTO orders VALUES (1511, 1609, 87);
+INSERT INTO orders VALUES (1512, 1528, 21);
+INSERT INTO orders VALUES (1513, 1447, 52);
+INSERT INTO orders VALUES (1514, 1366, 83);
+INSERT INTO orders VALUES (1515, 1285, 17);
+INSERT INTO orders VALUES (1516, 1204, 48);
+INSERT INTO orders VALUES (1517, 1123, 79);
+INSERT INTO orders VALUES (1518, 1042, 13);
+INSERT INTO orders VALUES (1519, 961, 44);
+INSERT INTO orders VALUES (1520, 880, 75);
+INSERT INTO orders VALUES (1521, 799, 9);
+INSERT INTO orders VALUES (1522, 718, 40);
+INSERT INTO orders VALUES (1523, 637, 71);
+INSERT INTO orders VALUES (1524, 556, 5);
+INSERT INTO orders VALUES (1525, 475, 36);
+INSERT INTO orders VALUES (1526, 394, 67);
+INSERT INTO orders VALUES (1527, 313, 1);
+INSERT INTO orders VALUES (1528, 232, 32);
+INSERT INTO orders VALUES (1529, 151, 63);
+INSERT INTO orders VALUES (1530, 70, 94);
+INSERT INTO orders VALUES (1531, 3989, 28);
+INSERT INTO orders VALUES (1532, 3908, 59);
+INSERT INTO orders VALUES (1533, 3827, 90);
+INSERT INTO orders VALUES (1534, 3746, 24);
+INSERT INTO orders VALUES (1535, 3665, 55);
+INSERT INTO orders VALUES (1536, 3584, 86);
+INSERT INTO orders VALUES (1537, 3503, 20);
+INSERT INTO orders VALUES (1538, 3422, 51);
+INSERT INTO orders VALUES (1539, 3341, 82);
+INSERT INTO orders VALUES (1540, 3260, 16);
+INSERT INTO orders VALUES (1541, 3179, 47);
+INSERT INTO orders VALUES (1542, 3098, 78);
+INSERT INTO orders VALUES (1543, 3017, 12);
+INSERT INTO orders VALUES (1544, 2936, 43);
+INSERT INTO orders VALUES (1545, 2855, 74);
+INSERT INTO orders VALUES (1546, 2774, 8);
+INSERT INTO orders VALUES (1547, 2693, 39);
+INSERT INTO orders VALUES (1548, 2612, 70);
+INSERT INTO orders VALUES (1549, 2531, 4);
+INSERT INTO orders VALUES (1550, 2450, 35);
+INSERT INTO orders VALUES (1551, 2369, 66);
+INSERT INTO orders VALUES (1552, 2288, 0);
+INSERT INTO orders VALUES (1553, 2207, 31);
+INSERT INTO orders VALUES (1554, 2126, 62);
+INSERT INTO orders VALUES (1555, 2045, 93);
+INSERT INTO orders VALUES (1556, 1964, 27);
+INSERT INTO orders VALUES (1557, 1883, 58);
+INSERT INTO orders VALUES (1558, 1802, 89);
+INSERT INTO orders VALUES (1559, 1721, 23);
+INSERT INTO orders VALUES (1560, 1640, 54);
+INSERT INTO orders VALUES (1561, 1559, 85);
+INSERT INTO orders VALUES (1562, 1478, 19);
+INSERT INTO orders VALUES (1563, 1397, 50);
+INSERT INTO orders VALUES (1564, 1316, 81);
+INSERT INTO orders VALUES (1565, 1235, 15);
+INSERT INTO orders VALUES (1566, 1154, 46);
+INSERT INTO orders VALUES (1567, 1073, 77);
+INSERT INTO orders VALUES (1568, 992, 11);
+INSERT INTO orders VALUES (1569, 911, 42);
+INSERT INTO orders VALUES (1570, 830, 73);
+INSERT INTO orders VALUES (1571, 749, 7);
+INSERT INTO orders VALUES (1572, 668, 38);
+INSERT INTO orders VALUES (1573, 587, 69);
+INSERT INTO orders VALUES (1574, 506, 3);
+INSERT INTO orders VALUES (1575, 425, 34);
+INSERT INTO orders VALUES (1576, 344, 65);
+INSERT INTO orders VALUES (1577, 263, 96);
+INSERT INTO orders VALUES (1578, 182, 30);
+INSERT INTO orders VALUES (1579, 101, 61);
+INSERT INTO orders VALUES (1580, 20, 92);
+INSERT INTO orders VALUES (1581, 3939, 26);
+INSERT INTO orders VALUES (1582, 3858, 57);
+INSERT INTO orders VALUES (1583, 3777, 88);
+INSERT INTO orders VALUES (1584, 3696, 22);
+INSERT INTO orders VALUES (1585, 3615, 53);
+INSERT INTO orders VALUES (1586, 3534, 84);
+INSERT INTO orders VALUES (1587, 3453, 18);
+INSERT INTO orders VALUES (1588, 3372, 49);
+INSERT INTO orders VALUES (1589, 3291, 80);
+INSERT INTO orders VALUES (1590, 3210, 14);
+INSERT INTO orders VALUES (1591, 3129, 45);
+INSERT INTO orders VALUES (1592, 3048, 76);
+INSERT INTO orders VALUES (1593, 2967, 10);
+INSERT INTO orders VALUES (1594, 2886, 41);
+INSERT INTO orders VALUES (1595, 2805, 72);
+INSERT INTO orders VALUES (1596, 2724, 6);
+INSERT INTO orders VALUES (1597, 2643, 37);
+INSERT INTO orders VALUES (1598, 2562, 68);
+INSERT INTO orders VALUES (1599, 2481, 2);
+INSERT INTO orders VALUES (1600, 2400, 33);
+INSERT INTO orders VALUES (1601, 2319, 64);
+INSERT INTO orders VALUES (1602, 2238, 95);
+INSERT INTO orders VALUES (1603, 2157, 29);
+INSERT INTO orders VALUES (1604, 2076, 60);
+INSERT INTO orders VALUES (1605, 1995, 91);
+INSERT INTO orders VALUES (1606, 1914, 25);
+INSERT INTO orders VALUES (1607, 1833, 56);
+INSERT INTO orders VALUES (1608, 1752, 87);
+INSERT INTO orders VALUES (1609, 1671, 21);
+INSERT INTO orders VALUES (1610, 1590, 52);
+INSERT INTO orders VALUES (1611, 1509, 83);
+INSERT INTO orders VALUES (1612, 1428, 17);
+INSERT INTO orders VALUES (1613, 1347, 48);
+INSERT INTO orders VALUES (1614, 1266, 79);
+INSERT INTO orders VALUES (1615, 1185, 13);
+INSERT INTO orders VALUES (1616, 1104, 44);
+INSERT INTO orders VALUES (1617, 1023, 75);
+INSERT INTO orders VALUES (1618, 942, 9);
+INSERT INTO orders VALUES (1619, 861, 40);
+INSERT INTO orders VALUES (1620, 780, 71);
+INSERT INTO orders VALUES (1621, 699, 5);
+INSERT INTO orders VALUES (1622, 618, 36);
+INSERT INTO orders VALUES (1623, 537, 67);
+INSERT INTO orders VALUES (1624, 456, 1);
+INSERT INTO orders VALUES (1625, 375, 32);
+INSERT INTO orders VALUES (1626, 294, 63);
+INSERT INTO orders VALUES (1627, 213, 94);
+INSERT INTO orders VALUES (1628, 132, 28);
+INSERT INTO orders VALUES (1629, 51, 59);
+INSERT INTO orders VALUES (1630, 3970, 90);
+INSERT INTO orders VALUES (1631, 3889, 24);
+INSERT INTO orders VALUES (1632, 3808, 55);
+INSERT INTO orders VALUES (1633, 3727, 86);
+INSERT INTO orders VALUES (1634, 3646, 20);
+INSERT INTO orders VALUES (1635, 3565, 51);
+INSERT INTO orders VALUES (1636, 3484, 82);
+INSERT INTO orders VALUES (1637, 3403, 16);
+INSERT INTO orders VALUES (1638, 3322, 47);
+INSERT INTO orders VALUES (1639, 3241, 78);
+INSERT INTO orders VALUES (1640, 3160, 12);
+INSERT INTO orders VALUES (1641, 3079, 43);
+INSERT INTO orders VALUES (1642, 2998, 74);
+INSERT INTO orders VALUES (1643, 2917, 8);
+INSERT INTO orders VALUES (1644, 2836, 39);
+INSERT INTO orders VALUES (1645, 2755, 70);
+INSERT INTO orders VALUES (1646, 2674, 4);
+INSERT INTO orders VALUES (1647, 2593, 35);
+INSERT INTO orders VALUES (1648, 2512, 66);
+INSERT INTO orders VALUES (1649, 2431, 0);
+INSERT INTO orders VALUES (1650, 2350, 31);
+INSERT INTO orders VALUES (1651, 2269, 62);
+INSERT INTO orders VALUES (1652, 2188, 93);
+INSERT INTO orders VALUES (1653, 2107, 27);
+INSERT INTO orders VALUES (1654, 2026, 58);
+INSERT INTO orders VALUES (1655, 1945, 89);
+INSERT INTO orders VALUES (1656, 1864, 23);
+INSERT INTO orders VALUES (1657, 1783, 54);
+INSERT INTO orders VALUES (1658, 1702, 85);
+INSERT INTO orders VALUES (1659, 1621, 19);
+INSERT INTO orders VALUES (1660, 1540, 50);
+INSERT INTO orders VALUES (1661, 1459, 81);
+INSERT INTO orders VALUES (1662, 1378, 15);
+INSERT INTO orders VALUES (1663, 1297, 46);
+INSERT INTO orders VALUES (1664, 1216, 77);
+INSERT INTO orders VALUES (1665, 1135, 11);
+INSERT INTO orders VALUES (1666, 1054, 42);
+INSERT INTO orders VALUES (1667, 973, 73);
+INSERT INTO orders VALUES (1668, 892, 7);
+INSERT INTO orders VALUES (1669, 811, 38);
+INSERT INTO orders VALUES (1670, 730, 69);
+INSERT INTO orders VALUES (1671, 649, 3);
+INSERT INTO orders VALUES (1672, 568, 34);
+INSERT INTO orders VALUES (1673, 487, 65);
+INSERT INTO orders VALUES (1674, 406, 96);
+INSERT INTO orders VALUES (1675, 325, 30);
+INSERT INTO orders VALUES (1676, 244, 61);
+INSERT INTO orders VALUES (1677, 163, 92);
+INSERT INTO orders VALUES (1678, 82, 26);
+INSERT INTO orders VALUES (1679, 1, 57);
+INSERT INTO orders VALUES (1680, 3920, 88);
+INSERT INTO orders VALUES (1681, 3839, 22);
+INSERT INTO orders VALUES (1682, 3758, 53);
+INSERT INTO orders VALUES (1683, 3677, 84);
+INSERT INTO orders VALUES (1684, 3596, 18);
+INSERT INTO orders VALUES (1685, 3515, 49);
+INSERT INTO orders VALUES (1686, 3434, 80);
+INSERT INTO orders VALUES (1687, 3353, 14);
+INSERT INTO orders VALUES (1688, 3272, 45);
+INSERT INTO orders VALUES (1689, 3191, 76);
+INSERT INTO orders VALUES (1690, 3110, 10);
+INSERT INTO orders VALUES (1691, 3029, 41);
+INSERT INTO orders VALUES (1692, 2948, 72);
+INSERT INTO orders VALUES (1693, 2867, 6);
+INSERT INTO orders VALUES (1694, 2786, 37);
+INSERT INTO orders VALUES (1695, 2705, 68);
+INSERT INTO orders VALUES (1696, 2624, 2);
+INSERT INTO orders VALUES (1697, 2543, 33);
+INSERT INTO orders VALUES (1698, 2462, 64);
+INSERT INTO orders VALUES (1699, 2381, 95);
+INSERT INTO orders VALUES (1700, 2300, 29);
+INSERT INTO orders VALUES (1701, 2219, 60);
+INSERT INTO orders VALUES (1702, 2138, 91);
+INSERT INTO orders VALUES (1703, 2057, 25);
+INSERT INTO orders VALUES (1704, 1976, 56);
+INSERT INTO orders VALUES (1705, 1895, 87);
+INSERT INTO orders VALUES (1706, 1814, 21);
+INSERT INTO orders VALUES (1707, 1733, 52);
+INSERT INTO orders VALUES (1708, 1652, 83);
+INSERT INTO orders VALUES (1709, 1571, 17);
+INSERT INTO orders VALUES (1710, 1490, 48);
+INSERT INTO orders VALUES (1711, 1409, 79);
+INSERT INTO orders VALUES (1712, 1328, 13);
+INSERT INTO orders VALUES (1713, 1247, 44);
+INSERT INTO orders VALUES (1714, 1166, 75);
+INSERT INTO orders VALUES (1715, 1085, 9);
+INSERT INTO orders VALUES (1716, 1004, 40);
+INSERT INTO orders VALUES (1717, 923, 71);
+INSERT INTO orders VALUES (1718, 842, 5);
+INSERT INTO orders VALUES (1719, 761, 36);
+INSERT INTO orders VALUES (1720, 680, 67);
+INSERT INTO orders VALUES (1721, 599, 1);
+INSERT INTO orders VALUES (1722, 518, 32);
+INSERT INTO orders VALUES (1723, 437, 63);
+INSERT INTO orders VALUES (1724, 356, 94);
+INSERT INTO orders VALUES (1725, 275, 28);
+INSERT INTO orders VALUES (1726, 194, 59);
+INSERT INTO orders VALUES (1727, 113, 90);
+INSERT INTO orders VALUES (1728, 32, 24);
+INSERT INTO orders VALUES (1729, 3951, 55);
+INSERT INTO orders VALUES (1730, 3870, 86);
+INSERT INTO orders VALUES (1731, 3789, 20);
+INSERT INTO orders VALUES (1732, 3708, 51);
+INSERT INTO orders VALUES (1733, 3627, 82);
+INSERT INTO orders VALUES (1734, 3546, 16);
+INSERT INTO orders VALUES (1735, 3465, 47);
+INSERT INTO orders VALUES (1736, 3384, 78);
+INSERT INTO orders VALUES (1737, 3303, 12);
+INSERT INTO orders VALUES (1738, 3222, 43);
+INSERT INTO orders VALUES (1739, 3141, 74);
+INSERT INTO orders VALUES (1740, 3060, 8);
+INSERT INTO orders VALUES (1741, 2979, 39);
+INSERT INTO orders VALUES (1742, 2898, 70);
+INSERT INTO orders VALUES (1743, 2817, 4);
+INSERT INTO orders VALUES (1744, 2736, 35);
+INSERT INTO orders VALUES (1745, 2655, 66);
+INSERT INTO orders VALUES (1746, 2574, 0);
+INSERT INTO orders VALUES (1747, 2493, 31);
+INSERT INTO orders VALUES (1748, 2412, 62);
+INSERT INTO orders VALUES (1749, 2331, 93);
+INSERT INTO orders VALUES (1750, 2250, 27);
+INSERT INTO orders VALUES (1751, 2169, 58);
+INSERT INTO orders VALUES (1752, 2088, 89);
+INSERT INTO orders VALUES (1753, 2007, 23);
+INSERT INTO orders VALUES (1754, 1926, 54);
+INSERT INTO orders VALUES (1755, 1845, 85);
+INSERT INTO orders VALUES (1756, 1764, 19);
+INSERT INTO orders VALUES (1757, 1683, 50);
+INSERT INTO orders VALUES (1758, 1602, 81);
+INSERT INTO orders VALUES (1759, 1521, 15);
+INSERT INTO orders VALUES (1760, 1440, 46);
+INSERT INTO orders VALUES (1761, 1359, 77);
+INSERT INTO orders VALUES (1762, 1278, 11);
+INSERT INTO orders VALUES (1763, 1197, 42);
+INSERT INTO orders VALUES (1764, 1116, 73);
+INSERT INTO orders VALUES (1765, 1035, 7);
+INSERT INTO orders VALUES (1766, 954, 38);
+INSERT INTO orders VALUES (1767, 873, 69);
+INSERT INTO orders VALUES (1768, 792, 3);
+INSERT INTO orders VALUES (1769, 711, 34);
+INSERT INTO orders VALUES (1770, 630, 65);
+INSERT INTO orders VALUES (1771, 549, 96);
+INSERT INTO orders VALUES (1772, 468, 30);
+INSERT INTO orders VALUES (1773, 387, 61);
+INSERT INTO orders VALUES (1774, 306, 92);
+INSERT INTO orders VALUES (1775, 225, 26);
+INSERT INTO orders VALUES (1776, 144, 57);
+INSERT INTO orders VALUES (1777, 63, 88);
+INSERT INTO orders VALUES (1778, 3982, 22);
+INSERT INTO orders VALUES (1779, 3901, 53);
+INSERT INTO orders VALUES (1780, 3820, 84);
+INSERT INTO orders VALUES (1781, 3739, 18);
+INSERT INTO orders VALUES (1782, 3658, 49);
+INSERT INTO orders VALUES (1783, 3577, 80);
+INSERT INTO orders VALUES (1784, 3496, 14);
+INSERT INTO orders VALUES (1785, 3415, 45);
+INSERT INTO orders VALUES (1786, 3334, 76);
+INSERT INTO orders VALUES (1787, 3253, 10);
+INSERT INTO orders VALUES (1788, 3172, 41);
+INSERT INTO orders VALUES (1789, 3091, 72);
+INSERT INTO orders VALUES (1790, 3010, 6);
+INSERT INTO orders VALUES (1791, 2929, 37);
+INSERT INTO orders VALUES (1792, 2848, 68);
+INSERT INTO orders VALUES (1793, 2767, 2);
+INSERT INTO orders VALUES (1794, 2686, 33);
+INSERT INTO orders VALUES (1795, 2605, 64);
+INSERT INTO orders VALUES (1796, 2524, 95);
+INSERT INTO orders VALUES (1797, 2443, 29);
+INSERT INTO orders VALUES (1798, 2362, 60);
+INSERT INTO orders VALUES (1799, 2281, 91);
+INSERT INTO orders VALUES (1800, 2200, 25);
+INSERT INTO orders VALUES (1801, 2119, 56);
+INSERT INTO orders VALUES (1802, 2038, 87);
+INSERT INTO orders VALUES (1803, 1957, 21);
+INSERT INTO orders VALUES (1804, 1876, 52);
+INSERT INTO orders VALUES (1805, 1795, 83);
+INSERT INTO orders VALUES (1806, 1714, 17);
+INSERT INTO orders VALUES (1807, 1633, 48);
+INSERT INTO orders VALUES (1808, 1552, 79);
+INSERT INTO orders VALUES (1809, 1471, 13);
+INSERT INTO orders VALUES (1810, 1390, 44);
+INSERT INTO orders VALUES (1811, 1309, 75);
+INSERT INTO orders VALUES (1812, 1228, 9);
+INSERT INTO orders VALUES (1813, 1147, 40);
+INSERT INTO orders VALUES (1814, 1066, 71);
+INSERT INTO orders VALUES (1815, 985, 5);
+INSERT INTO orders VALUES (1816, 904, 36);
+INSERT INTO orders VALUES (1817, 823, 67);
+INSERT INTO orders VALUES (1818, 742, 1);
+INSERT INTO orders VALUES (1819, 661, 32);
+INSERT INTO orders VALUES (1820, 580, 63);
+INSERT INTO orders VALUES (1821, 499, 94);
+INSERT INTO orders VALUES (1822, 418, 28);
+INSERT INTO orders VALUES (1823, 337, 59);
+INSERT INTO orders VALUES (1824, 256, 90);
+INSERT INTO orders VALUES (1825, 175, 24);
+INSERT INTO orders VALUES (1826, 94, 55);
+INSERT INTO orders VALUES (1827, 13, 86);
+INSERT INTO orders VALUES (1828, 3932, 20);
+INSERT INTO orders VALUES (1829, 3851, 51);
+INSERT INTO orders VALUES (1830, 3770, 82);
+INSERT INTO orders VALUES (1831, 3689, 16);
+INSERT INTO orders VALUES (1832, 3608, 47);
+INSERT INTO orders VALUES (1833, 3527, 78);
+INSERT INTO orders VALUES (1834, 3446, 12);
+INSERT INTO orders VALUES (1835, 3365, 43);
+INSERT INTO orders VALUES (1836, 3284, 74);
+INSERT INTO orders VALUES (1837, 3203, 8);
+INSERT INTO orders VALUES (1838, 3122, 39);
+INSERT INTO orders VALUES (1839, 3041, 70);
+INSERT INTO orders VALUES (1840, 2960, 4);
+INSERT INTO orders VALUES (1841, 2879, 35);
+INSERT INTO orders VALUES (1842, 2798, 66);
+INSERT INTO orders VALUES (1843, 2717, 0);
+INSERT INTO orders VALUES (1844, 2636, 31);
+INSERT INTO orders VALUES (1845, 2555, 62);
+INSERT INTO orders VALUES (1846, 2474, 93);
+INSERT INTO orders VALUES (1847, 2393, 27);
+INSERT INTO orders VALUES (1848, 2312, 58);
+INSERT INTO orders VALUES (1849, 2231, 89);
+INSERT INTO orders VALUES (1850, 2150, 23);
+INSERT INTO orders VALUES (1851, 2069, 54);
+INSERT INTO orders VALUES (1852, 1988, 85);
+INSERT INTO orders VALUES (1853, 1907, 19);
+INSERT INTO orders VALUES (1854, 1826, 50);
+INSERT INTO orders VALUES (1855, 1745, 81);
+INSERT INTO orders VALUES (1856, 1664, 15);
+INSERT INTO orders VALUES (1857, 1583, 46);
+INSERT INTO orders VALUES (1858, 1502, 77);
+INSERT INTO orders VALUES (1859, 1421, 11);
+INSERT INTO orders VALUES (1860, 1340, 42);
+INSERT INTO orders VALUES (1861, 1259, 73);
+INSERT INTO orders VALUES (1862, 1178, 7);
+INSERT INTO orders VALUES (1863, 1097, 38);
+INSERT INTO orders VALUES (1864, 1016, 69);
+INSERT INTO orders VALUES (1865, 935, 3);
+INSERT INTO orders VALUES (1866, 854, 34);
+INSERT INTO orders VALUES (1867, 773, 65);
+INSERT INTO orders VALUES (1868, 692, 96);
+INSERT INTO orders VALUES (1869, 611, 30);
+INSERT INTO orders VALUES (1870, 530, 61);
+INSERT INTO orders VALUES (1871, 449, 92);
+INSERT INTO orders VALUES (1872, 368, 26);
+INSERT INTO orders VALUES (1873, 287, 57);
+INSERT INTO orders VALUES (1874, 206, 88);
+INSERT INTO orders VALUES (1875, 125, 22);
+INSERT INTO orders VALUES (1876, 44, 53);
+INSERT INTO orders VALUES (1877, 3963, 84);
+INSERT INTO orders VALUES (1878, 3882, 18);
+INSERT INTO orders VALUES (1879, 3801, 49);
+INSERT INTO orders VALUES (1880, 3720, 80);
+INSERT INTO orders VALUES (1881, 3639, 14);
+INSERT INTO orders VALUES (1882, 3558, 45);
+INSERT INTO orders VALUES (1883, 3477, 76);
+INSERT INTO orders VALUES (1884, 3396, 10);
+INSERT INTO orders VALUES (1885, 3315, 41);
+INSERT INTO orders VALUES (1886, 3234, 72);
+INSERT INTO orders VALUES (1887, 3153, 6);
+INSERT INTO orders VALUES (1888, 3072, 37);
+INSERT INTO orders VALUES (1889, 2991, 68);
+INSERT INTO orders VALUES (1890, 2910, 2);
+INSERT INTO orders VALUES (1891, 2829, 33);
+INSERT INTO orders VALUES (1892, 2748, 64);
+INSERT INTO orders VALUES (1893, 2667, 95);
+INSERT INTO orders VALUES (1894, 2586, 29);
+INSERT INTO orders VALUES (1895, 2505, 60);
+INSERT INTO orders VALUES (1896, 2424, 91);
+INSERT INTO orders VALUES (1897, 2343, 25);
+INSERT INTO orders VALUES (1898, 2262, 56);
+INSERT INTO orders VALUES (1899, 2181, 87);
+INSERT INTO orders VALUES (1900, 2100, 21);
+INSERT INTO orders VALUES (1901, 2019, 52);
+INSERT INTO orders VALUES (1902, 1938, 83);
+INSERT INTO orders VALUES (1903, 1857, 17);
+INSERT INTO orders VALUES (1904, 1776, 48);
+INSERT INTO orders VALUES (1905, 1695, 79);
+INSERT INTO orders VALUES (1906, 1614, 13);
+INSERT INTO orders VALUES (1907, 1533, 44);
+INSERT INTO orders VALUES (1908, 1452, 75);
+INSERT INTO orders VALUES (1909, 1371, 9);
+INSERT INTO orders VALUES (1910, 1290, 40);
+INSERT INTO orders VALUES (1911, 1209, 71);
+INSERT INTO orders VALUES (1912, 1128, 5);
+INSERT INTO orders VALUES (1913, 1047, 36);
+INSERT INTO orders VALUES (1914, 966, 67);
+INSERT INTO orders VALUES (1915, 885, 1);
+INSERT INTO orders VALUES (1916, 804, 32);
+INSERT INTO orders VALUES (1917, 723, 63);
+INSERT INTO orders VALUES (1918, 642, 94);
+INSERT INTO orders VALUES (1919, 561, 28);
+INSERT INTO orders VALUES (1920, 480, 59);
+INSERT INTO orders VALUES (1921, 399, 90);
+INSERT INTO orders VALUES (1922, 318, 24);
+INSERT INTO orders VALUES (1923, 237, 55);
+INSERT INTO orders VALUES (1924, 156, 86);
+INSERT INTO orders VALUES (1925, 75, 20);
+INSERT INTO orders VALUES (1926, 3994, 51);
+INSERT INTO orders VALUES (1927, 3913, 82);
+INSERT INTO orders VALUES (1928, 3832, 16);
+INSERT INTO orders VALUES (1929, 3751, 47);
+INSERT INTO orders VALUES (1930, 3670, 78);
+INSERT INTO orders VALUES (1931, 3589, 12);
+INSERT INTO orders VALUES (1932, 3508, 43);
+INSERT INTO orders VALUES (1933, 3427, 74);
+INSERT INTO orders VALUES (1934, 3346, 8);
+INSERT INTO orders VALUES (1935, 3265, 39);
+INSERT INTO orders VALUES (1936, 3184, 70);
+INSERT INTO orders VALUES (1937, 3103, 4);
+INSERT INTO orders VALUES (1938, 3022, 35);
+INSERT INTO orders VALUES (1939, 2941, 66);
+INSERT INTO orders VALUES (1940, 2860, 0);
+INSERT INTO orders VALUES (1941, 2779, 31);
+INSERT INTO orders VALUES (1942, 2698, 62);
+INSERT INTO orders VALUES (1943, 2617, 93);
+INSERT INTO orders VALUES (1944, 2536, 27);
+INSERT INTO orders VALUES (1945, 2455, 58);
+INSERT INTO orders VALUES (1946, 2374, 89);
+INSERT INTO orders VALUES (1947, 2293, 23);
+INSERT INTO orders VALUES (1948, 2212, 54);
+INSERT INTO orders VALUES (1949, 2131, 85);
+INSERT INTO orders VALUES (1950, 2050, 19);
+INSERT INTO orders VALUES (1951, 1969, 50);
+INSERT INTO orders VALUES (1952, 1888, 81);
+INSERT INTO orders VALUES (1953, 1807, 15);
+INSERT INTO orders VALUES (1954, 1726, 46);
+INSERT INTO orders VALUES (1955, 1645, 77);
+INSERT INTO orders VALUES (1956, 1564, 11);
+INSERT INTO orders VALUES (1957, 1483, 42);
+INSERT INTO orders VALUES (1958, 1402, 73);
+INSERT INTO orders VALUES (1959, 1321, 7);
+INSERT INTO orders VALUES (1960, 1240, 38);
+INSERT INTO orders VALUES (1961, 1159, 69);
+INSERT INTO orders VALUES (1962, 1078, 3);
+INSERT INTO orders VALUES (1963, 997, 34);
+INSERT INTO orders VALUES (1964, 916, 65);
+INSERT INTO orders VALUES (1965, 835, 96);
+INSERT INTO orders VALUES (1966, 754, 30);
+INSERT INTO orders VALUES (1967, 673, 61);
+INSERT INTO orders VALUES (1968, 592, 92);
+INSERT INTO orders VALUES (1969, 511, 26);
+INSERT INTO orders VALUES (1970, 430, 57);
+INSERT INTO orders VALUES (1971, 349, 88);
+INSERT INTO orders VALUES (1972, 268, 22);
+INSERT INTO orders VALUES (1973, 187, 53);
+INSERT INTO orders VALUES (1974, 106, 84);
+INSERT INTO orders VALUES (1975, 25, 18);
+INSERT INTO orders VALUES (1976, 3944, 49);
+INSERT INTO orders VALUES (1977, 3863, 80);
+INSERT INTO orders VALUES (1978, 3782, 14);
+INSERT INTO orders VALUES (1979, 3701, 45);
+INSERT INTO orders VALUES (1980, 3620, 76);
+INSERT INTO orders VALUES (1981, 3539, 10);
+INSERT INTO orders VALUES (1982, 3458, 41);
+INSERT INTO orders VALUES (1983, 3377, 72);
+INSERT INTO orders VALUES (1984, 3296, 6);
+INSERT INTO orders VALUES (1985, 3215, 37);
+INSERT INTO orders VALUES (1986, 3134, 68);
+INSERT INTO orders VALUES (1987, 3053, 2);
+INSERT INTO orders VALUES (1988, 2972, 33);
+INSERT INTO orders VALUES (1989, 2891, 64);
+INSERT INTO orders VALUES (1990, 2810, 95);
+INSERT INTO orders VALUES (1991, 2729, 29);
+INSERT INTO orders VALUES (1992, 2648, 60);
+INSERT INTO orders VALUES (1993, 2567, 91);
+INSERT INTO orders VALUES (1994, 2486, 25);
+INSERT INTO orders VALUES (1995, 2405, 56);
+INSERT INTO orders VALUES (1996, 2324, 87);
+INSERT INTO orders VALUES (1997, 2243, 21);
+INSERT INTO orders VALUES (1998, 2162, 52);
+INSERT INTO orders VALUES (1999, 2081, 83);
+INSERT INTO orders VALUES (2000, 2000, 17);
+INSERT INTO orders VALUES (2001, 1919, 48);
+INSERT INTO orders VALUES (2002, 1838, 79);
+INSERT INTO orders VALUES (2003, 1757, 13);
+INSERT INTO orders VALUES (2004, 1676, 44);
+INSERT INTO orders VALUES (2005, 1595, 75);
+INSERT INTO orders VALUES (2006, 1514, 9);
+INSERT INTO orders VALUES (2007, 1433, 40);
+INSERT INTO orders VALUES (2008, 1352, 71);
+INSERT INTO orders VALUES (2009, 1271, 5);
+INSERT INTO orders VALUES (2010, 1190, 36);
+INSERT INTO orders VALUES (2011, 1109, 67);
+INSERT INTO orders VALUES (2012, 1028, 1);
+INSERT INTO orders VALUES (2013, 947, 32);
+INSERT INTO orders VALUES (2014, 866, 63);
+INSERT INTO orders VALUES (2015, 785, 94);
+INSERT INTO orders VALUES (2016, 704, 28);
+INSERT INTO orders VALUES (2017, 623, 59);
+INSERT INTO orders VALUES (2018, 542, 90);
+INSERT INTO orders VALUES (2019, 461, 24);
+INSERT INTO orders VALUES (2020, 380, 55);
+INSERT INTO orders VALUES (2021, 299, 86);
+INSERT INTO orders VALUES (2022, 218, 20);
+INSERT INTO orders VALUES (2023, 137, 51);
+INSERT INTO orders VALUES (2024, 56, 82);
+INSERT INTO orders VALUES (2025, 3975, 16);
+INSERT INTO orders VALUES (2026, 3894, 47);
+INSERT INTO orders VALUES (2027, 3813, 78);
+INSERT INTO orders VALUES (2028, 3732, 12);
+INSERT INTO orders VALUES (2029, 3651, 43);
+INSERT INTO orders VALUES (2030, 3570, 74);
+INSERT INTO orders VALUES (2031, 3489, 8);
+INSERT INTO orders VALUES (2032, 3408, 39);
+INSERT INTO orders VALUES (2033, 3327, 70);
+INSERT INTO orders VALUES (2034, 3246, 4);
+INSERT INTO orders VALUES (2035, 3165, 35);
+INSERT INTO orders VALUES (2036, 3084, 66);
+INSERT INTO orders VALUES (2037, 3003, 0);
+INSERT INTO orders VALUES (2038, 2922, 31);
+INSERT INTO orders VALUES (2039, 2841, 62);
+INSERT INTO orders VALUES (2040, 2760, 93);
+INSERT INTO orders VALUES (2041, 2679, 27);
+INSERT INTO orders VALUES (2042, 2598, 58);
+INSERT INTO orders VALUES (2043, 2517, 89);
+INSERT INTO orders VALUES (2044, 2436, 23);
+INSERT INTO orders VALUES (2045, 2355, 54);
+INSERT INTO orders VALUES (2046, 2274, 85);
+INSERT INTO orders VALUES (2047, 2193, 19);
+INSERT INTO orders VALUES (2048, 2112, 50);
+INSERT INTO orders VALUES (2049, 2031, 81);
+INSERT INTO orders VALUES (2050, 1950, 15);
+INSERT INTO orders VALUES (2051, 1869, 46);
+INSERT INTO orders VALUES (2052, 1788, 77);
+INSERT INTO orders VALUES (2053, 1707, 11);
+INSERT INTO orders VALUES (2054, 1626, 42);
+INSERT INTO orders VALUES (2055, 1545, 73);
+INSERT INTO orders VALUES (2056, 1464, 7);
+INSERT INTO orders VALUES (2057, 1383, 38);
+INSERT INTO orders VALUES (2058, 1302, 69);
+INSERT INTO orders VALUES (2059, 1221, 3);
+INSERT INTO orders VALUES (2060, 1140, 34);
+INSERT INTO orders VALUES (2061, 1059, 65);
+INSERT INTO orders VALUES (2062, 978, 96);
+INSERT INTO orders VALUES (2063, 897, 30);
+INSERT INTO orders VALUES (2064, 816, 61);
+INSERT INTO orders VALUES (2065, 735, 92);
+INSERT INTO orders VALUES (2066, 654, 26);
+INSERT INTO orders VALUES (2067, 573, 57);
+INSERT INTO orders VALUES (2068, 492, 88);
+INSERT INTO orders VALUES (2069, 411, 22);
+INSERT INTO orders VALUES (2070, 330, 53);
+INSERT INTO orders VALUES (2071, 249, 84);
+INSERT INTO orders VALUES (2072, 168, 18);
+INSERT INTO orders VALUES (2073, 87, 49);
+INSERT INTO orders VALUES (2074, 6, 80);
+INSERT INTO orders VALUES (2075, 3925, 14);
+INSERT INTO orders VALUES (2076, 3844, 45);
+INSERT INTO orders VALUES (2077, 3763, 76);
+INSERT INTO orders VALUES (2078, 3682, 10);
+INSERT INTO orders VALUES (2079, 3601, 41);
+INSERT INTO orders VALUES (2080, 3520, 72);
+INSERT INTO orders VALUES (2081, 3439, 6);
+INSERT INTO orders VALUES (2082, 3358, 37);
+INSERT INTO orders VALUES (2083, 3277, 68);
+INSERT INTO orders VALUES (2084, 3196, 2);
+INSERT INTO orders VALUES (2085, 3115, 33);
+INSERT INTO orders VALUES (2086, 3034, 64);
+INSERT INTO orders VALUES (2087, 2953, 95);
+INSERT INTO orders VALUES (2088, 2872, 29);
+INSERT INTO orders VALUES (2089, 2791, 60);
+INSERT INTO orders VALUES (2090, 2710, 91);
+INSERT INTO orders VALUES (2091, 2629, 25);
+INSERT INTO orders VALUES (2092, 2548, 56);
+INSERT INTO orders VALUES (2093, 2467, 87);
+INSERT INTO orders VALUES (2094, 2386, 21);
+INSERT INTO orders VALUES (2095, 2305, 52);
+INSERT INTO orders VALUES (2096, 2224, 83);
+INSERT INTO orders VALUES (2097, 2143, 17);
+INSERT INTO orders VALUES (2098, 2062, 48);
+INSERT INTO orders VALUES (2099, 1981, 79);
+INSERT INTO orders VALUES (2100, 1900, 13);
+INSERT INTO orders VALUES (2101, 1819, 44);
+INSERT INTO orders VALUES (2102, 1738, 75);
+INSERT INTO orders VALUES (2103, 1657, 9);
+INSERT INTO orders VALUES (2104, 1576, 40);
+INSERT INTO orders VALUES (2105, 1495, 71);
+INSERT INTO orders VALUES (2106, 1414, 5);
+INSERT INTO orders VALUES (2107, 1333, 36);
+INSERT INTO orders VALUES (2108, 1252, 67);
+INSERT INTO orders VALUES (2109, 1171, 1);
+INSERT INTO orders VALUES (2110, 1090, 32);
+INSERT INTO orders VALUES (2111, 1009, 63);
+INSERT INTO orders VALUES (2112, 928, 94);
+INSERT INTO orders VALUES (2113, 847, 28);
+INSERT INTO orders VALUES (2114, 766, 59);
+INSERT INTO orders VALUES (2115, 685, 90);
+INSERT INTO orders VALUES (2116, 604, 24);
+INSERT INTO orders VALUES (2117, 523, 55);
+INSERT INTO orders VALUES (2118, 442, 86);
+INSERT INTO orders VALUES (2119, 361, 20);
+INSERT INTO orders VALUES (2120, 280, 51);
+INSERT INTO orders VALUES (2121, 199, 82);
+INSERT INTO orders VALUES (2122, 118, 16);
+INSERT INTO orders VALUES (2123, 37, 47);
+INSERT INTO orders VALUES (2124, 3956, 78);
+INSERT INTO orders VALUES (2125, 3875, 12);
+INSERT INTO orders VALUES (2126, 3794, 43);
+INSERT INTO orders VALUES (2127, 3713, 74);
+INSERT INTO orders VALUES (2128, 3632, 8);
+INSERT INTO orders VALUES (2129, 3551, 39);
+INSERT INTO orders VALUES (2130, 3470, 70);
+INSERT INTO orders VALUES (2131, 3389, 4);
+INSERT INTO orders VALUES (2132, 3308, 35);
+INSERT INTO orders VALUES (2133, 3227, 66);
+INSERT INTO orders VALUES (2134, 3146, 0);
+INSERT INTO orders VALUES (2135, 3065, 31);
+INSERT INTO orders VALUES (2136, 2984, 62);
+INSERT INTO orders VALUES (2137, 2903, 93);
+INSERT INTO orders VALUES (2138, 2822, 27);
+INSERT INTO orders VALUES (2139, 2741, 58);
+INSERT INTO orders VALUES (2140, 2660, 89);
+INSERT INTO orders VALUES (2141, 2579, 23);
+INSERT INTO orders VALUES (2142, 2498, 54);
+INSERT INTO orders VALUES (2143, 2417, 85);
+INSERT INTO orders VALUES (2144, 2336, 19);
+INSERT INTO orders VALUES (2145, 2255, 50);
+INSERT INTO orders VALUES (2146, 2174, 81);
+INSERT INTO orders VALUES (2147, 2093, 15);
+INSERT INTO orders VALUES (2148, 2012, 46);
+INSERT INTO orders VALUES (2149, 1931, 77);
+INSERT INTO orders VALUES (2150, 1850, 11);
+INSERT INTO orders VALUES (2151, 1769, 42);
+INSERT INTO orders VALUES (2152, 1688, 73);
+INSERT INTO orders VALUES (2153, 1607, 7);
+INSERT INTO orders VALUES (2154, 1526, 38);
+INSERT INTO orders VALUES (2155, 1445, 69);
+INSERT INTO orders VALUES (2156, 1364, 3);
+INSERT INTO orders VALUES (2157, 1283, 34);
+INSERT INTO orders VALUES (2158, 1202, 65);
+INSERT INTO orders VALUES (2159, 1121, 96);
+INSERT INTO orders VALUES (2160, 1040, 30);
+INSERT INTO orders VALUES (2161, 959, 61);
+INSERT INTO orders VALUES (2162, 878, 92);
+INSERT INTO orders VALUES (2163, 797, 26);
+INSERT INTO orders VALUES (2164, 716, 57);
+INSERT INTO orders VALUES (2165, 635, 88);
+INSERT INTO orders VALUES (2166, 554, 22);
+INSERT INTO orders VALUES (2167, 473, 53);
+INSERT INTO orders VALUES (2168, 392, 84);
+INSERT INTO orders VALUES (2169, 311, 18);
+INSERT INTO orders VALUES (2170, 230, 49);
+INSERT INTO orders VALUES (2171, 149, 80);
+INSERT INTO orders VALUES (2172, 68, 14);
+INSERT INTO orders VALUES (2173, 3987, 45);
+INSERT INTO orders VALUES (2174, 3906, 76);
+INSERT INTO orders VALUES (2175, 3825, 10);
+INSERT INTO orders VALUES (2176, 3744, 41);
+INSERT INTO orders VALUES (2177, 3663, 72);
+INSERT INTO orders VALUES (2178, 3582, 6);
+INSERT INTO orders VALUES (2179, 3501, 37);
+INSERT INTO orders VALUES (2180, 3420, 68);
+INSERT INTO orders VALUES (2181, 3339, 2);
+INSERT INTO orders VALUES (2182, 3258, 33);
+INSERT INTO orders VALUES (2183, 3177, 64);
+INSERT INTO orders VALUES (2184, 3096, 95);
+INSERT INTO orders VALUES (2185, 3015, 29);
+INSERT INTO orders VALUES (2186, 2934, 60);
+INSERT INTO orders VALUES (2187, 2853, 91);
+INSERT INTO orders VALUES (2188, 2772, 25);
+INSERT INTO orders VALUES (2189, 2691, 56);
+INSERT INTO orders VALUES (2190, 2610, 87);
+INSERT INTO orders VALUES (2191, 2529, 21);
+INSERT INTO orders VALUES (2192, 2448, 52);
+INSERT INTO orders VALUES (2193, 2367, 83);
+INSERT INTO orders VALUES (2194, 2286, 17);
+INSERT INTO orders VALUES (2195, 2205, 48);
+INSERT INTO orders VALUES (2196, 2124, 79);
+INSERT INTO orders VALUES (2197, 2043, 13);
+INSERT INTO orders VALUES (2198, 1962, 44);
+INSERT INTO orders VALUES (2199, 1881, 75);
+INSERT INTO orders VALUES (2200, 1800, 9);
+INSERT INTO orders VALUES (2201, 1719, 40);
+INSERT INTO orders VALUES (2202, 1638, 71);
+INSERT INTO orders VALUES (2203, 1557, 5);
+INSERT INTO orders VALUES (2204, 1476, 36);
+INSERT INTO orders VALUES (2205, 1395, 67);
+INSERT INTO orders VALUES (2206, 1314, 1);
+INSERT INTO orders VALUES (2207, 1233, 32);
+INSERT INTO orders VALUES (2208, 1152, 63);
+INSERT INTO orders VALUES (2209, 1071, 94);
+INSERT INTO orders VALUES (2210, 990, 28);
+INSERT INTO orders VALUES (2211, 909, 59);
+INSERT INTO orders VALUES (2212, 828, 90);
+INSERT INTO orders VALUES (2213, 747, 24);
+INSERT INTO orders VALUES (2214, 666, 55);
+INSERT INTO orders VALUES (2215, 585, 86);
+INSERT INTO orders VALUES (2216, 504, 20);
+INSERT INTO orders VALUES (2217, 423, 51);
+INSERT INTO orders VALUES (2218, 342, 82);
+INSERT INTO orders VALUES (2219, 261, 16);
+INSERT INTO orders VALUES (2220, 180, 47);
+INSERT INTO orders VALUES (2221, 99, 78);
+INSERT INTO orders VALUES (2222, 18, 12);
+INSERT INTO orders VALUES (2223, 3937, 43);
+INSERT INTO orders VALUES (2224, 3856, 74);
+INSERT INTO orders VALUES (2225, 3775, 8);
+INSERT INTO orders VALUES (2226, 3694, 39);
+INSERT INTO orders VALUES (2227, 3613, 70);
+INSERT INTO orders VALUES (2228, 3532, 4);
+INSERT INTO orders VALUES (2229, 3451, 35);
+INSERT INTO orders VALUES (2230, 3370, 66);
+INSERT INTO orders VALUES (2231, 3289, 0);
+INSERT INTO orders VALUES (2232, 3208, 31);
+INSERT INTO orders VALUES (2233, 3127, 62);
+INSERT INTO orders VALUES (2234, 3046, 93);
+INSERT INTO orders VALUES (2235, 2965, 27);
+INSERT INTO orders VALUES (2236, 2884, 58);
+INSERT INTO orders VALUES (2237, 2803, 89);
+INSERT INTO orders VALUES (2238, 2722, 23);
+INSERT INTO orders VALUES (2239, 2641, 54);
+INSERT INTO orders VALUES (2240, 2560, 85);
+INSERT INTO orders VALUES (2241, 2479, 19);
+INSERT INTO orders VALUES (2242, 2398, 50);
+INSERT INTO orders VALUES (2243, 2317, 81);
+INSERT INTO orders VALUES (2244, 2236, 15);
+INSERT INTO orders VALUES (2245, 2155, 46);
+INSERT INTO orders VALUES (2246, 2074, 77);
+INSERT INTO orders VALUES (2247, 1993, 11);
+INSERT INTO orders VALUES (2248, 1912, 42);
+INSERT INTO orders VALUES (2249, 1831, 73);
+INSERT INTO orders VALUES (2250, 1750, 7);
+INSERT INTO orders VALUES (2251, 1669, 38);
+INSERT INTO orders VALUES (2252, 1588, 69);
+INSERT INTO orders VALUES (2253, 1507, 3);
+INSERT INTO orders VALUES (2254, 1426, 34);
+INSERT INTO orders VALUES (2255, 1345, 65);
+INSERT INTO orders VALUES (2256, 1264, 96);
+INSERT INTO orders VALUES (2257, 1183, 30);
+INSERT INTO orders VALUES (2258, 1102, 61);
+INSERT INTO orders VALUES (2259, 1021, 92);
+INSERT INTO orders VALUES (2260, 940, 26);
+INSERT INTO orders VALUES (2261, 859, 57);
+INSERT INTO orders VALUES (2262, 778, 88);
+INSERT INTO orders VALUES (2263, 697, 22);
+INSERT INTO orders VALUES (2264, 616, 53);
+INSERT INTO orders VALUES (2265, 535, 84);
+INSERT INTO orders VALUES (2266, 454, 18);
+INSERT INTO orders VALUES (2267, 373, 49);
+INSERT INTO orders VALUES (2268, 292, 80);
+INSERT INTO orders VALUES (2269, 211, 14);
+INSERT INTO orders VALUES (2270, 130, 45);
+INSERT INTO orders VALUES (2271, 49, 76);
+INSERT INTO orders VALUES (2272, 3968, 10);
+INSERT INTO orders VALUES (2273, 3887, 41);
+INSERT INTO orders VALUES (2274, 3806, 72);
+INSERT INTO orders VALUES (2275, 3725, 6);
+INSERT INTO orders VALUES (2276, 3644, 37);
+INSERT INTO orders VALUES (2277, 3563, 68);
+INSERT INTO orders VALUES (2278, 3482, 2);
+INSERT INTO orders VALUES (2279, 3401, 33);
+INSERT INTO orders VALUES (2280, 3320, 64);
+INSERT INTO orders VALUES (2281, 3239, 95);
+INSERT INTO orders VALUES (2282, 3158, 29);
+INSERT INTO orders VALUES (2283, 3077, 60);
+INSERT INTO orders VALUES (2284, 2996, 91);
+INSERT INTO orders VALUES (2285, 2915, 25);
+INSERT INTO orders VALUES (2286, 2834, 56);
+INSERT INTO orders VALUES (2287, 2753, 87);
+INSERT INTO orders VALUES (2288, 2672, 21);
+INSERT INTO orders VALUES (2289, 2591, 52);
+INSERT INTO orders VALUES (2290, 2510, 83);
+INSERT INTO orders VALUES (2291, 2429, 17);
+INSERT INTO orders VALUES (2292, 2348, 48);
+INSERT INTO orders VALUES (2293, 2267, 79);
+INSERT INTO orders VALUES (2294, 2186, 13);
+INSERT INTO orders VALUES (2295, 2105, 44);
+INSERT INTO orders VALUES (2296, 2024, 75);
+INSERT INTO orders VALUES (2297, 1943, 9);
+INSERT INTO orders VALUES (2298, 1862, 40);
+INSERT INTO orders VALUES (2299, 1781, 71);
+INSERT INTO orders VALUES (2300, 1700, 5);
+INSERT INTO orders VALUES (2301, 1619, 36);
+INSERT INTO orders VALUES (2302, 1538, 67);
+INSERT INTO orders VALUES (2303, 1457, 1);
+INSERT INTO orders VALUES (2304, 1376, 32);
+INSERT INTO orders VALUES (2305, 1295, 63);
+INSERT INTO orders VALUES (2306, 1214, 94);
+INSERT INTO orders VALUES (2307, 1133, 28);
+INSERT INTO orders VALUES (2308, 1052, 59);
+INSERT INTO orders VALUES (2309, 971, 90);
+INSERT INTO orders VALUES (2310, 890, 24);
+INSERT INTO orders VALUES (2311, 809, 55);
+INSERT INTO orders VALUES (2312, 728, 86);
+INSERT INTO orders VALUES (2313, 647, 20);
+INSERT INTO orders VALUES (2314, 566, 51);
+INSERT INTO orders VALUES (2315, 485, 82);
+INSERT INTO orders VALUES (2316, 404, 16);
+INSERT INTO orders VALUES (2317, 323, 47);
+INSERT INTO orders VALUES (2318, 242, 78);
+INSERT INTO orders VALUES (2319, 161, 12);
+INSERT INTO orders VALUES (2320, 80, 43);
+INSERT INTO orders VALUES (2321, 3999, 74);
+INSERT INTO orders VALUES (2322, 3918, 8);
+INSERT INTO orders VALUES (2323, 3837, 39);
+INSERT INTO orders VALUES (2324, 3756, 70);
+INSERT INTO orders VALUES (2325, 3675, 4);
+INSERT INTO orders VALUES (2326, 3594, 35);
+INSERT INTO orders VALUES (2327, 3513, 66);
+INSERT INTO orders VALUES (2328, 3432, 0);
+INSERT INTO orders VALUES (2329, 3351, 31);
+INSERT INTO orders VALUES (2330, 3270, 62);
+INSERT INTO orders VALUES (2331, 3189, 93);
+INSERT INTO orders VALUES (2332, 3108, 27);
+INSERT INTO orders VALUES (2333, 3027, 58);
+INSERT INTO orders VALUES (2334, 2946, 89);
+INSERT INTO orders VALUES (2335, 2865, 23);
+INSERT INTO orders VALUES (2336, 2784, 54);
+INSERT INTO orders VALUES (2337, 2703, 85);
+INSERT INTO orders VALUES (2338, 2622, 19);
+INSERT INTO orders VALUES (2339, 2541, 50);
+INSERT INTO orders VALUES (2340, 2460, 81);
+INSERT INTO orders VALUES (2341, 2379, 15);
+INSERT INTO orders VALUES (2342, 2298, 46);
+INSERT INTO orders VALUES (2343, 2217, 77);
+INSERT INTO orders VALUES (2344, 2136, 11);
+INSERT INTO orders VALUES (2345, 2055, 42);
+INSERT INTO orders VALUES (2346, 1974, 73);
+INSERT INTO orders VALUES (2347, 1893, 7);
+INSERT INTO orders VALUES (2348, 1812, 38);
+INSERT INTO orders VALUES (2349, 1731, 69);
+INSERT INTO orders VALUES (2350, 1650, 3);
+INSERT INTO orders VALUES (2351, 1569, 34);
+INSERT INTO orders VALUES (2352, 1488, 65);
+INSERT INTO orders VALUES (2353, 1407, 96);
+INSERT INTO orders VALUES (2354, 1326, 30);
+INSERT INTO orders VALUES (2355, 1245, 61);
+INSERT INTO orders VALUES (2356, 1164, 92);
+INSERT INTO orders VALUES (2357, 1083, 26);
+INSERT INTO orders VALUES (2358, 1002, 57);
+INSERT INTO orders VALUES (2359, 921, 88);
+INSERT INTO orders VALUES (2360, 840, 22);
+INSERT INTO orders VALUES (2361, 759, 53);
+INSERT INTO orders VALUES (2362, 678, 84);
+INSERT INTO orders VALUES (2363, 597, 18);
+INSERT INTO orders VALUES (2364, 516, 49);
+INSERT INTO orders VALUES (2365, 435, 80);
+INSERT INTO orders VALUES (2366, 354, 14);
+INSERT INTO orders VALUES (2367, 273, 45);
+INSERT INTO orders VALUES (2368, 192, 76);
+INSERT INTO orders VALUES (2369, 111, 10);
+INSERT INTO orders VALUES (2370, 30, 41);
+INSERT INTO orders VALUES (2371, 3949, 72);
+INSERT INTO orders VALUES (2372, 3868, 6);
+INSERT INTO orders VALUES (2373, 3787, 37);
+INSERT INTO orders VALUES (2374, 3706, 68);
+INSERT INTO orders VALUES (2375, 3625, 2);
+INSERT INTO orders VALUES (2376, 3544, 33);
+INSERT INTO orders VALUES (2377, 3463, 64);
+INSERT INTO orders VALUES (2378, 3382, 95);
+INSERT INTO orders VALUES (2379, 3301, 29);
+INSERT INTO orders VALUES (2380, 3220, 60);
+INSERT INTO orders VALUES (2381, 3139, 91);
+INSERT INTO orders VALUES (2382, 3058, 25);
+INSERT INTO orders VALUES (2383, 2977, 56);
+INSERT INTO orders VALUES (2384, 2896, 87);
+INSERT INTO orders VALUES (2385, 2815, 21);
+INSERT INTO orders VALUES (2386, 2734, 52);
+INSERT INTO orders VALUES (2387, 2653, 83);
+INSERT INTO orders VALUES (2388, 2572, 17);
+INSERT INTO orders VALUES (2389, 2491, 48);
+INSERT INTO orders VALUES (2390, 2410, 79);
+INSERT INTO orders VALUES (2391, 2329, 13);
+INSERT INTO orders VALUES (2392, 2248, 44);
+INSERT INTO orders VALUES (2393, 2167, 75);
+INSERT INTO orders VALUES (2394, 2086, 9);
+INSERT INTO orders VALUES (2395, 2005, 40);
+INSERT INTO orders VALUES (2396, 1924, 71);
+INSERT INTO orders VALUES (2397, 1843, 5);
+INSERT INTO orders VALUES (2398, 1762, 36);
+INSERT INTO orders VALUES (2399, 1681, 67);
+INSERT INTO orders VALUES (2400, 1600, 1);
+INSERT INTO orders VALUES (2401, 1519, 32);
+INSERT INTO orders VALUES (2402, 1438, 63);
+INSERT INTO orders VALUES (2403, 1357, 94);
+INSERT INTO orders VALUES (2404, 1276, 28);
+INSERT INTO orders VALUES (2405, 1195, 59);
+INSERT INTO orders VALUES (2406, 1114, 90);
+INSERT INTO orders VALUES (2407, 1033, 24);
+INSERT INTO orders VALUES (2408, 952, 55);
+INSERT INTO orders VALUES (2409, 871, 86);
+INSERT INTO orders VALUES (2410, 790, 20);
+INSERT INTO orders VALUES (2411, 709, 51);
+INSERT INTO orders VALUES (2412, 628, 82);
+INSERT INTO orders VALUES (2413, 547, 16);
+INSERT INTO orders VALUES (2414, 466, 47);
+INSERT INTO orders VALUES (2415, 385, 78);
+INSERT INTO orders VALUES (2416, 304, 12);
+INSERT INTO orders VALUES (2417, 223, 43);
+INSERT INTO orders VALUES (2418, 142, 74);
+INSERT INTO orders VALUES (2419, 61, 8);
+INSERT INTO orders VALUES (2420, 3980, 39);
+INSERT INTO orders VALUES (2421, 3899, 70);
+INSERT INTO orders VALUES (2422, 3818, 4);
+INSERT INTO orders VALUES (2423, 3737, 35);
+INSERT INTO orders VALUES (2424, 3656, 66);
+INSERT INTO orders VALUES (2425, 3575, 0);
+INSERT INTO orders VALUES (2426, 3494, 31);
+INSERT INTO orders VALUES (2427, 3413, 62);
+INSERT INTO orders VALUES (2428, 3332, 93);
+INSERT INTO orders VALUES (2429, 3251, 27);
+INSERT INTO orders VALUES (2430, 3170, 58);
+INSERT INTO orders VALUES (2431, 3089, 89);
+INSERT INTO orders VALUES (2432, 3008, 23);
+INSERT INTO orders VALUES (2433, 2927, 54);
+INSERT INTO orders VALUES (2434, 2846, 85);
+INSERT INTO orders VALUES (2435, 2765, 19);
+INSERT INTO orders VALUES (2436, 2684, 50);
+INSERT INTO orders VALUES (2437, 2603, 81);
+INSERT INTO orders VALUES (2438, 2522, 15);
+INSERT INTO orders VALUES (2439, 2441, 46);
+INSERT INTO orders VALUES (2440, 2360, 77);
+INSERT INTO orders VALUES (2441, 2279, 11);
+INSERT INTO orders VALUES (2442, 2198, 42);
+INSERT INTO orders VALUES (2443, 2117, 73);
+INSERT INTO orders VALUES (2444, 2036, 7);
+INSERT INTO orders VALUES (2445, 1955, 38);
+INSERT INTO orders VALUES (2446, 1874, 69);
+INSERT INTO orders VALUES (2447, 1793, 3);
+INSERT INTO orders VALUES (2448, 1712, 34);
+INSERT INTO orders VALUES (2449, 1631, 65);
+INSERT INTO orders VALUES (2450, 1550, 96);
+INSERT INTO orders VALUES (2451, 1469, 30);
+INSERT INTO orders VALUES (2452, 1388, 61);
+INSERT INTO orders VALUES (2453, 1307, 92);
+INSERT INTO orders VALUES (2454, 1226, 26);
+INSERT INTO orders VALUES (2455, 1145, 57);
+INSERT INTO orders VALUES (2456, 1064, 88);
+INSERT INTO orders VALUES (2457, 983, 22);
+INSERT INTO orders VALUES (2458, 902, 53);
+INSERT INTO orders VALUES (2459, 821, 84);
+INSERT INTO orders VALUES (2460, 740, 18);
+INSERT INTO orders VALUES (2461, 659, 49);
+INSERT INTO orders VALUES (2462, 578, 80);
+INSERT INTO orders VALUES (2463, 497, 14);
+INSERT INTO orders VALUES (2464, 416, 45);
+INSERT INTO orders VALUES (2465, 335, 76);
+INSERT INTO orders VALUES (2466, 254, 10);
+INSERT INTO orders VALUES (2467, 173, 41);
+INSERT INTO orders VALUES (2468, 92, 72);
+INSERT INTO orders VALUES (2469, 11, 6);
+INSERT INTO orders VALUES (2470, 3930, 37);
+INSERT INTO orders VALUES (2471, 3849, 68);
+INSERT INTO orders VALUES (2472, 3768, 2);
+INSERT INTO orders VALUES (2473, 3687, 33);
+INSERT INTO orders VALUES (2474, 3606, 64);
+INSERT INTO orders VALUES (2475, 3525, 95);
+INSERT INTO orders VALUES (2476, 3444, 29);
+INSERT INTO orders VALUES (2477, 3363, 60);
+INSERT INTO orders VALUES (2478, 3282, 91);
+INSERT INTO orders VALUES (2479, 3201, 25);
+INSERT INTO orders VALUES (2480, 3120, 56);
+INSERT INTO orders VALUES (2481, 3039, 87);
+INSERT INTO orders VALUES (2482, 2958, 21);
+INSERT INTO orders VALUES (2483, 2877, 52);
+INSERT INTO orders VALUES (2484, 2796, 83);
+INSERT INTO orders VALUES (2485, 2715, 17);
+INSERT INTO orders VALUES (2486, 2634, 48);
+INSERT INTO orders VALUES (2487, 2553, 79);
+INSERT INTO orders VALUES (2488, 2472, 13);
+INSERT INTO orders VALUES (2489, 2391, 44);
+INSERT INTO orders VALUES (2490, 2310, 75);
+INSERT INTO orders VALUES (2491, 2229, 9);
+INSERT INTO orders VALUES (2492, 2148, 40);
+INSERT INTO orders VALUES (2493, 2067, 71);
+INSERT INTO orders VALUES (2494, 1986, 5);
+INSERT INTO orders VALUES (2495, 1905, 36);
+INSERT INTO orders VALUES (2496, 1824, 67);
+INSERT INTO orders VALUES (2497, 1743, 1);
+INSERT INTO orders VALUES (2498, 1662, 32);
+INSERT INTO orders VALUES (2499, 1581, 63);
+INSERT INTO orders VALUES (2500, 1500, 94);
+INSERT INTO orders VALUES (2501, 1419, 28);
+INSERT INTO orders VALUES (2502, 1338, 59);
+INSERT INTO orders VALUES (2503, 1257, 90);
+INSERT INTO orders VALUES (2504, 1176, 24);
+INSERT INTO orders VALUES (2505, 1095, 55);
+INSERT INTO orders VALUES (2506, 1014, 86);
+INSERT INTO orders VALUES (2507, 933, 20);
+INSERT INTO orders VALUES (2508, 852, 51);
+INSERT INTO orders VALUES (2509, 771, 82);
+INSERT INTO orders VALUES (2510, 690, 16);
+INSERT INTO orders VALUES (2511, 609, 47);
+INSERT INTO orders VALUES (2512, 528, 78);
+INSERT INTO orders VALUES (2513, 447, 12);
+INSERT INTO orders VALUES (2514, 366, 43);
+INSERT INTO orders VALUES (2515, 285, 74);
+INSERT INTO orders VALUES (2516, 204, 8);
+INSERT INTO orders VALUES (2517, 123, 39);
+INSERT INTO orders VALUES (2518, 42, 70);
+INSERT INTO orders VALUES (2519, 3961, 4);
+INSERT INTO orders VALUES (2520, 3880, 35);
+INSERT INTO orders VALUES (2521, 3799, 66);
+INSERT INTO orders VALUES (2522, 3718, 0);
+INSERT INTO orders VALUES (2523, 3637, 31);
+INSERT INTO orders VALUES (2524, 3556, 62);
+INSERT INTO orders VALUES (2525, 3475, 93);
+INSERT INTO orders VALUES (2526, 3394, 27);
+INSERT INTO orders VALUES (2527, 3313, 58);
+INSERT INTO orders VALUES (2528, 3232, 89);
+INSERT INTO orders VALUES (2529, 3151, 23);
+INSERT INTO orders VALUES (2530, 3070, 54);
+INSERT INTO orders VALUES (2531, 2989, 85);
+INSERT INTO orders VALUES (2532, 2908, 19);
+INSERT INTO orders VALUES (2533, 2827, 50);
+INSERT INTO orders VALUES (2534, 2746, 81);
+INSERT INTO orders VALUES (2535, 2665, 15);
+INSERT INTO orders VALUES (2536, 2584, 46);
+INSERT INTO orders VALUES (2537, 2503, 77);
+INSERT INTO orders VALUES (2538, 2422, 11);
+INSERT INTO orders VALUES (2539, 2341, 42);
+INSERT INTO orders VALUES (2540, 2260, 73);
+INSERT INTO orders VALUES (2541, 2179, 7);
+INSERT INTO orders VALUES (2542, 2098, 38);
+INSERT INTO orders VALUES (2543, 2017, 69);
+INSERT INTO orders VALUES (2544, 1936, 3);
+INSERT INTO orders VALUES (2545, 1855, 34);
+INSERT INTO orders VALUES (2546, 1774, 65);
+INSERT INTO orders VALUES (2547, 1693, 96);
+INSERT INTO orders VALUES (2548, 1612, 30);
+INSERT INTO orders VALUES (2549, 1531, 61);
+INSERT INTO orders VALUES (2550, 1450, 92);
+INSERT INTO orders VALUES (2551, 1369, 26);
+INSERT INTO orders VALUES (2552, 1288, 57);
+INSERT INTO orders VALUES (2553, 1207, 88);
+INSERT INTO orders VALUES (2554, 1126, 22);
+INSERT INTO orders VALUES (2555, 1045, 53);
+INSERT INTO orders VALUES (2556, 964, 84);
+INSERT INTO orders VALUES (2557, 883, 18);
+INSERT INTO orders VALUES (2558, 802, 49);
+INSERT INTO orders VALUES (2559, 721, 80);
+INSERT INTO orders VALUES (2560, 640, 14);
+INSERT INTO orders VALUES (2561, 559, 45);
+INSERT INTO orders VALUES (2562, 478, 76);
+INSERT INTO orders VALUES (2563, 397, 10);
+INSERT INTO orders VALUES (2564, 316, 41);
+INSERT INTO orders VALUES (2565, 235, 72);
+INSERT INTO orders VALUES (2566, 154, 6);
+INSERT INTO orders VALUES (2567, 73, 37);
+INSERT INTO orders VALUES (2568, 3992, 68);
+INSERT INTO orders VALUES (2569, 3911, 2);
+INSERT INTO orders VALUES (2570, 3830, 33);
+INSERT INTO orders VALUES (2571, 3749, 64);
+INSERT INTO orders VALUES (2572, 3668, 95);
+INSERT INTO orders VALUES (2573, 3587, 29);
+INSERT INTO orders VALUES (2574, 3506, 60);
+INSERT INTO orders VALUES (2575, 3425, 91);
+INSERT INTO orders VALUES (2576, 3344, 25);
+INSERT INTO orders VALUES (2577, 3263, 56);
+INSERT INTO orders VALUES (2578, 3182, 87);
+INSERT INTO orders VALUES (2579, 3101, 21);
+INSERT INTO orders VALUES (2580, 3020, 52);
+INSERT INTO orders VALUES (2581, 2939, 83);
+INSERT INTO orders VALUES (2582, 2858, 17);
+INSERT INTO orders VALUES (2583, 2777, 48);
+INSERT INTO orders VALUES (2584, 2696, 79);
+INSERT INTO orders VALUES (2585, 2615, 13);
+INSERT INTO orders VALUES (2586, 2534, 44);
+INSERT INTO orders VALUES (2587, 2453, 75);
+INSERT INTO orders VALUES (2588, 2372, 9);
+INSERT INTO orders VALUES (2589, 2291, 40);
+INSERT INTO orders VALUES (2590, 2210, 71);
+INSERT INTO orders VALUES (2591, 2129, 5);
+INSERT INTO orders VALUES (2592, 2048, 36);
+INSERT INTO orders VALUES (2593, 1967, 67);
+INSERT INTO orders VALUES (2594, 1886, 1);
+INSERT INTO orders VALUES (2595, 1805, 32);
+INSERT INTO orders VALUES (2596, 1724, 63);
+INSERT INTO orders VALUES (2597, 1643, 94);
+INSERT INTO orders VALUES (2598, 1562, 28);
+INSERT INTO orders VALUES (2599, 1481, 59);
+INSERT INTO orders VALUES (2600, 1400, 90);
+INSERT INTO orders VALUES (2601, 1319, 24);
+INSERT INTO orders VALUES (2602, 1238, 55);
+INSERT INTO orders VALUES (2603, 1157, 86);
+INSERT INTO orders VALUES (2604, 1076, 20);
+INSERT INTO orders VALUES (2605, 995, 51);
+INSERT INTO orders VALUES (2606, 914, 82);
+INSERT INTO orders VALUES (2607, 833, 16);
+INSERT INTO orders VALUES (2608, 752, 47);
+INSERT INTO orders VALUES (2609, 671, 78);
+INSERT INTO orders VALUES (2610, 590, 12);
+INSERT INTO orders VALUES (2611, 509, 43);
+INSERT INTO orders VALUES (2612, 428, 74);
+INSERT INTO orders VALUES (2613, 347, 8);
+INSERT INTO orders VALUES (2614, 266, 39);
+INSERT INTO orders VALUES (2615, 185, 70);
+INSERT INTO orders VALUES (2616, 104, 4);
+INSERT INTO orders VALUES (2617, 23, 35);
+INSERT INTO orders VALUES (2618, 3942, 66);
+INSERT INTO orders VALUES (2619, 3861, 0);
+INSERT INTO orders VALUES (2620, 3780, 31);
+INSERT INTO orders VALUES (2621, 3699, 62);
+INSERT INTO orders VALUES (2622, 3618, 93);
+INSERT INTO orders VALUES (2623, 3537, 27);
+INSERT INTO orders VALUES (2624, 3456, 58);
+INSERT INTO orders VALUES (2625, 3375, 89);
+INSERT INTO orders VALUES (2626, 3294, 23);
+INSERT INTO orders VALUES (2627, 3213, 54);
+INSERT INTO orders VALUES (2628, 3132, 85);
+INSERT INTO orders VALUES (2629, 3051, 19);
+INSERT INTO orders VALUES (2630, 2970, 50);
+INSERT INTO orders VALUES (2631, 2889, 81);
+INSERT INTO orders VALUES (2632, 2808, 15);
+INSERT INTO orders VALUES (2633, 2727, 46);
+INSERT INTO orders VALUES (2634, 2646, 77);
+INSERT INTO orders VALUES (2635, 2565, 11);
+INSERT INTO orders VALUES (2636, 2484, 42);
+INSERT INTO orders VALUES (2637, 2403, 73);
+INSERT INTO orders VALUES (2638, 2322, 7);
+INSERT INTO orders VALUES (2639, 2241, 38);
+INSERT INTO orders VALUES (2640, 2160, 69);
+INSERT INTO orders VALUES (2641, 2079, 3);
+INSERT INTO orders VALUES (2642, 1998, 34);
+INSERT INTO orders VALUES (2643, 1917, 65);
+INSERT INTO orders VALUES (2644, 1836, 96);
+INSERT INTO orders VALUES (2645, 1755, 30);
+INSERT INTO orders VALUES (2646, 1674, 61);
+INSERT INTO orders VALUES (2647, 1593, 92);
+INSERT INTO orders VALUES (2648, 1512, 26);
+INSERT INTO orders VALUES (2649, 1431, 57);
+INSERT INTO orders VALUES (2650, 1350, 88);
+INSERT INTO orders VALUES (2651, 1269, 22);
+INSERT INTO orders VALUES (2652, 1188, 53);
+INSERT INTO orders VALUES (2653, 1107, 84);
+INSERT INTO orders VALUES (2654, 1026, 18);
+INSERT INTO orders VALUES (2655, 945, 49);
+INSERT INTO orders VALUES (2656, 864, 80);
+INSERT INTO orders VALUES (2657, 783, 14);
+INSERT INTO orders VALUES (2658, 702, 45);
+INSERT INTO orders VALUES (2659, 621, 76);
+INSERT INTO orders VALUES (2660, 540, 10);
+INSERT INTO orders VALUES (2661, 459, 41);
+INSERT INTO orders VALUES (2662, 378, 72);
+INSERT INTO orders VALUES (2663, 297, 6);
+INSERT INTO orders VALUES (2664, 216, 37);
+INSERT INTO orders VALUES (2665, 135, 68);
+INSERT INTO orders VALUES (2666, 54, 2);
+INSERT INTO orders VALUES (2667, 3973, 33);
+INSERT INTO orders VALUES (2668, 3892, 64);
+INSERT INTO orders VALUES (2669, 3811, 95);
+INSERT INTO orders VALUES (2670, 3730, 29);
+INSERT INTO orders VALUES (2671, 3649, 60);
+INSERT INTO orders VALUES (2672, 3568, 91);
+INSERT INTO orders VALUES (2673, 3487, 25);
+INSERT INTO orders VALUES (2674, 3406, 56);
+INSERT INTO orders VALUES (2675, 3325, 87);
+INSERT INTO orders VALUES (2676, 3244, 21);
+INSERT INTO orders VALUES (2677, 3163, 52);
+INSERT INTO orders VALUES (2678, 3082, 83);
+INSERT INTO orders VALUES (2679, 3001, 17);
+INSERT INTO orders VALUES (2680, 2920, 48);
+INSERT INTO orders VALUES (2681, 2839, 79);
+INSERT INTO orders VALUES (2682, 2758, 13);
+INSERT INTO orders VALUES (2683, 2677, 44);
+INSERT INTO orders VALUES (2684, 2596, 75);
+INSERT INTO orders VALUES (2685, 2515, 9);
+INSERT INTO orders VALUES (2686, 2434, 40);
+INSERT INTO orders VALUES (2687, 2353, 71);
+INSERT INTO orders VALUES (2688, 2272, 5);
+INSERT INTO orders VALUES (2689, 2191, 36);
+INSERT INTO orders VALUES (2690, 2110, 67);
+INSERT INTO orders VALUES (2691, 2029, 1);
+INSERT INTO orders VALUES (2692, 1948, 32);
+INSERT INTO orders VALUES (2693, 1867, 63);
+INSERT INTO orders VALUES (2694, 1786, 94);
+INSERT INTO orders VALUES (2695, 1705, 28);
+INSERT INTO orders VALUES (2696, 1624, 59);
+INSERT INTO orders VALUES (2697, 1543, 90);
+INSERT INTO orders VALUES (2698, 1462, 24);
+INSERT INTO orders VALUES (2699, 1381, 55);
+INSERT INTO orders VALUES (2700, 1300, 86);
+INSERT INTO orders VALUES (2701, 1219, 20);
+INSERT INTO orders VALUES (2702, 1138, 51);
+INSERT INTO orders VALUES (2703, 1057, 82);
+INSERT INTO orders VALUES (2704, 976, 16);
+INSERT INTO orders VALUES (2705, 895, 47);
+INSERT INTO orders VALUES (2706, 814, 78);
+INSERT INTO orders VALUES (2707, 733, 12);
+INSERT INTO orders VALUES (2708, 652, 43);
+INSERT INTO orders VALUES (2709, 571, 74);
+INSERT INTO orders VALUES (2710, 490, 8);
+INSERT INTO orders VALUES (2711, 409, 39);
+INSERT INTO orders VALUES (2712, 328, 70);
+INSERT INTO orders VALUES (2713, 247, 4);
+INSERT INTO orders VALUES (2714, 166, 35);
+INSERT INTO orders VALUES (2715, 85, 66);
+INSERT INTO orders VALUES (2716, 4, 0);
+INSERT INTO orders VALUES (2717, 3923, 31);
+INSERT INTO orders VALUES (2718, 3842, 62);
+INSERT INTO orders VALUES (2719, 3761, 93);
+INSERT INTO orders VALUES (2720, 3680, 27);
+INSERT INTO orders VALUES (2721, 3599, 58);
+INSERT INTO orders VALUES (2722, 3518, 89);
+INSERT INTO orders VALUES (2723, 3437, 23);
+INSERT INTO orders VALUES (2724, 3356, 54);
+INSERT INTO orders VALUES (2725, 3275, 85);
+INSERT INTO orders VALUES (2726, 3194, 19);
+INSERT INTO orders VALUES (2727, 3113, 50);
+INSERT INTO orders VALUES (2728, 3032, 81);
+INSERT INTO orders VALUES (2729, 2951, 15);
+INSERT INTO orders VALUES (2730, 2870, 46);
+INSERT INTO orders VALUES (2731, 2789, 77);
+INSERT INTO orders VALUES (2732, 2708, 11);
+INSERT INTO orders VALUES (2733, 2627, 42);
+INSERT INTO orders VALUES (2734, 2546, 73);
+INSERT INTO orders VALUES (2735, 2465, 7);
+INSERT INTO orders VALUES (2736, 2384, 38);
+INSERT INTO orders VALUES (2737, 2303, 69);
+INSERT INTO orders VALUES (2738, 2222, 3);
+INSERT INTO orders VALUES (2739, 2141, 34);
+INSERT INTO orders VALUES (2740, 2060, 65);
+INSERT INTO orders VALUES (2741, 1979, 96);
+INSERT INTO orders VALUES (2742, 1898, 30);
+INSERT INTO orders VALUES (2743, 1817, 61);
+INSERT INTO orders VALUES (2744, 1736, 92);
+INSERT INTO orders VALUES (2745, 1655, 26);
+INSERT INTO orders VALUES (2746, 1574, 57);
+INSERT INTO orders VALUES (2747, 1493, 88);
+INSERT INTO orders VALUES (2748, 1412, 22);
+INSERT INTO orders VALUES (2749, 1331, 53);
+INSERT INTO orders VALUES (2750, 1250, 84);
+INSERT INTO orders VALUES (2751, 1169, 18);
+INSERT INTO orders VALUES (2752, 1088, 49);
+INSERT INTO orders VALUES (2753, 1007, 80);
+INSERT INTO orders VALUES (2754, 926, 14);
+INSERT INTO orders VALUES (2755, 845, 45);
+INSERT INTO orders VALUES (2756, 764, 76);
+INSERT INTO orders VALUES (2757, 683, 10);
+INSERT INTO orders VALUES (2758, 602, 41);
+INSERT INTO orders VALUES (2759, 521, 72);
+INSERT INTO orders VALUES (2760, 440, 6);
+INSERT INTO orders VALUES (2761, 359, 37);
+INSERT INTO orders VALUES (2762, 278, 68);
+INSERT INTO orders VALUES (2763, 197, 2);
+INSERT INTO orders VALUES (2764, 116, 33);
+INSERT INTO orders VALUES (2765, 35, 64);
+INSERT INTO orders VALUES (2766, 3954, 95);
+INSERT INTO orders VALUES (2767, 3873, 29);
+INSERT INTO orders VALUES (2768, 3792, 60);
+INSERT INTO orders VALUES (2769, 3711, 91);
+INSERT INTO orders VALUES (2770, 3630, 25);
+INSERT INTO orders VALUES (2771, 3549, 56);
+INSERT INTO orders VALUES (2772, 3468, 87);
+INSERT INTO orders VALUES (2773, 3387, 21);
+INSERT INTO orders VALUES (2774, 3306, 52);
+INSERT INTO orders VALUES (2775, 3225, 83);
+INSERT INTO orders VALUES (2776, 3144, 17);
+INSERT INTO orders VALUES (2777, 3063, 48);
+INSERT INTO orders VALUES (2778, 2982, 79);
+INSERT INTO orders VALUES (2779, 2901, 13);
+INSERT INTO orders VALUES (2780, 2820, 44);
+INSERT INTO orders VALUES (2781, 2739, 75);
+INSERT INTO orders VALUES (2782, 2658, 9);
+INSERT INTO orders VALUES (2783, 2577, 40);
+INSERT INTO orders VALUES (2784, 2496, 71);
+INSERT INTO orders VALUES (2785, 2415, 5);
+INSERT INTO orders VALUES (2786, 2334, 36);
+INSERT INTO orders VALUES (2787, 2253, 67);
+INSERT INTO orders VALUES (2788, 2172, 1);
+INSERT INTO orders VALUES (2789, 2091, 32);
+INSERT INTO orders VALUES (2790, 2010, 63);
+INSERT INTO orders VALUES (2791, 1929, 94);
+INSERT INTO orders VALUES (2792, 1848, 28);
+INSERT INTO orders VALUES (2793, 1767, 59);
+INSERT INTO orders VALUES (2794, 1686, 90);
+INSERT INTO orders VALUES (2795, 1605, 24);
+INSERT INTO orders VALUES (2796, 1524, 55);
+INSERT INTO orders VALUES (2797, 1443, 86);
+INSERT INTO orders VALUES (2798, 1362, 20);
+INSERT INTO orders VALUES (2799, 1281, 51);
+INSERT INTO orders VALUES (2800, 1200, 82);
+INSERT INTO orders VALUES (2801, 1119, 16);
+INSERT INTO orders VALUES (2802, 1038, 47);
+INSERT INTO orders VALUES (2803, 957, 78);
+INSERT INTO orders VALUES (2804, 876, 12);
+INSERT INTO orders VALUES (2805, 795, 43);
+INSERT INTO orders VALUES (2806, 714, 74);
+INSERT INTO orders VALUES (2807, 633, 8);
+INSERT INTO orders VALUES (2808, 552, 39);
+INSERT INTO orders VALUES (2809, 471, 70);
+INSERT INTO orders VALUES (2810, 390, 4);
+INSERT INTO orders VALUES (2811, 309, 35);
+INSERT INTO orders VALUES (2812, 228, 66);
+INSERT INTO orders VALUES (2813, 147, 0);
+INSERT INTO orders VALUES (2814, 66, 31);
+INSERT INTO orders VALUES (2815, 3985, 62);
+INSERT INTO orders VALUES (2816, 3904, 93);
+INSERT INTO orders VALUES (2817, 3823, 27);
+INSERT INTO orders VALUES (2818, 3742, 58);
+INSERT INTO orders VALUES (2819, 3661, 89);
+INSERT INTO orders VALUES (2820, 3580, 23);
+INSERT INTO orders VALUES (2821, 3499, 54);
+INSERT INTO orders VALUES (2822, 3418, 85);
+INSERT INTO orders VALUES (2823, 3337, 19);
+INSERT INTO orders VALUES (2824, 3256, 50);
+INSERT INTO orders VALUES (2825, 3175, 81);
+INSERT INTO orders VALUES (2826, 3094, 15);
+INSERT INTO orders VALUES (2827, 3013, 46);
+INSERT INTO orders VALUES (2828, 2932, 77);
+INSERT INTO orders VALUES (2829, 2851, 11);
+INSERT INTO orders VALUES (2830, 2770, 42);
+INSERT INTO orders VALUES (2831, 2689, 73);
+INSERT INTO orders VALUES (2832, 2608, 7);
+INSERT INTO orders VALUES (2833, 2527, 38);
+INSERT INTO orders VALUES (2834, 2446, 69);
+INSERT INTO orders VALUES (2835, 2365, 3);
+INSERT INTO orders VALUES (2836, 2284, 34);
+INSERT INTO orders VALUES (2837, 2203, 65);
+INSERT INTO orders VALUES (2838, 2122, 96);
+INSERT INTO orders VALUES (2839, 2041, 30);
+INSERT INTO orders VALUES (2840, 1960, 61);
+INSERT INTO orders VALUES (2841, 1879, 92);
+INSERT INTO orders VALUES (2842, 1798, 26);
+INSERT INTO orders VALUES (2843, 1717, 57);
+INSERT INTO orders VALUES (2844, 1636, 88);
+INSERT INTO orders VALUES (2845, 1555, 22);
+INSERT INTO orders VALUES (2846, 1474, 53);
+INSERT INTO orders VALUES (2847, 1393, 84);
+INSERT INTO orders VALUES (2848, 1312, 18);
+INSERT INTO orders VALUES (2849, 1231, 49);
+INSERT INTO orders VALUES (2850, 1150, 80);
+INSERT INTO orders VALUES (2851, 1069, 14);
+INSERT INTO orders VALUES (2852, 988, 45);
+INSERT INTO orders VALUES (2853, 907, 76);
+INSERT INTO orders VALUES (2854, 826, 10);
+INSERT INTO orders VALUES (2855, 745, 41);
+INSERT INTO orders VALUES (2856, 664, 72);
+INSERT INTO orders VALUES (2857, 583, 6);
+INSERT INTO orders VALUES (2858, 502, 37);
+INSERT INTO orders VALUES (2859, 421, 68);
+INSERT INTO orders VALUES (2860, 340, 2);
+INSERT INTO orders VALUES (2861, 259, 33);
+INSERT INTO orders VALUES (2862, 178, 64);
+INSERT INTO orders VALUES (2863, 97, 95);
+INSERT INTO orders VALUES (2864, 16, 29);
+INSERT INTO orders VALUES (2865, 3935, 60);
+INSERT INTO orders VALUES (2866, 3854, 91);
+INSERT INTO orders VALUES (2867, 3773, 25);
+INSERT INTO orders VALUES (2868, 3692, 56);
+INSERT INTO orders VALUES (2869, 3611, 87);
+INSERT INTO orders VALUES (2870, 3530, 21);
+INSERT INTO orders VALUES (2871, 3449, 52);
+INSERT INTO orders VALUES (2872, 3368, 83);
+INSERT INTO orders VALUES (2873, 3287, 17);
+INSERT INTO orders VALUES (2874, 3206, 48);
+INSERT INTO orders VALUES (2875, 3125, 79);
+INSERT INTO orders VALUES (2876, 3044, 13);
+INSERT INTO orders VALUES (2877, 2963, 44);
+INSERT INTO orders VALUES (2878, 2882, 75);
+INSERT INTO orders VALUES (2879, 2801, 9);
+INSERT INTO orders VALUES (2880, 2720, 40);
+INSERT INTO orders VALUES (2881, 2639, 71);
+INSERT INTO orders VALUES (2882, 2558, 5);
+INSERT INTO orders VALUES (2883, 2477, 36);
+INSERT INTO orders VALUES (2884, 2396, 67);
+INSERT INTO orders VALUES (2885, 2315, 1);
+INSERT INTO orders VALUES (2886, 2234, 32);
+INSERT INTO orders VALUES (2887, 2153, 63);
+INSERT INTO orders VALUES (2888, 2072, 94);
+INSERT INTO orders VALUES (2889, 1991, 28);
+INSERT INTO orders VALUES (2890, 1910, 59);
+INSERT INTO orders VALUES (2891, 1829, 90);
+INSERT INTO orders VALUES (2892, 1748, 24);
+INSERT INTO orders VALUES (2893, 1667, 55);
+INSERT INTO orders VALUES (2894, 1586, 86);
+INSERT INTO orders VALUES (2895, 1505, 20);
+INSERT INTO orders VALUES (2896, 1424, 51);
+INSERT INTO orders VALUES (2897, 1343, 82);
+INSERT INTO orders VALUES (2898, 1262, 16);
+INSERT INTO orders VALUES (2899, 1181, 47);
+INSERT INTO orders VALUES (2900, 1100, 78);
+INSERT INTO orders VALUES (2901, 1019, 12);
+INSERT INTO orders VALUES (2902, 938, 43);
+INSERT INTO orders VALUES (2903, 857, 74);
+INSERT INTO orders VALUES (2904, 776, 8);
+INSERT INTO orders VALUES (2905, 695, 39);
+INSERT INTO orders VALUES (2906, 614, 70);
+INSERT INTO orders VALUES (2907, 533, 4);
+INSERT INTO orders VALUES (2908, 452, 35);
+INSERT INTO orders VALUES (2909, 371, 66);
+INSERT INTO orders VALUES (2910, 290, 0);
+INSERT INTO orders VALUES (2911, 209, 31);
+INSERT INTO orders VALUES (2912, 128, 62);
+INSERT INTO orders VALUES (2913, 47, 93);
+INSERT INTO orders VALUES (2914, 3966, 27);
+INSERT INTO orders VALUES (2915, 3885, 58);
+INSERT INTO orders VALUES (2916, 3804, 89);
+INSERT INTO orders VALUES (2917, 3723, 23);
+INSERT INTO orders VALUES (2918, 3642, 54);
+INSERT INTO orders VALUES (2919, 3561, 85);
+INSERT INTO orders VALUES (2920, 3480, 19);
+INSERT INTO orders VALUES (2921, 3399, 50);
+INSERT INTO orders VALUES (2922, 3318, 81);
+INSERT INTO orders VALUES (2923, 3237, 15);
+INSERT INTO orders VALUES (2924, 3156, 46);
+INSERT INTO orders VALUES (2925, 3075, 77);
+INSERT INTO orders VALUES (2926, 2994, 11);
+INSERT INTO orders VALUES (2927, 2913, 42);
+INSERT INTO orders VALUES (2928, 2832, 73);
+INSERT INTO orders VALUES (2929, 2751, 7);
+INSERT INTO orders VALUES (2930, 2670, 38);
+INSERT INTO orders VALUES (2931, 2589, 69);
+INSERT INTO orders VALUES (2932, 2508, 3);
+INSERT INTO orders VALUES (2933, 2427, 34);
+INSERT INTO orders VALUES (2934, 2346, 65);
+INSERT INTO orders VALUES (2935, 2265, 96);
+INSERT INTO orders VALUES (2936, 2184, 30);
+INSERT INTO orders VALUES (2937, 2103, 61);
+INSERT INTO orders VALUES (2938, 2022, 92);
+INSERT INTO orders VALUES (2939, 1941, 26);
+INSERT INTO orders VALUES (2940, 1860, 57);
+INSERT INTO orders VALUES (2941, 1779, 88);
+INSERT INTO orders VALUES (2942, 1698, 22);
+INSERT INTO orders VALUES (2943, 1617, 53);
+INSERT INTO orders VALUES (2944, 1536, 84);
+INSERT INTO orders VALUES (2945, 1455, 18);
+INSERT INTO orders VALUES (2946, 1374, 49);
+INSERT INTO orders VALUES (2947, 1293, 80);
+INSERT INTO orders VALUES (2948, 1212, 14);
+INSERT INTO orders VALUES (2949, 1131, 45);
+INSERT INTO orders VALUES (2950, 1050, 76);
+INSERT INTO orders VALUES (2951, 969, 10);
+INSERT INTO orders VALUES (2952, 888, 41);
+INSERT INTO orders VALUES (2953, 807, 72);
+INSERT INTO orders VALUES (2954, 726, 6);
+INSERT INTO orders VALUES (2955, 645, 37);
+INSERT INTO orders VALUES (2956, 564, 68);
+INSERT INTO orders VALUES (2957, 483, 2);
+INSERT INTO orders VALUES (2958, 402, 33);
+INSERT INTO orders VALUES (2959, 321, 64);
+INSERT INTO orders VALUES (2960, 240, 95);
+INSERT INTO orders VALUES (2961, 159, 29);
+INSERT INTO orders VALUES (2962, 78, 60);
+INSERT INTO orders VALUES (2963, 3997, 91);
+INSERT INTO orders VALUES (2964, 3916, 25);
+INSERT INTO orders VALUES (2965, 3835, 56);
+INSERT INTO orders VALUES (2966, 3754, 87);
+INSERT INTO orders VALUES (2967, 3673, 21);
+INSERT INTO orders VALUES (2968, 3592, 52);
+INSERT INTO orders VALUES (2969, 3511, 83);
+INSERT INTO orders VALUES (2970, 3430, 17);
+INSERT INTO orders VALUES (2971, 3349, 48);
+INSERT INTO orders VALUES (2972, 3268, 79);
+INSERT INTO orders VALUES (2973, 3187, 13);
+INSERT INTO orders VALUES (2974, 3106, 44);
+INSERT INTO orders VALUES (2975, 3025, 75);
+INSERT INTO orders VALUES (2976, 2944, 9);
+INSERT INTO orders VALUES (2977, 2863, 40);
+INSERT INTO orders VALUES (2978, 2782, 71);
+INSERT INTO orders VALUES (2979, 2701, 5);
+INSERT INTO orders VALUES (2980, 2620, 36);
+INSERT INTO orders VALUES (2981, 2539, 67);
+INSERT INTO orders VALUES (2982, 2458, 1);
+INSERT INTO orders VALUES (2983, 2377, 32);
+INSERT INTO orders VALUES (2984, 2296, 63);
+INSERT INTO orders VALUES (2985, 2215, 94);
+INSERT INTO orders VALUES (2986, 2134, 28);
+INSERT INTO orders VALUES (2987, 2053, 59);
+INSERT INTO orders VALUES (2988, 1972, 90);
+INSERT INTO orders VALUES (2989, 1891, 24);
+INSERT INTO orders VALUES (2990, 1810, 55);
+INSERT INTO orders VALUES (2991, 1729, 86);
+INSERT INTO orders VALUES (2992, 1648, 20);
+INSERT INTO orders VALUES (2993, 1567, 51);
+INSERT INTO orders VALUES (2994, 1486, 82);
+INSERT INTO orders VALUES (2995, 1405, 16);
+INSERT INTO orders VALUES (2996, 1324, 47);
+INSERT INTO orders VALUES (2997, 1243, 78);
+INSERT INTO orders VALUES (2998, 1162, 12);
+INSERT INTO orders VALUES (2999, 1081, 43);
+INSERT INTO orders VALUES (3000, 1000, 74);
+INSERT INTO orders VALUES (3001, 919, 8);
+INSERT INTO orders VALUES (3002, 838, 39);
+INSERT INTO orders VALUES (3003, 757, 70);
+INSERT INTO orders VALUES (3004, 676, 4);
+INSERT INTO orders VALUES (3005, 595, 35);
+INSERT INTO orders VALUES (3006, 514, 66);
+INSERT INTO orders VALUES (3007, 433, 0);
+INSERT INTO orders VALUES (3008, 352, 31);
+INSERT INTO orders VALUES (3009, 271, 62);
+INSERT INTO orders VALUES (3010, 190, 93);
+INSERT INTO orders VALUES (3011, 109, 27);
+INSERT INTO orders VALUES (3012, 28, 58);
+INSERT INTO orders VALUES (3013, 3947, 89);
+INSERT INTO orders VALUES (3014, 3866, 23);
+INSERT INTO orders VALUES (3015, 3785, 54);
+INSERT INTO orders VALUES (3016, 3704, 85);
+INSERT INTO orders VALUES (3017, 3623, 19);
+INSERT INTO orders VALUES (3018, 3542, 50);
+INSERT INTO orders VALUES (3019, 3461, 81);
+INSERT INTO orders VALUES (3020, 3380, 15);
+INSERT INTO orders VALUES (3021, 3299, 46);
+INSERT INTO orders VALUES (3022, 3218, 77);
+INSERT INTO orders VALUES (3023, 3137, 11);
+INSERT INTO orders VALUES (3024, 3056, 42);
+INSERT INTO orders VALUES (3025, 2975, 73);
+INSERT INTO orders VALUES (3026, 2894, 7);
+INSERT INTO orders VALUES (3027, 2813, 38);
+INSERT INTO orders VALUES (3028, 2732, 69);
+INSERT INTO orders VALUES (3029, 2651, 3);
+INSERT INTO orders VALUES (3030, 2570, 34);
+INSERT INTO orders VALUES (3031, 2489, 65);
+INSERT INTO orders VALUES (3032, 2408, 96);
+INSERT INTO orders VALUES (3033, 2327, 30);
+INSERT INTO orders VALUES (3034, 2246, 61);
+INSERT INTO orders VALUES (3035, 2165, 92);
+INSERT INTO orders VALUES (3036, 2084, 26);
+INSERT INTO orders VALUES (3037, 2003, 57);
+INSERT INTO orders VALUES (3038, 1922, 88);
+INSERT INTO orders VALUES (3039, 1841, 22);
+INSERT INTO orders VALUES (3040, 1760, 53);
+INSERT INTO orders VALUES (3041, 1679, 84);
+INSERT INTO orders VALUES (3042, 1598, 18);
+INSERT INTO orders VALUES (3043, 1517, 49);
+INSERT INTO orders VALUES (3044, 1436, 80);
+INSERT INTO orders VALUES (3045, 1355, 14);
+INSERT INTO orders VALUES (3046, 1274, 45);
+INSERT INTO orders VALUES (3047, 1193, 76);
+INSERT INTO orders VALUES (3048, 1112, 10);
+INSERT INTO orders VALUES (3049, 1031, 41);
+INSERT INTO orders VALUES (3050, 950, 72);
+INSERT INTO orders VALUES (3051, 869, 6);
+INSERT INTO orders VALUES (3052, 788, 37);
+INSERT INTO orders VALUES (3053, 707, 68);
+INSERT INTO orders VALUES (3054, 626, 2);
+INSERT INTO orders VALUES (3055, 545, 33);
+INSERT INTO orders VALUES (3056, 464, 64);
+INSERT INTO orders VALUES (3057, 383, 95);
+INSERT INTO orders VALUES (3058, 302, 29);
+INSERT INTO orders VALUES (3059, 221, 60);
+INSERT INTO orders VALUES (3060, 140, 91);
+INSERT INTO orders VALUES (3061, 59, 25);
+INSERT INTO orders VALUES (3062, 3978, 56);
+INSERT INTO orders VALUES (3063, 3897, 87);
+INSERT INTO orders VALUES (3064, 3816, 21);
+INSERT INTO orders VALUES (3065, 3735, 52);
+INSERT INTO orders VALUES (3066, 3654, 83);
+INSERT INTO orders VALUES (3067, 3573, 17);
+INSERT INTO orders VALUES (3068, 3492, 48);
+INSERT INTO orders VALUES (3069, 3411, 79);
+INSERT INTO orders VALUES (3070, 3330, 13);
+INSERT INTO orders VALUES (3071, 3249, 44);
+INSERT INTO orders VALUES (3072, 3168, 75);
+INSERT INTO orders VALUES (3073, 3087, 9);
+INSERT INTO orders VALUES (3074, 3006, 40);
+INSERT INTO orders VALUES (3075, 2925, 71);
+INSERT INTO orders VALUES (3076, 2844, 5);
+INSERT INTO orders VALUES (3077, 2763, 36);
+INSERT INTO orders VALUES (3078, 2682, 67);
+INSERT INTO orders VALUES (3079, 2601, 1);
+INSERT INTO orders VALUES (3080, 2520, 32);
+INSERT INTO orders VALUES (3081, 2439, 63);
+INSERT INTO orders VALUES (3082, 2358, 94);
+INSERT INTO orders VALUES (3083, 2277, 28);
+INSERT INTO orders VALUES (3084, 2196, 59);
+INSERT INTO orders VALUES (3085, 2115, 90);
+INSERT INTO orders VALUES (3086, 2034, 24);
+INSERT INTO orders VALUES (3087, 1953, 55);
+INSERT INTO orders VALUES (3088, 1872, 86);
+INSERT INTO orders VALUES (3089, 1791, 20);
+INSERT INTO orders VALUES (3090, 1710, 51);
+INSERT INTO orders VALUES (3091, 1629, 82);
+INSERT INTO orders VALUES (3092, 1548, 16);
+INSERT INTO orders VALUES (3093, 1467, 47);
+INSERT INTO orders VALUES (3094, 1386, 78);
+INSERT INTO orders VALUES (3095, 1305, 12);
+INSERT INTO orders VALUES (3096, 1224, 43);
+INSERT INTO orders VALUES (3097, 1143, 74);
+INSERT INTO orders VALUES (3098, 1062, 8);
+INSERT INTO orders VALUES (3099, 981, 39);
+INSERT INTO orders VALUES (3100, 900, 70);
+INSERT INTO orders VALUES (3101, 819, 4);
+INSERT INTO orders VALUES (3102, 738, 35);
+INSERT INTO orders VALUES (3103, 657, 66);
+INSERT INTO orders VALUES (3104, 576, 0);
+INSERT INTO orders VALUES (3105, 495, 31);
+INSERT INTO orders VALUES (3106, 414, 62);
+INSERT INTO orders VALUES (3107, 333, 93);
+INSERT INTO orders VALUES (3108, 252, 27);
+INSERT INTO orders VALUES (3109, 171, 58);
+INSERT INTO orders VALUES (3110, 90, 89);
+INSERT INTO orders VALUES (3111, 9, 23);
+INSERT INTO orders VALUES (3112, 3928, 54);
+INSERT INTO orders VALUES (3113, 3847, 85);
+INSERT INTO orders VALUES (3114, 3766, 19);
+INSERT INTO orders VALUES (3115, 3685, 50);
+INSERT INTO orders VALUES (3116, 3604, 81);
+INSERT INTO orders VALUES (3117, 3523, 15);
+INSERT INTO orders VALUES (3118, 3442, 46);
+INSERT INTO orders VALUES (3119, 3361, 77);
+INSERT INTO orders VALUES (3120, 3280, 11);
+INSERT INTO orders VALUES (3121, 3199, 42);
+INSERT INTO orders VALUES (3122, 3118, 73);
+INSERT INTO orders VALUES (3123, 3037, 7);
+INSERT INTO orders VALUES (3124, 2956, 38);
+INSERT INTO orders VALUES (3125, 2875, 69);
+INSERT INTO orders VALUES (3126, 2794, 3);
+INSERT INTO orders VALUES (3127, 2713, 34);
+INSERT INTO orders VALUES (3128, 2632, 65);
+INSERT INTO orders VALUES (3129, 2551, 96);
+INSERT INTO orders VALUES (3130, 2470, 30);
+INSERT INTO orders VALUES (3131, 2389, 61);
+INSERT INTO orders VALUES (3132, 2308, 92);
+INSERT INTO orders VALUES (3133, 2227, 26);
+INSERT INTO orders VALUES (3134, 2146, 57);
+INSERT INTO orders VALUES (3135, 2065, 88);
+INSERT INTO orders VALUES (3136, 1984, 22);
+INSERT INTO orders VALUES (3137, 1903, 53);
+INSERT INTO orders VALUES (3138, 1822, 84);
+INSERT INTO orders VALUES (3139, 1741, 18);
+INSERT INTO orders VALUES (3140, 1660, 49);
+INSERT INTO orders VALUES (3141, 1579, 80);
+INSERT INTO orders VALUES (3142, 1498, 14);
+INSERT INTO orders VALUES (3143, 1417, 45);
+INSERT INTO orders VALUES (3144, 1336, 76);
+INSERT INTO orders VALUES (3145, 1255, 10);
+INSERT INTO orders VALUES (3146, 1174, 41);
+INSERT INTO orders VALUES (3147, 1093, 72);
+INSERT INTO orders VALUES (3148, 1012, 6);
+INSERT INTO orders VALUES (3149, 931, 37);
+INSERT INTO orders VALUES (3150, 850, 68);
+INSERT INTO orders VALUES (3151, 769, 2);
+INSERT INTO orders VALUES (3152, 688, 33);
+INSERT INTO orders VALUES (3153, 607, 64);
+INSERT INTO orders VALUES (3154, 526, 95);
+INSERT INTO orders VALUES (3155, 445, 29);
+INSERT INTO orders VALUES (3156, 364, 60);
+INSERT INTO orders VALUES (3157, 283, 91);
+INSERT INTO orders VALUES (3158, 202, 25);
+INSERT INTO orders VALUES (3159, 121, 56);
+INSERT INTO orders VALUES (3160, 40, 87);
+INSERT INTO orders VALUES (3161, 3959, 21);
+INSERT INTO orders VALUES (3162, 3878, 52);
+INSERT INTO orders VALUES (3163, 3797, 83);
+INSERT INTO orders VALUES (3164, 3716, 17);
+INSERT INTO orders VALUES (3165, 3635, 48);
+INSERT INTO orders VALUES (3166, 3554, 79);
+INSERT INTO orders VALUES (3167, 3473, 13);
+INSERT INTO orders VALUES (3168, 3392, 44);
+INSERT INTO orders VALUES (3169, 3311, 75);
+INSERT INTO orders VALUES (3170, 3230, 9);
+INSERT INTO orders VALUES (3171, 3149, 40);
+INSERT INTO orders VALUES (3172, 3068, 71);
+INSERT INTO orders VALUES (3173, 2987, 5);
+INSERT INTO orders VALUES (3174, 2906, 36);
+INSERT INTO orders VALUES (3175, 2825, 67);
+INSERT INTO orders VALUES (3176, 2744, 1);
+INSERT INTO orders VALUES (3177, 2663, 32);
+INSERT INTO orders VALUES (3178, 2582, 63);
+INSERT INTO orders VALUES (3179, 2501, 94);
+INSERT INTO orders VALUES (3180, 2420, 28);
+INSERT INTO orders VALUES (3181, 2339, 59);
+INSERT INTO orders VALUES (3182, 2258, 90);
+INSERT INTO orders VALUES (3183, 2177, 24);
+INSERT INTO orders VALUES (3184, 2096, 55);
+INSERT INTO orders VALUES (3185, 2015, 86);
+INSERT INTO orders VALUES (3186, 1934, 20);
+INSERT INTO orders VALUES (3187, 1853, 51);
+INSERT INTO orders VALUES (3188, 1772, 82);
+INSERT INTO orders VALUES (3189, 1691, 16);
+INSERT INTO orders VALUES (3190, 1610, 47);
+INSERT INTO orders VALUES (3191, 1529, 78);
+INSERT INTO orders VALUES (3192, 1448, 12);
+INSERT INTO orders VALUES (3193, 1367, 43);
+INSERT INTO orders VALUES (3194, 1286, 74);
+INSERT INTO orders VALUES (3195, 1205, 8);
+INSERT INTO orders VALUES (3196, 1124, 39);
+INSERT INTO orders VALUES (3197, 1043, 70);
+INSERT INTO orders VALUES (3198, 962, 4);
+INSERT INTO orders VALUES (3199, 881, 35);
+INSERT INTO orders VALUES (3200, 800, 66);
+INSERT INTO orders VALUES (3201, 719, 0);
+INSERT INTO orders VALUES (3202, 638, 31);
+INSERT INTO orders VALUES (3203, 557, 62);
+INSERT INTO orders VALUES (3204, 476, 93);
+INSERT INTO orders VALUES (3205, 395, 27);
+INSERT INTO orders VALUES (3206, 314, 58);
+INSERT INTO orders VALUES (3207, 233, 89);
+INSERT INTO orders VALUES (3208, 152, 23);
+INSERT INTO orders VALUES (3209, 71, 54);
+INSERT INTO orders VALUES (3210, 3990, 85);
+INSERT INTO orders VALUES (3211, 3909, 19);
+INSERT INTO orders VALUES (3212, 3828, 50);
+INSERT INTO orders VALUES (3213, 3747, 81);
+INSERT INTO orders VALUES (3214, 3666, 15);
+INSERT INTO orders VALUES (3215, 3585, 46);
+INSERT INTO orders VALUES (3216, 3504, 77);
+INSERT INTO orders VALUES (3217, 3423, 11);
+INSERT INTO orders VALUES (3218, 3342, 42);
+INSERT INTO orders VALUES (3219, 3261, 73);
+INSERT INTO orders VALUES (3220, 3180, 7);
+INSERT INTO orders VALUES (3221, 3099, 38);
+INSERT INTO orders VALUES (3222, 3018, 69);
+INSERT INTO orders VALUES (3223, 2937, 3);
+INSERT INTO orders VALUES (3224, 2856, 34);
+INSERT INTO orders VALUES (3225, 2775, 65);
+INSERT INTO orders VALUES (3226, 2694, 96);
+INSERT INTO orders VALUES (3227, 2613, 30);
+INSERT INTO orders VALUES (3228, 2532, 61);
+INSERT INTO orders VALUES (3229, 2451, 92);
+INSERT INTO orders VALUES (3230, 2370, 26);
+INSERT INTO orders VALUES (3231, 2289, 57);
+INSERT INTO orders VALUES (3232, 2208, 88);
+INSERT INTO orders VALUES (3233, 2127, 22);
+INSERT INTO orders VALUES (3234, 2046, 53);
+INSERT INTO orders VALUES (3235, 1965, 84);
+INSERT INTO orders VALUES (3236, 1884, 18);
+INSERT INTO orders VALUES (3237, 1803, 49);
+INSERT INTO orders VALUES (3238, 1722, 80);
+INSERT INTO orders VALUES (3239, 1641, 14);
+INSERT INTO orders VALUES (3240, 1560, 45);
+INSERT INTO orders VALUES (3241, 1479, 76);
+INSERT INTO orders VALUES (3242, 1398, 10);
+INSERT INTO orders VALUES (3243, 1317, 41);
+INSERT INTO orders VALUES (3244, 1236, 72);
+INSERT INTO orders VALUES (3245, 1155, 6);
+INSERT INTO orders VALUES (3246, 1074, 37);
+INSERT INTO orders VALUES (3247, 993, 68);
+INSERT INTO orders VALUES (3248, 912, 2);
+INSERT INTO orders VALUES (3249, 831, 33);
+INSERT INTO orders VALUES (3250, 750, 64);
+INSERT INTO orders VALUES (3251, 669, 95);
+INSERT INTO orders VALUES (3252, 588, 29);
+INSERT INTO orders VALUES (3253, 507, 60);
+INSERT INTO orders VALUES (3254, 426, 91);
+INSERT INTO orders VALUES (3255, 345, 25);
+INSERT INTO orders VALUES (3256, 264, 56);
+INSERT INTO orders VALUES (3257, 183, 87);
+INSERT INTO orders VALUES (3258, 102, 21);
+INSERT INTO orders VALUES (3259, 21, 52);
+INSERT INTO orders VALUES (3260, 3940, 83);
+INSERT INTO orders VALUES (3261, 3859, 17);
+INSERT INTO orders VALUES (3262, 3778, 48);
+INSERT INTO orders VALUES (3263, 3697, 79);
+INSERT INTO orders VALUES (3264, 3616, 13);
+INSERT INTO orders VALUES (3265, 3535, 44);
+INSERT INTO orders VALUES (3266, 3454, 75);
+INSERT INTO orders VALUES (3267, 3373, 9);
+INSERT INTO orders VALUES (3268, 3292, 40);
+INSERT INTO orders VALUES (3269, 3211, 71);
+INSERT INTO orders VALUES (3270, 3130, 5);
+INSERT INTO orders VALUES (3271, 3049, 36);
+INSERT INTO orders VALUES (3272, 2968, 67);
+INSERT INTO orders VALUES (3273, 2887, 1);
+INSERT INTO orders VALUES (3274, 2806, 32);
+INSERT INTO orders VALUES (3275, 2725, 63);
+INSERT INTO orders VALUES (3276, 2644, 94);
+INSERT INTO orders VALUES (3277, 2563, 28);
+INSERT INTO orders VALUES (3278, 2482, 59);
+INSERT INTO orders VALUES (3279, 2401, 90);
+INSERT INTO orders VALUES (3280, 2320, 24);
+INSERT INTO orders VALUES (3281, 2239, 55);
+INSERT INTO orders VALUES (3282, 2158, 86);
+INSERT INTO orders VALUES (3283, 2077, 20);
+INSERT INTO orders VALUES (3284, 1996, 51);
+INSERT INTO orders VALUES (3285, 1915, 82);
+INSERT INTO orders VALUES (3286, 1834, 16);
+INSERT INTO orders VALUES (3287, 1753, 47);
+INSERT INTO orders VALUES (3288, 1672, 78);
+INSERT INTO orders VALUES (3289, 1591, 12);
+INSERT INTO orders VALUES (3290, 1510, 43);
+INSERT INTO orders VALUES (3291, 1429, 74);
+INSERT INTO orders VALUES (3292, 1348, 8);
+INSERT INTO orders VALUES (3293, 1267, 39);
+INSERT INTO orders VALUES (3294, 1186, 70);
+INSERT INTO orders VALUES (3295, 1105, 4);
+INSERT INTO orders VALUES (3296, 1024, 35);
+INSERT INTO orders VALUES (3297, 943, 66);
+INSERT INTO orders VALUES (3298, 862, 0);
+INSERT INTO orders VALUES (3299, 781, 31);
+INSERT INTO orders VALUES (3300, 700, 62);
+INSERT INTO orders VALUES (3301, 619, 93);
+INSERT INTO orders VALUES (3302, 538, 27);
+INSERT INTO orders VALUES (3303, 457, 58);
+INSERT INTO orders VALUES (3304, 376, 89);
+INSERT INTO orders VALUES (3305, 295, 23);
+INSERT INTO orders VALUES (3306, 214, 54);
+INSERT INTO orders VALUES (3307, 133, 85);
+INSERT INTO orders VALUES (3308, 52, 19);
+INSERT INTO orders VALUES (3309, 3971, 50);
+INSERT INTO orders VALUES (3310, 3890, 81);
+INSERT INTO orders VALUES (3311, 3809, 15);
+INSERT INTO orders VALUES (3312, 3728, 46);
+INSERT INTO orders VALUES (3313, 3647, 77);
+INSERT INTO orders VALUES (3314, 3566, 11);
+INSERT INTO orders VALUES (3315, 3485, 42);
+INSERT INTO orders VALUES (3316, 3404, 73);
+INSERT INTO orders VALUES (3317, 3323, 7);
+INSERT INTO orders VALUES (3318, 3242, 38);
+INSERT INTO orders VALUES (3319, 3161, 69);
+INSERT INTO orders VALUES (3320, 3080, 3);
+INSERT INTO orders VALUES (3321, 2999, 34);
+INSERT INTO orders VALUES (3322, 2918, 65);
+INSERT INTO orders VALUES (3323, 2837, 96);
+INSERT INTO orders VALUES (3324, 2756, 30);
+INSERT INTO orders VALUES (3325, 2675, 61);
+INSERT INTO orders VALUES (3326, 2594, 92);
+INSERT INTO orders VALUES (3327, 2513, 26);
+INSERT INTO orders VALUES (3328, 2432, 57);
+INSERT INTO orders VALUES (3329, 2351, 88);
+INSERT INTO orders VALUES (3330, 2270, 22);
+INSERT INTO orders VALUES (3331, 2189, 53);
+INSERT INTO orders VALUES (3332, 2108, 84);
+INSERT INTO orders VALUES (3333, 2027, 18);
+INSERT INTO orders VALUES (3334, 1946, 49);
+INSERT INTO orders VALUES (3335, 1865, 80);
+INSERT INTO orders VALUES (3336, 1784, 14);
+INSERT INTO orders VALUES (3337, 1703, 45);
+INSERT INTO orders VALUES (3338, 1622, 76);
+INSERT INTO orders VALUES (3339, 1541, 10);
+INSERT INTO orders VALUES (3340, 1460, 41);
+INSERT INTO orders VALUES (3341, 1379, 72);
+INSERT INTO orders VALUES (3342, 1298, 6);
+INSERT INTO orders VALUES (3343, 1217, 37);
+INSERT INTO orders VALUES (3344, 1136, 68);
+INSERT INTO orders VALUES (3345, 1055, 2);
+INSERT INTO orders VALUES (3346, 974, 33);
+INSERT INTO orders VALUES (3347, 893, 64);
+INSERT INTO orders VALUES (3348, 812, 95);
+INSERT INTO orders VALUES (3349, 731, 29);
+INSERT INTO orders VALUES (3350, 650, 60);
+INSERT INTO orders VALUES (3351, 569, 91);
+INSERT INTO orders VALUES (3352, 488, 25);
+INSERT INTO orders VALUES (3353, 407, 56);
+INSERT INTO orders VALUES (3354, 326, 87);
+INSERT INTO orders VALUES (3355, 245, 21);
+INSERT INTO orders VALUES (3356, 164, 52);
+INSERT INTO orders VALUES (3357, 83, 83);
+INSERT INTO orders VALUES (3358, 2, 17);
+INSERT INTO orders VALUES (3359, 3921, 48);
+INSERT INTO orders VALUES (3360, 3840, 79);
+INSERT INTO orders VALUES (3361, 3759, 13);
+INSERT INTO orders VALUES (3362, 3678, 44);
+INSERT INTO orders VALUES (3363, 3597, 75);
+INSERT INTO orders VALUES (3364, 3516, 9);
+INSERT INTO orders VALUES (3365, 3435, 40);
+INSERT INTO orders VALUES (3366, 3354, 71);
+INSERT INTO orders VALUES (3367, 3273, 5);
+INSERT INTO orders VALUES (3368, 3192, 36);
+INSERT INTO orders VALUES (3369, 3111, 67);
+INSERT INTO orders VALUES (3370, 3030, 1);
+INSERT INTO orders VALUES (3371, 2949, 32);
+INSERT INTO orders VALUES (3372, 2868, 63);
+INSERT INTO orders VALUES (3373, 2787, 94);
+INSERT INTO orders VALUES (3374, 2706, 28);
+INSERT INTO orders VALUES (3375, 2625, 59);
+INSERT INTO orders VALUES (3376, 2544, 90);
+INSERT INTO orders VALUES (3377, 2463, 24);
+INSERT INTO orders VALUES (3378, 2382, 55);
+INSERT INTO orders VALUES (3379, 2301, 86);
+INSERT INTO orders VALUES (3380, 2220, 20);
+INSERT INTO orders VALUES (3381, 2139, 51);
+INSERT INTO orders VALUES (3382, 2058, 82);
+INSERT INTO orders VALUES (3383, 1977, 16);
+INSERT INTO orders VALUES (3384, 1896, 47);
+INSERT INTO orders VALUES (3385, 1815, 78);
+INSERT INTO orders VALUES (3386, 1734, 12);
+INSERT INTO orders VALUES (3387, 1653, 43);
+INSERT INTO orders VALUES (3388, 1572, 74);
+INSERT INTO orders VALUES (3389, 1491, 8);
+INSERT INTO orders VALUES (3390, 1410, 39);
+INSERT INTO orders VALUES (3391, 1329, 70);
+INSERT INTO orders VALUES (3392, 1248, 4);
+INSERT INTO orders VALUES (3393, 1167, 35);
+INSERT INTO orders VALUES (3394, 1086, 66);
+INSERT INTO orders VALUES (3395, 1005, 0);
+INSERT INTO orders VALUES (3396, 924, 31);
+INSERT INTO orders VALUES (3397, 843, 62);
+INSERT INTO orders VALUES (3398, 762, 93);
+INSERT INTO orders VALUES (3399, 681, 27);
+INSERT INTO orders VALUES (3400, 600, 58);
+INSERT INTO orders VALUES (3401, 519, 89);
+INSERT INTO orders VALUES (3402, 438, 23);
+INSERT INTO orders VALUES (3403, 357, 54);
+INSERT INTO orders VALUES (3404, 276, 85);
+INSERT INTO orders VALUES (3405, 195, 19);
+INSERT INTO orders VALUES (3406, 114, 50);
+INSERT INTO orders VALUES (3407, 33, 81);
+INSERT INTO orders VALUES (3408, 3952, 15);
+INSERT INTO orders VALUES (3409, 3871, 46);
+INSERT INTO orders VALUES (3410, 3790, 77);
+INSERT INTO orders VALUES (3411, 3709, 11);
+INSERT INTO orders VALUES (3412, 3628, 42);
+INSERT INTO orders VALUES (3413, 3547, 73);
+INSERT INTO orders VALUES (3414, 3466, 7);
+INSERT INTO orders VALUES (3415, 3385, 38);
+INSERT INTO orders VALUES (3416, 3304, 69);
+INSERT INTO orders VALUES (3417, 3223, 3);
+INSERT INTO orders VALUES (3418, 3142, 34);
+INSERT INTO orders VALUES (3419, 3061, 65);
+INSERT INTO orders VALUES (3420, 2980, 96);
+INSERT INTO orders VALUES (3421, 2899, 30);
+INSERT INTO orders VALUES (3422, 2818, 61);
+INSERT INTO orders VALUES (3423, 2737, 92);
+INSERT INTO orders VALUES (3424, 2656, 26);
+INSERT INTO orders VALUES (3425, 2575, 57);
+INSERT INTO orders VALUES (3426, 2494, 88);
+INSERT INTO orders VALUES (3427, 2413, 22);
+INSERT INTO orders VALUES (3428, 2332, 53);
+INSERT INTO orders VALUES (3429, 2251, 84);
+INSERT INTO orders VALUES (3430, 2170, 18);
+INSERT INTO orders VALUES (3431, 2089, 49);
+INSERT INTO orders VALUES (3432, 2008, 80);
+INSERT INTO orders VALUES (3433, 1927, 14);
+INSERT INTO orders VALUES (3434, 1846, 45);
+INSERT INTO orders VALUES (3435, 1765, 76);
+INSERT INTO orders VALUES (3436, 1684, 10);
+INSERT INTO orders VALUES (3437, 1603, 41);
+INSERT INTO orders VALUES (3438, 1522, 72);
+INSERT INTO orders VALUES (3439, 1441, 6);
+INSERT INTO orders VALUES (3440, 1360, 37);
+INSERT INTO orders VALUES (3441, 1279, 68);
+INSERT INTO orders VALUES (3442, 1198, 2);
+INSERT INTO orders VALUES (3443, 1117, 33);
+INSERT INTO orders VALUES (3444, 1036, 64);
+INSERT INTO orders VALUES (3445, 955, 95);
+INSERT INTO orders VALUES (3446, 874, 29);
+INSERT INTO orders VALUES (3447, 793, 60);
+INSERT INTO orders VALUES (3448, 712, 91);
+INSERT INTO orders VALUES (3449, 631, 25);
+INSERT INTO orders VALUES (3450, 550, 56);
+INSERT INTO orders VALUES (3451, 469, 87);
+INSERT INTO orders VALUES (3452, 388, 21);
+INSERT INTO orders VALUES (3453, 307, 52);
+INSERT INTO orders VALUES (3454, 226, 83);
+INSERT INTO orders VALUES (3455, 145, 17);
+INSERT INTO orders VALUES (3456, 64, 48);
+INSERT INTO orders VALUES (3457, 3983, 79);
+INSERT INTO orders VALUES (3458, 3902, 13);
+INSERT INTO orders VALUES (3459, 3821, 44);
+INSERT INTO orders VALUES (3460, 3740, 75);
+INSERT INTO orders VALUES (3461, 3659, 9);
+INSERT INTO orders VALUES (3462, 3578, 40);
+INSERT INTO orders VALUES (3463, 3497, 71);
+INSERT INTO orders VALUES (3464, 3416, 5);
+INSERT INTO orders VALUES (3465, 3335, 36);
+INSERT INTO orders VALUES (3466, 3254, 67);
+INSERT INTO orders VALUES (3467, 3173, 1);
+INSERT INTO orders VALUES (3468, 3092, 32);
+INSERT INTO orders VALUES (3469, 3011, 63);
+INSERT INTO orders VALUES (3470, 2930, 94);
+INSERT INTO orders VALUES (3471, 2849, 28);
+INSERT INTO orders VALUES (3472, 2768, 59);
+INSERT INTO orders VALUES (3473, 2687, 90);
+INSERT INTO orders VALUES (3474, 2606, 24);
+INSERT INTO orders VALUES (3475, 2525, 55);
+INSERT INTO orders VALUES (3476, 2444, 86);
+INSERT INTO orders VALUES (3477, 2363, 20);
+INSERT INTO orders VALUES (3478, 2282, 51);
+INSERT INTO orders VALUES (3479, 2201, 82);
+INSERT INTO orders VALUES (3480, 2120, 16);
+INSERT INTO orders VALUES (3481, 2039, 47);
+INSERT INTO orders VALUES (3482, 1958, 78);
+INSERT INTO orders VALUES (3483, 1877, 12);
+INSERT INTO orders VALUES (3484, 1796, 43);
+INSERT INTO orders VALUES (3485, 1715, 74);
+INSERT INTO orders VALUES (3486, 1634, 8);
+INSERT INTO orders VALUES (3487, 1553, 39);
+INSERT INTO orders VALUES (3488, 1472, 70);
+INSERT INTO orders VALUES (3489, 1391, 4);
+INSERT INTO orders VALUES (3490, 1310, 35);
+INSERT INTO orders VALUES (3491, 1229, 66);
+INSERT INTO orders VALUES (3492, 1148, 0);
+INSERT INTO orders VALUES (3493, 1067, 31);
+INSERT INTO orders VALUES (3494, 986, 62);
+INSERT INTO orders VALUES (3495, 905, 93);
+INSERT INTO orders VALUES (3496, 824, 27);
+INSERT INTO orders VALUES (3497, 743, 58);
+INSERT INTO orders VALUES (3498, 662, 89);
+INSERT INTO orders VALUES (3499, 581, 23);
+INSERT INTO orders VALUES (3500, 500, 54);
+INSERT INTO orders VALUES (3501, 419, 85);
+INSERT INTO orders VALUES (3502, 338, 19);
+INSERT INTO orders VALUES (3503, 257, 50);
+INSERT INTO orders VALUES (3504, 176, 81);
+INSERT INTO orders VALUES (3505, 95, 15);
+INSERT INTO orders VALUES (3506, 14, 46);
+INSERT INTO orders VALUES (3507, 3933, 77);
+INSERT INTO orders VALUES (3508, 3852, 11);
+INSERT INTO orders VALUES (3509, 3771, 42);
+INSERT INTO orders VALUES (3510, 3690, 73);
+INSERT INTO orders VALUES (3511, 3609, 7);
+INSERT INTO orders VALUES (3512, 3528, 38);
+INSERT INTO orders VALUES (3513, 3447, 69);
+INSERT INTO orders VALUES (3514, 3366, 3);
+INSERT INTO orders VALUES (3515, 3285, 34);
+INSERT INTO orders VALUES (3516, 3204, 65);
+INSERT INTO orders VALUES (3517, 3123, 96);
+INSERT INTO orders VALUES (3518, 3042, 30);
+INSERT INTO orders VALUES (3519, 2961, 61);
+INSERT INTO orders VALUES (3520, 2880, 92);
+INSERT INTO orders VALUES (3521, 2799, 26);
+INSERT INTO orders VALUES (3522, 2718, 57);
+INSERT INTO orders VALUES (3523, 2637, 88);
+INSERT INTO orders VALUES (3524, 2556, 22);
+INSERT INTO orders VALUES (3525, 2475, 53);
+INSERT INTO orders VALUES (3526, 2394, 84);
+INSERT INTO orders VALUES (3527, 2313, 18);
+INSERT INTO orders VALUES (3528, 2232, 49);
+INSERT INTO orders VALUES (3529, 2151, 80);
+INSERT INTO orders VALUES (3530, 2070, 14);
+INSERT INTO orders VALUES (3531, 1989, 45);
+INSERT INTO orders VALUES (3532, 1908, 76);
+INSERT INTO orders VALUES (3533, 1827, 10);
+INSERT INTO orders VALUES (3534, 1746, 41);
+INSERT INTO orders VALUES (3535, 1665, 72);
+INSERT INTO orders VALUES (3536, 1584, 6);
+INSERT INTO orders VALUES (3537, 1503, 37);
+INSERT INTO orders VALUES (3538, 1422, 68);
+INSERT INTO orders VALUES (3539, 1341, 2);
+INSERT INTO orders VALUES (3540, 1260, 33);
+INSERT INTO orders VALUES (3541, 1179, 64);
+INSERT INTO orders VALUES (3542, 1098, 95);
+INSERT INTO orders VALUES (3543, 1017, 29);
+INSERT INTO orders VALUES (3544, 936, 60);
+INSERT INTO orders VALUES (3545, 855, 91);
+INSERT INTO orders VALUES (3546, 774, 25);
+INSERT INTO orders VALUES (3547, 693, 56);
+INSERT INTO orders VALUES (3548, 612, 87);
+INSERT INTO orders VALUES (3549, 531, 21);
+INSERT INTO orders VALUES (3550, 450, 52);
+INSERT INTO orders VALUES (3551, 369, 83);
+INSERT INTO orders VALUES (3552, 288, 17);
+INSERT INTO orders VALUES (3553, 207, 48);
+INSERT INTO orders VALUES (3554, 126, 79);
+INSERT INTO orders VALUES (3555, 45, 13);
+INSERT INTO orders VALUES (3556, 3964, 44);
+INSERT INTO orders VALUES (3557, 3883, 75);
+INSERT INTO orders VALUES (3558, 3802, 9);
+INSERT INTO orders VALUES (3559, 3721, 40);
+INSERT INTO orders VALUES (3560, 3640, 71);
+INSERT INTO orders VALUES (3561, 3559, 5);
+INSERT INTO orders VALUES (3562, 3478, 36);
+INSERT INTO orders VALUES (3563, 3397, 67);
+INSERT INTO orders VALUES (3564, 3316, 1);
+INSERT INTO orders VALUES (3565, 3235, 32);
+INSERT INTO orders VALUES (3566, 3154, 63);
+INSERT INTO orders VALUES (3567, 3073, 94);
+INSERT INTO orders VALUES (3568, 2992, 28);
+INSERT INTO orders VALUES (3569, 2911, 59);
+INSERT INTO orders VALUES (3570, 2830, 90);
+INSERT INTO orders VALUES (3571, 2749, 24);
+INSERT INTO orders VALUES (3572, 2668, 55);
+INSERT INTO orders VALUES (3573, 2587, 86);
+INSERT INTO orders VALUES (3574, 2506, 20);
+INSERT INTO orders VALUES (3575, 2425, 51);
+INSERT INTO orders VALUES (3576, 2344, 82);
+INSERT INTO orders VALUES (3577, 2263, 16);
+INSERT INTO orders VALUES (3578, 2182, 47);
+INSERT INTO orders VALUES (3579, 2101, 78);
+INSERT INTO orders VALUES (3580, 2020, 12);
+INSERT INTO orders VALUES (3581, 1939, 43);
+INSERT INTO orders VALUES (3582, 1858, 74);
+INSERT INTO orders VALUES (3583, 1777, 8);
+INSERT INTO orders VALUES (3584, 1696, 39);
+INSERT INTO orders VALUES (3585, 1615, 70);
+INSERT INTO orders VALUES (3586, 1534, 4);
+INSERT INTO orders VALUES (3587, 1453, 35);
+INSERT INTO orders VALUES (3588, 1372, 66);
+INSERT INTO orders VALUES (3589, 1291, 0);
+INSERT INTO orders VALUES (3590, 1210, 31);
+INSERT INTO orders VALUES (3591, 1129, 62);
+INSERT INTO orders VALUES (3592, 1048, 93);
+INSERT INTO orders VALUES (3593, 967, 27);
+INSERT INTO orders VALUES (3594, 886, 58);
+INSERT INTO orders VALUES (3595, 805, 89);
+INSERT INTO orders VALUES (3596, 724, 23);
+INSERT INTO orders VALUES (3597, 643, 54);
+INSERT INTO orders VALUES (3598, 562, 85);
+INSERT INTO orders VALUES (3599, 481, 19);
+INSERT INTO orders VALUES (3600, 400, 50);
+INSERT INTO orders VALUES (3601, 319, 81);
+INSERT INTO orders VALUES (3602, 238, 15);
+INSERT INTO orders VALUES (3603, 157, 46);
+INSERT INTO orders VALUES (3604, 76, 77);
+INSERT INTO orders VALUES (3605, 3995, 11);
+INSERT INTO orders VALUES (3606, 3914, 42);
+INSERT INTO orders VALUES (3607, 3833, 73);
+INSERT INTO orders VALUES (3608, 3752, 7);
+INSERT INTO orders VALUES (3609, 3671, 38);
+INSERT INTO orders VALUES (3610, 3590, 69);
+INSERT INTO orders VALUES (3611, 3509, 3);
+INSERT INTO orders VALUES (3612, 3428, 34);
+INSERT INTO orders VALUES (3613, 3347, 65);
+INSERT INTO orders VALUES (3614, 3266, 96);
+INSERT INTO orders VALUES (3615, 3185, 30);
+INSERT INTO orders VALUES (3616, 3104, 61);
+INSERT INTO orders VALUES (3617, 3023, 92);
+INSERT INTO orders VALUES (3618, 2942, 26);
+INSERT INTO orders VALUES (3619, 2861, 57);
+INSERT INTO orders VALUES (3620, 2780, 88);
+INSERT INTO orders VALUES (3621, 2699, 22);
+INSERT INTO orders VALUES (3622, 2618, 53);
+INSERT INTO orders VALUES (3623, 2537, 84);
+INSERT INTO orders VALUES (3624, 2456, 18);
+INSERT INTO orders VALUES (3625, 2375, 49);
+INSERT INTO orders VALUES (3626, 2294, 80);
+INSERT INTO orders VALUES (3627, 2213, 14);
+INSERT INTO orders VALUES (3628, 2132, 45);
+INSERT INTO orders VALUES (3629, 2051, 76);
+INSERT INTO orders VALUES (3630, 1970, 10);
+INSERT INTO orders VALUES (3631, 1889, 41);
+INSERT INTO orders VALUES (3632, 1808, 72);
+INSERT INTO orders VALUES (3633, 1727, 6);
+INSERT INTO orders VALUES (3634, 1646, 37);
+INSERT INTO orders VALUES (3635, 1565, 68);
+INSERT INTO orders VALUES (3636, 1484, 2);
+INSERT INTO orders VALUES (3637, 1403, 33);
+INSERT INTO orders VALUES (3638, 1322, 64);
+INSERT INTO orders VALUES (3639, 1241, 95);
+INSERT INTO orders VALUES (3640, 1160, 29);
+INSERT INTO orders VALUES (3641, 1079, 60);
+INSERT INTO orders VALUES (3642, 998, 91);
+INSERT INTO orders VALUES (3643, 917, 25);
+INSERT INTO orders VALUES (3644, 836, 56);
+INSERT INTO orders VALUES (3645, 755, 87);
+INSERT INTO orders VALUES (3646, 674, 21);
+INSERT INTO orders VALUES (3647, 593, 52);
+INSERT INTO orders VALUES (3648, 512, 83);
+INSERT INTO orders VALUES (3649, 431, 17);
+INSERT INTO orders VALUES (3650, 350, 48);
+INSERT INTO orders VALUES (3651, 269, 79);
+INSERT INTO orders VALUES (3652, 188, 13);
+INSERT INTO orders VALUES (3653, 107, 44);
+INSERT INTO orders VALUES (3654, 26, 75);
+INSERT INTO orders VALUES (3655, 3945, 9);
+INSERT INTO orders VALUES (3656, 3864, 40);
+INSERT INTO orders VALUES (3657, 3783, 71);
+INSERT INTO orders VALUES (3658, 3702, 5);
+INSERT INTO orders VALUES (3659, 3621, 36);
+INSERT INTO orders VALUES (3660, 3540, 67);
+INSERT INTO orders VALUES (3661, 3459, 1);
+INSERT INTO orders VALUES (3662, 3378, 32);
+INSERT INTO orders VALUES (3663, 3297, 63);
+INSERT INTO orders VALUES (3664, 3216, 94);
+INSERT INTO orders VALUES (3665, 3135, 28);
+INSERT INTO orders VALUES (3666, 3054, 59);
+INSERT INTO orders VALUES (3667, 2973, 90);
+INSERT INTO orders VALUES (3668, 2892, 24);
+INSERT INTO orders VALUES (3669, 2811, 55);
+INSERT INTO orders VALUES (3670, 2730, 86);
+INSERT INTO orders VALUES (3671, 2649, 20);
+INSERT INTO orders VALUES (3672, 2568, 51);
+INSERT INTO orders VALUES (3673, 2487, 82);
+INSERT INTO orders VALUES (3674, 2406, 16);
+INSERT INTO orders VALUES (3675, 2325, 47);
+INSERT INTO orders VALUES (3676, 2244, 78);
+INSERT INTO orders VALUES (3677, 2163, 12);
+INSERT INTO orders VALUES (3678, 2082, 43);
+INSERT INTO orders VALUES (3679, 2001, 74);
+INSERT INTO orders VALUES (3680, 1920, 8);
+INSERT INTO orders VALUES (3681, 1839, 39);
+INSERT INTO orders VALUES (3682, 1758, 70);
+INSERT INTO orders VALUES (3683, 1677, 4);
+INSERT INTO orders VALUES (3684, 1596, 35);
+INSERT INTO orders VALUES (3685, 1515, 66);
+INSERT INTO orders VALUES (3686, 1434, 0);
+INSERT INTO orders VALUES (3687, 1353, 31);
+INSERT INTO orders VALUES (3688, 1272, 62);
+INSERT INTO orders VALUES (3689, 1191, 93);
+INSERT INTO orders VALUES (3690, 1110, 27);
+INSERT INTO orders VALUES (3691, 1029, 58);
+INSERT INTO orders VALUES (3692, 948, 89);
+INSERT INTO orders VALUES (3693, 867, 23);
+INSERT INTO orders VALUES (3694, 786, 54);
+INSERT INTO orders VALUES (3695, 705, 85);
+INSERT INTO orders VALUES (3696, 624, 19);
+INSERT INTO orders VALUES (3697, 543, 50);
+INSERT INTO orders VALUES (3698, 462, 81);
+INSERT INTO orders VALUES (3699, 381, 15);
+INSERT INTO orders VALUES (3700, 300, 46);
+INSERT INTO orders VALUES (3701, 219, 77);
+INSERT INTO orders VALUES (3702, 138, 11);
+INSERT INTO orders VALUES (3703, 57, 42);
+INSERT INTO orders VALUES (3704, 3976, 73);
+INSERT INTO orders VALUES (3705, 3895, 7);
+INSERT INTO orders VALUES (3706, 3814, 38);
+INSERT INTO orders VALUES (3707, 3733, 69);
+INSERT INTO orders VALUES (3708, 3652, 3);
+INSERT INTO orders VALUES (3709, 3571, 34);
+INSERT INTO orders VALUES (3710, 3490, 65);
+INSERT INTO orders VALUES (3711, 3409, 96);
+INSERT INTO orders VALUES (3712, 3328, 30);
+INSERT INTO orders VALUES (3713, 3247, 61);
+INSERT INTO orders VALUES (3714, 3166, 92);
+INSERT INTO orders VALUES (3715, 3085, 26);
+INSERT INTO orders VALUES (3716, 3004, 57);
+INSERT INTO orders VALUES (3717, 2923, 88);
+INSERT INTO orders VALUES (3718, 2842, 22);
+INSERT INTO orders VALUES (3719, 2761, 53);
+INSERT INTO orders VALUES (3720, 2680, 84);
+INSERT INTO orders VALUES (3721, 2599, 18);
+INSERT INTO orders VALUES (3722, 2518, 49);
+INSERT INTO orders VALUES (3723, 2437, 80);
+INSERT INTO orders VALUES (3724, 2356, 14);
+INSERT INTO orders VALUES (3725, 2275, 45);
+INSERT INTO orders VALUES (3726, 2194, 76);
+INSERT INTO orders VALUES (3727, 2113, 10);
+INSERT INTO orders VALUES (3728, 2032, 41);
+INSERT INTO orders VALUES (3729, 1951, 72);
+INSERT INTO orders VALUES (3730, 1870, 6);
+INSERT INTO orders VALUES (3731, 1789, 37);
+INSERT INTO orders VALUES (3732, 1708, 68);
+INSERT INTO orders VALUES (3733, 1627, 2);
+INSERT INTO orders VALUES (3734, 1546, 33);
+INSERT INTO orders VALUES (3735, 1465, 64);
+INSERT INTO orders VALUES (3736, 1384, 95);
+INSERT INTO orders VALUES (3737, 1303, 29);
+INSERT INTO orders VALUES (3738, 1222, 60);
+INSERT INTO orders VALUES (3739, 1141, 91);
+INSERT INTO orders VALUES (3740, 1060, 25);
+INSERT INTO orders VALUES (3741, 979, 56);
+INSERT INTO orders VALUES (3742, 898, 87);
+INSERT INTO orders VALUES (3743, 817, 21);
+INSERT INTO orders VALUES (3744, 736, 52);
+INSERT INTO orders VALUES (3745, 655, 83);
+INSERT INTO orders VALUES (3746, 574, 17);
+INSERT INTO orders VALUES (3747, 493, 48);
+INSERT INTO orders VALUES (3748, 412, 79);
+INSERT INTO orders VALUES (3749, 331, 13);
+INSERT INTO orders VALUES (3750, 250, 44);
+INSERT INTO orders VALUES (3751, 169, 75);
+INSERT INTO orders VALUES (3752, 88, 9);
+INSERT INTO orders VALUES (3753, 7, 40);
+INSERT INTO orders VALUES (3754, 3926, 71);
+INSERT INTO orders VALUES (3755, 3845, 5);
+INSERT INTO orders VALUES (3756, 3764, 36);
+INSERT INTO orders VALUES (3757, 3683, 67);
+INSERT INTO orders VALUES (3758, 3602, 1);
+INSERT INTO orders VALUES (3759, 3521, 32);
+INSERT INTO orders VALUES (3760, 3440, 63);
+INSERT INTO orders VALUES (3761, 3359, 94);
+INSERT INTO orders VALUES (3762, 3278, 28);
+INSERT INTO orders VALUES (3763, 3197, 59);
+INSERT INTO orders VALUES (3764, 3116, 90);
+INSERT INTO orders VALUES (3765, 3035, 24);
+INSERT INTO orders VALUES (3766, 2954, 55);
+INSERT INTO orders VALUES (3767, 2873, 86);
+INSERT INTO orders VALUES (3768, 2792, 20);
+INSERT INTO orders VALUES (3769, 2711, 51);
+INSERT INTO orders VALUES (3770, 2630, 82);
+INSERT INTO orders VALUES (3771, 2549, 16);
+INSERT INTO orders VALUES (3772, 2468, 47);
+INSERT INTO orders VALUES (3773, 2387, 78);
+INSERT INTO orders VALUES (3774, 2306, 12);
+INSERT INTO orders VALUES (3775, 2225, 43);
+INSERT INTO orders VALUES (3776, 2144, 74);
+INSERT INTO orders VALUES (3777, 2063, 8);
+INSERT INTO orders VALUES (3778, 1982, 39);
+INSERT INTO orders VALUES (3779, 1901, 70);
+INSERT INTO orders VALUES (3780, 1820, 4);
+INSERT INTO orders VALUES (3781, 1739, 35);
+INSERT INTO orders VALUES (3782, 1658, 66);
+INSERT INTO orders VALUES (3783, 1577, 0);
+INSERT INTO orders VALUES (3784, 1496, 31);
+INSERT INTO orders VALUES (3785, 1415, 62);
+INSERT INTO orders VALUES (3786, 1334, 93);
+INSERT INTO orders VALUES (3787, 1253, 27);
+INSERT INTO orders VALUES (3788, 1172, 58);
+INSERT INTO orders VALUES (3789, 1091, 89);
+INSERT INTO orders VALUES (3790, 1010, 23);
+INSERT INTO orders VALUES (3791, 929, 54);
+INSERT INTO orders VALUES (3792, 848, 85);
+INSERT INTO orders VALUES (3793, 767, 19);
+INSERT INTO orders VALUES (3794, 686, 50);
+INSERT INTO orders VALUES (3795, 605, 81);
+INSERT INTO orders VALUES (3796, 524, 15);
+INSERT INTO orders VALUES (3797, 443, 46);
+INSERT INTO orders VALUES (3798, 362, 77);
+INSERT INTO orders VALUES (3799, 281, 11);
+INSERT INTO orders VALUES (3800, 200, 42);
+INSERT INTO orders VALUES (3801, 119, 73);
+INSERT INTO orders VALUES (3802, 38, 7);
+INSERT INTO orders VALUES (3803, 3957, 38);
+INSERT INTO orders VALUES (3804, 3876, 69);
+INSERT INTO orders VALUES (3805, 3795, 3);
+INSERT INTO orders VALUES (3806, 3714, 34);
+INSERT INTO orders VALUES (3807, 3633, 65);
+INSERT INTO orders VALUES (3808, 3552, 96);
+INSERT INTO orders VALUES (3809, 3471, 30);
+INSERT INTO orders VALUES (3810, 3390, 61);
+INSERT INTO orders VALUES (3811, 3309, 92);
+INSERT INTO orders VALUES (3812, 3228, 26);
+INSERT INTO orders VALUES (3813, 3147, 57);
+INSERT INTO orders VALUES (3814, 3066, 88);
+INSERT INTO orders VALUES (3815, 2985, 22);
+INSERT INTO orders VALUES (3816, 2904, 53);
+INSERT INTO orders VALUES (3817, 2823, 84);
+INSERT INTO orders VALUES (3818, 2742, 18);
+INSERT INTO orders VALUES (3819, 2661, 49);
+INSERT INTO orders VALUES (3820, 2580, 80);
+INSERT INTO orders VALUES (3821, 2499, 14);
+INSERT INTO orders VALUES (3822, 2418, 45);
+INSERT INTO orders VALUES (3823, 2337, 76);
+INSERT INTO orders VALUES (3824, 2256, 10);
+INSERT INTO orders VALUES (3825, 2175, 41);
+INSERT INTO orders VALUES (3826, 2094, 72);
+INSERT INTO orders VALUES (3827, 2013, 6);
+INSERT INTO orders VALUES (3828, 1932, 37);
+INSERT INTO orders VALUES (3829, 1851, 68);
+INSERT INTO orders VALUES (3830, 1770, 2);
+INSERT INTO orders VALUES (3831, 1689, 33);
+INSERT INTO orders VALUES (3832, 1608, 64);
+INSERT INTO orders VALUES (3833, 1527, 95);
+INSERT INTO orders VALUES (3834, 1446, 29);
+INSERT INTO orders VALUES (3835, 1365, 60);
+INSERT INTO orders VALUES (3836, 1284, 91);
+INSERT INTO orders VALUES (3837, 1203, 25);
+INSERT INTO orders VALUES (3838, 1122, 56);
+INSERT INTO orders VALUES (3839, 1041, 87);
+INSERT INTO orders VALUES (3840, 960, 21);
+INSERT INTO orders VALUES (3841, 879, 52);
+INSERT INTO orders VALUES (3842, 798, 83);
+INSERT INTO orders VALUES (3843, 717, 17);
+INSERT INTO orders VALUES (3844, 636, 48);
+INSERT INTO orders VALUES (3845, 555, 79);
+INSERT INTO orders VALUES (3846, 474, 13);
+INSERT INTO orders VALUES (3847, 393, 44);
+INSERT INTO orders VALUES (3848, 312, 75);
+INSERT INTO orders VALUES (3849, 231, 9);
+INSERT INTO orders VALUES (3850, 150, 40);
+INSERT INTO orders VALUES (3851, 69, 71);
+INSERT INTO orders VALUES (3852, 3988, 5);
+INSERT INTO orders VALUES (3853, 3907, 36);
+INSERT INTO orders VALUES (3854, 3826, 67);
+INSERT INTO orders VALUES (3855, 3745, 1);
+INSERT INTO orders VALUES (3856, 3664, 32);
+INSERT INTO orders VALUES (3857, 3583, 63);
+INSERT INTO orders VALUES (3858, 3502, 94);
+INSERT INTO orders VALUES (3859, 3421, 28);
+INSERT INTO orders VALUES (3860, 3340, 59);
+INSERT INTO orders VALUES (3861, 3259, 90);
+INSERT INTO orders VALUES (3862, 3178, 24);
+INSERT INTO orders VALUES (3863, 3097, 55);
+INSERT INTO orders VALUES (3864, 3016, 86);
+INSERT INTO orders VALUES (3865, 2935, 20);
+INSERT INTO orders VALUES (3866, 2854, 51);
+INSERT INTO orders VALUES (3867, 2773, 82);
+INSERT INTO orders VALUES (3868, 2692, 16);
+INSERT INTO orders VALUES (3869, 2611, 47);
+INSERT INTO orders VALUES (3870, 2530, 78);
+INSERT INTO orders VALUES (3871, 2449, 12);
+INSERT INTO orders VALUES (3872, 2368, 43);
+INSERT INTO orders VALUES (3873, 2287, 74);
+INSERT INTO orders VALUES (3874, 2206, 8);
+INSERT INTO orders VALUES (3875, 2125, 39);
+INSERT INTO orders VALUES (3876, 2044, 70);
+INSERT INTO orders VALUES (3877, 1963, 4);
+INSERT INTO orders VALUES (3878, 1882, 35);
+INSERT INTO orders VALUES (3879, 1801, 66);
+INSERT INTO orders VALUES (3880, 1720, 0);
+INSERT INTO orders VALUES (3881, 1639, 31);
+INSERT INTO orders VALUES (3882, 1558, 62);
+INSERT INTO orders VALUES (3883, 1477, 93);
+INSERT INTO orders VALUES (3884, 1396, 27);
+INSERT INTO orders VALUES (3885, 1315, 58);
+INSERT INTO orders VALUES (3886, 1234, 89);
+INSERT INTO orders VALUES (3887, 1153, 23);
+INSERT INTO orders VALUES (3888, 1072, 54);
+INSERT INTO orders VALUES (3889, 991, 85);
+INSERT INTO orders VALUES (3890, 910, 19);
+INSERT INTO orders VALUES (3891, 829, 50);
+INSERT INTO orders VALUES (3892, 748, 81);
+INSERT INTO orders VALUES (3893, 667, 15);
+INSERT INTO orders VALUES (3894, 586, 46);
+INSERT INTO orders VALUES (3895, 505, 77);
+INSERT INTO orders VALUES (3896, 424, 11);
+INSERT INTO orders VALUES (3897, 343, 42);
+INSERT INTO orders VALUES (3898, 262, 73);
+INSERT INTO orders VALUES (3899, 181, 7);
+INSERT INTO orders VALUES (3900, 100, 38);
+INSERT INTO orders VALUES (3901, 19, 69);
+INSERT INTO orders VALUES (3902, 3938, 3);
+INSERT INTO orders VALUES (3903, 3857, 34);
+INSERT INTO orders VALUES (3904, 3776, 65);
+INSERT INTO orders VALUES (3905, 3695, 96);
+INSERT INTO orders VALUES (3906, 3614, 30);
+INSERT INTO orders VALUES (3907, 3533, 61);
+INSERT INTO orders VALUES (3908, 3452, 92);
+INSERT INTO orders VALUES (3909, 3371, 26);
+INSERT INTO orders VALUES (3910, 3290, 57);
+INSERT INTO orders VALUES (3911, 3209, 88);
+INSERT INTO orders VALUES (3912, 3128, 22);
+INSERT INTO orders VALUES (3913, 3047, 53);
+INSERT INTO orders VALUES (3914, 2966, 84);
+INSERT INTO orders VALUES (3915, 2885, 18);
+INSERT INTO orders VALUES (3916, 2804, 49);
+INSERT INTO orders VALUES (3917, 2723, 80);
+INSERT INTO orders VALUES (3918, 2642, 14);
+INSERT INTO orders VALUES (3919, 2561, 45);
+INSERT INTO orders VALUES (3920, 2480, 76);
+INSERT INTO orders VALUES (3921, 2399, 10);
+INSERT INTO orders VALUES (3922, 2318, 41);
+INSERT INTO orders VALUES (3923, 2237, 72);
+INSERT INTO orders VALUES (3924, 2156, 6);
+INSERT INTO orders VALUES (3925, 2075, 37);
+INSERT INTO orders VALUES (3926, 1994, 68);
+INSERT INTO orders VALUES (3927, 1913, 2);
+INSERT INTO orders VALUES (3928, 1832, 33);
+INSERT INTO orders VALUES (3929, 1751, 64);
+INSERT INTO orders VALUES (3930, 1670, 95);
+INSERT INTO orders VALUES (3931, 1589, 29);
+INSERT INTO orders VALUES (3932, 1508, 60);
+INSERT INTO orders VALUES (3933, 1427, 91);
+INSERT INTO orders VALUES (3934, 1346, 25);
+INSERT INTO orders VALUES (3935, 1265, 56);
+INSERT INTO orders VALUES (3936, 1184, 87);
+INSERT INTO orders VALUES (3937, 1103, 21);
+INSERT INTO orders VALUES (3938, 1022, 52);
+INSERT INTO orders VALUES (3939, 941, 83);
+INSERT INTO orders VALUES (3940, 860, 17);
+INSERT INTO orders VALUES (3941, 779, 48);
+INSERT INTO orders VALUES (3942, 698, 79);
+INSERT INTO orders VALUES (3943, 617, 13);
+INSERT INTO orders VALUES (3944, 536, 44);
+INSERT INTO orders VALUES (3945, 455, 75);
+INSERT INTO orders VALUES (3946, 374, 9);
+INSERT INTO orders VALUES (3947, 293, 40);
+INSERT INTO orders VALUES (3948, 212, 71);
+INSERT INTO orders VALUES (3949, 131, 5);
+INSERT INTO orders VALUES (3950, 50, 36);
+INSERT INTO orders VALUES (3951, 3969, 67);
+INSERT INTO orders VALUES (3952, 3888, 1);
+INSERT INTO orders VALUES (3953, 3807, 32);
+INSERT INTO orders VALUES (3954, 3726, 63);
+INSERT INTO orders VALUES (3955, 3645, 94);
+INSERT INTO orders VALUES (3956, 3564, 28);
+INSERT INTO orders VALUES (3957, 3483, 59);
+INSERT INTO orders VALUES (3958, 3402, 90);
+INSERT INTO orders VALUES (3959, 3321, 24);
+INSERT INTO orders VALUES (3960, 3240, 55);
+INSERT INTO orders VALUES (3961, 3159, 86);
+INSERT INTO orders VALUES (3962, 3078, 20);
+INSERT INTO orders VALUES (3963, 2997, 51);
+INSERT INTO orders VALUES (3964, 2916, 82);
+INSERT INTO orders VALUES (3965, 2835, 16);
+INSERT INTO orders VALUES (3966, 2754, 47);
+INSERT INTO orders VALUES (3967, 2673, 78);
+INSERT INTO orders VALUES (3968, 2592, 12);
+INSERT INTO orders VALUES (3969, 2511, 43);
+INSERT INTO orders VALUES (3970, 2430, 74);
+INSERT INTO orders VALUES (3971, 2349, 8);
+INSERT INTO orders VALUES (3972, 2268, 39);
+INSERT INTO orders VALUES (3973, 2187, 70);
+INSERT INTO orders VALUES (3974, 2106, 4);
+INSERT INTO orders VALUES (3975, 2025, 35);
+INSERT INTO orders VALUES (3976, 1944, 66);
+INSERT INTO orders VALUES (3977, 1863, 0);
+INSERT INTO orders VALUES (3978, 1782, 31);
+INSERT INTO orders VALUES (3979, 1701, 62);
+INSERT INTO orders VALUES (3980, 1620, 93);
+INSERT INTO orders VALUES (3981, 1539, 27);
+INSERT INTO orders VALUES (3982, 1458, 58);
+INSERT INTO orders VALUES (3983, 1377, 89);
+INSERT INTO orders VALUES (3984, 1296, 23);
+INSERT INTO orders VALUES (3985, 1215, 54);
+INSERT INTO orders VALUES (3986, 1134, 85);
+INSERT INTO orders VALUES (3987, 1053, 19);
+INSERT INTO orders VALUES (3988, 972, 50);
+INSERT INTO orders VALUES (3989, 891, 81);
+INSERT INTO orders VALUES (3990, 810, 15);
+INSERT INTO orders VALUES (3991, 729, 46);
+INSERT INTO orders VALUES (3992, 648, 77);
+INSERT INTO orders VALUES (3993, 567, 11);
+INSERT INTO orders VALUES (3994, 486, 42);
+INSERT INTO orders VALUES (3995, 405, 73);
+INSERT INTO orders VALUES (3996, 324, 7);
+INSERT INTO orders VALUES (3997, 243, 38);
+INSERT INTO orders VALUES (3998, 162, 69);
+INSERT INTO orders VALUES (3999, 81, 3);
+INSERT INTO notes VALUES (0, 0, 't0');
+INSERT INTO notes VALUES (1, 613, 't1');
+INSERT INTO notes VALUES (2, 1226, 't2');
+INSERT INTO notes VALUES (3, 1839, 't3');
+INSERT INTO notes VALUES (4, 2452, 't4');
+INSERT INTO notes VALUES (5, 3065, 't5');
+INSERT INTO notes VALUES (6, 3678, 't6');
+INSERT INTO notes VALUES (7, 291, 't7');
+INSERT INTO notes VALUES (8, 904, 't8');
+INSERT INTO notes VALUES (9, 1517, 't0');
+INSERT INTO notes VALUES (10, 2130, 't1');
+INSERT INTO notes VALUES (11, 2743, 't2');
+INSERT INTO notes VALUES (12, 3356, 't3');
+INSERT INTO notes VALUES (13, 3969, 't4');
+INSERT INTO notes VALUES (14, 582, 't5');
+INSERT INTO notes VALUES (15, 1195, 't6');
+INSERT INTO notes VALUES (16, 1808, 't7');
+INSERT INTO notes VALUES (17, 2421, 't8');
+INSERT INTO notes VALUES (18, 3034, 't0');
+INSERT INTO notes VALUES (19, 3647, 't1');
+INSERT INTO notes VALUES (20, 260, 't2');
+INSERT INTO notes VALUES (21, 873, 't3');
+INSERT INTO notes VALUES (22, 1486, 't4');
+INSERT INTO notes VALUES (23, 2099, 't5');
+INSERT INTO notes VALUES (24, 2712, 't6');
+INSERT INTO notes VALUES (25, 3325, 't7');
+INSERT INTO notes VALUES (26, 3938, 't8');
+INSERT INTO notes VALUES (27, 551, 't0');
+INSERT INTO notes VALUES (28, 1164, 't1');
+INSERT INTO notes VALUES (29, 1777, 't2');
+INSERT INTO notes VALUES (30, 2390, 't3');
+INSERT INTO notes VALUES (31, 3003, 't4');
+INSERT INTO notes VALUES (32, 3616, 't5');
+INSERT INTO notes VALUES (33, 229, 't6');
+INSERT INTO notes VALUES (34, 842, 't7');
+INSERT INTO notes VALUES (35, 1455, 't8');
+INSERT INTO notes VALUES (36, 2068, 't0');
+INSERT INTO notes VALUES (37, 2681, 't1');
+INSERT INTO notes VALUES (38, 3294, 't2');
+INSERT INTO notes VALUES (39, 3907, 't3');
+INSERT INTO notes VALUES (40, 520, 't4');
+INSERT INTO notes VALUES (41, 1133, 't5');
+INSERT INTO notes VALUES (42, 1746, 't6');
+INSERT INTO notes VALUES (43, 2359, 't7');
+INSERT INTO notes VALUES (44, 2972, 't8');
+INSERT INTO notes VALUES (45, 3585, 't0');
+INSERT INTO notes VALUES (46, 198, 't1');
+INSERT INTO notes VALUES (47, 811, 't2');
+INSERT INTO notes VALUES (48, 1424, 't3');
+INSERT INTO notes VALUES (49, 2037, 't4');
+INSERT INTO notes VALUES (50, 2650, 't5');
+INSERT INTO notes VALUES (51, 3263, 't6');
+INSERT INTO notes VALUES (52, 3876, 't7');
+INSERT INTO notes VALUES (53, 489, 't8');
+INSERT INTO notes VALUES (54, 1102, 't0');
+INSERT INTO notes VALUES (55, 1715, 't1');
+INSERT INTO notes VALUES (56, 2328, 't2');
+INSERT INTO notes VALUES (57, 2941, 't3');
+INSERT INTO notes VALUES (58, 3554, 't4');
+INSERT INTO notes VALUES (59, 167, 't5');
+INSERT INTO notes VALUES (60, 780, 't6');
+INSERT INTO notes VALUES (61, 1393, 't7');
+INSERT INTO notes VALUES (62, 2006, 't8');
+INSERT INTO notes VALUES (63, 2619, 't0');
+INSERT INTO notes VALUES (64, 3232, 't1');
+INSERT INTO notes VALUES (65, 3845, 't2');
+INSERT INTO notes VALUES (66, 458, 't3');
+INSERT INTO notes VALUES (67, 1071, 't4');
+INSERT INTO notes VALUES (68, 1684, 't5');
+INSERT INTO notes VALUES (69, 2297, 't6');
+INSERT INTO notes VALUES (70, 2910, 't7');
+INSERT INTO notes VALUES (71, 3523, 't8');
+INSERT INTO notes VALUES (72, 136, 't0');
+INSERT INTO notes VALUES (73, 749, 't1');
+INSERT INTO notes VALUES (74, 1362, 't2');
+INSERT INTO notes VALUES (75, 1975, 't3');
+INSERT INTO notes VALUES (76, 2588, 't4');
+INSERT INTO notes VALUES (77, 3201, 't5');
+INSERT INTO notes VALUES (78, 3814, 't6');
+INSERT INTO notes VALUES (79, 427, 't7');
+INSERT INTO notes VALUES (80, 1040, 't8');
+INSERT INTO notes VALUES (81, 1653, 't0');
+INSERT INTO notes VALUES (82, 2266, 't1');
+INSERT INTO notes VALUES (83, 2879, 't2');
+INSERT INTO notes VALUES (84, 3492, 't3');
+INSERT INTO notes VALUES (85, 105, 't4');
+INSERT INTO notes VALUES (86, 718, 't5');
+INSERT INTO notes VALUES (87, 1331, 't6');
+INSERT INTO notes VALUES (88, 1944, 't7');
+INSERT INTO notes VALUES (89, 2557, 't8');
+INSERT INTO notes VALUES (90, 3170, 't0');
+INSERT INTO notes VALUES (91, 3783, 't1');
+INSERT INTO notes VALUES (92, 396, 't2');
+INSERT INTO notes VALUES (93, 1009, 't3');
+INSERT INTO notes VALUES (94, 1622, 't4');
+INSERT INTO notes VALUES (95, 2235, 't5');
+INSERT INTO notes VALUES (96, 2848, 't6');
+INSERT INTO notes VALUES (97, 3461, 't7');
+INSERT INTO notes VALUES (98, 74, 't8');
+INSERT INTO notes VALUES (99, 687, 't0');
+INSERT INTO notes VALUES (100, 1300, 't1');
+INSERT INTO notes VALUES (101, 1913, 't2');
+INSERT INTO notes VALUES (102, 2526, 't3');
+INSERT INTO notes VALUES (103, 3139, 't4');
+INSERT INTO notes VALUES (104, 3752, 't5');
+INSERT INTO notes VALUES (105, 365, 't6');
+INSERT INTO notes VALUES (106, 978, 't7');
+INSERT INTO notes VALUES (107, 1591, 't8');
+INSERT INTO notes VALUES (108, 2204, 't0');
+INSERT INTO notes VALUES (109, 2817, 't1');
+INSERT INTO notes VALUES (110, 3430, 't2');
+INSERT INTO notes VALUES (111, 43, 't3');
+INSERT INTO notes VALUES (112, 656, 't4');
+INSERT INTO notes VALUES (113, 1269, 't5');
+INSERT INTO notes VALUES (114, 1882, 't6');
+INSERT INTO notes VALUES (115, 2495, 't7');
+INSERT INTO notes VALUES (116, 3108, 't8');
+INSERT INTO notes VALUES (117, 3721, 't0');
+INSERT INTO notes VALUES (118, 334, 't1');
+INSERT INTO notes VALUES (119, 947, 't2');
+INSERT INTO notes VALUES (120, 1560, 't3');
+INSERT INTO notes VALUES (121, 2173, 't4');
+INSERT INTO notes VALUES (122, 2786, 't5');
+INSERT INTO notes VALUES (123, 3399, 't6');
+INSERT INTO notes VALUES (124, 12, 't7');
+INSERT INTO notes VALUES (125, 625, 't8');
+INSERT INTO notes VALUES (126, 1238, 't0');
+INSERT INTO notes VALUES (127, 1851, 't1');
+INSERT INTO notes VALUES (128, 2464, 't2');
+INSERT INTO notes VALUES (129, 3077, 't3');
+INSERT INTO notes VALUES (130, 3690, 't4');
+INSERT INTO notes VALUES (131, 303, 't5');
+INSERT INTO notes VALUES (132, 916, 't6');
+INSERT INTO notes VALUES (133, 1529, 't7');
+INSERT INTO notes VALUES (134, 2142, 't8');
+INSERT INTO notes VALUES (135, 2755, 't0');
+INSERT INTO notes VALUES (136, 3368, 't1');
+INSERT INTO notes VALUES (137, 3981, 't2');
+INSERT INTO notes VALUES (138, 594, 't3');
+INSERT INTO notes VALUES (139, 1207, 't4');
+INSERT INTO notes VALUES (140, 1820, 't5');
+INSERT INTO notes VALUES (141, 2433, 't6');
+INSERT INTO notes VALUES (142, 3046, 't7');
+INSERT INTO notes VALUES (143, 3659, 't8');
+INSERT INTO notes VALUES (144, 272, 't0');
+INSERT INTO notes VALUES (145, 885, 't1');
+INSERT INTO notes VALUES (146, 1498, 't2');
+INSERT INTO notes VALUES (147, 2111, 't3');
+INSERT INTO notes VALUES (148, 2724, 't4');
+INSERT INTO notes VALUES (149, 3337, 't5');
+INSERT INTO notes VALUES (150, 3950, 't6');
+INSERT INTO notes VALUES (151, 563, 't7');
+INSERT INTO notes VALUES (152, 1176, 't8');
+INSERT INTO notes VALUES (153, 1789, 't0');
+INSERT INTO notes VALUES (154, 2402, 't1');
+INSERT INTO notes VALUES (155, 3015, 't2');
+INSERT INTO notes VALUES (156, 3628, 't3');
+INSERT INTO notes VALUES (157, 241, 't4');
+INSERT INTO notes VALUES (158, 854, 't5');
+INSERT INTO notes VALUES (159, 1467, 't6');
+INSERT INTO notes VALUES (160, 2080, 't7');
+INSERT INTO notes VALUES (161, 2693, 't8');
+INSERT INTO notes VALUES (162, 3306, 't0');
+INSERT INTO notes VALUES (163, 3919, 't1');
+INSERT INTO notes VALUES (164, 532, 't2');
+INSERT INTO notes VALUES (165, 1145, 't3');
+INSERT INTO notes VALUES (166, 1758, 't4');
+INSERT INTO notes VALUES (167, 2371, 't5');
+INSERT INTO notes VALUES (168, 2984, 't6');
+INSERT INTO notes VALUES (169, 3597, 't7');
+INSERT INTO notes VALUES (170, 210, 't8');
+INSERT INTO notes VALUES (171, 823, 't0');
+INSERT INTO notes VALUES (172, 1436, 't1');
+INSERT INTO notes VALUES (173, 2049, 't2');
+INSERT INTO notes VALUES (174, 2662, 't3');
+INSERT INTO notes VALUES (175, 3275, 't4');
+INSERT INTO notes VALUES (176, 3888, 't5');
+INSERT INTO notes VALUES (177, 501, 't6');
+INSERT INTO notes VALUES (178, 1114, 't7');
+INSERT INTO notes VALUES (179, 1727, 't8');
+INSERT INTO notes VALUES (180, 2340, 't0');
+INSERT INTO notes VALUES (181, 2953, 't1');
+INSERT INTO notes VALUES (182, 3566, 't2');
+INSERT INTO notes VALUES (183, 179, 't3');
+INSERT INTO notes VALUES (184, 792, 't4');
+INSERT INTO notes VALUES (185, 1405, 't5');
+INSERT INTO notes VALUES (186, 2018, 't6');
+INSERT INTO notes VALUES (187, 2631, 't7');
+INSERT INTO notes VALUES (188, 3244, 't8');
+INSERT INTO notes VALUES (189, 3857, 't0');
+INSERT INTO notes VALUES (190, 470, 't1');
+INSERT INTO notes VALUES (191, 1083, 't2');
+INSERT INTO notes VALUES (192, 1696, 't3');
+INSERT INTO notes VALUES (193, 2309, 't4');
+INSERT INTO notes VALUES (194, 2922, 't5');
+INSERT INTO notes VALUES (195, 3535, 't6');
+INSERT INTO notes VALUES (196, 148, 't7');
+INSERT INTO notes VALUES (197, 761, 't8');
+INSERT INTO notes VALUES (198, 1374, 't0');
+INSERT INTO notes VALUES (199, 1987, 't1');
+INSERT INTO notes VALUES (200, 2600, 't2');
+INSERT INTO notes VALUES (201, 3213, 't3');
+INSERT INTO notes VALUES (202, 3826, 't4');
+INSERT INTO notes VALUES (203, 439, 't5');
+INSERT INTO notes VALUES (204, 1052, 't6');
+INSERT INTO notes VALUES (205, 1665, 't7');
+INSERT INTO notes VALUES (206, 2278, 't8');
+INSERT INTO notes VALUES (207, 2891, 't0');
+INSERT INTO notes VALUES (208, 3504, 't1');
+INSERT INTO notes VALUES (209, 117, 't2');
+INSERT INTO notes VALUES (210, 730, 't3');
+INSERT INTO notes VALUES (211, 1343, 't4');
+INSERT INTO notes VALUES (212, 1956, 't5');
+INSERT INTO notes VALUES (213, 2569, 't6');
+INSERT INTO notes VALUES (214, 3182, 't7');
+INSERT INTO notes VALUES (215, 3795, 't8');
+INSERT INTO notes VALUES (216, 408, 't0');
+INSERT INTO notes VALUES (217, 1021, 't1');
+INSERT INTO notes VALUES (218, 1634, 't2');
+INSERT INTO notes VALUES (219, 2247, 't3');
+INSERT INTO notes VALUES (220, 2860, 't4');
+INSERT INTO notes VALUES (221, 3473, 't5');
+INSERT INTO notes VALUES (222, 86, 't6');
+INSERT INTO notes VALUES (223, 699, 't7');
+INSERT INTO notes VALUES (224, 1312, 't8');
+INSERT INTO notes VALUES (225, 1925, 't0');
+INSERT INTO notes VALUES (226, 2538, 't1');
+INSERT INTO notes VALUES (227, 3151, 't2');
+INSERT INTO notes VALUES (228, 3764, 't3');
+INSERT INTO notes VALUES (229, 377, 't4');
+INSERT INTO notes VALUES (230, 990, 't5');
+INSERT INTO notes VALUES (231, 1603, 't6');
+INSERT INTO notes VALUES (232, 2216, 't7');
+INSERT INTO notes VALUES (233, 2829, 't8');
+INSERT INTO notes VALUES (234, 3442, 't0');
+INSERT INTO notes VALUES (235, 55, 't1');
+INSERT INTO notes VALUES (236, 668, 't2');
+INSERT INTO notes VALUES (237, 1281, 't3');
+INSERT INTO notes VALUES (238, 1894, 't4');
+INSERT INTO notes VALUES (239, 2507, 't5');
+INSERT INTO notes VALUES (240, 3120, 't6');
+INSERT INTO notes VALUES (241, 3733, 't7');
+INSERT INTO notes VALUES (242, 346, 't8');
+INSERT INTO notes VALUES (243, 959, 't0');
+INSERT INTO notes VALUES (244, 1572, 't1');
+INSERT INTO notes VALUES (245, 2185, 't2');
+INSERT INTO notes VALUES (246, 2798, 't3');
+INSERT INTO notes VALUES (247, 3411, 't4');
+INSERT INTO notes VALUES (248, 24, 't5');
+INSERT INTO notes VALUES (249, 637, 't6');
+INSERT INTO notes VALUES (250, 1250, 't7');
+INSERT INTO notes VALUES (251, 1863, 't8');
+INSERT INTO notes VALUES (252, 2476, 't0');
+INSERT INTO notes VALUES (253, 3089, 't1');
+INSERT INTO notes VALUES (254, 3702, 't2');
+INSERT INTO notes VALUES (255, 315, 't3');
+INSERT INTO notes VALUES (256, 928, 't4');
+INSERT INTO notes VALUES (257, 1541, 't5');
+INSERT INTO notes VALUES (258, 2154, 't6');
+INSERT INTO notes VALUES (259, 2767, 't7');
+INSERT INTO notes VALUES (260, 3380, 't8');
+INSERT INTO notes VALUES (261, 3993, 't0');
+INSERT INTO notes VALUES (262, 606, 't1');
+INSERT INTO notes VALUES (263, 1219, 't2');
+INSERT INTO notes VALUES (264, 1832, 't3');
+INSERT INTO notes VALUES (265, 2445, 't4');
+INSERT INTO notes VALUES (266, 3058, 't5');
+INSERT INTO notes VALUES (267, 3671, 't6');
+INSERT INTO notes VALUES (268, 284, 't7');
+INSERT INTO notes VALUES (269, 897, 't8');
+INSERT INTO notes VALUES (270, 1510, 't0');
+INSERT INTO notes VALUES (271, 2123, 't1');
+INSERT INTO notes VALUES (272, 2736, 't2');
+INSERT INTO notes VALUES (273, 3349, 't3');
+INSERT INTO notes VALUES (274, 3962, 't4');
+INSERT INTO notes VALUES (275, 575, 't5');
+INSERT INTO notes VALUES (276, 1188, 't6');
+INSERT INTO notes VALUES (277, 1801, 't7');
+INSERT INTO notes VALUES (278, 2414, 't8');
+INSERT INTO notes VALUES (279, 3027, 't0');
+INSERT INTO notes VALUES (280, 3640, 't1');
+INSERT INTO notes VALUES (281, 253, 't2');
+INSERT INTO notes VALUES (282, 866, 't3');
+INSERT INTO notes VALUES (283, 1479, 't4');
+INSERT INTO notes VALUES (284, 2092, 't5');
+INSERT INTO notes VALUES (285, 2705, 't6');
+INSERT INTO notes VALUES (286, 3318, 't7');
+INSERT INTO notes VALUES (287, 3931, 't8');
+INSERT INTO notes VALUES (288, 544, 't0');
+INSERT INTO notes VALUES (289, 1157, 't1');
+INSERT INTO notes VALUES (290, 1770, 't2');
+INSERT INTO notes VALUES (291, 2383, 't3');
+INSERT INTO notes VALUES (292, 2996, 't4');
+INSERT INTO notes VALUES (293, 3609, 't5');
+INSERT INTO notes VALUES (294, 222, 't6');
+INSERT INTO notes VALUES (295, 835, 't7');
+INSERT INTO notes VALUES (296, 1448, 't8');
+INSERT INTO notes VALUES (297, 2061, 't0');
+INSERT INTO notes VALUES (298, 2674, 't1');
+INSERT INTO notes VALUES (299, 3287, 't2');
+INSERT INTO notes VALUES (300, 3900, 't3');
+INSERT INTO notes VALUES (301, 513, 't4');
+INSERT INTO notes VALUES (302, 1126, 't5');
+INSERT INTO notes VALUES (303, 1739, 't6');
+INSERT INTO notes VALUES (304, 2352, 't7');
+INSERT INTO notes VALUES (305, 2965, 't8');
+INSERT INTO notes VALUES (306, 3578, 't0');
+INSERT INTO notes VALUES (307, 191, 't1');
+INSERT INTO notes VALUES (308, 804, 't2');
+INSERT INTO notes VALUES (309, 1417, 't3');
+INSERT INTO notes VALUES (310, 2030, 't4');
+INSERT INTO notes VALUES (311, 2643, 't5');
+INSERT INTO notes VALUES (312, 3256, 't6');
+INSERT INTO notes VALUES (313, 3869, 't7');
+INSERT INTO notes VALUES (314, 482, 't8');
+INSERT INTO notes VALUES (315, 1095, 't0');
+INSERT INTO notes VALUES (316, 1708, 't1');
+INSERT INTO notes VALUES (317, 2321, 't2');
+INSERT INTO notes VALUES (318, 2934, 't3');
+INSERT INTO notes VALUES (319, 3547, 't4');
+INSERT INTO notes VALUES (320, 160, 't5');
+INSERT INTO notes VALUES (321, 773, 't6');
+INSERT INTO notes VALUES (322, 1386, 't7');
+INSERT INTO notes VALUES (323, 1999, 't8');
+INSERT INTO notes VALUES (324, 2612, 't0');
+INSERT INTO notes VALUES (325, 3225, 't1');
+INSERT INTO notes VALUES (326, 3838, 't2');
+INSERT INTO notes VALUES (327, 451, 't3');
+INSERT INTO notes VALUES (328, 1064, 't4');
+INSERT INTO notes VALUES (329, 1677, 't5');
+INSERT INTO notes VALUES (330, 2290, 't6');
+INSERT INTO notes VALUES (331, 2903, 't7');
+INSERT INTO notes VALUES (332, 3516, 't8');
+INSERT INTO notes VALUES (333, 129, 't0');
+INSERT INTO notes VALUES (334, 742, 't1');
+INSERT INTO notes VALUES (335, 1355, 't2');
+INSERT INTO notes VALUES (336, 1968, 't3');
+INSERT INTO notes VALUES (337, 2581, 't4');
+INSERT INTO notes VALUES (338, 3194, 't5');
+INSERT INTO notes VALUES (339, 3807, 't6');
+INSERT INTO notes VALUES (340, 420, 't7');
+INSERT INTO notes VALUES (341, 1033, 't8');
+INSERT INTO notes VALUES (342, 1646, 't0');
+INSERT INTO notes VALUES (343, 2259, 't1');
+INSERT INTO notes VALUES (344, 2872, 't2');
+INSERT INTO notes VALUES (345, 3485, 't3');
+INSERT INTO notes VALUES (346, 98, 't4');
+INSERT INTO notes VALUES (347, 711, 't5');
+INSERT INTO notes VALUES (348, 1324, 't6');
+INSERT INTO notes VALUES (349, 1937, 't7');
+INSERT INTO notes VALUES (350, 2550, 't8');
+INSERT INTO notes VALUES (351, 3163, 't0');
+INSERT INTO notes VALUES (352, 3776, 't1');
+INSERT INTO notes VALUES (353, 389, 't2');
+INSERT INTO notes VALUES (354, 1002, 't3');
+INSERT INTO notes VALUES (355, 1615, 't4');
+INSERT INTO notes VALUES (356, 2228, 't5');
+INSERT INTO notes VALUES (357, 2841, 't6');
+INSERT INTO notes VALUES (358, 3454, 't7');
+INSERT INTO notes VALUES (359, 67, 't8');
+INSERT INTO notes VALUES (360, 680, 't0');
+INSERT INTO notes VALUES (361, 1293, 't1');
+INSERT INTO notes VALUES (362, 1906, 't2');
+INSERT INTO notes VALUES (363, 2519, 't3');
+INSERT INTO notes VALUES (364, 3132, 't4');
+INSERT INTO notes VALUES (365, 3745, 't5');
+INSERT INTO notes VALUES (366, 358, 't6');
+INSERT INTO notes VALUES (367, 971, 't7');
+INSERT INTO notes VALUES (368, 1584, 't8');
+INSERT INTO notes VALUES (369, 2197, 't0');
+INSERT INTO notes VALUES (370, 2810, 't1');
+INSERT INTO notes VALUES (371, 3423, 't2');
+INSERT INTO notes VALUES (372, 36, 't3');
+INSERT INTO notes VALUES (373, 649, 't4');
+INSERT INTO notes VALUES (374, 1262, 't5');
+INSERT INTO notes VALUES (375, 1875, 't6');
+INSERT INTO notes VALUES (376, 2488, 't7');
+INSERT INTO notes VALUES (377, 3101, 't8');
+INSERT INTO notes VALUES (378, 3714, 't0');
+INSERT INTO notes VALUES (379, 327, 't1');
+INSERT INTO notes VALUES (380, 940, 't2');
+INSERT INTO notes VALUES (381, 1553, 't3');
+INSERT INTO notes VALUES (382, 2166, 't4');
+INSERT INTO notes VALUES (383, 2779, 't5');
+INSERT INTO notes VALUES (384, 3392, 't6');
+INSERT INTO notes VALUES (385, 5, 't7');
+INSERT INTO notes VALUES (386, 618, 't8');
+INSERT INTO notes VALUES (387, 1231, 't0');
+INSERT INTO notes VALUES (388, 1844, 't1');
+INSERT INTO notes VALUES (389, 2457, 't2');
+INSERT INTO notes VALUES (390, 3070, 't3');
+INSERT INTO notes VALUES (391, 3683, 't4');
+INSERT INTO notes VALUES (392, 296, 't5');
+INSERT INTO notes VALUES (393, 909, 't6');
+INSERT INTO notes VALUES (394, 1522, 't7');
+INSERT INTO notes VALUES (395, 2135, 't8');
+INSERT INTO notes VALUES (396, 2748, 't0');
+INSERT INTO notes VALUES (397, 3361, 't1');
+INSERT INTO notes VALUES (398, 3974, 't2');
+INSERT INTO notes VALUES (399, 587, 't3');
+INSERT INTO notes VALUES (400, 1200, 't4');
+INSERT INTO notes VALUES (401, 1813, 't5');
+INSERT INTO notes VALUES (402, 2426, 't6');
+INSERT INTO notes VALUES (403, 3039, 't7');
+INSERT INTO notes VALUES (404, 3652, 't8');
+INSERT INTO notes VALUES (405, 265, 't0');
+INSERT INTO notes VALUES (406, 878, 't1');
+INSERT INTO notes VALUES (407, 1491, 't2');
+INSERT INTO notes VALUES (408, 2104, 't3');
+INSERT INTO notes VALUES (409, 2717, 't4');
+INSERT INTO notes VALUES (410, 3330, 't5');
+INSERT INTO notes VALUES (411, 3943, 't6');
+INSERT INTO notes VALUES (412, 556, 't7');
+INSERT INTO notes VALUES (413, 1169, 't8');
+INSERT INTO notes VALUES (414, 1782, 't0');
+INSERT INTO notes VALUES (415, 2395, 't1');
+INSERT INTO notes VALUES (416, 3008, 't2');
+INSERT INTO notes VALUES (417, 3621, 't3');
+INSERT INTO notes VALUES (418, 234, 't4');
+INSERT INTO notes VALUES (419, 847, 't5');
+INSERT INTO notes VALUES (420, 1460, 't6');
+INSERT INTO notes VALUES (421, 2073, 't7');
+INSERT INTO notes VALUES (422, 2686, 't8');
+INSERT INTO notes VALUES (423, 3299, 't0');
+INSERT INTO notes VALUES (424, 3912, 't1');
+INSERT INTO notes VALUES (425, 525, 't2');
+INSERT INTO notes VALUES (426, 1138, 't3');
+INSERT INTO notes VALUES (427, 1751, 't4');
+INSERT INTO notes VALUES (428, 2364, 't5');
+INSERT INTO notes VALUES (429, 2977, 't6');
+INSERT INTO notes VALUES (430, 3590, 't7');
+INSERT INTO notes VALUES (431, 203, 't8');
+INSERT INTO notes VALUES (432, 816, 't0');
+INSERT INTO notes VALUES (433, 1429, 't1');
+INSERT INTO notes VALUES (434, 2042, 't2');
+INSERT INTO notes VALUES (435, 2655, 't3');
+INSERT INTO notes VALUES (436, 3268, 't4');
+INSERT INTO notes VALUES (437, 3881, 't5');
+INSERT INTO notes VALUES (438, 494, 't6');
+INSERT INTO notes VALUES (439, 1107, 't7');
+INSERT INTO notes VALUES (440, 1720, 't8');
+INSERT INTO notes VALUES (441, 2333, 't0');
+INSERT INTO notes VALUES (442, 2946, 't1');
+INSERT INTO notes VALUES (443, 3559, 't2');
+INSERT INTO notes VALUES (444, 172, 't3');
+INSERT INTO notes VALUES (445, 785, 't4');
+INSERT INTO notes VALUES (446, 1398, 't5');
+INSERT INTO notes VALUES (447, 2011, 't6');
+INSERT INTO notes VALUES (448, 2624, 't7');
+INSERT INTO notes VALUES (449, 3237, 't8');
+INSERT INTO notes VALUES (450, 3850, 't0');
+INSERT INTO notes VALUES (451, 463, 't1');
+INSERT INTO notes VALUES (452, 1076, 't2');
+INSERT INTO notes VALUES (453, 1689, 't3');
+INSERT INTO notes VALUES (454, 2302, 't4');
+INSERT INTO notes VALUES (455, 2915, 't5');
+INSERT INTO notes VALUES (456, 3528, 't6');
+INSERT INTO notes VALUES (457, 141, 't7');
+INSERT INTO notes VALUES (458, 754, 't8');
+INSERT INTO notes VALUES (459, 1367, 't0');
+INSERT INTO notes VALUES (460, 1980, 't1');
+INSERT INTO notes VALUES (461, 2593, 't2');
+INSERT INTO notes VALUES (462, 3206, 't3');
+INSERT INTO notes VALUES (463, 3819, 't4');
+INSERT INTO notes VALUES (464, 432, 't5');
+INSERT INTO notes VALUES (465, 1045, 't6');
+INSERT INTO notes VALUES (466, 1658, 't7');
+INSERT INTO notes VALUES (467, 2271, 't8');
+INSERT INTO notes VALUES (468, 2884, 't0');
+INSERT INTO notes VALUES (469, 3497, 't1');
+INSERT INTO notes VALUES (470, 110, 't2');
+INSERT INTO notes VALUES (471, 723, 't3');
+INSERT INTO notes VALUES (472, 1336, 't4');
+INSERT INTO notes VALUES (473, 1949, 't5');
+INSERT INTO notes VALUES (474, 2562, 't6');
+INSERT INTO notes VALUES (475, 3175, 't7');
+INSERT INTO notes VALUES (476, 3788, 't8');
+INSERT INTO notes VALUES (477, 401, 't0');
+INSERT INTO notes VALUES (478, 1014, 't1');
+INSERT INTO notes VALUES (479, 1627, 't2');
+INSERT INTO notes VALUES (480, 2240, 't3');
+INSERT INTO notes VALUES (481, 2853, 't4');
+INSERT INTO notes VALUES (482, 3466, 't5');
+INSERT INTO notes VALUES (483, 79, 't6');
+INSERT INTO notes VALUES (484, 692, 't7');
+INSERT INTO notes VALUES (485, 1305, 't8');
+INSERT INTO notes VALUES (486, 1918, 't0');
+INSERT INTO notes VALUES (487, 2531, 't1');
+INSERT INTO notes VALUES (488, 3144, 't2');
+INSERT INTO notes VALUES (489, 3757, 't3');
+INSERT INTO notes VALUES (490, 370, 't4');
+INSERT INTO notes VALUES (491, 983, 't5');
+INSERT INTO notes VALUES (492, 1596, 't6');
+INSERT INTO notes VALUES (493, 2209, 't7');
+INSERT INTO notes VALUES (494, 2822, 't8');
+INSERT INTO notes VALUES (495, 3435, 't0');
+INSERT INTO notes VALUES (496, 48, 't1');
+INSERT INTO notes VALUES (497, 661, 't2');
+INSERT INTO notes VALUES (498, 1274, 't3');
+INSERT INTO notes VALUES (499, 1887, 't4');
+INSERT INTO notes VALUES (500, 2500, 't5');
+INSERT INTO notes VALUES (501, 3113, 't6');
+INSERT INTO notes VALUES (502, 3726, 't7');
+INSERT INTO notes VALUES (503, 339, 't8');
+INSERT INTO notes VALUES (504, 952, 't0');
+INSERT INTO notes VALUES (505, 1565, 't1');
+INSERT INTO notes VALUES (506, 2178, 't2');
+INSERT INTO notes VALUES (507, 2791, 't3');
+INSERT INTO notes VALUES (508, 3404, 't4');
+INSERT INTO notes VALUES (509, 17, 't5');
+INSERT INTO notes VALUES (510, 630, 't6');
+INSERT INTO notes VALUES (511, 1243, 't7');
+INSERT INTO notes VALUES (512, 1856, 't8');
+INSERT INTO notes VALUES (513, 2469, 't0');
+INSERT INTO notes VALUES (514, 3082, 't1');
+INSERT INTO notes VALUES (515, 3695, 't2');
+INSERT INTO notes VALUES (516, 308, 't3');
+INSERT INTO notes VALUES (517, 921, 't4');
+INSERT INTO notes VALUES (518, 1534, 't5');
+INSERT INTO notes VALUES (519, 2147, 't6');
+INSERT INTO notes VALUES (520, 2760, 't7');
+INSERT INTO notes VALUES (521, 3373, 't8');
+INSERT INTO notes VALUES (522, 3986, 't0');
+INSERT INTO notes VALUES (523, 599, 't1');
+INSERT INTO notes VALUES (524, 1212, 't2');
+INSERT INTO notes VALUES (525, 1825, 't3');
+INSERT INTO notes VALUES (526, 2438, 't4');
+INSERT INTO notes VALUES (527, 3051, 't5');
+INSERT INTO notes VALUES (528, 3664, 't6');
+INSERT INTO notes VALUES (529, 277, 't7');
+INSERT INTO notes VALUES (530, 890, 't8');
+INSERT INTO notes VALUES (531, 1503, 't0');
+INSERT INTO notes VALUES (532, 2116, 't1');
+INSERT INTO notes VALUES (533, 2729, 't2');
+INSERT INTO notes VALUES (534, 3342, 't3');
+INSERT INTO notes VALUES (535, 3955, 't4');
+INSERT INTO notes VALUES (536, 568, 't5');
+INSERT INTO notes VALUES (537, 1181, 't6');
+INSERT INTO notes VALUES (538, 1794, 't7');
+INSERT INTO notes VALUES (539, 2407, 't8');
+INSERT INTO notes VALUES (540, 3020, 't0');
+INSERT INTO notes VALUES (541, 3633, 't1');
+INSERT INTO notes VALUES (542, 246, 't2');
+INSERT INTO notes VALUES (543, 859, 't3');
+INSERT INTO notes VALUES (544, 1472, 't4');
+INSERT INTO notes VALUES (545, 2085, 't5');
+INSERT INTO notes VALUES (546, 2698, 't6');
+INSERT INTO notes VALUES (547, 3311, 't7');
+INSERT INTO notes VALUES (548, 3924, 't8');
+INSERT INTO notes VALUES (549, 537, 't0');
+INSERT INTO notes VALUES (550, 1150, 't1');
+INSERT INTO notes VALUES (551, 1763, 't2');
+INSERT INTO notes VALUES (552, 2376, 't3');
+INSERT INTO notes VALUES (553, 2989, 't4');
+INSERT INTO notes VALUES (554, 3602, 't5');
+INSERT INTO notes VALUES (555, 215, 't6');
+INSERT INTO notes VALUES (556, 828, 't7');
+INSERT INTO notes VALUES (557, 1441, 't8');
+INSERT INTO notes VALUES (558, 2054, 't0');
+INSERT INTO notes VALUES (559, 2667, 't1');
+INSERT INTO notes VALUES (560, 3280, 't2');
+INSERT INTO notes VALUES (561, 3893, 't3');
+INSERT INTO notes VALUES (562, 506, 't4');
+INSERT INTO notes VALUES (563, 1119, 't5');
+INSERT INTO notes VALUES (564, 1732, 't6');
+INSERT INTO notes VALUES (565, 2345, 't7');
+INSERT INTO notes VALUES (566, 2958, 't8');
+INSERT INTO notes VALUES (567, 3571, 't0');
+INSERT INTO notes VALUES (568, 184, 't1');
+INSERT INTO notes VALUES (569, 797, 't2');
+INSERT INTO notes VALUES (570, 1410, 't3');
+INSERT INTO notes VALUES (571, 2023, 't4');
+INSERT INTO notes VALUES (572, 2636, 't5');
+INSERT INTO notes VALUES (573, 3249, 't6');
+INSERT INTO notes VALUES (574, 3862, 't7');
+INSERT INTO notes VALUES (575, 475, 't8');
+INSERT INTO notes VALUES (576, 1088, 't0');
+INSERT INTO notes VALUES (577, 1701, 't1');
+INSERT INTO notes VALUES (578, 2314, 't2');
+INSERT INTO notes VALUES (579, 2927, 't3');
+INSERT INTO notes VALUES (580, 3540, 't4');
+INSERT INTO notes VALUES (581, 153, 't5');
+INSERT INTO notes VALUES (582, 766, 't6');
+INSERT INTO notes VALUES (583, 1379, 't7');
+INSERT INTO notes VALUES (584, 1992, 't8');
+INSERT INTO notes VALUES (585, 2605, 't0');
+INSERT INTO notes VALUES (586, 3218, 't1');
+INSERT INTO notes VALUES (587, 3831, 't2');
+INSERT INTO notes VALUES (588, 444, 't3');
+INSERT INTO notes VALUES (589, 1057, 't4');
+INSERT INTO notes VALUES (590, 1670, 't5');
+INSERT INTO notes VALUES (591, 2283, 't6');
+INSERT INTO notes VALUES (592, 2896, 't7');
+INSERT INTO notes VALUES (593, 3509, 't8');
+INSERT INTO notes VALUES (594, 122, 't0');
+INSERT INTO notes VALUES (595, 735, 't1');
+INSERT INTO notes VALUES (596, 1348, 't2');
+INSERT INTO notes VALUES (597, 1961, 't3');
+INSERT INTO notes VALUES (598, 2574, 't4');
+INSERT INTO notes VALUES (599, 3187, 't5');
+INSERT INTO notes VALUES (600, 3800, 't6');
+INSERT INTO notes VALUES (601, 413, 't7');
+INSERT INTO notes VALUES (602, 1026, 't8');
+INSERT INTO notes VALUES (603, 1639, 't0');
+INSERT INTO notes VALUES (604, 2252, 't1');
+INSERT INTO notes VALUES (605, 2865, 't2');
+INSERT INTO notes VALUES (606, 3478, 't3');
+INSERT INTO notes VALUES (607, 91, 't4');
+INSERT INTO notes VALUES (608, 704, 't5');
+INSERT INTO notes VALUES (609, 1317, 't6');
+INSERT INTO notes VALUES (610, 1930, 't7');
+INSERT INTO notes VALUES (611, 2543, 't8');
+INSERT INTO notes VALUES (612, 3156, 't0');
+INSERT INTO notes VALUES (613, 3769, 't1');
+INSERT INTO notes VALUES (614, 382, 't2');
+INSERT INTO notes VALUES (615, 995, 't3');
+INSERT INTO notes VALUES (616, 1608, 't4');
+INSERT INTO notes VALUES (617, 2221, 't5');
+INSERT INTO notes VALUES (618, 2834, 't6');
+INSERT INTO notes VALUES (619, 3447, 't7');
+INSERT INTO notes VALUES (620, 60, 't8');
+INSERT INTO notes VALUES (621, 673, 't0');
+INSERT INTO notes VALUES (622, 1286, 't1');
+INSERT INTO notes VALUES (623, 1899, 't2');
+INSERT INTO notes VALUES (624, 2512, 't3');
+INSERT INTO notes VALUES (625, 3125, 't4');
+INSERT INTO notes VALUES (626, 3738, 't5');
+INSERT INTO notes VALUES (627, 351, 't6');
+INSERT INTO notes VALUES (628, 964, 't7');
+INSERT INTO notes VALUES (629, 1577, 't8');
+INSERT INTO notes VALUES (630, 2190, 't0');
+INSERT INTO notes VALUES (631, 2803, 't1');
+INSERT INTO notes VALUES (632, 3416, 't2');
+INSERT INTO notes VALUES (633, 29, 't3');
+INSERT INTO notes VALUES (634, 642, 't4');
+INSERT INTO notes VALUES (635, 1255, 't5');
+INSERT INTO notes VALUES (636, 1868, 't6');
+INSERT INTO notes VALUES (637, 2481, 't7');
+INSERT INTO notes VALUES (638, 3094, 't8');
+INSERT INTO notes VALUES (639, 3707, 't0');
+INSERT INTO notes VALUES (640, 320, 't1');
+INSERT INTO notes VALUES (641, 933, 't2');
+INSERT INTO notes VALUES (642, 1546, 't3');
+INSERT INTO notes VALUES (643, 2159, 't4');
+INSERT INTO notes VALUES (644, 2772, 't5');
+INSERT INTO notes VALUES (645, 3385, 't6');
+INSERT INTO notes VALUES (646, 3998, 't7');
+INSERT INTO notes VALUES (647, 611, 't8');
+INSERT INTO notes VALUES (648, 1224, 't0');
+INSERT INTO notes VALUES (649, 1837, 't1');
+INSERT INTO notes VALUES (650, 2450, 't2');
+INSERT INTO notes VALUES (651, 3063, 't3');
+INSERT INTO notes VALUES (652, 3676, 't4');
+INSERT INTO notes VALUES (653, 289, 't5');
+INSERT INTO notes VALUES (654, 902, 't6');
+INSERT INTO notes VALUES (655, 1515, 't7');
+INSERT INTO notes VALUES (656, 2128, 't8');
+INSERT INTO notes VALUES (657, 2741, 't0');
+INSERT INTO notes VALUES (658, 3354, 't1');
+INSERT INTO notes VALUES (659, 3967, 't2');
+INSERT INTO notes VALUES (660, 580, 't3');
+INSERT INTO notes VALUES (661, 1193, 't4');
+INSERT INTO notes VALUES (662, 1806, 't5');
+INSERT INTO notes VALUES (663, 2419, 't6');
+INSERT INTO notes VALUES (664, 3032, 't7');
+INSERT INTO notes VALUES (665, 3645, 't8');
+INSERT INTO notes VALUES (666, 258, 't0');
+INSERT INTO notes VALUES (667, 871, 't1');
+INSERT INTO notes VALUES (668, 1484, 't2');
+INSERT INTO notes VALUES (669, 2097, 't3');
+INSERT INTO notes VALUES (670, 2710, 't4');
+INSERT INTO notes VALUES (671, 3323, 't5');
+INSERT INTO notes VALUES (672, 3936, 't6');
+INSERT INTO notes VALUES (673, 549, 't7');
+INSERT INTO notes VALUES (674, 1162, 't8');
+INSERT INTO notes VALUES (675, 1775, 't0');
+INSERT INTO notes VALUES (676, 2388, 't1');
+INSERT INTO notes VALUES (677, 3001, 't2');
+INSERT INTO notes VALUES (678, 3614, 't3');
+INSERT INTO notes VALUES (679, 227, 't4');
+INSERT INTO notes VALUES (680, 840, 't5');
+INSERT INTO notes VALUES (681, 1453, 't6');
+INSERT INTO notes VALUES (682, 2066, 't7');
+INSERT INTO notes VALUES (683, 2679, 't8');
+INSERT INTO notes VALUES (684, 3292, 't0');
+INSERT INTO notes VALUES (685, 3905, 't1');
+INSERT INTO notes VALUES (686, 518, 't2');
+INSERT INTO notes VALUES (687, 1131, 't3');
+INSERT INTO notes VALUES (688, 1744, 't4');
+INSERT INTO notes VALUES (689, 2357, 't5');
+INSERT INTO notes VALUES (690, 2970, 't6');
+INSERT INTO notes VALUES (691, 3583, 't7');
+INSERT INTO notes VALUES (692, 196, 't8');
+INSERT INTO notes VALUES (693, 809, 't0');
+INSERT INTO notes VALUES (694, 1422, 't1');
+INSERT INTO notes VALUES (695, 2035, 't2');
+INSERT INTO notes VALUES (696, 2648, 't3');
+INSERT INTO notes VALUES (697, 3261, 't4');
+INSERT INTO notes VALUES (698, 3874, 't5');
+INSERT INTO notes VALUES (699, 487, 't6');
+INSERT INTO notes VALUES (700, 1100, 't7');
+INSERT INTO notes VALUES (701, 1713, 't8');
+INSERT INTO notes VALUES (702, 2326, 't0');
+INSERT INTO notes VALUES (703, 2939, 't1');
+INSERT INTO notes VALUES (704, 3552, 't2');
+INSERT INTO notes VALUES (705, 165, 't3');
+INSERT INTO notes VALUES (706, 778, 't4');
+INSERT INTO notes VALUES (707, 1391, 't5');
+INSERT INTO notes VALUES (708, 2004, 't6');
+INSERT INTO notes VALUES (709, 2617, 't7');
+INSERT INTO notes VALUES (710, 3230, 't8');
+INSERT INTO notes VALUES (711, 3843, 't0');
+INSERT INTO notes VALUES (712, 456, 't1');
+INSERT INTO notes VALUES (713, 1069, 't2');
+INSERT INTO notes VALUES (714, 1682, 't3');
+INSERT INTO notes VALUES (715, 2295, 't4');
+INSERT INTO notes VALUES (716, 2908, 't5');
+INSERT INTO notes VALUES (717, 3521, 't6');
+INSERT INTO notes VALUES (718, 134, 't7');
+INSERT INTO notes VALUES (719, 747, 't8');
+INSERT INTO notes VALUES (720, 1360, 't0');
+INSERT INTO notes VALUES (721, 1973, 't1');
+INSERT INTO notes VALUES (722, 2586, 't2');
+INSERT INTO notes VALUES (723, 3199, 't3');
+INSERT INTO notes VALUES (724, 3812, 't4');
+INSERT INTO notes VALUES (725, 425, 't5');
+INSERT INTO notes VALUES (726, 1038, 't6');
+INSERT INTO notes VALUES (727, 1651, 't7');
+INSERT INTO notes VALUES (728, 2264, 't8');
+INSERT INTO notes VALUES (729, 2877, 't0');
+INSERT INTO notes VALUES (730, 3490, 't1');
+INSERT INTO notes VALUES (731, 103, 't2');
+INSERT INTO notes VALUES (732, 716, 't3');
+INSERT INTO notes VALUES (733, 1329, 't4');
+INSERT INTO notes VALUES (734, 1942, 't5');
+INSERT INTO notes VALUES (735, 2555, 't6');
+INSERT INTO notes VALUES (736, 3168, 't7');
+INSERT INTO notes VALUES (737, 3781, 't8');
+INSERT INTO notes VALUES (738, 394, 't0');
+INSERT INTO notes VALUES (739, 1007, 't1');
+INSERT INTO notes VALUES (740, 1620, 't2');
+INSERT INTO notes VALUES (741, 2233, 't3');
+INSERT INTO notes VALUES (742, 2846, 't4');
+INSERT INTO notes VALUES (743, 3459, 't5');
+INSERT INTO notes VALUES (744, 72, 't6');
+INSERT INTO notes VALUES (745, 685, 't7');
+INSERT INTO notes VALUES (746, 1298, 't8');
+INSERT INTO notes VALUES (747, 1911, 't0');
+INSERT INTO notes VALUES (748, 2524, 't1');
+INSERT INTO notes VALUES (749, 3137, 't2');
+INSERT INTO notes VALUES (750, 3750, 't3');
+INSERT INTO notes VALUES (751, 363, 't4');
+INSERT INTO notes VALUES (752, 976, 't5');
+INSERT INTO notes VALUES (753, 1589, 't6');
+INSERT INTO notes VALUES (754, 2202, 't7');
+INSERT INTO notes VALUES (755, 2815, 't8');
+INSERT INTO notes VALUES (756, 3428, 't0');
+INSERT INTO notes VALUES (757, 41, 't1');
+INSERT INTO notes VALUES (758, 654, 't2');
+INSERT INTO notes VALUES (759, 1267, 't3');
+INSERT INTO notes VALUES (760, 1880, 't4');
+INSERT INTO notes VALUES (761, 2493, 't5');
+INSERT INTO notes VALUES (762, 3106, 't6');
+INSERT INTO notes VALUES (763, 3719, 't7');
+INSERT INTO notes VALUES (764, 332, 't8');
+INSERT INTO notes VALUES (765, 945, 't0');
+INSERT INTO notes VALUES (766, 1558, 't1');
+INSERT INTO notes VALUES (767, 2171, 't2');
+INSERT INTO notes VALUES (768, 2784, 't3');
+INSERT INTO notes VALUES (769, 3397, 't4');
+INSERT INTO notes VALUES (770, 10, 't5');
+INSERT INTO notes VALUES (771, 623, 't6');
+INSERT INTO notes VALUES (772, 1236, 't7');
+INSERT INTO notes VALUES (773, 1849, 't8');
+INSERT INTO notes VALUES (774, 2462, 't0');
+INSERT INTO notes VALUES (775, 3075, 't1');
+INSERT INTO notes VALUES (776, 3688, 't2');
+INSERT INTO notes VALUES (777, 301, 't3');
+INSERT INTO notes VALUES (778, 914, 't4');
+INSERT INTO notes VALUES (779, 1527, 't5');
+INSERT INTO notes VALUES (780, 2140, 't6');
+INSERT INTO notes VALUES (781, 2753, 't7');
+INSERT INTO notes VALUES (782, 3366, 't8');
+INSERT INTO notes VALUES (783, 3979, 't0');
+INSERT INTO notes VALUES (784, 592, 't1');
+INSERT INTO notes VALUES (785, 1205, 't2');
+INSERT INTO notes VALUES (786, 1818, 't3');
+INSERT INTO notes VALUES (787, 2431, 't4');
+INSERT INTO notes VALUES (788, 3044, 't5');
+INSERT INTO notes VALUES (789, 3657, 't6');
+INSERT INTO notes VALUES (790, 270, 't7');
+INSERT INTO notes VALUES (791, 883, 't8');
+INSERT INTO notes VALUES (792, 1496, 't0');
+INSERT INTO notes VALUES (793, 2109, 't1');
+INSERT INTO notes VALUES (794, 2722, 't2');
+INSERT INTO notes VALUES (795, 3335, 't3');
+INSERT INTO notes VALUES (796, 3948, 't4');
+INSERT INTO notes VALUES (797, 561, 't5');
+INSERT INTO notes VALUES (798, 1174, 't6');
+INSERT INTO notes VALUES (799, 1787, 't7');
+INSERT INTO notes VALUES (800, 2400, 't8');
+INSERT INTO notes VALUES (801, 3013, 't0');
+INSERT INTO notes VALUES (802, 3626, 't1');
+INSERT INTO notes VALUES (803, 239, 't2');
+INSERT INTO notes VALUES (804, 852, 't3');
+INSERT INTO notes VALUES (805, 1465, 't4');
+INSERT INTO notes VALUES (806, 2078, 't5');
+INSERT INTO notes VALUES (807, 2691, 't6');
+INSERT INTO notes VALUES (808, 3304, 't7');
+INSERT INTO notes VALUES (809, 3917, 't8');
+INSERT INTO notes VALUES (810, 530, 't0');
+INSERT INTO notes VALUES (811, 1143, 't1');
+INSERT INTO notes VALUES (812, 1756, 't2');
+INSERT INTO notes VALUES (813, 2369, 't3');
+INSERT INTO notes VALUES (814, 2982, 't4');
+INSERT INTO notes VALUES (815, 3595, 't5');
+INSERT INTO notes VALUES (816, 208, 't6');
+INSERT INTO notes VALUES (817, 821, 't7');
+INSERT INTO notes VALUES (818, 1434, 't8');
+INSERT INTO notes VALUES (819, 2047, 't0');
+INSERT INTO notes VALUES (820, 2660, 't1');
+INSERT INTO notes VALUES (821, 3273, 't2');
+INSERT INTO notes VALUES (822, 3886, 't3');
+INSERT INTO notes VALUES (823, 499, 't4');
+INSERT INTO notes VALUES (824, 1112, 't5');
+INSERT INTO notes VALUES (825, 1725, 't6');
+INSERT INTO notes VALUES (826, 2338, 't7');
+INSERT INTO notes VALUES (827, 2951, 't8');
+INSERT INTO notes VALUES (828, 3564, 't0');
+INSERT INTO notes VALUES (829, 177, 't1');
+INSERT INTO notes VALUES (830, 790, 't2');
+INSERT INTO notes VALUES (831, 1403, 't3');
+INSERT INTO notes VALUES (832, 2016, 't4');
+INSERT INTO notes VALUES (833, 2629, 't5');
+INSERT INTO notes VALUES (834, 3242, 't6');
+INSERT INTO notes VALUES (835, 3855, 't7');
+INSERT INTO notes VALUES (836, 468, 't8');
+INSERT INTO notes VALUES (837, 1081, 't0');
+INSERT INTO notes VALUES (838, 1694, 't1');
+INSERT INTO notes VALUES (839, 2307, 't2');
+INSERT INTO notes VALUES (840, 2920, 't3');
+INSERT INTO notes VALUES (841, 3533, 't4');
+INSERT INTO notes VALUES (842, 146, 't5');
+INSERT INTO notes VALUES (843, 759, 't6');
+INSERT INTO notes VALUES (844, 1372, 't7');
+INSERT INTO notes VALUES (845, 1985, 't8');
+INSERT INTO notes VALUES (846, 2598, 't0');
+INSERT INTO notes VALUES (847, 3211, 't1');
+INSERT INTO notes VALUES (848, 3824, 't2');
+INSERT INTO notes VALUES (849, 437, 't3');
+INSERT INTO notes VALUES (850, 1050, 't4');
+INSERT INTO notes VALUES (851, 1663, 't5');
+INSERT INTO notes VALUES (852, 2276, 't6');
+INSERT INTO notes VALUES (853, 2889, 't7');
+INSERT INTO notes VALUES (854, 3502, 't8');
+INSERT INTO notes VALUES (855, 115, 't0');
+INSERT INTO notes VALUES (856, 728, 't1');
+INSERT INTO notes VALUES (857, 1341, 't2');
+INSERT INTO notes VALUES (858, 1954, 't3');
+INSERT INTO notes VALUES (859, 2567, 't4');
+INSERT INTO notes VALUES (860, 3180, 't5');
+INSERT INTO notes VALUES (861, 3793, 't6');
+INSERT INTO notes VALUES (862, 406, 't7');
+INSERT INTO notes VALUES (863, 1019, 't8');
+INSERT INTO notes VALUES (864, 1632, 't0');
+INSERT INTO notes VALUES (865, 2245, 't1');
+INSERT INTO notes VALUES (866, 2858, 't2');
+INSERT INTO notes VALUES (867, 3471, 't3');
+INSERT INTO notes VALUES (868, 84, 't4');
+INSERT INTO notes VALUES (869, 697, 't5');
+INSERT INTO notes VALUES (870, 1310, 't6');
+INSERT INTO notes VALUES (871, 1923, 't7');
+INSERT INTO notes VALUES (872, 2536, 't8');
+INSERT INTO notes VALUES (873, 3149, 't0');
+INSERT INTO notes VALUES (874, 3762, 't1');
+INSERT INTO notes VALUES (875, 375, 't2');
+INSERT INTO notes VALUES (876, 988, 't3');
+INSERT INTO notes VALUES (877, 1601, 't4');
+INSERT INTO notes VALUES (878, 2214, 't5');
+INSERT INTO notes VALUES (879, 2827, 't6');
+INSERT INTO notes VALUES (880, 3440, 't7');
+INSERT INTO notes VALUES (881, 53, 't8');
+INSERT INTO notes VALUES (882, 666, 't0');
+INSERT INTO notes VALUES (883, 1279, 't1');
+INSERT INTO notes VALUES (884, 1892, 't2');
+INSERT INTO notes VALUES (885, 2505, 't3');
+INSERT INTO notes VALUES (886, 3118, 't4');
+INSERT INTO notes VALUES (887, 3731, 't5');
+INSERT INTO notes VALUES (888, 344, 't6');
+INSERT INTO notes VALUES (889, 957, 't7');
+INSERT INTO notes VALUES (890, 1570, 't8');
+INSERT INTO notes VALUES (891, 2183, 't0');
+INSERT INTO notes VALUES (892, 2796, 't1');
+INSERT INTO notes VALUES (893, 3409, 't2');
+INSERT INTO notes VALUES (894, 22, 't3');
+INSERT INTO notes VALUES (895, 635, 't4');
+INSERT INTO notes VALUES (896, 1248, 't5');
+INSERT INTO notes VALUES (897, 1861, 't6');
+INSERT INTO notes VALUES (898, 2474, 't7');
+INSERT INTO notes VALUES (899, 3087, 't8');
+INSERT INTO notes VALUES (900, 3700, 't0');
+INSERT INTO notes VALUES (901, 313, 't1');
+INSERT INTO notes VALUES (902, 926, 't2');
+INSERT INTO notes VALUES (903, 1539, 't3');
+INSERT INTO notes VALUES (904, 2152, 't4');
+INSERT INTO notes VALUES (905, 2765, 't5');
+INSERT INTO notes VALUES (906, 3378, 't6');
+INSERT INTO notes VALUES (907, 3991, 't7');
+INSERT INTO notes VALUES (908, 604, 't8');
+INSERT INTO notes VALUES (909, 1217, 't0');
+INSERT INTO notes VALUES (910, 1830, 't1');
+INSERT INTO notes VALUES (911, 2443, 't2');
+INSERT INTO notes VALUES (912, 3056, 't3');
+INSERT INTO notes VALUES (913, 3669, 't4');
+INSERT INTO notes VALUES (914, 282, 't5');
+INSERT INTO notes VALUES (915, 895, 't6');
+INSERT INTO notes VALUES (916, 1508, 't7');
+INSERT INTO notes VALUES (917, 2121, 't8');
+INSERT INTO notes VALUES (918, 2734, 't0');
+INSERT INTO notes VALUES (919, 3347, 't1');
+INSERT INTO notes VALUES (920, 3960, 't2');
+INSERT INTO notes VALUES (921, 573, 't3');
+INSERT INTO notes VALUES (922, 1186, 't4');
+INSERT INTO notes VALUES (923, 1799, 't5');
+INSERT INTO notes VALUES (924, 2412, 't6');
+INSERT INTO notes VALUES (925, 3025, 't7');
+INSERT INTO notes VALUES (926, 3638, 't8');
+INSERT INTO notes VALUES (927, 251, 't0');
+INSERT INTO notes VALUES (928, 864, 't1');
+INSERT INTO notes VALUES (929, 1477, 't2');
+INSERT INTO notes VALUES (930, 2090, 't3');
+INSERT INTO notes VALUES (931, 2703, 't4');
+INSERT INTO notes VALUES (932, 3316, 't5');
+INSERT INTO notes VALUES (933, 3929, 't6');
+INSERT INTO notes VALUES (934, 542, 't7');
+INSERT INTO notes VALUES (935, 1155, 't8');
+INSERT INTO notes VALUES (936, 1768, 't0');
+INSERT INTO notes VALUES (937, 2381, 't1');
+INSERT INTO notes VALUES (938, 2994, 't2');
+INSERT INTO notes VALUES (939, 3607, 't3');
+INSERT INTO notes VALUES (940, 220, 't4');
+INSERT INTO notes VALUES (941, 833, 't5');
+INSERT INTO notes VALUES (942, 1446, 't6');
+INSERT INTO notes VALUES (943, 2059, 't7');
+INSERT INTO notes VALUES (944, 2672, 't8');
+INSERT INTO notes VALUES (945, 3285, 't0');
+INSERT INTO notes VALUES (946, 3898, 't1');
+INSERT INTO notes VALUES (947, 511, 't2');
+INSERT INTO notes VALUES (948, 1124, 't3');
+INSERT INTO notes VALUES (949, 1737, 't4');
+INSERT INTO notes VALUES (950, 2350, 't5');
+INSERT INTO notes VALUES (951, 2963, 't6');
+INSERT INTO notes VALUES (952, 3576, 't7');
+INSERT INTO notes VALUES (953, 189, 't8');
+INSERT INTO notes VALUES (954, 802, 't0');
+INSERT INTO notes VALUES (955, 1415, 't1');
+INSERT INTO notes VALUES (956, 2028, 't2');
+INSERT INTO notes VALUES (957, 2641, 't3');
+INSERT INTO notes VALUES (958, 3254, 't4');
+INSERT INTO notes VALUES (959, 3867, 't5');
+INSERT INTO notes VALUES (960, 480, 't6');
+INSERT INTO notes VALUES (961, 1093, 't7');
+INSERT INTO notes VALUES (962, 1706, 't8');
+INSERT INTO notes VALUES (963, 2319, 't0');
+INSERT INTO notes VALUES (964, 2932, 't1');
+INSERT INTO notes VALUES (965, 3545, 't2');
+INSERT INTO notes VALUES (966, 158, 't3');
+INSERT INTO notes VALUES (967, 771, 't4');
+INSERT INTO notes VALUES (968, 1384, 't5');
+INSERT INTO notes VALUES (969, 1997, 't6');
+INSERT INTO notes VALUES (970, 2610, 't7');
+INSERT INTO notes VALUES (971, 3223, 't8');
+INSERT INTO notes VALUES (972, 3836, 't0');
+INSERT INTO notes VALUES (973, 449, 't1');
+INSERT INTO notes VALUES (974, 1062, 't2');
+INSERT INTO notes VALUES (975, 1675, 't3');
+INSERT INTO notes VALUES (976, 2288, 't4');
+INSERT INTO notes VALUES (977, 2901, 't5');
+INSERT INTO notes VALUES (978, 3514, 't6');
+INSERT INTO notes VALUES (979, 127, 't7');
+INSERT INTO notes VALUES (980, 740, 't8');
+INSERT INTO notes VALUES (981, 1353, 't0');
+INSERT INTO notes VALUES (982, 1966, 't1');
+INSERT INTO notes VALUES (983, 2579, 't2');
+INSERT INTO notes VALUES (984, 3192, 't3');
+INSERT INTO notes VALUES (985, 3805, 't4');
+INSERT INTO notes VALUES (986, 418, 't5');
+INSERT INTO notes VALUES (987, 1031, 't6');
+INSERT INTO notes VALUES (988, 1644, 't7');
+INSERT INTO notes VALUES (989, 2257, 't8');
+INSERT INTO notes VALUES (990, 2870, 't0');
+INSERT INTO notes VALUES (991, 3483, 't1');
+INSERT INTO notes VALUES (992, 96, 't2');
+INSERT INTO notes VALUES (993, 709, 't3');
+INSERT INTO notes VALUES (994, 1322, 't4');
+INSERT INTO notes VALUES (995, 1935, 't5');
+INSERT INTO notes VALUES (996, 2548, 't6');
+INSERT INTO notes VALUES (997, 3161, 't7');
+INSERT INTO notes VALUES (998, 3774, 't8');
+INSERT INTO notes VALUES (999, 387, 't0');
+INSERT INTO notes VALUES (1000, 1000, 't1');
+INSERT INTO notes VALUES (1001, 1613, 't2');
+INSERT INTO notes VALUES (1002, 2226, 't3');
+INSERT INTO notes VALUES (1003, 2839, 't4');
+INSERT INTO notes VALUES (1004, 3452, 't5');
+INSERT INTO notes VALUES (1005, 65, 't6');
+INSERT INTO notes VALUES (1006, 678, 't7');
+INSERT INTO notes VALUES (1007, 1291, 't8');
+INSERT INTO notes VALUES (1008, 1904, 't0');
+INSERT INTO notes VALUES (1009, 2517, 't1');
+INSERT INTO notes VALUES (1010, 3130, 't2');
+INSERT INTO notes VALUES (1011, 3743, 't3');
+INSERT INTO notes VALUES (1012, 356, 't4');
+INSERT INTO notes VALUES (1013, 969, 't5');
+INSERT INTO notes VALUES (1014, 1582, 't6');
+INSERT INTO notes VALUES (1015, 2195, 't7');
+INSERT INTO notes VALUES (1016, 2808, 't8');
+INSERT INTO notes VALUES (1017, 3421, 't0');
+INSERT INTO notes VALUES (1018, 34, 't1');
+INSERT INTO notes VALUES (1019, 647, 't2');
+INSERT INTO notes VALUES (1020, 1260, 't3');
+INSERT INTO notes VALUES (1021, 1873, 't4');
+INSERT INTO notes VALUES (1022, 2486, 't5');
+INSERT INTO notes VALUES (1023, 3099, 't6');
+INSERT INTO notes VALUES (1024, 3712, 't7');
+INSERT INTO notes VALUES (1025, 325, 't8');
+INSERT INTO notes VALUES (1026, 938, 't0');
+INSERT INTO notes VALUES (1027, 1551, 't1');
+INSERT INTO notes VALUES (1028, 2164, 't2');
+INSERT INTO notes VALUES (1029, 2777, 't3');
+INSERT INTO notes VALUES (1030, 3390, 't4');
+INSERT INTO notes VALUES (1031, 3, 't5');
+INSERT INTO notes VALUES (1032, 616, 't6');
+INSERT INTO notes VALUES (1033, 1229, 't7');
+INSERT INTO notes VALUES (1034, 1842, 't8');
+INSERT INTO notes VALUES (1035, 2455, 't0');
+INSERT INTO notes VALUES (1036, 3068, 't1');
+INSERT INTO notes VALUES (1037, 3681, 't2');
+INSERT INTO notes VALUES (1038, 294, 't3');
+INSERT INTO notes VALUES (1039, 907, 't4');
+INSERT INTO notes VALUES (1040, 1520, 't5');
+INSERT INTO notes VALUES (1041, 2133, 't6');
+INSERT INTO notes VALUES (1042, 2746, 't7');
+INSERT INTO notes VALUES (1043, 3359, 't8');
+INSERT INTO notes VALUES (1044, 3972, 't0');
+INSERT INTO notes VALUES (1045, 585, 't1');
+INSERT INTO notes VALUES (1046, 1198, 't2');
+INSERT INTO notes VALUES (1047, 1811, 't3');
+INSERT INTO notes VALUES (1048, 2424, 't4');
+INSERT INTO notes VALUES (1049, 3037, 't5');
+INSERT INTO notes VALUES (1050, 3650, 't6');
+INSERT INTO notes VALUES (1051, 263, 't7');
+INSERT INTO notes VALUES (1052, 876, 't8');
+INSERT INTO notes VALUES (1053, 1489, 't0');
+INSERT INTO notes VALUES (1054, 2102, 't1');
+INSERT INTO notes VALUES (1055, 2715, 't2');
+INSERT INTO notes VALUES (1056, 3328, 't3');
+INSERT INTO notes VALUES (1057, 3941, 't4');
+INSERT INTO notes VALUES (1058, 554, 't5');
+INSERT INTO notes VALUES (1059, 1167, 't6');
+INSERT INTO notes VALUES (1060, 1780, 't7');
+INSERT INTO notes VALUES (1061, 2393, 't8');
+INSERT INTO notes VALUES (1062, 3006, 't0');
+INSERT INTO notes VALUES (1063, 3619, 't1');
+INSERT INTO notes VALUES (1064, 232, 't2');
+INSERT INTO notes VALUES (1065, 845, 't3');
+INSERT INTO notes VALUES (1066, 1458, 't4');
+INSERT INTO notes VALUES (1067, 2071, 't5');
+INSERT INTO notes VALUES (1068, 2684, 't6');
+INSERT INTO notes VALUES (1069, 3297, 't7');
+INSERT INTO notes VALUES (1070, 3910, 't8');
+INSERT INTO notes VALUES (1071, 523, 't0');
+INSERT INTO notes VALUES (1072, 1136, 't1');
+INSERT INTO notes VALUES (1073, 1749, 't2');
+INSERT INTO notes VALUES (1074, 2362, 't3');
+INSERT INTO notes VALUES (1075, 2975, 't4');
+INSERT INTO notes VALUES (1076, 3588, 't5');
+INSERT INTO notes VALUES (1077, 201, 't6');
+INSERT INTO notes VALUES (1078, 814, 't7');
+INSERT INTO notes VALUES (1079, 1427, 't8');
+INSERT INTO notes VALUES (1080, 2040, 't0');
+INSERT INTO notes VALUES (1081, 2653, 't1');
+INSERT INTO notes VALUES (1082, 3266, 't2');
+INSERT INTO notes VALUES (1083, 3879, 't3');
+INSERT INTO notes VALUES (1084, 492, 't4');
+INSERT INTO notes VALUES (1085, 1105, 't5');
+INSERT INTO notes VALUES (1086, 1718, 't6');
+INSERT INTO notes VALUES (1087, 2331, 't7');
+INSERT INTO notes VALUES (1088, 2944, 't8');
+INSERT INTO notes VALUES (1089, 3557, 't0');
+INSERT INTO notes VALUES (1090, 170, 't1');
+INSERT INTO notes VALUES (1091, 783, 't2');
+INSERT INTO notes VALUES (1092, 1396, 't3');
+INSERT INTO notes VALUES (1093, 2009, 't4');
+INSERT INTO notes VALUES (1094, 2622, 't5');
+INSERT INTO notes VALUES (1095, 3235, 't6');
+INSERT INTO notes VALUES (1096, 3848, 't7');
+INSERT INTO notes VALUES (1097, 461, 't8');
+INSERT INTO notes VALUES (1098, 1074, 't0');
+INSERT INTO notes VALUES (1099, 1687, 't1');
+INSERT INTO notes VALUES (1100, 2300, 't2');
+INSERT INTO notes VALUES (1101, 2913, 't3');
+INSERT INTO notes VALUES (1102, 3526, 't4');
+INSERT INTO notes VALUES (1103, 139, 't5');
+INSERT INTO notes VALUES (1104, 752, 't6');
+INSERT INTO notes VALUES (1105, 1365, 't7');
+INSERT INTO notes VALUES (1106, 1978, 't8');
+INSERT INTO notes VALUES (1107, 2591, 't0');
+INSERT INTO notes VALUES (1108, 3204, 't1');
+INSERT INTO notes VALUES (1109, 3817, 't2');
+INSERT INTO notes VALUES (1110, 430, 't3');
+INSERT INTO notes VALUES (1111, 1043, 't4');
+INSERT INTO notes VALUES (1112, 1656, 't5');
+INSERT INTO notes VALUES (1113, 2269, 't6');
+INSERT INTO notes VALUES (1114, 2882, 't7');
+INSERT INTO notes VALUES (1115, 3495, 't8');
+INSERT INTO notes VALUES (1116, 108, 't0');
+INSERT INTO notes VALUES (1117, 721, 't1');
+INSERT INTO notes VALUES (1118, 1334, 't2');
+INSERT INTO notes VALUES (1119, 1947, 't3');
+INSERT INTO notes VALUES (1120, 2560, 't4');
+INSERT INTO notes VALUES (1121, 3173, 't5');
+INSERT INTO notes VALUES (1122, 3786, 't6');
+INSERT INTO notes VALUES (1123, 399, 't7');
+INSERT INTO notes VALUES (1124, 1012, 't8');
+INSERT INTO notes VALUES (1125, 1625, 't0');
+INSERT INTO notes VALUES (1126, 2238, 't1');
+INSERT INTO notes VALUES (1127, 2851, 't2');
+INSERT INTO notes VALUES (1128, 3464, 't3');
+INSERT INTO notes VALUES (1129, 77, 't4');
+INSERT INTO notes VALUES (1130, 690, 't5');
+INSERT INTO notes VALUES (1131, 1303, 't6');
+INSERT INTO notes VALUES (1132, 1916, 't7');
+INSERT INTO notes VALUES (1133, 2529, 't8');
+INSERT INTO notes VALUES (1134, 3142, 't0');
+INSERT INTO notes VALUES (1135, 3755, 't1');
+INSERT INTO notes VALUES (1136, 368, 't2');
+INSERT INTO notes VALUES (1137, 981, 't3');
+INSERT INTO notes VALUES (1138, 1594, 't4');
+INSERT INTO notes VALUES (1139, 2207, 't5');
+INSERT INTO notes VALUES (1140, 2820, 't6');
+INSERT INTO notes VALUES (1141, 3433, 't7');
+INSERT INTO notes VALUES (1142, 46, 't8');
+INSERT INTO notes VALUES (1143, 659, 't0');
+INSERT INTO notes VALUES (1144, 1272, 't1');
+INSERT INTO notes VALUES (1145, 1885, 't2');
+INSERT INTO notes VALUES (1146, 2498, 't3');
+INSERT INTO notes VALUES (1147, 3111, 't4');
+INSERT INTO notes VALUES (1148, 3724, 't5');
+INSERT INTO notes VALUES (1149, 337, 't6');
+INSERT INTO notes VALUES (1150, 950, 't7');
+INSERT INTO notes VALUES (1151, 1563, 't8');
+INSERT INTO notes VALUES (1152, 2176, 't0');
+INSERT INTO notes VALUES (1153, 2789, 't1');
+INSERT INTO notes VALUES (1154, 3402, 't2');
+INSERT INTO notes VALUES (1155, 15, 't3');
+INSERT INTO notes VALUES (1156, 628, 't4');
+INSERT INTO notes VALUES (1157, 1241, 't5');
+INSERT INTO notes VALUES (1158, 1854, 't6');
+INSERT INTO notes VALUES (1159, 2467, 't7');
+INSERT INTO notes VALUES (1160, 3080, 't8');
+INSERT INTO notes VALUES (1161, 3693, 't0');
+INSERT INTO notes VALUES (1162, 306, 't1');
+INSERT INTO notes VALUES (1163, 919, 't2');
+INSERT INTO notes VALUES (1164, 1532, 't3');
+INSERT INTO notes VALUES (1165, 2145, 't4');
+INSERT INTO notes VALUES (1166, 2758, 't5');
+INSERT INTO notes VALUES (1167, 3371, 't6');
+INSERT INTO notes VALUES (1168, 3984, 't7');
+INSERT INTO notes VALUES (1169, 597, 't8');
+INSERT INTO notes VALUES (1170, 1210, 't0');
+INSERT INTO notes VALUES (1171, 1823, 't1');
+INSERT INTO notes VALUES (1172, 2436, 't2');
+INSERT INTO notes VALUES (1173, 3049, 't3');
+INSERT INTO notes VALUES (1174, 3662, 't4');
+INSERT INTO notes VALUES (1175, 275, 't5');
+INSERT INTO notes VALUES (1176, 888, 't6');
+INSERT INTO notes VALUES (1177, 1501, 't7');
+INSERT INTO notes VALUES (1178, 2114, 't8');
+INSERT INTO notes VALUES (1179, 2727, 't0');
+INSERT INTO notes VALUES (1180, 3340, 't1');
+INSERT INTO notes VALUES (1181, 3953, 't2');
+INSERT INTO notes VALUES (1182, 566, 't3');
+INSERT INTO notes VALUES (1183, 1179, 't4');
+INSERT INTO notes VALUES (1184, 1792, 't5');
+INSERT INTO notes VALUES (1185, 2405, 't6');
+INSERT INTO notes VALUES (1186, 3018, 't7');
+INSERT INTO notes VALUES (1187, 3631, 't8');
+INSERT INTO notes VALUES (1188, 244, 't0');
+INSERT INTO notes VALUES (1189, 857, 't1');
+INSERT INTO notes VALUES (1190, 1470, 't2');
+INSERT INTO notes VALUES (1191, 2083, 't3');
+INSERT INTO notes VALUES (1192, 2696, 't4');
+INSERT INTO notes VALUES (1193, 3309, 't5');
+INSERT INTO notes VALUES (1194, 3922, 't6');
+INSERT INTO notes VALUES (1195, 535, 't7');
+INSERT INTO notes VALUES (1196, 1148, 't8');
+INSERT INTO notes VALUES (1197, 1761, 't0');
+INSERT INTO notes VALUES (1198, 2374, 't1');
+INSERT INTO notes VALUES (1199, 2987, 't2');
+INSERT INTO notes VALUES (1200, 3600, 't3');
+INSERT INTO notes VALUES (1201, 213, 't4');
+INSERT INTO notes VALUES (1202, 826, 't5');
+INSERT INTO notes VALUES (1203, 1439, 't6');
+INSERT INTO notes VALUES (1204, 2052, 't7');
+INSERT INTO notes VALUES (1205, 2665, 't8');
+INSERT INTO notes VALUES (1206, 3278, 't0');
+INSERT INTO notes VALUES (1207, 3891, 't1');
+INSERT INTO notes VALUES (1208, 504, 't2');
+INSERT INTO notes VALUES (1209, 1117, 't3');
+INSERT INTO notes VALUES (1210, 1730, 't4');
+INSERT INTO notes VALUES (1211, 2343, 't5');
+INSERT INTO notes VALUES (1212, 2956, 't6');
+INSERT INTO notes VALUES (1213, 3569, 't7');
+INSERT INTO notes VALUES (1214, 182, 't8');
+INSERT INTO notes VALUES (1215, 795, 't0');
+INSERT INTO notes VALUES (1216, 1408, 't1');
+INSERT INTO notes VALUES (1217, 2021, 't2');
+INSERT INTO notes VALUES (1218, 2634, 't3');
+INSERT INTO notes VALUES (1219, 3247, 't4');
+INSERT INTO notes VALUES (1220, 3860, 't5');
+INSERT INTO notes VALUES (1221, 473, 't6');
+INSERT INTO notes VALUES (1222, 1086, 't7');
+INSERT INTO notes VALUES (1223, 1699, 't8');
+INSERT INTO notes VALUES (1224, 2312, 't0');
+INSERT INTO notes VALUES (1225, 2925, 't1');
+INSERT INTO notes VALUES (1226, 3538, 't2');
+INSERT INTO notes VALUES (1227, 151, 't3');
+INSERT INTO notes VALUES (1228, 764, 't4');
+INSERT INTO notes VALUES (1229, 1377, 't5');
+INSERT INTO notes VALUES (1230, 1990, 't6');
+INSERT INTO notes VALUES (1231, 2603, 't7');
+INSERT INTO notes VALUES (1232, 3216, 't8');
+INSERT INTO notes VALUES (1233, 3829, 't0');
+INSERT INTO notes VALUES (1234, 442, 't1');
+INSERT INTO notes VALUES (1235, 1055, 't2');
+INSERT INTO notes VALUES (1236, 1668, 't3');
+INSERT INTO notes VALUES (1237, 2281, 't4');
+INSERT INTO notes VALUES (1238, 2894, 't5');
+INSERT INTO notes VALUES (1239, 3507, 't6');
+INSERT INTO notes VALUES (1240, 120, 't7');
+INSERT INTO notes VALUES (1241, 733, 't8');
+INSERT INTO notes VALUES (1242, 1346, 't0');
+INSERT INTO notes VALUES (1243, 1959, 't1');
+INSERT INTO notes VALUES (1244, 2572, 't2');
+INSERT INTO notes VALUES (1245, 3185, 't3');
+INSERT INTO notes VALUES (1246, 3798, 't4');
+INSERT INTO notes VALUES (1247, 411, 't5');
+INSERT INTO notes VALUES (1248, 1024, 't6');
+INSERT INTO notes VALUES (1249, 1637, 't7');
+INSERT INTO notes VALUES (1250, 2250, 't8');
+INSERT INTO notes VALUES (1251, 2863, 't0');
+INSERT INTO notes VALUES (1252, 3476, 't1');
+INSERT INTO notes VALUES (1253, 89, 't2');
+INSERT INTO notes VALUES (1254, 702, 't3');
+INSERT INTO notes VALUES (1255, 1315, 't4');
+INSERT INTO notes VALUES (1256, 1928, 't5');
+INSERT INTO notes VALUES (1257, 2541, 't6');
+INSERT INTO notes VALUES (1258, 3154, 't7');
+INSERT INTO notes VALUES (1259, 3767, 't8');
+INSERT INTO notes VALUES (1260, 380, 't0');
+INSERT INTO notes VALUES (1261, 993, 't1');
+INSERT INTO notes VALUES (1262, 1606, 't2');
+INSERT INTO notes VALUES (1263, 2219, 't3');
+INSERT INTO notes VALUES (1264, 2832, 't4');
+INSERT INTO notes VALUES (1265, 3445, 't5');
+INSERT INTO notes VALUES (1266, 58, 't6');
+INSERT INTO notes VALUES (1267, 671, 't7');
+INSERT INTO notes VALUES (1268, 1284, 't8');
+INSERT INTO notes VALUES (1269, 1897, 't0');
+INSERT INTO notes VALUES (1270, 2510, 't1');
+INSERT INTO notes VALUES (1271, 3123, 't2');
+INSERT INTO notes VALUES (1272, 3736, 't3');
+INSERT INTO notes VALUES (1273, 349, 't4');
+INSERT INTO notes VALUES (1274, 962, 't5');
+INSERT INTO notes VALUES (1275, 1575, 't6');
+INSERT INTO notes VALUES (1276, 2188, 't7');
+INSERT INTO notes VALUES (1277, 2801, 't8');
+INSERT INTO notes VALUES (1278, 3414, 't0');
+INSERT INTO notes VALUES (1279, 27, 't1');
+INSERT INTO notes VALUES (1280, 640, 't2');
+INSERT INTO notes VALUES (1281, 1253, 't3');
+INSERT INTO notes VALUES (1282, 1866, 't4');
+INSERT INTO notes VALUES (1283, 2479, 't5');
+INSERT INTO notes VALUES (1284, 3092, 't6');
+INSERT INTO notes VALUES (1285, 3705, 't7');
+INSERT INTO notes VALUES (1286, 318, 't8');
+INSERT INTO notes VALUES (1287, 931, 't0');
+INSERT INTO notes VALUES (1288, 1544, 't1');
+INSERT INTO notes VALUES (1289, 2157, 't2');
+INSERT INTO notes VALUES (1290, 2770, 't3');
+INSERT INTO notes VALUES (1291, 3383, 't4');
+INSERT INTO notes VALUES (1292, 3996, 't5');
+INSERT INTO notes VALUES (1293, 609, 't6');
+INSERT INTO notes VALUES (1294, 1222, 't7');
+INSERT INTO notes VALUES (1295, 1835, 't8');
+INSERT INTO notes VALUES (1296, 2448, 't0');
+INSERT INTO notes VALUES (1297, 3061, 't1');
+INSERT INTO notes VALUES (1298, 3674, 't2');
+INSERT INTO notes VALUES (1299, 287, 't3');
+INSERT INTO notes VALUES (1300, 900, 't4');
+INSERT INTO notes VALUES (1301, 1513, 't5');
+INSERT INTO notes VALUES (1302, 2126, 't6');
+INSERT INTO notes VALUES (1303, 2739, 't7');
+INSERT INTO notes VALUES (1304, 3352, 't8');
+INSERT INTO notes VALUES (1305, 3965, 't0');
+INSERT INTO notes VALUES (1306, 578, 't1');
+INSERT INTO notes VALUES (1307, 1191, 't2');
+INSERT INTO notes VALUES (1308, 1804, 't3');
+INSERT INTO notes VALUES (1309, 2417, 't4');
+INSERT INTO notes VALUES (1310, 3030, 't5');
+INSERT INTO notes VALUES (1311, 3643, 't6');
+INSERT INTO notes VALUES (1312, 256, 't7');
+INSERT INTO notes VALUES (1313, 869, 't8');
+INSERT INTO notes VALUES (1314, 1482, 't0');
+INSERT INTO notes VALUES (1315, 2095, 't1');
+INSERT INTO notes VALUES (1316, 2708, 't2');
+INSERT INTO notes VALUES (1317, 3321, 't3');
+INSERT INTO notes VALUES (1318, 3934, 't4');
+INSERT INTO notes VALUES (1319, 547, 't5');
+INSERT INTO notes VALUES (1320, 1160, 't6');
+INSERT INTO notes VALUES (1321, 1773, 't7');
+INSERT INTO notes VALUES (1322, 2386, 't8');
+INSERT INTO notes VALUES (1323, 2999, 't0');
+INSERT INTO notes VALUES (1324, 3612, 't1');
+INSERT INTO notes VALUES (1325, 225, 't2');
+INSERT INTO notes VALUES (1326, 838, 't3');
+INSERT INTO notes VALUES (1327, 1451, 't4');
+INSERT INTO notes VALUES (1328, 2064, 't5');
+INSERT INTO notes VALUES (1329, 2677, 't6');
+INSERT INTO notes VALUES (1330, 3290, 't7');
+INSERT INTO notes VALUES (1331, 3903, 't8');
+INSERT INTO notes VALUES (1332, 516, 't0');
+INSERT INTO notes VALUES (1333, 1129, 't1');
+INSERT INTO notes VALUES (1334, 1742, 't2');
+INSERT INTO notes VALUES (1335, 2355, 't3');
+INSERT INTO notes VALUES (1336, 2968, 't4');
+INSERT INTO notes VALUES (1337, 3581, 't5');
+INSERT INTO notes VALUES (1338, 194, 't6');
+INSERT INTO notes VALUES (1339, 807, 't7');
+INSERT INTO notes VALUES (1340, 1420, 't8');
+INSERT INTO notes VALUES (1341, 2033, 't0');
+INSERT INTO notes VALUES (1342, 2646, 't1');
+INSERT INTO notes VALUES (1343, 3259, 't2');
+INSERT INTO notes VALUES (1344, 3872, 't3');
+INSERT INTO notes VALUES (1345, 485, 't4');
+INSERT INTO notes VALUES (1346, 1098, 't5');
+INSERT INTO notes VALUES (1347, 1711, 't6');
+INSERT INTO notes VALUES (1348, 2324, 't7');
+INSERT INTO notes VALUES (1349, 2937, 't8');
+INSERT INTO notes VALUES (1350, 3550, 't0');
+INSERT INTO notes VALUES (1351, 163, 't1');
+INSERT INTO notes VALUES (1352, 776, 't2');
+INSERT INTO notes VALUES (1353, 1389, 't3');
+INSERT INTO notes VALUES (1354, 2002, 't4');
+INSERT INTO notes VALUES (1355, 2615, 't5');
+INSERT INTO notes VALUES (1356, 3228, 't6');
+INSERT INTO notes VALUES (1357, 3841, 't7');
+INSERT INTO notes VALUES (1358, 454, 't8');
+INSERT INTO notes VALUES (1359, 1067, 't0');
+INSERT INTO notes VALUES (1360, 1680, 't1');
+INSERT INTO notes VALUES (1361, 2293, 't2');
+INSERT INTO notes VALUES (1362, 2906, 't3');
+INSERT INTO notes VALUES (1363, 3519, 't4');
+INSERT INTO notes VALUES (1364, 132, 't5');
+INSERT INTO notes VALUES (1365, 745, 't6');
+INSERT INTO notes VALUES (1366, 1358, 't7');
+INSERT INTO notes VALUES (1367, 1971, 't8');
+INSERT INTO notes VALUES (1368, 2584, 't0');
+INSERT INTO notes VALUES (1369, 3197, 't1');
+INSERT INTO notes VALUES (1370, 3810, 't2');
+INSERT INTO notes VALUES (1371, 423, 't3');
+INSERT INTO notes VALUES (1372, 1036, 't4');
+INSERT INTO notes VALUES (1373, 1649, 't5');
+INSERT INTO notes VALUES (1374, 2262, 't6');
+INSERT INTO notes VALUES (1375, 2875, 't7');
+INSERT INTO notes VALUES (1376, 3488, 't8');
+INSERT INTO notes VALUES (1377, 101, 't0');
+INSERT INTO notes VALUES (1378, 714, 't1');
+INSERT INTO notes VALUES (1379, 1327, 't2');
+INSERT INTO notes VALUES (1380, 1940, 't3');
+INSERT INTO notes VALUES (1381, 2553, 't4');
+INSERT INTO notes VALUES (1382, 3166, 't5');
+INSERT INTO notes VALUES (1383, 3779, 't6');
+INSERT INTO notes VALUES (1384, 392, 't7');
+INSERT INTO notes VALUES (1385, 1005, 't8');
+INSERT INTO notes VALUES (1386, 1618, 't0');
+INSERT INTO notes VALUES (1387, 2231, 't1');
+INSERT INTO notes VALUES (1388, 2844, 't2');
+INSERT INTO notes VALUES (1389, 3457, 't3');
+INSERT INTO notes VALUES (1390, 70, 't4');
+INSERT INTO notes VALUES (1391, 683, 't5');
+INSERT INTO notes VALUES (1392, 1296, 't6');
+INSERT INTO notes VALUES (1393, 1909, 't7');
+INSERT INTO notes VALUES (1394, 2522, 't8');
+INSERT INTO notes VALUES (1395, 3135, 't0');
+INSERT INTO notes VALUES (1396, 3748, 't1');
+INSERT INTO notes VALUES (1397, 361, 't2');
+INSERT INTO notes VALUES (1398, 974, 't3');
+INSERT INTO notes VALUES (1399, 1587, 't4');
+INSERT INTO notes VALUES (1400, 2200, 't5');
+INSERT INTO notes VALUES (1401, 2813, 't6');
+INSERT INTO notes VALUES (1402, 3426, 't7');
+INSERT INTO notes VALUES (1403, 39, 't8');
+INSERT INTO notes VALUES (1404, 652, 't0');
+INSERT INTO notes VALUES (1405, 1265, 't1');
+INSERT INTO notes VALUES (1406, 1878, 't2');
+INSERT INTO notes VALUES (1407, 2491, 't3');
+INSERT INTO notes VALUES (1408, 3104, 't4');
+INSERT INTO notes VALUES (1409, 3717, 't5');
+INSERT INTO notes VALUES (1410, 330, 't6');
+INSERT INTO notes VALUES (1411, 943, 't7');
+INSERT INTO notes VALUES (1412, 1556, 't8');
+INSERT INTO notes VALUES (1413, 2169, 't0');
+INSERT INTO notes VALUES (1414, 2782, 't1');
+INSERT INTO notes VALUES (1415, 3395, 't2');
+INSERT INTO notes VALUES (1416, 8, 't3');
+INSERT INTO notes VALUES (1417, 621, 't4');
+INSERT INTO notes VALUES (1418, 1234, 't5');
+INSERT INTO notes VALUES (1419, 1847, 't6');
+INSERT INTO notes VALUES (1420, 2460, 't7');
+INSERT INTO notes VALUES (1421, 3073, 't8');
+INSERT INTO notes VALUES (1422, 3686, 't0');
+INSERT INTO notes VALUES (1423, 299, 't1');
+INSERT INTO notes VALUES (1424, 912, 't2');
+INSERT INTO notes VALUES (1425, 1525, 't3');
+INSERT INTO notes VALUES (1426, 2138, 't4');
+INSERT INTO notes VALUES (1427, 2751, 't5');
+INSERT INTO notes VALUES (1428, 3364, 't6');
+INSERT INTO notes VALUES (1429, 3977, 't7');
+INSERT INTO notes VALUES (1430, 590, 't8');
+INSERT INTO notes VALUES (1431, 1203, 't0');
+INSERT INTO notes VALUES (1432, 1816, 't1');
+INSERT INTO notes VALUES (1433, 2429, 't2');
+INSERT INTO notes VALUES (1434, 3042, 't3');
+INSERT INTO notes VALUES (1435, 3655, 't4');
+INSERT INTO notes VALUES (1436, 268, 't5');
+INSERT INTO notes VALUES (1437, 881, 't6');
+INSERT INTO notes VALUES (1438, 1494, 't7');
+INSERT INTO notes VALUES (1439, 2107, 't8');
+INSERT INTO notes VALUES (1440, 2720, 't0');
+INSERT INTO notes VALUES (1441, 3333, 't1');
+INSERT INTO notes VALUES (1442, 3946, 't2');
+INSERT INTO notes VALUES (1443, 559, 't3');
+INSERT INTO notes VALUES (1444, 1172, 't4');
+INSERT INTO notes VALUES (1445, 1785, 't5');
+INSERT INTO notes VALUES (1446, 2398, 't6');
+INSERT INTO notes VALUES (1447, 3011, 't7');
+INSERT INTO notes VALUES (1448, 3624, 't8');
+INSERT INTO notes VALUES (1449, 237, 't0');
+INSERT INTO notes VALUES (1450, 850, 't1');
+INSERT INTO notes VALUES (1451, 1463, 't2');
+INSERT INTO notes VALUES (1452, 2076, 't3');
+INSERT INTO notes VALUES (1453, 2689, 't4');
+INSERT INTO notes VALUES (1454, 3302, 't5');
+INSERT INTO notes VALUES (1455, 3915, 't6');
+INSERT INTO notes VALUES (1456, 528, 't7');
+INSERT INTO notes VALUES (1457, 1141, 't8');
+INSERT INTO notes VALUES (1458, 1754, 't0');
+INSERT INTO notes VALUES (1459, 2367, 't1');
+INSERT INTO notes VALUES (1460, 2980, 't2');
+INSERT INTO notes VALUES (1461, 3593, 't3');
+INSERT INTO notes VALUES (1462, 206, 't4');
+INSERT INTO notes VALUES (1463, 819, 't5');
+INSERT INTO notes VALUES (1464, 1432, 't6');
+INSERT INTO notes VALUES (1465, 2045, 't7');
+INSERT INTO notes VALUES (1466, 2658, 't8');
+INSERT INTO notes VALUES (1467, 3271, 't0');
+INSERT INTO notes VALUES (1468, 3884, 't1');
+INSERT INTO notes VALUES (1469, 497, 't2');
+INSERT INTO notes VALUES (1470, 1110, 't3');
+INSERT INTO notes VALUES (1471, 1723, 't4');
+INSERT INTO notes VALUES (1472, 2336, 't5');
+INSERT INTO notes VALUES (1473, 2949, 't6');
+INSERT INTO notes VALUES (1474, 3562, 't7');
+INSERT INTO notes VALUES (1475, 175, 't8');
+INSERT INTO notes VALUES (1476, 788, 't0');
+INSERT INTO notes VALUES (1477, 1401, 't1');
+INSERT INTO notes VALUES (1478, 2014, 't2');
+INSERT INTO notes VALUES (1479, 2627, 't3');
+INSERT INTO notes VALUES (1480, 3240, 't4');
+INSERT INTO notes VALUES (1481, 3853, 't5');
+INSERT INTO notes VALUES (1482, 466, 't6');
+INSERT INTO notes VALUES (1483, 1079, 't7');
+INSERT INTO notes VALUES (1484, 1692, 't8');
+INSERT INTO notes VALUES (1485, 2305, 't0');
+INSERT INTO notes VALUES (1486, 2918, 't1');
+INSERT INTO notes VALUES (1487, 3531, 't2');
+INSERT INTO notes VALUES (1488, 144, 't3');
+INSERT INTO notes VALUES (1489, 757, 't4');
+INSERT INTO notes VALUES (1490, 1370, 't5');
+INSERT INTO notes VALUES (1491, 1983, 't6');
+INSERT INTO notes VALUES (1492, 2596, 't7');
+INSERT INTO notes VALUES (1493, 3209, 't8');
+INSERT INTO notes VALUES (1494, 3822, 't0');
+INSERT INTO notes VALUES (1495, 435, 't1');
+INSERT INTO notes VALUES (1496, 1048, 't2');
+INSERT INTO notes VALUES (1497, 1661, 't3');
+INSERT INTO notes VALUES (1498, 2274, 't4');
+INSERT INTO notes VALUES (1499, 2887, 't5');
+INSERT INTO notes VALUES (1500, 3500, 't6');
+INSERT INTO notes VALUES (1501, 113, 't7');
+INSERT INTO notes VALUES (1502, 726, 't8');
+INSERT INTO notes VALUES (1503, 1339, 't0');
+INSERT INTO notes VALUES (1504, 1952, 't1');
+INSERT INTO notes VALUES (1505, 2565, 't2');
+INSERT INTO notes VALUES (1506, 3178, 't3');
+INSERT INTO notes VALUES (1507, 3791, 't4');
+INSERT INTO notes VALUES (1508, 404, 't5');
+INSERT INTO notes VALUES (1509, 1017, 't6');
+INSERT INTO notes VALUES (1510, 1630, 't7');
+INSERT INTO notes VALUES (1511, 2243, 't8');
+INSERT INTO notes VALUES (1512, 2856, 't0');
+INSERT INTO notes VALUES (1513, 3469, 't1');
+INSERT INTO notes VALUES (1514, 82, 't2');
+INSERT INTO notes VALUES (1515, 695, 't3');
+INSERT INTO notes VALUES (1516, 1308, 't4');
+INSERT INTO notes VALUES (1517, 1921, 't5');
+INSERT INTO notes VALUES (1518, 2534, 't6');
+INSERT INTO notes VALUES (1519, 3147, 't7');
+INSERT INTO notes VALUES (1520, 3760, 't8');
+INSERT INTO notes VALUES (1521, 373, 't0');
+INSERT INTO notes VALUES (1522, 986, 't1');
+INSERT INTO notes VALUES (1523, 1599, 't2');
+INSERT INTO notes VALUES (1524, 2212, 't3');
+INSERT INTO notes VALUES (1525, 2825, 't4');
+INSERT INTO notes VALUES (1526, 3438, 't5');
+INSERT INTO notes VALUES (1527, 51, 't6');
+INSERT INTO notes VALUES (1528, 664, 't7');
+INSERT INTO notes VALUES (1529, 1277, 't8');
+INSERT INTO notes VALUES (1530, 1890, 't0');
+INSERT INTO notes VALUES (1531, 2503, 't1');
+INSERT INTO notes VALUES (1532, 3116, 't2');
+INSERT INTO notes VALUES (1533, 3729, 't3');
+INSERT INTO notes VALUES (1534, 342, 't4');
+INSERT INTO notes VALUES (1535, 955, 't5');
+INSERT INTO notes VALUES (1536, 1568, 't6');
+INSERT INTO notes VALUES (1537, 2181, 't7');
+INSERT INTO notes VALUES (1538, 2794, 't8');
+INSERT INTO notes VALUES (1539, 3407, 't0');
+INSERT INTO notes VALUES (1540, 20, 't1');
+INSERT INTO notes VALUES (1541, 633, 't2');
+INSERT INTO notes VALUES (1542, 1246, 't3');
+INSERT INTO notes VALUES (1543, 1859, 't4');
+INSERT INTO notes VALUES (1544, 2472, 't5');
+INSERT INTO notes VALUES (1545, 3085, 't6');
+INSERT INTO notes VALUES (1546, 3698, 't7');
+INSERT INTO notes VALUES (1547, 311, 't8');
+INSERT INTO notes VALUES (1548, 924, 't0');
+INSERT INTO notes VALUES (1549, 1537, 't1');
+INSERT INTO notes VALUES (1550, 2150, 't2');
+INSERT INTO notes VALUES (1551, 2763, 't3');
+INSERT INTO notes VALUES (1552, 3376, 't4');
+INSERT INTO notes VALUES (1553, 3989, 't5');
+INSERT INTO notes VALUES (1554, 602, 't6');
+INSERT INTO notes VALUES (1555, 1215, 't7');
+INSERT INTO notes VALUES (1556, 1828, 't8');
+INSERT INTO notes VALUES (1557, 2441, 't0');
+INSERT INTO notes VALUES (1558, 3054, 't1');
+INSERT INTO notes VALUES (1559, 3667, 't2');
+INSERT INTO notes VALUES (1560, 280, 't3');
+INSERT INTO notes VALUES (1561, 893, 't4');
+INSERT INTO notes VALUES (1562, 1506, 't5');
+INSERT INTO notes VALUES (1563, 2119, 't6');
+INSERT INTO notes VALUES (1564, 2732, 't7');
+INSERT INTO notes VALUES (1565, 3345, 't8');
+INSERT INTO notes VALUES (1566, 3958, 't0');
+INSERT INTO notes VALUES (1567, 571, 't1');
+INSERT INTO notes VALUES (1568, 1184, 't2');
+INSERT INTO notes VALUES (1569, 1797, 't3');
+INSERT INTO notes VALUES (1570, 2410, 't4');
+INSERT INTO notes VALUES (1571, 3023, 't5');
+INSERT INTO notes VALUES (1572, 3636, 't6');
+INSERT INTO notes VALUES (1573, 249, 't7');
+INSERT INTO notes VALUES (1574, 862, 't8');
+INSERT INTO notes VALUES (1575, 1475, 't0');
+INSERT INTO notes VALUES (1576, 2088, 't1');
+INSERT INTO notes VALUES (1577, 2701, 't2');
+INSERT INTO notes VALUES (1578, 3314, 't3');
+INSERT INTO notes VALUES (1579, 3927, 't4');
+INSERT INTO notes VALUES (1580, 540, 't5');
+INSERT INTO notes VALUES (1581, 1153, 't6');
+INSERT INTO notes VALUES (1582, 1766, 't7');
+INSERT INTO notes VALUES (1583, 2379, 't8');
+INSERT INTO notes VALUES (1584, 2992, 't0');
+INSERT INTO notes VALUES (1585, 3605, 't1');
+INSERT INTO notes VALUES (1586, 218, 't2');
+INSERT INTO notes VALUES (1587, 831, 't3');
+INSERT INTO notes VALUES (1588, 1444, 't4');
+INSERT INTO notes VALUES (1589, 2057, 't5');
+INSERT INTO notes VALUES (1590, 2670, 't6');
+INSERT INTO notes VALUES (1591, 3283, 't7');
+INSERT INTO notes VALUES (1592, 3896, 't8');
+INSERT INTO notes VALUES (1593, 509, 't0');
+INSERT INTO notes VALUES (1594, 1122, 't1');
+INSERT INTO notes VALUES (1595, 1735, 't2');
+INSERT INTO notes VALUES (1596, 2348, 't3');
+INSERT INTO notes VALUES (1597, 2961, 't4');
+INSERT INTO notes VALUES (1598, 3574, 't5');
+INSERT INTO notes VALUES (1599, 187, 't6');
+INSERT INTO notes VALUES (1600, 800, 't7');
+INSERT INTO notes VALUES (1601, 1413, 't8');
+INSERT INTO notes VALUES (1602, 2026, 't0');
+INSERT INTO notes VALUES (1603, 2639, 't1');
+INSERT INTO notes VALUES (1604, 3252, 't2');
+INSERT INTO notes VALUES (1605, 3865, 't3');
+INSERT INTO notes VALUES (1606, 478, 't4');
+INSERT INTO notes VALUES (1607, 1091, 't5');
+INSERT INTO notes VALUES (1608, 1704, 't6');
+INSERT INTO notes VALUES (1609, 2317, 't7');
+INSERT INTO notes VALUES (1610, 2930, 't8');
+INSERT INTO notes VALUES (1611, 3543, 't0');
+INSERT INTO notes VALUES (1612, 156, 't1');
+INSERT INTO notes VALUES (1613, 769, 't2');
+INSERT INTO notes VALUES (1614, 1382, 't3');
+INSERT INTO notes VALUES (1615, 1995, 't4');
+INSERT INTO notes VALUES (1616, 2608, 't5');
+INSERT INTO notes VALUES (1617, 3221, 't6');
+INSERT INTO notes VALUES (1618, 3834, 't7');
+INSERT INTO notes VALUES (1619, 447, 't8');
+INSERT INTO notes VALUES (1620, 1060, 't0');
+INSERT INTO notes VALUES (1621, 1673, 't1');
+INSERT INTO notes VALUES (1622, 2286, 't2');
+INSERT INTO notes VALUES (1623, 2899, 't3');
+INSERT INTO notes VALUES (1624, 3512, 't4');
+INSERT INTO notes VALUES (1625, 125, 't5');
+INSERT INTO notes VALUES (1626, 738, 't6');
+INSERT INTO notes VALUES (1627, 1351, 't7');
+INSERT INTO notes VALUES (1628, 1964, 't8');
+INSERT INTO notes VALUES (1629, 2577, 't0');
+INSERT INTO notes VALUES (1630, 3190, 't1');
+INSERT INTO notes VALUES (1631, 3803, 't2');
+INSERT INTO notes VALUES (1632, 416, 't3');
+INSERT INTO notes VALUES (1633, 1029, 't4');
+INSERT INTO notes VALUES (1634, 1642, 't5');
+INSERT INTO notes VALUES (1635, 2255, 't6');
+INSERT INTO notes VALUES (1636, 2868, 't7');
+INSERT INTO notes VALUES (1637, 3481, 't8');
+INSERT INTO notes VALUES (1638, 94, 't0');
+INSERT INTO notes VALUES (1639, 707, 't1');
+INSERT INTO notes VALUES (1640, 1320, 't2');
+INSERT INTO notes VALUES (1641, 1933, 't3');
+INSERT INTO notes VALUES (1642, 2546, 't4');
+INSERT INTO notes VALUES (1643, 3159, 't5');
+INSERT INTO notes VALUES (1644, 3772, 't6');
+INSERT INTO notes VALUES (1645, 385, 't7');
+INSERT INTO notes VALUES (1646, 998, 't8');
+INSERT INTO notes VALUES (1647, 1611, 't0');
+INSERT INTO notes VALUES (1648, 2224, 't1');
+INSERT INTO notes VALUES (1649, 2837, 't2');
+INSERT INTO notes VALUES (1650, 3450, 't3');
+INSERT INTO notes VALUES (1651, 63, 't4');
+INSERT INTO notes VALUES (1652, 676, 't5');
+INSERT INTO notes VALUES (1653, 1289, 't6');
+INSERT INTO notes VALUES (1654, 1902, 't7');
+INSERT INTO notes VALUES (1655, 2515, 't8');
+INSERT INTO notes VALUES (1656, 3128, 't0');
+INSERT INTO notes VALUES (1657, 3741, 't1');
+INSERT INTO notes VALUES (1658, 354, 't2');
+INSERT INTO notes VALUES (1659, 967, 't3');
+INSERT INTO notes VALUES (1660, 1580, 't4');
+INSERT INTO notes VALUES (1661, 2193, 't5');
+INSERT INTO notes VALUES (1662, 2806, 't6');
+INSERT INTO notes VALUES (1663, 3419, 't7');
+INSERT INTO notes VALUES (1664, 32, 't8');
+INSERT INTO notes VALUES (1665, 645, 't0');
+INSERT INTO notes VALUES (1666, 1258, 't1');
+INSERT INTO notes VALUES (1667, 1871, 't2');
+INSERT INTO notes VALUES (1668, 2484, 't3');
+INSERT INTO notes VALUES (1669, 3097, 't4');
+INSERT INTO notes VALUES (1670, 3710, 't5');
+INSERT INTO notes VALUES (1671, 323, 't6');
+INSERT INTO notes VALUES (1672, 936, 't7');
+INSERT INTO notes VALUES (1673, 1549, 't8');
+INSERT INTO notes VALUES (1674, 2162, 't0');
+INSERT INTO notes VALUES (1675, 2775, 't1');
+INSERT INTO notes VALUES (1676, 3388, 't2');
+INSERT INTO notes VALUES (1677, 1, 't3');
+INSERT INTO notes VALUES (1678, 614, 't4');
+INSERT INTO notes VALUES (1679, 1227, 't5');
+INSERT INTO notes VALUES (1680, 1840, 't6');
+INSERT INTO notes VALUES (1681, 2453, 't7');
+INSERT INTO notes VALUES (1682, 3066, 't8');
+INSERT INTO notes VALUES (1683, 3679, 't0');
+INSERT INTO notes VALUES (1684, 292, 't1');
+INSERT INTO notes VALUES (1685, 905, 't2');
+INSERT INTO notes VALUES (1686, 1518, 't3');
+INSERT INTO notes VALUES (1687, 2131, 't4');
+INSERT INTO notes VALUES (1688, 2744, 't5');
+INSERT INTO notes VALUES (1689, 3357, 't6');
+INSERT INTO notes VALUES (1690, 3970, 't7');
+INSERT INTO notes VALUES (1691, 583, 't8');
+INSERT INTO notes VALUES (1692, 1196, 't0');
+INSERT INTO notes VALUES (1693, 1809, 't1');
+INSERT INTO notes VALUES (1694, 2422, 't2');
+INSERT INTO notes VALUES (1695, 3035, 't3');
+INSERT INTO notes VALUES (1696, 3648, 't4');
+INSERT INTO notes VALUES (1697, 261, 't5');
+INSERT INTO notes VALUES (1698, 874, 't6');
+INSERT INTO notes VALUES (1699, 1487, 't7');
+INSERT INTO notes VALUES (1700, 2100, 't8');
+INSERT INTO notes VALUES (1701, 2713, 't0');
+INSERT INTO notes VALUES (1702, 3326, 't1');
+INSERT INTO notes VALUES (1703, 3939, 't2');
+INSERT INTO notes VALUES (1704, 552, 't3');
+INSERT INTO notes VALUES (1705, 1165, 't4');
+INSERT INTO notes VALUES (1706, 1778, 't5');
+INSERT INTO notes VALUES (1707, 2391, 't6');
+INSERT INTO notes VALUES (1708, 3004, 't7');
+INSERT INTO notes VALUES (1709, 3617, 't8');
+INSERT INTO notes VALUES (1710, 230, 't0');
+INSERT INTO notes VALUES (1711, 843, 't1');
+INSERT INTO notes VALUES (1712, 1456, 't2');
+INSERT INTO notes VALUES (1713, 2069, 't3');
+INSERT INTO notes VALUES (1714, 2682, 't4');
+INSERT INTO notes VALUES (1715, 3295, 't5');
+INSERT INTO notes VALUES (1716, 3908, 't6');
+INSERT INTO notes VALUES (1717, 521, 't7');
+INSERT INTO notes VALUES (1718, 1134, 't8');
+INSERT INTO notes VALUES (1719, 1747, 't0');
+INSERT INTO notes VALUES (1720, 2360, 't1');
+INSERT INTO notes VALUES (1721, 2973, 't2');
+INSERT INTO notes VALUES (1722, 3586, 't3');
+INSERT INTO notes VALUES (1723, 199, 't4');
+INSERT INTO notes VALUES (1724, 812, 't5');
+INSERT INTO notes VALUES (1725, 1425, 't6');
+INSERT INTO notes VALUES (1726, 2038, 't7');
+INSERT INTO notes VALUES (1727, 2651, 't8');
+INSERT INTO notes VALUES (1728, 3264, 't0');
+INSERT INTO notes VALUES (1729, 3877, 't1');
+INSERT INTO notes VALUES (1730, 490, 't2');
+INSERT INTO notes VALUES (1731, 1103, 't3');
+INSERT INTO notes VALUES (1732, 1716, 't4');
+INSERT INTO notes VALUES (1733, 2329, 't5');
+INSERT INTO notes VALUES (1734, 2942, 't6');
+INSERT INTO notes VALUES (1735, 3555, 't7');
+INSERT INTO notes VALUES (1736, 168, 't8');
+INSERT INTO notes VALUES (1737, 781, 't0');
+INSERT INTO notes VALUES (1738, 1394, 't1');
+INSERT INTO notes VALUES (1739, 2007, 't2');
+INSERT INTO notes VALUES (1740, 2620, 't3');
+INSERT INTO notes VALUES (1741, 3233, 't4');
+INSERT INTO notes VALUES (1742, 3846, 't5');
+INSERT INTO notes VALUES (1743, 459, 't6');
+INSERT INTO notes VALUES (1744, 1072, 't7');
+INSERT INTO notes VALUES (1745, 1685, 't8');
+INSERT INTO notes VALUES (1746, 2298, 't0');
+INSERT INTO notes VALUES (1747, 2911, 't1');
+INSERT INTO notes VALUES (1748, 3524, 't2');
+INSERT INTO notes VALUES (1749, 137, 't3');
+INSERT INTO notes VALUES (1750, 750, 't4');
+INSERT INTO notes VALUES (1751, 1363, 't5');
+INSERT INTO notes VALUES (1752, 1976, 't6');
+INSERT INTO notes VALUES (1753, 2589, 't7');
+INSERT INTO notes VALUES (1754, 3202, 't8');
+INSERT INTO notes VALUES (1755, 3815, 't0');
+INSERT INTO notes VALUES (1756, 428, 't1');
+INSERT INTO notes VALUES (1757, 1041, 't2');
+INSERT INTO notes VALUES (1758, 1654, 't3');
+INSERT INTO notes VALUES (1759, 2267, 't4');
+INSERT INTO notes VALUES (1760, 2880, 't5');
+INSERT INTO notes VALUES (1761, 3493, 't6');
+INSERT INTO notes VALUES (1762, 106, 't7');
+INSERT INTO notes VALUES (1763, 719, 't8');
+INSERT INTO notes VALUES (1764, 1332, 't0');
+INSERT INTO notes VALUES (1765, 1945, 't1');
+INSERT INTO notes VALUES (1766, 2558, 't2');
+INSERT INTO notes VALUES (1767, 3171, 't3');
+INSERT INTO notes VALUES (1768, 3784, 't4');
+INSERT INTO notes VALUES (1769, 397, 't5');
+INSERT INTO notes VALUES (1770, 1010, 't6');
+INSERT INTO notes VALUES (1771, 1623, 't7');
+INSERT INTO notes VALUES (1772, 2236, 't8');
+INSERT INTO notes VALUES (1773, 2849, 't0');
+INSERT INTO notes VALUES (1774, 3462, 't1');
+INSERT INTO notes VALUES (1775, 75, 't2');
+INSERT INTO notes VALUES (1776, 688, 't3');
+INSERT INTO notes VALUES (1777, 1301, 't4');
+INSERT INTO notes VALUES (1778, 1914, 't5');
+INSERT INTO notes VALUES (1779, 2527, 't6');
+INSERT INTO notes VALUES (1780, 3140, 't7');
+INSERT INTO notes VALUES (1781, 3753, 't8');
+INSERT INTO notes VALUES (1782, 366, 't0');
+INSERT INTO notes VALUES (1783, 979, 't1');
+INSERT INTO notes VALUES (1784, 1592, 't2');
+INSERT INTO notes VALUES (1785, 2205, 't3');
+INSERT INTO notes VALUES (1786, 2818, 't4');
+INSERT INTO notes VALUES (1787, 3431, 't5');
+INSERT INTO notes VALUES (1788, 44, 't6');
+INSERT INTO notes VALUES (1789, 657, 't7');
+INSERT INTO notes VALUES (1790, 1270, 't8');
+INSERT INTO notes VALUES (1791, 1883, 't0');
+INSERT INTO notes VALUES (1792, 2496, 't1');
+INSERT INTO notes VALUES (1793, 3109, 't2');
+INSERT INTO notes VALUES (1794, 3722, 't3');
+INSERT INTO notes VALUES (1795, 335, 't4');
+INSERT INTO notes VALUES (1796, 948, 't5');
+INSERT INTO notes VALUES (1797, 1561, 't6');
+INSERT INTO notes VALUES (1798, 2174, 't7');
+INSERT INTO notes VALUES (1799, 2787, 't8');
+INSERT INTO notes VALUES (1800, 3400, 't0');
+INSERT INTO notes VALUES (1801, 13, 't1');
+INSERT INTO notes VALUES (1802, 626, 't2');
+INSERT INTO notes VALUES (1803, 1239, 't3');
+INSERT INTO notes VALUES (1804, 1852, 't4');
+INSERT INTO notes VALUES (1805, 2465, 't5');
+INSERT INTO notes VALUES (1806, 3078, 't6');
+INSERT INTO notes VALUES (1807, 3691, 't7');
+INSERT INTO notes VALUES (1808, 304, 't8');
+INSERT INTO notes VALUES (1809, 917, 't0');
+INSERT INTO notes VALUES (1810, 1530, 't1');
+INSERT INTO notes VALUES (1811, 2143, 't2');
+INSERT INTO notes VALUES (1812, 2756, 't3');
+INSERT INTO notes VALUES (1813, 3369, 't4');
+INSERT INTO notes VALUES (1814, 3982, 't5');
+INSERT INTO notes VALUES (1815, 595, 't6');
+INSERT INTO notes VALUES (1816, 1208, 't7');
+INSERT INTO notes VALUES (1817, 1821, 't8');
+INSERT INTO notes VALUES (1818, 2434, 't0');
+INSERT INTO notes VALUES (1819, 3047, 't1');
+INSERT INTO notes VALUES (1820, 3660, 't2');
+INSERT INTO notes VALUES (1821, 273, 't3');
+INSERT INTO notes VALUES (1822, 886, 't4');
+INSERT INTO notes VALUES (1823, 1499, 't5');
+INSERT INTO notes VALUES (1824, 2112, 't6');
+INSERT INTO notes VALUES (1825, 2725, 't7');
+INSERT INTO notes VALUES (1826, 3338, 't8');
+INSERT INTO notes VALUES (1827, 3951, 't0');
+INSERT INTO notes VALUES (1828, 564, 't1');
+INSERT INTO notes VALUES (1829, 1177, 't2');
+INSERT INTO notes VALUES (1830, 1790, 't3');
+INSERT INTO notes VALUES (1831, 2403, 't4');
+INSERT INTO notes VALUES (1832, 3016, 't5');
+INSERT INTO notes VALUES (1833, 3629, 't6');
+INSERT INTO notes VALUES (1834, 242, 't7');
+INSERT INTO notes VALUES (1835, 855, 't8');
+INSERT INTO notes VALUES (1836, 1468, 't0');
+INSERT INTO notes VALUES (1837, 2081, 't1');
+INSERT INTO notes VALUES (1838, 2694, 't2');
+INSERT INTO notes VALUES (1839, 3307, 't3');
+INSERT INTO notes VALUES (1840, 3920, 't4');
+INSERT INTO notes VALUES (1841, 533, 't5');
+INSERT INTO notes VALUES (1842, 1146, 't6');
+INSERT INTO notes VALUES (1843, 1759, 't7');
+INSERT INTO notes VALUES (1844, 2372, 't8');
+INSERT INTO notes VALUES (1845, 2985, 't0');
+INSERT INTO notes VALUES (1846, 3598, 't1');
+INSERT INTO notes VALUES (1847, 211, 't2');
+INSERT INTO notes VALUES (1848, 824, 't3');
+INSERT INTO notes VALUES (1849, 1437, 't4');
+INSERT INTO notes VALUES (1850, 2050, 't5');
+INSERT INTO notes VALUES (1851, 2663, 't6');
+INSERT INTO notes VALUES (1852, 3276, 't7');
+INSERT INTO notes VALUES (1853, 3889, 't8');
+INSERT INTO notes VALUES (1854, 502, 't0');
+INSERT INTO notes VALUES (1855, 1115, 't1');
+INSERT INTO notes VALUES (1856, 1728, 't2');
+INSERT INTO notes VALUES (1857, 2341, 't3');
+INSERT INTO notes VALUES (1858, 2954, 't4');
+INSERT INTO notes VALUES (1859, 3567, 't5');
+INSERT INTO notes VALUES (1860, 180, 't6');
+INSERT INTO notes VALUES (1861, 793, 't7');
+INSERT INTO notes VALUES (1862, 1406, 't8');
+INSERT INTO notes VALUES (1863, 2019, 't0');
+INSERT INTO notes VALUES (1864, 2632, 't1');
+INSERT INTO notes VALUES (1865, 3245, 't2');
+INSERT INTO notes VALUES (1866, 3858, 't3');
+INSERT INTO notes VALUES (1867, 471, 't4');
+INSERT INTO notes VALUES (1868, 1084, 't5');
+INSERT INTO notes VALUES (1869, 1697, 't6');
+INSERT INTO notes VALUES (1870, 2310, 't7');
+INSERT INTO notes VALUES (1871, 2923, 't8');
+INSERT INTO notes VALUES (1872, 3536, 't0');
+INSERT INTO notes VALUES (1873, 149, 't1');
+INSERT INTO notes VALUES (1874, 762, 't2');
+INSERT INTO notes VALUES (1875, 1375, 't3');
+INSERT INTO notes VALUES (1876, 1988, 't4');
+INSERT INTO notes VALUES (1877, 2601, 't5');
+INSERT INTO notes VALUES (1878, 3214, 't6');
+INSERT INTO notes VALUES (1879, 3827, 't7');
+INSERT INTO notes VALUES (1880, 440, 't8');
+INSERT INTO notes VALUES (1881, 1053, 't0');
+INSERT INTO notes VALUES (1882, 1666, 't1');
+INSERT INTO notes VALUES (1883, 2279, 't2');
+INSERT INTO notes VALUES (1884, 2892, 't3');
+INSERT INTO notes VALUES (1885, 3505, 't4');
+INSERT INTO notes VALUES (1886, 118, 't5');
+INSERT INTO notes VALUES (1887, 731, 't6');
+INSERT INTO notes VALUES (1888, 1344, 't7');
+INSERT INTO notes VALUES (1889, 1957, 't8');
+INSERT INTO notes VALUES (1890, 2570, 't0');
+INSERT INTO notes VALUES (1891, 3183, 't1');
+INSERT INTO notes VALUES (1892, 3796, 't2');
+INSERT INTO notes VALUES (1893, 409, 't3');
+INSERT INTO notes VALUES (1894, 1022, 't4');
+INSERT INTO notes VALUES (1895, 1635, 't5');
+INSERT INTO notes VALUES (1896, 2248, 't6');
+INSERT INTO notes VALUES (1897, 2861, 't7');
+INSERT INTO notes VALUES (1898, 3474, 't8');
+INSERT INTO notes VALUES (1899, 87, 't0');
+INSERT INTO notes VALUES (1900, 700, 't1');
+INSERT INTO notes VALUES (1901, 1313, 't2');
+INSERT INTO notes VALUES (1902, 1926, 't3');
+INSERT INTO notes VALUES (1903, 2539, 't4');
+INSERT INTO notes VALUES (1904, 3152, 't5');
+INSERT INTO notes VALUES (1905, 3765, 't6');
+INSERT INTO notes VALUES (1906, 378, 't7');
+INSERT INTO notes VALUES (1907, 991, 't8');
+INSERT INTO notes VALUES (1908, 1604, 't0');
+INSERT INTO notes VALUES (1909, 2217, 't1');
+INSERT INTO notes VALUES (1910, 2830, 't2');
+INSERT INTO notes VALUES (1911, 3443, 't3');
+INSERT INTO notes VALUES (1912, 56, 't4');
+INSERT INTO notes VALUES (1913, 669, 't5');
+INSERT INTO notes VALUES (1914, 1282, 't6');
+INSERT INTO notes VALUES (1915, 1895, 't7');
+INSERT INTO notes VALUES (1916, 2508, 't8');
+INSERT INTO notes VALUES (1917, 3121, 't0');
+INSERT INTO notes VALUES (1918, 3734, 't1');
+INSERT INTO notes VALUES (1919, 347, 't2');
+INSERT INTO notes VALUES (1920, 960, 't3');
+INSERT INTO notes VALUES (1921, 1573, 't4');
+INSERT INTO notes VALUES (1922, 2186, 't5');
+INSERT INTO notes VALUES (1923, 2799, 't6');
+INSERT INTO notes VALUES (1924, 3412, 't7');
+INSERT INTO notes VALUES (1925, 25, 't8');
+INSERT INTO notes VALUES (1926, 638, 't0');
+INSERT INTO notes VALUES (1927, 1251, 't1');
+INSERT INTO notes VALUES (1928, 1864, 't2');
+INSERT INTO notes VALUES (1929, 2477, 't3');
+INSERT INTO notes VALUES (1930, 3090, 't4');
+INSERT INTO notes VALUES (1931, 3703, 't5');
+INSERT INTO notes VALUES (1932, 316, 't6');
+INSERT INTO notes VALUES (1933, 929, 't7');
+INSERT INTO notes VALUES (1934, 1542, 't8');
+INSERT INTO notes VALUES (1935, 2155, 't0');
+INSERT INTO notes VALUES (1936, 2768, 't1');
+INSERT INTO notes VALUES (1937, 3381, 't2');
+INSERT INTO notes VALUES (1938, 3994, 't3');
+INSERT INTO notes VALUES (1939, 607, 't4');
+INSERT INTO notes VALUES (1940, 1220, 't5');
+INSERT INTO notes VALUES (1941, 1833, 't6');
+INSERT INTO notes VALUES (1942, 2446, 't7');
+INSERT INTO notes VALUES (1943, 3059, 't8');
+INSERT INTO notes VALUES (1944, 3672, 't0');
+INSERT INTO notes VALUES (1945, 285, 't1');
+INSERT INTO notes VALUES (1946, 898, 't2');
+INSERT INTO notes VALUES (1947, 1511, 't3');
+INSERT INTO notes VALUES (1948, 2124, 't4');
+INSERT INTO notes VALUES (1949, 2737, 't5');
+INSERT INTO notes VALUES (1950, 3350, 't6');
+INSERT INTO notes VALUES (1951, 3963, 't7');
+INSERT INTO notes VALUES (1952, 576, 't8');
+INSERT INTO notes VALUES (1953, 1189, 't0');
+INSERT INTO notes VALUES (1954, 1802, 't1');
+INSERT INTO notes VALUES (1955, 2415, 't2');
+INSERT INTO notes VALUES (1956, 3028, 't3');
+INSERT INTO notes VALUES (1957, 3641, 't4');
+INSERT INTO notes VALUES (1958, 254, 't5');
+INSERT INTO notes VALUES (1959, 867, 't6');
+INSERT INTO notes VALUES (1960, 1480, 't7');
+INSERT INTO notes VALUES (1961, 2093, 't8');
+INSERT INTO notes VALUES (1962, 2706, 't0');
+INSERT INTO notes VALUES (1963, 3319, 't1');
+INSERT INTO notes VALUES (1964, 3932, 't2');
+INSERT INTO notes VALUES (1965, 545, 't3');
+INSERT INTO notes VALUES (1966, 1158, 't4');
+INSERT INTO notes VALUES (1967, 1771, 't5');
+INSERT INTO notes VALUES (1968, 2384, 't6');
+INSERT INTO notes VALUES (1969, 2997, 't7');
+INSERT INTO notes VALUES (1970, 3610, 't8');
+INSERT INTO notes VALUES (1971, 223, 't0');
+INSERT INTO notes VALUES (1972, 836, 't1');
+INSERT INTO notes VALUES (1973, 1449, 't2');
+INSERT INTO notes VALUES (1974, 2062, 't3');
+INSERT INTO notes VALUES (1975, 2675, 't4');
+INSERT INTO notes VALUES (1976, 3288, 't5');
+INSERT INTO notes VALUES (1977, 3901, 't6');
+INSERT INTO notes VALUES (1978, 514, 't7');
+INSERT INTO notes VALUES (1979, 1127, 't8');
+INSERT INTO notes VALUES (1980, 1740, 't0');
+INSERT INTO notes VALUES (1981, 2353, 't1');
+INSERT INTO notes VALUES (1982, 2966, 't2');
+INSERT INTO notes VALUES (1983, 3579, 't3');
+INSERT INTO notes VALUES (1984, 192, 't4');
+INSERT INTO notes VALUES (1985, 805, 't5');
+INSERT INTO notes VALUES (1986, 1418, 't6');
+INSERT INTO notes VALUES (1987, 2031, 't7');
+INSERT INTO notes VALUES (1988, 2644, 't8');
+INSERT INTO notes VALUES (1989, 3257, 't0');
+INSERT INTO notes VALUES (1990, 3870, 't1');
+INSERT INTO notes VALUES (1991, 483, 't2');
+INSERT INTO notes VALUES (1992, 1096, 't3');
+INSERT INTO notes VALUES (1993, 1709, 't4');
+INSERT INTO notes VALUES (1994, 2322, 't5');
+INSERT INTO notes VALUES (1995, 2935, 't6');
+INSERT INTO notes VALUES (1996, 3548, 't7');
+INSERT INTO notes VALUES (1997, 161, 't8');
+INSERT INTO notes VALUES (1998, 774, 't0');
+INSERT INTO notes VALUES (1999, 1387, 't1');
+INSERT INTO notes VALUES (2000, 2000, 't2');
+INSERT INTO notes VALUES (2001, 2613, 't3');
+INSERT INTO notes VALUES (2002, 3226, 't4');
+INSERT INTO notes VALUES (2003, 3839, 't5');
+INSERT INTO notes VALUES (2004, 452, 't6');
+INSERT INTO notes VALUES (2005, 1065, 't7');
+INSERT INTO notes VALUES (2006, 1678, 't8');
+INSERT INTO notes VALUES (2007, 2291, 't0');
+INSERT INTO notes VALUES (2008, 2904, 't1');
+INSERT INTO notes VALUES (2009, 3517, 't2');
+INSERT INTO notes VALUES (2010, 130, 't3');
+INSERT INTO notes VALUES (2011, 743, 't4');
+INSERT INTO notes VALUES (2012, 1356, 't5');
+INSERT INTO notes VALUES (2013, 1969, 't6');
+INSERT INTO notes VALUES (2014, 2582, 't7');
+INSERT INTO notes VALUES (2015, 3195, 't8');
+INSERT INTO notes VALUES (2016, 3808, 't0');
+INSERT INTO notes VALUES (2017, 421, 't1');
+INSERT INTO notes VALUES (2018, 1034, 't2');
+INSERT INTO notes VALUES (2019, 1647, 't3');
+INSERT INTO notes VALUES (2020, 2260, 't4');
+INSERT INTO notes VALUES (2021, 2873, 't5');
+INSERT INTO notes VALUES (2022, 3486, 't6');
+INSERT INTO notes VALUES (2023, 99, 't7');
+INSERT INTO notes VALUES (2024, 712, 't8');
+INSERT INTO notes VALUES (2025, 1325, 't0');
+INSERT INTO notes VALUES (2026, 1938, 't1');
+INSERT INTO notes VALUES (2027, 2551, 't2');
+INSERT INTO notes VALUES (2028, 3164, 't3');
+INSERT INTO notes VALUES (2029, 3777, 't4');
+INSERT INTO notes VALUES (2030, 390, 't5');
+INSERT INTO notes VALUES (2031, 1003, 't6');
+INSERT INTO notes VALUES (2032, 1616, 't7');
+INSERT INTO notes VALUES (2033, 2229, 't8');
+INSERT INTO notes VALUES (2034, 2842, 't0');
+INSERT INTO notes VALUES (2035, 3455, 't1');
+INSERT INTO notes VALUES (2036, 68, 't2');
+INSERT INTO notes VALUES (2037, 681, 't3');
+INSERT INTO notes VALUES (2038, 1294, 't4');
+INSERT INTO notes VALUES (2039, 1907, 't5');
+INSERT INTO notes VALUES (2040, 2520, 't6');
+INSERT INTO notes VALUES (2041, 3133, 't7');
+INSERT INTO notes VALUES (2042, 3746, 't8');
+INSERT INTO notes VALUES (2043, 359, 't0');
+INSERT INTO notes VALUES (2044, 972, 't1');
+INSERT INTO notes VALUES (2045, 1585, 't2');
+INSERT INTO notes VALUES (2046, 2198, 't3');
+INSERT INTO notes VALUES (2047, 2811, 't4');
+INSERT INTO notes VALUES (2048, 3424, 't5');
+INSERT INTO notes VALUES (2049, 37, 't6');
+INSERT INTO notes VALUES (2050, 650, 't7');
+INSERT INTO notes VALUES (2051, 1263, 't8');
+INSERT INTO notes VALUES (2052, 1876, 't0');
+INSERT INTO notes VALUES (2053, 2489, 't1');
+INSERT INTO notes VALUES (2054, 3102, 't2');
+INSERT INTO notes VALUES (2055, 3715, 't3');
+INSERT INTO notes VALUES (2056, 328, 't4');
+INSERT INTO notes VALUES (2057, 941, 't5');
+INSERT INTO notes VALUES (2058, 1554, 't6');
+INSERT INTO notes VALUES (2059, 2167, 't7');
+INSERT INTO notes VALUES (2060, 2780, 't8');
+INSERT INTO notes VALUES (2061, 3393, 't0');
+INSERT INTO notes VALUES (2062, 6, 't1');
+INSERT INTO notes VALUES (2063, 619, 't2');
+INSERT INTO notes VALUES (2064, 1232, 't3');
+INSERT INTO notes VALUES (2065, 1845, 't4');
+INSERT INTO notes VALUES (2066, 2458, 't5');
+INSERT INTO notes VALUES (2067, 3071, 't6');
+INSERT INTO notes VALUES (2068, 3684, 't7');
+INSERT INTO notes VALUES (2069, 297, 't8');
+INSERT INTO notes VALUES (2070, 910, 't0');
+INSERT INTO notes VALUES (2071, 1523, 't1');
+INSERT INTO notes VALUES (2072, 2136, 't2');
+INSERT INTO notes VALUES (2073, 2749, 't3');
+INSERT INTO notes VALUES (2074, 3362, 't4');
+INSERT INTO notes VALUES (2075, 3975, 't5');
+INSERT INTO notes VALUES (2076, 588, 't6');
+INSERT INTO notes VALUES (2077, 1201, 't7');
+INSERT INTO notes VALUES (2078, 1814, 't8');
+INSERT INTO notes VALUES (2079, 2427, 't0');
+INSERT INTO notes VALUES (2080, 3040, 't1');
+INSERT INTO notes VALUES (2081, 3653, 't2');
+INSERT INTO notes VALUES (2082, 266, 't3');
+INSERT INTO notes VALUES (2083, 879, 't4');
+INSERT INTO notes VALUES (2084, 1492, 't5');
+INSERT INTO notes VALUES (2085, 2105, 't6');
+INSERT INTO notes VALUES (2086, 2718, 't7');
+INSERT INTO notes VALUES (2087, 3331, 't8');
+INSERT INTO notes VALUES (2088, 3944, 't0');
+INSERT INTO notes VALUES (2089, 557, 't1');
+INSERT INTO notes VALUES (2090, 1170, 't2');
+INSERT INTO notes VALUES (2091, 1783, 't3');
+INSERT INTO notes VALUES (2092, 2396, 't4');
+INSERT INTO notes VALUES (2093, 3009, 't5');
+INSERT INTO notes VALUES (2094, 3622, 't6');
+INSERT INTO notes VALUES (2095, 235, 't7');
+INSERT INTO notes VALUES (2096, 848, 't8');
+INSERT INTO notes VALUES (2097, 1461, 't0');
+INSERT INTO notes VALUES (2098, 2074, 't1');
+INSERT INTO notes VALUES (2099, 2687, 't2');
+INSERT INTO notes VALUES (2100, 3300, 't3');
+INSERT INTO notes VALUES (2101, 3913, 't4');
+INSERT INTO notes VALUES (2102, 526, 't5');
+INSERT INTO notes VALUES (2103, 1139, 't6');
+INSERT INTO notes VALUES (2104, 1752, 't7');
+INSERT INTO notes VALUES (2105, 2365, 't8');
+INSERT INTO notes VALUES (2106, 2978, 't0');
+INSERT INTO notes VALUES (2107, 3591, 't1');
+INSERT INTO notes VALUES (2108, 204, 't2');
+INSERT INTO notes VALUES (2109, 817, 't3');
+INSERT INTO notes VALUES (2110, 1430, 't4');
+INSERT INTO notes VALUES (2111, 2043, 't5');
+INSERT INTO notes VALUES (2112, 2656, 't6');
+INSERT INTO notes VALUES (2113, 3269, 't7');
+INSERT INTO notes VALUES (2114, 3882, 't8');
+INSERT INTO notes VALUES (2115, 495, 't0');
+INSERT INTO notes VALUES (2116, 1108, 't1');
+INSERT INTO notes VALUES (2117, 1721, 't2');
+INSERT INTO notes VALUES (2118, 2334, 't3');
+INSERT INTO notes VALUES (2119, 2947, 't4');
+INSERT INTO notes VALUES (2120, 3560, 't5');
+INSERT INTO notes VALUES (2121, 173, 't6');
+INSERT INTO notes VALUES (2122, 786, 't7');
+INSERT INTO notes VALUES (2123, 1399, 't8');
+INSERT INTO notes VALUES (2124, 2012, 't0');
+INSERT INTO notes VALUES (2125, 2625, 't1');
+INSERT INTO notes VALUES (2126, 3238, 't2');
+INSERT INTO notes VALUES (2127, 3851, 't3');
+INSERT INTO notes VALUES (2128, 464, 't4');
+INSERT INTO notes VALUES (2129, 1077, 't5');
+INSERT INTO notes VALUES (2130, 1690, 't6');
+INSERT INTO notes VALUES (2131, 2303, 't7');
+INSERT INTO notes VALUES (2132, 2916, 't8');
+INSERT INTO notes VALUES (2133, 3529, 't0');
+INSERT INTO notes VALUES (2134, 142, 't1');
+INSERT INTO notes VALUES (2135, 755, 't2');
+INSERT INTO notes VALUES (2136, 1368, 't3');
+INSERT INTO notes VALUES (2137, 1981, 't4');
+INSERT INTO notes VALUES (2138, 2594, 't5');
+INSERT INTO notes VALUES (2139, 3207, 't6');
+INSERT INTO notes VALUES (2140, 3820, 't7');
+INSERT INTO notes VALUES (2141, 433, 't8');
+INSERT INTO notes VALUES (2142, 1046, 't0');
+INSERT INTO notes VALUES (2143, 1659, 't1');
+INSERT INTO notes VALUES (2144, 2272, 't2');
+INSERT INTO notes VALUES (2145, 2885, 't3');
+INSERT INTO notes VALUES (2146, 3498, 't4');
+INSERT INTO notes VALUES (2147, 111, 't5');
+INSERT INTO notes VALUES (2148, 724, 't6');
+INSERT INTO notes VALUES (2149, 1337, 't7');
+INSERT INTO notes VALUES (2150, 1950, 't8');
+INSERT INTO notes VALUES (2151, 2563, 't0');
+INSERT INTO notes VALUES (2152, 3176, 't1');
+INSERT INTO notes VALUES (2153, 3789, 't2');
+INSERT INTO notes VALUES (2154, 402, 't3');
+INSERT INTO notes VALUES (2155, 1015, 't4');
+INSERT INTO notes VALUES (2156, 1628, 't5');
+INSERT INTO notes VALUES (2157, 2241, 't6');
+INSERT INTO notes VALUES (2158, 2854, 't7');
+INSERT INTO notes VALUES (2159, 3467, 't8');
+INSERT INTO notes VALUES (2160, 80, 't0');
+INSERT INTO notes VALUES (2161, 693, 't1');
+INSERT INTO notes VALUES (2162, 1306, 't2');
+INSERT INTO notes VALUES (2163, 1919, 't3');
+INSERT INTO notes VALUES (2164, 2532, 't4');
+INSERT INTO notes VALUES (2165, 3145, 't5');
+INSERT INTO notes VALUES (2166, 3758, 't6');
+INSERT INTO notes VALUES (2167, 371, 't7');
+INSERT INTO notes VALUES (2168, 984, 't8');
+INSERT INTO notes VALUES (2169, 1597, 't0');
+INSERT INTO notes VALUES (2170, 2210, 't1');
+INSERT INTO notes VALUES (2171, 2823, 't2');
+INSERT INTO notes VALUES (2172, 3436, 't3');
+INSERT INTO notes VALUES (2173, 49, 't4');
+INSERT INTO notes VALUES (2174, 662, 't5');
+INSERT INTO notes VALUES (2175, 1275, 't6');
+INSERT INTO notes VALUES (2176, 1888, 't7');
+INSERT INTO notes VALUES (2177, 2501, 't8');
+INSERT INTO notes VALUES (2178, 3114, 't0');
+INSERT INTO notes VALUES (2179, 3727, 't1');
+INSERT INTO notes VALUES (2180, 340, 't2');
+INSERT INTO notes VALUES (2181, 953, 't3');
+INSERT INTO notes VALUES (2182, 1566, 't4');
+INSERT INTO notes VALUES (2183, 2179, 't5');
+INSERT INTO notes VALUES (2184, 2792, 't6');
+INSERT INTO notes VALUES (2185, 3405, 't7');
+INSERT INTO notes VALUES (2186, 18, 't8');
+INSERT INTO notes VALUES (2187, 631, 't0');
+INSERT INTO notes VALUES (2188, 1244, 't1');
+INSERT INTO notes VALUES (2189, 1857, 't2');
+INSERT INTO notes VALUES (2190, 2470, 't3');
+INSERT INTO notes VALUES (2191, 3083, 't4');
+INSERT INTO notes VALUES (2192, 3696, 't5');
+INSERT INTO notes VALUES (2193, 309, 't6');
+INSERT INTO notes VALUES (2194, 922, 't7');
+INSERT INTO notes VALUES (2195, 1535, 't8');
+INSERT INTO notes VALUES (2196, 2148, 't0');
+INSERT INTO notes VALUES (2197, 2761, 't1');
+INSERT INTO notes VALUES (2198, 3374, 't2');
+INSERT INTO notes VALUES (2199, 3987, 't3');
+INSERT INTO notes VALUES (2200, 600, 't4');
+INSERT INTO notes VALUES (2201, 1213, 't5');
+INSERT INTO notes VALUES (2202, 1826, 't6');
+INSERT INTO notes VALUES (2203, 2439, 't7');
+INSERT INTO notes VALUES (2204, 3052, 't8');
+INSERT INTO notes VALUES (2205, 3665, 't0');
+INSERT INTO notes VALUES (2206, 278, 't1');
+INSERT INTO notes VALUES (2207, 891, 't2');
+INSERT INTO notes VALUES (2208, 1504, 't3');
+INSERT INTO notes VALUES (2209, 2117, 't4');
+INSERT INTO notes VALUES (2210, 2730, 't5');
+INSERT INTO notes VALUES (2211, 3343, 't6');
+INSERT INTO notes VALUES (2212, 3956, 't7');
+INSERT INTO notes VALUES (2213, 569, 't8');
+INSERT INTO notes VALUES (2214, 1182, 't0');
+INSERT INTO notes VALUES (2215, 1795, 't1');
+INSERT INTO notes VALUES (2216, 2408, 't2');
+INSERT INTO notes VALUES (2217, 3021, 't3');
+INSERT INTO notes VALUES (2218, 3634, 't4');
+INSERT INTO notes VALUES (2219, 247, 't5');
+INSERT INTO notes VALUES (2220, 860, 't6');
+INSERT INTO notes VALUES (2221, 1473, 't7');
+INSERT INTO notes VALUES (2222, 2086, 't8');
+INSERT INTO notes VALUES (2223, 2699, 't0');
+INSERT INTO notes VALUES (2224, 3312, 't1');
+INSERT INTO notes VALUES (2225, 3925, 't2');
+INSERT INTO notes VALUES (2226, 538, 't3');
+INSERT INTO notes VALUES (2227, 1151, 't4');
+INSERT INTO notes VALUES (2228, 1764, 't5');
+INSERT INTO notes VALUES (2229, 2377, 't6');
+INSERT INTO notes VALUES (2230, 2990, 't7');
+INSERT INTO notes VALUES (2231, 3603, 't8');
+INSERT INTO notes VALUES (2232, 216, 't0');
+INSERT INTO notes VALUES (2233, 829, 't1');
+INSERT INTO notes VALUES (2234, 1442, 't2');
+INSERT INTO notes VALUES (2235, 2055, 't3');
+INSERT INTO notes VALUES (2236, 2668, 't4');
+INSERT INTO notes VALUES (2237, 3281, 't5');
+INSERT INTO notes VALUES (2238, 3894, 't6');
+INSERT INTO notes VALUES (2239, 507, 't7');
+INSERT INTO notes VALUES (2240, 1120, 't8');
+INSERT INTO notes VALUES (2241, 1733, 't0');
+INSERT INTO notes VALUES (2242, 2346, 't1');
+INSERT INTO notes VALUES (2243, 2959, 't2');
+INSERT INTO notes VALUES (2244, 3572, 't3');
+INSERT INTO notes VALUES (2245, 185, 't4');
+INSERT INTO notes VALUES (2246, 798, 't5');
+INSERT INTO notes VALUES (2247, 1411, 't6');
+INSERT INTO notes VALUES (2248, 2024, 't7');
+INSERT INTO notes VALUES (2249, 2637, 't8');
+INSERT INTO notes VALUES (2250, 3250, 't0');
+INSERT INTO notes VALUES (2251, 3863, 't1');
+INSERT INTO notes VALUES (2252, 476, 't2');
+INSERT INTO notes VALUES (2253, 1089, 't3');
+INSERT INTO notes VALUES (2254, 1702, 't4');
+INSERT INTO notes VALUES (2255, 2315, 't5');
+INSERT INTO notes VALUES (2256, 2928, 't6');
+INSERT INTO notes VALUES (2257, 3541, 't7');
+INSERT INTO notes VALUES (2258, 154, 't8');
+INSERT INTO notes VALUES (2259, 767, 't0');
+INSERT INTO notes VALUES (2260, 1380, 't1');
+INSERT INTO notes VALUES (2261, 1993, 't2');
+INSERT INTO notes VALUES (2262, 2606, 't3');
+INSERT INTO notes VALUES (2263, 3219, 't4');
+INSERT INTO notes VALUES (2264, 3832, 't5');
+INSERT INTO notes VALUES (2265, 445, 't6');
+INSERT INTO notes VALUES (2266, 1058, 't7');
+INSERT INTO notes VALUES (2267, 1671, 't8');
+INSERT INTO notes VALUES (2268, 2284, 't0');
+INSERT INTO notes VALUES (2269, 2897, 't1');
+INSERT INTO notes VALUES (2270, 3510, 't2');
+INSERT INTO notes VALUES (2271, 123, 't3');
+INSERT INTO notes VALUES (2272, 736, 't4');
+INSERT INTO notes VALUES (2273, 1349, 't5');
+INSERT INTO notes VALUES (2274, 1962, 't6');
+INSERT INTO notes VALUES (2275, 2575, 't7');
+INSERT INTO notes VALUES (2276, 3188, 't8');
+INSERT INTO notes VALUES (2277, 3801, 't0');
+INSERT INTO notes VALUES (2278, 414, 't1');
+INSERT INTO notes VALUES (2279, 1027, 't2');
+INSERT INTO notes VALUES (2280, 1640, 't3');
+INSERT INTO notes VALUES (2281, 2253, 't4');
+INSERT INTO notes VALUES (2282, 2866, 't5');
+INSERT INTO notes VALUES (2283, 3479, 't6');
+INSERT INTO notes VALUES (2284, 92, 't7');
+INSERT INTO notes VALUES (2285, 705, 't8');
+INSERT INTO notes VALUES (2286, 1318, 't0');
+INSERT INTO notes VALUES (2287, 1931, 't1');
+INSERT INTO notes VALUES (2288, 2544, 't2');
+INSERT INTO notes VALUES (2289, 3157, 't3');
+INSERT INTO notes VALUES (2290, 3770, 't4');
+INSERT INTO notes VALUES (2291, 383, 't5');
+INSERT INTO notes VALUES (2292, 996, 't6');
+INSERT INTO notes VALUES (2293, 1609, 't7');
+INSERT INTO notes VALUES (2294, 2222, 't8');
+INSERT INTO notes VALUES (2295, 2835, 't0');
+INSERT INTO notes VALUES (2296, 3448, 't1');
+INSERT INTO notes VALUES (2297, 61, 't2');
+INSERT INTO notes VALUES (2298, 674, 't3');
+INSERT INTO notes VALUES (2299, 1287, 't4');
+INSERT INTO notes VALUES (2300, 1900, 't5');
+INSERT INTO notes VALUES (2301, 2513, 't6');
+INSERT INTO notes VALUES (2302, 3126, 't7');
+INSERT INTO notes VALUES (2303, 3739, 't8');
+INSERT INTO notes VALUES (2304, 352, 't0');
+INSERT INTO notes VALUES (2305, 965, 't1');
+INSERT INTO notes VALUES (2306, 1578, 't2');
+INSERT INTO notes VALUES (2307, 2191, 't3');
+INSERT INTO notes VALUES (2308, 2804, 't4');
+INSERT INTO notes VALUES (2309, 3417, 't5');
+INSERT INTO notes VALUES (2310, 30, 't6');
+INSERT INTO notes VALUES (2311, 643, 't7');
+INSERT INTO notes VALUES (2312, 1256, 't8');
+INSERT INTO notes VALUES (2313, 1869, 't0');
+INSERT INTO notes VALUES (2314, 2482, 't1');
+INSERT INTO notes VALUES (2315, 3095, 't2');
+INSERT INTO notes VALUES (2316, 3708, 't3');
+INSERT INTO notes VALUES (2317, 321, 't4');
+INSERT INTO notes VALUES (2318, 934, 't5');
+INSERT INTO notes VALUES (2319, 1547, 't6');
+INSERT INTO notes VALUES (2320, 2160, 't7');
+INSERT INTO notes VALUES (2321, 2773, 't8');
+INSERT INTO notes VALUES (2322, 3386, 't0');
+INSERT INTO notes VALUES (2323, 3999, 't1');
+INSERT INTO notes VALUES (2324, 612, 't2');
+INSERT INTO notes VALUES (2325, 1225, 't3');
+INSERT INTO notes VALUES (2326, 1838, 't4');
+INSERT INTO notes VALUES (2327, 2451, 't5');
+INSERT INTO notes VALUES (2328, 3064, 't6');
+INSERT INTO notes VALUES (2329, 3677, 't7');
+INSERT INTO notes VALUES (2330, 290, 't8');
+INSERT INTO notes VALUES (2331, 903, 't0');
+INSERT INTO notes VALUES (2332, 1516, 't1');
+INSERT INTO notes VALUES (2333, 2129, 't2');
+INSERT INTO notes VALUES (2334, 2742, 't3');
+INSERT INTO notes VALUES (2335, 3355, 't4');
+INSERT INTO notes VALUES (2336, 3968, 't5');
+INSERT INTO notes VALUES (2337, 581, 't6');
+INSERT INTO notes VALUES (2338, 1194, 't7');
+INSERT INTO notes VALUES (2339, 1807, 't8');
+INSERT INTO notes VALUES (2340, 2420, 't0');
+INSERT INTO notes VALUES (2341, 3033, 't1');
+INSERT INTO notes VALUES (2342, 3646, 't2');
+INSERT INTO notes VALUES (2343, 259, 't3');
+INSERT INTO notes VALUES (2344, 872, 't4');
+INSERT INTO notes VALUES (2345, 1485, 't5');
+INSERT INTO notes VALUES (2346, 2098, 't6');
+INSERT INTO notes VALUES (2347, 2711, 't7');
+INSERT INTO notes VALUES (2348, 3324, 't8');
+INSERT INTO notes VALUES (2349, 3937, 't0');
+INSERT INTO notes VALUES (2350, 550, 't1');
+INSERT INTO notes VALUES (2351, 1163, 't2');
+INSERT INTO notes VALUES (2352, 1776, 't3');
+INSERT INTO notes VALUES (2353, 2389, 't4');
+INSERT INTO notes VALUES (2354, 3002, 't5');
+INSERT INTO notes VALUES (2355, 3615, 't6');
+INSERT INTO notes VALUES (2356, 228, 't7');
+INSERT INTO notes VALUES (2357, 841, 't8');
+INSERT INTO notes VALUES (2358, 1454, 't0');
+INSERT INTO notes VALUES (2359, 2067, 't1');
+INSERT INTO notes VALUES (2360, 2680, 't2');
+INSERT INTO notes VALUES (2361, 3293, 't3');
+INSERT INTO notes VALUES (2362, 3906, 't4');
+INSERT INTO notes VALUES (2363, 519, 't5');
+INSERT INTO notes VALUES (2364, 1132, 't6');
+INSERT INTO notes VALUES (2365, 1745, 't7');
+INSERT INTO notes VALUES (2366, 2358, 't8');
+INSERT INTO notes VALUES (2367, 2971, 't0');
+INSERT INTO notes VALUES (2368, 3584, 't1');
+INSERT INTO notes VALUES (2369, 197, 't2');
+INSERT INTO notes VALUES (2370, 810, 't3');
+INSERT INTO notes VALUES (2371, 1423, 't4');
+INSERT INTO notes VALUES (2372, 2036, 't5');
+INSERT INTO notes VALUES (2373, 2649, 't6');
+INSERT INTO notes VALUES (2374, 3262, 't7');
+INSERT INTO notes VALUES (2375, 3875, 't8');
+INSERT INTO notes VALUES (2376, 488, 't0');
+INSERT INTO notes VALUES (2377, 1101, 't1');
+INSERT INTO notes VALUES (2378, 1714, 't2');
+INSERT INTO notes VALUES (2379, 2327, 't3');
+INSERT INTO notes VALUES (2380, 2940, 't4');
+INSERT INTO notes VALUES (2381, 3553, 't5');
+INSERT INTO notes VALUES (2382, 166, 't6');
+INSERT INTO notes VALUES (2383, 779, 't7');
+INSERT INTO notes VALUES (2384, 1392, 't8');
+INSERT INTO notes VALUES (2385, 2005, 't0');
+INSERT INTO notes VALUES (2386, 2618, 't1');
+INSERT INTO notes VALUES (2387, 3231, 't2');
+INSERT INTO notes VALUES (2388, 3844, 't3');
+INSERT INTO notes VALUES (2389, 457, 't4');
+INSERT INTO notes VALUES (2390, 1070, 't5');
+INSERT INTO notes VALUES (2391, 1683, 't6');
+INSERT INTO notes VALUES (2392, 2296, 't7');
+INSERT INTO notes VALUES (2393, 2909, 't8');
+INSERT INTO notes VALUES (2394, 3522, 't0');
+INSERT INTO notes VALUES (2395, 135, 't1');
+INSERT INTO notes VALUES (2396, 748, 't2');
+INSERT INTO notes VALUES (2397, 1361, 't3');
+INSERT INTO notes VALUES (2398, 1974, 't4');
+INSERT INTO notes VALUES (2399, 2587, 't5');
+INSERT INTO notes VALUES (2400, 3200, 't6');
+INSERT INTO notes VALUES (2401, 3813, 't7');
+INSERT INTO notes VALUES (2402, 426, 't8');
+INSERT INTO notes VALUES (2403, 1039, 't0');
+INSERT INTO notes VALUES (2404, 1652, 't1');
+INSERT INTO notes VALUES (2405, 2265, 't2');
+INSERT INTO notes VALUES (2406, 2878, 't3');
+INSERT INTO notes VALUES (2407, 3491, 't4');
+INSERT INTO notes VALUES (2408, 104, 't5');
+INSERT INTO notes VALUES (2409, 717, 't6');
+INSERT INTO notes VALUES (2410, 1330, 't7');
+INSERT INTO notes VALUES (2411, 1943, 't8');
+INSERT INTO notes VALUES (2412, 2556, 't0');
+INSERT INTO notes VALUES (2413, 3169, 't1');
+INSERT INTO notes VALUES (2414, 3782, 't2');
+INSERT INTO notes VALUES (2415, 395, 't3');
+INSERT INTO notes VALUES (2416, 1008, 't4');
+INSERT INTO notes VALUES (2417, 1621, 't5');
+INSERT INTO notes VALUES (2418, 2234, 't6');
+INSERT INTO notes VALUES (2419, 2847, 't7');
+INSERT INTO notes VALUES (2420, 3460, 't8');
+INSERT INTO notes VALUES (2421, 73, 't0');
+INSERT INTO notes VALUES (2422, 686, 't1');
+INSERT INTO notes VALUES (2423, 1299, 't2');
+INSERT INTO notes VALUES (2424, 1912, 't3');
+INSERT INTO notes VALUES (2425, 2525, 't4');
+INSERT INTO notes VALUES (2426, 3138, 't5');
+INSERT INTO notes VALUES (2427, 3751, 't6');
+INSERT INTO notes VALUES (2428, 364, 't7');
+INSERT INTO notes VALUES (2429, 977, 't8');
+INSERT INTO notes VALUES (2430, 1590, 't0');
+INSERT INTO notes VALUES (2431, 2203, 't1');
+INSERT INTO notes VALUES (2432, 2816, 't2');
+INSERT INTO notes VALUES (2433, 3429, 't3');
+INSERT INTO notes VALUES (2434, 42, 't4');
+INSERT INTO notes VALUES (2435, 655, 't5');
+INSERT INTO notes VALUES (2436, 1268, 't6');
+INSERT INTO notes VALUES (2437, 1881, 't7');
+INSERT INTO notes VALUES (2438, 2494, 't8');
+INSERT INTO notes VALUES (2439, 3107, 't0');
+INSERT INTO notes VALUES (2440, 3720, 't1');
+INSERT INTO notes VALUES (2441, 333, 't2');
+INSERT INTO notes VALUES (2442, 946, 't3');
+INSERT INTO notes VALUES (2443, 1559, 't4');
+INSERT INTO notes VALUES (2444, 2172, 't5');
+INSERT INTO notes VALUES (2445, 2785, 't6');
+INSERT INTO notes VALUES (2446, 3398, 't7');
+INSERT INTO notes VALUES (2447, 11, 't8');
+INSERT INTO notes VALUES (2448, 624, 't0');
+INSERT INTO notes VALUES (2449, 1237, 't1');
+INSERT INTO notes VALUES (2450, 1850, 't2');
+INSERT INTO notes VALUES (2451, 2463, 't3');
+INSERT INTO notes VALUES (2452, 3076, 't4');
+INSERT INTO notes VALUES (2453, 3689, 't5');
+INSERT INTO notes VALUES (2454, 302, 't6');
+INSERT INTO notes VALUES (2455, 915, 't7');
+INSERT INTO notes VALUES (2456, 1528, 't8');
+INSERT INTO notes VALUES (2457, 2141, 't0');
+INSERT INTO notes VALUES (2458, 2754, 't1');
+INSERT INTO notes VALUES (2459, 3367, 't2');
+INSERT INTO notes VALUES (2460, 3980, 't3');
+INSERT INTO notes VALUES (2461, 593, 't4');
+INSERT INTO notes VALUES (2462, 1206, 't5');
+INSERT INTO notes VALUES (2463, 1819, 't6');
+INSERT INTO notes VALUES (2464, 2432, 't7');
+INSERT INTO notes VALUES (2465, 3045, 't8');
+INSERT INTO notes VALUES (2466, 3658, 't0');
+INSERT INTO notes VALUES (2467, 271, 't1');
+INSERT INTO notes VALUES (2468, 884, 't2');
+INSERT INTO notes VALUES (2469, 1497, 't3');
+INSERT INTO notes VALUES (2470, 2110, 't4');
+INSERT INTO notes VALUES (2471, 2723, 't5');
+INSERT INTO notes VALUES (2472, 3336, 't6');
+INSERT INTO notes VALUES (2473, 3949, 't7');
+INSERT INTO notes VALUES (2474, 562, 't8');
+INSERT INTO notes VALUES (2475, 1175, 't0');
+INSERT INTO notes VALUES (2476, 1788, 't1');
+INSERT INTO notes VALUES (2477, 2401, 't2');
+INSERT INTO notes VALUES (2478, 3014, 't3');
+INSERT INTO notes VALUES (2479, 3627, 't4');
+INSERT INTO notes VALUES (2480, 240, 't5');
+INSERT INTO notes VALUES (2481, 853, 't6');
+INSERT INTO notes VALUES (2482, 1466, 't7');
+INSERT INTO notes VALUES (2483, 2079, 't8');
+INSERT INTO notes VALUES (2484, 2692, 't0');
+INSERT INTO notes VALUES (2485, 3305, 't1');
+INSERT INTO notes VALUES (2486, 3918, 't2');
+INSERT INTO notes VALUES (2487, 531, 't3');
+INSERT INTO notes VALUES (2488, 1144, 't4');
+INSERT INTO notes VALUES (2489, 1757, 't5');
+INSERT INTO notes VALUES (2490, 2370, 't6');
+INSERT INTO notes VALUES (2491, 2983, 't7');
+INSERT INTO notes VALUES (2492, 3596, 't8');
+INSERT INTO notes VALUES (2493, 209, 't0');
+INSERT INTO notes VALUES (2494, 822, 't1');
+INSERT INTO notes VALUES (2495, 1435, 't2');
+INSERT INTO notes VALUES (2496, 2048, 't3');
+INSERT INTO notes VALUES (2497, 2661, 't4');
+INSERT INTO notes VALUES (2498, 3274, 't5');
+INSERT INTO notes VALUES (2499, 3887, 't6');
+INSERT INTO notes VALUES (2500, 500, 't7');
+INSERT INTO notes VALUES (2501, 1113, 't8');
+INSERT INTO notes VALUES (2502, 1726, 't0');
+INSERT INTO notes VALUES (2503, 2339, 't1');
+INSERT INTO notes VALUES (2504, 2952, 't2');
+INSERT INTO notes VALUES (2505, 3565, 't3');
+INSERT INTO notes VALUES (2506, 178, 't4');
+INSERT INTO notes VALUES (2507, 791, 't5');
+INSERT INTO notes VALUES (2508, 1404, 't6');
+INSERT INTO notes VALUES (2509, 2017, 't7');
+INSERT INTO notes VALUES (2510, 2630, 't8');
+INSERT INTO notes VALUES (2511, 3243, 't0');
+INSERT INTO notes VALUES (2512, 3856, 't1');
+INSERT INTO notes VALUES (2513, 469, 't2');
+INSERT INTO notes VALUES (2514, 1082, 't3');
+INSERT INTO notes VALUES (2515, 1695, 't4');
+INSERT INTO notes VALUES (2516, 2308, 't5');
+INSERT INTO notes VALUES (2517, 2921, 't6');
+INSERT INTO notes VALUES (2518, 3534, 't7');
+INSERT INTO notes VALUES (2519, 147, 't8');
+INSERT INTO notes VALUES (2520, 760, 't0');
+INSERT INTO notes VALUES (2521, 1373, 't1');
+INSERT INTO notes VALUES (2522, 1986, 't2');
+INSERT INTO notes VALUES (2523, 2599, 't3');
+INSERT INTO notes VALUES (2524, 3212, 't4');
+INSERT INTO notes VALUES (2525, 3825, 't5');
+INSERT INTO notes VALUES (2526, 438, 't6');
+INSERT INTO notes VALUES (2527, 1051, 't7');
+INSERT INTO notes VALUES (2528, 1664, 't8');
+INSERT INTO notes VALUES (2529, 2277, 't0');
+INSERT INTO notes VALUES (2530, 2890, 't1');
+INSERT INTO notes VALUES (2531, 3503, 't2');
+INSERT INTO notes VALUES (2532, 116, 't3');
+INSERT INTO notes VALUES (2533, 729, 't4');
+INSERT INTO notes VALUES (2534, 1342, 't5');
+INSERT INTO notes VALUES (2535, 1955, 't6');
+INSERT INTO notes VALUES (2536, 2568, 't7');
+INSERT INTO notes VALUES (2537, 3181, 't8');
+INSERT INTO notes VALUES (2538, 3794, 't0');
+INSERT INTO notes VALUES (2539, 407, 't1');
+INSERT INTO notes VALUES (2540, 1020, 't2');
+INSERT INTO notes VALUES (2541, 1633, 't3');
+INSERT INTO notes VALUES (2542, 2246, 't4');
+INSERT INTO notes VALUES (2543, 2859, 't5');
+INSERT INTO notes VALUES (2544, 3472, 't6');
+INSERT INTO notes VALUES (2545, 85, 't7');
+INSERT INTO notes VALUES (2546, 698, 't8');
+INSERT INTO notes VALUES (2547, 1311, 't0');
+INSERT INTO notes VALUES (2548, 1924, 't1');
+INSERT INTO notes VALUES (2549, 2537, 't2');
+INSERT INTO notes VALUES (2550, 3150, 't3');
+INSERT INTO notes VALUES (2551, 3763, 't4');
+INSERT INTO notes VALUES (2552, 376, 't5');
+INSERT INTO notes VALUES (2553, 989, 't6');
+INSERT INTO notes VALUES (2554, 1602, 't7');
+INSERT INTO notes VALUES (2555, 2215, 't8');
+INSERT INTO notes VALUES (2556, 2828, 't0');
+INSERT INTO notes VALUES (2557, 3441, 't1');
+INSERT INTO notes VALUES (2558, 54, 't2');
+INSERT INTO notes VALUES (2559, 667, 't3');
+INSERT INTO notes VALUES (2560, 1280, 't4');
+INSERT INTO notes VALUES (2561, 1893, 't5');
+INSERT INTO notes VALUES (2562, 2506, 't6');
+INSERT INTO notes VALUES (2563, 3119, 't7');
+INSERT INTO notes VALUES (2564, 3732, 't8');
+INSERT INTO notes VALUES (2565, 345, 't0');
+INSERT INTO notes VALUES (2566, 958, 't1');
+INSERT INTO notes VALUES (2567, 1571, 't2');
+INSERT INTO notes VALUES (2568, 2184, 't3');
+INSERT INTO notes VALUES (2569, 2797, 't4');
+INSERT INTO notes VALUES (2570, 3410, 't5');
+INSERT INTO notes VALUES (2571, 23, 't6');
+INSERT INTO notes VALUES (2572, 636, 't7');
+INSERT INTO notes VALUES (2573, 1249, 't8');
+INSERT INTO notes VALUES (2574, 1862, 't0');
+INSERT INTO notes VALUES (2575, 2475, 't1');
+INSERT INTO notes VALUES (2576, 3088, 't2');
+INSERT INTO notes VALUES (2577, 3701, 't3');
+INSERT INTO notes VALUES (2578, 314, 't4');
+INSERT INTO notes VALUES (2579, 927, 't5');
+INSERT INTO notes VALUES (2580, 1540, 't6');
+INSERT INTO notes VALUES (2581, 2153, 't7');
+INSERT INTO notes VALUES (2582, 2766, 't8');
+INSERT INTO notes VALUES (2583, 3379, 't0');
+INSERT INTO notes VALUES (2584, 3992, 't1');
+INSERT INTO notes VALUES (2585, 605, 't2');
+INSERT INTO notes VALUES (2586, 1218, 't3');
+INSERT INTO notes VALUES (2587, 1831, 't4');
+INSERT INTO notes VALUES (2588, 2444, 't5');
+INSERT INTO notes VALUES (2589, 3057, 't6');
+INSERT INTO notes VALUES (2590, 3670, 't7');
+INSERT INTO notes VALUES (2591, 283, 't8');
+INSERT INTO notes VALUES (2592, 896, 't0');
+INSERT INTO notes VALUES (2593, 1509, 't1');
+INSERT INTO notes VALUES (2594, 2122, 't2');
+INSERT INTO notes VALUES (2595, 2735, 't3');
+INSERT INTO notes VALUES (2596, 3348, 't4');
+INSERT INTO notes VALUES (2597, 3961, 't5');
+INSERT INTO notes VALUES (2598, 574, 't6');
+INSERT INTO notes VALUES (2599, 1187, 't7');
+INSERT INTO notes VALUES (2600, 1800, 't8');
+INSERT INTO notes VALUES (2601, 2413, 't0');
+INSERT INTO notes VALUES (2602, 3026, 't1');
+INSERT INTO notes VALUES (2603, 3639, 't2');
+INSERT INTO notes VALUES (2604, 252, 't3');
+INSERT INTO notes VALUES (2605, 865, 't4');
+INSERT INTO notes VALUES (2606, 1478, 't5');
+INSERT INTO notes VALUES (2607, 2091, 't6');
+INSERT INTO notes VALUES (2608, 2704, 't7');
+INSERT INTO notes VALUES (2609, 3317, 't8');
+INSERT INTO notes VALUES (2610, 3930, 't0');
+INSERT INTO notes VALUES (2611, 543, 't1');
+INSERT INTO notes VALUES (2612, 1156, 't2');
+INSERT INTO notes VALUES (2613, 1769, 't3');
+INSERT INTO notes VALUES (2614, 2382, 't4');
+INSERT INTO notes VALUES (2615, 2995, 't5');
+INSERT INTO notes VALUES (2616, 3608, 't6');
+INSERT INTO notes VALUES (2617, 221, 't7');
+INSERT INTO notes VALUES (2618, 834, 't8');
+INSERT INTO notes VALUES (2619, 1447, 't0');
+INSERT INTO notes VALUES (2620, 2060, 't1');
+INSERT INTO notes VALUES (2621, 2673, 't2');
+INSERT INTO notes VALUES (2622, 3286, 't3');
+INSERT INTO notes VALUES (2623, 3899, 't4');
+INSERT INTO notes VALUES (2624, 512, 't5');
+INSERT INTO notes VALUES (2625, 1125, 't6');
+INSERT INTO notes VALUES (2626, 1738, 't7');
+INSERT INTO notes VALUES (2627, 2351, 't8');
+INSERT INTO notes VALUES (2628, 2964, 't0');
+INSERT INTO notes VALUES (2629, 3577, 't1');
+INSERT INTO notes VALUES (2630, 190, 't2');
+INSERT INTO notes VALUES (2631, 803, 't3');
+INSERT INTO notes VALUES (2632, 1416, 't4');
+INSERT INTO notes VALUES (2633, 2029, 't5');
+INSERT INTO notes VALUES (2634, 2642, 't6');
+INSERT INTO notes VALUES (2635, 3255, 't7');
+INSERT INTO notes VALUES (2636, 3868, 't8');
+INSERT INTO notes VALUES (2637, 481, 't0');
+INSERT INTO notes VALUES (2638, 1094, 't1');
+INSERT INTO notes VALUES (2639, 1707, 't2');
+INSERT INTO notes VALUES (2640, 2320, 't3');
+INSERT INTO notes VALUES (2641, 2933, 't4');
+INSERT INTO notes VALUES (2642, 3546, 't5');
+INSERT INTO notes VALUES (2643, 159, 't6');
+INSERT INTO notes VALUES (2644, 772, 't7');
+INSERT INTO notes VALUES (2645, 1385, 't8');
+INSERT INTO notes VALUES (2646, 1998, 't0');
+INSERT INTO notes VALUES (2647, 2611, 't1');
+INSERT INTO notes VALUES (2648, 3224, 't2');
+INSERT INTO notes VALUES (2649, 3837, 't3');
+INSERT INTO notes VALUES (2650, 450, 't4');
+INSERT INTO notes VALUES (2651, 1063, 't5');
+INSERT INTO notes VALUES (2652, 1676, 't6');
+INSERT INTO notes VALUES (2653, 2289, 't7');
+INSERT INTO notes VALUES (2654, 2902, 't8');
+INSERT INTO notes VALUES (2655, 3515, 't0');
+INSERT INTO notes VALUES (2656, 128, 't1');
+INSERT INTO notes VALUES (2657, 741, 't2');
+INSERT INTO notes VALUES (2658, 1354, 't3');
+INSERT INTO notes VALUES (2659, 1967, 't4');
+INSERT INTO notes VALUES (2660, 2580, 't5');
+INSERT INTO notes VALUES (2661, 3193, 't6');
+INSERT INTO notes VALUES (2662, 3806, 't7');
+INSERT INTO notes VALUES (2663, 419, 't8');
+INSERT INTO notes VALUES (2664, 1032, 't0');
+INSERT INTO notes VALUES (2665, 1645, 't1');
+INSERT INTO notes VALUES (2666, 2258, 't2');
+INSERT INTO notes VALUES (2667, 2871, 't3');
+INSERT INTO notes VALUES (2668, 3484, 't4');
+INSERT INTO notes VALUES (2669, 97, 't5');
+INSERT INTO notes VALUES (2670, 710, 't6');
+INSERT INTO notes VALUES (2671, 1323, 't7');
+INSERT INTO notes VALUES (2672, 1936, 't8');
+INSERT INTO notes VALUES (2673, 2549, 't0');
+INSERT INTO notes VALUES (2674, 3162, 't1');
+INSERT INTO notes VALUES (2675, 3775, 't2');
+INSERT INTO notes VALUES (2676, 388, 't3');
+INSERT INTO notes VALUES (2677, 1001, 't4');
+INSERT INTO notes VALUES (2678, 1614, 't5');
+INSERT INTO notes VALUES (2679, 2227, 't6');
+INSERT INTO notes VALUES (2680, 2840, 't7');
+INSERT INTO notes VALUES (2681, 3453, 't8');
+INSERT INTO notes VALUES (2682, 66, 't0');
+INSERT INTO notes VALUES (2683, 679, 't1');
+INSERT INTO notes VALUES (2684, 1292, 't2');
+INSERT INTO notes VALUES (2685, 1905, 't3');
+INSERT INTO notes VALUES (2686, 2518, 't4');
+INSERT INTO notes VALUES (2687, 3131, 't5');
+INSERT INTO notes VALUES (2688, 3744, 't6');
+INSERT INTO notes VALUES (2689, 357, 't7');
+INSERT INTO notes VALUES (2690, 970, 't8');
+INSERT INTO notes VALUES (2691, 1583, 't0');
+INSERT INTO notes VALUES (2692, 2196, 't1');
+INSERT INTO notes VALUES (2693, 2809, 't2');
+INSERT INTO notes VALUES (2694, 3422, 't3');
+INSERT INTO notes VALUES (2695, 35, 't4');
+INSERT INTO notes VALUES (2696, 648, 't5');
+INSERT INTO notes VALUES (2697, 1261, 't6');
+INSERT INTO notes VALUES (2698, 1874, 't7');
+INSERT INTO notes VALUES (2699, 2487, 't8');
+INSERT INTO notes VALUES (2700, 3100, 't0');
+INSERT INTO notes VALUES (2701, 3713, 't1');
+INSERT INTO notes VALUES (2702, 326, 't2');
+INSERT INTO notes VALUES (2703, 939, 't3');
+INSERT INTO notes VALUES (2704, 1552, 't4');
+INSERT INTO notes VALUES (2705, 2165, 't5');
+INSERT INTO notes VALUES (2706, 2778, 't6');
+INSERT INTO notes VALUES (2707, 3391, 't7');
+INSERT INTO notes VALUES (2708, 4, 't8');
+INSERT INTO notes VALUES (2709, 617, 't0');
+INSERT INTO notes VALUES (2710, 1230, 't1');
+INSERT INTO notes VALUES (2711, 1843, 't2');
+INSERT INTO notes VALUES (2712, 2456, 't3');
+INSERT INTO notes VALUES (2713, 3069, 't4');
+INSERT INTO notes VALUES (2714, 3682, 't5');
+INSERT INTO notes VALUES (2715, 295, 't6');
+INSERT INTO notes VALUES (2716, 908, 't7');
+INSERT INTO notes VALUES (2717, 1521, 't8');
+INSERT INTO notes VALUES (2718, 2134, 't0');
+INSERT INTO notes VALUES (2719, 2747, 't1');
+INSERT INTO notes VALUES (2720, 3360, 't2');
+INSERT INTO notes VALUES (2721, 3973, 't3');
+INSERT INTO notes VALUES (2722, 586, 't4');
+INSERT INTO notes VALUES (2723, 1199, 't5');
+INSERT INTO notes VALUES (2724, 1812, 't6');
+INSERT INTO notes VALUES (2725, 2425, 't7');
+INSERT INTO notes VALUES (2726, 3038, 't8');
+INSERT INTO notes VALUES (2727, 3651, 't0');
+INSERT INTO notes VALUES (2728, 264, 't1');
+INSERT INTO notes VALUES (2729, 877, 't2');
+INSERT INTO notes VALUES (2730, 1490, 't3');
+INSERT INTO notes VALUES (2731, 2103, 't4');
+INSERT INTO notes VALUES (2732, 2716, 't5');
+INSERT INTO notes VALUES (2733, 3329, 't6');
+INSERT INTO notes VALUES (2734, 3942, 't7');
+INSERT INTO notes VALUES (2735, 555, 't8');
+INSERT INTO notes VALUES (2736, 1168, 't0');
+INSERT INTO notes VALUES (2737, 1781, 't1');
+INSERT INTO notes VALUES (2738, 2394, 't2');
+INSERT INTO notes VALUES (2739, 3007, 't3');
+INSERT INTO notes VALUES (2740, 3620, 't4');
+INSERT INTO notes VALUES (2741, 233, 't5');
+INSERT INTO notes VALUES (2742, 846, 't6');
+INSERT INTO notes VALUES (2743, 1459, 't7');
+INSERT INTO notes VALUES (2744, 2072, 't8');
+INSERT INTO notes VALUES (2745, 2685, 't0');
+INSERT INTO notes VALUES (2746, 3298, 't1');
+INSERT INTO notes VALUES (2747, 3911, 't2');
+INSERT INTO notes VALUES (2748, 524, 't3');
+INSERT INTO notes VALUES (2749, 1137, 't4');
+INSERT INTO notes VALUES (2750, 1750, 't5');
+INSERT INTO notes VALUES (2751, 2363, 't6');
+INSERT INTO notes VALUES (2752, 2976, 't7');
+INSERT INTO notes VALUES (2753, 3589, 't8');
+INSERT INTO notes VALUES (2754, 202, 't0');
+INSERT INTO notes VALUES (2755, 815, 't1');
+INSERT INTO notes VALUES (2756, 1428, 't2');
+INSERT INTO notes VALUES (2757, 2041, 't3');
+INSERT INTO notes VALUES (2758, 2654, 't4');
+INSERT INTO notes VALUES (2759, 3267, 't5');
+INSERT INTO notes VALUES (2760, 3880, 't6');
+INSERT INTO notes VALUES (2761, 493, 't7');
+INSERT INTO notes VALUES (2762, 1106, 't8');
+INSERT INTO notes VALUES (2763, 1719, 't0');
+INSERT INTO notes VALUES (2764, 2332, 't1');
+INSERT INTO notes VALUES (2765, 2945, 't2');
+INSERT INTO notes VALUES (2766, 3558, 't3');
+INSERT INTO notes VALUES (2767, 171, 't4');
+INSERT INTO notes VALUES (2768, 784, 't5');
+INSERT INTO notes VALUES (2769, 1397, 't6');
+INSERT INTO notes VALUES (2770, 2010, 't7');
+INSERT INTO notes VALUES (2771, 2623, 't8');
+INSERT INTO notes VALUES (2772, 3236, 't0');
+INSERT INTO notes VALUES (2773, 3849, 't1');
+INSERT INTO notes VALUES (2774, 462, 't2');
+INSERT INTO notes VALUES (2775, 1075, 't3');
+INSERT INTO notes VALUES (2776, 1688, 't4');
+INSERT INTO notes VALUES (2777, 2301, 't5');
+INSERT INTO notes VALUES (2778, 2914, 't6');
+INSERT INTO notes VALUES (2779, 3527, 't7');
+INSERT INTO notes VALUES (2780, 140, 't8');
+INSERT INTO notes VALUES (2781, 753, 't0');
+INSERT INTO notes VALUES (2782, 1366, 't1');
+INSERT INTO notes VALUES (2783, 1979, 't2');
+INSERT INTO notes VALUES (2784, 2592, 't3');
+INSERT INTO notes VALUES (2785, 3205, 't4');
+INSERT INTO notes VALUES (2786, 3818, 't5');
+INSERT INTO notes VALUES (2787, 431, 't6');
+INSERT INTO notes VALUES (2788, 1044, 't7');
+INSERT INTO notes VALUES (2789, 1657, 't8');
+INSERT INTO notes VALUES (2790, 2270, 't0');
+INSERT INTO notes VALUES (2791, 2883, 't1');
+INSERT INTO notes VALUES (2792, 3496, 't2');
+INSERT INTO notes VALUES (2793, 109, 't3');
+INSERT INTO notes VALUES (2794, 722, 't4');
+INSERT INTO notes VALUES (2795, 1335, 't5');
+INSERT INTO notes VALUES (2796, 1948, 't6');
+INSERT INTO notes VALUES (2797, 2561, 't7');
+INSERT INTO notes VALUES (2798, 3174, 't8');
+INSERT INTO notes VALUES (2799, 3787, 't0');
+INSERT INTO notes VALUES (2800, 400, 't1');
+INSERT INTO notes VALUES (2801, 1013, 't2');
+INSERT INTO notes VALUES (2802, 1626, 't3');
+INSERT INTO notes VALUES (2803, 2239, 't4');
+INSERT INTO notes VALUES (2804, 2852, 't5');
+INSERT INTO notes VALUES (2805, 3465, 't6');
+INSERT INTO notes VALUES (2806, 78, 't7');
+INSERT INTO notes VALUES (2807, 691, 't8');
+INSERT INTO notes VALUES (2808, 1304, 't0');
+INSERT INTO notes VALUES (2809, 1917, 't1');
+INSERT INTO notes VALUES (2810, 2530, 't2');
+INSERT INTO notes VALUES (2811, 3143, 't3');
+INSERT INTO notes VALUES (2812, 3756, 't4');
+INSERT INTO notes VALUES (2813, 369, 't5');
+INSERT INTO notes VALUES (2814, 982, 't6');
+INSERT INTO notes VALUES (2815, 1595, 't7');
+INSERT INTO notes VALUES (2816, 2208, 't8');
+INSERT INTO notes VALUES (2817, 2821, 't0');
+INSERT INTO notes VALUES (2818, 3434, 't1');
+INSERT INTO notes VALUES (2819, 47, 't2');
+INSERT INTO notes VALUES (2820, 660, 't3');
+INSERT INTO notes VALUES (2821, 1273, 't4');
+INSERT INTO notes VALUES (2822, 1886, 't5');
+INSERT INTO notes VALUES (2823, 2499, 't6');
+INSERT INTO notes VALUES (2824, 3112, 't7');
+INSERT INTO notes VALUES (2825, 3725, 't8');
+INSERT INTO notes VALUES (2826, 338, 't0');
+INSERT INTO notes VALUES (2827, 951, 't1');
+INSERT INTO notes VALUES (2828, 1564, 't2');
+INSERT INTO notes VALUES (2829, 2177, 't3');
+INSERT INTO notes VALUES (2830, 2790, 't4');
+INSERT INTO notes VALUES (2831, 3403, 't5');
+INSERT INTO notes VALUES (2832, 16, 't6');
+INSERT INTO notes VALUES (2833, 629, 't7');
+INSERT INTO notes VALUES (2834, 1242, 't8');
+INSERT INTO notes VALUES (2835, 1855, 't0');
+INSERT INTO notes VALUES (2836, 2468, 't1');
+INSERT INTO notes VALUES (2837, 3081, 't2');
+INSERT INTO notes VALUES (2838, 3694, 't3');
+INSERT INTO notes VALUES (2839, 307, 't4');
+INSERT INTO notes VALUES (2840, 920, 't5');
+INSERT INTO notes VALUES (2841, 1533, 't6');
+INSERT INTO notes VALUES (2842, 2146, 't7');
+INSERT INTO notes VALUES (2843, 2759, 't8');
+INSERT INTO notes VALUES (2844, 3372, 't0');
+INSERT INTO notes VALUES (2845, 3985, 't1');
+INSERT INTO notes VALUES (2846, 598, 't2');
+INSERT INTO notes VALUES (2847, 1211, 't3');
+INSERT INTO notes VALUES (2848, 1824, 't4');
+INSERT INTO notes VALUES (2849, 2437, 't5');
+INSERT INTO notes VALUES (2850, 3050, 't6');
+INSERT INTO notes VALUES (2851, 3663, 't7');
+INSERT INTO notes VALUES (2852, 276, 't8');
+INSERT INTO notes VALUES (2853, 889, 't0');
+INSERT INTO notes VALUES (2854, 1502, 't1');
+INSERT INTO notes VALUES (2855, 2115, 't2');
+INSERT INTO notes VALUES (2856, 2728, 't3');
+INSERT INTO notes VALUES (2857, 3341, 't4');
+INSERT INTO notes VALUES (2858, 3954, 't5');
+INSERT INTO notes VALUES (2859, 567, 't6');
+INSERT INTO notes VALUES (2860, 1180, 't7');
+INSERT INTO notes VALUES (2861, 1793, 't8');
+INSERT INTO notes VALUES (2862, 2406, 't0');
+INSERT INTO notes VALUES (2863, 3019, 't1');
+INSERT INTO notes VALUES (2864, 3632, 't2');
+INSERT INTO notes VALUES (2865, 245, 't3');
+INSERT INTO notes VALUES (2866, 858, 't4');
+INSERT INTO notes VALUES (2867, 1471, 't5');
+INSERT INTO notes VALUES (2868, 2084, 't6');
+INSERT INTO notes VALUES (2869, 2697, 't7');
+INSERT INTO notes VALUES (2870, 3310, 't8');
+INSERT INTO notes VALUES (2871, 3923, 't0');
+INSERT INTO notes VALUES (2872, 536, 't1');
+INSERT INTO notes VALUES (2873, 1149, 't2');
+INSERT INTO notes VALUES (2874, 1762, 't3');
+INSERT INTO notes VALUES (2875, 2375, 't4');
+INSERT INTO notes VALUES (2876, 2988, 't5');
+INSERT INTO notes VALUES (2877, 3601, 't6');
+INSERT INTO notes VALUES (2878, 214, 't7');
+INSERT INTO notes VALUES (2879, 827, 't8');
+INSERT INTO notes VALUES (2880, 1440, 't0');
+INSERT INTO notes VALUES (2881, 2053, 't1');
+INSERT INTO notes VALUES (2882, 2666, 't2');
+INSERT INTO notes VALUES (2883, 3279, 't3');
+INSERT INTO notes VALUES (2884, 3892, 't4');
+INSERT INTO notes VALUES (2885, 505, 't5');
+INSERT INTO notes VALUES (2886, 1118, 't6');
+INSERT INTO notes VALUES (2887, 1731, 't7');
+INSERT INTO notes VALUES (2888, 2344, 't8');
+INSERT INTO notes VALUES (2889, 2957, 't0');
+INSERT INTO notes VALUES (2890, 3570, 't1');
+INSERT INTO notes VALUES (2891, 183, 't2');
+INSERT INTO notes VALUES (2892, 796, 't3');
+INSERT INTO notes VALUES (2893, 1409, 't4');
+INSERT INTO notes VALUES (2894, 2022, 't5');
+INSERT INTO notes VALUES (2895, 2635, 't6');
+INSERT INTO notes VALUES (2896, 3248, 't7');
+INSERT INTO notes VALUES (2897, 3861, 't8');
+INSERT INTO notes VALUES (2898, 474, 't0');
+INSERT INTO notes VALUES (2899, 1087, 't1');
+INSERT INTO notes VALUES (2900, 1700, 't2');
+INSERT INTO notes VALUES (2901, 2313, 't3');
+INSERT INTO notes VALUES (2902, 2926, 't4');
+INSERT INTO notes VALUES (2903, 3539, 't5');
+INSERT INTO notes VALUES (2904, 152, 't6');
+INSERT INTO notes VALUES (2905, 765, 't7');
+INSERT INTO notes VALUES (2906, 1378, 't8');
+INSERT INTO notes VALUES (2907, 1991, 't0');
+INSERT INTO notes VALUES (2908, 2604, 't1');
+INSERT INTO notes VALUES (2909, 3217, 't2');
+INSERT INTO notes VALUES (2910, 3830, 't3');
+INSERT INTO notes VALUES (2911, 443, 't4');
+INSERT INTO notes VALUES (2912, 1056, 't5');
+INSERT INTO notes VALUES (2913, 1669, 't6');
+INSERT INTO notes VALUES (2914, 2282, 't7');
+INSERT INTO notes VALUES (2915, 2895, 't8');
+INSERT INTO notes VALUES (2916, 3508, 't0');
+INSERT INTO notes VALUES (2917, 121, 't1');
+INSERT INTO notes VALUES (2918, 734, 't2');
+INSERT INTO notes VALUES (2919, 1347, 't3');
+INSERT INTO notes VALUES (2920, 1960, 't4');
+INSERT INTO notes VALUES (2921, 2573, 't5');
+INSERT INTO notes VALUES (2922, 3186, 't6');
+INSERT INTO notes VALUES (2923, 3799, 't7');
+INSERT INTO notes VALUES (2924, 412, 't8');
+INSERT INTO notes VALUES (2925, 1025, 't0');
+INSERT INTO notes VALUES (2926, 1638, 't1');
+INSERT INTO notes VALUES (2927, 2251, 't2');
+INSERT INTO notes VALUES (2928, 2864, 't3');
+INSERT INTO notes VALUES (2929, 3477, 't4');
+INSERT INTO notes VALUES (2930, 90, 't5');
+INSERT INTO notes VALUES (2931, 703, 't6');
+INSERT INTO notes VALUES (2932, 1316, 't7');
+INSERT INTO notes VALUES (2933, 1929, 't8');
+INSERT INTO notes VALUES (2934, 2542, 't0');
+INSERT INTO notes VALUES (2935, 3155, 't1');
+INSERT INTO notes VALUES (2936, 3768, 't2');
+INSERT INTO notes VALUES (2937, 381, 't3');
+INSERT INTO notes VALUES (2938, 994, 't4');
+INSERT INTO notes VALUES (2939, 1607, 't5');
+INSERT INTO notes VALUES (2940, 2220, 't6');
+INSERT INTO notes VALUES (2941, 2833, 't7');
+INSERT INTO notes VALUES (2942, 3446, 't8');
+INSERT INTO notes VALUES (2943, 59, 't0');
+INSERT INTO notes VALUES (2944, 672, 't1');
+INSERT INTO notes VALUES (2945, 1285, 't2');
+INSERT INTO notes VALUES (2946, 1898, 't3');
+INSERT INTO notes VALUES (2947, 2511, 't4');
+INSERT INTO notes VALUES (2948, 3124, 't5');
+INSERT INTO notes VALUES (2949, 3737, 't6');
+INSERT INTO notes VALUES (2950, 350, 't7');
+INSERT INTO notes VALUES (2951, 963, 't8');
+INSERT INTO notes VALUES (2952, 1576, 't0');
+INSERT INTO notes VALUES (2953, 2189, 't1');
+INSERT INTO notes VALUES (2954, 2802, 't2');
+INSERT INTO notes VALUES (2955, 3415, 't3');
+INSERT INTO notes VALUES (2956, 28, 't4');
+INSERT INTO notes VALUES (2957, 641, 't5');
+INSERT INTO notes VALUES (2958, 1254, 't6');
+INSERT INTO notes VALUES (2959, 1867, 't7');
+INSERT INTO notes VALUES (2960, 2480, 't8');
+INSERT INTO notes VALUES (2961, 3093, 't0');
+INSERT INTO notes VALUES (2962, 3706, 't1');
+INSERT INTO notes VALUES (2963, 319, 't2');
+INSERT INTO notes VALUES (2964, 932, 't3');
+INSERT INTO notes VALUES (2965, 1545, 't4');
+INSERT INTO notes VALUES (2966, 2158, 't5');
+INSERT INTO notes VALUES (2967, 2771, 't6');
+INSERT INTO notes VALUES (2968, 3384, 't7');
+INSERT INTO notes VALUES (2969, 3997, 't8');
+INSERT INTO notes VALUES (2970, 610, 't0');
+INSERT INTO notes VALUES (2971, 1223, 't1');
+INSERT INTO notes VALUES (2972, 1836, 't2');
+INSERT INTO notes VALUES (2973, 2449, 't3');
+INSERT INTO notes VALUES (2974, 3062, 't4');
+INSERT INTO notes VALUES (2975, 3675, 't5');
+INSERT INTO notes VALUES (2976, 288, 't6');
+INSERT INTO notes VALUES (2977, 901, 't7');
+INSERT INTO notes VALUES (2978, 1514, 't8');
+INSERT INTO notes VALUES (2979, 2127, 't0');
+INSERT INTO notes VALUES (2980, 2740, 't1');
+INSERT INTO notes VALUES (2981, 3353, 't2');
+INSERT INTO notes VALUES (2982, 3966, 't3');
+INSERT INTO notes VALUES (2983, 579, 't4');
+INSERT INTO notes VALUES (2984, 1192, 't5');
+INSERT INTO notes VALUES (2985, 1805, 't6');
+INSERT INTO notes VALUES (2986, 2418, 't7');
+INSERT INTO notes VALUES (2987, 3031, 't8');
+INSERT INTO notes VALUES (2988, 3644, 't0');
+INSERT INTO notes VALUES (2989, 257, 't1');
+INSERT INTO notes VALUES (2990, 870, 't2');
+INSERT INTO notes VALUES (2991, 1483, 't3');
+INSERT INTO notes VALUES (2992, 2096, 't4');
+INSERT INTO notes VALUES (2993, 2709, 't5');
+INSERT INTO notes VALUES (2994, 3322, 't6');
+INSERT INTO notes VALUES (2995, 3935, 't7');
+INSERT INTO notes VALUES (2996, 548, 't8');
+INSERT INTO notes VALUES (2997, 1161, 't0');
+INSERT INTO notes VALUES (2998, 1774, 't1');
+INSERT INTO notes VALUES (2999, 2387, 't2');
+INSERT INTO notes VALUES (3000, 3000, 't3');
+INSERT INTO notes VALUES (3001, 3613, 't4');
+INSERT INTO notes VALUES (3002, 226, 't5');
+INSERT INTO notes VALUES (3003, 839, 't6');
+INSERT INTO notes VALUES (3004, 1452, 't7');
+INSERT INTO notes VALUES (3005, 2065, 't8');
+INSERT INTO notes VALUES (3006, 2678, 't0');
+INSERT INTO notes VALUES (3007, 3291, 't1');
+INSERT INTO notes VALUES (3008, 3904, 't2');
+INSERT INTO notes VALUES (3009, 517, 't3');
+INSERT INTO notes VALUES (3010, 1130, 't4');
+INSERT INTO notes VALUES (3011, 1743, 't5');
+INSERT INTO notes VALUES (3012, 2356, 't6');
+INSERT INTO notes VALUES (3013, 2969, 't7');
+INSERT INTO notes VALUES (3014, 3582, 't8');
+INSERT INTO notes VALUES (3015, 195, 't0');
+INSERT INTO notes VALUES (3016, 808, 't1');
+INSERT INTO notes VALUES (3017, 1421, 't2');
+INSERT INTO notes VALUES (3018, 2034, 't3');
+INSERT INTO notes VALUES (3019, 2647, 't4');
+INSERT INTO notes VALUES (3020, 3260, 't5');
+INSERT INTO notes VALUES (3021, 3873, 't6');
+INSERT INTO notes VALUES (3022, 486, 't7');
+INSERT INTO notes VALUES (3023, 1099, 't8');
+INSERT INTO notes VALUES (3024, 1712, 't0');
+INSERT INTO notes VALUES (3025, 2325, 't1');
+INSERT INTO notes VALUES (3026, 2938, 't2');
+INSERT INTO notes VALUES (3027, 3551, 't3');
+INSERT INTO notes VALUES (3028, 164, 't4');
+INSERT INTO notes VALUES (3029, 777, 't5');
+INSERT INTO notes VALUES (3030, 1390, 't6');
+INSERT INTO notes VALUES (3031, 2003, 't7');
+INSERT INTO notes VALUES (3032, 2616, 't8');
+INSERT INTO notes VALUES (3033, 3229, 't0');
+INSERT INTO notes VALUES (3034, 3842, 't1');
+INSERT INTO notes VALUES (3035, 455, 't2');
+INSERT INTO notes VALUES (3036, 1068, 't3');
+INSERT INTO notes VALUES (3037, 1681, 't4');
+INSERT INTO notes VALUES (3038, 2294, 't5');
+INSERT INTO notes VALUES (3039, 2907, 't6');
+INSERT INTO notes VALUES (3040, 3520, 't7');
+INSERT INTO notes VALUES (3041, 133, 't8');
+INSERT INTO notes VALUES (3042, 746, 't0');
+INSERT INTO notes VALUES (3043, 1359, 't1');
+INSERT INTO notes VALUES (3044, 1972, 't2');
+INSERT INTO notes VALUES (3045, 2585, 't3');
+INSERT INTO notes VALUES (3046, 3198, 't4');
+INSERT INTO notes VALUES (3047, 3811, 't5');
+INSERT INTO notes VALUES (3048, 424, 't6');
+INSERT INTO notes VALUES (3049, 1037, 't7');
+INSERT INTO notes VALUES (3050, 1650, 't8');
+INSERT INTO notes VALUES (3051, 2263, 't0');
+INSERT INTO notes VALUES (3052, 2876, 't1');
+INSERT INTO notes VALUES (3053, 3489, 't2');
+INSERT INTO notes VALUES (3054, 102, 't3');
+INSERT INTO notes VALUES (3055, 715, 't4');
+INSERT INTO notes VALUES (3056, 1328, 't5');
+INSERT INTO notes VALUES (3057, 1941, 't6');
+INSERT INTO notes VALUES (3058, 2554, 't7');
+INSERT INTO notes VALUES (3059, 3167, 't8');
+INSERT INTO notes VALUES (3060, 3780, 't0');
+INSERT INTO notes VALUES (3061, 393, 't1');
+INSERT INTO notes VALUES (3062, 1006, 't2');
+INSERT INTO notes VALUES (3063, 1619, 't3');
+INSERT INTO notes VALUES (3064, 2232, 't4');
+INSERT INTO notes VALUES (3065, 2845, 't5');
+INSERT INTO notes VALUES (3066, 3458, 't6');
+INSERT INTO notes VALUES (3067, 71, 't7');
+INSERT INTO notes VALUES (3068, 684, 't8');
+INSERT INTO notes VALUES (3069, 1297, 't0');
+INSERT INTO notes VALUES (3070, 1910, 't1');
+INSERT INTO notes VALUES (3071, 2523, 't2');
+INSERT INTO notes VALUES (3072, 3136, 't3');
+INSERT INTO notes VALUES (3073, 3749, 't4');
+INSERT INTO notes VALUES (3074, 362, 't5');
+INSERT INTO notes VALUES (3075, 975, 't6');
+INSERT INTO notes VALUES (3076, 1588, 't7');
+INSERT INTO notes VALUES (3077, 2201, 't8');
+INSERT INTO notes VALUES (3078, 2814, 't0');
+INSERT INTO notes VALUES (3079, 3427, 't1');
+INSERT INTO notes VALUES (3080, 40, 't2');
+INSERT INTO notes VALUES (3081, 653, 't3');
+INSERT INTO notes VALUES (3082, 1266, 't4');
+INSERT INTO notes VALUES (3083, 1879, 't5');
+INSERT INTO notes VALUES (3084, 2492, 't6');
+INSERT INTO notes VALUES (3085, 3105, 't7');
+INSERT INTO notes VALUES (3086, 3718, 't8');
+INSERT INTO notes VALUES (3087, 331, 't0');
+INSERT INTO notes VALUES (3088, 944, 't1');
+INSERT INTO notes VALUES (3089, 1557, 't2');
+INSERT INTO notes VALUES (3090, 2170, 't3');
+INSERT INTO notes VALUES (3091, 2783, 't4');
+INSERT INTO notes VALUES (3092, 3396, 't5');
+INSERT INTO notes VALUES (3093, 9, 't6');
+INSERT INTO notes VALUES (3094, 622, 't7');
+INSERT INTO notes VALUES (3095, 1235, 't8');
+INSERT INTO notes VALUES (3096, 1848, 't0');
+INSERT INTO notes VALUES (3097, 2461, 't1');
+INSERT INTO notes VALUES (3098, 3074, 't2');
+INSERT INTO notes VALUES (3099, 3687, 't3');
+INSERT INTO notes VALUES (3100, 300, 't4');
+INSERT INTO notes VALUES (3101, 913, 't5');
+INSERT INTO notes VALUES (3102, 1526, 't6');
+INSERT INTO notes VALUES (3103, 2139, 't7');
+INSERT INTO notes VALUES (3104, 2752, 't8');
+INSERT INTO notes VALUES (3105, 3365, 't0');
+INSERT INTO notes VALUES (3106, 3978, 't1');
+INSERT INTO notes VALUES (3107, 591, 't2');
+INSERT INTO notes VALUES (3108, 1204, 't3');
+INSERT INTO notes VALUES (3109, 1817, 't4');
+INSERT INTO notes VALUES (3110, 2430, 't5');
+INSERT INTO notes VALUES (3111, 3043, 't6');
+INSERT INTO notes VALUES (3112, 3656, 't7');
+INSERT INTO notes VALUES (3113, 269, 't8');
+INSERT INTO notes VALUES (3114, 882, 't0');
+INSERT INTO notes VALUES (3115, 1495, 't1');
+INSERT INTO notes VALUES (3116, 2108, 't2');
+INSERT INTO notes VALUES (3117, 2721, 't3');
+INSERT INTO notes VALUES (3118, 3334, 't4');
+INSERT INTO notes VALUES (3119, 3947, 't5');
+INSERT INTO notes VALUES (3120, 560, 't6');
+INSERT INTO notes VALUES (3121, 1173, 't7');
+INSERT INTO notes VALUES (3122, 1786, 't8');
+INSERT INTO notes VALUES (3123, 2399, 't0');
+INSERT INTO notes VALUES (3124, 3012, 't1');
+INSERT INTO notes VALUES (3125, 3625, 't2');
+INSERT INTO notes VALUES (3126, 238, 't3');
+INSERT INTO notes VALUES (3127, 851, 't4');
+INSERT INTO notes VALUES (3128, 1464, 't5');
+INSERT INTO notes VALUES (3129, 2077, 't6');
+INSERT INTO notes VALUES (3130, 2690, 't7');
+INSERT INTO notes VALUES (3131, 3303, 't8');
+INSERT INTO notes VALUES (3132, 3916, 't0');
+INSERT INTO notes VALUES (3133, 529, 't1');
+INSERT INTO notes VALUES (3134, 1142, 't2');
+INSERT INTO notes VALUES (3135, 1755, 't3');
+INSERT INTO notes VALUES (3136, 2368, 't4');
+INSERT INTO notes VALUES (3137, 2981, 't5');
+INSERT INTO notes VALUES (3138, 3594, 't6');
+INSERT INTO notes VALUES (3139, 207, 't7');
+INSERT INTO notes VALUES (3140, 820, 't8');
+INSERT INTO notes VALUES (3141, 1433, 't0');
+INSERT INTO notes VALUES (3142, 2046, 't1');
+INSERT INTO notes VALUES (3143, 2659, 't2');
+INSERT INTO notes VALUES (3144, 3272, 't3');
+INSERT INTO notes VALUES (3145, 3885, 't4');
+INSERT INTO notes VALUES (3146, 498, 't5');
+INSERT INTO notes VALUES (3147, 1111, 't6');
+INSERT INTO notes VALUES (3148, 1724, 't7');
+INSERT INTO notes VALUES (3149, 2337, 't8');
+INSERT INTO notes VALUES (3150, 2950, 't0');
+INSERT INTO notes VALUES (3151, 3563, 't1');
+INSERT INTO notes VALUES (3152, 176, 't2');
+INSERT INTO notes VALUES (3153, 789, 't3');
+INSERT INTO notes VALUES (3154, 1402, 't4');
+INSERT INTO notes VALUES (3155, 2015, 't5');
+INSERT INTO notes VALUES (3156, 2628, 't6');
+INSERT INTO notes VALUES (3157, 3241, 't7');
+INSERT INTO notes VALUES (3158, 3854, 't8');
+INSERT INTO notes VALUES (3159, 467, 't0');
+INSERT INTO notes VALUES (3160, 1080, 't1');
+INSERT INTO notes VALUES (3161, 1693, 't2');
+INSERT INTO notes VALUES (3162, 2306, 't3');
+INSERT INTO notes VALUES (3163, 2919, 't4');
+INSERT INTO notes VALUES (3164, 3532, 't5');
+INSERT INTO notes VALUES (3165, 145, 't6');
+INSERT INTO notes VALUES (3166, 758, 't7');
+INSERT INTO notes VALUES (3167, 1371, 't8');
+INSERT INTO notes VALUES (3168, 1984, 't0');
+INSERT INTO notes VALUES (3169, 2597, 't1');
+INSERT INTO notes VALUES (3170, 3210, 't2');
+INSERT INTO notes VALUES (3171, 3823, 't3');
+INSERT INTO notes VALUES (3172, 436, 't4');
+INSERT INTO notes VALUES (3173, 1049, 't5');
+INSERT INTO notes VALUES (3174, 1662, 't6');
+INSERT INTO notes VALUES (3175, 2275, 't7');
+INSERT INTO notes VALUES (3176, 2888, 't8');
+INSERT INTO notes VALUES (3177, 3501, 't0');
+INSERT INTO notes VALUES (3178, 114, 't1');
+INSERT INTO notes VALUES (3179, 727, 't2');
+INSERT INTO notes VALUES (3180, 1340, 't3');
+INSERT INTO notes VALUES (3181, 1953, 't4');
+INSERT INTO notes VALUES (3182, 2566, 't5');
+INSERT INTO notes VALUES (3183, 3179, 't6');
+INSERT INTO notes VALUES (3184, 3792, 't7');
+INSERT INTO notes VALUES (3185, 405, 't8');
+INSERT INTO notes VALUES (3186, 1018, 't0');
+INSERT INTO notes VALUES (3187, 1631, 't1');
+INSERT INTO notes VALUES (3188, 2244, 't2');
+INSERT INTO notes VALUES (3189, 2857, 't3');
+INSERT INTO notes VALUES (3190, 3470, 't4');
+INSERT INTO notes VALUES (3191, 83, 't5');
+INSERT INTO notes VALUES (3192, 696, 't6');
+INSERT INTO notes VALUES (3193, 1309, 't7');
+INSERT INTO notes VALUES (3194, 1922, 't8');
+INSERT INTO notes VALUES (3195, 2535, 't0');
+INSERT INTO notes VALUES (3196, 3148, 't1');
+INSERT INTO notes VALUES (3197, 3761, 't2');
+INSERT INTO notes VALUES (3198, 374, 't3');
+INSERT INTO notes VALUES (3199, 987, 't4');
+INSERT INTO notes VALUES (3200, 1600, 't5');
+INSERT INTO notes VALUES (3201, 2213, 't6');
+INSERT INTO notes VALUES (3202, 2826, 't7');
+INSERT INTO notes VALUES (3203, 3439, 't8');
+INSERT INTO notes VALUES (3204, 52, 't0');
+INSERT INTO notes VALUES (3205, 665, 't1');
+INSERT INTO notes VALUES (3206, 1278, 't2');
+INSERT INTO notes VALUES (3207, 1891, 't3');
+INSERT INTO notes VALUES (3208, 2504, 't4');
+INSERT INTO notes VALUES (3209, 3117, 't5');
+INSERT INTO notes VALUES (3210, 3730, 't6');
+INSERT INTO notes VALUES (3211, 343, 't7');
+INSERT INTO notes VALUES (3212, 956, 't8');
+INSERT INTO notes VALUES (3213, 1569, 't0');
+INSERT INTO notes VALUES (3214, 2182, 't1');
+INSERT INTO notes VALUES (3215, 2795, 't2');
+INSERT INTO notes VALUES (3216, 3408, 't3');
+INSERT INTO notes VALUES (3217, 21, 't4');
+INSERT INTO notes VALUES (3218, 634, 't5');
+INSERT INTO notes VALUES (3219, 1247, 't6');
+INSERT INTO notes VALUES (3220, 1860, 't7');
+INSERT INTO notes VALUES (3221, 2473, 't8');
+INSERT INTO notes VALUES (3222, 3086, 't0');
+INSERT INTO notes VALUES (3223, 3699, 't1');
+INSERT INTO notes VALUES (3224, 312, 't2');
+INSERT INTO notes VALUES (3225, 925, 't3');
+INSERT INTO notes VALUES (3226, 1538, 't4');
+INSERT INTO notes VALUES (3227, 2151, 't5');
+INSERT INTO notes VALUES (3228, 2764, 't6');
+INSERT INTO notes VALUES (3229, 3377, 't7');
+INSERT INTO notes VALUES (3230, 3990, 't8');
+INSERT INTO notes VALUES (3231, 603, 't0');
+INSERT INTO notes VALUES (3232, 1216, 't1');
+INSERT INTO notes VALUES (3233, 1829, 't2');
+INSERT INTO notes VALUES (3234, 2442, 't3');
+INSERT INTO notes VALUES (3235, 3055, 't4');
+INSERT INTO notes VALUES (3236, 3668, 't5');
+INSERT INTO notes VALUES (3237, 281, 't6');
+INSERT INTO notes VALUES (3238, 894, 't7');
+INSERT INTO notes VALUES (3239, 1507, 't8');
+INSERT INTO notes VALUES (3240, 2120, 't0');
+INSERT INTO notes VALUES (3241, 2733, 't1');
+INSERT INTO notes VALUES (3242, 3346, 't2');
+INSERT INTO notes VALUES (3243, 3959, 't3');
+INSERT INTO notes VALUES (3244, 572, 't4');
+INSERT INTO notes VALUES (3245, 1185, 't5');
+INSERT INTO notes VALUES (3246, 1798, 't6');
+INSERT INTO notes VALUES (3247, 2411, 't7');
+INSERT INTO notes VALUES (3248, 3024, 't8');
+INSERT INTO notes VALUES (3249, 3637, 't0');
+INSERT INTO notes VALUES (3250, 250, 't1');
+INSERT INTO notes VALUES (3251, 863, 't2');
+INSERT INTO notes VALUES (3252, 1476, 't3');
+INSERT INTO notes VALUES (3253, 2089, 't4');
+INSERT INTO notes VALUES (3254, 2702, 't5');
+INSERT INTO notes VALUES (3255, 3315, 't6');
+INSERT INTO notes VALUES (3256, 3928, 't7');
+INSERT INTO notes VALUES (3257, 541, 't8');
+INSERT INTO notes VALUES (3258, 1154, 't0');
+INSERT INTO notes VALUES (3259, 1767, 't1');
+INSERT INTO notes VALUES (3260, 2380, 't2');
+INSERT INTO notes VALUES (3261, 2993, 't3');
+INSERT INTO notes VALUES (3262, 3606, 't4');
+INSERT INTO notes VALUES (3263, 219, 't5');
+INSERT INTO notes VALUES (3264, 832, 't6');
+INSERT INTO notes VALUES (3265, 1445, 't7');
+INSERT INTO notes VALUES (3266, 2058, 't8');
+INSERT INTO notes VALUES (3267, 2671, 't0');
+INSERT INTO notes VALUES (3268, 3284, 't1');
+INSERT INTO notes VALUES (3269, 3897, 't2');
+INSERT INTO notes VALUES (3270, 510, 't3');
+INSERT INTO notes VALUES (3271, 1123, 't4');
+INSERT INTO notes VALUES (3272, 1736, 't5');
+INSERT INTO notes VALUES (3273, 2349, 't6');
+INSERT INTO notes VALUES (3274, 2962, 't7');
+INSERT INTO notes VALUES (3275, 3575, 't8');
+INSERT INTO notes VALUES (3276, 188, 't0');
+INSERT INTO notes VALUES (3277, 801, 't1');
+INSERT INTO notes VALUES (3278, 1414, 't2');
+INSERT INTO notes VALUES (3279, 2027, 't3');
+INSERT INTO notes VALUES (3280, 2640, 't4');
+INSERT INTO notes VALUES (3281, 3253, 't5');
+INSERT INTO notes VALUES (3282, 3866, 't6');
+INSERT INTO notes VALUES (3283, 479, 't7');
+INSERT INTO notes VALUES (3284, 1092, 't8');
+INSERT INTO notes VALUES (3285, 1705, 't0');
+INSERT INTO notes VALUES (3286, 2318, 't1');
+INSERT INTO notes VALUES (3287, 2931, 't2');
+INSERT INTO notes VALUES (3288, 3544, 't3');
+INSERT INTO notes VALUES (3289, 157, 't4');
+INSERT INTO notes VALUES (3290, 770, 't5');
+INSERT INTO notes VALUES (3291, 1383, 't6');
+INSERT INTO notes VALUES (3292, 1996, 't7');
+INSERT INTO notes VALUES (3293, 2609, 't8');
+INSERT INTO notes VALUES (3294, 3222, 't0');
+INSERT INTO notes VALUES (3295, 3835, 't1');
+INSERT INTO notes VALUES (3296, 448, 't2');
+INSERT INTO notes VALUES (3297, 1061, 't3');
+INSERT INTO notes VALUES (3298, 1674, 't4');
+INSERT INTO notes VALUES (3299, 2287, 't5');
+INSERT INTO notes VALUES (3300, 2900, 't6');
+INSERT INTO notes VALUES (3301, 3513, 't7');
+INSERT INTO notes VALUES (3302, 126, 't8');
+INSERT INTO notes VALUES (3303, 739, 't0');
+INSERT INTO notes VALUES (3304, 1352, 't1');
+INSERT INTO notes VALUES (3305, 1965, 't2');
+INSERT INTO notes VALUES (3306, 2578, 't3');
+INSERT INTO notes VALUES (3307, 3191, 't4');
+INSERT INTO notes VALUES (3308, 3804, 't5');
+INSERT INTO notes VALUES (3309, 417, 't6');
+INSERT INTO notes VALUES (3310, 1030, 't7');
+INSERT INTO notes VALUES (3311, 1643, 't8');
+INSERT INTO notes VALUES (3312, 2256, 't0');
+INSERT INTO notes VALUES (3313, 2869, 't1');
+INSERT INTO notes VALUES (3314, 3482, 't2');
+INSERT INTO notes VALUES (3315, 95, 't3');
+INSERT INTO notes VALUES (3316, 708, 't4');
+INSERT INTO notes VALUES (3317, 1321, 't5');
+INSERT INTO notes VALUES (3318, 1934, 't6');
+INSERT INTO notes VALUES (3319, 2547, 't7');
+INSERT INTO notes VALUES (3320, 3160, 't8');
+INSERT INTO notes VALUES (3321, 3773, 't0');
+INSERT INTO notes VALUES (3322, 386, 't1');
+INSERT INTO notes VALUES (3323, 999, 't2');
+INSERT INTO notes VALUES (3324, 1612, 't3');
+INSERT INTO notes VALUES (3325, 2225, 't4');
+INSERT INTO notes VALUES (3326, 2838, 't5');
+INSERT INTO notes VALUES (3327, 3451, 't6');
+INSERT INTO notes VALUES (3328, 64, 't7');
+INSERT INTO notes VALUES (3329, 677, 't8');
+INSERT INTO notes VALUES (3330, 1290, 't0');
+INSERT INTO notes VALUES (3331, 1903, 't1');
+INSERT INTO notes VALUES (3332, 2516, 't2');
+INSERT INTO notes VALUES (3333, 3129, 't3');
+INSERT INTO notes VALUES (3334, 3742, 't4');
+INSERT INTO notes VALUES (3335, 355, 't5');
+INSERT INTO notes VALUES (3336, 968, 't6');
+INSERT INTO notes VALUES (3337, 1581, 't7');
+INSERT INTO notes VALUES (3338, 2194, 't8');
+INSERT INTO notes VALUES (3339, 2807, 't0');
+INSERT INTO notes VALUES (3340, 3420, 't1');
+INSERT INTO notes VALUES (3341, 33, 't2');
+INSERT INTO notes VALUES (3342, 646, 't3');
+INSERT INTO notes VALUES (3343, 1259, 't4');
+INSERT INTO notes VALUES (3344, 1872, 't5');
+INSERT INTO notes VALUES (3345, 2485, 't6');
+INSERT INTO notes VALUES (3346, 3098, 't7');
+INSERT INTO notes VALUES (3347, 3711, 't8');
+INSERT INTO notes VALUES (3348, 324, 't0');
+INSERT INTO notes VALUES (3349, 937, 't1');
+INSERT INTO notes VALUES (3350, 1550, 't2');
+INSERT INTO notes VALUES (3351, 2163, 't3');
+INSERT INTO notes VALUES (3352, 2776, 't4');
+INSERT INTO notes VALUES (3353, 3389, 't5');
+INSERT INTO notes VALUES (3354, 2, 't6');
+INSERT INTO notes VALUES (3355, 615, 't7');
+INSERT INTO notes VALUES (3356, 1228, 't8');
+INSERT INTO notes VALUES (3357, 1841, 't0');
+INSERT INTO notes VALUES (3358, 2454, 't1');
+INSERT INTO notes VALUES (3359, 3067, 't2');
+INSERT INTO notes VALUES (3360, 3680, 't3');
+INSERT INTO notes VALUES (3361, 293, 't4');
+INSERT INTO notes VALUES (3362, 906, 't5');
+INSERT INTO notes VALUES (3363, 1519, 't6');
+INSERT INTO notes VALUES (3364, 2132, 't7');
+INSERT INTO notes VALUES (3365, 2745, 't8');
+INSERT INTO notes VALUES (3366, 3358, 't0');
+INSERT INTO notes VALUES (3367, 3971, 't1');
+INSERT INTO notes VALUES (3368, 584, 't2');
+INSERT INTO notes VALUES (3369, 1197, 't3');
+INSERT INTO notes VALUES (3370, 1810, 't4');
+INSERT INTO notes VALUES (3371, 2423, 't5');
+INSERT INTO notes VALUES (3372, 3036, 't6');
+INSERT INTO notes VALUES (3373, 3649, 't7');
+INSERT INTO notes VALUES (3374, 262, 't8');
+INSERT INTO notes VALUES (3375, 875, 't0');
+INSERT INTO notes VALUES (3376, 1488, 't1');
+INSERT INTO notes VALUES (3377, 2101, 't2');
+INSERT INTO notes VALUES (3378, 2714, 't3');
+INSERT INTO notes VALUES (3379, 3327, 't4');
+INSERT INTO notes VALUES (3380, 3940, 't5');
+INSERT INTO notes VALUES (3381, 553, 't6');
+INSERT INTO notes VALUES (3382, 1166, 't7');
+INSERT INTO notes VALUES (3383, 1779, 't8');
+INSERT INTO notes VALUES (3384, 2392, 't0');
+INSERT INTO notes VALUES (3385, 3005, 't1');
+INSERT INTO notes VALUES (3386, 3618, 't2');
+INSERT INTO notes VALUES (3387, 231, 't3');
+INSERT INTO notes VALUES (3388, 844, 't4');
+INSERT INTO notes VALUES (3389, 1457, 't5');
+INSERT INTO notes VALUES (3390, 2070, 't6');
+INSERT INTO notes VALUES (3391, 2683, 't7');
+INSERT INTO notes VALUES (3392, 3296, 't8');
+INSERT INTO notes VALUES (3393, 3909, 't0');
+INSERT INTO notes VALUES (3394, 522, 't1');
+INSERT INTO notes VALUES (3395, 1135, 't2');
+INSERT INTO notes VALUES (3396, 1748, 't3');
+INSERT INTO notes VALUES (3397, 2361, 't4');
+INSERT INTO notes VALUES (3398, 2974, 't5');
+INSERT INTO notes VALUES (3399, 3587, 't6');
+INSERT INTO notes VALUES (3400, 200, 't7');
+INSERT INTO notes VALUES (3401, 813, 't8');
+INSERT INTO notes VALUES (3402, 1426, 't0');
+INSERT INTO notes VALUES (3403, 2039, 't1');
+INSERT INTO notes VALUES (3404, 2652, 't2');
+INSERT INTO notes VALUES (3405, 3265, 't3');
+INSERT INTO notes VALUES (3406, 3878, 't4');
+INSERT INTO notes VALUES (3407, 491, 't5');
+INSERT INTO notes VALUES (3408, 1104, 't6');
+INSERT INTO notes VALUES (3409, 1717, 't7');
+INSERT INTO notes VALUES (3410, 2330, 't8');
+INSERT INTO notes VALUES (3411, 2943, 't0');
+INSERT INTO notes VALUES (3412, 3556, 't1');
+INSERT INTO notes VALUES (3413, 169, 't2');
+INSERT INTO notes VALUES (3414, 782, 't3');
+INSERT INTO notes VALUES (3415, 1395, 't4');
+INSERT INTO notes VALUES (3416, 2008, 't5');
+INSERT INTO notes VALUES (3417, 2621, 't6');
+INSERT INTO notes VALUES (3418, 3234, 't7');
+INSERT INTO notes VALUES (3419, 3847, 't8');
+INSERT INTO notes VALUES (3420, 460, 't0');
+INSERT INTO notes VALUES (3421, 1073, 't1');
+INSERT INTO notes VALUES (3422, 1686, 't2');
+INSERT INTO notes VALUES (3423, 2299, 't3');
+INSERT INTO notes VALUES (3424, 2912, 't4');
+INSERT INTO notes VALUES (3425, 3525, 't5');
+INSERT INTO notes VALUES (3426, 138, 't6');
+INSERT INTO notes VALUES (3427, 751, 't7');
+INSERT INTO notes VALUES (3428, 1364, 't8');
+INSERT INTO notes VALUES (3429, 1977, 't0');
+INSERT INTO notes VALUES (3430, 2590, 't1');
+INSERT INTO notes VALUES (3431, 3203, 't2');
+INSERT INTO notes VALUES (3432, 3816, 't3');
+INSERT INTO notes VALUES (3433, 429, 't4');
+INSERT INTO notes VALUES (3434, 1042, 't5');
+INSERT INTO notes VALUES (3435, 1655, 't6');
+INSERT INTO notes VALUES (3436, 2268, 't7');
+INSERT INTO notes VALUES (3437, 2881, 't8');
+INSERT INTO notes VALUES (3438, 3494, 't0');
+INSERT INTO notes VALUES (3439, 107, 't1');
+INSERT INTO notes VALUES (3440, 720, 't2');
+INSERT INTO notes VALUES (3441, 1333, 't3');
+INSERT INTO notes VALUES (3442, 1946, 't4');
+INSERT INTO notes VALUES (3443, 2559, 't5');
+INSERT INTO notes VALUES (3444, 3172, 't6');
+INSERT INTO notes VALUES (3445, 3785, 't7');
+INSERT INTO notes VALUES (3446, 398, 't8');
+INSERT INTO notes VALUES (3447, 1011, 't0');
+INSERT INTO notes VALUES (3448, 1624, 't1');
+INSERT INTO notes VALUES (3449, 2237, 't2');
+INSERT INTO notes VALUES (3450, 2850, 't3');
+INSERT INTO notes VALUES (3451, 3463, 't4');
+INSERT INTO notes VALUES (3452, 76, 't5');
+INSERT INTO notes VALUES (3453, 689, 't6');
+INSERT INTO notes VALUES (3454, 1302, 't7');
+INSERT INTO notes VALUES (3455, 1915, 't8');
+INSERT INTO notes VALUES (3456, 2528, 't0');
+INSERT INTO notes VALUES (3457, 3141, 't1');
+INSERT INTO notes VALUES (3458, 3754, 't2');
+INSERT INTO notes VALUES (3459, 367, 't3');
+INSERT INTO notes VALUES (3460, 980, 't4');
+INSERT INTO notes VALUES (3461, 1593, 't5');
+INSERT INTO notes VALUES (3462, 2206, 't6');
+INSERT INTO notes VALUES (3463, 2819, 't7');
+INSERT INTO notes VALUES (3464, 3432, 't8');
+INSERT INTO notes VALUES (3465, 45, 't0');
+INSERT INTO notes VALUES (3466, 658, 't1');
+INSERT INTO notes VALUES (3467, 1271, 't2');
+INSERT INTO notes VALUES (3468, 1884, 't3');
+INSERT INTO notes VALUES (3469, 2497, 't4');
+INSERT INTO notes VALUES (3470, 3110, 't5');
+INSERT INTO notes VALUES (3471, 3723, 't6');
+INSERT INTO notes VALUES (3472, 336, 't7');
+INSERT INTO notes VALUES (3473, 949, 't8');
+INSERT INTO notes VALUES (3474, 1562, 't0');
+INSERT INTO notes VALUES (3475, 2175, 't1');
+INSERT INTO notes VALUES (3476, 2788, 't2');
+INSERT INTO notes VALUES (3477, 3401, 't3');
+INSERT INTO notes VALUES (3478, 14, 't4');
+INSERT INTO notes VALUES (3479, 627, 't5');
+INSERT INTO notes VALUES (3480, 1240, 't6');
+INSERT INTO notes VALUES (3481, 1853, 't7');
+INSERT INTO notes VALUES (3482, 2466, 't8');
+INSERT INTO notes VALUES (3483, 3079, 't0');
+INSERT INTO notes VALUES (3484, 3692, 't1');
+INSERT INTO notes VALUES (3485, 305, 't2');
+INSERT INTO notes VALUES (3486, 918, 't3');
+INSERT INTO notes VALUES (3487, 1531, 't4');
+INSERT INTO notes VALUES (3488, 2144, 't5');
+INSERT INTO notes VALUES (3489, 2757, 't6');
+INSERT INTO notes VALUES (3490, 3370, 't7');
+INSERT INTO notes VALUES (3491, 3983, 't8');
+INSERT INTO notes VALUES (3492, 596, 't0');
+INSERT INTO notes VALUES (3493, 1209, 't1');
+INSERT INTO notes VALUES (3494, 1822, 't2');
+INSERT INTO notes VALUES (3495, 2435, 't3');
+INSERT INTO notes VALUES (3496, 3048, 't4');
+INSERT INTO notes VALUES (3497, 3661, 't5');
+INSERT INTO notes VALUES (3498, 274, 't6');
+INSERT INTO notes VALUES (3499, 887, 't7');
+INSERT INTO notes VALUES (3500, 1500, 't8');
+INSERT INTO notes VALUES (3501, 2113, 't0');
+INSERT INTO notes VALUES (3502, 2726, 't1');
+INSERT INTO notes VALUES (3503, 3339, 't2');
+INSERT INTO notes VALUES (3504, 3952, 't3');
+INSERT INTO notes VALUES (3505, 565, 't4');
+INSERT INTO notes VALUES (3506, 1178, 't5');
+INSERT INTO notes VALUES (3507, 1791, 't6');
+INSERT INTO notes VALUES (3508, 2404, 't7');
+INSERT INTO notes VALUES (3509, 3017, 't8');
+INSERT INTO notes VALUES (3510, 3630, 't0');
+INSERT INTO notes VALUES (3511, 243, 't1');
+INSERT INTO notes VALUES (3512, 856, 't2');
+INSERT INTO notes VALUES (3513, 1469, 't3');
+INSERT INTO notes VALUES (3514, 2082, 't4');
+INSERT INTO notes VALUES (3515, 2695, 't5');
+INSERT INTO notes VALUES (3516, 3308, 't6');
+INSERT INTO notes VALUES (3517, 3921, 't7');
+INSERT INTO notes VALUES (3518, 534, 't8');
+INSERT INTO notes VALUES (3519, 1147, 't0');
+INSERT INTO notes VALUES (3520, 1760, 't1');
+INSERT INTO notes VALUES (3521, 2373, 't2');
+INSERT INTO notes VALUES (3522, 2986, 't3');
+INSERT INTO notes VALUES (3523, 3599, 't4');
+INSERT INTO notes VALUES (3524, 212, 't5');
+INSERT INTO notes VALUES (3525, 825, 't6');
+INSERT INTO notes VALUES (3526, 1438, 't7');
+INSERT INTO notes VALUES (3527, 2051, 't8');
+INSERT INTO notes VALUES (3528, 2664, 't0');
+INSERT INTO notes VALUES (3529, 3277, 't1');
+INSERT INTO notes VALUES (3530, 3890, 't2');
+INSERT INTO notes VALUES (3531, 503, 't3');
+INSERT INTO notes VALUES (3532, 1116, 't4');
+INSERT INTO notes VALUES (3533, 1729, 't5');
+INSERT INTO notes VALUES (3534, 2342, 't6');
+INSERT INTO notes VALUES (3535, 2955, 't7');
+INSERT INTO notes VALUES (3536, 3568, 't8');
+INSERT INTO notes VALUES (3537, 181, 't0');
+INSERT INTO notes VALUES (3538, 794, 't1');
+INSERT INTO notes VALUES (3539, 1407, 't2');
+INSERT INTO notes VALUES (3540, 2020, 't3');
+INSERT INTO notes VALUES (3541, 2633, 't4');
+INSERT INTO notes VALUES (3542, 3246, 't5');
+INSERT INTO notes VALUES (3543, 3859, 't6');
+INSERT INTO notes VALUES (3544, 472, 't7');
+INSERT INTO notes VALUES (3545, 1085, 't8');
+INSERT INTO notes VALUES (3546, 1698, 't0');
+INSERT INTO notes VALUES (3547, 2311, 't1');
+INSERT INTO notes VALUES (3548, 2924, 't2');
+INSERT INTO notes VALUES (3549, 3537, 't3');
+INSERT INTO notes VALUES (3550, 150, 't4');
+INSERT INTO notes VALUES (3551, 763, 't5');
+INSERT INTO notes VALUES (3552, 1376, 't6');
+INSERT INTO notes VALUES (3553, 1989, 't7');
+INSERT INTO notes VALUES (3554, 2602, 't8');
+INSERT INTO notes VALUES (3555, 3215, 't0');
+INSERT INTO notes VALUES (3556, 3828, 't1');
+INSERT INTO notes VALUES (3557, 441, 't2');
+INSERT INTO notes VALUES (3558, 1054, 't3');
+INSERT INTO notes VALUES (3559, 1667, 't4');
+INSERT INTO notes VALUES (3560, 2280, 't5');
+INSERT INTO notes VALUES (3561, 2893, 't6');
+INSERT INTO notes VALUES (3562, 3506, 't7');
+INSERT INTO notes VALUES (3563, 119, 't8');
+INSERT INTO notes VALUES (3564, 732, 't0');
+INSERT INTO notes VALUES (3565, 1345, 't1');
+INSERT INTO notes VALUES (3566, 1958, 't2');
+INSERT INTO notes VALUES (3567, 2571, 't3');
+INSERT INTO notes VALUES (3568, 3184, 't4');
+INSERT INTO notes VALUES (3569, 3797, 't5');
+INSERT INTO notes VALUES (3570, 410, 't6');
+INSERT INTO notes VALUES (3571, 1023, 't7');
+INSERT INTO notes VALUES (3572, 1636, 't8');
+INSERT INTO notes VALUES (3573, 2249, 't0');
+INSERT INTO notes VALUES (3574, 2862, 't1');
+INSERT INTO notes VALUES (3575, 3475, 't2');
+INSERT INTO notes VALUES (3576, 88, 't3');
+INSERT INTO notes VALUES (3577, 701, 't4');
+INSERT INTO notes VALUES (3578, 1314, 't5');
+INSERT INTO notes VALUES (3579, 1927, 't6');
+INSERT INTO notes VALUES (3580, 2540, 't7');
+INSERT INTO notes VALUES (3581, 3153, 't8');
+INSERT INTO notes VALUES (3582, 3766, 't0');
+INSERT INTO notes VALUES (3583, 379, 't1');
+INSERT INTO notes VALUES (3584, 992, 't2');
+INSERT INTO notes VALUES (3585, 1605, 't3');
+INSERT INTO notes VALUES (3586, 2218, 't4');
+INSERT INTO notes VALUES (3587, 2831, 't5');
+INSERT INTO notes VALUES (3588, 3444, 't6');
+INSERT INTO notes VALUES (3589, 57, 't7');
+INSERT INTO notes VALUES (3590, 670, 't8');
+INSERT INTO notes VALUES (3591, 1283, 't0');
+INSERT INTO notes VALUES (3592, 1896, 't1');
+INSERT INTO notes VALUES (3593, 2509, 't2');
+INSERT INTO notes VALUES (3594, 3122, 't3');
+INSERT INTO notes VALUES (3595, 3735, 't4');
+INSERT INTO notes VALUES (3596, 348, 't5');
+INSERT INTO notes VALUES (3597, 961, 't6');
+INSERT INTO notes VALUES (3598, 1574, 't7');
+INSERT INTO notes VALUES (3599, 2187, 't8');
+INSERT INTO notes VALUES (3600, 2800, 't0');
+INSERT INTO notes VALUES (3601, 3413, 't1');
+INSERT INTO notes VALUES (3602, 26, 't2');
+INSERT INTO notes VALUES (3603, 639, 't3');
+INSERT INTO notes VALUES (3604, 1252, 't4');
+INSERT INTO notes VALUES (3605, 1865, 't5');
+INSERT INTO notes VALUES (3606, 2478, 't6');
+INSERT INTO notes VALUES (3607, 3091, 't7');
+INSERT INTO notes VALUES (3608, 3704, 't8');
+INSERT INTO notes VALUES (3609, 317, 't0');
+INSERT INTO notes VALUES (3610, 930, 't1');
+INSERT INTO notes VALUES (3611, 1543, 't2');
+INSERT INTO notes VALUES (3612, 2156, 't3');
+INSERT INTO notes VALUES (3613, 2769, 't4');
+INSERT INTO notes VALUES (3614, 3382, 't5');
+INSERT INTO notes VALUES (3615, 3995, 't6');
+INSERT INTO notes VALUES (3616, 608, 't7');
+INSERT INTO notes VALUES (3617, 1221, 't8');
+INSERT INTO notes VALUES (3618, 1834, 't0');
+INSERT INTO notes VALUES (3619, 2447, 't1');
+INSERT INTO notes VALUES (3620, 3060, 't2');
+INSERT INTO notes VALUES (3621, 3673, 't3');
+INSERT INTO notes VALUES (3622, 286, 't4');
+INSERT INTO notes VALUES (3623, 899, 't5');
+INSERT INTO notes VALUES (3624, 1512, 't6');
+INSERT INTO notes VALUES (3625, 2125, 't7');
+INSERT INTO notes VALUES (3626, 2738, 't8');
+INSERT INTO notes VALUES (3627, 3351, 't0');
+INSERT INTO notes VALUES (3628, 3964, 't1');
+INSERT INTO notes VALUES (3629, 577, 't2');
+INSERT INTO notes VALUES (3630, 1190, 't3');
+INSERT INTO notes VALUES (3631, 1803, 't4');
+INSERT INTO notes VALUES (3632, 2416, 't5');
+INSERT INTO notes VALUES (3633, 3029, 't6');
+INSERT INTO notes VALUES (3634, 3642, 't7');
+INSERT INTO notes VALUES (3635, 255, 't8');
+INSERT INTO notes VALUES (3636, 868, 't0');
+INSERT INTO notes VALUES (3637, 1481, 't1');
+INSERT INTO notes VALUES (3638, 2094, 't2');
+INSERT INTO notes VALUES (3639, 2707, 't3');
+INSERT INTO notes VALUES (3640, 3320, 't4');
+INSERT INTO notes VALUES (3641, 3933, 't5');
+INSERT INTO notes VALUES (3642, 546, 't6');
+INSERT INTO notes VALUES (3643, 1159, 't7');
+INSERT INTO notes VALUES (3644, 1772, 't8');
+INSERT INTO notes VALUES (3645, 2385, 't0');
+INSERT INTO notes VALUES (3646, 2998, 't1');
+INSERT INTO notes VALUES (3647, 3611, 't2');
+INSERT INTO notes VALUES (3648, 224, 't3');
+INSERT INTO notes VALUES (3649, 837, 't4');
+INSERT INTO notes VALUES (3650, 1450, 't5');
+INSERT INTO notes VALUES (3651, 2063, 't6');
+INSERT INTO notes VALUES (3652, 2676, 't7');
+INSERT INTO notes VALUES (3653, 3289, 't8');
+INSERT INTO notes VALUES (3654, 3902, 't0');
+INSERT INTO notes VALUES (3655, 515, 't1');
+INSERT INTO notes VALUES (3656, 1128, 't2');
+INSERT INTO notes VALUES (3657, 1741, 't3');
+INSERT INTO notes VALUES (3658, 2354, 't4');
+INSERT INTO notes VALUES (3659, 2967, 't5');
+INSERT INTO notes VALUES (3660, 3580, 't6');
+INSERT INTO notes VALUES (3661, 193, 't7');
+INSERT INTO notes VALUES (3662, 806, 't8');
+INSERT INTO notes VALUES (3663, 1419, 't0');
+INSERT INTO notes VALUES (3664, 2032, 't1');
+INSERT INTO notes VALUES (3665, 2645, 't2');
+INSERT INTO notes VALUES (3666, 3258, 't3');
+INSERT INTO notes VALUES (3667, 3871, 't4');
+INSERT INTO notes VALUES (3668, 484, 't5');
+INSERT INTO notes VALUES (3669, 1097, 't6');
+INSERT INTO notes VALUES (3670, 1710, 't7');
+INSERT INTO notes VALUES (3671, 2323, 't8');
+INSERT INTO notes VALUES (3672, 2936, 't0');
+INSERT INTO notes VALUES (3673, 3549, 't1');
+INSERT INTO notes VALUES (3674, 162, 't2');
+INSERT INTO notes VALUES (3675, 775, 't3');
+INSERT INTO notes VALUES (3676, 1388, 't4');
+INSERT INTO notes VALUES (3677, 2001, 't5');
+INSERT INTO notes VALUES (3678, 2614, 't6');
+INSERT INTO notes VALUES (3679, 3227, 't7');
+INSERT INTO notes VALUES (3680, 3840, 't8');
+INSERT INTO notes VALUES (3681, 453, 't0');
+INSERT INTO notes VALUES (3682, 1066, 't1');
+INSERT INTO notes VALUES (3683, 1679, 't2');
+INSERT INTO notes VALUES (3684, 2292, 't3');
+INSERT INTO notes VALUES (3685, 2905, 't4');
+INSERT INTO notes VALUES (3686, 3518, 't5');
+INSERT INTO notes VALUES (3687, 131, 't6');
+INSERT INTO notes VALUES (3688, 744, 't7');
+INSERT INTO notes VALUES (3689, 1357, 't8');
+INSERT INTO notes VALUES (3690, 1970, 't0');
+INSERT INTO notes VALUES (3691, 2583, 't1');
+INSERT INTO notes VALUES (3692, 3196, 't2');
+INSERT INTO notes VALUES (3693, 3809, 't3');
+INSERT INTO notes VALUES (3694, 422, 't4');
+INSERT INTO notes VALUES (3695, 1035, 't5');
+INSERT INTO notes VALUES (3696, 1648, 't6');
+INSERT INTO notes VALUES (3697, 2261, 't7');
+INSERT INTO notes VALUES (3698, 2874, 't8');
+INSERT INTO notes VALUES (3699, 3487, 't0');
+INSERT INTO notes VALUES (3700, 100, 't1');
+INSERT INTO notes VALUES (3701, 713, 't2');
+INSERT INTO notes VALUES (3702, 1326, 't3');
+INSERT INTO notes VALUES (3703, 1939, 't4');
+INSERT INTO notes VALUES (3704, 2552, 't5');
+INSERT INTO notes VALUES (3705, 3165, 't6');
+INSERT INTO notes VALUES (3706, 3778, 't7');
+INSERT INTO notes VALUES (3707, 391, 't8');
+INSERT INTO notes VALUES (3708, 1004, 't0');
+INSERT INTO notes VALUES (3709, 1617, 't1');
+INSERT INTO notes VALUES (3710, 2230, 't2');
+INSERT INTO notes VALUES (3711, 2843, 't3');
+INSERT INTO notes VALUES (3712, 3456, 't4');
+INSERT INTO notes VALUES (3713, 69, 't5');
+INSERT INTO notes VALUES (3714, 682, 't6');
+INSERT INTO notes VALUES (3715, 1295, 't7');
+INSERT INTO notes VALUES (3716, 1908, 't8');
+INSERT INTO notes VALUES (3717, 2521, 't0');
+INSERT INTO notes VALUES (3718, 3134, 't1');
+INSERT INTO notes VALUES (3719, 3747, 't2');
+INSERT INTO notes VALUES (3720, 360, 't3');
+INSERT INTO notes VALUES (3721, 973, 't4');
+INSERT INTO notes VALUES (3722, 1586, 't5');
+INSERT INTO notes VALUES (3723, 2199, 't6');
+INSERT INTO notes VALUES (3724, 2812, 't7');
+INSERT INTO notes VALUES (3725, 3425, 't8');
+INSERT INTO notes VALUES (3726, 38, 't0');
+INSERT INTO notes VALUES (3727, 651, 't1');
+INSERT INTO notes VALUES (3728, 1264, 't2');
+INSERT INTO notes VALUES (3729, 1877, 't3');
+INSERT INTO notes VALUES (3730, 2490, 't4');
+INSERT INTO notes VALUES (3731, 3103, 't5');
+INSERT INTO notes VALUES (3732, 3716, 't6');
+INSERT INTO notes VALUES (3733, 329, 't7');
+INSERT INTO notes VALUES (3734, 942, 't8');
+INSERT INTO notes VALUES (3735, 1555, 't0');
+INSERT INTO notes VALUES (3736, 2168, 't1');
+INSERT INTO notes VALUES (3737, 2781, 't2');
+INSERT INTO notes VALUES (3738, 3394, 't3');
+INSERT INTO notes VALUES (3739, 7, 't4');
+INSERT INTO notes VALUES (3740, 620, 't5');
+INSERT INTO notes VALUES (3741, 1233, 't6');
+INSERT INTO notes VALUES (3742, 1846, 't7');
+INSERT INTO notes VALUES (3743, 2459, 't8');
+INSERT INTO notes VALUES (3744, 3072, 't0');
+INSERT INTO notes VALUES (3745, 3685, 't1');
+INSERT INTO notes VALUES (3746, 298, 't2');
+INSERT INTO notes VALUES (3747, 911, 't3');
+INSERT INTO notes VALUES (3748, 1524, 't4');
+INSERT INTO notes VALUES (3749, 2137, 't5');
+INSERT INTO notes VALUES (3750, 2750, 't6');
+INSERT INTO notes VALUES (3751, 3363, 't7');
+INSERT INTO notes VALUES (3752, 3976, 't8');
+INSERT INTO notes VALUES (3753, 589, 't0');
+INSERT INTO notes VALUES (3754, 1202, 't1');
+INSERT INTO notes VALUES (3755, 1815, 't2');
+INSERT INTO notes VALUES (3756, 2428, 't3');
+INSERT INTO notes VALUES (3757, 3041, 't4');
+INSERT INTO notes VALUES (3758, 3654, 't5');
+INSERT INTO notes VALUES (3759, 267, 't6');
+INSERT INTO notes VALUES (3760, 880, 't7');
+INSERT INTO notes VALUES (3761, 1493, 't8');
+INSERT INTO notes VALUES (3762, 2106, 't0');
+INSERT INTO notes VALUES (3763, 2719, 't1');
+INSERT INTO notes VALUES (3764, 3332, 't2');
+INSERT INTO notes VALUES (3765, 3945, 't3');
+INSERT INTO notes VALUES (3766, 558, 't4');
+INSERT INTO notes VALUES (3767, 1171, 't5');
+INSERT INTO notes VALUES (3768, 1784, 't6');
+INSERT INTO notes VALUES (3769, 2397, 't7');
+INSERT INTO notes VALUES (3770, 3010, 't8');
+INSERT INTO notes VALUES (3771, 3623, 't0');
+INSERT INTO notes VALUES (3772, 236, 't1');
+INSERT INTO notes VALUES (3773, 849, 't2');
+INSERT INTO notes VALUES (3774, 1462, 't3');
+INSERT INTO notes VALUES (3775, 2075, 't4');
+INSERT INTO notes VALUES (3776, 2688, 't5');
+INSERT INTO notes VALUES (3777, 3301, 't6');
+INSERT INTO notes VALUES (3778, 3914, 't7');
+INSERT INTO notes VALUES (3779, 527, 't8');
+INSERT INTO notes VALUES (3780, 1140, 't0');
+INSERT INTO notes VALUES (3781, 1753, 't1');
+INSERT INTO notes VALUES (3782, 2366, 't2');
+INSERT INTO notes VALUES (3783, 2979, 't3');
+INSERT INTO notes VALUES (3784, 3592, 't4');
+INSERT INTO notes VALUES (3785, 205, 't5');
+INSERT INTO notes VALUES (3786, 818, 't6');
+INSERT INTO notes VALUES (3787, 1431, 't7');
+INSERT INTO notes VALUES (3788, 2044, 't8');
+INSERT INTO notes VALUES (3789, 2657, 't0');
+INSERT INTO notes VALUES (3790, 3270, 't1');
+INSERT INTO notes VALUES (3791, 3883, 't2');
+INSERT INTO notes VALUES (3792, 496, 't3');
+INSERT INTO notes VALUES (3793, 1109, 't4');
+INSERT INTO notes VALUES (3794, 1722, 't5');
+INSERT INTO notes VALUES (3795, 2335, 't6');
+INSERT INTO notes VALUES (3796, 2948, 't7');
+INSERT INTO notes VALUES (3797, 3561, 't8');
+INSERT INTO notes VALUES (3798, 174, 't0');
+INSERT INTO notes VALUES (3799, 787, 't1');
+INSERT INTO notes VALUES (3800, 1400, 't2');
+INSERT INTO notes VALUES (3801, 2013, 't3');
+INSERT INTO notes VALUES (3802, 2626, 't4');
+INSERT INTO notes VALUES (3803, 3239, 't5');
+INSERT INTO notes VALUES (3804, 3852, 't6');
+INSERT INTO notes VALUES (3805, 465, 't7');
+INSERT INTO notes VALUES (3806, 1078, 't8');
+INSERT INTO notes VALUES (3807, 1691, 't0');
+INSERT INTO notes VALUES (3808, 2304, 't1');
+INSERT INTO notes VALUES (3809, 2917, 't2');
+INSERT INTO notes VALUES (3810, 3530, 't3');
+INSERT INTO notes VALUES (3811, 143, 't4');
+INSERT INTO notes VALUES (3812, 756, 't5');
+INSERT INTO notes VALUES (3813, 1369, 't6');
+INSERT INTO notes VALUES (3814, 1982, 't7');
+INSERT INTO notes VALUES (3815, 2595, 't8');
+INSERT INTO notes VALUES (3816, 3208, 't0');
+INSERT INTO notes VALUES (3817, 3821, 't1');
+INSERT INTO notes VALUES (3818, 434, 't2');
+INSERT INTO notes VALUES (3819, 1047, 't3');
+INSERT INTO notes VALUES (3820, 1660, 't4');
+INSERT INTO notes VALUES (3821, 2273, 't5');
+INSERT INTO notes VALUES (3822, 2886, 't6');
+INSERT INTO notes VALUES (3823, 3499, 't7');
+INSERT INTO notes VALUES (3824, 112, 't8');
+INSERT INTO notes VALUES (3825, 725, 't0');
+INSERT INTO notes VALUES (3826, 1338, 't1');
+INSERT INTO notes VALUES (3827, 1951, 't2');
+INSERT INTO notes VALUES (3828, 2564, 't3');
+INSERT INTO notes VALUES (3829, 3177, 't4');
+INSERT INTO notes VALUES (3830, 3790, 't5');
+INSERT INTO notes VALUES (3831, 403, 't6');
+INSERT INTO notes VALUES (3832, 1016, 't7');
+INSERT INTO notes VALUES (3833, 1629, 't8');
+INSERT INTO notes VALUES (3834, 2242, 't0');
+INSERT INTO notes VALUES (3835, 2855, 't1');
+INSERT INTO notes VALUES (3836, 3468, 't2');
+INSERT INTO notes VALUES (3837, 81, 't3');
+INSERT INTO notes VALUES (3838, 694, 't4');
+INSERT INTO notes VALUES (3839, 1307, 't5');
+INSERT INTO notes VALUES (3840, 1920, 't6');
+INSERT INTO notes VALUES (3841, 2533, 't7');
+INSERT INTO notes VALUES (3842, 3146, 't8');
+INSERT INTO notes VALUES (3843, 3759, 't0');
+INSERT INTO notes VALUES (3844, 372, 't1');
+INSERT INTO notes VALUES (3845, 985, 't2');
+INSERT INTO notes VALUES (3846, 1598, 't3');
+INSERT INTO notes VALUES (3847, 2211, 't4');
+INSERT INTO notes VALUES (3848, 2824, 't5');
+INSERT INTO notes VALUES (3849, 3437, 't6');
+INSERT INTO notes VALUES (3850, 50, 't7');
+INSERT INTO notes VALUES (3851, 663, 't8');
+INSERT INTO notes VALUES (3852, 1276, 't0');
+INSERT INTO notes VALUES (3853, 1889, 't1');
+INSERT INTO notes VALUES (3854, 2502, 't2');
+INSERT INTO notes VALUES (3855, 3115, 't3');
+INSERT INTO notes VALUES (3856, 3728, 't4');
+INSERT INTO notes VALUES (3857, 341, 't5');
+INSERT INTO notes VALUES (3858, 954, 't6');
+INSERT INTO notes VALUES (3859, 1567, 't7');
+INSERT INTO notes VALUES (3860, 2180, 't8');
+INSERT INTO notes VALUES (3861, 2793, 't0');
+INSERT INTO notes VALUES (3862, 3406, 't1');
+INSERT INTO notes VALUES (3863, 19, 't2');
+INSERT INTO notes VALUES (3864, 632, 't3');
+INSERT INTO notes VALUES (3865, 1245, 't4');
+INSERT INTO notes VALUES (3866, 1858, 't5');
+INSERT INTO notes VALUES (3867, 2471, 't6');
+INSERT INTO notes VALUES (3868, 3084, 't7');
+INSERT INTO notes VALUES (3869, 3697, 't8');
+INSERT INTO notes VALUES (3870, 310, 't0');
+INSERT INTO notes VALUES (3871, 923, 't1');
+INSERT INTO notes VALUES (3872, 1536, 't2');
+INSERT INTO notes VALUES (3873, 2149, 't3');
+INSERT INTO notes VALUES (3874, 2762, 't4');
+INSERT INTO notes VALUES (3875, 3375, 't5');
+INSERT INTO notes VALUES (3876, 3988, 't6');
+INSERT INTO notes VALUES (3877, 601, 't7');
+INSERT INTO notes VALUES (3878, 1214, 't8');
+INSERT INTO notes VALUES (3879, 1827, 't0');
+INSERT INTO notes VALUES (3880, 2440, 't1');
+INSERT INTO notes VALUES (3881, 3053, 't2');
+INSERT INTO notes VALUES (3882, 3666, 't3');
+INSERT INTO notes VALUES (3883, 279, 't4');
+INSERT INTO notes VALUES (3884, 892, 't5');
+INSERT INTO notes VALUES (3885, 1505, 't6');
+INSERT INTO notes VALUES (3886, 2118, 't7');
+INSERT INTO notes VALUES (3887, 2731, 't8');
+INSERT INTO notes VALUES (3888, 3344, 't0');
+INSERT INTO notes VALUES (3889, 3957, 't1');
+INSERT INTO notes VALUES (3890, 570, 't2');
+INSERT INTO notes VALUES (3891, 1183, 't3');
+INSERT INTO notes VALUES (3892, 1796, 't4');
+INSERT INTO notes VALUES (3893, 2409, 't5');
+INSERT INTO notes VALUES (3894, 3022, 't6');
+INSERT INTO notes VALUES (3895, 3635, 't7');
+INSERT INTO notes VALUES (3896, 248, 't8');
+INSERT INTO notes VALUES (3897, 861, 't0');
+INSERT INTO notes VALUES (3898, 1474, 't1');
+INSERT INTO notes VALUES (3899, 2087, 't2');
+INSERT INTO notes VALUES (3900, 2700, 't3');
+INSERT INTO notes VALUES (3901, 3313, 't4');
+INSERT INTO notes VALUES (3902, 3926, 't5');
+INSERT INTO notes VALUES (3903, 539, 't6');
+INSERT INTO notes VALUES (3904, 1152, 't7');
+INSERT INTO notes VALUES (3905, 1765, 't8');
+INSERT INTO notes VALUES (3906, 2378, 't0');
+INSERT INTO notes VALUES (3907, 2991, 't1');
+INSERT INTO notes VALUES (3908, 3604, 't2');
+INSERT INTO notes VALUES (3909, 217, 't3');
+INSERT INTO notes VALUES (3910, 830, 't4');
+INSERT INTO notes VALUES (3911, 1443, 't5');
+INSERT INTO notes VALUES (3912, 2056, 't6');
+INSERT INTO notes VALUES (3913, 2669, 't7');
+INSERT INTO notes VALUES (3914, 3282, 't8');
+INSERT INTO notes VALUES (3915, 3895, 't0');
+INSERT INTO notes VALUES (3916, 508, 't1');
+INSERT INTO notes VALUES (3917, 1121, 't2');
+INSERT INTO notes VALUES (3918, 1734, 't3');
+INSERT INTO notes VALUES (3919, 2347, 't4');
+INSERT INTO notes VALUES (3920, 2960, 't5');
+INSERT INTO notes VALUES (3921, 3573, 't6');
+INSERT INTO notes VALUES (3922, 186, 't7');
+INSERT INTO notes VALUES (3923, 799, 't8');
+INSERT INTO notes VALUES (3924, 1412, 't0');
+INSERT INTO notes VALUES (3925, 2025, 't1');
+INSERT INTO notes VALUES (3926, 2638, 't2');
+INSERT INTO notes VALUES (3927, 3251, 't3');
+INSERT INTO notes VALUES (3928, 3864, 't4');
+INSERT INTO notes VALUES (3929, 477, 't5');
+INSERT INTO notes VALUES (3930, 1090, 't6');
+INSERT INTO notes VALUES (3931, 1703, 't7');
+INSERT INTO notes VALUES (3932, 2316, 't8');
+INSERT INTO notes VALUES (3933, 2929, 't0');
+INSERT INTO notes VALUES (3934, 3542, 't1');
+INSERT INTO notes VALUES (3935, 155, 't2');
+INSERT INTO notes VALUES (3936, 768, 't3');
+INSERT INTO notes VALUES (3937, 1381, 't4');
+INSERT INTO notes VALUES (3938, 1994, 't5');
+INSERT INTO notes VALUES (3939, 2607, 't6');
+INSERT INTO notes VALUES (3940, 3220, 't7');
+INSERT INTO notes VALUES (3941, 3833, 't8');
+INSERT INTO notes VALUES (3942, 446, 't0');
+INSERT INTO notes VALUES (3943, 1059, 't1');
+INSERT INTO notes VALUES (3944, 1672, 't2');
+INSERT INTO notes VALUES (3945, 2285, 't3');
+INSERT INTO notes VALUES (3946, 2898, 't4');
+INSERT INTO notes VALUES (3947, 3511, 't5');
+INSERT INTO notes VALUES (3948, 124, 't6');
+INSERT INTO notes VALUES (3949, 737, 't7');
+INSERT INTO notes VALUES (3950, 1350, 't8');
+INSERT INTO notes VALUES (3951, 1963, 't0');
+INSERT INTO notes VALUES (3952, 2576, 't1');
+INSERT INTO notes VALUES (3953, 3189, 't2');
+INSERT INTO notes VALUES (3954, 3802, 't3');
+INSERT INTO notes VALUES (3955, 415, 't4');
+INSERT INTO notes VALUES (3956, 1028, 't5');
+INSERT INTO notes VALUES (3957, 1641, 't6');
+INSERT INTO notes VALUES (3958, 2254, 't7');
+INSERT INTO notes VALUES (3959, 2867, 't8');
+INSERT INTO notes VALUES (3960, 3480, 't0');
+INSERT INTO notes VALUES (3961, 93, 't1');
+INSERT INTO notes VALUES (3962, 706, 't2');
+INSERT INTO notes VALUES (3963, 1319, 't3');
+INSERT INTO notes VALUES (3964, 1932, 't4');
+INSERT INTO notes VALUES (3965, 2545, 't5');
+INSERT INTO notes VALUES (3966, 3158, 't6');
+INSERT INTO notes VALUES (3967, 3771, 't7');
+INSERT INTO notes VALUES (3968, 384, 't8');
+INSERT INTO notes VALUES (3969, 997, 't0');
+INSERT INTO notes VALUES (3970, 1610, 't1');
+INSERT INTO notes VALUES (3971, 2223, 't2');
+INSERT INTO notes VALUES (3972, 2836, 't3');
+INSERT INTO notes VALUES (3973, 3449, 't4');
+INSERT INTO notes VALUES (3974, 62, 't5');
+INSERT INTO notes VALUES (3975, 675, 't6');
+INSERT INTO notes VALUES (3976, 1288, 't7');
+INSERT INTO notes VALUES (3977, 1901, 't8');
+INSERT INTO notes VALUES (3978, 2514, 't0');
+INSERT INTO notes VALUES (3979, 3127, 't1');
+INSERT INTO notes VALUES (3980, 3740, 't2');
+INSERT INTO notes VALUES (3981, 353, 't3');
+INSERT INTO notes VALUES (3982, 966, 't4');
+INSERT INTO notes VALUES (3983, 1579, 't5');
+INSERT INTO notes VALUES (3984, 2192, 't6');
+INSERT INTO notes VALUES (3985, 2805, 't7');
+INSERT INTO notes VALUES (3986, 3418, 't8');
+INSERT INTO notes VALUES (3987, 31, 't0');
+INSERT INTO notes VALUES (3988, 644, 't1');
+INSERT INTO notes VALUES (3989, 1257, 't2');
+INSERT INTO notes VALUES (3990, 1870, 't3');
+INSERT INTO notes VALUES (3991, 2483, 't4');
+INSERT INTO notes VALUES (3992, 3096, 't5');
+INSERT INTO notes VALUES (3993, 3709, 't6');
+INSERT INTO notes VALUES (3994, 322, 't7');
+INSERT INTO notes VALUES (3995, 935, 't8');
+INSERT INTO notes VALUES (3996, 1548, 't0');
+INSERT INTO notes VALUES (3997, 2161, 't1');
+INSERT INTO notes VALUES (3998, 2774, 't2');
+INSERT INTO notes VALUES (3999, 3387, 't3');
+CREATE TABLE grades (grp INTEGER, label TEXT);
+INSERT INTO grades VALUES (0, 'g0');
+INSERT INTO grades VALUES (7, 'g7');
+INSERT INTO grades VALUES (14, 'g14');
+INSERT INTO grades VALUES (21, 'g21');
+INSERT INTO grades VALUES (28, 'g28');
+INSERT INTO grades VALUES (35, 'g35');
+INSERT INTO grades VALUES (42, 'g42');
+INSERT INTO grades VALUES (49, 'g49');
+INSERT INTO grades VALUES (56, 'g56');
+INSERT INTO grades VALUES (63, 'g63');
+INSERT INTO grades VALUES (70, 'g70');
+INSERT INTO grades VALUES (77, 'g77');
+INSERT INTO grades VALUES (84, 'g84');
+INSERT INTO grades VALUES (91, 'g91');
+INSERT INTO grades VALUES (98, 'g98');
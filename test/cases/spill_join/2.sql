@@ -0,0 +1,8 @@
+USE DATABASE shop;
+EXPLAIN ANALYZE SELECT items.id, orders.qty FROM items INNER JOIN orders ON items.id = orders.item_id WHERE orders.qty < 1;
+EXPLAIN ANALYZE SELECT items.name, orders.qty, notes.tag FROM items INNER JOIN orders ON items.id = orders.item_id INNER JOIN notes ON orders.id = notes.order_id WHERE notes.tag = 't5';
+EXPLAIN ANALYZE SELECT orders.id, grades.label, items.name FROM orders INNER JOIN grades ON orders.qty = grades.grp INNER JOIN items ON orders.item_id = items.id WHERE orders.id < 40;
+SELECT items.id, orders.id, orders.qty FROM items INNER JOIN orders ON items.id = orders.item_id WHERE orders.qty < 1 AND items.id < 1500;
+SELECT items.name, orders.qty, notes.tag FROM items INNER JOIN orders ON items.id = orders.item_id INNER JOIN notes ON orders.id = notes.order_id WHERE notes.tag = 't5' AND items.id > 3600;
+SELECT items.id, orders.id FROM items INNER JOIN orders ON items.grp = orders.qty WHERE items.id < 2 AND orders.id < 400;
+SELECT notes.id, orders.id FROM notes INNER JOIN orders ON notes.order_id = orders.id WHERE notes.id > 3995;
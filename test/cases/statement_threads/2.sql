@@ -0,0 +1,78 @@
+USE DATABASE bench_3000;
+CREATE DATABASE side;
+USE DATABASE side;
+CREATE TABLE log (id INTEGER, what TEXT);
+USE DATABASE bench_3000;
+UPDATE items SET price = price + 1.00 WHERE grp = 0;
+SELECT id, qty FROM orders WHERE item_id = 0;
+UPDATE orders SET qty = qty + 100 WHERE item_id = 0;
+SELECT id, tag FROM notes WHERE order_id = 0;
+SELECT id, price FROM items WHERE grp = 0 AND id < 1500;
+UPDATE items SET price = price + 1.00 WHERE grp = 1;
+SELECT id, qty FROM orders WHERE item_id = 7;
+UPDATE orders SET qty = qty + 100 WHERE item_id = 7;
+SELECT id, tag FROM notes WHERE order_id = 11;
+SELECT id, price FROM items WHERE grp = 1 AND id < 1500;
+UPDATE items SET price = price + 1.00 WHERE grp = 2;
+SELECT id, qty FROM orders WHERE item_id = 14;
+UPDATE orders SET qty = qty + 100 WHERE item_id = 14;
+SELECT id, tag FROM notes WHERE order_id = 22;
+SELECT id, price FROM items WHERE grp = 2 AND id < 1500;
+UPDATE items SET price = price + 1.00 WHERE grp = 3;
+SELECT id, qty FROM orders WHERE item_id = 21;
+UPDATE orders SET qty = qty + 100 WHERE item_id = 21;
+SELECT id, tag FROM notes WHERE order_id = 33;
+SELECT id, price FROM items WHERE grp = 3 AND id < 1500;
+USE DATABASE side;
+INSERT INTO log VALUES (3, 'batch');
+SELECT * FROM log;
+USE DATABASE bench_3000;
+UPDATE items SET price = price + 1.00 WHERE grp = 4;
+SELECT id, qty FROM orders WHERE item_id = 28;
+UPDATE orders SET qty = qty + 100 WHERE item_id = 28;
+SELECT id, tag FROM notes WHERE order_id = 44;
+SELECT id, price FROM items WHERE grp = 4 AND id < 1500;
+UPDATE items SET price = price + 1.00 WHERE grp = 5;
+SELECT id, qty FROM orders WHERE item_id = 35;
+UPDATE orders SET qty = qty + 100 WHERE item_id = 35;
+SELECT id, tag FROM notes WHERE order_id = 55;
+SELECT id, price FROM items WHERE grp = 5 AND id < 1500;
+UPDATE items SET price = price + 1.00 WHERE grp = 6;
+SELECT id, qty FROM orders WHERE item_id = 42;
+UPDATE orders SET qty = qty + 100 WHERE item_id = 42;
+SELECT id, tag FROM notes WHERE order_id = 66;
+SELECT id, price FROM items WHERE grp = 6 AND id < 1500;
+UPDATE items SET price = price + 1.00 WHERE grp = 7;
+SELECT id, qty FROM orders WHERE item_id = 49;
+UPDATE orders SET qty = qty + 100 WHERE item_id = 49;
+SELECT id, tag FROM notes WHERE order_id = 77;
+SELECT id, price FROM items WHERE grp = 7 AND id < 1500;
+USE DATABASE side;
+INSERT INTO log VALUES (7, 'batch');
+SELECT * FROM log;
+USE DATABASE bench_3000;
+UPDATE items SET price = price + 1.00 WHERE grp = 8;
+SELECT id, qty FROM orders WHERE item_id = 56;
+UPDATE orders SET qty = qty + 100 WHERE item_id = 56;
+SELECT id, tag FROM notes WHERE order_id = 88;
+SELECT id, price FROM items WHERE grp = 8 AND id < 1500;
+UPDATE items SET price = price + 1.00 WHERE grp = 9;
+SELECT id, qty FROM orders WHERE item_id = 63;
+UPDATE orders SET qty = qty + 100 WHERE item_id = 63;
+SELECT id, tag FROM notes WHERE order_id = 99;
+SELECT id, price FROM items WHERE grp = 9 AND id < 1500;
+UPDATE items SET price = price + 1.00 WHERE grp = 10;
+SELECT id, qty FROM orders WHERE item_id = 70;
+UPDATE orders SET qty = qty + 100 WHERE item_id = 70;
+SELECT id, tag FROM notes WHERE order_id = 110;
+SELECT id, price FROM items WHERE grp = 10 AND id < 1500;
+UPDATE items SET price = price + 1.00 WHERE grp = 11;
+SELECT id, qty FROM orders WHERE item_id = 77;
+UPDATE orders SET qty = qty + 100 WHERE item_id = 77;
+SELECT id, tag FROM notes WHERE order_id = 121;
+SELECT id, price FROM items WHERE grp = 11 AND id < 1500;
+USE DATABASE side;
+INSERT INTO log VALUES (11, 'batch');
+SELECT * FROM log;
+USE DATABASE bench_3000;
+SELECT items.id, orders.id, orders.qty FROM items INNER JOIN orders ON items.id = orders.item_id WHERE orders.qty > 99;
@@ -0,0 +1,7 @@
+USE DATABASE bench_3000;
+UPDATE items SET grp = grp + 1000 WHERE id < 3;
+SELECT id, grp FROM items WHERE id < 3;
+DELETE FROM notes WHERE id < 5;
+SELECT id FROM missing;
+UPDATE items SET grp = 0 WHERE id < 3;
+SELECT id, grp FROM items WHERE id < 5;
@@ -0,0 +1,6 @@
+USE DATABASE bench_3000;
+SELECT id, grp FROM items WHERE id < 5;
+SELECT id FROM notes WHERE id < 7;
+SELECT id, price FROM items WHERE grp = 11 AND id < 1500;
+USE DATABASE side;
+SELECT * FROM log;
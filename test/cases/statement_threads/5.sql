@@ -0,0 +1,8 @@
+USE DATABASE bench_3000;
+CREATE TABLE extra (id INTEGER);
+INSERT INTO extra VALUES (1);
+SELECT items.id, orders.id, orders.qty FROM items INNER JOIN orders ON items.id = orders.item_id WHERE items.id < 10;
+UPDATE notes SET id = id + 10000 WHERE id < 7;
+SELECT id FROM missing;
+INSERT INTO extra VALUES (2);
+UPDATE extra SET id = id + 10;
@@ -0,0 +1,3 @@
+USE DATABASE bench_3000;
+SELECT id FROM notes WHERE id < 7 OR id > 9999;
+SELECT * FROM extra;
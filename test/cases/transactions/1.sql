@@ -0,0 +1,16 @@
+CREATE DATABASE ledger;
+USE DATABASE ledger;
+CREATE TABLE entries (id INTEGER, amount FLOAT, memo TEXT);
+BEGIN;
+INSERT INTO entries VALUES (1, 10.00, 'opening');
+INSERT INTO entries VALUES (2, 20.00, 'first');
+COMMIT;
+SELECT * FROM entries;
+BEGIN;
+UPDATE entries SET amount = amount * 10 WHERE id = 1;
+DELETE FROM entries WHERE id = 2;
+SELECT * FROM entries;
+ROLLBACK;
+SELECT * FROM entries;
+BEGIN;
+INSERT INTO entries VALUES (3, 30.00, 'never committed');
@@ -0,0 +1,6 @@
+USE DATABASE ledger;
+SELECT * FROM entries;
+BEGIN;
+INSERT INTO entries VALUES (4, 40.00, 'lost with the failure');
+VACUUM entries;
+SELECT * FROM entries;
@@ -0,0 +1,4 @@
+USE DATABASE ledger;
+SELECT * FROM entries;
+BEGIN;
+BEGIN;
@@ -0,0 +1,24 @@
+CREATE DATABASE kinds;
+USE DATABASE kinds;
+CREATE TABLE words (id INTEGER, word TEXT, weight FLOAT);
+INSERT INTO words VALUES (1, '', 0.5);
+INSERT INTO words VALUES (2, 'fourteen bytes', 1.0);
+INSERT INTO words VALUES (3, 'fifteen bytes!!', 1.5);
+INSERT INTO words VALUES (4, 'a string well past the inline capacity', 2.0);
+INSERT INTO words VALUES (5, 'fourteen bytes', -2.0);
+CREATE TABLE links (word TEXT, note TEXT);
+INSERT INTO links VALUES ('a string well past the inline capacity', 'long');
+INSERT INTO links VALUES ('fifteen bytes!!', 'just long');
+INSERT INTO links VALUES ('fourteen bytes', 'inline');
+INSERT INTO links VALUES ('', 'empty');
+SELECT * FROM words;
+SELECT id FROM words WHERE word = '';
+SELECT id FROM words WHERE word = 'fourteen bytes';
+SELECT id FROM words WHERE word = 'fifteen bytes!!' OR word = 'a string well past the inline capacity';
+SELECT id FROM words WHERE word != 'fourteen bytes';
+SELECT id, weight FROM words WHERE weight > 1.00;
+SELECT id FROM words WHERE id < 3;
+SELECT words.id, links.note FROM words INNER JOIN links ON words.word = links.word;
+UPDATE words SET weight = weight * 2 + id WHERE id > 3;
+UPDATE words SET id = id * 10 WHERE word = 'a string well past the inline capacity';
+SELECT id, weight FROM words;
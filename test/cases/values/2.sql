@@ -0,0 +1,3 @@
+USE DATABASE kinds;
+SELECT * FROM words;
+SELECT words.id, links.note FROM words INNER JOIN links ON words.word = links.word WHERE links.note != 'inline';
@@ -0,0 +1,8195 @@
+CREATE DATABASE metrics;
+USE DATABASE metrics;
+CREATE TABLE events (ts INTEGER, sensor INTEGER, reading FLOAT);
+INSERT INTO events VALUES (1000, 0, 0.00);
+INSERT INTO events VALUES (1003, 1, 0.25);
+INSERT INTO events VALUES (1006, 2, 0.50);
+INSERT INTO events VALUES (1009, 3, 0.75);
+INSERT INTO events VALUES (1012, 4, 1.00);
+INSERT INTO events VALUES (1015, 5, 1.25);
+INSERT INTO events VALUES (1018, 6, 1.50);
+INSERT INTO events VALUES (1021, 7, 1.75);
+INSERT INTO events VALUES (1024, 8, 2.00);
+INSERT INTO events VALUES (1027, 9, 2.25);
+INSERT INTO events VALUES (1030, 10, 2.50);
+INSERT INTO events VALUES (1033, 11, 2.75);
+INSERT INTO events VALUES (1036, 12, 3.00);
+INSERT INTO events VALUES (1039, 13, 3.25);
+INSERT INTO events VALUES (1042, 14, 3.50);
+INSERT INTO events VALUES (1045, 15, 3.75);
+INSERT INTO events VALUES (1048, 0, 4.00);
+INSERT INTO events VALUES (1051, 1, 4.25);
+INSERT INTO events VALUES (1054, 2, 4.50);
+INSERT INTO events VALUES (1057, 3, 4.75);
+INSERT INTO events VALUES (1060, 4, 5.00);
+INSERT INTO events VALUES (1063, 5, 5.25);
+INSERT INTO events VALUES (1066, 6, 5.50);
+INSERT INTO events VALUES (1069, 7, 5.75);
+INSERT INTO events VALUES (1072, 8, 6.00);
+INSERT INTO events VALUES (1075, 9, 6.25);
+INSERT INTO events VALUES (1078, 10, 6.50);
+INSERT INTO events VALUES (1081, 11, 6.75);
+INSERT INTO events VALUES (1084, 12, 7.00);
+INSERT INTO events VALUES (1087, 13, 7.25);
+INSERT INTO events VALUES (1090, 14, 7.50);
+INSERT INTO events VALUES (1093, 15, 7.75);
+INSERT INTO events VALUES (1096, 0, 8.00);
+INSERT INTO events VALUES (1099, 1, 8.25);
+INSERT INTO events VALUES (1102, 2, 8.50);
+INSERT INTO events VALUES (1105, 3, 8.75);
+INSERT INTO events VALUES (1108, 4, 9.00);
+INSERT INTO events VALUES (1111, 5, 9.25);
+INSERT INTO events VALUES (1114, 6, 9.50);
+INSERT INTO events VALUES (1117, 7, 9.75);
+INSERT INTO events VALUES (1120, 8, 10.00);
+INSERT INTO events VALUES (1123, 9, 10.25);
+INSERT INTO events VALUES (1126, 10, 10.50);
+INSERT INTO events VALUES (1129, 11, 10.75);
+INSERT INTO events VALUES (1132, 12, 11.00);
+INSERT INTO events VALUES (1135, 13, 11.25);
+INSERT INTO events VALUES (1138, 14, 11.50);
+INSERT INTO events VALUES (1141, 15, 11.75);
+INSERT INTO events VALUES (1144, 0, 12.00);
+INSERT INTO events VALUES (1147, 1, 12.25);
+INSERT INTO events VALUES (1150, 2, 12.50);
+INSERT INTO events VALUES (1153, 3, 12.75);
+INSERT INTO events VALUES (1156, 4, 13.00);
+INSERT INTO events VALUES (1159, 5, 13.25);
+INSERT INTO events VALUES (1162, 6, 13.50);
+INSERT INTO events VALUES (1165, 7, 13.75);
+INSERT INTO events VALUES (1168, 8, 14.00);
+INSERT INTO events VALUES (1171, 9, 14.25);
+INSERT INTO events VALUES (1174, 10, 14.50);
+INSERT INTO events VALUES (1177, 11, 14.75);
+INSERT INTO events VALUES (1180, 12, 15.00);
+INSERT INTO events VALUES (1183, 13, 15.25);
+INSERT INTO events VALUES (1186, 14, 15.50);
+INSERT INTO events VALUES (1189, 15, 15.75);
+INSERT INTO events VALUES (1192, 0, 16.00);
+INSERT INTO events VALUES (1195, 1, 16.25);
+INSERT INTO events VALUES (1198, 2, 16.50);
+INSERT INTO events VALUES (1201, 3, 16.75);
+INSERT INTO events VALUES (1204, 4, 17.00);
+INSERT INTO events VALUES (1207, 5, 17.25);
+INSERT INTO events VALUES (1210, 6, 17.50);
+INSERT INTO events VALUES (1213, 7, 17.75);
+INSERT INTO events VALUES (1216, 8, 18.00);
+INSERT INTO events VALUES (1219, 9, 18.25);
+INSERT INTO events VALUES (1222, 10, 18.50);
+INSERT INTO events VALUES (1225, 11, 18.75);
+INSERT INTO events VALUES (1228, 12, 19.00);
+INSERT INTO events VALUES (1231, 13, 19.25);
+INSERT INTO events VALUES (1234, 14, 19.50);
+INSERT INTO events VALUES (1237, 15, 19.75);
+INSERT INTO events VALUES (1240, 0, 20.00);
+INSERT INTO events VALUES (1243, 1, 20.25);
+INSERT INTO events VALUES (1246, 2, 20.50);
+INSERT INTO events VALUES (1249, 3, 20.75);
+INSERT INTO events VALUES (1252, 4, 21.00);
+INSERT INTO events VALUES (1255, 5, 21.25);
+INSERT INTO events VALUES (1258, 6, 21.50);
+INSERT INTO events VALUES (1261, 7, 21.75);
+INSERT INTO events VALUES (1264, 8, 22.00);
+INSERT INTO events VALUES (1267, 9, 22.25);
+INSERT INTO events VALUES (1270, 10, 22.50);
+INSERT INTO events VALUES (1273, 11, 22.75);
+INSERT INTO events VALUES (1276, 12, 23.00);
+INSERT INTO events VALUES (1279, 13, 23.25);
+INSERT INTO events VALUES (1282, 14, 23.50);
+INSERT INTO events VALUES (1285, 15, 23.75);
+INSERT INTO events VALUES (1288, 0, 24.00);
+INSERT INTO events VALUES (1291, 1, 24.25);
+INSERT INTO events VALUES (1294, 2, 24.50);
+INSERT INTO events VALUES (1297, 3, 24.75);
+INSERT INTO events VALUES (1300, 4, 0.00);
+INSERT INTO events VALUES (1303, 5, 0.25);
+INSERT INTO events VALUES (1306, 6, 0.50);
+INSERT INTO events VALUES (1309, 7, 0.75);
+INSERT INTO events VALUES (1312, 8, 1.00);
+INSERT INTO events VALUES (1315, 9, 1.25);
+INSERT INTO events VALUES (1318, 10, 1.50);
+INSERT INTO events VALUES (1321, 11, 1.75);
+INSERT INTO events VALUES (1324, 12, 2.00);
+INSERT INTO events VALUES (1327, 13, 2.25);
+INSERT INTO events VALUES (1330, 14, 2.50);
+INSERT INTO events VALUES (1333, 15, 2.75);
+INSERT INTO events VALUES (1336, 0, 3.00);
+INSERT INTO events VALUES (1339, 1, 3.25);
+INSERT INTO events VALUES (1342, 2, 3.50);
+INSERT INTO events VALUES (1345, 3, 3.75);
+INSERT INTO events VALUES (1348, 4, 4.00);
+INSERT INTO events VALUES (1351, 5, 4.25);
+INSERT INTO events VALUES (1354, 6, 4.50);
+INSERT INTO events VALUES (1357, 7, 4.75);
+INSERT INTO events VALUES (1360, 8, 5.00);
+INSERT INTO events VALUES (1363, 9, 5.25);
+INSERT INTO events VALUES (1366, 10, 5.50);
+INSERT INTO events VALUES (1369, 11, 5.75);
+INSERT INTO events VALUES (1372, 12, 6.00);
+INSERT INTO events VALUES (1375, 13, 6.25);
+INSERT INTO events VALUES (1378, 14, 6.50);
+INSERT INTO events VALUES (1381, 15, 6.75);
+INSERT INTO events VALUES (1384, 0, 7.00);
+INSERT INTO events VALUES (1387, 1, 7.25);
+INSERT INTO events VALUES (1390, 2, 7.50);
+INSERT INTO events VALUES (1393, 3, 7.75);
+INSERT INTO events VALUES (1396, 4, 8.00);
+INSERT INTO events VALUES (1399, 5, 8.25);
+INSERT INTO events VALUES (1402, 6, 8.50);
+INSERT INTO events VALUES (1405, 7, 8.75);
+INSERT INTO events VALUES (1408, 8, 9.00);
+INSERT INTO events VALUES (1411, 9, 9.25);
+INSERT INTO events VALUES (1414, 10, 9.50);
+INSERT INTO events VALUES (1417, 11, 9.75);
+INSERT INTO events VALUES (1420, 12, 10.00);
+INSERT INTO events VALUES (1423, 13, 10.25);
+INSERT INTO events VALUES (1426, 14, 10.50);
+INSERT INTO events VALUES (1429, 15, 10.75);
+INSERT INTO events VALUES (1432, 0, 11.00);
+INSERT INTO events VALUES (1435, 1, 11.25);
+INSERT INTO events VALUES (1438, 2, 11.50);
+INSERT INTO events VALUES (1441, 3, 11.75);
+INSERT INTO events VALUES (1444, 4, 12.00);
+INSERT INTO events VALUES (1447, 5, 12.25);
+INSERT INTO events VALUES (1450, 6, 12.50);
+INSERT INTO events VALUES (1453, 7, 12.75);
+INSERT INTO events VALUES (1456, 8, 13.00);
+INSERT INTO events VALUES (1459, 9, 13.25);
+INSERT INTO events VALUES (1462, 10, 13.50);
+INSERT INTO events VALUES (1465, 11, 13.75);
+INSERT INTO events VALUES (1468, 12, 14.00);
+INSERT INTO events VALUES (1471, 13, 14.25);
+INSERT INTO events VALUES (1474, 14, 14.50);
+INSERT INTO events VALUES (1477, 15, 14.75);
+INSERT INTO events VALUES (1480, 0, 15.00);
+INSERT INTO events VALUES (1483, 1, 15.25);
+INSERT INTO events VALUES (1486, 2, 15.50);
+INSERT INTO events VALUES (1489, 3, 15.75);
+INSERT INTO events VALUES (1492, 4, 16.00);
+INSERT INTO events VALUES (1495, 5, 16.25);
+INSERT INTO events VALUES (1498, 6, 16.50);
+INSERT INTO events VALUES (1501, 7, 16.75);
+INSERT INTO events VALUES (1504, 8, 17.00);
+INSERT INTO events VALUES (1507, 9, 17.25);
+INSERT INTO events VALUES (1510, 10, 17.50);
+INSERT INTO events VALUES (1513, 11, 17.75);
+INSERT INTO events VALUES (1516, 12, 18.00);
+INSERT INTO events VALUES (1519, 13, 18.25);
+INSERT INTO events VALUES (1522, 14, 18.50);
+INSERT INTO events VALUES (1525, 15, 18.75);
+INSERT INTO events VALUES (1528, 0, 19.00);
+INSERT INTO events VALUES (1531, 1, 19.25);
+INSERT INTO events VALUES (1534, 2, 19.50);
+INSERT INTO events VALUES (1537, 3, 19.75);
+INSERT INTO events VALUES (1540, 4, 20.00);
+INSERT INTO events VALUES (1543, 5, 20.25);
+INSERT INTO events VALUES (1546, 6, 20.50);
+INSERT INTO events VALUES (1549, 7, 20.75);
+INSERT INTO events VALUES (1552, 8, 21.00);
+INSERT INTO events VALUES (1555, 9, 21.25);
+INSERT INTO events VALUES (1558, 10, 21.50);
+INSERT INTO events VALUES (1561, 11, 21.75);
+INSERT INTO events VALUES (1564, 12, 22.00);
+INSERT INTO events VALUES (1567, 13, 22.25);
+INSERT INTO events VALUES (1570, 14, 22.50);
+INSERT INTO events VALUES (1573, 15, 22.75);
+INSERT INTO events VALUES (1576, 0, 23.00);
+INSERT INTO events VALUES (1579, 1, 23.25);
+INSERT INTO events VALUES (1582, 2, 23.50);
+INSERT INTO events VALUES (1585, 3, 23.75);
+INSERT INTO events VALUES (1588, 4, 24.00);
+INSERT INTO events VALUES (1591, 5, 24.25);
+INSERT INTO events VALUES (1594, 6, 24.50);
+INSERT INTO events VALUES (1597, 7, 24.75);
+INSERT INTO events VALUES (1600, 8, 0.00);
+INSERT INTO events VALUES (1603, 9, 0.25);
+INSERT INTO events VALUES (1606, 10, 0.50);
+INSERT INTO events VALUES (1609, 11, 0.75);
+INSERT INTO events VALUES (1612, 12, 1.00);
+INSERT INTO events VALUES (1615, 13, 1.25);
+INSERT INTO events VALUES (1618, 14, 1.50);
+INSERT INTO events VALUES (1621, 15, 1.75);
+INSERT INTO events VALUES (1624, 0, 2.00);
+INSERT INTO events VALUES (1627, 1, 2.25);
+INSERT INTO events VALUES (1630, 2, 2.50);
+INSERT INTO events VALUES (1633, 3, 2.75);
+INSERT INTO events VALUES (1636, 4, 3.00);
+INSERT INTO events VALUES (1639, 5, 3.25);
+INSERT INTO events VALUES (1642, 6, 3.50);
+INSERT INTO events VALUES (1645, 7, 3.75);
+INSERT INTO events VALUES (1648, 8, 4.00);
+INSERT INTO events VALUES (1651, 9, 4.25);
+INSERT INTO events VALUES (1654, 10, 4.50);
+INSERT INTO events VALUES (1657, 11, 4.75);
+INSERT INTO events VALUES (1660, 12, 5.00);
+INSERT INTO events VALUES (1663, 13, 5.25);
+INSERT INTO events VALUES (1666, 14, 5.50);
+INSERT INTO events VALUES (1669, 15, 5.75);
+INSERT INTO events VALUES (1672, 0, 6.00);
+INSERT INTO events VALUES (1675, 1, 6.25);
+INSERT INTO events VALUES (1678, 2, 6.50);
+INSERT INTO events VALUES (1681, 3, 6.75);
+INSERT INTO events VALUES (1684, 4, 7.00);
+INSERT INTO events VALUES (1687, 5, 7.25);
+INSERT INTO events VALUES (1690, 6, 7.50);
+INSERT INTO events VALUES (1693, 7, 7.75);
+INSERT INTO events VALUES (1696, 8, 8.00);
+INSERT INTO events VALUES (1699, 9, 8.25);
+INSERT INTO events VALUES (1702, 10, 8.50);
+INSERT INTO events VALUES (1705, 11, 8.75);
+INSERT INTO events VALUES (1708, 12, 9.00);
+INSERT INTO events VALUES (1711, 13, 9.25);
+INSERT INTO events VALUES (1714, 14, 9.50);
+INSERT INTO events VALUES (1717, 15, 9.75);
+INSERT INTO events VALUES (1720, 0, 10.00);
+INSERT INTO events VALUES (1723, 1, 10.25);
+INSERT INTO events VALUES (1726, 2, 10.50);
+INSERT INTO events VALUES (1729, 3, 10.75);
+INSERT INTO events VALUES (1732, 4, 11.00);
+INSERT INTO events VALUES (1735, 5, 11.25);
+INSERT INTO events VALUES (1738, 6, 11.50);
+INSERT INTO events VALUES (1741, 7, 11.75);
+INSERT INTO events VALUES (1744, 8, 12.00);
+INSERT INTO events VALUES (1747, 9, 12.25);
+INSERT INTO events VALUES (1750, 10, 12.50);
+INSERT INTO events VALUES (1753, 11, 12.75);
+INSERT INTO events VALUES (1756, 12, 13.00);
+INSERT INTO events VALUES (1759, 13, 13.25);
+INSERT INTO events VALUES (1762, 14, 13.50);
+INSERT INTO events VALUES (1765, 15, 13.75);
+INSERT INTO events VALUES (1768, 0, 14.00);
+INSERT INTO events VALUES (1771, 1, 14.25);
+INSERT INTO events VALUES (1774, 2, 14.50);
+INSERT INTO events VALUES (1777, 3, 14.75);
+INSERT INTO events VALUES (1780, 4, 15.00);
+INSERT INTO events VALUES (1783, 5, 15.25);
+INSERT INTO events VALUES (1786, 6, 15.50);
+INSERT INTO events VALUES (1789, 7, 15.75);
+INSERT INTO events VALUES (1792, 8, 16.00);
+INSERT INTO events VALUES (1795, 9, 16.25);
+INSERT INTO events VALUES (1798, 10, 16.50);
+INSERT INTO events VALUES (1801, 11, 16.75);
+INSERT INTO events VALUES (1804, 12, 17.00);
+INSERT INTO events VALUES (1807, 13, 17.25);
+INSERT INTO events VALUES (1810, 14, 17.50);
+INSERT INTO events VALUES (1813, 15, 17.75);
+INSERT INTO events VALUES (1816, 0, 18.00);
+INSERT INTO events VALUES (1819, 1, 18.25);
+INSERT INTO events VALUES (1822, 2, 18.50);
+INSERT INTO events VALUES (1825, 3, 18.75);
+INSERT INTO events VALUES (1828, 4, 19.00);
+INSERT INTO events VALUES (1831, 5, 19.25);
+INSERT INTO events VALUES (1834, 6, 19.50);
+INSERT INTO events VALUES (1837, 7, 19.75);
+INSERT INTO events VALUES (1840, 8, 20.00);
+INSERT INTO events VALUES (1843, 9, 20.25);
+INSERT INTO events VALUES (1846, 10, 20.50);
+INSERT INTO events VALUES (1849, 11, 20.75);
+INSERT INTO events VALUES (1852, 12, 21.00);
+INSERT INTO events VALUES (1855, 13, 21.25);
+INSERT INTO events VALUES (1858, 14, 21.50);
+INSERT INTO events VALUES (1861, 15, 21.75);
+INSERT INTO events VALUES (1864, 0, 22.00);
+INSERT INTO events VALUES (1867, 1, 22.25);
+INSERT INTO events VALUES (1870, 2, 22.50);
+INSERT INTO events VALUES (1873, 3, 22.75);
+INSERT INTO events VALUES (1876, 4, 23.00);
+INSERT INTO events VALUES (1879, 5, 23.25);
+INSERT INTO events VALUES (1882, 6, 23.50);
+INSERT INTO events VALUES (1885, 7, 23.75);
+INSERT INTO events VALUES (1888, 8, 24.00);
+INSERT INTO events VALUES (1891, 9, 24.25);
+INSERT INTO events VALUES (1894, 10, 24.50);
+INSERT INTO events VALUES (1897, 11, 24.75);
+INSERT INTO events VALUES (1900, 12, 0.00);
+INSERT INTO events VALUES (1903, 13, 0.25);
+INSERT INTO events VALUES (1906, 14, 0.50);
+INSERT INTO events VALUES (1909, 15, 0.75);
+INSERT INTO events VALUES (1912, 0, 1.00);
+INSERT INTO events VALUES (1915, 1, 1.25);
+INSERT INTO events VALUES (1918, 2, 1.50);
+INSERT INTO events VALUES (1921, 3, 1.75);
+INSERT INTO events VALUES (1924, 4, 2.00);
+INSERT INTO events VALUES (1927, 5, 2.25);
+INSERT INTO events VALUES (1930, 6, 2.50);
+INSERT INTO events VALUES (1933, 7, 2.75);
+INSERT INTO events VALUES (1936, 8, 3.00);
+INSERT INTO events VALUES (1939, 9, 3.25);
+INSERT INTO events VALUES (1942, 10, 3.50);
+INSERT INTO events VALUES (1945, 11, 3.75);
+INSERT INTO events VALUES (1948, 12, 4.00);
+INSERT INTO events VALUES (1951, 13, 4.25);
+INSERT INTO events VALUES (1954, 14, 4.50);
+INSERT INTO events VALUES (1957, 15, 4.75);
+INSERT INTO events VALUES (1960, 0, 5.00);
+INSERT INTO events VALUES (1963, 1, 5.25);
+INSERT INTO events VALUES (1966, 2, 5.50);
+INSERT INTO events VALUES (1969, 3, 5.75);
+INSERT INTO events VALUES (1972, 4, 6.00);
+INSERT INTO events VALUES (1975, 5, 6.25);
+INSERT INTO events VALUES (1978, 6, 6.50);
+INSERT INTO events VALUES (1981, 7, 6.75);
+INSERT INTO events VALUES (1984, 8, 7.00);
+INSERT INTO events VALUES (1987, 9, 7.25);
+INSERT INTO events VALUES (1990, 10, 7.50);
+INSERT INTO events VALUES (1993, 11, 7.75);
+INSERT INTO events VALUES (1996, 12, 8.00);
+INSERT INTO events VALUES (1999, 13, 8.25);
+INSERT INTO events VALUES (2002, 14, 8.50);
+INSERT INTO events VALUES (2005, 15, 8.75);
+INSERT INTO events VALUES (2008, 0, 9.00);
+INSERT INTO events VALUES (2011, 1, 9.25);
+INSERT INTO events VALUES (2014, 2, 9.50);
+INSERT INTO events VALUES (2017, 3, 9.75);
+INSERT INTO events VALUES (2020, 4, 10.00);
+INSERT INTO events VALUES (2023, 5, 10.25);
+INSERT INTO events VALUES (2026, 6, 10.50);
+INSERT INTO events VALUES (2029, 7, 10.75);
+INSERT INTO events VALUES (2032, 8, 11.00);
+INSERT INTO events VALUES (2035, 9, 11.25);
+INSERT INTO events VALUES (2038, 10, 11.50);
+INSERT INTO events VALUES (2041, 11, 11.75);
+INSERT INTO events VALUES (2044, 12, 12.00);
+INSERT INTO events VALUES (2047, 13, 12.25);
+INSERT INTO events VALUES (2050, 14, 12.50);
+INSERT INTO events VALUES (2053, 15, 12.75);
+INSERT INTO events VALUES (2056, 0, 13.00);
+INSERT INTO events VALUES (2059, 1, 13.25);
+INSERT INTO events VALUES (2062, 2, 13.50);
+INSERT INTO events VALUES (2065, 3, 13.75);
+INSERT INTO events VALUES (2068, 4, 14.00);
+INSERT INTO events VALUES (2071, 5, 14.25);
+INSERT INTO events VALUES (2074, 6, 14.50);
+INSERT INTO events VALUES (2077, 7, 14.75);
+INSERT INTO events VALUES (2080, 8, 15.00);
+INSERT INTO events VALUES (2083, 9, 15.25);
+INSERT INTO events VALUES (2086, 10, 15.50);
+INSERT INTO events VALUES (2089, 11, 15.75);
+INSERT INTO events VALUES (2092, 12, 16.00);
+INSERT INTO events VALUES (2095, 13, 16.25);
+INSERT INTO events VALUES (2098, 14, 16.50);
+INSERT INTO events VALUES (2101, 15, 16.75);
+INSERT INTO events VALUES (2104, 0, 17.00);
+INSERT INTO events VALUES (2107, 1, 17.25);
+INSERT INTO events VALUES (2110, 2, 17.50);
+INSERT INTO events VALUES (2113, 3, 17.75);
+INSERT INTO events VALUES (2116, 4, 18.00);
+INSERT INTO events VALUES (2119, 5, 18.25);
+INSERT INTO events VALUES (2122, 6, 18.50);
+INSERT INTO events VALUES (2125, 7, 18.75);
+INSERT INTO events VALUES (2128, 8, 19.00);
+INSERT INTO events VALUES (2131, 9, 19.25);
+INSERT INTO events VALUES (2134, 10, 19.50);
+INSERT INTO events VALUES (2137, 11, 19.75);
+INSERT INTO events VALUES (2140, 12, 20.00);
+INSERT INTO events VALUES (2143, 13, 20.25);
+INSERT INTO events VALUES (2146, 14, 20.50);
+INSERT INTO events VALUES (2149, 15, 20.75);
+INSERT INTO events VALUES (2152, 0, 21.00);
+INSERT INTO events VALUES (2155, 1, 21.25);
+INSERT INTO events VALUES (2158, 2, 21.50);
+INSERT INTO events VALUES (2161, 3, 21.75);
+INSERT INTO events VALUES (2164, 4, 22.00);
+INSERT INTO events VALUES (2167, 5, 22.25);
+INSERT INTO events VALUES (2170, 6, 22.50);
+INSERT INTO events VALUES (2173, 7, 22.75);
+INSERT INTO events VALUES (2176, 8, 23.00);
+INSERT INTO events VALUES (2179, 9, 23.25);
+INSERT INTO events VALUES (2182, 10, 23.50);
+INSERT INTO events VALUES (2185, 11, 23.75);
+INSERT INTO events VALUES (2188, 12, 24.00);
+INSERT INTO events VALUES (2191, 13, 24.25);
+INSERT INTO events VALUES (2194, 14, 24.50);
+INSERT INTO events VALUES (2197, 15, 24.75);
+INSERT INTO events VALUES (2200, 0, 0.00);
+INSERT INTO events VALUES (2203, 1, 0.25);
+INSERT INTO events VALUES (2206, 2, 0.50);
+INSERT INTO events VALUES (2209, 3, 0.75);
+INSERT INTO events VALUES (2212, 4, 1.00);
+INSERT INTO events VALUES (2215, 5, 1.25);
+INSERT INTO events VALUES (2218, 6, 1.50);
+INSERT INTO events VALUES (2221, 7, 1.75);
+INSERT INTO events VALUES (2224, 8, 2.00);
+INSERT INTO events VALUES (2227, 9, 2.25);
+INSERT INTO events VALUES (2230, 10, 2.50);
+INSERT INTO events VALUES (2233, 11, 2.75);
+INSERT INTO events VALUES (2236, 12, 3.00);
+INSERT INTO events VALUES (2239, 13, 3.25);
+INSERT INTO events VALUES (2242, 14, 3.50);
+INSERT INTO events VALUES (2245, 15, 3.75);
+INSERT INTO events VALUES (2248, 0, 4.00);
+INSERT INTO events VALUES (2251, 1, 4.25);
+INSERT INTO events VALUES (2254, 2, 4.50);
+INSERT INTO events VALUES (2257, 3, 4.75);
+INSERT INTO events VALUES (2260, 4, 5.00);
+INSERT INTO events VALUES (2263, 5, 5.25);
+INSERT INTO events VALUES (2266, 6, 5.50);
+INSERT INTO events VALUES (2269, 7, 5.75);
+INSERT INTO events VALUES (2272, 8, 6.00);
+INSERT INTO events VALUES (2275, 9, 6.25);
+INSERT INTO events VALUES (2278, 10, 6.50);
+INSERT INTO events VALUES (2281, 11, 6.75);
+INSERT INTO events VALUES (2284, 12, 7.00);
+INSERT INTO events VALUES (2287, 13, 7.25);
+INSERT INTO events VALUES (2290, 14, 7.50);
+INSERT INTO events VALUES (2293, 15, 7.75);
+INSERT INTO events VALUES (2296, 0, 8.00);
+INSERT INTO events VALUES (2299, 1, 8.25);
+INSERT INTO events VALUES (2302, 2, 8.50);
+INSERT INTO events VALUES (2305, 3, 8.75);
+INSERT INTO events VALUES (2308, 4, 9.00);
+INSERT INTO events VALUES (2311, 5, 9.25);
+INSERT INTO events VALUES (2314, 6, 9.50);
+INSERT INTO events VALUES (2317, 7, 9.75);
+INSERT INTO events VALUES (2320, 8, 10.00);
+INSERT INTO events VALUES (2323, 9, 10.25);
+INSERT INTO events VALUES (2326, 10, 10.50);
+INSERT INTO events VALUES (2329, 11, 10.75);
+INSERT INTO events VALUES (2332, 12, 11.00);
+INSERT INTO events VALUES (2335, 13, 11.25);
+INSERT INTO events VALUES (2338, 14, 11.50);
+INSERT INTO events VALUES (2341, 15, 11.75);
+INSERT INTO events VALUES (2344, 0, 12.00);
+INSERT INTO events VALUES (2347, 1, 12.25);
+INSERT INTO events VALUES (2350, 2, 12.50);
+INSERT INTO events VALUES (2353, 3, 12.75);
+INSERT INTO events VALUES (2356, 4, 13.00);
+INSERT INTO events VALUES (2359, 5, 13.25);
+INSERT INTO events VALUES (2362, 6, 13.50);
+INSERT INTO events VALUES (2365, 7, 13.75);
+INSERT INTO events VALUES (2368, 8, 14.00);
+INSERT INTO events VALUES (2371, 9, 14.25);
+INSERT INTO events VALUES (2374, 10, 14.50);
+INSERT INTO events VALUES (2377, 11, 14.75);
+INSERT INTO events VALUES (2380, 12, 15.00);
+INSERT INTO events VALUES (2383, 13, 15.25);
+INSERT INTO events VALUES (2386, 14, 15.50);
+INSERT INTO events VALUES (2389, 15, 15.75);
+INSERT INTO events VALUES (2392, 0, 16.00);
+INSERT INTO events VALUES (2395, 1, 16.25);
+INSERT INTO events VALUES (2398, 2, 16.50);
+INSERT INTO events VALUES (2401, 3, 16.75);
+INSERT INTO events VALUES (2404, 4, 17.00);
+INSERT INTO events VALUES (2407, 5, 17.25);
+INSERT INTO events VALUES (2410, 6, 17.50);
+INSERT INTO events VALUES (2413, 7, 17.75);
+INSERT INTO events VALUES (2416, 8, 18.00);
+INSERT INTO events VALUES (2419, 9, 18.25);
+INSERT INTO events VALUES (2422, 10, 18.50);
+INSERT INTO events VALUES (2425, 11, 18.75);
+INSERT INTO events VALUES (2428, 12, 19.00);
+INSERT INTO events VALUES (2431, 13, 19.25);
+INSERT INTO events VALUES (2434, 14, 19.50);
+INSERT INTO events VALUES (2437, 15, 19.75);
+INSERT INTO events VALUES (2440, 0, 20.00);
+INSERT INTO events VALUES (2443, 1, 20.25);
+INSERT INTO events VALUES (2446, 2, 20.50);
+INSERT INTO events VALUES (2449, 3, 20.75);
+INSERT INTO events VALUES (2452, 4, 21.00);
+INSERT INTO events VALUES (2455, 5, 21.25);
+INSERT INTO events VALUES (2458, 6, 21.50);
+INSERT INTO events VALUES (2461, 7, 21.75);
+INSERT INTO events VALUES (2464, 8, 22.00);
+INSERT INTO events VALUES (2467, 9, 22.25);
+INSERT INTO events VALUES (2470, 10, 22.50);
+INSERT INTO events VALUES (2473, 11, 22.75);
+INSERT INTO events VALUES (2476, 12, 23.00);
+INSERT INTO events VALUES (2479, 13, 23.25);
+INSERT INTO events VALUES (2482, 14, 23.50);
+INSERT INTO events VALUES (2485, 15, 23.75);
+INSERT INTO events VALUES (2488, 0, 24.00);
+INSERT INTO events VALUES (2491, 1, 24.25);
+INSERT INTO events VALUES (2494, 2, 24.50);
+INSERT INTO events VALUES (2497, 3, 24.75);
+INSERT INTO events VALUES (2500, 4, 0.00);
+INSERT INTO events VALUES (2503, 5, 0.25);
+INSERT INTO events VALUES (2506, 6, 0.50);
+INSERT INTO events VALUES (2509, 7, 0.75);
+INSERT INTO events VALUES (2512, 8, 1.00);
+INSERT INTO events VALUES (2515, 9, 1.25);
+INSERT INTO events VALUES (2518, 10, 1.50);
+INSERT INTO events VALUES (2521, 11, 1.75);
+INSERT INTO events VALUES (2524, 12, 2.00);
+INSERT INTO events VALUES (2527, 13, 2.25);
+INSERT INTO events VALUES (2530, 14, 2.50);
+INSERT INTO events VALUES (2533, 15, 2.75);
+INSERT INTO events VALUES (2536, 0, 3.00);
+INSERT INTO events VALUES (2539, 1, 3.25);
+INSERT INTO events VALUES (2542, 2, 3.50);
+INSERT INTO events VALUES (2545, 3, 3.75);
+INSERT INTO events VALUES (2548, 4, 4.00);
+INSERT INTO events VALUES (2551, 5, 4.25);
+INSERT INTO events VALUES (2554, 6, 4.50);
+INSERT INTO events VALUES (2557, 7, 4.75);
+INSERT INTO events VALUES (2560, 8, 5.00);
+INSERT INTO events VALUES (2563, 9, 5.25);
+INSERT INTO events VALUES (2566, 10, 5.50);
+INSERT INTO events VALUES (2569, 11, 5.75);
+INSERT INTO events VALUES (2572, 12, 6.00);
+INSERT INTO events VALUES (2575, 13, 6.25);
+INSERT INTO events VALUES (2578, 14, 6.50);
+INSERT INTO events VALUES (2581, 15, 6.75);
+INSERT INTO events VALUES (2584, 0, 7.00);
+INSERT INTO events VALUES (2587, 1, 7.25);
+INSERT INTO events VALUES (2590, 2, 7.50);
+INSERT INTO events VALUES (2593, 3, 7.75);
+INSERT INTO events VALUES (2596, 4, 8.00);
+INSERT INTO events VALUES (2599, 5, 8.25);
+INSERT INTO events VALUES (2602, 6, 8.50);
+INSERT INTO events VALUES (2605, 7, 8.75);
+INSERT INTO events VALUES (2608, 8, 9.00);
+INSERT INTO events VALUES (2611, 9, 9.25);
+INSERT INTO events VALUES (2614, 10, 9.50);
+INSERT INTO events VALUES (2617, 11, 9.75);
+INSERT INTO events VALUES (2620, 12, 10.00);
+INSERT INTO events VALUES (2623, 13, 10.25);
+INSERT INTO events VALUES (2626, 14, 10.50);
+INSERT INTO events VALUES (2629, 15, 10.75);
+INSERT INTO events VALUES (2632, 0, 11.00);
+INSERT INTO events VALUES (2635, 1, 11.25);
+INSERT INTO events VALUES (2638, 2, 11.50);
+INSERT INTO events VALUES (2641, 3, 11.75);
+INSERT INTO events VALUES (2644, 4, 12.00);
+INSERT INTO events VALUES (2647, 5, 12.25);
+INSERT INTO events VALUES (2650, 6, 12.50);
+INSERT INTO events VALUES (2653, 7, 12.75);
+INSERT INTO events VALUES (2656, 8, 13.00);
+INSERT INTO events VALUES (2659, 9, 13.25);
+INSERT INTO events VALUES (2662, 10, 13.50);
+INSERT INTO events VALUES (2665, 11, 13.75);
+INSERT INTO events VALUES (2668, 12, 14.00);
+INSERT INTO events VALUES (2671, 13, 14.25);
+INSERT INTO events VALUES (2674, 14, 14.50);
+INSERT INTO events VALUES (2677, 15, 14.75);
+INSERT INTO events VALUES (2680, 0, 15.00);
+INSERT INTO events VALUES (2683, 1, 15.25);
+INSERT INTO events VALUES (2686, 2, 15.50);
+INSERT INTO events VALUES (2689, 3, 15.75);
+INSERT INTO events VALUES (2692, 4, 16.00);
+INSERT INTO events VALUES (2695, 5, 16.25);
+INSERT INTO events VALUES (2698, 6, 16.50);
+INSERT INTO events VALUES (2701, 7, 16.75);
+INSERT INTO events VALUES (2704, 8, 17.00);
+INSERT INTO events VALUES (2707, 9, 17.25);
+INSERT INTO events VALUES (2710, 10, 17.50);
+INSERT INTO events VALUES (2713, 11, 17.75);
+INSERT INTO events VALUES (2716, 12, 18.00);
+INSERT INTO events VALUES (2719, 13, 18.25);
+INSERT INTO events VALUES (2722, 14, 18.50);
+INSERT INTO events VALUES (2725, 15, 18.75);
+INSERT INTO events VALUES (2728, 0, 19.00);
+INSERT INTO events VALUES (2731, 1, 19.25);
+INSERT INTO events VALUES (2734, 2, 19.50);
+INSERT INTO events VALUES (2737, 3, 19.75);
+INSERT INTO events VALUES (2740, 4, 20.00);
+INSERT INTO events VALUES (2743, 5, 20.25);
+INSERT INTO events VALUES (2746, 6, 20.50);
+INSERT INTO events VALUES (2749, 7, 20.75);
+INSERT INTO events VALUES (2752, 8, 21.00);
+INSERT INTO events VALUES (2755, 9, 21.25);
+INSERT INTO events VALUES (2758, 10, 21.50);
+INSERT INTO events VALUES (2761, 11, 21.75);
+INSERT INTO events VALUES (2764, 12, 22.00);
+INSERT INTO events VALUES (2767, 13, 22.25);
+INSERT INTO events VALUES (2770, 14, 22.50);
+INSERT INTO events VALUES (2773, 15, 22.75);
+INSERT INTO events VALUES (2776, 0, 23.00);
+INSERT INTO events VALUES (2779, 1, 23.25);
+INSERT INTO events VALUES (2782, 2, 23.50);
+INSERT INTO events VALUES (2785, 3, 23.75);
+INSERT INTO events VALUES (2788, 4, 24.00);
+INSERT INTO events VALUES (2791, 5, 24.25);
+INSERT INTO events VALUES (2794, 6, 24.50);
+INSERT INTO events VALUES (2797, 7, 24.75);
+INSERT INTO events VALUES (2800, 8, 0.00);
+INSERT INTO events VALUES (2803, 9, 0.25);
+INSERT INTO events VALUES (2806, 10, 0.50);
+INSERT INTO events VALUES (2809, 11, 0.75);
+INSERT INTO events VALUES (2812, 12, 1.00);
+INSERT INTO events VALUES (2815, 13, 1.25);
+INSERT INTO events VALUES (2818, 14, 1.50);
+INSERT INTO events VALUES (2821, 15, 1.75);
+INSERT INTO events VALUES (2824, 0, 2.00);
+INSERT INTO events VALUES (2827, 1, 2.25);
+INSERT INTO events VALUES (2830, 2, 2.50);
+INSERT INTO events VALUES (2833, 3, 2.75);
+INSERT INTO events VALUES (2836, 4, 3.00);
+INSERT INTO events VALUES (2839, 5, 3.25);
+INSERT INTO events VALUES (2842, 6, 3.50);
+INSERT INTO events VALUES (2845, 7, 3.75);
+INSERT INTO events VALUES (2848, 8, 4.00);
+INSERT INTO events VALUES (2851, 9, 4.25);
+INSERT INTO events VALUES (2854, 10, 4.50);
+INSERT INTO events VALUES (2857, 11, 4.75);
+INSERT INTO events VALUES (2860, 12, 5.00);
+INSERT INTO events VALUES (2863, 13, 5.25);
+INSERT INTO events VALUES (2866, 14, 5.50);
+INSERT INTO events VALUES (2869, 15, 5.75);
+INSERT INTO events VALUES (2872, 0, 6.00);
+INSERT INTO events VALUES (2875, 1, 6.25);
+INSERT INTO events VALUES (2878, 2, 6.50);
+INSERT INTO events VALUES (2881, 3, 6.75);
+INSERT INTO events VALUES (2884, 4, 7.00);
+INSERT INTO events VALUES (2887, 5, 7.25);
+INSERT INTO events VALUES (2890, 6, 7.50);
+INSERT INTO events VALUES (2893, 7, 7.75);
+INSERT INTO events VALUES (2896, 8, 8.00);
+INSERT INTO events VALUES (2899, 9, 8.25);
+INSERT INTO events VALUES (2902, 10, 8.50);
+INSERT INTO events VALUES (2905, 11, 8.75);
+INSERT INTO events VALUES (2908, 12, 9.00);
+INSERT INTO events VALUES (2911, 13, 9.25);
+INSERT INTO events VALUES (2914, 14, 9.50);
+INSERT INTO events VALUES (2917, 15, 9.75);
+INSERT INTO events VALUES (2920, 0, 10.00);
+INSERT INTO events VALUES (2923, 1, 10.25);
+INSERT INTO events VALUES (2926, 2, 10.50);
+INSERT INTO events VALUES (2929, 3, 10.75);
+INSERT INTO events VALUES (2932, 4, 11.00);
+INSERT INTO events VALUES (2935, 5, 11.25);
+INSERT INTO events VALUES (2938, 6, 11.50);
+INSERT INTO events VALUES (2941, 7, 11.75);
+INSERT INTO events VALUES (2944, 8, 12.00);
+INSERT INTO events VALUES (2947, 9, 12.25);
+INSERT INTO events VALUES (2950, 10, 12.50);
+INSERT INTO events VALUES (2953, 11, 12.75);
+INSERT INTO events VALUES (2956, 12, 13.00);
+INSERT INTO events VALUES (2959, 13, 13.25);
+INSERT INTO events VALUES (2962, 14, 13.50);
+INSERT INTO events VALUES (2965, 15, 13.75);
+INSERT INTO events VALUES (2968, 0, 14.00);
+INSERT INTO events VALUES (2971, 1, 14.25);
+INSERT INTO events VALUES (2974, 2, 14.50);
+INSERT INTO events VALUES (2977, 3, 14.75);
+INSERT INTO events VALUES (2980, 4, 15.00);
+INSERT INTO events VALUES (2983, 5, 15.25);
+INSERT INTO events VALUES (2986, 6, 15.50);
+INSERT INTO events VALUES (2989, 7, 15.75);
+INSERT INTO events VALUES (2992, 8, 16.00);
+INSERT INTO events VALUES (2995, 9, 16.25);
+INSERT INTO events VALUES (2998, 10, 16.50);
+INSERT INTO events VALUES (3001, 11, 16.75);
+INSERT INTO events VALUES (3004, 12, 17.00);
+INSERT INTO events VALUES (3007, 13, 17.25);
+INSERT INTO events VALUES (3010, 14, 17.50);
+INSERT INTO events VALUES (3013, 15, 17.75);
+INSERT INTO events VALUES (3016, 0, 18.00);
+INSERT INTO events VALUES (3019, 1, 18.25);
+INSERT INTO events VALUES (3022, 2, 18.50);
+INSERT INTO events VALUES (3025, 3, 18.75);
+INSERT INTO events VALUES (3028, 4, 19.00);
+INSERT INTO events VALUES (3031, 5, 19.25);
+INSERT INTO events VALUES (3034, 6, 19.50);
+INSERT INTO events VALUES (3037, 7, 19.75);
+INSERT INTO events VALUES (3040, 8, 20.00);
+INSERT INTO events VALUES (3043, 9, 20.25);
+INSERT INTO events VALUES (3046, 10, 20.50);
+INSERT INTO events VALUES (3049, 11, 20.75);
+INSERT INTO events VALUES (3052, 12, 21.00);
+INSERT INTO events VALUES (3055, 13, 21.25);
+INSERT INTO events VALUES (3058, 14, 21.50);
+INSERT INTO events VALUES (3061, 15, 21.75);
+INSERT INTO events VALUES (3064, 0, 22.00);
+INSERT INTO events VALUES (3067, 1, 22.25);
+INSERT INTO events VALUES (3070, 2, 22.50);
+INSERT INTO events VALUES (3073, 3, 22.75);
+INSERT INTO events VALUES (3076, 4, 23.00);
+INSERT INTO events VALUES (3079, 5, 23.25);
+INSERT INTO events VALUES (3082, 6, 23.50);
+INSERT INTO events VALUES (3085, 7, 23.75);
+INSERT INTO events VALUES (3088, 8, 24.00);
+INSERT INTO events VALUES (3091, 9, 24.25);
+INSERT INTO events VALUES (3094, 10, 24.50);
+INSERT INTO events VALUES (3097, 11, 24.75);
+INSERT INTO events VALUES (3100, 12, 0.00);
+INSERT INTO events VALUES (3103, 13, 0.25);
+INSERT INTO events VALUES (3106, 14, 0.50);
+INSERT INTO events VALUES (3109, 15, 0.75);
+INSERT INTO events VALUES (3112, 0, 1.00);
+INSERT INTO events VALUES (3115, 1, 1.25);
+INSERT INTO events VALUES (3118, 2, 1.50);
+INSERT INTO events VALUES (3121, 3, 1.75);
+INSERT INTO events VALUES (3124, 4, 2.00);
+INSERT INTO events VALUES (3127, 5, 2.25);
+INSERT INTO events VALUES (3130, 6, 2.50);
+INSERT INTO events VALUES (3133, 7, 2.75);
+INSERT INTO events VALUES (3136, 8, 3.00);
+INSERT INTO events VALUES (3139, 9, 3.25);
+INSERT INTO events VALUES (3142, 10, 3.50);
+INSERT INTO events VALUES (3145, 11, 3.75);
+INSERT INTO events VALUES (3148, 12, 4.00);
+INSERT INTO events VALUES (3151, 13, 4.25);
+INSERT INTO events VALUES (3154, 14, 4.50);
+INSERT INTO events VALUES (3157, 15, 4.75);
+INSERT INTO events VALUES (3160, 0, 5.00);
+INSERT INTO events VALUES (3163, 1, 5.25);
+INSERT INTO events VALUES (3166, 2, 5.50);
+INSERT INTO events VALUES (3169, 3, 5.75);
+INSERT INTO events VALUES (3172, 4, 6.00);
+INSERT INTO events VALUES (3175, 5, 6.25);
+INSERT INTO events VALUES (3178, 6, 6.50);
+INSERT INTO events VALUES (3181, 7, 6.75);
+INSERT INTO events VALUES (3184, 8, 7.00);
+INSERT INTO events VALUES (3187, 9, 7.25);
+INSERT INTO events VALUES (3190, 10, 7.50);
+INSERT INTO events VALUES (3193, 11, 7.75);
+INSERT INTO events VALUES (3196, 12, 8.00);
+INSERT INTO events VALUES (3199, 13, 8.25);
+INSERT INTO events VALUES (3202, 14, 8.50);
+INSERT INTO events VALUES (3205, 15, 8.75);
+INSERT INTO events VALUES (3208, 0, 9.00);
+INSERT INTO events VALUES (3211, 1, 9.25);
+INSERT INTO events VALUES (3214, 2, 9.50);
+INSERT INTO events VALUES (3217, 3, 9.75);
+INSERT INTO events VALUES (3220, 4, 10.00);
+INSERT INTO events VALUES (3223, 5, 10.25);
+INSERT INTO events VALUES (3226, 6, 10.50);
+INSERT INTO events VALUES (3229, 7, 10.75);
+INSERT INTO events VALUES (3232, 8, 11.00);
+INSERT INTO events VALUES (3235, 9, 11.25);
+INSERT INTO events VALUES (3238, 10, 11.50);
+INSERT INTO events VALUES (3241, 11, 11.75);
+INSERT INTO events VALUES (3244, 12, 12.00);
+INSERT INTO events VALUES (3247, 13, 12.25);
+INSERT INTO events VALUES (3250, 14, 12.50);
+INSERT INTO events VALUES (3253, 15, 12.75);
+INSERT INTO events VALUES (3256, 0, 13.00);
+INSERT INTO events VALUES (3259, 1, 13.25);
+INSERT INTO events VALUES (3262, 2, 13.50);
+INSERT INTO events VALUES (3265, 3, 13.75);
+INSERT INTO events VALUES (3268, 4, 14.00);
+INSERT INTO events VALUES (3271, 5, 14.25);
+INSERT INTO events VALUES (3274, 6, 14.50);
+INSERT INTO events VALUES (3277, 7, 14.75);
+INSERT INTO events VALUES (3280, 8, 15.00);
+INSERT INTO events VALUES (3283, 9, 15.25);
+INSERT INTO events VALUES (3286, 10, 15.50);
+INSERT INTO events VALUES (3289, 11, 15.75);
+INSERT INTO events VALUES (3292, 12, 16.00);
+INSERT INTO events VALUES (3295, 13, 16.25);
+INSERT INTO events VALUES (3298, 14, 16.50);
+INSERT INTO events VALUES (3301, 15, 16.75);
+INSERT INTO events VALUES (3304, 0, 17.00);
+INSERT INTO events VALUES (3307, 1, 17.25);
+INSERT INTO events VALUES (3310, 2, 17.50);
+INSERT INTO events VALUES (3313, 3, 17.75);
+INSERT INTO events VALUES (3316, 4, 18.00);
+INSERT INTO events VALUES (3319, 5, 18.25);
+INSERT INTO events VALUES (3322, 6, 18.50);
+INSERT INTO events VALUES (3325, 7, 18.75);
+INSERT INTO events VALUES (3328, 8, 19.00);
+INSERT INTO events VALUES (3331, 9, 19.25);
+INSERT INTO events VALUES (3334, 10, 19.50);
+INSERT INTO events VALUES (3337, 11, 19.75);
+INSERT INTO events VALUES (3340, 12, 20.00);
+INSERT INTO events VALUES (3343, 13, 20.25);
+INSERT INTO events VALUES (3346, 14, 20.50);
+INSERT INTO events VALUES (3349, 15, 20.75);
+INSERT INTO events VALUES (3352, 0, 21.00);
+INSERT INTO events VALUES (3355, 1, 21.25);
+INSERT INTO events VALUES (3358, 2, 21.50);
+INSERT INTO events VALUES (3361, 3, 21.75);
+INSERT INTO events VALUES (3364, 4, 22.00);
+INSERT INTO events VALUES (3367, 5, 22.25);
+INSERT INTO events VALUES (3370, 6, 22.50);
+INSERT INTO events VALUES (3373, 7, 22.75);
+INSERT INTO events VALUES (3376, 8, 23.00);
+INSERT INTO events VALUES (3379, 9, 23.25);
+INSERT INTO events VALUES (3382, 10, 23.50);
+INSERT INTO events VALUES (3385, 11, 23.75);
+INSERT INTO events VALUES (3388, 12, 24.00);
+INSERT INTO events VALUES (3391, 13, 24.25);
+INSERT INTO events VALUES (3394, 14, 24.50);
+INSERT INTO events VALUES (3397, 15, 24.75);
+INSERT INTO events VALUES (3400, 0, 0.00);
+INSERT INTO events VALUES (3403, 1, 0.25);
+INSERT INTO events VALUES (3406, 2, 0.50);
+INSERT INTO events VALUES (3409, 3, 0.75);
+INSERT INTO events VALUES (3412, 4, 1.00);
+INSERT INTO events VALUES (3415, 5, 1.25);
+INSERT INTO events VALUES (3418, 6, 1.50);
+INSERT INTO events VALUES (3421, 7, 1.75);
+INSERT INTO events VALUES (3424, 8, 2.00);
+INSERT INTO events VALUES (3427, 9, 2.25);
+INSERT INTO events VALUES (3430, 10, 2.50);
+INSERT INTO events VALUES (3433, 11, 2.75);
+INSERT INTO events VALUES (3436, 12, 3.00);
+INSERT INTO events VALUES (3439, 13, 3.25);
+INSERT INTO events VALUES (3442, 14, 3.50);
+INSERT INTO events VALUES (3445, 15, 3.75);
+INSERT INTO events VALUES (3448, 0, 4.00);
+INSERT INTO events VALUES (3451, 1, 4.25);
+INSERT INTO events VALUES (3454, 2, 4.50);
+INSERT INTO events VALUES (3457, 3, 4.75);
+INSERT INTO events VALUES (3460, 4, 5.00);
+INSERT INTO events VALUES (3463, 5, 5.25);
+INSERT INTO events VALUES (3466, 6, 5.50);
+INSERT INTO events VALUES (3469, 7, 5.75);
+INSERT INTO events VALUES (3472, 8, 6.00);
+INSERT INTO events VALUES (3475, 9, 6.25);
+INSERT INTO events VALUES (3478, 10, 6.50);
+INSERT INTO events VALUES (3481, 11, 6.75);
+INSERT INTO events VALUES (3484, 12, 7.00);
+INSERT INTO events VALUES (3487, 13, 7.25);
+INSERT INTO events VALUES (3490, 14, 7.50);
+INSERT INTO events VALUES (3493, 15, 7.75);
+INSERT INTO events VALUES (3496, 0, 8.00);
+INSERT INTO events VALUES (3499, 1, 8.25);
+INSERT INTO events VALUES (3502, 2, 8.50);
+INSERT INTO events VALUES (3505, 3, 8.75);
+INSERT INTO events VALUES (3508, 4, 9.00);
+INSERT INTO events VALUES (3511, 5, 9.25);
+INSERT INTO events VALUES (3514, 6, 9.50);
+INSERT INTO events VALUES (3517, 7, 9.75);
+INSERT INTO events VALUES (3520, 8, 10.00);
+INSERT INTO events VALUES (3523, 9, 10.25);
+INSERT INTO events VALUES (3526, 10, 10.50);
+INSERT INTO events VALUES (3529, 11, 10.75);
+INSERT INTO events VALUES (3532, 12, 11.00);
+INSERT INTO events VALUES (3535, 13, 11.25);
+INSERT INTO events VALUES (3538, 14, 11.50);
+INSERT INTO events VALUES (3541, 15, 11.75);
+INSERT INTO events VALUES (3544, 0, 12.00);
+INSERT INTO events VALUES (3547, 1, 12.25);
+INSERT INTO events VALUES (3550, 2, 12.50);
+INSERT INTO events VALUES (3553, 3, 12.75);
+INSERT INTO events VALUES (3556, 4, 13.00);
+INSERT INTO events VALUES (3559, 5, 13.25);
+INSERT INTO events VALUES (3562, 6, 13.50);
+INSERT INTO events VALUES (3565, 7, 13.75);
+INSERT INTO events VALUES (3568, 8, 14.00);
+INSERT INTO events VALUES (3571, 9, 14.25);
+INSERT INTO events VALUES (3574, 10, 14.50);
+INSERT INTO events VALUES (3577, 11, 14.75);
+INSERT INTO events VALUES (3580, 12, 15.00);
+INSERT INTO events VALUES (3583, 13, 15.25);
+INSERT INTO events VALUES (3586, 14, 15.50);
+INSERT INTO events VALUES (3589, 15, 15.75);
+INSERT INTO events VALUES (3592, 0, 16.00);
+INSERT INTO events VALUES (3595, 1, 16.25);
+INSERT INTO events VALUES (3598, 2, 16.50);
+INSERT INTO events VALUES (3601, 3, 16.75);
+INSERT INTO events VALUES (3604, 4, 17.00);
+INSERT INTO events VALUES (3607, 5, 17.25);
+INSERT INTO events VALUES (3610, 6, 17.50);
+INSERT INTO events VALUES (3613, 7, 17.75);
+INSERT INTO events VALUES (3616, 8, 18.00);
+INSERT INTO events VALUES (3619, 9, 18.25);
+INSERT INTO events VALUES (3622, 10, 18.50);
+INSERT INTO events VALUES (3625, 11, 18.75);
+INSERT INTO events VALUES (3628, 12, 19.00);
+INSERT INTO events VALUES (3631, 13, 19.25);
+INSERT INTO events VALUES (3634, 14, 19.50);
+INSERT INTO events VALUES (3637, 15, 19.75);
+INSERT INTO events VALUES (3640, 0, 20.00);
+INSERT INTO events VALUES (3643, 1, 20.25);
+INSERT INTO events VALUES (3646, 2, 20.50);
+INSERT INTO events VALUES (3649, 3, 20.75);
+INSERT INTO events VALUES (3652, 4, 21.00);
+INSERT INTO events VALUES (3655, 5, 21.25);
+INSERT INTO events VALUES (3658, 6, 21.50);
+INSERT INTO events VALUES (3661, 7, 21.75);
+INSERT INTO events VALUES (3664, 8, 22.00);
+INSERT INTO events VALUES (3667, 9, 22.25);
+INSERT INTO events VALUES (3670, 10, 22.50);
+INSERT INTO events VALUES (3673, 11, 22.75);
+INSERT INTO events VALUES (3676, 12, 23.00);
+INSERT INTO events VALUES (3679, 13, 23.25);
+INSERT INTO events VALUES (3682, 14, 23.50);
+INSERT INTO events VALUES (3685, 15, 23.75);
+INSERT INTO events VALUES (3688, 0, 24.00);
+INSERT INTO events VALUES (3691, 1, 24.25);
+INSERT INTO events VALUES (3694, 2, 24.50);
+INSERT INTO events VALUES (3697, 3, 24.75);
+INSERT INTO events VALUES (3700, 4, 0.00);
+INSERT INTO events VALUES (3703, 5, 0.25);
+INSERT INTO events VALUES (3706, 6, 0.50);
+INSERT INTO events VALUES (3709, 7, 0.75);
+INSERT INTO events VALUES (3712, 8, 1.00);
+INSERT INTO events VALUES (3715, 9, 1.25);
+INSERT INTO events VALUES (3718, 10, 1.50);
+INSERT INTO events VALUES (3721, 11, 1.75);
+INSERT INTO events VALUES (3724, 12, 2.00);
+INSERT INTO events VALUES (3727, 13, 2.25);
+INSERT INTO events VALUES (3730, 14, 2.50);
+INSERT INTO events VALUES (3733, 15, 2.75);
+INSERT INTO events VALUES (3736, 0, 3.00);
+INSERT INTO events VALUES (3739, 1, 3.25);
+INSERT INTO events VALUES (3742, 2, 3.50);
+INSERT INTO events VALUES (3745, 3, 3.75);
+INSERT INTO events VALUES (3748, 4, 4.00);
+INSERT INTO events VALUES (3751, 5, 4.25);
+INSERT INTO events VALUES (3754, 6, 4.50);
+INSERT INTO events VALUES (3757, 7, 4.75);
+INSERT INTO events VALUES (3760, 8, 5.00);
+INSERT INTO events VALUES (3763, 9, 5.25);
+INSERT INTO events VALUES (3766, 10, 5.50);
+INSERT INTO events VALUES (3769, 11, 5.75);
+INSERT INTO events VALUES (3772, 12, 6.00);
+INSERT INTO events VALUES (3775, 13, 6.25);
+INSERT INTO events VALUES (3778, 14, 6.50);
+INSERT INTO events VALUES (3781, 15, 6.75);
+INSERT INTO events VALUES (3784, 0, 7.00);
+INSERT INTO events VALUES (3787, 1, 7.25);
+INSERT INTO events VALUES (3790, 2, 7.50);
+INSERT INTO events VALUES (3793, 3, 7.75);
+INSERT INTO events VALUES (3796, 4, 8.00);
+INSERT INTO events VALUES (3799, 5, 8.25);
+INSERT INTO events VALUES (3802, 6, 8.50);
+INSERT INTO events VALUES (3805, 7, 8.75);
+INSERT INTO events VALUES (3808, 8, 9.00);
+INSERT INTO events VALUES (3811, 9, 9.25);
+INSERT INTO events VALUES (3814, 10, 9.50);
+INSERT INTO events VALUES (3817, 11, 9.75);
+INSERT INTO events VALUES (3820, 12, 10.00);
+INSERT INTO events VALUES (3823, 13, 10.25);
+INSERT INTO events VALUES (3826, 14, 10.50);
+INSERT INTO events VALUES (3829, 15, 10.75);
+INSERT INTO events VALUES (3832, 0, 11.00);
+INSERT INTO events VALUES (3835, 1, 11.25);
+INSERT INTO events VALUES (3838, 2, 11.50);
+INSERT INTO events VALUES (3841, 3, 11.75);
+INSERT INTO events VALUES (3844, 4, 12.00);
+INSERT INTO events VALUES (3847, 5, 12.25);
+INSERT INTO events VALUES (3850, 6, 12.50);
+INSERT INTO events VALUES (3853, 7, 12.75);
+INSERT INTO events VALUES (3856, 8, 13.00);
+INSERT INTO events VALUES (3859, 9, 13.25);
+INSERT INTO events VALUES (3862, 10, 13.50);
+INSERT INTO events VALUES (3865, 11, 13.75);
+INSERT INTO events VALUES (3868, 12, 14.00);
+INSERT INTO events VALUES (3871, 13, 14.25);
+INSERT INTO events VALUES (3874, 14, 14.50);
+INSERT INTO events VALUES (3877, 15, 14.75);
+INSERT INTO events VALUES (3880, 0, 15.00);
+INSERT INTO events VALUES (3883, 1, 15.25);
+INSERT INTO events VALUES (3886, 2, 15.50);
+INSERT INTO events VALUES (3889, 3, 15.75);
+INSERT INTO events VALUES (3892, 4, 16.00);
+INSERT INTO events VALUES (3895, 5, 16.25);
+INSERT INTO events VALUES (3898, 6, 16.50);
+INSERT INTO events VALUES (3901, 7, 16.75);
+INSERT INTO events VALUES (3904, 8, 17.00);
+INSERT INTO events VALUES (3907, 9, 17.25);
+INSERT INTO events VALUES (3910, 10, 17.50);
+INSERT INTO events VALUES (3913, 11, 17.75);
+INSERT INTO events VALUES (3916, 12, 18.00);
+INSERT INTO events VALUES (3919, 13, 18.25);
+INSERT INTO events VALUES (3922, 14, 18.50);
+INSERT INTO events VALUES (3925, 15, 18.75);
+INSERT INTO events VALUES (3928, 0, 19.00);
+INSERT INTO events VALUES (3931, 1, 19.25);
+INSERT INTO events VALUES (3934, 2, 19.50);
+INSERT INTO events VALUES (3937, 3, 19.75);
+INSERT INTO events VALUES (3940, 4, 20.00);
+INSERT INTO events VALUES (3943, 5, 20.25);
+INSERT INTO events VALUES (3946, 6, 20.50);
+INSERT INTO events VALUES (3949, 7, 20.75);
+INSERT INTO events VALUES (3952, 8, 21.00);
+INSERT INTO events VALUES (3955, 9, 21.25);
+INSERT INTO events VALUES (3958, 10, 21.50);
+INSERT INTO events VALUES (3961, 11, 21.75);
+INSERT INTO events VALUES (3964, 12, 22.00);
+INSERT INTO events VALUES (3967, 13, 22.25);
+INSERT INTO events VALUES (3970, 14, 22.50);
+INSERT INTO events VALUES (3973, 15, 22.75);
+INSERT INTO events VALUES (3976, 0, 23.00);
+INSERT INTO events VALUES (3979, 1, 23.25);
+INSERT INTO events VALUES (3982, 2, 23.50);
+INSERT INTO events VALUES (3985, 3, 23.75);
+INSERT INTO events VALUES (3988, 4, 24.00);
+INSERT INTO events VALUES (3991, 5, 24.25);
+INSERT INTO events VALUES (3994, 6, 24.50);
+INSERT INTO events VALUES (3997, 7, 24.75);
+INSERT INTO events VALUES (4000, 8, 0.00);
+INSERT INTO events VALUES (4003, 9, 0.25);
+INSERT INTO events VALUES (4006, 10, 0.50);
+INSERT INTO events VALUES (4009, 11, 0.75);
+INSERT INTO events VALUES (4012, 12, 1.00);
+INSERT INTO events VALUES (4015, 13, 1.25);
+INSERT INTO events VALUES (4018, 14, 1.50);
+INSERT INTO events VALUES (4021, 15, 1.75);
+INSERT INTO events VALUES (4024, 0, 2.00);
+INSERT INTO events VALUES (4027, 1, 2.25);
+INSERT INTO events VALUES (4030, 2, 2.50);
+INSERT INTO events VALUES (4033, 3, 2.75);
+INSERT INTO events VALUES (4036, 4, 3.00);
+INSERT INTO events VALUES (4039, 5, 3.25);
+INSERT INTO events VALUES (4042, 6, 3.50);
+INSERT INTO events VALUES (4045, 7, 3.75);
+INSERT INTO events VALUES (4048, 8, 4.00);
+INSERT INTO events VALUES (4051, 9, 4.25);
+INSERT INTO events VALUES (4054, 10, 4.50);
+INSERT INTO events VALUES (4057, 11, 4.75);
+INSERT INTO events VALUES (4060, 12, 5.00);
+INSERT INTO events VALUES (4063, 13, 5.25);
+INSERT INTO events VALUES (4066, 14, 5.50);
+INSERT INTO events VALUES (4069, 15, 5.75);
+INSERT INTO events VALUES (4072, 0, 6.00);
+INSERT INTO events VALUES (4075, 1, 6.25);
+INSERT INTO events VALUES (4078, 2, 6.50);
+INSERT INTO events VALUES (4081, 3, 6.75);
+INSERT INTO events VALUES (4084, 4, 7.00);
+INSERT INTO events VALUES (4087, 5, 7.25);
+INSERT INTO events VALUES (4090, 6, 7.50);
+INSERT INTO events VALUES (4093, 7, 7.75);
+INSERT INTO events VALUES (4096, 8, 8.00);
+INSERT INTO events VALUES (4099, 9, 8.25);
+INSERT INTO events VALUES (4102, 10, 8.50);
+INSERT INTO events VALUES (4105, 11, 8.75);
+INSERT INTO events VALUES (4108, 12, 9.00);
+INSERT INTO events VALUES (4111, 13, 9.25);
+INSERT INTO events VALUES (4114, 14, 9.50);
+INSERT INTO events VALUES (4117, 15, 9.75);
+INSERT INTO events VALUES (4120, 0, 10.00);
+INSERT INTO events VALUES (4123, 1, 10.25);
+INSERT INTO events VALUES (4126, 2, 10.50);
+INSERT INTO events VALUES (4129, 3, 10.75);
+INSERT INTO events VALUES (4132, 4, 11.00);
+INSERT INTO events VALUES (4135, 5, 11.25);
+INSERT INTO events VALUES (4138, 6, 11.50);
+INSERT INTO events VALUES (4141, 7, 11.75);
+INSERT INTO events VALUES (4144, 8, 12.00);
+INSERT INTO events VALUES (4147, 9, 12.25);
+INSERT INTO events VALUES (4150, 10, 12.50);
+INSERT INTO events VALUES (4153, 11, 12.75);
+INSERT INTO events VALUES (4156, 12, 13.00);
+INSERT INTO events VALUES (4159, 13, 13.25);
+INSERT INTO events VALUES (4162, 14, 13.50);
+INSERT INTO events VALUES (4165, 15, 13.75);
+INSERT INTO events VALUES (4168, 0, 14.00);
+INSERT INTO events VALUES (4171, 1, 14.25);
+INSERT INTO events VALUES (4174, 2, 14.50);
+INSERT INTO events VALUES (4177, 3, 14.75);
+INSERT INTO events VALUES (4180, 4, 15.00);
+INSERT INTO events VALUES (4183, 5, 15.25);
+INSERT INTO events VALUES (4186, 6, 15.50);
+INSERT INTO events VALUES (4189, 7, 15.75);
+INSERT INTO events VALUES (4192, 8, 16.00);
+INSERT INTO events VALUES (4195, 9, 16.25);
+INSERT INTO events VALUES (4198, 10, 16.50);
+INSERT INTO events VALUES (4201, 11, 16.75);
+INSERT INTO events VALUES (4204, 12, 17.00);
+INSERT INTO events VALUES (4207, 13, 17.25);
+INSERT INTO events VALUES (4210, 14, 17.50);
+INSERT INTO events VALUES (4213, 15, 17.75);
+INSERT INTO events VALUES (4216, 0, 18.00);
+INSERT INTO events VALUES (4219, 1, 18.25);
+INSERT INTO events VALUES (4222, 2, 18.50);
+INSERT INTO events VALUES (4225, 3, 18.75);
+INSERT INTO events VALUES (4228, 4, 19.00);
+INSERT INTO events VALUES (4231, 5, 19.25);
+INSERT INTO events VALUES (4234, 6, 19.50);
+INSERT INTO events VALUES (4237, 7, 19.75);
+INSERT INTO events VALUES (4240, 8, 20.00);
+INSERT INTO events VALUES (4243, 9, 20.25);
+INSERT INTO events VALUES (4246, 10, 20.50);
+INSERT INTO events VALUES (4249, 11, 20.75);
+INSERT INTO events VALUES (4252, 12, 21.00);
+INSERT INTO events VALUES (4255, 13, 21.25);
+INSERT INTO events VALUES (4258, 14, 21.50);
+INSERT INTO events VALUES (4261, 15, 21.75);
+INSERT INTO events VALUES (4264, 0, 22.00);
+INSERT INTO events VALUES (4267, 1, 22.25);
+INSERT INTO events VALUES (4270, 2, 22.50);
+INSERT INTO events VALUES (4273, 3, 22.75);
+INSERT INTO events VALUES (4276, 4, 23.00);
+INSERT INTO events VALUES (4279, 5, 23.25);
+INSERT INTO events VALUES (4282, 6, 23.50);
+INSERT INTO events VALUES (4285, 7, 23.75);
+INSERT INTO events VALUES (4288, 8, 24.00);
+INSERT INTO events VALUES (4291, 9, 24.25);
+INSERT INTO events VALUES (4294, 10, 24.50);
+INSERT INTO events VALUES (4297, 11, 24.75);
+INSERT INTO events VALUES (4300, 12, 0.00);
+INSERT INTO events VALUES (4303, 13, 0.25);
+INSERT INTO events VALUES (4306, 14, 0.50);
+INSERT INTO events VALUES (4309, 15, 0.75);
+INSERT INTO events VALUES (4312, 0, 1.00);
+INSERT INTO events VALUES (4315, 1, 1.25);
+INSERT INTO events VALUES (4318, 2, 1.50);
+INSERT INTO events VALUES (4321, 3, 1.75);
+INSERT INTO events VALUES (4324, 4, 2.00);
+INSERT INTO events VALUES (4327, 5, 2.25);
+INSERT INTO events VALUES (4330, 6, 2.50);
+INSERT INTO events VALUES (4333, 7, 2.75);
+INSERT INTO events VALUES (4336, 8, 3.00);
+INSERT INTO events VALUES (4339, 9, 3.25);
+INSERT INTO events VALUES (4342, 10, 3.50);
+INSERT INTO events VALUES (4345, 11, 3.75);
+INSERT INTO events VALUES (4348, 12, 4.00);
+INSERT INTO events VALUES (4351, 13, 4.25);
+INSERT INTO events VALUES (4354, 14, 4.50);
+INSERT INTO events VALUES (4357, 15, 4.75);
+INSERT INTO events VALUES (4360, 0, 5.00);
+INSERT INTO events VALUES (4363, 1, 5.25);
+INSERT INTO events VALUES (4366, 2, 5.50);
+INSERT INTO events VALUES (4369, 3, 5.75);
+INSERT INTO events VALUES (4372, 4, 6.00);
+INSERT INTO events VALUES (4375, 5, 6.25);
+INSERT INTO events VALUES (4378, 6, 6.50);
+INSERT INTO events VALUES (4381, 7, 6.75);
+INSERT INTO events VALUES (4384, 8, 7.00);
+INSERT INTO events VALUES (4387, 9, 7.25);
+INSERT INTO events VALUES (4390, 10, 7.50);
+INSERT INTO events VALUES (4393, 11, 7.75);
+INSERT INTO events VALUES (4396, 12, 8.00);
+INSERT INTO events VALUES (4399, 13, 8.25);
+INSERT INTO events VALUES (4402, 14, 8.50);
+INSERT INTO events VALUES (4405, 15, 8.75);
+INSERT INTO events VALUES (4408, 0, 9.00);
+INSERT INTO events VALUES (4411, 1, 9.25);
+INSERT INTO events VALUES (4414, 2, 9.50);
+INSERT INTO events VALUES (4417, 3, 9.75);
+INSERT INTO events VALUES (4420, 4, 10.00);
+INSERT INTO events VALUES (4423, 5, 10.25);
+INSERT INTO events VALUES (4426, 6, 10.50);
+INSERT INTO events VALUES (4429, 7, 10.75);
+INSERT INTO events VALUES (4432, 8, 11.00);
+INSERT INTO events VALUES (4435, 9, 11.25);
+INSERT INTO events VALUES (4438, 10, 11.50);
+INSERT INTO events VALUES (4441, 11, 11.75);
+INSERT INTO events VALUES (4444, 12, 12.00);
+INSERT INTO events VALUES (4447, 13, 12.25);
+INSERT INTO events VALUES (4450, 14, 12.50);
+INSERT INTO events VALUES (4453, 15, 12.75);
+INSERT INTO events VALUES (4456, 0, 13.00);
+INSERT INTO events VALUES (4459, 1, 13.25);
+INSERT INTO events VALUES (4462, 2, 13.50);
+INSERT INTO events VALUES (4465, 3, 13.75);
+INSERT INTO events VALUES (4468, 4, 14.00);
+INSERT INTO events VALUES (4471, 5, 14.25);
+INSERT INTO events VALUES (4474, 6, 14.50);
+INSERT INTO events VALUES (4477, 7, 14.75);
+INSERT INTO events VALUES (4480, 8, 15.00);
+INSERT INTO events VALUES (4483, 9, 15.25);
+INSERT INTO events VALUES (4486, 10, 15.50);
+INSERT INTO events VALUES (4489, 11, 15.75);
+INSERT INTO events VALUES (4492, 12, 16.00);
+INSERT INTO events VALUES (4495, 13, 16.25);
+INSERT INTO events VALUES (4498, 14, 16.50);
+INSERT INTO events VALUES (4501, 15, 16.75);
+INSERT INTO events VALUES (4504, 0, 17.00);
+INSERT INTO events VALUES (4507, 1, 17.25);
+INSERT INTO events VALUES (4510, 2, 17.50);
+INSERT INTO events VALUES (4513, 3, 17.75);
+INSERT INTO events VALUES (4516, 4, 18.00);
+INSERT INTO events VALUES (4519, 5, 18.25);
+INSERT INTO events VALUES (4522, 6, 18.50);
+INSERT INTO events VALUES (4525, 7, 18.75);
+INSERT INTO events VALUES (4528, 8, 19.00);
+INSERT INTO events VALUES (4531, 9, 19.25);
+INSERT INTO events VALUES (4534, 10, 19.50);
+INSERT INTO events VALUES (4537, 11, 19.75);
+INSERT INTO events VALUES (4540, 12, 20.00);
+INSERT INTO events VALUES (4543, 13, 20.25);
+INSERT INTO events VALUES (4546, 14, 20.50);
+INSERT INTO events VALUES (4549, 15, 20.75);
+INSERT INTO events VALUES (4552, 0, 21.00);
+INSERT INTO events VALUES (4555, 1, 21.25);
+INSERT INTO events VALUES (4558, 2, 21.50);
+INSERT INTO events VALUES (4561, 3, 21.75);
+INSERT INTO events VALUES (4564, 4, 22.00);
+INSERT INTO events VALUES (4567, 5, 22.25);
+INSERT INTO events VALUES (4570, 6, 22.50);
+INSERT INTO events VALUES (4573, 7, 22.75);
+INSERT INTO events VALUES (4576, 8, 23.00);
+INSERT INTO events VALUES (4579, 9, 23.25);
+INSERT INTO events VALUES (4582, 10, 23.50);
+INSERT INTO events VALUES (4585, 11, 23.75);
+INSERT INTO events VALUES (4588, 12, 24.00);
+INSERT INTO events VALUES (4591, 13, 24.25);
+INSERT INTO events VALUES (4594, 14, 24.50);
+INSERT INTO events VALUES (4597, 15, 24.75);
+INSERT INTO events VALUES (4600, 0, 0.00);
+INSERT INTO events VALUES (4603, 1, 0.25);
+INSERT INTO events VALUES (4606, 2, 0.50);
+INSERT INTO events VALUES (4609, 3, 0.75);
+INSERT INTO events VALUES (4612, 4, 1.00);
+INSERT INTO events VALUES (4615, 5, 1.25);
+INSERT INTO events VALUES (4618, 6, 1.50);
+INSERT INTO events VALUES (4621, 7, 1.75);
+INSERT INTO events VALUES (4624, 8, 2.00);
+INSERT INTO events VALUES (4627, 9, 2.25);
+INSERT INTO events VALUES (4630, 10, 2.50);
+INSERT INTO events VALUES (4633, 11, 2.75);
+INSERT INTO events VALUES (4636, 12, 3.00);
+INSERT INTO events VALUES (4639, 13, 3.25);
+INSERT INTO events VALUES (4642, 14, 3.50);
+INSERT INTO events VALUES (4645, 15, 3.75);
+INSERT INTO events VALUES (4648, 0, 4.00);
+INSERT INTO events VALUES (4651, 1, 4.25);
+INSERT INTO events VALUES (4654, 2, 4.50);
+INSERT INTO events VALUES (4657, 3, 4.75);
+INSERT INTO events VALUES (4660, 4, 5.00);
+INSERT INTO events VALUES (4663, 5, 5.25);
+INSERT INTO events VALUES (4666, 6, 5.50);
+INSERT INTO events VALUES (4669, 7, 5.75);
+INSERT INTO events VALUES (4672, 8, 6.00);
+INSERT INTO events VALUES (4675, 9, 6.25);
+INSERT INTO events VALUES (4678, 10, 6.50);
+INSERT INTO events VALUES (4681, 11, 6.75);
+INSERT INTO events VALUES (4684, 12, 7.00);
+INSERT INTO events VALUES (4687, 13, 7.25);
+INSERT INTO events VALUES (4690, 14, 7.50);
+INSERT INTO events VALUES (4693, 15, 7.75);
+INSERT INTO events VALUES (4696, 0, 8.00);
+INSERT INTO events VALUES (4699, 1, 8.25);
+INSERT INTO events VALUES (4702, 2, 8.50);
+INSERT INTO events VALUES (4705, 3, 8.75);
+INSERT INTO events VALUES (4708, 4, 9.00);
+INSERT INTO events VALUES (4711, 5, 9.25);
+INSERT INTO events VALUES (4714, 6, 9.50);
+INSERT INTO events VALUES (4717, 7, 9.75);
+INSERT INTO events VALUES (4720, 8, 10.00);
+INSERT INTO events VALUES (4723, 9, 10.25);
+INSERT INTO events VALUES (4726, 10, 10.50);
+INSERT INTO events VALUES (4729, 11, 10.75);
+INSERT INTO events VALUES (4732, 12, 11.00);
+INSERT INTO events VALUES (4735, 13, 11.25);
+INSERT INTO events VALUES (4738, 14, 11.50);
+INSERT INTO events VALUES (4741, 15, 11.75);
+INSERT INTO events VALUES (4744, 0, 12.00);
+INSERT INTO events VALUES (4747, 1, 12.25);
+INSERT INTO events VALUES (4750, 2, 12.50);
+INSERT INTO events VALUES (4753, 3, 12.75);
+INSERT INTO events VALUES (4756, 4, 13.00);
+INSERT INTO events VALUES (4759, 5, 13.25);
+INSERT INTO events VALUES (4762, 6, 13.50);
+INSERT INTO events VALUES (4765, 7, 13.75);
+INSERT INTO events VALUES (4768, 8, 14.00);
+INSERT INTO events VALUES (4771, 9, 14.25);
+INSERT INTO events VALUES (4774, 10, 14.50);
+INSERT INTO events VALUES (4777, 11, 14.75);
+INSERT INTO events VALUES (4780, 12, 15.00);
+INSERT INTO events VALUES (4783, 13, 15.25);
+INSERT INTO events VALUES (4786, 14, 15.50);
+INSERT INTO events VALUES (4789, 15, 15.75);
+INSERT INTO events VALUES (4792, 0, 16.00);
+INSERT INTO events VALUES (4795, 1, 16.25);
+INSERT INTO events VALUES (4798, 2, 16.50);
+INSERT INTO events VALUES (4801, 3, 16.75);
+INSERT INTO events VALUES (4804, 4, 17.00);
+INSERT INTO events VALUES (4807, 5, 17.25);
+INSERT INTO events VALUES (4810, 6, 17.50);
+INSERT INTO events VALUES (4813, 7, 17.75);
+INSERT INTO events VALUES (4816, 8, 18.00);
+INSERT INTO events VALUES (4819, 9, 18.25);
+INSERT INTO events VALUES (4822, 10, 18.50);
+INSERT INTO events VALUES (4825, 11, 18.75);
+INSERT INTO events VALUES (4828, 12, 19.00);
+INSERT INTO events VALUES (4831, 13, 19.25);
+INSERT INTO events VALUES (4834, 14, 19.50);
+INSERT INTO events VALUES (4837, 15, 19.75);
+INSERT INTO events VALUES (4840, 0, 20.00);
+INSERT INTO events VALUES (4843, 1, 20.25);
+INSERT INTO events VALUES (4846, 2, 20.50);
+INSERT INTO events VALUES (4849, 3, 20.75);
+INSERT INTO events VALUES (4852, 4, 21.00);
+INSERT INTO events VALUES (4855, 5, 21.25);
+INSERT INTO events VALUES (4858, 6, 21.50);
+INSERT INTO events VALUES (4861, 7, 21.75);
+INSERT INTO events VALUES (4864, 8, 22.00);
+INSERT INTO events VALUES (4867, 9, 22.25);
+INSERT INTO events VALUES (4870, 10, 22.50);
+INSERT INTO events VALUES (4873, 11, 22.75);
+INSERT INTO events VALUES (4876, 12, 23.00);
+INSERT INTO events VALUES (4879, 13, 23.25);
+INSERT INTO events VALUES (4882, 14, 23.50);
+INSERT INTO events VALUES (4885, 15, 23.75);
+INSERT INTO events VALUES (4888, 0, 24.00);
+INSERT INTO events VALUES (4891, 1, 24.25);
+INSERT INTO events VALUES (4894, 2, 24.50);
+INSERT INTO events VALUES (4897, 3, 24.75);
+INSERT INTO events VALUES (4900, 4, 0.00);
+INSERT INTO events VALUES (4903, 5, 0.25);
+INSERT INTO events VALUES (4906, 6, 0.50);
+INSERT INTO events VALUES (4909, 7, 0.75);
+INSERT INTO events VALUES (4912, 8, 1.00);
+INSERT INTO events VALUES (4915, 9, 1.25);
+INSERT INTO events VALUES (4918, 10, 1.50);
+INSERT INTO events VALUES (4921, 11, 1.75);
+INSERT INTO events VALUES (4924, 12, 2.00);
+INSERT INTO events VALUES (4927, 13, 2.25);
+INSERT INTO events VALUES (4930, 14, 2.50);
+INSERT INTO events VALUES (4933, 15, 2.75);
+INSERT INTO events VALUES (4936, 0, 3.00);
+INSERT INTO events VALUES (4939, 1, 3.25);
+INSERT INTO events VALUES (4942, 2, 3.50);
+INSERT INTO events VALUES (4945, 3, 3.75);
+INSERT INTO events VALUES (4948, 4, 4.00);
+INSERT INTO events VALUES (4951, 5, 4.25);
+INSERT INTO events VALUES (4954, 6, 4.50);
+INSERT INTO events VALUES (4957, 7, 4.75);
+INSERT INTO events VALUES (4960, 8, 5.00);
+INSERT INTO events VALUES (4963, 9, 5.25);
+INSERT INTO events VALUES (4966, 10, 5.50);
+INSERT INTO events VALUES (4969, 11, 5.75);
+INSERT INTO events VALUES (4972, 12, 6.00);
+INSERT INTO events VALUES (4975, 13, 6.25);
+INSERT INTO events VALUES (4978, 14, 6.50);
+INSERT INTO events VALUES (4981, 15, 6.75);
+INSERT INTO events VALUES (4984, 0, 7.00);
+INSERT INTO events VALUES (4987, 1, 7.25);
+INSERT INTO events VALUES (4990, 2, 7.50);
+INSERT INTO events VALUES (4993, 3, 7.75);
+INSERT INTO events VALUES (4996, 4, 8.00);
+INSERT INTO events VALUES (4999, 5, 8.25);
+INSERT INTO events VALUES (5002, 6, 8.50);
+INSERT INTO events VALUES (5005, 7, 8.75);
+INSERT INTO events VALUES (5008, 8, 9.00);
+INSERT INTO events VALUES (5011, 9, 9.25);
+INSERT INTO events VALUES (5014, 10, 9.50);
+INSERT INTO events VALUES (5017, 11, 9.75);
+INSERT INTO events VALUES (5020, 12, 10.00);
+INSERT INTO events VALUES (5023, 13, 10.25);
+INSERT INTO events VALUES (5026, 14, 10.50);
+INSERT INTO events VALUES (5029, 15, 10.75);
+INSERT INTO events VALUES (5032, 0, 11.00);
+INSERT INTO events VALUES (5035, 1, 11.25);
+INSERT INTO events VALUES (5038, 2, 11.50);
+INSERT INTO events VALUES (5041, 3, 11.75);
+INSERT INTO events VALUES (5044, 4, 12.00);
+INSERT INTO events VALUES (5047, 5, 12.25);
+INSERT INTO events VALUES (5050, 6, 12.50);
+INSERT INTO events VALUES (5053, 7, 12.75);
+INSERT INTO events VALUES (5056, 8, 13.00);
+INSERT INTO events VALUES (5059, 9, 13.25);
+INSERT INTO events VALUES (5062, 10, 13.50);
+INSERT INTO events VALUES (5065, 11, 13.75);
+INSERT INTO events VALUES (5068, 12, 14.00);
+INSERT INTO events VALUES (5071, 13, 14.25);
+INSERT INTO events VALUES (5074, 14, 14.50);
+INSERT INTO events VALUES (5077, 15, 14.75);
+INSERT INTO events VALUES (5080, 0, 15.00);
+INSERT INTO events VALUES (5083, 1, 15.25);
+INSERT INTO events VALUES (5086, 2, 15.50);
+INSERT INTO events VALUES (5089, 3, 15.75);
+INSERT INTO events VALUES (5092, 4, 16.00);
+INSERT INTO events VALUES (5095, 5, 16.25);
+INSERT INTO events VALUES (5098, 6, 16.50);
+INSERT INTO events VALUES (5101, 7, 16.75);
+INSERT INTO events VALUES (5104, 8, 17.00);
+INSERT INTO events VALUES (5107, 9, 17.25);
+INSERT INTO events VALUES (5110, 10, 17.50);
+INSERT INTO events VALUES (5113, 11, 17.75);
+INSERT INTO events VALUES (5116, 12, 18.00);
+INSERT INTO events VALUES (5119, 13, 18.25);
+INSERT INTO events VALUES (5122, 14, 18.50);
+INSERT INTO events VALUES (5125, 15, 18.75);
+INSERT INTO events VALUES (5128, 0, 19.00);
+INSERT INTO events VALUES (5131, 1, 19.25);
+INSERT INTO events VALUES (5134, 2, 19.50);
+INSERT INTO events VALUES (5137, 3, 19.75);
+INSERT INTO events VALUES (5140, 4, 20.00);
+INSERT INTO events VALUES (5143, 5, 20.25);
+INSERT INTO events VALUES (5146, 6, 20.50);
+INSERT INTO events VALUES (5149, 7, 20.75);
+INSERT INTO events VALUES (5152, 8, 21.00);
+INSERT INTO events VALUES (5155, 9, 21.25);
+INSERT INTO events VALUES (5158, 10, 21.50);
+INSERT INTO events VALUES (5161, 11, 21.75);
+INSERT INTO events VALUES (5164, 12, 22.00);
+INSERT INTO events VALUES (5167, 13, 22.25);
+INSERT INTO events VALUES (5170, 14, 22.50);
+INSERT INTO events VALUES (5173, 15, 22.75);
+INSERT INTO events VALUES (5176, 0, 23.00);
+INSERT INTO events VALUES (5179, 1, 23.25);
+INSERT INTO events VALUES (5182, 2, 23.50);
+INSERT INTO events VALUES (5185, 3, 23.75);
+INSERT INTO events VALUES (5188, 4, 24.00);
+INSERT INTO events VALUES (5191, 5, 24.25);
+INSERT INTO events VALUES (5194, 6, 24.50);
+INSERT INTO events VALUES (5197, 7, 24.75);
+INSERT INTO events VALUES (5200, 8, 0.00);
+INSERT INTO events VALUES (5203, 9, 0.25);
+INSERT INTO events VALUES (5206, 10, 0.50);
+INSERT INTO events VALUES (5209, 11, 0.75);
+INSERT INTO events VALUES (5212, 12, 1.00);
+INSERT INTO events VALUES (5215, 13, 1.25);
+INSERT INTO events VALUES (5218, 14, 1.50);
+INSERT INTO events VALUES (5221, 15, 1.75);
+INSERT INTO events VALUES (5224, 0, 2.00);
+INSERT INTO events VALUES (5227, 1, 2.25);
+INSERT INTO events VALUES (5230, 2, 2.50);
+INSERT INTO events VALUES (5233, 3, 2.75);
+INSERT INTO events VALUES (5236, 4, 3.00);
+INSERT INTO events VALUES (5239, 5, 3.25);
+INSERT INTO events VALUES (5242, 6, 3.50);
+INSERT INTO events VALUES (5245, 7, 3.75);
+INSERT INTO events VALUES (5248, 8, 4.00);
+INSERT INTO events VALUES (5251, 9, 4.25);
+INSERT INTO events VALUES (5254, 10, 4.50);
+INSERT INTO events VALUES (5257, 11, 4.75);
+INSERT INTO events VALUES (5260, 12, 5.00);
+INSERT INTO events VALUES (5263, 13, 5.25);
+INSERT INTO events VALUES (5266, 14, 5.50);
+INSERT INTO events VALUES (5269, 15, 5.75);
+INSERT INTO events VALUES (5272, 0, 6.00);
+INSERT INTO events VALUES (5275, 1, 6.25);
+INSERT INTO events VALUES (5278, 2, 6.50);
+INSERT INTO events VALUES (5281, 3, 6.75);
+INSERT INTO events VALUES (5284, 4, 7.00);
+INSERT INTO events VALUES (5287, 5, 7.25);
+INSERT INTO events VALUES (5290, 6, 7.50);
+INSERT INTO events VALUES (5293, 7, 7.75);
+INSERT INTO events VALUES (5296, 8, 8.00);
+INSERT INTO events VALUES (5299, 9, 8.25);
+INSERT INTO events VALUES (5302, 10, 8.50);
+INSERT INTO events VALUES (5305, 11, 8.75);
+INSERT INTO events VALUES (5308, 12, 9.00);
+INSERT INTO events VALUES (5311, 13, 9.25);
+INSERT INTO events VALUES (5314, 14, 9.50);
+INSERT INTO events VALUES (5317, 15, 9.75);
+INSERT INTO events VALUES (5320, 0, 10.00);
+INSERT INTO events VALUES (5323, 1, 10.25);
+INSERT INTO events VALUES (5326, 2, 10.50);
+INSERT INTO events VALUES (5329, 3, 10.75);
+INSERT INTO events VALUES (5332, 4, 11.00);
+INSERT INTO events VALUES (5335, 5, 11.25);
+INSERT INTO events VALUES (5338, 6, 11.50);
+INSERT INTO events VALUES (5341, 7, 11.75);
+INSERT INTO events VALUES (5344, 8, 12.00);
+INSERT INTO events VALUES (5347, 9, 12.25);
+INSERT INTO events VALUES (5350, 10, 12.50);
+INSERT INTO events VALUES (5353, 11, 12.75);
+INSERT INTO events VALUES (5356, 12, 13.00);
+INSERT INTO events VALUES (5359, 13, 13.25);
+INSERT INTO events VALUES (5362, 14, 13.50);
+INSERT INTO events VALUES (5365, 15, 13.75);
+INSERT INTO events VALUES (5368, 0, 14.00);
+INSERT INTO events VALUES (5371, 1, 14.25);
+INSERT INTO events VALUES (5374, 2, 14.50);
+INSERT INTO events VALUES (5377, 3, 14.75);
+INSERT INTO events VALUES (5380, 4, 15.00);
+INSERT INTO events VALUES (5383, 5, 15.25);
+INSERT INTO events VALUES (5386, 6, 15.50);
+INSERT INTO events VALUES (5389, 7, 15.75);
+INSERT INTO events VALUES (5392, 8, 16.00);
+INSERT INTO events VALUES (5395, 9, 16.25);
+INSERT INTO events VALUES (5398, 10, 16.50);
+INSERT INTO events VALUES (5401, 11, 16.75);
+INSERT INTO events VALUES (5404, 12, 17.00);
+INSERT INTO events VALUES (5407, 13, 17.25);
+INSERT INTO events VALUES (5410, 14, 17.50);
+INSERT INTO events VALUES (5413, 15, 17.75);
+INSERT INTO events VALUES (5416, 0, 18.00);
+INSERT INTO events VALUES (5419, 1, 18.25);
+INSERT INTO events VALUES (5422, 2, 18.50);
+INSERT INTO events VALUES (5425, 3, 18.75);
+INSERT INTO events VALUES (5428, 4, 19.00);
+INSERT INTO events VALUES (5431, 5, 19.25);
+INSERT INTO events VALUES (5434, 6, 19.50);
+INSERT INTO events VALUES (5437, 7, 19.75);
+INSERT INTO events VALUES (5440, 8, 20.00);
+INSERT INTO events VALUES (5443, 9, 20.25);
+INSERT INTO events VALUES (5446, 10, 20.50);
+INSERT INTO events VALUES (5449, 11, 20.75);
+INSERT INTO events VALUES (5452, 12, 21.00);
+INSERT INTO events VALUES (5455, 13, 21.25);
+INSERT INTO events VALUES (5458, 14, 21.50);
+INSERT INTO events VALUES (5461, 15, 21.75);
+INSERT INTO events VALUES (5464, 0, 22.00);
+INSERT INTO events VALUES (5467, 1, 22.25);
+INSERT INTO events VALUES (5470, 2, 22.50);
+INSERT INTO events VALUES (5473, 3, 22.75);
+INSERT INTO events VALUES (5476, 4, 23.00);
+INSERT INTO events VALUES (5479, 5, 23.25);
+INSERT INTO events VALUES (5482, 6, 23.50);
+INSERT INTO events VALUES (5485, 7, 23.75);
+INSERT INTO events VALUES (5488, 8, 24.00);
+INSERT INTO events VALUES (5491, 9, 24.25);
+INSERT INTO events VALUES (5494, 10, 24.50);
+INSERT INTO events VALUES (5497, 11, 24.75);
+INSERT INTO events VALUES (5500, 12, 0.00);
+INSERT INTO events VALUES (5503, 13, 0.25);
+INSERT INTO events VALUES (5506, 14, 0.50);
+INSERT INTO events VALUES (5509, 15, 0.75);
+INSERT INTO events VALUES (5512, 0, 1.00);
+INSERT INTO events VALUES (5515, 1, 1.25);
+INSERT INTO events VALUES (5518, 2, 1.50);
+INSERT INTO events VALUES (5521, 3, 1.75);
+INSERT INTO events VALUES (5524, 4, 2.00);
+INSERT INTO events VALUES (5527, 5, 2.25);
+INSERT INTO events VALUES (5530, 6, 2.50);
+INSERT INTO events VALUES (5533, 7, 2.75);
+INSERT INTO events VALUES (5536, 8, 3.00);
+INSERT INTO events VALUES (5539, 9, 3.25);
+INSERT INTO events VALUES (5542, 10, 3.50);
+INSERT INTO events VALUES (5545, 11, 3.75);
+INSERT INTO events VALUES (5548, 12, 4.00);
+INSERT INTO events VALUES (5551, 13, 4.25);
+INSERT INTO events VALUES (5554, 14, 4.50);
+INSERT INTO events VALUES (5557, 15, 4.75);
+INSERT INTO events VALUES (5560, 0, 5.00);
+INSERT INTO events VALUES (5563, 1, 5.25);
+INSERT INTO events VALUES (5566, 2, 5.50);
+INSERT INTO events VALUES (5569, 3, 5.75);
+INSERT INTO events VALUES (5572, 4, 6.00);
+INSERT INTO events VALUES (5575, 5, 6.25);
+INSERT INTO events VALUES (5578, 6, 6.50);
+INSERT INTO events VALUES (5581, 7, 6.75);
+INSERT INTO events VALUES (5584, 8, 7.00);
+INSERT INTO events VALUES (5587, 9, 7.25);
+INSERT INTO events VALUES (5590, 10, 7.50);
+INSERT INTO events VALUES (5593, 11, 7.75);
+INSERT INTO events VALUES (5596, 12, 8.00);
+INSERT INTO events VALUES (5599, 13, 8.25);
+INSERT INTO events VALUES (5602, 14, 8.50);
+INSERT INTO events VALUES (5605, 15, 8.75);
+INSERT INTO events VALUES (5608, 0, 9.00);
+INSERT INTO events VALUES (5611, 1, 9.25);
+INSERT INTO events VALUES (5614, 2, 9.50);
+INSERT INTO events VALUES (5617, 3, 9.75);
+INSERT INTO events VALUES (5620, 4, 10.00);
+INSERT INTO events VALUES (5623, 5, 10.25);
+INSERT INTO events VALUES (5626, 6, 10.50);
+INSERT INTO events VALUES (5629, 7, 10.75);
+INSERT INTO events VALUES (5632, 8, 11.00);
+INSERT INTO events VALUES (5635, 9, 11.25);
+INSERT INTO events VALUES (5638, 10, 11.50);
+INSERT INTO events VALUES (5641, 11, 11.75);
+INSERT INTO events VALUES (5644, 12, 12.00);
+INSERT INTO events VALUES (5647, 13, 12.25);
+INSERT INTO events VALUES (5650, 14, 12.50);
+INSERT INTO events VALUES (5653, 15, 12.75);
+INSERT INTO events VALUES (5656, 0, 13.00);
+INSERT INTO events VALUES (5659, 1, 13.25);
+INSERT INTO events VALUES (5662, 2, 13.50);
+INSERT INTO events VALUES (5665, 3, 13.75);
+INSERT INTO events VALUES (5668, 4, 14.00);
+INSERT INTO events VALUES (5671, 5, 14.25);
+INSERT INTO events VALUES (5674, 6, 14.50);
+INSERT INTO events VALUES (5677, 7, 14.75);
+INSERT INTO events VALUES (5680, 8, 15.00);
+INSERT INTO events VALUES (5683, 9, 15.25);
+INSERT INTO events VALUES (5686, 10, 15.50);
+INSERT INTO events VALUES (5689, 11, 15.75);
+INSERT INTO events VALUES (5692, 12, 16.00);
+INSERT INTO events VALUES (5695, 13, 16.25);
+INSERT INTO events VALUES (5698, 14, 16.50);
+INSERT INTO events VALUES (5701, 15, 16.75);
+INSERT INTO events VALUES (5704, 0, 17.00);
+INSERT INTO events VALUES (5707, 1, 17.25);
+INSERT INTO events VALUES (5710, 2, 17.50);
+INSERT INTO events VALUES (5713, 3, 17.75);
+INSERT INTO events VALUES (5716, 4, 18.00);
+INSERT INTO events VALUES (5719, 5, 18.25);
+INSERT INTO events VALUES (5722, 6, 18.50);
+INSERT INTO events VALUES (5725, 7, 18.75);
+INSERT INTO events VALUES (5728, 8, 19.00);
+INSERT INTO events VALUES (5731, 9, 19.25);
+INSERT INTO events VALUES (5734, 10, 19.50);
+INSERT INTO events VALUES (5737, 11, 19.75);
+INSERT INTO events VALUES (5740, 12, 20.00);
+INSERT INTO events VALUES (5743, 13, 20.25);
+INSERT INTO events VALUES (5746, 14, 20.50);
+INSERT INTO events VALUES (5749, 15, 20.75);
+INSERT INTO events VALUES (5752, 0, 21.00);
+INSERT INTO events VALUES (5755, 1, 21.25);
+INSERT INTO events VALUES (5758, 2, 21.50);
+INSERT INTO events VALUES (5761, 3, 21.75);
+INSERT INTO events VALUES (5764, 4, 22.00);
+INSERT INTO events VALUES (5767, 5, 22.25);
+INSERT INTO events VALUES (5770, 6, 22.50);
+INSERT INTO events VALUES (5773, 7, 22.75);
+INSERT INTO events VALUES (5776, 8, 23.00);
+INSERT INTO events VALUES (5779, 9, 23.25);
+INSERT INTO events VALUES (5782, 10, 23.50);
+INSERT INTO events VALUES (5785, 11, 23.75);
+INSERT INTO events VALUES (5788, 12, 24.00);
+INSERT INTO events VALUES (5791, 13, 24.25);
+INSERT INTO events VALUES (5794, 14, 24.50);
+INSERT INTO events VALUES (5797, 15, 24.75);
+INSERT INTO events VALUES (5800, 0, 0.00);
+INSERT INTO events VALUES (5803, 1, 0.25);
+INSERT INTO events VALUES (5806, 2, 0.50);
+INSERT INTO events VALUES (5809, 3, 0.75);
+INSERT INTO events VALUES (5812, 4, 1.00);
+INSERT INTO events VALUES (5815, 5, 1.25);
+INSERT INTO events VALUES (5818, 6, 1.50);
+INSERT INTO events VALUES (5821, 7, 1.75);
+INSERT INTO events VALUES (5824, 8, 2.00);
+INSERT INTO events VALUES (5827, 9, 2.25);
+INSERT INTO events VALUES (5830, 10, 2.50);
+INSERT INTO events VALUES (5833, 11, 2.75);
+INSERT INTO events VALUES (5836, 12, 3.00);
+INSERT INTO events VALUES (5839, 13, 3.25);
+INSERT INTO events VALUES (5842, 14, 3.50);
+INSERT INTO events VALUES (5845, 15, 3.75);
+INSERT INTO events VALUES (5848, 0, 4.00);
+INSERT INTO events VALUES (5851, 1, 4.25);
+INSERT INTO events VALUES (5854, 2, 4.50);
+INSERT INTO events VALUES (5857, 3, 4.75);
+INSERT INTO events VALUES (5860, 4, 5.00);
+INSERT INTO events VALUES (5863, 5, 5.25);
+INSERT INTO events VALUES (5866, 6, 5.50);
+INSERT INTO events VALUES (5869, 7, 5.75);
+INSERT INTO events VALUES (5872, 8, 6.00);
+INSERT INTO events VALUES (5875, 9, 6.25);
+INSERT INTO events VALUES (5878, 10, 6.50);
+INSERT INTO events VALUES (5881, 11, 6.75);
+INSERT INTO events VALUES (5884, 12, 7.00);
+INSERT INTO events VALUES (5887, 13, 7.25);
+INSERT INTO events VALUES (5890, 14, 7.50);
+INSERT INTO events VALUES (5893, 15, 7.75);
+INSERT INTO events VALUES (5896, 0, 8.00);
+INSERT INTO events VALUES (5899, 1, 8.25);
+INSERT INTO events VALUES (5902, 2, 8.50);
+INSERT INTO events VALUES (5905, 3, 8.75);
+INSERT INTO events VALUES (5908, 4, 9.00);
+INSERT INTO events VALUES (5911, 5, 9.25);
+INSERT INTO events VALUES (5914, 6, 9.50);
+INSERT INTO events VALUES (5917, 7, 9.75);
+INSERT INTO events VALUES (5920, 8, 10.00);
+INSERT INTO events VALUES (5923, 9, 10.25);
+INSERT INTO events VALUES (5926, 10, 10.50);
+INSERT INTO events VALUES (5929, 11, 10.75);
+INSERT INTO events VALUES (5932, 12, 11.00);
+INSERT INTO events VALUES (5935, 13, 11.25);
+INSERT INTO events VALUES (5938, 14, 11.50);
+INSERT INTO events VALUES (5941, 15, 11.75);
+INSERT INTO events VALUES (5944, 0, 12.00);
+INSERT INTO events VALUES (5947, 1, 12.25);
+INSERT INTO events VALUES (5950, 2, 12.50);
+INSERT INTO events VALUES (5953, 3, 12.75);
+INSERT INTO events VALUES (5956, 4, 13.00);
+INSERT INTO events VALUES (5959, 5, 13.25);
+INSERT INTO events VALUES (5962, 6, 13.50);
+INSERT INTO events VALUES (5965, 7, 13.75);
+INSERT INTO events VALUES (5968, 8, 14.00);
+INSERT INTO events VALUES (5971, 9, 14.25);
+INSERT INTO events VALUES (5974, 10, 14.50);
+INSERT INTO events VALUES (5977, 11, 14.75);
+INSERT INTO events VALUES (5980, 12, 15.00);
+INSERT INTO events VALUES (5983, 13, 15.25);
+INSERT INTO events VALUES (5986, 14, 15.50);
+INSERT INTO events VALUES (5989, 15, 15.75);
+INSERT INTO events VALUES (5992, 0, 16.00);
+INSERT INTO events VALUES (5995, 1, 16.25);
+INSERT INTO events VALUES (5998, 2, 16.50);
+INSERT INTO events VALUES (6001, 3, 16.75);
+INSERT INTO events VALUES (6004, 4, 17.00);
+INSERT INTO events VALUES (6007, 5, 17.25);
+INSERT INTO events VALUES (6010, 6, 17.50);
+INSERT INTO events VALUES (6013, 7, 17.75);
+INSERT INTO events VALUES (6016, 8, 18.00);
+INSERT INTO events VALUES (6019, 9, 18.25);
+INSERT INTO events VALUES (6022, 10, 18.50);
+INSERT INTO events VALUES (6025, 11, 18.75);
+INSERT INTO events VALUES (6028, 12, 19.00);
+INSERT INTO events VALUES (6031, 13, 19.25);
+INSERT INTO events VALUES (6034, 14, 19.50);
+INSERT INTO events VALUES (6037, 15, 19.75);
+INSERT INTO events VALUES (6040, 0, 20.00);
+INSERT INTO events VALUES (6043, 1, 20.25);
+INSERT INTO events VALUES (6046, 2, 20.50);
+INSERT INTO events VALUES (6049, 3, 20.75);
+INSERT INTO events VALUES (6052, 4, 21.00);
+INSERT INTO events VALUES (6055, 5, 21.25);
+INSERT INTO events VALUES (6058, 6, 21.50);
+INSERT INTO events VALUES (6061, 7, 21.75);
+INSERT INTO events VALUES (6064, 8, 22.00);
+INSERT INTO events VALUES (6067, 9, 22.25);
+INSERT INTO events VALUES (6070, 10, 22.50);
+INSERT INTO events VALUES (6073, 11, 22.75);
+INSERT INTO events VALUES (6076, 12, 23.00);
+INSERT INTO events VALUES (6079, 13, 23.25);
+INSERT INTO events VALUES (6082, 14, 23.50);
+INSERT INTO events VALUES (6085, 15, 23.75);
+INSERT INTO events VALUES (6088, 0, 24.00);
+INSERT INTO events VALUES (6091, 1, 24.25);
+INSERT INTO events VALUES (6094, 2, 24.50);
+INSERT INTO events VALUES (6097, 3, 24.75);
+INSERT INTO events VALUES (6100, 4, 0.00);
+INSERT INTO events VALUES (6103, 5, 0.25);
+INSERT INTO events VALUES (6106, 6, 0.50);
+INSERT INTO events VALUES (6109, 7, 0.75);
+INSERT INTO events VALUES (6112, 8, 1.00);
+INSERT INTO events VALUES (6115, 9, 1.25);
+INSERT INTO events VALUES (6118, 10, 1.50);
+INSERT INTO events VALUES (6121, 11, 1.75);
+INSERT INTO events VALUES (6124, 12, 2.00);
+INSERT INTO events VALUES (6127, 13, 2.25);
+INSERT INTO events VALUES (6130, 14, 2.50);
+INSERT INTO events VALUES (6133, 15, 2.75);
+INSERT INTO events VALUES (6136, 0, 3.00);
+INSERT INTO events VALUES (6139, 1, 3.25);
+INSERT INTO events VALUES (6142, 2, 3.50);
+INSERT INTO events VALUES (6145, 3, 3.75);
+INSERT INTO events VALUES (6148, 4, 4.00);
+INSERT INTO events VALUES (6151, 5, 4.25);
+INSERT INTO events VALUES (6154, 6, 4.50);
+INSERT INTO events VALUES (6157, 7, 4.75);
+INSERT INTO events VALUES (6160, 8, 5.00);
+INSERT INTO events VALUES (6163, 9, 5.25);
+INSERT INTO events VALUES (6166, 10, 5.50);
+INSERT INTO events VALUES (6169, 11, 5.75);
+INSERT INTO events VALUES (6172, 12, 6.00);
+INSERT INTO events VALUES (6175, 13, 6.25);
+INSERT INTO events VALUES (6178, 14, 6.50);
+INSERT INTO events VALUES (6181, 15, 6.75);
+INSERT INTO events VALUES (6184, 0, 7.00);
+INSERT INTO events VALUES (6187, 1, 7.25);
+INSERT INTO events VALUES (6190, 2, 7.50);
+INSERT INTO events VALUES (6193, 3, 7.75);
+INSERT INTO events VALUES (6196, 4, 8.00);
+INSERT INTO events VALUES (6199, 5, 8.25);
+INSERT INTO events VALUES (6202, 6, 8.50);
+INSERT INTO events VALUES (6205, 7, 8.75);
+INSERT INTO events VALUES (6208, 8, 9.00);
+INSERT INTO events VALUES (6211, 9, 9.25);
+INSERT INTO events VALUES (6214, 10, 9.50);
+INSERT INTO events VALUES (6217, 11, 9.75);
+INSERT INTO events VALUES (6220, 12, 10.00);
+INSERT INTO events VALUES (6223, 13, 10.25);
+INSERT INTO events VALUES (6226, 14, 10.50);
+INSERT INTO events VALUES (6229, 15, 10.75);
+INSERT INTO events VALUES (6232, 0, 11.00);
+INSERT INTO events VALUES (6235, 1, 11.25);
+INSERT INTO events VALUES (6238, 2, 11.50);
+INSERT INTO events VALUES (6241, 3, 11.75);
+INSERT INTO events VALUES (6244, 4, 12.00);
+INSERT INTO events VALUES (6247, 5, 12.25);
+INSERT INTO events VALUES (6250, 6, 12.50);
+INSERT INTO events VALUES (6253, 7, 12.75);
+INSERT INTO events VALUES (6256, 8, 13.00);
+INSERT INTO events VALUES (6259, 9, 13.25);
+INSERT INTO events VALUES (6262, 10, 13.50);
+INSERT INTO events VALUES (6265, 11, 13.75);
+INSERT INTO events VALUES (6268, 12, 14.00);
+INSERT INTO events VALUES (6271, 13, 14.25);
+INSERT INTO events VALUES (6274, 14, 14.50);
+INSERT INTO events VALUES (6277, 15, 14.75);
+INSERT INTO events VALUES (6280, 0, 15.00);
+INSERT INTO events VALUES (6283, 1, 15.25);
+INSERT INTO events VALUES (6286, 2, 15.50);
+INSERT INTO events VALUES (6289, 3, 15.75);
+INSERT INTO events VALUES (6292, 4, 16.00);
+INSERT INTO events VALUES (6295, 5, 16.25);
+INSERT INTO events VALUES (6298, 6, 16.50);
+INSERT INTO events VALUES (6301, 7, 16.75);
+INSERT INTO events VALUES (6304, 8, 17.00);
+INSERT INTO events VALUES (6307, 9, 17.25);
+INSERT INTO events VALUES (6310, 10, 17.50);
+INSERT INTO events VALUES (6313, 11, 17.75);
+INSERT INTO events VALUES (6316, 12, 18.00);
+INSERT INTO events VALUES (6319, 13, 18.25);
+INSERT INTO events VALUES (6322, 14, 18.50);
+INSERT INTO events VALUES (6325, 15, 18.75);
+INSERT INTO events VALUES (6328, 0, 19.00);
+INSERT INTO events VALUES (6331, 1, 19.25);
+INSERT INTO events VALUES (6334, 2, 19.50);
+INSERT INTO events VALUES (6337, 3, 19.75);
+INSERT INTO events VALUES (6340, 4, 20.00);
+INSERT INTO events VALUES (6343, 5, 20.25);
+INSERT INTO events VALUES (6346, 6, 20.50);
+INSERT INTO events VALUES (6349, 7, 20.75);
+INSERT INTO events VALUES (6352, 8, 21.00);
+INSERT INTO events VALUES (6355, 9, 21.25);
+INSERT INTO events VALUES (6358, 10, 21.50);
+INSERT INTO events VALUES (6361, 11, 21.75);
+INSERT INTO events VALUES (6364, 12, 22.00);
+INSERT INTO events VALUES (6367, 13, 22.25);
+INSERT INTO events VALUES (6370, 14, 22.50);
+INSERT INTO events VALUES (6373, 15, 22.75);
+INSERT INTO events VALUES (6376, 0, 23.00);
+INSERT INTO events VALUES (6379, 1, 23.25);
+INSERT INTO events VALUES (6382, 2, 23.50);
+INSERT INTO events VALUES (6385, 3, 23.75);
+INSERT INTO events VALUES (6388, 4, 24.00);
+INSERT INTO events VALUES (6391, 5, 24.25);
+INSERT INTO events VALUES (6394, 6, 24.50);
+INSERT INTO events VALUES (6397, 7, 24.75);
+INSERT INTO events VALUES (6400, 8, 0.00);
+INSERT INTO events VALUES (6403, 9, 0.25);
+INSERT INTO events VALUES (6406, 10, 0.50);
+INSERT INTO events VALUES (6409, 11, 0.75);
+INSERT INTO events VALUES (6412, 12, 1.00);
+INSERT INTO events VALUES (6415, 13, 1.25);
+INSERT INTO events VALUES (6418, 14, 1.50);
+INSERT INTO events VALUES (6421, 15, 1.75);
+INSERT INTO events VALUES (6424, 0, 2.00);
+INSERT INTO events VALUES (6427, 1, 2.25);
+INSERT INTO events VALUES (6430, 2, 2.50);
+INSERT INTO events VALUES (6433, 3, 2.75);
+INSERT INTO events VALUES (6436, 4, 3.00);
+INSERT INTO events VALUES (6439, 5, 3.25);
+INSERT INTO events VALUES (6442, 6, 3.50);
+INSERT INTO events VALUES (6445, 7, 3.75);
+INSERT INTO events VALUES (6448, 8, 4.00);
+INSERT INTO events VALUES (6451, 9, 4.25);
+INSERT INTO events VALUES (6454, 10, 4.50);
+INSERT INTO events VALUES (6457, 11, 4.75);
+INSERT INTO events VALUES (6460, 12, 5.00);
+INSERT INTO events VALUES (6463, 13, 5.25);
+INSERT INTO events VALUES (6466, 14, 5.50);
+INSERT INTO events VALUES (6469, 15, 5.75);
+INSERT INTO events VALUES (6472, 0, 6.00);
+INSERT INTO events VALUES (6475, 1, 6.25);
+INSERT INTO events VALUES (6478, 2, 6.50);
+INSERT INTO events VALUES (6481, 3, 6.75);
+INSERT INTO events VALUES (6484, 4, 7.00);
+INSERT INTO events VALUES (6487, 5, 7.25);
+INSERT INTO events VALUES (6490, 6, 7.50);
+INSERT INTO events VALUES (6493, 7, 7.75);
+INSERT INTO events VALUES (6496, 8, 8.00);
+INSERT INTO events VALUES (6499, 9, 8.25);
+INSERT INTO events VALUES (6502, 10, 8.50);
+INSERT INTO events VALUES (6505, 11, 8.75);
+INSERT INTO events VALUES (6508, 12, 9.00);
+INSERT INTO events VALUES (6511, 13, 9.25);
+INSERT INTO events VALUES (6514, 14, 9.50);
+INSERT INTO events VALUES (6517, 15, 9.75);
+INSERT INTO events VALUES (6520, 0, 10.00);
+INSERT INTO events VALUES (6523, 1, 10.25);
+INSERT INTO events VALUES (6526, 2, 10.50);
+INSERT INTO events VALUES (6529, 3, 10.75);
+INSERT INTO events VALUES (6532, 4, 11.00);
+INSERT INTO events VALUES (6535, 5, 11.25);
+INSERT INTO events VALUES (6538, 6, 11.50);
+INSERT INTO events VALUES (6541, 7, 11.75);
+INSERT INTO events VALUES (6544, 8, 12.00);
+INSERT INTO events VALUES (6547, 9, 12.25);
+INSERT INTO events VALUES (6550, 10, 12.50);
+INSERT INTO events VALUES (6553, 11, 12.75);
+INSERT INTO events VALUES (6556, 12, 13.00);
+INSERT INTO events VALUES (6559, 13, 13.25);
+INSERT INTO events VALUES (6562, 14, 13.50);
+INSERT INTO events VALUES (6565, 15, 13.75);
+INSERT INTO events VALUES (6568, 0, 14.00);
+INSERT INTO events VALUES (6571, 1, 14.25);
+INSERT INTO events VALUES (6574, 2, 14.50);
+INSERT INTO events VALUES (6577, 3, 14.75);
+INSERT INTO events VALUES (6580, 4, 15.00);
+INSERT INTO events VALUES (6583, 5, 15.25);
+INSERT INTO events VALUES (6586, 6, 15.50);
+INSERT INTO events VALUES (6589, 7, 15.75);
+INSERT INTO events VALUES (6592, 8, 16.00);
+INSERT INTO events VALUES (6595, 9, 16.25);
+INSERT INTO events VALUES (6598, 10, 16.50);
+INSERT INTO events VALUES (6601, 11, 16.75);
+INSERT INTO events VALUES (6604, 12, 17.00);
+INSERT INTO events VALUES (6607, 13, 17.25);
+INSERT INTO events VALUES (6610, 14, 17.50);
+INSERT INTO events VALUES (6613, 15, 17.75);
+INSERT INTO events VALUES (6616, 0, 18.00);
+INSERT INTO events VALUES (6619, 1, 18.25);
+INSERT INTO events VALUES (6622, 2, 18.50);
+INSERT INTO events VALUES (6625, 3, 18.75);
+INSERT INTO events VALUES (6628, 4, 19.00);
+INSERT INTO events VALUES (6631, 5, 19.25);
+INSERT INTO events VALUES (6634, 6, 19.50);
+INSERT INTO events VALUES (6637, 7, 19.75);
+INSERT INTO events VALUES (6640, 8, 20.00);
+INSERT INTO events VALUES (6643, 9, 20.25);
+INSERT INTO events VALUES (6646, 10, 20.50);
+INSERT INTO events VALUES (6649, 11, 20.75);
+INSERT INTO events VALUES (6652, 12, 21.00);
+INSERT INTO events VALUES (6655, 13, 21.25);
+INSERT INTO events VALUES (6658, 14, 21.50);
+INSERT INTO events VALUES (6661, 15, 21.75);
+INSERT INTO events VALUES (6664, 0, 22.00);
+INSERT INTO events VALUES (6667, 1, 22.25);
+INSERT INTO events VALUES (6670, 2, 22.50);
+INSERT INTO events VALUES (6673, 3, 22.75);
+INSERT INTO events VALUES (6676, 4, 23.00);
+INSERT INTO events VALUES (6679, 5, 23.25);
+INSERT INTO events VALUES (6682, 6, 23.50);
+INSERT INTO events VALUES (6685, 7, 23.75);
+INSERT INTO events VALUES (6688, 8, 24.00);
+INSERT INTO events VALUES (6691, 9, 24.25);
+INSERT INTO events VALUES (6694, 10, 24.50);
+INSERT INTO events VALUES (6697, 11, 24.75);
+INSERT INTO events VALUES (6700, 12, 0.00);
+INSERT INTO events VALUES (6703, 13, 0.25);
+INSERT INTO events VALUES (6706, 14, 0.50);
+INSERT INTO events VALUES (6709, 15, 0.75);
+INSERT INTO events VALUES (6712, 0, 1.00);
+INSERT INTO events VALUES (6715, 1, 1.25);
+INSERT INTO events VALUES (6718, 2, 1.50);
+INSERT INTO events VALUES (6721, 3, 1.75);
+INSERT INTO events VALUES (6724, 4, 2.00);
+INSERT INTO events VALUES (6727, 5, 2.25);
+INSERT INTO events VALUES (6730, 6, 2.50);
+INSERT INTO events VALUES (6733, 7, 2.75);
+INSERT INTO events VALUES (6736, 8, 3.00);
+INSERT INTO events VALUES (6739, 9, 3.25);
+INSERT INTO events VALUES (6742, 10, 3.50);
+INSERT INTO events VALUES (6745, 11, 3.75);
+INSERT INTO events VALUES (6748, 12, 4.00);
+INSERT INTO events VALUES (6751, 13, 4.25);
+INSERT INTO events VALUES (6754, 14, 4.50);
+INSERT INTO events VALUES (6757, 15, 4.75);
+INSERT INTO events VALUES (6760, 0, 5.00);
+INSERT INTO events VALUES (6763, 1, 5.25);
+INSERT INTO events VALUES (6766, 2, 5.50);
+INSERT INTO events VALUES (6769, 3, 5.75);
+INSERT INTO events VALUES (6772, 4, 6.00);
+INSERT INTO events VALUES (6775, 5, 6.25);
+INSERT INTO events VALUES (6778, 6, 6.50);
+INSERT INTO events VALUES (6781, 7, 6.75);
+INSERT INTO events VALUES (6784, 8, 7.00);
+INSERT INTO events VALUES (6787, 9, 7.25);
+INSERT INTO events VALUES (6790, 10, 7.50);
+INSERT INTO events VALUES (6793, 11, 7.75);
+INSERT INTO events VALUES (6796, 12, 8.00);
+INSERT INTO events VALUES (6799, 13, 8.25);
+INSERT INTO events VALUES (6802, 14, 8.50);
+INSERT INTO events VALUES (6805, 15, 8.75);
+INSERT INTO events VALUES (6808, 0, 9.00);
+INSERT INTO events VALUES (6811, 1, 9.25);
+INSERT INTO events VALUES (6814, 2, 9.50);
+INSERT INTO events VALUES (6817, 3, 9.75);
+INSERT INTO events VALUES (6820, 4, 10.00);
+INSERT INTO events VALUES (6823, 5, 10.25);
+INSERT INTO events VALUES (6826, 6, 10.50);
+INSERT INTO events VALUES (6829, 7, 10.75);
+INSERT INTO events VALUES (6832, 8, 11.00);
+INSERT INTO events VALUES (6835, 9, 11.25);
+INSERT INTO events VALUES (6838, 10, 11.50);
+INSERT INTO events VALUES (6841, 11, 11.75);
+INSERT INTO events VALUES (6844, 12, 12.00);
+INSERT INTO events VALUES (6847, 13, 12.25);
+INSERT INTO events VALUES (6850, 14, 12.50);
+INSERT INTO events VALUES (6853, 15, 12.75);
+INSERT INTO events VALUES (6856, 0, 13.00);
+INSERT INTO events VALUES (6859, 1, 13.25);
+INSERT INTO events VALUES (6862, 2, 13.50);
+INSERT INTO events VALUES (6865, 3, 13.75);
+INSERT INTO events VALUES (6868, 4, 14.00);
+INSERT INTO events VALUES (6871, 5, 14.25);
+INSERT INTO events VALUES (6874, 6, 14.50);
+INSERT INTO events VALUES (6877, 7, 14.75);
+INSERT INTO events VALUES (6880, 8, 15.00);
+INSERT INTO events VALUES (6883, 9, 15.25);
+INSERT INTO events VALUES (6886, 10, 15.50);
+INSERT INTO events VALUES (6889, 11, 15.75);
+INSERT INTO events VALUES (6892, 12, 16.00);
+INSERT INTO events VALUES (6895, 13, 16.25);
+INSERT INTO events VALUES (6898, 14, 16.50);
+INSERT INTO events VALUES (6901, 15, 16.75);
+INSERT INTO events VALUES (6904, 0, 17.00);
+INSERT INTO events VALUES (6907, 1, 17.25);
+INSERT INTO events VALUES (6910, 2, 17.50);
+INSERT INTO events VALUES (6913, 3, 17.75);
+INSERT INTO events VALUES (6916, 4, 18.00);
+INSERT INTO events VALUES (6919, 5, 18.25);
+INSERT INTO events VALUES (6922, 6, 18.50);
+INSERT INTO events VALUES (6925, 7, 18.75);
+INSERT INTO events VALUES (6928, 8, 19.00);
+INSERT INTO events VALUES (6931, 9, 19.25);
+INSERT INTO events VALUES (6934, 10, 19.50);
+INSERT INTO events VALUES (6937, 11, 19.75);
+INSERT INTO events VALUES (6940, 12, 20.00);
+INSERT INTO events VALUES (6943, 13, 20.25);
+INSERT INTO events VALUES (6946, 14, 20.50);
+INSERT INTO events VALUES (6949, 15, 20.75);
+INSERT INTO events VALUES (6952, 0, 21.00);
+INSERT INTO events VALUES (6955, 1, 21.25);
+INSERT INTO events VALUES (6958, 2, 21.50);
+INSERT INTO events VALUES (6961, 3, 21.75);
+INSERT INTO events VALUES (6964, 4, 22.00);
+INSERT INTO events VALUES (6967, 5, 22.25);
+INSERT INTO events VALUES (6970, 6, 22.50);
+INSERT INTO events VALUES (6973, 7, 22.75);
+INSERT INTO events VALUES (6976, 8, 23.00);
+INSERT INTO events VALUES (6979, 9, 23.25);
+INSERT INTO events VALUES (6982, 10, 23.50);
+INSERT INTO events VALUES (6985, 11, 23.75);
+INSERT INTO events VALUES (6988, 12, 24.00);
+INSERT INTO events VALUES (6991, 13, 24.25);
+INSERT INTO events VALUES (6994, 14, 24.50);
+INSERT INTO events VALUES (6997, 15, 24.75);
+INSERT INTO events VALUES (7000, 0, 0.00);
+INSERT INTO events VALUES (7003, 1, 0.25);
+INSERT INTO events VALUES (7006, 2, 0.50);
+INSERT INTO events VALUES (7009, 3, 0.75);
+INSERT INTO events VALUES (7012, 4, 1.00);
+INSERT INTO events VALUES (7015, 5, 1.25);
+INSERT INTO events VALUES (7018, 6, 1.50);
+INSERT INTO events VALUES (7021, 7, 1.75);
+INSERT INTO events VALUES (7024, 8, 2.00);
+INSERT INTO events VALUES (7027, 9, 2.25);
+INSERT INTO events VALUES (7030, 10, 2.50);
+INSERT INTO events VALUES (7033, 11, 2.75);
+INSERT INTO events VALUES (7036, 12, 3.00);
+INSERT INTO events VALUES (7039, 13, 3.25);
+INSERT INTO events VALUES (7042, 14, 3.50);
+INSERT INTO events VALUES (7045, 15, 3.75);
+INSERT INTO events VALUES (7048, 0, 4.00);
+INSERT INTO events VALUES (7051, 1, 4.25);
+INSERT INTO events VALUES (7054, 2, 4.50);
+INSERT INTO events VALUES (7057, 3, 4.75);
+INSERT INTO events VALUES (7060, 4, 5.00);
+INSERT INTO events VALUES (7063, 5, 5.25);
+INSERT INTO events VALUES (7066, 6, 5.50);
+INSERT INTO events VALUES (7069, 7, 5.75);
+INSERT INTO events VALUES (7072, 8, 6.00);
+INSERT INTO events VALUES (7075, 9, 6.25);
+INSERT INTO events VALUES (7078, 10, 6.50);
+INSERT INTO events VALUES (7081, 11, 6.75);
+INSERT INTO events VALUES (7084, 12, 7.00);
+INSERT INTO events VALUES (7087, 13, 7.25);
+INSERT INTO events VALUES (7090, 14, 7.50);
+INSERT INTO events VALUES (7093, 15, 7.75);
+INSERT INTO events VALUES (7096, 0, 8.00);
+INSERT INTO events VALUES (7099, 1, 8.25);
+INSERT INTO events VALUES (7102, 2, 8.50);
+INSERT INTO events VALUES (7105, 3, 8.75);
+INSERT INTO events VALUES (7108, 4, 9.00);
+INSERT INTO events VALUES (7111, 5, 9.25);
+INSERT INTO events VALUES (7114, 6, 9.50);
+INSERT INTO events VALUES (7117, 7, 9.75);
+INSERT INTO events VALUES (7120, 8, 10.00);
+INSERT INTO events VALUES (7123, 9, 10.25);
+INSERT INTO events VALUES (7126, 10, 10.50);
+INSERT INTO events VALUES (7129, 11, 10.75);
+INSERT INTO events VALUES (7132, 12, 11.00);
+INSERT INTO events VALUES (7135, 13, 11.25);
+INSERT INTO events VALUES (7138, 14, 11.50);
+INSERT INTO events VALUES (7141, 15, 11.75);
+INSERT INTO events VALUES (7144, 0, 112.00);
+INSERT INTO events VALUES (7147, 1, 112.25);
+INSERT INTO events VALUES (7150, 2, 112.50);
+INSERT INTO events VALUES (7153, 3, 112.75);
+INSERT INTO events VALUES (7156, 4, 113.00);
+INSERT INTO events VALUES (7159, 5, 113.25);
+INSERT INTO events VALUES (7162, 6, 113.50);
+INSERT INTO events VALUES (7165, 7, 113.75);
+INSERT INTO events VALUES (7168, 8, 114.00);
+INSERT INTO events VALUES (7171, 9, 114.25);
+INSERT INTO events VALUES (7174, 10, 114.50);
+INSERT INTO events VALUES (7177, 11, 114.75);
+INSERT INTO events VALUES (7180, 12, 115.00);
+INSERT INTO events VALUES (7183, 13, 115.25);
+INSERT INTO events VALUES (7186, 14, 115.50);
+INSERT INTO events VALUES (7189, 15, 115.75);
+INSERT INTO events VALUES (7192, 0, 116.00);
+INSERT INTO events VALUES (7195, 1, 116.25);
+INSERT INTO events VALUES (7198, 2, 116.50);
+INSERT INTO events VALUES (7201, 3, 116.75);
+INSERT INTO events VALUES (7204, 4, 117.00);
+INSERT INTO events VALUES (7207, 5, 117.25);
+INSERT INTO events VALUES (7210, 6, 117.50);
+INSERT INTO events VALUES (7213, 7, 117.75);
+INSERT INTO events VALUES (7216, 8, 118.00);
+INSERT INTO events VALUES (7219, 9, 118.25);
+INSERT INTO events VALUES (7222, 10, 118.50);
+INSERT INTO events VALUES (7225, 11, 118.75);
+INSERT INTO events VALUES (7228, 12, 119.00);
+INSERT INTO events VALUES (7231, 13, 119.25);
+INSERT INTO events VALUES (7234, 14, 119.50);
+INSERT INTO events VALUES (7237, 15, 119.75);
+INSERT INTO events VALUES (7240, 0, 120.00);
+INSERT INTO events VALUES (7243, 1, 120.25);
+INSERT INTO events VALUES (7246, 2, 120.50);
+INSERT INTO events VALUES (7249, 3, 120.75);
+INSERT INTO events VALUES (7252, 4, 121.00);
+INSERT INTO events VALUES (7255, 5, 121.25);
+INSERT INTO events VALUES (7258, 6, 121.50);
+INSERT INTO events VALUES (7261, 7, 121.75);
+INSERT INTO events VALUES (7264, 8, 122.00);
+INSERT INTO events VALUES (7267, 9, 122.25);
+INSERT INTO events VALUES (7270, 10, 122.50);
+INSERT INTO events VALUES (7273, 11, 122.75);
+INSERT INTO events VALUES (7276, 12, 123.00);
+INSERT INTO events VALUES (7279, 13, 123.25);
+INSERT INTO events VALUES (7282, 14, 123.50);
+INSERT INTO events VALUES (7285, 15, 123.75);
+INSERT INTO events VALUES (7288, 0, 124.00);
+INSERT INTO events VALUES (7291, 1, 124.25);
+INSERT INTO events VALUES (7294, 2, 124.50);
+INSERT INTO events VALUES (7297, 3, 124.75);
+INSERT INTO events VALUES (7300, 4, 100.00);
+INSERT INTO events VALUES (7303, 5, 100.25);
+INSERT INTO events VALUES (7306, 6, 100.50);
+INSERT INTO events VALUES (7309, 7, 100.75);
+INSERT INTO events VALUES (7312, 8, 101.00);
+INSERT INTO events VALUES (7315, 9, 101.25);
+INSERT INTO events VALUES (7318, 10, 101.50);
+INSERT INTO events VALUES (7321, 11, 101.75);
+INSERT INTO events VALUES (7324, 12, 102.00);
+INSERT INTO events VALUES (7327, 13, 102.25);
+INSERT INTO events VALUES (7330, 14, 102.50);
+INSERT INTO events VALUES (7333, 15, 102.75);
+INSERT INTO events VALUES (7336, 0, 103.00);
+INSERT INTO events VALUES (7339, 1, 103.25);
+INSERT INTO events VALUES (7342, 2, 103.50);
+INSERT INTO events VALUES (7345, 3, 103.75);
+INSERT INTO events VALUES (7348, 4, 104.00);
+INSERT INTO events VALUES (7351, 5, 104.25);
+INSERT INTO events VALUES (7354, 6, 104.50);
+INSERT INTO events VALUES (7357, 7, 104.75);
+INSERT INTO events VALUES (7360, 8, 105.00);
+INSERT INTO events VALUES (7363, 9, 105.25);
+INSERT INTO events VALUES (7366, 10, 105.50);
+INSERT INTO events VALUES (7369, 11, 105.75);
+INSERT INTO events VALUES (7372, 12, 106.00);
+INSERT INTO events VALUES (7375, 13, 106.25);
+INSERT INTO events VALUES (7378, 14, 106.50);
+INSERT INTO events VALUES (7381, 15, 106.75);
+INSERT INTO events VALUES (7384, 0, 107.00);
+INSERT INTO events VALUES (7387, 1, 107.25);
+INSERT INTO events VALUES (7390, 2, 107.50);
+INSERT INTO events VALUES (7393, 3, 107.75);
+INSERT INTO events VALUES (7396, 4, 108.00);
+INSERT INTO events VALUES (7399, 5, 108.25);
+INSERT INTO events VALUES (7402, 6, 108.50);
+INSERT INTO events VALUES (7405, 7, 108.75);
+INSERT INTO events VALUES (7408, 8, 109.00);
+INSERT INTO events VALUES (7411, 9, 109.25);
+INSERT INTO events VALUES (7414, 10, 109.50);
+INSERT INTO events VALUES (7417, 11, 109.75);
+INSERT INTO events VALUES (7420, 12, 110.00);
+INSERT INTO events VALUES (7423, 13, 110.25);
+INSERT INTO events VALUES (7426, 14, 110.50);
+INSERT INTO events VALUES (7429, 15, 110.75);
+INSERT INTO events VALUES (7432, 0, 111.00);
+INSERT INTO events VALUES (7435, 1, 111.25);
+INSERT INTO events VALUES (7438, 2, 111.50);
+INSERT INTO events VALUES (7441, 3, 111.75);
+INSERT INTO events VALUES (7444, 4, 112.00);
+INSERT INTO events VALUES (7447, 5, 112.25);
+INSERT INTO events VALUES (7450, 6, 112.50);
+INSERT INTO events VALUES (7453, 7, 112.75);
+INSERT INTO events VALUES (7456, 8, 113.00);
+INSERT INTO events VALUES (7459, 9, 113.25);
+INSERT INTO events VALUES (7462, 10, 113.50);
+INSERT INTO events VALUES (7465, 11, 113.75);
+INSERT INTO events VALUES (7468, 12, 114.00);
+INSERT INTO events VALUES (7471, 13, 114.25);
+INSERT INTO events VALUES (7474, 14, 114.50);
+INSERT INTO events VALUES (7477, 15, 114.75);
+INSERT INTO events VALUES (7480, 0, 115.00);
+INSERT INTO events VALUES (7483, 1, 115.25);
+INSERT INTO events VALUES (7486, 2, 115.50);
+INSERT INTO events VALUES (7489, 3, 115.75);
+INSERT INTO events VALUES (7492, 4, 116.00);
+INSERT INTO events VALUES (7495, 5, 116.25);
+INSERT INTO events VALUES (7498, 6, 116.50);
+INSERT INTO events VALUES (7501, 7, 116.75);
+INSERT INTO events VALUES (7504, 8, 117.00);
+INSERT INTO events VALUES (7507, 9, 117.25);
+INSERT INTO events VALUES (7510, 10, 117.50);
+INSERT INTO events VALUES (7513, 11, 117.75);
+INSERT INTO events VALUES (7516, 12, 118.00);
+INSERT INTO events VALUES (7519, 13, 118.25);
+INSERT INTO events VALUES (7522, 14, 118.50);
+INSERT INTO events VALUES (7525, 15, 118.75);
+INSERT INTO events VALUES (7528, 0, 119.00);
+INSERT INTO events VALUES (7531, 1, 119.25);
+INSERT INTO events VALUES (7534, 2, 119.50);
+INSERT INTO events VALUES (7537, 3, 119.75);
+INSERT INTO events VALUES (7540, 4, 120.00);
+INSERT INTO events VALUES (7543, 5, 120.25);
+INSERT INTO events VALUES (7546, 6, 120.50);
+INSERT INTO events VALUES (7549, 7, 120.75);
+INSERT INTO events VALUES (7552, 8, 121.00);
+INSERT INTO events VALUES (7555, 9, 121.25);
+INSERT INTO events VALUES (7558, 10, 121.50);
+INSERT INTO events VALUES (7561, 11, 121.75);
+INSERT INTO events VALUES (7564, 12, 122.00);
+INSERT INTO events VALUES (7567, 13, 122.25);
+INSERT INTO events VALUES (7570, 14, 122.50);
+INSERT INTO events VALUES (7573, 15, 122.75);
+INSERT INTO events VALUES (7576, 0, 123.00);
+INSERT INTO events VALUES (7579, 1, 123.25);
+INSERT INTO events VALUES (7582, 2, 123.50);
+INSERT INTO events VALUES (7585, 3, 123.75);
+INSERT INTO events VALUES (7588, 4, 124.00);
+INSERT INTO events VALUES (7591, 5, 124.25);
+INSERT INTO events VALUES (7594, 6, 124.50);
+INSERT INTO events VALUES (7597, 7, 124.75);
+INSERT INTO events VALUES (7600, 8, 100.00);
+INSERT INTO events VALUES (7603, 9, 100.25);
+INSERT INTO events VALUES (7606, 10, 100.50);
+INSERT INTO events VALUES (7609, 11, 100.75);
+INSERT INTO events VALUES (7612, 12, 101.00);
+INSERT INTO events VALUES (7615, 13, 101.25);
+INSERT INTO events VALUES (7618, 14, 101.50);
+INSERT INTO events VALUES (7621, 15, 101.75);
+INSERT INTO events VALUES (7624, 0, 102.00);
+INSERT INTO events VALUES (7627, 1, 102.25);
+INSERT INTO events VALUES (7630, 2, 102.50);
+INSERT INTO events VALUES (7633, 3, 102.75);
+INSERT INTO events VALUES (7636, 4, 103.00);
+INSERT INTO events VALUES (7639, 5, 103.25);
+INSERT INTO events VALUES (7642, 6, 103.50);
+INSERT INTO events VALUES (7645, 7, 103.75);
+INSERT INTO events VALUES (7648, 8, 104.00);
+INSERT INTO events VALUES (7651, 9, 104.25);
+INSERT INTO events VALUES (7654, 10, 104.50);
+INSERT INTO events VALUES (7657, 11, 104.75);
+INSERT INTO events VALUES (7660, 12, 105.00);
+INSERT INTO events VALUES (7663, 13, 105.25);
+INSERT INTO events VALUES (7666, 14, 105.50);
+INSERT INTO events VALUES (7669, 15, 105.75);
+INSERT INTO events VALUES (7672, 0, 106.00);
+INSERT INTO events VALUES (7675, 1, 106.25);
+INSERT INTO events VALUES (7678, 2, 106.50);
+INSERT INTO events VALUES (7681, 3, 106.75);
+INSERT INTO events VALUES (7684, 4, 107.00);
+INSERT INTO events VALUES (7687, 5, 107.25);
+INSERT INTO events VALUES (7690, 6, 107.50);
+INSERT INTO events VALUES (7693, 7, 107.75);
+INSERT INTO events VALUES (7696, 8, 108.00);
+INSERT INTO events VALUES (7699, 9, 108.25);
+INSERT INTO events VALUES (7702, 10, 108.50);
+INSERT INTO events VALUES (7705, 11, 108.75);
+INSERT INTO events VALUES (7708, 12, 109.00);
+INSERT INTO events VALUES (7711, 13, 109.25);
+INSERT INTO events VALUES (7714, 14, 109.50);
+INSERT INTO events VALUES (7717, 15, 109.75);
+INSERT INTO events VALUES (7720, 0, 110.00);
+INSERT INTO events VALUES (7723, 1, 110.25);
+INSERT INTO events VALUES (7726, 2, 110.50);
+INSERT INTO events VALUES (7729, 3, 110.75);
+INSERT INTO events VALUES (7732, 4, 111.00);
+INSERT INTO events VALUES (7735, 5, 111.25);
+INSERT INTO events VALUES (7738, 6, 111.50);
+INSERT INTO events VALUES (7741, 7, 111.75);
+INSERT INTO events VALUES (7744, 8, 112.00);
+INSERT INTO events VALUES (7747, 9, 112.25);
+INSERT INTO events VALUES (7750, 10, 112.50);
+INSERT INTO events VALUES (7753, 11, 112.75);
+INSERT INTO events VALUES (7756, 12, 113.00);
+INSERT INTO events VALUES (7759, 13, 113.25);
+INSERT INTO events VALUES (7762, 14, 113.50);
+INSERT INTO events VALUES (7765, 15, 113.75);
+INSERT INTO events VALUES (7768, 0, 114.00);
+INSERT INTO events VALUES (7771, 1, 114.25);
+INSERT INTO events VALUES (7774, 2, 114.50);
+INSERT INTO events VALUES (7777, 3, 114.75);
+INSERT INTO events VALUES (7780, 4, 115.00);
+INSERT INTO events VALUES (7783, 5, 115.25);
+INSERT INTO events VALUES (7786, 6, 115.50);
+INSERT INTO events VALUES (7789, 7, 115.75);
+INSERT INTO events VALUES (7792, 8, 116.00);
+INSERT INTO events VALUES (7795, 9, 116.25);
+INSERT INTO events VALUES (7798, 10, 116.50);
+INSERT INTO events VALUES (7801, 11, 116.75);
+INSERT INTO events VALUES (7804, 12, 117.00);
+INSERT INTO events VALUES (7807, 13, 117.25);
+INSERT INTO events VALUES (7810, 14, 117.50);
+INSERT INTO events VALUES (7813, 15, 117.75);
+INSERT INTO events VALUES (7816, 0, 118.00);
+INSERT INTO events VALUES (7819, 1, 118.25);
+INSERT INTO events VALUES (7822, 2, 118.50);
+INSERT INTO events VALUES (7825, 3, 118.75);
+INSERT INTO events VALUES (7828, 4, 119.00);
+INSERT INTO events VALUES (7831, 5, 119.25);
+INSERT INTO events VALUES (7834, 6, 119.50);
+INSERT INTO events VALUES (7837, 7, 119.75);
+INSERT INTO events VALUES (7840, 8, 120.00);
+INSERT INTO events VALUES (7843, 9, 120.25);
+INSERT INTO events VALUES (7846, 10, 120.50);
+INSERT INTO events VALUES (7849, 11, 120.75);
+INSERT INTO events VALUES (7852, 12, 121.00);
+INSERT INTO events VALUES (7855, 13, 121.25);
+INSERT INTO events VALUES (7858, 14, 121.50);
+INSERT INTO events VALUES (7861, 15, 121.75);
+INSERT INTO events VALUES (7864, 0, 122.00);
+INSERT INTO events VALUES (7867, 1, 122.25);
+INSERT INTO events VALUES (7870, 2, 122.50);
+INSERT INTO events VALUES (7873, 3, 122.75);
+INSERT INTO events VALUES (7876, 4, 123.00);
+INSERT INTO events VALUES (7879, 5, 123.25);
+INSERT INTO events VALUES (7882, 6, 123.50);
+INSERT INTO events VALUES (7885, 7, 123.75);
+INSERT INTO events VALUES (7888, 8, 124.00);
+INSERT INTO events VALUES (7891, 9, 124.25);
+INSERT INTO events VALUES (7894, 10, 124.50);
+INSERT INTO events VALUES (7897, 11, 124.75);
+INSERT INTO events VALUES (7900, 12, 100.00);
+INSERT INTO events VALUES (7903, 13, 100.25);
+INSERT INTO events VALUES (7906, 14, 100.50);
+INSERT INTO events VALUES (7909, 15, 100.75);
+INSERT INTO events VALUES (7912, 0, 101.00);
+INSERT INTO events VALUES (7915, 1, 101.25);
+INSERT INTO events VALUES (7918, 2, 101.50);
+INSERT INTO events VALUES (7921, 3, 101.75);
+INSERT INTO events VALUES (7924, 4, 102.00);
+INSERT INTO events VALUES (7927, 5, 102.25);
+INSERT INTO events VALUES (7930, 6, 102.50);
+INSERT INTO events VALUES (7933, 7, 102.75);
+INSERT INTO events VALUES (7936, 8, 103.00);
+INSERT INTO events VALUES (7939, 9, 103.25);
+INSERT INTO events VALUES (7942, 10, 103.50);
+INSERT INTO events VALUES (7945, 11, 103.75);
+INSERT INTO events VALUES (7948, 12, 104.00);
+INSERT INTO events VALUES (7951, 13, 104.25);
+INSERT INTO events VALUES (7954, 14, 104.50);
+INSERT INTO events VALUES (7957, 15, 104.75);
+INSERT INTO events VALUES (7960, 0, 105.00);
+INSERT INTO events VALUES (7963, 1, 105.25);
+INSERT INTO events VALUES (7966, 2, 105.50);
+INSERT INTO events VALUES (7969, 3, 105.75);
+INSERT INTO events VALUES (7972, 4, 106.00);
+INSERT INTO events VALUES (7975, 5, 106.25);
+INSERT INTO events VALUES (7978, 6, 106.50);
+INSERT INTO events VALUES (7981, 7, 106.75);
+INSERT INTO events VALUES (7984, 8, 107.00);
+INSERT INTO events VALUES (7987, 9, 107.25);
+INSERT INTO events VALUES (7990, 10, 107.50);
+INSERT INTO events VALUES (7993, 11, 107.75);
+INSERT INTO events VALUES (7996, 12, 108.00);
+INSERT INTO events VALUES (7999, 13, 108.25);
+INSERT INTO events VALUES (8002, 14, 108.50);
+INSERT INTO events VALUES (8005, 15, 108.75);
+INSERT INTO events VALUES (8008, 0, 109.00);
+INSERT INTO events VALUES (8011, 1, 109.25);
+INSERT INTO events VALUES (8014, 2, 109.50);
+INSERT INTO events VALUES (8017, 3, 109.75);
+INSERT INTO events VALUES (8020, 4, 110.00);
+INSERT INTO events VALUES (8023, 5, 110.25);
+INSERT INTO events VALUES (8026, 6, 110.50);
+INSERT INTO events VALUES (8029, 7, 110.75);
+INSERT INTO events VALUES (8032, 8, 111.00);
+INSERT INTO events VALUES (8035, 9, 111.25);
+INSERT INTO events VALUES (8038, 10, 111.50);
+INSERT INTO events VALUES (8041, 11, 111.75);
+INSERT INTO events VALUES (8044, 12, 112.00);
+INSERT INTO events VALUES (8047, 13, 112.25);
+INSERT INTO events VALUES (8050, 14, 112.50);
+INSERT INTO events VALUES (8053, 15, 112.75);
+INSERT INTO events VALUES (8056, 0, 113.00);
+INSERT INTO events VALUES (8059, 1, 113.25);
+INSERT INTO events VALUES (8062, 2, 113.50);
+INSERT INTO events VALUES (8065, 3, 113.75);
+INSERT INTO events VALUES (8068, 4, 114.00);
+INSERT INTO events VALUES (8071, 5, 114.25);
+INSERT INTO events VALUES (8074, 6, 114.50);
+INSERT INTO events VALUES (8077, 7, 114.75);
+INSERT INTO events VALUES (8080, 8, 115.00);
+INSERT INTO events VALUES (8083, 9, 115.25);
+INSERT INTO events VALUES (8086, 10, 115.50);
+INSERT INTO events VALUES (8089, 11, 115.75);
+INSERT INTO events VALUES (8092, 12, 116.00);
+INSERT INTO events VALUES (8095, 13, 116.25);
+INSERT INTO events VALUES (8098, 14, 116.50);
+INSERT INTO events VALUES (8101, 15, 116.75);
+INSERT INTO events VALUES (8104, 0, 117.00);
+INSERT INTO events VALUES (8107, 1, 117.25);
+INSERT INTO events VALUES (8110, 2, 117.50);
+INSERT INTO events VALUES (8113, 3, 117.75);
+INSERT INTO events VALUES (8116, 4, 118.00);
+INSERT INTO events VALUES (8119, 5, 118.25);
+INSERT INTO events VALUES (8122, 6, 118.50);
+INSERT INTO events VALUES (8125, 7, 118.75);
+INSERT INTO events VALUES (8128, 8, 119.00);
+INSERT INTO events VALUES (8131, 9, 119.25);
+INSERT INTO events VALUES (8134, 10, 119.50);
+INSERT INTO events VALUES (8137, 11, 119.75);
+INSERT INTO events VALUES (8140, 12, 120.00);
+INSERT INTO events VALUES (8143, 13, 120.25);
+INSERT INTO events VALUES (8146, 14, 120.50);
+INSERT INTO events VALUES (8149, 15, 120.75);
+INSERT INTO events VALUES (8152, 0, 121.00);
+INSERT INTO events VALUES (8155, 1, 121.25);
+INSERT INTO events VALUES (8158, 2, 121.50);
+INSERT INTO events VALUES (8161, 3, 121.75);
+INSERT INTO events VALUES (8164, 4, 122.00);
+INSERT INTO events VALUES (8167, 5, 122.25);
+INSERT INTO events VALUES (8170, 6, 122.50);
+INSERT INTO events VALUES (8173, 7, 122.75);
+INSERT INTO events VALUES (8176, 8, 123.00);
+INSERT INTO events VALUES (8179, 9, 123.25);
+INSERT INTO events VALUES (8182, 10, 123.50);
+INSERT INTO events VALUES (8185, 11, 123.75);
+INSERT INTO events VALUES (8188, 12, 124.00);
+INSERT INTO events VALUES (8191, 13, 124.25);
+INSERT INTO events VALUES (8194, 14, 124.50);
+INSERT INTO events VALUES (8197, 15, 124.75);
+INSERT INTO events VALUES (8200, 0, 100.00);
+INSERT INTO events VALUES (8203, 1, 100.25);
+INSERT INTO events VALUES (8206, 2, 100.50);
+INSERT INTO events VALUES (8209, 3, 100.75);
+INSERT INTO events VALUES (8212, 4, 101.00);
+INSERT INTO events VALUES (8215, 5, 101.25);
+INSERT INTO events VALUES (8218, 6, 101.50);
+INSERT INTO events VALUES (8221, 7, 101.75);
+INSERT INTO events VALUES (8224, 8, 102.00);
+INSERT INTO events VALUES (8227, 9, 102.25);
+INSERT INTO events VALUES (8230, 10, 102.50);
+INSERT INTO events VALUES (8233, 11, 102.75);
+INSERT INTO events VALUES (8236, 12, 103.00);
+INSERT INTO events VALUES (8239, 13, 103.25);
+INSERT INTO events VALUES (8242, 14, 103.50);
+INSERT INTO events VALUES (8245, 15, 103.75);
+INSERT INTO events VALUES (8248, 0, 104.00);
+INSERT INTO events VALUES (8251, 1, 104.25);
+INSERT INTO events VALUES (8254, 2, 104.50);
+INSERT INTO events VALUES (8257, 3, 104.75);
+INSERT INTO events VALUES (8260, 4, 105.00);
+INSERT INTO events VALUES (8263, 5, 105.25);
+INSERT INTO events VALUES (8266, 6, 105.50);
+INSERT INTO events VALUES (8269, 7, 105.75);
+INSERT INTO events VALUES (8272, 8, 106.00);
+INSERT INTO events VALUES (8275, 9, 106.25);
+INSERT INTO events VALUES (8278, 10, 106.50);
+INSERT INTO events VALUES (8281, 11, 106.75);
+INSERT INTO events VALUES (8284, 12, 107.00);
+INSERT INTO events VALUES (8287, 13, 107.25);
+INSERT INTO events VALUES (8290, 14, 107.50);
+INSERT INTO events VALUES (8293, 15, 107.75);
+INSERT INTO events VALUES (8296, 0, 108.00);
+INSERT INTO events VALUES (8299, 1, 108.25);
+INSERT INTO events VALUES (8302, 2, 108.50);
+INSERT INTO events VALUES (8305, 3, 108.75);
+INSERT INTO events VALUES (8308, 4, 109.00);
+INSERT INTO events VALUES (8311, 5, 109.25);
+INSERT INTO events VALUES (8314, 6, 109.50);
+INSERT INTO events VALUES (8317, 7, 109.75);
+INSERT INTO events VALUES (8320, 8, 110.00);
+INSERT INTO events VALUES (8323, 9, 110.25);
+INSERT INTO events VALUES (8326, 10, 110.50);
+INSERT INTO events VALUES (8329, 11, 110.75);
+INSERT INTO events VALUES (8332, 12, 111.00);
+INSERT INTO events VALUES (8335, 13, 111.25);
+INSERT INTO events VALUES (8338, 14, 111.50);
+INSERT INTO events VALUES (8341, 15, 111.75);
+INSERT INTO events VALUES (8344, 0, 112.00);
+INSERT INTO events VALUES (8347, 1, 112.25);
+INSERT INTO events VALUES (8350, 2, 112.50);
+INSERT INTO events VALUES (8353, 3, 112.75);
+INSERT INTO events VALUES (8356, 4, 113.00);
+INSERT INTO events VALUES (8359, 5, 113.25);
+INSERT INTO events VALUES (8362, 6, 113.50);
+INSERT INTO events VALUES (8365, 7, 113.75);
+INSERT INTO events VALUES (8368, 8, 114.00);
+INSERT INTO events VALUES (8371, 9, 114.25);
+INSERT INTO events VALUES (8374, 10, 114.50);
+INSERT INTO events VALUES (8377, 11, 114.75);
+INSERT INTO events VALUES (8380, 12, 115.00);
+INSERT INTO events VALUES (8383, 13, 115.25);
+INSERT INTO events VALUES (8386, 14, 115.50);
+INSERT INTO events VALUES (8389, 15, 115.75);
+INSERT INTO events VALUES (8392, 0, 116.00);
+INSERT INTO events VALUES (8395, 1, 116.25);
+INSERT INTO events VALUES (8398, 2, 116.50);
+INSERT INTO events VALUES (8401, 3, 116.75);
+INSERT INTO events VALUES (8404, 4, 117.00);
+INSERT INTO events VALUES (8407, 5, 117.25);
+INSERT INTO events VALUES (8410, 6, 117.50);
+INSERT INTO events VALUES (8413, 7, 117.75);
+INSERT INTO events VALUES (8416, 8, 118.00);
+INSERT INTO events VALUES (8419, 9, 118.25);
+INSERT INTO events VALUES (8422, 10, 118.50);
+INSERT INTO events VALUES (8425, 11, 118.75);
+INSERT INTO events VALUES (8428, 12, 119.00);
+INSERT INTO events VALUES (8431, 13, 119.25);
+INSERT INTO events VALUES (8434, 14, 119.50);
+INSERT INTO events VALUES (8437, 15, 119.75);
+INSERT INTO events VALUES (8440, 0, 120.00);
+INSERT INTO events VALUES (8443, 1, 120.25);
+INSERT INTO events VALUES (8446, 2, 120.50);
+INSERT INTO events VALUES (8449, 3, 120.75);
+INSERT INTO events VALUES (8452, 4, 121.00);
+INSERT INTO events VALUES (8455, 5, 121.25);
+INSERT INTO events VALUES (8458, 6, 121.50);
+INSERT INTO events VALUES (8461, 7, 121.75);
+INSERT INTO events VALUES (8464, 8, 122.00);
+INSERT INTO events VALUES (8467, 9, 122.25);
+INSERT INTO events VALUES (8470, 10, 122.50);
+INSERT INTO events VALUES (8473, 11, 122.75);
+INSERT INTO events VALUES (8476, 12, 123.00);
+INSERT INTO events VALUES (8479, 13, 123.25);
+INSERT INTO events VALUES (8482, 14, 123.50);
+INSERT INTO events VALUES (8485, 15, 123.75);
+INSERT INTO events VALUES (8488, 0, 124.00);
+INSERT INTO events VALUES (8491, 1, 124.25);
+INSERT INTO events VALUES (8494, 2, 124.50);
+INSERT INTO events VALUES (8497, 3, 124.75);
+INSERT INTO events VALUES (8500, 4, 100.00);
+INSERT INTO events VALUES (8503, 5, 100.25);
+INSERT INTO events VALUES (8506, 6, 100.50);
+INSERT INTO events VALUES (8509, 7, 100.75);
+INSERT INTO events VALUES (8512, 8, 101.00);
+INSERT INTO events VALUES (8515, 9, 101.25);
+INSERT INTO events VALUES (8518, 10, 101.50);
+INSERT INTO events VALUES (8521, 11, 101.75);
+INSERT INTO events VALUES (8524, 12, 102.00);
+INSERT INTO events VALUES (8527, 13, 102.25);
+INSERT INTO events VALUES (8530, 14, 102.50);
+INSERT INTO events VALUES (8533, 15, 102.75);
+INSERT INTO events VALUES (8536, 0, 103.00);
+INSERT INTO events VALUES (8539, 1, 103.25);
+INSERT INTO events VALUES (8542, 2, 103.50);
+INSERT INTO events VALUES (8545, 3, 103.75);
+INSERT INTO events VALUES (8548, 4, 104.00);
+INSERT INTO events VALUES (8551, 5, 104.25);
+INSERT INTO events VALUES (8554, 6, 104.50);
+INSERT INTO events VALUES (8557, 7, 104.75);
+INSERT INTO events VALUES (8560, 8, 105.00);
+INSERT INTO events VALUES (8563, 9, 105.25);
+INSERT INTO events VALUES (8566, 10, 105.50);
+INSERT INTO events VALUES (8569, 11, 105.75);
+INSERT INTO events VALUES (8572, 12, 106.00);
+INSERT INTO events VALUES (8575, 13, 106.25);
+INSERT INTO events VALUES (8578, 14, 106.50);
+INSERT INTO events VALUES (8581, 15, 106.75);
+INSERT INTO events VALUES (8584, 0, 107.00);
+INSERT INTO events VALUES (8587, 1, 107.25);
+INSERT INTO events VALUES (8590, 2, 107.50);
+INSERT INTO events VALUES (8593, 3, 107.75);
+INSERT INTO events VALUES (8596, 4, 108.00);
+INSERT INTO events VALUES (8599, 5, 108.25);
+INSERT INTO events VALUES (8602, 6, 108.50);
+INSERT INTO events VALUES (8605, 7, 108.75);
+INSERT INTO events VALUES (8608, 8, 109.00);
+INSERT INTO events VALUES (8611, 9, 109.25);
+INSERT INTO events VALUES (8614, 10, 109.50);
+INSERT INTO events VALUES (8617, 11, 109.75);
+INSERT INTO events VALUES (8620, 12, 110.00);
+INSERT INTO events VALUES (8623, 13, 110.25);
+INSERT INTO events VALUES (8626, 14, 110.50);
+INSERT INTO events VALUES (8629, 15, 110.75);
+INSERT INTO events VALUES (8632, 0, 111.00);
+INSERT INTO events VALUES (8635, 1, 111.25);
+INSERT INTO events VALUES (8638, 2, 111.50);
+INSERT INTO events VALUES (8641, 3, 111.75);
+INSERT INTO events VALUES (8644, 4, 112.00);
+INSERT INTO events VALUES (8647, 5, 112.25);
+INSERT INTO events VALUES (8650, 6, 112.50);
+INSERT INTO events VALUES (8653, 7, 112.75);
+INSERT INTO events VALUES (8656, 8, 113.00);
+INSERT INTO events VALUES (8659, 9, 113.25);
+INSERT INTO events VALUES (8662, 10, 113.50);
+INSERT INTO events VALUES (8665, 11, 113.75);
+INSERT INTO events VALUES (8668, 12, 114.00);
+INSERT INTO events VALUES (8671, 13, 114.25);
+INSERT INTO events VALUES (8674, 14, 114.50);
+INSERT INTO events VALUES (8677, 15, 114.75);
+INSERT INTO events VALUES (8680, 0, 115.00);
+INSERT INTO events VALUES (8683, 1, 115.25);
+INSERT INTO events VALUES (8686, 2, 115.50);
+INSERT INTO events VALUES (8689, 3, 115.75);
+INSERT INTO events VALUES (8692, 4, 116.00);
+INSERT INTO events VALUES (8695, 5, 116.25);
+INSERT INTO events VALUES (8698, 6, 116.50);
+INSERT INTO events VALUES (8701, 7, 116.75);
+INSERT INTO events VALUES (8704, 8, 117.00);
+INSERT INTO events VALUES (8707, 9, 117.25);
+INSERT INTO events VALUES (8710, 10, 117.50);
+INSERT INTO events VALUES (8713, 11, 117.75);
+INSERT INTO events VALUES (8716, 12, 118.00);
+INSERT INTO events VALUES (8719, 13, 118.25);
+INSERT INTO events VALUES (8722, 14, 118.50);
+INSERT INTO events VALUES (8725, 15, 118.75);
+INSERT INTO events VALUES (8728, 0, 119.00);
+INSERT INTO events VALUES (8731, 1, 119.25);
+INSERT INTO events VALUES (8734, 2, 119.50);
+INSERT INTO events VALUES (8737, 3, 119.75);
+INSERT INTO events VALUES (8740, 4, 120.00);
+INSERT INTO events VALUES (8743, 5, 120.25);
+INSERT INTO events VALUES (8746, 6, 120.50);
+INSERT INTO events VALUES (8749, 7, 120.75);
+INSERT INTO events VALUES (8752, 8, 121.00);
+INSERT INTO events VALUES (8755, 9, 121.25);
+INSERT INTO events VALUES (8758, 10, 121.50);
+INSERT INTO events VALUES (8761, 11, 121.75);
+INSERT INTO events VALUES (8764, 12, 122.00);
+INSERT INTO events VALUES (8767, 13, 122.25);
+INSERT INTO events VALUES (8770, 14, 122.50);
+INSERT INTO events VALUES (8773, 15, 122.75);
+INSERT INTO events VALUES (8776, 0, 123.00);
+INSERT INTO events VALUES (8779, 1, 123.25);
+INSERT INTO events VALUES (8782, 2, 123.50);
+INSERT INTO events VALUES (8785, 3, 123.75);
+INSERT INTO events VALUES (8788, 4, 124.00);
+INSERT INTO events VALUES (8791, 5, 124.25);
+INSERT INTO events VALUES (8794, 6, 124.50);
+INSERT INTO events VALUES (8797, 7, 124.75);
+INSERT INTO events VALUES (8800, 8, 100.00);
+INSERT INTO events VALUES (8803, 9, 100.25);
+INSERT INTO events VALUES (8806, 10, 100.50);
+INSERT INTO events VALUES (8809, 11, 100.75);
+INSERT INTO events VALUES (8812, 12, 101.00);
+INSERT INTO events VALUES (8815, 13, 101.25);
+INSERT INTO events VALUES (8818, 14, 101.50);
+INSERT INTO events VALUES (8821, 15, 101.75);
+INSERT INTO events VALUES (8824, 0, 102.00);
+INSERT INTO events VALUES (8827, 1, 102.25);
+INSERT INTO events VALUES (8830, 2, 102.50);
+INSERT INTO events VALUES (8833, 3, 102.75);
+INSERT INTO events VALUES (8836, 4, 103.00);
+INSERT INTO events VALUES (8839, 5, 103.25);
+INSERT INTO events VALUES (8842, 6, 103.50);
+INSERT INTO events VALUES (8845, 7, 103.75);
+INSERT INTO events VALUES (8848, 8, 104.00);
+INSERT INTO events VALUES (8851, 9, 104.25);
+INSERT INTO events VALUES (8854, 10, 104.50);
+INSERT INTO events VALUES (8857, 11, 104.75);
+INSERT INTO events VALUES (8860, 12, 105.00);
+INSERT INTO events VALUES (8863, 13, 105.25);
+INSERT INTO events VALUES (8866, 14, 105.50);
+INSERT INTO events VALUES (8869, 15, 105.75);
+INSERT INTO events VALUES (8872, 0, 106.00);
+INSERT INTO events VALUES (8875, 1, 106.25);
+INSERT INTO events VALUES (8878, 2, 106.50);
+INSERT INTO events VALUES (8881, 3, 106.75);
+INSERT INTO events VALUES (8884, 4, 107.00);
+INSERT INTO events VALUES (8887, 5, 107.25);
+INSERT INTO events VALUES (8890, 6, 107.50);
+INSERT INTO events VALUES (8893, 7, 107.75);
+INSERT INTO events VALUES (8896, 8, 108.00);
+INSERT INTO events VALUES (8899, 9, 108.25);
+INSERT INTO events VALUES (8902, 10, 108.50);
+INSERT INTO events VALUES (8905, 11, 108.75);
+INSERT INTO events VALUES (8908, 12, 109.00);
+INSERT INTO events VALUES (8911, 13, 109.25);
+INSERT INTO events VALUES (8914, 14, 109.50);
+INSERT INTO events VALUES (8917, 15, 109.75);
+INSERT INTO events VALUES (8920, 0, 110.00);
+INSERT INTO events VALUES (8923, 1, 110.25);
+INSERT INTO events VALUES (8926, 2, 110.50);
+INSERT INTO events VALUES (8929, 3, 110.75);
+INSERT INTO events VALUES (8932, 4, 111.00);
+INSERT INTO events VALUES (8935, 5, 111.25);
+INSERT INTO events VALUES (8938, 6, 111.50);
+INSERT INTO events VALUES (8941, 7, 111.75);
+INSERT INTO events VALUES (8944, 8, 112.00);
+INSERT INTO events VALUES (8947, 9, 112.25);
+INSERT INTO events VALUES (8950, 10, 112.50);
+INSERT INTO events VALUES (8953, 11, 112.75);
+INSERT INTO events VALUES (8956, 12, 113.00);
+INSERT INTO events VALUES (8959, 13, 113.25);
+INSERT INTO events VALUES (8962, 14, 113.50);
+INSERT INTO events VALUES (8965, 15, 113.75);
+INSERT INTO events VALUES (8968, 0, 114.00);
+INSERT INTO events VALUES (8971, 1, 114.25);
+INSERT INTO events VALUES (8974, 2, 114.50);
+INSERT INTO events VALUES (8977, 3, 114.75);
+INSERT INTO events VALUES (8980, 4, 115.00);
+INSERT INTO events VALUES (8983, 5, 115.25);
+INSERT INTO events VALUES (8986, 6, 115.50);
+INSERT INTO events VALUES (8989, 7, 115.75);
+INSERT INTO events VALUES (8992, 8, 116.00);
+INSERT INTO events VALUES (8995, 9, 116.25);
+INSERT INTO events VALUES (8998, 10, 116.50);
+INSERT INTO events VALUES (9001, 11, 116.75);
+INSERT INTO events VALUES (9004, 12, 117.00);
+INSERT INTO events VALUES (9007, 13, 117.25);
+INSERT INTO events VALUES (9010, 14, 117.50);
+INSERT INTO events VALUES (9013, 15, 117.75);
+INSERT INTO events VALUES (9016, 0, 118.00);
+INSERT INTO events VALUES (9019, 1, 118.25);
+INSERT INTO events VALUES (9022, 2, 118.50);
+INSERT INTO events VALUES (9025, 3, 118.75);
+INSERT INTO events VALUES (9028, 4, 119.00);
+INSERT INTO events VALUES (9031, 5, 119.25);
+INSERT INTO events VALUES (9034, 6, 119.50);
+INSERT INTO events VALUES (9037, 7, 119.75);
+INSERT INTO events VALUES (9040, 8, 120.00);
+INSERT INTO events VALUES (9043, 9, 120.25);
+INSERT INTO events VALUES (9046, 10, 120.50);
+INSERT INTO events VALUES (9049, 11, 120.75);
+INSERT INTO events VALUES (9052, 12, 121.00);
+INSERT INTO events VALUES (9055, 13, 121.25);
+INSERT INTO events VALUES (9058, 14, 121.50);
+INSERT INTO events VALUES (9061, 15, 121.75);
+INSERT INTO events VALUES (9064, 0, 122.00);
+INSERT INTO events VALUES (9067, 1, 122.25);
+INSERT INTO events VALUES (9070, 2, 122.50);
+INSERT INTO events VALUES (9073, 3, 122.75);
+INSERT INTO events VALUES (9076, 4, 123.00);
+INSERT INTO events VALUES (9079, 5, 123.25);
+INSERT INTO events VALUES (9082, 6, 123.50);
+INSERT INTO events VALUES (9085, 7, 123.75);
+INSERT INTO events VALUES (9088, 8, 124.00);
+INSERT INTO events VALUES (9091, 9, 124.25);
+INSERT INTO events VALUES (9094, 10, 124.50);
+INSERT INTO events VALUES (9097, 11, 124.75);
+INSERT INTO events VALUES (9100, 12, 100.00);
+INSERT INTO events VALUES (9103, 13, 100.25);
+INSERT INTO events VALUES (9106, 14, 100.50);
+INSERT INTO events VALUES (9109, 15, 100.75);
+INSERT INTO events VALUES (9112, 0, 101.00);
+INSERT INTO events VALUES (9115, 1, 101.25);
+INSERT INTO events VALUES (9118, 2, 101.50);
+INSERT INTO events VALUES (9121, 3, 101.75);
+INSERT INTO events VALUES (9124, 4, 102.00);
+INSERT INTO events VALUES (9127, 5, 102.25);
+INSERT INTO events VALUES (9130, 6, 102.50);
+INSERT INTO events VALUES (9133, 7, 102.75);
+INSERT INTO events VALUES (9136, 8, 103.00);
+INSERT INTO events VALUES (9139, 9, 103.25);
+INSERT INTO events VALUES (9142, 10, 103.50);
+INSERT INTO events VALUES (9145, 11, 103.75);
+INSERT INTO events VALUES (9148, 12, 104.00);
+INSERT INTO events VALUES (9151, 13, 104.25);
+INSERT INTO events VALUES (9154, 14, 104.50);
+INSERT INTO events VALUES (9157, 15, 104.75);
+INSERT INTO events VALUES (9160, 0, 105.00);
+INSERT INTO events VALUES (9163, 1, 105.25);
+INSERT INTO events VALUES (9166, 2, 105.50);
+INSERT INTO events VALUES (9169, 3, 105.75);
+INSERT INTO events VALUES (9172, 4, 106.00);
+INSERT INTO events VALUES (9175, 5, 106.25);
+INSERT INTO events VALUES (9178, 6, 106.50);
+INSERT INTO events VALUES (9181, 7, 106.75);
+INSERT INTO events VALUES (9184, 8, 107.00);
+INSERT INTO events VALUES (9187, 9, 107.25);
+INSERT INTO events VALUES (9190, 10, 107.50);
+INSERT INTO events VALUES (9193, 11, 107.75);
+INSERT INTO events VALUES (9196, 12, 108.00);
+INSERT INTO events VALUES (9199, 13, 108.25);
+INSERT INTO events VALUES (9202, 14, 108.50);
+INSERT INTO events VALUES (9205, 15, 108.75);
+INSERT INTO events VALUES (9208, 0, 109.00);
+INSERT INTO events VALUES (9211, 1, 109.25);
+INSERT INTO events VALUES (9214, 2, 109.50);
+INSERT INTO events VALUES (9217, 3, 109.75);
+INSERT INTO events VALUES (9220, 4, 110.00);
+INSERT INTO events VALUES (9223, 5, 110.25);
+INSERT INTO events VALUES (9226, 6, 110.50);
+INSERT INTO events VALUES (9229, 7, 110.75);
+INSERT INTO events VALUES (9232, 8, 111.00);
+INSERT INTO events VALUES (9235, 9, 111.25);
+INSERT INTO events VALUES (9238, 10, 111.50);
+INSERT INTO events VALUES (9241, 11, 111.75);
+INSERT INTO events VALUES (9244, 12, 112.00);
+INSERT INTO events VALUES (9247, 13, 112.25);
+INSERT INTO events VALUES (9250, 14, 112.50);
+INSERT INTO events VALUES (9253, 15, 112.75);
+INSERT INTO events VALUES (9256, 0, 113.00);
+INSERT INTO events VALUES (9259, 1, 113.25);
+INSERT INTO events VALUES (9262, 2, 113.50);
+INSERT INTO events VALUES (9265, 3, 113.75);
+INSERT INTO events VALUES (9268, 4, 114.00);
+INSERT INTO events VALUES (9271, 5, 114.25);
+INSERT INTO events VALUES (9274, 6, 114.50);
+INSERT INTO events VALUES (9277, 7, 114.75);
+INSERT INTO events VALUES (9280, 8, 115.00);
+INSERT INTO events VALUES (9283, 9, 115.25);
+INSERT INTO events VALUES (9286, 10, 115.50);
+INSERT INTO events VALUES (9289, 11, 115.75);
+INSERT INTO events VALUES (9292, 12, 116.00);
+INSERT INTO events VALUES (9295, 13, 116.25);
+INSERT INTO events VALUES (9298, 14, 116.50);
+INSERT INTO events VALUES (9301, 15, 116.75);
+INSERT INTO events VALUES (9304, 0, 117.00);
+INSERT INTO events VALUES (9307, 1, 117.25);
+INSERT INTO events VALUES (9310, 2, 117.50);
+INSERT INTO events VALUES (9313, 3, 117.75);
+INSERT INTO events VALUES (9316, 4, 118.00);
+INSERT INTO events VALUES (9319, 5, 118.25);
+INSERT INTO events VALUES (9322, 6, 118.50);
+INSERT INTO events VALUES (9325, 7, 118.75);
+INSERT INTO events VALUES (9328, 8, 119.00);
+INSERT INTO events VALUES (9331, 9, 119.25);
+INSERT INTO events VALUES (9334, 10, 119.50);
+INSERT INTO events VALUES (9337, 11, 119.75);
+INSERT INTO events VALUES (9340, 12, 120.00);
+INSERT INTO events VALUES (9343, 13, 120.25);
+INSERT INTO events VALUES (9346, 14, 120.50);
+INSERT INTO events VALUES (9349, 15, 120.75);
+INSERT INTO events VALUES (9352, 0, 121.00);
+INSERT INTO events VALUES (9355, 1, 121.25);
+INSERT INTO events VALUES (9358, 2, 121.50);
+INSERT INTO events VALUES (9361, 3, 121.75);
+INSERT INTO events VALUES (9364, 4, 122.00);
+INSERT INTO events VALUES (9367, 5, 122.25);
+INSERT INTO events VALUES (9370, 6, 122.50);
+INSERT INTO events VALUES (9373, 7, 122.75);
+INSERT INTO events VALUES (9376, 8, 123.00);
+INSERT INTO events VALUES (9379, 9, 123.25);
+INSERT INTO events VALUES (9382, 10, 123.50);
+INSERT INTO events VALUES (9385, 11, 123.75);
+INSERT INTO events VALUES (9388, 12, 124.00);
+INSERT INTO events VALUES (9391, 13, 124.25);
+INSERT INTO events VALUES (9394, 14, 124.50);
+INSERT INTO events VALUES (9397, 15, 124.75);
+INSERT INTO events VALUES (9400, 0, 100.00);
+INSERT INTO events VALUES (9403, 1, 100.25);
+INSERT INTO events VALUES (9406, 2, 100.50);
+INSERT INTO events VALUES (9409, 3, 100.75);
+INSERT INTO events VALUES (9412, 4, 101.00);
+INSERT INTO events VALUES (9415, 5, 101.25);
+INSERT INTO events VALUES (9418, 6, 101.50);
+INSERT INTO events VALUES (9421, 7, 101.75);
+INSERT INTO events VALUES (9424, 8, 102.00);
+INSERT INTO events VALUES (9427, 9, 102.25);
+INSERT INTO events VALUES (9430, 10, 102.50);
+INSERT INTO events VALUES (9433, 11, 102.75);
+INSERT INTO events VALUES (9436, 12, 103.00);
+INSERT INTO events VALUES (9439, 13, 103.25);
+INSERT INTO events VALUES (9442, 14, 103.50);
+INSERT INTO events VALUES (9445, 15, 103.75);
+INSERT INTO events VALUES (9448, 0, 104.00);
+INSERT INTO events VALUES (9451, 1, 104.25);
+INSERT INTO events VALUES (9454, 2, 104.50);
+INSERT INTO events VALUES (9457, 3, 104.75);
+INSERT INTO events VALUES (9460, 4, 105.00);
+INSERT INTO events VALUES (9463, 5, 105.25);
+INSERT INTO events VALUES (9466, 6, 105.50);
+INSERT INTO events VALUES (9469, 7, 105.75);
+INSERT INTO events VALUES (9472, 8, 106.00);
+INSERT INTO events VALUES (9475, 9, 106.25);
+INSERT INTO events VALUES (9478, 10, 106.50);
+INSERT INTO events VALUES (9481, 11, 106.75);
+INSERT INTO events VALUES (9484, 12, 107.00);
+INSERT INTO events VALUES (9487, 13, 107.25);
+INSERT INTO events VALUES (9490, 14, 107.50);
+INSERT INTO events VALUES (9493, 15, 107.75);
+INSERT INTO events VALUES (9496, 0, 108.00);
+INSERT INTO events VALUES (9499, 1, 108.25);
+INSERT INTO events VALUES (9502, 2, 108.50);
+INSERT INTO events VALUES (9505, 3, 108.75);
+INSERT INTO events VALUES (9508, 4, 109.00);
+INSERT INTO events VALUES (9511, 5, 109.25);
+INSERT INTO events VALUES (9514, 6, 109.50);
+INSERT INTO events VALUES (9517, 7, 109.75);
+INSERT INTO events VALUES (9520, 8, 110.00);
+INSERT INTO events VALUES (9523, 9, 110.25);
+INSERT INTO events VALUES (9526, 10, 110.50);
+INSERT INTO events VALUES (9529, 11, 110.75);
+INSERT INTO events VALUES (9532, 12, 111.00);
+INSERT INTO events VALUES (9535, 13, 111.25);
+INSERT INTO events VALUES (9538, 14, 111.50);
+INSERT INTO events VALUES (9541, 15, 111.75);
+INSERT INTO events VALUES (9544, 0, 112.00);
+INSERT INTO events VALUES (9547, 1, 112.25);
+INSERT INTO events VALUES (9550, 2, 112.50);
+INSERT INTO events VALUES (9553, 3, 112.75);
+INSERT INTO events VALUES (9556, 4, 113.00);
+INSERT INTO events VALUES (9559, 5, 113.25);
+INSERT INTO events VALUES (9562, 6, 113.50);
+INSERT INTO events VALUES (9565, 7, 113.75);
+INSERT INTO events VALUES (9568, 8, 114.00);
+INSERT INTO events VALUES (9571, 9, 114.25);
+INSERT INTO events VALUES (9574, 10, 114.50);
+INSERT INTO events VALUES (9577, 11, 114.75);
+INSERT INTO events VALUES (9580, 12, 115.00);
+INSERT INTO events VALUES (9583, 13, 115.25);
+INSERT INTO events VALUES (9586, 14, 115.50);
+INSERT INTO events VALUES (9589, 15, 115.75);
+INSERT INTO events VALUES (9592, 0, 116.00);
+INSERT INTO events VALUES (9595, 1, 116.25);
+INSERT INTO events VALUES (9598, 2, 116.50);
+INSERT INTO events VALUES (9601, 3, 116.75);
+INSERT INTO events VALUES (9604, 4, 117.00);
+INSERT INTO events VALUES (9607, 5, 117.25);
+INSERT INTO events VALUES (9610, 6, 117.50);
+INSERT INTO events VALUES (9613, 7, 117.75);
+INSERT INTO events VALUES (9616, 8, 118.00);
+INSERT INTO events VALUES (9619, 9, 118.25);
+INSERT INTO events VALUES (9622, 10, 118.50);
+INSERT INTO events VALUES (9625, 11, 118.75);
+INSERT INTO events VALUES (9628, 12, 119.00);
+INSERT INTO events VALUES (9631, 13, 119.25);
+INSERT INTO events VALUES (9634, 14, 119.50);
+INSERT INTO events VALUES (9637, 15, 119.75);
+INSERT INTO events VALUES (9640, 0, 120.00);
+INSERT INTO events VALUES (9643, 1, 120.25);
+INSERT INTO events VALUES (9646, 2, 120.50);
+INSERT INTO events VALUES (9649, 3, 120.75);
+INSERT INTO events VALUES (9652, 4, 121.00);
+INSERT INTO events VALUES (9655, 5, 121.25);
+INSERT INTO events VALUES (9658, 6, 121.50);
+INSERT INTO events VALUES (9661, 7, 121.75);
+INSERT INTO events VALUES (9664, 8, 122.00);
+INSERT INTO events VALUES (9667, 9, 122.25);
+INSERT INTO events VALUES (9670, 10, 122.50);
+INSERT INTO events VALUES (9673, 11, 122.75);
+INSERT INTO events VALUES (9676, 12, 123.00);
+INSERT INTO events VALUES (9679, 13, 123.25);
+INSERT INTO events VALUES (9682, 14, 123.50);
+INSERT INTO events VALUES (9685, 15, 123.75);
+INSERT INTO events VALUES (9688, 0, 124.00);
+INSERT INTO events VALUES (9691, 1, 124.25);
+INSERT INTO events VALUES (9694, 2, 124.50);
+INSERT INTO events VALUES (9697, 3, 124.75);
+INSERT INTO events VALUES (9700, 4, 100.00);
+INSERT INTO events VALUES (9703, 5, 100.25);
+INSERT INTO events VALUES (9706, 6, 100.50);
+INSERT INTO events VALUES (9709, 7, 100.75);
+INSERT INTO events VALUES (9712, 8, 101.00);
+INSERT INTO events VALUES (9715, 9, 101.25);
+INSERT INTO events VALUES (9718, 10, 101.50);
+INSERT INTO events VALUES (9721, 11, 101.75);
+INSERT INTO events VALUES (9724, 12, 102.00);
+INSERT INTO events VALUES (9727, 13, 102.25);
+INSERT INTO events VALUES (9730, 14, 102.50);
+INSERT INTO events VALUES (9733, 15, 102.75);
+INSERT INTO events VALUES (9736, 0, 103.00);
+INSERT INTO events VALUES (9739, 1, 103.25);
+INSERT INTO events VALUES (9742, 2, 103.50);
+INSERT INTO events VALUES (9745, 3, 103.75);
+INSERT INTO events VALUES (9748, 4, 104.00);
+INSERT INTO events VALUES (9751, 5, 104.25);
+INSERT INTO events VALUES (9754, 6, 104.50);
+INSERT INTO events VALUES (9757, 7, 104.75);
+INSERT INTO events VALUES (9760, 8, 105.00);
+INSERT INTO events VALUES (9763, 9, 105.25);
+INSERT INTO events VALUES (9766, 10, 105.50);
+INSERT INTO events VALUES (9769, 11, 105.75);
+INSERT INTO events VALUES (9772, 12, 106.00);
+INSERT INTO events VALUES (9775, 13, 106.25);
+INSERT INTO events VALUES (9778, 14, 106.50);
+INSERT INTO events VALUES (9781, 15, 106.75);
+INSERT INTO events VALUES (9784, 0, 107.00);
+INSERT INTO events VALUES (9787, 1, 107.25);
+INSERT INTO events VALUES (9790, 2, 107.50);
+INSERT INTO events VALUES (9793, 3, 107.75);
+INSERT INTO events VALUES (9796, 4, 108.00);
+INSERT INTO events VALUES (9799, 5, 108.25);
+INSERT INTO events VALUES (9802, 6, 108.50);
+INSERT INTO events VALUES (9805, 7, 108.75);
+INSERT INTO events VALUES (9808, 8, 109.00);
+INSERT INTO events VALUES (9811, 9, 109.25);
+INSERT INTO events VALUES (9814, 10, 109.50);
+INSERT INTO events VALUES (9817, 11, 109.75);
+INSERT INTO events VALUES (9820, 12, 110.00);
+INSERT INTO events VALUES (9823, 13, 110.25);
+INSERT INTO events VALUES (9826, 14, 110.50);
+INSERT INTO events VALUES (9829, 15, 110.75);
+INSERT INTO events VALUES (9832, 0, 111.00);
+INSERT INTO events VALUES (9835, 1, 111.25);
+INSERT INTO events VALUES (9838, 2, 111.50);
+INSERT INTO events VALUES (9841, 3, 111.75);
+INSERT INTO events VALUES (9844, 4, 112.00);
+INSERT INTO events VALUES (9847, 5, 112.25);
+INSERT INTO events VALUES (9850, 6, 112.50);
+INSERT INTO events VALUES (9853, 7, 112.75);
+INSERT INTO events VALUES (9856, 8, 113.00);
+INSERT INTO events VALUES (9859, 9, 113.25);
+INSERT INTO events VALUES (9862, 10, 113.50);
+INSERT INTO events VALUES (9865, 11, 113.75);
+INSERT INTO events VALUES (9868, 12, 114.00);
+INSERT INTO events VALUES (9871, 13, 114.25);
+INSERT INTO events VALUES (9874, 14, 114.50);
+INSERT INTO events VALUES (9877, 15, 114.75);
+INSERT INTO events VALUES (9880, 0, 115.00);
+INSERT INTO events VALUES (9883, 1, 115.25);
+INSERT INTO events VALUES (9886, 2, 115.50);
+INSERT INTO events VALUES (9889, 3, 115.75);
+INSERT INTO events VALUES (9892, 4, 116.00);
+INSERT INTO events VALUES (9895, 5, 116.25);
+INSERT INTO events VALUES (9898, 6, 116.50);
+INSERT INTO events VALUES (9901, 7, 116.75);
+INSERT INTO events VALUES (9904, 8, 117.00);
+INSERT INTO events VALUES (9907, 9, 117.25);
+INSERT INTO events VALUES (9910, 10, 117.50);
+INSERT INTO events VALUES (9913, 11, 117.75);
+INSERT INTO events VALUES (9916, 12, 118.00);
+INSERT INTO events VALUES (9919, 13, 118.25);
+INSERT INTO events VALUES (9922, 14, 118.50);
+INSERT INTO events VALUES (9925, 15, 118.75);
+INSERT INTO events VALUES (9928, 0, 119.00);
+INSERT INTO events VALUES (9931, 1, 119.25);
+INSERT INTO events VALUES (9934, 2, 119.50);
+INSERT INTO events VALUES (9937, 3, 119.75);
+INSERT INTO events VALUES (9940, 4, 120.00);
+INSERT INTO events VALUES (9943, 5, 120.25);
+INSERT INTO events VALUES (9946, 6, 120.50);
+INSERT INTO events VALUES (9949, 7, 120.75);
+INSERT INTO events VALUES (9952, 8, 121.00);
+INSERT INTO events VALUES (9955, 9, 121.25);
+INSERT INTO events VALUES (9958, 10, 121.50);
+INSERT INTO events VALUES (9961, 11, 121.75);
+INSERT INTO events VALUES (9964, 12, 122.00);
+INSERT INTO events VALUES (9967, 13, 122.25);
+INSERT INTO events VALUES (9970, 14, 122.50);
+INSERT INTO events VALUES (9973, 15, 122.75);
+INSERT INTO events VALUES (9976, 0, 123.00);
+INSERT INTO events VALUES (9979, 1, 123.25);
+INSERT INTO events VALUES (9982, 2, 123.50);
+INSERT INTO events VALUES (9985, 3, 123.75);
+INSERT INTO events VALUES (9988, 4, 124.00);
+INSERT INTO events VALUES (9991, 5, 124.25);
+INSERT INTO events VALUES (9994, 6, 124.50);
+INSERT INTO events VALUES (9997, 7, 124.75);
+INSERT INTO events VALUES (10000, 8, 100.00);
+INSERT INTO events VALUES (10003, 9, 100.25);
+INSERT INTO events VALUES (10006, 10, 100.50);
+INSERT INTO events VALUES (10009, 11, 100.75);
+INSERT INTO events VALUES (10012, 12, 101.00);
+INSERT INTO events VALUES (10015, 13, 101.25);
+INSERT INTO events VALUES (10018, 14, 101.50);
+INSERT INTO events VALUES (10021, 15, 101.75);
+INSERT INTO events VALUES (10024, 0, 102.00);
+INSERT INTO events VALUES (10027, 1, 102.25);
+INSERT INTO events VALUES (10030, 2, 102.50);
+INSERT INTO events VALUES (10033, 3, 102.75);
+INSERT INTO events VALUES (10036, 4, 103.00);
+INSERT INTO events VALUES (10039, 5, 103.25);
+INSERT INTO events VALUES (10042, 6, 103.50);
+INSERT INTO events VALUES (10045, 7, 103.75);
+INSERT INTO events VALUES (10048, 8, 104.00);
+INSERT INTO events VALUES (10051, 9, 104.25);
+INSERT INTO events VALUES (10054, 10, 104.50);
+INSERT INTO events VALUES (10057, 11, 104.75);
+INSERT INTO events VALUES (10060, 12, 105.00);
+INSERT INTO events VALUES (10063, 13, 105.25);
+INSERT INTO events VALUES (10066, 14, 105.50);
+INSERT INTO events VALUES (10069, 15, 105.75);
+INSERT INTO events VALUES (10072, 0, 106.00);
+INSERT INTO events VALUES (10075, 1, 106.25);
+INSERT INTO events VALUES (10078, 2, 106.50);
+INSERT INTO events VALUES (10081, 3, 106.75);
+INSERT INTO events VALUES (10084, 4, 107.00);
+INSERT INTO events VALUES (10087, 5, 107.25);
+INSERT INTO events VALUES (10090, 6, 107.50);
+INSERT INTO events VALUES (10093, 7, 107.75);
+INSERT INTO events VALUES (10096, 8, 108.00);
+INSERT INTO events VALUES (10099, 9, 108.25);
+INSERT INTO events VALUES (10102, 10, 108.50);
+INSERT INTO events VALUES (10105, 11, 108.75);
+INSERT INTO events VALUES (10108, 12, 109.00);
+INSERT INTO events VALUES (10111, 13, 109.25);
+INSERT INTO events VALUES (10114, 14, 109.50);
+INSERT INTO events VALUES (10117, 15, 109.75);
+INSERT INTO events VALUES (10120, 0, 110.00);
+INSERT INTO events VALUES (10123, 1, 110.25);
+INSERT INTO events VALUES (10126, 2, 110.50);
+INSERT INTO events VALUES (10129, 3, 110.75);
+INSERT INTO events VALUES (10132, 4, 111.00);
+INSERT INTO events VALUES (10135, 5, 111.25);
+INSERT INTO events VALUES (10138, 6, 111.50);
+INSERT INTO events VALUES (10141, 7, 111.75);
+INSERT INTO events VALUES (10144, 8, 112.00);
+INSERT INTO events VALUES (10147, 9, 112.25);
+INSERT INTO events VALUES (10150, 10, 112.50);
+INSERT INTO events VALUES (10153, 11, 112.75);
+INSERT INTO events VALUES (10156, 12, 113.00);
+INSERT INTO events VALUES (10159, 13, 113.25);
+INSERT INTO events VALUES (10162, 14, 113.50);
+INSERT INTO events VALUES (10165, 15, 113.75);
+INSERT INTO events VALUES (10168, 0, 114.00);
+INSERT INTO events VALUES (10171, 1, 114.25);
+INSERT INTO events VALUES (10174, 2, 114.50);
+INSERT INTO events VALUES (10177, 3, 114.75);
+INSERT INTO events VALUES (10180, 4, 115.00);
+INSERT INTO events VALUES (10183, 5, 115.25);
+INSERT INTO events VALUES (10186, 6, 115.50);
+INSERT INTO events VALUES (10189, 7, 115.75);
+INSERT INTO events VALUES (10192, 8, 116.00);
+INSERT INTO events VALUES (10195, 9, 116.25);
+INSERT INTO events VALUES (10198, 10, 116.50);
+INSERT INTO events VALUES (10201, 11, 116.75);
+INSERT INTO events VALUES (10204, 12, 117.00);
+INSERT INTO events VALUES (10207, 13, 117.25);
+INSERT INTO events VALUES (10210, 14, 117.50);
+INSERT INTO events VALUES (10213, 15, 117.75);
+INSERT INTO events VALUES (10216, 0, 118.00);
+INSERT INTO events VALUES (10219, 1, 118.25);
+INSERT INTO events VALUES (10222, 2, 118.50);
+INSERT INTO events VALUES (10225, 3, 118.75);
+INSERT INTO events VALUES (10228, 4, 119.00);
+INSERT INTO events VALUES (10231, 5, 119.25);
+INSERT INTO events VALUES (10234, 6, 119.50);
+INSERT INTO events VALUES (10237, 7, 119.75);
+INSERT INTO events VALUES (10240, 8, 120.00);
+INSERT INTO events VALUES (10243, 9, 120.25);
+INSERT INTO events VALUES (10246, 10, 120.50);
+INSERT INTO events VALUES (10249, 11, 120.75);
+INSERT INTO events VALUES (10252, 12, 121.00);
+INSERT INTO events VALUES (10255, 13, 121.25);
+INSERT INTO events VALUES (10258, 14, 121.50);
+INSERT INTO events VALUES (10261, 15, 121.75);
+INSERT INTO events VALUES (10264, 0, 122.00);
+INSERT INTO events VALUES (10267, 1, 122.25);
+INSERT INTO events VALUES (10270, 2, 122.50);
+INSERT INTO events VALUES (10273, 3, 122.75);
+INSERT INTO events VALUES (10276, 4, 123.00);
+INSERT INTO events VALUES (10279, 5, 123.25);
+INSERT INTO events VALUES (10282, 6, 123.50);
+INSERT INTO events VALUES (10285, 7, 123.75);
+INSERT INTO events VALUES (10288, 8, 124.00);
+INSERT INTO events VALUES (10291, 9, 124.25);
+INSERT INTO events VALUES (10294, 10, 124.50);
+INSERT INTO events VALUES (10297, 11, 124.75);
+INSERT INTO events VALUES (10300, 12, 100.00);
+INSERT INTO events VALUES (10303, 13, 100.25);
+INSERT INTO events VALUES (10306, 14, 100.50);
+INSERT INTO events VALUES (10309, 15, 100.75);
+INSERT INTO events VALUES (10312, 0, 101.00);
+INSERT INTO events VALUES (10315, 1, 101.25);
+INSERT INTO events VALUES (10318, 2, 101.50);
+INSERT INTO events VALUES (10321, 3, 101.75);
+INSERT INTO events VALUES (10324, 4, 102.00);
+INSERT INTO events VALUES (10327, 5, 102.25);
+INSERT INTO events VALUES (10330, 6, 102.50);
+INSERT INTO events VALUES (10333, 7, 102.75);
+INSERT INTO events VALUES (10336, 8, 103.00);
+INSERT INTO events VALUES (10339, 9, 103.25);
+INSERT INTO events VALUES (10342, 10, 103.50);
+INSERT INTO events VALUES (10345, 11, 103.75);
+INSERT INTO events VALUES (10348, 12, 104.00);
+INSERT INTO events VALUES (10351, 13, 104.25);
+INSERT INTO events VALUES (10354, 14, 104.50);
+INSERT INTO events VALUES (10357, 15, 104.75);
+INSERT INTO events VALUES (10360, 0, 105.00);
+INSERT INTO events VALUES (10363, 1, 105.25);
+INSERT INTO events VALUES (10366, 2, 105.50);
+INSERT INTO events VALUES (10369, 3, 105.75);
+INSERT INTO events VALUES (10372, 4, 106.00);
+INSERT INTO events VALUES (10375, 5, 106.25);
+INSERT INTO events VALUES (10378, 6, 106.50);
+INSERT INTO events VALUES (10381, 7, 106.75);
+INSERT INTO events VALUES (10384, 8, 107.00);
+INSERT INTO events VALUES (10387, 9, 107.25);
+INSERT INTO events VALUES (10390, 10, 107.50);
+INSERT INTO events VALUES (10393, 11, 107.75);
+INSERT INTO events VALUES (10396, 12, 108.00);
+INSERT INTO events VALUES (10399, 13, 108.25);
+INSERT INTO events VALUES (10402, 14, 108.50);
+INSERT INTO events VALUES (10405, 15, 108.75);
+INSERT INTO events VALUES (10408, 0, 109.00);
+INSERT INTO events VALUES (10411, 1, 109.25);
+INSERT INTO events VALUES (10414, 2, 109.50);
+INSERT INTO events VALUES (10417, 3, 109.75);
+INSERT INTO events VALUES (10420, 4, 110.00);
+INSERT INTO events VALUES (10423, 5, 110.25);
+INSERT INTO events VALUES (10426, 6, 110.50);
+INSERT INTO events VALUES (10429, 7, 110.75);
+INSERT INTO events VALUES (10432, 8, 111.00);
+INSERT INTO events VALUES (10435, 9, 111.25);
+INSERT INTO events VALUES (10438, 10, 111.50);
+INSERT INTO events VALUES (10441, 11, 111.75);
+INSERT INTO events VALUES (10444, 12, 112.00);
+INSERT INTO events VALUES (10447, 13, 112.25);
+INSERT INTO events VALUES (10450, 14, 112.50);
+INSERT INTO events VALUES (10453, 15, 112.75);
+INSERT INTO events VALUES (10456, 0, 113.00);
+INSERT INTO events VALUES (10459, 1, 113.25);
+INSERT INTO events VALUES (10462, 2, 113.50);
+INSERT INTO events VALUES (10465, 3, 113.75);
+INSERT INTO events VALUES (10468, 4, 114.00);
+INSERT INTO events VALUES (10471, 5, 114.25);
+INSERT INTO events VALUES (10474, 6, 114.50);
+INSERT INTO events VALUES (10477, 7, 114.75);
+INSERT INTO events VALUES (10480, 8, 115.00);
+INSERT INTO events VALUES (10483, 9, 115.25);
+INSERT INTO events VALUES (10486, 10, 115.50);
+INSERT INTO events VALUES (10489, 11, 115.75);
+INSERT INTO events VALUES (10492, 12, 116.00);
+INSERT INTO events VALUES (10495, 13, 116.25);
+INSERT INTO events VALUES (10498, 14, 116.50);
+INSERT INTO events VALUES (10501, 15, 116.75);
+INSERT INTO events VALUES (10504, 0, 117.00);
+INSERT INTO events VALUES (10507, 1, 117.25);
+INSERT INTO events VALUES (10510, 2, 117.50);
+INSERT INTO events VALUES (10513, 3, 117.75);
+INSERT INTO events VALUES (10516, 4, 118.00);
+INSERT INTO events VALUES (10519, 5, 118.25);
+INSERT INTO events VALUES (10522, 6, 118.50);
+INSERT INTO events VALUES (10525, 7, 118.75);
+INSERT INTO events VALUES (10528, 8, 119.00);
+INSERT INTO events VALUES (10531, 9, 119.25);
+INSERT INTO events VALUES (10534, 10, 119.50);
+INSERT INTO events VALUES (10537, 11, 119.75);
+INSERT INTO events VALUES (10540, 12, 120.00);
+INSERT INTO events VALUES (10543, 13, 120.25);
+INSERT INTO events VALUES (10546, 14, 120.50);
+INSERT INTO events VALUES (10549, 15, 120.75);
+INSERT INTO events VALUES (10552, 0, 121.00);
+INSERT INTO events VALUES (10555, 1, 121.25);
+INSERT INTO events VALUES (10558, 2, 121.50);
+INSERT INTO events VALUES (10561, 3, 121.75);
+INSERT INTO events VALUES (10564, 4, 122.00);
+INSERT INTO events VALUES (10567, 5, 122.25);
+INSERT INTO events VALUES (10570, 6, 122.50);
+INSERT INTO events VALUES (10573, 7, 122.75);
+INSERT INTO events VALUES (10576, 8, 123.00);
+INSERT INTO events VALUES (10579, 9, 123.25);
+INSERT INTO events VALUES (10582, 10, 123.50);
+INSERT INTO events VALUES (10585, 11, 123.75);
+INSERT INTO events VALUES (10588, 12, 124.00);
+INSERT INTO events VALUES (10591, 13, 124.25);
+INSERT INTO events VALUES (10594, 14, 124.50);
+INSERT INTO events VALUES (10597, 15, 124.75);
+INSERT INTO events VALUES (10600, 0, 100.00);
+INSERT INTO events VALUES (10603, 1, 100.25);
+INSERT INTO events VALUES (10606, 2, 100.50);
+INSERT INTO events VALUES (10609, 3, 100.75);
+INSERT INTO events VALUES (10612, 4, 101.00);
+INSERT INTO events VALUES (10615, 5, 101.25);
+INSERT INTO events VALUES (10618, 6, 101.50);
+INSERT INTO events VALUES (10621, 7, 101.75);
+INSERT INTO events VALUES (10624, 8, 102.00);
+INSERT INTO events VALUES (10627, 9, 102.25);
+INSERT INTO events VALUES (10630, 10, 102.50);
+INSERT INTO events VALUES (10633, 11, 102.75);
+INSERT INTO events VALUES (10636, 12, 103.00);
+INSERT INTO events VALUES (10639, 13, 103.25);
+INSERT INTO events VALUES (10642, 14, 103.50);
+INSERT INTO events VALUES (10645, 15, 103.75);
+INSERT INTO events VALUES (10648, 0, 104.00);
+INSERT INTO events VALUES (10651, 1, 104.25);
+INSERT INTO events VALUES (10654, 2, 104.50);
+INSERT INTO events VALUES (10657, 3, 104.75);
+INSERT INTO events VALUES (10660, 4, 105.00);
+INSERT INTO events VALUES (10663, 5, 105.25);
+INSERT INTO events VALUES (10666, 6, 105.50);
+INSERT INTO events VALUES (10669, 7, 105.75);
+INSERT INTO events VALUES (10672, 8, 106.00);
+INSERT INTO events VALUES (10675, 9, 106.25);
+INSERT INTO events VALUES (10678, 10, 106.50);
+INSERT INTO events VALUES (10681, 11, 106.75);
+INSERT INTO events VALUES (10684, 12, 107.00);
+INSERT INTO events VALUES (10687, 13, 107.25);
+INSERT INTO events VALUES (10690, 14, 107.50);
+INSERT INTO events VALUES (10693, 15, 107.75);
+INSERT INTO events VALUES (10696, 0, 108.00);
+INSERT INTO events VALUES (10699, 1, 108.25);
+INSERT INTO events VALUES (10702, 2, 108.50);
+INSERT INTO events VALUES (10705, 3, 108.75);
+INSERT INTO events VALUES (10708, 4, 109.00);
+INSERT INTO events VALUES (10711, 5, 109.25);
+INSERT INTO events VALUES (10714, 6, 109.50);
+INSERT INTO events VALUES (10717, 7, 109.75);
+INSERT INTO events VALUES (10720, 8, 110.00);
+INSERT INTO events VALUES (10723, 9, 110.25);
+INSERT INTO events VALUES (10726, 10, 110.50);
+INSERT INTO events VALUES (10729, 11, 110.75);
+INSERT INTO events VALUES (10732, 12, 111.00);
+INSERT INTO events VALUES (10735, 13, 111.25);
+INSERT INTO events VALUES (10738, 14, 111.50);
+INSERT INTO events VALUES (10741, 15, 111.75);
+INSERT INTO events VALUES (10744, 0, 112.00);
+INSERT INTO events VALUES (10747, 1, 112.25);
+INSERT INTO events VALUES (10750, 2, 112.50);
+INSERT INTO events VALUES (10753, 3, 112.75);
+INSERT INTO events VALUES (10756, 4, 113.00);
+INSERT INTO events VALUES (10759, 5, 113.25);
+INSERT INTO events VALUES (10762, 6, 113.50);
+INSERT INTO events VALUES (10765, 7, 113.75);
+INSERT INTO events VALUES (10768, 8, 114.00);
+INSERT INTO events VALUES (10771, 9, 114.25);
+INSERT INTO events VALUES (10774, 10, 114.50);
+INSERT INTO events VALUES (10777, 11, 114.75);
+INSERT INTO events VALUES (10780, 12, 115.00);
+INSERT INTO events VALUES (10783, 13, 115.25);
+INSERT INTO events VALUES (10786, 14, 115.50);
+INSERT INTO events VALUES (10789, 15, 115.75);
+INSERT INTO events VALUES (10792, 0, 116.00);
+INSERT INTO events VALUES (10795, 1, 116.25);
+INSERT INTO events VALUES (10798, 2, 116.50);
+INSERT INTO events VALUES (10801, 3, 116.75);
+INSERT INTO events VALUES (10804, 4, 117.00);
+INSERT INTO events VALUES (10807, 5, 117.25);
+INSERT INTO events VALUES (10810, 6, 117.50);
+INSERT INTO events VALUES (10813, 7, 117.75);
+INSERT INTO events VALUES (10816, 8, 118.00);
+INSERT INTO events VALUES (10819, 9, 118.25);
+INSERT INTO events VALUES (10822, 10, 118.50);
+INSERT INTO events VALUES (10825, 11, 118.75);
+INSERT INTO events VALUES (10828, 12, 119.00);
+INSERT INTO events VALUES (10831, 13, 119.25);
+INSERT INTO events VALUES (10834, 14, 119.50);
+INSERT INTO events VALUES (10837, 15, 119.75);
+INSERT INTO events VALUES (10840, 0, 120.00);
+INSERT INTO events VALUES (10843, 1, 120.25);
+INSERT INTO events VALUES (10846, 2, 120.50);
+INSERT INTO events VALUES (10849, 3, 120.75);
+INSERT INTO events VALUES (10852, 4, 121.00);
+INSERT INTO events VALUES (10855, 5, 121.25);
+INSERT INTO events VALUES (10858, 6, 121.50);
+INSERT INTO events VALUES (10861, 7, 121.75);
+INSERT INTO events VALUES (10864, 8, 122.00);
+INSERT INTO events VALUES (10867, 9, 122.25);
+INSERT INTO events VALUES (10870, 10, 122.50);
+INSERT INTO events VALUES (10873, 11, 122.75);
+INSERT INTO events VALUES (10876, 12, 123.00);
+INSERT INTO events VALUES (10879, 13, 123.25);
+INSERT INTO events VALUES (10882, 14, 123.50);
+INSERT INTO events VALUES (10885, 15, 123.75);
+INSERT INTO events VALUES (10888, 0, 124.00);
+INSERT INTO events VALUES (10891, 1, 124.25);
+INSERT INTO events VALUES (10894, 2, 124.50);
+INSERT INTO events VALUES (10897, 3, 124.75);
+INSERT INTO events VALUES (10900, 4, 100.00);
+INSERT INTO events VALUES (10903, 5, 100.25);
+INSERT INTO events VALUES (10906, 6, 100.50);
+INSERT INTO events VALUES (10909, 7, 100.75);
+INSERT INTO events VALUES (10912, 8, 101.00);
+INSERT INTO events VALUES (10915, 9, 101.25);
+INSERT INTO events VALUES (10918, 10, 101.50);
+INSERT INTO events VALUES (10921, 11, 101.75);
+INSERT INTO events VALUES (10924, 12, 102.00);
+INSERT INTO events VALUES (10927, 13, 102.25);
+INSERT INTO events VALUES (10930, 14, 102.50);
+INSERT INTO events VALUES (10933, 15, 102.75);
+INSERT INTO events VALUES (10936, 0, 103.00);
+INSERT INTO events VALUES (10939, 1, 103.25);
+INSERT INTO events VALUES (10942, 2, 103.50);
+INSERT INTO events VALUES (10945, 3, 103.75);
+INSERT INTO events VALUES (10948, 4, 104.00);
+INSERT INTO events VALUES (10951, 5, 104.25);
+INSERT INTO events VALUES (10954, 6, 104.50);
+INSERT INTO events VALUES (10957, 7, 104.75);
+INSERT INTO events VALUES (10960, 8, 105.00);
+INSERT INTO events VALUES (10963, 9, 105.25);
+INSERT INTO events VALUES (10966, 10, 105.50);
+INSERT INTO events VALUES (10969, 11, 105.75);
+INSERT INTO events VALUES (10972, 12, 106.00);
+INSERT INTO events VALUES (10975, 13, 106.25);
+INSERT INTO events VALUES (10978, 14, 106.50);
+INSERT INTO events VALUES (10981, 15, 106.75);
+INSERT INTO events VALUES (10984, 0, 107.00);
+INSERT INTO events VALUES (10987, 1, 107.25);
+INSERT INTO events VALUES (10990, 2, 107.50);
+INSERT INTO events VALUES (10993, 3, 107.75);
+INSERT INTO events VALUES (10996, 4, 108.00);
+INSERT INTO events VALUES (10999, 5, 108.25);
+INSERT INTO events VALUES (11002, 6, 108.50);
+INSERT INTO events VALUES (11005, 7, 108.75);
+INSERT INTO events VALUES (11008, 8, 109.00);
+INSERT INTO events VALUES (11011, 9, 109.25);
+INSERT INTO events VALUES (11014, 10, 109.50);
+INSERT INTO events VALUES (11017, 11, 109.75);
+INSERT INTO events VALUES (11020, 12, 110.00);
+INSERT INTO events VALUES (11023, 13, 110.25);
+INSERT INTO events VALUES (11026, 14, 110.50);
+INSERT INTO events VALUES (11029, 15, 110.75);
+INSERT INTO events VALUES (11032, 0, 111.00);
+INSERT INTO events VALUES (11035, 1, 111.25);
+INSERT INTO events VALUES (11038, 2, 111.50);
+INSERT INTO events VALUES (11041, 3, 111.75);
+INSERT INTO events VALUES (11044, 4, 112.00);
+INSERT INTO events VALUES (11047, 5, 112.25);
+INSERT INTO events VALUES (11050, 6, 112.50);
+INSERT INTO events VALUES (11053, 7, 112.75);
+INSERT INTO events VALUES (11056, 8, 113.00);
+INSERT INTO events VALUES (11059, 9, 113.25);
+INSERT INTO events VALUES (11062, 10, 113.50);
+INSERT INTO events VALUES (11065, 11, 113.75);
+INSERT INTO events VALUES (11068, 12, 114.00);
+INSERT INTO events VALUES (11071, 13, 114.25);
+INSERT INTO events VALUES (11074, 14, 114.50);
+INSERT INTO events VALUES (11077, 15, 114.75);
+INSERT INTO events VALUES (11080, 0, 115.00);
+INSERT INTO events VALUES (11083, 1, 115.25);
+INSERT INTO events VALUES (11086, 2, 115.50);
+INSERT INTO events VALUES (11089, 3, 115.75);
+INSERT INTO events VALUES (11092, 4, 116.00);
+INSERT INTO events VALUES (11095, 5, 116.25);
+INSERT INTO events VALUES (11098, 6, 116.50);
+INSERT INTO events VALUES (11101, 7, 116.75);
+INSERT INTO events VALUES (11104, 8, 117.00);
+INSERT INTO events VALUES (11107, 9, 117.25);
+INSERT INTO events VALUES (11110, 10, 117.50);
+INSERT INTO events VALUES (11113, 11, 117.75);
+INSERT INTO events VALUES (11116, 12, 118.00);
+INSERT INTO events VALUES (11119, 13, 118.25);
+INSERT INTO events VALUES (11122, 14, 118.50);
+INSERT INTO events VALUES (11125, 15, 118.75);
+INSERT INTO events VALUES (11128, 0, 119.00);
+INSERT INTO events VALUES (11131, 1, 119.25);
+INSERT INTO events VALUES (11134, 2, 119.50);
+INSERT INTO events VALUES (11137, 3, 119.75);
+INSERT INTO events VALUES (11140, 4, 120.00);
+INSERT INTO events VALUES (11143, 5, 120.25);
+INSERT INTO events VALUES (11146, 6, 120.50);
+INSERT INTO events VALUES (11149, 7, 120.75);
+INSERT INTO events VALUES (11152, 8, 121.00);
+INSERT INTO events VALUES (11155, 9, 121.25);
+INSERT INTO events VALUES (11158, 10, 121.50);
+INSERT INTO events VALUES (11161, 11, 121.75);
+INSERT INTO events VALUES (11164, 12, 122.00);
+INSERT INTO events VALUES (11167, 13, 122.25);
+INSERT INTO events VALUES (11170, 14, 122.50);
+INSERT INTO events VALUES (11173, 15, 122.75);
+INSERT INTO events VALUES (11176, 0, 123.00);
+INSERT INTO events VALUES (11179, 1, 123.25);
+INSERT INTO events VALUES (11182, 2, 123.50);
+INSERT INTO events VALUES (11185, 3, 123.75);
+INSERT INTO events VALUES (11188, 4, 124.00);
+INSERT INTO events VALUES (11191, 5, 124.25);
+INSERT INTO events VALUES (11194, 6, 124.50);
+INSERT INTO events VALUES (11197, 7, 124.75);
+INSERT INTO events VALUES (11200, 8, 100.00);
+INSERT INTO events VALUES (11203, 9, 100.25);
+INSERT INTO events VALUES (11206, 10, 100.50);
+INSERT INTO events VALUES (11209, 11, 100.75);
+INSERT INTO events VALUES (11212, 12, 101.00);
+INSERT INTO events VALUES (11215, 13, 101.25);
+INSERT INTO events VALUES (11218, 14, 101.50);
+INSERT INTO events VALUES (11221, 15, 101.75);
+INSERT INTO events VALUES (11224, 0, 102.00);
+INSERT INTO events VALUES (11227, 1, 102.25);
+INSERT INTO events VALUES (11230, 2, 102.50);
+INSERT INTO events VALUES (11233, 3, 102.75);
+INSERT INTO events VALUES (11236, 4, 103.00);
+INSERT INTO events VALUES (11239, 5, 103.25);
+INSERT INTO events VALUES (11242, 6, 103.50);
+INSERT INTO events VALUES (11245, 7, 103.75);
+INSERT INTO events VALUES (11248, 8, 104.00);
+INSERT INTO events VALUES (11251, 9, 104.25);
+INSERT INTO events VALUES (11254, 10, 104.50);
+INSERT INTO events VALUES (11257, 11, 104.75);
+INSERT INTO events VALUES (11260, 12, 105.00);
+INSERT INTO events VALUES (11263, 13, 105.25);
+INSERT INTO events VALUES (11266, 14, 105.50);
+INSERT INTO events VALUES (11269, 15, 105.75);
+INSERT INTO events VALUES (11272, 0, 106.00);
+INSERT INTO events VALUES (11275, 1, 106.25);
+INSERT INTO events VALUES (11278, 2, 106.50);
+INSERT INTO events VALUES (11281, 3, 106.75);
+INSERT INTO events VALUES (11284, 4, 107.00);
+INSERT INTO events VALUES (11287, 5, 107.25);
+INSERT INTO events VALUES (11290, 6, 107.50);
+INSERT INTO events VALUES (11293, 7, 107.75);
+INSERT INTO events VALUES (11296, 8, 108.00);
+INSERT INTO events VALUES (11299, 9, 108.25);
+INSERT INTO events VALUES (11302, 10, 108.50);
+INSERT INTO events VALUES (11305, 11, 108.75);
+INSERT INTO events VALUES (11308, 12, 109.00);
+INSERT INTO events VALUES (11311, 13, 109.25);
+INSERT INTO events VALUES (11314, 14, 109.50);
+INSERT INTO events VALUES (11317, 15, 109.75);
+INSERT INTO events VALUES (11320, 0, 110.00);
+INSERT INTO events VALUES (11323, 1, 110.25);
+INSERT INTO events VALUES (11326, 2, 110.50);
+INSERT INTO events VALUES (11329, 3, 110.75);
+INSERT INTO events VALUES (11332, 4, 111.00);
+INSERT INTO events VALUES (11335, 5, 111.25);
+INSERT INTO events VALUES (11338, 6, 111.50);
+INSERT INTO events VALUES (11341, 7, 111.75);
+INSERT INTO events VALUES (11344, 8, 112.00);
+INSERT INTO events VALUES (11347, 9, 112.25);
+INSERT INTO events VALUES (11350, 10, 112.50);
+INSERT INTO events VALUES (11353, 11, 112.75);
+INSERT INTO events VALUES (11356, 12, 113.00);
+INSERT INTO events VALUES (11359, 13, 113.25);
+INSERT INTO events VALUES (11362, 14, 113.50);
+INSERT INTO events VALUES (11365, 15, 113.75);
+INSERT INTO events VALUES (11368, 0, 114.00);
+INSERT INTO events VALUES (11371, 1, 114.25);
+INSERT INTO events VALUES (11374, 2, 114.50);
+INSERT INTO events VALUES (11377, 3, 114.75);
+INSERT INTO events VALUES (11380, 4, 115.00);
+INSERT INTO events VALUES (11383, 5, 115.25);
+INSERT INTO events VALUES (11386, 6, 115.50);
+INSERT INTO events VALUES (11389, 7, 115.75);
+INSERT INTO events VALUES (11392, 8, 116.00);
+INSERT INTO events VALUES (11395, 9, 116.25);
+INSERT INTO events VALUES (11398, 10, 116.50);
+INSERT INTO events VALUES (11401, 11, 116.75);
+INSERT INTO events VALUES (11404, 12, 117.00);
+INSERT INTO events VALUES (11407, 13, 117.25);
+INSERT INTO events VALUES (11410, 14, 117.50);
+INSERT INTO events VALUES (11413, 15, 117.75);
+INSERT INTO events VALUES (11416, 0, 118.00);
+INSERT INTO events VALUES (11419, 1, 118.25);
+INSERT INTO events VALUES (11422, 2, 118.50);
+INSERT INTO events VALUES (11425, 3, 118.75);
+INSERT INTO events VALUES (11428, 4, 119.00);
+INSERT INTO events VALUES (11431, 5, 119.25);
+INSERT INTO events VALUES (11434, 6, 119.50);
+INSERT INTO events VALUES (11437, 7, 119.75);
+INSERT INTO events VALUES (11440, 8, 120.00);
+INSERT INTO events VALUES (11443, 9, 120.25);
+INSERT INTO events VALUES (11446, 10, 120.50);
+INSERT INTO events VALUES (11449, 11, 120.75);
+INSERT INTO events VALUES (11452, 12, 121.00);
+INSERT INTO events VALUES (11455, 13, 121.25);
+INSERT INTO events VALUES (11458, 14, 121.50);
+INSERT INTO events VALUES (11461, 15, 121.75);
+INSERT INTO events VALUES (11464, 0, 122.00);
+INSERT INTO events VALUES (11467, 1, 122.25);
+INSERT INTO events VALUES (11470, 2, 122.50);
+INSERT INTO events VALUES (11473, 3, 122.75);
+INSERT INTO events VALUES (11476, 4, 123.00);
+INSERT INTO events VALUES (11479, 5, 123.25);
+INSERT INTO events VALUES (11482, 6, 123.50);
+INSERT INTO events VALUES (11485, 7, 123.75);
+INSERT INTO events VALUES (11488, 8, 124.00);
+INSERT INTO events VALUES (11491, 9, 124.25);
+INSERT INTO events VALUES (11494, 10, 124.50);
+INSERT INTO events VALUES (11497, 11, 124.75);
+INSERT INTO events VALUES (11500, 12, 100.00);
+INSERT INTO events VALUES (11503, 13, 100.25);
+INSERT INTO events VALUES (11506, 14, 100.50);
+INSERT INTO events VALUES (11509, 15, 100.75);
+INSERT INTO events VALUES (11512, 0, 101.00);
+INSERT INTO events VALUES (11515, 1, 101.25);
+INSERT INTO events VALUES (11518, 2, 101.50);
+INSERT INTO events VALUES (11521, 3, 101.75);
+INSERT INTO events VALUES (11524, 4, 102.00);
+INSERT INTO events VALUES (11527, 5, 102.25);
+INSERT INTO events VALUES (11530, 6, 102.50);
+INSERT INTO events VALUES (11533, 7, 102.75);
+INSERT INTO events VALUES (11536, 8, 103.00);
+INSERT INTO events VALUES (11539, 9, 103.25);
+INSERT INTO events VALUES (11542, 10, 103.50);
+INSERT INTO events VALUES (11545, 11, 103.75);
+INSERT INTO events VALUES (11548, 12, 104.00);
+INSERT INTO events VALUES (11551, 13, 104.25);
+INSERT INTO events VALUES (11554, 14, 104.50);
+INSERT INTO events VALUES (11557, 15, 104.75);
+INSERT INTO events VALUES (11560, 0, 105.00);
+INSERT INTO events VALUES (11563, 1, 105.25);
+INSERT INTO events VALUES (11566, 2, 105.50);
+INSERT INTO events VALUES (11569, 3, 105.75);
+INSERT INTO events VALUES (11572, 4, 106.00);
+INSERT INTO events VALUES (11575, 5, 106.25);
+INSERT INTO events VALUES (11578, 6, 106.50);
+INSERT INTO events VALUES (11581, 7, 106.75);
+INSERT INTO events VALUES (11584, 8, 107.00);
+INSERT INTO events VALUES (11587, 9, 107.25);
+INSERT INTO events VALUES (11590, 10, 107.50);
+INSERT INTO events VALUES (11593, 11, 107.75);
+INSERT INTO events VALUES (11596, 12, 108.00);
+INSERT INTO events VALUES (11599, 13, 108.25);
+INSERT INTO events VALUES (11602, 14, 108.50);
+INSERT INTO events VALUES (11605, 15, 108.75);
+INSERT INTO events VALUES (11608, 0, 109.00);
+INSERT INTO events VALUES (11611, 1, 109.25);
+INSERT INTO events VALUES (11614, 2, 109.50);
+INSERT INTO events VALUES (11617, 3, 109.75);
+INSERT INTO events VALUES (11620, 4, 110.00);
+INSERT INTO events VALUES (11623, 5, 110.25);
+INSERT INTO events VALUES (11626, 6, 110.50);
+INSERT INTO events VALUES (11629, 7, 110.75);
+INSERT INTO events VALUES (11632, 8, 111.00);
+INSERT INTO events VALUES (11635, 9, 111.25);
+INSERT INTO events VALUES (11638, 10, 111.50);
+INSERT INTO events VALUES (11641, 11, 111.75);
+INSERT INTO events VALUES (11644, 12, 112.00);
+INSERT INTO events VALUES (11647, 13, 112.25);
+INSERT INTO events VALUES (11650, 14, 112.50);
+INSERT INTO events VALUES (11653, 15, 112.75);
+INSERT INTO events VALUES (11656, 0, 113.00);
+INSERT INTO events VALUES (11659, 1, 113.25);
+INSERT INTO events VALUES (11662, 2, 113.50);
+INSERT INTO events VALUES (11665, 3, 113.75);
+INSERT INTO events VALUES (11668, 4, 114.00);
+INSERT INTO events VALUES (11671, 5, 114.25);
+INSERT INTO events VALUES (11674, 6, 114.50);
+INSERT INTO events VALUES (11677, 7, 114.75);
+INSERT INTO events VALUES (11680, 8, 115.00);
+INSERT INTO events VALUES (11683, 9, 115.25);
+INSERT INTO events VALUES (11686, 10, 115.50);
+INSERT INTO events VALUES (11689, 11, 115.75);
+INSERT INTO events VALUES (11692, 12, 116.00);
+INSERT INTO events VALUES (11695, 13, 116.25);
+INSERT INTO events VALUES (11698, 14, 116.50);
+INSERT INTO events VALUES (11701, 15, 116.75);
+INSERT INTO events VALUES (11704, 0, 117.00);
+INSERT INTO events VALUES (11707, 1, 117.25);
+INSERT INTO events VALUES (11710, 2, 117.50);
+INSERT INTO events VALUES (11713, 3, 117.75);
+INSERT INTO events VALUES (11716, 4, 118.00);
+INSERT INTO events VALUES (11719, 5, 118.25);
+INSERT INTO events VALUES (11722, 6, 118.50);
+INSERT INTO events VALUES (11725, 7, 118.75);
+INSERT INTO events VALUES (11728, 8, 119.00);
+INSERT INTO events VALUES (11731, 9, 119.25);
+INSERT INTO events VALUES (11734, 10, 119.50);
+INSERT INTO events VALUES (11737, 11, 119.75);
+INSERT INTO events VALUES (11740, 12, 120.00);
+INSERT INTO events VALUES (11743, 13, 120.25);
+INSERT INTO events VALUES (11746, 14, 120.50);
+INSERT INTO events VALUES (11749, 15, 120.75);
+INSERT INTO events VALUES (11752, 0, 121.00);
+INSERT INTO events VALUES (11755, 1, 121.25);
+INSERT INTO events VALUES (11758, 2, 121.50);
+INSERT INTO events VALUES (11761, 3, 121.75);
+INSERT INTO events VALUES (11764, 4, 122.00);
+INSERT INTO events VALUES (11767, 5, 122.25);
+INSERT INTO events VALUES (11770, 6, 122.50);
+INSERT INTO events VALUES (11773, 7, 122.75);
+INSERT INTO events VALUES (11776, 8, 123.00);
+INSERT INTO events VALUES (11779, 9, 123.25);
+INSERT INTO events VALUES (11782, 10, 123.50);
+INSERT INTO events VALUES (11785, 11, 123.75);
+INSERT INTO events VALUES (11788, 12, 124.00);
+INSERT INTO events VALUES (11791, 13, 124.25);
+INSERT INTO events VALUES (11794, 14, 124.50);
+INSERT INTO events VALUES (11797, 15, 124.75);
+INSERT INTO events VALUES (11800, 0, 100.00);
+INSERT INTO events VALUES (11803, 1, 100.25);
+INSERT INTO events VALUES (11806, 2, 100.50);
+INSERT INTO events VALUES (11809, 3, 100.75);
+INSERT INTO events VALUES (11812, 4, 101.00);
+INSERT INTO events VALUES (11815, 5, 101.25);
+INSERT INTO events VALUES (11818, 6, 101.50);
+INSERT INTO events VALUES (11821, 7, 101.75);
+INSERT INTO events VALUES (11824, 8, 102.00);
+INSERT INTO events VALUES (11827, 9, 102.25);
+INSERT INTO events VALUES (11830, 10, 102.50);
+INSERT INTO events VALUES (11833, 11, 102.75);
+INSERT INTO events VALUES (11836, 12, 103.00);
+INSERT INTO events VALUES (11839, 13, 103.25);
+INSERT INTO events VALUES (11842, 14, 103.50);
+INSERT INTO events VALUES (11845, 15, 103.75);
+INSERT INTO events VALUES (11848, 0, 104.00);
+INSERT INTO events VALUES (11851, 1, 104.25);
+INSERT INTO events VALUES (11854, 2, 104.50);
+INSERT INTO events VALUES (11857, 3, 104.75);
+INSERT INTO events VALUES (11860, 4, 105.00);
+INSERT INTO events VALUES (11863, 5, 105.25);
+INSERT INTO events VALUES (11866, 6, 105.50);
+INSERT INTO events VALUES (11869, 7, 105.75);
+INSERT INTO events VALUES (11872, 8, 106.00);
+INSERT INTO events VALUES (11875, 9, 106.25);
+INSERT INTO events VALUES (11878, 10, 106.50);
+INSERT INTO events VALUES (11881, 11, 106.75);
+INSERT INTO events VALUES (11884, 12, 107.00);
+INSERT INTO events VALUES (11887, 13, 107.25);
+INSERT INTO events VALUES (11890, 14, 107.50);
+INSERT INTO events VALUES (11893, 15, 107.75);
+INSERT INTO events VALUES (11896, 0, 108.00);
+INSERT INTO events VALUES (11899, 1, 108.25);
+INSERT INTO events VALUES (11902, 2, 108.50);
+INSERT INTO events VALUES (11905, 3, 108.75);
+INSERT INTO events VALUES (11908, 4, 109.00);
+INSERT INTO events VALUES (11911, 5, 109.25);
+INSERT INTO events VALUES (11914, 6, 109.50);
+INSERT INTO events VALUES (11917, 7, 109.75);
+INSERT INTO events VALUES (11920, 8, 110.00);
+INSERT INTO events VALUES (11923, 9, 110.25);
+INSERT INTO events VALUES (11926, 10, 110.50);
+INSERT INTO events VALUES (11929, 11, 110.75);
+INSERT INTO events VALUES (11932, 12, 111.00);
+INSERT INTO events VALUES (11935, 13, 111.25);
+INSERT INTO events VALUES (11938, 14, 111.50);
+INSERT INTO events VALUES (11941, 15, 111.75);
+INSERT INTO events VALUES (11944, 0, 112.00);
+INSERT INTO events VALUES (11947, 1, 112.25);
+INSERT INTO events VALUES (11950, 2, 112.50);
+INSERT INTO events VALUES (11953, 3, 112.75);
+INSERT INTO events VALUES (11956, 4, 113.00);
+INSERT INTO events VALUES (11959, 5, 113.25);
+INSERT INTO events VALUES (11962, 6, 113.50);
+INSERT INTO events VALUES (11965, 7, 113.75);
+INSERT INTO events VALUES (11968, 8, 114.00);
+INSERT INTO events VALUES (11971, 9, 114.25);
+INSERT INTO events VALUES (11974, 10, 114.50);
+INSERT INTO events VALUES (11977, 11, 114.75);
+INSERT INTO events VALUES (11980, 12, 115.00);
+INSERT INTO events VALUES (11983, 13, 115.25);
+INSERT INTO events VALUES (11986, 14, 115.50);
+INSERT INTO events VALUES (11989, 15, 115.75);
+INSERT INTO events VALUES (11992, 0, 116.00);
+INSERT INTO events VALUES (11995, 1, 116.25);
+INSERT INTO events VALUES (11998, 2, 116.50);
+INSERT INTO events VALUES (12001, 3, 116.75);
+INSERT INTO events VALUES (12004, 4, 117.00);
+INSERT INTO events VALUES (12007, 5, 117.25);
+INSERT INTO events VALUES (12010, 6, 117.50);
+INSERT INTO events VALUES (12013, 7, 117.75);
+INSERT INTO events VALUES (12016, 8, 118.00);
+INSERT INTO events VALUES (12019, 9, 118.25);
+INSERT INTO events VALUES (12022, 10, 118.50);
+INSERT INTO events VALUES (12025, 11, 118.75);
+INSERT INTO events VALUES (12028, 12, 119.00);
+INSERT INTO events VALUES (12031, 13, 119.25);
+INSERT INTO events VALUES (12034, 14, 119.50);
+INSERT INTO events VALUES (12037, 15, 119.75);
+INSERT INTO events VALUES (12040, 0, 120.00);
+INSERT INTO events VALUES (12043, 1, 120.25);
+INSERT INTO events VALUES (12046, 2, 120.50);
+INSERT INTO events VALUES (12049, 3, 120.75);
+INSERT INTO events VALUES (12052, 4, 121.00);
+INSERT INTO events VALUES (12055, 5, 121.25);
+INSERT INTO events VALUES (12058, 6, 121.50);
+INSERT INTO events VALUES (12061, 7, 121.75);
+INSERT INTO events VALUES (12064, 8, 122.00);
+INSERT INTO events VALUES (12067, 9, 122.25);
+INSERT INTO events VALUES (12070, 10, 122.50);
+INSERT INTO events VALUES (12073, 11, 122.75);
+INSERT INTO events VALUES (12076, 12, 123.00);
+INSERT INTO events VALUES (12079, 13, 123.25);
+INSERT INTO events VALUES (12082, 14, 123.50);
+INSERT INTO events VALUES (12085, 15, 123.75);
+INSERT INTO events VALUES (12088, 0, 124.00);
+INSERT INTO events VALUES (12091, 1, 124.25);
+INSERT INTO events VALUES (12094, 2, 124.50);
+INSERT INTO events VALUES (12097, 3, 124.75);
+INSERT INTO events VALUES (12100, 4, 100.00);
+INSERT INTO events VALUES (12103, 5, 100.25);
+INSERT INTO events VALUES (12106, 6, 100.50);
+INSERT INTO events VALUES (12109, 7, 100.75);
+INSERT INTO events VALUES (12112, 8, 101.00);
+INSERT INTO events VALUES (12115, 9, 101.25);
+INSERT INTO events VALUES (12118, 10, 101.50);
+INSERT INTO events VALUES (12121, 11, 101.75);
+INSERT INTO events VALUES (12124, 12, 102.00);
+INSERT INTO events VALUES (12127, 13, 102.25);
+INSERT INTO events VALUES (12130, 14, 102.50);
+INSERT INTO events VALUES (12133, 15, 102.75);
+INSERT INTO events VALUES (12136, 0, 103.00);
+INSERT INTO events VALUES (12139, 1, 103.25);
+INSERT INTO events VALUES (12142, 2, 103.50);
+INSERT INTO events VALUES (12145, 3, 103.75);
+INSERT INTO events VALUES (12148, 4, 104.00);
+INSERT INTO events VALUES (12151, 5, 104.25);
+INSERT INTO events VALUES (12154, 6, 104.50);
+INSERT INTO events VALUES (12157, 7, 104.75);
+INSERT INTO events VALUES (12160, 8, 105.00);
+INSERT INTO events VALUES (12163, 9, 105.25);
+INSERT INTO events VALUES (12166, 10, 105.50);
+INSERT INTO events VALUES (12169, 11, 105.75);
+INSERT INTO events VALUES (12172, 12, 106.00);
+INSERT INTO events VALUES (12175, 13, 106.25);
+INSERT INTO events VALUES (12178, 14, 106.50);
+INSERT INTO events VALUES (12181, 15, 106.75);
+INSERT INTO events VALUES (12184, 0, 107.00);
+INSERT INTO events VALUES (12187, 1, 107.25);
+INSERT INTO events VALUES (12190, 2, 107.50);
+INSERT INTO events VALUES (12193, 3, 107.75);
+INSERT INTO events VALUES (12196, 4, 108.00);
+INSERT INTO events VALUES (12199, 5, 108.25);
+INSERT INTO events VALUES (12202, 6, 108.50);
+INSERT INTO events VALUES (12205, 7, 108.75);
+INSERT INTO events VALUES (12208, 8, 109.00);
+INSERT INTO events VALUES (12211, 9, 109.25);
+INSERT INTO events VALUES (12214, 10, 109.50);
+INSERT INTO events VALUES (12217, 11, 109.75);
+INSERT INTO events VALUES (12220, 12, 110.00);
+INSERT INTO events VALUES (12223, 13, 110.25);
+INSERT INTO events VALUES (12226, 14, 110.50);
+INSERT INTO events VALUES (12229, 15, 110.75);
+INSERT INTO events VALUES (12232, 0, 111.00);
+INSERT INTO events VALUES (12235, 1, 111.25);
+INSERT INTO events VALUES (12238, 2, 111.50);
+INSERT INTO events VALUES (12241, 3, 111.75);
+INSERT INTO events VALUES (12244, 4, 112.00);
+INSERT INTO events VALUES (12247, 5, 112.25);
+INSERT INTO events VALUES (12250, 6, 112.50);
+INSERT INTO events VALUES (12253, 7, 112.75);
+INSERT INTO events VALUES (12256, 8, 113.00);
+INSERT INTO events VALUES (12259, 9, 113.25);
+INSERT INTO events VALUES (12262, 10, 113.50);
+INSERT INTO events VALUES (12265, 11, 113.75);
+INSERT INTO events VALUES (12268, 12, 114.00);
+INSERT INTO events VALUES (12271, 13, 114.25);
+INSERT INTO events VALUES (12274, 14, 114.50);
+INSERT INTO events VALUES (12277, 15, 114.75);
+INSERT INTO events VALUES (12280, 0, 115.00);
+INSERT INTO events VALUES (12283, 1, 115.25);
+INSERT INTO events VALUES (12286, 2, 115.50);
+INSERT INTO events VALUES (12289, 3, 115.75);
+INSERT INTO events VALUES (12292, 4, 116.00);
+INSERT INTO events VALUES (12295, 5, 116.25);
+INSERT INTO events VALUES (12298, 6, 116.50);
+INSERT INTO events VALUES (12301, 7, 116.75);
+INSERT INTO events VALUES (12304, 8, 117.00);
+INSERT INTO events VALUES (12307, 9, 117.25);
+INSERT INTO events VALUES (12310, 10, 117.50);
+INSERT INTO events VALUES (12313, 11, 117.75);
+INSERT INTO events VALUES (12316, 12, 118.00);
+INSERT INTO events VALUES (12319, 13, 118.25);
+INSERT INTO events VALUES (12322, 14, 118.50);
+INSERT INTO events VALUES (12325, 15, 118.75);
+INSERT INTO events VALUES (12328, 0, 119.00);
+INSERT INTO events VALUES (12331, 1, 119.25);
+INSERT INTO events VALUES (12334, 2, 119.50);
+INSERT INTO events VALUES (12337, 3, 119.75);
+INSERT INTO events VALUES (12340, 4, 120.00);
+INSERT INTO events VALUES (12343, 5, 120.25);
+INSERT INTO events VALUES (12346, 6, 120.50);
+INSERT INTO events VALUES (12349, 7, 120.75);
+INSERT INTO events VALUES (12352, 8, 121.00);
+INSERT INTO events VALUES (12355, 9, 121.25);
+INSERT INTO events VALUES (12358, 10, 121.50);
+INSERT INTO events VALUES (12361, 11, 121.75);
+INSERT INTO events VALUES (12364, 12, 122.00);
+INSERT INTO events VALUES (12367, 13, 122.25);
+INSERT INTO events VALUES (12370, 14, 122.50);
+INSERT INTO events VALUES (12373, 15, 122.75);
+INSERT INTO events VALUES (12376, 0, 123.00);
+INSERT INTO events VALUES (12379, 1, 123.25);
+INSERT INTO events VALUES (12382, 2, 123.50);
+INSERT INTO events VALUES (12385, 3, 123.75);
+INSERT INTO events VALUES (12388, 4, 124.00);
+INSERT INTO events VALUES (12391, 5, 124.25);
+INSERT INTO events VALUES (12394, 6, 124.50);
+INSERT INTO events VALUES (12397, 7, 124.75);
+INSERT INTO events VALUES (12400, 8, 100.00);
+INSERT INTO events VALUES (12403, 9, 100.25);
+INSERT INTO events VALUES (12406, 10, 100.50);
+INSERT INTO events VALUES (12409, 11, 100.75);
+INSERT INTO events VALUES (12412, 12, 101.00);
+INSERT INTO events VALUES (12415, 13, 101.25);
+INSERT INTO events VALUES (12418, 14, 101.50);
+INSERT INTO events VALUES (12421, 15, 101.75);
+INSERT INTO events VALUES (12424, 0, 102.00);
+INSERT INTO events VALUES (12427, 1, 102.25);
+INSERT INTO events VALUES (12430, 2, 102.50);
+INSERT INTO events VALUES (12433, 3, 102.75);
+INSERT INTO events VALUES (12436, 4, 103.00);
+INSERT INTO events VALUES (12439, 5, 103.25);
+INSERT INTO events VALUES (12442, 6, 103.50);
+INSERT INTO events VALUES (12445, 7, 103.75);
+INSERT INTO events VALUES (12448, 8, 104.00);
+INSERT INTO events VALUES (12451, 9, 104.25);
+INSERT INTO events VALUES (12454, 10, 104.50);
+INSERT INTO events VALUES (12457, 11, 104.75);
+INSERT INTO events VALUES (12460, 12, 105.00);
+INSERT INTO events VALUES (12463, 13, 105.25);
+INSERT INTO events VALUES (12466, 14, 105.50);
+INSERT INTO events VALUES (12469, 15, 105.75);
+INSERT INTO events VALUES (12472, 0, 106.00);
+INSERT INTO events VALUES (12475, 1, 106.25);
+INSERT INTO events VALUES (12478, 2, 106.50);
+INSERT INTO events VALUES (12481, 3, 106.75);
+INSERT INTO events VALUES (12484, 4, 107.00);
+INSERT INTO events VALUES (12487, 5, 107.25);
+INSERT INTO events VALUES (12490, 6, 107.50);
+INSERT INTO events VALUES (12493, 7, 107.75);
+INSERT INTO events VALUES (12496, 8, 108.00);
+INSERT INTO events VALUES (12499, 9, 108.25);
+INSERT INTO events VALUES (12502, 10, 108.50);
+INSERT INTO events VALUES (12505, 11, 108.75);
+INSERT INTO events VALUES (12508, 12, 109.00);
+INSERT INTO events VALUES (12511, 13, 109.25);
+INSERT INTO events VALUES (12514, 14, 109.50);
+INSERT INTO events VALUES (12517, 15, 109.75);
+INSERT INTO events VALUES (12520, 0, 110.00);
+INSERT INTO events VALUES (12523, 1, 110.25);
+INSERT INTO events VALUES (12526, 2, 110.50);
+INSERT INTO events VALUES (12529, 3, 110.75);
+INSERT INTO events VALUES (12532, 4, 111.00);
+INSERT INTO events VALUES (12535, 5, 111.25);
+INSERT INTO events VALUES (12538, 6, 111.50);
+INSERT INTO events VALUES (12541, 7, 111.75);
+INSERT INTO events VALUES (12544, 8, 112.00);
+INSERT INTO events VALUES (12547, 9, 112.25);
+INSERT INTO events VALUES (12550, 10, 112.50);
+INSERT INTO events VALUES (12553, 11, 112.75);
+INSERT INTO events VALUES (12556, 12, 113.00);
+INSERT INTO events VALUES (12559, 13, 113.25);
+INSERT INTO events VALUES (12562, 14, 113.50);
+INSERT INTO events VALUES (12565, 15, 113.75);
+INSERT INTO events VALUES (12568, 0, 114.00);
+INSERT INTO events VALUES (12571, 1, 114.25);
+INSERT INTO events VALUES (12574, 2, 114.50);
+INSERT INTO events VALUES (12577, 3, 114.75);
+INSERT INTO events VALUES (12580, 4, 115.00);
+INSERT INTO events VALUES (12583, 5, 115.25);
+INSERT INTO events VALUES (12586, 6, 115.50);
+INSERT INTO events VALUES (12589, 7, 115.75);
+INSERT INTO events VALUES (12592, 8, 116.00);
+INSERT INTO events VALUES (12595, 9, 116.25);
+INSERT INTO events VALUES (12598, 10, 116.50);
+INSERT INTO events VALUES (12601, 11, 116.75);
+INSERT INTO events VALUES (12604, 12, 117.00);
+INSERT INTO events VALUES (12607, 13, 117.25);
+INSERT INTO events VALUES (12610, 14, 117.50);
+INSERT INTO events VALUES (12613, 15, 117.75);
+INSERT INTO events VALUES (12616, 0, 118.00);
+INSERT INTO events VALUES (12619, 1, 118.25);
+INSERT INTO events VALUES (12622, 2, 118.50);
+INSERT INTO events VALUES (12625, 3, 118.75);
+INSERT INTO events VALUES (12628, 4, 119.00);
+INSERT INTO events VALUES (12631, 5, 119.25);
+INSERT INTO events VALUES (12634, 6, 119.50);
+INSERT INTO events VALUES (12637, 7, 119.75);
+INSERT INTO events VALUES (12640, 8, 120.00);
+INSERT INTO events VALUES (12643, 9, 120.25);
+INSERT INTO events VALUES (12646, 10, 120.50);
+INSERT INTO events VALUES (12649, 11, 120.75);
+INSERT INTO events VALUES (12652, 12, 121.00);
+INSERT INTO events VALUES (12655, 13, 121.25);
+INSERT INTO events VALUES (12658, 14, 121.50);
+INSERT INTO events VALUES (12661, 15, 121.75);
+INSERT INTO events VALUES (12664, 0, 122.00);
+INSERT INTO events VALUES (12667, 1, 122.25);
+INSERT INTO events VALUES (12670, 2, 122.50);
+INSERT INTO events VALUES (12673, 3, 122.75);
+INSERT INTO events VALUES (12676, 4, 123.00);
+INSERT INTO events VALUES (12679, 5, 123.25);
+INSERT INTO events VALUES (12682, 6, 123.50);
+INSERT INTO events VALUES (12685, 7, 123.75);
+INSERT INTO events VALUES (12688, 8, 124.00);
+INSERT INTO events VALUES (12691, 9, 124.25);
+INSERT INTO events VALUES (12694, 10, 124.50);
+INSERT INTO events VALUES (12697, 11, 124.75);
+INSERT INTO events VALUES (12700, 12, 100.00);
+INSERT INTO events VALUES (12703, 13, 100.25);
+INSERT INTO events VALUES (12706, 14, 100.50);
+INSERT INTO events VALUES (12709, 15, 100.75);
+INSERT INTO events VALUES (12712, 0, 101.00);
+INSERT INTO events VALUES (12715, 1, 101.25);
+INSERT INTO events VALUES (12718, 2, 101.50);
+INSERT INTO events VALUES (12721, 3, 101.75);
+INSERT INTO events VALUES (12724, 4, 102.00);
+INSERT INTO events VALUES (12727, 5, 102.25);
+INSERT INTO events VALUES (12730, 6, 102.50);
+INSERT INTO events VALUES (12733, 7, 102.75);
+INSERT INTO events VALUES (12736, 8, 103.00);
+INSERT INTO events VALUES (12739, 9, 103.25);
+INSERT INTO events VALUES (12742, 10, 103.50);
+INSERT INTO events VALUES (12745, 11, 103.75);
+INSERT INTO events VALUES (12748, 12, 104.00);
+INSERT INTO events VALUES (12751, 13, 104.25);
+INSERT INTO events VALUES (12754, 14, 104.50);
+INSERT INTO events VALUES (12757, 15, 104.75);
+INSERT INTO events VALUES (12760, 0, 105.00);
+INSERT INTO events VALUES (12763, 1, 105.25);
+INSERT INTO events VALUES (12766, 2, 105.50);
+INSERT INTO events VALUES (12769, 3, 105.75);
+INSERT INTO events VALUES (12772, 4, 106.00);
+INSERT INTO events VALUES (12775, 5, 106.25);
+INSERT INTO events VALUES (12778, 6, 106.50);
+INSERT INTO events VALUES (12781, 7, 106.75);
+INSERT INTO events VALUES (12784, 8, 107.00);
+INSERT INTO events VALUES (12787, 9, 107.25);
+INSERT INTO events VALUES (12790, 10, 107.50);
+INSERT INTO events VALUES (12793, 11, 107.75);
+INSERT INTO events VALUES (12796, 12, 108.00);
+INSERT INTO events VALUES (12799, 13, 108.25);
+INSERT INTO events VALUES (12802, 14, 108.50);
+INSERT INTO events VALUES (12805, 15, 108.75);
+INSERT INTO events VALUES (12808, 0, 109.00);
+INSERT INTO events VALUES (12811, 1, 109.25);
+INSERT INTO events VALUES (12814, 2, 109.50);
+INSERT INTO events VALUES (12817, 3, 109.75);
+INSERT INTO events VALUES (12820, 4, 110.00);
+INSERT INTO events VALUES (12823, 5, 110.25);
+INSERT INTO events VALUES (12826, 6, 110.50);
+INSERT INTO events VALUES (12829, 7, 110.75);
+INSERT INTO events VALUES (12832, 8, 111.00);
+INSERT INTO events VALUES (12835, 9, 111.25);
+INSERT INTO events VALUES (12838, 10, 111.50);
+INSERT INTO events VALUES (12841, 11, 111.75);
+INSERT INTO events VALUES (12844, 12, 112.00);
+INSERT INTO events VALUES (12847, 13, 112.25);
+INSERT INTO events VALUES (12850, 14, 112.50);
+INSERT INTO events VALUES (12853, 15, 112.75);
+INSERT INTO events VALUES (12856, 0, 113.00);
+INSERT INTO events VALUES (12859, 1, 113.25);
+INSERT INTO events VALUES (12862, 2, 113.50);
+INSERT INTO events VALUES (12865, 3, 113.75);
+INSERT INTO events VALUES (12868, 4, 114.00);
+INSERT INTO events VALUES (12871, 5, 114.25);
+INSERT INTO events VALUES (12874, 6, 114.50);
+INSERT INTO events VALUES (12877, 7, 114.75);
+INSERT INTO events VALUES (12880, 8, 115.00);
+INSERT INTO events VALUES (12883, 9, 115.25);
+INSERT INTO events VALUES (12886, 10, 115.50);
+INSERT INTO events VALUES (12889, 11, 115.75);
+INSERT INTO events VALUES (12892, 12, 116.00);
+INSERT INTO events VALUES (12895, 13, 116.25);
+INSERT INTO events VALUES (12898, 14, 116.50);
+INSERT INTO events VALUES (12901, 15, 116.75);
+INSERT INTO events VALUES (12904, 0, 117.00);
+INSERT INTO events VALUES (12907, 1, 117.25);
+INSERT INTO events VALUES (12910, 2, 117.50);
+INSERT INTO events VALUES (12913, 3, 117.75);
+INSERT INTO events VALUES (12916, 4, 118.00);
+INSERT INTO events VALUES (12919, 5, 118.25);
+INSERT INTO events VALUES (12922, 6, 118.50);
+INSERT INTO events VALUES (12925, 7, 118.75);
+INSERT INTO events VALUES (12928, 8, 119.00);
+INSERT INTO events VALUES (12931, 9, 119.25);
+INSERT INTO events VALUES (12934, 10, 119.50);
+INSERT INTO events VALUES (12937, 11, 119.75);
+INSERT INTO events VALUES (12940, 12, 120.00);
+INSERT INTO events VALUES (12943, 13, 120.25);
+INSERT INTO events VALUES (12946, 14, 120.50);
+INSERT INTO events VALUES (12949, 15, 120.75);
+INSERT INTO events VALUES (12952, 0, 121.00);
+INSERT INTO events VALUES (12955, 1, 121.25);
+INSERT INTO events VALUES (12958, 2, 121.50);
+INSERT INTO events VALUES (12961, 3, 121.75);
+INSERT INTO events VALUES (12964, 4, 122.00);
+INSERT INTO events VALUES (12967, 5, 122.25);
+INSERT INTO events VALUES (12970, 6, 122.50);
+INSERT INTO events VALUES (12973, 7, 122.75);
+INSERT INTO events VALUES (12976, 8, 123.00);
+INSERT INTO events VALUES (12979, 9, 123.25);
+INSERT INTO events VALUES (12982, 10, 123.50);
+INSERT INTO events VALUES (12985, 11, 123.75);
+INSERT INTO events VALUES (12988, 12, 124.00);
+INSERT INTO events VALUES (12991, 13, 124.25);
+INSERT INTO events VALUES (12994, 14, 124.50);
+INSERT INTO events VALUES (12997, 15, 124.75);
+INSERT INTO events VALUES (13000, 0, 100.00);
+INSERT INTO events VALUES (13003, 1, 100.25);
+INSERT INTO events VALUES (13006, 2, 100.50);
+INSERT INTO events VALUES (13009, 3, 100.75);
+INSERT INTO events VALUES (13012, 4, 101.00);
+INSERT INTO events VALUES (13015, 5, 101.25);
+INSERT INTO events VALUES (13018, 6, 101.50);
+INSERT INTO events VALUES (13021, 7, 101.75);
+INSERT INTO events VALUES (13024, 8, 102.00);
+INSERT INTO events VALUES (13027, 9, 102.25);
+INSERT INTO events VALUES (13030, 10, 102.50);
+INSERT INTO events VALUES (13033, 11, 102.75);
+INSERT INTO events VALUES (13036, 12, 103.00);
+INSERT INTO events VALUES (13039, 13, 103.25);
+INSERT INTO events VALUES (13042, 14, 103.50);
+INSERT INTO events VALUES (13045, 15, 103.75);
+INSERT INTO events VALUES (13048, 0, 104.00);
+INSERT INTO events VALUES (13051, 1, 104.25);
+INSERT INTO events VALUES (13054, 2, 104.50);
+INSERT INTO events VALUES (13057, 3, 104.75);
+INSERT INTO events VALUES (13060, 4, 105.00);
+INSERT INTO events VALUES (13063, 5, 105.25);
+INSERT INTO events VALUES (13066, 6, 105.50);
+INSERT INTO events VALUES (13069, 7, 105.75);
+INSERT INTO events VALUES (13072, 8, 106.00);
+INSERT INTO events VALUES (13075, 9, 106.25);
+INSERT INTO events VALUES (13078, 10, 106.50);
+INSERT INTO events VALUES (13081, 11, 106.75);
+INSERT INTO events VALUES (13084, 12, 107.00);
+INSERT INTO events VALUES (13087, 13, 107.25);
+INSERT INTO events VALUES (13090, 14, 107.50);
+INSERT INTO events VALUES (13093, 15, 107.75);
+INSERT INTO events VALUES (13096, 0, 108.00);
+INSERT INTO events VALUES (13099, 1, 108.25);
+INSERT INTO events VALUES (13102, 2, 108.50);
+INSERT INTO events VALUES (13105, 3, 108.75);
+INSERT INTO events VALUES (13108, 4, 109.00);
+INSERT INTO events VALUES (13111, 5, 109.25);
+INSERT INTO events VALUES (13114, 6, 109.50);
+INSERT INTO events VALUES (13117, 7, 109.75);
+INSERT INTO events VALUES (13120, 8, 110.00);
+INSERT INTO events VALUES (13123, 9, 110.25);
+INSERT INTO events VALUES (13126, 10, 110.50);
+INSERT INTO events VALUES (13129, 11, 110.75);
+INSERT INTO events VALUES (13132, 12, 111.00);
+INSERT INTO events VALUES (13135, 13, 111.25);
+INSERT INTO events VALUES (13138, 14, 111.50);
+INSERT INTO events VALUES (13141, 15, 111.75);
+INSERT INTO events VALUES (13144, 0, 112.00);
+INSERT INTO events VALUES (13147, 1, 112.25);
+INSERT INTO events VALUES (13150, 2, 112.50);
+INSERT INTO events VALUES (13153, 3, 112.75);
+INSERT INTO events VALUES (13156, 4, 113.00);
+INSERT INTO events VALUES (13159, 5, 113.25);
+INSERT INTO events VALUES (13162, 6, 113.50);
+INSERT INTO events VALUES (13165, 7, 113.75);
+INSERT INTO events VALUES (13168, 8, 114.00);
+INSERT INTO events VALUES (13171, 9, 114.25);
+INSERT INTO events VALUES (13174, 10, 114.50);
+INSERT INTO events VALUES (13177, 11, 114.75);
+INSERT INTO events VALUES (13180, 12, 115.00);
+INSERT INTO events VALUES (13183, 13, 115.25);
+INSERT INTO events VALUES (13186, 14, 115.50);
+INSERT INTO events VALUES (13189, 15, 115.75);
+INSERT INTO events VALUES (13192, 0, 116.00);
+INSERT INTO events VALUES (13195, 1, 116.25);
+INSERT INTO events VALUES (13198, 2, 116.50);
+INSERT INTO events VALUES (13201, 3, 116.75);
+INSERT INTO events VALUES (13204, 4, 117.00);
+INSERT INTO events VALUES (13207, 5, 117.25);
+INSERT INTO events VALUES (13210, 6, 117.50);
+INSERT INTO events VALUES (13213, 7, 117.75);
+INSERT INTO events VALUES (13216, 8, 118.00);
+INSERT INTO events VALUES (13219, 9, 118.25);
+INSERT INTO events VALUES (13222, 10, 118.50);
+INSERT INTO events VALUES (13225, 11, 118.75);
+INSERT INTO events VALUES (13228, 12, 119.00);
+INSERT INTO events VALUES (13231, 13, 119.25);
+INSERT INTO events VALUES (13234, 14, 119.50);
+INSERT INTO events VALUES (13237, 15, 119.75);
+INSERT INTO events VALUES (13240, 0, 120.00);
+INSERT INTO events VALUES (13243, 1, 120.25);
+INSERT INTO events VALUES (13246, 2, 120.50);
+INSERT INTO events VALUES (13249, 3, 120.75);
+INSERT INTO events VALUES (13252, 4, 121.00);
+INSERT INTO events VALUES (13255, 5, 121.25);
+INSERT INTO events VALUES (13258, 6, 121.50);
+INSERT INTO events VALUES (13261, 7, 121.75);
+INSERT INTO events VALUES (13264, 8, 122.00);
+INSERT INTO events VALUES (13267, 9, 122.25);
+INSERT INTO events VALUES (13270, 10, 122.50);
+INSERT INTO events VALUES (13273, 11, 122.75);
+INSERT INTO events VALUES (13276, 12, 123.00);
+INSERT INTO events VALUES (13279, 13, 123.25);
+INSERT INTO events VALUES (13282, 14, 123.50);
+INSERT INTO events VALUES (13285, 15, 123.75);
+INSERT INTO events VALUES (13288, 0, 224.00);
+INSERT INTO events VALUES (13291, 1, 224.25);
+INSERT INTO events VALUES (13294, 2, 224.50);
+INSERT INTO events VALUES (13297, 3, 224.75);
+INSERT INTO events VALUES (13300, 4, 200.00);
+INSERT INTO events VALUES (13303, 5, 200.25);
+INSERT INTO events VALUES (13306, 6, 200.50);
+INSERT INTO events VALUES (13309, 7, 200.75);
+INSERT INTO events VALUES (13312, 8, 201.00);
+INSERT INTO events VALUES (13315, 9, 201.25);
+INSERT INTO events VALUES (13318, 10, 201.50);
+INSERT INTO events VALUES (13321, 11, 201.75);
+INSERT INTO events VALUES (13324, 12, 202.00);
+INSERT INTO events VALUES (13327, 13, 202.25);
+INSERT INTO events VALUES (13330, 14, 202.50);
+INSERT INTO events VALUES (13333, 15, 202.75);
+INSERT INTO events VALUES (13336, 0, 203.00);
+INSERT INTO events VALUES (13339, 1, 203.25);
+INSERT INTO events VALUES (13342, 2, 203.50);
+INSERT INTO events VALUES (13345, 3, 203.75);
+INSERT INTO events VALUES (13348, 4, 204.00);
+INSERT INTO events VALUES (13351, 5, 204.25);
+INSERT INTO events VALUES (13354, 6, 204.50);
+INSERT INTO events VALUES (13357, 7, 204.75);
+INSERT INTO events VALUES (13360, 8, 205.00);
+INSERT INTO events VALUES (13363, 9, 205.25);
+INSERT INTO events VALUES (13366, 10, 205.50);
+INSERT INTO events VALUES (13369, 11, 205.75);
+INSERT INTO events VALUES (13372, 12, 206.00);
+INSERT INTO events VALUES (13375, 13, 206.25);
+INSERT INTO events VALUES (13378, 14, 206.50);
+INSERT INTO events VALUES (13381, 15, 206.75);
+INSERT INTO events VALUES (13384, 0, 207.00);
+INSERT INTO events VALUES (13387, 1, 207.25);
+INSERT INTO events VALUES (13390, 2, 207.50);
+INSERT INTO events VALUES (13393, 3, 207.75);
+INSERT INTO events VALUES (13396, 4, 208.00);
+INSERT INTO events VALUES (13399, 5, 208.25);
+INSERT INTO events VALUES (13402, 6, 208.50);
+INSERT INTO events VALUES (13405, 7, 208.75);
+INSERT INTO events VALUES (13408, 8, 209.00);
+INSERT INTO events VALUES (13411, 9, 209.25);
+INSERT INTO events VALUES (13414, 10, 209.50);
+INSERT INTO events VALUES (13417, 11, 209.75);
+INSERT INTO events VALUES (13420, 12, 210.00);
+INSERT INTO events VALUES (13423, 13, 210.25);
+INSERT INTO events VALUES (13426, 14, 210.50);
+INSERT INTO events VALUES (13429, 15, 210.75);
+INSERT INTO events VALUES (13432, 0, 211.00);
+INSERT INTO events VALUES (13435, 1, 211.25);
+INSERT INTO events VALUES (13438, 2, 211.50);
+INSERT INTO events VALUES (13441, 3, 211.75);
+INSERT INTO events VALUES (13444, 4, 212.00);
+INSERT INTO events VALUES (13447, 5, 212.25);
+INSERT INTO events VALUES (13450, 6, 212.50);
+INSERT INTO events VALUES (13453, 7, 212.75);
+INSERT INTO events VALUES (13456, 8, 213.00);
+INSERT INTO events VALUES (13459, 9, 213.25);
+INSERT INTO events VALUES (13462, 10, 213.50);
+INSERT INTO events VALUES (13465, 11, 213.75);
+INSERT INTO events VALUES (13468, 12, 214.00);
+INSERT INTO events VALUES (13471, 13, 214.25);
+INSERT INTO events VALUES (13474, 14, 214.50);
+INSERT INTO events VALUES (13477, 15, 214.75);
+INSERT INTO events VALUES (13480, 0, 215.00);
+INSERT INTO events VALUES (13483, 1, 215.25);
+INSERT INTO events VALUES (13486, 2, 215.50);
+INSERT INTO events VALUES (13489, 3, 215.75);
+INSERT INTO events VALUES (13492, 4, 216.00);
+INSERT INTO events VALUES (13495, 5, 216.25);
+INSERT INTO events VALUES (13498, 6, 216.50);
+INSERT INTO events VALUES (13501, 7, 216.75);
+INSERT INTO events VALUES (13504, 8, 217.00);
+INSERT INTO events VALUES (13507, 9, 217.25);
+INSERT INTO events VALUES (13510, 10, 217.50);
+INSERT INTO events VALUES (13513, 11, 217.75);
+INSERT INTO events VALUES (13516, 12, 218.00);
+INSERT INTO events VALUES (13519, 13, 218.25);
+INSERT INTO events VALUES (13522, 14, 218.50);
+INSERT INTO events VALUES (13525, 15, 218.75);
+INSERT INTO events VALUES (13528, 0, 219.00);
+INSERT INTO events VALUES (13531, 1, 219.25);
+INSERT INTO events VALUES (13534, 2, 219.50);
+INSERT INTO events VALUES (13537, 3, 219.75);
+INSERT INTO events VALUES (13540, 4, 220.00);
+INSERT INTO events VALUES (13543, 5, 220.25);
+INSERT INTO events VALUES (13546, 6, 220.50);
+INSERT INTO events VALUES (13549, 7, 220.75);
+INSERT INTO events VALUES (13552, 8, 221.00);
+INSERT INTO events VALUES (13555, 9, 221.25);
+INSERT INTO events VALUES (13558, 10, 221.50);
+INSERT INTO events VALUES (13561, 11, 221.75);
+INSERT INTO events VALUES (13564, 12, 222.00);
+INSERT INTO events VALUES (13567, 13, 222.25);
+INSERT INTO events VALUES (13570, 14, 222.50);
+INSERT INTO events VALUES (13573, 15, 222.75);
+INSERT INTO events VALUES (13576, 0, 223.00);
+INSERT INTO events VALUES (13579, 1, 223.25);
+INSERT INTO events VALUES (13582, 2, 223.50);
+INSERT INTO events VALUES (13585, 3, 223.75);
+INSERT INTO events VALUES (13588, 4, 224.00);
+INSERT INTO events VALUES (13591, 5, 224.25);
+INSERT INTO events VALUES (13594, 6, 224.50);
+INSERT INTO events VALUES (13597, 7, 224.75);
+INSERT INTO events VALUES (13600, 8, 200.00);
+INSERT INTO events VALUES (13603, 9, 200.25);
+INSERT INTO events VALUES (13606, 10, 200.50);
+INSERT INTO events VALUES (13609, 11, 200.75);
+INSERT INTO events VALUES (13612, 12, 201.00);
+INSERT INTO events VALUES (13615, 13, 201.25);
+INSERT INTO events VALUES (13618, 14, 201.50);
+INSERT INTO events VALUES (13621, 15, 201.75);
+INSERT INTO events VALUES (13624, 0, 202.00);
+INSERT INTO events VALUES (13627, 1, 202.25);
+INSERT INTO events VALUES (13630, 2, 202.50);
+INSERT INTO events VALUES (13633, 3, 202.75);
+INSERT INTO events VALUES (13636, 4, 203.00);
+INSERT INTO events VALUES (13639, 5, 203.25);
+INSERT INTO events VALUES (13642, 6, 203.50);
+INSERT INTO events VALUES (13645, 7, 203.75);
+INSERT INTO events VALUES (13648, 8, 204.00);
+INSERT INTO events VALUES (13651, 9, 204.25);
+INSERT INTO events VALUES (13654, 10, 204.50);
+INSERT INTO events VALUES (13657, 11, 204.75);
+INSERT INTO events VALUES (13660, 12, 205.00);
+INSERT INTO events VALUES (13663, 13, 205.25);
+INSERT INTO events VALUES (13666, 14, 205.50);
+INSERT INTO events VALUES (13669, 15, 205.75);
+INSERT INTO events VALUES (13672, 0, 206.00);
+INSERT INTO events VALUES (13675, 1, 206.25);
+INSERT INTO events VALUES (13678, 2, 206.50);
+INSERT INTO events VALUES (13681, 3, 206.75);
+INSERT INTO events VALUES (13684, 4, 207.00);
+INSERT INTO events VALUES (13687, 5, 207.25);
+INSERT INTO events VALUES (13690, 6, 207.50);
+INSERT INTO events VALUES (13693, 7, 207.75);
+INSERT INTO events VALUES (13696, 8, 208.00);
+INSERT INTO events VALUES (13699, 9, 208.25);
+INSERT INTO events VALUES (13702, 10, 208.50);
+INSERT INTO events VALUES (13705, 11, 208.75);
+INSERT INTO events VALUES (13708, 12, 209.00);
+INSERT INTO events VALUES (13711, 13, 209.25);
+INSERT INTO events VALUES (13714, 14, 209.50);
+INSERT INTO events VALUES (13717, 15, 209.75);
+INSERT INTO events VALUES (13720, 0, 210.00);
+INSERT INTO events VALUES (13723, 1, 210.25);
+INSERT INTO events VALUES (13726, 2, 210.50);
+INSERT INTO events VALUES (13729, 3, 210.75);
+INSERT INTO events VALUES (13732, 4, 211.00);
+INSERT INTO events VALUES (13735, 5, 211.25);
+INSERT INTO events VALUES (13738, 6, 211.50);
+INSERT INTO events VALUES (13741, 7, 211.75);
+INSERT INTO events VALUES (13744, 8, 212.00);
+INSERT INTO events VALUES (13747, 9, 212.25);
+INSERT INTO events VALUES (13750, 10, 212.50);
+INSERT INTO events VALUES (13753, 11, 212.75);
+INSERT INTO events VALUES (13756, 12, 213.00);
+INSERT INTO events VALUES (13759, 13, 213.25);
+INSERT INTO events VALUES (13762, 14, 213.50);
+INSERT INTO events VALUES (13765, 15, 213.75);
+INSERT INTO events VALUES (13768, 0, 214.00);
+INSERT INTO events VALUES (13771, 1, 214.25);
+INSERT INTO events VALUES (13774, 2, 214.50);
+INSERT INTO events VALUES (13777, 3, 214.75);
+INSERT INTO events VALUES (13780, 4, 215.00);
+INSERT INTO events VALUES (13783, 5, 215.25);
+INSERT INTO events VALUES (13786, 6, 215.50);
+INSERT INTO events VALUES (13789, 7, 215.75);
+INSERT INTO events VALUES (13792, 8, 216.00);
+INSERT INTO events VALUES (13795, 9, 216.25);
+INSERT INTO events VALUES (13798, 10, 216.50);
+INSERT INTO events VALUES (13801, 11, 216.75);
+INSERT INTO events VALUES (13804, 12, 217.00);
+INSERT INTO events VALUES (13807, 13, 217.25);
+INSERT INTO events VALUES (13810, 14, 217.50);
+INSERT INTO events VALUES (13813, 15, 217.75);
+INSERT INTO events VALUES (13816, 0, 218.00);
+INSERT INTO events VALUES (13819, 1, 218.25);
+INSERT INTO events VALUES (13822, 2, 218.50);
+INSERT INTO events VALUES (13825, 3, 218.75);
+INSERT INTO events VALUES (13828, 4, 219.00);
+INSERT INTO events VALUES (13831, 5, 219.25);
+INSERT INTO events VALUES (13834, 6, 219.50);
+INSERT INTO events VALUES (13837, 7, 219.75);
+INSERT INTO events VALUES (13840, 8, 220.00);
+INSERT INTO events VALUES (13843, 9, 220.25);
+INSERT INTO events VALUES (13846, 10, 220.50);
+INSERT INTO events VALUES (13849, 11, 220.75);
+INSERT INTO events VALUES (13852, 12, 221.00);
+INSERT INTO events VALUES (13855, 13, 221.25);
+INSERT INTO events VALUES (13858, 14, 221.50);
+INSERT INTO events VALUES (13861, 15, 221.75);
+INSERT INTO events VALUES (13864, 0, 222.00);
+INSERT INTO events VALUES (13867, 1, 222.25);
+INSERT INTO events VALUES (13870, 2, 222.50);
+INSERT INTO events VALUES (13873, 3, 222.75);
+INSERT INTO events VALUES (13876, 4, 223.00);
+INSERT INTO events VALUES (13879, 5, 223.25);
+INSERT INTO events VALUES (13882, 6, 223.50);
+INSERT INTO events VALUES (13885, 7, 223.75);
+INSERT INTO events VALUES (13888, 8, 224.00);
+INSERT INTO events VALUES (13891, 9, 224.25);
+INSERT INTO events VALUES (13894, 10, 224.50);
+INSERT INTO events VALUES (13897, 11, 224.75);
+INSERT INTO events VALUES (13900, 12, 200.00);
+INSERT INTO events VALUES (13903, 13, 200.25);
+INSERT INTO events VALUES (13906, 14, 200.50);
+INSERT INTO events VALUES (13909, 15, 200.75);
+INSERT INTO events VALUES (13912, 0, 201.00);
+INSERT INTO events VALUES (13915, 1, 201.25);
+INSERT INTO events VALUES (13918, 2, 201.50);
+INSERT INTO events VALUES (13921, 3, 201.75);
+INSERT INTO events VALUES (13924, 4, 202.00);
+INSERT INTO events VALUES (13927, 5, 202.25);
+INSERT INTO events VALUES (13930, 6, 202.50);
+INSERT INTO events VALUES (13933, 7, 202.75);
+INSERT INTO events VALUES (13936, 8, 203.00);
+INSERT INTO events VALUES (13939, 9, 203.25);
+INSERT INTO events VALUES (13942, 10, 203.50);
+INSERT INTO events VALUES (13945, 11, 203.75);
+INSERT INTO events VALUES (13948, 12, 204.00);
+INSERT INTO events VALUES (13951, 13, 204.25);
+INSERT INTO events VALUES (13954, 14, 204.50);
+INSERT INTO events VALUES (13957, 15, 204.75);
+INSERT INTO events VALUES (13960, 0, 205.00);
+INSERT INTO events VALUES (13963, 1, 205.25);
+INSERT INTO events VALUES (13966, 2, 205.50);
+INSERT INTO events VALUES (13969, 3, 205.75);
+INSERT INTO events VALUES (13972, 4, 206.00);
+INSERT INTO events VALUES (13975, 5, 206.25);
+INSERT INTO events VALUES (13978, 6, 206.50);
+INSERT INTO events VALUES (13981, 7, 206.75);
+INSERT INTO events VALUES (13984, 8, 207.00);
+INSERT INTO events VALUES (13987, 9, 207.25);
+INSERT INTO events VALUES (13990, 10, 207.50);
+INSERT INTO events VALUES (13993, 11, 207.75);
+INSERT INTO events VALUES (13996, 12, 208.00);
+INSERT INTO events VALUES (13999, 13, 208.25);
+INSERT INTO events VALUES (14002, 14, 208.50);
+INSERT INTO events VALUES (14005, 15, 208.75);
+INSERT INTO events VALUES (14008, 0, 209.00);
+INSERT INTO events VALUES (14011, 1, 209.25);
+INSERT INTO events VALUES (14014, 2, 209.50);
+INSERT INTO events VALUES (14017, 3, 209.75);
+INSERT INTO events VALUES (14020, 4, 210.00);
+INSERT INTO events VALUES (14023, 5, 210.25);
+INSERT INTO events VALUES (14026, 6, 210.50);
+INSERT INTO events VALUES (14029, 7, 210.75);
+INSERT INTO events VALUES (14032, 8, 211.00);
+INSERT INTO events VALUES (14035, 9, 211.25);
+INSERT INTO events VALUES (14038, 10, 211.50);
+INSERT INTO events VALUES (14041, 11, 211.75);
+INSERT INTO events VALUES (14044, 12, 212.00);
+INSERT INTO events VALUES (14047, 13, 212.25);
+INSERT INTO events VALUES (14050, 14, 212.50);
+INSERT INTO events VALUES (14053, 15, 212.75);
+INSERT INTO events VALUES (14056, 0, 213.00);
+INSERT INTO events VALUES (14059, 1, 213.25);
+INSERT INTO events VALUES (14062, 2, 213.50);
+INSERT INTO events VALUES (14065, 3, 213.75);
+INSERT INTO events VALUES (14068, 4, 214.00);
+INSERT INTO events VALUES (14071, 5, 214.25);
+INSERT INTO events VALUES (14074, 6, 214.50);
+INSERT INTO events VALUES (14077, 7, 214.75);
+INSERT INTO events VALUES (14080, 8, 215.00);
+INSERT INTO events VALUES (14083, 9, 215.25);
+INSERT INTO events VALUES (14086, 10, 215.50);
+INSERT INTO events VALUES (14089, 11, 215.75);
+INSERT INTO events VALUES (14092, 12, 216.00);
+INSERT INTO events VALUES (14095, 13, 216.25);
+INSERT INTO events VALUES (14098, 14, 216.50);
+INSERT INTO events VALUES (14101, 15, 216.75);
+INSERT INTO events VALUES (14104, 0, 217.00);
+INSERT INTO events VALUES (14107, 1, 217.25);
+INSERT INTO events VALUES (14110, 2, 217.50);
+INSERT INTO events VALUES (14113, 3, 217.75);
+INSERT INTO events VALUES (14116, 4, 218.00);
+INSERT INTO events VALUES (14119, 5, 218.25);
+INSERT INTO events VALUES (14122, 6, 218.50);
+INSERT INTO events VALUES (14125, 7, 218.75);
+INSERT INTO events VALUES (14128, 8, 219.00);
+INSERT INTO events VALUES (14131, 9, 219.25);
+INSERT INTO events VALUES (14134, 10, 219.50);
+INSERT INTO events VALUES (14137, 11, 219.75);
+INSERT INTO events VALUES (14140, 12, 220.00);
+INSERT INTO events VALUES (14143, 13, 220.25);
+INSERT INTO events VALUES (14146, 14, 220.50);
+INSERT INTO events VALUES (14149, 15, 220.75);
+INSERT INTO events VALUES (14152, 0, 221.00);
+INSERT INTO events VALUES (14155, 1, 221.25);
+INSERT INTO events VALUES (14158, 2, 221.50);
+INSERT INTO events VALUES (14161, 3, 221.75);
+INSERT INTO events VALUES (14164, 4, 222.00);
+INSERT INTO events VALUES (14167, 5, 222.25);
+INSERT INTO events VALUES (14170, 6, 222.50);
+INSERT INTO events VALUES (14173, 7, 222.75);
+INSERT INTO events VALUES (14176, 8, 223.00);
+INSERT INTO events VALUES (14179, 9, 223.25);
+INSERT INTO events VALUES (14182, 10, 223.50);
+INSERT INTO events VALUES (14185, 11, 223.75);
+INSERT INTO events VALUES (14188, 12, 224.00);
+INSERT INTO events VALUES (14191, 13, 224.25);
+INSERT INTO events VALUES (14194, 14, 224.50);
+INSERT INTO events VALUES (14197, 15, 224.75);
+INSERT INTO events VALUES (14200, 0, 200.00);
+INSERT INTO events VALUES (14203, 1, 200.25);
+INSERT INTO events VALUES (14206, 2, 200.50);
+INSERT INTO events VALUES (14209, 3, 200.75);
+INSERT INTO events VALUES (14212, 4, 201.00);
+INSERT INTO events VALUES (14215, 5, 201.25);
+INSERT INTO events VALUES (14218, 6, 201.50);
+INSERT INTO events VALUES (14221, 7, 201.75);
+INSERT INTO events VALUES (14224, 8, 202.00);
+INSERT INTO events VALUES (14227, 9, 202.25);
+INSERT INTO events VALUES (14230, 10, 202.50);
+INSERT INTO events VALUES (14233, 11, 202.75);
+INSERT INTO events VALUES (14236, 12, 203.00);
+INSERT INTO events VALUES (14239, 13, 203.25);
+INSERT INTO events VALUES (14242, 14, 203.50);
+INSERT INTO events VALUES (14245, 15, 203.75);
+INSERT INTO events VALUES (14248, 0, 204.00);
+INSERT INTO events VALUES (14251, 1, 204.25);
+INSERT INTO events VALUES (14254, 2, 204.50);
+INSERT INTO events VALUES (14257, 3, 204.75);
+INSERT INTO events VALUES (14260, 4, 205.00);
+INSERT INTO events VALUES (14263, 5, 205.25);
+INSERT INTO events VALUES (14266, 6, 205.50);
+INSERT INTO events VALUES (14269, 7, 205.75);
+INSERT INTO events VALUES (14272, 8, 206.00);
+INSERT INTO events VALUES (14275, 9, 206.25);
+INSERT INTO events VALUES (14278, 10, 206.50);
+INSERT INTO events VALUES (14281, 11, 206.75);
+INSERT INTO events VALUES (14284, 12, 207.00);
+INSERT INTO events VALUES (14287, 13, 207.25);
+INSERT INTO events VALUES (14290, 14, 207.50);
+INSERT INTO events VALUES (14293, 15, 207.75);
+INSERT INTO events VALUES (14296, 0, 208.00);
+INSERT INTO events VALUES (14299, 1, 208.25);
+INSERT INTO events VALUES (14302, 2, 208.50);
+INSERT INTO events VALUES (14305, 3, 208.75);
+INSERT INTO events VALUES (14308, 4, 209.00);
+INSERT INTO events VALUES (14311, 5, 209.25);
+INSERT INTO events VALUES (14314, 6, 209.50);
+INSERT INTO events VALUES (14317, 7, 209.75);
+INSERT INTO events VALUES (14320, 8, 210.00);
+INSERT INTO events VALUES (14323, 9, 210.25);
+INSERT INTO events VALUES (14326, 10, 210.50);
+INSERT INTO events VALUES (14329, 11, 210.75);
+INSERT INTO events VALUES (14332, 12, 211.00);
+INSERT INTO events VALUES (14335, 13, 211.25);
+INSERT INTO events VALUES (14338, 14, 211.50);
+INSERT INTO events VALUES (14341, 15, 211.75);
+INSERT INTO events VALUES (14344, 0, 212.00);
+INSERT INTO events VALUES (14347, 1, 212.25);
+INSERT INTO events VALUES (14350, 2, 212.50);
+INSERT INTO events VALUES (14353, 3, 212.75);
+INSERT INTO events VALUES (14356, 4, 213.00);
+INSERT INTO events VALUES (14359, 5, 213.25);
+INSERT INTO events VALUES (14362, 6, 213.50);
+INSERT INTO events VALUES (14365, 7, 213.75);
+INSERT INTO events VALUES (14368, 8, 214.00);
+INSERT INTO events VALUES (14371, 9, 214.25);
+INSERT INTO events VALUES (14374, 10, 214.50);
+INSERT INTO events VALUES (14377, 11, 214.75);
+INSERT INTO events VALUES (14380, 12, 215.00);
+INSERT INTO events VALUES (14383, 13, 215.25);
+INSERT INTO events VALUES (14386, 14, 215.50);
+INSERT INTO events VALUES (14389, 15, 215.75);
+INSERT INTO events VALUES (14392, 0, 216.00);
+INSERT INTO events VALUES (14395, 1, 216.25);
+INSERT INTO events VALUES (14398, 2, 216.50);
+INSERT INTO events VALUES (14401, 3, 216.75);
+INSERT INTO events VALUES (14404, 4, 217.00);
+INSERT INTO events VALUES (14407, 5, 217.25);
+INSERT INTO events VALUES (14410, 6, 217.50);
+INSERT INTO events VALUES (14413, 7, 217.75);
+INSERT INTO events VALUES (14416, 8, 218.00);
+INSERT INTO events VALUES (14419, 9, 218.25);
+INSERT INTO events VALUES (14422, 10, 218.50);
+INSERT INTO events VALUES (14425, 11, 218.75);
+INSERT INTO events VALUES (14428, 12, 219.00);
+INSERT INTO events VALUES (14431, 13, 219.25);
+INSERT INTO events VALUES (14434, 14, 219.50);
+INSERT INTO events VALUES (14437, 15, 219.75);
+INSERT INTO events VALUES (14440, 0, 220.00);
+INSERT INTO events VALUES (14443, 1, 220.25);
+INSERT INTO events VALUES (14446, 2, 220.50);
+INSERT INTO events VALUES (14449, 3, 220.75);
+INSERT INTO events VALUES (14452, 4, 221.00);
+INSERT INTO events VALUES (14455, 5, 221.25);
+INSERT INTO events VALUES (14458, 6, 221.50);
+INSERT INTO events VALUES (14461, 7, 221.75);
+INSERT INTO events VALUES (14464, 8, 222.00);
+INSERT INTO events VALUES (14467, 9, 222.25);
+INSERT INTO events VALUES (14470, 10, 222.50);
+INSERT INTO events VALUES (14473, 11, 222.75);
+INSERT INTO events VALUES (14476, 12, 223.00);
+INSERT INTO events VALUES (14479, 13, 223.25);
+INSERT INTO events VALUES (14482, 14, 223.50);
+INSERT INTO events VALUES (14485, 15, 223.75);
+INSERT INTO events VALUES (14488, 0, 224.00);
+INSERT INTO events VALUES (14491, 1, 224.25);
+INSERT INTO events VALUES (14494, 2, 224.50);
+INSERT INTO events VALUES (14497, 3, 224.75);
+INSERT INTO events VALUES (14500, 4, 200.00);
+INSERT INTO events VALUES (14503, 5, 200.25);
+INSERT INTO events VALUES (14506, 6, 200.50);
+INSERT INTO events VALUES (14509, 7, 200.75);
+INSERT INTO events VALUES (14512, 8, 201.00);
+INSERT INTO events VALUES (14515, 9, 201.25);
+INSERT INTO events VALUES (14518, 10, 201.50);
+INSERT INTO events VALUES (14521, 11, 201.75);
+INSERT INTO events VALUES (14524, 12, 202.00);
+INSERT INTO events VALUES (14527, 13, 202.25);
+INSERT INTO events VALUES (14530, 14, 202.50);
+INSERT INTO events VALUES (14533, 15, 202.75);
+INSERT INTO events VALUES (14536, 0, 203.00);
+INSERT INTO events VALUES (14539, 1, 203.25);
+INSERT INTO events VALUES (14542, 2, 203.50);
+INSERT INTO events VALUES (14545, 3, 203.75);
+INSERT INTO events VALUES (14548, 4, 204.00);
+INSERT INTO events VALUES (14551, 5, 204.25);
+INSERT INTO events VALUES (14554, 6, 204.50);
+INSERT INTO events VALUES (14557, 7, 204.75);
+INSERT INTO events VALUES (14560, 8, 205.00);
+INSERT INTO events VALUES (14563, 9, 205.25);
+INSERT INTO events VALUES (14566, 10, 205.50);
+INSERT INTO events VALUES (14569, 11, 205.75);
+INSERT INTO events VALUES (14572, 12, 206.00);
+INSERT INTO events VALUES (14575, 13, 206.25);
+INSERT INTO events VALUES (14578, 14, 206.50);
+INSERT INTO events VALUES (14581, 15, 206.75);
+INSERT INTO events VALUES (14584, 0, 207.00);
+INSERT INTO events VALUES (14587, 1, 207.25);
+INSERT INTO events VALUES (14590, 2, 207.50);
+INSERT INTO events VALUES (14593, 3, 207.75);
+INSERT INTO events VALUES (14596, 4, 208.00);
+INSERT INTO events VALUES (14599, 5, 208.25);
+INSERT INTO events VALUES (14602, 6, 208.50);
+INSERT INTO events VALUES (14605, 7, 208.75);
+INSERT INTO events VALUES (14608, 8, 209.00);
+INSERT INTO events VALUES (14611, 9, 209.25);
+INSERT INTO events VALUES (14614, 10, 209.50);
+INSERT INTO events VALUES (14617, 11, 209.75);
+INSERT INTO events VALUES (14620, 12, 210.00);
+INSERT INTO events VALUES (14623, 13, 210.25);
+INSERT INTO events VALUES (14626, 14, 210.50);
+INSERT INTO events VALUES (14629, 15, 210.75);
+INSERT INTO events VALUES (14632, 0, 211.00);
+INSERT INTO events VALUES (14635, 1, 211.25);
+INSERT INTO events VALUES (14638, 2, 211.50);
+INSERT INTO events VALUES (14641, 3, 211.75);
+INSERT INTO events VALUES (14644, 4, 212.00);
+INSERT INTO events VALUES (14647, 5, 212.25);
+INSERT INTO events VALUES (14650, 6, 212.50);
+INSERT INTO events VALUES (14653, 7, 212.75);
+INSERT INTO events VALUES (14656, 8, 213.00);
+INSERT INTO events VALUES (14659, 9, 213.25);
+INSERT INTO events VALUES (14662, 10, 213.50);
+INSERT INTO events VALUES (14665, 11, 213.75);
+INSERT INTO events VALUES (14668, 12, 214.00);
+INSERT INTO events VALUES (14671, 13, 214.25);
+INSERT INTO events VALUES (14674, 14, 214.50);
+INSERT INTO events VALUES (14677, 15, 214.75);
+INSERT INTO events VALUES (14680, 0, 215.00);
+INSERT INTO events VALUES (14683, 1, 215.25);
+INSERT INTO events VALUES (14686, 2, 215.50);
+INSERT INTO events VALUES (14689, 3, 215.75);
+INSERT INTO events VALUES (14692, 4, 216.00);
+INSERT INTO events VALUES (14695, 5, 216.25);
+INSERT INTO events VALUES (14698, 6, 216.50);
+INSERT INTO events VALUES (14701, 7, 216.75);
+INSERT INTO events VALUES (14704, 8, 217.00);
+INSERT INTO events VALUES (14707, 9, 217.25);
+INSERT INTO events VALUES (14710, 10, 217.50);
+INSERT INTO events VALUES (14713, 11, 217.75);
+INSERT INTO events VALUES (14716, 12, 218.00);
+INSERT INTO events VALUES (14719, 13, 218.25);
+INSERT INTO events VALUES (14722, 14, 218.50);
+INSERT INTO events VALUES (14725, 15, 218.75);
+INSERT INTO events VALUES (14728, 0, 219.00);
+INSERT INTO events VALUES (14731, 1, 219.25);
+INSERT INTO events VALUES (14734, 2, 219.50);
+INSERT INTO events VALUES (14737, 3, 219.75);
+INSERT INTO events VALUES (14740, 4, 220.00);
+INSERT INTO events VALUES (14743, 5, 220.25);
+INSERT INTO events VALUES (14746, 6, 220.50);
+INSERT INTO events VALUES (14749, 7, 220.75);
+INSERT INTO events VALUES (14752, 8, 221.00);
+INSERT INTO events VALUES (14755, 9, 221.25);
+INSERT INTO events VALUES (14758, 10, 221.50);
+INSERT INTO events VALUES (14761, 11, 221.75);
+INSERT INTO events VALUES (14764, 12, 222.00);
+INSERT INTO events VALUES (14767, 13, 222.25);
+INSERT INTO events VALUES (14770, 14, 222.50);
+INSERT INTO events VALUES (14773, 15, 222.75);
+INSERT INTO events VALUES (14776, 0, 223.00);
+INSERT INTO events VALUES (14779, 1, 223.25);
+INSERT INTO events VALUES (14782, 2, 223.50);
+INSERT INTO events VALUES (14785, 3, 223.75);
+INSERT INTO events VALUES (14788, 4, 224.00);
+INSERT INTO events VALUES (14791, 5, 224.25);
+INSERT INTO events VALUES (14794, 6, 224.50);
+INSERT INTO events VALUES (14797, 7, 224.75);
+INSERT INTO events VALUES (14800, 8, 200.00);
+INSERT INTO events VALUES (14803, 9, 200.25);
+INSERT INTO events VALUES (14806, 10, 200.50);
+INSERT INTO events VALUES (14809, 11, 200.75);
+INSERT INTO events VALUES (14812, 12, 201.00);
+INSERT INTO events VALUES (14815, 13, 201.25);
+INSERT INTO events VALUES (14818, 14, 201.50);
+INSERT INTO events VALUES (14821, 15, 201.75);
+INSERT INTO events VALUES (14824, 0, 202.00);
+INSERT INTO events VALUES (14827, 1, 202.25);
+INSERT INTO events VALUES (14830, 2, 202.50);
+INSERT INTO events VALUES (14833, 3, 202.75);
+INSERT INTO events VALUES (14836, 4, 203.00);
+INSERT INTO events VALUES (14839, 5, 203.25);
+INSERT INTO events VALUES (14842, 6, 203.50);
+INSERT INTO events VALUES (14845, 7, 203.75);
+INSERT INTO events VALUES (14848, 8, 204.00);
+INSERT INTO events VALUES (14851, 9, 204.25);
+INSERT INTO events VALUES (14854, 10, 204.50);
+INSERT INTO events VALUES (14857, 11, 204.75);
+INSERT INTO events VALUES (14860, 12, 205.00);
+INSERT INTO events VALUES (14863, 13, 205.25);
+INSERT INTO events VALUES (14866, 14, 205.50);
+INSERT INTO events VALUES (14869, 15, 205.75);
+INSERT INTO events VALUES (14872, 0, 206.00);
+INSERT INTO events VALUES (14875, 1, 206.25);
+INSERT INTO events VALUES (14878, 2, 206.50);
+INSERT INTO events VALUES (14881, 3, 206.75);
+INSERT INTO events VALUES (14884, 4, 207.00);
+INSERT INTO events VALUES (14887, 5, 207.25);
+INSERT INTO events VALUES (14890, 6, 207.50);
+INSERT INTO events VALUES (14893, 7, 207.75);
+INSERT INTO events VALUES (14896, 8, 208.00);
+INSERT INTO events VALUES (14899, 9, 208.25);
+INSERT INTO events VALUES (14902, 10, 208.50);
+INSERT INTO events VALUES (14905, 11, 208.75);
+INSERT INTO events VALUES (14908, 12, 209.00);
+INSERT INTO events VALUES (14911, 13, 209.25);
+INSERT INTO events VALUES (14914, 14, 209.50);
+INSERT INTO events VALUES (14917, 15, 209.75);
+INSERT INTO events VALUES (14920, 0, 210.00);
+INSERT INTO events VALUES (14923, 1, 210.25);
+INSERT INTO events VALUES (14926, 2, 210.50);
+INSERT INTO events VALUES (14929, 3, 210.75);
+INSERT INTO events VALUES (14932, 4, 211.00);
+INSERT INTO events VALUES (14935, 5, 211.25);
+INSERT INTO events VALUES (14938, 6, 211.50);
+INSERT INTO events VALUES (14941, 7, 211.75);
+INSERT INTO events VALUES (14944, 8, 212.00);
+INSERT INTO events VALUES (14947, 9, 212.25);
+INSERT INTO events VALUES (14950, 10, 212.50);
+INSERT INTO events VALUES (14953, 11, 212.75);
+INSERT INTO events VALUES (14956, 12, 213.00);
+INSERT INTO events VALUES (14959, 13, 213.25);
+INSERT INTO events VALUES (14962, 14, 213.50);
+INSERT INTO events VALUES (14965, 15, 213.75);
+INSERT INTO events VALUES (14968, 0, 214.00);
+INSERT INTO events VALUES (14971, 1, 214.25);
+INSERT INTO events VALUES (14974, 2, 214.50);
+INSERT INTO events VALUES (14977, 3, 214.75);
+INSERT INTO events VALUES (14980, 4, 215.00);
+INSERT INTO events VALUES (14983, 5, 215.25);
+INSERT INTO events VALUES (14986, 6, 215.50);
+INSERT INTO events VALUES (14989, 7, 215.75);
+INSERT INTO events VALUES (14992, 8, 216.00);
+INSERT INTO events VALUES (14995, 9, 216.25);
+INSERT INTO events VALUES (14998, 10, 216.50);
+INSERT INTO events VALUES (15001, 11, 216.75);
+INSERT INTO events VALUES (15004, 12, 217.00);
+INSERT INTO events VALUES (15007, 13, 217.25);
+INSERT INTO events VALUES (15010, 14, 217.50);
+INSERT INTO events VALUES (15013, 15, 217.75);
+INSERT INTO events VALUES (15016, 0, 218.00);
+INSERT INTO events VALUES (15019, 1, 218.25);
+INSERT INTO events VALUES (15022, 2, 218.50);
+INSERT INTO events VALUES (15025, 3, 218.75);
+INSERT INTO events VALUES (15028, 4, 219.00);
+INSERT INTO events VALUES (15031, 5, 219.25);
+INSERT INTO events VALUES (15034, 6, 219.50);
+INSERT INTO events VALUES (15037, 7, 219.75);
+INSERT INTO events VALUES (15040, 8, 220.00);
+INSERT INTO events VALUES (15043, 9, 220.25);
+INSERT INTO events VALUES (15046, 10, 220.50);
+INSERT INTO events VALUES (15049, 11, 220.75);
+INSERT INTO events VALUES (15052, 12, 221.00);
+INSERT INTO events VALUES (15055, 13, 221.25);
+INSERT INTO events VALUES (15058, 14, 221.50);
+INSERT INTO events VALUES (15061, 15, 221.75);
+INSERT INTO events VALUES (15064, 0, 222.00);
+INSERT INTO events VALUES (15067, 1, 222.25);
+INSERT INTO events VALUES (15070, 2, 222.50);
+INSERT INTO events VALUES (15073, 3, 222.75);
+INSERT INTO events VALUES (15076, 4, 223.00);
+INSERT INTO events VALUES (15079, 5, 223.25);
+INSERT INTO events VALUES (15082, 6, 223.50);
+INSERT INTO events VALUES (15085, 7, 223.75);
+INSERT INTO events VALUES (15088, 8, 224.00);
+INSERT INTO events VALUES (15091, 9, 224.25);
+INSERT INTO events VALUES (15094, 10, 224.50);
+INSERT INTO events VALUES (15097, 11, 224.75);
+INSERT INTO events VALUES (15100, 12, 200.00);
+INSERT INTO events VALUES (15103, 13, 200.25);
+INSERT INTO events VALUES (15106, 14, 200.50);
+INSERT INTO events VALUES (15109, 15, 200.75);
+INSERT INTO events VALUES (15112, 0, 201.00);
+INSERT INTO events VALUES (15115, 1, 201.25);
+INSERT INTO events VALUES (15118, 2, 201.50);
+INSERT INTO events VALUES (15121, 3, 201.75);
+INSERT INTO events VALUES (15124, 4, 202.00);
+INSERT INTO events VALUES (15127, 5, 202.25);
+INSERT INTO events VALUES (15130, 6, 202.50);
+INSERT INTO events VALUES (15133, 7, 202.75);
+INSERT INTO events VALUES (15136, 8, 203.00);
+INSERT INTO events VALUES (15139, 9, 203.25);
+INSERT INTO events VALUES (15142, 10, 203.50);
+INSERT INTO events VALUES (15145, 11, 203.75);
+INSERT INTO events VALUES (15148, 12, 204.00);
+INSERT INTO events VALUES (15151, 13, 204.25);
+INSERT INTO events VALUES (15154, 14, 204.50);
+INSERT INTO events VALUES (15157, 15, 204.75);
+INSERT INTO events VALUES (15160, 0, 205.00);
+INSERT INTO events VALUES (15163, 1, 205.25);
+INSERT INTO events VALUES (15166, 2, 205.50);
+INSERT INTO events VALUES (15169, 3, 205.75);
+INSERT INTO events VALUES (15172, 4, 206.00);
+INSERT INTO events VALUES (15175, 5, 206.25);
+INSERT INTO events VALUES (15178, 6, 206.50);
+INSERT INTO events VALUES (15181, 7, 206.75);
+INSERT INTO events VALUES (15184, 8, 207.00);
+INSERT INTO events VALUES (15187, 9, 207.25);
+INSERT INTO events VALUES (15190, 10, 207.50);
+INSERT INTO events VALUES (15193, 11, 207.75);
+INSERT INTO events VALUES (15196, 12, 208.00);
+INSERT INTO events VALUES (15199, 13, 208.25);
+INSERT INTO events VALUES (15202, 14, 208.50);
+INSERT INTO events VALUES (15205, 15, 208.75);
+INSERT INTO events VALUES (15208, 0, 209.00);
+INSERT INTO events VALUES (15211, 1, 209.25);
+INSERT INTO events VALUES (15214, 2, 209.50);
+INSERT INTO events VALUES (15217, 3, 209.75);
+INSERT INTO events VALUES (15220, 4, 210.00);
+INSERT INTO events VALUES (15223, 5, 210.25);
+INSERT INTO events VALUES (15226, 6, 210.50);
+INSERT INTO events VALUES (15229, 7, 210.75);
+INSERT INTO events VALUES (15232, 8, 211.00);
+INSERT INTO events VALUES (15235, 9, 211.25);
+INSERT INTO events VALUES (15238, 10, 211.50);
+INSERT INTO events VALUES (15241, 11, 211.75);
+INSERT INTO events VALUES (15244, 12, 212.00);
+INSERT INTO events VALUES (15247, 13, 212.25);
+INSERT INTO events VALUES (15250, 14, 212.50);
+INSERT INTO events VALUES (15253, 15, 212.75);
+INSERT INTO events VALUES (15256, 0, 213.00);
+INSERT INTO events VALUES (15259, 1, 213.25);
+INSERT INTO events VALUES (15262, 2, 213.50);
+INSERT INTO events VALUES (15265, 3, 213.75);
+INSERT INTO events VALUES (15268, 4, 214.00);
+INSERT INTO events VALUES (15271, 5, 214.25);
+INSERT INTO events VALUES (15274, 6, 214.50);
+INSERT INTO events VALUES (15277, 7, 214.75);
+INSERT INTO events VALUES (15280, 8, 215.00);
+INSERT INTO events VALUES (15283, 9, 215.25);
+INSERT INTO events VALUES (15286, 10, 215.50);
+INSERT INTO events VALUES (15289, 11, 215.75);
+INSERT INTO events VALUES (15292, 12, 216.00);
+INSERT INTO events VALUES (15295, 13, 216.25);
+INSERT INTO events VALUES (15298, 14, 216.50);
+INSERT INTO events VALUES (15301, 15, 216.75);
+INSERT INTO events VALUES (15304, 0, 217.00);
+INSERT INTO events VALUES (15307, 1, 217.25);
+INSERT INTO events VALUES (15310, 2, 217.50);
+INSERT INTO events VALUES (15313, 3, 217.75);
+INSERT INTO events VALUES (15316, 4, 218.00);
+INSERT INTO events VALUES (15319, 5, 218.25);
+INSERT INTO events VALUES (15322, 6, 218.50);
+INSERT INTO events VALUES (15325, 7, 218.75);
+INSERT INTO events VALUES (15328, 8, 219.00);
+INSERT INTO events VALUES (15331, 9, 219.25);
+INSERT INTO events VALUES (15334, 10, 219.50);
+INSERT INTO events VALUES (15337, 11, 219.75);
+INSERT INTO events VALUES (15340, 12, 220.00);
+INSERT INTO events VALUES (15343, 13, 220.25);
+INSERT INTO events VALUES (15346, 14, 220.50);
+INSERT INTO events VALUES (15349, 15, 220.75);
+INSERT INTO events VALUES (15352, 0, 221.00);
+INSERT INTO events VALUES (15355, 1, 221.25);
+INSERT INTO events VALUES (15358, 2, 221.50);
+INSERT INTO events VALUES (15361, 3, 221.75);
+INSERT INTO events VALUES (15364, 4, 222.00);
+INSERT INTO events VALUES (15367, 5, 222.25);
+INSERT INTO events VALUES (15370, 6, 222.50);
+INSERT INTO events VALUES (15373, 7, 222.75);
+INSERT INTO events VALUES (15376, 8, 223.00);
+INSERT INTO events VALUES (15379, 9, 223.25);
+INSERT INTO events VALUES (15382, 10, 223.50);
+INSERT INTO events VALUES (15385, 11, 223.75);
+INSERT INTO events VALUES (15388, 12, 224.00);
+INSERT INTO events VALUES (15391, 13, 224.25);
+INSERT INTO events VALUES (15394, 14, 224.50);
+INSERT INTO events VALUES (15397, 15, 224.75);
+INSERT INTO events VALUES (15400, 0, 200.00);
+INSERT INTO events VALUES (15403, 1, 200.25);
+INSERT INTO events VALUES (15406, 2, 200.50);
+INSERT INTO events VALUES (15409, 3, 200.75);
+INSERT INTO events VALUES (15412, 4, 201.00);
+INSERT INTO events VALUES (15415, 5, 201.25);
+INSERT INTO events VALUES (15418, 6, 201.50);
+INSERT INTO events VALUES (15421, 7, 201.75);
+INSERT INTO events VALUES (15424, 8, 202.00);
+INSERT INTO events VALUES (15427, 9, 202.25);
+INSERT INTO events VALUES (15430, 10, 202.50);
+INSERT INTO events VALUES (15433, 11, 202.75);
+INSERT INTO events VALUES (15436, 12, 203.00);
+INSERT INTO events VALUES (15439, 13, 203.25);
+INSERT INTO events VALUES (15442, 14, 203.50);
+INSERT INTO events VALUES (15445, 15, 203.75);
+INSERT INTO events VALUES (15448, 0, 204.00);
+INSERT INTO events VALUES (15451, 1, 204.25);
+INSERT INTO events VALUES (15454, 2, 204.50);
+INSERT INTO events VALUES (15457, 3, 204.75);
+INSERT INTO events VALUES (15460, 4, 205.00);
+INSERT INTO events VALUES (15463, 5, 205.25);
+INSERT INTO events VALUES (15466, 6, 205.50);
+INSERT INTO events VALUES (15469, 7, 205.75);
+INSERT INTO events VALUES (15472, 8, 206.00);
+INSERT INTO events VALUES (15475, 9, 206.25);
+INSERT INTO events VALUES (15478, 10, 206.50);
+INSERT INTO events VALUES (15481, 11, 206.75);
+INSERT INTO events VALUES (15484, 12, 207.00);
+INSERT INTO events VALUES (15487, 13, 207.25);
+INSERT INTO events VALUES (15490, 14, 207.50);
+INSERT INTO events VALUES (15493, 15, 207.75);
+INSERT INTO events VALUES (15496, 0, 208.00);
+INSERT INTO events VALUES (15499, 1, 208.25);
+INSERT INTO events VALUES (15502, 2, 208.50);
+INSERT INTO events VALUES (15505, 3, 208.75);
+INSERT INTO events VALUES (15508, 4, 209.00);
+INSERT INTO events VALUES (15511, 5, 209.25);
+INSERT INTO events VALUES (15514, 6, 209.50);
+INSERT INTO events VALUES (15517, 7, 209.75);
+INSERT INTO events VALUES (15520, 8, 210.00);
+INSERT INTO events VALUES (15523, 9, 210.25);
+INSERT INTO events VALUES (15526, 10, 210.50);
+INSERT INTO events VALUES (15529, 11, 210.75);
+INSERT INTO events VALUES (15532, 12, 211.00);
+INSERT INTO events VALUES (15535, 13, 211.25);
+INSERT INTO events VALUES (15538, 14, 211.50);
+INSERT INTO events VALUES (15541, 15, 211.75);
+INSERT INTO events VALUES (15544, 0, 212.00);
+INSERT INTO events VALUES (15547, 1, 212.25);
+INSERT INTO events VALUES (15550, 2, 212.50);
+INSERT INTO events VALUES (15553, 3, 212.75);
+INSERT INTO events VALUES (15556, 4, 213.00);
+INSERT INTO events VALUES (15559, 5, 213.25);
+INSERT INTO events VALUES (15562, 6, 213.50);
+INSERT INTO events VALUES (15565, 7, 213.75);
+INSERT INTO events VALUES (15568, 8, 214.00);
+INSERT INTO events VALUES (15571, 9, 214.25);
+INSERT INTO events VALUES (15574, 10, 214.50);
+INSERT INTO events VALUES (15577, 11, 214.75);
+INSERT INTO events VALUES (15580, 12, 215.00);
+INSERT INTO events VALUES (15583, 13, 215.25);
+INSERT INTO events VALUES (15586, 14, 215.50);
+INSERT INTO events VALUES (15589, 15, 215.75);
+INSERT INTO events VALUES (15592, 0, 216.00);
+INSERT INTO events VALUES (15595, 1, 216.25);
+INSERT INTO events VALUES (15598, 2, 216.50);
+INSERT INTO events VALUES (15601, 3, 216.75);
+INSERT INTO events VALUES (15604, 4, 217.00);
+INSERT INTO events VALUES (15607, 5, 217.25);
+INSERT INTO events VALUES (15610, 6, 217.50);
+INSERT INTO events VALUES (15613, 7, 217.75);
+INSERT INTO events VALUES (15616, 8, 218.00);
+INSERT INTO events VALUES (15619, 9, 218.25);
+INSERT INTO events VALUES (15622, 10, 218.50);
+INSERT INTO events VALUES (15625, 11, 218.75);
+INSERT INTO events VALUES (15628, 12, 219.00);
+INSERT INTO events VALUES (15631, 13, 219.25);
+INSERT INTO events VALUES (15634, 14, 219.50);
+INSERT INTO events VALUES (15637, 15, 219.75);
+INSERT INTO events VALUES (15640, 0, 220.00);
+INSERT INTO events VALUES (15643, 1, 220.25);
+INSERT INTO events VALUES (15646, 2, 220.50);
+INSERT INTO events VALUES (15649, 3, 220.75);
+INSERT INTO events VALUES (15652, 4, 221.00);
+INSERT INTO events VALUES (15655, 5, 221.25);
+INSERT INTO events VALUES (15658, 6, 221.50);
+INSERT INTO events VALUES (15661, 7, 221.75);
+INSERT INTO events VALUES (15664, 8, 222.00);
+INSERT INTO events VALUES (15667, 9, 222.25);
+INSERT INTO events VALUES (15670, 10, 222.50);
+INSERT INTO events VALUES (15673, 11, 222.75);
+INSERT INTO events VALUES (15676, 12, 223.00);
+INSERT INTO events VALUES (15679, 13, 223.25);
+INSERT INTO events VALUES (15682, 14, 223.50);
+INSERT INTO events VALUES (15685, 15, 223.75);
+INSERT INTO events VALUES (15688, 0, 224.00);
+INSERT INTO events VALUES (15691, 1, 224.25);
+INSERT INTO events VALUES (15694, 2, 224.50);
+INSERT INTO events VALUES (15697, 3, 224.75);
+INSERT INTO events VALUES (15700, 4, 200.00);
+INSERT INTO events VALUES (15703, 5, 200.25);
+INSERT INTO events VALUES (15706, 6, 200.50);
+INSERT INTO events VALUES (15709, 7, 200.75);
+INSERT INTO events VALUES (15712, 8, 201.00);
+INSERT INTO events VALUES (15715, 9, 201.25);
+INSERT INTO events VALUES (15718, 10, 201.50);
+INSERT INTO events VALUES (15721, 11, 201.75);
+INSERT INTO events VALUES (15724, 12, 202.00);
+INSERT INTO events VALUES (15727, 13, 202.25);
+INSERT INTO events VALUES (15730, 14, 202.50);
+INSERT INTO events VALUES (15733, 15, 202.75);
+INSERT INTO events VALUES (15736, 0, 203.00);
+INSERT INTO events VALUES (15739, 1, 203.25);
+INSERT INTO events VALUES (15742, 2, 203.50);
+INSERT INTO events VALUES (15745, 3, 203.75);
+INSERT INTO events VALUES (15748, 4, 204.00);
+INSERT INTO events VALUES (15751, 5, 204.25);
+INSERT INTO events VALUES (15754, 6, 204.50);
+INSERT INTO events VALUES (15757, 7, 204.75);
+INSERT INTO events VALUES (15760, 8, 205.00);
+INSERT INTO events VALUES (15763, 9, 205.25);
+INSERT INTO events VALUES (15766, 10, 205.50);
+INSERT INTO events VALUES (15769, 11, 205.75);
+INSERT INTO events VALUES (15772, 12, 206.00);
+INSERT INTO events VALUES (15775, 13, 206.25);
+INSERT INTO events VALUES (15778, 14, 206.50);
+INSERT INTO events VALUES (15781, 15, 206.75);
+INSERT INTO events VALUES (15784, 0, 207.00);
+INSERT INTO events VALUES (15787, 1, 207.25);
+INSERT INTO events VALUES (15790, 2, 207.50);
+INSERT INTO events VALUES (15793, 3, 207.75);
+INSERT INTO events VALUES (15796, 4, 208.00);
+INSERT INTO events VALUES (15799, 5, 208.25);
+INSERT INTO events VALUES (15802, 6, 208.50);
+INSERT INTO events VALUES (15805, 7, 208.75);
+INSERT INTO events VALUES (15808, 8, 209.00);
+INSERT INTO events VALUES (15811, 9, 209.25);
+INSERT INTO events VALUES (15814, 10, 209.50);
+INSERT INTO events VALUES (15817, 11, 209.75);
+INSERT INTO events VALUES (15820, 12, 210.00);
+INSERT INTO events VALUES (15823, 13, 210.25);
+INSERT INTO events VALUES (15826, 14, 210.50);
+INSERT INTO events VALUES (15829, 15, 210.75);
+INSERT INTO events VALUES (15832, 0, 211.00);
+INSERT INTO events VALUES (15835, 1, 211.25);
+INSERT INTO events VALUES (15838, 2, 211.50);
+INSERT INTO events VALUES (15841, 3, 211.75);
+INSERT INTO events VALUES (15844, 4, 212.00);
+INSERT INTO events VALUES (15847, 5, 212.25);
+INSERT INTO events VALUES (15850, 6, 212.50);
+INSERT INTO events VALUES (15853, 7, 212.75);
+INSERT INTO events VALUES (15856, 8, 213.00);
+INSERT INTO events VALUES (15859, 9, 213.25);
+INSERT INTO events VALUES (15862, 10, 213.50);
+INSERT INTO events VALUES (15865, 11, 213.75);
+INSERT INTO events VALUES (15868, 12, 214.00);
+INSERT INTO events VALUES (15871, 13, 214.25);
+INSERT INTO events VALUES (15874, 14, 214.50);
+INSERT INTO events VALUES (15877, 15, 214.75);
+INSERT INTO events VALUES (15880, 0, 215.00);
+INSERT INTO events VALUES (15883, 1, 215.25);
+INSERT INTO events VALUES (15886, 2, 215.50);
+INSERT INTO events VALUES (15889, 3, 215.75);
+INSERT INTO events VALUES (15892, 4, 216.00);
+INSERT INTO events VALUES (15895, 5, 216.25);
+INSERT INTO events VALUES (15898, 6, 216.50);
+INSERT INTO events VALUES (15901, 7, 216.75);
+INSERT INTO events VALUES (15904, 8, 217.00);
+INSERT INTO events VALUES (15907, 9, 217.25);
+INSERT INTO events VALUES (15910, 10, 217.50);
+INSERT INTO events VALUES (15913, 11, 217.75);
+INSERT INTO events VALUES (15916, 12, 218.00);
+INSERT INTO events VALUES (15919, 13, 218.25);
+INSERT INTO events VALUES (15922, 14, 218.50);
+INSERT INTO events VALUES (15925, 15, 218.75);
+INSERT INTO events VALUES (15928, 0, 219.00);
+INSERT INTO events VALUES (15931, 1, 219.25);
+INSERT INTO events VALUES (15934, 2, 219.50);
+INSERT INTO events VALUES (15937, 3, 219.75);
+INSERT INTO events VALUES (15940, 4, 220.00);
+INSERT INTO events VALUES (15943, 5, 220.25);
+INSERT INTO events VALUES (15946, 6, 220.50);
+INSERT INTO events VALUES (15949, 7, 220.75);
+INSERT INTO events VALUES (15952, 8, 221.00);
+INSERT INTO events VALUES (15955, 9, 221.25);
+INSERT INTO events VALUES (15958, 10, 221.50);
+INSERT INTO events VALUES (15961, 11, 221.75);
+INSERT INTO events VALUES (15964, 12, 222.00);
+INSERT INTO events VALUES (15967, 13, 222.25);
+INSERT INTO events VALUES (15970, 14, 222.50);
+INSERT INTO events VALUES (15973, 15, 222.75);
+INSERT INTO events VALUES (15976, 0, 223.00);
+INSERT INTO events VALUES (15979, 1, 223.25);
+INSERT INTO events VALUES (15982, 2, 223.50);
+INSERT INTO events VALUES (15985, 3, 223.75);
+INSERT INTO events VALUES (15988, 4, 224.00);
+INSERT INTO events VALUES (15991, 5, 224.25);
+INSERT INTO events VALUES (15994, 6, 224.50);
+INSERT INTO events VALUES (15997, 7, 224.75);
+INSERT INTO events VALUES (16000, 8, 200.00);
+INSERT INTO events VALUES (16003, 9, 200.25);
+INSERT INTO events VALUES (16006, 10, 200.50);
+INSERT INTO events VALUES (16009, 11, 200.75);
+INSERT INTO events VALUES (16012, 12, 201.00);
+INSERT INTO events VALUES (16015, 13, 201.25);
+INSERT INTO events VALUES (16018, 14, 201.50);
+INSERT INTO events VALUES (16021, 15, 201.75);
+INSERT INTO events VALUES (16024, 0, 202.00);
+INSERT INTO events VALUES (16027, 1, 202.25);
+INSERT INTO events VALUES (16030, 2, 202.50);
+INSERT INTO events VALUES (16033, 3, 202.75);
+INSERT INTO events VALUES (16036, 4, 203.00);
+INSERT INTO events VALUES (16039, 5, 203.25);
+INSERT INTO events VALUES (16042, 6, 203.50);
+INSERT INTO events VALUES (16045, 7, 203.75);
+INSERT INTO events VALUES (16048, 8, 204.00);
+INSERT INTO events VALUES (16051, 9, 204.25);
+INSERT INTO events VALUES (16054, 10, 204.50);
+INSERT INTO events VALUES (16057, 11, 204.75);
+INSERT INTO events VALUES (16060, 12, 205.00);
+INSERT INTO events VALUES (16063, 13, 205.25);
+INSERT INTO events VALUES (16066, 14, 205.50);
+INSERT INTO events VALUES (16069, 15, 205.75);
+INSERT INTO events VALUES (16072, 0, 206.00);
+INSERT INTO events VALUES (16075, 1, 206.25);
+INSERT INTO events VALUES (16078, 2, 206.50);
+INSERT INTO events VALUES (16081, 3, 206.75);
+INSERT INTO events VALUES (16084, 4, 207.00);
+INSERT INTO events VALUES (16087, 5, 207.25);
+INSERT INTO events VALUES (16090, 6, 207.50);
+INSERT INTO events VALUES (16093, 7, 207.75);
+INSERT INTO events VALUES (16096, 8, 208.00);
+INSERT INTO events VALUES (16099, 9, 208.25);
+INSERT INTO events VALUES (16102, 10, 208.50);
+INSERT INTO events VALUES (16105, 11, 208.75);
+INSERT INTO events VALUES (16108, 12, 209.00);
+INSERT INTO events VALUES (16111, 13, 209.25);
+INSERT INTO events VALUES (16114, 14, 209.50);
+INSERT INTO events VALUES (16117, 15, 209.75);
+INSERT INTO events VALUES (16120, 0, 210.00);
+INSERT INTO events VALUES (16123, 1, 210.25);
+INSERT INTO events VALUES (16126, 2, 210.50);
+INSERT INTO events VALUES (16129, 3, 210.75);
+INSERT INTO events VALUES (16132, 4, 211.00);
+INSERT INTO events VALUES (16135, 5, 211.25);
+INSERT INTO events VALUES (16138, 6, 211.50);
+INSERT INTO events VALUES (16141, 7, 211.75);
+INSERT INTO events VALUES (16144, 8, 212.00);
+INSERT INTO events VALUES (16147, 9, 212.25);
+INSERT INTO events VALUES (16150, 10, 212.50);
+INSERT INTO events VALUES (16153, 11, 212.75);
+INSERT INTO events VALUES (16156, 12, 213.00);
+INSERT INTO events VALUES (16159, 13, 213.25);
+INSERT INTO events VALUES (16162, 14, 213.50);
+INSERT INTO events VALUES (16165, 15, 213.75);
+INSERT INTO events VALUES (16168, 0, 214.00);
+INSERT INTO events VALUES (16171, 1, 214.25);
+INSERT INTO events VALUES (16174, 2, 214.50);
+INSERT INTO events VALUES (16177, 3, 214.75);
+INSERT INTO events VALUES (16180, 4, 215.00);
+INSERT INTO events VALUES (16183, 5, 215.25);
+INSERT INTO events VALUES (16186, 6, 215.50);
+INSERT INTO events VALUES (16189, 7, 215.75);
+INSERT INTO events VALUES (16192, 8, 216.00);
+INSERT INTO events VALUES (16195, 9, 216.25);
+INSERT INTO events VALUES (16198, 10, 216.50);
+INSERT INTO events VALUES (16201, 11, 216.75);
+INSERT INTO events VALUES (16204, 12, 217.00);
+INSERT INTO events VALUES (16207, 13, 217.25);
+INSERT INTO events VALUES (16210, 14, 217.50);
+INSERT INTO events VALUES (16213, 15, 217.75);
+INSERT INTO events VALUES (16216, 0, 218.00);
+INSERT INTO events VALUES (16219, 1, 218.25);
+INSERT INTO events VALUES (16222, 2, 218.50);
+INSERT INTO events VALUES (16225, 3, 218.75);
+INSERT INTO events VALUES (16228, 4, 219.00);
+INSERT INTO events VALUES (16231, 5, 219.25);
+INSERT INTO events VALUES (16234, 6, 219.50);
+INSERT INTO events VALUES (16237, 7, 219.75);
+INSERT INTO events VALUES (16240, 8, 220.00);
+INSERT INTO events VALUES (16243, 9, 220.25);
+INSERT INTO events VALUES (16246, 10, 220.50);
+INSERT INTO events VALUES (16249, 11, 220.75);
+INSERT INTO events VALUES (16252, 12, 221.00);
+INSERT INTO events VALUES (16255, 13, 221.25);
+INSERT INTO events VALUES (16258, 14, 221.50);
+INSERT INTO events VALUES (16261, 15, 221.75);
+INSERT INTO events VALUES (16264, 0, 222.00);
+INSERT INTO events VALUES (16267, 1, 222.25);
+INSERT INTO events VALUES (16270, 2, 222.50);
+INSERT INTO events VALUES (16273, 3, 222.75);
+INSERT INTO events VALUES (16276, 4, 223.00);
+INSERT INTO events VALUES (16279, 5, 223.25);
+INSERT INTO events VALUES (16282, 6, 223.50);
+INSERT INTO events VALUES (16285, 7, 223.75);
+INSERT INTO events VALUES (16288, 8, 224.00);
+INSERT INTO events VALUES (16291, 9, 224.25);
+INSERT INTO events VALUES (16294, 10, 224.50);
+INSERT INTO events VALUES (16297, 11, 224.75);
+INSERT INTO events VALUES (16300, 12, 200.00);
+INSERT INTO events VALUES (16303, 13, 200.25);
+INSERT INTO events VALUES (16306, 14, 200.50);
+INSERT INTO events VALUES (16309, 15, 200.75);
+INSERT INTO events VALUES (16312, 0, 201.00);
+INSERT INTO events VALUES (16315, 1, 201.25);
+INSERT INTO events VALUES (16318, 2, 201.50);
+INSERT INTO events VALUES (16321, 3, 201.75);
+INSERT INTO events VALUES (16324, 4, 202.00);
+INSERT INTO events VALUES (16327, 5, 202.25);
+INSERT INTO events VALUES (16330, 6, 202.50);
+INSERT INTO events VALUES (16333, 7, 202.75);
+INSERT INTO events VALUES (16336, 8, 203.00);
+INSERT INTO events VALUES (16339, 9, 203.25);
+INSERT INTO events VALUES (16342, 10, 203.50);
+INSERT INTO events VALUES (16345, 11, 203.75);
+INSERT INTO events VALUES (16348, 12, 204.00);
+INSERT INTO events VALUES (16351, 13, 204.25);
+INSERT INTO events VALUES (16354, 14, 204.50);
+INSERT INTO events VALUES (16357, 15, 204.75);
+INSERT INTO events VALUES (16360, 0, 205.00);
+INSERT INTO events VALUES (16363, 1, 205.25);
+INSERT INTO events VALUES (16366, 2, 205.50);
+INSERT INTO events VALUES (16369, 3, 205.75);
+INSERT INTO events VALUES (16372, 4, 206.00);
+INSERT INTO events VALUES (16375, 5, 206.25);
+INSERT INTO events VALUES (16378, 6, 206.50);
+INSERT INTO events VALUES (16381, 7, 206.75);
+INSERT INTO events VALUES (16384, 8, 207.00);
+INSERT INTO events VALUES (16387, 9, 207.25);
+INSERT INTO events VALUES (16390, 10, 207.50);
+INSERT INTO events VALUES (16393, 11, 207.75);
+INSERT INTO events VALUES (16396, 12, 208.00);
+INSERT INTO events VALUES (16399, 13, 208.25);
+INSERT INTO events VALUES (16402, 14, 208.50);
+INSERT INTO events VALUES (16405, 15, 208.75);
+INSERT INTO events VALUES (16408, 0, 209.00);
+INSERT INTO events VALUES (16411, 1, 209.25);
+INSERT INTO events VALUES (16414, 2, 209.50);
+INSERT INTO events VALUES (16417, 3, 209.75);
+INSERT INTO events VALUES (16420, 4, 210.00);
+INSERT INTO events VALUES (16423, 5, 210.25);
+INSERT INTO events VALUES (16426, 6, 210.50);
+INSERT INTO events VALUES (16429, 7, 210.75);
+INSERT INTO events VALUES (16432, 8, 211.00);
+INSERT INTO events VALUES (16435, 9, 211.25);
+INSERT INTO events VALUES (16438, 10, 211.50);
+INSERT INTO events VALUES (16441, 11, 211.75);
+INSERT INTO events VALUES (16444, 12, 212.00);
+INSERT INTO events VALUES (16447, 13, 212.25);
+INSERT INTO events VALUES (16450, 14, 212.50);
+INSERT INTO events VALUES (16453, 15, 212.75);
+INSERT INTO events VALUES (16456, 0, 213.00);
+INSERT INTO events VALUES (16459, 1, 213.25);
+INSERT INTO events VALUES (16462, 2, 213.50);
+INSERT INTO events VALUES (16465, 3, 213.75);
+INSERT INTO events VALUES (16468, 4, 214.00);
+INSERT INTO events VALUES (16471, 5, 214.25);
+INSERT INTO events VALUES (16474, 6, 214.50);
+INSERT INTO events VALUES (16477, 7, 214.75);
+INSERT INTO events VALUES (16480, 8, 215.00);
+INSERT INTO events VALUES (16483, 9, 215.25);
+INSERT INTO events VALUES (16486, 10, 215.50);
+INSERT INTO events VALUES (16489, 11, 215.75);
+INSERT INTO events VALUES (16492, 12, 216.00);
+INSERT INTO events VALUES (16495, 13, 216.25);
+INSERT INTO events VALUES (16498, 14, 216.50);
+INSERT INTO events VALUES (16501, 15, 216.75);
+INSERT INTO events VALUES (16504, 0, 217.00);
+INSERT INTO events VALUES (16507, 1, 217.25);
+INSERT INTO events VALUES (16510, 2, 217.50);
+INSERT INTO events VALUES (16513, 3, 217.75);
+INSERT INTO events VALUES (16516, 4, 218.00);
+INSERT INTO events VALUES (16519, 5, 218.25);
+INSERT INTO events VALUES (16522, 6, 218.50);
+INSERT INTO events VALUES (16525, 7, 218.75);
+INSERT INTO events VALUES (16528, 8, 219.00);
+INSERT INTO events VALUES (16531, 9, 219.25);
+INSERT INTO events VALUES (16534, 10, 219.50);
+INSERT INTO events VALUES (16537, 11, 219.75);
+INSERT INTO events VALUES (16540, 12, 220.00);
+INSERT INTO events VALUES (16543, 13, 220.25);
+INSERT INTO events VALUES (16546, 14, 220.50);
+INSERT INTO events VALUES (16549, 15, 220.75);
+INSERT INTO events VALUES (16552, 0, 221.00);
+INSERT INTO events VALUES (16555, 1, 221.25);
+INSERT INTO events VALUES (16558, 2, 221.50);
+INSERT INTO events VALUES (16561, 3, 221.75);
+INSERT INTO events VALUES (16564, 4, 222.00);
+INSERT INTO events VALUES (16567, 5, 222.25);
+INSERT INTO events VALUES (16570, 6, 222.50);
+INSERT INTO events VALUES (16573, 7, 222.75);
+INSERT INTO events VALUES (16576, 8, 223.00);
+INSERT INTO events VALUES (16579, 9, 223.25);
+INSERT INTO events VALUES (16582, 10, 223.50);
+INSERT INTO events VALUES (16585, 11, 223.75);
+INSERT INTO events VALUES (16588, 12, 224.00);
+INSERT INTO events VALUES (16591, 13, 224.25);
+INSERT INTO events VALUES (16594, 14, 224.50);
+INSERT INTO events VALUES (16597, 15, 224.75);
+INSERT INTO events VALUES (16600, 0, 200.00);
+INSERT INTO events VALUES (16603, 1, 200.25);
+INSERT INTO events VALUES (16606, 2, 200.50);
+INSERT INTO events VALUES (16609, 3, 200.75);
+INSERT INTO events VALUES (16612, 4, 201.00);
+INSERT INTO events VALUES (16615, 5, 201.25);
+INSERT INTO events VALUES (16618, 6, 201.50);
+INSERT INTO events VALUES (16621, 7, 201.75);
+INSERT INTO events VALUES (16624, 8, 202.00);
+INSERT INTO events VALUES (16627, 9, 202.25);
+INSERT INTO events VALUES (16630, 10, 202.50);
+INSERT INTO events VALUES (16633, 11, 202.75);
+INSERT INTO events VALUES (16636, 12, 203.00);
+INSERT INTO events VALUES (16639, 13, 203.25);
+INSERT INTO events VALUES (16642, 14, 203.50);
+INSERT INTO events VALUES (16645, 15, 203.75);
+INSERT INTO events VALUES (16648, 0, 204.00);
+INSERT INTO events VALUES (16651, 1, 204.25);
+INSERT INTO events VALUES (16654, 2, 204.50);
+INSERT INTO events VALUES (16657, 3, 204.75);
+INSERT INTO events VALUES (16660, 4, 205.00);
+INSERT INTO events VALUES (16663, 5, 205.25);
+INSERT INTO events VALUES (16666, 6, 205.50);
+INSERT INTO events VALUES (16669, 7, 205.75);
+INSERT INTO events VALUES (16672, 8, 206.00);
+INSERT INTO events VALUES (16675, 9, 206.25);
+INSERT INTO events VALUES (16678, 10, 206.50);
+INSERT INTO events VALUES (16681, 11, 206.75);
+INSERT INTO events VALUES (16684, 12, 207.00);
+INSERT INTO events VALUES (16687, 13, 207.25);
+INSERT INTO events VALUES (16690, 14, 207.50);
+INSERT INTO events VALUES (16693, 15, 207.75);
+INSERT INTO events VALUES (16696, 0, 208.00);
+INSERT INTO events VALUES (16699, 1, 208.25);
+INSERT INTO events VALUES (16702, 2, 208.50);
+INSERT INTO events VALUES (16705, 3, 208.75);
+INSERT INTO events VALUES (16708, 4, 209.00);
+INSERT INTO events VALUES (16711, 5, 209.25);
+INSERT INTO events VALUES (16714, 6, 209.50);
+INSERT INTO events VALUES (16717, 7, 209.75);
+INSERT INTO events VALUES (16720, 8, 210.00);
+INSERT INTO events VALUES (16723, 9, 210.25);
+INSERT INTO events VALUES (16726, 10, 210.50);
+INSERT INTO events VALUES (16729, 11, 210.75);
+INSERT INTO events VALUES (16732, 12, 211.00);
+INSERT INTO events VALUES (16735, 13, 211.25);
+INSERT INTO events VALUES (16738, 14, 211.50);
+INSERT INTO events VALUES (16741, 15, 211.75);
+INSERT INTO events VALUES (16744, 0, 212.00);
+INSERT INTO events VALUES (16747, 1, 212.25);
+INSERT INTO events VALUES (16750, 2, 212.50);
+INSERT INTO events VALUES (16753, 3, 212.75);
+INSERT INTO events VALUES (16756, 4, 213.00);
+INSERT INTO events VALUES (16759, 5, 213.25);
+INSERT INTO events VALUES (16762, 6, 213.50);
+INSERT INTO events VALUES (16765, 7, 213.75);
+INSERT INTO events VALUES (16768, 8, 214.00);
+INSERT INTO events VALUES (16771, 9, 214.25);
+INSERT INTO events VALUES (16774, 10, 214.50);
+INSERT INTO events VALUES (16777, 11, 214.75);
+INSERT INTO events VALUES (16780, 12, 215.00);
+INSERT INTO events VALUES (16783, 13, 215.25);
+INSERT INTO events VALUES (16786, 14, 215.50);
+INSERT INTO events VALUES (16789, 15, 215.75);
+INSERT INTO events VALUES (16792, 0, 216.00);
+INSERT INTO events VALUES (16795, 1, 216.25);
+INSERT INTO events VALUES (16798, 2, 216.50);
+INSERT INTO events VALUES (16801, 3, 216.75);
+INSERT INTO events VALUES (16804, 4, 217.00);
+INSERT INTO events VALUES (16807, 5, 217.25);
+INSERT INTO events VALUES (16810, 6, 217.50);
+INSERT INTO events VALUES (16813, 7, 217.75);
+INSERT INTO events VALUES (16816, 8, 218.00);
+INSERT INTO events VALUES (16819, 9, 218.25);
+INSERT INTO events VALUES (16822, 10, 218.50);
+INSERT INTO events VALUES (16825, 11, 218.75);
+INSERT INTO events VALUES (16828, 12, 219.00);
+INSERT INTO events VALUES (16831, 13, 219.25);
+INSERT INTO events VALUES (16834, 14, 219.50);
+INSERT INTO events VALUES (16837, 15, 219.75);
+INSERT INTO events VALUES (16840, 0, 220.00);
+INSERT INTO events VALUES (16843, 1, 220.25);
+INSERT INTO events VALUES (16846, 2, 220.50);
+INSERT INTO events VALUES (16849, 3, 220.75);
+INSERT INTO events VALUES (16852, 4, 221.00);
+INSERT INTO events VALUES (16855, 5, 221.25);
+INSERT INTO events VALUES (16858, 6, 221.50);
+INSERT INTO events VALUES (16861, 7, 221.75);
+INSERT INTO events VALUES (16864, 8, 222.00);
+INSERT INTO events VALUES (16867, 9, 222.25);
+INSERT INTO events VALUES (16870, 10, 222.50);
+INSERT INTO events VALUES (16873, 11, 222.75);
+INSERT INTO events VALUES (16876, 12, 223.00);
+INSERT INTO events VALUES (16879, 13, 223.25);
+INSERT INTO events VALUES (16882, 14, 223.50);
+INSERT INTO events VALUES (16885, 15, 223.75);
+INSERT INTO events VALUES (16888, 0, 224.00);
+INSERT INTO events VALUES (16891, 1, 224.25);
+INSERT INTO events VALUES (16894, 2, 224.50);
+INSERT INTO events VALUES (16897, 3, 224.75);
+INSERT INTO events VALUES (16900, 4, 200.00);
+INSERT INTO events VALUES (16903, 5, 200.25);
+INSERT INTO events VALUES (16906, 6, 200.50);
+INSERT INTO events VALUES (16909, 7, 200.75);
+INSERT INTO events VALUES (16912, 8, 201.00);
+INSERT INTO events VALUES (16915, 9, 201.25);
+INSERT INTO events VALUES (16918, 10, 201.50);
+INSERT INTO events VALUES (16921, 11, 201.75);
+INSERT INTO events VALUES (16924, 12, 202.00);
+INSERT INTO events VALUES (16927, 13, 202.25);
+INSERT INTO events VALUES (16930, 14, 202.50);
+INSERT INTO events VALUES (16933, 15, 202.75);
+INSERT INTO events VALUES (16936, 0, 203.00);
+INSERT INTO events VALUES (16939, 1, 203.25);
+INSERT INTO events VALUES (16942, 2, 203.50);
+INSERT INTO events VALUES (16945, 3, 203.75);
+INSERT INTO events VALUES (16948, 4, 204.00);
+INSERT INTO events VALUES (16951, 5, 204.25);
+INSERT INTO events VALUES (16954, 6, 204.50);
+INSERT INTO events VALUES (16957, 7, 204.75);
+INSERT INTO events VALUES (16960, 8, 205.00);
+INSERT INTO events VALUES (16963, 9, 205.25);
+INSERT INTO events VALUES (16966, 10, 205.50);
+INSERT INTO events VALUES (16969, 11, 205.75);
+INSERT INTO events VALUES (16972, 12, 206.00);
+INSERT INTO events VALUES (16975, 13, 206.25);
+INSERT INTO events VALUES (16978, 14, 206.50);
+INSERT INTO events VALUES (16981, 15, 206.75);
+INSERT INTO events VALUES (16984, 0, 207.00);
+INSERT INTO events VALUES (16987, 1, 207.25);
+INSERT INTO events VALUES (16990, 2, 207.50);
+INSERT INTO events VALUES (16993, 3, 207.75);
+INSERT INTO events VALUES (16996, 4, 208.00);
+INSERT INTO events VALUES (16999, 5, 208.25);
+INSERT INTO events VALUES (17002, 6, 208.50);
+INSERT INTO events VALUES (17005, 7, 208.75);
+INSERT INTO events VALUES (17008, 8, 209.00);
+INSERT INTO events VALUES (17011, 9, 209.25);
+INSERT INTO events VALUES (17014, 10, 209.50);
+INSERT INTO events VALUES (17017, 11, 209.75);
+INSERT INTO events VALUES (17020, 12, 210.00);
+INSERT INTO events VALUES (17023, 13, 210.25);
+INSERT INTO events VALUES (17026, 14, 210.50);
+INSERT INTO events VALUES (17029, 15, 210.75);
+INSERT INTO events VALUES (17032, 0, 211.00);
+INSERT INTO events VALUES (17035, 1, 211.25);
+INSERT INTO events VALUES (17038, 2, 211.50);
+INSERT INTO events VALUES (17041, 3, 211.75);
+INSERT INTO events VALUES (17044, 4, 212.00);
+INSERT INTO events VALUES (17047, 5, 212.25);
+INSERT INTO events VALUES (17050, 6, 212.50);
+INSERT INTO events VALUES (17053, 7, 212.75);
+INSERT INTO events VALUES (17056, 8, 213.00);
+INSERT INTO events VALUES (17059, 9, 213.25);
+INSERT INTO events VALUES (17062, 10, 213.50);
+INSERT INTO events VALUES (17065, 11, 213.75);
+INSERT INTO events VALUES (17068, 12, 214.00);
+INSERT INTO events VALUES (17071, 13, 214.25);
+INSERT INTO events VALUES (17074, 14, 214.50);
+INSERT INTO events VALUES (17077, 15, 214.75);
+INSERT INTO events VALUES (17080, 0, 215.00);
+INSERT INTO events VALUES (17083, 1, 215.25);
+INSERT INTO events VALUES (17086, 2, 215.50);
+INSERT INTO events VALUES (17089, 3, 215.75);
+INSERT INTO events VALUES (17092, 4, 216.00);
+INSERT INTO events VALUES (17095, 5, 216.25);
+INSERT INTO events VALUES (17098, 6, 216.50);
+INSERT INTO events VALUES (17101, 7, 216.75);
+INSERT INTO events VALUES (17104, 8, 217.00);
+INSERT INTO events VALUES (17107, 9, 217.25);
+INSERT INTO events VALUES (17110, 10, 217.50);
+INSERT INTO events VALUES (17113, 11, 217.75);
+INSERT INTO events VALUES (17116, 12, 218.00);
+INSERT INTO events VALUES (17119, 13, 218.25);
+INSERT INTO events VALUES (17122, 14, 218.50);
+INSERT INTO events VALUES (17125, 15, 218.75);
+INSERT INTO events VALUES (17128, 0, 219.00);
+INSERT INTO events VALUES (17131, 1, 219.25);
+INSERT INTO events VALUES (17134, 2, 219.50);
+INSERT INTO events VALUES (17137, 3, 219.75);
+INSERT INTO events VALUES (17140, 4, 220.00);
+INSERT INTO events VALUES (17143, 5, 220.25);
+INSERT INTO events VALUES (17146, 6, 220.50);
+INSERT INTO events VALUES (17149, 7, 220.75);
+INSERT INTO events VALUES (17152, 8, 221.00);
+INSERT INTO events VALUES (17155, 9, 221.25);
+INSERT INTO events VALUES (17158, 10, 221.50);
+INSERT INTO events VALUES (17161, 11, 221.75);
+INSERT INTO events VALUES (17164, 12, 222.00);
+INSERT INTO events VALUES (17167, 13, 222.25);
+INSERT INTO events VALUES (17170, 14, 222.50);
+INSERT INTO events VALUES (17173, 15, 222.75);
+INSERT INTO events VALUES (17176, 0, 223.00);
+INSERT INTO events VALUES (17179, 1, 223.25);
+INSERT INTO events VALUES (17182, 2, 223.50);
+INSERT INTO events VALUES (17185, 3, 223.75);
+INSERT INTO events VALUES (17188, 4, 224.00);
+INSERT INTO events VALUES (17191, 5, 224.25);
+INSERT INTO events VALUES (17194, 6, 224.50);
+INSERT INTO events VALUES (17197, 7, 224.75);
+INSERT INTO events VALUES (17200, 8, 200.00);
+INSERT INTO events VALUES (17203, 9, 200.25);
+INSERT INTO events VALUES (17206, 10, 200.50);
+INSERT INTO events VALUES (17209, 11, 200.75);
+INSERT INTO events VALUES (17212, 12, 201.00);
+INSERT INTO events VALUES (17215, 13, 201.25);
+INSERT INTO events VALUES (17218, 14, 201.50);
+INSERT INTO events VALUES (17221, 15, 201.75);
+INSERT INTO events VALUES (17224, 0, 202.00);
+INSERT INTO events VALUES (17227, 1, 202.25);
+INSERT INTO events VALUES (17230, 2, 202.50);
+INSERT INTO events VALUES (17233, 3, 202.75);
+INSERT INTO events VALUES (17236, 4, 203.00);
+INSERT INTO events VALUES (17239, 5, 203.25);
+INSERT INTO events VALUES (17242, 6, 203.50);
+INSERT INTO events VALUES (17245, 7, 203.75);
+INSERT INTO events VALUES (17248, 8, 204.00);
+INSERT INTO events VALUES (17251, 9, 204.25);
+INSERT INTO events VALUES (17254, 10, 204.50);
+INSERT INTO events VALUES (17257, 11, 204.75);
+INSERT INTO events VALUES (17260, 12, 205.00);
+INSERT INTO events VALUES (17263, 13, 205.25);
+INSERT INTO events VALUES (17266, 14, 205.50);
+INSERT INTO events VALUES (17269, 15, 205.75);
+INSERT INTO events VALUES (17272, 0, 206.00);
+INSERT INTO events VALUES (17275, 1, 206.25);
+INSERT INTO events VALUES (17278, 2, 206.50);
+INSERT INTO events VALUES (17281, 3, 206.75);
+INSERT INTO events VALUES (17284, 4, 207.00);
+INSERT INTO events VALUES (17287, 5, 207.25);
+INSERT INTO events VALUES (17290, 6, 207.50);
+INSERT INTO events VALUES (17293, 7, 207.75);
+INSERT INTO events VALUES (17296, 8, 208.00);
+INSERT INTO events VALUES (17299, 9, 208.25);
+INSERT INTO events VALUES (17302, 10, 208.50);
+INSERT INTO events VALUES (17305, 11, 208.75);
+INSERT INTO events VALUES (17308, 12, 209.00);
+INSERT INTO events VALUES (17311, 13, 209.25);
+INSERT INTO events VALUES (17314, 14, 209.50);
+INSERT INTO events VALUES (17317, 15, 209.75);
+INSERT INTO events VALUES (17320, 0, 210.00);
+INSERT INTO events VALUES (17323, 1, 210.25);
+INSERT INTO events VALUES (17326, 2, 210.50);
+INSERT INTO events VALUES (17329, 3, 210.75);
+INSERT INTO events VALUES (17332, 4, 211.00);
+INSERT INTO events VALUES (17335, 5, 211.25);
+INSERT INTO events VALUES (17338, 6, 211.50);
+INSERT INTO events VALUES (17341, 7, 211.75);
+INSERT INTO events VALUES (17344, 8, 212.00);
+INSERT INTO events VALUES (17347, 9, 212.25);
+INSERT INTO events VALUES (17350, 10, 212.50);
+INSERT INTO events VALUES (17353, 11, 212.75);
+INSERT INTO events VALUES (17356, 12, 213.00);
+INSERT INTO events VALUES (17359, 13, 213.25);
+INSERT INTO events VALUES (17362, 14, 213.50);
+INSERT INTO events VALUES (17365, 15, 213.75);
+INSERT INTO events VALUES (17368, 0, 214.00);
+INSERT INTO events VALUES (17371, 1, 214.25);
+INSERT INTO events VALUES (17374, 2, 214.50);
+INSERT INTO events VALUES (17377, 3, 214.75);
+INSERT INTO events VALUES (17380, 4, 215.00);
+INSERT INTO events VALUES (17383, 5, 215.25);
+INSERT INTO events VALUES (17386, 6, 215.50);
+INSERT INTO events VALUES (17389, 7, 215.75);
+INSERT INTO events VALUES (17392, 8, 216.00);
+INSERT INTO events VALUES (17395, 9, 216.25);
+INSERT INTO events VALUES (17398, 10, 216.50);
+INSERT INTO events VALUES (17401, 11, 216.75);
+INSERT INTO events VALUES (17404, 12, 217.00);
+INSERT INTO events VALUES (17407, 13, 217.25);
+INSERT INTO events VALUES (17410, 14, 217.50);
+INSERT INTO events VALUES (17413, 15, 217.75);
+INSERT INTO events VALUES (17416, 0, 218.00);
+INSERT INTO events VALUES (17419, 1, 218.25);
+INSERT INTO events VALUES (17422, 2, 218.50);
+INSERT INTO events VALUES (17425, 3, 218.75);
+INSERT INTO events VALUES (17428, 4, 219.00);
+INSERT INTO events VALUES (17431, 5, 219.25);
+INSERT INTO events VALUES (17434, 6, 219.50);
+INSERT INTO events VALUES (17437, 7, 219.75);
+INSERT INTO events VALUES (17440, 8, 220.00);
+INSERT INTO events VALUES (17443, 9, 220.25);
+INSERT INTO events VALUES (17446, 10, 220.50);
+INSERT INTO events VALUES (17449, 11, 220.75);
+INSERT INTO events VALUES (17452, 12, 221.00);
+INSERT INTO events VALUES (17455, 13, 221.25);
+INSERT INTO events VALUES (17458, 14, 221.50);
+INSERT INTO events VALUES (17461, 15, 221.75);
+INSERT INTO events VALUES (17464, 0, 222.00);
+INSERT INTO events VALUES (17467, 1, 222.25);
+INSERT INTO events VALUES (17470, 2, 222.50);
+INSERT INTO events VALUES (17473, 3, 222.75);
+INSERT INTO events VALUES (17476, 4, 223.00);
+INSERT INTO events VALUES (17479, 5, 223.25);
+INSERT INTO events VALUES (17482, 6, 223.50);
+INSERT INTO events VALUES (17485, 7, 223.75);
+INSERT INTO events VALUES (17488, 8, 224.00);
+INSERT INTO events VALUES (17491, 9, 224.25);
+INSERT INTO events VALUES (17494, 10, 224.50);
+INSERT INTO events VALUES (17497, 11, 224.75);
+INSERT INTO events VALUES (17500, 12, 200.00);
+INSERT INTO events VALUES (17503, 13, 200.25);
+INSERT INTO events VALUES (17506, 14, 200.50);
+INSERT INTO events VALUES (17509, 15, 200.75);
+INSERT INTO events VALUES (17512, 0, 201.00);
+INSERT INTO events VALUES (17515, 1, 201.25);
+INSERT INTO events VALUES (17518, 2, 201.50);
+INSERT INTO events VALUES (17521, 3, 201.75);
+INSERT INTO events VALUES (17524, 4, 202.00);
+INSERT INTO events VALUES (17527, 5, 202.25);
+INSERT INTO events VALUES (17530, 6, 202.50);
+INSERT INTO events VALUES (17533, 7, 202.75);
+INSERT INTO events VALUES (17536, 8, 203.00);
+INSERT INTO events VALUES (17539, 9, 203.25);
+INSERT INTO events VALUES (17542, 10, 203.50);
+INSERT INTO events VALUES (17545, 11, 203.75);
+INSERT INTO events VALUES (17548, 12, 204.00);
+INSERT INTO events VALUES (17551, 13, 204.25);
+INSERT INTO events VALUES (17554, 14, 204.50);
+INSERT INTO events VALUES (17557, 15, 204.75);
+INSERT INTO events VALUES (17560, 0, 205.00);
+INSERT INTO events VALUES (17563, 1, 205.25);
+INSERT INTO events VALUES (17566, 2, 205.50);
+INSERT INTO events VALUES (17569, 3, 205.75);
+INSERT INTO events VALUES (17572, 4, 206.00);
+INSERT INTO events VALUES (17575, 5, 206.25);
+INSERT INTO events VALUES (17578, 6, 206.50);
+INSERT INTO events VALUES (17581, 7, 206.75);
+INSERT INTO events VALUES (17584, 8, 207.00);
+INSERT INTO events VALUES (17587, 9, 207.25);
+INSERT INTO events VALUES (17590, 10, 207.50);
+INSERT INTO events VALUES (17593, 11, 207.75);
+INSERT INTO events VALUES (17596, 12, 208.00);
+INSERT INTO events VALUES (17599, 13, 208.25);
+INSERT INTO events VALUES (17602, 14, 208.50);
+INSERT INTO events VALUES (17605, 15, 208.75);
+INSERT INTO events VALUES (17608, 0, 209.00);
+INSERT INTO events VALUES (17611, 1, 209.25);
+INSERT INTO events VALUES (17614, 2, 209.50);
+INSERT INTO events VALUES (17617, 3, 209.75);
+INSERT INTO events VALUES (17620, 4, 210.00);
+INSERT INTO events VALUES (17623, 5, 210.25);
+INSERT INTO events VALUES (17626, 6, 210.50);
+INSERT INTO events VALUES (17629, 7, 210.75);
+INSERT INTO events VALUES (17632, 8, 211.00);
+INSERT INTO events VALUES (17635, 9, 211.25);
+INSERT INTO events VALUES (17638, 10, 211.50);
+INSERT INTO events VALUES (17641, 11, 211.75);
+INSERT INTO events VALUES (17644, 12, 212.00);
+INSERT INTO events VALUES (17647, 13, 212.25);
+INSERT INTO events VALUES (17650, 14, 212.50);
+INSERT INTO events VALUES (17653, 15, 212.75);
+INSERT INTO events VALUES (17656, 0, 213.00);
+INSERT INTO events VALUES (17659, 1, 213.25);
+INSERT INTO events VALUES (17662, 2, 213.50);
+INSERT INTO events VALUES (17665, 3, 213.75);
+INSERT INTO events VALUES (17668, 4, 214.00);
+INSERT INTO events VALUES (17671, 5, 214.25);
+INSERT INTO events VALUES (17674, 6, 214.50);
+INSERT INTO events VALUES (17677, 7, 214.75);
+INSERT INTO events VALUES (17680, 8, 215.00);
+INSERT INTO events VALUES (17683, 9, 215.25);
+INSERT INTO events VALUES (17686, 10, 215.50);
+INSERT INTO events VALUES (17689, 11, 215.75);
+INSERT INTO events VALUES (17692, 12, 216.00);
+INSERT INTO events VALUES (17695, 13, 216.25);
+INSERT INTO events VALUES (17698, 14, 216.50);
+INSERT INTO events VALUES (17701, 15, 216.75);
+INSERT INTO events VALUES (17704, 0, 217.00);
+INSERT INTO events VALUES (17707, 1, 217.25);
+INSERT INTO events VALUES (17710, 2, 217.50);
+INSERT INTO events VALUES (17713, 3, 217.75);
+INSERT INTO events VALUES (17716, 4, 218.00);
+INSERT INTO events VALUES (17719, 5, 218.25);
+INSERT INTO events VALUES (17722, 6, 218.50);
+INSERT INTO events VALUES (17725, 7, 218.75);
+INSERT INTO events VALUES (17728, 8, 219.00);
+INSERT INTO events VALUES (17731, 9, 219.25);
+INSERT INTO events VALUES (17734, 10, 219.50);
+INSERT INTO events VALUES (17737, 11, 219.75);
+INSERT INTO events VALUES (17740, 12, 220.00);
+INSERT INTO events VALUES (17743, 13, 220.25);
+INSERT INTO events VALUES (17746, 14, 220.50);
+INSERT INTO events VALUES (17749, 15, 220.75);
+INSERT INTO events VALUES (17752, 0, 221.00);
+INSERT INTO events VALUES (17755, 1, 221.25);
+INSERT INTO events VALUES (17758, 2, 221.50);
+INSERT INTO events VALUES (17761, 3, 221.75);
+INSERT INTO events VALUES (17764, 4, 222.00);
+INSERT INTO events VALUES (17767, 5, 222.25);
+INSERT INTO events VALUES (17770, 6, 222.50);
+INSERT INTO events VALUES (17773, 7, 222.75);
+INSERT INTO events VALUES (17776, 8, 223.00);
+INSERT INTO events VALUES (17779, 9, 223.25);
+INSERT INTO events VALUES (17782, 10, 223.50);
+INSERT INTO events VALUES (17785, 11, 223.75);
+INSERT INTO events VALUES (17788, 12, 224.00);
+INSERT INTO events VALUES (17791, 13, 224.25);
+INSERT INTO events VALUES (17794, 14, 224.50);
+INSERT INTO events VALUES (17797, 15, 224.75);
+INSERT INTO events VALUES (17800, 0, 200.00);
+INSERT INTO events VALUES (17803, 1, 200.25);
+INSERT INTO events VALUES (17806, 2, 200.50);
+INSERT INTO events VALUES (17809, 3, 200.75);
+INSERT INTO events VALUES (17812, 4, 201.00);
+INSERT INTO events VALUES (17815, 5, 201.25);
+INSERT INTO events VALUES (17818, 6, 201.50);
+INSERT INTO events VALUES (17821, 7, 201.75);
+INSERT INTO events VALUES (17824, 8, 202.00);
+INSERT INTO events VALUES (17827, 9, 202.25);
+INSERT INTO events VALUES (17830, 10, 202.50);
+INSERT INTO events VALUES (17833, 11, 202.75);
+INSERT INTO events VALUES (17836, 12, 203.00);
+INSERT INTO events VALUES (17839, 13, 203.25);
+INSERT INTO events VALUES (17842, 14, 203.50);
+INSERT INTO events VALUES (17845, 15, 203.75);
+INSERT INTO events VALUES (17848, 0, 204.00);
+INSERT INTO events VALUES (17851, 1, 204.25);
+INSERT INTO events VALUES (17854, 2, 204.50);
+INSERT INTO events VALUES (17857, 3, 204.75);
+INSERT INTO events VALUES (17860, 4, 205.00);
+INSERT INTO events VALUES (17863, 5, 205.25);
+INSERT INTO events VALUES (17866, 6, 205.50);
+INSERT INTO events VALUES (17869, 7, 205.75);
+INSERT INTO events VALUES (17872, 8, 206.00);
+INSERT INTO events VALUES (17875, 9, 206.25);
+INSERT INTO events VALUES (17878, 10, 206.50);
+INSERT INTO events VALUES (17881, 11, 206.75);
+INSERT INTO events VALUES (17884, 12, 207.00);
+INSERT INTO events VALUES (17887, 13, 207.25);
+INSERT INTO events VALUES (17890, 14, 207.50);
+INSERT INTO events VALUES (17893, 15, 207.75);
+INSERT INTO events VALUES (17896, 0, 208.00);
+INSERT INTO events VALUES (17899, 1, 208.25);
+INSERT INTO events VALUES (17902, 2, 208.50);
+INSERT INTO events VALUES (17905, 3, 208.75);
+INSERT INTO events VALUES (17908, 4, 209.00);
+INSERT INTO events VALUES (17911, 5, 209.25);
+INSERT INTO events VALUES (17914, 6, 209.50);
+INSERT INTO events VALUES (17917, 7, 209.75);
+INSERT INTO events VALUES (17920, 8, 210.00);
+INSERT INTO events VALUES (17923, 9, 210.25);
+INSERT INTO events VALUES (17926, 10, 210.50);
+INSERT INTO events VALUES (17929, 11, 210.75);
+INSERT INTO events VALUES (17932, 12, 211.00);
+INSERT INTO events VALUES (17935, 13, 211.25);
+INSERT INTO events VALUES (17938, 14, 211.50);
+INSERT INTO events VALUES (17941, 15, 211.75);
+INSERT INTO events VALUES (17944, 0, 212.00);
+INSERT INTO events VALUES (17947, 1, 212.25);
+INSERT INTO events VALUES (17950, 2, 212.50);
+INSERT INTO events VALUES (17953, 3, 212.75);
+INSERT INTO events VALUES (17956, 4, 213.00);
+INSERT INTO events VALUES (17959, 5, 213.25);
+INSERT INTO events VALUES (17962, 6, 213.50);
+INSERT INTO events VALUES (17965, 7, 213.75);
+INSERT INTO events VALUES (17968, 8, 214.00);
+INSERT INTO events VALUES (17971, 9, 214.25);
+INSERT INTO events VALUES (17974, 10, 214.50);
+INSERT INTO events VALUES (17977, 11, 214.75);
+INSERT INTO events VALUES (17980, 12, 215.00);
+INSERT INTO events VALUES (17983, 13, 215.25);
+INSERT INTO events VALUES (17986, 14, 215.50);
+INSERT INTO events VALUES (17989, 15, 215.75);
+INSERT INTO events VALUES (17992, 0, 216.00);
+INSERT INTO events VALUES (17995, 1, 216.25);
+INSERT INTO events VALUES (17998, 2, 216.50);
+INSERT INTO events VALUES (18001, 3, 216.75);
+INSERT INTO events VALUES (18004, 4, 217.00);
+INSERT INTO events VALUES (18007, 5, 217.25);
+INSERT INTO events VALUES (18010, 6, 217.50);
+INSERT INTO events VALUES (18013, 7, 217.75);
+INSERT INTO events VALUES (18016, 8, 218.00);
+INSERT INTO events VALUES (18019, 9, 218.25);
+INSERT INTO events VALUES (18022, 10, 218.50);
+INSERT INTO events VALUES (18025, 11, 218.75);
+INSERT INTO events VALUES (18028, 12, 219.00);
+INSERT INTO events VALUES (18031, 13, 219.25);
+INSERT INTO events VALUES (18034, 14, 219.50);
+INSERT INTO events VALUES (18037, 15, 219.75);
+INSERT INTO events VALUES (18040, 0, 220.00);
+INSERT INTO events VALUES (18043, 1, 220.25);
+INSERT INTO events VALUES (18046, 2, 220.50);
+INSERT INTO events VALUES (18049, 3, 220.75);
+INSERT INTO events VALUES (18052, 4, 221.00);
+INSERT INTO events VALUES (18055, 5, 221.25);
+INSERT INTO events VALUES (18058, 6, 221.50);
+INSERT INTO events VALUES (18061, 7, 221.75);
+INSERT INTO events VALUES (18064, 8, 222.00);
+INSERT INTO events VALUES (18067, 9, 222.25);
+INSERT INTO events VALUES (18070, 10, 222.50);
+INSERT INTO events VALUES (18073, 11, 222.75);
+INSERT INTO events VALUES (18076, 12, 223.00);
+INSERT INTO events VALUES (18079, 13, 223.25);
+INSERT INTO events VALUES (18082, 14, 223.50);
+INSERT INTO events VALUES (18085, 15, 223.75);
+INSERT INTO events VALUES (18088, 0, 224.00);
+INSERT INTO events VALUES (18091, 1, 224.25);
+INSERT INTO events VALUES (18094, 2, 224.50);
+INSERT INTO events VALUES (18097, 3, 224.75);
+INSERT INTO events VALUES (18100, 4, 200.00);
+INSERT INTO events VALUES (18103, 5, 200.25);
+INSERT INTO events VALUES (18106, 6, 200.50);
+INSERT INTO events VALUES (18109, 7, 200.75);
+INSERT INTO events VALUES (18112, 8, 201.00);
+INSERT INTO events VALUES (18115, 9, 201.25);
+INSERT INTO events VALUES (18118, 10, 201.50);
+INSERT INTO events VALUES (18121, 11, 201.75);
+INSERT INTO events VALUES (18124, 12, 202.00);
+INSERT INTO events VALUES (18127, 13, 202.25);
+INSERT INTO events VALUES (18130, 14, 202.50);
+INSERT INTO events VALUES (18133, 15, 202.75);
+INSERT INTO events VALUES (18136, 0, 203.00);
+INSERT INTO events VALUES (18139, 1, 203.25);
+INSERT INTO events VALUES (18142, 2, 203.50);
+INSERT INTO events VALUES (18145, 3, 203.75);
+INSERT INTO events VALUES (18148, 4, 204.00);
+INSERT INTO events VALUES (18151, 5, 204.25);
+INSERT INTO events VALUES (18154, 6, 204.50);
+INSERT INTO events VALUES (18157, 7, 204.75);
+INSERT INTO events VALUES (18160, 8, 205.00);
+INSERT INTO events VALUES (18163, 9, 205.25);
+INSERT INTO events VALUES (18166, 10, 205.50);
+INSERT INTO events VALUES (18169, 11, 205.75);
+INSERT INTO events VALUES (18172, 12, 206.00);
+INSERT INTO events VALUES (18175, 13, 206.25);
+INSERT INTO events VALUES (18178, 14, 206.50);
+INSERT INTO events VALUES (18181, 15, 206.75);
+INSERT INTO events VALUES (18184, 0, 207.00);
+INSERT INTO events VALUES (18187, 1, 207.25);
+INSERT INTO events VALUES (18190, 2, 207.50);
+INSERT INTO events VALUES (18193, 3, 207.75);
+INSERT INTO events VALUES (18196, 4, 208.00);
+INSERT INTO events VALUES (18199, 5, 208.25);
+INSERT INTO events VALUES (18202, 6, 208.50);
+INSERT INTO events VALUES (18205, 7, 208.75);
+INSERT INTO events VALUES (18208, 8, 209.00);
+INSERT INTO events VALUES (18211, 9, 209.25);
+INSERT INTO events VALUES (18214, 10, 209.50);
+INSERT INTO events VALUES (18217, 11, 209.75);
+INSERT INTO events VALUES (18220, 12, 210.00);
+INSERT INTO events VALUES (18223, 13, 210.25);
+INSERT INTO events VALUES (18226, 14, 210.50);
+INSERT INTO events VALUES (18229, 15, 210.75);
+INSERT INTO events VALUES (18232, 0, 211.00);
+INSERT INTO events VALUES (18235, 1, 211.25);
+INSERT INTO events VALUES (18238, 2, 211.50);
+INSERT INTO events VALUES (18241, 3, 211.75);
+INSERT INTO events VALUES (18244, 4, 212.00);
+INSERT INTO events VALUES (18247, 5, 212.25);
+INSERT INTO events VALUES (18250, 6, 212.50);
+INSERT INTO events VALUES (18253, 7, 212.75);
+INSERT INTO events VALUES (18256, 8, 213.00);
+INSERT INTO events VALUES (18259, 9, 213.25);
+INSERT INTO events VALUES (18262, 10, 213.50);
+INSERT INTO events VALUES (18265, 11, 213.75);
+INSERT INTO events VALUES (18268, 12, 214.00);
+INSERT INTO events VALUES (18271, 13, 214.25);
+INSERT INTO events VALUES (18274, 14, 214.50);
+INSERT INTO events VALUES (18277, 15, 214.75);
+INSERT INTO events VALUES (18280, 0, 215.00);
+INSERT INTO events VALUES (18283, 1, 215.25);
+INSERT INTO events VALUES (18286, 2, 215.50);
+INSERT INTO events VALUES (18289, 3, 215.75);
+INSERT INTO events VALUES (18292, 4, 216.00);
+INSERT INTO events VALUES (18295, 5, 216.25);
+INSERT INTO events VALUES (18298, 6, 216.50);
+INSERT INTO events VALUES (18301, 7, 216.75);
+INSERT INTO events VALUES (18304, 8, 217.00);
+INSERT INTO events VALUES (18307, 9, 217.25);
+INSERT INTO events VALUES (18310, 10, 217.50);
+INSERT INTO events VALUES (18313, 11, 217.75);
+INSERT INTO events VALUES (18316, 12, 218.00);
+INSERT INTO events VALUES (18319, 13, 218.25);
+INSERT INTO events VALUES (18322, 14, 218.50);
+INSERT INTO events VALUES (18325, 15, 218.75);
+INSERT INTO events VALUES (18328, 0, 219.00);
+INSERT INTO events VALUES (18331, 1, 219.25);
+INSERT INTO events VALUES (18334, 2, 219.50);
+INSERT INTO events VALUES (18337, 3, 219.75);
+INSERT INTO events VALUES (18340, 4, 220.00);
+INSERT INTO events VALUES (18343, 5, 220.25);
+INSERT INTO events VALUES (18346, 6, 220.50);
+INSERT INTO events VALUES (18349, 7, 220.75);
+INSERT INTO events VALUES (18352, 8, 221.00);
+INSERT INTO events VALUES (18355, 9, 221.25);
+INSERT INTO events VALUES (18358, 10, 221.50);
+INSERT INTO events VALUES (18361, 11, 221.75);
+INSERT INTO events VALUES (18364, 12, 222.00);
+INSERT INTO events VALUES (18367, 13, 222.25);
+INSERT INTO events VALUES (18370, 14, 222.50);
+INSERT INTO events VALUES (18373, 15, 222.75);
+INSERT INTO events VALUES (18376, 0, 223.00);
+INSERT INTO events VALUES (18379, 1, 223.25);
+INSERT INTO events VALUES (18382, 2, 223.50);
+INSERT INTO events VALUES (18385, 3, 223.75);
+INSERT INTO events VALUES (18388, 4, 224.00);
+INSERT INTO events VALUES (18391, 5, 224.25);
+INSERT INTO events VALUES (18394, 6, 224.50);
+INSERT INTO events VALUES (18397, 7, 224.75);
+INSERT INTO events VALUES (18400, 8, 200.00);
+INSERT INTO events VALUES (18403, 9, 200.25);
+INSERT INTO events VALUES (18406, 10, 200.50);
+INSERT INTO events VALUES (18409, 11, 200.75);
+INSERT INTO events VALUES (18412, 12, 201.00);
+INSERT INTO events VALUES (18415, 13, 201.25);
+INSERT INTO events VALUES (18418, 14, 201.50);
+INSERT INTO events VALUES (18421, 15, 201.75);
+INSERT INTO events VALUES (18424, 0, 202.00);
+INSERT INTO events VALUES (18427, 1, 202.25);
+INSERT INTO events VALUES (18430, 2, 202.50);
+INSERT INTO events VALUES (18433, 3, 202.75);
+INSERT INTO events VALUES (18436, 4, 203.00);
+INSERT INTO events VALUES (18439, 5, 203.25);
+INSERT INTO events VALUES (18442, 6, 203.50);
+INSERT INTO events VALUES (18445, 7, 203.75);
+INSERT INTO events VALUES (18448, 8, 204.00);
+INSERT INTO events VALUES (18451, 9, 204.25);
+INSERT INTO events VALUES (18454, 10, 204.50);
+INSERT INTO events VALUES (18457, 11, 204.75);
+INSERT INTO events VALUES (18460, 12, 205.00);
+INSERT INTO events VALUES (18463, 13, 205.25);
+INSERT INTO events VALUES (18466, 14, 205.50);
+INSERT INTO events VALUES (18469, 15, 205.75);
+INSERT INTO events VALUES (18472, 0, 206.00);
+INSERT INTO events VALUES (18475, 1, 206.25);
+INSERT INTO events VALUES (18478, 2, 206.50);
+INSERT INTO events VALUES (18481, 3, 206.75);
+INSERT INTO events VALUES (18484, 4, 207.00);
+INSERT INTO events VALUES (18487, 5, 207.25);
+INSERT INTO events VALUES (18490, 6, 207.50);
+INSERT INTO events VALUES (18493, 7, 207.75);
+INSERT INTO events VALUES (18496, 8, 208.00);
+INSERT INTO events VALUES (18499, 9, 208.25);
+INSERT INTO events VALUES (18502, 10, 208.50);
+INSERT INTO events VALUES (18505, 11, 208.75);
+INSERT INTO events VALUES (18508, 12, 209.00);
+INSERT INTO events VALUES (18511, 13, 209.25);
+INSERT INTO events VALUES (18514, 14, 209.50);
+INSERT INTO events VALUES (18517, 15, 209.75);
+INSERT INTO events VALUES (18520, 0, 210.00);
+INSERT INTO events VALUES (18523, 1, 210.25);
+INSERT INTO events VALUES (18526, 2, 210.50);
+INSERT INTO events VALUES (18529, 3, 210.75);
+INSERT INTO events VALUES (18532, 4, 211.00);
+INSERT INTO events VALUES (18535, 5, 211.25);
+INSERT INTO events VALUES (18538, 6, 211.50);
+INSERT INTO events VALUES (18541, 7, 211.75);
+INSERT INTO events VALUES (18544, 8, 212.00);
+INSERT INTO events VALUES (18547, 9, 212.25);
+INSERT INTO events VALUES (18550, 10, 212.50);
+INSERT INTO events VALUES (18553, 11, 212.75);
+INSERT INTO events VALUES (18556, 12, 213.00);
+INSERT INTO events VALUES (18559, 13, 213.25);
+INSERT INTO events VALUES (18562, 14, 213.50);
+INSERT INTO events VALUES (18565, 15, 213.75);
+INSERT INTO events VALUES (18568, 0, 214.00);
+INSERT INTO events VALUES (18571, 1, 214.25);
+INSERT INTO events VALUES (18574, 2, 214.50);
+INSERT INTO events VALUES (18577, 3, 214.75);
+INSERT INTO events VALUES (18580, 4, 215.00);
+INSERT INTO events VALUES (18583, 5, 215.25);
+INSERT INTO events VALUES (18586, 6, 215.50);
+INSERT INTO events VALUES (18589, 7, 215.75);
+INSERT INTO events VALUES (18592, 8, 216.00);
+INSERT INTO events VALUES (18595, 9, 216.25);
+INSERT INTO events VALUES (18598, 10, 216.50);
+INSERT INTO events VALUES (18601, 11, 216.75);
+INSERT INTO events VALUES (18604, 12, 217.00);
+INSERT INTO events VALUES (18607, 13, 217.25);
+INSERT INTO events VALUES (18610, 14, 217.50);
+INSERT INTO events VALUES (18613, 15, 217.75);
+INSERT INTO events VALUES (18616, 0, 218.00);
+INSERT INTO events VALUES (18619, 1, 218.25);
+INSERT INTO events VALUES (18622, 2, 218.50);
+INSERT INTO events VALUES (18625, 3, 218.75);
+INSERT INTO events VALUES (18628, 4, 219.00);
+INSERT INTO events VALUES (18631, 5, 219.25);
+INSERT INTO events VALUES (18634, 6, 219.50);
+INSERT INTO events VALUES (18637, 7, 219.75);
+INSERT INTO events VALUES (18640, 8, 220.00);
+INSERT INTO events VALUES (18643, 9, 220.25);
+INSERT INTO events VALUES (18646, 10, 220.50);
+INSERT INTO events VALUES (18649, 11, 220.75);
+INSERT INTO events VALUES (18652, 12, 221.00);
+INSERT INTO events VALUES (18655, 13, 221.25);
+INSERT INTO events VALUES (18658, 14, 221.50);
+INSERT INTO events VALUES (18661, 15, 221.75);
+INSERT INTO events VALUES (18664, 0, 222.00);
+INSERT INTO events VALUES (18667, 1, 222.25);
+INSERT INTO events VALUES (18670, 2, 222.50);
+INSERT INTO events VALUES (18673, 3, 222.75);
+INSERT INTO events VALUES (18676, 4, 223.00);
+INSERT INTO events VALUES (18679, 5, 223.25);
+INSERT INTO events VALUES (18682, 6, 223.50);
+INSERT INTO events VALUES (18685, 7, 223.75);
+INSERT INTO events VALUES (18688, 8, 224.00);
+INSERT INTO events VALUES (18691, 9, 224.25);
+INSERT INTO events VALUES (18694, 10, 224.50);
+INSERT INTO events VALUES (18697, 11, 224.75);
+INSERT INTO events VALUES (18700, 12, 200.00);
+INSERT INTO events VALUES (18703, 13, 200.25);
+INSERT INTO events VALUES (18706, 14, 200.50);
+INSERT INTO events VALUES (18709, 15, 200.75);
+INSERT INTO events VALUES (18712, 0, 201.00);
+INSERT INTO events VALUES (18715, 1, 201.25);
+INSERT INTO events VALUES (18718, 2, 201.50);
+INSERT INTO events VALUES (18721, 3, 201.75);
+INSERT INTO events VALUES (18724, 4, 202.00);
+INSERT INTO events VALUES (18727, 5, 202.25);
+INSERT INTO events VALUES (18730, 6, 202.50);
+INSERT INTO events VALUES (18733, 7, 202.75);
+INSERT INTO events VALUES (18736, 8, 203.00);
+INSERT INTO events VALUES (18739, 9, 203.25);
+INSERT INTO events VALUES (18742, 10, 203.50);
+INSERT INTO events VALUES (18745, 11, 203.75);
+INSERT INTO events VALUES (18748, 12, 204.00);
+INSERT INTO events VALUES (18751, 13, 204.25);
+INSERT INTO events VALUES (18754, 14, 204.50);
+INSERT INTO events VALUES (18757, 15, 204.75);
+INSERT INTO events VALUES (18760, 0, 205.00);
+INSERT INTO events VALUES (18763, 1, 205.25);
+INSERT INTO events VALUES (18766, 2, 205.50);
+INSERT INTO events VALUES (18769, 3, 205.75);
+INSERT INTO events VALUES (18772, 4, 206.00);
+INSERT INTO events VALUES (18775, 5, 206.25);
+INSERT INTO events VALUES (18778, 6, 206.50);
+INSERT INTO events VALUES (18781, 7, 206.75);
+INSERT INTO events VALUES (18784, 8, 207.00);
+INSERT INTO events VALUES (18787, 9, 207.25);
+INSERT INTO events VALUES (18790, 10, 207.50);
+INSERT INTO events VALUES (18793, 11, 207.75);
+INSERT INTO events VALUES (18796, 12, 208.00);
+INSERT INTO events VALUES (18799, 13, 208.25);
+INSERT INTO events VALUES (18802, 14, 208.50);
+INSERT INTO events VALUES (18805, 15, 208.75);
+INSERT INTO events VALUES (18808, 0, 209.00);
+INSERT INTO events VALUES (18811, 1, 209.25);
+INSERT INTO events VALUES (18814, 2, 209.50);
+INSERT INTO events VALUES (18817, 3, 209.75);
+INSERT INTO events VALUES (18820, 4, 210.00);
+INSERT INTO events VALUES (18823, 5, 210.25);
+INSERT INTO events VALUES (18826, 6, 210.50);
+INSERT INTO events VALUES (18829, 7, 210.75);
+INSERT INTO events VALUES (18832, 8, 211.00);
+INSERT INTO events VALUES (18835, 9, 211.25);
+INSERT INTO events VALUES (18838, 10, 211.50);
+INSERT INTO events VALUES (18841, 11, 211.75);
+INSERT INTO events VALUES (18844, 12, 212.00);
+INSERT INTO events VALUES (18847, 13, 212.25);
+INSERT INTO events VALUES (18850, 14, 212.50);
+INSERT INTO events VALUES (18853, 15, 212.75);
+INSERT INTO events VALUES (18856, 0, 213.00);
+INSERT INTO events VALUES (18859, 1, 213.25);
+INSERT INTO events VALUES (18862, 2, 213.50);
+INSERT INTO events VALUES (18865, 3, 213.75);
+INSERT INTO events VALUES (18868, 4, 214.00);
+INSERT INTO events VALUES (18871, 5, 214.25);
+INSERT INTO events VALUES (18874, 6, 214.50);
+INSERT INTO events VALUES (18877, 7, 214.75);
+INSERT INTO events VALUES (18880, 8, 215.00);
+INSERT INTO events VALUES (18883, 9, 215.25);
+INSERT INTO events VALUES (18886, 10, 215.50);
+INSERT INTO events VALUES (18889, 11, 215.75);
+INSERT INTO events VALUES (18892, 12, 216.00);
+INSERT INTO events VALUES (18895, 13, 216.25);
+INSERT INTO events VALUES (18898, 14, 216.50);
+INSERT INTO events VALUES (18901, 15, 216.75);
+INSERT INTO events VALUES (18904, 0, 217.00);
+INSERT INTO events VALUES (18907, 1, 217.25);
+INSERT INTO events VALUES (18910, 2, 217.50);
+INSERT INTO events VALUES (18913, 3, 217.75);
+INSERT INTO events VALUES (18916, 4, 218.00);
+INSERT INTO events VALUES (18919, 5, 218.25);
+INSERT INTO events VALUES (18922, 6, 218.50);
+INSERT INTO events VALUES (18925, 7, 218.75);
+INSERT INTO events VALUES (18928, 8, 219.00);
+INSERT INTO events VALUES (18931, 9, 219.25);
+INSERT INTO events VALUES (18934, 10, 219.50);
+INSERT INTO events VALUES (18937, 11, 219.75);
+INSERT INTO events VALUES (18940, 12, 220.00);
+INSERT INTO events VALUES (18943, 13, 220.25);
+INSERT INTO events VALUES (18946, 14, 220.50);
+INSERT INTO events VALUES (18949, 15, 220.75);
+INSERT INTO events VALUES (18952, 0, 221.00);
+INSERT INTO events VALUES (18955, 1, 221.25);
+INSERT INTO events VALUES (18958, 2, 221.50);
+INSERT INTO events VALUES (18961, 3, 221.75);
+INSERT INTO events VALUES (18964, 4, 222.00);
+INSERT INTO events VALUES (18967, 5, 222.25);
+INSERT INTO events VALUES (18970, 6, 222.50);
+INSERT INTO events VALUES (18973, 7, 222.75);
+INSERT INTO events VALUES (18976, 8, 223.00);
+INSERT INTO events VALUES (18979, 9, 223.25);
+INSERT INTO events VALUES (18982, 10, 223.50);
+INSERT INTO events VALUES (18985, 11, 223.75);
+INSERT INTO events VALUES (18988, 12, 224.00);
+INSERT INTO events VALUES (18991, 13, 224.25);
+INSERT INTO events VALUES (18994, 14, 224.50);
+INSERT INTO events VALUES (18997, 15, 224.75);
+INSERT INTO events VALUES (19000, 0, 200.00);
+INSERT INTO events VALUES (19003, 1, 200.25);
+INSERT INTO events VALUES (19006, 2, 200.50);
+INSERT INTO events VALUES (19009, 3, 200.75);
+INSERT INTO events VALUES (19012, 4, 201.00);
+INSERT INTO events VALUES (19015, 5, 201.25);
+INSERT INTO events VALUES (19018, 6, 201.50);
+INSERT INTO events VALUES (19021, 7, 201.75);
+INSERT INTO events VALUES (19024, 8, 202.00);
+INSERT INTO events VALUES (19027, 9, 202.25);
+INSERT INTO events VALUES (19030, 10, 202.50);
+INSERT INTO events VALUES (19033, 11, 202.75);
+INSERT INTO events VALUES (19036, 12, 203.00);
+INSERT INTO events VALUES (19039, 13, 203.25);
+INSERT INTO events VALUES (19042, 14, 203.50);
+INSERT INTO events VALUES (19045, 15, 203.75);
+INSERT INTO events VALUES (19048, 0, 204.00);
+INSERT INTO events VALUES (19051, 1, 204.25);
+INSERT INTO events VALUES (19054, 2, 204.50);
+INSERT INTO events VALUES (19057, 3, 204.75);
+INSERT INTO events VALUES (19060, 4, 205.00);
+INSERT INTO events VALUES (19063, 5, 205.25);
+INSERT INTO events VALUES (19066, 6, 205.50);
+INSERT INTO events VALUES (19069, 7, 205.75);
+INSERT INTO events VALUES (19072, 8, 206.00);
+INSERT INTO events VALUES (19075, 9, 206.25);
+INSERT INTO events VALUES (19078, 10, 206.50);
+INSERT INTO events VALUES (19081, 11, 206.75);
+INSERT INTO events VALUES (19084, 12, 207.00);
+INSERT INTO events VALUES (19087, 13, 207.25);
+INSERT INTO events VALUES (19090, 14, 207.50);
+INSERT INTO events VALUES (19093, 15, 207.75);
+INSERT INTO events VALUES (19096, 0, 208.00);
+INSERT INTO events VALUES (19099, 1, 208.25);
+INSERT INTO events VALUES (19102, 2, 208.50);
+INSERT INTO events VALUES (19105, 3, 208.75);
+INSERT INTO events VALUES (19108, 4, 209.00);
+INSERT INTO events VALUES (19111, 5, 209.25);
+INSERT INTO events VALUES (19114, 6, 209.50);
+INSERT INTO events VALUES (19117, 7, 209.75);
+INSERT INTO events VALUES (19120, 8, 210.00);
+INSERT INTO events VALUES (19123, 9, 210.25);
+INSERT INTO events VALUES (19126, 10, 210.50);
+INSERT INTO events VALUES (19129, 11, 210.75);
+INSERT INTO events VALUES (19132, 12, 211.00);
+INSERT INTO events VALUES (19135, 13, 211.25);
+INSERT INTO events VALUES (19138, 14, 211.50);
+INSERT INTO events VALUES (19141, 15, 211.75);
+INSERT INTO events VALUES (19144, 0, 212.00);
+INSERT INTO events VALUES (19147, 1, 212.25);
+INSERT INTO events VALUES (19150, 2, 212.50);
+INSERT INTO events VALUES (19153, 3, 212.75);
+INSERT INTO events VALUES (19156, 4, 213.00);
+INSERT INTO events VALUES (19159, 5, 213.25);
+INSERT INTO events VALUES (19162, 6, 213.50);
+INSERT INTO events VALUES (19165, 7, 213.75);
+INSERT INTO events VALUES (19168, 8, 214.00);
+INSERT INTO events VALUES (19171, 9, 214.25);
+INSERT INTO events VALUES (19174, 10, 214.50);
+INSERT INTO events VALUES (19177, 11, 214.75);
+INSERT INTO events VALUES (19180, 12, 215.00);
+INSERT INTO events VALUES (19183, 13, 215.25);
+INSERT INTO events VALUES (19186, 14, 215.50);
+INSERT INTO events VALUES (19189, 15, 215.75);
+INSERT INTO events VALUES (19192, 0, 216.00);
+INSERT INTO events VALUES (19195, 1, 216.25);
+INSERT INTO events VALUES (19198, 2, 216.50);
+INSERT INTO events VALUES (19201, 3, 216.75);
+INSERT INTO events VALUES (19204, 4, 217.00);
+INSERT INTO events VALUES (19207, 5, 217.25);
+INSERT INTO events VALUES (19210, 6, 217.50);
+INSERT INTO events VALUES (19213, 7, 217.75);
+INSERT INTO events VALUES (19216, 8, 218.00);
+INSERT INTO events VALUES (19219, 9, 218.25);
+INSERT INTO events VALUES (19222, 10, 218.50);
+INSERT INTO events VALUES (19225, 11, 218.75);
+INSERT INTO events VALUES (19228, 12, 219.00);
+INSERT INTO events VALUES (19231, 13, 219.25);
+INSERT INTO events VALUES (19234, 14, 219.50);
+INSERT INTO events VALUES (19237, 15, 219.75);
+INSERT INTO events VALUES (19240, 0, 220.00);
+INSERT INTO events VALUES (19243, 1, 220.25);
+INSERT INTO events VALUES (19246, 2, 220.50);
+INSERT INTO events VALUES (19249, 3, 220.75);
+INSERT INTO events VALUES (19252, 4, 221.00);
+INSERT INTO events VALUES (19255, 5, 221.25);
+INSERT INTO events VALUES (19258, 6, 221.50);
+INSERT INTO events VALUES (19261, 7, 221.75);
+INSERT INTO events VALUES (19264, 8, 222.00);
+INSERT INTO events VALUES (19267, 9, 222.25);
+INSERT INTO events VALUES (19270, 10, 222.50);
+INSERT INTO events VALUES (19273, 11, 222.75);
+INSERT INTO events VALUES (19276, 12, 223.00);
+INSERT INTO events VALUES (19279, 13, 223.25);
+INSERT INTO events VALUES (19282, 14, 223.50);
+INSERT INTO events VALUES (19285, 15, 223.75);
+INSERT INTO events VALUES (19288, 0, 224.00);
+INSERT INTO events VALUES (19291, 1, 224.25);
+INSERT INTO events VALUES (19294, 2, 224.50);
+INSERT INTO events VALUES (19297, 3, 224.75);
+INSERT INTO events VALUES (19300, 4, 200.00);
+INSERT INTO events VALUES (19303, 5, 200.25);
+INSERT INTO events VALUES (19306, 6, 200.50);
+INSERT INTO events VALUES (19309, 7, 200.75);
+INSERT INTO events VALUES (19312, 8, 201.00);
+INSERT INTO events VALUES (19315, 9, 201.25);
+INSERT INTO events VALUES (19318, 10, 201.50);
+INSERT INTO events VALUES (19321, 11, 201.75);
+INSERT INTO events VALUES (19324, 12, 202.00);
+INSERT INTO events VALUES (19327, 13, 202.25);
+INSERT INTO events VALUES (19330, 14, 202.50);
+INSERT INTO events VALUES (19333, 15, 202.75);
+INSERT INTO events VALUES (19336, 0, 203.00);
+INSERT INTO events VALUES (19339, 1, 203.25);
+INSERT INTO events VALUES (19342, 2, 203.50);
+INSERT INTO events VALUES (19345, 3, 203.75);
+INSERT INTO events VALUES (19348, 4, 204.00);
+INSERT INTO events VALUES (19351, 5, 204.25);
+INSERT INTO events VALUES (19354, 6, 204.50);
+INSERT INTO events VALUES (19357, 7, 204.75);
+INSERT INTO events VALUES (19360, 8, 205.00);
+INSERT INTO events VALUES (19363, 9, 205.25);
+INSERT INTO events VALUES (19366, 10, 205.50);
+INSERT INTO events VALUES (19369, 11, 205.75);
+INSERT INTO events VALUES (19372, 12, 206.00);
+INSERT INTO events VALUES (19375, 13, 206.25);
+INSERT INTO events VALUES (19378, 14, 206.50);
+INSERT INTO events VALUES (19381, 15, 206.75);
+INSERT INTO events VALUES (19384, 0, 207.00);
+INSERT INTO events VALUES (19387, 1, 207.25);
+INSERT INTO events VALUES (19390, 2, 207.50);
+INSERT INTO events VALUES (19393, 3, 207.75);
+INSERT INTO events VALUES (19396, 4, 208.00);
+INSERT INTO events VALUES (19399, 5, 208.25);
+INSERT INTO events VALUES (19402, 6, 208.50);
+INSERT INTO events VALUES (19405, 7, 208.75);
+INSERT INTO events VALUES (19408, 8, 209.00);
+INSERT INTO events VALUES (19411, 9, 209.25);
+INSERT INTO events VALUES (19414, 10, 209.50);
+INSERT INTO events VALUES (19417, 11, 209.75);
+INSERT INTO events VALUES (19420, 12, 210.00);
+INSERT INTO events VALUES (19423, 13, 210.25);
+INSERT INTO events VALUES (19426, 14, 210.50);
+INSERT INTO events VALUES (19429, 15, 210.75);
+INSERT INTO events VALUES (19432, 0, 311.00);
+INSERT INTO events VALUES (19435, 1, 311.25);
+INSERT INTO events VALUES (19438, 2, 311.50);
+INSERT INTO events VALUES (19441, 3, 311.75);
+INSERT INTO events VALUES (19444, 4, 312.00);
+INSERT INTO events VALUES (19447, 5, 312.25);
+INSERT INTO events VALUES (19450, 6, 312.50);
+INSERT INTO events VALUES (19453, 7, 312.75);
+INSERT INTO events VALUES (19456, 8, 313.00);
+INSERT INTO events VALUES (19459, 9, 313.25);
+INSERT INTO events VALUES (19462, 10, 313.50);
+INSERT INTO events VALUES (19465, 11, 313.75);
+INSERT INTO events VALUES (19468, 12, 314.00);
+INSERT INTO events VALUES (19471, 13, 314.25);
+INSERT INTO events VALUES (19474, 14, 314.50);
+INSERT INTO events VALUES (19477, 15, 314.75);
+INSERT INTO events VALUES (19480, 0, 315.00);
+INSERT INTO events VALUES (19483, 1, 315.25);
+INSERT INTO events VALUES (19486, 2, 315.50);
+INSERT INTO events VALUES (19489, 3, 315.75);
+INSERT INTO events VALUES (19492, 4, 316.00);
+INSERT INTO events VALUES (19495, 5, 316.25);
+INSERT INTO events VALUES (19498, 6, 316.50);
+INSERT INTO events VALUES (19501, 7, 316.75);
+INSERT INTO events VALUES (19504, 8, 317.00);
+INSERT INTO events VALUES (19507, 9, 317.25);
+INSERT INTO events VALUES (19510, 10, 317.50);
+INSERT INTO events VALUES (19513, 11, 317.75);
+INSERT INTO events VALUES (19516, 12, 318.00);
+INSERT INTO events VALUES (19519, 13, 318.25);
+INSERT INTO events VALUES (19522, 14, 318.50);
+INSERT INTO events VALUES (19525, 15, 318.75);
+INSERT INTO events VALUES (19528, 0, 319.00);
+INSERT INTO events VALUES (19531, 1, 319.25);
+INSERT INTO events VALUES (19534, 2, 319.50);
+INSERT INTO events VALUES (19537, 3, 319.75);
+INSERT INTO events VALUES (19540, 4, 320.00);
+INSERT INTO events VALUES (19543, 5, 320.25);
+INSERT INTO events VALUES (19546, 6, 320.50);
+INSERT INTO events VALUES (19549, 7, 320.75);
+INSERT INTO events VALUES (19552, 8, 321.00);
+INSERT INTO events VALUES (19555, 9, 321.25);
+INSERT INTO events VALUES (19558, 10, 321.50);
+INSERT INTO events VALUES (19561, 11, 321.75);
+INSERT INTO events VALUES (19564, 12, 322.00);
+INSERT INTO events VALUES (19567, 13, 322.25);
+INSERT INTO events VALUES (19570, 14, 322.50);
+INSERT INTO events VALUES (19573, 15, 322.75);
+INSERT INTO events VALUES (19576, 0, 323.00);
+INSERT INTO events VALUES (19579, 1, 323.25);
+INSERT INTO events VALUES (19582, 2, 323.50);
+INSERT INTO events VALUES (19585, 3, 323.75);
+INSERT INTO events VALUES (19588, 4, 324.00);
+INSERT INTO events VALUES (19591, 5, 324.25);
+INSERT INTO events VALUES (19594, 6, 324.50);
+INSERT INTO events VALUES (19597, 7, 324.75);
+INSERT INTO events VALUES (19600, 8, 300.00);
+INSERT INTO events VALUES (19603, 9, 300.25);
+INSERT INTO events VALUES (19606, 10, 300.50);
+INSERT INTO events VALUES (19609, 11, 300.75);
+INSERT INTO events VALUES (19612, 12, 301.00);
+INSERT INTO events VALUES (19615, 13, 301.25);
+INSERT INTO events VALUES (19618, 14, 301.50);
+INSERT INTO events VALUES (19621, 15, 301.75);
+INSERT INTO events VALUES (19624, 0, 302.00);
+INSERT INTO events VALUES (19627, 1, 302.25);
+INSERT INTO events VALUES (19630, 2, 302.50);
+INSERT INTO events VALUES (19633, 3, 302.75);
+INSERT INTO events VALUES (19636, 4, 303.00);
+INSERT INTO events VALUES (19639, 5, 303.25);
+INSERT INTO events VALUES (19642, 6, 303.50);
+INSERT INTO events VALUES (19645, 7, 303.75);
+INSERT INTO events VALUES (19648, 8, 304.00);
+INSERT INTO events VALUES (19651, 9, 304.25);
+INSERT INTO events VALUES (19654, 10, 304.50);
+INSERT INTO events VALUES (19657, 11, 304.75);
+INSERT INTO events VALUES (19660, 12, 305.00);
+INSERT INTO events VALUES (19663, 13, 305.25);
+INSERT INTO events VALUES (19666, 14, 305.50);
+INSERT INTO events VALUES (19669, 15, 305.75);
+INSERT INTO events VALUES (19672, 0, 306.00);
+INSERT INTO events VALUES (19675, 1, 306.25);
+INSERT INTO events VALUES (19678, 2, 306.50);
+INSERT INTO events VALUES (19681, 3, 306.75);
+INSERT INTO events VALUES (19684, 4, 307.00);
+INSERT INTO events VALUES (19687, 5, 307.25);
+INSERT INTO events VALUES (19690, 6, 307.50);
+INSERT INTO events VALUES (19693, 7, 307.75);
+INSERT INTO events VALUES (19696, 8, 308.00);
+INSERT INTO events VALUES (19699, 9, 308.25);
+INSERT INTO events VALUES (19702, 10, 308.50);
+INSERT INTO events VALUES (19705, 11, 308.75);
+INSERT INTO events VALUES (19708, 12, 309.00);
+INSERT INTO events VALUES (19711, 13, 309.25);
+INSERT INTO events VALUES (19714, 14, 309.50);
+INSERT INTO events VALUES (19717, 15, 309.75);
+INSERT INTO events VALUES (19720, 0, 310.00);
+INSERT INTO events VALUES (19723, 1, 310.25);
+INSERT INTO events VALUES (19726, 2, 310.50);
+INSERT INTO events VALUES (19729, 3, 310.75);
+INSERT INTO events VALUES (19732, 4, 311.00);
+INSERT INTO events VALUES (19735, 5, 311.25);
+INSERT INTO events VALUES (19738, 6, 311.50);
+INSERT INTO events VALUES (19741, 7, 311.75);
+INSERT INTO events VALUES (19744, 8, 312.00);
+INSERT INTO events VALUES (19747, 9, 312.25);
+INSERT INTO events VALUES (19750, 10, 312.50);
+INSERT INTO events VALUES (19753, 11, 312.75);
+INSERT INTO events VALUES (19756, 12, 313.00);
+INSERT INTO events VALUES (19759, 13, 313.25);
+INSERT INTO events VALUES (19762, 14, 313.50);
+INSERT INTO events VALUES (19765, 15, 313.75);
+INSERT INTO events VALUES (19768, 0, 314.00);
+INSERT INTO events VALUES (19771, 1, 314.25);
+INSERT INTO events VALUES (19774, 2, 314.50);
+INSERT INTO events VALUES (19777, 3, 314.75);
+INSERT INTO events VALUES (19780, 4, 315.00);
+INSERT INTO events VALUES (19783, 5, 315.25);
+INSERT INTO events VALUES (19786, 6, 315.50);
+INSERT INTO events VALUES (19789, 7, 315.75);
+INSERT INTO events VALUES (19792, 8, 316.00);
+INSERT INTO events VALUES (19795, 9, 316.25);
+INSERT INTO events VALUES (19798, 10, 316.50);
+INSERT INTO events VALUES (19801, 11, 316.75);
+INSERT INTO events VALUES (19804, 12, 317.00);
+INSERT INTO events VALUES (19807, 13, 317.25);
+INSERT INTO events VALUES (19810, 14, 317.50);
+INSERT INTO events VALUES (19813, 15, 317.75);
+INSERT INTO events VALUES (19816, 0, 318.00);
+INSERT INTO events VALUES (19819, 1, 318.25);
+INSERT INTO events VALUES (19822, 2, 318.50);
+INSERT INTO events VALUES (19825, 3, 318.75);
+INSERT INTO events VALUES (19828, 4, 319.00);
+INSERT INTO events VALUES (19831, 5, 319.25);
+INSERT INTO events VALUES (19834, 6, 319.50);
+INSERT INTO events VALUES (19837, 7, 319.75);
+INSERT INTO events VALUES (19840, 8, 320.00);
+INSERT INTO events VALUES (19843, 9, 320.25);
+INSERT INTO events VALUES (19846, 10, 320.50);
+INSERT INTO events VALUES (19849, 11, 320.75);
+INSERT INTO events VALUES (19852, 12, 321.00);
+INSERT INTO events VALUES (19855, 13, 321.25);
+INSERT INTO events VALUES (19858, 14, 321.50);
+INSERT INTO events VALUES (19861, 15, 321.75);
+INSERT INTO events VALUES (19864, 0, 322.00);
+INSERT INTO events VALUES (19867, 1, 322.25);
+INSERT INTO events VALUES (19870, 2, 322.50);
+INSERT INTO events VALUES (19873, 3, 322.75);
+INSERT INTO events VALUES (19876, 4, 323.00);
+INSERT INTO events VALUES (19879, 5, 323.25);
+INSERT INTO events VALUES (19882, 6, 323.50);
+INSERT INTO events VALUES (19885, 7, 323.75);
+INSERT INTO events VALUES (19888, 8, 324.00);
+INSERT INTO events VALUES (19891, 9, 324.25);
+INSERT INTO events VALUES (19894, 10, 324.50);
+INSERT INTO events VALUES (19897, 11, 324.75);
+INSERT INTO events VALUES (19900, 12, 300.00);
+INSERT INTO events VALUES (19903, 13, 300.25);
+INSERT INTO events VALUES (19906, 14, 300.50);
+INSERT INTO events VALUES (19909, 15, 300.75);
+INSERT INTO events VALUES (19912, 0, 301.00);
+INSERT INTO events VALUES (19915, 1, 301.25);
+INSERT INTO events VALUES (19918, 2, 301.50);
+INSERT INTO events VALUES (19921, 3, 301.75);
+INSERT INTO events VALUES (19924, 4, 302.00);
+INSERT INTO events VALUES (19927, 5, 302.25);
+INSERT INTO events VALUES (19930, 6, 302.50);
+INSERT INTO events VALUES (19933, 7, 302.75);
+INSERT INTO events VALUES (19936, 8, 303.00);
+INSERT INTO events VALUES (19939, 9, 303.25);
+INSERT INTO events VALUES (19942, 10, 303.50);
+INSERT INTO events VALUES (19945, 11, 303.75);
+INSERT INTO events VALUES (19948, 12, 304.00);
+INSERT INTO events VALUES (19951, 13, 304.25);
+INSERT INTO events VALUES (19954, 14, 304.50);
+INSERT INTO events VALUES (19957, 15, 304.75);
+INSERT INTO events VALUES (19960, 0, 305.00);
+INSERT INTO events VALUES (19963, 1, 305.25);
+INSERT INTO events VALUES (19966, 2, 305.50);
+INSERT INTO events VALUES (19969, 3, 305.75);
+INSERT INTO events VALUES (19972, 4, 306.00);
+INSERT INTO events VALUES (19975, 5, 306.25);
+INSERT INTO events VALUES (19978, 6, 306.50);
+INSERT INTO events VALUES (19981, 7, 306.75);
+INSERT INTO events VALUES (19984, 8, 307.00);
+INSERT INTO events VALUES (19987, 9, 307.25);
+INSERT INTO events VALUES (19990, 10, 307.50);
+INSERT INTO events VALUES (19993, 11, 307.75);
+INSERT INTO events VALUES (19996, 12, 308.00);
+INSERT INTO events VALUES (19999, 13, 308.25);
+INSERT INTO events VALUES (20002, 14, 308.50);
+INSERT INTO events VALUES (20005, 15, 308.75);
+INSERT INTO events VALUES (20008, 0, 309.00);
+INSERT INTO events VALUES (20011, 1, 309.25);
+INSERT INTO events VALUES (20014, 2, 309.50);
+INSERT INTO events VALUES (20017, 3, 309.75);
+INSERT INTO events VALUES (20020, 4, 310.00);
+INSERT INTO events VALUES (20023, 5, 310.25);
+INSERT INTO events VALUES (20026, 6, 310.50);
+INSERT INTO events VALUES (20029, 7, 310.75);
+INSERT INTO events VALUES (20032, 8, 311.00);
+INSERT INTO events VALUES (20035, 9, 311.25);
+INSERT INTO events VALUES (20038, 10, 311.50);
+INSERT INTO events VALUES (20041, 11, 311.75);
+INSERT INTO events VALUES (20044, 12, 312.00);
+INSERT INTO events VALUES (20047, 13, 312.25);
+INSERT INTO events VALUES (20050, 14, 312.50);
+INSERT INTO events VALUES (20053, 15, 312.75);
+INSERT INTO events VALUES (20056, 0, 313.00);
+INSERT INTO events VALUES (20059, 1, 313.25);
+INSERT INTO events VALUES (20062, 2, 313.50);
+INSERT INTO events VALUES (20065, 3, 313.75);
+INSERT INTO events VALUES (20068, 4, 314.00);
+INSERT INTO events VALUES (20071, 5, 314.25);
+INSERT INTO events VALUES (20074, 6, 314.50);
+INSERT INTO events VALUES (20077, 7, 314.75);
+INSERT INTO events VALUES (20080, 8, 315.00);
+INSERT INTO events VALUES (20083, 9, 315.25);
+INSERT INTO events VALUES (20086, 10, 315.50);
+INSERT INTO events VALUES (20089, 11, 315.75);
+INSERT INTO events VALUES (20092, 12, 316.00);
+INSERT INTO events VALUES (20095, 13, 316.25);
+INSERT INTO events VALUES (20098, 14, 316.50);
+INSERT INTO events VALUES (20101, 15, 316.75);
+INSERT INTO events VALUES (20104, 0, 317.00);
+INSERT INTO events VALUES (20107, 1, 317.25);
+INSERT INTO events VALUES (20110, 2, 317.50);
+INSERT INTO events VALUES (20113, 3, 317.75);
+INSERT INTO events VALUES (20116, 4, 318.00);
+INSERT INTO events VALUES (20119, 5, 318.25);
+INSERT INTO events VALUES (20122, 6, 318.50);
+INSERT INTO events VALUES (20125, 7, 318.75);
+INSERT INTO events VALUES (20128, 8, 319.00);
+INSERT INTO events VALUES (20131, 9, 319.25);
+INSERT INTO events VALUES (20134, 10, 319.50);
+INSERT INTO events VALUES (20137, 11, 319.75);
+INSERT INTO events VALUES (20140, 12, 320.00);
+INSERT INTO events VALUES (20143, 13, 320.25);
+INSERT INTO events VALUES (20146, 14, 320.50);
+INSERT INTO events VALUES (20149, 15, 320.75);
+INSERT INTO events VALUES (20152, 0, 321.00);
+INSERT INTO events VALUES (20155, 1, 321.25);
+INSERT INTO events VALUES (20158, 2, 321.50);
+INSERT INTO events VALUES (20161, 3, 321.75);
+INSERT INTO events VALUES (20164, 4, 322.00);
+INSERT INTO events VALUES (20167, 5, 322.25);
+INSERT INTO events VALUES (20170, 6, 322.50);
+INSERT INTO events VALUES (20173, 7, 322.75);
+INSERT INTO events VALUES (20176, 8, 323.00);
+INSERT INTO events VALUES (20179, 9, 323.25);
+INSERT INTO events VALUES (20182, 10, 323.50);
+INSERT INTO events VALUES (20185, 11, 323.75);
+INSERT INTO events VALUES (20188, 12, 324.00);
+INSERT INTO events VALUES (20191, 13, 324.25);
+INSERT INTO events VALUES (20194, 14, 324.50);
+INSERT INTO events VALUES (20197, 15, 324.75);
+INSERT INTO events VALUES (20200, 0, 300.00);
+INSERT INTO events VALUES (20203, 1, 300.25);
+INSERT INTO events VALUES (20206, 2, 300.50);
+INSERT INTO events VALUES (20209, 3, 300.75);
+INSERT INTO events VALUES (20212, 4, 301.00);
+INSERT INTO events VALUES (20215, 5, 301.25);
+INSERT INTO events VALUES (20218, 6, 301.50);
+INSERT INTO events VALUES (20221, 7, 301.75);
+INSERT INTO events VALUES (20224, 8, 302.00);
+INSERT INTO events VALUES (20227, 9, 302.25);
+INSERT INTO events VALUES (20230, 10, 302.50);
+INSERT INTO events VALUES (20233, 11, 302.75);
+INSERT INTO events VALUES (20236, 12, 303.00);
+INSERT INTO events VALUES (20239, 13, 303.25);
+INSERT INTO events VALUES (20242, 14, 303.50);
+INSERT INTO events VALUES (20245, 15, 303.75);
+INSERT INTO events VALUES (20248, 0, 304.00);
+INSERT INTO events VALUES (20251, 1, 304.25);
+INSERT INTO events VALUES (20254, 2, 304.50);
+INSERT INTO events VALUES (20257, 3, 304.75);
+INSERT INTO events VALUES (20260, 4, 305.00);
+INSERT INTO events VALUES (20263, 5, 305.25);
+INSERT INTO events VALUES (20266, 6, 305.50);
+INSERT INTO events VALUES (20269, 7, 305.75);
+INSERT INTO events VALUES (20272, 8, 306.00);
+INSERT INTO events VALUES (20275, 9, 306.25);
+INSERT INTO events VALUES (20278, 10, 306.50);
+INSERT INTO events VALUES (20281, 11, 306.75);
+INSERT INTO events VALUES (20284, 12, 307.00);
+INSERT INTO events VALUES (20287, 13, 307.25);
+INSERT INTO events VALUES (20290, 14, 307.50);
+INSERT INTO events VALUES (20293, 15, 307.75);
+INSERT INTO events VALUES (20296, 0, 308.00);
+INSERT INTO events VALUES (20299, 1, 308.25);
+INSERT INTO events VALUES (20302, 2, 308.50);
+INSERT INTO events VALUES (20305, 3, 308.75);
+INSERT INTO events VALUES (20308, 4, 309.00);
+INSERT INTO events VALUES (20311, 5, 309.25);
+INSERT INTO events VALUES (20314, 6, 309.50);
+INSERT INTO events VALUES (20317, 7, 309.75);
+INSERT INTO events VALUES (20320, 8, 310.00);
+INSERT INTO events VALUES (20323, 9, 310.25);
+INSERT INTO events VALUES (20326, 10, 310.50);
+INSERT INTO events VALUES (20329, 11, 310.75);
+INSERT INTO events VALUES (20332, 12, 311.00);
+INSERT INTO events VALUES (20335, 13, 311.25);
+INSERT INTO events VALUES (20338, 14, 311.50);
+INSERT INTO events VALUES (20341, 15, 311.75);
+INSERT INTO events VALUES (20344, 0, 312.00);
+INSERT INTO events VALUES (20347, 1, 312.25);
+INSERT INTO events VALUES (20350, 2, 312.50);
+INSERT INTO events VALUES (20353, 3, 312.75);
+INSERT INTO events VALUES (20356, 4, 313.00);
+INSERT INTO events VALUES (20359, 5, 313.25);
+INSERT INTO events VALUES (20362, 6, 313.50);
+INSERT INTO events VALUES (20365, 7, 313.75);
+INSERT INTO events VALUES (20368, 8, 314.00);
+INSERT INTO events VALUES (20371, 9, 314.25);
+INSERT INTO events VALUES (20374, 10, 314.50);
+INSERT INTO events VALUES (20377, 11, 314.75);
+INSERT INTO events VALUES (20380, 12, 315.00);
+INSERT INTO events VALUES (20383, 13, 315.25);
+INSERT INTO events VALUES (20386, 14, 315.50);
+INSERT INTO events VALUES (20389, 15, 315.75);
+INSERT INTO events VALUES (20392, 0, 316.00);
+INSERT INTO events VALUES (20395, 1, 316.25);
+INSERT INTO events VALUES (20398, 2, 316.50);
+INSERT INTO events VALUES (20401, 3, 316.75);
+INSERT INTO events VALUES (20404, 4, 317.00);
+INSERT INTO events VALUES (20407, 5, 317.25);
+INSERT INTO events VALUES (20410, 6, 317.50);
+INSERT INTO events VALUES (20413, 7, 317.75);
+INSERT INTO events VALUES (20416, 8, 318.00);
+INSERT INTO events VALUES (20419, 9, 318.25);
+INSERT INTO events VALUES (20422, 10, 318.50);
+INSERT INTO events VALUES (20425, 11, 318.75);
+INSERT INTO events VALUES (20428, 12, 319.00);
+INSERT INTO events VALUES (20431, 13, 319.25);
+INSERT INTO events VALUES (20434, 14, 319.50);
+INSERT INTO events VALUES (20437, 15, 319.75);
+INSERT INTO events VALUES (20440, 0, 320.00);
+INSERT INTO events VALUES (20443, 1, 320.25);
+INSERT INTO events VALUES (20446, 2, 320.50);
+INSERT INTO events VALUES (20449, 3, 320.75);
+INSERT INTO events VALUES (20452, 4, 321.00);
+INSERT INTO events VALUES (20455, 5, 321.25);
+INSERT INTO events VALUES (20458, 6, 321.50);
+INSERT INTO events VALUES (20461, 7, 321.75);
+INSERT INTO events VALUES (20464, 8, 322.00);
+INSERT INTO events VALUES (20467, 9, 322.25);
+INSERT INTO events VALUES (20470, 10, 322.50);
+INSERT INTO events VALUES (20473, 11, 322.75);
+INSERT INTO events VALUES (20476, 12, 323.00);
+INSERT INTO events VALUES (20479, 13, 323.25);
+INSERT INTO events VALUES (20482, 14, 323.50);
+INSERT INTO events VALUES (20485, 15, 323.75);
+INSERT INTO events VALUES (20488, 0, 324.00);
+INSERT INTO events VALUES (20491, 1, 324.25);
+INSERT INTO events VALUES (20494, 2, 324.50);
+INSERT INTO events VALUES (20497, 3, 324.75);
+INSERT INTO events VALUES (20500, 4, 300.00);
+INSERT INTO events VALUES (20503, 5, 300.25);
+INSERT INTO events VALUES (20506, 6, 300.50);
+INSERT INTO events VALUES (20509, 7, 300.75);
+INSERT INTO events VALUES (20512, 8, 301.00);
+INSERT INTO events VALUES (20515, 9, 301.25);
+INSERT INTO events VALUES (20518, 10, 301.50);
+INSERT INTO events VALUES (20521, 11, 301.75);
+INSERT INTO events VALUES (20524, 12, 302.00);
+INSERT INTO events VALUES (20527, 13, 302.25);
+INSERT INTO events VALUES (20530, 14, 302.50);
+INSERT INTO events VALUES (20533, 15, 302.75);
+INSERT INTO events VALUES (20536, 0, 303.00);
+INSERT INTO events VALUES (20539, 1, 303.25);
+INSERT INTO events VALUES (20542, 2, 303.50);
+INSERT INTO events VALUES (20545, 3, 303.75);
+INSERT INTO events VALUES (20548, 4, 304.00);
+INSERT INTO events VALUES (20551, 5, 304.25);
+INSERT INTO events VALUES (20554, 6, 304.50);
+INSERT INTO events VALUES (20557, 7, 304.75);
+INSERT INTO events VALUES (20560, 8, 305.00);
+INSERT INTO events VALUES (20563, 9, 305.25);
+INSERT INTO events VALUES (20566, 10, 305.50);
+INSERT INTO events VALUES (20569, 11, 305.75);
+INSERT INTO events VALUES (20572, 12, 306.00);
+INSERT INTO events VALUES (20575, 13, 306.25);
+INSERT INTO events VALUES (20578, 14, 306.50);
+INSERT INTO events VALUES (20581, 15, 306.75);
+INSERT INTO events VALUES (20584, 0, 307.00);
+INSERT INTO events VALUES (20587, 1, 307.25);
+INSERT INTO events VALUES (20590, 2, 307.50);
+INSERT INTO events VALUES (20593, 3, 307.75);
+INSERT INTO events VALUES (20596, 4, 308.00);
+INSERT INTO events VALUES (20599, 5, 308.25);
+INSERT INTO events VALUES (20602, 6, 308.50);
+INSERT INTO events VALUES (20605, 7, 308.75);
+INSERT INTO events VALUES (20608, 8, 309.00);
+INSERT INTO events VALUES (20611, 9, 309.25);
+INSERT INTO events VALUES (20614, 10, 309.50);
+INSERT INTO events VALUES (20617, 11, 309.75);
+INSERT INTO events VALUES (20620, 12, 310.00);
+INSERT INTO events VALUES (20623, 13, 310.25);
+INSERT INTO events VALUES (20626, 14, 310.50);
+INSERT INTO events VALUES (20629, 15, 310.75);
+INSERT INTO events VALUES (20632, 0, 311.00);
+INSERT INTO events VALUES (20635, 1, 311.25);
+INSERT INTO events VALUES (20638, 2, 311.50);
+INSERT INTO events VALUES (20641, 3, 311.75);
+INSERT INTO events VALUES (20644, 4, 312.00);
+INSERT INTO events VALUES (20647, 5, 312.25);
+INSERT INTO events VALUES (20650, 6, 312.50);
+INSERT INTO events VALUES (20653, 7, 312.75);
+INSERT INTO events VALUES (20656, 8, 313.00);
+INSERT INTO events VALUES (20659, 9, 313.25);
+INSERT INTO events VALUES (20662, 10, 313.50);
+INSERT INTO events VALUES (20665, 11, 313.75);
+INSERT INTO events VALUES (20668, 12, 314.00);
+INSERT INTO events VALUES (20671, 13, 314.25);
+INSERT INTO events VALUES (20674, 14, 314.50);
+INSERT INTO events VALUES (20677, 15, 314.75);
+INSERT INTO events VALUES (20680, 0, 315.00);
+INSERT INTO events VALUES (20683, 1, 315.25);
+INSERT INTO events VALUES (20686, 2, 315.50);
+INSERT INTO events VALUES (20689, 3, 315.75);
+INSERT INTO events VALUES (20692, 4, 316.00);
+INSERT INTO events VALUES (20695, 5, 316.25);
+INSERT INTO events VALUES (20698, 6, 316.50);
+INSERT INTO events VALUES (20701, 7, 316.75);
+INSERT INTO events VALUES (20704, 8, 317.00);
+INSERT INTO events VALUES (20707, 9, 317.25);
+INSERT INTO events VALUES (20710, 10, 317.50);
+INSERT INTO events VALUES (20713, 11, 317.75);
+INSERT INTO events VALUES (20716, 12, 318.00);
+INSERT INTO events VALUES (20719, 13, 318.25);
+INSERT INTO events VALUES (20722, 14, 318.50);
+INSERT INTO events VALUES (20725, 15, 318.75);
+INSERT INTO events VALUES (20728, 0, 319.00);
+INSERT INTO events VALUES (20731, 1, 319.25);
+INSERT INTO events VALUES (20734, 2, 319.50);
+INSERT INTO events VALUES (20737, 3, 319.75);
+INSERT INTO events VALUES (20740, 4, 320.00);
+INSERT INTO events VALUES (20743, 5, 320.25);
+INSERT INTO events VALUES (20746, 6, 320.50);
+INSERT INTO events VALUES (20749, 7, 320.75);
+INSERT INTO events VALUES (20752, 8, 321.00);
+INSERT INTO events VALUES (20755, 9, 321.25);
+INSERT INTO events VALUES (20758, 10, 321.50);
+INSERT INTO events VALUES (20761, 11, 321.75);
+INSERT INTO events VALUES (20764, 12, 322.00);
+INSERT INTO events VALUES (20767, 13, 322.25);
+INSERT INTO events VALUES (20770, 14, 322.50);
+INSERT INTO events VALUES (20773, 15, 322.75);
+INSERT INTO events VALUES (20776, 0, 323.00);
+INSERT INTO events VALUES (20779, 1, 323.25);
+INSERT INTO events VALUES (20782, 2, 323.50);
+INSERT INTO events VALUES (20785, 3, 323.75);
+INSERT INTO events VALUES (20788, 4, 324.00);
+INSERT INTO events VALUES (20791, 5, 324.25);
+INSERT INTO events VALUES (20794, 6, 324.50);
+INSERT INTO events VALUES (20797, 7, 324.75);
+INSERT INTO events VALUES (20800, 8, 300.00);
+INSERT INTO events VALUES (20803, 9, 300.25);
+INSERT INTO events VALUES (20806, 10, 300.50);
+INSERT INTO events VALUES (20809, 11, 300.75);
+INSERT INTO events VALUES (20812, 12, 301.00);
+INSERT INTO events VALUES (20815, 13, 301.25);
+INSERT INTO events VALUES (20818, 14, 301.50);
+INSERT INTO events VALUES (20821, 15, 301.75);
+INSERT INTO events VALUES (20824, 0, 302.00);
+INSERT INTO events VALUES (20827, 1, 302.25);
+INSERT INTO events VALUES (20830, 2, 302.50);
+INSERT INTO events VALUES (20833, 3, 302.75);
+INSERT INTO events VALUES (20836, 4, 303.00);
+INSERT INTO events VALUES (20839, 5, 303.25);
+INSERT INTO events VALUES (20842, 6, 303.50);
+INSERT INTO events VALUES (20845, 7, 303.75);
+INSERT INTO events VALUES (20848, 8, 304.00);
+INSERT INTO events VALUES (20851, 9, 304.25);
+INSERT INTO events VALUES (20854, 10, 304.50);
+INSERT INTO events VALUES (20857, 11, 304.75);
+INSERT INTO events VALUES (20860, 12, 305.00);
+INSERT INTO events VALUES (20863, 13, 305.25);
+INSERT INTO events VALUES (20866, 14, 305.50);
+INSERT INTO events VALUES (20869, 15, 305.75);
+INSERT INTO events VALUES (20872, 0, 306.00);
+INSERT INTO events VALUES (20875, 1, 306.25);
+INSERT INTO events VALUES (20878, 2, 306.50);
+INSERT INTO events VALUES (20881, 3, 306.75);
+INSERT INTO events VALUES (20884, 4, 307.00);
+INSERT INTO events VALUES (20887, 5, 307.25);
+INSERT INTO events VALUES (20890, 6, 307.50);
+INSERT INTO events VALUES (20893, 7, 307.75);
+INSERT INTO events VALUES (20896, 8, 308.00);
+INSERT INTO events VALUES (20899, 9, 308.25);
+INSERT INTO events VALUES (20902, 10, 308.50);
+INSERT INTO events VALUES (20905, 11, 308.75);
+INSERT INTO events VALUES (20908, 12, 309.00);
+INSERT INTO events VALUES (20911, 13, 309.25);
+INSERT INTO events VALUES (20914, 14, 309.50);
+INSERT INTO events VALUES (20917, 15, 309.75);
+INSERT INTO events VALUES (20920, 0, 310.00);
+INSERT INTO events VALUES (20923, 1, 310.25);
+INSERT INTO events VALUES (20926, 2, 310.50);
+INSERT INTO events VALUES (20929, 3, 310.75);
+INSERT INTO events VALUES (20932, 4, 311.00);
+INSERT INTO events VALUES (20935, 5, 311.25);
+INSERT INTO events VALUES (20938, 6, 311.50);
+INSERT INTO events VALUES (20941, 7, 311.75);
+INSERT INTO events VALUES (20944, 8, 312.00);
+INSERT INTO events VALUES (20947, 9, 312.25);
+INSERT INTO events VALUES (20950, 10, 312.50);
+INSERT INTO events VALUES (20953, 11, 312.75);
+INSERT INTO events VALUES (20956, 12, 313.00);
+INSERT INTO events VALUES (20959, 13, 313.25);
+INSERT INTO events VALUES (20962, 14, 313.50);
+INSERT INTO events VALUES (20965, 15, 313.75);
+INSERT INTO events VALUES (20968, 0, 314.00);
+INSERT INTO events VALUES (20971, 1, 314.25);
+INSERT INTO events VALUES (20974, 2, 314.50);
+INSERT INTO events VALUES (20977, 3, 314.75);
+INSERT INTO events VALUES (20980, 4, 315.00);
+INSERT INTO events VALUES (20983, 5, 315.25);
+INSERT INTO events VALUES (20986, 6, 315.50);
+INSERT INTO events VALUES (20989, 7, 315.75);
+INSERT INTO events VALUES (20992, 8, 316.00);
+INSERT INTO events VALUES (20995, 9, 316.25);
+INSERT INTO events VALUES (20998, 10, 316.50);
+INSERT INTO events VALUES (21001, 11, 316.75);
+INSERT INTO events VALUES (21004, 12, 317.00);
+INSERT INTO events VALUES (21007, 13, 317.25);
+INSERT INTO events VALUES (21010, 14, 317.50);
+INSERT INTO events VALUES (21013, 15, 317.75);
+INSERT INTO events VALUES (21016, 0, 318.00);
+INSERT INTO events VALUES (21019, 1, 318.25);
+INSERT INTO events VALUES (21022, 2, 318.50);
+INSERT INTO events VALUES (21025, 3, 318.75);
+INSERT INTO events VALUES (21028, 4, 319.00);
+INSERT INTO events VALUES (21031, 5, 319.25);
+INSERT INTO events VALUES (21034, 6, 319.50);
+INSERT INTO events VALUES (21037, 7, 319.75);
+INSERT INTO events VALUES (21040, 8, 320.00);
+INSERT INTO events VALUES (21043, 9, 320.25);
+INSERT INTO events VALUES (21046, 10, 320.50);
+INSERT INTO events VALUES (21049, 11, 320.75);
+INSERT INTO events VALUES (21052, 12, 321.00);
+INSERT INTO events VALUES (21055, 13, 321.25);
+INSERT INTO events VALUES (21058, 14, 321.50);
+INSERT INTO events VALUES (21061, 15, 321.75);
+INSERT INTO events VALUES (21064, 0, 322.00);
+INSERT INTO events VALUES (21067, 1, 322.25);
+INSERT INTO events VALUES (21070, 2, 322.50);
+INSERT INTO events VALUES (21073, 3, 322.75);
+INSERT INTO events VALUES (21076, 4, 323.00);
+INSERT INTO events VALUES (21079, 5, 323.25);
+INSERT INTO events VALUES (21082, 6, 323.50);
+INSERT INTO events VALUES (21085, 7, 323.75);
+INSERT INTO events VALUES (21088, 8, 324.00);
+INSERT INTO events VALUES (21091, 9, 324.25);
+INSERT INTO events VALUES (21094, 10, 324.50);
+INSERT INTO events VALUES (21097, 11, 324.75);
+INSERT INTO events VALUES (21100, 12, 300.00);
+INSERT INTO events VALUES (21103, 13, 300.25);
+INSERT INTO events VALUES (21106, 14, 300.50);
+INSERT INTO events VALUES (21109, 15, 300.75);
+INSERT INTO events VALUES (21112, 0, 301.00);
+INSERT INTO events VALUES (21115, 1, 301.25);
+INSERT INTO events VALUES (21118, 2, 301.50);
+INSERT INTO events VALUES (21121, 3, 301.75);
+INSERT INTO events VALUES (21124, 4, 302.00);
+INSERT INTO events VALUES (21127, 5, 302.25);
+INSERT INTO events VALUES (21130, 6, 302.50);
+INSERT INTO events VALUES (21133, 7, 302.75);
+INSERT INTO events VALUES (21136, 8, 303.00);
+INSERT INTO events VALUES (21139, 9, 303.25);
+INSERT INTO events VALUES (21142, 10, 303.50);
+INSERT INTO events VALUES (21145, 11, 303.75);
+INSERT INTO events VALUES (21148, 12, 304.00);
+INSERT INTO events VALUES (21151, 13, 304.25);
+INSERT INTO events VALUES (21154, 14, 304.50);
+INSERT INTO events VALUES (21157, 15, 304.75);
+INSERT INTO events VALUES (21160, 0, 305.00);
+INSERT INTO events VALUES (21163, 1, 305.25);
+INSERT INTO events VALUES (21166, 2, 305.50);
+INSERT INTO events VALUES (21169, 3, 305.75);
+INSERT INTO events VALUES (21172, 4, 306.00);
+INSERT INTO events VALUES (21175, 5, 306.25);
+INSERT INTO events VALUES (21178, 6, 306.50);
+INSERT INTO events VALUES (21181, 7, 306.75);
+INSERT INTO events VALUES (21184, 8, 307.00);
+INSERT INTO events VALUES (21187, 9, 307.25);
+INSERT INTO events VALUES (21190, 10, 307.50);
+INSERT INTO events VALUES (21193, 11, 307.75);
+INSERT INTO events VALUES (21196, 12, 308.00);
+INSERT INTO events VALUES (21199, 13, 308.25);
+INSERT INTO events VALUES (21202, 14, 308.50);
+INSERT INTO events VALUES (21205, 15, 308.75);
+INSERT INTO events VALUES (21208, 0, 309.00);
+INSERT INTO events VALUES (21211, 1, 309.25);
+INSERT INTO events VALUES (21214, 2, 309.50);
+INSERT INTO events VALUES (21217, 3, 309.75);
+INSERT INTO events VALUES (21220, 4, 310.00);
+INSERT INTO events VALUES (21223, 5, 310.25);
+INSERT INTO events VALUES (21226, 6, 310.50);
+INSERT INTO events VALUES (21229, 7, 310.75);
+INSERT INTO events VALUES (21232, 8, 311.00);
+INSERT INTO events VALUES (21235, 9, 311.25);
+INSERT INTO events VALUES (21238, 10, 311.50);
+INSERT INTO events VALUES (21241, 11, 311.75);
+INSERT INTO events VALUES (21244, 12, 312.00);
+INSERT INTO events VALUES (21247, 13, 312.25);
+INSERT INTO events VALUES (21250, 14, 312.50);
+INSERT INTO events VALUES (21253, 15, 312.75);
+INSERT INTO events VALUES (21256, 0, 313.00);
+INSERT INTO events VALUES (21259, 1, 313.25);
+INSERT INTO events VALUES (21262, 2, 313.50);
+INSERT INTO events VALUES (21265, 3, 313.75);
+INSERT INTO events VALUES (21268, 4, 314.00);
+INSERT INTO events VALUES (21271, 5, 314.25);
+INSERT INTO events VALUES (21274, 6, 314.50);
+INSERT INTO events VALUES (21277, 7, 314.75);
+INSERT INTO events VALUES (21280, 8, 315.00);
+INSERT INTO events VALUES (21283, 9, 315.25);
+INSERT INTO events VALUES (21286, 10, 315.50);
+INSERT INTO events VALUES (21289, 11, 315.75);
+INSERT INTO events VALUES (21292, 12, 316.00);
+INSERT INTO events VALUES (21295, 13, 316.25);
+INSERT INTO events VALUES (21298, 14, 316.50);
+INSERT INTO events VALUES (21301, 15, 316.75);
+INSERT INTO events VALUES (21304, 0, 317.00);
+INSERT INTO events VALUES (21307, 1, 317.25);
+INSERT INTO events VALUES (21310, 2, 317.50);
+INSERT INTO events VALUES (21313, 3, 317.75);
+INSERT INTO events VALUES (21316, 4, 318.00);
+INSERT INTO events VALUES (21319, 5, 318.25);
+INSERT INTO events VALUES (21322, 6, 318.50);
+INSERT INTO events VALUES (21325, 7, 318.75);
+INSERT INTO events VALUES (21328, 8, 319.00);
+INSERT INTO events VALUES (21331, 9, 319.25);
+INSERT INTO events VALUES (21334, 10, 319.50);
+INSERT INTO events VALUES (21337, 11, 319.75);
+INSERT INTO events VALUES (21340, 12, 320.00);
+INSERT INTO events VALUES (21343, 13, 320.25);
+INSERT INTO events VALUES (21346, 14, 320.50);
+INSERT INTO events VALUES (21349, 15, 320.75);
+INSERT INTO events VALUES (21352, 0, 321.00);
+INSERT INTO events VALUES (21355, 1, 321.25);
+INSERT INTO events VALUES (21358, 2, 321.50);
+INSERT INTO events VALUES (21361, 3, 321.75);
+INSERT INTO events VALUES (21364, 4, 322.00);
+INSERT INTO events VALUES (21367, 5, 322.25);
+INSERT INTO events VALUES (21370, 6, 322.50);
+INSERT INTO events VALUES (21373, 7, 322.75);
+INSERT INTO events VALUES (21376, 8, 323.00);
+INSERT INTO events VALUES (21379, 9, 323.25);
+INSERT INTO events VALUES (21382, 10, 323.50);
+INSERT INTO events VALUES (21385, 11, 323.75);
+INSERT INTO events VALUES (21388, 12, 324.00);
+INSERT INTO events VALUES (21391, 13, 324.25);
+INSERT INTO events VALUES (21394, 14, 324.50);
+INSERT INTO events VALUES (21397, 15, 324.75);
+INSERT INTO events VALUES (21400, 0, 300.00);
+INSERT INTO events VALUES (21403, 1, 300.25);
+INSERT INTO events VALUES (21406, 2, 300.50);
+INSERT INTO events VALUES (21409, 3, 300.75);
+INSERT INTO events VALUES (21412, 4, 301.00);
+INSERT INTO events VALUES (21415, 5, 301.25);
+INSERT INTO events VALUES (21418, 6, 301.50);
+INSERT INTO events VALUES (21421, 7, 301.75);
+INSERT INTO events VALUES (21424, 8, 302.00);
+INSERT INTO events VALUES (21427, 9, 302.25);
+INSERT INTO events VALUES (21430, 10, 302.50);
+INSERT INTO events VALUES (21433, 11, 302.75);
+INSERT INTO events VALUES (21436, 12, 303.00);
+INSERT INTO events VALUES (21439, 13, 303.25);
+INSERT INTO events VALUES (21442, 14, 303.50);
+INSERT INTO events VALUES (21445, 15, 303.75);
+INSERT INTO events VALUES (21448, 0, 304.00);
+INSERT INTO events VALUES (21451, 1, 304.25);
+INSERT INTO events VALUES (21454, 2, 304.50);
+INSERT INTO events VALUES (21457, 3, 304.75);
+INSERT INTO events VALUES (21460, 4, 305.00);
+INSERT INTO events VALUES (21463, 5, 305.25);
+INSERT INTO events VALUES (21466, 6, 305.50);
+INSERT INTO events VALUES (21469, 7, 305.75);
+INSERT INTO events VALUES (21472, 8, 306.00);
+INSERT INTO events VALUES (21475, 9, 306.25);
+INSERT INTO events VALUES (21478, 10, 306.50);
+INSERT INTO events VALUES (21481, 11, 306.75);
+INSERT INTO events VALUES (21484, 12, 307.00);
+INSERT INTO events VALUES (21487, 13, 307.25);
+INSERT INTO events VALUES (21490, 14, 307.50);
+INSERT INTO events VALUES (21493, 15, 307.75);
+INSERT INTO events VALUES (21496, 0, 308.00);
+INSERT INTO events VALUES (21499, 1, 308.25);
+INSERT INTO events VALUES (21502, 2, 308.50);
+INSERT INTO events VALUES (21505, 3, 308.75);
+INSERT INTO events VALUES (21508, 4, 309.00);
+INSERT INTO events VALUES (21511, 5, 309.25);
+INSERT INTO events VALUES (21514, 6, 309.50);
+INSERT INTO events VALUES (21517, 7, 309.75);
+INSERT INTO events VALUES (21520, 8, 310.00);
+INSERT INTO events VALUES (21523, 9, 310.25);
+INSERT INTO events VALUES (21526, 10, 310.50);
+INSERT INTO events VALUES (21529, 11, 310.75);
+INSERT INTO events VALUES (21532, 12, 311.00);
+INSERT INTO events VALUES (21535, 13, 311.25);
+INSERT INTO events VALUES (21538, 14, 311.50);
+INSERT INTO events VALUES (21541, 15, 311.75);
+INSERT INTO events VALUES (21544, 0, 312.00);
+INSERT INTO events VALUES (21547, 1, 312.25);
+INSERT INTO events VALUES (21550, 2, 312.50);
+INSERT INTO events VALUES (21553, 3, 312.75);
+INSERT INTO events VALUES (21556, 4, 313.00);
+INSERT INTO events VALUES (21559, 5, 313.25);
+INSERT INTO events VALUES (21562, 6, 313.50);
+INSERT INTO events VALUES (21565, 7, 313.75);
+INSERT INTO events VALUES (21568, 8, 314.00);
+INSERT INTO events VALUES (21571, 9, 314.25);
+INSERT INTO events VALUES (21574, 10, 314.50);
+INSERT INTO events VALUES (21577, 11, 314.75);
+INSERT INTO events VALUES (21580, 12, 315.00);
+INSERT INTO events VALUES (21583, 13, 315.25);
+INSERT INTO events VALUES (21586, 14, 315.50);
+INSERT INTO events VALUES (21589, 15, 315.75);
+INSERT INTO events VALUES (21592, 0, 316.00);
+INSERT INTO events VALUES (21595, 1, 316.25);
+INSERT INTO events VALUES (21598, 2, 316.50);
+INSERT INTO events VALUES (21601, 3, 316.75);
+INSERT INTO events VALUES (21604, 4, 317.00);
+INSERT INTO events VALUES (21607, 5, 317.25);
+INSERT INTO events VALUES (21610, 6, 317.50);
+INSERT INTO events VALUES (21613, 7, 317.75);
+INSERT INTO events VALUES (21616, 8, 318.00);
+INSERT INTO events VALUES (21619, 9, 318.25);
+INSERT INTO events VALUES (21622, 10, 318.50);
+INSERT INTO events VALUES (21625, 11, 318.75);
+INSERT INTO events VALUES (21628, 12, 319.00);
+INSERT INTO events VALUES (21631, 13, 319.25);
+INSERT INTO events VALUES (21634, 14, 319.50);
+INSERT INTO events VALUES (21637, 15, 319.75);
+INSERT INTO events VALUES (21640, 0, 320.00);
+INSERT INTO events VALUES (21643, 1, 320.25);
+INSERT INTO events VALUES (21646, 2, 320.50);
+INSERT INTO events VALUES (21649, 3, 320.75);
+INSERT INTO events VALUES (21652, 4, 321.00);
+INSERT INTO events VALUES (21655, 5, 321.25);
+INSERT INTO events VALUES (21658, 6, 321.50);
+INSERT INTO events VALUES (21661, 7, 321.75);
+INSERT INTO events VALUES (21664, 8, 322.00);
+INSERT INTO events VALUES (21667, 9, 322.25);
+INSERT INTO events VALUES (21670, 10, 322.50);
+INSERT INTO events VALUES (21673, 11, 322.75);
+INSERT INTO events VALUES (21676, 12, 323.00);
+INSERT INTO events VALUES (21679, 13, 323.25);
+INSERT INTO events VALUES (21682, 14, 323.50);
+INSERT INTO events VALUES (21685, 15, 323.75);
+INSERT INTO events VALUES (21688, 0, 324.00);
+INSERT INTO events VALUES (21691, 1, 324.25);
+INSERT INTO events VALUES (21694, 2, 324.50);
+INSERT INTO events VALUES (21697, 3, 324.75);
+INSERT INTO events VALUES (21700, 4, 300.00);
+INSERT INTO events VALUES (21703, 5, 300.25);
+INSERT INTO events VALUES (21706, 6, 300.50);
+INSERT INTO events VALUES (21709, 7, 300.75);
+INSERT INTO events VALUES (21712, 8, 301.00);
+INSERT INTO events VALUES (21715, 9, 301.25);
+INSERT INTO events VALUES (21718, 10, 301.50);
+INSERT INTO events VALUES (21721, 11, 301.75);
+INSERT INTO events VALUES (21724, 12, 302.00);
+INSERT INTO events VALUES (21727, 13, 302.25);
+INSERT INTO events VALUES (21730, 14, 302.50);
+INSERT INTO events VALUES (21733, 15, 302.75);
+INSERT INTO events VALUES (21736, 0, 303.00);
+INSERT INTO events VALUES (21739, 1, 303.25);
+INSERT INTO events VALUES (21742, 2, 303.50);
+INSERT INTO events VALUES (21745, 3, 303.75);
+INSERT INTO events VALUES (21748, 4, 304.00);
+INSERT INTO events VALUES (21751, 5, 304.25);
+INSERT INTO events VALUES (21754, 6, 304.50);
+INSERT INTO events VALUES (21757, 7, 304.75);
+INSERT INTO events VALUES (21760, 8, 305.00);
+INSERT INTO events VALUES (21763, 9, 305.25);
+INSERT INTO events VALUES (21766, 10, 305.50);
+INSERT INTO events VALUES (21769, 11, 305.75);
+INSERT INTO events VALUES (21772, 12, 306.00);
+INSERT INTO events VALUES (21775, 13, 306.25);
+INSERT INTO events VALUES (21778, 14, 306.50);
+INSERT INTO events VALUES (21781, 15, 306.75);
+INSERT INTO events VALUES (21784, 0, 307.00);
+INSERT INTO events VALUES (21787, 1, 307.25);
+INSERT INTO events VALUES (21790, 2, 307.50);
+INSERT INTO events VALUES (21793, 3, 307.75);
+INSERT INTO events VALUES (21796, 4, 308.00);
+INSERT INTO events VALUES (21799, 5, 308.25);
+INSERT INTO events VALUES (21802, 6, 308.50);
+INSERT INTO events VALUES (21805, 7, 308.75);
+INSERT INTO events VALUES (21808, 8, 309.00);
+INSERT INTO events VALUES (21811, 9, 309.25);
+INSERT INTO events VALUES (21814, 10, 309.50);
+INSERT INTO events VALUES (21817, 11, 309.75);
+INSERT INTO events VALUES (21820, 12, 310.00);
+INSERT INTO events VALUES (21823, 13, 310.25);
+INSERT INTO events VALUES (21826, 14, 310.50);
+INSERT INTO events VALUES (21829, 15, 310.75);
+INSERT INTO events VALUES (21832, 0, 311.00);
+INSERT INTO events VALUES (21835, 1, 311.25);
+INSERT INTO events VALUES (21838, 2, 311.50);
+INSERT INTO events VALUES (21841, 3, 311.75);
+INSERT INTO events VALUES (21844, 4, 312.00);
+INSERT INTO events VALUES (21847, 5, 312.25);
+INSERT INTO events VALUES (21850, 6, 312.50);
+INSERT INTO events VALUES (21853, 7, 312.75);
+INSERT INTO events VALUES (21856, 8, 313.00);
+INSERT INTO events VALUES (21859, 9, 313.25);
+INSERT INTO events VALUES (21862, 10, 313.50);
+INSERT INTO events VALUES (21865, 11, 313.75);
+INSERT INTO events VALUES (21868, 12, 314.00);
+INSERT INTO events VALUES (21871, 13, 314.25);
+INSERT INTO events VALUES (21874, 14, 314.50);
+INSERT INTO events VALUES (21877, 15, 314.75);
+INSERT INTO events VALUES (21880, 0, 315.00);
+INSERT INTO events VALUES (21883, 1, 315.25);
+INSERT INTO events VALUES (21886, 2, 315.50);
+INSERT INTO events VALUES (21889, 3, 315.75);
+INSERT INTO events VALUES (21892, 4, 316.00);
+INSERT INTO events VALUES (21895, 5, 316.25);
+INSERT INTO events VALUES (21898, 6, 316.50);
+INSERT INTO events VALUES (21901, 7, 316.75);
+INSERT INTO events VALUES (21904, 8, 317.00);
+INSERT INTO events VALUES (21907, 9, 317.25);
+INSERT INTO events VALUES (21910, 10, 317.50);
+INSERT INTO events VALUES (21913, 11, 317.75);
+INSERT INTO events VALUES (21916, 12, 318.00);
+INSERT INTO events VALUES (21919, 13, 318.25);
+INSERT INTO events VALUES (21922, 14, 318.50);
+INSERT INTO events VALUES (21925, 15, 318.75);
+INSERT INTO events VALUES (21928, 0, 319.00);
+INSERT INTO events VALUES (21931, 1, 319.25);
+INSERT INTO events VALUES (21934, 2, 319.50);
+INSERT INTO events VALUES (21937, 3, 319.75);
+INSERT INTO events VALUES (21940, 4, 320.00);
+INSERT INTO events VALUES (21943, 5, 320.25);
+INSERT INTO events VALUES (21946, 6, 320.50);
+INSERT INTO events VALUES (21949, 7, 320.75);
+INSERT INTO events VALUES (21952, 8, 321.00);
+INSERT INTO events VALUES (21955, 9, 321.25);
+INSERT INTO events VALUES (21958, 10, 321.50);
+INSERT INTO events VALUES (21961, 11, 321.75);
+INSERT INTO events VALUES (21964, 12, 322.00);
+INSERT INTO events VALUES (21967, 13, 322.25);
+INSERT INTO events VALUES (21970, 14, 322.50);
+INSERT INTO events VALUES (21973, 15, 322.75);
+INSERT INTO events VALUES (21976, 0, 323.00);
+INSERT INTO events VALUES (21979, 1, 323.25);
+INSERT INTO events VALUES (21982, 2, 323.50);
+INSERT INTO events VALUES (21985, 3, 323.75);
+INSERT INTO events VALUES (21988, 4, 324.00);
+INSERT INTO events VALUES (21991, 5, 324.25);
+INSERT INTO events VALUES (21994, 6, 324.50);
+INSERT INTO events VALUES (21997, 7, 324.75);
+INSERT INTO events VALUES (22000, 8, 300.00);
+INSERT INTO events VALUES (22003, 9, 300.25);
+INSERT INTO events VALUES (22006, 10, 300.50);
+INSERT INTO events VALUES (22009, 11, 300.75);
+INSERT INTO events VALUES (22012, 12, 301.00);
+INSERT INTO events VALUES (22015, 13, 301.25);
+INSERT INTO events VALUES (22018, 14, 301.50);
+INSERT INTO events VALUES (22021, 15, 301.75);
+INSERT INTO events VALUES (22024, 0, 302.00);
+INSERT INTO events VALUES (22027, 1, 302.25);
+INSERT INTO events VALUES (22030, 2, 302.50);
+INSERT INTO events VALUES (22033, 3, 302.75);
+INSERT INTO events VALUES (22036, 4, 303.00);
+INSERT INTO events VALUES (22039, 5, 303.25);
+INSERT INTO events VALUES (22042, 6, 303.50);
+INSERT INTO events VALUES (22045, 7, 303.75);
+INSERT INTO events VALUES (22048, 8, 304.00);
+INSERT INTO events VALUES (22051, 9, 304.25);
+INSERT INTO events VALUES (22054, 10, 304.50);
+INSERT INTO events VALUES (22057, 11, 304.75);
+INSERT INTO events VALUES (22060, 12, 305.00);
+INSERT INTO events VALUES (22063, 13, 305.25);
+INSERT INTO events VALUES (22066, 14, 305.50);
+INSERT INTO events VALUES (22069, 15, 305.75);
+INSERT INTO events VALUES (22072, 0, 306.00);
+INSERT INTO events VALUES (22075, 1, 306.25);
+INSERT INTO events VALUES (22078, 2, 306.50);
+INSERT INTO events VALUES (22081, 3, 306.75);
+INSERT INTO events VALUES (22084, 4, 307.00);
+INSERT INTO events VALUES (22087, 5, 307.25);
+INSERT INTO events VALUES (22090, 6, 307.50);
+INSERT INTO events VALUES (22093, 7, 307.75);
+INSERT INTO events VALUES (22096, 8, 308.00);
+INSERT INTO events VALUES (22099, 9, 308.25);
+INSERT INTO events VALUES (22102, 10, 308.50);
+INSERT INTO events VALUES (22105, 11, 308.75);
+INSERT INTO events VALUES (22108, 12, 309.00);
+INSERT INTO events VALUES (22111, 13, 309.25);
+INSERT INTO events VALUES (22114, 14, 309.50);
+INSERT INTO events VALUES (22117, 15, 309.75);
+INSERT INTO events VALUES (22120, 0, 310.00);
+INSERT INTO events VALUES (22123, 1, 310.25);
+INSERT INTO events VALUES (22126, 2, 310.50);
+INSERT INTO events VALUES (22129, 3, 310.75);
+INSERT INTO events VALUES (22132, 4, 311.00);
+INSERT INTO events VALUES (22135, 5, 311.25);
+INSERT INTO events VALUES (22138, 6, 311.50);
+INSERT INTO events VALUES (22141, 7, 311.75);
+INSERT INTO events VALUES (22144, 8, 312.00);
+INSERT INTO events VALUES (22147, 9, 312.25);
+INSERT INTO events VALUES (22150, 10, 312.50);
+INSERT INTO events VALUES (22153, 11, 312.75);
+INSERT INTO events VALUES (22156, 12, 313.00);
+INSERT INTO events VALUES (22159, 13, 313.25);
+INSERT INTO events VALUES (22162, 14, 313.50);
+INSERT INTO events VALUES (22165, 15, 313.75);
+INSERT INTO events VALUES (22168, 0, 314.00);
+INSERT INTO events VALUES (22171, 1, 314.25);
+INSERT INTO events VALUES (22174, 2, 314.50);
+INSERT INTO events VALUES (22177, 3, 314.75);
+INSERT INTO events VALUES (22180, 4, 315.00);
+INSERT INTO events VALUES (22183, 5, 315.25);
+INSERT INTO events VALUES (22186, 6, 315.50);
+INSERT INTO events VALUES (22189, 7, 315.75);
+INSERT INTO events VALUES (22192, 8, 316.00);
+INSERT INTO events VALUES (22195, 9, 316.25);
+INSERT INTO events VALUES (22198, 10, 316.50);
+INSERT INTO events VALUES (22201, 11, 316.75);
+INSERT INTO events VALUES (22204, 12, 317.00);
+INSERT INTO events VALUES (22207, 13, 317.25);
+INSERT INTO events VALUES (22210, 14, 317.50);
+INSERT INTO events VALUES (22213, 15, 317.75);
+INSERT INTO events VALUES (22216, 0, 318.00);
+INSERT INTO events VALUES (22219, 1, 318.25);
+INSERT INTO events VALUES (22222, 2, 318.50);
+INSERT INTO events VALUES (22225, 3, 318.75);
+INSERT INTO events VALUES (22228, 4, 319.00);
+INSERT INTO events VALUES (22231, 5, 319.25);
+INSERT INTO events VALUES (22234, 6, 319.50);
+INSERT INTO events VALUES (22237, 7, 319.75);
+INSERT INTO events VALUES (22240, 8, 320.00);
+INSERT INTO events VALUES (22243, 9, 320.25);
+INSERT INTO events VALUES (22246, 10, 320.50);
+INSERT INTO events VALUES (22249, 11, 320.75);
+INSERT INTO events VALUES (22252, 12, 321.00);
+INSERT INTO events VALUES (22255, 13, 321.25);
+INSERT INTO events VALUES (22258, 14, 321.50);
+INSERT INTO events VALUES (22261, 15, 321.75);
+INSERT INTO events VALUES (22264, 0, 322.00);
+INSERT INTO events VALUES (22267, 1, 322.25);
+INSERT INTO events VALUES (22270, 2, 322.50);
+INSERT INTO events VALUES (22273, 3, 322.75);
+INSERT INTO events VALUES (22276, 4, 323.00);
+INSERT INTO events VALUES (22279, 5, 323.25);
+INSERT INTO events VALUES (22282, 6, 323.50);
+INSERT INTO events VALUES (22285, 7, 323.75);
+INSERT INTO events VALUES (22288, 8, 324.00);
+INSERT INTO events VALUES (22291, 9, 324.25);
+INSERT INTO events VALUES (22294, 10, 324.50);
+INSERT INTO events VALUES (22297, 11, 324.75);
+INSERT INTO events VALUES (22300, 12, 300.00);
+INSERT INTO events VALUES (22303, 13, 300.25);
+INSERT INTO events VALUES (22306, 14, 300.50);
+INSERT INTO events VALUES (22309, 15, 300.75);
+INSERT INTO events VALUES (22312, 0, 301.00);
+INSERT INTO events VALUES (22315, 1, 301.25);
+INSERT INTO events VALUES (22318, 2, 301.50);
+INSERT INTO events VALUES (22321, 3, 301.75);
+INSERT INTO events VALUES (22324, 4, 302.00);
+INSERT INTO events VALUES (22327, 5, 302.25);
+INSERT INTO events VALUES (22330, 6, 302.50);
+INSERT INTO events VALUES (22333, 7, 302.75);
+INSERT INTO events VALUES (22336, 8, 303.00);
+INSERT INTO events VALUES (22339, 9, 303.25);
+INSERT INTO events VALUES (22342, 10, 303.50);
+INSERT INTO events VALUES (22345, 11, 303.75);
+INSERT INTO events VALUES (22348, 12, 304.00);
+INSERT INTO events VALUES (22351, 13, 304.25);
+INSERT INTO events VALUES (22354, 14, 304.50);
+INSERT INTO events VALUES (22357, 15, 304.75);
+INSERT INTO events VALUES (22360, 0, 305.00);
+INSERT INTO events VALUES (22363, 1, 305.25);
+INSERT INTO events VALUES (22366, 2, 305.50);
+INSERT INTO events VALUES (22369, 3, 305.75);
+INSERT INTO events VALUES (22372, 4, 306.00);
+INSERT INTO events VALUES (22375, 5, 306.25);
+INSERT INTO events VALUES (22378, 6, 306.50);
+INSERT INTO events VALUES (22381, 7, 306.75);
+INSERT INTO events VALUES (22384, 8, 307.00);
+INSERT INTO events VALUES (22387, 9, 307.25);
+INSERT INTO events VALUES (22390, 10, 307.50);
+INSERT INTO events VALUES (22393, 11, 307.75);
+INSERT INTO events VALUES (22396, 12, 308.00);
+INSERT INTO events VALUES (22399, 13, 308.25);
+INSERT INTO events VALUES (22402, 14, 308.50);
+INSERT INTO events VALUES (22405, 15, 308.75);
+INSERT INTO events VALUES (22408, 0, 309.00);
+INSERT INTO events VALUES (22411, 1, 309.25);
+INSERT INTO events VALUES (22414, 2, 309.50);
+INSERT INTO events VALUES (22417, 3, 309.75);
+INSERT INTO events VALUES (22420, 4, 310.00);
+INSERT INTO events VALUES (22423, 5, 310.25);
+INSERT INTO events VALUES (22426, 6, 310.50);
+INSERT INTO events VALUES (22429, 7, 310.75);
+INSERT INTO events VALUES (22432, 8, 311.00);
+INSERT INTO events VALUES (22435, 9, 311.25);
+INSERT INTO events VALUES (22438, 10, 311.50);
+INSERT INTO events VALUES (22441, 11, 311.75);
+INSERT INTO events VALUES (22444, 12, 312.00);
+INSERT INTO events VALUES (22447, 13, 312.25);
+INSERT INTO events VALUES (22450, 14, 312.50);
+INSERT INTO events VALUES (22453, 15, 312.75);
+INSERT INTO events VALUES (22456, 0, 313.00);
+INSERT INTO events VALUES (22459, 1, 313.25);
+INSERT INTO events VALUES (22462, 2, 313.50);
+INSERT INTO events VALUES (22465, 3, 313.75);
+INSERT INTO events VALUES (22468, 4, 314.00);
+INSERT INTO events VALUES (22471, 5, 314.25);
+INSERT INTO events VALUES (22474, 6, 314.50);
+INSERT INTO events VALUES (22477, 7, 314.75);
+INSERT INTO events VALUES (22480, 8, 315.00);
+INSERT INTO events VALUES (22483, 9, 315.25);
+INSERT INTO events VALUES (22486, 10, 315.50);
+INSERT INTO events VALUES (22489, 11, 315.75);
+INSERT INTO events VALUES (22492, 12, 316.00);
+INSERT INTO events VALUES (22495, 13, 316.25);
+INSERT INTO events VALUES (22498, 14, 316.50);
+INSERT INTO events VALUES (22501, 15, 316.75);
+INSERT INTO events VALUES (22504, 0, 317.00);
+INSERT INTO events VALUES (22507, 1, 317.25);
+INSERT INTO events VALUES (22510, 2, 317.50);
+INSERT INTO events VALUES (22513, 3, 317.75);
+INSERT INTO events VALUES (22516, 4, 318.00);
+INSERT INTO events VALUES (22519, 5, 318.25);
+INSERT INTO events VALUES (22522, 6, 318.50);
+INSERT INTO events VALUES (22525, 7, 318.75);
+INSERT INTO events VALUES (22528, 8, 319.00);
+INSERT INTO events VALUES (22531, 9, 319.25);
+INSERT INTO events VALUES (22534, 10, 319.50);
+INSERT INTO events VALUES (22537, 11, 319.75);
+INSERT INTO events VALUES (22540, 12, 320.00);
+INSERT INTO events VALUES (22543, 13, 320.25);
+INSERT INTO events VALUES (22546, 14, 320.50);
+INSERT INTO events VALUES (22549, 15, 320.75);
+INSERT INTO events VALUES (22552, 0, 321.00);
+INSERT INTO events VALUES (22555, 1, 321.25);
+INSERT INTO events VALUES (22558, 2, 321.50);
+INSERT INTO events VALUES (22561, 3, 321.75);
+INSERT INTO events VALUES (22564, 4, 322.00);
+INSERT INTO events VALUES (22567, 5, 322.25);
+INSERT INTO events VALUES (22570, 6, 322.50);
+INSERT INTO events VALUES (22573, 7, 322.75);
+INSERT INTO events VALUES (22576, 8, 323.00);
+INSERT INTO events VALUES (22579, 9, 323.25);
+INSERT INTO events VALUES (22582, 10, 323.50);
+INSERT INTO events VALUES (22585, 11, 323.75);
+INSERT INTO events VALUES (22588, 12, 324.00);
+INSERT INTO events VALUES (22591, 13, 324.25);
+INSERT INTO events VALUES (22594, 14, 324.50);
+INSERT INTO events VALUES (22597, 15, 324.75);
+INSERT INTO events VALUES (22600, 0, 300.00);
+INSERT INTO events VALUES (22603, 1, 300.25);
+INSERT INTO events VALUES (22606, 2, 300.50);
+INSERT INTO events VALUES (22609, 3, 300.75);
+INSERT INTO events VALUES (22612, 4, 301.00);
+INSERT INTO events VALUES (22615, 5, 301.25);
+INSERT INTO events VALUES (22618, 6, 301.50);
+INSERT INTO events VALUES (22621, 7, 301.75);
+INSERT INTO events VALUES (22624, 8, 302.00);
+INSERT INTO events VALUES (22627, 9, 302.25);
+INSERT INTO events VALUES (22630, 10, 302.50);
+INSERT INTO events VALUES (22633, 11, 302.75);
+INSERT INTO events VALUES (22636, 12, 303.00);
+INSERT INTO events VALUES (22639, 13, 303.25);
+INSERT INTO events VALUES (22642, 14, 303.50);
+INSERT INTO events VALUES (22645, 15, 303.75);
+INSERT INTO events VALUES (22648, 0, 304.00);
+INSERT INTO events VALUES (22651, 1, 304.25);
+INSERT INTO events VALUES (22654, 2, 304.50);
+INSERT INTO events VALUES (22657, 3, 304.75);
+INSERT INTO events VALUES (22660, 4, 305.00);
+INSERT INTO events VALUES (22663, 5, 305.25);
+INSERT INTO events VALUES (22666, 6, 305.50);
+INSERT INTO events VALUES (22669, 7, 305.75);
+INSERT INTO events VALUES (22672, 8, 306.00);
+INSERT INTO events VALUES (22675, 9, 306.25);
+INSERT INTO events VALUES (22678, 10, 306.50);
+INSERT INTO events VALUES (22681, 11, 306.75);
+INSERT INTO events VALUES (22684, 12, 307.00);
+INSERT INTO events VALUES (22687, 13, 307.25);
+INSERT INTO events VALUES (22690, 14, 307.50);
+INSERT INTO events VALUES (22693, 15, 307.75);
+INSERT INTO events VALUES (22696, 0, 308.00);
+INSERT INTO events VALUES (22699, 1, 308.25);
+INSERT INTO events VALUES (22702, 2, 308.50);
+INSERT INTO events VALUES (22705, 3, 308.75);
+INSERT INTO events VALUES (22708, 4, 309.00);
+INSERT INTO events VALUES (22711, 5, 309.25);
+INSERT INTO events VALUES (22714, 6, 309.50);
+INSERT INTO events VALUES (22717, 7, 309.75);
+INSERT INTO events VALUES (22720, 8, 310.00);
+INSERT INTO events VALUES (22723, 9, 310.25);
+INSERT INTO events VALUES (22726, 10, 310.50);
+INSERT INTO events VALUES (22729, 11, 310.75);
+INSERT INTO events VALUES (22732, 12, 311.00);
+INSERT INTO events VALUES (22735, 13, 311.25);
+INSERT INTO events VALUES (22738, 14, 311.50);
+INSERT INTO events VALUES (22741, 15, 311.75);
+INSERT INTO events VALUES (22744, 0, 312.00);
+INSERT INTO events VALUES (22747, 1, 312.25);
+INSERT INTO events VALUES (22750, 2, 312.50);
+INSERT INTO events VALUES (22753, 3, 312.75);
+INSERT INTO events VALUES (22756, 4, 313.00);
+INSERT INTO events VALUES (22759, 5, 313.25);
+INSERT INTO events VALUES (22762, 6, 313.50);
+INSERT INTO events VALUES (22765, 7, 313.75);
+INSERT INTO events VALUES (22768, 8, 314.00);
+INSERT INTO events VALUES (22771, 9, 314.25);
+INSERT INTO events VALUES (22774, 10, 314.50);
+INSERT INTO events VALUES (22777, 11, 314.75);
+INSERT INTO events VALUES (22780, 12, 315.00);
+INSERT INTO events VALUES (22783, 13, 315.25);
+INSERT INTO events VALUES (22786, 14, 315.50);
+INSERT INTO events VALUES (22789, 15, 315.75);
+INSERT INTO events VALUES (22792, 0, 316.00);
+INSERT INTO events VALUES (22795, 1, 316.25);
+INSERT INTO events VALUES (22798, 2, 316.50);
+INSERT INTO events VALUES (22801, 3, 316.75);
+INSERT INTO events VALUES (22804, 4, 317.00);
+INSERT INTO events VALUES (22807, 5, 317.25);
+INSERT INTO events VALUES (22810, 6, 317.50);
+INSERT INTO events VALUES (22813, 7, 317.75);
+INSERT INTO events VALUES (22816, 8, 318.00);
+INSERT INTO events VALUES (22819, 9, 318.25);
+INSERT INTO events VALUES (22822, 10, 318.50);
+INSERT INTO events VALUES (22825, 11, 318.75);
+INSERT INTO events VALUES (22828, 12, 319.00);
+INSERT INTO events VALUES (22831, 13, 319.25);
+INSERT INTO events VALUES (22834, 14, 319.50);
+INSERT INTO events VALUES (22837, 15, 319.75);
+INSERT INTO events VALUES (22840, 0, 320.00);
+INSERT INTO events VALUES (22843, 1, 320.25);
+INSERT INTO events VALUES (22846, 2, 320.50);
+INSERT INTO events VALUES (22849, 3, 320.75);
+INSERT INTO events VALUES (22852, 4, 321.00);
+INSERT INTO events VALUES (22855, 5, 321.25);
+INSERT INTO events VALUES (22858, 6, 321.50);
+INSERT INTO events VALUES (22861, 7, 321.75);
+INSERT INTO events VALUES (22864, 8, 322.00);
+INSERT INTO events VALUES (22867, 9, 322.25);
+INSERT INTO events VALUES (22870, 10, 322.50);
+INSERT INTO events VALUES (22873, 11, 322.75);
+INSERT INTO events VALUES (22876, 12, 323.00);
+INSERT INTO events VALUES (22879, 13, 323.25);
+INSERT INTO events VALUES (22882, 14, 323.50);
+INSERT INTO events VALUES (22885, 15, 323.75);
+INSERT INTO events VALUES (22888, 0, 324.00);
+INSERT INTO events VALUES (22891, 1, 324.25);
+INSERT INTO events VALUES (22894, 2, 324.50);
+INSERT INTO events VALUES (22897, 3, 324.75);
+INSERT INTO events VALUES (22900, 4, 300.00);
+INSERT INTO events VALUES (22903, 5, 300.25);
+INSERT INTO events VALUES (22906, 6, 300.50);
+INSERT INTO events VALUES (22909, 7, 300.75);
+INSERT INTO events VALUES (22912, 8, 301.00);
+INSERT INTO events VALUES (22915, 9, 301.25);
+INSERT INTO events VALUES (22918, 10, 301.50);
+INSERT INTO events VALUES (22921, 11, 301.75);
+INSERT INTO events VALUES (22924, 12, 302.00);
+INSERT INTO events VALUES (22927, 13, 302.25);
+INSERT INTO events VALUES (22930, 14, 302.50);
+INSERT INTO events VALUES (22933, 15, 302.75);
+INSERT INTO events VALUES (22936, 0, 303.00);
+INSERT INTO events VALUES (22939, 1, 303.25);
+INSERT INTO events VALUES (22942, 2, 303.50);
+INSERT INTO events VALUES (22945, 3, 303.75);
+INSERT INTO events VALUES (22948, 4, 304.00);
+INSERT INTO events VALUES (22951, 5, 304.25);
+INSERT INTO events VALUES (22954, 6, 304.50);
+INSERT INTO events VALUES (22957, 7, 304.75);
+INSERT INTO events VALUES (22960, 8, 305.00);
+INSERT INTO events VALUES (22963, 9, 305.25);
+INSERT INTO events VALUES (22966, 10, 305.50);
+INSERT INTO events VALUES (22969, 11, 305.75);
+INSERT INTO events VALUES (22972, 12, 306.00);
+INSERT INTO events VALUES (22975, 13, 306.25);
+INSERT INTO events VALUES (22978, 14, 306.50);
+INSERT INTO events VALUES (22981, 15, 306.75);
+INSERT INTO events VALUES (22984, 0, 307.00);
+INSERT INTO events VALUES (22987, 1, 307.25);
+INSERT INTO events VALUES (22990, 2, 307.50);
+INSERT INTO events VALUES (22993, 3, 307.75);
+INSERT INTO events VALUES (22996, 4, 308.00);
+INSERT INTO events VALUES (22999, 5, 308.25);
+INSERT INTO events VALUES (23002, 6, 308.50);
+INSERT INTO events VALUES (23005, 7, 308.75);
+INSERT INTO events VALUES (23008, 8, 309.00);
+INSERT INTO events VALUES (23011, 9, 309.25);
+INSERT INTO events VALUES (23014, 10, 309.50);
+INSERT INTO events VALUES (23017, 11, 309.75);
+INSERT INTO events VALUES (23020, 12, 310.00);
+INSERT INTO events VALUES (23023, 13, 310.25);
+INSERT INTO events VALUES (23026, 14, 310.50);
+INSERT INTO events VALUES (23029, 15, 310.75);
+INSERT INTO events VALUES (23032, 0, 311.00);
+INSERT INTO events VALUES (23035, 1, 311.25);
+INSERT INTO events VALUES (23038, 2, 311.50);
+INSERT INTO events VALUES (23041, 3, 311.75);
+INSERT INTO events VALUES (23044, 4, 312.00);
+INSERT INTO events VALUES (23047, 5, 312.25);
+INSERT INTO events VALUES (23050, 6, 312.50);
+INSERT INTO events VALUES (23053, 7, 312.75);
+INSERT INTO events VALUES (23056, 8, 313.00);
+INSERT INTO events VALUES (23059, 9, 313.25);
+INSERT INTO events VALUES (23062, 10, 313.50);
+INSERT INTO events VALUES (23065, 11, 313.75);
+INSERT INTO events VALUES (23068, 12, 314.00);
+INSERT INTO events VALUES (23071, 13, 314.25);
+INSERT INTO events VALUES (23074, 14, 314.50);
+INSERT INTO events VALUES (23077, 15, 314.75);
+INSERT INTO events VALUES (23080, 0, 315.00);
+INSERT INTO events VALUES (23083, 1, 315.25);
+INSERT INTO events VALUES (23086, 2, 315.50);
+INSERT INTO events VALUES (23089, 3, 315.75);
+INSERT INTO events VALUES (23092, 4, 316.00);
+INSERT INTO events VALUES (23095, 5, 316.25);
+INSERT INTO events VALUES (23098, 6, 316.50);
+INSERT INTO events VALUES (23101, 7, 316.75);
+INSERT INTO events VALUES (23104, 8, 317.00);
+INSERT INTO events VALUES (23107, 9, 317.25);
+INSERT INTO events VALUES (23110, 10, 317.50);
+INSERT INTO events VALUES (23113, 11, 317.75);
+INSERT INTO events VALUES (23116, 12, 318.00);
+INSERT INTO events VALUES (23119, 13, 318.25);
+INSERT INTO events VALUES (23122, 14, 318.50);
+INSERT INTO events VALUES (23125, 15, 318.75);
+INSERT INTO events VALUES (23128, 0, 319.00);
+INSERT INTO events VALUES (23131, 1, 319.25);
+INSERT INTO events VALUES (23134, 2, 319.50);
+INSERT INTO events VALUES (23137, 3, 319.75);
+INSERT INTO events VALUES (23140, 4, 320.00);
+INSERT INTO events VALUES (23143, 5, 320.25);
+INSERT INTO events VALUES (23146, 6, 320.50);
+INSERT INTO events VALUES (23149, 7, 320.75);
+INSERT INTO events VALUES (23152, 8, 321.00);
+INSERT INTO events VALUES (23155, 9, 321.25);
+INSERT INTO events VALUES (23158, 10, 321.50);
+INSERT INTO events VALUES (23161, 11, 321.75);
+INSERT INTO events VALUES (23164, 12, 322.00);
+INSERT INTO events VALUES (23167, 13, 322.25);
+INSERT INTO events VALUES (23170, 14, 322.50);
+INSERT INTO events VALUES (23173, 15, 322.75);
+INSERT INTO events VALUES (23176, 0, 323.00);
+INSERT INTO events VALUES (23179, 1, 323.25);
+INSERT INTO events VALUES (23182, 2, 323.50);
+INSERT INTO events VALUES (23185, 3, 323.75);
+INSERT INTO events VALUES (23188, 4, 324.00);
+INSERT INTO events VALUES (23191, 5, 324.25);
+INSERT INTO events VALUES (23194, 6, 324.50);
+INSERT INTO events VALUES (23197, 7, 324.75);
+INSERT INTO events VALUES (23200, 8, 300.00);
+INSERT INTO events VALUES (23203, 9, 300.25);
+INSERT INTO events VALUES (23206, 10, 300.50);
+INSERT INTO events VALUES (23209, 11, 300.75);
+INSERT INTO events VALUES (23212, 12, 301.00);
+INSERT INTO events VALUES (23215, 13, 301.25);
+INSERT INTO events VALUES (23218, 14, 301.50);
+INSERT INTO events VALUES (23221, 15, 301.75);
+INSERT INTO events VALUES (23224, 0, 302.00);
+INSERT INTO events VALUES (23227, 1, 302.25);
+INSERT INTO events VALUES (23230, 2, 302.50);
+INSERT INTO events VALUES (23233, 3, 302.75);
+INSERT INTO events VALUES (23236, 4, 303.00);
+INSERT INTO events VALUES (23239, 5, 303.25);
+INSERT INTO events VALUES (23242, 6, 303.50);
+INSERT INTO events VALUES (23245, 7, 303.75);
+INSERT INTO events VALUES (23248, 8, 304.00);
+INSERT INTO events VALUES (23251, 9, 304.25);
+INSERT INTO events VALUES (23254, 10, 304.50);
+INSERT INTO events VALUES (23257, 11, 304.75);
+INSERT INTO events VALUES (23260, 12, 305.00);
+INSERT INTO events VALUES (23263, 13, 305.25);
+INSERT INTO events VALUES (23266, 14, 305.50);
+INSERT INTO events VALUES (23269, 15, 305.75);
+INSERT INTO events VALUES (23272, 0, 306.00);
+INSERT INTO events VALUES (23275, 1, 306.25);
+INSERT INTO events VALUES (23278, 2, 306.50);
+INSERT INTO events VALUES (23281, 3, 306.75);
+INSERT INTO events VALUES (23284, 4, 307.00);
+INSERT INTO events VALUES (23287, 5, 307.25);
+INSERT INTO events VALUES (23290, 6, 307.50);
+INSERT INTO events VALUES (23293, 7, 307.75);
+INSERT INTO events VALUES (23296, 8, 308.00);
+INSERT INTO events VALUES (23299, 9, 308.25);
+INSERT INTO events VALUES (23302, 10, 308.50);
+INSERT INTO events VALUES (23305, 11, 308.75);
+INSERT INTO events VALUES (23308, 12, 309.00);
+INSERT INTO events VALUES (23311, 13, 309.25);
+INSERT INTO events VALUES (23314, 14, 309.50);
+INSERT INTO events VALUES (23317, 15, 309.75);
+INSERT INTO events VALUES (23320, 0, 310.00);
+INSERT INTO events VALUES (23323, 1, 310.25);
+INSERT INTO events VALUES (23326, 2, 310.50);
+INSERT INTO events VALUES (23329, 3, 310.75);
+INSERT INTO events VALUES (23332, 4, 311.00);
+INSERT INTO events VALUES (23335, 5, 311.25);
+INSERT INTO events VALUES (23338, 6, 311.50);
+INSERT INTO events VALUES (23341, 7, 311.75);
+INSERT INTO events VALUES (23344, 8, 312.00);
+INSERT INTO events VALUES (23347, 9, 312.25);
+INSERT INTO events VALUES (23350, 10, 312.50);
+INSERT INTO events VALUES (23353, 11, 312.75);
+INSERT INTO events VALUES (23356, 12, 313.00);
+INSERT INTO events VALUES (23359, 13, 313.25);
+INSERT INTO events VALUES (23362, 14, 313.50);
+INSERT INTO events VALUES (23365, 15, 313.75);
+INSERT INTO events VALUES (23368, 0, 314.00);
+INSERT INTO events VALUES (23371, 1, 314.25);
+INSERT INTO events VALUES (23374, 2, 314.50);
+INSERT INTO events VALUES (23377, 3, 314.75);
+INSERT INTO events VALUES (23380, 4, 315.00);
+INSERT INTO events VALUES (23383, 5, 315.25);
+INSERT INTO events VALUES (23386, 6, 315.50);
+INSERT INTO events VALUES (23389, 7, 315.75);
+INSERT INTO events VALUES (23392, 8, 316.00);
+INSERT INTO events VALUES (23395, 9, 316.25);
+INSERT INTO events VALUES (23398, 10, 316.50);
+INSERT INTO events VALUES (23401, 11, 316.75);
+INSERT INTO events VALUES (23404, 12, 317.00);
+INSERT INTO events VALUES (23407, 13, 317.25);
+INSERT INTO events VALUES (23410, 14, 317.50);
+INSERT INTO events VALUES (23413, 15, 317.75);
+INSERT INTO events VALUES (23416, 0, 318.00);
+INSERT INTO events VALUES (23419, 1, 318.25);
+INSERT INTO events VALUES (23422, 2, 318.50);
+INSERT INTO events VALUES (23425, 3, 318.75);
+INSERT INTO events VALUES (23428, 4, 319.00);
+INSERT INTO events VALUES (23431, 5, 319.25);
+INSERT INTO events VALUES (23434, 6, 319.50);
+INSERT INTO events VALUES (23437, 7, 319.75);
+INSERT INTO events VALUES (23440, 8, 320.00);
+INSERT INTO events VALUES (23443, 9, 320.25);
+INSERT INTO events VALUES (23446, 10, 320.50);
+INSERT INTO events VALUES (23449, 11, 320.75);
+INSERT INTO events VALUES (23452, 12, 321.00);
+INSERT INTO events VALUES (23455, 13, 321.25);
+INSERT INTO events VALUES (23458, 14, 321.50);
+INSERT INTO events VALUES (23461, 15, 321.75);
+INSERT INTO events VALUES (23464, 0, 322.00);
+INSERT INTO events VALUES (23467, 1, 322.25);
+INSERT INTO events VALUES (23470, 2, 322.50);
+INSERT INTO events VALUES (23473, 3, 322.75);
+INSERT INTO events VALUES (23476, 4, 323.00);
+INSERT INTO events VALUES (23479, 5, 323.25);
+INSERT INTO events VALUES (23482, 6, 323.50);
+INSERT INTO events VALUES (23485, 7, 323.75);
+INSERT INTO events VALUES (23488, 8, 324.00);
+INSERT INTO events VALUES (23491, 9, 324.25);
+INSERT INTO events VALUES (23494, 10, 324.50);
+INSERT INTO events VALUES (23497, 11, 324.75);
+INSERT INTO events VALUES (23500, 12, 300.00);
+INSERT INTO events VALUES (23503, 13, 300.25);
+INSERT INTO events VALUES (23506, 14, 300.50);
+INSERT INTO events VALUES (23509, 15, 300.75);
+INSERT INTO events VALUES (23512, 0, 301.00);
+INSERT INTO events VALUES (23515, 1, 301.25);
+INSERT INTO events VALUES (23518, 2, 301.50);
+INSERT INTO events VALUES (23521, 3, 301.75);
+INSERT INTO events VALUES (23524, 4, 302.00);
+INSERT INTO events VALUES (23527, 5, 302.25);
+INSERT INTO events VALUES (23530, 6, 302.50);
+INSERT INTO events VALUES (23533, 7, 302.75);
+INSERT INTO events VALUES (23536, 8, 303.00);
+INSERT INTO events VALUES (23539, 9, 303.25);
+INSERT INTO events VALUES (23542, 10, 303.50);
+INSERT INTO events VALUES (23545, 11, 303.75);
+INSERT INTO events VALUES (23548, 12, 304.00);
+INSERT INTO events VALUES (23551, 13, 304.25);
+INSERT INTO events VALUES (23554, 14, 304.50);
+INSERT INTO events VALUES (23557, 15, 304.75);
+INSERT INTO events VALUES (23560, 0, 305.00);
+INSERT INTO events VALUES (23563, 1, 305.25);
+INSERT INTO events VALUES (23566, 2, 305.50);
+INSERT INTO events VALUES (23569, 3, 305.75);
+INSERT INTO events VALUES (23572, 4, 306.00);
+INSERT INTO events VALUES (23575, 5, 306.25);
+INSERT INTO events VALUES (23578, 6, 306.50);
+INSERT INTO events VALUES (23581, 7, 306.75);
+INSERT INTO events VALUES (23584, 8, 307.00);
+INSERT INTO events VALUES (23587, 9, 307.25);
+INSERT INTO events VALUES (23590, 10, 307.50);
+INSERT INTO events VALUES (23593, 11, 307.75);
+INSERT INTO events VALUES (23596, 12, 308.00);
+INSERT INTO events VALUES (23599, 13, 308.25);
+INSERT INTO events VALUES (23602, 14, 308.50);
+INSERT INTO events VALUES (23605, 15, 308.75);
+INSERT INTO events VALUES (23608, 0, 309.00);
+INSERT INTO events VALUES (23611, 1, 309.25);
+INSERT INTO events VALUES (23614, 2, 309.50);
+INSERT INTO events VALUES (23617, 3, 309.75);
+INSERT INTO events VALUES (23620, 4, 310.00);
+INSERT INTO events VALUES (23623, 5, 310.25);
+INSERT INTO events VALUES (23626, 6, 310.50);
+INSERT INTO events VALUES (23629, 7, 310.75);
+INSERT INTO events VALUES (23632, 8, 311.00);
+INSERT INTO events VALUES (23635, 9, 311.25);
+INSERT INTO events VALUES (23638, 10, 311.50);
+INSERT INTO events VALUES (23641, 11, 311.75);
+INSERT INTO events VALUES (23644, 12, 312.00);
+INSERT INTO events VALUES (23647, 13, 312.25);
+INSERT INTO events VALUES (23650, 14, 312.50);
+INSERT INTO events VALUES (23653, 15, 312.75);
+INSERT INTO events VALUES (23656, 0, 313.00);
+INSERT INTO events VALUES (23659, 1, 313.25);
+INSERT INTO events VALUES (23662, 2, 313.50);
+INSERT INTO events VALUES (23665, 3, 313.75);
+INSERT INTO events VALUES (23668, 4, 314.00);
+INSERT INTO events VALUES (23671, 5, 314.25);
+INSERT INTO events VALUES (23674, 6, 314.50);
+INSERT INTO events VALUES (23677, 7, 314.75);
+INSERT INTO events VALUES (23680, 8, 315.00);
+INSERT INTO events VALUES (23683, 9, 315.25);
+INSERT INTO events VALUES (23686, 10, 315.50);
+INSERT INTO events VALUES (23689, 11, 315.75);
+INSERT INTO events VALUES (23692, 12, 316.00);
+INSERT INTO events VALUES (23695, 13, 316.25);
+INSERT INTO events VALUES (23698, 14, 316.50);
+INSERT INTO events VALUES (23701, 15, 316.75);
+INSERT INTO events VALUES (23704, 0, 317.00);
+INSERT INTO events VALUES (23707, 1, 317.25);
+INSERT INTO events VALUES (23710, 2, 317.50);
+INSERT INTO events VALUES (23713, 3, 317.75);
+INSERT INTO events VALUES (23716, 4, 318.00);
+INSERT INTO events VALUES (23719, 5, 318.25);
+INSERT INTO events VALUES (23722, 6, 318.50);
+INSERT INTO events VALUES (23725, 7, 318.75);
+INSERT INTO events VALUES (23728, 8, 319.00);
+INSERT INTO events VALUES (23731, 9, 319.25);
+INSERT INTO events VALUES (23734, 10, 319.50);
+INSERT INTO events VALUES (23737, 11, 319.75);
+INSERT INTO events VALUES (23740, 12, 320.00);
+INSERT INTO events VALUES (23743, 13, 320.25);
+INSERT INTO events VALUES (23746, 14, 320.50);
+INSERT INTO events VALUES (23749, 15, 320.75);
+INSERT INTO events VALUES (23752, 0, 321.00);
+INSERT INTO events VALUES (23755, 1, 321.25);
+INSERT INTO events VALUES (23758, 2, 321.50);
+INSERT INTO events VALUES (23761, 3, 321.75);
+INSERT INTO events VALUES (23764, 4, 322.00);
+INSERT INTO events VALUES (23767, 5, 322.25);
+INSERT INTO events VALUES (23770, 6, 322.50);
+INSERT INTO events VALUES (23773, 7, 322.75);
+INSERT INTO events VALUES (23776, 8, 323.00);
+INSERT INTO events VALUES (23779, 9, 323.25);
+INSERT INTO events VALUES (23782, 10, 323.50);
+INSERT INTO events VALUES (23785, 11, 323.75);
+INSERT INTO events VALUES (23788, 12, 324.00);
+INSERT INTO events VALUES (23791, 13, 324.25);
+INSERT INTO events VALUES (23794, 14, 324.50);
+INSERT INTO events VALUES (23797, 15, 324.75);
+INSERT INTO events VALUES (23800, 0, 300.00);
+INSERT INTO events VALUES (23803, 1, 300.25);
+INSERT INTO events VALUES (23806, 2, 300.50);
+INSERT INTO events VALUES (23809, 3, 300.75);
+INSERT INTO events VALUES (23812, 4, 301.00);
+INSERT INTO events VALUES (23815, 5, 301.25);
+INSERT INTO events VALUES (23818, 6, 301.50);
+INSERT INTO events VALUES (23821, 7, 301.75);
+INSERT INTO events VALUES (23824, 8, 302.00);
+INSERT INTO events VALUES (23827, 9, 302.25);
+INSERT INTO events VALUES (23830, 10, 302.50);
+INSERT INTO events VALUES (23833, 11, 302.75);
+INSERT INTO events VALUES (23836, 12, 303.00);
+INSERT INTO events VALUES (23839, 13, 303.25);
+INSERT INTO events VALUES (23842, 14, 303.50);
+INSERT INTO events VALUES (23845, 15, 303.75);
+INSERT INTO events VALUES (23848, 0, 304.00);
+INSERT INTO events VALUES (23851, 1, 304.25);
+INSERT INTO events VALUES (23854, 2, 304.50);
+INSERT INTO events VALUES (23857, 3, 304.75);
+INSERT INTO events VALUES (23860, 4, 305.00);
+INSERT INTO events VALUES (23863, 5, 305.25);
+INSERT INTO events VALUES (23866, 6, 305.50);
+INSERT INTO events VALUES (23869, 7, 305.75);
+INSERT INTO events VALUES (23872, 8, 306.00);
+INSERT INTO events VALUES (23875, 9, 306.25);
+INSERT INTO events VALUES (23878, 10, 306.50);
+INSERT INTO events VALUES (23881, 11, 306.75);
+INSERT INTO events VALUES (23884, 12, 307.00);
+INSERT INTO events VALUES (23887, 13, 307.25);
+INSERT INTO events VALUES (23890, 14, 307.50);
+INSERT INTO events VALUES (23893, 15, 307.75);
+INSERT INTO events VALUES (23896, 0, 308.00);
+INSERT INTO events VALUES (23899, 1, 308.25);
+INSERT INTO events VALUES (23902, 2, 308.50);
+INSERT INTO events VALUES (23905, 3, 308.75);
+INSERT INTO events VALUES (23908, 4, 309.00);
+INSERT INTO events VALUES (23911, 5, 309.25);
+INSERT INTO events VALUES (23914, 6, 309.50);
+INSERT INTO events VALUES (23917, 7, 309.75);
+INSERT INTO events VALUES (23920, 8, 310.00);
+INSERT INTO events VALUES (23923, 9, 310.25);
+INSERT INTO events VALUES (23926, 10, 310.50);
+INSERT INTO events VALUES (23929, 11, 310.75);
+INSERT INTO events VALUES (23932, 12, 311.00);
+INSERT INTO events VALUES (23935, 13, 311.25);
+INSERT INTO events VALUES (23938, 14, 311.50);
+INSERT INTO events VALUES (23941, 15, 311.75);
+INSERT INTO events VALUES (23944, 0, 312.00);
+INSERT INTO events VALUES (23947, 1, 312.25);
+INSERT INTO events VALUES (23950, 2, 312.50);
+INSERT INTO events VALUES (23953, 3, 312.75);
+INSERT INTO events VALUES (23956, 4, 313.00);
+INSERT INTO events VALUES (23959, 5, 313.25);
+INSERT INTO events VALUES (23962, 6, 313.50);
+INSERT INTO events VALUES (23965, 7, 313.75);
+INSERT INTO events VALUES (23968, 8, 314.00);
+INSERT INTO events VALUES (23971, 9, 314.25);
+INSERT INTO events VALUES (23974, 10, 314.50);
+INSERT INTO events VALUES (23977, 11, 314.75);
+INSERT INTO events VALUES (23980, 12, 315.00);
+INSERT INTO events VALUES (23983, 13, 315.25);
+INSERT INTO events VALUES (23986, 14, 315.50);
+INSERT INTO events VALUES (23989, 15, 315.75);
+INSERT INTO events VALUES (23992, 0, 316.00);
+INSERT INTO events VALUES (23995, 1, 316.25);
+INSERT INTO events VALUES (23998, 2, 316.50);
+INSERT INTO events VALUES (24001, 3, 316.75);
+INSERT INTO events VALUES (24004, 4, 317.00);
+INSERT INTO events VALUES (24007, 5, 317.25);
+INSERT INTO events VALUES (24010, 6, 317.50);
+INSERT INTO events VALUES (24013, 7, 317.75);
+INSERT INTO events VALUES (24016, 8, 318.00);
+INSERT INTO events VALUES (24019, 9, 318.25);
+INSERT INTO events VALUES (24022, 10, 318.50);
+INSERT INTO events VALUES (24025, 11, 318.75);
+INSERT INTO events VALUES (24028, 12, 319.00);
+INSERT INTO events VALUES (24031, 13, 319.25);
+INSERT INTO events VALUES (24034, 14, 319.50);
+INSERT INTO events VALUES (24037, 15, 319.75);
+INSERT INTO events VALUES (24040, 0, 320.00);
+INSERT INTO events VALUES (24043, 1, 320.25);
+INSERT INTO events VALUES (24046, 2, 320.50);
+INSERT INTO events VALUES (24049, 3, 320.75);
+INSERT INTO events VALUES (24052, 4, 321.00);
+INSERT INTO events VALUES (24055, 5, 321.25);
+INSERT INTO events VALUES (24058, 6, 321.50);
+INSERT INTO events VALUES (24061, 7, 321.75);
+INSERT INTO events VALUES (24064, 8, 322.00);
+INSERT INTO events VALUES (24067, 9, 322.25);
+INSERT INTO events VALUES (24070, 10, 322.50);
+INSERT INTO events VALUES (24073, 11, 322.75);
+INSERT INTO events VALUES (24076, 12, 323.00);
+INSERT INTO events VALUES (24079, 13, 323.25);
+INSERT INTO events VALUES (24082, 14, 323.50);
+INSERT INTO events VALUES (24085, 15, 323.75);
+INSERT INTO events VALUES (24088, 0, 324.00);
+INSERT INTO events VALUES (24091, 1, 324.25);
+INSERT INTO events VALUES (24094, 2, 324.50);
+INSERT INTO events VALUES (24097, 3, 324.75);
+INSERT INTO events VALUES (24100, 4, 300.00);
+INSERT INTO events VALUES (24103, 5, 300.25);
+INSERT INTO events VALUES (24106, 6, 300.50);
+INSERT INTO events VALUES (24109, 7, 300.75);
+INSERT INTO events VALUES (24112, 8, 301.00);
+INSERT INTO events VALUES (24115, 9, 301.25);
+INSERT INTO events VALUES (24118, 10, 301.50);
+INSERT INTO events VALUES (24121, 11, 301.75);
+INSERT INTO events VALUES (24124, 12, 302.00);
+INSERT INTO events VALUES (24127, 13, 302.25);
+INSERT INTO events VALUES (24130, 14, 302.50);
+INSERT INTO events VALUES (24133, 15, 302.75);
+INSERT INTO events VALUES (24136, 0, 303.00);
+INSERT INTO events VALUES (24139, 1, 303.25);
+INSERT INTO events VALUES (24142, 2, 303.50);
+INSERT INTO events VALUES (24145, 3, 303.75);
+INSERT INTO events VALUES (24148, 4, 304.00);
+INSERT INTO events VALUES (24151, 5, 304.25);
+INSERT INTO events VALUES (24154, 6, 304.50);
+INSERT INTO events VALUES (24157, 7, 304.75);
+INSERT INTO events VALUES (24160, 8, 305.00);
+INSERT INTO events VALUES (24163, 9, 305.25);
+INSERT INTO events VALUES (24166, 10, 305.50);
+INSERT INTO events VALUES (24169, 11, 305.75);
+INSERT INTO events VALUES (24172, 12, 306.00);
+INSERT INTO events VALUES (24175, 13, 306.25);
+INSERT INTO events VALUES (24178, 14, 306.50);
+INSERT INTO events VALUES (24181, 15, 306.75);
+INSERT INTO events VALUES (24184, 0, 307.00);
+INSERT INTO events VALUES (24187, 1, 307.25);
+INSERT INTO events VALUES (24190, 2, 307.50);
+INSERT INTO events VALUES (24193, 3, 307.75);
+INSERT INTO events VALUES (24196, 4, 308.00);
+INSERT INTO events VALUES (24199, 5, 308.25);
+INSERT INTO events VALUES (24202, 6, 308.50);
+INSERT INTO events VALUES (24205, 7, 308.75);
+INSERT INTO events VALUES (24208, 8, 309.00);
+INSERT INTO events VALUES (24211, 9, 309.25);
+INSERT INTO events VALUES (24214, 10, 309.50);
+INSERT INTO events VALUES (24217, 11, 309.75);
+INSERT INTO events VALUES (24220, 12, 310.00);
+INSERT INTO events VALUES (24223, 13, 310.25);
+INSERT INTO events VALUES (24226, 14, 310.50);
+INSERT INTO events VALUES (24229, 15, 310.75);
+INSERT INTO events VALUES (24232, 0, 311.00);
+INSERT INTO events VALUES (24235, 1, 311.25);
+INSERT INTO events VALUES (24238, 2, 311.50);
+INSERT INTO events VALUES (24241, 3, 311.75);
+INSERT INTO events VALUES (24244, 4, 312.00);
+INSERT INTO events VALUES (24247, 5, 312.25);
+INSERT INTO events VALUES (24250, 6, 312.50);
+INSERT INTO events VALUES (24253, 7, 312.75);
+INSERT INTO events VALUES (24256, 8, 313.00);
+INSERT INTO events VALUES (24259, 9, 313.25);
+INSERT INTO events VALUES (24262, 10, 313.50);
+INSERT INTO events VALUES (24265, 11, 313.75);
+INSERT INTO events VALUES (24268, 12, 314.00);
+INSERT INTO events VALUES (24271, 13, 314.25);
+INSERT INTO events VALUES (24274, 14, 314.50);
+INSERT INTO events VALUES (24277, 15, 314.75);
+INSERT INTO events VALUES (24280, 0, 315.00);
+INSERT INTO events VALUES (24283, 1, 315.25);
+INSERT INTO events VALUES (24286, 2, 315.50);
+INSERT INTO events VALUES (24289, 3, 315.75);
+INSERT INTO events VALUES (24292, 4, 316.00);
+INSERT INTO events VALUES (24295, 5, 316.25);
+INSERT INTO events VALUES (24298, 6, 316.50);
+INSERT INTO events VALUES (24301, 7, 316.75);
+INSERT INTO events VALUES (24304, 8, 317.00);
+INSERT INTO events VALUES (24307, 9, 317.25);
+INSERT INTO events VALUES (24310, 10, 317.50);
+INSERT INTO events VALUES (24313, 11, 317.75);
+INSERT INTO events VALUES (24316, 12, 318.00);
+INSERT INTO events VALUES (24319, 13, 318.25);
+INSERT INTO events VALUES (24322, 14, 318.50);
+INSERT INTO events VALUES (24325, 15, 318.75);
+INSERT INTO events VALUES (24328, 0, 319.00);
+INSERT INTO events VALUES (24331, 1, 319.25);
+INSERT INTO events VALUES (24334, 2, 319.50);
+INSERT INTO events VALUES (24337, 3, 319.75);
+INSERT INTO events VALUES (24340, 4, 320.00);
+INSERT INTO events VALUES (24343, 5, 320.25);
+INSERT INTO events VALUES (24346, 6, 320.50);
+INSERT INTO events VALUES (24349, 7, 320.75);
+INSERT INTO events VALUES (24352, 8, 321.00);
+INSERT INTO events VALUES (24355, 9, 321.25);
+INSERT INTO events VALUES (24358, 10, 321.50);
+INSERT INTO events VALUES (24361, 11, 321.75);
+INSERT INTO events VALUES (24364, 12, 322.00);
+INSERT INTO events VALUES (24367, 13, 322.25);
+INSERT INTO events VALUES (24370, 14, 322.50);
+INSERT INTO events VALUES (24373, 15, 322.75);
+INSERT INTO events VALUES (24376, 0, 323.00);
+INSERT INTO events VALUES (24379, 1, 323.25);
+INSERT INTO events VALUES (24382, 2, 323.50);
+INSERT INTO events VALUES (24385, 3, 323.75);
+INSERT INTO events VALUES (24388, 4, 324.00);
+INSERT INTO events VALUES (24391, 5, 324.25);
+INSERT INTO events VALUES (24394, 6, 324.50);
+INSERT INTO events VALUES (24397, 7, 324.75);
+INSERT INTO events VALUES (24400, 8, 300.00);
+INSERT INTO events VALUES (24403, 9, 300.25);
+INSERT INTO events VALUES (24406, 10, 300.50);
+INSERT INTO events VALUES (24409, 11, 300.75);
+INSERT INTO events VALUES (24412, 12, 301.00);
+INSERT INTO events VALUES (24415, 13, 301.25);
+INSERT INTO events VALUES (24418, 14, 301.50);
+INSERT INTO events VALUES (24421, 15, 301.75);
+INSERT INTO events VALUES (24424, 0, 302.00);
+INSERT INTO events VALUES (24427, 1, 302.25);
+INSERT INTO events VALUES (24430, 2, 302.50);
+INSERT INTO events VALUES (24433, 3, 302.75);
+INSERT INTO events VALUES (24436, 4, 303.00);
+INSERT INTO events VALUES (24439, 5, 303.25);
+INSERT INTO events VALUES (24442, 6, 303.50);
+INSERT INTO events VALUES (24445, 7, 303.75);
+INSERT INTO events VALUES (24448, 8, 304.00);
+INSERT INTO events VALUES (24451, 9, 304.25);
+INSERT INTO events VALUES (24454, 10, 304.50);
+INSERT INTO events VALUES (24457, 11, 304.75);
+INSERT INTO events VALUES (24460, 12, 305.00);
+INSERT INTO events VALUES (24463, 13, 305.25);
+INSERT INTO events VALUES (24466, 14, 305.50);
+INSERT INTO events VALUES (24469, 15, 305.75);
+INSERT INTO events VALUES (24472, 0, 306.00);
+INSERT INTO events VALUES (24475, 1, 306.25);
+INSERT INTO events VALUES (24478, 2, 306.50);
+INSERT INTO events VALUES (24481, 3, 306.75);
+INSERT INTO events VALUES (24484, 4, 307.00);
+INSERT INTO events VALUES (24487, 5, 307.25);
+INSERT INTO events VALUES (24490, 6, 307.50);
+INSERT INTO events VALUES (24493, 7, 307.75);
+INSERT INTO events VALUES (24496, 8, 308.00);
+INSERT INTO events VALUES (24499, 9, 308.25);
+INSERT INTO events VALUES (24502, 10, 308.50);
+INSERT INTO events VALUES (24505, 11, 308.75);
+INSERT INTO events VALUES (24508, 12, 309.00);
+INSERT INTO events VALUES (24511, 13, 309.25);
+INSERT INTO events VALUES (24514, 14, 309.50);
+INSERT INTO events VALUES (24517, 15, 309.75);
+INSERT INTO events VALUES (24520, 0, 310.00);
+INSERT INTO events VALUES (24523, 1, 310.25);
+INSERT INTO events VALUES (24526, 2, 310.50);
+INSERT INTO events VALUES (24529, 3, 310.75);
+INSERT INTO events VALUES (24532, 4, 311.00);
+INSERT INTO events VALUES (24535, 5, 311.25);
+INSERT INTO events VALUES (24538, 6, 311.50);
+INSERT INTO events VALUES (24541, 7, 311.75);
+INSERT INTO events VALUES (24544, 8, 312.00);
+INSERT INTO events VALUES (24547, 9, 312.25);
+INSERT INTO events VALUES (24550, 10, 312.50);
+INSERT INTO events VALUES (24553, 11, 312.75);
+INSERT INTO events VALUES (24556, 12, 313.00);
+INSERT INTO events VALUES (24559, 13, 313.25);
+INSERT INTO events VALUES (24562, 14, 313.50);
+INSERT INTO events VALUES (24565, 15, 313.75);
+INSERT INTO events VALUES (24568, 0, 314.00);
+INSERT INTO events VALUES (24571, 1, 314.25);
+INSERT INTO events VALUES (24574, 2, 314.50);
+INSERT INTO events VALUES (24577, 3, 314.75);
+INSERT INTO events VALUES (24580, 4, 315.00);
+INSERT INTO events VALUES (24583, 5, 315.25);
+INSERT INTO events VALUES (24586, 6, 315.50);
+INSERT INTO events VALUES (24589, 7, 315.75);
+INSERT INTO events VALUES (24592, 8, 316.00);
+INSERT INTO events VALUES (24595, 9, 316.25);
+INSERT INTO events VALUES (24598, 10, 316.50);
+INSERT INTO events VALUES (24601, 11, 316.75);
+INSERT INTO events VALUES (24604, 12, 317.00);
+INSERT INTO events VALUES (24607, 13, 317.25);
+INSERT INTO events VALUES (24610, 14, 317.50);
+INSERT INTO events VALUES (24613, 15, 317.75);
+INSERT INTO events VALUES (24616, 0, 318.00);
+INSERT INTO events VALUES (24619, 1, 318.25);
+INSERT INTO events VALUES (24622, 2, 318.50);
+INSERT INTO events VALUES (24625, 3, 318.75);
+INSERT INTO events VALUES (24628, 4, 319.00);
+INSERT INTO events VALUES (24631, 5, 319.25);
+INSERT INTO events VALUES (24634, 6, 319.50);
+INSERT INTO events VALUES (24637, 7, 319.75);
+INSERT INTO events VALUES (24640, 8, 320.00);
+INSERT INTO events VALUES (24643, 9, 320.25);
+INSERT INTO events VALUES (24646, 10, 320.50);
+INSERT INTO events VALUES (24649, 11, 320.75);
+INSERT INTO events VALUES (24652, 12, 321.00);
+INSERT INTO events VALUES (24655, 13, 321.25);
+INSERT INTO events VALUES (24658, 14, 321.50);
+INSERT INTO events VALUES (24661, 15, 321.75);
+INSERT INTO events VALUES (24664, 0, 322.00);
+INSERT INTO events VALUES (24667, 1, 322.25);
+INSERT INTO events VALUES (24670, 2, 322.50);
+INSERT INTO events VALUES (24673, 3, 322.75);
+INSERT INTO events VALUES (24676, 4, 323.00);
+INSERT INTO events VALUES (24679, 5, 323.25);
+INSERT INTO events VALUES (24682, 6, 323.50);
+INSERT INTO events VALUES (24685, 7, 323.75);
+INSERT INTO events VALUES (24688, 8, 324.00);
+INSERT INTO events VALUES (24691, 9, 324.25);
+INSERT INTO events VALUES (24694, 10, 324.50);
+INSERT INTO events VALUES (24697, 11, 324.75);
+INSERT INTO events VALUES (24700, 12, 300.00);
+INSERT INTO events VALUES (24703, 13, 300.25);
+INSERT INTO events VALUES (24706, 14, 300.50);
+INSERT INTO events VALUES (24709, 15, 300.75);
+INSERT INTO events VALUES (24712, 0, 301.00);
+INSERT INTO events VALUES (24715, 1, 301.25);
+INSERT INTO events VALUES (24718, 2, 301.50);
+INSERT INTO events VALUES (24721, 3, 301.75);
+INSERT INTO events VALUES (24724, 4, 302.00);
+INSERT INTO events VALUES (24727, 5, 302.25);
+INSERT INTO events VALUES (24730, 6, 302.50);
+INSERT INTO events VALUES (24733, 7, 302.75);
+INSERT INTO events VALUES (24736, 8, 303.00);
+INSERT INTO events VALUES (24739, 9, 303.25);
+INSERT INTO events VALUES (24742, 10, 303.50);
+INSERT INTO events VALUES (24745, 11, 303.75);
+INSERT INTO events VALUES (24748, 12, 304.00);
+INSERT INTO events VALUES (24751, 13, 304.25);
+INSERT INTO events VALUES (24754, 14, 304.50);
+INSERT INTO events VALUES (24757, 15, 304.75);
+INSERT INTO events VALUES (24760, 0, 305.00);
+INSERT INTO events VALUES (24763, 1, 305.25);
+INSERT INTO events VALUES (24766, 2, 305.50);
+INSERT INTO events VALUES (24769, 3, 305.75);
+INSERT INTO events VALUES (24772, 4, 306.00);
+INSERT INTO events VALUES (24775, 5, 306.25);
+INSERT INTO events VALUES (24778, 6, 306.50);
+INSERT INTO events VALUES (24781, 7, 306.75);
+INSERT INTO events VALUES (24784, 8, 307.00);
+INSERT INTO events VALUES (24787, 9, 307.25);
+INSERT INTO events VALUES (24790, 10, 307.50);
+INSERT INTO events VALUES (24793, 11, 307.75);
+INSERT INTO events VALUES (24796, 12, 308.00);
+INSERT INTO events VALUES (24799, 13, 308.25);
+INSERT INTO events VALUES (24802, 14, 308.50);
+INSERT INTO events VALUES (24805, 15, 308.75);
+INSERT INTO events VALUES (24808, 0, 309.00);
+INSERT INTO events VALUES (24811, 1, 309.25);
+INSERT INTO events VALUES (24814, 2, 309.50);
+INSERT INTO events VALUES (24817, 3, 309.75);
+INSERT INTO events VALUES (24820, 4, 310.00);
+INSERT INTO events VALUES (24823, 5, 310.25);
+INSERT INTO events VALUES (24826, 6, 310.50);
+INSERT INTO events VALUES (24829, 7, 310.75);
+INSERT INTO events VALUES (24832, 8, 311.00);
+INSERT INTO events VALUES (24835, 9, 311.25);
+INSERT INTO events VALUES (24838, 10, 311.50);
+INSERT INTO events VALUES (24841, 11, 311.75);
+INSERT INTO events VALUES (24844, 12, 312.00);
+INSERT INTO events VALUES (24847, 13, 312.25);
+INSERT INTO events VALUES (24850, 14, 312.50);
+INSERT INTO events VALUES (24853, 15, 312.75);
+INSERT INTO events VALUES (24856, 0, 313.00);
+INSERT INTO events VALUES (24859, 1, 313.25);
+INSERT INTO events VALUES (24862, 2, 313.50);
+INSERT INTO events VALUES (24865, 3, 313.75);
+INSERT INTO events VALUES (24868, 4, 314.00);
+INSERT INTO events VALUES (24871, 5, 314.25);
+INSERT INTO events VALUES (24874, 6, 314.50);
+INSERT INTO events VALUES (24877, 7, 314.75);
+INSERT INTO events VALUES (24880, 8, 315.00);
+INSERT INTO events VALUES (24883, 9, 315.25);
+INSERT INTO events VALUES (24886, 10, 315.50);
+INSERT INTO events VALUES (24889, 11, 315.75);
+INSERT INTO events VALUES (24892, 12, 316.00);
+INSERT INTO events VALUES (24895, 13, 316.25);
+INSERT INTO events VALUES (24898, 14, 316.50);
+INSERT INTO events VALUES (24901, 15, 316.75);
+INSERT INTO events VALUES (24904, 0, 317.00);
+INSERT INTO events VALUES (24907, 1, 317.25);
+INSERT INTO events VALUES (24910, 2, 317.50);
+INSERT INTO events VALUES (24913, 3, 317.75);
+INSERT INTO events VALUES (24916, 4, 318.00);
+INSERT INTO events VALUES (24919, 5, 318.25);
+INSERT INTO events VALUES (24922, 6, 318.50);
+INSERT INTO events VALUES (24925, 7, 318.75);
+INSERT INTO events VALUES (24928, 8, 319.00);
+INSERT INTO events VALUES (24931, 9, 319.25);
+INSERT INTO events VALUES (24934, 10, 319.50);
+INSERT INTO events VALUES (24937, 11, 319.75);
+INSERT INTO events VALUES (24940, 12, 320.00);
+INSERT INTO events VALUES (24943, 13, 320.25);
+INSERT INTO events VALUES (24946, 14, 320.50);
+INSERT INTO events VALUES (24949, 15, 320.75);
+INSERT INTO events VALUES (24952, 0, 321.00);
+INSERT INTO events VALUES (24955, 1, 321.25);
+INSERT INTO events VALUES (24958, 2, 321.50);
+INSERT INTO events VALUES (24961, 3, 321.75);
+INSERT INTO events VALUES (24964, 4, 322.00);
+INSERT INTO events VALUES (24967, 5, 322.25);
+INSERT INTO events VALUES (24970, 6, 322.50);
+INSERT INTO events VALUES (24973, 7, 322.75);
+INSERT INTO events VALUES (24976, 8, 323.00);
+INSERT INTO events VALUES (24979, 9, 323.25);
+INSERT INTO events VALUES (24982, 10, 323.50);
+INSERT INTO events VALUES (24985, 11, 323.75);
+INSERT INTO events VALUES (24988, 12, 324.00);
+INSERT INTO events VALUES (24991, 13, 324.25);
+INSERT INTO events VALUES (24994, 14, 324.50);
+INSERT INTO events VALUES (24997, 15, 324.75);
+INSERT INTO events VALUES (25000, 0, 300.00);
+INSERT INTO events VALUES (25003, 1, 300.25);
+INSERT INTO events VALUES (25006, 2, 300.50);
+INSERT INTO events VALUES (25009, 3, 300.75);
+INSERT INTO events VALUES (25012, 4, 301.00);
+INSERT INTO events VALUES (25015, 5, 301.25);
+INSERT INTO events VALUES (25018, 6, 301.50);
+INSERT INTO events VALUES (25021, 7, 301.75);
+INSERT INTO events VALUES (25024, 8, 302.00);
+INSERT INTO events VALUES (25027, 9, 302.25);
+INSERT INTO events VALUES (25030, 10, 302.50);
+INSERT INTO events VALUES (25033, 11, 302.75);
+INSERT INTO events VALUES (25036, 12, 303.00);
+INSERT INTO events VALUES (25039, 13, 303.25);
+INSERT INTO events VALUES (25042, 14, 303.50);
+INSERT INTO events VALUES (25045, 15, 303.75);
+INSERT INTO events VALUES (25048, 0, 304.00);
+INSERT INTO events VALUES (25051, 1, 304.25);
+INSERT INTO events VALUES (25054, 2, 304.50);
+INSERT INTO events VALUES (25057, 3, 304.75);
+INSERT INTO events VALUES (25060, 4, 305.00);
+INSERT INTO events VALUES (25063, 5, 305.25);
+INSERT INTO events VALUES (25066, 6, 305.50);
+INSERT INTO events VALUES (25069, 7, 305.75);
+INSERT INTO events VALUES (25072, 8, 306.00);
+INSERT INTO events VALUES (25075, 9, 306.25);
+INSERT INTO events VALUES (25078, 10, 306.50);
+INSERT INTO events VALUES (25081, 11, 306.75);
+INSERT INTO events VALUES (25084, 12, 307.00);
+INSERT INTO events VALUES (25087, 13, 307.25);
+INSERT INTO events VALUES (25090, 14, 307.50);
+INSERT INTO events VALUES (25093, 15, 307.75);
+INSERT INTO events VALUES (25096, 0, 308.00);
+INSERT INTO events VALUES (25099, 1, 308.25);
+INSERT INTO events VALUES (25102, 2, 308.50);
+INSERT INTO events VALUES (25105, 3, 308.75);
+INSERT INTO events VALUES (25108, 4, 309.00);
+INSERT INTO events VALUES (25111, 5, 309.25);
+INSERT INTO events VALUES (25114, 6, 309.50);
+INSERT INTO events VALUES (25117, 7, 309.75);
+INSERT INTO events VALUES (25120, 8, 310.00);
+INSERT INTO events VALUES (25123, 9, 310.25);
+INSERT INTO events VALUES (25126, 10, 310.50);
+INSERT INTO events VALUES (25129, 11, 310.75);
+INSERT INTO events VALUES (25132, 12, 311.00);
+INSERT INTO events VALUES (25135, 13, 311.25);
+INSERT INTO events VALUES (25138, 14, 311.50);
+INSERT INTO events VALUES (25141, 15, 311.75);
+INSERT INTO events VALUES (25144, 0, 312.00);
+INSERT INTO events VALUES (25147, 1, 312.25);
+INSERT INTO events VALUES (25150, 2, 312.50);
+INSERT INTO events VALUES (25153, 3, 312.75);
+INSERT INTO events VALUES (25156, 4, 313.00);
+INSERT INTO events VALUES (25159, 5, 313.25);
+INSERT INTO events VALUES (25162, 6, 313.50);
+INSERT INTO events VALUES (25165, 7, 313.75);
+INSERT INTO events VALUES (25168, 8, 314.00);
+INSERT INTO events VALUES (25171, 9, 314.25);
+INSERT INTO events VALUES (25174, 10, 314.50);
+INSERT INTO events VALUES (25177, 11, 314.75);
+INSERT INTO events VALUES (25180, 12, 315.00);
+INSERT INTO events VALUES (25183, 13, 315.25);
+INSERT INTO events VALUES (25186, 14, 315.50);
+INSERT INTO events VALUES (25189, 15, 315.75);
+INSERT INTO events VALUES (25192, 0, 316.00);
+INSERT INTO events VALUES (25195, 1, 316.25);
+INSERT INTO events VALUES (25198, 2, 316.50);
+INSERT INTO events VALUES (25201, 3, 316.75);
+INSERT INTO events VALUES (25204, 4, 317.00);
+INSERT INTO events VALUES (25207, 5, 317.25);
+INSERT INTO events VALUES (25210, 6, 317.50);
+INSERT INTO events VALUES (25213, 7, 317.75);
+INSERT INTO events VALUES (25216, 8, 318.00);
+INSERT INTO events VALUES (25219, 9, 318.25);
+INSERT INTO events VALUES (25222, 10, 318.50);
+INSERT INTO events VALUES (25225, 11, 318.75);
+INSERT INTO events VALUES (25228, 12, 319.00);
+INSERT INTO events VALUES (25231, 13, 319.25);
+INSERT INTO events VALUES (25234, 14, 319.50);
+INSERT INTO events VALUES (25237, 15, 319.75);
+INSERT INTO events VALUES (25240, 0, 320.00);
+INSERT INTO events VALUES (25243, 1, 320.25);
+INSERT INTO events VALUES (25246, 2, 320.50);
+INSERT INTO events VALUES (25249, 3, 320.75);
+INSERT INTO events VALUES (25252, 4, 321.00);
+INSERT INTO events VALUES (25255, 5, 321.25);
+INSERT INTO events VALUES (25258, 6, 321.50);
+INSERT INTO events VALUES (25261, 7, 321.75);
+INSERT INTO events VALUES (25264, 8, 322.00);
+INSERT INTO events VALUES (25267, 9, 322.25);
+INSERT INTO events VALUES (25270, 10, 322.50);
+INSERT INTO events VALUES (25273, 11, 322.75);
+INSERT INTO events VALUES (25276, 12, 323.00);
+INSERT INTO events VALUES (25279, 13, 323.25);
+INSERT INTO events VALUES (25282, 14, 323.50);
+INSERT INTO events VALUES (25285, 15, 323.75);
+INSERT INTO events VALUES (25288, 0, 324.00);
+INSERT INTO events VALUES (25291, 1, 324.25);
+INSERT INTO events VALUES (25294, 2, 324.50);
+INSERT INTO events VALUES (25297, 3, 324.75);
+INSERT INTO events VALUES (25300, 4, 300.00);
+INSERT INTO events VALUES (25303, 5, 300.25);
+INSERT INTO events VALUES (25306, 6, 300.50);
+INSERT INTO events VALUES (25309, 7, 300.75);
+INSERT INTO events VALUES (25312, 8, 301.00);
+INSERT INTO events VALUES (25315, 9, 301.25);
+INSERT INTO events VALUES (25318, 10, 301.50);
+INSERT INTO events VALUES (25321, 11, 301.75);
+INSERT INTO events VALUES (25324, 12, 302.00);
+INSERT INTO events VALUES (25327, 13, 302.25);
+INSERT INTO events VALUES (25330, 14, 302.50);
+INSERT INTO events VALUES (25333, 15, 302.75);
+INSERT INTO events VALUES (25336, 0, 303.00);
+INSERT INTO events VALUES (25339, 1, 303.25);
+INSERT INTO events VALUES (25342, 2, 303.50);
+INSERT INTO events VALUES (25345, 3, 303.75);
+INSERT INTO events VALUES (25348, 4, 304.00);
+INSERT INTO events VALUES (25351, 5, 304.25);
+INSERT INTO events VALUES (25354, 6, 304.50);
+INSERT INTO events VALUES (25357, 7, 304.75);
+INSERT INTO events VALUES (25360, 8, 305.00);
+INSERT INTO events VALUES (25363, 9, 305.25);
+INSERT INTO events VALUES (25366, 10, 305.50);
+INSERT INTO events VALUES (25369, 11, 305.75);
+INSERT INTO events VALUES (25372, 12, 306.00);
+INSERT INTO events VALUES (25375, 13, 306.25);
+INSERT INTO events VALUES (25378, 14, 306.50);
+INSERT INTO events VALUES (25381, 15, 306.75);
+INSERT INTO events VALUES (25384, 0, 307.00);
+INSERT INTO events VALUES (25387, 1, 307.25);
+INSERT INTO events VALUES (25390, 2, 307.50);
+INSERT INTO events VALUES (25393, 3, 307.75);
+INSERT INTO events VALUES (25396, 4, 308.00);
+INSERT INTO events VALUES (25399, 5, 308.25);
+INSERT INTO events VALUES (25402, 6, 308.50);
+INSERT INTO events VALUES (25405, 7, 308.75);
+INSERT INTO events VALUES (25408, 8, 309.00);
+INSERT INTO events VALUES (25411, 9, 309.25);
+INSERT INTO events VALUES (25414, 10, 309.50);
+INSERT INTO events VALUES (25417, 11, 309.75);
+INSERT INTO events VALUES (25420, 12, 310.00);
+INSERT INTO events VALUES (25423, 13, 310.25);
+INSERT INTO events VALUES (25426, 14, 310.50);
+INSERT INTO events VALUES (25429, 15, 310.75);
+INSERT INTO events VALUES (25432, 0, 311.00);
+INSERT INTO events VALUES (25435, 1, 311.25);
+INSERT INTO events VALUES (25438, 2, 311.50);
+INSERT INTO events VALUES (25441, 3, 311.75);
+INSERT INTO events VALUES (25444, 4, 312.00);
+INSERT INTO events VALUES (25447, 5, 312.25);
+INSERT INTO events VALUES (25450, 6, 312.50);
+INSERT INTO events VALUES (25453, 7, 312.75);
+INSERT INTO events VALUES (25456, 8, 313.00);
+INSERT INTO events VALUES (25459, 9, 313.25);
+INSERT INTO events VALUES (25462, 10, 313.50);
+INSERT INTO events VALUES (25465, 11, 313.75);
+INSERT INTO events VALUES (25468, 12, 314.00);
+INSERT INTO events VALUES (25471, 13, 314.25);
+INSERT INTO events VALUES (25474, 14, 314.50);
+INSERT INTO events VALUES (25477, 15, 314.75);
+INSERT INTO events VALUES (25480, 0, 315.00);
+INSERT INTO events VALUES (25483, 1, 315.25);
+INSERT INTO events VALUES (25486, 2, 315.50);
+INSERT INTO events VALUES (25489, 3, 315.75);
+INSERT INTO events VALUES (25492, 4, 316.00);
+INSERT INTO events VALUES (25495, 5, 316.25);
+INSERT INTO events VALUES (25498, 6, 316.50);
+INSERT INTO events VALUES (25501, 7, 316.75);
+INSERT INTO events VALUES (25504, 8, 317.00);
+INSERT INTO events VALUES (25507, 9, 317.25);
+INSERT INTO events VALUES (25510, 10, 317.50);
+INSERT INTO events VALUES (25513, 11, 317.75);
+INSERT INTO events VALUES (25516, 12, 318.00);
+INSERT INTO events VALUES (25519, 13, 318.25);
+INSERT INTO events VALUES (25522, 14, 318.50);
+INSERT INTO events VALUES (25525, 15, 318.75);
+INSERT INTO events VALUES (25528, 0, 319.00);
+INSERT INTO events VALUES (25531, 1, 319.25);
+INSERT INTO events VALUES (25534, 2, 319.50);
+INSERT INTO events VALUES (25537, 3, 319.75);
+INSERT INTO events VALUES (25540, 4, 320.00);
+INSERT INTO events VALUES (25543, 5, 320.25);
+INSERT INTO events VALUES (25546, 6, 320.50);
+INSERT INTO events VALUES (25549, 7, 320.75);
+INSERT INTO events VALUES (25552, 8, 321.00);
+INSERT INTO events VALUES (25555, 9, 321.25);
+INSERT INTO events VALUES (25558, 10, 321.50);
+INSERT INTO events VALUES (25561, 11, 321.75);
+INSERT INTO events VALUES (25564, 12, 322.00);
+INSERT INTO events VALUES (25567, 13, 322.25);
+INSERT INTO events VALUES (25570, 14, 322.50);
+INSERT INTO events VALUES (25573, 15, 322.75);
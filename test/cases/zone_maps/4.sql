@@ -0,0 +1,15 @@
+USE DATABASE metrics;
+EXPLAIN ANALYZE SELECT ts, sensor FROM events WHERE ts > 25560;
+SELECT ts, sensor FROM events WHERE ts > 25560;
+EXPLAIN ANALYZE SELECT ts, reading FROM events WHERE ts > 7200 AND ts < 7210;
+SELECT ts, reading FROM events WHERE ts > 7200 AND ts < 7210;
+EXPLAIN ANALYZE SELECT ts FROM events WHERE reading < 0.5 OR ts > 25570;
+SELECT ts FROM events WHERE reading < 0.5 OR ts > 25570;
+EXPLAIN ANALYZE SELECT ts FROM events WHERE ts < 1000;
+SELECT ts FROM events WHERE ts < 1000;
+EXPLAIN ANALYZE SELECT ts FROM events WHERE sensor = 15 AND ts < 1100;
+SELECT ts FROM events WHERE sensor = 15 AND ts < 1100;
+EXPLAIN ANALYZE SELECT ts, sensor FROM events WHERE ts > 50000;
+SELECT ts, sensor FROM events WHERE ts > 50000;
+EXPLAIN ANALYZE SELECT ts, reading FROM events WHERE reading > 299.0 AND ts < 20000;
+SELECT ts, reading FROM events WHERE reading > 299.0 AND ts < 20000;
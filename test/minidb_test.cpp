@@ -0,0 +1,183 @@
+// Checks of the libminidb API (src/minidb.hpp), registered with ctest by
+// CMakeLists.txt. Runs against a fresh data directory:
+//
+//   minidb_test DIR
+//
+// Prints each failed check and exits with status 1 if there were any.
+#include "minidb.hpp"
+#include "output.hpp"
+#include "utils.hpp"
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <string>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+int failures = 0;
+
+void check(bool ok, const char *what, int line) {
+  if (!ok) {
+    std::cerr << "line " << line << ": check failed: " << what << "\n";
+    failures++;
+  }
+}
+
+#define CHECK(condition) check((condition), #condition, __LINE__)
+
+// Whether `f` throws an exception of type E
+template <typename E, typename F> bool throws(F f) {
+  try {
+    f();
+  } catch (const E &) {
+    return true;
+  } catch (...) {
+  }
+  return false;
+}
+
+const char *const LONG_NAME = "a name longer than a value holds inline";
+
+void testCursors(Connection &db) {
+  QueryResults none = db.execute(
+      "CREATE DATABASE shop;\n"
+      "USE DATABASE shop;\n"
+      "CREATE TABLE items (id INTEGER, name TEXT, price FLOAT);\n"
+      "INSERT INTO items VALUES (1, 'pen', 1.50);\n"
+      "INSERT INTO items VALUES (2, 'ink', 7.25);\n" +
+      std::string("INSERT INTO items VALUES (3, '") + LONG_NAME +
+      "', 3.00);\n");
+  CHECK(none.size() == 0);
+
+  QueryResults results =
+      db.execute("SELECT id, name, price FROM items WHERE price > 2.00;\n"
+                 "SELECT name FROM items LIMIT 0;\n");
+  CHECK(results.size() == 2);
+
+  ResultCursor rows = results.cursor(0);
+  CHECK(rows.columns().size() == 3);
+  CHECK(rows.columns()[1].name == "name");
+  CHECK(rows.columns()[1].type == TokenType::TEXT);
+  CHECK(rows.columns()[2].type == TokenType::FLOAT);
+  CHECK(rows.rowCount() == 2);
+  CHECK(rows.columnIndex("price") == 2);
+  CHECK(throws<ArgumentError>([&] { rows.columnIndex("qty"); }));
+  CHECK(throws<ArgumentError>([&] { rows.get(0); }));
+
+  CHECK(rows.next());
+  CHECK(rows.getInt(0) == 2);
+  CHECK(rows.getText(1) == "ink");
+  CHECK(rows.getFloat(2) == 7.25);
+  CHECK(throws<ArgumentError>([&] { rows.getText(0); }));
+  CHECK(throws<ArgumentError>([&] { rows.get(3); }));
+  CHECK(rows.next());
+  CHECK(rows.getInt(0) == 3);
+  std::string_view name = rows.getText(1);
+  CHECK(!rows.next());
+  CHECK(!rows.next());
+
+  ResultCursor empty = results.cursor(1);
+  CHECK(empty.columns().size() == 1);
+  CHECK(empty.rowCount() == 0);
+  CHECK(!empty.next());
+  CHECK(throws<std::out_of_range>([&] { results.cursor(2); }));
+
+  // Text stays valid while its results do, whatever runs next
+  db.execute("UPDATE items SET price = 0.50 WHERE id = 3;\n"
+             "DELETE FROM items WHERE id = 3;\n"
+             "VACUUM items;\n");
+  CHECK(name == LONG_NAME);
+
+  // Each cursor walks the rows on its own
+  ResultCursor again = results.cursor(0);
+  CHECK(again.next());
+  CHECK(again.getInt(0) == 2);
+}
+
+void testJoin(Connection &db) {
+  QueryResults results = db.execute(
+      "CREATE TABLE orders (id INTEGER, item_id INTEGER);\n"
+      "INSERT INTO orders VALUES (10, 2);\n"
+      "INSERT INTO orders VALUES (11, 1);\n"
+      "SELECT items.name, orders.id FROM items INNER JOIN orders ON "
+      "items.id = orders.item_id;\n");
+  CHECK(results.size() == 1);
+  ResultCursor rows = results.cursor(0);
+  CHECK(rows.columnIndex("orders.id") == 1);
+  CHECK(rows.rowCount() == 2);
+  CHECK(rows.next());
+  CHECK(rows.getText(0) == "pen");
+  CHECK(rows.getInt(1) == 11);
+}
+
+void testErrors(Connection &db) {
+  // The first failing statement throws; those before it keep their effects
+  CHECK(throws<DatabaseError>([&] {
+    db.execute("INSERT INTO items VALUES (4, 'pad', 2.00);\n"
+               "SELECT id FROM missing;\n"
+               "INSERT INTO items VALUES (5, 'cap', 2.00);\n");
+  }));
+  CHECK(throws<ParseError>([&] { db.execute("SELEC id FROM items;\n"); }));
+  QueryResults results = db.execute("SELECT id FROM items WHERE id > 3;\n");
+  ResultCursor rows = results.cursor(0);
+  CHECK(rows.rowCount() == 1);
+  CHECK(rows.next() && rows.getInt(0) == 4);
+}
+
+void testWriter(Connection &db) {
+  std::string text;
+  {
+    std::unique_ptr<OutputWriter> out =
+        OutputWriter::create(OutputFormat::TEXT);
+    out->open([&](const char *data, size_t size) { text.append(data, size); });
+    db.execute("SELECT id, price FROM items WHERE id < 3;\n", *out);
+  }
+  CHECK(text == "id,price\n1,1.50\n2,7.25\n---\n");
+}
+
+void testReopen(const std::string &dir) {
+  auto db = Connection::open(dir);
+  QueryResults results = db->execute("USE DATABASE shop;\n"
+                                     "SELECT id, name FROM items;\n");
+  CHECK(results.size() == 1);
+  ResultCursor rows = results.cursor(0);
+  CHECK(rows.rowCount() == 3);
+  int ids = 0;
+  while (rows.next()) {
+    ids = ids * 10 + rows.getInt(0);
+  }
+  CHECK(ids == 124);
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+  if (argc != 2) {
+    std::cerr << "Usage: minidb_test DIR\n";
+    return 2;
+  }
+  std::string dir = argv[1];
+  try {
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+    {
+      auto db = Connection::open(dir);
+      testCursors(*db);
+      testJoin(*db);
+      testErrors(*db);
+      testWriter(*db);
+    }
+    // Closing the connection wrote the databases back
+    testReopen(dir);
+  } catch (const std::exception &e) {
+    std::cerr << "Unexpected error: " << e.what() << "\n";
+    return 1;
+  }
+  if (failures > 0) {
+    std::cerr << failures << " checks failed\n";
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,141 @@
+# Runs one case of test/cases, registered with ctest by CMakeLists.txt:
+#
+#   cmake -DMINIDB=... -DMINIDB_BENCH=... -DCASE_DIR=... -DWORK_DIR=...
+#         -P run_case.cmake
+#
+# A case is a directory of steps 1, 2, ..., each run in turn in the same
+# fresh working directory, so later steps see the databases earlier ones
+# left. The case's data/ directory, if any, is copied in first for minidb
+# to load. Step N runs minidb on N.sql, or on the script printed by
+# minidb_bench --script with the arguments in N.bench, and
+#   - passes the options in N.args, one per line,
+#   - expects the exit status in N.status, or 0,
+#   - expects the output file to be N.expected, byte for byte with
+#     --format=binary and otherwise ignoring carriage returns, after the
+#     matches of the regular expressions in N.mask, one per line, are
+#     replaced by "*", or by what follows the expression after a tab,
+#     which may refer to its groups as \1 and so on,
+#   - expects standard error to be N.stderr, if present, after the same
+#     replacements.
+
+cmake_minimum_required(VERSION 3.10)
+
+foreach(variable MINIDB MINIDB_BENCH CASE_DIR WORK_DIR)
+  if(NOT DEFINED ${variable})
+    message(FATAL_ERROR "${variable} is not set")
+  endif()
+  get_filename_component(${variable} "${${variable}}" ABSOLUTE)
+endforeach()
+
+file(REMOVE_RECURSE "${WORK_DIR}")
+file(MAKE_DIRECTORY "${WORK_DIR}")
+if(IS_DIRECTORY "${CASE_DIR}/data")
+  file(COPY "${CASE_DIR}/data" DESTINATION "${WORK_DIR}")
+endif()
+
+# The contents of a text file, without carriage returns
+function(read_text path result)
+  set(text "")
+  if(EXISTS "${path}")
+    file(READ "${path}" text)
+    string(REPLACE "\r" "" text "${text}")
+  endif()
+  set(${result} "${text}" PARENT_SCOPE)
+endfunction()
+
+# The lines of a file of one item per line, empty if it is missing
+function(read_lines path result)
+  set(lines "")
+  if(EXISTS "${path}")
+    file(STRINGS "${path}" lines)
+  endif()
+  set(${result} "${lines}" PARENT_SCOPE)
+endfunction()
+
+# `text` with the replacements of the mask file at `path` made
+function(apply_masks path text result)
+  read_lines("${path}" masks)
+  foreach(mask ${masks})
+    set(replacement "*")
+    string(FIND "${mask}" "\t" tab)
+    if(NOT tab EQUAL -1)
+      math(EXPR after "${tab} + 1")
+      string(SUBSTRING "${mask}" ${after} -1 replacement)
+      string(SUBSTRING "${mask}" 0 ${tab} mask)
+    endif()
+    string(REGEX REPLACE "${mask}" "${replacement}" text "${text}")
+  endforeach()
+  set(${result} "${text}" PARENT_SCOPE)
+endfunction()
+
+file(GLOB steps RELATIVE "${CASE_DIR}" "${CASE_DIR}/*.expected")
+if(NOT steps)
+  message(FATAL_ERROR "No steps in ${CASE_DIR}")
+endif()
+string(REPLACE ".expected" "" steps "${steps}")
+list(SORT steps)
+
+set(failed FALSE)
+foreach(step ${steps})
+  set(script "${CASE_DIR}/${step}.sql")
+  if(EXISTS "${CASE_DIR}/${step}.bench")
+    read_lines("${CASE_DIR}/${step}.bench" bench_args)
+    set(script "${WORK_DIR}/${step}.sql")
+    execute_process(COMMAND "${MINIDB_BENCH}" --script ${bench_args}
+                    OUTPUT_FILE "${script}" RESULT_VARIABLE status)
+    if(NOT status EQUAL 0)
+      message(FATAL_ERROR "Step ${step}: minidb_bench --script failed")
+    endif()
+  endif()
+
+  read_lines("${CASE_DIR}/${step}.args" args)
+  set(output "${WORK_DIR}/${step}.out")
+  execute_process(COMMAND "${MINIDB}" ${args} "${script}" "${output}"
+                  WORKING_DIRECTORY "${WORK_DIR}"
+                  RESULT_VARIABLE status ERROR_VARIABLE errors)
+
+  set(expected_status 0)
+  if(EXISTS "${CASE_DIR}/${step}.status")
+    file(STRINGS "${CASE_DIR}/${step}.status" expected_status)
+  endif()
+  if(NOT status STREQUAL expected_status)
+    message(SEND_ERROR "Step ${step}: exit status ${status}, expected "
+                       "${expected_status}\n${errors}")
+    set(failed TRUE)
+  endif()
+
+  if(EXISTS "${CASE_DIR}/${step}.stderr")
+    read_text("${CASE_DIR}/${step}.stderr" expected_errors)
+    string(REPLACE "\r" "" errors "${errors}")
+    apply_masks("${CASE_DIR}/${step}.mask" "${errors}" errors)
+    if(NOT errors STREQUAL expected_errors)
+      message(SEND_ERROR "Step ${step}: standard error differs from "
+                         "${step}.stderr:\n${errors}")
+      set(failed TRUE)
+    endif()
+  endif()
+
+  if("--format=binary" IN_LIST args)
+    execute_process(COMMAND "${CMAKE_COMMAND}" -E compare_files
+                            "${output}" "${CASE_DIR}/${step}.expected"
+                    RESULT_VARIABLE different)
+    if(different)
+      message(SEND_ERROR "Step ${step}: output differs from "
+                         "${step}.expected")
+      set(failed TRUE)
+    endif()
+  else()
+    read_text("${output}" actual)
+    read_text("${CASE_DIR}/${step}.expected" expected)
+    apply_masks("${CASE_DIR}/${step}.mask" "${actual}" actual)
+    if(NOT actual STREQUAL expected)
+      message(SEND_ERROR "Step ${step}: output differs from "
+                         "${step}.expected:\n${actual}")
+      set(failed TRUE)
+    endif()
+  endif()
+endforeach()
+
+if(failed)
+  message(FATAL_ERROR "Case ${CASE_DIR} failed")
+endif()
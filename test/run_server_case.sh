@@ -0,0 +1,122 @@
+#!/bin/sh
+# Runs one case of test/server_cases, registered with ctest on Linux by
+# CMakeLists.txt:
+#
+#   run_server_case.sh MINIDB CASE_DIR WORK_DIR
+#
+# The case's scripts are sent to one minidb --serve process, started with
+# the options in serve.args in a fresh working directory, into which the
+# case's data/ directory, if any, is copied first. Step N sends N.sql, or
+# all of N-1.sql, N-2.sql, ... at once over connections of their own, and
+# waits for them. Like the steps of test/cases (see run_case.cmake), each script
+# is sent with the options in its .args file and expects its output file
+# to be its .expected file, its exit status to be in its .status file, or
+# 0, and its standard error to be its .stderr file, if present. After the
+# last step the server is stopped with SIGTERM and must exit cleanly, then
+# final.sql, if present, is run by minidb directly to check what the
+# server saved.
+
+if [ $# -ne 3 ]; then
+  echo "Usage: run_server_case.sh MINIDB CASE_DIR WORK_DIR" >&2
+  exit 2
+fi
+minidb=$(cd "$(dirname "$1")" && pwd)/$(basename "$1")
+case_dir=$(cd "$2" && pwd)
+rm -rf "$3" && mkdir -p "$3" && cd "$3" || exit 1
+if [ -d "$case_dir/data" ]; then
+  cp -R "$case_dir/data" .
+fi
+
+failed=0
+
+# Check what running script $1 gave against its expectations
+check() {
+  expected_status=0
+  if [ -f "$case_dir/$1.status" ]; then
+    expected_status=$(cat "$case_dir/$1.status")
+  fi
+  status=$(cat "$1.rc")
+  if [ "$status" != "$expected_status" ]; then
+    echo "$1: exit status $status, expected $expected_status"
+    cat "$1.err"
+    failed=1
+  fi
+  if [ -f "$case_dir/$1.stderr" ] &&
+     ! cmp -s "$1.err" "$case_dir/$1.stderr"; then
+    echo "$1: standard error differs from $1.stderr:"
+    cat "$1.err"
+    failed=1
+  fi
+  if ! cmp -s "$1.out" "$case_dir/$1.expected"; then
+    echo "$1: output differs from $1.expected:"
+    cat "$1.out"
+    failed=1
+  fi
+}
+
+# Run script $1, with "--client minidb.sock" in $2 or directly if empty
+run() {
+  args=""
+  if [ -f "$case_dir/$1.args" ]; then
+    args=$(cat "$case_dir/$1.args")
+  fi
+  "$minidb" $args $2 "$case_dir/$1.sql" "$1.out" 2>"$1.err"
+  echo $? >"$1.rc"
+}
+
+serve_args=""
+if [ -f "$case_dir/serve.args" ]; then
+  serve_args=$(cat "$case_dir/serve.args")
+fi
+"$minidb" $serve_args --serve minidb.sock 2>serve.err &
+server=$!
+tries=0
+while [ ! -S minidb.sock ]; do
+  if ! kill -0 "$server" 2>/dev/null || [ $tries -eq 100 ]; then
+    echo "The server did not start:"
+    cat serve.err
+    kill "$server" 2>/dev/null
+    exit 1
+  fi
+  sleep 0.1
+  tries=$((tries + 1))
+done
+
+step=1
+while [ -f "$case_dir/$step.sql" ] || [ -f "$case_dir/$step-1.sql" ]; do
+  scripts=""
+  if [ -f "$case_dir/$step.sql" ]; then
+    scripts=$step
+  fi
+  client=1
+  while [ -f "$case_dir/$step-$client.sql" ]; do
+    scripts="$scripts $step-$client"
+    client=$((client + 1))
+  done
+  clients=""
+  for script in $scripts; do
+    run "$script" "--client minidb.sock" &
+    clients="$clients $!"
+  done
+  wait $clients
+  for script in $scripts; do
+    check "$script"
+  done
+  step=$((step + 1))
+done
+
+kill -TERM "$server"
+wait "$server"
+status=$?
+if [ $status -ne 0 ]; then
+  echo "The server exited with status $status:"
+  cat serve.err
+  failed=1
+fi
+
+if [ -f "$case_dir/final.sql" ]; then
+  run final ""
+  check final
+fi
+
+exit $failed
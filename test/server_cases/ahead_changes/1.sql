@@ -0,0 +1,3011 @@
+CREATE DATABASE shop;
+USE DATABASE shop;
+CREATE TABLE items (id INTEGER, grp INTEGER);
+CREATE TABLE tags (id INTEGER, n INTEGER);
+CREATE TABLE notes (id INTEGER, n INTEGER);
+INSERT INTO items VALUES (0, 0);
+INSERT INTO items VALUES (1, 1);
+INSERT INTO items VALUES (2, 2);
+INSERT INTO items VALUES (3, 3);
+INSERT INTO items VALUES (4, 4);
+INSERT INTO items VALUES (5, 5);
+INSERT INTO items VALUES (6, 6);
+INSERT INTO items VALUES (7, 7);
+INSERT INTO items VALUES (8, 8);
+INSERT INTO items VALUES (9, 9);
+INSERT INTO items VALUES (10, 0);
+INSERT INTO items VALUES (11, 1);
+INSERT INTO items VALUES (12, 2);
+INSERT INTO items VALUES (13, 3);
+INSERT INTO items VALUES (14, 4);
+INSERT INTO items VALUES (15, 5);
+INSERT INTO items VALUES (16, 6);
+INSERT INTO items VALUES (17, 7);
+INSERT INTO items VALUES (18, 8);
+INSERT INTO items VALUES (19, 9);
+INSERT INTO items VALUES (20, 0);
+INSERT INTO items VALUES (21, 1);
+INSERT INTO items VALUES (22, 2);
+INSERT INTO items VALUES (23, 3);
+INSERT INTO items VALUES (24, 4);
+INSERT INTO items VALUES (25, 5);
+INSERT INTO items VALUES (26, 6);
+INSERT INTO items VALUES (27, 7);
+INSERT INTO items VALUES (28, 8);
+INSERT INTO items VALUES (29, 9);
+INSERT INTO items VALUES (30, 0);
+INSERT INTO items VALUES (31, 1);
+INSERT INTO items VALUES (32, 2);
+INSERT INTO items VALUES (33, 3);
+INSERT INTO items VALUES (34, 4);
+INSERT INTO items VALUES (35, 5);
+INSERT INTO items VALUES (36, 6);
+INSERT INTO items VALUES (37, 7);
+INSERT INTO items VALUES (38, 8);
+INSERT INTO items VALUES (39, 9);
+INSERT INTO items VALUES (40, 0);
+INSERT INTO items VALUES (41, 1);
+INSERT INTO items VALUES (42, 2);
+INSERT INTO items VALUES (43, 3);
+INSERT INTO items VALUES (44, 4);
+INSERT INTO items VALUES (45, 5);
+INSERT INTO items VALUES (46, 6);
+INSERT INTO items VALUES (47, 7);
+INSERT INTO items VALUES (48, 8);
+INSERT INTO items VALUES (49, 9);
+INSERT INTO items VALUES (50, 0);
+INSERT INTO items VALUES (51, 1);
+INSERT INTO items VALUES (52, 2);
+INSERT INTO items VALUES (53, 3);
+INSERT INTO items VALUES (54, 4);
+INSERT INTO items VALUES (55, 5);
+INSERT INTO items VALUES (56, 6);
+INSERT INTO items VALUES (57, 7);
+INSERT INTO items VALUES (58, 8);
+INSERT INTO items VALUES (59, 9);
+INSERT INTO items VALUES (60, 0);
+INSERT INTO items VALUES (61, 1);
+INSERT INTO items VALUES (62, 2);
+INSERT INTO items VALUES (63, 3);
+INSERT INTO items VALUES (64, 4);
+INSERT INTO items VALUES (65, 5);
+INSERT INTO items VALUES (66, 6);
+INSERT INTO items VALUES (67, 7);
+INSERT INTO items VALUES (68, 8);
+INSERT INTO items VALUES (69, 9);
+INSERT INTO items VALUES (70, 0);
+INSERT INTO items VALUES (71, 1);
+INSERT INTO items VALUES (72, 2);
+INSERT INTO items VALUES (73, 3);
+INSERT INTO items VALUES (74, 4);
+INSERT INTO items VALUES (75, 5);
+INSERT INTO items VALUES (76, 6);
+INSERT INTO items VALUES (77, 7);
+INSERT INTO items VALUES (78, 8);
+INSERT INTO items VALUES (79, 9);
+INSERT INTO items VALUES (80, 0);
+INSERT INTO items VALUES (81, 1);
+INSERT INTO items VALUES (82, 2);
+INSERT INTO items VALUES (83, 3);
+INSERT INTO items VALUES (84, 4);
+INSERT INTO items VALUES (85, 5);
+INSERT INTO items VALUES (86, 6);
+INSERT INTO items VALUES (87, 7);
+INSERT INTO items VALUES (88, 8);
+INSERT INTO items VALUES (89, 9);
+INSERT INTO items VALUES (90, 0);
+INSERT INTO items VALUES (91, 1);
+INSERT INTO items VALUES (92, 2);
+INSERT INTO items VALUES (93, 3);
+INSERT INTO items VALUES (94, 4);
+INSERT INTO items VALUES (95, 5);
+INSERT INTO items VALUES (96, 6);
+INSERT INTO items VALUES (97, 7);
+INSERT INTO items VALUES (98, 8);
+INSERT INTO items VALUES (99, 9);
+INSERT INTO items VALUES (100, 0);
+INSERT INTO items VALUES (101, 1);
+INSERT INTO items VALUES (102, 2);
+INSERT INTO items VALUES (103, 3);
+INSERT INTO items VALUES (104, 4);
+INSERT INTO items VALUES (105, 5);
+INSERT INTO items VALUES (106, 6);
+INSERT INTO items VALUES (107, 7);
+INSERT INTO items VALUES (108, 8);
+INSERT INTO items VALUES (109, 9);
+INSERT INTO items VALUES (110, 0);
+INSERT INTO items VALUES (111, 1);
+INSERT INTO items VALUES (112, 2);
+INSERT INTO items VALUES (113, 3);
+INSERT INTO items VALUES (114, 4);
+INSERT INTO items VALUES (115, 5);
+INSERT INTO items VALUES (116, 6);
+INSERT INTO items VALUES (117, 7);
+INSERT INTO items VALUES (118, 8);
+INSERT INTO items VALUES (119, 9);
+INSERT INTO items VALUES (120, 0);
+INSERT INTO items VALUES (121, 1);
+INSERT INTO items VALUES (122, 2);
+INSERT INTO items VALUES (123, 3);
+INSERT INTO items VALUES (124, 4);
+INSERT INTO items VALUES (125, 5);
+INSERT INTO items VALUES (126, 6);
+INSERT INTO items VALUES (127, 7);
+INSERT INTO items VALUES (128, 8);
+INSERT INTO items VALUES (129, 9);
+INSERT INTO items VALUES (130, 0);
+INSERT INTO items VALUES (131, 1);
+INSERT INTO items VALUES (132, 2);
+INSERT INTO items VALUES (133, 3);
+INSERT INTO items VALUES (134, 4);
+INSERT INTO items VALUES (135, 5);
+INSERT INTO items VALUES (136, 6);
+INSERT INTO items VALUES (137, 7);
+INSERT INTO items VALUES (138, 8);
+INSERT INTO items VALUES (139, 9);
+INSERT INTO items VALUES (140, 0);
+INSERT INTO items VALUES (141, 1);
+INSERT INTO items VALUES (142, 2);
+INSERT INTO items VALUES (143, 3);
+INSERT INTO items VALUES (144, 4);
+INSERT INTO items VALUES (145, 5);
+INSERT INTO items VALUES (146, 6);
+INSERT INTO items VALUES (147, 7);
+INSERT INTO items VALUES (148, 8);
+INSERT INTO items VALUES (149, 9);
+INSERT INTO items VALUES (150, 0);
+INSERT INTO items VALUES (151, 1);
+INSERT INTO items VALUES (152, 2);
+INSERT INTO items VALUES (153, 3);
+INSERT INTO items VALUES (154, 4);
+INSERT INTO items VALUES (155, 5);
+INSERT INTO items VALUES (156, 6);
+INSERT INTO items VALUES (157, 7);
+INSERT INTO items VALUES (158, 8);
+INSERT INTO items VALUES (159, 9);
+INSERT INTO items VALUES (160, 0);
+INSERT INTO items VALUES (161, 1);
+INSERT INTO items VALUES (162, 2);
+INSERT INTO items VALUES (163, 3);
+INSERT INTO items VALUES (164, 4);
+INSERT INTO items VALUES (165, 5);
+INSERT INTO items VALUES (166, 6);
+INSERT INTO items VALUES (167, 7);
+INSERT INTO items VALUES (168, 8);
+INSERT INTO items VALUES (169, 9);
+INSERT INTO items VALUES (170, 0);
+INSERT INTO items VALUES (171, 1);
+INSERT INTO items VALUES (172, 2);
+INSERT INTO items VALUES (173, 3);
+INSERT INTO items VALUES (174, 4);
+INSERT INTO items VALUES (175, 5);
+INSERT INTO items VALUES (176, 6);
+INSERT INTO items VALUES (177, 7);
+INSERT INTO items VALUES (178, 8);
+INSERT INTO items VALUES (179, 9);
+INSERT INTO items VALUES (180, 0);
+INSERT INTO items VALUES (181, 1);
+INSERT INTO items VALUES (182, 2);
+INSERT INTO items VALUES (183, 3);
+INSERT INTO items VALUES (184, 4);
+INSERT INTO items VALUES (185, 5);
+INSERT INTO items VALUES (186, 6);
+INSERT INTO items VALUES (187, 7);
+INSERT INTO items VALUES (188, 8);
+INSERT INTO items VALUES (189, 9);
+INSERT INTO items VALUES (190, 0);
+INSERT INTO items VALUES (191, 1);
+INSERT INTO items VALUES (192, 2);
+INSERT INTO items VALUES (193, 3);
+INSERT INTO items VALUES (194, 4);
+INSERT INTO items VALUES (195, 5);
+INSERT INTO items VALUES (196, 6);
+INSERT INTO items VALUES (197, 7);
+INSERT INTO items VALUES (198, 8);
+INSERT INTO items VALUES (199, 9);
+INSERT INTO items VALUES (200, 0);
+INSERT INTO items VALUES (201, 1);
+INSERT INTO items VALUES (202, 2);
+INSERT INTO items VALUES (203, 3);
+INSERT INTO items VALUES (204, 4);
+INSERT INTO items VALUES (205, 5);
+INSERT INTO items VALUES (206, 6);
+INSERT INTO items VALUES (207, 7);
+INSERT INTO items VALUES (208, 8);
+INSERT INTO items VALUES (209, 9);
+INSERT INTO items VALUES (210, 0);
+INSERT INTO items VALUES (211, 1);
+INSERT INTO items VALUES (212, 2);
+INSERT INTO items VALUES (213, 3);
+INSERT INTO items VALUES (214, 4);
+INSERT INTO items VALUES (215, 5);
+INSERT INTO items VALUES (216, 6);
+INSERT INTO items VALUES (217, 7);
+INSERT INTO items VALUES (218, 8);
+INSERT INTO items VALUES (219, 9);
+INSERT INTO items VALUES (220, 0);
+INSERT INTO items VALUES (221, 1);
+INSERT INTO items VALUES (222, 2);
+INSERT INTO items VALUES (223, 3);
+INSERT INTO items VALUES (224, 4);
+INSERT INTO items VALUES (225, 5);
+INSERT INTO items VALUES (226, 6);
+INSERT INTO items VALUES (227, 7);
+INSERT INTO items VALUES (228, 8);
+INSERT INTO items VALUES (229, 9);
+INSERT INTO items VALUES (230, 0);
+INSERT INTO items VALUES (231, 1);
+INSERT INTO items VALUES (232, 2);
+INSERT INTO items VALUES (233, 3);
+INSERT INTO items VALUES (234, 4);
+INSERT INTO items VALUES (235, 5);
+INSERT INTO items VALUES (236, 6);
+INSERT INTO items VALUES (237, 7);
+INSERT INTO items VALUES (238, 8);
+INSERT INTO items VALUES (239, 9);
+INSERT INTO items VALUES (240, 0);
+INSERT INTO items VALUES (241, 1);
+INSERT INTO items VALUES (242, 2);
+INSERT INTO items VALUES (243, 3);
+INSERT INTO items VALUES (244, 4);
+INSERT INTO items VALUES (245, 5);
+INSERT INTO items VALUES (246, 6);
+INSERT INTO items VALUES (247, 7);
+INSERT INTO items VALUES (248, 8);
+INSERT INTO items VALUES (249, 9);
+INSERT INTO items VALUES (250, 0);
+INSERT INTO items VALUES (251, 1);
+INSERT INTO items VALUES (252, 2);
+INSERT INTO items VALUES (253, 3);
+INSERT INTO items VALUES (254, 4);
+INSERT INTO items VALUES (255, 5);
+INSERT INTO items VALUES (256, 6);
+INSERT INTO items VALUES (257, 7);
+INSERT INTO items VALUES (258, 8);
+INSERT INTO items VALUES (259, 9);
+INSERT INTO items VALUES (260, 0);
+INSERT INTO items VALUES (261, 1);
+INSERT INTO items VALUES (262, 2);
+INSERT INTO items VALUES (263, 3);
+INSERT INTO items VALUES (264, 4);
+INSERT INTO items VALUES (265, 5);
+INSERT INTO items VALUES (266, 6);
+INSERT INTO items VALUES (267, 7);
+INSERT INTO items VALUES (268, 8);
+INSERT INTO items VALUES (269, 9);
+INSERT INTO items VALUES (270, 0);
+INSERT INTO items VALUES (271, 1);
+INSERT INTO items VALUES (272, 2);
+INSERT INTO items VALUES (273, 3);
+INSERT INTO items VALUES (274, 4);
+INSERT INTO items VALUES (275, 5);
+INSERT INTO items VALUES (276, 6);
+INSERT INTO items VALUES (277, 7);
+INSERT INTO items VALUES (278, 8);
+INSERT INTO items VALUES (279, 9);
+INSERT INTO items VALUES (280, 0);
+INSERT INTO items VALUES (281, 1);
+INSERT INTO items VALUES (282, 2);
+INSERT INTO items VALUES (283, 3);
+INSERT INTO items VALUES (284, 4);
+INSERT INTO items VALUES (285, 5);
+INSERT INTO items VALUES (286, 6);
+INSERT INTO items VALUES (287, 7);
+INSERT INTO items VALUES (288, 8);
+INSERT INTO items VALUES (289, 9);
+INSERT INTO items VALUES (290, 0);
+INSERT INTO items VALUES (291, 1);
+INSERT INTO items VALUES (292, 2);
+INSERT INTO items VALUES (293, 3);
+INSERT INTO items VALUES (294, 4);
+INSERT INTO items VALUES (295, 5);
+INSERT INTO items VALUES (296, 6);
+INSERT INTO items VALUES (297, 7);
+INSERT INTO items VALUES (298, 8);
+INSERT INTO items VALUES (299, 9);
+INSERT INTO items VALUES (300, 0);
+INSERT INTO items VALUES (301, 1);
+INSERT INTO items VALUES (302, 2);
+INSERT INTO items VALUES (303, 3);
+INSERT INTO items VALUES (304, 4);
+INSERT INTO items VALUES (305, 5);
+INSERT INTO items VALUES (306, 6);
+INSERT INTO items VALUES (307, 7);
+INSERT INTO items VALUES (308, 8);
+INSERT INTO items VALUES (309, 9);
+INSERT INTO items VALUES (310, 0);
+INSERT INTO items VALUES (311, 1);
+INSERT INTO items VALUES (312, 2);
+INSERT INTO items VALUES (313, 3);
+INSERT INTO items VALUES (314, 4);
+INSERT INTO items VALUES (315, 5);
+INSERT INTO items VALUES (316, 6);
+INSERT INTO items VALUES (317, 7);
+INSERT INTO items VALUES (318, 8);
+INSERT INTO items VALUES (319, 9);
+INSERT INTO items VALUES (320, 0);
+INSERT INTO items VALUES (321, 1);
+INSERT INTO items VALUES (322, 2);
+INSERT INTO items VALUES (323, 3);
+INSERT INTO items VALUES (324, 4);
+INSERT INTO items VALUES (325, 5);
+INSERT INTO items VALUES (326, 6);
+INSERT INTO items VALUES (327, 7);
+INSERT INTO items VALUES (328, 8);
+INSERT INTO items VALUES (329, 9);
+INSERT INTO items VALUES (330, 0);
+INSERT INTO items VALUES (331, 1);
+INSERT INTO items VALUES (332, 2);
+INSERT INTO items VALUES (333, 3);
+INSERT INTO items VALUES (334, 4);
+INSERT INTO items VALUES (335, 5);
+INSERT INTO items VALUES (336, 6);
+INSERT INTO items VALUES (337, 7);
+INSERT INTO items VALUES (338, 8);
+INSERT INTO items VALUES (339, 9);
+INSERT INTO items VALUES (340, 0);
+INSERT INTO items VALUES (341, 1);
+INSERT INTO items VALUES (342, 2);
+INSERT INTO items VALUES (343, 3);
+INSERT INTO items VALUES (344, 4);
+INSERT INTO items VALUES (345, 5);
+INSERT INTO items VALUES (346, 6);
+INSERT INTO items VALUES (347, 7);
+INSERT INTO items VALUES (348, 8);
+INSERT INTO items VALUES (349, 9);
+INSERT INTO items VALUES (350, 0);
+INSERT INTO items VALUES (351, 1);
+INSERT INTO items VALUES (352, 2);
+INSERT INTO items VALUES (353, 3);
+INSERT INTO items VALUES (354, 4);
+INSERT INTO items VALUES (355, 5);
+INSERT INTO items VALUES (356, 6);
+INSERT INTO items VALUES (357, 7);
+INSERT INTO items VALUES (358, 8);
+INSERT INTO items VALUES (359, 9);
+INSERT INTO items VALUES (360, 0);
+INSERT INTO items VALUES (361, 1);
+INSERT INTO items VALUES (362, 2);
+INSERT INTO items VALUES (363, 3);
+INSERT INTO items VALUES (364, 4);
+INSERT INTO items VALUES (365, 5);
+INSERT INTO items VALUES (366, 6);
+INSERT INTO items VALUES (367, 7);
+INSERT INTO items VALUES (368, 8);
+INSERT INTO items VALUES (369, 9);
+INSERT INTO items VALUES (370, 0);
+INSERT INTO items VALUES (371, 1);
+INSERT INTO items VALUES (372, 2);
+INSERT INTO items VALUES (373, 3);
+INSERT INTO items VALUES (374, 4);
+INSERT INTO items VALUES (375, 5);
+INSERT INTO items VALUES (376, 6);
+INSERT INTO items VALUES (377, 7);
+INSERT INTO items VALUES (378, 8);
+INSERT INTO items VALUES (379, 9);
+INSERT INTO items VALUES (380, 0);
+INSERT INTO items VALUES (381, 1);
+INSERT INTO items VALUES (382, 2);
+INSERT INTO items VALUES (383, 3);
+INSERT INTO items VALUES (384, 4);
+INSERT INTO items VALUES (385, 5);
+INSERT INTO items VALUES (386, 6);
+INSERT INTO items VALUES (387, 7);
+INSERT INTO items VALUES (388, 8);
+INSERT INTO items VALUES (389, 9);
+INSERT INTO items VALUES (390, 0);
+INSERT INTO items VALUES (391, 1);
+INSERT INTO items VALUES (392, 2);
+INSERT INTO items VALUES (393, 3);
+INSERT INTO items VALUES (394, 4);
+INSERT INTO items VALUES (395, 5);
+INSERT INTO items VALUES (396, 6);
+INSERT INTO items VALUES (397, 7);
+INSERT INTO items VALUES (398, 8);
+INSERT INTO items VALUES (399, 9);
+INSERT INTO items VALUES (400, 0);
+INSERT INTO items VALUES (401, 1);
+INSERT INTO items VALUES (402, 2);
+INSERT INTO items VALUES (403, 3);
+INSERT INTO items VALUES (404, 4);
+INSERT INTO items VALUES (405, 5);
+INSERT INTO items VALUES (406, 6);
+INSERT INTO items VALUES (407, 7);
+INSERT INTO items VALUES (408, 8);
+INSERT INTO items VALUES (409, 9);
+INSERT INTO items VALUES (410, 0);
+INSERT INTO items VALUES (411, 1);
+INSERT INTO items VALUES (412, 2);
+INSERT INTO items VALUES (413, 3);
+INSERT INTO items VALUES (414, 4);
+INSERT INTO items VALUES (415, 5);
+INSERT INTO items VALUES (416, 6);
+INSERT INTO items VALUES (417, 7);
+INSERT INTO items VALUES (418, 8);
+INSERT INTO items VALUES (419, 9);
+INSERT INTO items VALUES (420, 0);
+INSERT INTO items VALUES (421, 1);
+INSERT INTO items VALUES (422, 2);
+INSERT INTO items VALUES (423, 3);
+INSERT INTO items VALUES (424, 4);
+INSERT INTO items VALUES (425, 5);
+INSERT INTO items VALUES (426, 6);
+INSERT INTO items VALUES (427, 7);
+INSERT INTO items VALUES (428, 8);
+INSERT INTO items VALUES (429, 9);
+INSERT INTO items VALUES (430, 0);
+INSERT INTO items VALUES (431, 1);
+INSERT INTO items VALUES (432, 2);
+INSERT INTO items VALUES (433, 3);
+INSERT INTO items VALUES (434, 4);
+INSERT INTO items VALUES (435, 5);
+INSERT INTO items VALUES (436, 6);
+INSERT INTO items VALUES (437, 7);
+INSERT INTO items VALUES (438, 8);
+INSERT INTO items VALUES (439, 9);
+INSERT INTO items VALUES (440, 0);
+INSERT INTO items VALUES (441, 1);
+INSERT INTO items VALUES (442, 2);
+INSERT INTO items VALUES (443, 3);
+INSERT INTO items VALUES (444, 4);
+INSERT INTO items VALUES (445, 5);
+INSERT INTO items VALUES (446, 6);
+INSERT INTO items VALUES (447, 7);
+INSERT INTO items VALUES (448, 8);
+INSERT INTO items VALUES (449, 9);
+INSERT INTO items VALUES (450, 0);
+INSERT INTO items VALUES (451, 1);
+INSERT INTO items VALUES (452, 2);
+INSERT INTO items VALUES (453, 3);
+INSERT INTO items VALUES (454, 4);
+INSERT INTO items VALUES (455, 5);
+INSERT INTO items VALUES (456, 6);
+INSERT INTO items VALUES (457, 7);
+INSERT INTO items VALUES (458, 8);
+INSERT INTO items VALUES (459, 9);
+INSERT INTO items VALUES (460, 0);
+INSERT INTO items VALUES (461, 1);
+INSERT INTO items VALUES (462, 2);
+INSERT INTO items VALUES (463, 3);
+INSERT INTO items VALUES (464, 4);
+INSERT INTO items VALUES (465, 5);
+INSERT INTO items VALUES (466, 6);
+INSERT INTO items VALUES (467, 7);
+INSERT INTO items VALUES (468, 8);
+INSERT INTO items VALUES (469, 9);
+INSERT INTO items VALUES (470, 0);
+INSERT INTO items VALUES (471, 1);
+INSERT INTO items VALUES (472, 2);
+INSERT INTO items VALUES (473, 3);
+INSERT INTO items VALUES (474, 4);
+INSERT INTO items VALUES (475, 5);
+INSERT INTO items VALUES (476, 6);
+INSERT INTO items VALUES (477, 7);
+INSERT INTO items VALUES (478, 8);
+INSERT INTO items VALUES (479, 9);
+INSERT INTO items VALUES (480, 0);
+INSERT INTO items VALUES (481, 1);
+INSERT INTO items VALUES (482, 2);
+INSERT INTO items VALUES (483, 3);
+INSERT INTO items VALUES (484, 4);
+INSERT INTO items VALUES (485, 5);
+INSERT INTO items VALUES (486, 6);
+INSERT INTO items VALUES (487, 7);
+INSERT INTO items VALUES (488, 8);
+INSERT INTO items VALUES (489, 9);
+INSERT INTO items VALUES (490, 0);
+INSERT INTO items VALUES (491, 1);
+INSERT INTO items VALUES (492, 2);
+INSERT INTO items VALUES (493, 3);
+INSERT INTO items VALUES (494, 4);
+INSERT INTO items VALUES (495, 5);
+INSERT INTO items VALUES (496, 6);
+INSERT INTO items VALUES (497, 7);
+INSERT INTO items VALUES (498, 8);
+INSERT INTO items VALUES (499, 9);
+INSERT INTO items VALUES (500, 0);
+INSERT INTO items VALUES (501, 1);
+INSERT INTO items VALUES (502, 2);
+INSERT INTO items VALUES (503, 3);
+INSERT INTO items VALUES (504, 4);
+INSERT INTO items VALUES (505, 5);
+INSERT INTO items VALUES (506, 6);
+INSERT INTO items VALUES (507, 7);
+INSERT INTO items VALUES (508, 8);
+INSERT INTO items VALUES (509, 9);
+INSERT INTO items VALUES (510, 0);
+INSERT INTO items VALUES (511, 1);
+INSERT INTO items VALUES (512, 2);
+INSERT INTO items VALUES (513, 3);
+INSERT INTO items VALUES (514, 4);
+INSERT INTO items VALUES (515, 5);
+INSERT INTO items VALUES (516, 6);
+INSERT INTO items VALUES (517, 7);
+INSERT INTO items VALUES (518, 8);
+INSERT INTO items VALUES (519, 9);
+INSERT INTO items VALUES (520, 0);
+INSERT INTO items VALUES (521, 1);
+INSERT INTO items VALUES (522, 2);
+INSERT INTO items VALUES (523, 3);
+INSERT INTO items VALUES (524, 4);
+INSERT INTO items VALUES (525, 5);
+INSERT INTO items VALUES (526, 6);
+INSERT INTO items VALUES (527, 7);
+INSERT INTO items VALUES (528, 8);
+INSERT INTO items VALUES (529, 9);
+INSERT INTO items VALUES (530, 0);
+INSERT INTO items VALUES (531, 1);
+INSERT INTO items VALUES (532, 2);
+INSERT INTO items VALUES (533, 3);
+INSERT INTO items VALUES (534, 4);
+INSERT INTO items VALUES (535, 5);
+INSERT INTO items VALUES (536, 6);
+INSERT INTO items VALUES (537, 7);
+INSERT INTO items VALUES (538, 8);
+INSERT INTO items VALUES (539, 9);
+INSERT INTO items VALUES (540, 0);
+INSERT INTO items VALUES (541, 1);
+INSERT INTO items VALUES (542, 2);
+INSERT INTO items VALUES (543, 3);
+INSERT INTO items VALUES (544, 4);
+INSERT INTO items VALUES (545, 5);
+INSERT INTO items VALUES (546, 6);
+INSERT INTO items VALUES (547, 7);
+INSERT INTO items VALUES (548, 8);
+INSERT INTO items VALUES (549, 9);
+INSERT INTO items VALUES (550, 0);
+INSERT INTO items VALUES (551, 1);
+INSERT INTO items VALUES (552, 2);
+INSERT INTO items VALUES (553, 3);
+INSERT INTO items VALUES (554, 4);
+INSERT INTO items VALUES (555, 5);
+INSERT INTO items VALUES (556, 6);
+INSERT INTO items VALUES (557, 7);
+INSERT INTO items VALUES (558, 8);
+INSERT INTO items VALUES (559, 9);
+INSERT INTO items VALUES (560, 0);
+INSERT INTO items VALUES (561, 1);
+INSERT INTO items VALUES (562, 2);
+INSERT INTO items VALUES (563, 3);
+INSERT INTO items VALUES (564, 4);
+INSERT INTO items VALUES (565, 5);
+INSERT INTO items VALUES (566, 6);
+INSERT INTO items VALUES (567, 7);
+INSERT INTO items VALUES (568, 8);
+INSERT INTO items VALUES (569, 9);
+INSERT INTO items VALUES (570, 0);
+INSERT INTO items VALUES (571, 1);
+INSERT INTO items VALUES (572, 2);
+INSERT INTO items VALUES (573, 3);
+INSERT INTO items VALUES (574, 4);
+INSERT INTO items VALUES (575, 5);
+INSERT INTO items VALUES (576, 6);
+INSERT INTO items VALUES (577, 7);
+INSERT INTO items VALUES (578, 8);
+INSERT INTO items VALUES (579, 9);
+INSERT INTO items VALUES (580, 0);
+INSERT INTO items VALUES (581, 1);
+INSERT INTO items VALUES (582, 2);
+INSERT INTO items VALUES (583, 3);
+INSERT INTO items VALUES (584, 4);
+INSERT INTO items VALUES (585, 5);
+INSERT INTO items VALUES (586, 6);
+INSERT INTO items VALUES (587, 7);
+INSERT INTO items VALUES (588, 8);
+INSERT INTO items VALUES (589, 9);
+INSERT INTO items VALUES (590, 0);
+INSERT INTO items VALUES (591, 1);
+INSERT INTO items VALUES (592, 2);
+INSERT INTO items VALUES (593, 3);
+INSERT INTO items VALUES (594, 4);
+INSERT INTO items VALUES (595, 5);
+INSERT INTO items VALUES (596, 6);
+INSERT INTO items VALUES (597, 7);
+INSERT INTO items VALUES (598, 8);
+INSERT INTO items VALUES (599, 9);
+INSERT INTO items VALUES (600, 0);
+INSERT INTO items VALUES (601, 1);
+INSERT INTO items VALUES (602, 2);
+INSERT INTO items VALUES (603, 3);
+INSERT INTO items VALUES (604, 4);
+INSERT INTO items VALUES (605, 5);
+INSERT INTO items VALUES (606, 6);
+INSERT INTO items VALUES (607, 7);
+INSERT INTO items VALUES (608, 8);
+INSERT INTO items VALUES (609, 9);
+INSERT INTO items VALUES (610, 0);
+INSERT INTO items VALUES (611, 1);
+INSERT INTO items VALUES (612, 2);
+INSERT INTO items VALUES (613, 3);
+INSERT INTO items VALUES (614, 4);
+INSERT INTO items VALUES (615, 5);
+INSERT INTO items VALUES (616, 6);
+INSERT INTO items VALUES (617, 7);
+INSERT INTO items VALUES (618, 8);
+INSERT INTO items VALUES (619, 9);
+INSERT INTO items VALUES (620, 0);
+INSERT INTO items VALUES (621, 1);
+INSERT INTO items VALUES (622, 2);
+INSERT INTO items VALUES (623, 3);
+INSERT INTO items VALUES (624, 4);
+INSERT INTO items VALUES (625, 5);
+INSERT INTO items VALUES (626, 6);
+INSERT INTO items VALUES (627, 7);
+INSERT INTO items VALUES (628, 8);
+INSERT INTO items VALUES (629, 9);
+INSERT INTO items VALUES (630, 0);
+INSERT INTO items VALUES (631, 1);
+INSERT INTO items VALUES (632, 2);
+INSERT INTO items VALUES (633, 3);
+INSERT INTO items VALUES (634, 4);
+INSERT INTO items VALUES (635, 5);
+INSERT INTO items VALUES (636, 6);
+INSERT INTO items VALUES (637, 7);
+INSERT INTO items VALUES (638, 8);
+INSERT INTO items VALUES (639, 9);
+INSERT INTO items VALUES (640, 0);
+INSERT INTO items VALUES (641, 1);
+INSERT INTO items VALUES (642, 2);
+INSERT INTO items VALUES (643, 3);
+INSERT INTO items VALUES (644, 4);
+INSERT INTO items VALUES (645, 5);
+INSERT INTO items VALUES (646, 6);
+INSERT INTO items VALUES (647, 7);
+INSERT INTO items VALUES (648, 8);
+INSERT INTO items VALUES (649, 9);
+INSERT INTO items VALUES (650, 0);
+INSERT INTO items VALUES (651, 1);
+INSERT INTO items VALUES (652, 2);
+INSERT INTO items VALUES (653, 3);
+INSERT INTO items VALUES (654, 4);
+INSERT INTO items VALUES (655, 5);
+INSERT INTO items VALUES (656, 6);
+INSERT INTO items VALUES (657, 7);
+INSERT INTO items VALUES (658, 8);
+INSERT INTO items VALUES (659, 9);
+INSERT INTO items VALUES (660, 0);
+INSERT INTO items VALUES (661, 1);
+INSERT INTO items VALUES (662, 2);
+INSERT INTO items VALUES (663, 3);
+INSERT INTO items VALUES (664, 4);
+INSERT INTO items VALUES (665, 5);
+INSERT INTO items VALUES (666, 6);
+INSERT INTO items VALUES (667, 7);
+INSERT INTO items VALUES (668, 8);
+INSERT INTO items VALUES (669, 9);
+INSERT INTO items VALUES (670, 0);
+INSERT INTO items VALUES (671, 1);
+INSERT INTO items VALUES (672, 2);
+INSERT INTO items VALUES (673, 3);
+INSERT INTO items VALUES (674, 4);
+INSERT INTO items VALUES (675, 5);
+INSERT INTO items VALUES (676, 6);
+INSERT INTO items VALUES (677, 7);
+INSERT INTO items VALUES (678, 8);
+INSERT INTO items VALUES (679, 9);
+INSERT INTO items VALUES (680, 0);
+INSERT INTO items VALUES (681, 1);
+INSERT INTO items VALUES (682, 2);
+INSERT INTO items VALUES (683, 3);
+INSERT INTO items VALUES (684, 4);
+INSERT INTO items VALUES (685, 5);
+INSERT INTO items VALUES (686, 6);
+INSERT INTO items VALUES (687, 7);
+INSERT INTO items VALUES (688, 8);
+INSERT INTO items VALUES (689, 9);
+INSERT INTO items VALUES (690, 0);
+INSERT INTO items VALUES (691, 1);
+INSERT INTO items VALUES (692, 2);
+INSERT INTO items VALUES (693, 3);
+INSERT INTO items VALUES (694, 4);
+INSERT INTO items VALUES (695, 5);
+INSERT INTO items VALUES (696, 6);
+INSERT INTO items VALUES (697, 7);
+INSERT INTO items VALUES (698, 8);
+INSERT INTO items VALUES (699, 9);
+INSERT INTO items VALUES (700, 0);
+INSERT INTO items VALUES (701, 1);
+INSERT INTO items VALUES (702, 2);
+INSERT INTO items VALUES (703, 3);
+INSERT INTO items VALUES (704, 4);
+INSERT INTO items VALUES (705, 5);
+INSERT INTO items VALUES (706, 6);
+INSERT INTO items VALUES (707, 7);
+INSERT INTO items VALUES (708, 8);
+INSERT INTO items VALUES (709, 9);
+INSERT INTO items VALUES (710, 0);
+INSERT INTO items VALUES (711, 1);
+INSERT INTO items VALUES (712, 2);
+INSERT INTO items VALUES (713, 3);
+INSERT INTO items VALUES (714, 4);
+INSERT INTO items VALUES (715, 5);
+INSERT INTO items VALUES (716, 6);
+INSERT INTO items VALUES (717, 7);
+INSERT INTO items VALUES (718, 8);
+INSERT INTO items VALUES (719, 9);
+INSERT INTO items VALUES (720, 0);
+INSERT INTO items VALUES (721, 1);
+INSERT INTO items VALUES (722, 2);
+INSERT INTO items VALUES (723, 3);
+INSERT INTO items VALUES (724, 4);
+INSERT INTO items VALUES (725, 5);
+INSERT INTO items VALUES (726, 6);
+INSERT INTO items VALUES (727, 7);
+INSERT INTO items VALUES (728, 8);
+INSERT INTO items VALUES (729, 9);
+INSERT INTO items VALUES (730, 0);
+INSERT INTO items VALUES (731, 1);
+INSERT INTO items VALUES (732, 2);
+INSERT INTO items VALUES (733, 3);
+INSERT INTO items VALUES (734, 4);
+INSERT INTO items VALUES (735, 5);
+INSERT INTO items VALUES (736, 6);
+INSERT INTO items VALUES (737, 7);
+INSERT INTO items VALUES (738, 8);
+INSERT INTO items VALUES (739, 9);
+INSERT INTO items VALUES (740, 0);
+INSERT INTO items VALUES (741, 1);
+INSERT INTO items VALUES (742, 2);
+INSERT INTO items VALUES (743, 3);
+INSERT INTO items VALUES (744, 4);
+INSERT INTO items VALUES (745, 5);
+INSERT INTO items VALUES (746, 6);
+INSERT INTO items VALUES (747, 7);
+INSERT INTO items VALUES (748, 8);
+INSERT INTO items VALUES (749, 9);
+INSERT INTO items VALUES (750, 0);
+INSERT INTO items VALUES (751, 1);
+INSERT INTO items VALUES (752, 2);
+INSERT INTO items VALUES (753, 3);
+INSERT INTO items VALUES (754, 4);
+INSERT INTO items VALUES (755, 5);
+INSERT INTO items VALUES (756, 6);
+INSERT INTO items VALUES (757, 7);
+INSERT INTO items VALUES (758, 8);
+INSERT INTO items VALUES (759, 9);
+INSERT INTO items VALUES (760, 0);
+INSERT INTO items VALUES (761, 1);
+INSERT INTO items VALUES (762, 2);
+INSERT INTO items VALUES (763, 3);
+INSERT INTO items VALUES (764, 4);
+INSERT INTO items VALUES (765, 5);
+INSERT INTO items VALUES (766, 6);
+INSERT INTO items VALUES (767, 7);
+INSERT INTO items VALUES (768, 8);
+INSERT INTO items VALUES (769, 9);
+INSERT INTO items VALUES (770, 0);
+INSERT INTO items VALUES (771, 1);
+INSERT INTO items VALUES (772, 2);
+INSERT INTO items VALUES (773, 3);
+INSERT INTO items VALUES (774, 4);
+INSERT INTO items VALUES (775, 5);
+INSERT INTO items VALUES (776, 6);
+INSERT INTO items VALUES (777, 7);
+INSERT INTO items VALUES (778, 8);
+INSERT INTO items VALUES (779, 9);
+INSERT INTO items VALUES (780, 0);
+INSERT INTO items VALUES (781, 1);
+INSERT INTO items VALUES (782, 2);
+INSERT INTO items VALUES (783, 3);
+INSERT INTO items VALUES (784, 4);
+INSERT INTO items VALUES (785, 5);
+INSERT INTO items VALUES (786, 6);
+INSERT INTO items VALUES (787, 7);
+INSERT INTO items VALUES (788, 8);
+INSERT INTO items VALUES (789, 9);
+INSERT INTO items VALUES (790, 0);
+INSERT INTO items VALUES (791, 1);
+INSERT INTO items VALUES (792, 2);
+INSERT INTO items VALUES (793, 3);
+INSERT INTO items VALUES (794, 4);
+INSERT INTO items VALUES (795, 5);
+INSERT INTO items VALUES (796, 6);
+INSERT INTO items VALUES (797, 7);
+INSERT INTO items VALUES (798, 8);
+INSERT INTO items VALUES (799, 9);
+INSERT INTO items VALUES (800, 0);
+INSERT INTO items VALUES (801, 1);
+INSERT INTO items VALUES (802, 2);
+INSERT INTO items VALUES (803, 3);
+INSERT INTO items VALUES (804, 4);
+INSERT INTO items VALUES (805, 5);
+INSERT INTO items VALUES (806, 6);
+INSERT INTO items VALUES (807, 7);
+INSERT INTO items VALUES (808, 8);
+INSERT INTO items VALUES (809, 9);
+INSERT INTO items VALUES (810, 0);
+INSERT INTO items VALUES (811, 1);
+INSERT INTO items VALUES (812, 2);
+INSERT INTO items VALUES (813, 3);
+INSERT INTO items VALUES (814, 4);
+INSERT INTO items VALUES (815, 5);
+INSERT INTO items VALUES (816, 6);
+INSERT INTO items VALUES (817, 7);
+INSERT INTO items VALUES (818, 8);
+INSERT INTO items VALUES (819, 9);
+INSERT INTO items VALUES (820, 0);
+INSERT INTO items VALUES (821, 1);
+INSERT INTO items VALUES (822, 2);
+INSERT INTO items VALUES (823, 3);
+INSERT INTO items VALUES (824, 4);
+INSERT INTO items VALUES (825, 5);
+INSERT INTO items VALUES (826, 6);
+INSERT INTO items VALUES (827, 7);
+INSERT INTO items VALUES (828, 8);
+INSERT INTO items VALUES (829, 9);
+INSERT INTO items VALUES (830, 0);
+INSERT INTO items VALUES (831, 1);
+INSERT INTO items VALUES (832, 2);
+INSERT INTO items VALUES (833, 3);
+INSERT INTO items VALUES (834, 4);
+INSERT INTO items VALUES (835, 5);
+INSERT INTO items VALUES (836, 6);
+INSERT INTO items VALUES (837, 7);
+INSERT INTO items VALUES (838, 8);
+INSERT INTO items VALUES (839, 9);
+INSERT INTO items VALUES (840, 0);
+INSERT INTO items VALUES (841, 1);
+INSERT INTO items VALUES (842, 2);
+INSERT INTO items VALUES (843, 3);
+INSERT INTO items VALUES (844, 4);
+INSERT INTO items VALUES (845, 5);
+INSERT INTO items VALUES (846, 6);
+INSERT INTO items VALUES (847, 7);
+INSERT INTO items VALUES (848, 8);
+INSERT INTO items VALUES (849, 9);
+INSERT INTO items VALUES (850, 0);
+INSERT INTO items VALUES (851, 1);
+INSERT INTO items VALUES (852, 2);
+INSERT INTO items VALUES (853, 3);
+INSERT INTO items VALUES (854, 4);
+INSERT INTO items VALUES (855, 5);
+INSERT INTO items VALUES (856, 6);
+INSERT INTO items VALUES (857, 7);
+INSERT INTO items VALUES (858, 8);
+INSERT INTO items VALUES (859, 9);
+INSERT INTO items VALUES (860, 0);
+INSERT INTO items VALUES (861, 1);
+INSERT INTO items VALUES (862, 2);
+INSERT INTO items VALUES (863, 3);
+INSERT INTO items VALUES (864, 4);
+INSERT INTO items VALUES (865, 5);
+INSERT INTO items VALUES (866, 6);
+INSERT INTO items VALUES (867, 7);
+INSERT INTO items VALUES (868, 8);
+INSERT INTO items VALUES (869, 9);
+INSERT INTO items VALUES (870, 0);
+INSERT INTO items VALUES (871, 1);
+INSERT INTO items VALUES (872, 2);
+INSERT INTO items VALUES (873, 3);
+INSERT INTO items VALUES (874, 4);
+INSERT INTO items VALUES (875, 5);
+INSERT INTO items VALUES (876, 6);
+INSERT INTO items VALUES (877, 7);
+INSERT INTO items VALUES (878, 8);
+INSERT INTO items VALUES (879, 9);
+INSERT INTO items VALUES (880, 0);
+INSERT INTO items VALUES (881, 1);
+INSERT INTO items VALUES (882, 2);
+INSERT INTO items VALUES (883, 3);
+INSERT INTO items VALUES (884, 4);
+INSERT INTO items VALUES (885, 5);
+INSERT INTO items VALUES (886, 6);
+INSERT INTO items VALUES (887, 7);
+INSERT INTO items VALUES (888, 8);
+INSERT INTO items VALUES (889, 9);
+INSERT INTO items VALUES (890, 0);
+INSERT INTO items VALUES (891, 1);
+INSERT INTO items VALUES (892, 2);
+INSERT INTO items VALUES (893, 3);
+INSERT INTO items VALUES (894, 4);
+INSERT INTO items VALUES (895, 5);
+INSERT INTO items VALUES (896, 6);
+INSERT INTO items VALUES (897, 7);
+INSERT INTO items VALUES (898, 8);
+INSERT INTO items VALUES (899, 9);
+INSERT INTO items VALUES (900, 0);
+INSERT INTO items VALUES (901, 1);
+INSERT INTO items VALUES (902, 2);
+INSERT INTO items VALUES (903, 3);
+INSERT INTO items VALUES (904, 4);
+INSERT INTO items VALUES (905, 5);
+INSERT INTO items VALUES (906, 6);
+INSERT INTO items VALUES (907, 7);
+INSERT INTO items VALUES (908, 8);
+INSERT INTO items VALUES (909, 9);
+INSERT INTO items VALUES (910, 0);
+INSERT INTO items VALUES (911, 1);
+INSERT INTO items VALUES (912, 2);
+INSERT INTO items VALUES (913, 3);
+INSERT INTO items VALUES (914, 4);
+INSERT INTO items VALUES (915, 5);
+INSERT INTO items VALUES (916, 6);
+INSERT INTO items VALUES (917, 7);
+INSERT INTO items VALUES (918, 8);
+INSERT INTO items VALUES (919, 9);
+INSERT INTO items VALUES (920, 0);
+INSERT INTO items VALUES (921, 1);
+INSERT INTO items VALUES (922, 2);
+INSERT INTO items VALUES (923, 3);
+INSERT INTO items VALUES (924, 4);
+INSERT INTO items VALUES (925, 5);
+INSERT INTO items VALUES (926, 6);
+INSERT INTO items VALUES (927, 7);
+INSERT INTO items VALUES (928, 8);
+INSERT INTO items VALUES (929, 9);
+INSERT INTO items VALUES (930, 0);
+INSERT INTO items VALUES (931, 1);
+INSERT INTO items VALUES (932, 2);
+INSERT INTO items VALUES (933, 3);
+INSERT INTO items VALUES (934, 4);
+INSERT INTO items VALUES (935, 5);
+INSERT INTO items VALUES (936, 6);
+INSERT INTO items VALUES (937, 7);
+INSERT INTO items VALUES (938, 8);
+INSERT INTO items VALUES (939, 9);
+INSERT INTO items VALUES (940, 0);
+INSERT INTO items VALUES (941, 1);
+INSERT INTO items VALUES (942, 2);
+INSERT INTO items VALUES (943, 3);
+INSERT INTO items VALUES (944, 4);
+INSERT INTO items VALUES (945, 5);
+INSERT INTO items VALUES (946, 6);
+INSERT INTO items VALUES (947, 7);
+INSERT INTO items VALUES (948, 8);
+INSERT INTO items VALUES (949, 9);
+INSERT INTO items VALUES (950, 0);
+INSERT INTO items VALUES (951, 1);
+INSERT INTO items VALUES (952, 2);
+INSERT INTO items VALUES (953, 3);
+INSERT INTO items VALUES (954, 4);
+INSERT INTO items VALUES (955, 5);
+INSERT INTO items VALUES (956, 6);
+INSERT INTO items VALUES (957, 7);
+INSERT INTO items VALUES (958, 8);
+INSERT INTO items VALUES (959, 9);
+INSERT INTO items VALUES (960, 0);
+INSERT INTO items VALUES (961, 1);
+INSERT INTO items VALUES (962, 2);
+INSERT INTO items VALUES (963, 3);
+INSERT INTO items VALUES (964, 4);
+INSERT INTO items VALUES (965, 5);
+INSERT INTO items VALUES (966, 6);
+INSERT INTO items VALUES (967, 7);
+INSERT INTO items VALUES (968, 8);
+INSERT INTO items VALUES (969, 9);
+INSERT INTO items VALUES (970, 0);
+INSERT INTO items VALUES (971, 1);
+INSERT INTO items VALUES (972, 2);
+INSERT INTO items VALUES (973, 3);
+INSERT INTO items VALUES (974, 4);
+INSERT INTO items VALUES (975, 5);
+INSERT INTO items VALUES (976, 6);
+INSERT INTO items VALUES (977, 7);
+INSERT INTO items VALUES (978, 8);
+INSERT INTO items VALUES (979, 9);
+INSERT INTO items VALUES (980, 0);
+INSERT INTO items VALUES (981, 1);
+INSERT INTO items VALUES (982, 2);
+INSERT INTO items VALUES (983, 3);
+INSERT INTO items VALUES (984, 4);
+INSERT INTO items VALUES (985, 5);
+INSERT INTO items VALUES (986, 6);
+INSERT INTO items VALUES (987, 7);
+INSERT INTO items VALUES (988, 8);
+INSERT INTO items VALUES (989, 9);
+INSERT INTO items VALUES (990, 0);
+INSERT INTO items VALUES (991, 1);
+INSERT INTO items VALUES (992, 2);
+INSERT INTO items VALUES (993, 3);
+INSERT INTO items VALUES (994, 4);
+INSERT INTO items VALUES (995, 5);
+INSERT INTO items VALUES (996, 6);
+INSERT INTO items VALUES (997, 7);
+INSERT INTO items VALUES (998, 8);
+INSERT INTO items VALUES (999, 9);
+INSERT INTO items VALUES (1000, 0);
+INSERT INTO items VALUES (1001, 1);
+INSERT INTO items VALUES (1002, 2);
+INSERT INTO items VALUES (1003, 3);
+INSERT INTO items VALUES (1004, 4);
+INSERT INTO items VALUES (1005, 5);
+INSERT INTO items VALUES (1006, 6);
+INSERT INTO items VALUES (1007, 7);
+INSERT INTO items VALUES (1008, 8);
+INSERT INTO items VALUES (1009, 9);
+INSERT INTO items VALUES (1010, 0);
+INSERT INTO items VALUES (1011, 1);
+INSERT INTO items VALUES (1012, 2);
+INSERT INTO items VALUES (1013, 3);
+INSERT INTO items VALUES (1014, 4);
+INSERT INTO items VALUES (1015, 5);
+INSERT INTO items VALUES (1016, 6);
+INSERT INTO items VALUES (1017, 7);
+INSERT INTO items VALUES (1018, 8);
+INSERT INTO items VALUES (1019, 9);
+INSERT INTO items VALUES (1020, 0);
+INSERT INTO items VALUES (1021, 1);
+INSERT INTO items VALUES (1022, 2);
+INSERT INTO items VALUES (1023, 3);
+INSERT INTO items VALUES (1024, 4);
+INSERT INTO items VALUES (1025, 5);
+INSERT INTO items VALUES (1026, 6);
+INSERT INTO items VALUES (1027, 7);
+INSERT INTO items VALUES (1028, 8);
+INSERT INTO items VALUES (1029, 9);
+INSERT INTO items VALUES (1030, 0);
+INSERT INTO items VALUES (1031, 1);
+INSERT INTO items VALUES (1032, 2);
+INSERT INTO items VALUES (1033, 3);
+INSERT INTO items VALUES (1034, 4);
+INSERT INTO items VALUES (1035, 5);
+INSERT INTO items VALUES (1036, 6);
+INSERT INTO items VALUES (1037, 7);
+INSERT INTO items VALUES (1038, 8);
+INSERT INTO items VALUES (1039, 9);
+INSERT INTO items VALUES (1040, 0);
+INSERT INTO items VALUES (1041, 1);
+INSERT INTO items VALUES (1042, 2);
+INSERT INTO items VALUES (1043, 3);
+INSERT INTO items VALUES (1044, 4);
+INSERT INTO items VALUES (1045, 5);
+INSERT INTO items VALUES (1046, 6);
+INSERT INTO items VALUES (1047, 7);
+INSERT INTO items VALUES (1048, 8);
+INSERT INTO items VALUES (1049, 9);
+INSERT INTO items VALUES (1050, 0);
+INSERT INTO items VALUES (1051, 1);
+INSERT INTO items VALUES (1052, 2);
+INSERT INTO items VALUES (1053, 3);
+INSERT INTO items VALUES (1054, 4);
+INSERT INTO items VALUES (1055, 5);
+INSERT INTO items VALUES (1056, 6);
+INSERT INTO items VALUES (1057, 7);
+INSERT INTO items VALUES (1058, 8);
+INSERT INTO items VALUES (1059, 9);
+INSERT INTO items VALUES (1060, 0);
+INSERT INTO items VALUES (1061, 1);
+INSERT INTO items VALUES (1062, 2);
+INSERT INTO items VALUES (1063, 3);
+INSERT INTO items VALUES (1064, 4);
+INSERT INTO items VALUES (1065, 5);
+INSERT INTO items VALUES (1066, 6);
+INSERT INTO items VALUES (1067, 7);
+INSERT INTO items VALUES (1068, 8);
+INSERT INTO items VALUES (1069, 9);
+INSERT INTO items VALUES (1070, 0);
+INSERT INTO items VALUES (1071, 1);
+INSERT INTO items VALUES (1072, 2);
+INSERT INTO items VALUES (1073, 3);
+INSERT INTO items VALUES (1074, 4);
+INSERT INTO items VALUES (1075, 5);
+INSERT INTO items VALUES (1076, 6);
+INSERT INTO items VALUES (1077, 7);
+INSERT INTO items VALUES (1078, 8);
+INSERT INTO items VALUES (1079, 9);
+INSERT INTO items VALUES (1080, 0);
+INSERT INTO items VALUES (1081, 1);
+INSERT INTO items VALUES (1082, 2);
+INSERT INTO items VALUES (1083, 3);
+INSERT INTO items VALUES (1084, 4);
+INSERT INTO items VALUES (1085, 5);
+INSERT INTO items VALUES (1086, 6);
+INSERT INTO items VALUES (1087, 7);
+INSERT INTO items VALUES (1088, 8);
+INSERT INTO items VALUES (1089, 9);
+INSERT INTO items VALUES (1090, 0);
+INSERT INTO items VALUES (1091, 1);
+INSERT INTO items VALUES (1092, 2);
+INSERT INTO items VALUES (1093, 3);
+INSERT INTO items VALUES (1094, 4);
+INSERT INTO items VALUES (1095, 5);
+INSERT INTO items VALUES (1096, 6);
+INSERT INTO items VALUES (1097, 7);
+INSERT INTO items VALUES (1098, 8);
+INSERT INTO items VALUES (1099, 9);
+INSERT INTO items VALUES (1100, 0);
+INSERT INTO items VALUES (1101, 1);
+INSERT INTO items VALUES (1102, 2);
+INSERT INTO items VALUES (1103, 3);
+INSERT INTO items VALUES (1104, 4);
+INSERT INTO items VALUES (1105, 5);
+INSERT INTO items VALUES (1106, 6);
+INSERT INTO items VALUES (1107, 7);
+INSERT INTO items VALUES (1108, 8);
+INSERT INTO items VALUES (1109, 9);
+INSERT INTO items VALUES (1110, 0);
+INSERT INTO items VALUES (1111, 1);
+INSERT INTO items VALUES (1112, 2);
+INSERT INTO items VALUES (1113, 3);
+INSERT INTO items VALUES (1114, 4);
+INSERT INTO items VALUES (1115, 5);
+INSERT INTO items VALUES (1116, 6);
+INSERT INTO items VALUES (1117, 7);
+INSERT INTO items VALUES (1118, 8);
+INSERT INTO items VALUES (1119, 9);
+INSERT INTO items VALUES (1120, 0);
+INSERT INTO items VALUES (1121, 1);
+INSERT INTO items VALUES (1122, 2);
+INSERT INTO items VALUES (1123, 3);
+INSERT INTO items VALUES (1124, 4);
+INSERT INTO items VALUES (1125, 5);
+INSERT INTO items VALUES (1126, 6);
+INSERT INTO items VALUES (1127, 7);
+INSERT INTO items VALUES (1128, 8);
+INSERT INTO items VALUES (1129, 9);
+INSERT INTO items VALUES (1130, 0);
+INSERT INTO items VALUES (1131, 1);
+INSERT INTO items VALUES (1132, 2);
+INSERT INTO items VALUES (1133, 3);
+INSERT INTO items VALUES (1134, 4);
+INSERT INTO items VALUES (1135, 5);
+INSERT INTO items VALUES (1136, 6);
+INSERT INTO items VALUES (1137, 7);
+INSERT INTO items VALUES (1138, 8);
+INSERT INTO items VALUES (1139, 9);
+INSERT INTO items VALUES (1140, 0);
+INSERT INTO items VALUES (1141, 1);
+INSERT INTO items VALUES (1142, 2);
+INSERT INTO items VALUES (1143, 3);
+INSERT INTO items VALUES (1144, 4);
+INSERT INTO items VALUES (1145, 5);
+INSERT INTO items VALUES (1146, 6);
+INSERT INTO items VALUES (1147, 7);
+INSERT INTO items VALUES (1148, 8);
+INSERT INTO items VALUES (1149, 9);
+INSERT INTO items VALUES (1150, 0);
+INSERT INTO items VALUES (1151, 1);
+INSERT INTO items VALUES (1152, 2);
+INSERT INTO items VALUES (1153, 3);
+INSERT INTO items VALUES (1154, 4);
+INSERT INTO items VALUES (1155, 5);
+INSERT INTO items VALUES (1156, 6);
+INSERT INTO items VALUES (1157, 7);
+INSERT INTO items VALUES (1158, 8);
+INSERT INTO items VALUES (1159, 9);
+INSERT INTO items VALUES (1160, 0);
+INSERT INTO items VALUES (1161, 1);
+INSERT INTO items VALUES (1162, 2);
+INSERT INTO items VALUES (1163, 3);
+INSERT INTO items VALUES (1164, 4);
+INSERT INTO items VALUES (1165, 5);
+INSERT INTO items VALUES (1166, 6);
+INSERT INTO items VALUES (1167, 7);
+INSERT INTO items VALUES (1168, 8);
+INSERT INTO items VALUES (1169, 9);
+INSERT INTO items VALUES (1170, 0);
+INSERT INTO items VALUES (1171, 1);
+INSERT INTO items VALUES (1172, 2);
+INSERT INTO items VALUES (1173, 3);
+INSERT INTO items VALUES (1174, 4);
+INSERT INTO items VALUES (1175, 5);
+INSERT INTO items VALUES (1176, 6);
+INSERT INTO items VALUES (1177, 7);
+INSERT INTO items VALUES (1178, 8);
+INSERT INTO items VALUES (1179, 9);
+INSERT INTO items VALUES (1180, 0);
+INSERT INTO items VALUES (1181, 1);
+INSERT INTO items VALUES (1182, 2);
+INSERT INTO items VALUES (1183, 3);
+INSERT INTO items VALUES (1184, 4);
+INSERT INTO items VALUES (1185, 5);
+INSERT INTO items VALUES (1186, 6);
+INSERT INTO items VALUES (1187, 7);
+INSERT INTO items VALUES (1188, 8);
+INSERT INTO items VALUES (1189, 9);
+INSERT INTO items VALUES (1190, 0);
+INSERT INTO items VALUES (1191, 1);
+INSERT INTO items VALUES (1192, 2);
+INSERT INTO items VALUES (1193, 3);
+INSERT INTO items VALUES (1194, 4);
+INSERT INTO items VALUES (1195, 5);
+INSERT INTO items VALUES (1196, 6);
+INSERT INTO items VALUES (1197, 7);
+INSERT INTO items VALUES (1198, 8);
+INSERT INTO items VALUES (1199, 9);
+INSERT INTO items VALUES (1200, 0);
+INSERT INTO items VALUES (1201, 1);
+INSERT INTO items VALUES (1202, 2);
+INSERT INTO items VALUES (1203, 3);
+INSERT INTO items VALUES (1204, 4);
+INSERT INTO items VALUES (1205, 5);
+INSERT INTO items VALUES (1206, 6);
+INSERT INTO items VALUES (1207, 7);
+INSERT INTO items VALUES (1208, 8);
+INSERT INTO items VALUES (1209, 9);
+INSERT INTO items VALUES (1210, 0);
+INSERT INTO items VALUES (1211, 1);
+INSERT INTO items VALUES (1212, 2);
+INSERT INTO items VALUES (1213, 3);
+INSERT INTO items VALUES (1214, 4);
+INSERT INTO items VALUES (1215, 5);
+INSERT INTO items VALUES (1216, 6);
+INSERT INTO items VALUES (1217, 7);
+INSERT INTO items VALUES (1218, 8);
+INSERT INTO items VALUES (1219, 9);
+INSERT INTO items VALUES (1220, 0);
+INSERT INTO items VALUES (1221, 1);
+INSERT INTO items VALUES (1222, 2);
+INSERT INTO items VALUES (1223, 3);
+INSERT INTO items VALUES (1224, 4);
+INSERT INTO items VALUES (1225, 5);
+INSERT INTO items VALUES (1226, 6);
+INSERT INTO items VALUES (1227, 7);
+INSERT INTO items VALUES (1228, 8);
+INSERT INTO items VALUES (1229, 9);
+INSERT INTO items VALUES (1230, 0);
+INSERT INTO items VALUES (1231, 1);
+INSERT INTO items VALUES (1232, 2);
+INSERT INTO items VALUES (1233, 3);
+INSERT INTO items VALUES (1234, 4);
+INSERT INTO items VALUES (1235, 5);
+INSERT INTO items VALUES (1236, 6);
+INSERT INTO items VALUES (1237, 7);
+INSERT INTO items VALUES (1238, 8);
+INSERT INTO items VALUES (1239, 9);
+INSERT INTO items VALUES (1240, 0);
+INSERT INTO items VALUES (1241, 1);
+INSERT INTO items VALUES (1242, 2);
+INSERT INTO items VALUES (1243, 3);
+INSERT INTO items VALUES (1244, 4);
+INSERT INTO items VALUES (1245, 5);
+INSERT INTO items VALUES (1246, 6);
+INSERT INTO items VALUES (1247, 7);
+INSERT INTO items VALUES (1248, 8);
+INSERT INTO items VALUES (1249, 9);
+INSERT INTO items VALUES (1250, 0);
+INSERT INTO items VALUES (1251, 1);
+INSERT INTO items VALUES (1252, 2);
+INSERT INTO items VALUES (1253, 3);
+INSERT INTO items VALUES (1254, 4);
+INSERT INTO items VALUES (1255, 5);
+INSERT INTO items VALUES (1256, 6);
+INSERT INTO items VALUES (1257, 7);
+INSERT INTO items VALUES (1258, 8);
+INSERT INTO items VALUES (1259, 9);
+INSERT INTO items VALUES (1260, 0);
+INSERT INTO items VALUES (1261, 1);
+INSERT INTO items VALUES (1262, 2);
+INSERT INTO items VALUES (1263, 3);
+INSERT INTO items VALUES (1264, 4);
+INSERT INTO items VALUES (1265, 5);
+INSERT INTO items VALUES (1266, 6);
+INSERT INTO items VALUES (1267, 7);
+INSERT INTO items VALUES (1268, 8);
+INSERT INTO items VALUES (1269, 9);
+INSERT INTO items VALUES (1270, 0);
+INSERT INTO items VALUES (1271, 1);
+INSERT INTO items VALUES (1272, 2);
+INSERT INTO items VALUES (1273, 3);
+INSERT INTO items VALUES (1274, 4);
+INSERT INTO items VALUES (1275, 5);
+INSERT INTO items VALUES (1276, 6);
+INSERT INTO items VALUES (1277, 7);
+INSERT INTO items VALUES (1278, 8);
+INSERT INTO items VALUES (1279, 9);
+INSERT INTO items VALUES (1280, 0);
+INSERT INTO items VALUES (1281, 1);
+INSERT INTO items VALUES (1282, 2);
+INSERT INTO items VALUES (1283, 3);
+INSERT INTO items VALUES (1284, 4);
+INSERT INTO items VALUES (1285, 5);
+INSERT INTO items VALUES (1286, 6);
+INSERT INTO items VALUES (1287, 7);
+INSERT INTO items VALUES (1288, 8);
+INSERT INTO items VALUES (1289, 9);
+INSERT INTO items VALUES (1290, 0);
+INSERT INTO items VALUES (1291, 1);
+INSERT INTO items VALUES (1292, 2);
+INSERT INTO items VALUES (1293, 3);
+INSERT INTO items VALUES (1294, 4);
+INSERT INTO items VALUES (1295, 5);
+INSERT INTO items VALUES (1296, 6);
+INSERT INTO items VALUES (1297, 7);
+INSERT INTO items VALUES (1298, 8);
+INSERT INTO items VALUES (1299, 9);
+INSERT INTO items VALUES (1300, 0);
+INSERT INTO items VALUES (1301, 1);
+INSERT INTO items VALUES (1302, 2);
+INSERT INTO items VALUES (1303, 3);
+INSERT INTO items VALUES (1304, 4);
+INSERT INTO items VALUES (1305, 5);
+INSERT INTO items VALUES (1306, 6);
+INSERT INTO items VALUES (1307, 7);
+INSERT INTO items VALUES (1308, 8);
+INSERT INTO items VALUES (1309, 9);
+INSERT INTO items VALUES (1310, 0);
+INSERT INTO items VALUES (1311, 1);
+INSERT INTO items VALUES (1312, 2);
+INSERT INTO items VALUES (1313, 3);
+INSERT INTO items VALUES (1314, 4);
+INSERT INTO items VALUES (1315, 5);
+INSERT INTO items VALUES (1316, 6);
+INSERT INTO items VALUES (1317, 7);
+INSERT INTO items VALUES (1318, 8);
+INSERT INTO items VALUES (1319, 9);
+INSERT INTO items VALUES (1320, 0);
+INSERT INTO items VALUES (1321, 1);
+INSERT INTO items VALUES (1322, 2);
+INSERT INTO items VALUES (1323, 3);
+INSERT INTO items VALUES (1324, 4);
+INSERT INTO items VALUES (1325, 5);
+INSERT INTO items VALUES (1326, 6);
+INSERT INTO items VALUES (1327, 7);
+INSERT INTO items VALUES (1328, 8);
+INSERT INTO items VALUES (1329, 9);
+INSERT INTO items VALUES (1330, 0);
+INSERT INTO items VALUES (1331, 1);
+INSERT INTO items VALUES (1332, 2);
+INSERT INTO items VALUES (1333, 3);
+INSERT INTO items VALUES (1334, 4);
+INSERT INTO items VALUES (1335, 5);
+INSERT INTO items VALUES (1336, 6);
+INSERT INTO items VALUES (1337, 7);
+INSERT INTO items VALUES (1338, 8);
+INSERT INTO items VALUES (1339, 9);
+INSERT INTO items VALUES (1340, 0);
+INSERT INTO items VALUES (1341, 1);
+INSERT INTO items VALUES (1342, 2);
+INSERT INTO items VALUES (1343, 3);
+INSERT INTO items VALUES (1344, 4);
+INSERT INTO items VALUES (1345, 5);
+INSERT INTO items VALUES (1346, 6);
+INSERT INTO items VALUES (1347, 7);
+INSERT INTO items VALUES (1348, 8);
+INSERT INTO items VALUES (1349, 9);
+INSERT INTO items VALUES (1350, 0);
+INSERT INTO items VALUES (1351, 1);
+INSERT INTO items VALUES (1352, 2);
+INSERT INTO items VALUES (1353, 3);
+INSERT INTO items VALUES (1354, 4);
+INSERT INTO items VALUES (1355, 5);
+INSERT INTO items VALUES (1356, 6);
+INSERT INTO items VALUES (1357, 7);
+INSERT INTO items VALUES (1358, 8);
+INSERT INTO items VALUES (1359, 9);
+INSERT INTO items VALUES (1360, 0);
+INSERT INTO items VALUES (1361, 1);
+INSERT INTO items VALUES (1362, 2);
+INSERT INTO items VALUES (1363, 3);
+INSERT INTO items VALUES (1364, 4);
+INSERT INTO items VALUES (1365, 5);
+INSERT INTO items VALUES (1366, 6);
+INSERT INTO items VALUES (1367, 7);
+INSERT INTO items VALUES (1368, 8);
+INSERT INTO items VALUES (1369, 9);
+INSERT INTO items VALUES (1370, 0);
+INSERT INTO items VALUES (1371, 1);
+INSERT INTO items VALUES (1372, 2);
+INSERT INTO items VALUES (1373, 3);
+INSERT INTO items VALUES (1374, 4);
+INSERT INTO items VALUES (1375, 5);
+INSERT INTO items VALUES (1376, 6);
+INSERT INTO items VALUES (1377, 7);
+INSERT INTO items VALUES (1378, 8);
+INSERT INTO items VALUES (1379, 9);
+INSERT INTO items VALUES (1380, 0);
+INSERT INTO items VALUES (1381, 1);
+INSERT INTO items VALUES (1382, 2);
+INSERT INTO items VALUES (1383, 3);
+INSERT INTO items VALUES (1384, 4);
+INSERT INTO items VALUES (1385, 5);
+INSERT INTO items VALUES (1386, 6);
+INSERT INTO items VALUES (1387, 7);
+INSERT INTO items VALUES (1388, 8);
+INSERT INTO items VALUES (1389, 9);
+INSERT INTO items VALUES (1390, 0);
+INSERT INTO items VALUES (1391, 1);
+INSERT INTO items VALUES (1392, 2);
+INSERT INTO items VALUES (1393, 3);
+INSERT INTO items VALUES (1394, 4);
+INSERT INTO items VALUES (1395, 5);
+INSERT INTO items VALUES (1396, 6);
+INSERT INTO items VALUES (1397, 7);
+INSERT INTO items VALUES (1398, 8);
+INSERT INTO items VALUES (1399, 9);
+INSERT INTO items VALUES (1400, 0);
+INSERT INTO items VALUES (1401, 1);
+INSERT INTO items VALUES (1402, 2);
+INSERT INTO items VALUES (1403, 3);
+INSERT INTO items VALUES (1404, 4);
+INSERT INTO items VALUES (1405, 5);
+INSERT INTO items VALUES (1406, 6);
+INSERT INTO items VALUES (1407, 7);
+INSERT INTO items VALUES (1408, 8);
+INSERT INTO items VALUES (1409, 9);
+INSERT INTO items VALUES (1410, 0);
+INSERT INTO items VALUES (1411, 1);
+INSERT INTO items VALUES (1412, 2);
+INSERT INTO items VALUES (1413, 3);
+INSERT INTO items VALUES (1414, 4);
+INSERT INTO items VALUES (1415, 5);
+INSERT INTO items VALUES (1416, 6);
+INSERT INTO items VALUES (1417, 7);
+INSERT INTO items VALUES (1418, 8);
+INSERT INTO items VALUES (1419, 9);
+INSERT INTO items VALUES (1420, 0);
+INSERT INTO items VALUES (1421, 1);
+INSERT INTO items VALUES (1422, 2);
+INSERT INTO items VALUES (1423, 3);
+INSERT INTO items VALUES (1424, 4);
+INSERT INTO items VALUES (1425, 5);
+INSERT INTO items VALUES (1426, 6);
+INSERT INTO items VALUES (1427, 7);
+INSERT INTO items VALUES (1428, 8);
+INSERT INTO items VALUES (1429, 9);
+INSERT INTO items VALUES (1430, 0);
+INSERT INTO items VALUES (1431, 1);
+INSERT INTO items VALUES (1432, 2);
+INSERT INTO items VALUES (1433, 3);
+INSERT INTO items VALUES (1434, 4);
+INSERT INTO items VALUES (1435, 5);
+INSERT INTO items VALUES (1436, 6);
+INSERT INTO items VALUES (1437, 7);
+INSERT INTO items VALUES (1438, 8);
+INSERT INTO items VALUES (1439, 9);
+INSERT INTO items VALUES (1440, 0);
+INSERT INTO items VALUES (1441, 1);
+INSERT INTO items VALUES (1442, 2);
+INSERT INTO items VALUES (1443, 3);
+INSERT INTO items VALUES (1444, 4);
+INSERT INTO items VALUES (1445, 5);
+INSERT INTO items VALUES (1446, 6);
+INSERT INTO items VALUES (1447, 7);
+INSERT INTO items VALUES (1448, 8);
+INSERT INTO items VALUES (1449, 9);
+INSERT INTO items VALUES (1450, 0);
+INSERT INTO items VALUES (1451, 1);
+INSERT INTO items VALUES (1452, 2);
+INSERT INTO items VALUES (1453, 3);
+INSERT INTO items VALUES (1454, 4);
+INSERT INTO items VALUES (1455, 5);
+INSERT INTO items VALUES (1456, 6);
+INSERT INTO items VALUES (1457, 7);
+INSERT INTO items VALUES (1458, 8);
+INSERT INTO items VALUES (1459, 9);
+INSERT INTO items VALUES (1460, 0);
+INSERT INTO items VALUES (1461, 1);
+INSERT INTO items VALUES (1462, 2);
+INSERT INTO items VALUES (1463, 3);
+INSERT INTO items VALUES (1464, 4);
+INSERT INTO items VALUES (1465, 5);
+INSERT INTO items VALUES (1466, 6);
+INSERT INTO items VALUES (1467, 7);
+INSERT INTO items VALUES (1468, 8);
+INSERT INTO items VALUES (1469, 9);
+INSERT INTO items VALUES (1470, 0);
+INSERT INTO items VALUES (1471, 1);
+INSERT INTO items VALUES (1472, 2);
+INSERT INTO items VALUES (1473, 3);
+INSERT INTO items VALUES (1474, 4);
+INSERT INTO items VALUES (1475, 5);
+INSERT INTO items VALUES (1476, 6);
+INSERT INTO items VALUES (1477, 7);
+INSERT INTO items VALUES (1478, 8);
+INSERT INTO items VALUES (1479, 9);
+INSERT INTO items VALUES (1480, 0);
+INSERT INTO items VALUES (1481, 1);
+INSERT INTO items VALUES (1482, 2);
+INSERT INTO items VALUES (1483, 3);
+INSERT INTO items VALUES (1484, 4);
+INSERT INTO items VALUES (1485, 5);
+INSERT INTO items VALUES (1486, 6);
+INSERT INTO items VALUES (1487, 7);
+INSERT INTO items VALUES (1488, 8);
+INSERT INTO items VALUES (1489, 9);
+INSERT INTO items VALUES (1490, 0);
+INSERT INTO items VALUES (1491, 1);
+INSERT INTO items VALUES (1492, 2);
+INSERT INTO items VALUES (1493, 3);
+INSERT INTO items VALUES (1494, 4);
+INSERT INTO items VALUES (1495, 5);
+INSERT INTO items VALUES (1496, 6);
+INSERT INTO items VALUES (1497, 7);
+INSERT INTO items VALUES (1498, 8);
+INSERT INTO items VALUES (1499, 9);
+INSERT INTO items VALUES (1500, 0);
+INSERT INTO items VALUES (1501, 1);
+INSERT INTO items VALUES (1502, 2);
+INSERT INTO items VALUES (1503, 3);
+INSERT INTO items VALUES (1504, 4);
+INSERT INTO items VALUES (1505, 5);
+INSERT INTO items VALUES (1506, 6);
+INSERT INTO items VALUES (1507, 7);
+INSERT INTO items VALUES (1508, 8);
+INSERT INTO items VALUES (1509, 9);
+INSERT INTO items VALUES (1510, 0);
+INSERT INTO items VALUES (1511, 1);
+INSERT INTO items VALUES (1512, 2);
+INSERT INTO items VALUES (1513, 3);
+INSERT INTO items VALUES (1514, 4);
+INSERT INTO items VALUES (1515, 5);
+INSERT INTO items VALUES (1516, 6);
+INSERT INTO items VALUES (1517, 7);
+INSERT INTO items VALUES (1518, 8);
+INSERT INTO items VALUES (1519, 9);
+INSERT INTO items VALUES (1520, 0);
+INSERT INTO items VALUES (1521, 1);
+INSERT INTO items VALUES (1522, 2);
+INSERT INTO items VALUES (1523, 3);
+INSERT INTO items VALUES (1524, 4);
+INSERT INTO items VALUES (1525, 5);
+INSERT INTO items VALUES (1526, 6);
+INSERT INTO items VALUES (1527, 7);
+INSERT INTO items VALUES (1528, 8);
+INSERT INTO items VALUES (1529, 9);
+INSERT INTO items VALUES (1530, 0);
+INSERT INTO items VALUES (1531, 1);
+INSERT INTO items VALUES (1532, 2);
+INSERT INTO items VALUES (1533, 3);
+INSERT INTO items VALUES (1534, 4);
+INSERT INTO items VALUES (1535, 5);
+INSERT INTO items VALUES (1536, 6);
+INSERT INTO items VALUES (1537, 7);
+INSERT INTO items VALUES (1538, 8);
+INSERT INTO items VALUES (1539, 9);
+INSERT INTO items VALUES (1540, 0);
+INSERT INTO items VALUES (1541, 1);
+INSERT INTO items VALUES (1542, 2);
+INSERT INTO items VALUES (1543, 3);
+INSERT INTO items VALUES (1544, 4);
+INSERT INTO items VALUES (1545, 5);
+INSERT INTO items VALUES (1546, 6);
+INSERT INTO items VALUES (1547, 7);
+INSERT INTO items VALUES (1548, 8);
+INSERT INTO items VALUES (1549, 9);
+INSERT INTO items VALUES (1550, 0);
+INSERT INTO items VALUES (1551, 1);
+INSERT INTO items VALUES (1552, 2);
+INSERT INTO items VALUES (1553, 3);
+INSERT INTO items VALUES (1554, 4);
+INSERT INTO items VALUES (1555, 5);
+INSERT INTO items VALUES (1556, 6);
+INSERT INTO items VALUES (1557, 7);
+INSERT INTO items VALUES (1558, 8);
+INSERT INTO items VALUES (1559, 9);
+INSERT INTO items VALUES (1560, 0);
+INSERT INTO items VALUES (1561, 1);
+INSERT INTO items VALUES (1562, 2);
+INSERT INTO items VALUES (1563, 3);
+INSERT INTO items VALUES (1564, 4);
+INSERT INTO items VALUES (1565, 5);
+INSERT INTO items VALUES (1566, 6);
+INSERT INTO items VALUES (1567, 7);
+INSERT INTO items VALUES (1568, 8);
+INSERT INTO items VALUES (1569, 9);
+INSERT INTO items VALUES (1570, 0);
+INSERT INTO items VALUES (1571, 1);
+INSERT INTO items VALUES (1572, 2);
+INSERT INTO items VALUES (1573, 3);
+INSERT INTO items VALUES (1574, 4);
+INSERT INTO items VALUES (1575, 5);
+INSERT INTO items VALUES (1576, 6);
+INSERT INTO items VALUES (1577, 7);
+INSERT INTO items VALUES (1578, 8);
+INSERT INTO items VALUES (1579, 9);
+INSERT INTO items VALUES (1580, 0);
+INSERT INTO items VALUES (1581, 1);
+INSERT INTO items VALUES (1582, 2);
+INSERT INTO items VALUES (1583, 3);
+INSERT INTO items VALUES (1584, 4);
+INSERT INTO items VALUES (1585, 5);
+INSERT INTO items VALUES (1586, 6);
+INSERT INTO items VALUES (1587, 7);
+INSERT INTO items VALUES (1588, 8);
+INSERT INTO items VALUES (1589, 9);
+INSERT INTO items VALUES (1590, 0);
+INSERT INTO items VALUES (1591, 1);
+INSERT INTO items VALUES (1592, 2);
+INSERT INTO items VALUES (1593, 3);
+INSERT INTO items VALUES (1594, 4);
+INSERT INTO items VALUES (1595, 5);
+INSERT INTO items VALUES (1596, 6);
+INSERT INTO items VALUES (1597, 7);
+INSERT INTO items VALUES (1598, 8);
+INSERT INTO items VALUES (1599, 9);
+INSERT INTO items VALUES (1600, 0);
+INSERT INTO items VALUES (1601, 1);
+INSERT INTO items VALUES (1602, 2);
+INSERT INTO items VALUES (1603, 3);
+INSERT INTO items VALUES (1604, 4);
+INSERT INTO items VALUES (1605, 5);
+INSERT INTO items VALUES (1606, 6);
+INSERT INTO items VALUES (1607, 7);
+INSERT INTO items VALUES (1608, 8);
+INSERT INTO items VALUES (1609, 9);
+INSERT INTO items VALUES (1610, 0);
+INSERT INTO items VALUES (1611, 1);
+INSERT INTO items VALUES (1612, 2);
+INSERT INTO items VALUES (1613, 3);
+INSERT INTO items VALUES (1614, 4);
+INSERT INTO items VALUES (1615, 5);
+INSERT INTO items VALUES (1616, 6);
+INSERT INTO items VALUES (1617, 7);
+INSERT INTO items VALUES (1618, 8);
+INSERT INTO items VALUES (1619, 9);
+INSERT INTO items VALUES (1620, 0);
+INSERT INTO items VALUES (1621, 1);
+INSERT INTO items VALUES (1622, 2);
+INSERT INTO items VALUES (1623, 3);
+INSERT INTO items VALUES (1624, 4);
+INSERT INTO items VALUES (1625, 5);
+INSERT INTO items VALUES (1626, 6);
+INSERT INTO items VALUES (1627, 7);
+INSERT INTO items VALUES (1628, 8);
+INSERT INTO items VALUES (1629, 9);
+INSERT INTO items VALUES (1630, 0);
+INSERT INTO items VALUES (1631, 1);
+INSERT INTO items VALUES (1632, 2);
+INSERT INTO items VALUES (1633, 3);
+INSERT INTO items VALUES (1634, 4);
+INSERT INTO items VALUES (1635, 5);
+INSERT INTO items VALUES (1636, 6);
+INSERT INTO items VALUES (1637, 7);
+INSERT INTO items VALUES (1638, 8);
+INSERT INTO items VALUES (1639, 9);
+INSERT INTO items VALUES (1640, 0);
+INSERT INTO items VALUES (1641, 1);
+INSERT INTO items VALUES (1642, 2);
+INSERT INTO items VALUES (1643, 3);
+INSERT INTO items VALUES (1644, 4);
+INSERT INTO items VALUES (1645, 5);
+INSERT INTO items VALUES (1646, 6);
+INSERT INTO items VALUES (1647, 7);
+INSERT INTO items VALUES (1648, 8);
+INSERT INTO items VALUES (1649, 9);
+INSERT INTO items VALUES (1650, 0);
+INSERT INTO items VALUES (1651, 1);
+INSERT INTO items VALUES (1652, 2);
+INSERT INTO items VALUES (1653, 3);
+INSERT INTO items VALUES (1654, 4);
+INSERT INTO items VALUES (1655, 5);
+INSERT INTO items VALUES (1656, 6);
+INSERT INTO items VALUES (1657, 7);
+INSERT INTO items VALUES (1658, 8);
+INSERT INTO items VALUES (1659, 9);
+INSERT INTO items VALUES (1660, 0);
+INSERT INTO items VALUES (1661, 1);
+INSERT INTO items VALUES (1662, 2);
+INSERT INTO items VALUES (1663, 3);
+INSERT INTO items VALUES (1664, 4);
+INSERT INTO items VALUES (1665, 5);
+INSERT INTO items VALUES (1666, 6);
+INSERT INTO items VALUES (1667, 7);
+INSERT INTO items VALUES (1668, 8);
+INSERT INTO items VALUES (1669, 9);
+INSERT INTO items VALUES (1670, 0);
+INSERT INTO items VALUES (1671, 1);
+INSERT INTO items VALUES (1672, 2);
+INSERT INTO items VALUES (1673, 3);
+INSERT INTO items VALUES (1674, 4);
+INSERT INTO items VALUES (1675, 5);
+INSERT INTO items VALUES (1676, 6);
+INSERT INTO items VALUES (1677, 7);
+INSERT INTO items VALUES (1678, 8);
+INSERT INTO items VALUES (1679, 9);
+INSERT INTO items VALUES (1680, 0);
+INSERT INTO items VALUES (1681, 1);
+INSERT INTO items VALUES (1682, 2);
+INSERT INTO items VALUES (1683, 3);
+INSERT INTO items VALUES (1684, 4);
+INSERT INTO items VALUES (1685, 5);
+INSERT INTO items VALUES (1686, 6);
+INSERT INTO items VALUES (1687, 7);
+INSERT INTO items VALUES (1688, 8);
+INSERT INTO items VALUES (1689, 9);
+INSERT INTO items VALUES (1690, 0);
+INSERT INTO items VALUES (1691, 1);
+INSERT INTO items VALUES (1692, 2);
+INSERT INTO items VALUES (1693, 3);
+INSERT INTO items VALUES (1694, 4);
+INSERT INTO items VALUES (1695, 5);
+INSERT INTO items VALUES (1696, 6);
+INSERT INTO items VALUES (1697, 7);
+INSERT INTO items VALUES (1698, 8);
+INSERT INTO items VALUES (1699, 9);
+INSERT INTO items VALUES (1700, 0);
+INSERT INTO items VALUES (1701, 1);
+INSERT INTO items VALUES (1702, 2);
+INSERT INTO items VALUES (1703, 3);
+INSERT INTO items VALUES (1704, 4);
+INSERT INTO items VALUES (1705, 5);
+INSERT INTO items VALUES (1706, 6);
+INSERT INTO items VALUES (1707, 7);
+INSERT INTO items VALUES (1708, 8);
+INSERT INTO items VALUES (1709, 9);
+INSERT INTO items VALUES (1710, 0);
+INSERT INTO items VALUES (1711, 1);
+INSERT INTO items VALUES (1712, 2);
+INSERT INTO items VALUES (1713, 3);
+INSERT INTO items VALUES (1714, 4);
+INSERT INTO items VALUES (1715, 5);
+INSERT INTO items VALUES (1716, 6);
+INSERT INTO items VALUES (1717, 7);
+INSERT INTO items VALUES (1718, 8);
+INSERT INTO items VALUES (1719, 9);
+INSERT INTO items VALUES (1720, 0);
+INSERT INTO items VALUES (1721, 1);
+INSERT INTO items VALUES (1722, 2);
+INSERT INTO items VALUES (1723, 3);
+INSERT INTO items VALUES (1724, 4);
+INSERT INTO items VALUES (1725, 5);
+INSERT INTO items VALUES (1726, 6);
+INSERT INTO items VALUES (1727, 7);
+INSERT INTO items VALUES (1728, 8);
+INSERT INTO items VALUES (1729, 9);
+INSERT INTO items VALUES (1730, 0);
+INSERT INTO items VALUES (1731, 1);
+INSERT INTO items VALUES (1732, 2);
+INSERT INTO items VALUES (1733, 3);
+INSERT INTO items VALUES (1734, 4);
+INSERT INTO items VALUES (1735, 5);
+INSERT INTO items VALUES (1736, 6);
+INSERT INTO items VALUES (1737, 7);
+INSERT INTO items VALUES (1738, 8);
+INSERT INTO items VALUES (1739, 9);
+INSERT INTO items VALUES (1740, 0);
+INSERT INTO items VALUES (1741, 1);
+INSERT INTO items VALUES (1742, 2);
+INSERT INTO items VALUES (1743, 3);
+INSERT INTO items VALUES (1744, 4);
+INSERT INTO items VALUES (1745, 5);
+INSERT INTO items VALUES (1746, 6);
+INSERT INTO items VALUES (1747, 7);
+INSERT INTO items VALUES (1748, 8);
+INSERT INTO items VALUES (1749, 9);
+INSERT INTO items VALUES (1750, 0);
+INSERT INTO items VALUES (1751, 1);
+INSERT INTO items VALUES (1752, 2);
+INSERT INTO items VALUES (1753, 3);
+INSERT INTO items VALUES (1754, 4);
+INSERT INTO items VALUES (1755, 5);
+INSERT INTO items VALUES (1756, 6);
+INSERT INTO items VALUES (1757, 7);
+INSERT INTO items VALUES (1758, 8);
+INSERT INTO items VALUES (1759, 9);
+INSERT INTO items VALUES (1760, 0);
+INSERT INTO items VALUES (1761, 1);
+INSERT INTO items VALUES (1762, 2);
+INSERT INTO items VALUES (1763, 3);
+INSERT INTO items VALUES (1764, 4);
+INSERT INTO items VALUES (1765, 5);
+INSERT INTO items VALUES (1766, 6);
+INSERT INTO items VALUES (1767, 7);
+INSERT INTO items VALUES (1768, 8);
+INSERT INTO items VALUES (1769, 9);
+INSERT INTO items VALUES (1770, 0);
+INSERT INTO items VALUES (1771, 1);
+INSERT INTO items VALUES (1772, 2);
+INSERT INTO items VALUES (1773, 3);
+INSERT INTO items VALUES (1774, 4);
+INSERT INTO items VALUES (1775, 5);
+INSERT INTO items VALUES (1776, 6);
+INSERT INTO items VALUES (1777, 7);
+INSERT INTO items VALUES (1778, 8);
+INSERT INTO items VALUES (1779, 9);
+INSERT INTO items VALUES (1780, 0);
+INSERT INTO items VALUES (1781, 1);
+INSERT INTO items VALUES (1782, 2);
+INSERT INTO items VALUES (1783, 3);
+INSERT INTO items VALUES (1784, 4);
+INSERT INTO items VALUES (1785, 5);
+INSERT INTO items VALUES (1786, 6);
+INSERT INTO items VALUES (1787, 7);
+INSERT INTO items VALUES (1788, 8);
+INSERT INTO items VALUES (1789, 9);
+INSERT INTO items VALUES (1790, 0);
+INSERT INTO items VALUES (1791, 1);
+INSERT INTO items VALUES (1792, 2);
+INSERT INTO items VALUES (1793, 3);
+INSERT INTO items VALUES (1794, 4);
+INSERT INTO items VALUES (1795, 5);
+INSERT INTO items VALUES (1796, 6);
+INSERT INTO items VALUES (1797, 7);
+INSERT INTO items VALUES (1798, 8);
+INSERT INTO items VALUES (1799, 9);
+INSERT INTO items VALUES (1800, 0);
+INSERT INTO items VALUES (1801, 1);
+INSERT INTO items VALUES (1802, 2);
+INSERT INTO items VALUES (1803, 3);
+INSERT INTO items VALUES (1804, 4);
+INSERT INTO items VALUES (1805, 5);
+INSERT INTO items VALUES (1806, 6);
+INSERT INTO items VALUES (1807, 7);
+INSERT INTO items VALUES (1808, 8);
+INSERT INTO items VALUES (1809, 9);
+INSERT INTO items VALUES (1810, 0);
+INSERT INTO items VALUES (1811, 1);
+INSERT INTO items VALUES (1812, 2);
+INSERT INTO items VALUES (1813, 3);
+INSERT INTO items VALUES (1814, 4);
+INSERT INTO items VALUES (1815, 5);
+INSERT INTO items VALUES (1816, 6);
+INSERT INTO items VALUES (1817, 7);
+INSERT INTO items VALUES (1818, 8);
+INSERT INTO items VALUES (1819, 9);
+INSERT INTO items VALUES (1820, 0);
+INSERT INTO items VALUES (1821, 1);
+INSERT INTO items VALUES (1822, 2);
+INSERT INTO items VALUES (1823, 3);
+INSERT INTO items VALUES (1824, 4);
+INSERT INTO items VALUES (1825, 5);
+INSERT INTO items VALUES (1826, 6);
+INSERT INTO items VALUES (1827, 7);
+INSERT INTO items VALUES (1828, 8);
+INSERT INTO items VALUES (1829, 9);
+INSERT INTO items VALUES (1830, 0);
+INSERT INTO items VALUES (1831, 1);
+INSERT INTO items VALUES (1832, 2);
+INSERT INTO items VALUES (1833, 3);
+INSERT INTO items VALUES (1834, 4);
+INSERT INTO items VALUES (1835, 5);
+INSERT INTO items VALUES (1836, 6);
+INSERT INTO items VALUES (1837, 7);
+INSERT INTO items VALUES (1838, 8);
+INSERT INTO items VALUES (1839, 9);
+INSERT INTO items VALUES (1840, 0);
+INSERT INTO items VALUES (1841, 1);
+INSERT INTO items VALUES (1842, 2);
+INSERT INTO items VALUES (1843, 3);
+INSERT INTO items VALUES (1844, 4);
+INSERT INTO items VALUES (1845, 5);
+INSERT INTO items VALUES (1846, 6);
+INSERT INTO items VALUES (1847, 7);
+INSERT INTO items VALUES (1848, 8);
+INSERT INTO items VALUES (1849, 9);
+INSERT INTO items VALUES (1850, 0);
+INSERT INTO items VALUES (1851, 1);
+INSERT INTO items VALUES (1852, 2);
+INSERT INTO items VALUES (1853, 3);
+INSERT INTO items VALUES (1854, 4);
+INSERT INTO items VALUES (1855, 5);
+INSERT INTO items VALUES (1856, 6);
+INSERT INTO items VALUES (1857, 7);
+INSERT INTO items VALUES (1858, 8);
+INSERT INTO items VALUES (1859, 9);
+INSERT INTO items VALUES (1860, 0);
+INSERT INTO items VALUES (1861, 1);
+INSERT INTO items VALUES (1862, 2);
+INSERT INTO items VALUES (1863, 3);
+INSERT INTO items VALUES (1864, 4);
+INSERT INTO items VALUES (1865, 5);
+INSERT INTO items VALUES (1866, 6);
+INSERT INTO items VALUES (1867, 7);
+INSERT INTO items VALUES (1868, 8);
+INSERT INTO items VALUES (1869, 9);
+INSERT INTO items VALUES (1870, 0);
+INSERT INTO items VALUES (1871, 1);
+INSERT INTO items VALUES (1872, 2);
+INSERT INTO items VALUES (1873, 3);
+INSERT INTO items VALUES (1874, 4);
+INSERT INTO items VALUES (1875, 5);
+INSERT INTO items VALUES (1876, 6);
+INSERT INTO items VALUES (1877, 7);
+INSERT INTO items VALUES (1878, 8);
+INSERT INTO items VALUES (1879, 9);
+INSERT INTO items VALUES (1880, 0);
+INSERT INTO items VALUES (1881, 1);
+INSERT INTO items VALUES (1882, 2);
+INSERT INTO items VALUES (1883, 3);
+INSERT INTO items VALUES (1884, 4);
+INSERT INTO items VALUES (1885, 5);
+INSERT INTO items VALUES (1886, 6);
+INSERT INTO items VALUES (1887, 7);
+INSERT INTO items VALUES (1888, 8);
+INSERT INTO items VALUES (1889, 9);
+INSERT INTO items VALUES (1890, 0);
+INSERT INTO items VALUES (1891, 1);
+INSERT INTO items VALUES (1892, 2);
+INSERT INTO items VALUES (1893, 3);
+INSERT INTO items VALUES (1894, 4);
+INSERT INTO items VALUES (1895, 5);
+INSERT INTO items VALUES (1896, 6);
+INSERT INTO items VALUES (1897, 7);
+INSERT INTO items VALUES (1898, 8);
+INSERT INTO items VALUES (1899, 9);
+INSERT INTO items VALUES (1900, 0);
+INSERT INTO items VALUES (1901, 1);
+INSERT INTO items VALUES (1902, 2);
+INSERT INTO items VALUES (1903, 3);
+INSERT INTO items VALUES (1904, 4);
+INSERT INTO items VALUES (1905, 5);
+INSERT INTO items VALUES (1906, 6);
+INSERT INTO items VALUES (1907, 7);
+INSERT INTO items VALUES (1908, 8);
+INSERT INTO items VALUES (1909, 9);
+INSERT INTO items VALUES (1910, 0);
+INSERT INTO items VALUES (1911, 1);
+INSERT INTO items VALUES (1912, 2);
+INSERT INTO items VALUES (1913, 3);
+INSERT INTO items VALUES (1914, 4);
+INSERT INTO items VALUES (1915, 5);
+INSERT INTO items VALUES (1916, 6);
+INSERT INTO items VALUES (1917, 7);
+INSERT INTO items VALUES (1918, 8);
+INSERT INTO items VALUES (1919, 9);
+INSERT INTO items VALUES (1920, 0);
+INSERT INTO items VALUES (1921, 1);
+INSERT INTO items VALUES (1922, 2);
+INSERT INTO items VALUES (1923, 3);
+INSERT INTO items VALUES (1924, 4);
+INSERT INTO items VALUES (1925, 5);
+INSERT INTO items VALUES (1926, 6);
+INSERT INTO items VALUES (1927, 7);
+INSERT INTO items VALUES (1928, 8);
+INSERT INTO items VALUES (1929, 9);
+INSERT INTO items VALUES (1930, 0);
+INSERT INTO items VALUES (1931, 1);
+INSERT INTO items VALUES (1932, 2);
+INSERT INTO items VALUES (1933, 3);
+INSERT INTO items VALUES (1934, 4);
+INSERT INTO items VALUES (1935, 5);
+INSERT INTO items VALUES (1936, 6);
+INSERT INTO items VALUES (1937, 7);
+INSERT INTO items VALUES (1938, 8);
+INSERT INTO items VALUES (1939, 9);
+INSERT INTO items VALUES (1940, 0);
+INSERT INTO items VALUES (1941, 1);
+INSERT INTO items VALUES (1942, 2);
+INSERT INTO items VALUES (1943, 3);
+INSERT INTO items VALUES (1944, 4);
+INSERT INTO items VALUES (1945, 5);
+INSERT INTO items VALUES (1946, 6);
+INSERT INTO items VALUES (1947, 7);
+INSERT INTO items VALUES (1948, 8);
+INSERT INTO items VALUES (1949, 9);
+INSERT INTO items VALUES (1950, 0);
+INSERT INTO items VALUES (1951, 1);
+INSERT INTO items VALUES (1952, 2);
+INSERT INTO items VALUES (1953, 3);
+INSERT INTO items VALUES (1954, 4);
+INSERT INTO items VALUES (1955, 5);
+INSERT INTO items VALUES (1956, 6);
+INSERT INTO items VALUES (1957, 7);
+INSERT INTO items VALUES (1958, 8);
+INSERT INTO items VALUES (1959, 9);
+INSERT INTO items VALUES (1960, 0);
+INSERT INTO items VALUES (1961, 1);
+INSERT INTO items VALUES (1962, 2);
+INSERT INTO items VALUES (1963, 3);
+INSERT INTO items VALUES (1964, 4);
+INSERT INTO items VALUES (1965, 5);
+INSERT INTO items VALUES (1966, 6);
+INSERT INTO items VALUES (1967, 7);
+INSERT INTO items VALUES (1968, 8);
+INSERT INTO items VALUES (1969, 9);
+INSERT INTO items VALUES (1970, 0);
+INSERT INTO items VALUES (1971, 1);
+INSERT INTO items VALUES (1972, 2);
+INSERT INTO items VALUES (1973, 3);
+INSERT INTO items VALUES (1974, 4);
+INSERT INTO items VALUES (1975, 5);
+INSERT INTO items VALUES (1976, 6);
+INSERT INTO items VALUES (1977, 7);
+INSERT INTO items VALUES (1978, 8);
+INSERT INTO items VALUES (1979, 9);
+INSERT INTO items VALUES (1980, 0);
+INSERT INTO items VALUES (1981, 1);
+INSERT INTO items VALUES (1982, 2);
+INSERT INTO items VALUES (1983, 3);
+INSERT INTO items VALUES (1984, 4);
+INSERT INTO items VALUES (1985, 5);
+INSERT INTO items VALUES (1986, 6);
+INSERT INTO items VALUES (1987, 7);
+INSERT INTO items VALUES (1988, 8);
+INSERT INTO items VALUES (1989, 9);
+INSERT INTO items VALUES (1990, 0);
+INSERT INTO items VALUES (1991, 1);
+INSERT INTO items VALUES (1992, 2);
+INSERT INTO items VALUES (1993, 3);
+INSERT INTO items VALUES (1994, 4);
+INSERT INTO items VALUES (1995, 5);
+INSERT INTO items VALUES (1996, 6);
+INSERT INTO items VALUES (1997, 7);
+INSERT INTO items VALUES (1998, 8);
+INSERT INTO items VALUES (1999, 9);
+INSERT INTO items VALUES (2000, 0);
+INSERT INTO items VALUES (2001, 1);
+INSERT INTO items VALUES (2002, 2);
+INSERT INTO items VALUES (2003, 3);
+INSERT INTO items VALUES (2004, 4);
+INSERT INTO items VALUES (2005, 5);
+INSERT INTO items VALUES (2006, 6);
+INSERT INTO items VALUES (2007, 7);
+INSERT INTO items VALUES (2008, 8);
+INSERT INTO items VALUES (2009, 9);
+INSERT INTO items VALUES (2010, 0);
+INSERT INTO items VALUES (2011, 1);
+INSERT INTO items VALUES (2012, 2);
+INSERT INTO items VALUES (2013, 3);
+INSERT INTO items VALUES (2014, 4);
+INSERT INTO items VALUES (2015, 5);
+INSERT INTO items VALUES (2016, 6);
+INSERT INTO items VALUES (2017, 7);
+INSERT INTO items VALUES (2018, 8);
+INSERT INTO items VALUES (2019, 9);
+INSERT INTO items VALUES (2020, 0);
+INSERT INTO items VALUES (2021, 1);
+INSERT INTO items VALUES (2022, 2);
+INSERT INTO items VALUES (2023, 3);
+INSERT INTO items VALUES (2024, 4);
+INSERT INTO items VALUES (2025, 5);
+INSERT INTO items VALUES (2026, 6);
+INSERT INTO items VALUES (2027, 7);
+INSERT INTO items VALUES (2028, 8);
+INSERT INTO items VALUES (2029, 9);
+INSERT INTO items VALUES (2030, 0);
+INSERT INTO items VALUES (2031, 1);
+INSERT INTO items VALUES (2032, 2);
+INSERT INTO items VALUES (2033, 3);
+INSERT INTO items VALUES (2034, 4);
+INSERT INTO items VALUES (2035, 5);
+INSERT INTO items VALUES (2036, 6);
+INSERT INTO items VALUES (2037, 7);
+INSERT INTO items VALUES (2038, 8);
+INSERT INTO items VALUES (2039, 9);
+INSERT INTO items VALUES (2040, 0);
+INSERT INTO items VALUES (2041, 1);
+INSERT INTO items VALUES (2042, 2);
+INSERT INTO items VALUES (2043, 3);
+INSERT INTO items VALUES (2044, 4);
+INSERT INTO items VALUES (2045, 5);
+INSERT INTO items VALUES (2046, 6);
+INSERT INTO items VALUES (2047, 7);
+INSERT INTO items VALUES (2048, 8);
+INSERT INTO items VALUES (2049, 9);
+INSERT INTO items VALUES (2050, 0);
+INSERT INTO items VALUES (2051, 1);
+INSERT INTO items VALUES (2052, 2);
+INSERT INTO items VALUES (2053, 3);
+INSERT INTO items VALUES (2054, 4);
+INSERT INTO items VALUES (2055, 5);
+INSERT INTO items VALUES (2056, 6);
+INSERT INTO items VALUES (2057, 7);
+INSERT INTO items VALUES (2058, 8);
+INSERT INTO items VALUES (2059, 9);
+INSERT INTO items VALUES (2060, 0);
+INSERT INTO items VALUES (2061, 1);
+INSERT INTO items VALUES (2062, 2);
+INSERT INTO items VALUES (2063, 3);
+INSERT INTO items VALUES (2064, 4);
+INSERT INTO items VALUES (2065, 5);
+INSERT INTO items VALUES (2066, 6);
+INSERT INTO items VALUES (2067, 7);
+INSERT INTO items VALUES (2068, 8);
+INSERT INTO items VALUES (2069, 9);
+INSERT INTO items VALUES (2070, 0);
+INSERT INTO items VALUES (2071, 1);
+INSERT INTO items VALUES (2072, 2);
+INSERT INTO items VALUES (2073, 3);
+INSERT INTO items VALUES (2074, 4);
+INSERT INTO items VALUES (2075, 5);
+INSERT INTO items VALUES (2076, 6);
+INSERT INTO items VALUES (2077, 7);
+INSERT INTO items VALUES (2078, 8);
+INSERT INTO items VALUES (2079, 9);
+INSERT INTO items VALUES (2080, 0);
+INSERT INTO items VALUES (2081, 1);
+INSERT INTO items VALUES (2082, 2);
+INSERT INTO items VALUES (2083, 3);
+INSERT INTO items VALUES (2084, 4);
+INSERT INTO items VALUES (2085, 5);
+INSERT INTO items VALUES (2086, 6);
+INSERT INTO items VALUES (2087, 7);
+INSERT INTO items VALUES (2088, 8);
+INSERT INTO items VALUES (2089, 9);
+INSERT INTO items VALUES (2090, 0);
+INSERT INTO items VALUES (2091, 1);
+INSERT INTO items VALUES (2092, 2);
+INSERT INTO items VALUES (2093, 3);
+INSERT INTO items VALUES (2094, 4);
+INSERT INTO items VALUES (2095, 5);
+INSERT INTO items VALUES (2096, 6);
+INSERT INTO items VALUES (2097, 7);
+INSERT INTO items VALUES (2098, 8);
+INSERT INTO items VALUES (2099, 9);
+INSERT INTO items VALUES (2100, 0);
+INSERT INTO items VALUES (2101, 1);
+INSERT INTO items VALUES (2102, 2);
+INSERT INTO items VALUES (2103, 3);
+INSERT INTO items VALUES (2104, 4);
+INSERT INTO items VALUES (2105, 5);
+INSERT INTO items VALUES (2106, 6);
+INSERT INTO items VALUES (2107, 7);
+INSERT INTO items VALUES (2108, 8);
+INSERT INTO items VALUES (2109, 9);
+INSERT INTO items VALUES (2110, 0);
+INSERT INTO items VALUES (2111, 1);
+INSERT INTO items VALUES (2112, 2);
+INSERT INTO items VALUES (2113, 3);
+INSERT INTO items VALUES (2114, 4);
+INSERT INTO items VALUES (2115, 5);
+INSERT INTO items VALUES (2116, 6);
+INSERT INTO items VALUES (2117, 7);
+INSERT INTO items VALUES (2118, 8);
+INSERT INTO items VALUES (2119, 9);
+INSERT INTO items VALUES (2120, 0);
+INSERT INTO items VALUES (2121, 1);
+INSERT INTO items VALUES (2122, 2);
+INSERT INTO items VALUES (2123, 3);
+INSERT INTO items VALUES (2124, 4);
+INSERT INTO items VALUES (2125, 5);
+INSERT INTO items VALUES (2126, 6);
+INSERT INTO items VALUES (2127, 7);
+INSERT INTO items VALUES (2128, 8);
+INSERT INTO items VALUES (2129, 9);
+INSERT INTO items VALUES (2130, 0);
+INSERT INTO items VALUES (2131, 1);
+INSERT INTO items VALUES (2132, 2);
+INSERT INTO items VALUES (2133, 3);
+INSERT INTO items VALUES (2134, 4);
+INSERT INTO items VALUES (2135, 5);
+INSERT INTO items VALUES (2136, 6);
+INSERT INTO items VALUES (2137, 7);
+INSERT INTO items VALUES (2138, 8);
+INSERT INTO items VALUES (2139, 9);
+INSERT INTO items VALUES (2140, 0);
+INSERT INTO items VALUES (2141, 1);
+INSERT INTO items VALUES (2142, 2);
+INSERT INTO items VALUES (2143, 3);
+INSERT INTO items VALUES (2144, 4);
+INSERT INTO items VALUES (2145, 5);
+INSERT INTO items VALUES (2146, 6);
+INSERT INTO items VALUES (2147, 7);
+INSERT INTO items VALUES (2148, 8);
+INSERT INTO items VALUES (2149, 9);
+INSERT INTO items VALUES (2150, 0);
+INSERT INTO items VALUES (2151, 1);
+INSERT INTO items VALUES (2152, 2);
+INSERT INTO items VALUES (2153, 3);
+INSERT INTO items VALUES (2154, 4);
+INSERT INTO items VALUES (2155, 5);
+INSERT INTO items VALUES (2156, 6);
+INSERT INTO items VALUES (2157, 7);
+INSERT INTO items VALUES (2158, 8);
+INSERT INTO items VALUES (2159, 9);
+INSERT INTO items VALUES (2160, 0);
+INSERT INTO items VALUES (2161, 1);
+INSERT INTO items VALUES (2162, 2);
+INSERT INTO items VALUES (2163, 3);
+INSERT INTO items VALUES (2164, 4);
+INSERT INTO items VALUES (2165, 5);
+INSERT INTO items VALUES (2166, 6);
+INSERT INTO items VALUES (2167, 7);
+INSERT INTO items VALUES (2168, 8);
+INSERT INTO items VALUES (2169, 9);
+INSERT INTO items VALUES (2170, 0);
+INSERT INTO items VALUES (2171, 1);
+INSERT INTO items VALUES (2172, 2);
+INSERT INTO items VALUES (2173, 3);
+INSERT INTO items VALUES (2174, 4);
+INSERT INTO items VALUES (2175, 5);
+INSERT INTO items VALUES (2176, 6);
+INSERT INTO items VALUES (2177, 7);
+INSERT INTO items VALUES (2178, 8);
+INSERT INTO items VALUES (2179, 9);
+INSERT INTO items VALUES (2180, 0);
+INSERT INTO items VALUES (2181, 1);
+INSERT INTO items VALUES (2182, 2);
+INSERT INTO items VALUES (2183, 3);
+INSERT INTO items VALUES (2184, 4);
+INSERT INTO items VALUES (2185, 5);
+INSERT INTO items VALUES (2186, 6);
+INSERT INTO items VALUES (2187, 7);
+INSERT INTO items VALUES (2188, 8);
+INSERT INTO items VALUES (2189, 9);
+INSERT INTO items VALUES (2190, 0);
+INSERT INTO items VALUES (2191, 1);
+INSERT INTO items VALUES (2192, 2);
+INSERT INTO items VALUES (2193, 3);
+INSERT INTO items VALUES (2194, 4);
+INSERT INTO items VALUES (2195, 5);
+INSERT INTO items VALUES (2196, 6);
+INSERT INTO items VALUES (2197, 7);
+INSERT INTO items VALUES (2198, 8);
+INSERT INTO items VALUES (2199, 9);
+INSERT INTO items VALUES (2200, 0);
+INSERT INTO items VALUES (2201, 1);
+INSERT INTO items VALUES (2202, 2);
+INSERT INTO items VALUES (2203, 3);
+INSERT INTO items VALUES (2204, 4);
+INSERT INTO items VALUES (2205, 5);
+INSERT INTO items VALUES (2206, 6);
+INSERT INTO items VALUES (2207, 7);
+INSERT INTO items VALUES (2208, 8);
+INSERT INTO items VALUES (2209, 9);
+INSERT INTO items VALUES (2210, 0);
+INSERT INTO items VALUES (2211, 1);
+INSERT INTO items VALUES (2212, 2);
+INSERT INTO items VALUES (2213, 3);
+INSERT INTO items VALUES (2214, 4);
+INSERT INTO items VALUES (2215, 5);
+INSERT INTO items VALUES (2216, 6);
+INSERT INTO items VALUES (2217, 7);
+INSERT INTO items VALUES (2218, 8);
+INSERT INTO items VALUES (2219, 9);
+INSERT INTO items VALUES (2220, 0);
+INSERT INTO items VALUES (2221, 1);
+INSERT INTO items VALUES (2222, 2);
+INSERT INTO items VALUES (2223, 3);
+INSERT INTO items VALUES (2224, 4);
+INSERT INTO items VALUES (2225, 5);
+INSERT INTO items VALUES (2226, 6);
+INSERT INTO items VALUES (2227, 7);
+INSERT INTO items VALUES (2228, 8);
+INSERT INTO items VALUES (2229, 9);
+INSERT INTO items VALUES (2230, 0);
+INSERT INTO items VALUES (2231, 1);
+INSERT INTO items VALUES (2232, 2);
+INSERT INTO items VALUES (2233, 3);
+INSERT INTO items VALUES (2234, 4);
+INSERT INTO items VALUES (2235, 5);
+INSERT INTO items VALUES (2236, 6);
+INSERT INTO items VALUES (2237, 7);
+INSERT INTO items VALUES (2238, 8);
+INSERT INTO items VALUES (2239, 9);
+INSERT INTO items VALUES (2240, 0);
+INSERT INTO items VALUES (2241, 1);
+INSERT INTO items VALUES (2242, 2);
+INSERT INTO items VALUES (2243, 3);
+INSERT INTO items VALUES (2244, 4);
+INSERT INTO items VALUES (2245, 5);
+INSERT INTO items VALUES (2246, 6);
+INSERT INTO items VALUES (2247, 7);
+INSERT INTO items VALUES (2248, 8);
+INSERT INTO items VALUES (2249, 9);
+INSERT INTO items VALUES (2250, 0);
+INSERT INTO items VALUES (2251, 1);
+INSERT INTO items VALUES (2252, 2);
+INSERT INTO items VALUES (2253, 3);
+INSERT INTO items VALUES (2254, 4);
+INSERT INTO items VALUES (2255, 5);
+INSERT INTO items VALUES (2256, 6);
+INSERT INTO items VALUES (2257, 7);
+INSERT INTO items VALUES (2258, 8);
+INSERT INTO items VALUES (2259, 9);
+INSERT INTO items VALUES (2260, 0);
+INSERT INTO items VALUES (2261, 1);
+INSERT INTO items VALUES (2262, 2);
+INSERT INTO items VALUES (2263, 3);
+INSERT INTO items VALUES (2264, 4);
+INSERT INTO items VALUES (2265, 5);
+INSERT INTO items VALUES (2266, 6);
+INSERT INTO items VALUES (2267, 7);
+INSERT INTO items VALUES (2268, 8);
+INSERT INTO items VALUES (2269, 9);
+INSERT INTO items VALUES (2270, 0);
+INSERT INTO items VALUES (2271, 1);
+INSERT INTO items VALUES (2272, 2);
+INSERT INTO items VALUES (2273, 3);
+INSERT INTO items VALUES (2274, 4);
+INSERT INTO items VALUES (2275, 5);
+INSERT INTO items VALUES (2276, 6);
+INSERT INTO items VALUES (2277, 7);
+INSERT INTO items VALUES (2278, 8);
+INSERT INTO items VALUES (2279, 9);
+INSERT INTO items VALUES (2280, 0);
+INSERT INTO items VALUES (2281, 1);
+INSERT INTO items VALUES (2282, 2);
+INSERT INTO items VALUES (2283, 3);
+INSERT INTO items VALUES (2284, 4);
+INSERT INTO items VALUES (2285, 5);
+INSERT INTO items VALUES (2286, 6);
+INSERT INTO items VALUES (2287, 7);
+INSERT INTO items VALUES (2288, 8);
+INSERT INTO items VALUES (2289, 9);
+INSERT INTO items VALUES (2290, 0);
+INSERT INTO items VALUES (2291, 1);
+INSERT INTO items VALUES (2292, 2);
+INSERT INTO items VALUES (2293, 3);
+INSERT INTO items VALUES (2294, 4);
+INSERT INTO items VALUES (2295, 5);
+INSERT INTO items VALUES (2296, 6);
+INSERT INTO items VALUES (2297, 7);
+INSERT INTO items VALUES (2298, 8);
+INSERT INTO items VALUES (2299, 9);
+INSERT INTO items VALUES (2300, 0);
+INSERT INTO items VALUES (2301, 1);
+INSERT INTO items VALUES (2302, 2);
+INSERT INTO items VALUES (2303, 3);
+INSERT INTO items VALUES (2304, 4);
+INSERT INTO items VALUES (2305, 5);
+INSERT INTO items VALUES (2306, 6);
+INSERT INTO items VALUES (2307, 7);
+INSERT INTO items VALUES (2308, 8);
+INSERT INTO items VALUES (2309, 9);
+INSERT INTO items VALUES (2310, 0);
+INSERT INTO items VALUES (2311, 1);
+INSERT INTO items VALUES (2312, 2);
+INSERT INTO items VALUES (2313, 3);
+INSERT INTO items VALUES (2314, 4);
+INSERT INTO items VALUES (2315, 5);
+INSERT INTO items VALUES (2316, 6);
+INSERT INTO items VALUES (2317, 7);
+INSERT INTO items VALUES (2318, 8);
+INSERT INTO items VALUES (2319, 9);
+INSERT INTO items VALUES (2320, 0);
+INSERT INTO items VALUES (2321, 1);
+INSERT INTO items VALUES (2322, 2);
+INSERT INTO items VALUES (2323, 3);
+INSERT INTO items VALUES (2324, 4);
+INSERT INTO items VALUES (2325, 5);
+INSERT INTO items VALUES (2326, 6);
+INSERT INTO items VALUES (2327, 7);
+INSERT INTO items VALUES (2328, 8);
+INSERT INTO items VALUES (2329, 9);
+INSERT INTO items VALUES (2330, 0);
+INSERT INTO items VALUES (2331, 1);
+INSERT INTO items VALUES (2332, 2);
+INSERT INTO items VALUES (2333, 3);
+INSERT INTO items VALUES (2334, 4);
+INSERT INTO items VALUES (2335, 5);
+INSERT INTO items VALUES (2336, 6);
+INSERT INTO items VALUES (2337, 7);
+INSERT INTO items VALUES (2338, 8);
+INSERT INTO items VALUES (2339, 9);
+INSERT INTO items VALUES (2340, 0);
+INSERT INTO items VALUES (2341, 1);
+INSERT INTO items VALUES (2342, 2);
+INSERT INTO items VALUES (2343, 3);
+INSERT INTO items VALUES (2344, 4);
+INSERT INTO items VALUES (2345, 5);
+INSERT INTO items VALUES (2346, 6);
+INSERT INTO items VALUES (2347, 7);
+INSERT INTO items VALUES (2348, 8);
+INSERT INTO items VALUES (2349, 9);
+INSERT INTO items VALUES (2350, 0);
+INSERT INTO items VALUES (2351, 1);
+INSERT INTO items VALUES (2352, 2);
+INSERT INTO items VALUES (2353, 3);
+INSERT INTO items VALUES (2354, 4);
+INSERT INTO items VALUES (2355, 5);
+INSERT INTO items VALUES (2356, 6);
+INSERT INTO items VALUES (2357, 7);
+INSERT INTO items VALUES (2358, 8);
+INSERT INTO items VALUES (2359, 9);
+INSERT INTO items VALUES (2360, 0);
+INSERT INTO items VALUES (2361, 1);
+INSERT INTO items VALUES (2362, 2);
+INSERT INTO items VALUES (2363, 3);
+INSERT INTO items VALUES (2364, 4);
+INSERT INTO items VALUES (2365, 5);
+INSERT INTO items VALUES (2366, 6);
+INSERT INTO items VALUES (2367, 7);
+INSERT INTO items VALUES (2368, 8);
+INSERT INTO items VALUES (2369, 9);
+INSERT INTO items VALUES (2370, 0);
+INSERT INTO items VALUES (2371, 1);
+INSERT INTO items VALUES (2372, 2);
+INSERT INTO items VALUES (2373, 3);
+INSERT INTO items VALUES (2374, 4);
+INSERT INTO items VALUES (2375, 5);
+INSERT INTO items VALUES (2376, 6);
+INSERT INTO items VALUES (2377, 7);
+INSERT INTO items VALUES (2378, 8);
+INSERT INTO items VALUES (2379, 9);
+INSERT INTO items VALUES (2380, 0);
+INSERT INTO items VALUES (2381, 1);
+INSERT INTO items VALUES (2382, 2);
+INSERT INTO items VALUES (2383, 3);
+INSERT INTO items VALUES (2384, 4);
+INSERT INTO items VALUES (2385, 5);
+INSERT INTO items VALUES (2386, 6);
+INSERT INTO items VALUES (2387, 7);
+INSERT INTO items VALUES (2388, 8);
+INSERT INTO items VALUES (2389, 9);
+INSERT INTO items VALUES (2390, 0);
+INSERT INTO items VALUES (2391, 1);
+INSERT INTO items VALUES (2392, 2);
+INSERT INTO items VALUES (2393, 3);
+INSERT INTO items VALUES (2394, 4);
+INSERT INTO items VALUES (2395, 5);
+INSERT INTO items VALUES (2396, 6);
+INSERT INTO items VALUES (2397, 7);
+INSERT INTO items VALUES (2398, 8);
+INSERT INTO items VALUES (2399, 9);
+INSERT INTO items VALUES (2400, 0);
+INSERT INTO items VALUES (2401, 1);
+INSERT INTO items VALUES (2402, 2);
+INSERT INTO items VALUES (2403, 3);
+INSERT INTO items VALUES (2404, 4);
+INSERT INTO items VALUES (2405, 5);
+INSERT INTO items VALUES (2406, 6);
+INSERT INTO items VALUES (2407, 7);
+INSERT INTO items VALUES (2408, 8);
+INSERT INTO items VALUES (2409, 9);
+INSERT INTO items VALUES (2410, 0);
+INSERT INTO items VALUES (2411, 1);
+INSERT INTO items VALUES (2412, 2);
+INSERT INTO items VALUES (2413, 3);
+INSERT INTO items VALUES (2414, 4);
+INSERT INTO items VALUES (2415, 5);
+INSERT INTO items VALUES (2416, 6);
+INSERT INTO items VALUES (2417, 7);
+INSERT INTO items VALUES (2418, 8);
+INSERT INTO items VALUES (2419, 9);
+INSERT INTO items VALUES (2420, 0);
+INSERT INTO items VALUES (2421, 1);
+INSERT INTO items VALUES (2422, 2);
+INSERT INTO items VALUES (2423, 3);
+INSERT INTO items VALUES (2424, 4);
+INSERT INTO items VALUES (2425, 5);
+INSERT INTO items VALUES (2426, 6);
+INSERT INTO items VALUES (2427, 7);
+INSERT INTO items VALUES (2428, 8);
+INSERT INTO items VALUES (2429, 9);
+INSERT INTO items VALUES (2430, 0);
+INSERT INTO items VALUES (2431, 1);
+INSERT INTO items VALUES (2432, 2);
+INSERT INTO items VALUES (2433, 3);
+INSERT INTO items VALUES (2434, 4);
+INSERT INTO items VALUES (2435, 5);
+INSERT INTO items VALUES (2436, 6);
+INSERT INTO items VALUES (2437, 7);
+INSERT INTO items VALUES (2438, 8);
+INSERT INTO items VALUES (2439, 9);
+INSERT INTO items VALUES (2440, 0);
+INSERT INTO items VALUES (2441, 1);
+INSERT INTO items VALUES (2442, 2);
+INSERT INTO items VALUES (2443, 3);
+INSERT INTO items VALUES (2444, 4);
+INSERT INTO items VALUES (2445, 5);
+INSERT INTO items VALUES (2446, 6);
+INSERT INTO items VALUES (2447, 7);
+INSERT INTO items VALUES (2448, 8);
+INSERT INTO items VALUES (2449, 9);
+INSERT INTO items VALUES (2450, 0);
+INSERT INTO items VALUES (2451, 1);
+INSERT INTO items VALUES (2452, 2);
+INSERT INTO items VALUES (2453, 3);
+INSERT INTO items VALUES (2454, 4);
+INSERT INTO items VALUES (2455, 5);
+INSERT INTO items VALUES (2456, 6);
+INSERT INTO items VALUES (2457, 7);
+INSERT INTO items VALUES (2458, 8);
+INSERT INTO items VALUES (2459, 9);
+INSERT INTO items VALUES (2460, 0);
+INSERT INTO items VALUES (2461, 1);
+INSERT INTO items VALUES (2462, 2);
+INSERT INTO items VALUES (2463, 3);
+INSERT INTO items VALUES (2464, 4);
+INSERT INTO items VALUES (2465, 5);
+INSERT INTO items VALUES (2466, 6);
+INSERT INTO items VALUES (2467, 7);
+INSERT INTO items VALUES (2468, 8);
+INSERT INTO items VALUES (2469, 9);
+INSERT INTO items VALUES (2470, 0);
+INSERT INTO items VALUES (2471, 1);
+INSERT INTO items VALUES (2472, 2);
+INSERT INTO items VALUES (2473, 3);
+INSERT INTO items VALUES (2474, 4);
+INSERT INTO items VALUES (2475, 5);
+INSERT INTO items VALUES (2476, 6);
+INSERT INTO items VALUES (2477, 7);
+INSERT INTO items VALUES (2478, 8);
+INSERT INTO items VALUES (2479, 9);
+INSERT INTO items VALUES (2480, 0);
+INSERT INTO items VALUES (2481, 1);
+INSERT INTO items VALUES (2482, 2);
+INSERT INTO items VALUES (2483, 3);
+INSERT INTO items VALUES (2484, 4);
+INSERT INTO items VALUES (2485, 5);
+INSERT INTO items VALUES (2486, 6);
+INSERT INTO items VALUES (2487, 7);
+INSERT INTO items VALUES (2488, 8);
+INSERT INTO items VALUES (2489, 9);
+INSERT INTO items VALUES (2490, 0);
+INSERT INTO items VALUES (2491, 1);
+INSERT INTO items VALUES (2492, 2);
+INSERT INTO items VALUES (2493, 3);
+INSERT INTO items VALUES (2494, 4);
+INSERT INTO items VALUES (2495, 5);
+INSERT INTO items VALUES (2496, 6);
+INSERT INTO items VALUES (2497, 7);
+INSERT INTO items VALUES (2498, 8);
+INSERT INTO items VALUES (2499, 9);
+INSERT INTO items VALUES (2500, 0);
+INSERT INTO items VALUES (2501, 1);
+INSERT INTO items VALUES (2502, 2);
+INSERT INTO items VALUES (2503, 3);
+INSERT INTO items VALUES (2504, 4);
+INSERT INTO items VALUES (2505, 5);
+INSERT INTO items VALUES (2506, 6);
+INSERT INTO items VALUES (2507, 7);
+INSERT INTO items VALUES (2508, 8);
+INSERT INTO items VALUES (2509, 9);
+INSERT INTO items VALUES (2510, 0);
+INSERT INTO items VALUES (2511, 1);
+INSERT INTO items VALUES (2512, 2);
+INSERT INTO items VALUES (2513, 3);
+INSERT INTO items VALUES (2514, 4);
+INSERT INTO items VALUES (2515, 5);
+INSERT INTO items VALUES (2516, 6);
+INSERT INTO items VALUES (2517, 7);
+INSERT INTO items VALUES (2518, 8);
+INSERT INTO items VALUES (2519, 9);
+INSERT INTO items VALUES (2520, 0);
+INSERT INTO items VALUES (2521, 1);
+INSERT INTO items VALUES (2522, 2);
+INSERT INTO items VALUES (2523, 3);
+INSERT INTO items VALUES (2524, 4);
+INSERT INTO items VALUES (2525, 5);
+INSERT INTO items VALUES (2526, 6);
+INSERT INTO items VALUES (2527, 7);
+INSERT INTO items VALUES (2528, 8);
+INSERT INTO items VALUES (2529, 9);
+INSERT INTO items VALUES (2530, 0);
+INSERT INTO items VALUES (2531, 1);
+INSERT INTO items VALUES (2532, 2);
+INSERT INTO items VALUES (2533, 3);
+INSERT INTO items VALUES (2534, 4);
+INSERT INTO items VALUES (2535, 5);
+INSERT INTO items VALUES (2536, 6);
+INSERT INTO items VALUES (2537, 7);
+INSERT INTO items VALUES (2538, 8);
+INSERT INTO items VALUES (2539, 9);
+INSERT INTO items VALUES (2540, 0);
+INSERT INTO items VALUES (2541, 1);
+INSERT INTO items VALUES (2542, 2);
+INSERT INTO items VALUES (2543, 3);
+INSERT INTO items VALUES (2544, 4);
+INSERT INTO items VALUES (2545, 5);
+INSERT INTO items VALUES (2546, 6);
+INSERT INTO items VALUES (2547, 7);
+INSERT INTO items VALUES (2548, 8);
+INSERT INTO items VALUES (2549, 9);
+INSERT INTO items VALUES (2550, 0);
+INSERT INTO items VALUES (2551, 1);
+INSERT INTO items VALUES (2552, 2);
+INSERT INTO items VALUES (2553, 3);
+INSERT INTO items VALUES (2554, 4);
+INSERT INTO items VALUES (2555, 5);
+INSERT INTO items VALUES (2556, 6);
+INSERT INTO items VALUES (2557, 7);
+INSERT INTO items VALUES (2558, 8);
+INSERT INTO items VALUES (2559, 9);
+INSERT INTO items VALUES (2560, 0);
+INSERT INTO items VALUES (2561, 1);
+INSERT INTO items VALUES (2562, 2);
+INSERT INTO items VALUES (2563, 3);
+INSERT INTO items VALUES (2564, 4);
+INSERT INTO items VALUES (2565, 5);
+INSERT INTO items VALUES (2566, 6);
+INSERT INTO items VALUES (2567, 7);
+INSERT INTO items VALUES (2568, 8);
+INSERT INTO items VALUES (2569, 9);
+INSERT INTO items VALUES (2570, 0);
+INSERT INTO items VALUES (2571, 1);
+INSERT INTO items VALUES (2572, 2);
+INSERT INTO items VALUES (2573, 3);
+INSERT INTO items VALUES (2574, 4);
+INSERT INTO items VALUES (2575, 5);
+INSERT INTO items VALUES (2576, 6);
+INSERT INTO items VALUES (2577, 7);
+INSERT INTO items VALUES (2578, 8);
+INSERT INTO items VALUES (2579, 9);
+INSERT INTO items VALUES (2580, 0);
+INSERT INTO items VALUES (2581, 1);
+INSERT INTO items VALUES (2582, 2);
+INSERT INTO items VALUES (2583, 3);
+INSERT INTO items VALUES (2584, 4);
+INSERT INTO items VALUES (2585, 5);
+INSERT INTO items VALUES (2586, 6);
+INSERT INTO items VALUES (2587, 7);
+INSERT INTO items VALUES (2588, 8);
+INSERT INTO items VALUES (2589, 9);
+INSERT INTO items VALUES (2590, 0);
+INSERT INTO items VALUES (2591, 1);
+INSERT INTO items VALUES (2592, 2);
+INSERT INTO items VALUES (2593, 3);
+INSERT INTO items VALUES (2594, 4);
+INSERT INTO items VALUES (2595, 5);
+INSERT INTO items VALUES (2596, 6);
+INSERT INTO items VALUES (2597, 7);
+INSERT INTO items VALUES (2598, 8);
+INSERT INTO items VALUES (2599, 9);
+INSERT INTO items VALUES (2600, 0);
+INSERT INTO items VALUES (2601, 1);
+INSERT INTO items VALUES (2602, 2);
+INSERT INTO items VALUES (2603, 3);
+INSERT INTO items VALUES (2604, 4);
+INSERT INTO items VALUES (2605, 5);
+INSERT INTO items VALUES (2606, 6);
+INSERT INTO items VALUES (2607, 7);
+INSERT INTO items VALUES (2608, 8);
+INSERT INTO items VALUES (2609, 9);
+INSERT INTO items VALUES (2610, 0);
+INSERT INTO items VALUES (2611, 1);
+INSERT INTO items VALUES (2612, 2);
+INSERT INTO items VALUES (2613, 3);
+INSERT INTO items VALUES (2614, 4);
+INSERT INTO items VALUES (2615, 5);
+INSERT INTO items VALUES (2616, 6);
+INSERT INTO items VALUES (2617, 7);
+INSERT INTO items VALUES (2618, 8);
+INSERT INTO items VALUES (2619, 9);
+INSERT INTO items VALUES (2620, 0);
+INSERT INTO items VALUES (2621, 1);
+INSERT INTO items VALUES (2622, 2);
+INSERT INTO items VALUES (2623, 3);
+INSERT INTO items VALUES (2624, 4);
+INSERT INTO items VALUES (2625, 5);
+INSERT INTO items VALUES (2626, 6);
+INSERT INTO items VALUES (2627, 7);
+INSERT INTO items VALUES (2628, 8);
+INSERT INTO items VALUES (2629, 9);
+INSERT INTO items VALUES (2630, 0);
+INSERT INTO items VALUES (2631, 1);
+INSERT INTO items VALUES (2632, 2);
+INSERT INTO items VALUES (2633, 3);
+INSERT INTO items VALUES (2634, 4);
+INSERT INTO items VALUES (2635, 5);
+INSERT INTO items VALUES (2636, 6);
+INSERT INTO items VALUES (2637, 7);
+INSERT INTO items VALUES (2638, 8);
+INSERT INTO items VALUES (2639, 9);
+INSERT INTO items VALUES (2640, 0);
+INSERT INTO items VALUES (2641, 1);
+INSERT INTO items VALUES (2642, 2);
+INSERT INTO items VALUES (2643, 3);
+INSERT INTO items VALUES (2644, 4);
+INSERT INTO items VALUES (2645, 5);
+INSERT INTO items VALUES (2646, 6);
+INSERT INTO items VALUES (2647, 7);
+INSERT INTO items VALUES (2648, 8);
+INSERT INTO items VALUES (2649, 9);
+INSERT INTO items VALUES (2650, 0);
+INSERT INTO items VALUES (2651, 1);
+INSERT INTO items VALUES (2652, 2);
+INSERT INTO items VALUES (2653, 3);
+INSERT INTO items VALUES (2654, 4);
+INSERT INTO items VALUES (2655, 5);
+INSERT INTO items VALUES (2656, 6);
+INSERT INTO items VALUES (2657, 7);
+INSERT INTO items VALUES (2658, 8);
+INSERT INTO items VALUES (2659, 9);
+INSERT INTO items VALUES (2660, 0);
+INSERT INTO items VALUES (2661, 1);
+INSERT INTO items VALUES (2662, 2);
+INSERT INTO items VALUES (2663, 3);
+INSERT INTO items VALUES (2664, 4);
+INSERT INTO items VALUES (2665, 5);
+INSERT INTO items VALUES (2666, 6);
+INSERT INTO items VALUES (2667, 7);
+INSERT INTO items VALUES (2668, 8);
+INSERT INTO items VALUES (2669, 9);
+INSERT INTO items VALUES (2670, 0);
+INSERT INTO items VALUES (2671, 1);
+INSERT INTO items VALUES (2672, 2);
+INSERT INTO items VALUES (2673, 3);
+INSERT INTO items VALUES (2674, 4);
+INSERT INTO items VALUES (2675, 5);
+INSERT INTO items VALUES (2676, 6);
+INSERT INTO items VALUES (2677, 7);
+INSERT INTO items VALUES (2678, 8);
+INSERT INTO items VALUES (2679, 9);
+INSERT INTO items VALUES (2680, 0);
+INSERT INTO items VALUES (2681, 1);
+INSERT INTO items VALUES (2682, 2);
+INSERT INTO items VALUES (2683, 3);
+INSERT INTO items VALUES (2684, 4);
+INSERT INTO items VALUES (2685, 5);
+INSERT INTO items VALUES (2686, 6);
+INSERT INTO items VALUES (2687, 7);
+INSERT INTO items VALUES (2688, 8);
+INSERT INTO items VALUES (2689, 9);
+INSERT INTO items VALUES (2690, 0);
+INSERT INTO items VALUES (2691, 1);
+INSERT INTO items VALUES (2692, 2);
+INSERT INTO items VALUES (2693, 3);
+INSERT INTO items VALUES (2694, 4);
+INSERT INTO items VALUES (2695, 5);
+INSERT INTO items VALUES (2696, 6);
+INSERT INTO items VALUES (2697, 7);
+INSERT INTO items VALUES (2698, 8);
+INSERT INTO items VALUES (2699, 9);
+INSERT INTO items VALUES (2700, 0);
+INSERT INTO items VALUES (2701, 1);
+INSERT INTO items VALUES (2702, 2);
+INSERT INTO items VALUES (2703, 3);
+INSERT INTO items VALUES (2704, 4);
+INSERT INTO items VALUES (2705, 5);
+INSERT INTO items VALUES (2706, 6);
+INSERT INTO items VALUES (2707, 7);
+INSERT INTO items VALUES (2708, 8);
+INSERT INTO items VALUES (2709, 9);
+INSERT INTO items VALUES (2710, 0);
+INSERT INTO items VALUES (2711, 1);
+INSERT INTO items VALUES (2712, 2);
+INSERT INTO items VALUES (2713, 3);
+INSERT INTO items VALUES (2714, 4);
+INSERT INTO items VALUES (2715, 5);
+INSERT INTO items VALUES (2716, 6);
+INSERT INTO items VALUES (2717, 7);
+INSERT INTO items VALUES (2718, 8);
+INSERT INTO items VALUES (2719, 9);
+INSERT INTO items VALUES (2720, 0);
+INSERT INTO items VALUES (2721, 1);
+INSERT INTO items VALUES (2722, 2);
+INSERT INTO items VALUES (2723, 3);
+INSERT INTO items VALUES (2724, 4);
+INSERT INTO items VALUES (2725, 5);
+INSERT INTO items VALUES (2726, 6);
+INSERT INTO items VALUES (2727, 7);
+INSERT INTO items VALUES (2728, 8);
+INSERT INTO items VALUES (2729, 9);
+INSERT INTO items VALUES (2730, 0);
+INSERT INTO items VALUES (2731, 1);
+INSERT INTO items VALUES (2732, 2);
+INSERT INTO items VALUES (2733, 3);
+INSERT INTO items VALUES (2734, 4);
+INSERT INTO items VALUES (2735, 5);
+INSERT INTO items VALUES (2736, 6);
+INSERT INTO items VALUES (2737, 7);
+INSERT INTO items VALUES (2738, 8);
+INSERT INTO items VALUES (2739, 9);
+INSERT INTO items VALUES (2740, 0);
+INSERT INTO items VALUES (2741, 1);
+INSERT INTO items VALUES (2742, 2);
+INSERT INTO items VALUES (2743, 3);
+INSERT INTO items VALUES (2744, 4);
+INSERT INTO items VALUES (2745, 5);
+INSERT INTO items VALUES (2746, 6);
+INSERT INTO items VALUES (2747, 7);
+INSERT INTO items VALUES (2748, 8);
+INSERT INTO items VALUES (2749, 9);
+INSERT INTO items VALUES (2750, 0);
+INSERT INTO items VALUES (2751, 1);
+INSERT INTO items VALUES (2752, 2);
+INSERT INTO items VALUES (2753, 3);
+INSERT INTO items VALUES (2754, 4);
+INSERT INTO items VALUES (2755, 5);
+INSERT INTO items VALUES (2756, 6);
+INSERT INTO items VALUES (2757, 7);
+INSERT INTO items VALUES (2758, 8);
+INSERT INTO items VALUES (2759, 9);
+INSERT INTO items VALUES (2760, 0);
+INSERT INTO items VALUES (2761, 1);
+INSERT INTO items VALUES (2762, 2);
+INSERT INTO items VALUES (2763, 3);
+INSERT INTO items VALUES (2764, 4);
+INSERT INTO items VALUES (2765, 5);
+INSERT INTO items VALUES (2766, 6);
+INSERT INTO items VALUES (2767, 7);
+INSERT INTO items VALUES (2768, 8);
+INSERT INTO items VALUES (2769, 9);
+INSERT INTO items VALUES (2770, 0);
+INSERT INTO items VALUES (2771, 1);
+INSERT INTO items VALUES (2772, 2);
+INSERT INTO items VALUES (2773, 3);
+INSERT INTO items VALUES (2774, 4);
+INSERT INTO items VALUES (2775, 5);
+INSERT INTO items VALUES (2776, 6);
+INSERT INTO items VALUES (2777, 7);
+INSERT INTO items VALUES (2778, 8);
+INSERT INTO items VALUES (2779, 9);
+INSERT INTO items VALUES (2780, 0);
+INSERT INTO items VALUES (2781, 1);
+INSERT INTO items VALUES (2782, 2);
+INSERT INTO items VALUES (2783, 3);
+INSERT INTO items VALUES (2784, 4);
+INSERT INTO items VALUES (2785, 5);
+INSERT INTO items VALUES (2786, 6);
+INSERT INTO items VALUES (2787, 7);
+INSERT INTO items VALUES (2788, 8);
+INSERT INTO items VALUES (2789, 9);
+INSERT INTO items VALUES (2790, 0);
+INSERT INTO items VALUES (2791, 1);
+INSERT INTO items VALUES (2792, 2);
+INSERT INTO items VALUES (2793, 3);
+INSERT INTO items VALUES (2794, 4);
+INSERT INTO items VALUES (2795, 5);
+INSERT INTO items VALUES (2796, 6);
+INSERT INTO items VALUES (2797, 7);
+INSERT INTO items VALUES (2798, 8);
+INSERT INTO items VALUES (2799, 9);
+INSERT INTO items VALUES (2800, 0);
+INSERT INTO items VALUES (2801, 1);
+INSERT INTO items VALUES (2802, 2);
+INSERT INTO items VALUES (2803, 3);
+INSERT INTO items VALUES (2804, 4);
+INSERT INTO items VALUES (2805, 5);
+INSERT INTO items VALUES (2806, 6);
+INSERT INTO items VALUES (2807, 7);
+INSERT INTO items VALUES (2808, 8);
+INSERT INTO items VALUES (2809, 9);
+INSERT INTO items VALUES (2810, 0);
+INSERT INTO items VALUES (2811, 1);
+INSERT INTO items VALUES (2812, 2);
+INSERT INTO items VALUES (2813, 3);
+INSERT INTO items VALUES (2814, 4);
+INSERT INTO items VALUES (2815, 5);
+INSERT INTO items VALUES (2816, 6);
+INSERT INTO items VALUES (2817, 7);
+INSERT INTO items VALUES (2818, 8);
+INSERT INTO items VALUES (2819, 9);
+INSERT INTO items VALUES (2820, 0);
+INSERT INTO items VALUES (2821, 1);
+INSERT INTO items VALUES (2822, 2);
+INSERT INTO items VALUES (2823, 3);
+INSERT INTO items VALUES (2824, 4);
+INSERT INTO items VALUES (2825, 5);
+INSERT INTO items VALUES (2826, 6);
+INSERT INTO items VALUES (2827, 7);
+INSERT INTO items VALUES (2828, 8);
+INSERT INTO items VALUES (2829, 9);
+INSERT INTO items VALUES (2830, 0);
+INSERT INTO items VALUES (2831, 1);
+INSERT INTO items VALUES (2832, 2);
+INSERT INTO items VALUES (2833, 3);
+INSERT INTO items VALUES (2834, 4);
+INSERT INTO items VALUES (2835, 5);
+INSERT INTO items VALUES (2836, 6);
+INSERT INTO items VALUES (2837, 7);
+INSERT INTO items VALUES (2838, 8);
+INSERT INTO items VALUES (2839, 9);
+INSERT INTO items VALUES (2840, 0);
+INSERT INTO items VALUES (2841, 1);
+INSERT INTO items VALUES (2842, 2);
+INSERT INTO items VALUES (2843, 3);
+INSERT INTO items VALUES (2844, 4);
+INSERT INTO items VALUES (2845, 5);
+INSERT INTO items VALUES (2846, 6);
+INSERT INTO items VALUES (2847, 7);
+INSERT INTO items VALUES (2848, 8);
+INSERT INTO items VALUES (2849, 9);
+INSERT INTO items VALUES (2850, 0);
+INSERT INTO items VALUES (2851, 1);
+INSERT INTO items VALUES (2852, 2);
+INSERT INTO items VALUES (2853, 3);
+INSERT INTO items VALUES (2854, 4);
+INSERT INTO items VALUES (2855, 5);
+INSERT INTO items VALUES (2856, 6);
+INSERT INTO items VALUES (2857, 7);
+INSERT INTO items VALUES (2858, 8);
+INSERT INTO items VALUES (2859, 9);
+INSERT INTO items VALUES (2860, 0);
+INSERT INTO items VALUES (2861, 1);
+INSERT INTO items VALUES (2862, 2);
+INSERT INTO items VALUES (2863, 3);
+INSERT INTO items VALUES (2864, 4);
+INSERT INTO items VALUES (2865, 5);
+INSERT INTO items VALUES (2866, 6);
+INSERT INTO items VALUES (2867, 7);
+INSERT INTO items VALUES (2868, 8);
+INSERT INTO items VALUES (2869, 9);
+INSERT INTO items VALUES (2870, 0);
+INSERT INTO items VALUES (2871, 1);
+INSERT INTO items VALUES (2872, 2);
+INSERT INTO items VALUES (2873, 3);
+INSERT INTO items VALUES (2874, 4);
+INSERT INTO items VALUES (2875, 5);
+INSERT INTO items VALUES (2876, 6);
+INSERT INTO items VALUES (2877, 7);
+INSERT INTO items VALUES (2878, 8);
+INSERT INTO items VALUES (2879, 9);
+INSERT INTO items VALUES (2880, 0);
+INSERT INTO items VALUES (2881, 1);
+INSERT INTO items VALUES (2882, 2);
+INSERT INTO items VALUES (2883, 3);
+INSERT INTO items VALUES (2884, 4);
+INSERT INTO items VALUES (2885, 5);
+INSERT INTO items VALUES (2886, 6);
+INSERT INTO items VALUES (2887, 7);
+INSERT INTO items VALUES (2888, 8);
+INSERT INTO items VALUES (2889, 9);
+INSERT INTO items VALUES (2890, 0);
+INSERT INTO items VALUES (2891, 1);
+INSERT INTO items VALUES (2892, 2);
+INSERT INTO items VALUES (2893, 3);
+INSERT INTO items VALUES (2894, 4);
+INSERT INTO items VALUES (2895, 5);
+INSERT INTO items VALUES (2896, 6);
+INSERT INTO items VALUES (2897, 7);
+INSERT INTO items VALUES (2898, 8);
+INSERT INTO items VALUES (2899, 9);
+INSERT INTO items VALUES (2900, 0);
+INSERT INTO items VALUES (2901, 1);
+INSERT INTO items VALUES (2902, 2);
+INSERT INTO items VALUES (2903, 3);
+INSERT INTO items VALUES (2904, 4);
+INSERT INTO items VALUES (2905, 5);
+INSERT INTO items VALUES (2906, 6);
+INSERT INTO items VALUES (2907, 7);
+INSERT INTO items VALUES (2908, 8);
+INSERT INTO items VALUES (2909, 9);
+INSERT INTO items VALUES (2910, 0);
+INSERT INTO items VALUES (2911, 1);
+INSERT INTO items VALUES (2912, 2);
+INSERT INTO items VALUES (2913, 3);
+INSERT INTO items VALUES (2914, 4);
+INSERT INTO items VALUES (2915, 5);
+INSERT INTO items VALUES (2916, 6);
+INSERT INTO items VALUES (2917, 7);
+INSERT INTO items VALUES (2918, 8);
+INSERT INTO items VALUES (2919, 9);
+INSERT INTO items VALUES (2920, 0);
+INSERT INTO items VALUES (2921, 1);
+INSERT INTO items VALUES (2922, 2);
+INSERT INTO items VALUES (2923, 3);
+INSERT INTO items VALUES (2924, 4);
+INSERT INTO items VALUES (2925, 5);
+INSERT INTO items VALUES (2926, 6);
+INSERT INTO items VALUES (2927, 7);
+INSERT INTO items VALUES (2928, 8);
+INSERT INTO items VALUES (2929, 9);
+INSERT INTO items VALUES (2930, 0);
+INSERT INTO items VALUES (2931, 1);
+INSERT INTO items VALUES (2932, 2);
+INSERT INTO items VALUES (2933, 3);
+INSERT INTO items VALUES (2934, 4);
+INSERT INTO items VALUES (2935, 5);
+INSERT INTO items VALUES (2936, 6);
+INSERT INTO items VALUES (2937, 7);
+INSERT INTO items VALUES (2938, 8);
+INSERT INTO items VALUES (2939, 9);
+INSERT INTO items VALUES (2940, 0);
+INSERT INTO items VALUES (2941, 1);
+INSERT INTO items VALUES (2942, 2);
+INSERT INTO items VALUES (2943, 3);
+INSERT INTO items VALUES (2944, 4);
+INSERT INTO items VALUES (2945, 5);
+INSERT INTO items VALUES (2946, 6);
+INSERT INTO items VALUES (2947, 7);
+INSERT INTO items VALUES (2948, 8);
+INSERT INTO items VALUES (2949, 9);
+INSERT INTO items VALUES (2950, 0);
+INSERT INTO items VALUES (2951, 1);
+INSERT INTO items VALUES (2952, 2);
+INSERT INTO items VALUES (2953, 3);
+INSERT INTO items VALUES (2954, 4);
+INSERT INTO items VALUES (2955, 5);
+INSERT INTO items VALUES (2956, 6);
+INSERT INTO items VALUES (2957, 7);
+INSERT INTO items VALUES (2958, 8);
+INSERT INTO items VALUES (2959, 9);
+INSERT INTO items VALUES (2960, 0);
+INSERT INTO items VALUES (2961, 1);
+INSERT INTO items VALUES (2962, 2);
+INSERT INTO items VALUES (2963, 3);
+INSERT INTO items VALUES (2964, 4);
+INSERT INTO items VALUES (2965, 5);
+INSERT INTO items VALUES (2966, 6);
+INSERT INTO items VALUES (2967, 7);
+INSERT INTO items VALUES (2968, 8);
+INSERT INTO items VALUES (2969, 9);
+INSERT INTO items VALUES (2970, 0);
+INSERT INTO items VALUES (2971, 1);
+INSERT INTO items VALUES (2972, 2);
+INSERT INTO items VALUES (2973, 3);
+INSERT INTO items VALUES (2974, 4);
+INSERT INTO items VALUES (2975, 5);
+INSERT INTO items VALUES (2976, 6);
+INSERT INTO items VALUES (2977, 7);
+INSERT INTO items VALUES (2978, 8);
+INSERT INTO items VALUES (2979, 9);
+INSERT INTO items VALUES (2980, 0);
+INSERT INTO items VALUES (2981, 1);
+INSERT INTO items VALUES (2982, 2);
+INSERT INTO items VALUES (2983, 3);
+INSERT INTO items VALUES (2984, 4);
+INSERT INTO items VALUES (2985, 5);
+INSERT INTO items VALUES (2986, 6);
+INSERT INTO items VALUES (2987, 7);
+INSERT INTO items VALUES (2988, 8);
+INSERT INTO items VALUES (2989, 9);
+INSERT INTO items VALUES (2990, 0);
+INSERT INTO items VALUES (2991, 1);
+INSERT INTO items VALUES (2992, 2);
+INSERT INTO items VALUES (2993, 3);
+INSERT INTO items VALUES (2994, 4);
+INSERT INTO items VALUES (2995, 5);
+INSERT INTO items VALUES (2996, 6);
+INSERT INTO items VALUES (2997, 7);
+INSERT INTO items VALUES (2998, 8);
+INSERT INTO items VALUES (2999, 9);
+INSERT INTO tags VALUES (0, 0);
+INSERT INTO tags VALUES (1, 0);
+INSERT INTO tags VALUES (2, 0);
+INSERT INTO notes VALUES (0, 0);
+INSERT INTO notes VALUES (1, 0);
+INSERT INTO notes VALUES (2, 0);
@@ -0,0 +1,161 @@
+USE DATABASE shop;
+SELECT id FROM items WHERE grp = 3 AND id < 40;
+UPDATE tags SET n = n + 100;
+UPDATE notes SET n = n + 100;
+SELECT id FROM items WHERE grp = 8 AND id < 40;
+SELECT id FROM items WHERE grp = 4 AND id < 40;
+UPDATE tags SET n = n + 100;
+UPDATE notes SET n = n + 100;
+SELECT id FROM items WHERE grp = 9 AND id < 40;
+SELECT id FROM items WHERE grp = 5 AND id < 40;
+UPDATE tags SET n = n + 100;
+UPDATE notes SET n = n + 100;
+SELECT id FROM items WHERE grp = 0 AND id < 40;
+SELECT id FROM items WHERE grp = 6 AND id < 40;
+UPDATE tags SET n = n + 100;
+UPDATE notes SET n = n + 100;
+SELECT id FROM items WHERE grp = 1 AND id < 40;
+SELECT id FROM items WHERE grp = 7 AND id < 40;
+UPDATE tags SET n = n + 100;
+UPDATE notes SET n = n + 100;
+SELECT id FROM items WHERE grp = 2 AND id < 40;
+SELECT id FROM items WHERE grp = 8 AND id < 40;
+UPDATE tags SET n = n + 100;
+UPDATE notes SET n = n + 100;
+SELECT id FROM items WHERE grp = 3 AND id < 40;
+SELECT id FROM items WHERE grp = 9 AND id < 40;
+UPDATE tags SET n = n + 100;
+UPDATE notes SET n = n + 100;
+SELECT id FROM items WHERE grp = 4 AND id < 40;
+SELECT id FROM items WHERE grp = 0 AND id < 40;
+UPDATE tags SET n = n + 100;
+UPDATE notes SET n = n + 100;
+SELECT id FROM items WHERE grp = 5 AND id < 40;
+SELECT id FROM items WHERE grp = 1 AND id < 40;
+UPDATE tags SET n = n + 100;
+UPDATE notes SET n = n + 100;
+SELECT id FROM items WHERE grp = 6 AND id < 40;
+SELECT id FROM items WHERE grp = 2 AND id < 40;
+UPDATE tags SET n = n + 100;
+UPDATE notes SET n = n + 100;
+SELECT id FROM items WHERE grp = 7 AND id < 40;
+SELECT id FROM items WHERE grp = 3 AND id < 40;
+UPDATE tags SET n = n + 100;
+UPDATE notes SET n = n + 100;
+SELECT id FROM items WHERE grp = 8 AND id < 40;
+SELECT id FROM items WHERE grp = 4 AND id < 40;
+UPDATE tags SET n = n + 100;
+UPDATE notes SET n = n + 100;
+SELECT id FROM items WHERE grp = 9 AND id < 40;
+SELECT id FROM items WHERE grp = 5 AND id < 40;
+UPDATE tags SET n = n + 100;
+UPDATE notes SET n = n + 100;
+SELECT id FROM items WHERE grp = 0 AND id < 40;
+SELECT id FROM items WHERE grp = 6 AND id < 40;
+UPDATE tags SET n = n + 100;
+UPDATE notes SET n = n + 100;
+SELECT id FROM items WHERE grp = 1 AND id < 40;
+SELECT id FROM items WHERE grp = 7 AND id < 40;
+UPDATE tags SET n = n + 100;
+UPDATE notes SET n = n + 100;
+SELECT id FROM items WHERE grp = 2 AND id < 40;
+SELECT id FROM items WHERE grp = 8 AND id < 40;
+UPDATE tags SET n = n + 100;
+UPDATE notes SET n = n + 100;
+SELECT id FROM items WHERE grp = 3 AND id < 40;
+SELECT id FROM items WHERE grp = 9 AND id < 40;
+UPDATE tags SET n = n + 100;
+UPDATE notes SET n = n + 100;
+SELECT id FROM items WHERE grp = 4 AND id < 40;
+SELECT id FROM items WHERE grp = 0 AND id < 40;
+UPDATE tags SET n = n + 100;
+UPDATE notes SET n = n + 100;
+SELECT id FROM items WHERE grp = 5 AND id < 40;
+SELECT id FROM items WHERE grp = 1 AND id < 40;
+UPDATE tags SET n = n + 100;
+UPDATE notes SET n = n + 100;
+SELECT id FROM items WHERE grp = 6 AND id < 40;
+SELECT id FROM items WHERE grp = 2 AND id < 40;
+UPDATE tags SET n = n + 100;
+UPDATE notes SET n = n + 100;
+SELECT id FROM items WHERE grp = 7 AND id < 40;
+SELECT id FROM items WHERE grp = 3 AND id < 40;
+UPDATE tags SET n = n + 100;
+UPDATE notes SET n = n + 100;
+SELECT id FROM items WHERE grp = 8 AND id < 40;
+SELECT id FROM items WHERE grp = 4 AND id < 40;
+UPDATE tags SET n = n + 100;
+UPDATE notes SET n = n + 100;
+SELECT id FROM items WHERE grp = 9 AND id < 40;
+SELECT id FROM items WHERE grp = 5 AND id < 40;
+UPDATE tags SET n = n + 100;
+UPDATE notes SET n = n + 100;
+SELECT id FROM items WHERE grp = 0 AND id < 40;
+SELECT id FROM items WHERE grp = 6 AND id < 40;
+UPDATE tags SET n = n + 100;
+UPDATE notes SET n = n + 100;
+SELECT id FROM items WHERE grp = 1 AND id < 40;
+SELECT id FROM items WHERE grp = 7 AND id < 40;
+UPDATE tags SET n = n + 100;
+UPDATE notes SET n = n + 100;
+SELECT id FROM items WHERE grp = 2 AND id < 40;
+SELECT id FROM items WHERE grp = 8 AND id < 40;
+UPDATE tags SET n = n + 100;
+UPDATE notes SET n = n + 100;
+SELECT id FROM items WHERE grp = 3 AND id < 40;
+SELECT id FROM items WHERE grp = 9 AND id < 40;
+UPDATE tags SET n = n + 100;
+UPDATE notes SET n = n + 100;
+SELECT id FROM items WHERE grp = 4 AND id < 40;
+SELECT id FROM items WHERE grp = 0 AND id < 40;
+UPDATE tags SET n = n + 100;
+UPDATE notes SET n = n + 100;
+SELECT id FROM items WHERE grp = 5 AND id < 40;
+SELECT id FROM items WHERE grp = 1 AND id < 40;
+UPDATE tags SET n = n + 100;
+UPDATE notes SET n = n + 100;
+SELECT id FROM items WHERE grp = 6 AND id < 40;
+SELECT id FROM items WHERE grp = 2 AND id < 40;
+UPDATE tags SET n = n + 100;
+UPDATE notes SET n = n + 100;
+SELECT id FROM items WHERE grp = 7 AND id < 40;
+SELECT id FROM items WHERE grp = 3 AND id < 40;
+UPDATE tags SET n = n + 100;
+UPDATE notes SET n = n + 100;
+SELECT id FROM items WHERE grp = 8 AND id < 40;
+SELECT id FROM items WHERE grp = 4 AND id < 40;
+UPDATE tags SET n = n + 100;
+UPDATE notes SET n = n + 100;
+SELECT id FROM items WHERE grp = 9 AND id < 40;
+SELECT id FROM items WHERE grp = 5 AND id < 40;
+UPDATE tags SET n = n + 100;
+UPDATE notes SET n = n + 100;
+SELECT id FROM items WHERE grp = 0 AND id < 40;
+SELECT id FROM items WHERE grp = 6 AND id < 40;
+UPDATE tags SET n = n + 100;
+UPDATE notes SET n = n + 100;
+SELECT id FROM items WHERE grp = 1 AND id < 40;
+SELECT id FROM items WHERE grp = 7 AND id < 40;
+UPDATE tags SET n = n + 100;
+UPDATE notes SET n = n + 100;
+SELECT id FROM items WHERE grp = 2 AND id < 40;
+SELECT id FROM items WHERE grp = 8 AND id < 40;
+UPDATE tags SET n = n + 100;
+UPDATE notes SET n = n + 100;
+SELECT id FROM items WHERE grp = 3 AND id < 40;
+SELECT id FROM items WHERE grp = 9 AND id < 40;
+UPDATE tags SET n = n + 100;
+UPDATE notes SET n = n + 100;
+SELECT id FROM items WHERE grp = 4 AND id < 40;
+SELECT id FROM items WHERE grp = 0 AND id < 40;
+UPDATE tags SET n = n + 100;
+UPDATE notes SET n = n + 100;
+SELECT id FROM items WHERE grp = 5 AND id < 40;
+SELECT id FROM items WHERE grp = 1 AND id < 40;
+UPDATE tags SET n = n + 100;
+UPDATE notes SET n = n + 100;
+SELECT id FROM items WHERE grp = 6 AND id < 40;
+SELECT id FROM items WHERE grp = 2 AND id < 40;
+UPDATE tags SET n = n + 100;
+UPDATE notes SET n = n + 100;
+SELECT id FROM items WHERE grp = 7 AND id < 40;
@@ -0,0 +1,3 @@
+USE DATABASE shop;
+SELECT * FROM tags;
+SELECT * FROM notes;
@@ -0,0 +1,12 @@
+CREATE DATABASE counts;
+USE DATABASE counts;
+CREATE TABLE counters (id INTEGER, n INTEGER);
+INSERT INTO counters VALUES (0, 0);
+INSERT INTO counters VALUES (1, 0);
+INSERT INTO counters VALUES (2, 0);
+INSERT INTO counters VALUES (3, 0);
+INSERT INTO counters VALUES (4, 0);
+CREATE TABLE events (client INTEGER, seq INTEGER);
+CREATE DATABASE other;
+USE DATABASE other;
+CREATE TABLE hits (client INTEGER, seq INTEGER);
@@ -0,0 +1,134 @@
+USE DATABASE counts;
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 1;
+INSERT INTO events VALUES (1, 0);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 1;
+INSERT INTO events VALUES (1, 1);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 1;
+INSERT INTO events VALUES (1, 2);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 1;
+INSERT INTO events VALUES (1, 3);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 1;
+INSERT INTO events VALUES (1, 4);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 1;
+INSERT INTO events VALUES (1, 5);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 1;
+INSERT INTO events VALUES (1, 6);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 1;
+INSERT INTO events VALUES (1, 7);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 1;
+INSERT INTO events VALUES (1, 8);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 1;
+INSERT INTO events VALUES (1, 9);
+USE DATABASE other;
+INSERT INTO hits VALUES (1, 9);
+USE DATABASE counts;
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 1;
+INSERT INTO events VALUES (1, 10);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 1;
+INSERT INTO events VALUES (1, 11);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 1;
+INSERT INTO events VALUES (1, 12);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 1;
+INSERT INTO events VALUES (1, 13);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 1;
+INSERT INTO events VALUES (1, 14);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 1;
+INSERT INTO events VALUES (1, 15);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 1;
+INSERT INTO events VALUES (1, 16);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 1;
+INSERT INTO events VALUES (1, 17);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 1;
+INSERT INTO events VALUES (1, 18);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 1;
+INSERT INTO events VALUES (1, 19);
+USE DATABASE other;
+INSERT INTO hits VALUES (1, 19);
+USE DATABASE counts;
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 1;
+INSERT INTO events VALUES (1, 20);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 1;
+INSERT INTO events VALUES (1, 21);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 1;
+INSERT INTO events VALUES (1, 22);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 1;
+INSERT INTO events VALUES (1, 23);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 1;
+INSERT INTO events VALUES (1, 24);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 1;
+INSERT INTO events VALUES (1, 25);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 1;
+INSERT INTO events VALUES (1, 26);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 1;
+INSERT INTO events VALUES (1, 27);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 1;
+INSERT INTO events VALUES (1, 28);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 1;
+INSERT INTO events VALUES (1, 29);
+USE DATABASE other;
+INSERT INTO hits VALUES (1, 29);
+USE DATABASE counts;
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 1;
+INSERT INTO events VALUES (1, 30);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 1;
+INSERT INTO events VALUES (1, 31);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 1;
+INSERT INTO events VALUES (1, 32);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 1;
+INSERT INTO events VALUES (1, 33);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 1;
+INSERT INTO events VALUES (1, 34);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 1;
+INSERT INTO events VALUES (1, 35);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 1;
+INSERT INTO events VALUES (1, 36);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 1;
+INSERT INTO events VALUES (1, 37);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 1;
+INSERT INTO events VALUES (1, 38);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 1;
+INSERT INTO events VALUES (1, 39);
+USE DATABASE other;
+INSERT INTO hits VALUES (1, 39);
+USE DATABASE counts;
+SELECT seq FROM events WHERE client = 1 AND seq > 36;
@@ -0,0 +1,134 @@
+USE DATABASE counts;
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 2;
+INSERT INTO events VALUES (2, 0);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 2;
+INSERT INTO events VALUES (2, 1);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 2;
+INSERT INTO events VALUES (2, 2);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 2;
+INSERT INTO events VALUES (2, 3);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 2;
+INSERT INTO events VALUES (2, 4);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 2;
+INSERT INTO events VALUES (2, 5);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 2;
+INSERT INTO events VALUES (2, 6);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 2;
+INSERT INTO events VALUES (2, 7);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 2;
+INSERT INTO events VALUES (2, 8);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 2;
+INSERT INTO events VALUES (2, 9);
+USE DATABASE other;
+INSERT INTO hits VALUES (2, 9);
+USE DATABASE counts;
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 2;
+INSERT INTO events VALUES (2, 10);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 2;
+INSERT INTO events VALUES (2, 11);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 2;
+INSERT INTO events VALUES (2, 12);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 2;
+INSERT INTO events VALUES (2, 13);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 2;
+INSERT INTO events VALUES (2, 14);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 2;
+INSERT INTO events VALUES (2, 15);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 2;
+INSERT INTO events VALUES (2, 16);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 2;
+INSERT INTO events VALUES (2, 17);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 2;
+INSERT INTO events VALUES (2, 18);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 2;
+INSERT INTO events VALUES (2, 19);
+USE DATABASE other;
+INSERT INTO hits VALUES (2, 19);
+USE DATABASE counts;
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 2;
+INSERT INTO events VALUES (2, 20);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 2;
+INSERT INTO events VALUES (2, 21);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 2;
+INSERT INTO events VALUES (2, 22);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 2;
+INSERT INTO events VALUES (2, 23);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 2;
+INSERT INTO events VALUES (2, 24);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 2;
+INSERT INTO events VALUES (2, 25);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 2;
+INSERT INTO events VALUES (2, 26);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 2;
+INSERT INTO events VALUES (2, 27);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 2;
+INSERT INTO events VALUES (2, 28);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 2;
+INSERT INTO events VALUES (2, 29);
+USE DATABASE other;
+INSERT INTO hits VALUES (2, 29);
+USE DATABASE counts;
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 2;
+INSERT INTO events VALUES (2, 30);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 2;
+INSERT INTO events VALUES (2, 31);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 2;
+INSERT INTO events VALUES (2, 32);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 2;
+INSERT INTO events VALUES (2, 33);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 2;
+INSERT INTO events VALUES (2, 34);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 2;
+INSERT INTO events VALUES (2, 35);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 2;
+INSERT INTO events VALUES (2, 36);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 2;
+INSERT INTO events VALUES (2, 37);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 2;
+INSERT INTO events VALUES (2, 38);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 2;
+INSERT INTO events VALUES (2, 39);
+USE DATABASE other;
+INSERT INTO hits VALUES (2, 39);
+USE DATABASE counts;
+SELECT seq FROM events WHERE client = 2 AND seq > 36;
@@ -0,0 +1,134 @@
+USE DATABASE counts;
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 3;
+INSERT INTO events VALUES (3, 0);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 3;
+INSERT INTO events VALUES (3, 1);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 3;
+INSERT INTO events VALUES (3, 2);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 3;
+INSERT INTO events VALUES (3, 3);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 3;
+INSERT INTO events VALUES (3, 4);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 3;
+INSERT INTO events VALUES (3, 5);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 3;
+INSERT INTO events VALUES (3, 6);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 3;
+INSERT INTO events VALUES (3, 7);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 3;
+INSERT INTO events VALUES (3, 8);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 3;
+INSERT INTO events VALUES (3, 9);
+USE DATABASE other;
+INSERT INTO hits VALUES (3, 9);
+USE DATABASE counts;
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 3;
+INSERT INTO events VALUES (3, 10);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 3;
+INSERT INTO events VALUES (3, 11);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 3;
+INSERT INTO events VALUES (3, 12);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 3;
+INSERT INTO events VALUES (3, 13);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 3;
+INSERT INTO events VALUES (3, 14);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 3;
+INSERT INTO events VALUES (3, 15);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 3;
+INSERT INTO events VALUES (3, 16);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 3;
+INSERT INTO events VALUES (3, 17);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 3;
+INSERT INTO events VALUES (3, 18);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 3;
+INSERT INTO events VALUES (3, 19);
+USE DATABASE other;
+INSERT INTO hits VALUES (3, 19);
+USE DATABASE counts;
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 3;
+INSERT INTO events VALUES (3, 20);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 3;
+INSERT INTO events VALUES (3, 21);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 3;
+INSERT INTO events VALUES (3, 22);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 3;
+INSERT INTO events VALUES (3, 23);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 3;
+INSERT INTO events VALUES (3, 24);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 3;
+INSERT INTO events VALUES (3, 25);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 3;
+INSERT INTO events VALUES (3, 26);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 3;
+INSERT INTO events VALUES (3, 27);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 3;
+INSERT INTO events VALUES (3, 28);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 3;
+INSERT INTO events VALUES (3, 29);
+USE DATABASE other;
+INSERT INTO hits VALUES (3, 29);
+USE DATABASE counts;
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 3;
+INSERT INTO events VALUES (3, 30);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 3;
+INSERT INTO events VALUES (3, 31);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 3;
+INSERT INTO events VALUES (3, 32);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 3;
+INSERT INTO events VALUES (3, 33);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 3;
+INSERT INTO events VALUES (3, 34);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 3;
+INSERT INTO events VALUES (3, 35);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 3;
+INSERT INTO events VALUES (3, 36);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 3;
+INSERT INTO events VALUES (3, 37);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 3;
+INSERT INTO events VALUES (3, 38);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 3;
+INSERT INTO events VALUES (3, 39);
+USE DATABASE other;
+INSERT INTO hits VALUES (3, 39);
+USE DATABASE counts;
+SELECT seq FROM events WHERE client = 3 AND seq > 36;
@@ -0,0 +1,134 @@
+USE DATABASE counts;
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 4;
+INSERT INTO events VALUES (4, 0);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 4;
+INSERT INTO events VALUES (4, 1);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 4;
+INSERT INTO events VALUES (4, 2);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 4;
+INSERT INTO events VALUES (4, 3);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 4;
+INSERT INTO events VALUES (4, 4);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 4;
+INSERT INTO events VALUES (4, 5);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 4;
+INSERT INTO events VALUES (4, 6);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 4;
+INSERT INTO events VALUES (4, 7);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 4;
+INSERT INTO events VALUES (4, 8);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 4;
+INSERT INTO events VALUES (4, 9);
+USE DATABASE other;
+INSERT INTO hits VALUES (4, 9);
+USE DATABASE counts;
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 4;
+INSERT INTO events VALUES (4, 10);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 4;
+INSERT INTO events VALUES (4, 11);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 4;
+INSERT INTO events VALUES (4, 12);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 4;
+INSERT INTO events VALUES (4, 13);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 4;
+INSERT INTO events VALUES (4, 14);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 4;
+INSERT INTO events VALUES (4, 15);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 4;
+INSERT INTO events VALUES (4, 16);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 4;
+INSERT INTO events VALUES (4, 17);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 4;
+INSERT INTO events VALUES (4, 18);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 4;
+INSERT INTO events VALUES (4, 19);
+USE DATABASE other;
+INSERT INTO hits VALUES (4, 19);
+USE DATABASE counts;
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 4;
+INSERT INTO events VALUES (4, 20);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 4;
+INSERT INTO events VALUES (4, 21);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 4;
+INSERT INTO events VALUES (4, 22);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 4;
+INSERT INTO events VALUES (4, 23);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 4;
+INSERT INTO events VALUES (4, 24);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 4;
+INSERT INTO events VALUES (4, 25);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 4;
+INSERT INTO events VALUES (4, 26);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 4;
+INSERT INTO events VALUES (4, 27);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 4;
+INSERT INTO events VALUES (4, 28);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 4;
+INSERT INTO events VALUES (4, 29);
+USE DATABASE other;
+INSERT INTO hits VALUES (4, 29);
+USE DATABASE counts;
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 4;
+INSERT INTO events VALUES (4, 30);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 4;
+INSERT INTO events VALUES (4, 31);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 4;
+INSERT INTO events VALUES (4, 32);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 4;
+INSERT INTO events VALUES (4, 33);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 4;
+INSERT INTO events VALUES (4, 34);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 4;
+INSERT INTO events VALUES (4, 35);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 4;
+INSERT INTO events VALUES (4, 36);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 4;
+INSERT INTO events VALUES (4, 37);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 4;
+INSERT INTO events VALUES (4, 38);
+UPDATE counters SET n = n + 1 WHERE id = 0;
+UPDATE counters SET n = n + 1 WHERE id = 4;
+INSERT INTO events VALUES (4, 39);
+USE DATABASE other;
+INSERT INTO hits VALUES (4, 39);
+USE DATABASE counts;
+SELECT seq FROM events WHERE client = 4 AND seq > 36;
@@ -0,0 +1,5 @@
+USE DATABASE counts;
+SELECT * FROM counters;
+SELECT seq FROM events WHERE client = 2 AND seq > 37;
+USE DATABASE other;
+SELECT seq FROM hits WHERE client = 3;
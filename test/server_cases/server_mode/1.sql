@@ -0,0 +1,7 @@
+CREATE DATABASE shop;
+USE DATABASE shop;
+CREATE TABLE stock (id INTEGER, name TEXT, price FLOAT);
+INSERT INTO stock VALUES (1, 'pen', 1.50);
+INSERT INTO stock VALUES (2, 'ink', 7.25);
+INSERT INTO stock VALUES (3, 'pad', 3.00);
+SELECT * FROM stock;
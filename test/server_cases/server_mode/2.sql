@@ -0,0 +1,3 @@
+USE DATABASE shop;
+UPDATE stock SET price = price * 2 WHERE id = 2;
+SELECT name, price FROM stock WHERE price > 2.00;
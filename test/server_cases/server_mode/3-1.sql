@@ -0,0 +1,4 @@
+USE DATABASE shop;
+SELECT id FROM stock WHERE id = 1;
+SELECT id FROM missing;
+SELECT id FROM stock;
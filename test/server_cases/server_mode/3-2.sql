@@ -0,0 +1,3 @@
+USE DATABASE shop;
+SELECT id, name, price FROM stock;
+SELECT name FROM stock WHERE id > 5;
@@ -0,0 +1,10 @@
+CREATE DATABASE bank;
+USE DATABASE bank;
+CREATE TABLE a (id INTEGER, v INTEGER);
+CREATE TABLE b (id INTEGER, v INTEGER);
+INSERT INTO a VALUES (1, 0);
+INSERT INTO a VALUES (2, 0);
+INSERT INTO a VALUES (3, 0);
+INSERT INTO b VALUES (10, 0);
+INSERT INTO b VALUES (20, 0);
+INSERT INTO b VALUES (30, 0);
@@ -0,0 +1,201 @@
+USE DATABASE bank;
+BEGIN;
+UPDATE a SET v = v + 1000 WHERE id > 0;
+UPDATE b SET v = v + 1000 WHERE id > 0;
+ROLLBACK;
+BEGIN;
+UPDATE a SET v = v + 1000 WHERE id > 0;
+UPDATE b SET v = v + 1000 WHERE id > 0;
+ROLLBACK;
+BEGIN;
+UPDATE a SET v = v + 1000 WHERE id > 0;
+UPDATE b SET v = v + 1000 WHERE id > 0;
+ROLLBACK;
+BEGIN;
+UPDATE a SET v = v + 1000 WHERE id > 0;
+UPDATE b SET v = v + 1000 WHERE id > 0;
+ROLLBACK;
+BEGIN;
+UPDATE a SET v = v + 1000 WHERE id > 0;
+UPDATE b SET v = v + 1000 WHERE id > 0;
+ROLLBACK;
+BEGIN;
+UPDATE a SET v = v + 1000 WHERE id > 0;
+UPDATE b SET v = v + 1000 WHERE id > 0;
+ROLLBACK;
+BEGIN;
+UPDATE a SET v = v + 1000 WHERE id > 0;
+UPDATE b SET v = v + 1000 WHERE id > 0;
+ROLLBACK;
+BEGIN;
+UPDATE a SET v = v + 1000 WHERE id > 0;
+UPDATE b SET v = v + 1000 WHERE id > 0;
+ROLLBACK;
+BEGIN;
+UPDATE a SET v = v + 1000 WHERE id > 0;
+UPDATE b SET v = v + 1000 WHERE id > 0;
+ROLLBACK;
+BEGIN;
+UPDATE a SET v = v + 1000 WHERE id > 0;
+UPDATE b SET v = v + 1000 WHERE id > 0;
+ROLLBACK;
+BEGIN;
+UPDATE a SET v = v + 1000 WHERE id > 0;
+UPDATE b SET v = v + 1000 WHERE id > 0;
+ROLLBACK;
+BEGIN;
+UPDATE a SET v = v + 1000 WHERE id > 0;
+UPDATE b SET v = v + 1000 WHERE id > 0;
+ROLLBACK;
+BEGIN;
+UPDATE a SET v = v + 1000 WHERE id > 0;
+UPDATE b SET v = v + 1000 WHERE id > 0;
+ROLLBACK;
+BEGIN;
+UPDATE a SET v = v + 1000 WHERE id > 0;
+UPDATE b SET v = v + 1000 WHERE id > 0;
+ROLLBACK;
+BEGIN;
+UPDATE a SET v = v + 1000 WHERE id > 0;
+UPDATE b SET v = v + 1000 WHERE id > 0;
+ROLLBACK;
+BEGIN;
+UPDATE a SET v = v + 1000 WHERE id > 0;
+UPDATE b SET v = v + 1000 WHERE id > 0;
+ROLLBACK;
+BEGIN;
+UPDATE a SET v = v + 1000 WHERE id > 0;
+UPDATE b SET v = v + 1000 WHERE id > 0;
+ROLLBACK;
+BEGIN;
+UPDATE a SET v = v + 1000 WHERE id > 0;
+UPDATE b SET v = v + 1000 WHERE id > 0;
+ROLLBACK;
+BEGIN;
+UPDATE a SET v = v + 1000 WHERE id > 0;
+UPDATE b SET v = v + 1000 WHERE id > 0;
+ROLLBACK;
+BEGIN;
+UPDATE a SET v = v + 1000 WHERE id > 0;
+UPDATE b SET v = v + 1000 WHERE id > 0;
+ROLLBACK;
+BEGIN;
+UPDATE a SET v = v + 1000 WHERE id > 0;
+UPDATE b SET v = v + 1000 WHERE id > 0;
+ROLLBACK;
+BEGIN;
+UPDATE a SET v = v + 1000 WHERE id > 0;
+UPDATE b SET v = v + 1000 WHERE id > 0;
+ROLLBACK;
+BEGIN;
+UPDATE a SET v = v + 1000 WHERE id > 0;
+UPDATE b SET v = v + 1000 WHERE id > 0;
+ROLLBACK;
+BEGIN;
+UPDATE a SET v = v + 1000 WHERE id > 0;
+UPDATE b SET v = v + 1000 WHERE id > 0;
+ROLLBACK;
+BEGIN;
+UPDATE a SET v = v + 1000 WHERE id > 0;
+UPDATE b SET v = v + 1000 WHERE id > 0;
+ROLLBACK;
+BEGIN;
+UPDATE a SET v = v + 1000 WHERE id > 0;
+UPDATE b SET v = v + 1000 WHERE id > 0;
+ROLLBACK;
+BEGIN;
+UPDATE a SET v = v + 1000 WHERE id > 0;
+UPDATE b SET v = v + 1000 WHERE id > 0;
+ROLLBACK;
+BEGIN;
+UPDATE a SET v = v + 1000 WHERE id > 0;
+UPDATE b SET v = v + 1000 WHERE id > 0;
+ROLLBACK;
+BEGIN;
+UPDATE a SET v = v + 1000 WHERE id > 0;
+UPDATE b SET v = v + 1000 WHERE id > 0;
+ROLLBACK;
+BEGIN;
+UPDATE a SET v = v + 1000 WHERE id > 0;
+UPDATE b SET v = v + 1000 WHERE id > 0;
+ROLLBACK;
+BEGIN;
+UPDATE a SET v = v + 1000 WHERE id > 0;
+UPDATE b SET v = v + 1000 WHERE id > 0;
+ROLLBACK;
+BEGIN;
+UPDATE a SET v = v + 1000 WHERE id > 0;
+UPDATE b SET v = v + 1000 WHERE id > 0;
+ROLLBACK;
+BEGIN;
+UPDATE a SET v = v + 1000 WHERE id > 0;
+UPDATE b SET v = v + 1000 WHERE id > 0;
+ROLLBACK;
+BEGIN;
+UPDATE a SET v = v + 1000 WHERE id > 0;
+UPDATE b SET v = v + 1000 WHERE id > 0;
+ROLLBACK;
+BEGIN;
+UPDATE a SET v = v + 1000 WHERE id > 0;
+UPDATE b SET v = v + 1000 WHERE id > 0;
+ROLLBACK;
+BEGIN;
+UPDATE a SET v = v + 1000 WHERE id > 0;
+UPDATE b SET v = v + 1000 WHERE id > 0;
+ROLLBACK;
+BEGIN;
+UPDATE a SET v = v + 1000 WHERE id > 0;
+UPDATE b SET v = v + 1000 WHERE id > 0;
+ROLLBACK;
+BEGIN;
+UPDATE a SET v = v + 1000 WHERE id > 0;
+UPDATE b SET v = v + 1000 WHERE id > 0;
+ROLLBACK;
+BEGIN;
+UPDATE a SET v = v + 1000 WHERE id > 0;
+UPDATE b SET v = v + 1000 WHERE id > 0;
+ROLLBACK;
+BEGIN;
+UPDATE a SET v = v + 1000 WHERE id > 0;
+UPDATE b SET v = v + 1000 WHERE id > 0;
+ROLLBACK;
+BEGIN;
+UPDATE a SET v = v + 1000 WHERE id > 0;
+UPDATE b SET v = v + 1000 WHERE id > 0;
+ROLLBACK;
+BEGIN;
+UPDATE a SET v = v + 1000 WHERE id > 0;
+UPDATE b SET v = v + 1000 WHERE id > 0;
+ROLLBACK;
+BEGIN;
+UPDATE a SET v = v + 1000 WHERE id > 0;
+UPDATE b SET v = v + 1000 WHERE id > 0;
+ROLLBACK;
+BEGIN;
+UPDATE a SET v = v + 1000 WHERE id > 0;
+UPDATE b SET v = v + 1000 WHERE id > 0;
+ROLLBACK;
+BEGIN;
+UPDATE a SET v = v + 1000 WHERE id > 0;
+UPDATE b SET v = v + 1000 WHERE id > 0;
+ROLLBACK;
+BEGIN;
+UPDATE a SET v = v + 1000 WHERE id > 0;
+UPDATE b SET v = v + 1000 WHERE id > 0;
+ROLLBACK;
+BEGIN;
+UPDATE a SET v = v + 1000 WHERE id > 0;
+UPDATE b SET v = v + 1000 WHERE id > 0;
+ROLLBACK;
+BEGIN;
+UPDATE a SET v = v + 1000 WHERE id > 0;
+UPDATE b SET v = v + 1000 WHERE id > 0;
+ROLLBACK;
+BEGIN;
+UPDATE a SET v = v + 1000 WHERE id > 0;
+UPDATE b SET v = v + 1000 WHERE id > 0;
+ROLLBACK;
+BEGIN;
+UPDATE a SET v = v + 1000 WHERE id > 0;
+UPDATE b SET v = v + 1000 WHERE id > 0;
+ROLLBACK;
@@ -0,0 +1,101 @@
+USE DATABASE bank;
+SELECT a.id, b.id FROM a INNER JOIN b ON a.v = b.v;
+SELECT id FROM b WHERE v > 999;
+SELECT a.id, b.id FROM a INNER JOIN b ON a.v = b.v;
+SELECT id FROM b WHERE v > 999;
+SELECT a.id, b.id FROM a INNER JOIN b ON a.v = b.v;
+SELECT id FROM b WHERE v > 999;
+SELECT a.id, b.id FROM a INNER JOIN b ON a.v = b.v;
+SELECT id FROM b WHERE v > 999;
+SELECT a.id, b.id FROM a INNER JOIN b ON a.v = b.v;
+SELECT id FROM b WHERE v > 999;
+SELECT a.id, b.id FROM a INNER JOIN b ON a.v = b.v;
+SELECT id FROM b WHERE v > 999;
+SELECT a.id, b.id FROM a INNER JOIN b ON a.v = b.v;
+SELECT id FROM b WHERE v > 999;
+SELECT a.id, b.id FROM a INNER JOIN b ON a.v = b.v;
+SELECT id FROM b WHERE v > 999;
+SELECT a.id, b.id FROM a INNER JOIN b ON a.v = b.v;
+SELECT id FROM b WHERE v > 999;
+SELECT a.id, b.id FROM a INNER JOIN b ON a.v = b.v;
+SELECT id FROM b WHERE v > 999;
+SELECT a.id, b.id FROM a INNER JOIN b ON a.v = b.v;
+SELECT id FROM b WHERE v > 999;
+SELECT a.id, b.id FROM a INNER JOIN b ON a.v = b.v;
+SELECT id FROM b WHERE v > 999;
+SELECT a.id, b.id FROM a INNER JOIN b ON a.v = b.v;
+SELECT id FROM b WHERE v > 999;
+SELECT a.id, b.id FROM a INNER JOIN b ON a.v = b.v;
+SELECT id FROM b WHERE v > 999;
+SELECT a.id, b.id FROM a INNER JOIN b ON a.v = b.v;
+SELECT id FROM b WHERE v > 999;
+SELECT a.id, b.id FROM a INNER JOIN b ON a.v = b.v;
+SELECT id FROM b WHERE v > 999;
+SELECT a.id, b.id FROM a INNER JOIN b ON a.v = b.v;
+SELECT id FROM b WHERE v > 999;
+SELECT a.id, b.id FROM a INNER JOIN b ON a.v = b.v;
+SELECT id FROM b WHERE v > 999;
+SELECT a.id, b.id FROM a INNER JOIN b ON a.v = b.v;
+SELECT id FROM b WHERE v > 999;
+SELECT a.id, b.id FROM a INNER JOIN b ON a.v = b.v;
+SELECT id FROM b WHERE v > 999;
+SELECT a.id, b.id FROM a INNER JOIN b ON a.v = b.v;
+SELECT id FROM b WHERE v > 999;
+SELECT a.id, b.id FROM a INNER JOIN b ON a.v = b.v;
+SELECT id FROM b WHERE v > 999;
+SELECT a.id, b.id FROM a INNER JOIN b ON a.v = b.v;
+SELECT id FROM b WHERE v > 999;
+SELECT a.id, b.id FROM a INNER JOIN b ON a.v = b.v;
+SELECT id FROM b WHERE v > 999;
+SELECT a.id, b.id FROM a INNER JOIN b ON a.v = b.v;
+SELECT id FROM b WHERE v > 999;
+SELECT a.id, b.id FROM a INNER JOIN b ON a.v = b.v;
+SELECT id FROM b WHERE v > 999;
+SELECT a.id, b.id FROM a INNER JOIN b ON a.v = b.v;
+SELECT id FROM b WHERE v > 999;
+SELECT a.id, b.id FROM a INNER JOIN b ON a.v = b.v;
+SELECT id FROM b WHERE v > 999;
+SELECT a.id, b.id FROM a INNER JOIN b ON a.v = b.v;
+SELECT id FROM b WHERE v > 999;
+SELECT a.id, b.id FROM a INNER JOIN b ON a.v = b.v;
+SELECT id FROM b WHERE v > 999;
+SELECT a.id, b.id FROM a INNER JOIN b ON a.v = b.v;
+SELECT id FROM b WHERE v > 999;
+SELECT a.id, b.id FROM a INNER JOIN b ON a.v = b.v;
+SELECT id FROM b WHERE v > 999;
+SELECT a.id, b.id FROM a INNER JOIN b ON a.v = b.v;
+SELECT id FROM b WHERE v > 999;
+SELECT a.id, b.id FROM a INNER JOIN b ON a.v = b.v;
+SELECT id FROM b WHERE v > 999;
+SELECT a.id, b.id FROM a INNER JOIN b ON a.v = b.v;
+SELECT id FROM b WHERE v > 999;
+SELECT a.id, b.id FROM a INNER JOIN b ON a.v = b.v;
+SELECT id FROM b WHERE v > 999;
+SELECT a.id, b.id FROM a INNER JOIN b ON a.v = b.v;
+SELECT id FROM b WHERE v > 999;
+SELECT a.id, b.id FROM a INNER JOIN b ON a.v = b.v;
+SELECT id FROM b WHERE v > 999;
+SELECT a.id, b.id FROM a INNER JOIN b ON a.v = b.v;
+SELECT id FROM b WHERE v > 999;
+SELECT a.id, b.id FROM a INNER JOIN b ON a.v = b.v;
+SELECT id FROM b WHERE v > 999;
+SELECT a.id, b.id FROM a INNER JOIN b ON a.v = b.v;
+SELECT id FROM b WHERE v > 999;
+SELECT a.id, b.id FROM a INNER JOIN b ON a.v = b.v;
+SELECT id FROM b WHERE v > 999;
+SELECT a.id, b.id FROM a INNER JOIN b ON a.v = b.v;
+SELECT id FROM b WHERE v > 999;
+SELECT a.id, b.id FROM a INNER JOIN b ON a.v = b.v;
+SELECT id FROM b WHERE v > 999;
+SELECT a.id, b.id FROM a INNER JOIN b ON a.v = b.v;
+SELECT id FROM b WHERE v > 999;
+SELECT a.id, b.id FROM a INNER JOIN b ON a.v = b.v;
+SELECT id FROM b WHERE v > 999;
+SELECT a.id, b.id FROM a INNER JOIN b ON a.v = b.v;
+SELECT id FROM b WHERE v > 999;
+SELECT a.id, b.id FROM a INNER JOIN b ON a.v = b.v;
+SELECT id FROM b WHERE v > 999;
+SELECT a.id, b.id FROM a INNER JOIN b ON a.v = b.v;
+SELECT id FROM b WHERE v > 999;
+SELECT a.id, b.id FROM a INNER JOIN b ON a.v = b.v;
+SELECT id FROM b WHERE v > 999;
@@ -0,0 +1,3 @@
+USE DATABASE bank;
+SELECT * FROM a;
+SELECT * FROM b;